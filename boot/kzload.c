@@ -0,0 +1,99 @@
+#include <inc/x86.h>
+#include <inc/elf.h>
+
+/**********************************************************************
+ * Stage-2 loader for a compressed kernel.
+ *
+ * When the kernel is built with KERNEL_COMPRESS=1 (see kern/Makefrag),
+ * the ELF image after the boot sector is this program rather than the
+ * kernel.  The boot sector loads it like any kernel and jumps here.
+ * Linked into it is the kernel's ELF image, compressed by
+ * boot/lz4pack.c: a 4-byte uncompressed size, then an LZ4 block.
+ *
+ * kzmain() decompresses the kernel into scratch memory, loads its
+ * segments from there the same way bootmain() would have from disk,
+ * and jumps to its entry point.  Reading fewer sectors with port I/O
+ * more than pays for the decompression.
+ **********************************************************************/
+
+#define KERNEL_SCRATCH	((uint8_t *) 0x1000000)	// 16MB, above us and the kernel
+
+extern const uint8_t _binary_obj_kern_kernel_lz4_start[];
+extern const uint8_t _binary_obj_kern_kernel_lz4_end[];
+
+// Decompress the LZ4 block [src, src_end) to dst.
+// Returns the end of the decompressed data.
+static uint8_t *
+lz4_decompress(uint8_t *dst, const uint8_t *src, const uint8_t *src_end)
+{
+	const uint8_t *match;
+	uint32_t len;
+	uint8_t token;
+
+	while (src < src_end) {
+		token = *src++;
+
+		// literals
+		len = token >> 4;
+		if (len == 15)
+			do {
+				len += *src;
+			} while (*src++ == 255);
+		while (len-- > 0)
+			*dst++ = *src++;
+		// the last sequence has no match
+		if (src >= src_end)
+			break;
+
+		// match; it may overlap what it produces, so copy bytewise
+		match = dst - (src[0] | (src[1] << 8));
+		src += 2;
+		len = token & 15;
+		if (len == 15)
+			do {
+				len += *src;
+			} while (*src++ == 255);
+		len += 4;
+		while (len-- > 0)
+			*dst++ = *match++;
+	}
+	return dst;
+}
+
+void
+kzmain(void)
+{
+	const uint8_t *src = _binary_obj_kern_kernel_lz4_start;
+	struct Elf *elf = (struct Elf *) KERNEL_SCRATCH;
+	struct Proghdr *ph, *eph;
+	uint32_t size, i;
+	uint8_t *end;
+
+	size = src[0] | (src[1] << 8) | (src[2] << 16) | (src[3] << 24);
+	end = lz4_decompress(KERNEL_SCRATCH, src + 4,
+			     _binary_obj_kern_kernel_lz4_end);
+
+	// is this a valid ELF?
+	if (end != KERNEL_SCRATCH + size || elf->e_magic != ELF_MAGIC)
+		goto bad;
+
+	// load each program segment (ignores ph flags)
+	ph = (struct Proghdr *) ((uint8_t *) elf + elf->e_phoff);
+	eph = ph + elf->e_phnum;
+	for (; ph < eph; ph++) {
+		for (i = 0; i < ph->p_filesz; i++)
+			((uint8_t *) ph->p_pa)[i] = KERNEL_SCRATCH[ph->p_offset + i];
+		for (; i < ph->p_memsz; i++)
+			((uint8_t *) ph->p_pa)[i] = 0;
+	}
+
+	// call the entry point from the ELF header
+	// note: does not return!
+	((void (*)(void)) (elf->e_entry))();
+
+bad:
+	outw(0x8A00, 0x8A00);
+	outw(0x8A00, 0x8E00);
+	while (1)
+		/* do nothing */;
+}
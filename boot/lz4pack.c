@@ -0,0 +1,135 @@
+// Compress a file for the stage-2 loader in boot/kzload.c.
+//
+// Output is a 4-byte little-endian uncompressed size followed by the
+// data in LZ4 block format.  This is a plain greedy compressor: it
+// trades ratio for simplicity; decompression speed is what matters.
+//
+// usage: lz4pack infile outfile
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#define HASH_LOG	16
+#define MINMATCH	4
+#define MFLIMIT		12	// No match may start in the last 12 bytes
+#define LASTLITERALS	5	// The last 5 bytes are always literals
+#define MAXOFFSET	65535
+
+static uint8_t *out;
+static size_t outlen;
+
+static uint32_t
+read32(const uint8_t *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, 4);
+	return v;
+}
+
+static uint32_t
+hash(uint32_t v)
+{
+	return (v * 2654435761u) >> (32 - HASH_LOG);
+}
+
+static void
+putlen(size_t len)
+{
+	for (; len >= 255; len -= 255)
+		out[outlen++] = 255;
+	out[outlen++] = len;
+}
+
+// Emit literals [lit, lit+litlen) followed by a match of 'mlen' bytes
+// at distance 'off' (no match if mlen is 0).
+static void
+emit(const uint8_t *lit, size_t litlen, size_t off, size_t mlen)
+{
+	uint8_t *token = &out[outlen++];
+
+	*token = (litlen < 15 ? litlen : 15) << 4;
+	if (litlen >= 15)
+		putlen(litlen - 15);
+	memcpy(out + outlen, lit, litlen);
+	outlen += litlen;
+	if (!mlen)
+		return;
+
+	out[outlen++] = off;
+	out[outlen++] = off >> 8;
+	mlen -= MINMATCH;
+	*token |= mlen < 15 ? mlen : 15;
+	if (mlen >= 15)
+		putlen(mlen - 15);
+}
+
+int
+main(int argc, char **argv)
+{
+	static int32_t table[1 << HASH_LOG];	// Position + 1, 0 if none
+	FILE *f;
+	uint8_t *in;
+	size_t n, ip, anchor, ref, mlen;
+	long size;
+	uint32_t h;
+
+	if (argc != 3) {
+		fprintf(stderr, "usage: lz4pack infile outfile\n");
+		exit(2);
+	}
+
+	if ((f = fopen(argv[1], "rb")) == NULL) {
+		perror(argv[1]);
+		exit(1);
+	}
+	fseek(f, 0, SEEK_END);
+	size = ftell(f);
+	rewind(f);
+	n = size;
+	in = malloc(n + 1);
+	out = malloc(4 + n + n / 255 + 16);
+	if (!in || !out || fread(in, 1, n, f) != n) {
+		fprintf(stderr, "lz4pack: cannot read %s\n", argv[1]);
+		exit(1);
+	}
+	fclose(f);
+
+	out[0] = n;
+	out[1] = n >> 8;
+	out[2] = n >> 16;
+	out[3] = n >> 24;
+	outlen = 4;
+
+	ip = anchor = 0;
+	while (n >= MFLIMIT && ip <= n - MFLIMIT) {
+		h = hash(read32(in + ip));
+		ref = table[h];
+		table[h] = ip + 1;
+		if (ref == 0 || ip - (ref - 1) > MAXOFFSET
+		    || read32(in + ref - 1) != read32(in + ip)) {
+			ip++;
+			continue;
+		}
+		ref--;
+		for (mlen = MINMATCH;
+		     ip + mlen < n - LASTLITERALS && in[ref + mlen] == in[ip + mlen];
+		     mlen++)
+			/* do nothing */;
+		emit(in + anchor, ip - anchor, ip - ref, mlen);
+		ip += mlen;
+		anchor = ip;
+	}
+	emit(in + anchor, n - anchor, 0, 0);
+
+	if ((f = fopen(argv[2], "wb")) == NULL
+	    || fwrite(out, 1, outlen, f) != outlen || fclose(f) != 0) {
+		perror(argv[2]);
+		exit(1);
+	}
+	fprintf(stderr, "%s: %lu bytes compressed to %lu\n",
+		argv[1], (unsigned long) n, (unsigned long) outlen);
+	return 0;
+}
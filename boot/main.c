@@ -30,10 +30,12 @@
  **********************************************************************/
 
 #define SECTSIZE	512
+#define MAXSECTS	256	// most sectors one READ SECTORS can transfer
 #define ELFHDR		((struct Elf *) 0x10000) // scratch space
 
-void readsect(void*, uint32_t);
+static void readsects(void*, uint32_t, uint32_t);
 void readseg(uint32_t, uint32_t, uint32_t);
+void bad(void) __attribute__((noreturn));
 
 void
 bootmain(void)
@@ -46,7 +48,7 @@ bootmain(void)
 
 	// is this a valid ELF?
 	if (ELFHDR->e_magic != ELF_MAGIC)
-		goto bad;
+		bad();
 
 	// load each program segment (ignores ph flags)
 	ph = (struct Proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
@@ -63,8 +65,13 @@ bootmain(void)
 	// call the entry point from the ELF header
 	// note: does not return!
 	((void (*)(void)) (ELFHDR->e_entry))();
+	bad();
+}
 
-bad:
+// Give up: tell Bochs/QEMU's debug port and hang.
+void
+bad(void)
+{
 	outw(0x8A00, 0x8A00);
 	outw(0x8A00, 0x8E00);
 	while (1)
@@ -76,7 +83,7 @@ bad:
 void
 readseg(uint32_t pa, uint32_t count, uint32_t offset)
 {
-	uint32_t end_pa;
+	uint32_t end_pa, n;
 
 	end_pa = pa + count;
 
@@ -86,21 +93,24 @@ readseg(uint32_t pa, uint32_t count, uint32_t offset)
 	// translate from bytes to sectors, and kernel starts at sector 1
 	offset = (offset / SECTSIZE) + 1;
 
-	// If this is too slow, we could read lots of sectors at a time.
-	// We'd write more to memory than asked, but it doesn't matter --
+	// Read as many sectors per disk command as the drive allows.
+	// We might write more to memory than asked, but it doesn't matter --
 	// we load in increasing order.
 	while (pa < end_pa) {
+		n = (end_pa - pa + SECTSIZE - 1) / SECTSIZE;
+		if (n > MAXSECTS)
+			n = MAXSECTS;
 		// Since we haven't enabled paging yet and we're using
 		// an identity segment mapping (see boot.S), we can
 		// use physical addresses directly.  This won't be the
 		// case once JOS enables the MMU.
-		readsect((uint8_t*) pa, offset);
-		pa += SECTSIZE;
-		offset++;
+		readsects((uint8_t*) pa, offset, n);
+		pa += n * SECTSIZE;
+		offset += n;
 	}
 }
 
-void
+static void
 waitdisk(void)
 {
 	// wait for disk reaady
@@ -108,23 +118,32 @@ waitdisk(void)
 		/* do nothing */;
 }
 
-void
-readsect(void *dst, uint32_t offset)
+// Read 'nsect' (1 to MAXSECTS) consecutive sectors starting at 'offset'
+// with one command.
+static void
+readsects(void *dst, uint32_t offset, uint32_t nsect)
 {
+	uint8_t r;
+
 	// wait for disk to be ready
 	waitdisk();
 
-	outb(0x1F2, 1);		// count = 1
+	outb(0x1F2, nsect);	// count; 0 means 256
 	outb(0x1F3, offset);
 	outb(0x1F4, offset >> 8);
 	outb(0x1F5, offset >> 16);
 	outb(0x1F6, (offset >> 24) | 0xE0);
 	outb(0x1F7, 0x20);	// cmd 0x20 - read sectors
 
-	// wait for disk to be ready
-	waitdisk();
-
-	// read a sector
-	insl(0x1F0, dst, SECTSIZE/4);
+	// the drive has each sector ready in turn: wait for
+	// BSY clear and DRQ set before reading it.  A failed read
+	// leaves BSY and DRQ clear with ERR or DF set instead.
+	while (nsect-- > 0) {
+		while (((r = inb(0x1F7)) & 0x88) != 0x08)
+			if ((r & 0x80) == 0 && (r & 0x21))
+				bad();
+		insl(0x1F0, dst, SECTSIZE/4);
+		dst += SECTSIZE;
+	}
 }
 
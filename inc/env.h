@@ -11,24 +11,30 @@ typedef int32_t envid_t;
 
 // An environment ID 'envid_t' has three parts:
 //
-// +1+---------------21-----------------+--------10--------+
-// |0|          Uniqueifier             |   Environment    |
-// | |                                  |      Index       |
-// +------------------------------------+------------------+
-//                                       \--- ENVX(eid) --/
+// +1+------------16-------------+------------15-------------+
+// |0|        Uniqueifier         |    Environment Index      |
+// +------------------------------+---------------------------+
+//                                 \------- ENVX(eid) -------/
 //
 // The environment index ENVX(eid) equals the environment's index in the
 // 'envs[]' array.  The uniqueifier distinguishes environments that were
 // created at different times, but share the same environment index.
 //
+// envs[] has room for NENV environments, but the kernel only backs it
+// with memory as environments are created, so entries past the last
+// page it has grown into are unmapped.
+//
 // All real environments are greater than 0 (so the sign bit is zero).
 // envid_ts less than 0 signify errors.  The envid_t == 0 is special, and
 // stands for the current environment.
 
-#define LOG2NENV		10
+#define LOG2NENV		15
 #define NENV			(1 << LOG2NENV)
 #define ENVX(envid)		((envid) & (NENV - 1))
 
+// Number of hardware performance counters virtualized per environment
+#define ENV_NPMC		4
+
 // Values of env_status in struct Env
 enum {
 	ENV_FREE = 0,
@@ -43,28 +49,77 @@ enum EnvType {
 	ENV_TYPE_USER = 0,
 };
 
+// Register image written by FXSAVE and read by FXRSTOR.
+struct Fxsave {
+	uint8_t fx_data[512];
+} __attribute__((aligned(16)));
+
+// struct Env is grouped by which CPUs write each part, with every group
+// starting on its own cache line, so scanning envs[] in sched_yield or
+// sending IPC doesn't pull in lines the env's own CPU keeps dirtying.
 struct Env {
-	struct Trapframe env_tf;	// Saved registers
-	struct Env *env_link;		// Next free Env
-	envid_t env_id;			// Unique environment identifier
-	envid_t env_parent_id;		// env_id of this env's parent
-	enum EnvType env_type;		// Indicates special system environments
+	// Scheduling state.  Read by every CPU's scheduler scan and
+	// written by env_run on every switch.
 	unsigned env_status;		// Status of the environment
-	uint32_t env_runs;		// Number of times environment has run
 	int env_cpunum;			// The CPU that the env is running on
 
-	// Address space
+	// Identity and options.  Read on most system calls, written only
+	// when the env is created, freed or changes its options.
+	envid_t env_id __attribute__((aligned(CACHELINE)));
+					// Unique environment identifier
+	envid_t env_parent_id;		// env_id of this env's parent
+	enum EnvType env_type;		// Indicates special system environments
+	struct Env *env_link;		// Next free Env
 	pde_t *env_pgdir;		// Kernel virtual address of page dir
+	uint32_t env_page_quota;	// Limit on npages + nptabs (0 = none)
 
 	// Exception handling
 	void *env_pgfault_upcall;	// Page fault upcall entry point
+	bool env_kern_cow;		// Kernel resolves PTE_COW write faults
+	bool env_trace;			// Log system calls to the trace ring
+	bool env_rdpmc;			// May read the counters with RDPMC
+
+	// Read-only info page mapped at UINFO
+	struct Uinfo *env_uinfo;	// Kernel virtual address of it
+
+	// Asynchronous system call ring mapped at USYSRING, or NULL
+	struct Sysring *env_ring;	// Kernel virtual address of it
+
+	// Written by the CPU running the env on every switch.
+	struct Trapframe env_tf __attribute__((aligned(CACHELINE)));
+					// Saved registers
+	uint32_t env_runs;		// Number of times environment has run
+	uint32_t env_npages;		// User pages mapped in env_pgdir
+	uint32_t env_nptabs;		// Page tables allocated for env_pgdir
 
-	// Lab 4 IPC
-	bool env_ipc_recving;		// Env is blocked receiving
+	// Lab 4 IPC.  Written by the sender's CPU.
+	bool env_ipc_recving __attribute__((aligned(CACHELINE)));
+					// Env is blocked receiving
 	void *env_ipc_dstva;		// VA at which to map received page
 	uint32_t env_ipc_value;		// Data value sent to us
 	envid_t env_ipc_from;		// envid of the sender
 	int env_ipc_perm;		// Perm of page mapping received
+
+	// x87/SSE state, loaded lazily on the first FPU use after each
+	// switch to this environment (see env_fpu_trap in kern/env.c)
+	struct Fxsave env_fpu __attribute__((aligned(CACHELINE)));
+					// FXSAVE image
+	bool env_fpu_used;		// env_fpu holds saved state
+
+	// Hardware performance counts while in user mode
+	// (see kern/pmu.c)
+	uint64_t env_pmc[ENV_NPMC];	// Cycles, instrs, LLC, DTLB misses
+} __attribute__((aligned(CACHELINE)));
+
+// Per-environment information the kernel publishes read-only at UINFO,
+// so user code can answer simple questions without a system call.
+struct Uinfo {
+	envid_t ui_envid;		// This environment's id
+	uint32_t ui_cpunum;		// CPU this environment last ran on
+	uint32_t ui_runs;		// Times this environment has been run
+	uint32_t ui_tsc_khz;		// TSC frequency (0 if unknown)
+	uint32_t ui_ticks;		// Timer ticks on ui_cpunum at last update
+	uint32_t ui_env_ticks;		// Timer ticks taken while this env ran
 };
 
 #endif // !JOS_INC_ENV_H
@@ -28,6 +28,7 @@ extern const char *binaryname;
 extern const volatile struct Env *thisenv;
 extern const volatile struct Env envs[NENV];
 extern const volatile struct PageInfo pages[];
+extern const volatile struct Uinfo uinfo;
 
 // exit.c
 void	exit(void);
@@ -35,6 +36,12 @@ void	exit(void);
 // pgfault.c
 void	set_pgfault_handler(void (*handler)(struct UTrapframe *utf));
 
+// stdout.c
+int	bprintf(const char *fmt, ...);
+int	vbprintf(const char *fmt, va_list);
+void	bwrite(const char *s, size_t len);
+void	bflush(void);
+
 // readline.c
 char*	readline(const char *buf);
 
@@ -47,10 +54,17 @@ void	sys_yield(void);
 static envid_t sys_exofork(void);
 int	sys_env_set_status(envid_t env, int status);
 int	sys_env_set_pgfault_upcall(envid_t env, void *upcall);
+int	sys_env_set_cow(envid_t env, int enable);
+int	sys_env_set_quota(envid_t env, uint32_t npages);
+int	sys_env_set_trace(envid_t env, int enable);
+int	sys_env_set_rdpmc(envid_t env, int enable);
 int	sys_page_alloc(envid_t env, void *pg, int perm);
 int	sys_page_map(envid_t src_env, void *src_pg,
 		     envid_t dst_env, void *dst_pg, int perm);
 int	sys_page_unmap(envid_t env, void *pg);
+int	sys_page_reuse(envid_t env, void *pg);
+int	sys_ring_setup(void);
+int	sys_ring_enter(void);
 int	sys_ipc_try_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int	sys_ipc_recv(void *rcv_pg);
 
@@ -70,6 +84,19 @@ void	ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
 envid_t	ipc_find_env(enum EnvType type);
 
+// sysring.c
+int	sysring_setup(void);
+int	sysring_submit(uint32_t tag, uint32_t num, uint32_t a1, uint32_t a2,
+		       uint32_t a3, uint32_t a4, uint32_t a5);
+int	sysring_enter(void);
+int	sysring_reap(uint32_t *tag_store, int32_t *ret_store);
+
+// uinfo.c
+envid_t	uinfo_envid(void);
+int	uinfo_cpunum(void);
+uint32_t uinfo_ticks(void);
+uint64_t uinfo_nsec(void);
+
 // fork.c
 #define	PTE_SHARE	0x400
 envid_t	fork(void);
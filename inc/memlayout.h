@@ -17,6 +17,7 @@
 #define GD_UT     0x18     // user text
 #define GD_UD     0x20     // user data
 #define GD_TSS0   0x28     // Task segment selector for CPU 0
+#define GD_CPU0   0x68     // Per-CPU data segment for CPU 0 (GD_TSS0 + NCPU*8)
 
 /*
  * Virtual memory map:                                Permissions
@@ -44,20 +45,24 @@
  *                     :              .               :                   |
  *                     :              .               :                   |
  *    MMIOLIM ------>  +------------------------------+ 0xefc00000      --+
- *                     |       Memory-mapped I/O      | RW/--  PTSIZE
- * ULIM, MMIOBASE -->  +------------------------------+ 0xef800000
+ *                     |   Per-CPU kmap() Windows     | RW/--  KMAPSIZE   |
+ *    KMAPBASE ----->  +------------------------------+ 0xefbc0000      PTSIZE
+ *                     |       Memory-mapped I/O      | RW/--             |
+ * ULIM, MMIOBASE -->  +------------------------------+ 0xef800000      --+
  *                     |  Cur. Page Table (User R-)   | R-/R-  PTSIZE
  *    UVPT      ---->  +------------------------------+ 0xef400000
  *                     |          RO PAGES            | R-/R-  PTSIZE
  *    UPAGES    ---->  +------------------------------+ 0xef000000
- *                     |           RO ENVS            | R-/R-  PTSIZE
- * UTOP,UENVS ------>  +------------------------------+ 0xeec00000
+ *                     |     RO ENVS (on demand)      | R-/R-  UENVSIZE
+ *    UENVS     ---->  +------------------------------+ 0xed000000
+ *                     |     Kernel's ENVS (KENVS)    | RW/--  UENVSIZE
+ * UTOP,KENVS ------>  +------------------------------+ 0xeb000000
  * UXSTACKTOP -/       |     User Exception Stack     | RW/RW  PGSIZE
- *                     +------------------------------+ 0xeebff000
+ *                     +------------------------------+ 0xeafff000
  *                     |       Empty Memory (*)       | --/--  PGSIZE
- *    USTACKTOP  --->  +------------------------------+ 0xeebfe000
+ *    USTACKTOP  --->  +------------------------------+ 0xeaffe000
  *                     |      Normal User Stack       | RW/RW  PGSIZE
- *                     +------------------------------+ 0xeebfd000
+ *                     +------------------------------+ 0xeaffd000
  *                     |                              |
  *                     |                              |
  *                     ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -70,6 +75,10 @@
  *    PFTEMP ------->  |       Empty Memory (*)       |        PTSIZE
  *                     |                              |
  *    UTEMP -------->  +------------------------------+ 0x00400000      --+
+ *                     |     Env Info Page (UINFO)    | R-/R-  PGSIZE     |
+ *                     | - - - - - - - - - - - - - - -| 0x003ff000        |
+ *                     |  Syscall Ring (USYSRING)     | RW/RW  PGSIZE     |
+ *                     | - - - - - - - - - - - - - - -| 0x003fe000        |
  *                     |       Empty Memory (*)       |                   |
  *                     | - - - - - - - - - - - - - - -|                   |
  *                     |  User STAB Data (optional)   |                 PTSIZE
@@ -101,6 +110,12 @@
 #define MMIOLIM		(KSTACKTOP - PTSIZE)
 #define MMIOBASE	(MMIOLIM - PTSIZE)
 
+// Per-CPU temporary mappings of high memory (see kmap()), carved from
+// the top of the MMIO region.
+#define KMAPSIZE	(64*PGSIZE)
+#define KMAPLIM		MMIOLIM
+#define KMAPBASE	(KMAPLIM - KMAPSIZE)
+
 #define ULIM		(MMIOBASE)
 
 /*
@@ -112,15 +127,18 @@
 #define UVPT		(ULIM - PTSIZE)
 // Read-only copies of the Page structures
 #define UPAGES		(UVPT - PTSIZE)
-// Read-only copies of the global env structures
-#define UENVS		(UPAGES - PTSIZE)
+// Read-only copies of the global env structures, mapped as envs[] grows
+#define UENVSIZE	(8*PTSIZE)
+#define UENVS		(UPAGES - UENVSIZE)
+// The kernel's writable view of the same pages; not accessible to users
+#define KENVS		(UENVS - UENVSIZE)
 
 /*
  * Top of user VM. User can manipulate VA from UTOP-1 and down!
  */
 
 // Top of user-accessible VM
-#define UTOP		UENVS
+#define UTOP		KENVS
 // Top of one-page user exception stack
 #define UXSTACKTOP	UTOP
 // Next page left invalid to guard against exception stack overflow; then:
@@ -137,6 +155,10 @@
 #define PFTEMP		(UTEMP + PTSIZE - PGSIZE)
 // The location of the user-level STABS data structure
 #define USTABDATA	(PTSIZE / 2)
+// Each environment's read-only struct Uinfo (see inc/env.h)
+#define UINFO		(PTSIZE - PGSIZE)
+// Each environment's struct Sysring, once set up (see inc/syscall.h)
+#define USYSRING	(UINFO - PGSIZE)
 
 // Physical address of startup code for non-boot CPUs (APs)
 #define MPENTRY_PADDR	0x7000
@@ -185,6 +207,11 @@ struct PageInfo {
 	// boot_alloc do not have valid reference count fields.
 
 	uint16_t pp_ref;
+
+	// For a page directory belonging to an environment, the index of
+	// that environment in envs[] plus one; 0 for every other page.
+	// Lets pmap.c charge mappings to the environment that owns them.
+	uint16_t pp_pgdir_owner;
 };
 
 #endif /* !__ASSEMBLER__ */
@@ -54,6 +54,8 @@
 #define PTXSHIFT	12		// offset of PTX in a linear address
 #define PDXSHIFT	22		// offset of PDX in a linear address
 
+#define CACHELINE	64		// bytes per cache line
+
 // Page table/directory entry flags.
 #define PTE_P		0x001	// Present
 #define PTE_W		0x002	// Writeable
@@ -69,6 +71,12 @@
 // hardware, so user processes are allowed to set them arbitrarily.
 #define PTE_AVAIL	0xE00	// Available for software use
 
+// PTE_COW marks copy-on-write page table entries.
+// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
+// The kernel only interprets it for environments that have asked it to
+// resolve copy-on-write faults itself (see sys_env_set_cow).
+#define PTE_COW		0x800
+
 // Flags in PTE_SYSCALL may be used in system calls.  (Others may not.)
 #define PTE_SYSCALL	(PTE_AVAIL | PTE_P | PTE_W | PTE_U)
 
@@ -88,6 +96,8 @@
 #define CR0_CD		0x40000000	// Cache Disable
 #define CR0_PG		0x80000000	// Paging
 
+#define CR4_OSXMMEXCPT	0x00000400	// OS handles SIMD FP exceptions
+#define CR4_OSFXSR	0x00000200	// OS supports FXSAVE/FXRSTOR and SSE
 #define CR4_PCE		0x00000100	// Performance counter enable
 #define CR4_MCE		0x00000040	// Machine Check Enable
 #define CR4_PSE		0x00000010	// Page Size Extensions
@@ -96,6 +106,16 @@
 #define CR4_PVI		0x00000002	// Protected-Mode Virtual Interrupts
 #define CR4_VME		0x00000001	// V86 Mode Extensions
 
+// CPUID leaf 1 feature flags (returned in %edx)
+#define CPUID_SEP	0x00000800	// SYSENTER/SYSEXIT
+#define CPUID_FXSR	0x01000000	// FXSAVE/FXRSTOR
+#define CPUID_SSE2	0x04000000	// SSE2 extensions (incl. MOVNTI)
+
+// Model-specific registers
+#define MSR_SYSENTER_CS		0x174	// Kernel %cs on SYSENTER (%ss = +8)
+#define MSR_SYSENTER_ESP	0x175	// Kernel %esp on SYSENTER
+#define MSR_SYSENTER_EIP	0x176	// Kernel %eip on SYSENTER
+
 // Eflags register
 #define FL_CF		0x00000001	// Carry Flag
 #define FL_PF		0x00000004	// Parity Flag
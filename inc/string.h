@@ -20,6 +20,10 @@ void *	memmove(void *dst, const void *src, size_t len);
 int	memcmp(const void *s1, const void *s2, size_t len);
 void *	memfind(const void *s, int c, size_t len);
 
+// Page-granular copy and zero; both addresses must be page-aligned.
+void	page_copy(void *dst, const void *src);
+void	page_zero(void *dst);
+
 long	strtol(const char *s, char **endptr, int base);
 
 #endif /* not JOS_INC_STRING_H */
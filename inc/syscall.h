@@ -16,7 +16,50 @@ enum {
 	SYS_yield,
 	SYS_ipc_try_send,
 	SYS_ipc_recv,
+	SYS_env_set_cow,
+	SYS_page_reuse,
+	SYS_env_set_quota,
+	SYS_ring_setup,
+	SYS_ring_enter,
+	SYS_env_set_trace,
+	SYS_env_set_rdpmc,
 	NSYSCALLS
 };
 
+#ifndef __ASSEMBLER__
+
+#include <inc/types.h>
+
+/*
+ * Asynchronous system call ring, mapped read/write at USYSRING by
+ * sys_ring_setup.  The environment queues requests at sr_sq_tail and
+ * calls sys_ring_enter (or blocks, and lets an idle CPU find them); the
+ * kernel runs them in order and posts one completion per request at
+ * sr_cq_tail.  Each side only ever writes its own two indices, which
+ * count up freely and are reduced modulo SYSRING_SIZE to index.
+ */
+#define SYSRING_SIZE	64		// Entries per ring; a power of two
+
+struct SysringSqe {
+	uint32_t sqe_num;		// SYS_* number
+	uint32_t sqe_args[5];		// Arguments, as for syscall()
+	uint32_t sqe_tag;		// Copied into the completion
+};
+
+struct SysringCqe {
+	uint32_t cqe_tag;		// sqe_tag of the request
+	int32_t cqe_ret;		// Its return value
+};
+
+struct Sysring {
+	volatile uint32_t sr_sq_head;	// Next request to run (kernel)
+	volatile uint32_t sr_sq_tail;	// Next free request slot (user)
+	volatile uint32_t sr_cq_head;	// Next completion to reap (user)
+	volatile uint32_t sr_cq_tail;	// Next free completion slot (kernel)
+	struct SysringSqe sr_sq[SYSRING_SIZE];
+	struct SysringCqe sr_cq[SYSRING_SIZE];
+};
+
+#endif /* !__ASSEMBLER__ */
+
 #endif /* !JOS_INC_SYSCALL_H */
@@ -185,6 +185,24 @@ rcr4(void)
 	return cr4;
 }
 
+static inline void
+clts(void)
+{
+	asm volatile("clts");
+}
+
+static inline void
+fxsave(void *area)
+{
+	asm volatile("fxsave %0" : "=m" (*(uint8_t (*)[512]) area));
+}
+
+static inline void
+fxrstor(const void *area)
+{
+	asm volatile("fxrstor %0" : : "m" (*(const uint8_t (*)[512]) area));
+}
+
 static inline void
 tlbflush(void)
 {
@@ -240,6 +258,28 @@ cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *e
 		*edxp = edx;
 }
 
+static inline uint64_t
+rdmsr(uint32_t msr)
+{
+	uint64_t val;
+	asm volatile("rdmsr" : "=A" (val) : "c" (msr));
+	return val;
+}
+
+static inline void
+wrmsr(uint32_t msr, uint64_t val)
+{
+	asm volatile("wrmsr" : : "c" (msr), "A" (val));
+}
+
+static inline uint64_t
+rdpmc(uint32_t counter)
+{
+	uint64_t val;
+	asm volatile("rdpmc" : "=A" (val) : "c" (counter));
+	return val;
+}
+
 static inline uint64_t
 read_tsc(void)
 {
@@ -33,8 +33,13 @@ delay(void)
 #define COM_DLM		1	// Out: Divisor Latch High (DLAB=1)
 #define COM_IER		1	// Out: Interrupt Enable Register
 #define   COM_IER_RDI	0x01	//   Enable receiver data interrupt
+#define   COM_IER_TXI	0x02	//   Enable transmitter empty interrupt
 #define COM_IIR		2	// In:	Interrupt ID Register
+#define   COM_IIR_FIFO	0xC0	//   FIFOs enabled
 #define COM_FCR		2	// Out: FIFO Control Register
+#define   COM_FCR_ENABLE 0x01	//   Enable FIFOs
+#define   COM_FCR_CLRRX	0x02	//   Clear receive FIFO
+#define   COM_FCR_CLRTX	0x04	//   Clear transmit FIFO
 #define COM_LCR		3	// Out: Line Control Register
 #define	  COM_LCR_DLAB	0x80	//   Divisor latch access bit
 #define	  COM_LCR_WLEN8	0x03	//   Wordlength: 8 bits
@@ -47,7 +52,22 @@ delay(void)
 #define   COM_LSR_TXRDY	0x20	//   Transmit buffer avail
 #define   COM_LSR_TSRE	0x40	//   Transmitter off
 
+#define COM_FIFO_SIZE	16	// 16550A transmit FIFO depth
+
 static bool serial_exists;
+static int serial_fifo_size = 1;
+
+// Characters waiting to be transmitted.  serial_putc only queues them;
+// the transmitter-empty interrupt (or serial_intr, when polled) moves
+// them into the UART's FIFO, so cprintf doesn't wait for the line.
+#define SERIAL_TXBUFSIZE 4096
+
+static struct {
+	uint8_t buf[SERIAL_TXBUFSIZE];
+	uint32_t rpos;
+	uint32_t wpos;
+	bool txi;			// COM_IER_TXI is enabled
+} serial_tx;
 
 static int
 serial_proc_data(void)
@@ -57,31 +77,86 @@ serial_proc_data(void)
 	return inb(COM1+COM_RX);
 }
 
+// Refill the transmit FIFO from serial_tx if the UART has drained it,
+// and ask for an interrupt when it drains again if more is queued.
+static void
+serial_tx_start(void)
+{
+	bool more;
+	int n;
+
+	if (!(inb(COM1 + COM_LSR) & COM_LSR_TXRDY))
+		return;
+	for (n = 0; n < serial_fifo_size && serial_tx.rpos != serial_tx.wpos; n++)
+		outb(COM1 + COM_TX,
+		     serial_tx.buf[serial_tx.rpos++ % SERIAL_TXBUFSIZE]);
+
+	more = (serial_tx.rpos != serial_tx.wpos);
+	if (more != serial_tx.txi) {
+		serial_tx.txi = more;
+		outb(COM1 + COM_IER, COM_IER_RDI | (more ? COM_IER_TXI : 0));
+	}
+}
+
 void
 serial_intr(void)
 {
-	if (serial_exists)
+	if (serial_exists) {
 		cons_intr(serial_proc_data);
+		serial_tx_start();
+	}
 }
 
+// Queue c for transmission without starting the transmitter.
 static void
-serial_putc(int c)
+serial_queue(int c)
 {
 	int i;
 
+	// The kernel runs with interrupts off, so when the buffer is full
+	// drain it by polling, giving up after a while like the old
+	// unbuffered loop did.
 	for (i = 0;
-	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
-	     i++)
+	     serial_tx.wpos - serial_tx.rpos >= SERIAL_TXBUFSIZE && i < 12800;
+	     i++) {
+		serial_tx_start();
 		delay();
+	}
+	if (serial_tx.wpos - serial_tx.rpos >= SERIAL_TXBUFSIZE)
+		return;
+
+	serial_tx.buf[serial_tx.wpos++ % SERIAL_TXBUFSIZE] = c;
+}
+
+static void
+serial_putc(int c)
+{
+	if (!serial_exists)
+		return;
+
+	serial_queue(c);
+	// If the transmitter is busy, the interrupt will pick this up.
+	if (!serial_tx.txi)
+		serial_tx_start();
+}
+
+static void
+serial_write(const char *s, size_t len)
+{
+	if (!serial_exists)
+		return;
 
-	outb(COM1 + COM_TX, c);
+	while (len-- > 0)
+		serial_queue(*s++);
+	if (!serial_tx.txi)
+		serial_tx_start();
 }
 
 static void
 serial_init(void)
 {
-	// Turn off the FIFO
-	outb(COM1+COM_FCR, 0);
+	// Turn on and clear the FIFOs
+	outb(COM1+COM_FCR, COM_FCR_ENABLE | COM_FCR_CLRRX | COM_FCR_CLRTX);
 
 	// Set speed; requires DLAB latch
 	outb(COM1+COM_LCR, COM_LCR_DLAB);
@@ -91,17 +166,22 @@ serial_init(void)
 	// 8 data bits, 1 stop bit, parity off; turn off DLAB latch
 	outb(COM1+COM_LCR, COM_LCR_WLEN8 & ~COM_LCR_DLAB);
 
-	// No modem controls
-	outb(COM1+COM_MCR, 0);
-	// Enable rcv interrupts
+	// No modem controls, but OUT2 gates the UART's interrupt line
+	outb(COM1+COM_MCR, COM_MCR_OUT2);
+	// Enable rcv interrupts; transmit interrupts are enabled only
+	// while serial_tx has data
 	outb(COM1+COM_IER, COM_IER_RDI);
 
 	// Clear any preexisting overrun indications and interrupts
 	// Serial port doesn't exist if COM_LSR returns 0xFF
 	serial_exists = (inb(COM1+COM_LSR) != 0xFF);
-	(void) inb(COM1+COM_IIR);
+	if ((inb(COM1+COM_IIR) & COM_IIR_FIFO) == COM_IIR_FIFO)
+		serial_fifo_size = COM_FIFO_SIZE;
 	(void) inb(COM1+COM_RX);
 
+	if (serial_exists)
+		irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_SERIAL));
+
 }
 
 
@@ -161,8 +241,9 @@ cga_init(void)
 
 
 
+// Put c in the CGA buffer without moving the cursor.
 static void
-cga_putc(int c)
+cga_putc_nocursor(int c)
 {
 	// if no attribute given, then use black on white
 	if (!(c & ~0xFF))
@@ -202,7 +283,11 @@ cga_putc(int c)
 			crt_buf[i] = 0x0700 | ' ';
 		crt_pos -= CRT_COLS;
 	}
+}
 
+static void
+cga_setcursor(void)
+{
 	/* move that little blinky thing */
 	outb(addr_6845, 14);
 	outb(addr_6845 + 1, crt_pos >> 8);
@@ -210,6 +295,21 @@ cga_putc(int c)
 	outb(addr_6845 + 1, crt_pos);
 }
 
+static void
+cga_putc(int c)
+{
+	cga_putc_nocursor(c);
+	cga_setcursor();
+}
+
+static void
+cga_write(const char *s, size_t len)
+{
+	while (len-- > 0)
+		cga_putc_nocursor(*s++ & 0xff);
+	cga_setcursor();
+}
+
 
 /***** Keyboard input code *****/
 
@@ -417,9 +517,9 @@ cons_getc(void)
 {
 	int c;
 
-	// poll for any pending input characters,
-	// so that this function works even when interrupts are disabled
-	// (e.g., when called from the kernel monitor).
+	// poll for any pending input characters (and push out pending
+	// output), so that this function works even when interrupts are
+	// disabled (e.g., when called from the kernel monitor).
 	serial_intr();
 	kbd_intr();
 
@@ -442,6 +542,33 @@ cons_putc(int c)
   cga_putc(c);
 }
 
+// Output len bytes of s to the console.  Same output as cons_putc on
+// each byte, but the serial transmitter is started and the CGA cursor
+// is moved once per call instead of once per character.
+void
+cons_write(const char *s, size_t len)
+{
+	size_t i, n;
+
+	while (len > 0) {
+		// cga_putc expands tabs by calling back into cons_putc,
+		// so write up to the next tab in bulk and the tab alone.
+		for (n = 0; n < len && s[n] != '\t'; n++)
+			/* do nothing */;
+		if (n == 0) {
+			cons_putc(*s++);
+			len--;
+			continue;
+		}
+		serial_write(s, n);
+		for (i = 0; i < n; i++)
+			lpt_putc(s[i]);
+		cga_write(s, n);
+		s += n;
+		len -= n;
+	}
+}
+
 // initialize the console devices
 void
 cons_init(void)
@@ -17,13 +17,22 @@ enum {
 	CPU_HALTED,
 };
 
-// Per-CPU state
+// Per-CPU state.  Each CPU's entry starts on its own cache line, with
+// the fields touched on every trap first, so updates through thiscpu
+// never invalidate another CPU's copy.
 struct CpuInfo {
+	struct CpuInfo *cpu_self;       // This entry; %gs:0 (see thiscpu)
+	struct Env *cpu_env;            // The currently-running environment.
+	struct Trapframe *cpu_tf;       // cpu_env's trap frame on our kernel
+	                                // stack, if not yet saved in env_tf
+	struct Env *cpu_fpu_env;        // Env whose state is in our FPU;
+	                                // CR0.TS is clear iff non-NULL
+	uint32_t cpu_ticks;             // Timer interrupts taken
+	uint8_t cpu_kmap_depth;         // kmap() slots in use (see pmap.c)
 	uint8_t cpu_id;                 // Local APIC ID; index into cpus[] below
 	volatile unsigned cpu_status;   // The status of the CPU
-	struct Env *cpu_env;            // The currently-running environment.
 	struct Taskstate cpu_ts;        // Used by x86 to find stack for interrupt
-};
+} __attribute__((aligned(CACHELINE)));
 
 // Initialized in mpconfig.c
 extern struct CpuInfo cpus[NCPU];
@@ -34,12 +43,30 @@ extern physaddr_t lapicaddr;        // Physical MMIO address of the local APIC
 // Per-CPU kernel stacks
 extern unsigned char percpu_kstacks[NCPU][KSTKSIZE];
 
-int cpunum(void);
-#define thiscpu (&cpus[cpunum()])
+// Each CPU's %gs selects a segment that starts at its entry in cpus[]
+// (see env_init_gs), so finding it is one cached load instead of an
+// uncached read of the local APIC's ID register.
+static inline struct CpuInfo *
+percpu_self(void)
+{
+	struct CpuInfo *c;
+
+	asm volatile("movl %%gs:0, %0" : "=r" (c));
+	return c;
+}
+
+#define thiscpu (percpu_self())
+
+static inline int
+cpunum(void)
+{
+	return thiscpu - cpus;
+}
 
 void mp_init(void);
 void lapic_init(void);
-void lapic_startap(uint8_t apicid, uint32_t addr);
+int lapic_id(void);
+void lapic_startaps(const uint8_t *apicids, int n, uint32_t addr);
 void lapic_eoi(void);
 void lapic_ipi(int vector);
 
@@ -12,6 +12,10 @@ pte_t entry_pgtable[NPTENTRIES];
 // region is critical for a few instructions in entry.S and then we
 // never use it again.
 //
+// Above that, [KERNBASE+4MB, KERNBASE+32MB) is mapped with 4MB pages
+// (entry.S turns on CR4_PSE), so boot_alloc has room for pages[] on
+// machines with lots of memory.
+//
 // Page directories (and page tables), must start on a page boundary,
 // hence the "__aligned__" attribute.  Also, because of restrictions
 // related to linking and static initializers, we use "x + PTE_P"
@@ -24,7 +28,15 @@ pde_t entry_pgdir[NPDENTRIES] = {
 		= ((uintptr_t)entry_pgtable - KERNBASE) + PTE_P,
 	// Map VA's [KERNBASE, KERNBASE+4MB) to PA's [0, 4MB)
 	[KERNBASE>>PDXSHIFT]
-		= ((uintptr_t)entry_pgtable - KERNBASE) + PTE_P + PTE_W
+		= ((uintptr_t)entry_pgtable - KERNBASE) + PTE_P + PTE_W,
+	// Map VA's [KERNBASE+4MB, KERNBASE+32MB) to PA's [4MB, 32MB)
+	[(KERNBASE>>PDXSHIFT) + 1] = 0x0400000 + PTE_P + PTE_W + PTE_PS,
+	[(KERNBASE>>PDXSHIFT) + 2] = 0x0800000 + PTE_P + PTE_W + PTE_PS,
+	[(KERNBASE>>PDXSHIFT) + 3] = 0x0c00000 + PTE_P + PTE_W + PTE_PS,
+	[(KERNBASE>>PDXSHIFT) + 4] = 0x1000000 + PTE_P + PTE_W + PTE_PS,
+	[(KERNBASE>>PDXSHIFT) + 5] = 0x1400000 + PTE_P + PTE_W + PTE_PS,
+	[(KERNBASE>>PDXSHIFT) + 6] = 0x1800000 + PTE_P + PTE_W + PTE_PS,
+	[(KERNBASE>>PDXSHIFT) + 7] = 0x1c00000 + PTE_P + PTE_W + PTE_PS
 };
 
 // Entry 0 of the page table maps to physical page 0, entry 1 to
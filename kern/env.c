@@ -11,15 +11,21 @@
 #include <kern/pmap.h>
 #include <kern/trap.h>
 #include <kern/monitor.h>
+#include <kern/kclock.h>
 #include <kern/sched.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
+#include <kern/ktrace.h>
+#include <kern/pmu.h>
+#include <kern/init.h>
 
 struct Env *envs = NULL;		// All environments
+size_t nenv;				// Slots of envs[] backed so far
 static struct Env *env_free_list;	// Free environment list
 					// (linked by Env->env_link)
 
-#define ENVGENSHIFT	12		// >= LOGNENV
+#define ENVGENSHIFT	16		// >= LOGNENV
+#define ENV_GROW	64		// Slots added to envs[] at a time
 
 // Global descriptor table.
 //
@@ -36,7 +42,7 @@ static struct Env *env_free_list;	// Free environment list
 // definition of gdt specifies the Descriptor Privilege Level (DPL)
 // of that descriptor: 0 for kernel and 3 for user.
 //
-struct Segdesc gdt[NCPU + 5] =
+struct Segdesc gdt[2 * NCPU + 5] =
 {
 	// 0x0 - unused (always faults -- for trapping NULL far pointers)
 	SEG_NULL,
@@ -55,7 +61,11 @@ struct Segdesc gdt[NCPU + 5] =
 
 	// Per-CPU TSS descriptors (starting from GD_TSS0) are initialized
 	// in trap_init_percpu()
-	[GD_TSS0 >> 3] = SEG_NULL
+	[GD_TSS0 >> 3] = SEG_NULL,
+
+	// Per-CPU data segments (starting from GD_CPU0) are initialized
+	// in env_init_gs()
+	[GD_CPU0 >> 3] = SEG_NULL
 };
 
 struct Pseudodesc gdt_pd = {
@@ -88,6 +98,10 @@ envid2env(envid_t envid, struct Env **env_store, bool checkperm)
 	// to ensure that the envid is not stale
 	// (i.e., does not refer to a _previous_ environment
 	// that used the same slot in the envs[] array).
+	if (ENVX(envid) >= nenv) {
+		*env_store = 0;
+		return -E_BAD_ENV;
+	}
 	e = &envs[ENVX(envid)];
 	if (e->env_status == ENV_FREE || e->env_id != envid) {
 		*env_store = 0;
@@ -108,38 +122,69 @@ envid2env(envid_t envid, struct Env **env_store, bool checkperm)
 	return 0;
 }
 
-// Mark all environments in 'envs' as free, set their env_ids to 0,
-// and insert them into the env_free_list.
+// Back up to ENV_GROW more slots at the end of 'envs' with memory,
+// mark them free, and insert them into the (empty) env_free_list.
 // Make sure the environments are in the free list in the same order
 // they are in the envs array (i.e., so that the first call to
 // env_alloc() returns envs[0]).
 //
+static int
+env_grow(void)
+{
+	size_t i, n = MIN(nenv + ENV_GROW, (size_t) NENV);
+	int r;
+
+	if (nenv == NENV)
+		return -E_NO_FREE_ENV;
+	if ((r = envs_grow(n)) < 0)
+		return r;
+	// The new pages are zeroed, so the slots are already ENV_FREE
+	// with env_id 0.
+	for (i = n; i-- > nenv; ) {
+		envs[i].env_link = env_free_list;
+		env_free_list = &envs[i];
+	}
+	nenv = n;
+	return 0;
+}
+
+// Set up the first slots of 'envs'; env_alloc grows it from there.
 void
 env_init(void)
 {
-	// Set up envs array
-	// LAB 3: Your code here.
-  env_free_list = envs;
-  for(int i = 1; i < NENV; i++){
-    envs[i-1].env_id = 0;
-    envs[i-1].env_link = &envs[i];
-  }
-  envs[NENV-1].env_id = 0;
-  envs[NENV-1].env_link = NULL;
+	int r;
+
+	if ((r = env_grow()) < 0)
+		panic("env_init: %e", r);
 
 
 	// Per-CPU part of the initialization
 	env_init_percpu();
 }
 
+// Point %gs at cpus[id], so thiscpu is a single %gs-relative load
+// (see kern/cpu.h).  The trap entry code reloads %gs with the selector
+// that goes with the CPU's TSS, since user mode can change it.
+void
+env_init_gs(int id)
+{
+	struct CpuInfo *c = &cpus[id];
+
+	static_assert(GD_CPU0 == GD_TSS0 + (NCPU << 3));
+	c->cpu_self = c;
+	gdt[(GD_CPU0 >> 3) + id] = SEG16(STA_W, (uint32_t) c,
+					 sizeof(struct CpuInfo) - 1, 0);
+	lgdt(&gdt_pd);
+	asm volatile("movw %%ax,%%gs" : : "a" (GD_CPU0 + (id << 3)));
+}
+
 // Load GDT and segment descriptors.
 void
 env_init_percpu(void)
 {
 	lgdt(&gdt_pd);
-	// The kernel never uses GS or FS, so we leave those set to
-	// the user data segment.
-	asm volatile("movw %%ax,%%gs" : : "a" (GD_UD|3));
+	// The kernel uses GS for per-CPU data (see env_init_gs), and
+	// never uses FS, so we leave that set to the user data segment.
 	asm volatile("movw %%ax,%%fs" : : "a" (GD_UD|3));
 	// The kernel does use ES, DS, and SS.  We'll change between
 	// the kernel and user data segments as needed.
@@ -151,6 +196,9 @@ env_init_percpu(void)
 	// For good measure, clear the local descriptor table (LDT),
 	// since we don't use it.
 	lldt(0);
+
+	env_fpu_init_percpu();
+	pmu_init_percpu();
 }
 
 //
@@ -167,7 +215,7 @@ static int
 env_setup_vm(struct Env *e)
 {
 	int i;
-	struct PageInfo *p = NULL;
+	struct PageInfo *p = NULL, *ip;
 
 	// Allocate a page for the page directory
 	if (!(p = page_alloc(ALLOC_ZERO)))
@@ -193,6 +241,7 @@ env_setup_vm(struct Env *e)
   e->env_pgdir = page2kva(p);
   memset(e->env_pgdir, 0, PGSIZE);
   p->pp_ref++;
+  pgdir_set_owner(e->env_pgdir, e);
 
   
   // copy kern_pgdir mappings (ty yeongjin)
@@ -205,6 +254,22 @@ env_setup_vm(struct Env *e)
 	// Permissions: kernel R, user R
 	e->env_pgdir[PDX(UVPT)] = PADDR(e->env_pgdir) | PTE_P | PTE_U;
 
+	// UINFO maps the env's own struct Uinfo read-only.  The kernel
+	// holds its own reference for env_uinfo until env_free, and the
+	// page system calls refuse to touch UINFO.
+	// Permissions: kernel RW (through env_uinfo), user R
+	if (!(ip = page_alloc(ALLOC_ZERO))
+	    || page_insert(e->env_pgdir, ip, (void *) UINFO, PTE_P | PTE_U) < 0) {
+		if (ip)
+			page_free(ip);
+		pgdir_set_owner(e->env_pgdir, NULL);
+		page_decref(p);
+		return -E_NO_MEM;
+	}
+	ip->pp_ref++;
+	e->env_uinfo = page2kva(ip);
+	e->env_uinfo->ui_tsc_khz = tsc_khz;
+
 	return 0;
 }
 
@@ -223,8 +288,14 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 	int r;
 	struct Env *e;
 
-	if (!(e = env_free_list))
-		return -E_NO_FREE_ENV;
+	if (!env_free_list && (r = env_grow()) < 0)
+		return r;
+	e = env_free_list;
+
+	// Nothing is mapped below UTOP yet; inherit no quota by default.
+	e->env_npages = 0;
+	e->env_nptabs = 0;
+	e->env_page_quota = 0;
 
 	// Allocate and set up the page directory for this environment.
 	if ((r = env_setup_vm(e)) < 0)
@@ -235,12 +306,14 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 	if (generation <= 0)	// Don't create a negative env_id.
 		generation = 1 << ENVGENSHIFT;
 	e->env_id = generation | (e - envs);
+	e->env_uinfo->ui_envid = e->env_id;
 
 	// Set the basic status variables.
 	e->env_parent_id = parent_id;
 	e->env_type = ENV_TYPE_USER;
 	e->env_status = ENV_RUNNABLE;
 	e->env_runs = 0;
+	e->env_ring = NULL;
 
 	// Clear out all the saved register state,
 	// to prevent the register values
@@ -270,6 +343,11 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 
 	// Clear the page fault handler until user installs one.
 	e->env_pgfault_upcall = 0;
+	e->env_kern_cow = 0;
+	e->env_trace = 0;
+	e->env_fpu_used = 0;
+	memset(e->env_pmc, 0, sizeof(e->env_pmc));
+	e->env_rdpmc = 0;
 
 	// Also clear the IPC receiving flag.
 	e->env_ipc_recving = 0;
@@ -279,6 +357,7 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 	*newenv_store = e;
 
 	cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
+	ktrace(KT_ENV_ALLOC, e->env_id, parent_id, 0);
 	return 0;
 }
 
@@ -309,7 +388,7 @@ region_alloc(struct Env *e, void *va, size_t len)
       continue;
 
     // if not exists...
-    struct PageInfo* pp = page_alloc(0);
+    struct PageInfo* pp = page_alloc(ALLOC_HIGH);
     if(pp == NULL)
       panic("Failed to allocate in region_alloc");
 
@@ -406,7 +485,7 @@ load_icode(struct Env *e, uint8_t *binary)
 	// at virtual address USTACKTOP - PGSIZE.
 
 	// LAB 3: Your code here.
-  struct PageInfo* pp = page_alloc(ALLOC_ZERO);
+  struct PageInfo* pp = page_alloc(ALLOC_ZERO | ALLOC_HIGH);
   if(pp == NULL)
     panic("No memory to alloc stack in load_icode");
 
@@ -450,8 +529,6 @@ env_create(uint8_t *binary, enum EnvType type)
 void
 env_free(struct Env *e)
 {
-	pte_t *pt;
-	uint32_t pdeno, pteno;
 	physaddr_t pa;
 
 	// If freeing the current environment, switch to kern_pgdir
@@ -460,33 +537,35 @@ env_free(struct Env *e)
 	if (e == curenv)
 		lcr3(PADDR(kern_pgdir));
 
+	// Its FPU state, if loaded, is no longer needed.
+	if (thiscpu->cpu_fpu_env == e) {
+		thiscpu->cpu_fpu_env = NULL;
+		lcr0(rcr0() | CR0_TS);
+	}
+	pmu_release(e);
+
 	// Note the environment's demise.
 	cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
-
-	// Flush all mapped pages in the user portion of the address space
-	static_assert(UTOP % PTSIZE == 0);
-	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
-
-		// only look at mapped page tables
-		if (!(e->env_pgdir[pdeno] & PTE_P))
-			continue;
-
-		// find the pa and va of the page table
-		pa = PTE_ADDR(e->env_pgdir[pdeno]);
-		pt = (pte_t*) KADDR(pa);
-
-		// unmap all PTEs in this page table
-		for (pteno = 0; pteno <= PTX(~0); pteno++) {
-			if (pt[pteno] & PTE_P)
-				page_remove(e->env_pgdir, PGADDR(pdeno, pteno, 0));
-		}
-
-		// free the page table itself
-		e->env_pgdir[pdeno] = 0;
-		page_decref(pa2page(pa));
+	ktrace(KT_ENV_FREE, e->env_id, 0, 0);
+
+	// Flush all mapped pages in the user portion of the address space.
+	// e is not running on any CPU (env_destroy defers freeing a
+	// running env to that env's CPU, and we switched off its pgdir
+	// above), so no TLB shootdown is needed.
+	pgdir_teardown(e->env_pgdir);
+
+	// Drop the kernel's reference to the info page
+	page_decref(pa2page(PADDR(e->env_uinfo)));
+	e->env_uinfo = NULL;
+
+	// Drop the kernel's reference to the system call ring
+	if (e->env_ring) {
+		page_decref(pa2page(PADDR(e->env_ring)));
+		e->env_ring = NULL;
 	}
 
 	// free the page directory
+	pgdir_set_owner(e->env_pgdir, NULL);
 	pa = PADDR(e->env_pgdir);
 	e->env_pgdir = 0;
 	page_decref(pa2page(pa));
@@ -533,6 +612,9 @@ env_pop_tf(struct Trapframe *tf)
 {
 	// Record the CPU we are running on for user-space debugging
 	curenv->env_cpunum = cpunum();
+	curenv->env_uinfo->ui_cpunum = curenv->env_cpunum;
+	curenv->env_uinfo->ui_runs = curenv->env_runs;
+	curenv->env_uinfo->ui_ticks = cpus[curenv->env_cpunum].cpu_ticks;
 
 	asm volatile(
 		"\tmovl %0,%%esp\n"
@@ -545,6 +627,109 @@ env_pop_tf(struct Trapframe *tf)
 	panic("iret failed");  /* mostly to placate the compiler */
 }
 
+//
+// trap() leaves curenv's trap-time state in the frame on this CPU's
+// kernel stack (thiscpu->cpu_tf) and env_run() returns from there, so a
+// trap that resumes the same environment never copies the Trapframe.
+// The frame is written back to curenv->env_tf only when the environment
+// is descheduled.
+//
+
+// Return curenv's current trap-time state, wherever it lives.
+struct Trapframe *
+env_cur_tf(void)
+{
+	struct CpuInfo *c = thiscpu;
+
+	return c->cpu_tf ? c->cpu_tf : &c->cpu_env->env_tf;
+}
+
+// Save curenv's trap frame into curenv->env_tf if it is still on the
+// kernel stack, its FPU registers into curenv->env_fpu if it used
+// the FPU since it was switched to, and its performance counts.
+// Must be called before this CPU stops running curenv.
+void
+env_save_state(void)
+{
+	struct CpuInfo *c = thiscpu;
+
+	if (c->cpu_tf) {
+		if (c->cpu_env)
+			c->cpu_env->env_tf = *c->cpu_tf;
+		c->cpu_tf = NULL;
+	}
+	if (c->cpu_fpu_env) {
+		fxsave(&c->cpu_fpu_env->env_fpu);
+		c->cpu_fpu_env = NULL;
+		lcr0(rcr0() | CR0_TS);
+	}
+	pmu_save(c->cpu_env);
+}
+
+//
+// Lazy FPU switching.
+//
+// CR0.TS stays set while the running environment's FPU state isn't
+// loaded, so its first x87/SSE instruction raises #NM (T_DEVICE) and
+// env_fpu_trap loads the state then.  Environments that never touch
+// the FPU never pay for FXSAVE/FXRSTOR.  State is saved eagerly when
+// an environment that used the FPU is descheduled (env_save_state), so
+// it is always in env_fpu by the time another CPU could run it.
+//
+
+// FPU state for an environment's first use: FNINIT plus default MXCSR.
+static struct Fxsave fpu_init_state;
+static bool fpu_enabled;
+
+void
+env_fpu_init_percpu(void)
+{
+	uint32_t edx, mxcsr = 0x1f80;
+
+	cpuid(1, NULL, NULL, NULL, &edx);
+	if (!(edx & CPUID_FXSR))
+		return;
+	lcr4(rcr4() | CR4_OSFXSR | CR4_OSXMMEXCPT);
+	lcr0((rcr0() & ~(CR0_EM | CR0_TS)) | CR0_MP | CR0_NE);
+	asm volatile("fninit; ldmxcsr %0" : : "m" (mxcsr));
+	// The boot CPU captures the initial state; APs start concurrently
+	// and must not rewrite it.
+	if (!fpu_enabled)
+		fxsave(&fpu_init_state);
+	lcr0(rcr0() | CR0_TS);
+	fpu_enabled = 1;
+}
+
+// Handle #NM from user mode: give curenv the FPU.
+// Returns 0 if handled, < 0 if this CPU has no FXSAVE support.
+int
+env_fpu_trap(void)
+{
+	struct CpuInfo *c = thiscpu;
+
+	if (!fpu_enabled)
+		return -E_INVAL;
+	clts();
+	if (c->cpu_fpu_env != curenv) {
+		fxrstor(curenv->env_fpu_used ? &curenv->env_fpu : &fpu_init_state);
+		curenv->env_fpu_used = 1;
+		c->cpu_fpu_env = curenv;
+	}
+	return 0;
+}
+
+// Copy curenv's FPU state into 'e', as sys_exofork does for the
+// rest of the registers.
+void
+env_fpu_copy(struct Env *e)
+{
+	if (thiscpu->cpu_fpu_env == curenv)
+		fxsave(&curenv->env_fpu);
+	e->env_fpu_used = curenv->env_fpu_used;
+	if (e->env_fpu_used)
+		e->env_fpu = curenv->env_fpu;
+}
+
 //
 // Context switch from curenv to env e.
 // Note: if this is the first call to env_run, curenv is NULL.
@@ -572,7 +757,24 @@ env_run(struct Env *e)
 	//	e->env_tf to sensible values.
 
 	// LAB 3: Your code here.
+  struct CpuInfo *c = thiscpu;
+  struct Trapframe *tf;
+
+  ktrace(KT_ENV_RUN, e->env_id, e->env_runs + 1, 0);
+  if (!boot_tsc[BOOT_FIRST_RUN])
+    boot_phase(BOOT_FIRST_RUN);
+
+  // resuming the env that trapped: return straight from its frame
+  if(e == c->cpu_env && c->cpu_tf != NULL){
+    tf = c->cpu_tf;
+    c->cpu_tf = NULL;
+    e->env_runs++;
+    unlock_kernel();
+    env_pop_tf(tf);
+  }
+
   // step 1.1: 
+  env_save_state();
   if(curenv != NULL && curenv->env_status == ENV_RUNNING)// use short circuit &&
     curenv->env_status = ENV_RUNNABLE;
 
@@ -581,6 +783,7 @@ env_run(struct Env *e)
   e->env_status = ENV_RUNNING;
   e->env_runs++;
   lcr3(PADDR(e->env_pgdir));
+  pmu_restore(e);
   
   
   // step 2:
@@ -7,11 +7,13 @@
 #include <kern/cpu.h>
 
 extern struct Env *envs;		// All environments
+extern size_t nenv;			// Slots of envs[] backed so far
 #define curenv (thiscpu->cpu_env)		// Current environment
 extern struct Segdesc gdt[];
 
 void	env_init(void);
 void	env_init_percpu(void);
+void	env_init_gs(int id);
 int	env_alloc(struct Env **e, envid_t parent_id);
 void	env_free(struct Env *e);
 void	env_create(uint8_t *binary, enum EnvType type);
@@ -22,6 +24,13 @@ int	envid2env(envid_t envid, struct Env **env_store, bool checkperm);
 void	env_run(struct Env *e) __attribute__((noreturn));
 void	env_pop_tf(struct Trapframe *tf) __attribute__((noreturn));
 
+struct Trapframe *env_cur_tf(void);
+void	env_save_state(void);
+
+void	env_fpu_init_percpu(void);
+int	env_fpu_trap(void);
+void	env_fpu_copy(struct Env *e);
+
 // Without this extra macro, we couldn't pass macros like TEST to
 // ENV_CREATE because of the C pre-processor's argument prescan rule.
 #define ENV_PASTE3(x, y, z) x ## y ## z
@@ -14,32 +14,92 @@
 #include <kern/picirq.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
+#include <kern/kdebug.h>
+#include <kern/init.h>
 
 static void boot_aps(void);
 
 
+uint64_t boot_tsc[NBOOT_PHASES];
+
+static const char * const boot_phase_names[NBOOT_PHASES] = {
+	[BOOT_LOADER]		= "firmware+loader",
+	[BOOT_CONS]		= "cons_init",
+	[BOOT_SYMS]		= "debuginfo_init",
+	[BOOT_MEM]		= "mem_init",
+	[BOOT_TSC]		= "tsc_calibrate",
+	[BOOT_ENV]		= "env_init",
+	[BOOT_MP]		= "mp_init",
+	[BOOT_APS]		= "boot_aps",
+	[BOOT_FIRST_RUN]	= "first env_run",
+};
+
+// Record the end of boot phase 'phase'.  After the last one, print how
+// long each phase took.
+void
+boot_phase(int phase)
+{
+	uint64_t dt;
+	int i;
+
+	if (boot_tsc[phase])
+		return;
+	boot_tsc[phase] = read_tsc();
+	if (phase != BOOT_FIRST_RUN)
+		return;
+
+	for (i = 0; i < NBOOT_PHASES; i++) {
+		dt = boot_tsc[i] - (i ? boot_tsc[i - 1] : 0);
+		if (tsc_khz)
+			cprintf("boot: %-16s %8llu us\n", boot_phase_names[i],
+				dt * 1000 / tsc_khz);
+		else
+			cprintf("boot: %-16s %8llu cycles\n",
+				boot_phase_names[i], dt);
+	}
+}
+
 void
 i386_init(void)
 {
+	// The TSC has counted since reset.
+	boot_phase(BOOT_LOADER);
+
+	// Until lapic_init, the boot CPU goes by cpus[0].
+	env_init_gs(0);
+
 	// Initialize the console.
 	// Can't call cprintf until after we do this!
 	cons_init();
+	boot_phase(BOOT_CONS);
 
 	cprintf("444544 decimal is %o octal!\n", 444544);
 
+	// Index the kernel's symbols for debuginfo_eip.
+	debuginfo_init();
+	boot_phase(BOOT_SYMS);
+
 	// Lab 2 memory management initialization functions
 	mem_init();
+	boot_phase(BOOT_MEM);
+
+	// Measure the TSC for the user info page.
+	tsc_calibrate();
+	boot_phase(BOOT_TSC);
 
 	// Lab 3 user environment initialization functions
 	env_init();
 	trap_init();
+	boot_phase(BOOT_ENV);
 
 	// Lab 4 multiprocessor initialization functions
 	mp_init();
 	lapic_init();
+	env_init_gs(lapic_id());
 
 	// Lab 4 multitasking initialization functions
 	pic_init();
+	boot_phase(BOOT_MP);
 
 	// Acquire the big kernel lock before waking up APs
 	// Your code here:
@@ -47,6 +107,7 @@ i386_init(void)
 
 	// Starting non-boot CPUs
 	boot_aps();
+	boot_phase(BOOT_APS);
 
 #if defined(TEST)
 	// Don't touch -- used by grading script!
@@ -61,36 +122,47 @@ i386_init(void)
 	sched_yield();
 }
 
-// While boot_aps is booting a given CPU, it communicates the per-core
-// stack pointer that should be loaded by mpentry.S to that CPU in
-// this variable.
-void *mpentry_kstack;
+// boot_aps communicates the per-core stack pointer that mpentry.S
+// should load to each AP in this table, indexed by local APIC ID, so
+// that all APs can be started at once.
+void *mpentry_kstacks[256];
+
+// Serializes the APs' console output while they start up.
+static struct spinlock mp_print_lock;
 
 // Start the non-boot (AP) processors.
 static void
 boot_aps(void)
 {
 	extern unsigned char mpentry_start[], mpentry_end[];
+	uint8_t apicids[NCPU];
 	void *code;
 	struct CpuInfo *c;
+	int n = 0;
 
 	// Write entry code to unused memory at MPENTRY_PADDR
 	code = KADDR(MPENTRY_PADDR);
 	memmove(code, mpentry_start, mpentry_end - mpentry_start);
 
-	// Boot each AP one at a time
+	// Tell mpentry.S what stack each AP should use
 	for (c = cpus; c < cpus + ncpu; c++) {
 		if (c == cpus + cpunum())  // We've started already.
 			continue;
+		mpentry_kstacks[c->cpu_id] = percpu_kstacks[c - cpus] + KSTKSIZE;
+		apicids[n++] = c->cpu_id;
+	}
+
+	// Start them all at mpentry_start
+	spin_initlock(&mp_print_lock);
+	if (n > 0)
+		lapic_startaps(apicids, n, PADDR(code));
+	mem_check_percpu();
 
-		// Tell mpentry.S what stack to use 
-		mpentry_kstack = percpu_kstacks[c - cpus] + KSTKSIZE;
-		// Start the CPU at mpentry_start
-		lapic_startap(c->cpu_id, PADDR(code));
-		// Wait for the CPU to finish some basic setup in mp_main()
-		while(c->cpu_status != CPU_STARTED)
+	// Wait for each CPU to finish some basic setup in mp_main()
+	for (c = cpus; c < cpus + ncpu; c++)
+		while(c != cpus + cpunum() && c->cpu_status != CPU_STARTED)
 			;
-	}
+	mem_check_wait();
 }
 
 // Setup code for APs
@@ -99,11 +171,15 @@ mp_main(void)
 {
 	// We are in high EIP now, safe to switch to kern_pgdir 
 	lcr3(PADDR(kern_pgdir));
+	env_init_gs(lapic_id());
+	spin_lock(&mp_print_lock);
 	cprintf("SMP: CPU %d starting\n", cpunum());
+	spin_unlock(&mp_print_lock);
 
 	lapic_init();
 	env_init_percpu();
 	trap_init_percpu();
+	mem_check_percpu();
 	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
 
 	// Now that we have finished some basic setup, call sched_yield()
@@ -0,0 +1,29 @@
+#ifndef JOS_KERN_INIT_H
+#define JOS_KERN_INIT_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+// Boot phases, in order.  boot_phase() records the TSC when each one
+// finishes; once the first environment runs, the time each took is
+// printed.
+enum {
+	BOOT_LOADER = 0,		// Firmware and boot loader, from reset
+	BOOT_CONS,			// cons_init
+	BOOT_SYMS,			// debuginfo_init
+	BOOT_MEM,			// mem_init
+	BOOT_TSC,			// tsc_calibrate
+	BOOT_ENV,			// env_init, trap_init
+	BOOT_MP,			// mp_init, lapic_init, pic_init
+	BOOT_APS,			// boot_aps
+	BOOT_FIRST_RUN,			// Up to the first env_run
+	NBOOT_PHASES
+};
+
+extern uint64_t boot_tsc[NBOOT_PHASES];
+
+void boot_phase(int phase);
+
+#endif	// !JOS_KERN_INIT_H
@@ -3,6 +3,7 @@
 /* Support for reading the NVRAM from the real-time clock. */
 
 #include <inc/x86.h>
+#include <inc/stdio.h>
 
 #include <kern/kclock.h>
 
@@ -20,3 +21,36 @@ mc146818_write(unsigned reg, unsigned datum)
 	outb(IO_RTC, reg);
 	outb(IO_RTC+1, datum);
 }
+
+// TSC frequency in kHz, or 0 if it couldn't be measured.
+uint32_t tsc_khz;
+
+// Measure the TSC against a 10ms one-shot countdown on PIT channel 2,
+// whose output can be polled through port 0x61 without any interrupt.
+void
+tsc_calibrate(void)
+{
+	const uint32_t ms = 10, latch = PIT_HZ * ms / 1000;
+	uint64_t t0, t1;
+	uint32_t spins = 0;
+
+	// Gate channel 2 on, speaker off; mode 0, lobyte/hibyte.
+	outb(IO_PIT_GATE, (inb(IO_PIT_GATE) & ~0x02) | 0x01);
+	outb(IO_PIT_MODE, 0xb0);
+	outb(IO_PIT_CH2, latch & 0xff);
+	outb(IO_PIT_CH2, latch >> 8);
+
+	// A port read takes around a microsecond, so the countdown should
+	// finish within some 10000 polls; if it hasn't after a few million,
+	// there is no PIT output, and tsc_khz stays 0.
+	t0 = read_tsc();
+	while (!(inb(IO_PIT_GATE) & 0x20))
+		if (++spins == 4000000) {
+			cprintf("TSC: no PIT output, not calibrated\n");
+			return;
+		}
+	t1 = read_tsc();
+
+	tsc_khz = (uint32_t) ((t1 - t0) / ms);
+	cprintf("TSC: %u kHz\n", tsc_khz);
+}
@@ -6,6 +6,8 @@
 # error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+#include <inc/types.h>
+
 #define	IO_RTC		0x070		/* RTC port */
 
 #define	MC_NVRAM_START	0xe	/* start of NVRAM: offset 14 */
@@ -26,4 +28,13 @@
 unsigned mc146818_read(unsigned reg);
 void mc146818_write(unsigned reg, unsigned datum);
 
+/* 8253/8254 programmable interval timer, channel 2 */
+#define	IO_PIT_CH2	0x042		/* channel 2 counter */
+#define	IO_PIT_MODE	0x043		/* mode/command register */
+#define	IO_PIT_GATE	0x061		/* NMI status/control: ch2 gate & output */
+#define	PIT_HZ		1193182		/* PIT input clock */
+
+extern uint32_t tsc_khz;
+void tsc_calibrate(void);
+
 #endif	// !JOS_KERN_KCLOCK_H
@@ -103,6 +103,182 @@ stab_binsearch(const struct Stab *stabs, int *region_left, int *region_right,
 }
 
 
+// Kernel symbol index.
+//
+// stab_binsearch is fine for the odd backtrace, but each lookup makes
+// three passes over the stabs and scans backwards for the right type.
+// debuginfo_init turns the kernel's stabs into address-sorted tables of
+// functions and line numbers once at boot, so that looking up a kernel
+// address (from mon_backtrace, the profiler, ...) is two binary searches.
+// If the tables overflow, lookups fall back to the stabs.
+
+#define KSYM_MAXFUNCS	4096
+#define KSYM_MAXLINES	16384
+#define KSYM_MAXFILES	4096
+
+struct KsymFunc {
+	uintptr_t addr;
+	uint32_t size;			// 0 if unknown
+	const char *name;		// Not null terminated
+	uint16_t namelen;
+	uint16_t narg;
+};
+
+struct KsymLine {
+	uintptr_t addr;
+	uint16_t line;
+	uint16_t file;			// Index into ksym_files
+};
+
+static struct KsymFunc ksym_funcs[KSYM_MAXFUNCS];
+static struct KsymLine ksym_lines[KSYM_MAXLINES];
+static const char *ksym_files[KSYM_MAXFILES];
+static int ksym_nfuncs, ksym_nlines, ksym_nfiles;
+static bool ksym_ready;
+
+// Shell sort; the stabs are mostly in address order already.
+#define KSYM_SORT(a, n, type)						\
+do {									\
+	static const int gaps[] = { 701, 301, 132, 57, 23, 10, 4, 1 };	\
+	type __t;							\
+	int __g, __i, __j;						\
+	for (__g = 0; __g < ARRAY_SIZE(gaps); __g++)			\
+		for (__i = gaps[__g]; __i < (n); __i++) {		\
+			__t = (a)[__i];					\
+			for (__j = __i; __j >= gaps[__g]		\
+			     && (a)[__j - gaps[__g]].addr > __t.addr;	\
+			     __j -= gaps[__g])				\
+				(a)[__j] = (a)[__j - gaps[__g]];	\
+			(a)[__j] = __t;					\
+		}							\
+} while (0)
+
+void
+debuginfo_init(void)
+{
+	const struct Stab *stabs = __STAB_BEGIN__;
+	int nstabs = __STAB_END__ - __STAB_BEGIN__;
+	int strsize = __STABSTR_END__ - __STABSTR_BEGIN__;
+	struct KsymFunc *fn = NULL;
+	uintptr_t base = 0;
+	const char *name;
+	bool params = 0;
+	int i, file = -1;
+
+	for (i = 0; i < nstabs; i++) {
+		if (stabs[i].n_strx >= strsize)
+			continue;
+		name = __STABSTR_BEGIN__ + stabs[i].n_strx;
+		// A function's parameters immediately follow its N_FUN.
+		if (stabs[i].n_type != N_PSYM)
+			params = (stabs[i].n_type == N_FUN && *name);
+
+		switch (stabs[i].n_type) {
+		case N_SO:
+		case N_SOL:
+			// An N_SO with an empty name ends a source file; the
+			// one with n_value == 0 names the build directory.
+			if (stabs[i].n_type == N_SO) {
+				fn = NULL;
+				base = 0;
+				if (!*name || !stabs[i].n_value)
+					break;
+			}
+			if (file >= 0 && strcmp(ksym_files[file], name) == 0)
+				break;
+			if (ksym_nfiles == KSYM_MAXFILES)
+				return;
+			file = ksym_nfiles;
+			ksym_files[ksym_nfiles++] = name;
+			break;
+
+		case N_FUN:
+			// An N_FUN with an empty name ends a function and gives
+			// its size.
+			if (!*name) {
+				if (fn)
+					fn->size = stabs[i].n_value;
+				fn = NULL;
+				base = 0;
+				break;
+			}
+			if (ksym_nfuncs == KSYM_MAXFUNCS)
+				return;
+			fn = &ksym_funcs[ksym_nfuncs++];
+			fn->addr = base = stabs[i].n_value;
+			fn->size = 0;
+			fn->name = name;
+			fn->namelen = strfind(name, ':') - name;
+			fn->narg = 0;
+			break;
+
+		case N_PSYM:
+			if (fn && params)
+				fn->narg++;
+			break;
+
+		case N_SLINE:
+			// Line numbers are relative to the enclosing function.
+			if (file < 0)
+				break;
+			if (ksym_nlines == KSYM_MAXLINES)
+				return;
+			ksym_lines[ksym_nlines].addr = base + stabs[i].n_value;
+			ksym_lines[ksym_nlines].line = stabs[i].n_desc;
+			ksym_lines[ksym_nlines].file = file;
+			ksym_nlines++;
+			break;
+		}
+	}
+
+	KSYM_SORT(ksym_funcs, ksym_nfuncs, struct KsymFunc);
+	KSYM_SORT(ksym_lines, ksym_nlines, struct KsymLine);
+	ksym_ready = 1;
+}
+
+// Index of the last element of 'a' (sorted by addr) with addr <= 'addr',
+// or -1 if there is none.
+#define KSYM_FIND(a, n, addr)						\
+({									\
+	int __l = 0, __r = (n) - 1, __m;				\
+	while (__l <= __r) {						\
+		__m = (__l + __r) / 2;					\
+		if ((a)[__m].addr <= (addr))				\
+			__l = __m + 1;					\
+		else							\
+			__r = __m - 1;					\
+	}								\
+	__r;								\
+})
+
+// debuginfo_eip for kernel addresses, using the index.
+static int
+ksym_lookup(uintptr_t addr, struct Eipdebuginfo *info)
+{
+	const struct KsymFunc *fn;
+	const struct KsymLine *ln;
+	int i;
+
+	i = KSYM_FIND(ksym_funcs, ksym_nfuncs, addr);
+	if (i >= 0) {
+		fn = &ksym_funcs[i];
+		if (!fn->size || addr < fn->addr + fn->size) {
+			info->eip_fn_name = fn->name;
+			info->eip_fn_namelen = fn->namelen;
+			info->eip_fn_addr = fn->addr;
+			info->eip_fn_narg = fn->narg;
+		}
+	}
+
+	i = KSYM_FIND(ksym_lines, ksym_nlines, addr);
+	if (i < 0)
+		return -1;
+	ln = &ksym_lines[i];
+	info->eip_line = ln->line;
+	info->eip_file = ksym_files[ln->file];
+	return 0;
+}
+
 // debuginfo_eip(addr, info)
 //
 //	Fill in the 'info' structure with information about the specified
@@ -125,6 +301,9 @@ debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
 	info->eip_fn_addr = addr;
 	info->eip_fn_narg = 0;
 
+	if (addr >= ULIM && ksym_ready)
+		return ksym_lookup(addr, info);
+
 	// Find the relevant set of stabs
 	if (addr >= ULIM) {
 		stabs = __STAB_BEGIN__;
@@ -0,0 +1,147 @@
+// Per-CPU kernel trace rings.
+//
+// Each CPU appends fixed-size binary records to its own ring, so
+// recording takes no locks and never touches the console; a CPU in the
+// kernel runs with interrupts disabled, so it is the only writer of its
+// ring.  Readers copy records out and use the sequence number stored in
+// each record to drop any that were overwritten while being read.
+
+#include <inc/x86.h>
+#include <inc/stdio.h>
+#include <inc/string.h>
+
+#include <kern/cpu.h>
+#include <kern/kclock.h>
+#include <kern/ktrace.h>
+
+#define KTRACE_SIZE	512		// Records per CPU; a power of two
+
+struct KtraceEntry {
+	uint64_t tsc;
+	uint32_t seq;			// Ring sequence number of this record
+	uint16_t event;
+	uint16_t cpu;
+	uint32_t args[3];
+	uint32_t pad;
+};
+
+struct Ktrace {
+	volatile uint32_t next;		// Total records ever written
+	struct KtraceEntry ring[KTRACE_SIZE];
+};
+
+static struct Ktrace ktraces[NCPU];
+
+uint32_t ktrace_mask = KT_ALL;
+
+static const char * const ktrace_names[KT_NEVENTS] = {
+	[KT_ENV_RUN]		= "env_run",
+	[KT_SCHED_YIELD]	= "sched_yield",
+	[KT_TRAP]		= "trap",
+	[KT_PGFAULT]		= "pgfault",
+	[KT_IPC_SEND]		= "ipc_send",
+	[KT_IPC_RECV]		= "ipc_recv",
+	[KT_ENV_ALLOC]		= "env_alloc",
+	[KT_ENV_FREE]		= "env_free",
+};
+
+void
+ktrace_record(int event, uint32_t a0, uint32_t a1, uint32_t a2)
+{
+	struct Ktrace *kt = &ktraces[cpunum()];
+	uint32_t seq = kt->next;
+	struct KtraceEntry *ke = &kt->ring[seq % KTRACE_SIZE];
+
+	// Invalidate the slot before refilling it, and publish it only
+	// once it is complete.  x86 doesn't reorder stores, so compiler
+	// barriers are enough.
+	ke->seq = ~seq;
+	asm volatile("" ::: "memory");
+	ke->tsc = read_tsc();
+	ke->event = event;
+	ke->cpu = cpunum();
+	ke->args[0] = a0;
+	ke->args[1] = a1;
+	ke->args[2] = a2;
+	asm volatile("" ::: "memory");
+	ke->seq = seq;
+	kt->next = seq + 1;
+}
+
+void
+ktrace_clear(void)
+{
+	int i;
+
+	for (i = 0; i < NCPU; i++)
+		ktraces[i].next = 0;
+}
+
+// Copy record 'seq' of CPU 'cpu' into *ke.
+// Returns false if it has been (or is being) overwritten.
+static bool
+ktrace_read(int cpu, uint32_t seq, struct KtraceEntry *ke)
+{
+	struct KtraceEntry *src = &ktraces[cpu].ring[seq % KTRACE_SIZE];
+
+	*ke = *src;
+	asm volatile("" ::: "memory");
+	return ke->seq == seq && src->seq == seq;
+}
+
+// Dump up to the last 'n' records of each CPU, merged in timestamp
+// order, one record per line:
+//	<tsc> <cpu> <event> <arg0> <arg1> <arg2>
+// all in hex, preceded by a header naming the events, so the output
+// captured from the serial port can be post-processed offline.
+void
+ktrace_dump(int n)
+{
+	uint32_t pos[NCPU], end[NCPU];
+	struct KtraceEntry ke, best;
+	int i, cpu;
+
+	if (n <= 0 || n > KTRACE_SIZE)
+		n = KTRACE_SIZE;
+
+	cprintf("# ktrace ncpu %d tsc_khz %u mask %x\n",
+		ncpu, tsc_khz, ktrace_mask);
+	for (i = 0; i < KT_NEVENTS; i++)
+		cprintf("# event %x %s\n", i, ktrace_names[i]);
+
+	for (i = 0; i < NCPU; i++) {
+		end[i] = ktraces[i].next;
+		pos[i] = end[i] > n ? end[i] - n : 0;
+	}
+
+	while (1) {
+		cpu = -1;
+		for (i = 0; i < ncpu; i++) {
+			// Skip records overwritten since we started.
+			while (pos[i] != end[i] && !ktrace_read(i, pos[i], &ke))
+				pos[i]++;
+			if (pos[i] == end[i])
+				continue;
+			if (cpu < 0 || ke.tsc < best.tsc) {
+				cpu = i;
+				best = ke;
+			}
+		}
+		if (cpu < 0)
+			break;
+		pos[cpu]++;
+		cprintf("%016llx %x %x %x %x %x\n", best.tsc, best.cpu,
+			best.event, best.args[0], best.args[1], best.args[2]);
+	}
+}
+
+// Print the events and whether each is enabled.
+void
+ktrace_print_events(void)
+{
+	int i;
+
+	for (i = 0; i < KT_NEVENTS; i++)
+		cprintf("  %2x %-12s %s\n", 1 << i, ktrace_names[i],
+			(ktrace_mask & (1 << i)) ? "on" : "off");
+}
@@ -0,0 +1,41 @@
+#ifndef JOS_KERN_KTRACE_H
+#define JOS_KERN_KTRACE_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+// Kernel trace events.  Each is enabled by bit (1 << event) in
+// ktrace_mask; the monitor's ktrace command changes the mask and
+// dumps the per-CPU trace rings.
+enum {
+	KT_ENV_RUN = 0,		// envid, env_runs
+	KT_SCHED_YIELD,		// curenv's envid (0 if none)
+	KT_TRAP,		// trapno, eip, err
+	KT_PGFAULT,		// fault va, eip, err
+	KT_IPC_SEND,		// target envid, value, result
+	KT_IPC_RECV,		// dstva
+	KT_ENV_ALLOC,		// envid, parent envid
+	KT_ENV_FREE,		// envid
+	KT_NEVENTS
+};
+
+#define KT_ALL		((1 << KT_NEVENTS) - 1)
+
+extern uint32_t ktrace_mask;
+
+void ktrace_record(int event, uint32_t a0, uint32_t a1, uint32_t a2);
+void ktrace_clear(void);
+void ktrace_dump(int n);
+void ktrace_print_events(void);
+
+// Record an event in this CPU's trace ring if it is enabled.
+static inline void
+ktrace(int event, uint32_t a0, uint32_t a1, uint32_t a2)
+{
+	if (ktrace_mask & (1 << event))
+		ktrace_record(event, a0, a1, a2);
+}
+
+#endif	// !JOS_KERN_KTRACE_H
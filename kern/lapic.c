@@ -9,6 +9,7 @@
 #include <inc/x86.h>
 #include <kern/pmap.h>
 #include <kern/cpu.h>
+#include <kern/kclock.h>
 
 // Local APIC registers, divided by 4 for use as uint32_t[] indices.
 #define ID      (0x0020/4)   // ID
@@ -111,8 +112,10 @@ lapic_init(void)
 	lapicw(TPR, 0);
 }
 
+// This CPU's local APIC ID, which is also its index in cpus[].  An
+// uncached MMIO read; once env_init_gs has run, use cpunum() instead.
 int
-cpunum(void)
+lapic_id(void)
 {
 	if (lapic)
 		return lapic[ID] >> 24;
@@ -127,21 +130,39 @@ lapic_eoi(void)
 		lapicw(EOI, 0);
 }
 
-// Spin for a given number of microseconds.
-// On real hardware would want to tune this dynamically.
+// Spin for a given number of microseconds, going by the TSC rate
+// measured by tsc_calibrate (no delay if it couldn't be measured).
 static void
 microdelay(int us)
 {
+	uint64_t end;
+
+	if (!tsc_khz)
+		return;
+	end = read_tsc() + (uint64_t) us * tsc_khz / 1000;
+	while (read_tsc() < end)
+		asm volatile("pause");
 }
 
-#define IO_RTC  0x70
+// Send an IPI to the CPU with local APIC ID 'apicid' and wait for the
+// local APIC to accept it.
+static void
+lapic_sendipi(uint8_t apicid, uint32_t icrlo)
+{
+	lapicw(ICRHI, apicid << 24);
+	lapicw(ICRLO, icrlo);
+	while (lapic[ICRLO] & DELIVS)
+		;
+}
 
-// Start additional processor running entry code at addr.
+// Start the 'n' additional processors with local APIC IDs 'apicids'
+// running entry code at addr.  All of them go through each step of the
+// startup sequence together, so starting more CPUs costs no extra delays.
 // See Appendix B of MultiProcessor Specification.
 void
-lapic_startap(uint8_t apicid, uint32_t addr)
+lapic_startaps(const uint8_t *apicids, int n, uint32_t addr)
 {
-	int i;
+	int i, j;
 	uint16_t *wrv;
 
 	// "The BSP must initialize CMOS shutdown code to 0AH
@@ -155,10 +176,11 @@ lapic_startap(uint8_t apicid, uint32_t addr)
 
 	// "Universal startup algorithm."
 	// Send INIT (level-triggered) interrupt to reset other CPU.
-	lapicw(ICRHI, apicid << 24);
-	lapicw(ICRLO, INIT | LEVEL | ASSERT);
+	for (j = 0; j < n; j++)
+		lapic_sendipi(apicids[j], INIT | LEVEL | ASSERT);
 	microdelay(200);
-	lapicw(ICRLO, INIT | LEVEL);
+	for (j = 0; j < n; j++)
+		lapic_sendipi(apicids[j], INIT | LEVEL);
 	microdelay(100);    // should be 10ms, but too slow in Bochs!
 
 	// Send startup IPI (twice!) to enter code.
@@ -167,8 +189,8 @@ lapic_startap(uint8_t apicid, uint32_t addr)
 	// should be ignored, but it is part of the official Intel algorithm.
 	// Bochs complains about the second one.  Too bad for Bochs.
 	for (i = 0; i < 2; i++) {
-		lapicw(ICRHI, apicid << 24);
-		lapicw(ICRLO, STARTUP | (addr >> 12));
+		for (j = 0; j < n; j++)
+			lapic_sendipi(apicids[j], STARTUP | (addr >> 12));
 		microdelay(200);
 	}
 }
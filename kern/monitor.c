@@ -11,6 +11,12 @@
 #include <kern/monitor.h>
 #include <kern/kdebug.h>
 #include <kern/trap.h>
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/syscall.h>
+#include <kern/ktrace.h>
+#include <kern/prof.h>
+#include <kern/pmu.h>
 
 #define CMDBUF_SIZE	80	// enough for one VGA text line
 
@@ -27,7 +33,13 @@ static struct Command commands[] = {
 	{ "help", "Display this list of commands", mon_help },
 	{ "kerninfo", "Display information about the kernel", mon_kerninfo },
   { "backtrace", "Displays a stack backtrace", mon_backtrace },
-  { "show", "Displays a pretty ASCII art", mon_show }
+  { "show", "Displays a pretty ASCII art", mon_show },
+  { "memusage", "List the environments holding the most pages [count]", mon_memusage },
+  { "sysstats", "Display system call counts and cycles [reset]", mon_sysstats },
+  { "strace", "Display traced system calls [count]", mon_strace },
+  { "ktrace", "Dump kernel trace rings [dump count | mask bits | clear]", mon_ktrace },
+  { "prof", "Sampling profiler [start ticks | stop | reset | top count]", mon_prof },
+  { "pmu", "Display performance counter totals per environment", mon_pmu }
 };
 
 /***** Implementations of basic kernel monitor commands *****/
@@ -69,6 +81,114 @@ mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
 	return 0;
 }
 
+#define MEMUSAGE_MAX	32	// most environments memusage will list
+
+static uint32_t
+env_usage(struct Env *e)
+{
+	return e->env_npages + e->env_nptabs + 1;	// + page directory
+}
+
+int
+mon_memusage(int argc, char **argv, struct Trapframe *tf)
+{
+	struct Env *top[MEMUSAGE_MAX];
+	int i, j, n, ntop = 0, nenvs = 0;
+
+	n = argc > 1 ? strtol(argv[1], 0, 0) : 10;
+	if (n <= 0 || n > MEMUSAGE_MAX)
+		n = MEMUSAGE_MAX;
+
+	// Keep the n largest consumers, sorted, in top[].
+	for (i = 0; i < nenv; i++) {
+		if (envs[i].env_status == ENV_FREE)
+			continue;
+		nenvs++;
+		for (j = ntop; j > 0 && env_usage(top[j - 1]) < env_usage(&envs[i]); j--)
+			if (j < n)
+				top[j] = top[j - 1];
+		if (j < n) {
+			top[j] = &envs[i];
+			if (ntop < n)
+				ntop++;
+		}
+	}
+
+	cprintf("%d free pages of %d, %d environments\n",
+		page_free_count(), npages, nenvs);
+	cprintf("  envid     status  pages  ptabs  total  quota\n");
+	for (i = 0; i < ntop; i++)
+		cprintf("  %08x  %6d  %5d  %5d  %5d  %5d\n",
+			top[i]->env_id, top[i]->env_status,
+			top[i]->env_npages, top[i]->env_nptabs,
+			env_usage(top[i]), top[i]->env_page_quota);
+	return 0;
+}
+
+int
+mon_sysstats(int argc, char **argv, struct Trapframe *tf)
+{
+	if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+		syscall_stats_reset();
+		return 0;
+	}
+	syscall_stats_print();
+	return 0;
+}
+
+int
+mon_strace(int argc, char **argv, struct Trapframe *tf)
+{
+	syscall_trace_print(argc > 1 ? strtol(argv[1], 0, 0) : 20);
+	return 0;
+}
+
+int
+mon_ktrace(int argc, char **argv, struct Trapframe *tf)
+{
+	if (argc > 1 && strcmp(argv[1], "dump") == 0)
+		ktrace_dump(argc > 2 ? strtol(argv[2], 0, 0) : 0);
+	else if (argc > 2 && strcmp(argv[1], "mask") == 0)
+		ktrace_mask = strtol(argv[2], 0, 0) & KT_ALL;
+	else if (argc > 1 && strcmp(argv[1], "clear") == 0)
+		ktrace_clear();
+	else if (argc > 1)
+		cprintf("usage: ktrace [dump [count] | mask bits | clear]\n");
+	else
+		ktrace_print_events();
+	return 0;
+}
+
+int
+mon_prof(int argc, char **argv, struct Trapframe *tf)
+{
+	if (argc > 1 && strcmp(argv[1], "start") == 0) {
+		prof_interval = argc > 2 ? strtol(argv[2], 0, 0) : 1;
+		if (prof_interval == 0)
+			prof_interval = 1;
+	} else if (argc > 1 && strcmp(argv[1], "stop") == 0)
+		prof_interval = 0;
+	else if (argc > 1 && strcmp(argv[1], "reset") == 0)
+		prof_reset();
+	else if (argc == 1 || strcmp(argv[1], "top") == 0)
+		prof_print_top(argc > 2 ? strtol(argv[2], 0, 0) : 20);
+	else
+		cprintf("usage: prof [start [ticks] | stop | reset | top [count]]\n");
+	return 0;
+}
+
+int
+mon_pmu(int argc, char **argv, struct Trapframe *tf)
+{
+	// Fold in the counts of the environment that trapped to us.
+	if (curenv) {
+		pmu_save(curenv);
+		pmu_restore(curenv);
+	}
+	pmu_print();
+	return 0;
+}
+
 int
 mon_backtrace(int argc, char **argv, struct Trapframe *tf)
 {
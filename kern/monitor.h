@@ -16,5 +16,11 @@ int mon_help(int argc, char **argv, struct Trapframe *tf);
 int mon_kerninfo(int argc, char **argv, struct Trapframe *tf);
 int mon_backtrace(int argc, char **argv, struct Trapframe *tf);
 int mon_show(int argc, char **argv, struct Trapframe *tf);
+int mon_memusage(int argc, char **argv, struct Trapframe *tf);
+int mon_sysstats(int argc, char **argv, struct Trapframe *tf);
+int mon_strace(int argc, char **argv, struct Trapframe *tf);
+int mon_ktrace(int argc, char **argv, struct Trapframe *tf);
+int mon_prof(int argc, char **argv, struct Trapframe *tf);
+int mon_pmu(int argc, char **argv, struct Trapframe *tf);
 
 #endif	// !JOS_KERN_MONITOR_H
@@ -14,12 +14,25 @@
 
 // These variables are set by i386_detect_memory()
 size_t npages;			// Amount of physical memory (in pages)
+size_t npages_lowmem;		// Pages direct-mapped at KERNBASE
 static size_t npages_basemem;	// Amount of base memory (in pages)
 
 // These variables are set in mem_init()
 pde_t *kern_pgdir;		// Kernel's initial page directory
 struct PageInfo *pages;		// Physical page state array
 static struct PageInfo *page_free_list;	// Free list of physical pages
+static struct PageInfo *page_free_list_high;	// Free pages above lowmem
+
+// entry_pgdir maps physical [0, EARLYMEM_LIM) at KERNBASE; everything
+// boot_alloc hands out has to fit in there.
+#define EARLYMEM_LIM	(8 * PTSIZE)
+
+// pages[] has to fit in its PTSIZE window at UPAGES.
+#define NPAGES_MAX	(PTSIZE / sizeof(struct PageInfo))
+
+// kmap() slots per CPU in [KMAPBASE, KMAPLIM).
+#define KMAP_NSLOT	(KMAPSIZE / PGSIZE / NCPU)
+static pte_t *kmap_ptes;		// PTEs mapping [KMAPBASE, KMAPLIM)
 
 
 // --------------------------------------------------------------
@@ -57,6 +70,19 @@ i386_detect_memory(void)
 
 	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
 		totalmem, basemem, totalmem - basemem);
+
+	// Only the first 256MB fit in the KERNBASE direct map; anything
+	// above that is high memory, which the kernel reaches through
+	// kmap().
+	if (npages > NPAGES_MAX) {
+		npages = NPAGES_MAX;
+		cprintf("Physical memory: using only the first %uK\n",
+			npages * (PGSIZE / 1024));
+	}
+	npages_lowmem = MIN(npages, PGNUM(-KERNBASE));
+	if (npages > npages_lowmem)
+		cprintf("Physical memory: %uK high memory\n",
+			(npages - npages_lowmem) * (PGSIZE / 1024));
 }
 
 
@@ -66,9 +92,11 @@ i386_detect_memory(void)
 
 static void mem_init_mp(void);
 static void boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm);
+static void page_free_list_low_first(void);
 static void check_page_free_list(bool only_low_memory);
 static void check_page_alloc(void);
 static void check_kern_pgdir(void);
+static void check_kern_pgdir_physmem(size_t start, size_t end, size_t step);
 static physaddr_t check_va2pa(pde_t *pgdir, uintptr_t va);
 static void check_page(void);
 static void check_page_installed_pgdir(void);
@@ -118,7 +146,7 @@ boot_alloc(uint32_t n)
     nextfree = ROUNDUP(nextfree + n, PGSIZE);
 
     // if out of mem, panic
-    if(PADDR(nextfree) > npages * PGSIZE){
+    if(PADDR(nextfree) > MIN(npages * PGSIZE, EARLYMEM_LIM)){
       panic("Not enough memory to alloc!\n");
     }
     return result;
@@ -176,9 +204,10 @@ mem_init(void)
 
 	//////////////////////////////////////////////////////////////////////
 	// Make 'envs' point to an array of size 'NENV' of 'struct Env'.
-	// LAB 3: Your code here.
-  envs = boot_alloc(sizeof(struct Env) * NENV);
-  memset(envs, 0, sizeof(struct Env)*NENV);
+	// It lives at KENVS and only gets memory behind it as env_alloc
+	// needs more slots (see envs_grow).
+	static_assert(NENV * sizeof(struct Env) <= UENVSIZE);
+	envs = (struct Env *) KENVS;
 
 	//////////////////////////////////////////////////////////////////////
 	// Now that we've allocated the initial kernel data structures, we set
@@ -188,9 +217,22 @@ mem_init(void)
 	// or page_insert
 	page_init();
 
+#ifdef MEMCHECK_FAST
+	// Skip the allocator self-tests, but entry_pgdir still only maps
+	// low memory, so the page tables we allocate below must come
+	// from there.
+	page_free_list_low_first();
+#else
 	check_page_free_list(1);
 	check_page_alloc();
 	check_page();
+#endif
+
+	//////////////////////////////////////////////////////////////////////
+	// Create the page table for the kmap() windows now, so every
+	// env_pgdir copied from kern_pgdir shares it.
+	kmap_ptes = pgdir_walk(kern_pgdir, (void *) KMAPBASE, 1);
+	assert(kmap_ptes);
 
 	//////////////////////////////////////////////////////////////////////
 	// Now we set up virtual memory
@@ -211,12 +253,12 @@ mem_init(void)
 	// Permissions:
 	//    - the new image at UENVS  -- kernel R, user R
 	//    - envs itself -- kernel RW, user NONE
-	// LAB 3: Your code here.
-  // map space for user environments
-  n = ROUNDUP(sizeof(struct Env) * NENV, PGSIZE);
-
-  // map user R/O at UENV
-  boot_map_region(kern_pgdir, UENVS, n, PADDR(envs), PTE_U | PTE_P);
+	// Nothing is mapped yet, but create the page tables for both
+	// windows now so every env_pgdir shares them as envs[] grows.
+	for (n = 0; n < UENVSIZE; n += PTSIZE)
+		if (!pgdir_walk(kern_pgdir, (void *) (KENVS + n), 1)
+		    || !pgdir_walk(kern_pgdir, (void *) (UENVS + n), 1))
+			panic("mem_init: out of memory for envs page tables");
 
 
 
@@ -262,7 +304,9 @@ mem_init(void)
 	// kern_pgdir wrong.
 	lcr3(PADDR(kern_pgdir));
 
+#ifndef MEMCHECK_FAST
 	check_page_free_list(0);
+#endif
 
 	// entry.S set the really important flags in cr0 (including enabling
 	// paging).  Here we configure the rest of the flags that we care about.
@@ -272,7 +316,9 @@ mem_init(void)
 	lcr0(cr0);
 
 	// Some more checks, only possible after kern_pgdir is installed.
+#ifndef MEMCHECK_FAST
 	check_page_installed_pgdir();
+#endif
 }
 
 // Modify mappings in kern_pgdir to support SMP
@@ -353,6 +399,11 @@ page_init(void)
       pages[i].pp_ref = 1;
     }else if((i * PGSIZE) == MPENTRY_PADDR){
       pages[i].pp_ref = 1;   // lab 4
+    }else if(i >= npages_lowmem){
+      // high memory has its own free list
+      pages[i].pp_ref = 0;
+      pages[i].pp_link = page_free_list_high;
+      page_free_list_high = &pages[i];
     }else {
       // add page to front of page_free_list
       pages[i].pp_ref = 0;
@@ -371,24 +422,35 @@ page_init(void)
 // Be sure to set the pp_link field of the allocated page to NULL so
 // page_free can check for double-free bugs.
 //
+// If (alloc_flags & ALLOC_HIGH), the page comes from high memory while
+// there is any, keeping the direct-mapped pages for page tables and
+// other kernel data.
+//
 // Returns NULL if out of free memory.
 //
 // Hint: use page2kva and memset
 struct PageInfo *
 page_alloc(int alloc_flags)
 {
+  struct PageInfo** list = &page_free_list;
+
+  if((alloc_flags & ALLOC_HIGH) && page_free_list_high)
+    list = &page_free_list_high;
+
 	// verify we have free memory
-  if(page_free_list == NULL)
+  if(*list == NULL)
     return NULL;
 
   // pull next free physical page
-  struct PageInfo* pp = page_free_list;
-  page_free_list = page_free_list->pp_link; //adjust head of ll
+  struct PageInfo* pp = *list;
+  *list = pp->pp_link; //adjust head of ll
 
   // set page to zero if flags set
-  if(alloc_flags & ALLOC_ZERO)
-    memset(page2kva(pp), 0, PGSIZE);
-  
+  if(alloc_flags & ALLOC_ZERO){
+    void* kva = kmap(pp);
+    page_zero(kva);
+    kunmap(kva);
+  }
 
   // prevent double-free bugs
   pp->pp_link = NULL;
@@ -408,8 +470,13 @@ page_free(struct PageInfo *pp)
     panic("Attempting to free a page with active references");
 
   // free page
-  pp->pp_link = page_free_list;
-  page_free_list = pp;
+  if(page_is_high(pp)){
+    pp->pp_link = page_free_list_high;
+    page_free_list_high = pp;
+  }else{
+    pp->pp_link = page_free_list;
+    page_free_list = pp;
+  }
 }
 
 //
@@ -423,6 +490,59 @@ page_decref(struct PageInfo* pp)
 		page_free(pp);
 }
 
+//
+// Per-environment memory accounting.
+//
+// Every page directory allocated by env_setup_vm records its owner in
+// pp_pgdir_owner, so pgdir_walk, page_insert and page_remove can keep
+// the owner's env_nptabs and env_npages current without having the
+// Env threaded through every caller.  kern_pgdir has no owner.
+//
+
+void
+pgdir_set_owner(pde_t *pgdir, struct Env *e)
+{
+	pa2page(PADDR(pgdir))->pp_pgdir_owner = e ? e - envs + 1 : 0;
+}
+
+static struct Env *
+pgdir_env(pde_t *pgdir)
+{
+	uint16_t owner = pa2page(PADDR(pgdir))->pp_pgdir_owner;
+
+	return owner ? &envs[owner - 1] : NULL;
+}
+
+// Return 0 if mapping a new page at 'va' keeps 'e' within its page
+// quota, counting the page table that would have to be allocated.
+// Replacing an existing mapping doesn't grow the footprint.
+int
+env_page_charge(struct Env *e, void *va)
+{
+	uint32_t need;
+
+	if (!e->env_page_quota || page_lookup(e->env_pgdir, va, NULL))
+		return 0;
+	need = 1 + !(e->env_pgdir[PDX(va)] & PTE_P);
+	if (e->env_npages + e->env_nptabs + need > e->env_page_quota)
+		return -E_NO_MEM;
+	return 0;
+}
+
+// Return the number of pages on the free list.
+size_t
+page_free_count(void)
+{
+	struct PageInfo *pp;
+	size_t n = 0;
+
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+		n++;
+	for (pp = page_free_list_high; pp; pp = pp->pp_link)
+		n++;
+	return n;
+}
+
 // Given 'pgdir', a pointer to a page directory, pgdir_walk returns
 // a pointer to the page table entry (PTE) for linear address 'va'.
 // This requires walking the two-level page table structure.
@@ -448,6 +568,8 @@ page_decref(struct PageInfo* pp)
 pte_t *
 pgdir_walk(pde_t *pgdir, const void *va, int create)
 {
+	struct Env *e;
+
 	// get page directory entry
   pde_t pde = pgdir[PDX(va)];
 
@@ -467,6 +589,8 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
 
     // increment references on success
     pp_page_table->pp_ref += 1;
+    if ((e = pgdir_env(pgdir)))
+      e->env_nptabs++;
 
     // update page directory
     pgdir[PDX(va)] = page2pa(pp_page_table) | PTE_P | PTE_U | PTE_W;
@@ -532,6 +656,8 @@ boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm
 int
 page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm)
 {
+  struct Env *e;
+
   // get page table (alloc if does not exit)
   pte_t* p_pte = pgdir_walk(pgdir, va, 1);
 
@@ -545,6 +671,8 @@ page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm)
   
   // store page mapping
   *p_pte = PTE_ADDR(page2pa(pp)) | perm | PTE_P;
+  if ((e = pgdir_env(pgdir)))
+    e->env_npages++;
 
   //cprintf("PG_INSERT(%08x): inserting into page table %08x with new mapping %08x\n", va, p_pte, *p_pte);
   
@@ -601,6 +729,7 @@ void
 page_remove(pde_t *pgdir, void *va)
 {
 	// thank you based yeongjin
+  struct Env *e;
   pte_t* p_pte = NULL;
   struct PageInfo* pp = page_lookup(pgdir, va, &p_pte);
 
@@ -618,6 +747,145 @@ page_remove(pde_t *pgdir, void *va)
     *p_pte = 0;
     tlb_invalidate(pgdir, va);
   }
+
+  if ((e = pgdir_env(pgdir)))
+    e->env_npages--;
+}
+
+//
+// Return the page mapped copy-on-write at 'va', storing its PTE in
+// *pte_store, or NULL if 'va' is not a PTE_COW mapping.
+//
+static struct PageInfo *
+cow_lookup(pde_t *pgdir, void *va, pte_t **pte_store)
+{
+	struct PageInfo *pp;
+
+	if (!(pp = page_lookup(pgdir, va, pte_store)) || !(**pte_store & PTE_COW))
+		return NULL;
+	return pp;
+}
+
+//
+// If 'pgdir' holds the only reference to the copy-on-write page mapped
+// at 'va', make that mapping writable in place: nobody else can see the
+// page, so there is nothing to copy.  PTE_COW is cleared and the other
+// PTE_SYSCALL permission bits are preserved.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if 'va' is not mapped copy-on-write or the page is shared
+//
+int
+page_cow_reuse(pde_t *pgdir, void *va)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+
+	va = ROUNDDOWN(va, PGSIZE);
+	if (!(pp = cow_lookup(pgdir, va, &pte)) || pp->pp_ref != 1)
+		return -E_INVAL;
+	*pte = page2pa(pp) | (*pte & PTE_SYSCALL & ~PTE_COW) | PTE_W;
+	tlb_invalidate(pgdir, va);
+	return 0;
+}
+
+//
+// Resolve a write to the copy-on-write page mapped at 'va'.
+// A page with a single reference is reused as by page_cow_reuse();
+// otherwise it is copied into a fresh page that replaces the COW
+// mapping, with the same permissions minus PTE_COW plus PTE_W.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if 'va' is not mapped copy-on-write
+//   -E_NO_MEM, if the copy could not be allocated
+//
+int
+page_cow(pde_t *pgdir, void *va)
+{
+	struct PageInfo *pp, *np;
+	void *dst, *src;
+	pte_t *pte;
+
+	va = ROUNDDOWN(va, PGSIZE);
+	if (!(pp = cow_lookup(pgdir, va, &pte)))
+		return -E_INVAL;
+	if (pp->pp_ref == 1)
+		return page_cow_reuse(pgdir, va);
+
+	if (!(np = page_alloc(ALLOC_HIGH)))
+		return -E_NO_MEM;
+	dst = kmap(np);
+	src = kmap(pp);
+	page_copy(dst, src);
+	kunmap(src);
+	kunmap(dst);
+	// The page table already exists, so this cannot fail.
+	return page_insert(pgdir, np, va,
+			   (*pte & PTE_SYSCALL & ~PTE_COW) | PTE_W);
+}
+
+//
+// Drop a page reference during pgdir_teardown, collecting the page on
+// the batch list [*head, *tail] instead of the free list if it was the
+// last reference.  High pages go straight to their own free list.
+//
+static void
+page_decref_batch(struct PageInfo *pp, struct PageInfo **head,
+		  struct PageInfo **tail)
+{
+	if (--pp->pp_ref)
+		return;
+	if (pp->pp_link != NULL)
+		panic("pgdir_teardown: page %08x already free", page2pa(pp));
+	if (page_is_high(pp)) {
+		page_free(pp);
+		return;
+	}
+	pp->pp_link = *head;
+	if (!*head)
+		*tail = pp;
+	*head = pp;
+}
+
+//
+// Unmap everything below UTOP in 'pgdir' and free its page tables.
+// This is the bulk equivalent of calling page_remove() on every mapped
+// page, for address spaces that are being discarded: each page table is
+// walked once, freed pages are spliced onto the free list in one go,
+// and no TLB entries are invalidated.  The caller must make sure
+// 'pgdir' isn't loaded in %cr3 on any CPU.
+//
+void
+pgdir_teardown(pde_t *pgdir)
+{
+	struct PageInfo *head = NULL, *tail = NULL;
+	struct Env *e;
+	uint32_t pdeno, pteno;
+	pte_t *pt;
+
+	static_assert(UTOP % PTSIZE == 0);
+	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+		if (!(pgdir[pdeno] & PTE_P))
+			continue;
+		pt = (pte_t *) KADDR(PTE_ADDR(pgdir[pdeno]));
+		for (pteno = 0; pteno < NPTENTRIES; pteno++)
+			if (pt[pteno] & PTE_P)
+				page_decref_batch(pa2page(PTE_ADDR(pt[pteno])),
+						  &head, &tail);
+		page_decref_batch(pa2page(PTE_ADDR(pgdir[pdeno])),
+				  &head, &tail);
+		pgdir[pdeno] = 0;
+	}
+
+	if (head) {
+		tail->pp_link = page_free_list;
+		page_free_list = head;
+	}
+
+	if ((e = pgdir_env(pgdir)))
+		e->env_npages = e->env_nptabs = 0;
 }
 
 //
@@ -672,7 +940,7 @@ mmio_map_region(physaddr_t pa, size_t size)
   uint32_t pa_offset = pa & 0xFFF;        // last 12 bits of address
 
   // verify mapping to valid region
-  if(base + (pa_end - pa_start) > MMIOLIM)
+  if(base + (pa_end - pa_start) > KMAPBASE)
     panic("mmio_map_region: invalid map size");
 
   /*
@@ -693,6 +961,74 @@ mmio_map_region(physaddr_t pa, size_t size)
   return (void*)(old_base + pa_offset);
 }
 
+//
+// Make sure envs[0, n) is backed by memory, mapping fresh zeroed pages
+// at KENVS and read-only at UENVS.  The pages are never freed.
+// Returns 0, or -E_NO_MEM if it ran out of memory part of the way.
+//
+int
+envs_grow(size_t n)
+{
+	static size_t mapped;	// bytes of envs[] backed so far
+	struct PageInfo *pp;
+	size_t size = ROUNDUP(n * sizeof(struct Env), PGSIZE);
+
+	// The PTEs go from not present to present, so there are no TLB
+	// entries to flush on any CPU.
+	for (; mapped < size; mapped += PGSIZE) {
+		if (!(pp = page_alloc(ALLOC_ZERO | ALLOC_HIGH)))
+			return -E_NO_MEM;
+		pp->pp_ref++;
+		*pgdir_walk(kern_pgdir, (void *) (KENVS + mapped), 0) =
+			page2pa(pp) | PTE_W | PTE_P;
+		*pgdir_walk(kern_pgdir, (void *) (UENVS + mapped), 0) =
+			page2pa(pp) | PTE_U | PTE_P;
+	}
+	return 0;
+}
+
+//
+// Map 'pp' into the kernel's address space and return its address.
+// Low pages are simply their KERNBASE address; a high page gets the
+// next free one of this CPU's kmap() slots until the matching kunmap().
+// Slots are a stack, so release mappings in reverse order, and don't
+// hold one across anything that might switch environments.
+//
+void *
+kmap(struct PageInfo *pp)
+{
+	int slot;
+
+	static_assert(KMAP_NSLOT >= 2);
+	if (!page_is_high(pp))
+		return page2kva(pp);
+	if (thiscpu->cpu_kmap_depth == KMAP_NSLOT)
+		panic("kmap: out of slots");
+	slot = cpunum() * KMAP_NSLOT + thiscpu->cpu_kmap_depth++;
+	// The slot's PTE is clear while it's unused, so there is no
+	// stale TLB entry to flush.
+	kmap_ptes[slot] = page2pa(pp) | PTE_W | PTE_P;
+	return (void *) (KMAPBASE + slot * PGSIZE);
+}
+
+//
+// Release a mapping returned by kmap().
+//
+void
+kunmap(void *kva)
+{
+	int slot;
+
+	if ((uintptr_t) kva < KMAPBASE || (uintptr_t) kva >= KMAPLIM)
+		return;
+	slot = PGNUM((uintptr_t) kva - KMAPBASE);
+	if (slot != cpunum() * KMAP_NSLOT + thiscpu->cpu_kmap_depth - 1)
+		panic("kunmap: %08x is not the last kmap", kva);
+	kmap_ptes[slot] = 0;
+	thiscpu->cpu_kmap_depth--;
+	invlpg(kva);
+}
+
 static uintptr_t user_mem_check_addr;
 
 //
@@ -789,6 +1125,26 @@ user_mem_assert(struct Env *env, const void *va, size_t len, int perm)
 // Checking functions.
 // --------------------------------------------------------------
 
+//
+// Move pages with lower addresses first in the free list,
+// since entry_pgdir does not map all pages.
+//
+static void
+page_free_list_low_first(void)
+{
+	struct PageInfo *pp, *pp1, *pp2;
+	struct PageInfo **tp[2] = { &pp1, &pp2 };
+
+	for (pp = page_free_list; pp; pp = pp->pp_link) {
+		int pagetype = PDX(page2pa(pp)) >= 1;
+		*tp[pagetype] = pp;
+		tp[pagetype] = &pp->pp_link;
+	}
+	*tp[1] = 0;
+	*tp[0] = pp2;
+	page_free_list = pp1;
+}
+
 //
 // Check that the pages on the page_free_list are reasonable.
 //
@@ -803,20 +1159,8 @@ check_page_free_list(bool only_low_memory)
 	if (!page_free_list)
 		panic("'page_free_list' is a null pointer!");
 
-	if (only_low_memory) {
-		// Move pages with lower addresses first in the free
-		// list, since entry_pgdir does not map all pages.
-		struct PageInfo *pp1, *pp2;
-		struct PageInfo **tp[2] = { &pp1, &pp2 };
-		for (pp = page_free_list; pp; pp = pp->pp_link) {
-			int pagetype = PDX(page2pa(pp)) >= pdx_limit;
-			*tp[pagetype] = pp;
-			tp[pagetype] = &pp->pp_link;
-		}
-		*tp[1] = 0;
-		*tp[0] = pp2;
-		page_free_list = pp1;
-	}
+	if (only_low_memory)
+		page_free_list_low_first();
 
 	// if there's a page that shouldn't be on the free list,
 	// try to make sure it eventually causes trouble.
@@ -951,14 +1295,22 @@ check_kern_pgdir(void)
 	for (i = 0; i < n; i += PGSIZE)
 		assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
 
-	// check envs array (new test for lab 3)
-	n = ROUNDUP(NENV*sizeof(struct Env), PGSIZE);
-	for (i = 0; i < n; i += PGSIZE)
-		assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
+	// check envs array (new test for lab 3): nothing is backed until
+	// env_init grows it
+	for (i = 0; i < UENVSIZE; i += PGSIZE) {
+		assert(check_va2pa(pgdir, KENVS + i) == ~0);
+		assert(check_va2pa(pgdir, UENVS + i) == ~0);
+	}
 
 	// check phys mem
-	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
-		assert(check_va2pa(pgdir, KERNBASE + i) == i);
+#if defined(MEMCHECK_FAST)
+	// every 64th page, and the last
+	check_kern_pgdir_physmem(0, npages_lowmem, 64);
+	check_kern_pgdir_physmem(npages_lowmem - 1, npages_lowmem, 1);
+#elif !defined(MEMCHECK_PARALLEL)
+	check_kern_pgdir_physmem(0, npages_lowmem, 1);
+#endif
+	// (MEMCHECK_PARALLEL: every CPU checks a share in mem_check_percpu)
 
 	// check kernel stack
 	// (updated in lab 4 to check per-CPU kernel stacks)
@@ -977,12 +1329,14 @@ check_kern_pgdir(void)
 		case PDX(UVPT):
 		case PDX(KSTACKTOP-1):
 		case PDX(UPAGES):
-		case PDX(UENVS):
 		case PDX(MMIOBASE):
 			assert(pgdir[i] & PTE_P);
 			break;
 		default:
-			if (i >= PDX(KERNBASE)) {
+			if (i >= PDX(KENVS) && i < PDX(UPAGES)) {
+				// both views of envs[]
+				assert(pgdir[i] & PTE_P);
+			} else if (i >= PDX(KERNBASE)) {
 				assert(pgdir[i] & PTE_P);
 				assert(pgdir[i] & PTE_W);
 			} else{
@@ -994,6 +1348,53 @@ check_kern_pgdir(void)
 	cprintf("check_kern_pgdir() succeeded!\n");
 }
 
+// Check that physical pages [start, end) are mapped at KERNBASE,
+// looking at every 'step'th one.
+static void
+check_kern_pgdir_physmem(size_t start, size_t end, size_t step)
+{
+	size_t i;
+
+	for (i = start; i < end; i += step)
+		assert(check_va2pa(kern_pgdir, KERNBASE + i * PGSIZE) == i * PGSIZE);
+}
+
+#ifdef MEMCHECK_PARALLEL
+static volatile bool mem_check_done[NCPU];
+#endif
+
+// With MEMCHECK_PARALLEL, check_kern_pgdir leaves the KERNBASE mapping
+// of physical memory, by far its longest check, to all the CPUs
+// together once they have started: each one calls this to check its
+// share.  A no-op otherwise.
+void
+mem_check_percpu(void)
+{
+#ifdef MEMCHECK_PARALLEL
+	int i = cpunum();
+
+	check_kern_pgdir_physmem(npages_lowmem * i / ncpu,
+				 npages_lowmem * (i + 1) / ncpu, 1);
+	mem_check_done[i] = 1;
+#endif
+}
+
+// Called on the boot CPU after its own mem_check_percpu: wait for the
+// other CPUs to finish their shares.
+void
+mem_check_wait(void)
+{
+#ifdef MEMCHECK_PARALLEL
+	int i;
+
+	for (i = 0; i < ncpu; i++)
+		while (!mem_check_done[i])
+			asm volatile("pause");
+	cprintf("check_kern_pgdir() physical memory checked on %d CPUs\n",
+		ncpu);
+#endif
+}
+
 // This function returns the physical address of the page containing 'va',
 // defined by the page directory 'pgdir'.  The hardware normally performs
 // this functionality for us!  We define our own version to help check
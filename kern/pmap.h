@@ -14,12 +14,13 @@ extern char bootstacktop[], bootstack[];
 
 extern struct PageInfo *pages;
 extern size_t npages;
+extern size_t npages_lowmem;
 
 extern pde_t *kern_pgdir;
 
 
 /* This macro takes a kernel virtual address -- an address that points above
- * KERNBASE, where the machine's maximum 256MB of physical memory is mapped --
+ * KERNBASE, where the first 256MB of physical memory is mapped --
  * and returns the corresponding physical address.  It panics if you pass it a
  * non-kernel virtual address.
  */
@@ -34,13 +35,14 @@ _paddr(const char *file, int line, void *kva)
 }
 
 /* This macro takes a physical address and returns the corresponding kernel
- * virtual address.  It panics if you pass an invalid physical address. */
+ * virtual address.  It panics if you pass an invalid physical address,
+ * including one in high memory above the KERNBASE mapping. */
 #define KADDR(pa) _kaddr(__FILE__, __LINE__, pa)
 
 static inline void*
 _kaddr(const char *file, int line, physaddr_t pa)
 {
-	if (PGNUM(pa) >= npages)
+	if (PGNUM(pa) >= npages_lowmem)
 		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
 	return (void *)(pa + KERNBASE);
 }
@@ -49,9 +51,14 @@ _kaddr(const char *file, int line, physaddr_t pa)
 enum {
 	// For page_alloc, zero the returned physical page.
 	ALLOC_ZERO = 1<<0,
+	// For page_alloc, the caller only reaches the page's contents
+	// through kmap() or a user mapping, so it may be high memory.
+	ALLOC_HIGH = 1<<1,
 };
 
 void	mem_init(void);
+void	mem_check_percpu(void);
+void	mem_check_wait(void);
 
 void	page_init(void);
 struct PageInfo *page_alloc(int alloc_flags);
@@ -60,11 +67,22 @@ int	page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm);
 void	page_remove(pde_t *pgdir, void *va);
 struct PageInfo *page_lookup(pde_t *pgdir, void *va, pte_t **pte_store);
 void	page_decref(struct PageInfo *pp);
+int	page_cow(pde_t *pgdir, void *va);
+int	page_cow_reuse(pde_t *pgdir, void *va);
+size_t	page_free_count(void);
+
+void	pgdir_set_owner(pde_t *pgdir, struct Env *e);
+int	env_page_charge(struct Env *e, void *va);
+void	pgdir_teardown(pde_t *pgdir);
+int	envs_grow(size_t n);
 
 void	tlb_invalidate(pde_t *pgdir, void *va);
 
 void *	mmio_map_region(physaddr_t pa, size_t size);
 
+void *	kmap(struct PageInfo *pp);
+void	kunmap(void *kva);
+
 int	user_mem_check(struct Env *env, const void *va, size_t len, int perm);
 void	user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
 
@@ -82,6 +100,13 @@ pa2page(physaddr_t pa)
 	return &pages[PGNUM(pa)];
 }
 
+static inline bool
+page_is_high(struct PageInfo *pp)
+{
+	return (size_t) (pp - pages) >= npages_lowmem;
+}
+
+// Only for pages that can't be high memory; see kmap().
 static inline void*
 page2kva(struct PageInfo *pp)
 {
@@ -0,0 +1,155 @@
+// Hardware performance counters, virtualized per environment.
+//
+// When CPUID reports architectural performance monitoring, each CPU
+// programs general-purpose counters 0..ENV_NPMC-1 with the events in
+// pmu_events, counting in user mode only.  Each environment's counts
+// accumulate in env_pmc: pmu_restore loads the low bits of the
+// environment's totals when it is switched to, and pmu_save adds what
+// the counters advanced by when it is descheduled.  An environment with
+// env_rdpmc set may read the counters directly with RDPMC; the low 31
+// bits of what it reads match its totals.
+//
+// Counters are at least 40 bits wide and are folded into env_pmc at
+// every switch, so they can't overflow within a time slice, and the
+// LAPIC's PCINT stays masked.  On CPUs (or emulators) without a PMU,
+// everything here is a no-op and the counts stay zero.
+
+#include <inc/x86.h>
+#include <inc/mmu.h>
+#include <inc/stdio.h>
+
+#include <kern/cpu.h>
+#include <kern/env.h>
+#include <kern/pmu.h>
+
+#define MSR_PERFEVTSEL0	0x186		// IA32_PERFEVTSELx = 0x186 + x
+#define MSR_PMC0	0x0c1		// IA32_PMCx = 0x0c1 + x
+
+#define PERFEVTSEL_USR	(1 << 16)	// Count in ring 3
+#define PERFEVTSEL_EN	(1 << 22)	// Enable the counter
+
+static const struct {
+	const char *name;
+	uint8_t event;
+	uint8_t umask;
+} pmu_events[ENV_NPMC] = {
+	{ "cycles",	0x3c, 0x00 },	// UnHalted Core Cycles (architectural)
+	{ "instrs",	0xc0, 0x00 },	// Instructions Retired (architectural)
+	{ "llc-miss",	0x2e, 0x41 },	// LLC Misses (architectural)
+	{ "dtlb-miss",	0x08, 0x01 },	// DTLB load misses (model-specific)
+};
+
+// Set up by the boot CPU; the APs are assumed to match it.
+static int pmu_ncounters;		// Counters in use, <= ENV_NPMC
+static uint64_t pmu_mask;		// Counter width mask
+
+// Per CPU, each on its own cache line since they change on every
+// switch: the environment whose counts are in the counters, and the
+// values loaded into them.
+static struct PmuCpu {
+	struct Env *env;
+	uint32_t base[ENV_NPMC];
+} __attribute__((aligned(CACHELINE))) pmu_cpus[NCPU];
+
+void
+pmu_init_percpu(void)
+{
+	uint32_t eax, i;
+
+	cpuid(0, &eax, 0, 0, 0);
+	if (eax < 0xa)
+		return;
+	cpuid(0xa, &eax, 0, 0, 0);
+	if ((eax & 0xff) == 0 || ((eax >> 8) & 0xff) == 0)
+		return;
+
+	if (thiscpu == bootcpu) {
+		pmu_ncounters = MIN((eax >> 8) & 0xff, ENV_NPMC);
+		pmu_mask = (1ULL << ((eax >> 16) & 0xff)) - 1;
+		cprintf("pmu: version %d, %d counters of %d bits\n",
+			eax & 0xff, (eax >> 8) & 0xff, (eax >> 16) & 0xff);
+	}
+	for (i = 0; i < pmu_ncounters; i++) {
+		wrmsr(MSR_PERFEVTSEL0 + i, 0);
+		wrmsr(MSR_PMC0 + i, 0);
+		wrmsr(MSR_PERFEVTSEL0 + i, PERFEVTSEL_EN | PERFEVTSEL_USR
+		      | (pmu_events[i].umask << 8) | pmu_events[i].event);
+	}
+}
+
+// Fold the counters into e's totals if they hold e's counts.
+void
+pmu_save(struct Env *e)
+{
+	int cpu = cpunum();
+	uint64_t now;
+	int i;
+
+	if (!pmu_ncounters || pmu_cpus[cpu].env != e || !e)
+		return;
+	for (i = 0; i < pmu_ncounters; i++) {
+		now = rdmsr(MSR_PMC0 + i);
+		e->env_pmc[i] += (now - pmu_cpus[cpu].base[i]) & pmu_mask;
+	}
+	pmu_cpus[cpu].env = NULL;
+}
+
+// Load e's counts into the counters before running it.
+void
+pmu_restore(struct Env *e)
+{
+	int cpu = cpunum();
+	uint32_t cr4;
+	int i;
+
+	// CR4.PCE gates RDPMC in ring 3.
+	cr4 = rcr4();
+	if (!!(cr4 & CR4_PCE) != e->env_rdpmc)
+		lcr4(e->env_rdpmc ? (cr4 | CR4_PCE) : (cr4 & ~CR4_PCE));
+
+	if (!pmu_ncounters || pmu_cpus[cpu].env == e)
+		return;
+	// Writes to the counters are sign-extended from bit 31.
+	for (i = 0; i < pmu_ncounters; i++) {
+		pmu_cpus[cpu].base[i] = e->env_pmc[i] & 0x7fffffff;
+		wrmsr(MSR_PMC0 + i, pmu_cpus[cpu].base[i]);
+	}
+	pmu_cpus[cpu].env = e;
+}
+
+// e is being freed; make sure no CPU adds to its slot's counts later.
+void
+pmu_release(struct Env *e)
+{
+	int i;
+
+	for (i = 0; i < NCPU; i++)
+		if (pmu_cpus[i].env == e)
+			pmu_cpus[i].env = NULL;
+}
+
+// Print the counts of every environment that has any.
+void
+pmu_print(void)
+{
+	struct Env *e;
+	int i, j;
+
+	if (!pmu_ncounters) {
+		cprintf("No performance counters\n");
+		return;
+	}
+	cprintf("  envid   ");
+	for (j = 0; j < pmu_ncounters; j++)
+		cprintf(" %14s", pmu_events[j].name);
+	cprintf("\n");
+	for (i = 0; i < nenv; i++) {
+		e = &envs[i];
+		if (e->env_status == ENV_FREE || !e->env_pmc[0])
+			continue;
+		cprintf("  %08x", e->env_id);
+		for (j = 0; j < pmu_ncounters; j++)
+			cprintf(" %14llu", e->env_pmc[j]);
+		cprintf("\n");
+	}
+}
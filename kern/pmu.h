@@ -0,0 +1,17 @@
+#ifndef JOS_KERN_PMU_H
+#define JOS_KERN_PMU_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+struct Env;
+
+void pmu_init_percpu(void);
+void pmu_save(struct Env *e);
+void pmu_restore(struct Env *e);
+void pmu_release(struct Env *e);
+void pmu_print(void);
+
+#endif	// !JOS_KERN_PMU_H
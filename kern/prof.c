@@ -0,0 +1,197 @@
+// Sampling profiler driven by the LAPIC timer.
+//
+// While enabled, every prof_interval'th timer interrupt on a CPU records
+// the interrupted EIP, and the environment it belongs to, in that CPU's
+// histogram.  Nothing is symbolized when sampling; the monitor's prof
+// command maps the samples to functions with debuginfo_eip afterwards,
+// so any kernel image can be profiled without being rebuilt.
+//
+// The kernel runs with interrupts disabled, so kernel samples only come
+// from CPUs idling in sched_halt; everything else is user time.
+//
+// The monitor only runs once every environment has exited, so to profile
+// a workload, start sampling at boot by building with PROF=n (e.g.
+// "make PROF=1 run-primes").  When the workload finishes and the kernel
+// drops into the monitor, "prof top" prints the report.  Functions of
+// environments that have exited by then can no longer be symbolized and
+// are shown by EIP; look them up in obj/user/<prog>.asm.
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/x86.h>
+
+#include <kern/cpu.h>
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/kdebug.h>
+#include <kern/prof.h>
+
+#define PROF_NBUCKETS	1024		// Distinct (envid, eip) per CPU; a power of two
+#define PROF_NFUNCS	256		// Distinct functions in a report
+
+struct ProfBucket {
+	uintptr_t eip;
+	envid_t envid;			// 0 for kernel samples
+	uint32_t count;
+};
+
+struct ProfHist {
+	uint32_t ticks;			// Timer ticks seen while enabled
+	uint32_t samples;
+	uint32_t dropped;		// Samples that found the table full
+	struct ProfBucket bucket[PROF_NBUCKETS];
+};
+
+static struct ProfHist prof_hist[NCPU];
+
+#ifndef PROF_INTERVAL
+#define PROF_INTERVAL	0
+#endif
+
+uint32_t prof_interval = PROF_INTERVAL;
+
+// Called from the timer interrupt with the interrupted trap frame.
+void
+prof_sample(struct Trapframe *tf)
+{
+	struct ProfHist *h;
+	struct ProfBucket *b;
+	envid_t envid;
+	uint32_t i, n;
+
+	if (!prof_interval)
+		return;
+	h = &prof_hist[cpunum()];
+	if (++h->ticks % prof_interval)
+		return;
+
+	h->samples++;
+	envid = ((tf->tf_cs & 3) == 3 && curenv) ? curenv->env_id : 0;
+	i = (tf->tf_eip ^ (tf->tf_eip >> 12) ^ envid) % PROF_NBUCKETS;
+	for (n = 0; n < PROF_NBUCKETS; n++, i = (i + 1) % PROF_NBUCKETS) {
+		b = &h->bucket[i];
+		if (b->count == 0) {
+			b->eip = tf->tf_eip;
+			b->envid = envid;
+		} else if (b->eip != tf->tf_eip || b->envid != envid)
+			continue;
+		b->count++;
+		return;
+	}
+	h->dropped++;
+}
+
+void
+prof_reset(void)
+{
+	memset(prof_hist, 0, sizeof(prof_hist));
+}
+
+struct ProfFunc {
+	envid_t envid;
+	uintptr_t addr;			// Function start, or the EIP if unknown
+	char name[32];
+	uint32_t count;
+};
+
+static struct ProfFunc prof_funcs[PROF_NFUNCS];
+
+// Find the function containing 'eip' in environment 'envid' (0 for the
+// kernel).  Returns false if it is unknown, for instance because the
+// environment has exited.  debuginfo_eip reads user stabs through
+// curenv and the loaded page directory, so borrow both for the lookup.
+static bool
+prof_lookup(envid_t envid, uintptr_t eip, struct Eipdebuginfo *info)
+{
+	struct Env *e, *saved;
+	uint32_t cr3;
+
+	if (envid == 0)
+		debuginfo_eip(eip, info);
+	else if (envid2env(envid, &e, 0) < 0 || e->env_status == ENV_FREE)
+		return false;
+	else {
+		saved = curenv;
+		cr3 = rcr3();
+		curenv = e;
+		lcr3(PADDR(e->env_pgdir));
+		debuginfo_eip(eip, info);
+		lcr3(cr3);
+		curenv = saved;
+	}
+	return strncmp(info->eip_fn_name, "<unknown>", info->eip_fn_namelen) != 0;
+}
+
+// Print the 'n' functions with the most samples, summed over all CPUs.
+// User functions are counted per environment.
+void
+prof_print_top(int n)
+{
+	struct Eipdebuginfo info;
+	struct ProfBucket *b;
+	struct ProfFunc *f, tmp;
+	uint32_t samples = 0, dropped = 0, other = 0;
+	int nfuncs = 0, len, i, j, cpu;
+
+	for (cpu = 0; cpu < ncpu; cpu++) {
+		samples += prof_hist[cpu].samples;
+		dropped += prof_hist[cpu].dropped;
+		for (i = 0; i < PROF_NBUCKETS; i++) {
+			b = &prof_hist[cpu].bucket[i];
+			if (b->count == 0)
+				continue;
+
+			memset(&tmp, 0, sizeof(tmp));
+			tmp.envid = b->envid;
+			if (prof_lookup(b->envid, b->eip, &info)) {
+				tmp.addr = info.eip_fn_addr;
+				len = MIN(info.eip_fn_namelen,
+					  (int) sizeof(tmp.name) - 1);
+				memmove(tmp.name, info.eip_fn_name, len);
+			} else {
+				tmp.addr = b->eip;
+				snprintf(tmp.name, sizeof(tmp.name), "%08x", b->eip);
+			}
+
+			for (j = 0; j < nfuncs; j++)
+				if (prof_funcs[j].envid == tmp.envid
+				    && prof_funcs[j].addr == tmp.addr)
+					break;
+			if (j == nfuncs) {
+				if (nfuncs == PROF_NFUNCS) {
+					other += b->count;
+					continue;
+				}
+				prof_funcs[nfuncs++] = tmp;
+			}
+			prof_funcs[j].count += b->count;
+		}
+	}
+
+	cprintf("%u samples (every %u ticks), %u dropped\n",
+		samples, prof_interval, dropped);
+	if (!samples)
+		return;
+	if (n <= 0 || n > nfuncs)
+		n = nfuncs;
+
+	// Selection sort just the top n.
+	for (i = 0; i < n; i++) {
+		for (f = &prof_funcs[i], j = i + 1; j < nfuncs; j++)
+			if (prof_funcs[j].count > f->count)
+				f = &prof_funcs[j];
+		tmp = *f;
+		*f = prof_funcs[i];
+		prof_funcs[i] = tmp;
+
+		f = &prof_funcs[i];
+		if (f->envid)
+			cprintf("  %7u %3u%%  [%08x] %s\n", f->count,
+				f->count * 100 / samples, f->envid, f->name);
+		else
+			cprintf("  %7u %3u%%  kernel     %s\n", f->count,
+				f->count * 100 / samples, f->name);
+	}
+	if (other)
+		cprintf("  %7u in functions not shown\n", other);
+}
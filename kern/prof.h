@@ -0,0 +1,18 @@
+#ifndef JOS_KERN_PROF_H
+#define JOS_KERN_PROF_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+struct Trapframe;
+
+// Sample every 'prof_interval' timer ticks; 0 disables profiling.
+extern uint32_t prof_interval;
+
+void prof_sample(struct Trapframe *tf);
+void prof_reset(void);
+void prof_print_top(int n);
+
+#endif	// !JOS_KERN_PROF_H
@@ -4,6 +4,8 @@
 #include <kern/env.h>
 #include <kern/pmap.h>
 #include <kern/monitor.h>
+#include <kern/syscall.h>
+#include <kern/ktrace.h>
 
 void sched_halt(void);
 
@@ -13,6 +15,8 @@ sched_yield(void)
 {
 	struct Env *idle;
 
+	ktrace(KT_SCHED_YIELD, curenv ? curenv->env_id : 0, 0, 0);
+
 	// Implement simple round-robin scheduling.
 	//
 	// Search through 'envs' for an ENV_RUNNABLE environment in
@@ -34,20 +38,29 @@ sched_yield(void)
   if(curenv != NULL)
     cur_id = curenv->env_id;
  
-  // loop forever
-  for(int i = 0;; i++){
-    // check the next environment, starting at the current running env:
-    if(envs[(ENVX(cur_id)+i) % NENV].env_status == ENV_RUNNABLE){
-      // run env
-      env_run(&envs[(ENVX(cur_id)+i) % NENV]);
-    }
+  // Scan; if nothing is runnable, poll the rings and scan again until
+  // a poll makes no progress.  Loop rather than calling sched_yield
+  // again, so an env that keeps its ring busy can't grow our stack.
+  for(;;){
+    for(int i = 0;; i++){
+      // check the next environment, starting at the current running env:
+      if(envs[(ENVX(cur_id)+i) % nenv].env_status == ENV_RUNNABLE){
+        // run env
+        env_run(&envs[(ENVX(cur_id)+i) % nenv]);
+      }
 
-    // if no envs are found, but curenv is still RUNNING, we can chose it
-    if(i > NENV && envs[ENVX(cur_id)].env_status == ENV_RUNNING){
-      env_run(&envs[ENVX(cur_id)]);
-    }else if(i > NENV){
-      break;  // drop through
+      // if no envs are found, but curenv is still RUNNING, we can chose it
+      if(i > nenv && envs[ENVX(cur_id)].env_status == ENV_RUNNING){
+        env_run(&envs[ENVX(cur_id)]);
+      }else if(i > nenv){
+        break;  // drop through
+      }
     }
+
+    // Before idling, run any system calls that blocked environments
+    // left in their rings; that may make something runnable.
+    if(!sysring_poll())
+      break;
   }
 
 	// sched_halt never returns
@@ -64,19 +77,20 @@ sched_halt(void)
 
 	// For debugging and testing purposes, if there are no runnable
 	// environments in the system, then drop into the kernel monitor.
-	for (i = 0; i < NENV; i++) {
+	for (i = 0; i < nenv; i++) {
 		if ((envs[i].env_status == ENV_RUNNABLE ||
 		     envs[i].env_status == ENV_RUNNING ||
 		     envs[i].env_status == ENV_DYING))
 			break;
 	}
-	if (i == NENV) {
+	if (i == nenv) {
 		cprintf("No runnable environments in the system!\n");
 		while (1)
 			monitor(NULL);
 	}
 
 	// Mark that no environment is running on this CPU
+	env_save_state();
 	curenv = NULL;
 	lcr3(PADDR(kern_pgdir));
 
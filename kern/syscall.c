@@ -11,6 +11,9 @@
 #include <kern/syscall.h>
 #include <kern/console.h>
 #include <kern/sched.h>
+#include <kern/ktrace.h>
+#include <kern/pmu.h>
+#include <kern/spinlock.h>
 
 // Print a string to the system console.
 // The string is exactly 'len' characters long.
@@ -25,7 +28,7 @@ sys_cputs(const char *s, size_t len)
   user_mem_assert(curenv, s, len, PTE_U | PTE_P);
 
 	// Print the string supplied by the user.
-	cprintf("%.*s", len, s);
+	cons_write(s, len);
 }
 
 // Read a character from the system console without blocking.
@@ -92,7 +95,13 @@ sys_exofork(void)
 
   // set up runnable status and registers
   new_env->env_status = ENV_NOT_RUNNABLE;
-  new_env->env_tf = curenv->env_tf;
+  new_env->env_tf = *env_cur_tf();
+
+  // children are held to their parent's quota
+  new_env->env_page_quota = curenv->env_page_quota;
+
+  // and its FPU state
+  env_fpu_copy(new_env);
 
   // set child return (ty yeongjin)
   new_env->env_tf.tf_regs.reg_eax = 0;
@@ -158,6 +167,52 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
   return 0;
 }
 
+// Ask the kernel to resolve copy-on-write faults for 'envid' itself.
+// When 'enable' is set, a write fault on a PTE_COW page is handled by
+// page_cow() and the environment resumes without its page fault upcall
+// being invoked.  Other faults still go to the upcall.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+static int
+sys_env_set_cow(envid_t envid, int enable)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+	e->env_kern_cow = (enable != 0);
+	return 0;
+}
+
+// Limit 'envid' to 'npages' physical pages, counting both the user
+// pages it maps and the page tables needed to map them; 0 removes the
+// limit.  Children created by sys_exofork inherit their parent's quota.
+// A quota-limited caller can't grant more than its own quota, so a
+// runaway environment can't lift the limit on itself or its children.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if the caller is quota-limited and 'npages' exceeds
+//		its own quota.
+static int
+sys_env_set_quota(envid_t envid, uint32_t npages)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+	if (curenv->env_page_quota
+	    && (npages == 0 || npages > curenv->env_page_quota))
+		return -E_INVAL;
+	e->env_page_quota = npages;
+	return 0;
+}
+
 // Allocate a page of memory and map it at 'va' with permission
 // 'perm' in the address space of 'envid'.
 // The page's contents are set to 0.
@@ -170,7 +225,7 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
 // Return 0 on success, < 0 on error.  Errors are:
 //	-E_BAD_ENV if environment envid doesn't currently exist,
 //		or the caller doesn't have permission to change envid.
-//	-E_INVAL if va >= UTOP, or va is not page-aligned.
+//	-E_INVAL if va >= UTOP, or va is not page-aligned, or va is UINFO.
 //	-E_INVAL if perm is inappropriate (see above).
 //	-E_NO_MEM if there's no memory to allocate the new page,
 //		or to allocate any necessary page tables.
@@ -188,6 +243,8 @@ sys_page_alloc(envid_t envid, void *va, int perm)
   // verify va is safe
   if((uint32_t)va >= UTOP || (uint32_t)va % PGSIZE != 0)
     return -E_INVAL;
+  if((uint32_t)va == UINFO)
+    return -E_INVAL;    // kernel owns the info page
 
   // check perms
   //ty yeongjin :)
@@ -199,10 +256,14 @@ sys_page_alloc(envid_t envid, void *va, int perm)
   int error = envid2env(envid, &target_env, 1);
   if(error != 0)
     return -E_BAD_ENV;   // bad perms or does not exist
+
+  // stay within the target's page quota
+  if(env_page_charge(target_env, va) < 0)
+    return -E_NO_MEM;
   
   // grab phys page
   struct PageInfo* pp;
-  pp = page_alloc(ALLOC_ZERO);
+  pp = page_alloc(ALLOC_ZERO | ALLOC_HIGH);
   //pp = page_alloc(0);
   if(pp == NULL)
     return -E_NO_MEM;
@@ -229,7 +290,7 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 //	-E_BAD_ENV if srcenvid and/or dstenvid doesn't currently exist,
 //		or the caller doesn't have permission to change one of them.
 //	-E_INVAL if srcva >= UTOP or srcva is not page-aligned,
-//		or dstva >= UTOP or dstva is not page-aligned.
+//		or dstva >= UTOP or dstva is not page-aligned or is UINFO.
 //	-E_INVAL is srcva is not mapped in srcenvid's address space.
 //	-E_INVAL if perm is inappropriate (see sys_page_alloc).
 //	-E_INVAL if (perm & PTE_W), but srcva is read-only in srcenvid's
@@ -253,6 +314,8 @@ sys_page_map(envid_t srcenvid, void *srcva,
     return -E_INVAL;
   if((uint32_t)dstva >= UTOP || (uint32_t)dstva % PGSIZE != 0)
     return -E_INVAL;
+  if((uint32_t)dstva == UINFO)
+    return -E_INVAL;    // kernel owns the info page
 
   // check perms (ty yeongjin)
   if((perm & 0xfff) & (~PTE_SYSCALL))
@@ -277,6 +340,10 @@ sys_page_map(envid_t srcenvid, void *srcva,
   if(!(*srcpte & PTE_W) && (perm & PTE_W))
     return -E_INVAL; // attempting to insert a write link to a R/O page
 
+  // stay within the destination's page quota
+  if(env_page_charge(dstenv, dstva) < 0)
+    return -E_NO_MEM;
+
   // insert into dest table
   error = page_insert(dstenv->env_pgdir, pp, dstva, perm);
   if(error != 0)
@@ -292,7 +359,7 @@ sys_page_map(envid_t srcenvid, void *srcva,
 // Return 0 on success, < 0 on error.  Errors are:
 //	-E_BAD_ENV if environment envid doesn't currently exist,
 //		or the caller doesn't have permission to change envid.
-//	-E_INVAL if va >= UTOP, or va is not page-aligned.
+//	-E_INVAL if va >= UTOP, or va is not page-aligned, or va is UINFO.
 static int
 sys_page_unmap(envid_t envid, void *va)
 {
@@ -302,6 +369,8 @@ sys_page_unmap(envid_t envid, void *va)
   // verify va is safe
   if((uint32_t)va >= UTOP || (uint32_t)va % PGSIZE != 0)
     return -E_INVAL;
+  if((uint32_t)va == UINFO)
+    return -E_INVAL;    // kernel owns the info page
 
   // grab current env
   struct Env* target_env;
@@ -315,6 +384,30 @@ sys_page_unmap(envid_t envid, void *va)
   return 0;
 }
 
+// Make the copy-on-write page at 'va' in 'envid's address space writable
+// in place, provided that mapping is the only reference to the page.
+// This lets a COW fault handler that finds pp_ref == 1 (through the
+// read-only pages[] array at UPAGES) skip the allocate-and-copy.
+// The kernel re-checks the reference count, so a stale read is harmless.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if va >= UTOP, or va is not page-aligned.
+//	-E_INVAL if va is not mapped copy-on-write, or the page is shared.
+static int
+sys_page_reuse(envid_t envid, void *va)
+{
+	struct Env *e;
+	int r;
+
+	if ((uintptr_t) va >= UTOP || PGOFF(va))
+		return -E_INVAL;
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+	return page_cow_reuse(e->env_pgdir, va);
+}
+
 // Try to send 'value' to the target env 'envid'.
 // If srcva < UTOP, then also send page currently mapped at 'srcva',
 // so that receiver gets a duplicate mapping of the same page.
@@ -415,6 +508,10 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
     if((perm & PTE_W) && (*pte & PTE_W) == 0)
       return -E_INVAL;
 
+    // receiver pays for the mapping
+    if(env_page_charge(target_env, target_env->env_ipc_dstva) < 0)
+      return -E_NO_MEM;
+
     // finally, copy page
     error = page_insert(target_env->env_pgdir, pp, target_env->env_ipc_dstva, perm);
     if(error != 0)
@@ -440,7 +537,7 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 // This function only returns on error, but the system call will eventually
 // return 0 on success.
 // Return < 0 on error.  Errors are:
-//	-E_INVAL if dstva < UTOP but dstva is not page-aligned.
+//	-E_INVAL if dstva < UTOP but dstva is not page-aligned, or is UINFO.
 static int
 sys_ipc_recv(void *dstva)
 {
@@ -449,25 +546,174 @@ sys_ipc_recv(void *dstva)
   // dstav not page alligned
   if((((uint32_t)dstva % PGSIZE) != 0) && ((uint32_t)dstva < UTOP))
     return -E_INVAL;
+  if((uint32_t)dstva == UINFO)
+    return -E_INVAL;    // kernel owns the info page
 
   // mark as wanting to receive at dstva, then block
 	curenv->env_ipc_recving = 1;
   curenv->env_ipc_dstva = dstva;
   curenv->env_status = ENV_NOT_RUNNABLE;
   //ty yeongjin
-  curenv->env_tf.tf_regs.reg_eax = 0;
+  env_cur_tf()->tf_regs.reg_eax = 0;
   sched_yield();
 
   // after being woken up
 	return 0;
 }
 
+// System calls that never block, yield or look at curenv->env_tf.
+// These can complete on the SYSENTER fast path and from a Sysring.
+static bool
+syscall_nonblocking(uint32_t num)
+{
+	switch (num) {
+	case SYS_cputs:
+	case SYS_cgetc:
+	case SYS_getenvid:
+	case SYS_env_set_status:
+	case SYS_page_alloc:
+	case SYS_page_map:
+	case SYS_page_unmap:
+	case SYS_env_set_pgfault_upcall:
+	case SYS_ipc_try_send:
+	case SYS_env_set_cow:
+	case SYS_page_reuse:
+	case SYS_env_set_quota:
+	case SYS_ring_setup:
+	case SYS_ring_enter:
+	case SYS_env_set_trace:
+	case SYS_env_set_rdpmc:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+// Run up to SYSRING_SIZE requests queued in e's Sysring, which must be
+// curenv with its address space loaded, posting a completion for each.
+// Stops early if the completion ring is full.
+// Returns the number of requests completed.
+static int
+sysring_run(struct Env *e)
+{
+	struct Sysring *sr = e->env_ring;
+	struct SysringSqe sqe;
+	struct SysringCqe *cqe;
+	int n;
+
+	for (n = 0; n < SYSRING_SIZE; n++) {
+		if (sr->sr_sq_head == sr->sr_sq_tail
+		    || sr->sr_cq_tail - sr->sr_cq_head >= SYSRING_SIZE)
+			break;
+
+		// Copy the request; the environment may scribble on it.
+		sqe = sr->sr_sq[sr->sr_sq_head % SYSRING_SIZE];
+		sr->sr_sq_head++;
+
+		cqe = &sr->sr_cq[sr->sr_cq_tail % SYSRING_SIZE];
+		cqe->cqe_tag = sqe.sqe_tag;
+		if (!syscall_nonblocking(sqe.sqe_num)
+		    || sqe.sqe_num == SYS_ring_setup
+		    || sqe.sqe_num == SYS_ring_enter)
+			cqe->cqe_ret = -E_INVAL;
+		else
+			cqe->cqe_ret = syscall(sqe.sqe_num, sqe.sqe_args[0],
+					       sqe.sqe_args[1], sqe.sqe_args[2],
+					       sqe.sqe_args[3], sqe.sqe_args[4]);
+		sr->sr_cq_tail++;
+	}
+	return n;
+}
+
+// Log every system call 'envid' makes to the kernel's trace ring
+// (see the monitor's strace command) while 'enable' is set.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+static int
+sys_env_set_trace(envid_t envid, int enable)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+	e->env_trace = (enable != 0);
+	return 0;
+}
+
+// Allow 'envid' to read the hardware performance counters with RDPMC
+// while 'enable' is set.  See kern/pmu.c for what they count.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+static int
+sys_env_set_rdpmc(envid_t envid, int enable)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+	e->env_rdpmc = (enable != 0);
+	// Takes effect the next time e is switched to, except for the
+	// caller itself.
+	if (e == curenv)
+		pmu_restore(e);
+	return 0;
+}
+
+// Set up an asynchronous system call ring for the calling environment,
+// mapped read/write at USYSRING.  See struct Sysring in inc/syscall.h.
+// The kernel keeps its own reference to the page, so unmapping it only
+// takes it away from the environment.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if the environment already has a ring.
+//	-E_NO_MEM if there's no memory (or quota) for the ring.
+static int
+sys_ring_setup(void)
+{
+	struct PageInfo *pp;
+
+	if (curenv->env_ring)
+		return -E_INVAL;
+	if (env_page_charge(curenv, (void *) USYSRING) < 0
+	    || !(pp = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+	if (page_insert(curenv->env_pgdir, pp, (void *) USYSRING,
+			PTE_P | PTE_U | PTE_W) < 0) {
+		page_free(pp);
+		return -E_NO_MEM;
+	}
+	pp->pp_ref++;
+	curenv->env_ring = page2kva(pp);
+	return 0;
+}
+
+// Run the requests queued in the calling environment's ring.
+// Only non-blocking system calls may be queued; others, and nested
+// ring calls, complete with -E_INVAL.
+//
+// Returns the number of requests completed, or -E_INVAL if the
+// environment has no ring.
+static int
+sys_ring_enter(void)
+{
+	if (!curenv->env_ring)
+		return -E_INVAL;
+	return sysring_run(curenv);
+}
+
 // Dispatches to the correct kernel function, passing the arguments.
-int32_t
-syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+static int32_t
+syscall_dispatch(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
 {
 	// Call the function corresponding to the 'syscallno' parameter.
 	// Return any appropriate return value.
+	int32_t r;
 
 	switch (syscallno) {
   case SYS_cputs:
@@ -495,11 +741,263 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
   case SYS_env_set_pgfault_upcall:
     return sys_env_set_pgfault_upcall((envid_t) a1, (void*) a2);
   case SYS_ipc_try_send:
-    return sys_ipc_try_send((envid_t) a1, (uint32_t) a2, (void*) a3, (unsigned) a4);
+    r = sys_ipc_try_send((envid_t) a1, (uint32_t) a2, (void*) a3, (unsigned) a4);
+    ktrace(KT_IPC_SEND, a1, a2, r);
+    return r;
   case SYS_ipc_recv:
+    ktrace(KT_IPC_RECV, a1, 0, 0);
     return sys_ipc_recv((void*) a1);
+  case SYS_env_set_cow:
+    return sys_env_set_cow((envid_t) a1, (int) a2);
+  case SYS_page_reuse:
+    return sys_page_reuse((envid_t) a1, (void*) a2);
+  case SYS_env_set_quota:
+    return sys_env_set_quota((envid_t) a1, (uint32_t) a2);
+  case SYS_ring_setup:
+    return sys_ring_setup();
+  case SYS_ring_enter:
+    return sys_ring_enter();
+  case SYS_env_set_trace:
+    return sys_env_set_trace((envid_t) a1, (int) a2);
+  case SYS_env_set_rdpmc:
+    return sys_env_set_rdpmc((envid_t) a1, (int) a2);
 	default:
 		return -E_INVAL;
 	}
 }
 
+//
+// System call statistics and tracing.
+//
+// Every call through syscall() is counted per CPU and per system call
+// number, so CPUs never write to the same counters.  Calls made by
+// environments with env_trace set are also logged to a ring buffer.
+// Calls that give up the CPU (sys_yield, sys_ipc_recv, destroying
+// oneself) never return here, so they are counted and traced but not
+// timed.  The monitor's sysstats and strace commands report both.
+//
+
+static const char * const syscall_names[NSYSCALLS] = {
+	[SYS_cputs]			= "cputs",
+	[SYS_cgetc]			= "cgetc",
+	[SYS_getenvid]			= "getenvid",
+	[SYS_env_destroy]		= "env_destroy",
+	[SYS_page_alloc]		= "page_alloc",
+	[SYS_page_map]			= "page_map",
+	[SYS_page_unmap]		= "page_unmap",
+	[SYS_exofork]			= "exofork",
+	[SYS_env_set_status]		= "env_set_status",
+	[SYS_env_set_pgfault_upcall]	= "env_set_pgfault_upcall",
+	[SYS_yield]			= "yield",
+	[SYS_ipc_try_send]		= "ipc_try_send",
+	[SYS_ipc_recv]			= "ipc_recv",
+	[SYS_env_set_cow]		= "env_set_cow",
+	[SYS_page_reuse]		= "page_reuse",
+	[SYS_env_set_quota]		= "env_set_quota",
+	[SYS_ring_setup]		= "ring_setup",
+	[SYS_ring_enter]		= "ring_enter",
+	[SYS_env_set_trace]		= "env_set_trace",
+	[SYS_env_set_rdpmc]		= "env_set_rdpmc",
+};
+
+struct SyscallStat {
+	uint32_t calls;			// Times called
+	uint32_t errors;		// Times returned < 0
+	uint32_t timed;			// Times returned at all
+	uint64_t cycles;		// Total TSC cycles of timed calls
+	uint64_t max;			// Longest timed call
+};
+
+// Per CPU, each on its own cache lines since every system call writes
+// them.
+static struct SyscallCpu {
+	struct SyscallStat stat[NSYSCALLS];
+} __attribute__((aligned(CACHELINE))) syscall_stats[NCPU];
+
+#define STRACE_SIZE	256		// Trace entries kept; a power of two
+
+struct StraceEntry {
+	envid_t envid;
+	uint32_t num;
+	uint32_t args[5];
+	int32_t ret;
+	uint64_t cycles;		// 0 if the call didn't return
+};
+
+static struct StraceEntry strace_ring[STRACE_SIZE];
+static uint32_t strace_next;		// Total entries ever logged
+
+int32_t
+syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	struct SyscallStat *st = NULL;
+	struct StraceEntry *te = NULL;
+	uint32_t seq = 0;
+	uint64_t t0, dt;
+	int32_t ret;
+
+	if (syscallno < NSYSCALLS) {
+		st = &syscall_stats[cpunum()].stat[syscallno];
+		st->calls++;
+	}
+	if (curenv && curenv->env_trace) {
+		seq = strace_next++;
+		te = &strace_ring[seq % STRACE_SIZE];
+		te->envid = curenv->env_id;
+		te->num = syscallno;
+		te->args[0] = a1;
+		te->args[1] = a2;
+		te->args[2] = a3;
+		te->args[3] = a4;
+		te->args[4] = a5;
+		te->ret = 0;
+		te->cycles = 0;
+	}
+
+	t0 = read_tsc();
+	ret = syscall_dispatch(syscallno, a1, a2, a3, a4, a5);
+	dt = read_tsc() - t0;
+
+	if (st) {
+		if (ret < 0)
+			st->errors++;
+		st->timed++;
+		st->cycles += dt;
+		if (dt > st->max)
+			st->max = dt;
+	}
+	// Skip the entry if the call was long enough for it to be reused.
+	if (te && strace_next - seq <= STRACE_SIZE) {
+		te->ret = ret;
+		te->cycles = dt;
+	}
+	return ret;
+}
+
+static const char *
+syscall_name(uint32_t num)
+{
+	if (num < NSYSCALLS && syscall_names[num])
+		return syscall_names[num];
+	return "?";
+}
+
+// Print call counts, errors and cycles per system call, summed over
+// all CPUs.
+void
+syscall_stats_print(void)
+{
+	struct SyscallStat sum;
+	int num, i;
+
+	cprintf("%-24s %8s %6s %10s %10s\n",
+		"syscall", "calls", "errors", "avg cyc", "max cyc");
+	for (num = 0; num < NSYSCALLS; num++) {
+		memset(&sum, 0, sizeof(sum));
+		for (i = 0; i < NCPU; i++) {
+			sum.calls += syscall_stats[i].stat[num].calls;
+			sum.errors += syscall_stats[i].stat[num].errors;
+			sum.timed += syscall_stats[i].stat[num].timed;
+			sum.cycles += syscall_stats[i].stat[num].cycles;
+			if (syscall_stats[i].stat[num].max > sum.max)
+				sum.max = syscall_stats[i].stat[num].max;
+		}
+		if (!sum.calls)
+			continue;
+		cprintf("%-24s %8u %6u %10llu %10llu\n", syscall_name(num),
+			sum.calls, sum.errors,
+			sum.timed ? sum.cycles / sum.timed : 0, sum.max);
+	}
+}
+
+void
+syscall_stats_reset(void)
+{
+	memset(syscall_stats, 0, sizeof(syscall_stats));
+	strace_next = 0;
+}
+
+// Print the last 'n' traced system calls, oldest first.
+void
+syscall_trace_print(int n)
+{
+	struct StraceEntry *te;
+	uint32_t seq;
+
+	if (n <= 0 || n > STRACE_SIZE)
+		n = STRACE_SIZE;
+	if (n > strace_next)
+		n = strace_next;
+	for (seq = strace_next - n; seq != strace_next; seq++) {
+		te = &strace_ring[seq % STRACE_SIZE];
+		cprintf("[%08x] %s(%x, %x, %x, %x, %x) = %d  %llu cyc\n",
+			te->envid, syscall_name(te->num),
+			te->args[0], te->args[1], te->args[2],
+			te->args[3], te->args[4], te->ret, te->cycles);
+	}
+}
+
+
+// Called by sched_yield when there is nothing to run: drain the rings
+// of environments that queued requests and then blocked.  Runs each
+// environment's requests as that environment.  Afterwards this CPU runs
+// no environment and has kern_pgdir loaded.
+// Returns the number of requests completed.
+int
+sysring_poll(void)
+{
+	struct Env *e;
+	int i, n = 0;
+
+	env_save_state();
+	for (i = 0; i < nenv; i++) {
+		e = &envs[i];
+		if (!e->env_ring || e->env_status != ENV_NOT_RUNNABLE
+		    || e->env_ring->sr_sq_head == e->env_ring->sr_sq_tail)
+			continue;
+		curenv = e;
+		lcr3(PADDR(e->env_pgdir));
+		n += sysring_run(e);
+	}
+	curenv = NULL;
+	lcr3(PADDR(kern_pgdir));
+	return n;
+}
+
+// Called from sysenter_handler in kern/trapentry.S with a Trapframe
+// built on the kernel stack.  System calls that neither block, yield
+// nor look at curenv->env_tf run right here, and the result goes back
+// to user mode with SYSEXIT, skipping the copy into curenv->env_tf and
+// the iret in env_pop_tf.  Everything else is handed to trap(), which
+// finishes the call exactly as if it had come through int $T_SYSCALL.
+int32_t
+syscall_sysenter(struct Trapframe *tf)
+{
+	struct PushRegs *r = &tf->tf_regs;
+	int32_t ret;
+
+	lock_kernel();
+
+	// The user stub left its return address on top of its stack.
+	user_mem_assert(curenv, (void *) tf->tf_esp, sizeof(uintptr_t), PTE_U);
+	tf->tf_eip = *(uintptr_t *) tf->tf_esp;
+	tf->tf_eflags |= FL_IF;
+
+	if (!syscall_nonblocking(r->reg_eax) || curenv->env_status == ENV_DYING) {
+		unlock_kernel();
+		trap(tf);
+	}
+
+	ret = syscall(r->reg_eax, r->reg_edx, r->reg_ecx,
+		      r->reg_ebx, r->reg_edi, r->reg_esi);
+	if (curenv->env_status == ENV_RUNNING) {
+		unlock_kernel();
+		return ret;
+	}
+
+	// The call stopped us (sys_env_set_status on ourselves, say), so
+	// leave the way trap() would.
+	r->reg_eax = ret;
+	thiscpu->cpu_tf = tf;
+	sched_yield();
+}
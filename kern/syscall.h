@@ -5,7 +5,14 @@
 #endif
 
 #include <inc/syscall.h>
+#include <inc/trap.h>
 
 int32_t syscall(uint32_t num, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5);
+int32_t syscall_sysenter(struct Trapframe *tf);
+int sysring_poll(void);
+
+void syscall_stats_print(void);
+void syscall_stats_reset(void);
+void syscall_trace_print(int n);
 
 #endif /* !JOS_KERN_SYSCALL_H */
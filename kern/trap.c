@@ -11,6 +11,8 @@
 #include <kern/sched.h>
 #include <kern/kclock.h>
 #include <kern/picirq.h>
+#include <kern/ktrace.h>
+#include <kern/prof.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
 
@@ -88,6 +90,7 @@ void t_mchk();
 void t_simderr();
 void t_syscall();
 void t_default();
+void sysenter_handler();
 
 // lab 4 irq shit
 void t_irq_timer();
@@ -209,6 +212,15 @@ trap_init_percpu(void)
 	ltr(GD_TSS0 + (thiscpu->cpu_id << 3)); // thank you based yeongjin
 	lidt(&idt_pd);
 
+	// Point SYSENTER at this CPU's kernel stack, if the CPU has it.
+	uint32_t edx;
+	cpuid(1, NULL, NULL, NULL, &edx);
+	if (edx & CPUID_SEP) {
+		wrmsr(MSR_SYSENTER_CS, GD_KT);
+		wrmsr(MSR_SYSENTER_ESP, thiscpu->cpu_ts.ts_esp0);
+		wrmsr(MSR_SYSENTER_EIP, (uint32_t) sysenter_handler);
+	}
+
 	// Setup a TSS so that we get the right stack
 	// when we trap to the kernel.
 	//ts.ts_esp0 = KSTACKTOP;
@@ -289,14 +301,28 @@ trap_dispatch(struct Trapframe *tf)
     case T_PGFLT:
       page_fault_handler(tf);
       return;
+    case T_DEVICE:
+      // first FPU use since this env was switched to
+      if((tf->tf_cs & 3) == 3 && env_fpu_trap() == 0)
+        return;
+      break;
     case T_SYSCALL: ; // for compiler
       int32_t ret = syscall(tf->tf_regs.reg_eax, tf->tf_regs.reg_edx, tf->tf_regs.reg_ecx, tf->tf_regs.reg_ebx, tf->tf_regs.reg_edi, tf->tf_regs.reg_esi);
       tf->tf_regs.reg_eax = ret;
       return;
     case (IRQ_OFFSET + IRQ_TIMER):
+      thiscpu->cpu_ticks++;
+      prof_sample(tf);
+      if(curenv){
+        curenv->env_uinfo->ui_ticks = thiscpu->cpu_ticks;
+        curenv->env_uinfo->ui_env_ticks++;
+      }
       lapic_eoi();
       sched_yield();
       return;
+    case (IRQ_OFFSET + IRQ_SERIAL):
+      serial_intr();
+      return;
     default:
       break;
   }
@@ -345,6 +371,8 @@ trap(struct Trapframe *tf)
 	// the interrupt path.
 	assert(!(read_eflags() & FL_IF));
 
+	ktrace(KT_TRAP, tf->tf_trapno, tf->tf_eip, tf->tf_err);
+
 	if ((tf->tf_cs & 3) == 3) {
 		// Trapped from user mode.
 		// Acquire the big kernel lock before doing any
@@ -360,12 +388,10 @@ trap(struct Trapframe *tf)
 			sched_yield();
 		}
 
-		// Copy trap frame (which is currently on the stack)
-		// into 'curenv->env_tf', so that running the environment
-		// will restart at the trap point.
-		curenv->env_tf = *tf;
-		// The trapframe on the stack should be ignored from here on.
-		tf = &curenv->env_tf;
+		// Leave the trap frame on the kernel stack; env_run
+		// resumes curenv from it, and it is copied into
+		// 'curenv->env_tf' only if curenv is descheduled.
+		thiscpu->cpu_tf = tf;
 	}
 
 	// Record that tf is the last real trapframe so
@@ -392,6 +418,7 @@ page_fault_handler(struct Trapframe *tf)
 
 	// Read processor's CR2 register to find the faulting address
 	fault_va = rcr2();
+	ktrace(KT_PGFAULT, fault_va, tf->tf_eip, tf->tf_err);
 
 	// Handle kernel-mode page faults.
 
@@ -428,10 +455,19 @@ page_fault_handler(struct Trapframe *tf)
 	//
 	// Hints:
 	//   user_mem_assert() and env_run() are useful here.
-	//   To change what the user environment runs, modify 'curenv->env_tf'
-	//   (the 'tf' variable points at 'curenv->env_tf').
+	//   To change what the user environment runs, modify 'tf'
+	//   (the trap frame env_run will resume curenv from).
 
 	// LAB 4: Your code here.
+  // Environments that opted into kernel-handled copy-on-write get
+  // their COW write faults resolved here and resume directly,
+  // skipping the upcall and the three syscalls lib/fork.c would make.
+  // Anything else (including an out-of-memory copy) falls through
+  // to the upcall as before.
+  if(curenv->env_kern_cow && (tf->tf_err & (FEC_WR | FEC_PR)) == (FEC_WR | FEC_PR)
+     && page_cow(curenv->env_pgdir, (void*) fault_va) == 0)
+    env_run(curenv);
+
   // check if there's no pgfault upcall registered
   if(curenv->env_pgfault_upcall == NULL){
     // Destroy the environment that caused the fault.
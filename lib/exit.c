@@ -4,6 +4,7 @@
 void
 exit(void)
 {
+	bflush();
 	sys_env_destroy(0);
 }
 
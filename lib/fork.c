@@ -3,10 +3,6 @@
 #include <inc/string.h>
 #include <inc/lib.h>
 
-// PTE_COW marks copy-on-write page table entries.
-// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
-#define PTE_COW		0x800
-
 //
 // Custom page fault handler - if faulting page is copy-on-write,
 // map in our own private writable copy.
@@ -33,6 +29,14 @@ pgfault(struct UTrapframe *utf)
   }
 
 
+	// If nobody else maps this page any more (say, the other side of
+	// the fork has exited), ask the kernel to make our mapping
+	// writable in place instead of copying.  pages[] is the kernel's
+	// read-only PageInfo array at UPAGES; the kernel re-checks pp_ref.
+	if (pages[PGNUM(PTE_ADDR(uvpt[PGNUM(addr)]))].pp_ref == 1
+	    && sys_page_reuse(0, ROUNDDOWN(addr, PGSIZE)) == 0)
+		return;
+
 	// Allocate a new page, map it at a temporary location (PFTEMP),
 	// copy the data from the old page to the new page, then move the new
 	// page to the old page's address.
@@ -44,7 +48,7 @@ pgfault(struct UTrapframe *utf)
 	if ((r = sys_page_alloc(0, (void*)PFTEMP, PTE_P|PTE_U|PTE_W)) < 0)
 		panic("sys_page_alloc: %e", r);
   // move mem to temp page
-  memcpy(PFTEMP, (void*)PTE_ADDR(addr), PGSIZE);
+  page_copy(PFTEMP, (void*)PTE_ADDR(addr));
   // insert new mapping and free 
 	if ((r = sys_page_map(0, (void*)PFTEMP, 0, (void*)PTE_ADDR(addr), PTE_P|PTE_U|PTE_W)) < 0)
 		panic("sys_page_map: %e", r);
@@ -114,6 +118,13 @@ fork(void)
 
   // install pgfault handler
   set_pgfault_handler(&pgfault);
+  // ...but let the kernel resolve COW faults directly when it can;
+  // pgfault only sees them if the kernel declines.
+  if ((r = sys_env_set_cow(0, 1)) < 0)
+    panic("sys_env_set_cow: %e", r);
+  // The child gets a copy of our stdout buffer; empty it first so
+  // its contents aren't printed twice.
+  bflush();
 
 	// Allocate a new child environment.
 	// The kernel will initialize it with a copy of our register state,
@@ -128,7 +139,7 @@ fork(void)
 		// The copied value of the global variable 'thisenv'
 		// is no longer valid (it refers to the parent!).
 		// Fix it and return 0.
-		thisenv = &envs[ENVX(sys_getenvid())];
+		thisenv = &envs[ENVX(uinfo_envid())];
 		return 0;
 	}
 
@@ -151,6 +162,8 @@ fork(void)
 
   // set pgfault upacll to handle cow
   sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  if ((r = sys_env_set_cow(envid, 1)) < 0)
+    panic("sys_env_set_cow: %e", r);
 
 	// Also copy the stack we are currently running on.
 	duppage(envid, ((uint32_t)ROUNDDOWN(&addr, PGSIZE)) / PGSIZE);
@@ -76,8 +76,14 @@ envid_t
 ipc_find_env(enum EnvType type)
 {
 	int i;
-	for (i = 0; i < NENV; i++)
+
+	// The kernel maps envs[] at UENVS only as far as it has grown
+	// the table, in order, so stop at the first unmapped slot.
+	for (i = 0; i < NENV; i++) {
+		if (!(uvpt[PGNUM((uintptr_t) &envs[i + 1] - 1)] & PTE_P))
+			break;
 		if (envs[i].env_type == type)
 			return envs[i].env_id;
+	}
 	return 0;
 }
@@ -13,7 +13,7 @@ libmain(int argc, char **argv)
 {
 	// set thisenv to point at our Env structure in envs[].
 	// LAB 3: Your code here.
-	thisenv = &envs[ENVX(sys_getenvid())];
+	thisenv = &envs[ENVX(uinfo_envid())];
 
 	// save the name of the program so that panic() can use it
 	if (argc > 0)
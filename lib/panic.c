@@ -13,6 +13,9 @@ _panic(const char *file, int line, const char *fmt, ...)
 
 	va_start(ap, fmt);
 
+	// Get buffered output out first, so it precedes the message
+	bflush();
+
 	// Print the panic message
 	cprintf("[%08x] user panic in %s at %s:%d: ",
 		sys_getenvid(), binaryname, file, line);
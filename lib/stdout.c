@@ -0,0 +1,80 @@
+// Buffered console output for user environments.
+//
+// Unlike cprintf, which makes one sys_cputs call per call to cprintf,
+// bprintf collects output in a per-environment buffer and only enters
+// the kernel when the buffer fills or bflush is called.  exit() and
+// fork() flush it, so nothing is lost or printed twice; panic() flushes
+// it so the panic message comes out after anything printed before it.
+//
+// Output from cprintf is not ordered with respect to buffered output
+// that has not been flushed yet.
+
+#include <inc/types.h>
+#include <inc/stdio.h>
+#include <inc/stdarg.h>
+#include <inc/lib.h>
+
+#define STDOUT_BUFSIZE	1024
+
+static struct {
+	size_t len;
+	char buf[STDOUT_BUFSIZE];
+} outbuf;
+
+void
+bflush(void)
+{
+	if (outbuf.len > 0) {
+		sys_cputs(outbuf.buf, outbuf.len);
+		outbuf.len = 0;
+	}
+}
+
+static void
+bputch(int ch, int *cnt)
+{
+	outbuf.buf[outbuf.len++] = ch;
+	if (outbuf.len >= STDOUT_BUFSIZE)
+		bflush();
+	(*cnt)++;
+}
+
+int
+vbprintf(const char *fmt, va_list ap)
+{
+	int cnt = 0;
+
+	vprintfmt((void*)bputch, &cnt, fmt, ap);
+	return cnt;
+}
+
+int
+bprintf(const char *fmt, ...)
+{
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+	cnt = vbprintf(fmt, ap);
+	va_end(ap);
+
+	return cnt;
+}
+
+// Write exactly 'len' bytes of 's' to the buffered output.
+void
+bwrite(const char *s, size_t len)
+{
+	// Large writes skip the buffer rather than being copied through it.
+	// A write that exactly fills the buffer flushes first too, so the
+	// buffer is never left full for bputch to overrun.
+	if (outbuf.len + len >= STDOUT_BUFSIZE) {
+		bflush();
+		if (len >= STDOUT_BUFSIZE) {
+			sys_cputs(s, len);
+			return;
+		}
+	}
+	memcpy(outbuf.buf + outbuf.len, s, len);
+	outbuf.len += len;
+}
@@ -1,6 +1,8 @@
 // Basic string routines.  Not hardware optimized, but not shabby.
 
 #include <inc/string.h>
+#include <inc/mmu.h>
+#include <inc/x86.h>
 
 // Using assembly for memset/memmove
 // makes some difference on real hardware,
@@ -118,26 +120,94 @@ strfind(const char *s, char c)
 }
 
 #if ASM
+// Below this many bytes the head/tail bookkeeping costs more than
+// it saves, so the string ops just use a single byte-wise rep.
+#define ALIGN_THRESH	16
+
 void *
 memset(void *v, int c, size_t n)
 {
 	char *p;
+	size_t head, words;
 
-	if (n == 0)
-		return v;
-	if ((int)v%4 == 0 && n%4 == 0) {
-		c &= 0xFF;
-		c = (c<<24)|(c<<16)|(c<<8)|c;
-		asm volatile("cld; rep stosl\n"
-			:: "D" (v), "a" (c), "c" (n/4)
-			: "cc", "memory");
-	} else
+	p = v;
+	c &= 0xFF;
+	if (n >= ALIGN_THRESH) {
+		// Store single bytes until 'p' is 4-byte aligned,
+		// then fill the bulk a word at a time.
+		head = -(uint32_t) p & 3;
+		n -= head;
+		words = n / 4;
+		n &= 3;
 		asm volatile("cld; rep stosb\n"
-			:: "D" (v), "a" (c), "c" (n)
+			: "+D" (p), "+c" (head)
+			: "a" (c)
+			: "cc", "memory");
+		asm volatile("rep stosl\n"
+			: "+D" (p), "+c" (words)
+			: "a" ((c<<24)|(c<<16)|(c<<8)|c)
 			: "cc", "memory");
+	}
+	// Whatever is left is the unaligned tail (or a short buffer).
+	asm volatile("cld; rep stosb\n"
+		: "+D" (p), "+c" (n)
+		: "a" (c)
+		: "cc", "memory");
 	return v;
 }
 
+// Copy forward.  Bytes are moved until 'd' is 4-byte aligned,
+// then words; the processor tolerates a misaligned source far
+// better than a misaligned destination.
+static void
+copy_fwd(char *d, const char *s, size_t n)
+{
+	size_t head, words;
+
+	if (n >= ALIGN_THRESH) {
+		head = -(uint32_t) d & 3;
+		n -= head;
+		words = n / 4;
+		n &= 3;
+		asm volatile("cld; rep movsb\n"
+			: "+D" (d), "+S" (s), "+c" (head) : : "cc", "memory");
+		asm volatile("rep movsl\n"
+			: "+D" (d), "+S" (s), "+c" (words) : : "cc", "memory");
+	}
+	asm volatile("cld; rep movsb\n"
+		: "+D" (d), "+S" (s), "+c" (n) : : "cc", "memory");
+}
+
+// Copy backward, for overlapping moves with s < d.  Mirrors copy_fwd:
+// the tail is moved bytewise until the end of 'd' is aligned.
+static void
+copy_bwd(char *d, const char *s, size_t n)
+{
+	size_t tail, words;
+
+	// Point at the last byte of each buffer.
+	d += n - 1;
+	s += n - 1;
+	if (n >= ALIGN_THRESH) {
+		tail = (uint32_t) (d + 1) & 3;
+		n -= tail;
+		words = n / 4;
+		n &= 3;
+		asm volatile("std; rep movsb\n"
+			: "+D" (d), "+S" (s), "+c" (tail) : : "cc", "memory");
+		d -= 3;
+		s -= 3;
+		asm volatile("rep movsl\n"
+			: "+D" (d), "+S" (s), "+c" (words) : : "cc", "memory");
+		d += 3;
+		s += 3;
+	}
+	asm volatile("std; rep movsb\n"
+		: "+D" (d), "+S" (s), "+c" (n) : : "cc", "memory");
+	// Some versions of GCC rely on DF being clear
+	asm volatile("cld" ::: "cc");
+}
+
 void *
 memmove(void *dst, const void *src, size_t n)
 {
@@ -146,28 +216,110 @@ memmove(void *dst, const void *src, size_t n)
 
 	s = src;
 	d = dst;
-	if (s < d && s + n > d) {
-		s += n;
-		d += n;
-		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
-			asm volatile("std; rep movsl\n"
-				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
-		else
-			asm volatile("std; rep movsb\n"
-				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
-		// Some versions of GCC rely on DF being clear
-		asm volatile("cld" ::: "cc");
-	} else {
-		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
-			asm volatile("cld; rep movsl\n"
-				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
-		else
-			asm volatile("cld; rep movsb\n"
-				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
-	}
+	if (n == 0)
+		return dst;
+	if (s < d && s + n > d)
+		copy_bwd(d, s, n);
+	else
+		copy_fwd(d, s, n);
+	return dst;
+}
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+	// The regions may not overlap, so we never need to copy backward.
+	copy_fwd(dst, src, n);
 	return dst;
 }
 
+// Does this processor implement SSE2 (and therefore MOVNTI)?
+// -1 until the first call checks CPUID.
+static int
+have_sse2(void)
+{
+	static int sse2 = -1;
+	uint32_t edx;
+
+	if (sse2 < 0) {
+		cpuid(1, NULL, NULL, NULL, &edx);
+		sse2 = (edx & CPUID_SSE2) != 0;
+	}
+	return sse2;
+}
+
+// Copy one page-aligned page.  Uses the SSE2 MOVNTI instruction
+// when it is available: the stores bypass the cache, so copying a
+// page (say, for copy-on-write) does not evict the caller's working
+// set.  MOVNTI stores from general-purpose registers, so neither the
+// x87 nor the XMM register state is touched and this is safe to call
+// from the kernel without saving anything.
+void
+page_copy(void *dst, const void *src)
+{
+	size_t n;
+
+	if (!have_sse2()) {
+		n = PGSIZE / 4;
+		asm volatile("cld; rep movsl\n"
+			: "+D" (dst), "+S" (src), "+c" (n) : : "cc", "memory");
+		return;
+	}
+
+	n = PGSIZE / 16;
+	asm volatile("1:\n"
+		"\tmovl 0(%1), %%eax\n"
+		"\tmovl 4(%1), %%edx\n"
+		"\tmovnti %%eax, 0(%0)\n"
+		"\tmovnti %%edx, 4(%0)\n"
+		"\tmovl 8(%1), %%eax\n"
+		"\tmovl 12(%1), %%edx\n"
+		"\tmovnti %%eax, 8(%0)\n"
+		"\tmovnti %%edx, 12(%0)\n"
+		"\taddl $16, %1\n"
+		"\taddl $16, %0\n"
+		"\tdecl %2\n"
+		"\tjnz 1b\n"
+		// Order the weakly-ordered stores before anyone
+		// (e.g., another CPU through a new mapping) reads them.
+		"\tsfence\n"
+		: "+r" (dst), "+r" (src), "+r" (n)
+		:
+		: "eax", "edx", "cc", "memory");
+}
+
+// Zero one page-aligned page, using MOVNTI like page_copy.
+void
+page_zero(void *dst)
+{
+	size_t n;
+
+	if (!have_sse2()) {
+		n = PGSIZE / 4;
+		asm volatile("cld; rep stosl\n"
+			: "+D" (dst), "+c" (n) : "a" (0) : "cc", "memory");
+		return;
+	}
+
+	n = PGSIZE / 32;
+	asm volatile("1:\n"
+		"\tmovnti %2, 0(%0)\n"
+		"\tmovnti %2, 4(%0)\n"
+		"\tmovnti %2, 8(%0)\n"
+		"\tmovnti %2, 12(%0)\n"
+		"\tmovnti %2, 16(%0)\n"
+		"\tmovnti %2, 20(%0)\n"
+		"\tmovnti %2, 24(%0)\n"
+		"\tmovnti %2, 28(%0)\n"
+		"\taddl $32, %0\n"
+		"\tdecl %1\n"
+		"\tjnz 1b\n"
+		"\tsfence\n"
+		: "+r" (dst), "+r" (n)
+		: "r" (0)
+		: "cc", "memory");
+}
+
 #else
 
 void *
@@ -203,7 +355,6 @@ memmove(void *dst, const void *src, size_t n)
 
 	return dst;
 }
-#endif
 
 void *
 memcpy(void *dst, const void *src, size_t n)
@@ -211,6 +362,19 @@ memcpy(void *dst, const void *src, size_t n)
 	return memmove(dst, src, n);
 }
 
+void
+page_copy(void *dst, const void *src)
+{
+	memmove(dst, src, PGSIZE);
+}
+
+void
+page_zero(void *dst)
+{
+	memset(dst, 0, PGSIZE);
+}
+#endif
+
 int
 memcmp(const void *v1, const void *v2, size_t n)
 {
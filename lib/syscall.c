@@ -2,15 +2,50 @@
 
 #include <inc/syscall.h>
 #include <inc/lib.h>
+#include <inc/x86.h>
+
+// Nonzero if the CPU supports SYSENTER; -1 until checked.
+static int have_sysenter = -1;
+
+static int32_t
+syscall_sysenter(int num, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	int32_t ret;
+
+	// Same registers as int $T_SYSCALL, plus our stack pointer in
+	// BP with the return address on top of it; see sysenter_handler
+	// in kern/trapentry.S.  SYSEXIT returns with the address in DX
+	// and the stack pointer in CX.
+	asm volatile("pushl %%ebp\n\t"
+		     "pushl $1f\n\t"
+		     "movl %%esp, %%ebp\n\t"
+		     "sysenter\n"
+		     "1:\taddl $4, %%esp\n\t"
+		     "popl %%ebp\n"
+		     : "=a" (ret), "+d" (a1), "+c" (a2)
+		     : "a" (num),
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+	return ret;
+}
 
 static inline int32_t
 syscall(int num, int check, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
 {
 	int32_t ret;
+	uint32_t edx;
+
+	if (have_sysenter < 0) {
+		cpuid(1, NULL, NULL, NULL, &edx);
+		have_sysenter = (edx & CPUID_SEP) != 0;
+	}
 
 	// Generic system call: pass system call number in AX,
 	// up to five parameters in DX, CX, BX, DI, SI.
-	// Interrupt kernel with T_SYSCALL.
+	// Enter the kernel with SYSENTER if we can, otherwise
+	// interrupt it with T_SYSCALL.
 	//
 	// The "volatile" tells the assembler not to optimize
 	// this instruction away just because we don't use the
@@ -20,16 +55,19 @@ syscall(int num, int check, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 	// potentially change the condition codes and arbitrary
 	// memory locations.
 
-	asm volatile("int %1\n"
-		     : "=a" (ret)
-		     : "i" (T_SYSCALL),
-		       "a" (num),
-		       "d" (a1),
-		       "c" (a2),
-		       "b" (a3),
-		       "D" (a4),
-		       "S" (a5)
-		     : "cc", "memory");
+	if (have_sysenter)
+		ret = syscall_sysenter(num, a1, a2, a3, a4, a5);
+	else
+		asm volatile("int %1\n"
+			     : "=a" (ret)
+			     : "i" (T_SYSCALL),
+			       "a" (num),
+			       "d" (a1),
+			       "c" (a2),
+			       "b" (a3),
+			       "D" (a4),
+			       "S" (a5)
+			     : "cc", "memory");
 
 	if(check && ret > 0)
 		panic("syscall %d returned %d (> 0)", num, ret);
@@ -67,6 +105,18 @@ sys_yield(void)
 	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
 }
 
+int
+sys_env_set_cow(envid_t envid, int enable)
+{
+	return syscall(SYS_env_set_cow, 1, envid, enable, 0, 0, 0);
+}
+
+int
+sys_env_set_quota(envid_t envid, uint32_t npages)
+{
+	return syscall(SYS_env_set_quota, 1, envid, npages, 0, 0, 0);
+}
+
 int
 sys_page_alloc(envid_t envid, void *va, int perm)
 {
@@ -85,6 +135,12 @@ sys_page_unmap(envid_t envid, void *va)
 	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
 }
 
+int
+sys_page_reuse(envid_t envid, void *va)
+{
+	return syscall(SYS_page_reuse, 0, envid, (uint32_t) va, 0, 0, 0);
+}
+
 // sys_exofork is inlined in lib.h
 
 int
@@ -99,6 +155,30 @@ sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
 	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
 }
 
+int
+sys_env_set_trace(envid_t envid, int enable)
+{
+	return syscall(SYS_env_set_trace, 1, envid, enable, 0, 0, 0);
+}
+
+int
+sys_env_set_rdpmc(envid_t envid, int enable)
+{
+	return syscall(SYS_env_set_rdpmc, 1, envid, enable, 0, 0, 0);
+}
+
+int
+sys_ring_setup(void)
+{
+	return syscall(SYS_ring_setup, 1, 0, 0, 0, 0, 0);
+}
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+
 int
 sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
 {
@@ -0,0 +1,66 @@
+// Asynchronous system call ring: queue non-blocking system calls in the
+// Sysring at USYSRING and hand them to the kernel in one go.
+// See struct Sysring in inc/syscall.h.
+
+#include <inc/lib.h>
+
+#define sysring	((volatile struct Sysring *) USYSRING)
+
+// Set up the calling environment's ring.
+int
+sysring_setup(void)
+{
+	return sys_ring_setup();
+}
+
+// Queue system call 'num' with the given arguments; 'tag' comes back
+// with its completion.  Nothing runs until sysring_enter, or until the
+// environment blocks and an idle CPU finds the request.
+// Returns 0 on success, -E_NO_MEM if the submission ring is full.
+int
+sysring_submit(uint32_t tag, uint32_t num, uint32_t a1, uint32_t a2,
+	       uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	volatile struct SysringSqe *sqe;
+	uint32_t tail = sysring->sr_sq_tail;
+
+	if (tail - sysring->sr_sq_head >= SYSRING_SIZE)
+		return -E_NO_MEM;
+	sqe = &sysring->sr_sq[tail % SYSRING_SIZE];
+	sqe->sqe_num = num;
+	sqe->sqe_args[0] = a1;
+	sqe->sqe_args[1] = a2;
+	sqe->sqe_args[2] = a3;
+	sqe->sqe_args[3] = a4;
+	sqe->sqe_args[4] = a5;
+	sqe->sqe_tag = tag;
+	sysring->sr_sq_tail = tail + 1;
+	return 0;
+}
+
+// Run the queued requests.  Returns the number completed, which may
+// be fewer than were queued if the completion ring filled up.
+int
+sysring_enter(void)
+{
+	return sys_ring_enter();
+}
+
+// Take the oldest completion, storing its tag and return value.
+// Returns 1 if there was one, 0 if the completion ring is empty.
+int
+sysring_reap(uint32_t *tag_store, int32_t *ret_store)
+{
+	volatile struct SysringCqe *cqe;
+	uint32_t head = sysring->sr_cq_head;
+
+	if (head == sysring->sr_cq_tail)
+		return 0;
+	cqe = &sysring->sr_cq[head % SYSRING_SIZE];
+	if (tag_store)
+		*tag_store = cqe->cqe_tag;
+	if (ret_store)
+		*ret_store = cqe->cqe_ret;
+	sysring->sr_cq_head = head + 1;
+	return 1;
+}
@@ -0,0 +1,41 @@
+// Queries answered from the read-only info page the kernel maps at
+// UINFO, without entering the kernel.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+// Return the calling environment's id.
+envid_t
+uinfo_envid(void)
+{
+	return uinfo.ui_envid;
+}
+
+// Return the CPU the calling environment is running on.  The answer
+// may be stale by the time the caller looks at it.
+int
+uinfo_cpunum(void)
+{
+	return uinfo.ui_cpunum;
+}
+
+// Return the timer tick count of the caller's CPU, as of the last
+// tick or reschedule.
+uint32_t
+uinfo_ticks(void)
+{
+	return uinfo.ui_ticks;
+}
+
+// Return nanoseconds since the TSC was reset, or 0 if the kernel
+// couldn't calibrate the TSC.
+uint64_t
+uinfo_nsec(void)
+{
+	uint64_t tsc = read_tsc();
+	uint32_t khz = uinfo.ui_tsc_khz;
+
+	if (!khz)
+		return 0;
+	return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+}
@@ -0,0 +1,204 @@
+
+obj/boot/boot.out:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007c00 <start>:
+    7c00:	fa                   	cli
+    7c01:	fc                   	cld
+    7c02:	31 c0                	xor    %eax,%eax
+    7c04:	8e d8                	mov    %eax,%ds
+    7c06:	8e c0                	mov    %eax,%es
+    7c08:	8e d0                	mov    %eax,%ss
+
+00007c0a <seta20.1>:
+    7c0a:	e4 64                	in     $0x64,%al
+    7c0c:	a8 02                	test   $0x2,%al
+    7c0e:	75 fa                	jne    7c0a <seta20.1>
+    7c10:	b0 d1                	mov    $0xd1,%al
+    7c12:	e6 64                	out    %al,$0x64
+
+00007c14 <seta20.2>:
+    7c14:	e4 64                	in     $0x64,%al
+    7c16:	a8 02                	test   $0x2,%al
+    7c18:	75 fa                	jne    7c14 <seta20.2>
+    7c1a:	b0 df                	mov    $0xdf,%al
+    7c1c:	e6 60                	out    %al,$0x60
+    7c1e:	0f 01 16             	lgdtl  (%esi)
+    7c21:	64 7c 0f             	fs jl  7c33 <protcseg+0x1>
+    7c24:	20 c0                	and    %al,%al
+    7c26:	66 83 c8 01          	or     $0x1,%ax
+    7c2a:	0f 22 c0             	mov    %eax,%cr0
+    7c2d:	ea                   	.byte 0xea
+    7c2e:	32 7c 08 00          	xor    0x0(%eax,%ecx,1),%bh
+
+00007c32 <protcseg>:
+    7c32:	66 b8 10 00          	mov    $0x10,%ax
+    7c36:	8e d8                	mov    %eax,%ds
+    7c38:	8e c0                	mov    %eax,%es
+    7c3a:	8e e0                	mov    %eax,%fs
+    7c3c:	8e e8                	mov    %eax,%gs
+    7c3e:	8e d0                	mov    %eax,%ss
+    7c40:	bc 00 7c 00 00       	mov    $0x7c00,%esp
+    7c45:	e8 29 01 00 00       	call   7d73 <bootmain>
+
+00007c4a <spin>:
+    7c4a:	eb fe                	jmp    7c4a <spin>
+
+00007c4c <gdt>:
+	...
+    7c54:	ff                   	(bad)
+    7c55:	ff 00                	incl   (%eax)
+    7c57:	00 00                	add    %al,(%eax)
+    7c59:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    7c60:	00                   	.byte 0x0
+    7c61:	92                   	xchg   %eax,%edx
+    7c62:	cf                   	iret
+	...
+
+00007c64 <gdtdesc>:
+    7c64:	17                   	pop    %ss
+    7c65:	00 4c 7c 00          	add    %cl,0x0(%esp,%edi,2)
+	...
+
+00007c6a <bad>:
+    7c6a:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+    7c6f:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+    7c74:	66 ef                	out    %ax,(%dx)
+    7c76:	b8 00 8e ff ff       	mov    $0xffff8e00,%eax
+    7c7b:	66 ef                	out    %ax,(%dx)
+    7c7d:	eb fe                	jmp    7c7d <bad+0x13>
+
+00007c7f <readseg>:
+    7c7f:	55                   	push   %ebp
+    7c80:	89 e5                	mov    %esp,%ebp
+    7c82:	57                   	push   %edi
+    7c83:	56                   	push   %esi
+    7c84:	53                   	push   %ebx
+    7c85:	83 ec 1c             	sub    $0x1c,%esp
+    7c88:	8b 45 08             	mov    0x8(%ebp),%eax
+    7c8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    7c8e:	01 c1                	add    %eax,%ecx
+    7c90:	25 00 fe ff ff       	and    $0xfffffe00,%eax
+    7c95:	89 c6                	mov    %eax,%esi
+    7c97:	8b 45 10             	mov    0x10(%ebp),%eax
+    7c9a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    7c9d:	c1 e8 09             	shr    $0x9,%eax
+    7ca0:	40                   	inc    %eax
+    7ca1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    7ca4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    7ca7:	39 c6                	cmp    %eax,%esi
+    7ca9:	0f 83 bc 00 00 00    	jae    7d6b <readseg+0xec>
+    7caf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    7cb2:	bb 00 01 00 00       	mov    $0x100,%ebx
+    7cb7:	05 ff 01 00 00       	add    $0x1ff,%eax
+    7cbc:	29 f0                	sub    %esi,%eax
+    7cbe:	3d ff 01 02 00       	cmp    $0x201ff,%eax
+    7cc3:	77 05                	ja     7cca <readseg+0x4b>
+    7cc5:	c1 e8 09             	shr    $0x9,%eax
+    7cc8:	89 c3                	mov    %eax,%ebx
+    7cca:	89 75 dc             	mov    %esi,-0x24(%ebp)
+    7ccd:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7cd2:	ec                   	in     (%dx),%al
+    7cd3:	83 e0 c0             	and    $0xffffffc0,%eax
+    7cd6:	3c 40                	cmp    $0x40,%al
+    7cd8:	75 f3                	jne    7ccd <readseg+0x4e>
+    7cda:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    7cdf:	89 d8                	mov    %ebx,%eax
+    7ce1:	ee                   	out    %al,(%dx)
+    7ce2:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    7ce7:	8a 45 e4             	mov    -0x1c(%ebp),%al
+    7cea:	ee                   	out    %al,(%dx)
+    7ceb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    7cee:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    7cf3:	c1 e8 08             	shr    $0x8,%eax
+    7cf6:	ee                   	out    %al,(%dx)
+    7cf7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    7cfa:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    7cff:	c1 e8 10             	shr    $0x10,%eax
+    7d02:	ee                   	out    %al,(%dx)
+    7d03:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    7d06:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    7d0b:	c1 e8 18             	shr    $0x18,%eax
+    7d0e:	83 c8 e0             	or     $0xffffffe0,%eax
+    7d11:	ee                   	out    %al,(%dx)
+    7d12:	b0 20                	mov    $0x20,%al
+    7d14:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7d19:	ee                   	out    %al,(%dx)
+    7d1a:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    7d1d:	ff 4d d8             	decl   -0x28(%ebp)
+    7d20:	83 7d d8 ff          	cmpl   $0xffffffff,-0x28(%ebp)
+    7d24:	74 36                	je     7d5c <readseg+0xdd>
+    7d26:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7d2b:	ec                   	in     (%dx),%al
+    7d2c:	89 c2                	mov    %eax,%edx
+    7d2e:	83 e2 88             	and    $0xffffff88,%edx
+    7d31:	80 fa 08             	cmp    $0x8,%dl
+    7d34:	74 0d                	je     7d43 <readseg+0xc4>
+    7d36:	84 c0                	test   %al,%al
+    7d38:	78 ec                	js     7d26 <readseg+0xa7>
+    7d3a:	a8 21                	test   $0x21,%al
+    7d3c:	74 e8                	je     7d26 <readseg+0xa7>
+    7d3e:	e8 27 ff ff ff       	call   7c6a <bad>
+    7d43:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    7d46:	b9 80 00 00 00       	mov    $0x80,%ecx
+    7d4b:	ba f0 01 00 00       	mov    $0x1f0,%edx
+    7d50:	fc                   	cld
+    7d51:	f2 6d                	repnz insl (%dx),%es:(%edi)
+    7d53:	81 45 dc 00 02 00 00 	addl   $0x200,-0x24(%ebp)
+    7d5a:	eb c1                	jmp    7d1d <readseg+0x9e>
+    7d5c:	89 d8                	mov    %ebx,%eax
+    7d5e:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+    7d61:	c1 e0 09             	shl    $0x9,%eax
+    7d64:	01 c6                	add    %eax,%esi
+    7d66:	e9 39 ff ff ff       	jmp    7ca4 <readseg+0x25>
+    7d6b:	83 c4 1c             	add    $0x1c,%esp
+    7d6e:	5b                   	pop    %ebx
+    7d6f:	5e                   	pop    %esi
+    7d70:	5f                   	pop    %edi
+    7d71:	5d                   	pop    %ebp
+    7d72:	c3                   	ret
+
+00007d73 <bootmain>:
+    7d73:	55                   	push   %ebp
+    7d74:	89 e5                	mov    %esp,%ebp
+    7d76:	56                   	push   %esi
+    7d77:	53                   	push   %ebx
+    7d78:	52                   	push   %edx
+    7d79:	6a 00                	push   $0x0
+    7d7b:	68 00 10 00 00       	push   $0x1000
+    7d80:	68 00 00 01 00       	push   $0x10000
+    7d85:	e8 f5 fe ff ff       	call   7c7f <readseg>
+    7d8a:	83 c4 10             	add    $0x10,%esp
+    7d8d:	81 3d 00 00 01 00 7f 	cmpl   $0x464c457f,0x10000
+    7d94:	45 4c 46 
+    7d97:	75 51                	jne    7dea <bootmain+0x77>
+    7d99:	a1 1c 00 01 00       	mov    0x1001c,%eax
+    7d9e:	0f b7 35 2c 00 01 00 	movzwl 0x1002c,%esi
+    7da5:	8d 98 00 00 01 00    	lea    0x10000(%eax),%ebx
+    7dab:	c1 e6 05             	shl    $0x5,%esi
+    7dae:	01 de                	add    %ebx,%esi
+    7db0:	39 f3                	cmp    %esi,%ebx
+    7db2:	73 30                	jae    7de4 <bootmain+0x71>
+    7db4:	50                   	push   %eax
+    7db5:	ff 73 04             	push   0x4(%ebx)
+    7db8:	ff 73 14             	push   0x14(%ebx)
+    7dbb:	ff 73 0c             	push   0xc(%ebx)
+    7dbe:	e8 bc fe ff ff       	call   7c7f <readseg>
+    7dc3:	83 c4 10             	add    $0x10,%esp
+    7dc6:	31 d2                	xor    %edx,%edx
+    7dc8:	8b 43 10             	mov    0x10(%ebx),%eax
+    7dcb:	8b 4b 14             	mov    0x14(%ebx),%ecx
+    7dce:	29 c1                	sub    %eax,%ecx
+    7dd0:	39 ca                	cmp    %ecx,%edx
+    7dd2:	73 0b                	jae    7ddf <bootmain+0x6c>
+    7dd4:	01 d0                	add    %edx,%eax
+    7dd6:	03 43 0c             	add    0xc(%ebx),%eax
+    7dd9:	42                   	inc    %edx
+    7dda:	c6 00 00             	movb   $0x0,(%eax)
+    7ddd:	eb e9                	jmp    7dc8 <bootmain+0x55>
+    7ddf:	83 c3 20             	add    $0x20,%ebx
+    7de2:	eb cc                	jmp    7db0 <bootmain+0x3d>
+    7de4:	ff 15 18 00 01 00    	call   *0x10018
+    7dea:	e8 7b fe ff ff       	call   7c6a <bad>
@@ -0,0 +1,101 @@
+
+obj/boot/kzload:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800000 <kzmain>:
+  800000:	55                   	push   %ebp
+  800001:	b9 48 01 80 00       	mov    $0x800148,%ecx
+  800006:	89 e5                	mov    %esp,%ebp
+  800008:	57                   	push   %edi
+  800009:	bf 00 00 00 01       	mov    $0x1000000,%edi
+  80000e:	56                   	push   %esi
+  80000f:	53                   	push   %ebx
+  800010:	83 ec 0c             	sub    $0xc,%esp
+  800013:	81 f9 5f e1 81 00    	cmp    $0x81e15f,%ecx
+  800019:	73 6e                	jae    800089 <kzmain+0x89>
+  80001b:	8a 11                	mov    (%ecx),%dl
+  80001d:	8d 41 01             	lea    0x1(%ecx),%eax
+  800020:	89 d3                	mov    %edx,%ebx
+  800022:	c0 eb 04             	shr    $0x4,%bl
+  800025:	0f b6 cb             	movzbl %bl,%ecx
+  800028:	80 fb 0f             	cmp    $0xf,%bl
+  80002b:	74 07                	je     800034 <kzmain+0x34>
+  80002d:	8d 1c 0f             	lea    (%edi,%ecx,1),%ebx
+  800030:	89 c6                	mov    %eax,%esi
+  800032:	eb 13                	jmp    800047 <kzmain+0x47>
+  800034:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  800039:	0f b6 30             	movzbl (%eax),%esi
+  80003c:	40                   	inc    %eax
+  80003d:	89 f3                	mov    %esi,%ebx
+  80003f:	01 f1                	add    %esi,%ecx
+  800041:	fe c3                	inc    %bl
+  800043:	74 f4                	je     800039 <kzmain+0x39>
+  800045:	eb e6                	jmp    80002d <kzmain+0x2d>
+  800047:	39 fb                	cmp    %edi,%ebx
+  800049:	74 03                	je     80004e <kzmain+0x4e>
+  80004b:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  80004c:	eb f9                	jmp    800047 <kzmain+0x47>
+  80004e:	01 c8                	add    %ecx,%eax
+  800050:	3d 5f e1 81 00       	cmp    $0x81e15f,%eax
+  800055:	73 32                	jae    800089 <kzmain+0x89>
+  800057:	0f b7 08             	movzwl (%eax),%ecx
+  80005a:	89 fe                	mov    %edi,%esi
+  80005c:	29 ce                	sub    %ecx,%esi
+  80005e:	8d 48 02             	lea    0x2(%eax),%ecx
+  800061:	89 d0                	mov    %edx,%eax
+  800063:	83 e2 0f             	and    $0xf,%edx
+  800066:	83 e0 0f             	and    $0xf,%eax
+  800069:	3c 0f                	cmp    $0xf,%al
+  80006b:	75 11                	jne    80007e <kzmain+0x7e>
+  80006d:	ba 0f 00 00 00       	mov    $0xf,%edx
+  800072:	0f b6 19             	movzbl (%ecx),%ebx
+  800075:	41                   	inc    %ecx
+  800076:	89 d8                	mov    %ebx,%eax
+  800078:	01 da                	add    %ebx,%edx
+  80007a:	fe c0                	inc    %al
+  80007c:	74 f4                	je     800072 <kzmain+0x72>
+  80007e:	8d 44 17 04          	lea    0x4(%edi,%edx,1),%eax
+  800082:	39 f8                	cmp    %edi,%eax
+  800084:	74 8d                	je     800013 <kzmain+0x13>
+  800086:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  800087:	eb f9                	jmp    800082 <kzmain+0x82>
+  800089:	a1 44 01 80 00       	mov    0x800144,%eax
+  80008e:	05 00 00 00 01       	add    $0x1000000,%eax
+  800093:	39 c7                	cmp    %eax,%edi
+  800095:	75 5a                	jne    8000f1 <kzmain+0xf1>
+  800097:	81 3d 00 00 00 01 7f 	cmpl   $0x464c457f,0x1000000
+  80009e:	45 4c 46 
+  8000a1:	75 4e                	jne    8000f1 <kzmain+0xf1>
+  8000a3:	a1 1c 00 00 01       	mov    0x100001c,%eax
+  8000a8:	0f b7 0d 2c 00 00 01 	movzwl 0x100002c,%ecx
+  8000af:	05 00 00 00 01       	add    $0x1000000,%eax
+  8000b4:	c1 e1 05             	shl    $0x5,%ecx
+  8000b7:	01 c1                	add    %eax,%ecx
+  8000b9:	39 c8                	cmp    %ecx,%eax
+  8000bb:	73 2e                	jae    8000eb <kzmain+0xeb>
+  8000bd:	31 d2                	xor    %edx,%edx
+  8000bf:	3b 50 10             	cmp    0x10(%eax),%edx
+  8000c2:	73 13                	jae    8000d7 <kzmain+0xd7>
+  8000c4:	8b 58 04             	mov    0x4(%eax),%ebx
+  8000c7:	8b 70 0c             	mov    0xc(%eax),%esi
+  8000ca:	8a 9c 1a 00 00 00 01 	mov    0x1000000(%edx,%ebx,1),%bl
+  8000d1:	88 1c 16             	mov    %bl,(%esi,%edx,1)
+  8000d4:	42                   	inc    %edx
+  8000d5:	eb e8                	jmp    8000bf <kzmain+0xbf>
+  8000d7:	3b 50 14             	cmp    0x14(%eax),%edx
+  8000da:	73 0a                	jae    8000e6 <kzmain+0xe6>
+  8000dc:	8b 58 0c             	mov    0xc(%eax),%ebx
+  8000df:	c6 04 13 00          	movb   $0x0,(%ebx,%edx,1)
+  8000e3:	42                   	inc    %edx
+  8000e4:	eb f1                	jmp    8000d7 <kzmain+0xd7>
+  8000e6:	83 c0 20             	add    $0x20,%eax
+  8000e9:	eb ce                	jmp    8000b9 <kzmain+0xb9>
+  8000eb:	ff 15 18 00 00 01    	call   *0x1000018
+  8000f1:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  8000f6:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  8000fb:	66 ef                	out    %ax,(%dx)
+  8000fd:	b8 00 8e ff ff       	mov    $0xffff8e00,%eax
+  800102:	66 ef                	out    %ax,(%dx)
+  800104:	eb fe                	jmp    800104 <kzmain+0x104>
@@ -0,0 +1,12037 @@
+
+obj/kern/kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+f0100000 <_start+0xeffffff4>:
+f0100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+f0100006:	00 00                	add    %al,(%eax)
+f0100008:	fe 4f 52             	decb   0x52(%edi)
+f010000b:	e4                   	.byte 0xe4
+
+f010000c <entry>:
+f010000c:	66 c7 05 72 04 00 00 	movw   $0x1234,0x472
+f0100013:	34 12 
+f0100015:	b8 00 50 11 00       	mov    $0x115000,%eax
+f010001a:	0f 22 d8             	mov    %eax,%cr3
+f010001d:	0f 20 e0             	mov    %cr4,%eax
+f0100020:	83 c8 10             	or     $0x10,%eax
+f0100023:	0f 22 e0             	mov    %eax,%cr4
+f0100026:	0f 20 c0             	mov    %cr0,%eax
+f0100029:	0d 01 00 01 80       	or     $0x80010001,%eax
+f010002e:	0f 22 c0             	mov    %eax,%cr0
+f0100031:	b8 38 00 10 f0       	mov    $0xf0100038,%eax
+f0100036:	ff e0                	jmp    *%eax
+
+f0100038 <relocated>:
+f0100038:	bd 00 00 00 00       	mov    $0x0,%ebp
+f010003d:	bc 00 50 11 f0       	mov    $0xf0115000,%esp
+f0100042:	e8 52 01 00 00       	call   f0100199 <i386_init>
+
+f0100047 <spin>:
+f0100047:	eb fe                	jmp    f0100047 <spin>
+
+f0100049 <boot_phase>:
+f0100049:	55                   	push   %ebp
+f010004a:	89 e5                	mov    %esp,%ebp
+f010004c:	57                   	push   %edi
+f010004d:	56                   	push   %esi
+f010004e:	53                   	push   %ebx
+f010004f:	83 ec 1c             	sub    $0x1c,%esp
+f0100052:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0100055:	8b 34 cd 20 24 1a f0 	mov    -0xfe5dbe0(,%ecx,8),%esi
+f010005c:	8b 04 cd 24 24 1a f0 	mov    -0xfe5dbdc(,%ecx,8),%eax
+f0100063:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0100066:	09 f0                	or     %esi,%eax
+f0100068:	0f 85 b5 00 00 00    	jne    f0100123 <boot_phase+0xda>
+f010006e:	0f 31                	rdtsc
+f0100070:	89 04 cd 20 24 1a f0 	mov    %eax,-0xfe5dbe0(,%ecx,8)
+f0100077:	89 14 cd 24 24 1a f0 	mov    %edx,-0xfe5dbdc(,%ecx,8)
+f010007e:	83 f9 08             	cmp    $0x8,%ecx
+f0100081:	0f 85 9c 00 00 00    	jne    f0100123 <boot_phase+0xda>
+f0100087:	bf 00 00 00 00       	mov    $0x0,%edi
+f010008c:	89 75 e0             	mov    %esi,-0x20(%ebp)
+f010008f:	eb 1e                	jmp    f01000af <boot_phase+0x66>
+f0100091:	52                   	push   %edx
+f0100092:	50                   	push   %eax
+f0100093:	ff 34 b5 40 9e 10 f0 	push   -0xfef61c0(,%esi,4)
+f010009a:	68 d6 9c 10 f0       	push   $0xf0109cd6
+f010009f:	e8 7f 4f 00 00       	call   f0105023 <cprintf>
+f01000a4:	83 c4 10             	add    $0x10,%esp
+f01000a7:	83 c7 01             	add    $0x1,%edi
+f01000aa:	83 ff 09             	cmp    $0x9,%edi
+f01000ad:	74 74                	je     f0100123 <boot_phase+0xda>
+f01000af:	89 fe                	mov    %edi,%esi
+f01000b1:	8b 04 fd 20 24 1a f0 	mov    -0xfe5dbe0(,%edi,8),%eax
+f01000b8:	8b 14 fd 24 24 1a f0 	mov    -0xfe5dbdc(,%edi,8),%edx
+f01000bf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f01000c2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f01000c5:	85 ff                	test   %edi,%edi
+f01000c7:	74 0e                	je     f01000d7 <boot_phase+0x8e>
+f01000c9:	8b 0c fd 18 24 1a f0 	mov    -0xfe5dbe8(,%edi,8),%ecx
+f01000d0:	8b 1c fd 1c 24 1a f0 	mov    -0xfe5dbe4(,%edi,8),%ebx
+f01000d7:	29 c8                	sub    %ecx,%eax
+f01000d9:	19 da                	sbb    %ebx,%edx
+f01000db:	8b 0d 64 39 1a f0    	mov    0xf01a3964,%ecx
+f01000e1:	85 c9                	test   %ecx,%ecx
+f01000e3:	74 ac                	je     f0100091 <boot_phase+0x48>
+f01000e5:	69 da e8 03 00 00    	imul   $0x3e8,%edx,%ebx
+f01000eb:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+f01000ee:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+f01000f3:	f7 e3                	mul    %ebx
+f01000f5:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f01000f8:	01 da                	add    %ebx,%edx
+f01000fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01000ff:	53                   	push   %ebx
+f0100100:	51                   	push   %ecx
+f0100101:	52                   	push   %edx
+f0100102:	50                   	push   %eax
+f0100103:	e8 2a 99 00 00       	call   f0109a32 <__udivdi3>
+f0100108:	83 c4 10             	add    $0x10,%esp
+f010010b:	52                   	push   %edx
+f010010c:	50                   	push   %eax
+f010010d:	ff 34 b5 40 9e 10 f0 	push   -0xfef61c0(,%esi,4)
+f0100114:	68 c0 9c 10 f0       	push   $0xf0109cc0
+f0100119:	e8 05 4f 00 00       	call   f0105023 <cprintf>
+f010011e:	83 c4 10             	add    $0x10,%esp
+f0100121:	eb 84                	jmp    f01000a7 <boot_phase+0x5e>
+f0100123:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100126:	5b                   	pop    %ebx
+f0100127:	5e                   	pop    %esi
+f0100128:	5f                   	pop    %edi
+f0100129:	5d                   	pop    %ebp
+f010012a:	c3                   	ret
+
+f010012b <_panic>:
+f010012b:	55                   	push   %ebp
+f010012c:	89 e5                	mov    %esp,%ebp
+f010012e:	53                   	push   %ebx
+f010012f:	83 ec 04             	sub    $0x4,%esp
+f0100132:	83 3d 00 20 1a f0 00 	cmpl   $0x0,0xf01a2000
+f0100139:	74 0f                	je     f010014a <_panic+0x1f>
+f010013b:	83 ec 0c             	sub    $0xc,%esp
+f010013e:	6a 00                	push   $0x0
+f0100140:	e8 90 10 00 00       	call   f01011d5 <monitor>
+f0100145:	83 c4 10             	add    $0x10,%esp
+f0100148:	eb f1                	jmp    f010013b <_panic+0x10>
+f010014a:	8b 45 10             	mov    0x10(%ebp),%eax
+f010014d:	a3 00 20 1a f0       	mov    %eax,0xf01a2000
+f0100152:	fa                   	cli
+f0100153:	fc                   	cld
+f0100154:	8d 5d 14             	lea    0x14(%ebp),%ebx
+f0100157:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010015d:	ff 75 0c             	push   0xc(%ebp)
+f0100160:	ff 75 08             	push   0x8(%ebp)
+f0100163:	2d 40 70 25 f0       	sub    $0xf0257040,%eax
+f0100168:	c1 f8 06             	sar    $0x6,%eax
+f010016b:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0100171:	50                   	push   %eax
+f0100172:	68 c0 9d 10 f0       	push   $0xf0109dc0
+f0100177:	e8 a7 4e 00 00       	call   f0105023 <cprintf>
+f010017c:	83 c4 08             	add    $0x8,%esp
+f010017f:	53                   	push   %ebx
+f0100180:	ff 75 10             	push   0x10(%ebp)
+f0100183:	e8 75 4e 00 00       	call   f0104ffd <vcprintf>
+f0100188:	c7 04 24 50 b1 10 f0 	movl   $0xf010b150,(%esp)
+f010018f:	e8 8f 4e 00 00       	call   f0105023 <cprintf>
+f0100194:	83 c4 10             	add    $0x10,%esp
+f0100197:	eb a2                	jmp    f010013b <_panic+0x10>
+
+f0100199 <i386_init>:
+f0100199:	55                   	push   %ebp
+f010019a:	89 e5                	mov    %esp,%ebp
+f010019c:	57                   	push   %edi
+f010019d:	56                   	push   %esi
+f010019e:	53                   	push   %ebx
+f010019f:	83 ec 28             	sub    $0x28,%esp
+f01001a2:	6a 00                	push   $0x0
+f01001a4:	e8 a0 fe ff ff       	call   f0100049 <boot_phase>
+f01001a9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f01001b0:	e8 a8 41 00 00       	call   f010435d <env_init_gs>
+f01001b5:	e8 78 08 00 00       	call   f0100a32 <cons_init>
+f01001ba:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f01001c1:	e8 83 fe ff ff       	call   f0100049 <boot_phase>
+f01001c6:	83 c4 08             	add    $0x8,%esp
+f01001c9:	68 80 c8 06 00       	push   $0x6c880
+f01001ce:	68 f0 9c 10 f0       	push   $0xf0109cf0
+f01001d3:	e8 4b 4e 00 00       	call   f0105023 <cprintf>
+f01001d8:	e8 c2 6f 00 00       	call   f010719f <debuginfo_init>
+f01001dd:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+f01001e4:	e8 60 fe ff ff       	call   f0100049 <boot_phase>
+f01001e9:	e8 6d 1f 00 00       	call   f010215b <mem_init>
+f01001ee:	c7 04 24 03 00 00 00 	movl   $0x3,(%esp)
+f01001f5:	e8 4f fe ff ff       	call   f0100049 <boot_phase>
+f01001fa:	e8 f3 4b 00 00       	call   f0104df2 <tsc_calibrate>
+f01001ff:	c7 04 24 04 00 00 00 	movl   $0x4,(%esp)
+f0100206:	e8 3e fe ff ff       	call   f0100049 <boot_phase>
+f010020b:	e8 76 49 00 00       	call   f0104b86 <env_init>
+f0100210:	e8 36 4f 00 00       	call   f010514b <trap_init>
+f0100215:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+f010021c:	e8 28 fe ff ff       	call   f0100049 <boot_phase>
+f0100221:	e8 53 90 00 00       	call   f0109279 <mp_init>
+f0100226:	e8 ce 93 00 00       	call   f01095f9 <lapic_init>
+f010022b:	e8 f3 94 00 00       	call   f0109723 <lapic_id>
+f0100230:	89 04 24             	mov    %eax,(%esp)
+f0100233:	e8 25 41 00 00       	call   f010435d <env_init_gs>
+f0100238:	e8 07 4d 00 00       	call   f0104f44 <pic_init>
+f010023d:	c7 04 24 06 00 00 00 	movl   $0x6,(%esp)
+f0100244:	e8 00 fe ff ff       	call   f0100049 <boot_phase>
+f0100249:	c7 04 24 00 74 11 f0 	movl   $0xf0117400,(%esp)
+f0100250:	e8 50 96 00 00       	call   f01098a5 <spin_lock>
+f0100255:	83 c4 10             	add    $0x10,%esp
+f0100258:	83 3d 18 37 1a f0 07 	cmpl   $0x7,0xf01a3718
+f010025f:	76 3d                	jbe    f010029e <i386_init+0x105>
+f0100261:	83 ec 04             	sub    $0x4,%esp
+f0100264:	b8 d6 91 10 f0       	mov    $0xf01091d6,%eax
+f0100269:	2d 48 91 10 f0       	sub    $0xf0109148,%eax
+f010026e:	50                   	push   %eax
+f010026f:	68 48 91 10 f0       	push   $0xf0109148
+f0100274:	68 00 70 00 f0       	push   $0xf0007000
+f0100279:	e8 5a 8c 00 00       	call   f0108ed8 <memmove>
+f010027e:	a1 00 70 25 f0       	mov    0xf0257000,%eax
+f0100283:	8d 34 40             	lea    (%eax,%eax,2),%esi
+f0100286:	c1 e6 06             	shl    $0x6,%esi
+f0100289:	81 c6 40 70 25 f0    	add    $0xf0257040,%esi
+f010028f:	83 c4 10             	add    $0x10,%esp
+f0100292:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0100297:	ba 40 70 25 f0       	mov    $0xf0257040,%edx
+f010029c:	eb 4d                	jmp    f01002eb <i386_init+0x152>
+f010029e:	68 00 70 00 00       	push   $0x7000
+f01002a3:	68 e4 9d 10 f0       	push   $0xf0109de4
+f01002a8:	68 90 00 00 00       	push   $0x90
+f01002ad:	68 0d 9d 10 f0       	push   $0xf0109d0d
+f01002b2:	e8 74 fe ff ff       	call   f010012b <_panic>
+f01002b7:	0f b6 4a 15          	movzbl 0x15(%edx),%ecx
+f01002bb:	0f b6 f9             	movzbl %cl,%edi
+f01002be:	89 d0                	mov    %edx,%eax
+f01002c0:	2d 40 70 25 f0       	sub    $0xf0257040,%eax
+f01002c5:	c1 f8 06             	sar    $0x6,%eax
+f01002c8:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01002ce:	c1 e0 0f             	shl    $0xf,%eax
+f01002d1:	8d 80 00 f0 21 f0    	lea    -0xfde1000(%eax),%eax
+f01002d7:	89 04 bd 20 20 1a f0 	mov    %eax,-0xfe5dfe0(,%edi,4)
+f01002de:	88 4c 1d e0          	mov    %cl,-0x20(%ebp,%ebx,1)
+f01002e2:	8d 5b 01             	lea    0x1(%ebx),%ebx
+f01002e5:	81 c2 c0 00 00 00    	add    $0xc0,%edx
+f01002eb:	39 f2                	cmp    %esi,%edx
+f01002ed:	73 0c                	jae    f01002fb <i386_init+0x162>
+f01002ef:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01002f5:	39 d0                	cmp    %edx,%eax
+f01002f7:	75 be                	jne    f01002b7 <i386_init+0x11e>
+f01002f9:	eb ea                	jmp    f01002e5 <i386_init+0x14c>
+f01002fb:	83 ec 08             	sub    $0x8,%esp
+f01002fe:	68 19 9d 10 f0       	push   $0xf0109d19
+f0100303:	68 80 24 1a f0       	push   $0xf01a2480
+f0100308:	e8 7d 95 00 00       	call   f010988a <__spin_initlock>
+f010030d:	83 c4 10             	add    $0x10,%esp
+f0100310:	85 db                	test   %ebx,%ebx
+f0100312:	7f 1d                	jg     f0100331 <i386_init+0x198>
+f0100314:	e8 90 3d 00 00       	call   f01040a9 <mem_check_percpu>
+f0100319:	a1 00 70 25 f0       	mov    0xf0257000,%eax
+f010031e:	8d 0c 40             	lea    (%eax,%eax,2),%ecx
+f0100321:	c1 e1 06             	shl    $0x6,%ecx
+f0100324:	81 c1 40 70 25 f0    	add    $0xf0257040,%ecx
+f010032a:	b8 40 70 25 f0       	mov    $0xf0257040,%eax
+f010032f:	eb 1c                	jmp    f010034d <i386_init+0x1b4>
+f0100331:	83 ec 04             	sub    $0x4,%esp
+f0100334:	68 00 70 00 00       	push   $0x7000
+f0100339:	53                   	push   %ebx
+f010033a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f010033d:	50                   	push   %eax
+f010033e:	e8 17 94 00 00       	call   f010975a <lapic_startaps>
+f0100343:	83 c4 10             	add    $0x10,%esp
+f0100346:	eb cc                	jmp    f0100314 <i386_init+0x17b>
+f0100348:	05 c0 00 00 00       	add    $0xc0,%eax
+f010034d:	39 c8                	cmp    %ecx,%eax
+f010034f:	73 15                	jae    f0100366 <i386_init+0x1cd>
+f0100351:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0100358:	39 c2                	cmp    %eax,%edx
+f010035a:	74 ec                	je     f0100348 <i386_init+0x1af>
+f010035c:	8b 50 18             	mov    0x18(%eax),%edx
+f010035f:	83 fa 01             	cmp    $0x1,%edx
+f0100362:	75 ed                	jne    f0100351 <i386_init+0x1b8>
+f0100364:	eb e2                	jmp    f0100348 <i386_init+0x1af>
+f0100366:	e8 3f 3d 00 00       	call   f01040aa <mem_check_wait>
+f010036b:	83 ec 0c             	sub    $0xc,%esp
+f010036e:	6a 07                	push   $0x7
+f0100370:	e8 d4 fc ff ff       	call   f0100049 <boot_phase>
+f0100375:	83 c4 08             	add    $0x8,%esp
+f0100378:	6a 00                	push   $0x0
+f010037a:	68 d4 2e 17 f0       	push   $0xf0172ed4
+f010037f:	e8 d5 41 00 00       	call   f0104559 <env_create>
+f0100384:	e8 33 5c 00 00       	call   f0105fbc <sched_yield>
+
+f0100389 <mp_main>:
+f0100389:	55                   	push   %ebp
+f010038a:	89 e5                	mov    %esp,%ebp
+f010038c:	83 ec 08             	sub    $0x8,%esp
+f010038f:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f0100394:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0100399:	0f 86 85 00 00 00    	jbe    f0100424 <mp_main+0x9b>
+f010039f:	05 00 00 00 10       	add    $0x10000000,%eax
+f01003a4:	0f 22 d8             	mov    %eax,%cr3
+f01003a7:	e8 77 93 00 00       	call   f0109723 <lapic_id>
+f01003ac:	83 ec 0c             	sub    $0xc,%esp
+f01003af:	50                   	push   %eax
+f01003b0:	e8 a8 3f 00 00       	call   f010435d <env_init_gs>
+f01003b5:	c7 04 24 80 24 1a f0 	movl   $0xf01a2480,(%esp)
+f01003bc:	e8 e4 94 00 00       	call   f01098a5 <spin_lock>
+f01003c1:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01003c7:	83 c4 08             	add    $0x8,%esp
+f01003ca:	2d 40 70 25 f0       	sub    $0xf0257040,%eax
+f01003cf:	c1 f8 06             	sar    $0x6,%eax
+f01003d2:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01003d8:	50                   	push   %eax
+f01003d9:	68 28 9d 10 f0       	push   $0xf0109d28
+f01003de:	e8 40 4c 00 00       	call   f0105023 <cprintf>
+f01003e3:	c7 04 24 80 24 1a f0 	movl   $0xf01a2480,(%esp)
+f01003ea:	e8 4e 95 00 00       	call   f010993d <spin_unlock>
+f01003ef:	e8 05 92 00 00       	call   f01095f9 <lapic_init>
+f01003f4:	e8 52 47 00 00       	call   f0104b4b <env_init_percpu>
+f01003f9:	e8 39 4c 00 00       	call   f0105037 <trap_init_percpu>
+f01003fe:	e8 a6 3c 00 00       	call   f01040a9 <mem_check_percpu>
+f0100403:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f010040a:	b8 01 00 00 00       	mov    $0x1,%eax
+f010040f:	f0 87 42 18          	lock xchg %eax,0x18(%edx)
+f0100413:	c7 04 24 00 74 11 f0 	movl   $0xf0117400,(%esp)
+f010041a:	e8 86 94 00 00       	call   f01098a5 <spin_lock>
+f010041f:	e8 98 5b 00 00       	call   f0105fbc <sched_yield>
+f0100424:	50                   	push   %eax
+f0100425:	68 08 9e 10 f0       	push   $0xf0109e08
+f010042a:	68 ad 00 00 00       	push   $0xad
+f010042f:	68 0d 9d 10 f0       	push   $0xf0109d0d
+f0100434:	e8 f2 fc ff ff       	call   f010012b <_panic>
+
+f0100439 <_warn>:
+f0100439:	55                   	push   %ebp
+f010043a:	89 e5                	mov    %esp,%ebp
+f010043c:	53                   	push   %ebx
+f010043d:	83 ec 08             	sub    $0x8,%esp
+f0100440:	8d 5d 14             	lea    0x14(%ebp),%ebx
+f0100443:	ff 75 0c             	push   0xc(%ebp)
+f0100446:	ff 75 08             	push   0x8(%ebp)
+f0100449:	68 3e 9d 10 f0       	push   $0xf0109d3e
+f010044e:	e8 d0 4b 00 00       	call   f0105023 <cprintf>
+f0100453:	83 c4 08             	add    $0x8,%esp
+f0100456:	53                   	push   %ebx
+f0100457:	ff 75 10             	push   0x10(%ebp)
+f010045a:	e8 9e 4b 00 00       	call   f0104ffd <vcprintf>
+f010045f:	c7 04 24 50 b1 10 f0 	movl   $0xf010b150,(%esp)
+f0100466:	e8 b8 4b 00 00       	call   f0105023 <cprintf>
+f010046b:	83 c4 10             	add    $0x10,%esp
+f010046e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100471:	c9                   	leave
+f0100472:	c3                   	ret
+
+f0100473 <serial_proc_data>:
+f0100473:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100478:	ec                   	in     (%dx),%al
+f0100479:	a8 01                	test   $0x1,%al
+f010047b:	74 0a                	je     f0100487 <serial_proc_data+0x14>
+f010047d:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100482:	ec                   	in     (%dx),%al
+f0100483:	0f b6 c0             	movzbl %al,%eax
+f0100486:	c3                   	ret
+f0100487:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010048c:	c3                   	ret
+
+f010048d <serial_tx_start>:
+f010048d:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100492:	ec                   	in     (%dx),%al
+f0100493:	a8 20                	test   $0x20,%al
+f0100495:	0f 84 9d 00 00 00    	je     f0100538 <serial_tx_start+0xab>
+f010049b:	55                   	push   %ebp
+f010049c:	89 e5                	mov    %esp,%ebp
+f010049e:	57                   	push   %edi
+f010049f:	56                   	push   %esi
+f01004a0:	53                   	push   %ebx
+f01004a1:	83 ec 08             	sub    $0x8,%esp
+f01004a4:	8b 1d 00 73 11 f0    	mov    0xf0117300,%ebx
+f01004aa:	a1 04 37 1a f0       	mov    0xf01a3704,%eax
+f01004af:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f01004b2:	8b 3d 00 37 1a f0    	mov    0xf01a3700,%edi
+f01004b8:	89 c6                	mov    %eax,%esi
+f01004ba:	29 fe                	sub    %edi,%esi
+f01004bc:	c6 45 f3 00          	movb   $0x0,-0xd(%ebp)
+f01004c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01004c5:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01004ca:	8d 04 39             	lea    (%ecx,%edi,1),%eax
+f01004cd:	39 cb                	cmp    %ecx,%ebx
+f01004cf:	7e 1a                	jle    f01004eb <serial_tx_start+0x5e>
+f01004d1:	39 f1                	cmp    %esi,%ecx
+f01004d3:	74 56                	je     f010052b <serial_tx_start+0x9e>
+f01004d5:	25 ff 0f 00 00       	and    $0xfff,%eax
+f01004da:	0f b6 80 00 27 1a f0 	movzbl -0xfe5d900(%eax),%eax
+f01004e1:	ee                   	out    %al,(%dx)
+f01004e2:	83 c1 01             	add    $0x1,%ecx
+f01004e5:	c6 45 f3 01          	movb   $0x1,-0xd(%ebp)
+f01004e9:	eb df                	jmp    f01004ca <serial_tx_start+0x3d>
+f01004eb:	80 7d f3 00          	cmpb   $0x0,-0xd(%ebp)
+f01004ef:	74 05                	je     f01004f6 <serial_tx_start+0x69>
+f01004f1:	a3 00 37 1a f0       	mov    %eax,0xf01a3700
+f01004f6:	a1 00 37 1a f0       	mov    0xf01a3700,%eax
+f01004fb:	8b 7d ec             	mov    -0x14(%ebp),%edi
+f01004fe:	39 c7                	cmp    %eax,%edi
+f0100500:	0f 95 c2             	setne  %dl
+f0100503:	38 15 08 37 1a f0    	cmp    %dl,0xf01a3708
+f0100509:	74 18                	je     f0100523 <serial_tx_start+0x96>
+f010050b:	88 15 08 37 1a f0    	mov    %dl,0xf01a3708
+f0100511:	39 c7                	cmp    %eax,%edi
+f0100513:	0f 95 c0             	setne  %al
+f0100516:	0f b6 c0             	movzbl %al,%eax
+f0100519:	8d 44 00 01          	lea    0x1(%eax,%eax,1),%eax
+f010051d:	ba f9 03 00 00       	mov    $0x3f9,%edx
+f0100522:	ee                   	out    %al,(%dx)
+f0100523:	83 c4 08             	add    $0x8,%esp
+f0100526:	5b                   	pop    %ebx
+f0100527:	5e                   	pop    %esi
+f0100528:	5f                   	pop    %edi
+f0100529:	5d                   	pop    %ebp
+f010052a:	c3                   	ret
+f010052b:	80 7d f3 00          	cmpb   $0x0,-0xd(%ebp)
+f010052f:	74 c5                	je     f01004f6 <serial_tx_start+0x69>
+f0100531:	a3 00 37 1a f0       	mov    %eax,0xf01a3700
+f0100536:	eb be                	jmp    f01004f6 <serial_tx_start+0x69>
+f0100538:	c3                   	ret
+
+f0100539 <serial_queue>:
+f0100539:	55                   	push   %ebp
+f010053a:	89 e5                	mov    %esp,%ebp
+f010053c:	57                   	push   %edi
+f010053d:	56                   	push   %esi
+f010053e:	53                   	push   %ebx
+f010053f:	83 ec 04             	sub    $0x4,%esp
+f0100542:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f0100545:	be 00 00 00 00       	mov    $0x0,%esi
+f010054a:	bf 00 27 1a f0       	mov    $0xf01a2700,%edi
+f010054f:	bb 84 00 00 00       	mov    $0x84,%ebx
+f0100554:	8b 87 04 10 00 00    	mov    0x1004(%edi),%eax
+f010055a:	89 c2                	mov    %eax,%edx
+f010055c:	2b 97 00 10 00 00    	sub    0x1000(%edi),%edx
+f0100562:	81 fe ff 31 00 00    	cmp    $0x31ff,%esi
+f0100568:	7f 18                	jg     f0100582 <serial_queue+0x49>
+f010056a:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+f0100570:	76 10                	jbe    f0100582 <serial_queue+0x49>
+f0100572:	e8 16 ff ff ff       	call   f010048d <serial_tx_start>
+f0100577:	89 da                	mov    %ebx,%edx
+f0100579:	ec                   	in     (%dx),%al
+f010057a:	ec                   	in     (%dx),%al
+f010057b:	ec                   	in     (%dx),%al
+f010057c:	ec                   	in     (%dx),%al
+f010057d:	83 c6 01             	add    $0x1,%esi
+f0100580:	eb d2                	jmp    f0100554 <serial_queue+0x1b>
+f0100582:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+f0100588:	77 18                	ja     f01005a2 <serial_queue+0x69>
+f010058a:	8d 50 01             	lea    0x1(%eax),%edx
+f010058d:	89 15 04 37 1a f0    	mov    %edx,0xf01a3704
+f0100593:	25 ff 0f 00 00       	and    $0xfff,%eax
+f0100598:	0f b6 4d f0          	movzbl -0x10(%ebp),%ecx
+f010059c:	88 88 00 27 1a f0    	mov    %cl,-0xfe5d900(%eax)
+f01005a2:	83 c4 04             	add    $0x4,%esp
+f01005a5:	5b                   	pop    %ebx
+f01005a6:	5e                   	pop    %esi
+f01005a7:	5f                   	pop    %edi
+f01005a8:	5d                   	pop    %ebp
+f01005a9:	c3                   	ret
+
+f01005aa <cga_setcursor>:
+f01005aa:	55                   	push   %ebp
+f01005ab:	89 e5                	mov    %esp,%ebp
+f01005ad:	56                   	push   %esi
+f01005ae:	53                   	push   %ebx
+f01005af:	8b 0d f0 26 1a f0    	mov    0xf01a26f0,%ecx
+f01005b5:	b8 0e 00 00 00       	mov    $0xe,%eax
+f01005ba:	89 ca                	mov    %ecx,%edx
+f01005bc:	ee                   	out    %al,(%dx)
+f01005bd:	0f b7 1d e8 26 1a f0 	movzwl 0xf01a26e8,%ebx
+f01005c4:	8d 71 01             	lea    0x1(%ecx),%esi
+f01005c7:	89 d8                	mov    %ebx,%eax
+f01005c9:	66 c1 e8 08          	shr    $0x8,%ax
+f01005cd:	89 f2                	mov    %esi,%edx
+f01005cf:	ee                   	out    %al,(%dx)
+f01005d0:	b8 0f 00 00 00       	mov    $0xf,%eax
+f01005d5:	89 ca                	mov    %ecx,%edx
+f01005d7:	ee                   	out    %al,(%dx)
+f01005d8:	89 d8                	mov    %ebx,%eax
+f01005da:	89 f2                	mov    %esi,%edx
+f01005dc:	ee                   	out    %al,(%dx)
+f01005dd:	5b                   	pop    %ebx
+f01005de:	5e                   	pop    %esi
+f01005df:	5d                   	pop    %ebp
+f01005e0:	c3                   	ret
+
+f01005e1 <cons_intr>:
+f01005e1:	55                   	push   %ebp
+f01005e2:	89 e5                	mov    %esp,%ebp
+f01005e4:	53                   	push   %ebx
+f01005e5:	83 ec 04             	sub    $0x4,%esp
+f01005e8:	89 c3                	mov    %eax,%ebx
+f01005ea:	eb 23                	jmp    f010060f <cons_intr+0x2e>
+f01005ec:	8b 0d e4 26 1a f0    	mov    0xf01a26e4,%ecx
+f01005f2:	8d 51 01             	lea    0x1(%ecx),%edx
+f01005f5:	88 81 e0 24 1a f0    	mov    %al,-0xfe5db20(%ecx)
+f01005fb:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+f0100601:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100606:	0f 44 d0             	cmove  %eax,%edx
+f0100609:	89 15 e4 26 1a f0    	mov    %edx,0xf01a26e4
+f010060f:	ff d3                	call   *%ebx
+f0100611:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0100614:	74 06                	je     f010061c <cons_intr+0x3b>
+f0100616:	85 c0                	test   %eax,%eax
+f0100618:	75 d2                	jne    f01005ec <cons_intr+0xb>
+f010061a:	eb f3                	jmp    f010060f <cons_intr+0x2e>
+f010061c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010061f:	c9                   	leave
+f0100620:	c3                   	ret
+
+f0100621 <kbd_proc_data>:
+f0100621:	55                   	push   %ebp
+f0100622:	89 e5                	mov    %esp,%ebp
+f0100624:	53                   	push   %ebx
+f0100625:	83 ec 04             	sub    $0x4,%esp
+f0100628:	ba 64 00 00 00       	mov    $0x64,%edx
+f010062d:	ec                   	in     (%dx),%al
+f010062e:	a8 01                	test   $0x1,%al
+f0100630:	0f 84 ee 00 00 00    	je     f0100724 <kbd_proc_data+0x103>
+f0100636:	a8 20                	test   $0x20,%al
+f0100638:	0f 85 ed 00 00 00    	jne    f010072b <kbd_proc_data+0x10a>
+f010063e:	ba 60 00 00 00       	mov    $0x60,%edx
+f0100643:	ec                   	in     (%dx),%al
+f0100644:	89 c2                	mov    %eax,%edx
+f0100646:	3c e0                	cmp    $0xe0,%al
+f0100648:	74 61                	je     f01006ab <kbd_proc_data+0x8a>
+f010064a:	84 c0                	test   %al,%al
+f010064c:	78 70                	js     f01006be <kbd_proc_data+0x9d>
+f010064e:	8b 0d c0 24 1a f0    	mov    0xf01a24c0,%ecx
+f0100654:	f6 c1 40             	test   $0x40,%cl
+f0100657:	74 0e                	je     f0100667 <kbd_proc_data+0x46>
+f0100659:	83 c8 80             	or     $0xffffff80,%eax
+f010065c:	89 c2                	mov    %eax,%edx
+f010065e:	83 e1 bf             	and    $0xffffffbf,%ecx
+f0100661:	89 0d c0 24 1a f0    	mov    %ecx,0xf01a24c0
+f0100667:	0f b6 d2             	movzbl %dl,%edx
+f010066a:	0f b6 82 c0 9f 10 f0 	movzbl -0xfef6040(%edx),%eax
+f0100671:	0b 05 c0 24 1a f0    	or     0xf01a24c0,%eax
+f0100677:	0f b6 8a c0 9e 10 f0 	movzbl -0xfef6140(%edx),%ecx
+f010067e:	31 c8                	xor    %ecx,%eax
+f0100680:	a3 c0 24 1a f0       	mov    %eax,0xf01a24c0
+f0100685:	89 c1                	mov    %eax,%ecx
+f0100687:	83 e1 03             	and    $0x3,%ecx
+f010068a:	8b 0c 8d a0 9e 10 f0 	mov    -0xfef6160(,%ecx,4),%ecx
+f0100691:	0f b6 14 11          	movzbl (%ecx,%edx,1),%edx
+f0100695:	0f b6 da             	movzbl %dl,%ebx
+f0100698:	a8 08                	test   $0x8,%al
+f010069a:	74 5d                	je     f01006f9 <kbd_proc_data+0xd8>
+f010069c:	89 da                	mov    %ebx,%edx
+f010069e:	8d 4b 9f             	lea    -0x61(%ebx),%ecx
+f01006a1:	83 f9 19             	cmp    $0x19,%ecx
+f01006a4:	77 47                	ja     f01006ed <kbd_proc_data+0xcc>
+f01006a6:	83 eb 20             	sub    $0x20,%ebx
+f01006a9:	eb 0c                	jmp    f01006b7 <kbd_proc_data+0x96>
+f01006ab:	83 0d c0 24 1a f0 40 	orl    $0x40,0xf01a24c0
+f01006b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01006b7:	89 d8                	mov    %ebx,%eax
+f01006b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01006bc:	c9                   	leave
+f01006bd:	c3                   	ret
+f01006be:	8b 0d c0 24 1a f0    	mov    0xf01a24c0,%ecx
+f01006c4:	83 e0 7f             	and    $0x7f,%eax
+f01006c7:	f6 c1 40             	test   $0x40,%cl
+f01006ca:	0f 44 d0             	cmove  %eax,%edx
+f01006cd:	0f b6 d2             	movzbl %dl,%edx
+f01006d0:	0f b6 82 c0 9f 10 f0 	movzbl -0xfef6040(%edx),%eax
+f01006d7:	83 c8 40             	or     $0x40,%eax
+f01006da:	0f b6 c0             	movzbl %al,%eax
+f01006dd:	f7 d0                	not    %eax
+f01006df:	21 c8                	and    %ecx,%eax
+f01006e1:	a3 c0 24 1a f0       	mov    %eax,0xf01a24c0
+f01006e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01006eb:	eb ca                	jmp    f01006b7 <kbd_proc_data+0x96>
+f01006ed:	83 ea 41             	sub    $0x41,%edx
+f01006f0:	8d 4b 20             	lea    0x20(%ebx),%ecx
+f01006f3:	83 fa 1a             	cmp    $0x1a,%edx
+f01006f6:	0f 42 d9             	cmovb  %ecx,%ebx
+f01006f9:	f7 d0                	not    %eax
+f01006fb:	a8 06                	test   $0x6,%al
+f01006fd:	75 b8                	jne    f01006b7 <kbd_proc_data+0x96>
+f01006ff:	81 fb e9 00 00 00    	cmp    $0xe9,%ebx
+f0100705:	75 b0                	jne    f01006b7 <kbd_proc_data+0x96>
+f0100707:	83 ec 0c             	sub    $0xc,%esp
+f010070a:	68 64 9e 10 f0       	push   $0xf0109e64
+f010070f:	e8 0f 49 00 00       	call   f0105023 <cprintf>
+f0100714:	b8 03 00 00 00       	mov    $0x3,%eax
+f0100719:	ba 92 00 00 00       	mov    $0x92,%edx
+f010071e:	ee                   	out    %al,(%dx)
+f010071f:	83 c4 10             	add    $0x10,%esp
+f0100722:	eb 93                	jmp    f01006b7 <kbd_proc_data+0x96>
+f0100724:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f0100729:	eb 8c                	jmp    f01006b7 <kbd_proc_data+0x96>
+f010072b:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f0100730:	eb 85                	jmp    f01006b7 <kbd_proc_data+0x96>
+
+f0100732 <lpt_putc>:
+f0100732:	55                   	push   %ebp
+f0100733:	89 e5                	mov    %esp,%ebp
+f0100735:	57                   	push   %edi
+f0100736:	56                   	push   %esi
+f0100737:	53                   	push   %ebx
+f0100738:	89 c7                	mov    %eax,%edi
+f010073a:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010073f:	be 79 03 00 00       	mov    $0x379,%esi
+f0100744:	b9 84 00 00 00       	mov    $0x84,%ecx
+f0100749:	89 f2                	mov    %esi,%edx
+f010074b:	ec                   	in     (%dx),%al
+f010074c:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f0100752:	7f 0f                	jg     f0100763 <lpt_putc+0x31>
+f0100754:	84 c0                	test   %al,%al
+f0100756:	78 0b                	js     f0100763 <lpt_putc+0x31>
+f0100758:	89 ca                	mov    %ecx,%edx
+f010075a:	ec                   	in     (%dx),%al
+f010075b:	ec                   	in     (%dx),%al
+f010075c:	ec                   	in     (%dx),%al
+f010075d:	ec                   	in     (%dx),%al
+f010075e:	83 c3 01             	add    $0x1,%ebx
+f0100761:	eb e6                	jmp    f0100749 <lpt_putc+0x17>
+f0100763:	ba 78 03 00 00       	mov    $0x378,%edx
+f0100768:	89 f8                	mov    %edi,%eax
+f010076a:	ee                   	out    %al,(%dx)
+f010076b:	ba 7a 03 00 00       	mov    $0x37a,%edx
+f0100770:	b8 0d 00 00 00       	mov    $0xd,%eax
+f0100775:	ee                   	out    %al,(%dx)
+f0100776:	b8 08 00 00 00       	mov    $0x8,%eax
+f010077b:	ee                   	out    %al,(%dx)
+f010077c:	5b                   	pop    %ebx
+f010077d:	5e                   	pop    %esi
+f010077e:	5f                   	pop    %edi
+f010077f:	5d                   	pop    %ebp
+f0100780:	c3                   	ret
+
+f0100781 <cons_putc>:
+f0100781:	55                   	push   %ebp
+f0100782:	89 e5                	mov    %esp,%ebp
+f0100784:	53                   	push   %ebx
+f0100785:	83 ec 04             	sub    $0x4,%esp
+f0100788:	89 c3                	mov    %eax,%ebx
+f010078a:	80 3d 0c 37 1a f0 00 	cmpb   $0x0,0xf01a370c
+f0100791:	75 18                	jne    f01007ab <cons_putc+0x2a>
+f0100793:	89 d8                	mov    %ebx,%eax
+f0100795:	e8 98 ff ff ff       	call   f0100732 <lpt_putc>
+f010079a:	89 d8                	mov    %ebx,%eax
+f010079c:	e8 1f 00 00 00       	call   f01007c0 <cga_putc_nocursor>
+f01007a1:	e8 04 fe ff ff       	call   f01005aa <cga_setcursor>
+f01007a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01007a9:	c9                   	leave
+f01007aa:	c3                   	ret
+f01007ab:	e8 89 fd ff ff       	call   f0100539 <serial_queue>
+f01007b0:	80 3d 08 37 1a f0 00 	cmpb   $0x0,0xf01a3708
+f01007b7:	75 da                	jne    f0100793 <cons_putc+0x12>
+f01007b9:	e8 cf fc ff ff       	call   f010048d <serial_tx_start>
+f01007be:	eb d3                	jmp    f0100793 <cons_putc+0x12>
+
+f01007c0 <cga_putc_nocursor>:
+f01007c0:	55                   	push   %ebp
+f01007c1:	89 e5                	mov    %esp,%ebp
+f01007c3:	83 ec 08             	sub    $0x8,%esp
+f01007c6:	89 c2                	mov    %eax,%edx
+f01007c8:	80 ce 07             	or     $0x7,%dh
+f01007cb:	3d 00 01 00 00       	cmp    $0x100,%eax
+f01007d0:	0f 42 c2             	cmovb  %edx,%eax
+f01007d3:	3c 0a                	cmp    $0xa,%al
+f01007d5:	0f 84 a2 00 00 00    	je     f010087d <cga_putc_nocursor+0xbd>
+f01007db:	0f b6 d0             	movzbl %al,%edx
+f01007de:	83 fa 0a             	cmp    $0xa,%edx
+f01007e1:	7f 42                	jg     f0100825 <cga_putc_nocursor+0x65>
+f01007e3:	83 fa 08             	cmp    $0x8,%edx
+f01007e6:	74 6b                	je     f0100853 <cga_putc_nocursor+0x93>
+f01007e8:	83 fa 09             	cmp    $0x9,%edx
+f01007eb:	0f 85 96 00 00 00    	jne    f0100887 <cga_putc_nocursor+0xc7>
+f01007f1:	b8 20 00 00 00       	mov    $0x20,%eax
+f01007f6:	e8 86 ff ff ff       	call   f0100781 <cons_putc>
+f01007fb:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100800:	e8 7c ff ff ff       	call   f0100781 <cons_putc>
+f0100805:	b8 20 00 00 00       	mov    $0x20,%eax
+f010080a:	e8 72 ff ff ff       	call   f0100781 <cons_putc>
+f010080f:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100814:	e8 68 ff ff ff       	call   f0100781 <cons_putc>
+f0100819:	b8 20 00 00 00       	mov    $0x20,%eax
+f010081e:	e8 5e ff ff ff       	call   f0100781 <cons_putc>
+f0100823:	eb 21                	jmp    f0100846 <cga_putc_nocursor+0x86>
+f0100825:	83 fa 0d             	cmp    $0xd,%edx
+f0100828:	75 5d                	jne    f0100887 <cga_putc_nocursor+0xc7>
+f010082a:	0f b7 05 e8 26 1a f0 	movzwl 0xf01a26e8,%eax
+f0100831:	69 c0 cd cc 00 00    	imul   $0xcccd,%eax,%eax
+f0100837:	c1 e8 16             	shr    $0x16,%eax
+f010083a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f010083d:	c1 e0 04             	shl    $0x4,%eax
+f0100840:	66 a3 e8 26 1a f0    	mov    %ax,0xf01a26e8
+f0100846:	66 81 3d e8 26 1a f0 	cmpw   $0x7cf,0xf01a26e8
+f010084d:	cf 07 
+f010084f:	77 56                	ja     f01008a7 <cga_putc_nocursor+0xe7>
+f0100851:	c9                   	leave
+f0100852:	c3                   	ret
+f0100853:	0f b7 15 e8 26 1a f0 	movzwl 0xf01a26e8,%edx
+f010085a:	66 85 d2             	test   %dx,%dx
+f010085d:	74 f2                	je     f0100851 <cga_putc_nocursor+0x91>
+f010085f:	83 ea 01             	sub    $0x1,%edx
+f0100862:	66 89 15 e8 26 1a f0 	mov    %dx,0xf01a26e8
+f0100869:	0f b7 d2             	movzwl %dx,%edx
+f010086c:	b0 00                	mov    $0x0,%al
+f010086e:	83 c8 20             	or     $0x20,%eax
+f0100871:	8b 0d ec 26 1a f0    	mov    0xf01a26ec,%ecx
+f0100877:	66 89 04 51          	mov    %ax,(%ecx,%edx,2)
+f010087b:	eb c9                	jmp    f0100846 <cga_putc_nocursor+0x86>
+f010087d:	66 83 05 e8 26 1a f0 	addw   $0x50,0xf01a26e8
+f0100884:	50 
+f0100885:	eb a3                	jmp    f010082a <cga_putc_nocursor+0x6a>
+f0100887:	0f b7 15 e8 26 1a f0 	movzwl 0xf01a26e8,%edx
+f010088e:	8d 4a 01             	lea    0x1(%edx),%ecx
+f0100891:	66 89 0d e8 26 1a f0 	mov    %cx,0xf01a26e8
+f0100898:	0f b7 d2             	movzwl %dx,%edx
+f010089b:	8b 0d ec 26 1a f0    	mov    0xf01a26ec,%ecx
+f01008a1:	66 89 04 51          	mov    %ax,(%ecx,%edx,2)
+f01008a5:	eb 9f                	jmp    f0100846 <cga_putc_nocursor+0x86>
+f01008a7:	a1 ec 26 1a f0       	mov    0xf01a26ec,%eax
+f01008ac:	83 ec 04             	sub    $0x4,%esp
+f01008af:	68 00 0f 00 00       	push   $0xf00
+f01008b4:	8d 90 a0 00 00 00    	lea    0xa0(%eax),%edx
+f01008ba:	52                   	push   %edx
+f01008bb:	50                   	push   %eax
+f01008bc:	e8 17 86 00 00       	call   f0108ed8 <memmove>
+f01008c1:	8b 15 ec 26 1a f0    	mov    0xf01a26ec,%edx
+f01008c7:	8d 82 00 0f 00 00    	lea    0xf00(%edx),%eax
+f01008cd:	81 c2 a0 0f 00 00    	add    $0xfa0,%edx
+f01008d3:	83 c4 10             	add    $0x10,%esp
+f01008d6:	eb 08                	jmp    f01008e0 <cga_putc_nocursor+0x120>
+f01008d8:	66 c7 00 20 07       	movw   $0x720,(%eax)
+f01008dd:	83 c0 02             	add    $0x2,%eax
+f01008e0:	39 d0                	cmp    %edx,%eax
+f01008e2:	75 f4                	jne    f01008d8 <cga_putc_nocursor+0x118>
+f01008e4:	66 83 2d e8 26 1a f0 	subw   $0x50,0xf01a26e8
+f01008eb:	50 
+f01008ec:	e9 60 ff ff ff       	jmp    f0100851 <cga_putc_nocursor+0x91>
+
+f01008f1 <serial_intr>:
+f01008f1:	80 3d 0c 37 1a f0 00 	cmpb   $0x0,0xf01a370c
+f01008f8:	75 01                	jne    f01008fb <serial_intr+0xa>
+f01008fa:	c3                   	ret
+f01008fb:	55                   	push   %ebp
+f01008fc:	89 e5                	mov    %esp,%ebp
+f01008fe:	83 ec 08             	sub    $0x8,%esp
+f0100901:	b8 73 04 10 f0       	mov    $0xf0100473,%eax
+f0100906:	e8 d6 fc ff ff       	call   f01005e1 <cons_intr>
+f010090b:	e8 7d fb ff ff       	call   f010048d <serial_tx_start>
+f0100910:	c9                   	leave
+f0100911:	c3                   	ret
+
+f0100912 <kbd_intr>:
+f0100912:	55                   	push   %ebp
+f0100913:	89 e5                	mov    %esp,%ebp
+f0100915:	83 ec 08             	sub    $0x8,%esp
+f0100918:	b8 21 06 10 f0       	mov    $0xf0100621,%eax
+f010091d:	e8 bf fc ff ff       	call   f01005e1 <cons_intr>
+f0100922:	c9                   	leave
+f0100923:	c3                   	ret
+
+f0100924 <cons_getc>:
+f0100924:	55                   	push   %ebp
+f0100925:	89 e5                	mov    %esp,%ebp
+f0100927:	83 ec 08             	sub    $0x8,%esp
+f010092a:	e8 c2 ff ff ff       	call   f01008f1 <serial_intr>
+f010092f:	e8 de ff ff ff       	call   f0100912 <kbd_intr>
+f0100934:	a1 e0 26 1a f0       	mov    0xf01a26e0,%eax
+f0100939:	ba 00 00 00 00       	mov    $0x0,%edx
+f010093e:	3b 05 e4 26 1a f0    	cmp    0xf01a26e4,%eax
+f0100944:	74 1c                	je     f0100962 <cons_getc+0x3e>
+f0100946:	8d 48 01             	lea    0x1(%eax),%ecx
+f0100949:	0f b6 90 e0 24 1a f0 	movzbl -0xfe5db20(%eax),%edx
+f0100950:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+f0100955:	b8 00 00 00 00       	mov    $0x0,%eax
+f010095a:	0f 45 c1             	cmovne %ecx,%eax
+f010095d:	a3 e0 26 1a f0       	mov    %eax,0xf01a26e0
+f0100962:	89 d0                	mov    %edx,%eax
+f0100964:	c9                   	leave
+f0100965:	c3                   	ret
+
+f0100966 <cons_write>:
+f0100966:	55                   	push   %ebp
+f0100967:	89 e5                	mov    %esp,%ebp
+f0100969:	57                   	push   %edi
+f010096a:	56                   	push   %esi
+f010096b:	53                   	push   %ebx
+f010096c:	83 ec 1c             	sub    $0x1c,%esp
+f010096f:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0100972:	eb 15                	jmp    f0100989 <cons_write+0x23>
+f0100974:	85 db                	test   %ebx,%ebx
+f0100976:	75 33                	jne    f01009ab <cons_write+0x45>
+f0100978:	8d 5f 01             	lea    0x1(%edi),%ebx
+f010097b:	0f be 07             	movsbl (%edi),%eax
+f010097e:	e8 fe fd ff ff       	call   f0100781 <cons_putc>
+f0100983:	83 6d 0c 01          	subl   $0x1,0xc(%ebp)
+f0100987:	89 df                	mov    %ebx,%edi
+f0100989:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f010098d:	0f 84 97 00 00 00    	je     f0100a2a <cons_write+0xc4>
+f0100993:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0100998:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010099b:	80 3c 1f 09          	cmpb   $0x9,(%edi,%ebx,1)
+f010099f:	74 d3                	je     f0100974 <cons_write+0xe>
+f01009a1:	83 c3 01             	add    $0x1,%ebx
+f01009a4:	39 d8                	cmp    %ebx,%eax
+f01009a6:	75 f3                	jne    f010099b <cons_write+0x35>
+f01009a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01009ab:	80 3d 0c 37 1a f0 00 	cmpb   $0x0,0xf01a370c
+f01009b2:	74 2d                	je     f01009e1 <cons_write+0x7b>
+f01009b4:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+f01009b7:	89 fe                	mov    %edi,%esi
+f01009b9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f01009bc:	89 c3                	mov    %eax,%ebx
+f01009be:	eb 0c                	jmp    f01009cc <cons_write+0x66>
+f01009c0:	83 c6 01             	add    $0x1,%esi
+f01009c3:	0f be 46 ff          	movsbl -0x1(%esi),%eax
+f01009c7:	e8 6d fb ff ff       	call   f0100539 <serial_queue>
+f01009cc:	39 de                	cmp    %ebx,%esi
+f01009ce:	75 f0                	jne    f01009c0 <cons_write+0x5a>
+f01009d0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f01009d3:	b8 00 27 1a f0       	mov    $0xf01a2700,%eax
+f01009d8:	80 b8 08 10 00 00 00 	cmpb   $0x0,0x1008(%eax)
+f01009df:	74 1b                	je     f01009fc <cons_write+0x96>
+f01009e1:	89 fe                	mov    %edi,%esi
+f01009e3:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+f01009e6:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f01009e9:	89 c3                	mov    %eax,%ebx
+f01009eb:	39 de                	cmp    %ebx,%esi
+f01009ed:	74 14                	je     f0100a03 <cons_write+0x9d>
+f01009ef:	0f be 06             	movsbl (%esi),%eax
+f01009f2:	e8 3b fd ff ff       	call   f0100732 <lpt_putc>
+f01009f7:	83 c6 01             	add    $0x1,%esi
+f01009fa:	eb ef                	jmp    f01009eb <cons_write+0x85>
+f01009fc:	e8 8c fa ff ff       	call   f010048d <serial_tx_start>
+f0100a01:	eb de                	jmp    f01009e1 <cons_write+0x7b>
+f0100a03:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0100a06:	8d 34 1f             	lea    (%edi,%ebx,1),%esi
+f0100a09:	39 f7                	cmp    %esi,%edi
+f0100a0b:	74 0e                	je     f0100a1b <cons_write+0xb5>
+f0100a0d:	83 c7 01             	add    $0x1,%edi
+f0100a10:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+f0100a14:	e8 a7 fd ff ff       	call   f01007c0 <cga_putc_nocursor>
+f0100a19:	eb ee                	jmp    f0100a09 <cons_write+0xa3>
+f0100a1b:	e8 8a fb ff ff       	call   f01005aa <cga_setcursor>
+f0100a20:	29 5d 0c             	sub    %ebx,0xc(%ebp)
+f0100a23:	89 f7                	mov    %esi,%edi
+f0100a25:	e9 5f ff ff ff       	jmp    f0100989 <cons_write+0x23>
+f0100a2a:	83 c4 1c             	add    $0x1c,%esp
+f0100a2d:	5b                   	pop    %ebx
+f0100a2e:	5e                   	pop    %esi
+f0100a2f:	5f                   	pop    %edi
+f0100a30:	5d                   	pop    %ebp
+f0100a31:	c3                   	ret
+
+f0100a32 <cons_init>:
+f0100a32:	55                   	push   %ebp
+f0100a33:	89 e5                	mov    %esp,%ebp
+f0100a35:	57                   	push   %edi
+f0100a36:	56                   	push   %esi
+f0100a37:	53                   	push   %ebx
+f0100a38:	83 ec 0c             	sub    $0xc,%esp
+f0100a3b:	0f b7 15 00 80 0b f0 	movzwl 0xf00b8000,%edx
+f0100a42:	66 c7 05 00 80 0b f0 	movw   $0xa55a,0xf00b8000
+f0100a49:	5a a5 
+f0100a4b:	0f b7 05 00 80 0b f0 	movzwl 0xf00b8000,%eax
+f0100a52:	bb b4 03 00 00       	mov    $0x3b4,%ebx
+f0100a57:	be 00 00 0b f0       	mov    $0xf00b0000,%esi
+f0100a5c:	66 3d 5a a5          	cmp    $0xa55a,%ax
+f0100a60:	0f 84 d8 00 00 00    	je     f0100b3e <cons_init+0x10c>
+f0100a66:	89 1d f0 26 1a f0    	mov    %ebx,0xf01a26f0
+f0100a6c:	b8 0e 00 00 00       	mov    $0xe,%eax
+f0100a71:	89 da                	mov    %ebx,%edx
+f0100a73:	ee                   	out    %al,(%dx)
+f0100a74:	8d 7b 01             	lea    0x1(%ebx),%edi
+f0100a77:	89 fa                	mov    %edi,%edx
+f0100a79:	ec                   	in     (%dx),%al
+f0100a7a:	0f b6 c8             	movzbl %al,%ecx
+f0100a7d:	c1 e1 08             	shl    $0x8,%ecx
+f0100a80:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0100a85:	89 da                	mov    %ebx,%edx
+f0100a87:	ee                   	out    %al,(%dx)
+f0100a88:	89 fa                	mov    %edi,%edx
+f0100a8a:	ec                   	in     (%dx),%al
+f0100a8b:	89 35 ec 26 1a f0    	mov    %esi,0xf01a26ec
+f0100a91:	0f b6 c0             	movzbl %al,%eax
+f0100a94:	09 c8                	or     %ecx,%eax
+f0100a96:	66 a3 e8 26 1a f0    	mov    %ax,0xf01a26e8
+f0100a9c:	e8 71 fe ff ff       	call   f0100912 <kbd_intr>
+f0100aa1:	83 ec 0c             	sub    $0xc,%esp
+f0100aa4:	0f b7 05 e8 73 11 f0 	movzwl 0xf01173e8,%eax
+f0100aab:	25 fd ff 00 00       	and    $0xfffd,%eax
+f0100ab0:	50                   	push   %eax
+f0100ab1:	e8 0b 44 00 00       	call   f0104ec1 <irq_setmask_8259A>
+f0100ab6:	bb fa 03 00 00       	mov    $0x3fa,%ebx
+f0100abb:	b8 07 00 00 00       	mov    $0x7,%eax
+f0100ac0:	89 da                	mov    %ebx,%edx
+f0100ac2:	ee                   	out    %al,(%dx)
+f0100ac3:	be fb 03 00 00       	mov    $0x3fb,%esi
+f0100ac8:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+f0100acd:	89 f2                	mov    %esi,%edx
+f0100acf:	ee                   	out    %al,(%dx)
+f0100ad0:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0100ad5:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100ada:	ee                   	out    %al,(%dx)
+f0100adb:	b9 f9 03 00 00       	mov    $0x3f9,%ecx
+f0100ae0:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100ae5:	89 ca                	mov    %ecx,%edx
+f0100ae7:	ee                   	out    %al,(%dx)
+f0100ae8:	b8 03 00 00 00       	mov    $0x3,%eax
+f0100aed:	89 f2                	mov    %esi,%edx
+f0100aef:	ee                   	out    %al,(%dx)
+f0100af0:	b8 08 00 00 00       	mov    $0x8,%eax
+f0100af5:	ba fc 03 00 00       	mov    $0x3fc,%edx
+f0100afa:	ee                   	out    %al,(%dx)
+f0100afb:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100b00:	89 ca                	mov    %ecx,%edx
+f0100b02:	ee                   	out    %al,(%dx)
+f0100b03:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100b08:	ec                   	in     (%dx),%al
+f0100b09:	89 c1                	mov    %eax,%ecx
+f0100b0b:	83 c4 10             	add    $0x10,%esp
+f0100b0e:	3c ff                	cmp    $0xff,%al
+f0100b10:	0f 95 05 0c 37 1a f0 	setne  0xf01a370c
+f0100b17:	89 da                	mov    %ebx,%edx
+f0100b19:	ec                   	in     (%dx),%al
+f0100b1a:	83 e0 c0             	and    $0xffffffc0,%eax
+f0100b1d:	3c c0                	cmp    $0xc0,%al
+f0100b1f:	74 33                	je     f0100b54 <cons_init+0x122>
+f0100b21:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100b26:	ec                   	in     (%dx),%al
+f0100b27:	80 f9 ff             	cmp    $0xff,%cl
+f0100b2a:	75 34                	jne    f0100b60 <cons_init+0x12e>
+f0100b2c:	83 ec 0c             	sub    $0xc,%esp
+f0100b2f:	68 70 9e 10 f0       	push   $0xf0109e70
+f0100b34:	e8 ea 44 00 00       	call   f0105023 <cprintf>
+f0100b39:	83 c4 10             	add    $0x10,%esp
+f0100b3c:	eb 43                	jmp    f0100b81 <cons_init+0x14f>
+f0100b3e:	66 89 15 00 80 0b f0 	mov    %dx,0xf00b8000
+f0100b45:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+f0100b4a:	be 00 80 0b f0       	mov    $0xf00b8000,%esi
+f0100b4f:	e9 12 ff ff ff       	jmp    f0100a66 <cons_init+0x34>
+f0100b54:	c7 05 00 73 11 f0 10 	movl   $0x10,0xf0117300
+f0100b5b:	00 00 00 
+f0100b5e:	eb c1                	jmp    f0100b21 <cons_init+0xef>
+f0100b60:	83 ec 0c             	sub    $0xc,%esp
+f0100b63:	0f b7 05 e8 73 11 f0 	movzwl 0xf01173e8,%eax
+f0100b6a:	25 ef ff 00 00       	and    $0xffef,%eax
+f0100b6f:	50                   	push   %eax
+f0100b70:	e8 4c 43 00 00       	call   f0104ec1 <irq_setmask_8259A>
+f0100b75:	83 c4 10             	add    $0x10,%esp
+f0100b78:	80 3d 0c 37 1a f0 00 	cmpb   $0x0,0xf01a370c
+f0100b7f:	74 ab                	je     f0100b2c <cons_init+0xfa>
+f0100b81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100b84:	5b                   	pop    %ebx
+f0100b85:	5e                   	pop    %esi
+f0100b86:	5f                   	pop    %edi
+f0100b87:	5d                   	pop    %ebp
+f0100b88:	c3                   	ret
+
+f0100b89 <cputchar>:
+f0100b89:	55                   	push   %ebp
+f0100b8a:	89 e5                	mov    %esp,%ebp
+f0100b8c:	83 ec 08             	sub    $0x8,%esp
+f0100b8f:	8b 45 08             	mov    0x8(%ebp),%eax
+f0100b92:	e8 ea fb ff ff       	call   f0100781 <cons_putc>
+f0100b97:	c9                   	leave
+f0100b98:	c3                   	ret
+
+f0100b99 <getchar>:
+f0100b99:	55                   	push   %ebp
+f0100b9a:	89 e5                	mov    %esp,%ebp
+f0100b9c:	83 ec 08             	sub    $0x8,%esp
+f0100b9f:	e8 80 fd ff ff       	call   f0100924 <cons_getc>
+f0100ba4:	85 c0                	test   %eax,%eax
+f0100ba6:	74 f7                	je     f0100b9f <getchar+0x6>
+f0100ba8:	c9                   	leave
+f0100ba9:	c3                   	ret
+
+f0100baa <iscons>:
+f0100baa:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100baf:	c3                   	ret
+
+f0100bb0 <mon_help>:
+f0100bb0:	55                   	push   %ebp
+f0100bb1:	89 e5                	mov    %esp,%ebp
+f0100bb3:	56                   	push   %esi
+f0100bb4:	53                   	push   %ebx
+f0100bb5:	bb 40 a6 10 f0       	mov    $0xf010a640,%ebx
+f0100bba:	be b8 a6 10 f0       	mov    $0xf010a6b8,%esi
+f0100bbf:	eb 18                	jmp    f0100bd9 <mon_help+0x29>
+f0100bc1:	83 ec 04             	sub    $0x4,%esp
+f0100bc4:	ff 73 04             	push   0x4(%ebx)
+f0100bc7:	ff 33                	push   (%ebx)
+f0100bc9:	68 c0 a0 10 f0       	push   $0xf010a0c0
+f0100bce:	e8 50 44 00 00       	call   f0105023 <cprintf>
+f0100bd3:	83 c3 0c             	add    $0xc,%ebx
+f0100bd6:	83 c4 10             	add    $0x10,%esp
+f0100bd9:	39 f3                	cmp    %esi,%ebx
+f0100bdb:	75 e4                	jne    f0100bc1 <mon_help+0x11>
+f0100bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100be2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0100be5:	5b                   	pop    %ebx
+f0100be6:	5e                   	pop    %esi
+f0100be7:	5d                   	pop    %ebp
+f0100be8:	c3                   	ret
+
+f0100be9 <mon_show>:
+f0100be9:	55                   	push   %ebp
+f0100bea:	89 e5                	mov    %esp,%ebp
+f0100bec:	83 ec 14             	sub    $0x14,%esp
+f0100bef:	68 c9 a0 10 f0       	push   $0xf010a0c9
+f0100bf4:	e8 2a 44 00 00       	call   f0105023 <cprintf>
+f0100bf9:	c7 04 24 e3 a0 10 f0 	movl   $0xf010a0e3,(%esp)
+f0100c00:	e8 1e 44 00 00       	call   f0105023 <cprintf>
+f0100c05:	c7 04 24 fd a0 10 f0 	movl   $0xf010a0fd,(%esp)
+f0100c0c:	e8 12 44 00 00       	call   f0105023 <cprintf>
+f0100c11:	c7 04 24 17 a1 10 f0 	movl   $0xf010a117,(%esp)
+f0100c18:	e8 06 44 00 00       	call   f0105023 <cprintf>
+f0100c1d:	c7 04 24 5c a2 10 f0 	movl   $0xf010a25c,(%esp)
+f0100c24:	e8 fa 43 00 00       	call   f0105023 <cprintf>
+f0100c29:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100c2e:	c9                   	leave
+f0100c2f:	c3                   	ret
+
+f0100c30 <mon_kerninfo>:
+f0100c30:	55                   	push   %ebp
+f0100c31:	89 e5                	mov    %esp,%ebp
+f0100c33:	83 ec 14             	sub    $0x14,%esp
+f0100c36:	68 31 a1 10 f0       	push   $0xf010a131
+f0100c3b:	e8 e3 43 00 00       	call   f0105023 <cprintf>
+f0100c40:	83 c4 08             	add    $0x8,%esp
+f0100c43:	68 0c 00 10 00       	push   $0x10000c
+f0100c48:	68 80 a2 10 f0       	push   $0xf010a280
+f0100c4d:	e8 d1 43 00 00       	call   f0105023 <cprintf>
+f0100c52:	83 c4 0c             	add    $0xc,%esp
+f0100c55:	68 0c 00 10 00       	push   $0x10000c
+f0100c5a:	68 0c 00 10 f0       	push   $0xf010000c
+f0100c5f:	68 a8 a2 10 f0       	push   $0xf010a2a8
+f0100c64:	e8 ba 43 00 00       	call   f0105023 <cprintf>
+f0100c69:	83 c4 0c             	add    $0xc,%esp
+f0100c6c:	68 a6 9c 10 00       	push   $0x109ca6
+f0100c71:	68 a6 9c 10 f0       	push   $0xf0109ca6
+f0100c76:	68 cc a2 10 f0       	push   $0xf010a2cc
+f0100c7b:	e8 a3 43 00 00       	call   f0105023 <cprintf>
+f0100c80:	83 c4 0c             	add    $0xc,%esp
+f0100c83:	68 00 20 1a 00       	push   $0x1a2000
+f0100c88:	68 00 20 1a f0       	push   $0xf01a2000
+f0100c8d:	68 f0 a2 10 f0       	push   $0xf010a2f0
+f0100c92:	e8 8c 43 00 00       	call   f0105023 <cprintf>
+f0100c97:	83 c4 0c             	add    $0xc,%esp
+f0100c9a:	68 48 76 25 00       	push   $0x257648
+f0100c9f:	68 48 76 25 f0       	push   $0xf0257648
+f0100ca4:	68 14 a3 10 f0       	push   $0xf010a314
+f0100ca9:	e8 75 43 00 00       	call   f0105023 <cprintf>
+f0100cae:	83 c4 08             	add    $0x8,%esp
+f0100cb1:	b8 48 76 25 f0       	mov    $0xf0257648,%eax
+f0100cb6:	2d 0d fc 0f f0       	sub    $0xf00ffc0d,%eax
+f0100cbb:	c1 f8 0a             	sar    $0xa,%eax
+f0100cbe:	50                   	push   %eax
+f0100cbf:	68 38 a3 10 f0       	push   $0xf010a338
+f0100cc4:	e8 5a 43 00 00       	call   f0105023 <cprintf>
+f0100cc9:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100cce:	c9                   	leave
+f0100ccf:	c3                   	ret
+
+f0100cd0 <mon_sysstats>:
+f0100cd0:	55                   	push   %ebp
+f0100cd1:	89 e5                	mov    %esp,%ebp
+f0100cd3:	83 ec 08             	sub    $0x8,%esp
+f0100cd6:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f0100cda:	7e 1a                	jle    f0100cf6 <mon_sysstats+0x26>
+f0100cdc:	83 ec 08             	sub    $0x8,%esp
+f0100cdf:	68 4a a1 10 f0       	push   $0xf010a14a
+f0100ce4:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100ce7:	ff 70 04             	push   0x4(%eax)
+f0100cea:	e8 fa 80 00 00       	call   f0108de9 <strcmp>
+f0100cef:	83 c4 10             	add    $0x10,%esp
+f0100cf2:	85 c0                	test   %eax,%eax
+f0100cf4:	74 0c                	je     f0100d02 <mon_sysstats+0x32>
+f0100cf6:	e8 4b 5f 00 00       	call   f0106c46 <syscall_stats_print>
+f0100cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100d00:	c9                   	leave
+f0100d01:	c3                   	ret
+f0100d02:	e8 17 61 00 00       	call   f0106e1e <syscall_stats_reset>
+f0100d07:	eb f2                	jmp    f0100cfb <mon_sysstats+0x2b>
+
+f0100d09 <mon_strace>:
+f0100d09:	55                   	push   %ebp
+f0100d0a:	89 e5                	mov    %esp,%ebp
+f0100d0c:	83 ec 08             	sub    $0x8,%esp
+f0100d0f:	b8 14 00 00 00       	mov    $0x14,%eax
+f0100d14:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f0100d18:	7f 10                	jg     f0100d2a <mon_strace+0x21>
+f0100d1a:	83 ec 0c             	sub    $0xc,%esp
+f0100d1d:	50                   	push   %eax
+f0100d1e:	e8 21 61 00 00       	call   f0106e44 <syscall_trace_print>
+f0100d23:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100d28:	c9                   	leave
+f0100d29:	c3                   	ret
+f0100d2a:	83 ec 04             	sub    $0x4,%esp
+f0100d2d:	6a 00                	push   $0x0
+f0100d2f:	6a 00                	push   $0x0
+f0100d31:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100d34:	ff 70 04             	push   0x4(%eax)
+f0100d37:	e8 2f 83 00 00       	call   f010906b <strtol>
+f0100d3c:	83 c4 10             	add    $0x10,%esp
+f0100d3f:	eb d9                	jmp    f0100d1a <mon_strace+0x11>
+
+f0100d41 <mon_ktrace>:
+f0100d41:	55                   	push   %ebp
+f0100d42:	89 e5                	mov    %esp,%ebp
+f0100d44:	56                   	push   %esi
+f0100d45:	53                   	push   %ebx
+f0100d46:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0100d49:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0100d4c:	83 fb 01             	cmp    $0x1,%ebx
+f0100d4f:	7f 11                	jg     f0100d62 <mon_ktrace+0x21>
+f0100d51:	e8 49 6f 00 00       	call   f0107c9f <ktrace_print_events>
+f0100d56:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100d5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0100d5e:	5b                   	pop    %ebx
+f0100d5f:	5e                   	pop    %esi
+f0100d60:	5d                   	pop    %ebp
+f0100d61:	c3                   	ret
+f0100d62:	83 ec 08             	sub    $0x8,%esp
+f0100d65:	68 50 a1 10 f0       	push   $0xf010a150
+f0100d6a:	ff 76 04             	push   0x4(%esi)
+f0100d6d:	e8 77 80 00 00       	call   f0108de9 <strcmp>
+f0100d72:	83 c4 10             	add    $0x10,%esp
+f0100d75:	85 c0                	test   %eax,%eax
+f0100d77:	75 27                	jne    f0100da0 <mon_ktrace+0x5f>
+f0100d79:	83 fb 02             	cmp    $0x2,%ebx
+f0100d7c:	7f 0e                	jg     f0100d8c <mon_ktrace+0x4b>
+f0100d7e:	83 ec 0c             	sub    $0xc,%esp
+f0100d81:	50                   	push   %eax
+f0100d82:	e8 9f 6c 00 00       	call   f0107a26 <ktrace_dump>
+f0100d87:	83 c4 10             	add    $0x10,%esp
+f0100d8a:	eb ca                	jmp    f0100d56 <mon_ktrace+0x15>
+f0100d8c:	83 ec 04             	sub    $0x4,%esp
+f0100d8f:	6a 00                	push   $0x0
+f0100d91:	6a 00                	push   $0x0
+f0100d93:	ff 76 08             	push   0x8(%esi)
+f0100d96:	e8 d0 82 00 00       	call   f010906b <strtol>
+f0100d9b:	83 c4 10             	add    $0x10,%esp
+f0100d9e:	eb de                	jmp    f0100d7e <mon_ktrace+0x3d>
+f0100da0:	83 fb 02             	cmp    $0x2,%ebx
+f0100da3:	7f 29                	jg     f0100dce <mon_ktrace+0x8d>
+f0100da5:	83 ec 08             	sub    $0x8,%esp
+f0100da8:	68 5a a1 10 f0       	push   $0xf010a15a
+f0100dad:	ff 76 04             	push   0x4(%esi)
+f0100db0:	e8 34 80 00 00       	call   f0108de9 <strcmp>
+f0100db5:	83 c4 10             	add    $0x10,%esp
+f0100db8:	85 c0                	test   %eax,%eax
+f0100dba:	74 48                	je     f0100e04 <mon_ktrace+0xc3>
+f0100dbc:	83 ec 0c             	sub    $0xc,%esp
+f0100dbf:	68 64 a3 10 f0       	push   $0xf010a364
+f0100dc4:	e8 5a 42 00 00       	call   f0105023 <cprintf>
+f0100dc9:	83 c4 10             	add    $0x10,%esp
+f0100dcc:	eb 88                	jmp    f0100d56 <mon_ktrace+0x15>
+f0100dce:	83 ec 08             	sub    $0x8,%esp
+f0100dd1:	68 55 a1 10 f0       	push   $0xf010a155
+f0100dd6:	ff 76 04             	push   0x4(%esi)
+f0100dd9:	e8 0b 80 00 00       	call   f0108de9 <strcmp>
+f0100dde:	83 c4 10             	add    $0x10,%esp
+f0100de1:	85 c0                	test   %eax,%eax
+f0100de3:	75 c0                	jne    f0100da5 <mon_ktrace+0x64>
+f0100de5:	83 ec 04             	sub    $0x4,%esp
+f0100de8:	6a 00                	push   $0x0
+f0100dea:	6a 00                	push   $0x0
+f0100dec:	ff 76 08             	push   0x8(%esi)
+f0100def:	e8 77 82 00 00       	call   f010906b <strtol>
+f0100df4:	0f b6 c0             	movzbl %al,%eax
+f0100df7:	a3 f4 73 11 f0       	mov    %eax,0xf01173f4
+f0100dfc:	83 c4 10             	add    $0x10,%esp
+f0100dff:	e9 52 ff ff ff       	jmp    f0100d56 <mon_ktrace+0x15>
+f0100e04:	e8 cc 6b 00 00       	call   f01079d5 <ktrace_clear>
+f0100e09:	e9 48 ff ff ff       	jmp    f0100d56 <mon_ktrace+0x15>
+
+f0100e0e <mon_prof>:
+f0100e0e:	55                   	push   %ebp
+f0100e0f:	89 e5                	mov    %esp,%ebp
+f0100e11:	56                   	push   %esi
+f0100e12:	53                   	push   %ebx
+f0100e13:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0100e16:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0100e19:	83 fb 01             	cmp    $0x1,%ebx
+f0100e1c:	7f 23                	jg     f0100e41 <mon_prof+0x33>
+f0100e1e:	b8 14 00 00 00       	mov    $0x14,%eax
+f0100e23:	0f 85 e9 00 00 00    	jne    f0100f12 <mon_prof+0x104>
+f0100e29:	83 ec 0c             	sub    $0xc,%esp
+f0100e2c:	50                   	push   %eax
+f0100e2d:	e8 1d 70 00 00       	call   f0107e4f <prof_print_top>
+f0100e32:	83 c4 10             	add    $0x10,%esp
+f0100e35:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100e3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0100e3d:	5b                   	pop    %ebx
+f0100e3e:	5e                   	pop    %esi
+f0100e3f:	5d                   	pop    %ebp
+f0100e40:	c3                   	ret
+f0100e41:	83 ec 08             	sub    $0x8,%esp
+f0100e44:	68 60 a1 10 f0       	push   $0xf010a160
+f0100e49:	ff 76 04             	push   0x4(%esi)
+f0100e4c:	e8 98 7f 00 00       	call   f0108de9 <strcmp>
+f0100e51:	83 c4 10             	add    $0x10,%esp
+f0100e54:	85 c0                	test   %eax,%eax
+f0100e56:	75 3a                	jne    f0100e92 <mon_prof+0x84>
+f0100e58:	83 fb 02             	cmp    $0x2,%ebx
+f0100e5b:	7f 0c                	jg     f0100e69 <mon_prof+0x5b>
+f0100e5d:	c7 05 40 bc 1f f0 01 	movl   $0x1,0xf01fbc40
+f0100e64:	00 00 00 
+f0100e67:	eb cc                	jmp    f0100e35 <mon_prof+0x27>
+f0100e69:	83 ec 04             	sub    $0x4,%esp
+f0100e6c:	6a 00                	push   $0x0
+f0100e6e:	6a 00                	push   $0x0
+f0100e70:	ff 76 08             	push   0x8(%esi)
+f0100e73:	e8 f3 81 00 00       	call   f010906b <strtol>
+f0100e78:	83 c4 10             	add    $0x10,%esp
+f0100e7b:	85 c0                	test   %eax,%eax
+f0100e7d:	75 0c                	jne    f0100e8b <mon_prof+0x7d>
+f0100e7f:	c7 05 40 bc 1f f0 01 	movl   $0x1,0xf01fbc40
+f0100e86:	00 00 00 
+f0100e89:	eb aa                	jmp    f0100e35 <mon_prof+0x27>
+f0100e8b:	a3 40 bc 1f f0       	mov    %eax,0xf01fbc40
+f0100e90:	eb a3                	jmp    f0100e35 <mon_prof+0x27>
+f0100e92:	83 ec 08             	sub    $0x8,%esp
+f0100e95:	68 66 a1 10 f0       	push   $0xf010a166
+f0100e9a:	ff 76 04             	push   0x4(%esi)
+f0100e9d:	e8 47 7f 00 00       	call   f0108de9 <strcmp>
+f0100ea2:	83 c4 10             	add    $0x10,%esp
+f0100ea5:	85 c0                	test   %eax,%eax
+f0100ea7:	75 16                	jne    f0100ebf <mon_prof+0xb1>
+f0100ea9:	c7 05 40 bc 1f f0 00 	movl   $0x0,0xf01fbc40
+f0100eb0:	00 00 00 
+f0100eb3:	eb 80                	jmp    f0100e35 <mon_prof+0x27>
+f0100eb5:	e8 79 6f 00 00       	call   f0107e33 <prof_reset>
+f0100eba:	e9 76 ff ff ff       	jmp    f0100e35 <mon_prof+0x27>
+f0100ebf:	83 ec 08             	sub    $0x8,%esp
+f0100ec2:	68 4a a1 10 f0       	push   $0xf010a14a
+f0100ec7:	ff 76 04             	push   0x4(%esi)
+f0100eca:	e8 1a 7f 00 00       	call   f0108de9 <strcmp>
+f0100ecf:	83 c4 10             	add    $0x10,%esp
+f0100ed2:	85 c0                	test   %eax,%eax
+f0100ed4:	74 df                	je     f0100eb5 <mon_prof+0xa7>
+f0100ed6:	83 ec 08             	sub    $0x8,%esp
+f0100ed9:	68 67 a1 10 f0       	push   $0xf010a167
+f0100ede:	ff 76 04             	push   0x4(%esi)
+f0100ee1:	e8 03 7f 00 00       	call   f0108de9 <strcmp>
+f0100ee6:	83 c4 10             	add    $0x10,%esp
+f0100ee9:	85 c0                	test   %eax,%eax
+f0100eeb:	75 47                	jne    f0100f34 <mon_prof+0x126>
+f0100eed:	b8 14 00 00 00       	mov    $0x14,%eax
+f0100ef2:	83 fb 02             	cmp    $0x2,%ebx
+f0100ef5:	0f 8e 2e ff ff ff    	jle    f0100e29 <mon_prof+0x1b>
+f0100efb:	83 ec 04             	sub    $0x4,%esp
+f0100efe:	6a 00                	push   $0x0
+f0100f00:	6a 00                	push   $0x0
+f0100f02:	ff 76 08             	push   0x8(%esi)
+f0100f05:	e8 61 81 00 00       	call   f010906b <strtol>
+f0100f0a:	83 c4 10             	add    $0x10,%esp
+f0100f0d:	e9 17 ff ff ff       	jmp    f0100e29 <mon_prof+0x1b>
+f0100f12:	83 ec 08             	sub    $0x8,%esp
+f0100f15:	68 67 a1 10 f0       	push   $0xf010a167
+f0100f1a:	ff 76 04             	push   0x4(%esi)
+f0100f1d:	e8 c7 7e 00 00       	call   f0108de9 <strcmp>
+f0100f22:	89 c2                	mov    %eax,%edx
+f0100f24:	83 c4 10             	add    $0x10,%esp
+f0100f27:	b8 14 00 00 00       	mov    $0x14,%eax
+f0100f2c:	85 d2                	test   %edx,%edx
+f0100f2e:	0f 84 f5 fe ff ff    	je     f0100e29 <mon_prof+0x1b>
+f0100f34:	83 ec 0c             	sub    $0xc,%esp
+f0100f37:	68 98 a3 10 f0       	push   $0xf010a398
+f0100f3c:	e8 e2 40 00 00       	call   f0105023 <cprintf>
+f0100f41:	83 c4 10             	add    $0x10,%esp
+f0100f44:	e9 ec fe ff ff       	jmp    f0100e35 <mon_prof+0x27>
+
+f0100f49 <mon_pmu>:
+f0100f49:	55                   	push   %ebp
+f0100f4a:	89 e5                	mov    %esp,%ebp
+f0100f4c:	83 ec 08             	sub    $0x8,%esp
+f0100f4f:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0100f55:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0100f59:	74 25                	je     f0100f80 <mon_pmu+0x37>
+f0100f5b:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0100f61:	83 ec 0c             	sub    $0xc,%esp
+f0100f64:	ff 70 04             	push   0x4(%eax)
+f0100f67:	e8 12 74 00 00       	call   f010837e <pmu_save>
+f0100f6c:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0100f72:	83 c4 04             	add    $0x4,%esp
+f0100f75:	ff 70 04             	push   0x4(%eax)
+f0100f78:	e8 c3 74 00 00       	call   f0108440 <pmu_restore>
+f0100f7d:	83 c4 10             	add    $0x10,%esp
+f0100f80:	e8 8e 75 00 00       	call   f0108513 <pmu_print>
+f0100f85:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100f8a:	c9                   	leave
+f0100f8b:	c3                   	ret
+
+f0100f8c <mon_backtrace>:
+f0100f8c:	55                   	push   %ebp
+f0100f8d:	89 e5                	mov    %esp,%ebp
+f0100f8f:	57                   	push   %edi
+f0100f90:	56                   	push   %esi
+f0100f91:	53                   	push   %ebx
+f0100f92:	83 ec 48             	sub    $0x48,%esp
+f0100f95:	89 eb                	mov    %ebp,%ebx
+f0100f97:	68 6b a1 10 f0       	push   $0xf010a16b
+f0100f9c:	e8 82 40 00 00       	call   f0105023 <cprintf>
+f0100fa1:	83 c4 10             	add    $0x10,%esp
+f0100fa4:	eb 34                	jmp    f0100fda <mon_backtrace+0x4e>
+f0100fa6:	0f b6 1c 07          	movzbl (%edi,%eax,1),%ebx
+f0100faa:	88 1c 02             	mov    %bl,(%edx,%eax,1)
+f0100fad:	83 c0 01             	add    $0x1,%eax
+f0100fb0:	39 c1                	cmp    %eax,%ecx
+f0100fb2:	7f f2                	jg     f0100fa6 <mon_backtrace+0x1a>
+f0100fb4:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f0100fb7:	c6 04 0a 00          	movb   $0x0,(%edx,%ecx,1)
+f0100fbb:	83 ec 0c             	sub    $0xc,%esp
+f0100fbe:	8b 43 04             	mov    0x4(%ebx),%eax
+f0100fc1:	2b 45 e0             	sub    -0x20(%ebp),%eax
+f0100fc4:	50                   	push   %eax
+f0100fc5:	52                   	push   %edx
+f0100fc6:	ff 75 d4             	push   -0x2c(%ebp)
+f0100fc9:	ff 75 d0             	push   -0x30(%ebp)
+f0100fcc:	68 7d a1 10 f0       	push   $0xf010a17d
+f0100fd1:	e8 4d 40 00 00       	call   f0105023 <cprintf>
+f0100fd6:	8b 1b                	mov    (%ebx),%ebx
+f0100fd8:	89 f4                	mov    %esi,%esp
+f0100fda:	85 db                	test   %ebx,%ebx
+f0100fdc:	74 59                	je     f0101037 <mon_backtrace+0xab>
+f0100fde:	89 e6                	mov    %esp,%esi
+f0100fe0:	83 ec 08             	sub    $0x8,%esp
+f0100fe3:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f0100fe6:	50                   	push   %eax
+f0100fe7:	ff 73 04             	push   0x4(%ebx)
+f0100fea:	e8 b4 65 00 00       	call   f01075a3 <debuginfo_eip>
+f0100fef:	ff 73 18             	push   0x18(%ebx)
+f0100ff2:	ff 73 14             	push   0x14(%ebx)
+f0100ff5:	ff 73 10             	push   0x10(%ebx)
+f0100ff8:	ff 73 0c             	push   0xc(%ebx)
+f0100ffb:	ff 73 08             	push   0x8(%ebx)
+f0100ffe:	ff 73 04             	push   0x4(%ebx)
+f0101001:	53                   	push   %ebx
+f0101002:	68 d4 a3 10 f0       	push   $0xf010a3d4
+f0101007:	e8 17 40 00 00       	call   f0105023 <cprintf>
+f010100c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f010100f:	8d 41 10             	lea    0x10(%ecx),%eax
+f0101012:	bf 10 00 00 00       	mov    $0x10,%edi
+f0101017:	ba 00 00 00 00       	mov    $0x0,%edx
+f010101c:	f7 f7                	div    %edi
+f010101e:	c1 e0 04             	shl    $0x4,%eax
+f0101021:	89 f4                	mov    %esi,%esp
+f0101023:	29 c4                	sub    %eax,%esp
+f0101025:	89 e2                	mov    %esp,%edx
+f0101027:	8b 7d d8             	mov    -0x28(%ebp),%edi
+f010102a:	b8 00 00 00 00       	mov    $0x0,%eax
+f010102f:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+f0101032:	e9 79 ff ff ff       	jmp    f0100fb0 <mon_backtrace+0x24>
+f0101037:	b8 00 00 00 00       	mov    $0x0,%eax
+f010103c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010103f:	5b                   	pop    %ebx
+f0101040:	5e                   	pop    %esi
+f0101041:	5f                   	pop    %edi
+f0101042:	5d                   	pop    %ebp
+f0101043:	c3                   	ret
+
+f0101044 <mon_memusage>:
+f0101044:	55                   	push   %ebp
+f0101045:	89 e5                	mov    %esp,%ebp
+f0101047:	57                   	push   %edi
+f0101048:	56                   	push   %esi
+f0101049:	53                   	push   %ebx
+f010104a:	81 ec ac 00 00 00    	sub    $0xac,%esp
+f0101050:	bf 0a 00 00 00       	mov    $0xa,%edi
+f0101055:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f0101059:	7f 2b                	jg     f0101086 <mon_memusage+0x42>
+f010105b:	8b 1d 44 37 1a f0    	mov    0xf01a3744,%ebx
+f0101061:	69 05 40 37 1a f0 80 	imul   $0x380,0xf01a3740,%eax
+f0101068:	03 00 00 
+f010106b:	01 d8                	add    %ebx,%eax
+f010106d:	c7 85 54 ff ff ff 00 	movl   $0x0,-0xac(%ebp)
+f0101074:	00 00 00 
+f0101077:	c7 85 60 ff ff ff 00 	movl   $0x0,-0xa0(%ebp)
+f010107e:	00 00 00 
+f0101081:	e9 a7 00 00 00       	jmp    f010112d <mon_memusage+0xe9>
+f0101086:	83 ec 04             	sub    $0x4,%esp
+f0101089:	6a 00                	push   $0x0
+f010108b:	6a 00                	push   $0x0
+f010108d:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101090:	ff 70 04             	push   0x4(%eax)
+f0101093:	e8 d3 7f 00 00       	call   f010906b <strtol>
+f0101098:	89 c7                	mov    %eax,%edi
+f010109a:	8d 40 ff             	lea    -0x1(%eax),%eax
+f010109d:	83 c4 10             	add    $0x10,%esp
+f01010a0:	83 f8 20             	cmp    $0x20,%eax
+f01010a3:	b8 20 00 00 00       	mov    $0x20,%eax
+f01010a8:	0f 43 f8             	cmovae %eax,%edi
+f01010ab:	eb ae                	jmp    f010105b <mon_memusage+0x17>
+f01010ad:	83 e9 01             	sub    $0x1,%ecx
+f01010b0:	89 8d 64 ff ff ff    	mov    %ecx,-0x9c(%ebp)
+f01010b6:	85 c9                	test   %ecx,%ecx
+f01010b8:	7e 3a                	jle    f01010f4 <mon_memusage+0xb0>
+f01010ba:	8b 9c 8d 64 ff ff ff 	mov    -0x9c(%ebp,%ecx,4),%ebx
+f01010c1:	8b 86 cc 00 00 00    	mov    0xcc(%esi),%eax
+f01010c7:	03 86 c8 00 00 00    	add    0xc8(%esi),%eax
+f01010cd:	83 c0 01             	add    $0x1,%eax
+f01010d0:	8b 93 cc 00 00 00    	mov    0xcc(%ebx),%edx
+f01010d6:	03 93 c8 00 00 00    	add    0xc8(%ebx),%edx
+f01010dc:	83 c2 01             	add    $0x1,%edx
+f01010df:	39 c2                	cmp    %eax,%edx
+f01010e1:	73 11                	jae    f01010f4 <mon_memusage+0xb0>
+f01010e3:	39 bd 64 ff ff ff    	cmp    %edi,-0x9c(%ebp)
+f01010e9:	7d c2                	jge    f01010ad <mon_memusage+0x69>
+f01010eb:	89 9c 8d 68 ff ff ff 	mov    %ebx,-0x98(%ebp,%ecx,4)
+f01010f2:	eb b9                	jmp    f01010ad <mon_memusage+0x69>
+f01010f4:	8b 9d 5c ff ff ff    	mov    -0xa4(%ebp),%ebx
+f01010fa:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+f0101100:	8b 8d 64 ff ff ff    	mov    -0x9c(%ebp),%ecx
+f0101106:	39 f9                	cmp    %edi,%ecx
+f0101108:	7d 1d                	jge    f0101127 <mon_memusage+0xe3>
+f010110a:	89 b4 8d 68 ff ff ff 	mov    %esi,-0x98(%ebp,%ecx,4)
+f0101111:	8b b5 60 ff ff ff    	mov    -0xa0(%ebp),%esi
+f0101117:	39 f7                	cmp    %esi,%edi
+f0101119:	0f 9f c2             	setg   %dl
+f010111c:	0f b6 d2             	movzbl %dl,%edx
+f010111f:	01 d6                	add    %edx,%esi
+f0101121:	89 b5 60 ff ff ff    	mov    %esi,-0xa0(%ebp)
+f0101127:	81 c3 80 03 00 00    	add    $0x380,%ebx
+f010112d:	39 c3                	cmp    %eax,%ebx
+f010112f:	74 25                	je     f0101156 <mon_memusage+0x112>
+f0101131:	89 de                	mov    %ebx,%esi
+f0101133:	83 3b 00             	cmpl   $0x0,(%ebx)
+f0101136:	74 ef                	je     f0101127 <mon_memusage+0xe3>
+f0101138:	83 85 54 ff ff ff 01 	addl   $0x1,-0xac(%ebp)
+f010113f:	8b 8d 60 ff ff ff    	mov    -0xa0(%ebp),%ecx
+f0101145:	89 9d 5c ff ff ff    	mov    %ebx,-0xa4(%ebp)
+f010114b:	89 85 58 ff ff ff    	mov    %eax,-0xa8(%ebp)
+f0101151:	e9 5a ff ff ff       	jmp    f01010b0 <mon_memusage+0x6c>
+f0101156:	8b 1d 1c 37 1a f0    	mov    0xf01a371c,%ebx
+f010115c:	e8 46 09 00 00       	call   f0101aa7 <page_free_count>
+f0101161:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+f0101167:	53                   	push   %ebx
+f0101168:	50                   	push   %eax
+f0101169:	68 08 a4 10 f0       	push   $0xf010a408
+f010116e:	e8 b0 3e 00 00       	call   f0105023 <cprintf>
+f0101173:	c7 04 24 30 a4 10 f0 	movl   $0xf010a430,(%esp)
+f010117a:	e8 a4 3e 00 00       	call   f0105023 <cprintf>
+f010117f:	83 c4 10             	add    $0x10,%esp
+f0101182:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101187:	8b b5 60 ff ff ff    	mov    -0xa0(%ebp),%esi
+f010118d:	eb 35                	jmp    f01011c4 <mon_memusage+0x180>
+f010118f:	8b 84 9d 68 ff ff ff 	mov    -0x98(%ebp,%ebx,4),%eax
+f0101196:	8b 90 c8 00 00 00    	mov    0xc8(%eax),%edx
+f010119c:	8b 88 cc 00 00 00    	mov    0xcc(%eax),%ecx
+f01011a2:	83 ec 04             	sub    $0x4,%esp
+f01011a5:	ff 70 54             	push   0x54(%eax)
+f01011a8:	8d 7c 0a 01          	lea    0x1(%edx,%ecx,1),%edi
+f01011ac:	57                   	push   %edi
+f01011ad:	51                   	push   %ecx
+f01011ae:	52                   	push   %edx
+f01011af:	ff 30                	push   (%eax)
+f01011b1:	ff 70 40             	push   0x40(%eax)
+f01011b4:	68 60 a4 10 f0       	push   $0xf010a460
+f01011b9:	e8 65 3e 00 00       	call   f0105023 <cprintf>
+f01011be:	83 c3 01             	add    $0x1,%ebx
+f01011c1:	83 c4 20             	add    $0x20,%esp
+f01011c4:	39 f3                	cmp    %esi,%ebx
+f01011c6:	7c c7                	jl     f010118f <mon_memusage+0x14b>
+f01011c8:	b8 00 00 00 00       	mov    $0x0,%eax
+f01011cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01011d0:	5b                   	pop    %ebx
+f01011d1:	5e                   	pop    %esi
+f01011d2:	5f                   	pop    %edi
+f01011d3:	5d                   	pop    %ebp
+f01011d4:	c3                   	ret
+
+f01011d5 <monitor>:
+f01011d5:	55                   	push   %ebp
+f01011d6:	89 e5                	mov    %esp,%ebp
+f01011d8:	57                   	push   %edi
+f01011d9:	56                   	push   %esi
+f01011da:	53                   	push   %ebx
+f01011db:	83 ec 58             	sub    $0x58,%esp
+f01011de:	68 84 a4 10 f0       	push   $0xf010a484
+f01011e3:	e8 3b 3e 00 00       	call   f0105023 <cprintf>
+f01011e8:	c7 04 24 a8 a4 10 f0 	movl   $0xf010a4a8,(%esp)
+f01011ef:	e8 2f 3e 00 00       	call   f0105023 <cprintf>
+f01011f4:	83 c4 10             	add    $0x10,%esp
+f01011f7:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f01011fb:	74 57                	je     f0101254 <monitor+0x7f>
+f01011fd:	83 ec 0c             	sub    $0xc,%esp
+f0101200:	ff 75 08             	push   0x8(%ebp)
+f0101203:	e8 ea 45 00 00       	call   f01057f2 <print_trapframe>
+f0101208:	83 c4 10             	add    $0x10,%esp
+f010120b:	eb 47                	jmp    f0101254 <monitor+0x7f>
+f010120d:	83 ec 08             	sub    $0x8,%esp
+f0101210:	0f be c0             	movsbl %al,%eax
+f0101213:	50                   	push   %eax
+f0101214:	68 98 a1 10 f0       	push   $0xf010a198
+f0101219:	e8 2c 7c 00 00       	call   f0108e4a <strchr>
+f010121e:	83 c4 10             	add    $0x10,%esp
+f0101221:	85 c0                	test   %eax,%eax
+f0101223:	74 0a                	je     f010122f <monitor+0x5a>
+f0101225:	c6 03 00             	movb   $0x0,(%ebx)
+f0101228:	89 f7                	mov    %esi,%edi
+f010122a:	8d 5b 01             	lea    0x1(%ebx),%ebx
+f010122d:	eb 6b                	jmp    f010129a <monitor+0xc5>
+f010122f:	80 3b 00             	cmpb   $0x0,(%ebx)
+f0101232:	74 73                	je     f01012a7 <monitor+0xd2>
+f0101234:	83 fe 0f             	cmp    $0xf,%esi
+f0101237:	74 09                	je     f0101242 <monitor+0x6d>
+f0101239:	8d 7e 01             	lea    0x1(%esi),%edi
+f010123c:	89 5c b5 a8          	mov    %ebx,-0x58(%ebp,%esi,4)
+f0101240:	eb 39                	jmp    f010127b <monitor+0xa6>
+f0101242:	83 ec 08             	sub    $0x8,%esp
+f0101245:	6a 10                	push   $0x10
+f0101247:	68 9d a1 10 f0       	push   $0xf010a19d
+f010124c:	e8 d2 3d 00 00       	call   f0105023 <cprintf>
+f0101251:	83 c4 10             	add    $0x10,%esp
+f0101254:	83 ec 0c             	sub    $0xc,%esp
+f0101257:	68 94 a1 10 f0       	push   $0xf010a194
+f010125c:	e8 53 79 00 00       	call   f0108bb4 <readline>
+f0101261:	89 c3                	mov    %eax,%ebx
+f0101263:	83 c4 10             	add    $0x10,%esp
+f0101266:	85 c0                	test   %eax,%eax
+f0101268:	74 ea                	je     f0101254 <monitor+0x7f>
+f010126a:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+f0101271:	be 00 00 00 00       	mov    $0x0,%esi
+f0101276:	eb 24                	jmp    f010129c <monitor+0xc7>
+f0101278:	83 c3 01             	add    $0x1,%ebx
+f010127b:	0f b6 03             	movzbl (%ebx),%eax
+f010127e:	84 c0                	test   %al,%al
+f0101280:	74 18                	je     f010129a <monitor+0xc5>
+f0101282:	83 ec 08             	sub    $0x8,%esp
+f0101285:	0f be c0             	movsbl %al,%eax
+f0101288:	50                   	push   %eax
+f0101289:	68 98 a1 10 f0       	push   $0xf010a198
+f010128e:	e8 b7 7b 00 00       	call   f0108e4a <strchr>
+f0101293:	83 c4 10             	add    $0x10,%esp
+f0101296:	85 c0                	test   %eax,%eax
+f0101298:	74 de                	je     f0101278 <monitor+0xa3>
+f010129a:	89 fe                	mov    %edi,%esi
+f010129c:	0f b6 03             	movzbl (%ebx),%eax
+f010129f:	84 c0                	test   %al,%al
+f01012a1:	0f 85 66 ff ff ff    	jne    f010120d <monitor+0x38>
+f01012a7:	c7 44 b5 a8 00 00 00 	movl   $0x0,-0x58(%ebp,%esi,4)
+f01012ae:	00 
+f01012af:	85 f6                	test   %esi,%esi
+f01012b1:	74 a1                	je     f0101254 <monitor+0x7f>
+f01012b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01012b8:	83 ec 08             	sub    $0x8,%esp
+f01012bb:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f01012be:	ff 34 85 40 a6 10 f0 	push   -0xfef59c0(,%eax,4)
+f01012c5:	ff 75 a8             	push   -0x58(%ebp)
+f01012c8:	e8 1c 7b 00 00       	call   f0108de9 <strcmp>
+f01012cd:	83 c4 10             	add    $0x10,%esp
+f01012d0:	85 c0                	test   %eax,%eax
+f01012d2:	74 20                	je     f01012f4 <monitor+0x11f>
+f01012d4:	83 c3 01             	add    $0x1,%ebx
+f01012d7:	83 fb 0a             	cmp    $0xa,%ebx
+f01012da:	75 dc                	jne    f01012b8 <monitor+0xe3>
+f01012dc:	83 ec 08             	sub    $0x8,%esp
+f01012df:	ff 75 a8             	push   -0x58(%ebp)
+f01012e2:	68 ba a1 10 f0       	push   $0xf010a1ba
+f01012e7:	e8 37 3d 00 00       	call   f0105023 <cprintf>
+f01012ec:	83 c4 10             	add    $0x10,%esp
+f01012ef:	e9 60 ff ff ff       	jmp    f0101254 <monitor+0x7f>
+f01012f4:	83 ec 04             	sub    $0x4,%esp
+f01012f7:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f01012fa:	ff 75 08             	push   0x8(%ebp)
+f01012fd:	8d 55 a8             	lea    -0x58(%ebp),%edx
+f0101300:	52                   	push   %edx
+f0101301:	56                   	push   %esi
+f0101302:	ff 14 85 48 a6 10 f0 	call   *-0xfef59b8(,%eax,4)
+f0101309:	83 c4 10             	add    $0x10,%esp
+f010130c:	85 c0                	test   %eax,%eax
+f010130e:	0f 89 40 ff ff ff    	jns    f0101254 <monitor+0x7f>
+f0101314:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101317:	5b                   	pop    %ebx
+f0101318:	5e                   	pop    %esi
+f0101319:	5f                   	pop    %edi
+f010131a:	5d                   	pop    %ebp
+f010131b:	c3                   	ret
+
+f010131c <boot_alloc>:
+f010131c:	83 3d 24 37 1a f0 00 	cmpl   $0x0,0xf01a3724
+f0101323:	74 4c                	je     f0101371 <boot_alloc+0x55>
+f0101325:	85 c0                	test   %eax,%eax
+f0101327:	74 5b                	je     f0101384 <boot_alloc+0x68>
+f0101329:	55                   	push   %ebp
+f010132a:	89 e5                	mov    %esp,%ebp
+f010132c:	53                   	push   %ebx
+f010132d:	83 ec 04             	sub    $0x4,%esp
+f0101330:	8b 0d 24 37 1a f0    	mov    0xf01a3724,%ecx
+f0101336:	8d 84 01 ff 0f 00 00 	lea    0xfff(%ecx,%eax,1),%eax
+f010133d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0101342:	a3 24 37 1a f0       	mov    %eax,0xf01a3724
+f0101347:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010134c:	76 3f                	jbe    f010138d <boot_alloc+0x71>
+f010134e:	8b 15 1c 37 1a f0    	mov    0xf01a371c,%edx
+f0101354:	c1 e2 0c             	shl    $0xc,%edx
+f0101357:	bb 00 00 00 02       	mov    $0x2000000,%ebx
+f010135c:	39 da                	cmp    %ebx,%edx
+f010135e:	0f 47 d3             	cmova  %ebx,%edx
+f0101361:	05 00 00 00 10       	add    $0x10000000,%eax
+f0101366:	39 c2                	cmp    %eax,%edx
+f0101368:	72 38                	jb     f01013a2 <boot_alloc+0x86>
+f010136a:	89 c8                	mov    %ecx,%eax
+f010136c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010136f:	c9                   	leave
+f0101370:	c3                   	ret
+f0101371:	ba 47 86 25 f0       	mov    $0xf0258647,%edx
+f0101376:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f010137c:	89 15 24 37 1a f0    	mov    %edx,0xf01a3724
+f0101382:	eb a1                	jmp    f0101325 <boot_alloc+0x9>
+f0101384:	8b 0d 24 37 1a f0    	mov    0xf01a3724,%ecx
+f010138a:	89 c8                	mov    %ecx,%eax
+f010138c:	c3                   	ret
+f010138d:	50                   	push   %eax
+f010138e:	68 08 9e 10 f0       	push   $0xf0109e08
+f0101393:	68 95 00 00 00       	push   $0x95
+f0101398:	68 29 b1 10 f0       	push   $0xf010b129
+f010139d:	e8 89 ed ff ff       	call   f010012b <_panic>
+f01013a2:	83 ec 04             	sub    $0x4,%esp
+f01013a5:	68 35 b1 10 f0       	push   $0xf010b135
+f01013aa:	68 96 00 00 00       	push   $0x96
+f01013af:	68 29 b1 10 f0       	push   $0xf010b129
+f01013b4:	e8 72 ed ff ff       	call   f010012b <_panic>
+
+f01013b9 <nvram_read>:
+f01013b9:	55                   	push   %ebp
+f01013ba:	89 e5                	mov    %esp,%ebp
+f01013bc:	56                   	push   %esi
+f01013bd:	53                   	push   %ebx
+f01013be:	89 c3                	mov    %eax,%ebx
+f01013c0:	83 ec 0c             	sub    $0xc,%esp
+f01013c3:	50                   	push   %eax
+f01013c4:	e8 fb 39 00 00       	call   f0104dc4 <mc146818_read>
+f01013c9:	89 c6                	mov    %eax,%esi
+f01013cb:	83 c3 01             	add    $0x1,%ebx
+f01013ce:	89 1c 24             	mov    %ebx,(%esp)
+f01013d1:	e8 ee 39 00 00       	call   f0104dc4 <mc146818_read>
+f01013d6:	c1 e0 08             	shl    $0x8,%eax
+f01013d9:	09 f0                	or     %esi,%eax
+f01013db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01013de:	5b                   	pop    %ebx
+f01013df:	5e                   	pop    %esi
+f01013e0:	5d                   	pop    %ebp
+f01013e1:	c3                   	ret
+
+f01013e2 <check_va2pa>:
+f01013e2:	89 d1                	mov    %edx,%ecx
+f01013e4:	c1 e9 16             	shr    $0x16,%ecx
+f01013e7:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+f01013ea:	a8 01                	test   $0x1,%al
+f01013ec:	74 51                	je     f010143f <check_va2pa+0x5d>
+f01013ee:	89 c1                	mov    %eax,%ecx
+f01013f0:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+f01013f6:	c1 e8 0c             	shr    $0xc,%eax
+f01013f9:	3b 05 18 37 1a f0    	cmp    0xf01a3718,%eax
+f01013ff:	73 23                	jae    f0101424 <check_va2pa+0x42>
+f0101401:	c1 ea 0c             	shr    $0xc,%edx
+f0101404:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+f010140a:	8b 94 91 00 00 00 f0 	mov    -0x10000000(%ecx,%edx,4),%edx
+f0101411:	89 d0                	mov    %edx,%eax
+f0101413:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0101418:	f6 c2 01             	test   $0x1,%dl
+f010141b:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+f0101420:	0f 44 c2             	cmove  %edx,%eax
+f0101423:	c3                   	ret
+f0101424:	55                   	push   %ebp
+f0101425:	89 e5                	mov    %esp,%ebp
+f0101427:	83 ec 08             	sub    $0x8,%esp
+f010142a:	51                   	push   %ecx
+f010142b:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0101430:	68 83 05 00 00       	push   $0x583
+f0101435:	68 29 b1 10 f0       	push   $0xf010b129
+f010143a:	e8 ec ec ff ff       	call   f010012b <_panic>
+f010143f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0101444:	c3                   	ret
+
+f0101445 <pgdir_env>:
+f0101445:	55                   	push   %ebp
+f0101446:	89 e5                	mov    %esp,%ebp
+f0101448:	83 ec 08             	sub    $0x8,%esp
+f010144b:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0101450:	76 3f                	jbe    f0101491 <pgdir_env+0x4c>
+f0101452:	05 00 00 00 10       	add    $0x10000000,%eax
+f0101457:	c1 e8 0c             	shr    $0xc,%eax
+f010145a:	3b 05 1c 37 1a f0    	cmp    0xf01a371c,%eax
+f0101460:	73 44                	jae    f01014a6 <pgdir_env+0x61>
+f0101462:	8b 15 10 37 1a f0    	mov    0xf01a3710,%edx
+f0101468:	0f b7 44 c2 06       	movzwl 0x6(%edx,%eax,8),%eax
+f010146d:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101472:	66 85 c0             	test   %ax,%ax
+f0101475:	74 16                	je     f010148d <pgdir_env+0x48>
+f0101477:	0f b7 c0             	movzwl %ax,%eax
+f010147a:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+f0101480:	8b 15 44 37 1a f0    	mov    0xf01a3744,%edx
+f0101486:	8d 94 02 80 fc ff ff 	lea    -0x380(%edx,%eax,1),%edx
+f010148d:	89 d0                	mov    %edx,%eax
+f010148f:	c9                   	leave
+f0101490:	c3                   	ret
+f0101491:	50                   	push   %eax
+f0101492:	68 08 9e 10 f0       	push   $0xf0109e08
+f0101497:	68 ff 01 00 00       	push   $0x1ff
+f010149c:	68 29 b1 10 f0       	push   $0xf010b129
+f01014a1:	e8 85 ec ff ff       	call   f010012b <_panic>
+f01014a6:	83 ec 04             	sub    $0x4,%esp
+f01014a9:	68 b8 a6 10 f0       	push   $0xf010a6b8
+f01014ae:	6a 63                	push   $0x63
+f01014b0:	68 52 b1 10 f0       	push   $0xf010b152
+f01014b5:	e8 71 ec ff ff       	call   f010012b <_panic>
+
+f01014ba <check_page_free_list>:
+f01014ba:	55                   	push   %ebp
+f01014bb:	89 e5                	mov    %esp,%ebp
+f01014bd:	57                   	push   %edi
+f01014be:	56                   	push   %esi
+f01014bf:	53                   	push   %ebx
+f01014c0:	83 ec 2c             	sub    $0x2c,%esp
+f01014c3:	84 c0                	test   %al,%al
+f01014c5:	0f 85 8a 02 00 00    	jne    f0101755 <check_page_free_list+0x29b>
+f01014cb:	83 3d 34 37 1a f0 00 	cmpl   $0x0,0xf01a3734
+f01014d2:	74 0d                	je     f01014e1 <check_page_free_list+0x27>
+f01014d4:	be 00 04 00 00       	mov    $0x400,%esi
+f01014d9:	8b 1d 34 37 1a f0    	mov    0xf01a3734,%ebx
+f01014df:	eb 2b                	jmp    f010150c <check_page_free_list+0x52>
+f01014e1:	83 ec 04             	sub    $0x4,%esp
+f01014e4:	68 d8 a6 10 f0       	push   $0xf010a6d8
+f01014e9:	68 88 04 00 00       	push   $0x488
+f01014ee:	68 29 b1 10 f0       	push   $0xf010b129
+f01014f3:	e8 33 ec ff ff       	call   f010012b <_panic>
+f01014f8:	50                   	push   %eax
+f01014f9:	68 e4 9d 10 f0       	push   $0xf0109de4
+f01014fe:	6a 71                	push   $0x71
+f0101500:	68 52 b1 10 f0       	push   $0xf010b152
+f0101505:	e8 21 ec ff ff       	call   f010012b <_panic>
+f010150a:	8b 1b                	mov    (%ebx),%ebx
+f010150c:	85 db                	test   %ebx,%ebx
+f010150e:	74 41                	je     f0101551 <check_page_free_list+0x97>
+f0101510:	89 d8                	mov    %ebx,%eax
+f0101512:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f0101518:	c1 f8 03             	sar    $0x3,%eax
+f010151b:	c1 e0 0c             	shl    $0xc,%eax
+f010151e:	89 c2                	mov    %eax,%edx
+f0101520:	c1 ea 16             	shr    $0x16,%edx
+f0101523:	39 f2                	cmp    %esi,%edx
+f0101525:	73 e3                	jae    f010150a <check_page_free_list+0x50>
+f0101527:	89 c2                	mov    %eax,%edx
+f0101529:	c1 ea 0c             	shr    $0xc,%edx
+f010152c:	3b 15 18 37 1a f0    	cmp    0xf01a3718,%edx
+f0101532:	73 c4                	jae    f01014f8 <check_page_free_list+0x3e>
+f0101534:	83 ec 04             	sub    $0x4,%esp
+f0101537:	68 80 00 00 00       	push   $0x80
+f010153c:	68 97 00 00 00       	push   $0x97
+f0101541:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0101546:	50                   	push   %eax
+f0101547:	e8 3d 79 00 00       	call   f0108e89 <memset>
+f010154c:	83 c4 10             	add    $0x10,%esp
+f010154f:	eb b9                	jmp    f010150a <check_page_free_list+0x50>
+f0101551:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101556:	e8 c1 fd ff ff       	call   f010131c <boot_alloc>
+f010155b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f010155e:	8b 15 34 37 1a f0    	mov    0xf01a3734,%edx
+f0101564:	8b 0d 10 37 1a f0    	mov    0xf01a3710,%ecx
+f010156a:	a1 1c 37 1a f0       	mov    0xf01a371c,%eax
+f010156f:	8d 34 c1             	lea    (%ecx,%eax,8),%esi
+f0101572:	a1 18 37 1a f0       	mov    0xf01a3718,%eax
+f0101577:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f010157a:	bf 00 00 00 00       	mov    $0x0,%edi
+f010157f:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f0101582:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f0101585:	e9 fe 00 00 00       	jmp    f0101688 <check_page_free_list+0x1ce>
+f010158a:	68 60 b1 10 f0       	push   $0xf010b160
+f010158f:	68 6c b1 10 f0       	push   $0xf010b16c
+f0101594:	68 96 04 00 00       	push   $0x496
+f0101599:	68 29 b1 10 f0       	push   $0xf010b129
+f010159e:	e8 88 eb ff ff       	call   f010012b <_panic>
+f01015a3:	68 81 b1 10 f0       	push   $0xf010b181
+f01015a8:	68 6c b1 10 f0       	push   $0xf010b16c
+f01015ad:	68 97 04 00 00       	push   $0x497
+f01015b2:	68 29 b1 10 f0       	push   $0xf010b129
+f01015b7:	e8 6f eb ff ff       	call   f010012b <_panic>
+f01015bc:	68 fc a6 10 f0       	push   $0xf010a6fc
+f01015c1:	68 6c b1 10 f0       	push   $0xf010b16c
+f01015c6:	68 98 04 00 00       	push   $0x498
+f01015cb:	68 29 b1 10 f0       	push   $0xf010b129
+f01015d0:	e8 56 eb ff ff       	call   f010012b <_panic>
+f01015d5:	68 95 b1 10 f0       	push   $0xf010b195
+f01015da:	68 6c b1 10 f0       	push   $0xf010b16c
+f01015df:	68 9b 04 00 00       	push   $0x49b
+f01015e4:	68 29 b1 10 f0       	push   $0xf010b129
+f01015e9:	e8 3d eb ff ff       	call   f010012b <_panic>
+f01015ee:	68 a6 b1 10 f0       	push   $0xf010b1a6
+f01015f3:	68 6c b1 10 f0       	push   $0xf010b16c
+f01015f8:	68 9c 04 00 00       	push   $0x49c
+f01015fd:	68 29 b1 10 f0       	push   $0xf010b129
+f0101602:	e8 24 eb ff ff       	call   f010012b <_panic>
+f0101607:	68 30 a7 10 f0       	push   $0xf010a730
+f010160c:	68 6c b1 10 f0       	push   $0xf010b16c
+f0101611:	68 9d 04 00 00       	push   $0x49d
+f0101616:	68 29 b1 10 f0       	push   $0xf010b129
+f010161b:	e8 0b eb ff ff       	call   f010012b <_panic>
+f0101620:	68 bf b1 10 f0       	push   $0xf010b1bf
+f0101625:	68 6c b1 10 f0       	push   $0xf010b16c
+f010162a:	68 9e 04 00 00       	push   $0x49e
+f010162f:	68 29 b1 10 f0       	push   $0xf010b129
+f0101634:	e8 f2 ea ff ff       	call   f010012b <_panic>
+f0101639:	89 c3                	mov    %eax,%ebx
+f010163b:	c1 eb 0c             	shr    $0xc,%ebx
+f010163e:	8b 7d c8             	mov    -0x38(%ebp),%edi
+f0101641:	39 fb                	cmp    %edi,%ebx
+f0101643:	73 12                	jae    f0101657 <check_page_free_list+0x19d>
+f0101645:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f010164a:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f010164d:	39 f8                	cmp    %edi,%eax
+f010164f:	72 18                	jb     f0101669 <check_page_free_list+0x1af>
+f0101651:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+f0101655:	eb 2f                	jmp    f0101686 <check_page_free_list+0x1cc>
+f0101657:	50                   	push   %eax
+f0101658:	68 e4 9d 10 f0       	push   $0xf0109de4
+f010165d:	6a 71                	push   $0x71
+f010165f:	68 52 b1 10 f0       	push   $0xf010b152
+f0101664:	e8 c2 ea ff ff       	call   f010012b <_panic>
+f0101669:	68 54 a7 10 f0       	push   $0xf010a754
+f010166e:	68 6c b1 10 f0       	push   $0xf010b16c
+f0101673:	68 9f 04 00 00       	push   $0x49f
+f0101678:	68 29 b1 10 f0       	push   $0xf010b129
+f010167d:	e8 a9 ea ff ff       	call   f010012b <_panic>
+f0101682:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+f0101686:	8b 12                	mov    (%edx),%edx
+f0101688:	85 d2                	test   %edx,%edx
+f010168a:	74 74                	je     f0101700 <check_page_free_list+0x246>
+f010168c:	39 ca                	cmp    %ecx,%edx
+f010168e:	0f 82 f6 fe ff ff    	jb     f010158a <check_page_free_list+0xd0>
+f0101694:	39 f2                	cmp    %esi,%edx
+f0101696:	0f 83 07 ff ff ff    	jae    f01015a3 <check_page_free_list+0xe9>
+f010169c:	89 d0                	mov    %edx,%eax
+f010169e:	29 c8                	sub    %ecx,%eax
+f01016a0:	a8 07                	test   $0x7,%al
+f01016a2:	0f 85 14 ff ff ff    	jne    f01015bc <check_page_free_list+0x102>
+f01016a8:	c1 f8 03             	sar    $0x3,%eax
+f01016ab:	c1 e0 0c             	shl    $0xc,%eax
+f01016ae:	0f 84 21 ff ff ff    	je     f01015d5 <check_page_free_list+0x11b>
+f01016b4:	3d 00 00 0a 00       	cmp    $0xa0000,%eax
+f01016b9:	0f 84 2f ff ff ff    	je     f01015ee <check_page_free_list+0x134>
+f01016bf:	3d 00 f0 0f 00       	cmp    $0xff000,%eax
+f01016c4:	0f 84 3d ff ff ff    	je     f0101607 <check_page_free_list+0x14d>
+f01016ca:	3d 00 00 10 00       	cmp    $0x100000,%eax
+f01016cf:	0f 84 4b ff ff ff    	je     f0101620 <check_page_free_list+0x166>
+f01016d5:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+f01016da:	0f 87 59 ff ff ff    	ja     f0101639 <check_page_free_list+0x17f>
+f01016e0:	3d 00 70 00 00       	cmp    $0x7000,%eax
+f01016e5:	75 9b                	jne    f0101682 <check_page_free_list+0x1c8>
+f01016e7:	68 d9 b1 10 f0       	push   $0xf010b1d9
+f01016ec:	68 6c b1 10 f0       	push   $0xf010b16c
+f01016f1:	68 a1 04 00 00       	push   $0x4a1
+f01016f6:	68 29 b1 10 f0       	push   $0xf010b129
+f01016fb:	e8 2b ea ff ff       	call   f010012b <_panic>
+f0101700:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f0101703:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0101706:	85 db                	test   %ebx,%ebx
+f0101708:	7e 19                	jle    f0101723 <check_page_free_list+0x269>
+f010170a:	85 ff                	test   %edi,%edi
+f010170c:	7e 2e                	jle    f010173c <check_page_free_list+0x282>
+f010170e:	83 ec 0c             	sub    $0xc,%esp
+f0101711:	68 9c a7 10 f0       	push   $0xf010a79c
+f0101716:	e8 08 39 00 00       	call   f0105023 <cprintf>
+f010171b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010171e:	5b                   	pop    %ebx
+f010171f:	5e                   	pop    %esi
+f0101720:	5f                   	pop    %edi
+f0101721:	5d                   	pop    %ebp
+f0101722:	c3                   	ret
+f0101723:	68 f6 b1 10 f0       	push   $0xf010b1f6
+f0101728:	68 6c b1 10 f0       	push   $0xf010b16c
+f010172d:	68 a9 04 00 00       	push   $0x4a9
+f0101732:	68 29 b1 10 f0       	push   $0xf010b129
+f0101737:	e8 ef e9 ff ff       	call   f010012b <_panic>
+f010173c:	68 08 b2 10 f0       	push   $0xf010b208
+f0101741:	68 6c b1 10 f0       	push   $0xf010b16c
+f0101746:	68 aa 04 00 00       	push   $0x4aa
+f010174b:	68 29 b1 10 f0       	push   $0xf010b129
+f0101750:	e8 d6 e9 ff ff       	call   f010012b <_panic>
+f0101755:	a1 34 37 1a f0       	mov    0xf01a3734,%eax
+f010175a:	85 c0                	test   %eax,%eax
+f010175c:	0f 84 7f fd ff ff    	je     f01014e1 <check_page_free_list+0x27>
+f0101762:	8d 55 d8             	lea    -0x28(%ebp),%edx
+f0101765:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f0101768:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f010176b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f010176e:	89 c2                	mov    %eax,%edx
+f0101770:	2b 15 10 37 1a f0    	sub    0xf01a3710,%edx
+f0101776:	f7 c2 00 e0 7f 00    	test   $0x7fe000,%edx
+f010177c:	0f 95 c2             	setne  %dl
+f010177f:	0f b6 d2             	movzbl %dl,%edx
+f0101782:	8b 4c 95 e0          	mov    -0x20(%ebp,%edx,4),%ecx
+f0101786:	89 01                	mov    %eax,(%ecx)
+f0101788:	89 44 95 e0          	mov    %eax,-0x20(%ebp,%edx,4)
+f010178c:	8b 00                	mov    (%eax),%eax
+f010178e:	85 c0                	test   %eax,%eax
+f0101790:	75 dc                	jne    f010176e <check_page_free_list+0x2b4>
+f0101792:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101795:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f010179b:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f010179e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01017a1:	89 10                	mov    %edx,(%eax)
+f01017a3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f01017a6:	a3 34 37 1a f0       	mov    %eax,0xf01a3734
+f01017ab:	be 01 00 00 00       	mov    $0x1,%esi
+f01017b0:	e9 24 fd ff ff       	jmp    f01014d9 <check_page_free_list+0x1f>
+
+f01017b5 <page_init>:
+f01017b5:	55                   	push   %ebp
+f01017b6:	89 e5                	mov    %esp,%ebp
+f01017b8:	57                   	push   %edi
+f01017b9:	56                   	push   %esi
+f01017ba:	53                   	push   %ebx
+f01017bb:	83 ec 0c             	sub    $0xc,%esp
+f01017be:	be 00 00 00 00       	mov    $0x0,%esi
+f01017c3:	bf 00 00 00 00       	mov    $0x0,%edi
+f01017c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01017cd:	eb 25                	jmp    f01017f4 <page_init+0x3f>
+f01017cf:	8d 86 00 00 f6 ff    	lea    -0xa0000(%esi),%eax
+f01017d5:	3d ff ff 05 00       	cmp    $0x5ffff,%eax
+f01017da:	77 35                	ja     f0101811 <page_init+0x5c>
+f01017dc:	a1 10 37 1a f0       	mov    0xf01a3710,%eax
+f01017e1:	66 c7 44 38 04 01 00 	movw   $0x1,0x4(%eax,%edi,1)
+f01017e8:	83 c3 01             	add    $0x1,%ebx
+f01017eb:	83 c7 08             	add    $0x8,%edi
+f01017ee:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f01017f4:	3b 1d 1c 37 1a f0    	cmp    0xf01a371c,%ebx
+f01017fa:	0f 83 32 01 00 00    	jae    f0101932 <page_init+0x17d>
+f0101800:	85 db                	test   %ebx,%ebx
+f0101802:	75 cb                	jne    f01017cf <page_init+0x1a>
+f0101804:	a1 10 37 1a f0       	mov    0xf01a3710,%eax
+f0101809:	66 c7 40 04 01 00    	movw   $0x1,0x4(%eax)
+f010180f:	eb d7                	jmp    f01017e8 <page_init+0x33>
+f0101811:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+f0101817:	76 37                	jbe    f0101850 <page_init+0x9b>
+f0101819:	b8 48 76 25 f0       	mov    $0xf0257648,%eax
+f010181e:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0101823:	76 16                	jbe    f010183b <page_init+0x86>
+f0101825:	81 fe 48 76 25 00    	cmp    $0x257648,%esi
+f010182b:	73 23                	jae    f0101850 <page_init+0x9b>
+f010182d:	a1 10 37 1a f0       	mov    0xf01a3710,%eax
+f0101832:	66 c7 44 38 04 01 00 	movw   $0x1,0x4(%eax,%edi,1)
+f0101839:	eb ad                	jmp    f01017e8 <page_init+0x33>
+f010183b:	50                   	push   %eax
+f010183c:	68 08 9e 10 f0       	push   $0xf0109e08
+f0101841:	68 8c 01 00 00       	push   $0x18c
+f0101846:	68 29 b1 10 f0       	push   $0xf010b129
+f010184b:	e8 db e8 ff ff       	call   f010012b <_panic>
+f0101850:	b8 48 76 25 f0       	mov    $0xf0257648,%eax
+f0101855:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010185a:	76 48                	jbe    f01018a4 <page_init+0xef>
+f010185c:	81 fe 48 76 25 00    	cmp    $0x257648,%esi
+f0101862:	73 55                	jae    f01018b9 <page_init+0x104>
+f0101864:	81 fe 00 70 00 00    	cmp    $0x7000,%esi
+f010186a:	0f 84 89 00 00 00    	je     f01018f9 <page_init+0x144>
+f0101870:	3b 1d 18 37 1a f0    	cmp    0xf01a3718,%ebx
+f0101876:	0f 82 8e 00 00 00    	jb     f010190a <page_init+0x155>
+f010187c:	89 f8                	mov    %edi,%eax
+f010187e:	03 05 10 37 1a f0    	add    0xf01a3710,%eax
+f0101884:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+f010188a:	8b 15 30 37 1a f0    	mov    0xf01a3730,%edx
+f0101890:	89 10                	mov    %edx,(%eax)
+f0101892:	89 f8                	mov    %edi,%eax
+f0101894:	03 05 10 37 1a f0    	add    0xf01a3710,%eax
+f010189a:	a3 30 37 1a f0       	mov    %eax,0xf01a3730
+f010189f:	e9 44 ff ff ff       	jmp    f01017e8 <page_init+0x33>
+f01018a4:	50                   	push   %eax
+f01018a5:	68 08 9e 10 f0       	push   $0xf0109e08
+f01018aa:	68 8e 01 00 00       	push   $0x18e
+f01018af:	68 29 b1 10 f0       	push   $0xf010b129
+f01018b4:	e8 72 e8 ff ff       	call   f010012b <_panic>
+f01018b9:	b8 00 00 00 00       	mov    $0x0,%eax
+f01018be:	e8 59 fa ff ff       	call   f010131c <boot_alloc>
+f01018c3:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01018c8:	76 1a                	jbe    f01018e4 <page_init+0x12f>
+f01018ca:	05 00 00 00 10       	add    $0x10000000,%eax
+f01018cf:	39 c6                	cmp    %eax,%esi
+f01018d1:	73 91                	jae    f0101864 <page_init+0xaf>
+f01018d3:	a1 10 37 1a f0       	mov    0xf01a3710,%eax
+f01018d8:	66 c7 44 38 04 01 00 	movw   $0x1,0x4(%eax,%edi,1)
+f01018df:	e9 04 ff ff ff       	jmp    f01017e8 <page_init+0x33>
+f01018e4:	50                   	push   %eax
+f01018e5:	68 08 9e 10 f0       	push   $0xf0109e08
+f01018ea:	68 8e 01 00 00       	push   $0x18e
+f01018ef:	68 29 b1 10 f0       	push   $0xf010b129
+f01018f4:	e8 32 e8 ff ff       	call   f010012b <_panic>
+f01018f9:	a1 10 37 1a f0       	mov    0xf01a3710,%eax
+f01018fe:	66 c7 44 38 04 01 00 	movw   $0x1,0x4(%eax,%edi,1)
+f0101905:	e9 de fe ff ff       	jmp    f01017e8 <page_init+0x33>
+f010190a:	89 f8                	mov    %edi,%eax
+f010190c:	03 05 10 37 1a f0    	add    0xf01a3710,%eax
+f0101912:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+f0101918:	8b 15 34 37 1a f0    	mov    0xf01a3734,%edx
+f010191e:	89 10                	mov    %edx,(%eax)
+f0101920:	89 f8                	mov    %edi,%eax
+f0101922:	03 05 10 37 1a f0    	add    0xf01a3710,%eax
+f0101928:	a3 34 37 1a f0       	mov    %eax,0xf01a3734
+f010192d:	e9 b6 fe ff ff       	jmp    f01017e8 <page_init+0x33>
+f0101932:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101935:	5b                   	pop    %ebx
+f0101936:	5e                   	pop    %esi
+f0101937:	5f                   	pop    %edi
+f0101938:	5d                   	pop    %ebp
+f0101939:	c3                   	ret
+
+f010193a <page_free>:
+f010193a:	55                   	push   %ebp
+f010193b:	89 e5                	mov    %esp,%ebp
+f010193d:	83 ec 08             	sub    $0x8,%esp
+f0101940:	8b 45 08             	mov    0x8(%ebp),%eax
+f0101943:	66 83 78 04 00       	cmpw   $0x0,0x4(%eax)
+f0101948:	75 27                	jne    f0101971 <page_free+0x37>
+f010194a:	83 38 00             	cmpl   $0x0,(%eax)
+f010194d:	75 22                	jne    f0101971 <page_free+0x37>
+f010194f:	89 c2                	mov    %eax,%edx
+f0101951:	2b 15 10 37 1a f0    	sub    0xf01a3710,%edx
+f0101957:	c1 fa 03             	sar    $0x3,%edx
+f010195a:	3b 15 18 37 1a f0    	cmp    0xf01a3718,%edx
+f0101960:	72 26                	jb     f0101988 <page_free+0x4e>
+f0101962:	8b 15 30 37 1a f0    	mov    0xf01a3730,%edx
+f0101968:	89 10                	mov    %edx,(%eax)
+f010196a:	a3 30 37 1a f0       	mov    %eax,0xf01a3730
+f010196f:	c9                   	leave
+f0101970:	c3                   	ret
+f0101971:	83 ec 04             	sub    $0x4,%esp
+f0101974:	68 c0 a7 10 f0       	push   $0xf010a7c0
+f0101979:	68 d6 01 00 00       	push   $0x1d6
+f010197e:	68 29 b1 10 f0       	push   $0xf010b129
+f0101983:	e8 a3 e7 ff ff       	call   f010012b <_panic>
+f0101988:	8b 15 34 37 1a f0    	mov    0xf01a3734,%edx
+f010198e:	89 10                	mov    %edx,(%eax)
+f0101990:	a3 34 37 1a f0       	mov    %eax,0xf01a3734
+f0101995:	eb d8                	jmp    f010196f <page_free+0x35>
+
+f0101997 <page_decref_batch>:
+f0101997:	55                   	push   %ebp
+f0101998:	89 e5                	mov    %esp,%ebp
+f010199a:	53                   	push   %ebx
+f010199b:	83 ec 04             	sub    $0x4,%esp
+f010199e:	89 d3                	mov    %edx,%ebx
+f01019a0:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+f01019a4:	83 ea 01             	sub    $0x1,%edx
+f01019a7:	66 89 50 04          	mov    %dx,0x4(%eax)
+f01019ab:	66 85 d2             	test   %dx,%dx
+f01019ae:	75 22                	jne    f01019d2 <page_decref_batch+0x3b>
+f01019b0:	83 38 00             	cmpl   $0x0,(%eax)
+f01019b3:	75 22                	jne    f01019d7 <page_decref_batch+0x40>
+f01019b5:	89 c2                	mov    %eax,%edx
+f01019b7:	2b 15 10 37 1a f0    	sub    0xf01a3710,%edx
+f01019bd:	c1 fa 03             	sar    $0x3,%edx
+f01019c0:	3b 15 18 37 1a f0    	cmp    0xf01a3718,%edx
+f01019c6:	73 30                	jae    f01019f8 <page_decref_batch+0x61>
+f01019c8:	8b 13                	mov    (%ebx),%edx
+f01019ca:	89 10                	mov    %edx,(%eax)
+f01019cc:	85 d2                	test   %edx,%edx
+f01019ce:	74 36                	je     f0101a06 <page_decref_batch+0x6f>
+f01019d0:	89 03                	mov    %eax,(%ebx)
+f01019d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01019d5:	c9                   	leave
+f01019d6:	c3                   	ret
+f01019d7:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f01019dd:	c1 f8 03             	sar    $0x3,%eax
+f01019e0:	c1 e0 0c             	shl    $0xc,%eax
+f01019e3:	50                   	push   %eax
+f01019e4:	68 f4 a7 10 f0       	push   $0xf010a7f4
+f01019e9:	68 49 03 00 00       	push   $0x349
+f01019ee:	68 29 b1 10 f0       	push   $0xf010b129
+f01019f3:	e8 33 e7 ff ff       	call   f010012b <_panic>
+f01019f8:	83 ec 0c             	sub    $0xc,%esp
+f01019fb:	50                   	push   %eax
+f01019fc:	e8 39 ff ff ff       	call   f010193a <page_free>
+f0101a01:	83 c4 10             	add    $0x10,%esp
+f0101a04:	eb cc                	jmp    f01019d2 <page_decref_batch+0x3b>
+f0101a06:	89 01                	mov    %eax,(%ecx)
+f0101a08:	eb c6                	jmp    f01019d0 <page_decref_batch+0x39>
+
+f0101a0a <page_decref>:
+f0101a0a:	55                   	push   %ebp
+f0101a0b:	89 e5                	mov    %esp,%ebp
+f0101a0d:	83 ec 08             	sub    $0x8,%esp
+f0101a10:	8b 55 08             	mov    0x8(%ebp),%edx
+f0101a13:	0f b7 42 04          	movzwl 0x4(%edx),%eax
+f0101a17:	83 e8 01             	sub    $0x1,%eax
+f0101a1a:	66 89 42 04          	mov    %ax,0x4(%edx)
+f0101a1e:	66 85 c0             	test   %ax,%ax
+f0101a21:	74 02                	je     f0101a25 <page_decref+0x1b>
+f0101a23:	c9                   	leave
+f0101a24:	c3                   	ret
+f0101a25:	83 ec 0c             	sub    $0xc,%esp
+f0101a28:	52                   	push   %edx
+f0101a29:	e8 0c ff ff ff       	call   f010193a <page_free>
+f0101a2e:	83 c4 10             	add    $0x10,%esp
+f0101a31:	eb f0                	jmp    f0101a23 <page_decref+0x19>
+
+f0101a33 <pgdir_set_owner>:
+f0101a33:	55                   	push   %ebp
+f0101a34:	89 e5                	mov    %esp,%ebp
+f0101a36:	83 ec 08             	sub    $0x8,%esp
+f0101a39:	8b 45 08             	mov    0x8(%ebp),%eax
+f0101a3c:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0101a3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0101a44:	85 d2                	test   %edx,%edx
+f0101a46:	74 12                	je     f0101a5a <pgdir_set_owner+0x27>
+f0101a48:	2b 15 44 37 1a f0    	sub    0xf01a3744,%edx
+f0101a4e:	c1 fa 07             	sar    $0x7,%edx
+f0101a51:	69 d2 b7 6d db b6    	imul   $0xb6db6db7,%edx,%edx
+f0101a57:	8d 4a 01             	lea    0x1(%edx),%ecx
+f0101a5a:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0101a5f:	76 1d                	jbe    f0101a7e <pgdir_set_owner+0x4b>
+f0101a61:	05 00 00 00 10       	add    $0x10000000,%eax
+f0101a66:	c1 e8 0c             	shr    $0xc,%eax
+f0101a69:	3b 05 1c 37 1a f0    	cmp    0xf01a371c,%eax
+f0101a6f:	73 22                	jae    f0101a93 <pgdir_set_owner+0x60>
+f0101a71:	8b 15 10 37 1a f0    	mov    0xf01a3710,%edx
+f0101a77:	66 89 4c c2 06       	mov    %cx,0x6(%edx,%eax,8)
+f0101a7c:	c9                   	leave
+f0101a7d:	c3                   	ret
+f0101a7e:	50                   	push   %eax
+f0101a7f:	68 08 9e 10 f0       	push   $0xf0109e08
+f0101a84:	68 f9 01 00 00       	push   $0x1f9
+f0101a89:	68 29 b1 10 f0       	push   $0xf010b129
+f0101a8e:	e8 98 e6 ff ff       	call   f010012b <_panic>
+f0101a93:	83 ec 04             	sub    $0x4,%esp
+f0101a96:	68 b8 a6 10 f0       	push   $0xf010a6b8
+f0101a9b:	6a 63                	push   $0x63
+f0101a9d:	68 52 b1 10 f0       	push   $0xf010b152
+f0101aa2:	e8 84 e6 ff ff       	call   f010012b <_panic>
+
+f0101aa7 <page_free_count>:
+f0101aa7:	8b 15 34 37 1a f0    	mov    0xf01a3734,%edx
+f0101aad:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101ab2:	eb 05                	jmp    f0101ab9 <page_free_count+0x12>
+f0101ab4:	83 c0 01             	add    $0x1,%eax
+f0101ab7:	8b 12                	mov    (%edx),%edx
+f0101ab9:	85 d2                	test   %edx,%edx
+f0101abb:	75 f7                	jne    f0101ab4 <page_free_count+0xd>
+f0101abd:	8b 15 30 37 1a f0    	mov    0xf01a3730,%edx
+f0101ac3:	eb 05                	jmp    f0101aca <page_free_count+0x23>
+f0101ac5:	83 c0 01             	add    $0x1,%eax
+f0101ac8:	8b 12                	mov    (%edx),%edx
+f0101aca:	85 d2                	test   %edx,%edx
+f0101acc:	75 f7                	jne    f0101ac5 <page_free_count+0x1e>
+f0101ace:	c3                   	ret
+
+f0101acf <pgdir_teardown>:
+f0101acf:	55                   	push   %ebp
+f0101ad0:	89 e5                	mov    %esp,%ebp
+f0101ad2:	57                   	push   %edi
+f0101ad3:	56                   	push   %esi
+f0101ad4:	53                   	push   %ebx
+f0101ad5:	83 ec 2c             	sub    $0x2c,%esp
+f0101ad8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0101adb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0101ae2:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f0101ae9:	89 df                	mov    %ebx,%edi
+f0101aeb:	8d 83 b0 0e 00 00    	lea    0xeb0(%ebx),%eax
+f0101af1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0101af4:	e9 8a 00 00 00       	jmp    f0101b83 <pgdir_teardown+0xb4>
+f0101af9:	56                   	push   %esi
+f0101afa:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0101aff:	68 68 03 00 00       	push   $0x368
+f0101b04:	68 29 b1 10 f0       	push   $0xf010b129
+f0101b09:	e8 1d e6 ff ff       	call   f010012b <_panic>
+f0101b0e:	83 ec 04             	sub    $0x4,%esp
+f0101b11:	68 b8 a6 10 f0       	push   $0xf010a6b8
+f0101b16:	6a 63                	push   $0x63
+f0101b18:	68 52 b1 10 f0       	push   $0xf010b152
+f0101b1d:	e8 09 e6 ff ff       	call   f010012b <_panic>
+f0101b22:	83 c3 04             	add    $0x4,%ebx
+f0101b25:	39 f3                	cmp    %esi,%ebx
+f0101b27:	74 27                	je     f0101b50 <pgdir_teardown+0x81>
+f0101b29:	8b 03                	mov    (%ebx),%eax
+f0101b2b:	a8 01                	test   $0x1,%al
+f0101b2d:	74 f3                	je     f0101b22 <pgdir_teardown+0x53>
+f0101b2f:	c1 e8 0c             	shr    $0xc,%eax
+f0101b32:	3b 05 1c 37 1a f0    	cmp    0xf01a371c,%eax
+f0101b38:	73 d4                	jae    f0101b0e <pgdir_teardown+0x3f>
+f0101b3a:	8b 15 10 37 1a f0    	mov    0xf01a3710,%edx
+f0101b40:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0101b43:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+f0101b46:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0101b49:	e8 49 fe ff ff       	call   f0101997 <page_decref_batch>
+f0101b4e:	eb d2                	jmp    f0101b22 <pgdir_teardown+0x53>
+f0101b50:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101b53:	8b 00                	mov    (%eax),%eax
+f0101b55:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f0101b58:	c1 e8 0c             	shr    $0xc,%eax
+f0101b5b:	3b 05 1c 37 1a f0    	cmp    0xf01a371c,%eax
+f0101b61:	73 58                	jae    f0101bbb <pgdir_teardown+0xec>
+f0101b63:	8b 15 10 37 1a f0    	mov    0xf01a3710,%edx
+f0101b69:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0101b6c:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+f0101b6f:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0101b72:	e8 20 fe ff ff       	call   f0101997 <page_decref_batch>
+f0101b77:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101b7a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f0101b80:	83 c7 04             	add    $0x4,%edi
+f0101b83:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0101b86:	39 c7                	cmp    %eax,%edi
+f0101b88:	74 45                	je     f0101bcf <pgdir_teardown+0x100>
+f0101b8a:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+f0101b8d:	8b 07                	mov    (%edi),%eax
+f0101b8f:	a8 01                	test   $0x1,%al
+f0101b91:	74 ed                	je     f0101b80 <pgdir_teardown+0xb1>
+f0101b93:	89 c6                	mov    %eax,%esi
+f0101b95:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f0101b9b:	c1 e8 0c             	shr    $0xc,%eax
+f0101b9e:	3b 05 18 37 1a f0    	cmp    0xf01a3718,%eax
+f0101ba4:	0f 83 4f ff ff ff    	jae    f0101af9 <pgdir_teardown+0x2a>
+f0101baa:	8d 9e 00 00 00 f0    	lea    -0x10000000(%esi),%ebx
+f0101bb0:	81 ee 00 f0 ff 0f    	sub    $0xffff000,%esi
+f0101bb6:	e9 6a ff ff ff       	jmp    f0101b25 <pgdir_teardown+0x56>
+f0101bbb:	83 ec 04             	sub    $0x4,%esp
+f0101bbe:	68 b8 a6 10 f0       	push   $0xf010a6b8
+f0101bc3:	6a 63                	push   $0x63
+f0101bc5:	68 52 b1 10 f0       	push   $0xf010b152
+f0101bca:	e8 5c e5 ff ff       	call   f010012b <_panic>
+f0101bcf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0101bd2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101bd5:	85 c0                	test   %eax,%eax
+f0101bd7:	74 10                	je     f0101be9 <pgdir_teardown+0x11a>
+f0101bd9:	8b 0d 34 37 1a f0    	mov    0xf01a3734,%ecx
+f0101bdf:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0101be2:	89 0a                	mov    %ecx,(%edx)
+f0101be4:	a3 34 37 1a f0       	mov    %eax,0xf01a3734
+f0101be9:	89 d8                	mov    %ebx,%eax
+f0101beb:	e8 55 f8 ff ff       	call   f0101445 <pgdir_env>
+f0101bf0:	85 c0                	test   %eax,%eax
+f0101bf2:	74 14                	je     f0101c08 <pgdir_teardown+0x139>
+f0101bf4:	c7 80 cc 00 00 00 00 	movl   $0x0,0xcc(%eax)
+f0101bfb:	00 00 00 
+f0101bfe:	c7 80 c8 00 00 00 00 	movl   $0x0,0xc8(%eax)
+f0101c05:	00 00 00 
+f0101c08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101c0b:	5b                   	pop    %ebx
+f0101c0c:	5e                   	pop    %esi
+f0101c0d:	5f                   	pop    %edi
+f0101c0e:	5d                   	pop    %ebp
+f0101c0f:	c3                   	ret
+
+f0101c10 <tlb_invalidate>:
+f0101c10:	55                   	push   %ebp
+f0101c11:	89 e5                	mov    %esp,%ebp
+f0101c13:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0101c19:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0101c1d:	74 11                	je     f0101c30 <tlb_invalidate+0x20>
+f0101c1f:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0101c25:	8b 40 04             	mov    0x4(%eax),%eax
+f0101c28:	8b 55 08             	mov    0x8(%ebp),%edx
+f0101c2b:	39 50 50             	cmp    %edx,0x50(%eax)
+f0101c2e:	75 06                	jne    f0101c36 <tlb_invalidate+0x26>
+f0101c30:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101c33:	0f 01 38             	invlpg (%eax)
+f0101c36:	5d                   	pop    %ebp
+f0101c37:	c3                   	ret
+
+f0101c38 <kmap>:
+f0101c38:	55                   	push   %ebp
+f0101c39:	89 e5                	mov    %esp,%ebp
+f0101c3b:	57                   	push   %edi
+f0101c3c:	56                   	push   %esi
+f0101c3d:	53                   	push   %ebx
+f0101c3e:	83 ec 0c             	sub    $0xc,%esp
+f0101c41:	8b 55 08             	mov    0x8(%ebp),%edx
+f0101c44:	2b 15 10 37 1a f0    	sub    0xf01a3710,%edx
+f0101c4a:	c1 fa 03             	sar    $0x3,%edx
+f0101c4d:	8b 0d 18 37 1a f0    	mov    0xf01a3718,%ecx
+f0101c53:	39 ca                	cmp    %ecx,%edx
+f0101c55:	72 5b                	jb     f0101cb2 <kmap+0x7a>
+f0101c57:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0101c5d:	80 78 14 08          	cmpb   $0x8,0x14(%eax)
+f0101c61:	74 77                	je     f0101cda <kmap+0xa2>
+f0101c63:	65 8b 3d 00 00 00 00 	mov    %gs:0x0,%edi
+f0101c6a:	65 8b 1d 00 00 00 00 	mov    %gs:0x0,%ebx
+f0101c71:	0f b6 4b 14          	movzbl 0x14(%ebx),%ecx
+f0101c75:	8d 71 01             	lea    0x1(%ecx),%esi
+f0101c78:	89 f0                	mov    %esi,%eax
+f0101c7a:	88 43 14             	mov    %al,0x14(%ebx)
+f0101c7d:	89 f8                	mov    %edi,%eax
+f0101c7f:	2d 40 70 25 f0       	sub    $0xf0257040,%eax
+f0101c84:	c1 f8 06             	sar    $0x6,%eax
+f0101c87:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0101c8d:	0f b6 c9             	movzbl %cl,%ecx
+f0101c90:	8d 04 c1             	lea    (%ecx,%eax,8),%eax
+f0101c93:	c1 e2 0c             	shl    $0xc,%edx
+f0101c96:	83 ca 03             	or     $0x3,%edx
+f0101c99:	8b 0d 2c 37 1a f0    	mov    0xf01a372c,%ecx
+f0101c9f:	89 14 81             	mov    %edx,(%ecx,%eax,4)
+f0101ca2:	c1 e0 0c             	shl    $0xc,%eax
+f0101ca5:	2d 00 00 44 10       	sub    $0x10440000,%eax
+f0101caa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101cad:	5b                   	pop    %ebx
+f0101cae:	5e                   	pop    %esi
+f0101caf:	5f                   	pop    %edi
+f0101cb0:	5d                   	pop    %ebp
+f0101cb1:	c3                   	ret
+f0101cb2:	89 d0                	mov    %edx,%eax
+f0101cb4:	c1 e0 0c             	shl    $0xc,%eax
+f0101cb7:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f0101cbd:	39 ca                	cmp    %ecx,%edx
+f0101cbf:	73 07                	jae    f0101cc8 <kmap+0x90>
+f0101cc1:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0101cc6:	eb e2                	jmp    f0101caa <kmap+0x72>
+f0101cc8:	50                   	push   %eax
+f0101cc9:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0101cce:	6a 71                	push   $0x71
+f0101cd0:	68 52 b1 10 f0       	push   $0xf010b152
+f0101cd5:	e8 51 e4 ff ff       	call   f010012b <_panic>
+f0101cda:	83 ec 04             	sub    $0x4,%esp
+f0101cdd:	68 19 b2 10 f0       	push   $0xf010b219
+f0101ce2:	68 ee 03 00 00       	push   $0x3ee
+f0101ce7:	68 29 b1 10 f0       	push   $0xf010b129
+f0101cec:	e8 3a e4 ff ff       	call   f010012b <_panic>
+
+f0101cf1 <kunmap>:
+f0101cf1:	55                   	push   %ebp
+f0101cf2:	89 e5                	mov    %esp,%ebp
+f0101cf4:	53                   	push   %ebx
+f0101cf5:	83 ec 04             	sub    $0x4,%esp
+f0101cf8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0101cfb:	8d 91 00 00 44 10    	lea    0x10440000(%ecx),%edx
+f0101d01:	81 fa ff ff 03 00    	cmp    $0x3ffff,%edx
+f0101d07:	77 43                	ja     f0101d4c <kunmap+0x5b>
+f0101d09:	c1 ea 0c             	shr    $0xc,%edx
+f0101d0c:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0101d12:	65 8b 1d 00 00 00 00 	mov    %gs:0x0,%ebx
+f0101d19:	2d 40 70 25 f0       	sub    $0xf0257040,%eax
+f0101d1e:	c1 f8 06             	sar    $0x6,%eax
+f0101d21:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0101d27:	0f b6 5b 14          	movzbl 0x14(%ebx),%ebx
+f0101d2b:	8d 44 c3 ff          	lea    -0x1(%ebx,%eax,8),%eax
+f0101d2f:	39 d0                	cmp    %edx,%eax
+f0101d31:	75 1e                	jne    f0101d51 <kunmap+0x60>
+f0101d33:	a1 2c 37 1a f0       	mov    0xf01a372c,%eax
+f0101d38:	c7 04 90 00 00 00 00 	movl   $0x0,(%eax,%edx,4)
+f0101d3f:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0101d45:	80 68 14 01          	subb   $0x1,0x14(%eax)
+f0101d49:	0f 01 39             	invlpg (%ecx)
+f0101d4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101d4f:	c9                   	leave
+f0101d50:	c3                   	ret
+f0101d51:	51                   	push   %ecx
+f0101d52:	68 1c a8 10 f0       	push   $0xf010a81c
+f0101d57:	68 02 04 00 00       	push   $0x402
+f0101d5c:	68 29 b1 10 f0       	push   $0xf010b129
+f0101d61:	e8 c5 e3 ff ff       	call   f010012b <_panic>
+
+f0101d66 <page_alloc>:
+f0101d66:	55                   	push   %ebp
+f0101d67:	89 e5                	mov    %esp,%ebp
+f0101d69:	56                   	push   %esi
+f0101d6a:	53                   	push   %ebx
+f0101d6b:	8b 45 08             	mov    0x8(%ebp),%eax
+f0101d6e:	8b 1d 34 37 1a f0    	mov    0xf01a3734,%ebx
+f0101d74:	a8 02                	test   $0x2,%al
+f0101d76:	74 15                	je     f0101d8d <page_alloc+0x27>
+f0101d78:	8b 1d 30 37 1a f0    	mov    0xf01a3730,%ebx
+f0101d7e:	ba 30 37 1a f0       	mov    $0xf01a3730,%edx
+f0101d83:	85 db                	test   %ebx,%ebx
+f0101d85:	75 0f                	jne    f0101d96 <page_alloc+0x30>
+f0101d87:	8b 1d 34 37 1a f0    	mov    0xf01a3734,%ebx
+f0101d8d:	85 db                	test   %ebx,%ebx
+f0101d8f:	74 13                	je     f0101da4 <page_alloc+0x3e>
+f0101d91:	ba 34 37 1a f0       	mov    $0xf01a3734,%edx
+f0101d96:	8b 0b                	mov    (%ebx),%ecx
+f0101d98:	89 0a                	mov    %ecx,(%edx)
+f0101d9a:	a8 01                	test   $0x1,%al
+f0101d9c:	75 0f                	jne    f0101dad <page_alloc+0x47>
+f0101d9e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+f0101da4:	89 d8                	mov    %ebx,%eax
+f0101da6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101da9:	5b                   	pop    %ebx
+f0101daa:	5e                   	pop    %esi
+f0101dab:	5d                   	pop    %ebp
+f0101dac:	c3                   	ret
+f0101dad:	83 ec 0c             	sub    $0xc,%esp
+f0101db0:	53                   	push   %ebx
+f0101db1:	e8 82 fe ff ff       	call   f0101c38 <kmap>
+f0101db6:	89 c6                	mov    %eax,%esi
+f0101db8:	89 04 24             	mov    %eax,(%esp)
+f0101dbb:	e8 fe 71 00 00       	call   f0108fbe <page_zero>
+f0101dc0:	89 34 24             	mov    %esi,(%esp)
+f0101dc3:	e8 29 ff ff ff       	call   f0101cf1 <kunmap>
+f0101dc8:	83 c4 10             	add    $0x10,%esp
+f0101dcb:	eb d1                	jmp    f0101d9e <page_alloc+0x38>
+
+f0101dcd <pgdir_walk>:
+f0101dcd:	55                   	push   %ebp
+f0101dce:	89 e5                	mov    %esp,%ebp
+f0101dd0:	57                   	push   %edi
+f0101dd1:	56                   	push   %esi
+f0101dd2:	53                   	push   %ebx
+f0101dd3:	83 ec 0c             	sub    $0xc,%esp
+f0101dd6:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0101dd9:	89 f0                	mov    %esi,%eax
+f0101ddb:	c1 e8 16             	shr    $0x16,%eax
+f0101dde:	8b 55 08             	mov    0x8(%ebp),%edx
+f0101de1:	8d 3c 82             	lea    (%edx,%eax,4),%edi
+f0101de4:	8b 1f                	mov    (%edi),%ebx
+f0101de6:	f6 c3 01             	test   $0x1,%bl
+f0101de9:	75 42                	jne    f0101e2d <pgdir_walk+0x60>
+f0101deb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0101def:	74 7d                	je     f0101e6e <pgdir_walk+0xa1>
+f0101df1:	83 ec 0c             	sub    $0xc,%esp
+f0101df4:	6a 01                	push   $0x1
+f0101df6:	e8 6b ff ff ff       	call   f0101d66 <page_alloc>
+f0101dfb:	89 c3                	mov    %eax,%ebx
+f0101dfd:	83 c4 10             	add    $0x10,%esp
+f0101e00:	85 c0                	test   %eax,%eax
+f0101e02:	74 4b                	je     f0101e4f <pgdir_walk+0x82>
+f0101e04:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+f0101e09:	8b 45 08             	mov    0x8(%ebp),%eax
+f0101e0c:	e8 34 f6 ff ff       	call   f0101445 <pgdir_env>
+f0101e11:	85 c0                	test   %eax,%eax
+f0101e13:	74 07                	je     f0101e1c <pgdir_walk+0x4f>
+f0101e15:	83 80 cc 00 00 00 01 	addl   $0x1,0xcc(%eax)
+f0101e1c:	2b 1d 10 37 1a f0    	sub    0xf01a3710,%ebx
+f0101e22:	c1 fb 03             	sar    $0x3,%ebx
+f0101e25:	c1 e3 0c             	shl    $0xc,%ebx
+f0101e28:	83 cb 07             	or     $0x7,%ebx
+f0101e2b:	89 1f                	mov    %ebx,(%edi)
+f0101e2d:	89 d8                	mov    %ebx,%eax
+f0101e2f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0101e34:	c1 eb 0c             	shr    $0xc,%ebx
+f0101e37:	3b 1d 18 37 1a f0    	cmp    0xf01a3718,%ebx
+f0101e3d:	73 1a                	jae    f0101e59 <pgdir_walk+0x8c>
+f0101e3f:	c1 ee 0a             	shr    $0xa,%esi
+f0101e42:	81 e6 fc 0f 00 00    	and    $0xffc,%esi
+f0101e48:	8d 9c 30 00 00 00 f0 	lea    -0x10000000(%eax,%esi,1),%ebx
+f0101e4f:	89 d8                	mov    %ebx,%eax
+f0101e51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101e54:	5b                   	pop    %ebx
+f0101e55:	5e                   	pop    %esi
+f0101e56:	5f                   	pop    %edi
+f0101e57:	5d                   	pop    %ebp
+f0101e58:	c3                   	ret
+f0101e59:	50                   	push   %eax
+f0101e5a:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0101e5f:	68 5a 02 00 00       	push   $0x25a
+f0101e64:	68 29 b1 10 f0       	push   $0xf010b129
+f0101e69:	e8 bd e2 ff ff       	call   f010012b <_panic>
+f0101e6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101e73:	eb da                	jmp    f0101e4f <pgdir_walk+0x82>
+
+f0101e75 <boot_map_region>:
+f0101e75:	55                   	push   %ebp
+f0101e76:	89 e5                	mov    %esp,%ebp
+f0101e78:	57                   	push   %edi
+f0101e79:	56                   	push   %esi
+f0101e7a:	53                   	push   %ebx
+f0101e7b:	83 ec 1c             	sub    $0x1c,%esp
+f0101e7e:	89 c7                	mov    %eax,%edi
+f0101e80:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0101e83:	89 ce                	mov    %ecx,%esi
+f0101e85:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101e8a:	eb 2e                	jmp    f0101eba <boot_map_region+0x45>
+f0101e8c:	83 ec 04             	sub    $0x4,%esp
+f0101e8f:	6a 01                	push   $0x1
+f0101e91:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101e94:	01 d8                	add    %ebx,%eax
+f0101e96:	50                   	push   %eax
+f0101e97:	57                   	push   %edi
+f0101e98:	e8 30 ff ff ff       	call   f0101dcd <pgdir_walk>
+f0101e9d:	89 c2                	mov    %eax,%edx
+f0101e9f:	89 d8                	mov    %ebx,%eax
+f0101ea1:	03 45 08             	add    0x8(%ebp),%eax
+f0101ea4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0101ea9:	0b 45 0c             	or     0xc(%ebp),%eax
+f0101eac:	83 c8 01             	or     $0x1,%eax
+f0101eaf:	89 02                	mov    %eax,(%edx)
+f0101eb1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0101eb7:	83 c4 10             	add    $0x10,%esp
+f0101eba:	39 f3                	cmp    %esi,%ebx
+f0101ebc:	72 ce                	jb     f0101e8c <boot_map_region+0x17>
+f0101ebe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101ec1:	5b                   	pop    %ebx
+f0101ec2:	5e                   	pop    %esi
+f0101ec3:	5f                   	pop    %edi
+f0101ec4:	5d                   	pop    %ebp
+f0101ec5:	c3                   	ret
+
+f0101ec6 <mmio_map_region>:
+f0101ec6:	55                   	push   %ebp
+f0101ec7:	89 e5                	mov    %esp,%ebp
+f0101ec9:	56                   	push   %esi
+f0101eca:	53                   	push   %ebx
+f0101ecb:	8b 45 08             	mov    0x8(%ebp),%eax
+f0101ece:	89 c2                	mov    %eax,%edx
+f0101ed0:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0101ed6:	89 c6                	mov    %eax,%esi
+f0101ed8:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+f0101ede:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0101ee1:	8d 9c 08 ff 0f 00 00 	lea    0xfff(%eax,%ecx,1),%ebx
+f0101ee8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f0101eee:	29 d3                	sub    %edx,%ebx
+f0101ef0:	a1 04 73 11 f0       	mov    0xf0117304,%eax
+f0101ef5:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+f0101ef8:	81 f9 00 00 bc ef    	cmp    $0xefbc0000,%ecx
+f0101efe:	77 2a                	ja     f0101f2a <mmio_map_region+0x64>
+f0101f00:	83 ec 08             	sub    $0x8,%esp
+f0101f03:	6a 1b                	push   $0x1b
+f0101f05:	52                   	push   %edx
+f0101f06:	89 d9                	mov    %ebx,%ecx
+f0101f08:	89 c2                	mov    %eax,%edx
+f0101f0a:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f0101f0f:	e8 61 ff ff ff       	call   f0101e75 <boot_map_region>
+f0101f14:	a1 04 73 11 f0       	mov    0xf0117304,%eax
+f0101f19:	01 c3                	add    %eax,%ebx
+f0101f1b:	89 1d 04 73 11 f0    	mov    %ebx,0xf0117304
+f0101f21:	01 f0                	add    %esi,%eax
+f0101f23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101f26:	5b                   	pop    %ebx
+f0101f27:	5e                   	pop    %esi
+f0101f28:	5d                   	pop    %ebp
+f0101f29:	c3                   	ret
+f0101f2a:	83 ec 04             	sub    $0x4,%esp
+f0101f2d:	68 40 a8 10 f0       	push   $0xf010a840
+f0101f32:	68 b0 03 00 00       	push   $0x3b0
+f0101f37:	68 29 b1 10 f0       	push   $0xf010b129
+f0101f3c:	e8 ea e1 ff ff       	call   f010012b <_panic>
+
+f0101f41 <page_lookup>:
+f0101f41:	55                   	push   %ebp
+f0101f42:	89 e5                	mov    %esp,%ebp
+f0101f44:	53                   	push   %ebx
+f0101f45:	83 ec 08             	sub    $0x8,%esp
+f0101f48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+f0101f4b:	6a 00                	push   $0x0
+f0101f4d:	ff 75 0c             	push   0xc(%ebp)
+f0101f50:	ff 75 08             	push   0x8(%ebp)
+f0101f53:	e8 75 fe ff ff       	call   f0101dcd <pgdir_walk>
+f0101f58:	83 c4 10             	add    $0x10,%esp
+f0101f5b:	85 c0                	test   %eax,%eax
+f0101f5d:	74 21                	je     f0101f80 <page_lookup+0x3f>
+f0101f5f:	f6 00 01             	testb  $0x1,(%eax)
+f0101f62:	74 35                	je     f0101f99 <page_lookup+0x58>
+f0101f64:	85 db                	test   %ebx,%ebx
+f0101f66:	74 02                	je     f0101f6a <page_lookup+0x29>
+f0101f68:	89 03                	mov    %eax,(%ebx)
+f0101f6a:	8b 00                	mov    (%eax),%eax
+f0101f6c:	c1 e8 0c             	shr    $0xc,%eax
+f0101f6f:	3b 05 1c 37 1a f0    	cmp    0xf01a371c,%eax
+f0101f75:	73 0e                	jae    f0101f85 <page_lookup+0x44>
+f0101f77:	8b 15 10 37 1a f0    	mov    0xf01a3710,%edx
+f0101f7d:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0101f80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101f83:	c9                   	leave
+f0101f84:	c3                   	ret
+f0101f85:	83 ec 04             	sub    $0x4,%esp
+f0101f88:	68 b8 a6 10 f0       	push   $0xf010a6b8
+f0101f8d:	6a 63                	push   $0x63
+f0101f8f:	68 52 b1 10 f0       	push   $0xf010b152
+f0101f94:	e8 92 e1 ff ff       	call   f010012b <_panic>
+f0101f99:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101f9e:	eb e0                	jmp    f0101f80 <page_lookup+0x3f>
+
+f0101fa0 <env_page_charge>:
+f0101fa0:	55                   	push   %ebp
+f0101fa1:	89 e5                	mov    %esp,%ebp
+f0101fa3:	53                   	push   %ebx
+f0101fa4:	83 ec 04             	sub    $0x4,%esp
+f0101fa7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0101faa:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101faf:	83 7b 54 00          	cmpl   $0x0,0x54(%ebx)
+f0101fb3:	75 05                	jne    f0101fba <env_page_charge+0x1a>
+f0101fb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101fb8:	c9                   	leave
+f0101fb9:	c3                   	ret
+f0101fba:	83 ec 04             	sub    $0x4,%esp
+f0101fbd:	6a 00                	push   $0x0
+f0101fbf:	ff 75 0c             	push   0xc(%ebp)
+f0101fc2:	ff 73 50             	push   0x50(%ebx)
+f0101fc5:	e8 77 ff ff ff       	call   f0101f41 <page_lookup>
+f0101fca:	89 c2                	mov    %eax,%edx
+f0101fcc:	83 c4 10             	add    $0x10,%esp
+f0101fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101fd4:	85 d2                	test   %edx,%edx
+f0101fd6:	75 dd                	jne    f0101fb5 <env_page_charge+0x15>
+f0101fd8:	8b 83 cc 00 00 00    	mov    0xcc(%ebx),%eax
+f0101fde:	03 83 c8 00 00 00    	add    0xc8(%ebx),%eax
+f0101fe4:	8d 50 02             	lea    0x2(%eax),%edx
+f0101fe7:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101fea:	c1 e8 16             	shr    $0x16,%eax
+f0101fed:	8b 4b 50             	mov    0x50(%ebx),%ecx
+f0101ff0:	8b 0c 81             	mov    (%ecx,%eax,4),%ecx
+f0101ff3:	83 e1 01             	and    $0x1,%ecx
+f0101ff6:	89 d0                	mov    %edx,%eax
+f0101ff8:	29 c8                	sub    %ecx,%eax
+f0101ffa:	39 43 54             	cmp    %eax,0x54(%ebx)
+f0101ffd:	19 c0                	sbb    %eax,%eax
+f0101fff:	83 e0 fc             	and    $0xfffffffc,%eax
+f0102002:	eb b1                	jmp    f0101fb5 <env_page_charge+0x15>
+
+f0102004 <page_remove>:
+f0102004:	55                   	push   %ebp
+f0102005:	89 e5                	mov    %esp,%ebp
+f0102007:	56                   	push   %esi
+f0102008:	53                   	push   %ebx
+f0102009:	83 ec 14             	sub    $0x14,%esp
+f010200c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010200f:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0102012:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+f0102019:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f010201c:	50                   	push   %eax
+f010201d:	56                   	push   %esi
+f010201e:	53                   	push   %ebx
+f010201f:	e8 1d ff ff ff       	call   f0101f41 <page_lookup>
+f0102024:	83 c4 10             	add    $0x10,%esp
+f0102027:	85 c0                	test   %eax,%eax
+f0102029:	74 38                	je     f0102063 <page_remove+0x5f>
+f010202b:	83 ec 0c             	sub    $0xc,%esp
+f010202e:	50                   	push   %eax
+f010202f:	e8 d6 f9 ff ff       	call   f0101a0a <page_decref>
+f0102034:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0102037:	83 c4 10             	add    $0x10,%esp
+f010203a:	85 c0                	test   %eax,%eax
+f010203c:	74 13                	je     f0102051 <page_remove+0x4d>
+f010203e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f0102044:	83 ec 08             	sub    $0x8,%esp
+f0102047:	56                   	push   %esi
+f0102048:	53                   	push   %ebx
+f0102049:	e8 c2 fb ff ff       	call   f0101c10 <tlb_invalidate>
+f010204e:	83 c4 10             	add    $0x10,%esp
+f0102051:	89 d8                	mov    %ebx,%eax
+f0102053:	e8 ed f3 ff ff       	call   f0101445 <pgdir_env>
+f0102058:	85 c0                	test   %eax,%eax
+f010205a:	74 07                	je     f0102063 <page_remove+0x5f>
+f010205c:	83 a8 c8 00 00 00 01 	subl   $0x1,0xc8(%eax)
+f0102063:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0102066:	5b                   	pop    %ebx
+f0102067:	5e                   	pop    %esi
+f0102068:	5d                   	pop    %ebp
+f0102069:	c3                   	ret
+
+f010206a <page_cow_reuse>:
+f010206a:	55                   	push   %ebp
+f010206b:	89 e5                	mov    %esp,%ebp
+f010206d:	56                   	push   %esi
+f010206e:	53                   	push   %ebx
+f010206f:	83 ec 14             	sub    $0x14,%esp
+f0102072:	8b 75 08             	mov    0x8(%ebp),%esi
+f0102075:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0102078:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f010207e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0102081:	50                   	push   %eax
+f0102082:	53                   	push   %ebx
+f0102083:	56                   	push   %esi
+f0102084:	e8 b8 fe ff ff       	call   f0101f41 <page_lookup>
+f0102089:	83 c4 10             	add    $0x10,%esp
+f010208c:	85 c0                	test   %eax,%eax
+f010208e:	74 43                	je     f01020d3 <page_cow_reuse+0x69>
+f0102090:	8b 55 f4             	mov    -0xc(%ebp),%edx
+f0102093:	8b 0a                	mov    (%edx),%ecx
+f0102095:	f6 c5 08             	test   $0x8,%ch
+f0102098:	74 40                	je     f01020da <page_cow_reuse+0x70>
+f010209a:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f010209f:	75 40                	jne    f01020e1 <page_cow_reuse+0x77>
+f01020a1:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f01020a7:	c1 f8 03             	sar    $0x3,%eax
+f01020aa:	c1 e0 0c             	shl    $0xc,%eax
+f01020ad:	81 e1 07 06 00 00    	and    $0x607,%ecx
+f01020b3:	09 c8                	or     %ecx,%eax
+f01020b5:	83 c8 02             	or     $0x2,%eax
+f01020b8:	89 02                	mov    %eax,(%edx)
+f01020ba:	83 ec 08             	sub    $0x8,%esp
+f01020bd:	53                   	push   %ebx
+f01020be:	56                   	push   %esi
+f01020bf:	e8 4c fb ff ff       	call   f0101c10 <tlb_invalidate>
+f01020c4:	83 c4 10             	add    $0x10,%esp
+f01020c7:	b8 00 00 00 00       	mov    $0x0,%eax
+f01020cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01020cf:	5b                   	pop    %ebx
+f01020d0:	5e                   	pop    %esi
+f01020d1:	5d                   	pop    %ebp
+f01020d2:	c3                   	ret
+f01020d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01020d8:	eb f2                	jmp    f01020cc <page_cow_reuse+0x62>
+f01020da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01020df:	eb eb                	jmp    f01020cc <page_cow_reuse+0x62>
+f01020e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01020e6:	eb e4                	jmp    f01020cc <page_cow_reuse+0x62>
+
+f01020e8 <page_insert>:
+f01020e8:	55                   	push   %ebp
+f01020e9:	89 e5                	mov    %esp,%ebp
+f01020eb:	57                   	push   %edi
+f01020ec:	56                   	push   %esi
+f01020ed:	53                   	push   %ebx
+f01020ee:	83 ec 10             	sub    $0x10,%esp
+f01020f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+f01020f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01020f7:	6a 01                	push   $0x1
+f01020f9:	ff 75 10             	push   0x10(%ebp)
+f01020fc:	57                   	push   %edi
+f01020fd:	e8 cb fc ff ff       	call   f0101dcd <pgdir_walk>
+f0102102:	83 c4 10             	add    $0x10,%esp
+f0102105:	85 c0                	test   %eax,%eax
+f0102107:	74 4b                	je     f0102154 <page_insert+0x6c>
+f0102109:	89 c6                	mov    %eax,%esi
+f010210b:	66 83 43 04 01       	addw   $0x1,0x4(%ebx)
+f0102110:	83 ec 08             	sub    $0x8,%esp
+f0102113:	ff 75 10             	push   0x10(%ebp)
+f0102116:	57                   	push   %edi
+f0102117:	e8 e8 fe ff ff       	call   f0102004 <page_remove>
+f010211c:	2b 1d 10 37 1a f0    	sub    0xf01a3710,%ebx
+f0102122:	c1 fb 03             	sar    $0x3,%ebx
+f0102125:	c1 e3 0c             	shl    $0xc,%ebx
+f0102128:	0b 5d 14             	or     0x14(%ebp),%ebx
+f010212b:	83 cb 01             	or     $0x1,%ebx
+f010212e:	89 1e                	mov    %ebx,(%esi)
+f0102130:	89 f8                	mov    %edi,%eax
+f0102132:	e8 0e f3 ff ff       	call   f0101445 <pgdir_env>
+f0102137:	83 c4 10             	add    $0x10,%esp
+f010213a:	ba 00 00 00 00       	mov    $0x0,%edx
+f010213f:	85 c0                	test   %eax,%eax
+f0102141:	74 07                	je     f010214a <page_insert+0x62>
+f0102143:	83 80 c8 00 00 00 01 	addl   $0x1,0xc8(%eax)
+f010214a:	89 d0                	mov    %edx,%eax
+f010214c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010214f:	5b                   	pop    %ebx
+f0102150:	5e                   	pop    %esi
+f0102151:	5f                   	pop    %edi
+f0102152:	5d                   	pop    %ebp
+f0102153:	c3                   	ret
+f0102154:	ba fc ff ff ff       	mov    $0xfffffffc,%edx
+f0102159:	eb ef                	jmp    f010214a <page_insert+0x62>
+
+f010215b <mem_init>:
+f010215b:	55                   	push   %ebp
+f010215c:	89 e5                	mov    %esp,%ebp
+f010215e:	57                   	push   %edi
+f010215f:	56                   	push   %esi
+f0102160:	53                   	push   %ebx
+f0102161:	83 ec 3c             	sub    $0x3c,%esp
+f0102164:	b8 15 00 00 00       	mov    $0x15,%eax
+f0102169:	e8 4b f2 ff ff       	call   f01013b9 <nvram_read>
+f010216e:	89 c3                	mov    %eax,%ebx
+f0102170:	b8 17 00 00 00       	mov    $0x17,%eax
+f0102175:	e8 3f f2 ff ff       	call   f01013b9 <nvram_read>
+f010217a:	89 c6                	mov    %eax,%esi
+f010217c:	b8 34 00 00 00       	mov    $0x34,%eax
+f0102181:	e8 33 f2 ff ff       	call   f01013b9 <nvram_read>
+f0102186:	c1 e0 06             	shl    $0x6,%eax
+f0102189:	0f 84 f1 00 00 00    	je     f0102280 <mem_init+0x125>
+f010218f:	05 00 40 00 00       	add    $0x4000,%eax
+f0102194:	89 c2                	mov    %eax,%edx
+f0102196:	c1 ea 02             	shr    $0x2,%edx
+f0102199:	89 15 1c 37 1a f0    	mov    %edx,0xf01a371c
+f010219f:	89 c2                	mov    %eax,%edx
+f01021a1:	29 da                	sub    %ebx,%edx
+f01021a3:	52                   	push   %edx
+f01021a4:	53                   	push   %ebx
+f01021a5:	50                   	push   %eax
+f01021a6:	68 64 a8 10 f0       	push   $0xf010a864
+f01021ab:	e8 73 2e 00 00       	call   f0105023 <cprintf>
+f01021b0:	83 c4 10             	add    $0x10,%esp
+f01021b3:	81 3d 1c 37 1a f0 00 	cmpl   $0x80000,0xf01a371c
+f01021ba:	00 08 00 
+f01021bd:	0f 87 cd 00 00 00    	ja     f0102290 <mem_init+0x135>
+f01021c3:	8b 15 1c 37 1a f0    	mov    0xf01a371c,%edx
+f01021c9:	b8 00 00 01 00       	mov    $0x10000,%eax
+f01021ce:	39 c2                	cmp    %eax,%edx
+f01021d0:	0f 46 c2             	cmovbe %edx,%eax
+f01021d3:	a3 18 37 1a f0       	mov    %eax,0xf01a3718
+f01021d8:	39 d0                	cmp    %edx,%eax
+f01021da:	0f 82 d4 00 00 00    	jb     f01022b4 <mem_init+0x159>
+f01021e0:	b8 00 10 00 00       	mov    $0x1000,%eax
+f01021e5:	e8 32 f1 ff ff       	call   f010131c <boot_alloc>
+f01021ea:	a3 14 37 1a f0       	mov    %eax,0xf01a3714
+f01021ef:	83 ec 04             	sub    $0x4,%esp
+f01021f2:	68 00 10 00 00       	push   $0x1000
+f01021f7:	6a 00                	push   $0x0
+f01021f9:	50                   	push   %eax
+f01021fa:	e8 8a 6c 00 00       	call   f0108e89 <memset>
+f01021ff:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f0102204:	83 c4 10             	add    $0x10,%esp
+f0102207:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010220c:	0f 86 c1 00 00 00    	jbe    f01022d3 <mem_init+0x178>
+f0102212:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f0102218:	83 ca 05             	or     $0x5,%edx
+f010221b:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+f0102221:	a1 1c 37 1a f0       	mov    0xf01a371c,%eax
+f0102226:	c1 e0 03             	shl    $0x3,%eax
+f0102229:	e8 ee f0 ff ff       	call   f010131c <boot_alloc>
+f010222e:	a3 10 37 1a f0       	mov    %eax,0xf01a3710
+f0102233:	83 ec 04             	sub    $0x4,%esp
+f0102236:	8b 0d 1c 37 1a f0    	mov    0xf01a371c,%ecx
+f010223c:	8d 14 cd 00 00 00 00 	lea    0x0(,%ecx,8),%edx
+f0102243:	52                   	push   %edx
+f0102244:	6a 00                	push   $0x0
+f0102246:	50                   	push   %eax
+f0102247:	e8 3d 6c 00 00       	call   f0108e89 <memset>
+f010224c:	c7 05 44 37 1a f0 00 	movl   $0xeb000000,0xf01a3744
+f0102253:	00 00 eb 
+f0102256:	e8 5a f5 ff ff       	call   f01017b5 <page_init>
+f010225b:	b8 01 00 00 00       	mov    $0x1,%eax
+f0102260:	e8 55 f2 ff ff       	call   f01014ba <check_page_free_list>
+f0102265:	83 c4 10             	add    $0x10,%esp
+f0102268:	83 3d 10 37 1a f0 00 	cmpl   $0x0,0xf01a3710
+f010226f:	74 77                	je     f01022e8 <mem_init+0x18d>
+f0102271:	a1 34 37 1a f0       	mov    0xf01a3734,%eax
+f0102276:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010227b:	e9 84 00 00 00       	jmp    f0102304 <mem_init+0x1a9>
+f0102280:	8d 86 00 04 00 00    	lea    0x400(%esi),%eax
+f0102286:	85 f6                	test   %esi,%esi
+f0102288:	0f 44 c3             	cmove  %ebx,%eax
+f010228b:	e9 04 ff ff ff       	jmp    f0102194 <mem_init+0x39>
+f0102290:	c7 05 1c 37 1a f0 00 	movl   $0x80000,0xf01a371c
+f0102297:	00 08 00 
+f010229a:	83 ec 08             	sub    $0x8,%esp
+f010229d:	68 00 00 20 00       	push   $0x200000
+f01022a2:	68 a0 a8 10 f0       	push   $0xf010a8a0
+f01022a7:	e8 77 2d 00 00       	call   f0105023 <cprintf>
+f01022ac:	83 c4 10             	add    $0x10,%esp
+f01022af:	e9 0f ff ff ff       	jmp    f01021c3 <mem_init+0x68>
+f01022b4:	83 ec 08             	sub    $0x8,%esp
+f01022b7:	29 c2                	sub    %eax,%edx
+f01022b9:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+f01022c0:	50                   	push   %eax
+f01022c1:	68 cc a8 10 f0       	push   $0xf010a8cc
+f01022c6:	e8 58 2d 00 00       	call   f0105023 <cprintf>
+f01022cb:	83 c4 10             	add    $0x10,%esp
+f01022ce:	e9 0d ff ff ff       	jmp    f01021e0 <mem_init+0x85>
+f01022d3:	50                   	push   %eax
+f01022d4:	68 08 9e 10 f0       	push   $0xf0109e08
+f01022d9:	68 c0 00 00 00       	push   $0xc0
+f01022de:	68 29 b1 10 f0       	push   $0xf010b129
+f01022e3:	e8 43 de ff ff       	call   f010012b <_panic>
+f01022e8:	83 ec 04             	sub    $0x4,%esp
+f01022eb:	68 2c b2 10 f0       	push   $0xf010b22c
+f01022f0:	68 bd 04 00 00       	push   $0x4bd
+f01022f5:	68 29 b1 10 f0       	push   $0xf010b129
+f01022fa:	e8 2c de ff ff       	call   f010012b <_panic>
+f01022ff:	83 c3 01             	add    $0x1,%ebx
+f0102302:	8b 00                	mov    (%eax),%eax
+f0102304:	85 c0                	test   %eax,%eax
+f0102306:	75 f7                	jne    f01022ff <mem_init+0x1a4>
+f0102308:	83 ec 0c             	sub    $0xc,%esp
+f010230b:	6a 00                	push   $0x0
+f010230d:	e8 54 fa ff ff       	call   f0101d66 <page_alloc>
+f0102312:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102315:	83 c4 10             	add    $0x10,%esp
+f0102318:	85 c0                	test   %eax,%eax
+f010231a:	0f 84 fc 01 00 00    	je     f010251c <mem_init+0x3c1>
+f0102320:	83 ec 0c             	sub    $0xc,%esp
+f0102323:	6a 00                	push   $0x0
+f0102325:	e8 3c fa ff ff       	call   f0101d66 <page_alloc>
+f010232a:	89 c7                	mov    %eax,%edi
+f010232c:	83 c4 10             	add    $0x10,%esp
+f010232f:	85 c0                	test   %eax,%eax
+f0102331:	0f 84 fe 01 00 00    	je     f0102535 <mem_init+0x3da>
+f0102337:	83 ec 0c             	sub    $0xc,%esp
+f010233a:	6a 00                	push   $0x0
+f010233c:	e8 25 fa ff ff       	call   f0101d66 <page_alloc>
+f0102341:	89 c6                	mov    %eax,%esi
+f0102343:	83 c4 10             	add    $0x10,%esp
+f0102346:	85 c0                	test   %eax,%eax
+f0102348:	0f 84 00 02 00 00    	je     f010254e <mem_init+0x3f3>
+f010234e:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0102351:	0f 84 10 02 00 00    	je     f0102567 <mem_init+0x40c>
+f0102357:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f010235a:	0f 84 20 02 00 00    	je     f0102580 <mem_init+0x425>
+f0102360:	39 c7                	cmp    %eax,%edi
+f0102362:	0f 84 18 02 00 00    	je     f0102580 <mem_init+0x425>
+f0102368:	8b 0d 10 37 1a f0    	mov    0xf01a3710,%ecx
+f010236e:	a1 1c 37 1a f0       	mov    0xf01a371c,%eax
+f0102373:	c1 e0 0c             	shl    $0xc,%eax
+f0102376:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0102379:	29 ca                	sub    %ecx,%edx
+f010237b:	c1 fa 03             	sar    $0x3,%edx
+f010237e:	c1 e2 0c             	shl    $0xc,%edx
+f0102381:	39 c2                	cmp    %eax,%edx
+f0102383:	0f 83 10 02 00 00    	jae    f0102599 <mem_init+0x43e>
+f0102389:	89 fa                	mov    %edi,%edx
+f010238b:	29 ca                	sub    %ecx,%edx
+f010238d:	c1 fa 03             	sar    $0x3,%edx
+f0102390:	c1 e2 0c             	shl    $0xc,%edx
+f0102393:	39 c2                	cmp    %eax,%edx
+f0102395:	0f 83 17 02 00 00    	jae    f01025b2 <mem_init+0x457>
+f010239b:	89 f2                	mov    %esi,%edx
+f010239d:	29 ca                	sub    %ecx,%edx
+f010239f:	c1 fa 03             	sar    $0x3,%edx
+f01023a2:	c1 e2 0c             	shl    $0xc,%edx
+f01023a5:	39 c2                	cmp    %eax,%edx
+f01023a7:	0f 83 1e 02 00 00    	jae    f01025cb <mem_init+0x470>
+f01023ad:	a1 34 37 1a f0       	mov    0xf01a3734,%eax
+f01023b2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01023b5:	c7 05 34 37 1a f0 00 	movl   $0x0,0xf01a3734
+f01023bc:	00 00 00 
+f01023bf:	83 ec 0c             	sub    $0xc,%esp
+f01023c2:	6a 00                	push   $0x0
+f01023c4:	e8 9d f9 ff ff       	call   f0101d66 <page_alloc>
+f01023c9:	83 c4 10             	add    $0x10,%esp
+f01023cc:	85 c0                	test   %eax,%eax
+f01023ce:	0f 85 10 02 00 00    	jne    f01025e4 <mem_init+0x489>
+f01023d4:	83 ec 0c             	sub    $0xc,%esp
+f01023d7:	ff 75 d4             	push   -0x2c(%ebp)
+f01023da:	e8 5b f5 ff ff       	call   f010193a <page_free>
+f01023df:	89 3c 24             	mov    %edi,(%esp)
+f01023e2:	e8 53 f5 ff ff       	call   f010193a <page_free>
+f01023e7:	89 34 24             	mov    %esi,(%esp)
+f01023ea:	e8 4b f5 ff ff       	call   f010193a <page_free>
+f01023ef:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f01023f6:	e8 6b f9 ff ff       	call   f0101d66 <page_alloc>
+f01023fb:	89 c6                	mov    %eax,%esi
+f01023fd:	83 c4 10             	add    $0x10,%esp
+f0102400:	85 c0                	test   %eax,%eax
+f0102402:	0f 84 f5 01 00 00    	je     f01025fd <mem_init+0x4a2>
+f0102408:	83 ec 0c             	sub    $0xc,%esp
+f010240b:	6a 00                	push   $0x0
+f010240d:	e8 54 f9 ff ff       	call   f0101d66 <page_alloc>
+f0102412:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102415:	83 c4 10             	add    $0x10,%esp
+f0102418:	85 c0                	test   %eax,%eax
+f010241a:	0f 84 f6 01 00 00    	je     f0102616 <mem_init+0x4bb>
+f0102420:	83 ec 0c             	sub    $0xc,%esp
+f0102423:	6a 00                	push   $0x0
+f0102425:	e8 3c f9 ff ff       	call   f0101d66 <page_alloc>
+f010242a:	89 c7                	mov    %eax,%edi
+f010242c:	83 c4 10             	add    $0x10,%esp
+f010242f:	85 c0                	test   %eax,%eax
+f0102431:	0f 84 f8 01 00 00    	je     f010262f <mem_init+0x4d4>
+f0102437:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010243a:	39 c6                	cmp    %eax,%esi
+f010243c:	0f 84 06 02 00 00    	je     f0102648 <mem_init+0x4ed>
+f0102442:	39 fe                	cmp    %edi,%esi
+f0102444:	0f 84 17 02 00 00    	je     f0102661 <mem_init+0x506>
+f010244a:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f010244d:	0f 84 0e 02 00 00    	je     f0102661 <mem_init+0x506>
+f0102453:	83 ec 0c             	sub    $0xc,%esp
+f0102456:	6a 00                	push   $0x0
+f0102458:	e8 09 f9 ff ff       	call   f0101d66 <page_alloc>
+f010245d:	83 c4 10             	add    $0x10,%esp
+f0102460:	85 c0                	test   %eax,%eax
+f0102462:	0f 85 12 02 00 00    	jne    f010267a <mem_init+0x51f>
+f0102468:	89 f0                	mov    %esi,%eax
+f010246a:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f0102470:	c1 f8 03             	sar    $0x3,%eax
+f0102473:	89 c2                	mov    %eax,%edx
+f0102475:	c1 e2 0c             	shl    $0xc,%edx
+f0102478:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010247d:	3b 05 18 37 1a f0    	cmp    0xf01a3718,%eax
+f0102483:	0f 83 0a 02 00 00    	jae    f0102693 <mem_init+0x538>
+f0102489:	83 ec 04             	sub    $0x4,%esp
+f010248c:	68 00 10 00 00       	push   $0x1000
+f0102491:	6a 01                	push   $0x1
+f0102493:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0102499:	52                   	push   %edx
+f010249a:	e8 ea 69 00 00       	call   f0108e89 <memset>
+f010249f:	89 34 24             	mov    %esi,(%esp)
+f01024a2:	e8 93 f4 ff ff       	call   f010193a <page_free>
+f01024a7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f01024ae:	e8 b3 f8 ff ff       	call   f0101d66 <page_alloc>
+f01024b3:	83 c4 10             	add    $0x10,%esp
+f01024b6:	85 c0                	test   %eax,%eax
+f01024b8:	0f 84 e7 01 00 00    	je     f01026a5 <mem_init+0x54a>
+f01024be:	39 c6                	cmp    %eax,%esi
+f01024c0:	0f 85 f8 01 00 00    	jne    f01026be <mem_init+0x563>
+f01024c6:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f01024cc:	c1 f8 03             	sar    $0x3,%eax
+f01024cf:	89 c1                	mov    %eax,%ecx
+f01024d1:	c1 e1 0c             	shl    $0xc,%ecx
+f01024d4:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01024d9:	3b 05 18 37 1a f0    	cmp    0xf01a3718,%eax
+f01024df:	0f 83 f2 01 00 00    	jae    f01026d7 <mem_init+0x57c>
+f01024e5:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+f01024eb:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f01024f1:	39 c8                	cmp    %ecx,%eax
+f01024f3:	0f 84 f0 01 00 00    	je     f01026e9 <mem_init+0x58e>
+f01024f9:	0f b6 10             	movzbl (%eax),%edx
+f01024fc:	83 c0 01             	add    $0x1,%eax
+f01024ff:	84 d2                	test   %dl,%dl
+f0102501:	74 ee                	je     f01024f1 <mem_init+0x396>
+f0102503:	68 2f b3 10 f0       	push   $0xf010b32f
+f0102508:	68 6c b1 10 f0       	push   $0xf010b16c
+f010250d:	68 eb 04 00 00       	push   $0x4eb
+f0102512:	68 29 b1 10 f0       	push   $0xf010b129
+f0102517:	e8 0f dc ff ff       	call   f010012b <_panic>
+f010251c:	68 47 b2 10 f0       	push   $0xf010b247
+f0102521:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102526:	68 c5 04 00 00       	push   $0x4c5
+f010252b:	68 29 b1 10 f0       	push   $0xf010b129
+f0102530:	e8 f6 db ff ff       	call   f010012b <_panic>
+f0102535:	68 5d b2 10 f0       	push   $0xf010b25d
+f010253a:	68 6c b1 10 f0       	push   $0xf010b16c
+f010253f:	68 c6 04 00 00       	push   $0x4c6
+f0102544:	68 29 b1 10 f0       	push   $0xf010b129
+f0102549:	e8 dd db ff ff       	call   f010012b <_panic>
+f010254e:	68 73 b2 10 f0       	push   $0xf010b273
+f0102553:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102558:	68 c7 04 00 00       	push   $0x4c7
+f010255d:	68 29 b1 10 f0       	push   $0xf010b129
+f0102562:	e8 c4 db ff ff       	call   f010012b <_panic>
+f0102567:	68 89 b2 10 f0       	push   $0xf010b289
+f010256c:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102571:	68 ca 04 00 00       	push   $0x4ca
+f0102576:	68 29 b1 10 f0       	push   $0xf010b129
+f010257b:	e8 ab db ff ff       	call   f010012b <_panic>
+f0102580:	68 f0 a8 10 f0       	push   $0xf010a8f0
+f0102585:	68 6c b1 10 f0       	push   $0xf010b16c
+f010258a:	68 cb 04 00 00       	push   $0x4cb
+f010258f:	68 29 b1 10 f0       	push   $0xf010b129
+f0102594:	e8 92 db ff ff       	call   f010012b <_panic>
+f0102599:	68 9b b2 10 f0       	push   $0xf010b29b
+f010259e:	68 6c b1 10 f0       	push   $0xf010b16c
+f01025a3:	68 cc 04 00 00       	push   $0x4cc
+f01025a8:	68 29 b1 10 f0       	push   $0xf010b129
+f01025ad:	e8 79 db ff ff       	call   f010012b <_panic>
+f01025b2:	68 b8 b2 10 f0       	push   $0xf010b2b8
+f01025b7:	68 6c b1 10 f0       	push   $0xf010b16c
+f01025bc:	68 cd 04 00 00       	push   $0x4cd
+f01025c1:	68 29 b1 10 f0       	push   $0xf010b129
+f01025c6:	e8 60 db ff ff       	call   f010012b <_panic>
+f01025cb:	68 d5 b2 10 f0       	push   $0xf010b2d5
+f01025d0:	68 6c b1 10 f0       	push   $0xf010b16c
+f01025d5:	68 ce 04 00 00       	push   $0x4ce
+f01025da:	68 29 b1 10 f0       	push   $0xf010b129
+f01025df:	e8 47 db ff ff       	call   f010012b <_panic>
+f01025e4:	68 f2 b2 10 f0       	push   $0xf010b2f2
+f01025e9:	68 6c b1 10 f0       	push   $0xf010b16c
+f01025ee:	68 d5 04 00 00       	push   $0x4d5
+f01025f3:	68 29 b1 10 f0       	push   $0xf010b129
+f01025f8:	e8 2e db ff ff       	call   f010012b <_panic>
+f01025fd:	68 47 b2 10 f0       	push   $0xf010b247
+f0102602:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102607:	68 dc 04 00 00       	push   $0x4dc
+f010260c:	68 29 b1 10 f0       	push   $0xf010b129
+f0102611:	e8 15 db ff ff       	call   f010012b <_panic>
+f0102616:	68 5d b2 10 f0       	push   $0xf010b25d
+f010261b:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102620:	68 dd 04 00 00       	push   $0x4dd
+f0102625:	68 29 b1 10 f0       	push   $0xf010b129
+f010262a:	e8 fc da ff ff       	call   f010012b <_panic>
+f010262f:	68 73 b2 10 f0       	push   $0xf010b273
+f0102634:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102639:	68 de 04 00 00       	push   $0x4de
+f010263e:	68 29 b1 10 f0       	push   $0xf010b129
+f0102643:	e8 e3 da ff ff       	call   f010012b <_panic>
+f0102648:	68 89 b2 10 f0       	push   $0xf010b289
+f010264d:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102652:	68 e0 04 00 00       	push   $0x4e0
+f0102657:	68 29 b1 10 f0       	push   $0xf010b129
+f010265c:	e8 ca da ff ff       	call   f010012b <_panic>
+f0102661:	68 f0 a8 10 f0       	push   $0xf010a8f0
+f0102666:	68 6c b1 10 f0       	push   $0xf010b16c
+f010266b:	68 e1 04 00 00       	push   $0x4e1
+f0102670:	68 29 b1 10 f0       	push   $0xf010b129
+f0102675:	e8 b1 da ff ff       	call   f010012b <_panic>
+f010267a:	68 f2 b2 10 f0       	push   $0xf010b2f2
+f010267f:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102684:	68 e2 04 00 00       	push   $0x4e2
+f0102689:	68 29 b1 10 f0       	push   $0xf010b129
+f010268e:	e8 98 da ff ff       	call   f010012b <_panic>
+f0102693:	52                   	push   %edx
+f0102694:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0102699:	6a 71                	push   $0x71
+f010269b:	68 52 b1 10 f0       	push   $0xf010b152
+f01026a0:	e8 86 da ff ff       	call   f010012b <_panic>
+f01026a5:	68 01 b3 10 f0       	push   $0xf010b301
+f01026aa:	68 6c b1 10 f0       	push   $0xf010b16c
+f01026af:	68 e7 04 00 00       	push   $0x4e7
+f01026b4:	68 29 b1 10 f0       	push   $0xf010b129
+f01026b9:	e8 6d da ff ff       	call   f010012b <_panic>
+f01026be:	68 1f b3 10 f0       	push   $0xf010b31f
+f01026c3:	68 6c b1 10 f0       	push   $0xf010b16c
+f01026c8:	68 e8 04 00 00       	push   $0x4e8
+f01026cd:	68 29 b1 10 f0       	push   $0xf010b129
+f01026d2:	e8 54 da ff ff       	call   f010012b <_panic>
+f01026d7:	51                   	push   %ecx
+f01026d8:	68 e4 9d 10 f0       	push   $0xf0109de4
+f01026dd:	6a 71                	push   $0x71
+f01026df:	68 52 b1 10 f0       	push   $0xf010b152
+f01026e4:	e8 42 da ff ff       	call   f010012b <_panic>
+f01026e9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01026ec:	a3 34 37 1a f0       	mov    %eax,0xf01a3734
+f01026f1:	83 ec 0c             	sub    $0xc,%esp
+f01026f4:	56                   	push   %esi
+f01026f5:	e8 40 f2 ff ff       	call   f010193a <page_free>
+f01026fa:	83 c4 04             	add    $0x4,%esp
+f01026fd:	ff 75 d4             	push   -0x2c(%ebp)
+f0102700:	e8 35 f2 ff ff       	call   f010193a <page_free>
+f0102705:	89 3c 24             	mov    %edi,(%esp)
+f0102708:	e8 2d f2 ff ff       	call   f010193a <page_free>
+f010270d:	a1 34 37 1a f0       	mov    0xf01a3734,%eax
+f0102712:	83 c4 10             	add    $0x10,%esp
+f0102715:	85 c0                	test   %eax,%eax
+f0102717:	74 07                	je     f0102720 <mem_init+0x5c5>
+f0102719:	83 eb 01             	sub    $0x1,%ebx
+f010271c:	8b 00                	mov    (%eax),%eax
+f010271e:	eb f5                	jmp    f0102715 <mem_init+0x5ba>
+f0102720:	85 db                	test   %ebx,%ebx
+f0102722:	0f 85 7e 06 00 00    	jne    f0102da6 <mem_init+0xc4b>
+f0102728:	83 ec 0c             	sub    $0xc,%esp
+f010272b:	68 10 a9 10 f0       	push   $0xf010a910
+f0102730:	e8 ee 28 00 00       	call   f0105023 <cprintf>
+f0102735:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f010273c:	e8 25 f6 ff ff       	call   f0101d66 <page_alloc>
+f0102741:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102744:	83 c4 10             	add    $0x10,%esp
+f0102747:	85 c0                	test   %eax,%eax
+f0102749:	0f 84 70 06 00 00    	je     f0102dbf <mem_init+0xc64>
+f010274f:	83 ec 0c             	sub    $0xc,%esp
+f0102752:	6a 00                	push   $0x0
+f0102754:	e8 0d f6 ff ff       	call   f0101d66 <page_alloc>
+f0102759:	89 c7                	mov    %eax,%edi
+f010275b:	83 c4 10             	add    $0x10,%esp
+f010275e:	85 c0                	test   %eax,%eax
+f0102760:	0f 84 72 06 00 00    	je     f0102dd8 <mem_init+0xc7d>
+f0102766:	83 ec 0c             	sub    $0xc,%esp
+f0102769:	6a 00                	push   $0x0
+f010276b:	e8 f6 f5 ff ff       	call   f0101d66 <page_alloc>
+f0102770:	89 c3                	mov    %eax,%ebx
+f0102772:	83 c4 10             	add    $0x10,%esp
+f0102775:	85 c0                	test   %eax,%eax
+f0102777:	0f 84 74 06 00 00    	je     f0102df1 <mem_init+0xc96>
+f010277d:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0102780:	0f 84 84 06 00 00    	je     f0102e0a <mem_init+0xcaf>
+f0102786:	39 c7                	cmp    %eax,%edi
+f0102788:	0f 84 95 06 00 00    	je     f0102e23 <mem_init+0xcc8>
+f010278e:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f0102791:	0f 84 8c 06 00 00    	je     f0102e23 <mem_init+0xcc8>
+f0102797:	a1 34 37 1a f0       	mov    0xf01a3734,%eax
+f010279c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f010279f:	c7 05 34 37 1a f0 00 	movl   $0x0,0xf01a3734
+f01027a6:	00 00 00 
+f01027a9:	83 ec 0c             	sub    $0xc,%esp
+f01027ac:	6a 00                	push   $0x0
+f01027ae:	e8 b3 f5 ff ff       	call   f0101d66 <page_alloc>
+f01027b3:	83 c4 10             	add    $0x10,%esp
+f01027b6:	85 c0                	test   %eax,%eax
+f01027b8:	0f 85 7e 06 00 00    	jne    f0102e3c <mem_init+0xce1>
+f01027be:	83 ec 04             	sub    $0x4,%esp
+f01027c1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01027c4:	50                   	push   %eax
+f01027c5:	6a 00                	push   $0x0
+f01027c7:	ff 35 14 37 1a f0    	push   0xf01a3714
+f01027cd:	e8 6f f7 ff ff       	call   f0101f41 <page_lookup>
+f01027d2:	83 c4 10             	add    $0x10,%esp
+f01027d5:	85 c0                	test   %eax,%eax
+f01027d7:	0f 85 78 06 00 00    	jne    f0102e55 <mem_init+0xcfa>
+f01027dd:	6a 02                	push   $0x2
+f01027df:	6a 00                	push   $0x0
+f01027e1:	57                   	push   %edi
+f01027e2:	ff 35 14 37 1a f0    	push   0xf01a3714
+f01027e8:	e8 fb f8 ff ff       	call   f01020e8 <page_insert>
+f01027ed:	83 c4 10             	add    $0x10,%esp
+f01027f0:	85 c0                	test   %eax,%eax
+f01027f2:	0f 89 76 06 00 00    	jns    f0102e6e <mem_init+0xd13>
+f01027f8:	83 ec 0c             	sub    $0xc,%esp
+f01027fb:	ff 75 d4             	push   -0x2c(%ebp)
+f01027fe:	e8 37 f1 ff ff       	call   f010193a <page_free>
+f0102803:	6a 02                	push   $0x2
+f0102805:	6a 00                	push   $0x0
+f0102807:	57                   	push   %edi
+f0102808:	ff 35 14 37 1a f0    	push   0xf01a3714
+f010280e:	e8 d5 f8 ff ff       	call   f01020e8 <page_insert>
+f0102813:	83 c4 20             	add    $0x20,%esp
+f0102816:	85 c0                	test   %eax,%eax
+f0102818:	0f 85 69 06 00 00    	jne    f0102e87 <mem_init+0xd2c>
+f010281e:	8b 35 14 37 1a f0    	mov    0xf01a3714,%esi
+f0102824:	8b 0d 10 37 1a f0    	mov    0xf01a3710,%ecx
+f010282a:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f010282d:	8b 16                	mov    (%esi),%edx
+f010282f:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0102835:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102838:	29 c8                	sub    %ecx,%eax
+f010283a:	c1 f8 03             	sar    $0x3,%eax
+f010283d:	c1 e0 0c             	shl    $0xc,%eax
+f0102840:	39 c2                	cmp    %eax,%edx
+f0102842:	0f 85 58 06 00 00    	jne    f0102ea0 <mem_init+0xd45>
+f0102848:	ba 00 00 00 00       	mov    $0x0,%edx
+f010284d:	89 f0                	mov    %esi,%eax
+f010284f:	e8 8e eb ff ff       	call   f01013e2 <check_va2pa>
+f0102854:	89 c2                	mov    %eax,%edx
+f0102856:	89 f8                	mov    %edi,%eax
+f0102858:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f010285b:	29 c8                	sub    %ecx,%eax
+f010285d:	c1 f8 03             	sar    $0x3,%eax
+f0102860:	c1 e0 0c             	shl    $0xc,%eax
+f0102863:	39 c2                	cmp    %eax,%edx
+f0102865:	0f 85 4e 06 00 00    	jne    f0102eb9 <mem_init+0xd5e>
+f010286b:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0102870:	0f 85 5c 06 00 00    	jne    f0102ed2 <mem_init+0xd77>
+f0102876:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102879:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f010287e:	0f 85 67 06 00 00    	jne    f0102eeb <mem_init+0xd90>
+f0102884:	6a 02                	push   $0x2
+f0102886:	68 00 10 00 00       	push   $0x1000
+f010288b:	53                   	push   %ebx
+f010288c:	56                   	push   %esi
+f010288d:	e8 56 f8 ff ff       	call   f01020e8 <page_insert>
+f0102892:	83 c4 10             	add    $0x10,%esp
+f0102895:	85 c0                	test   %eax,%eax
+f0102897:	0f 85 67 06 00 00    	jne    f0102f04 <mem_init+0xda9>
+f010289d:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01028a2:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f01028a7:	e8 36 eb ff ff       	call   f01013e2 <check_va2pa>
+f01028ac:	89 c2                	mov    %eax,%edx
+f01028ae:	89 d8                	mov    %ebx,%eax
+f01028b0:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f01028b6:	c1 f8 03             	sar    $0x3,%eax
+f01028b9:	c1 e0 0c             	shl    $0xc,%eax
+f01028bc:	39 c2                	cmp    %eax,%edx
+f01028be:	0f 85 59 06 00 00    	jne    f0102f1d <mem_init+0xdc2>
+f01028c4:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01028c9:	0f 85 67 06 00 00    	jne    f0102f36 <mem_init+0xddb>
+f01028cf:	83 ec 0c             	sub    $0xc,%esp
+f01028d2:	6a 00                	push   $0x0
+f01028d4:	e8 8d f4 ff ff       	call   f0101d66 <page_alloc>
+f01028d9:	83 c4 10             	add    $0x10,%esp
+f01028dc:	85 c0                	test   %eax,%eax
+f01028de:	0f 85 6b 06 00 00    	jne    f0102f4f <mem_init+0xdf4>
+f01028e4:	6a 02                	push   $0x2
+f01028e6:	68 00 10 00 00       	push   $0x1000
+f01028eb:	53                   	push   %ebx
+f01028ec:	ff 35 14 37 1a f0    	push   0xf01a3714
+f01028f2:	e8 f1 f7 ff ff       	call   f01020e8 <page_insert>
+f01028f7:	83 c4 10             	add    $0x10,%esp
+f01028fa:	85 c0                	test   %eax,%eax
+f01028fc:	0f 85 66 06 00 00    	jne    f0102f68 <mem_init+0xe0d>
+f0102902:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102907:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f010290c:	e8 d1 ea ff ff       	call   f01013e2 <check_va2pa>
+f0102911:	89 c2                	mov    %eax,%edx
+f0102913:	89 d8                	mov    %ebx,%eax
+f0102915:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f010291b:	c1 f8 03             	sar    $0x3,%eax
+f010291e:	c1 e0 0c             	shl    $0xc,%eax
+f0102921:	39 c2                	cmp    %eax,%edx
+f0102923:	0f 85 58 06 00 00    	jne    f0102f81 <mem_init+0xe26>
+f0102929:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f010292e:	0f 85 66 06 00 00    	jne    f0102f9a <mem_init+0xe3f>
+f0102934:	83 ec 0c             	sub    $0xc,%esp
+f0102937:	6a 00                	push   $0x0
+f0102939:	e8 28 f4 ff ff       	call   f0101d66 <page_alloc>
+f010293e:	83 c4 10             	add    $0x10,%esp
+f0102941:	85 c0                	test   %eax,%eax
+f0102943:	0f 85 6a 06 00 00    	jne    f0102fb3 <mem_init+0xe58>
+f0102949:	8b 15 14 37 1a f0    	mov    0xf01a3714,%edx
+f010294f:	8b 02                	mov    (%edx),%eax
+f0102951:	89 c6                	mov    %eax,%esi
+f0102953:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f0102959:	c1 e8 0c             	shr    $0xc,%eax
+f010295c:	3b 05 18 37 1a f0    	cmp    0xf01a3718,%eax
+f0102962:	0f 83 64 06 00 00    	jae    f0102fcc <mem_init+0xe71>
+f0102968:	83 ec 04             	sub    $0x4,%esp
+f010296b:	6a 00                	push   $0x0
+f010296d:	68 00 10 00 00       	push   $0x1000
+f0102972:	52                   	push   %edx
+f0102973:	e8 55 f4 ff ff       	call   f0101dcd <pgdir_walk>
+f0102978:	81 ee fc ff ff 0f    	sub    $0xffffffc,%esi
+f010297e:	83 c4 10             	add    $0x10,%esp
+f0102981:	39 f0                	cmp    %esi,%eax
+f0102983:	0f 85 58 06 00 00    	jne    f0102fe1 <mem_init+0xe86>
+f0102989:	6a 06                	push   $0x6
+f010298b:	68 00 10 00 00       	push   $0x1000
+f0102990:	53                   	push   %ebx
+f0102991:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0102997:	e8 4c f7 ff ff       	call   f01020e8 <page_insert>
+f010299c:	83 c4 10             	add    $0x10,%esp
+f010299f:	85 c0                	test   %eax,%eax
+f01029a1:	0f 85 53 06 00 00    	jne    f0102ffa <mem_init+0xe9f>
+f01029a7:	8b 35 14 37 1a f0    	mov    0xf01a3714,%esi
+f01029ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01029b2:	89 f0                	mov    %esi,%eax
+f01029b4:	e8 29 ea ff ff       	call   f01013e2 <check_va2pa>
+f01029b9:	89 c2                	mov    %eax,%edx
+f01029bb:	89 d8                	mov    %ebx,%eax
+f01029bd:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f01029c3:	c1 f8 03             	sar    $0x3,%eax
+f01029c6:	c1 e0 0c             	shl    $0xc,%eax
+f01029c9:	39 c2                	cmp    %eax,%edx
+f01029cb:	0f 85 42 06 00 00    	jne    f0103013 <mem_init+0xeb8>
+f01029d1:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01029d6:	0f 85 50 06 00 00    	jne    f010302c <mem_init+0xed1>
+f01029dc:	83 ec 04             	sub    $0x4,%esp
+f01029df:	6a 00                	push   $0x0
+f01029e1:	68 00 10 00 00       	push   $0x1000
+f01029e6:	56                   	push   %esi
+f01029e7:	e8 e1 f3 ff ff       	call   f0101dcd <pgdir_walk>
+f01029ec:	83 c4 10             	add    $0x10,%esp
+f01029ef:	f6 00 04             	testb  $0x4,(%eax)
+f01029f2:	0f 84 4d 06 00 00    	je     f0103045 <mem_init+0xeea>
+f01029f8:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f01029fd:	f6 00 04             	testb  $0x4,(%eax)
+f0102a00:	0f 84 58 06 00 00    	je     f010305e <mem_init+0xf03>
+f0102a06:	6a 02                	push   $0x2
+f0102a08:	68 00 10 00 00       	push   $0x1000
+f0102a0d:	53                   	push   %ebx
+f0102a0e:	50                   	push   %eax
+f0102a0f:	e8 d4 f6 ff ff       	call   f01020e8 <page_insert>
+f0102a14:	83 c4 10             	add    $0x10,%esp
+f0102a17:	85 c0                	test   %eax,%eax
+f0102a19:	0f 85 58 06 00 00    	jne    f0103077 <mem_init+0xf1c>
+f0102a1f:	83 ec 04             	sub    $0x4,%esp
+f0102a22:	6a 00                	push   $0x0
+f0102a24:	68 00 10 00 00       	push   $0x1000
+f0102a29:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0102a2f:	e8 99 f3 ff ff       	call   f0101dcd <pgdir_walk>
+f0102a34:	83 c4 10             	add    $0x10,%esp
+f0102a37:	f6 00 02             	testb  $0x2,(%eax)
+f0102a3a:	0f 84 50 06 00 00    	je     f0103090 <mem_init+0xf35>
+f0102a40:	83 ec 04             	sub    $0x4,%esp
+f0102a43:	6a 00                	push   $0x0
+f0102a45:	68 00 10 00 00       	push   $0x1000
+f0102a4a:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0102a50:	e8 78 f3 ff ff       	call   f0101dcd <pgdir_walk>
+f0102a55:	83 c4 10             	add    $0x10,%esp
+f0102a58:	f6 00 04             	testb  $0x4,(%eax)
+f0102a5b:	0f 85 48 06 00 00    	jne    f01030a9 <mem_init+0xf4e>
+f0102a61:	6a 02                	push   $0x2
+f0102a63:	68 00 00 40 00       	push   $0x400000
+f0102a68:	ff 75 d4             	push   -0x2c(%ebp)
+f0102a6b:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0102a71:	e8 72 f6 ff ff       	call   f01020e8 <page_insert>
+f0102a76:	83 c4 10             	add    $0x10,%esp
+f0102a79:	85 c0                	test   %eax,%eax
+f0102a7b:	0f 89 41 06 00 00    	jns    f01030c2 <mem_init+0xf67>
+f0102a81:	6a 02                	push   $0x2
+f0102a83:	68 00 10 00 00       	push   $0x1000
+f0102a88:	57                   	push   %edi
+f0102a89:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0102a8f:	e8 54 f6 ff ff       	call   f01020e8 <page_insert>
+f0102a94:	83 c4 10             	add    $0x10,%esp
+f0102a97:	85 c0                	test   %eax,%eax
+f0102a99:	0f 85 3c 06 00 00    	jne    f01030db <mem_init+0xf80>
+f0102a9f:	83 ec 04             	sub    $0x4,%esp
+f0102aa2:	6a 00                	push   $0x0
+f0102aa4:	68 00 10 00 00       	push   $0x1000
+f0102aa9:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0102aaf:	e8 19 f3 ff ff       	call   f0101dcd <pgdir_walk>
+f0102ab4:	83 c4 10             	add    $0x10,%esp
+f0102ab7:	f6 00 04             	testb  $0x4,(%eax)
+f0102aba:	0f 85 34 06 00 00    	jne    f01030f4 <mem_init+0xf99>
+f0102ac0:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f0102ac5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0102ac8:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102acd:	e8 10 e9 ff ff       	call   f01013e2 <check_va2pa>
+f0102ad2:	89 fe                	mov    %edi,%esi
+f0102ad4:	2b 35 10 37 1a f0    	sub    0xf01a3710,%esi
+f0102ada:	c1 fe 03             	sar    $0x3,%esi
+f0102add:	c1 e6 0c             	shl    $0xc,%esi
+f0102ae0:	39 f0                	cmp    %esi,%eax
+f0102ae2:	0f 85 25 06 00 00    	jne    f010310d <mem_init+0xfb2>
+f0102ae8:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102aed:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0102af0:	e8 ed e8 ff ff       	call   f01013e2 <check_va2pa>
+f0102af5:	39 c6                	cmp    %eax,%esi
+f0102af7:	0f 85 29 06 00 00    	jne    f0103126 <mem_init+0xfcb>
+f0102afd:	66 83 7f 04 02       	cmpw   $0x2,0x4(%edi)
+f0102b02:	0f 85 37 06 00 00    	jne    f010313f <mem_init+0xfe4>
+f0102b08:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0102b0d:	0f 85 45 06 00 00    	jne    f0103158 <mem_init+0xffd>
+f0102b13:	83 ec 0c             	sub    $0xc,%esp
+f0102b16:	6a 00                	push   $0x0
+f0102b18:	e8 49 f2 ff ff       	call   f0101d66 <page_alloc>
+f0102b1d:	83 c4 10             	add    $0x10,%esp
+f0102b20:	39 c3                	cmp    %eax,%ebx
+f0102b22:	0f 85 49 06 00 00    	jne    f0103171 <mem_init+0x1016>
+f0102b28:	85 c0                	test   %eax,%eax
+f0102b2a:	0f 84 41 06 00 00    	je     f0103171 <mem_init+0x1016>
+f0102b30:	83 ec 08             	sub    $0x8,%esp
+f0102b33:	6a 00                	push   $0x0
+f0102b35:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0102b3b:	e8 c4 f4 ff ff       	call   f0102004 <page_remove>
+f0102b40:	8b 35 14 37 1a f0    	mov    0xf01a3714,%esi
+f0102b46:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102b4b:	89 f0                	mov    %esi,%eax
+f0102b4d:	e8 90 e8 ff ff       	call   f01013e2 <check_va2pa>
+f0102b52:	83 c4 10             	add    $0x10,%esp
+f0102b55:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102b58:	0f 85 2c 06 00 00    	jne    f010318a <mem_init+0x102f>
+f0102b5e:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102b63:	89 f0                	mov    %esi,%eax
+f0102b65:	e8 78 e8 ff ff       	call   f01013e2 <check_va2pa>
+f0102b6a:	89 c2                	mov    %eax,%edx
+f0102b6c:	89 f8                	mov    %edi,%eax
+f0102b6e:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f0102b74:	c1 f8 03             	sar    $0x3,%eax
+f0102b77:	c1 e0 0c             	shl    $0xc,%eax
+f0102b7a:	39 c2                	cmp    %eax,%edx
+f0102b7c:	0f 85 21 06 00 00    	jne    f01031a3 <mem_init+0x1048>
+f0102b82:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0102b87:	0f 85 2f 06 00 00    	jne    f01031bc <mem_init+0x1061>
+f0102b8d:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0102b92:	0f 85 3d 06 00 00    	jne    f01031d5 <mem_init+0x107a>
+f0102b98:	6a 00                	push   $0x0
+f0102b9a:	68 00 10 00 00       	push   $0x1000
+f0102b9f:	57                   	push   %edi
+f0102ba0:	56                   	push   %esi
+f0102ba1:	e8 42 f5 ff ff       	call   f01020e8 <page_insert>
+f0102ba6:	83 c4 10             	add    $0x10,%esp
+f0102ba9:	85 c0                	test   %eax,%eax
+f0102bab:	0f 85 3d 06 00 00    	jne    f01031ee <mem_init+0x1093>
+f0102bb1:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f0102bb6:	0f 84 4b 06 00 00    	je     f0103207 <mem_init+0x10ac>
+f0102bbc:	83 3f 00             	cmpl   $0x0,(%edi)
+f0102bbf:	0f 85 5b 06 00 00    	jne    f0103220 <mem_init+0x10c5>
+f0102bc5:	83 ec 08             	sub    $0x8,%esp
+f0102bc8:	68 00 10 00 00       	push   $0x1000
+f0102bcd:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0102bd3:	e8 2c f4 ff ff       	call   f0102004 <page_remove>
+f0102bd8:	8b 35 14 37 1a f0    	mov    0xf01a3714,%esi
+f0102bde:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102be3:	89 f0                	mov    %esi,%eax
+f0102be5:	e8 f8 e7 ff ff       	call   f01013e2 <check_va2pa>
+f0102bea:	83 c4 10             	add    $0x10,%esp
+f0102bed:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102bf0:	0f 85 43 06 00 00    	jne    f0103239 <mem_init+0x10de>
+f0102bf6:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102bfb:	89 f0                	mov    %esi,%eax
+f0102bfd:	e8 e0 e7 ff ff       	call   f01013e2 <check_va2pa>
+f0102c02:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102c05:	0f 85 47 06 00 00    	jne    f0103252 <mem_init+0x10f7>
+f0102c0b:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f0102c10:	0f 85 55 06 00 00    	jne    f010326b <mem_init+0x1110>
+f0102c16:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0102c1b:	0f 85 63 06 00 00    	jne    f0103284 <mem_init+0x1129>
+f0102c21:	83 ec 0c             	sub    $0xc,%esp
+f0102c24:	6a 00                	push   $0x0
+f0102c26:	e8 3b f1 ff ff       	call   f0101d66 <page_alloc>
+f0102c2b:	83 c4 10             	add    $0x10,%esp
+f0102c2e:	85 c0                	test   %eax,%eax
+f0102c30:	0f 84 67 06 00 00    	je     f010329d <mem_init+0x1142>
+f0102c36:	39 c7                	cmp    %eax,%edi
+f0102c38:	0f 85 5f 06 00 00    	jne    f010329d <mem_init+0x1142>
+f0102c3e:	83 ec 0c             	sub    $0xc,%esp
+f0102c41:	6a 00                	push   $0x0
+f0102c43:	e8 1e f1 ff ff       	call   f0101d66 <page_alloc>
+f0102c48:	83 c4 10             	add    $0x10,%esp
+f0102c4b:	85 c0                	test   %eax,%eax
+f0102c4d:	0f 85 63 06 00 00    	jne    f01032b6 <mem_init+0x115b>
+f0102c53:	8b 0d 14 37 1a f0    	mov    0xf01a3714,%ecx
+f0102c59:	8b 11                	mov    (%ecx),%edx
+f0102c5b:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0102c61:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102c64:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f0102c6a:	c1 f8 03             	sar    $0x3,%eax
+f0102c6d:	c1 e0 0c             	shl    $0xc,%eax
+f0102c70:	39 c2                	cmp    %eax,%edx
+f0102c72:	0f 85 57 06 00 00    	jne    f01032cf <mem_init+0x1174>
+f0102c78:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+f0102c7e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102c81:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f0102c86:	0f 85 5c 06 00 00    	jne    f01032e8 <mem_init+0x118d>
+f0102c8c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102c8f:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+f0102c95:	83 ec 0c             	sub    $0xc,%esp
+f0102c98:	50                   	push   %eax
+f0102c99:	e8 9c ec ff ff       	call   f010193a <page_free>
+f0102c9e:	83 c4 0c             	add    $0xc,%esp
+f0102ca1:	6a 01                	push   $0x1
+f0102ca3:	68 00 10 40 00       	push   $0x401000
+f0102ca8:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0102cae:	e8 1a f1 ff ff       	call   f0101dcd <pgdir_walk>
+f0102cb3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0102cb6:	8b 0d 14 37 1a f0    	mov    0xf01a3714,%ecx
+f0102cbc:	8b 41 04             	mov    0x4(%ecx),%eax
+f0102cbf:	89 c6                	mov    %eax,%esi
+f0102cc1:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f0102cc7:	8b 15 18 37 1a f0    	mov    0xf01a3718,%edx
+f0102ccd:	c1 e8 0c             	shr    $0xc,%eax
+f0102cd0:	83 c4 10             	add    $0x10,%esp
+f0102cd3:	39 d0                	cmp    %edx,%eax
+f0102cd5:	0f 83 26 06 00 00    	jae    f0103301 <mem_init+0x11a6>
+f0102cdb:	81 ee fc ff ff 0f    	sub    $0xffffffc,%esi
+f0102ce1:	39 75 d0             	cmp    %esi,-0x30(%ebp)
+f0102ce4:	0f 85 2c 06 00 00    	jne    f0103316 <mem_init+0x11bb>
+f0102cea:	c7 41 04 00 00 00 00 	movl   $0x0,0x4(%ecx)
+f0102cf1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102cf4:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+f0102cfa:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f0102d00:	c1 f8 03             	sar    $0x3,%eax
+f0102d03:	89 c1                	mov    %eax,%ecx
+f0102d05:	c1 e1 0c             	shl    $0xc,%ecx
+f0102d08:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102d0d:	39 d0                	cmp    %edx,%eax
+f0102d0f:	0f 83 1a 06 00 00    	jae    f010332f <mem_init+0x11d4>
+f0102d15:	83 ec 04             	sub    $0x4,%esp
+f0102d18:	68 00 10 00 00       	push   $0x1000
+f0102d1d:	68 ff 00 00 00       	push   $0xff
+f0102d22:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0102d28:	51                   	push   %ecx
+f0102d29:	e8 5b 61 00 00       	call   f0108e89 <memset>
+f0102d2e:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f0102d31:	89 34 24             	mov    %esi,(%esp)
+f0102d34:	e8 01 ec ff ff       	call   f010193a <page_free>
+f0102d39:	83 c4 0c             	add    $0xc,%esp
+f0102d3c:	6a 01                	push   $0x1
+f0102d3e:	6a 00                	push   $0x0
+f0102d40:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0102d46:	e8 82 f0 ff ff       	call   f0101dcd <pgdir_walk>
+f0102d4b:	89 f0                	mov    %esi,%eax
+f0102d4d:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f0102d53:	c1 f8 03             	sar    $0x3,%eax
+f0102d56:	89 c1                	mov    %eax,%ecx
+f0102d58:	c1 e1 0c             	shl    $0xc,%ecx
+f0102d5b:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102d60:	83 c4 10             	add    $0x10,%esp
+f0102d63:	3b 05 18 37 1a f0    	cmp    0xf01a3718,%eax
+f0102d69:	0f 83 d2 05 00 00    	jae    f0103341 <mem_init+0x11e6>
+f0102d6f:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+f0102d75:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f0102d7b:	39 c8                	cmp    %ecx,%eax
+f0102d7d:	0f 84 d0 05 00 00    	je     f0103353 <mem_init+0x11f8>
+f0102d83:	8b 10                	mov    (%eax),%edx
+f0102d85:	83 c0 04             	add    $0x4,%eax
+f0102d88:	f6 c2 01             	test   $0x1,%dl
+f0102d8b:	74 ee                	je     f0102d7b <mem_init+0xc20>
+f0102d8d:	68 f9 b3 10 f0       	push   $0xf010b3f9
+f0102d92:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102d97:	68 15 06 00 00       	push   $0x615
+f0102d9c:	68 29 b1 10 f0       	push   $0xf010b129
+f0102da1:	e8 85 d3 ff ff       	call   f010012b <_panic>
+f0102da6:	68 39 b3 10 f0       	push   $0xf010b339
+f0102dab:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102db0:	68 f8 04 00 00       	push   $0x4f8
+f0102db5:	68 29 b1 10 f0       	push   $0xf010b129
+f0102dba:	e8 6c d3 ff ff       	call   f010012b <_panic>
+f0102dbf:	68 47 b2 10 f0       	push   $0xf010b247
+f0102dc4:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102dc9:	68 98 05 00 00       	push   $0x598
+f0102dce:	68 29 b1 10 f0       	push   $0xf010b129
+f0102dd3:	e8 53 d3 ff ff       	call   f010012b <_panic>
+f0102dd8:	68 5d b2 10 f0       	push   $0xf010b25d
+f0102ddd:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102de2:	68 99 05 00 00       	push   $0x599
+f0102de7:	68 29 b1 10 f0       	push   $0xf010b129
+f0102dec:	e8 3a d3 ff ff       	call   f010012b <_panic>
+f0102df1:	68 73 b2 10 f0       	push   $0xf010b273
+f0102df6:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102dfb:	68 9a 05 00 00       	push   $0x59a
+f0102e00:	68 29 b1 10 f0       	push   $0xf010b129
+f0102e05:	e8 21 d3 ff ff       	call   f010012b <_panic>
+f0102e0a:	68 89 b2 10 f0       	push   $0xf010b289
+f0102e0f:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102e14:	68 9d 05 00 00       	push   $0x59d
+f0102e19:	68 29 b1 10 f0       	push   $0xf010b129
+f0102e1e:	e8 08 d3 ff ff       	call   f010012b <_panic>
+f0102e23:	68 f0 a8 10 f0       	push   $0xf010a8f0
+f0102e28:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102e2d:	68 9e 05 00 00       	push   $0x59e
+f0102e32:	68 29 b1 10 f0       	push   $0xf010b129
+f0102e37:	e8 ef d2 ff ff       	call   f010012b <_panic>
+f0102e3c:	68 f2 b2 10 f0       	push   $0xf010b2f2
+f0102e41:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102e46:	68 a5 05 00 00       	push   $0x5a5
+f0102e4b:	68 29 b1 10 f0       	push   $0xf010b129
+f0102e50:	e8 d6 d2 ff ff       	call   f010012b <_panic>
+f0102e55:	68 30 a9 10 f0       	push   $0xf010a930
+f0102e5a:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102e5f:	68 a8 05 00 00       	push   $0x5a8
+f0102e64:	68 29 b1 10 f0       	push   $0xf010b129
+f0102e69:	e8 bd d2 ff ff       	call   f010012b <_panic>
+f0102e6e:	68 68 a9 10 f0       	push   $0xf010a968
+f0102e73:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102e78:	68 ab 05 00 00       	push   $0x5ab
+f0102e7d:	68 29 b1 10 f0       	push   $0xf010b129
+f0102e82:	e8 a4 d2 ff ff       	call   f010012b <_panic>
+f0102e87:	68 98 a9 10 f0       	push   $0xf010a998
+f0102e8c:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102e91:	68 af 05 00 00       	push   $0x5af
+f0102e96:	68 29 b1 10 f0       	push   $0xf010b129
+f0102e9b:	e8 8b d2 ff ff       	call   f010012b <_panic>
+f0102ea0:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0102ea5:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102eaa:	68 b0 05 00 00       	push   $0x5b0
+f0102eaf:	68 29 b1 10 f0       	push   $0xf010b129
+f0102eb4:	e8 72 d2 ff ff       	call   f010012b <_panic>
+f0102eb9:	68 f0 a9 10 f0       	push   $0xf010a9f0
+f0102ebe:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102ec3:	68 b1 05 00 00       	push   $0x5b1
+f0102ec8:	68 29 b1 10 f0       	push   $0xf010b129
+f0102ecd:	e8 59 d2 ff ff       	call   f010012b <_panic>
+f0102ed2:	68 44 b3 10 f0       	push   $0xf010b344
+f0102ed7:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102edc:	68 b2 05 00 00       	push   $0x5b2
+f0102ee1:	68 29 b1 10 f0       	push   $0xf010b129
+f0102ee6:	e8 40 d2 ff ff       	call   f010012b <_panic>
+f0102eeb:	68 55 b3 10 f0       	push   $0xf010b355
+f0102ef0:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102ef5:	68 b3 05 00 00       	push   $0x5b3
+f0102efa:	68 29 b1 10 f0       	push   $0xf010b129
+f0102eff:	e8 27 d2 ff ff       	call   f010012b <_panic>
+f0102f04:	68 20 aa 10 f0       	push   $0xf010aa20
+f0102f09:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102f0e:	68 b6 05 00 00       	push   $0x5b6
+f0102f13:	68 29 b1 10 f0       	push   $0xf010b129
+f0102f18:	e8 0e d2 ff ff       	call   f010012b <_panic>
+f0102f1d:	68 5c aa 10 f0       	push   $0xf010aa5c
+f0102f22:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102f27:	68 b7 05 00 00       	push   $0x5b7
+f0102f2c:	68 29 b1 10 f0       	push   $0xf010b129
+f0102f31:	e8 f5 d1 ff ff       	call   f010012b <_panic>
+f0102f36:	68 66 b3 10 f0       	push   $0xf010b366
+f0102f3b:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102f40:	68 b8 05 00 00       	push   $0x5b8
+f0102f45:	68 29 b1 10 f0       	push   $0xf010b129
+f0102f4a:	e8 dc d1 ff ff       	call   f010012b <_panic>
+f0102f4f:	68 f2 b2 10 f0       	push   $0xf010b2f2
+f0102f54:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102f59:	68 bb 05 00 00       	push   $0x5bb
+f0102f5e:	68 29 b1 10 f0       	push   $0xf010b129
+f0102f63:	e8 c3 d1 ff ff       	call   f010012b <_panic>
+f0102f68:	68 20 aa 10 f0       	push   $0xf010aa20
+f0102f6d:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102f72:	68 be 05 00 00       	push   $0x5be
+f0102f77:	68 29 b1 10 f0       	push   $0xf010b129
+f0102f7c:	e8 aa d1 ff ff       	call   f010012b <_panic>
+f0102f81:	68 5c aa 10 f0       	push   $0xf010aa5c
+f0102f86:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102f8b:	68 bf 05 00 00       	push   $0x5bf
+f0102f90:	68 29 b1 10 f0       	push   $0xf010b129
+f0102f95:	e8 91 d1 ff ff       	call   f010012b <_panic>
+f0102f9a:	68 66 b3 10 f0       	push   $0xf010b366
+f0102f9f:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102fa4:	68 c0 05 00 00       	push   $0x5c0
+f0102fa9:	68 29 b1 10 f0       	push   $0xf010b129
+f0102fae:	e8 78 d1 ff ff       	call   f010012b <_panic>
+f0102fb3:	68 f2 b2 10 f0       	push   $0xf010b2f2
+f0102fb8:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102fbd:	68 c4 05 00 00       	push   $0x5c4
+f0102fc2:	68 29 b1 10 f0       	push   $0xf010b129
+f0102fc7:	e8 5f d1 ff ff       	call   f010012b <_panic>
+f0102fcc:	56                   	push   %esi
+f0102fcd:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0102fd2:	68 c7 05 00 00       	push   $0x5c7
+f0102fd7:	68 29 b1 10 f0       	push   $0xf010b129
+f0102fdc:	e8 4a d1 ff ff       	call   f010012b <_panic>
+f0102fe1:	68 8c aa 10 f0       	push   $0xf010aa8c
+f0102fe6:	68 6c b1 10 f0       	push   $0xf010b16c
+f0102feb:	68 c8 05 00 00       	push   $0x5c8
+f0102ff0:	68 29 b1 10 f0       	push   $0xf010b129
+f0102ff5:	e8 31 d1 ff ff       	call   f010012b <_panic>
+f0102ffa:	68 cc aa 10 f0       	push   $0xf010aacc
+f0102fff:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103004:	68 cb 05 00 00       	push   $0x5cb
+f0103009:	68 29 b1 10 f0       	push   $0xf010b129
+f010300e:	e8 18 d1 ff ff       	call   f010012b <_panic>
+f0103013:	68 5c aa 10 f0       	push   $0xf010aa5c
+f0103018:	68 6c b1 10 f0       	push   $0xf010b16c
+f010301d:	68 cc 05 00 00       	push   $0x5cc
+f0103022:	68 29 b1 10 f0       	push   $0xf010b129
+f0103027:	e8 ff d0 ff ff       	call   f010012b <_panic>
+f010302c:	68 66 b3 10 f0       	push   $0xf010b366
+f0103031:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103036:	68 cd 05 00 00       	push   $0x5cd
+f010303b:	68 29 b1 10 f0       	push   $0xf010b129
+f0103040:	e8 e6 d0 ff ff       	call   f010012b <_panic>
+f0103045:	68 0c ab 10 f0       	push   $0xf010ab0c
+f010304a:	68 6c b1 10 f0       	push   $0xf010b16c
+f010304f:	68 ce 05 00 00       	push   $0x5ce
+f0103054:	68 29 b1 10 f0       	push   $0xf010b129
+f0103059:	e8 cd d0 ff ff       	call   f010012b <_panic>
+f010305e:	68 77 b3 10 f0       	push   $0xf010b377
+f0103063:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103068:	68 cf 05 00 00       	push   $0x5cf
+f010306d:	68 29 b1 10 f0       	push   $0xf010b129
+f0103072:	e8 b4 d0 ff ff       	call   f010012b <_panic>
+f0103077:	68 20 aa 10 f0       	push   $0xf010aa20
+f010307c:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103081:	68 d2 05 00 00       	push   $0x5d2
+f0103086:	68 29 b1 10 f0       	push   $0xf010b129
+f010308b:	e8 9b d0 ff ff       	call   f010012b <_panic>
+f0103090:	68 40 ab 10 f0       	push   $0xf010ab40
+f0103095:	68 6c b1 10 f0       	push   $0xf010b16c
+f010309a:	68 d3 05 00 00       	push   $0x5d3
+f010309f:	68 29 b1 10 f0       	push   $0xf010b129
+f01030a4:	e8 82 d0 ff ff       	call   f010012b <_panic>
+f01030a9:	68 74 ab 10 f0       	push   $0xf010ab74
+f01030ae:	68 6c b1 10 f0       	push   $0xf010b16c
+f01030b3:	68 d4 05 00 00       	push   $0x5d4
+f01030b8:	68 29 b1 10 f0       	push   $0xf010b129
+f01030bd:	e8 69 d0 ff ff       	call   f010012b <_panic>
+f01030c2:	68 ac ab 10 f0       	push   $0xf010abac
+f01030c7:	68 6c b1 10 f0       	push   $0xf010b16c
+f01030cc:	68 d7 05 00 00       	push   $0x5d7
+f01030d1:	68 29 b1 10 f0       	push   $0xf010b129
+f01030d6:	e8 50 d0 ff ff       	call   f010012b <_panic>
+f01030db:	68 e4 ab 10 f0       	push   $0xf010abe4
+f01030e0:	68 6c b1 10 f0       	push   $0xf010b16c
+f01030e5:	68 da 05 00 00       	push   $0x5da
+f01030ea:	68 29 b1 10 f0       	push   $0xf010b129
+f01030ef:	e8 37 d0 ff ff       	call   f010012b <_panic>
+f01030f4:	68 74 ab 10 f0       	push   $0xf010ab74
+f01030f9:	68 6c b1 10 f0       	push   $0xf010b16c
+f01030fe:	68 db 05 00 00       	push   $0x5db
+f0103103:	68 29 b1 10 f0       	push   $0xf010b129
+f0103108:	e8 1e d0 ff ff       	call   f010012b <_panic>
+f010310d:	68 20 ac 10 f0       	push   $0xf010ac20
+f0103112:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103117:	68 de 05 00 00       	push   $0x5de
+f010311c:	68 29 b1 10 f0       	push   $0xf010b129
+f0103121:	e8 05 d0 ff ff       	call   f010012b <_panic>
+f0103126:	68 4c ac 10 f0       	push   $0xf010ac4c
+f010312b:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103130:	68 df 05 00 00       	push   $0x5df
+f0103135:	68 29 b1 10 f0       	push   $0xf010b129
+f010313a:	e8 ec cf ff ff       	call   f010012b <_panic>
+f010313f:	68 8d b3 10 f0       	push   $0xf010b38d
+f0103144:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103149:	68 e1 05 00 00       	push   $0x5e1
+f010314e:	68 29 b1 10 f0       	push   $0xf010b129
+f0103153:	e8 d3 cf ff ff       	call   f010012b <_panic>
+f0103158:	68 9e b3 10 f0       	push   $0xf010b39e
+f010315d:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103162:	68 e2 05 00 00       	push   $0x5e2
+f0103167:	68 29 b1 10 f0       	push   $0xf010b129
+f010316c:	e8 ba cf ff ff       	call   f010012b <_panic>
+f0103171:	68 7c ac 10 f0       	push   $0xf010ac7c
+f0103176:	68 6c b1 10 f0       	push   $0xf010b16c
+f010317b:	68 e5 05 00 00       	push   $0x5e5
+f0103180:	68 29 b1 10 f0       	push   $0xf010b129
+f0103185:	e8 a1 cf ff ff       	call   f010012b <_panic>
+f010318a:	68 a0 ac 10 f0       	push   $0xf010aca0
+f010318f:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103194:	68 e9 05 00 00       	push   $0x5e9
+f0103199:	68 29 b1 10 f0       	push   $0xf010b129
+f010319e:	e8 88 cf ff ff       	call   f010012b <_panic>
+f01031a3:	68 4c ac 10 f0       	push   $0xf010ac4c
+f01031a8:	68 6c b1 10 f0       	push   $0xf010b16c
+f01031ad:	68 ea 05 00 00       	push   $0x5ea
+f01031b2:	68 29 b1 10 f0       	push   $0xf010b129
+f01031b7:	e8 6f cf ff ff       	call   f010012b <_panic>
+f01031bc:	68 44 b3 10 f0       	push   $0xf010b344
+f01031c1:	68 6c b1 10 f0       	push   $0xf010b16c
+f01031c6:	68 eb 05 00 00       	push   $0x5eb
+f01031cb:	68 29 b1 10 f0       	push   $0xf010b129
+f01031d0:	e8 56 cf ff ff       	call   f010012b <_panic>
+f01031d5:	68 9e b3 10 f0       	push   $0xf010b39e
+f01031da:	68 6c b1 10 f0       	push   $0xf010b16c
+f01031df:	68 ec 05 00 00       	push   $0x5ec
+f01031e4:	68 29 b1 10 f0       	push   $0xf010b129
+f01031e9:	e8 3d cf ff ff       	call   f010012b <_panic>
+f01031ee:	68 c4 ac 10 f0       	push   $0xf010acc4
+f01031f3:	68 6c b1 10 f0       	push   $0xf010b16c
+f01031f8:	68 ef 05 00 00       	push   $0x5ef
+f01031fd:	68 29 b1 10 f0       	push   $0xf010b129
+f0103202:	e8 24 cf ff ff       	call   f010012b <_panic>
+f0103207:	68 af b3 10 f0       	push   $0xf010b3af
+f010320c:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103211:	68 f0 05 00 00       	push   $0x5f0
+f0103216:	68 29 b1 10 f0       	push   $0xf010b129
+f010321b:	e8 0b cf ff ff       	call   f010012b <_panic>
+f0103220:	68 bb b3 10 f0       	push   $0xf010b3bb
+f0103225:	68 6c b1 10 f0       	push   $0xf010b16c
+f010322a:	68 f1 05 00 00       	push   $0x5f1
+f010322f:	68 29 b1 10 f0       	push   $0xf010b129
+f0103234:	e8 f2 ce ff ff       	call   f010012b <_panic>
+f0103239:	68 a0 ac 10 f0       	push   $0xf010aca0
+f010323e:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103243:	68 f5 05 00 00       	push   $0x5f5
+f0103248:	68 29 b1 10 f0       	push   $0xf010b129
+f010324d:	e8 d9 ce ff ff       	call   f010012b <_panic>
+f0103252:	68 fc ac 10 f0       	push   $0xf010acfc
+f0103257:	68 6c b1 10 f0       	push   $0xf010b16c
+f010325c:	68 f6 05 00 00       	push   $0x5f6
+f0103261:	68 29 b1 10 f0       	push   $0xf010b129
+f0103266:	e8 c0 ce ff ff       	call   f010012b <_panic>
+f010326b:	68 d0 b3 10 f0       	push   $0xf010b3d0
+f0103270:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103275:	68 f7 05 00 00       	push   $0x5f7
+f010327a:	68 29 b1 10 f0       	push   $0xf010b129
+f010327f:	e8 a7 ce ff ff       	call   f010012b <_panic>
+f0103284:	68 9e b3 10 f0       	push   $0xf010b39e
+f0103289:	68 6c b1 10 f0       	push   $0xf010b16c
+f010328e:	68 f8 05 00 00       	push   $0x5f8
+f0103293:	68 29 b1 10 f0       	push   $0xf010b129
+f0103298:	e8 8e ce ff ff       	call   f010012b <_panic>
+f010329d:	68 24 ad 10 f0       	push   $0xf010ad24
+f01032a2:	68 6c b1 10 f0       	push   $0xf010b16c
+f01032a7:	68 fb 05 00 00       	push   $0x5fb
+f01032ac:	68 29 b1 10 f0       	push   $0xf010b129
+f01032b1:	e8 75 ce ff ff       	call   f010012b <_panic>
+f01032b6:	68 f2 b2 10 f0       	push   $0xf010b2f2
+f01032bb:	68 6c b1 10 f0       	push   $0xf010b16c
+f01032c0:	68 fe 05 00 00       	push   $0x5fe
+f01032c5:	68 29 b1 10 f0       	push   $0xf010b129
+f01032ca:	e8 5c ce ff ff       	call   f010012b <_panic>
+f01032cf:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f01032d4:	68 6c b1 10 f0       	push   $0xf010b16c
+f01032d9:	68 01 06 00 00       	push   $0x601
+f01032de:	68 29 b1 10 f0       	push   $0xf010b129
+f01032e3:	e8 43 ce ff ff       	call   f010012b <_panic>
+f01032e8:	68 55 b3 10 f0       	push   $0xf010b355
+f01032ed:	68 6c b1 10 f0       	push   $0xf010b16c
+f01032f2:	68 03 06 00 00       	push   $0x603
+f01032f7:	68 29 b1 10 f0       	push   $0xf010b129
+f01032fc:	e8 2a ce ff ff       	call   f010012b <_panic>
+f0103301:	56                   	push   %esi
+f0103302:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0103307:	68 0a 06 00 00       	push   $0x60a
+f010330c:	68 29 b1 10 f0       	push   $0xf010b129
+f0103311:	e8 15 ce ff ff       	call   f010012b <_panic>
+f0103316:	68 e1 b3 10 f0       	push   $0xf010b3e1
+f010331b:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103320:	68 0b 06 00 00       	push   $0x60b
+f0103325:	68 29 b1 10 f0       	push   $0xf010b129
+f010332a:	e8 fc cd ff ff       	call   f010012b <_panic>
+f010332f:	51                   	push   %ecx
+f0103330:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0103335:	6a 71                	push   $0x71
+f0103337:	68 52 b1 10 f0       	push   $0xf010b152
+f010333c:	e8 ea cd ff ff       	call   f010012b <_panic>
+f0103341:	51                   	push   %ecx
+f0103342:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0103347:	6a 71                	push   $0x71
+f0103349:	68 52 b1 10 f0       	push   $0xf010b152
+f010334e:	e8 d8 cd ff ff       	call   f010012b <_panic>
+f0103353:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f0103358:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f010335e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103361:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+f0103367:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f010336a:	89 0d 34 37 1a f0    	mov    %ecx,0xf01a3734
+f0103370:	83 ec 0c             	sub    $0xc,%esp
+f0103373:	50                   	push   %eax
+f0103374:	e8 c1 e5 ff ff       	call   f010193a <page_free>
+f0103379:	89 3c 24             	mov    %edi,(%esp)
+f010337c:	e8 b9 e5 ff ff       	call   f010193a <page_free>
+f0103381:	89 1c 24             	mov    %ebx,(%esp)
+f0103384:	e8 b1 e5 ff ff       	call   f010193a <page_free>
+f0103389:	83 c4 08             	add    $0x8,%esp
+f010338c:	68 01 10 00 00       	push   $0x1001
+f0103391:	6a 00                	push   $0x0
+f0103393:	e8 2e eb ff ff       	call   f0101ec6 <mmio_map_region>
+f0103398:	89 c6                	mov    %eax,%esi
+f010339a:	83 c4 08             	add    $0x8,%esp
+f010339d:	68 00 10 00 00       	push   $0x1000
+f01033a2:	6a 00                	push   $0x0
+f01033a4:	e8 1d eb ff ff       	call   f0101ec6 <mmio_map_region>
+f01033a9:	89 c7                	mov    %eax,%edi
+f01033ab:	8d 86 00 20 00 00    	lea    0x2000(%esi),%eax
+f01033b1:	83 c4 10             	add    $0x10,%esp
+f01033b4:	81 fe ff ff 7f ef    	cmp    $0xef7fffff,%esi
+f01033ba:	0f 86 45 02 00 00    	jbe    f0103605 <mem_init+0x14aa>
+f01033c0:	3d ff ff bf ef       	cmp    $0xefbfffff,%eax
+f01033c5:	0f 87 3a 02 00 00    	ja     f0103605 <mem_init+0x14aa>
+f01033cb:	8d 97 00 20 00 00    	lea    0x2000(%edi),%edx
+f01033d1:	81 fa ff ff bf ef    	cmp    $0xefbfffff,%edx
+f01033d7:	0f 87 41 02 00 00    	ja     f010361e <mem_init+0x14c3>
+f01033dd:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f01033e3:	0f 86 35 02 00 00    	jbe    f010361e <mem_init+0x14c3>
+f01033e9:	89 f2                	mov    %esi,%edx
+f01033eb:	09 fa                	or     %edi,%edx
+f01033ed:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f01033f3:	0f 85 3e 02 00 00    	jne    f0103637 <mem_init+0x14dc>
+f01033f9:	39 c7                	cmp    %eax,%edi
+f01033fb:	0f 82 4f 02 00 00    	jb     f0103650 <mem_init+0x14f5>
+f0103401:	8b 1d 14 37 1a f0    	mov    0xf01a3714,%ebx
+f0103407:	89 f2                	mov    %esi,%edx
+f0103409:	89 d8                	mov    %ebx,%eax
+f010340b:	e8 d2 df ff ff       	call   f01013e2 <check_va2pa>
+f0103410:	85 c0                	test   %eax,%eax
+f0103412:	0f 85 51 02 00 00    	jne    f0103669 <mem_init+0x150e>
+f0103418:	8d 86 00 10 00 00    	lea    0x1000(%esi),%eax
+f010341e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0103421:	89 c2                	mov    %eax,%edx
+f0103423:	89 d8                	mov    %ebx,%eax
+f0103425:	e8 b8 df ff ff       	call   f01013e2 <check_va2pa>
+f010342a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f010342f:	0f 85 4d 02 00 00    	jne    f0103682 <mem_init+0x1527>
+f0103435:	89 fa                	mov    %edi,%edx
+f0103437:	89 d8                	mov    %ebx,%eax
+f0103439:	e8 a4 df ff ff       	call   f01013e2 <check_va2pa>
+f010343e:	85 c0                	test   %eax,%eax
+f0103440:	0f 85 55 02 00 00    	jne    f010369b <mem_init+0x1540>
+f0103446:	8d 97 00 10 00 00    	lea    0x1000(%edi),%edx
+f010344c:	89 d8                	mov    %ebx,%eax
+f010344e:	e8 8f df ff ff       	call   f01013e2 <check_va2pa>
+f0103453:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0103456:	0f 85 58 02 00 00    	jne    f01036b4 <mem_init+0x1559>
+f010345c:	83 ec 04             	sub    $0x4,%esp
+f010345f:	6a 00                	push   $0x0
+f0103461:	56                   	push   %esi
+f0103462:	53                   	push   %ebx
+f0103463:	e8 65 e9 ff ff       	call   f0101dcd <pgdir_walk>
+f0103468:	83 c4 10             	add    $0x10,%esp
+f010346b:	f6 00 1a             	testb  $0x1a,(%eax)
+f010346e:	0f 84 59 02 00 00    	je     f01036cd <mem_init+0x1572>
+f0103474:	83 ec 04             	sub    $0x4,%esp
+f0103477:	6a 00                	push   $0x0
+f0103479:	56                   	push   %esi
+f010347a:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0103480:	e8 48 e9 ff ff       	call   f0101dcd <pgdir_walk>
+f0103485:	8b 00                	mov    (%eax),%eax
+f0103487:	83 c4 10             	add    $0x10,%esp
+f010348a:	83 e0 04             	and    $0x4,%eax
+f010348d:	89 45 b8             	mov    %eax,-0x48(%ebp)
+f0103490:	0f 85 50 02 00 00    	jne    f01036e6 <mem_init+0x158b>
+f0103496:	83 ec 04             	sub    $0x4,%esp
+f0103499:	6a 00                	push   $0x0
+f010349b:	56                   	push   %esi
+f010349c:	ff 35 14 37 1a f0    	push   0xf01a3714
+f01034a2:	e8 26 e9 ff ff       	call   f0101dcd <pgdir_walk>
+f01034a7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f01034ad:	83 c4 0c             	add    $0xc,%esp
+f01034b0:	6a 00                	push   $0x0
+f01034b2:	ff 75 d4             	push   -0x2c(%ebp)
+f01034b5:	ff 35 14 37 1a f0    	push   0xf01a3714
+f01034bb:	e8 0d e9 ff ff       	call   f0101dcd <pgdir_walk>
+f01034c0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f01034c6:	83 c4 0c             	add    $0xc,%esp
+f01034c9:	6a 00                	push   $0x0
+f01034cb:	57                   	push   %edi
+f01034cc:	ff 35 14 37 1a f0    	push   0xf01a3714
+f01034d2:	e8 f6 e8 ff ff       	call   f0101dcd <pgdir_walk>
+f01034d7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f01034dd:	c7 04 24 22 b4 10 f0 	movl   $0xf010b422,(%esp)
+f01034e4:	e8 3a 1b 00 00       	call   f0105023 <cprintf>
+f01034e9:	83 c4 0c             	add    $0xc,%esp
+f01034ec:	6a 01                	push   $0x1
+f01034ee:	68 00 00 bc ef       	push   $0xefbc0000
+f01034f3:	ff 35 14 37 1a f0    	push   0xf01a3714
+f01034f9:	e8 cf e8 ff ff       	call   f0101dcd <pgdir_walk>
+f01034fe:	a3 2c 37 1a f0       	mov    %eax,0xf01a372c
+f0103503:	83 c4 10             	add    $0x10,%esp
+f0103506:	85 c0                	test   %eax,%eax
+f0103508:	0f 84 f1 01 00 00    	je     f01036ff <mem_init+0x15a4>
+f010350e:	a1 1c 37 1a f0       	mov    0xf01a371c,%eax
+f0103513:	8d 0c c5 ff 0f 00 00 	lea    0xfff(,%eax,8),%ecx
+f010351a:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+f0103520:	a1 10 37 1a f0       	mov    0xf01a3710,%eax
+f0103525:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010352a:	0f 86 e8 01 00 00    	jbe    f0103718 <mem_init+0x15bd>
+f0103530:	83 ec 08             	sub    $0x8,%esp
+f0103533:	6a 05                	push   $0x5
+f0103535:	05 00 00 00 10       	add    $0x10000000,%eax
+f010353a:	50                   	push   %eax
+f010353b:	ba 00 00 00 ef       	mov    $0xef000000,%edx
+f0103540:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f0103545:	e8 2b e9 ff ff       	call   f0101e75 <boot_map_region>
+f010354a:	83 c4 10             	add    $0x10,%esp
+f010354d:	be 00 00 00 ed       	mov    $0xed000000,%esi
+f0103552:	83 ec 04             	sub    $0x4,%esp
+f0103555:	6a 01                	push   $0x1
+f0103557:	8d 86 00 00 00 fe    	lea    -0x2000000(%esi),%eax
+f010355d:	50                   	push   %eax
+f010355e:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0103564:	e8 64 e8 ff ff       	call   f0101dcd <pgdir_walk>
+f0103569:	83 c4 10             	add    $0x10,%esp
+f010356c:	85 c0                	test   %eax,%eax
+f010356e:	0f 84 b9 01 00 00    	je     f010372d <mem_init+0x15d2>
+f0103574:	83 ec 04             	sub    $0x4,%esp
+f0103577:	6a 01                	push   $0x1
+f0103579:	56                   	push   %esi
+f010357a:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0103580:	e8 48 e8 ff ff       	call   f0101dcd <pgdir_walk>
+f0103585:	81 c6 00 00 40 00    	add    $0x400000,%esi
+f010358b:	83 c4 10             	add    $0x10,%esp
+f010358e:	85 c0                	test   %eax,%eax
+f0103590:	0f 84 97 01 00 00    	je     f010372d <mem_init+0x15d2>
+f0103596:	81 fe 00 00 00 ef    	cmp    $0xef000000,%esi
+f010359c:	75 b4                	jne    f0103552 <mem_init+0x13f7>
+f010359e:	b8 00 d0 10 f0       	mov    $0xf010d000,%eax
+f01035a3:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01035a8:	0f 86 96 01 00 00    	jbe    f0103744 <mem_init+0x15e9>
+f01035ae:	83 ec 08             	sub    $0x8,%esp
+f01035b1:	6a 03                	push   $0x3
+f01035b3:	68 00 d0 10 00       	push   $0x10d000
+f01035b8:	b9 00 80 00 00       	mov    $0x8000,%ecx
+f01035bd:	ba 00 80 ff ef       	mov    $0xefff8000,%edx
+f01035c2:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f01035c7:	e8 a9 e8 ff ff       	call   f0101e75 <boot_map_region>
+f01035cc:	83 c4 08             	add    $0x8,%esp
+f01035cf:	6a 03                	push   $0x3
+f01035d1:	6a 00                	push   $0x0
+f01035d3:	b9 ff ff ff 0f       	mov    $0xfffffff,%ecx
+f01035d8:	ba 00 00 00 f0       	mov    $0xf0000000,%edx
+f01035dd:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f01035e2:	e8 8e e8 ff ff       	call   f0101e75 <boot_map_region>
+f01035e7:	c7 45 d4 00 70 21 f0 	movl   $0xf0217000,-0x2c(%ebp)
+f01035ee:	bf 00 70 25 f0       	mov    $0xf0257000,%edi
+f01035f3:	83 c4 10             	add    $0x10,%esp
+f01035f6:	bb 00 70 21 f0       	mov    $0xf0217000,%ebx
+f01035fb:	be 00 80 ff ef       	mov    $0xefff8000,%esi
+f0103600:	e9 80 01 00 00       	jmp    f0103785 <mem_init+0x162a>
+f0103605:	68 48 ad 10 f0       	push   $0xf010ad48
+f010360a:	68 6c b1 10 f0       	push   $0xf010b16c
+f010360f:	68 25 06 00 00       	push   $0x625
+f0103614:	68 29 b1 10 f0       	push   $0xf010b129
+f0103619:	e8 0d cb ff ff       	call   f010012b <_panic>
+f010361e:	68 70 ad 10 f0       	push   $0xf010ad70
+f0103623:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103628:	68 26 06 00 00       	push   $0x626
+f010362d:	68 29 b1 10 f0       	push   $0xf010b129
+f0103632:	e8 f4 ca ff ff       	call   f010012b <_panic>
+f0103637:	68 98 ad 10 f0       	push   $0xf010ad98
+f010363c:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103641:	68 28 06 00 00       	push   $0x628
+f0103646:	68 29 b1 10 f0       	push   $0xf010b129
+f010364b:	e8 db ca ff ff       	call   f010012b <_panic>
+f0103650:	68 10 b4 10 f0       	push   $0xf010b410
+f0103655:	68 6c b1 10 f0       	push   $0xf010b16c
+f010365a:	68 2a 06 00 00       	push   $0x62a
+f010365f:	68 29 b1 10 f0       	push   $0xf010b129
+f0103664:	e8 c2 ca ff ff       	call   f010012b <_panic>
+f0103669:	68 c0 ad 10 f0       	push   $0xf010adc0
+f010366e:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103673:	68 2c 06 00 00       	push   $0x62c
+f0103678:	68 29 b1 10 f0       	push   $0xf010b129
+f010367d:	e8 a9 ca ff ff       	call   f010012b <_panic>
+f0103682:	68 e4 ad 10 f0       	push   $0xf010ade4
+f0103687:	68 6c b1 10 f0       	push   $0xf010b16c
+f010368c:	68 2d 06 00 00       	push   $0x62d
+f0103691:	68 29 b1 10 f0       	push   $0xf010b129
+f0103696:	e8 90 ca ff ff       	call   f010012b <_panic>
+f010369b:	68 14 ae 10 f0       	push   $0xf010ae14
+f01036a0:	68 6c b1 10 f0       	push   $0xf010b16c
+f01036a5:	68 2e 06 00 00       	push   $0x62e
+f01036aa:	68 29 b1 10 f0       	push   $0xf010b129
+f01036af:	e8 77 ca ff ff       	call   f010012b <_panic>
+f01036b4:	68 38 ae 10 f0       	push   $0xf010ae38
+f01036b9:	68 6c b1 10 f0       	push   $0xf010b16c
+f01036be:	68 2f 06 00 00       	push   $0x62f
+f01036c3:	68 29 b1 10 f0       	push   $0xf010b129
+f01036c8:	e8 5e ca ff ff       	call   f010012b <_panic>
+f01036cd:	68 64 ae 10 f0       	push   $0xf010ae64
+f01036d2:	68 6c b1 10 f0       	push   $0xf010b16c
+f01036d7:	68 31 06 00 00       	push   $0x631
+f01036dc:	68 29 b1 10 f0       	push   $0xf010b129
+f01036e1:	e8 45 ca ff ff       	call   f010012b <_panic>
+f01036e6:	68 a8 ae 10 f0       	push   $0xf010aea8
+f01036eb:	68 6c b1 10 f0       	push   $0xf010b16c
+f01036f0:	68 32 06 00 00       	push   $0x632
+f01036f5:	68 29 b1 10 f0       	push   $0xf010b129
+f01036fa:	e8 2c ca ff ff       	call   f010012b <_panic>
+f01036ff:	68 3b b4 10 f0       	push   $0xf010b43b
+f0103704:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103709:	68 eb 00 00 00       	push   $0xeb
+f010370e:	68 29 b1 10 f0       	push   $0xf010b129
+f0103713:	e8 13 ca ff ff       	call   f010012b <_panic>
+f0103718:	50                   	push   %eax
+f0103719:	68 08 9e 10 f0       	push   $0xf0109e08
+f010371e:	68 f8 00 00 00       	push   $0xf8
+f0103723:	68 29 b1 10 f0       	push   $0xf010b129
+f0103728:	e8 fe c9 ff ff       	call   f010012b <_panic>
+f010372d:	83 ec 04             	sub    $0x4,%esp
+f0103730:	68 dc ae 10 f0       	push   $0xf010aedc
+f0103735:	68 05 01 00 00       	push   $0x105
+f010373a:	68 29 b1 10 f0       	push   $0xf010b129
+f010373f:	e8 e7 c9 ff ff       	call   f010012b <_panic>
+f0103744:	50                   	push   %eax
+f0103745:	68 08 9e 10 f0       	push   $0xf0109e08
+f010374a:	68 14 01 00 00       	push   $0x114
+f010374f:	68 29 b1 10 f0       	push   $0xf010b129
+f0103754:	e8 d2 c9 ff ff       	call   f010012b <_panic>
+f0103759:	83 ec 08             	sub    $0x8,%esp
+f010375c:	6a 03                	push   $0x3
+f010375e:	8d 83 00 00 00 10    	lea    0x10000000(%ebx),%eax
+f0103764:	50                   	push   %eax
+f0103765:	b9 00 80 00 00       	mov    $0x8000,%ecx
+f010376a:	89 f2                	mov    %esi,%edx
+f010376c:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f0103771:	e8 ff e6 ff ff       	call   f0101e75 <boot_map_region>
+f0103776:	81 ee 00 00 01 00    	sub    $0x10000,%esi
+f010377c:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+f0103782:	83 c4 10             	add    $0x10,%esp
+f0103785:	39 fb                	cmp    %edi,%ebx
+f0103787:	74 1d                	je     f01037a6 <mem_init+0x164b>
+f0103789:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f010378f:	77 c8                	ja     f0103759 <mem_init+0x15fe>
+f0103791:	53                   	push   %ebx
+f0103792:	68 08 9e 10 f0       	push   $0xf0109e08
+f0103797:	68 5b 01 00 00       	push   $0x15b
+f010379c:	68 29 b1 10 f0       	push   $0xf010b129
+f01037a1:	e8 85 c9 ff ff       	call   f010012b <_panic>
+f01037a6:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+f01037a9:	8b 3d 14 37 1a f0    	mov    0xf01a3714,%edi
+f01037af:	8b 15 1c 37 1a f0    	mov    0xf01a371c,%edx
+f01037b5:	8d 04 d5 ff 0f 00 00 	lea    0xfff(,%edx,8),%eax
+f01037bc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f01037c1:	8b 1d 10 37 1a f0    	mov    0xf01a3710,%ebx
+f01037c7:	8d 8b 00 00 00 10    	lea    0x10000000(%ebx),%ecx
+f01037cd:	8b 75 b8             	mov    -0x48(%ebp),%esi
+f01037d0:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f01037d3:	89 c7                	mov    %eax,%edi
+f01037d5:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+f01037d8:	89 cb                	mov    %ecx,%ebx
+f01037da:	39 fe                	cmp    %edi,%esi
+f01037dc:	73 57                	jae    f0103835 <mem_init+0x16da>
+f01037de:	8d 96 00 00 00 ef    	lea    -0x11000000(%esi),%edx
+f01037e4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01037e7:	e8 f6 db ff ff       	call   f01013e2 <check_va2pa>
+f01037ec:	81 7d cc ff ff ff ef 	cmpl   $0xefffffff,-0x34(%ebp)
+f01037f3:	76 0f                	jbe    f0103804 <mem_init+0x16a9>
+f01037f5:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+f01037f8:	39 d0                	cmp    %edx,%eax
+f01037fa:	75 20                	jne    f010381c <mem_init+0x16c1>
+f01037fc:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0103802:	eb d6                	jmp    f01037da <mem_init+0x167f>
+f0103804:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+f0103807:	53                   	push   %ebx
+f0103808:	68 08 9e 10 f0       	push   $0xf0109e08
+f010380d:	68 10 05 00 00       	push   $0x510
+f0103812:	68 29 b1 10 f0       	push   $0xf010b129
+f0103817:	e8 0f c9 ff ff       	call   f010012b <_panic>
+f010381c:	68 0c af 10 f0       	push   $0xf010af0c
+f0103821:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103826:	68 10 05 00 00       	push   $0x510
+f010382b:	68 29 b1 10 f0       	push   $0xf010b129
+f0103830:	e8 f6 c8 ff ff       	call   f010012b <_panic>
+f0103835:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0103838:	be 00 00 00 ed       	mov    $0xed000000,%esi
+f010383d:	8d 96 00 00 00 fe    	lea    -0x2000000(%esi),%edx
+f0103843:	89 f8                	mov    %edi,%eax
+f0103845:	e8 98 db ff ff       	call   f01013e2 <check_va2pa>
+f010384a:	83 f8 ff             	cmp    $0xffffffff,%eax
+f010384d:	75 49                	jne    f0103898 <mem_init+0x173d>
+f010384f:	89 f2                	mov    %esi,%edx
+f0103851:	89 f8                	mov    %edi,%eax
+f0103853:	e8 8a db ff ff       	call   f01013e2 <check_va2pa>
+f0103858:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f010385e:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0103861:	75 4e                	jne    f01038b1 <mem_init+0x1756>
+f0103863:	81 fe 00 00 00 ef    	cmp    $0xef000000,%esi
+f0103869:	75 d2                	jne    f010383d <mem_init+0x16e2>
+f010386b:	a1 18 37 1a f0       	mov    0xf01a3718,%eax
+f0103870:	8b 75 b8             	mov    -0x48(%ebp),%esi
+f0103873:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f0103876:	89 c7                	mov    %eax,%edi
+f0103878:	39 f7                	cmp    %esi,%edi
+f010387a:	74 67                	je     f01038e3 <mem_init+0x1788>
+f010387c:	89 f3                	mov    %esi,%ebx
+f010387e:	c1 e3 0c             	shl    $0xc,%ebx
+f0103881:	8d 93 00 00 00 f0    	lea    -0x10000000(%ebx),%edx
+f0103887:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010388a:	e8 53 db ff ff       	call   f01013e2 <check_va2pa>
+f010388f:	39 d8                	cmp    %ebx,%eax
+f0103891:	75 37                	jne    f01038ca <mem_init+0x176f>
+f0103893:	83 c6 01             	add    $0x1,%esi
+f0103896:	eb e0                	jmp    f0103878 <mem_init+0x171d>
+f0103898:	68 40 af 10 f0       	push   $0xf010af40
+f010389d:	68 6c b1 10 f0       	push   $0xf010b16c
+f01038a2:	68 15 05 00 00       	push   $0x515
+f01038a7:	68 29 b1 10 f0       	push   $0xf010b129
+f01038ac:	e8 7a c8 ff ff       	call   f010012b <_panic>
+f01038b1:	68 64 af 10 f0       	push   $0xf010af64
+f01038b6:	68 6c b1 10 f0       	push   $0xf010b16c
+f01038bb:	68 16 05 00 00       	push   $0x516
+f01038c0:	68 29 b1 10 f0       	push   $0xf010b129
+f01038c5:	e8 61 c8 ff ff       	call   f010012b <_panic>
+f01038ca:	68 88 af 10 f0       	push   $0xf010af88
+f01038cf:	68 6c b1 10 f0       	push   $0xf010b16c
+f01038d4:	68 4f 05 00 00       	push   $0x54f
+f01038d9:	68 29 b1 10 f0       	push   $0xf010b129
+f01038de:	e8 48 c8 ff ff       	call   f010012b <_panic>
+f01038e3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f01038e6:	c7 45 c8 00 f0 21 00 	movl   $0x21f000,-0x38(%ebp)
+f01038ed:	ba 00 00 ff ef       	mov    $0xefff0000,%edx
+f01038f2:	81 ea 00 70 21 f0    	sub    $0xf0217000,%edx
+f01038f8:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+f01038fb:	c7 45 cc 00 80 ff ef 	movl   $0xefff8000,-0x34(%ebp)
+f0103902:	e9 83 00 00 00       	jmp    f010398a <mem_init+0x182f>
+f0103907:	ff 75 d4             	push   -0x2c(%ebp)
+f010390a:	68 08 9e 10 f0       	push   $0xf0109e08
+f010390f:	68 29 05 00 00       	push   $0x529
+f0103914:	68 29 b1 10 f0       	push   $0xf010b129
+f0103919:	e8 0d c8 ff ff       	call   f010012b <_panic>
+f010391e:	68 c8 af 10 f0       	push   $0xf010afc8
+f0103923:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103928:	68 28 05 00 00       	push   $0x528
+f010392d:	68 29 b1 10 f0       	push   $0xf010b129
+f0103932:	e8 f4 c7 ff ff       	call   f010012b <_panic>
+f0103937:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f010393a:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+f010393d:	39 de                	cmp    %ebx,%esi
+f010393f:	74 2d                	je     f010396e <mem_init+0x1813>
+f0103941:	89 f2                	mov    %esi,%edx
+f0103943:	89 f8                	mov    %edi,%eax
+f0103945:	e8 98 da ff ff       	call   f01013e2 <check_va2pa>
+f010394a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0103950:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0103953:	74 e8                	je     f010393d <mem_init+0x17e2>
+f0103955:	68 10 b0 10 f0       	push   $0xf010b010
+f010395a:	68 6c b1 10 f0       	push   $0xf010b16c
+f010395f:	68 2b 05 00 00       	push   $0x52b
+f0103964:	68 29 b1 10 f0       	push   $0xf010b129
+f0103969:	e8 bd c7 ff ff       	call   f010012b <_panic>
+f010396e:	81 6d cc 00 00 01 00 	subl   $0x10000,-0x34(%ebp)
+f0103975:	81 45 d4 00 80 00 00 	addl   $0x8000,-0x2c(%ebp)
+f010397c:	81 45 c8 00 80 00 00 	addl   $0x8000,-0x38(%ebp)
+f0103983:	81 6d c4 00 80 01 00 	subl   $0x18000,-0x3c(%ebp)
+f010398a:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+f010398d:	39 4d d4             	cmp    %ecx,-0x2c(%ebp)
+f0103990:	74 55                	je     f01039e7 <mem_init+0x188c>
+f0103992:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0103995:	8d b0 00 80 ff ff    	lea    -0x8000(%eax),%esi
+f010399b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010399e:	8d 98 00 00 00 10    	lea    0x10000000(%eax),%ebx
+f01039a4:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f01039a7:	2d 00 80 ff 0f       	sub    $0xfff8000,%eax
+f01039ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01039af:	89 75 c0             	mov    %esi,-0x40(%ebp)
+f01039b2:	8b 75 c8             	mov    -0x38(%ebp),%esi
+f01039b5:	39 f3                	cmp    %esi,%ebx
+f01039b7:	0f 84 7a ff ff ff    	je     f0103937 <mem_init+0x17dc>
+f01039bd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01039c0:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+f01039c3:	89 f8                	mov    %edi,%eax
+f01039c5:	e8 18 da ff ff       	call   f01013e2 <check_va2pa>
+f01039ca:	81 7d d4 ff ff ff ef 	cmpl   $0xefffffff,-0x2c(%ebp)
+f01039d1:	0f 86 30 ff ff ff    	jbe    f0103907 <mem_init+0x17ac>
+f01039d7:	39 c3                	cmp    %eax,%ebx
+f01039d9:	0f 85 3f ff ff ff    	jne    f010391e <mem_init+0x17c3>
+f01039df:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01039e5:	eb ce                	jmp    f01039b5 <mem_init+0x185a>
+f01039e7:	8b 45 b8             	mov    -0x48(%ebp),%eax
+f01039ea:	eb 55                	jmp    f0103a41 <mem_init+0x18e6>
+f01039ec:	f6 04 87 01          	testb  $0x1,(%edi,%eax,4)
+f01039f0:	75 45                	jne    f0103a37 <mem_init+0x18dc>
+f01039f2:	68 45 b4 10 f0       	push   $0xf010b445
+f01039f7:	68 6c b1 10 f0       	push   $0xf010b16c
+f01039fc:	68 35 05 00 00       	push   $0x535
+f0103a01:	68 29 b1 10 f0       	push   $0xf010b129
+f0103a06:	e8 20 c7 ff ff       	call   f010012b <_panic>
+f0103a0b:	f6 04 87 01          	testb  $0x1,(%edi,%eax,4)
+f0103a0f:	75 26                	jne    f0103a37 <mem_init+0x18dc>
+f0103a11:	68 45 b4 10 f0       	push   $0xf010b445
+f0103a16:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103a1b:	68 3a 05 00 00       	push   $0x53a
+f0103a20:	68 29 b1 10 f0       	push   $0xf010b129
+f0103a25:	e8 01 c7 ff ff       	call   f010012b <_panic>
+f0103a2a:	8b 14 87             	mov    (%edi,%eax,4),%edx
+f0103a2d:	f6 c2 01             	test   $0x1,%dl
+f0103a30:	74 4b                	je     f0103a7d <mem_init+0x1922>
+f0103a32:	f6 c2 02             	test   $0x2,%dl
+f0103a35:	74 5f                	je     f0103a96 <mem_init+0x193b>
+f0103a37:	83 c0 01             	add    $0x1,%eax
+f0103a3a:	3d 00 04 00 00       	cmp    $0x400,%eax
+f0103a3f:	74 6e                	je     f0103aaf <mem_init+0x1954>
+f0103a41:	8d 90 44 fc ff ff    	lea    -0x3bc(%eax),%edx
+f0103a47:	83 fa 03             	cmp    $0x3,%edx
+f0103a4a:	76 a0                	jbe    f01039ec <mem_init+0x1891>
+f0103a4c:	8d 90 54 fc ff ff    	lea    -0x3ac(%eax),%edx
+f0103a52:	83 fa 0f             	cmp    $0xf,%edx
+f0103a55:	76 b4                	jbe    f0103a0b <mem_init+0x18b0>
+f0103a57:	3d bf 03 00 00       	cmp    $0x3bf,%eax
+f0103a5c:	77 cc                	ja     f0103a2a <mem_init+0x18cf>
+f0103a5e:	83 3c 87 00          	cmpl   $0x0,(%edi,%eax,4)
+f0103a62:	74 d3                	je     f0103a37 <mem_init+0x18dc>
+f0103a64:	68 67 b4 10 f0       	push   $0xf010b467
+f0103a69:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103a6e:	68 3f 05 00 00       	push   $0x53f
+f0103a73:	68 29 b1 10 f0       	push   $0xf010b129
+f0103a78:	e8 ae c6 ff ff       	call   f010012b <_panic>
+f0103a7d:	68 45 b4 10 f0       	push   $0xf010b445
+f0103a82:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103a87:	68 3c 05 00 00       	push   $0x53c
+f0103a8c:	68 29 b1 10 f0       	push   $0xf010b129
+f0103a91:	e8 95 c6 ff ff       	call   f010012b <_panic>
+f0103a96:	68 56 b4 10 f0       	push   $0xf010b456
+f0103a9b:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103aa0:	68 3d 05 00 00       	push   $0x53d
+f0103aa5:	68 29 b1 10 f0       	push   $0xf010b129
+f0103aaa:	e8 7c c6 ff ff       	call   f010012b <_panic>
+f0103aaf:	83 ec 0c             	sub    $0xc,%esp
+f0103ab2:	68 34 b0 10 f0       	push   $0xf010b034
+f0103ab7:	e8 67 15 00 00       	call   f0105023 <cprintf>
+f0103abc:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f0103ac1:	83 c4 10             	add    $0x10,%esp
+f0103ac4:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103ac9:	0f 86 06 02 00 00    	jbe    f0103cd5 <mem_init+0x1b7a>
+f0103acf:	05 00 00 00 10       	add    $0x10000000,%eax
+f0103ad4:	0f 22 d8             	mov    %eax,%cr3
+f0103ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103adc:	e8 d9 d9 ff ff       	call   f01014ba <check_page_free_list>
+f0103ae1:	0f 20 c0             	mov    %cr0,%eax
+f0103ae4:	83 e0 f3             	and    $0xfffffff3,%eax
+f0103ae7:	0d 23 00 05 80       	or     $0x80050023,%eax
+f0103aec:	0f 22 c0             	mov    %eax,%cr0
+f0103aef:	83 ec 0c             	sub    $0xc,%esp
+f0103af2:	6a 00                	push   $0x0
+f0103af4:	e8 6d e2 ff ff       	call   f0101d66 <page_alloc>
+f0103af9:	89 c3                	mov    %eax,%ebx
+f0103afb:	83 c4 10             	add    $0x10,%esp
+f0103afe:	85 c0                	test   %eax,%eax
+f0103b00:	0f 84 e4 01 00 00    	je     f0103cea <mem_init+0x1b8f>
+f0103b06:	83 ec 0c             	sub    $0xc,%esp
+f0103b09:	6a 00                	push   $0x0
+f0103b0b:	e8 56 e2 ff ff       	call   f0101d66 <page_alloc>
+f0103b10:	89 c7                	mov    %eax,%edi
+f0103b12:	83 c4 10             	add    $0x10,%esp
+f0103b15:	85 c0                	test   %eax,%eax
+f0103b17:	0f 84 e6 01 00 00    	je     f0103d03 <mem_init+0x1ba8>
+f0103b1d:	83 ec 0c             	sub    $0xc,%esp
+f0103b20:	6a 00                	push   $0x0
+f0103b22:	e8 3f e2 ff ff       	call   f0101d66 <page_alloc>
+f0103b27:	89 c6                	mov    %eax,%esi
+f0103b29:	83 c4 10             	add    $0x10,%esp
+f0103b2c:	85 c0                	test   %eax,%eax
+f0103b2e:	0f 84 e8 01 00 00    	je     f0103d1c <mem_init+0x1bc1>
+f0103b34:	83 ec 0c             	sub    $0xc,%esp
+f0103b37:	53                   	push   %ebx
+f0103b38:	e8 fd dd ff ff       	call   f010193a <page_free>
+f0103b3d:	89 f8                	mov    %edi,%eax
+f0103b3f:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f0103b45:	c1 f8 03             	sar    $0x3,%eax
+f0103b48:	89 c2                	mov    %eax,%edx
+f0103b4a:	c1 e2 0c             	shl    $0xc,%edx
+f0103b4d:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103b52:	83 c4 10             	add    $0x10,%esp
+f0103b55:	3b 05 18 37 1a f0    	cmp    0xf01a3718,%eax
+f0103b5b:	0f 83 d4 01 00 00    	jae    f0103d35 <mem_init+0x1bda>
+f0103b61:	83 ec 04             	sub    $0x4,%esp
+f0103b64:	68 00 10 00 00       	push   $0x1000
+f0103b69:	6a 01                	push   $0x1
+f0103b6b:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0103b71:	52                   	push   %edx
+f0103b72:	e8 12 53 00 00       	call   f0108e89 <memset>
+f0103b77:	89 f0                	mov    %esi,%eax
+f0103b79:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f0103b7f:	c1 f8 03             	sar    $0x3,%eax
+f0103b82:	89 c2                	mov    %eax,%edx
+f0103b84:	c1 e2 0c             	shl    $0xc,%edx
+f0103b87:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103b8c:	83 c4 10             	add    $0x10,%esp
+f0103b8f:	3b 05 18 37 1a f0    	cmp    0xf01a3718,%eax
+f0103b95:	0f 83 ac 01 00 00    	jae    f0103d47 <mem_init+0x1bec>
+f0103b9b:	83 ec 04             	sub    $0x4,%esp
+f0103b9e:	68 00 10 00 00       	push   $0x1000
+f0103ba3:	6a 02                	push   $0x2
+f0103ba5:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0103bab:	52                   	push   %edx
+f0103bac:	e8 d8 52 00 00       	call   f0108e89 <memset>
+f0103bb1:	6a 02                	push   $0x2
+f0103bb3:	68 00 10 00 00       	push   $0x1000
+f0103bb8:	57                   	push   %edi
+f0103bb9:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0103bbf:	e8 24 e5 ff ff       	call   f01020e8 <page_insert>
+f0103bc4:	83 c4 20             	add    $0x20,%esp
+f0103bc7:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0103bcc:	0f 85 87 01 00 00    	jne    f0103d59 <mem_init+0x1bfe>
+f0103bd2:	81 3d 00 10 00 00 01 	cmpl   $0x1010101,0x1000
+f0103bd9:	01 01 01 
+f0103bdc:	0f 85 90 01 00 00    	jne    f0103d72 <mem_init+0x1c17>
+f0103be2:	6a 02                	push   $0x2
+f0103be4:	68 00 10 00 00       	push   $0x1000
+f0103be9:	56                   	push   %esi
+f0103bea:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0103bf0:	e8 f3 e4 ff ff       	call   f01020e8 <page_insert>
+f0103bf5:	83 c4 10             	add    $0x10,%esp
+f0103bf8:	81 3d 00 10 00 00 02 	cmpl   $0x2020202,0x1000
+f0103bff:	02 02 02 
+f0103c02:	0f 85 83 01 00 00    	jne    f0103d8b <mem_init+0x1c30>
+f0103c08:	66 83 7e 04 01       	cmpw   $0x1,0x4(%esi)
+f0103c0d:	0f 85 91 01 00 00    	jne    f0103da4 <mem_init+0x1c49>
+f0103c13:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f0103c18:	0f 85 9f 01 00 00    	jne    f0103dbd <mem_init+0x1c62>
+f0103c1e:	c7 05 00 10 00 00 03 	movl   $0x3030303,0x1000
+f0103c25:	03 03 03 
+f0103c28:	89 f0                	mov    %esi,%eax
+f0103c2a:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f0103c30:	c1 f8 03             	sar    $0x3,%eax
+f0103c33:	89 c2                	mov    %eax,%edx
+f0103c35:	c1 e2 0c             	shl    $0xc,%edx
+f0103c38:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103c3d:	3b 05 18 37 1a f0    	cmp    0xf01a3718,%eax
+f0103c43:	0f 83 8d 01 00 00    	jae    f0103dd6 <mem_init+0x1c7b>
+f0103c49:	81 ba 00 00 00 f0 03 	cmpl   $0x3030303,-0x10000000(%edx)
+f0103c50:	03 03 03 
+f0103c53:	0f 85 8f 01 00 00    	jne    f0103de8 <mem_init+0x1c8d>
+f0103c59:	83 ec 08             	sub    $0x8,%esp
+f0103c5c:	68 00 10 00 00       	push   $0x1000
+f0103c61:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0103c67:	e8 98 e3 ff ff       	call   f0102004 <page_remove>
+f0103c6c:	83 c4 10             	add    $0x10,%esp
+f0103c6f:	66 83 7e 04 00       	cmpw   $0x0,0x4(%esi)
+f0103c74:	0f 85 87 01 00 00    	jne    f0103e01 <mem_init+0x1ca6>
+f0103c7a:	8b 0d 14 37 1a f0    	mov    0xf01a3714,%ecx
+f0103c80:	8b 11                	mov    (%ecx),%edx
+f0103c82:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0103c88:	89 d8                	mov    %ebx,%eax
+f0103c8a:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f0103c90:	c1 f8 03             	sar    $0x3,%eax
+f0103c93:	c1 e0 0c             	shl    $0xc,%eax
+f0103c96:	39 c2                	cmp    %eax,%edx
+f0103c98:	0f 85 7c 01 00 00    	jne    f0103e1a <mem_init+0x1cbf>
+f0103c9e:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+f0103ca4:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0103ca9:	0f 85 84 01 00 00    	jne    f0103e33 <mem_init+0x1cd8>
+f0103caf:	66 c7 43 04 00 00    	movw   $0x0,0x4(%ebx)
+f0103cb5:	83 ec 0c             	sub    $0xc,%esp
+f0103cb8:	53                   	push   %ebx
+f0103cb9:	e8 7c dc ff ff       	call   f010193a <page_free>
+f0103cbe:	c7 04 24 c8 b0 10 f0 	movl   $0xf010b0c8,(%esp)
+f0103cc5:	e8 59 13 00 00       	call   f0105023 <cprintf>
+f0103cca:	83 c4 10             	add    $0x10,%esp
+f0103ccd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103cd0:	5b                   	pop    %ebx
+f0103cd1:	5e                   	pop    %esi
+f0103cd2:	5f                   	pop    %edi
+f0103cd3:	5d                   	pop    %ebp
+f0103cd4:	c3                   	ret
+f0103cd5:	50                   	push   %eax
+f0103cd6:	68 08 9e 10 f0       	push   $0xf0109e08
+f0103cdb:	68 31 01 00 00       	push   $0x131
+f0103ce0:	68 29 b1 10 f0       	push   $0xf010b129
+f0103ce5:	e8 41 c4 ff ff       	call   f010012b <_panic>
+f0103cea:	68 47 b2 10 f0       	push   $0xf010b247
+f0103cef:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103cf4:	68 47 06 00 00       	push   $0x647
+f0103cf9:	68 29 b1 10 f0       	push   $0xf010b129
+f0103cfe:	e8 28 c4 ff ff       	call   f010012b <_panic>
+f0103d03:	68 5d b2 10 f0       	push   $0xf010b25d
+f0103d08:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103d0d:	68 48 06 00 00       	push   $0x648
+f0103d12:	68 29 b1 10 f0       	push   $0xf010b129
+f0103d17:	e8 0f c4 ff ff       	call   f010012b <_panic>
+f0103d1c:	68 73 b2 10 f0       	push   $0xf010b273
+f0103d21:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103d26:	68 49 06 00 00       	push   $0x649
+f0103d2b:	68 29 b1 10 f0       	push   $0xf010b129
+f0103d30:	e8 f6 c3 ff ff       	call   f010012b <_panic>
+f0103d35:	52                   	push   %edx
+f0103d36:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0103d3b:	6a 71                	push   $0x71
+f0103d3d:	68 52 b1 10 f0       	push   $0xf010b152
+f0103d42:	e8 e4 c3 ff ff       	call   f010012b <_panic>
+f0103d47:	52                   	push   %edx
+f0103d48:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0103d4d:	6a 71                	push   $0x71
+f0103d4f:	68 52 b1 10 f0       	push   $0xf010b152
+f0103d54:	e8 d2 c3 ff ff       	call   f010012b <_panic>
+f0103d59:	68 44 b3 10 f0       	push   $0xf010b344
+f0103d5e:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103d63:	68 4e 06 00 00       	push   $0x64e
+f0103d68:	68 29 b1 10 f0       	push   $0xf010b129
+f0103d6d:	e8 b9 c3 ff ff       	call   f010012b <_panic>
+f0103d72:	68 54 b0 10 f0       	push   $0xf010b054
+f0103d77:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103d7c:	68 4f 06 00 00       	push   $0x64f
+f0103d81:	68 29 b1 10 f0       	push   $0xf010b129
+f0103d86:	e8 a0 c3 ff ff       	call   f010012b <_panic>
+f0103d8b:	68 78 b0 10 f0       	push   $0xf010b078
+f0103d90:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103d95:	68 51 06 00 00       	push   $0x651
+f0103d9a:	68 29 b1 10 f0       	push   $0xf010b129
+f0103d9f:	e8 87 c3 ff ff       	call   f010012b <_panic>
+f0103da4:	68 66 b3 10 f0       	push   $0xf010b366
+f0103da9:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103dae:	68 52 06 00 00       	push   $0x652
+f0103db3:	68 29 b1 10 f0       	push   $0xf010b129
+f0103db8:	e8 6e c3 ff ff       	call   f010012b <_panic>
+f0103dbd:	68 d0 b3 10 f0       	push   $0xf010b3d0
+f0103dc2:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103dc7:	68 53 06 00 00       	push   $0x653
+f0103dcc:	68 29 b1 10 f0       	push   $0xf010b129
+f0103dd1:	e8 55 c3 ff ff       	call   f010012b <_panic>
+f0103dd6:	52                   	push   %edx
+f0103dd7:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0103ddc:	6a 71                	push   $0x71
+f0103dde:	68 52 b1 10 f0       	push   $0xf010b152
+f0103de3:	e8 43 c3 ff ff       	call   f010012b <_panic>
+f0103de8:	68 9c b0 10 f0       	push   $0xf010b09c
+f0103ded:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103df2:	68 55 06 00 00       	push   $0x655
+f0103df7:	68 29 b1 10 f0       	push   $0xf010b129
+f0103dfc:	e8 2a c3 ff ff       	call   f010012b <_panic>
+f0103e01:	68 9e b3 10 f0       	push   $0xf010b39e
+f0103e06:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103e0b:	68 57 06 00 00       	push   $0x657
+f0103e10:	68 29 b1 10 f0       	push   $0xf010b129
+f0103e15:	e8 11 c3 ff ff       	call   f010012b <_panic>
+f0103e1a:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0103e1f:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103e24:	68 5a 06 00 00       	push   $0x65a
+f0103e29:	68 29 b1 10 f0       	push   $0xf010b129
+f0103e2e:	e8 f8 c2 ff ff       	call   f010012b <_panic>
+f0103e33:	68 55 b3 10 f0       	push   $0xf010b355
+f0103e38:	68 6c b1 10 f0       	push   $0xf010b16c
+f0103e3d:	68 5c 06 00 00       	push   $0x65c
+f0103e42:	68 29 b1 10 f0       	push   $0xf010b129
+f0103e47:	e8 df c2 ff ff       	call   f010012b <_panic>
+
+f0103e4c <envs_grow>:
+f0103e4c:	55                   	push   %ebp
+f0103e4d:	89 e5                	mov    %esp,%ebp
+f0103e4f:	57                   	push   %edi
+f0103e50:	56                   	push   %esi
+f0103e51:	53                   	push   %ebx
+f0103e52:	83 ec 0c             	sub    $0xc,%esp
+f0103e55:	69 75 08 80 03 00 00 	imul   $0x380,0x8(%ebp),%esi
+f0103e5c:	81 c6 ff 0f 00 00    	add    $0xfff,%esi
+f0103e62:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f0103e68:	eb 6c                	jmp    f0103ed6 <envs_grow+0x8a>
+f0103e6a:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+f0103e6f:	89 c7                	mov    %eax,%edi
+f0103e71:	2b 3d 10 37 1a f0    	sub    0xf01a3710,%edi
+f0103e77:	c1 ff 03             	sar    $0x3,%edi
+f0103e7a:	c1 e7 0c             	shl    $0xc,%edi
+f0103e7d:	83 ec 04             	sub    $0x4,%esp
+f0103e80:	6a 00                	push   $0x0
+f0103e82:	a1 20 37 1a f0       	mov    0xf01a3720,%eax
+f0103e87:	2d 00 00 00 15       	sub    $0x15000000,%eax
+f0103e8c:	50                   	push   %eax
+f0103e8d:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0103e93:	e8 35 df ff ff       	call   f0101dcd <pgdir_walk>
+f0103e98:	83 cf 03             	or     $0x3,%edi
+f0103e9b:	89 38                	mov    %edi,(%eax)
+f0103e9d:	2b 1d 10 37 1a f0    	sub    0xf01a3710,%ebx
+f0103ea3:	c1 fb 03             	sar    $0x3,%ebx
+f0103ea6:	c1 e3 0c             	shl    $0xc,%ebx
+f0103ea9:	83 c4 0c             	add    $0xc,%esp
+f0103eac:	6a 00                	push   $0x0
+f0103eae:	a1 20 37 1a f0       	mov    0xf01a3720,%eax
+f0103eb3:	2d 00 00 00 13       	sub    $0x13000000,%eax
+f0103eb8:	50                   	push   %eax
+f0103eb9:	ff 35 14 37 1a f0    	push   0xf01a3714
+f0103ebf:	e8 09 df ff ff       	call   f0101dcd <pgdir_walk>
+f0103ec4:	83 cb 05             	or     $0x5,%ebx
+f0103ec7:	89 18                	mov    %ebx,(%eax)
+f0103ec9:	81 05 20 37 1a f0 00 	addl   $0x1000,0xf01a3720
+f0103ed0:	10 00 00 
+f0103ed3:	83 c4 10             	add    $0x10,%esp
+f0103ed6:	39 35 20 37 1a f0    	cmp    %esi,0xf01a3720
+f0103edc:	73 1e                	jae    f0103efc <envs_grow+0xb0>
+f0103ede:	83 ec 0c             	sub    $0xc,%esp
+f0103ee1:	6a 03                	push   $0x3
+f0103ee3:	e8 7e de ff ff       	call   f0101d66 <page_alloc>
+f0103ee8:	89 c3                	mov    %eax,%ebx
+f0103eea:	83 c4 10             	add    $0x10,%esp
+f0103eed:	85 c0                	test   %eax,%eax
+f0103eef:	0f 85 75 ff ff ff    	jne    f0103e6a <envs_grow+0x1e>
+f0103ef5:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0103efa:	eb 05                	jmp    f0103f01 <envs_grow+0xb5>
+f0103efc:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103f01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103f04:	5b                   	pop    %ebx
+f0103f05:	5e                   	pop    %esi
+f0103f06:	5f                   	pop    %edi
+f0103f07:	5d                   	pop    %ebp
+f0103f08:	c3                   	ret
+
+f0103f09 <page_cow>:
+f0103f09:	55                   	push   %ebp
+f0103f0a:	89 e5                	mov    %esp,%ebp
+f0103f0c:	57                   	push   %edi
+f0103f0d:	56                   	push   %esi
+f0103f0e:	53                   	push   %ebx
+f0103f0f:	83 ec 30             	sub    $0x30,%esp
+f0103f12:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0103f15:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f0103f1b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0103f1e:	50                   	push   %eax
+f0103f1f:	56                   	push   %esi
+f0103f20:	ff 75 08             	push   0x8(%ebp)
+f0103f23:	e8 19 e0 ff ff       	call   f0101f41 <page_lookup>
+f0103f28:	83 c4 10             	add    $0x10,%esp
+f0103f2b:	85 c0                	test   %eax,%eax
+f0103f2d:	0f 84 94 00 00 00    	je     f0103fc7 <page_cow+0xbe>
+f0103f33:	89 c3                	mov    %eax,%ebx
+f0103f35:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0103f38:	f7 07 00 08 00 00    	testl  $0x800,(%edi)
+f0103f3e:	0f 84 8a 00 00 00    	je     f0103fce <page_cow+0xc5>
+f0103f44:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f0103f49:	74 6b                	je     f0103fb6 <page_cow+0xad>
+f0103f4b:	83 ec 0c             	sub    $0xc,%esp
+f0103f4e:	6a 02                	push   $0x2
+f0103f50:	e8 11 de ff ff       	call   f0101d66 <page_alloc>
+f0103f55:	83 c4 10             	add    $0x10,%esp
+f0103f58:	85 c0                	test   %eax,%eax
+f0103f5a:	74 79                	je     f0103fd5 <page_cow+0xcc>
+f0103f5c:	83 ec 0c             	sub    $0xc,%esp
+f0103f5f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0103f62:	50                   	push   %eax
+f0103f63:	e8 d0 dc ff ff       	call   f0101c38 <kmap>
+f0103f68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0103f6b:	89 1c 24             	mov    %ebx,(%esp)
+f0103f6e:	e8 c5 dc ff ff       	call   f0101c38 <kmap>
+f0103f73:	89 c3                	mov    %eax,%ebx
+f0103f75:	83 c4 08             	add    $0x8,%esp
+f0103f78:	50                   	push   %eax
+f0103f79:	ff 75 d0             	push   -0x30(%ebp)
+f0103f7c:	e8 e2 4f 00 00       	call   f0108f63 <page_copy>
+f0103f81:	89 1c 24             	mov    %ebx,(%esp)
+f0103f84:	e8 68 dd ff ff       	call   f0101cf1 <kunmap>
+f0103f89:	83 c4 04             	add    $0x4,%esp
+f0103f8c:	ff 75 d0             	push   -0x30(%ebp)
+f0103f8f:	e8 5d dd ff ff       	call   f0101cf1 <kunmap>
+f0103f94:	8b 07                	mov    (%edi),%eax
+f0103f96:	25 05 06 00 00       	and    $0x605,%eax
+f0103f9b:	83 c8 02             	or     $0x2,%eax
+f0103f9e:	50                   	push   %eax
+f0103f9f:	56                   	push   %esi
+f0103fa0:	ff 75 d4             	push   -0x2c(%ebp)
+f0103fa3:	ff 75 08             	push   0x8(%ebp)
+f0103fa6:	e8 3d e1 ff ff       	call   f01020e8 <page_insert>
+f0103fab:	83 c4 20             	add    $0x20,%esp
+f0103fae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103fb1:	5b                   	pop    %ebx
+f0103fb2:	5e                   	pop    %esi
+f0103fb3:	5f                   	pop    %edi
+f0103fb4:	5d                   	pop    %ebp
+f0103fb5:	c3                   	ret
+f0103fb6:	83 ec 08             	sub    $0x8,%esp
+f0103fb9:	56                   	push   %esi
+f0103fba:	ff 75 08             	push   0x8(%ebp)
+f0103fbd:	e8 a8 e0 ff ff       	call   f010206a <page_cow_reuse>
+f0103fc2:	83 c4 10             	add    $0x10,%esp
+f0103fc5:	eb e7                	jmp    f0103fae <page_cow+0xa5>
+f0103fc7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0103fcc:	eb e0                	jmp    f0103fae <page_cow+0xa5>
+f0103fce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0103fd3:	eb d9                	jmp    f0103fae <page_cow+0xa5>
+f0103fd5:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0103fda:	eb d2                	jmp    f0103fae <page_cow+0xa5>
+
+f0103fdc <user_mem_check>:
+f0103fdc:	55                   	push   %ebp
+f0103fdd:	89 e5                	mov    %esp,%ebp
+f0103fdf:	57                   	push   %edi
+f0103fe0:	56                   	push   %esi
+f0103fe1:	53                   	push   %ebx
+f0103fe2:	83 ec 1c             	sub    $0x1c,%esp
+f0103fe5:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0103fe8:	89 f3                	mov    %esi,%ebx
+f0103fea:	03 75 10             	add    0x10(%ebp),%esi
+f0103fed:	8b 7d 14             	mov    0x14(%ebp),%edi
+f0103ff0:	83 cf 01             	or     $0x1,%edi
+f0103ff3:	39 f3                	cmp    %esi,%ebx
+f0103ff5:	74 59                	je     f0104050 <user_mem_check+0x74>
+f0103ff7:	83 ec 04             	sub    $0x4,%esp
+f0103ffa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0103ffd:	50                   	push   %eax
+f0103ffe:	53                   	push   %ebx
+f0103fff:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104002:	ff 70 50             	push   0x50(%eax)
+f0104005:	e8 37 df ff ff       	call   f0101f41 <page_lookup>
+f010400a:	83 c4 10             	add    $0x10,%esp
+f010400d:	85 c0                	test   %eax,%eax
+f010400f:	74 18                	je     f0104029 <user_mem_check+0x4d>
+f0104011:	81 fb ff ff 7f ef    	cmp    $0xef7fffff,%ebx
+f0104017:	77 1d                	ja     f0104036 <user_mem_check+0x5a>
+f0104019:	8d 53 01             	lea    0x1(%ebx),%edx
+f010401c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010401f:	89 f9                	mov    %edi,%ecx
+f0104021:	23 08                	and    (%eax),%ecx
+f0104023:	74 1e                	je     f0104043 <user_mem_check+0x67>
+f0104025:	89 d3                	mov    %edx,%ebx
+f0104027:	eb ca                	jmp    f0103ff3 <user_mem_check+0x17>
+f0104029:	89 1d 28 37 1a f0    	mov    %ebx,0xf01a3728
+f010402f:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f0104034:	eb 1f                	jmp    f0104055 <user_mem_check+0x79>
+f0104036:	89 1d 28 37 1a f0    	mov    %ebx,0xf01a3728
+f010403c:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f0104041:	eb 12                	jmp    f0104055 <user_mem_check+0x79>
+f0104043:	89 1d 28 37 1a f0    	mov    %ebx,0xf01a3728
+f0104049:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f010404e:	eb 05                	jmp    f0104055 <user_mem_check+0x79>
+f0104050:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104055:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104058:	5b                   	pop    %ebx
+f0104059:	5e                   	pop    %esi
+f010405a:	5f                   	pop    %edi
+f010405b:	5d                   	pop    %ebp
+f010405c:	c3                   	ret
+
+f010405d <user_mem_assert>:
+f010405d:	55                   	push   %ebp
+f010405e:	89 e5                	mov    %esp,%ebp
+f0104060:	53                   	push   %ebx
+f0104061:	83 ec 04             	sub    $0x4,%esp
+f0104064:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0104067:	8b 45 14             	mov    0x14(%ebp),%eax
+f010406a:	83 c8 04             	or     $0x4,%eax
+f010406d:	50                   	push   %eax
+f010406e:	ff 75 10             	push   0x10(%ebp)
+f0104071:	ff 75 0c             	push   0xc(%ebp)
+f0104074:	53                   	push   %ebx
+f0104075:	e8 62 ff ff ff       	call   f0103fdc <user_mem_check>
+f010407a:	83 c4 10             	add    $0x10,%esp
+f010407d:	85 c0                	test   %eax,%eax
+f010407f:	78 05                	js     f0104086 <user_mem_assert+0x29>
+f0104081:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104084:	c9                   	leave
+f0104085:	c3                   	ret
+f0104086:	83 ec 04             	sub    $0x4,%esp
+f0104089:	ff 35 28 37 1a f0    	push   0xf01a3728
+f010408f:	ff 73 40             	push   0x40(%ebx)
+f0104092:	68 f4 b0 10 f0       	push   $0xf010b0f4
+f0104097:	e8 87 0f 00 00       	call   f0105023 <cprintf>
+f010409c:	89 1c 24             	mov    %ebx,(%esp)
+f010409f:	e8 df 08 00 00       	call   f0104983 <env_destroy>
+f01040a4:	83 c4 10             	add    $0x10,%esp
+f01040a7:	eb d8                	jmp    f0104081 <user_mem_assert+0x24>
+
+f01040a9 <mem_check_percpu>:
+f01040a9:	c3                   	ret
+
+f01040aa <mem_check_wait>:
+f01040aa:	c3                   	ret
+
+f01040ab <env_grow>:
+f01040ab:	55                   	push   %ebp
+f01040ac:	89 e5                	mov    %esp,%ebp
+f01040ae:	57                   	push   %edi
+f01040af:	56                   	push   %esi
+f01040b0:	53                   	push   %ebx
+f01040b1:	83 ec 0c             	sub    $0xc,%esp
+f01040b4:	a1 40 37 1a f0       	mov    0xf01a3740,%eax
+f01040b9:	8d 58 40             	lea    0x40(%eax),%ebx
+f01040bc:	ba 00 80 00 00       	mov    $0x8000,%edx
+f01040c1:	39 d3                	cmp    %edx,%ebx
+f01040c3:	0f 47 da             	cmova  %edx,%ebx
+f01040c6:	3d 00 80 00 00       	cmp    $0x8000,%eax
+f01040cb:	74 66                	je     f0104133 <env_grow+0x88>
+f01040cd:	83 ec 0c             	sub    $0xc,%esp
+f01040d0:	53                   	push   %ebx
+f01040d1:	e8 76 fd ff ff       	call   f0103e4c <envs_grow>
+f01040d6:	83 c4 10             	add    $0x10,%esp
+f01040d9:	85 c0                	test   %eax,%eax
+f01040db:	78 4e                	js     f010412b <env_grow+0x80>
+f01040dd:	8b 3d 40 37 1a f0    	mov    0xf01a3740,%edi
+f01040e3:	8b 0d 60 39 1a f0    	mov    0xf01a3960,%ecx
+f01040e9:	69 c3 80 03 00 00    	imul   $0x380,%ebx,%eax
+f01040ef:	03 05 44 37 1a f0    	add    0xf01a3744,%eax
+f01040f5:	89 da                	mov    %ebx,%edx
+f01040f7:	be 00 00 00 00       	mov    $0x0,%esi
+f01040fc:	eb 0d                	jmp    f010410b <env_grow+0x60>
+f01040fe:	89 48 4c             	mov    %ecx,0x4c(%eax)
+f0104101:	83 ea 01             	sub    $0x1,%edx
+f0104104:	89 c1                	mov    %eax,%ecx
+f0104106:	be 01 00 00 00       	mov    $0x1,%esi
+f010410b:	2d 80 03 00 00       	sub    $0x380,%eax
+f0104110:	39 d7                	cmp    %edx,%edi
+f0104112:	72 ea                	jb     f01040fe <env_grow+0x53>
+f0104114:	89 f0                	mov    %esi,%eax
+f0104116:	84 c0                	test   %al,%al
+f0104118:	74 06                	je     f0104120 <env_grow+0x75>
+f010411a:	89 0d 60 39 1a f0    	mov    %ecx,0xf01a3960
+f0104120:	89 1d 40 37 1a f0    	mov    %ebx,0xf01a3740
+f0104126:	b8 00 00 00 00       	mov    $0x0,%eax
+f010412b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010412e:	5b                   	pop    %ebx
+f010412f:	5e                   	pop    %esi
+f0104130:	5f                   	pop    %edi
+f0104131:	5d                   	pop    %ebp
+f0104132:	c3                   	ret
+f0104133:	b8 fb ff ff ff       	mov    $0xfffffffb,%eax
+f0104138:	eb f1                	jmp    f010412b <env_grow+0x80>
+
+f010413a <env_setup_vm>:
+f010413a:	55                   	push   %ebp
+f010413b:	89 e5                	mov    %esp,%ebp
+f010413d:	57                   	push   %edi
+f010413e:	56                   	push   %esi
+f010413f:	53                   	push   %ebx
+f0104140:	83 ec 18             	sub    $0x18,%esp
+f0104143:	89 c3                	mov    %eax,%ebx
+f0104145:	6a 01                	push   $0x1
+f0104147:	e8 1a dc ff ff       	call   f0101d66 <page_alloc>
+f010414c:	83 c4 10             	add    $0x10,%esp
+f010414f:	85 c0                	test   %eax,%eax
+f0104151:	0f 84 5a 01 00 00    	je     f01042b1 <env_setup_vm+0x177>
+f0104157:	89 c6                	mov    %eax,%esi
+f0104159:	2b 05 10 37 1a f0    	sub    0xf01a3710,%eax
+f010415f:	c1 f8 03             	sar    $0x3,%eax
+f0104162:	89 c2                	mov    %eax,%edx
+f0104164:	c1 e2 0c             	shl    $0xc,%edx
+f0104167:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010416c:	3b 05 18 37 1a f0    	cmp    0xf01a3718,%eax
+f0104172:	0f 83 d5 00 00 00    	jae    f010424d <env_setup_vm+0x113>
+f0104178:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+f010417e:	89 43 50             	mov    %eax,0x50(%ebx)
+f0104181:	83 ec 04             	sub    $0x4,%esp
+f0104184:	68 00 10 00 00       	push   $0x1000
+f0104189:	6a 00                	push   $0x0
+f010418b:	50                   	push   %eax
+f010418c:	e8 f8 4c 00 00       	call   f0108e89 <memset>
+f0104191:	66 83 46 04 01       	addw   $0x1,0x4(%esi)
+f0104196:	83 c4 08             	add    $0x8,%esp
+f0104199:	53                   	push   %ebx
+f010419a:	ff 73 50             	push   0x50(%ebx)
+f010419d:	e8 91 d8 ff ff       	call   f0101a33 <pgdir_set_owner>
+f01041a2:	83 c4 10             	add    $0x10,%esp
+f01041a5:	b8 b0 0e 00 00       	mov    $0xeb0,%eax
+f01041aa:	8b 15 14 37 1a f0    	mov    0xf01a3714,%edx
+f01041b0:	8b 0c 02             	mov    (%edx,%eax,1),%ecx
+f01041b3:	8b 53 50             	mov    0x50(%ebx),%edx
+f01041b6:	89 0c 02             	mov    %ecx,(%edx,%eax,1)
+f01041b9:	83 c0 04             	add    $0x4,%eax
+f01041bc:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f01041c1:	75 e7                	jne    f01041aa <env_setup_vm+0x70>
+f01041c3:	8b 43 50             	mov    0x50(%ebx),%eax
+f01041c6:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01041cb:	0f 86 8e 00 00 00    	jbe    f010425f <env_setup_vm+0x125>
+f01041d1:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f01041d7:	83 ca 05             	or     $0x5,%edx
+f01041da:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+f01041e0:	83 ec 0c             	sub    $0xc,%esp
+f01041e3:	6a 01                	push   $0x1
+f01041e5:	e8 7c db ff ff       	call   f0101d66 <page_alloc>
+f01041ea:	89 c7                	mov    %eax,%edi
+f01041ec:	83 c4 10             	add    $0x10,%esp
+f01041ef:	85 c0                	test   %eax,%eax
+f01041f1:	0f 84 89 00 00 00    	je     f0104280 <env_setup_vm+0x146>
+f01041f7:	6a 05                	push   $0x5
+f01041f9:	68 00 f0 3f 00       	push   $0x3ff000
+f01041fe:	50                   	push   %eax
+f01041ff:	ff 73 50             	push   0x50(%ebx)
+f0104202:	e8 e1 de ff ff       	call   f01020e8 <page_insert>
+f0104207:	83 c4 10             	add    $0x10,%esp
+f010420a:	85 c0                	test   %eax,%eax
+f010420c:	78 66                	js     f0104274 <env_setup_vm+0x13a>
+f010420e:	66 83 47 04 01       	addw   $0x1,0x4(%edi)
+f0104213:	2b 3d 10 37 1a f0    	sub    0xf01a3710,%edi
+f0104219:	c1 ff 03             	sar    $0x3,%edi
+f010421c:	89 f8                	mov    %edi,%eax
+f010421e:	c1 e0 0c             	shl    $0xc,%eax
+f0104221:	81 e7 ff ff 0f 00    	and    $0xfffff,%edi
+f0104227:	3b 3d 18 37 1a f0    	cmp    0xf01a3718,%edi
+f010422d:	73 70                	jae    f010429f <env_setup_vm+0x165>
+f010422f:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0104234:	89 43 60             	mov    %eax,0x60(%ebx)
+f0104237:	8b 15 64 39 1a f0    	mov    0xf01a3964,%edx
+f010423d:	89 50 0c             	mov    %edx,0xc(%eax)
+f0104240:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104245:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104248:	5b                   	pop    %ebx
+f0104249:	5e                   	pop    %esi
+f010424a:	5f                   	pop    %edi
+f010424b:	5d                   	pop    %ebp
+f010424c:	c3                   	ret
+f010424d:	52                   	push   %edx
+f010424e:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0104253:	6a 71                	push   $0x71
+f0104255:	68 52 b1 10 f0       	push   $0xf010b152
+f010425a:	e8 cc be ff ff       	call   f010012b <_panic>
+f010425f:	50                   	push   %eax
+f0104260:	68 08 9e 10 f0       	push   $0xf0109e08
+f0104265:	68 ff 00 00 00       	push   $0xff
+f010426a:	68 0f b5 10 f0       	push   $0xf010b50f
+f010426f:	e8 b7 be ff ff       	call   f010012b <_panic>
+f0104274:	83 ec 0c             	sub    $0xc,%esp
+f0104277:	57                   	push   %edi
+f0104278:	e8 bd d6 ff ff       	call   f010193a <page_free>
+f010427d:	83 c4 10             	add    $0x10,%esp
+f0104280:	83 ec 08             	sub    $0x8,%esp
+f0104283:	6a 00                	push   $0x0
+f0104285:	ff 73 50             	push   0x50(%ebx)
+f0104288:	e8 a6 d7 ff ff       	call   f0101a33 <pgdir_set_owner>
+f010428d:	89 34 24             	mov    %esi,(%esp)
+f0104290:	e8 75 d7 ff ff       	call   f0101a0a <page_decref>
+f0104295:	83 c4 10             	add    $0x10,%esp
+f0104298:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010429d:	eb a6                	jmp    f0104245 <env_setup_vm+0x10b>
+f010429f:	50                   	push   %eax
+f01042a0:	68 e4 9d 10 f0       	push   $0xf0109de4
+f01042a5:	6a 71                	push   $0x71
+f01042a7:	68 52 b1 10 f0       	push   $0xf010b152
+f01042ac:	e8 7a be ff ff       	call   f010012b <_panic>
+f01042b1:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f01042b6:	eb 8d                	jmp    f0104245 <env_setup_vm+0x10b>
+
+f01042b8 <envid2env>:
+f01042b8:	55                   	push   %ebp
+f01042b9:	89 e5                	mov    %esp,%ebp
+f01042bb:	53                   	push   %ebx
+f01042bc:	8b 55 08             	mov    0x8(%ebp),%edx
+f01042bf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f01042c2:	85 d2                	test   %edx,%edx
+f01042c4:	74 5e                	je     f0104324 <envid2env+0x6c>
+f01042c6:	89 d0                	mov    %edx,%eax
+f01042c8:	25 ff 7f 00 00       	and    $0x7fff,%eax
+f01042cd:	3b 05 40 37 1a f0    	cmp    0xf01a3740,%eax
+f01042d3:	73 64                	jae    f0104339 <envid2env+0x81>
+f01042d5:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+f01042db:	03 05 44 37 1a f0    	add    0xf01a3744,%eax
+f01042e1:	83 38 00             	cmpl   $0x0,(%eax)
+f01042e4:	74 5f                	je     f0104345 <envid2env+0x8d>
+f01042e6:	39 50 40             	cmp    %edx,0x40(%eax)
+f01042e9:	75 66                	jne    f0104351 <envid2env+0x99>
+f01042eb:	ba 00 00 00 00       	mov    $0x0,%edx
+f01042f0:	84 c9                	test   %cl,%cl
+f01042f2:	74 39                	je     f010432d <envid2env+0x75>
+f01042f4:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+f01042fb:	39 41 04             	cmp    %eax,0x4(%ecx)
+f01042fe:	74 2d                	je     f010432d <envid2env+0x75>
+f0104300:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0104307:	8b 4a 04             	mov    0x4(%edx),%ecx
+f010430a:	8b 58 44             	mov    0x44(%eax),%ebx
+f010430d:	3b 59 40             	cmp    0x40(%ecx),%ebx
+f0104310:	0f 94 c2             	sete   %dl
+f0104313:	0f b6 d2             	movzbl %dl,%edx
+f0104316:	8d 54 12 fe          	lea    -0x2(%edx,%edx,1),%edx
+f010431a:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010431f:	0f 45 c1             	cmovne %ecx,%eax
+f0104322:	eb 09                	jmp    f010432d <envid2env+0x75>
+f0104324:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010432a:	8b 40 04             	mov    0x4(%eax),%eax
+f010432d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0104330:	89 01                	mov    %eax,(%ecx)
+f0104332:	89 d0                	mov    %edx,%eax
+f0104334:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104337:	c9                   	leave
+f0104338:	c3                   	ret
+f0104339:	b8 00 00 00 00       	mov    $0x0,%eax
+f010433e:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+f0104343:	eb e8                	jmp    f010432d <envid2env+0x75>
+f0104345:	b8 00 00 00 00       	mov    $0x0,%eax
+f010434a:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+f010434f:	eb dc                	jmp    f010432d <envid2env+0x75>
+f0104351:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104356:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+f010435b:	eb d0                	jmp    f010432d <envid2env+0x75>
+
+f010435d <env_init_gs>:
+f010435d:	55                   	push   %ebp
+f010435e:	89 e5                	mov    %esp,%ebp
+f0104360:	53                   	push   %ebx
+f0104361:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0104364:	8d 04 49             	lea    (%ecx,%ecx,2),%eax
+f0104367:	c1 e0 06             	shl    $0x6,%eax
+f010436a:	05 40 70 25 f0       	add    $0xf0257040,%eax
+f010436f:	89 00                	mov    %eax,(%eax)
+f0104371:	8d 51 0d             	lea    0xd(%ecx),%edx
+f0104374:	66 c7 04 d5 40 73 11 	movw   $0xbf,-0xfee8cc0(,%edx,8)
+f010437b:	f0 bf 00 
+f010437e:	66 89 04 d5 42 73 11 	mov    %ax,-0xfee8cbe(,%edx,8)
+f0104385:	f0 
+f0104386:	89 c3                	mov    %eax,%ebx
+f0104388:	c1 eb 10             	shr    $0x10,%ebx
+f010438b:	88 1c d5 44 73 11 f0 	mov    %bl,-0xfee8cbc(,%edx,8)
+f0104392:	c6 04 d5 45 73 11 f0 	movb   $0x92,-0xfee8cbb(,%edx,8)
+f0104399:	92 
+f010439a:	c6 04 d5 46 73 11 f0 	movb   $0x40,-0xfee8cba(,%edx,8)
+f01043a1:	40 
+f01043a2:	c1 e8 18             	shr    $0x18,%eax
+f01043a5:	88 04 d5 47 73 11 f0 	mov    %al,-0xfee8cb9(,%edx,8)
+f01043ac:	b8 20 73 11 f0       	mov    $0xf0117320,%eax
+f01043b1:	0f 01 10             	lgdtl  (%eax)
+f01043b4:	8d 04 cd 68 00 00 00 	lea    0x68(,%ecx,8),%eax
+f01043bb:	8e e8                	mov    %eax,%gs
+f01043bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01043c0:	c9                   	leave
+f01043c1:	c3                   	ret
+
+f01043c2 <env_alloc>:
+f01043c2:	55                   	push   %ebp
+f01043c3:	89 e5                	mov    %esp,%ebp
+f01043c5:	53                   	push   %ebx
+f01043c6:	83 ec 04             	sub    $0x4,%esp
+f01043c9:	83 3d 60 39 1a f0 00 	cmpl   $0x0,0xf01a3960
+f01043d0:	0f 84 5b 01 00 00    	je     f0104531 <env_alloc+0x16f>
+f01043d6:	8b 1d 60 39 1a f0    	mov    0xf01a3960,%ebx
+f01043dc:	c7 83 c8 00 00 00 00 	movl   $0x0,0xc8(%ebx)
+f01043e3:	00 00 00 
+f01043e6:	c7 83 cc 00 00 00 00 	movl   $0x0,0xcc(%ebx)
+f01043ed:	00 00 00 
+f01043f0:	c7 43 54 00 00 00 00 	movl   $0x0,0x54(%ebx)
+f01043f7:	89 d8                	mov    %ebx,%eax
+f01043f9:	e8 3c fd ff ff       	call   f010413a <env_setup_vm>
+f01043fe:	85 c0                	test   %eax,%eax
+f0104400:	0f 88 26 01 00 00    	js     f010452c <env_alloc+0x16a>
+f0104406:	8b 43 40             	mov    0x40(%ebx),%eax
+f0104409:	8d 90 00 00 01 00    	lea    0x10000(%eax),%edx
+f010440f:	81 e2 00 80 ff ff    	and    $0xffff8000,%edx
+f0104415:	b8 00 00 01 00       	mov    $0x10000,%eax
+f010441a:	0f 4e d0             	cmovle %eax,%edx
+f010441d:	89 d8                	mov    %ebx,%eax
+f010441f:	2b 05 44 37 1a f0    	sub    0xf01a3744,%eax
+f0104425:	c1 f8 07             	sar    $0x7,%eax
+f0104428:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f010442e:	09 d0                	or     %edx,%eax
+f0104430:	89 43 40             	mov    %eax,0x40(%ebx)
+f0104433:	8b 53 60             	mov    0x60(%ebx),%edx
+f0104436:	89 02                	mov    %eax,(%edx)
+f0104438:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010443b:	89 43 44             	mov    %eax,0x44(%ebx)
+f010443e:	c7 43 48 00 00 00 00 	movl   $0x0,0x48(%ebx)
+f0104445:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+f010444b:	c7 83 c4 00 00 00 00 	movl   $0x0,0xc4(%ebx)
+f0104452:	00 00 00 
+f0104455:	c7 43 64 00 00 00 00 	movl   $0x0,0x64(%ebx)
+f010445c:	83 ec 04             	sub    $0x4,%esp
+f010445f:	6a 44                	push   $0x44
+f0104461:	6a 00                	push   $0x0
+f0104463:	8d 83 80 00 00 00    	lea    0x80(%ebx),%eax
+f0104469:	50                   	push   %eax
+f010446a:	e8 1a 4a 00 00       	call   f0108e89 <memset>
+f010446f:	66 c7 83 a4 00 00 00 	movw   $0x23,0xa4(%ebx)
+f0104476:	23 00 
+f0104478:	66 c7 83 a0 00 00 00 	movw   $0x23,0xa0(%ebx)
+f010447f:	23 00 
+f0104481:	66 c7 83 c0 00 00 00 	movw   $0x23,0xc0(%ebx)
+f0104488:	23 00 
+f010448a:	c7 83 bc 00 00 00 00 	movl   $0xeaffe000,0xbc(%ebx)
+f0104491:	e0 ff ea 
+f0104494:	66 c7 83 b4 00 00 00 	movw   $0x1b,0xb4(%ebx)
+f010449b:	1b 00 
+f010449d:	81 8b b8 00 00 00 00 	orl    $0x200,0xb8(%ebx)
+f01044a4:	02 00 00 
+f01044a7:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+f01044ae:	c6 43 5c 00          	movb   $0x0,0x5c(%ebx)
+f01044b2:	c6 43 5d 00          	movb   $0x0,0x5d(%ebx)
+f01044b6:	c6 83 40 03 00 00 00 	movb   $0x0,0x340(%ebx)
+f01044bd:	83 c4 0c             	add    $0xc,%esp
+f01044c0:	6a 20                	push   $0x20
+f01044c2:	6a 00                	push   $0x0
+f01044c4:	8d 83 44 03 00 00    	lea    0x344(%ebx),%eax
+f01044ca:	50                   	push   %eax
+f01044cb:	e8 b9 49 00 00       	call   f0108e89 <memset>
+f01044d0:	c6 43 5e 00          	movb   $0x0,0x5e(%ebx)
+f01044d4:	c6 83 00 01 00 00 00 	movb   $0x0,0x100(%ebx)
+f01044db:	8b 43 4c             	mov    0x4c(%ebx),%eax
+f01044de:	a3 60 39 1a f0       	mov    %eax,0xf01a3960
+f01044e3:	8b 45 08             	mov    0x8(%ebp),%eax
+f01044e6:	89 18                	mov    %ebx,(%eax)
+f01044e8:	8b 53 40             	mov    0x40(%ebx),%edx
+f01044eb:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+f01044f2:	83 c4 10             	add    $0x10,%esp
+f01044f5:	b8 00 00 00 00       	mov    $0x0,%eax
+f01044fa:	83 79 04 00          	cmpl   $0x0,0x4(%ecx)
+f01044fe:	74 0c                	je     f010450c <env_alloc+0x14a>
+f0104500:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104506:	8b 40 04             	mov    0x4(%eax),%eax
+f0104509:	8b 40 40             	mov    0x40(%eax),%eax
+f010450c:	83 ec 04             	sub    $0x4,%esp
+f010450f:	52                   	push   %edx
+f0104510:	50                   	push   %eax
+f0104511:	68 1a b5 10 f0       	push   $0xf010b51a
+f0104516:	e8 08 0b 00 00       	call   f0105023 <cprintf>
+f010451b:	83 c4 10             	add    $0x10,%esp
+f010451e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104523:	f6 05 f4 73 11 f0 40 	testb  $0x40,0xf01173f4
+f010452a:	75 14                	jne    f0104540 <env_alloc+0x17e>
+f010452c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010452f:	c9                   	leave
+f0104530:	c3                   	ret
+f0104531:	e8 75 fb ff ff       	call   f01040ab <env_grow>
+f0104536:	85 c0                	test   %eax,%eax
+f0104538:	0f 89 98 fe ff ff    	jns    f01043d6 <env_alloc+0x14>
+f010453e:	eb ec                	jmp    f010452c <env_alloc+0x16a>
+f0104540:	6a 00                	push   $0x0
+f0104542:	ff 75 0c             	push   0xc(%ebp)
+f0104545:	ff 73 40             	push   0x40(%ebx)
+f0104548:	6a 06                	push   $0x6
+f010454a:	e8 04 34 00 00       	call   f0107953 <ktrace_record>
+f010454f:	83 c4 10             	add    $0x10,%esp
+f0104552:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104557:	eb d3                	jmp    f010452c <env_alloc+0x16a>
+
+f0104559 <env_create>:
+f0104559:	55                   	push   %ebp
+f010455a:	89 e5                	mov    %esp,%ebp
+f010455c:	57                   	push   %edi
+f010455d:	56                   	push   %esi
+f010455e:	53                   	push   %ebx
+f010455f:	83 ec 44             	sub    $0x44,%esp
+f0104562:	6a 00                	push   $0x0
+f0104564:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0104567:	50                   	push   %eax
+f0104568:	e8 55 fe ff ff       	call   f01043c2 <env_alloc>
+f010456d:	83 c4 10             	add    $0x10,%esp
+f0104570:	85 c0                	test   %eax,%eax
+f0104572:	75 4c                	jne    f01045c0 <env_create+0x67>
+f0104574:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0104577:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010457a:	89 47 48             	mov    %eax,0x48(%edi)
+f010457d:	89 f8                	mov    %edi,%eax
+f010457f:	e8 b6 fb ff ff       	call   f010413a <env_setup_vm>
+f0104584:	0f 20 d8             	mov    %cr3,%eax
+f0104587:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f010458a:	8b 47 50             	mov    0x50(%edi),%eax
+f010458d:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0104592:	76 43                	jbe    f01045d7 <env_create+0x7e>
+f0104594:	05 00 00 00 10       	add    $0x10000000,%eax
+f0104599:	0f 22 d8             	mov    %eax,%cr3
+f010459c:	8b 45 08             	mov    0x8(%ebp),%eax
+f010459f:	81 38 7f 45 4c 46    	cmpl   $0x464c457f,(%eax)
+f01045a5:	75 45                	jne    f01045ec <env_create+0x93>
+f01045a7:	8b 45 08             	mov    0x8(%ebp),%eax
+f01045aa:	89 c6                	mov    %eax,%esi
+f01045ac:	03 70 1c             	add    0x1c(%eax),%esi
+f01045af:	0f b7 40 2c          	movzwl 0x2c(%eax),%eax
+f01045b3:	c1 e0 05             	shl    $0x5,%eax
+f01045b6:	01 f0                	add    %esi,%eax
+f01045b8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f01045bb:	e9 f2 00 00 00       	jmp    f01046b2 <env_create+0x159>
+f01045c0:	83 ec 04             	sub    $0x4,%esp
+f01045c3:	68 78 b4 10 f0       	push   $0xf010b478
+f01045c8:	68 02 02 00 00       	push   $0x202
+f01045cd:	68 0f b5 10 f0       	push   $0xf010b50f
+f01045d2:	e8 54 bb ff ff       	call   f010012b <_panic>
+f01045d7:	50                   	push   %eax
+f01045d8:	68 08 9e 10 f0       	push   $0xf0109e08
+f01045dd:	68 ca 01 00 00       	push   $0x1ca
+f01045e2:	68 0f b5 10 f0       	push   $0xf010b50f
+f01045e7:	e8 3f bb ff ff       	call   f010012b <_panic>
+f01045ec:	83 ec 04             	sub    $0x4,%esp
+f01045ef:	68 a4 b4 10 f0       	push   $0xf010b4a4
+f01045f4:	68 d1 01 00 00       	push   $0x1d1
+f01045f9:	68 0f b5 10 f0       	push   $0xf010b50f
+f01045fe:	e8 28 bb ff ff       	call   f010012b <_panic>
+f0104603:	83 ec 04             	sub    $0x4,%esp
+f0104606:	68 c4 b4 10 f0       	push   $0xf010b4c4
+f010460b:	68 89 01 00 00       	push   $0x189
+f0104610:	68 0f b5 10 f0       	push   $0xf010b50f
+f0104615:	e8 11 bb ff ff       	call   f010012b <_panic>
+f010461a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0104620:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0104623:	39 c3                	cmp    %eax,%ebx
+f0104625:	73 56                	jae    f010467d <env_create+0x124>
+f0104627:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010462a:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+f010462d:	83 ec 04             	sub    $0x4,%esp
+f0104630:	6a 00                	push   $0x0
+f0104632:	56                   	push   %esi
+f0104633:	ff 77 50             	push   0x50(%edi)
+f0104636:	e8 06 d9 ff ff       	call   f0101f41 <page_lookup>
+f010463b:	83 c4 10             	add    $0x10,%esp
+f010463e:	85 c0                	test   %eax,%eax
+f0104640:	75 d8                	jne    f010461a <env_create+0xc1>
+f0104642:	83 ec 0c             	sub    $0xc,%esp
+f0104645:	6a 02                	push   $0x2
+f0104647:	e8 1a d7 ff ff       	call   f0101d66 <page_alloc>
+f010464c:	83 c4 10             	add    $0x10,%esp
+f010464f:	85 c0                	test   %eax,%eax
+f0104651:	74 b0                	je     f0104603 <env_create+0xaa>
+f0104653:	6a 07                	push   $0x7
+f0104655:	56                   	push   %esi
+f0104656:	50                   	push   %eax
+f0104657:	ff 77 50             	push   0x50(%edi)
+f010465a:	e8 89 da ff ff       	call   f01020e8 <page_insert>
+f010465f:	83 c4 10             	add    $0x10,%esp
+f0104662:	85 c0                	test   %eax,%eax
+f0104664:	74 b4                	je     f010461a <env_create+0xc1>
+f0104666:	83 ec 04             	sub    $0x4,%esp
+f0104669:	68 c4 b4 10 f0       	push   $0xf010b4c4
+f010466e:	68 8d 01 00 00       	push   $0x18d
+f0104673:	68 0f b5 10 f0       	push   $0xf010b50f
+f0104678:	e8 ae ba ff ff       	call   f010012b <_panic>
+f010467d:	8b 75 c8             	mov    -0x38(%ebp),%esi
+f0104680:	83 ec 04             	sub    $0x4,%esp
+f0104683:	ff 76 10             	push   0x10(%esi)
+f0104686:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104689:	03 46 04             	add    0x4(%esi),%eax
+f010468c:	50                   	push   %eax
+f010468d:	ff 76 08             	push   0x8(%esi)
+f0104690:	e8 b0 48 00 00       	call   f0108f45 <memcpy>
+f0104695:	8b 46 10             	mov    0x10(%esi),%eax
+f0104698:	83 c4 0c             	add    $0xc,%esp
+f010469b:	8b 56 14             	mov    0x14(%esi),%edx
+f010469e:	29 c2                	sub    %eax,%edx
+f01046a0:	52                   	push   %edx
+f01046a1:	6a 00                	push   $0x0
+f01046a3:	03 46 08             	add    0x8(%esi),%eax
+f01046a6:	50                   	push   %eax
+f01046a7:	e8 dd 47 00 00       	call   f0108e89 <memset>
+f01046ac:	83 c4 10             	add    $0x10,%esp
+f01046af:	83 c6 20             	add    $0x20,%esi
+f01046b2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f01046b5:	39 c6                	cmp    %eax,%esi
+f01046b7:	73 32                	jae    f01046eb <env_create+0x192>
+f01046b9:	83 3e 01             	cmpl   $0x1,(%esi)
+f01046bc:	75 f1                	jne    f01046af <env_create+0x156>
+f01046be:	8b 46 08             	mov    0x8(%esi),%eax
+f01046c1:	89 c2                	mov    %eax,%edx
+f01046c3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f01046c9:	03 46 14             	add    0x14(%esi),%eax
+f01046cc:	05 ff 0f 00 00       	add    $0xfff,%eax
+f01046d1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f01046d6:	29 d0                	sub    %edx,%eax
+f01046d8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f01046db:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01046e0:	89 75 c8             	mov    %esi,-0x38(%ebp)
+f01046e3:	89 55 d0             	mov    %edx,-0x30(%ebp)
+f01046e6:	e9 35 ff ff ff       	jmp    f0104620 <env_create+0xc7>
+f01046eb:	83 ec 0c             	sub    $0xc,%esp
+f01046ee:	6a 03                	push   $0x3
+f01046f0:	e8 71 d6 ff ff       	call   f0101d66 <page_alloc>
+f01046f5:	83 c4 10             	add    $0x10,%esp
+f01046f8:	85 c0                	test   %eax,%eax
+f01046fa:	74 2d                	je     f0104729 <env_create+0x1d0>
+f01046fc:	6a 07                	push   $0x7
+f01046fe:	68 00 d0 ff ea       	push   $0xeaffd000
+f0104703:	50                   	push   %eax
+f0104704:	ff 77 50             	push   0x50(%edi)
+f0104707:	e8 dc d9 ff ff       	call   f01020e8 <page_insert>
+f010470c:	8b 45 08             	mov    0x8(%ebp),%eax
+f010470f:	8b 40 18             	mov    0x18(%eax),%eax
+f0104712:	89 87 b0 00 00 00    	mov    %eax,0xb0(%edi)
+f0104718:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f010471b:	0f 22 d8             	mov    %eax,%cr3
+f010471e:	83 c4 10             	add    $0x10,%esp
+f0104721:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104724:	5b                   	pop    %ebx
+f0104725:	5e                   	pop    %esi
+f0104726:	5f                   	pop    %edi
+f0104727:	5d                   	pop    %ebp
+f0104728:	c3                   	ret
+f0104729:	83 ec 04             	sub    $0x4,%esp
+f010472c:	68 e8 b4 10 f0       	push   $0xf010b4e8
+f0104731:	68 ea 01 00 00       	push   $0x1ea
+f0104736:	68 0f b5 10 f0       	push   $0xf010b50f
+f010473b:	e8 eb b9 ff ff       	call   f010012b <_panic>
+
+f0104740 <env_free>:
+f0104740:	55                   	push   %ebp
+f0104741:	89 e5                	mov    %esp,%ebp
+f0104743:	53                   	push   %ebx
+f0104744:	83 ec 04             	sub    $0x4,%esp
+f0104747:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010474a:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104750:	39 58 04             	cmp    %ebx,0x4(%eax)
+f0104753:	0f 84 50 01 00 00    	je     f01048a9 <env_free+0x169>
+f0104759:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010475f:	39 58 0c             	cmp    %ebx,0xc(%eax)
+f0104762:	0f 84 6f 01 00 00    	je     f01048d7 <env_free+0x197>
+f0104768:	83 ec 0c             	sub    $0xc,%esp
+f010476b:	53                   	push   %ebx
+f010476c:	e8 7b 3d 00 00       	call   f01084ec <pmu_release>
+f0104771:	8b 53 40             	mov    0x40(%ebx),%edx
+f0104774:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+f010477b:	83 c4 10             	add    $0x10,%esp
+f010477e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104783:	83 79 04 00          	cmpl   $0x0,0x4(%ecx)
+f0104787:	74 0c                	je     f0104795 <env_free+0x55>
+f0104789:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010478f:	8b 40 04             	mov    0x4(%eax),%eax
+f0104792:	8b 40 40             	mov    0x40(%eax),%eax
+f0104795:	83 ec 04             	sub    $0x4,%esp
+f0104798:	52                   	push   %edx
+f0104799:	50                   	push   %eax
+f010479a:	68 2f b5 10 f0       	push   $0xf010b52f
+f010479f:	e8 7f 08 00 00       	call   f0105023 <cprintf>
+f01047a4:	83 c4 10             	add    $0x10,%esp
+f01047a7:	f6 05 f4 73 11 f0 80 	testb  $0x80,0xf01173f4
+f01047ae:	0f 85 3e 01 00 00    	jne    f01048f2 <env_free+0x1b2>
+f01047b4:	83 ec 0c             	sub    $0xc,%esp
+f01047b7:	ff 73 50             	push   0x50(%ebx)
+f01047ba:	e8 10 d3 ff ff       	call   f0101acf <pgdir_teardown>
+f01047bf:	8b 43 60             	mov    0x60(%ebx),%eax
+f01047c2:	83 c4 10             	add    $0x10,%esp
+f01047c5:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01047ca:	0f 86 38 01 00 00    	jbe    f0104908 <env_free+0x1c8>
+f01047d0:	05 00 00 00 10       	add    $0x10000000,%eax
+f01047d5:	c1 e8 0c             	shr    $0xc,%eax
+f01047d8:	3b 05 1c 37 1a f0    	cmp    0xf01a371c,%eax
+f01047de:	0f 83 39 01 00 00    	jae    f010491d <env_free+0x1dd>
+f01047e4:	83 ec 0c             	sub    $0xc,%esp
+f01047e7:	8b 15 10 37 1a f0    	mov    0xf01a3710,%edx
+f01047ed:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f01047f0:	50                   	push   %eax
+f01047f1:	e8 14 d2 ff ff       	call   f0101a0a <page_decref>
+f01047f6:	c7 43 60 00 00 00 00 	movl   $0x0,0x60(%ebx)
+f01047fd:	8b 43 64             	mov    0x64(%ebx),%eax
+f0104800:	83 c4 10             	add    $0x10,%esp
+f0104803:	85 c0                	test   %eax,%eax
+f0104805:	74 3b                	je     f0104842 <env_free+0x102>
+f0104807:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010480c:	0f 86 1f 01 00 00    	jbe    f0104931 <env_free+0x1f1>
+f0104812:	05 00 00 00 10       	add    $0x10000000,%eax
+f0104817:	c1 e8 0c             	shr    $0xc,%eax
+f010481a:	3b 05 1c 37 1a f0    	cmp    0xf01a371c,%eax
+f0104820:	0f 83 20 01 00 00    	jae    f0104946 <env_free+0x206>
+f0104826:	83 ec 0c             	sub    $0xc,%esp
+f0104829:	8b 15 10 37 1a f0    	mov    0xf01a3710,%edx
+f010482f:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0104832:	50                   	push   %eax
+f0104833:	e8 d2 d1 ff ff       	call   f0101a0a <page_decref>
+f0104838:	c7 43 64 00 00 00 00 	movl   $0x0,0x64(%ebx)
+f010483f:	83 c4 10             	add    $0x10,%esp
+f0104842:	83 ec 08             	sub    $0x8,%esp
+f0104845:	6a 00                	push   $0x0
+f0104847:	ff 73 50             	push   0x50(%ebx)
+f010484a:	e8 e4 d1 ff ff       	call   f0101a33 <pgdir_set_owner>
+f010484f:	8b 43 50             	mov    0x50(%ebx),%eax
+f0104852:	83 c4 10             	add    $0x10,%esp
+f0104855:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010485a:	0f 86 fa 00 00 00    	jbe    f010495a <env_free+0x21a>
+f0104860:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+f0104867:	05 00 00 00 10       	add    $0x10000000,%eax
+f010486c:	c1 e8 0c             	shr    $0xc,%eax
+f010486f:	3b 05 1c 37 1a f0    	cmp    0xf01a371c,%eax
+f0104875:	0f 83 f4 00 00 00    	jae    f010496f <env_free+0x22f>
+f010487b:	83 ec 0c             	sub    $0xc,%esp
+f010487e:	8b 15 10 37 1a f0    	mov    0xf01a3710,%edx
+f0104884:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0104887:	50                   	push   %eax
+f0104888:	e8 7d d1 ff ff       	call   f0101a0a <page_decref>
+f010488d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+f0104893:	a1 60 39 1a f0       	mov    0xf01a3960,%eax
+f0104898:	89 43 4c             	mov    %eax,0x4c(%ebx)
+f010489b:	89 1d 60 39 1a f0    	mov    %ebx,0xf01a3960
+f01048a1:	83 c4 10             	add    $0x10,%esp
+f01048a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01048a7:	c9                   	leave
+f01048a8:	c3                   	ret
+f01048a9:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f01048ae:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01048b3:	76 0d                	jbe    f01048c2 <env_free+0x182>
+f01048b5:	05 00 00 00 10       	add    $0x10000000,%eax
+f01048ba:	0f 22 d8             	mov    %eax,%cr3
+f01048bd:	e9 97 fe ff ff       	jmp    f0104759 <env_free+0x19>
+f01048c2:	50                   	push   %eax
+f01048c3:	68 08 9e 10 f0       	push   $0xf0109e08
+f01048c8:	68 1a 02 00 00       	push   $0x21a
+f01048cd:	68 0f b5 10 f0       	push   $0xf010b50f
+f01048d2:	e8 54 b8 ff ff       	call   f010012b <_panic>
+f01048d7:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01048dd:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+f01048e4:	0f 20 c0             	mov    %cr0,%eax
+f01048e7:	83 c8 08             	or     $0x8,%eax
+f01048ea:	0f 22 c0             	mov    %eax,%cr0
+f01048ed:	e9 76 fe ff ff       	jmp    f0104768 <env_free+0x28>
+f01048f2:	6a 00                	push   $0x0
+f01048f4:	6a 00                	push   $0x0
+f01048f6:	ff 73 40             	push   0x40(%ebx)
+f01048f9:	6a 07                	push   $0x7
+f01048fb:	e8 53 30 00 00       	call   f0107953 <ktrace_record>
+f0104900:	83 c4 10             	add    $0x10,%esp
+f0104903:	e9 ac fe ff ff       	jmp    f01047b4 <env_free+0x74>
+f0104908:	50                   	push   %eax
+f0104909:	68 08 9e 10 f0       	push   $0xf0109e08
+f010490e:	68 2e 02 00 00       	push   $0x22e
+f0104913:	68 0f b5 10 f0       	push   $0xf010b50f
+f0104918:	e8 0e b8 ff ff       	call   f010012b <_panic>
+f010491d:	83 ec 04             	sub    $0x4,%esp
+f0104920:	68 b8 a6 10 f0       	push   $0xf010a6b8
+f0104925:	6a 63                	push   $0x63
+f0104927:	68 52 b1 10 f0       	push   $0xf010b152
+f010492c:	e8 fa b7 ff ff       	call   f010012b <_panic>
+f0104931:	50                   	push   %eax
+f0104932:	68 08 9e 10 f0       	push   $0xf0109e08
+f0104937:	68 33 02 00 00       	push   $0x233
+f010493c:	68 0f b5 10 f0       	push   $0xf010b50f
+f0104941:	e8 e5 b7 ff ff       	call   f010012b <_panic>
+f0104946:	83 ec 04             	sub    $0x4,%esp
+f0104949:	68 b8 a6 10 f0       	push   $0xf010a6b8
+f010494e:	6a 63                	push   $0x63
+f0104950:	68 52 b1 10 f0       	push   $0xf010b152
+f0104955:	e8 d1 b7 ff ff       	call   f010012b <_panic>
+f010495a:	50                   	push   %eax
+f010495b:	68 08 9e 10 f0       	push   $0xf0109e08
+f0104960:	68 39 02 00 00       	push   $0x239
+f0104965:	68 0f b5 10 f0       	push   $0xf010b50f
+f010496a:	e8 bc b7 ff ff       	call   f010012b <_panic>
+f010496f:	83 ec 04             	sub    $0x4,%esp
+f0104972:	68 b8 a6 10 f0       	push   $0xf010a6b8
+f0104977:	6a 63                	push   $0x63
+f0104979:	68 52 b1 10 f0       	push   $0xf010b152
+f010497e:	e8 a8 b7 ff ff       	call   f010012b <_panic>
+
+f0104983 <env_destroy>:
+f0104983:	55                   	push   %ebp
+f0104984:	89 e5                	mov    %esp,%ebp
+f0104986:	53                   	push   %ebx
+f0104987:	83 ec 04             	sub    $0x4,%esp
+f010498a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010498d:	83 3b 03             	cmpl   $0x3,(%ebx)
+f0104990:	75 13                	jne    f01049a5 <env_destroy+0x22>
+f0104992:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104998:	39 58 04             	cmp    %ebx,0x4(%eax)
+f010499b:	74 08                	je     f01049a5 <env_destroy+0x22>
+f010499d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+f01049a3:	eb 17                	jmp    f01049bc <env_destroy+0x39>
+f01049a5:	83 ec 0c             	sub    $0xc,%esp
+f01049a8:	53                   	push   %ebx
+f01049a9:	e8 92 fd ff ff       	call   f0104740 <env_free>
+f01049ae:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01049b4:	83 c4 10             	add    $0x10,%esp
+f01049b7:	39 58 04             	cmp    %ebx,0x4(%eax)
+f01049ba:	74 05                	je     f01049c1 <env_destroy+0x3e>
+f01049bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01049bf:	c9                   	leave
+f01049c0:	c3                   	ret
+f01049c1:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01049c7:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+f01049ce:	e8 e9 15 00 00       	call   f0105fbc <sched_yield>
+
+f01049d3 <env_pop_tf>:
+f01049d3:	55                   	push   %ebp
+f01049d4:	89 e5                	mov    %esp,%ebp
+f01049d6:	83 ec 0c             	sub    $0xc,%esp
+f01049d9:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01049df:	8b 50 04             	mov    0x4(%eax),%edx
+f01049e2:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01049e8:	2d 40 70 25 f0       	sub    $0xf0257040,%eax
+f01049ed:	c1 f8 06             	sar    $0x6,%eax
+f01049f0:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01049f6:	89 42 04             	mov    %eax,0x4(%edx)
+f01049f9:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0104a00:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104a06:	8b 40 04             	mov    0x4(%eax),%eax
+f0104a09:	8b 40 60             	mov    0x60(%eax),%eax
+f0104a0c:	8b 52 04             	mov    0x4(%edx),%edx
+f0104a0f:	8b 52 04             	mov    0x4(%edx),%edx
+f0104a12:	89 50 04             	mov    %edx,0x4(%eax)
+f0104a15:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0104a1c:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104a22:	8b 40 04             	mov    0x4(%eax),%eax
+f0104a25:	8b 40 60             	mov    0x60(%eax),%eax
+f0104a28:	8b 52 04             	mov    0x4(%edx),%edx
+f0104a2b:	8b 92 c4 00 00 00    	mov    0xc4(%edx),%edx
+f0104a31:	89 50 08             	mov    %edx,0x8(%eax)
+f0104a34:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104a3a:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0104a41:	8b 52 04             	mov    0x4(%edx),%edx
+f0104a44:	8b 52 60             	mov    0x60(%edx),%edx
+f0104a47:	8b 40 04             	mov    0x4(%eax),%eax
+f0104a4a:	8b 40 04             	mov    0x4(%eax),%eax
+f0104a4d:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0104a50:	c1 e0 06             	shl    $0x6,%eax
+f0104a53:	8b 80 50 70 25 f0    	mov    -0xfda8fb0(%eax),%eax
+f0104a59:	89 42 10             	mov    %eax,0x10(%edx)
+f0104a5c:	8b 65 08             	mov    0x8(%ebp),%esp
+f0104a5f:	61                   	popa
+f0104a60:	07                   	pop    %es
+f0104a61:	1f                   	pop    %ds
+f0104a62:	83 c4 08             	add    $0x8,%esp
+f0104a65:	cf                   	iret
+f0104a66:	68 45 b5 10 f0       	push   $0xf010b545
+f0104a6b:	68 73 02 00 00       	push   $0x273
+f0104a70:	68 0f b5 10 f0       	push   $0xf010b50f
+f0104a75:	e8 b1 b6 ff ff       	call   f010012b <_panic>
+
+f0104a7a <env_cur_tf>:
+f0104a7a:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0104a81:	8b 42 08             	mov    0x8(%edx),%eax
+f0104a84:	85 c0                	test   %eax,%eax
+f0104a86:	74 01                	je     f0104a89 <env_cur_tf+0xf>
+f0104a88:	c3                   	ret
+f0104a89:	8b 42 04             	mov    0x4(%edx),%eax
+f0104a8c:	83 e8 80             	sub    $0xffffff80,%eax
+f0104a8f:	eb f7                	jmp    f0104a88 <env_cur_tf+0xe>
+
+f0104a91 <env_save_state>:
+f0104a91:	55                   	push   %ebp
+f0104a92:	89 e5                	mov    %esp,%ebp
+f0104a94:	57                   	push   %edi
+f0104a95:	56                   	push   %esi
+f0104a96:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104a9c:	8b 70 08             	mov    0x8(%eax),%esi
+f0104a9f:	85 f6                	test   %esi,%esi
+f0104aa1:	74 18                	je     f0104abb <env_save_state+0x2a>
+f0104aa3:	8b 78 04             	mov    0x4(%eax),%edi
+f0104aa6:	85 ff                	test   %edi,%edi
+f0104aa8:	74 0a                	je     f0104ab4 <env_save_state+0x23>
+f0104aaa:	83 ef 80             	sub    $0xffffff80,%edi
+f0104aad:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0104ab2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0104ab4:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+f0104abb:	8b 50 0c             	mov    0xc(%eax),%edx
+f0104abe:	85 d2                	test   %edx,%edx
+f0104ac0:	74 17                	je     f0104ad9 <env_save_state+0x48>
+f0104ac2:	0f ae 82 40 01 00 00 	fxsave 0x140(%edx)
+f0104ac9:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+f0104ad0:	0f 20 c2             	mov    %cr0,%edx
+f0104ad3:	83 ca 08             	or     $0x8,%edx
+f0104ad6:	0f 22 c2             	mov    %edx,%cr0
+f0104ad9:	83 ec 0c             	sub    $0xc,%esp
+f0104adc:	ff 70 04             	push   0x4(%eax)
+f0104adf:	e8 9a 38 00 00       	call   f010837e <pmu_save>
+f0104ae4:	83 c4 10             	add    $0x10,%esp
+f0104ae7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0104aea:	5e                   	pop    %esi
+f0104aeb:	5f                   	pop    %edi
+f0104aec:	5d                   	pop    %ebp
+f0104aed:	c3                   	ret
+
+f0104aee <env_fpu_init_percpu>:
+f0104aee:	55                   	push   %ebp
+f0104aef:	89 e5                	mov    %esp,%ebp
+f0104af1:	53                   	push   %ebx
+f0104af2:	83 ec 10             	sub    $0x10,%esp
+f0104af5:	c7 45 f8 80 1f 00 00 	movl   $0x1f80,-0x8(%ebp)
+f0104afc:	b8 01 00 00 00       	mov    $0x1,%eax
+f0104b01:	0f a2                	cpuid
+f0104b03:	f7 c2 00 00 00 01    	test   $0x1000000,%edx
+f0104b09:	74 3b                	je     f0104b46 <env_fpu_init_percpu+0x58>
+f0104b0b:	0f 20 e0             	mov    %cr4,%eax
+f0104b0e:	80 cc 06             	or     $0x6,%ah
+f0104b11:	0f 22 e0             	mov    %eax,%cr4
+f0104b14:	0f 20 c0             	mov    %cr0,%eax
+f0104b17:	83 e0 d1             	and    $0xffffffd1,%eax
+f0104b1a:	83 c8 22             	or     $0x22,%eax
+f0104b1d:	0f 22 c0             	mov    %eax,%cr0
+f0104b20:	db e3                	fninit
+f0104b22:	0f ae 55 f8          	ldmxcsr -0x8(%ebp)
+f0104b26:	80 3d 48 37 1a f0 00 	cmpb   $0x0,0xf01a3748
+f0104b2d:	75 07                	jne    f0104b36 <env_fpu_init_percpu+0x48>
+f0104b2f:	0f ae 05 60 37 1a f0 	fxsave 0xf01a3760
+f0104b36:	0f 20 c0             	mov    %cr0,%eax
+f0104b39:	83 c8 08             	or     $0x8,%eax
+f0104b3c:	0f 22 c0             	mov    %eax,%cr0
+f0104b3f:	c6 05 48 37 1a f0 01 	movb   $0x1,0xf01a3748
+f0104b46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104b49:	c9                   	leave
+f0104b4a:	c3                   	ret
+
+f0104b4b <env_init_percpu>:
+f0104b4b:	55                   	push   %ebp
+f0104b4c:	89 e5                	mov    %esp,%ebp
+f0104b4e:	83 ec 08             	sub    $0x8,%esp
+f0104b51:	b8 20 73 11 f0       	mov    $0xf0117320,%eax
+f0104b56:	0f 01 10             	lgdtl  (%eax)
+f0104b59:	b8 23 00 00 00       	mov    $0x23,%eax
+f0104b5e:	8e e0                	mov    %eax,%fs
+f0104b60:	b8 10 00 00 00       	mov    $0x10,%eax
+f0104b65:	8e c0                	mov    %eax,%es
+f0104b67:	8e d8                	mov    %eax,%ds
+f0104b69:	8e d0                	mov    %eax,%ss
+f0104b6b:	ea 72 4b 10 f0 08 00 	ljmp   $0x8,$0xf0104b72
+f0104b72:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104b77:	0f 00 d0             	lldt   %ax
+f0104b7a:	e8 6f ff ff ff       	call   f0104aee <env_fpu_init_percpu>
+f0104b7f:	e8 05 37 00 00       	call   f0108289 <pmu_init_percpu>
+f0104b84:	c9                   	leave
+f0104b85:	c3                   	ret
+
+f0104b86 <env_init>:
+f0104b86:	55                   	push   %ebp
+f0104b87:	89 e5                	mov    %esp,%ebp
+f0104b89:	83 ec 08             	sub    $0x8,%esp
+f0104b8c:	e8 1a f5 ff ff       	call   f01040ab <env_grow>
+f0104b91:	85 c0                	test   %eax,%eax
+f0104b93:	78 07                	js     f0104b9c <env_init+0x16>
+f0104b95:	e8 b1 ff ff ff       	call   f0104b4b <env_init_percpu>
+f0104b9a:	c9                   	leave
+f0104b9b:	c3                   	ret
+f0104b9c:	50                   	push   %eax
+f0104b9d:	68 51 b5 10 f0       	push   $0xf010b551
+f0104ba2:	68 9e 00 00 00       	push   $0x9e
+f0104ba7:	68 0f b5 10 f0       	push   $0xf010b50f
+f0104bac:	e8 7a b5 ff ff       	call   f010012b <_panic>
+
+f0104bb1 <env_fpu_trap>:
+f0104bb1:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0104bb8:	80 3d 48 37 1a f0 00 	cmpb   $0x0,0xf01a3748
+f0104bbf:	74 60                	je     f0104c21 <env_fpu_trap+0x70>
+f0104bc1:	0f 06                	clts
+f0104bc3:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+f0104bca:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104bcf:	8b 49 04             	mov    0x4(%ecx),%ecx
+f0104bd2:	39 4a 0c             	cmp    %ecx,0xc(%edx)
+f0104bd5:	74 4f                	je     f0104c26 <env_fpu_trap+0x75>
+f0104bd7:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104bdd:	8b 48 04             	mov    0x4(%eax),%ecx
+f0104be0:	b8 60 37 1a f0       	mov    $0xf01a3760,%eax
+f0104be5:	80 b9 40 03 00 00 00 	cmpb   $0x0,0x340(%ecx)
+f0104bec:	74 0e                	je     f0104bfc <env_fpu_trap+0x4b>
+f0104bee:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104bf4:	8b 40 04             	mov    0x4(%eax),%eax
+f0104bf7:	05 40 01 00 00       	add    $0x140,%eax
+f0104bfc:	0f ae 08             	fxrstor (%eax)
+f0104bff:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104c05:	8b 40 04             	mov    0x4(%eax),%eax
+f0104c08:	c6 80 40 03 00 00 01 	movb   $0x1,0x340(%eax)
+f0104c0f:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104c15:	8b 40 04             	mov    0x4(%eax),%eax
+f0104c18:	89 42 0c             	mov    %eax,0xc(%edx)
+f0104c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104c20:	c3                   	ret
+f0104c21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0104c26:	c3                   	ret
+
+f0104c27 <env_fpu_copy>:
+f0104c27:	55                   	push   %ebp
+f0104c28:	89 e5                	mov    %esp,%ebp
+f0104c2a:	57                   	push   %edi
+f0104c2b:	56                   	push   %esi
+f0104c2c:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0104c2f:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0104c36:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104c3c:	8b 40 04             	mov    0x4(%eax),%eax
+f0104c3f:	39 42 0c             	cmp    %eax,0xc(%edx)
+f0104c42:	74 3a                	je     f0104c7e <env_fpu_copy+0x57>
+f0104c44:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104c4a:	8b 40 04             	mov    0x4(%eax),%eax
+f0104c4d:	0f b6 80 40 03 00 00 	movzbl 0x340(%eax),%eax
+f0104c54:	88 87 40 03 00 00    	mov    %al,0x340(%edi)
+f0104c5a:	84 c0                	test   %al,%al
+f0104c5c:	74 1c                	je     f0104c7a <env_fpu_copy+0x53>
+f0104c5e:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104c64:	8b 70 04             	mov    0x4(%eax),%esi
+f0104c67:	81 c7 40 01 00 00    	add    $0x140,%edi
+f0104c6d:	81 c6 40 01 00 00    	add    $0x140,%esi
+f0104c73:	b9 80 00 00 00       	mov    $0x80,%ecx
+f0104c78:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0104c7a:	5e                   	pop    %esi
+f0104c7b:	5f                   	pop    %edi
+f0104c7c:	5d                   	pop    %ebp
+f0104c7d:	c3                   	ret
+f0104c7e:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104c84:	8b 40 04             	mov    0x4(%eax),%eax
+f0104c87:	0f ae 80 40 01 00 00 	fxsave 0x140(%eax)
+f0104c8e:	eb b4                	jmp    f0104c44 <env_fpu_copy+0x1d>
+
+f0104c90 <env_run>:
+f0104c90:	55                   	push   %ebp
+f0104c91:	89 e5                	mov    %esp,%ebp
+f0104c93:	57                   	push   %edi
+f0104c94:	56                   	push   %esi
+f0104c95:	53                   	push   %ebx
+f0104c96:	83 ec 0c             	sub    $0xc,%esp
+f0104c99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0104c9c:	65 8b 35 00 00 00 00 	mov    %gs:0x0,%esi
+f0104ca3:	f6 05 f4 73 11 f0 01 	testb  $0x1,0xf01173f4
+f0104caa:	0f 85 8b 00 00 00    	jne    f0104d3b <env_run+0xab>
+f0104cb0:	a1 64 24 1a f0       	mov    0xf01a2464,%eax
+f0104cb5:	0b 05 60 24 1a f0    	or     0xf01a2460,%eax
+f0104cbb:	0f 84 98 00 00 00    	je     f0104d59 <env_run+0xc9>
+f0104cc1:	39 5e 04             	cmp    %ebx,0x4(%esi)
+f0104cc4:	0f 84 a1 00 00 00    	je     f0104d6b <env_run+0xdb>
+f0104cca:	e8 c2 fd ff ff       	call   f0104a91 <env_save_state>
+f0104ccf:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104cd5:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0104cd9:	74 12                	je     f0104ced <env_run+0x5d>
+f0104cdb:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104ce1:	8b 40 04             	mov    0x4(%eax),%eax
+f0104ce4:	83 38 03             	cmpl   $0x3,(%eax)
+f0104ce7:	0f 84 ae 00 00 00    	je     f0104d9b <env_run+0x10b>
+f0104ced:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104cf3:	89 58 04             	mov    %ebx,0x4(%eax)
+f0104cf6:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+f0104cfc:	83 83 c4 00 00 00 01 	addl   $0x1,0xc4(%ebx)
+f0104d03:	8b 43 50             	mov    0x50(%ebx),%eax
+f0104d06:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0104d0b:	0f 86 9e 00 00 00    	jbe    f0104daf <env_run+0x11f>
+f0104d11:	05 00 00 00 10       	add    $0x10000000,%eax
+f0104d16:	0f 22 d8             	mov    %eax,%cr3
+f0104d19:	83 ec 0c             	sub    $0xc,%esp
+f0104d1c:	53                   	push   %ebx
+f0104d1d:	e8 1e 37 00 00       	call   f0108440 <pmu_restore>
+f0104d22:	c7 04 24 00 74 11 f0 	movl   $0xf0117400,(%esp)
+f0104d29:	e8 0f 4c 00 00       	call   f010993d <spin_unlock>
+f0104d2e:	f3 90                	pause
+f0104d30:	83 eb 80             	sub    $0xffffff80,%ebx
+f0104d33:	89 1c 24             	mov    %ebx,(%esp)
+f0104d36:	e8 98 fc ff ff       	call   f01049d3 <env_pop_tf>
+f0104d3b:	6a 00                	push   $0x0
+f0104d3d:	8b 83 c4 00 00 00    	mov    0xc4(%ebx),%eax
+f0104d43:	83 c0 01             	add    $0x1,%eax
+f0104d46:	50                   	push   %eax
+f0104d47:	ff 73 40             	push   0x40(%ebx)
+f0104d4a:	6a 00                	push   $0x0
+f0104d4c:	e8 02 2c 00 00       	call   f0107953 <ktrace_record>
+f0104d51:	83 c4 10             	add    $0x10,%esp
+f0104d54:	e9 57 ff ff ff       	jmp    f0104cb0 <env_run+0x20>
+f0104d59:	83 ec 0c             	sub    $0xc,%esp
+f0104d5c:	6a 08                	push   $0x8
+f0104d5e:	e8 e6 b2 ff ff       	call   f0100049 <boot_phase>
+f0104d63:	83 c4 10             	add    $0x10,%esp
+f0104d66:	e9 56 ff ff ff       	jmp    f0104cc1 <env_run+0x31>
+f0104d6b:	8b 7e 08             	mov    0x8(%esi),%edi
+f0104d6e:	85 ff                	test   %edi,%edi
+f0104d70:	0f 84 54 ff ff ff    	je     f0104cca <env_run+0x3a>
+f0104d76:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+f0104d7d:	83 83 c4 00 00 00 01 	addl   $0x1,0xc4(%ebx)
+f0104d84:	83 ec 0c             	sub    $0xc,%esp
+f0104d87:	68 00 74 11 f0       	push   $0xf0117400
+f0104d8c:	e8 ac 4b 00 00       	call   f010993d <spin_unlock>
+f0104d91:	f3 90                	pause
+f0104d93:	89 3c 24             	mov    %edi,(%esp)
+f0104d96:	e8 38 fc ff ff       	call   f01049d3 <env_pop_tf>
+f0104d9b:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104da1:	8b 40 04             	mov    0x4(%eax),%eax
+f0104da4:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+f0104daa:	e9 3e ff ff ff       	jmp    f0104ced <env_run+0x5d>
+f0104daf:	50                   	push   %eax
+f0104db0:	68 08 9e 10 f0       	push   $0xf0109e08
+f0104db5:	68 11 03 00 00       	push   $0x311
+f0104dba:	68 0f b5 10 f0       	push   $0xf010b50f
+f0104dbf:	e8 67 b3 ff ff       	call   f010012b <_panic>
+
+f0104dc4 <mc146818_read>:
+f0104dc4:	55                   	push   %ebp
+f0104dc5:	89 e5                	mov    %esp,%ebp
+f0104dc7:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104dca:	ba 70 00 00 00       	mov    $0x70,%edx
+f0104dcf:	ee                   	out    %al,(%dx)
+f0104dd0:	ba 71 00 00 00       	mov    $0x71,%edx
+f0104dd5:	ec                   	in     (%dx),%al
+f0104dd6:	0f b6 c0             	movzbl %al,%eax
+f0104dd9:	5d                   	pop    %ebp
+f0104dda:	c3                   	ret
+
+f0104ddb <mc146818_write>:
+f0104ddb:	55                   	push   %ebp
+f0104ddc:	89 e5                	mov    %esp,%ebp
+f0104dde:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104de1:	ba 70 00 00 00       	mov    $0x70,%edx
+f0104de6:	ee                   	out    %al,(%dx)
+f0104de7:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0104dea:	ba 71 00 00 00       	mov    $0x71,%edx
+f0104def:	ee                   	out    %al,(%dx)
+f0104df0:	5d                   	pop    %ebp
+f0104df1:	c3                   	ret
+
+f0104df2 <tsc_calibrate>:
+f0104df2:	55                   	push   %ebp
+f0104df3:	89 e5                	mov    %esp,%ebp
+f0104df5:	57                   	push   %edi
+f0104df6:	56                   	push   %esi
+f0104df7:	53                   	push   %ebx
+f0104df8:	83 ec 1c             	sub    $0x1c,%esp
+f0104dfb:	ba 61 00 00 00       	mov    $0x61,%edx
+f0104e00:	ec                   	in     (%dx),%al
+f0104e01:	83 e0 fc             	and    $0xfffffffc,%eax
+f0104e04:	83 c8 01             	or     $0x1,%eax
+f0104e07:	ee                   	out    %al,(%dx)
+f0104e08:	b8 b0 ff ff ff       	mov    $0xffffffb0,%eax
+f0104e0d:	ba 43 00 00 00       	mov    $0x43,%edx
+f0104e12:	ee                   	out    %al,(%dx)
+f0104e13:	ba 42 00 00 00       	mov    $0x42,%edx
+f0104e18:	b8 9b ff ff ff       	mov    $0xffffff9b,%eax
+f0104e1d:	ee                   	out    %al,(%dx)
+f0104e1e:	b8 2e 00 00 00       	mov    $0x2e,%eax
+f0104e23:	ee                   	out    %al,(%dx)
+f0104e24:	0f 31                	rdtsc
+f0104e26:	89 c6                	mov    %eax,%esi
+f0104e28:	89 d7                	mov    %edx,%edi
+f0104e2a:	b9 00 09 3d 00       	mov    $0x3d0900,%ecx
+f0104e2f:	ba 61 00 00 00       	mov    $0x61,%edx
+f0104e34:	ec                   	in     (%dx),%al
+f0104e35:	a8 20                	test   $0x20,%al
+f0104e37:	75 17                	jne    f0104e50 <tsc_calibrate+0x5e>
+f0104e39:	83 e9 01             	sub    $0x1,%ecx
+f0104e3c:	75 f6                	jne    f0104e34 <tsc_calibrate+0x42>
+f0104e3e:	83 ec 0c             	sub    $0xc,%esp
+f0104e41:	68 60 b5 10 f0       	push   $0xf010b560
+f0104e46:	e8 d8 01 00 00       	call   f0105023 <cprintf>
+f0104e4b:	83 c4 10             	add    $0x10,%esp
+f0104e4e:	eb 69                	jmp    f0104eb9 <tsc_calibrate+0xc7>
+f0104e50:	0f 31                	rdtsc
+f0104e52:	29 f0                	sub    %esi,%eax
+f0104e54:	19 fa                	sbb    %edi,%edx
+f0104e56:	89 c1                	mov    %eax,%ecx
+f0104e58:	89 d3                	mov    %edx,%ebx
+f0104e5a:	89 c7                	mov    %eax,%edi
+f0104e5c:	01 d7                	add    %edx,%edi
+f0104e5e:	83 d7 00             	adc    $0x0,%edi
+f0104e61:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+f0104e66:	89 f8                	mov    %edi,%eax
+f0104e68:	f7 e6                	mul    %esi
+f0104e6a:	89 d0                	mov    %edx,%eax
+f0104e6c:	c1 e8 02             	shr    $0x2,%eax
+f0104e6f:	83 e2 fc             	and    $0xfffffffc,%edx
+f0104e72:	01 c2                	add    %eax,%edx
+f0104e74:	29 d7                	sub    %edx,%edi
+f0104e76:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104e7b:	29 f9                	sub    %edi,%ecx
+f0104e7d:	19 d3                	sbb    %edx,%ebx
+f0104e7f:	89 da                	mov    %ebx,%edx
+f0104e81:	69 db cd cc cc cc    	imul   $0xcccccccd,%ebx,%ebx
+f0104e87:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+f0104e8a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0104e8d:	69 45 e0 cc cc cc cc 	imul   $0xcccccccc,-0x20(%ebp),%eax
+f0104e94:	01 c3                	add    %eax,%ebx
+f0104e96:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0104e99:	f7 e6                	mul    %esi
+f0104e9b:	01 da                	add    %ebx,%edx
+f0104e9d:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+f0104ea1:	d1 ea                	shr    %edx
+f0104ea3:	a3 64 39 1a f0       	mov    %eax,0xf01a3964
+f0104ea8:	83 ec 08             	sub    $0x8,%esp
+f0104eab:	50                   	push   %eax
+f0104eac:	68 84 b5 10 f0       	push   $0xf010b584
+f0104eb1:	e8 6d 01 00 00       	call   f0105023 <cprintf>
+f0104eb6:	83 c4 10             	add    $0x10,%esp
+f0104eb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104ebc:	5b                   	pop    %ebx
+f0104ebd:	5e                   	pop    %esi
+f0104ebe:	5f                   	pop    %edi
+f0104ebf:	5d                   	pop    %ebp
+f0104ec0:	c3                   	ret
+
+f0104ec1 <irq_setmask_8259A>:
+f0104ec1:	55                   	push   %ebp
+f0104ec2:	89 e5                	mov    %esp,%ebp
+f0104ec4:	56                   	push   %esi
+f0104ec5:	53                   	push   %ebx
+f0104ec6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0104ec9:	66 89 0d e8 73 11 f0 	mov    %cx,0xf01173e8
+f0104ed0:	80 3d 68 39 1a f0 00 	cmpb   $0x0,0xf01a3968
+f0104ed7:	75 07                	jne    f0104ee0 <irq_setmask_8259A+0x1f>
+f0104ed9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0104edc:	5b                   	pop    %ebx
+f0104edd:	5e                   	pop    %esi
+f0104ede:	5d                   	pop    %ebp
+f0104edf:	c3                   	ret
+f0104ee0:	89 ce                	mov    %ecx,%esi
+f0104ee2:	ba 21 00 00 00       	mov    $0x21,%edx
+f0104ee7:	89 c8                	mov    %ecx,%eax
+f0104ee9:	ee                   	out    %al,(%dx)
+f0104eea:	89 c8                	mov    %ecx,%eax
+f0104eec:	66 c1 e8 08          	shr    $0x8,%ax
+f0104ef0:	ba a1 00 00 00       	mov    $0xa1,%edx
+f0104ef5:	ee                   	out    %al,(%dx)
+f0104ef6:	83 ec 0c             	sub    $0xc,%esp
+f0104ef9:	68 91 b5 10 f0       	push   $0xf010b591
+f0104efe:	e8 20 01 00 00       	call   f0105023 <cprintf>
+f0104f03:	83 c4 10             	add    $0x10,%esp
+f0104f06:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104f0b:	0f b7 f6             	movzwl %si,%esi
+f0104f0e:	f7 d6                	not    %esi
+f0104f10:	eb 08                	jmp    f0104f1a <irq_setmask_8259A+0x59>
+f0104f12:	83 c3 01             	add    $0x1,%ebx
+f0104f15:	83 fb 10             	cmp    $0x10,%ebx
+f0104f18:	74 18                	je     f0104f32 <irq_setmask_8259A+0x71>
+f0104f1a:	0f a3 de             	bt     %ebx,%esi
+f0104f1d:	73 f3                	jae    f0104f12 <irq_setmask_8259A+0x51>
+f0104f1f:	83 ec 08             	sub    $0x8,%esp
+f0104f22:	53                   	push   %ebx
+f0104f23:	68 5d bf 10 f0       	push   $0xf010bf5d
+f0104f28:	e8 f6 00 00 00       	call   f0105023 <cprintf>
+f0104f2d:	83 c4 10             	add    $0x10,%esp
+f0104f30:	eb e0                	jmp    f0104f12 <irq_setmask_8259A+0x51>
+f0104f32:	83 ec 0c             	sub    $0xc,%esp
+f0104f35:	68 50 b1 10 f0       	push   $0xf010b150
+f0104f3a:	e8 e4 00 00 00       	call   f0105023 <cprintf>
+f0104f3f:	83 c4 10             	add    $0x10,%esp
+f0104f42:	eb 95                	jmp    f0104ed9 <irq_setmask_8259A+0x18>
+
+f0104f44 <pic_init>:
+f0104f44:	55                   	push   %ebp
+f0104f45:	89 e5                	mov    %esp,%ebp
+f0104f47:	57                   	push   %edi
+f0104f48:	56                   	push   %esi
+f0104f49:	53                   	push   %ebx
+f0104f4a:	83 ec 0c             	sub    $0xc,%esp
+f0104f4d:	c6 05 68 39 1a f0 01 	movb   $0x1,0xf01a3968
+f0104f54:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0104f59:	bb 21 00 00 00       	mov    $0x21,%ebx
+f0104f5e:	89 da                	mov    %ebx,%edx
+f0104f60:	ee                   	out    %al,(%dx)
+f0104f61:	b9 a1 00 00 00       	mov    $0xa1,%ecx
+f0104f66:	89 ca                	mov    %ecx,%edx
+f0104f68:	ee                   	out    %al,(%dx)
+f0104f69:	bf 11 00 00 00       	mov    $0x11,%edi
+f0104f6e:	be 20 00 00 00       	mov    $0x20,%esi
+f0104f73:	89 f8                	mov    %edi,%eax
+f0104f75:	89 f2                	mov    %esi,%edx
+f0104f77:	ee                   	out    %al,(%dx)
+f0104f78:	b8 20 00 00 00       	mov    $0x20,%eax
+f0104f7d:	89 da                	mov    %ebx,%edx
+f0104f7f:	ee                   	out    %al,(%dx)
+f0104f80:	b8 04 00 00 00       	mov    $0x4,%eax
+f0104f85:	ee                   	out    %al,(%dx)
+f0104f86:	b8 03 00 00 00       	mov    $0x3,%eax
+f0104f8b:	ee                   	out    %al,(%dx)
+f0104f8c:	bb a0 00 00 00       	mov    $0xa0,%ebx
+f0104f91:	89 f8                	mov    %edi,%eax
+f0104f93:	89 da                	mov    %ebx,%edx
+f0104f95:	ee                   	out    %al,(%dx)
+f0104f96:	b8 28 00 00 00       	mov    $0x28,%eax
+f0104f9b:	89 ca                	mov    %ecx,%edx
+f0104f9d:	ee                   	out    %al,(%dx)
+f0104f9e:	b8 02 00 00 00       	mov    $0x2,%eax
+f0104fa3:	ee                   	out    %al,(%dx)
+f0104fa4:	b8 01 00 00 00       	mov    $0x1,%eax
+f0104fa9:	ee                   	out    %al,(%dx)
+f0104faa:	bf 68 00 00 00       	mov    $0x68,%edi
+f0104faf:	89 f8                	mov    %edi,%eax
+f0104fb1:	89 f2                	mov    %esi,%edx
+f0104fb3:	ee                   	out    %al,(%dx)
+f0104fb4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+f0104fb9:	89 c8                	mov    %ecx,%eax
+f0104fbb:	ee                   	out    %al,(%dx)
+f0104fbc:	89 f8                	mov    %edi,%eax
+f0104fbe:	89 da                	mov    %ebx,%edx
+f0104fc0:	ee                   	out    %al,(%dx)
+f0104fc1:	89 c8                	mov    %ecx,%eax
+f0104fc3:	ee                   	out    %al,(%dx)
+f0104fc4:	0f b7 05 e8 73 11 f0 	movzwl 0xf01173e8,%eax
+f0104fcb:	66 83 f8 ff          	cmp    $0xffff,%ax
+f0104fcf:	75 08                	jne    f0104fd9 <pic_init+0x95>
+f0104fd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104fd4:	5b                   	pop    %ebx
+f0104fd5:	5e                   	pop    %esi
+f0104fd6:	5f                   	pop    %edi
+f0104fd7:	5d                   	pop    %ebp
+f0104fd8:	c3                   	ret
+f0104fd9:	83 ec 0c             	sub    $0xc,%esp
+f0104fdc:	0f b7 c0             	movzwl %ax,%eax
+f0104fdf:	50                   	push   %eax
+f0104fe0:	e8 dc fe ff ff       	call   f0104ec1 <irq_setmask_8259A>
+f0104fe5:	83 c4 10             	add    $0x10,%esp
+f0104fe8:	eb e7                	jmp    f0104fd1 <pic_init+0x8d>
+
+f0104fea <putch>:
+f0104fea:	55                   	push   %ebp
+f0104feb:	89 e5                	mov    %esp,%ebp
+f0104fed:	83 ec 14             	sub    $0x14,%esp
+f0104ff0:	ff 75 08             	push   0x8(%ebp)
+f0104ff3:	e8 91 bb ff ff       	call   f0100b89 <cputchar>
+f0104ff8:	83 c4 10             	add    $0x10,%esp
+f0104ffb:	c9                   	leave
+f0104ffc:	c3                   	ret
+
+f0104ffd <vcprintf>:
+f0104ffd:	55                   	push   %ebp
+f0104ffe:	89 e5                	mov    %esp,%ebp
+f0105000:	83 ec 18             	sub    $0x18,%esp
+f0105003:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+f010500a:	ff 75 0c             	push   0xc(%ebp)
+f010500d:	ff 75 08             	push   0x8(%ebp)
+f0105010:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0105013:	50                   	push   %eax
+f0105014:	68 ea 4f 10 f0       	push   $0xf0104fea
+f0105019:	e8 da 36 00 00       	call   f01086f8 <vprintfmt>
+f010501e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0105021:	c9                   	leave
+f0105022:	c3                   	ret
+
+f0105023 <cprintf>:
+f0105023:	55                   	push   %ebp
+f0105024:	89 e5                	mov    %esp,%ebp
+f0105026:	83 ec 10             	sub    $0x10,%esp
+f0105029:	8d 45 0c             	lea    0xc(%ebp),%eax
+f010502c:	50                   	push   %eax
+f010502d:	ff 75 08             	push   0x8(%ebp)
+f0105030:	e8 c8 ff ff ff       	call   f0104ffd <vcprintf>
+f0105035:	c9                   	leave
+f0105036:	c3                   	ret
+
+f0105037 <trap_init_percpu>:
+f0105037:	55                   	push   %ebp
+f0105038:	89 e5                	mov    %esp,%ebp
+f010503a:	53                   	push   %ebx
+f010503b:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105041:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+f0105048:	0f b6 50 15          	movzbl 0x15(%eax),%edx
+f010504c:	c1 e2 10             	shl    $0x10,%edx
+f010504f:	b8 00 00 00 f0       	mov    $0xf0000000,%eax
+f0105054:	29 d0                	sub    %edx,%eax
+f0105056:	89 41 20             	mov    %eax,0x20(%ecx)
+f0105059:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010505f:	66 c7 40 24 10 00    	movw   $0x10,0x24(%eax)
+f0105065:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010506b:	66 c7 80 82 00 00 00 	movw   $0x68,0x82(%eax)
+f0105072:	68 00 
+f0105074:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010507a:	0f b6 40 15          	movzbl 0x15(%eax),%eax
+f010507e:	83 c0 05             	add    $0x5,%eax
+f0105081:	65 8b 1d 00 00 00 00 	mov    %gs:0x0,%ebx
+f0105088:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+f010508f:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0105096:	66 c7 04 c5 40 73 11 	movw   $0x67,-0xfee8cc0(,%eax,8)
+f010509d:	f0 67 00 
+f01050a0:	83 c3 1c             	add    $0x1c,%ebx
+f01050a3:	66 89 1c c5 42 73 11 	mov    %bx,-0xfee8cbe(,%eax,8)
+f01050aa:	f0 
+f01050ab:	83 c1 1c             	add    $0x1c,%ecx
+f01050ae:	c1 e9 10             	shr    $0x10,%ecx
+f01050b1:	88 0c c5 44 73 11 f0 	mov    %cl,-0xfee8cbc(,%eax,8)
+f01050b8:	c6 04 c5 45 73 11 f0 	movb   $0x99,-0xfee8cbb(,%eax,8)
+f01050bf:	99 
+f01050c0:	c6 04 c5 46 73 11 f0 	movb   $0x40,-0xfee8cba(,%eax,8)
+f01050c7:	40 
+f01050c8:	83 c2 1c             	add    $0x1c,%edx
+f01050cb:	c1 ea 18             	shr    $0x18,%edx
+f01050ce:	88 14 c5 47 73 11 f0 	mov    %dl,-0xfee8cb9(,%eax,8)
+f01050d5:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01050db:	0f b6 40 15          	movzbl 0x15(%eax),%eax
+f01050df:	80 24 c5 6d 73 11 f0 	andb   $0xef,-0xfee8c93(,%eax,8)
+f01050e6:	ef 
+f01050e7:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01050ed:	0f b6 40 15          	movzbl 0x15(%eax),%eax
+f01050f1:	8d 04 c5 28 00 00 00 	lea    0x28(,%eax,8),%eax
+f01050f8:	0f 00 d8             	ltr    %ax
+f01050fb:	b8 ec 73 11 f0       	mov    $0xf01173ec,%eax
+f0105100:	0f 01 18             	lidtl  (%eax)
+f0105103:	b8 01 00 00 00       	mov    $0x1,%eax
+f0105108:	0f a2                	cpuid
+f010510a:	f6 c6 08             	test   $0x8,%dh
+f010510d:	74 37                	je     f0105146 <trap_init_percpu+0x10f>
+f010510f:	b9 74 01 00 00       	mov    $0x174,%ecx
+f0105114:	b8 08 00 00 00       	mov    $0x8,%eax
+f0105119:	ba 00 00 00 00       	mov    $0x0,%edx
+f010511e:	0f 30                	wrmsr
+f0105120:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105126:	8b 40 20             	mov    0x20(%eax),%eax
+f0105129:	ba 00 00 00 00       	mov    $0x0,%edx
+f010512e:	b9 75 01 00 00       	mov    $0x175,%ecx
+f0105133:	0f 30                	wrmsr
+f0105135:	b9 76 01 00 00       	mov    $0x176,%ecx
+f010513a:	b8 98 5e 10 f0       	mov    $0xf0105e98,%eax
+f010513f:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105144:	0f 30                	wrmsr
+f0105146:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0105149:	c9                   	leave
+f010514a:	c3                   	ret
+
+f010514b <trap_init>:
+f010514b:	55                   	push   %ebp
+f010514c:	89 e5                	mov    %esp,%ebp
+f010514e:	83 ec 08             	sub    $0x8,%esp
+f0105151:	b8 6c 5d 10 f0       	mov    $0xf0105d6c,%eax
+f0105156:	66 a3 80 39 1a f0    	mov    %ax,0xf01a3980
+f010515c:	66 c7 05 82 39 1a f0 	movw   $0x8,0xf01a3982
+f0105163:	08 00 
+f0105165:	c6 05 84 39 1a f0 00 	movb   $0x0,0xf01a3984
+f010516c:	c6 05 85 39 1a f0 8e 	movb   $0x8e,0xf01a3985
+f0105173:	c1 e8 10             	shr    $0x10,%eax
+f0105176:	66 a3 86 39 1a f0    	mov    %ax,0xf01a3986
+f010517c:	b8 76 5d 10 f0       	mov    $0xf0105d76,%eax
+f0105181:	66 a3 88 39 1a f0    	mov    %ax,0xf01a3988
+f0105187:	66 c7 05 8a 39 1a f0 	movw   $0x8,0xf01a398a
+f010518e:	08 00 
+f0105190:	c6 05 8c 39 1a f0 00 	movb   $0x0,0xf01a398c
+f0105197:	c6 05 8d 39 1a f0 8e 	movb   $0x8e,0xf01a398d
+f010519e:	c1 e8 10             	shr    $0x10,%eax
+f01051a1:	66 a3 8e 39 1a f0    	mov    %ax,0xf01a398e
+f01051a7:	b8 80 5d 10 f0       	mov    $0xf0105d80,%eax
+f01051ac:	66 a3 90 39 1a f0    	mov    %ax,0xf01a3990
+f01051b2:	66 c7 05 92 39 1a f0 	movw   $0x8,0xf01a3992
+f01051b9:	08 00 
+f01051bb:	c6 05 94 39 1a f0 00 	movb   $0x0,0xf01a3994
+f01051c2:	c6 05 95 39 1a f0 8e 	movb   $0x8e,0xf01a3995
+f01051c9:	c1 e8 10             	shr    $0x10,%eax
+f01051cc:	66 a3 96 39 1a f0    	mov    %ax,0xf01a3996
+f01051d2:	b8 8a 5d 10 f0       	mov    $0xf0105d8a,%eax
+f01051d7:	66 a3 98 39 1a f0    	mov    %ax,0xf01a3998
+f01051dd:	66 c7 05 9a 39 1a f0 	movw   $0x8,0xf01a399a
+f01051e4:	08 00 
+f01051e6:	c6 05 9c 39 1a f0 00 	movb   $0x0,0xf01a399c
+f01051ed:	c6 05 9d 39 1a f0 ee 	movb   $0xee,0xf01a399d
+f01051f4:	c1 e8 10             	shr    $0x10,%eax
+f01051f7:	66 a3 9e 39 1a f0    	mov    %ax,0xf01a399e
+f01051fd:	b8 94 5d 10 f0       	mov    $0xf0105d94,%eax
+f0105202:	66 a3 a0 39 1a f0    	mov    %ax,0xf01a39a0
+f0105208:	66 c7 05 a2 39 1a f0 	movw   $0x8,0xf01a39a2
+f010520f:	08 00 
+f0105211:	c6 05 a4 39 1a f0 00 	movb   $0x0,0xf01a39a4
+f0105218:	c6 05 a5 39 1a f0 8e 	movb   $0x8e,0xf01a39a5
+f010521f:	c1 e8 10             	shr    $0x10,%eax
+f0105222:	66 a3 a6 39 1a f0    	mov    %ax,0xf01a39a6
+f0105228:	b8 9e 5d 10 f0       	mov    $0xf0105d9e,%eax
+f010522d:	66 a3 a8 39 1a f0    	mov    %ax,0xf01a39a8
+f0105233:	66 c7 05 aa 39 1a f0 	movw   $0x8,0xf01a39aa
+f010523a:	08 00 
+f010523c:	c6 05 ac 39 1a f0 00 	movb   $0x0,0xf01a39ac
+f0105243:	c6 05 ad 39 1a f0 8e 	movb   $0x8e,0xf01a39ad
+f010524a:	c1 e8 10             	shr    $0x10,%eax
+f010524d:	66 a3 ae 39 1a f0    	mov    %ax,0xf01a39ae
+f0105253:	b8 a8 5d 10 f0       	mov    $0xf0105da8,%eax
+f0105258:	66 a3 b0 39 1a f0    	mov    %ax,0xf01a39b0
+f010525e:	66 c7 05 b2 39 1a f0 	movw   $0x8,0xf01a39b2
+f0105265:	08 00 
+f0105267:	c6 05 b4 39 1a f0 00 	movb   $0x0,0xf01a39b4
+f010526e:	c6 05 b5 39 1a f0 8e 	movb   $0x8e,0xf01a39b5
+f0105275:	c1 e8 10             	shr    $0x10,%eax
+f0105278:	66 a3 b6 39 1a f0    	mov    %ax,0xf01a39b6
+f010527e:	b8 b2 5d 10 f0       	mov    $0xf0105db2,%eax
+f0105283:	66 a3 b8 39 1a f0    	mov    %ax,0xf01a39b8
+f0105289:	66 c7 05 ba 39 1a f0 	movw   $0x8,0xf01a39ba
+f0105290:	08 00 
+f0105292:	c6 05 bc 39 1a f0 00 	movb   $0x0,0xf01a39bc
+f0105299:	c6 05 bd 39 1a f0 8e 	movb   $0x8e,0xf01a39bd
+f01052a0:	c1 e8 10             	shr    $0x10,%eax
+f01052a3:	66 a3 be 39 1a f0    	mov    %ax,0xf01a39be
+f01052a9:	b8 bc 5d 10 f0       	mov    $0xf0105dbc,%eax
+f01052ae:	66 a3 c0 39 1a f0    	mov    %ax,0xf01a39c0
+f01052b4:	66 c7 05 c2 39 1a f0 	movw   $0x8,0xf01a39c2
+f01052bb:	08 00 
+f01052bd:	c6 05 c4 39 1a f0 00 	movb   $0x0,0xf01a39c4
+f01052c4:	c6 05 c5 39 1a f0 8e 	movb   $0x8e,0xf01a39c5
+f01052cb:	c1 e8 10             	shr    $0x10,%eax
+f01052ce:	66 a3 c6 39 1a f0    	mov    %ax,0xf01a39c6
+f01052d4:	b8 c4 5d 10 f0       	mov    $0xf0105dc4,%eax
+f01052d9:	66 a3 d0 39 1a f0    	mov    %ax,0xf01a39d0
+f01052df:	66 c7 05 d2 39 1a f0 	movw   $0x8,0xf01a39d2
+f01052e6:	08 00 
+f01052e8:	c6 05 d4 39 1a f0 00 	movb   $0x0,0xf01a39d4
+f01052ef:	c6 05 d5 39 1a f0 8e 	movb   $0x8e,0xf01a39d5
+f01052f6:	c1 e8 10             	shr    $0x10,%eax
+f01052f9:	66 a3 d6 39 1a f0    	mov    %ax,0xf01a39d6
+f01052ff:	b8 cc 5d 10 f0       	mov    $0xf0105dcc,%eax
+f0105304:	66 a3 d8 39 1a f0    	mov    %ax,0xf01a39d8
+f010530a:	66 c7 05 da 39 1a f0 	movw   $0x8,0xf01a39da
+f0105311:	08 00 
+f0105313:	c6 05 dc 39 1a f0 00 	movb   $0x0,0xf01a39dc
+f010531a:	c6 05 dd 39 1a f0 8e 	movb   $0x8e,0xf01a39dd
+f0105321:	c1 e8 10             	shr    $0x10,%eax
+f0105324:	66 a3 de 39 1a f0    	mov    %ax,0xf01a39de
+f010532a:	b8 d4 5d 10 f0       	mov    $0xf0105dd4,%eax
+f010532f:	66 a3 e0 39 1a f0    	mov    %ax,0xf01a39e0
+f0105335:	66 c7 05 e2 39 1a f0 	movw   $0x8,0xf01a39e2
+f010533c:	08 00 
+f010533e:	c6 05 e4 39 1a f0 00 	movb   $0x0,0xf01a39e4
+f0105345:	c6 05 e5 39 1a f0 8e 	movb   $0x8e,0xf01a39e5
+f010534c:	c1 e8 10             	shr    $0x10,%eax
+f010534f:	66 a3 e6 39 1a f0    	mov    %ax,0xf01a39e6
+f0105355:	b8 dc 5d 10 f0       	mov    $0xf0105ddc,%eax
+f010535a:	66 a3 e8 39 1a f0    	mov    %ax,0xf01a39e8
+f0105360:	66 c7 05 ea 39 1a f0 	movw   $0x8,0xf01a39ea
+f0105367:	08 00 
+f0105369:	c6 05 ec 39 1a f0 00 	movb   $0x0,0xf01a39ec
+f0105370:	c6 05 ed 39 1a f0 8e 	movb   $0x8e,0xf01a39ed
+f0105377:	c1 e8 10             	shr    $0x10,%eax
+f010537a:	66 a3 ee 39 1a f0    	mov    %ax,0xf01a39ee
+f0105380:	b8 e4 5d 10 f0       	mov    $0xf0105de4,%eax
+f0105385:	66 a3 f0 39 1a f0    	mov    %ax,0xf01a39f0
+f010538b:	66 c7 05 f2 39 1a f0 	movw   $0x8,0xf01a39f2
+f0105392:	08 00 
+f0105394:	c6 05 f4 39 1a f0 00 	movb   $0x0,0xf01a39f4
+f010539b:	c6 05 f5 39 1a f0 8e 	movb   $0x8e,0xf01a39f5
+f01053a2:	c1 e8 10             	shr    $0x10,%eax
+f01053a5:	66 a3 f6 39 1a f0    	mov    %ax,0xf01a39f6
+f01053ab:	b8 ec 5d 10 f0       	mov    $0xf0105dec,%eax
+f01053b0:	66 a3 00 3a 1a f0    	mov    %ax,0xf01a3a00
+f01053b6:	66 c7 05 02 3a 1a f0 	movw   $0x8,0xf01a3a02
+f01053bd:	08 00 
+f01053bf:	c6 05 04 3a 1a f0 00 	movb   $0x0,0xf01a3a04
+f01053c6:	c6 05 05 3a 1a f0 8e 	movb   $0x8e,0xf01a3a05
+f01053cd:	c1 e8 10             	shr    $0x10,%eax
+f01053d0:	66 a3 06 3a 1a f0    	mov    %ax,0xf01a3a06
+f01053d6:	b8 f6 5d 10 f0       	mov    $0xf0105df6,%eax
+f01053db:	66 a3 08 3a 1a f0    	mov    %ax,0xf01a3a08
+f01053e1:	66 c7 05 0a 3a 1a f0 	movw   $0x8,0xf01a3a0a
+f01053e8:	08 00 
+f01053ea:	c6 05 0c 3a 1a f0 00 	movb   $0x0,0xf01a3a0c
+f01053f1:	c6 05 0d 3a 1a f0 8e 	movb   $0x8e,0xf01a3a0d
+f01053f8:	c1 e8 10             	shr    $0x10,%eax
+f01053fb:	66 a3 0e 3a 1a f0    	mov    %ax,0xf01a3a0e
+f0105401:	b8 fe 5d 10 f0       	mov    $0xf0105dfe,%eax
+f0105406:	66 a3 10 3a 1a f0    	mov    %ax,0xf01a3a10
+f010540c:	66 c7 05 12 3a 1a f0 	movw   $0x8,0xf01a3a12
+f0105413:	08 00 
+f0105415:	c6 05 14 3a 1a f0 00 	movb   $0x0,0xf01a3a14
+f010541c:	c6 05 15 3a 1a f0 8e 	movb   $0x8e,0xf01a3a15
+f0105423:	c1 e8 10             	shr    $0x10,%eax
+f0105426:	66 a3 16 3a 1a f0    	mov    %ax,0xf01a3a16
+f010542c:	b8 08 5e 10 f0       	mov    $0xf0105e08,%eax
+f0105431:	66 a3 18 3a 1a f0    	mov    %ax,0xf01a3a18
+f0105437:	66 c7 05 1a 3a 1a f0 	movw   $0x8,0xf01a3a1a
+f010543e:	08 00 
+f0105440:	c6 05 1c 3a 1a f0 00 	movb   $0x0,0xf01a3a1c
+f0105447:	c6 05 1d 3a 1a f0 8e 	movb   $0x8e,0xf01a3a1d
+f010544e:	c1 e8 10             	shr    $0x10,%eax
+f0105451:	66 a3 1e 3a 1a f0    	mov    %ax,0xf01a3a1e
+f0105457:	b8 12 5e 10 f0       	mov    $0xf0105e12,%eax
+f010545c:	66 a3 00 3b 1a f0    	mov    %ax,0xf01a3b00
+f0105462:	66 c7 05 02 3b 1a f0 	movw   $0x8,0xf01a3b02
+f0105469:	08 00 
+f010546b:	c6 05 04 3b 1a f0 00 	movb   $0x0,0xf01a3b04
+f0105472:	c6 05 05 3b 1a f0 ee 	movb   $0xee,0xf01a3b05
+f0105479:	c1 e8 10             	shr    $0x10,%eax
+f010547c:	66 a3 06 3b 1a f0    	mov    %ax,0xf01a3b06
+f0105482:	b8 1c 5e 10 f0       	mov    $0xf0105e1c,%eax
+f0105487:	66 a3 20 49 1a f0    	mov    %ax,0xf01a4920
+f010548d:	66 c7 05 22 49 1a f0 	movw   $0x8,0xf01a4922
+f0105494:	08 00 
+f0105496:	c6 05 24 49 1a f0 00 	movb   $0x0,0xf01a4924
+f010549d:	c6 05 25 49 1a f0 8e 	movb   $0x8e,0xf01a4925
+f01054a4:	c1 e8 10             	shr    $0x10,%eax
+f01054a7:	66 a3 26 49 1a f0    	mov    %ax,0xf01a4926
+f01054ad:	b8 28 5e 10 f0       	mov    $0xf0105e28,%eax
+f01054b2:	66 a3 80 3a 1a f0    	mov    %ax,0xf01a3a80
+f01054b8:	66 c7 05 82 3a 1a f0 	movw   $0x8,0xf01a3a82
+f01054bf:	08 00 
+f01054c1:	c6 05 84 3a 1a f0 00 	movb   $0x0,0xf01a3a84
+f01054c8:	c6 05 85 3a 1a f0 8e 	movb   $0x8e,0xf01a3a85
+f01054cf:	c1 e8 10             	shr    $0x10,%eax
+f01054d2:	66 a3 86 3a 1a f0    	mov    %ax,0xf01a3a86
+f01054d8:	b8 32 5e 10 f0       	mov    $0xf0105e32,%eax
+f01054dd:	66 a3 88 3a 1a f0    	mov    %ax,0xf01a3a88
+f01054e3:	66 c7 05 8a 3a 1a f0 	movw   $0x8,0xf01a3a8a
+f01054ea:	08 00 
+f01054ec:	c6 05 8c 3a 1a f0 00 	movb   $0x0,0xf01a3a8c
+f01054f3:	c6 05 8d 3a 1a f0 8e 	movb   $0x8e,0xf01a3a8d
+f01054fa:	c1 e8 10             	shr    $0x10,%eax
+f01054fd:	66 a3 8e 3a 1a f0    	mov    %ax,0xf01a3a8e
+f0105503:	b8 3c 5e 10 f0       	mov    $0xf0105e3c,%eax
+f0105508:	66 a3 90 3a 1a f0    	mov    %ax,0xf01a3a90
+f010550e:	66 c7 05 92 3a 1a f0 	movw   $0x8,0xf01a3a92
+f0105515:	08 00 
+f0105517:	c6 05 94 3a 1a f0 00 	movb   $0x0,0xf01a3a94
+f010551e:	c6 05 95 3a 1a f0 8e 	movb   $0x8e,0xf01a3a95
+f0105525:	c1 e8 10             	shr    $0x10,%eax
+f0105528:	66 a3 96 3a 1a f0    	mov    %ax,0xf01a3a96
+f010552e:	b8 46 5e 10 f0       	mov    $0xf0105e46,%eax
+f0105533:	66 a3 98 3a 1a f0    	mov    %ax,0xf01a3a98
+f0105539:	66 c7 05 9a 3a 1a f0 	movw   $0x8,0xf01a3a9a
+f0105540:	08 00 
+f0105542:	c6 05 9c 3a 1a f0 00 	movb   $0x0,0xf01a3a9c
+f0105549:	c6 05 9d 3a 1a f0 8e 	movb   $0x8e,0xf01a3a9d
+f0105550:	c1 e8 10             	shr    $0x10,%eax
+f0105553:	66 a3 9e 3a 1a f0    	mov    %ax,0xf01a3a9e
+f0105559:	b8 50 5e 10 f0       	mov    $0xf0105e50,%eax
+f010555e:	66 a3 a0 3a 1a f0    	mov    %ax,0xf01a3aa0
+f0105564:	66 c7 05 a2 3a 1a f0 	movw   $0x8,0xf01a3aa2
+f010556b:	08 00 
+f010556d:	c6 05 a4 3a 1a f0 00 	movb   $0x0,0xf01a3aa4
+f0105574:	c6 05 a5 3a 1a f0 8e 	movb   $0x8e,0xf01a3aa5
+f010557b:	c1 e8 10             	shr    $0x10,%eax
+f010557e:	66 a3 a6 3a 1a f0    	mov    %ax,0xf01a3aa6
+f0105584:	b8 56 5e 10 f0       	mov    $0xf0105e56,%eax
+f0105589:	66 a3 a8 3a 1a f0    	mov    %ax,0xf01a3aa8
+f010558f:	66 c7 05 aa 3a 1a f0 	movw   $0x8,0xf01a3aaa
+f0105596:	08 00 
+f0105598:	c6 05 ac 3a 1a f0 00 	movb   $0x0,0xf01a3aac
+f010559f:	c6 05 ad 3a 1a f0 8e 	movb   $0x8e,0xf01a3aad
+f01055a6:	c1 e8 10             	shr    $0x10,%eax
+f01055a9:	66 a3 ae 3a 1a f0    	mov    %ax,0xf01a3aae
+f01055af:	b8 5c 5e 10 f0       	mov    $0xf0105e5c,%eax
+f01055b4:	66 a3 b0 3a 1a f0    	mov    %ax,0xf01a3ab0
+f01055ba:	66 c7 05 b2 3a 1a f0 	movw   $0x8,0xf01a3ab2
+f01055c1:	08 00 
+f01055c3:	c6 05 b4 3a 1a f0 00 	movb   $0x0,0xf01a3ab4
+f01055ca:	c6 05 b5 3a 1a f0 8e 	movb   $0x8e,0xf01a3ab5
+f01055d1:	c1 e8 10             	shr    $0x10,%eax
+f01055d4:	66 a3 b6 3a 1a f0    	mov    %ax,0xf01a3ab6
+f01055da:	b8 62 5e 10 f0       	mov    $0xf0105e62,%eax
+f01055df:	66 a3 b8 3a 1a f0    	mov    %ax,0xf01a3ab8
+f01055e5:	66 c7 05 ba 3a 1a f0 	movw   $0x8,0xf01a3aba
+f01055ec:	08 00 
+f01055ee:	c6 05 bc 3a 1a f0 00 	movb   $0x0,0xf01a3abc
+f01055f5:	c6 05 bd 3a 1a f0 8e 	movb   $0x8e,0xf01a3abd
+f01055fc:	c1 e8 10             	shr    $0x10,%eax
+f01055ff:	66 a3 be 3a 1a f0    	mov    %ax,0xf01a3abe
+f0105605:	b8 68 5e 10 f0       	mov    $0xf0105e68,%eax
+f010560a:	66 a3 c0 3a 1a f0    	mov    %ax,0xf01a3ac0
+f0105610:	66 c7 05 c2 3a 1a f0 	movw   $0x8,0xf01a3ac2
+f0105617:	08 00 
+f0105619:	c6 05 c4 3a 1a f0 00 	movb   $0x0,0xf01a3ac4
+f0105620:	c6 05 c5 3a 1a f0 8e 	movb   $0x8e,0xf01a3ac5
+f0105627:	c1 e8 10             	shr    $0x10,%eax
+f010562a:	66 a3 c6 3a 1a f0    	mov    %ax,0xf01a3ac6
+f0105630:	b8 6e 5e 10 f0       	mov    $0xf0105e6e,%eax
+f0105635:	66 a3 c8 3a 1a f0    	mov    %ax,0xf01a3ac8
+f010563b:	66 c7 05 ca 3a 1a f0 	movw   $0x8,0xf01a3aca
+f0105642:	08 00 
+f0105644:	c6 05 cc 3a 1a f0 00 	movb   $0x0,0xf01a3acc
+f010564b:	c6 05 cd 3a 1a f0 8e 	movb   $0x8e,0xf01a3acd
+f0105652:	c1 e8 10             	shr    $0x10,%eax
+f0105655:	66 a3 ce 3a 1a f0    	mov    %ax,0xf01a3ace
+f010565b:	b8 74 5e 10 f0       	mov    $0xf0105e74,%eax
+f0105660:	66 a3 d0 3a 1a f0    	mov    %ax,0xf01a3ad0
+f0105666:	66 c7 05 d2 3a 1a f0 	movw   $0x8,0xf01a3ad2
+f010566d:	08 00 
+f010566f:	c6 05 d4 3a 1a f0 00 	movb   $0x0,0xf01a3ad4
+f0105676:	c6 05 d5 3a 1a f0 8e 	movb   $0x8e,0xf01a3ad5
+f010567d:	c1 e8 10             	shr    $0x10,%eax
+f0105680:	66 a3 d6 3a 1a f0    	mov    %ax,0xf01a3ad6
+f0105686:	b8 7a 5e 10 f0       	mov    $0xf0105e7a,%eax
+f010568b:	66 a3 d8 3a 1a f0    	mov    %ax,0xf01a3ad8
+f0105691:	66 c7 05 da 3a 1a f0 	movw   $0x8,0xf01a3ada
+f0105698:	08 00 
+f010569a:	c6 05 dc 3a 1a f0 00 	movb   $0x0,0xf01a3adc
+f01056a1:	c6 05 dd 3a 1a f0 8e 	movb   $0x8e,0xf01a3add
+f01056a8:	c1 e8 10             	shr    $0x10,%eax
+f01056ab:	66 a3 de 3a 1a f0    	mov    %ax,0xf01a3ade
+f01056b1:	b8 80 5e 10 f0       	mov    $0xf0105e80,%eax
+f01056b6:	66 a3 e0 3a 1a f0    	mov    %ax,0xf01a3ae0
+f01056bc:	66 c7 05 e2 3a 1a f0 	movw   $0x8,0xf01a3ae2
+f01056c3:	08 00 
+f01056c5:	c6 05 e4 3a 1a f0 00 	movb   $0x0,0xf01a3ae4
+f01056cc:	c6 05 e5 3a 1a f0 8e 	movb   $0x8e,0xf01a3ae5
+f01056d3:	c1 e8 10             	shr    $0x10,%eax
+f01056d6:	66 a3 e6 3a 1a f0    	mov    %ax,0xf01a3ae6
+f01056dc:	b8 86 5e 10 f0       	mov    $0xf0105e86,%eax
+f01056e1:	66 a3 e8 3a 1a f0    	mov    %ax,0xf01a3ae8
+f01056e7:	66 c7 05 ea 3a 1a f0 	movw   $0x8,0xf01a3aea
+f01056ee:	08 00 
+f01056f0:	c6 05 ec 3a 1a f0 00 	movb   $0x0,0xf01a3aec
+f01056f7:	c6 05 ed 3a 1a f0 8e 	movb   $0x8e,0xf01a3aed
+f01056fe:	c1 e8 10             	shr    $0x10,%eax
+f0105701:	66 a3 ee 3a 1a f0    	mov    %ax,0xf01a3aee
+f0105707:	b8 8c 5e 10 f0       	mov    $0xf0105e8c,%eax
+f010570c:	66 a3 f0 3a 1a f0    	mov    %ax,0xf01a3af0
+f0105712:	66 c7 05 f2 3a 1a f0 	movw   $0x8,0xf01a3af2
+f0105719:	08 00 
+f010571b:	c6 05 f4 3a 1a f0 00 	movb   $0x0,0xf01a3af4
+f0105722:	c6 05 f5 3a 1a f0 8e 	movb   $0x8e,0xf01a3af5
+f0105729:	c1 e8 10             	shr    $0x10,%eax
+f010572c:	66 a3 f6 3a 1a f0    	mov    %ax,0xf01a3af6
+f0105732:	b8 92 5e 10 f0       	mov    $0xf0105e92,%eax
+f0105737:	66 a3 f8 3a 1a f0    	mov    %ax,0xf01a3af8
+f010573d:	66 c7 05 fa 3a 1a f0 	movw   $0x8,0xf01a3afa
+f0105744:	08 00 
+f0105746:	c6 05 fc 3a 1a f0 00 	movb   $0x0,0xf01a3afc
+f010574d:	c6 05 fd 3a 1a f0 8e 	movb   $0x8e,0xf01a3afd
+f0105754:	c1 e8 10             	shr    $0x10,%eax
+f0105757:	66 a3 fe 3a 1a f0    	mov    %ax,0xf01a3afe
+f010575d:	e8 d5 f8 ff ff       	call   f0105037 <trap_init_percpu>
+f0105762:	c9                   	leave
+f0105763:	c3                   	ret
+
+f0105764 <print_regs>:
+f0105764:	55                   	push   %ebp
+f0105765:	89 e5                	mov    %esp,%ebp
+f0105767:	53                   	push   %ebx
+f0105768:	83 ec 0c             	sub    $0xc,%esp
+f010576b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010576e:	ff 33                	push   (%ebx)
+f0105770:	68 a5 b5 10 f0       	push   $0xf010b5a5
+f0105775:	e8 a9 f8 ff ff       	call   f0105023 <cprintf>
+f010577a:	83 c4 08             	add    $0x8,%esp
+f010577d:	ff 73 04             	push   0x4(%ebx)
+f0105780:	68 b4 b5 10 f0       	push   $0xf010b5b4
+f0105785:	e8 99 f8 ff ff       	call   f0105023 <cprintf>
+f010578a:	83 c4 08             	add    $0x8,%esp
+f010578d:	ff 73 08             	push   0x8(%ebx)
+f0105790:	68 c3 b5 10 f0       	push   $0xf010b5c3
+f0105795:	e8 89 f8 ff ff       	call   f0105023 <cprintf>
+f010579a:	83 c4 08             	add    $0x8,%esp
+f010579d:	ff 73 0c             	push   0xc(%ebx)
+f01057a0:	68 d2 b5 10 f0       	push   $0xf010b5d2
+f01057a5:	e8 79 f8 ff ff       	call   f0105023 <cprintf>
+f01057aa:	83 c4 08             	add    $0x8,%esp
+f01057ad:	ff 73 10             	push   0x10(%ebx)
+f01057b0:	68 e1 b5 10 f0       	push   $0xf010b5e1
+f01057b5:	e8 69 f8 ff ff       	call   f0105023 <cprintf>
+f01057ba:	83 c4 08             	add    $0x8,%esp
+f01057bd:	ff 73 14             	push   0x14(%ebx)
+f01057c0:	68 f0 b5 10 f0       	push   $0xf010b5f0
+f01057c5:	e8 59 f8 ff ff       	call   f0105023 <cprintf>
+f01057ca:	83 c4 08             	add    $0x8,%esp
+f01057cd:	ff 73 18             	push   0x18(%ebx)
+f01057d0:	68 ff b5 10 f0       	push   $0xf010b5ff
+f01057d5:	e8 49 f8 ff ff       	call   f0105023 <cprintf>
+f01057da:	83 c4 08             	add    $0x8,%esp
+f01057dd:	ff 73 1c             	push   0x1c(%ebx)
+f01057e0:	68 0e b6 10 f0       	push   $0xf010b60e
+f01057e5:	e8 39 f8 ff ff       	call   f0105023 <cprintf>
+f01057ea:	83 c4 10             	add    $0x10,%esp
+f01057ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01057f0:	c9                   	leave
+f01057f1:	c3                   	ret
+
+f01057f2 <print_trapframe>:
+f01057f2:	55                   	push   %ebp
+f01057f3:	89 e5                	mov    %esp,%ebp
+f01057f5:	56                   	push   %esi
+f01057f6:	53                   	push   %ebx
+f01057f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01057fa:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105800:	83 ec 04             	sub    $0x4,%esp
+f0105803:	2d 40 70 25 f0       	sub    $0xf0257040,%eax
+f0105808:	c1 f8 06             	sar    $0x6,%eax
+f010580b:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0105811:	50                   	push   %eax
+f0105812:	53                   	push   %ebx
+f0105813:	68 72 b6 10 f0       	push   $0xf010b672
+f0105818:	e8 06 f8 ff ff       	call   f0105023 <cprintf>
+f010581d:	89 1c 24             	mov    %ebx,(%esp)
+f0105820:	e8 3f ff ff ff       	call   f0105764 <print_regs>
+f0105825:	83 c4 08             	add    $0x8,%esp
+f0105828:	0f b7 43 20          	movzwl 0x20(%ebx),%eax
+f010582c:	50                   	push   %eax
+f010582d:	68 90 b6 10 f0       	push   $0xf010b690
+f0105832:	e8 ec f7 ff ff       	call   f0105023 <cprintf>
+f0105837:	83 c4 08             	add    $0x8,%esp
+f010583a:	0f b7 43 24          	movzwl 0x24(%ebx),%eax
+f010583e:	50                   	push   %eax
+f010583f:	68 a3 b6 10 f0       	push   $0xf010b6a3
+f0105844:	e8 da f7 ff ff       	call   f0105023 <cprintf>
+f0105849:	8b 43 28             	mov    0x28(%ebx),%eax
+f010584c:	83 c4 10             	add    $0x10,%esp
+f010584f:	83 f8 13             	cmp    $0x13,%eax
+f0105852:	0f 86 da 00 00 00    	jbe    f0105932 <print_trapframe+0x140>
+f0105858:	ba 1d b6 10 f0       	mov    $0xf010b61d,%edx
+f010585d:	83 f8 30             	cmp    $0x30,%eax
+f0105860:	74 13                	je     f0105875 <print_trapframe+0x83>
+f0105862:	8d 50 e0             	lea    -0x20(%eax),%edx
+f0105865:	83 fa 10             	cmp    $0x10,%edx
+f0105868:	ba 38 b6 10 f0       	mov    $0xf010b638,%edx
+f010586d:	b9 29 b6 10 f0       	mov    $0xf010b629,%ecx
+f0105872:	0f 43 d1             	cmovae %ecx,%edx
+f0105875:	83 ec 04             	sub    $0x4,%esp
+f0105878:	52                   	push   %edx
+f0105879:	50                   	push   %eax
+f010587a:	68 b6 b6 10 f0       	push   $0xf010b6b6
+f010587f:	e8 9f f7 ff ff       	call   f0105023 <cprintf>
+f0105884:	83 c4 10             	add    $0x10,%esp
+f0105887:	39 1d 80 41 1a f0    	cmp    %ebx,0xf01a4180
+f010588d:	0f 84 ab 00 00 00    	je     f010593e <print_trapframe+0x14c>
+f0105893:	83 ec 08             	sub    $0x8,%esp
+f0105896:	ff 73 2c             	push   0x2c(%ebx)
+f0105899:	68 d7 b6 10 f0       	push   $0xf010b6d7
+f010589e:	e8 80 f7 ff ff       	call   f0105023 <cprintf>
+f01058a3:	83 c4 10             	add    $0x10,%esp
+f01058a6:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f01058aa:	0f 85 b1 00 00 00    	jne    f0105961 <print_trapframe+0x16f>
+f01058b0:	8b 43 2c             	mov    0x2c(%ebx),%eax
+f01058b3:	a8 01                	test   $0x1,%al
+f01058b5:	b9 56 b6 10 f0       	mov    $0xf010b656,%ecx
+f01058ba:	ba 4b b6 10 f0       	mov    $0xf010b64b,%edx
+f01058bf:	0f 45 ca             	cmovne %edx,%ecx
+f01058c2:	a8 02                	test   $0x2,%al
+f01058c4:	ba 68 b6 10 f0       	mov    $0xf010b668,%edx
+f01058c9:	be 62 b6 10 f0       	mov    $0xf010b662,%esi
+f01058ce:	0f 45 d6             	cmovne %esi,%edx
+f01058d1:	a8 04                	test   $0x4,%al
+f01058d3:	b8 cb b7 10 f0       	mov    $0xf010b7cb,%eax
+f01058d8:	be 6d b6 10 f0       	mov    $0xf010b66d,%esi
+f01058dd:	0f 45 c6             	cmovne %esi,%eax
+f01058e0:	51                   	push   %ecx
+f01058e1:	52                   	push   %edx
+f01058e2:	50                   	push   %eax
+f01058e3:	68 e5 b6 10 f0       	push   $0xf010b6e5
+f01058e8:	e8 36 f7 ff ff       	call   f0105023 <cprintf>
+f01058ed:	83 c4 10             	add    $0x10,%esp
+f01058f0:	83 ec 08             	sub    $0x8,%esp
+f01058f3:	ff 73 30             	push   0x30(%ebx)
+f01058f6:	68 f4 b6 10 f0       	push   $0xf010b6f4
+f01058fb:	e8 23 f7 ff ff       	call   f0105023 <cprintf>
+f0105900:	83 c4 08             	add    $0x8,%esp
+f0105903:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f0105907:	50                   	push   %eax
+f0105908:	68 03 b7 10 f0       	push   $0xf010b703
+f010590d:	e8 11 f7 ff ff       	call   f0105023 <cprintf>
+f0105912:	83 c4 08             	add    $0x8,%esp
+f0105915:	ff 73 38             	push   0x38(%ebx)
+f0105918:	68 16 b7 10 f0       	push   $0xf010b716
+f010591d:	e8 01 f7 ff ff       	call   f0105023 <cprintf>
+f0105922:	83 c4 10             	add    $0x10,%esp
+f0105925:	f6 43 34 03          	testb  $0x3,0x34(%ebx)
+f0105929:	75 4b                	jne    f0105976 <print_trapframe+0x184>
+f010592b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010592e:	5b                   	pop    %ebx
+f010592f:	5e                   	pop    %esi
+f0105930:	5d                   	pop    %ebp
+f0105931:	c3                   	ret
+f0105932:	8b 14 85 00 ba 10 f0 	mov    -0xfef4600(,%eax,4),%edx
+f0105939:	e9 37 ff ff ff       	jmp    f0105875 <print_trapframe+0x83>
+f010593e:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f0105942:	0f 85 4b ff ff ff    	jne    f0105893 <print_trapframe+0xa1>
+f0105948:	0f 20 d0             	mov    %cr2,%eax
+f010594b:	83 ec 08             	sub    $0x8,%esp
+f010594e:	50                   	push   %eax
+f010594f:	68 c8 b6 10 f0       	push   $0xf010b6c8
+f0105954:	e8 ca f6 ff ff       	call   f0105023 <cprintf>
+f0105959:	83 c4 10             	add    $0x10,%esp
+f010595c:	e9 32 ff ff ff       	jmp    f0105893 <print_trapframe+0xa1>
+f0105961:	83 ec 0c             	sub    $0xc,%esp
+f0105964:	68 50 b1 10 f0       	push   $0xf010b150
+f0105969:	e8 b5 f6 ff ff       	call   f0105023 <cprintf>
+f010596e:	83 c4 10             	add    $0x10,%esp
+f0105971:	e9 7a ff ff ff       	jmp    f01058f0 <print_trapframe+0xfe>
+f0105976:	83 ec 08             	sub    $0x8,%esp
+f0105979:	ff 73 3c             	push   0x3c(%ebx)
+f010597c:	68 25 b7 10 f0       	push   $0xf010b725
+f0105981:	e8 9d f6 ff ff       	call   f0105023 <cprintf>
+f0105986:	83 c4 08             	add    $0x8,%esp
+f0105989:	0f b7 43 40          	movzwl 0x40(%ebx),%eax
+f010598d:	50                   	push   %eax
+f010598e:	68 34 b7 10 f0       	push   $0xf010b734
+f0105993:	e8 8b f6 ff ff       	call   f0105023 <cprintf>
+f0105998:	83 c4 10             	add    $0x10,%esp
+f010599b:	eb 8e                	jmp    f010592b <print_trapframe+0x139>
+
+f010599d <page_fault_handler>:
+f010599d:	55                   	push   %ebp
+f010599e:	89 e5                	mov    %esp,%ebp
+f01059a0:	57                   	push   %edi
+f01059a1:	56                   	push   %esi
+f01059a2:	53                   	push   %ebx
+f01059a3:	83 ec 0c             	sub    $0xc,%esp
+f01059a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01059a9:	0f 20 d7             	mov    %cr2,%edi
+f01059ac:	f6 05 f4 73 11 f0 08 	testb  $0x8,0xf01173f4
+f01059b3:	0f 85 b6 00 00 00    	jne    f0105a6f <page_fault_handler+0xd2>
+f01059b9:	f6 43 34 03          	testb  $0x3,0x34(%ebx)
+f01059bd:	0f 84 c2 00 00 00    	je     f0105a85 <page_fault_handler+0xe8>
+f01059c3:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01059c9:	8b 40 04             	mov    0x4(%eax),%eax
+f01059cc:	80 78 5c 00          	cmpb   $0x0,0x5c(%eax)
+f01059d0:	74 0f                	je     f01059e1 <page_fault_handler+0x44>
+f01059d2:	8b 43 2c             	mov    0x2c(%ebx),%eax
+f01059d5:	83 e0 03             	and    $0x3,%eax
+f01059d8:	83 f8 03             	cmp    $0x3,%eax
+f01059db:	0f 84 bb 00 00 00    	je     f0105a9c <page_fault_handler+0xff>
+f01059e1:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01059e7:	8b 40 04             	mov    0x4(%eax),%eax
+f01059ea:	83 78 58 00          	cmpl   $0x0,0x58(%eax)
+f01059ee:	0f 84 d9 00 00 00    	je     f0105acd <page_fault_handler+0x130>
+f01059f4:	8b 43 3c             	mov    0x3c(%ebx),%eax
+f01059f7:	8d 90 00 10 00 15    	lea    0x15001000(%eax),%edx
+f01059fd:	b9 cc ff ff ea       	mov    $0xeaffffcc,%ecx
+f0105a02:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+f0105a08:	77 05                	ja     f0105a0f <page_fault_handler+0x72>
+f0105a0a:	83 e8 38             	sub    $0x38,%eax
+f0105a0d:	89 c1                	mov    %eax,%ecx
+f0105a0f:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105a15:	6a 07                	push   $0x7
+f0105a17:	6a 34                	push   $0x34
+f0105a19:	89 ce                	mov    %ecx,%esi
+f0105a1b:	51                   	push   %ecx
+f0105a1c:	ff 70 04             	push   0x4(%eax)
+f0105a1f:	e8 39 e6 ff ff       	call   f010405d <user_mem_assert>
+f0105a24:	89 f2                	mov    %esi,%edx
+f0105a26:	89 3e                	mov    %edi,(%esi)
+f0105a28:	8b 43 2c             	mov    0x2c(%ebx),%eax
+f0105a2b:	89 46 04             	mov    %eax,0x4(%esi)
+f0105a2e:	8d 7e 08             	lea    0x8(%esi),%edi
+f0105a31:	b9 08 00 00 00       	mov    $0x8,%ecx
+f0105a36:	89 de                	mov    %ebx,%esi
+f0105a38:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0105a3a:	8b 43 30             	mov    0x30(%ebx),%eax
+f0105a3d:	89 42 28             	mov    %eax,0x28(%edx)
+f0105a40:	8b 43 38             	mov    0x38(%ebx),%eax
+f0105a43:	89 42 2c             	mov    %eax,0x2c(%edx)
+f0105a46:	8b 43 3c             	mov    0x3c(%ebx),%eax
+f0105a49:	89 42 30             	mov    %eax,0x30(%edx)
+f0105a4c:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105a52:	8b 40 04             	mov    0x4(%eax),%eax
+f0105a55:	8b 40 58             	mov    0x58(%eax),%eax
+f0105a58:	89 43 30             	mov    %eax,0x30(%ebx)
+f0105a5b:	89 53 3c             	mov    %edx,0x3c(%ebx)
+f0105a5e:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105a64:	83 c4 04             	add    $0x4,%esp
+f0105a67:	ff 70 04             	push   0x4(%eax)
+f0105a6a:	e8 21 f2 ff ff       	call   f0104c90 <env_run>
+f0105a6f:	ff 73 2c             	push   0x2c(%ebx)
+f0105a72:	ff 73 30             	push   0x30(%ebx)
+f0105a75:	57                   	push   %edi
+f0105a76:	6a 03                	push   $0x3
+f0105a78:	e8 d6 1e 00 00       	call   f0107953 <ktrace_record>
+f0105a7d:	83 c4 10             	add    $0x10,%esp
+f0105a80:	e9 34 ff ff ff       	jmp    f01059b9 <page_fault_handler+0x1c>
+f0105a85:	83 ec 04             	sub    $0x4,%esp
+f0105a88:	68 47 b7 10 f0       	push   $0xf010b747
+f0105a8d:	68 ab 01 00 00       	push   $0x1ab
+f0105a92:	68 5a b7 10 f0       	push   $0xf010b75a
+f0105a97:	e8 8f a6 ff ff       	call   f010012b <_panic>
+f0105a9c:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105aa2:	83 ec 08             	sub    $0x8,%esp
+f0105aa5:	57                   	push   %edi
+f0105aa6:	8b 40 04             	mov    0x4(%eax),%eax
+f0105aa9:	ff 70 50             	push   0x50(%eax)
+f0105aac:	e8 58 e4 ff ff       	call   f0103f09 <page_cow>
+f0105ab1:	83 c4 10             	add    $0x10,%esp
+f0105ab4:	85 c0                	test   %eax,%eax
+f0105ab6:	0f 85 25 ff ff ff    	jne    f01059e1 <page_fault_handler+0x44>
+f0105abc:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105ac2:	83 ec 0c             	sub    $0xc,%esp
+f0105ac5:	ff 70 04             	push   0x4(%eax)
+f0105ac8:	e8 c3 f1 ff ff       	call   f0104c90 <env_run>
+f0105acd:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105ad3:	ff 73 30             	push   0x30(%ebx)
+f0105ad6:	57                   	push   %edi
+f0105ad7:	8b 40 04             	mov    0x4(%eax),%eax
+f0105ada:	ff 70 40             	push   0x40(%eax)
+f0105add:	68 18 b9 10 f0       	push   $0xf010b918
+f0105ae2:	e8 3c f5 ff ff       	call   f0105023 <cprintf>
+f0105ae7:	89 1c 24             	mov    %ebx,(%esp)
+f0105aea:	e8 03 fd ff ff       	call   f01057f2 <print_trapframe>
+f0105aef:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105af5:	83 c4 04             	add    $0x4,%esp
+f0105af8:	ff 70 04             	push   0x4(%eax)
+f0105afb:	e8 83 ee ff ff       	call   f0104983 <env_destroy>
+f0105b00:	83 c4 10             	add    $0x10,%esp
+f0105b03:	e9 ec fe ff ff       	jmp    f01059f4 <page_fault_handler+0x57>
+
+f0105b08 <trap>:
+f0105b08:	55                   	push   %ebp
+f0105b09:	89 e5                	mov    %esp,%ebp
+f0105b0b:	53                   	push   %ebx
+f0105b0c:	83 ec 04             	sub    $0x4,%esp
+f0105b0f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0105b12:	fc                   	cld
+f0105b13:	83 3d 00 20 1a f0 00 	cmpl   $0x0,0xf01a2000
+f0105b1a:	74 01                	je     f0105b1d <trap+0x15>
+f0105b1c:	f4                   	hlt
+f0105b1d:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0105b24:	b8 01 00 00 00       	mov    $0x1,%eax
+f0105b29:	f0 87 42 18          	lock xchg %eax,0x18(%edx)
+f0105b2d:	83 f8 02             	cmp    $0x2,%eax
+f0105b30:	74 20                	je     f0105b52 <trap+0x4a>
+f0105b32:	9c                   	pushf
+f0105b33:	58                   	pop    %eax
+f0105b34:	f6 c4 02             	test   $0x2,%ah
+f0105b37:	74 2b                	je     f0105b64 <trap+0x5c>
+f0105b39:	68 66 b7 10 f0       	push   $0xf010b766
+f0105b3e:	68 6c b1 10 f0       	push   $0xf010b16c
+f0105b43:	68 74 01 00 00       	push   $0x174
+f0105b48:	68 5a b7 10 f0       	push   $0xf010b75a
+f0105b4d:	e8 d9 a5 ff ff       	call   f010012b <_panic>
+f0105b52:	83 ec 0c             	sub    $0xc,%esp
+f0105b55:	68 00 74 11 f0       	push   $0xf0117400
+f0105b5a:	e8 46 3d 00 00       	call   f01098a5 <spin_lock>
+f0105b5f:	83 c4 10             	add    $0x10,%esp
+f0105b62:	eb ce                	jmp    f0105b32 <trap+0x2a>
+f0105b64:	f6 05 f4 73 11 f0 04 	testb  $0x4,0xf01173f4
+f0105b6b:	75 29                	jne    f0105b96 <trap+0x8e>
+f0105b6d:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f0105b71:	83 e0 03             	and    $0x3,%eax
+f0105b74:	66 83 f8 03          	cmp    $0x3,%ax
+f0105b78:	74 31                	je     f0105bab <trap+0xa3>
+f0105b7a:	89 1d 80 41 1a f0    	mov    %ebx,0xf01a4180
+f0105b80:	8b 43 28             	mov    0x28(%ebx),%eax
+f0105b83:	83 e8 03             	sub    $0x3,%eax
+f0105b86:	83 f8 2d             	cmp    $0x2d,%eax
+f0105b89:	0f 87 14 01 00 00    	ja     f0105ca3 <trap+0x19b>
+f0105b8f:	ff 24 85 40 b9 10 f0 	jmp    *-0xfef46c0(,%eax,4)
+f0105b96:	ff 73 2c             	push   0x2c(%ebx)
+f0105b99:	ff 73 30             	push   0x30(%ebx)
+f0105b9c:	ff 73 28             	push   0x28(%ebx)
+f0105b9f:	6a 02                	push   $0x2
+f0105ba1:	e8 ad 1d 00 00       	call   f0107953 <ktrace_record>
+f0105ba6:	83 c4 10             	add    $0x10,%esp
+f0105ba9:	eb c2                	jmp    f0105b6d <trap+0x65>
+f0105bab:	83 ec 0c             	sub    $0xc,%esp
+f0105bae:	68 00 74 11 f0       	push   $0xf0117400
+f0105bb3:	e8 ed 3c 00 00       	call   f01098a5 <spin_lock>
+f0105bb8:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105bbe:	83 c4 10             	add    $0x10,%esp
+f0105bc1:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0105bc5:	74 19                	je     f0105be0 <trap+0xd8>
+f0105bc7:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105bcd:	8b 40 04             	mov    0x4(%eax),%eax
+f0105bd0:	83 38 01             	cmpl   $0x1,(%eax)
+f0105bd3:	74 24                	je     f0105bf9 <trap+0xf1>
+f0105bd5:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105bdb:	89 58 08             	mov    %ebx,0x8(%eax)
+f0105bde:	eb 9a                	jmp    f0105b7a <trap+0x72>
+f0105be0:	68 7f b7 10 f0       	push   $0xf010b77f
+f0105be5:	68 6c b1 10 f0       	push   $0xf010b16c
+f0105bea:	68 7e 01 00 00       	push   $0x17e
+f0105bef:	68 5a b7 10 f0       	push   $0xf010b75a
+f0105bf4:	e8 32 a5 ff ff       	call   f010012b <_panic>
+f0105bf9:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105bff:	83 ec 0c             	sub    $0xc,%esp
+f0105c02:	ff 70 04             	push   0x4(%eax)
+f0105c05:	e8 36 eb ff ff       	call   f0104740 <env_free>
+f0105c0a:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105c10:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+f0105c17:	e8 a0 03 00 00       	call   f0105fbc <sched_yield>
+f0105c1c:	83 ec 0c             	sub    $0xc,%esp
+f0105c1f:	68 86 b7 10 f0       	push   $0xf010b786
+f0105c24:	e8 fa f3 ff ff       	call   f0105023 <cprintf>
+f0105c29:	89 1c 24             	mov    %ebx,(%esp)
+f0105c2c:	e8 a4 b5 ff ff       	call   f01011d5 <monitor>
+f0105c31:	83 c4 10             	add    $0x10,%esp
+f0105c34:	eb 41                	jmp    f0105c77 <trap+0x16f>
+f0105c36:	83 ec 0c             	sub    $0xc,%esp
+f0105c39:	53                   	push   %ebx
+f0105c3a:	e8 5e fd ff ff       	call   f010599d <page_fault_handler>
+f0105c3f:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f0105c43:	83 e0 03             	and    $0x3,%eax
+f0105c46:	66 83 f8 03          	cmp    $0x3,%ax
+f0105c4a:	74 4e                	je     f0105c9a <trap+0x192>
+f0105c4c:	83 ec 0c             	sub    $0xc,%esp
+f0105c4f:	53                   	push   %ebx
+f0105c50:	e8 9d fb ff ff       	call   f01057f2 <print_trapframe>
+f0105c55:	83 c4 10             	add    $0x10,%esp
+f0105c58:	66 83 7b 34 08       	cmpw   $0x8,0x34(%ebx)
+f0105c5d:	0f 84 e0 00 00 00    	je     f0105d43 <trap+0x23b>
+f0105c63:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105c69:	83 ec 0c             	sub    $0xc,%esp
+f0105c6c:	ff 70 04             	push   0x4(%eax)
+f0105c6f:	e8 0f ed ff ff       	call   f0104983 <env_destroy>
+f0105c74:	83 c4 10             	add    $0x10,%esp
+f0105c77:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105c7d:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0105c81:	74 12                	je     f0105c95 <trap+0x18d>
+f0105c83:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105c89:	8b 40 04             	mov    0x4(%eax),%eax
+f0105c8c:	83 38 03             	cmpl   $0x3,(%eax)
+f0105c8f:	0f 84 c5 00 00 00    	je     f0105d5a <trap+0x252>
+f0105c95:	e8 22 03 00 00       	call   f0105fbc <sched_yield>
+f0105c9a:	e8 12 ef ff ff       	call   f0104bb1 <env_fpu_trap>
+f0105c9f:	85 c0                	test   %eax,%eax
+f0105ca1:	74 d4                	je     f0105c77 <trap+0x16f>
+f0105ca3:	83 7b 28 27          	cmpl   $0x27,0x28(%ebx)
+f0105ca7:	75 a3                	jne    f0105c4c <trap+0x144>
+f0105ca9:	83 ec 0c             	sub    $0xc,%esp
+f0105cac:	68 9c b7 10 f0       	push   $0xf010b79c
+f0105cb1:	e8 6d f3 ff ff       	call   f0105023 <cprintf>
+f0105cb6:	89 1c 24             	mov    %ebx,(%esp)
+f0105cb9:	e8 34 fb ff ff       	call   f01057f2 <print_trapframe>
+f0105cbe:	83 c4 10             	add    $0x10,%esp
+f0105cc1:	eb b4                	jmp    f0105c77 <trap+0x16f>
+f0105cc3:	83 ec 08             	sub    $0x8,%esp
+f0105cc6:	ff 73 04             	push   0x4(%ebx)
+f0105cc9:	ff 33                	push   (%ebx)
+f0105ccb:	ff 73 10             	push   0x10(%ebx)
+f0105cce:	ff 73 18             	push   0x18(%ebx)
+f0105cd1:	ff 73 14             	push   0x14(%ebx)
+f0105cd4:	ff 73 1c             	push   0x1c(%ebx)
+f0105cd7:	e8 c9 03 00 00       	call   f01060a5 <syscall>
+f0105cdc:	89 43 1c             	mov    %eax,0x1c(%ebx)
+f0105cdf:	83 c4 20             	add    $0x20,%esp
+f0105ce2:	eb 93                	jmp    f0105c77 <trap+0x16f>
+f0105ce4:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105cea:	83 40 10 01          	addl   $0x1,0x10(%eax)
+f0105cee:	83 ec 0c             	sub    $0xc,%esp
+f0105cf1:	53                   	push   %ebx
+f0105cf2:	e8 fc 1f 00 00       	call   f0107cf3 <prof_sample>
+f0105cf7:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105cfd:	83 c4 10             	add    $0x10,%esp
+f0105d00:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0105d04:	74 29                	je     f0105d2f <trap+0x227>
+f0105d06:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0105d0d:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105d13:	8b 40 04             	mov    0x4(%eax),%eax
+f0105d16:	8b 40 60             	mov    0x60(%eax),%eax
+f0105d19:	8b 52 10             	mov    0x10(%edx),%edx
+f0105d1c:	89 50 10             	mov    %edx,0x10(%eax)
+f0105d1f:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105d25:	8b 40 04             	mov    0x4(%eax),%eax
+f0105d28:	8b 40 60             	mov    0x60(%eax),%eax
+f0105d2b:	83 40 14 01          	addl   $0x1,0x14(%eax)
+f0105d2f:	e8 05 3a 00 00       	call   f0109739 <lapic_eoi>
+f0105d34:	e8 83 02 00 00       	call   f0105fbc <sched_yield>
+f0105d39:	e8 b3 ab ff ff       	call   f01008f1 <serial_intr>
+f0105d3e:	e9 34 ff ff ff       	jmp    f0105c77 <trap+0x16f>
+f0105d43:	83 ec 04             	sub    $0x4,%esp
+f0105d46:	68 b9 b7 10 f0       	push   $0xf010b7b9
+f0105d4b:	68 5a 01 00 00       	push   $0x15a
+f0105d50:	68 5a b7 10 f0       	push   $0xf010b75a
+f0105d55:	e8 d1 a3 ff ff       	call   f010012b <_panic>
+f0105d5a:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105d60:	83 ec 0c             	sub    $0xc,%esp
+f0105d63:	ff 70 04             	push   0x4(%eax)
+f0105d66:	e8 25 ef ff ff       	call   f0104c90 <env_run>
+f0105d6b:	90                   	nop
+
+f0105d6c <t_divide>:
+f0105d6c:	6a 00                	push   $0x0
+f0105d6e:	6a 00                	push   $0x0
+f0105d70:	e9 60 01 00 00       	jmp    f0105ed5 <_alltraps>
+f0105d75:	90                   	nop
+
+f0105d76 <t_debug>:
+f0105d76:	6a 00                	push   $0x0
+f0105d78:	6a 01                	push   $0x1
+f0105d7a:	e9 56 01 00 00       	jmp    f0105ed5 <_alltraps>
+f0105d7f:	90                   	nop
+
+f0105d80 <t_nmi>:
+f0105d80:	6a 00                	push   $0x0
+f0105d82:	6a 02                	push   $0x2
+f0105d84:	e9 4c 01 00 00       	jmp    f0105ed5 <_alltraps>
+f0105d89:	90                   	nop
+
+f0105d8a <t_brkpt>:
+f0105d8a:	6a 00                	push   $0x0
+f0105d8c:	6a 03                	push   $0x3
+f0105d8e:	e9 42 01 00 00       	jmp    f0105ed5 <_alltraps>
+f0105d93:	90                   	nop
+
+f0105d94 <t_oflow>:
+f0105d94:	6a 00                	push   $0x0
+f0105d96:	6a 04                	push   $0x4
+f0105d98:	e9 38 01 00 00       	jmp    f0105ed5 <_alltraps>
+f0105d9d:	90                   	nop
+
+f0105d9e <t_bound>:
+f0105d9e:	6a 00                	push   $0x0
+f0105da0:	6a 05                	push   $0x5
+f0105da2:	e9 2e 01 00 00       	jmp    f0105ed5 <_alltraps>
+f0105da7:	90                   	nop
+
+f0105da8 <t_illop>:
+f0105da8:	6a 00                	push   $0x0
+f0105daa:	6a 06                	push   $0x6
+f0105dac:	e9 24 01 00 00       	jmp    f0105ed5 <_alltraps>
+f0105db1:	90                   	nop
+
+f0105db2 <t_device>:
+f0105db2:	6a 00                	push   $0x0
+f0105db4:	6a 07                	push   $0x7
+f0105db6:	e9 1a 01 00 00       	jmp    f0105ed5 <_alltraps>
+f0105dbb:	90                   	nop
+
+f0105dbc <t_dblflt>:
+f0105dbc:	6a 08                	push   $0x8
+f0105dbe:	e9 12 01 00 00       	jmp    f0105ed5 <_alltraps>
+f0105dc3:	90                   	nop
+
+f0105dc4 <t_tss>:
+f0105dc4:	6a 0a                	push   $0xa
+f0105dc6:	e9 0a 01 00 00       	jmp    f0105ed5 <_alltraps>
+f0105dcb:	90                   	nop
+
+f0105dcc <t_segnp>:
+f0105dcc:	6a 0b                	push   $0xb
+f0105dce:	e9 02 01 00 00       	jmp    f0105ed5 <_alltraps>
+f0105dd3:	90                   	nop
+
+f0105dd4 <t_stack>:
+f0105dd4:	6a 0c                	push   $0xc
+f0105dd6:	e9 fa 00 00 00       	jmp    f0105ed5 <_alltraps>
+f0105ddb:	90                   	nop
+
+f0105ddc <t_gpflt>:
+f0105ddc:	6a 0d                	push   $0xd
+f0105dde:	e9 f2 00 00 00       	jmp    f0105ed5 <_alltraps>
+f0105de3:	90                   	nop
+
+f0105de4 <t_pgflt>:
+f0105de4:	6a 0e                	push   $0xe
+f0105de6:	e9 ea 00 00 00       	jmp    f0105ed5 <_alltraps>
+f0105deb:	90                   	nop
+
+f0105dec <t_fperr>:
+f0105dec:	6a 00                	push   $0x0
+f0105dee:	6a 10                	push   $0x10
+f0105df0:	e9 e0 00 00 00       	jmp    f0105ed5 <_alltraps>
+f0105df5:	90                   	nop
+
+f0105df6 <t_align>:
+f0105df6:	6a 11                	push   $0x11
+f0105df8:	e9 d8 00 00 00       	jmp    f0105ed5 <_alltraps>
+f0105dfd:	90                   	nop
+
+f0105dfe <t_mchk>:
+f0105dfe:	6a 00                	push   $0x0
+f0105e00:	6a 12                	push   $0x12
+f0105e02:	e9 ce 00 00 00       	jmp    f0105ed5 <_alltraps>
+f0105e07:	90                   	nop
+
+f0105e08 <t_simderr>:
+f0105e08:	6a 00                	push   $0x0
+f0105e0a:	6a 13                	push   $0x13
+f0105e0c:	e9 c4 00 00 00       	jmp    f0105ed5 <_alltraps>
+f0105e11:	90                   	nop
+
+f0105e12 <t_syscall>:
+f0105e12:	6a 00                	push   $0x0
+f0105e14:	6a 30                	push   $0x30
+f0105e16:	e9 ba 00 00 00       	jmp    f0105ed5 <_alltraps>
+f0105e1b:	90                   	nop
+
+f0105e1c <t_default>:
+f0105e1c:	6a 00                	push   $0x0
+f0105e1e:	68 f4 01 00 00       	push   $0x1f4
+f0105e23:	e9 ad 00 00 00       	jmp    f0105ed5 <_alltraps>
+
+f0105e28 <t_irq_timer>:
+f0105e28:	6a 00                	push   $0x0
+f0105e2a:	6a 20                	push   $0x20
+f0105e2c:	e9 a4 00 00 00       	jmp    f0105ed5 <_alltraps>
+f0105e31:	90                   	nop
+
+f0105e32 <t_irq_kbd>:
+f0105e32:	6a 00                	push   $0x0
+f0105e34:	6a 21                	push   $0x21
+f0105e36:	e9 9a 00 00 00       	jmp    f0105ed5 <_alltraps>
+f0105e3b:	90                   	nop
+
+f0105e3c <t_irq_2>:
+f0105e3c:	6a 00                	push   $0x0
+f0105e3e:	6a 22                	push   $0x22
+f0105e40:	e9 90 00 00 00       	jmp    f0105ed5 <_alltraps>
+f0105e45:	90                   	nop
+
+f0105e46 <t_irq_3>:
+f0105e46:	6a 00                	push   $0x0
+f0105e48:	6a 23                	push   $0x23
+f0105e4a:	e9 86 00 00 00       	jmp    f0105ed5 <_alltraps>
+f0105e4f:	90                   	nop
+
+f0105e50 <t_irq_serial>:
+f0105e50:	6a 00                	push   $0x0
+f0105e52:	6a 24                	push   $0x24
+f0105e54:	eb 7f                	jmp    f0105ed5 <_alltraps>
+
+f0105e56 <t_irq_5>:
+f0105e56:	6a 00                	push   $0x0
+f0105e58:	6a 25                	push   $0x25
+f0105e5a:	eb 79                	jmp    f0105ed5 <_alltraps>
+
+f0105e5c <t_irq_6>:
+f0105e5c:	6a 00                	push   $0x0
+f0105e5e:	6a 26                	push   $0x26
+f0105e60:	eb 73                	jmp    f0105ed5 <_alltraps>
+
+f0105e62 <t_irq_spurious>:
+f0105e62:	6a 00                	push   $0x0
+f0105e64:	6a 27                	push   $0x27
+f0105e66:	eb 6d                	jmp    f0105ed5 <_alltraps>
+
+f0105e68 <t_irq_8>:
+f0105e68:	6a 00                	push   $0x0
+f0105e6a:	6a 28                	push   $0x28
+f0105e6c:	eb 67                	jmp    f0105ed5 <_alltraps>
+
+f0105e6e <t_irq_9>:
+f0105e6e:	6a 00                	push   $0x0
+f0105e70:	6a 29                	push   $0x29
+f0105e72:	eb 61                	jmp    f0105ed5 <_alltraps>
+
+f0105e74 <t_irq_10>:
+f0105e74:	6a 00                	push   $0x0
+f0105e76:	6a 2a                	push   $0x2a
+f0105e78:	eb 5b                	jmp    f0105ed5 <_alltraps>
+
+f0105e7a <t_irq_11>:
+f0105e7a:	6a 00                	push   $0x0
+f0105e7c:	6a 2b                	push   $0x2b
+f0105e7e:	eb 55                	jmp    f0105ed5 <_alltraps>
+
+f0105e80 <t_irq_12>:
+f0105e80:	6a 00                	push   $0x0
+f0105e82:	6a 2c                	push   $0x2c
+f0105e84:	eb 4f                	jmp    f0105ed5 <_alltraps>
+
+f0105e86 <t_irq_13>:
+f0105e86:	6a 00                	push   $0x0
+f0105e88:	6a 2d                	push   $0x2d
+f0105e8a:	eb 49                	jmp    f0105ed5 <_alltraps>
+
+f0105e8c <t_irq_ide>:
+f0105e8c:	6a 00                	push   $0x0
+f0105e8e:	6a 2e                	push   $0x2e
+f0105e90:	eb 43                	jmp    f0105ed5 <_alltraps>
+
+f0105e92 <t_irq_15>:
+f0105e92:	6a 00                	push   $0x0
+f0105e94:	6a 2f                	push   $0x2f
+f0105e96:	eb 3d                	jmp    f0105ed5 <_alltraps>
+
+f0105e98 <sysenter_handler>:
+f0105e98:	6a 23                	push   $0x23
+f0105e9a:	55                   	push   %ebp
+f0105e9b:	9c                   	pushf
+f0105e9c:	6a 1b                	push   $0x1b
+f0105e9e:	6a 00                	push   $0x0
+f0105ea0:	6a 00                	push   $0x0
+f0105ea2:	6a 30                	push   $0x30
+f0105ea4:	1e                   	push   %ds
+f0105ea5:	06                   	push   %es
+f0105ea6:	60                   	pusha
+f0105ea7:	b8 10 00 00 00       	mov    $0x10,%eax
+f0105eac:	8e d8                	mov    %eax,%ds
+f0105eae:	8e c0                	mov    %eax,%es
+f0105eb0:	66 0f 00 c8          	str    %ax
+f0105eb4:	66 83 c0 40          	add    $0x40,%ax
+f0105eb8:	8e e8                	mov    %eax,%gs
+f0105eba:	54                   	push   %esp
+f0105ebb:	e8 19 11 00 00       	call   f0106fd9 <syscall_sysenter>
+f0105ec0:	83 c4 04             	add    $0x4,%esp
+f0105ec3:	89 44 24 1c          	mov    %eax,0x1c(%esp)
+f0105ec7:	61                   	popa
+f0105ec8:	07                   	pop    %es
+f0105ec9:	1f                   	pop    %ds
+f0105eca:	8b 54 24 08          	mov    0x8(%esp),%edx
+f0105ece:	8b 4c 24 14          	mov    0x14(%esp),%ecx
+f0105ed2:	fb                   	sti
+f0105ed3:	0f 35                	sysexit
+
+f0105ed5 <_alltraps>:
+f0105ed5:	1e                   	push   %ds
+f0105ed6:	06                   	push   %es
+f0105ed7:	60                   	pusha
+f0105ed8:	b8 10 00 00 00       	mov    $0x10,%eax
+f0105edd:	8e d8                	mov    %eax,%ds
+f0105edf:	8e c0                	mov    %eax,%es
+f0105ee1:	66 0f 00 c8          	str    %ax
+f0105ee5:	66 83 c0 40          	add    $0x40,%ax
+f0105ee9:	8e e8                	mov    %eax,%gs
+f0105eeb:	54                   	push   %esp
+f0105eec:	e8 17 fc ff ff       	call   f0105b08 <trap>
+
+f0105ef1 <sched_halt>:
+f0105ef1:	55                   	push   %ebp
+f0105ef2:	89 e5                	mov    %esp,%ebp
+f0105ef4:	53                   	push   %ebx
+f0105ef5:	83 ec 04             	sub    $0x4,%esp
+f0105ef8:	8b 1d 40 37 1a f0    	mov    0xf01a3740,%ebx
+f0105efe:	8b 0d 44 37 1a f0    	mov    0xf01a3744,%ecx
+f0105f04:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105f09:	39 da                	cmp    %ebx,%edx
+f0105f0b:	74 15                	je     f0105f22 <sched_halt+0x31>
+f0105f0d:	8b 01                	mov    (%ecx),%eax
+f0105f0f:	83 e8 01             	sub    $0x1,%eax
+f0105f12:	81 c1 80 03 00 00    	add    $0x380,%ecx
+f0105f18:	83 f8 02             	cmp    $0x2,%eax
+f0105f1b:	76 05                	jbe    f0105f22 <sched_halt+0x31>
+f0105f1d:	83 c2 01             	add    $0x1,%edx
+f0105f20:	eb e7                	jmp    f0105f09 <sched_halt+0x18>
+f0105f22:	39 d3                	cmp    %edx,%ebx
+f0105f24:	74 65                	je     f0105f8b <sched_halt+0x9a>
+f0105f26:	e8 66 eb ff ff       	call   f0104a91 <env_save_state>
+f0105f2b:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105f31:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+f0105f38:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f0105f3d:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0105f42:	76 66                	jbe    f0105faa <sched_halt+0xb9>
+f0105f44:	05 00 00 00 10       	add    $0x10000000,%eax
+f0105f49:	0f 22 d8             	mov    %eax,%cr3
+f0105f4c:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0105f53:	b8 02 00 00 00       	mov    $0x2,%eax
+f0105f58:	f0 87 42 18          	lock xchg %eax,0x18(%edx)
+f0105f5c:	83 ec 0c             	sub    $0xc,%esp
+f0105f5f:	68 00 74 11 f0       	push   $0xf0117400
+f0105f64:	e8 d4 39 00 00       	call   f010993d <spin_unlock>
+f0105f69:	f3 90                	pause
+f0105f6b:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105f71:	8b 40 20             	mov    0x20(%eax),%eax
+f0105f74:	bd 00 00 00 00       	mov    $0x0,%ebp
+f0105f79:	89 c4                	mov    %eax,%esp
+f0105f7b:	6a 00                	push   $0x0
+f0105f7d:	6a 00                	push   $0x0
+f0105f7f:	fb                   	sti
+f0105f80:	f4                   	hlt
+f0105f81:	eb fd                	jmp    f0105f80 <sched_halt+0x8f>
+f0105f83:	83 c4 10             	add    $0x10,%esp
+f0105f86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0105f89:	c9                   	leave
+f0105f8a:	c3                   	ret
+f0105f8b:	83 ec 0c             	sub    $0xc,%esp
+f0105f8e:	68 50 ba 10 f0       	push   $0xf010ba50
+f0105f93:	e8 8b f0 ff ff       	call   f0105023 <cprintf>
+f0105f98:	83 c4 10             	add    $0x10,%esp
+f0105f9b:	83 ec 0c             	sub    $0xc,%esp
+f0105f9e:	6a 00                	push   $0x0
+f0105fa0:	e8 30 b2 ff ff       	call   f01011d5 <monitor>
+f0105fa5:	83 c4 10             	add    $0x10,%esp
+f0105fa8:	eb f1                	jmp    f0105f9b <sched_halt+0xaa>
+f0105faa:	50                   	push   %eax
+f0105fab:	68 08 9e 10 f0       	push   $0xf0109e08
+f0105fb0:	6a 5f                	push   $0x5f
+f0105fb2:	68 79 ba 10 f0       	push   $0xf010ba79
+f0105fb7:	e8 6f a1 ff ff       	call   f010012b <_panic>
+
+f0105fbc <sched_yield>:
+f0105fbc:	55                   	push   %ebp
+f0105fbd:	89 e5                	mov    %esp,%ebp
+f0105fbf:	57                   	push   %edi
+f0105fc0:	56                   	push   %esi
+f0105fc1:	53                   	push   %ebx
+f0105fc2:	83 ec 1c             	sub    $0x1c,%esp
+f0105fc5:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0105fcc:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105fd1:	83 7a 04 00          	cmpl   $0x0,0x4(%edx)
+f0105fd5:	74 0c                	je     f0105fe3 <sched_yield+0x27>
+f0105fd7:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105fdd:	8b 40 04             	mov    0x4(%eax),%eax
+f0105fe0:	8b 40 40             	mov    0x40(%eax),%eax
+f0105fe3:	f6 05 f4 73 11 f0 02 	testb  $0x2,0xf01173f4
+f0105fea:	75 2e                	jne    f010601a <sched_yield+0x5e>
+f0105fec:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0105ff2:	be 00 00 00 00       	mov    $0x0,%esi
+f0105ff7:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0105ffb:	74 0c                	je     f0106009 <sched_yield+0x4d>
+f0105ffd:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0106003:	8b 40 04             	mov    0x4(%eax),%eax
+f0106006:	8b 70 40             	mov    0x40(%eax),%esi
+f0106009:	81 e6 ff 7f 00 00    	and    $0x7fff,%esi
+f010600f:	69 c6 80 03 00 00    	imul   $0x380,%esi,%eax
+f0106015:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0106018:	eb 54                	jmp    f010606e <sched_yield+0xb2>
+f010601a:	6a 00                	push   $0x0
+f010601c:	6a 00                	push   $0x0
+f010601e:	50                   	push   %eax
+f010601f:	6a 01                	push   $0x1
+f0106021:	e8 2d 19 00 00       	call   f0107953 <ktrace_record>
+f0106026:	83 c4 10             	add    $0x10,%esp
+f0106029:	eb c1                	jmp    f0105fec <sched_yield+0x30>
+f010602b:	83 ec 0c             	sub    $0xc,%esp
+f010602e:	52                   	push   %edx
+f010602f:	e8 5c ec ff ff       	call   f0104c90 <env_run>
+f0106034:	83 ec 0c             	sub    $0xc,%esp
+f0106037:	57                   	push   %edi
+f0106038:	e8 53 ec ff ff       	call   f0104c90 <env_run>
+f010603d:	83 c1 01             	add    $0x1,%ecx
+f0106040:	8d 04 0e             	lea    (%esi,%ecx,1),%eax
+f0106043:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106048:	f7 f3                	div    %ebx
+f010604a:	69 d2 80 03 00 00    	imul   $0x380,%edx,%edx
+f0106050:	01 fa                	add    %edi,%edx
+f0106052:	83 3a 02             	cmpl   $0x2,(%edx)
+f0106055:	74 d4                	je     f010602b <sched_yield+0x6f>
+f0106057:	39 cb                	cmp    %ecx,%ebx
+f0106059:	73 e2                	jae    f010603d <sched_yield+0x81>
+f010605b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010605e:	01 c7                	add    %eax,%edi
+f0106060:	83 3f 03             	cmpl   $0x3,(%edi)
+f0106063:	74 cf                	je     f0106034 <sched_yield+0x78>
+f0106065:	e8 a6 0e 00 00       	call   f0106f10 <sysring_poll>
+f010606a:	85 c0                	test   %eax,%eax
+f010606c:	74 13                	je     f0106081 <sched_yield+0xc5>
+f010606e:	8b 3d 44 37 1a f0    	mov    0xf01a3744,%edi
+f0106074:	8b 1d 40 37 1a f0    	mov    0xf01a3740,%ebx
+f010607a:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010607f:	eb bf                	jmp    f0106040 <sched_yield+0x84>
+f0106081:	e8 6b fe ff ff       	call   f0105ef1 <sched_halt>
+f0106086:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106089:	5b                   	pop    %ebx
+f010608a:	5e                   	pop    %esi
+f010608b:	5f                   	pop    %edi
+f010608c:	5d                   	pop    %ebp
+f010608d:	c3                   	ret
+
+f010608e <syscall_nonblocking>:
+f010608e:	83 f8 13             	cmp    $0x13,%eax
+f0106091:	77 0c                	ja     f010609f <syscall_nonblocking+0x11>
+f0106093:	ba 77 eb 0f 00       	mov    $0xfeb77,%edx
+f0106098:	0f a3 c2             	bt     %eax,%edx
+f010609b:	0f 92 c0             	setb   %al
+f010609e:	c3                   	ret
+f010609f:	b8 00 00 00 00       	mov    $0x0,%eax
+f01060a4:	c3                   	ret
+
+f01060a5 <syscall>:
+f01060a5:	55                   	push   %ebp
+f01060a6:	89 e5                	mov    %esp,%ebp
+f01060a8:	57                   	push   %edi
+f01060a9:	56                   	push   %esi
+f01060aa:	53                   	push   %ebx
+f01060ab:	83 ec 2c             	sub    $0x2c,%esp
+f01060ae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01060b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01060b6:	83 f9 13             	cmp    $0x13,%ecx
+f01060b9:	77 41                	ja     f01060fc <syscall+0x57>
+f01060bb:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01060c1:	2d 40 70 25 f0       	sub    $0xf0257040,%eax
+f01060c6:	c1 f8 06             	sar    $0x6,%eax
+f01060c9:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01060cf:	8d 34 c5 00 00 00 00 	lea    0x0(,%eax,8),%esi
+f01060d6:	8d 14 06             	lea    (%esi,%eax,1),%edx
+f01060d9:	c1 e2 06             	shl    $0x6,%edx
+f01060dc:	6b f9 1c             	imul   $0x1c,%ecx,%edi
+f01060df:	01 fa                	add    %edi,%edx
+f01060e1:	8d 9a 00 6a 1a f0    	lea    -0xfe59600(%edx),%ebx
+f01060e7:	01 c6                	add    %eax,%esi
+f01060e9:	c1 e6 06             	shl    $0x6,%esi
+f01060ec:	8b 84 37 00 6a 1a f0 	mov    -0xfe59600(%edi,%esi,1),%eax
+f01060f3:	83 c0 01             	add    $0x1,%eax
+f01060f6:	89 82 00 6a 1a f0    	mov    %eax,-0xfe59600(%edx)
+f01060fc:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0106102:	8b 40 04             	mov    0x4(%eax),%eax
+f0106105:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0106108:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+f010610f:	85 c0                	test   %eax,%eax
+f0106111:	0f 84 a3 00 00 00    	je     f01061ba <syscall+0x115>
+f0106117:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010611d:	8b 40 04             	mov    0x4(%eax),%eax
+f0106120:	80 78 5d 00          	cmpb   $0x0,0x5d(%eax)
+f0106124:	0f 84 82 00 00 00    	je     f01061ac <syscall+0x107>
+f010612a:	8b 15 c0 41 1a f0    	mov    0xf01a41c0,%edx
+f0106130:	89 55 d0             	mov    %edx,-0x30(%ebp)
+f0106133:	8d 42 01             	lea    0x1(%edx),%eax
+f0106136:	a3 c0 41 1a f0       	mov    %eax,0xf01a41c0
+f010613b:	0f b6 f2             	movzbl %dl,%esi
+f010613e:	8d 04 b5 00 00 00 00 	lea    0x0(,%esi,4),%eax
+f0106145:	8d 14 30             	lea    (%eax,%esi,1),%edx
+f0106148:	c1 e2 03             	shl    $0x3,%edx
+f010614b:	8d ba e0 41 1a f0    	lea    -0xfe5be20(%edx),%edi
+f0106151:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+f0106154:	65 8b 3d 00 00 00 00 	mov    %gs:0x0,%edi
+f010615b:	8b 7f 04             	mov    0x4(%edi),%edi
+f010615e:	8b 7f 40             	mov    0x40(%edi),%edi
+f0106161:	89 ba e0 41 1a f0    	mov    %edi,-0xfe5be20(%edx)
+f0106167:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f010616a:	89 4f 04             	mov    %ecx,0x4(%edi)
+f010616d:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0106170:	89 57 08             	mov    %edx,0x8(%edi)
+f0106173:	8b 55 10             	mov    0x10(%ebp),%edx
+f0106176:	89 57 0c             	mov    %edx,0xc(%edi)
+f0106179:	8b 55 14             	mov    0x14(%ebp),%edx
+f010617c:	89 57 10             	mov    %edx,0x10(%edi)
+f010617f:	8b 55 18             	mov    0x18(%ebp),%edx
+f0106182:	89 57 14             	mov    %edx,0x14(%edi)
+f0106185:	8b 55 1c             	mov    0x1c(%ebp),%edx
+f0106188:	89 57 18             	mov    %edx,0x18(%edi)
+f010618b:	c7 47 1c 00 00 00 00 	movl   $0x0,0x1c(%edi)
+f0106192:	01 f0                	add    %esi,%eax
+f0106194:	c7 04 c5 00 42 1a f0 	movl   $0x0,-0xfe5be00(,%eax,8)
+f010619b:	00 00 00 00 
+f010619f:	c7 04 c5 04 42 1a f0 	movl   $0x0,-0xfe5bdfc(,%eax,8)
+f01061a6:	00 00 00 00 
+f01061aa:	eb 0e                	jmp    f01061ba <syscall+0x115>
+f01061ac:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+f01061b3:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+f01061ba:	0f 31                	rdtsc
+f01061bc:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f01061bf:	89 55 cc             	mov    %edx,-0x34(%ebp)
+f01061c2:	83 f9 13             	cmp    $0x13,%ecx
+f01061c5:	0f 87 45 09 00 00    	ja     f0106b10 <syscall+0xa6b>
+f01061cb:	ff 24 8d 40 bc 10 f0 	jmp    *-0xfef43c0(,%ecx,4)
+f01061d2:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01061d8:	6a 05                	push   $0x5
+f01061da:	ff 75 10             	push   0x10(%ebp)
+f01061dd:	ff 75 0c             	push   0xc(%ebp)
+f01061e0:	ff 70 04             	push   0x4(%eax)
+f01061e3:	e8 75 de ff ff       	call   f010405d <user_mem_assert>
+f01061e8:	83 c4 08             	add    $0x8,%esp
+f01061eb:	ff 75 10             	push   0x10(%ebp)
+f01061ee:	ff 75 0c             	push   0xc(%ebp)
+f01061f1:	e8 70 a7 ff ff       	call   f0100966 <cons_write>
+f01061f6:	83 c4 10             	add    $0x10,%esp
+f01061f9:	be 00 00 00 00       	mov    $0x0,%esi
+f01061fe:	0f 31                	rdtsc
+f0106200:	2b 45 c8             	sub    -0x38(%ebp),%eax
+f0106203:	1b 55 cc             	sbb    -0x34(%ebp),%edx
+f0106206:	85 db                	test   %ebx,%ebx
+f0106208:	74 22                	je     f010622c <syscall+0x187>
+f010620a:	85 f6                	test   %esi,%esi
+f010620c:	0f 88 44 09 00 00    	js     f0106b56 <syscall+0xab1>
+f0106212:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+f0106216:	01 43 0c             	add    %eax,0xc(%ebx)
+f0106219:	11 53 10             	adc    %edx,0x10(%ebx)
+f010621c:	8b 4b 18             	mov    0x18(%ebx),%ecx
+f010621f:	39 43 14             	cmp    %eax,0x14(%ebx)
+f0106222:	19 d1                	sbb    %edx,%ecx
+f0106224:	73 06                	jae    f010622c <syscall+0x187>
+f0106226:	89 43 14             	mov    %eax,0x14(%ebx)
+f0106229:	89 53 18             	mov    %edx,0x18(%ebx)
+f010622c:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f010622f:	85 db                	test   %ebx,%ebx
+f0106231:	74 1c                	je     f010624f <syscall+0x1aa>
+f0106233:	8b 0d c0 41 1a f0    	mov    0xf01a41c0,%ecx
+f0106239:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f010623c:	29 f9                	sub    %edi,%ecx
+f010623e:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+f0106244:	77 09                	ja     f010624f <syscall+0x1aa>
+f0106246:	89 73 1c             	mov    %esi,0x1c(%ebx)
+f0106249:	89 43 20             	mov    %eax,0x20(%ebx)
+f010624c:	89 53 24             	mov    %edx,0x24(%ebx)
+f010624f:	89 f0                	mov    %esi,%eax
+f0106251:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106254:	5b                   	pop    %ebx
+f0106255:	5e                   	pop    %esi
+f0106256:	5f                   	pop    %edi
+f0106257:	5d                   	pop    %ebp
+f0106258:	c3                   	ret
+f0106259:	e8 c6 a6 ff ff       	call   f0100924 <cons_getc>
+f010625e:	89 c6                	mov    %eax,%esi
+f0106260:	eb 9c                	jmp    f01061fe <syscall+0x159>
+f0106262:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0106268:	8b 40 04             	mov    0x4(%eax),%eax
+f010626b:	8b 70 40             	mov    0x40(%eax),%esi
+f010626e:	eb 8e                	jmp    f01061fe <syscall+0x159>
+f0106270:	83 ec 04             	sub    $0x4,%esp
+f0106273:	6a 01                	push   $0x1
+f0106275:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0106278:	50                   	push   %eax
+f0106279:	ff 75 0c             	push   0xc(%ebp)
+f010627c:	e8 37 e0 ff ff       	call   f01042b8 <envid2env>
+f0106281:	89 c6                	mov    %eax,%esi
+f0106283:	83 c4 10             	add    $0x10,%esp
+f0106286:	85 c0                	test   %eax,%eax
+f0106288:	0f 88 70 ff ff ff    	js     f01061fe <syscall+0x159>
+f010628e:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0106295:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106298:	39 42 04             	cmp    %eax,0x4(%edx)
+f010629b:	74 38                	je     f01062d5 <syscall+0x230>
+f010629d:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f01062a4:	83 ec 04             	sub    $0x4,%esp
+f01062a7:	ff 70 40             	push   0x40(%eax)
+f01062aa:	8b 42 04             	mov    0x4(%edx),%eax
+f01062ad:	ff 70 40             	push   0x40(%eax)
+f01062b0:	68 a1 ba 10 f0       	push   $0xf010baa1
+f01062b5:	e8 69 ed ff ff       	call   f0105023 <cprintf>
+f01062ba:	83 c4 10             	add    $0x10,%esp
+f01062bd:	83 ec 0c             	sub    $0xc,%esp
+f01062c0:	ff 75 e4             	push   -0x1c(%ebp)
+f01062c3:	e8 bb e6 ff ff       	call   f0104983 <env_destroy>
+f01062c8:	83 c4 10             	add    $0x10,%esp
+f01062cb:	be 00 00 00 00       	mov    $0x0,%esi
+f01062d0:	e9 29 ff ff ff       	jmp    f01061fe <syscall+0x159>
+f01062d5:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01062db:	83 ec 08             	sub    $0x8,%esp
+f01062de:	8b 40 04             	mov    0x4(%eax),%eax
+f01062e1:	ff 70 40             	push   0x40(%eax)
+f01062e4:	68 86 ba 10 f0       	push   $0xf010ba86
+f01062e9:	e8 35 ed ff ff       	call   f0105023 <cprintf>
+f01062ee:	83 c4 10             	add    $0x10,%esp
+f01062f1:	eb ca                	jmp    f01062bd <syscall+0x218>
+f01062f3:	e8 c4 fc ff ff       	call   f0105fbc <sched_yield>
+f01062f8:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01062fe:	83 ec 08             	sub    $0x8,%esp
+f0106301:	8b 40 04             	mov    0x4(%eax),%eax
+f0106304:	ff 70 40             	push   0x40(%eax)
+f0106307:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010630a:	50                   	push   %eax
+f010630b:	e8 b2 e0 ff ff       	call   f01043c2 <env_alloc>
+f0106310:	89 c6                	mov    %eax,%esi
+f0106312:	83 c4 10             	add    $0x10,%esp
+f0106315:	85 c0                	test   %eax,%eax
+f0106317:	0f 88 e1 fe ff ff    	js     f01061fe <syscall+0x159>
+f010631d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106320:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+f0106326:	e8 4f e7 ff ff       	call   f0104a7a <env_cur_tf>
+f010632b:	89 c6                	mov    %eax,%esi
+f010632d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106330:	8d b8 80 00 00 00    	lea    0x80(%eax),%edi
+f0106336:	b9 11 00 00 00       	mov    $0x11,%ecx
+f010633b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f010633d:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0106344:	8b 52 04             	mov    0x4(%edx),%edx
+f0106347:	8b 52 54             	mov    0x54(%edx),%edx
+f010634a:	89 50 54             	mov    %edx,0x54(%eax)
+f010634d:	83 ec 0c             	sub    $0xc,%esp
+f0106350:	50                   	push   %eax
+f0106351:	e8 d1 e8 ff ff       	call   f0104c27 <env_fpu_copy>
+f0106356:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106359:	c7 80 9c 00 00 00 00 	movl   $0x0,0x9c(%eax)
+f0106360:	00 00 00 
+f0106363:	8b 70 40             	mov    0x40(%eax),%esi
+f0106366:	83 c4 10             	add    $0x10,%esp
+f0106369:	e9 90 fe ff ff       	jmp    f01061fe <syscall+0x159>
+f010636e:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106371:	83 e8 02             	sub    $0x2,%eax
+f0106374:	a9 fd ff ff ff       	test   $0xfffffffd,%eax
+f0106379:	0f 85 9b 07 00 00    	jne    f0106b1a <syscall+0xa75>
+f010637f:	83 ec 04             	sub    $0x4,%esp
+f0106382:	6a 01                	push   $0x1
+f0106384:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0106387:	50                   	push   %eax
+f0106388:	ff 75 0c             	push   0xc(%ebp)
+f010638b:	e8 28 df ff ff       	call   f01042b8 <envid2env>
+f0106390:	89 c6                	mov    %eax,%esi
+f0106392:	83 c4 10             	add    $0x10,%esp
+f0106395:	85 c0                	test   %eax,%eax
+f0106397:	0f 85 61 fe ff ff    	jne    f01061fe <syscall+0x159>
+f010639d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01063a0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f01063a3:	89 08                	mov    %ecx,(%eax)
+f01063a5:	e9 54 fe ff ff       	jmp    f01061fe <syscall+0x159>
+f01063aa:	81 7d 10 ff ff ff ea 	cmpl   $0xeaffffff,0x10(%ebp)
+f01063b1:	0f 87 9b 00 00 00    	ja     f0106452 <syscall+0x3ad>
+f01063b7:	8b 55 10             	mov    0x10(%ebp),%edx
+f01063ba:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+f01063c0:	81 7d 10 00 f0 3f 00 	cmpl   $0x3ff000,0x10(%ebp)
+f01063c7:	0f 84 8f 00 00 00    	je     f010645c <syscall+0x3b7>
+f01063cd:	8b 45 14             	mov    0x14(%ebp),%eax
+f01063d0:	25 f8 01 00 00       	and    $0x1f8,%eax
+f01063d5:	09 d0                	or     %edx,%eax
+f01063d7:	0f 85 89 00 00 00    	jne    f0106466 <syscall+0x3c1>
+f01063dd:	83 ec 04             	sub    $0x4,%esp
+f01063e0:	6a 01                	push   $0x1
+f01063e2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01063e5:	50                   	push   %eax
+f01063e6:	ff 75 0c             	push   0xc(%ebp)
+f01063e9:	e8 ca de ff ff       	call   f01042b8 <envid2env>
+f01063ee:	83 c4 10             	add    $0x10,%esp
+f01063f1:	85 c0                	test   %eax,%eax
+f01063f3:	75 7b                	jne    f0106470 <syscall+0x3cb>
+f01063f5:	83 ec 08             	sub    $0x8,%esp
+f01063f8:	ff 75 10             	push   0x10(%ebp)
+f01063fb:	ff 75 e4             	push   -0x1c(%ebp)
+f01063fe:	e8 9d bb ff ff       	call   f0101fa0 <env_page_charge>
+f0106403:	83 c4 10             	add    $0x10,%esp
+f0106406:	85 c0                	test   %eax,%eax
+f0106408:	78 70                	js     f010647a <syscall+0x3d5>
+f010640a:	83 ec 0c             	sub    $0xc,%esp
+f010640d:	6a 03                	push   $0x3
+f010640f:	e8 52 b9 ff ff       	call   f0101d66 <page_alloc>
+f0106414:	89 c7                	mov    %eax,%edi
+f0106416:	83 c4 10             	add    $0x10,%esp
+f0106419:	85 c0                	test   %eax,%eax
+f010641b:	74 67                	je     f0106484 <syscall+0x3df>
+f010641d:	ff 75 14             	push   0x14(%ebp)
+f0106420:	ff 75 10             	push   0x10(%ebp)
+f0106423:	50                   	push   %eax
+f0106424:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106427:	ff 70 50             	push   0x50(%eax)
+f010642a:	e8 b9 bc ff ff       	call   f01020e8 <page_insert>
+f010642f:	89 c6                	mov    %eax,%esi
+f0106431:	83 c4 10             	add    $0x10,%esp
+f0106434:	85 c0                	test   %eax,%eax
+f0106436:	0f 84 c2 fd ff ff    	je     f01061fe <syscall+0x159>
+f010643c:	83 ec 0c             	sub    $0xc,%esp
+f010643f:	57                   	push   %edi
+f0106440:	e8 f5 b4 ff ff       	call   f010193a <page_free>
+f0106445:	83 c4 10             	add    $0x10,%esp
+f0106448:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f010644d:	e9 ac fd ff ff       	jmp    f01061fe <syscall+0x159>
+f0106452:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0106457:	e9 a2 fd ff ff       	jmp    f01061fe <syscall+0x159>
+f010645c:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0106461:	e9 98 fd ff ff       	jmp    f01061fe <syscall+0x159>
+f0106466:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f010646b:	e9 8e fd ff ff       	jmp    f01061fe <syscall+0x159>
+f0106470:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f0106475:	e9 84 fd ff ff       	jmp    f01061fe <syscall+0x159>
+f010647a:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f010647f:	e9 7a fd ff ff       	jmp    f01061fe <syscall+0x159>
+f0106484:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f0106489:	e9 70 fd ff ff       	jmp    f01061fe <syscall+0x159>
+f010648e:	81 7d 10 ff ff ff ea 	cmpl   $0xeaffffff,0x10(%ebp)
+f0106495:	0f 87 d7 00 00 00    	ja     f0106572 <syscall+0x4cd>
+f010649b:	8b 55 10             	mov    0x10(%ebp),%edx
+f010649e:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+f01064a4:	81 7d 18 ff ff ff ea 	cmpl   $0xeaffffff,0x18(%ebp)
+f01064ab:	0f 87 cb 00 00 00    	ja     f010657c <syscall+0x4d7>
+f01064b1:	8b 4d 18             	mov    0x18(%ebp),%ecx
+f01064b4:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+f01064ba:	81 7d 18 00 f0 3f 00 	cmpl   $0x3ff000,0x18(%ebp)
+f01064c1:	0f 84 bf 00 00 00    	je     f0106586 <syscall+0x4e1>
+f01064c7:	8b 45 1c             	mov    0x1c(%ebp),%eax
+f01064ca:	25 f8 01 00 00       	and    $0x1f8,%eax
+f01064cf:	09 c8                	or     %ecx,%eax
+f01064d1:	09 d0                	or     %edx,%eax
+f01064d3:	0f 85 b7 00 00 00    	jne    f0106590 <syscall+0x4eb>
+f01064d9:	83 ec 04             	sub    $0x4,%esp
+f01064dc:	6a 01                	push   $0x1
+f01064de:	8d 45 dc             	lea    -0x24(%ebp),%eax
+f01064e1:	50                   	push   %eax
+f01064e2:	ff 75 0c             	push   0xc(%ebp)
+f01064e5:	e8 ce dd ff ff       	call   f01042b8 <envid2env>
+f01064ea:	89 c6                	mov    %eax,%esi
+f01064ec:	83 c4 10             	add    $0x10,%esp
+f01064ef:	85 c0                	test   %eax,%eax
+f01064f1:	0f 85 07 fd ff ff    	jne    f01061fe <syscall+0x159>
+f01064f7:	83 ec 04             	sub    $0x4,%esp
+f01064fa:	6a 01                	push   $0x1
+f01064fc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f01064ff:	50                   	push   %eax
+f0106500:	ff 75 14             	push   0x14(%ebp)
+f0106503:	e8 b0 dd ff ff       	call   f01042b8 <envid2env>
+f0106508:	89 c6                	mov    %eax,%esi
+f010650a:	83 c4 10             	add    $0x10,%esp
+f010650d:	85 c0                	test   %eax,%eax
+f010650f:	0f 85 e9 fc ff ff    	jne    f01061fe <syscall+0x159>
+f0106515:	83 ec 04             	sub    $0x4,%esp
+f0106518:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010651b:	50                   	push   %eax
+f010651c:	ff 75 10             	push   0x10(%ebp)
+f010651f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0106522:	ff 70 50             	push   0x50(%eax)
+f0106525:	e8 17 ba ff ff       	call   f0101f41 <page_lookup>
+f010652a:	89 c6                	mov    %eax,%esi
+f010652c:	83 c4 10             	add    $0x10,%esp
+f010652f:	85 c0                	test   %eax,%eax
+f0106531:	74 67                	je     f010659a <syscall+0x4f5>
+f0106533:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106536:	f6 00 02             	testb  $0x2,(%eax)
+f0106539:	75 06                	jne    f0106541 <syscall+0x49c>
+f010653b:	f6 45 1c 02          	testb  $0x2,0x1c(%ebp)
+f010653f:	75 63                	jne    f01065a4 <syscall+0x4ff>
+f0106541:	83 ec 08             	sub    $0x8,%esp
+f0106544:	ff 75 18             	push   0x18(%ebp)
+f0106547:	ff 75 e0             	push   -0x20(%ebp)
+f010654a:	e8 51 ba ff ff       	call   f0101fa0 <env_page_charge>
+f010654f:	83 c4 10             	add    $0x10,%esp
+f0106552:	85 c0                	test   %eax,%eax
+f0106554:	78 58                	js     f01065ae <syscall+0x509>
+f0106556:	ff 75 1c             	push   0x1c(%ebp)
+f0106559:	ff 75 18             	push   0x18(%ebp)
+f010655c:	56                   	push   %esi
+f010655d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106560:	ff 70 50             	push   0x50(%eax)
+f0106563:	e8 80 bb ff ff       	call   f01020e8 <page_insert>
+f0106568:	89 c6                	mov    %eax,%esi
+f010656a:	83 c4 10             	add    $0x10,%esp
+f010656d:	e9 8c fc ff ff       	jmp    f01061fe <syscall+0x159>
+f0106572:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0106577:	e9 82 fc ff ff       	jmp    f01061fe <syscall+0x159>
+f010657c:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0106581:	e9 78 fc ff ff       	jmp    f01061fe <syscall+0x159>
+f0106586:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f010658b:	e9 6e fc ff ff       	jmp    f01061fe <syscall+0x159>
+f0106590:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0106595:	e9 64 fc ff ff       	jmp    f01061fe <syscall+0x159>
+f010659a:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f010659f:	e9 5a fc ff ff       	jmp    f01061fe <syscall+0x159>
+f01065a4:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f01065a9:	e9 50 fc ff ff       	jmp    f01061fe <syscall+0x159>
+f01065ae:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f01065b3:	e9 46 fc ff ff       	jmp    f01061fe <syscall+0x159>
+f01065b8:	81 7d 10 ff ff ff ea 	cmpl   $0xeaffffff,0x10(%ebp)
+f01065bf:	77 49                	ja     f010660a <syscall+0x565>
+f01065c1:	f7 45 10 ff 0f 00 00 	testl  $0xfff,0x10(%ebp)
+f01065c8:	75 4a                	jne    f0106614 <syscall+0x56f>
+f01065ca:	81 7d 10 00 f0 3f 00 	cmpl   $0x3ff000,0x10(%ebp)
+f01065d1:	74 41                	je     f0106614 <syscall+0x56f>
+f01065d3:	83 ec 04             	sub    $0x4,%esp
+f01065d6:	6a 01                	push   $0x1
+f01065d8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01065db:	50                   	push   %eax
+f01065dc:	ff 75 0c             	push   0xc(%ebp)
+f01065df:	e8 d4 dc ff ff       	call   f01042b8 <envid2env>
+f01065e4:	89 c6                	mov    %eax,%esi
+f01065e6:	83 c4 10             	add    $0x10,%esp
+f01065e9:	85 c0                	test   %eax,%eax
+f01065eb:	0f 85 0d fc ff ff    	jne    f01061fe <syscall+0x159>
+f01065f1:	83 ec 08             	sub    $0x8,%esp
+f01065f4:	ff 75 10             	push   0x10(%ebp)
+f01065f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01065fa:	ff 70 50             	push   0x50(%eax)
+f01065fd:	e8 02 ba ff ff       	call   f0102004 <page_remove>
+f0106602:	83 c4 10             	add    $0x10,%esp
+f0106605:	e9 f4 fb ff ff       	jmp    f01061fe <syscall+0x159>
+f010660a:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f010660f:	e9 ea fb ff ff       	jmp    f01061fe <syscall+0x159>
+f0106614:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0106619:	e9 e0 fb ff ff       	jmp    f01061fe <syscall+0x159>
+f010661e:	83 ec 04             	sub    $0x4,%esp
+f0106621:	6a 01                	push   $0x1
+f0106623:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0106626:	50                   	push   %eax
+f0106627:	ff 75 0c             	push   0xc(%ebp)
+f010662a:	e8 89 dc ff ff       	call   f01042b8 <envid2env>
+f010662f:	89 c6                	mov    %eax,%esi
+f0106631:	83 c4 10             	add    $0x10,%esp
+f0106634:	85 c0                	test   %eax,%eax
+f0106636:	0f 85 c2 fb ff ff    	jne    f01061fe <syscall+0x159>
+f010663c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010663f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0106642:	89 48 58             	mov    %ecx,0x58(%eax)
+f0106645:	e9 b4 fb ff ff       	jmp    f01061fe <syscall+0x159>
+f010664a:	83 ec 04             	sub    $0x4,%esp
+f010664d:	6a 00                	push   $0x0
+f010664f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0106652:	50                   	push   %eax
+f0106653:	ff 75 0c             	push   0xc(%ebp)
+f0106656:	e8 5d dc ff ff       	call   f01042b8 <envid2env>
+f010665b:	89 c6                	mov    %eax,%esi
+f010665d:	83 c4 10             	add    $0x10,%esp
+f0106660:	85 c0                	test   %eax,%eax
+f0106662:	0f 85 96 01 00 00    	jne    f01067fe <syscall+0x759>
+f0106668:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010666b:	80 b8 00 01 00 00 00 	cmpb   $0x0,0x100(%eax)
+f0106672:	0f 84 90 01 00 00    	je     f0106808 <syscall+0x763>
+f0106678:	81 7d 14 ff ff ff ea 	cmpl   $0xeaffffff,0x14(%ebp)
+f010667f:	76 4f                	jbe    f01066d0 <syscall+0x62b>
+f0106681:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0106684:	89 88 08 01 00 00    	mov    %ecx,0x108(%eax)
+f010668a:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0106691:	8b 52 04             	mov    0x4(%edx),%edx
+f0106694:	8b 52 40             	mov    0x40(%edx),%edx
+f0106697:	89 90 0c 01 00 00    	mov    %edx,0x10c(%eax)
+f010669d:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+f01066a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01066a6:	c6 80 00 01 00 00 00 	movb   $0x0,0x100(%eax)
+f01066ad:	f6 05 f4 73 11 f0 10 	testb  $0x10,0xf01173f4
+f01066b4:	0f 84 44 fb ff ff    	je     f01061fe <syscall+0x159>
+f01066ba:	56                   	push   %esi
+f01066bb:	ff 75 10             	push   0x10(%ebp)
+f01066be:	ff 75 0c             	push   0xc(%ebp)
+f01066c1:	6a 04                	push   $0x4
+f01066c3:	e8 8b 12 00 00       	call   f0107953 <ktrace_record>
+f01066c8:	83 c4 10             	add    $0x10,%esp
+f01066cb:	e9 2e fb ff ff       	jmp    f01061fe <syscall+0x159>
+f01066d0:	f7 45 14 ff 0f 00 00 	testl  $0xfff,0x14(%ebp)
+f01066d7:	0f 85 03 01 00 00    	jne    f01067e0 <syscall+0x73b>
+f01066dd:	81 b8 04 01 00 00 ff 	cmpl   $0xeaffffff,0x104(%eax)
+f01066e4:	ff ff ea 
+f01066e7:	0f 87 c2 00 00 00    	ja     f01067af <syscall+0x70a>
+f01066ed:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f01066f2:	f6 45 18 05          	testb  $0x5,0x18(%ebp)
+f01066f6:	74 b5                	je     f01066ad <syscall+0x608>
+f01066f8:	f7 45 18 f8 f1 ff ff 	testl  $0xfffff1f8,0x18(%ebp)
+f01066ff:	75 ac                	jne    f01066ad <syscall+0x608>
+f0106701:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0106707:	83 ec 04             	sub    $0x4,%esp
+f010670a:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f010670d:	52                   	push   %edx
+f010670e:	ff 75 14             	push   0x14(%ebp)
+f0106711:	8b 40 04             	mov    0x4(%eax),%eax
+f0106714:	ff 70 50             	push   0x50(%eax)
+f0106717:	e8 25 b8 ff ff       	call   f0101f41 <page_lookup>
+f010671c:	89 c7                	mov    %eax,%edi
+f010671e:	83 c4 10             	add    $0x10,%esp
+f0106721:	85 c0                	test   %eax,%eax
+f0106723:	0f 84 c1 00 00 00    	je     f01067ea <syscall+0x745>
+f0106729:	f6 45 18 02          	testb  $0x2,0x18(%ebp)
+f010672d:	74 0c                	je     f010673b <syscall+0x696>
+f010672f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106732:	f6 00 02             	testb  $0x2,(%eax)
+f0106735:	0f 84 72 ff ff ff    	je     f01066ad <syscall+0x608>
+f010673b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010673e:	83 ec 08             	sub    $0x8,%esp
+f0106741:	ff b0 04 01 00 00    	push   0x104(%eax)
+f0106747:	50                   	push   %eax
+f0106748:	e8 53 b8 ff ff       	call   f0101fa0 <env_page_charge>
+f010674d:	83 c4 10             	add    $0x10,%esp
+f0106750:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f0106755:	85 c0                	test   %eax,%eax
+f0106757:	0f 88 50 ff ff ff    	js     f01066ad <syscall+0x608>
+f010675d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106760:	ff 75 18             	push   0x18(%ebp)
+f0106763:	ff b0 04 01 00 00    	push   0x104(%eax)
+f0106769:	57                   	push   %edi
+f010676a:	ff 70 50             	push   0x50(%eax)
+f010676d:	e8 76 b9 ff ff       	call   f01020e8 <page_insert>
+f0106772:	89 c6                	mov    %eax,%esi
+f0106774:	83 c4 10             	add    $0x10,%esp
+f0106777:	85 c0                	test   %eax,%eax
+f0106779:	75 79                	jne    f01067f4 <syscall+0x74f>
+f010677b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010677e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0106781:	89 88 08 01 00 00    	mov    %ecx,0x108(%eax)
+f0106787:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f010678e:	8b 52 04             	mov    0x4(%edx),%edx
+f0106791:	8b 52 40             	mov    0x40(%edx),%edx
+f0106794:	89 90 0c 01 00 00    	mov    %edx,0x10c(%eax)
+f010679a:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+f01067a0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01067a3:	c6 80 00 01 00 00 00 	movb   $0x0,0x100(%eax)
+f01067aa:	e9 fe fe ff ff       	jmp    f01066ad <syscall+0x608>
+f01067af:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f01067b2:	89 88 08 01 00 00    	mov    %ecx,0x108(%eax)
+f01067b8:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f01067bf:	8b 52 04             	mov    0x4(%edx),%edx
+f01067c2:	8b 52 40             	mov    0x40(%edx),%edx
+f01067c5:	89 90 0c 01 00 00    	mov    %edx,0x10c(%eax)
+f01067cb:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+f01067d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01067d4:	c6 80 00 01 00 00 00 	movb   $0x0,0x100(%eax)
+f01067db:	e9 cd fe ff ff       	jmp    f01066ad <syscall+0x608>
+f01067e0:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f01067e5:	e9 c3 fe ff ff       	jmp    f01066ad <syscall+0x608>
+f01067ea:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f01067ef:	e9 b9 fe ff ff       	jmp    f01066ad <syscall+0x608>
+f01067f4:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f01067f9:	e9 af fe ff ff       	jmp    f01066ad <syscall+0x608>
+f01067fe:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f0106803:	e9 a5 fe ff ff       	jmp    f01066ad <syscall+0x608>
+f0106808:	be f9 ff ff ff       	mov    $0xfffffff9,%esi
+f010680d:	e9 9b fe ff ff       	jmp    f01066ad <syscall+0x608>
+f0106812:	f6 05 f4 73 11 f0 20 	testb  $0x20,0xf01173f4
+f0106819:	75 29                	jne    f0106844 <syscall+0x79f>
+f010681b:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+f0106822:	74 0d                	je     f0106831 <syscall+0x78c>
+f0106824:	81 7d 0c ff ff ff ea 	cmpl   $0xeaffffff,0xc(%ebp)
+f010682b:	0f 86 f3 02 00 00    	jbe    f0106b24 <syscall+0xa7f>
+f0106831:	81 7d 0c 00 f0 3f 00 	cmpl   $0x3ff000,0xc(%ebp)
+f0106838:	75 1d                	jne    f0106857 <syscall+0x7b2>
+f010683a:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f010683f:	e9 ba f9 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106844:	6a 00                	push   $0x0
+f0106846:	6a 00                	push   $0x0
+f0106848:	ff 75 0c             	push   0xc(%ebp)
+f010684b:	6a 05                	push   $0x5
+f010684d:	e8 01 11 00 00       	call   f0107953 <ktrace_record>
+f0106852:	83 c4 10             	add    $0x10,%esp
+f0106855:	eb c4                	jmp    f010681b <syscall+0x776>
+f0106857:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010685d:	8b 40 04             	mov    0x4(%eax),%eax
+f0106860:	c6 80 00 01 00 00 01 	movb   $0x1,0x100(%eax)
+f0106867:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010686d:	8b 40 04             	mov    0x4(%eax),%eax
+f0106870:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0106873:	89 b0 04 01 00 00    	mov    %esi,0x104(%eax)
+f0106879:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010687f:	8b 40 04             	mov    0x4(%eax),%eax
+f0106882:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+f0106888:	e8 ed e1 ff ff       	call   f0104a7a <env_cur_tf>
+f010688d:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+f0106894:	e8 23 f7 ff ff       	call   f0105fbc <sched_yield>
+f0106899:	83 ec 04             	sub    $0x4,%esp
+f010689c:	6a 01                	push   $0x1
+f010689e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01068a1:	50                   	push   %eax
+f01068a2:	ff 75 0c             	push   0xc(%ebp)
+f01068a5:	e8 0e da ff ff       	call   f01042b8 <envid2env>
+f01068aa:	89 c6                	mov    %eax,%esi
+f01068ac:	83 c4 10             	add    $0x10,%esp
+f01068af:	85 c0                	test   %eax,%eax
+f01068b1:	0f 88 47 f9 ff ff    	js     f01061fe <syscall+0x159>
+f01068b7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f01068bb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01068be:	0f 95 40 5c          	setne  0x5c(%eax)
+f01068c2:	be 00 00 00 00       	mov    $0x0,%esi
+f01068c7:	e9 32 f9 ff ff       	jmp    f01061fe <syscall+0x159>
+f01068cc:	81 7d 10 ff ff ff ea 	cmpl   $0xeaffffff,0x10(%ebp)
+f01068d3:	77 42                	ja     f0106917 <syscall+0x872>
+f01068d5:	f7 45 10 ff 0f 00 00 	testl  $0xfff,0x10(%ebp)
+f01068dc:	75 43                	jne    f0106921 <syscall+0x87c>
+f01068de:	83 ec 04             	sub    $0x4,%esp
+f01068e1:	6a 01                	push   $0x1
+f01068e3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01068e6:	50                   	push   %eax
+f01068e7:	ff 75 0c             	push   0xc(%ebp)
+f01068ea:	e8 c9 d9 ff ff       	call   f01042b8 <envid2env>
+f01068ef:	89 c6                	mov    %eax,%esi
+f01068f1:	83 c4 10             	add    $0x10,%esp
+f01068f4:	85 c0                	test   %eax,%eax
+f01068f6:	0f 88 02 f9 ff ff    	js     f01061fe <syscall+0x159>
+f01068fc:	83 ec 08             	sub    $0x8,%esp
+f01068ff:	ff 75 10             	push   0x10(%ebp)
+f0106902:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106905:	ff 70 50             	push   0x50(%eax)
+f0106908:	e8 5d b7 ff ff       	call   f010206a <page_cow_reuse>
+f010690d:	89 c6                	mov    %eax,%esi
+f010690f:	83 c4 10             	add    $0x10,%esp
+f0106912:	e9 e7 f8 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106917:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f010691c:	e9 dd f8 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106921:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0106926:	e9 d3 f8 ff ff       	jmp    f01061fe <syscall+0x159>
+f010692b:	83 ec 04             	sub    $0x4,%esp
+f010692e:	6a 01                	push   $0x1
+f0106930:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0106933:	50                   	push   %eax
+f0106934:	ff 75 0c             	push   0xc(%ebp)
+f0106937:	e8 7c d9 ff ff       	call   f01042b8 <envid2env>
+f010693c:	89 c6                	mov    %eax,%esi
+f010693e:	83 c4 10             	add    $0x10,%esp
+f0106941:	85 c0                	test   %eax,%eax
+f0106943:	0f 88 b5 f8 ff ff    	js     f01061fe <syscall+0x159>
+f0106949:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010694f:	8b 40 04             	mov    0x4(%eax),%eax
+f0106952:	83 78 54 00          	cmpl   $0x0,0x54(%eax)
+f0106956:	74 17                	je     f010696f <syscall+0x8ca>
+f0106958:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f010695c:	74 24                	je     f0106982 <syscall+0x8dd>
+f010695e:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0106964:	8b 40 04             	mov    0x4(%eax),%eax
+f0106967:	8b 75 10             	mov    0x10(%ebp),%esi
+f010696a:	39 70 54             	cmp    %esi,0x54(%eax)
+f010696d:	72 1d                	jb     f010698c <syscall+0x8e7>
+f010696f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106972:	8b 75 10             	mov    0x10(%ebp),%esi
+f0106975:	89 70 54             	mov    %esi,0x54(%eax)
+f0106978:	be 00 00 00 00       	mov    $0x0,%esi
+f010697d:	e9 7c f8 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106982:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0106987:	e9 72 f8 ff ff       	jmp    f01061fe <syscall+0x159>
+f010698c:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0106991:	e9 68 f8 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106996:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010699c:	8b 40 04             	mov    0x4(%eax),%eax
+f010699f:	83 78 64 00          	cmpl   $0x0,0x64(%eax)
+f01069a3:	0f 85 85 01 00 00    	jne    f0106b2e <syscall+0xa89>
+f01069a9:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01069af:	83 ec 08             	sub    $0x8,%esp
+f01069b2:	68 00 e0 3f 00       	push   $0x3fe000
+f01069b7:	ff 70 04             	push   0x4(%eax)
+f01069ba:	e8 e1 b5 ff ff       	call   f0101fa0 <env_page_charge>
+f01069bf:	83 c4 10             	add    $0x10,%esp
+f01069c2:	85 c0                	test   %eax,%eax
+f01069c4:	0f 88 6e 01 00 00    	js     f0106b38 <syscall+0xa93>
+f01069ca:	83 ec 0c             	sub    $0xc,%esp
+f01069cd:	6a 01                	push   $0x1
+f01069cf:	e8 92 b3 ff ff       	call   f0101d66 <page_alloc>
+f01069d4:	89 c6                	mov    %eax,%esi
+f01069d6:	83 c4 10             	add    $0x10,%esp
+f01069d9:	85 c0                	test   %eax,%eax
+f01069db:	0f 84 61 01 00 00    	je     f0106b42 <syscall+0xa9d>
+f01069e1:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01069e7:	6a 07                	push   $0x7
+f01069e9:	68 00 e0 3f 00       	push   $0x3fe000
+f01069ee:	56                   	push   %esi
+f01069ef:	8b 40 04             	mov    0x4(%eax),%eax
+f01069f2:	ff 70 50             	push   0x50(%eax)
+f01069f5:	e8 ee b6 ff ff       	call   f01020e8 <page_insert>
+f01069fa:	83 c4 10             	add    $0x10,%esp
+f01069fd:	85 c0                	test   %eax,%eax
+f01069ff:	78 3d                	js     f0106a3e <syscall+0x999>
+f0106a01:	66 83 46 04 01       	addw   $0x1,0x4(%esi)
+f0106a06:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0106a0c:	8b 40 04             	mov    0x4(%eax),%eax
+f0106a0f:	2b 35 10 37 1a f0    	sub    0xf01a3710,%esi
+f0106a15:	c1 fe 03             	sar    $0x3,%esi
+f0106a18:	89 f2                	mov    %esi,%edx
+f0106a1a:	c1 e2 0c             	shl    $0xc,%edx
+f0106a1d:	81 e6 ff ff 0f 00    	and    $0xfffff,%esi
+f0106a23:	3b 35 18 37 1a f0    	cmp    0xf01a3718,%esi
+f0106a29:	73 29                	jae    f0106a54 <syscall+0x9af>
+f0106a2b:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0106a31:	89 50 64             	mov    %edx,0x64(%eax)
+f0106a34:	be 00 00 00 00       	mov    $0x0,%esi
+f0106a39:	e9 c0 f7 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106a3e:	83 ec 0c             	sub    $0xc,%esp
+f0106a41:	56                   	push   %esi
+f0106a42:	e8 f3 ae ff ff       	call   f010193a <page_free>
+f0106a47:	83 c4 10             	add    $0x10,%esp
+f0106a4a:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f0106a4f:	e9 aa f7 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106a54:	52                   	push   %edx
+f0106a55:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0106a5a:	6a 71                	push   $0x71
+f0106a5c:	68 52 b1 10 f0       	push   $0xf010b152
+f0106a61:	e8 c5 96 ff ff       	call   f010012b <_panic>
+f0106a66:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0106a6c:	8b 40 04             	mov    0x4(%eax),%eax
+f0106a6f:	83 78 64 00          	cmpl   $0x0,0x64(%eax)
+f0106a73:	0f 84 d3 00 00 00    	je     f0106b4c <syscall+0xaa7>
+f0106a79:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0106a7f:	8b 40 04             	mov    0x4(%eax),%eax
+f0106a82:	e8 d8 00 00 00       	call   f0106b5f <sysring_run>
+f0106a87:	89 c6                	mov    %eax,%esi
+f0106a89:	e9 70 f7 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106a8e:	83 ec 04             	sub    $0x4,%esp
+f0106a91:	6a 01                	push   $0x1
+f0106a93:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0106a96:	50                   	push   %eax
+f0106a97:	ff 75 0c             	push   0xc(%ebp)
+f0106a9a:	e8 19 d8 ff ff       	call   f01042b8 <envid2env>
+f0106a9f:	89 c6                	mov    %eax,%esi
+f0106aa1:	83 c4 10             	add    $0x10,%esp
+f0106aa4:	85 c0                	test   %eax,%eax
+f0106aa6:	0f 88 52 f7 ff ff    	js     f01061fe <syscall+0x159>
+f0106aac:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0106ab0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106ab3:	0f 95 40 5d          	setne  0x5d(%eax)
+f0106ab7:	be 00 00 00 00       	mov    $0x0,%esi
+f0106abc:	e9 3d f7 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106ac1:	83 ec 04             	sub    $0x4,%esp
+f0106ac4:	6a 01                	push   $0x1
+f0106ac6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0106ac9:	50                   	push   %eax
+f0106aca:	ff 75 0c             	push   0xc(%ebp)
+f0106acd:	e8 e6 d7 ff ff       	call   f01042b8 <envid2env>
+f0106ad2:	89 c6                	mov    %eax,%esi
+f0106ad4:	83 c4 10             	add    $0x10,%esp
+f0106ad7:	85 c0                	test   %eax,%eax
+f0106ad9:	0f 88 1f f7 ff ff    	js     f01061fe <syscall+0x159>
+f0106adf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106ae2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0106ae6:	0f 95 40 5e          	setne  0x5e(%eax)
+f0106aea:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0106af1:	be 00 00 00 00       	mov    $0x0,%esi
+f0106af6:	3b 42 04             	cmp    0x4(%edx),%eax
+f0106af9:	0f 85 ff f6 ff ff    	jne    f01061fe <syscall+0x159>
+f0106aff:	83 ec 0c             	sub    $0xc,%esp
+f0106b02:	50                   	push   %eax
+f0106b03:	e8 38 19 00 00       	call   f0108440 <pmu_restore>
+f0106b08:	83 c4 10             	add    $0x10,%esp
+f0106b0b:	e9 ee f6 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106b10:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0106b15:	e9 e4 f6 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106b1a:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0106b1f:	e9 da f6 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106b24:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0106b29:	e9 d0 f6 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106b2e:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0106b33:	e9 c6 f6 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106b38:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f0106b3d:	e9 bc f6 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106b42:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f0106b47:	e9 b2 f6 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106b4c:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0106b51:	e9 a8 f6 ff ff       	jmp    f01061fe <syscall+0x159>
+f0106b56:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+f0106b5a:	e9 b3 f6 ff ff       	jmp    f0106212 <syscall+0x16d>
+
+f0106b5f <sysring_run>:
+f0106b5f:	55                   	push   %ebp
+f0106b60:	89 e5                	mov    %esp,%ebp
+f0106b62:	57                   	push   %edi
+f0106b63:	56                   	push   %esi
+f0106b64:	53                   	push   %ebx
+f0106b65:	83 ec 2c             	sub    $0x2c,%esp
+f0106b68:	8b 78 64             	mov    0x64(%eax),%edi
+f0106b6b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0106b72:	eb 25                	jmp    f0106b99 <sysring_run+0x3a>
+f0106b74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106b79:	89 84 df 14 07 00 00 	mov    %eax,0x714(%edi,%ebx,8)
+f0106b80:	8b 47 0c             	mov    0xc(%edi),%eax
+f0106b83:	83 c0 01             	add    $0x1,%eax
+f0106b86:	89 47 0c             	mov    %eax,0xc(%edi)
+f0106b89:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+f0106b8d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106b90:	83 f8 40             	cmp    $0x40,%eax
+f0106b93:	0f 84 a2 00 00 00    	je     f0106c3b <sysring_run+0xdc>
+f0106b99:	8b 17                	mov    (%edi),%edx
+f0106b9b:	8b 47 04             	mov    0x4(%edi),%eax
+f0106b9e:	39 c2                	cmp    %eax,%edx
+f0106ba0:	0f 84 95 00 00 00    	je     f0106c3b <sysring_run+0xdc>
+f0106ba6:	8b 47 0c             	mov    0xc(%edi),%eax
+f0106ba9:	8b 57 08             	mov    0x8(%edi),%edx
+f0106bac:	29 d0                	sub    %edx,%eax
+f0106bae:	83 f8 3f             	cmp    $0x3f,%eax
+f0106bb1:	0f 87 84 00 00 00    	ja     f0106c3b <sysring_run+0xdc>
+f0106bb7:	8b 17                	mov    (%edi),%edx
+f0106bb9:	83 e2 3f             	and    $0x3f,%edx
+f0106bbc:	6b c2 1c             	imul   $0x1c,%edx,%eax
+f0106bbf:	01 f8                	add    %edi,%eax
+f0106bc1:	8b 70 10             	mov    0x10(%eax),%esi
+f0106bc4:	8b 48 14             	mov    0x14(%eax),%ecx
+f0106bc7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+f0106bca:	8b 48 18             	mov    0x18(%eax),%ecx
+f0106bcd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0106bd0:	8b 48 1c             	mov    0x1c(%eax),%ecx
+f0106bd3:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+f0106bd6:	83 c2 01             	add    $0x1,%edx
+f0106bd9:	6b d2 1c             	imul   $0x1c,%edx,%edx
+f0106bdc:	8b 5c 17 04          	mov    0x4(%edi,%edx,1),%ebx
+f0106be0:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f0106be3:	8b 48 24             	mov    0x24(%eax),%ecx
+f0106be6:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f0106be9:	8b 50 28             	mov    0x28(%eax),%edx
+f0106bec:	8b 07                	mov    (%edi),%eax
+f0106bee:	83 c0 01             	add    $0x1,%eax
+f0106bf1:	89 07                	mov    %eax,(%edi)
+f0106bf3:	8b 5f 0c             	mov    0xc(%edi),%ebx
+f0106bf6:	83 e3 3f             	and    $0x3f,%ebx
+f0106bf9:	89 94 df 10 07 00 00 	mov    %edx,0x710(%edi,%ebx,8)
+f0106c00:	89 f0                	mov    %esi,%eax
+f0106c02:	e8 87 f4 ff ff       	call   f010608e <syscall_nonblocking>
+f0106c07:	8d 56 f0             	lea    -0x10(%esi),%edx
+f0106c0a:	83 fa 01             	cmp    $0x1,%edx
+f0106c0d:	0f 86 61 ff ff ff    	jbe    f0106b74 <sysring_run+0x15>
+f0106c13:	3c 01                	cmp    $0x1,%al
+f0106c15:	0f 85 59 ff ff ff    	jne    f0106b74 <sysring_run+0x15>
+f0106c1b:	83 ec 08             	sub    $0x8,%esp
+f0106c1e:	ff 75 d0             	push   -0x30(%ebp)
+f0106c21:	ff 75 d4             	push   -0x2c(%ebp)
+f0106c24:	ff 75 d8             	push   -0x28(%ebp)
+f0106c27:	ff 75 dc             	push   -0x24(%ebp)
+f0106c2a:	ff 75 e0             	push   -0x20(%ebp)
+f0106c2d:	56                   	push   %esi
+f0106c2e:	e8 72 f4 ff ff       	call   f01060a5 <syscall>
+f0106c33:	83 c4 20             	add    $0x20,%esp
+f0106c36:	e9 3e ff ff ff       	jmp    f0106b79 <sysring_run+0x1a>
+f0106c3b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106c3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106c41:	5b                   	pop    %ebx
+f0106c42:	5e                   	pop    %esi
+f0106c43:	5f                   	pop    %edi
+f0106c44:	5d                   	pop    %ebp
+f0106c45:	c3                   	ret
+
+f0106c46 <syscall_stats_print>:
+f0106c46:	55                   	push   %ebp
+f0106c47:	89 e5                	mov    %esp,%ebp
+f0106c49:	57                   	push   %edi
+f0106c4a:	56                   	push   %esi
+f0106c4b:	53                   	push   %ebx
+f0106c4c:	83 ec 64             	sub    $0x64,%esp
+f0106c4f:	68 bb ba 10 f0       	push   $0xf010babb
+f0106c54:	68 c3 ba 10 f0       	push   $0xf010bac3
+f0106c59:	68 cb ba 10 f0       	push   $0xf010bacb
+f0106c5e:	68 d2 ba 10 f0       	push   $0xf010bad2
+f0106c63:	68 d8 ba 10 f0       	push   $0xf010bad8
+f0106c68:	68 e0 ba 10 f0       	push   $0xf010bae0
+f0106c6d:	e8 b1 e3 ff ff       	call   f0105023 <cprintf>
+f0106c72:	c7 45 b8 00 7c 1a f0 	movl   $0xf01a7c00,-0x48(%ebp)
+f0106c79:	83 c4 20             	add    $0x20,%esp
+f0106c7c:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%ebp)
+f0106c83:	e9 2d 01 00 00       	jmp    f0106db5 <syscall_stats_print+0x16f>
+f0106c88:	8b 08                	mov    (%eax),%ecx
+f0106c8a:	01 4d a0             	add    %ecx,-0x60(%ebp)
+f0106c8d:	8b 50 04             	mov    0x4(%eax),%edx
+f0106c90:	01 55 a8             	add    %edx,-0x58(%ebp)
+f0106c93:	8b 48 08             	mov    0x8(%eax),%ecx
+f0106c96:	01 4d ac             	add    %ecx,-0x54(%ebp)
+f0106c99:	8b 58 0c             	mov    0xc(%eax),%ebx
+f0106c9c:	8b 70 10             	mov    0x10(%eax),%esi
+f0106c9f:	01 5d b0             	add    %ebx,-0x50(%ebp)
+f0106ca2:	11 75 b4             	adc    %esi,-0x4c(%ebp)
+f0106ca5:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f0106ca8:	3b 70 14             	cmp    0x14(%eax),%esi
+f0106cab:	89 fa                	mov    %edi,%edx
+f0106cad:	1b 50 18             	sbb    0x18(%eax),%edx
+f0106cb0:	0f 42 70 14          	cmovb  0x14(%eax),%esi
+f0106cb4:	89 75 c0             	mov    %esi,-0x40(%ebp)
+f0106cb7:	0f 42 78 18          	cmovb  0x18(%eax),%edi
+f0106cbb:	b9 01 00 00 00       	mov    $0x1,%ecx
+f0106cc0:	0f b6 5d bf          	movzbl -0x41(%ebp),%ebx
+f0106cc4:	0f 42 d9             	cmovb  %ecx,%ebx
+f0106cc7:	88 5d bf             	mov    %bl,-0x41(%ebp)
+f0106cca:	05 40 02 00 00       	add    $0x240,%eax
+f0106ccf:	c6 45 be 01          	movb   $0x1,-0x42(%ebp)
+f0106cd3:	c6 45 bd 01          	movb   $0x1,-0x43(%ebp)
+f0106cd7:	c6 45 bc 01          	movb   $0x1,-0x44(%ebp)
+f0106cdb:	c6 45 a7 01          	movb   $0x1,-0x59(%ebp)
+f0106cdf:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+f0106ce2:	39 c8                	cmp    %ecx,%eax
+f0106ce4:	75 a2                	jne    f0106c88 <syscall_stats_print+0x42>
+f0106ce6:	8b 55 b0             	mov    -0x50(%ebp),%edx
+f0106ce9:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+f0106cec:	0f b6 75 bf          	movzbl -0x41(%ebp),%esi
+f0106cf0:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+f0106cf3:	89 f0                	mov    %esi,%eax
+f0106cf5:	84 c0                	test   %al,%al
+f0106cf7:	74 06                	je     f0106cff <syscall_stats_print+0xb9>
+f0106cf9:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+f0106cfc:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0106cff:	80 7d be 00          	cmpb   $0x0,-0x42(%ebp)
+f0106d03:	74 06                	je     f0106d0b <syscall_stats_print+0xc5>
+f0106d05:	89 55 d8             	mov    %edx,-0x28(%ebp)
+f0106d08:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0106d0b:	80 7d bd 00          	cmpb   $0x0,-0x43(%ebp)
+f0106d0f:	74 06                	je     f0106d17 <syscall_stats_print+0xd1>
+f0106d11:	8b 45 ac             	mov    -0x54(%ebp),%eax
+f0106d14:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0106d17:	80 7d bc 00          	cmpb   $0x0,-0x44(%ebp)
+f0106d1b:	74 06                	je     f0106d23 <syscall_stats_print+0xdd>
+f0106d1d:	8b 45 a8             	mov    -0x58(%ebp),%eax
+f0106d20:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0106d23:	80 7d a7 00          	cmpb   $0x0,-0x59(%ebp)
+f0106d27:	74 06                	je     f0106d2f <syscall_stats_print+0xe9>
+f0106d29:	8b 45 a0             	mov    -0x60(%ebp),%eax
+f0106d2c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f0106d2f:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+f0106d32:	85 db                	test   %ebx,%ebx
+f0106d34:	74 6f                	je     f0106da5 <syscall_stats_print+0x15f>
+f0106d36:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0106d39:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0106d3c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0106d3f:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+f0106d46:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+f0106d4d:	85 c0                	test   %eax,%eax
+f0106d4f:	74 1b                	je     f0106d6c <syscall_stats_print+0x126>
+f0106d51:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106d56:	52                   	push   %edx
+f0106d57:	50                   	push   %eax
+f0106d58:	ff 75 dc             	push   -0x24(%ebp)
+f0106d5b:	ff 75 d8             	push   -0x28(%ebp)
+f0106d5e:	e8 cf 2c 00 00       	call   f0109a32 <__udivdi3>
+f0106d63:	83 c4 10             	add    $0x10,%esp
+f0106d66:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f0106d69:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+f0106d6c:	8b 55 d0             	mov    -0x30(%ebp),%edx
+f0106d6f:	b8 b9 ba 10 f0       	mov    $0xf010bab9,%eax
+f0106d74:	8b 4d 9c             	mov    -0x64(%ebp),%ecx
+f0106d77:	83 f9 13             	cmp    $0x13,%ecx
+f0106d7a:	77 11                	ja     f0106d8d <syscall_stats_print+0x147>
+f0106d7c:	8b 04 8d a0 bc 10 f0 	mov    -0xfef4360(,%ecx,4),%eax
+f0106d83:	85 c0                	test   %eax,%eax
+f0106d85:	b9 b9 ba 10 f0       	mov    $0xf010bab9,%ecx
+f0106d8a:	0f 44 c1             	cmove  %ecx,%eax
+f0106d8d:	57                   	push   %edi
+f0106d8e:	56                   	push   %esi
+f0106d8f:	ff 75 c4             	push   -0x3c(%ebp)
+f0106d92:	ff 75 c0             	push   -0x40(%ebp)
+f0106d95:	52                   	push   %edx
+f0106d96:	53                   	push   %ebx
+f0106d97:	50                   	push   %eax
+f0106d98:	68 f9 ba 10 f0       	push   $0xf010baf9
+f0106d9d:	e8 81 e2 ff ff       	call   f0105023 <cprintf>
+f0106da2:	83 c4 20             	add    $0x20,%esp
+f0106da5:	83 45 9c 01          	addl   $0x1,-0x64(%ebp)
+f0106da9:	8b 45 9c             	mov    -0x64(%ebp),%eax
+f0106dac:	83 45 b8 1c          	addl   $0x1c,-0x48(%ebp)
+f0106db0:	83 f8 14             	cmp    $0x14,%eax
+f0106db3:	74 61                	je     f0106e16 <syscall_stats_print+0x1d0>
+f0106db5:	83 ec 04             	sub    $0x4,%esp
+f0106db8:	6a 1c                	push   $0x1c
+f0106dba:	6a 00                	push   $0x0
+f0106dbc:	8d 45 cc             	lea    -0x34(%ebp),%eax
+f0106dbf:	50                   	push   %eax
+f0106dc0:	e8 c4 20 00 00       	call   f0108e89 <memset>
+f0106dc5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0106dc8:	89 45 a0             	mov    %eax,-0x60(%ebp)
+f0106dcb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0106dce:	89 45 a8             	mov    %eax,-0x58(%ebp)
+f0106dd1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0106dd4:	89 45 ac             	mov    %eax,-0x54(%ebp)
+f0106dd7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0106dda:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0106ddd:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0106de0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0106de3:	8b 45 b8             	mov    -0x48(%ebp),%eax
+f0106de6:	2d 00 12 00 00       	sub    $0x1200,%eax
+f0106deb:	83 c4 10             	add    $0x10,%esp
+f0106dee:	be 00 00 00 00       	mov    $0x0,%esi
+f0106df3:	c6 45 be 00          	movb   $0x0,-0x42(%ebp)
+f0106df7:	c6 45 bd 00          	movb   $0x0,-0x43(%ebp)
+f0106dfb:	c6 45 bc 00          	movb   $0x0,-0x44(%ebp)
+f0106dff:	c6 45 a7 00          	movb   $0x0,-0x59(%ebp)
+f0106e03:	89 55 b0             	mov    %edx,-0x50(%ebp)
+f0106e06:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+f0106e09:	89 f2                	mov    %esi,%edx
+f0106e0b:	88 55 bf             	mov    %dl,-0x41(%ebp)
+f0106e0e:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+f0106e11:	e9 c9 fe ff ff       	jmp    f0106cdf <syscall_stats_print+0x99>
+f0106e16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106e19:	5b                   	pop    %ebx
+f0106e1a:	5e                   	pop    %esi
+f0106e1b:	5f                   	pop    %edi
+f0106e1c:	5d                   	pop    %ebp
+f0106e1d:	c3                   	ret
+
+f0106e1e <syscall_stats_reset>:
+f0106e1e:	55                   	push   %ebp
+f0106e1f:	89 e5                	mov    %esp,%ebp
+f0106e21:	83 ec 0c             	sub    $0xc,%esp
+f0106e24:	68 00 12 00 00       	push   $0x1200
+f0106e29:	6a 00                	push   $0x0
+f0106e2b:	68 00 6a 1a f0       	push   $0xf01a6a00
+f0106e30:	e8 54 20 00 00       	call   f0108e89 <memset>
+f0106e35:	c7 05 c0 41 1a f0 00 	movl   $0x0,0xf01a41c0
+f0106e3c:	00 00 00 
+f0106e3f:	83 c4 10             	add    $0x10,%esp
+f0106e42:	c9                   	leave
+f0106e43:	c3                   	ret
+
+f0106e44 <syscall_trace_print>:
+f0106e44:	55                   	push   %ebp
+f0106e45:	89 e5                	mov    %esp,%ebp
+f0106e47:	57                   	push   %edi
+f0106e48:	56                   	push   %esi
+f0106e49:	53                   	push   %ebx
+f0106e4a:	83 ec 2c             	sub    $0x2c,%esp
+f0106e4d:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106e50:	83 e8 01             	sub    $0x1,%eax
+f0106e53:	3d ff 00 00 00       	cmp    $0xff,%eax
+f0106e58:	b8 00 01 00 00       	mov    $0x100,%eax
+f0106e5d:	0f 46 45 08          	cmovbe 0x8(%ebp),%eax
+f0106e61:	8b 15 c0 41 1a f0    	mov    0xf01a41c0,%edx
+f0106e67:	39 d0                	cmp    %edx,%eax
+f0106e69:	0f 47 c2             	cmova  %edx,%eax
+f0106e6c:	89 d7                	mov    %edx,%edi
+f0106e6e:	29 c7                	sub    %eax,%edi
+f0106e70:	89 fb                	mov    %edi,%ebx
+f0106e72:	eb 32                	jmp    f0106ea6 <syscall_trace_print+0x62>
+f0106e74:	83 ec 04             	sub    $0x4,%esp
+f0106e77:	ff 75 e4             	push   -0x1c(%ebp)
+f0106e7a:	ff 75 e0             	push   -0x20(%ebp)
+f0106e7d:	ff 75 dc             	push   -0x24(%ebp)
+f0106e80:	ff 75 d8             	push   -0x28(%ebp)
+f0106e83:	ff 75 d4             	push   -0x2c(%ebp)
+f0106e86:	ff 75 d0             	push   -0x30(%ebp)
+f0106e89:	57                   	push   %edi
+f0106e8a:	56                   	push   %esi
+f0106e8b:	52                   	push   %edx
+f0106e8c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0106e8f:	ff 34 c5 e0 41 1a f0 	push   -0xfe5be20(,%eax,8)
+f0106e96:	68 00 bc 10 f0       	push   $0xf010bc00
+f0106e9b:	e8 83 e1 ff ff       	call   f0105023 <cprintf>
+f0106ea0:	83 c3 01             	add    $0x1,%ebx
+f0106ea3:	83 c4 30             	add    $0x30,%esp
+f0106ea6:	39 1d c0 41 1a f0    	cmp    %ebx,0xf01a41c0
+f0106eac:	74 5a                	je     f0106f08 <syscall_trace_print+0xc4>
+f0106eae:	0f b6 c3             	movzbl %bl,%eax
+f0106eb1:	8d 14 80             	lea    (%eax,%eax,4),%edx
+f0106eb4:	8d 14 d5 e0 41 1a f0 	lea    -0xfe5be20(,%edx,8),%edx
+f0106ebb:	8b 72 20             	mov    0x20(%edx),%esi
+f0106ebe:	8b 7a 24             	mov    0x24(%edx),%edi
+f0106ec1:	89 75 e0             	mov    %esi,-0x20(%ebp)
+f0106ec4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0106ec7:	8b 4a 1c             	mov    0x1c(%edx),%ecx
+f0106eca:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0106ecd:	8b 72 18             	mov    0x18(%edx),%esi
+f0106ed0:	89 75 d8             	mov    %esi,-0x28(%ebp)
+f0106ed3:	8b 7a 14             	mov    0x14(%edx),%edi
+f0106ed6:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+f0106ed9:	8b 4a 10             	mov    0x10(%edx),%ecx
+f0106edc:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f0106edf:	8b 7a 0c             	mov    0xc(%edx),%edi
+f0106ee2:	8b 72 08             	mov    0x8(%edx),%esi
+f0106ee5:	8b 4a 04             	mov    0x4(%edx),%ecx
+f0106ee8:	ba b9 ba 10 f0       	mov    $0xf010bab9,%edx
+f0106eed:	83 f9 13             	cmp    $0x13,%ecx
+f0106ef0:	77 82                	ja     f0106e74 <syscall_trace_print+0x30>
+f0106ef2:	8b 14 8d a0 bc 10 f0 	mov    -0xfef4360(,%ecx,4),%edx
+f0106ef9:	85 d2                	test   %edx,%edx
+f0106efb:	b9 b9 ba 10 f0       	mov    $0xf010bab9,%ecx
+f0106f00:	0f 44 d1             	cmove  %ecx,%edx
+f0106f03:	e9 6c ff ff ff       	jmp    f0106e74 <syscall_trace_print+0x30>
+f0106f08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106f0b:	5b                   	pop    %ebx
+f0106f0c:	5e                   	pop    %esi
+f0106f0d:	5f                   	pop    %edi
+f0106f0e:	5d                   	pop    %ebp
+f0106f0f:	c3                   	ret
+
+f0106f10 <sysring_poll>:
+f0106f10:	55                   	push   %ebp
+f0106f11:	89 e5                	mov    %esp,%ebp
+f0106f13:	57                   	push   %edi
+f0106f14:	56                   	push   %esi
+f0106f15:	53                   	push   %ebx
+f0106f16:	83 ec 0c             	sub    $0xc,%esp
+f0106f19:	e8 73 db ff ff       	call   f0104a91 <env_save_state>
+f0106f1e:	be 00 00 00 00       	mov    $0x0,%esi
+f0106f23:	bf 00 00 00 00       	mov    $0x0,%edi
+f0106f28:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0106f2d:	eb 1e                	jmp    f0106f4d <sysring_poll+0x3d>
+f0106f2f:	52                   	push   %edx
+f0106f30:	68 08 9e 10 f0       	push   $0xf0109e08
+f0106f35:	68 bf 03 00 00       	push   $0x3bf
+f0106f3a:	68 16 bb 10 f0       	push   $0xf010bb16
+f0106f3f:	e8 e7 91 ff ff       	call   f010012b <_panic>
+f0106f44:	83 c3 01             	add    $0x1,%ebx
+f0106f47:	81 c6 80 03 00 00    	add    $0x380,%esi
+f0106f4d:	3b 1d 40 37 1a f0    	cmp    0xf01a3740,%ebx
+f0106f53:	73 44                	jae    f0106f99 <sysring_poll+0x89>
+f0106f55:	89 f0                	mov    %esi,%eax
+f0106f57:	03 05 44 37 1a f0    	add    0xf01a3744,%eax
+f0106f5d:	8b 50 64             	mov    0x64(%eax),%edx
+f0106f60:	85 d2                	test   %edx,%edx
+f0106f62:	74 e0                	je     f0106f44 <sysring_poll+0x34>
+f0106f64:	83 38 04             	cmpl   $0x4,(%eax)
+f0106f67:	75 db                	jne    f0106f44 <sysring_poll+0x34>
+f0106f69:	8b 0a                	mov    (%edx),%ecx
+f0106f6b:	8b 52 04             	mov    0x4(%edx),%edx
+f0106f6e:	39 d1                	cmp    %edx,%ecx
+f0106f70:	74 d2                	je     f0106f44 <sysring_poll+0x34>
+f0106f72:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0106f79:	89 42 04             	mov    %eax,0x4(%edx)
+f0106f7c:	8b 50 50             	mov    0x50(%eax),%edx
+f0106f7f:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0106f85:	76 a8                	jbe    f0106f2f <sysring_poll+0x1f>
+f0106f87:	81 c2 00 00 00 10    	add    $0x10000000,%edx
+f0106f8d:	0f 22 da             	mov    %edx,%cr3
+f0106f90:	e8 ca fb ff ff       	call   f0106b5f <sysring_run>
+f0106f95:	01 c7                	add    %eax,%edi
+f0106f97:	eb ab                	jmp    f0106f44 <sysring_poll+0x34>
+f0106f99:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0106f9f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+f0106fa6:	a1 14 37 1a f0       	mov    0xf01a3714,%eax
+f0106fab:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0106fb0:	76 12                	jbe    f0106fc4 <sysring_poll+0xb4>
+f0106fb2:	05 00 00 00 10       	add    $0x10000000,%eax
+f0106fb7:	0f 22 d8             	mov    %eax,%cr3
+f0106fba:	89 f8                	mov    %edi,%eax
+f0106fbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106fbf:	5b                   	pop    %ebx
+f0106fc0:	5e                   	pop    %esi
+f0106fc1:	5f                   	pop    %edi
+f0106fc2:	5d                   	pop    %ebp
+f0106fc3:	c3                   	ret
+f0106fc4:	50                   	push   %eax
+f0106fc5:	68 08 9e 10 f0       	push   $0xf0109e08
+f0106fca:	68 c3 03 00 00       	push   $0x3c3
+f0106fcf:	68 16 bb 10 f0       	push   $0xf010bb16
+f0106fd4:	e8 52 91 ff ff       	call   f010012b <_panic>
+
+f0106fd9 <syscall_sysenter>:
+f0106fd9:	55                   	push   %ebp
+f0106fda:	89 e5                	mov    %esp,%ebp
+f0106fdc:	56                   	push   %esi
+f0106fdd:	53                   	push   %ebx
+f0106fde:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0106fe1:	83 ec 0c             	sub    $0xc,%esp
+f0106fe4:	68 00 74 11 f0       	push   $0xf0117400
+f0106fe9:	e8 b7 28 00 00       	call   f01098a5 <spin_lock>
+f0106fee:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0106ff4:	6a 04                	push   $0x4
+f0106ff6:	6a 04                	push   $0x4
+f0106ff8:	ff 73 3c             	push   0x3c(%ebx)
+f0106ffb:	ff 70 04             	push   0x4(%eax)
+f0106ffe:	e8 5a d0 ff ff       	call   f010405d <user_mem_assert>
+f0107003:	8b 43 3c             	mov    0x3c(%ebx),%eax
+f0107006:	8b 00                	mov    (%eax),%eax
+f0107008:	89 43 30             	mov    %eax,0x30(%ebx)
+f010700b:	81 4b 38 00 02 00 00 	orl    $0x200,0x38(%ebx)
+f0107012:	8b 73 1c             	mov    0x1c(%ebx),%esi
+f0107015:	83 c4 20             	add    $0x20,%esp
+f0107018:	89 f0                	mov    %esi,%eax
+f010701a:	e8 6f f0 ff ff       	call   f010608e <syscall_nonblocking>
+f010701f:	84 c0                	test   %al,%al
+f0107021:	74 50                	je     f0107073 <syscall_sysenter+0x9a>
+f0107023:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0107029:	8b 40 04             	mov    0x4(%eax),%eax
+f010702c:	83 38 01             	cmpl   $0x1,(%eax)
+f010702f:	74 42                	je     f0107073 <syscall_sysenter+0x9a>
+f0107031:	83 ec 08             	sub    $0x8,%esp
+f0107034:	ff 73 04             	push   0x4(%ebx)
+f0107037:	ff 33                	push   (%ebx)
+f0107039:	ff 73 10             	push   0x10(%ebx)
+f010703c:	ff 73 18             	push   0x18(%ebx)
+f010703f:	ff 73 14             	push   0x14(%ebx)
+f0107042:	56                   	push   %esi
+f0107043:	e8 5d f0 ff ff       	call   f01060a5 <syscall>
+f0107048:	89 c6                	mov    %eax,%esi
+f010704a:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0107050:	8b 40 04             	mov    0x4(%eax),%eax
+f0107053:	83 c4 20             	add    $0x20,%esp
+f0107056:	83 38 03             	cmpl   $0x3,(%eax)
+f0107059:	75 2f                	jne    f010708a <syscall_sysenter+0xb1>
+f010705b:	83 ec 0c             	sub    $0xc,%esp
+f010705e:	68 00 74 11 f0       	push   $0xf0117400
+f0107063:	e8 d5 28 00 00       	call   f010993d <spin_unlock>
+f0107068:	f3 90                	pause
+f010706a:	89 f0                	mov    %esi,%eax
+f010706c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010706f:	5b                   	pop    %ebx
+f0107070:	5e                   	pop    %esi
+f0107071:	5d                   	pop    %ebp
+f0107072:	c3                   	ret
+f0107073:	83 ec 0c             	sub    $0xc,%esp
+f0107076:	68 00 74 11 f0       	push   $0xf0117400
+f010707b:	e8 bd 28 00 00       	call   f010993d <spin_unlock>
+f0107080:	f3 90                	pause
+f0107082:	89 1c 24             	mov    %ebx,(%esp)
+f0107085:	e8 7e ea ff ff       	call   f0105b08 <trap>
+f010708a:	89 73 1c             	mov    %esi,0x1c(%ebx)
+f010708d:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0107093:	89 58 08             	mov    %ebx,0x8(%eax)
+f0107096:	e8 21 ef ff ff       	call   f0105fbc <sched_yield>
+
+f010709b <stab_binsearch>:
+f010709b:	55                   	push   %ebp
+f010709c:	89 e5                	mov    %esp,%ebp
+f010709e:	57                   	push   %edi
+f010709f:	56                   	push   %esi
+f01070a0:	53                   	push   %ebx
+f01070a1:	83 ec 14             	sub    $0x14,%esp
+f01070a4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f01070a7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f01070aa:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+f01070ad:	8b 1a                	mov    (%edx),%ebx
+f01070af:	8b 09                	mov    (%ecx),%ecx
+f01070b1:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+f01070b8:	eb 4f                	jmp    f0107109 <stab_binsearch+0x6e>
+f01070ba:	83 e8 01             	sub    $0x1,%eax
+f01070bd:	39 c3                	cmp    %eax,%ebx
+f01070bf:	0f 8f cc 00 00 00    	jg     f0107191 <stab_binsearch+0xf6>
+f01070c5:	0f b6 0a             	movzbl (%edx),%ecx
+f01070c8:	83 ea 0c             	sub    $0xc,%edx
+f01070cb:	39 f1                	cmp    %esi,%ecx
+f01070cd:	75 eb                	jne    f01070ba <stab_binsearch+0x1f>
+f01070cf:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f01070d2:	89 75 08             	mov    %esi,0x8(%ebp)
+f01070d5:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f01070d8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+f01070db:	8b 54 96 08          	mov    0x8(%esi,%edx,4),%edx
+f01070df:	3b 55 0c             	cmp    0xc(%ebp),%edx
+f01070e2:	72 16                	jb     f01070fa <stab_binsearch+0x5f>
+f01070e4:	39 55 0c             	cmp    %edx,0xc(%ebp)
+f01070e7:	73 48                	jae    f0107131 <stab_binsearch+0x96>
+f01070e9:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f01070ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01070ef:	89 08                	mov    %ecx,(%eax)
+f01070f1:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f01070f8:	eb 0f                	jmp    f0107109 <stab_binsearch+0x6e>
+f01070fa:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f01070fd:	89 06                	mov    %eax,(%esi)
+f01070ff:	8d 5f 01             	lea    0x1(%edi),%ebx
+f0107102:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0107109:	39 cb                	cmp    %ecx,%ebx
+f010710b:	7f 38                	jg     f0107145 <stab_binsearch+0xaa>
+f010710d:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+f0107110:	89 c2                	mov    %eax,%edx
+f0107112:	c1 ea 1f             	shr    $0x1f,%edx
+f0107115:	01 d0                	add    %edx,%eax
+f0107117:	89 c7                	mov    %eax,%edi
+f0107119:	d1 ff                	sar    %edi
+f010711b:	83 e0 fe             	and    $0xfffffffe,%eax
+f010711e:	01 f8                	add    %edi,%eax
+f0107120:	8b 55 f0             	mov    -0x10(%ebp),%edx
+f0107123:	8d 54 82 04          	lea    0x4(%edx,%eax,4),%edx
+f0107127:	89 f8                	mov    %edi,%eax
+f0107129:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+f010712c:	8b 75 08             	mov    0x8(%ebp),%esi
+f010712f:	eb 8c                	jmp    f01070bd <stab_binsearch+0x22>
+f0107131:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0107134:	89 07                	mov    %eax,(%edi)
+f0107136:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+f010713a:	89 c3                	mov    %eax,%ebx
+f010713c:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0107143:	eb c4                	jmp    f0107109 <stab_binsearch+0x6e>
+f0107145:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107148:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+f010714c:	75 15                	jne    f0107163 <stab_binsearch+0xc8>
+f010714e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107151:	8b 00                	mov    (%eax),%eax
+f0107153:	83 e8 01             	sub    $0x1,%eax
+f0107156:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0107159:	89 07                	mov    %eax,(%edi)
+f010715b:	83 c4 14             	add    $0x14,%esp
+f010715e:	5b                   	pop    %ebx
+f010715f:	5e                   	pop    %esi
+f0107160:	5f                   	pop    %edi
+f0107161:	5d                   	pop    %ebp
+f0107162:	c3                   	ret
+f0107163:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0107166:	8b 00                	mov    (%eax),%eax
+f0107168:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f010716b:	8b 0f                	mov    (%edi),%ecx
+f010716d:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0107170:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f0107173:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f0107177:	39 c1                	cmp    %eax,%ecx
+f0107179:	7d 0f                	jge    f010718a <stab_binsearch+0xef>
+f010717b:	0f b6 1a             	movzbl (%edx),%ebx
+f010717e:	83 ea 0c             	sub    $0xc,%edx
+f0107181:	39 f3                	cmp    %esi,%ebx
+f0107183:	74 05                	je     f010718a <stab_binsearch+0xef>
+f0107185:	83 e8 01             	sub    $0x1,%eax
+f0107188:	eb ed                	jmp    f0107177 <stab_binsearch+0xdc>
+f010718a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f010718d:	89 07                	mov    %eax,(%edi)
+f010718f:	eb ca                	jmp    f010715b <stab_binsearch+0xc0>
+f0107191:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0107194:	89 75 08             	mov    %esi,0x8(%ebp)
+f0107197:	8d 5f 01             	lea    0x1(%edi),%ebx
+f010719a:	e9 6a ff ff ff       	jmp    f0107109 <stab_binsearch+0x6e>
+
+f010719f <debuginfo_init>:
+f010719f:	55                   	push   %ebp
+f01071a0:	89 e5                	mov    %esp,%ebp
+f01071a2:	57                   	push   %edi
+f01071a3:	56                   	push   %esi
+f01071a4:	53                   	push   %ebx
+f01071a5:	83 ec 2c             	sub    $0x2c,%esp
+f01071a8:	b8 11 c4 10 f0       	mov    $0xf010c411,%eax
+f01071ad:	2d 11 c4 10 f0       	sub    $0xf010c411,%eax
+f01071b2:	c1 f8 02             	sar    $0x2,%eax
+f01071b5:	69 f8 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%edi
+f01071bb:	b8 12 c4 10 f0       	mov    $0xf010c412,%eax
+f01071c0:	2d 12 c4 10 f0       	sub    $0xf010c412,%eax
+f01071c5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f01071c8:	bb 11 c4 10 f0       	mov    $0xf010c411,%ebx
+f01071cd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+f01071d4:	be 00 00 00 00       	mov    $0x0,%esi
+f01071d9:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+f01071dd:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+f01071e4:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+f01071eb:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f01071ee:	eb 7d                	jmp    f010726d <debuginfo_init+0xce>
+f01071f0:	80 ba 12 c4 10 f0 00 	cmpb   $0x0,-0xfef3bee(%edx)
+f01071f7:	0f 95 45 e4          	setne  -0x1c(%ebp)
+f01071fb:	eb 08                	jmp    f0107205 <debuginfo_init+0x66>
+f01071fd:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+f0107201:	3c 24                	cmp    $0x24,%al
+f0107203:	75 62                	jne    f0107267 <debuginfo_init+0xc8>
+f0107205:	80 ba 12 c4 10 f0 00 	cmpb   $0x0,-0xfef3bee(%edx)
+f010720c:	0f 85 00 01 00 00    	jne    f0107312 <debuginfo_init+0x173>
+f0107212:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+f0107219:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f010721c:	85 ff                	test   %edi,%edi
+f010721e:	74 47                	je     f0107267 <debuginfo_init+0xc8>
+f0107220:	8b 41 08             	mov    0x8(%ecx),%eax
+f0107223:	89 47 04             	mov    %eax,0x4(%edi)
+f0107226:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+f010722d:	eb 38                	jmp    f0107267 <debuginfo_init+0xc8>
+f010722f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0107232:	85 c0                	test   %eax,%eax
+f0107234:	0f 89 b2 00 00 00    	jns    f01072ec <debuginfo_init+0x14d>
+f010723a:	a1 04 7c 1a f0       	mov    0xf01a7c04,%eax
+f010723f:	89 c7                	mov    %eax,%edi
+f0107241:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0107244:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f0107249:	0f 84 4c 03 00 00    	je     f010759b <debuginfo_init+0x3fc>
+f010724f:	8d 40 01             	lea    0x1(%eax),%eax
+f0107252:	a3 04 7c 1a f0       	mov    %eax,0xf01a7c04
+f0107257:	89 f8                	mov    %edi,%eax
+f0107259:	8b 7d d8             	mov    -0x28(%ebp),%edi
+f010725c:	89 3c 85 20 7c 1a f0 	mov    %edi,-0xfe583e0(,%eax,4)
+f0107263:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+f0107267:	83 c6 01             	add    $0x1,%esi
+f010726a:	83 c3 0c             	add    $0xc,%ebx
+f010726d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0107270:	39 c6                	cmp    %eax,%esi
+f0107272:	0f 8d 9d 01 00 00    	jge    f0107415 <debuginfo_init+0x276>
+f0107278:	89 d9                	mov    %ebx,%ecx
+f010727a:	8b 13                	mov    (%ebx),%edx
+f010727c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f010727f:	39 c2                	cmp    %eax,%edx
+f0107281:	73 e4                	jae    f0107267 <debuginfo_init+0xc8>
+f0107283:	0f b6 43 04          	movzbl 0x4(%ebx),%eax
+f0107287:	3c a0                	cmp    $0xa0,%al
+f0107289:	0f 84 e6 00 00 00    	je     f0107375 <debuginfo_init+0x1d6>
+f010728f:	8d ba 12 c4 10 f0    	lea    -0xfef3bee(%edx),%edi
+f0107295:	89 7d d8             	mov    %edi,-0x28(%ebp)
+f0107298:	3c 24                	cmp    $0x24,%al
+f010729a:	0f 84 50 ff ff ff    	je     f01071f0 <debuginfo_init+0x51>
+f01072a0:	3c 44                	cmp    $0x44,%al
+f01072a2:	0f 84 eb 00 00 00    	je     f0107393 <debuginfo_init+0x1f4>
+f01072a8:	0f 86 4f ff ff ff    	jbe    f01071fd <debuginfo_init+0x5e>
+f01072ae:	3c 84                	cmp    $0x84,%al
+f01072b0:	0f 84 79 ff ff ff    	je     f010722f <debuginfo_init+0x90>
+f01072b6:	3c 64                	cmp    $0x64,%al
+f01072b8:	0f 85 1e 01 00 00    	jne    f01073dc <debuginfo_init+0x23d>
+f01072be:	80 ba 12 c4 10 f0 00 	cmpb   $0x0,-0xfef3bee(%edx)
+f01072c5:	0f 84 1a 01 00 00    	je     f01073e5 <debuginfo_init+0x246>
+f01072cb:	8b 43 08             	mov    0x8(%ebx),%eax
+f01072ce:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f01072d1:	85 c0                	test   %eax,%eax
+f01072d3:	0f 84 23 01 00 00    	je     f01073fc <debuginfo_init+0x25d>
+f01072d9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+f01072e0:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+f01072e7:	e9 43 ff ff ff       	jmp    f010722f <debuginfo_init+0x90>
+f01072ec:	83 ec 08             	sub    $0x8,%esp
+f01072ef:	ff 75 d8             	push   -0x28(%ebp)
+f01072f2:	ff 34 85 20 7c 1a f0 	push   -0xfe583e0(,%eax,4)
+f01072f9:	e8 eb 1a 00 00       	call   f0108de9 <strcmp>
+f01072fe:	83 c4 10             	add    $0x10,%esp
+f0107301:	85 c0                	test   %eax,%eax
+f0107303:	0f 85 31 ff ff ff    	jne    f010723a <debuginfo_init+0x9b>
+f0107309:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+f010730d:	e9 55 ff ff ff       	jmp    f0107267 <debuginfo_init+0xc8>
+f0107312:	a1 0c 7c 1a f0       	mov    0xf01a7c0c,%eax
+f0107317:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f010731c:	0f 84 79 02 00 00    	je     f010759b <debuginfo_init+0x3fc>
+f0107322:	8d 50 01             	lea    0x1(%eax),%edx
+f0107325:	89 15 0c 7c 1a f0    	mov    %edx,0xf01a7c0c
+f010732b:	c1 e0 04             	shl    $0x4,%eax
+f010732e:	8d b8 20 bc 1c f0    	lea    -0xfe343e0(%eax),%edi
+f0107334:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+f0107337:	8b 49 08             	mov    0x8(%ecx),%ecx
+f010733a:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+f010733d:	89 88 20 bc 1c f0    	mov    %ecx,-0xfe343e0(%eax)
+f0107343:	c7 80 24 bc 1c f0 00 	movl   $0x0,-0xfe343dc(%eax)
+f010734a:	00 00 00 
+f010734d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0107350:	89 47 08             	mov    %eax,0x8(%edi)
+f0107353:	83 ec 08             	sub    $0x8,%esp
+f0107356:	6a 3a                	push   $0x3a
+f0107358:	50                   	push   %eax
+f0107359:	e8 0f 1b 00 00       	call   f0108e6d <strfind>
+f010735e:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f0107361:	29 c8                	sub    %ecx,%eax
+f0107363:	66 89 47 0c          	mov    %ax,0xc(%edi)
+f0107367:	66 c7 47 0e 00 00    	movw   $0x0,0xe(%edi)
+f010736d:	83 c4 10             	add    $0x10,%esp
+f0107370:	e9 f2 fe ff ff       	jmp    f0107267 <debuginfo_init+0xc8>
+f0107375:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f0107378:	85 ff                	test   %edi,%edi
+f010737a:	0f 95 c0             	setne  %al
+f010737d:	22 45 e4             	and    -0x1c(%ebp),%al
+f0107380:	0f 84 e1 fe ff ff    	je     f0107267 <debuginfo_init+0xc8>
+f0107386:	66 83 47 0e 01       	addw   $0x1,0xe(%edi)
+f010738b:	88 45 e4             	mov    %al,-0x1c(%ebp)
+f010738e:	e9 d4 fe ff ff       	jmp    f0107267 <debuginfo_init+0xc8>
+f0107393:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0107396:	85 ff                	test   %edi,%edi
+f0107398:	78 72                	js     f010740c <debuginfo_init+0x26d>
+f010739a:	a1 08 7c 1a f0       	mov    0xf01a7c08,%eax
+f010739f:	3d 00 40 00 00       	cmp    $0x4000,%eax
+f01073a4:	0f 84 f1 01 00 00    	je     f010759b <debuginfo_init+0x3fc>
+f01073aa:	8b 55 cc             	mov    -0x34(%ebp),%edx
+f01073ad:	03 53 08             	add    0x8(%ebx),%edx
+f01073b0:	89 14 c5 20 bc 1a f0 	mov    %edx,-0xfe543e0(,%eax,8)
+f01073b7:	0f b7 53 06          	movzwl 0x6(%ebx),%edx
+f01073bb:	66 89 14 c5 24 bc 1a 	mov    %dx,-0xfe543dc(,%eax,8)
+f01073c2:	f0 
+f01073c3:	66 89 3c c5 26 bc 1a 	mov    %di,-0xfe543da(,%eax,8)
+f01073ca:	f0 
+f01073cb:	83 c0 01             	add    $0x1,%eax
+f01073ce:	a3 08 7c 1a f0       	mov    %eax,0xf01a7c08
+f01073d3:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+f01073d7:	e9 8b fe ff ff       	jmp    f0107267 <debuginfo_init+0xc8>
+f01073dc:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+f01073e0:	e9 82 fe ff ff       	jmp    f0107267 <debuginfo_init+0xc8>
+f01073e5:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+f01073e9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+f01073f0:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+f01073f7:	e9 6b fe ff ff       	jmp    f0107267 <debuginfo_init+0xc8>
+f01073fc:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+f0107400:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+f0107407:	e9 5b fe ff ff       	jmp    f0107267 <debuginfo_init+0xc8>
+f010740c:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+f0107410:	e9 52 fe ff ff       	jmp    f0107267 <debuginfo_init+0xc8>
+f0107415:	a1 0c 7c 1a f0       	mov    0xf01a7c0c,%eax
+f010741a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f010741d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107422:	e9 a1 00 00 00       	jmp    f01074c8 <debuginfo_init+0x329>
+f0107427:	8b 14 38             	mov    (%eax,%edi,1),%edx
+f010742a:	89 10                	mov    %edx,(%eax)
+f010742c:	8b 54 38 04          	mov    0x4(%eax,%edi,1),%edx
+f0107430:	89 50 04             	mov    %edx,0x4(%eax)
+f0107433:	8b 54 38 08          	mov    0x8(%eax,%edi,1),%edx
+f0107437:	89 50 08             	mov    %edx,0x8(%eax)
+f010743a:	8b 54 38 0c          	mov    0xc(%eax,%edi,1),%edx
+f010743e:	89 50 0c             	mov    %edx,0xc(%eax)
+f0107441:	01 f8                	add    %edi,%eax
+f0107443:	89 ca                	mov    %ecx,%edx
+f0107445:	39 f2                	cmp    %esi,%edx
+f0107447:	7c 09                	jl     f0107452 <debuginfo_init+0x2b3>
+f0107449:	89 d1                	mov    %edx,%ecx
+f010744b:	29 f1                	sub    %esi,%ecx
+f010744d:	3b 1c 38             	cmp    (%eax,%edi,1),%ebx
+f0107450:	72 d5                	jb     f0107427 <debuginfo_init+0x288>
+f0107452:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f0107455:	c1 e2 04             	shl    $0x4,%edx
+f0107458:	89 9a 20 bc 1c f0    	mov    %ebx,-0xfe343e0(%edx)
+f010745e:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+f0107461:	89 9a 24 bc 1c f0    	mov    %ebx,-0xfe343dc(%edx)
+f0107467:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f010746a:	89 9a 28 bc 1c f0    	mov    %ebx,-0xfe343d8(%edx)
+f0107470:	0f b7 5d dc          	movzwl -0x24(%ebp),%ebx
+f0107474:	66 89 9a 2c bc 1c f0 	mov    %bx,-0xfe343d4(%edx)
+f010747b:	0f b7 5d d4          	movzwl -0x2c(%ebp),%ebx
+f010747f:	66 89 9a 2e bc 1c f0 	mov    %bx,-0xfe343d2(%edx)
+f0107486:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+f010748a:	83 c1 10             	add    $0x10,%ecx
+f010748d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0107490:	39 5d cc             	cmp    %ebx,-0x34(%ebp)
+f0107493:	7e 28                	jle    f01074bd <debuginfo_init+0x31e>
+f0107495:	8b 19                	mov    (%ecx),%ebx
+f0107497:	8b 41 04             	mov    0x4(%ecx),%eax
+f010749a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f010749d:	8b 41 08             	mov    0x8(%ecx),%eax
+f01074a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01074a3:	0f b7 41 0c          	movzwl 0xc(%ecx),%eax
+f01074a7:	66 89 45 dc          	mov    %ax,-0x24(%ebp)
+f01074ab:	0f b7 41 0e          	movzwl 0xe(%ecx),%eax
+f01074af:	66 89 45 d4          	mov    %ax,-0x2c(%ebp)
+f01074b3:	89 c8                	mov    %ecx,%eax
+f01074b5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f01074b8:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f01074bb:	eb 88                	jmp    f0107445 <debuginfo_init+0x2a6>
+f01074bd:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f01074c0:	83 c0 01             	add    $0x1,%eax
+f01074c3:	83 f8 08             	cmp    $0x8,%eax
+f01074c6:	74 1e                	je     f01074e6 <debuginfo_init+0x347>
+f01074c8:	8b 34 85 20 bd 10 f0 	mov    -0xfef42e0(,%eax,4),%esi
+f01074cf:	89 f2                	mov    %esi,%edx
+f01074d1:	c1 e2 04             	shl    $0x4,%edx
+f01074d4:	8d 8a 20 bc 1c f0    	lea    -0xfe343e0(%edx),%ecx
+f01074da:	89 d7                	mov    %edx,%edi
+f01074dc:	f7 df                	neg    %edi
+f01074de:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+f01074e1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f01074e4:	eb a7                	jmp    f010748d <debuginfo_init+0x2ee>
+f01074e6:	a1 08 7c 1a f0       	mov    0xf01a7c08,%eax
+f01074eb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f01074ee:	b8 00 00 00 00       	mov    $0x0,%eax
+f01074f3:	e9 83 00 00 00       	jmp    f010757b <debuginfo_init+0x3dc>
+f01074f8:	8b 14 38             	mov    (%eax,%edi,1),%edx
+f01074fb:	8b 4c 38 04          	mov    0x4(%eax,%edi,1),%ecx
+f01074ff:	89 10                	mov    %edx,(%eax)
+f0107501:	89 48 04             	mov    %ecx,0x4(%eax)
+f0107504:	01 f8                	add    %edi,%eax
+f0107506:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0107509:	39 f2                	cmp    %esi,%edx
+f010750b:	7c 0c                	jl     f0107519 <debuginfo_init+0x37a>
+f010750d:	89 d1                	mov    %edx,%ecx
+f010750f:	29 f1                	sub    %esi,%ecx
+f0107511:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f0107514:	3b 1c 38             	cmp    (%eax,%edi,1),%ebx
+f0107517:	72 df                	jb     f01074f8 <debuginfo_init+0x359>
+f0107519:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f010751c:	89 1c d5 20 bc 1a f0 	mov    %ebx,-0xfe543e0(,%edx,8)
+f0107523:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+f0107527:	66 89 04 d5 24 bc 1a 	mov    %ax,-0xfe543dc(,%edx,8)
+f010752e:	f0 
+f010752f:	0f b7 45 dc          	movzwl -0x24(%ebp),%eax
+f0107533:	66 89 04 d5 26 bc 1a 	mov    %ax,-0xfe543da(,%edx,8)
+f010753a:	f0 
+f010753b:	83 c1 01             	add    $0x1,%ecx
+f010753e:	39 4d d4             	cmp    %ecx,-0x2c(%ebp)
+f0107541:	7e 2d                	jle    f0107570 <debuginfo_init+0x3d1>
+f0107543:	8b 1c cd 20 bc 1a f0 	mov    -0xfe543e0(,%ecx,8),%ebx
+f010754a:	0f b7 04 cd 24 bc 1a 	movzwl -0xfe543dc(,%ecx,8),%eax
+f0107551:	f0 
+f0107552:	66 89 45 e0          	mov    %ax,-0x20(%ebp)
+f0107556:	0f b7 04 cd 26 bc 1a 	movzwl -0xfe543da(,%ecx,8),%eax
+f010755d:	f0 
+f010755e:	66 89 45 dc          	mov    %ax,-0x24(%ebp)
+f0107562:	8d 04 cd 20 bc 1a f0 	lea    -0xfe543e0(,%ecx,8),%eax
+f0107569:	89 ca                	mov    %ecx,%edx
+f010756b:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+f010756e:	eb 99                	jmp    f0107509 <debuginfo_init+0x36a>
+f0107570:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0107573:	83 c0 01             	add    $0x1,%eax
+f0107576:	83 f8 08             	cmp    $0x8,%eax
+f0107579:	74 19                	je     f0107594 <debuginfo_init+0x3f5>
+f010757b:	8b 34 85 00 bd 10 f0 	mov    -0xfef4300(,%eax,4),%esi
+f0107582:	8d 14 f5 00 00 00 00 	lea    0x0(,%esi,8),%edx
+f0107589:	89 d7                	mov    %edx,%edi
+f010758b:	f7 df                	neg    %edi
+f010758d:	89 f1                	mov    %esi,%ecx
+f010758f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0107592:	eb aa                	jmp    f010753e <debuginfo_init+0x39f>
+f0107594:	c6 05 00 7c 1a f0 01 	movb   $0x1,0xf01a7c00
+f010759b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010759e:	5b                   	pop    %ebx
+f010759f:	5e                   	pop    %esi
+f01075a0:	5f                   	pop    %edi
+f01075a1:	5d                   	pop    %ebp
+f01075a2:	c3                   	ret
+
+f01075a3 <debuginfo_eip>:
+f01075a3:	55                   	push   %ebp
+f01075a4:	89 e5                	mov    %esp,%ebp
+f01075a6:	57                   	push   %edi
+f01075a7:	56                   	push   %esi
+f01075a8:	53                   	push   %ebx
+f01075a9:	83 ec 4c             	sub    $0x4c,%esp
+f01075ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01075af:	c7 03 f0 bc 10 f0    	movl   $0xf010bcf0,(%ebx)
+f01075b5:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+f01075bc:	c7 43 08 f0 bc 10 f0 	movl   $0xf010bcf0,0x8(%ebx)
+f01075c3:	c7 43 0c 09 00 00 00 	movl   $0x9,0xc(%ebx)
+f01075ca:	8b 45 08             	mov    0x8(%ebp),%eax
+f01075cd:	89 43 10             	mov    %eax,0x10(%ebx)
+f01075d0:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+f01075d7:	3d ff ff 7f ef       	cmp    $0xef7fffff,%eax
+f01075dc:	0f 86 24 02 00 00    	jbe    f0107806 <debuginfo_eip+0x263>
+f01075e2:	80 3d 00 7c 1a f0 00 	cmpb   $0x0,0xf01a7c00
+f01075e9:	0f 85 2e 01 00 00    	jne    f010771d <debuginfo_eip+0x17a>
+f01075ef:	c7 45 c4 12 c4 10 f0 	movl   $0xf010c412,-0x3c(%ebp)
+f01075f6:	c7 45 bc 12 c4 10 f0 	movl   $0xf010c412,-0x44(%ebp)
+f01075fd:	be 11 c4 10 f0       	mov    $0xf010c411,%esi
+f0107602:	c7 45 c0 11 c4 10 f0 	movl   $0xf010c411,-0x40(%ebp)
+f0107609:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f010760c:	39 4d bc             	cmp    %ecx,-0x44(%ebp)
+f010760f:	0f 83 15 03 00 00    	jae    f010792a <debuginfo_eip+0x387>
+f0107615:	80 79 ff 00          	cmpb   $0x0,-0x1(%ecx)
+f0107619:	0f 85 12 03 00 00    	jne    f0107931 <debuginfo_eip+0x38e>
+f010761f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0107626:	8b 7d c0             	mov    -0x40(%ebp),%edi
+f0107629:	29 fe                	sub    %edi,%esi
+f010762b:	c1 fe 02             	sar    $0x2,%esi
+f010762e:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+f0107634:	83 e8 01             	sub    $0x1,%eax
+f0107637:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010763a:	83 ec 08             	sub    $0x8,%esp
+f010763d:	ff 75 08             	push   0x8(%ebp)
+f0107640:	6a 64                	push   $0x64
+f0107642:	8d 75 e0             	lea    -0x20(%ebp),%esi
+f0107645:	89 f1                	mov    %esi,%ecx
+f0107647:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f010764a:	89 f8                	mov    %edi,%eax
+f010764c:	e8 4a fa ff ff       	call   f010709b <stab_binsearch>
+f0107651:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0107654:	83 c4 10             	add    $0x10,%esp
+f0107657:	85 f6                	test   %esi,%esi
+f0107659:	0f 84 d9 02 00 00    	je     f0107938 <debuginfo_eip+0x395>
+f010765f:	89 75 dc             	mov    %esi,-0x24(%ebp)
+f0107662:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0107665:	89 55 b8             	mov    %edx,-0x48(%ebp)
+f0107668:	89 55 d8             	mov    %edx,-0x28(%ebp)
+f010766b:	83 ec 08             	sub    $0x8,%esp
+f010766e:	ff 75 08             	push   0x8(%ebp)
+f0107671:	6a 24                	push   $0x24
+f0107673:	8d 55 d8             	lea    -0x28(%ebp),%edx
+f0107676:	89 d1                	mov    %edx,%ecx
+f0107678:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f010767b:	89 f8                	mov    %edi,%eax
+f010767d:	e8 19 fa ff ff       	call   f010709b <stab_binsearch>
+f0107682:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0107685:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+f0107688:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f010768b:	89 45 b0             	mov    %eax,-0x50(%ebp)
+f010768e:	83 c4 10             	add    $0x10,%esp
+f0107691:	39 c2                	cmp    %eax,%edx
+f0107693:	0f 8f fa 01 00 00    	jg     f0107893 <debuginfo_eip+0x2f0>
+f0107699:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f010769c:	8d 14 87             	lea    (%edi,%eax,4),%edx
+f010769f:	8b 02                	mov    (%edx),%eax
+f01076a1:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f01076a4:	8b 7d bc             	mov    -0x44(%ebp),%edi
+f01076a7:	29 f9                	sub    %edi,%ecx
+f01076a9:	39 c8                	cmp    %ecx,%eax
+f01076ab:	73 05                	jae    f01076b2 <debuginfo_eip+0x10f>
+f01076ad:	01 f8                	add    %edi,%eax
+f01076af:	89 43 08             	mov    %eax,0x8(%ebx)
+f01076b2:	8b 42 08             	mov    0x8(%edx),%eax
+f01076b5:	29 45 08             	sub    %eax,0x8(%ebp)
+f01076b8:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+f01076bb:	8b 7d b0             	mov    -0x50(%ebp),%edi
+f01076be:	89 7d b8             	mov    %edi,-0x48(%ebp)
+f01076c1:	89 43 10             	mov    %eax,0x10(%ebx)
+f01076c4:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+f01076c7:	8b 45 b8             	mov    -0x48(%ebp),%eax
+f01076ca:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01076cd:	83 ec 08             	sub    $0x8,%esp
+f01076d0:	6a 3a                	push   $0x3a
+f01076d2:	ff 73 08             	push   0x8(%ebx)
+f01076d5:	e8 93 17 00 00       	call   f0108e6d <strfind>
+f01076da:	2b 43 08             	sub    0x8(%ebx),%eax
+f01076dd:	89 43 0c             	mov    %eax,0xc(%ebx)
+f01076e0:	83 c4 08             	add    $0x8,%esp
+f01076e3:	ff 75 08             	push   0x8(%ebp)
+f01076e6:	6a 44                	push   $0x44
+f01076e8:	8d 4d d0             	lea    -0x30(%ebp),%ecx
+f01076eb:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+f01076ee:	8b 7d c0             	mov    -0x40(%ebp),%edi
+f01076f1:	89 f8                	mov    %edi,%eax
+f01076f3:	e8 a3 f9 ff ff       	call   f010709b <stab_binsearch>
+f01076f8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01076fb:	83 c4 10             	add    $0x10,%esp
+f01076fe:	3b 45 d0             	cmp    -0x30(%ebp),%eax
+f0107701:	0f 8f 38 02 00 00    	jg     f010793f <debuginfo_eip+0x39c>
+f0107707:	89 c2                	mov    %eax,%edx
+f0107709:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f010770c:	0f b7 4c 87 06       	movzwl 0x6(%edi,%eax,4),%ecx
+f0107711:	89 4b 04             	mov    %ecx,0x4(%ebx)
+f0107714:	8d 44 87 04          	lea    0x4(%edi,%eax,4),%eax
+f0107718:	e9 86 01 00 00       	jmp    f01078a3 <debuginfo_eip+0x300>
+f010771d:	a1 0c 7c 1a f0       	mov    0xf01a7c0c,%eax
+f0107722:	8d 50 ff             	lea    -0x1(%eax),%edx
+f0107725:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010772a:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010772d:	eb 03                	jmp    f0107732 <debuginfo_eip+0x18f>
+f010772f:	8d 50 ff             	lea    -0x1(%eax),%edx
+f0107732:	39 d1                	cmp    %edx,%ecx
+f0107734:	7f 1e                	jg     f0107754 <debuginfo_eip+0x1b1>
+f0107736:	8d 34 11             	lea    (%ecx,%edx,1),%esi
+f0107739:	89 f0                	mov    %esi,%eax
+f010773b:	c1 e8 1f             	shr    $0x1f,%eax
+f010773e:	01 f0                	add    %esi,%eax
+f0107740:	d1 f8                	sar    %eax
+f0107742:	89 c6                	mov    %eax,%esi
+f0107744:	c1 e6 04             	shl    $0x4,%esi
+f0107747:	3b be 20 bc 1c f0    	cmp    -0xfe343e0(%esi),%edi
+f010774d:	72 e0                	jb     f010772f <debuginfo_eip+0x18c>
+f010774f:	8d 48 01             	lea    0x1(%eax),%ecx
+f0107752:	eb de                	jmp    f0107732 <debuginfo_eip+0x18f>
+f0107754:	89 7d 08             	mov    %edi,0x8(%ebp)
+f0107757:	85 d2                	test   %edx,%edx
+f0107759:	78 4a                	js     f01077a5 <debuginfo_eip+0x202>
+f010775b:	89 d0                	mov    %edx,%eax
+f010775d:	c1 e0 04             	shl    $0x4,%eax
+f0107760:	8b 80 24 bc 1c f0    	mov    -0xfe343dc(%eax),%eax
+f0107766:	85 c0                	test   %eax,%eax
+f0107768:	74 0f                	je     f0107779 <debuginfo_eip+0x1d6>
+f010776a:	89 d1                	mov    %edx,%ecx
+f010776c:	c1 e1 04             	shl    $0x4,%ecx
+f010776f:	03 81 20 bc 1c f0    	add    -0xfe343e0(%ecx),%eax
+f0107775:	39 c7                	cmp    %eax,%edi
+f0107777:	73 2c                	jae    f01077a5 <debuginfo_eip+0x202>
+f0107779:	c1 e2 04             	shl    $0x4,%edx
+f010777c:	8d 82 20 bc 1c f0    	lea    -0xfe343e0(%edx),%eax
+f0107782:	8b 8a 28 bc 1c f0    	mov    -0xfe343d8(%edx),%ecx
+f0107788:	89 4b 08             	mov    %ecx,0x8(%ebx)
+f010778b:	0f b7 8a 2c bc 1c f0 	movzwl -0xfe343d4(%edx),%ecx
+f0107792:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+f0107795:	8b 92 20 bc 1c f0    	mov    -0xfe343e0(%edx),%edx
+f010779b:	89 53 10             	mov    %edx,0x10(%ebx)
+f010779e:	0f b7 40 0e          	movzwl 0xe(%eax),%eax
+f01077a2:	89 43 14             	mov    %eax,0x14(%ebx)
+f01077a5:	a1 08 7c 1a f0       	mov    0xf01a7c08,%eax
+f01077aa:	8d 50 ff             	lea    -0x1(%eax),%edx
+f01077ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01077b2:	8b 7d 08             	mov    0x8(%ebp),%edi
+f01077b5:	eb 03                	jmp    f01077ba <debuginfo_eip+0x217>
+f01077b7:	8d 50 ff             	lea    -0x1(%eax),%edx
+f01077ba:	39 d1                	cmp    %edx,%ecx
+f01077bc:	7f 1a                	jg     f01077d8 <debuginfo_eip+0x235>
+f01077be:	8d 34 11             	lea    (%ecx,%edx,1),%esi
+f01077c1:	89 f0                	mov    %esi,%eax
+f01077c3:	c1 e8 1f             	shr    $0x1f,%eax
+f01077c6:	01 f0                	add    %esi,%eax
+f01077c8:	d1 f8                	sar    %eax
+f01077ca:	3b 3c c5 20 bc 1a f0 	cmp    -0xfe543e0(,%eax,8),%edi
+f01077d1:	72 e4                	jb     f01077b7 <debuginfo_eip+0x214>
+f01077d3:	8d 48 01             	lea    0x1(%eax),%ecx
+f01077d6:	eb e2                	jmp    f01077ba <debuginfo_eip+0x217>
+f01077d8:	85 d2                	test   %edx,%edx
+f01077da:	0f 88 35 01 00 00    	js     f0107915 <debuginfo_eip+0x372>
+f01077e0:	0f b7 04 d5 24 bc 1a 	movzwl -0xfe543dc(,%edx,8),%eax
+f01077e7:	f0 
+f01077e8:	89 43 04             	mov    %eax,0x4(%ebx)
+f01077eb:	0f b7 04 d5 26 bc 1a 	movzwl -0xfe543da(,%edx,8),%eax
+f01077f2:	f0 
+f01077f3:	8b 04 85 20 7c 1a f0 	mov    -0xfe583e0(,%eax,4),%eax
+f01077fa:	89 03                	mov    %eax,(%ebx)
+f01077fc:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107801:	e9 45 01 00 00       	jmp    f010794b <debuginfo_eip+0x3a8>
+f0107806:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010780c:	6a 05                	push   $0x5
+f010780e:	6a 10                	push   $0x10
+f0107810:	68 00 00 20 00       	push   $0x200000
+f0107815:	ff 70 04             	push   0x4(%eax)
+f0107818:	e8 bf c7 ff ff       	call   f0103fdc <user_mem_check>
+f010781d:	83 c4 10             	add    $0x10,%esp
+f0107820:	85 c0                	test   %eax,%eax
+f0107822:	0f 85 f4 00 00 00    	jne    f010791c <debuginfo_eip+0x379>
+f0107828:	8b 0d 00 00 20 00    	mov    0x200000,%ecx
+f010782e:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+f0107831:	8b 35 04 00 20 00    	mov    0x200004,%esi
+f0107837:	8b 3d 08 00 20 00    	mov    0x200008,%edi
+f010783d:	89 7d bc             	mov    %edi,-0x44(%ebp)
+f0107840:	8b 15 0c 00 20 00    	mov    0x20000c,%edx
+f0107846:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+f0107849:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010784f:	6a 05                	push   $0x5
+f0107851:	6a 0c                	push   $0xc
+f0107853:	51                   	push   %ecx
+f0107854:	ff 70 04             	push   0x4(%eax)
+f0107857:	e8 80 c7 ff ff       	call   f0103fdc <user_mem_check>
+f010785c:	83 c4 10             	add    $0x10,%esp
+f010785f:	85 c0                	test   %eax,%eax
+f0107861:	0f 85 bc 00 00 00    	jne    f0107923 <debuginfo_eip+0x380>
+f0107867:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010786d:	6a 05                	push   $0x5
+f010786f:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0107872:	29 fa                	sub    %edi,%edx
+f0107874:	52                   	push   %edx
+f0107875:	57                   	push   %edi
+f0107876:	ff 70 04             	push   0x4(%eax)
+f0107879:	e8 5e c7 ff ff       	call   f0103fdc <user_mem_check>
+f010787e:	83 c4 10             	add    $0x10,%esp
+f0107881:	85 c0                	test   %eax,%eax
+f0107883:	0f 84 80 fd ff ff    	je     f0107609 <debuginfo_eip+0x66>
+f0107889:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010788e:	e9 b8 00 00 00       	jmp    f010794b <debuginfo_eip+0x3a8>
+f0107893:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107896:	89 f2                	mov    %esi,%edx
+f0107898:	e9 24 fe ff ff       	jmp    f01076c1 <debuginfo_eip+0x11e>
+f010789d:	83 ea 01             	sub    $0x1,%edx
+f01078a0:	83 e8 0c             	sub    $0xc,%eax
+f01078a3:	39 d6                	cmp    %edx,%esi
+f01078a5:	7f 28                	jg     f01078cf <debuginfo_eip+0x32c>
+f01078a7:	0f b6 08             	movzbl (%eax),%ecx
+f01078aa:	80 f9 84             	cmp    $0x84,%cl
+f01078ad:	74 0b                	je     f01078ba <debuginfo_eip+0x317>
+f01078af:	80 f9 64             	cmp    $0x64,%cl
+f01078b2:	75 e9                	jne    f010789d <debuginfo_eip+0x2fa>
+f01078b4:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f01078b8:	74 e3                	je     f010789d <debuginfo_eip+0x2fa>
+f01078ba:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f01078bd:	8b 7d c0             	mov    -0x40(%ebp),%edi
+f01078c0:	8b 14 87             	mov    (%edi,%eax,4),%edx
+f01078c3:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f01078c6:	8b 7d bc             	mov    -0x44(%ebp),%edi
+f01078c9:	29 f8                	sub    %edi,%eax
+f01078cb:	39 c2                	cmp    %eax,%edx
+f01078cd:	72 20                	jb     f01078ef <debuginfo_eip+0x34c>
+f01078cf:	b8 00 00 00 00       	mov    $0x0,%eax
+f01078d4:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+f01078d7:	8b 75 b0             	mov    -0x50(%ebp),%esi
+f01078da:	39 f7                	cmp    %esi,%edi
+f01078dc:	7d 6d                	jge    f010794b <debuginfo_eip+0x3a8>
+f01078de:	89 f8                	mov    %edi,%eax
+f01078e0:	83 c0 01             	add    $0x1,%eax
+f01078e3:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f01078e6:	8b 7d c0             	mov    -0x40(%ebp),%edi
+f01078e9:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f01078ed:	eb 0d                	jmp    f01078fc <debuginfo_eip+0x359>
+f01078ef:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f01078f2:	01 d0                	add    %edx,%eax
+f01078f4:	89 03                	mov    %eax,(%ebx)
+f01078f6:	eb d7                	jmp    f01078cf <debuginfo_eip+0x32c>
+f01078f8:	83 43 14 01          	addl   $0x1,0x14(%ebx)
+f01078fc:	39 c6                	cmp    %eax,%esi
+f01078fe:	7e 46                	jle    f0107946 <debuginfo_eip+0x3a3>
+f0107900:	0f b6 0a             	movzbl (%edx),%ecx
+f0107903:	83 c0 01             	add    $0x1,%eax
+f0107906:	83 c2 0c             	add    $0xc,%edx
+f0107909:	80 f9 a0             	cmp    $0xa0,%cl
+f010790c:	74 ea                	je     f01078f8 <debuginfo_eip+0x355>
+f010790e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107913:	eb 36                	jmp    f010794b <debuginfo_eip+0x3a8>
+f0107915:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010791a:	eb 2f                	jmp    f010794b <debuginfo_eip+0x3a8>
+f010791c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107921:	eb 28                	jmp    f010794b <debuginfo_eip+0x3a8>
+f0107923:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107928:	eb 21                	jmp    f010794b <debuginfo_eip+0x3a8>
+f010792a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010792f:	eb 1a                	jmp    f010794b <debuginfo_eip+0x3a8>
+f0107931:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107936:	eb 13                	jmp    f010794b <debuginfo_eip+0x3a8>
+f0107938:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010793d:	eb 0c                	jmp    f010794b <debuginfo_eip+0x3a8>
+f010793f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107944:	eb 05                	jmp    f010794b <debuginfo_eip+0x3a8>
+f0107946:	b8 00 00 00 00       	mov    $0x0,%eax
+f010794b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010794e:	5b                   	pop    %ebx
+f010794f:	5e                   	pop    %esi
+f0107950:	5f                   	pop    %edi
+f0107951:	5d                   	pop    %ebp
+f0107952:	c3                   	ret
+
+f0107953 <ktrace_record>:
+f0107953:	55                   	push   %ebp
+f0107954:	89 e5                	mov    %esp,%ebp
+f0107956:	56                   	push   %esi
+f0107957:	53                   	push   %ebx
+f0107958:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+f010795f:	81 e9 40 70 25 f0    	sub    $0xf0257040,%ecx
+f0107965:	c1 f9 06             	sar    $0x6,%ecx
+f0107968:	69 c9 ac 6a 55 55    	imul   $0x55556aac,%ecx,%ecx
+f010796e:	8b b1 20 bc 1d f0    	mov    -0xfe243e0(%ecx),%esi
+f0107974:	89 f0                	mov    %esi,%eax
+f0107976:	25 ff 01 00 00       	and    $0x1ff,%eax
+f010797b:	c1 e0 05             	shl    $0x5,%eax
+f010797e:	8d 9c 01 20 bc 1d f0 	lea    -0xfe243e0(%ecx,%eax,1),%ebx
+f0107985:	89 f0                	mov    %esi,%eax
+f0107987:	f7 d0                	not    %eax
+f0107989:	89 43 0c             	mov    %eax,0xc(%ebx)
+f010798c:	0f 31                	rdtsc
+f010798e:	89 43 04             	mov    %eax,0x4(%ebx)
+f0107991:	89 53 08             	mov    %edx,0x8(%ebx)
+f0107994:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107997:	66 89 43 10          	mov    %ax,0x10(%ebx)
+f010799b:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01079a1:	2d 40 70 25 f0       	sub    $0xf0257040,%eax
+f01079a6:	c1 f8 06             	sar    $0x6,%eax
+f01079a9:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01079af:	66 89 43 12          	mov    %ax,0x12(%ebx)
+f01079b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01079b6:	89 43 14             	mov    %eax,0x14(%ebx)
+f01079b9:	8b 45 10             	mov    0x10(%ebp),%eax
+f01079bc:	89 43 18             	mov    %eax,0x18(%ebx)
+f01079bf:	8b 45 14             	mov    0x14(%ebp),%eax
+f01079c2:	89 43 1c             	mov    %eax,0x1c(%ebx)
+f01079c5:	89 73 0c             	mov    %esi,0xc(%ebx)
+f01079c8:	83 c6 01             	add    $0x1,%esi
+f01079cb:	89 b1 20 bc 1d f0    	mov    %esi,-0xfe243e0(%ecx)
+f01079d1:	5b                   	pop    %ebx
+f01079d2:	5e                   	pop    %esi
+f01079d3:	5d                   	pop    %ebp
+f01079d4:	c3                   	ret
+
+f01079d5 <ktrace_clear>:
+f01079d5:	c7 05 20 bc 1d f0 00 	movl   $0x0,0xf01dbc20
+f01079dc:	00 00 00 
+f01079df:	c7 05 24 fc 1d f0 00 	movl   $0x0,0xf01dfc24
+f01079e6:	00 00 00 
+f01079e9:	c7 05 28 3c 1e f0 00 	movl   $0x0,0xf01e3c28
+f01079f0:	00 00 00 
+f01079f3:	c7 05 2c 7c 1e f0 00 	movl   $0x0,0xf01e7c2c
+f01079fa:	00 00 00 
+f01079fd:	c7 05 30 bc 1e f0 00 	movl   $0x0,0xf01ebc30
+f0107a04:	00 00 00 
+f0107a07:	c7 05 34 fc 1e f0 00 	movl   $0x0,0xf01efc34
+f0107a0e:	00 00 00 
+f0107a11:	c7 05 38 3c 1f f0 00 	movl   $0x0,0xf01f3c38
+f0107a18:	00 00 00 
+f0107a1b:	c7 05 3c 7c 1f f0 00 	movl   $0x0,0xf01f7c3c
+f0107a22:	00 00 00 
+f0107a25:	c3                   	ret
+
+f0107a26 <ktrace_dump>:
+f0107a26:	55                   	push   %ebp
+f0107a27:	89 e5                	mov    %esp,%ebp
+f0107a29:	57                   	push   %edi
+f0107a2a:	56                   	push   %esi
+f0107a2b:	53                   	push   %ebx
+f0107a2c:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+f0107a32:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107a35:	83 ee 01             	sub    $0x1,%esi
+f0107a38:	81 fe ff 01 00 00    	cmp    $0x1ff,%esi
+f0107a3e:	be 00 02 00 00       	mov    $0x200,%esi
+f0107a43:	0f 46 75 08          	cmovbe 0x8(%ebp),%esi
+f0107a47:	ff 35 f4 73 11 f0    	push   0xf01173f4
+f0107a4d:	ff 35 64 39 1a f0    	push   0xf01a3964
+f0107a53:	ff 35 00 70 25 f0    	push   0xf0257000
+f0107a59:	68 40 bd 10 f0       	push   $0xf010bd40
+f0107a5e:	e8 c0 d5 ff ff       	call   f0105023 <cprintf>
+f0107a63:	83 c4 10             	add    $0x10,%esp
+f0107a66:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0107a6b:	83 ec 04             	sub    $0x4,%esp
+f0107a6e:	ff 34 9d e0 bd 10 f0 	push   -0xfef4220(,%ebx,4)
+f0107a75:	53                   	push   %ebx
+f0107a76:	68 65 bd 10 f0       	push   $0xf010bd65
+f0107a7b:	e8 a3 d5 ff ff       	call   f0105023 <cprintf>
+f0107a80:	83 c3 01             	add    $0x1,%ebx
+f0107a83:	83 c4 10             	add    $0x10,%esp
+f0107a86:	83 fb 08             	cmp    $0x8,%ebx
+f0107a89:	75 e0                	jne    f0107a6b <ktrace_dump+0x45>
+f0107a8b:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107a90:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0107a95:	69 d0 04 40 00 00    	imul   $0x4004,%eax,%edx
+f0107a9b:	8b 8a 20 bc 1d f0    	mov    -0xfe243e0(%edx),%ecx
+f0107aa1:	89 4c 85 a8          	mov    %ecx,-0x58(%ebp,%eax,4)
+f0107aa5:	89 ca                	mov    %ecx,%edx
+f0107aa7:	29 f2                	sub    %esi,%edx
+f0107aa9:	39 ce                	cmp    %ecx,%esi
+f0107aab:	0f 43 d3             	cmovae %ebx,%edx
+f0107aae:	89 54 85 c8          	mov    %edx,-0x38(%ebp,%eax,4)
+f0107ab2:	83 c0 01             	add    $0x1,%eax
+f0107ab5:	83 f8 08             	cmp    $0x8,%eax
+f0107ab8:	75 db                	jne    f0107a95 <ktrace_dump+0x6f>
+f0107aba:	e9 b7 01 00 00       	jmp    f0107c76 <ktrace_dump+0x250>
+f0107abf:	83 c2 01             	add    $0x1,%edx
+f0107ac2:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f0107ac5:	89 10                	mov    %edx,(%eax)
+f0107ac7:	89 7d a4             	mov    %edi,-0x5c(%ebp)
+f0107aca:	8b 17                	mov    (%edi),%edx
+f0107acc:	8b 45 98             	mov    -0x68(%ebp),%eax
+f0107acf:	8b 18                	mov    (%eax),%ebx
+f0107ad1:	39 da                	cmp    %ebx,%edx
+f0107ad3:	0f 84 29 01 00 00    	je     f0107c02 <ktrace_dump+0x1dc>
+f0107ad9:	89 d1                	mov    %edx,%ecx
+f0107adb:	81 e1 ff 01 00 00    	and    $0x1ff,%ecx
+f0107ae1:	89 c8                	mov    %ecx,%eax
+f0107ae3:	c1 e0 05             	shl    $0x5,%eax
+f0107ae6:	8b 75 9c             	mov    -0x64(%ebp),%esi
+f0107ae9:	8d 84 30 20 bc 1d f0 	lea    -0xfe243e0(%eax,%esi,1),%eax
+f0107af0:	8b 70 04             	mov    0x4(%eax),%esi
+f0107af3:	89 75 94             	mov    %esi,-0x6c(%ebp)
+f0107af6:	8b 70 08             	mov    0x8(%eax),%esi
+f0107af9:	89 75 90             	mov    %esi,-0x70(%ebp)
+f0107afc:	8b 70 0c             	mov    0xc(%eax),%esi
+f0107aff:	89 75 a0             	mov    %esi,-0x60(%ebp)
+f0107b02:	0f b7 70 10          	movzwl 0x10(%eax),%esi
+f0107b06:	66 89 75 8e          	mov    %si,-0x72(%ebp)
+f0107b0a:	0f b7 70 12          	movzwl 0x12(%eax),%esi
+f0107b0e:	66 89 75 8c          	mov    %si,-0x74(%ebp)
+f0107b12:	8b 70 14             	mov    0x14(%eax),%esi
+f0107b15:	89 75 88             	mov    %esi,-0x78(%ebp)
+f0107b18:	8b 70 18             	mov    0x18(%eax),%esi
+f0107b1b:	89 75 84             	mov    %esi,-0x7c(%ebp)
+f0107b1e:	8b 40 1c             	mov    0x1c(%eax),%eax
+f0107b21:	8b 75 a0             	mov    -0x60(%ebp),%esi
+f0107b24:	39 f2                	cmp    %esi,%edx
+f0107b26:	75 97                	jne    f0107abf <ktrace_dump+0x99>
+f0107b28:	c1 e1 05             	shl    $0x5,%ecx
+f0107b2b:	8b 75 9c             	mov    -0x64(%ebp),%esi
+f0107b2e:	8b 8c 31 2c bc 1d f0 	mov    -0xfe243d4(%ecx,%esi,1),%ecx
+f0107b35:	39 ca                	cmp    %ecx,%edx
+f0107b37:	75 86                	jne    f0107abf <ktrace_dump+0x99>
+f0107b39:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+f0107b3c:	89 fe                	mov    %edi,%esi
+f0107b3e:	8b 7d 80             	mov    -0x80(%ebp),%edi
+f0107b41:	39 cb                	cmp    %ecx,%ebx
+f0107b43:	0f 84 be 00 00 00    	je     f0107c07 <ktrace_dump+0x1e1>
+f0107b49:	83 bd 74 ff ff ff 00 	cmpl   $0x0,-0x8c(%ebp)
+f0107b50:	78 65                	js     f0107bb7 <ktrace_dump+0x191>
+f0107b52:	8b 8d 78 ff ff ff    	mov    -0x88(%ebp),%ecx
+f0107b58:	8b 9d 7c ff ff ff    	mov    -0x84(%ebp),%ebx
+f0107b5e:	39 4d 94             	cmp    %ecx,-0x6c(%ebp)
+f0107b61:	8b 45 90             	mov    -0x70(%ebp),%eax
+f0107b64:	19 d8                	sbb    %ebx,%eax
+f0107b66:	0f 83 9b 00 00 00    	jae    f0107c07 <ktrace_dump+0x1e1>
+f0107b6c:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f0107b6f:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+f0107b75:	8b 45 84             	mov    -0x7c(%ebp),%eax
+f0107b78:	89 85 68 ff ff ff    	mov    %eax,-0x98(%ebp)
+f0107b7e:	8b 45 88             	mov    -0x78(%ebp),%eax
+f0107b81:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+f0107b87:	0f b7 45 8c          	movzwl -0x74(%ebp),%eax
+f0107b8b:	66 89 85 70 ff ff ff 	mov    %ax,-0x90(%ebp)
+f0107b92:	0f b7 45 8e          	movzwl -0x72(%ebp),%eax
+f0107b96:	66 89 85 72 ff ff ff 	mov    %ax,-0x8e(%ebp)
+f0107b9d:	8b 45 94             	mov    -0x6c(%ebp),%eax
+f0107ba0:	89 85 78 ff ff ff    	mov    %eax,-0x88(%ebp)
+f0107ba6:	8b 45 90             	mov    -0x70(%ebp),%eax
+f0107ba9:	89 85 7c ff ff ff    	mov    %eax,-0x84(%ebp)
+f0107baf:	89 bd 74 ff ff ff    	mov    %edi,-0x8c(%ebp)
+f0107bb5:	eb 50                	jmp    f0107c07 <ktrace_dump+0x1e1>
+f0107bb7:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f0107bba:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+f0107bc0:	8b 45 84             	mov    -0x7c(%ebp),%eax
+f0107bc3:	89 85 68 ff ff ff    	mov    %eax,-0x98(%ebp)
+f0107bc9:	8b 45 88             	mov    -0x78(%ebp),%eax
+f0107bcc:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+f0107bd2:	0f b7 45 8c          	movzwl -0x74(%ebp),%eax
+f0107bd6:	66 89 85 70 ff ff ff 	mov    %ax,-0x90(%ebp)
+f0107bdd:	0f b7 45 8e          	movzwl -0x72(%ebp),%eax
+f0107be1:	66 89 85 72 ff ff ff 	mov    %ax,-0x8e(%ebp)
+f0107be8:	8b 45 94             	mov    -0x6c(%ebp),%eax
+f0107beb:	89 85 78 ff ff ff    	mov    %eax,-0x88(%ebp)
+f0107bf1:	8b 45 90             	mov    -0x70(%ebp),%eax
+f0107bf4:	89 85 7c ff ff ff    	mov    %eax,-0x84(%ebp)
+f0107bfa:	89 bd 74 ff ff ff    	mov    %edi,-0x8c(%ebp)
+f0107c00:	eb 05                	jmp    f0107c07 <ktrace_dump+0x1e1>
+f0107c02:	89 fe                	mov    %edi,%esi
+f0107c04:	8b 7d 80             	mov    -0x80(%ebp),%edi
+f0107c07:	83 c7 01             	add    $0x1,%edi
+f0107c0a:	83 c6 04             	add    $0x4,%esi
+f0107c0d:	83 45 98 04          	addl   $0x4,-0x68(%ebp)
+f0107c11:	39 3d 00 70 25 f0    	cmp    %edi,0xf0257000
+f0107c17:	7e 13                	jle    f0107c2c <ktrace_dump+0x206>
+f0107c19:	69 c7 04 40 00 00    	imul   $0x4004,%edi,%eax
+f0107c1f:	89 45 9c             	mov    %eax,-0x64(%ebp)
+f0107c22:	89 7d 80             	mov    %edi,-0x80(%ebp)
+f0107c25:	89 f7                	mov    %esi,%edi
+f0107c27:	e9 9b fe ff ff       	jmp    f0107ac7 <ktrace_dump+0xa1>
+f0107c2c:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+f0107c32:	85 c0                	test   %eax,%eax
+f0107c34:	78 61                	js     f0107c97 <ktrace_dump+0x271>
+f0107c36:	83 44 85 c8 01       	addl   $0x1,-0x38(%ebp,%eax,4)
+f0107c3b:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+f0107c41:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+f0107c47:	ff b5 6c ff ff ff    	push   -0x94(%ebp)
+f0107c4d:	0f b7 85 72 ff ff ff 	movzwl -0x8e(%ebp),%eax
+f0107c54:	50                   	push   %eax
+f0107c55:	0f b7 85 70 ff ff ff 	movzwl -0x90(%ebp),%eax
+f0107c5c:	50                   	push   %eax
+f0107c5d:	ff b5 7c ff ff ff    	push   -0x84(%ebp)
+f0107c63:	ff b5 78 ff ff ff    	push   -0x88(%ebp)
+f0107c69:	68 74 bd 10 f0       	push   $0xf010bd74
+f0107c6e:	e8 b0 d3 ff ff       	call   f0105023 <cprintf>
+f0107c73:	83 c4 20             	add    $0x20,%esp
+f0107c76:	8d 7d c8             	lea    -0x38(%ebp),%edi
+f0107c79:	8d 45 a8             	lea    -0x58(%ebp),%eax
+f0107c7c:	89 45 98             	mov    %eax,-0x68(%ebp)
+f0107c7f:	c7 85 74 ff ff ff ff 	movl   $0xffffffff,-0x8c(%ebp)
+f0107c86:	ff ff ff 
+f0107c89:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0107c8e:	89 fe                	mov    %edi,%esi
+f0107c90:	89 cf                	mov    %ecx,%edi
+f0107c92:	e9 7a ff ff ff       	jmp    f0107c11 <ktrace_dump+0x1eb>
+f0107c97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107c9a:	5b                   	pop    %ebx
+f0107c9b:	5e                   	pop    %esi
+f0107c9c:	5f                   	pop    %edi
+f0107c9d:	5d                   	pop    %ebp
+f0107c9e:	c3                   	ret
+
+f0107c9f <ktrace_print_events>:
+f0107c9f:	55                   	push   %ebp
+f0107ca0:	89 e5                	mov    %esp,%ebp
+f0107ca2:	57                   	push   %edi
+f0107ca3:	56                   	push   %esi
+f0107ca4:	53                   	push   %ebx
+f0107ca5:	83 ec 0c             	sub    $0xc,%esp
+f0107ca8:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0107cad:	bf 01 00 00 00       	mov    $0x1,%edi
+f0107cb2:	be 8c bd 10 f0       	mov    $0xf010bd8c,%esi
+f0107cb7:	89 fa                	mov    %edi,%edx
+f0107cb9:	89 d9                	mov    %ebx,%ecx
+f0107cbb:	d3 e2                	shl    %cl,%edx
+f0107cbd:	89 d0                	mov    %edx,%eax
+f0107cbf:	23 05 f4 73 11 f0    	and    0xf01173f4,%eax
+f0107cc5:	b8 ae b8 10 f0       	mov    $0xf010b8ae,%eax
+f0107cca:	0f 44 c6             	cmove  %esi,%eax
+f0107ccd:	50                   	push   %eax
+f0107cce:	ff 34 9d e0 bd 10 f0 	push   -0xfef4220(,%ebx,4)
+f0107cd5:	52                   	push   %edx
+f0107cd6:	68 90 bd 10 f0       	push   $0xf010bd90
+f0107cdb:	e8 43 d3 ff ff       	call   f0105023 <cprintf>
+f0107ce0:	83 c3 01             	add    $0x1,%ebx
+f0107ce3:	83 c4 10             	add    $0x10,%esp
+f0107ce6:	83 fb 08             	cmp    $0x8,%ebx
+f0107ce9:	75 cc                	jne    f0107cb7 <ktrace_print_events+0x18>
+f0107ceb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107cee:	5b                   	pop    %ebx
+f0107cef:	5e                   	pop    %esi
+f0107cf0:	5f                   	pop    %edi
+f0107cf1:	5d                   	pop    %ebp
+f0107cf2:	c3                   	ret
+
+f0107cf3 <prof_sample>:
+f0107cf3:	55                   	push   %ebp
+f0107cf4:	89 e5                	mov    %esp,%ebp
+f0107cf6:	57                   	push   %edi
+f0107cf7:	56                   	push   %esi
+f0107cf8:	53                   	push   %ebx
+f0107cf9:	83 ec 0c             	sub    $0xc,%esp
+f0107cfc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0107cff:	8b 1d 40 bc 1f f0    	mov    0xf01fbc40,%ebx
+f0107d05:	85 db                	test   %ebx,%ebx
+f0107d07:	0f 84 0c 01 00 00    	je     f0107e19 <prof_sample+0x126>
+f0107d0d:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0107d14:	81 ea 40 70 25 f0    	sub    $0xf0257040,%edx
+f0107d1a:	c1 fa 06             	sar    $0x6,%edx
+f0107d1d:	69 f2 ab aa aa aa    	imul   $0xaaaaaaab,%edx,%esi
+f0107d23:	69 d2 04 10 00 00    	imul   $0x1004,%edx,%edx
+f0107d29:	8b 82 60 e8 1f f0    	mov    -0xfe017a0(%edx),%eax
+f0107d2f:	83 c0 01             	add    $0x1,%eax
+f0107d32:	89 82 60 e8 1f f0    	mov    %eax,-0xfe017a0(%edx)
+f0107d38:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107d3d:	f7 f3                	div    %ebx
+f0107d3f:	85 d2                	test   %edx,%edx
+f0107d41:	0f 85 d2 00 00 00    	jne    f0107e19 <prof_sample+0x126>
+f0107d47:	69 c6 0c 30 00 00    	imul   $0x300c,%esi,%eax
+f0107d4d:	83 80 64 e8 1f f0 01 	addl   $0x1,-0xfe0179c(%eax)
+f0107d54:	0f b7 41 34          	movzwl 0x34(%ecx),%eax
+f0107d58:	83 e0 03             	and    $0x3,%eax
+f0107d5b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+f0107d62:	66 83 f8 03          	cmp    $0x3,%ax
+f0107d66:	74 27                	je     f0107d8f <prof_sample+0x9c>
+f0107d68:	8b 79 30             	mov    0x30(%ecx),%edi
+f0107d6b:	89 f8                	mov    %edi,%eax
+f0107d6d:	c1 e8 0c             	shr    $0xc,%eax
+f0107d70:	31 f8                	xor    %edi,%eax
+f0107d72:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+f0107d75:	31 d8                	xor    %ebx,%eax
+f0107d77:	25 ff 03 00 00       	and    $0x3ff,%eax
+f0107d7c:	ba 01 04 00 00       	mov    $0x401,%edx
+f0107d81:	69 de 0c 30 00 00    	imul   $0x300c,%esi,%ebx
+f0107d87:	89 7d f0             	mov    %edi,-0x10(%ebp)
+f0107d8a:	89 75 e8             	mov    %esi,-0x18(%ebp)
+f0107d8d:	eb 46                	jmp    f0107dd5 <prof_sample+0xe2>
+f0107d8f:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0107d95:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0107d99:	74 cd                	je     f0107d68 <prof_sample+0x75>
+f0107d9b:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0107da1:	8b 40 04             	mov    0x4(%eax),%eax
+f0107da4:	8b 40 40             	mov    0x40(%eax),%eax
+f0107da7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f0107daa:	eb bc                	jmp    f0107d68 <prof_sample+0x75>
+f0107dac:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f0107daf:	8b 75 e8             	mov    -0x18(%ebp),%esi
+f0107db2:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0107db5:	69 de 0c 30 00 00    	imul   $0x300c,%esi,%ebx
+f0107dbb:	8d 94 93 60 e8 1f f0 	lea    -0xfe017a0(%ebx,%edx,4),%edx
+f0107dc2:	89 7a 0c             	mov    %edi,0xc(%edx)
+f0107dc5:	8b 7d ec             	mov    -0x14(%ebp),%edi
+f0107dc8:	89 7a 10             	mov    %edi,0x10(%edx)
+f0107dcb:	eb 39                	jmp    f0107e06 <prof_sample+0x113>
+f0107dcd:	83 c0 01             	add    $0x1,%eax
+f0107dd0:	25 ff 03 00 00       	and    $0x3ff,%eax
+f0107dd5:	83 ea 01             	sub    $0x1,%edx
+f0107dd8:	74 47                	je     f0107e21 <prof_sample+0x12e>
+f0107dda:	8d 0c 40             	lea    (%eax,%eax,2),%ecx
+f0107ddd:	8b 8c 8b 74 e8 1f f0 	mov    -0xfe0178c(%ebx,%ecx,4),%ecx
+f0107de4:	85 c9                	test   %ecx,%ecx
+f0107de6:	74 c4                	je     f0107dac <prof_sample+0xb9>
+f0107de8:	8d 34 40             	lea    (%eax,%eax,2),%esi
+f0107deb:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f0107dee:	3b bc b3 6c e8 1f f0 	cmp    -0xfe01794(%ebx,%esi,4),%edi
+f0107df5:	75 d6                	jne    f0107dcd <prof_sample+0xda>
+f0107df7:	8b 7d ec             	mov    -0x14(%ebp),%edi
+f0107dfa:	39 bc b3 70 e8 1f f0 	cmp    %edi,-0xfe01790(%ebx,%esi,4)
+f0107e01:	75 ca                	jne    f0107dcd <prof_sample+0xda>
+f0107e03:	8b 75 e8             	mov    -0x18(%ebp),%esi
+f0107e06:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0107e09:	69 c6 0c 30 00 00    	imul   $0x300c,%esi,%eax
+f0107e0f:	83 c1 01             	add    $0x1,%ecx
+f0107e12:	89 8c 90 74 e8 1f f0 	mov    %ecx,-0xfe0178c(%eax,%edx,4)
+f0107e19:	83 c4 0c             	add    $0xc,%esp
+f0107e1c:	5b                   	pop    %ebx
+f0107e1d:	5e                   	pop    %esi
+f0107e1e:	5f                   	pop    %edi
+f0107e1f:	5d                   	pop    %ebp
+f0107e20:	c3                   	ret
+f0107e21:	8b 75 e8             	mov    -0x18(%ebp),%esi
+f0107e24:	69 f6 0c 30 00 00    	imul   $0x300c,%esi,%esi
+f0107e2a:	83 86 68 e8 1f f0 01 	addl   $0x1,-0xfe01798(%esi)
+f0107e31:	eb e6                	jmp    f0107e19 <prof_sample+0x126>
+
+f0107e33 <prof_reset>:
+f0107e33:	55                   	push   %ebp
+f0107e34:	89 e5                	mov    %esp,%ebp
+f0107e36:	83 ec 0c             	sub    $0xc,%esp
+f0107e39:	68 60 80 01 00       	push   $0x18060
+f0107e3e:	6a 00                	push   $0x0
+f0107e40:	68 60 e8 1f f0       	push   $0xf01fe860
+f0107e45:	e8 3f 10 00 00       	call   f0108e89 <memset>
+f0107e4a:	83 c4 10             	add    $0x10,%esp
+f0107e4d:	c9                   	leave
+f0107e4e:	c3                   	ret
+
+f0107e4f <prof_print_top>:
+f0107e4f:	55                   	push   %ebp
+f0107e50:	89 e5                	mov    %esp,%ebp
+f0107e52:	57                   	push   %edi
+f0107e53:	56                   	push   %esi
+f0107e54:	53                   	push   %ebx
+f0107e55:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+f0107e5b:	c7 45 90 6c 18 20 f0 	movl   $0xf020186c,-0x70(%ebp)
+f0107e62:	bf 00 00 00 00       	mov    $0x0,%edi
+f0107e67:	be 00 00 00 00       	mov    $0x0,%esi
+f0107e6c:	c7 45 84 00 00 00 00 	movl   $0x0,-0x7c(%ebp)
+f0107e73:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107e78:	c7 45 80 00 00 00 00 	movl   $0x0,-0x80(%ebp)
+f0107e7f:	e9 f6 01 00 00       	jmp    f010807a <prof_print_top+0x22b>
+f0107e84:	83 ec 04             	sub    $0x4,%esp
+f0107e87:	6a 00                	push   $0x0
+f0107e89:	8d 55 a0             	lea    -0x60(%ebp),%edx
+f0107e8c:	52                   	push   %edx
+f0107e8d:	50                   	push   %eax
+f0107e8e:	e8 25 c4 ff ff       	call   f01042b8 <envid2env>
+f0107e93:	83 c4 10             	add    $0x10,%esp
+f0107e96:	85 c0                	test   %eax,%eax
+f0107e98:	78 70                	js     f0107f0a <prof_print_top+0xbb>
+f0107e9a:	8b 45 a0             	mov    -0x60(%ebp),%eax
+f0107e9d:	83 38 00             	cmpl   $0x0,(%eax)
+f0107ea0:	74 68                	je     f0107f0a <prof_print_top+0xbb>
+f0107ea2:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0107ea9:	8b 4a 04             	mov    0x4(%edx),%ecx
+f0107eac:	89 4d 8c             	mov    %ecx,-0x74(%ebp)
+f0107eaf:	0f 20 da             	mov    %cr3,%edx
+f0107eb2:	89 55 88             	mov    %edx,-0x78(%ebp)
+f0107eb5:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0107ebc:	89 42 04             	mov    %eax,0x4(%edx)
+f0107ebf:	8b 40 50             	mov    0x50(%eax),%eax
+f0107ec2:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0107ec7:	76 2f                	jbe    f0107ef8 <prof_print_top+0xa9>
+f0107ec9:	05 00 00 00 10       	add    $0x10000000,%eax
+f0107ece:	0f 22 d8             	mov    %eax,%cr3
+f0107ed1:	83 ec 08             	sub    $0x8,%esp
+f0107ed4:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f0107ed7:	50                   	push   %eax
+f0107ed8:	56                   	push   %esi
+f0107ed9:	e8 c5 f6 ff ff       	call   f01075a3 <debuginfo_eip>
+f0107ede:	8b 45 88             	mov    -0x78(%ebp),%eax
+f0107ee1:	0f 22 d8             	mov    %eax,%cr3
+f0107ee4:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0107eea:	8b 75 8c             	mov    -0x74(%ebp),%esi
+f0107eed:	89 70 04             	mov    %esi,0x4(%eax)
+f0107ef0:	83 c4 10             	add    $0x10,%esp
+f0107ef3:	e9 a7 00 00 00       	jmp    f0107f9f <prof_print_top+0x150>
+f0107ef8:	50                   	push   %eax
+f0107ef9:	68 08 9e 10 f0       	push   $0xf0109e08
+f0107efe:	6a 75                	push   $0x75
+f0107f00:	68 29 be 10 f0       	push   $0xf010be29
+f0107f05:	e8 21 82 ff ff       	call   f010012b <_panic>
+f0107f0a:	8b 45 94             	mov    -0x6c(%ebp),%eax
+f0107f0d:	8b 00                	mov    (%eax),%eax
+f0107f0f:	89 45 a8             	mov    %eax,-0x58(%ebp)
+f0107f12:	50                   	push   %eax
+f0107f13:	68 dd be 10 f0       	push   $0xf010bedd
+f0107f18:	6a 20                	push   $0x20
+f0107f1a:	8d 45 ac             	lea    -0x54(%ebp),%eax
+f0107f1d:	50                   	push   %eax
+f0107f1e:	e8 77 0c 00 00       	call   f0108b9a <snprintf>
+f0107f23:	83 c4 10             	add    $0x10,%esp
+f0107f26:	e9 b8 00 00 00       	jmp    f0107fe3 <prof_print_top+0x194>
+f0107f2b:	83 c0 01             	add    $0x1,%eax
+f0107f2e:	83 c2 2c             	add    $0x2c,%edx
+f0107f31:	39 c7                	cmp    %eax,%edi
+f0107f33:	7e 0b                	jle    f0107f40 <prof_print_top+0xf1>
+f0107f35:	39 0a                	cmp    %ecx,(%edx)
+f0107f37:	75 f2                	jne    f0107f2b <prof_print_top+0xdc>
+f0107f39:	39 72 04             	cmp    %esi,0x4(%edx)
+f0107f3c:	75 ed                	jne    f0107f2b <prof_print_top+0xdc>
+f0107f3e:	eb 06                	jmp    f0107f46 <prof_print_top+0xf7>
+f0107f40:	0f 84 b2 00 00 00    	je     f0107ff8 <prof_print_top+0x1a9>
+f0107f46:	6b c0 2c             	imul   $0x2c,%eax,%eax
+f0107f49:	8b 75 94             	mov    -0x6c(%ebp),%esi
+f0107f4c:	8b 56 08             	mov    0x8(%esi),%edx
+f0107f4f:	01 90 88 bc 1f f0    	add    %edx,-0xfe04378(%eax)
+f0107f55:	83 c3 0c             	add    $0xc,%ebx
+f0107f58:	8b 45 90             	mov    -0x70(%ebp),%eax
+f0107f5b:	39 c3                	cmp    %eax,%ebx
+f0107f5d:	0f 84 01 01 00 00    	je     f0108064 <prof_print_top+0x215>
+f0107f63:	89 5d 94             	mov    %ebx,-0x6c(%ebp)
+f0107f66:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+f0107f6a:	74 e9                	je     f0107f55 <prof_print_top+0x106>
+f0107f6c:	83 ec 04             	sub    $0x4,%esp
+f0107f6f:	6a 2c                	push   $0x2c
+f0107f71:	6a 00                	push   $0x0
+f0107f73:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+f0107f76:	50                   	push   %eax
+f0107f77:	e8 0d 0f 00 00       	call   f0108e89 <memset>
+f0107f7c:	8b 43 04             	mov    0x4(%ebx),%eax
+f0107f7f:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+f0107f82:	8b 33                	mov    (%ebx),%esi
+f0107f84:	83 c4 10             	add    $0x10,%esp
+f0107f87:	85 c0                	test   %eax,%eax
+f0107f89:	0f 85 f5 fe ff ff    	jne    f0107e84 <prof_print_top+0x35>
+f0107f8f:	83 ec 08             	sub    $0x8,%esp
+f0107f92:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f0107f95:	50                   	push   %eax
+f0107f96:	56                   	push   %esi
+f0107f97:	e8 07 f6 ff ff       	call   f01075a3 <debuginfo_eip>
+f0107f9c:	83 c4 10             	add    $0x10,%esp
+f0107f9f:	83 ec 04             	sub    $0x4,%esp
+f0107fa2:	ff 75 dc             	push   -0x24(%ebp)
+f0107fa5:	68 f0 bc 10 f0       	push   $0xf010bcf0
+f0107faa:	ff 75 d8             	push   -0x28(%ebp)
+f0107fad:	e8 5d 0e 00 00       	call   f0108e0f <strncmp>
+f0107fb2:	83 c4 10             	add    $0x10,%esp
+f0107fb5:	85 c0                	test   %eax,%eax
+f0107fb7:	0f 84 4d ff ff ff    	je     f0107f0a <prof_print_top+0xbb>
+f0107fbd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0107fc0:	89 45 a8             	mov    %eax,-0x58(%ebp)
+f0107fc3:	83 ec 04             	sub    $0x4,%esp
+f0107fc6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0107fc9:	ba 1f 00 00 00       	mov    $0x1f,%edx
+f0107fce:	39 d0                	cmp    %edx,%eax
+f0107fd0:	0f 4f c2             	cmovg  %edx,%eax
+f0107fd3:	50                   	push   %eax
+f0107fd4:	ff 75 d8             	push   -0x28(%ebp)
+f0107fd7:	8d 45 ac             	lea    -0x54(%ebp),%eax
+f0107fda:	50                   	push   %eax
+f0107fdb:	e8 f8 0e 00 00       	call   f0108ed8 <memmove>
+f0107fe0:	83 c4 10             	add    $0x10,%esp
+f0107fe3:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+f0107fe6:	8b 75 a8             	mov    -0x58(%ebp),%esi
+f0107fe9:	ba 60 bc 1f f0       	mov    $0xf01fbc60,%edx
+f0107fee:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107ff3:	e9 39 ff ff ff       	jmp    f0107f31 <prof_print_top+0xe2>
+f0107ff8:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+f0107ffe:	74 56                	je     f0108056 <prof_print_top+0x207>
+f0108000:	6b cf 2c             	imul   $0x2c,%edi,%ecx
+f0108003:	8d 91 60 bc 1f f0    	lea    -0xfe043a0(%ecx),%edx
+f0108009:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+f010800c:	89 b1 60 bc 1f f0    	mov    %esi,-0xfe043a0(%ecx)
+f0108012:	8b 4d a8             	mov    -0x58(%ebp),%ecx
+f0108015:	89 4a 04             	mov    %ecx,0x4(%edx)
+f0108018:	8b 4d ac             	mov    -0x54(%ebp),%ecx
+f010801b:	89 4a 08             	mov    %ecx,0x8(%edx)
+f010801e:	8b 4d b0             	mov    -0x50(%ebp),%ecx
+f0108021:	89 4a 0c             	mov    %ecx,0xc(%edx)
+f0108024:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+f0108027:	89 4a 10             	mov    %ecx,0x10(%edx)
+f010802a:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+f010802d:	89 4a 14             	mov    %ecx,0x14(%edx)
+f0108030:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+f0108033:	89 4a 18             	mov    %ecx,0x18(%edx)
+f0108036:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f0108039:	89 4a 1c             	mov    %ecx,0x1c(%edx)
+f010803c:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f010803f:	89 4a 20             	mov    %ecx,0x20(%edx)
+f0108042:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+f0108045:	89 4a 24             	mov    %ecx,0x24(%edx)
+f0108048:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f010804b:	89 4a 28             	mov    %ecx,0x28(%edx)
+f010804e:	8d 7f 01             	lea    0x1(%edi),%edi
+f0108051:	e9 f0 fe ff ff       	jmp    f0107f46 <prof_print_top+0xf7>
+f0108056:	8b 75 94             	mov    -0x6c(%ebp),%esi
+f0108059:	8b 76 08             	mov    0x8(%esi),%esi
+f010805c:	01 75 84             	add    %esi,-0x7c(%ebp)
+f010805f:	e9 f1 fe ff ff       	jmp    f0107f55 <prof_print_top+0x106>
+f0108064:	8b b5 7c ff ff ff    	mov    -0x84(%ebp),%esi
+f010806a:	8b 95 78 ff ff ff    	mov    -0x88(%ebp),%edx
+f0108070:	83 c2 01             	add    $0x1,%edx
+f0108073:	81 45 90 0c 30 00 00 	addl   $0x300c,-0x70(%ebp)
+f010807a:	39 15 00 70 25 f0    	cmp    %edx,0xf0257000
+f0108080:	7e 29                	jle    f01080ab <prof_print_top+0x25c>
+f0108082:	8b 45 90             	mov    -0x70(%ebp),%eax
+f0108085:	8b 88 f8 cf ff ff    	mov    -0x3008(%eax),%ecx
+f010808b:	01 4d 80             	add    %ecx,-0x80(%ebp)
+f010808e:	03 b0 fc cf ff ff    	add    -0x3004(%eax),%esi
+f0108094:	8d 98 00 d0 ff ff    	lea    -0x3000(%eax),%ebx
+f010809a:	89 b5 7c ff ff ff    	mov    %esi,-0x84(%ebp)
+f01080a0:	89 95 78 ff ff ff    	mov    %edx,-0x88(%ebp)
+f01080a6:	e9 ad fe ff ff       	jmp    f0107f58 <prof_print_top+0x109>
+f01080ab:	89 f2                	mov    %esi,%edx
+f01080ad:	89 fe                	mov    %edi,%esi
+f01080af:	52                   	push   %edx
+f01080b0:	ff 35 40 bc 1f f0    	push   0xf01fbc40
+f01080b6:	8b 7d 80             	mov    -0x80(%ebp),%edi
+f01080b9:	57                   	push   %edi
+f01080ba:	68 00 be 10 f0       	push   $0xf010be00
+f01080bf:	e8 5f cf ff ff       	call   f0105023 <cprintf>
+f01080c4:	83 c4 10             	add    $0x10,%esp
+f01080c7:	85 ff                	test   %edi,%edi
+f01080c9:	0f 84 9d 01 00 00    	je     f010826c <prof_print_top+0x41d>
+f01080cf:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f01080d3:	7e 17                	jle    f01080ec <prof_print_top+0x29d>
+f01080d5:	3b 75 08             	cmp    0x8(%ebp),%esi
+f01080d8:	7c 12                	jl     f01080ec <prof_print_top+0x29d>
+f01080da:	bf 68 bc 1f f0       	mov    $0xf01fbc68,%edi
+f01080df:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01080e4:	89 75 94             	mov    %esi,-0x6c(%ebp)
+f01080e7:	e9 3f 01 00 00       	jmp    f010822b <prof_print_top+0x3dc>
+f01080ec:	89 75 08             	mov    %esi,0x8(%ebp)
+f01080ef:	eb e9                	jmp    f01080da <prof_print_top+0x28b>
+f01080f1:	8b 5a 28             	mov    0x28(%edx),%ebx
+f01080f4:	39 58 28             	cmp    %ebx,0x28(%eax)
+f01080f7:	0f 42 c2             	cmovb  %edx,%eax
+f01080fa:	83 c1 01             	add    $0x1,%ecx
+f01080fd:	83 c2 2c             	add    $0x2c,%edx
+f0108100:	39 ce                	cmp    %ecx,%esi
+f0108102:	7f ed                	jg     f01080f1 <prof_print_top+0x2a2>
+f0108104:	89 75 94             	mov    %esi,-0x6c(%ebp)
+f0108107:	8b 5d 90             	mov    -0x70(%ebp),%ebx
+f010810a:	8b 10                	mov    (%eax),%edx
+f010810c:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+f010810f:	8b 48 04             	mov    0x4(%eax),%ecx
+f0108112:	89 4d a8             	mov    %ecx,-0x58(%ebp)
+f0108115:	8b 70 08             	mov    0x8(%eax),%esi
+f0108118:	89 75 90             	mov    %esi,-0x70(%ebp)
+f010811b:	89 75 ac             	mov    %esi,-0x54(%ebp)
+f010811e:	8b 70 0c             	mov    0xc(%eax),%esi
+f0108121:	89 75 8c             	mov    %esi,-0x74(%ebp)
+f0108124:	89 75 b0             	mov    %esi,-0x50(%ebp)
+f0108127:	8b 70 10             	mov    0x10(%eax),%esi
+f010812a:	89 75 88             	mov    %esi,-0x78(%ebp)
+f010812d:	89 75 b4             	mov    %esi,-0x4c(%ebp)
+f0108130:	8b 70 14             	mov    0x14(%eax),%esi
+f0108133:	89 b5 7c ff ff ff    	mov    %esi,-0x84(%ebp)
+f0108139:	89 75 b8             	mov    %esi,-0x48(%ebp)
+f010813c:	8b 70 18             	mov    0x18(%eax),%esi
+f010813f:	89 b5 78 ff ff ff    	mov    %esi,-0x88(%ebp)
+f0108145:	89 75 bc             	mov    %esi,-0x44(%ebp)
+f0108148:	8b 70 1c             	mov    0x1c(%eax),%esi
+f010814b:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%ebp)
+f0108151:	89 75 c0             	mov    %esi,-0x40(%ebp)
+f0108154:	8b 70 20             	mov    0x20(%eax),%esi
+f0108157:	89 b5 70 ff ff ff    	mov    %esi,-0x90(%ebp)
+f010815d:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+f0108160:	8b 70 24             	mov    0x24(%eax),%esi
+f0108163:	89 b5 6c ff ff ff    	mov    %esi,-0x94(%ebp)
+f0108169:	89 75 c8             	mov    %esi,-0x38(%ebp)
+f010816c:	8b 70 28             	mov    0x28(%eax),%esi
+f010816f:	89 b5 68 ff ff ff    	mov    %esi,-0x98(%ebp)
+f0108175:	89 75 cc             	mov    %esi,-0x34(%ebp)
+f0108178:	8b 77 f8             	mov    -0x8(%edi),%esi
+f010817b:	89 30                	mov    %esi,(%eax)
+f010817d:	8b 77 fc             	mov    -0x4(%edi),%esi
+f0108180:	89 70 04             	mov    %esi,0x4(%eax)
+f0108183:	8b 37                	mov    (%edi),%esi
+f0108185:	89 70 08             	mov    %esi,0x8(%eax)
+f0108188:	8b 77 04             	mov    0x4(%edi),%esi
+f010818b:	89 70 0c             	mov    %esi,0xc(%eax)
+f010818e:	8b 77 08             	mov    0x8(%edi),%esi
+f0108191:	89 70 10             	mov    %esi,0x10(%eax)
+f0108194:	8b 77 0c             	mov    0xc(%edi),%esi
+f0108197:	89 70 14             	mov    %esi,0x14(%eax)
+f010819a:	8b 77 10             	mov    0x10(%edi),%esi
+f010819d:	89 70 18             	mov    %esi,0x18(%eax)
+f01081a0:	8b 77 14             	mov    0x14(%edi),%esi
+f01081a3:	89 70 1c             	mov    %esi,0x1c(%eax)
+f01081a6:	8b 77 18             	mov    0x18(%edi),%esi
+f01081a9:	89 70 20             	mov    %esi,0x20(%eax)
+f01081ac:	8b 77 1c             	mov    0x1c(%edi),%esi
+f01081af:	89 70 24             	mov    %esi,0x24(%eax)
+f01081b2:	8b 77 20             	mov    0x20(%edi),%esi
+f01081b5:	89 70 28             	mov    %esi,0x28(%eax)
+f01081b8:	89 57 f8             	mov    %edx,-0x8(%edi)
+f01081bb:	89 4f fc             	mov    %ecx,-0x4(%edi)
+f01081be:	8b 75 90             	mov    -0x70(%ebp),%esi
+f01081c1:	89 37                	mov    %esi,(%edi)
+f01081c3:	8b 75 8c             	mov    -0x74(%ebp),%esi
+f01081c6:	89 77 04             	mov    %esi,0x4(%edi)
+f01081c9:	8b 75 88             	mov    -0x78(%ebp),%esi
+f01081cc:	89 77 08             	mov    %esi,0x8(%edi)
+f01081cf:	8b b5 7c ff ff ff    	mov    -0x84(%ebp),%esi
+f01081d5:	89 77 0c             	mov    %esi,0xc(%edi)
+f01081d8:	8b b5 78 ff ff ff    	mov    -0x88(%ebp),%esi
+f01081de:	89 77 10             	mov    %esi,0x10(%edi)
+f01081e1:	8b b5 74 ff ff ff    	mov    -0x8c(%ebp),%esi
+f01081e7:	89 77 14             	mov    %esi,0x14(%edi)
+f01081ea:	8b b5 70 ff ff ff    	mov    -0x90(%ebp),%esi
+f01081f0:	89 77 18             	mov    %esi,0x18(%edi)
+f01081f3:	8b b5 6c ff ff ff    	mov    -0x94(%ebp),%esi
+f01081f9:	89 77 1c             	mov    %esi,0x1c(%edi)
+f01081fc:	8b b5 68 ff ff ff    	mov    -0x98(%ebp),%esi
+f0108202:	89 77 20             	mov    %esi,0x20(%edi)
+f0108205:	85 d2                	test   %edx,%edx
+f0108207:	74 3d                	je     f0108246 <prof_print_top+0x3f7>
+f0108209:	83 ec 0c             	sub    $0xc,%esp
+f010820c:	57                   	push   %edi
+f010820d:	52                   	push   %edx
+f010820e:	6b c6 64             	imul   $0x64,%esi,%eax
+f0108211:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108216:	f7 75 80             	divl   -0x80(%ebp)
+f0108219:	50                   	push   %eax
+f010821a:	56                   	push   %esi
+f010821b:	68 35 be 10 f0       	push   $0xf010be35
+f0108220:	e8 fe cd ff ff       	call   f0105023 <cprintf>
+f0108225:	83 c4 20             	add    $0x20,%esp
+f0108228:	83 c7 2c             	add    $0x2c,%edi
+f010822b:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+f010822e:	7e 36                	jle    f0108266 <prof_print_top+0x417>
+f0108230:	8d 47 f8             	lea    -0x8(%edi),%eax
+f0108233:	83 c3 01             	add    $0x1,%ebx
+f0108236:	8d 57 24             	lea    0x24(%edi),%edx
+f0108239:	89 d9                	mov    %ebx,%ecx
+f010823b:	8b 75 94             	mov    -0x6c(%ebp),%esi
+f010823e:	89 5d 90             	mov    %ebx,-0x70(%ebp)
+f0108241:	e9 ba fe ff ff       	jmp    f0108100 <prof_print_top+0x2b1>
+f0108246:	8b 4f 20             	mov    0x20(%edi),%ecx
+f0108249:	57                   	push   %edi
+f010824a:	6b c1 64             	imul   $0x64,%ecx,%eax
+f010824d:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108252:	f7 75 80             	divl   -0x80(%ebp)
+f0108255:	50                   	push   %eax
+f0108256:	51                   	push   %ecx
+f0108257:	68 4d be 10 f0       	push   $0xf010be4d
+f010825c:	e8 c2 cd ff ff       	call   f0105023 <cprintf>
+f0108261:	83 c4 10             	add    $0x10,%esp
+f0108264:	eb c2                	jmp    f0108228 <prof_print_top+0x3d9>
+f0108266:	83 7d 84 00          	cmpl   $0x0,-0x7c(%ebp)
+f010826a:	75 08                	jne    f0108274 <prof_print_top+0x425>
+f010826c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010826f:	5b                   	pop    %ebx
+f0108270:	5e                   	pop    %esi
+f0108271:	5f                   	pop    %edi
+f0108272:	5d                   	pop    %ebp
+f0108273:	c3                   	ret
+f0108274:	83 ec 08             	sub    $0x8,%esp
+f0108277:	ff 75 84             	push   -0x7c(%ebp)
+f010827a:	68 69 be 10 f0       	push   $0xf010be69
+f010827f:	e8 9f cd ff ff       	call   f0105023 <cprintf>
+f0108284:	83 c4 10             	add    $0x10,%esp
+f0108287:	eb e3                	jmp    f010826c <prof_print_top+0x41d>
+
+f0108289 <pmu_init_percpu>:
+f0108289:	55                   	push   %ebp
+f010828a:	89 e5                	mov    %esp,%ebp
+f010828c:	57                   	push   %edi
+f010828d:	56                   	push   %esi
+f010828e:	53                   	push   %ebx
+f010828f:	83 ec 1c             	sub    $0x1c,%esp
+f0108292:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108297:	0f a2                	cpuid
+f0108299:	83 f8 09             	cmp    $0x9,%eax
+f010829c:	0f 86 d4 00 00 00    	jbe    f0108376 <pmu_init_percpu+0xed>
+f01082a2:	b8 0a 00 00 00       	mov    $0xa,%eax
+f01082a7:	0f a2                	cpuid
+f01082a9:	89 c2                	mov    %eax,%edx
+f01082ab:	81 e2 ff 00 00 00    	and    $0xff,%edx
+f01082b1:	0f 84 bf 00 00 00    	je     f0108376 <pmu_init_percpu+0xed>
+f01082b7:	0f b6 dc             	movzbl %ah,%ebx
+f01082ba:	f6 c4 ff             	test   $0xff,%ah
+f01082bd:	0f 84 b3 00 00 00    	je     f0108376 <pmu_init_percpu+0xed>
+f01082c3:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+f01082ca:	39 0d 08 70 25 f0    	cmp    %ecx,0xf0257008
+f01082d0:	74 1e                	je     f01082f0 <pmu_init_percpu+0x67>
+f01082d2:	a1 c8 6a 21 f0       	mov    0xf0216ac8,%eax
+f01082d7:	05 86 01 00 00       	add    $0x186,%eax
+f01082dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01082df:	bb 86 01 00 00       	mov    $0x186,%ebx
+f01082e4:	be 00 00 00 00       	mov    $0x0,%esi
+f01082e9:	bf 00 00 00 00       	mov    $0x0,%edi
+f01082ee:	eb 7f                	jmp    f010836f <pmu_init_percpu+0xe6>
+f01082f0:	b9 04 00 00 00       	mov    $0x4,%ecx
+f01082f5:	39 cb                	cmp    %ecx,%ebx
+f01082f7:	0f 46 cb             	cmovbe %ebx,%ecx
+f01082fa:	89 0d c8 6a 21 f0    	mov    %ecx,0xf0216ac8
+f0108300:	c1 e8 10             	shr    $0x10,%eax
+f0108303:	89 c1                	mov    %eax,%ecx
+f0108305:	0f b6 c0             	movzbl %al,%eax
+f0108308:	89 cf                	mov    %ecx,%edi
+f010830a:	c1 ef 05             	shr    $0x5,%edi
+f010830d:	83 e7 01             	and    $0x1,%edi
+f0108310:	89 fe                	mov    %edi,%esi
+f0108312:	83 f6 01             	xor    $0x1,%esi
+f0108315:	d3 e6                	shl    %cl,%esi
+f0108317:	d3 e7                	shl    %cl,%edi
+f0108319:	83 c6 ff             	add    $0xffffffff,%esi
+f010831c:	83 d7 ff             	adc    $0xffffffff,%edi
+f010831f:	89 35 c0 6a 21 f0    	mov    %esi,0xf0216ac0
+f0108325:	89 3d c4 6a 21 f0    	mov    %edi,0xf0216ac4
+f010832b:	50                   	push   %eax
+f010832c:	53                   	push   %ebx
+f010832d:	52                   	push   %edx
+f010832e:	68 88 be 10 f0       	push   $0xf010be88
+f0108333:	e8 eb cc ff ff       	call   f0105023 <cprintf>
+f0108338:	83 c4 10             	add    $0x10,%esp
+f010833b:	eb 95                	jmp    f01082d2 <pmu_init_percpu+0x49>
+f010833d:	89 d9                	mov    %ebx,%ecx
+f010833f:	89 f0                	mov    %esi,%eax
+f0108341:	89 fa                	mov    %edi,%edx
+f0108343:	0f 30                	wrmsr
+f0108345:	8d 8b 3b ff ff ff    	lea    -0xc5(%ebx),%ecx
+f010834b:	0f 30                	wrmsr
+f010834d:	0f b6 04 dd f5 b2 10 	movzbl -0xfef4d0b(,%ebx,8),%eax
+f0108354:	f0 
+f0108355:	c1 e0 08             	shl    $0x8,%eax
+f0108358:	0f b6 14 dd f4 b2 10 	movzbl -0xfef4d0c(,%ebx,8),%edx
+f010835f:	f0 
+f0108360:	09 d0                	or     %edx,%eax
+f0108362:	0d 00 00 41 00       	or     $0x410000,%eax
+f0108367:	99                   	cltd
+f0108368:	89 d9                	mov    %ebx,%ecx
+f010836a:	0f 30                	wrmsr
+f010836c:	83 c3 01             	add    $0x1,%ebx
+f010836f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108372:	39 c3                	cmp    %eax,%ebx
+f0108374:	75 c7                	jne    f010833d <pmu_init_percpu+0xb4>
+f0108376:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108379:	5b                   	pop    %ebx
+f010837a:	5e                   	pop    %esi
+f010837b:	5f                   	pop    %edi
+f010837c:	5d                   	pop    %ebp
+f010837d:	c3                   	ret
+
+f010837e <pmu_save>:
+f010837e:	55                   	push   %ebp
+f010837f:	89 e5                	mov    %esp,%ebp
+f0108381:	57                   	push   %edi
+f0108382:	56                   	push   %esi
+f0108383:	53                   	push   %ebx
+f0108384:	83 ec 1c             	sub    $0x1c,%esp
+f0108387:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010838d:	8b 3d c8 6a 21 f0    	mov    0xf0216ac8,%edi
+f0108393:	85 ff                	test   %edi,%edi
+f0108395:	0f 84 9d 00 00 00    	je     f0108438 <pmu_save+0xba>
+f010839b:	2d 40 70 25 f0       	sub    $0xf0257040,%eax
+f01083a0:	c1 f8 06             	sar    $0x6,%eax
+f01083a3:	69 d8 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%ebx
+f01083a9:	89 d8                	mov    %ebx,%eax
+f01083ab:	c1 e0 06             	shl    $0x6,%eax
+f01083ae:	8b 55 08             	mov    0x8(%ebp),%edx
+f01083b1:	39 90 c0 68 21 f0    	cmp    %edx,-0xfde9740(%eax)
+f01083b7:	75 7f                	jne    f0108438 <pmu_save+0xba>
+f01083b9:	85 d2                	test   %edx,%edx
+f01083bb:	74 7b                	je     f0108438 <pmu_save+0xba>
+f01083bd:	a1 c0 6a 21 f0       	mov    0xf0216ac0,%eax
+f01083c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01083c5:	a1 c4 6a 21 f0       	mov    0xf0216ac4,%eax
+f01083ca:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f01083cd:	89 d8                	mov    %ebx,%eax
+f01083cf:	c1 e0 06             	shl    $0x6,%eax
+f01083d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01083d5:	be 00 00 00 00       	mov    $0x0,%esi
+f01083da:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+f01083dd:	eb 45                	jmp    f0108424 <pmu_save+0xa6>
+f01083df:	8d 8e c1 00 00 00    	lea    0xc1(%esi),%ecx
+f01083e5:	0f 32                	rdmsr
+f01083e7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01083ea:	8b 8c b1 c4 68 21 f0 	mov    -0xfde973c(%ecx,%esi,4),%ecx
+f01083f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01083f6:	29 c8                	sub    %ecx,%eax
+f01083f8:	19 da                	sbb    %ebx,%edx
+f01083fa:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f01083fd:	21 c1                	and    %eax,%ecx
+f01083ff:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+f0108402:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0108405:	21 d3                	and    %edx,%ebx
+f0108407:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+f010840a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+f010840d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+f0108410:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0108413:	01 84 f3 44 03 00 00 	add    %eax,0x344(%ebx,%esi,8)
+f010841a:	11 94 f3 48 03 00 00 	adc    %edx,0x348(%ebx,%esi,8)
+f0108421:	83 c6 01             	add    $0x1,%esi
+f0108424:	39 f7                	cmp    %esi,%edi
+f0108426:	7f b7                	jg     f01083df <pmu_save+0x61>
+f0108428:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+f010842b:	c1 e3 06             	shl    $0x6,%ebx
+f010842e:	c7 83 c0 68 21 f0 00 	movl   $0x0,-0xfde9740(%ebx)
+f0108435:	00 00 00 
+f0108438:	83 c4 1c             	add    $0x1c,%esp
+f010843b:	5b                   	pop    %ebx
+f010843c:	5e                   	pop    %esi
+f010843d:	5f                   	pop    %edi
+f010843e:	5d                   	pop    %ebp
+f010843f:	c3                   	ret
+
+f0108440 <pmu_restore>:
+f0108440:	55                   	push   %ebp
+f0108441:	89 e5                	mov    %esp,%ebp
+f0108443:	57                   	push   %edi
+f0108444:	56                   	push   %esi
+f0108445:	53                   	push   %ebx
+f0108446:	83 ec 0c             	sub    $0xc,%esp
+f0108449:	8b 75 08             	mov    0x8(%ebp),%esi
+f010844c:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0108453:	0f 20 e0             	mov    %cr4,%eax
+f0108456:	0f b6 5e 5e          	movzbl 0x5e(%esi),%ebx
+f010845a:	89 c1                	mov    %eax,%ecx
+f010845c:	c1 e9 08             	shr    $0x8,%ecx
+f010845f:	83 e1 01             	and    $0x1,%ecx
+f0108462:	38 d9                	cmp    %bl,%cl
+f0108464:	74 10                	je     f0108476 <pmu_restore+0x36>
+f0108466:	89 c1                	mov    %eax,%ecx
+f0108468:	80 cd 01             	or     $0x1,%ch
+f010846b:	80 e4 fe             	and    $0xfe,%ah
+f010846e:	84 db                	test   %bl,%bl
+f0108470:	0f 45 c1             	cmovne %ecx,%eax
+f0108473:	0f 22 e0             	mov    %eax,%cr4
+f0108476:	8b 3d c8 6a 21 f0    	mov    0xf0216ac8,%edi
+f010847c:	85 ff                	test   %edi,%edi
+f010847e:	74 64                	je     f01084e4 <pmu_restore+0xa4>
+f0108480:	81 ea 40 70 25 f0    	sub    $0xf0257040,%edx
+f0108486:	c1 fa 06             	sar    $0x6,%edx
+f0108489:	69 ca ab aa aa aa    	imul   $0xaaaaaaab,%edx,%ecx
+f010848f:	89 c8                	mov    %ecx,%eax
+f0108491:	c1 e0 06             	shl    $0x6,%eax
+f0108494:	39 b0 c0 68 21 f0    	cmp    %esi,-0xfde9740(%eax)
+f010849a:	74 48                	je     f01084e4 <pmu_restore+0xa4>
+f010849c:	89 c8                	mov    %ecx,%eax
+f010849e:	c1 e0 06             	shl    $0x6,%eax
+f01084a1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f01084a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01084a9:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+f01084ac:	eb 26                	jmp    f01084d4 <pmu_restore+0x94>
+f01084ae:	8b 84 de 44 03 00 00 	mov    0x344(%esi,%ebx,8),%eax
+f01084b5:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+f01084ba:	8b 55 ec             	mov    -0x14(%ebp),%edx
+f01084bd:	89 84 9a c4 68 21 f0 	mov    %eax,-0xfde973c(%edx,%ebx,4)
+f01084c4:	8d 8b c1 00 00 00    	lea    0xc1(%ebx),%ecx
+f01084ca:	ba 00 00 00 00       	mov    $0x0,%edx
+f01084cf:	0f 30                	wrmsr
+f01084d1:	83 c3 01             	add    $0x1,%ebx
+f01084d4:	39 df                	cmp    %ebx,%edi
+f01084d6:	7f d6                	jg     f01084ae <pmu_restore+0x6e>
+f01084d8:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+f01084db:	c1 e1 06             	shl    $0x6,%ecx
+f01084de:	89 b1 c0 68 21 f0    	mov    %esi,-0xfde9740(%ecx)
+f01084e4:	83 c4 0c             	add    $0xc,%esp
+f01084e7:	5b                   	pop    %ebx
+f01084e8:	5e                   	pop    %esi
+f01084e9:	5f                   	pop    %edi
+f01084ea:	5d                   	pop    %ebp
+f01084eb:	c3                   	ret
+
+f01084ec <pmu_release>:
+f01084ec:	55                   	push   %ebp
+f01084ed:	89 e5                	mov    %esp,%ebp
+f01084ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01084f2:	b8 c0 68 21 f0       	mov    $0xf02168c0,%eax
+f01084f7:	ba c0 6a 21 f0       	mov    $0xf0216ac0,%edx
+f01084fc:	eb 03                	jmp    f0108501 <pmu_release+0x15>
+f01084fe:	83 c0 40             	add    $0x40,%eax
+f0108501:	39 d0                	cmp    %edx,%eax
+f0108503:	74 0c                	je     f0108511 <pmu_release+0x25>
+f0108505:	39 08                	cmp    %ecx,(%eax)
+f0108507:	75 f5                	jne    f01084fe <pmu_release+0x12>
+f0108509:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f010850f:	eb ed                	jmp    f01084fe <pmu_release+0x12>
+f0108511:	5d                   	pop    %ebp
+f0108512:	c3                   	ret
+
+f0108513 <pmu_print>:
+f0108513:	55                   	push   %ebp
+f0108514:	89 e5                	mov    %esp,%ebp
+f0108516:	57                   	push   %edi
+f0108517:	56                   	push   %esi
+f0108518:	53                   	push   %ebx
+f0108519:	83 ec 1c             	sub    $0x1c,%esp
+f010851c:	83 3d c8 6a 21 f0 00 	cmpl   $0x0,0xf0216ac8
+f0108523:	74 39                	je     f010855e <pmu_print+0x4b>
+f0108525:	83 ec 0c             	sub    $0xc,%esp
+f0108528:	68 ca be 10 f0       	push   $0xf010beca
+f010852d:	e8 f1 ca ff ff       	call   f0105023 <cprintf>
+f0108532:	83 c4 10             	add    $0x10,%esp
+f0108535:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010853a:	39 1d c8 6a 21 f0    	cmp    %ebx,0xf0216ac8
+f0108540:	7e 34                	jle    f0108576 <pmu_print+0x63>
+f0108542:	83 ec 08             	sub    $0x8,%esp
+f0108545:	ff 34 dd 20 bf 10 f0 	push   -0xfef40e0(,%ebx,8)
+f010854c:	68 d5 be 10 f0       	push   $0xf010bed5
+f0108551:	e8 cd ca ff ff       	call   f0105023 <cprintf>
+f0108556:	83 c3 01             	add    $0x1,%ebx
+f0108559:	83 c4 10             	add    $0x10,%esp
+f010855c:	eb dc                	jmp    f010853a <pmu_print+0x27>
+f010855e:	83 ec 0c             	sub    $0xc,%esp
+f0108561:	68 b1 be 10 f0       	push   $0xf010beb1
+f0108566:	e8 b8 ca ff ff       	call   f0105023 <cprintf>
+f010856b:	83 c4 10             	add    $0x10,%esp
+f010856e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108571:	5b                   	pop    %ebx
+f0108572:	5e                   	pop    %esi
+f0108573:	5f                   	pop    %edi
+f0108574:	5d                   	pop    %ebp
+f0108575:	c3                   	ret
+f0108576:	83 ec 0c             	sub    $0xc,%esp
+f0108579:	68 50 b1 10 f0       	push   $0xf010b150
+f010857e:	e8 a0 ca ff ff       	call   f0105023 <cprintf>
+f0108583:	83 c4 10             	add    $0x10,%esp
+f0108586:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f010858d:	bf 00 00 00 00       	mov    $0x0,%edi
+f0108592:	eb 43                	jmp    f01085d7 <pmu_print+0xc4>
+f0108594:	83 ec 04             	sub    $0x4,%esp
+f0108597:	ff b4 f3 48 03 00 00 	push   0x348(%ebx,%esi,8)
+f010859e:	ff b4 f3 44 03 00 00 	push   0x344(%ebx,%esi,8)
+f01085a5:	68 e2 be 10 f0       	push   $0xf010bee2
+f01085aa:	e8 74 ca ff ff       	call   f0105023 <cprintf>
+f01085af:	83 c6 01             	add    $0x1,%esi
+f01085b2:	83 c4 10             	add    $0x10,%esp
+f01085b5:	39 35 c8 6a 21 f0    	cmp    %esi,0xf0216ac8
+f01085bb:	7f d7                	jg     f0108594 <pmu_print+0x81>
+f01085bd:	83 ec 0c             	sub    $0xc,%esp
+f01085c0:	68 50 b1 10 f0       	push   $0xf010b150
+f01085c5:	e8 59 ca ff ff       	call   f0105023 <cprintf>
+f01085ca:	83 c4 10             	add    $0x10,%esp
+f01085cd:	83 c7 01             	add    $0x1,%edi
+f01085d0:	81 45 e4 80 03 00 00 	addl   $0x380,-0x1c(%ebp)
+f01085d7:	3b 3d 40 37 1a f0    	cmp    0xf01a3740,%edi
+f01085dd:	73 8f                	jae    f010856e <pmu_print+0x5b>
+f01085df:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f01085e2:	03 1d 44 37 1a f0    	add    0xf01a3744,%ebx
+f01085e8:	83 3b 00             	cmpl   $0x0,(%ebx)
+f01085eb:	74 e0                	je     f01085cd <pmu_print+0xba>
+f01085ed:	8b 83 48 03 00 00    	mov    0x348(%ebx),%eax
+f01085f3:	0b 83 44 03 00 00    	or     0x344(%ebx),%eax
+f01085f9:	74 d2                	je     f01085cd <pmu_print+0xba>
+f01085fb:	83 ec 08             	sub    $0x8,%esp
+f01085fe:	ff 73 40             	push   0x40(%ebx)
+f0108601:	68 db be 10 f0       	push   $0xf010bedb
+f0108606:	e8 18 ca ff ff       	call   f0105023 <cprintf>
+f010860b:	83 c4 10             	add    $0x10,%esp
+f010860e:	be 00 00 00 00       	mov    $0x0,%esi
+f0108613:	eb a0                	jmp    f01085b5 <pmu_print+0xa2>
+
+f0108615 <printnum>:
+f0108615:	55                   	push   %ebp
+f0108616:	89 e5                	mov    %esp,%ebp
+f0108618:	57                   	push   %edi
+f0108619:	56                   	push   %esi
+f010861a:	53                   	push   %ebx
+f010861b:	83 ec 1c             	sub    $0x1c,%esp
+f010861e:	89 c7                	mov    %eax,%edi
+f0108620:	89 d6                	mov    %edx,%esi
+f0108622:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108625:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0108628:	89 d1                	mov    %edx,%ecx
+f010862a:	89 c2                	mov    %eax,%edx
+f010862c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f010862f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0108632:	8b 45 10             	mov    0x10(%ebp),%eax
+f0108635:	8b 5d 14             	mov    0x14(%ebp),%ebx
+f0108638:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010863b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0108642:	39 c2                	cmp    %eax,%edx
+f0108644:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+f0108647:	72 3e                	jb     f0108687 <printnum+0x72>
+f0108649:	83 ec 0c             	sub    $0xc,%esp
+f010864c:	ff 75 18             	push   0x18(%ebp)
+f010864f:	83 eb 01             	sub    $0x1,%ebx
+f0108652:	53                   	push   %ebx
+f0108653:	50                   	push   %eax
+f0108654:	83 ec 08             	sub    $0x8,%esp
+f0108657:	ff 75 e4             	push   -0x1c(%ebp)
+f010865a:	ff 75 e0             	push   -0x20(%ebp)
+f010865d:	ff 75 dc             	push   -0x24(%ebp)
+f0108660:	ff 75 d8             	push   -0x28(%ebp)
+f0108663:	e8 ca 13 00 00       	call   f0109a32 <__udivdi3>
+f0108668:	83 c4 18             	add    $0x18,%esp
+f010866b:	52                   	push   %edx
+f010866c:	50                   	push   %eax
+f010866d:	89 f2                	mov    %esi,%edx
+f010866f:	89 f8                	mov    %edi,%eax
+f0108671:	e8 9f ff ff ff       	call   f0108615 <printnum>
+f0108676:	83 c4 20             	add    $0x20,%esp
+f0108679:	eb 13                	jmp    f010868e <printnum+0x79>
+f010867b:	83 ec 08             	sub    $0x8,%esp
+f010867e:	56                   	push   %esi
+f010867f:	ff 75 18             	push   0x18(%ebp)
+f0108682:	ff d7                	call   *%edi
+f0108684:	83 c4 10             	add    $0x10,%esp
+f0108687:	83 eb 01             	sub    $0x1,%ebx
+f010868a:	85 db                	test   %ebx,%ebx
+f010868c:	7f ed                	jg     f010867b <printnum+0x66>
+f010868e:	83 ec 08             	sub    $0x8,%esp
+f0108691:	56                   	push   %esi
+f0108692:	83 ec 04             	sub    $0x4,%esp
+f0108695:	ff 75 e4             	push   -0x1c(%ebp)
+f0108698:	ff 75 e0             	push   -0x20(%ebp)
+f010869b:	ff 75 dc             	push   -0x24(%ebp)
+f010869e:	ff 75 d8             	push   -0x28(%ebp)
+f01086a1:	e8 64 14 00 00       	call   f0109b0a <__umoddi3>
+f01086a6:	83 c4 14             	add    $0x14,%esp
+f01086a9:	0f be 80 40 bf 10 f0 	movsbl -0xfef40c0(%eax),%eax
+f01086b0:	50                   	push   %eax
+f01086b1:	ff d7                	call   *%edi
+f01086b3:	83 c4 10             	add    $0x10,%esp
+f01086b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01086b9:	5b                   	pop    %ebx
+f01086ba:	5e                   	pop    %esi
+f01086bb:	5f                   	pop    %edi
+f01086bc:	5d                   	pop    %ebp
+f01086bd:	c3                   	ret
+
+f01086be <sprintputch>:
+f01086be:	55                   	push   %ebp
+f01086bf:	89 e5                	mov    %esp,%ebp
+f01086c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01086c4:	83 40 08 01          	addl   $0x1,0x8(%eax)
+f01086c8:	8b 10                	mov    (%eax),%edx
+f01086ca:	3b 50 04             	cmp    0x4(%eax),%edx
+f01086cd:	73 0a                	jae    f01086d9 <sprintputch+0x1b>
+f01086cf:	8d 4a 01             	lea    0x1(%edx),%ecx
+f01086d2:	89 08                	mov    %ecx,(%eax)
+f01086d4:	8b 45 08             	mov    0x8(%ebp),%eax
+f01086d7:	88 02                	mov    %al,(%edx)
+f01086d9:	5d                   	pop    %ebp
+f01086da:	c3                   	ret
+
+f01086db <printfmt>:
+f01086db:	55                   	push   %ebp
+f01086dc:	89 e5                	mov    %esp,%ebp
+f01086de:	83 ec 08             	sub    $0x8,%esp
+f01086e1:	8d 45 14             	lea    0x14(%ebp),%eax
+f01086e4:	50                   	push   %eax
+f01086e5:	ff 75 10             	push   0x10(%ebp)
+f01086e8:	ff 75 0c             	push   0xc(%ebp)
+f01086eb:	ff 75 08             	push   0x8(%ebp)
+f01086ee:	e8 05 00 00 00       	call   f01086f8 <vprintfmt>
+f01086f3:	83 c4 10             	add    $0x10,%esp
+f01086f6:	c9                   	leave
+f01086f7:	c3                   	ret
+
+f01086f8 <vprintfmt>:
+f01086f8:	55                   	push   %ebp
+f01086f9:	89 e5                	mov    %esp,%ebp
+f01086fb:	57                   	push   %edi
+f01086fc:	56                   	push   %esi
+f01086fd:	53                   	push   %ebx
+f01086fe:	83 ec 2c             	sub    $0x2c,%esp
+f0108701:	8b 75 08             	mov    0x8(%ebp),%esi
+f0108704:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0108707:	8b 7d 10             	mov    0x10(%ebp),%edi
+f010870a:	eb 0a                	jmp    f0108716 <vprintfmt+0x1e>
+f010870c:	83 ec 08             	sub    $0x8,%esp
+f010870f:	53                   	push   %ebx
+f0108710:	50                   	push   %eax
+f0108711:	ff d6                	call   *%esi
+f0108713:	83 c4 10             	add    $0x10,%esp
+f0108716:	83 c7 01             	add    $0x1,%edi
+f0108719:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+f010871d:	83 f8 25             	cmp    $0x25,%eax
+f0108720:	74 0c                	je     f010872e <vprintfmt+0x36>
+f0108722:	85 c0                	test   %eax,%eax
+f0108724:	75 e6                	jne    f010870c <vprintfmt+0x14>
+f0108726:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108729:	5b                   	pop    %ebx
+f010872a:	5e                   	pop    %esi
+f010872b:	5f                   	pop    %edi
+f010872c:	5d                   	pop    %ebp
+f010872d:	c3                   	ret
+f010872e:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+f0108732:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+f0108739:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+f0108740:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+f0108747:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010874c:	8d 47 01             	lea    0x1(%edi),%eax
+f010874f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0108752:	0f b6 17             	movzbl (%edi),%edx
+f0108755:	8d 42 dd             	lea    -0x23(%edx),%eax
+f0108758:	3c 55                	cmp    $0x55,%al
+f010875a:	0f 87 cf 03 00 00    	ja     f0108b2f <vprintfmt+0x437>
+f0108760:	0f b6 c0             	movzbl %al,%eax
+f0108763:	ff 24 85 00 c0 10 f0 	jmp    *-0xfef4000(,%eax,4)
+f010876a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f010876d:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+f0108771:	eb d9                	jmp    f010874c <vprintfmt+0x54>
+f0108773:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0108776:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+f010877a:	eb d0                	jmp    f010874c <vprintfmt+0x54>
+f010877c:	0f b6 d2             	movzbl %dl,%edx
+f010877f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0108782:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108787:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f010878a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f010878d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+f0108791:	0f be 17             	movsbl (%edi),%edx
+f0108794:	8d 4a d0             	lea    -0x30(%edx),%ecx
+f0108797:	83 f9 09             	cmp    $0x9,%ecx
+f010879a:	77 55                	ja     f01087f1 <vprintfmt+0xf9>
+f010879c:	83 c7 01             	add    $0x1,%edi
+f010879f:	eb e9                	jmp    f010878a <vprintfmt+0x92>
+f01087a1:	8b 45 14             	mov    0x14(%ebp),%eax
+f01087a4:	8b 00                	mov    (%eax),%eax
+f01087a6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01087a9:	8b 45 14             	mov    0x14(%ebp),%eax
+f01087ac:	8d 40 04             	lea    0x4(%eax),%eax
+f01087af:	89 45 14             	mov    %eax,0x14(%ebp)
+f01087b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01087b5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f01087b9:	79 91                	jns    f010874c <vprintfmt+0x54>
+f01087bb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01087be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01087c1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+f01087c8:	eb 82                	jmp    f010874c <vprintfmt+0x54>
+f01087ca:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f01087cd:	85 d2                	test   %edx,%edx
+f01087cf:	b8 00 00 00 00       	mov    $0x0,%eax
+f01087d4:	0f 49 c2             	cmovns %edx,%eax
+f01087d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01087da:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01087dd:	e9 6a ff ff ff       	jmp    f010874c <vprintfmt+0x54>
+f01087e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01087e5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+f01087ec:	e9 5b ff ff ff       	jmp    f010874c <vprintfmt+0x54>
+f01087f1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01087f4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01087f7:	eb bc                	jmp    f01087b5 <vprintfmt+0xbd>
+f01087f9:	83 c1 01             	add    $0x1,%ecx
+f01087fc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01087ff:	e9 48 ff ff ff       	jmp    f010874c <vprintfmt+0x54>
+f0108804:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108807:	8d 78 04             	lea    0x4(%eax),%edi
+f010880a:	83 ec 08             	sub    $0x8,%esp
+f010880d:	53                   	push   %ebx
+f010880e:	ff 30                	push   (%eax)
+f0108810:	ff d6                	call   *%esi
+f0108812:	83 c4 10             	add    $0x10,%esp
+f0108815:	89 7d 14             	mov    %edi,0x14(%ebp)
+f0108818:	e9 b1 02 00 00       	jmp    f0108ace <vprintfmt+0x3d6>
+f010881d:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108820:	8d 78 04             	lea    0x4(%eax),%edi
+f0108823:	8b 10                	mov    (%eax),%edx
+f0108825:	89 d0                	mov    %edx,%eax
+f0108827:	f7 d8                	neg    %eax
+f0108829:	0f 48 c2             	cmovs  %edx,%eax
+f010882c:	83 f8 08             	cmp    $0x8,%eax
+f010882f:	7f 23                	jg     f0108854 <vprintfmt+0x15c>
+f0108831:	8b 14 85 60 c1 10 f0 	mov    -0xfef3ea0(,%eax,4),%edx
+f0108838:	85 d2                	test   %edx,%edx
+f010883a:	74 18                	je     f0108854 <vprintfmt+0x15c>
+f010883c:	52                   	push   %edx
+f010883d:	68 7e b1 10 f0       	push   $0xf010b17e
+f0108842:	53                   	push   %ebx
+f0108843:	56                   	push   %esi
+f0108844:	e8 92 fe ff ff       	call   f01086db <printfmt>
+f0108849:	83 c4 10             	add    $0x10,%esp
+f010884c:	89 7d 14             	mov    %edi,0x14(%ebp)
+f010884f:	e9 7a 02 00 00       	jmp    f0108ace <vprintfmt+0x3d6>
+f0108854:	50                   	push   %eax
+f0108855:	68 58 bf 10 f0       	push   $0xf010bf58
+f010885a:	53                   	push   %ebx
+f010885b:	56                   	push   %esi
+f010885c:	e8 7a fe ff ff       	call   f01086db <printfmt>
+f0108861:	83 c4 10             	add    $0x10,%esp
+f0108864:	89 7d 14             	mov    %edi,0x14(%ebp)
+f0108867:	e9 62 02 00 00       	jmp    f0108ace <vprintfmt+0x3d6>
+f010886c:	8b 45 14             	mov    0x14(%ebp),%eax
+f010886f:	83 c0 04             	add    $0x4,%eax
+f0108872:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0108875:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108878:	8b 08                	mov    (%eax),%ecx
+f010887a:	85 c9                	test   %ecx,%ecx
+f010887c:	b8 51 bf 10 f0       	mov    $0xf010bf51,%eax
+f0108881:	0f 45 c1             	cmovne %ecx,%eax
+f0108884:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f0108887:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f010888b:	7e 06                	jle    f0108893 <vprintfmt+0x19b>
+f010888d:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+f0108891:	75 0b                	jne    f010889e <vprintfmt+0x1a6>
+f0108893:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0108896:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0108899:	89 75 08             	mov    %esi,0x8(%ebp)
+f010889c:	eb 5c                	jmp    f01088fa <vprintfmt+0x202>
+f010889e:	83 ec 08             	sub    $0x8,%esp
+f01088a1:	ff 75 d0             	push   -0x30(%ebp)
+f01088a4:	ff 75 cc             	push   -0x34(%ebp)
+f01088a7:	e8 69 04 00 00       	call   f0108d15 <strnlen>
+f01088ac:	89 c2                	mov    %eax,%edx
+f01088ae:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01088b1:	29 d0                	sub    %edx,%eax
+f01088b3:	83 c4 10             	add    $0x10,%esp
+f01088b6:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+f01088ba:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01088bd:	89 75 08             	mov    %esi,0x8(%ebp)
+f01088c0:	89 c6                	mov    %eax,%esi
+f01088c2:	eb 0e                	jmp    f01088d2 <vprintfmt+0x1da>
+f01088c4:	83 ec 08             	sub    $0x8,%esp
+f01088c7:	53                   	push   %ebx
+f01088c8:	57                   	push   %edi
+f01088c9:	ff 55 08             	call   *0x8(%ebp)
+f01088cc:	83 ee 01             	sub    $0x1,%esi
+f01088cf:	83 c4 10             	add    $0x10,%esp
+f01088d2:	85 f6                	test   %esi,%esi
+f01088d4:	7f ee                	jg     f01088c4 <vprintfmt+0x1cc>
+f01088d6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01088d9:	8b 75 08             	mov    0x8(%ebp),%esi
+f01088dc:	85 c0                	test   %eax,%eax
+f01088de:	ba 00 00 00 00       	mov    $0x0,%edx
+f01088e3:	0f 49 d0             	cmovns %eax,%edx
+f01088e6:	29 d0                	sub    %edx,%eax
+f01088e8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01088eb:	eb a6                	jmp    f0108893 <vprintfmt+0x19b>
+f01088ed:	83 ec 08             	sub    $0x8,%esp
+f01088f0:	53                   	push   %ebx
+f01088f1:	52                   	push   %edx
+f01088f2:	ff 55 08             	call   *0x8(%ebp)
+f01088f5:	83 c4 10             	add    $0x10,%esp
+f01088f8:	89 f1                	mov    %esi,%ecx
+f01088fa:	8d 71 01             	lea    0x1(%ecx),%esi
+f01088fd:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+f0108901:	0f be d0             	movsbl %al,%edx
+f0108904:	85 d2                	test   %edx,%edx
+f0108906:	74 28                	je     f0108930 <vprintfmt+0x238>
+f0108908:	85 ff                	test   %edi,%edi
+f010890a:	78 05                	js     f0108911 <vprintfmt+0x219>
+f010890c:	83 ef 01             	sub    $0x1,%edi
+f010890f:	78 30                	js     f0108941 <vprintfmt+0x249>
+f0108911:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+f0108915:	74 d6                	je     f01088ed <vprintfmt+0x1f5>
+f0108917:	0f be c0             	movsbl %al,%eax
+f010891a:	83 e8 20             	sub    $0x20,%eax
+f010891d:	83 f8 5e             	cmp    $0x5e,%eax
+f0108920:	76 cb                	jbe    f01088ed <vprintfmt+0x1f5>
+f0108922:	83 ec 08             	sub    $0x8,%esp
+f0108925:	53                   	push   %ebx
+f0108926:	6a 3f                	push   $0x3f
+f0108928:	ff 55 08             	call   *0x8(%ebp)
+f010892b:	83 c4 10             	add    $0x10,%esp
+f010892e:	eb c8                	jmp    f01088f8 <vprintfmt+0x200>
+f0108930:	8b 75 08             	mov    0x8(%ebp),%esi
+f0108933:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0108936:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0108939:	01 d0                	add    %edx,%eax
+f010893b:	29 c8                	sub    %ecx,%eax
+f010893d:	89 c7                	mov    %eax,%edi
+f010893f:	eb 13                	jmp    f0108954 <vprintfmt+0x25c>
+f0108941:	8b 75 08             	mov    0x8(%ebp),%esi
+f0108944:	eb ed                	jmp    f0108933 <vprintfmt+0x23b>
+f0108946:	83 ec 08             	sub    $0x8,%esp
+f0108949:	53                   	push   %ebx
+f010894a:	6a 20                	push   $0x20
+f010894c:	ff d6                	call   *%esi
+f010894e:	83 ef 01             	sub    $0x1,%edi
+f0108951:	83 c4 10             	add    $0x10,%esp
+f0108954:	85 ff                	test   %edi,%edi
+f0108956:	7f ee                	jg     f0108946 <vprintfmt+0x24e>
+f0108958:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f010895b:	89 45 14             	mov    %eax,0x14(%ebp)
+f010895e:	e9 6b 01 00 00       	jmp    f0108ace <vprintfmt+0x3d6>
+f0108963:	83 f9 01             	cmp    $0x1,%ecx
+f0108966:	7f 1f                	jg     f0108987 <vprintfmt+0x28f>
+f0108968:	85 c9                	test   %ecx,%ecx
+f010896a:	74 67                	je     f01089d3 <vprintfmt+0x2db>
+f010896c:	8b 45 14             	mov    0x14(%ebp),%eax
+f010896f:	8b 00                	mov    (%eax),%eax
+f0108971:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0108974:	89 c1                	mov    %eax,%ecx
+f0108976:	c1 f9 1f             	sar    $0x1f,%ecx
+f0108979:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f010897c:	8b 45 14             	mov    0x14(%ebp),%eax
+f010897f:	8d 40 04             	lea    0x4(%eax),%eax
+f0108982:	89 45 14             	mov    %eax,0x14(%ebp)
+f0108985:	eb 17                	jmp    f010899e <vprintfmt+0x2a6>
+f0108987:	8b 45 14             	mov    0x14(%ebp),%eax
+f010898a:	8b 50 04             	mov    0x4(%eax),%edx
+f010898d:	8b 00                	mov    (%eax),%eax
+f010898f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0108992:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f0108995:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108998:	8d 40 08             	lea    0x8(%eax),%eax
+f010899b:	89 45 14             	mov    %eax,0x14(%ebp)
+f010899e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f01089a1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f01089a4:	bf 0a 00 00 00       	mov    $0xa,%edi
+f01089a9:	85 c9                	test   %ecx,%ecx
+f01089ab:	0f 89 03 01 00 00    	jns    f0108ab4 <vprintfmt+0x3bc>
+f01089b1:	83 ec 08             	sub    $0x8,%esp
+f01089b4:	53                   	push   %ebx
+f01089b5:	6a 2d                	push   $0x2d
+f01089b7:	ff d6                	call   *%esi
+f01089b9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f01089bc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f01089bf:	f7 da                	neg    %edx
+f01089c1:	83 d1 00             	adc    $0x0,%ecx
+f01089c4:	f7 d9                	neg    %ecx
+f01089c6:	83 c4 10             	add    $0x10,%esp
+f01089c9:	bf 0a 00 00 00       	mov    $0xa,%edi
+f01089ce:	e9 e1 00 00 00       	jmp    f0108ab4 <vprintfmt+0x3bc>
+f01089d3:	8b 45 14             	mov    0x14(%ebp),%eax
+f01089d6:	8b 00                	mov    (%eax),%eax
+f01089d8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f01089db:	89 c1                	mov    %eax,%ecx
+f01089dd:	c1 f9 1f             	sar    $0x1f,%ecx
+f01089e0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f01089e3:	8b 45 14             	mov    0x14(%ebp),%eax
+f01089e6:	8d 40 04             	lea    0x4(%eax),%eax
+f01089e9:	89 45 14             	mov    %eax,0x14(%ebp)
+f01089ec:	eb b0                	jmp    f010899e <vprintfmt+0x2a6>
+f01089ee:	83 f9 01             	cmp    $0x1,%ecx
+f01089f1:	7f 1e                	jg     f0108a11 <vprintfmt+0x319>
+f01089f3:	85 c9                	test   %ecx,%ecx
+f01089f5:	74 32                	je     f0108a29 <vprintfmt+0x331>
+f01089f7:	8b 45 14             	mov    0x14(%ebp),%eax
+f01089fa:	8b 10                	mov    (%eax),%edx
+f01089fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108a01:	8d 40 04             	lea    0x4(%eax),%eax
+f0108a04:	89 45 14             	mov    %eax,0x14(%ebp)
+f0108a07:	bf 0a 00 00 00       	mov    $0xa,%edi
+f0108a0c:	e9 a3 00 00 00       	jmp    f0108ab4 <vprintfmt+0x3bc>
+f0108a11:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108a14:	8b 10                	mov    (%eax),%edx
+f0108a16:	8b 48 04             	mov    0x4(%eax),%ecx
+f0108a19:	8d 40 08             	lea    0x8(%eax),%eax
+f0108a1c:	89 45 14             	mov    %eax,0x14(%ebp)
+f0108a1f:	bf 0a 00 00 00       	mov    $0xa,%edi
+f0108a24:	e9 8b 00 00 00       	jmp    f0108ab4 <vprintfmt+0x3bc>
+f0108a29:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108a2c:	8b 10                	mov    (%eax),%edx
+f0108a2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108a33:	8d 40 04             	lea    0x4(%eax),%eax
+f0108a36:	89 45 14             	mov    %eax,0x14(%ebp)
+f0108a39:	bf 0a 00 00 00       	mov    $0xa,%edi
+f0108a3e:	eb 74                	jmp    f0108ab4 <vprintfmt+0x3bc>
+f0108a40:	83 f9 01             	cmp    $0x1,%ecx
+f0108a43:	7f 1b                	jg     f0108a60 <vprintfmt+0x368>
+f0108a45:	85 c9                	test   %ecx,%ecx
+f0108a47:	74 2c                	je     f0108a75 <vprintfmt+0x37d>
+f0108a49:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108a4c:	8b 10                	mov    (%eax),%edx
+f0108a4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108a53:	8d 40 04             	lea    0x4(%eax),%eax
+f0108a56:	89 45 14             	mov    %eax,0x14(%ebp)
+f0108a59:	bf 08 00 00 00       	mov    $0x8,%edi
+f0108a5e:	eb 54                	jmp    f0108ab4 <vprintfmt+0x3bc>
+f0108a60:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108a63:	8b 10                	mov    (%eax),%edx
+f0108a65:	8b 48 04             	mov    0x4(%eax),%ecx
+f0108a68:	8d 40 08             	lea    0x8(%eax),%eax
+f0108a6b:	89 45 14             	mov    %eax,0x14(%ebp)
+f0108a6e:	bf 08 00 00 00       	mov    $0x8,%edi
+f0108a73:	eb 3f                	jmp    f0108ab4 <vprintfmt+0x3bc>
+f0108a75:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108a78:	8b 10                	mov    (%eax),%edx
+f0108a7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108a7f:	8d 40 04             	lea    0x4(%eax),%eax
+f0108a82:	89 45 14             	mov    %eax,0x14(%ebp)
+f0108a85:	bf 08 00 00 00       	mov    $0x8,%edi
+f0108a8a:	eb 28                	jmp    f0108ab4 <vprintfmt+0x3bc>
+f0108a8c:	83 ec 08             	sub    $0x8,%esp
+f0108a8f:	53                   	push   %ebx
+f0108a90:	6a 30                	push   $0x30
+f0108a92:	ff d6                	call   *%esi
+f0108a94:	83 c4 08             	add    $0x8,%esp
+f0108a97:	53                   	push   %ebx
+f0108a98:	6a 78                	push   $0x78
+f0108a9a:	ff d6                	call   *%esi
+f0108a9c:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108a9f:	8b 10                	mov    (%eax),%edx
+f0108aa1:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108aa6:	83 c4 10             	add    $0x10,%esp
+f0108aa9:	8d 40 04             	lea    0x4(%eax),%eax
+f0108aac:	89 45 14             	mov    %eax,0x14(%ebp)
+f0108aaf:	bf 10 00 00 00       	mov    $0x10,%edi
+f0108ab4:	83 ec 0c             	sub    $0xc,%esp
+f0108ab7:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+f0108abb:	50                   	push   %eax
+f0108abc:	ff 75 e0             	push   -0x20(%ebp)
+f0108abf:	57                   	push   %edi
+f0108ac0:	51                   	push   %ecx
+f0108ac1:	52                   	push   %edx
+f0108ac2:	89 da                	mov    %ebx,%edx
+f0108ac4:	89 f0                	mov    %esi,%eax
+f0108ac6:	e8 4a fb ff ff       	call   f0108615 <printnum>
+f0108acb:	83 c4 20             	add    $0x20,%esp
+f0108ace:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0108ad1:	e9 40 fc ff ff       	jmp    f0108716 <vprintfmt+0x1e>
+f0108ad6:	83 f9 01             	cmp    $0x1,%ecx
+f0108ad9:	7f 1b                	jg     f0108af6 <vprintfmt+0x3fe>
+f0108adb:	85 c9                	test   %ecx,%ecx
+f0108add:	74 2c                	je     f0108b0b <vprintfmt+0x413>
+f0108adf:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108ae2:	8b 10                	mov    (%eax),%edx
+f0108ae4:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108ae9:	8d 40 04             	lea    0x4(%eax),%eax
+f0108aec:	89 45 14             	mov    %eax,0x14(%ebp)
+f0108aef:	bf 10 00 00 00       	mov    $0x10,%edi
+f0108af4:	eb be                	jmp    f0108ab4 <vprintfmt+0x3bc>
+f0108af6:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108af9:	8b 10                	mov    (%eax),%edx
+f0108afb:	8b 48 04             	mov    0x4(%eax),%ecx
+f0108afe:	8d 40 08             	lea    0x8(%eax),%eax
+f0108b01:	89 45 14             	mov    %eax,0x14(%ebp)
+f0108b04:	bf 10 00 00 00       	mov    $0x10,%edi
+f0108b09:	eb a9                	jmp    f0108ab4 <vprintfmt+0x3bc>
+f0108b0b:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108b0e:	8b 10                	mov    (%eax),%edx
+f0108b10:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108b15:	8d 40 04             	lea    0x4(%eax),%eax
+f0108b18:	89 45 14             	mov    %eax,0x14(%ebp)
+f0108b1b:	bf 10 00 00 00       	mov    $0x10,%edi
+f0108b20:	eb 92                	jmp    f0108ab4 <vprintfmt+0x3bc>
+f0108b22:	83 ec 08             	sub    $0x8,%esp
+f0108b25:	53                   	push   %ebx
+f0108b26:	6a 25                	push   $0x25
+f0108b28:	ff d6                	call   *%esi
+f0108b2a:	83 c4 10             	add    $0x10,%esp
+f0108b2d:	eb 9f                	jmp    f0108ace <vprintfmt+0x3d6>
+f0108b2f:	83 ec 08             	sub    $0x8,%esp
+f0108b32:	53                   	push   %ebx
+f0108b33:	6a 25                	push   $0x25
+f0108b35:	ff d6                	call   *%esi
+f0108b37:	83 c4 10             	add    $0x10,%esp
+f0108b3a:	89 f8                	mov    %edi,%eax
+f0108b3c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+f0108b40:	74 05                	je     f0108b47 <vprintfmt+0x44f>
+f0108b42:	83 e8 01             	sub    $0x1,%eax
+f0108b45:	eb f5                	jmp    f0108b3c <vprintfmt+0x444>
+f0108b47:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0108b4a:	eb 82                	jmp    f0108ace <vprintfmt+0x3d6>
+
+f0108b4c <vsnprintf>:
+f0108b4c:	55                   	push   %ebp
+f0108b4d:	89 e5                	mov    %esp,%ebp
+f0108b4f:	83 ec 18             	sub    $0x18,%esp
+f0108b52:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108b55:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0108b58:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f0108b5b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+f0108b5f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f0108b62:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+f0108b69:	85 c0                	test   %eax,%eax
+f0108b6b:	74 26                	je     f0108b93 <vsnprintf+0x47>
+f0108b6d:	85 d2                	test   %edx,%edx
+f0108b6f:	7e 22                	jle    f0108b93 <vsnprintf+0x47>
+f0108b71:	ff 75 14             	push   0x14(%ebp)
+f0108b74:	ff 75 10             	push   0x10(%ebp)
+f0108b77:	8d 45 ec             	lea    -0x14(%ebp),%eax
+f0108b7a:	50                   	push   %eax
+f0108b7b:	68 be 86 10 f0       	push   $0xf01086be
+f0108b80:	e8 73 fb ff ff       	call   f01086f8 <vprintfmt>
+f0108b85:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f0108b88:	c6 00 00             	movb   $0x0,(%eax)
+f0108b8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0108b8e:	83 c4 10             	add    $0x10,%esp
+f0108b91:	c9                   	leave
+f0108b92:	c3                   	ret
+f0108b93:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0108b98:	eb f7                	jmp    f0108b91 <vsnprintf+0x45>
+
+f0108b9a <snprintf>:
+f0108b9a:	55                   	push   %ebp
+f0108b9b:	89 e5                	mov    %esp,%ebp
+f0108b9d:	83 ec 08             	sub    $0x8,%esp
+f0108ba0:	8d 45 14             	lea    0x14(%ebp),%eax
+f0108ba3:	50                   	push   %eax
+f0108ba4:	ff 75 10             	push   0x10(%ebp)
+f0108ba7:	ff 75 0c             	push   0xc(%ebp)
+f0108baa:	ff 75 08             	push   0x8(%ebp)
+f0108bad:	e8 9a ff ff ff       	call   f0108b4c <vsnprintf>
+f0108bb2:	c9                   	leave
+f0108bb3:	c3                   	ret
+
+f0108bb4 <readline>:
+f0108bb4:	55                   	push   %ebp
+f0108bb5:	89 e5                	mov    %esp,%ebp
+f0108bb7:	57                   	push   %edi
+f0108bb8:	56                   	push   %esi
+f0108bb9:	53                   	push   %ebx
+f0108bba:	83 ec 0c             	sub    $0xc,%esp
+f0108bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108bc0:	85 c0                	test   %eax,%eax
+f0108bc2:	74 11                	je     f0108bd5 <readline+0x21>
+f0108bc4:	83 ec 08             	sub    $0x8,%esp
+f0108bc7:	50                   	push   %eax
+f0108bc8:	68 7e b1 10 f0       	push   $0xf010b17e
+f0108bcd:	e8 51 c4 ff ff       	call   f0105023 <cprintf>
+f0108bd2:	83 c4 10             	add    $0x10,%esp
+f0108bd5:	83 ec 0c             	sub    $0xc,%esp
+f0108bd8:	6a 00                	push   $0x0
+f0108bda:	e8 cb 7f ff ff       	call   f0100baa <iscons>
+f0108bdf:	89 c7                	mov    %eax,%edi
+f0108be1:	83 c4 10             	add    $0x10,%esp
+f0108be4:	be 00 00 00 00       	mov    $0x0,%esi
+f0108be9:	eb 3f                	jmp    f0108c2a <readline+0x76>
+f0108beb:	83 ec 08             	sub    $0x8,%esp
+f0108bee:	50                   	push   %eax
+f0108bef:	68 84 c1 10 f0       	push   $0xf010c184
+f0108bf4:	e8 2a c4 ff ff       	call   f0105023 <cprintf>
+f0108bf9:	83 c4 10             	add    $0x10,%esp
+f0108bfc:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108c01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108c04:	5b                   	pop    %ebx
+f0108c05:	5e                   	pop    %esi
+f0108c06:	5f                   	pop    %edi
+f0108c07:	5d                   	pop    %ebp
+f0108c08:	c3                   	ret
+f0108c09:	85 ff                	test   %edi,%edi
+f0108c0b:	75 05                	jne    f0108c12 <readline+0x5e>
+f0108c0d:	83 ee 01             	sub    $0x1,%esi
+f0108c10:	eb 18                	jmp    f0108c2a <readline+0x76>
+f0108c12:	83 ec 0c             	sub    $0xc,%esp
+f0108c15:	6a 08                	push   $0x8
+f0108c17:	e8 6d 7f ff ff       	call   f0100b89 <cputchar>
+f0108c1c:	83 c4 10             	add    $0x10,%esp
+f0108c1f:	eb ec                	jmp    f0108c0d <readline+0x59>
+f0108c21:	88 9e e0 6a 21 f0    	mov    %bl,-0xfde9520(%esi)
+f0108c27:	8d 76 01             	lea    0x1(%esi),%esi
+f0108c2a:	e8 6a 7f ff ff       	call   f0100b99 <getchar>
+f0108c2f:	89 c3                	mov    %eax,%ebx
+f0108c31:	85 c0                	test   %eax,%eax
+f0108c33:	78 b6                	js     f0108beb <readline+0x37>
+f0108c35:	83 f8 08             	cmp    $0x8,%eax
+f0108c38:	0f 94 c0             	sete   %al
+f0108c3b:	83 fb 7f             	cmp    $0x7f,%ebx
+f0108c3e:	0f 94 c2             	sete   %dl
+f0108c41:	08 d0                	or     %dl,%al
+f0108c43:	74 04                	je     f0108c49 <readline+0x95>
+f0108c45:	85 f6                	test   %esi,%esi
+f0108c47:	7f c0                	jg     f0108c09 <readline+0x55>
+f0108c49:	83 fb 1f             	cmp    $0x1f,%ebx
+f0108c4c:	7e 1a                	jle    f0108c68 <readline+0xb4>
+f0108c4e:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+f0108c54:	7f 12                	jg     f0108c68 <readline+0xb4>
+f0108c56:	85 ff                	test   %edi,%edi
+f0108c58:	74 c7                	je     f0108c21 <readline+0x6d>
+f0108c5a:	83 ec 0c             	sub    $0xc,%esp
+f0108c5d:	53                   	push   %ebx
+f0108c5e:	e8 26 7f ff ff       	call   f0100b89 <cputchar>
+f0108c63:	83 c4 10             	add    $0x10,%esp
+f0108c66:	eb b9                	jmp    f0108c21 <readline+0x6d>
+f0108c68:	83 fb 0a             	cmp    $0xa,%ebx
+f0108c6b:	74 05                	je     f0108c72 <readline+0xbe>
+f0108c6d:	83 fb 0d             	cmp    $0xd,%ebx
+f0108c70:	75 b8                	jne    f0108c2a <readline+0x76>
+f0108c72:	85 ff                	test   %edi,%edi
+f0108c74:	75 11                	jne    f0108c87 <readline+0xd3>
+f0108c76:	c6 86 e0 6a 21 f0 00 	movb   $0x0,-0xfde9520(%esi)
+f0108c7d:	b8 e0 6a 21 f0       	mov    $0xf0216ae0,%eax
+f0108c82:	e9 7a ff ff ff       	jmp    f0108c01 <readline+0x4d>
+f0108c87:	83 ec 0c             	sub    $0xc,%esp
+f0108c8a:	6a 0a                	push   $0xa
+f0108c8c:	e8 f8 7e ff ff       	call   f0100b89 <cputchar>
+f0108c91:	83 c4 10             	add    $0x10,%esp
+f0108c94:	eb e0                	jmp    f0108c76 <readline+0xc2>
+
+f0108c96 <copy_fwd>:
+f0108c96:	55                   	push   %ebp
+f0108c97:	89 e5                	mov    %esp,%ebp
+f0108c99:	57                   	push   %edi
+f0108c9a:	56                   	push   %esi
+f0108c9b:	53                   	push   %ebx
+f0108c9c:	89 c7                	mov    %eax,%edi
+f0108c9e:	89 d6                	mov    %edx,%esi
+f0108ca0:	89 c8                	mov    %ecx,%eax
+f0108ca2:	83 f9 0f             	cmp    $0xf,%ecx
+f0108ca5:	76 1c                	jbe    f0108cc3 <copy_fwd+0x2d>
+f0108ca7:	89 f9                	mov    %edi,%ecx
+f0108ca9:	f7 d9                	neg    %ecx
+f0108cab:	89 cb                	mov    %ecx,%ebx
+f0108cad:	83 e3 03             	and    $0x3,%ebx
+f0108cb0:	29 d8                	sub    %ebx,%eax
+f0108cb2:	89 c2                	mov    %eax,%edx
+f0108cb4:	c1 ea 02             	shr    $0x2,%edx
+f0108cb7:	83 e0 03             	and    $0x3,%eax
+f0108cba:	89 d9                	mov    %ebx,%ecx
+f0108cbc:	fc                   	cld
+f0108cbd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+f0108cbf:	89 d1                	mov    %edx,%ecx
+f0108cc1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0108cc3:	89 c1                	mov    %eax,%ecx
+f0108cc5:	fc                   	cld
+f0108cc6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+f0108cc8:	5b                   	pop    %ebx
+f0108cc9:	5e                   	pop    %esi
+f0108cca:	5f                   	pop    %edi
+f0108ccb:	5d                   	pop    %ebp
+f0108ccc:	c3                   	ret
+
+f0108ccd <have_sse2>:
+f0108ccd:	83 3d f8 73 11 f0 00 	cmpl   $0x0,0xf01173f8
+f0108cd4:	78 06                	js     f0108cdc <have_sse2+0xf>
+f0108cd6:	a1 f8 73 11 f0       	mov    0xf01173f8,%eax
+f0108cdb:	c3                   	ret
+f0108cdc:	55                   	push   %ebp
+f0108cdd:	89 e5                	mov    %esp,%ebp
+f0108cdf:	53                   	push   %ebx
+f0108ce0:	b8 01 00 00 00       	mov    $0x1,%eax
+f0108ce5:	0f a2                	cpuid
+f0108ce7:	c1 ea 1a             	shr    $0x1a,%edx
+f0108cea:	83 e2 01             	and    $0x1,%edx
+f0108ced:	89 15 f8 73 11 f0    	mov    %edx,0xf01173f8
+f0108cf3:	a1 f8 73 11 f0       	mov    0xf01173f8,%eax
+f0108cf8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0108cfb:	c9                   	leave
+f0108cfc:	c3                   	ret
+
+f0108cfd <strlen>:
+f0108cfd:	55                   	push   %ebp
+f0108cfe:	89 e5                	mov    %esp,%ebp
+f0108d00:	8b 55 08             	mov    0x8(%ebp),%edx
+f0108d03:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108d08:	eb 03                	jmp    f0108d0d <strlen+0x10>
+f0108d0a:	83 c0 01             	add    $0x1,%eax
+f0108d0d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+f0108d11:	75 f7                	jne    f0108d0a <strlen+0xd>
+f0108d13:	5d                   	pop    %ebp
+f0108d14:	c3                   	ret
+
+f0108d15 <strnlen>:
+f0108d15:	55                   	push   %ebp
+f0108d16:	89 e5                	mov    %esp,%ebp
+f0108d18:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0108d1b:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0108d1e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108d23:	eb 03                	jmp    f0108d28 <strnlen+0x13>
+f0108d25:	83 c0 01             	add    $0x1,%eax
+f0108d28:	39 d0                	cmp    %edx,%eax
+f0108d2a:	74 08                	je     f0108d34 <strnlen+0x1f>
+f0108d2c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+f0108d30:	75 f3                	jne    f0108d25 <strnlen+0x10>
+f0108d32:	89 c2                	mov    %eax,%edx
+f0108d34:	89 d0                	mov    %edx,%eax
+f0108d36:	5d                   	pop    %ebp
+f0108d37:	c3                   	ret
+
+f0108d38 <strcpy>:
+f0108d38:	55                   	push   %ebp
+f0108d39:	89 e5                	mov    %esp,%ebp
+f0108d3b:	53                   	push   %ebx
+f0108d3c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0108d3f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0108d42:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108d47:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+f0108d4b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+f0108d4e:	83 c0 01             	add    $0x1,%eax
+f0108d51:	84 d2                	test   %dl,%dl
+f0108d53:	75 f2                	jne    f0108d47 <strcpy+0xf>
+f0108d55:	89 c8                	mov    %ecx,%eax
+f0108d57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0108d5a:	c9                   	leave
+f0108d5b:	c3                   	ret
+
+f0108d5c <strcat>:
+f0108d5c:	55                   	push   %ebp
+f0108d5d:	89 e5                	mov    %esp,%ebp
+f0108d5f:	53                   	push   %ebx
+f0108d60:	83 ec 10             	sub    $0x10,%esp
+f0108d63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0108d66:	53                   	push   %ebx
+f0108d67:	e8 91 ff ff ff       	call   f0108cfd <strlen>
+f0108d6c:	83 c4 08             	add    $0x8,%esp
+f0108d6f:	ff 75 0c             	push   0xc(%ebp)
+f0108d72:	01 d8                	add    %ebx,%eax
+f0108d74:	50                   	push   %eax
+f0108d75:	e8 be ff ff ff       	call   f0108d38 <strcpy>
+f0108d7a:	89 d8                	mov    %ebx,%eax
+f0108d7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0108d7f:	c9                   	leave
+f0108d80:	c3                   	ret
+
+f0108d81 <strncpy>:
+f0108d81:	55                   	push   %ebp
+f0108d82:	89 e5                	mov    %esp,%ebp
+f0108d84:	56                   	push   %esi
+f0108d85:	53                   	push   %ebx
+f0108d86:	8b 75 08             	mov    0x8(%ebp),%esi
+f0108d89:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0108d8c:	89 f3                	mov    %esi,%ebx
+f0108d8e:	03 5d 10             	add    0x10(%ebp),%ebx
+f0108d91:	89 f0                	mov    %esi,%eax
+f0108d93:	eb 0f                	jmp    f0108da4 <strncpy+0x23>
+f0108d95:	83 c0 01             	add    $0x1,%eax
+f0108d98:	0f b6 0a             	movzbl (%edx),%ecx
+f0108d9b:	88 48 ff             	mov    %cl,-0x1(%eax)
+f0108d9e:	80 f9 01             	cmp    $0x1,%cl
+f0108da1:	83 da ff             	sbb    $0xffffffff,%edx
+f0108da4:	39 d8                	cmp    %ebx,%eax
+f0108da6:	75 ed                	jne    f0108d95 <strncpy+0x14>
+f0108da8:	89 f0                	mov    %esi,%eax
+f0108daa:	5b                   	pop    %ebx
+f0108dab:	5e                   	pop    %esi
+f0108dac:	5d                   	pop    %ebp
+f0108dad:	c3                   	ret
+
+f0108dae <strlcpy>:
+f0108dae:	55                   	push   %ebp
+f0108daf:	89 e5                	mov    %esp,%ebp
+f0108db1:	56                   	push   %esi
+f0108db2:	53                   	push   %ebx
+f0108db3:	8b 75 08             	mov    0x8(%ebp),%esi
+f0108db6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0108db9:	8b 55 10             	mov    0x10(%ebp),%edx
+f0108dbc:	89 f0                	mov    %esi,%eax
+f0108dbe:	85 d2                	test   %edx,%edx
+f0108dc0:	74 21                	je     f0108de3 <strlcpy+0x35>
+f0108dc2:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+f0108dc6:	89 f2                	mov    %esi,%edx
+f0108dc8:	eb 09                	jmp    f0108dd3 <strlcpy+0x25>
+f0108dca:	83 c1 01             	add    $0x1,%ecx
+f0108dcd:	83 c2 01             	add    $0x1,%edx
+f0108dd0:	88 5a ff             	mov    %bl,-0x1(%edx)
+f0108dd3:	39 c2                	cmp    %eax,%edx
+f0108dd5:	74 09                	je     f0108de0 <strlcpy+0x32>
+f0108dd7:	0f b6 19             	movzbl (%ecx),%ebx
+f0108dda:	84 db                	test   %bl,%bl
+f0108ddc:	75 ec                	jne    f0108dca <strlcpy+0x1c>
+f0108dde:	89 d0                	mov    %edx,%eax
+f0108de0:	c6 00 00             	movb   $0x0,(%eax)
+f0108de3:	29 f0                	sub    %esi,%eax
+f0108de5:	5b                   	pop    %ebx
+f0108de6:	5e                   	pop    %esi
+f0108de7:	5d                   	pop    %ebp
+f0108de8:	c3                   	ret
+
+f0108de9 <strcmp>:
+f0108de9:	55                   	push   %ebp
+f0108dea:	89 e5                	mov    %esp,%ebp
+f0108dec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0108def:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0108df2:	eb 06                	jmp    f0108dfa <strcmp+0x11>
+f0108df4:	83 c1 01             	add    $0x1,%ecx
+f0108df7:	83 c2 01             	add    $0x1,%edx
+f0108dfa:	0f b6 01             	movzbl (%ecx),%eax
+f0108dfd:	84 c0                	test   %al,%al
+f0108dff:	74 04                	je     f0108e05 <strcmp+0x1c>
+f0108e01:	3a 02                	cmp    (%edx),%al
+f0108e03:	74 ef                	je     f0108df4 <strcmp+0xb>
+f0108e05:	0f b6 c0             	movzbl %al,%eax
+f0108e08:	0f b6 12             	movzbl (%edx),%edx
+f0108e0b:	29 d0                	sub    %edx,%eax
+f0108e0d:	5d                   	pop    %ebp
+f0108e0e:	c3                   	ret
+
+f0108e0f <strncmp>:
+f0108e0f:	55                   	push   %ebp
+f0108e10:	89 e5                	mov    %esp,%ebp
+f0108e12:	53                   	push   %ebx
+f0108e13:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108e16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0108e19:	8b 55 10             	mov    0x10(%ebp),%edx
+f0108e1c:	eb 09                	jmp    f0108e27 <strncmp+0x18>
+f0108e1e:	83 ea 01             	sub    $0x1,%edx
+f0108e21:	83 c0 01             	add    $0x1,%eax
+f0108e24:	83 c1 01             	add    $0x1,%ecx
+f0108e27:	85 d2                	test   %edx,%edx
+f0108e29:	74 18                	je     f0108e43 <strncmp+0x34>
+f0108e2b:	0f b6 18             	movzbl (%eax),%ebx
+f0108e2e:	84 db                	test   %bl,%bl
+f0108e30:	74 04                	je     f0108e36 <strncmp+0x27>
+f0108e32:	3a 19                	cmp    (%ecx),%bl
+f0108e34:	74 e8                	je     f0108e1e <strncmp+0xf>
+f0108e36:	0f b6 00             	movzbl (%eax),%eax
+f0108e39:	0f b6 11             	movzbl (%ecx),%edx
+f0108e3c:	29 d0                	sub    %edx,%eax
+f0108e3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0108e41:	c9                   	leave
+f0108e42:	c3                   	ret
+f0108e43:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108e48:	eb f4                	jmp    f0108e3e <strncmp+0x2f>
+
+f0108e4a <strchr>:
+f0108e4a:	55                   	push   %ebp
+f0108e4b:	89 e5                	mov    %esp,%ebp
+f0108e4d:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108e50:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+f0108e54:	eb 03                	jmp    f0108e59 <strchr+0xf>
+f0108e56:	83 c0 01             	add    $0x1,%eax
+f0108e59:	0f b6 10             	movzbl (%eax),%edx
+f0108e5c:	84 d2                	test   %dl,%dl
+f0108e5e:	74 06                	je     f0108e66 <strchr+0x1c>
+f0108e60:	38 ca                	cmp    %cl,%dl
+f0108e62:	75 f2                	jne    f0108e56 <strchr+0xc>
+f0108e64:	eb 05                	jmp    f0108e6b <strchr+0x21>
+f0108e66:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108e6b:	5d                   	pop    %ebp
+f0108e6c:	c3                   	ret
+
+f0108e6d <strfind>:
+f0108e6d:	55                   	push   %ebp
+f0108e6e:	89 e5                	mov    %esp,%ebp
+f0108e70:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108e73:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+f0108e77:	0f b6 10             	movzbl (%eax),%edx
+f0108e7a:	38 ca                	cmp    %cl,%dl
+f0108e7c:	74 09                	je     f0108e87 <strfind+0x1a>
+f0108e7e:	84 d2                	test   %dl,%dl
+f0108e80:	74 05                	je     f0108e87 <strfind+0x1a>
+f0108e82:	83 c0 01             	add    $0x1,%eax
+f0108e85:	eb f0                	jmp    f0108e77 <strfind+0xa>
+f0108e87:	5d                   	pop    %ebp
+f0108e88:	c3                   	ret
+
+f0108e89 <memset>:
+f0108e89:	55                   	push   %ebp
+f0108e8a:	89 e5                	mov    %esp,%ebp
+f0108e8c:	57                   	push   %edi
+f0108e8d:	56                   	push   %esi
+f0108e8e:	53                   	push   %ebx
+f0108e8f:	83 ec 04             	sub    $0x4,%esp
+f0108e92:	8b 75 08             	mov    0x8(%ebp),%esi
+f0108e95:	8b 55 10             	mov    0x10(%ebp),%edx
+f0108e98:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+f0108e9c:	89 f7                	mov    %esi,%edi
+f0108e9e:	83 fa 0f             	cmp    $0xf,%edx
+f0108ea1:	76 24                	jbe    f0108ec7 <memset+0x3e>
+f0108ea3:	89 f1                	mov    %esi,%ecx
+f0108ea5:	f7 d9                	neg    %ecx
+f0108ea7:	83 e1 03             	and    $0x3,%ecx
+f0108eaa:	29 ca                	sub    %ecx,%edx
+f0108eac:	89 d0                	mov    %edx,%eax
+f0108eae:	c1 e8 02             	shr    $0x2,%eax
+f0108eb1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f0108eb4:	83 e2 03             	and    $0x3,%edx
+f0108eb7:	89 d8                	mov    %ebx,%eax
+f0108eb9:	fc                   	cld
+f0108eba:	f3 aa                	rep stos %al,%es:(%edi)
+f0108ebc:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+f0108ec2:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+f0108ec5:	f3 ab                	rep stos %eax,%es:(%edi)
+f0108ec7:	89 d1                	mov    %edx,%ecx
+f0108ec9:	89 d8                	mov    %ebx,%eax
+f0108ecb:	fc                   	cld
+f0108ecc:	f3 aa                	rep stos %al,%es:(%edi)
+f0108ece:	89 f0                	mov    %esi,%eax
+f0108ed0:	83 c4 04             	add    $0x4,%esp
+f0108ed3:	5b                   	pop    %ebx
+f0108ed4:	5e                   	pop    %esi
+f0108ed5:	5f                   	pop    %edi
+f0108ed6:	5d                   	pop    %ebp
+f0108ed7:	c3                   	ret
+
+f0108ed8 <memmove>:
+f0108ed8:	55                   	push   %ebp
+f0108ed9:	89 e5                	mov    %esp,%ebp
+f0108edb:	57                   	push   %edi
+f0108edc:	56                   	push   %esi
+f0108edd:	53                   	push   %ebx
+f0108ede:	83 ec 0c             	sub    $0xc,%esp
+f0108ee1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0108ee4:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0108ee7:	8b 45 10             	mov    0x10(%ebp),%eax
+f0108eea:	85 c0                	test   %eax,%eax
+f0108eec:	74 14                	je     f0108f02 <memmove+0x2a>
+f0108eee:	39 da                	cmp    %ebx,%edx
+f0108ef0:	73 07                	jae    f0108ef9 <memmove+0x21>
+f0108ef2:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+f0108ef5:	39 cb                	cmp    %ecx,%ebx
+f0108ef7:	72 13                	jb     f0108f0c <memmove+0x34>
+f0108ef9:	89 c1                	mov    %eax,%ecx
+f0108efb:	89 d8                	mov    %ebx,%eax
+f0108efd:	e8 94 fd ff ff       	call   f0108c96 <copy_fwd>
+f0108f02:	89 d8                	mov    %ebx,%eax
+f0108f04:	83 c4 0c             	add    $0xc,%esp
+f0108f07:	5b                   	pop    %ebx
+f0108f08:	5e                   	pop    %esi
+f0108f09:	5f                   	pop    %edi
+f0108f0a:	5d                   	pop    %ebp
+f0108f0b:	c3                   	ret
+f0108f0c:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f0108f0f:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+f0108f12:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+f0108f15:	83 f8 0f             	cmp    $0xf,%eax
+f0108f18:	76 23                	jbe    f0108f3d <memmove+0x65>
+f0108f1a:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+f0108f1d:	83 e1 03             	and    $0x3,%ecx
+f0108f20:	29 c8                	sub    %ecx,%eax
+f0108f22:	89 c2                	mov    %eax,%edx
+f0108f24:	c1 ea 02             	shr    $0x2,%edx
+f0108f27:	83 e0 03             	and    $0x3,%eax
+f0108f2a:	fd                   	std
+f0108f2b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+f0108f2d:	83 ef 03             	sub    $0x3,%edi
+f0108f30:	83 ee 03             	sub    $0x3,%esi
+f0108f33:	89 d1                	mov    %edx,%ecx
+f0108f35:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0108f37:	83 c7 03             	add    $0x3,%edi
+f0108f3a:	83 c6 03             	add    $0x3,%esi
+f0108f3d:	89 c1                	mov    %eax,%ecx
+f0108f3f:	fd                   	std
+f0108f40:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+f0108f42:	fc                   	cld
+f0108f43:	eb bd                	jmp    f0108f02 <memmove+0x2a>
+
+f0108f45 <memcpy>:
+f0108f45:	55                   	push   %ebp
+f0108f46:	89 e5                	mov    %esp,%ebp
+f0108f48:	53                   	push   %ebx
+f0108f49:	83 ec 04             	sub    $0x4,%esp
+f0108f4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0108f4f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0108f52:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0108f55:	89 d8                	mov    %ebx,%eax
+f0108f57:	e8 3a fd ff ff       	call   f0108c96 <copy_fwd>
+f0108f5c:	89 d8                	mov    %ebx,%eax
+f0108f5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0108f61:	c9                   	leave
+f0108f62:	c3                   	ret
+
+f0108f63 <page_copy>:
+f0108f63:	55                   	push   %ebp
+f0108f64:	89 e5                	mov    %esp,%ebp
+f0108f66:	57                   	push   %edi
+f0108f67:	56                   	push   %esi
+f0108f68:	53                   	push   %ebx
+f0108f69:	83 ec 0c             	sub    $0xc,%esp
+f0108f6c:	e8 5c fd ff ff       	call   f0108ccd <have_sse2>
+f0108f71:	85 c0                	test   %eax,%eax
+f0108f73:	74 39                	je     f0108fae <page_copy+0x4b>
+f0108f75:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0108f78:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0108f7b:	be 00 01 00 00       	mov    $0x100,%esi
+f0108f80:	8b 03                	mov    (%ebx),%eax
+f0108f82:	8b 53 04             	mov    0x4(%ebx),%edx
+f0108f85:	0f c3 01             	movnti %eax,(%ecx)
+f0108f88:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+f0108f8c:	8b 43 08             	mov    0x8(%ebx),%eax
+f0108f8f:	8b 53 0c             	mov    0xc(%ebx),%edx
+f0108f92:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+f0108f96:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+f0108f9a:	83 c3 10             	add    $0x10,%ebx
+f0108f9d:	83 c1 10             	add    $0x10,%ecx
+f0108fa0:	4e                   	dec    %esi
+f0108fa1:	75 dd                	jne    f0108f80 <page_copy+0x1d>
+f0108fa3:	0f ae f8             	sfence
+f0108fa6:	83 c4 0c             	add    $0xc,%esp
+f0108fa9:	5b                   	pop    %ebx
+f0108faa:	5e                   	pop    %esi
+f0108fab:	5f                   	pop    %edi
+f0108fac:	5d                   	pop    %ebp
+f0108fad:	c3                   	ret
+f0108fae:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0108fb1:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0108fb4:	b9 00 04 00 00       	mov    $0x400,%ecx
+f0108fb9:	fc                   	cld
+f0108fba:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0108fbc:	eb e8                	jmp    f0108fa6 <page_copy+0x43>
+
+f0108fbe <page_zero>:
+f0108fbe:	55                   	push   %ebp
+f0108fbf:	89 e5                	mov    %esp,%ebp
+f0108fc1:	57                   	push   %edi
+f0108fc2:	83 ec 04             	sub    $0x4,%esp
+f0108fc5:	e8 03 fd ff ff       	call   f0108ccd <have_sse2>
+f0108fca:	85 c0                	test   %eax,%eax
+f0108fcc:	74 3a                	je     f0109008 <page_zero+0x4a>
+f0108fce:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108fd1:	ba 80 00 00 00       	mov    $0x80,%edx
+f0108fd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108fdb:	0f c3 08             	movnti %ecx,(%eax)
+f0108fde:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+f0108fe2:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+f0108fe6:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+f0108fea:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+f0108fee:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+f0108ff2:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+f0108ff6:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+f0108ffa:	83 c0 20             	add    $0x20,%eax
+f0108ffd:	4a                   	dec    %edx
+f0108ffe:	75 db                	jne    f0108fdb <page_zero+0x1d>
+f0109000:	0f ae f8             	sfence
+f0109003:	8b 7d fc             	mov    -0x4(%ebp),%edi
+f0109006:	c9                   	leave
+f0109007:	c3                   	ret
+f0109008:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010900b:	b9 00 04 00 00       	mov    $0x400,%ecx
+f0109010:	fc                   	cld
+f0109011:	f3 ab                	rep stos %eax,%es:(%edi)
+f0109013:	eb ee                	jmp    f0109003 <page_zero+0x45>
+
+f0109015 <memcmp>:
+f0109015:	55                   	push   %ebp
+f0109016:	89 e5                	mov    %esp,%ebp
+f0109018:	56                   	push   %esi
+f0109019:	53                   	push   %ebx
+f010901a:	8b 45 08             	mov    0x8(%ebp),%eax
+f010901d:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0109020:	89 c6                	mov    %eax,%esi
+f0109022:	03 75 10             	add    0x10(%ebp),%esi
+f0109025:	eb 06                	jmp    f010902d <memcmp+0x18>
+f0109027:	83 c0 01             	add    $0x1,%eax
+f010902a:	83 c2 01             	add    $0x1,%edx
+f010902d:	39 f0                	cmp    %esi,%eax
+f010902f:	74 14                	je     f0109045 <memcmp+0x30>
+f0109031:	0f b6 08             	movzbl (%eax),%ecx
+f0109034:	0f b6 1a             	movzbl (%edx),%ebx
+f0109037:	38 d9                	cmp    %bl,%cl
+f0109039:	74 ec                	je     f0109027 <memcmp+0x12>
+f010903b:	0f b6 c1             	movzbl %cl,%eax
+f010903e:	0f b6 db             	movzbl %bl,%ebx
+f0109041:	29 d8                	sub    %ebx,%eax
+f0109043:	eb 05                	jmp    f010904a <memcmp+0x35>
+f0109045:	b8 00 00 00 00       	mov    $0x0,%eax
+f010904a:	5b                   	pop    %ebx
+f010904b:	5e                   	pop    %esi
+f010904c:	5d                   	pop    %ebp
+f010904d:	c3                   	ret
+
+f010904e <memfind>:
+f010904e:	55                   	push   %ebp
+f010904f:	89 e5                	mov    %esp,%ebp
+f0109051:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109054:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0109057:	89 c2                	mov    %eax,%edx
+f0109059:	03 55 10             	add    0x10(%ebp),%edx
+f010905c:	eb 03                	jmp    f0109061 <memfind+0x13>
+f010905e:	83 c0 01             	add    $0x1,%eax
+f0109061:	39 d0                	cmp    %edx,%eax
+f0109063:	73 04                	jae    f0109069 <memfind+0x1b>
+f0109065:	38 08                	cmp    %cl,(%eax)
+f0109067:	75 f5                	jne    f010905e <memfind+0x10>
+f0109069:	5d                   	pop    %ebp
+f010906a:	c3                   	ret
+
+f010906b <strtol>:
+f010906b:	55                   	push   %ebp
+f010906c:	89 e5                	mov    %esp,%ebp
+f010906e:	57                   	push   %edi
+f010906f:	56                   	push   %esi
+f0109070:	53                   	push   %ebx
+f0109071:	8b 55 08             	mov    0x8(%ebp),%edx
+f0109074:	8b 5d 10             	mov    0x10(%ebp),%ebx
+f0109077:	eb 03                	jmp    f010907c <strtol+0x11>
+f0109079:	83 c2 01             	add    $0x1,%edx
+f010907c:	0f b6 02             	movzbl (%edx),%eax
+f010907f:	3c 20                	cmp    $0x20,%al
+f0109081:	74 f6                	je     f0109079 <strtol+0xe>
+f0109083:	3c 09                	cmp    $0x9,%al
+f0109085:	74 f2                	je     f0109079 <strtol+0xe>
+f0109087:	3c 2b                	cmp    $0x2b,%al
+f0109089:	74 2a                	je     f01090b5 <strtol+0x4a>
+f010908b:	bf 00 00 00 00       	mov    $0x0,%edi
+f0109090:	3c 2d                	cmp    $0x2d,%al
+f0109092:	74 2b                	je     f01090bf <strtol+0x54>
+f0109094:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+f010909a:	75 0f                	jne    f01090ab <strtol+0x40>
+f010909c:	80 3a 30             	cmpb   $0x30,(%edx)
+f010909f:	74 28                	je     f01090c9 <strtol+0x5e>
+f01090a1:	85 db                	test   %ebx,%ebx
+f01090a3:	b8 0a 00 00 00       	mov    $0xa,%eax
+f01090a8:	0f 44 d8             	cmove  %eax,%ebx
+f01090ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01090b0:	89 5d 10             	mov    %ebx,0x10(%ebp)
+f01090b3:	eb 46                	jmp    f01090fb <strtol+0x90>
+f01090b5:	83 c2 01             	add    $0x1,%edx
+f01090b8:	bf 00 00 00 00       	mov    $0x0,%edi
+f01090bd:	eb d5                	jmp    f0109094 <strtol+0x29>
+f01090bf:	83 c2 01             	add    $0x1,%edx
+f01090c2:	bf 01 00 00 00       	mov    $0x1,%edi
+f01090c7:	eb cb                	jmp    f0109094 <strtol+0x29>
+f01090c9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+f01090cd:	74 0e                	je     f01090dd <strtol+0x72>
+f01090cf:	85 db                	test   %ebx,%ebx
+f01090d1:	75 d8                	jne    f01090ab <strtol+0x40>
+f01090d3:	83 c2 01             	add    $0x1,%edx
+f01090d6:	bb 08 00 00 00       	mov    $0x8,%ebx
+f01090db:	eb ce                	jmp    f01090ab <strtol+0x40>
+f01090dd:	83 c2 02             	add    $0x2,%edx
+f01090e0:	bb 10 00 00 00       	mov    $0x10,%ebx
+f01090e5:	eb c4                	jmp    f01090ab <strtol+0x40>
+f01090e7:	0f be c0             	movsbl %al,%eax
+f01090ea:	83 e8 30             	sub    $0x30,%eax
+f01090ed:	3b 45 10             	cmp    0x10(%ebp),%eax
+f01090f0:	7d 3a                	jge    f010912c <strtol+0xc1>
+f01090f2:	83 c2 01             	add    $0x1,%edx
+f01090f5:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+f01090f9:	01 c1                	add    %eax,%ecx
+f01090fb:	0f b6 02             	movzbl (%edx),%eax
+f01090fe:	8d 70 d0             	lea    -0x30(%eax),%esi
+f0109101:	89 f3                	mov    %esi,%ebx
+f0109103:	80 fb 09             	cmp    $0x9,%bl
+f0109106:	76 df                	jbe    f01090e7 <strtol+0x7c>
+f0109108:	8d 70 9f             	lea    -0x61(%eax),%esi
+f010910b:	89 f3                	mov    %esi,%ebx
+f010910d:	80 fb 19             	cmp    $0x19,%bl
+f0109110:	77 08                	ja     f010911a <strtol+0xaf>
+f0109112:	0f be c0             	movsbl %al,%eax
+f0109115:	83 e8 57             	sub    $0x57,%eax
+f0109118:	eb d3                	jmp    f01090ed <strtol+0x82>
+f010911a:	8d 70 bf             	lea    -0x41(%eax),%esi
+f010911d:	89 f3                	mov    %esi,%ebx
+f010911f:	80 fb 19             	cmp    $0x19,%bl
+f0109122:	77 08                	ja     f010912c <strtol+0xc1>
+f0109124:	0f be c0             	movsbl %al,%eax
+f0109127:	83 e8 37             	sub    $0x37,%eax
+f010912a:	eb c1                	jmp    f01090ed <strtol+0x82>
+f010912c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f0109130:	74 05                	je     f0109137 <strtol+0xcc>
+f0109132:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0109135:	89 10                	mov    %edx,(%eax)
+f0109137:	89 c8                	mov    %ecx,%eax
+f0109139:	f7 d8                	neg    %eax
+f010913b:	85 ff                	test   %edi,%edi
+f010913d:	0f 45 c8             	cmovne %eax,%ecx
+f0109140:	89 c8                	mov    %ecx,%eax
+f0109142:	5b                   	pop    %ebx
+f0109143:	5e                   	pop    %esi
+f0109144:	5f                   	pop    %edi
+f0109145:	5d                   	pop    %ebp
+f0109146:	c3                   	ret
+f0109147:	90                   	nop
+
+f0109148 <mpentry_start>:
+f0109148:	fa                   	cli
+f0109149:	31 c0                	xor    %eax,%eax
+f010914b:	8e d8                	mov    %eax,%ds
+f010914d:	8e c0                	mov    %eax,%es
+f010914f:	8e d0                	mov    %eax,%ss
+f0109151:	0f 01 16             	lgdtl  (%esi)
+f0109154:	88 70 0f             	mov    %dh,0xf(%eax)
+f0109157:	20 c0                	and    %al,%al
+f0109159:	66 83 c8 01          	or     $0x1,%ax
+f010915d:	0f 22 c0             	mov    %eax,%cr0
+f0109160:	66 ea 20 70 00 00    	ljmpw  $0x0,$0x7020
+f0109166:	08 00                	or     %al,(%eax)
+
+f0109168 <start32>:
+f0109168:	66 b8 10 00          	mov    $0x10,%ax
+f010916c:	8e d8                	mov    %eax,%ds
+f010916e:	8e c0                	mov    %eax,%es
+f0109170:	8e d0                	mov    %eax,%ss
+f0109172:	66 b8 00 00          	mov    $0x0,%ax
+f0109176:	8e e0                	mov    %eax,%fs
+f0109178:	8e e8                	mov    %eax,%gs
+f010917a:	b8 00 50 11 00       	mov    $0x115000,%eax
+f010917f:	0f 22 d8             	mov    %eax,%cr3
+f0109182:	0f 20 e0             	mov    %cr4,%eax
+f0109185:	83 c8 10             	or     $0x10,%eax
+f0109188:	0f 22 e0             	mov    %eax,%cr4
+f010918b:	0f 20 c0             	mov    %cr0,%eax
+f010918e:	0d 01 00 01 80       	or     $0x80010001,%eax
+f0109193:	0f 22 c0             	mov    %eax,%cr0
+f0109196:	b8 01 00 00 00       	mov    $0x1,%eax
+f010919b:	0f a2                	cpuid
+f010919d:	c1 eb 18             	shr    $0x18,%ebx
+f01091a0:	8b 24 9d 20 20 1a f0 	mov    -0xfe5dfe0(,%ebx,4),%esp
+f01091a7:	bd 00 00 00 00       	mov    $0x0,%ebp
+f01091ac:	b8 89 03 10 f0       	mov    $0xf0100389,%eax
+f01091b1:	ff d0                	call   *%eax
+
+f01091b3 <spin>:
+f01091b3:	eb fe                	jmp    f01091b3 <spin>
+f01091b5:	8d 76 00             	lea    0x0(%esi),%esi
+
+f01091b8 <gdt>:
+	...
+f01091c0:	ff                   	(bad)
+f01091c1:	ff 00                	incl   (%eax)
+f01091c3:	00 00                	add    %al,(%eax)
+f01091c5:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+f01091cc:	00                   	.byte 0x0
+f01091cd:	92                   	xchg   %eax,%edx
+f01091ce:	cf                   	iret
+	...
+
+f01091d0 <gdtdesc>:
+f01091d0:	17                   	pop    %ss
+f01091d1:	00 70 70             	add    %dh,0x70(%eax)
+	...
+
+f01091d6 <mpentry_end>:
+f01091d6:	90                   	nop
+
+f01091d7 <mpsearch1>:
+f01091d7:	55                   	push   %ebp
+f01091d8:	89 e5                	mov    %esp,%ebp
+f01091da:	57                   	push   %edi
+f01091db:	56                   	push   %esi
+f01091dc:	53                   	push   %ebx
+f01091dd:	83 ec 0c             	sub    $0xc,%esp
+f01091e0:	89 c3                	mov    %eax,%ebx
+f01091e2:	89 d7                	mov    %edx,%edi
+f01091e4:	a1 18 37 1a f0       	mov    0xf01a3718,%eax
+f01091e9:	89 da                	mov    %ebx,%edx
+f01091eb:	c1 ea 0c             	shr    $0xc,%edx
+f01091ee:	39 c2                	cmp    %eax,%edx
+f01091f0:	73 1f                	jae    f0109211 <mpsearch1+0x3a>
+f01091f2:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+f01091f8:	01 df                	add    %ebx,%edi
+f01091fa:	89 fa                	mov    %edi,%edx
+f01091fc:	c1 ea 0c             	shr    $0xc,%edx
+f01091ff:	39 c2                	cmp    %eax,%edx
+f0109201:	73 20                	jae    f0109223 <mpsearch1+0x4c>
+f0109203:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+f0109209:	81 eb f0 ff ff 0f    	sub    $0xffffff0,%ebx
+f010920f:	eb 3a                	jmp    f010924b <mpsearch1+0x74>
+f0109211:	53                   	push   %ebx
+f0109212:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0109217:	6a 57                	push   $0x57
+f0109219:	68 21 c3 10 f0       	push   $0xf010c321
+f010921e:	e8 08 6f ff ff       	call   f010012b <_panic>
+f0109223:	57                   	push   %edi
+f0109224:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0109229:	6a 57                	push   $0x57
+f010922b:	68 21 c3 10 f0       	push   $0xf010c321
+f0109230:	e8 f6 6e ff ff       	call   f010012b <_panic>
+f0109235:	0f b6 0a             	movzbl (%edx),%ecx
+f0109238:	01 c8                	add    %ecx,%eax
+f010923a:	83 c2 01             	add    $0x1,%edx
+f010923d:	39 da                	cmp    %ebx,%edx
+f010923f:	75 f4                	jne    f0109235 <mpsearch1+0x5e>
+f0109241:	84 c0                	test   %al,%al
+f0109243:	74 2a                	je     f010926f <mpsearch1+0x98>
+f0109245:	83 c6 10             	add    $0x10,%esi
+f0109248:	83 c3 10             	add    $0x10,%ebx
+f010924b:	39 fe                	cmp    %edi,%esi
+f010924d:	73 1b                	jae    f010926a <mpsearch1+0x93>
+f010924f:	83 ec 04             	sub    $0x4,%esp
+f0109252:	6a 04                	push   $0x4
+f0109254:	68 31 c3 10 f0       	push   $0xf010c331
+f0109259:	56                   	push   %esi
+f010925a:	e8 b6 fd ff ff       	call   f0109015 <memcmp>
+f010925f:	83 c4 10             	add    $0x10,%esp
+f0109262:	89 f2                	mov    %esi,%edx
+f0109264:	85 c0                	test   %eax,%eax
+f0109266:	74 d5                	je     f010923d <mpsearch1+0x66>
+f0109268:	eb db                	jmp    f0109245 <mpsearch1+0x6e>
+f010926a:	be 00 00 00 00       	mov    $0x0,%esi
+f010926f:	89 f0                	mov    %esi,%eax
+f0109271:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109274:	5b                   	pop    %ebx
+f0109275:	5e                   	pop    %esi
+f0109276:	5f                   	pop    %edi
+f0109277:	5d                   	pop    %ebp
+f0109278:	c3                   	ret
+
+f0109279 <mp_init>:
+f0109279:	55                   	push   %ebp
+f010927a:	89 e5                	mov    %esp,%ebp
+f010927c:	57                   	push   %edi
+f010927d:	56                   	push   %esi
+f010927e:	53                   	push   %ebx
+f010927f:	83 ec 1c             	sub    $0x1c,%esp
+f0109282:	c7 05 08 70 25 f0 40 	movl   $0xf0257040,0xf0257008
+f0109289:	70 25 f0 
+f010928c:	83 3d 18 37 1a f0 00 	cmpl   $0x0,0xf01a3718
+f0109293:	0f 84 86 00 00 00    	je     f010931f <mp_init+0xa6>
+f0109299:	0f b7 05 0e 04 00 f0 	movzwl 0xf000040e,%eax
+f01092a0:	85 c0                	test   %eax,%eax
+f01092a2:	0f 84 8d 00 00 00    	je     f0109335 <mp_init+0xbc>
+f01092a8:	c1 e0 04             	shl    $0x4,%eax
+f01092ab:	ba 00 04 00 00       	mov    $0x400,%edx
+f01092b0:	e8 22 ff ff ff       	call   f01091d7 <mpsearch1>
+f01092b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01092b8:	85 c0                	test   %eax,%eax
+f01092ba:	75 1a                	jne    f01092d6 <mp_init+0x5d>
+f01092bc:	ba 00 00 01 00       	mov    $0x10000,%edx
+f01092c1:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+f01092c6:	e8 0c ff ff ff       	call   f01091d7 <mpsearch1>
+f01092cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01092ce:	85 c0                	test   %eax,%eax
+f01092d0:	0f 84 28 02 00 00    	je     f01094fe <mp_init+0x285>
+f01092d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01092d9:	8b 58 04             	mov    0x4(%eax),%ebx
+f01092dc:	85 db                	test   %ebx,%ebx
+f01092de:	74 7a                	je     f010935a <mp_init+0xe1>
+f01092e0:	80 78 0b 00          	cmpb   $0x0,0xb(%eax)
+f01092e4:	75 74                	jne    f010935a <mp_init+0xe1>
+f01092e6:	89 d8                	mov    %ebx,%eax
+f01092e8:	c1 e8 0c             	shr    $0xc,%eax
+f01092eb:	3b 05 18 37 1a f0    	cmp    0xf01a3718,%eax
+f01092f1:	73 7c                	jae    f010936f <mp_init+0xf6>
+f01092f3:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+f01092f9:	89 de                	mov    %ebx,%esi
+f01092fb:	83 ec 04             	sub    $0x4,%esp
+f01092fe:	6a 04                	push   $0x4
+f0109300:	68 36 c3 10 f0       	push   $0xf010c336
+f0109305:	53                   	push   %ebx
+f0109306:	e8 0a fd ff ff       	call   f0109015 <memcmp>
+f010930b:	83 c4 10             	add    $0x10,%esp
+f010930e:	85 c0                	test   %eax,%eax
+f0109310:	75 72                	jne    f0109384 <mp_init+0x10b>
+f0109312:	0f b7 7b 04          	movzwl 0x4(%ebx),%edi
+f0109316:	01 df                	add    %ebx,%edi
+f0109318:	89 c2                	mov    %eax,%edx
+f010931a:	e9 82 00 00 00       	jmp    f01093a1 <mp_init+0x128>
+f010931f:	68 00 04 00 00       	push   $0x400
+f0109324:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0109329:	6a 6f                	push   $0x6f
+f010932b:	68 21 c3 10 f0       	push   $0xf010c321
+f0109330:	e8 f6 6d ff ff       	call   f010012b <_panic>
+f0109335:	0f b7 05 13 04 00 f0 	movzwl 0xf0000413,%eax
+f010933c:	c1 e0 0a             	shl    $0xa,%eax
+f010933f:	2d 00 04 00 00       	sub    $0x400,%eax
+f0109344:	ba 00 04 00 00       	mov    $0x400,%edx
+f0109349:	e8 89 fe ff ff       	call   f01091d7 <mpsearch1>
+f010934e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0109351:	85 c0                	test   %eax,%eax
+f0109353:	75 81                	jne    f01092d6 <mp_init+0x5d>
+f0109355:	e9 62 ff ff ff       	jmp    f01092bc <mp_init+0x43>
+f010935a:	83 ec 0c             	sub    $0xc,%esp
+f010935d:	68 94 c1 10 f0       	push   $0xf010c194
+f0109362:	e8 bc bc ff ff       	call   f0105023 <cprintf>
+f0109367:	83 c4 10             	add    $0x10,%esp
+f010936a:	e9 8f 01 00 00       	jmp    f01094fe <mp_init+0x285>
+f010936f:	53                   	push   %ebx
+f0109370:	68 e4 9d 10 f0       	push   $0xf0109de4
+f0109375:	68 90 00 00 00       	push   $0x90
+f010937a:	68 21 c3 10 f0       	push   $0xf010c321
+f010937f:	e8 a7 6d ff ff       	call   f010012b <_panic>
+f0109384:	83 ec 0c             	sub    $0xc,%esp
+f0109387:	68 c4 c1 10 f0       	push   $0xf010c1c4
+f010938c:	e8 92 bc ff ff       	call   f0105023 <cprintf>
+f0109391:	83 c4 10             	add    $0x10,%esp
+f0109394:	e9 65 01 00 00       	jmp    f01094fe <mp_init+0x285>
+f0109399:	0f b6 0b             	movzbl (%ebx),%ecx
+f010939c:	01 ca                	add    %ecx,%edx
+f010939e:	83 c3 01             	add    $0x1,%ebx
+f01093a1:	39 fb                	cmp    %edi,%ebx
+f01093a3:	75 f4                	jne    f0109399 <mp_init+0x120>
+f01093a5:	84 d2                	test   %dl,%dl
+f01093a7:	75 16                	jne    f01093bf <mp_init+0x146>
+f01093a9:	0f b6 56 06          	movzbl 0x6(%esi),%edx
+f01093ad:	80 fa 01             	cmp    $0x1,%dl
+f01093b0:	74 05                	je     f01093b7 <mp_init+0x13e>
+f01093b2:	80 fa 04             	cmp    $0x4,%dl
+f01093b5:	75 1d                	jne    f01093d4 <mp_init+0x15b>
+f01093b7:	0f b7 4e 28          	movzwl 0x28(%esi),%ecx
+f01093bb:	01 d9                	add    %ebx,%ecx
+f01093bd:	eb 36                	jmp    f01093f5 <mp_init+0x17c>
+f01093bf:	83 ec 0c             	sub    $0xc,%esp
+f01093c2:	68 f8 c1 10 f0       	push   $0xf010c1f8
+f01093c7:	e8 57 bc ff ff       	call   f0105023 <cprintf>
+f01093cc:	83 c4 10             	add    $0x10,%esp
+f01093cf:	e9 2a 01 00 00       	jmp    f01094fe <mp_init+0x285>
+f01093d4:	83 ec 08             	sub    $0x8,%esp
+f01093d7:	0f b6 d2             	movzbl %dl,%edx
+f01093da:	52                   	push   %edx
+f01093db:	68 1c c2 10 f0       	push   $0xf010c21c
+f01093e0:	e8 3e bc ff ff       	call   f0105023 <cprintf>
+f01093e5:	83 c4 10             	add    $0x10,%esp
+f01093e8:	e9 11 01 00 00       	jmp    f01094fe <mp_init+0x285>
+f01093ed:	0f b6 13             	movzbl (%ebx),%edx
+f01093f0:	01 d0                	add    %edx,%eax
+f01093f2:	83 c3 01             	add    $0x1,%ebx
+f01093f5:	39 d9                	cmp    %ebx,%ecx
+f01093f7:	75 f4                	jne    f01093ed <mp_init+0x174>
+f01093f9:	02 46 2a             	add    0x2a(%esi),%al
+f01093fc:	75 1c                	jne    f010941a <mp_init+0x1a1>
+f01093fe:	c7 05 04 70 25 f0 01 	movl   $0x1,0xf0257004
+f0109405:	00 00 00 
+f0109408:	8b 46 24             	mov    0x24(%esi),%eax
+f010940b:	a3 44 76 25 f0       	mov    %eax,0xf0257644
+f0109410:	8d 7e 2c             	lea    0x2c(%esi),%edi
+f0109413:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0109418:	eb 54                	jmp    f010946e <mp_init+0x1f5>
+f010941a:	83 ec 0c             	sub    $0xc,%esp
+f010941d:	68 3c c2 10 f0       	push   $0xf010c23c
+f0109422:	e8 fc bb ff ff       	call   f0105023 <cprintf>
+f0109427:	83 c4 10             	add    $0x10,%esp
+f010942a:	e9 cf 00 00 00       	jmp    f01094fe <mp_init+0x285>
+f010942f:	f6 47 03 02          	testb  $0x2,0x3(%edi)
+f0109433:	74 15                	je     f010944a <mp_init+0x1d1>
+f0109435:	a1 00 70 25 f0       	mov    0xf0257000,%eax
+f010943a:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f010943d:	c1 e0 06             	shl    $0x6,%eax
+f0109440:	05 40 70 25 f0       	add    $0xf0257040,%eax
+f0109445:	a3 08 70 25 f0       	mov    %eax,0xf0257008
+f010944a:	a1 00 70 25 f0       	mov    0xf0257000,%eax
+f010944f:	83 f8 07             	cmp    $0x7,%eax
+f0109452:	7f 36                	jg     f010948a <mp_init+0x211>
+f0109454:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0109457:	c1 e2 06             	shl    $0x6,%edx
+f010945a:	88 82 55 70 25 f0    	mov    %al,-0xfda8fab(%edx)
+f0109460:	83 c0 01             	add    $0x1,%eax
+f0109463:	a3 00 70 25 f0       	mov    %eax,0xf0257000
+f0109468:	83 c7 14             	add    $0x14,%edi
+f010946b:	83 c3 01             	add    $0x1,%ebx
+f010946e:	0f b7 46 22          	movzwl 0x22(%esi),%eax
+f0109472:	39 c3                	cmp    %eax,%ebx
+f0109474:	73 4f                	jae    f01094c5 <mp_init+0x24c>
+f0109476:	0f b6 07             	movzbl (%edi),%eax
+f0109479:	84 c0                	test   %al,%al
+f010947b:	74 b2                	je     f010942f <mp_init+0x1b6>
+f010947d:	8d 50 ff             	lea    -0x1(%eax),%edx
+f0109480:	80 fa 03             	cmp    $0x3,%dl
+f0109483:	77 1c                	ja     f01094a1 <mp_init+0x228>
+f0109485:	83 c7 08             	add    $0x8,%edi
+f0109488:	eb e1                	jmp    f010946b <mp_init+0x1f2>
+f010948a:	83 ec 08             	sub    $0x8,%esp
+f010948d:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+f0109491:	50                   	push   %eax
+f0109492:	68 6c c2 10 f0       	push   $0xf010c26c
+f0109497:	e8 87 bb ff ff       	call   f0105023 <cprintf>
+f010949c:	83 c4 10             	add    $0x10,%esp
+f010949f:	eb c7                	jmp    f0109468 <mp_init+0x1ef>
+f01094a1:	83 ec 08             	sub    $0x8,%esp
+f01094a4:	0f b6 c0             	movzbl %al,%eax
+f01094a7:	50                   	push   %eax
+f01094a8:	68 94 c2 10 f0       	push   $0xf010c294
+f01094ad:	e8 71 bb ff ff       	call   f0105023 <cprintf>
+f01094b2:	c7 05 04 70 25 f0 00 	movl   $0x0,0xf0257004
+f01094b9:	00 00 00 
+f01094bc:	0f b7 5e 22          	movzwl 0x22(%esi),%ebx
+f01094c0:	83 c4 10             	add    $0x10,%esp
+f01094c3:	eb a6                	jmp    f010946b <mp_init+0x1f2>
+f01094c5:	a1 08 70 25 f0       	mov    0xf0257008,%eax
+f01094ca:	c7 40 18 01 00 00 00 	movl   $0x1,0x18(%eax)
+f01094d1:	83 3d 04 70 25 f0 00 	cmpl   $0x0,0xf0257004
+f01094d8:	74 2c                	je     f0109506 <mp_init+0x28d>
+f01094da:	83 ec 04             	sub    $0x4,%esp
+f01094dd:	ff 35 00 70 25 f0    	push   0xf0257000
+f01094e3:	0f b6 40 15          	movzbl 0x15(%eax),%eax
+f01094e7:	50                   	push   %eax
+f01094e8:	68 3b c3 10 f0       	push   $0xf010c33b
+f01094ed:	e8 31 bb ff ff       	call   f0105023 <cprintf>
+f01094f2:	83 c4 10             	add    $0x10,%esp
+f01094f5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01094f8:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+f01094fc:	75 2e                	jne    f010952c <mp_init+0x2b3>
+f01094fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109501:	5b                   	pop    %ebx
+f0109502:	5e                   	pop    %esi
+f0109503:	5f                   	pop    %edi
+f0109504:	5d                   	pop    %ebp
+f0109505:	c3                   	ret
+f0109506:	c7 05 00 70 25 f0 01 	movl   $0x1,0xf0257000
+f010950d:	00 00 00 
+f0109510:	c7 05 44 76 25 f0 00 	movl   $0x0,0xf0257644
+f0109517:	00 00 00 
+f010951a:	83 ec 0c             	sub    $0xc,%esp
+f010951d:	68 b4 c2 10 f0       	push   $0xf010c2b4
+f0109522:	e8 fc ba ff ff       	call   f0105023 <cprintf>
+f0109527:	83 c4 10             	add    $0x10,%esp
+f010952a:	eb d2                	jmp    f01094fe <mp_init+0x285>
+f010952c:	83 ec 0c             	sub    $0xc,%esp
+f010952f:	68 e0 c2 10 f0       	push   $0xf010c2e0
+f0109534:	e8 ea ba ff ff       	call   f0105023 <cprintf>
+f0109539:	b8 70 00 00 00       	mov    $0x70,%eax
+f010953e:	ba 22 00 00 00       	mov    $0x22,%edx
+f0109543:	ee                   	out    %al,(%dx)
+f0109544:	ba 23 00 00 00       	mov    $0x23,%edx
+f0109549:	ec                   	in     (%dx),%al
+f010954a:	83 c8 01             	or     $0x1,%eax
+f010954d:	ee                   	out    %al,(%dx)
+f010954e:	83 c4 10             	add    $0x10,%esp
+f0109551:	eb ab                	jmp    f01094fe <mp_init+0x285>
+
+f0109553 <lapicw>:
+f0109553:	8b 0d 40 76 25 f0    	mov    0xf0257640,%ecx
+f0109559:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+f010955c:	89 10                	mov    %edx,(%eax)
+f010955e:	a1 40 76 25 f0       	mov    0xf0257640,%eax
+f0109563:	8b 40 20             	mov    0x20(%eax),%eax
+f0109566:	c3                   	ret
+
+f0109567 <microdelay>:
+f0109567:	55                   	push   %ebp
+f0109568:	89 e5                	mov    %esp,%ebp
+f010956a:	57                   	push   %edi
+f010956b:	56                   	push   %esi
+f010956c:	53                   	push   %ebx
+f010956d:	83 ec 1c             	sub    $0x1c,%esp
+f0109570:	8b 1d 64 39 1a f0    	mov    0xf01a3964,%ebx
+f0109576:	85 db                	test   %ebx,%ebx
+f0109578:	74 3d                	je     f01095b7 <microdelay+0x50>
+f010957a:	89 c1                	mov    %eax,%ecx
+f010957c:	0f 31                	rdtsc
+f010957e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0109581:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0109584:	89 c8                	mov    %ecx,%eax
+f0109586:	99                   	cltd
+f0109587:	89 d6                	mov    %edx,%esi
+f0109589:	0f af f3             	imul   %ebx,%esi
+f010958c:	f7 e3                	mul    %ebx
+f010958e:	01 f2                	add    %esi,%edx
+f0109590:	6a 00                	push   $0x0
+f0109592:	68 e8 03 00 00       	push   $0x3e8
+f0109597:	52                   	push   %edx
+f0109598:	50                   	push   %eax
+f0109599:	e8 94 04 00 00       	call   f0109a32 <__udivdi3>
+f010959e:	83 c4 10             	add    $0x10,%esp
+f01095a1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f01095a4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f01095a7:	01 c1                	add    %eax,%ecx
+f01095a9:	11 d3                	adc    %edx,%ebx
+f01095ab:	eb 02                	jmp    f01095af <microdelay+0x48>
+f01095ad:	f3 90                	pause
+f01095af:	0f 31                	rdtsc
+f01095b1:	39 c8                	cmp    %ecx,%eax
+f01095b3:	19 da                	sbb    %ebx,%edx
+f01095b5:	72 f6                	jb     f01095ad <microdelay+0x46>
+f01095b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01095ba:	5b                   	pop    %ebx
+f01095bb:	5e                   	pop    %esi
+f01095bc:	5f                   	pop    %edi
+f01095bd:	5d                   	pop    %ebp
+f01095be:	c3                   	ret
+
+f01095bf <lapic_sendipi>:
+f01095bf:	55                   	push   %ebp
+f01095c0:	89 e5                	mov    %esp,%ebp
+f01095c2:	53                   	push   %ebx
+f01095c3:	83 ec 04             	sub    $0x4,%esp
+f01095c6:	89 d3                	mov    %edx,%ebx
+f01095c8:	c1 e0 18             	shl    $0x18,%eax
+f01095cb:	89 c2                	mov    %eax,%edx
+f01095cd:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f01095d2:	e8 7c ff ff ff       	call   f0109553 <lapicw>
+f01095d7:	89 da                	mov    %ebx,%edx
+f01095d9:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01095de:	e8 70 ff ff ff       	call   f0109553 <lapicw>
+f01095e3:	8b 15 40 76 25 f0    	mov    0xf0257640,%edx
+f01095e9:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f01095ef:	f6 c4 10             	test   $0x10,%ah
+f01095f2:	75 f5                	jne    f01095e9 <lapic_sendipi+0x2a>
+f01095f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01095f7:	c9                   	leave
+f01095f8:	c3                   	ret
+
+f01095f9 <lapic_init>:
+f01095f9:	a1 44 76 25 f0       	mov    0xf0257644,%eax
+f01095fe:	85 c0                	test   %eax,%eax
+f0109600:	75 01                	jne    f0109603 <lapic_init+0xa>
+f0109602:	c3                   	ret
+f0109603:	55                   	push   %ebp
+f0109604:	89 e5                	mov    %esp,%ebp
+f0109606:	83 ec 10             	sub    $0x10,%esp
+f0109609:	68 00 10 00 00       	push   $0x1000
+f010960e:	50                   	push   %eax
+f010960f:	e8 b2 88 ff ff       	call   f0101ec6 <mmio_map_region>
+f0109614:	a3 40 76 25 f0       	mov    %eax,0xf0257640
+f0109619:	ba 27 01 00 00       	mov    $0x127,%edx
+f010961e:	b8 3c 00 00 00       	mov    $0x3c,%eax
+f0109623:	e8 2b ff ff ff       	call   f0109553 <lapicw>
+f0109628:	ba 0b 00 00 00       	mov    $0xb,%edx
+f010962d:	b8 f8 00 00 00       	mov    $0xf8,%eax
+f0109632:	e8 1c ff ff ff       	call   f0109553 <lapicw>
+f0109637:	ba 20 00 02 00       	mov    $0x20020,%edx
+f010963c:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f0109641:	e8 0d ff ff ff       	call   f0109553 <lapicw>
+f0109646:	ba 80 96 98 00       	mov    $0x989680,%edx
+f010964b:	b8 e0 00 00 00       	mov    $0xe0,%eax
+f0109650:	e8 fe fe ff ff       	call   f0109553 <lapicw>
+f0109655:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010965b:	83 c4 10             	add    $0x10,%esp
+f010965e:	39 05 08 70 25 f0    	cmp    %eax,0xf0257008
+f0109664:	74 0f                	je     f0109675 <lapic_init+0x7c>
+f0109666:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010966b:	b8 d4 00 00 00       	mov    $0xd4,%eax
+f0109670:	e8 de fe ff ff       	call   f0109553 <lapicw>
+f0109675:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010967a:	b8 d8 00 00 00       	mov    $0xd8,%eax
+f010967f:	e8 cf fe ff ff       	call   f0109553 <lapicw>
+f0109684:	a1 40 76 25 f0       	mov    0xf0257640,%eax
+f0109689:	8b 40 30             	mov    0x30(%eax),%eax
+f010968c:	c1 e8 10             	shr    $0x10,%eax
+f010968f:	a8 fc                	test   $0xfc,%al
+f0109691:	75 7c                	jne    f010970f <lapic_init+0x116>
+f0109693:	ba 33 00 00 00       	mov    $0x33,%edx
+f0109698:	b8 dc 00 00 00       	mov    $0xdc,%eax
+f010969d:	e8 b1 fe ff ff       	call   f0109553 <lapicw>
+f01096a2:	ba 00 00 00 00       	mov    $0x0,%edx
+f01096a7:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f01096ac:	e8 a2 fe ff ff       	call   f0109553 <lapicw>
+f01096b1:	ba 00 00 00 00       	mov    $0x0,%edx
+f01096b6:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f01096bb:	e8 93 fe ff ff       	call   f0109553 <lapicw>
+f01096c0:	ba 00 00 00 00       	mov    $0x0,%edx
+f01096c5:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f01096ca:	e8 84 fe ff ff       	call   f0109553 <lapicw>
+f01096cf:	ba 00 00 00 00       	mov    $0x0,%edx
+f01096d4:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f01096d9:	e8 75 fe ff ff       	call   f0109553 <lapicw>
+f01096de:	ba 00 85 08 00       	mov    $0x88500,%edx
+f01096e3:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01096e8:	e8 66 fe ff ff       	call   f0109553 <lapicw>
+f01096ed:	8b 15 40 76 25 f0    	mov    0xf0257640,%edx
+f01096f3:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f01096f9:	f6 c4 10             	test   $0x10,%ah
+f01096fc:	75 f5                	jne    f01096f3 <lapic_init+0xfa>
+f01096fe:	ba 00 00 00 00       	mov    $0x0,%edx
+f0109703:	b8 20 00 00 00       	mov    $0x20,%eax
+f0109708:	e8 46 fe ff ff       	call   f0109553 <lapicw>
+f010970d:	c9                   	leave
+f010970e:	c3                   	ret
+f010970f:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0109714:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f0109719:	e8 35 fe ff ff       	call   f0109553 <lapicw>
+f010971e:	e9 70 ff ff ff       	jmp    f0109693 <lapic_init+0x9a>
+
+f0109723 <lapic_id>:
+f0109723:	8b 15 40 76 25 f0    	mov    0xf0257640,%edx
+f0109729:	b8 00 00 00 00       	mov    $0x0,%eax
+f010972e:	85 d2                	test   %edx,%edx
+f0109730:	74 06                	je     f0109738 <lapic_id+0x15>
+f0109732:	8b 42 20             	mov    0x20(%edx),%eax
+f0109735:	c1 e8 18             	shr    $0x18,%eax
+f0109738:	c3                   	ret
+
+f0109739 <lapic_eoi>:
+f0109739:	83 3d 40 76 25 f0 00 	cmpl   $0x0,0xf0257640
+f0109740:	74 17                	je     f0109759 <lapic_eoi+0x20>
+f0109742:	55                   	push   %ebp
+f0109743:	89 e5                	mov    %esp,%ebp
+f0109745:	83 ec 08             	sub    $0x8,%esp
+f0109748:	ba 00 00 00 00       	mov    $0x0,%edx
+f010974d:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f0109752:	e8 fc fd ff ff       	call   f0109553 <lapicw>
+f0109757:	c9                   	leave
+f0109758:	c3                   	ret
+f0109759:	c3                   	ret
+
+f010975a <lapic_startaps>:
+f010975a:	55                   	push   %ebp
+f010975b:	89 e5                	mov    %esp,%ebp
+f010975d:	57                   	push   %edi
+f010975e:	56                   	push   %esi
+f010975f:	53                   	push   %ebx
+f0109760:	83 ec 1c             	sub    $0x1c,%esp
+f0109763:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0109766:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0109769:	b8 0f 00 00 00       	mov    $0xf,%eax
+f010976e:	ba 70 00 00 00       	mov    $0x70,%edx
+f0109773:	ee                   	out    %al,(%dx)
+f0109774:	b8 0a 00 00 00       	mov    $0xa,%eax
+f0109779:	ba 71 00 00 00       	mov    $0x71,%edx
+f010977e:	ee                   	out    %al,(%dx)
+f010977f:	83 3d 18 37 1a f0 00 	cmpl   $0x0,0xf01a3718
+f0109786:	74 1c                	je     f01097a4 <lapic_startaps+0x4a>
+f0109788:	66 c7 05 67 04 00 f0 	movw   $0x0,0xf0000467
+f010978f:	00 00 
+f0109791:	8b 45 10             	mov    0x10(%ebp),%eax
+f0109794:	c1 e8 04             	shr    $0x4,%eax
+f0109797:	66 a3 69 04 00 f0    	mov    %ax,0xf0000469
+f010979d:	be 00 00 00 00       	mov    $0x0,%esi
+f01097a2:	eb 2a                	jmp    f01097ce <lapic_startaps+0x74>
+f01097a4:	68 67 04 00 00       	push   $0x467
+f01097a9:	68 e4 9d 10 f0       	push   $0xf0109de4
+f01097ae:	68 ad 00 00 00       	push   $0xad
+f01097b3:	68 58 c3 10 f0       	push   $0xf010c358
+f01097b8:	e8 6e 69 ff ff       	call   f010012b <_panic>
+f01097bd:	0f b6 04 37          	movzbl (%edi,%esi,1),%eax
+f01097c1:	ba 00 c5 00 00       	mov    $0xc500,%edx
+f01097c6:	e8 f4 fd ff ff       	call   f01095bf <lapic_sendipi>
+f01097cb:	83 c6 01             	add    $0x1,%esi
+f01097ce:	39 de                	cmp    %ebx,%esi
+f01097d0:	7c eb                	jl     f01097bd <lapic_startaps+0x63>
+f01097d2:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f01097d7:	e8 8b fd ff ff       	call   f0109567 <microdelay>
+f01097dc:	be 00 00 00 00       	mov    $0x0,%esi
+f01097e1:	eb 11                	jmp    f01097f4 <lapic_startaps+0x9a>
+f01097e3:	0f b6 04 37          	movzbl (%edi,%esi,1),%eax
+f01097e7:	ba 00 85 00 00       	mov    $0x8500,%edx
+f01097ec:	e8 ce fd ff ff       	call   f01095bf <lapic_sendipi>
+f01097f1:	83 c6 01             	add    $0x1,%esi
+f01097f4:	39 de                	cmp    %ebx,%esi
+f01097f6:	7c eb                	jl     f01097e3 <lapic_startaps+0x89>
+f01097f8:	b8 64 00 00 00       	mov    $0x64,%eax
+f01097fd:	e8 65 fd ff ff       	call   f0109567 <microdelay>
+f0109802:	8b 45 10             	mov    0x10(%ebp),%eax
+f0109805:	c1 e8 0c             	shr    $0xc,%eax
+f0109808:	80 cc 06             	or     $0x6,%ah
+f010980b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010980e:	be 00 00 00 00       	mov    $0x0,%esi
+f0109813:	eb 0f                	jmp    f0109824 <lapic_startaps+0xca>
+f0109815:	0f b6 04 37          	movzbl (%edi,%esi,1),%eax
+f0109819:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f010981c:	e8 9e fd ff ff       	call   f01095bf <lapic_sendipi>
+f0109821:	83 c6 01             	add    $0x1,%esi
+f0109824:	39 f3                	cmp    %esi,%ebx
+f0109826:	7f ed                	jg     f0109815 <lapic_startaps+0xbb>
+f0109828:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f010982d:	e8 35 fd ff ff       	call   f0109567 <microdelay>
+f0109832:	be 00 00 00 00       	mov    $0x0,%esi
+f0109837:	eb 0f                	jmp    f0109848 <lapic_startaps+0xee>
+f0109839:	0f b6 04 37          	movzbl (%edi,%esi,1),%eax
+f010983d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0109840:	e8 7a fd ff ff       	call   f01095bf <lapic_sendipi>
+f0109845:	83 c6 01             	add    $0x1,%esi
+f0109848:	39 f3                	cmp    %esi,%ebx
+f010984a:	7f ed                	jg     f0109839 <lapic_startaps+0xdf>
+f010984c:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f0109851:	e8 11 fd ff ff       	call   f0109567 <microdelay>
+f0109856:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109859:	5b                   	pop    %ebx
+f010985a:	5e                   	pop    %esi
+f010985b:	5f                   	pop    %edi
+f010985c:	5d                   	pop    %ebp
+f010985d:	c3                   	ret
+
+f010985e <lapic_ipi>:
+f010985e:	55                   	push   %ebp
+f010985f:	89 e5                	mov    %esp,%ebp
+f0109861:	83 ec 08             	sub    $0x8,%esp
+f0109864:	8b 55 08             	mov    0x8(%ebp),%edx
+f0109867:	81 ca 00 00 0c 00    	or     $0xc0000,%edx
+f010986d:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0109872:	e8 dc fc ff ff       	call   f0109553 <lapicw>
+f0109877:	8b 15 40 76 25 f0    	mov    0xf0257640,%edx
+f010987d:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0109883:	f6 c4 10             	test   $0x10,%ah
+f0109886:	75 f5                	jne    f010987d <lapic_ipi+0x1f>
+f0109888:	c9                   	leave
+f0109889:	c3                   	ret
+
+f010988a <__spin_initlock>:
+f010988a:	55                   	push   %ebp
+f010988b:	89 e5                	mov    %esp,%ebp
+f010988d:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109890:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f0109896:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0109899:	89 50 04             	mov    %edx,0x4(%eax)
+f010989c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+f01098a3:	5d                   	pop    %ebp
+f01098a4:	c3                   	ret
+
+f01098a5 <spin_lock>:
+f01098a5:	55                   	push   %ebp
+f01098a6:	89 e5                	mov    %esp,%ebp
+f01098a8:	53                   	push   %ebx
+f01098a9:	83 ec 04             	sub    $0x4,%esp
+f01098ac:	8b 55 08             	mov    0x8(%ebp),%edx
+f01098af:	83 3a 00             	cmpl   $0x0,(%edx)
+f01098b2:	74 0b                	je     f01098bf <spin_lock+0x1a>
+f01098b4:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01098ba:	39 42 08             	cmp    %eax,0x8(%edx)
+f01098bd:	74 07                	je     f01098c6 <spin_lock+0x21>
+f01098bf:	b9 01 00 00 00       	mov    $0x1,%ecx
+f01098c4:	eb 2e                	jmp    f01098f4 <spin_lock+0x4f>
+f01098c6:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01098cc:	83 ec 0c             	sub    $0xc,%esp
+f01098cf:	ff 72 04             	push   0x4(%edx)
+f01098d2:	2d 40 70 25 f0       	sub    $0xf0257040,%eax
+f01098d7:	c1 f8 06             	sar    $0x6,%eax
+f01098da:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01098e0:	50                   	push   %eax
+f01098e1:	68 68 c3 10 f0       	push   $0xf010c368
+f01098e6:	6a 41                	push   $0x41
+f01098e8:	68 ca c3 10 f0       	push   $0xf010c3ca
+f01098ed:	e8 39 68 ff ff       	call   f010012b <_panic>
+f01098f2:	f3 90                	pause
+f01098f4:	89 c8                	mov    %ecx,%eax
+f01098f6:	f0 87 02             	lock xchg %eax,(%edx)
+f01098f9:	85 c0                	test   %eax,%eax
+f01098fb:	75 f5                	jne    f01098f2 <spin_lock+0x4d>
+f01098fd:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0109903:	89 42 08             	mov    %eax,0x8(%edx)
+f0109906:	89 e9                	mov    %ebp,%ecx
+f0109908:	b8 00 00 00 00       	mov    $0x0,%eax
+f010990d:	83 f8 09             	cmp    $0x9,%eax
+f0109910:	7f 21                	jg     f0109933 <spin_lock+0x8e>
+f0109912:	81 f9 ff ff 7f ef    	cmp    $0xef7fffff,%ecx
+f0109918:	76 19                	jbe    f0109933 <spin_lock+0x8e>
+f010991a:	8b 59 04             	mov    0x4(%ecx),%ebx
+f010991d:	89 5c 82 0c          	mov    %ebx,0xc(%edx,%eax,4)
+f0109921:	8b 09                	mov    (%ecx),%ecx
+f0109923:	83 c0 01             	add    $0x1,%eax
+f0109926:	eb e5                	jmp    f010990d <spin_lock+0x68>
+f0109928:	c7 44 82 0c 00 00 00 	movl   $0x0,0xc(%edx,%eax,4)
+f010992f:	00 
+f0109930:	83 c0 01             	add    $0x1,%eax
+f0109933:	83 f8 09             	cmp    $0x9,%eax
+f0109936:	7e f0                	jle    f0109928 <spin_lock+0x83>
+f0109938:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010993b:	c9                   	leave
+f010993c:	c3                   	ret
+
+f010993d <spin_unlock>:
+f010993d:	55                   	push   %ebp
+f010993e:	89 e5                	mov    %esp,%ebp
+f0109940:	57                   	push   %edi
+f0109941:	56                   	push   %esi
+f0109942:	53                   	push   %ebx
+f0109943:	83 ec 5c             	sub    $0x5c,%esp
+f0109946:	8b 75 08             	mov    0x8(%ebp),%esi
+f0109949:	83 3e 00             	cmpl   $0x0,(%esi)
+f010994c:	74 29                	je     f0109977 <spin_unlock+0x3a>
+f010994e:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0109954:	39 46 08             	cmp    %eax,0x8(%esi)
+f0109957:	75 1e                	jne    f0109977 <spin_unlock+0x3a>
+f0109959:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+f0109960:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+f0109967:	b8 00 00 00 00       	mov    $0x0,%eax
+f010996c:	f0 87 06             	lock xchg %eax,(%esi)
+f010996f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109972:	5b                   	pop    %ebx
+f0109973:	5e                   	pop    %esi
+f0109974:	5f                   	pop    %edi
+f0109975:	5d                   	pop    %ebp
+f0109976:	c3                   	ret
+f0109977:	83 ec 04             	sub    $0x4,%esp
+f010997a:	6a 28                	push   $0x28
+f010997c:	8d 46 0c             	lea    0xc(%esi),%eax
+f010997f:	50                   	push   %eax
+f0109980:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+f0109983:	53                   	push   %ebx
+f0109984:	e8 4f f5 ff ff       	call   f0108ed8 <memmove>
+f0109989:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010998f:	8b 56 08             	mov    0x8(%esi),%edx
+f0109992:	0f b6 52 15          	movzbl 0x15(%edx),%edx
+f0109996:	52                   	push   %edx
+f0109997:	ff 76 04             	push   0x4(%esi)
+f010999a:	2d 40 70 25 f0       	sub    $0xf0257040,%eax
+f010999f:	c1 f8 06             	sar    $0x6,%eax
+f01099a2:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01099a8:	50                   	push   %eax
+f01099a9:	68 94 c3 10 f0       	push   $0xf010c394
+f01099ae:	e8 70 b6 ff ff       	call   f0105023 <cprintf>
+f01099b3:	8d 7d e8             	lea    -0x18(%ebp),%edi
+f01099b6:	83 c4 20             	add    $0x20,%esp
+f01099b9:	8d 75 a8             	lea    -0x58(%ebp),%esi
+f01099bc:	eb 18                	jmp    f01099d6 <spin_unlock+0x99>
+f01099be:	83 ec 08             	sub    $0x8,%esp
+f01099c1:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f01099c4:	ff 30                	push   (%eax)
+f01099c6:	68 f1 c3 10 f0       	push   $0xf010c3f1
+f01099cb:	e8 53 b6 ff ff       	call   f0105023 <cprintf>
+f01099d0:	83 c4 10             	add    $0x10,%esp
+f01099d3:	83 c3 04             	add    $0x4,%ebx
+f01099d6:	39 fb                	cmp    %edi,%ebx
+f01099d8:	74 44                	je     f0109a1e <spin_unlock+0xe1>
+f01099da:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+f01099dd:	8b 03                	mov    (%ebx),%eax
+f01099df:	85 c0                	test   %eax,%eax
+f01099e1:	74 3b                	je     f0109a1e <spin_unlock+0xe1>
+f01099e3:	83 ec 08             	sub    $0x8,%esp
+f01099e6:	56                   	push   %esi
+f01099e7:	50                   	push   %eax
+f01099e8:	e8 b6 db ff ff       	call   f01075a3 <debuginfo_eip>
+f01099ed:	83 c4 10             	add    $0x10,%esp
+f01099f0:	85 c0                	test   %eax,%eax
+f01099f2:	78 ca                	js     f01099be <spin_unlock+0x81>
+f01099f4:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f01099f7:	8b 00                	mov    (%eax),%eax
+f01099f9:	83 ec 04             	sub    $0x4,%esp
+f01099fc:	89 c2                	mov    %eax,%edx
+f01099fe:	2b 55 b8             	sub    -0x48(%ebp),%edx
+f0109a01:	52                   	push   %edx
+f0109a02:	ff 75 b0             	push   -0x50(%ebp)
+f0109a05:	ff 75 b4             	push   -0x4c(%ebp)
+f0109a08:	ff 75 ac             	push   -0x54(%ebp)
+f0109a0b:	ff 75 a8             	push   -0x58(%ebp)
+f0109a0e:	50                   	push   %eax
+f0109a0f:	68 da c3 10 f0       	push   $0xf010c3da
+f0109a14:	e8 0a b6 ff ff       	call   f0105023 <cprintf>
+f0109a19:	83 c4 20             	add    $0x20,%esp
+f0109a1c:	eb b5                	jmp    f01099d3 <spin_unlock+0x96>
+f0109a1e:	83 ec 04             	sub    $0x4,%esp
+f0109a21:	68 f9 c3 10 f0       	push   $0xf010c3f9
+f0109a26:	6a 67                	push   $0x67
+f0109a28:	68 ca c3 10 f0       	push   $0xf010c3ca
+f0109a2d:	e8 f9 66 ff ff       	call   f010012b <_panic>
+
+f0109a32 <__udivdi3>:
+f0109a32:	57                   	push   %edi
+f0109a33:	56                   	push   %esi
+f0109a34:	53                   	push   %ebx
+f0109a35:	83 ec 20             	sub    $0x20,%esp
+f0109a38:	8b 44 24 30          	mov    0x30(%esp),%eax
+f0109a3c:	8b 54 24 34          	mov    0x34(%esp),%edx
+f0109a40:	89 44 24 08          	mov    %eax,0x8(%esp)
+f0109a44:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f0109a48:	8b 44 24 38          	mov    0x38(%esp),%eax
+f0109a4c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f0109a50:	89 44 24 10          	mov    %eax,0x10(%esp)
+f0109a54:	89 54 24 14          	mov    %edx,0x14(%esp)
+f0109a58:	89 44 24 18          	mov    %eax,0x18(%esp)
+f0109a5c:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+f0109a60:	89 d1                	mov    %edx,%ecx
+f0109a62:	09 c1                	or     %eax,%ecx
+f0109a64:	0f 84 91 00 00 00    	je     f0109afb <__udivdi3+0xc9>
+f0109a6a:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+f0109a71:	00 
+f0109a72:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+f0109a79:	00 
+f0109a7a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f0109a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109a84:	ba 00 00 00 00       	mov    $0x0,%edx
+f0109a89:	eb 08                	jmp    f0109a93 <__udivdi3+0x61>
+f0109a8b:	83 e9 01             	sub    $0x1,%ecx
+f0109a8e:	83 f9 ff             	cmp    $0xffffffff,%ecx
+f0109a91:	74 68                	je     f0109afb <__udivdi3+0xc9>
+f0109a93:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f0109a97:	01 c0                	add    %eax,%eax
+f0109a99:	89 c6                	mov    %eax,%esi
+f0109a9b:	89 d7                	mov    %edx,%edi
+f0109a9d:	8b 44 24 08          	mov    0x8(%esp),%eax
+f0109aa1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f0109aa5:	0f ad d0             	shrd   %cl,%edx,%eax
+f0109aa8:	d3 ea                	shr    %cl,%edx
+f0109aaa:	f6 c1 20             	test   $0x20,%cl
+f0109aad:	74 04                	je     f0109ab3 <__udivdi3+0x81>
+f0109aaf:	89 d0                	mov    %edx,%eax
+f0109ab1:	31 d2                	xor    %edx,%edx
+f0109ab3:	83 e0 01             	and    $0x1,%eax
+f0109ab6:	89 04 24             	mov    %eax,(%esp)
+f0109ab9:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+f0109ac0:	00 
+f0109ac1:	8b 04 24             	mov    (%esp),%eax
+f0109ac4:	8b 54 24 04          	mov    0x4(%esp),%edx
+f0109ac8:	09 f0                	or     %esi,%eax
+f0109aca:	09 fa                	or     %edi,%edx
+f0109acc:	8b 74 24 10          	mov    0x10(%esp),%esi
+f0109ad0:	8b 7c 24 14          	mov    0x14(%esp),%edi
+f0109ad4:	39 f0                	cmp    %esi,%eax
+f0109ad6:	89 d3                	mov    %edx,%ebx
+f0109ad8:	19 fb                	sbb    %edi,%ebx
+f0109ada:	72 af                	jb     f0109a8b <__udivdi3+0x59>
+f0109adc:	29 f0                	sub    %esi,%eax
+f0109ade:	19 fa                	sbb    %edi,%edx
+f0109ae0:	89 cf                	mov    %ecx,%edi
+f0109ae2:	c1 ef 05             	shr    $0x5,%edi
+f0109ae5:	83 e7 01             	and    $0x1,%edi
+f0109ae8:	89 fe                	mov    %edi,%esi
+f0109aea:	83 f6 01             	xor    $0x1,%esi
+f0109aed:	d3 e6                	shl    %cl,%esi
+f0109aef:	d3 e7                	shl    %cl,%edi
+f0109af1:	09 74 24 18          	or     %esi,0x18(%esp)
+f0109af5:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+f0109af9:	eb 90                	jmp    f0109a8b <__udivdi3+0x59>
+f0109afb:	8b 44 24 18          	mov    0x18(%esp),%eax
+f0109aff:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f0109b03:	83 c4 20             	add    $0x20,%esp
+f0109b06:	5b                   	pop    %ebx
+f0109b07:	5e                   	pop    %esi
+f0109b08:	5f                   	pop    %edi
+f0109b09:	c3                   	ret
+
+f0109b0a <__umoddi3>:
+f0109b0a:	55                   	push   %ebp
+f0109b0b:	57                   	push   %edi
+f0109b0c:	56                   	push   %esi
+f0109b0d:	53                   	push   %ebx
+f0109b0e:	83 ec 1c             	sub    $0x1c,%esp
+f0109b11:	8b 44 24 30          	mov    0x30(%esp),%eax
+f0109b15:	8b 54 24 34          	mov    0x34(%esp),%edx
+f0109b19:	89 44 24 08          	mov    %eax,0x8(%esp)
+f0109b1d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f0109b21:	8b 44 24 38          	mov    0x38(%esp),%eax
+f0109b25:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f0109b29:	89 44 24 10          	mov    %eax,0x10(%esp)
+f0109b2d:	89 54 24 14          	mov    %edx,0x14(%esp)
+f0109b31:	89 d6                	mov    %edx,%esi
+f0109b33:	09 c6                	or     %eax,%esi
+f0109b35:	74 6c                	je     f0109ba3 <__umoddi3+0x99>
+f0109b37:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f0109b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109b41:	ba 00 00 00 00       	mov    $0x0,%edx
+f0109b46:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+f0109b4a:	eb 0e                	jmp    f0109b5a <__umoddi3+0x50>
+f0109b4c:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+f0109b51:	8b 74 24 04          	mov    0x4(%esp),%esi
+f0109b55:	83 fe ff             	cmp    $0xffffffff,%esi
+f0109b58:	74 49                	je     f0109ba3 <__umoddi3+0x99>
+f0109b5a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f0109b5e:	01 c0                	add    %eax,%eax
+f0109b60:	89 c3                	mov    %eax,%ebx
+f0109b62:	89 d6                	mov    %edx,%esi
+f0109b64:	8b 44 24 08          	mov    0x8(%esp),%eax
+f0109b68:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f0109b6c:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+f0109b71:	0f ad d0             	shrd   %cl,%edx,%eax
+f0109b74:	d3 ea                	shr    %cl,%edx
+f0109b76:	f6 c1 20             	test   $0x20,%cl
+f0109b79:	74 04                	je     f0109b7f <__umoddi3+0x75>
+f0109b7b:	89 d0                	mov    %edx,%eax
+f0109b7d:	31 d2                	xor    %edx,%edx
+f0109b7f:	83 e0 01             	and    $0x1,%eax
+f0109b82:	bd 00 00 00 00       	mov    $0x0,%ebp
+f0109b87:	89 ea                	mov    %ebp,%edx
+f0109b89:	09 d8                	or     %ebx,%eax
+f0109b8b:	09 f2                	or     %esi,%edx
+f0109b8d:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+f0109b91:	8b 74 24 14          	mov    0x14(%esp),%esi
+f0109b95:	39 d8                	cmp    %ebx,%eax
+f0109b97:	89 d1                	mov    %edx,%ecx
+f0109b99:	19 f1                	sbb    %esi,%ecx
+f0109b9b:	72 af                	jb     f0109b4c <__umoddi3+0x42>
+f0109b9d:	29 d8                	sub    %ebx,%eax
+f0109b9f:	19 f2                	sbb    %esi,%edx
+f0109ba1:	eb a9                	jmp    f0109b4c <__umoddi3+0x42>
+f0109ba3:	83 c4 1c             	add    $0x1c,%esp
+f0109ba6:	5b                   	pop    %ebx
+f0109ba7:	5e                   	pop    %esi
+f0109ba8:	5f                   	pop    %edi
+f0109ba9:	5d                   	pop    %ebp
+f0109baa:	c3                   	ret
+
+f0109bab <__divdi3>:
+f0109bab:	53                   	push   %ebx
+f0109bac:	8b 44 24 08          	mov    0x8(%esp),%eax
+f0109bb0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f0109bb4:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+f0109bb8:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+f0109bbc:	85 d2                	test   %edx,%edx
+f0109bbe:	78 12                	js     f0109bd2 <__divdi3+0x27>
+f0109bc0:	85 db                	test   %ebx,%ebx
+f0109bc2:	78 2e                	js     f0109bf2 <__divdi3+0x47>
+f0109bc4:	53                   	push   %ebx
+f0109bc5:	51                   	push   %ecx
+f0109bc6:	52                   	push   %edx
+f0109bc7:	50                   	push   %eax
+f0109bc8:	e8 65 fe ff ff       	call   f0109a32 <__udivdi3>
+f0109bcd:	83 c4 10             	add    $0x10,%esp
+f0109bd0:	eb 1e                	jmp    f0109bf0 <__divdi3+0x45>
+f0109bd2:	f7 d8                	neg    %eax
+f0109bd4:	83 d2 00             	adc    $0x0,%edx
+f0109bd7:	f7 da                	neg    %edx
+f0109bd9:	85 db                	test   %ebx,%ebx
+f0109bdb:	78 2a                	js     f0109c07 <__divdi3+0x5c>
+f0109bdd:	53                   	push   %ebx
+f0109bde:	51                   	push   %ecx
+f0109bdf:	52                   	push   %edx
+f0109be0:	50                   	push   %eax
+f0109be1:	e8 4c fe ff ff       	call   f0109a32 <__udivdi3>
+f0109be6:	83 c4 10             	add    $0x10,%esp
+f0109be9:	f7 d8                	neg    %eax
+f0109beb:	83 d2 00             	adc    $0x0,%edx
+f0109bee:	f7 da                	neg    %edx
+f0109bf0:	5b                   	pop    %ebx
+f0109bf1:	c3                   	ret
+f0109bf2:	f7 d9                	neg    %ecx
+f0109bf4:	83 d3 00             	adc    $0x0,%ebx
+f0109bf7:	f7 db                	neg    %ebx
+f0109bf9:	53                   	push   %ebx
+f0109bfa:	51                   	push   %ecx
+f0109bfb:	52                   	push   %edx
+f0109bfc:	50                   	push   %eax
+f0109bfd:	e8 30 fe ff ff       	call   f0109a32 <__udivdi3>
+f0109c02:	83 c4 10             	add    $0x10,%esp
+f0109c05:	eb e2                	jmp    f0109be9 <__divdi3+0x3e>
+f0109c07:	f7 d9                	neg    %ecx
+f0109c09:	83 d3 00             	adc    $0x0,%ebx
+f0109c0c:	f7 db                	neg    %ebx
+f0109c0e:	53                   	push   %ebx
+f0109c0f:	51                   	push   %ecx
+f0109c10:	52                   	push   %edx
+f0109c11:	50                   	push   %eax
+f0109c12:	e8 1b fe ff ff       	call   f0109a32 <__udivdi3>
+f0109c17:	83 c4 10             	add    $0x10,%esp
+f0109c1a:	eb d4                	jmp    f0109bf0 <__divdi3+0x45>
+
+f0109c1c <__moddi3>:
+f0109c1c:	55                   	push   %ebp
+f0109c1d:	57                   	push   %edi
+f0109c1e:	56                   	push   %esi
+f0109c1f:	53                   	push   %ebx
+f0109c20:	83 ec 14             	sub    $0x14,%esp
+f0109c23:	8b 7c 24 28          	mov    0x28(%esp),%edi
+f0109c27:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+f0109c2b:	8b 44 24 30          	mov    0x30(%esp),%eax
+f0109c2f:	8b 54 24 34          	mov    0x34(%esp),%edx
+f0109c33:	85 ed                	test   %ebp,%ebp
+f0109c35:	78 2b                	js     f0109c62 <__moddi3+0x46>
+f0109c37:	89 c6                	mov    %eax,%esi
+f0109c39:	f7 de                	neg    %esi
+f0109c3b:	89 34 24             	mov    %esi,(%esp)
+f0109c3e:	89 d6                	mov    %edx,%esi
+f0109c40:	83 d6 00             	adc    $0x0,%esi
+f0109c43:	f7 de                	neg    %esi
+f0109c45:	89 74 24 0c          	mov    %esi,0xc(%esp)
+f0109c49:	8b 34 24             	mov    (%esp),%esi
+f0109c4c:	0f 48 f0             	cmovs  %eax,%esi
+f0109c4f:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+f0109c54:	52                   	push   %edx
+f0109c55:	56                   	push   %esi
+f0109c56:	55                   	push   %ebp
+f0109c57:	57                   	push   %edi
+f0109c58:	e8 ad fe ff ff       	call   f0109b0a <__umoddi3>
+f0109c5d:	83 c4 10             	add    $0x10,%esp
+f0109c60:	eb 3c                	jmp    f0109c9e <__moddi3+0x82>
+f0109c62:	89 c3                	mov    %eax,%ebx
+f0109c64:	f7 db                	neg    %ebx
+f0109c66:	89 d1                	mov    %edx,%ecx
+f0109c68:	83 d1 00             	adc    $0x0,%ecx
+f0109c6b:	f7 d9                	neg    %ecx
+f0109c6d:	0f 49 c3             	cmovns %ebx,%eax
+f0109c70:	89 04 24             	mov    %eax,(%esp)
+f0109c73:	0f 49 d1             	cmovns %ecx,%edx
+f0109c76:	89 54 24 04          	mov    %edx,0x4(%esp)
+f0109c7a:	ff 74 24 04          	push   0x4(%esp)
+f0109c7e:	ff 74 24 04          	push   0x4(%esp)
+f0109c82:	89 f8                	mov    %edi,%eax
+f0109c84:	89 ea                	mov    %ebp,%edx
+f0109c86:	f7 d8                	neg    %eax
+f0109c88:	83 d2 00             	adc    $0x0,%edx
+f0109c8b:	f7 da                	neg    %edx
+f0109c8d:	52                   	push   %edx
+f0109c8e:	50                   	push   %eax
+f0109c8f:	e8 76 fe ff ff       	call   f0109b0a <__umoddi3>
+f0109c94:	83 c4 10             	add    $0x10,%esp
+f0109c97:	f7 d8                	neg    %eax
+f0109c99:	83 d2 00             	adc    $0x0,%edx
+f0109c9c:	f7 da                	neg    %edx
+f0109c9e:	83 c4 14             	add    $0x14,%esp
+f0109ca1:	5b                   	pop    %ebx
+f0109ca2:	5e                   	pop    %esi
+f0109ca3:	5f                   	pop    %edi
+f0109ca4:	5d                   	pop    %ebp
+f0109ca5:	c3                   	ret
@@ -0,0 +1,2568 @@
+
+obj/user/badsegment:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 09 00 00 00       	call   80003a <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	66 b8 28 00          	mov    $0x28,%ax
+  800037:	8e d8                	mov    %eax,%ds
+  800039:	c3                   	ret
+
+0080003a <libmain>:
+  80003a:	55                   	push   %ebp
+  80003b:	89 e5                	mov    %esp,%ebp
+  80003d:	56                   	push   %esi
+  80003e:	53                   	push   %ebx
+  80003f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800042:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800045:	e8 cb 09 00 00       	call   800a15 <uinfo_envid>
+  80004a:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80004f:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  800055:	05 00 00 00 ed       	add    $0xed000000,%eax
+  80005a:	a3 20 20 80 00       	mov    %eax,0x802020
+  80005f:	85 db                	test   %ebx,%ebx
+  800061:	7e 07                	jle    80006a <libmain+0x30>
+  800063:	8b 06                	mov    (%esi),%eax
+  800065:	a3 00 20 80 00       	mov    %eax,0x802000
+  80006a:	83 ec 08             	sub    $0x8,%esp
+  80006d:	56                   	push   %esi
+  80006e:	53                   	push   %ebx
+  80006f:	e8 bf ff ff ff       	call   800033 <umain>
+  800074:	e8 0a 00 00 00       	call   800083 <exit>
+  800079:	83 c4 10             	add    $0x10,%esp
+  80007c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007f:	5b                   	pop    %ebx
+  800080:	5e                   	pop    %esi
+  800081:	5d                   	pop    %ebp
+  800082:	c3                   	ret
+
+00800083 <exit>:
+  800083:	55                   	push   %ebp
+  800084:	89 e5                	mov    %esp,%ebp
+  800086:	83 ec 08             	sub    $0x8,%esp
+  800089:	e8 20 0a 00 00       	call   800aae <bflush>
+  80008e:	83 ec 0c             	sub    $0xc,%esp
+  800091:	6a 00                	push   $0x0
+  800093:	e8 d3 00 00 00       	call   80016b <sys_env_destroy>
+  800098:	83 c4 10             	add    $0x10,%esp
+  80009b:	c9                   	leave
+  80009c:	c3                   	ret
+
+0080009d <sys_cputs>:
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	57                   	push   %edi
+  8000a1:	56                   	push   %esi
+  8000a2:	53                   	push   %ebx
+  8000a3:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000aa:	78 21                	js     8000cd <sys_cputs+0x30>
+  8000ac:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000b3:	75 2d                	jne    8000e2 <sys_cputs+0x45>
+  8000b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000c0:	89 c3                	mov    %eax,%ebx
+  8000c2:	89 c7                	mov    %eax,%edi
+  8000c4:	89 c6                	mov    %eax,%esi
+  8000c6:	cd 30                	int    $0x30
+  8000c8:	5b                   	pop    %ebx
+  8000c9:	5e                   	pop    %esi
+  8000ca:	5f                   	pop    %edi
+  8000cb:	5d                   	pop    %ebp
+  8000cc:	c3                   	ret
+  8000cd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d2:	0f a2                	cpuid
+  8000d4:	c1 ea 0b             	shr    $0xb,%edx
+  8000d7:	83 e2 01             	and    $0x1,%edx
+  8000da:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8000e0:	eb ca                	jmp    8000ac <sys_cputs+0xf>
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000ed:	89 c3                	mov    %eax,%ebx
+  8000ef:	89 c7                	mov    %eax,%edi
+  8000f1:	89 c6                	mov    %eax,%esi
+  8000f3:	55                   	push   %ebp
+  8000f4:	68 fd 00 80 00       	push   $0x8000fd
+  8000f9:	89 e5                	mov    %esp,%ebp
+  8000fb:	0f 34                	sysenter
+  8000fd:	83 c4 04             	add    $0x4,%esp
+  800100:	5d                   	pop    %ebp
+  800101:	eb c5                	jmp    8000c8 <sys_cputs+0x2b>
+
+00800103 <sys_cgetc>:
+  800103:	55                   	push   %ebp
+  800104:	89 e5                	mov    %esp,%ebp
+  800106:	57                   	push   %edi
+  800107:	56                   	push   %esi
+  800108:	53                   	push   %ebx
+  800109:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800110:	78 22                	js     800134 <sys_cgetc+0x31>
+  800112:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800119:	75 2e                	jne    800149 <sys_cgetc+0x46>
+  80011b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800120:	b8 01 00 00 00       	mov    $0x1,%eax
+  800125:	89 d1                	mov    %edx,%ecx
+  800127:	89 d3                	mov    %edx,%ebx
+  800129:	89 d7                	mov    %edx,%edi
+  80012b:	89 d6                	mov    %edx,%esi
+  80012d:	cd 30                	int    $0x30
+  80012f:	5b                   	pop    %ebx
+  800130:	5e                   	pop    %esi
+  800131:	5f                   	pop    %edi
+  800132:	5d                   	pop    %ebp
+  800133:	c3                   	ret
+  800134:	b8 01 00 00 00       	mov    $0x1,%eax
+  800139:	0f a2                	cpuid
+  80013b:	c1 ea 0b             	shr    $0xb,%edx
+  80013e:	83 e2 01             	and    $0x1,%edx
+  800141:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800147:	eb c9                	jmp    800112 <sys_cgetc+0xf>
+  800149:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800153:	89 d1                	mov    %edx,%ecx
+  800155:	89 d3                	mov    %edx,%ebx
+  800157:	89 d7                	mov    %edx,%edi
+  800159:	89 d6                	mov    %edx,%esi
+  80015b:	55                   	push   %ebp
+  80015c:	68 65 01 80 00       	push   $0x800165
+  800161:	89 e5                	mov    %esp,%ebp
+  800163:	0f 34                	sysenter
+  800165:	83 c4 04             	add    $0x4,%esp
+  800168:	5d                   	pop    %ebp
+  800169:	eb c4                	jmp    80012f <sys_cgetc+0x2c>
+
+0080016b <sys_env_destroy>:
+  80016b:	55                   	push   %ebp
+  80016c:	89 e5                	mov    %esp,%ebp
+  80016e:	57                   	push   %edi
+  80016f:	56                   	push   %esi
+  800170:	53                   	push   %ebx
+  800171:	83 ec 0c             	sub    $0xc,%esp
+  800174:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80017b:	78 2a                	js     8001a7 <sys_env_destroy+0x3c>
+  80017d:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800184:	75 36                	jne    8001bc <sys_env_destroy+0x51>
+  800186:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80018b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800190:	8b 55 08             	mov    0x8(%ebp),%edx
+  800193:	89 cb                	mov    %ecx,%ebx
+  800195:	89 cf                	mov    %ecx,%edi
+  800197:	89 ce                	mov    %ecx,%esi
+  800199:	cd 30                	int    $0x30
+  80019b:	85 c0                	test   %eax,%eax
+  80019d:	7f 40                	jg     8001df <sys_env_destroy+0x74>
+  80019f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a2:	5b                   	pop    %ebx
+  8001a3:	5e                   	pop    %esi
+  8001a4:	5f                   	pop    %edi
+  8001a5:	5d                   	pop    %ebp
+  8001a6:	c3                   	ret
+  8001a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001ac:	0f a2                	cpuid
+  8001ae:	c1 ea 0b             	shr    $0xb,%edx
+  8001b1:	83 e2 01             	and    $0x1,%edx
+  8001b4:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8001ba:	eb c1                	jmp    80017d <sys_env_destroy+0x12>
+  8001bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001c4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8001c9:	89 cb                	mov    %ecx,%ebx
+  8001cb:	89 cf                	mov    %ecx,%edi
+  8001cd:	89 ce                	mov    %ecx,%esi
+  8001cf:	55                   	push   %ebp
+  8001d0:	68 d9 01 80 00       	push   $0x8001d9
+  8001d5:	89 e5                	mov    %esp,%ebp
+  8001d7:	0f 34                	sysenter
+  8001d9:	83 c4 04             	add    $0x4,%esp
+  8001dc:	5d                   	pop    %ebp
+  8001dd:	eb bc                	jmp    80019b <sys_env_destroy+0x30>
+  8001df:	83 ec 0c             	sub    $0xc,%esp
+  8001e2:	50                   	push   %eax
+  8001e3:	6a 03                	push   $0x3
+  8001e5:	68 6a 19 80 00       	push   $0x80196a
+  8001ea:	6a 49                	push   $0x49
+  8001ec:	68 87 19 80 00       	push   $0x801987
+  8001f1:	e8 af 09 00 00       	call   800ba5 <_panic>
+
+008001f6 <sys_getenvid>:
+  8001f6:	55                   	push   %ebp
+  8001f7:	89 e5                	mov    %esp,%ebp
+  8001f9:	57                   	push   %edi
+  8001fa:	56                   	push   %esi
+  8001fb:	53                   	push   %ebx
+  8001fc:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800203:	78 22                	js     800227 <sys_getenvid+0x31>
+  800205:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80020c:	75 2e                	jne    80023c <sys_getenvid+0x46>
+  80020e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800213:	b8 02 00 00 00       	mov    $0x2,%eax
+  800218:	89 d1                	mov    %edx,%ecx
+  80021a:	89 d3                	mov    %edx,%ebx
+  80021c:	89 d7                	mov    %edx,%edi
+  80021e:	89 d6                	mov    %edx,%esi
+  800220:	cd 30                	int    $0x30
+  800222:	5b                   	pop    %ebx
+  800223:	5e                   	pop    %esi
+  800224:	5f                   	pop    %edi
+  800225:	5d                   	pop    %ebp
+  800226:	c3                   	ret
+  800227:	b8 01 00 00 00       	mov    $0x1,%eax
+  80022c:	0f a2                	cpuid
+  80022e:	c1 ea 0b             	shr    $0xb,%edx
+  800231:	83 e2 01             	and    $0x1,%edx
+  800234:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80023a:	eb c9                	jmp    800205 <sys_getenvid+0xf>
+  80023c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800241:	b8 02 00 00 00       	mov    $0x2,%eax
+  800246:	89 d1                	mov    %edx,%ecx
+  800248:	89 d3                	mov    %edx,%ebx
+  80024a:	89 d7                	mov    %edx,%edi
+  80024c:	89 d6                	mov    %edx,%esi
+  80024e:	55                   	push   %ebp
+  80024f:	68 58 02 80 00       	push   $0x800258
+  800254:	89 e5                	mov    %esp,%ebp
+  800256:	0f 34                	sysenter
+  800258:	83 c4 04             	add    $0x4,%esp
+  80025b:	5d                   	pop    %ebp
+  80025c:	eb c4                	jmp    800222 <sys_getenvid+0x2c>
+
+0080025e <sys_yield>:
+  80025e:	55                   	push   %ebp
+  80025f:	89 e5                	mov    %esp,%ebp
+  800261:	57                   	push   %edi
+  800262:	56                   	push   %esi
+  800263:	53                   	push   %ebx
+  800264:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80026b:	78 22                	js     80028f <sys_yield+0x31>
+  80026d:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800274:	75 2e                	jne    8002a4 <sys_yield+0x46>
+  800276:	ba 00 00 00 00       	mov    $0x0,%edx
+  80027b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800280:	89 d1                	mov    %edx,%ecx
+  800282:	89 d3                	mov    %edx,%ebx
+  800284:	89 d7                	mov    %edx,%edi
+  800286:	89 d6                	mov    %edx,%esi
+  800288:	cd 30                	int    $0x30
+  80028a:	5b                   	pop    %ebx
+  80028b:	5e                   	pop    %esi
+  80028c:	5f                   	pop    %edi
+  80028d:	5d                   	pop    %ebp
+  80028e:	c3                   	ret
+  80028f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800294:	0f a2                	cpuid
+  800296:	c1 ea 0b             	shr    $0xb,%edx
+  800299:	83 e2 01             	and    $0x1,%edx
+  80029c:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8002a2:	eb c9                	jmp    80026d <sys_yield+0xf>
+  8002a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002ae:	89 d1                	mov    %edx,%ecx
+  8002b0:	89 d3                	mov    %edx,%ebx
+  8002b2:	89 d7                	mov    %edx,%edi
+  8002b4:	89 d6                	mov    %edx,%esi
+  8002b6:	55                   	push   %ebp
+  8002b7:	68 c0 02 80 00       	push   $0x8002c0
+  8002bc:	89 e5                	mov    %esp,%ebp
+  8002be:	0f 34                	sysenter
+  8002c0:	83 c4 04             	add    $0x4,%esp
+  8002c3:	5d                   	pop    %ebp
+  8002c4:	eb c4                	jmp    80028a <sys_yield+0x2c>
+
+008002c6 <sys_env_set_cow>:
+  8002c6:	55                   	push   %ebp
+  8002c7:	89 e5                	mov    %esp,%ebp
+  8002c9:	57                   	push   %edi
+  8002ca:	56                   	push   %esi
+  8002cb:	53                   	push   %ebx
+  8002cc:	83 ec 0c             	sub    $0xc,%esp
+  8002cf:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8002d6:	78 2b                	js     800303 <sys_env_set_cow+0x3d>
+  8002d8:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8002df:	75 37                	jne    800318 <sys_env_set_cow+0x52>
+  8002e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002e6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8002eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f1:	89 df                	mov    %ebx,%edi
+  8002f3:	89 de                	mov    %ebx,%esi
+  8002f5:	cd 30                	int    $0x30
+  8002f7:	85 c0                	test   %eax,%eax
+  8002f9:	7f 41                	jg     80033c <sys_env_set_cow+0x76>
+  8002fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002fe:	5b                   	pop    %ebx
+  8002ff:	5e                   	pop    %esi
+  800300:	5f                   	pop    %edi
+  800301:	5d                   	pop    %ebp
+  800302:	c3                   	ret
+  800303:	b8 01 00 00 00       	mov    $0x1,%eax
+  800308:	0f a2                	cpuid
+  80030a:	c1 ea 0b             	shr    $0xb,%edx
+  80030d:	83 e2 01             	and    $0x1,%edx
+  800310:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800316:	eb c0                	jmp    8002d8 <sys_env_set_cow+0x12>
+  800318:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80031d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800320:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800323:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800328:	89 df                	mov    %ebx,%edi
+  80032a:	89 de                	mov    %ebx,%esi
+  80032c:	55                   	push   %ebp
+  80032d:	68 36 03 80 00       	push   $0x800336
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	0f 34                	sysenter
+  800336:	83 c4 04             	add    $0x4,%esp
+  800339:	5d                   	pop    %ebp
+  80033a:	eb bb                	jmp    8002f7 <sys_env_set_cow+0x31>
+  80033c:	83 ec 0c             	sub    $0xc,%esp
+  80033f:	50                   	push   %eax
+  800340:	6a 0d                	push   $0xd
+  800342:	68 6a 19 80 00       	push   $0x80196a
+  800347:	6a 49                	push   $0x49
+  800349:	68 87 19 80 00       	push   $0x801987
+  80034e:	e8 52 08 00 00       	call   800ba5 <_panic>
+
+00800353 <sys_env_set_quota>:
+  800353:	55                   	push   %ebp
+  800354:	89 e5                	mov    %esp,%ebp
+  800356:	57                   	push   %edi
+  800357:	56                   	push   %esi
+  800358:	53                   	push   %ebx
+  800359:	83 ec 0c             	sub    $0xc,%esp
+  80035c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800363:	78 2b                	js     800390 <sys_env_set_quota+0x3d>
+  800365:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80036c:	75 37                	jne    8003a5 <sys_env_set_quota+0x52>
+  80036e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800373:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800378:	8b 55 08             	mov    0x8(%ebp),%edx
+  80037b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80037e:	89 df                	mov    %ebx,%edi
+  800380:	89 de                	mov    %ebx,%esi
+  800382:	cd 30                	int    $0x30
+  800384:	85 c0                	test   %eax,%eax
+  800386:	7f 41                	jg     8003c9 <sys_env_set_quota+0x76>
+  800388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80038b:	5b                   	pop    %ebx
+  80038c:	5e                   	pop    %esi
+  80038d:	5f                   	pop    %edi
+  80038e:	5d                   	pop    %ebp
+  80038f:	c3                   	ret
+  800390:	b8 01 00 00 00       	mov    $0x1,%eax
+  800395:	0f a2                	cpuid
+  800397:	c1 ea 0b             	shr    $0xb,%edx
+  80039a:	83 e2 01             	and    $0x1,%edx
+  80039d:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8003a3:	eb c0                	jmp    800365 <sys_env_set_quota+0x12>
+  8003a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003b0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003b5:	89 df                	mov    %ebx,%edi
+  8003b7:	89 de                	mov    %ebx,%esi
+  8003b9:	55                   	push   %ebp
+  8003ba:	68 c3 03 80 00       	push   $0x8003c3
+  8003bf:	89 e5                	mov    %esp,%ebp
+  8003c1:	0f 34                	sysenter
+  8003c3:	83 c4 04             	add    $0x4,%esp
+  8003c6:	5d                   	pop    %ebp
+  8003c7:	eb bb                	jmp    800384 <sys_env_set_quota+0x31>
+  8003c9:	83 ec 0c             	sub    $0xc,%esp
+  8003cc:	50                   	push   %eax
+  8003cd:	6a 0f                	push   $0xf
+  8003cf:	68 6a 19 80 00       	push   $0x80196a
+  8003d4:	6a 49                	push   $0x49
+  8003d6:	68 87 19 80 00       	push   $0x801987
+  8003db:	e8 c5 07 00 00       	call   800ba5 <_panic>
+
+008003e0 <sys_page_alloc>:
+  8003e0:	55                   	push   %ebp
+  8003e1:	89 e5                	mov    %esp,%ebp
+  8003e3:	57                   	push   %edi
+  8003e4:	56                   	push   %esi
+  8003e5:	53                   	push   %ebx
+  8003e6:	83 ec 0c             	sub    $0xc,%esp
+  8003e9:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8003f0:	78 2c                	js     80041e <sys_page_alloc+0x3e>
+  8003f2:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8003f9:	75 38                	jne    800433 <sys_page_alloc+0x53>
+  8003fb:	be 00 00 00 00       	mov    $0x0,%esi
+  800400:	b8 04 00 00 00       	mov    $0x4,%eax
+  800405:	8b 55 08             	mov    0x8(%ebp),%edx
+  800408:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80040b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80040e:	89 f7                	mov    %esi,%edi
+  800410:	cd 30                	int    $0x30
+  800412:	85 c0                	test   %eax,%eax
+  800414:	7f 42                	jg     800458 <sys_page_alloc+0x78>
+  800416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800419:	5b                   	pop    %ebx
+  80041a:	5e                   	pop    %esi
+  80041b:	5f                   	pop    %edi
+  80041c:	5d                   	pop    %ebp
+  80041d:	c3                   	ret
+  80041e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800423:	0f a2                	cpuid
+  800425:	c1 ea 0b             	shr    $0xb,%edx
+  800428:	83 e2 01             	and    $0x1,%edx
+  80042b:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800431:	eb bf                	jmp    8003f2 <sys_page_alloc+0x12>
+  800433:	be 00 00 00 00       	mov    $0x0,%esi
+  800438:	8b 55 08             	mov    0x8(%ebp),%edx
+  80043b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80043e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800443:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800446:	89 f7                	mov    %esi,%edi
+  800448:	55                   	push   %ebp
+  800449:	68 52 04 80 00       	push   $0x800452
+  80044e:	89 e5                	mov    %esp,%ebp
+  800450:	0f 34                	sysenter
+  800452:	83 c4 04             	add    $0x4,%esp
+  800455:	5d                   	pop    %ebp
+  800456:	eb ba                	jmp    800412 <sys_page_alloc+0x32>
+  800458:	83 ec 0c             	sub    $0xc,%esp
+  80045b:	50                   	push   %eax
+  80045c:	6a 04                	push   $0x4
+  80045e:	68 6a 19 80 00       	push   $0x80196a
+  800463:	6a 49                	push   $0x49
+  800465:	68 87 19 80 00       	push   $0x801987
+  80046a:	e8 36 07 00 00       	call   800ba5 <_panic>
+
+0080046f <sys_page_map>:
+  80046f:	55                   	push   %ebp
+  800470:	89 e5                	mov    %esp,%ebp
+  800472:	57                   	push   %edi
+  800473:	56                   	push   %esi
+  800474:	53                   	push   %ebx
+  800475:	83 ec 0c             	sub    $0xc,%esp
+  800478:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80047f:	78 2b                	js     8004ac <sys_page_map+0x3d>
+  800481:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800488:	75 37                	jne    8004c1 <sys_page_map+0x52>
+  80048a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80048f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800492:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800495:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800498:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80049b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80049e:	cd 30                	int    $0x30
+  8004a0:	85 c0                	test   %eax,%eax
+  8004a2:	7f 41                	jg     8004e5 <sys_page_map+0x76>
+  8004a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004a7:	5b                   	pop    %ebx
+  8004a8:	5e                   	pop    %esi
+  8004a9:	5f                   	pop    %edi
+  8004aa:	5d                   	pop    %ebp
+  8004ab:	c3                   	ret
+  8004ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004b1:	0f a2                	cpuid
+  8004b3:	c1 ea 0b             	shr    $0xb,%edx
+  8004b6:	83 e2 01             	and    $0x1,%edx
+  8004b9:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8004bf:	eb c0                	jmp    800481 <sys_page_map+0x12>
+  8004c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8004cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004cf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004d2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004d5:	55                   	push   %ebp
+  8004d6:	68 df 04 80 00       	push   $0x8004df
+  8004db:	89 e5                	mov    %esp,%ebp
+  8004dd:	0f 34                	sysenter
+  8004df:	83 c4 04             	add    $0x4,%esp
+  8004e2:	5d                   	pop    %ebp
+  8004e3:	eb bb                	jmp    8004a0 <sys_page_map+0x31>
+  8004e5:	83 ec 0c             	sub    $0xc,%esp
+  8004e8:	50                   	push   %eax
+  8004e9:	6a 05                	push   $0x5
+  8004eb:	68 6a 19 80 00       	push   $0x80196a
+  8004f0:	6a 49                	push   $0x49
+  8004f2:	68 87 19 80 00       	push   $0x801987
+  8004f7:	e8 a9 06 00 00       	call   800ba5 <_panic>
+
+008004fc <sys_page_unmap>:
+  8004fc:	55                   	push   %ebp
+  8004fd:	89 e5                	mov    %esp,%ebp
+  8004ff:	57                   	push   %edi
+  800500:	56                   	push   %esi
+  800501:	53                   	push   %ebx
+  800502:	83 ec 0c             	sub    $0xc,%esp
+  800505:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80050c:	78 2b                	js     800539 <sys_page_unmap+0x3d>
+  80050e:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800515:	75 37                	jne    80054e <sys_page_unmap+0x52>
+  800517:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80051c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800521:	8b 55 08             	mov    0x8(%ebp),%edx
+  800524:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800527:	89 df                	mov    %ebx,%edi
+  800529:	89 de                	mov    %ebx,%esi
+  80052b:	cd 30                	int    $0x30
+  80052d:	85 c0                	test   %eax,%eax
+  80052f:	7f 41                	jg     800572 <sys_page_unmap+0x76>
+  800531:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800534:	5b                   	pop    %ebx
+  800535:	5e                   	pop    %esi
+  800536:	5f                   	pop    %edi
+  800537:	5d                   	pop    %ebp
+  800538:	c3                   	ret
+  800539:	b8 01 00 00 00       	mov    $0x1,%eax
+  80053e:	0f a2                	cpuid
+  800540:	c1 ea 0b             	shr    $0xb,%edx
+  800543:	83 e2 01             	and    $0x1,%edx
+  800546:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80054c:	eb c0                	jmp    80050e <sys_page_unmap+0x12>
+  80054e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800553:	8b 55 08             	mov    0x8(%ebp),%edx
+  800556:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800559:	b8 06 00 00 00       	mov    $0x6,%eax
+  80055e:	89 df                	mov    %ebx,%edi
+  800560:	89 de                	mov    %ebx,%esi
+  800562:	55                   	push   %ebp
+  800563:	68 6c 05 80 00       	push   $0x80056c
+  800568:	89 e5                	mov    %esp,%ebp
+  80056a:	0f 34                	sysenter
+  80056c:	83 c4 04             	add    $0x4,%esp
+  80056f:	5d                   	pop    %ebp
+  800570:	eb bb                	jmp    80052d <sys_page_unmap+0x31>
+  800572:	83 ec 0c             	sub    $0xc,%esp
+  800575:	50                   	push   %eax
+  800576:	6a 06                	push   $0x6
+  800578:	68 6a 19 80 00       	push   $0x80196a
+  80057d:	6a 49                	push   $0x49
+  80057f:	68 87 19 80 00       	push   $0x801987
+  800584:	e8 1c 06 00 00       	call   800ba5 <_panic>
+
+00800589 <sys_page_reuse>:
+  800589:	55                   	push   %ebp
+  80058a:	89 e5                	mov    %esp,%ebp
+  80058c:	57                   	push   %edi
+  80058d:	56                   	push   %esi
+  80058e:	53                   	push   %ebx
+  80058f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800596:	78 24                	js     8005bc <sys_page_reuse+0x33>
+  800598:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80059f:	75 30                	jne    8005d1 <sys_page_reuse+0x48>
+  8005a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005a6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005b1:	89 df                	mov    %ebx,%edi
+  8005b3:	89 de                	mov    %ebx,%esi
+  8005b5:	cd 30                	int    $0x30
+  8005b7:	5b                   	pop    %ebx
+  8005b8:	5e                   	pop    %esi
+  8005b9:	5f                   	pop    %edi
+  8005ba:	5d                   	pop    %ebp
+  8005bb:	c3                   	ret
+  8005bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005c1:	0f a2                	cpuid
+  8005c3:	c1 ea 0b             	shr    $0xb,%edx
+  8005c6:	83 e2 01             	and    $0x1,%edx
+  8005c9:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8005cf:	eb c7                	jmp    800598 <sys_page_reuse+0xf>
+  8005d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005dc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005e1:	89 df                	mov    %ebx,%edi
+  8005e3:	89 de                	mov    %ebx,%esi
+  8005e5:	55                   	push   %ebp
+  8005e6:	68 ef 05 80 00       	push   $0x8005ef
+  8005eb:	89 e5                	mov    %esp,%ebp
+  8005ed:	0f 34                	sysenter
+  8005ef:	83 c4 04             	add    $0x4,%esp
+  8005f2:	5d                   	pop    %ebp
+  8005f3:	eb c2                	jmp    8005b7 <sys_page_reuse+0x2e>
+
+008005f5 <sys_env_set_status>:
+  8005f5:	55                   	push   %ebp
+  8005f6:	89 e5                	mov    %esp,%ebp
+  8005f8:	57                   	push   %edi
+  8005f9:	56                   	push   %esi
+  8005fa:	53                   	push   %ebx
+  8005fb:	83 ec 0c             	sub    $0xc,%esp
+  8005fe:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800605:	78 2b                	js     800632 <sys_env_set_status+0x3d>
+  800607:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80060e:	75 37                	jne    800647 <sys_env_set_status+0x52>
+  800610:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800615:	b8 08 00 00 00       	mov    $0x8,%eax
+  80061a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80061d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800620:	89 df                	mov    %ebx,%edi
+  800622:	89 de                	mov    %ebx,%esi
+  800624:	cd 30                	int    $0x30
+  800626:	85 c0                	test   %eax,%eax
+  800628:	7f 41                	jg     80066b <sys_env_set_status+0x76>
+  80062a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80062d:	5b                   	pop    %ebx
+  80062e:	5e                   	pop    %esi
+  80062f:	5f                   	pop    %edi
+  800630:	5d                   	pop    %ebp
+  800631:	c3                   	ret
+  800632:	b8 01 00 00 00       	mov    $0x1,%eax
+  800637:	0f a2                	cpuid
+  800639:	c1 ea 0b             	shr    $0xb,%edx
+  80063c:	83 e2 01             	and    $0x1,%edx
+  80063f:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800645:	eb c0                	jmp    800607 <sys_env_set_status+0x12>
+  800647:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80064c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80064f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800652:	b8 08 00 00 00       	mov    $0x8,%eax
+  800657:	89 df                	mov    %ebx,%edi
+  800659:	89 de                	mov    %ebx,%esi
+  80065b:	55                   	push   %ebp
+  80065c:	68 65 06 80 00       	push   $0x800665
+  800661:	89 e5                	mov    %esp,%ebp
+  800663:	0f 34                	sysenter
+  800665:	83 c4 04             	add    $0x4,%esp
+  800668:	5d                   	pop    %ebp
+  800669:	eb bb                	jmp    800626 <sys_env_set_status+0x31>
+  80066b:	83 ec 0c             	sub    $0xc,%esp
+  80066e:	50                   	push   %eax
+  80066f:	6a 08                	push   $0x8
+  800671:	68 6a 19 80 00       	push   $0x80196a
+  800676:	6a 49                	push   $0x49
+  800678:	68 87 19 80 00       	push   $0x801987
+  80067d:	e8 23 05 00 00       	call   800ba5 <_panic>
+
+00800682 <sys_env_set_pgfault_upcall>:
+  800682:	55                   	push   %ebp
+  800683:	89 e5                	mov    %esp,%ebp
+  800685:	57                   	push   %edi
+  800686:	56                   	push   %esi
+  800687:	53                   	push   %ebx
+  800688:	83 ec 0c             	sub    $0xc,%esp
+  80068b:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800692:	78 2b                	js     8006bf <sys_env_set_pgfault_upcall+0x3d>
+  800694:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80069b:	75 37                	jne    8006d4 <sys_env_set_pgfault_upcall+0x52>
+  80069d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006a2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006ad:	89 df                	mov    %ebx,%edi
+  8006af:	89 de                	mov    %ebx,%esi
+  8006b1:	cd 30                	int    $0x30
+  8006b3:	85 c0                	test   %eax,%eax
+  8006b5:	7f 41                	jg     8006f8 <sys_env_set_pgfault_upcall+0x76>
+  8006b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006ba:	5b                   	pop    %ebx
+  8006bb:	5e                   	pop    %esi
+  8006bc:	5f                   	pop    %edi
+  8006bd:	5d                   	pop    %ebp
+  8006be:	c3                   	ret
+  8006bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006c4:	0f a2                	cpuid
+  8006c6:	c1 ea 0b             	shr    $0xb,%edx
+  8006c9:	83 e2 01             	and    $0x1,%edx
+  8006cc:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8006d2:	eb c0                	jmp    800694 <sys_env_set_pgfault_upcall+0x12>
+  8006d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006df:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006e4:	89 df                	mov    %ebx,%edi
+  8006e6:	89 de                	mov    %ebx,%esi
+  8006e8:	55                   	push   %ebp
+  8006e9:	68 f2 06 80 00       	push   $0x8006f2
+  8006ee:	89 e5                	mov    %esp,%ebp
+  8006f0:	0f 34                	sysenter
+  8006f2:	83 c4 04             	add    $0x4,%esp
+  8006f5:	5d                   	pop    %ebp
+  8006f6:	eb bb                	jmp    8006b3 <sys_env_set_pgfault_upcall+0x31>
+  8006f8:	83 ec 0c             	sub    $0xc,%esp
+  8006fb:	50                   	push   %eax
+  8006fc:	6a 09                	push   $0x9
+  8006fe:	68 6a 19 80 00       	push   $0x80196a
+  800703:	6a 49                	push   $0x49
+  800705:	68 87 19 80 00       	push   $0x801987
+  80070a:	e8 96 04 00 00       	call   800ba5 <_panic>
+
+0080070f <sys_env_set_trace>:
+  80070f:	55                   	push   %ebp
+  800710:	89 e5                	mov    %esp,%ebp
+  800712:	57                   	push   %edi
+  800713:	56                   	push   %esi
+  800714:	53                   	push   %ebx
+  800715:	83 ec 0c             	sub    $0xc,%esp
+  800718:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80071f:	78 2b                	js     80074c <sys_env_set_trace+0x3d>
+  800721:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800728:	75 37                	jne    800761 <sys_env_set_trace+0x52>
+  80072a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80072f:	b8 12 00 00 00       	mov    $0x12,%eax
+  800734:	8b 55 08             	mov    0x8(%ebp),%edx
+  800737:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80073a:	89 df                	mov    %ebx,%edi
+  80073c:	89 de                	mov    %ebx,%esi
+  80073e:	cd 30                	int    $0x30
+  800740:	85 c0                	test   %eax,%eax
+  800742:	7f 41                	jg     800785 <sys_env_set_trace+0x76>
+  800744:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800747:	5b                   	pop    %ebx
+  800748:	5e                   	pop    %esi
+  800749:	5f                   	pop    %edi
+  80074a:	5d                   	pop    %ebp
+  80074b:	c3                   	ret
+  80074c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800751:	0f a2                	cpuid
+  800753:	c1 ea 0b             	shr    $0xb,%edx
+  800756:	83 e2 01             	and    $0x1,%edx
+  800759:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80075f:	eb c0                	jmp    800721 <sys_env_set_trace+0x12>
+  800761:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800766:	8b 55 08             	mov    0x8(%ebp),%edx
+  800769:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80076c:	b8 12 00 00 00       	mov    $0x12,%eax
+  800771:	89 df                	mov    %ebx,%edi
+  800773:	89 de                	mov    %ebx,%esi
+  800775:	55                   	push   %ebp
+  800776:	68 7f 07 80 00       	push   $0x80077f
+  80077b:	89 e5                	mov    %esp,%ebp
+  80077d:	0f 34                	sysenter
+  80077f:	83 c4 04             	add    $0x4,%esp
+  800782:	5d                   	pop    %ebp
+  800783:	eb bb                	jmp    800740 <sys_env_set_trace+0x31>
+  800785:	83 ec 0c             	sub    $0xc,%esp
+  800788:	50                   	push   %eax
+  800789:	6a 12                	push   $0x12
+  80078b:	68 6a 19 80 00       	push   $0x80196a
+  800790:	6a 49                	push   $0x49
+  800792:	68 87 19 80 00       	push   $0x801987
+  800797:	e8 09 04 00 00       	call   800ba5 <_panic>
+
+0080079c <sys_env_set_rdpmc>:
+  80079c:	55                   	push   %ebp
+  80079d:	89 e5                	mov    %esp,%ebp
+  80079f:	57                   	push   %edi
+  8007a0:	56                   	push   %esi
+  8007a1:	53                   	push   %ebx
+  8007a2:	83 ec 0c             	sub    $0xc,%esp
+  8007a5:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007ac:	78 2b                	js     8007d9 <sys_env_set_rdpmc+0x3d>
+  8007ae:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007b5:	75 37                	jne    8007ee <sys_env_set_rdpmc+0x52>
+  8007b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007bc:	b8 13 00 00 00       	mov    $0x13,%eax
+  8007c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007c7:	89 df                	mov    %ebx,%edi
+  8007c9:	89 de                	mov    %ebx,%esi
+  8007cb:	cd 30                	int    $0x30
+  8007cd:	85 c0                	test   %eax,%eax
+  8007cf:	7f 41                	jg     800812 <sys_env_set_rdpmc+0x76>
+  8007d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007d4:	5b                   	pop    %ebx
+  8007d5:	5e                   	pop    %esi
+  8007d6:	5f                   	pop    %edi
+  8007d7:	5d                   	pop    %ebp
+  8007d8:	c3                   	ret
+  8007d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007de:	0f a2                	cpuid
+  8007e0:	c1 ea 0b             	shr    $0xb,%edx
+  8007e3:	83 e2 01             	and    $0x1,%edx
+  8007e6:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8007ec:	eb c0                	jmp    8007ae <sys_env_set_rdpmc+0x12>
+  8007ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8007fe:	89 df                	mov    %ebx,%edi
+  800800:	89 de                	mov    %ebx,%esi
+  800802:	55                   	push   %ebp
+  800803:	68 0c 08 80 00       	push   $0x80080c
+  800808:	89 e5                	mov    %esp,%ebp
+  80080a:	0f 34                	sysenter
+  80080c:	83 c4 04             	add    $0x4,%esp
+  80080f:	5d                   	pop    %ebp
+  800810:	eb bb                	jmp    8007cd <sys_env_set_rdpmc+0x31>
+  800812:	83 ec 0c             	sub    $0xc,%esp
+  800815:	50                   	push   %eax
+  800816:	6a 13                	push   $0x13
+  800818:	68 6a 19 80 00       	push   $0x80196a
+  80081d:	6a 49                	push   $0x49
+  80081f:	68 87 19 80 00       	push   $0x801987
+  800824:	e8 7c 03 00 00       	call   800ba5 <_panic>
+
+00800829 <sys_ring_setup>:
+  800829:	55                   	push   %ebp
+  80082a:	89 e5                	mov    %esp,%ebp
+  80082c:	57                   	push   %edi
+  80082d:	56                   	push   %esi
+  80082e:	53                   	push   %ebx
+  80082f:	83 ec 0c             	sub    $0xc,%esp
+  800832:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800839:	78 29                	js     800864 <sys_ring_setup+0x3b>
+  80083b:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800842:	75 35                	jne    800879 <sys_ring_setup+0x50>
+  800844:	ba 00 00 00 00       	mov    $0x0,%edx
+  800849:	b8 10 00 00 00       	mov    $0x10,%eax
+  80084e:	89 d1                	mov    %edx,%ecx
+  800850:	89 d3                	mov    %edx,%ebx
+  800852:	89 d7                	mov    %edx,%edi
+  800854:	89 d6                	mov    %edx,%esi
+  800856:	cd 30                	int    $0x30
+  800858:	85 c0                	test   %eax,%eax
+  80085a:	7f 3f                	jg     80089b <sys_ring_setup+0x72>
+  80085c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80085f:	5b                   	pop    %ebx
+  800860:	5e                   	pop    %esi
+  800861:	5f                   	pop    %edi
+  800862:	5d                   	pop    %ebp
+  800863:	c3                   	ret
+  800864:	b8 01 00 00 00       	mov    $0x1,%eax
+  800869:	0f a2                	cpuid
+  80086b:	c1 ea 0b             	shr    $0xb,%edx
+  80086e:	83 e2 01             	and    $0x1,%edx
+  800871:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800877:	eb c2                	jmp    80083b <sys_ring_setup+0x12>
+  800879:	ba 00 00 00 00       	mov    $0x0,%edx
+  80087e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800883:	89 d1                	mov    %edx,%ecx
+  800885:	89 d3                	mov    %edx,%ebx
+  800887:	89 d7                	mov    %edx,%edi
+  800889:	89 d6                	mov    %edx,%esi
+  80088b:	55                   	push   %ebp
+  80088c:	68 95 08 80 00       	push   $0x800895
+  800891:	89 e5                	mov    %esp,%ebp
+  800893:	0f 34                	sysenter
+  800895:	83 c4 04             	add    $0x4,%esp
+  800898:	5d                   	pop    %ebp
+  800899:	eb bd                	jmp    800858 <sys_ring_setup+0x2f>
+  80089b:	83 ec 0c             	sub    $0xc,%esp
+  80089e:	50                   	push   %eax
+  80089f:	6a 10                	push   $0x10
+  8008a1:	68 6a 19 80 00       	push   $0x80196a
+  8008a6:	6a 49                	push   $0x49
+  8008a8:	68 87 19 80 00       	push   $0x801987
+  8008ad:	e8 f3 02 00 00       	call   800ba5 <_panic>
+
+008008b2 <sys_ring_enter>:
+  8008b2:	55                   	push   %ebp
+  8008b3:	89 e5                	mov    %esp,%ebp
+  8008b5:	57                   	push   %edi
+  8008b6:	56                   	push   %esi
+  8008b7:	53                   	push   %ebx
+  8008b8:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008bf:	78 22                	js     8008e3 <sys_ring_enter+0x31>
+  8008c1:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008c8:	75 2e                	jne    8008f8 <sys_ring_enter+0x46>
+  8008ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008cf:	b8 11 00 00 00       	mov    $0x11,%eax
+  8008d4:	89 d1                	mov    %edx,%ecx
+  8008d6:	89 d3                	mov    %edx,%ebx
+  8008d8:	89 d7                	mov    %edx,%edi
+  8008da:	89 d6                	mov    %edx,%esi
+  8008dc:	cd 30                	int    $0x30
+  8008de:	5b                   	pop    %ebx
+  8008df:	5e                   	pop    %esi
+  8008e0:	5f                   	pop    %edi
+  8008e1:	5d                   	pop    %ebp
+  8008e2:	c3                   	ret
+  8008e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008e8:	0f a2                	cpuid
+  8008ea:	c1 ea 0b             	shr    $0xb,%edx
+  8008ed:	83 e2 01             	and    $0x1,%edx
+  8008f0:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8008f6:	eb c9                	jmp    8008c1 <sys_ring_enter+0xf>
+  8008f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008fd:	b8 11 00 00 00       	mov    $0x11,%eax
+  800902:	89 d1                	mov    %edx,%ecx
+  800904:	89 d3                	mov    %edx,%ebx
+  800906:	89 d7                	mov    %edx,%edi
+  800908:	89 d6                	mov    %edx,%esi
+  80090a:	55                   	push   %ebp
+  80090b:	68 14 09 80 00       	push   $0x800914
+  800910:	89 e5                	mov    %esp,%ebp
+  800912:	0f 34                	sysenter
+  800914:	83 c4 04             	add    $0x4,%esp
+  800917:	5d                   	pop    %ebp
+  800918:	eb c4                	jmp    8008de <sys_ring_enter+0x2c>
+
+0080091a <sys_ipc_try_send>:
+  80091a:	55                   	push   %ebp
+  80091b:	89 e5                	mov    %esp,%ebp
+  80091d:	57                   	push   %edi
+  80091e:	56                   	push   %esi
+  80091f:	53                   	push   %ebx
+  800920:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800927:	78 26                	js     80094f <sys_ipc_try_send+0x35>
+  800929:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800930:	75 32                	jne    800964 <sys_ipc_try_send+0x4a>
+  800932:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800937:	be 00 00 00 00       	mov    $0x0,%esi
+  80093c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80093f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800942:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800945:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800948:	cd 30                	int    $0x30
+  80094a:	5b                   	pop    %ebx
+  80094b:	5e                   	pop    %esi
+  80094c:	5f                   	pop    %edi
+  80094d:	5d                   	pop    %ebp
+  80094e:	c3                   	ret
+  80094f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800954:	0f a2                	cpuid
+  800956:	c1 ea 0b             	shr    $0xb,%edx
+  800959:	83 e2 01             	and    $0x1,%edx
+  80095c:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800962:	eb c5                	jmp    800929 <sys_ipc_try_send+0xf>
+  800964:	8b 55 08             	mov    0x8(%ebp),%edx
+  800967:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80096a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80096f:	be 00 00 00 00       	mov    $0x0,%esi
+  800974:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800977:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80097a:	55                   	push   %ebp
+  80097b:	68 84 09 80 00       	push   $0x800984
+  800980:	89 e5                	mov    %esp,%ebp
+  800982:	0f 34                	sysenter
+  800984:	83 c4 04             	add    $0x4,%esp
+  800987:	5d                   	pop    %ebp
+  800988:	eb c0                	jmp    80094a <sys_ipc_try_send+0x30>
+
+0080098a <sys_ipc_recv>:
+  80098a:	55                   	push   %ebp
+  80098b:	89 e5                	mov    %esp,%ebp
+  80098d:	57                   	push   %edi
+  80098e:	56                   	push   %esi
+  80098f:	53                   	push   %ebx
+  800990:	83 ec 0c             	sub    $0xc,%esp
+  800993:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80099a:	78 2a                	js     8009c6 <sys_ipc_recv+0x3c>
+  80099c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8009a3:	75 36                	jne    8009db <sys_ipc_recv+0x51>
+  8009a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009aa:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009b2:	89 cb                	mov    %ecx,%ebx
+  8009b4:	89 cf                	mov    %ecx,%edi
+  8009b6:	89 ce                	mov    %ecx,%esi
+  8009b8:	cd 30                	int    $0x30
+  8009ba:	85 c0                	test   %eax,%eax
+  8009bc:	7f 40                	jg     8009fe <sys_ipc_recv+0x74>
+  8009be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009c1:	5b                   	pop    %ebx
+  8009c2:	5e                   	pop    %esi
+  8009c3:	5f                   	pop    %edi
+  8009c4:	5d                   	pop    %ebp
+  8009c5:	c3                   	ret
+  8009c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8009cb:	0f a2                	cpuid
+  8009cd:	c1 ea 0b             	shr    $0xb,%edx
+  8009d0:	83 e2 01             	and    $0x1,%edx
+  8009d3:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8009d9:	eb c1                	jmp    80099c <sys_ipc_recv+0x12>
+  8009db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009e8:	89 cb                	mov    %ecx,%ebx
+  8009ea:	89 cf                	mov    %ecx,%edi
+  8009ec:	89 ce                	mov    %ecx,%esi
+  8009ee:	55                   	push   %ebp
+  8009ef:	68 f8 09 80 00       	push   $0x8009f8
+  8009f4:	89 e5                	mov    %esp,%ebp
+  8009f6:	0f 34                	sysenter
+  8009f8:	83 c4 04             	add    $0x4,%esp
+  8009fb:	5d                   	pop    %ebp
+  8009fc:	eb bc                	jmp    8009ba <sys_ipc_recv+0x30>
+  8009fe:	83 ec 0c             	sub    $0xc,%esp
+  800a01:	50                   	push   %eax
+  800a02:	6a 0c                	push   $0xc
+  800a04:	68 6a 19 80 00       	push   $0x80196a
+  800a09:	6a 49                	push   $0x49
+  800a0b:	68 87 19 80 00       	push   $0x801987
+  800a10:	e8 90 01 00 00       	call   800ba5 <_panic>
+
+00800a15 <uinfo_envid>:
+  800a15:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  800a1a:	c3                   	ret
+
+00800a1b <uinfo_cpunum>:
+  800a1b:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  800a20:	c3                   	ret
+
+00800a21 <uinfo_ticks>:
+  800a21:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  800a26:	c3                   	ret
+
+00800a27 <uinfo_nsec>:
+  800a27:	55                   	push   %ebp
+  800a28:	89 e5                	mov    %esp,%ebp
+  800a2a:	57                   	push   %edi
+  800a2b:	56                   	push   %esi
+  800a2c:	53                   	push   %ebx
+  800a2d:	83 ec 1c             	sub    $0x1c,%esp
+  800a30:	0f 31                	rdtsc
+  800a32:	89 c6                	mov    %eax,%esi
+  800a34:	89 d7                	mov    %edx,%edi
+  800a36:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  800a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a41:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a46:	85 c9                	test   %ecx,%ecx
+  800a48:	74 5c                	je     800aa6 <uinfo_nsec+0x7f>
+  800a4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a4f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800a52:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800a55:	52                   	push   %edx
+  800a56:	51                   	push   %ecx
+  800a57:	57                   	push   %edi
+  800a58:	56                   	push   %esi
+  800a59:	e8 63 0d 00 00       	call   8017c1 <__umoddi3>
+  800a5e:	83 c4 10             	add    $0x10,%esp
+  800a61:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800a67:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  800a6c:	f7 e3                	mul    %ebx
+  800a6e:	01 ca                	add    %ecx,%edx
+  800a70:	ff 75 e4             	push   -0x1c(%ebp)
+  800a73:	ff 75 e0             	push   -0x20(%ebp)
+  800a76:	52                   	push   %edx
+  800a77:	50                   	push   %eax
+  800a78:	e8 6c 0c 00 00       	call   8016e9 <__udivdi3>
+  800a7d:	83 c4 10             	add    $0x10,%esp
+  800a80:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a83:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a86:	ff 75 e4             	push   -0x1c(%ebp)
+  800a89:	ff 75 e0             	push   -0x20(%ebp)
+  800a8c:	57                   	push   %edi
+  800a8d:	56                   	push   %esi
+  800a8e:	e8 56 0c 00 00       	call   8016e9 <__udivdi3>
+  800a93:	83 c4 10             	add    $0x10,%esp
+  800a96:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800a9c:	f7 e3                	mul    %ebx
+  800a9e:	01 ca                	add    %ecx,%edx
+  800aa0:	03 45 d8             	add    -0x28(%ebp),%eax
+  800aa3:	13 55 dc             	adc    -0x24(%ebp),%edx
+  800aa6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aa9:	5b                   	pop    %ebx
+  800aaa:	5e                   	pop    %esi
+  800aab:	5f                   	pop    %edi
+  800aac:	5d                   	pop    %ebp
+  800aad:	c3                   	ret
+
+00800aae <bflush>:
+  800aae:	a1 40 20 80 00       	mov    0x802040,%eax
+  800ab3:	85 c0                	test   %eax,%eax
+  800ab5:	75 01                	jne    800ab8 <bflush+0xa>
+  800ab7:	c3                   	ret
+  800ab8:	55                   	push   %ebp
+  800ab9:	89 e5                	mov    %esp,%ebp
+  800abb:	83 ec 10             	sub    $0x10,%esp
+  800abe:	50                   	push   %eax
+  800abf:	68 44 20 80 00       	push   $0x802044
+  800ac4:	e8 d4 f5 ff ff       	call   80009d <sys_cputs>
+  800ac9:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  800ad0:	00 00 00 
+  800ad3:	83 c4 10             	add    $0x10,%esp
+  800ad6:	c9                   	leave
+  800ad7:	c3                   	ret
+
+00800ad8 <bputch>:
+  800ad8:	55                   	push   %ebp
+  800ad9:	89 e5                	mov    %esp,%ebp
+  800adb:	53                   	push   %ebx
+  800adc:	83 ec 04             	sub    $0x4,%esp
+  800adf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ae2:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  800ae8:	8d 42 01             	lea    0x1(%edx),%eax
+  800aeb:	a3 40 20 80 00       	mov    %eax,0x802040
+  800af0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800af3:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  800af9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800afe:	77 08                	ja     800b08 <bputch+0x30>
+  800b00:	83 03 01             	addl   $0x1,(%ebx)
+  800b03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b06:	c9                   	leave
+  800b07:	c3                   	ret
+  800b08:	e8 a1 ff ff ff       	call   800aae <bflush>
+  800b0d:	eb f1                	jmp    800b00 <bputch+0x28>
+
+00800b0f <vbprintf>:
+  800b0f:	55                   	push   %ebp
+  800b10:	89 e5                	mov    %esp,%ebp
+  800b12:	83 ec 18             	sub    $0x18,%esp
+  800b15:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800b1c:	ff 75 0c             	push   0xc(%ebp)
+  800b1f:	ff 75 08             	push   0x8(%ebp)
+  800b22:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b25:	50                   	push   %eax
+  800b26:	68 d8 0a 80 00       	push   $0x800ad8
+  800b2b:	e8 4c 02 00 00       	call   800d7c <vprintfmt>
+  800b30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b33:	c9                   	leave
+  800b34:	c3                   	ret
+
+00800b35 <bprintf>:
+  800b35:	55                   	push   %ebp
+  800b36:	89 e5                	mov    %esp,%ebp
+  800b38:	83 ec 10             	sub    $0x10,%esp
+  800b3b:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800b3e:	50                   	push   %eax
+  800b3f:	ff 75 08             	push   0x8(%ebp)
+  800b42:	e8 c8 ff ff ff       	call   800b0f <vbprintf>
+  800b47:	c9                   	leave
+  800b48:	c3                   	ret
+
+00800b49 <bwrite>:
+  800b49:	55                   	push   %ebp
+  800b4a:	89 e5                	mov    %esp,%ebp
+  800b4c:	53                   	push   %ebx
+  800b4d:	83 ec 04             	sub    $0x4,%esp
+  800b50:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b53:	89 d8                	mov    %ebx,%eax
+  800b55:	03 05 40 20 80 00    	add    0x802040,%eax
+  800b5b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b60:	76 0d                	jbe    800b6f <bwrite+0x26>
+  800b62:	e8 47 ff ff ff       	call   800aae <bflush>
+  800b67:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  800b6d:	77 25                	ja     800b94 <bwrite+0x4b>
+  800b6f:	83 ec 04             	sub    $0x4,%esp
+  800b72:	53                   	push   %ebx
+  800b73:	ff 75 08             	push   0x8(%ebp)
+  800b76:	a1 40 20 80 00       	mov    0x802040,%eax
+  800b7b:	05 44 20 80 00       	add    $0x802044,%eax
+  800b80:	50                   	push   %eax
+  800b81:	e8 61 09 00 00       	call   8014e7 <memcpy>
+  800b86:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  800b8c:	83 c4 10             	add    $0x10,%esp
+  800b8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b92:	c9                   	leave
+  800b93:	c3                   	ret
+  800b94:	83 ec 08             	sub    $0x8,%esp
+  800b97:	53                   	push   %ebx
+  800b98:	ff 75 08             	push   0x8(%ebp)
+  800b9b:	e8 fd f4 ff ff       	call   80009d <sys_cputs>
+  800ba0:	83 c4 10             	add    $0x10,%esp
+  800ba3:	eb ea                	jmp    800b8f <bwrite+0x46>
+
+00800ba5 <_panic>:
+  800ba5:	55                   	push   %ebp
+  800ba6:	89 e5                	mov    %esp,%ebp
+  800ba8:	56                   	push   %esi
+  800ba9:	53                   	push   %ebx
+  800baa:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800bad:	e8 fc fe ff ff       	call   800aae <bflush>
+  800bb2:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  800bb8:	e8 39 f6 ff ff       	call   8001f6 <sys_getenvid>
+  800bbd:	83 ec 0c             	sub    $0xc,%esp
+  800bc0:	ff 75 0c             	push   0xc(%ebp)
+  800bc3:	ff 75 08             	push   0x8(%ebp)
+  800bc6:	56                   	push   %esi
+  800bc7:	50                   	push   %eax
+  800bc8:	68 98 19 80 00       	push   $0x801998
+  800bcd:	e8 b3 00 00 00       	call   800c85 <cprintf>
+  800bd2:	83 c4 18             	add    $0x18,%esp
+  800bd5:	53                   	push   %ebx
+  800bd6:	ff 75 10             	push   0x10(%ebp)
+  800bd9:	e8 56 00 00 00       	call   800c34 <vcprintf>
+  800bde:	c7 04 24 bb 19 80 00 	movl   $0x8019bb,(%esp)
+  800be5:	e8 9b 00 00 00       	call   800c85 <cprintf>
+  800bea:	83 c4 10             	add    $0x10,%esp
+  800bed:	cc                   	int3
+  800bee:	eb fd                	jmp    800bed <_panic+0x48>
+
+00800bf0 <putch>:
+  800bf0:	55                   	push   %ebp
+  800bf1:	89 e5                	mov    %esp,%ebp
+  800bf3:	53                   	push   %ebx
+  800bf4:	83 ec 04             	sub    $0x4,%esp
+  800bf7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800bfa:	8b 13                	mov    (%ebx),%edx
+  800bfc:	8d 42 01             	lea    0x1(%edx),%eax
+  800bff:	89 03                	mov    %eax,(%ebx)
+  800c01:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c04:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800c08:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800c0d:	74 09                	je     800c18 <putch+0x28>
+  800c0f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800c13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c16:	c9                   	leave
+  800c17:	c3                   	ret
+  800c18:	83 ec 08             	sub    $0x8,%esp
+  800c1b:	68 ff 00 00 00       	push   $0xff
+  800c20:	8d 43 08             	lea    0x8(%ebx),%eax
+  800c23:	50                   	push   %eax
+  800c24:	e8 74 f4 ff ff       	call   80009d <sys_cputs>
+  800c29:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800c2f:	83 c4 10             	add    $0x10,%esp
+  800c32:	eb db                	jmp    800c0f <putch+0x1f>
+
+00800c34 <vcprintf>:
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800c3d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800c44:	00 00 00 
+  800c47:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800c4e:	00 00 00 
+  800c51:	ff 75 0c             	push   0xc(%ebp)
+  800c54:	ff 75 08             	push   0x8(%ebp)
+  800c57:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800c5d:	50                   	push   %eax
+  800c5e:	68 f0 0b 80 00       	push   $0x800bf0
+  800c63:	e8 14 01 00 00       	call   800d7c <vprintfmt>
+  800c68:	83 c4 08             	add    $0x8,%esp
+  800c6b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800c71:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800c77:	50                   	push   %eax
+  800c78:	e8 20 f4 ff ff       	call   80009d <sys_cputs>
+  800c7d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800c83:	c9                   	leave
+  800c84:	c3                   	ret
+
+00800c85 <cprintf>:
+  800c85:	55                   	push   %ebp
+  800c86:	89 e5                	mov    %esp,%ebp
+  800c88:	83 ec 10             	sub    $0x10,%esp
+  800c8b:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800c8e:	50                   	push   %eax
+  800c8f:	ff 75 08             	push   0x8(%ebp)
+  800c92:	e8 9d ff ff ff       	call   800c34 <vcprintf>
+  800c97:	c9                   	leave
+  800c98:	c3                   	ret
+
+00800c99 <printnum>:
+  800c99:	55                   	push   %ebp
+  800c9a:	89 e5                	mov    %esp,%ebp
+  800c9c:	57                   	push   %edi
+  800c9d:	56                   	push   %esi
+  800c9e:	53                   	push   %ebx
+  800c9f:	83 ec 1c             	sub    $0x1c,%esp
+  800ca2:	89 c7                	mov    %eax,%edi
+  800ca4:	89 d6                	mov    %edx,%esi
+  800ca6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cac:	89 d1                	mov    %edx,%ecx
+  800cae:	89 c2                	mov    %eax,%edx
+  800cb0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cb3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800cb6:	8b 45 10             	mov    0x10(%ebp),%eax
+  800cb9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800cbc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800cbf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800cc6:	39 c2                	cmp    %eax,%edx
+  800cc8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800ccb:	72 3e                	jb     800d0b <printnum+0x72>
+  800ccd:	83 ec 0c             	sub    $0xc,%esp
+  800cd0:	ff 75 18             	push   0x18(%ebp)
+  800cd3:	83 eb 01             	sub    $0x1,%ebx
+  800cd6:	53                   	push   %ebx
+  800cd7:	50                   	push   %eax
+  800cd8:	83 ec 08             	sub    $0x8,%esp
+  800cdb:	ff 75 e4             	push   -0x1c(%ebp)
+  800cde:	ff 75 e0             	push   -0x20(%ebp)
+  800ce1:	ff 75 dc             	push   -0x24(%ebp)
+  800ce4:	ff 75 d8             	push   -0x28(%ebp)
+  800ce7:	e8 fd 09 00 00       	call   8016e9 <__udivdi3>
+  800cec:	83 c4 18             	add    $0x18,%esp
+  800cef:	52                   	push   %edx
+  800cf0:	50                   	push   %eax
+  800cf1:	89 f2                	mov    %esi,%edx
+  800cf3:	89 f8                	mov    %edi,%eax
+  800cf5:	e8 9f ff ff ff       	call   800c99 <printnum>
+  800cfa:	83 c4 20             	add    $0x20,%esp
+  800cfd:	eb 13                	jmp    800d12 <printnum+0x79>
+  800cff:	83 ec 08             	sub    $0x8,%esp
+  800d02:	56                   	push   %esi
+  800d03:	ff 75 18             	push   0x18(%ebp)
+  800d06:	ff d7                	call   *%edi
+  800d08:	83 c4 10             	add    $0x10,%esp
+  800d0b:	83 eb 01             	sub    $0x1,%ebx
+  800d0e:	85 db                	test   %ebx,%ebx
+  800d10:	7f ed                	jg     800cff <printnum+0x66>
+  800d12:	83 ec 08             	sub    $0x8,%esp
+  800d15:	56                   	push   %esi
+  800d16:	83 ec 04             	sub    $0x4,%esp
+  800d19:	ff 75 e4             	push   -0x1c(%ebp)
+  800d1c:	ff 75 e0             	push   -0x20(%ebp)
+  800d1f:	ff 75 dc             	push   -0x24(%ebp)
+  800d22:	ff 75 d8             	push   -0x28(%ebp)
+  800d25:	e8 97 0a 00 00       	call   8017c1 <__umoddi3>
+  800d2a:	83 c4 14             	add    $0x14,%esp
+  800d2d:	0f be 80 bd 19 80 00 	movsbl 0x8019bd(%eax),%eax
+  800d34:	50                   	push   %eax
+  800d35:	ff d7                	call   *%edi
+  800d37:	83 c4 10             	add    $0x10,%esp
+  800d3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3d:	5b                   	pop    %ebx
+  800d3e:	5e                   	pop    %esi
+  800d3f:	5f                   	pop    %edi
+  800d40:	5d                   	pop    %ebp
+  800d41:	c3                   	ret
+
+00800d42 <sprintputch>:
+  800d42:	55                   	push   %ebp
+  800d43:	89 e5                	mov    %esp,%ebp
+  800d45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d48:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800d4c:	8b 10                	mov    (%eax),%edx
+  800d4e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800d51:	73 0a                	jae    800d5d <sprintputch+0x1b>
+  800d53:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800d56:	89 08                	mov    %ecx,(%eax)
+  800d58:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d5b:	88 02                	mov    %al,(%edx)
+  800d5d:	5d                   	pop    %ebp
+  800d5e:	c3                   	ret
+
+00800d5f <printfmt>:
+  800d5f:	55                   	push   %ebp
+  800d60:	89 e5                	mov    %esp,%ebp
+  800d62:	83 ec 08             	sub    $0x8,%esp
+  800d65:	8d 45 14             	lea    0x14(%ebp),%eax
+  800d68:	50                   	push   %eax
+  800d69:	ff 75 10             	push   0x10(%ebp)
+  800d6c:	ff 75 0c             	push   0xc(%ebp)
+  800d6f:	ff 75 08             	push   0x8(%ebp)
+  800d72:	e8 05 00 00 00       	call   800d7c <vprintfmt>
+  800d77:	83 c4 10             	add    $0x10,%esp
+  800d7a:	c9                   	leave
+  800d7b:	c3                   	ret
+
+00800d7c <vprintfmt>:
+  800d7c:	55                   	push   %ebp
+  800d7d:	89 e5                	mov    %esp,%ebp
+  800d7f:	57                   	push   %edi
+  800d80:	56                   	push   %esi
+  800d81:	53                   	push   %ebx
+  800d82:	83 ec 2c             	sub    $0x2c,%esp
+  800d85:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d88:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d8b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d8e:	eb 0a                	jmp    800d9a <vprintfmt+0x1e>
+  800d90:	83 ec 08             	sub    $0x8,%esp
+  800d93:	53                   	push   %ebx
+  800d94:	50                   	push   %eax
+  800d95:	ff d6                	call   *%esi
+  800d97:	83 c4 10             	add    $0x10,%esp
+  800d9a:	83 c7 01             	add    $0x1,%edi
+  800d9d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800da1:	83 f8 25             	cmp    $0x25,%eax
+  800da4:	74 0c                	je     800db2 <vprintfmt+0x36>
+  800da6:	85 c0                	test   %eax,%eax
+  800da8:	75 e6                	jne    800d90 <vprintfmt+0x14>
+  800daa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dad:	5b                   	pop    %ebx
+  800dae:	5e                   	pop    %esi
+  800daf:	5f                   	pop    %edi
+  800db0:	5d                   	pop    %ebp
+  800db1:	c3                   	ret
+  800db2:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800db6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800dbd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800dc4:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800dcb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dd0:	8d 47 01             	lea    0x1(%edi),%eax
+  800dd3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800dd6:	0f b6 17             	movzbl (%edi),%edx
+  800dd9:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800ddc:	3c 55                	cmp    $0x55,%al
+  800dde:	0f 87 cf 03 00 00    	ja     8011b3 <vprintfmt+0x437>
+  800de4:	0f b6 c0             	movzbl %al,%eax
+  800de7:	ff 24 85 80 1a 80 00 	jmp    *0x801a80(,%eax,4)
+  800dee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800df1:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800df5:	eb d9                	jmp    800dd0 <vprintfmt+0x54>
+  800df7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800dfa:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800dfe:	eb d0                	jmp    800dd0 <vprintfmt+0x54>
+  800e00:	0f b6 d2             	movzbl %dl,%edx
+  800e03:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e06:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e0e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800e11:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800e15:	0f be 17             	movsbl (%edi),%edx
+  800e18:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800e1b:	83 f9 09             	cmp    $0x9,%ecx
+  800e1e:	77 55                	ja     800e75 <vprintfmt+0xf9>
+  800e20:	83 c7 01             	add    $0x1,%edi
+  800e23:	eb e9                	jmp    800e0e <vprintfmt+0x92>
+  800e25:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e28:	8b 00                	mov    (%eax),%eax
+  800e2a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e30:	8d 40 04             	lea    0x4(%eax),%eax
+  800e33:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e36:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e39:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800e3d:	79 91                	jns    800dd0 <vprintfmt+0x54>
+  800e3f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800e42:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e45:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800e4c:	eb 82                	jmp    800dd0 <vprintfmt+0x54>
+  800e4e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e51:	85 d2                	test   %edx,%edx
+  800e53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e58:	0f 49 c2             	cmovns %edx,%eax
+  800e5b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e5e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e61:	e9 6a ff ff ff       	jmp    800dd0 <vprintfmt+0x54>
+  800e66:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e69:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800e70:	e9 5b ff ff ff       	jmp    800dd0 <vprintfmt+0x54>
+  800e75:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e78:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e7b:	eb bc                	jmp    800e39 <vprintfmt+0xbd>
+  800e7d:	83 c1 01             	add    $0x1,%ecx
+  800e80:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e83:	e9 48 ff ff ff       	jmp    800dd0 <vprintfmt+0x54>
+  800e88:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e8b:	8d 78 04             	lea    0x4(%eax),%edi
+  800e8e:	83 ec 08             	sub    $0x8,%esp
+  800e91:	53                   	push   %ebx
+  800e92:	ff 30                	push   (%eax)
+  800e94:	ff d6                	call   *%esi
+  800e96:	83 c4 10             	add    $0x10,%esp
+  800e99:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800e9c:	e9 b1 02 00 00       	jmp    801152 <vprintfmt+0x3d6>
+  800ea1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ea4:	8d 78 04             	lea    0x4(%eax),%edi
+  800ea7:	8b 10                	mov    (%eax),%edx
+  800ea9:	89 d0                	mov    %edx,%eax
+  800eab:	f7 d8                	neg    %eax
+  800ead:	0f 48 c2             	cmovs  %edx,%eax
+  800eb0:	83 f8 08             	cmp    $0x8,%eax
+  800eb3:	7f 23                	jg     800ed8 <vprintfmt+0x15c>
+  800eb5:	8b 14 85 e0 1b 80 00 	mov    0x801be0(,%eax,4),%edx
+  800ebc:	85 d2                	test   %edx,%edx
+  800ebe:	74 18                	je     800ed8 <vprintfmt+0x15c>
+  800ec0:	52                   	push   %edx
+  800ec1:	68 de 19 80 00       	push   $0x8019de
+  800ec6:	53                   	push   %ebx
+  800ec7:	56                   	push   %esi
+  800ec8:	e8 92 fe ff ff       	call   800d5f <printfmt>
+  800ecd:	83 c4 10             	add    $0x10,%esp
+  800ed0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800ed3:	e9 7a 02 00 00       	jmp    801152 <vprintfmt+0x3d6>
+  800ed8:	50                   	push   %eax
+  800ed9:	68 d5 19 80 00       	push   $0x8019d5
+  800ede:	53                   	push   %ebx
+  800edf:	56                   	push   %esi
+  800ee0:	e8 7a fe ff ff       	call   800d5f <printfmt>
+  800ee5:	83 c4 10             	add    $0x10,%esp
+  800ee8:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800eeb:	e9 62 02 00 00       	jmp    801152 <vprintfmt+0x3d6>
+  800ef0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ef3:	83 c0 04             	add    $0x4,%eax
+  800ef6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800ef9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800efc:	8b 08                	mov    (%eax),%ecx
+  800efe:	85 c9                	test   %ecx,%ecx
+  800f00:	b8 ce 19 80 00       	mov    $0x8019ce,%eax
+  800f05:	0f 45 c1             	cmovne %ecx,%eax
+  800f08:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800f0b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800f0f:	7e 06                	jle    800f17 <vprintfmt+0x19b>
+  800f11:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800f15:	75 0b                	jne    800f22 <vprintfmt+0x1a6>
+  800f17:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800f1a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800f1d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f20:	eb 5c                	jmp    800f7e <vprintfmt+0x202>
+  800f22:	83 ec 08             	sub    $0x8,%esp
+  800f25:	ff 75 d0             	push   -0x30(%ebp)
+  800f28:	ff 75 cc             	push   -0x34(%ebp)
+  800f2b:	e8 87 03 00 00       	call   8012b7 <strnlen>
+  800f30:	89 c2                	mov    %eax,%edx
+  800f32:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f35:	29 d0                	sub    %edx,%eax
+  800f37:	83 c4 10             	add    $0x10,%esp
+  800f3a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800f3e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f41:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f44:	89 c6                	mov    %eax,%esi
+  800f46:	eb 0e                	jmp    800f56 <vprintfmt+0x1da>
+  800f48:	83 ec 08             	sub    $0x8,%esp
+  800f4b:	53                   	push   %ebx
+  800f4c:	57                   	push   %edi
+  800f4d:	ff 55 08             	call   *0x8(%ebp)
+  800f50:	83 ee 01             	sub    $0x1,%esi
+  800f53:	83 c4 10             	add    $0x10,%esp
+  800f56:	85 f6                	test   %esi,%esi
+  800f58:	7f ee                	jg     800f48 <vprintfmt+0x1cc>
+  800f5a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f5d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f60:	85 c0                	test   %eax,%eax
+  800f62:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f67:	0f 49 d0             	cmovns %eax,%edx
+  800f6a:	29 d0                	sub    %edx,%eax
+  800f6c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f6f:	eb a6                	jmp    800f17 <vprintfmt+0x19b>
+  800f71:	83 ec 08             	sub    $0x8,%esp
+  800f74:	53                   	push   %ebx
+  800f75:	52                   	push   %edx
+  800f76:	ff 55 08             	call   *0x8(%ebp)
+  800f79:	83 c4 10             	add    $0x10,%esp
+  800f7c:	89 f1                	mov    %esi,%ecx
+  800f7e:	8d 71 01             	lea    0x1(%ecx),%esi
+  800f81:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800f85:	0f be d0             	movsbl %al,%edx
+  800f88:	85 d2                	test   %edx,%edx
+  800f8a:	74 28                	je     800fb4 <vprintfmt+0x238>
+  800f8c:	85 ff                	test   %edi,%edi
+  800f8e:	78 05                	js     800f95 <vprintfmt+0x219>
+  800f90:	83 ef 01             	sub    $0x1,%edi
+  800f93:	78 30                	js     800fc5 <vprintfmt+0x249>
+  800f95:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800f99:	74 d6                	je     800f71 <vprintfmt+0x1f5>
+  800f9b:	0f be c0             	movsbl %al,%eax
+  800f9e:	83 e8 20             	sub    $0x20,%eax
+  800fa1:	83 f8 5e             	cmp    $0x5e,%eax
+  800fa4:	76 cb                	jbe    800f71 <vprintfmt+0x1f5>
+  800fa6:	83 ec 08             	sub    $0x8,%esp
+  800fa9:	53                   	push   %ebx
+  800faa:	6a 3f                	push   $0x3f
+  800fac:	ff 55 08             	call   *0x8(%ebp)
+  800faf:	83 c4 10             	add    $0x10,%esp
+  800fb2:	eb c8                	jmp    800f7c <vprintfmt+0x200>
+  800fb4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fb7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800fba:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800fbd:	01 d0                	add    %edx,%eax
+  800fbf:	29 c8                	sub    %ecx,%eax
+  800fc1:	89 c7                	mov    %eax,%edi
+  800fc3:	eb 13                	jmp    800fd8 <vprintfmt+0x25c>
+  800fc5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fc8:	eb ed                	jmp    800fb7 <vprintfmt+0x23b>
+  800fca:	83 ec 08             	sub    $0x8,%esp
+  800fcd:	53                   	push   %ebx
+  800fce:	6a 20                	push   $0x20
+  800fd0:	ff d6                	call   *%esi
+  800fd2:	83 ef 01             	sub    $0x1,%edi
+  800fd5:	83 c4 10             	add    $0x10,%esp
+  800fd8:	85 ff                	test   %edi,%edi
+  800fda:	7f ee                	jg     800fca <vprintfmt+0x24e>
+  800fdc:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800fdf:	89 45 14             	mov    %eax,0x14(%ebp)
+  800fe2:	e9 6b 01 00 00       	jmp    801152 <vprintfmt+0x3d6>
+  800fe7:	83 f9 01             	cmp    $0x1,%ecx
+  800fea:	7f 1f                	jg     80100b <vprintfmt+0x28f>
+  800fec:	85 c9                	test   %ecx,%ecx
+  800fee:	74 67                	je     801057 <vprintfmt+0x2db>
+  800ff0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ff3:	8b 00                	mov    (%eax),%eax
+  800ff5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ff8:	89 c1                	mov    %eax,%ecx
+  800ffa:	c1 f9 1f             	sar    $0x1f,%ecx
+  800ffd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801000:	8b 45 14             	mov    0x14(%ebp),%eax
+  801003:	8d 40 04             	lea    0x4(%eax),%eax
+  801006:	89 45 14             	mov    %eax,0x14(%ebp)
+  801009:	eb 17                	jmp    801022 <vprintfmt+0x2a6>
+  80100b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80100e:	8b 50 04             	mov    0x4(%eax),%edx
+  801011:	8b 00                	mov    (%eax),%eax
+  801013:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801016:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801019:	8b 45 14             	mov    0x14(%ebp),%eax
+  80101c:	8d 40 08             	lea    0x8(%eax),%eax
+  80101f:	89 45 14             	mov    %eax,0x14(%ebp)
+  801022:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801025:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801028:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80102d:	85 c9                	test   %ecx,%ecx
+  80102f:	0f 89 03 01 00 00    	jns    801138 <vprintfmt+0x3bc>
+  801035:	83 ec 08             	sub    $0x8,%esp
+  801038:	53                   	push   %ebx
+  801039:	6a 2d                	push   $0x2d
+  80103b:	ff d6                	call   *%esi
+  80103d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801040:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801043:	f7 da                	neg    %edx
+  801045:	83 d1 00             	adc    $0x0,%ecx
+  801048:	f7 d9                	neg    %ecx
+  80104a:	83 c4 10             	add    $0x10,%esp
+  80104d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801052:	e9 e1 00 00 00       	jmp    801138 <vprintfmt+0x3bc>
+  801057:	8b 45 14             	mov    0x14(%ebp),%eax
+  80105a:	8b 00                	mov    (%eax),%eax
+  80105c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80105f:	89 c1                	mov    %eax,%ecx
+  801061:	c1 f9 1f             	sar    $0x1f,%ecx
+  801064:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801067:	8b 45 14             	mov    0x14(%ebp),%eax
+  80106a:	8d 40 04             	lea    0x4(%eax),%eax
+  80106d:	89 45 14             	mov    %eax,0x14(%ebp)
+  801070:	eb b0                	jmp    801022 <vprintfmt+0x2a6>
+  801072:	83 f9 01             	cmp    $0x1,%ecx
+  801075:	7f 1e                	jg     801095 <vprintfmt+0x319>
+  801077:	85 c9                	test   %ecx,%ecx
+  801079:	74 32                	je     8010ad <vprintfmt+0x331>
+  80107b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80107e:	8b 10                	mov    (%eax),%edx
+  801080:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801085:	8d 40 04             	lea    0x4(%eax),%eax
+  801088:	89 45 14             	mov    %eax,0x14(%ebp)
+  80108b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801090:	e9 a3 00 00 00       	jmp    801138 <vprintfmt+0x3bc>
+  801095:	8b 45 14             	mov    0x14(%ebp),%eax
+  801098:	8b 10                	mov    (%eax),%edx
+  80109a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80109d:	8d 40 08             	lea    0x8(%eax),%eax
+  8010a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010a3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010a8:	e9 8b 00 00 00       	jmp    801138 <vprintfmt+0x3bc>
+  8010ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010b0:	8b 10                	mov    (%eax),%edx
+  8010b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8010ba:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010bd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010c2:	eb 74                	jmp    801138 <vprintfmt+0x3bc>
+  8010c4:	83 f9 01             	cmp    $0x1,%ecx
+  8010c7:	7f 1b                	jg     8010e4 <vprintfmt+0x368>
+  8010c9:	85 c9                	test   %ecx,%ecx
+  8010cb:	74 2c                	je     8010f9 <vprintfmt+0x37d>
+  8010cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010d0:	8b 10                	mov    (%eax),%edx
+  8010d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8010da:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010dd:	bf 08 00 00 00       	mov    $0x8,%edi
+  8010e2:	eb 54                	jmp    801138 <vprintfmt+0x3bc>
+  8010e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010e7:	8b 10                	mov    (%eax),%edx
+  8010e9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8010ec:	8d 40 08             	lea    0x8(%eax),%eax
+  8010ef:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010f2:	bf 08 00 00 00       	mov    $0x8,%edi
+  8010f7:	eb 3f                	jmp    801138 <vprintfmt+0x3bc>
+  8010f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010fc:	8b 10                	mov    (%eax),%edx
+  8010fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801103:	8d 40 04             	lea    0x4(%eax),%eax
+  801106:	89 45 14             	mov    %eax,0x14(%ebp)
+  801109:	bf 08 00 00 00       	mov    $0x8,%edi
+  80110e:	eb 28                	jmp    801138 <vprintfmt+0x3bc>
+  801110:	83 ec 08             	sub    $0x8,%esp
+  801113:	53                   	push   %ebx
+  801114:	6a 30                	push   $0x30
+  801116:	ff d6                	call   *%esi
+  801118:	83 c4 08             	add    $0x8,%esp
+  80111b:	53                   	push   %ebx
+  80111c:	6a 78                	push   $0x78
+  80111e:	ff d6                	call   *%esi
+  801120:	8b 45 14             	mov    0x14(%ebp),%eax
+  801123:	8b 10                	mov    (%eax),%edx
+  801125:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80112a:	83 c4 10             	add    $0x10,%esp
+  80112d:	8d 40 04             	lea    0x4(%eax),%eax
+  801130:	89 45 14             	mov    %eax,0x14(%ebp)
+  801133:	bf 10 00 00 00       	mov    $0x10,%edi
+  801138:	83 ec 0c             	sub    $0xc,%esp
+  80113b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80113f:	50                   	push   %eax
+  801140:	ff 75 e0             	push   -0x20(%ebp)
+  801143:	57                   	push   %edi
+  801144:	51                   	push   %ecx
+  801145:	52                   	push   %edx
+  801146:	89 da                	mov    %ebx,%edx
+  801148:	89 f0                	mov    %esi,%eax
+  80114a:	e8 4a fb ff ff       	call   800c99 <printnum>
+  80114f:	83 c4 20             	add    $0x20,%esp
+  801152:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801155:	e9 40 fc ff ff       	jmp    800d9a <vprintfmt+0x1e>
+  80115a:	83 f9 01             	cmp    $0x1,%ecx
+  80115d:	7f 1b                	jg     80117a <vprintfmt+0x3fe>
+  80115f:	85 c9                	test   %ecx,%ecx
+  801161:	74 2c                	je     80118f <vprintfmt+0x413>
+  801163:	8b 45 14             	mov    0x14(%ebp),%eax
+  801166:	8b 10                	mov    (%eax),%edx
+  801168:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80116d:	8d 40 04             	lea    0x4(%eax),%eax
+  801170:	89 45 14             	mov    %eax,0x14(%ebp)
+  801173:	bf 10 00 00 00       	mov    $0x10,%edi
+  801178:	eb be                	jmp    801138 <vprintfmt+0x3bc>
+  80117a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80117d:	8b 10                	mov    (%eax),%edx
+  80117f:	8b 48 04             	mov    0x4(%eax),%ecx
+  801182:	8d 40 08             	lea    0x8(%eax),%eax
+  801185:	89 45 14             	mov    %eax,0x14(%ebp)
+  801188:	bf 10 00 00 00       	mov    $0x10,%edi
+  80118d:	eb a9                	jmp    801138 <vprintfmt+0x3bc>
+  80118f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801192:	8b 10                	mov    (%eax),%edx
+  801194:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801199:	8d 40 04             	lea    0x4(%eax),%eax
+  80119c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80119f:	bf 10 00 00 00       	mov    $0x10,%edi
+  8011a4:	eb 92                	jmp    801138 <vprintfmt+0x3bc>
+  8011a6:	83 ec 08             	sub    $0x8,%esp
+  8011a9:	53                   	push   %ebx
+  8011aa:	6a 25                	push   $0x25
+  8011ac:	ff d6                	call   *%esi
+  8011ae:	83 c4 10             	add    $0x10,%esp
+  8011b1:	eb 9f                	jmp    801152 <vprintfmt+0x3d6>
+  8011b3:	83 ec 08             	sub    $0x8,%esp
+  8011b6:	53                   	push   %ebx
+  8011b7:	6a 25                	push   $0x25
+  8011b9:	ff d6                	call   *%esi
+  8011bb:	83 c4 10             	add    $0x10,%esp
+  8011be:	89 f8                	mov    %edi,%eax
+  8011c0:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8011c4:	74 05                	je     8011cb <vprintfmt+0x44f>
+  8011c6:	83 e8 01             	sub    $0x1,%eax
+  8011c9:	eb f5                	jmp    8011c0 <vprintfmt+0x444>
+  8011cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8011ce:	eb 82                	jmp    801152 <vprintfmt+0x3d6>
+
+008011d0 <vsnprintf>:
+  8011d0:	55                   	push   %ebp
+  8011d1:	89 e5                	mov    %esp,%ebp
+  8011d3:	83 ec 18             	sub    $0x18,%esp
+  8011d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011dc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8011df:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8011e3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8011e6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8011ed:	85 c0                	test   %eax,%eax
+  8011ef:	74 26                	je     801217 <vsnprintf+0x47>
+  8011f1:	85 d2                	test   %edx,%edx
+  8011f3:	7e 22                	jle    801217 <vsnprintf+0x47>
+  8011f5:	ff 75 14             	push   0x14(%ebp)
+  8011f8:	ff 75 10             	push   0x10(%ebp)
+  8011fb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8011fe:	50                   	push   %eax
+  8011ff:	68 42 0d 80 00       	push   $0x800d42
+  801204:	e8 73 fb ff ff       	call   800d7c <vprintfmt>
+  801209:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80120c:	c6 00 00             	movb   $0x0,(%eax)
+  80120f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801212:	83 c4 10             	add    $0x10,%esp
+  801215:	c9                   	leave
+  801216:	c3                   	ret
+  801217:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80121c:	eb f7                	jmp    801215 <vsnprintf+0x45>
+
+0080121e <snprintf>:
+  80121e:	55                   	push   %ebp
+  80121f:	89 e5                	mov    %esp,%ebp
+  801221:	83 ec 08             	sub    $0x8,%esp
+  801224:	8d 45 14             	lea    0x14(%ebp),%eax
+  801227:	50                   	push   %eax
+  801228:	ff 75 10             	push   0x10(%ebp)
+  80122b:	ff 75 0c             	push   0xc(%ebp)
+  80122e:	ff 75 08             	push   0x8(%ebp)
+  801231:	e8 9a ff ff ff       	call   8011d0 <vsnprintf>
+  801236:	c9                   	leave
+  801237:	c3                   	ret
+
+00801238 <copy_fwd>:
+  801238:	55                   	push   %ebp
+  801239:	89 e5                	mov    %esp,%ebp
+  80123b:	57                   	push   %edi
+  80123c:	56                   	push   %esi
+  80123d:	53                   	push   %ebx
+  80123e:	89 c7                	mov    %eax,%edi
+  801240:	89 d6                	mov    %edx,%esi
+  801242:	89 c8                	mov    %ecx,%eax
+  801244:	83 f9 0f             	cmp    $0xf,%ecx
+  801247:	76 1c                	jbe    801265 <copy_fwd+0x2d>
+  801249:	89 f9                	mov    %edi,%ecx
+  80124b:	f7 d9                	neg    %ecx
+  80124d:	89 cb                	mov    %ecx,%ebx
+  80124f:	83 e3 03             	and    $0x3,%ebx
+  801252:	29 d8                	sub    %ebx,%eax
+  801254:	89 c2                	mov    %eax,%edx
+  801256:	c1 ea 02             	shr    $0x2,%edx
+  801259:	83 e0 03             	and    $0x3,%eax
+  80125c:	89 d9                	mov    %ebx,%ecx
+  80125e:	fc                   	cld
+  80125f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  801261:	89 d1                	mov    %edx,%ecx
+  801263:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801265:	89 c1                	mov    %eax,%ecx
+  801267:	fc                   	cld
+  801268:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80126a:	5b                   	pop    %ebx
+  80126b:	5e                   	pop    %esi
+  80126c:	5f                   	pop    %edi
+  80126d:	5d                   	pop    %ebp
+  80126e:	c3                   	ret
+
+0080126f <have_sse2>:
+  80126f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801276:	78 06                	js     80127e <have_sse2+0xf>
+  801278:	a1 08 20 80 00       	mov    0x802008,%eax
+  80127d:	c3                   	ret
+  80127e:	55                   	push   %ebp
+  80127f:	89 e5                	mov    %esp,%ebp
+  801281:	53                   	push   %ebx
+  801282:	b8 01 00 00 00       	mov    $0x1,%eax
+  801287:	0f a2                	cpuid
+  801289:	c1 ea 1a             	shr    $0x1a,%edx
+  80128c:	83 e2 01             	and    $0x1,%edx
+  80128f:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801295:	a1 08 20 80 00       	mov    0x802008,%eax
+  80129a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80129d:	c9                   	leave
+  80129e:	c3                   	ret
+
+0080129f <strlen>:
+  80129f:	55                   	push   %ebp
+  8012a0:	89 e5                	mov    %esp,%ebp
+  8012a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012aa:	eb 03                	jmp    8012af <strlen+0x10>
+  8012ac:	83 c0 01             	add    $0x1,%eax
+  8012af:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8012b3:	75 f7                	jne    8012ac <strlen+0xd>
+  8012b5:	5d                   	pop    %ebp
+  8012b6:	c3                   	ret
+
+008012b7 <strnlen>:
+  8012b7:	55                   	push   %ebp
+  8012b8:	89 e5                	mov    %esp,%ebp
+  8012ba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c5:	eb 03                	jmp    8012ca <strnlen+0x13>
+  8012c7:	83 c0 01             	add    $0x1,%eax
+  8012ca:	39 d0                	cmp    %edx,%eax
+  8012cc:	74 08                	je     8012d6 <strnlen+0x1f>
+  8012ce:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8012d2:	75 f3                	jne    8012c7 <strnlen+0x10>
+  8012d4:	89 c2                	mov    %eax,%edx
+  8012d6:	89 d0                	mov    %edx,%eax
+  8012d8:	5d                   	pop    %ebp
+  8012d9:	c3                   	ret
+
+008012da <strcpy>:
+  8012da:	55                   	push   %ebp
+  8012db:	89 e5                	mov    %esp,%ebp
+  8012dd:	53                   	push   %ebx
+  8012de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012e1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8012e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8012ed:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8012f0:	83 c0 01             	add    $0x1,%eax
+  8012f3:	84 d2                	test   %dl,%dl
+  8012f5:	75 f2                	jne    8012e9 <strcpy+0xf>
+  8012f7:	89 c8                	mov    %ecx,%eax
+  8012f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012fc:	c9                   	leave
+  8012fd:	c3                   	ret
+
+008012fe <strcat>:
+  8012fe:	55                   	push   %ebp
+  8012ff:	89 e5                	mov    %esp,%ebp
+  801301:	53                   	push   %ebx
+  801302:	83 ec 10             	sub    $0x10,%esp
+  801305:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801308:	53                   	push   %ebx
+  801309:	e8 91 ff ff ff       	call   80129f <strlen>
+  80130e:	83 c4 08             	add    $0x8,%esp
+  801311:	ff 75 0c             	push   0xc(%ebp)
+  801314:	01 d8                	add    %ebx,%eax
+  801316:	50                   	push   %eax
+  801317:	e8 be ff ff ff       	call   8012da <strcpy>
+  80131c:	89 d8                	mov    %ebx,%eax
+  80131e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801321:	c9                   	leave
+  801322:	c3                   	ret
+
+00801323 <strncpy>:
+  801323:	55                   	push   %ebp
+  801324:	89 e5                	mov    %esp,%ebp
+  801326:	56                   	push   %esi
+  801327:	53                   	push   %ebx
+  801328:	8b 75 08             	mov    0x8(%ebp),%esi
+  80132b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80132e:	89 f3                	mov    %esi,%ebx
+  801330:	03 5d 10             	add    0x10(%ebp),%ebx
+  801333:	89 f0                	mov    %esi,%eax
+  801335:	eb 0f                	jmp    801346 <strncpy+0x23>
+  801337:	83 c0 01             	add    $0x1,%eax
+  80133a:	0f b6 0a             	movzbl (%edx),%ecx
+  80133d:	88 48 ff             	mov    %cl,-0x1(%eax)
+  801340:	80 f9 01             	cmp    $0x1,%cl
+  801343:	83 da ff             	sbb    $0xffffffff,%edx
+  801346:	39 d8                	cmp    %ebx,%eax
+  801348:	75 ed                	jne    801337 <strncpy+0x14>
+  80134a:	89 f0                	mov    %esi,%eax
+  80134c:	5b                   	pop    %ebx
+  80134d:	5e                   	pop    %esi
+  80134e:	5d                   	pop    %ebp
+  80134f:	c3                   	ret
+
+00801350 <strlcpy>:
+  801350:	55                   	push   %ebp
+  801351:	89 e5                	mov    %esp,%ebp
+  801353:	56                   	push   %esi
+  801354:	53                   	push   %ebx
+  801355:	8b 75 08             	mov    0x8(%ebp),%esi
+  801358:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80135e:	89 f0                	mov    %esi,%eax
+  801360:	85 d2                	test   %edx,%edx
+  801362:	74 21                	je     801385 <strlcpy+0x35>
+  801364:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801368:	89 f2                	mov    %esi,%edx
+  80136a:	eb 09                	jmp    801375 <strlcpy+0x25>
+  80136c:	83 c1 01             	add    $0x1,%ecx
+  80136f:	83 c2 01             	add    $0x1,%edx
+  801372:	88 5a ff             	mov    %bl,-0x1(%edx)
+  801375:	39 c2                	cmp    %eax,%edx
+  801377:	74 09                	je     801382 <strlcpy+0x32>
+  801379:	0f b6 19             	movzbl (%ecx),%ebx
+  80137c:	84 db                	test   %bl,%bl
+  80137e:	75 ec                	jne    80136c <strlcpy+0x1c>
+  801380:	89 d0                	mov    %edx,%eax
+  801382:	c6 00 00             	movb   $0x0,(%eax)
+  801385:	29 f0                	sub    %esi,%eax
+  801387:	5b                   	pop    %ebx
+  801388:	5e                   	pop    %esi
+  801389:	5d                   	pop    %ebp
+  80138a:	c3                   	ret
+
+0080138b <strcmp>:
+  80138b:	55                   	push   %ebp
+  80138c:	89 e5                	mov    %esp,%ebp
+  80138e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801391:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801394:	eb 06                	jmp    80139c <strcmp+0x11>
+  801396:	83 c1 01             	add    $0x1,%ecx
+  801399:	83 c2 01             	add    $0x1,%edx
+  80139c:	0f b6 01             	movzbl (%ecx),%eax
+  80139f:	84 c0                	test   %al,%al
+  8013a1:	74 04                	je     8013a7 <strcmp+0x1c>
+  8013a3:	3a 02                	cmp    (%edx),%al
+  8013a5:	74 ef                	je     801396 <strcmp+0xb>
+  8013a7:	0f b6 c0             	movzbl %al,%eax
+  8013aa:	0f b6 12             	movzbl (%edx),%edx
+  8013ad:	29 d0                	sub    %edx,%eax
+  8013af:	5d                   	pop    %ebp
+  8013b0:	c3                   	ret
+
+008013b1 <strncmp>:
+  8013b1:	55                   	push   %ebp
+  8013b2:	89 e5                	mov    %esp,%ebp
+  8013b4:	53                   	push   %ebx
+  8013b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013bb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8013be:	eb 09                	jmp    8013c9 <strncmp+0x18>
+  8013c0:	83 ea 01             	sub    $0x1,%edx
+  8013c3:	83 c0 01             	add    $0x1,%eax
+  8013c6:	83 c1 01             	add    $0x1,%ecx
+  8013c9:	85 d2                	test   %edx,%edx
+  8013cb:	74 18                	je     8013e5 <strncmp+0x34>
+  8013cd:	0f b6 18             	movzbl (%eax),%ebx
+  8013d0:	84 db                	test   %bl,%bl
+  8013d2:	74 04                	je     8013d8 <strncmp+0x27>
+  8013d4:	3a 19                	cmp    (%ecx),%bl
+  8013d6:	74 e8                	je     8013c0 <strncmp+0xf>
+  8013d8:	0f b6 00             	movzbl (%eax),%eax
+  8013db:	0f b6 11             	movzbl (%ecx),%edx
+  8013de:	29 d0                	sub    %edx,%eax
+  8013e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013e3:	c9                   	leave
+  8013e4:	c3                   	ret
+  8013e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ea:	eb f4                	jmp    8013e0 <strncmp+0x2f>
+
+008013ec <strchr>:
+  8013ec:	55                   	push   %ebp
+  8013ed:	89 e5                	mov    %esp,%ebp
+  8013ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013f2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8013f6:	eb 03                	jmp    8013fb <strchr+0xf>
+  8013f8:	83 c0 01             	add    $0x1,%eax
+  8013fb:	0f b6 10             	movzbl (%eax),%edx
+  8013fe:	84 d2                	test   %dl,%dl
+  801400:	74 06                	je     801408 <strchr+0x1c>
+  801402:	38 ca                	cmp    %cl,%dl
+  801404:	75 f2                	jne    8013f8 <strchr+0xc>
+  801406:	eb 05                	jmp    80140d <strchr+0x21>
+  801408:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140d:	5d                   	pop    %ebp
+  80140e:	c3                   	ret
+
+0080140f <strfind>:
+  80140f:	55                   	push   %ebp
+  801410:	89 e5                	mov    %esp,%ebp
+  801412:	8b 45 08             	mov    0x8(%ebp),%eax
+  801415:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  801419:	0f b6 10             	movzbl (%eax),%edx
+  80141c:	38 ca                	cmp    %cl,%dl
+  80141e:	74 09                	je     801429 <strfind+0x1a>
+  801420:	84 d2                	test   %dl,%dl
+  801422:	74 05                	je     801429 <strfind+0x1a>
+  801424:	83 c0 01             	add    $0x1,%eax
+  801427:	eb f0                	jmp    801419 <strfind+0xa>
+  801429:	5d                   	pop    %ebp
+  80142a:	c3                   	ret
+
+0080142b <memset>:
+  80142b:	55                   	push   %ebp
+  80142c:	89 e5                	mov    %esp,%ebp
+  80142e:	57                   	push   %edi
+  80142f:	56                   	push   %esi
+  801430:	53                   	push   %ebx
+  801431:	83 ec 04             	sub    $0x4,%esp
+  801434:	8b 75 08             	mov    0x8(%ebp),%esi
+  801437:	8b 55 10             	mov    0x10(%ebp),%edx
+  80143a:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  80143e:	89 f7                	mov    %esi,%edi
+  801440:	83 fa 0f             	cmp    $0xf,%edx
+  801443:	76 24                	jbe    801469 <memset+0x3e>
+  801445:	89 f1                	mov    %esi,%ecx
+  801447:	f7 d9                	neg    %ecx
+  801449:	83 e1 03             	and    $0x3,%ecx
+  80144c:	29 ca                	sub    %ecx,%edx
+  80144e:	89 d0                	mov    %edx,%eax
+  801450:	c1 e8 02             	shr    $0x2,%eax
+  801453:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  801456:	83 e2 03             	and    $0x3,%edx
+  801459:	89 d8                	mov    %ebx,%eax
+  80145b:	fc                   	cld
+  80145c:	f3 aa                	rep stos %al,%es:(%edi)
+  80145e:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  801464:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  801467:	f3 ab                	rep stos %eax,%es:(%edi)
+  801469:	89 d1                	mov    %edx,%ecx
+  80146b:	89 d8                	mov    %ebx,%eax
+  80146d:	fc                   	cld
+  80146e:	f3 aa                	rep stos %al,%es:(%edi)
+  801470:	89 f0                	mov    %esi,%eax
+  801472:	83 c4 04             	add    $0x4,%esp
+  801475:	5b                   	pop    %ebx
+  801476:	5e                   	pop    %esi
+  801477:	5f                   	pop    %edi
+  801478:	5d                   	pop    %ebp
+  801479:	c3                   	ret
+
+0080147a <memmove>:
+  80147a:	55                   	push   %ebp
+  80147b:	89 e5                	mov    %esp,%ebp
+  80147d:	57                   	push   %edi
+  80147e:	56                   	push   %esi
+  80147f:	53                   	push   %ebx
+  801480:	83 ec 0c             	sub    $0xc,%esp
+  801483:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801486:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801489:	8b 45 10             	mov    0x10(%ebp),%eax
+  80148c:	85 c0                	test   %eax,%eax
+  80148e:	74 14                	je     8014a4 <memmove+0x2a>
+  801490:	39 da                	cmp    %ebx,%edx
+  801492:	73 07                	jae    80149b <memmove+0x21>
+  801494:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  801497:	39 cb                	cmp    %ecx,%ebx
+  801499:	72 13                	jb     8014ae <memmove+0x34>
+  80149b:	89 c1                	mov    %eax,%ecx
+  80149d:	89 d8                	mov    %ebx,%eax
+  80149f:	e8 94 fd ff ff       	call   801238 <copy_fwd>
+  8014a4:	89 d8                	mov    %ebx,%eax
+  8014a6:	83 c4 0c             	add    $0xc,%esp
+  8014a9:	5b                   	pop    %ebx
+  8014aa:	5e                   	pop    %esi
+  8014ab:	5f                   	pop    %edi
+  8014ac:	5d                   	pop    %ebp
+  8014ad:	c3                   	ret
+  8014ae:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  8014b1:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  8014b4:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  8014b7:	83 f8 0f             	cmp    $0xf,%eax
+  8014ba:	76 23                	jbe    8014df <memmove+0x65>
+  8014bc:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  8014bf:	83 e1 03             	and    $0x3,%ecx
+  8014c2:	29 c8                	sub    %ecx,%eax
+  8014c4:	89 c2                	mov    %eax,%edx
+  8014c6:	c1 ea 02             	shr    $0x2,%edx
+  8014c9:	83 e0 03             	and    $0x3,%eax
+  8014cc:	fd                   	std
+  8014cd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014cf:	83 ef 03             	sub    $0x3,%edi
+  8014d2:	83 ee 03             	sub    $0x3,%esi
+  8014d5:	89 d1                	mov    %edx,%ecx
+  8014d7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8014d9:	83 c7 03             	add    $0x3,%edi
+  8014dc:	83 c6 03             	add    $0x3,%esi
+  8014df:	89 c1                	mov    %eax,%ecx
+  8014e1:	fd                   	std
+  8014e2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014e4:	fc                   	cld
+  8014e5:	eb bd                	jmp    8014a4 <memmove+0x2a>
+
+008014e7 <memcpy>:
+  8014e7:	55                   	push   %ebp
+  8014e8:	89 e5                	mov    %esp,%ebp
+  8014ea:	53                   	push   %ebx
+  8014eb:	83 ec 04             	sub    $0x4,%esp
+  8014ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8014f1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8014f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014f7:	89 d8                	mov    %ebx,%eax
+  8014f9:	e8 3a fd ff ff       	call   801238 <copy_fwd>
+  8014fe:	89 d8                	mov    %ebx,%eax
+  801500:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801503:	c9                   	leave
+  801504:	c3                   	ret
+
+00801505 <page_copy>:
+  801505:	55                   	push   %ebp
+  801506:	89 e5                	mov    %esp,%ebp
+  801508:	57                   	push   %edi
+  801509:	56                   	push   %esi
+  80150a:	53                   	push   %ebx
+  80150b:	83 ec 0c             	sub    $0xc,%esp
+  80150e:	e8 5c fd ff ff       	call   80126f <have_sse2>
+  801513:	85 c0                	test   %eax,%eax
+  801515:	74 39                	je     801550 <page_copy+0x4b>
+  801517:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80151a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80151d:	be 00 01 00 00       	mov    $0x100,%esi
+  801522:	8b 03                	mov    (%ebx),%eax
+  801524:	8b 53 04             	mov    0x4(%ebx),%edx
+  801527:	0f c3 01             	movnti %eax,(%ecx)
+  80152a:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  80152e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801531:	8b 53 0c             	mov    0xc(%ebx),%edx
+  801534:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  801538:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  80153c:	83 c3 10             	add    $0x10,%ebx
+  80153f:	83 c1 10             	add    $0x10,%ecx
+  801542:	4e                   	dec    %esi
+  801543:	75 dd                	jne    801522 <page_copy+0x1d>
+  801545:	0f ae f8             	sfence
+  801548:	83 c4 0c             	add    $0xc,%esp
+  80154b:	5b                   	pop    %ebx
+  80154c:	5e                   	pop    %esi
+  80154d:	5f                   	pop    %edi
+  80154e:	5d                   	pop    %ebp
+  80154f:	c3                   	ret
+  801550:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801553:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801556:	b9 00 04 00 00       	mov    $0x400,%ecx
+  80155b:	fc                   	cld
+  80155c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80155e:	eb e8                	jmp    801548 <page_copy+0x43>
+
+00801560 <page_zero>:
+  801560:	55                   	push   %ebp
+  801561:	89 e5                	mov    %esp,%ebp
+  801563:	57                   	push   %edi
+  801564:	83 ec 04             	sub    $0x4,%esp
+  801567:	e8 03 fd ff ff       	call   80126f <have_sse2>
+  80156c:	85 c0                	test   %eax,%eax
+  80156e:	74 3a                	je     8015aa <page_zero+0x4a>
+  801570:	8b 45 08             	mov    0x8(%ebp),%eax
+  801573:	ba 80 00 00 00       	mov    $0x80,%edx
+  801578:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80157d:	0f c3 08             	movnti %ecx,(%eax)
+  801580:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  801584:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  801588:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  80158c:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  801590:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  801594:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  801598:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  80159c:	83 c0 20             	add    $0x20,%eax
+  80159f:	4a                   	dec    %edx
+  8015a0:	75 db                	jne    80157d <page_zero+0x1d>
+  8015a2:	0f ae f8             	sfence
+  8015a5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8015a8:	c9                   	leave
+  8015a9:	c3                   	ret
+  8015aa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015ad:	b9 00 04 00 00       	mov    $0x400,%ecx
+  8015b2:	fc                   	cld
+  8015b3:	f3 ab                	rep stos %eax,%es:(%edi)
+  8015b5:	eb ee                	jmp    8015a5 <page_zero+0x45>
+
+008015b7 <memcmp>:
+  8015b7:	55                   	push   %ebp
+  8015b8:	89 e5                	mov    %esp,%ebp
+  8015ba:	56                   	push   %esi
+  8015bb:	53                   	push   %ebx
+  8015bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015c2:	89 c6                	mov    %eax,%esi
+  8015c4:	03 75 10             	add    0x10(%ebp),%esi
+  8015c7:	eb 06                	jmp    8015cf <memcmp+0x18>
+  8015c9:	83 c0 01             	add    $0x1,%eax
+  8015cc:	83 c2 01             	add    $0x1,%edx
+  8015cf:	39 f0                	cmp    %esi,%eax
+  8015d1:	74 14                	je     8015e7 <memcmp+0x30>
+  8015d3:	0f b6 08             	movzbl (%eax),%ecx
+  8015d6:	0f b6 1a             	movzbl (%edx),%ebx
+  8015d9:	38 d9                	cmp    %bl,%cl
+  8015db:	74 ec                	je     8015c9 <memcmp+0x12>
+  8015dd:	0f b6 c1             	movzbl %cl,%eax
+  8015e0:	0f b6 db             	movzbl %bl,%ebx
+  8015e3:	29 d8                	sub    %ebx,%eax
+  8015e5:	eb 05                	jmp    8015ec <memcmp+0x35>
+  8015e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ec:	5b                   	pop    %ebx
+  8015ed:	5e                   	pop    %esi
+  8015ee:	5d                   	pop    %ebp
+  8015ef:	c3                   	ret
+
+008015f0 <memfind>:
+  8015f0:	55                   	push   %ebp
+  8015f1:	89 e5                	mov    %esp,%ebp
+  8015f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f9:	89 c2                	mov    %eax,%edx
+  8015fb:	03 55 10             	add    0x10(%ebp),%edx
+  8015fe:	eb 03                	jmp    801603 <memfind+0x13>
+  801600:	83 c0 01             	add    $0x1,%eax
+  801603:	39 d0                	cmp    %edx,%eax
+  801605:	73 04                	jae    80160b <memfind+0x1b>
+  801607:	38 08                	cmp    %cl,(%eax)
+  801609:	75 f5                	jne    801600 <memfind+0x10>
+  80160b:	5d                   	pop    %ebp
+  80160c:	c3                   	ret
+
+0080160d <strtol>:
+  80160d:	55                   	push   %ebp
+  80160e:	89 e5                	mov    %esp,%ebp
+  801610:	57                   	push   %edi
+  801611:	56                   	push   %esi
+  801612:	53                   	push   %ebx
+  801613:	8b 55 08             	mov    0x8(%ebp),%edx
+  801616:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801619:	eb 03                	jmp    80161e <strtol+0x11>
+  80161b:	83 c2 01             	add    $0x1,%edx
+  80161e:	0f b6 02             	movzbl (%edx),%eax
+  801621:	3c 20                	cmp    $0x20,%al
+  801623:	74 f6                	je     80161b <strtol+0xe>
+  801625:	3c 09                	cmp    $0x9,%al
+  801627:	74 f2                	je     80161b <strtol+0xe>
+  801629:	3c 2b                	cmp    $0x2b,%al
+  80162b:	74 2a                	je     801657 <strtol+0x4a>
+  80162d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801632:	3c 2d                	cmp    $0x2d,%al
+  801634:	74 2b                	je     801661 <strtol+0x54>
+  801636:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80163c:	75 0f                	jne    80164d <strtol+0x40>
+  80163e:	80 3a 30             	cmpb   $0x30,(%edx)
+  801641:	74 28                	je     80166b <strtol+0x5e>
+  801643:	85 db                	test   %ebx,%ebx
+  801645:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80164a:	0f 44 d8             	cmove  %eax,%ebx
+  80164d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801652:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801655:	eb 46                	jmp    80169d <strtol+0x90>
+  801657:	83 c2 01             	add    $0x1,%edx
+  80165a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80165f:	eb d5                	jmp    801636 <strtol+0x29>
+  801661:	83 c2 01             	add    $0x1,%edx
+  801664:	bf 01 00 00 00       	mov    $0x1,%edi
+  801669:	eb cb                	jmp    801636 <strtol+0x29>
+  80166b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80166f:	74 0e                	je     80167f <strtol+0x72>
+  801671:	85 db                	test   %ebx,%ebx
+  801673:	75 d8                	jne    80164d <strtol+0x40>
+  801675:	83 c2 01             	add    $0x1,%edx
+  801678:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80167d:	eb ce                	jmp    80164d <strtol+0x40>
+  80167f:	83 c2 02             	add    $0x2,%edx
+  801682:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801687:	eb c4                	jmp    80164d <strtol+0x40>
+  801689:	0f be c0             	movsbl %al,%eax
+  80168c:	83 e8 30             	sub    $0x30,%eax
+  80168f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801692:	7d 3a                	jge    8016ce <strtol+0xc1>
+  801694:	83 c2 01             	add    $0x1,%edx
+  801697:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80169b:	01 c1                	add    %eax,%ecx
+  80169d:	0f b6 02             	movzbl (%edx),%eax
+  8016a0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8016a3:	89 f3                	mov    %esi,%ebx
+  8016a5:	80 fb 09             	cmp    $0x9,%bl
+  8016a8:	76 df                	jbe    801689 <strtol+0x7c>
+  8016aa:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8016ad:	89 f3                	mov    %esi,%ebx
+  8016af:	80 fb 19             	cmp    $0x19,%bl
+  8016b2:	77 08                	ja     8016bc <strtol+0xaf>
+  8016b4:	0f be c0             	movsbl %al,%eax
+  8016b7:	83 e8 57             	sub    $0x57,%eax
+  8016ba:	eb d3                	jmp    80168f <strtol+0x82>
+  8016bc:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8016bf:	89 f3                	mov    %esi,%ebx
+  8016c1:	80 fb 19             	cmp    $0x19,%bl
+  8016c4:	77 08                	ja     8016ce <strtol+0xc1>
+  8016c6:	0f be c0             	movsbl %al,%eax
+  8016c9:	83 e8 37             	sub    $0x37,%eax
+  8016cc:	eb c1                	jmp    80168f <strtol+0x82>
+  8016ce:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8016d2:	74 05                	je     8016d9 <strtol+0xcc>
+  8016d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016d7:	89 10                	mov    %edx,(%eax)
+  8016d9:	89 c8                	mov    %ecx,%eax
+  8016db:	f7 d8                	neg    %eax
+  8016dd:	85 ff                	test   %edi,%edi
+  8016df:	0f 45 c8             	cmovne %eax,%ecx
+  8016e2:	89 c8                	mov    %ecx,%eax
+  8016e4:	5b                   	pop    %ebx
+  8016e5:	5e                   	pop    %esi
+  8016e6:	5f                   	pop    %edi
+  8016e7:	5d                   	pop    %ebp
+  8016e8:	c3                   	ret
+
+008016e9 <__udivdi3>:
+  8016e9:	57                   	push   %edi
+  8016ea:	56                   	push   %esi
+  8016eb:	53                   	push   %ebx
+  8016ec:	83 ec 20             	sub    $0x20,%esp
+  8016ef:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8016f3:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8016f7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8016fb:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8016ff:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801703:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801707:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80170b:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80170f:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801713:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801717:	89 d1                	mov    %edx,%ecx
+  801719:	09 c1                	or     %eax,%ecx
+  80171b:	0f 84 91 00 00 00    	je     8017b2 <__udivdi3+0xc9>
+  801721:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801728:	00 
+  801729:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801730:	00 
+  801731:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801736:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801740:	eb 08                	jmp    80174a <__udivdi3+0x61>
+  801742:	83 e9 01             	sub    $0x1,%ecx
+  801745:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801748:	74 68                	je     8017b2 <__udivdi3+0xc9>
+  80174a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80174e:	01 c0                	add    %eax,%eax
+  801750:	89 c6                	mov    %eax,%esi
+  801752:	89 d7                	mov    %edx,%edi
+  801754:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801758:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80175c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80175f:	d3 ea                	shr    %cl,%edx
+  801761:	f6 c1 20             	test   $0x20,%cl
+  801764:	74 04                	je     80176a <__udivdi3+0x81>
+  801766:	89 d0                	mov    %edx,%eax
+  801768:	31 d2                	xor    %edx,%edx
+  80176a:	83 e0 01             	and    $0x1,%eax
+  80176d:	89 04 24             	mov    %eax,(%esp)
+  801770:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801777:	00 
+  801778:	8b 04 24             	mov    (%esp),%eax
+  80177b:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80177f:	09 f0                	or     %esi,%eax
+  801781:	09 fa                	or     %edi,%edx
+  801783:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801787:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80178b:	39 f0                	cmp    %esi,%eax
+  80178d:	89 d3                	mov    %edx,%ebx
+  80178f:	19 fb                	sbb    %edi,%ebx
+  801791:	72 af                	jb     801742 <__udivdi3+0x59>
+  801793:	29 f0                	sub    %esi,%eax
+  801795:	19 fa                	sbb    %edi,%edx
+  801797:	89 cf                	mov    %ecx,%edi
+  801799:	c1 ef 05             	shr    $0x5,%edi
+  80179c:	83 e7 01             	and    $0x1,%edi
+  80179f:	89 fe                	mov    %edi,%esi
+  8017a1:	83 f6 01             	xor    $0x1,%esi
+  8017a4:	d3 e6                	shl    %cl,%esi
+  8017a6:	d3 e7                	shl    %cl,%edi
+  8017a8:	09 74 24 18          	or     %esi,0x18(%esp)
+  8017ac:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8017b0:	eb 90                	jmp    801742 <__udivdi3+0x59>
+  8017b2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8017b6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8017ba:	83 c4 20             	add    $0x20,%esp
+  8017bd:	5b                   	pop    %ebx
+  8017be:	5e                   	pop    %esi
+  8017bf:	5f                   	pop    %edi
+  8017c0:	c3                   	ret
+
+008017c1 <__umoddi3>:
+  8017c1:	55                   	push   %ebp
+  8017c2:	57                   	push   %edi
+  8017c3:	56                   	push   %esi
+  8017c4:	53                   	push   %ebx
+  8017c5:	83 ec 1c             	sub    $0x1c,%esp
+  8017c8:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8017cc:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8017d0:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8017d4:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8017d8:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8017dc:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8017e0:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8017e4:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8017e8:	89 d6                	mov    %edx,%esi
+  8017ea:	09 c6                	or     %eax,%esi
+  8017ec:	74 6c                	je     80185a <__umoddi3+0x99>
+  8017ee:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8017f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017fd:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801801:	eb 0e                	jmp    801811 <__umoddi3+0x50>
+  801803:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801808:	8b 74 24 04          	mov    0x4(%esp),%esi
+  80180c:	83 fe ff             	cmp    $0xffffffff,%esi
+  80180f:	74 49                	je     80185a <__umoddi3+0x99>
+  801811:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801815:	01 c0                	add    %eax,%eax
+  801817:	89 c3                	mov    %eax,%ebx
+  801819:	89 d6                	mov    %edx,%esi
+  80181b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80181f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801823:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801828:	0f ad d0             	shrd   %cl,%edx,%eax
+  80182b:	d3 ea                	shr    %cl,%edx
+  80182d:	f6 c1 20             	test   $0x20,%cl
+  801830:	74 04                	je     801836 <__umoddi3+0x75>
+  801832:	89 d0                	mov    %edx,%eax
+  801834:	31 d2                	xor    %edx,%edx
+  801836:	83 e0 01             	and    $0x1,%eax
+  801839:	bd 00 00 00 00       	mov    $0x0,%ebp
+  80183e:	89 ea                	mov    %ebp,%edx
+  801840:	09 d8                	or     %ebx,%eax
+  801842:	09 f2                	or     %esi,%edx
+  801844:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801848:	8b 74 24 14          	mov    0x14(%esp),%esi
+  80184c:	39 d8                	cmp    %ebx,%eax
+  80184e:	89 d1                	mov    %edx,%ecx
+  801850:	19 f1                	sbb    %esi,%ecx
+  801852:	72 af                	jb     801803 <__umoddi3+0x42>
+  801854:	29 d8                	sub    %ebx,%eax
+  801856:	19 f2                	sbb    %esi,%edx
+  801858:	eb a9                	jmp    801803 <__umoddi3+0x42>
+  80185a:	83 c4 1c             	add    $0x1c,%esp
+  80185d:	5b                   	pop    %ebx
+  80185e:	5e                   	pop    %esi
+  80185f:	5f                   	pop    %edi
+  801860:	5d                   	pop    %ebp
+  801861:	c3                   	ret
+
+00801862 <__divdi3>:
+  801862:	53                   	push   %ebx
+  801863:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801867:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80186b:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80186f:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801873:	85 d2                	test   %edx,%edx
+  801875:	78 12                	js     801889 <__divdi3+0x27>
+  801877:	85 db                	test   %ebx,%ebx
+  801879:	78 2e                	js     8018a9 <__divdi3+0x47>
+  80187b:	53                   	push   %ebx
+  80187c:	51                   	push   %ecx
+  80187d:	52                   	push   %edx
+  80187e:	50                   	push   %eax
+  80187f:	e8 65 fe ff ff       	call   8016e9 <__udivdi3>
+  801884:	83 c4 10             	add    $0x10,%esp
+  801887:	eb 1e                	jmp    8018a7 <__divdi3+0x45>
+  801889:	f7 d8                	neg    %eax
+  80188b:	83 d2 00             	adc    $0x0,%edx
+  80188e:	f7 da                	neg    %edx
+  801890:	85 db                	test   %ebx,%ebx
+  801892:	78 2a                	js     8018be <__divdi3+0x5c>
+  801894:	53                   	push   %ebx
+  801895:	51                   	push   %ecx
+  801896:	52                   	push   %edx
+  801897:	50                   	push   %eax
+  801898:	e8 4c fe ff ff       	call   8016e9 <__udivdi3>
+  80189d:	83 c4 10             	add    $0x10,%esp
+  8018a0:	f7 d8                	neg    %eax
+  8018a2:	83 d2 00             	adc    $0x0,%edx
+  8018a5:	f7 da                	neg    %edx
+  8018a7:	5b                   	pop    %ebx
+  8018a8:	c3                   	ret
+  8018a9:	f7 d9                	neg    %ecx
+  8018ab:	83 d3 00             	adc    $0x0,%ebx
+  8018ae:	f7 db                	neg    %ebx
+  8018b0:	53                   	push   %ebx
+  8018b1:	51                   	push   %ecx
+  8018b2:	52                   	push   %edx
+  8018b3:	50                   	push   %eax
+  8018b4:	e8 30 fe ff ff       	call   8016e9 <__udivdi3>
+  8018b9:	83 c4 10             	add    $0x10,%esp
+  8018bc:	eb e2                	jmp    8018a0 <__divdi3+0x3e>
+  8018be:	f7 d9                	neg    %ecx
+  8018c0:	83 d3 00             	adc    $0x0,%ebx
+  8018c3:	f7 db                	neg    %ebx
+  8018c5:	53                   	push   %ebx
+  8018c6:	51                   	push   %ecx
+  8018c7:	52                   	push   %edx
+  8018c8:	50                   	push   %eax
+  8018c9:	e8 1b fe ff ff       	call   8016e9 <__udivdi3>
+  8018ce:	83 c4 10             	add    $0x10,%esp
+  8018d1:	eb d4                	jmp    8018a7 <__divdi3+0x45>
+
+008018d3 <__moddi3>:
+  8018d3:	55                   	push   %ebp
+  8018d4:	57                   	push   %edi
+  8018d5:	56                   	push   %esi
+  8018d6:	53                   	push   %ebx
+  8018d7:	83 ec 14             	sub    $0x14,%esp
+  8018da:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  8018de:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  8018e2:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8018e6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8018ea:	85 ed                	test   %ebp,%ebp
+  8018ec:	78 2b                	js     801919 <__moddi3+0x46>
+  8018ee:	89 c6                	mov    %eax,%esi
+  8018f0:	f7 de                	neg    %esi
+  8018f2:	89 34 24             	mov    %esi,(%esp)
+  8018f5:	89 d6                	mov    %edx,%esi
+  8018f7:	83 d6 00             	adc    $0x0,%esi
+  8018fa:	f7 de                	neg    %esi
+  8018fc:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801900:	8b 34 24             	mov    (%esp),%esi
+  801903:	0f 48 f0             	cmovs  %eax,%esi
+  801906:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  80190b:	52                   	push   %edx
+  80190c:	56                   	push   %esi
+  80190d:	55                   	push   %ebp
+  80190e:	57                   	push   %edi
+  80190f:	e8 ad fe ff ff       	call   8017c1 <__umoddi3>
+  801914:	83 c4 10             	add    $0x10,%esp
+  801917:	eb 3c                	jmp    801955 <__moddi3+0x82>
+  801919:	89 c3                	mov    %eax,%ebx
+  80191b:	f7 db                	neg    %ebx
+  80191d:	89 d1                	mov    %edx,%ecx
+  80191f:	83 d1 00             	adc    $0x0,%ecx
+  801922:	f7 d9                	neg    %ecx
+  801924:	0f 49 c3             	cmovns %ebx,%eax
+  801927:	89 04 24             	mov    %eax,(%esp)
+  80192a:	0f 49 d1             	cmovns %ecx,%edx
+  80192d:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801931:	ff 74 24 04          	push   0x4(%esp)
+  801935:	ff 74 24 04          	push   0x4(%esp)
+  801939:	89 f8                	mov    %edi,%eax
+  80193b:	89 ea                	mov    %ebp,%edx
+  80193d:	f7 d8                	neg    %eax
+  80193f:	83 d2 00             	adc    $0x0,%edx
+  801942:	f7 da                	neg    %edx
+  801944:	52                   	push   %edx
+  801945:	50                   	push   %eax
+  801946:	e8 76 fe ff ff       	call   8017c1 <__umoddi3>
+  80194b:	83 c4 10             	add    $0x10,%esp
+  80194e:	f7 d8                	neg    %eax
+  801950:	83 d2 00             	adc    $0x0,%edx
+  801953:	f7 da                	neg    %edx
+  801955:	83 c4 14             	add    $0x14,%esp
+  801958:	5b                   	pop    %ebx
+  801959:	5e                   	pop    %esi
+  80195a:	5f                   	pop    %edi
+  80195b:	5d                   	pop    %ebp
+  80195c:	c3                   	ret
@@ -0,0 +1,2567 @@
+
+obj/user/breakpoint:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 04 00 00 00       	call   800035 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	cc                   	int3
+  800034:	c3                   	ret
+
+00800035 <libmain>:
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800040:	e8 cb 09 00 00       	call   800a10 <uinfo_envid>
+  800045:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80004a:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  800050:	05 00 00 00 ed       	add    $0xed000000,%eax
+  800055:	a3 20 20 80 00       	mov    %eax,0x802020
+  80005a:	85 db                	test   %ebx,%ebx
+  80005c:	7e 07                	jle    800065 <libmain+0x30>
+  80005e:	8b 06                	mov    (%esi),%eax
+  800060:	a3 00 20 80 00       	mov    %eax,0x802000
+  800065:	83 ec 08             	sub    $0x8,%esp
+  800068:	56                   	push   %esi
+  800069:	53                   	push   %ebx
+  80006a:	e8 c4 ff ff ff       	call   800033 <umain>
+  80006f:	e8 0a 00 00 00       	call   80007e <exit>
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007a:	5b                   	pop    %ebx
+  80007b:	5e                   	pop    %esi
+  80007c:	5d                   	pop    %ebp
+  80007d:	c3                   	ret
+
+0080007e <exit>:
+  80007e:	55                   	push   %ebp
+  80007f:	89 e5                	mov    %esp,%ebp
+  800081:	83 ec 08             	sub    $0x8,%esp
+  800084:	e8 20 0a 00 00       	call   800aa9 <bflush>
+  800089:	83 ec 0c             	sub    $0xc,%esp
+  80008c:	6a 00                	push   $0x0
+  80008e:	e8 d3 00 00 00       	call   800166 <sys_env_destroy>
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	c9                   	leave
+  800097:	c3                   	ret
+
+00800098 <sys_cputs>:
+  800098:	55                   	push   %ebp
+  800099:	89 e5                	mov    %esp,%ebp
+  80009b:	57                   	push   %edi
+  80009c:	56                   	push   %esi
+  80009d:	53                   	push   %ebx
+  80009e:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000a5:	78 21                	js     8000c8 <sys_cputs+0x30>
+  8000a7:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000ae:	75 2d                	jne    8000dd <sys_cputs+0x45>
+  8000b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000bb:	89 c3                	mov    %eax,%ebx
+  8000bd:	89 c7                	mov    %eax,%edi
+  8000bf:	89 c6                	mov    %eax,%esi
+  8000c1:	cd 30                	int    $0x30
+  8000c3:	5b                   	pop    %ebx
+  8000c4:	5e                   	pop    %esi
+  8000c5:	5f                   	pop    %edi
+  8000c6:	5d                   	pop    %ebp
+  8000c7:	c3                   	ret
+  8000c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000cd:	0f a2                	cpuid
+  8000cf:	c1 ea 0b             	shr    $0xb,%edx
+  8000d2:	83 e2 01             	and    $0x1,%edx
+  8000d5:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8000db:	eb ca                	jmp    8000a7 <sys_cputs+0xf>
+  8000dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000e8:	89 c3                	mov    %eax,%ebx
+  8000ea:	89 c7                	mov    %eax,%edi
+  8000ec:	89 c6                	mov    %eax,%esi
+  8000ee:	55                   	push   %ebp
+  8000ef:	68 f8 00 80 00       	push   $0x8000f8
+  8000f4:	89 e5                	mov    %esp,%ebp
+  8000f6:	0f 34                	sysenter
+  8000f8:	83 c4 04             	add    $0x4,%esp
+  8000fb:	5d                   	pop    %ebp
+  8000fc:	eb c5                	jmp    8000c3 <sys_cputs+0x2b>
+
+008000fe <sys_cgetc>:
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	57                   	push   %edi
+  800102:	56                   	push   %esi
+  800103:	53                   	push   %ebx
+  800104:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80010b:	78 22                	js     80012f <sys_cgetc+0x31>
+  80010d:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800114:	75 2e                	jne    800144 <sys_cgetc+0x46>
+  800116:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800120:	89 d1                	mov    %edx,%ecx
+  800122:	89 d3                	mov    %edx,%ebx
+  800124:	89 d7                	mov    %edx,%edi
+  800126:	89 d6                	mov    %edx,%esi
+  800128:	cd 30                	int    $0x30
+  80012a:	5b                   	pop    %ebx
+  80012b:	5e                   	pop    %esi
+  80012c:	5f                   	pop    %edi
+  80012d:	5d                   	pop    %ebp
+  80012e:	c3                   	ret
+  80012f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800134:	0f a2                	cpuid
+  800136:	c1 ea 0b             	shr    $0xb,%edx
+  800139:	83 e2 01             	and    $0x1,%edx
+  80013c:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800142:	eb c9                	jmp    80010d <sys_cgetc+0xf>
+  800144:	ba 00 00 00 00       	mov    $0x0,%edx
+  800149:	b8 01 00 00 00       	mov    $0x1,%eax
+  80014e:	89 d1                	mov    %edx,%ecx
+  800150:	89 d3                	mov    %edx,%ebx
+  800152:	89 d7                	mov    %edx,%edi
+  800154:	89 d6                	mov    %edx,%esi
+  800156:	55                   	push   %ebp
+  800157:	68 60 01 80 00       	push   $0x800160
+  80015c:	89 e5                	mov    %esp,%ebp
+  80015e:	0f 34                	sysenter
+  800160:	83 c4 04             	add    $0x4,%esp
+  800163:	5d                   	pop    %ebp
+  800164:	eb c4                	jmp    80012a <sys_cgetc+0x2c>
+
+00800166 <sys_env_destroy>:
+  800166:	55                   	push   %ebp
+  800167:	89 e5                	mov    %esp,%ebp
+  800169:	57                   	push   %edi
+  80016a:	56                   	push   %esi
+  80016b:	53                   	push   %ebx
+  80016c:	83 ec 0c             	sub    $0xc,%esp
+  80016f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800176:	78 2a                	js     8001a2 <sys_env_destroy+0x3c>
+  800178:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80017f:	75 36                	jne    8001b7 <sys_env_destroy+0x51>
+  800181:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800186:	b8 03 00 00 00       	mov    $0x3,%eax
+  80018b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80018e:	89 cb                	mov    %ecx,%ebx
+  800190:	89 cf                	mov    %ecx,%edi
+  800192:	89 ce                	mov    %ecx,%esi
+  800194:	cd 30                	int    $0x30
+  800196:	85 c0                	test   %eax,%eax
+  800198:	7f 40                	jg     8001da <sys_env_destroy+0x74>
+  80019a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80019d:	5b                   	pop    %ebx
+  80019e:	5e                   	pop    %esi
+  80019f:	5f                   	pop    %edi
+  8001a0:	5d                   	pop    %ebp
+  8001a1:	c3                   	ret
+  8001a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001a7:	0f a2                	cpuid
+  8001a9:	c1 ea 0b             	shr    $0xb,%edx
+  8001ac:	83 e2 01             	and    $0x1,%edx
+  8001af:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8001b5:	eb c1                	jmp    800178 <sys_env_destroy+0x12>
+  8001b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001bf:	b8 03 00 00 00       	mov    $0x3,%eax
+  8001c4:	89 cb                	mov    %ecx,%ebx
+  8001c6:	89 cf                	mov    %ecx,%edi
+  8001c8:	89 ce                	mov    %ecx,%esi
+  8001ca:	55                   	push   %ebp
+  8001cb:	68 d4 01 80 00       	push   $0x8001d4
+  8001d0:	89 e5                	mov    %esp,%ebp
+  8001d2:	0f 34                	sysenter
+  8001d4:	83 c4 04             	add    $0x4,%esp
+  8001d7:	5d                   	pop    %ebp
+  8001d8:	eb bc                	jmp    800196 <sys_env_destroy+0x30>
+  8001da:	83 ec 0c             	sub    $0xc,%esp
+  8001dd:	50                   	push   %eax
+  8001de:	6a 03                	push   $0x3
+  8001e0:	68 6a 19 80 00       	push   $0x80196a
+  8001e5:	6a 49                	push   $0x49
+  8001e7:	68 87 19 80 00       	push   $0x801987
+  8001ec:	e8 af 09 00 00       	call   800ba0 <_panic>
+
+008001f1 <sys_getenvid>:
+  8001f1:	55                   	push   %ebp
+  8001f2:	89 e5                	mov    %esp,%ebp
+  8001f4:	57                   	push   %edi
+  8001f5:	56                   	push   %esi
+  8001f6:	53                   	push   %ebx
+  8001f7:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8001fe:	78 22                	js     800222 <sys_getenvid+0x31>
+  800200:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800207:	75 2e                	jne    800237 <sys_getenvid+0x46>
+  800209:	ba 00 00 00 00       	mov    $0x0,%edx
+  80020e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800213:	89 d1                	mov    %edx,%ecx
+  800215:	89 d3                	mov    %edx,%ebx
+  800217:	89 d7                	mov    %edx,%edi
+  800219:	89 d6                	mov    %edx,%esi
+  80021b:	cd 30                	int    $0x30
+  80021d:	5b                   	pop    %ebx
+  80021e:	5e                   	pop    %esi
+  80021f:	5f                   	pop    %edi
+  800220:	5d                   	pop    %ebp
+  800221:	c3                   	ret
+  800222:	b8 01 00 00 00       	mov    $0x1,%eax
+  800227:	0f a2                	cpuid
+  800229:	c1 ea 0b             	shr    $0xb,%edx
+  80022c:	83 e2 01             	and    $0x1,%edx
+  80022f:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800235:	eb c9                	jmp    800200 <sys_getenvid+0xf>
+  800237:	ba 00 00 00 00       	mov    $0x0,%edx
+  80023c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800241:	89 d1                	mov    %edx,%ecx
+  800243:	89 d3                	mov    %edx,%ebx
+  800245:	89 d7                	mov    %edx,%edi
+  800247:	89 d6                	mov    %edx,%esi
+  800249:	55                   	push   %ebp
+  80024a:	68 53 02 80 00       	push   $0x800253
+  80024f:	89 e5                	mov    %esp,%ebp
+  800251:	0f 34                	sysenter
+  800253:	83 c4 04             	add    $0x4,%esp
+  800256:	5d                   	pop    %ebp
+  800257:	eb c4                	jmp    80021d <sys_getenvid+0x2c>
+
+00800259 <sys_yield>:
+  800259:	55                   	push   %ebp
+  80025a:	89 e5                	mov    %esp,%ebp
+  80025c:	57                   	push   %edi
+  80025d:	56                   	push   %esi
+  80025e:	53                   	push   %ebx
+  80025f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800266:	78 22                	js     80028a <sys_yield+0x31>
+  800268:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80026f:	75 2e                	jne    80029f <sys_yield+0x46>
+  800271:	ba 00 00 00 00       	mov    $0x0,%edx
+  800276:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80027b:	89 d1                	mov    %edx,%ecx
+  80027d:	89 d3                	mov    %edx,%ebx
+  80027f:	89 d7                	mov    %edx,%edi
+  800281:	89 d6                	mov    %edx,%esi
+  800283:	cd 30                	int    $0x30
+  800285:	5b                   	pop    %ebx
+  800286:	5e                   	pop    %esi
+  800287:	5f                   	pop    %edi
+  800288:	5d                   	pop    %ebp
+  800289:	c3                   	ret
+  80028a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80028f:	0f a2                	cpuid
+  800291:	c1 ea 0b             	shr    $0xb,%edx
+  800294:	83 e2 01             	and    $0x1,%edx
+  800297:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80029d:	eb c9                	jmp    800268 <sys_yield+0xf>
+  80029f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002a9:	89 d1                	mov    %edx,%ecx
+  8002ab:	89 d3                	mov    %edx,%ebx
+  8002ad:	89 d7                	mov    %edx,%edi
+  8002af:	89 d6                	mov    %edx,%esi
+  8002b1:	55                   	push   %ebp
+  8002b2:	68 bb 02 80 00       	push   $0x8002bb
+  8002b7:	89 e5                	mov    %esp,%ebp
+  8002b9:	0f 34                	sysenter
+  8002bb:	83 c4 04             	add    $0x4,%esp
+  8002be:	5d                   	pop    %ebp
+  8002bf:	eb c4                	jmp    800285 <sys_yield+0x2c>
+
+008002c1 <sys_env_set_cow>:
+  8002c1:	55                   	push   %ebp
+  8002c2:	89 e5                	mov    %esp,%ebp
+  8002c4:	57                   	push   %edi
+  8002c5:	56                   	push   %esi
+  8002c6:	53                   	push   %ebx
+  8002c7:	83 ec 0c             	sub    $0xc,%esp
+  8002ca:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8002d1:	78 2b                	js     8002fe <sys_env_set_cow+0x3d>
+  8002d3:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8002da:	75 37                	jne    800313 <sys_env_set_cow+0x52>
+  8002dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8002e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002ec:	89 df                	mov    %ebx,%edi
+  8002ee:	89 de                	mov    %ebx,%esi
+  8002f0:	cd 30                	int    $0x30
+  8002f2:	85 c0                	test   %eax,%eax
+  8002f4:	7f 41                	jg     800337 <sys_env_set_cow+0x76>
+  8002f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f9:	5b                   	pop    %ebx
+  8002fa:	5e                   	pop    %esi
+  8002fb:	5f                   	pop    %edi
+  8002fc:	5d                   	pop    %ebp
+  8002fd:	c3                   	ret
+  8002fe:	b8 01 00 00 00       	mov    $0x1,%eax
+  800303:	0f a2                	cpuid
+  800305:	c1 ea 0b             	shr    $0xb,%edx
+  800308:	83 e2 01             	and    $0x1,%edx
+  80030b:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800311:	eb c0                	jmp    8002d3 <sys_env_set_cow+0x12>
+  800313:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800318:	8b 55 08             	mov    0x8(%ebp),%edx
+  80031b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80031e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800323:	89 df                	mov    %ebx,%edi
+  800325:	89 de                	mov    %ebx,%esi
+  800327:	55                   	push   %ebp
+  800328:	68 31 03 80 00       	push   $0x800331
+  80032d:	89 e5                	mov    %esp,%ebp
+  80032f:	0f 34                	sysenter
+  800331:	83 c4 04             	add    $0x4,%esp
+  800334:	5d                   	pop    %ebp
+  800335:	eb bb                	jmp    8002f2 <sys_env_set_cow+0x31>
+  800337:	83 ec 0c             	sub    $0xc,%esp
+  80033a:	50                   	push   %eax
+  80033b:	6a 0d                	push   $0xd
+  80033d:	68 6a 19 80 00       	push   $0x80196a
+  800342:	6a 49                	push   $0x49
+  800344:	68 87 19 80 00       	push   $0x801987
+  800349:	e8 52 08 00 00       	call   800ba0 <_panic>
+
+0080034e <sys_env_set_quota>:
+  80034e:	55                   	push   %ebp
+  80034f:	89 e5                	mov    %esp,%ebp
+  800351:	57                   	push   %edi
+  800352:	56                   	push   %esi
+  800353:	53                   	push   %ebx
+  800354:	83 ec 0c             	sub    $0xc,%esp
+  800357:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80035e:	78 2b                	js     80038b <sys_env_set_quota+0x3d>
+  800360:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800367:	75 37                	jne    8003a0 <sys_env_set_quota+0x52>
+  800369:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80036e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800373:	8b 55 08             	mov    0x8(%ebp),%edx
+  800376:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800379:	89 df                	mov    %ebx,%edi
+  80037b:	89 de                	mov    %ebx,%esi
+  80037d:	cd 30                	int    $0x30
+  80037f:	85 c0                	test   %eax,%eax
+  800381:	7f 41                	jg     8003c4 <sys_env_set_quota+0x76>
+  800383:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800386:	5b                   	pop    %ebx
+  800387:	5e                   	pop    %esi
+  800388:	5f                   	pop    %edi
+  800389:	5d                   	pop    %ebp
+  80038a:	c3                   	ret
+  80038b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800390:	0f a2                	cpuid
+  800392:	c1 ea 0b             	shr    $0xb,%edx
+  800395:	83 e2 01             	and    $0x1,%edx
+  800398:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80039e:	eb c0                	jmp    800360 <sys_env_set_quota+0x12>
+  8003a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003ab:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003b0:	89 df                	mov    %ebx,%edi
+  8003b2:	89 de                	mov    %ebx,%esi
+  8003b4:	55                   	push   %ebp
+  8003b5:	68 be 03 80 00       	push   $0x8003be
+  8003ba:	89 e5                	mov    %esp,%ebp
+  8003bc:	0f 34                	sysenter
+  8003be:	83 c4 04             	add    $0x4,%esp
+  8003c1:	5d                   	pop    %ebp
+  8003c2:	eb bb                	jmp    80037f <sys_env_set_quota+0x31>
+  8003c4:	83 ec 0c             	sub    $0xc,%esp
+  8003c7:	50                   	push   %eax
+  8003c8:	6a 0f                	push   $0xf
+  8003ca:	68 6a 19 80 00       	push   $0x80196a
+  8003cf:	6a 49                	push   $0x49
+  8003d1:	68 87 19 80 00       	push   $0x801987
+  8003d6:	e8 c5 07 00 00       	call   800ba0 <_panic>
+
+008003db <sys_page_alloc>:
+  8003db:	55                   	push   %ebp
+  8003dc:	89 e5                	mov    %esp,%ebp
+  8003de:	57                   	push   %edi
+  8003df:	56                   	push   %esi
+  8003e0:	53                   	push   %ebx
+  8003e1:	83 ec 0c             	sub    $0xc,%esp
+  8003e4:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8003eb:	78 2c                	js     800419 <sys_page_alloc+0x3e>
+  8003ed:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8003f4:	75 38                	jne    80042e <sys_page_alloc+0x53>
+  8003f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8003fb:	b8 04 00 00 00       	mov    $0x4,%eax
+  800400:	8b 55 08             	mov    0x8(%ebp),%edx
+  800403:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800406:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800409:	89 f7                	mov    %esi,%edi
+  80040b:	cd 30                	int    $0x30
+  80040d:	85 c0                	test   %eax,%eax
+  80040f:	7f 42                	jg     800453 <sys_page_alloc+0x78>
+  800411:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800414:	5b                   	pop    %ebx
+  800415:	5e                   	pop    %esi
+  800416:	5f                   	pop    %edi
+  800417:	5d                   	pop    %ebp
+  800418:	c3                   	ret
+  800419:	b8 01 00 00 00       	mov    $0x1,%eax
+  80041e:	0f a2                	cpuid
+  800420:	c1 ea 0b             	shr    $0xb,%edx
+  800423:	83 e2 01             	and    $0x1,%edx
+  800426:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80042c:	eb bf                	jmp    8003ed <sys_page_alloc+0x12>
+  80042e:	be 00 00 00 00       	mov    $0x0,%esi
+  800433:	8b 55 08             	mov    0x8(%ebp),%edx
+  800436:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800439:	b8 04 00 00 00       	mov    $0x4,%eax
+  80043e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800441:	89 f7                	mov    %esi,%edi
+  800443:	55                   	push   %ebp
+  800444:	68 4d 04 80 00       	push   $0x80044d
+  800449:	89 e5                	mov    %esp,%ebp
+  80044b:	0f 34                	sysenter
+  80044d:	83 c4 04             	add    $0x4,%esp
+  800450:	5d                   	pop    %ebp
+  800451:	eb ba                	jmp    80040d <sys_page_alloc+0x32>
+  800453:	83 ec 0c             	sub    $0xc,%esp
+  800456:	50                   	push   %eax
+  800457:	6a 04                	push   $0x4
+  800459:	68 6a 19 80 00       	push   $0x80196a
+  80045e:	6a 49                	push   $0x49
+  800460:	68 87 19 80 00       	push   $0x801987
+  800465:	e8 36 07 00 00       	call   800ba0 <_panic>
+
+0080046a <sys_page_map>:
+  80046a:	55                   	push   %ebp
+  80046b:	89 e5                	mov    %esp,%ebp
+  80046d:	57                   	push   %edi
+  80046e:	56                   	push   %esi
+  80046f:	53                   	push   %ebx
+  800470:	83 ec 0c             	sub    $0xc,%esp
+  800473:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80047a:	78 2b                	js     8004a7 <sys_page_map+0x3d>
+  80047c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800483:	75 37                	jne    8004bc <sys_page_map+0x52>
+  800485:	b8 05 00 00 00       	mov    $0x5,%eax
+  80048a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80048d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800490:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800493:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800496:	8b 75 18             	mov    0x18(%ebp),%esi
+  800499:	cd 30                	int    $0x30
+  80049b:	85 c0                	test   %eax,%eax
+  80049d:	7f 41                	jg     8004e0 <sys_page_map+0x76>
+  80049f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004a2:	5b                   	pop    %ebx
+  8004a3:	5e                   	pop    %esi
+  8004a4:	5f                   	pop    %edi
+  8004a5:	5d                   	pop    %ebp
+  8004a6:	c3                   	ret
+  8004a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004ac:	0f a2                	cpuid
+  8004ae:	c1 ea 0b             	shr    $0xb,%edx
+  8004b1:	83 e2 01             	and    $0x1,%edx
+  8004b4:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8004ba:	eb c0                	jmp    80047c <sys_page_map+0x12>
+  8004bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8004c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004ca:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004cd:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004d0:	55                   	push   %ebp
+  8004d1:	68 da 04 80 00       	push   $0x8004da
+  8004d6:	89 e5                	mov    %esp,%ebp
+  8004d8:	0f 34                	sysenter
+  8004da:	83 c4 04             	add    $0x4,%esp
+  8004dd:	5d                   	pop    %ebp
+  8004de:	eb bb                	jmp    80049b <sys_page_map+0x31>
+  8004e0:	83 ec 0c             	sub    $0xc,%esp
+  8004e3:	50                   	push   %eax
+  8004e4:	6a 05                	push   $0x5
+  8004e6:	68 6a 19 80 00       	push   $0x80196a
+  8004eb:	6a 49                	push   $0x49
+  8004ed:	68 87 19 80 00       	push   $0x801987
+  8004f2:	e8 a9 06 00 00       	call   800ba0 <_panic>
+
+008004f7 <sys_page_unmap>:
+  8004f7:	55                   	push   %ebp
+  8004f8:	89 e5                	mov    %esp,%ebp
+  8004fa:	57                   	push   %edi
+  8004fb:	56                   	push   %esi
+  8004fc:	53                   	push   %ebx
+  8004fd:	83 ec 0c             	sub    $0xc,%esp
+  800500:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800507:	78 2b                	js     800534 <sys_page_unmap+0x3d>
+  800509:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800510:	75 37                	jne    800549 <sys_page_unmap+0x52>
+  800512:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800517:	b8 06 00 00 00       	mov    $0x6,%eax
+  80051c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80051f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800522:	89 df                	mov    %ebx,%edi
+  800524:	89 de                	mov    %ebx,%esi
+  800526:	cd 30                	int    $0x30
+  800528:	85 c0                	test   %eax,%eax
+  80052a:	7f 41                	jg     80056d <sys_page_unmap+0x76>
+  80052c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80052f:	5b                   	pop    %ebx
+  800530:	5e                   	pop    %esi
+  800531:	5f                   	pop    %edi
+  800532:	5d                   	pop    %ebp
+  800533:	c3                   	ret
+  800534:	b8 01 00 00 00       	mov    $0x1,%eax
+  800539:	0f a2                	cpuid
+  80053b:	c1 ea 0b             	shr    $0xb,%edx
+  80053e:	83 e2 01             	and    $0x1,%edx
+  800541:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800547:	eb c0                	jmp    800509 <sys_page_unmap+0x12>
+  800549:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80054e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800551:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800554:	b8 06 00 00 00       	mov    $0x6,%eax
+  800559:	89 df                	mov    %ebx,%edi
+  80055b:	89 de                	mov    %ebx,%esi
+  80055d:	55                   	push   %ebp
+  80055e:	68 67 05 80 00       	push   $0x800567
+  800563:	89 e5                	mov    %esp,%ebp
+  800565:	0f 34                	sysenter
+  800567:	83 c4 04             	add    $0x4,%esp
+  80056a:	5d                   	pop    %ebp
+  80056b:	eb bb                	jmp    800528 <sys_page_unmap+0x31>
+  80056d:	83 ec 0c             	sub    $0xc,%esp
+  800570:	50                   	push   %eax
+  800571:	6a 06                	push   $0x6
+  800573:	68 6a 19 80 00       	push   $0x80196a
+  800578:	6a 49                	push   $0x49
+  80057a:	68 87 19 80 00       	push   $0x801987
+  80057f:	e8 1c 06 00 00       	call   800ba0 <_panic>
+
+00800584 <sys_page_reuse>:
+  800584:	55                   	push   %ebp
+  800585:	89 e5                	mov    %esp,%ebp
+  800587:	57                   	push   %edi
+  800588:	56                   	push   %esi
+  800589:	53                   	push   %ebx
+  80058a:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800591:	78 24                	js     8005b7 <sys_page_reuse+0x33>
+  800593:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80059a:	75 30                	jne    8005cc <sys_page_reuse+0x48>
+  80059c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005a1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005ac:	89 df                	mov    %ebx,%edi
+  8005ae:	89 de                	mov    %ebx,%esi
+  8005b0:	cd 30                	int    $0x30
+  8005b2:	5b                   	pop    %ebx
+  8005b3:	5e                   	pop    %esi
+  8005b4:	5f                   	pop    %edi
+  8005b5:	5d                   	pop    %ebp
+  8005b6:	c3                   	ret
+  8005b7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005bc:	0f a2                	cpuid
+  8005be:	c1 ea 0b             	shr    $0xb,%edx
+  8005c1:	83 e2 01             	and    $0x1,%edx
+  8005c4:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8005ca:	eb c7                	jmp    800593 <sys_page_reuse+0xf>
+  8005cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005d7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005dc:	89 df                	mov    %ebx,%edi
+  8005de:	89 de                	mov    %ebx,%esi
+  8005e0:	55                   	push   %ebp
+  8005e1:	68 ea 05 80 00       	push   $0x8005ea
+  8005e6:	89 e5                	mov    %esp,%ebp
+  8005e8:	0f 34                	sysenter
+  8005ea:	83 c4 04             	add    $0x4,%esp
+  8005ed:	5d                   	pop    %ebp
+  8005ee:	eb c2                	jmp    8005b2 <sys_page_reuse+0x2e>
+
+008005f0 <sys_env_set_status>:
+  8005f0:	55                   	push   %ebp
+  8005f1:	89 e5                	mov    %esp,%ebp
+  8005f3:	57                   	push   %edi
+  8005f4:	56                   	push   %esi
+  8005f5:	53                   	push   %ebx
+  8005f6:	83 ec 0c             	sub    $0xc,%esp
+  8005f9:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800600:	78 2b                	js     80062d <sys_env_set_status+0x3d>
+  800602:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800609:	75 37                	jne    800642 <sys_env_set_status+0x52>
+  80060b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800610:	b8 08 00 00 00       	mov    $0x8,%eax
+  800615:	8b 55 08             	mov    0x8(%ebp),%edx
+  800618:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80061b:	89 df                	mov    %ebx,%edi
+  80061d:	89 de                	mov    %ebx,%esi
+  80061f:	cd 30                	int    $0x30
+  800621:	85 c0                	test   %eax,%eax
+  800623:	7f 41                	jg     800666 <sys_env_set_status+0x76>
+  800625:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800628:	5b                   	pop    %ebx
+  800629:	5e                   	pop    %esi
+  80062a:	5f                   	pop    %edi
+  80062b:	5d                   	pop    %ebp
+  80062c:	c3                   	ret
+  80062d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800632:	0f a2                	cpuid
+  800634:	c1 ea 0b             	shr    $0xb,%edx
+  800637:	83 e2 01             	and    $0x1,%edx
+  80063a:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800640:	eb c0                	jmp    800602 <sys_env_set_status+0x12>
+  800642:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800647:	8b 55 08             	mov    0x8(%ebp),%edx
+  80064a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80064d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800652:	89 df                	mov    %ebx,%edi
+  800654:	89 de                	mov    %ebx,%esi
+  800656:	55                   	push   %ebp
+  800657:	68 60 06 80 00       	push   $0x800660
+  80065c:	89 e5                	mov    %esp,%ebp
+  80065e:	0f 34                	sysenter
+  800660:	83 c4 04             	add    $0x4,%esp
+  800663:	5d                   	pop    %ebp
+  800664:	eb bb                	jmp    800621 <sys_env_set_status+0x31>
+  800666:	83 ec 0c             	sub    $0xc,%esp
+  800669:	50                   	push   %eax
+  80066a:	6a 08                	push   $0x8
+  80066c:	68 6a 19 80 00       	push   $0x80196a
+  800671:	6a 49                	push   $0x49
+  800673:	68 87 19 80 00       	push   $0x801987
+  800678:	e8 23 05 00 00       	call   800ba0 <_panic>
+
+0080067d <sys_env_set_pgfault_upcall>:
+  80067d:	55                   	push   %ebp
+  80067e:	89 e5                	mov    %esp,%ebp
+  800680:	57                   	push   %edi
+  800681:	56                   	push   %esi
+  800682:	53                   	push   %ebx
+  800683:	83 ec 0c             	sub    $0xc,%esp
+  800686:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80068d:	78 2b                	js     8006ba <sys_env_set_pgfault_upcall+0x3d>
+  80068f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800696:	75 37                	jne    8006cf <sys_env_set_pgfault_upcall+0x52>
+  800698:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80069d:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006a8:	89 df                	mov    %ebx,%edi
+  8006aa:	89 de                	mov    %ebx,%esi
+  8006ac:	cd 30                	int    $0x30
+  8006ae:	85 c0                	test   %eax,%eax
+  8006b0:	7f 41                	jg     8006f3 <sys_env_set_pgfault_upcall+0x76>
+  8006b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006b5:	5b                   	pop    %ebx
+  8006b6:	5e                   	pop    %esi
+  8006b7:	5f                   	pop    %edi
+  8006b8:	5d                   	pop    %ebp
+  8006b9:	c3                   	ret
+  8006ba:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006bf:	0f a2                	cpuid
+  8006c1:	c1 ea 0b             	shr    $0xb,%edx
+  8006c4:	83 e2 01             	and    $0x1,%edx
+  8006c7:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8006cd:	eb c0                	jmp    80068f <sys_env_set_pgfault_upcall+0x12>
+  8006cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006da:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006df:	89 df                	mov    %ebx,%edi
+  8006e1:	89 de                	mov    %ebx,%esi
+  8006e3:	55                   	push   %ebp
+  8006e4:	68 ed 06 80 00       	push   $0x8006ed
+  8006e9:	89 e5                	mov    %esp,%ebp
+  8006eb:	0f 34                	sysenter
+  8006ed:	83 c4 04             	add    $0x4,%esp
+  8006f0:	5d                   	pop    %ebp
+  8006f1:	eb bb                	jmp    8006ae <sys_env_set_pgfault_upcall+0x31>
+  8006f3:	83 ec 0c             	sub    $0xc,%esp
+  8006f6:	50                   	push   %eax
+  8006f7:	6a 09                	push   $0x9
+  8006f9:	68 6a 19 80 00       	push   $0x80196a
+  8006fe:	6a 49                	push   $0x49
+  800700:	68 87 19 80 00       	push   $0x801987
+  800705:	e8 96 04 00 00       	call   800ba0 <_panic>
+
+0080070a <sys_env_set_trace>:
+  80070a:	55                   	push   %ebp
+  80070b:	89 e5                	mov    %esp,%ebp
+  80070d:	57                   	push   %edi
+  80070e:	56                   	push   %esi
+  80070f:	53                   	push   %ebx
+  800710:	83 ec 0c             	sub    $0xc,%esp
+  800713:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80071a:	78 2b                	js     800747 <sys_env_set_trace+0x3d>
+  80071c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800723:	75 37                	jne    80075c <sys_env_set_trace+0x52>
+  800725:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80072a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80072f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800732:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800735:	89 df                	mov    %ebx,%edi
+  800737:	89 de                	mov    %ebx,%esi
+  800739:	cd 30                	int    $0x30
+  80073b:	85 c0                	test   %eax,%eax
+  80073d:	7f 41                	jg     800780 <sys_env_set_trace+0x76>
+  80073f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800742:	5b                   	pop    %ebx
+  800743:	5e                   	pop    %esi
+  800744:	5f                   	pop    %edi
+  800745:	5d                   	pop    %ebp
+  800746:	c3                   	ret
+  800747:	b8 01 00 00 00       	mov    $0x1,%eax
+  80074c:	0f a2                	cpuid
+  80074e:	c1 ea 0b             	shr    $0xb,%edx
+  800751:	83 e2 01             	and    $0x1,%edx
+  800754:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80075a:	eb c0                	jmp    80071c <sys_env_set_trace+0x12>
+  80075c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800761:	8b 55 08             	mov    0x8(%ebp),%edx
+  800764:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800767:	b8 12 00 00 00       	mov    $0x12,%eax
+  80076c:	89 df                	mov    %ebx,%edi
+  80076e:	89 de                	mov    %ebx,%esi
+  800770:	55                   	push   %ebp
+  800771:	68 7a 07 80 00       	push   $0x80077a
+  800776:	89 e5                	mov    %esp,%ebp
+  800778:	0f 34                	sysenter
+  80077a:	83 c4 04             	add    $0x4,%esp
+  80077d:	5d                   	pop    %ebp
+  80077e:	eb bb                	jmp    80073b <sys_env_set_trace+0x31>
+  800780:	83 ec 0c             	sub    $0xc,%esp
+  800783:	50                   	push   %eax
+  800784:	6a 12                	push   $0x12
+  800786:	68 6a 19 80 00       	push   $0x80196a
+  80078b:	6a 49                	push   $0x49
+  80078d:	68 87 19 80 00       	push   $0x801987
+  800792:	e8 09 04 00 00       	call   800ba0 <_panic>
+
+00800797 <sys_env_set_rdpmc>:
+  800797:	55                   	push   %ebp
+  800798:	89 e5                	mov    %esp,%ebp
+  80079a:	57                   	push   %edi
+  80079b:	56                   	push   %esi
+  80079c:	53                   	push   %ebx
+  80079d:	83 ec 0c             	sub    $0xc,%esp
+  8007a0:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007a7:	78 2b                	js     8007d4 <sys_env_set_rdpmc+0x3d>
+  8007a9:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007b0:	75 37                	jne    8007e9 <sys_env_set_rdpmc+0x52>
+  8007b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007b7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8007bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007c2:	89 df                	mov    %ebx,%edi
+  8007c4:	89 de                	mov    %ebx,%esi
+  8007c6:	cd 30                	int    $0x30
+  8007c8:	85 c0                	test   %eax,%eax
+  8007ca:	7f 41                	jg     80080d <sys_env_set_rdpmc+0x76>
+  8007cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007cf:	5b                   	pop    %ebx
+  8007d0:	5e                   	pop    %esi
+  8007d1:	5f                   	pop    %edi
+  8007d2:	5d                   	pop    %ebp
+  8007d3:	c3                   	ret
+  8007d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007d9:	0f a2                	cpuid
+  8007db:	c1 ea 0b             	shr    $0xb,%edx
+  8007de:	83 e2 01             	and    $0x1,%edx
+  8007e1:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8007e7:	eb c0                	jmp    8007a9 <sys_env_set_rdpmc+0x12>
+  8007e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8007f9:	89 df                	mov    %ebx,%edi
+  8007fb:	89 de                	mov    %ebx,%esi
+  8007fd:	55                   	push   %ebp
+  8007fe:	68 07 08 80 00       	push   $0x800807
+  800803:	89 e5                	mov    %esp,%ebp
+  800805:	0f 34                	sysenter
+  800807:	83 c4 04             	add    $0x4,%esp
+  80080a:	5d                   	pop    %ebp
+  80080b:	eb bb                	jmp    8007c8 <sys_env_set_rdpmc+0x31>
+  80080d:	83 ec 0c             	sub    $0xc,%esp
+  800810:	50                   	push   %eax
+  800811:	6a 13                	push   $0x13
+  800813:	68 6a 19 80 00       	push   $0x80196a
+  800818:	6a 49                	push   $0x49
+  80081a:	68 87 19 80 00       	push   $0x801987
+  80081f:	e8 7c 03 00 00       	call   800ba0 <_panic>
+
+00800824 <sys_ring_setup>:
+  800824:	55                   	push   %ebp
+  800825:	89 e5                	mov    %esp,%ebp
+  800827:	57                   	push   %edi
+  800828:	56                   	push   %esi
+  800829:	53                   	push   %ebx
+  80082a:	83 ec 0c             	sub    $0xc,%esp
+  80082d:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800834:	78 29                	js     80085f <sys_ring_setup+0x3b>
+  800836:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80083d:	75 35                	jne    800874 <sys_ring_setup+0x50>
+  80083f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800844:	b8 10 00 00 00       	mov    $0x10,%eax
+  800849:	89 d1                	mov    %edx,%ecx
+  80084b:	89 d3                	mov    %edx,%ebx
+  80084d:	89 d7                	mov    %edx,%edi
+  80084f:	89 d6                	mov    %edx,%esi
+  800851:	cd 30                	int    $0x30
+  800853:	85 c0                	test   %eax,%eax
+  800855:	7f 3f                	jg     800896 <sys_ring_setup+0x72>
+  800857:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80085a:	5b                   	pop    %ebx
+  80085b:	5e                   	pop    %esi
+  80085c:	5f                   	pop    %edi
+  80085d:	5d                   	pop    %ebp
+  80085e:	c3                   	ret
+  80085f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800864:	0f a2                	cpuid
+  800866:	c1 ea 0b             	shr    $0xb,%edx
+  800869:	83 e2 01             	and    $0x1,%edx
+  80086c:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800872:	eb c2                	jmp    800836 <sys_ring_setup+0x12>
+  800874:	ba 00 00 00 00       	mov    $0x0,%edx
+  800879:	b8 10 00 00 00       	mov    $0x10,%eax
+  80087e:	89 d1                	mov    %edx,%ecx
+  800880:	89 d3                	mov    %edx,%ebx
+  800882:	89 d7                	mov    %edx,%edi
+  800884:	89 d6                	mov    %edx,%esi
+  800886:	55                   	push   %ebp
+  800887:	68 90 08 80 00       	push   $0x800890
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	0f 34                	sysenter
+  800890:	83 c4 04             	add    $0x4,%esp
+  800893:	5d                   	pop    %ebp
+  800894:	eb bd                	jmp    800853 <sys_ring_setup+0x2f>
+  800896:	83 ec 0c             	sub    $0xc,%esp
+  800899:	50                   	push   %eax
+  80089a:	6a 10                	push   $0x10
+  80089c:	68 6a 19 80 00       	push   $0x80196a
+  8008a1:	6a 49                	push   $0x49
+  8008a3:	68 87 19 80 00       	push   $0x801987
+  8008a8:	e8 f3 02 00 00       	call   800ba0 <_panic>
+
+008008ad <sys_ring_enter>:
+  8008ad:	55                   	push   %ebp
+  8008ae:	89 e5                	mov    %esp,%ebp
+  8008b0:	57                   	push   %edi
+  8008b1:	56                   	push   %esi
+  8008b2:	53                   	push   %ebx
+  8008b3:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008ba:	78 22                	js     8008de <sys_ring_enter+0x31>
+  8008bc:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008c3:	75 2e                	jne    8008f3 <sys_ring_enter+0x46>
+  8008c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008ca:	b8 11 00 00 00       	mov    $0x11,%eax
+  8008cf:	89 d1                	mov    %edx,%ecx
+  8008d1:	89 d3                	mov    %edx,%ebx
+  8008d3:	89 d7                	mov    %edx,%edi
+  8008d5:	89 d6                	mov    %edx,%esi
+  8008d7:	cd 30                	int    $0x30
+  8008d9:	5b                   	pop    %ebx
+  8008da:	5e                   	pop    %esi
+  8008db:	5f                   	pop    %edi
+  8008dc:	5d                   	pop    %ebp
+  8008dd:	c3                   	ret
+  8008de:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008e3:	0f a2                	cpuid
+  8008e5:	c1 ea 0b             	shr    $0xb,%edx
+  8008e8:	83 e2 01             	and    $0x1,%edx
+  8008eb:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8008f1:	eb c9                	jmp    8008bc <sys_ring_enter+0xf>
+  8008f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008f8:	b8 11 00 00 00       	mov    $0x11,%eax
+  8008fd:	89 d1                	mov    %edx,%ecx
+  8008ff:	89 d3                	mov    %edx,%ebx
+  800901:	89 d7                	mov    %edx,%edi
+  800903:	89 d6                	mov    %edx,%esi
+  800905:	55                   	push   %ebp
+  800906:	68 0f 09 80 00       	push   $0x80090f
+  80090b:	89 e5                	mov    %esp,%ebp
+  80090d:	0f 34                	sysenter
+  80090f:	83 c4 04             	add    $0x4,%esp
+  800912:	5d                   	pop    %ebp
+  800913:	eb c4                	jmp    8008d9 <sys_ring_enter+0x2c>
+
+00800915 <sys_ipc_try_send>:
+  800915:	55                   	push   %ebp
+  800916:	89 e5                	mov    %esp,%ebp
+  800918:	57                   	push   %edi
+  800919:	56                   	push   %esi
+  80091a:	53                   	push   %ebx
+  80091b:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800922:	78 26                	js     80094a <sys_ipc_try_send+0x35>
+  800924:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80092b:	75 32                	jne    80095f <sys_ipc_try_send+0x4a>
+  80092d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800932:	be 00 00 00 00       	mov    $0x0,%esi
+  800937:	8b 55 08             	mov    0x8(%ebp),%edx
+  80093a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80093d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800940:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800943:	cd 30                	int    $0x30
+  800945:	5b                   	pop    %ebx
+  800946:	5e                   	pop    %esi
+  800947:	5f                   	pop    %edi
+  800948:	5d                   	pop    %ebp
+  800949:	c3                   	ret
+  80094a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80094f:	0f a2                	cpuid
+  800951:	c1 ea 0b             	shr    $0xb,%edx
+  800954:	83 e2 01             	and    $0x1,%edx
+  800957:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80095d:	eb c5                	jmp    800924 <sys_ipc_try_send+0xf>
+  80095f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800962:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800965:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80096a:	be 00 00 00 00       	mov    $0x0,%esi
+  80096f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800972:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800975:	55                   	push   %ebp
+  800976:	68 7f 09 80 00       	push   $0x80097f
+  80097b:	89 e5                	mov    %esp,%ebp
+  80097d:	0f 34                	sysenter
+  80097f:	83 c4 04             	add    $0x4,%esp
+  800982:	5d                   	pop    %ebp
+  800983:	eb c0                	jmp    800945 <sys_ipc_try_send+0x30>
+
+00800985 <sys_ipc_recv>:
+  800985:	55                   	push   %ebp
+  800986:	89 e5                	mov    %esp,%ebp
+  800988:	57                   	push   %edi
+  800989:	56                   	push   %esi
+  80098a:	53                   	push   %ebx
+  80098b:	83 ec 0c             	sub    $0xc,%esp
+  80098e:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800995:	78 2a                	js     8009c1 <sys_ipc_recv+0x3c>
+  800997:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80099e:	75 36                	jne    8009d6 <sys_ipc_recv+0x51>
+  8009a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009a5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009ad:	89 cb                	mov    %ecx,%ebx
+  8009af:	89 cf                	mov    %ecx,%edi
+  8009b1:	89 ce                	mov    %ecx,%esi
+  8009b3:	cd 30                	int    $0x30
+  8009b5:	85 c0                	test   %eax,%eax
+  8009b7:	7f 40                	jg     8009f9 <sys_ipc_recv+0x74>
+  8009b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009bc:	5b                   	pop    %ebx
+  8009bd:	5e                   	pop    %esi
+  8009be:	5f                   	pop    %edi
+  8009bf:	5d                   	pop    %ebp
+  8009c0:	c3                   	ret
+  8009c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8009c6:	0f a2                	cpuid
+  8009c8:	c1 ea 0b             	shr    $0xb,%edx
+  8009cb:	83 e2 01             	and    $0x1,%edx
+  8009ce:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8009d4:	eb c1                	jmp    800997 <sys_ipc_recv+0x12>
+  8009d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009de:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009e3:	89 cb                	mov    %ecx,%ebx
+  8009e5:	89 cf                	mov    %ecx,%edi
+  8009e7:	89 ce                	mov    %ecx,%esi
+  8009e9:	55                   	push   %ebp
+  8009ea:	68 f3 09 80 00       	push   $0x8009f3
+  8009ef:	89 e5                	mov    %esp,%ebp
+  8009f1:	0f 34                	sysenter
+  8009f3:	83 c4 04             	add    $0x4,%esp
+  8009f6:	5d                   	pop    %ebp
+  8009f7:	eb bc                	jmp    8009b5 <sys_ipc_recv+0x30>
+  8009f9:	83 ec 0c             	sub    $0xc,%esp
+  8009fc:	50                   	push   %eax
+  8009fd:	6a 0c                	push   $0xc
+  8009ff:	68 6a 19 80 00       	push   $0x80196a
+  800a04:	6a 49                	push   $0x49
+  800a06:	68 87 19 80 00       	push   $0x801987
+  800a0b:	e8 90 01 00 00       	call   800ba0 <_panic>
+
+00800a10 <uinfo_envid>:
+  800a10:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  800a15:	c3                   	ret
+
+00800a16 <uinfo_cpunum>:
+  800a16:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  800a1b:	c3                   	ret
+
+00800a1c <uinfo_ticks>:
+  800a1c:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  800a21:	c3                   	ret
+
+00800a22 <uinfo_nsec>:
+  800a22:	55                   	push   %ebp
+  800a23:	89 e5                	mov    %esp,%ebp
+  800a25:	57                   	push   %edi
+  800a26:	56                   	push   %esi
+  800a27:	53                   	push   %ebx
+  800a28:	83 ec 1c             	sub    $0x1c,%esp
+  800a2b:	0f 31                	rdtsc
+  800a2d:	89 c6                	mov    %eax,%esi
+  800a2f:	89 d7                	mov    %edx,%edi
+  800a31:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  800a37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a41:	85 c9                	test   %ecx,%ecx
+  800a43:	74 5c                	je     800aa1 <uinfo_nsec+0x7f>
+  800a45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a4a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800a4d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800a50:	52                   	push   %edx
+  800a51:	51                   	push   %ecx
+  800a52:	57                   	push   %edi
+  800a53:	56                   	push   %esi
+  800a54:	e8 63 0d 00 00       	call   8017bc <__umoddi3>
+  800a59:	83 c4 10             	add    $0x10,%esp
+  800a5c:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800a62:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  800a67:	f7 e3                	mul    %ebx
+  800a69:	01 ca                	add    %ecx,%edx
+  800a6b:	ff 75 e4             	push   -0x1c(%ebp)
+  800a6e:	ff 75 e0             	push   -0x20(%ebp)
+  800a71:	52                   	push   %edx
+  800a72:	50                   	push   %eax
+  800a73:	e8 6c 0c 00 00       	call   8016e4 <__udivdi3>
+  800a78:	83 c4 10             	add    $0x10,%esp
+  800a7b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a7e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a81:	ff 75 e4             	push   -0x1c(%ebp)
+  800a84:	ff 75 e0             	push   -0x20(%ebp)
+  800a87:	57                   	push   %edi
+  800a88:	56                   	push   %esi
+  800a89:	e8 56 0c 00 00       	call   8016e4 <__udivdi3>
+  800a8e:	83 c4 10             	add    $0x10,%esp
+  800a91:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800a97:	f7 e3                	mul    %ebx
+  800a99:	01 ca                	add    %ecx,%edx
+  800a9b:	03 45 d8             	add    -0x28(%ebp),%eax
+  800a9e:	13 55 dc             	adc    -0x24(%ebp),%edx
+  800aa1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aa4:	5b                   	pop    %ebx
+  800aa5:	5e                   	pop    %esi
+  800aa6:	5f                   	pop    %edi
+  800aa7:	5d                   	pop    %ebp
+  800aa8:	c3                   	ret
+
+00800aa9 <bflush>:
+  800aa9:	a1 40 20 80 00       	mov    0x802040,%eax
+  800aae:	85 c0                	test   %eax,%eax
+  800ab0:	75 01                	jne    800ab3 <bflush+0xa>
+  800ab2:	c3                   	ret
+  800ab3:	55                   	push   %ebp
+  800ab4:	89 e5                	mov    %esp,%ebp
+  800ab6:	83 ec 10             	sub    $0x10,%esp
+  800ab9:	50                   	push   %eax
+  800aba:	68 44 20 80 00       	push   $0x802044
+  800abf:	e8 d4 f5 ff ff       	call   800098 <sys_cputs>
+  800ac4:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  800acb:	00 00 00 
+  800ace:	83 c4 10             	add    $0x10,%esp
+  800ad1:	c9                   	leave
+  800ad2:	c3                   	ret
+
+00800ad3 <bputch>:
+  800ad3:	55                   	push   %ebp
+  800ad4:	89 e5                	mov    %esp,%ebp
+  800ad6:	53                   	push   %ebx
+  800ad7:	83 ec 04             	sub    $0x4,%esp
+  800ada:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800add:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  800ae3:	8d 42 01             	lea    0x1(%edx),%eax
+  800ae6:	a3 40 20 80 00       	mov    %eax,0x802040
+  800aeb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aee:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  800af4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800af9:	77 08                	ja     800b03 <bputch+0x30>
+  800afb:	83 03 01             	addl   $0x1,(%ebx)
+  800afe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b01:	c9                   	leave
+  800b02:	c3                   	ret
+  800b03:	e8 a1 ff ff ff       	call   800aa9 <bflush>
+  800b08:	eb f1                	jmp    800afb <bputch+0x28>
+
+00800b0a <vbprintf>:
+  800b0a:	55                   	push   %ebp
+  800b0b:	89 e5                	mov    %esp,%ebp
+  800b0d:	83 ec 18             	sub    $0x18,%esp
+  800b10:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800b17:	ff 75 0c             	push   0xc(%ebp)
+  800b1a:	ff 75 08             	push   0x8(%ebp)
+  800b1d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b20:	50                   	push   %eax
+  800b21:	68 d3 0a 80 00       	push   $0x800ad3
+  800b26:	e8 4c 02 00 00       	call   800d77 <vprintfmt>
+  800b2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b2e:	c9                   	leave
+  800b2f:	c3                   	ret
+
+00800b30 <bprintf>:
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	83 ec 10             	sub    $0x10,%esp
+  800b36:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800b39:	50                   	push   %eax
+  800b3a:	ff 75 08             	push   0x8(%ebp)
+  800b3d:	e8 c8 ff ff ff       	call   800b0a <vbprintf>
+  800b42:	c9                   	leave
+  800b43:	c3                   	ret
+
+00800b44 <bwrite>:
+  800b44:	55                   	push   %ebp
+  800b45:	89 e5                	mov    %esp,%ebp
+  800b47:	53                   	push   %ebx
+  800b48:	83 ec 04             	sub    $0x4,%esp
+  800b4b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b4e:	89 d8                	mov    %ebx,%eax
+  800b50:	03 05 40 20 80 00    	add    0x802040,%eax
+  800b56:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b5b:	76 0d                	jbe    800b6a <bwrite+0x26>
+  800b5d:	e8 47 ff ff ff       	call   800aa9 <bflush>
+  800b62:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  800b68:	77 25                	ja     800b8f <bwrite+0x4b>
+  800b6a:	83 ec 04             	sub    $0x4,%esp
+  800b6d:	53                   	push   %ebx
+  800b6e:	ff 75 08             	push   0x8(%ebp)
+  800b71:	a1 40 20 80 00       	mov    0x802040,%eax
+  800b76:	05 44 20 80 00       	add    $0x802044,%eax
+  800b7b:	50                   	push   %eax
+  800b7c:	e8 61 09 00 00       	call   8014e2 <memcpy>
+  800b81:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  800b87:	83 c4 10             	add    $0x10,%esp
+  800b8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b8d:	c9                   	leave
+  800b8e:	c3                   	ret
+  800b8f:	83 ec 08             	sub    $0x8,%esp
+  800b92:	53                   	push   %ebx
+  800b93:	ff 75 08             	push   0x8(%ebp)
+  800b96:	e8 fd f4 ff ff       	call   800098 <sys_cputs>
+  800b9b:	83 c4 10             	add    $0x10,%esp
+  800b9e:	eb ea                	jmp    800b8a <bwrite+0x46>
+
+00800ba0 <_panic>:
+  800ba0:	55                   	push   %ebp
+  800ba1:	89 e5                	mov    %esp,%ebp
+  800ba3:	56                   	push   %esi
+  800ba4:	53                   	push   %ebx
+  800ba5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800ba8:	e8 fc fe ff ff       	call   800aa9 <bflush>
+  800bad:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  800bb3:	e8 39 f6 ff ff       	call   8001f1 <sys_getenvid>
+  800bb8:	83 ec 0c             	sub    $0xc,%esp
+  800bbb:	ff 75 0c             	push   0xc(%ebp)
+  800bbe:	ff 75 08             	push   0x8(%ebp)
+  800bc1:	56                   	push   %esi
+  800bc2:	50                   	push   %eax
+  800bc3:	68 98 19 80 00       	push   $0x801998
+  800bc8:	e8 b3 00 00 00       	call   800c80 <cprintf>
+  800bcd:	83 c4 18             	add    $0x18,%esp
+  800bd0:	53                   	push   %ebx
+  800bd1:	ff 75 10             	push   0x10(%ebp)
+  800bd4:	e8 56 00 00 00       	call   800c2f <vcprintf>
+  800bd9:	c7 04 24 bb 19 80 00 	movl   $0x8019bb,(%esp)
+  800be0:	e8 9b 00 00 00       	call   800c80 <cprintf>
+  800be5:	83 c4 10             	add    $0x10,%esp
+  800be8:	cc                   	int3
+  800be9:	eb fd                	jmp    800be8 <_panic+0x48>
+
+00800beb <putch>:
+  800beb:	55                   	push   %ebp
+  800bec:	89 e5                	mov    %esp,%ebp
+  800bee:	53                   	push   %ebx
+  800bef:	83 ec 04             	sub    $0x4,%esp
+  800bf2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800bf5:	8b 13                	mov    (%ebx),%edx
+  800bf7:	8d 42 01             	lea    0x1(%edx),%eax
+  800bfa:	89 03                	mov    %eax,(%ebx)
+  800bfc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bff:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800c03:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800c08:	74 09                	je     800c13 <putch+0x28>
+  800c0a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800c0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c11:	c9                   	leave
+  800c12:	c3                   	ret
+  800c13:	83 ec 08             	sub    $0x8,%esp
+  800c16:	68 ff 00 00 00       	push   $0xff
+  800c1b:	8d 43 08             	lea    0x8(%ebx),%eax
+  800c1e:	50                   	push   %eax
+  800c1f:	e8 74 f4 ff ff       	call   800098 <sys_cputs>
+  800c24:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800c2a:	83 c4 10             	add    $0x10,%esp
+  800c2d:	eb db                	jmp    800c0a <putch+0x1f>
+
+00800c2f <vcprintf>:
+  800c2f:	55                   	push   %ebp
+  800c30:	89 e5                	mov    %esp,%ebp
+  800c32:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800c38:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800c3f:	00 00 00 
+  800c42:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800c49:	00 00 00 
+  800c4c:	ff 75 0c             	push   0xc(%ebp)
+  800c4f:	ff 75 08             	push   0x8(%ebp)
+  800c52:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800c58:	50                   	push   %eax
+  800c59:	68 eb 0b 80 00       	push   $0x800beb
+  800c5e:	e8 14 01 00 00       	call   800d77 <vprintfmt>
+  800c63:	83 c4 08             	add    $0x8,%esp
+  800c66:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800c6c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800c72:	50                   	push   %eax
+  800c73:	e8 20 f4 ff ff       	call   800098 <sys_cputs>
+  800c78:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800c7e:	c9                   	leave
+  800c7f:	c3                   	ret
+
+00800c80 <cprintf>:
+  800c80:	55                   	push   %ebp
+  800c81:	89 e5                	mov    %esp,%ebp
+  800c83:	83 ec 10             	sub    $0x10,%esp
+  800c86:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800c89:	50                   	push   %eax
+  800c8a:	ff 75 08             	push   0x8(%ebp)
+  800c8d:	e8 9d ff ff ff       	call   800c2f <vcprintf>
+  800c92:	c9                   	leave
+  800c93:	c3                   	ret
+
+00800c94 <printnum>:
+  800c94:	55                   	push   %ebp
+  800c95:	89 e5                	mov    %esp,%ebp
+  800c97:	57                   	push   %edi
+  800c98:	56                   	push   %esi
+  800c99:	53                   	push   %ebx
+  800c9a:	83 ec 1c             	sub    $0x1c,%esp
+  800c9d:	89 c7                	mov    %eax,%edi
+  800c9f:	89 d6                	mov    %edx,%esi
+  800ca1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ca7:	89 d1                	mov    %edx,%ecx
+  800ca9:	89 c2                	mov    %eax,%edx
+  800cab:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cae:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800cb1:	8b 45 10             	mov    0x10(%ebp),%eax
+  800cb4:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800cb7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800cba:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800cc1:	39 c2                	cmp    %eax,%edx
+  800cc3:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800cc6:	72 3e                	jb     800d06 <printnum+0x72>
+  800cc8:	83 ec 0c             	sub    $0xc,%esp
+  800ccb:	ff 75 18             	push   0x18(%ebp)
+  800cce:	83 eb 01             	sub    $0x1,%ebx
+  800cd1:	53                   	push   %ebx
+  800cd2:	50                   	push   %eax
+  800cd3:	83 ec 08             	sub    $0x8,%esp
+  800cd6:	ff 75 e4             	push   -0x1c(%ebp)
+  800cd9:	ff 75 e0             	push   -0x20(%ebp)
+  800cdc:	ff 75 dc             	push   -0x24(%ebp)
+  800cdf:	ff 75 d8             	push   -0x28(%ebp)
+  800ce2:	e8 fd 09 00 00       	call   8016e4 <__udivdi3>
+  800ce7:	83 c4 18             	add    $0x18,%esp
+  800cea:	52                   	push   %edx
+  800ceb:	50                   	push   %eax
+  800cec:	89 f2                	mov    %esi,%edx
+  800cee:	89 f8                	mov    %edi,%eax
+  800cf0:	e8 9f ff ff ff       	call   800c94 <printnum>
+  800cf5:	83 c4 20             	add    $0x20,%esp
+  800cf8:	eb 13                	jmp    800d0d <printnum+0x79>
+  800cfa:	83 ec 08             	sub    $0x8,%esp
+  800cfd:	56                   	push   %esi
+  800cfe:	ff 75 18             	push   0x18(%ebp)
+  800d01:	ff d7                	call   *%edi
+  800d03:	83 c4 10             	add    $0x10,%esp
+  800d06:	83 eb 01             	sub    $0x1,%ebx
+  800d09:	85 db                	test   %ebx,%ebx
+  800d0b:	7f ed                	jg     800cfa <printnum+0x66>
+  800d0d:	83 ec 08             	sub    $0x8,%esp
+  800d10:	56                   	push   %esi
+  800d11:	83 ec 04             	sub    $0x4,%esp
+  800d14:	ff 75 e4             	push   -0x1c(%ebp)
+  800d17:	ff 75 e0             	push   -0x20(%ebp)
+  800d1a:	ff 75 dc             	push   -0x24(%ebp)
+  800d1d:	ff 75 d8             	push   -0x28(%ebp)
+  800d20:	e8 97 0a 00 00       	call   8017bc <__umoddi3>
+  800d25:	83 c4 14             	add    $0x14,%esp
+  800d28:	0f be 80 bd 19 80 00 	movsbl 0x8019bd(%eax),%eax
+  800d2f:	50                   	push   %eax
+  800d30:	ff d7                	call   *%edi
+  800d32:	83 c4 10             	add    $0x10,%esp
+  800d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d38:	5b                   	pop    %ebx
+  800d39:	5e                   	pop    %esi
+  800d3a:	5f                   	pop    %edi
+  800d3b:	5d                   	pop    %ebp
+  800d3c:	c3                   	ret
+
+00800d3d <sprintputch>:
+  800d3d:	55                   	push   %ebp
+  800d3e:	89 e5                	mov    %esp,%ebp
+  800d40:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d43:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800d47:	8b 10                	mov    (%eax),%edx
+  800d49:	3b 50 04             	cmp    0x4(%eax),%edx
+  800d4c:	73 0a                	jae    800d58 <sprintputch+0x1b>
+  800d4e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800d51:	89 08                	mov    %ecx,(%eax)
+  800d53:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d56:	88 02                	mov    %al,(%edx)
+  800d58:	5d                   	pop    %ebp
+  800d59:	c3                   	ret
+
+00800d5a <printfmt>:
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	83 ec 08             	sub    $0x8,%esp
+  800d60:	8d 45 14             	lea    0x14(%ebp),%eax
+  800d63:	50                   	push   %eax
+  800d64:	ff 75 10             	push   0x10(%ebp)
+  800d67:	ff 75 0c             	push   0xc(%ebp)
+  800d6a:	ff 75 08             	push   0x8(%ebp)
+  800d6d:	e8 05 00 00 00       	call   800d77 <vprintfmt>
+  800d72:	83 c4 10             	add    $0x10,%esp
+  800d75:	c9                   	leave
+  800d76:	c3                   	ret
+
+00800d77 <vprintfmt>:
+  800d77:	55                   	push   %ebp
+  800d78:	89 e5                	mov    %esp,%ebp
+  800d7a:	57                   	push   %edi
+  800d7b:	56                   	push   %esi
+  800d7c:	53                   	push   %ebx
+  800d7d:	83 ec 2c             	sub    $0x2c,%esp
+  800d80:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d83:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d86:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d89:	eb 0a                	jmp    800d95 <vprintfmt+0x1e>
+  800d8b:	83 ec 08             	sub    $0x8,%esp
+  800d8e:	53                   	push   %ebx
+  800d8f:	50                   	push   %eax
+  800d90:	ff d6                	call   *%esi
+  800d92:	83 c4 10             	add    $0x10,%esp
+  800d95:	83 c7 01             	add    $0x1,%edi
+  800d98:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800d9c:	83 f8 25             	cmp    $0x25,%eax
+  800d9f:	74 0c                	je     800dad <vprintfmt+0x36>
+  800da1:	85 c0                	test   %eax,%eax
+  800da3:	75 e6                	jne    800d8b <vprintfmt+0x14>
+  800da5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da8:	5b                   	pop    %ebx
+  800da9:	5e                   	pop    %esi
+  800daa:	5f                   	pop    %edi
+  800dab:	5d                   	pop    %ebp
+  800dac:	c3                   	ret
+  800dad:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800db1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800db8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800dbf:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800dc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dcb:	8d 47 01             	lea    0x1(%edi),%eax
+  800dce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800dd1:	0f b6 17             	movzbl (%edi),%edx
+  800dd4:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800dd7:	3c 55                	cmp    $0x55,%al
+  800dd9:	0f 87 cf 03 00 00    	ja     8011ae <vprintfmt+0x437>
+  800ddf:	0f b6 c0             	movzbl %al,%eax
+  800de2:	ff 24 85 80 1a 80 00 	jmp    *0x801a80(,%eax,4)
+  800de9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800dec:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800df0:	eb d9                	jmp    800dcb <vprintfmt+0x54>
+  800df2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800df5:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800df9:	eb d0                	jmp    800dcb <vprintfmt+0x54>
+  800dfb:	0f b6 d2             	movzbl %dl,%edx
+  800dfe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e06:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e09:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800e0c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800e10:	0f be 17             	movsbl (%edi),%edx
+  800e13:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800e16:	83 f9 09             	cmp    $0x9,%ecx
+  800e19:	77 55                	ja     800e70 <vprintfmt+0xf9>
+  800e1b:	83 c7 01             	add    $0x1,%edi
+  800e1e:	eb e9                	jmp    800e09 <vprintfmt+0x92>
+  800e20:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e23:	8b 00                	mov    (%eax),%eax
+  800e25:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e28:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e2b:	8d 40 04             	lea    0x4(%eax),%eax
+  800e2e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e31:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e34:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800e38:	79 91                	jns    800dcb <vprintfmt+0x54>
+  800e3a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800e3d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e40:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800e47:	eb 82                	jmp    800dcb <vprintfmt+0x54>
+  800e49:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e4c:	85 d2                	test   %edx,%edx
+  800e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e53:	0f 49 c2             	cmovns %edx,%eax
+  800e56:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e59:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e5c:	e9 6a ff ff ff       	jmp    800dcb <vprintfmt+0x54>
+  800e61:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e64:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800e6b:	e9 5b ff ff ff       	jmp    800dcb <vprintfmt+0x54>
+  800e70:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e73:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e76:	eb bc                	jmp    800e34 <vprintfmt+0xbd>
+  800e78:	83 c1 01             	add    $0x1,%ecx
+  800e7b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e7e:	e9 48 ff ff ff       	jmp    800dcb <vprintfmt+0x54>
+  800e83:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e86:	8d 78 04             	lea    0x4(%eax),%edi
+  800e89:	83 ec 08             	sub    $0x8,%esp
+  800e8c:	53                   	push   %ebx
+  800e8d:	ff 30                	push   (%eax)
+  800e8f:	ff d6                	call   *%esi
+  800e91:	83 c4 10             	add    $0x10,%esp
+  800e94:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800e97:	e9 b1 02 00 00       	jmp    80114d <vprintfmt+0x3d6>
+  800e9c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e9f:	8d 78 04             	lea    0x4(%eax),%edi
+  800ea2:	8b 10                	mov    (%eax),%edx
+  800ea4:	89 d0                	mov    %edx,%eax
+  800ea6:	f7 d8                	neg    %eax
+  800ea8:	0f 48 c2             	cmovs  %edx,%eax
+  800eab:	83 f8 08             	cmp    $0x8,%eax
+  800eae:	7f 23                	jg     800ed3 <vprintfmt+0x15c>
+  800eb0:	8b 14 85 e0 1b 80 00 	mov    0x801be0(,%eax,4),%edx
+  800eb7:	85 d2                	test   %edx,%edx
+  800eb9:	74 18                	je     800ed3 <vprintfmt+0x15c>
+  800ebb:	52                   	push   %edx
+  800ebc:	68 de 19 80 00       	push   $0x8019de
+  800ec1:	53                   	push   %ebx
+  800ec2:	56                   	push   %esi
+  800ec3:	e8 92 fe ff ff       	call   800d5a <printfmt>
+  800ec8:	83 c4 10             	add    $0x10,%esp
+  800ecb:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800ece:	e9 7a 02 00 00       	jmp    80114d <vprintfmt+0x3d6>
+  800ed3:	50                   	push   %eax
+  800ed4:	68 d5 19 80 00       	push   $0x8019d5
+  800ed9:	53                   	push   %ebx
+  800eda:	56                   	push   %esi
+  800edb:	e8 7a fe ff ff       	call   800d5a <printfmt>
+  800ee0:	83 c4 10             	add    $0x10,%esp
+  800ee3:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800ee6:	e9 62 02 00 00       	jmp    80114d <vprintfmt+0x3d6>
+  800eeb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800eee:	83 c0 04             	add    $0x4,%eax
+  800ef1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800ef4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ef7:	8b 08                	mov    (%eax),%ecx
+  800ef9:	85 c9                	test   %ecx,%ecx
+  800efb:	b8 ce 19 80 00       	mov    $0x8019ce,%eax
+  800f00:	0f 45 c1             	cmovne %ecx,%eax
+  800f03:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800f06:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800f0a:	7e 06                	jle    800f12 <vprintfmt+0x19b>
+  800f0c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800f10:	75 0b                	jne    800f1d <vprintfmt+0x1a6>
+  800f12:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800f15:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800f18:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f1b:	eb 5c                	jmp    800f79 <vprintfmt+0x202>
+  800f1d:	83 ec 08             	sub    $0x8,%esp
+  800f20:	ff 75 d0             	push   -0x30(%ebp)
+  800f23:	ff 75 cc             	push   -0x34(%ebp)
+  800f26:	e8 87 03 00 00       	call   8012b2 <strnlen>
+  800f2b:	89 c2                	mov    %eax,%edx
+  800f2d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f30:	29 d0                	sub    %edx,%eax
+  800f32:	83 c4 10             	add    $0x10,%esp
+  800f35:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800f39:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f3c:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f3f:	89 c6                	mov    %eax,%esi
+  800f41:	eb 0e                	jmp    800f51 <vprintfmt+0x1da>
+  800f43:	83 ec 08             	sub    $0x8,%esp
+  800f46:	53                   	push   %ebx
+  800f47:	57                   	push   %edi
+  800f48:	ff 55 08             	call   *0x8(%ebp)
+  800f4b:	83 ee 01             	sub    $0x1,%esi
+  800f4e:	83 c4 10             	add    $0x10,%esp
+  800f51:	85 f6                	test   %esi,%esi
+  800f53:	7f ee                	jg     800f43 <vprintfmt+0x1cc>
+  800f55:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f58:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f5b:	85 c0                	test   %eax,%eax
+  800f5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f62:	0f 49 d0             	cmovns %eax,%edx
+  800f65:	29 d0                	sub    %edx,%eax
+  800f67:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f6a:	eb a6                	jmp    800f12 <vprintfmt+0x19b>
+  800f6c:	83 ec 08             	sub    $0x8,%esp
+  800f6f:	53                   	push   %ebx
+  800f70:	52                   	push   %edx
+  800f71:	ff 55 08             	call   *0x8(%ebp)
+  800f74:	83 c4 10             	add    $0x10,%esp
+  800f77:	89 f1                	mov    %esi,%ecx
+  800f79:	8d 71 01             	lea    0x1(%ecx),%esi
+  800f7c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800f80:	0f be d0             	movsbl %al,%edx
+  800f83:	85 d2                	test   %edx,%edx
+  800f85:	74 28                	je     800faf <vprintfmt+0x238>
+  800f87:	85 ff                	test   %edi,%edi
+  800f89:	78 05                	js     800f90 <vprintfmt+0x219>
+  800f8b:	83 ef 01             	sub    $0x1,%edi
+  800f8e:	78 30                	js     800fc0 <vprintfmt+0x249>
+  800f90:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800f94:	74 d6                	je     800f6c <vprintfmt+0x1f5>
+  800f96:	0f be c0             	movsbl %al,%eax
+  800f99:	83 e8 20             	sub    $0x20,%eax
+  800f9c:	83 f8 5e             	cmp    $0x5e,%eax
+  800f9f:	76 cb                	jbe    800f6c <vprintfmt+0x1f5>
+  800fa1:	83 ec 08             	sub    $0x8,%esp
+  800fa4:	53                   	push   %ebx
+  800fa5:	6a 3f                	push   $0x3f
+  800fa7:	ff 55 08             	call   *0x8(%ebp)
+  800faa:	83 c4 10             	add    $0x10,%esp
+  800fad:	eb c8                	jmp    800f77 <vprintfmt+0x200>
+  800faf:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fb2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800fb5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800fb8:	01 d0                	add    %edx,%eax
+  800fba:	29 c8                	sub    %ecx,%eax
+  800fbc:	89 c7                	mov    %eax,%edi
+  800fbe:	eb 13                	jmp    800fd3 <vprintfmt+0x25c>
+  800fc0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fc3:	eb ed                	jmp    800fb2 <vprintfmt+0x23b>
+  800fc5:	83 ec 08             	sub    $0x8,%esp
+  800fc8:	53                   	push   %ebx
+  800fc9:	6a 20                	push   $0x20
+  800fcb:	ff d6                	call   *%esi
+  800fcd:	83 ef 01             	sub    $0x1,%edi
+  800fd0:	83 c4 10             	add    $0x10,%esp
+  800fd3:	85 ff                	test   %edi,%edi
+  800fd5:	7f ee                	jg     800fc5 <vprintfmt+0x24e>
+  800fd7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800fda:	89 45 14             	mov    %eax,0x14(%ebp)
+  800fdd:	e9 6b 01 00 00       	jmp    80114d <vprintfmt+0x3d6>
+  800fe2:	83 f9 01             	cmp    $0x1,%ecx
+  800fe5:	7f 1f                	jg     801006 <vprintfmt+0x28f>
+  800fe7:	85 c9                	test   %ecx,%ecx
+  800fe9:	74 67                	je     801052 <vprintfmt+0x2db>
+  800feb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fee:	8b 00                	mov    (%eax),%eax
+  800ff0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ff3:	89 c1                	mov    %eax,%ecx
+  800ff5:	c1 f9 1f             	sar    $0x1f,%ecx
+  800ff8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ffb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ffe:	8d 40 04             	lea    0x4(%eax),%eax
+  801001:	89 45 14             	mov    %eax,0x14(%ebp)
+  801004:	eb 17                	jmp    80101d <vprintfmt+0x2a6>
+  801006:	8b 45 14             	mov    0x14(%ebp),%eax
+  801009:	8b 50 04             	mov    0x4(%eax),%edx
+  80100c:	8b 00                	mov    (%eax),%eax
+  80100e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801011:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801014:	8b 45 14             	mov    0x14(%ebp),%eax
+  801017:	8d 40 08             	lea    0x8(%eax),%eax
+  80101a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80101d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801020:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801023:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801028:	85 c9                	test   %ecx,%ecx
+  80102a:	0f 89 03 01 00 00    	jns    801133 <vprintfmt+0x3bc>
+  801030:	83 ec 08             	sub    $0x8,%esp
+  801033:	53                   	push   %ebx
+  801034:	6a 2d                	push   $0x2d
+  801036:	ff d6                	call   *%esi
+  801038:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80103b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80103e:	f7 da                	neg    %edx
+  801040:	83 d1 00             	adc    $0x0,%ecx
+  801043:	f7 d9                	neg    %ecx
+  801045:	83 c4 10             	add    $0x10,%esp
+  801048:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80104d:	e9 e1 00 00 00       	jmp    801133 <vprintfmt+0x3bc>
+  801052:	8b 45 14             	mov    0x14(%ebp),%eax
+  801055:	8b 00                	mov    (%eax),%eax
+  801057:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80105a:	89 c1                	mov    %eax,%ecx
+  80105c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80105f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801062:	8b 45 14             	mov    0x14(%ebp),%eax
+  801065:	8d 40 04             	lea    0x4(%eax),%eax
+  801068:	89 45 14             	mov    %eax,0x14(%ebp)
+  80106b:	eb b0                	jmp    80101d <vprintfmt+0x2a6>
+  80106d:	83 f9 01             	cmp    $0x1,%ecx
+  801070:	7f 1e                	jg     801090 <vprintfmt+0x319>
+  801072:	85 c9                	test   %ecx,%ecx
+  801074:	74 32                	je     8010a8 <vprintfmt+0x331>
+  801076:	8b 45 14             	mov    0x14(%ebp),%eax
+  801079:	8b 10                	mov    (%eax),%edx
+  80107b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801080:	8d 40 04             	lea    0x4(%eax),%eax
+  801083:	89 45 14             	mov    %eax,0x14(%ebp)
+  801086:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80108b:	e9 a3 00 00 00       	jmp    801133 <vprintfmt+0x3bc>
+  801090:	8b 45 14             	mov    0x14(%ebp),%eax
+  801093:	8b 10                	mov    (%eax),%edx
+  801095:	8b 48 04             	mov    0x4(%eax),%ecx
+  801098:	8d 40 08             	lea    0x8(%eax),%eax
+  80109b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80109e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010a3:	e9 8b 00 00 00       	jmp    801133 <vprintfmt+0x3bc>
+  8010a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010ab:	8b 10                	mov    (%eax),%edx
+  8010ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8010b5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010b8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010bd:	eb 74                	jmp    801133 <vprintfmt+0x3bc>
+  8010bf:	83 f9 01             	cmp    $0x1,%ecx
+  8010c2:	7f 1b                	jg     8010df <vprintfmt+0x368>
+  8010c4:	85 c9                	test   %ecx,%ecx
+  8010c6:	74 2c                	je     8010f4 <vprintfmt+0x37d>
+  8010c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010cb:	8b 10                	mov    (%eax),%edx
+  8010cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8010d5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010d8:	bf 08 00 00 00       	mov    $0x8,%edi
+  8010dd:	eb 54                	jmp    801133 <vprintfmt+0x3bc>
+  8010df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010e2:	8b 10                	mov    (%eax),%edx
+  8010e4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8010e7:	8d 40 08             	lea    0x8(%eax),%eax
+  8010ea:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010ed:	bf 08 00 00 00       	mov    $0x8,%edi
+  8010f2:	eb 3f                	jmp    801133 <vprintfmt+0x3bc>
+  8010f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010f7:	8b 10                	mov    (%eax),%edx
+  8010f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010fe:	8d 40 04             	lea    0x4(%eax),%eax
+  801101:	89 45 14             	mov    %eax,0x14(%ebp)
+  801104:	bf 08 00 00 00       	mov    $0x8,%edi
+  801109:	eb 28                	jmp    801133 <vprintfmt+0x3bc>
+  80110b:	83 ec 08             	sub    $0x8,%esp
+  80110e:	53                   	push   %ebx
+  80110f:	6a 30                	push   $0x30
+  801111:	ff d6                	call   *%esi
+  801113:	83 c4 08             	add    $0x8,%esp
+  801116:	53                   	push   %ebx
+  801117:	6a 78                	push   $0x78
+  801119:	ff d6                	call   *%esi
+  80111b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80111e:	8b 10                	mov    (%eax),%edx
+  801120:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801125:	83 c4 10             	add    $0x10,%esp
+  801128:	8d 40 04             	lea    0x4(%eax),%eax
+  80112b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80112e:	bf 10 00 00 00       	mov    $0x10,%edi
+  801133:	83 ec 0c             	sub    $0xc,%esp
+  801136:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80113a:	50                   	push   %eax
+  80113b:	ff 75 e0             	push   -0x20(%ebp)
+  80113e:	57                   	push   %edi
+  80113f:	51                   	push   %ecx
+  801140:	52                   	push   %edx
+  801141:	89 da                	mov    %ebx,%edx
+  801143:	89 f0                	mov    %esi,%eax
+  801145:	e8 4a fb ff ff       	call   800c94 <printnum>
+  80114a:	83 c4 20             	add    $0x20,%esp
+  80114d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801150:	e9 40 fc ff ff       	jmp    800d95 <vprintfmt+0x1e>
+  801155:	83 f9 01             	cmp    $0x1,%ecx
+  801158:	7f 1b                	jg     801175 <vprintfmt+0x3fe>
+  80115a:	85 c9                	test   %ecx,%ecx
+  80115c:	74 2c                	je     80118a <vprintfmt+0x413>
+  80115e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801161:	8b 10                	mov    (%eax),%edx
+  801163:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801168:	8d 40 04             	lea    0x4(%eax),%eax
+  80116b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80116e:	bf 10 00 00 00       	mov    $0x10,%edi
+  801173:	eb be                	jmp    801133 <vprintfmt+0x3bc>
+  801175:	8b 45 14             	mov    0x14(%ebp),%eax
+  801178:	8b 10                	mov    (%eax),%edx
+  80117a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80117d:	8d 40 08             	lea    0x8(%eax),%eax
+  801180:	89 45 14             	mov    %eax,0x14(%ebp)
+  801183:	bf 10 00 00 00       	mov    $0x10,%edi
+  801188:	eb a9                	jmp    801133 <vprintfmt+0x3bc>
+  80118a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80118d:	8b 10                	mov    (%eax),%edx
+  80118f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801194:	8d 40 04             	lea    0x4(%eax),%eax
+  801197:	89 45 14             	mov    %eax,0x14(%ebp)
+  80119a:	bf 10 00 00 00       	mov    $0x10,%edi
+  80119f:	eb 92                	jmp    801133 <vprintfmt+0x3bc>
+  8011a1:	83 ec 08             	sub    $0x8,%esp
+  8011a4:	53                   	push   %ebx
+  8011a5:	6a 25                	push   $0x25
+  8011a7:	ff d6                	call   *%esi
+  8011a9:	83 c4 10             	add    $0x10,%esp
+  8011ac:	eb 9f                	jmp    80114d <vprintfmt+0x3d6>
+  8011ae:	83 ec 08             	sub    $0x8,%esp
+  8011b1:	53                   	push   %ebx
+  8011b2:	6a 25                	push   $0x25
+  8011b4:	ff d6                	call   *%esi
+  8011b6:	83 c4 10             	add    $0x10,%esp
+  8011b9:	89 f8                	mov    %edi,%eax
+  8011bb:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8011bf:	74 05                	je     8011c6 <vprintfmt+0x44f>
+  8011c1:	83 e8 01             	sub    $0x1,%eax
+  8011c4:	eb f5                	jmp    8011bb <vprintfmt+0x444>
+  8011c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8011c9:	eb 82                	jmp    80114d <vprintfmt+0x3d6>
+
+008011cb <vsnprintf>:
+  8011cb:	55                   	push   %ebp
+  8011cc:	89 e5                	mov    %esp,%ebp
+  8011ce:	83 ec 18             	sub    $0x18,%esp
+  8011d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011d7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8011da:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8011de:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8011e1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8011e8:	85 c0                	test   %eax,%eax
+  8011ea:	74 26                	je     801212 <vsnprintf+0x47>
+  8011ec:	85 d2                	test   %edx,%edx
+  8011ee:	7e 22                	jle    801212 <vsnprintf+0x47>
+  8011f0:	ff 75 14             	push   0x14(%ebp)
+  8011f3:	ff 75 10             	push   0x10(%ebp)
+  8011f6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8011f9:	50                   	push   %eax
+  8011fa:	68 3d 0d 80 00       	push   $0x800d3d
+  8011ff:	e8 73 fb ff ff       	call   800d77 <vprintfmt>
+  801204:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801207:	c6 00 00             	movb   $0x0,(%eax)
+  80120a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80120d:	83 c4 10             	add    $0x10,%esp
+  801210:	c9                   	leave
+  801211:	c3                   	ret
+  801212:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801217:	eb f7                	jmp    801210 <vsnprintf+0x45>
+
+00801219 <snprintf>:
+  801219:	55                   	push   %ebp
+  80121a:	89 e5                	mov    %esp,%ebp
+  80121c:	83 ec 08             	sub    $0x8,%esp
+  80121f:	8d 45 14             	lea    0x14(%ebp),%eax
+  801222:	50                   	push   %eax
+  801223:	ff 75 10             	push   0x10(%ebp)
+  801226:	ff 75 0c             	push   0xc(%ebp)
+  801229:	ff 75 08             	push   0x8(%ebp)
+  80122c:	e8 9a ff ff ff       	call   8011cb <vsnprintf>
+  801231:	c9                   	leave
+  801232:	c3                   	ret
+
+00801233 <copy_fwd>:
+  801233:	55                   	push   %ebp
+  801234:	89 e5                	mov    %esp,%ebp
+  801236:	57                   	push   %edi
+  801237:	56                   	push   %esi
+  801238:	53                   	push   %ebx
+  801239:	89 c7                	mov    %eax,%edi
+  80123b:	89 d6                	mov    %edx,%esi
+  80123d:	89 c8                	mov    %ecx,%eax
+  80123f:	83 f9 0f             	cmp    $0xf,%ecx
+  801242:	76 1c                	jbe    801260 <copy_fwd+0x2d>
+  801244:	89 f9                	mov    %edi,%ecx
+  801246:	f7 d9                	neg    %ecx
+  801248:	89 cb                	mov    %ecx,%ebx
+  80124a:	83 e3 03             	and    $0x3,%ebx
+  80124d:	29 d8                	sub    %ebx,%eax
+  80124f:	89 c2                	mov    %eax,%edx
+  801251:	c1 ea 02             	shr    $0x2,%edx
+  801254:	83 e0 03             	and    $0x3,%eax
+  801257:	89 d9                	mov    %ebx,%ecx
+  801259:	fc                   	cld
+  80125a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80125c:	89 d1                	mov    %edx,%ecx
+  80125e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801260:	89 c1                	mov    %eax,%ecx
+  801262:	fc                   	cld
+  801263:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  801265:	5b                   	pop    %ebx
+  801266:	5e                   	pop    %esi
+  801267:	5f                   	pop    %edi
+  801268:	5d                   	pop    %ebp
+  801269:	c3                   	ret
+
+0080126a <have_sse2>:
+  80126a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801271:	78 06                	js     801279 <have_sse2+0xf>
+  801273:	a1 08 20 80 00       	mov    0x802008,%eax
+  801278:	c3                   	ret
+  801279:	55                   	push   %ebp
+  80127a:	89 e5                	mov    %esp,%ebp
+  80127c:	53                   	push   %ebx
+  80127d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801282:	0f a2                	cpuid
+  801284:	c1 ea 1a             	shr    $0x1a,%edx
+  801287:	83 e2 01             	and    $0x1,%edx
+  80128a:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801290:	a1 08 20 80 00       	mov    0x802008,%eax
+  801295:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801298:	c9                   	leave
+  801299:	c3                   	ret
+
+0080129a <strlen>:
+  80129a:	55                   	push   %ebp
+  80129b:	89 e5                	mov    %esp,%ebp
+  80129d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a5:	eb 03                	jmp    8012aa <strlen+0x10>
+  8012a7:	83 c0 01             	add    $0x1,%eax
+  8012aa:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8012ae:	75 f7                	jne    8012a7 <strlen+0xd>
+  8012b0:	5d                   	pop    %ebp
+  8012b1:	c3                   	ret
+
+008012b2 <strnlen>:
+  8012b2:	55                   	push   %ebp
+  8012b3:	89 e5                	mov    %esp,%ebp
+  8012b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c0:	eb 03                	jmp    8012c5 <strnlen+0x13>
+  8012c2:	83 c0 01             	add    $0x1,%eax
+  8012c5:	39 d0                	cmp    %edx,%eax
+  8012c7:	74 08                	je     8012d1 <strnlen+0x1f>
+  8012c9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8012cd:	75 f3                	jne    8012c2 <strnlen+0x10>
+  8012cf:	89 c2                	mov    %eax,%edx
+  8012d1:	89 d0                	mov    %edx,%eax
+  8012d3:	5d                   	pop    %ebp
+  8012d4:	c3                   	ret
+
+008012d5 <strcpy>:
+  8012d5:	55                   	push   %ebp
+  8012d6:	89 e5                	mov    %esp,%ebp
+  8012d8:	53                   	push   %ebx
+  8012d9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8012df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8012e8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8012eb:	83 c0 01             	add    $0x1,%eax
+  8012ee:	84 d2                	test   %dl,%dl
+  8012f0:	75 f2                	jne    8012e4 <strcpy+0xf>
+  8012f2:	89 c8                	mov    %ecx,%eax
+  8012f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012f7:	c9                   	leave
+  8012f8:	c3                   	ret
+
+008012f9 <strcat>:
+  8012f9:	55                   	push   %ebp
+  8012fa:	89 e5                	mov    %esp,%ebp
+  8012fc:	53                   	push   %ebx
+  8012fd:	83 ec 10             	sub    $0x10,%esp
+  801300:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801303:	53                   	push   %ebx
+  801304:	e8 91 ff ff ff       	call   80129a <strlen>
+  801309:	83 c4 08             	add    $0x8,%esp
+  80130c:	ff 75 0c             	push   0xc(%ebp)
+  80130f:	01 d8                	add    %ebx,%eax
+  801311:	50                   	push   %eax
+  801312:	e8 be ff ff ff       	call   8012d5 <strcpy>
+  801317:	89 d8                	mov    %ebx,%eax
+  801319:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80131c:	c9                   	leave
+  80131d:	c3                   	ret
+
+0080131e <strncpy>:
+  80131e:	55                   	push   %ebp
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	56                   	push   %esi
+  801322:	53                   	push   %ebx
+  801323:	8b 75 08             	mov    0x8(%ebp),%esi
+  801326:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801329:	89 f3                	mov    %esi,%ebx
+  80132b:	03 5d 10             	add    0x10(%ebp),%ebx
+  80132e:	89 f0                	mov    %esi,%eax
+  801330:	eb 0f                	jmp    801341 <strncpy+0x23>
+  801332:	83 c0 01             	add    $0x1,%eax
+  801335:	0f b6 0a             	movzbl (%edx),%ecx
+  801338:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80133b:	80 f9 01             	cmp    $0x1,%cl
+  80133e:	83 da ff             	sbb    $0xffffffff,%edx
+  801341:	39 d8                	cmp    %ebx,%eax
+  801343:	75 ed                	jne    801332 <strncpy+0x14>
+  801345:	89 f0                	mov    %esi,%eax
+  801347:	5b                   	pop    %ebx
+  801348:	5e                   	pop    %esi
+  801349:	5d                   	pop    %ebp
+  80134a:	c3                   	ret
+
+0080134b <strlcpy>:
+  80134b:	55                   	push   %ebp
+  80134c:	89 e5                	mov    %esp,%ebp
+  80134e:	56                   	push   %esi
+  80134f:	53                   	push   %ebx
+  801350:	8b 75 08             	mov    0x8(%ebp),%esi
+  801353:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801356:	8b 55 10             	mov    0x10(%ebp),%edx
+  801359:	89 f0                	mov    %esi,%eax
+  80135b:	85 d2                	test   %edx,%edx
+  80135d:	74 21                	je     801380 <strlcpy+0x35>
+  80135f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801363:	89 f2                	mov    %esi,%edx
+  801365:	eb 09                	jmp    801370 <strlcpy+0x25>
+  801367:	83 c1 01             	add    $0x1,%ecx
+  80136a:	83 c2 01             	add    $0x1,%edx
+  80136d:	88 5a ff             	mov    %bl,-0x1(%edx)
+  801370:	39 c2                	cmp    %eax,%edx
+  801372:	74 09                	je     80137d <strlcpy+0x32>
+  801374:	0f b6 19             	movzbl (%ecx),%ebx
+  801377:	84 db                	test   %bl,%bl
+  801379:	75 ec                	jne    801367 <strlcpy+0x1c>
+  80137b:	89 d0                	mov    %edx,%eax
+  80137d:	c6 00 00             	movb   $0x0,(%eax)
+  801380:	29 f0                	sub    %esi,%eax
+  801382:	5b                   	pop    %ebx
+  801383:	5e                   	pop    %esi
+  801384:	5d                   	pop    %ebp
+  801385:	c3                   	ret
+
+00801386 <strcmp>:
+  801386:	55                   	push   %ebp
+  801387:	89 e5                	mov    %esp,%ebp
+  801389:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80138c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80138f:	eb 06                	jmp    801397 <strcmp+0x11>
+  801391:	83 c1 01             	add    $0x1,%ecx
+  801394:	83 c2 01             	add    $0x1,%edx
+  801397:	0f b6 01             	movzbl (%ecx),%eax
+  80139a:	84 c0                	test   %al,%al
+  80139c:	74 04                	je     8013a2 <strcmp+0x1c>
+  80139e:	3a 02                	cmp    (%edx),%al
+  8013a0:	74 ef                	je     801391 <strcmp+0xb>
+  8013a2:	0f b6 c0             	movzbl %al,%eax
+  8013a5:	0f b6 12             	movzbl (%edx),%edx
+  8013a8:	29 d0                	sub    %edx,%eax
+  8013aa:	5d                   	pop    %ebp
+  8013ab:	c3                   	ret
+
+008013ac <strncmp>:
+  8013ac:	55                   	push   %ebp
+  8013ad:	89 e5                	mov    %esp,%ebp
+  8013af:	53                   	push   %ebx
+  8013b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8013b9:	eb 09                	jmp    8013c4 <strncmp+0x18>
+  8013bb:	83 ea 01             	sub    $0x1,%edx
+  8013be:	83 c0 01             	add    $0x1,%eax
+  8013c1:	83 c1 01             	add    $0x1,%ecx
+  8013c4:	85 d2                	test   %edx,%edx
+  8013c6:	74 18                	je     8013e0 <strncmp+0x34>
+  8013c8:	0f b6 18             	movzbl (%eax),%ebx
+  8013cb:	84 db                	test   %bl,%bl
+  8013cd:	74 04                	je     8013d3 <strncmp+0x27>
+  8013cf:	3a 19                	cmp    (%ecx),%bl
+  8013d1:	74 e8                	je     8013bb <strncmp+0xf>
+  8013d3:	0f b6 00             	movzbl (%eax),%eax
+  8013d6:	0f b6 11             	movzbl (%ecx),%edx
+  8013d9:	29 d0                	sub    %edx,%eax
+  8013db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013de:	c9                   	leave
+  8013df:	c3                   	ret
+  8013e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e5:	eb f4                	jmp    8013db <strncmp+0x2f>
+
+008013e7 <strchr>:
+  8013e7:	55                   	push   %ebp
+  8013e8:	89 e5                	mov    %esp,%ebp
+  8013ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013ed:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8013f1:	eb 03                	jmp    8013f6 <strchr+0xf>
+  8013f3:	83 c0 01             	add    $0x1,%eax
+  8013f6:	0f b6 10             	movzbl (%eax),%edx
+  8013f9:	84 d2                	test   %dl,%dl
+  8013fb:	74 06                	je     801403 <strchr+0x1c>
+  8013fd:	38 ca                	cmp    %cl,%dl
+  8013ff:	75 f2                	jne    8013f3 <strchr+0xc>
+  801401:	eb 05                	jmp    801408 <strchr+0x21>
+  801403:	b8 00 00 00 00       	mov    $0x0,%eax
+  801408:	5d                   	pop    %ebp
+  801409:	c3                   	ret
+
+0080140a <strfind>:
+  80140a:	55                   	push   %ebp
+  80140b:	89 e5                	mov    %esp,%ebp
+  80140d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801410:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  801414:	0f b6 10             	movzbl (%eax),%edx
+  801417:	38 ca                	cmp    %cl,%dl
+  801419:	74 09                	je     801424 <strfind+0x1a>
+  80141b:	84 d2                	test   %dl,%dl
+  80141d:	74 05                	je     801424 <strfind+0x1a>
+  80141f:	83 c0 01             	add    $0x1,%eax
+  801422:	eb f0                	jmp    801414 <strfind+0xa>
+  801424:	5d                   	pop    %ebp
+  801425:	c3                   	ret
+
+00801426 <memset>:
+  801426:	55                   	push   %ebp
+  801427:	89 e5                	mov    %esp,%ebp
+  801429:	57                   	push   %edi
+  80142a:	56                   	push   %esi
+  80142b:	53                   	push   %ebx
+  80142c:	83 ec 04             	sub    $0x4,%esp
+  80142f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801432:	8b 55 10             	mov    0x10(%ebp),%edx
+  801435:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  801439:	89 f7                	mov    %esi,%edi
+  80143b:	83 fa 0f             	cmp    $0xf,%edx
+  80143e:	76 24                	jbe    801464 <memset+0x3e>
+  801440:	89 f1                	mov    %esi,%ecx
+  801442:	f7 d9                	neg    %ecx
+  801444:	83 e1 03             	and    $0x3,%ecx
+  801447:	29 ca                	sub    %ecx,%edx
+  801449:	89 d0                	mov    %edx,%eax
+  80144b:	c1 e8 02             	shr    $0x2,%eax
+  80144e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  801451:	83 e2 03             	and    $0x3,%edx
+  801454:	89 d8                	mov    %ebx,%eax
+  801456:	fc                   	cld
+  801457:	f3 aa                	rep stos %al,%es:(%edi)
+  801459:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  80145f:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  801462:	f3 ab                	rep stos %eax,%es:(%edi)
+  801464:	89 d1                	mov    %edx,%ecx
+  801466:	89 d8                	mov    %ebx,%eax
+  801468:	fc                   	cld
+  801469:	f3 aa                	rep stos %al,%es:(%edi)
+  80146b:	89 f0                	mov    %esi,%eax
+  80146d:	83 c4 04             	add    $0x4,%esp
+  801470:	5b                   	pop    %ebx
+  801471:	5e                   	pop    %esi
+  801472:	5f                   	pop    %edi
+  801473:	5d                   	pop    %ebp
+  801474:	c3                   	ret
+
+00801475 <memmove>:
+  801475:	55                   	push   %ebp
+  801476:	89 e5                	mov    %esp,%ebp
+  801478:	57                   	push   %edi
+  801479:	56                   	push   %esi
+  80147a:	53                   	push   %ebx
+  80147b:	83 ec 0c             	sub    $0xc,%esp
+  80147e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801481:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801484:	8b 45 10             	mov    0x10(%ebp),%eax
+  801487:	85 c0                	test   %eax,%eax
+  801489:	74 14                	je     80149f <memmove+0x2a>
+  80148b:	39 da                	cmp    %ebx,%edx
+  80148d:	73 07                	jae    801496 <memmove+0x21>
+  80148f:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  801492:	39 cb                	cmp    %ecx,%ebx
+  801494:	72 13                	jb     8014a9 <memmove+0x34>
+  801496:	89 c1                	mov    %eax,%ecx
+  801498:	89 d8                	mov    %ebx,%eax
+  80149a:	e8 94 fd ff ff       	call   801233 <copy_fwd>
+  80149f:	89 d8                	mov    %ebx,%eax
+  8014a1:	83 c4 0c             	add    $0xc,%esp
+  8014a4:	5b                   	pop    %ebx
+  8014a5:	5e                   	pop    %esi
+  8014a6:	5f                   	pop    %edi
+  8014a7:	5d                   	pop    %ebp
+  8014a8:	c3                   	ret
+  8014a9:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  8014ac:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  8014af:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  8014b2:	83 f8 0f             	cmp    $0xf,%eax
+  8014b5:	76 23                	jbe    8014da <memmove+0x65>
+  8014b7:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  8014ba:	83 e1 03             	and    $0x3,%ecx
+  8014bd:	29 c8                	sub    %ecx,%eax
+  8014bf:	89 c2                	mov    %eax,%edx
+  8014c1:	c1 ea 02             	shr    $0x2,%edx
+  8014c4:	83 e0 03             	and    $0x3,%eax
+  8014c7:	fd                   	std
+  8014c8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014ca:	83 ef 03             	sub    $0x3,%edi
+  8014cd:	83 ee 03             	sub    $0x3,%esi
+  8014d0:	89 d1                	mov    %edx,%ecx
+  8014d2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8014d4:	83 c7 03             	add    $0x3,%edi
+  8014d7:	83 c6 03             	add    $0x3,%esi
+  8014da:	89 c1                	mov    %eax,%ecx
+  8014dc:	fd                   	std
+  8014dd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014df:	fc                   	cld
+  8014e0:	eb bd                	jmp    80149f <memmove+0x2a>
+
+008014e2 <memcpy>:
+  8014e2:	55                   	push   %ebp
+  8014e3:	89 e5                	mov    %esp,%ebp
+  8014e5:	53                   	push   %ebx
+  8014e6:	83 ec 04             	sub    $0x4,%esp
+  8014e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8014ec:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8014ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014f2:	89 d8                	mov    %ebx,%eax
+  8014f4:	e8 3a fd ff ff       	call   801233 <copy_fwd>
+  8014f9:	89 d8                	mov    %ebx,%eax
+  8014fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014fe:	c9                   	leave
+  8014ff:	c3                   	ret
+
+00801500 <page_copy>:
+  801500:	55                   	push   %ebp
+  801501:	89 e5                	mov    %esp,%ebp
+  801503:	57                   	push   %edi
+  801504:	56                   	push   %esi
+  801505:	53                   	push   %ebx
+  801506:	83 ec 0c             	sub    $0xc,%esp
+  801509:	e8 5c fd ff ff       	call   80126a <have_sse2>
+  80150e:	85 c0                	test   %eax,%eax
+  801510:	74 39                	je     80154b <page_copy+0x4b>
+  801512:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801515:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801518:	be 00 01 00 00       	mov    $0x100,%esi
+  80151d:	8b 03                	mov    (%ebx),%eax
+  80151f:	8b 53 04             	mov    0x4(%ebx),%edx
+  801522:	0f c3 01             	movnti %eax,(%ecx)
+  801525:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  801529:	8b 43 08             	mov    0x8(%ebx),%eax
+  80152c:	8b 53 0c             	mov    0xc(%ebx),%edx
+  80152f:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  801533:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  801537:	83 c3 10             	add    $0x10,%ebx
+  80153a:	83 c1 10             	add    $0x10,%ecx
+  80153d:	4e                   	dec    %esi
+  80153e:	75 dd                	jne    80151d <page_copy+0x1d>
+  801540:	0f ae f8             	sfence
+  801543:	83 c4 0c             	add    $0xc,%esp
+  801546:	5b                   	pop    %ebx
+  801547:	5e                   	pop    %esi
+  801548:	5f                   	pop    %edi
+  801549:	5d                   	pop    %ebp
+  80154a:	c3                   	ret
+  80154b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80154e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801551:	b9 00 04 00 00       	mov    $0x400,%ecx
+  801556:	fc                   	cld
+  801557:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801559:	eb e8                	jmp    801543 <page_copy+0x43>
+
+0080155b <page_zero>:
+  80155b:	55                   	push   %ebp
+  80155c:	89 e5                	mov    %esp,%ebp
+  80155e:	57                   	push   %edi
+  80155f:	83 ec 04             	sub    $0x4,%esp
+  801562:	e8 03 fd ff ff       	call   80126a <have_sse2>
+  801567:	85 c0                	test   %eax,%eax
+  801569:	74 3a                	je     8015a5 <page_zero+0x4a>
+  80156b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80156e:	ba 80 00 00 00       	mov    $0x80,%edx
+  801573:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801578:	0f c3 08             	movnti %ecx,(%eax)
+  80157b:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  80157f:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  801583:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  801587:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  80158b:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  80158f:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  801593:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  801597:	83 c0 20             	add    $0x20,%eax
+  80159a:	4a                   	dec    %edx
+  80159b:	75 db                	jne    801578 <page_zero+0x1d>
+  80159d:	0f ae f8             	sfence
+  8015a0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8015a3:	c9                   	leave
+  8015a4:	c3                   	ret
+  8015a5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015a8:	b9 00 04 00 00       	mov    $0x400,%ecx
+  8015ad:	fc                   	cld
+  8015ae:	f3 ab                	rep stos %eax,%es:(%edi)
+  8015b0:	eb ee                	jmp    8015a0 <page_zero+0x45>
+
+008015b2 <memcmp>:
+  8015b2:	55                   	push   %ebp
+  8015b3:	89 e5                	mov    %esp,%ebp
+  8015b5:	56                   	push   %esi
+  8015b6:	53                   	push   %ebx
+  8015b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015bd:	89 c6                	mov    %eax,%esi
+  8015bf:	03 75 10             	add    0x10(%ebp),%esi
+  8015c2:	eb 06                	jmp    8015ca <memcmp+0x18>
+  8015c4:	83 c0 01             	add    $0x1,%eax
+  8015c7:	83 c2 01             	add    $0x1,%edx
+  8015ca:	39 f0                	cmp    %esi,%eax
+  8015cc:	74 14                	je     8015e2 <memcmp+0x30>
+  8015ce:	0f b6 08             	movzbl (%eax),%ecx
+  8015d1:	0f b6 1a             	movzbl (%edx),%ebx
+  8015d4:	38 d9                	cmp    %bl,%cl
+  8015d6:	74 ec                	je     8015c4 <memcmp+0x12>
+  8015d8:	0f b6 c1             	movzbl %cl,%eax
+  8015db:	0f b6 db             	movzbl %bl,%ebx
+  8015de:	29 d8                	sub    %ebx,%eax
+  8015e0:	eb 05                	jmp    8015e7 <memcmp+0x35>
+  8015e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e7:	5b                   	pop    %ebx
+  8015e8:	5e                   	pop    %esi
+  8015e9:	5d                   	pop    %ebp
+  8015ea:	c3                   	ret
+
+008015eb <memfind>:
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f4:	89 c2                	mov    %eax,%edx
+  8015f6:	03 55 10             	add    0x10(%ebp),%edx
+  8015f9:	eb 03                	jmp    8015fe <memfind+0x13>
+  8015fb:	83 c0 01             	add    $0x1,%eax
+  8015fe:	39 d0                	cmp    %edx,%eax
+  801600:	73 04                	jae    801606 <memfind+0x1b>
+  801602:	38 08                	cmp    %cl,(%eax)
+  801604:	75 f5                	jne    8015fb <memfind+0x10>
+  801606:	5d                   	pop    %ebp
+  801607:	c3                   	ret
+
+00801608 <strtol>:
+  801608:	55                   	push   %ebp
+  801609:	89 e5                	mov    %esp,%ebp
+  80160b:	57                   	push   %edi
+  80160c:	56                   	push   %esi
+  80160d:	53                   	push   %ebx
+  80160e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801611:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801614:	eb 03                	jmp    801619 <strtol+0x11>
+  801616:	83 c2 01             	add    $0x1,%edx
+  801619:	0f b6 02             	movzbl (%edx),%eax
+  80161c:	3c 20                	cmp    $0x20,%al
+  80161e:	74 f6                	je     801616 <strtol+0xe>
+  801620:	3c 09                	cmp    $0x9,%al
+  801622:	74 f2                	je     801616 <strtol+0xe>
+  801624:	3c 2b                	cmp    $0x2b,%al
+  801626:	74 2a                	je     801652 <strtol+0x4a>
+  801628:	bf 00 00 00 00       	mov    $0x0,%edi
+  80162d:	3c 2d                	cmp    $0x2d,%al
+  80162f:	74 2b                	je     80165c <strtol+0x54>
+  801631:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801637:	75 0f                	jne    801648 <strtol+0x40>
+  801639:	80 3a 30             	cmpb   $0x30,(%edx)
+  80163c:	74 28                	je     801666 <strtol+0x5e>
+  80163e:	85 db                	test   %ebx,%ebx
+  801640:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801645:	0f 44 d8             	cmove  %eax,%ebx
+  801648:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80164d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801650:	eb 46                	jmp    801698 <strtol+0x90>
+  801652:	83 c2 01             	add    $0x1,%edx
+  801655:	bf 00 00 00 00       	mov    $0x0,%edi
+  80165a:	eb d5                	jmp    801631 <strtol+0x29>
+  80165c:	83 c2 01             	add    $0x1,%edx
+  80165f:	bf 01 00 00 00       	mov    $0x1,%edi
+  801664:	eb cb                	jmp    801631 <strtol+0x29>
+  801666:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80166a:	74 0e                	je     80167a <strtol+0x72>
+  80166c:	85 db                	test   %ebx,%ebx
+  80166e:	75 d8                	jne    801648 <strtol+0x40>
+  801670:	83 c2 01             	add    $0x1,%edx
+  801673:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801678:	eb ce                	jmp    801648 <strtol+0x40>
+  80167a:	83 c2 02             	add    $0x2,%edx
+  80167d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801682:	eb c4                	jmp    801648 <strtol+0x40>
+  801684:	0f be c0             	movsbl %al,%eax
+  801687:	83 e8 30             	sub    $0x30,%eax
+  80168a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80168d:	7d 3a                	jge    8016c9 <strtol+0xc1>
+  80168f:	83 c2 01             	add    $0x1,%edx
+  801692:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801696:	01 c1                	add    %eax,%ecx
+  801698:	0f b6 02             	movzbl (%edx),%eax
+  80169b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80169e:	89 f3                	mov    %esi,%ebx
+  8016a0:	80 fb 09             	cmp    $0x9,%bl
+  8016a3:	76 df                	jbe    801684 <strtol+0x7c>
+  8016a5:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8016a8:	89 f3                	mov    %esi,%ebx
+  8016aa:	80 fb 19             	cmp    $0x19,%bl
+  8016ad:	77 08                	ja     8016b7 <strtol+0xaf>
+  8016af:	0f be c0             	movsbl %al,%eax
+  8016b2:	83 e8 57             	sub    $0x57,%eax
+  8016b5:	eb d3                	jmp    80168a <strtol+0x82>
+  8016b7:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8016ba:	89 f3                	mov    %esi,%ebx
+  8016bc:	80 fb 19             	cmp    $0x19,%bl
+  8016bf:	77 08                	ja     8016c9 <strtol+0xc1>
+  8016c1:	0f be c0             	movsbl %al,%eax
+  8016c4:	83 e8 37             	sub    $0x37,%eax
+  8016c7:	eb c1                	jmp    80168a <strtol+0x82>
+  8016c9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8016cd:	74 05                	je     8016d4 <strtol+0xcc>
+  8016cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016d2:	89 10                	mov    %edx,(%eax)
+  8016d4:	89 c8                	mov    %ecx,%eax
+  8016d6:	f7 d8                	neg    %eax
+  8016d8:	85 ff                	test   %edi,%edi
+  8016da:	0f 45 c8             	cmovne %eax,%ecx
+  8016dd:	89 c8                	mov    %ecx,%eax
+  8016df:	5b                   	pop    %ebx
+  8016e0:	5e                   	pop    %esi
+  8016e1:	5f                   	pop    %edi
+  8016e2:	5d                   	pop    %ebp
+  8016e3:	c3                   	ret
+
+008016e4 <__udivdi3>:
+  8016e4:	57                   	push   %edi
+  8016e5:	56                   	push   %esi
+  8016e6:	53                   	push   %ebx
+  8016e7:	83 ec 20             	sub    $0x20,%esp
+  8016ea:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8016ee:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8016f2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8016f6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8016fa:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8016fe:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801702:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801706:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80170a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80170e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801712:	89 d1                	mov    %edx,%ecx
+  801714:	09 c1                	or     %eax,%ecx
+  801716:	0f 84 91 00 00 00    	je     8017ad <__udivdi3+0xc9>
+  80171c:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801723:	00 
+  801724:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80172b:	00 
+  80172c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801731:	b8 00 00 00 00       	mov    $0x0,%eax
+  801736:	ba 00 00 00 00       	mov    $0x0,%edx
+  80173b:	eb 08                	jmp    801745 <__udivdi3+0x61>
+  80173d:	83 e9 01             	sub    $0x1,%ecx
+  801740:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801743:	74 68                	je     8017ad <__udivdi3+0xc9>
+  801745:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801749:	01 c0                	add    %eax,%eax
+  80174b:	89 c6                	mov    %eax,%esi
+  80174d:	89 d7                	mov    %edx,%edi
+  80174f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801753:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801757:	0f ad d0             	shrd   %cl,%edx,%eax
+  80175a:	d3 ea                	shr    %cl,%edx
+  80175c:	f6 c1 20             	test   $0x20,%cl
+  80175f:	74 04                	je     801765 <__udivdi3+0x81>
+  801761:	89 d0                	mov    %edx,%eax
+  801763:	31 d2                	xor    %edx,%edx
+  801765:	83 e0 01             	and    $0x1,%eax
+  801768:	89 04 24             	mov    %eax,(%esp)
+  80176b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801772:	00 
+  801773:	8b 04 24             	mov    (%esp),%eax
+  801776:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80177a:	09 f0                	or     %esi,%eax
+  80177c:	09 fa                	or     %edi,%edx
+  80177e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801782:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801786:	39 f0                	cmp    %esi,%eax
+  801788:	89 d3                	mov    %edx,%ebx
+  80178a:	19 fb                	sbb    %edi,%ebx
+  80178c:	72 af                	jb     80173d <__udivdi3+0x59>
+  80178e:	29 f0                	sub    %esi,%eax
+  801790:	19 fa                	sbb    %edi,%edx
+  801792:	89 cf                	mov    %ecx,%edi
+  801794:	c1 ef 05             	shr    $0x5,%edi
+  801797:	83 e7 01             	and    $0x1,%edi
+  80179a:	89 fe                	mov    %edi,%esi
+  80179c:	83 f6 01             	xor    $0x1,%esi
+  80179f:	d3 e6                	shl    %cl,%esi
+  8017a1:	d3 e7                	shl    %cl,%edi
+  8017a3:	09 74 24 18          	or     %esi,0x18(%esp)
+  8017a7:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8017ab:	eb 90                	jmp    80173d <__udivdi3+0x59>
+  8017ad:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8017b1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8017b5:	83 c4 20             	add    $0x20,%esp
+  8017b8:	5b                   	pop    %ebx
+  8017b9:	5e                   	pop    %esi
+  8017ba:	5f                   	pop    %edi
+  8017bb:	c3                   	ret
+
+008017bc <__umoddi3>:
+  8017bc:	55                   	push   %ebp
+  8017bd:	57                   	push   %edi
+  8017be:	56                   	push   %esi
+  8017bf:	53                   	push   %ebx
+  8017c0:	83 ec 1c             	sub    $0x1c,%esp
+  8017c3:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8017c7:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8017cb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8017cf:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8017d3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8017d7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8017db:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8017df:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8017e3:	89 d6                	mov    %edx,%esi
+  8017e5:	09 c6                	or     %eax,%esi
+  8017e7:	74 6c                	je     801855 <__umoddi3+0x99>
+  8017e9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8017ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f8:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  8017fc:	eb 0e                	jmp    80180c <__umoddi3+0x50>
+  8017fe:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801803:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801807:	83 fe ff             	cmp    $0xffffffff,%esi
+  80180a:	74 49                	je     801855 <__umoddi3+0x99>
+  80180c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801810:	01 c0                	add    %eax,%eax
+  801812:	89 c3                	mov    %eax,%ebx
+  801814:	89 d6                	mov    %edx,%esi
+  801816:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80181a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80181e:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801823:	0f ad d0             	shrd   %cl,%edx,%eax
+  801826:	d3 ea                	shr    %cl,%edx
+  801828:	f6 c1 20             	test   $0x20,%cl
+  80182b:	74 04                	je     801831 <__umoddi3+0x75>
+  80182d:	89 d0                	mov    %edx,%eax
+  80182f:	31 d2                	xor    %edx,%edx
+  801831:	83 e0 01             	and    $0x1,%eax
+  801834:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801839:	89 ea                	mov    %ebp,%edx
+  80183b:	09 d8                	or     %ebx,%eax
+  80183d:	09 f2                	or     %esi,%edx
+  80183f:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801843:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801847:	39 d8                	cmp    %ebx,%eax
+  801849:	89 d1                	mov    %edx,%ecx
+  80184b:	19 f1                	sbb    %esi,%ecx
+  80184d:	72 af                	jb     8017fe <__umoddi3+0x42>
+  80184f:	29 d8                	sub    %ebx,%eax
+  801851:	19 f2                	sbb    %esi,%edx
+  801853:	eb a9                	jmp    8017fe <__umoddi3+0x42>
+  801855:	83 c4 1c             	add    $0x1c,%esp
+  801858:	5b                   	pop    %ebx
+  801859:	5e                   	pop    %esi
+  80185a:	5f                   	pop    %edi
+  80185b:	5d                   	pop    %ebp
+  80185c:	c3                   	ret
+
+0080185d <__divdi3>:
+  80185d:	53                   	push   %ebx
+  80185e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801862:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801866:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80186a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80186e:	85 d2                	test   %edx,%edx
+  801870:	78 12                	js     801884 <__divdi3+0x27>
+  801872:	85 db                	test   %ebx,%ebx
+  801874:	78 2e                	js     8018a4 <__divdi3+0x47>
+  801876:	53                   	push   %ebx
+  801877:	51                   	push   %ecx
+  801878:	52                   	push   %edx
+  801879:	50                   	push   %eax
+  80187a:	e8 65 fe ff ff       	call   8016e4 <__udivdi3>
+  80187f:	83 c4 10             	add    $0x10,%esp
+  801882:	eb 1e                	jmp    8018a2 <__divdi3+0x45>
+  801884:	f7 d8                	neg    %eax
+  801886:	83 d2 00             	adc    $0x0,%edx
+  801889:	f7 da                	neg    %edx
+  80188b:	85 db                	test   %ebx,%ebx
+  80188d:	78 2a                	js     8018b9 <__divdi3+0x5c>
+  80188f:	53                   	push   %ebx
+  801890:	51                   	push   %ecx
+  801891:	52                   	push   %edx
+  801892:	50                   	push   %eax
+  801893:	e8 4c fe ff ff       	call   8016e4 <__udivdi3>
+  801898:	83 c4 10             	add    $0x10,%esp
+  80189b:	f7 d8                	neg    %eax
+  80189d:	83 d2 00             	adc    $0x0,%edx
+  8018a0:	f7 da                	neg    %edx
+  8018a2:	5b                   	pop    %ebx
+  8018a3:	c3                   	ret
+  8018a4:	f7 d9                	neg    %ecx
+  8018a6:	83 d3 00             	adc    $0x0,%ebx
+  8018a9:	f7 db                	neg    %ebx
+  8018ab:	53                   	push   %ebx
+  8018ac:	51                   	push   %ecx
+  8018ad:	52                   	push   %edx
+  8018ae:	50                   	push   %eax
+  8018af:	e8 30 fe ff ff       	call   8016e4 <__udivdi3>
+  8018b4:	83 c4 10             	add    $0x10,%esp
+  8018b7:	eb e2                	jmp    80189b <__divdi3+0x3e>
+  8018b9:	f7 d9                	neg    %ecx
+  8018bb:	83 d3 00             	adc    $0x0,%ebx
+  8018be:	f7 db                	neg    %ebx
+  8018c0:	53                   	push   %ebx
+  8018c1:	51                   	push   %ecx
+  8018c2:	52                   	push   %edx
+  8018c3:	50                   	push   %eax
+  8018c4:	e8 1b fe ff ff       	call   8016e4 <__udivdi3>
+  8018c9:	83 c4 10             	add    $0x10,%esp
+  8018cc:	eb d4                	jmp    8018a2 <__divdi3+0x45>
+
+008018ce <__moddi3>:
+  8018ce:	55                   	push   %ebp
+  8018cf:	57                   	push   %edi
+  8018d0:	56                   	push   %esi
+  8018d1:	53                   	push   %ebx
+  8018d2:	83 ec 14             	sub    $0x14,%esp
+  8018d5:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  8018d9:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  8018dd:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8018e1:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8018e5:	85 ed                	test   %ebp,%ebp
+  8018e7:	78 2b                	js     801914 <__moddi3+0x46>
+  8018e9:	89 c6                	mov    %eax,%esi
+  8018eb:	f7 de                	neg    %esi
+  8018ed:	89 34 24             	mov    %esi,(%esp)
+  8018f0:	89 d6                	mov    %edx,%esi
+  8018f2:	83 d6 00             	adc    $0x0,%esi
+  8018f5:	f7 de                	neg    %esi
+  8018f7:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8018fb:	8b 34 24             	mov    (%esp),%esi
+  8018fe:	0f 48 f0             	cmovs  %eax,%esi
+  801901:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801906:	52                   	push   %edx
+  801907:	56                   	push   %esi
+  801908:	55                   	push   %ebp
+  801909:	57                   	push   %edi
+  80190a:	e8 ad fe ff ff       	call   8017bc <__umoddi3>
+  80190f:	83 c4 10             	add    $0x10,%esp
+  801912:	eb 3c                	jmp    801950 <__moddi3+0x82>
+  801914:	89 c3                	mov    %eax,%ebx
+  801916:	f7 db                	neg    %ebx
+  801918:	89 d1                	mov    %edx,%ecx
+  80191a:	83 d1 00             	adc    $0x0,%ecx
+  80191d:	f7 d9                	neg    %ecx
+  80191f:	0f 49 c3             	cmovns %ebx,%eax
+  801922:	89 04 24             	mov    %eax,(%esp)
+  801925:	0f 49 d1             	cmovns %ecx,%edx
+  801928:	89 54 24 04          	mov    %edx,0x4(%esp)
+  80192c:	ff 74 24 04          	push   0x4(%esp)
+  801930:	ff 74 24 04          	push   0x4(%esp)
+  801934:	89 f8                	mov    %edi,%eax
+  801936:	89 ea                	mov    %ebp,%edx
+  801938:	f7 d8                	neg    %eax
+  80193a:	83 d2 00             	adc    $0x0,%edx
+  80193d:	f7 da                	neg    %edx
+  80193f:	52                   	push   %edx
+  801940:	50                   	push   %eax
+  801941:	e8 76 fe ff ff       	call   8017bc <__umoddi3>
+  801946:	83 c4 10             	add    $0x10,%esp
+  801949:	f7 d8                	neg    %eax
+  80194b:	83 d2 00             	adc    $0x0,%edx
+  80194e:	f7 da                	neg    %edx
+  801950:	83 c4 14             	add    $0x14,%esp
+  801953:	5b                   	pop    %ebx
+  801954:	5e                   	pop    %esi
+  801955:	5f                   	pop    %edi
+  801956:	5d                   	pop    %ebp
+  801957:	c3                   	ret
@@ -0,0 +1,2574 @@
+
+obj/user/buggyhello:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 16 00 00 00       	call   800047 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	6a 01                	push   $0x1
+  80003b:	6a 01                	push   $0x1
+  80003d:	e8 68 00 00 00       	call   8000aa <sys_cputs>
+  800042:	83 c4 10             	add    $0x10,%esp
+  800045:	c9                   	leave
+  800046:	c3                   	ret
+
+00800047 <libmain>:
+  800047:	55                   	push   %ebp
+  800048:	89 e5                	mov    %esp,%ebp
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80004f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800052:	e8 cb 09 00 00       	call   800a22 <uinfo_envid>
+  800057:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80005c:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  800062:	05 00 00 00 ed       	add    $0xed000000,%eax
+  800067:	a3 20 20 80 00       	mov    %eax,0x802020
+  80006c:	85 db                	test   %ebx,%ebx
+  80006e:	7e 07                	jle    800077 <libmain+0x30>
+  800070:	8b 06                	mov    (%esi),%eax
+  800072:	a3 00 20 80 00       	mov    %eax,0x802000
+  800077:	83 ec 08             	sub    $0x8,%esp
+  80007a:	56                   	push   %esi
+  80007b:	53                   	push   %ebx
+  80007c:	e8 b2 ff ff ff       	call   800033 <umain>
+  800081:	e8 0a 00 00 00       	call   800090 <exit>
+  800086:	83 c4 10             	add    $0x10,%esp
+  800089:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008c:	5b                   	pop    %ebx
+  80008d:	5e                   	pop    %esi
+  80008e:	5d                   	pop    %ebp
+  80008f:	c3                   	ret
+
+00800090 <exit>:
+  800090:	55                   	push   %ebp
+  800091:	89 e5                	mov    %esp,%ebp
+  800093:	83 ec 08             	sub    $0x8,%esp
+  800096:	e8 20 0a 00 00       	call   800abb <bflush>
+  80009b:	83 ec 0c             	sub    $0xc,%esp
+  80009e:	6a 00                	push   $0x0
+  8000a0:	e8 d3 00 00 00       	call   800178 <sys_env_destroy>
+  8000a5:	83 c4 10             	add    $0x10,%esp
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+
+008000aa <sys_cputs>:
+  8000aa:	55                   	push   %ebp
+  8000ab:	89 e5                	mov    %esp,%ebp
+  8000ad:	57                   	push   %edi
+  8000ae:	56                   	push   %esi
+  8000af:	53                   	push   %ebx
+  8000b0:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000b7:	78 21                	js     8000da <sys_cputs+0x30>
+  8000b9:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000c0:	75 2d                	jne    8000ef <sys_cputs+0x45>
+  8000c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000cd:	89 c3                	mov    %eax,%ebx
+  8000cf:	89 c7                	mov    %eax,%edi
+  8000d1:	89 c6                	mov    %eax,%esi
+  8000d3:	cd 30                	int    $0x30
+  8000d5:	5b                   	pop    %ebx
+  8000d6:	5e                   	pop    %esi
+  8000d7:	5f                   	pop    %edi
+  8000d8:	5d                   	pop    %ebp
+  8000d9:	c3                   	ret
+  8000da:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000df:	0f a2                	cpuid
+  8000e1:	c1 ea 0b             	shr    $0xb,%edx
+  8000e4:	83 e2 01             	and    $0x1,%edx
+  8000e7:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8000ed:	eb ca                	jmp    8000b9 <sys_cputs+0xf>
+  8000ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000fa:	89 c3                	mov    %eax,%ebx
+  8000fc:	89 c7                	mov    %eax,%edi
+  8000fe:	89 c6                	mov    %eax,%esi
+  800100:	55                   	push   %ebp
+  800101:	68 0a 01 80 00       	push   $0x80010a
+  800106:	89 e5                	mov    %esp,%ebp
+  800108:	0f 34                	sysenter
+  80010a:	83 c4 04             	add    $0x4,%esp
+  80010d:	5d                   	pop    %ebp
+  80010e:	eb c5                	jmp    8000d5 <sys_cputs+0x2b>
+
+00800110 <sys_cgetc>:
+  800110:	55                   	push   %ebp
+  800111:	89 e5                	mov    %esp,%ebp
+  800113:	57                   	push   %edi
+  800114:	56                   	push   %esi
+  800115:	53                   	push   %ebx
+  800116:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80011d:	78 22                	js     800141 <sys_cgetc+0x31>
+  80011f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800126:	75 2e                	jne    800156 <sys_cgetc+0x46>
+  800128:	ba 00 00 00 00       	mov    $0x0,%edx
+  80012d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800132:	89 d1                	mov    %edx,%ecx
+  800134:	89 d3                	mov    %edx,%ebx
+  800136:	89 d7                	mov    %edx,%edi
+  800138:	89 d6                	mov    %edx,%esi
+  80013a:	cd 30                	int    $0x30
+  80013c:	5b                   	pop    %ebx
+  80013d:	5e                   	pop    %esi
+  80013e:	5f                   	pop    %edi
+  80013f:	5d                   	pop    %ebp
+  800140:	c3                   	ret
+  800141:	b8 01 00 00 00       	mov    $0x1,%eax
+  800146:	0f a2                	cpuid
+  800148:	c1 ea 0b             	shr    $0xb,%edx
+  80014b:	83 e2 01             	and    $0x1,%edx
+  80014e:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800154:	eb c9                	jmp    80011f <sys_cgetc+0xf>
+  800156:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800160:	89 d1                	mov    %edx,%ecx
+  800162:	89 d3                	mov    %edx,%ebx
+  800164:	89 d7                	mov    %edx,%edi
+  800166:	89 d6                	mov    %edx,%esi
+  800168:	55                   	push   %ebp
+  800169:	68 72 01 80 00       	push   $0x800172
+  80016e:	89 e5                	mov    %esp,%ebp
+  800170:	0f 34                	sysenter
+  800172:	83 c4 04             	add    $0x4,%esp
+  800175:	5d                   	pop    %ebp
+  800176:	eb c4                	jmp    80013c <sys_cgetc+0x2c>
+
+00800178 <sys_env_destroy>:
+  800178:	55                   	push   %ebp
+  800179:	89 e5                	mov    %esp,%ebp
+  80017b:	57                   	push   %edi
+  80017c:	56                   	push   %esi
+  80017d:	53                   	push   %ebx
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+  800181:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800188:	78 2a                	js     8001b4 <sys_env_destroy+0x3c>
+  80018a:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800191:	75 36                	jne    8001c9 <sys_env_destroy+0x51>
+  800193:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800198:	b8 03 00 00 00       	mov    $0x3,%eax
+  80019d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001a0:	89 cb                	mov    %ecx,%ebx
+  8001a2:	89 cf                	mov    %ecx,%edi
+  8001a4:	89 ce                	mov    %ecx,%esi
+  8001a6:	cd 30                	int    $0x30
+  8001a8:	85 c0                	test   %eax,%eax
+  8001aa:	7f 40                	jg     8001ec <sys_env_destroy+0x74>
+  8001ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001af:	5b                   	pop    %ebx
+  8001b0:	5e                   	pop    %esi
+  8001b1:	5f                   	pop    %edi
+  8001b2:	5d                   	pop    %ebp
+  8001b3:	c3                   	ret
+  8001b4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001b9:	0f a2                	cpuid
+  8001bb:	c1 ea 0b             	shr    $0xb,%edx
+  8001be:	83 e2 01             	and    $0x1,%edx
+  8001c1:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8001c7:	eb c1                	jmp    80018a <sys_env_destroy+0x12>
+  8001c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001d1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8001d6:	89 cb                	mov    %ecx,%ebx
+  8001d8:	89 cf                	mov    %ecx,%edi
+  8001da:	89 ce                	mov    %ecx,%esi
+  8001dc:	55                   	push   %ebp
+  8001dd:	68 e6 01 80 00       	push   $0x8001e6
+  8001e2:	89 e5                	mov    %esp,%ebp
+  8001e4:	0f 34                	sysenter
+  8001e6:	83 c4 04             	add    $0x4,%esp
+  8001e9:	5d                   	pop    %ebp
+  8001ea:	eb bc                	jmp    8001a8 <sys_env_destroy+0x30>
+  8001ec:	83 ec 0c             	sub    $0xc,%esp
+  8001ef:	50                   	push   %eax
+  8001f0:	6a 03                	push   $0x3
+  8001f2:	68 8a 19 80 00       	push   $0x80198a
+  8001f7:	6a 49                	push   $0x49
+  8001f9:	68 a7 19 80 00       	push   $0x8019a7
+  8001fe:	e8 af 09 00 00       	call   800bb2 <_panic>
+
+00800203 <sys_getenvid>:
+  800203:	55                   	push   %ebp
+  800204:	89 e5                	mov    %esp,%ebp
+  800206:	57                   	push   %edi
+  800207:	56                   	push   %esi
+  800208:	53                   	push   %ebx
+  800209:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800210:	78 22                	js     800234 <sys_getenvid+0x31>
+  800212:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800219:	75 2e                	jne    800249 <sys_getenvid+0x46>
+  80021b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800220:	b8 02 00 00 00       	mov    $0x2,%eax
+  800225:	89 d1                	mov    %edx,%ecx
+  800227:	89 d3                	mov    %edx,%ebx
+  800229:	89 d7                	mov    %edx,%edi
+  80022b:	89 d6                	mov    %edx,%esi
+  80022d:	cd 30                	int    $0x30
+  80022f:	5b                   	pop    %ebx
+  800230:	5e                   	pop    %esi
+  800231:	5f                   	pop    %edi
+  800232:	5d                   	pop    %ebp
+  800233:	c3                   	ret
+  800234:	b8 01 00 00 00       	mov    $0x1,%eax
+  800239:	0f a2                	cpuid
+  80023b:	c1 ea 0b             	shr    $0xb,%edx
+  80023e:	83 e2 01             	and    $0x1,%edx
+  800241:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800247:	eb c9                	jmp    800212 <sys_getenvid+0xf>
+  800249:	ba 00 00 00 00       	mov    $0x0,%edx
+  80024e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800253:	89 d1                	mov    %edx,%ecx
+  800255:	89 d3                	mov    %edx,%ebx
+  800257:	89 d7                	mov    %edx,%edi
+  800259:	89 d6                	mov    %edx,%esi
+  80025b:	55                   	push   %ebp
+  80025c:	68 65 02 80 00       	push   $0x800265
+  800261:	89 e5                	mov    %esp,%ebp
+  800263:	0f 34                	sysenter
+  800265:	83 c4 04             	add    $0x4,%esp
+  800268:	5d                   	pop    %ebp
+  800269:	eb c4                	jmp    80022f <sys_getenvid+0x2c>
+
+0080026b <sys_yield>:
+  80026b:	55                   	push   %ebp
+  80026c:	89 e5                	mov    %esp,%ebp
+  80026e:	57                   	push   %edi
+  80026f:	56                   	push   %esi
+  800270:	53                   	push   %ebx
+  800271:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800278:	78 22                	js     80029c <sys_yield+0x31>
+  80027a:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800281:	75 2e                	jne    8002b1 <sys_yield+0x46>
+  800283:	ba 00 00 00 00       	mov    $0x0,%edx
+  800288:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80028d:	89 d1                	mov    %edx,%ecx
+  80028f:	89 d3                	mov    %edx,%ebx
+  800291:	89 d7                	mov    %edx,%edi
+  800293:	89 d6                	mov    %edx,%esi
+  800295:	cd 30                	int    $0x30
+  800297:	5b                   	pop    %ebx
+  800298:	5e                   	pop    %esi
+  800299:	5f                   	pop    %edi
+  80029a:	5d                   	pop    %ebp
+  80029b:	c3                   	ret
+  80029c:	b8 01 00 00 00       	mov    $0x1,%eax
+  8002a1:	0f a2                	cpuid
+  8002a3:	c1 ea 0b             	shr    $0xb,%edx
+  8002a6:	83 e2 01             	and    $0x1,%edx
+  8002a9:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8002af:	eb c9                	jmp    80027a <sys_yield+0xf>
+  8002b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002bb:	89 d1                	mov    %edx,%ecx
+  8002bd:	89 d3                	mov    %edx,%ebx
+  8002bf:	89 d7                	mov    %edx,%edi
+  8002c1:	89 d6                	mov    %edx,%esi
+  8002c3:	55                   	push   %ebp
+  8002c4:	68 cd 02 80 00       	push   $0x8002cd
+  8002c9:	89 e5                	mov    %esp,%ebp
+  8002cb:	0f 34                	sysenter
+  8002cd:	83 c4 04             	add    $0x4,%esp
+  8002d0:	5d                   	pop    %ebp
+  8002d1:	eb c4                	jmp    800297 <sys_yield+0x2c>
+
+008002d3 <sys_env_set_cow>:
+  8002d3:	55                   	push   %ebp
+  8002d4:	89 e5                	mov    %esp,%ebp
+  8002d6:	57                   	push   %edi
+  8002d7:	56                   	push   %esi
+  8002d8:	53                   	push   %ebx
+  8002d9:	83 ec 0c             	sub    $0xc,%esp
+  8002dc:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8002e3:	78 2b                	js     800310 <sys_env_set_cow+0x3d>
+  8002e5:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8002ec:	75 37                	jne    800325 <sys_env_set_cow+0x52>
+  8002ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8002f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002fe:	89 df                	mov    %ebx,%edi
+  800300:	89 de                	mov    %ebx,%esi
+  800302:	cd 30                	int    $0x30
+  800304:	85 c0                	test   %eax,%eax
+  800306:	7f 41                	jg     800349 <sys_env_set_cow+0x76>
+  800308:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030b:	5b                   	pop    %ebx
+  80030c:	5e                   	pop    %esi
+  80030d:	5f                   	pop    %edi
+  80030e:	5d                   	pop    %ebp
+  80030f:	c3                   	ret
+  800310:	b8 01 00 00 00       	mov    $0x1,%eax
+  800315:	0f a2                	cpuid
+  800317:	c1 ea 0b             	shr    $0xb,%edx
+  80031a:	83 e2 01             	and    $0x1,%edx
+  80031d:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800323:	eb c0                	jmp    8002e5 <sys_env_set_cow+0x12>
+  800325:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80032a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80032d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800330:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800335:	89 df                	mov    %ebx,%edi
+  800337:	89 de                	mov    %ebx,%esi
+  800339:	55                   	push   %ebp
+  80033a:	68 43 03 80 00       	push   $0x800343
+  80033f:	89 e5                	mov    %esp,%ebp
+  800341:	0f 34                	sysenter
+  800343:	83 c4 04             	add    $0x4,%esp
+  800346:	5d                   	pop    %ebp
+  800347:	eb bb                	jmp    800304 <sys_env_set_cow+0x31>
+  800349:	83 ec 0c             	sub    $0xc,%esp
+  80034c:	50                   	push   %eax
+  80034d:	6a 0d                	push   $0xd
+  80034f:	68 8a 19 80 00       	push   $0x80198a
+  800354:	6a 49                	push   $0x49
+  800356:	68 a7 19 80 00       	push   $0x8019a7
+  80035b:	e8 52 08 00 00       	call   800bb2 <_panic>
+
+00800360 <sys_env_set_quota>:
+  800360:	55                   	push   %ebp
+  800361:	89 e5                	mov    %esp,%ebp
+  800363:	57                   	push   %edi
+  800364:	56                   	push   %esi
+  800365:	53                   	push   %ebx
+  800366:	83 ec 0c             	sub    $0xc,%esp
+  800369:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800370:	78 2b                	js     80039d <sys_env_set_quota+0x3d>
+  800372:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800379:	75 37                	jne    8003b2 <sys_env_set_quota+0x52>
+  80037b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800380:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800385:	8b 55 08             	mov    0x8(%ebp),%edx
+  800388:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80038b:	89 df                	mov    %ebx,%edi
+  80038d:	89 de                	mov    %ebx,%esi
+  80038f:	cd 30                	int    $0x30
+  800391:	85 c0                	test   %eax,%eax
+  800393:	7f 41                	jg     8003d6 <sys_env_set_quota+0x76>
+  800395:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800398:	5b                   	pop    %ebx
+  800399:	5e                   	pop    %esi
+  80039a:	5f                   	pop    %edi
+  80039b:	5d                   	pop    %ebp
+  80039c:	c3                   	ret
+  80039d:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003a2:	0f a2                	cpuid
+  8003a4:	c1 ea 0b             	shr    $0xb,%edx
+  8003a7:	83 e2 01             	and    $0x1,%edx
+  8003aa:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8003b0:	eb c0                	jmp    800372 <sys_env_set_quota+0x12>
+  8003b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003bd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003c2:	89 df                	mov    %ebx,%edi
+  8003c4:	89 de                	mov    %ebx,%esi
+  8003c6:	55                   	push   %ebp
+  8003c7:	68 d0 03 80 00       	push   $0x8003d0
+  8003cc:	89 e5                	mov    %esp,%ebp
+  8003ce:	0f 34                	sysenter
+  8003d0:	83 c4 04             	add    $0x4,%esp
+  8003d3:	5d                   	pop    %ebp
+  8003d4:	eb bb                	jmp    800391 <sys_env_set_quota+0x31>
+  8003d6:	83 ec 0c             	sub    $0xc,%esp
+  8003d9:	50                   	push   %eax
+  8003da:	6a 0f                	push   $0xf
+  8003dc:	68 8a 19 80 00       	push   $0x80198a
+  8003e1:	6a 49                	push   $0x49
+  8003e3:	68 a7 19 80 00       	push   $0x8019a7
+  8003e8:	e8 c5 07 00 00       	call   800bb2 <_panic>
+
+008003ed <sys_page_alloc>:
+  8003ed:	55                   	push   %ebp
+  8003ee:	89 e5                	mov    %esp,%ebp
+  8003f0:	57                   	push   %edi
+  8003f1:	56                   	push   %esi
+  8003f2:	53                   	push   %ebx
+  8003f3:	83 ec 0c             	sub    $0xc,%esp
+  8003f6:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8003fd:	78 2c                	js     80042b <sys_page_alloc+0x3e>
+  8003ff:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800406:	75 38                	jne    800440 <sys_page_alloc+0x53>
+  800408:	be 00 00 00 00       	mov    $0x0,%esi
+  80040d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800412:	8b 55 08             	mov    0x8(%ebp),%edx
+  800415:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800418:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80041b:	89 f7                	mov    %esi,%edi
+  80041d:	cd 30                	int    $0x30
+  80041f:	85 c0                	test   %eax,%eax
+  800421:	7f 42                	jg     800465 <sys_page_alloc+0x78>
+  800423:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800426:	5b                   	pop    %ebx
+  800427:	5e                   	pop    %esi
+  800428:	5f                   	pop    %edi
+  800429:	5d                   	pop    %ebp
+  80042a:	c3                   	ret
+  80042b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800430:	0f a2                	cpuid
+  800432:	c1 ea 0b             	shr    $0xb,%edx
+  800435:	83 e2 01             	and    $0x1,%edx
+  800438:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80043e:	eb bf                	jmp    8003ff <sys_page_alloc+0x12>
+  800440:	be 00 00 00 00       	mov    $0x0,%esi
+  800445:	8b 55 08             	mov    0x8(%ebp),%edx
+  800448:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80044b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800450:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800453:	89 f7                	mov    %esi,%edi
+  800455:	55                   	push   %ebp
+  800456:	68 5f 04 80 00       	push   $0x80045f
+  80045b:	89 e5                	mov    %esp,%ebp
+  80045d:	0f 34                	sysenter
+  80045f:	83 c4 04             	add    $0x4,%esp
+  800462:	5d                   	pop    %ebp
+  800463:	eb ba                	jmp    80041f <sys_page_alloc+0x32>
+  800465:	83 ec 0c             	sub    $0xc,%esp
+  800468:	50                   	push   %eax
+  800469:	6a 04                	push   $0x4
+  80046b:	68 8a 19 80 00       	push   $0x80198a
+  800470:	6a 49                	push   $0x49
+  800472:	68 a7 19 80 00       	push   $0x8019a7
+  800477:	e8 36 07 00 00       	call   800bb2 <_panic>
+
+0080047c <sys_page_map>:
+  80047c:	55                   	push   %ebp
+  80047d:	89 e5                	mov    %esp,%ebp
+  80047f:	57                   	push   %edi
+  800480:	56                   	push   %esi
+  800481:	53                   	push   %ebx
+  800482:	83 ec 0c             	sub    $0xc,%esp
+  800485:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80048c:	78 2b                	js     8004b9 <sys_page_map+0x3d>
+  80048e:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800495:	75 37                	jne    8004ce <sys_page_map+0x52>
+  800497:	b8 05 00 00 00       	mov    $0x5,%eax
+  80049c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004a5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004a8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004ab:	cd 30                	int    $0x30
+  8004ad:	85 c0                	test   %eax,%eax
+  8004af:	7f 41                	jg     8004f2 <sys_page_map+0x76>
+  8004b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b4:	5b                   	pop    %ebx
+  8004b5:	5e                   	pop    %esi
+  8004b6:	5f                   	pop    %edi
+  8004b7:	5d                   	pop    %ebp
+  8004b8:	c3                   	ret
+  8004b9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004be:	0f a2                	cpuid
+  8004c0:	c1 ea 0b             	shr    $0xb,%edx
+  8004c3:	83 e2 01             	and    $0x1,%edx
+  8004c6:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8004cc:	eb c0                	jmp    80048e <sys_page_map+0x12>
+  8004ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004d4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8004d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004dc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004df:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004e2:	55                   	push   %ebp
+  8004e3:	68 ec 04 80 00       	push   $0x8004ec
+  8004e8:	89 e5                	mov    %esp,%ebp
+  8004ea:	0f 34                	sysenter
+  8004ec:	83 c4 04             	add    $0x4,%esp
+  8004ef:	5d                   	pop    %ebp
+  8004f0:	eb bb                	jmp    8004ad <sys_page_map+0x31>
+  8004f2:	83 ec 0c             	sub    $0xc,%esp
+  8004f5:	50                   	push   %eax
+  8004f6:	6a 05                	push   $0x5
+  8004f8:	68 8a 19 80 00       	push   $0x80198a
+  8004fd:	6a 49                	push   $0x49
+  8004ff:	68 a7 19 80 00       	push   $0x8019a7
+  800504:	e8 a9 06 00 00       	call   800bb2 <_panic>
+
+00800509 <sys_page_unmap>:
+  800509:	55                   	push   %ebp
+  80050a:	89 e5                	mov    %esp,%ebp
+  80050c:	57                   	push   %edi
+  80050d:	56                   	push   %esi
+  80050e:	53                   	push   %ebx
+  80050f:	83 ec 0c             	sub    $0xc,%esp
+  800512:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800519:	78 2b                	js     800546 <sys_page_unmap+0x3d>
+  80051b:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800522:	75 37                	jne    80055b <sys_page_unmap+0x52>
+  800524:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800529:	b8 06 00 00 00       	mov    $0x6,%eax
+  80052e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800531:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800534:	89 df                	mov    %ebx,%edi
+  800536:	89 de                	mov    %ebx,%esi
+  800538:	cd 30                	int    $0x30
+  80053a:	85 c0                	test   %eax,%eax
+  80053c:	7f 41                	jg     80057f <sys_page_unmap+0x76>
+  80053e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800541:	5b                   	pop    %ebx
+  800542:	5e                   	pop    %esi
+  800543:	5f                   	pop    %edi
+  800544:	5d                   	pop    %ebp
+  800545:	c3                   	ret
+  800546:	b8 01 00 00 00       	mov    $0x1,%eax
+  80054b:	0f a2                	cpuid
+  80054d:	c1 ea 0b             	shr    $0xb,%edx
+  800550:	83 e2 01             	and    $0x1,%edx
+  800553:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800559:	eb c0                	jmp    80051b <sys_page_unmap+0x12>
+  80055b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800560:	8b 55 08             	mov    0x8(%ebp),%edx
+  800563:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800566:	b8 06 00 00 00       	mov    $0x6,%eax
+  80056b:	89 df                	mov    %ebx,%edi
+  80056d:	89 de                	mov    %ebx,%esi
+  80056f:	55                   	push   %ebp
+  800570:	68 79 05 80 00       	push   $0x800579
+  800575:	89 e5                	mov    %esp,%ebp
+  800577:	0f 34                	sysenter
+  800579:	83 c4 04             	add    $0x4,%esp
+  80057c:	5d                   	pop    %ebp
+  80057d:	eb bb                	jmp    80053a <sys_page_unmap+0x31>
+  80057f:	83 ec 0c             	sub    $0xc,%esp
+  800582:	50                   	push   %eax
+  800583:	6a 06                	push   $0x6
+  800585:	68 8a 19 80 00       	push   $0x80198a
+  80058a:	6a 49                	push   $0x49
+  80058c:	68 a7 19 80 00       	push   $0x8019a7
+  800591:	e8 1c 06 00 00       	call   800bb2 <_panic>
+
+00800596 <sys_page_reuse>:
+  800596:	55                   	push   %ebp
+  800597:	89 e5                	mov    %esp,%ebp
+  800599:	57                   	push   %edi
+  80059a:	56                   	push   %esi
+  80059b:	53                   	push   %ebx
+  80059c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8005a3:	78 24                	js     8005c9 <sys_page_reuse+0x33>
+  8005a5:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8005ac:	75 30                	jne    8005de <sys_page_reuse+0x48>
+  8005ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005b3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005be:	89 df                	mov    %ebx,%edi
+  8005c0:	89 de                	mov    %ebx,%esi
+  8005c2:	cd 30                	int    $0x30
+  8005c4:	5b                   	pop    %ebx
+  8005c5:	5e                   	pop    %esi
+  8005c6:	5f                   	pop    %edi
+  8005c7:	5d                   	pop    %ebp
+  8005c8:	c3                   	ret
+  8005c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005ce:	0f a2                	cpuid
+  8005d0:	c1 ea 0b             	shr    $0xb,%edx
+  8005d3:	83 e2 01             	and    $0x1,%edx
+  8005d6:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8005dc:	eb c7                	jmp    8005a5 <sys_page_reuse+0xf>
+  8005de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005e9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005ee:	89 df                	mov    %ebx,%edi
+  8005f0:	89 de                	mov    %ebx,%esi
+  8005f2:	55                   	push   %ebp
+  8005f3:	68 fc 05 80 00       	push   $0x8005fc
+  8005f8:	89 e5                	mov    %esp,%ebp
+  8005fa:	0f 34                	sysenter
+  8005fc:	83 c4 04             	add    $0x4,%esp
+  8005ff:	5d                   	pop    %ebp
+  800600:	eb c2                	jmp    8005c4 <sys_page_reuse+0x2e>
+
+00800602 <sys_env_set_status>:
+  800602:	55                   	push   %ebp
+  800603:	89 e5                	mov    %esp,%ebp
+  800605:	57                   	push   %edi
+  800606:	56                   	push   %esi
+  800607:	53                   	push   %ebx
+  800608:	83 ec 0c             	sub    $0xc,%esp
+  80060b:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800612:	78 2b                	js     80063f <sys_env_set_status+0x3d>
+  800614:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80061b:	75 37                	jne    800654 <sys_env_set_status+0x52>
+  80061d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800622:	b8 08 00 00 00       	mov    $0x8,%eax
+  800627:	8b 55 08             	mov    0x8(%ebp),%edx
+  80062a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80062d:	89 df                	mov    %ebx,%edi
+  80062f:	89 de                	mov    %ebx,%esi
+  800631:	cd 30                	int    $0x30
+  800633:	85 c0                	test   %eax,%eax
+  800635:	7f 41                	jg     800678 <sys_env_set_status+0x76>
+  800637:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80063a:	5b                   	pop    %ebx
+  80063b:	5e                   	pop    %esi
+  80063c:	5f                   	pop    %edi
+  80063d:	5d                   	pop    %ebp
+  80063e:	c3                   	ret
+  80063f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800644:	0f a2                	cpuid
+  800646:	c1 ea 0b             	shr    $0xb,%edx
+  800649:	83 e2 01             	and    $0x1,%edx
+  80064c:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800652:	eb c0                	jmp    800614 <sys_env_set_status+0x12>
+  800654:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800659:	8b 55 08             	mov    0x8(%ebp),%edx
+  80065c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80065f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800664:	89 df                	mov    %ebx,%edi
+  800666:	89 de                	mov    %ebx,%esi
+  800668:	55                   	push   %ebp
+  800669:	68 72 06 80 00       	push   $0x800672
+  80066e:	89 e5                	mov    %esp,%ebp
+  800670:	0f 34                	sysenter
+  800672:	83 c4 04             	add    $0x4,%esp
+  800675:	5d                   	pop    %ebp
+  800676:	eb bb                	jmp    800633 <sys_env_set_status+0x31>
+  800678:	83 ec 0c             	sub    $0xc,%esp
+  80067b:	50                   	push   %eax
+  80067c:	6a 08                	push   $0x8
+  80067e:	68 8a 19 80 00       	push   $0x80198a
+  800683:	6a 49                	push   $0x49
+  800685:	68 a7 19 80 00       	push   $0x8019a7
+  80068a:	e8 23 05 00 00       	call   800bb2 <_panic>
+
+0080068f <sys_env_set_pgfault_upcall>:
+  80068f:	55                   	push   %ebp
+  800690:	89 e5                	mov    %esp,%ebp
+  800692:	57                   	push   %edi
+  800693:	56                   	push   %esi
+  800694:	53                   	push   %ebx
+  800695:	83 ec 0c             	sub    $0xc,%esp
+  800698:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80069f:	78 2b                	js     8006cc <sys_env_set_pgfault_upcall+0x3d>
+  8006a1:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8006a8:	75 37                	jne    8006e1 <sys_env_set_pgfault_upcall+0x52>
+  8006aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006af:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006ba:	89 df                	mov    %ebx,%edi
+  8006bc:	89 de                	mov    %ebx,%esi
+  8006be:	cd 30                	int    $0x30
+  8006c0:	85 c0                	test   %eax,%eax
+  8006c2:	7f 41                	jg     800705 <sys_env_set_pgfault_upcall+0x76>
+  8006c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006c7:	5b                   	pop    %ebx
+  8006c8:	5e                   	pop    %esi
+  8006c9:	5f                   	pop    %edi
+  8006ca:	5d                   	pop    %ebp
+  8006cb:	c3                   	ret
+  8006cc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006d1:	0f a2                	cpuid
+  8006d3:	c1 ea 0b             	shr    $0xb,%edx
+  8006d6:	83 e2 01             	and    $0x1,%edx
+  8006d9:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8006df:	eb c0                	jmp    8006a1 <sys_env_set_pgfault_upcall+0x12>
+  8006e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006ec:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006f1:	89 df                	mov    %ebx,%edi
+  8006f3:	89 de                	mov    %ebx,%esi
+  8006f5:	55                   	push   %ebp
+  8006f6:	68 ff 06 80 00       	push   $0x8006ff
+  8006fb:	89 e5                	mov    %esp,%ebp
+  8006fd:	0f 34                	sysenter
+  8006ff:	83 c4 04             	add    $0x4,%esp
+  800702:	5d                   	pop    %ebp
+  800703:	eb bb                	jmp    8006c0 <sys_env_set_pgfault_upcall+0x31>
+  800705:	83 ec 0c             	sub    $0xc,%esp
+  800708:	50                   	push   %eax
+  800709:	6a 09                	push   $0x9
+  80070b:	68 8a 19 80 00       	push   $0x80198a
+  800710:	6a 49                	push   $0x49
+  800712:	68 a7 19 80 00       	push   $0x8019a7
+  800717:	e8 96 04 00 00       	call   800bb2 <_panic>
+
+0080071c <sys_env_set_trace>:
+  80071c:	55                   	push   %ebp
+  80071d:	89 e5                	mov    %esp,%ebp
+  80071f:	57                   	push   %edi
+  800720:	56                   	push   %esi
+  800721:	53                   	push   %ebx
+  800722:	83 ec 0c             	sub    $0xc,%esp
+  800725:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80072c:	78 2b                	js     800759 <sys_env_set_trace+0x3d>
+  80072e:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800735:	75 37                	jne    80076e <sys_env_set_trace+0x52>
+  800737:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80073c:	b8 12 00 00 00       	mov    $0x12,%eax
+  800741:	8b 55 08             	mov    0x8(%ebp),%edx
+  800744:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800747:	89 df                	mov    %ebx,%edi
+  800749:	89 de                	mov    %ebx,%esi
+  80074b:	cd 30                	int    $0x30
+  80074d:	85 c0                	test   %eax,%eax
+  80074f:	7f 41                	jg     800792 <sys_env_set_trace+0x76>
+  800751:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800754:	5b                   	pop    %ebx
+  800755:	5e                   	pop    %esi
+  800756:	5f                   	pop    %edi
+  800757:	5d                   	pop    %ebp
+  800758:	c3                   	ret
+  800759:	b8 01 00 00 00       	mov    $0x1,%eax
+  80075e:	0f a2                	cpuid
+  800760:	c1 ea 0b             	shr    $0xb,%edx
+  800763:	83 e2 01             	and    $0x1,%edx
+  800766:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80076c:	eb c0                	jmp    80072e <sys_env_set_trace+0x12>
+  80076e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800773:	8b 55 08             	mov    0x8(%ebp),%edx
+  800776:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800779:	b8 12 00 00 00       	mov    $0x12,%eax
+  80077e:	89 df                	mov    %ebx,%edi
+  800780:	89 de                	mov    %ebx,%esi
+  800782:	55                   	push   %ebp
+  800783:	68 8c 07 80 00       	push   $0x80078c
+  800788:	89 e5                	mov    %esp,%ebp
+  80078a:	0f 34                	sysenter
+  80078c:	83 c4 04             	add    $0x4,%esp
+  80078f:	5d                   	pop    %ebp
+  800790:	eb bb                	jmp    80074d <sys_env_set_trace+0x31>
+  800792:	83 ec 0c             	sub    $0xc,%esp
+  800795:	50                   	push   %eax
+  800796:	6a 12                	push   $0x12
+  800798:	68 8a 19 80 00       	push   $0x80198a
+  80079d:	6a 49                	push   $0x49
+  80079f:	68 a7 19 80 00       	push   $0x8019a7
+  8007a4:	e8 09 04 00 00       	call   800bb2 <_panic>
+
+008007a9 <sys_env_set_rdpmc>:
+  8007a9:	55                   	push   %ebp
+  8007aa:	89 e5                	mov    %esp,%ebp
+  8007ac:	57                   	push   %edi
+  8007ad:	56                   	push   %esi
+  8007ae:	53                   	push   %ebx
+  8007af:	83 ec 0c             	sub    $0xc,%esp
+  8007b2:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007b9:	78 2b                	js     8007e6 <sys_env_set_rdpmc+0x3d>
+  8007bb:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007c2:	75 37                	jne    8007fb <sys_env_set_rdpmc+0x52>
+  8007c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007c9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8007ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007d4:	89 df                	mov    %ebx,%edi
+  8007d6:	89 de                	mov    %ebx,%esi
+  8007d8:	cd 30                	int    $0x30
+  8007da:	85 c0                	test   %eax,%eax
+  8007dc:	7f 41                	jg     80081f <sys_env_set_rdpmc+0x76>
+  8007de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e1:	5b                   	pop    %ebx
+  8007e2:	5e                   	pop    %esi
+  8007e3:	5f                   	pop    %edi
+  8007e4:	5d                   	pop    %ebp
+  8007e5:	c3                   	ret
+  8007e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007eb:	0f a2                	cpuid
+  8007ed:	c1 ea 0b             	shr    $0xb,%edx
+  8007f0:	83 e2 01             	and    $0x1,%edx
+  8007f3:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8007f9:	eb c0                	jmp    8007bb <sys_env_set_rdpmc+0x12>
+  8007fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800800:	8b 55 08             	mov    0x8(%ebp),%edx
+  800803:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800806:	b8 13 00 00 00       	mov    $0x13,%eax
+  80080b:	89 df                	mov    %ebx,%edi
+  80080d:	89 de                	mov    %ebx,%esi
+  80080f:	55                   	push   %ebp
+  800810:	68 19 08 80 00       	push   $0x800819
+  800815:	89 e5                	mov    %esp,%ebp
+  800817:	0f 34                	sysenter
+  800819:	83 c4 04             	add    $0x4,%esp
+  80081c:	5d                   	pop    %ebp
+  80081d:	eb bb                	jmp    8007da <sys_env_set_rdpmc+0x31>
+  80081f:	83 ec 0c             	sub    $0xc,%esp
+  800822:	50                   	push   %eax
+  800823:	6a 13                	push   $0x13
+  800825:	68 8a 19 80 00       	push   $0x80198a
+  80082a:	6a 49                	push   $0x49
+  80082c:	68 a7 19 80 00       	push   $0x8019a7
+  800831:	e8 7c 03 00 00       	call   800bb2 <_panic>
+
+00800836 <sys_ring_setup>:
+  800836:	55                   	push   %ebp
+  800837:	89 e5                	mov    %esp,%ebp
+  800839:	57                   	push   %edi
+  80083a:	56                   	push   %esi
+  80083b:	53                   	push   %ebx
+  80083c:	83 ec 0c             	sub    $0xc,%esp
+  80083f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800846:	78 29                	js     800871 <sys_ring_setup+0x3b>
+  800848:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80084f:	75 35                	jne    800886 <sys_ring_setup+0x50>
+  800851:	ba 00 00 00 00       	mov    $0x0,%edx
+  800856:	b8 10 00 00 00       	mov    $0x10,%eax
+  80085b:	89 d1                	mov    %edx,%ecx
+  80085d:	89 d3                	mov    %edx,%ebx
+  80085f:	89 d7                	mov    %edx,%edi
+  800861:	89 d6                	mov    %edx,%esi
+  800863:	cd 30                	int    $0x30
+  800865:	85 c0                	test   %eax,%eax
+  800867:	7f 3f                	jg     8008a8 <sys_ring_setup+0x72>
+  800869:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80086c:	5b                   	pop    %ebx
+  80086d:	5e                   	pop    %esi
+  80086e:	5f                   	pop    %edi
+  80086f:	5d                   	pop    %ebp
+  800870:	c3                   	ret
+  800871:	b8 01 00 00 00       	mov    $0x1,%eax
+  800876:	0f a2                	cpuid
+  800878:	c1 ea 0b             	shr    $0xb,%edx
+  80087b:	83 e2 01             	and    $0x1,%edx
+  80087e:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800884:	eb c2                	jmp    800848 <sys_ring_setup+0x12>
+  800886:	ba 00 00 00 00       	mov    $0x0,%edx
+  80088b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800890:	89 d1                	mov    %edx,%ecx
+  800892:	89 d3                	mov    %edx,%ebx
+  800894:	89 d7                	mov    %edx,%edi
+  800896:	89 d6                	mov    %edx,%esi
+  800898:	55                   	push   %ebp
+  800899:	68 a2 08 80 00       	push   $0x8008a2
+  80089e:	89 e5                	mov    %esp,%ebp
+  8008a0:	0f 34                	sysenter
+  8008a2:	83 c4 04             	add    $0x4,%esp
+  8008a5:	5d                   	pop    %ebp
+  8008a6:	eb bd                	jmp    800865 <sys_ring_setup+0x2f>
+  8008a8:	83 ec 0c             	sub    $0xc,%esp
+  8008ab:	50                   	push   %eax
+  8008ac:	6a 10                	push   $0x10
+  8008ae:	68 8a 19 80 00       	push   $0x80198a
+  8008b3:	6a 49                	push   $0x49
+  8008b5:	68 a7 19 80 00       	push   $0x8019a7
+  8008ba:	e8 f3 02 00 00       	call   800bb2 <_panic>
+
+008008bf <sys_ring_enter>:
+  8008bf:	55                   	push   %ebp
+  8008c0:	89 e5                	mov    %esp,%ebp
+  8008c2:	57                   	push   %edi
+  8008c3:	56                   	push   %esi
+  8008c4:	53                   	push   %ebx
+  8008c5:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008cc:	78 22                	js     8008f0 <sys_ring_enter+0x31>
+  8008ce:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008d5:	75 2e                	jne    800905 <sys_ring_enter+0x46>
+  8008d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008dc:	b8 11 00 00 00       	mov    $0x11,%eax
+  8008e1:	89 d1                	mov    %edx,%ecx
+  8008e3:	89 d3                	mov    %edx,%ebx
+  8008e5:	89 d7                	mov    %edx,%edi
+  8008e7:	89 d6                	mov    %edx,%esi
+  8008e9:	cd 30                	int    $0x30
+  8008eb:	5b                   	pop    %ebx
+  8008ec:	5e                   	pop    %esi
+  8008ed:	5f                   	pop    %edi
+  8008ee:	5d                   	pop    %ebp
+  8008ef:	c3                   	ret
+  8008f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008f5:	0f a2                	cpuid
+  8008f7:	c1 ea 0b             	shr    $0xb,%edx
+  8008fa:	83 e2 01             	and    $0x1,%edx
+  8008fd:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800903:	eb c9                	jmp    8008ce <sys_ring_enter+0xf>
+  800905:	ba 00 00 00 00       	mov    $0x0,%edx
+  80090a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80090f:	89 d1                	mov    %edx,%ecx
+  800911:	89 d3                	mov    %edx,%ebx
+  800913:	89 d7                	mov    %edx,%edi
+  800915:	89 d6                	mov    %edx,%esi
+  800917:	55                   	push   %ebp
+  800918:	68 21 09 80 00       	push   $0x800921
+  80091d:	89 e5                	mov    %esp,%ebp
+  80091f:	0f 34                	sysenter
+  800921:	83 c4 04             	add    $0x4,%esp
+  800924:	5d                   	pop    %ebp
+  800925:	eb c4                	jmp    8008eb <sys_ring_enter+0x2c>
+
+00800927 <sys_ipc_try_send>:
+  800927:	55                   	push   %ebp
+  800928:	89 e5                	mov    %esp,%ebp
+  80092a:	57                   	push   %edi
+  80092b:	56                   	push   %esi
+  80092c:	53                   	push   %ebx
+  80092d:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800934:	78 26                	js     80095c <sys_ipc_try_send+0x35>
+  800936:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80093d:	75 32                	jne    800971 <sys_ipc_try_send+0x4a>
+  80093f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800944:	be 00 00 00 00       	mov    $0x0,%esi
+  800949:	8b 55 08             	mov    0x8(%ebp),%edx
+  80094c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80094f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800952:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800955:	cd 30                	int    $0x30
+  800957:	5b                   	pop    %ebx
+  800958:	5e                   	pop    %esi
+  800959:	5f                   	pop    %edi
+  80095a:	5d                   	pop    %ebp
+  80095b:	c3                   	ret
+  80095c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800961:	0f a2                	cpuid
+  800963:	c1 ea 0b             	shr    $0xb,%edx
+  800966:	83 e2 01             	and    $0x1,%edx
+  800969:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80096f:	eb c5                	jmp    800936 <sys_ipc_try_send+0xf>
+  800971:	8b 55 08             	mov    0x8(%ebp),%edx
+  800974:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800977:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80097c:	be 00 00 00 00       	mov    $0x0,%esi
+  800981:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800984:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800987:	55                   	push   %ebp
+  800988:	68 91 09 80 00       	push   $0x800991
+  80098d:	89 e5                	mov    %esp,%ebp
+  80098f:	0f 34                	sysenter
+  800991:	83 c4 04             	add    $0x4,%esp
+  800994:	5d                   	pop    %ebp
+  800995:	eb c0                	jmp    800957 <sys_ipc_try_send+0x30>
+
+00800997 <sys_ipc_recv>:
+  800997:	55                   	push   %ebp
+  800998:	89 e5                	mov    %esp,%ebp
+  80099a:	57                   	push   %edi
+  80099b:	56                   	push   %esi
+  80099c:	53                   	push   %ebx
+  80099d:	83 ec 0c             	sub    $0xc,%esp
+  8009a0:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8009a7:	78 2a                	js     8009d3 <sys_ipc_recv+0x3c>
+  8009a9:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8009b0:	75 36                	jne    8009e8 <sys_ipc_recv+0x51>
+  8009b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009b7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009bf:	89 cb                	mov    %ecx,%ebx
+  8009c1:	89 cf                	mov    %ecx,%edi
+  8009c3:	89 ce                	mov    %ecx,%esi
+  8009c5:	cd 30                	int    $0x30
+  8009c7:	85 c0                	test   %eax,%eax
+  8009c9:	7f 40                	jg     800a0b <sys_ipc_recv+0x74>
+  8009cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009ce:	5b                   	pop    %ebx
+  8009cf:	5e                   	pop    %esi
+  8009d0:	5f                   	pop    %edi
+  8009d1:	5d                   	pop    %ebp
+  8009d2:	c3                   	ret
+  8009d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8009d8:	0f a2                	cpuid
+  8009da:	c1 ea 0b             	shr    $0xb,%edx
+  8009dd:	83 e2 01             	and    $0x1,%edx
+  8009e0:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8009e6:	eb c1                	jmp    8009a9 <sys_ipc_recv+0x12>
+  8009e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009f5:	89 cb                	mov    %ecx,%ebx
+  8009f7:	89 cf                	mov    %ecx,%edi
+  8009f9:	89 ce                	mov    %ecx,%esi
+  8009fb:	55                   	push   %ebp
+  8009fc:	68 05 0a 80 00       	push   $0x800a05
+  800a01:	89 e5                	mov    %esp,%ebp
+  800a03:	0f 34                	sysenter
+  800a05:	83 c4 04             	add    $0x4,%esp
+  800a08:	5d                   	pop    %ebp
+  800a09:	eb bc                	jmp    8009c7 <sys_ipc_recv+0x30>
+  800a0b:	83 ec 0c             	sub    $0xc,%esp
+  800a0e:	50                   	push   %eax
+  800a0f:	6a 0c                	push   $0xc
+  800a11:	68 8a 19 80 00       	push   $0x80198a
+  800a16:	6a 49                	push   $0x49
+  800a18:	68 a7 19 80 00       	push   $0x8019a7
+  800a1d:	e8 90 01 00 00       	call   800bb2 <_panic>
+
+00800a22 <uinfo_envid>:
+  800a22:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  800a27:	c3                   	ret
+
+00800a28 <uinfo_cpunum>:
+  800a28:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  800a2d:	c3                   	ret
+
+00800a2e <uinfo_ticks>:
+  800a2e:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  800a33:	c3                   	ret
+
+00800a34 <uinfo_nsec>:
+  800a34:	55                   	push   %ebp
+  800a35:	89 e5                	mov    %esp,%ebp
+  800a37:	57                   	push   %edi
+  800a38:	56                   	push   %esi
+  800a39:	53                   	push   %ebx
+  800a3a:	83 ec 1c             	sub    $0x1c,%esp
+  800a3d:	0f 31                	rdtsc
+  800a3f:	89 c6                	mov    %eax,%esi
+  800a41:	89 d7                	mov    %edx,%edi
+  800a43:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  800a49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a53:	85 c9                	test   %ecx,%ecx
+  800a55:	74 5c                	je     800ab3 <uinfo_nsec+0x7f>
+  800a57:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a5c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800a5f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800a62:	52                   	push   %edx
+  800a63:	51                   	push   %ecx
+  800a64:	57                   	push   %edi
+  800a65:	56                   	push   %esi
+  800a66:	e8 63 0d 00 00       	call   8017ce <__umoddi3>
+  800a6b:	83 c4 10             	add    $0x10,%esp
+  800a6e:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800a74:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  800a79:	f7 e3                	mul    %ebx
+  800a7b:	01 ca                	add    %ecx,%edx
+  800a7d:	ff 75 e4             	push   -0x1c(%ebp)
+  800a80:	ff 75 e0             	push   -0x20(%ebp)
+  800a83:	52                   	push   %edx
+  800a84:	50                   	push   %eax
+  800a85:	e8 6c 0c 00 00       	call   8016f6 <__udivdi3>
+  800a8a:	83 c4 10             	add    $0x10,%esp
+  800a8d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a90:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a93:	ff 75 e4             	push   -0x1c(%ebp)
+  800a96:	ff 75 e0             	push   -0x20(%ebp)
+  800a99:	57                   	push   %edi
+  800a9a:	56                   	push   %esi
+  800a9b:	e8 56 0c 00 00       	call   8016f6 <__udivdi3>
+  800aa0:	83 c4 10             	add    $0x10,%esp
+  800aa3:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800aa9:	f7 e3                	mul    %ebx
+  800aab:	01 ca                	add    %ecx,%edx
+  800aad:	03 45 d8             	add    -0x28(%ebp),%eax
+  800ab0:	13 55 dc             	adc    -0x24(%ebp),%edx
+  800ab3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ab6:	5b                   	pop    %ebx
+  800ab7:	5e                   	pop    %esi
+  800ab8:	5f                   	pop    %edi
+  800ab9:	5d                   	pop    %ebp
+  800aba:	c3                   	ret
+
+00800abb <bflush>:
+  800abb:	a1 40 20 80 00       	mov    0x802040,%eax
+  800ac0:	85 c0                	test   %eax,%eax
+  800ac2:	75 01                	jne    800ac5 <bflush+0xa>
+  800ac4:	c3                   	ret
+  800ac5:	55                   	push   %ebp
+  800ac6:	89 e5                	mov    %esp,%ebp
+  800ac8:	83 ec 10             	sub    $0x10,%esp
+  800acb:	50                   	push   %eax
+  800acc:	68 44 20 80 00       	push   $0x802044
+  800ad1:	e8 d4 f5 ff ff       	call   8000aa <sys_cputs>
+  800ad6:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  800add:	00 00 00 
+  800ae0:	83 c4 10             	add    $0x10,%esp
+  800ae3:	c9                   	leave
+  800ae4:	c3                   	ret
+
+00800ae5 <bputch>:
+  800ae5:	55                   	push   %ebp
+  800ae6:	89 e5                	mov    %esp,%ebp
+  800ae8:	53                   	push   %ebx
+  800ae9:	83 ec 04             	sub    $0x4,%esp
+  800aec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800aef:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  800af5:	8d 42 01             	lea    0x1(%edx),%eax
+  800af8:	a3 40 20 80 00       	mov    %eax,0x802040
+  800afd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b00:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  800b06:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b0b:	77 08                	ja     800b15 <bputch+0x30>
+  800b0d:	83 03 01             	addl   $0x1,(%ebx)
+  800b10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b13:	c9                   	leave
+  800b14:	c3                   	ret
+  800b15:	e8 a1 ff ff ff       	call   800abb <bflush>
+  800b1a:	eb f1                	jmp    800b0d <bputch+0x28>
+
+00800b1c <vbprintf>:
+  800b1c:	55                   	push   %ebp
+  800b1d:	89 e5                	mov    %esp,%ebp
+  800b1f:	83 ec 18             	sub    $0x18,%esp
+  800b22:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800b29:	ff 75 0c             	push   0xc(%ebp)
+  800b2c:	ff 75 08             	push   0x8(%ebp)
+  800b2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b32:	50                   	push   %eax
+  800b33:	68 e5 0a 80 00       	push   $0x800ae5
+  800b38:	e8 4c 02 00 00       	call   800d89 <vprintfmt>
+  800b3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b40:	c9                   	leave
+  800b41:	c3                   	ret
+
+00800b42 <bprintf>:
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	83 ec 10             	sub    $0x10,%esp
+  800b48:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800b4b:	50                   	push   %eax
+  800b4c:	ff 75 08             	push   0x8(%ebp)
+  800b4f:	e8 c8 ff ff ff       	call   800b1c <vbprintf>
+  800b54:	c9                   	leave
+  800b55:	c3                   	ret
+
+00800b56 <bwrite>:
+  800b56:	55                   	push   %ebp
+  800b57:	89 e5                	mov    %esp,%ebp
+  800b59:	53                   	push   %ebx
+  800b5a:	83 ec 04             	sub    $0x4,%esp
+  800b5d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b60:	89 d8                	mov    %ebx,%eax
+  800b62:	03 05 40 20 80 00    	add    0x802040,%eax
+  800b68:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b6d:	76 0d                	jbe    800b7c <bwrite+0x26>
+  800b6f:	e8 47 ff ff ff       	call   800abb <bflush>
+  800b74:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  800b7a:	77 25                	ja     800ba1 <bwrite+0x4b>
+  800b7c:	83 ec 04             	sub    $0x4,%esp
+  800b7f:	53                   	push   %ebx
+  800b80:	ff 75 08             	push   0x8(%ebp)
+  800b83:	a1 40 20 80 00       	mov    0x802040,%eax
+  800b88:	05 44 20 80 00       	add    $0x802044,%eax
+  800b8d:	50                   	push   %eax
+  800b8e:	e8 61 09 00 00       	call   8014f4 <memcpy>
+  800b93:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  800b99:	83 c4 10             	add    $0x10,%esp
+  800b9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b9f:	c9                   	leave
+  800ba0:	c3                   	ret
+  800ba1:	83 ec 08             	sub    $0x8,%esp
+  800ba4:	53                   	push   %ebx
+  800ba5:	ff 75 08             	push   0x8(%ebp)
+  800ba8:	e8 fd f4 ff ff       	call   8000aa <sys_cputs>
+  800bad:	83 c4 10             	add    $0x10,%esp
+  800bb0:	eb ea                	jmp    800b9c <bwrite+0x46>
+
+00800bb2 <_panic>:
+  800bb2:	55                   	push   %ebp
+  800bb3:	89 e5                	mov    %esp,%ebp
+  800bb5:	56                   	push   %esi
+  800bb6:	53                   	push   %ebx
+  800bb7:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800bba:	e8 fc fe ff ff       	call   800abb <bflush>
+  800bbf:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  800bc5:	e8 39 f6 ff ff       	call   800203 <sys_getenvid>
+  800bca:	83 ec 0c             	sub    $0xc,%esp
+  800bcd:	ff 75 0c             	push   0xc(%ebp)
+  800bd0:	ff 75 08             	push   0x8(%ebp)
+  800bd3:	56                   	push   %esi
+  800bd4:	50                   	push   %eax
+  800bd5:	68 b8 19 80 00       	push   $0x8019b8
+  800bda:	e8 b3 00 00 00       	call   800c92 <cprintf>
+  800bdf:	83 c4 18             	add    $0x18,%esp
+  800be2:	53                   	push   %ebx
+  800be3:	ff 75 10             	push   0x10(%ebp)
+  800be6:	e8 56 00 00 00       	call   800c41 <vcprintf>
+  800beb:	c7 04 24 db 19 80 00 	movl   $0x8019db,(%esp)
+  800bf2:	e8 9b 00 00 00       	call   800c92 <cprintf>
+  800bf7:	83 c4 10             	add    $0x10,%esp
+  800bfa:	cc                   	int3
+  800bfb:	eb fd                	jmp    800bfa <_panic+0x48>
+
+00800bfd <putch>:
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	53                   	push   %ebx
+  800c01:	83 ec 04             	sub    $0x4,%esp
+  800c04:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c07:	8b 13                	mov    (%ebx),%edx
+  800c09:	8d 42 01             	lea    0x1(%edx),%eax
+  800c0c:	89 03                	mov    %eax,(%ebx)
+  800c0e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c11:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800c15:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800c1a:	74 09                	je     800c25 <putch+0x28>
+  800c1c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800c20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c23:	c9                   	leave
+  800c24:	c3                   	ret
+  800c25:	83 ec 08             	sub    $0x8,%esp
+  800c28:	68 ff 00 00 00       	push   $0xff
+  800c2d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800c30:	50                   	push   %eax
+  800c31:	e8 74 f4 ff ff       	call   8000aa <sys_cputs>
+  800c36:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800c3c:	83 c4 10             	add    $0x10,%esp
+  800c3f:	eb db                	jmp    800c1c <putch+0x1f>
+
+00800c41 <vcprintf>:
+  800c41:	55                   	push   %ebp
+  800c42:	89 e5                	mov    %esp,%ebp
+  800c44:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800c4a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800c51:	00 00 00 
+  800c54:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800c5b:	00 00 00 
+  800c5e:	ff 75 0c             	push   0xc(%ebp)
+  800c61:	ff 75 08             	push   0x8(%ebp)
+  800c64:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800c6a:	50                   	push   %eax
+  800c6b:	68 fd 0b 80 00       	push   $0x800bfd
+  800c70:	e8 14 01 00 00       	call   800d89 <vprintfmt>
+  800c75:	83 c4 08             	add    $0x8,%esp
+  800c78:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800c7e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800c84:	50                   	push   %eax
+  800c85:	e8 20 f4 ff ff       	call   8000aa <sys_cputs>
+  800c8a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800c90:	c9                   	leave
+  800c91:	c3                   	ret
+
+00800c92 <cprintf>:
+  800c92:	55                   	push   %ebp
+  800c93:	89 e5                	mov    %esp,%ebp
+  800c95:	83 ec 10             	sub    $0x10,%esp
+  800c98:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800c9b:	50                   	push   %eax
+  800c9c:	ff 75 08             	push   0x8(%ebp)
+  800c9f:	e8 9d ff ff ff       	call   800c41 <vcprintf>
+  800ca4:	c9                   	leave
+  800ca5:	c3                   	ret
+
+00800ca6 <printnum>:
+  800ca6:	55                   	push   %ebp
+  800ca7:	89 e5                	mov    %esp,%ebp
+  800ca9:	57                   	push   %edi
+  800caa:	56                   	push   %esi
+  800cab:	53                   	push   %ebx
+  800cac:	83 ec 1c             	sub    $0x1c,%esp
+  800caf:	89 c7                	mov    %eax,%edi
+  800cb1:	89 d6                	mov    %edx,%esi
+  800cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cb9:	89 d1                	mov    %edx,%ecx
+  800cbb:	89 c2                	mov    %eax,%edx
+  800cbd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cc0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800cc3:	8b 45 10             	mov    0x10(%ebp),%eax
+  800cc6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800cc9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800ccc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800cd3:	39 c2                	cmp    %eax,%edx
+  800cd5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800cd8:	72 3e                	jb     800d18 <printnum+0x72>
+  800cda:	83 ec 0c             	sub    $0xc,%esp
+  800cdd:	ff 75 18             	push   0x18(%ebp)
+  800ce0:	83 eb 01             	sub    $0x1,%ebx
+  800ce3:	53                   	push   %ebx
+  800ce4:	50                   	push   %eax
+  800ce5:	83 ec 08             	sub    $0x8,%esp
+  800ce8:	ff 75 e4             	push   -0x1c(%ebp)
+  800ceb:	ff 75 e0             	push   -0x20(%ebp)
+  800cee:	ff 75 dc             	push   -0x24(%ebp)
+  800cf1:	ff 75 d8             	push   -0x28(%ebp)
+  800cf4:	e8 fd 09 00 00       	call   8016f6 <__udivdi3>
+  800cf9:	83 c4 18             	add    $0x18,%esp
+  800cfc:	52                   	push   %edx
+  800cfd:	50                   	push   %eax
+  800cfe:	89 f2                	mov    %esi,%edx
+  800d00:	89 f8                	mov    %edi,%eax
+  800d02:	e8 9f ff ff ff       	call   800ca6 <printnum>
+  800d07:	83 c4 20             	add    $0x20,%esp
+  800d0a:	eb 13                	jmp    800d1f <printnum+0x79>
+  800d0c:	83 ec 08             	sub    $0x8,%esp
+  800d0f:	56                   	push   %esi
+  800d10:	ff 75 18             	push   0x18(%ebp)
+  800d13:	ff d7                	call   *%edi
+  800d15:	83 c4 10             	add    $0x10,%esp
+  800d18:	83 eb 01             	sub    $0x1,%ebx
+  800d1b:	85 db                	test   %ebx,%ebx
+  800d1d:	7f ed                	jg     800d0c <printnum+0x66>
+  800d1f:	83 ec 08             	sub    $0x8,%esp
+  800d22:	56                   	push   %esi
+  800d23:	83 ec 04             	sub    $0x4,%esp
+  800d26:	ff 75 e4             	push   -0x1c(%ebp)
+  800d29:	ff 75 e0             	push   -0x20(%ebp)
+  800d2c:	ff 75 dc             	push   -0x24(%ebp)
+  800d2f:	ff 75 d8             	push   -0x28(%ebp)
+  800d32:	e8 97 0a 00 00       	call   8017ce <__umoddi3>
+  800d37:	83 c4 14             	add    $0x14,%esp
+  800d3a:	0f be 80 dd 19 80 00 	movsbl 0x8019dd(%eax),%eax
+  800d41:	50                   	push   %eax
+  800d42:	ff d7                	call   *%edi
+  800d44:	83 c4 10             	add    $0x10,%esp
+  800d47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4a:	5b                   	pop    %ebx
+  800d4b:	5e                   	pop    %esi
+  800d4c:	5f                   	pop    %edi
+  800d4d:	5d                   	pop    %ebp
+  800d4e:	c3                   	ret
+
+00800d4f <sprintputch>:
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d55:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800d59:	8b 10                	mov    (%eax),%edx
+  800d5b:	3b 50 04             	cmp    0x4(%eax),%edx
+  800d5e:	73 0a                	jae    800d6a <sprintputch+0x1b>
+  800d60:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800d63:	89 08                	mov    %ecx,(%eax)
+  800d65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d68:	88 02                	mov    %al,(%edx)
+  800d6a:	5d                   	pop    %ebp
+  800d6b:	c3                   	ret
+
+00800d6c <printfmt>:
+  800d6c:	55                   	push   %ebp
+  800d6d:	89 e5                	mov    %esp,%ebp
+  800d6f:	83 ec 08             	sub    $0x8,%esp
+  800d72:	8d 45 14             	lea    0x14(%ebp),%eax
+  800d75:	50                   	push   %eax
+  800d76:	ff 75 10             	push   0x10(%ebp)
+  800d79:	ff 75 0c             	push   0xc(%ebp)
+  800d7c:	ff 75 08             	push   0x8(%ebp)
+  800d7f:	e8 05 00 00 00       	call   800d89 <vprintfmt>
+  800d84:	83 c4 10             	add    $0x10,%esp
+  800d87:	c9                   	leave
+  800d88:	c3                   	ret
+
+00800d89 <vprintfmt>:
+  800d89:	55                   	push   %ebp
+  800d8a:	89 e5                	mov    %esp,%ebp
+  800d8c:	57                   	push   %edi
+  800d8d:	56                   	push   %esi
+  800d8e:	53                   	push   %ebx
+  800d8f:	83 ec 2c             	sub    $0x2c,%esp
+  800d92:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d95:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d98:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d9b:	eb 0a                	jmp    800da7 <vprintfmt+0x1e>
+  800d9d:	83 ec 08             	sub    $0x8,%esp
+  800da0:	53                   	push   %ebx
+  800da1:	50                   	push   %eax
+  800da2:	ff d6                	call   *%esi
+  800da4:	83 c4 10             	add    $0x10,%esp
+  800da7:	83 c7 01             	add    $0x1,%edi
+  800daa:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800dae:	83 f8 25             	cmp    $0x25,%eax
+  800db1:	74 0c                	je     800dbf <vprintfmt+0x36>
+  800db3:	85 c0                	test   %eax,%eax
+  800db5:	75 e6                	jne    800d9d <vprintfmt+0x14>
+  800db7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dba:	5b                   	pop    %ebx
+  800dbb:	5e                   	pop    %esi
+  800dbc:	5f                   	pop    %edi
+  800dbd:	5d                   	pop    %ebp
+  800dbe:	c3                   	ret
+  800dbf:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800dc3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800dca:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800dd1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800dd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ddd:	8d 47 01             	lea    0x1(%edi),%eax
+  800de0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800de3:	0f b6 17             	movzbl (%edi),%edx
+  800de6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800de9:	3c 55                	cmp    $0x55,%al
+  800deb:	0f 87 cf 03 00 00    	ja     8011c0 <vprintfmt+0x437>
+  800df1:	0f b6 c0             	movzbl %al,%eax
+  800df4:	ff 24 85 a0 1a 80 00 	jmp    *0x801aa0(,%eax,4)
+  800dfb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800dfe:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800e02:	eb d9                	jmp    800ddd <vprintfmt+0x54>
+  800e04:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e07:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800e0b:	eb d0                	jmp    800ddd <vprintfmt+0x54>
+  800e0d:	0f b6 d2             	movzbl %dl,%edx
+  800e10:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e18:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e1b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800e1e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800e22:	0f be 17             	movsbl (%edi),%edx
+  800e25:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800e28:	83 f9 09             	cmp    $0x9,%ecx
+  800e2b:	77 55                	ja     800e82 <vprintfmt+0xf9>
+  800e2d:	83 c7 01             	add    $0x1,%edi
+  800e30:	eb e9                	jmp    800e1b <vprintfmt+0x92>
+  800e32:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e35:	8b 00                	mov    (%eax),%eax
+  800e37:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e3a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e3d:	8d 40 04             	lea    0x4(%eax),%eax
+  800e40:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e43:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e46:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800e4a:	79 91                	jns    800ddd <vprintfmt+0x54>
+  800e4c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800e4f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e52:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800e59:	eb 82                	jmp    800ddd <vprintfmt+0x54>
+  800e5b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e5e:	85 d2                	test   %edx,%edx
+  800e60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e65:	0f 49 c2             	cmovns %edx,%eax
+  800e68:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e6b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e6e:	e9 6a ff ff ff       	jmp    800ddd <vprintfmt+0x54>
+  800e73:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e76:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800e7d:	e9 5b ff ff ff       	jmp    800ddd <vprintfmt+0x54>
+  800e82:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e85:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e88:	eb bc                	jmp    800e46 <vprintfmt+0xbd>
+  800e8a:	83 c1 01             	add    $0x1,%ecx
+  800e8d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e90:	e9 48 ff ff ff       	jmp    800ddd <vprintfmt+0x54>
+  800e95:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e98:	8d 78 04             	lea    0x4(%eax),%edi
+  800e9b:	83 ec 08             	sub    $0x8,%esp
+  800e9e:	53                   	push   %ebx
+  800e9f:	ff 30                	push   (%eax)
+  800ea1:	ff d6                	call   *%esi
+  800ea3:	83 c4 10             	add    $0x10,%esp
+  800ea6:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800ea9:	e9 b1 02 00 00       	jmp    80115f <vprintfmt+0x3d6>
+  800eae:	8b 45 14             	mov    0x14(%ebp),%eax
+  800eb1:	8d 78 04             	lea    0x4(%eax),%edi
+  800eb4:	8b 10                	mov    (%eax),%edx
+  800eb6:	89 d0                	mov    %edx,%eax
+  800eb8:	f7 d8                	neg    %eax
+  800eba:	0f 48 c2             	cmovs  %edx,%eax
+  800ebd:	83 f8 08             	cmp    $0x8,%eax
+  800ec0:	7f 23                	jg     800ee5 <vprintfmt+0x15c>
+  800ec2:	8b 14 85 00 1c 80 00 	mov    0x801c00(,%eax,4),%edx
+  800ec9:	85 d2                	test   %edx,%edx
+  800ecb:	74 18                	je     800ee5 <vprintfmt+0x15c>
+  800ecd:	52                   	push   %edx
+  800ece:	68 fe 19 80 00       	push   $0x8019fe
+  800ed3:	53                   	push   %ebx
+  800ed4:	56                   	push   %esi
+  800ed5:	e8 92 fe ff ff       	call   800d6c <printfmt>
+  800eda:	83 c4 10             	add    $0x10,%esp
+  800edd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800ee0:	e9 7a 02 00 00       	jmp    80115f <vprintfmt+0x3d6>
+  800ee5:	50                   	push   %eax
+  800ee6:	68 f5 19 80 00       	push   $0x8019f5
+  800eeb:	53                   	push   %ebx
+  800eec:	56                   	push   %esi
+  800eed:	e8 7a fe ff ff       	call   800d6c <printfmt>
+  800ef2:	83 c4 10             	add    $0x10,%esp
+  800ef5:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800ef8:	e9 62 02 00 00       	jmp    80115f <vprintfmt+0x3d6>
+  800efd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f00:	83 c0 04             	add    $0x4,%eax
+  800f03:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800f06:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f09:	8b 08                	mov    (%eax),%ecx
+  800f0b:	85 c9                	test   %ecx,%ecx
+  800f0d:	b8 ee 19 80 00       	mov    $0x8019ee,%eax
+  800f12:	0f 45 c1             	cmovne %ecx,%eax
+  800f15:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800f18:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800f1c:	7e 06                	jle    800f24 <vprintfmt+0x19b>
+  800f1e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800f22:	75 0b                	jne    800f2f <vprintfmt+0x1a6>
+  800f24:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800f27:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800f2a:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f2d:	eb 5c                	jmp    800f8b <vprintfmt+0x202>
+  800f2f:	83 ec 08             	sub    $0x8,%esp
+  800f32:	ff 75 d0             	push   -0x30(%ebp)
+  800f35:	ff 75 cc             	push   -0x34(%ebp)
+  800f38:	e8 87 03 00 00       	call   8012c4 <strnlen>
+  800f3d:	89 c2                	mov    %eax,%edx
+  800f3f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f42:	29 d0                	sub    %edx,%eax
+  800f44:	83 c4 10             	add    $0x10,%esp
+  800f47:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800f4b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f4e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f51:	89 c6                	mov    %eax,%esi
+  800f53:	eb 0e                	jmp    800f63 <vprintfmt+0x1da>
+  800f55:	83 ec 08             	sub    $0x8,%esp
+  800f58:	53                   	push   %ebx
+  800f59:	57                   	push   %edi
+  800f5a:	ff 55 08             	call   *0x8(%ebp)
+  800f5d:	83 ee 01             	sub    $0x1,%esi
+  800f60:	83 c4 10             	add    $0x10,%esp
+  800f63:	85 f6                	test   %esi,%esi
+  800f65:	7f ee                	jg     800f55 <vprintfmt+0x1cc>
+  800f67:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f6a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f6d:	85 c0                	test   %eax,%eax
+  800f6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f74:	0f 49 d0             	cmovns %eax,%edx
+  800f77:	29 d0                	sub    %edx,%eax
+  800f79:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f7c:	eb a6                	jmp    800f24 <vprintfmt+0x19b>
+  800f7e:	83 ec 08             	sub    $0x8,%esp
+  800f81:	53                   	push   %ebx
+  800f82:	52                   	push   %edx
+  800f83:	ff 55 08             	call   *0x8(%ebp)
+  800f86:	83 c4 10             	add    $0x10,%esp
+  800f89:	89 f1                	mov    %esi,%ecx
+  800f8b:	8d 71 01             	lea    0x1(%ecx),%esi
+  800f8e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800f92:	0f be d0             	movsbl %al,%edx
+  800f95:	85 d2                	test   %edx,%edx
+  800f97:	74 28                	je     800fc1 <vprintfmt+0x238>
+  800f99:	85 ff                	test   %edi,%edi
+  800f9b:	78 05                	js     800fa2 <vprintfmt+0x219>
+  800f9d:	83 ef 01             	sub    $0x1,%edi
+  800fa0:	78 30                	js     800fd2 <vprintfmt+0x249>
+  800fa2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800fa6:	74 d6                	je     800f7e <vprintfmt+0x1f5>
+  800fa8:	0f be c0             	movsbl %al,%eax
+  800fab:	83 e8 20             	sub    $0x20,%eax
+  800fae:	83 f8 5e             	cmp    $0x5e,%eax
+  800fb1:	76 cb                	jbe    800f7e <vprintfmt+0x1f5>
+  800fb3:	83 ec 08             	sub    $0x8,%esp
+  800fb6:	53                   	push   %ebx
+  800fb7:	6a 3f                	push   $0x3f
+  800fb9:	ff 55 08             	call   *0x8(%ebp)
+  800fbc:	83 c4 10             	add    $0x10,%esp
+  800fbf:	eb c8                	jmp    800f89 <vprintfmt+0x200>
+  800fc1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fc4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800fc7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800fca:	01 d0                	add    %edx,%eax
+  800fcc:	29 c8                	sub    %ecx,%eax
+  800fce:	89 c7                	mov    %eax,%edi
+  800fd0:	eb 13                	jmp    800fe5 <vprintfmt+0x25c>
+  800fd2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fd5:	eb ed                	jmp    800fc4 <vprintfmt+0x23b>
+  800fd7:	83 ec 08             	sub    $0x8,%esp
+  800fda:	53                   	push   %ebx
+  800fdb:	6a 20                	push   $0x20
+  800fdd:	ff d6                	call   *%esi
+  800fdf:	83 ef 01             	sub    $0x1,%edi
+  800fe2:	83 c4 10             	add    $0x10,%esp
+  800fe5:	85 ff                	test   %edi,%edi
+  800fe7:	7f ee                	jg     800fd7 <vprintfmt+0x24e>
+  800fe9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800fec:	89 45 14             	mov    %eax,0x14(%ebp)
+  800fef:	e9 6b 01 00 00       	jmp    80115f <vprintfmt+0x3d6>
+  800ff4:	83 f9 01             	cmp    $0x1,%ecx
+  800ff7:	7f 1f                	jg     801018 <vprintfmt+0x28f>
+  800ff9:	85 c9                	test   %ecx,%ecx
+  800ffb:	74 67                	je     801064 <vprintfmt+0x2db>
+  800ffd:	8b 45 14             	mov    0x14(%ebp),%eax
+  801000:	8b 00                	mov    (%eax),%eax
+  801002:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801005:	89 c1                	mov    %eax,%ecx
+  801007:	c1 f9 1f             	sar    $0x1f,%ecx
+  80100a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80100d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801010:	8d 40 04             	lea    0x4(%eax),%eax
+  801013:	89 45 14             	mov    %eax,0x14(%ebp)
+  801016:	eb 17                	jmp    80102f <vprintfmt+0x2a6>
+  801018:	8b 45 14             	mov    0x14(%ebp),%eax
+  80101b:	8b 50 04             	mov    0x4(%eax),%edx
+  80101e:	8b 00                	mov    (%eax),%eax
+  801020:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801023:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801026:	8b 45 14             	mov    0x14(%ebp),%eax
+  801029:	8d 40 08             	lea    0x8(%eax),%eax
+  80102c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80102f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801032:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801035:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80103a:	85 c9                	test   %ecx,%ecx
+  80103c:	0f 89 03 01 00 00    	jns    801145 <vprintfmt+0x3bc>
+  801042:	83 ec 08             	sub    $0x8,%esp
+  801045:	53                   	push   %ebx
+  801046:	6a 2d                	push   $0x2d
+  801048:	ff d6                	call   *%esi
+  80104a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80104d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801050:	f7 da                	neg    %edx
+  801052:	83 d1 00             	adc    $0x0,%ecx
+  801055:	f7 d9                	neg    %ecx
+  801057:	83 c4 10             	add    $0x10,%esp
+  80105a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80105f:	e9 e1 00 00 00       	jmp    801145 <vprintfmt+0x3bc>
+  801064:	8b 45 14             	mov    0x14(%ebp),%eax
+  801067:	8b 00                	mov    (%eax),%eax
+  801069:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80106c:	89 c1                	mov    %eax,%ecx
+  80106e:	c1 f9 1f             	sar    $0x1f,%ecx
+  801071:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801074:	8b 45 14             	mov    0x14(%ebp),%eax
+  801077:	8d 40 04             	lea    0x4(%eax),%eax
+  80107a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80107d:	eb b0                	jmp    80102f <vprintfmt+0x2a6>
+  80107f:	83 f9 01             	cmp    $0x1,%ecx
+  801082:	7f 1e                	jg     8010a2 <vprintfmt+0x319>
+  801084:	85 c9                	test   %ecx,%ecx
+  801086:	74 32                	je     8010ba <vprintfmt+0x331>
+  801088:	8b 45 14             	mov    0x14(%ebp),%eax
+  80108b:	8b 10                	mov    (%eax),%edx
+  80108d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801092:	8d 40 04             	lea    0x4(%eax),%eax
+  801095:	89 45 14             	mov    %eax,0x14(%ebp)
+  801098:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80109d:	e9 a3 00 00 00       	jmp    801145 <vprintfmt+0x3bc>
+  8010a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010a5:	8b 10                	mov    (%eax),%edx
+  8010a7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8010aa:	8d 40 08             	lea    0x8(%eax),%eax
+  8010ad:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010b0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010b5:	e9 8b 00 00 00       	jmp    801145 <vprintfmt+0x3bc>
+  8010ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010bd:	8b 10                	mov    (%eax),%edx
+  8010bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8010c7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010ca:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010cf:	eb 74                	jmp    801145 <vprintfmt+0x3bc>
+  8010d1:	83 f9 01             	cmp    $0x1,%ecx
+  8010d4:	7f 1b                	jg     8010f1 <vprintfmt+0x368>
+  8010d6:	85 c9                	test   %ecx,%ecx
+  8010d8:	74 2c                	je     801106 <vprintfmt+0x37d>
+  8010da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010dd:	8b 10                	mov    (%eax),%edx
+  8010df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8010e7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010ea:	bf 08 00 00 00       	mov    $0x8,%edi
+  8010ef:	eb 54                	jmp    801145 <vprintfmt+0x3bc>
+  8010f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010f4:	8b 10                	mov    (%eax),%edx
+  8010f6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8010f9:	8d 40 08             	lea    0x8(%eax),%eax
+  8010fc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010ff:	bf 08 00 00 00       	mov    $0x8,%edi
+  801104:	eb 3f                	jmp    801145 <vprintfmt+0x3bc>
+  801106:	8b 45 14             	mov    0x14(%ebp),%eax
+  801109:	8b 10                	mov    (%eax),%edx
+  80110b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801110:	8d 40 04             	lea    0x4(%eax),%eax
+  801113:	89 45 14             	mov    %eax,0x14(%ebp)
+  801116:	bf 08 00 00 00       	mov    $0x8,%edi
+  80111b:	eb 28                	jmp    801145 <vprintfmt+0x3bc>
+  80111d:	83 ec 08             	sub    $0x8,%esp
+  801120:	53                   	push   %ebx
+  801121:	6a 30                	push   $0x30
+  801123:	ff d6                	call   *%esi
+  801125:	83 c4 08             	add    $0x8,%esp
+  801128:	53                   	push   %ebx
+  801129:	6a 78                	push   $0x78
+  80112b:	ff d6                	call   *%esi
+  80112d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801130:	8b 10                	mov    (%eax),%edx
+  801132:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801137:	83 c4 10             	add    $0x10,%esp
+  80113a:	8d 40 04             	lea    0x4(%eax),%eax
+  80113d:	89 45 14             	mov    %eax,0x14(%ebp)
+  801140:	bf 10 00 00 00       	mov    $0x10,%edi
+  801145:	83 ec 0c             	sub    $0xc,%esp
+  801148:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80114c:	50                   	push   %eax
+  80114d:	ff 75 e0             	push   -0x20(%ebp)
+  801150:	57                   	push   %edi
+  801151:	51                   	push   %ecx
+  801152:	52                   	push   %edx
+  801153:	89 da                	mov    %ebx,%edx
+  801155:	89 f0                	mov    %esi,%eax
+  801157:	e8 4a fb ff ff       	call   800ca6 <printnum>
+  80115c:	83 c4 20             	add    $0x20,%esp
+  80115f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801162:	e9 40 fc ff ff       	jmp    800da7 <vprintfmt+0x1e>
+  801167:	83 f9 01             	cmp    $0x1,%ecx
+  80116a:	7f 1b                	jg     801187 <vprintfmt+0x3fe>
+  80116c:	85 c9                	test   %ecx,%ecx
+  80116e:	74 2c                	je     80119c <vprintfmt+0x413>
+  801170:	8b 45 14             	mov    0x14(%ebp),%eax
+  801173:	8b 10                	mov    (%eax),%edx
+  801175:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80117a:	8d 40 04             	lea    0x4(%eax),%eax
+  80117d:	89 45 14             	mov    %eax,0x14(%ebp)
+  801180:	bf 10 00 00 00       	mov    $0x10,%edi
+  801185:	eb be                	jmp    801145 <vprintfmt+0x3bc>
+  801187:	8b 45 14             	mov    0x14(%ebp),%eax
+  80118a:	8b 10                	mov    (%eax),%edx
+  80118c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80118f:	8d 40 08             	lea    0x8(%eax),%eax
+  801192:	89 45 14             	mov    %eax,0x14(%ebp)
+  801195:	bf 10 00 00 00       	mov    $0x10,%edi
+  80119a:	eb a9                	jmp    801145 <vprintfmt+0x3bc>
+  80119c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80119f:	8b 10                	mov    (%eax),%edx
+  8011a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8011a9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8011ac:	bf 10 00 00 00       	mov    $0x10,%edi
+  8011b1:	eb 92                	jmp    801145 <vprintfmt+0x3bc>
+  8011b3:	83 ec 08             	sub    $0x8,%esp
+  8011b6:	53                   	push   %ebx
+  8011b7:	6a 25                	push   $0x25
+  8011b9:	ff d6                	call   *%esi
+  8011bb:	83 c4 10             	add    $0x10,%esp
+  8011be:	eb 9f                	jmp    80115f <vprintfmt+0x3d6>
+  8011c0:	83 ec 08             	sub    $0x8,%esp
+  8011c3:	53                   	push   %ebx
+  8011c4:	6a 25                	push   $0x25
+  8011c6:	ff d6                	call   *%esi
+  8011c8:	83 c4 10             	add    $0x10,%esp
+  8011cb:	89 f8                	mov    %edi,%eax
+  8011cd:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8011d1:	74 05                	je     8011d8 <vprintfmt+0x44f>
+  8011d3:	83 e8 01             	sub    $0x1,%eax
+  8011d6:	eb f5                	jmp    8011cd <vprintfmt+0x444>
+  8011d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8011db:	eb 82                	jmp    80115f <vprintfmt+0x3d6>
+
+008011dd <vsnprintf>:
+  8011dd:	55                   	push   %ebp
+  8011de:	89 e5                	mov    %esp,%ebp
+  8011e0:	83 ec 18             	sub    $0x18,%esp
+  8011e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8011ec:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8011f0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8011f3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8011fa:	85 c0                	test   %eax,%eax
+  8011fc:	74 26                	je     801224 <vsnprintf+0x47>
+  8011fe:	85 d2                	test   %edx,%edx
+  801200:	7e 22                	jle    801224 <vsnprintf+0x47>
+  801202:	ff 75 14             	push   0x14(%ebp)
+  801205:	ff 75 10             	push   0x10(%ebp)
+  801208:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80120b:	50                   	push   %eax
+  80120c:	68 4f 0d 80 00       	push   $0x800d4f
+  801211:	e8 73 fb ff ff       	call   800d89 <vprintfmt>
+  801216:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801219:	c6 00 00             	movb   $0x0,(%eax)
+  80121c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80121f:	83 c4 10             	add    $0x10,%esp
+  801222:	c9                   	leave
+  801223:	c3                   	ret
+  801224:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801229:	eb f7                	jmp    801222 <vsnprintf+0x45>
+
+0080122b <snprintf>:
+  80122b:	55                   	push   %ebp
+  80122c:	89 e5                	mov    %esp,%ebp
+  80122e:	83 ec 08             	sub    $0x8,%esp
+  801231:	8d 45 14             	lea    0x14(%ebp),%eax
+  801234:	50                   	push   %eax
+  801235:	ff 75 10             	push   0x10(%ebp)
+  801238:	ff 75 0c             	push   0xc(%ebp)
+  80123b:	ff 75 08             	push   0x8(%ebp)
+  80123e:	e8 9a ff ff ff       	call   8011dd <vsnprintf>
+  801243:	c9                   	leave
+  801244:	c3                   	ret
+
+00801245 <copy_fwd>:
+  801245:	55                   	push   %ebp
+  801246:	89 e5                	mov    %esp,%ebp
+  801248:	57                   	push   %edi
+  801249:	56                   	push   %esi
+  80124a:	53                   	push   %ebx
+  80124b:	89 c7                	mov    %eax,%edi
+  80124d:	89 d6                	mov    %edx,%esi
+  80124f:	89 c8                	mov    %ecx,%eax
+  801251:	83 f9 0f             	cmp    $0xf,%ecx
+  801254:	76 1c                	jbe    801272 <copy_fwd+0x2d>
+  801256:	89 f9                	mov    %edi,%ecx
+  801258:	f7 d9                	neg    %ecx
+  80125a:	89 cb                	mov    %ecx,%ebx
+  80125c:	83 e3 03             	and    $0x3,%ebx
+  80125f:	29 d8                	sub    %ebx,%eax
+  801261:	89 c2                	mov    %eax,%edx
+  801263:	c1 ea 02             	shr    $0x2,%edx
+  801266:	83 e0 03             	and    $0x3,%eax
+  801269:	89 d9                	mov    %ebx,%ecx
+  80126b:	fc                   	cld
+  80126c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80126e:	89 d1                	mov    %edx,%ecx
+  801270:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801272:	89 c1                	mov    %eax,%ecx
+  801274:	fc                   	cld
+  801275:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  801277:	5b                   	pop    %ebx
+  801278:	5e                   	pop    %esi
+  801279:	5f                   	pop    %edi
+  80127a:	5d                   	pop    %ebp
+  80127b:	c3                   	ret
+
+0080127c <have_sse2>:
+  80127c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801283:	78 06                	js     80128b <have_sse2+0xf>
+  801285:	a1 08 20 80 00       	mov    0x802008,%eax
+  80128a:	c3                   	ret
+  80128b:	55                   	push   %ebp
+  80128c:	89 e5                	mov    %esp,%ebp
+  80128e:	53                   	push   %ebx
+  80128f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801294:	0f a2                	cpuid
+  801296:	c1 ea 1a             	shr    $0x1a,%edx
+  801299:	83 e2 01             	and    $0x1,%edx
+  80129c:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8012a2:	a1 08 20 80 00       	mov    0x802008,%eax
+  8012a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012aa:	c9                   	leave
+  8012ab:	c3                   	ret
+
+008012ac <strlen>:
+  8012ac:	55                   	push   %ebp
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b7:	eb 03                	jmp    8012bc <strlen+0x10>
+  8012b9:	83 c0 01             	add    $0x1,%eax
+  8012bc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8012c0:	75 f7                	jne    8012b9 <strlen+0xd>
+  8012c2:	5d                   	pop    %ebp
+  8012c3:	c3                   	ret
+
+008012c4 <strnlen>:
+  8012c4:	55                   	push   %ebp
+  8012c5:	89 e5                	mov    %esp,%ebp
+  8012c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d2:	eb 03                	jmp    8012d7 <strnlen+0x13>
+  8012d4:	83 c0 01             	add    $0x1,%eax
+  8012d7:	39 d0                	cmp    %edx,%eax
+  8012d9:	74 08                	je     8012e3 <strnlen+0x1f>
+  8012db:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8012df:	75 f3                	jne    8012d4 <strnlen+0x10>
+  8012e1:	89 c2                	mov    %eax,%edx
+  8012e3:	89 d0                	mov    %edx,%eax
+  8012e5:	5d                   	pop    %ebp
+  8012e6:	c3                   	ret
+
+008012e7 <strcpy>:
+  8012e7:	55                   	push   %ebp
+  8012e8:	89 e5                	mov    %esp,%ebp
+  8012ea:	53                   	push   %ebx
+  8012eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8012f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8012fa:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8012fd:	83 c0 01             	add    $0x1,%eax
+  801300:	84 d2                	test   %dl,%dl
+  801302:	75 f2                	jne    8012f6 <strcpy+0xf>
+  801304:	89 c8                	mov    %ecx,%eax
+  801306:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801309:	c9                   	leave
+  80130a:	c3                   	ret
+
+0080130b <strcat>:
+  80130b:	55                   	push   %ebp
+  80130c:	89 e5                	mov    %esp,%ebp
+  80130e:	53                   	push   %ebx
+  80130f:	83 ec 10             	sub    $0x10,%esp
+  801312:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801315:	53                   	push   %ebx
+  801316:	e8 91 ff ff ff       	call   8012ac <strlen>
+  80131b:	83 c4 08             	add    $0x8,%esp
+  80131e:	ff 75 0c             	push   0xc(%ebp)
+  801321:	01 d8                	add    %ebx,%eax
+  801323:	50                   	push   %eax
+  801324:	e8 be ff ff ff       	call   8012e7 <strcpy>
+  801329:	89 d8                	mov    %ebx,%eax
+  80132b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80132e:	c9                   	leave
+  80132f:	c3                   	ret
+
+00801330 <strncpy>:
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	56                   	push   %esi
+  801334:	53                   	push   %ebx
+  801335:	8b 75 08             	mov    0x8(%ebp),%esi
+  801338:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80133b:	89 f3                	mov    %esi,%ebx
+  80133d:	03 5d 10             	add    0x10(%ebp),%ebx
+  801340:	89 f0                	mov    %esi,%eax
+  801342:	eb 0f                	jmp    801353 <strncpy+0x23>
+  801344:	83 c0 01             	add    $0x1,%eax
+  801347:	0f b6 0a             	movzbl (%edx),%ecx
+  80134a:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80134d:	80 f9 01             	cmp    $0x1,%cl
+  801350:	83 da ff             	sbb    $0xffffffff,%edx
+  801353:	39 d8                	cmp    %ebx,%eax
+  801355:	75 ed                	jne    801344 <strncpy+0x14>
+  801357:	89 f0                	mov    %esi,%eax
+  801359:	5b                   	pop    %ebx
+  80135a:	5e                   	pop    %esi
+  80135b:	5d                   	pop    %ebp
+  80135c:	c3                   	ret
+
+0080135d <strlcpy>:
+  80135d:	55                   	push   %ebp
+  80135e:	89 e5                	mov    %esp,%ebp
+  801360:	56                   	push   %esi
+  801361:	53                   	push   %ebx
+  801362:	8b 75 08             	mov    0x8(%ebp),%esi
+  801365:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801368:	8b 55 10             	mov    0x10(%ebp),%edx
+  80136b:	89 f0                	mov    %esi,%eax
+  80136d:	85 d2                	test   %edx,%edx
+  80136f:	74 21                	je     801392 <strlcpy+0x35>
+  801371:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801375:	89 f2                	mov    %esi,%edx
+  801377:	eb 09                	jmp    801382 <strlcpy+0x25>
+  801379:	83 c1 01             	add    $0x1,%ecx
+  80137c:	83 c2 01             	add    $0x1,%edx
+  80137f:	88 5a ff             	mov    %bl,-0x1(%edx)
+  801382:	39 c2                	cmp    %eax,%edx
+  801384:	74 09                	je     80138f <strlcpy+0x32>
+  801386:	0f b6 19             	movzbl (%ecx),%ebx
+  801389:	84 db                	test   %bl,%bl
+  80138b:	75 ec                	jne    801379 <strlcpy+0x1c>
+  80138d:	89 d0                	mov    %edx,%eax
+  80138f:	c6 00 00             	movb   $0x0,(%eax)
+  801392:	29 f0                	sub    %esi,%eax
+  801394:	5b                   	pop    %ebx
+  801395:	5e                   	pop    %esi
+  801396:	5d                   	pop    %ebp
+  801397:	c3                   	ret
+
+00801398 <strcmp>:
+  801398:	55                   	push   %ebp
+  801399:	89 e5                	mov    %esp,%ebp
+  80139b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80139e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013a1:	eb 06                	jmp    8013a9 <strcmp+0x11>
+  8013a3:	83 c1 01             	add    $0x1,%ecx
+  8013a6:	83 c2 01             	add    $0x1,%edx
+  8013a9:	0f b6 01             	movzbl (%ecx),%eax
+  8013ac:	84 c0                	test   %al,%al
+  8013ae:	74 04                	je     8013b4 <strcmp+0x1c>
+  8013b0:	3a 02                	cmp    (%edx),%al
+  8013b2:	74 ef                	je     8013a3 <strcmp+0xb>
+  8013b4:	0f b6 c0             	movzbl %al,%eax
+  8013b7:	0f b6 12             	movzbl (%edx),%edx
+  8013ba:	29 d0                	sub    %edx,%eax
+  8013bc:	5d                   	pop    %ebp
+  8013bd:	c3                   	ret
+
+008013be <strncmp>:
+  8013be:	55                   	push   %ebp
+  8013bf:	89 e5                	mov    %esp,%ebp
+  8013c1:	53                   	push   %ebx
+  8013c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c8:	8b 55 10             	mov    0x10(%ebp),%edx
+  8013cb:	eb 09                	jmp    8013d6 <strncmp+0x18>
+  8013cd:	83 ea 01             	sub    $0x1,%edx
+  8013d0:	83 c0 01             	add    $0x1,%eax
+  8013d3:	83 c1 01             	add    $0x1,%ecx
+  8013d6:	85 d2                	test   %edx,%edx
+  8013d8:	74 18                	je     8013f2 <strncmp+0x34>
+  8013da:	0f b6 18             	movzbl (%eax),%ebx
+  8013dd:	84 db                	test   %bl,%bl
+  8013df:	74 04                	je     8013e5 <strncmp+0x27>
+  8013e1:	3a 19                	cmp    (%ecx),%bl
+  8013e3:	74 e8                	je     8013cd <strncmp+0xf>
+  8013e5:	0f b6 00             	movzbl (%eax),%eax
+  8013e8:	0f b6 11             	movzbl (%ecx),%edx
+  8013eb:	29 d0                	sub    %edx,%eax
+  8013ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013f0:	c9                   	leave
+  8013f1:	c3                   	ret
+  8013f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f7:	eb f4                	jmp    8013ed <strncmp+0x2f>
+
+008013f9 <strchr>:
+  8013f9:	55                   	push   %ebp
+  8013fa:	89 e5                	mov    %esp,%ebp
+  8013fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013ff:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  801403:	eb 03                	jmp    801408 <strchr+0xf>
+  801405:	83 c0 01             	add    $0x1,%eax
+  801408:	0f b6 10             	movzbl (%eax),%edx
+  80140b:	84 d2                	test   %dl,%dl
+  80140d:	74 06                	je     801415 <strchr+0x1c>
+  80140f:	38 ca                	cmp    %cl,%dl
+  801411:	75 f2                	jne    801405 <strchr+0xc>
+  801413:	eb 05                	jmp    80141a <strchr+0x21>
+  801415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141a:	5d                   	pop    %ebp
+  80141b:	c3                   	ret
+
+0080141c <strfind>:
+  80141c:	55                   	push   %ebp
+  80141d:	89 e5                	mov    %esp,%ebp
+  80141f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801422:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  801426:	0f b6 10             	movzbl (%eax),%edx
+  801429:	38 ca                	cmp    %cl,%dl
+  80142b:	74 09                	je     801436 <strfind+0x1a>
+  80142d:	84 d2                	test   %dl,%dl
+  80142f:	74 05                	je     801436 <strfind+0x1a>
+  801431:	83 c0 01             	add    $0x1,%eax
+  801434:	eb f0                	jmp    801426 <strfind+0xa>
+  801436:	5d                   	pop    %ebp
+  801437:	c3                   	ret
+
+00801438 <memset>:
+  801438:	55                   	push   %ebp
+  801439:	89 e5                	mov    %esp,%ebp
+  80143b:	57                   	push   %edi
+  80143c:	56                   	push   %esi
+  80143d:	53                   	push   %ebx
+  80143e:	83 ec 04             	sub    $0x4,%esp
+  801441:	8b 75 08             	mov    0x8(%ebp),%esi
+  801444:	8b 55 10             	mov    0x10(%ebp),%edx
+  801447:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  80144b:	89 f7                	mov    %esi,%edi
+  80144d:	83 fa 0f             	cmp    $0xf,%edx
+  801450:	76 24                	jbe    801476 <memset+0x3e>
+  801452:	89 f1                	mov    %esi,%ecx
+  801454:	f7 d9                	neg    %ecx
+  801456:	83 e1 03             	and    $0x3,%ecx
+  801459:	29 ca                	sub    %ecx,%edx
+  80145b:	89 d0                	mov    %edx,%eax
+  80145d:	c1 e8 02             	shr    $0x2,%eax
+  801460:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  801463:	83 e2 03             	and    $0x3,%edx
+  801466:	89 d8                	mov    %ebx,%eax
+  801468:	fc                   	cld
+  801469:	f3 aa                	rep stos %al,%es:(%edi)
+  80146b:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  801471:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  801474:	f3 ab                	rep stos %eax,%es:(%edi)
+  801476:	89 d1                	mov    %edx,%ecx
+  801478:	89 d8                	mov    %ebx,%eax
+  80147a:	fc                   	cld
+  80147b:	f3 aa                	rep stos %al,%es:(%edi)
+  80147d:	89 f0                	mov    %esi,%eax
+  80147f:	83 c4 04             	add    $0x4,%esp
+  801482:	5b                   	pop    %ebx
+  801483:	5e                   	pop    %esi
+  801484:	5f                   	pop    %edi
+  801485:	5d                   	pop    %ebp
+  801486:	c3                   	ret
+
+00801487 <memmove>:
+  801487:	55                   	push   %ebp
+  801488:	89 e5                	mov    %esp,%ebp
+  80148a:	57                   	push   %edi
+  80148b:	56                   	push   %esi
+  80148c:	53                   	push   %ebx
+  80148d:	83 ec 0c             	sub    $0xc,%esp
+  801490:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801493:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801496:	8b 45 10             	mov    0x10(%ebp),%eax
+  801499:	85 c0                	test   %eax,%eax
+  80149b:	74 14                	je     8014b1 <memmove+0x2a>
+  80149d:	39 da                	cmp    %ebx,%edx
+  80149f:	73 07                	jae    8014a8 <memmove+0x21>
+  8014a1:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8014a4:	39 cb                	cmp    %ecx,%ebx
+  8014a6:	72 13                	jb     8014bb <memmove+0x34>
+  8014a8:	89 c1                	mov    %eax,%ecx
+  8014aa:	89 d8                	mov    %ebx,%eax
+  8014ac:	e8 94 fd ff ff       	call   801245 <copy_fwd>
+  8014b1:	89 d8                	mov    %ebx,%eax
+  8014b3:	83 c4 0c             	add    $0xc,%esp
+  8014b6:	5b                   	pop    %ebx
+  8014b7:	5e                   	pop    %esi
+  8014b8:	5f                   	pop    %edi
+  8014b9:	5d                   	pop    %ebp
+  8014ba:	c3                   	ret
+  8014bb:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  8014be:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  8014c1:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  8014c4:	83 f8 0f             	cmp    $0xf,%eax
+  8014c7:	76 23                	jbe    8014ec <memmove+0x65>
+  8014c9:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  8014cc:	83 e1 03             	and    $0x3,%ecx
+  8014cf:	29 c8                	sub    %ecx,%eax
+  8014d1:	89 c2                	mov    %eax,%edx
+  8014d3:	c1 ea 02             	shr    $0x2,%edx
+  8014d6:	83 e0 03             	and    $0x3,%eax
+  8014d9:	fd                   	std
+  8014da:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014dc:	83 ef 03             	sub    $0x3,%edi
+  8014df:	83 ee 03             	sub    $0x3,%esi
+  8014e2:	89 d1                	mov    %edx,%ecx
+  8014e4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8014e6:	83 c7 03             	add    $0x3,%edi
+  8014e9:	83 c6 03             	add    $0x3,%esi
+  8014ec:	89 c1                	mov    %eax,%ecx
+  8014ee:	fd                   	std
+  8014ef:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014f1:	fc                   	cld
+  8014f2:	eb bd                	jmp    8014b1 <memmove+0x2a>
+
+008014f4 <memcpy>:
+  8014f4:	55                   	push   %ebp
+  8014f5:	89 e5                	mov    %esp,%ebp
+  8014f7:	53                   	push   %ebx
+  8014f8:	83 ec 04             	sub    $0x4,%esp
+  8014fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8014fe:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801501:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801504:	89 d8                	mov    %ebx,%eax
+  801506:	e8 3a fd ff ff       	call   801245 <copy_fwd>
+  80150b:	89 d8                	mov    %ebx,%eax
+  80150d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801510:	c9                   	leave
+  801511:	c3                   	ret
+
+00801512 <page_copy>:
+  801512:	55                   	push   %ebp
+  801513:	89 e5                	mov    %esp,%ebp
+  801515:	57                   	push   %edi
+  801516:	56                   	push   %esi
+  801517:	53                   	push   %ebx
+  801518:	83 ec 0c             	sub    $0xc,%esp
+  80151b:	e8 5c fd ff ff       	call   80127c <have_sse2>
+  801520:	85 c0                	test   %eax,%eax
+  801522:	74 39                	je     80155d <page_copy+0x4b>
+  801524:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801527:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80152a:	be 00 01 00 00       	mov    $0x100,%esi
+  80152f:	8b 03                	mov    (%ebx),%eax
+  801531:	8b 53 04             	mov    0x4(%ebx),%edx
+  801534:	0f c3 01             	movnti %eax,(%ecx)
+  801537:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  80153b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80153e:	8b 53 0c             	mov    0xc(%ebx),%edx
+  801541:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  801545:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  801549:	83 c3 10             	add    $0x10,%ebx
+  80154c:	83 c1 10             	add    $0x10,%ecx
+  80154f:	4e                   	dec    %esi
+  801550:	75 dd                	jne    80152f <page_copy+0x1d>
+  801552:	0f ae f8             	sfence
+  801555:	83 c4 0c             	add    $0xc,%esp
+  801558:	5b                   	pop    %ebx
+  801559:	5e                   	pop    %esi
+  80155a:	5f                   	pop    %edi
+  80155b:	5d                   	pop    %ebp
+  80155c:	c3                   	ret
+  80155d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801560:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801563:	b9 00 04 00 00       	mov    $0x400,%ecx
+  801568:	fc                   	cld
+  801569:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80156b:	eb e8                	jmp    801555 <page_copy+0x43>
+
+0080156d <page_zero>:
+  80156d:	55                   	push   %ebp
+  80156e:	89 e5                	mov    %esp,%ebp
+  801570:	57                   	push   %edi
+  801571:	83 ec 04             	sub    $0x4,%esp
+  801574:	e8 03 fd ff ff       	call   80127c <have_sse2>
+  801579:	85 c0                	test   %eax,%eax
+  80157b:	74 3a                	je     8015b7 <page_zero+0x4a>
+  80157d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801580:	ba 80 00 00 00       	mov    $0x80,%edx
+  801585:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80158a:	0f c3 08             	movnti %ecx,(%eax)
+  80158d:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  801591:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  801595:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  801599:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  80159d:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  8015a1:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  8015a5:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  8015a9:	83 c0 20             	add    $0x20,%eax
+  8015ac:	4a                   	dec    %edx
+  8015ad:	75 db                	jne    80158a <page_zero+0x1d>
+  8015af:	0f ae f8             	sfence
+  8015b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8015b5:	c9                   	leave
+  8015b6:	c3                   	ret
+  8015b7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015ba:	b9 00 04 00 00       	mov    $0x400,%ecx
+  8015bf:	fc                   	cld
+  8015c0:	f3 ab                	rep stos %eax,%es:(%edi)
+  8015c2:	eb ee                	jmp    8015b2 <page_zero+0x45>
+
+008015c4 <memcmp>:
+  8015c4:	55                   	push   %ebp
+  8015c5:	89 e5                	mov    %esp,%ebp
+  8015c7:	56                   	push   %esi
+  8015c8:	53                   	push   %ebx
+  8015c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015cf:	89 c6                	mov    %eax,%esi
+  8015d1:	03 75 10             	add    0x10(%ebp),%esi
+  8015d4:	eb 06                	jmp    8015dc <memcmp+0x18>
+  8015d6:	83 c0 01             	add    $0x1,%eax
+  8015d9:	83 c2 01             	add    $0x1,%edx
+  8015dc:	39 f0                	cmp    %esi,%eax
+  8015de:	74 14                	je     8015f4 <memcmp+0x30>
+  8015e0:	0f b6 08             	movzbl (%eax),%ecx
+  8015e3:	0f b6 1a             	movzbl (%edx),%ebx
+  8015e6:	38 d9                	cmp    %bl,%cl
+  8015e8:	74 ec                	je     8015d6 <memcmp+0x12>
+  8015ea:	0f b6 c1             	movzbl %cl,%eax
+  8015ed:	0f b6 db             	movzbl %bl,%ebx
+  8015f0:	29 d8                	sub    %ebx,%eax
+  8015f2:	eb 05                	jmp    8015f9 <memcmp+0x35>
+  8015f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f9:	5b                   	pop    %ebx
+  8015fa:	5e                   	pop    %esi
+  8015fb:	5d                   	pop    %ebp
+  8015fc:	c3                   	ret
+
+008015fd <memfind>:
+  8015fd:	55                   	push   %ebp
+  8015fe:	89 e5                	mov    %esp,%ebp
+  801600:	8b 45 08             	mov    0x8(%ebp),%eax
+  801603:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801606:	89 c2                	mov    %eax,%edx
+  801608:	03 55 10             	add    0x10(%ebp),%edx
+  80160b:	eb 03                	jmp    801610 <memfind+0x13>
+  80160d:	83 c0 01             	add    $0x1,%eax
+  801610:	39 d0                	cmp    %edx,%eax
+  801612:	73 04                	jae    801618 <memfind+0x1b>
+  801614:	38 08                	cmp    %cl,(%eax)
+  801616:	75 f5                	jne    80160d <memfind+0x10>
+  801618:	5d                   	pop    %ebp
+  801619:	c3                   	ret
+
+0080161a <strtol>:
+  80161a:	55                   	push   %ebp
+  80161b:	89 e5                	mov    %esp,%ebp
+  80161d:	57                   	push   %edi
+  80161e:	56                   	push   %esi
+  80161f:	53                   	push   %ebx
+  801620:	8b 55 08             	mov    0x8(%ebp),%edx
+  801623:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801626:	eb 03                	jmp    80162b <strtol+0x11>
+  801628:	83 c2 01             	add    $0x1,%edx
+  80162b:	0f b6 02             	movzbl (%edx),%eax
+  80162e:	3c 20                	cmp    $0x20,%al
+  801630:	74 f6                	je     801628 <strtol+0xe>
+  801632:	3c 09                	cmp    $0x9,%al
+  801634:	74 f2                	je     801628 <strtol+0xe>
+  801636:	3c 2b                	cmp    $0x2b,%al
+  801638:	74 2a                	je     801664 <strtol+0x4a>
+  80163a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80163f:	3c 2d                	cmp    $0x2d,%al
+  801641:	74 2b                	je     80166e <strtol+0x54>
+  801643:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801649:	75 0f                	jne    80165a <strtol+0x40>
+  80164b:	80 3a 30             	cmpb   $0x30,(%edx)
+  80164e:	74 28                	je     801678 <strtol+0x5e>
+  801650:	85 db                	test   %ebx,%ebx
+  801652:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801657:	0f 44 d8             	cmove  %eax,%ebx
+  80165a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80165f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801662:	eb 46                	jmp    8016aa <strtol+0x90>
+  801664:	83 c2 01             	add    $0x1,%edx
+  801667:	bf 00 00 00 00       	mov    $0x0,%edi
+  80166c:	eb d5                	jmp    801643 <strtol+0x29>
+  80166e:	83 c2 01             	add    $0x1,%edx
+  801671:	bf 01 00 00 00       	mov    $0x1,%edi
+  801676:	eb cb                	jmp    801643 <strtol+0x29>
+  801678:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80167c:	74 0e                	je     80168c <strtol+0x72>
+  80167e:	85 db                	test   %ebx,%ebx
+  801680:	75 d8                	jne    80165a <strtol+0x40>
+  801682:	83 c2 01             	add    $0x1,%edx
+  801685:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80168a:	eb ce                	jmp    80165a <strtol+0x40>
+  80168c:	83 c2 02             	add    $0x2,%edx
+  80168f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801694:	eb c4                	jmp    80165a <strtol+0x40>
+  801696:	0f be c0             	movsbl %al,%eax
+  801699:	83 e8 30             	sub    $0x30,%eax
+  80169c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80169f:	7d 3a                	jge    8016db <strtol+0xc1>
+  8016a1:	83 c2 01             	add    $0x1,%edx
+  8016a4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8016a8:	01 c1                	add    %eax,%ecx
+  8016aa:	0f b6 02             	movzbl (%edx),%eax
+  8016ad:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8016b0:	89 f3                	mov    %esi,%ebx
+  8016b2:	80 fb 09             	cmp    $0x9,%bl
+  8016b5:	76 df                	jbe    801696 <strtol+0x7c>
+  8016b7:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8016ba:	89 f3                	mov    %esi,%ebx
+  8016bc:	80 fb 19             	cmp    $0x19,%bl
+  8016bf:	77 08                	ja     8016c9 <strtol+0xaf>
+  8016c1:	0f be c0             	movsbl %al,%eax
+  8016c4:	83 e8 57             	sub    $0x57,%eax
+  8016c7:	eb d3                	jmp    80169c <strtol+0x82>
+  8016c9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8016cc:	89 f3                	mov    %esi,%ebx
+  8016ce:	80 fb 19             	cmp    $0x19,%bl
+  8016d1:	77 08                	ja     8016db <strtol+0xc1>
+  8016d3:	0f be c0             	movsbl %al,%eax
+  8016d6:	83 e8 37             	sub    $0x37,%eax
+  8016d9:	eb c1                	jmp    80169c <strtol+0x82>
+  8016db:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8016df:	74 05                	je     8016e6 <strtol+0xcc>
+  8016e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016e4:	89 10                	mov    %edx,(%eax)
+  8016e6:	89 c8                	mov    %ecx,%eax
+  8016e8:	f7 d8                	neg    %eax
+  8016ea:	85 ff                	test   %edi,%edi
+  8016ec:	0f 45 c8             	cmovne %eax,%ecx
+  8016ef:	89 c8                	mov    %ecx,%eax
+  8016f1:	5b                   	pop    %ebx
+  8016f2:	5e                   	pop    %esi
+  8016f3:	5f                   	pop    %edi
+  8016f4:	5d                   	pop    %ebp
+  8016f5:	c3                   	ret
+
+008016f6 <__udivdi3>:
+  8016f6:	57                   	push   %edi
+  8016f7:	56                   	push   %esi
+  8016f8:	53                   	push   %ebx
+  8016f9:	83 ec 20             	sub    $0x20,%esp
+  8016fc:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801700:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801704:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801708:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80170c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801710:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801714:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801718:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80171c:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801720:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801724:	89 d1                	mov    %edx,%ecx
+  801726:	09 c1                	or     %eax,%ecx
+  801728:	0f 84 91 00 00 00    	je     8017bf <__udivdi3+0xc9>
+  80172e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801735:	00 
+  801736:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80173d:	00 
+  80173e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801743:	b8 00 00 00 00       	mov    $0x0,%eax
+  801748:	ba 00 00 00 00       	mov    $0x0,%edx
+  80174d:	eb 08                	jmp    801757 <__udivdi3+0x61>
+  80174f:	83 e9 01             	sub    $0x1,%ecx
+  801752:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801755:	74 68                	je     8017bf <__udivdi3+0xc9>
+  801757:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80175b:	01 c0                	add    %eax,%eax
+  80175d:	89 c6                	mov    %eax,%esi
+  80175f:	89 d7                	mov    %edx,%edi
+  801761:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801765:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801769:	0f ad d0             	shrd   %cl,%edx,%eax
+  80176c:	d3 ea                	shr    %cl,%edx
+  80176e:	f6 c1 20             	test   $0x20,%cl
+  801771:	74 04                	je     801777 <__udivdi3+0x81>
+  801773:	89 d0                	mov    %edx,%eax
+  801775:	31 d2                	xor    %edx,%edx
+  801777:	83 e0 01             	and    $0x1,%eax
+  80177a:	89 04 24             	mov    %eax,(%esp)
+  80177d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801784:	00 
+  801785:	8b 04 24             	mov    (%esp),%eax
+  801788:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80178c:	09 f0                	or     %esi,%eax
+  80178e:	09 fa                	or     %edi,%edx
+  801790:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801794:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801798:	39 f0                	cmp    %esi,%eax
+  80179a:	89 d3                	mov    %edx,%ebx
+  80179c:	19 fb                	sbb    %edi,%ebx
+  80179e:	72 af                	jb     80174f <__udivdi3+0x59>
+  8017a0:	29 f0                	sub    %esi,%eax
+  8017a2:	19 fa                	sbb    %edi,%edx
+  8017a4:	89 cf                	mov    %ecx,%edi
+  8017a6:	c1 ef 05             	shr    $0x5,%edi
+  8017a9:	83 e7 01             	and    $0x1,%edi
+  8017ac:	89 fe                	mov    %edi,%esi
+  8017ae:	83 f6 01             	xor    $0x1,%esi
+  8017b1:	d3 e6                	shl    %cl,%esi
+  8017b3:	d3 e7                	shl    %cl,%edi
+  8017b5:	09 74 24 18          	or     %esi,0x18(%esp)
+  8017b9:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8017bd:	eb 90                	jmp    80174f <__udivdi3+0x59>
+  8017bf:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8017c3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8017c7:	83 c4 20             	add    $0x20,%esp
+  8017ca:	5b                   	pop    %ebx
+  8017cb:	5e                   	pop    %esi
+  8017cc:	5f                   	pop    %edi
+  8017cd:	c3                   	ret
+
+008017ce <__umoddi3>:
+  8017ce:	55                   	push   %ebp
+  8017cf:	57                   	push   %edi
+  8017d0:	56                   	push   %esi
+  8017d1:	53                   	push   %ebx
+  8017d2:	83 ec 1c             	sub    $0x1c,%esp
+  8017d5:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8017d9:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8017dd:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8017e1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8017e5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8017e9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8017ed:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8017f1:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8017f5:	89 d6                	mov    %edx,%esi
+  8017f7:	09 c6                	or     %eax,%esi
+  8017f9:	74 6c                	je     801867 <__umoddi3+0x99>
+  8017fb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801800:	b8 00 00 00 00       	mov    $0x0,%eax
+  801805:	ba 00 00 00 00       	mov    $0x0,%edx
+  80180a:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  80180e:	eb 0e                	jmp    80181e <__umoddi3+0x50>
+  801810:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801815:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801819:	83 fe ff             	cmp    $0xffffffff,%esi
+  80181c:	74 49                	je     801867 <__umoddi3+0x99>
+  80181e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801822:	01 c0                	add    %eax,%eax
+  801824:	89 c3                	mov    %eax,%ebx
+  801826:	89 d6                	mov    %edx,%esi
+  801828:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80182c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801830:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801835:	0f ad d0             	shrd   %cl,%edx,%eax
+  801838:	d3 ea                	shr    %cl,%edx
+  80183a:	f6 c1 20             	test   $0x20,%cl
+  80183d:	74 04                	je     801843 <__umoddi3+0x75>
+  80183f:	89 d0                	mov    %edx,%eax
+  801841:	31 d2                	xor    %edx,%edx
+  801843:	83 e0 01             	and    $0x1,%eax
+  801846:	bd 00 00 00 00       	mov    $0x0,%ebp
+  80184b:	89 ea                	mov    %ebp,%edx
+  80184d:	09 d8                	or     %ebx,%eax
+  80184f:	09 f2                	or     %esi,%edx
+  801851:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801855:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801859:	39 d8                	cmp    %ebx,%eax
+  80185b:	89 d1                	mov    %edx,%ecx
+  80185d:	19 f1                	sbb    %esi,%ecx
+  80185f:	72 af                	jb     801810 <__umoddi3+0x42>
+  801861:	29 d8                	sub    %ebx,%eax
+  801863:	19 f2                	sbb    %esi,%edx
+  801865:	eb a9                	jmp    801810 <__umoddi3+0x42>
+  801867:	83 c4 1c             	add    $0x1c,%esp
+  80186a:	5b                   	pop    %ebx
+  80186b:	5e                   	pop    %esi
+  80186c:	5f                   	pop    %edi
+  80186d:	5d                   	pop    %ebp
+  80186e:	c3                   	ret
+
+0080186f <__divdi3>:
+  80186f:	53                   	push   %ebx
+  801870:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801874:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801878:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80187c:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801880:	85 d2                	test   %edx,%edx
+  801882:	78 12                	js     801896 <__divdi3+0x27>
+  801884:	85 db                	test   %ebx,%ebx
+  801886:	78 2e                	js     8018b6 <__divdi3+0x47>
+  801888:	53                   	push   %ebx
+  801889:	51                   	push   %ecx
+  80188a:	52                   	push   %edx
+  80188b:	50                   	push   %eax
+  80188c:	e8 65 fe ff ff       	call   8016f6 <__udivdi3>
+  801891:	83 c4 10             	add    $0x10,%esp
+  801894:	eb 1e                	jmp    8018b4 <__divdi3+0x45>
+  801896:	f7 d8                	neg    %eax
+  801898:	83 d2 00             	adc    $0x0,%edx
+  80189b:	f7 da                	neg    %edx
+  80189d:	85 db                	test   %ebx,%ebx
+  80189f:	78 2a                	js     8018cb <__divdi3+0x5c>
+  8018a1:	53                   	push   %ebx
+  8018a2:	51                   	push   %ecx
+  8018a3:	52                   	push   %edx
+  8018a4:	50                   	push   %eax
+  8018a5:	e8 4c fe ff ff       	call   8016f6 <__udivdi3>
+  8018aa:	83 c4 10             	add    $0x10,%esp
+  8018ad:	f7 d8                	neg    %eax
+  8018af:	83 d2 00             	adc    $0x0,%edx
+  8018b2:	f7 da                	neg    %edx
+  8018b4:	5b                   	pop    %ebx
+  8018b5:	c3                   	ret
+  8018b6:	f7 d9                	neg    %ecx
+  8018b8:	83 d3 00             	adc    $0x0,%ebx
+  8018bb:	f7 db                	neg    %ebx
+  8018bd:	53                   	push   %ebx
+  8018be:	51                   	push   %ecx
+  8018bf:	52                   	push   %edx
+  8018c0:	50                   	push   %eax
+  8018c1:	e8 30 fe ff ff       	call   8016f6 <__udivdi3>
+  8018c6:	83 c4 10             	add    $0x10,%esp
+  8018c9:	eb e2                	jmp    8018ad <__divdi3+0x3e>
+  8018cb:	f7 d9                	neg    %ecx
+  8018cd:	83 d3 00             	adc    $0x0,%ebx
+  8018d0:	f7 db                	neg    %ebx
+  8018d2:	53                   	push   %ebx
+  8018d3:	51                   	push   %ecx
+  8018d4:	52                   	push   %edx
+  8018d5:	50                   	push   %eax
+  8018d6:	e8 1b fe ff ff       	call   8016f6 <__udivdi3>
+  8018db:	83 c4 10             	add    $0x10,%esp
+  8018de:	eb d4                	jmp    8018b4 <__divdi3+0x45>
+
+008018e0 <__moddi3>:
+  8018e0:	55                   	push   %ebp
+  8018e1:	57                   	push   %edi
+  8018e2:	56                   	push   %esi
+  8018e3:	53                   	push   %ebx
+  8018e4:	83 ec 14             	sub    $0x14,%esp
+  8018e7:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  8018eb:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  8018ef:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8018f3:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8018f7:	85 ed                	test   %ebp,%ebp
+  8018f9:	78 2b                	js     801926 <__moddi3+0x46>
+  8018fb:	89 c6                	mov    %eax,%esi
+  8018fd:	f7 de                	neg    %esi
+  8018ff:	89 34 24             	mov    %esi,(%esp)
+  801902:	89 d6                	mov    %edx,%esi
+  801904:	83 d6 00             	adc    $0x0,%esi
+  801907:	f7 de                	neg    %esi
+  801909:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80190d:	8b 34 24             	mov    (%esp),%esi
+  801910:	0f 48 f0             	cmovs  %eax,%esi
+  801913:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801918:	52                   	push   %edx
+  801919:	56                   	push   %esi
+  80191a:	55                   	push   %ebp
+  80191b:	57                   	push   %edi
+  80191c:	e8 ad fe ff ff       	call   8017ce <__umoddi3>
+  801921:	83 c4 10             	add    $0x10,%esp
+  801924:	eb 3c                	jmp    801962 <__moddi3+0x82>
+  801926:	89 c3                	mov    %eax,%ebx
+  801928:	f7 db                	neg    %ebx
+  80192a:	89 d1                	mov    %edx,%ecx
+  80192c:	83 d1 00             	adc    $0x0,%ecx
+  80192f:	f7 d9                	neg    %ecx
+  801931:	0f 49 c3             	cmovns %ebx,%eax
+  801934:	89 04 24             	mov    %eax,(%esp)
+  801937:	0f 49 d1             	cmovns %ecx,%edx
+  80193a:	89 54 24 04          	mov    %edx,0x4(%esp)
+  80193e:	ff 74 24 04          	push   0x4(%esp)
+  801942:	ff 74 24 04          	push   0x4(%esp)
+  801946:	89 f8                	mov    %edi,%eax
+  801948:	89 ea                	mov    %ebp,%edx
+  80194a:	f7 d8                	neg    %eax
+  80194c:	83 d2 00             	adc    $0x0,%edx
+  80194f:	f7 da                	neg    %edx
+  801951:	52                   	push   %edx
+  801952:	50                   	push   %eax
+  801953:	e8 76 fe ff ff       	call   8017ce <__umoddi3>
+  801958:	83 c4 10             	add    $0x10,%esp
+  80195b:	f7 d8                	neg    %eax
+  80195d:	83 d2 00             	adc    $0x0,%edx
+  801960:	f7 da                	neg    %edx
+  801962:	83 c4 14             	add    $0x14,%esp
+  801965:	5b                   	pop    %ebx
+  801966:	5e                   	pop    %esi
+  801967:	5f                   	pop    %edi
+  801968:	5d                   	pop    %ebp
+  801969:	c3                   	ret
@@ -0,0 +1,2574 @@
+
+obj/user/buggyhello2:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	68 00 00 10 00       	push   $0x100000
+  80003e:	ff 35 00 20 80 00    	push   0x802000
+  800044:	e8 68 00 00 00       	call   8000b1 <sys_cputs>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800059:	e8 cb 09 00 00       	call   800a29 <uinfo_envid>
+  80005e:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  800063:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  800069:	05 00 00 00 ed       	add    $0xed000000,%eax
+  80006e:	a3 20 20 80 00       	mov    %eax,0x802020
+  800073:	85 db                	test   %ebx,%ebx
+  800075:	7e 07                	jle    80007e <libmain+0x30>
+  800077:	8b 06                	mov    (%esi),%eax
+  800079:	a3 04 20 80 00       	mov    %eax,0x802004
+  80007e:	83 ec 08             	sub    $0x8,%esp
+  800081:	56                   	push   %esi
+  800082:	53                   	push   %ebx
+  800083:	e8 ab ff ff ff       	call   800033 <umain>
+  800088:	e8 0a 00 00 00       	call   800097 <exit>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800093:	5b                   	pop    %ebx
+  800094:	5e                   	pop    %esi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+
+00800097 <exit>:
+  800097:	55                   	push   %ebp
+  800098:	89 e5                	mov    %esp,%ebp
+  80009a:	83 ec 08             	sub    $0x8,%esp
+  80009d:	e8 20 0a 00 00       	call   800ac2 <bflush>
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	6a 00                	push   $0x0
+  8000a7:	e8 d3 00 00 00       	call   80017f <sys_env_destroy>
+  8000ac:	83 c4 10             	add    $0x10,%esp
+  8000af:	c9                   	leave
+  8000b0:	c3                   	ret
+
+008000b1 <sys_cputs>:
+  8000b1:	55                   	push   %ebp
+  8000b2:	89 e5                	mov    %esp,%ebp
+  8000b4:	57                   	push   %edi
+  8000b5:	56                   	push   %esi
+  8000b6:	53                   	push   %ebx
+  8000b7:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8000be:	78 21                	js     8000e1 <sys_cputs+0x30>
+  8000c0:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8000c7:	75 2d                	jne    8000f6 <sys_cputs+0x45>
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000d4:	89 c3                	mov    %eax,%ebx
+  8000d6:	89 c7                	mov    %eax,%edi
+  8000d8:	89 c6                	mov    %eax,%esi
+  8000da:	cd 30                	int    $0x30
+  8000dc:	5b                   	pop    %ebx
+  8000dd:	5e                   	pop    %esi
+  8000de:	5f                   	pop    %edi
+  8000df:	5d                   	pop    %ebp
+  8000e0:	c3                   	ret
+  8000e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000e6:	0f a2                	cpuid
+  8000e8:	c1 ea 0b             	shr    $0xb,%edx
+  8000eb:	83 e2 01             	and    $0x1,%edx
+  8000ee:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8000f4:	eb ca                	jmp    8000c0 <sys_cputs+0xf>
+  8000f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800101:	89 c3                	mov    %eax,%ebx
+  800103:	89 c7                	mov    %eax,%edi
+  800105:	89 c6                	mov    %eax,%esi
+  800107:	55                   	push   %ebp
+  800108:	68 11 01 80 00       	push   $0x800111
+  80010d:	89 e5                	mov    %esp,%ebp
+  80010f:	0f 34                	sysenter
+  800111:	83 c4 04             	add    $0x4,%esp
+  800114:	5d                   	pop    %ebp
+  800115:	eb c5                	jmp    8000dc <sys_cputs+0x2b>
+
+00800117 <sys_cgetc>:
+  800117:	55                   	push   %ebp
+  800118:	89 e5                	mov    %esp,%ebp
+  80011a:	57                   	push   %edi
+  80011b:	56                   	push   %esi
+  80011c:	53                   	push   %ebx
+  80011d:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800124:	78 22                	js     800148 <sys_cgetc+0x31>
+  800126:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80012d:	75 2e                	jne    80015d <sys_cgetc+0x46>
+  80012f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800134:	b8 01 00 00 00       	mov    $0x1,%eax
+  800139:	89 d1                	mov    %edx,%ecx
+  80013b:	89 d3                	mov    %edx,%ebx
+  80013d:	89 d7                	mov    %edx,%edi
+  80013f:	89 d6                	mov    %edx,%esi
+  800141:	cd 30                	int    $0x30
+  800143:	5b                   	pop    %ebx
+  800144:	5e                   	pop    %esi
+  800145:	5f                   	pop    %edi
+  800146:	5d                   	pop    %ebp
+  800147:	c3                   	ret
+  800148:	b8 01 00 00 00       	mov    $0x1,%eax
+  80014d:	0f a2                	cpuid
+  80014f:	c1 ea 0b             	shr    $0xb,%edx
+  800152:	83 e2 01             	and    $0x1,%edx
+  800155:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80015b:	eb c9                	jmp    800126 <sys_cgetc+0xf>
+  80015d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800162:	b8 01 00 00 00       	mov    $0x1,%eax
+  800167:	89 d1                	mov    %edx,%ecx
+  800169:	89 d3                	mov    %edx,%ebx
+  80016b:	89 d7                	mov    %edx,%edi
+  80016d:	89 d6                	mov    %edx,%esi
+  80016f:	55                   	push   %ebp
+  800170:	68 79 01 80 00       	push   $0x800179
+  800175:	89 e5                	mov    %esp,%ebp
+  800177:	0f 34                	sysenter
+  800179:	83 c4 04             	add    $0x4,%esp
+  80017c:	5d                   	pop    %ebp
+  80017d:	eb c4                	jmp    800143 <sys_cgetc+0x2c>
+
+0080017f <sys_env_destroy>:
+  80017f:	55                   	push   %ebp
+  800180:	89 e5                	mov    %esp,%ebp
+  800182:	57                   	push   %edi
+  800183:	56                   	push   %esi
+  800184:	53                   	push   %ebx
+  800185:	83 ec 0c             	sub    $0xc,%esp
+  800188:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80018f:	78 2a                	js     8001bb <sys_env_destroy+0x3c>
+  800191:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800198:	75 36                	jne    8001d0 <sys_env_destroy+0x51>
+  80019a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80019f:	b8 03 00 00 00       	mov    $0x3,%eax
+  8001a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001a7:	89 cb                	mov    %ecx,%ebx
+  8001a9:	89 cf                	mov    %ecx,%edi
+  8001ab:	89 ce                	mov    %ecx,%esi
+  8001ad:	cd 30                	int    $0x30
+  8001af:	85 c0                	test   %eax,%eax
+  8001b1:	7f 40                	jg     8001f3 <sys_env_destroy+0x74>
+  8001b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001b6:	5b                   	pop    %ebx
+  8001b7:	5e                   	pop    %esi
+  8001b8:	5f                   	pop    %edi
+  8001b9:	5d                   	pop    %ebp
+  8001ba:	c3                   	ret
+  8001bb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001c0:	0f a2                	cpuid
+  8001c2:	c1 ea 0b             	shr    $0xb,%edx
+  8001c5:	83 e2 01             	and    $0x1,%edx
+  8001c8:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8001ce:	eb c1                	jmp    800191 <sys_env_destroy+0x12>
+  8001d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001d8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8001dd:	89 cb                	mov    %ecx,%ebx
+  8001df:	89 cf                	mov    %ecx,%edi
+  8001e1:	89 ce                	mov    %ecx,%esi
+  8001e3:	55                   	push   %ebp
+  8001e4:	68 ed 01 80 00       	push   $0x8001ed
+  8001e9:	89 e5                	mov    %esp,%ebp
+  8001eb:	0f 34                	sysenter
+  8001ed:	83 c4 04             	add    $0x4,%esp
+  8001f0:	5d                   	pop    %ebp
+  8001f1:	eb bc                	jmp    8001af <sys_env_destroy+0x30>
+  8001f3:	83 ec 0c             	sub    $0xc,%esp
+  8001f6:	50                   	push   %eax
+  8001f7:	6a 03                	push   $0x3
+  8001f9:	68 98 19 80 00       	push   $0x801998
+  8001fe:	6a 49                	push   $0x49
+  800200:	68 b5 19 80 00       	push   $0x8019b5
+  800205:	e8 af 09 00 00       	call   800bb9 <_panic>
+
+0080020a <sys_getenvid>:
+  80020a:	55                   	push   %ebp
+  80020b:	89 e5                	mov    %esp,%ebp
+  80020d:	57                   	push   %edi
+  80020e:	56                   	push   %esi
+  80020f:	53                   	push   %ebx
+  800210:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800217:	78 22                	js     80023b <sys_getenvid+0x31>
+  800219:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800220:	75 2e                	jne    800250 <sys_getenvid+0x46>
+  800222:	ba 00 00 00 00       	mov    $0x0,%edx
+  800227:	b8 02 00 00 00       	mov    $0x2,%eax
+  80022c:	89 d1                	mov    %edx,%ecx
+  80022e:	89 d3                	mov    %edx,%ebx
+  800230:	89 d7                	mov    %edx,%edi
+  800232:	89 d6                	mov    %edx,%esi
+  800234:	cd 30                	int    $0x30
+  800236:	5b                   	pop    %ebx
+  800237:	5e                   	pop    %esi
+  800238:	5f                   	pop    %edi
+  800239:	5d                   	pop    %ebp
+  80023a:	c3                   	ret
+  80023b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800240:	0f a2                	cpuid
+  800242:	c1 ea 0b             	shr    $0xb,%edx
+  800245:	83 e2 01             	and    $0x1,%edx
+  800248:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80024e:	eb c9                	jmp    800219 <sys_getenvid+0xf>
+  800250:	ba 00 00 00 00       	mov    $0x0,%edx
+  800255:	b8 02 00 00 00       	mov    $0x2,%eax
+  80025a:	89 d1                	mov    %edx,%ecx
+  80025c:	89 d3                	mov    %edx,%ebx
+  80025e:	89 d7                	mov    %edx,%edi
+  800260:	89 d6                	mov    %edx,%esi
+  800262:	55                   	push   %ebp
+  800263:	68 6c 02 80 00       	push   $0x80026c
+  800268:	89 e5                	mov    %esp,%ebp
+  80026a:	0f 34                	sysenter
+  80026c:	83 c4 04             	add    $0x4,%esp
+  80026f:	5d                   	pop    %ebp
+  800270:	eb c4                	jmp    800236 <sys_getenvid+0x2c>
+
+00800272 <sys_yield>:
+  800272:	55                   	push   %ebp
+  800273:	89 e5                	mov    %esp,%ebp
+  800275:	57                   	push   %edi
+  800276:	56                   	push   %esi
+  800277:	53                   	push   %ebx
+  800278:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80027f:	78 22                	js     8002a3 <sys_yield+0x31>
+  800281:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800288:	75 2e                	jne    8002b8 <sys_yield+0x46>
+  80028a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80028f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800294:	89 d1                	mov    %edx,%ecx
+  800296:	89 d3                	mov    %edx,%ebx
+  800298:	89 d7                	mov    %edx,%edi
+  80029a:	89 d6                	mov    %edx,%esi
+  80029c:	cd 30                	int    $0x30
+  80029e:	5b                   	pop    %ebx
+  80029f:	5e                   	pop    %esi
+  8002a0:	5f                   	pop    %edi
+  8002a1:	5d                   	pop    %ebp
+  8002a2:	c3                   	ret
+  8002a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8002a8:	0f a2                	cpuid
+  8002aa:	c1 ea 0b             	shr    $0xb,%edx
+  8002ad:	83 e2 01             	and    $0x1,%edx
+  8002b0:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8002b6:	eb c9                	jmp    800281 <sys_yield+0xf>
+  8002b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002bd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002c2:	89 d1                	mov    %edx,%ecx
+  8002c4:	89 d3                	mov    %edx,%ebx
+  8002c6:	89 d7                	mov    %edx,%edi
+  8002c8:	89 d6                	mov    %edx,%esi
+  8002ca:	55                   	push   %ebp
+  8002cb:	68 d4 02 80 00       	push   $0x8002d4
+  8002d0:	89 e5                	mov    %esp,%ebp
+  8002d2:	0f 34                	sysenter
+  8002d4:	83 c4 04             	add    $0x4,%esp
+  8002d7:	5d                   	pop    %ebp
+  8002d8:	eb c4                	jmp    80029e <sys_yield+0x2c>
+
+008002da <sys_env_set_cow>:
+  8002da:	55                   	push   %ebp
+  8002db:	89 e5                	mov    %esp,%ebp
+  8002dd:	57                   	push   %edi
+  8002de:	56                   	push   %esi
+  8002df:	53                   	push   %ebx
+  8002e0:	83 ec 0c             	sub    $0xc,%esp
+  8002e3:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8002ea:	78 2b                	js     800317 <sys_env_set_cow+0x3d>
+  8002ec:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8002f3:	75 37                	jne    80032c <sys_env_set_cow+0x52>
+  8002f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002fa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8002ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800302:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800305:	89 df                	mov    %ebx,%edi
+  800307:	89 de                	mov    %ebx,%esi
+  800309:	cd 30                	int    $0x30
+  80030b:	85 c0                	test   %eax,%eax
+  80030d:	7f 41                	jg     800350 <sys_env_set_cow+0x76>
+  80030f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800312:	5b                   	pop    %ebx
+  800313:	5e                   	pop    %esi
+  800314:	5f                   	pop    %edi
+  800315:	5d                   	pop    %ebp
+  800316:	c3                   	ret
+  800317:	b8 01 00 00 00       	mov    $0x1,%eax
+  80031c:	0f a2                	cpuid
+  80031e:	c1 ea 0b             	shr    $0xb,%edx
+  800321:	83 e2 01             	and    $0x1,%edx
+  800324:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80032a:	eb c0                	jmp    8002ec <sys_env_set_cow+0x12>
+  80032c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800331:	8b 55 08             	mov    0x8(%ebp),%edx
+  800334:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800337:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80033c:	89 df                	mov    %ebx,%edi
+  80033e:	89 de                	mov    %ebx,%esi
+  800340:	55                   	push   %ebp
+  800341:	68 4a 03 80 00       	push   $0x80034a
+  800346:	89 e5                	mov    %esp,%ebp
+  800348:	0f 34                	sysenter
+  80034a:	83 c4 04             	add    $0x4,%esp
+  80034d:	5d                   	pop    %ebp
+  80034e:	eb bb                	jmp    80030b <sys_env_set_cow+0x31>
+  800350:	83 ec 0c             	sub    $0xc,%esp
+  800353:	50                   	push   %eax
+  800354:	6a 0d                	push   $0xd
+  800356:	68 98 19 80 00       	push   $0x801998
+  80035b:	6a 49                	push   $0x49
+  80035d:	68 b5 19 80 00       	push   $0x8019b5
+  800362:	e8 52 08 00 00       	call   800bb9 <_panic>
+
+00800367 <sys_env_set_quota>:
+  800367:	55                   	push   %ebp
+  800368:	89 e5                	mov    %esp,%ebp
+  80036a:	57                   	push   %edi
+  80036b:	56                   	push   %esi
+  80036c:	53                   	push   %ebx
+  80036d:	83 ec 0c             	sub    $0xc,%esp
+  800370:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800377:	78 2b                	js     8003a4 <sys_env_set_quota+0x3d>
+  800379:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800380:	75 37                	jne    8003b9 <sys_env_set_quota+0x52>
+  800382:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800387:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80038c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80038f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800392:	89 df                	mov    %ebx,%edi
+  800394:	89 de                	mov    %ebx,%esi
+  800396:	cd 30                	int    $0x30
+  800398:	85 c0                	test   %eax,%eax
+  80039a:	7f 41                	jg     8003dd <sys_env_set_quota+0x76>
+  80039c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80039f:	5b                   	pop    %ebx
+  8003a0:	5e                   	pop    %esi
+  8003a1:	5f                   	pop    %edi
+  8003a2:	5d                   	pop    %ebp
+  8003a3:	c3                   	ret
+  8003a4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003a9:	0f a2                	cpuid
+  8003ab:	c1 ea 0b             	shr    $0xb,%edx
+  8003ae:	83 e2 01             	and    $0x1,%edx
+  8003b1:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8003b7:	eb c0                	jmp    800379 <sys_env_set_quota+0x12>
+  8003b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003c9:	89 df                	mov    %ebx,%edi
+  8003cb:	89 de                	mov    %ebx,%esi
+  8003cd:	55                   	push   %ebp
+  8003ce:	68 d7 03 80 00       	push   $0x8003d7
+  8003d3:	89 e5                	mov    %esp,%ebp
+  8003d5:	0f 34                	sysenter
+  8003d7:	83 c4 04             	add    $0x4,%esp
+  8003da:	5d                   	pop    %ebp
+  8003db:	eb bb                	jmp    800398 <sys_env_set_quota+0x31>
+  8003dd:	83 ec 0c             	sub    $0xc,%esp
+  8003e0:	50                   	push   %eax
+  8003e1:	6a 0f                	push   $0xf
+  8003e3:	68 98 19 80 00       	push   $0x801998
+  8003e8:	6a 49                	push   $0x49
+  8003ea:	68 b5 19 80 00       	push   $0x8019b5
+  8003ef:	e8 c5 07 00 00       	call   800bb9 <_panic>
+
+008003f4 <sys_page_alloc>:
+  8003f4:	55                   	push   %ebp
+  8003f5:	89 e5                	mov    %esp,%ebp
+  8003f7:	57                   	push   %edi
+  8003f8:	56                   	push   %esi
+  8003f9:	53                   	push   %ebx
+  8003fa:	83 ec 0c             	sub    $0xc,%esp
+  8003fd:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800404:	78 2c                	js     800432 <sys_page_alloc+0x3e>
+  800406:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80040d:	75 38                	jne    800447 <sys_page_alloc+0x53>
+  80040f:	be 00 00 00 00       	mov    $0x0,%esi
+  800414:	b8 04 00 00 00       	mov    $0x4,%eax
+  800419:	8b 55 08             	mov    0x8(%ebp),%edx
+  80041c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80041f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800422:	89 f7                	mov    %esi,%edi
+  800424:	cd 30                	int    $0x30
+  800426:	85 c0                	test   %eax,%eax
+  800428:	7f 42                	jg     80046c <sys_page_alloc+0x78>
+  80042a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80042d:	5b                   	pop    %ebx
+  80042e:	5e                   	pop    %esi
+  80042f:	5f                   	pop    %edi
+  800430:	5d                   	pop    %ebp
+  800431:	c3                   	ret
+  800432:	b8 01 00 00 00       	mov    $0x1,%eax
+  800437:	0f a2                	cpuid
+  800439:	c1 ea 0b             	shr    $0xb,%edx
+  80043c:	83 e2 01             	and    $0x1,%edx
+  80043f:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800445:	eb bf                	jmp    800406 <sys_page_alloc+0x12>
+  800447:	be 00 00 00 00       	mov    $0x0,%esi
+  80044c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80044f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800452:	b8 04 00 00 00       	mov    $0x4,%eax
+  800457:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80045a:	89 f7                	mov    %esi,%edi
+  80045c:	55                   	push   %ebp
+  80045d:	68 66 04 80 00       	push   $0x800466
+  800462:	89 e5                	mov    %esp,%ebp
+  800464:	0f 34                	sysenter
+  800466:	83 c4 04             	add    $0x4,%esp
+  800469:	5d                   	pop    %ebp
+  80046a:	eb ba                	jmp    800426 <sys_page_alloc+0x32>
+  80046c:	83 ec 0c             	sub    $0xc,%esp
+  80046f:	50                   	push   %eax
+  800470:	6a 04                	push   $0x4
+  800472:	68 98 19 80 00       	push   $0x801998
+  800477:	6a 49                	push   $0x49
+  800479:	68 b5 19 80 00       	push   $0x8019b5
+  80047e:	e8 36 07 00 00       	call   800bb9 <_panic>
+
+00800483 <sys_page_map>:
+  800483:	55                   	push   %ebp
+  800484:	89 e5                	mov    %esp,%ebp
+  800486:	57                   	push   %edi
+  800487:	56                   	push   %esi
+  800488:	53                   	push   %ebx
+  800489:	83 ec 0c             	sub    $0xc,%esp
+  80048c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800493:	78 2b                	js     8004c0 <sys_page_map+0x3d>
+  800495:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80049c:	75 37                	jne    8004d5 <sys_page_map+0x52>
+  80049e:	b8 05 00 00 00       	mov    $0x5,%eax
+  8004a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004ac:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004af:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004b2:	cd 30                	int    $0x30
+  8004b4:	85 c0                	test   %eax,%eax
+  8004b6:	7f 41                	jg     8004f9 <sys_page_map+0x76>
+  8004b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004bb:	5b                   	pop    %ebx
+  8004bc:	5e                   	pop    %esi
+  8004bd:	5f                   	pop    %edi
+  8004be:	5d                   	pop    %ebp
+  8004bf:	c3                   	ret
+  8004c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004c5:	0f a2                	cpuid
+  8004c7:	c1 ea 0b             	shr    $0xb,%edx
+  8004ca:	83 e2 01             	and    $0x1,%edx
+  8004cd:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8004d3:	eb c0                	jmp    800495 <sys_page_map+0x12>
+  8004d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004db:	b8 05 00 00 00       	mov    $0x5,%eax
+  8004e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004e3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004e6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004e9:	55                   	push   %ebp
+  8004ea:	68 f3 04 80 00       	push   $0x8004f3
+  8004ef:	89 e5                	mov    %esp,%ebp
+  8004f1:	0f 34                	sysenter
+  8004f3:	83 c4 04             	add    $0x4,%esp
+  8004f6:	5d                   	pop    %ebp
+  8004f7:	eb bb                	jmp    8004b4 <sys_page_map+0x31>
+  8004f9:	83 ec 0c             	sub    $0xc,%esp
+  8004fc:	50                   	push   %eax
+  8004fd:	6a 05                	push   $0x5
+  8004ff:	68 98 19 80 00       	push   $0x801998
+  800504:	6a 49                	push   $0x49
+  800506:	68 b5 19 80 00       	push   $0x8019b5
+  80050b:	e8 a9 06 00 00       	call   800bb9 <_panic>
+
+00800510 <sys_page_unmap>:
+  800510:	55                   	push   %ebp
+  800511:	89 e5                	mov    %esp,%ebp
+  800513:	57                   	push   %edi
+  800514:	56                   	push   %esi
+  800515:	53                   	push   %ebx
+  800516:	83 ec 0c             	sub    $0xc,%esp
+  800519:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800520:	78 2b                	js     80054d <sys_page_unmap+0x3d>
+  800522:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800529:	75 37                	jne    800562 <sys_page_unmap+0x52>
+  80052b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800530:	b8 06 00 00 00       	mov    $0x6,%eax
+  800535:	8b 55 08             	mov    0x8(%ebp),%edx
+  800538:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80053b:	89 df                	mov    %ebx,%edi
+  80053d:	89 de                	mov    %ebx,%esi
+  80053f:	cd 30                	int    $0x30
+  800541:	85 c0                	test   %eax,%eax
+  800543:	7f 41                	jg     800586 <sys_page_unmap+0x76>
+  800545:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800548:	5b                   	pop    %ebx
+  800549:	5e                   	pop    %esi
+  80054a:	5f                   	pop    %edi
+  80054b:	5d                   	pop    %ebp
+  80054c:	c3                   	ret
+  80054d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800552:	0f a2                	cpuid
+  800554:	c1 ea 0b             	shr    $0xb,%edx
+  800557:	83 e2 01             	and    $0x1,%edx
+  80055a:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800560:	eb c0                	jmp    800522 <sys_page_unmap+0x12>
+  800562:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800567:	8b 55 08             	mov    0x8(%ebp),%edx
+  80056a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80056d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800572:	89 df                	mov    %ebx,%edi
+  800574:	89 de                	mov    %ebx,%esi
+  800576:	55                   	push   %ebp
+  800577:	68 80 05 80 00       	push   $0x800580
+  80057c:	89 e5                	mov    %esp,%ebp
+  80057e:	0f 34                	sysenter
+  800580:	83 c4 04             	add    $0x4,%esp
+  800583:	5d                   	pop    %ebp
+  800584:	eb bb                	jmp    800541 <sys_page_unmap+0x31>
+  800586:	83 ec 0c             	sub    $0xc,%esp
+  800589:	50                   	push   %eax
+  80058a:	6a 06                	push   $0x6
+  80058c:	68 98 19 80 00       	push   $0x801998
+  800591:	6a 49                	push   $0x49
+  800593:	68 b5 19 80 00       	push   $0x8019b5
+  800598:	e8 1c 06 00 00       	call   800bb9 <_panic>
+
+0080059d <sys_page_reuse>:
+  80059d:	55                   	push   %ebp
+  80059e:	89 e5                	mov    %esp,%ebp
+  8005a0:	57                   	push   %edi
+  8005a1:	56                   	push   %esi
+  8005a2:	53                   	push   %ebx
+  8005a3:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8005aa:	78 24                	js     8005d0 <sys_page_reuse+0x33>
+  8005ac:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8005b3:	75 30                	jne    8005e5 <sys_page_reuse+0x48>
+  8005b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ba:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005c5:	89 df                	mov    %ebx,%edi
+  8005c7:	89 de                	mov    %ebx,%esi
+  8005c9:	cd 30                	int    $0x30
+  8005cb:	5b                   	pop    %ebx
+  8005cc:	5e                   	pop    %esi
+  8005cd:	5f                   	pop    %edi
+  8005ce:	5d                   	pop    %ebp
+  8005cf:	c3                   	ret
+  8005d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005d5:	0f a2                	cpuid
+  8005d7:	c1 ea 0b             	shr    $0xb,%edx
+  8005da:	83 e2 01             	and    $0x1,%edx
+  8005dd:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8005e3:	eb c7                	jmp    8005ac <sys_page_reuse+0xf>
+  8005e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005f0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005f5:	89 df                	mov    %ebx,%edi
+  8005f7:	89 de                	mov    %ebx,%esi
+  8005f9:	55                   	push   %ebp
+  8005fa:	68 03 06 80 00       	push   $0x800603
+  8005ff:	89 e5                	mov    %esp,%ebp
+  800601:	0f 34                	sysenter
+  800603:	83 c4 04             	add    $0x4,%esp
+  800606:	5d                   	pop    %ebp
+  800607:	eb c2                	jmp    8005cb <sys_page_reuse+0x2e>
+
+00800609 <sys_env_set_status>:
+  800609:	55                   	push   %ebp
+  80060a:	89 e5                	mov    %esp,%ebp
+  80060c:	57                   	push   %edi
+  80060d:	56                   	push   %esi
+  80060e:	53                   	push   %ebx
+  80060f:	83 ec 0c             	sub    $0xc,%esp
+  800612:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800619:	78 2b                	js     800646 <sys_env_set_status+0x3d>
+  80061b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800622:	75 37                	jne    80065b <sys_env_set_status+0x52>
+  800624:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800629:	b8 08 00 00 00       	mov    $0x8,%eax
+  80062e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800631:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800634:	89 df                	mov    %ebx,%edi
+  800636:	89 de                	mov    %ebx,%esi
+  800638:	cd 30                	int    $0x30
+  80063a:	85 c0                	test   %eax,%eax
+  80063c:	7f 41                	jg     80067f <sys_env_set_status+0x76>
+  80063e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800641:	5b                   	pop    %ebx
+  800642:	5e                   	pop    %esi
+  800643:	5f                   	pop    %edi
+  800644:	5d                   	pop    %ebp
+  800645:	c3                   	ret
+  800646:	b8 01 00 00 00       	mov    $0x1,%eax
+  80064b:	0f a2                	cpuid
+  80064d:	c1 ea 0b             	shr    $0xb,%edx
+  800650:	83 e2 01             	and    $0x1,%edx
+  800653:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800659:	eb c0                	jmp    80061b <sys_env_set_status+0x12>
+  80065b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800660:	8b 55 08             	mov    0x8(%ebp),%edx
+  800663:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800666:	b8 08 00 00 00       	mov    $0x8,%eax
+  80066b:	89 df                	mov    %ebx,%edi
+  80066d:	89 de                	mov    %ebx,%esi
+  80066f:	55                   	push   %ebp
+  800670:	68 79 06 80 00       	push   $0x800679
+  800675:	89 e5                	mov    %esp,%ebp
+  800677:	0f 34                	sysenter
+  800679:	83 c4 04             	add    $0x4,%esp
+  80067c:	5d                   	pop    %ebp
+  80067d:	eb bb                	jmp    80063a <sys_env_set_status+0x31>
+  80067f:	83 ec 0c             	sub    $0xc,%esp
+  800682:	50                   	push   %eax
+  800683:	6a 08                	push   $0x8
+  800685:	68 98 19 80 00       	push   $0x801998
+  80068a:	6a 49                	push   $0x49
+  80068c:	68 b5 19 80 00       	push   $0x8019b5
+  800691:	e8 23 05 00 00       	call   800bb9 <_panic>
+
+00800696 <sys_env_set_pgfault_upcall>:
+  800696:	55                   	push   %ebp
+  800697:	89 e5                	mov    %esp,%ebp
+  800699:	57                   	push   %edi
+  80069a:	56                   	push   %esi
+  80069b:	53                   	push   %ebx
+  80069c:	83 ec 0c             	sub    $0xc,%esp
+  80069f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8006a6:	78 2b                	js     8006d3 <sys_env_set_pgfault_upcall+0x3d>
+  8006a8:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8006af:	75 37                	jne    8006e8 <sys_env_set_pgfault_upcall+0x52>
+  8006b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006b6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006c1:	89 df                	mov    %ebx,%edi
+  8006c3:	89 de                	mov    %ebx,%esi
+  8006c5:	cd 30                	int    $0x30
+  8006c7:	85 c0                	test   %eax,%eax
+  8006c9:	7f 41                	jg     80070c <sys_env_set_pgfault_upcall+0x76>
+  8006cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006ce:	5b                   	pop    %ebx
+  8006cf:	5e                   	pop    %esi
+  8006d0:	5f                   	pop    %edi
+  8006d1:	5d                   	pop    %ebp
+  8006d2:	c3                   	ret
+  8006d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006d8:	0f a2                	cpuid
+  8006da:	c1 ea 0b             	shr    $0xb,%edx
+  8006dd:	83 e2 01             	and    $0x1,%edx
+  8006e0:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8006e6:	eb c0                	jmp    8006a8 <sys_env_set_pgfault_upcall+0x12>
+  8006e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006f3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006f8:	89 df                	mov    %ebx,%edi
+  8006fa:	89 de                	mov    %ebx,%esi
+  8006fc:	55                   	push   %ebp
+  8006fd:	68 06 07 80 00       	push   $0x800706
+  800702:	89 e5                	mov    %esp,%ebp
+  800704:	0f 34                	sysenter
+  800706:	83 c4 04             	add    $0x4,%esp
+  800709:	5d                   	pop    %ebp
+  80070a:	eb bb                	jmp    8006c7 <sys_env_set_pgfault_upcall+0x31>
+  80070c:	83 ec 0c             	sub    $0xc,%esp
+  80070f:	50                   	push   %eax
+  800710:	6a 09                	push   $0x9
+  800712:	68 98 19 80 00       	push   $0x801998
+  800717:	6a 49                	push   $0x49
+  800719:	68 b5 19 80 00       	push   $0x8019b5
+  80071e:	e8 96 04 00 00       	call   800bb9 <_panic>
+
+00800723 <sys_env_set_trace>:
+  800723:	55                   	push   %ebp
+  800724:	89 e5                	mov    %esp,%ebp
+  800726:	57                   	push   %edi
+  800727:	56                   	push   %esi
+  800728:	53                   	push   %ebx
+  800729:	83 ec 0c             	sub    $0xc,%esp
+  80072c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800733:	78 2b                	js     800760 <sys_env_set_trace+0x3d>
+  800735:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80073c:	75 37                	jne    800775 <sys_env_set_trace+0x52>
+  80073e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800743:	b8 12 00 00 00       	mov    $0x12,%eax
+  800748:	8b 55 08             	mov    0x8(%ebp),%edx
+  80074b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80074e:	89 df                	mov    %ebx,%edi
+  800750:	89 de                	mov    %ebx,%esi
+  800752:	cd 30                	int    $0x30
+  800754:	85 c0                	test   %eax,%eax
+  800756:	7f 41                	jg     800799 <sys_env_set_trace+0x76>
+  800758:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80075b:	5b                   	pop    %ebx
+  80075c:	5e                   	pop    %esi
+  80075d:	5f                   	pop    %edi
+  80075e:	5d                   	pop    %ebp
+  80075f:	c3                   	ret
+  800760:	b8 01 00 00 00       	mov    $0x1,%eax
+  800765:	0f a2                	cpuid
+  800767:	c1 ea 0b             	shr    $0xb,%edx
+  80076a:	83 e2 01             	and    $0x1,%edx
+  80076d:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800773:	eb c0                	jmp    800735 <sys_env_set_trace+0x12>
+  800775:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80077a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80077d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800780:	b8 12 00 00 00       	mov    $0x12,%eax
+  800785:	89 df                	mov    %ebx,%edi
+  800787:	89 de                	mov    %ebx,%esi
+  800789:	55                   	push   %ebp
+  80078a:	68 93 07 80 00       	push   $0x800793
+  80078f:	89 e5                	mov    %esp,%ebp
+  800791:	0f 34                	sysenter
+  800793:	83 c4 04             	add    $0x4,%esp
+  800796:	5d                   	pop    %ebp
+  800797:	eb bb                	jmp    800754 <sys_env_set_trace+0x31>
+  800799:	83 ec 0c             	sub    $0xc,%esp
+  80079c:	50                   	push   %eax
+  80079d:	6a 12                	push   $0x12
+  80079f:	68 98 19 80 00       	push   $0x801998
+  8007a4:	6a 49                	push   $0x49
+  8007a6:	68 b5 19 80 00       	push   $0x8019b5
+  8007ab:	e8 09 04 00 00       	call   800bb9 <_panic>
+
+008007b0 <sys_env_set_rdpmc>:
+  8007b0:	55                   	push   %ebp
+  8007b1:	89 e5                	mov    %esp,%ebp
+  8007b3:	57                   	push   %edi
+  8007b4:	56                   	push   %esi
+  8007b5:	53                   	push   %ebx
+  8007b6:	83 ec 0c             	sub    $0xc,%esp
+  8007b9:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8007c0:	78 2b                	js     8007ed <sys_env_set_rdpmc+0x3d>
+  8007c2:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8007c9:	75 37                	jne    800802 <sys_env_set_rdpmc+0x52>
+  8007cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007d0:	b8 13 00 00 00       	mov    $0x13,%eax
+  8007d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007db:	89 df                	mov    %ebx,%edi
+  8007dd:	89 de                	mov    %ebx,%esi
+  8007df:	cd 30                	int    $0x30
+  8007e1:	85 c0                	test   %eax,%eax
+  8007e3:	7f 41                	jg     800826 <sys_env_set_rdpmc+0x76>
+  8007e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e8:	5b                   	pop    %ebx
+  8007e9:	5e                   	pop    %esi
+  8007ea:	5f                   	pop    %edi
+  8007eb:	5d                   	pop    %ebp
+  8007ec:	c3                   	ret
+  8007ed:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007f2:	0f a2                	cpuid
+  8007f4:	c1 ea 0b             	shr    $0xb,%edx
+  8007f7:	83 e2 01             	and    $0x1,%edx
+  8007fa:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800800:	eb c0                	jmp    8007c2 <sys_env_set_rdpmc+0x12>
+  800802:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800807:	8b 55 08             	mov    0x8(%ebp),%edx
+  80080a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80080d:	b8 13 00 00 00       	mov    $0x13,%eax
+  800812:	89 df                	mov    %ebx,%edi
+  800814:	89 de                	mov    %ebx,%esi
+  800816:	55                   	push   %ebp
+  800817:	68 20 08 80 00       	push   $0x800820
+  80081c:	89 e5                	mov    %esp,%ebp
+  80081e:	0f 34                	sysenter
+  800820:	83 c4 04             	add    $0x4,%esp
+  800823:	5d                   	pop    %ebp
+  800824:	eb bb                	jmp    8007e1 <sys_env_set_rdpmc+0x31>
+  800826:	83 ec 0c             	sub    $0xc,%esp
+  800829:	50                   	push   %eax
+  80082a:	6a 13                	push   $0x13
+  80082c:	68 98 19 80 00       	push   $0x801998
+  800831:	6a 49                	push   $0x49
+  800833:	68 b5 19 80 00       	push   $0x8019b5
+  800838:	e8 7c 03 00 00       	call   800bb9 <_panic>
+
+0080083d <sys_ring_setup>:
+  80083d:	55                   	push   %ebp
+  80083e:	89 e5                	mov    %esp,%ebp
+  800840:	57                   	push   %edi
+  800841:	56                   	push   %esi
+  800842:	53                   	push   %ebx
+  800843:	83 ec 0c             	sub    $0xc,%esp
+  800846:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80084d:	78 29                	js     800878 <sys_ring_setup+0x3b>
+  80084f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800856:	75 35                	jne    80088d <sys_ring_setup+0x50>
+  800858:	ba 00 00 00 00       	mov    $0x0,%edx
+  80085d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800862:	89 d1                	mov    %edx,%ecx
+  800864:	89 d3                	mov    %edx,%ebx
+  800866:	89 d7                	mov    %edx,%edi
+  800868:	89 d6                	mov    %edx,%esi
+  80086a:	cd 30                	int    $0x30
+  80086c:	85 c0                	test   %eax,%eax
+  80086e:	7f 3f                	jg     8008af <sys_ring_setup+0x72>
+  800870:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800873:	5b                   	pop    %ebx
+  800874:	5e                   	pop    %esi
+  800875:	5f                   	pop    %edi
+  800876:	5d                   	pop    %ebp
+  800877:	c3                   	ret
+  800878:	b8 01 00 00 00       	mov    $0x1,%eax
+  80087d:	0f a2                	cpuid
+  80087f:	c1 ea 0b             	shr    $0xb,%edx
+  800882:	83 e2 01             	and    $0x1,%edx
+  800885:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80088b:	eb c2                	jmp    80084f <sys_ring_setup+0x12>
+  80088d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800892:	b8 10 00 00 00       	mov    $0x10,%eax
+  800897:	89 d1                	mov    %edx,%ecx
+  800899:	89 d3                	mov    %edx,%ebx
+  80089b:	89 d7                	mov    %edx,%edi
+  80089d:	89 d6                	mov    %edx,%esi
+  80089f:	55                   	push   %ebp
+  8008a0:	68 a9 08 80 00       	push   $0x8008a9
+  8008a5:	89 e5                	mov    %esp,%ebp
+  8008a7:	0f 34                	sysenter
+  8008a9:	83 c4 04             	add    $0x4,%esp
+  8008ac:	5d                   	pop    %ebp
+  8008ad:	eb bd                	jmp    80086c <sys_ring_setup+0x2f>
+  8008af:	83 ec 0c             	sub    $0xc,%esp
+  8008b2:	50                   	push   %eax
+  8008b3:	6a 10                	push   $0x10
+  8008b5:	68 98 19 80 00       	push   $0x801998
+  8008ba:	6a 49                	push   $0x49
+  8008bc:	68 b5 19 80 00       	push   $0x8019b5
+  8008c1:	e8 f3 02 00 00       	call   800bb9 <_panic>
+
+008008c6 <sys_ring_enter>:
+  8008c6:	55                   	push   %ebp
+  8008c7:	89 e5                	mov    %esp,%ebp
+  8008c9:	57                   	push   %edi
+  8008ca:	56                   	push   %esi
+  8008cb:	53                   	push   %ebx
+  8008cc:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8008d3:	78 22                	js     8008f7 <sys_ring_enter+0x31>
+  8008d5:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8008dc:	75 2e                	jne    80090c <sys_ring_enter+0x46>
+  8008de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008e3:	b8 11 00 00 00       	mov    $0x11,%eax
+  8008e8:	89 d1                	mov    %edx,%ecx
+  8008ea:	89 d3                	mov    %edx,%ebx
+  8008ec:	89 d7                	mov    %edx,%edi
+  8008ee:	89 d6                	mov    %edx,%esi
+  8008f0:	cd 30                	int    $0x30
+  8008f2:	5b                   	pop    %ebx
+  8008f3:	5e                   	pop    %esi
+  8008f4:	5f                   	pop    %edi
+  8008f5:	5d                   	pop    %ebp
+  8008f6:	c3                   	ret
+  8008f7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008fc:	0f a2                	cpuid
+  8008fe:	c1 ea 0b             	shr    $0xb,%edx
+  800901:	83 e2 01             	and    $0x1,%edx
+  800904:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80090a:	eb c9                	jmp    8008d5 <sys_ring_enter+0xf>
+  80090c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800911:	b8 11 00 00 00       	mov    $0x11,%eax
+  800916:	89 d1                	mov    %edx,%ecx
+  800918:	89 d3                	mov    %edx,%ebx
+  80091a:	89 d7                	mov    %edx,%edi
+  80091c:	89 d6                	mov    %edx,%esi
+  80091e:	55                   	push   %ebp
+  80091f:	68 28 09 80 00       	push   $0x800928
+  800924:	89 e5                	mov    %esp,%ebp
+  800926:	0f 34                	sysenter
+  800928:	83 c4 04             	add    $0x4,%esp
+  80092b:	5d                   	pop    %ebp
+  80092c:	eb c4                	jmp    8008f2 <sys_ring_enter+0x2c>
+
+0080092e <sys_ipc_try_send>:
+  80092e:	55                   	push   %ebp
+  80092f:	89 e5                	mov    %esp,%ebp
+  800931:	57                   	push   %edi
+  800932:	56                   	push   %esi
+  800933:	53                   	push   %ebx
+  800934:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80093b:	78 26                	js     800963 <sys_ipc_try_send+0x35>
+  80093d:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800944:	75 32                	jne    800978 <sys_ipc_try_send+0x4a>
+  800946:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80094b:	be 00 00 00 00       	mov    $0x0,%esi
+  800950:	8b 55 08             	mov    0x8(%ebp),%edx
+  800953:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800956:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800959:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80095c:	cd 30                	int    $0x30
+  80095e:	5b                   	pop    %ebx
+  80095f:	5e                   	pop    %esi
+  800960:	5f                   	pop    %edi
+  800961:	5d                   	pop    %ebp
+  800962:	c3                   	ret
+  800963:	b8 01 00 00 00       	mov    $0x1,%eax
+  800968:	0f a2                	cpuid
+  80096a:	c1 ea 0b             	shr    $0xb,%edx
+  80096d:	83 e2 01             	and    $0x1,%edx
+  800970:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800976:	eb c5                	jmp    80093d <sys_ipc_try_send+0xf>
+  800978:	8b 55 08             	mov    0x8(%ebp),%edx
+  80097b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80097e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800983:	be 00 00 00 00       	mov    $0x0,%esi
+  800988:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80098b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80098e:	55                   	push   %ebp
+  80098f:	68 98 09 80 00       	push   $0x800998
+  800994:	89 e5                	mov    %esp,%ebp
+  800996:	0f 34                	sysenter
+  800998:	83 c4 04             	add    $0x4,%esp
+  80099b:	5d                   	pop    %ebp
+  80099c:	eb c0                	jmp    80095e <sys_ipc_try_send+0x30>
+
+0080099e <sys_ipc_recv>:
+  80099e:	55                   	push   %ebp
+  80099f:	89 e5                	mov    %esp,%ebp
+  8009a1:	57                   	push   %edi
+  8009a2:	56                   	push   %esi
+  8009a3:	53                   	push   %ebx
+  8009a4:	83 ec 0c             	sub    $0xc,%esp
+  8009a7:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8009ae:	78 2a                	js     8009da <sys_ipc_recv+0x3c>
+  8009b0:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8009b7:	75 36                	jne    8009ef <sys_ipc_recv+0x51>
+  8009b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009be:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009c6:	89 cb                	mov    %ecx,%ebx
+  8009c8:	89 cf                	mov    %ecx,%edi
+  8009ca:	89 ce                	mov    %ecx,%esi
+  8009cc:	cd 30                	int    $0x30
+  8009ce:	85 c0                	test   %eax,%eax
+  8009d0:	7f 40                	jg     800a12 <sys_ipc_recv+0x74>
+  8009d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009d5:	5b                   	pop    %ebx
+  8009d6:	5e                   	pop    %esi
+  8009d7:	5f                   	pop    %edi
+  8009d8:	5d                   	pop    %ebp
+  8009d9:	c3                   	ret
+  8009da:	b8 01 00 00 00       	mov    $0x1,%eax
+  8009df:	0f a2                	cpuid
+  8009e1:	c1 ea 0b             	shr    $0xb,%edx
+  8009e4:	83 e2 01             	and    $0x1,%edx
+  8009e7:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8009ed:	eb c1                	jmp    8009b0 <sys_ipc_recv+0x12>
+  8009ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009f7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009fc:	89 cb                	mov    %ecx,%ebx
+  8009fe:	89 cf                	mov    %ecx,%edi
+  800a00:	89 ce                	mov    %ecx,%esi
+  800a02:	55                   	push   %ebp
+  800a03:	68 0c 0a 80 00       	push   $0x800a0c
+  800a08:	89 e5                	mov    %esp,%ebp
+  800a0a:	0f 34                	sysenter
+  800a0c:	83 c4 04             	add    $0x4,%esp
+  800a0f:	5d                   	pop    %ebp
+  800a10:	eb bc                	jmp    8009ce <sys_ipc_recv+0x30>
+  800a12:	83 ec 0c             	sub    $0xc,%esp
+  800a15:	50                   	push   %eax
+  800a16:	6a 0c                	push   $0xc
+  800a18:	68 98 19 80 00       	push   $0x801998
+  800a1d:	6a 49                	push   $0x49
+  800a1f:	68 b5 19 80 00       	push   $0x8019b5
+  800a24:	e8 90 01 00 00       	call   800bb9 <_panic>
+
+00800a29 <uinfo_envid>:
+  800a29:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  800a2e:	c3                   	ret
+
+00800a2f <uinfo_cpunum>:
+  800a2f:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  800a34:	c3                   	ret
+
+00800a35 <uinfo_ticks>:
+  800a35:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  800a3a:	c3                   	ret
+
+00800a3b <uinfo_nsec>:
+  800a3b:	55                   	push   %ebp
+  800a3c:	89 e5                	mov    %esp,%ebp
+  800a3e:	57                   	push   %edi
+  800a3f:	56                   	push   %esi
+  800a40:	53                   	push   %ebx
+  800a41:	83 ec 1c             	sub    $0x1c,%esp
+  800a44:	0f 31                	rdtsc
+  800a46:	89 c6                	mov    %eax,%esi
+  800a48:	89 d7                	mov    %edx,%edi
+  800a4a:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  800a50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a5a:	85 c9                	test   %ecx,%ecx
+  800a5c:	74 5c                	je     800aba <uinfo_nsec+0x7f>
+  800a5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a63:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800a66:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800a69:	52                   	push   %edx
+  800a6a:	51                   	push   %ecx
+  800a6b:	57                   	push   %edi
+  800a6c:	56                   	push   %esi
+  800a6d:	e8 63 0d 00 00       	call   8017d5 <__umoddi3>
+  800a72:	83 c4 10             	add    $0x10,%esp
+  800a75:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800a7b:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  800a80:	f7 e3                	mul    %ebx
+  800a82:	01 ca                	add    %ecx,%edx
+  800a84:	ff 75 e4             	push   -0x1c(%ebp)
+  800a87:	ff 75 e0             	push   -0x20(%ebp)
+  800a8a:	52                   	push   %edx
+  800a8b:	50                   	push   %eax
+  800a8c:	e8 6c 0c 00 00       	call   8016fd <__udivdi3>
+  800a91:	83 c4 10             	add    $0x10,%esp
+  800a94:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a97:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a9a:	ff 75 e4             	push   -0x1c(%ebp)
+  800a9d:	ff 75 e0             	push   -0x20(%ebp)
+  800aa0:	57                   	push   %edi
+  800aa1:	56                   	push   %esi
+  800aa2:	e8 56 0c 00 00       	call   8016fd <__udivdi3>
+  800aa7:	83 c4 10             	add    $0x10,%esp
+  800aaa:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800ab0:	f7 e3                	mul    %ebx
+  800ab2:	01 ca                	add    %ecx,%edx
+  800ab4:	03 45 d8             	add    -0x28(%ebp),%eax
+  800ab7:	13 55 dc             	adc    -0x24(%ebp),%edx
+  800aba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800abd:	5b                   	pop    %ebx
+  800abe:	5e                   	pop    %esi
+  800abf:	5f                   	pop    %edi
+  800ac0:	5d                   	pop    %ebp
+  800ac1:	c3                   	ret
+
+00800ac2 <bflush>:
+  800ac2:	a1 40 20 80 00       	mov    0x802040,%eax
+  800ac7:	85 c0                	test   %eax,%eax
+  800ac9:	75 01                	jne    800acc <bflush+0xa>
+  800acb:	c3                   	ret
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	83 ec 10             	sub    $0x10,%esp
+  800ad2:	50                   	push   %eax
+  800ad3:	68 44 20 80 00       	push   $0x802044
+  800ad8:	e8 d4 f5 ff ff       	call   8000b1 <sys_cputs>
+  800add:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  800ae4:	00 00 00 
+  800ae7:	83 c4 10             	add    $0x10,%esp
+  800aea:	c9                   	leave
+  800aeb:	c3                   	ret
+
+00800aec <bputch>:
+  800aec:	55                   	push   %ebp
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	53                   	push   %ebx
+  800af0:	83 ec 04             	sub    $0x4,%esp
+  800af3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800af6:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  800afc:	8d 42 01             	lea    0x1(%edx),%eax
+  800aff:	a3 40 20 80 00       	mov    %eax,0x802040
+  800b04:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b07:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  800b0d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b12:	77 08                	ja     800b1c <bputch+0x30>
+  800b14:	83 03 01             	addl   $0x1,(%ebx)
+  800b17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b1a:	c9                   	leave
+  800b1b:	c3                   	ret
+  800b1c:	e8 a1 ff ff ff       	call   800ac2 <bflush>
+  800b21:	eb f1                	jmp    800b14 <bputch+0x28>
+
+00800b23 <vbprintf>:
+  800b23:	55                   	push   %ebp
+  800b24:	89 e5                	mov    %esp,%ebp
+  800b26:	83 ec 18             	sub    $0x18,%esp
+  800b29:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800b30:	ff 75 0c             	push   0xc(%ebp)
+  800b33:	ff 75 08             	push   0x8(%ebp)
+  800b36:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b39:	50                   	push   %eax
+  800b3a:	68 ec 0a 80 00       	push   $0x800aec
+  800b3f:	e8 4c 02 00 00       	call   800d90 <vprintfmt>
+  800b44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b47:	c9                   	leave
+  800b48:	c3                   	ret
+
+00800b49 <bprintf>:
+  800b49:	55                   	push   %ebp
+  800b4a:	89 e5                	mov    %esp,%ebp
+  800b4c:	83 ec 10             	sub    $0x10,%esp
+  800b4f:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800b52:	50                   	push   %eax
+  800b53:	ff 75 08             	push   0x8(%ebp)
+  800b56:	e8 c8 ff ff ff       	call   800b23 <vbprintf>
+  800b5b:	c9                   	leave
+  800b5c:	c3                   	ret
+
+00800b5d <bwrite>:
+  800b5d:	55                   	push   %ebp
+  800b5e:	89 e5                	mov    %esp,%ebp
+  800b60:	53                   	push   %ebx
+  800b61:	83 ec 04             	sub    $0x4,%esp
+  800b64:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b67:	89 d8                	mov    %ebx,%eax
+  800b69:	03 05 40 20 80 00    	add    0x802040,%eax
+  800b6f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b74:	76 0d                	jbe    800b83 <bwrite+0x26>
+  800b76:	e8 47 ff ff ff       	call   800ac2 <bflush>
+  800b7b:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  800b81:	77 25                	ja     800ba8 <bwrite+0x4b>
+  800b83:	83 ec 04             	sub    $0x4,%esp
+  800b86:	53                   	push   %ebx
+  800b87:	ff 75 08             	push   0x8(%ebp)
+  800b8a:	a1 40 20 80 00       	mov    0x802040,%eax
+  800b8f:	05 44 20 80 00       	add    $0x802044,%eax
+  800b94:	50                   	push   %eax
+  800b95:	e8 61 09 00 00       	call   8014fb <memcpy>
+  800b9a:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  800ba0:	83 c4 10             	add    $0x10,%esp
+  800ba3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ba6:	c9                   	leave
+  800ba7:	c3                   	ret
+  800ba8:	83 ec 08             	sub    $0x8,%esp
+  800bab:	53                   	push   %ebx
+  800bac:	ff 75 08             	push   0x8(%ebp)
+  800baf:	e8 fd f4 ff ff       	call   8000b1 <sys_cputs>
+  800bb4:	83 c4 10             	add    $0x10,%esp
+  800bb7:	eb ea                	jmp    800ba3 <bwrite+0x46>
+
+00800bb9 <_panic>:
+  800bb9:	55                   	push   %ebp
+  800bba:	89 e5                	mov    %esp,%ebp
+  800bbc:	56                   	push   %esi
+  800bbd:	53                   	push   %ebx
+  800bbe:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800bc1:	e8 fc fe ff ff       	call   800ac2 <bflush>
+  800bc6:	8b 35 04 20 80 00    	mov    0x802004,%esi
+  800bcc:	e8 39 f6 ff ff       	call   80020a <sys_getenvid>
+  800bd1:	83 ec 0c             	sub    $0xc,%esp
+  800bd4:	ff 75 0c             	push   0xc(%ebp)
+  800bd7:	ff 75 08             	push   0x8(%ebp)
+  800bda:	56                   	push   %esi
+  800bdb:	50                   	push   %eax
+  800bdc:	68 c4 19 80 00       	push   $0x8019c4
+  800be1:	e8 b3 00 00 00       	call   800c99 <cprintf>
+  800be6:	83 c4 18             	add    $0x18,%esp
+  800be9:	53                   	push   %ebx
+  800bea:	ff 75 10             	push   0x10(%ebp)
+  800bed:	e8 56 00 00 00       	call   800c48 <vcprintf>
+  800bf2:	c7 04 24 8c 19 80 00 	movl   $0x80198c,(%esp)
+  800bf9:	e8 9b 00 00 00       	call   800c99 <cprintf>
+  800bfe:	83 c4 10             	add    $0x10,%esp
+  800c01:	cc                   	int3
+  800c02:	eb fd                	jmp    800c01 <_panic+0x48>
+
+00800c04 <putch>:
+  800c04:	55                   	push   %ebp
+  800c05:	89 e5                	mov    %esp,%ebp
+  800c07:	53                   	push   %ebx
+  800c08:	83 ec 04             	sub    $0x4,%esp
+  800c0b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c0e:	8b 13                	mov    (%ebx),%edx
+  800c10:	8d 42 01             	lea    0x1(%edx),%eax
+  800c13:	89 03                	mov    %eax,(%ebx)
+  800c15:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c18:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800c1c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800c21:	74 09                	je     800c2c <putch+0x28>
+  800c23:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800c27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c2a:	c9                   	leave
+  800c2b:	c3                   	ret
+  800c2c:	83 ec 08             	sub    $0x8,%esp
+  800c2f:	68 ff 00 00 00       	push   $0xff
+  800c34:	8d 43 08             	lea    0x8(%ebx),%eax
+  800c37:	50                   	push   %eax
+  800c38:	e8 74 f4 ff ff       	call   8000b1 <sys_cputs>
+  800c3d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800c43:	83 c4 10             	add    $0x10,%esp
+  800c46:	eb db                	jmp    800c23 <putch+0x1f>
+
+00800c48 <vcprintf>:
+  800c48:	55                   	push   %ebp
+  800c49:	89 e5                	mov    %esp,%ebp
+  800c4b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800c51:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800c58:	00 00 00 
+  800c5b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800c62:	00 00 00 
+  800c65:	ff 75 0c             	push   0xc(%ebp)
+  800c68:	ff 75 08             	push   0x8(%ebp)
+  800c6b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800c71:	50                   	push   %eax
+  800c72:	68 04 0c 80 00       	push   $0x800c04
+  800c77:	e8 14 01 00 00       	call   800d90 <vprintfmt>
+  800c7c:	83 c4 08             	add    $0x8,%esp
+  800c7f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800c85:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800c8b:	50                   	push   %eax
+  800c8c:	e8 20 f4 ff ff       	call   8000b1 <sys_cputs>
+  800c91:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800c97:	c9                   	leave
+  800c98:	c3                   	ret
+
+00800c99 <cprintf>:
+  800c99:	55                   	push   %ebp
+  800c9a:	89 e5                	mov    %esp,%ebp
+  800c9c:	83 ec 10             	sub    $0x10,%esp
+  800c9f:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800ca2:	50                   	push   %eax
+  800ca3:	ff 75 08             	push   0x8(%ebp)
+  800ca6:	e8 9d ff ff ff       	call   800c48 <vcprintf>
+  800cab:	c9                   	leave
+  800cac:	c3                   	ret
+
+00800cad <printnum>:
+  800cad:	55                   	push   %ebp
+  800cae:	89 e5                	mov    %esp,%ebp
+  800cb0:	57                   	push   %edi
+  800cb1:	56                   	push   %esi
+  800cb2:	53                   	push   %ebx
+  800cb3:	83 ec 1c             	sub    $0x1c,%esp
+  800cb6:	89 c7                	mov    %eax,%edi
+  800cb8:	89 d6                	mov    %edx,%esi
+  800cba:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cbd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cc0:	89 d1                	mov    %edx,%ecx
+  800cc2:	89 c2                	mov    %eax,%edx
+  800cc4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cc7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800cca:	8b 45 10             	mov    0x10(%ebp),%eax
+  800ccd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800cd0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800cd3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800cda:	39 c2                	cmp    %eax,%edx
+  800cdc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800cdf:	72 3e                	jb     800d1f <printnum+0x72>
+  800ce1:	83 ec 0c             	sub    $0xc,%esp
+  800ce4:	ff 75 18             	push   0x18(%ebp)
+  800ce7:	83 eb 01             	sub    $0x1,%ebx
+  800cea:	53                   	push   %ebx
+  800ceb:	50                   	push   %eax
+  800cec:	83 ec 08             	sub    $0x8,%esp
+  800cef:	ff 75 e4             	push   -0x1c(%ebp)
+  800cf2:	ff 75 e0             	push   -0x20(%ebp)
+  800cf5:	ff 75 dc             	push   -0x24(%ebp)
+  800cf8:	ff 75 d8             	push   -0x28(%ebp)
+  800cfb:	e8 fd 09 00 00       	call   8016fd <__udivdi3>
+  800d00:	83 c4 18             	add    $0x18,%esp
+  800d03:	52                   	push   %edx
+  800d04:	50                   	push   %eax
+  800d05:	89 f2                	mov    %esi,%edx
+  800d07:	89 f8                	mov    %edi,%eax
+  800d09:	e8 9f ff ff ff       	call   800cad <printnum>
+  800d0e:	83 c4 20             	add    $0x20,%esp
+  800d11:	eb 13                	jmp    800d26 <printnum+0x79>
+  800d13:	83 ec 08             	sub    $0x8,%esp
+  800d16:	56                   	push   %esi
+  800d17:	ff 75 18             	push   0x18(%ebp)
+  800d1a:	ff d7                	call   *%edi
+  800d1c:	83 c4 10             	add    $0x10,%esp
+  800d1f:	83 eb 01             	sub    $0x1,%ebx
+  800d22:	85 db                	test   %ebx,%ebx
+  800d24:	7f ed                	jg     800d13 <printnum+0x66>
+  800d26:	83 ec 08             	sub    $0x8,%esp
+  800d29:	56                   	push   %esi
+  800d2a:	83 ec 04             	sub    $0x4,%esp
+  800d2d:	ff 75 e4             	push   -0x1c(%ebp)
+  800d30:	ff 75 e0             	push   -0x20(%ebp)
+  800d33:	ff 75 dc             	push   -0x24(%ebp)
+  800d36:	ff 75 d8             	push   -0x28(%ebp)
+  800d39:	e8 97 0a 00 00       	call   8017d5 <__umoddi3>
+  800d3e:	83 c4 14             	add    $0x14,%esp
+  800d41:	0f be 80 e7 19 80 00 	movsbl 0x8019e7(%eax),%eax
+  800d48:	50                   	push   %eax
+  800d49:	ff d7                	call   *%edi
+  800d4b:	83 c4 10             	add    $0x10,%esp
+  800d4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d51:	5b                   	pop    %ebx
+  800d52:	5e                   	pop    %esi
+  800d53:	5f                   	pop    %edi
+  800d54:	5d                   	pop    %ebp
+  800d55:	c3                   	ret
+
+00800d56 <sprintputch>:
+  800d56:	55                   	push   %ebp
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d5c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800d60:	8b 10                	mov    (%eax),%edx
+  800d62:	3b 50 04             	cmp    0x4(%eax),%edx
+  800d65:	73 0a                	jae    800d71 <sprintputch+0x1b>
+  800d67:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800d6a:	89 08                	mov    %ecx,(%eax)
+  800d6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d6f:	88 02                	mov    %al,(%edx)
+  800d71:	5d                   	pop    %ebp
+  800d72:	c3                   	ret
+
+00800d73 <printfmt>:
+  800d73:	55                   	push   %ebp
+  800d74:	89 e5                	mov    %esp,%ebp
+  800d76:	83 ec 08             	sub    $0x8,%esp
+  800d79:	8d 45 14             	lea    0x14(%ebp),%eax
+  800d7c:	50                   	push   %eax
+  800d7d:	ff 75 10             	push   0x10(%ebp)
+  800d80:	ff 75 0c             	push   0xc(%ebp)
+  800d83:	ff 75 08             	push   0x8(%ebp)
+  800d86:	e8 05 00 00 00       	call   800d90 <vprintfmt>
+  800d8b:	83 c4 10             	add    $0x10,%esp
+  800d8e:	c9                   	leave
+  800d8f:	c3                   	ret
+
+00800d90 <vprintfmt>:
+  800d90:	55                   	push   %ebp
+  800d91:	89 e5                	mov    %esp,%ebp
+  800d93:	57                   	push   %edi
+  800d94:	56                   	push   %esi
+  800d95:	53                   	push   %ebx
+  800d96:	83 ec 2c             	sub    $0x2c,%esp
+  800d99:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d9c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d9f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800da2:	eb 0a                	jmp    800dae <vprintfmt+0x1e>
+  800da4:	83 ec 08             	sub    $0x8,%esp
+  800da7:	53                   	push   %ebx
+  800da8:	50                   	push   %eax
+  800da9:	ff d6                	call   *%esi
+  800dab:	83 c4 10             	add    $0x10,%esp
+  800dae:	83 c7 01             	add    $0x1,%edi
+  800db1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800db5:	83 f8 25             	cmp    $0x25,%eax
+  800db8:	74 0c                	je     800dc6 <vprintfmt+0x36>
+  800dba:	85 c0                	test   %eax,%eax
+  800dbc:	75 e6                	jne    800da4 <vprintfmt+0x14>
+  800dbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc1:	5b                   	pop    %ebx
+  800dc2:	5e                   	pop    %esi
+  800dc3:	5f                   	pop    %edi
+  800dc4:	5d                   	pop    %ebp
+  800dc5:	c3                   	ret
+  800dc6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800dca:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800dd1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800dd8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800ddf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800de4:	8d 47 01             	lea    0x1(%edi),%eax
+  800de7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800dea:	0f b6 17             	movzbl (%edi),%edx
+  800ded:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800df0:	3c 55                	cmp    $0x55,%al
+  800df2:	0f 87 cf 03 00 00    	ja     8011c7 <vprintfmt+0x437>
+  800df8:	0f b6 c0             	movzbl %al,%eax
+  800dfb:	ff 24 85 a0 1a 80 00 	jmp    *0x801aa0(,%eax,4)
+  800e02:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e05:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800e09:	eb d9                	jmp    800de4 <vprintfmt+0x54>
+  800e0b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e0e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800e12:	eb d0                	jmp    800de4 <vprintfmt+0x54>
+  800e14:	0f b6 d2             	movzbl %dl,%edx
+  800e17:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e22:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800e25:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800e29:	0f be 17             	movsbl (%edi),%edx
+  800e2c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800e2f:	83 f9 09             	cmp    $0x9,%ecx
+  800e32:	77 55                	ja     800e89 <vprintfmt+0xf9>
+  800e34:	83 c7 01             	add    $0x1,%edi
+  800e37:	eb e9                	jmp    800e22 <vprintfmt+0x92>
+  800e39:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e3c:	8b 00                	mov    (%eax),%eax
+  800e3e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e41:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e44:	8d 40 04             	lea    0x4(%eax),%eax
+  800e47:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e4a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e4d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800e51:	79 91                	jns    800de4 <vprintfmt+0x54>
+  800e53:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800e56:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e59:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800e60:	eb 82                	jmp    800de4 <vprintfmt+0x54>
+  800e62:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e65:	85 d2                	test   %edx,%edx
+  800e67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6c:	0f 49 c2             	cmovns %edx,%eax
+  800e6f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e72:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e75:	e9 6a ff ff ff       	jmp    800de4 <vprintfmt+0x54>
+  800e7a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e7d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800e84:	e9 5b ff ff ff       	jmp    800de4 <vprintfmt+0x54>
+  800e89:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e8c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e8f:	eb bc                	jmp    800e4d <vprintfmt+0xbd>
+  800e91:	83 c1 01             	add    $0x1,%ecx
+  800e94:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e97:	e9 48 ff ff ff       	jmp    800de4 <vprintfmt+0x54>
+  800e9c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e9f:	8d 78 04             	lea    0x4(%eax),%edi
+  800ea2:	83 ec 08             	sub    $0x8,%esp
+  800ea5:	53                   	push   %ebx
+  800ea6:	ff 30                	push   (%eax)
+  800ea8:	ff d6                	call   *%esi
+  800eaa:	83 c4 10             	add    $0x10,%esp
+  800ead:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800eb0:	e9 b1 02 00 00       	jmp    801166 <vprintfmt+0x3d6>
+  800eb5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800eb8:	8d 78 04             	lea    0x4(%eax),%edi
+  800ebb:	8b 10                	mov    (%eax),%edx
+  800ebd:	89 d0                	mov    %edx,%eax
+  800ebf:	f7 d8                	neg    %eax
+  800ec1:	0f 48 c2             	cmovs  %edx,%eax
+  800ec4:	83 f8 08             	cmp    $0x8,%eax
+  800ec7:	7f 23                	jg     800eec <vprintfmt+0x15c>
+  800ec9:	8b 14 85 00 1c 80 00 	mov    0x801c00(,%eax,4),%edx
+  800ed0:	85 d2                	test   %edx,%edx
+  800ed2:	74 18                	je     800eec <vprintfmt+0x15c>
+  800ed4:	52                   	push   %edx
+  800ed5:	68 08 1a 80 00       	push   $0x801a08
+  800eda:	53                   	push   %ebx
+  800edb:	56                   	push   %esi
+  800edc:	e8 92 fe ff ff       	call   800d73 <printfmt>
+  800ee1:	83 c4 10             	add    $0x10,%esp
+  800ee4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800ee7:	e9 7a 02 00 00       	jmp    801166 <vprintfmt+0x3d6>
+  800eec:	50                   	push   %eax
+  800eed:	68 ff 19 80 00       	push   $0x8019ff
+  800ef2:	53                   	push   %ebx
+  800ef3:	56                   	push   %esi
+  800ef4:	e8 7a fe ff ff       	call   800d73 <printfmt>
+  800ef9:	83 c4 10             	add    $0x10,%esp
+  800efc:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800eff:	e9 62 02 00 00       	jmp    801166 <vprintfmt+0x3d6>
+  800f04:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f07:	83 c0 04             	add    $0x4,%eax
+  800f0a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800f0d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f10:	8b 08                	mov    (%eax),%ecx
+  800f12:	85 c9                	test   %ecx,%ecx
+  800f14:	b8 f8 19 80 00       	mov    $0x8019f8,%eax
+  800f19:	0f 45 c1             	cmovne %ecx,%eax
+  800f1c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800f1f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800f23:	7e 06                	jle    800f2b <vprintfmt+0x19b>
+  800f25:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800f29:	75 0b                	jne    800f36 <vprintfmt+0x1a6>
+  800f2b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800f2e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800f31:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f34:	eb 5c                	jmp    800f92 <vprintfmt+0x202>
+  800f36:	83 ec 08             	sub    $0x8,%esp
+  800f39:	ff 75 d0             	push   -0x30(%ebp)
+  800f3c:	ff 75 cc             	push   -0x34(%ebp)
+  800f3f:	e8 87 03 00 00       	call   8012cb <strnlen>
+  800f44:	89 c2                	mov    %eax,%edx
+  800f46:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f49:	29 d0                	sub    %edx,%eax
+  800f4b:	83 c4 10             	add    $0x10,%esp
+  800f4e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800f52:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f55:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f58:	89 c6                	mov    %eax,%esi
+  800f5a:	eb 0e                	jmp    800f6a <vprintfmt+0x1da>
+  800f5c:	83 ec 08             	sub    $0x8,%esp
+  800f5f:	53                   	push   %ebx
+  800f60:	57                   	push   %edi
+  800f61:	ff 55 08             	call   *0x8(%ebp)
+  800f64:	83 ee 01             	sub    $0x1,%esi
+  800f67:	83 c4 10             	add    $0x10,%esp
+  800f6a:	85 f6                	test   %esi,%esi
+  800f6c:	7f ee                	jg     800f5c <vprintfmt+0x1cc>
+  800f6e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f71:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f74:	85 c0                	test   %eax,%eax
+  800f76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7b:	0f 49 d0             	cmovns %eax,%edx
+  800f7e:	29 d0                	sub    %edx,%eax
+  800f80:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f83:	eb a6                	jmp    800f2b <vprintfmt+0x19b>
+  800f85:	83 ec 08             	sub    $0x8,%esp
+  800f88:	53                   	push   %ebx
+  800f89:	52                   	push   %edx
+  800f8a:	ff 55 08             	call   *0x8(%ebp)
+  800f8d:	83 c4 10             	add    $0x10,%esp
+  800f90:	89 f1                	mov    %esi,%ecx
+  800f92:	8d 71 01             	lea    0x1(%ecx),%esi
+  800f95:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800f99:	0f be d0             	movsbl %al,%edx
+  800f9c:	85 d2                	test   %edx,%edx
+  800f9e:	74 28                	je     800fc8 <vprintfmt+0x238>
+  800fa0:	85 ff                	test   %edi,%edi
+  800fa2:	78 05                	js     800fa9 <vprintfmt+0x219>
+  800fa4:	83 ef 01             	sub    $0x1,%edi
+  800fa7:	78 30                	js     800fd9 <vprintfmt+0x249>
+  800fa9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800fad:	74 d6                	je     800f85 <vprintfmt+0x1f5>
+  800faf:	0f be c0             	movsbl %al,%eax
+  800fb2:	83 e8 20             	sub    $0x20,%eax
+  800fb5:	83 f8 5e             	cmp    $0x5e,%eax
+  800fb8:	76 cb                	jbe    800f85 <vprintfmt+0x1f5>
+  800fba:	83 ec 08             	sub    $0x8,%esp
+  800fbd:	53                   	push   %ebx
+  800fbe:	6a 3f                	push   $0x3f
+  800fc0:	ff 55 08             	call   *0x8(%ebp)
+  800fc3:	83 c4 10             	add    $0x10,%esp
+  800fc6:	eb c8                	jmp    800f90 <vprintfmt+0x200>
+  800fc8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fcb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800fce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800fd1:	01 d0                	add    %edx,%eax
+  800fd3:	29 c8                	sub    %ecx,%eax
+  800fd5:	89 c7                	mov    %eax,%edi
+  800fd7:	eb 13                	jmp    800fec <vprintfmt+0x25c>
+  800fd9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fdc:	eb ed                	jmp    800fcb <vprintfmt+0x23b>
+  800fde:	83 ec 08             	sub    $0x8,%esp
+  800fe1:	53                   	push   %ebx
+  800fe2:	6a 20                	push   $0x20
+  800fe4:	ff d6                	call   *%esi
+  800fe6:	83 ef 01             	sub    $0x1,%edi
+  800fe9:	83 c4 10             	add    $0x10,%esp
+  800fec:	85 ff                	test   %edi,%edi
+  800fee:	7f ee                	jg     800fde <vprintfmt+0x24e>
+  800ff0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800ff3:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ff6:	e9 6b 01 00 00       	jmp    801166 <vprintfmt+0x3d6>
+  800ffb:	83 f9 01             	cmp    $0x1,%ecx
+  800ffe:	7f 1f                	jg     80101f <vprintfmt+0x28f>
+  801000:	85 c9                	test   %ecx,%ecx
+  801002:	74 67                	je     80106b <vprintfmt+0x2db>
+  801004:	8b 45 14             	mov    0x14(%ebp),%eax
+  801007:	8b 00                	mov    (%eax),%eax
+  801009:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80100c:	89 c1                	mov    %eax,%ecx
+  80100e:	c1 f9 1f             	sar    $0x1f,%ecx
+  801011:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801014:	8b 45 14             	mov    0x14(%ebp),%eax
+  801017:	8d 40 04             	lea    0x4(%eax),%eax
+  80101a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80101d:	eb 17                	jmp    801036 <vprintfmt+0x2a6>
+  80101f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801022:	8b 50 04             	mov    0x4(%eax),%edx
+  801025:	8b 00                	mov    (%eax),%eax
+  801027:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80102a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80102d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801030:	8d 40 08             	lea    0x8(%eax),%eax
+  801033:	89 45 14             	mov    %eax,0x14(%ebp)
+  801036:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801039:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80103c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801041:	85 c9                	test   %ecx,%ecx
+  801043:	0f 89 03 01 00 00    	jns    80114c <vprintfmt+0x3bc>
+  801049:	83 ec 08             	sub    $0x8,%esp
+  80104c:	53                   	push   %ebx
+  80104d:	6a 2d                	push   $0x2d
+  80104f:	ff d6                	call   *%esi
+  801051:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801054:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801057:	f7 da                	neg    %edx
+  801059:	83 d1 00             	adc    $0x0,%ecx
+  80105c:	f7 d9                	neg    %ecx
+  80105e:	83 c4 10             	add    $0x10,%esp
+  801061:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801066:	e9 e1 00 00 00       	jmp    80114c <vprintfmt+0x3bc>
+  80106b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80106e:	8b 00                	mov    (%eax),%eax
+  801070:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801073:	89 c1                	mov    %eax,%ecx
+  801075:	c1 f9 1f             	sar    $0x1f,%ecx
+  801078:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80107b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80107e:	8d 40 04             	lea    0x4(%eax),%eax
+  801081:	89 45 14             	mov    %eax,0x14(%ebp)
+  801084:	eb b0                	jmp    801036 <vprintfmt+0x2a6>
+  801086:	83 f9 01             	cmp    $0x1,%ecx
+  801089:	7f 1e                	jg     8010a9 <vprintfmt+0x319>
+  80108b:	85 c9                	test   %ecx,%ecx
+  80108d:	74 32                	je     8010c1 <vprintfmt+0x331>
+  80108f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801092:	8b 10                	mov    (%eax),%edx
+  801094:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801099:	8d 40 04             	lea    0x4(%eax),%eax
+  80109c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80109f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010a4:	e9 a3 00 00 00       	jmp    80114c <vprintfmt+0x3bc>
+  8010a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010ac:	8b 10                	mov    (%eax),%edx
+  8010ae:	8b 48 04             	mov    0x4(%eax),%ecx
+  8010b1:	8d 40 08             	lea    0x8(%eax),%eax
+  8010b4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010b7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010bc:	e9 8b 00 00 00       	jmp    80114c <vprintfmt+0x3bc>
+  8010c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010c4:	8b 10                	mov    (%eax),%edx
+  8010c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8010ce:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010d6:	eb 74                	jmp    80114c <vprintfmt+0x3bc>
+  8010d8:	83 f9 01             	cmp    $0x1,%ecx
+  8010db:	7f 1b                	jg     8010f8 <vprintfmt+0x368>
+  8010dd:	85 c9                	test   %ecx,%ecx
+  8010df:	74 2c                	je     80110d <vprintfmt+0x37d>
+  8010e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010e4:	8b 10                	mov    (%eax),%edx
+  8010e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8010ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010f1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8010f6:	eb 54                	jmp    80114c <vprintfmt+0x3bc>
+  8010f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010fb:	8b 10                	mov    (%eax),%edx
+  8010fd:	8b 48 04             	mov    0x4(%eax),%ecx
+  801100:	8d 40 08             	lea    0x8(%eax),%eax
+  801103:	89 45 14             	mov    %eax,0x14(%ebp)
+  801106:	bf 08 00 00 00       	mov    $0x8,%edi
+  80110b:	eb 3f                	jmp    80114c <vprintfmt+0x3bc>
+  80110d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801110:	8b 10                	mov    (%eax),%edx
+  801112:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801117:	8d 40 04             	lea    0x4(%eax),%eax
+  80111a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80111d:	bf 08 00 00 00       	mov    $0x8,%edi
+  801122:	eb 28                	jmp    80114c <vprintfmt+0x3bc>
+  801124:	83 ec 08             	sub    $0x8,%esp
+  801127:	53                   	push   %ebx
+  801128:	6a 30                	push   $0x30
+  80112a:	ff d6                	call   *%esi
+  80112c:	83 c4 08             	add    $0x8,%esp
+  80112f:	53                   	push   %ebx
+  801130:	6a 78                	push   $0x78
+  801132:	ff d6                	call   *%esi
+  801134:	8b 45 14             	mov    0x14(%ebp),%eax
+  801137:	8b 10                	mov    (%eax),%edx
+  801139:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80113e:	83 c4 10             	add    $0x10,%esp
+  801141:	8d 40 04             	lea    0x4(%eax),%eax
+  801144:	89 45 14             	mov    %eax,0x14(%ebp)
+  801147:	bf 10 00 00 00       	mov    $0x10,%edi
+  80114c:	83 ec 0c             	sub    $0xc,%esp
+  80114f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801153:	50                   	push   %eax
+  801154:	ff 75 e0             	push   -0x20(%ebp)
+  801157:	57                   	push   %edi
+  801158:	51                   	push   %ecx
+  801159:	52                   	push   %edx
+  80115a:	89 da                	mov    %ebx,%edx
+  80115c:	89 f0                	mov    %esi,%eax
+  80115e:	e8 4a fb ff ff       	call   800cad <printnum>
+  801163:	83 c4 20             	add    $0x20,%esp
+  801166:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801169:	e9 40 fc ff ff       	jmp    800dae <vprintfmt+0x1e>
+  80116e:	83 f9 01             	cmp    $0x1,%ecx
+  801171:	7f 1b                	jg     80118e <vprintfmt+0x3fe>
+  801173:	85 c9                	test   %ecx,%ecx
+  801175:	74 2c                	je     8011a3 <vprintfmt+0x413>
+  801177:	8b 45 14             	mov    0x14(%ebp),%eax
+  80117a:	8b 10                	mov    (%eax),%edx
+  80117c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801181:	8d 40 04             	lea    0x4(%eax),%eax
+  801184:	89 45 14             	mov    %eax,0x14(%ebp)
+  801187:	bf 10 00 00 00       	mov    $0x10,%edi
+  80118c:	eb be                	jmp    80114c <vprintfmt+0x3bc>
+  80118e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801191:	8b 10                	mov    (%eax),%edx
+  801193:	8b 48 04             	mov    0x4(%eax),%ecx
+  801196:	8d 40 08             	lea    0x8(%eax),%eax
+  801199:	89 45 14             	mov    %eax,0x14(%ebp)
+  80119c:	bf 10 00 00 00       	mov    $0x10,%edi
+  8011a1:	eb a9                	jmp    80114c <vprintfmt+0x3bc>
+  8011a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011a6:	8b 10                	mov    (%eax),%edx
+  8011a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8011b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8011b3:	bf 10 00 00 00       	mov    $0x10,%edi
+  8011b8:	eb 92                	jmp    80114c <vprintfmt+0x3bc>
+  8011ba:	83 ec 08             	sub    $0x8,%esp
+  8011bd:	53                   	push   %ebx
+  8011be:	6a 25                	push   $0x25
+  8011c0:	ff d6                	call   *%esi
+  8011c2:	83 c4 10             	add    $0x10,%esp
+  8011c5:	eb 9f                	jmp    801166 <vprintfmt+0x3d6>
+  8011c7:	83 ec 08             	sub    $0x8,%esp
+  8011ca:	53                   	push   %ebx
+  8011cb:	6a 25                	push   $0x25
+  8011cd:	ff d6                	call   *%esi
+  8011cf:	83 c4 10             	add    $0x10,%esp
+  8011d2:	89 f8                	mov    %edi,%eax
+  8011d4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8011d8:	74 05                	je     8011df <vprintfmt+0x44f>
+  8011da:	83 e8 01             	sub    $0x1,%eax
+  8011dd:	eb f5                	jmp    8011d4 <vprintfmt+0x444>
+  8011df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8011e2:	eb 82                	jmp    801166 <vprintfmt+0x3d6>
+
+008011e4 <vsnprintf>:
+  8011e4:	55                   	push   %ebp
+  8011e5:	89 e5                	mov    %esp,%ebp
+  8011e7:	83 ec 18             	sub    $0x18,%esp
+  8011ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011f0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8011f3:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8011f7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8011fa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801201:	85 c0                	test   %eax,%eax
+  801203:	74 26                	je     80122b <vsnprintf+0x47>
+  801205:	85 d2                	test   %edx,%edx
+  801207:	7e 22                	jle    80122b <vsnprintf+0x47>
+  801209:	ff 75 14             	push   0x14(%ebp)
+  80120c:	ff 75 10             	push   0x10(%ebp)
+  80120f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801212:	50                   	push   %eax
+  801213:	68 56 0d 80 00       	push   $0x800d56
+  801218:	e8 73 fb ff ff       	call   800d90 <vprintfmt>
+  80121d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801220:	c6 00 00             	movb   $0x0,(%eax)
+  801223:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801226:	83 c4 10             	add    $0x10,%esp
+  801229:	c9                   	leave
+  80122a:	c3                   	ret
+  80122b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801230:	eb f7                	jmp    801229 <vsnprintf+0x45>
+
+00801232 <snprintf>:
+  801232:	55                   	push   %ebp
+  801233:	89 e5                	mov    %esp,%ebp
+  801235:	83 ec 08             	sub    $0x8,%esp
+  801238:	8d 45 14             	lea    0x14(%ebp),%eax
+  80123b:	50                   	push   %eax
+  80123c:	ff 75 10             	push   0x10(%ebp)
+  80123f:	ff 75 0c             	push   0xc(%ebp)
+  801242:	ff 75 08             	push   0x8(%ebp)
+  801245:	e8 9a ff ff ff       	call   8011e4 <vsnprintf>
+  80124a:	c9                   	leave
+  80124b:	c3                   	ret
+
+0080124c <copy_fwd>:
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	57                   	push   %edi
+  801250:	56                   	push   %esi
+  801251:	53                   	push   %ebx
+  801252:	89 c7                	mov    %eax,%edi
+  801254:	89 d6                	mov    %edx,%esi
+  801256:	89 c8                	mov    %ecx,%eax
+  801258:	83 f9 0f             	cmp    $0xf,%ecx
+  80125b:	76 1c                	jbe    801279 <copy_fwd+0x2d>
+  80125d:	89 f9                	mov    %edi,%ecx
+  80125f:	f7 d9                	neg    %ecx
+  801261:	89 cb                	mov    %ecx,%ebx
+  801263:	83 e3 03             	and    $0x3,%ebx
+  801266:	29 d8                	sub    %ebx,%eax
+  801268:	89 c2                	mov    %eax,%edx
+  80126a:	c1 ea 02             	shr    $0x2,%edx
+  80126d:	83 e0 03             	and    $0x3,%eax
+  801270:	89 d9                	mov    %ebx,%ecx
+  801272:	fc                   	cld
+  801273:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  801275:	89 d1                	mov    %edx,%ecx
+  801277:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801279:	89 c1                	mov    %eax,%ecx
+  80127b:	fc                   	cld
+  80127c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80127e:	5b                   	pop    %ebx
+  80127f:	5e                   	pop    %esi
+  801280:	5f                   	pop    %edi
+  801281:	5d                   	pop    %ebp
+  801282:	c3                   	ret
+
+00801283 <have_sse2>:
+  801283:	83 3d 0c 20 80 00 00 	cmpl   $0x0,0x80200c
+  80128a:	78 06                	js     801292 <have_sse2+0xf>
+  80128c:	a1 0c 20 80 00       	mov    0x80200c,%eax
+  801291:	c3                   	ret
+  801292:	55                   	push   %ebp
+  801293:	89 e5                	mov    %esp,%ebp
+  801295:	53                   	push   %ebx
+  801296:	b8 01 00 00 00       	mov    $0x1,%eax
+  80129b:	0f a2                	cpuid
+  80129d:	c1 ea 1a             	shr    $0x1a,%edx
+  8012a0:	83 e2 01             	and    $0x1,%edx
+  8012a3:	89 15 0c 20 80 00    	mov    %edx,0x80200c
+  8012a9:	a1 0c 20 80 00       	mov    0x80200c,%eax
+  8012ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012b1:	c9                   	leave
+  8012b2:	c3                   	ret
+
+008012b3 <strlen>:
+  8012b3:	55                   	push   %ebp
+  8012b4:	89 e5                	mov    %esp,%ebp
+  8012b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012be:	eb 03                	jmp    8012c3 <strlen+0x10>
+  8012c0:	83 c0 01             	add    $0x1,%eax
+  8012c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8012c7:	75 f7                	jne    8012c0 <strlen+0xd>
+  8012c9:	5d                   	pop    %ebp
+  8012ca:	c3                   	ret
+
+008012cb <strnlen>:
+  8012cb:	55                   	push   %ebp
+  8012cc:	89 e5                	mov    %esp,%ebp
+  8012ce:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d9:	eb 03                	jmp    8012de <strnlen+0x13>
+  8012db:	83 c0 01             	add    $0x1,%eax
+  8012de:	39 d0                	cmp    %edx,%eax
+  8012e0:	74 08                	je     8012ea <strnlen+0x1f>
+  8012e2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8012e6:	75 f3                	jne    8012db <strnlen+0x10>
+  8012e8:	89 c2                	mov    %eax,%edx
+  8012ea:	89 d0                	mov    %edx,%eax
+  8012ec:	5d                   	pop    %ebp
+  8012ed:	c3                   	ret
+
+008012ee <strcpy>:
+  8012ee:	55                   	push   %ebp
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	53                   	push   %ebx
+  8012f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012f5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8012f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fd:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801301:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801304:	83 c0 01             	add    $0x1,%eax
+  801307:	84 d2                	test   %dl,%dl
+  801309:	75 f2                	jne    8012fd <strcpy+0xf>
+  80130b:	89 c8                	mov    %ecx,%eax
+  80130d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801310:	c9                   	leave
+  801311:	c3                   	ret
+
+00801312 <strcat>:
+  801312:	55                   	push   %ebp
+  801313:	89 e5                	mov    %esp,%ebp
+  801315:	53                   	push   %ebx
+  801316:	83 ec 10             	sub    $0x10,%esp
+  801319:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80131c:	53                   	push   %ebx
+  80131d:	e8 91 ff ff ff       	call   8012b3 <strlen>
+  801322:	83 c4 08             	add    $0x8,%esp
+  801325:	ff 75 0c             	push   0xc(%ebp)
+  801328:	01 d8                	add    %ebx,%eax
+  80132a:	50                   	push   %eax
+  80132b:	e8 be ff ff ff       	call   8012ee <strcpy>
+  801330:	89 d8                	mov    %ebx,%eax
+  801332:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801335:	c9                   	leave
+  801336:	c3                   	ret
+
+00801337 <strncpy>:
+  801337:	55                   	push   %ebp
+  801338:	89 e5                	mov    %esp,%ebp
+  80133a:	56                   	push   %esi
+  80133b:	53                   	push   %ebx
+  80133c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80133f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801342:	89 f3                	mov    %esi,%ebx
+  801344:	03 5d 10             	add    0x10(%ebp),%ebx
+  801347:	89 f0                	mov    %esi,%eax
+  801349:	eb 0f                	jmp    80135a <strncpy+0x23>
+  80134b:	83 c0 01             	add    $0x1,%eax
+  80134e:	0f b6 0a             	movzbl (%edx),%ecx
+  801351:	88 48 ff             	mov    %cl,-0x1(%eax)
+  801354:	80 f9 01             	cmp    $0x1,%cl
+  801357:	83 da ff             	sbb    $0xffffffff,%edx
+  80135a:	39 d8                	cmp    %ebx,%eax
+  80135c:	75 ed                	jne    80134b <strncpy+0x14>
+  80135e:	89 f0                	mov    %esi,%eax
+  801360:	5b                   	pop    %ebx
+  801361:	5e                   	pop    %esi
+  801362:	5d                   	pop    %ebp
+  801363:	c3                   	ret
+
+00801364 <strlcpy>:
+  801364:	55                   	push   %ebp
+  801365:	89 e5                	mov    %esp,%ebp
+  801367:	56                   	push   %esi
+  801368:	53                   	push   %ebx
+  801369:	8b 75 08             	mov    0x8(%ebp),%esi
+  80136c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136f:	8b 55 10             	mov    0x10(%ebp),%edx
+  801372:	89 f0                	mov    %esi,%eax
+  801374:	85 d2                	test   %edx,%edx
+  801376:	74 21                	je     801399 <strlcpy+0x35>
+  801378:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80137c:	89 f2                	mov    %esi,%edx
+  80137e:	eb 09                	jmp    801389 <strlcpy+0x25>
+  801380:	83 c1 01             	add    $0x1,%ecx
+  801383:	83 c2 01             	add    $0x1,%edx
+  801386:	88 5a ff             	mov    %bl,-0x1(%edx)
+  801389:	39 c2                	cmp    %eax,%edx
+  80138b:	74 09                	je     801396 <strlcpy+0x32>
+  80138d:	0f b6 19             	movzbl (%ecx),%ebx
+  801390:	84 db                	test   %bl,%bl
+  801392:	75 ec                	jne    801380 <strlcpy+0x1c>
+  801394:	89 d0                	mov    %edx,%eax
+  801396:	c6 00 00             	movb   $0x0,(%eax)
+  801399:	29 f0                	sub    %esi,%eax
+  80139b:	5b                   	pop    %ebx
+  80139c:	5e                   	pop    %esi
+  80139d:	5d                   	pop    %ebp
+  80139e:	c3                   	ret
+
+0080139f <strcmp>:
+  80139f:	55                   	push   %ebp
+  8013a0:	89 e5                	mov    %esp,%ebp
+  8013a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8013a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013a8:	eb 06                	jmp    8013b0 <strcmp+0x11>
+  8013aa:	83 c1 01             	add    $0x1,%ecx
+  8013ad:	83 c2 01             	add    $0x1,%edx
+  8013b0:	0f b6 01             	movzbl (%ecx),%eax
+  8013b3:	84 c0                	test   %al,%al
+  8013b5:	74 04                	je     8013bb <strcmp+0x1c>
+  8013b7:	3a 02                	cmp    (%edx),%al
+  8013b9:	74 ef                	je     8013aa <strcmp+0xb>
+  8013bb:	0f b6 c0             	movzbl %al,%eax
+  8013be:	0f b6 12             	movzbl (%edx),%edx
+  8013c1:	29 d0                	sub    %edx,%eax
+  8013c3:	5d                   	pop    %ebp
+  8013c4:	c3                   	ret
+
+008013c5 <strncmp>:
+  8013c5:	55                   	push   %ebp
+  8013c6:	89 e5                	mov    %esp,%ebp
+  8013c8:	53                   	push   %ebx
+  8013c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cf:	8b 55 10             	mov    0x10(%ebp),%edx
+  8013d2:	eb 09                	jmp    8013dd <strncmp+0x18>
+  8013d4:	83 ea 01             	sub    $0x1,%edx
+  8013d7:	83 c0 01             	add    $0x1,%eax
+  8013da:	83 c1 01             	add    $0x1,%ecx
+  8013dd:	85 d2                	test   %edx,%edx
+  8013df:	74 18                	je     8013f9 <strncmp+0x34>
+  8013e1:	0f b6 18             	movzbl (%eax),%ebx
+  8013e4:	84 db                	test   %bl,%bl
+  8013e6:	74 04                	je     8013ec <strncmp+0x27>
+  8013e8:	3a 19                	cmp    (%ecx),%bl
+  8013ea:	74 e8                	je     8013d4 <strncmp+0xf>
+  8013ec:	0f b6 00             	movzbl (%eax),%eax
+  8013ef:	0f b6 11             	movzbl (%ecx),%edx
+  8013f2:	29 d0                	sub    %edx,%eax
+  8013f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013f7:	c9                   	leave
+  8013f8:	c3                   	ret
+  8013f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fe:	eb f4                	jmp    8013f4 <strncmp+0x2f>
+
+00801400 <strchr>:
+  801400:	55                   	push   %ebp
+  801401:	89 e5                	mov    %esp,%ebp
+  801403:	8b 45 08             	mov    0x8(%ebp),%eax
+  801406:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80140a:	eb 03                	jmp    80140f <strchr+0xf>
+  80140c:	83 c0 01             	add    $0x1,%eax
+  80140f:	0f b6 10             	movzbl (%eax),%edx
+  801412:	84 d2                	test   %dl,%dl
+  801414:	74 06                	je     80141c <strchr+0x1c>
+  801416:	38 ca                	cmp    %cl,%dl
+  801418:	75 f2                	jne    80140c <strchr+0xc>
+  80141a:	eb 05                	jmp    801421 <strchr+0x21>
+  80141c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801421:	5d                   	pop    %ebp
+  801422:	c3                   	ret
+
+00801423 <strfind>:
+  801423:	55                   	push   %ebp
+  801424:	89 e5                	mov    %esp,%ebp
+  801426:	8b 45 08             	mov    0x8(%ebp),%eax
+  801429:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80142d:	0f b6 10             	movzbl (%eax),%edx
+  801430:	38 ca                	cmp    %cl,%dl
+  801432:	74 09                	je     80143d <strfind+0x1a>
+  801434:	84 d2                	test   %dl,%dl
+  801436:	74 05                	je     80143d <strfind+0x1a>
+  801438:	83 c0 01             	add    $0x1,%eax
+  80143b:	eb f0                	jmp    80142d <strfind+0xa>
+  80143d:	5d                   	pop    %ebp
+  80143e:	c3                   	ret
+
+0080143f <memset>:
+  80143f:	55                   	push   %ebp
+  801440:	89 e5                	mov    %esp,%ebp
+  801442:	57                   	push   %edi
+  801443:	56                   	push   %esi
+  801444:	53                   	push   %ebx
+  801445:	83 ec 04             	sub    $0x4,%esp
+  801448:	8b 75 08             	mov    0x8(%ebp),%esi
+  80144b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80144e:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  801452:	89 f7                	mov    %esi,%edi
+  801454:	83 fa 0f             	cmp    $0xf,%edx
+  801457:	76 24                	jbe    80147d <memset+0x3e>
+  801459:	89 f1                	mov    %esi,%ecx
+  80145b:	f7 d9                	neg    %ecx
+  80145d:	83 e1 03             	and    $0x3,%ecx
+  801460:	29 ca                	sub    %ecx,%edx
+  801462:	89 d0                	mov    %edx,%eax
+  801464:	c1 e8 02             	shr    $0x2,%eax
+  801467:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  80146a:	83 e2 03             	and    $0x3,%edx
+  80146d:	89 d8                	mov    %ebx,%eax
+  80146f:	fc                   	cld
+  801470:	f3 aa                	rep stos %al,%es:(%edi)
+  801472:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  801478:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  80147b:	f3 ab                	rep stos %eax,%es:(%edi)
+  80147d:	89 d1                	mov    %edx,%ecx
+  80147f:	89 d8                	mov    %ebx,%eax
+  801481:	fc                   	cld
+  801482:	f3 aa                	rep stos %al,%es:(%edi)
+  801484:	89 f0                	mov    %esi,%eax
+  801486:	83 c4 04             	add    $0x4,%esp
+  801489:	5b                   	pop    %ebx
+  80148a:	5e                   	pop    %esi
+  80148b:	5f                   	pop    %edi
+  80148c:	5d                   	pop    %ebp
+  80148d:	c3                   	ret
+
+0080148e <memmove>:
+  80148e:	55                   	push   %ebp
+  80148f:	89 e5                	mov    %esp,%ebp
+  801491:	57                   	push   %edi
+  801492:	56                   	push   %esi
+  801493:	53                   	push   %ebx
+  801494:	83 ec 0c             	sub    $0xc,%esp
+  801497:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80149a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80149d:	8b 45 10             	mov    0x10(%ebp),%eax
+  8014a0:	85 c0                	test   %eax,%eax
+  8014a2:	74 14                	je     8014b8 <memmove+0x2a>
+  8014a4:	39 da                	cmp    %ebx,%edx
+  8014a6:	73 07                	jae    8014af <memmove+0x21>
+  8014a8:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8014ab:	39 cb                	cmp    %ecx,%ebx
+  8014ad:	72 13                	jb     8014c2 <memmove+0x34>
+  8014af:	89 c1                	mov    %eax,%ecx
+  8014b1:	89 d8                	mov    %ebx,%eax
+  8014b3:	e8 94 fd ff ff       	call   80124c <copy_fwd>
+  8014b8:	89 d8                	mov    %ebx,%eax
+  8014ba:	83 c4 0c             	add    $0xc,%esp
+  8014bd:	5b                   	pop    %ebx
+  8014be:	5e                   	pop    %esi
+  8014bf:	5f                   	pop    %edi
+  8014c0:	5d                   	pop    %ebp
+  8014c1:	c3                   	ret
+  8014c2:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  8014c5:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  8014c8:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  8014cb:	83 f8 0f             	cmp    $0xf,%eax
+  8014ce:	76 23                	jbe    8014f3 <memmove+0x65>
+  8014d0:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  8014d3:	83 e1 03             	and    $0x3,%ecx
+  8014d6:	29 c8                	sub    %ecx,%eax
+  8014d8:	89 c2                	mov    %eax,%edx
+  8014da:	c1 ea 02             	shr    $0x2,%edx
+  8014dd:	83 e0 03             	and    $0x3,%eax
+  8014e0:	fd                   	std
+  8014e1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014e3:	83 ef 03             	sub    $0x3,%edi
+  8014e6:	83 ee 03             	sub    $0x3,%esi
+  8014e9:	89 d1                	mov    %edx,%ecx
+  8014eb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8014ed:	83 c7 03             	add    $0x3,%edi
+  8014f0:	83 c6 03             	add    $0x3,%esi
+  8014f3:	89 c1                	mov    %eax,%ecx
+  8014f5:	fd                   	std
+  8014f6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014f8:	fc                   	cld
+  8014f9:	eb bd                	jmp    8014b8 <memmove+0x2a>
+
+008014fb <memcpy>:
+  8014fb:	55                   	push   %ebp
+  8014fc:	89 e5                	mov    %esp,%ebp
+  8014fe:	53                   	push   %ebx
+  8014ff:	83 ec 04             	sub    $0x4,%esp
+  801502:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801505:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801508:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80150b:	89 d8                	mov    %ebx,%eax
+  80150d:	e8 3a fd ff ff       	call   80124c <copy_fwd>
+  801512:	89 d8                	mov    %ebx,%eax
+  801514:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801517:	c9                   	leave
+  801518:	c3                   	ret
+
+00801519 <page_copy>:
+  801519:	55                   	push   %ebp
+  80151a:	89 e5                	mov    %esp,%ebp
+  80151c:	57                   	push   %edi
+  80151d:	56                   	push   %esi
+  80151e:	53                   	push   %ebx
+  80151f:	83 ec 0c             	sub    $0xc,%esp
+  801522:	e8 5c fd ff ff       	call   801283 <have_sse2>
+  801527:	85 c0                	test   %eax,%eax
+  801529:	74 39                	je     801564 <page_copy+0x4b>
+  80152b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80152e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801531:	be 00 01 00 00       	mov    $0x100,%esi
+  801536:	8b 03                	mov    (%ebx),%eax
+  801538:	8b 53 04             	mov    0x4(%ebx),%edx
+  80153b:	0f c3 01             	movnti %eax,(%ecx)
+  80153e:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  801542:	8b 43 08             	mov    0x8(%ebx),%eax
+  801545:	8b 53 0c             	mov    0xc(%ebx),%edx
+  801548:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  80154c:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  801550:	83 c3 10             	add    $0x10,%ebx
+  801553:	83 c1 10             	add    $0x10,%ecx
+  801556:	4e                   	dec    %esi
+  801557:	75 dd                	jne    801536 <page_copy+0x1d>
+  801559:	0f ae f8             	sfence
+  80155c:	83 c4 0c             	add    $0xc,%esp
+  80155f:	5b                   	pop    %ebx
+  801560:	5e                   	pop    %esi
+  801561:	5f                   	pop    %edi
+  801562:	5d                   	pop    %ebp
+  801563:	c3                   	ret
+  801564:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801567:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80156a:	b9 00 04 00 00       	mov    $0x400,%ecx
+  80156f:	fc                   	cld
+  801570:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801572:	eb e8                	jmp    80155c <page_copy+0x43>
+
+00801574 <page_zero>:
+  801574:	55                   	push   %ebp
+  801575:	89 e5                	mov    %esp,%ebp
+  801577:	57                   	push   %edi
+  801578:	83 ec 04             	sub    $0x4,%esp
+  80157b:	e8 03 fd ff ff       	call   801283 <have_sse2>
+  801580:	85 c0                	test   %eax,%eax
+  801582:	74 3a                	je     8015be <page_zero+0x4a>
+  801584:	8b 45 08             	mov    0x8(%ebp),%eax
+  801587:	ba 80 00 00 00       	mov    $0x80,%edx
+  80158c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801591:	0f c3 08             	movnti %ecx,(%eax)
+  801594:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  801598:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  80159c:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  8015a0:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  8015a4:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  8015a8:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  8015ac:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  8015b0:	83 c0 20             	add    $0x20,%eax
+  8015b3:	4a                   	dec    %edx
+  8015b4:	75 db                	jne    801591 <page_zero+0x1d>
+  8015b6:	0f ae f8             	sfence
+  8015b9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8015bc:	c9                   	leave
+  8015bd:	c3                   	ret
+  8015be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015c1:	b9 00 04 00 00       	mov    $0x400,%ecx
+  8015c6:	fc                   	cld
+  8015c7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8015c9:	eb ee                	jmp    8015b9 <page_zero+0x45>
+
+008015cb <memcmp>:
+  8015cb:	55                   	push   %ebp
+  8015cc:	89 e5                	mov    %esp,%ebp
+  8015ce:	56                   	push   %esi
+  8015cf:	53                   	push   %ebx
+  8015d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015d6:	89 c6                	mov    %eax,%esi
+  8015d8:	03 75 10             	add    0x10(%ebp),%esi
+  8015db:	eb 06                	jmp    8015e3 <memcmp+0x18>
+  8015dd:	83 c0 01             	add    $0x1,%eax
+  8015e0:	83 c2 01             	add    $0x1,%edx
+  8015e3:	39 f0                	cmp    %esi,%eax
+  8015e5:	74 14                	je     8015fb <memcmp+0x30>
+  8015e7:	0f b6 08             	movzbl (%eax),%ecx
+  8015ea:	0f b6 1a             	movzbl (%edx),%ebx
+  8015ed:	38 d9                	cmp    %bl,%cl
+  8015ef:	74 ec                	je     8015dd <memcmp+0x12>
+  8015f1:	0f b6 c1             	movzbl %cl,%eax
+  8015f4:	0f b6 db             	movzbl %bl,%ebx
+  8015f7:	29 d8                	sub    %ebx,%eax
+  8015f9:	eb 05                	jmp    801600 <memcmp+0x35>
+  8015fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801600:	5b                   	pop    %ebx
+  801601:	5e                   	pop    %esi
+  801602:	5d                   	pop    %ebp
+  801603:	c3                   	ret
+
+00801604 <memfind>:
+  801604:	55                   	push   %ebp
+  801605:	89 e5                	mov    %esp,%ebp
+  801607:	8b 45 08             	mov    0x8(%ebp),%eax
+  80160a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80160d:	89 c2                	mov    %eax,%edx
+  80160f:	03 55 10             	add    0x10(%ebp),%edx
+  801612:	eb 03                	jmp    801617 <memfind+0x13>
+  801614:	83 c0 01             	add    $0x1,%eax
+  801617:	39 d0                	cmp    %edx,%eax
+  801619:	73 04                	jae    80161f <memfind+0x1b>
+  80161b:	38 08                	cmp    %cl,(%eax)
+  80161d:	75 f5                	jne    801614 <memfind+0x10>
+  80161f:	5d                   	pop    %ebp
+  801620:	c3                   	ret
+
+00801621 <strtol>:
+  801621:	55                   	push   %ebp
+  801622:	89 e5                	mov    %esp,%ebp
+  801624:	57                   	push   %edi
+  801625:	56                   	push   %esi
+  801626:	53                   	push   %ebx
+  801627:	8b 55 08             	mov    0x8(%ebp),%edx
+  80162a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80162d:	eb 03                	jmp    801632 <strtol+0x11>
+  80162f:	83 c2 01             	add    $0x1,%edx
+  801632:	0f b6 02             	movzbl (%edx),%eax
+  801635:	3c 20                	cmp    $0x20,%al
+  801637:	74 f6                	je     80162f <strtol+0xe>
+  801639:	3c 09                	cmp    $0x9,%al
+  80163b:	74 f2                	je     80162f <strtol+0xe>
+  80163d:	3c 2b                	cmp    $0x2b,%al
+  80163f:	74 2a                	je     80166b <strtol+0x4a>
+  801641:	bf 00 00 00 00       	mov    $0x0,%edi
+  801646:	3c 2d                	cmp    $0x2d,%al
+  801648:	74 2b                	je     801675 <strtol+0x54>
+  80164a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801650:	75 0f                	jne    801661 <strtol+0x40>
+  801652:	80 3a 30             	cmpb   $0x30,(%edx)
+  801655:	74 28                	je     80167f <strtol+0x5e>
+  801657:	85 db                	test   %ebx,%ebx
+  801659:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80165e:	0f 44 d8             	cmove  %eax,%ebx
+  801661:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801666:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801669:	eb 46                	jmp    8016b1 <strtol+0x90>
+  80166b:	83 c2 01             	add    $0x1,%edx
+  80166e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801673:	eb d5                	jmp    80164a <strtol+0x29>
+  801675:	83 c2 01             	add    $0x1,%edx
+  801678:	bf 01 00 00 00       	mov    $0x1,%edi
+  80167d:	eb cb                	jmp    80164a <strtol+0x29>
+  80167f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801683:	74 0e                	je     801693 <strtol+0x72>
+  801685:	85 db                	test   %ebx,%ebx
+  801687:	75 d8                	jne    801661 <strtol+0x40>
+  801689:	83 c2 01             	add    $0x1,%edx
+  80168c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801691:	eb ce                	jmp    801661 <strtol+0x40>
+  801693:	83 c2 02             	add    $0x2,%edx
+  801696:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80169b:	eb c4                	jmp    801661 <strtol+0x40>
+  80169d:	0f be c0             	movsbl %al,%eax
+  8016a0:	83 e8 30             	sub    $0x30,%eax
+  8016a3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8016a6:	7d 3a                	jge    8016e2 <strtol+0xc1>
+  8016a8:	83 c2 01             	add    $0x1,%edx
+  8016ab:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8016af:	01 c1                	add    %eax,%ecx
+  8016b1:	0f b6 02             	movzbl (%edx),%eax
+  8016b4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8016b7:	89 f3                	mov    %esi,%ebx
+  8016b9:	80 fb 09             	cmp    $0x9,%bl
+  8016bc:	76 df                	jbe    80169d <strtol+0x7c>
+  8016be:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8016c1:	89 f3                	mov    %esi,%ebx
+  8016c3:	80 fb 19             	cmp    $0x19,%bl
+  8016c6:	77 08                	ja     8016d0 <strtol+0xaf>
+  8016c8:	0f be c0             	movsbl %al,%eax
+  8016cb:	83 e8 57             	sub    $0x57,%eax
+  8016ce:	eb d3                	jmp    8016a3 <strtol+0x82>
+  8016d0:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8016d3:	89 f3                	mov    %esi,%ebx
+  8016d5:	80 fb 19             	cmp    $0x19,%bl
+  8016d8:	77 08                	ja     8016e2 <strtol+0xc1>
+  8016da:	0f be c0             	movsbl %al,%eax
+  8016dd:	83 e8 37             	sub    $0x37,%eax
+  8016e0:	eb c1                	jmp    8016a3 <strtol+0x82>
+  8016e2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8016e6:	74 05                	je     8016ed <strtol+0xcc>
+  8016e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016eb:	89 10                	mov    %edx,(%eax)
+  8016ed:	89 c8                	mov    %ecx,%eax
+  8016ef:	f7 d8                	neg    %eax
+  8016f1:	85 ff                	test   %edi,%edi
+  8016f3:	0f 45 c8             	cmovne %eax,%ecx
+  8016f6:	89 c8                	mov    %ecx,%eax
+  8016f8:	5b                   	pop    %ebx
+  8016f9:	5e                   	pop    %esi
+  8016fa:	5f                   	pop    %edi
+  8016fb:	5d                   	pop    %ebp
+  8016fc:	c3                   	ret
+
+008016fd <__udivdi3>:
+  8016fd:	57                   	push   %edi
+  8016fe:	56                   	push   %esi
+  8016ff:	53                   	push   %ebx
+  801700:	83 ec 20             	sub    $0x20,%esp
+  801703:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801707:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80170b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80170f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801713:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801717:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80171b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80171f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801723:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801727:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  80172b:	89 d1                	mov    %edx,%ecx
+  80172d:	09 c1                	or     %eax,%ecx
+  80172f:	0f 84 91 00 00 00    	je     8017c6 <__udivdi3+0xc9>
+  801735:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80173c:	00 
+  80173d:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801744:	00 
+  801745:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80174a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801754:	eb 08                	jmp    80175e <__udivdi3+0x61>
+  801756:	83 e9 01             	sub    $0x1,%ecx
+  801759:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80175c:	74 68                	je     8017c6 <__udivdi3+0xc9>
+  80175e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801762:	01 c0                	add    %eax,%eax
+  801764:	89 c6                	mov    %eax,%esi
+  801766:	89 d7                	mov    %edx,%edi
+  801768:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80176c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801770:	0f ad d0             	shrd   %cl,%edx,%eax
+  801773:	d3 ea                	shr    %cl,%edx
+  801775:	f6 c1 20             	test   $0x20,%cl
+  801778:	74 04                	je     80177e <__udivdi3+0x81>
+  80177a:	89 d0                	mov    %edx,%eax
+  80177c:	31 d2                	xor    %edx,%edx
+  80177e:	83 e0 01             	and    $0x1,%eax
+  801781:	89 04 24             	mov    %eax,(%esp)
+  801784:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80178b:	00 
+  80178c:	8b 04 24             	mov    (%esp),%eax
+  80178f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801793:	09 f0                	or     %esi,%eax
+  801795:	09 fa                	or     %edi,%edx
+  801797:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80179b:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80179f:	39 f0                	cmp    %esi,%eax
+  8017a1:	89 d3                	mov    %edx,%ebx
+  8017a3:	19 fb                	sbb    %edi,%ebx
+  8017a5:	72 af                	jb     801756 <__udivdi3+0x59>
+  8017a7:	29 f0                	sub    %esi,%eax
+  8017a9:	19 fa                	sbb    %edi,%edx
+  8017ab:	89 cf                	mov    %ecx,%edi
+  8017ad:	c1 ef 05             	shr    $0x5,%edi
+  8017b0:	83 e7 01             	and    $0x1,%edi
+  8017b3:	89 fe                	mov    %edi,%esi
+  8017b5:	83 f6 01             	xor    $0x1,%esi
+  8017b8:	d3 e6                	shl    %cl,%esi
+  8017ba:	d3 e7                	shl    %cl,%edi
+  8017bc:	09 74 24 18          	or     %esi,0x18(%esp)
+  8017c0:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8017c4:	eb 90                	jmp    801756 <__udivdi3+0x59>
+  8017c6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8017ca:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8017ce:	83 c4 20             	add    $0x20,%esp
+  8017d1:	5b                   	pop    %ebx
+  8017d2:	5e                   	pop    %esi
+  8017d3:	5f                   	pop    %edi
+  8017d4:	c3                   	ret
+
+008017d5 <__umoddi3>:
+  8017d5:	55                   	push   %ebp
+  8017d6:	57                   	push   %edi
+  8017d7:	56                   	push   %esi
+  8017d8:	53                   	push   %ebx
+  8017d9:	83 ec 1c             	sub    $0x1c,%esp
+  8017dc:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8017e0:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8017e4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8017e8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8017ec:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8017f0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8017f4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8017f8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8017fc:	89 d6                	mov    %edx,%esi
+  8017fe:	09 c6                	or     %eax,%esi
+  801800:	74 6c                	je     80186e <__umoddi3+0x99>
+  801802:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801811:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801815:	eb 0e                	jmp    801825 <__umoddi3+0x50>
+  801817:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  80181c:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801820:	83 fe ff             	cmp    $0xffffffff,%esi
+  801823:	74 49                	je     80186e <__umoddi3+0x99>
+  801825:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801829:	01 c0                	add    %eax,%eax
+  80182b:	89 c3                	mov    %eax,%ebx
+  80182d:	89 d6                	mov    %edx,%esi
+  80182f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801833:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801837:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  80183c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80183f:	d3 ea                	shr    %cl,%edx
+  801841:	f6 c1 20             	test   $0x20,%cl
+  801844:	74 04                	je     80184a <__umoddi3+0x75>
+  801846:	89 d0                	mov    %edx,%eax
+  801848:	31 d2                	xor    %edx,%edx
+  80184a:	83 e0 01             	and    $0x1,%eax
+  80184d:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801852:	89 ea                	mov    %ebp,%edx
+  801854:	09 d8                	or     %ebx,%eax
+  801856:	09 f2                	or     %esi,%edx
+  801858:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  80185c:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801860:	39 d8                	cmp    %ebx,%eax
+  801862:	89 d1                	mov    %edx,%ecx
+  801864:	19 f1                	sbb    %esi,%ecx
+  801866:	72 af                	jb     801817 <__umoddi3+0x42>
+  801868:	29 d8                	sub    %ebx,%eax
+  80186a:	19 f2                	sbb    %esi,%edx
+  80186c:	eb a9                	jmp    801817 <__umoddi3+0x42>
+  80186e:	83 c4 1c             	add    $0x1c,%esp
+  801871:	5b                   	pop    %ebx
+  801872:	5e                   	pop    %esi
+  801873:	5f                   	pop    %edi
+  801874:	5d                   	pop    %ebp
+  801875:	c3                   	ret
+
+00801876 <__divdi3>:
+  801876:	53                   	push   %ebx
+  801877:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80187b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80187f:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801883:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801887:	85 d2                	test   %edx,%edx
+  801889:	78 12                	js     80189d <__divdi3+0x27>
+  80188b:	85 db                	test   %ebx,%ebx
+  80188d:	78 2e                	js     8018bd <__divdi3+0x47>
+  80188f:	53                   	push   %ebx
+  801890:	51                   	push   %ecx
+  801891:	52                   	push   %edx
+  801892:	50                   	push   %eax
+  801893:	e8 65 fe ff ff       	call   8016fd <__udivdi3>
+  801898:	83 c4 10             	add    $0x10,%esp
+  80189b:	eb 1e                	jmp    8018bb <__divdi3+0x45>
+  80189d:	f7 d8                	neg    %eax
+  80189f:	83 d2 00             	adc    $0x0,%edx
+  8018a2:	f7 da                	neg    %edx
+  8018a4:	85 db                	test   %ebx,%ebx
+  8018a6:	78 2a                	js     8018d2 <__divdi3+0x5c>
+  8018a8:	53                   	push   %ebx
+  8018a9:	51                   	push   %ecx
+  8018aa:	52                   	push   %edx
+  8018ab:	50                   	push   %eax
+  8018ac:	e8 4c fe ff ff       	call   8016fd <__udivdi3>
+  8018b1:	83 c4 10             	add    $0x10,%esp
+  8018b4:	f7 d8                	neg    %eax
+  8018b6:	83 d2 00             	adc    $0x0,%edx
+  8018b9:	f7 da                	neg    %edx
+  8018bb:	5b                   	pop    %ebx
+  8018bc:	c3                   	ret
+  8018bd:	f7 d9                	neg    %ecx
+  8018bf:	83 d3 00             	adc    $0x0,%ebx
+  8018c2:	f7 db                	neg    %ebx
+  8018c4:	53                   	push   %ebx
+  8018c5:	51                   	push   %ecx
+  8018c6:	52                   	push   %edx
+  8018c7:	50                   	push   %eax
+  8018c8:	e8 30 fe ff ff       	call   8016fd <__udivdi3>
+  8018cd:	83 c4 10             	add    $0x10,%esp
+  8018d0:	eb e2                	jmp    8018b4 <__divdi3+0x3e>
+  8018d2:	f7 d9                	neg    %ecx
+  8018d4:	83 d3 00             	adc    $0x0,%ebx
+  8018d7:	f7 db                	neg    %ebx
+  8018d9:	53                   	push   %ebx
+  8018da:	51                   	push   %ecx
+  8018db:	52                   	push   %edx
+  8018dc:	50                   	push   %eax
+  8018dd:	e8 1b fe ff ff       	call   8016fd <__udivdi3>
+  8018e2:	83 c4 10             	add    $0x10,%esp
+  8018e5:	eb d4                	jmp    8018bb <__divdi3+0x45>
+
+008018e7 <__moddi3>:
+  8018e7:	55                   	push   %ebp
+  8018e8:	57                   	push   %edi
+  8018e9:	56                   	push   %esi
+  8018ea:	53                   	push   %ebx
+  8018eb:	83 ec 14             	sub    $0x14,%esp
+  8018ee:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  8018f2:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  8018f6:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8018fa:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8018fe:	85 ed                	test   %ebp,%ebp
+  801900:	78 2b                	js     80192d <__moddi3+0x46>
+  801902:	89 c6                	mov    %eax,%esi
+  801904:	f7 de                	neg    %esi
+  801906:	89 34 24             	mov    %esi,(%esp)
+  801909:	89 d6                	mov    %edx,%esi
+  80190b:	83 d6 00             	adc    $0x0,%esi
+  80190e:	f7 de                	neg    %esi
+  801910:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801914:	8b 34 24             	mov    (%esp),%esi
+  801917:	0f 48 f0             	cmovs  %eax,%esi
+  80191a:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  80191f:	52                   	push   %edx
+  801920:	56                   	push   %esi
+  801921:	55                   	push   %ebp
+  801922:	57                   	push   %edi
+  801923:	e8 ad fe ff ff       	call   8017d5 <__umoddi3>
+  801928:	83 c4 10             	add    $0x10,%esp
+  80192b:	eb 3c                	jmp    801969 <__moddi3+0x82>
+  80192d:	89 c3                	mov    %eax,%ebx
+  80192f:	f7 db                	neg    %ebx
+  801931:	89 d1                	mov    %edx,%ecx
+  801933:	83 d1 00             	adc    $0x0,%ecx
+  801936:	f7 d9                	neg    %ecx
+  801938:	0f 49 c3             	cmovns %ebx,%eax
+  80193b:	89 04 24             	mov    %eax,(%esp)
+  80193e:	0f 49 d1             	cmovns %ecx,%edx
+  801941:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801945:	ff 74 24 04          	push   0x4(%esp)
+  801949:	ff 74 24 04          	push   0x4(%esp)
+  80194d:	89 f8                	mov    %edi,%eax
+  80194f:	89 ea                	mov    %ebp,%edx
+  801951:	f7 d8                	neg    %eax
+  801953:	83 d2 00             	adc    $0x0,%edx
+  801956:	f7 da                	neg    %edx
+  801958:	52                   	push   %edx
+  801959:	50                   	push   %eax
+  80195a:	e8 76 fe ff ff       	call   8017d5 <__umoddi3>
+  80195f:	83 c4 10             	add    $0x10,%esp
+  801962:	f7 d8                	neg    %eax
+  801964:	83 d2 00             	adc    $0x0,%edx
+  801967:	f7 da                	neg    %edx
+  801969:	83 c4 14             	add    $0x14,%esp
+  80196c:	5b                   	pop    %ebx
+  80196d:	5e                   	pop    %esi
+  80196e:	5f                   	pop    %edi
+  80196f:	5d                   	pop    %ebp
+  801970:	c3                   	ret
@@ -0,0 +1,2576 @@
+
+obj/user/divzero:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	c7 05 20 20 80 00 00 	movl   $0x0,0x802020
+  800040:	00 00 00 
+  800043:	6a 00                	push   $0x0
+  800045:	68 80 19 80 00       	push   $0x801980
+  80004a:	e8 fd 00 00 00       	call   80014c <cprintf>
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80005f:	e8 c4 14 00 00       	call   801528 <uinfo_envid>
+  800064:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  800069:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  80006f:	05 00 00 00 ed       	add    $0xed000000,%eax
+  800074:	a3 24 20 80 00       	mov    %eax,0x802024
+  800079:	85 db                	test   %ebx,%ebx
+  80007b:	7e 07                	jle    800084 <libmain+0x30>
+  80007d:	8b 06                	mov    (%esi),%eax
+  80007f:	a3 00 20 80 00       	mov    %eax,0x802000
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	56                   	push   %esi
+  800088:	53                   	push   %ebx
+  800089:	e8 a5 ff ff ff       	call   800033 <umain>
+  80008e:	e8 0a 00 00 00       	call   80009d <exit>
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+
+0080009d <exit>:
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+  8000a3:	e8 19 15 00 00       	call   8015c1 <bflush>
+  8000a8:	83 ec 0c             	sub    $0xc,%esp
+  8000ab:	6a 00                	push   $0x0
+  8000ad:	e8 cc 0b 00 00       	call   800c7e <sys_env_destroy>
+  8000b2:	83 c4 10             	add    $0x10,%esp
+  8000b5:	c9                   	leave
+  8000b6:	c3                   	ret
+
+008000b7 <putch>:
+  8000b7:	55                   	push   %ebp
+  8000b8:	89 e5                	mov    %esp,%ebp
+  8000ba:	53                   	push   %ebx
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8000c1:	8b 13                	mov    (%ebx),%edx
+  8000c3:	8d 42 01             	lea    0x1(%edx),%eax
+  8000c6:	89 03                	mov    %eax,(%ebx)
+  8000c8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000cb:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8000cf:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000d4:	74 09                	je     8000df <putch+0x28>
+  8000d6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8000da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000dd:	c9                   	leave
+  8000de:	c3                   	ret
+  8000df:	83 ec 08             	sub    $0x8,%esp
+  8000e2:	68 ff 00 00 00       	push   $0xff
+  8000e7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000ea:	50                   	push   %eax
+  8000eb:	e8 c0 0a 00 00       	call   800bb0 <sys_cputs>
+  8000f0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000f6:	83 c4 10             	add    $0x10,%esp
+  8000f9:	eb db                	jmp    8000d6 <putch+0x1f>
+
+008000fb <vcprintf>:
+  8000fb:	55                   	push   %ebp
+  8000fc:	89 e5                	mov    %esp,%ebp
+  8000fe:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800104:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80010b:	00 00 00 
+  80010e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800115:	00 00 00 
+  800118:	ff 75 0c             	push   0xc(%ebp)
+  80011b:	ff 75 08             	push   0x8(%ebp)
+  80011e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800124:	50                   	push   %eax
+  800125:	68 b7 00 80 00       	push   $0x8000b7
+  80012a:	e8 14 01 00 00       	call   800243 <vprintfmt>
+  80012f:	83 c4 08             	add    $0x8,%esp
+  800132:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800138:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80013e:	50                   	push   %eax
+  80013f:	e8 6c 0a 00 00       	call   800bb0 <sys_cputs>
+  800144:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80014a:	c9                   	leave
+  80014b:	c3                   	ret
+
+0080014c <cprintf>:
+  80014c:	55                   	push   %ebp
+  80014d:	89 e5                	mov    %esp,%ebp
+  80014f:	83 ec 10             	sub    $0x10,%esp
+  800152:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800155:	50                   	push   %eax
+  800156:	ff 75 08             	push   0x8(%ebp)
+  800159:	e8 9d ff ff ff       	call   8000fb <vcprintf>
+  80015e:	c9                   	leave
+  80015f:	c3                   	ret
+
+00800160 <printnum>:
+  800160:	55                   	push   %ebp
+  800161:	89 e5                	mov    %esp,%ebp
+  800163:	57                   	push   %edi
+  800164:	56                   	push   %esi
+  800165:	53                   	push   %ebx
+  800166:	83 ec 1c             	sub    $0x1c,%esp
+  800169:	89 c7                	mov    %eax,%edi
+  80016b:	89 d6                	mov    %edx,%esi
+  80016d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800170:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800173:	89 d1                	mov    %edx,%ecx
+  800175:	89 c2                	mov    %eax,%edx
+  800177:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80017a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80017d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800180:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800183:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800186:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80018d:	39 c2                	cmp    %eax,%edx
+  80018f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800192:	72 3e                	jb     8001d2 <printnum+0x72>
+  800194:	83 ec 0c             	sub    $0xc,%esp
+  800197:	ff 75 18             	push   0x18(%ebp)
+  80019a:	83 eb 01             	sub    $0x1,%ebx
+  80019d:	53                   	push   %ebx
+  80019e:	50                   	push   %eax
+  80019f:	83 ec 08             	sub    $0x8,%esp
+  8001a2:	ff 75 e4             	push   -0x1c(%ebp)
+  8001a5:	ff 75 e0             	push   -0x20(%ebp)
+  8001a8:	ff 75 dc             	push   -0x24(%ebp)
+  8001ab:	ff 75 d8             	push   -0x28(%ebp)
+  8001ae:	e8 50 15 00 00       	call   801703 <__udivdi3>
+  8001b3:	83 c4 18             	add    $0x18,%esp
+  8001b6:	52                   	push   %edx
+  8001b7:	50                   	push   %eax
+  8001b8:	89 f2                	mov    %esi,%edx
+  8001ba:	89 f8                	mov    %edi,%eax
+  8001bc:	e8 9f ff ff ff       	call   800160 <printnum>
+  8001c1:	83 c4 20             	add    $0x20,%esp
+  8001c4:	eb 13                	jmp    8001d9 <printnum+0x79>
+  8001c6:	83 ec 08             	sub    $0x8,%esp
+  8001c9:	56                   	push   %esi
+  8001ca:	ff 75 18             	push   0x18(%ebp)
+  8001cd:	ff d7                	call   *%edi
+  8001cf:	83 c4 10             	add    $0x10,%esp
+  8001d2:	83 eb 01             	sub    $0x1,%ebx
+  8001d5:	85 db                	test   %ebx,%ebx
+  8001d7:	7f ed                	jg     8001c6 <printnum+0x66>
+  8001d9:	83 ec 08             	sub    $0x8,%esp
+  8001dc:	56                   	push   %esi
+  8001dd:	83 ec 04             	sub    $0x4,%esp
+  8001e0:	ff 75 e4             	push   -0x1c(%ebp)
+  8001e3:	ff 75 e0             	push   -0x20(%ebp)
+  8001e6:	ff 75 dc             	push   -0x24(%ebp)
+  8001e9:	ff 75 d8             	push   -0x28(%ebp)
+  8001ec:	e8 ea 15 00 00       	call   8017db <__umoddi3>
+  8001f1:	83 c4 14             	add    $0x14,%esp
+  8001f4:	0f be 80 98 19 80 00 	movsbl 0x801998(%eax),%eax
+  8001fb:	50                   	push   %eax
+  8001fc:	ff d7                	call   *%edi
+  8001fe:	83 c4 10             	add    $0x10,%esp
+  800201:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800204:	5b                   	pop    %ebx
+  800205:	5e                   	pop    %esi
+  800206:	5f                   	pop    %edi
+  800207:	5d                   	pop    %ebp
+  800208:	c3                   	ret
+
+00800209 <sprintputch>:
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80020f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800213:	8b 10                	mov    (%eax),%edx
+  800215:	3b 50 04             	cmp    0x4(%eax),%edx
+  800218:	73 0a                	jae    800224 <sprintputch+0x1b>
+  80021a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80021d:	89 08                	mov    %ecx,(%eax)
+  80021f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800222:	88 02                	mov    %al,(%edx)
+  800224:	5d                   	pop    %ebp
+  800225:	c3                   	ret
+
+00800226 <printfmt>:
+  800226:	55                   	push   %ebp
+  800227:	89 e5                	mov    %esp,%ebp
+  800229:	83 ec 08             	sub    $0x8,%esp
+  80022c:	8d 45 14             	lea    0x14(%ebp),%eax
+  80022f:	50                   	push   %eax
+  800230:	ff 75 10             	push   0x10(%ebp)
+  800233:	ff 75 0c             	push   0xc(%ebp)
+  800236:	ff 75 08             	push   0x8(%ebp)
+  800239:	e8 05 00 00 00       	call   800243 <vprintfmt>
+  80023e:	83 c4 10             	add    $0x10,%esp
+  800241:	c9                   	leave
+  800242:	c3                   	ret
+
+00800243 <vprintfmt>:
+  800243:	55                   	push   %ebp
+  800244:	89 e5                	mov    %esp,%ebp
+  800246:	57                   	push   %edi
+  800247:	56                   	push   %esi
+  800248:	53                   	push   %ebx
+  800249:	83 ec 2c             	sub    $0x2c,%esp
+  80024c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80024f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800252:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800255:	eb 0a                	jmp    800261 <vprintfmt+0x1e>
+  800257:	83 ec 08             	sub    $0x8,%esp
+  80025a:	53                   	push   %ebx
+  80025b:	50                   	push   %eax
+  80025c:	ff d6                	call   *%esi
+  80025e:	83 c4 10             	add    $0x10,%esp
+  800261:	83 c7 01             	add    $0x1,%edi
+  800264:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800268:	83 f8 25             	cmp    $0x25,%eax
+  80026b:	74 0c                	je     800279 <vprintfmt+0x36>
+  80026d:	85 c0                	test   %eax,%eax
+  80026f:	75 e6                	jne    800257 <vprintfmt+0x14>
+  800271:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800274:	5b                   	pop    %ebx
+  800275:	5e                   	pop    %esi
+  800276:	5f                   	pop    %edi
+  800277:	5d                   	pop    %ebp
+  800278:	c3                   	ret
+  800279:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  80027d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800284:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80028b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800292:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800297:	8d 47 01             	lea    0x1(%edi),%eax
+  80029a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80029d:	0f b6 17             	movzbl (%edi),%edx
+  8002a0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002a3:	3c 55                	cmp    $0x55,%al
+  8002a5:	0f 87 cf 03 00 00    	ja     80067a <vprintfmt+0x437>
+  8002ab:	0f b6 c0             	movzbl %al,%eax
+  8002ae:	ff 24 85 60 1a 80 00 	jmp    *0x801a60(,%eax,4)
+  8002b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002b8:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002bc:	eb d9                	jmp    800297 <vprintfmt+0x54>
+  8002be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002c1:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002c5:	eb d0                	jmp    800297 <vprintfmt+0x54>
+  8002c7:	0f b6 d2             	movzbl %dl,%edx
+  8002ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8002d5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002d8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  8002dc:	0f be 17             	movsbl (%edi),%edx
+  8002df:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002e2:	83 f9 09             	cmp    $0x9,%ecx
+  8002e5:	77 55                	ja     80033c <vprintfmt+0xf9>
+  8002e7:	83 c7 01             	add    $0x1,%edi
+  8002ea:	eb e9                	jmp    8002d5 <vprintfmt+0x92>
+  8002ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002ef:	8b 00                	mov    (%eax),%eax
+  8002f1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8002fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8002fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800300:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800304:	79 91                	jns    800297 <vprintfmt+0x54>
+  800306:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800309:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80030c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800313:	eb 82                	jmp    800297 <vprintfmt+0x54>
+  800315:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800318:	85 d2                	test   %edx,%edx
+  80031a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031f:	0f 49 c2             	cmovns %edx,%eax
+  800322:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800325:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800328:	e9 6a ff ff ff       	jmp    800297 <vprintfmt+0x54>
+  80032d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800330:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800337:	e9 5b ff ff ff       	jmp    800297 <vprintfmt+0x54>
+  80033c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80033f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800342:	eb bc                	jmp    800300 <vprintfmt+0xbd>
+  800344:	83 c1 01             	add    $0x1,%ecx
+  800347:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80034a:	e9 48 ff ff ff       	jmp    800297 <vprintfmt+0x54>
+  80034f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800352:	8d 78 04             	lea    0x4(%eax),%edi
+  800355:	83 ec 08             	sub    $0x8,%esp
+  800358:	53                   	push   %ebx
+  800359:	ff 30                	push   (%eax)
+  80035b:	ff d6                	call   *%esi
+  80035d:	83 c4 10             	add    $0x10,%esp
+  800360:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800363:	e9 b1 02 00 00       	jmp    800619 <vprintfmt+0x3d6>
+  800368:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036b:	8d 78 04             	lea    0x4(%eax),%edi
+  80036e:	8b 10                	mov    (%eax),%edx
+  800370:	89 d0                	mov    %edx,%eax
+  800372:	f7 d8                	neg    %eax
+  800374:	0f 48 c2             	cmovs  %edx,%eax
+  800377:	83 f8 08             	cmp    $0x8,%eax
+  80037a:	7f 23                	jg     80039f <vprintfmt+0x15c>
+  80037c:	8b 14 85 c0 1b 80 00 	mov    0x801bc0(,%eax,4),%edx
+  800383:	85 d2                	test   %edx,%edx
+  800385:	74 18                	je     80039f <vprintfmt+0x15c>
+  800387:	52                   	push   %edx
+  800388:	68 b9 19 80 00       	push   $0x8019b9
+  80038d:	53                   	push   %ebx
+  80038e:	56                   	push   %esi
+  80038f:	e8 92 fe ff ff       	call   800226 <printfmt>
+  800394:	83 c4 10             	add    $0x10,%esp
+  800397:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80039a:	e9 7a 02 00 00       	jmp    800619 <vprintfmt+0x3d6>
+  80039f:	50                   	push   %eax
+  8003a0:	68 b0 19 80 00       	push   $0x8019b0
+  8003a5:	53                   	push   %ebx
+  8003a6:	56                   	push   %esi
+  8003a7:	e8 7a fe ff ff       	call   800226 <printfmt>
+  8003ac:	83 c4 10             	add    $0x10,%esp
+  8003af:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003b2:	e9 62 02 00 00       	jmp    800619 <vprintfmt+0x3d6>
+  8003b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ba:	83 c0 04             	add    $0x4,%eax
+  8003bd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c3:	8b 08                	mov    (%eax),%ecx
+  8003c5:	85 c9                	test   %ecx,%ecx
+  8003c7:	b8 a9 19 80 00       	mov    $0x8019a9,%eax
+  8003cc:	0f 45 c1             	cmovne %ecx,%eax
+  8003cf:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8003d2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d6:	7e 06                	jle    8003de <vprintfmt+0x19b>
+  8003d8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003dc:	75 0b                	jne    8003e9 <vprintfmt+0x1a6>
+  8003de:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003e1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003e4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003e7:	eb 5c                	jmp    800445 <vprintfmt+0x202>
+  8003e9:	83 ec 08             	sub    $0x8,%esp
+  8003ec:	ff 75 d0             	push   -0x30(%ebp)
+  8003ef:	ff 75 cc             	push   -0x34(%ebp)
+  8003f2:	e8 87 03 00 00       	call   80077e <strnlen>
+  8003f7:	89 c2                	mov    %eax,%edx
+  8003f9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003fc:	29 d0                	sub    %edx,%eax
+  8003fe:	83 c4 10             	add    $0x10,%esp
+  800401:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800405:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800408:	89 75 08             	mov    %esi,0x8(%ebp)
+  80040b:	89 c6                	mov    %eax,%esi
+  80040d:	eb 0e                	jmp    80041d <vprintfmt+0x1da>
+  80040f:	83 ec 08             	sub    $0x8,%esp
+  800412:	53                   	push   %ebx
+  800413:	57                   	push   %edi
+  800414:	ff 55 08             	call   *0x8(%ebp)
+  800417:	83 ee 01             	sub    $0x1,%esi
+  80041a:	83 c4 10             	add    $0x10,%esp
+  80041d:	85 f6                	test   %esi,%esi
+  80041f:	7f ee                	jg     80040f <vprintfmt+0x1cc>
+  800421:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800424:	8b 75 08             	mov    0x8(%ebp),%esi
+  800427:	85 c0                	test   %eax,%eax
+  800429:	ba 00 00 00 00       	mov    $0x0,%edx
+  80042e:	0f 49 d0             	cmovns %eax,%edx
+  800431:	29 d0                	sub    %edx,%eax
+  800433:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800436:	eb a6                	jmp    8003de <vprintfmt+0x19b>
+  800438:	83 ec 08             	sub    $0x8,%esp
+  80043b:	53                   	push   %ebx
+  80043c:	52                   	push   %edx
+  80043d:	ff 55 08             	call   *0x8(%ebp)
+  800440:	83 c4 10             	add    $0x10,%esp
+  800443:	89 f1                	mov    %esi,%ecx
+  800445:	8d 71 01             	lea    0x1(%ecx),%esi
+  800448:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80044c:	0f be d0             	movsbl %al,%edx
+  80044f:	85 d2                	test   %edx,%edx
+  800451:	74 28                	je     80047b <vprintfmt+0x238>
+  800453:	85 ff                	test   %edi,%edi
+  800455:	78 05                	js     80045c <vprintfmt+0x219>
+  800457:	83 ef 01             	sub    $0x1,%edi
+  80045a:	78 30                	js     80048c <vprintfmt+0x249>
+  80045c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800460:	74 d6                	je     800438 <vprintfmt+0x1f5>
+  800462:	0f be c0             	movsbl %al,%eax
+  800465:	83 e8 20             	sub    $0x20,%eax
+  800468:	83 f8 5e             	cmp    $0x5e,%eax
+  80046b:	76 cb                	jbe    800438 <vprintfmt+0x1f5>
+  80046d:	83 ec 08             	sub    $0x8,%esp
+  800470:	53                   	push   %ebx
+  800471:	6a 3f                	push   $0x3f
+  800473:	ff 55 08             	call   *0x8(%ebp)
+  800476:	83 c4 10             	add    $0x10,%esp
+  800479:	eb c8                	jmp    800443 <vprintfmt+0x200>
+  80047b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80047e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800481:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800484:	01 d0                	add    %edx,%eax
+  800486:	29 c8                	sub    %ecx,%eax
+  800488:	89 c7                	mov    %eax,%edi
+  80048a:	eb 13                	jmp    80049f <vprintfmt+0x25c>
+  80048c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80048f:	eb ed                	jmp    80047e <vprintfmt+0x23b>
+  800491:	83 ec 08             	sub    $0x8,%esp
+  800494:	53                   	push   %ebx
+  800495:	6a 20                	push   $0x20
+  800497:	ff d6                	call   *%esi
+  800499:	83 ef 01             	sub    $0x1,%edi
+  80049c:	83 c4 10             	add    $0x10,%esp
+  80049f:	85 ff                	test   %edi,%edi
+  8004a1:	7f ee                	jg     800491 <vprintfmt+0x24e>
+  8004a3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004a6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004a9:	e9 6b 01 00 00       	jmp    800619 <vprintfmt+0x3d6>
+  8004ae:	83 f9 01             	cmp    $0x1,%ecx
+  8004b1:	7f 1f                	jg     8004d2 <vprintfmt+0x28f>
+  8004b3:	85 c9                	test   %ecx,%ecx
+  8004b5:	74 67                	je     80051e <vprintfmt+0x2db>
+  8004b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ba:	8b 00                	mov    (%eax),%eax
+  8004bc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004bf:	89 c1                	mov    %eax,%ecx
+  8004c1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004c4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8004cd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004d0:	eb 17                	jmp    8004e9 <vprintfmt+0x2a6>
+  8004d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d5:	8b 50 04             	mov    0x4(%eax),%edx
+  8004d8:	8b 00                	mov    (%eax),%eax
+  8004da:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004dd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e3:	8d 40 08             	lea    0x8(%eax),%eax
+  8004e6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004e9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004ec:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8004ef:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8004f4:	85 c9                	test   %ecx,%ecx
+  8004f6:	0f 89 03 01 00 00    	jns    8005ff <vprintfmt+0x3bc>
+  8004fc:	83 ec 08             	sub    $0x8,%esp
+  8004ff:	53                   	push   %ebx
+  800500:	6a 2d                	push   $0x2d
+  800502:	ff d6                	call   *%esi
+  800504:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800507:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80050a:	f7 da                	neg    %edx
+  80050c:	83 d1 00             	adc    $0x0,%ecx
+  80050f:	f7 d9                	neg    %ecx
+  800511:	83 c4 10             	add    $0x10,%esp
+  800514:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800519:	e9 e1 00 00 00       	jmp    8005ff <vprintfmt+0x3bc>
+  80051e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800521:	8b 00                	mov    (%eax),%eax
+  800523:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800526:	89 c1                	mov    %eax,%ecx
+  800528:	c1 f9 1f             	sar    $0x1f,%ecx
+  80052b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80052e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800531:	8d 40 04             	lea    0x4(%eax),%eax
+  800534:	89 45 14             	mov    %eax,0x14(%ebp)
+  800537:	eb b0                	jmp    8004e9 <vprintfmt+0x2a6>
+  800539:	83 f9 01             	cmp    $0x1,%ecx
+  80053c:	7f 1e                	jg     80055c <vprintfmt+0x319>
+  80053e:	85 c9                	test   %ecx,%ecx
+  800540:	74 32                	je     800574 <vprintfmt+0x331>
+  800542:	8b 45 14             	mov    0x14(%ebp),%eax
+  800545:	8b 10                	mov    (%eax),%edx
+  800547:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80054c:	8d 40 04             	lea    0x4(%eax),%eax
+  80054f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800552:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800557:	e9 a3 00 00 00       	jmp    8005ff <vprintfmt+0x3bc>
+  80055c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055f:	8b 10                	mov    (%eax),%edx
+  800561:	8b 48 04             	mov    0x4(%eax),%ecx
+  800564:	8d 40 08             	lea    0x8(%eax),%eax
+  800567:	89 45 14             	mov    %eax,0x14(%ebp)
+  80056a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80056f:	e9 8b 00 00 00       	jmp    8005ff <vprintfmt+0x3bc>
+  800574:	8b 45 14             	mov    0x14(%ebp),%eax
+  800577:	8b 10                	mov    (%eax),%edx
+  800579:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80057e:	8d 40 04             	lea    0x4(%eax),%eax
+  800581:	89 45 14             	mov    %eax,0x14(%ebp)
+  800584:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800589:	eb 74                	jmp    8005ff <vprintfmt+0x3bc>
+  80058b:	83 f9 01             	cmp    $0x1,%ecx
+  80058e:	7f 1b                	jg     8005ab <vprintfmt+0x368>
+  800590:	85 c9                	test   %ecx,%ecx
+  800592:	74 2c                	je     8005c0 <vprintfmt+0x37d>
+  800594:	8b 45 14             	mov    0x14(%ebp),%eax
+  800597:	8b 10                	mov    (%eax),%edx
+  800599:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80059e:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005a9:	eb 54                	jmp    8005ff <vprintfmt+0x3bc>
+  8005ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ae:	8b 10                	mov    (%eax),%edx
+  8005b0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005b3:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005be:	eb 3f                	jmp    8005ff <vprintfmt+0x3bc>
+  8005c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c3:	8b 10                	mov    (%eax),%edx
+  8005c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8005cd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d0:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005d5:	eb 28                	jmp    8005ff <vprintfmt+0x3bc>
+  8005d7:	83 ec 08             	sub    $0x8,%esp
+  8005da:	53                   	push   %ebx
+  8005db:	6a 30                	push   $0x30
+  8005dd:	ff d6                	call   *%esi
+  8005df:	83 c4 08             	add    $0x8,%esp
+  8005e2:	53                   	push   %ebx
+  8005e3:	6a 78                	push   $0x78
+  8005e5:	ff d6                	call   *%esi
+  8005e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ea:	8b 10                	mov    (%eax),%edx
+  8005ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f1:	83 c4 10             	add    $0x10,%esp
+  8005f4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fa:	bf 10 00 00 00       	mov    $0x10,%edi
+  8005ff:	83 ec 0c             	sub    $0xc,%esp
+  800602:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800606:	50                   	push   %eax
+  800607:	ff 75 e0             	push   -0x20(%ebp)
+  80060a:	57                   	push   %edi
+  80060b:	51                   	push   %ecx
+  80060c:	52                   	push   %edx
+  80060d:	89 da                	mov    %ebx,%edx
+  80060f:	89 f0                	mov    %esi,%eax
+  800611:	e8 4a fb ff ff       	call   800160 <printnum>
+  800616:	83 c4 20             	add    $0x20,%esp
+  800619:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80061c:	e9 40 fc ff ff       	jmp    800261 <vprintfmt+0x1e>
+  800621:	83 f9 01             	cmp    $0x1,%ecx
+  800624:	7f 1b                	jg     800641 <vprintfmt+0x3fe>
+  800626:	85 c9                	test   %ecx,%ecx
+  800628:	74 2c                	je     800656 <vprintfmt+0x413>
+  80062a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062d:	8b 10                	mov    (%eax),%edx
+  80062f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800634:	8d 40 04             	lea    0x4(%eax),%eax
+  800637:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063a:	bf 10 00 00 00       	mov    $0x10,%edi
+  80063f:	eb be                	jmp    8005ff <vprintfmt+0x3bc>
+  800641:	8b 45 14             	mov    0x14(%ebp),%eax
+  800644:	8b 10                	mov    (%eax),%edx
+  800646:	8b 48 04             	mov    0x4(%eax),%ecx
+  800649:	8d 40 08             	lea    0x8(%eax),%eax
+  80064c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80064f:	bf 10 00 00 00       	mov    $0x10,%edi
+  800654:	eb a9                	jmp    8005ff <vprintfmt+0x3bc>
+  800656:	8b 45 14             	mov    0x14(%ebp),%eax
+  800659:	8b 10                	mov    (%eax),%edx
+  80065b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800660:	8d 40 04             	lea    0x4(%eax),%eax
+  800663:	89 45 14             	mov    %eax,0x14(%ebp)
+  800666:	bf 10 00 00 00       	mov    $0x10,%edi
+  80066b:	eb 92                	jmp    8005ff <vprintfmt+0x3bc>
+  80066d:	83 ec 08             	sub    $0x8,%esp
+  800670:	53                   	push   %ebx
+  800671:	6a 25                	push   $0x25
+  800673:	ff d6                	call   *%esi
+  800675:	83 c4 10             	add    $0x10,%esp
+  800678:	eb 9f                	jmp    800619 <vprintfmt+0x3d6>
+  80067a:	83 ec 08             	sub    $0x8,%esp
+  80067d:	53                   	push   %ebx
+  80067e:	6a 25                	push   $0x25
+  800680:	ff d6                	call   *%esi
+  800682:	83 c4 10             	add    $0x10,%esp
+  800685:	89 f8                	mov    %edi,%eax
+  800687:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80068b:	74 05                	je     800692 <vprintfmt+0x44f>
+  80068d:	83 e8 01             	sub    $0x1,%eax
+  800690:	eb f5                	jmp    800687 <vprintfmt+0x444>
+  800692:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800695:	eb 82                	jmp    800619 <vprintfmt+0x3d6>
+
+00800697 <vsnprintf>:
+  800697:	55                   	push   %ebp
+  800698:	89 e5                	mov    %esp,%ebp
+  80069a:	83 ec 18             	sub    $0x18,%esp
+  80069d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006a3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006a6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006aa:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006ad:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8006b4:	85 c0                	test   %eax,%eax
+  8006b6:	74 26                	je     8006de <vsnprintf+0x47>
+  8006b8:	85 d2                	test   %edx,%edx
+  8006ba:	7e 22                	jle    8006de <vsnprintf+0x47>
+  8006bc:	ff 75 14             	push   0x14(%ebp)
+  8006bf:	ff 75 10             	push   0x10(%ebp)
+  8006c2:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006c5:	50                   	push   %eax
+  8006c6:	68 09 02 80 00       	push   $0x800209
+  8006cb:	e8 73 fb ff ff       	call   800243 <vprintfmt>
+  8006d0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006d3:	c6 00 00             	movb   $0x0,(%eax)
+  8006d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006d9:	83 c4 10             	add    $0x10,%esp
+  8006dc:	c9                   	leave
+  8006dd:	c3                   	ret
+  8006de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006e3:	eb f7                	jmp    8006dc <vsnprintf+0x45>
+
+008006e5 <snprintf>:
+  8006e5:	55                   	push   %ebp
+  8006e6:	89 e5                	mov    %esp,%ebp
+  8006e8:	83 ec 08             	sub    $0x8,%esp
+  8006eb:	8d 45 14             	lea    0x14(%ebp),%eax
+  8006ee:	50                   	push   %eax
+  8006ef:	ff 75 10             	push   0x10(%ebp)
+  8006f2:	ff 75 0c             	push   0xc(%ebp)
+  8006f5:	ff 75 08             	push   0x8(%ebp)
+  8006f8:	e8 9a ff ff ff       	call   800697 <vsnprintf>
+  8006fd:	c9                   	leave
+  8006fe:	c3                   	ret
+
+008006ff <copy_fwd>:
+  8006ff:	55                   	push   %ebp
+  800700:	89 e5                	mov    %esp,%ebp
+  800702:	57                   	push   %edi
+  800703:	56                   	push   %esi
+  800704:	53                   	push   %ebx
+  800705:	89 c7                	mov    %eax,%edi
+  800707:	89 d6                	mov    %edx,%esi
+  800709:	89 c8                	mov    %ecx,%eax
+  80070b:	83 f9 0f             	cmp    $0xf,%ecx
+  80070e:	76 1c                	jbe    80072c <copy_fwd+0x2d>
+  800710:	89 f9                	mov    %edi,%ecx
+  800712:	f7 d9                	neg    %ecx
+  800714:	89 cb                	mov    %ecx,%ebx
+  800716:	83 e3 03             	and    $0x3,%ebx
+  800719:	29 d8                	sub    %ebx,%eax
+  80071b:	89 c2                	mov    %eax,%edx
+  80071d:	c1 ea 02             	shr    $0x2,%edx
+  800720:	83 e0 03             	and    $0x3,%eax
+  800723:	89 d9                	mov    %ebx,%ecx
+  800725:	fc                   	cld
+  800726:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800728:	89 d1                	mov    %edx,%ecx
+  80072a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80072c:	89 c1                	mov    %eax,%ecx
+  80072e:	fc                   	cld
+  80072f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800731:	5b                   	pop    %ebx
+  800732:	5e                   	pop    %esi
+  800733:	5f                   	pop    %edi
+  800734:	5d                   	pop    %ebp
+  800735:	c3                   	ret
+
+00800736 <have_sse2>:
+  800736:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80073d:	78 06                	js     800745 <have_sse2+0xf>
+  80073f:	a1 04 20 80 00       	mov    0x802004,%eax
+  800744:	c3                   	ret
+  800745:	55                   	push   %ebp
+  800746:	89 e5                	mov    %esp,%ebp
+  800748:	53                   	push   %ebx
+  800749:	b8 01 00 00 00       	mov    $0x1,%eax
+  80074e:	0f a2                	cpuid
+  800750:	c1 ea 1a             	shr    $0x1a,%edx
+  800753:	83 e2 01             	and    $0x1,%edx
+  800756:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80075c:	a1 04 20 80 00       	mov    0x802004,%eax
+  800761:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800764:	c9                   	leave
+  800765:	c3                   	ret
+
+00800766 <strlen>:
+  800766:	55                   	push   %ebp
+  800767:	89 e5                	mov    %esp,%ebp
+  800769:	8b 55 08             	mov    0x8(%ebp),%edx
+  80076c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800771:	eb 03                	jmp    800776 <strlen+0x10>
+  800773:	83 c0 01             	add    $0x1,%eax
+  800776:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80077a:	75 f7                	jne    800773 <strlen+0xd>
+  80077c:	5d                   	pop    %ebp
+  80077d:	c3                   	ret
+
+0080077e <strnlen>:
+  80077e:	55                   	push   %ebp
+  80077f:	89 e5                	mov    %esp,%ebp
+  800781:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800784:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078c:	eb 03                	jmp    800791 <strnlen+0x13>
+  80078e:	83 c0 01             	add    $0x1,%eax
+  800791:	39 d0                	cmp    %edx,%eax
+  800793:	74 08                	je     80079d <strnlen+0x1f>
+  800795:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800799:	75 f3                	jne    80078e <strnlen+0x10>
+  80079b:	89 c2                	mov    %eax,%edx
+  80079d:	89 d0                	mov    %edx,%eax
+  80079f:	5d                   	pop    %ebp
+  8007a0:	c3                   	ret
+
+008007a1 <strcpy>:
+  8007a1:	55                   	push   %ebp
+  8007a2:	89 e5                	mov    %esp,%ebp
+  8007a4:	53                   	push   %ebx
+  8007a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007b7:	83 c0 01             	add    $0x1,%eax
+  8007ba:	84 d2                	test   %dl,%dl
+  8007bc:	75 f2                	jne    8007b0 <strcpy+0xf>
+  8007be:	89 c8                	mov    %ecx,%eax
+  8007c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c3:	c9                   	leave
+  8007c4:	c3                   	ret
+
+008007c5 <strcat>:
+  8007c5:	55                   	push   %ebp
+  8007c6:	89 e5                	mov    %esp,%ebp
+  8007c8:	53                   	push   %ebx
+  8007c9:	83 ec 10             	sub    $0x10,%esp
+  8007cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8007cf:	53                   	push   %ebx
+  8007d0:	e8 91 ff ff ff       	call   800766 <strlen>
+  8007d5:	83 c4 08             	add    $0x8,%esp
+  8007d8:	ff 75 0c             	push   0xc(%ebp)
+  8007db:	01 d8                	add    %ebx,%eax
+  8007dd:	50                   	push   %eax
+  8007de:	e8 be ff ff ff       	call   8007a1 <strcpy>
+  8007e3:	89 d8                	mov    %ebx,%eax
+  8007e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007e8:	c9                   	leave
+  8007e9:	c3                   	ret
+
+008007ea <strncpy>:
+  8007ea:	55                   	push   %ebp
+  8007eb:	89 e5                	mov    %esp,%ebp
+  8007ed:	56                   	push   %esi
+  8007ee:	53                   	push   %ebx
+  8007ef:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007f5:	89 f3                	mov    %esi,%ebx
+  8007f7:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007fa:	89 f0                	mov    %esi,%eax
+  8007fc:	eb 0f                	jmp    80080d <strncpy+0x23>
+  8007fe:	83 c0 01             	add    $0x1,%eax
+  800801:	0f b6 0a             	movzbl (%edx),%ecx
+  800804:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800807:	80 f9 01             	cmp    $0x1,%cl
+  80080a:	83 da ff             	sbb    $0xffffffff,%edx
+  80080d:	39 d8                	cmp    %ebx,%eax
+  80080f:	75 ed                	jne    8007fe <strncpy+0x14>
+  800811:	89 f0                	mov    %esi,%eax
+  800813:	5b                   	pop    %ebx
+  800814:	5e                   	pop    %esi
+  800815:	5d                   	pop    %ebp
+  800816:	c3                   	ret
+
+00800817 <strlcpy>:
+  800817:	55                   	push   %ebp
+  800818:	89 e5                	mov    %esp,%ebp
+  80081a:	56                   	push   %esi
+  80081b:	53                   	push   %ebx
+  80081c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80081f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800822:	8b 55 10             	mov    0x10(%ebp),%edx
+  800825:	89 f0                	mov    %esi,%eax
+  800827:	85 d2                	test   %edx,%edx
+  800829:	74 21                	je     80084c <strlcpy+0x35>
+  80082b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80082f:	89 f2                	mov    %esi,%edx
+  800831:	eb 09                	jmp    80083c <strlcpy+0x25>
+  800833:	83 c1 01             	add    $0x1,%ecx
+  800836:	83 c2 01             	add    $0x1,%edx
+  800839:	88 5a ff             	mov    %bl,-0x1(%edx)
+  80083c:	39 c2                	cmp    %eax,%edx
+  80083e:	74 09                	je     800849 <strlcpy+0x32>
+  800840:	0f b6 19             	movzbl (%ecx),%ebx
+  800843:	84 db                	test   %bl,%bl
+  800845:	75 ec                	jne    800833 <strlcpy+0x1c>
+  800847:	89 d0                	mov    %edx,%eax
+  800849:	c6 00 00             	movb   $0x0,(%eax)
+  80084c:	29 f0                	sub    %esi,%eax
+  80084e:	5b                   	pop    %ebx
+  80084f:	5e                   	pop    %esi
+  800850:	5d                   	pop    %ebp
+  800851:	c3                   	ret
+
+00800852 <strcmp>:
+  800852:	55                   	push   %ebp
+  800853:	89 e5                	mov    %esp,%ebp
+  800855:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800858:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80085b:	eb 06                	jmp    800863 <strcmp+0x11>
+  80085d:	83 c1 01             	add    $0x1,%ecx
+  800860:	83 c2 01             	add    $0x1,%edx
+  800863:	0f b6 01             	movzbl (%ecx),%eax
+  800866:	84 c0                	test   %al,%al
+  800868:	74 04                	je     80086e <strcmp+0x1c>
+  80086a:	3a 02                	cmp    (%edx),%al
+  80086c:	74 ef                	je     80085d <strcmp+0xb>
+  80086e:	0f b6 c0             	movzbl %al,%eax
+  800871:	0f b6 12             	movzbl (%edx),%edx
+  800874:	29 d0                	sub    %edx,%eax
+  800876:	5d                   	pop    %ebp
+  800877:	c3                   	ret
+
+00800878 <strncmp>:
+  800878:	55                   	push   %ebp
+  800879:	89 e5                	mov    %esp,%ebp
+  80087b:	53                   	push   %ebx
+  80087c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800882:	8b 55 10             	mov    0x10(%ebp),%edx
+  800885:	eb 09                	jmp    800890 <strncmp+0x18>
+  800887:	83 ea 01             	sub    $0x1,%edx
+  80088a:	83 c0 01             	add    $0x1,%eax
+  80088d:	83 c1 01             	add    $0x1,%ecx
+  800890:	85 d2                	test   %edx,%edx
+  800892:	74 18                	je     8008ac <strncmp+0x34>
+  800894:	0f b6 18             	movzbl (%eax),%ebx
+  800897:	84 db                	test   %bl,%bl
+  800899:	74 04                	je     80089f <strncmp+0x27>
+  80089b:	3a 19                	cmp    (%ecx),%bl
+  80089d:	74 e8                	je     800887 <strncmp+0xf>
+  80089f:	0f b6 00             	movzbl (%eax),%eax
+  8008a2:	0f b6 11             	movzbl (%ecx),%edx
+  8008a5:	29 d0                	sub    %edx,%eax
+  8008a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008aa:	c9                   	leave
+  8008ab:	c3                   	ret
+  8008ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b1:	eb f4                	jmp    8008a7 <strncmp+0x2f>
+
+008008b3 <strchr>:
+  8008b3:	55                   	push   %ebp
+  8008b4:	89 e5                	mov    %esp,%ebp
+  8008b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8008bd:	eb 03                	jmp    8008c2 <strchr+0xf>
+  8008bf:	83 c0 01             	add    $0x1,%eax
+  8008c2:	0f b6 10             	movzbl (%eax),%edx
+  8008c5:	84 d2                	test   %dl,%dl
+  8008c7:	74 06                	je     8008cf <strchr+0x1c>
+  8008c9:	38 ca                	cmp    %cl,%dl
+  8008cb:	75 f2                	jne    8008bf <strchr+0xc>
+  8008cd:	eb 05                	jmp    8008d4 <strchr+0x21>
+  8008cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d4:	5d                   	pop    %ebp
+  8008d5:	c3                   	ret
+
+008008d6 <strfind>:
+  8008d6:	55                   	push   %ebp
+  8008d7:	89 e5                	mov    %esp,%ebp
+  8008d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008dc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8008e0:	0f b6 10             	movzbl (%eax),%edx
+  8008e3:	38 ca                	cmp    %cl,%dl
+  8008e5:	74 09                	je     8008f0 <strfind+0x1a>
+  8008e7:	84 d2                	test   %dl,%dl
+  8008e9:	74 05                	je     8008f0 <strfind+0x1a>
+  8008eb:	83 c0 01             	add    $0x1,%eax
+  8008ee:	eb f0                	jmp    8008e0 <strfind+0xa>
+  8008f0:	5d                   	pop    %ebp
+  8008f1:	c3                   	ret
+
+008008f2 <memset>:
+  8008f2:	55                   	push   %ebp
+  8008f3:	89 e5                	mov    %esp,%ebp
+  8008f5:	57                   	push   %edi
+  8008f6:	56                   	push   %esi
+  8008f7:	53                   	push   %ebx
+  8008f8:	83 ec 04             	sub    $0x4,%esp
+  8008fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008fe:	8b 55 10             	mov    0x10(%ebp),%edx
+  800901:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  800905:	89 f7                	mov    %esi,%edi
+  800907:	83 fa 0f             	cmp    $0xf,%edx
+  80090a:	76 24                	jbe    800930 <memset+0x3e>
+  80090c:	89 f1                	mov    %esi,%ecx
+  80090e:	f7 d9                	neg    %ecx
+  800910:	83 e1 03             	and    $0x3,%ecx
+  800913:	29 ca                	sub    %ecx,%edx
+  800915:	89 d0                	mov    %edx,%eax
+  800917:	c1 e8 02             	shr    $0x2,%eax
+  80091a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  80091d:	83 e2 03             	and    $0x3,%edx
+  800920:	89 d8                	mov    %ebx,%eax
+  800922:	fc                   	cld
+  800923:	f3 aa                	rep stos %al,%es:(%edi)
+  800925:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  80092b:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  80092e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800930:	89 d1                	mov    %edx,%ecx
+  800932:	89 d8                	mov    %ebx,%eax
+  800934:	fc                   	cld
+  800935:	f3 aa                	rep stos %al,%es:(%edi)
+  800937:	89 f0                	mov    %esi,%eax
+  800939:	83 c4 04             	add    $0x4,%esp
+  80093c:	5b                   	pop    %ebx
+  80093d:	5e                   	pop    %esi
+  80093e:	5f                   	pop    %edi
+  80093f:	5d                   	pop    %ebp
+  800940:	c3                   	ret
+
+00800941 <memmove>:
+  800941:	55                   	push   %ebp
+  800942:	89 e5                	mov    %esp,%ebp
+  800944:	57                   	push   %edi
+  800945:	56                   	push   %esi
+  800946:	53                   	push   %ebx
+  800947:	83 ec 0c             	sub    $0xc,%esp
+  80094a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80094d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800950:	8b 45 10             	mov    0x10(%ebp),%eax
+  800953:	85 c0                	test   %eax,%eax
+  800955:	74 14                	je     80096b <memmove+0x2a>
+  800957:	39 da                	cmp    %ebx,%edx
+  800959:	73 07                	jae    800962 <memmove+0x21>
+  80095b:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  80095e:	39 cb                	cmp    %ecx,%ebx
+  800960:	72 13                	jb     800975 <memmove+0x34>
+  800962:	89 c1                	mov    %eax,%ecx
+  800964:	89 d8                	mov    %ebx,%eax
+  800966:	e8 94 fd ff ff       	call   8006ff <copy_fwd>
+  80096b:	89 d8                	mov    %ebx,%eax
+  80096d:	83 c4 0c             	add    $0xc,%esp
+  800970:	5b                   	pop    %ebx
+  800971:	5e                   	pop    %esi
+  800972:	5f                   	pop    %edi
+  800973:	5d                   	pop    %ebp
+  800974:	c3                   	ret
+  800975:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800978:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  80097b:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  80097e:	83 f8 0f             	cmp    $0xf,%eax
+  800981:	76 23                	jbe    8009a6 <memmove+0x65>
+  800983:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800986:	83 e1 03             	and    $0x3,%ecx
+  800989:	29 c8                	sub    %ecx,%eax
+  80098b:	89 c2                	mov    %eax,%edx
+  80098d:	c1 ea 02             	shr    $0x2,%edx
+  800990:	83 e0 03             	and    $0x3,%eax
+  800993:	fd                   	std
+  800994:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800996:	83 ef 03             	sub    $0x3,%edi
+  800999:	83 ee 03             	sub    $0x3,%esi
+  80099c:	89 d1                	mov    %edx,%ecx
+  80099e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009a0:	83 c7 03             	add    $0x3,%edi
+  8009a3:	83 c6 03             	add    $0x3,%esi
+  8009a6:	89 c1                	mov    %eax,%ecx
+  8009a8:	fd                   	std
+  8009a9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8009ab:	fc                   	cld
+  8009ac:	eb bd                	jmp    80096b <memmove+0x2a>
+
+008009ae <memcpy>:
+  8009ae:	55                   	push   %ebp
+  8009af:	89 e5                	mov    %esp,%ebp
+  8009b1:	53                   	push   %ebx
+  8009b2:	83 ec 04             	sub    $0x4,%esp
+  8009b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009b8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8009bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009be:	89 d8                	mov    %ebx,%eax
+  8009c0:	e8 3a fd ff ff       	call   8006ff <copy_fwd>
+  8009c5:	89 d8                	mov    %ebx,%eax
+  8009c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ca:	c9                   	leave
+  8009cb:	c3                   	ret
+
+008009cc <page_copy>:
+  8009cc:	55                   	push   %ebp
+  8009cd:	89 e5                	mov    %esp,%ebp
+  8009cf:	57                   	push   %edi
+  8009d0:	56                   	push   %esi
+  8009d1:	53                   	push   %ebx
+  8009d2:	83 ec 0c             	sub    $0xc,%esp
+  8009d5:	e8 5c fd ff ff       	call   800736 <have_sse2>
+  8009da:	85 c0                	test   %eax,%eax
+  8009dc:	74 39                	je     800a17 <page_copy+0x4b>
+  8009de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009e1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009e4:	be 00 01 00 00       	mov    $0x100,%esi
+  8009e9:	8b 03                	mov    (%ebx),%eax
+  8009eb:	8b 53 04             	mov    0x4(%ebx),%edx
+  8009ee:	0f c3 01             	movnti %eax,(%ecx)
+  8009f1:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  8009f5:	8b 43 08             	mov    0x8(%ebx),%eax
+  8009f8:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8009fb:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  8009ff:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800a03:	83 c3 10             	add    $0x10,%ebx
+  800a06:	83 c1 10             	add    $0x10,%ecx
+  800a09:	4e                   	dec    %esi
+  800a0a:	75 dd                	jne    8009e9 <page_copy+0x1d>
+  800a0c:	0f ae f8             	sfence
+  800a0f:	83 c4 0c             	add    $0xc,%esp
+  800a12:	5b                   	pop    %ebx
+  800a13:	5e                   	pop    %esi
+  800a14:	5f                   	pop    %edi
+  800a15:	5d                   	pop    %ebp
+  800a16:	c3                   	ret
+  800a17:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a1a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a1d:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800a22:	fc                   	cld
+  800a23:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a25:	eb e8                	jmp    800a0f <page_copy+0x43>
+
+00800a27 <page_zero>:
+  800a27:	55                   	push   %ebp
+  800a28:	89 e5                	mov    %esp,%ebp
+  800a2a:	57                   	push   %edi
+  800a2b:	83 ec 04             	sub    $0x4,%esp
+  800a2e:	e8 03 fd ff ff       	call   800736 <have_sse2>
+  800a33:	85 c0                	test   %eax,%eax
+  800a35:	74 3a                	je     800a71 <page_zero+0x4a>
+  800a37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3a:	ba 80 00 00 00       	mov    $0x80,%edx
+  800a3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a44:	0f c3 08             	movnti %ecx,(%eax)
+  800a47:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800a4b:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800a4f:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800a53:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800a57:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800a5b:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800a5f:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800a63:	83 c0 20             	add    $0x20,%eax
+  800a66:	4a                   	dec    %edx
+  800a67:	75 db                	jne    800a44 <page_zero+0x1d>
+  800a69:	0f ae f8             	sfence
+  800a6c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a6f:	c9                   	leave
+  800a70:	c3                   	ret
+  800a71:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a74:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800a79:	fc                   	cld
+  800a7a:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a7c:	eb ee                	jmp    800a6c <page_zero+0x45>
+
+00800a7e <memcmp>:
+  800a7e:	55                   	push   %ebp
+  800a7f:	89 e5                	mov    %esp,%ebp
+  800a81:	56                   	push   %esi
+  800a82:	53                   	push   %ebx
+  800a83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a86:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a89:	89 c6                	mov    %eax,%esi
+  800a8b:	03 75 10             	add    0x10(%ebp),%esi
+  800a8e:	eb 06                	jmp    800a96 <memcmp+0x18>
+  800a90:	83 c0 01             	add    $0x1,%eax
+  800a93:	83 c2 01             	add    $0x1,%edx
+  800a96:	39 f0                	cmp    %esi,%eax
+  800a98:	74 14                	je     800aae <memcmp+0x30>
+  800a9a:	0f b6 08             	movzbl (%eax),%ecx
+  800a9d:	0f b6 1a             	movzbl (%edx),%ebx
+  800aa0:	38 d9                	cmp    %bl,%cl
+  800aa2:	74 ec                	je     800a90 <memcmp+0x12>
+  800aa4:	0f b6 c1             	movzbl %cl,%eax
+  800aa7:	0f b6 db             	movzbl %bl,%ebx
+  800aaa:	29 d8                	sub    %ebx,%eax
+  800aac:	eb 05                	jmp    800ab3 <memcmp+0x35>
+  800aae:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab3:	5b                   	pop    %ebx
+  800ab4:	5e                   	pop    %esi
+  800ab5:	5d                   	pop    %ebp
+  800ab6:	c3                   	ret
+
+00800ab7 <memfind>:
+  800ab7:	55                   	push   %ebp
+  800ab8:	89 e5                	mov    %esp,%ebp
+  800aba:	8b 45 08             	mov    0x8(%ebp),%eax
+  800abd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ac0:	89 c2                	mov    %eax,%edx
+  800ac2:	03 55 10             	add    0x10(%ebp),%edx
+  800ac5:	eb 03                	jmp    800aca <memfind+0x13>
+  800ac7:	83 c0 01             	add    $0x1,%eax
+  800aca:	39 d0                	cmp    %edx,%eax
+  800acc:	73 04                	jae    800ad2 <memfind+0x1b>
+  800ace:	38 08                	cmp    %cl,(%eax)
+  800ad0:	75 f5                	jne    800ac7 <memfind+0x10>
+  800ad2:	5d                   	pop    %ebp
+  800ad3:	c3                   	ret
+
+00800ad4 <strtol>:
+  800ad4:	55                   	push   %ebp
+  800ad5:	89 e5                	mov    %esp,%ebp
+  800ad7:	57                   	push   %edi
+  800ad8:	56                   	push   %esi
+  800ad9:	53                   	push   %ebx
+  800ada:	8b 55 08             	mov    0x8(%ebp),%edx
+  800add:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ae0:	eb 03                	jmp    800ae5 <strtol+0x11>
+  800ae2:	83 c2 01             	add    $0x1,%edx
+  800ae5:	0f b6 02             	movzbl (%edx),%eax
+  800ae8:	3c 20                	cmp    $0x20,%al
+  800aea:	74 f6                	je     800ae2 <strtol+0xe>
+  800aec:	3c 09                	cmp    $0x9,%al
+  800aee:	74 f2                	je     800ae2 <strtol+0xe>
+  800af0:	3c 2b                	cmp    $0x2b,%al
+  800af2:	74 2a                	je     800b1e <strtol+0x4a>
+  800af4:	bf 00 00 00 00       	mov    $0x0,%edi
+  800af9:	3c 2d                	cmp    $0x2d,%al
+  800afb:	74 2b                	je     800b28 <strtol+0x54>
+  800afd:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b03:	75 0f                	jne    800b14 <strtol+0x40>
+  800b05:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b08:	74 28                	je     800b32 <strtol+0x5e>
+  800b0a:	85 db                	test   %ebx,%ebx
+  800b0c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b11:	0f 44 d8             	cmove  %eax,%ebx
+  800b14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b19:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b1c:	eb 46                	jmp    800b64 <strtol+0x90>
+  800b1e:	83 c2 01             	add    $0x1,%edx
+  800b21:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b26:	eb d5                	jmp    800afd <strtol+0x29>
+  800b28:	83 c2 01             	add    $0x1,%edx
+  800b2b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b30:	eb cb                	jmp    800afd <strtol+0x29>
+  800b32:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b36:	74 0e                	je     800b46 <strtol+0x72>
+  800b38:	85 db                	test   %ebx,%ebx
+  800b3a:	75 d8                	jne    800b14 <strtol+0x40>
+  800b3c:	83 c2 01             	add    $0x1,%edx
+  800b3f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b44:	eb ce                	jmp    800b14 <strtol+0x40>
+  800b46:	83 c2 02             	add    $0x2,%edx
+  800b49:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b4e:	eb c4                	jmp    800b14 <strtol+0x40>
+  800b50:	0f be c0             	movsbl %al,%eax
+  800b53:	83 e8 30             	sub    $0x30,%eax
+  800b56:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b59:	7d 3a                	jge    800b95 <strtol+0xc1>
+  800b5b:	83 c2 01             	add    $0x1,%edx
+  800b5e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b62:	01 c1                	add    %eax,%ecx
+  800b64:	0f b6 02             	movzbl (%edx),%eax
+  800b67:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b6a:	89 f3                	mov    %esi,%ebx
+  800b6c:	80 fb 09             	cmp    $0x9,%bl
+  800b6f:	76 df                	jbe    800b50 <strtol+0x7c>
+  800b71:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b74:	89 f3                	mov    %esi,%ebx
+  800b76:	80 fb 19             	cmp    $0x19,%bl
+  800b79:	77 08                	ja     800b83 <strtol+0xaf>
+  800b7b:	0f be c0             	movsbl %al,%eax
+  800b7e:	83 e8 57             	sub    $0x57,%eax
+  800b81:	eb d3                	jmp    800b56 <strtol+0x82>
+  800b83:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b86:	89 f3                	mov    %esi,%ebx
+  800b88:	80 fb 19             	cmp    $0x19,%bl
+  800b8b:	77 08                	ja     800b95 <strtol+0xc1>
+  800b8d:	0f be c0             	movsbl %al,%eax
+  800b90:	83 e8 37             	sub    $0x37,%eax
+  800b93:	eb c1                	jmp    800b56 <strtol+0x82>
+  800b95:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b99:	74 05                	je     800ba0 <strtol+0xcc>
+  800b9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b9e:	89 10                	mov    %edx,(%eax)
+  800ba0:	89 c8                	mov    %ecx,%eax
+  800ba2:	f7 d8                	neg    %eax
+  800ba4:	85 ff                	test   %edi,%edi
+  800ba6:	0f 45 c8             	cmovne %eax,%ecx
+  800ba9:	89 c8                	mov    %ecx,%eax
+  800bab:	5b                   	pop    %ebx
+  800bac:	5e                   	pop    %esi
+  800bad:	5f                   	pop    %edi
+  800bae:	5d                   	pop    %ebp
+  800baf:	c3                   	ret
+
+00800bb0 <sys_cputs>:
+  800bb0:	55                   	push   %ebp
+  800bb1:	89 e5                	mov    %esp,%ebp
+  800bb3:	57                   	push   %edi
+  800bb4:	56                   	push   %esi
+  800bb5:	53                   	push   %ebx
+  800bb6:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800bbd:	78 21                	js     800be0 <sys_cputs+0x30>
+  800bbf:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800bc6:	75 2d                	jne    800bf5 <sys_cputs+0x45>
+  800bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd3:	89 c3                	mov    %eax,%ebx
+  800bd5:	89 c7                	mov    %eax,%edi
+  800bd7:	89 c6                	mov    %eax,%esi
+  800bd9:	cd 30                	int    $0x30
+  800bdb:	5b                   	pop    %ebx
+  800bdc:	5e                   	pop    %esi
+  800bdd:	5f                   	pop    %edi
+  800bde:	5d                   	pop    %ebp
+  800bdf:	c3                   	ret
+  800be0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800be5:	0f a2                	cpuid
+  800be7:	c1 ea 0b             	shr    $0xb,%edx
+  800bea:	83 e2 01             	and    $0x1,%edx
+  800bed:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800bf3:	eb ca                	jmp    800bbf <sys_cputs+0xf>
+  800bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c00:	89 c3                	mov    %eax,%ebx
+  800c02:	89 c7                	mov    %eax,%edi
+  800c04:	89 c6                	mov    %eax,%esi
+  800c06:	55                   	push   %ebp
+  800c07:	68 10 0c 80 00       	push   $0x800c10
+  800c0c:	89 e5                	mov    %esp,%ebp
+  800c0e:	0f 34                	sysenter
+  800c10:	83 c4 04             	add    $0x4,%esp
+  800c13:	5d                   	pop    %ebp
+  800c14:	eb c5                	jmp    800bdb <sys_cputs+0x2b>
+
+00800c16 <sys_cgetc>:
+  800c16:	55                   	push   %ebp
+  800c17:	89 e5                	mov    %esp,%ebp
+  800c19:	57                   	push   %edi
+  800c1a:	56                   	push   %esi
+  800c1b:	53                   	push   %ebx
+  800c1c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c23:	78 22                	js     800c47 <sys_cgetc+0x31>
+  800c25:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c2c:	75 2e                	jne    800c5c <sys_cgetc+0x46>
+  800c2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c33:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c38:	89 d1                	mov    %edx,%ecx
+  800c3a:	89 d3                	mov    %edx,%ebx
+  800c3c:	89 d7                	mov    %edx,%edi
+  800c3e:	89 d6                	mov    %edx,%esi
+  800c40:	cd 30                	int    $0x30
+  800c42:	5b                   	pop    %ebx
+  800c43:	5e                   	pop    %esi
+  800c44:	5f                   	pop    %edi
+  800c45:	5d                   	pop    %ebp
+  800c46:	c3                   	ret
+  800c47:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c4c:	0f a2                	cpuid
+  800c4e:	c1 ea 0b             	shr    $0xb,%edx
+  800c51:	83 e2 01             	and    $0x1,%edx
+  800c54:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800c5a:	eb c9                	jmp    800c25 <sys_cgetc+0xf>
+  800c5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c61:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c66:	89 d1                	mov    %edx,%ecx
+  800c68:	89 d3                	mov    %edx,%ebx
+  800c6a:	89 d7                	mov    %edx,%edi
+  800c6c:	89 d6                	mov    %edx,%esi
+  800c6e:	55                   	push   %ebp
+  800c6f:	68 78 0c 80 00       	push   $0x800c78
+  800c74:	89 e5                	mov    %esp,%ebp
+  800c76:	0f 34                	sysenter
+  800c78:	83 c4 04             	add    $0x4,%esp
+  800c7b:	5d                   	pop    %ebp
+  800c7c:	eb c4                	jmp    800c42 <sys_cgetc+0x2c>
+
+00800c7e <sys_env_destroy>:
+  800c7e:	55                   	push   %ebp
+  800c7f:	89 e5                	mov    %esp,%ebp
+  800c81:	57                   	push   %edi
+  800c82:	56                   	push   %esi
+  800c83:	53                   	push   %ebx
+  800c84:	83 ec 0c             	sub    $0xc,%esp
+  800c87:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c8e:	78 2a                	js     800cba <sys_env_destroy+0x3c>
+  800c90:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c97:	75 36                	jne    800ccf <sys_env_destroy+0x51>
+  800c99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c9e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ca3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca6:	89 cb                	mov    %ecx,%ebx
+  800ca8:	89 cf                	mov    %ecx,%edi
+  800caa:	89 ce                	mov    %ecx,%esi
+  800cac:	cd 30                	int    $0x30
+  800cae:	85 c0                	test   %eax,%eax
+  800cb0:	7f 40                	jg     800cf2 <sys_env_destroy+0x74>
+  800cb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb5:	5b                   	pop    %ebx
+  800cb6:	5e                   	pop    %esi
+  800cb7:	5f                   	pop    %edi
+  800cb8:	5d                   	pop    %ebp
+  800cb9:	c3                   	ret
+  800cba:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cbf:	0f a2                	cpuid
+  800cc1:	c1 ea 0b             	shr    $0xb,%edx
+  800cc4:	83 e2 01             	and    $0x1,%edx
+  800cc7:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800ccd:	eb c1                	jmp    800c90 <sys_env_destroy+0x12>
+  800ccf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cd7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cdc:	89 cb                	mov    %ecx,%ebx
+  800cde:	89 cf                	mov    %ecx,%edi
+  800ce0:	89 ce                	mov    %ecx,%esi
+  800ce2:	55                   	push   %ebp
+  800ce3:	68 ec 0c 80 00       	push   $0x800cec
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	0f 34                	sysenter
+  800cec:	83 c4 04             	add    $0x4,%esp
+  800cef:	5d                   	pop    %ebp
+  800cf0:	eb bc                	jmp    800cae <sys_env_destroy+0x30>
+  800cf2:	83 ec 0c             	sub    $0xc,%esp
+  800cf5:	50                   	push   %eax
+  800cf6:	6a 03                	push   $0x3
+  800cf8:	68 e4 1b 80 00       	push   $0x801be4
+  800cfd:	6a 49                	push   $0x49
+  800cff:	68 01 1c 80 00       	push   $0x801c01
+  800d04:	e8 af 09 00 00       	call   8016b8 <_panic>
+
+00800d09 <sys_getenvid>:
+  800d09:	55                   	push   %ebp
+  800d0a:	89 e5                	mov    %esp,%ebp
+  800d0c:	57                   	push   %edi
+  800d0d:	56                   	push   %esi
+  800d0e:	53                   	push   %ebx
+  800d0f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d16:	78 22                	js     800d3a <sys_getenvid+0x31>
+  800d18:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d1f:	75 2e                	jne    800d4f <sys_getenvid+0x46>
+  800d21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d26:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d2b:	89 d1                	mov    %edx,%ecx
+  800d2d:	89 d3                	mov    %edx,%ebx
+  800d2f:	89 d7                	mov    %edx,%edi
+  800d31:	89 d6                	mov    %edx,%esi
+  800d33:	cd 30                	int    $0x30
+  800d35:	5b                   	pop    %ebx
+  800d36:	5e                   	pop    %esi
+  800d37:	5f                   	pop    %edi
+  800d38:	5d                   	pop    %ebp
+  800d39:	c3                   	ret
+  800d3a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d3f:	0f a2                	cpuid
+  800d41:	c1 ea 0b             	shr    $0xb,%edx
+  800d44:	83 e2 01             	and    $0x1,%edx
+  800d47:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800d4d:	eb c9                	jmp    800d18 <sys_getenvid+0xf>
+  800d4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d54:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d59:	89 d1                	mov    %edx,%ecx
+  800d5b:	89 d3                	mov    %edx,%ebx
+  800d5d:	89 d7                	mov    %edx,%edi
+  800d5f:	89 d6                	mov    %edx,%esi
+  800d61:	55                   	push   %ebp
+  800d62:	68 6b 0d 80 00       	push   $0x800d6b
+  800d67:	89 e5                	mov    %esp,%ebp
+  800d69:	0f 34                	sysenter
+  800d6b:	83 c4 04             	add    $0x4,%esp
+  800d6e:	5d                   	pop    %ebp
+  800d6f:	eb c4                	jmp    800d35 <sys_getenvid+0x2c>
+
+00800d71 <sys_yield>:
+  800d71:	55                   	push   %ebp
+  800d72:	89 e5                	mov    %esp,%ebp
+  800d74:	57                   	push   %edi
+  800d75:	56                   	push   %esi
+  800d76:	53                   	push   %ebx
+  800d77:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d7e:	78 22                	js     800da2 <sys_yield+0x31>
+  800d80:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d87:	75 2e                	jne    800db7 <sys_yield+0x46>
+  800d89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d8e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d93:	89 d1                	mov    %edx,%ecx
+  800d95:	89 d3                	mov    %edx,%ebx
+  800d97:	89 d7                	mov    %edx,%edi
+  800d99:	89 d6                	mov    %edx,%esi
+  800d9b:	cd 30                	int    $0x30
+  800d9d:	5b                   	pop    %ebx
+  800d9e:	5e                   	pop    %esi
+  800d9f:	5f                   	pop    %edi
+  800da0:	5d                   	pop    %ebp
+  800da1:	c3                   	ret
+  800da2:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da7:	0f a2                	cpuid
+  800da9:	c1 ea 0b             	shr    $0xb,%edx
+  800dac:	83 e2 01             	and    $0x1,%edx
+  800daf:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800db5:	eb c9                	jmp    800d80 <sys_yield+0xf>
+  800db7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dc1:	89 d1                	mov    %edx,%ecx
+  800dc3:	89 d3                	mov    %edx,%ebx
+  800dc5:	89 d7                	mov    %edx,%edi
+  800dc7:	89 d6                	mov    %edx,%esi
+  800dc9:	55                   	push   %ebp
+  800dca:	68 d3 0d 80 00       	push   $0x800dd3
+  800dcf:	89 e5                	mov    %esp,%ebp
+  800dd1:	0f 34                	sysenter
+  800dd3:	83 c4 04             	add    $0x4,%esp
+  800dd6:	5d                   	pop    %ebp
+  800dd7:	eb c4                	jmp    800d9d <sys_yield+0x2c>
+
+00800dd9 <sys_env_set_cow>:
+  800dd9:	55                   	push   %ebp
+  800dda:	89 e5                	mov    %esp,%ebp
+  800ddc:	57                   	push   %edi
+  800ddd:	56                   	push   %esi
+  800dde:	53                   	push   %ebx
+  800ddf:	83 ec 0c             	sub    $0xc,%esp
+  800de2:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800de9:	78 2b                	js     800e16 <sys_env_set_cow+0x3d>
+  800deb:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800df2:	75 37                	jne    800e2b <sys_env_set_cow+0x52>
+  800df4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800dfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e04:	89 df                	mov    %ebx,%edi
+  800e06:	89 de                	mov    %ebx,%esi
+  800e08:	cd 30                	int    $0x30
+  800e0a:	85 c0                	test   %eax,%eax
+  800e0c:	7f 41                	jg     800e4f <sys_env_set_cow+0x76>
+  800e0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e11:	5b                   	pop    %ebx
+  800e12:	5e                   	pop    %esi
+  800e13:	5f                   	pop    %edi
+  800e14:	5d                   	pop    %ebp
+  800e15:	c3                   	ret
+  800e16:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e1b:	0f a2                	cpuid
+  800e1d:	c1 ea 0b             	shr    $0xb,%edx
+  800e20:	83 e2 01             	and    $0x1,%edx
+  800e23:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800e29:	eb c0                	jmp    800deb <sys_env_set_cow+0x12>
+  800e2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e36:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e3b:	89 df                	mov    %ebx,%edi
+  800e3d:	89 de                	mov    %ebx,%esi
+  800e3f:	55                   	push   %ebp
+  800e40:	68 49 0e 80 00       	push   $0x800e49
+  800e45:	89 e5                	mov    %esp,%ebp
+  800e47:	0f 34                	sysenter
+  800e49:	83 c4 04             	add    $0x4,%esp
+  800e4c:	5d                   	pop    %ebp
+  800e4d:	eb bb                	jmp    800e0a <sys_env_set_cow+0x31>
+  800e4f:	83 ec 0c             	sub    $0xc,%esp
+  800e52:	50                   	push   %eax
+  800e53:	6a 0d                	push   $0xd
+  800e55:	68 e4 1b 80 00       	push   $0x801be4
+  800e5a:	6a 49                	push   $0x49
+  800e5c:	68 01 1c 80 00       	push   $0x801c01
+  800e61:	e8 52 08 00 00       	call   8016b8 <_panic>
+
+00800e66 <sys_env_set_quota>:
+  800e66:	55                   	push   %ebp
+  800e67:	89 e5                	mov    %esp,%ebp
+  800e69:	57                   	push   %edi
+  800e6a:	56                   	push   %esi
+  800e6b:	53                   	push   %ebx
+  800e6c:	83 ec 0c             	sub    $0xc,%esp
+  800e6f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e76:	78 2b                	js     800ea3 <sys_env_set_quota+0x3d>
+  800e78:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e7f:	75 37                	jne    800eb8 <sys_env_set_quota+0x52>
+  800e81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e86:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e91:	89 df                	mov    %ebx,%edi
+  800e93:	89 de                	mov    %ebx,%esi
+  800e95:	cd 30                	int    $0x30
+  800e97:	85 c0                	test   %eax,%eax
+  800e99:	7f 41                	jg     800edc <sys_env_set_quota+0x76>
+  800e9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9e:	5b                   	pop    %ebx
+  800e9f:	5e                   	pop    %esi
+  800ea0:	5f                   	pop    %edi
+  800ea1:	5d                   	pop    %ebp
+  800ea2:	c3                   	ret
+  800ea3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ea8:	0f a2                	cpuid
+  800eaa:	c1 ea 0b             	shr    $0xb,%edx
+  800ead:	83 e2 01             	and    $0x1,%edx
+  800eb0:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800eb6:	eb c0                	jmp    800e78 <sys_env_set_quota+0x12>
+  800eb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ec8:	89 df                	mov    %ebx,%edi
+  800eca:	89 de                	mov    %ebx,%esi
+  800ecc:	55                   	push   %ebp
+  800ecd:	68 d6 0e 80 00       	push   $0x800ed6
+  800ed2:	89 e5                	mov    %esp,%ebp
+  800ed4:	0f 34                	sysenter
+  800ed6:	83 c4 04             	add    $0x4,%esp
+  800ed9:	5d                   	pop    %ebp
+  800eda:	eb bb                	jmp    800e97 <sys_env_set_quota+0x31>
+  800edc:	83 ec 0c             	sub    $0xc,%esp
+  800edf:	50                   	push   %eax
+  800ee0:	6a 0f                	push   $0xf
+  800ee2:	68 e4 1b 80 00       	push   $0x801be4
+  800ee7:	6a 49                	push   $0x49
+  800ee9:	68 01 1c 80 00       	push   $0x801c01
+  800eee:	e8 c5 07 00 00       	call   8016b8 <_panic>
+
+00800ef3 <sys_page_alloc>:
+  800ef3:	55                   	push   %ebp
+  800ef4:	89 e5                	mov    %esp,%ebp
+  800ef6:	57                   	push   %edi
+  800ef7:	56                   	push   %esi
+  800ef8:	53                   	push   %ebx
+  800ef9:	83 ec 0c             	sub    $0xc,%esp
+  800efc:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f03:	78 2c                	js     800f31 <sys_page_alloc+0x3e>
+  800f05:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f0c:	75 38                	jne    800f46 <sys_page_alloc+0x53>
+  800f0e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f13:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f21:	89 f7                	mov    %esi,%edi
+  800f23:	cd 30                	int    $0x30
+  800f25:	85 c0                	test   %eax,%eax
+  800f27:	7f 42                	jg     800f6b <sys_page_alloc+0x78>
+  800f29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2c:	5b                   	pop    %ebx
+  800f2d:	5e                   	pop    %esi
+  800f2e:	5f                   	pop    %edi
+  800f2f:	5d                   	pop    %ebp
+  800f30:	c3                   	ret
+  800f31:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f36:	0f a2                	cpuid
+  800f38:	c1 ea 0b             	shr    $0xb,%edx
+  800f3b:	83 e2 01             	and    $0x1,%edx
+  800f3e:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800f44:	eb bf                	jmp    800f05 <sys_page_alloc+0x12>
+  800f46:	be 00 00 00 00       	mov    $0x0,%esi
+  800f4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f51:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f56:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f59:	89 f7                	mov    %esi,%edi
+  800f5b:	55                   	push   %ebp
+  800f5c:	68 65 0f 80 00       	push   $0x800f65
+  800f61:	89 e5                	mov    %esp,%ebp
+  800f63:	0f 34                	sysenter
+  800f65:	83 c4 04             	add    $0x4,%esp
+  800f68:	5d                   	pop    %ebp
+  800f69:	eb ba                	jmp    800f25 <sys_page_alloc+0x32>
+  800f6b:	83 ec 0c             	sub    $0xc,%esp
+  800f6e:	50                   	push   %eax
+  800f6f:	6a 04                	push   $0x4
+  800f71:	68 e4 1b 80 00       	push   $0x801be4
+  800f76:	6a 49                	push   $0x49
+  800f78:	68 01 1c 80 00       	push   $0x801c01
+  800f7d:	e8 36 07 00 00       	call   8016b8 <_panic>
+
+00800f82 <sys_page_map>:
+  800f82:	55                   	push   %ebp
+  800f83:	89 e5                	mov    %esp,%ebp
+  800f85:	57                   	push   %edi
+  800f86:	56                   	push   %esi
+  800f87:	53                   	push   %ebx
+  800f88:	83 ec 0c             	sub    $0xc,%esp
+  800f8b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f92:	78 2b                	js     800fbf <sys_page_map+0x3d>
+  800f94:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f9b:	75 37                	jne    800fd4 <sys_page_map+0x52>
+  800f9d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fa2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fae:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fb1:	cd 30                	int    $0x30
+  800fb3:	85 c0                	test   %eax,%eax
+  800fb5:	7f 41                	jg     800ff8 <sys_page_map+0x76>
+  800fb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fba:	5b                   	pop    %ebx
+  800fbb:	5e                   	pop    %esi
+  800fbc:	5f                   	pop    %edi
+  800fbd:	5d                   	pop    %ebp
+  800fbe:	c3                   	ret
+  800fbf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fc4:	0f a2                	cpuid
+  800fc6:	c1 ea 0b             	shr    $0xb,%edx
+  800fc9:	83 e2 01             	and    $0x1,%edx
+  800fcc:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800fd2:	eb c0                	jmp    800f94 <sys_page_map+0x12>
+  800fd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fda:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fdf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fe5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fe8:	55                   	push   %ebp
+  800fe9:	68 f2 0f 80 00       	push   $0x800ff2
+  800fee:	89 e5                	mov    %esp,%ebp
+  800ff0:	0f 34                	sysenter
+  800ff2:	83 c4 04             	add    $0x4,%esp
+  800ff5:	5d                   	pop    %ebp
+  800ff6:	eb bb                	jmp    800fb3 <sys_page_map+0x31>
+  800ff8:	83 ec 0c             	sub    $0xc,%esp
+  800ffb:	50                   	push   %eax
+  800ffc:	6a 05                	push   $0x5
+  800ffe:	68 e4 1b 80 00       	push   $0x801be4
+  801003:	6a 49                	push   $0x49
+  801005:	68 01 1c 80 00       	push   $0x801c01
+  80100a:	e8 a9 06 00 00       	call   8016b8 <_panic>
+
+0080100f <sys_page_unmap>:
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	57                   	push   %edi
+  801013:	56                   	push   %esi
+  801014:	53                   	push   %ebx
+  801015:	83 ec 0c             	sub    $0xc,%esp
+  801018:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80101f:	78 2b                	js     80104c <sys_page_unmap+0x3d>
+  801021:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801028:	75 37                	jne    801061 <sys_page_unmap+0x52>
+  80102a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801034:	8b 55 08             	mov    0x8(%ebp),%edx
+  801037:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103a:	89 df                	mov    %ebx,%edi
+  80103c:	89 de                	mov    %ebx,%esi
+  80103e:	cd 30                	int    $0x30
+  801040:	85 c0                	test   %eax,%eax
+  801042:	7f 41                	jg     801085 <sys_page_unmap+0x76>
+  801044:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801047:	5b                   	pop    %ebx
+  801048:	5e                   	pop    %esi
+  801049:	5f                   	pop    %edi
+  80104a:	5d                   	pop    %ebp
+  80104b:	c3                   	ret
+  80104c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801051:	0f a2                	cpuid
+  801053:	c1 ea 0b             	shr    $0xb,%edx
+  801056:	83 e2 01             	and    $0x1,%edx
+  801059:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80105f:	eb c0                	jmp    801021 <sys_page_unmap+0x12>
+  801061:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801066:	8b 55 08             	mov    0x8(%ebp),%edx
+  801069:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801071:	89 df                	mov    %ebx,%edi
+  801073:	89 de                	mov    %ebx,%esi
+  801075:	55                   	push   %ebp
+  801076:	68 7f 10 80 00       	push   $0x80107f
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	0f 34                	sysenter
+  80107f:	83 c4 04             	add    $0x4,%esp
+  801082:	5d                   	pop    %ebp
+  801083:	eb bb                	jmp    801040 <sys_page_unmap+0x31>
+  801085:	83 ec 0c             	sub    $0xc,%esp
+  801088:	50                   	push   %eax
+  801089:	6a 06                	push   $0x6
+  80108b:	68 e4 1b 80 00       	push   $0x801be4
+  801090:	6a 49                	push   $0x49
+  801092:	68 01 1c 80 00       	push   $0x801c01
+  801097:	e8 1c 06 00 00       	call   8016b8 <_panic>
+
+0080109c <sys_page_reuse>:
+  80109c:	55                   	push   %ebp
+  80109d:	89 e5                	mov    %esp,%ebp
+  80109f:	57                   	push   %edi
+  8010a0:	56                   	push   %esi
+  8010a1:	53                   	push   %ebx
+  8010a2:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010a9:	78 24                	js     8010cf <sys_page_reuse+0x33>
+  8010ab:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010b2:	75 30                	jne    8010e4 <sys_page_reuse+0x48>
+  8010b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c4:	89 df                	mov    %ebx,%edi
+  8010c6:	89 de                	mov    %ebx,%esi
+  8010c8:	cd 30                	int    $0x30
+  8010ca:	5b                   	pop    %ebx
+  8010cb:	5e                   	pop    %esi
+  8010cc:	5f                   	pop    %edi
+  8010cd:	5d                   	pop    %ebp
+  8010ce:	c3                   	ret
+  8010cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010d4:	0f a2                	cpuid
+  8010d6:	c1 ea 0b             	shr    $0xb,%edx
+  8010d9:	83 e2 01             	and    $0x1,%edx
+  8010dc:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8010e2:	eb c7                	jmp    8010ab <sys_page_reuse+0xf>
+  8010e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ef:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010f4:	89 df                	mov    %ebx,%edi
+  8010f6:	89 de                	mov    %ebx,%esi
+  8010f8:	55                   	push   %ebp
+  8010f9:	68 02 11 80 00       	push   $0x801102
+  8010fe:	89 e5                	mov    %esp,%ebp
+  801100:	0f 34                	sysenter
+  801102:	83 c4 04             	add    $0x4,%esp
+  801105:	5d                   	pop    %ebp
+  801106:	eb c2                	jmp    8010ca <sys_page_reuse+0x2e>
+
+00801108 <sys_env_set_status>:
+  801108:	55                   	push   %ebp
+  801109:	89 e5                	mov    %esp,%ebp
+  80110b:	57                   	push   %edi
+  80110c:	56                   	push   %esi
+  80110d:	53                   	push   %ebx
+  80110e:	83 ec 0c             	sub    $0xc,%esp
+  801111:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801118:	78 2b                	js     801145 <sys_env_set_status+0x3d>
+  80111a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801121:	75 37                	jne    80115a <sys_env_set_status+0x52>
+  801123:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801128:	b8 08 00 00 00       	mov    $0x8,%eax
+  80112d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801130:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801133:	89 df                	mov    %ebx,%edi
+  801135:	89 de                	mov    %ebx,%esi
+  801137:	cd 30                	int    $0x30
+  801139:	85 c0                	test   %eax,%eax
+  80113b:	7f 41                	jg     80117e <sys_env_set_status+0x76>
+  80113d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801140:	5b                   	pop    %ebx
+  801141:	5e                   	pop    %esi
+  801142:	5f                   	pop    %edi
+  801143:	5d                   	pop    %ebp
+  801144:	c3                   	ret
+  801145:	b8 01 00 00 00       	mov    $0x1,%eax
+  80114a:	0f a2                	cpuid
+  80114c:	c1 ea 0b             	shr    $0xb,%edx
+  80114f:	83 e2 01             	and    $0x1,%edx
+  801152:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801158:	eb c0                	jmp    80111a <sys_env_set_status+0x12>
+  80115a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801162:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801165:	b8 08 00 00 00       	mov    $0x8,%eax
+  80116a:	89 df                	mov    %ebx,%edi
+  80116c:	89 de                	mov    %ebx,%esi
+  80116e:	55                   	push   %ebp
+  80116f:	68 78 11 80 00       	push   $0x801178
+  801174:	89 e5                	mov    %esp,%ebp
+  801176:	0f 34                	sysenter
+  801178:	83 c4 04             	add    $0x4,%esp
+  80117b:	5d                   	pop    %ebp
+  80117c:	eb bb                	jmp    801139 <sys_env_set_status+0x31>
+  80117e:	83 ec 0c             	sub    $0xc,%esp
+  801181:	50                   	push   %eax
+  801182:	6a 08                	push   $0x8
+  801184:	68 e4 1b 80 00       	push   $0x801be4
+  801189:	6a 49                	push   $0x49
+  80118b:	68 01 1c 80 00       	push   $0x801c01
+  801190:	e8 23 05 00 00       	call   8016b8 <_panic>
+
+00801195 <sys_env_set_pgfault_upcall>:
+  801195:	55                   	push   %ebp
+  801196:	89 e5                	mov    %esp,%ebp
+  801198:	57                   	push   %edi
+  801199:	56                   	push   %esi
+  80119a:	53                   	push   %ebx
+  80119b:	83 ec 0c             	sub    $0xc,%esp
+  80119e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011a5:	78 2b                	js     8011d2 <sys_env_set_pgfault_upcall+0x3d>
+  8011a7:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011ae:	75 37                	jne    8011e7 <sys_env_set_pgfault_upcall+0x52>
+  8011b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c0:	89 df                	mov    %ebx,%edi
+  8011c2:	89 de                	mov    %ebx,%esi
+  8011c4:	cd 30                	int    $0x30
+  8011c6:	85 c0                	test   %eax,%eax
+  8011c8:	7f 41                	jg     80120b <sys_env_set_pgfault_upcall+0x76>
+  8011ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011cd:	5b                   	pop    %ebx
+  8011ce:	5e                   	pop    %esi
+  8011cf:	5f                   	pop    %edi
+  8011d0:	5d                   	pop    %ebp
+  8011d1:	c3                   	ret
+  8011d2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011d7:	0f a2                	cpuid
+  8011d9:	c1 ea 0b             	shr    $0xb,%edx
+  8011dc:	83 e2 01             	and    $0x1,%edx
+  8011df:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8011e5:	eb c0                	jmp    8011a7 <sys_env_set_pgfault_upcall+0x12>
+  8011e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011f7:	89 df                	mov    %ebx,%edi
+  8011f9:	89 de                	mov    %ebx,%esi
+  8011fb:	55                   	push   %ebp
+  8011fc:	68 05 12 80 00       	push   $0x801205
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	0f 34                	sysenter
+  801205:	83 c4 04             	add    $0x4,%esp
+  801208:	5d                   	pop    %ebp
+  801209:	eb bb                	jmp    8011c6 <sys_env_set_pgfault_upcall+0x31>
+  80120b:	83 ec 0c             	sub    $0xc,%esp
+  80120e:	50                   	push   %eax
+  80120f:	6a 09                	push   $0x9
+  801211:	68 e4 1b 80 00       	push   $0x801be4
+  801216:	6a 49                	push   $0x49
+  801218:	68 01 1c 80 00       	push   $0x801c01
+  80121d:	e8 96 04 00 00       	call   8016b8 <_panic>
+
+00801222 <sys_env_set_trace>:
+  801222:	55                   	push   %ebp
+  801223:	89 e5                	mov    %esp,%ebp
+  801225:	57                   	push   %edi
+  801226:	56                   	push   %esi
+  801227:	53                   	push   %ebx
+  801228:	83 ec 0c             	sub    $0xc,%esp
+  80122b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801232:	78 2b                	js     80125f <sys_env_set_trace+0x3d>
+  801234:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80123b:	75 37                	jne    801274 <sys_env_set_trace+0x52>
+  80123d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801242:	b8 12 00 00 00       	mov    $0x12,%eax
+  801247:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124d:	89 df                	mov    %ebx,%edi
+  80124f:	89 de                	mov    %ebx,%esi
+  801251:	cd 30                	int    $0x30
+  801253:	85 c0                	test   %eax,%eax
+  801255:	7f 41                	jg     801298 <sys_env_set_trace+0x76>
+  801257:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125a:	5b                   	pop    %ebx
+  80125b:	5e                   	pop    %esi
+  80125c:	5f                   	pop    %edi
+  80125d:	5d                   	pop    %ebp
+  80125e:	c3                   	ret
+  80125f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801264:	0f a2                	cpuid
+  801266:	c1 ea 0b             	shr    $0xb,%edx
+  801269:	83 e2 01             	and    $0x1,%edx
+  80126c:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801272:	eb c0                	jmp    801234 <sys_env_set_trace+0x12>
+  801274:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801279:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801284:	89 df                	mov    %ebx,%edi
+  801286:	89 de                	mov    %ebx,%esi
+  801288:	55                   	push   %ebp
+  801289:	68 92 12 80 00       	push   $0x801292
+  80128e:	89 e5                	mov    %esp,%ebp
+  801290:	0f 34                	sysenter
+  801292:	83 c4 04             	add    $0x4,%esp
+  801295:	5d                   	pop    %ebp
+  801296:	eb bb                	jmp    801253 <sys_env_set_trace+0x31>
+  801298:	83 ec 0c             	sub    $0xc,%esp
+  80129b:	50                   	push   %eax
+  80129c:	6a 12                	push   $0x12
+  80129e:	68 e4 1b 80 00       	push   $0x801be4
+  8012a3:	6a 49                	push   $0x49
+  8012a5:	68 01 1c 80 00       	push   $0x801c01
+  8012aa:	e8 09 04 00 00       	call   8016b8 <_panic>
+
+008012af <sys_env_set_rdpmc>:
+  8012af:	55                   	push   %ebp
+  8012b0:	89 e5                	mov    %esp,%ebp
+  8012b2:	57                   	push   %edi
+  8012b3:	56                   	push   %esi
+  8012b4:	53                   	push   %ebx
+  8012b5:	83 ec 0c             	sub    $0xc,%esp
+  8012b8:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012bf:	78 2b                	js     8012ec <sys_env_set_rdpmc+0x3d>
+  8012c1:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012c8:	75 37                	jne    801301 <sys_env_set_rdpmc+0x52>
+  8012ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cf:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012da:	89 df                	mov    %ebx,%edi
+  8012dc:	89 de                	mov    %ebx,%esi
+  8012de:	cd 30                	int    $0x30
+  8012e0:	85 c0                	test   %eax,%eax
+  8012e2:	7f 41                	jg     801325 <sys_env_set_rdpmc+0x76>
+  8012e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e7:	5b                   	pop    %ebx
+  8012e8:	5e                   	pop    %esi
+  8012e9:	5f                   	pop    %edi
+  8012ea:	5d                   	pop    %ebp
+  8012eb:	c3                   	ret
+  8012ec:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012f1:	0f a2                	cpuid
+  8012f3:	c1 ea 0b             	shr    $0xb,%edx
+  8012f6:	83 e2 01             	and    $0x1,%edx
+  8012f9:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8012ff:	eb c0                	jmp    8012c1 <sys_env_set_rdpmc+0x12>
+  801301:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801306:	8b 55 08             	mov    0x8(%ebp),%edx
+  801309:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130c:	b8 13 00 00 00       	mov    $0x13,%eax
+  801311:	89 df                	mov    %ebx,%edi
+  801313:	89 de                	mov    %ebx,%esi
+  801315:	55                   	push   %ebp
+  801316:	68 1f 13 80 00       	push   $0x80131f
+  80131b:	89 e5                	mov    %esp,%ebp
+  80131d:	0f 34                	sysenter
+  80131f:	83 c4 04             	add    $0x4,%esp
+  801322:	5d                   	pop    %ebp
+  801323:	eb bb                	jmp    8012e0 <sys_env_set_rdpmc+0x31>
+  801325:	83 ec 0c             	sub    $0xc,%esp
+  801328:	50                   	push   %eax
+  801329:	6a 13                	push   $0x13
+  80132b:	68 e4 1b 80 00       	push   $0x801be4
+  801330:	6a 49                	push   $0x49
+  801332:	68 01 1c 80 00       	push   $0x801c01
+  801337:	e8 7c 03 00 00       	call   8016b8 <_panic>
+
+0080133c <sys_ring_setup>:
+  80133c:	55                   	push   %ebp
+  80133d:	89 e5                	mov    %esp,%ebp
+  80133f:	57                   	push   %edi
+  801340:	56                   	push   %esi
+  801341:	53                   	push   %ebx
+  801342:	83 ec 0c             	sub    $0xc,%esp
+  801345:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80134c:	78 29                	js     801377 <sys_ring_setup+0x3b>
+  80134e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801355:	75 35                	jne    80138c <sys_ring_setup+0x50>
+  801357:	ba 00 00 00 00       	mov    $0x0,%edx
+  80135c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801361:	89 d1                	mov    %edx,%ecx
+  801363:	89 d3                	mov    %edx,%ebx
+  801365:	89 d7                	mov    %edx,%edi
+  801367:	89 d6                	mov    %edx,%esi
+  801369:	cd 30                	int    $0x30
+  80136b:	85 c0                	test   %eax,%eax
+  80136d:	7f 3f                	jg     8013ae <sys_ring_setup+0x72>
+  80136f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801372:	5b                   	pop    %ebx
+  801373:	5e                   	pop    %esi
+  801374:	5f                   	pop    %edi
+  801375:	5d                   	pop    %ebp
+  801376:	c3                   	ret
+  801377:	b8 01 00 00 00       	mov    $0x1,%eax
+  80137c:	0f a2                	cpuid
+  80137e:	c1 ea 0b             	shr    $0xb,%edx
+  801381:	83 e2 01             	and    $0x1,%edx
+  801384:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80138a:	eb c2                	jmp    80134e <sys_ring_setup+0x12>
+  80138c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801391:	b8 10 00 00 00       	mov    $0x10,%eax
+  801396:	89 d1                	mov    %edx,%ecx
+  801398:	89 d3                	mov    %edx,%ebx
+  80139a:	89 d7                	mov    %edx,%edi
+  80139c:	89 d6                	mov    %edx,%esi
+  80139e:	55                   	push   %ebp
+  80139f:	68 a8 13 80 00       	push   $0x8013a8
+  8013a4:	89 e5                	mov    %esp,%ebp
+  8013a6:	0f 34                	sysenter
+  8013a8:	83 c4 04             	add    $0x4,%esp
+  8013ab:	5d                   	pop    %ebp
+  8013ac:	eb bd                	jmp    80136b <sys_ring_setup+0x2f>
+  8013ae:	83 ec 0c             	sub    $0xc,%esp
+  8013b1:	50                   	push   %eax
+  8013b2:	6a 10                	push   $0x10
+  8013b4:	68 e4 1b 80 00       	push   $0x801be4
+  8013b9:	6a 49                	push   $0x49
+  8013bb:	68 01 1c 80 00       	push   $0x801c01
+  8013c0:	e8 f3 02 00 00       	call   8016b8 <_panic>
+
+008013c5 <sys_ring_enter>:
+  8013c5:	55                   	push   %ebp
+  8013c6:	89 e5                	mov    %esp,%ebp
+  8013c8:	57                   	push   %edi
+  8013c9:	56                   	push   %esi
+  8013ca:	53                   	push   %ebx
+  8013cb:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8013d2:	78 22                	js     8013f6 <sys_ring_enter+0x31>
+  8013d4:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8013db:	75 2e                	jne    80140b <sys_ring_enter+0x46>
+  8013dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e2:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013e7:	89 d1                	mov    %edx,%ecx
+  8013e9:	89 d3                	mov    %edx,%ebx
+  8013eb:	89 d7                	mov    %edx,%edi
+  8013ed:	89 d6                	mov    %edx,%esi
+  8013ef:	cd 30                	int    $0x30
+  8013f1:	5b                   	pop    %ebx
+  8013f2:	5e                   	pop    %esi
+  8013f3:	5f                   	pop    %edi
+  8013f4:	5d                   	pop    %ebp
+  8013f5:	c3                   	ret
+  8013f6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013fb:	0f a2                	cpuid
+  8013fd:	c1 ea 0b             	shr    $0xb,%edx
+  801400:	83 e2 01             	and    $0x1,%edx
+  801403:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801409:	eb c9                	jmp    8013d4 <sys_ring_enter+0xf>
+  80140b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801410:	b8 11 00 00 00       	mov    $0x11,%eax
+  801415:	89 d1                	mov    %edx,%ecx
+  801417:	89 d3                	mov    %edx,%ebx
+  801419:	89 d7                	mov    %edx,%edi
+  80141b:	89 d6                	mov    %edx,%esi
+  80141d:	55                   	push   %ebp
+  80141e:	68 27 14 80 00       	push   $0x801427
+  801423:	89 e5                	mov    %esp,%ebp
+  801425:	0f 34                	sysenter
+  801427:	83 c4 04             	add    $0x4,%esp
+  80142a:	5d                   	pop    %ebp
+  80142b:	eb c4                	jmp    8013f1 <sys_ring_enter+0x2c>
+
+0080142d <sys_ipc_try_send>:
+  80142d:	55                   	push   %ebp
+  80142e:	89 e5                	mov    %esp,%ebp
+  801430:	57                   	push   %edi
+  801431:	56                   	push   %esi
+  801432:	53                   	push   %ebx
+  801433:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80143a:	78 26                	js     801462 <sys_ipc_try_send+0x35>
+  80143c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801443:	75 32                	jne    801477 <sys_ipc_try_send+0x4a>
+  801445:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80144a:	be 00 00 00 00       	mov    $0x0,%esi
+  80144f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801452:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801455:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801458:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80145b:	cd 30                	int    $0x30
+  80145d:	5b                   	pop    %ebx
+  80145e:	5e                   	pop    %esi
+  80145f:	5f                   	pop    %edi
+  801460:	5d                   	pop    %ebp
+  801461:	c3                   	ret
+  801462:	b8 01 00 00 00       	mov    $0x1,%eax
+  801467:	0f a2                	cpuid
+  801469:	c1 ea 0b             	shr    $0xb,%edx
+  80146c:	83 e2 01             	and    $0x1,%edx
+  80146f:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801475:	eb c5                	jmp    80143c <sys_ipc_try_send+0xf>
+  801477:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801482:	be 00 00 00 00       	mov    $0x0,%esi
+  801487:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80148a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80148d:	55                   	push   %ebp
+  80148e:	68 97 14 80 00       	push   $0x801497
+  801493:	89 e5                	mov    %esp,%ebp
+  801495:	0f 34                	sysenter
+  801497:	83 c4 04             	add    $0x4,%esp
+  80149a:	5d                   	pop    %ebp
+  80149b:	eb c0                	jmp    80145d <sys_ipc_try_send+0x30>
+
+0080149d <sys_ipc_recv>:
+  80149d:	55                   	push   %ebp
+  80149e:	89 e5                	mov    %esp,%ebp
+  8014a0:	57                   	push   %edi
+  8014a1:	56                   	push   %esi
+  8014a2:	53                   	push   %ebx
+  8014a3:	83 ec 0c             	sub    $0xc,%esp
+  8014a6:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014ad:	78 2a                	js     8014d9 <sys_ipc_recv+0x3c>
+  8014af:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014b6:	75 36                	jne    8014ee <sys_ipc_recv+0x51>
+  8014b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c5:	89 cb                	mov    %ecx,%ebx
+  8014c7:	89 cf                	mov    %ecx,%edi
+  8014c9:	89 ce                	mov    %ecx,%esi
+  8014cb:	cd 30                	int    $0x30
+  8014cd:	85 c0                	test   %eax,%eax
+  8014cf:	7f 40                	jg     801511 <sys_ipc_recv+0x74>
+  8014d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d4:	5b                   	pop    %ebx
+  8014d5:	5e                   	pop    %esi
+  8014d6:	5f                   	pop    %edi
+  8014d7:	5d                   	pop    %ebp
+  8014d8:	c3                   	ret
+  8014d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014de:	0f a2                	cpuid
+  8014e0:	c1 ea 0b             	shr    $0xb,%edx
+  8014e3:	83 e2 01             	and    $0x1,%edx
+  8014e6:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8014ec:	eb c1                	jmp    8014af <sys_ipc_recv+0x12>
+  8014ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014f6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014fb:	89 cb                	mov    %ecx,%ebx
+  8014fd:	89 cf                	mov    %ecx,%edi
+  8014ff:	89 ce                	mov    %ecx,%esi
+  801501:	55                   	push   %ebp
+  801502:	68 0b 15 80 00       	push   $0x80150b
+  801507:	89 e5                	mov    %esp,%ebp
+  801509:	0f 34                	sysenter
+  80150b:	83 c4 04             	add    $0x4,%esp
+  80150e:	5d                   	pop    %ebp
+  80150f:	eb bc                	jmp    8014cd <sys_ipc_recv+0x30>
+  801511:	83 ec 0c             	sub    $0xc,%esp
+  801514:	50                   	push   %eax
+  801515:	6a 0c                	push   $0xc
+  801517:	68 e4 1b 80 00       	push   $0x801be4
+  80151c:	6a 49                	push   $0x49
+  80151e:	68 01 1c 80 00       	push   $0x801c01
+  801523:	e8 90 01 00 00       	call   8016b8 <_panic>
+
+00801528 <uinfo_envid>:
+  801528:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  80152d:	c3                   	ret
+
+0080152e <uinfo_cpunum>:
+  80152e:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  801533:	c3                   	ret
+
+00801534 <uinfo_ticks>:
+  801534:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  801539:	c3                   	ret
+
+0080153a <uinfo_nsec>:
+  80153a:	55                   	push   %ebp
+  80153b:	89 e5                	mov    %esp,%ebp
+  80153d:	57                   	push   %edi
+  80153e:	56                   	push   %esi
+  80153f:	53                   	push   %ebx
+  801540:	83 ec 1c             	sub    $0x1c,%esp
+  801543:	0f 31                	rdtsc
+  801545:	89 c6                	mov    %eax,%esi
+  801547:	89 d7                	mov    %edx,%edi
+  801549:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  80154f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801554:	ba 00 00 00 00       	mov    $0x0,%edx
+  801559:	85 c9                	test   %ecx,%ecx
+  80155b:	74 5c                	je     8015b9 <uinfo_nsec+0x7f>
+  80155d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801562:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801565:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801568:	52                   	push   %edx
+  801569:	51                   	push   %ecx
+  80156a:	57                   	push   %edi
+  80156b:	56                   	push   %esi
+  80156c:	e8 6a 02 00 00       	call   8017db <__umoddi3>
+  801571:	83 c4 10             	add    $0x10,%esp
+  801574:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  80157a:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  80157f:	f7 e3                	mul    %ebx
+  801581:	01 ca                	add    %ecx,%edx
+  801583:	ff 75 e4             	push   -0x1c(%ebp)
+  801586:	ff 75 e0             	push   -0x20(%ebp)
+  801589:	52                   	push   %edx
+  80158a:	50                   	push   %eax
+  80158b:	e8 73 01 00 00       	call   801703 <__udivdi3>
+  801590:	83 c4 10             	add    $0x10,%esp
+  801593:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801596:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801599:	ff 75 e4             	push   -0x1c(%ebp)
+  80159c:	ff 75 e0             	push   -0x20(%ebp)
+  80159f:	57                   	push   %edi
+  8015a0:	56                   	push   %esi
+  8015a1:	e8 5d 01 00 00       	call   801703 <__udivdi3>
+  8015a6:	83 c4 10             	add    $0x10,%esp
+  8015a9:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  8015af:	f7 e3                	mul    %ebx
+  8015b1:	01 ca                	add    %ecx,%edx
+  8015b3:	03 45 d8             	add    -0x28(%ebp),%eax
+  8015b6:	13 55 dc             	adc    -0x24(%ebp),%edx
+  8015b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015bc:	5b                   	pop    %ebx
+  8015bd:	5e                   	pop    %esi
+  8015be:	5f                   	pop    %edi
+  8015bf:	5d                   	pop    %ebp
+  8015c0:	c3                   	ret
+
+008015c1 <bflush>:
+  8015c1:	a1 40 20 80 00       	mov    0x802040,%eax
+  8015c6:	85 c0                	test   %eax,%eax
+  8015c8:	75 01                	jne    8015cb <bflush+0xa>
+  8015ca:	c3                   	ret
+  8015cb:	55                   	push   %ebp
+  8015cc:	89 e5                	mov    %esp,%ebp
+  8015ce:	83 ec 10             	sub    $0x10,%esp
+  8015d1:	50                   	push   %eax
+  8015d2:	68 44 20 80 00       	push   $0x802044
+  8015d7:	e8 d4 f5 ff ff       	call   800bb0 <sys_cputs>
+  8015dc:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  8015e3:	00 00 00 
+  8015e6:	83 c4 10             	add    $0x10,%esp
+  8015e9:	c9                   	leave
+  8015ea:	c3                   	ret
+
+008015eb <bputch>:
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	53                   	push   %ebx
+  8015ef:	83 ec 04             	sub    $0x4,%esp
+  8015f2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8015f5:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  8015fb:	8d 42 01             	lea    0x1(%edx),%eax
+  8015fe:	a3 40 20 80 00       	mov    %eax,0x802040
+  801603:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801606:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  80160c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801611:	77 08                	ja     80161b <bputch+0x30>
+  801613:	83 03 01             	addl   $0x1,(%ebx)
+  801616:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801619:	c9                   	leave
+  80161a:	c3                   	ret
+  80161b:	e8 a1 ff ff ff       	call   8015c1 <bflush>
+  801620:	eb f1                	jmp    801613 <bputch+0x28>
+
+00801622 <vbprintf>:
+  801622:	55                   	push   %ebp
+  801623:	89 e5                	mov    %esp,%ebp
+  801625:	83 ec 18             	sub    $0x18,%esp
+  801628:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  80162f:	ff 75 0c             	push   0xc(%ebp)
+  801632:	ff 75 08             	push   0x8(%ebp)
+  801635:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801638:	50                   	push   %eax
+  801639:	68 eb 15 80 00       	push   $0x8015eb
+  80163e:	e8 00 ec ff ff       	call   800243 <vprintfmt>
+  801643:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801646:	c9                   	leave
+  801647:	c3                   	ret
+
+00801648 <bprintf>:
+  801648:	55                   	push   %ebp
+  801649:	89 e5                	mov    %esp,%ebp
+  80164b:	83 ec 10             	sub    $0x10,%esp
+  80164e:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801651:	50                   	push   %eax
+  801652:	ff 75 08             	push   0x8(%ebp)
+  801655:	e8 c8 ff ff ff       	call   801622 <vbprintf>
+  80165a:	c9                   	leave
+  80165b:	c3                   	ret
+
+0080165c <bwrite>:
+  80165c:	55                   	push   %ebp
+  80165d:	89 e5                	mov    %esp,%ebp
+  80165f:	53                   	push   %ebx
+  801660:	83 ec 04             	sub    $0x4,%esp
+  801663:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801666:	89 d8                	mov    %ebx,%eax
+  801668:	03 05 40 20 80 00    	add    0x802040,%eax
+  80166e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801673:	76 0d                	jbe    801682 <bwrite+0x26>
+  801675:	e8 47 ff ff ff       	call   8015c1 <bflush>
+  80167a:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801680:	77 25                	ja     8016a7 <bwrite+0x4b>
+  801682:	83 ec 04             	sub    $0x4,%esp
+  801685:	53                   	push   %ebx
+  801686:	ff 75 08             	push   0x8(%ebp)
+  801689:	a1 40 20 80 00       	mov    0x802040,%eax
+  80168e:	05 44 20 80 00       	add    $0x802044,%eax
+  801693:	50                   	push   %eax
+  801694:	e8 15 f3 ff ff       	call   8009ae <memcpy>
+  801699:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  80169f:	83 c4 10             	add    $0x10,%esp
+  8016a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016a5:	c9                   	leave
+  8016a6:	c3                   	ret
+  8016a7:	83 ec 08             	sub    $0x8,%esp
+  8016aa:	53                   	push   %ebx
+  8016ab:	ff 75 08             	push   0x8(%ebp)
+  8016ae:	e8 fd f4 ff ff       	call   800bb0 <sys_cputs>
+  8016b3:	83 c4 10             	add    $0x10,%esp
+  8016b6:	eb ea                	jmp    8016a2 <bwrite+0x46>
+
+008016b8 <_panic>:
+  8016b8:	55                   	push   %ebp
+  8016b9:	89 e5                	mov    %esp,%ebp
+  8016bb:	56                   	push   %esi
+  8016bc:	53                   	push   %ebx
+  8016bd:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8016c0:	e8 fc fe ff ff       	call   8015c1 <bflush>
+  8016c5:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  8016cb:	e8 39 f6 ff ff       	call   800d09 <sys_getenvid>
+  8016d0:	83 ec 0c             	sub    $0xc,%esp
+  8016d3:	ff 75 0c             	push   0xc(%ebp)
+  8016d6:	ff 75 08             	push   0x8(%ebp)
+  8016d9:	56                   	push   %esi
+  8016da:	50                   	push   %eax
+  8016db:	68 10 1c 80 00       	push   $0x801c10
+  8016e0:	e8 67 ea ff ff       	call   80014c <cprintf>
+  8016e5:	83 c4 18             	add    $0x18,%esp
+  8016e8:	53                   	push   %ebx
+  8016e9:	ff 75 10             	push   0x10(%ebp)
+  8016ec:	e8 0a ea ff ff       	call   8000fb <vcprintf>
+  8016f1:	c7 04 24 8c 19 80 00 	movl   $0x80198c,(%esp)
+  8016f8:	e8 4f ea ff ff       	call   80014c <cprintf>
+  8016fd:	83 c4 10             	add    $0x10,%esp
+  801700:	cc                   	int3
+  801701:	eb fd                	jmp    801700 <_panic+0x48>
+
+00801703 <__udivdi3>:
+  801703:	57                   	push   %edi
+  801704:	56                   	push   %esi
+  801705:	53                   	push   %ebx
+  801706:	83 ec 20             	sub    $0x20,%esp
+  801709:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80170d:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801711:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801715:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801719:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80171d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801721:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801725:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801729:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80172d:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801731:	89 d1                	mov    %edx,%ecx
+  801733:	09 c1                	or     %eax,%ecx
+  801735:	0f 84 91 00 00 00    	je     8017cc <__udivdi3+0xc9>
+  80173b:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801742:	00 
+  801743:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80174a:	00 
+  80174b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801750:	b8 00 00 00 00       	mov    $0x0,%eax
+  801755:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175a:	eb 08                	jmp    801764 <__udivdi3+0x61>
+  80175c:	83 e9 01             	sub    $0x1,%ecx
+  80175f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801762:	74 68                	je     8017cc <__udivdi3+0xc9>
+  801764:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801768:	01 c0                	add    %eax,%eax
+  80176a:	89 c6                	mov    %eax,%esi
+  80176c:	89 d7                	mov    %edx,%edi
+  80176e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801772:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801776:	0f ad d0             	shrd   %cl,%edx,%eax
+  801779:	d3 ea                	shr    %cl,%edx
+  80177b:	f6 c1 20             	test   $0x20,%cl
+  80177e:	74 04                	je     801784 <__udivdi3+0x81>
+  801780:	89 d0                	mov    %edx,%eax
+  801782:	31 d2                	xor    %edx,%edx
+  801784:	83 e0 01             	and    $0x1,%eax
+  801787:	89 04 24             	mov    %eax,(%esp)
+  80178a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801791:	00 
+  801792:	8b 04 24             	mov    (%esp),%eax
+  801795:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801799:	09 f0                	or     %esi,%eax
+  80179b:	09 fa                	or     %edi,%edx
+  80179d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8017a1:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8017a5:	39 f0                	cmp    %esi,%eax
+  8017a7:	89 d3                	mov    %edx,%ebx
+  8017a9:	19 fb                	sbb    %edi,%ebx
+  8017ab:	72 af                	jb     80175c <__udivdi3+0x59>
+  8017ad:	29 f0                	sub    %esi,%eax
+  8017af:	19 fa                	sbb    %edi,%edx
+  8017b1:	89 cf                	mov    %ecx,%edi
+  8017b3:	c1 ef 05             	shr    $0x5,%edi
+  8017b6:	83 e7 01             	and    $0x1,%edi
+  8017b9:	89 fe                	mov    %edi,%esi
+  8017bb:	83 f6 01             	xor    $0x1,%esi
+  8017be:	d3 e6                	shl    %cl,%esi
+  8017c0:	d3 e7                	shl    %cl,%edi
+  8017c2:	09 74 24 18          	or     %esi,0x18(%esp)
+  8017c6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8017ca:	eb 90                	jmp    80175c <__udivdi3+0x59>
+  8017cc:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8017d0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8017d4:	83 c4 20             	add    $0x20,%esp
+  8017d7:	5b                   	pop    %ebx
+  8017d8:	5e                   	pop    %esi
+  8017d9:	5f                   	pop    %edi
+  8017da:	c3                   	ret
+
+008017db <__umoddi3>:
+  8017db:	55                   	push   %ebp
+  8017dc:	57                   	push   %edi
+  8017dd:	56                   	push   %esi
+  8017de:	53                   	push   %ebx
+  8017df:	83 ec 1c             	sub    $0x1c,%esp
+  8017e2:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8017e6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8017ea:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8017ee:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8017f2:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8017f6:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8017fa:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8017fe:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801802:	89 d6                	mov    %edx,%esi
+  801804:	09 c6                	or     %eax,%esi
+  801806:	74 6c                	je     801874 <__umoddi3+0x99>
+  801808:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80180d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801812:	ba 00 00 00 00       	mov    $0x0,%edx
+  801817:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  80181b:	eb 0e                	jmp    80182b <__umoddi3+0x50>
+  80181d:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801822:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801826:	83 fe ff             	cmp    $0xffffffff,%esi
+  801829:	74 49                	je     801874 <__umoddi3+0x99>
+  80182b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80182f:	01 c0                	add    %eax,%eax
+  801831:	89 c3                	mov    %eax,%ebx
+  801833:	89 d6                	mov    %edx,%esi
+  801835:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801839:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80183d:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801842:	0f ad d0             	shrd   %cl,%edx,%eax
+  801845:	d3 ea                	shr    %cl,%edx
+  801847:	f6 c1 20             	test   $0x20,%cl
+  80184a:	74 04                	je     801850 <__umoddi3+0x75>
+  80184c:	89 d0                	mov    %edx,%eax
+  80184e:	31 d2                	xor    %edx,%edx
+  801850:	83 e0 01             	and    $0x1,%eax
+  801853:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801858:	89 ea                	mov    %ebp,%edx
+  80185a:	09 d8                	or     %ebx,%eax
+  80185c:	09 f2                	or     %esi,%edx
+  80185e:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801862:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801866:	39 d8                	cmp    %ebx,%eax
+  801868:	89 d1                	mov    %edx,%ecx
+  80186a:	19 f1                	sbb    %esi,%ecx
+  80186c:	72 af                	jb     80181d <__umoddi3+0x42>
+  80186e:	29 d8                	sub    %ebx,%eax
+  801870:	19 f2                	sbb    %esi,%edx
+  801872:	eb a9                	jmp    80181d <__umoddi3+0x42>
+  801874:	83 c4 1c             	add    $0x1c,%esp
+  801877:	5b                   	pop    %ebx
+  801878:	5e                   	pop    %esi
+  801879:	5f                   	pop    %edi
+  80187a:	5d                   	pop    %ebp
+  80187b:	c3                   	ret
+
+0080187c <__divdi3>:
+  80187c:	53                   	push   %ebx
+  80187d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801881:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801885:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801889:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80188d:	85 d2                	test   %edx,%edx
+  80188f:	78 12                	js     8018a3 <__divdi3+0x27>
+  801891:	85 db                	test   %ebx,%ebx
+  801893:	78 2e                	js     8018c3 <__divdi3+0x47>
+  801895:	53                   	push   %ebx
+  801896:	51                   	push   %ecx
+  801897:	52                   	push   %edx
+  801898:	50                   	push   %eax
+  801899:	e8 65 fe ff ff       	call   801703 <__udivdi3>
+  80189e:	83 c4 10             	add    $0x10,%esp
+  8018a1:	eb 1e                	jmp    8018c1 <__divdi3+0x45>
+  8018a3:	f7 d8                	neg    %eax
+  8018a5:	83 d2 00             	adc    $0x0,%edx
+  8018a8:	f7 da                	neg    %edx
+  8018aa:	85 db                	test   %ebx,%ebx
+  8018ac:	78 2a                	js     8018d8 <__divdi3+0x5c>
+  8018ae:	53                   	push   %ebx
+  8018af:	51                   	push   %ecx
+  8018b0:	52                   	push   %edx
+  8018b1:	50                   	push   %eax
+  8018b2:	e8 4c fe ff ff       	call   801703 <__udivdi3>
+  8018b7:	83 c4 10             	add    $0x10,%esp
+  8018ba:	f7 d8                	neg    %eax
+  8018bc:	83 d2 00             	adc    $0x0,%edx
+  8018bf:	f7 da                	neg    %edx
+  8018c1:	5b                   	pop    %ebx
+  8018c2:	c3                   	ret
+  8018c3:	f7 d9                	neg    %ecx
+  8018c5:	83 d3 00             	adc    $0x0,%ebx
+  8018c8:	f7 db                	neg    %ebx
+  8018ca:	53                   	push   %ebx
+  8018cb:	51                   	push   %ecx
+  8018cc:	52                   	push   %edx
+  8018cd:	50                   	push   %eax
+  8018ce:	e8 30 fe ff ff       	call   801703 <__udivdi3>
+  8018d3:	83 c4 10             	add    $0x10,%esp
+  8018d6:	eb e2                	jmp    8018ba <__divdi3+0x3e>
+  8018d8:	f7 d9                	neg    %ecx
+  8018da:	83 d3 00             	adc    $0x0,%ebx
+  8018dd:	f7 db                	neg    %ebx
+  8018df:	53                   	push   %ebx
+  8018e0:	51                   	push   %ecx
+  8018e1:	52                   	push   %edx
+  8018e2:	50                   	push   %eax
+  8018e3:	e8 1b fe ff ff       	call   801703 <__udivdi3>
+  8018e8:	83 c4 10             	add    $0x10,%esp
+  8018eb:	eb d4                	jmp    8018c1 <__divdi3+0x45>
+
+008018ed <__moddi3>:
+  8018ed:	55                   	push   %ebp
+  8018ee:	57                   	push   %edi
+  8018ef:	56                   	push   %esi
+  8018f0:	53                   	push   %ebx
+  8018f1:	83 ec 14             	sub    $0x14,%esp
+  8018f4:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  8018f8:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  8018fc:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801900:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801904:	85 ed                	test   %ebp,%ebp
+  801906:	78 2b                	js     801933 <__moddi3+0x46>
+  801908:	89 c6                	mov    %eax,%esi
+  80190a:	f7 de                	neg    %esi
+  80190c:	89 34 24             	mov    %esi,(%esp)
+  80190f:	89 d6                	mov    %edx,%esi
+  801911:	83 d6 00             	adc    $0x0,%esi
+  801914:	f7 de                	neg    %esi
+  801916:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80191a:	8b 34 24             	mov    (%esp),%esi
+  80191d:	0f 48 f0             	cmovs  %eax,%esi
+  801920:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801925:	52                   	push   %edx
+  801926:	56                   	push   %esi
+  801927:	55                   	push   %ebp
+  801928:	57                   	push   %edi
+  801929:	e8 ad fe ff ff       	call   8017db <__umoddi3>
+  80192e:	83 c4 10             	add    $0x10,%esp
+  801931:	eb 3c                	jmp    80196f <__moddi3+0x82>
+  801933:	89 c3                	mov    %eax,%ebx
+  801935:	f7 db                	neg    %ebx
+  801937:	89 d1                	mov    %edx,%ecx
+  801939:	83 d1 00             	adc    $0x0,%ecx
+  80193c:	f7 d9                	neg    %ecx
+  80193e:	0f 49 c3             	cmovns %ebx,%eax
+  801941:	89 04 24             	mov    %eax,(%esp)
+  801944:	0f 49 d1             	cmovns %ecx,%edx
+  801947:	89 54 24 04          	mov    %edx,0x4(%esp)
+  80194b:	ff 74 24 04          	push   0x4(%esp)
+  80194f:	ff 74 24 04          	push   0x4(%esp)
+  801953:	89 f8                	mov    %edi,%eax
+  801955:	89 ea                	mov    %ebp,%edx
+  801957:	f7 d8                	neg    %eax
+  801959:	83 d2 00             	adc    $0x0,%edx
+  80195c:	f7 da                	neg    %edx
+  80195e:	52                   	push   %edx
+  80195f:	50                   	push   %eax
+  801960:	e8 76 fe ff ff       	call   8017db <__umoddi3>
+  801965:	83 c4 10             	add    $0x10,%esp
+  801968:	f7 d8                	neg    %eax
+  80196a:	83 d2 00             	adc    $0x0,%edx
+  80196d:	f7 da                	neg    %edx
+  80196f:	83 c4 14             	add    $0x14,%esp
+  801972:	5b                   	pop    %ebx
+  801973:	5e                   	pop    %esi
+  801974:	5f                   	pop    %edi
+  801975:	5d                   	pop    %ebp
+  801976:	c3                   	ret
@@ -0,0 +1,2713 @@
+
+obj/user/dumbfork:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 9d 01 00 00       	call   8001ce <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <duppage>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80003e:	83 ec 04             	sub    $0x4,%esp
+  800041:	6a 07                	push   $0x7
+  800043:	53                   	push   %ebx
+  800044:	56                   	push   %esi
+  800045:	e8 6e 10 00 00       	call   8010b8 <sys_page_alloc>
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	78 4a                	js     80009b <duppage+0x68>
+  800051:	83 ec 0c             	sub    $0xc,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 40 00       	push   $0x400000
+  80005b:	6a 00                	push   $0x0
+  80005d:	53                   	push   %ebx
+  80005e:	56                   	push   %esi
+  80005f:	e8 e3 10 00 00       	call   801147 <sys_page_map>
+  800064:	83 c4 20             	add    $0x20,%esp
+  800067:	85 c0                	test   %eax,%eax
+  800069:	78 42                	js     8000ad <duppage+0x7a>
+  80006b:	83 ec 04             	sub    $0x4,%esp
+  80006e:	68 00 10 00 00       	push   $0x1000
+  800073:	53                   	push   %ebx
+  800074:	68 00 00 40 00       	push   $0x400000
+  800079:	e8 88 0a 00 00       	call   800b06 <memmove>
+  80007e:	83 c4 08             	add    $0x8,%esp
+  800081:	68 00 00 40 00       	push   $0x400000
+  800086:	6a 00                	push   $0x0
+  800088:	e8 47 11 00 00       	call   8011d4 <sys_page_unmap>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	85 c0                	test   %eax,%eax
+  800092:	78 2b                	js     8000bf <duppage+0x8c>
+  800094:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800097:	5b                   	pop    %ebx
+  800098:	5e                   	pop    %esi
+  800099:	5d                   	pop    %ebp
+  80009a:	c3                   	ret
+  80009b:	50                   	push   %eax
+  80009c:	68 00 1b 80 00       	push   $0x801b00
+  8000a1:	6a 20                	push   $0x20
+  8000a3:	68 13 1b 80 00       	push   $0x801b13
+  8000a8:	e8 84 01 00 00       	call   800231 <_panic>
+  8000ad:	50                   	push   %eax
+  8000ae:	68 23 1b 80 00       	push   $0x801b23
+  8000b3:	6a 22                	push   $0x22
+  8000b5:	68 13 1b 80 00       	push   $0x801b13
+  8000ba:	e8 72 01 00 00       	call   800231 <_panic>
+  8000bf:	50                   	push   %eax
+  8000c0:	68 34 1b 80 00       	push   $0x801b34
+  8000c5:	6a 25                	push   $0x25
+  8000c7:	68 13 1b 80 00       	push   $0x801b13
+  8000cc:	e8 60 01 00 00       	call   800231 <_panic>
+
+008000d1 <dumbfork>:
+  8000d1:	55                   	push   %ebp
+  8000d2:	89 e5                	mov    %esp,%ebp
+  8000d4:	53                   	push   %ebx
+  8000d5:	83 ec 14             	sub    $0x14,%esp
+  8000d8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8000dd:	cd 30                	int    $0x30
+  8000df:	89 c3                	mov    %eax,%ebx
+  8000e1:	85 c0                	test   %eax,%eax
+  8000e3:	78 23                	js     800108 <dumbfork+0x37>
+  8000e5:	ba 00 00 80 00       	mov    $0x800000,%edx
+  8000ea:	75 44                	jne    800130 <dumbfork+0x5f>
+  8000ec:	e8 dd 0d 00 00       	call   800ece <sys_getenvid>
+  8000f1:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8000f6:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8000fc:	05 00 00 00 ed       	add    $0xed000000,%eax
+  800101:	a3 20 20 80 00       	mov    %eax,0x802020
+  800106:	eb 57                	jmp    80015f <dumbfork+0x8e>
+  800108:	50                   	push   %eax
+  800109:	68 47 1b 80 00       	push   $0x801b47
+  80010e:	6a 37                	push   $0x37
+  800110:	68 13 1b 80 00       	push   $0x801b13
+  800115:	e8 17 01 00 00       	call   800231 <_panic>
+  80011a:	83 ec 08             	sub    $0x8,%esp
+  80011d:	52                   	push   %edx
+  80011e:	53                   	push   %ebx
+  80011f:	e8 0f ff ff ff       	call   800033 <duppage>
+  800124:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800127:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80012d:	83 c4 10             	add    $0x10,%esp
+  800130:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  800133:	81 fa 44 24 80 00    	cmp    $0x802444,%edx
+  800139:	72 df                	jb     80011a <dumbfork+0x49>
+  80013b:	83 ec 08             	sub    $0x8,%esp
+  80013e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800141:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800146:	50                   	push   %eax
+  800147:	53                   	push   %ebx
+  800148:	e8 e6 fe ff ff       	call   800033 <duppage>
+  80014d:	83 c4 08             	add    $0x8,%esp
+  800150:	6a 02                	push   $0x2
+  800152:	53                   	push   %ebx
+  800153:	e8 75 11 00 00       	call   8012cd <sys_env_set_status>
+  800158:	83 c4 10             	add    $0x10,%esp
+  80015b:	85 c0                	test   %eax,%eax
+  80015d:	78 07                	js     800166 <dumbfork+0x95>
+  80015f:	89 d8                	mov    %ebx,%eax
+  800161:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+  800166:	50                   	push   %eax
+  800167:	68 57 1b 80 00       	push   $0x801b57
+  80016c:	6a 4c                	push   $0x4c
+  80016e:	68 13 1b 80 00       	push   $0x801b13
+  800173:	e8 b9 00 00 00       	call   800231 <_panic>
+
+00800178 <umain>:
+  800178:	55                   	push   %ebp
+  800179:	89 e5                	mov    %esp,%ebp
+  80017b:	57                   	push   %edi
+  80017c:	56                   	push   %esi
+  80017d:	53                   	push   %ebx
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+  800181:	e8 4b ff ff ff       	call   8000d1 <dumbfork>
+  800186:	89 c6                	mov    %eax,%esi
+  800188:	85 c0                	test   %eax,%eax
+  80018a:	bf 6e 1b 80 00       	mov    $0x801b6e,%edi
+  80018f:	b8 75 1b 80 00       	mov    $0x801b75,%eax
+  800194:	0f 44 f8             	cmove  %eax,%edi
+  800197:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80019c:	eb 1f                	jmp    8001bd <umain+0x45>
+  80019e:	83 fb 13             	cmp    $0x13,%ebx
+  8001a1:	7f 23                	jg     8001c6 <umain+0x4e>
+  8001a3:	83 ec 04             	sub    $0x4,%esp
+  8001a6:	57                   	push   %edi
+  8001a7:	53                   	push   %ebx
+  8001a8:	68 7b 1b 80 00       	push   $0x801b7b
+  8001ad:	e8 5f 01 00 00       	call   800311 <cprintf>
+  8001b2:	e8 7f 0d 00 00       	call   800f36 <sys_yield>
+  8001b7:	83 c3 01             	add    $0x1,%ebx
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	85 f6                	test   %esi,%esi
+  8001bf:	74 dd                	je     80019e <umain+0x26>
+  8001c1:	83 fb 09             	cmp    $0x9,%ebx
+  8001c4:	7e dd                	jle    8001a3 <umain+0x2b>
+  8001c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c9:	5b                   	pop    %ebx
+  8001ca:	5e                   	pop    %esi
+  8001cb:	5f                   	pop    %edi
+  8001cc:	5d                   	pop    %ebp
+  8001cd:	c3                   	ret
+
+008001ce <libmain>:
+  8001ce:	55                   	push   %ebp
+  8001cf:	89 e5                	mov    %esp,%ebp
+  8001d1:	56                   	push   %esi
+  8001d2:	53                   	push   %ebx
+  8001d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8001d9:	e8 0f 15 00 00       	call   8016ed <uinfo_envid>
+  8001de:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8001e3:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8001e9:	05 00 00 00 ed       	add    $0xed000000,%eax
+  8001ee:	a3 20 20 80 00       	mov    %eax,0x802020
+  8001f3:	85 db                	test   %ebx,%ebx
+  8001f5:	7e 07                	jle    8001fe <libmain+0x30>
+  8001f7:	8b 06                	mov    (%esi),%eax
+  8001f9:	a3 00 20 80 00       	mov    %eax,0x802000
+  8001fe:	83 ec 08             	sub    $0x8,%esp
+  800201:	56                   	push   %esi
+  800202:	53                   	push   %ebx
+  800203:	e8 70 ff ff ff       	call   800178 <umain>
+  800208:	e8 0a 00 00 00       	call   800217 <exit>
+  80020d:	83 c4 10             	add    $0x10,%esp
+  800210:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800213:	5b                   	pop    %ebx
+  800214:	5e                   	pop    %esi
+  800215:	5d                   	pop    %ebp
+  800216:	c3                   	ret
+
+00800217 <exit>:
+  800217:	55                   	push   %ebp
+  800218:	89 e5                	mov    %esp,%ebp
+  80021a:	83 ec 08             	sub    $0x8,%esp
+  80021d:	e8 64 15 00 00       	call   801786 <bflush>
+  800222:	83 ec 0c             	sub    $0xc,%esp
+  800225:	6a 00                	push   $0x0
+  800227:	e8 17 0c 00 00       	call   800e43 <sys_env_destroy>
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	c9                   	leave
+  800230:	c3                   	ret
+
+00800231 <_panic>:
+  800231:	55                   	push   %ebp
+  800232:	89 e5                	mov    %esp,%ebp
+  800234:	56                   	push   %esi
+  800235:	53                   	push   %ebx
+  800236:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800239:	e8 48 15 00 00       	call   801786 <bflush>
+  80023e:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  800244:	e8 85 0c 00 00       	call   800ece <sys_getenvid>
+  800249:	83 ec 0c             	sub    $0xc,%esp
+  80024c:	ff 75 0c             	push   0xc(%ebp)
+  80024f:	ff 75 08             	push   0x8(%ebp)
+  800252:	56                   	push   %esi
+  800253:	50                   	push   %eax
+  800254:	68 98 1b 80 00       	push   $0x801b98
+  800259:	e8 b3 00 00 00       	call   800311 <cprintf>
+  80025e:	83 c4 18             	add    $0x18,%esp
+  800261:	53                   	push   %ebx
+  800262:	ff 75 10             	push   0x10(%ebp)
+  800265:	e8 56 00 00 00       	call   8002c0 <vcprintf>
+  80026a:	c7 04 24 8b 1b 80 00 	movl   $0x801b8b,(%esp)
+  800271:	e8 9b 00 00 00       	call   800311 <cprintf>
+  800276:	83 c4 10             	add    $0x10,%esp
+  800279:	cc                   	int3
+  80027a:	eb fd                	jmp    800279 <_panic+0x48>
+
+0080027c <putch>:
+  80027c:	55                   	push   %ebp
+  80027d:	89 e5                	mov    %esp,%ebp
+  80027f:	53                   	push   %ebx
+  800280:	83 ec 04             	sub    $0x4,%esp
+  800283:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800286:	8b 13                	mov    (%ebx),%edx
+  800288:	8d 42 01             	lea    0x1(%edx),%eax
+  80028b:	89 03                	mov    %eax,(%ebx)
+  80028d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800290:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800294:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800299:	74 09                	je     8002a4 <putch+0x28>
+  80029b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80029f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002a2:	c9                   	leave
+  8002a3:	c3                   	ret
+  8002a4:	83 ec 08             	sub    $0x8,%esp
+  8002a7:	68 ff 00 00 00       	push   $0xff
+  8002ac:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002af:	50                   	push   %eax
+  8002b0:	e8 c0 0a 00 00       	call   800d75 <sys_cputs>
+  8002b5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002bb:	83 c4 10             	add    $0x10,%esp
+  8002be:	eb db                	jmp    80029b <putch+0x1f>
+
+008002c0 <vcprintf>:
+  8002c0:	55                   	push   %ebp
+  8002c1:	89 e5                	mov    %esp,%ebp
+  8002c3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8002c9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002d0:	00 00 00 
+  8002d3:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002da:	00 00 00 
+  8002dd:	ff 75 0c             	push   0xc(%ebp)
+  8002e0:	ff 75 08             	push   0x8(%ebp)
+  8002e3:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002e9:	50                   	push   %eax
+  8002ea:	68 7c 02 80 00       	push   $0x80027c
+  8002ef:	e8 14 01 00 00       	call   800408 <vprintfmt>
+  8002f4:	83 c4 08             	add    $0x8,%esp
+  8002f7:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002fd:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800303:	50                   	push   %eax
+  800304:	e8 6c 0a 00 00       	call   800d75 <sys_cputs>
+  800309:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80030f:	c9                   	leave
+  800310:	c3                   	ret
+
+00800311 <cprintf>:
+  800311:	55                   	push   %ebp
+  800312:	89 e5                	mov    %esp,%ebp
+  800314:	83 ec 10             	sub    $0x10,%esp
+  800317:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80031a:	50                   	push   %eax
+  80031b:	ff 75 08             	push   0x8(%ebp)
+  80031e:	e8 9d ff ff ff       	call   8002c0 <vcprintf>
+  800323:	c9                   	leave
+  800324:	c3                   	ret
+
+00800325 <printnum>:
+  800325:	55                   	push   %ebp
+  800326:	89 e5                	mov    %esp,%ebp
+  800328:	57                   	push   %edi
+  800329:	56                   	push   %esi
+  80032a:	53                   	push   %ebx
+  80032b:	83 ec 1c             	sub    $0x1c,%esp
+  80032e:	89 c7                	mov    %eax,%edi
+  800330:	89 d6                	mov    %edx,%esi
+  800332:	8b 45 08             	mov    0x8(%ebp),%eax
+  800335:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800338:	89 d1                	mov    %edx,%ecx
+  80033a:	89 c2                	mov    %eax,%edx
+  80033c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80033f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800342:	8b 45 10             	mov    0x10(%ebp),%eax
+  800345:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800348:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80034b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800352:	39 c2                	cmp    %eax,%edx
+  800354:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800357:	72 3e                	jb     800397 <printnum+0x72>
+  800359:	83 ec 0c             	sub    $0xc,%esp
+  80035c:	ff 75 18             	push   0x18(%ebp)
+  80035f:	83 eb 01             	sub    $0x1,%ebx
+  800362:	53                   	push   %ebx
+  800363:	50                   	push   %eax
+  800364:	83 ec 08             	sub    $0x8,%esp
+  800367:	ff 75 e4             	push   -0x1c(%ebp)
+  80036a:	ff 75 e0             	push   -0x20(%ebp)
+  80036d:	ff 75 dc             	push   -0x24(%ebp)
+  800370:	ff 75 d8             	push   -0x28(%ebp)
+  800373:	e8 05 15 00 00       	call   80187d <__udivdi3>
+  800378:	83 c4 18             	add    $0x18,%esp
+  80037b:	52                   	push   %edx
+  80037c:	50                   	push   %eax
+  80037d:	89 f2                	mov    %esi,%edx
+  80037f:	89 f8                	mov    %edi,%eax
+  800381:	e8 9f ff ff ff       	call   800325 <printnum>
+  800386:	83 c4 20             	add    $0x20,%esp
+  800389:	eb 13                	jmp    80039e <printnum+0x79>
+  80038b:	83 ec 08             	sub    $0x8,%esp
+  80038e:	56                   	push   %esi
+  80038f:	ff 75 18             	push   0x18(%ebp)
+  800392:	ff d7                	call   *%edi
+  800394:	83 c4 10             	add    $0x10,%esp
+  800397:	83 eb 01             	sub    $0x1,%ebx
+  80039a:	85 db                	test   %ebx,%ebx
+  80039c:	7f ed                	jg     80038b <printnum+0x66>
+  80039e:	83 ec 08             	sub    $0x8,%esp
+  8003a1:	56                   	push   %esi
+  8003a2:	83 ec 04             	sub    $0x4,%esp
+  8003a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a8:	ff 75 e0             	push   -0x20(%ebp)
+  8003ab:	ff 75 dc             	push   -0x24(%ebp)
+  8003ae:	ff 75 d8             	push   -0x28(%ebp)
+  8003b1:	e8 9f 15 00 00       	call   801955 <__umoddi3>
+  8003b6:	83 c4 14             	add    $0x14,%esp
+  8003b9:	0f be 80 bb 1b 80 00 	movsbl 0x801bbb(%eax),%eax
+  8003c0:	50                   	push   %eax
+  8003c1:	ff d7                	call   *%edi
+  8003c3:	83 c4 10             	add    $0x10,%esp
+  8003c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c9:	5b                   	pop    %ebx
+  8003ca:	5e                   	pop    %esi
+  8003cb:	5f                   	pop    %edi
+  8003cc:	5d                   	pop    %ebp
+  8003cd:	c3                   	ret
+
+008003ce <sprintputch>:
+  8003ce:	55                   	push   %ebp
+  8003cf:	89 e5                	mov    %esp,%ebp
+  8003d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8003d4:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8003d8:	8b 10                	mov    (%eax),%edx
+  8003da:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003dd:	73 0a                	jae    8003e9 <sprintputch+0x1b>
+  8003df:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003e2:	89 08                	mov    %ecx,(%eax)
+  8003e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003e7:	88 02                	mov    %al,(%edx)
+  8003e9:	5d                   	pop    %ebp
+  8003ea:	c3                   	ret
+
+008003eb <printfmt>:
+  8003eb:	55                   	push   %ebp
+  8003ec:	89 e5                	mov    %esp,%ebp
+  8003ee:	83 ec 08             	sub    $0x8,%esp
+  8003f1:	8d 45 14             	lea    0x14(%ebp),%eax
+  8003f4:	50                   	push   %eax
+  8003f5:	ff 75 10             	push   0x10(%ebp)
+  8003f8:	ff 75 0c             	push   0xc(%ebp)
+  8003fb:	ff 75 08             	push   0x8(%ebp)
+  8003fe:	e8 05 00 00 00       	call   800408 <vprintfmt>
+  800403:	83 c4 10             	add    $0x10,%esp
+  800406:	c9                   	leave
+  800407:	c3                   	ret
+
+00800408 <vprintfmt>:
+  800408:	55                   	push   %ebp
+  800409:	89 e5                	mov    %esp,%ebp
+  80040b:	57                   	push   %edi
+  80040c:	56                   	push   %esi
+  80040d:	53                   	push   %ebx
+  80040e:	83 ec 2c             	sub    $0x2c,%esp
+  800411:	8b 75 08             	mov    0x8(%ebp),%esi
+  800414:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800417:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80041a:	eb 0a                	jmp    800426 <vprintfmt+0x1e>
+  80041c:	83 ec 08             	sub    $0x8,%esp
+  80041f:	53                   	push   %ebx
+  800420:	50                   	push   %eax
+  800421:	ff d6                	call   *%esi
+  800423:	83 c4 10             	add    $0x10,%esp
+  800426:	83 c7 01             	add    $0x1,%edi
+  800429:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80042d:	83 f8 25             	cmp    $0x25,%eax
+  800430:	74 0c                	je     80043e <vprintfmt+0x36>
+  800432:	85 c0                	test   %eax,%eax
+  800434:	75 e6                	jne    80041c <vprintfmt+0x14>
+  800436:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800439:	5b                   	pop    %ebx
+  80043a:	5e                   	pop    %esi
+  80043b:	5f                   	pop    %edi
+  80043c:	5d                   	pop    %ebp
+  80043d:	c3                   	ret
+  80043e:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800442:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800449:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800450:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800457:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80045c:	8d 47 01             	lea    0x1(%edi),%eax
+  80045f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800462:	0f b6 17             	movzbl (%edi),%edx
+  800465:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800468:	3c 55                	cmp    $0x55,%al
+  80046a:	0f 87 cf 03 00 00    	ja     80083f <vprintfmt+0x437>
+  800470:	0f b6 c0             	movzbl %al,%eax
+  800473:	ff 24 85 80 1c 80 00 	jmp    *0x801c80(,%eax,4)
+  80047a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80047d:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800481:	eb d9                	jmp    80045c <vprintfmt+0x54>
+  800483:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800486:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80048a:	eb d0                	jmp    80045c <vprintfmt+0x54>
+  80048c:	0f b6 d2             	movzbl %dl,%edx
+  80048f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800492:	b8 00 00 00 00       	mov    $0x0,%eax
+  800497:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  80049a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80049d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  8004a1:	0f be 17             	movsbl (%edi),%edx
+  8004a4:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004a7:	83 f9 09             	cmp    $0x9,%ecx
+  8004aa:	77 55                	ja     800501 <vprintfmt+0xf9>
+  8004ac:	83 c7 01             	add    $0x1,%edi
+  8004af:	eb e9                	jmp    80049a <vprintfmt+0x92>
+  8004b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b4:	8b 00                	mov    (%eax),%eax
+  8004b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8004bf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004c5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c9:	79 91                	jns    80045c <vprintfmt+0x54>
+  8004cb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004d1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004d8:	eb 82                	jmp    80045c <vprintfmt+0x54>
+  8004da:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004dd:	85 d2                	test   %edx,%edx
+  8004df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e4:	0f 49 c2             	cmovns %edx,%eax
+  8004e7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004ed:	e9 6a ff ff ff       	jmp    80045c <vprintfmt+0x54>
+  8004f2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004f5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8004fc:	e9 5b ff ff ff       	jmp    80045c <vprintfmt+0x54>
+  800501:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800504:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800507:	eb bc                	jmp    8004c5 <vprintfmt+0xbd>
+  800509:	83 c1 01             	add    $0x1,%ecx
+  80050c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80050f:	e9 48 ff ff ff       	jmp    80045c <vprintfmt+0x54>
+  800514:	8b 45 14             	mov    0x14(%ebp),%eax
+  800517:	8d 78 04             	lea    0x4(%eax),%edi
+  80051a:	83 ec 08             	sub    $0x8,%esp
+  80051d:	53                   	push   %ebx
+  80051e:	ff 30                	push   (%eax)
+  800520:	ff d6                	call   *%esi
+  800522:	83 c4 10             	add    $0x10,%esp
+  800525:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800528:	e9 b1 02 00 00       	jmp    8007de <vprintfmt+0x3d6>
+  80052d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800530:	8d 78 04             	lea    0x4(%eax),%edi
+  800533:	8b 10                	mov    (%eax),%edx
+  800535:	89 d0                	mov    %edx,%eax
+  800537:	f7 d8                	neg    %eax
+  800539:	0f 48 c2             	cmovs  %edx,%eax
+  80053c:	83 f8 08             	cmp    $0x8,%eax
+  80053f:	7f 23                	jg     800564 <vprintfmt+0x15c>
+  800541:	8b 14 85 e0 1d 80 00 	mov    0x801de0(,%eax,4),%edx
+  800548:	85 d2                	test   %edx,%edx
+  80054a:	74 18                	je     800564 <vprintfmt+0x15c>
+  80054c:	52                   	push   %edx
+  80054d:	68 dc 1b 80 00       	push   $0x801bdc
+  800552:	53                   	push   %ebx
+  800553:	56                   	push   %esi
+  800554:	e8 92 fe ff ff       	call   8003eb <printfmt>
+  800559:	83 c4 10             	add    $0x10,%esp
+  80055c:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80055f:	e9 7a 02 00 00       	jmp    8007de <vprintfmt+0x3d6>
+  800564:	50                   	push   %eax
+  800565:	68 d3 1b 80 00       	push   $0x801bd3
+  80056a:	53                   	push   %ebx
+  80056b:	56                   	push   %esi
+  80056c:	e8 7a fe ff ff       	call   8003eb <printfmt>
+  800571:	83 c4 10             	add    $0x10,%esp
+  800574:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800577:	e9 62 02 00 00       	jmp    8007de <vprintfmt+0x3d6>
+  80057c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057f:	83 c0 04             	add    $0x4,%eax
+  800582:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800585:	8b 45 14             	mov    0x14(%ebp),%eax
+  800588:	8b 08                	mov    (%eax),%ecx
+  80058a:	85 c9                	test   %ecx,%ecx
+  80058c:	b8 cc 1b 80 00       	mov    $0x801bcc,%eax
+  800591:	0f 45 c1             	cmovne %ecx,%eax
+  800594:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800597:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80059b:	7e 06                	jle    8005a3 <vprintfmt+0x19b>
+  80059d:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005a1:	75 0b                	jne    8005ae <vprintfmt+0x1a6>
+  8005a3:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005a6:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005a9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005ac:	eb 5c                	jmp    80060a <vprintfmt+0x202>
+  8005ae:	83 ec 08             	sub    $0x8,%esp
+  8005b1:	ff 75 d0             	push   -0x30(%ebp)
+  8005b4:	ff 75 cc             	push   -0x34(%ebp)
+  8005b7:	e8 87 03 00 00       	call   800943 <strnlen>
+  8005bc:	89 c2                	mov    %eax,%edx
+  8005be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005c1:	29 d0                	sub    %edx,%eax
+  8005c3:	83 c4 10             	add    $0x10,%esp
+  8005c6:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005cd:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005d0:	89 c6                	mov    %eax,%esi
+  8005d2:	eb 0e                	jmp    8005e2 <vprintfmt+0x1da>
+  8005d4:	83 ec 08             	sub    $0x8,%esp
+  8005d7:	53                   	push   %ebx
+  8005d8:	57                   	push   %edi
+  8005d9:	ff 55 08             	call   *0x8(%ebp)
+  8005dc:	83 ee 01             	sub    $0x1,%esi
+  8005df:	83 c4 10             	add    $0x10,%esp
+  8005e2:	85 f6                	test   %esi,%esi
+  8005e4:	7f ee                	jg     8005d4 <vprintfmt+0x1cc>
+  8005e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ec:	85 c0                	test   %eax,%eax
+  8005ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f3:	0f 49 d0             	cmovns %eax,%edx
+  8005f6:	29 d0                	sub    %edx,%eax
+  8005f8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005fb:	eb a6                	jmp    8005a3 <vprintfmt+0x19b>
+  8005fd:	83 ec 08             	sub    $0x8,%esp
+  800600:	53                   	push   %ebx
+  800601:	52                   	push   %edx
+  800602:	ff 55 08             	call   *0x8(%ebp)
+  800605:	83 c4 10             	add    $0x10,%esp
+  800608:	89 f1                	mov    %esi,%ecx
+  80060a:	8d 71 01             	lea    0x1(%ecx),%esi
+  80060d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800611:	0f be d0             	movsbl %al,%edx
+  800614:	85 d2                	test   %edx,%edx
+  800616:	74 28                	je     800640 <vprintfmt+0x238>
+  800618:	85 ff                	test   %edi,%edi
+  80061a:	78 05                	js     800621 <vprintfmt+0x219>
+  80061c:	83 ef 01             	sub    $0x1,%edi
+  80061f:	78 30                	js     800651 <vprintfmt+0x249>
+  800621:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800625:	74 d6                	je     8005fd <vprintfmt+0x1f5>
+  800627:	0f be c0             	movsbl %al,%eax
+  80062a:	83 e8 20             	sub    $0x20,%eax
+  80062d:	83 f8 5e             	cmp    $0x5e,%eax
+  800630:	76 cb                	jbe    8005fd <vprintfmt+0x1f5>
+  800632:	83 ec 08             	sub    $0x8,%esp
+  800635:	53                   	push   %ebx
+  800636:	6a 3f                	push   $0x3f
+  800638:	ff 55 08             	call   *0x8(%ebp)
+  80063b:	83 c4 10             	add    $0x10,%esp
+  80063e:	eb c8                	jmp    800608 <vprintfmt+0x200>
+  800640:	8b 75 08             	mov    0x8(%ebp),%esi
+  800643:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800646:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800649:	01 d0                	add    %edx,%eax
+  80064b:	29 c8                	sub    %ecx,%eax
+  80064d:	89 c7                	mov    %eax,%edi
+  80064f:	eb 13                	jmp    800664 <vprintfmt+0x25c>
+  800651:	8b 75 08             	mov    0x8(%ebp),%esi
+  800654:	eb ed                	jmp    800643 <vprintfmt+0x23b>
+  800656:	83 ec 08             	sub    $0x8,%esp
+  800659:	53                   	push   %ebx
+  80065a:	6a 20                	push   $0x20
+  80065c:	ff d6                	call   *%esi
+  80065e:	83 ef 01             	sub    $0x1,%edi
+  800661:	83 c4 10             	add    $0x10,%esp
+  800664:	85 ff                	test   %edi,%edi
+  800666:	7f ee                	jg     800656 <vprintfmt+0x24e>
+  800668:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80066b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066e:	e9 6b 01 00 00       	jmp    8007de <vprintfmt+0x3d6>
+  800673:	83 f9 01             	cmp    $0x1,%ecx
+  800676:	7f 1f                	jg     800697 <vprintfmt+0x28f>
+  800678:	85 c9                	test   %ecx,%ecx
+  80067a:	74 67                	je     8006e3 <vprintfmt+0x2db>
+  80067c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067f:	8b 00                	mov    (%eax),%eax
+  800681:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800684:	89 c1                	mov    %eax,%ecx
+  800686:	c1 f9 1f             	sar    $0x1f,%ecx
+  800689:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80068c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068f:	8d 40 04             	lea    0x4(%eax),%eax
+  800692:	89 45 14             	mov    %eax,0x14(%ebp)
+  800695:	eb 17                	jmp    8006ae <vprintfmt+0x2a6>
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	8b 50 04             	mov    0x4(%eax),%edx
+  80069d:	8b 00                	mov    (%eax),%eax
+  80069f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006a2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ae:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006b1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006b4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006b9:	85 c9                	test   %ecx,%ecx
+  8006bb:	0f 89 03 01 00 00    	jns    8007c4 <vprintfmt+0x3bc>
+  8006c1:	83 ec 08             	sub    $0x8,%esp
+  8006c4:	53                   	push   %ebx
+  8006c5:	6a 2d                	push   $0x2d
+  8006c7:	ff d6                	call   *%esi
+  8006c9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006cc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006cf:	f7 da                	neg    %edx
+  8006d1:	83 d1 00             	adc    $0x0,%ecx
+  8006d4:	f7 d9                	neg    %ecx
+  8006d6:	83 c4 10             	add    $0x10,%esp
+  8006d9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006de:	e9 e1 00 00 00       	jmp    8007c4 <vprintfmt+0x3bc>
+  8006e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e6:	8b 00                	mov    (%eax),%eax
+  8006e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006eb:	89 c1                	mov    %eax,%ecx
+  8006ed:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006f0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006fc:	eb b0                	jmp    8006ae <vprintfmt+0x2a6>
+  8006fe:	83 f9 01             	cmp    $0x1,%ecx
+  800701:	7f 1e                	jg     800721 <vprintfmt+0x319>
+  800703:	85 c9                	test   %ecx,%ecx
+  800705:	74 32                	je     800739 <vprintfmt+0x331>
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8b 10                	mov    (%eax),%edx
+  80070c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800711:	8d 40 04             	lea    0x4(%eax),%eax
+  800714:	89 45 14             	mov    %eax,0x14(%ebp)
+  800717:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80071c:	e9 a3 00 00 00       	jmp    8007c4 <vprintfmt+0x3bc>
+  800721:	8b 45 14             	mov    0x14(%ebp),%eax
+  800724:	8b 10                	mov    (%eax),%edx
+  800726:	8b 48 04             	mov    0x4(%eax),%ecx
+  800729:	8d 40 08             	lea    0x8(%eax),%eax
+  80072c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80072f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800734:	e9 8b 00 00 00       	jmp    8007c4 <vprintfmt+0x3bc>
+  800739:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073c:	8b 10                	mov    (%eax),%edx
+  80073e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800743:	8d 40 04             	lea    0x4(%eax),%eax
+  800746:	89 45 14             	mov    %eax,0x14(%ebp)
+  800749:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80074e:	eb 74                	jmp    8007c4 <vprintfmt+0x3bc>
+  800750:	83 f9 01             	cmp    $0x1,%ecx
+  800753:	7f 1b                	jg     800770 <vprintfmt+0x368>
+  800755:	85 c9                	test   %ecx,%ecx
+  800757:	74 2c                	je     800785 <vprintfmt+0x37d>
+  800759:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075c:	8b 10                	mov    (%eax),%edx
+  80075e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800763:	8d 40 04             	lea    0x4(%eax),%eax
+  800766:	89 45 14             	mov    %eax,0x14(%ebp)
+  800769:	bf 08 00 00 00       	mov    $0x8,%edi
+  80076e:	eb 54                	jmp    8007c4 <vprintfmt+0x3bc>
+  800770:	8b 45 14             	mov    0x14(%ebp),%eax
+  800773:	8b 10                	mov    (%eax),%edx
+  800775:	8b 48 04             	mov    0x4(%eax),%ecx
+  800778:	8d 40 08             	lea    0x8(%eax),%eax
+  80077b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80077e:	bf 08 00 00 00       	mov    $0x8,%edi
+  800783:	eb 3f                	jmp    8007c4 <vprintfmt+0x3bc>
+  800785:	8b 45 14             	mov    0x14(%ebp),%eax
+  800788:	8b 10                	mov    (%eax),%edx
+  80078a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80078f:	8d 40 04             	lea    0x4(%eax),%eax
+  800792:	89 45 14             	mov    %eax,0x14(%ebp)
+  800795:	bf 08 00 00 00       	mov    $0x8,%edi
+  80079a:	eb 28                	jmp    8007c4 <vprintfmt+0x3bc>
+  80079c:	83 ec 08             	sub    $0x8,%esp
+  80079f:	53                   	push   %ebx
+  8007a0:	6a 30                	push   $0x30
+  8007a2:	ff d6                	call   *%esi
+  8007a4:	83 c4 08             	add    $0x8,%esp
+  8007a7:	53                   	push   %ebx
+  8007a8:	6a 78                	push   $0x78
+  8007aa:	ff d6                	call   *%esi
+  8007ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007af:	8b 10                	mov    (%eax),%edx
+  8007b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b6:	83 c4 10             	add    $0x10,%esp
+  8007b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007bf:	bf 10 00 00 00       	mov    $0x10,%edi
+  8007c4:	83 ec 0c             	sub    $0xc,%esp
+  8007c7:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007cb:	50                   	push   %eax
+  8007cc:	ff 75 e0             	push   -0x20(%ebp)
+  8007cf:	57                   	push   %edi
+  8007d0:	51                   	push   %ecx
+  8007d1:	52                   	push   %edx
+  8007d2:	89 da                	mov    %ebx,%edx
+  8007d4:	89 f0                	mov    %esi,%eax
+  8007d6:	e8 4a fb ff ff       	call   800325 <printnum>
+  8007db:	83 c4 20             	add    $0x20,%esp
+  8007de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8007e1:	e9 40 fc ff ff       	jmp    800426 <vprintfmt+0x1e>
+  8007e6:	83 f9 01             	cmp    $0x1,%ecx
+  8007e9:	7f 1b                	jg     800806 <vprintfmt+0x3fe>
+  8007eb:	85 c9                	test   %ecx,%ecx
+  8007ed:	74 2c                	je     80081b <vprintfmt+0x413>
+  8007ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f2:	8b 10                	mov    (%eax),%edx
+  8007f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ff:	bf 10 00 00 00       	mov    $0x10,%edi
+  800804:	eb be                	jmp    8007c4 <vprintfmt+0x3bc>
+  800806:	8b 45 14             	mov    0x14(%ebp),%eax
+  800809:	8b 10                	mov    (%eax),%edx
+  80080b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80080e:	8d 40 08             	lea    0x8(%eax),%eax
+  800811:	89 45 14             	mov    %eax,0x14(%ebp)
+  800814:	bf 10 00 00 00       	mov    $0x10,%edi
+  800819:	eb a9                	jmp    8007c4 <vprintfmt+0x3bc>
+  80081b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081e:	8b 10                	mov    (%eax),%edx
+  800820:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800825:	8d 40 04             	lea    0x4(%eax),%eax
+  800828:	89 45 14             	mov    %eax,0x14(%ebp)
+  80082b:	bf 10 00 00 00       	mov    $0x10,%edi
+  800830:	eb 92                	jmp    8007c4 <vprintfmt+0x3bc>
+  800832:	83 ec 08             	sub    $0x8,%esp
+  800835:	53                   	push   %ebx
+  800836:	6a 25                	push   $0x25
+  800838:	ff d6                	call   *%esi
+  80083a:	83 c4 10             	add    $0x10,%esp
+  80083d:	eb 9f                	jmp    8007de <vprintfmt+0x3d6>
+  80083f:	83 ec 08             	sub    $0x8,%esp
+  800842:	53                   	push   %ebx
+  800843:	6a 25                	push   $0x25
+  800845:	ff d6                	call   *%esi
+  800847:	83 c4 10             	add    $0x10,%esp
+  80084a:	89 f8                	mov    %edi,%eax
+  80084c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800850:	74 05                	je     800857 <vprintfmt+0x44f>
+  800852:	83 e8 01             	sub    $0x1,%eax
+  800855:	eb f5                	jmp    80084c <vprintfmt+0x444>
+  800857:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80085a:	eb 82                	jmp    8007de <vprintfmt+0x3d6>
+
+0080085c <vsnprintf>:
+  80085c:	55                   	push   %ebp
+  80085d:	89 e5                	mov    %esp,%ebp
+  80085f:	83 ec 18             	sub    $0x18,%esp
+  800862:	8b 45 08             	mov    0x8(%ebp),%eax
+  800865:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800868:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80086b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80086f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800872:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800879:	85 c0                	test   %eax,%eax
+  80087b:	74 26                	je     8008a3 <vsnprintf+0x47>
+  80087d:	85 d2                	test   %edx,%edx
+  80087f:	7e 22                	jle    8008a3 <vsnprintf+0x47>
+  800881:	ff 75 14             	push   0x14(%ebp)
+  800884:	ff 75 10             	push   0x10(%ebp)
+  800887:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80088a:	50                   	push   %eax
+  80088b:	68 ce 03 80 00       	push   $0x8003ce
+  800890:	e8 73 fb ff ff       	call   800408 <vprintfmt>
+  800895:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800898:	c6 00 00             	movb   $0x0,(%eax)
+  80089b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80089e:	83 c4 10             	add    $0x10,%esp
+  8008a1:	c9                   	leave
+  8008a2:	c3                   	ret
+  8008a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008a8:	eb f7                	jmp    8008a1 <vsnprintf+0x45>
+
+008008aa <snprintf>:
+  8008aa:	55                   	push   %ebp
+  8008ab:	89 e5                	mov    %esp,%ebp
+  8008ad:	83 ec 08             	sub    $0x8,%esp
+  8008b0:	8d 45 14             	lea    0x14(%ebp),%eax
+  8008b3:	50                   	push   %eax
+  8008b4:	ff 75 10             	push   0x10(%ebp)
+  8008b7:	ff 75 0c             	push   0xc(%ebp)
+  8008ba:	ff 75 08             	push   0x8(%ebp)
+  8008bd:	e8 9a ff ff ff       	call   80085c <vsnprintf>
+  8008c2:	c9                   	leave
+  8008c3:	c3                   	ret
+
+008008c4 <copy_fwd>:
+  8008c4:	55                   	push   %ebp
+  8008c5:	89 e5                	mov    %esp,%ebp
+  8008c7:	57                   	push   %edi
+  8008c8:	56                   	push   %esi
+  8008c9:	53                   	push   %ebx
+  8008ca:	89 c7                	mov    %eax,%edi
+  8008cc:	89 d6                	mov    %edx,%esi
+  8008ce:	89 c8                	mov    %ecx,%eax
+  8008d0:	83 f9 0f             	cmp    $0xf,%ecx
+  8008d3:	76 1c                	jbe    8008f1 <copy_fwd+0x2d>
+  8008d5:	89 f9                	mov    %edi,%ecx
+  8008d7:	f7 d9                	neg    %ecx
+  8008d9:	89 cb                	mov    %ecx,%ebx
+  8008db:	83 e3 03             	and    $0x3,%ebx
+  8008de:	29 d8                	sub    %ebx,%eax
+  8008e0:	89 c2                	mov    %eax,%edx
+  8008e2:	c1 ea 02             	shr    $0x2,%edx
+  8008e5:	83 e0 03             	and    $0x3,%eax
+  8008e8:	89 d9                	mov    %ebx,%ecx
+  8008ea:	fc                   	cld
+  8008eb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8008ed:	89 d1                	mov    %edx,%ecx
+  8008ef:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008f1:	89 c1                	mov    %eax,%ecx
+  8008f3:	fc                   	cld
+  8008f4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8008f6:	5b                   	pop    %ebx
+  8008f7:	5e                   	pop    %esi
+  8008f8:	5f                   	pop    %edi
+  8008f9:	5d                   	pop    %ebp
+  8008fa:	c3                   	ret
+
+008008fb <have_sse2>:
+  8008fb:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800902:	78 06                	js     80090a <have_sse2+0xf>
+  800904:	a1 04 20 80 00       	mov    0x802004,%eax
+  800909:	c3                   	ret
+  80090a:	55                   	push   %ebp
+  80090b:	89 e5                	mov    %esp,%ebp
+  80090d:	53                   	push   %ebx
+  80090e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800913:	0f a2                	cpuid
+  800915:	c1 ea 1a             	shr    $0x1a,%edx
+  800918:	83 e2 01             	and    $0x1,%edx
+  80091b:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800921:	a1 04 20 80 00       	mov    0x802004,%eax
+  800926:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800929:	c9                   	leave
+  80092a:	c3                   	ret
+
+0080092b <strlen>:
+  80092b:	55                   	push   %ebp
+  80092c:	89 e5                	mov    %esp,%ebp
+  80092e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800931:	b8 00 00 00 00       	mov    $0x0,%eax
+  800936:	eb 03                	jmp    80093b <strlen+0x10>
+  800938:	83 c0 01             	add    $0x1,%eax
+  80093b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80093f:	75 f7                	jne    800938 <strlen+0xd>
+  800941:	5d                   	pop    %ebp
+  800942:	c3                   	ret
+
+00800943 <strnlen>:
+  800943:	55                   	push   %ebp
+  800944:	89 e5                	mov    %esp,%ebp
+  800946:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800949:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80094c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800951:	eb 03                	jmp    800956 <strnlen+0x13>
+  800953:	83 c0 01             	add    $0x1,%eax
+  800956:	39 d0                	cmp    %edx,%eax
+  800958:	74 08                	je     800962 <strnlen+0x1f>
+  80095a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80095e:	75 f3                	jne    800953 <strnlen+0x10>
+  800960:	89 c2                	mov    %eax,%edx
+  800962:	89 d0                	mov    %edx,%eax
+  800964:	5d                   	pop    %ebp
+  800965:	c3                   	ret
+
+00800966 <strcpy>:
+  800966:	55                   	push   %ebp
+  800967:	89 e5                	mov    %esp,%ebp
+  800969:	53                   	push   %ebx
+  80096a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80096d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800970:	b8 00 00 00 00       	mov    $0x0,%eax
+  800975:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800979:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80097c:	83 c0 01             	add    $0x1,%eax
+  80097f:	84 d2                	test   %dl,%dl
+  800981:	75 f2                	jne    800975 <strcpy+0xf>
+  800983:	89 c8                	mov    %ecx,%eax
+  800985:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800988:	c9                   	leave
+  800989:	c3                   	ret
+
+0080098a <strcat>:
+  80098a:	55                   	push   %ebp
+  80098b:	89 e5                	mov    %esp,%ebp
+  80098d:	53                   	push   %ebx
+  80098e:	83 ec 10             	sub    $0x10,%esp
+  800991:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800994:	53                   	push   %ebx
+  800995:	e8 91 ff ff ff       	call   80092b <strlen>
+  80099a:	83 c4 08             	add    $0x8,%esp
+  80099d:	ff 75 0c             	push   0xc(%ebp)
+  8009a0:	01 d8                	add    %ebx,%eax
+  8009a2:	50                   	push   %eax
+  8009a3:	e8 be ff ff ff       	call   800966 <strcpy>
+  8009a8:	89 d8                	mov    %ebx,%eax
+  8009aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ad:	c9                   	leave
+  8009ae:	c3                   	ret
+
+008009af <strncpy>:
+  8009af:	55                   	push   %ebp
+  8009b0:	89 e5                	mov    %esp,%ebp
+  8009b2:	56                   	push   %esi
+  8009b3:	53                   	push   %ebx
+  8009b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009ba:	89 f3                	mov    %esi,%ebx
+  8009bc:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009bf:	89 f0                	mov    %esi,%eax
+  8009c1:	eb 0f                	jmp    8009d2 <strncpy+0x23>
+  8009c3:	83 c0 01             	add    $0x1,%eax
+  8009c6:	0f b6 0a             	movzbl (%edx),%ecx
+  8009c9:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009cc:	80 f9 01             	cmp    $0x1,%cl
+  8009cf:	83 da ff             	sbb    $0xffffffff,%edx
+  8009d2:	39 d8                	cmp    %ebx,%eax
+  8009d4:	75 ed                	jne    8009c3 <strncpy+0x14>
+  8009d6:	89 f0                	mov    %esi,%eax
+  8009d8:	5b                   	pop    %ebx
+  8009d9:	5e                   	pop    %esi
+  8009da:	5d                   	pop    %ebp
+  8009db:	c3                   	ret
+
+008009dc <strlcpy>:
+  8009dc:	55                   	push   %ebp
+  8009dd:	89 e5                	mov    %esp,%ebp
+  8009df:	56                   	push   %esi
+  8009e0:	53                   	push   %ebx
+  8009e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009ea:	89 f0                	mov    %esi,%eax
+  8009ec:	85 d2                	test   %edx,%edx
+  8009ee:	74 21                	je     800a11 <strlcpy+0x35>
+  8009f0:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009f4:	89 f2                	mov    %esi,%edx
+  8009f6:	eb 09                	jmp    800a01 <strlcpy+0x25>
+  8009f8:	83 c1 01             	add    $0x1,%ecx
+  8009fb:	83 c2 01             	add    $0x1,%edx
+  8009fe:	88 5a ff             	mov    %bl,-0x1(%edx)
+  800a01:	39 c2                	cmp    %eax,%edx
+  800a03:	74 09                	je     800a0e <strlcpy+0x32>
+  800a05:	0f b6 19             	movzbl (%ecx),%ebx
+  800a08:	84 db                	test   %bl,%bl
+  800a0a:	75 ec                	jne    8009f8 <strlcpy+0x1c>
+  800a0c:	89 d0                	mov    %edx,%eax
+  800a0e:	c6 00 00             	movb   $0x0,(%eax)
+  800a11:	29 f0                	sub    %esi,%eax
+  800a13:	5b                   	pop    %ebx
+  800a14:	5e                   	pop    %esi
+  800a15:	5d                   	pop    %ebp
+  800a16:	c3                   	ret
+
+00800a17 <strcmp>:
+  800a17:	55                   	push   %ebp
+  800a18:	89 e5                	mov    %esp,%ebp
+  800a1a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a20:	eb 06                	jmp    800a28 <strcmp+0x11>
+  800a22:	83 c1 01             	add    $0x1,%ecx
+  800a25:	83 c2 01             	add    $0x1,%edx
+  800a28:	0f b6 01             	movzbl (%ecx),%eax
+  800a2b:	84 c0                	test   %al,%al
+  800a2d:	74 04                	je     800a33 <strcmp+0x1c>
+  800a2f:	3a 02                	cmp    (%edx),%al
+  800a31:	74 ef                	je     800a22 <strcmp+0xb>
+  800a33:	0f b6 c0             	movzbl %al,%eax
+  800a36:	0f b6 12             	movzbl (%edx),%edx
+  800a39:	29 d0                	sub    %edx,%eax
+  800a3b:	5d                   	pop    %ebp
+  800a3c:	c3                   	ret
+
+00800a3d <strncmp>:
+  800a3d:	55                   	push   %ebp
+  800a3e:	89 e5                	mov    %esp,%ebp
+  800a40:	53                   	push   %ebx
+  800a41:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a47:	8b 55 10             	mov    0x10(%ebp),%edx
+  800a4a:	eb 09                	jmp    800a55 <strncmp+0x18>
+  800a4c:	83 ea 01             	sub    $0x1,%edx
+  800a4f:	83 c0 01             	add    $0x1,%eax
+  800a52:	83 c1 01             	add    $0x1,%ecx
+  800a55:	85 d2                	test   %edx,%edx
+  800a57:	74 18                	je     800a71 <strncmp+0x34>
+  800a59:	0f b6 18             	movzbl (%eax),%ebx
+  800a5c:	84 db                	test   %bl,%bl
+  800a5e:	74 04                	je     800a64 <strncmp+0x27>
+  800a60:	3a 19                	cmp    (%ecx),%bl
+  800a62:	74 e8                	je     800a4c <strncmp+0xf>
+  800a64:	0f b6 00             	movzbl (%eax),%eax
+  800a67:	0f b6 11             	movzbl (%ecx),%edx
+  800a6a:	29 d0                	sub    %edx,%eax
+  800a6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a6f:	c9                   	leave
+  800a70:	c3                   	ret
+  800a71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a76:	eb f4                	jmp    800a6c <strncmp+0x2f>
+
+00800a78 <strchr>:
+  800a78:	55                   	push   %ebp
+  800a79:	89 e5                	mov    %esp,%ebp
+  800a7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a7e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800a82:	eb 03                	jmp    800a87 <strchr+0xf>
+  800a84:	83 c0 01             	add    $0x1,%eax
+  800a87:	0f b6 10             	movzbl (%eax),%edx
+  800a8a:	84 d2                	test   %dl,%dl
+  800a8c:	74 06                	je     800a94 <strchr+0x1c>
+  800a8e:	38 ca                	cmp    %cl,%dl
+  800a90:	75 f2                	jne    800a84 <strchr+0xc>
+  800a92:	eb 05                	jmp    800a99 <strchr+0x21>
+  800a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a99:	5d                   	pop    %ebp
+  800a9a:	c3                   	ret
+
+00800a9b <strfind>:
+  800a9b:	55                   	push   %ebp
+  800a9c:	89 e5                	mov    %esp,%ebp
+  800a9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800aa5:	0f b6 10             	movzbl (%eax),%edx
+  800aa8:	38 ca                	cmp    %cl,%dl
+  800aaa:	74 09                	je     800ab5 <strfind+0x1a>
+  800aac:	84 d2                	test   %dl,%dl
+  800aae:	74 05                	je     800ab5 <strfind+0x1a>
+  800ab0:	83 c0 01             	add    $0x1,%eax
+  800ab3:	eb f0                	jmp    800aa5 <strfind+0xa>
+  800ab5:	5d                   	pop    %ebp
+  800ab6:	c3                   	ret
+
+00800ab7 <memset>:
+  800ab7:	55                   	push   %ebp
+  800ab8:	89 e5                	mov    %esp,%ebp
+  800aba:	57                   	push   %edi
+  800abb:	56                   	push   %esi
+  800abc:	53                   	push   %ebx
+  800abd:	83 ec 04             	sub    $0x4,%esp
+  800ac0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ac3:	8b 55 10             	mov    0x10(%ebp),%edx
+  800ac6:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  800aca:	89 f7                	mov    %esi,%edi
+  800acc:	83 fa 0f             	cmp    $0xf,%edx
+  800acf:	76 24                	jbe    800af5 <memset+0x3e>
+  800ad1:	89 f1                	mov    %esi,%ecx
+  800ad3:	f7 d9                	neg    %ecx
+  800ad5:	83 e1 03             	and    $0x3,%ecx
+  800ad8:	29 ca                	sub    %ecx,%edx
+  800ada:	89 d0                	mov    %edx,%eax
+  800adc:	c1 e8 02             	shr    $0x2,%eax
+  800adf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  800ae2:	83 e2 03             	and    $0x3,%edx
+  800ae5:	89 d8                	mov    %ebx,%eax
+  800ae7:	fc                   	cld
+  800ae8:	f3 aa                	rep stos %al,%es:(%edi)
+  800aea:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  800af0:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  800af3:	f3 ab                	rep stos %eax,%es:(%edi)
+  800af5:	89 d1                	mov    %edx,%ecx
+  800af7:	89 d8                	mov    %ebx,%eax
+  800af9:	fc                   	cld
+  800afa:	f3 aa                	rep stos %al,%es:(%edi)
+  800afc:	89 f0                	mov    %esi,%eax
+  800afe:	83 c4 04             	add    $0x4,%esp
+  800b01:	5b                   	pop    %ebx
+  800b02:	5e                   	pop    %esi
+  800b03:	5f                   	pop    %edi
+  800b04:	5d                   	pop    %ebp
+  800b05:	c3                   	ret
+
+00800b06 <memmove>:
+  800b06:	55                   	push   %ebp
+  800b07:	89 e5                	mov    %esp,%ebp
+  800b09:	57                   	push   %edi
+  800b0a:	56                   	push   %esi
+  800b0b:	53                   	push   %ebx
+  800b0c:	83 ec 0c             	sub    $0xc,%esp
+  800b0f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b12:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b15:	8b 45 10             	mov    0x10(%ebp),%eax
+  800b18:	85 c0                	test   %eax,%eax
+  800b1a:	74 14                	je     800b30 <memmove+0x2a>
+  800b1c:	39 da                	cmp    %ebx,%edx
+  800b1e:	73 07                	jae    800b27 <memmove+0x21>
+  800b20:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  800b23:	39 cb                	cmp    %ecx,%ebx
+  800b25:	72 13                	jb     800b3a <memmove+0x34>
+  800b27:	89 c1                	mov    %eax,%ecx
+  800b29:	89 d8                	mov    %ebx,%eax
+  800b2b:	e8 94 fd ff ff       	call   8008c4 <copy_fwd>
+  800b30:	89 d8                	mov    %ebx,%eax
+  800b32:	83 c4 0c             	add    $0xc,%esp
+  800b35:	5b                   	pop    %ebx
+  800b36:	5e                   	pop    %esi
+  800b37:	5f                   	pop    %edi
+  800b38:	5d                   	pop    %ebp
+  800b39:	c3                   	ret
+  800b3a:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800b3d:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800b40:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800b43:	83 f8 0f             	cmp    $0xf,%eax
+  800b46:	76 23                	jbe    800b6b <memmove+0x65>
+  800b48:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800b4b:	83 e1 03             	and    $0x3,%ecx
+  800b4e:	29 c8                	sub    %ecx,%eax
+  800b50:	89 c2                	mov    %eax,%edx
+  800b52:	c1 ea 02             	shr    $0x2,%edx
+  800b55:	83 e0 03             	and    $0x3,%eax
+  800b58:	fd                   	std
+  800b59:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b5b:	83 ef 03             	sub    $0x3,%edi
+  800b5e:	83 ee 03             	sub    $0x3,%esi
+  800b61:	89 d1                	mov    %edx,%ecx
+  800b63:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b65:	83 c7 03             	add    $0x3,%edi
+  800b68:	83 c6 03             	add    $0x3,%esi
+  800b6b:	89 c1                	mov    %eax,%ecx
+  800b6d:	fd                   	std
+  800b6e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b70:	fc                   	cld
+  800b71:	eb bd                	jmp    800b30 <memmove+0x2a>
+
+00800b73 <memcpy>:
+  800b73:	55                   	push   %ebp
+  800b74:	89 e5                	mov    %esp,%ebp
+  800b76:	53                   	push   %ebx
+  800b77:	83 ec 04             	sub    $0x4,%esp
+  800b7a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b7d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b80:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b83:	89 d8                	mov    %ebx,%eax
+  800b85:	e8 3a fd ff ff       	call   8008c4 <copy_fwd>
+  800b8a:	89 d8                	mov    %ebx,%eax
+  800b8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b8f:	c9                   	leave
+  800b90:	c3                   	ret
+
+00800b91 <page_copy>:
+  800b91:	55                   	push   %ebp
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	57                   	push   %edi
+  800b95:	56                   	push   %esi
+  800b96:	53                   	push   %ebx
+  800b97:	83 ec 0c             	sub    $0xc,%esp
+  800b9a:	e8 5c fd ff ff       	call   8008fb <have_sse2>
+  800b9f:	85 c0                	test   %eax,%eax
+  800ba1:	74 39                	je     800bdc <page_copy+0x4b>
+  800ba3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ba6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ba9:	be 00 01 00 00       	mov    $0x100,%esi
+  800bae:	8b 03                	mov    (%ebx),%eax
+  800bb0:	8b 53 04             	mov    0x4(%ebx),%edx
+  800bb3:	0f c3 01             	movnti %eax,(%ecx)
+  800bb6:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800bba:	8b 43 08             	mov    0x8(%ebx),%eax
+  800bbd:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800bc0:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800bc4:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800bc8:	83 c3 10             	add    $0x10,%ebx
+  800bcb:	83 c1 10             	add    $0x10,%ecx
+  800bce:	4e                   	dec    %esi
+  800bcf:	75 dd                	jne    800bae <page_copy+0x1d>
+  800bd1:	0f ae f8             	sfence
+  800bd4:	83 c4 0c             	add    $0xc,%esp
+  800bd7:	5b                   	pop    %ebx
+  800bd8:	5e                   	pop    %esi
+  800bd9:	5f                   	pop    %edi
+  800bda:	5d                   	pop    %ebp
+  800bdb:	c3                   	ret
+  800bdc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bdf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800be2:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800be7:	fc                   	cld
+  800be8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bea:	eb e8                	jmp    800bd4 <page_copy+0x43>
+
+00800bec <page_zero>:
+  800bec:	55                   	push   %ebp
+  800bed:	89 e5                	mov    %esp,%ebp
+  800bef:	57                   	push   %edi
+  800bf0:	83 ec 04             	sub    $0x4,%esp
+  800bf3:	e8 03 fd ff ff       	call   8008fb <have_sse2>
+  800bf8:	85 c0                	test   %eax,%eax
+  800bfa:	74 3a                	je     800c36 <page_zero+0x4a>
+  800bfc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bff:	ba 80 00 00 00       	mov    $0x80,%edx
+  800c04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c09:	0f c3 08             	movnti %ecx,(%eax)
+  800c0c:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800c10:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800c14:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800c18:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800c1c:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800c20:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800c24:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800c28:	83 c0 20             	add    $0x20,%eax
+  800c2b:	4a                   	dec    %edx
+  800c2c:	75 db                	jne    800c09 <page_zero+0x1d>
+  800c2e:	0f ae f8             	sfence
+  800c31:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c34:	c9                   	leave
+  800c35:	c3                   	ret
+  800c36:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c39:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800c3e:	fc                   	cld
+  800c3f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c41:	eb ee                	jmp    800c31 <page_zero+0x45>
+
+00800c43 <memcmp>:
+  800c43:	55                   	push   %ebp
+  800c44:	89 e5                	mov    %esp,%ebp
+  800c46:	56                   	push   %esi
+  800c47:	53                   	push   %ebx
+  800c48:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c4b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c4e:	89 c6                	mov    %eax,%esi
+  800c50:	03 75 10             	add    0x10(%ebp),%esi
+  800c53:	eb 06                	jmp    800c5b <memcmp+0x18>
+  800c55:	83 c0 01             	add    $0x1,%eax
+  800c58:	83 c2 01             	add    $0x1,%edx
+  800c5b:	39 f0                	cmp    %esi,%eax
+  800c5d:	74 14                	je     800c73 <memcmp+0x30>
+  800c5f:	0f b6 08             	movzbl (%eax),%ecx
+  800c62:	0f b6 1a             	movzbl (%edx),%ebx
+  800c65:	38 d9                	cmp    %bl,%cl
+  800c67:	74 ec                	je     800c55 <memcmp+0x12>
+  800c69:	0f b6 c1             	movzbl %cl,%eax
+  800c6c:	0f b6 db             	movzbl %bl,%ebx
+  800c6f:	29 d8                	sub    %ebx,%eax
+  800c71:	eb 05                	jmp    800c78 <memcmp+0x35>
+  800c73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c78:	5b                   	pop    %ebx
+  800c79:	5e                   	pop    %esi
+  800c7a:	5d                   	pop    %ebp
+  800c7b:	c3                   	ret
+
+00800c7c <memfind>:
+  800c7c:	55                   	push   %ebp
+  800c7d:	89 e5                	mov    %esp,%ebp
+  800c7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c85:	89 c2                	mov    %eax,%edx
+  800c87:	03 55 10             	add    0x10(%ebp),%edx
+  800c8a:	eb 03                	jmp    800c8f <memfind+0x13>
+  800c8c:	83 c0 01             	add    $0x1,%eax
+  800c8f:	39 d0                	cmp    %edx,%eax
+  800c91:	73 04                	jae    800c97 <memfind+0x1b>
+  800c93:	38 08                	cmp    %cl,(%eax)
+  800c95:	75 f5                	jne    800c8c <memfind+0x10>
+  800c97:	5d                   	pop    %ebp
+  800c98:	c3                   	ret
+
+00800c99 <strtol>:
+  800c99:	55                   	push   %ebp
+  800c9a:	89 e5                	mov    %esp,%ebp
+  800c9c:	57                   	push   %edi
+  800c9d:	56                   	push   %esi
+  800c9e:	53                   	push   %ebx
+  800c9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ca5:	eb 03                	jmp    800caa <strtol+0x11>
+  800ca7:	83 c2 01             	add    $0x1,%edx
+  800caa:	0f b6 02             	movzbl (%edx),%eax
+  800cad:	3c 20                	cmp    $0x20,%al
+  800caf:	74 f6                	je     800ca7 <strtol+0xe>
+  800cb1:	3c 09                	cmp    $0x9,%al
+  800cb3:	74 f2                	je     800ca7 <strtol+0xe>
+  800cb5:	3c 2b                	cmp    $0x2b,%al
+  800cb7:	74 2a                	je     800ce3 <strtol+0x4a>
+  800cb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cbe:	3c 2d                	cmp    $0x2d,%al
+  800cc0:	74 2b                	je     800ced <strtol+0x54>
+  800cc2:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cc8:	75 0f                	jne    800cd9 <strtol+0x40>
+  800cca:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ccd:	74 28                	je     800cf7 <strtol+0x5e>
+  800ccf:	85 db                	test   %ebx,%ebx
+  800cd1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cd6:	0f 44 d8             	cmove  %eax,%ebx
+  800cd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cde:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ce1:	eb 46                	jmp    800d29 <strtol+0x90>
+  800ce3:	83 c2 01             	add    $0x1,%edx
+  800ce6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ceb:	eb d5                	jmp    800cc2 <strtol+0x29>
+  800ced:	83 c2 01             	add    $0x1,%edx
+  800cf0:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cf5:	eb cb                	jmp    800cc2 <strtol+0x29>
+  800cf7:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cfb:	74 0e                	je     800d0b <strtol+0x72>
+  800cfd:	85 db                	test   %ebx,%ebx
+  800cff:	75 d8                	jne    800cd9 <strtol+0x40>
+  800d01:	83 c2 01             	add    $0x1,%edx
+  800d04:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d09:	eb ce                	jmp    800cd9 <strtol+0x40>
+  800d0b:	83 c2 02             	add    $0x2,%edx
+  800d0e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d13:	eb c4                	jmp    800cd9 <strtol+0x40>
+  800d15:	0f be c0             	movsbl %al,%eax
+  800d18:	83 e8 30             	sub    $0x30,%eax
+  800d1b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d1e:	7d 3a                	jge    800d5a <strtol+0xc1>
+  800d20:	83 c2 01             	add    $0x1,%edx
+  800d23:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d27:	01 c1                	add    %eax,%ecx
+  800d29:	0f b6 02             	movzbl (%edx),%eax
+  800d2c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d2f:	89 f3                	mov    %esi,%ebx
+  800d31:	80 fb 09             	cmp    $0x9,%bl
+  800d34:	76 df                	jbe    800d15 <strtol+0x7c>
+  800d36:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d39:	89 f3                	mov    %esi,%ebx
+  800d3b:	80 fb 19             	cmp    $0x19,%bl
+  800d3e:	77 08                	ja     800d48 <strtol+0xaf>
+  800d40:	0f be c0             	movsbl %al,%eax
+  800d43:	83 e8 57             	sub    $0x57,%eax
+  800d46:	eb d3                	jmp    800d1b <strtol+0x82>
+  800d48:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d4b:	89 f3                	mov    %esi,%ebx
+  800d4d:	80 fb 19             	cmp    $0x19,%bl
+  800d50:	77 08                	ja     800d5a <strtol+0xc1>
+  800d52:	0f be c0             	movsbl %al,%eax
+  800d55:	83 e8 37             	sub    $0x37,%eax
+  800d58:	eb c1                	jmp    800d1b <strtol+0x82>
+  800d5a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d5e:	74 05                	je     800d65 <strtol+0xcc>
+  800d60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d63:	89 10                	mov    %edx,(%eax)
+  800d65:	89 c8                	mov    %ecx,%eax
+  800d67:	f7 d8                	neg    %eax
+  800d69:	85 ff                	test   %edi,%edi
+  800d6b:	0f 45 c8             	cmovne %eax,%ecx
+  800d6e:	89 c8                	mov    %ecx,%eax
+  800d70:	5b                   	pop    %ebx
+  800d71:	5e                   	pop    %esi
+  800d72:	5f                   	pop    %edi
+  800d73:	5d                   	pop    %ebp
+  800d74:	c3                   	ret
+
+00800d75 <sys_cputs>:
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	57                   	push   %edi
+  800d79:	56                   	push   %esi
+  800d7a:	53                   	push   %ebx
+  800d7b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d82:	78 21                	js     800da5 <sys_cputs+0x30>
+  800d84:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d8b:	75 2d                	jne    800dba <sys_cputs+0x45>
+  800d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d92:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d98:	89 c3                	mov    %eax,%ebx
+  800d9a:	89 c7                	mov    %eax,%edi
+  800d9c:	89 c6                	mov    %eax,%esi
+  800d9e:	cd 30                	int    $0x30
+  800da0:	5b                   	pop    %ebx
+  800da1:	5e                   	pop    %esi
+  800da2:	5f                   	pop    %edi
+  800da3:	5d                   	pop    %ebp
+  800da4:	c3                   	ret
+  800da5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800daa:	0f a2                	cpuid
+  800dac:	c1 ea 0b             	shr    $0xb,%edx
+  800daf:	83 e2 01             	and    $0x1,%edx
+  800db2:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800db8:	eb ca                	jmp    800d84 <sys_cputs+0xf>
+  800dba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc5:	89 c3                	mov    %eax,%ebx
+  800dc7:	89 c7                	mov    %eax,%edi
+  800dc9:	89 c6                	mov    %eax,%esi
+  800dcb:	55                   	push   %ebp
+  800dcc:	68 d5 0d 80 00       	push   $0x800dd5
+  800dd1:	89 e5                	mov    %esp,%ebp
+  800dd3:	0f 34                	sysenter
+  800dd5:	83 c4 04             	add    $0x4,%esp
+  800dd8:	5d                   	pop    %ebp
+  800dd9:	eb c5                	jmp    800da0 <sys_cputs+0x2b>
+
+00800ddb <sys_cgetc>:
+  800ddb:	55                   	push   %ebp
+  800ddc:	89 e5                	mov    %esp,%ebp
+  800dde:	57                   	push   %edi
+  800ddf:	56                   	push   %esi
+  800de0:	53                   	push   %ebx
+  800de1:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800de8:	78 22                	js     800e0c <sys_cgetc+0x31>
+  800dea:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800df1:	75 2e                	jne    800e21 <sys_cgetc+0x46>
+  800df3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dfd:	89 d1                	mov    %edx,%ecx
+  800dff:	89 d3                	mov    %edx,%ebx
+  800e01:	89 d7                	mov    %edx,%edi
+  800e03:	89 d6                	mov    %edx,%esi
+  800e05:	cd 30                	int    $0x30
+  800e07:	5b                   	pop    %ebx
+  800e08:	5e                   	pop    %esi
+  800e09:	5f                   	pop    %edi
+  800e0a:	5d                   	pop    %ebp
+  800e0b:	c3                   	ret
+  800e0c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e11:	0f a2                	cpuid
+  800e13:	c1 ea 0b             	shr    $0xb,%edx
+  800e16:	83 e2 01             	and    $0x1,%edx
+  800e19:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800e1f:	eb c9                	jmp    800dea <sys_cgetc+0xf>
+  800e21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e26:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e2b:	89 d1                	mov    %edx,%ecx
+  800e2d:	89 d3                	mov    %edx,%ebx
+  800e2f:	89 d7                	mov    %edx,%edi
+  800e31:	89 d6                	mov    %edx,%esi
+  800e33:	55                   	push   %ebp
+  800e34:	68 3d 0e 80 00       	push   $0x800e3d
+  800e39:	89 e5                	mov    %esp,%ebp
+  800e3b:	0f 34                	sysenter
+  800e3d:	83 c4 04             	add    $0x4,%esp
+  800e40:	5d                   	pop    %ebp
+  800e41:	eb c4                	jmp    800e07 <sys_cgetc+0x2c>
+
+00800e43 <sys_env_destroy>:
+  800e43:	55                   	push   %ebp
+  800e44:	89 e5                	mov    %esp,%ebp
+  800e46:	57                   	push   %edi
+  800e47:	56                   	push   %esi
+  800e48:	53                   	push   %ebx
+  800e49:	83 ec 0c             	sub    $0xc,%esp
+  800e4c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e53:	78 2a                	js     800e7f <sys_env_destroy+0x3c>
+  800e55:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e5c:	75 36                	jne    800e94 <sys_env_destroy+0x51>
+  800e5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e63:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6b:	89 cb                	mov    %ecx,%ebx
+  800e6d:	89 cf                	mov    %ecx,%edi
+  800e6f:	89 ce                	mov    %ecx,%esi
+  800e71:	cd 30                	int    $0x30
+  800e73:	85 c0                	test   %eax,%eax
+  800e75:	7f 40                	jg     800eb7 <sys_env_destroy+0x74>
+  800e77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7a:	5b                   	pop    %ebx
+  800e7b:	5e                   	pop    %esi
+  800e7c:	5f                   	pop    %edi
+  800e7d:	5d                   	pop    %ebp
+  800e7e:	c3                   	ret
+  800e7f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e84:	0f a2                	cpuid
+  800e86:	c1 ea 0b             	shr    $0xb,%edx
+  800e89:	83 e2 01             	and    $0x1,%edx
+  800e8c:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800e92:	eb c1                	jmp    800e55 <sys_env_destroy+0x12>
+  800e94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e97:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e9c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ea1:	89 cb                	mov    %ecx,%ebx
+  800ea3:	89 cf                	mov    %ecx,%edi
+  800ea5:	89 ce                	mov    %ecx,%esi
+  800ea7:	55                   	push   %ebp
+  800ea8:	68 b1 0e 80 00       	push   $0x800eb1
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	0f 34                	sysenter
+  800eb1:	83 c4 04             	add    $0x4,%esp
+  800eb4:	5d                   	pop    %ebp
+  800eb5:	eb bc                	jmp    800e73 <sys_env_destroy+0x30>
+  800eb7:	83 ec 0c             	sub    $0xc,%esp
+  800eba:	50                   	push   %eax
+  800ebb:	6a 03                	push   $0x3
+  800ebd:	68 04 1e 80 00       	push   $0x801e04
+  800ec2:	6a 49                	push   $0x49
+  800ec4:	68 21 1e 80 00       	push   $0x801e21
+  800ec9:	e8 63 f3 ff ff       	call   800231 <_panic>
+
+00800ece <sys_getenvid>:
+  800ece:	55                   	push   %ebp
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	57                   	push   %edi
+  800ed2:	56                   	push   %esi
+  800ed3:	53                   	push   %ebx
+  800ed4:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800edb:	78 22                	js     800eff <sys_getenvid+0x31>
+  800edd:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800ee4:	75 2e                	jne    800f14 <sys_getenvid+0x46>
+  800ee6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eeb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ef0:	89 d1                	mov    %edx,%ecx
+  800ef2:	89 d3                	mov    %edx,%ebx
+  800ef4:	89 d7                	mov    %edx,%edi
+  800ef6:	89 d6                	mov    %edx,%esi
+  800ef8:	cd 30                	int    $0x30
+  800efa:	5b                   	pop    %ebx
+  800efb:	5e                   	pop    %esi
+  800efc:	5f                   	pop    %edi
+  800efd:	5d                   	pop    %ebp
+  800efe:	c3                   	ret
+  800eff:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f04:	0f a2                	cpuid
+  800f06:	c1 ea 0b             	shr    $0xb,%edx
+  800f09:	83 e2 01             	and    $0x1,%edx
+  800f0c:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800f12:	eb c9                	jmp    800edd <sys_getenvid+0xf>
+  800f14:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f19:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f1e:	89 d1                	mov    %edx,%ecx
+  800f20:	89 d3                	mov    %edx,%ebx
+  800f22:	89 d7                	mov    %edx,%edi
+  800f24:	89 d6                	mov    %edx,%esi
+  800f26:	55                   	push   %ebp
+  800f27:	68 30 0f 80 00       	push   $0x800f30
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	0f 34                	sysenter
+  800f30:	83 c4 04             	add    $0x4,%esp
+  800f33:	5d                   	pop    %ebp
+  800f34:	eb c4                	jmp    800efa <sys_getenvid+0x2c>
+
+00800f36 <sys_yield>:
+  800f36:	55                   	push   %ebp
+  800f37:	89 e5                	mov    %esp,%ebp
+  800f39:	57                   	push   %edi
+  800f3a:	56                   	push   %esi
+  800f3b:	53                   	push   %ebx
+  800f3c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f43:	78 22                	js     800f67 <sys_yield+0x31>
+  800f45:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f4c:	75 2e                	jne    800f7c <sys_yield+0x46>
+  800f4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f53:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f58:	89 d1                	mov    %edx,%ecx
+  800f5a:	89 d3                	mov    %edx,%ebx
+  800f5c:	89 d7                	mov    %edx,%edi
+  800f5e:	89 d6                	mov    %edx,%esi
+  800f60:	cd 30                	int    $0x30
+  800f62:	5b                   	pop    %ebx
+  800f63:	5e                   	pop    %esi
+  800f64:	5f                   	pop    %edi
+  800f65:	5d                   	pop    %ebp
+  800f66:	c3                   	ret
+  800f67:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f6c:	0f a2                	cpuid
+  800f6e:	c1 ea 0b             	shr    $0xb,%edx
+  800f71:	83 e2 01             	and    $0x1,%edx
+  800f74:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800f7a:	eb c9                	jmp    800f45 <sys_yield+0xf>
+  800f7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f81:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f86:	89 d1                	mov    %edx,%ecx
+  800f88:	89 d3                	mov    %edx,%ebx
+  800f8a:	89 d7                	mov    %edx,%edi
+  800f8c:	89 d6                	mov    %edx,%esi
+  800f8e:	55                   	push   %ebp
+  800f8f:	68 98 0f 80 00       	push   $0x800f98
+  800f94:	89 e5                	mov    %esp,%ebp
+  800f96:	0f 34                	sysenter
+  800f98:	83 c4 04             	add    $0x4,%esp
+  800f9b:	5d                   	pop    %ebp
+  800f9c:	eb c4                	jmp    800f62 <sys_yield+0x2c>
+
+00800f9e <sys_env_set_cow>:
+  800f9e:	55                   	push   %ebp
+  800f9f:	89 e5                	mov    %esp,%ebp
+  800fa1:	57                   	push   %edi
+  800fa2:	56                   	push   %esi
+  800fa3:	53                   	push   %ebx
+  800fa4:	83 ec 0c             	sub    $0xc,%esp
+  800fa7:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800fae:	78 2b                	js     800fdb <sys_env_set_cow+0x3d>
+  800fb0:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800fb7:	75 37                	jne    800ff0 <sys_env_set_cow+0x52>
+  800fb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbe:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc9:	89 df                	mov    %ebx,%edi
+  800fcb:	89 de                	mov    %ebx,%esi
+  800fcd:	cd 30                	int    $0x30
+  800fcf:	85 c0                	test   %eax,%eax
+  800fd1:	7f 41                	jg     801014 <sys_env_set_cow+0x76>
+  800fd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd6:	5b                   	pop    %ebx
+  800fd7:	5e                   	pop    %esi
+  800fd8:	5f                   	pop    %edi
+  800fd9:	5d                   	pop    %ebp
+  800fda:	c3                   	ret
+  800fdb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fe0:	0f a2                	cpuid
+  800fe2:	c1 ea 0b             	shr    $0xb,%edx
+  800fe5:	83 e2 01             	and    $0x1,%edx
+  800fe8:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800fee:	eb c0                	jmp    800fb0 <sys_env_set_cow+0x12>
+  800ff0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801000:	89 df                	mov    %ebx,%edi
+  801002:	89 de                	mov    %ebx,%esi
+  801004:	55                   	push   %ebp
+  801005:	68 0e 10 80 00       	push   $0x80100e
+  80100a:	89 e5                	mov    %esp,%ebp
+  80100c:	0f 34                	sysenter
+  80100e:	83 c4 04             	add    $0x4,%esp
+  801011:	5d                   	pop    %ebp
+  801012:	eb bb                	jmp    800fcf <sys_env_set_cow+0x31>
+  801014:	83 ec 0c             	sub    $0xc,%esp
+  801017:	50                   	push   %eax
+  801018:	6a 0d                	push   $0xd
+  80101a:	68 04 1e 80 00       	push   $0x801e04
+  80101f:	6a 49                	push   $0x49
+  801021:	68 21 1e 80 00       	push   $0x801e21
+  801026:	e8 06 f2 ff ff       	call   800231 <_panic>
+
+0080102b <sys_env_set_quota>:
+  80102b:	55                   	push   %ebp
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	57                   	push   %edi
+  80102f:	56                   	push   %esi
+  801030:	53                   	push   %ebx
+  801031:	83 ec 0c             	sub    $0xc,%esp
+  801034:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80103b:	78 2b                	js     801068 <sys_env_set_quota+0x3d>
+  80103d:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801044:	75 37                	jne    80107d <sys_env_set_quota+0x52>
+  801046:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801050:	8b 55 08             	mov    0x8(%ebp),%edx
+  801053:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801056:	89 df                	mov    %ebx,%edi
+  801058:	89 de                	mov    %ebx,%esi
+  80105a:	cd 30                	int    $0x30
+  80105c:	85 c0                	test   %eax,%eax
+  80105e:	7f 41                	jg     8010a1 <sys_env_set_quota+0x76>
+  801060:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801063:	5b                   	pop    %ebx
+  801064:	5e                   	pop    %esi
+  801065:	5f                   	pop    %edi
+  801066:	5d                   	pop    %ebp
+  801067:	c3                   	ret
+  801068:	b8 01 00 00 00       	mov    $0x1,%eax
+  80106d:	0f a2                	cpuid
+  80106f:	c1 ea 0b             	shr    $0xb,%edx
+  801072:	83 e2 01             	and    $0x1,%edx
+  801075:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80107b:	eb c0                	jmp    80103d <sys_env_set_quota+0x12>
+  80107d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801082:	8b 55 08             	mov    0x8(%ebp),%edx
+  801085:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801088:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80108d:	89 df                	mov    %ebx,%edi
+  80108f:	89 de                	mov    %ebx,%esi
+  801091:	55                   	push   %ebp
+  801092:	68 9b 10 80 00       	push   $0x80109b
+  801097:	89 e5                	mov    %esp,%ebp
+  801099:	0f 34                	sysenter
+  80109b:	83 c4 04             	add    $0x4,%esp
+  80109e:	5d                   	pop    %ebp
+  80109f:	eb bb                	jmp    80105c <sys_env_set_quota+0x31>
+  8010a1:	83 ec 0c             	sub    $0xc,%esp
+  8010a4:	50                   	push   %eax
+  8010a5:	6a 0f                	push   $0xf
+  8010a7:	68 04 1e 80 00       	push   $0x801e04
+  8010ac:	6a 49                	push   $0x49
+  8010ae:	68 21 1e 80 00       	push   $0x801e21
+  8010b3:	e8 79 f1 ff ff       	call   800231 <_panic>
+
+008010b8 <sys_page_alloc>:
+  8010b8:	55                   	push   %ebp
+  8010b9:	89 e5                	mov    %esp,%ebp
+  8010bb:	57                   	push   %edi
+  8010bc:	56                   	push   %esi
+  8010bd:	53                   	push   %ebx
+  8010be:	83 ec 0c             	sub    $0xc,%esp
+  8010c1:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010c8:	78 2c                	js     8010f6 <sys_page_alloc+0x3e>
+  8010ca:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010d1:	75 38                	jne    80110b <sys_page_alloc+0x53>
+  8010d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e6:	89 f7                	mov    %esi,%edi
+  8010e8:	cd 30                	int    $0x30
+  8010ea:	85 c0                	test   %eax,%eax
+  8010ec:	7f 42                	jg     801130 <sys_page_alloc+0x78>
+  8010ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f1:	5b                   	pop    %ebx
+  8010f2:	5e                   	pop    %esi
+  8010f3:	5f                   	pop    %edi
+  8010f4:	5d                   	pop    %ebp
+  8010f5:	c3                   	ret
+  8010f6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010fb:	0f a2                	cpuid
+  8010fd:	c1 ea 0b             	shr    $0xb,%edx
+  801100:	83 e2 01             	and    $0x1,%edx
+  801103:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801109:	eb bf                	jmp    8010ca <sys_page_alloc+0x12>
+  80110b:	be 00 00 00 00       	mov    $0x0,%esi
+  801110:	8b 55 08             	mov    0x8(%ebp),%edx
+  801113:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801116:	b8 04 00 00 00       	mov    $0x4,%eax
+  80111b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80111e:	89 f7                	mov    %esi,%edi
+  801120:	55                   	push   %ebp
+  801121:	68 2a 11 80 00       	push   $0x80112a
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	0f 34                	sysenter
+  80112a:	83 c4 04             	add    $0x4,%esp
+  80112d:	5d                   	pop    %ebp
+  80112e:	eb ba                	jmp    8010ea <sys_page_alloc+0x32>
+  801130:	83 ec 0c             	sub    $0xc,%esp
+  801133:	50                   	push   %eax
+  801134:	6a 04                	push   $0x4
+  801136:	68 04 1e 80 00       	push   $0x801e04
+  80113b:	6a 49                	push   $0x49
+  80113d:	68 21 1e 80 00       	push   $0x801e21
+  801142:	e8 ea f0 ff ff       	call   800231 <_panic>
+
+00801147 <sys_page_map>:
+  801147:	55                   	push   %ebp
+  801148:	89 e5                	mov    %esp,%ebp
+  80114a:	57                   	push   %edi
+  80114b:	56                   	push   %esi
+  80114c:	53                   	push   %ebx
+  80114d:	83 ec 0c             	sub    $0xc,%esp
+  801150:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801157:	78 2b                	js     801184 <sys_page_map+0x3d>
+  801159:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801160:	75 37                	jne    801199 <sys_page_map+0x52>
+  801162:	b8 05 00 00 00       	mov    $0x5,%eax
+  801167:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801170:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801173:	8b 75 18             	mov    0x18(%ebp),%esi
+  801176:	cd 30                	int    $0x30
+  801178:	85 c0                	test   %eax,%eax
+  80117a:	7f 41                	jg     8011bd <sys_page_map+0x76>
+  80117c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117f:	5b                   	pop    %ebx
+  801180:	5e                   	pop    %esi
+  801181:	5f                   	pop    %edi
+  801182:	5d                   	pop    %ebp
+  801183:	c3                   	ret
+  801184:	b8 01 00 00 00       	mov    $0x1,%eax
+  801189:	0f a2                	cpuid
+  80118b:	c1 ea 0b             	shr    $0xb,%edx
+  80118e:	83 e2 01             	and    $0x1,%edx
+  801191:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801197:	eb c0                	jmp    801159 <sys_page_map+0x12>
+  801199:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119f:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011aa:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011ad:	55                   	push   %ebp
+  8011ae:	68 b7 11 80 00       	push   $0x8011b7
+  8011b3:	89 e5                	mov    %esp,%ebp
+  8011b5:	0f 34                	sysenter
+  8011b7:	83 c4 04             	add    $0x4,%esp
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	eb bb                	jmp    801178 <sys_page_map+0x31>
+  8011bd:	83 ec 0c             	sub    $0xc,%esp
+  8011c0:	50                   	push   %eax
+  8011c1:	6a 05                	push   $0x5
+  8011c3:	68 04 1e 80 00       	push   $0x801e04
+  8011c8:	6a 49                	push   $0x49
+  8011ca:	68 21 1e 80 00       	push   $0x801e21
+  8011cf:	e8 5d f0 ff ff       	call   800231 <_panic>
+
+008011d4 <sys_page_unmap>:
+  8011d4:	55                   	push   %ebp
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	57                   	push   %edi
+  8011d8:	56                   	push   %esi
+  8011d9:	53                   	push   %ebx
+  8011da:	83 ec 0c             	sub    $0xc,%esp
+  8011dd:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011e4:	78 2b                	js     801211 <sys_page_unmap+0x3d>
+  8011e6:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011ed:	75 37                	jne    801226 <sys_page_unmap+0x52>
+  8011ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ff:	89 df                	mov    %ebx,%edi
+  801201:	89 de                	mov    %ebx,%esi
+  801203:	cd 30                	int    $0x30
+  801205:	85 c0                	test   %eax,%eax
+  801207:	7f 41                	jg     80124a <sys_page_unmap+0x76>
+  801209:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120c:	5b                   	pop    %ebx
+  80120d:	5e                   	pop    %esi
+  80120e:	5f                   	pop    %edi
+  80120f:	5d                   	pop    %ebp
+  801210:	c3                   	ret
+  801211:	b8 01 00 00 00       	mov    $0x1,%eax
+  801216:	0f a2                	cpuid
+  801218:	c1 ea 0b             	shr    $0xb,%edx
+  80121b:	83 e2 01             	and    $0x1,%edx
+  80121e:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801224:	eb c0                	jmp    8011e6 <sys_page_unmap+0x12>
+  801226:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801231:	b8 06 00 00 00       	mov    $0x6,%eax
+  801236:	89 df                	mov    %ebx,%edi
+  801238:	89 de                	mov    %ebx,%esi
+  80123a:	55                   	push   %ebp
+  80123b:	68 44 12 80 00       	push   $0x801244
+  801240:	89 e5                	mov    %esp,%ebp
+  801242:	0f 34                	sysenter
+  801244:	83 c4 04             	add    $0x4,%esp
+  801247:	5d                   	pop    %ebp
+  801248:	eb bb                	jmp    801205 <sys_page_unmap+0x31>
+  80124a:	83 ec 0c             	sub    $0xc,%esp
+  80124d:	50                   	push   %eax
+  80124e:	6a 06                	push   $0x6
+  801250:	68 04 1e 80 00       	push   $0x801e04
+  801255:	6a 49                	push   $0x49
+  801257:	68 21 1e 80 00       	push   $0x801e21
+  80125c:	e8 d0 ef ff ff       	call   800231 <_panic>
+
+00801261 <sys_page_reuse>:
+  801261:	55                   	push   %ebp
+  801262:	89 e5                	mov    %esp,%ebp
+  801264:	57                   	push   %edi
+  801265:	56                   	push   %esi
+  801266:	53                   	push   %ebx
+  801267:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80126e:	78 24                	js     801294 <sys_page_reuse+0x33>
+  801270:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801277:	75 30                	jne    8012a9 <sys_page_reuse+0x48>
+  801279:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801283:	8b 55 08             	mov    0x8(%ebp),%edx
+  801286:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801289:	89 df                	mov    %ebx,%edi
+  80128b:	89 de                	mov    %ebx,%esi
+  80128d:	cd 30                	int    $0x30
+  80128f:	5b                   	pop    %ebx
+  801290:	5e                   	pop    %esi
+  801291:	5f                   	pop    %edi
+  801292:	5d                   	pop    %ebp
+  801293:	c3                   	ret
+  801294:	b8 01 00 00 00       	mov    $0x1,%eax
+  801299:	0f a2                	cpuid
+  80129b:	c1 ea 0b             	shr    $0xb,%edx
+  80129e:	83 e2 01             	and    $0x1,%edx
+  8012a1:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8012a7:	eb c7                	jmp    801270 <sys_page_reuse+0xf>
+  8012a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012b9:	89 df                	mov    %ebx,%edi
+  8012bb:	89 de                	mov    %ebx,%esi
+  8012bd:	55                   	push   %ebp
+  8012be:	68 c7 12 80 00       	push   $0x8012c7
+  8012c3:	89 e5                	mov    %esp,%ebp
+  8012c5:	0f 34                	sysenter
+  8012c7:	83 c4 04             	add    $0x4,%esp
+  8012ca:	5d                   	pop    %ebp
+  8012cb:	eb c2                	jmp    80128f <sys_page_reuse+0x2e>
+
+008012cd <sys_env_set_status>:
+  8012cd:	55                   	push   %ebp
+  8012ce:	89 e5                	mov    %esp,%ebp
+  8012d0:	57                   	push   %edi
+  8012d1:	56                   	push   %esi
+  8012d2:	53                   	push   %ebx
+  8012d3:	83 ec 0c             	sub    $0xc,%esp
+  8012d6:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012dd:	78 2b                	js     80130a <sys_env_set_status+0x3d>
+  8012df:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012e6:	75 37                	jne    80131f <sys_env_set_status+0x52>
+  8012e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ed:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f8:	89 df                	mov    %ebx,%edi
+  8012fa:	89 de                	mov    %ebx,%esi
+  8012fc:	cd 30                	int    $0x30
+  8012fe:	85 c0                	test   %eax,%eax
+  801300:	7f 41                	jg     801343 <sys_env_set_status+0x76>
+  801302:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801305:	5b                   	pop    %ebx
+  801306:	5e                   	pop    %esi
+  801307:	5f                   	pop    %edi
+  801308:	5d                   	pop    %ebp
+  801309:	c3                   	ret
+  80130a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80130f:	0f a2                	cpuid
+  801311:	c1 ea 0b             	shr    $0xb,%edx
+  801314:	83 e2 01             	and    $0x1,%edx
+  801317:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80131d:	eb c0                	jmp    8012df <sys_env_set_status+0x12>
+  80131f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801324:	8b 55 08             	mov    0x8(%ebp),%edx
+  801327:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80132a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80132f:	89 df                	mov    %ebx,%edi
+  801331:	89 de                	mov    %ebx,%esi
+  801333:	55                   	push   %ebp
+  801334:	68 3d 13 80 00       	push   $0x80133d
+  801339:	89 e5                	mov    %esp,%ebp
+  80133b:	0f 34                	sysenter
+  80133d:	83 c4 04             	add    $0x4,%esp
+  801340:	5d                   	pop    %ebp
+  801341:	eb bb                	jmp    8012fe <sys_env_set_status+0x31>
+  801343:	83 ec 0c             	sub    $0xc,%esp
+  801346:	50                   	push   %eax
+  801347:	6a 08                	push   $0x8
+  801349:	68 04 1e 80 00       	push   $0x801e04
+  80134e:	6a 49                	push   $0x49
+  801350:	68 21 1e 80 00       	push   $0x801e21
+  801355:	e8 d7 ee ff ff       	call   800231 <_panic>
+
+0080135a <sys_env_set_pgfault_upcall>:
+  80135a:	55                   	push   %ebp
+  80135b:	89 e5                	mov    %esp,%ebp
+  80135d:	57                   	push   %edi
+  80135e:	56                   	push   %esi
+  80135f:	53                   	push   %ebx
+  801360:	83 ec 0c             	sub    $0xc,%esp
+  801363:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80136a:	78 2b                	js     801397 <sys_env_set_pgfault_upcall+0x3d>
+  80136c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801373:	75 37                	jne    8013ac <sys_env_set_pgfault_upcall+0x52>
+  801375:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80137f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801382:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801385:	89 df                	mov    %ebx,%edi
+  801387:	89 de                	mov    %ebx,%esi
+  801389:	cd 30                	int    $0x30
+  80138b:	85 c0                	test   %eax,%eax
+  80138d:	7f 41                	jg     8013d0 <sys_env_set_pgfault_upcall+0x76>
+  80138f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801392:	5b                   	pop    %ebx
+  801393:	5e                   	pop    %esi
+  801394:	5f                   	pop    %edi
+  801395:	5d                   	pop    %ebp
+  801396:	c3                   	ret
+  801397:	b8 01 00 00 00       	mov    $0x1,%eax
+  80139c:	0f a2                	cpuid
+  80139e:	c1 ea 0b             	shr    $0xb,%edx
+  8013a1:	83 e2 01             	and    $0x1,%edx
+  8013a4:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8013aa:	eb c0                	jmp    80136c <sys_env_set_pgfault_upcall+0x12>
+  8013ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8013bc:	89 df                	mov    %ebx,%edi
+  8013be:	89 de                	mov    %ebx,%esi
+  8013c0:	55                   	push   %ebp
+  8013c1:	68 ca 13 80 00       	push   $0x8013ca
+  8013c6:	89 e5                	mov    %esp,%ebp
+  8013c8:	0f 34                	sysenter
+  8013ca:	83 c4 04             	add    $0x4,%esp
+  8013cd:	5d                   	pop    %ebp
+  8013ce:	eb bb                	jmp    80138b <sys_env_set_pgfault_upcall+0x31>
+  8013d0:	83 ec 0c             	sub    $0xc,%esp
+  8013d3:	50                   	push   %eax
+  8013d4:	6a 09                	push   $0x9
+  8013d6:	68 04 1e 80 00       	push   $0x801e04
+  8013db:	6a 49                	push   $0x49
+  8013dd:	68 21 1e 80 00       	push   $0x801e21
+  8013e2:	e8 4a ee ff ff       	call   800231 <_panic>
+
+008013e7 <sys_env_set_trace>:
+  8013e7:	55                   	push   %ebp
+  8013e8:	89 e5                	mov    %esp,%ebp
+  8013ea:	57                   	push   %edi
+  8013eb:	56                   	push   %esi
+  8013ec:	53                   	push   %ebx
+  8013ed:	83 ec 0c             	sub    $0xc,%esp
+  8013f0:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8013f7:	78 2b                	js     801424 <sys_env_set_trace+0x3d>
+  8013f9:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801400:	75 37                	jne    801439 <sys_env_set_trace+0x52>
+  801402:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801407:	b8 12 00 00 00       	mov    $0x12,%eax
+  80140c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801412:	89 df                	mov    %ebx,%edi
+  801414:	89 de                	mov    %ebx,%esi
+  801416:	cd 30                	int    $0x30
+  801418:	85 c0                	test   %eax,%eax
+  80141a:	7f 41                	jg     80145d <sys_env_set_trace+0x76>
+  80141c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141f:	5b                   	pop    %ebx
+  801420:	5e                   	pop    %esi
+  801421:	5f                   	pop    %edi
+  801422:	5d                   	pop    %ebp
+  801423:	c3                   	ret
+  801424:	b8 01 00 00 00       	mov    $0x1,%eax
+  801429:	0f a2                	cpuid
+  80142b:	c1 ea 0b             	shr    $0xb,%edx
+  80142e:	83 e2 01             	and    $0x1,%edx
+  801431:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801437:	eb c0                	jmp    8013f9 <sys_env_set_trace+0x12>
+  801439:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801441:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801444:	b8 12 00 00 00       	mov    $0x12,%eax
+  801449:	89 df                	mov    %ebx,%edi
+  80144b:	89 de                	mov    %ebx,%esi
+  80144d:	55                   	push   %ebp
+  80144e:	68 57 14 80 00       	push   $0x801457
+  801453:	89 e5                	mov    %esp,%ebp
+  801455:	0f 34                	sysenter
+  801457:	83 c4 04             	add    $0x4,%esp
+  80145a:	5d                   	pop    %ebp
+  80145b:	eb bb                	jmp    801418 <sys_env_set_trace+0x31>
+  80145d:	83 ec 0c             	sub    $0xc,%esp
+  801460:	50                   	push   %eax
+  801461:	6a 12                	push   $0x12
+  801463:	68 04 1e 80 00       	push   $0x801e04
+  801468:	6a 49                	push   $0x49
+  80146a:	68 21 1e 80 00       	push   $0x801e21
+  80146f:	e8 bd ed ff ff       	call   800231 <_panic>
+
+00801474 <sys_env_set_rdpmc>:
+  801474:	55                   	push   %ebp
+  801475:	89 e5                	mov    %esp,%ebp
+  801477:	57                   	push   %edi
+  801478:	56                   	push   %esi
+  801479:	53                   	push   %ebx
+  80147a:	83 ec 0c             	sub    $0xc,%esp
+  80147d:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801484:	78 2b                	js     8014b1 <sys_env_set_rdpmc+0x3d>
+  801486:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80148d:	75 37                	jne    8014c6 <sys_env_set_rdpmc+0x52>
+  80148f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801494:	b8 13 00 00 00       	mov    $0x13,%eax
+  801499:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149f:	89 df                	mov    %ebx,%edi
+  8014a1:	89 de                	mov    %ebx,%esi
+  8014a3:	cd 30                	int    $0x30
+  8014a5:	85 c0                	test   %eax,%eax
+  8014a7:	7f 41                	jg     8014ea <sys_env_set_rdpmc+0x76>
+  8014a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ac:	5b                   	pop    %ebx
+  8014ad:	5e                   	pop    %esi
+  8014ae:	5f                   	pop    %edi
+  8014af:	5d                   	pop    %ebp
+  8014b0:	c3                   	ret
+  8014b1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014b6:	0f a2                	cpuid
+  8014b8:	c1 ea 0b             	shr    $0xb,%edx
+  8014bb:	83 e2 01             	and    $0x1,%edx
+  8014be:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8014c4:	eb c0                	jmp    801486 <sys_env_set_rdpmc+0x12>
+  8014c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d1:	b8 13 00 00 00       	mov    $0x13,%eax
+  8014d6:	89 df                	mov    %ebx,%edi
+  8014d8:	89 de                	mov    %ebx,%esi
+  8014da:	55                   	push   %ebp
+  8014db:	68 e4 14 80 00       	push   $0x8014e4
+  8014e0:	89 e5                	mov    %esp,%ebp
+  8014e2:	0f 34                	sysenter
+  8014e4:	83 c4 04             	add    $0x4,%esp
+  8014e7:	5d                   	pop    %ebp
+  8014e8:	eb bb                	jmp    8014a5 <sys_env_set_rdpmc+0x31>
+  8014ea:	83 ec 0c             	sub    $0xc,%esp
+  8014ed:	50                   	push   %eax
+  8014ee:	6a 13                	push   $0x13
+  8014f0:	68 04 1e 80 00       	push   $0x801e04
+  8014f5:	6a 49                	push   $0x49
+  8014f7:	68 21 1e 80 00       	push   $0x801e21
+  8014fc:	e8 30 ed ff ff       	call   800231 <_panic>
+
+00801501 <sys_ring_setup>:
+  801501:	55                   	push   %ebp
+  801502:	89 e5                	mov    %esp,%ebp
+  801504:	57                   	push   %edi
+  801505:	56                   	push   %esi
+  801506:	53                   	push   %ebx
+  801507:	83 ec 0c             	sub    $0xc,%esp
+  80150a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801511:	78 29                	js     80153c <sys_ring_setup+0x3b>
+  801513:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80151a:	75 35                	jne    801551 <sys_ring_setup+0x50>
+  80151c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801521:	b8 10 00 00 00       	mov    $0x10,%eax
+  801526:	89 d1                	mov    %edx,%ecx
+  801528:	89 d3                	mov    %edx,%ebx
+  80152a:	89 d7                	mov    %edx,%edi
+  80152c:	89 d6                	mov    %edx,%esi
+  80152e:	cd 30                	int    $0x30
+  801530:	85 c0                	test   %eax,%eax
+  801532:	7f 3f                	jg     801573 <sys_ring_setup+0x72>
+  801534:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801537:	5b                   	pop    %ebx
+  801538:	5e                   	pop    %esi
+  801539:	5f                   	pop    %edi
+  80153a:	5d                   	pop    %ebp
+  80153b:	c3                   	ret
+  80153c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801541:	0f a2                	cpuid
+  801543:	c1 ea 0b             	shr    $0xb,%edx
+  801546:	83 e2 01             	and    $0x1,%edx
+  801549:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80154f:	eb c2                	jmp    801513 <sys_ring_setup+0x12>
+  801551:	ba 00 00 00 00       	mov    $0x0,%edx
+  801556:	b8 10 00 00 00       	mov    $0x10,%eax
+  80155b:	89 d1                	mov    %edx,%ecx
+  80155d:	89 d3                	mov    %edx,%ebx
+  80155f:	89 d7                	mov    %edx,%edi
+  801561:	89 d6                	mov    %edx,%esi
+  801563:	55                   	push   %ebp
+  801564:	68 6d 15 80 00       	push   $0x80156d
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	0f 34                	sysenter
+  80156d:	83 c4 04             	add    $0x4,%esp
+  801570:	5d                   	pop    %ebp
+  801571:	eb bd                	jmp    801530 <sys_ring_setup+0x2f>
+  801573:	83 ec 0c             	sub    $0xc,%esp
+  801576:	50                   	push   %eax
+  801577:	6a 10                	push   $0x10
+  801579:	68 04 1e 80 00       	push   $0x801e04
+  80157e:	6a 49                	push   $0x49
+  801580:	68 21 1e 80 00       	push   $0x801e21
+  801585:	e8 a7 ec ff ff       	call   800231 <_panic>
+
+0080158a <sys_ring_enter>:
+  80158a:	55                   	push   %ebp
+  80158b:	89 e5                	mov    %esp,%ebp
+  80158d:	57                   	push   %edi
+  80158e:	56                   	push   %esi
+  80158f:	53                   	push   %ebx
+  801590:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801597:	78 22                	js     8015bb <sys_ring_enter+0x31>
+  801599:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8015a0:	75 2e                	jne    8015d0 <sys_ring_enter+0x46>
+  8015a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a7:	b8 11 00 00 00       	mov    $0x11,%eax
+  8015ac:	89 d1                	mov    %edx,%ecx
+  8015ae:	89 d3                	mov    %edx,%ebx
+  8015b0:	89 d7                	mov    %edx,%edi
+  8015b2:	89 d6                	mov    %edx,%esi
+  8015b4:	cd 30                	int    $0x30
+  8015b6:	5b                   	pop    %ebx
+  8015b7:	5e                   	pop    %esi
+  8015b8:	5f                   	pop    %edi
+  8015b9:	5d                   	pop    %ebp
+  8015ba:	c3                   	ret
+  8015bb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015c0:	0f a2                	cpuid
+  8015c2:	c1 ea 0b             	shr    $0xb,%edx
+  8015c5:	83 e2 01             	and    $0x1,%edx
+  8015c8:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8015ce:	eb c9                	jmp    801599 <sys_ring_enter+0xf>
+  8015d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d5:	b8 11 00 00 00       	mov    $0x11,%eax
+  8015da:	89 d1                	mov    %edx,%ecx
+  8015dc:	89 d3                	mov    %edx,%ebx
+  8015de:	89 d7                	mov    %edx,%edi
+  8015e0:	89 d6                	mov    %edx,%esi
+  8015e2:	55                   	push   %ebp
+  8015e3:	68 ec 15 80 00       	push   $0x8015ec
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	0f 34                	sysenter
+  8015ec:	83 c4 04             	add    $0x4,%esp
+  8015ef:	5d                   	pop    %ebp
+  8015f0:	eb c4                	jmp    8015b6 <sys_ring_enter+0x2c>
+
+008015f2 <sys_ipc_try_send>:
+  8015f2:	55                   	push   %ebp
+  8015f3:	89 e5                	mov    %esp,%ebp
+  8015f5:	57                   	push   %edi
+  8015f6:	56                   	push   %esi
+  8015f7:	53                   	push   %ebx
+  8015f8:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8015ff:	78 26                	js     801627 <sys_ipc_try_send+0x35>
+  801601:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801608:	75 32                	jne    80163c <sys_ipc_try_send+0x4a>
+  80160a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80160f:	be 00 00 00 00       	mov    $0x0,%esi
+  801614:	8b 55 08             	mov    0x8(%ebp),%edx
+  801617:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80161a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80161d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801620:	cd 30                	int    $0x30
+  801622:	5b                   	pop    %ebx
+  801623:	5e                   	pop    %esi
+  801624:	5f                   	pop    %edi
+  801625:	5d                   	pop    %ebp
+  801626:	c3                   	ret
+  801627:	b8 01 00 00 00       	mov    $0x1,%eax
+  80162c:	0f a2                	cpuid
+  80162e:	c1 ea 0b             	shr    $0xb,%edx
+  801631:	83 e2 01             	and    $0x1,%edx
+  801634:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80163a:	eb c5                	jmp    801601 <sys_ipc_try_send+0xf>
+  80163c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801642:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801647:	be 00 00 00 00       	mov    $0x0,%esi
+  80164c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80164f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801652:	55                   	push   %ebp
+  801653:	68 5c 16 80 00       	push   $0x80165c
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	0f 34                	sysenter
+  80165c:	83 c4 04             	add    $0x4,%esp
+  80165f:	5d                   	pop    %ebp
+  801660:	eb c0                	jmp    801622 <sys_ipc_try_send+0x30>
+
+00801662 <sys_ipc_recv>:
+  801662:	55                   	push   %ebp
+  801663:	89 e5                	mov    %esp,%ebp
+  801665:	57                   	push   %edi
+  801666:	56                   	push   %esi
+  801667:	53                   	push   %ebx
+  801668:	83 ec 0c             	sub    $0xc,%esp
+  80166b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801672:	78 2a                	js     80169e <sys_ipc_recv+0x3c>
+  801674:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80167b:	75 36                	jne    8016b3 <sys_ipc_recv+0x51>
+  80167d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801682:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801687:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168a:	89 cb                	mov    %ecx,%ebx
+  80168c:	89 cf                	mov    %ecx,%edi
+  80168e:	89 ce                	mov    %ecx,%esi
+  801690:	cd 30                	int    $0x30
+  801692:	85 c0                	test   %eax,%eax
+  801694:	7f 40                	jg     8016d6 <sys_ipc_recv+0x74>
+  801696:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801699:	5b                   	pop    %ebx
+  80169a:	5e                   	pop    %esi
+  80169b:	5f                   	pop    %edi
+  80169c:	5d                   	pop    %ebp
+  80169d:	c3                   	ret
+  80169e:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016a3:	0f a2                	cpuid
+  8016a5:	c1 ea 0b             	shr    $0xb,%edx
+  8016a8:	83 e2 01             	and    $0x1,%edx
+  8016ab:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8016b1:	eb c1                	jmp    801674 <sys_ipc_recv+0x12>
+  8016b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8016c0:	89 cb                	mov    %ecx,%ebx
+  8016c2:	89 cf                	mov    %ecx,%edi
+  8016c4:	89 ce                	mov    %ecx,%esi
+  8016c6:	55                   	push   %ebp
+  8016c7:	68 d0 16 80 00       	push   $0x8016d0
+  8016cc:	89 e5                	mov    %esp,%ebp
+  8016ce:	0f 34                	sysenter
+  8016d0:	83 c4 04             	add    $0x4,%esp
+  8016d3:	5d                   	pop    %ebp
+  8016d4:	eb bc                	jmp    801692 <sys_ipc_recv+0x30>
+  8016d6:	83 ec 0c             	sub    $0xc,%esp
+  8016d9:	50                   	push   %eax
+  8016da:	6a 0c                	push   $0xc
+  8016dc:	68 04 1e 80 00       	push   $0x801e04
+  8016e1:	6a 49                	push   $0x49
+  8016e3:	68 21 1e 80 00       	push   $0x801e21
+  8016e8:	e8 44 eb ff ff       	call   800231 <_panic>
+
+008016ed <uinfo_envid>:
+  8016ed:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  8016f2:	c3                   	ret
+
+008016f3 <uinfo_cpunum>:
+  8016f3:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  8016f8:	c3                   	ret
+
+008016f9 <uinfo_ticks>:
+  8016f9:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  8016fe:	c3                   	ret
+
+008016ff <uinfo_nsec>:
+  8016ff:	55                   	push   %ebp
+  801700:	89 e5                	mov    %esp,%ebp
+  801702:	57                   	push   %edi
+  801703:	56                   	push   %esi
+  801704:	53                   	push   %ebx
+  801705:	83 ec 1c             	sub    $0x1c,%esp
+  801708:	0f 31                	rdtsc
+  80170a:	89 c6                	mov    %eax,%esi
+  80170c:	89 d7                	mov    %edx,%edi
+  80170e:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801714:	b8 00 00 00 00       	mov    $0x0,%eax
+  801719:	ba 00 00 00 00       	mov    $0x0,%edx
+  80171e:	85 c9                	test   %ecx,%ecx
+  801720:	74 5c                	je     80177e <uinfo_nsec+0x7f>
+  801722:	ba 00 00 00 00       	mov    $0x0,%edx
+  801727:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80172a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80172d:	52                   	push   %edx
+  80172e:	51                   	push   %ecx
+  80172f:	57                   	push   %edi
+  801730:	56                   	push   %esi
+  801731:	e8 1f 02 00 00       	call   801955 <__umoddi3>
+  801736:	83 c4 10             	add    $0x10,%esp
+  801739:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  80173f:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801744:	f7 e3                	mul    %ebx
+  801746:	01 ca                	add    %ecx,%edx
+  801748:	ff 75 e4             	push   -0x1c(%ebp)
+  80174b:	ff 75 e0             	push   -0x20(%ebp)
+  80174e:	52                   	push   %edx
+  80174f:	50                   	push   %eax
+  801750:	e8 28 01 00 00       	call   80187d <__udivdi3>
+  801755:	83 c4 10             	add    $0x10,%esp
+  801758:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80175b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80175e:	ff 75 e4             	push   -0x1c(%ebp)
+  801761:	ff 75 e0             	push   -0x20(%ebp)
+  801764:	57                   	push   %edi
+  801765:	56                   	push   %esi
+  801766:	e8 12 01 00 00       	call   80187d <__udivdi3>
+  80176b:	83 c4 10             	add    $0x10,%esp
+  80176e:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801774:	f7 e3                	mul    %ebx
+  801776:	01 ca                	add    %ecx,%edx
+  801778:	03 45 d8             	add    -0x28(%ebp),%eax
+  80177b:	13 55 dc             	adc    -0x24(%ebp),%edx
+  80177e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801781:	5b                   	pop    %ebx
+  801782:	5e                   	pop    %esi
+  801783:	5f                   	pop    %edi
+  801784:	5d                   	pop    %ebp
+  801785:	c3                   	ret
+
+00801786 <bflush>:
+  801786:	a1 40 20 80 00       	mov    0x802040,%eax
+  80178b:	85 c0                	test   %eax,%eax
+  80178d:	75 01                	jne    801790 <bflush+0xa>
+  80178f:	c3                   	ret
+  801790:	55                   	push   %ebp
+  801791:	89 e5                	mov    %esp,%ebp
+  801793:	83 ec 10             	sub    $0x10,%esp
+  801796:	50                   	push   %eax
+  801797:	68 44 20 80 00       	push   $0x802044
+  80179c:	e8 d4 f5 ff ff       	call   800d75 <sys_cputs>
+  8017a1:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  8017a8:	00 00 00 
+  8017ab:	83 c4 10             	add    $0x10,%esp
+  8017ae:	c9                   	leave
+  8017af:	c3                   	ret
+
+008017b0 <bputch>:
+  8017b0:	55                   	push   %ebp
+  8017b1:	89 e5                	mov    %esp,%ebp
+  8017b3:	53                   	push   %ebx
+  8017b4:	83 ec 04             	sub    $0x4,%esp
+  8017b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8017ba:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  8017c0:	8d 42 01             	lea    0x1(%edx),%eax
+  8017c3:	a3 40 20 80 00       	mov    %eax,0x802040
+  8017c8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8017cb:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  8017d1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8017d6:	77 08                	ja     8017e0 <bputch+0x30>
+  8017d8:	83 03 01             	addl   $0x1,(%ebx)
+  8017db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017de:	c9                   	leave
+  8017df:	c3                   	ret
+  8017e0:	e8 a1 ff ff ff       	call   801786 <bflush>
+  8017e5:	eb f1                	jmp    8017d8 <bputch+0x28>
+
+008017e7 <vbprintf>:
+  8017e7:	55                   	push   %ebp
+  8017e8:	89 e5                	mov    %esp,%ebp
+  8017ea:	83 ec 18             	sub    $0x18,%esp
+  8017ed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8017f4:	ff 75 0c             	push   0xc(%ebp)
+  8017f7:	ff 75 08             	push   0x8(%ebp)
+  8017fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017fd:	50                   	push   %eax
+  8017fe:	68 b0 17 80 00       	push   $0x8017b0
+  801803:	e8 00 ec ff ff       	call   800408 <vprintfmt>
+  801808:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80180b:	c9                   	leave
+  80180c:	c3                   	ret
+
+0080180d <bprintf>:
+  80180d:	55                   	push   %ebp
+  80180e:	89 e5                	mov    %esp,%ebp
+  801810:	83 ec 10             	sub    $0x10,%esp
+  801813:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801816:	50                   	push   %eax
+  801817:	ff 75 08             	push   0x8(%ebp)
+  80181a:	e8 c8 ff ff ff       	call   8017e7 <vbprintf>
+  80181f:	c9                   	leave
+  801820:	c3                   	ret
+
+00801821 <bwrite>:
+  801821:	55                   	push   %ebp
+  801822:	89 e5                	mov    %esp,%ebp
+  801824:	53                   	push   %ebx
+  801825:	83 ec 04             	sub    $0x4,%esp
+  801828:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80182b:	89 d8                	mov    %ebx,%eax
+  80182d:	03 05 40 20 80 00    	add    0x802040,%eax
+  801833:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801838:	76 0d                	jbe    801847 <bwrite+0x26>
+  80183a:	e8 47 ff ff ff       	call   801786 <bflush>
+  80183f:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801845:	77 25                	ja     80186c <bwrite+0x4b>
+  801847:	83 ec 04             	sub    $0x4,%esp
+  80184a:	53                   	push   %ebx
+  80184b:	ff 75 08             	push   0x8(%ebp)
+  80184e:	a1 40 20 80 00       	mov    0x802040,%eax
+  801853:	05 44 20 80 00       	add    $0x802044,%eax
+  801858:	50                   	push   %eax
+  801859:	e8 15 f3 ff ff       	call   800b73 <memcpy>
+  80185e:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  801864:	83 c4 10             	add    $0x10,%esp
+  801867:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80186a:	c9                   	leave
+  80186b:	c3                   	ret
+  80186c:	83 ec 08             	sub    $0x8,%esp
+  80186f:	53                   	push   %ebx
+  801870:	ff 75 08             	push   0x8(%ebp)
+  801873:	e8 fd f4 ff ff       	call   800d75 <sys_cputs>
+  801878:	83 c4 10             	add    $0x10,%esp
+  80187b:	eb ea                	jmp    801867 <bwrite+0x46>
+
+0080187d <__udivdi3>:
+  80187d:	57                   	push   %edi
+  80187e:	56                   	push   %esi
+  80187f:	53                   	push   %ebx
+  801880:	83 ec 20             	sub    $0x20,%esp
+  801883:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801887:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80188b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80188f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801893:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801897:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80189b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80189f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8018a3:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8018a7:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8018ab:	89 d1                	mov    %edx,%ecx
+  8018ad:	09 c1                	or     %eax,%ecx
+  8018af:	0f 84 91 00 00 00    	je     801946 <__udivdi3+0xc9>
+  8018b5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8018bc:	00 
+  8018bd:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8018c4:	00 
+  8018c5:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8018ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d4:	eb 08                	jmp    8018de <__udivdi3+0x61>
+  8018d6:	83 e9 01             	sub    $0x1,%ecx
+  8018d9:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8018dc:	74 68                	je     801946 <__udivdi3+0xc9>
+  8018de:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8018e2:	01 c0                	add    %eax,%eax
+  8018e4:	89 c6                	mov    %eax,%esi
+  8018e6:	89 d7                	mov    %edx,%edi
+  8018e8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8018ec:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8018f0:	0f ad d0             	shrd   %cl,%edx,%eax
+  8018f3:	d3 ea                	shr    %cl,%edx
+  8018f5:	f6 c1 20             	test   $0x20,%cl
+  8018f8:	74 04                	je     8018fe <__udivdi3+0x81>
+  8018fa:	89 d0                	mov    %edx,%eax
+  8018fc:	31 d2                	xor    %edx,%edx
+  8018fe:	83 e0 01             	and    $0x1,%eax
+  801901:	89 04 24             	mov    %eax,(%esp)
+  801904:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80190b:	00 
+  80190c:	8b 04 24             	mov    (%esp),%eax
+  80190f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801913:	09 f0                	or     %esi,%eax
+  801915:	09 fa                	or     %edi,%edx
+  801917:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80191b:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80191f:	39 f0                	cmp    %esi,%eax
+  801921:	89 d3                	mov    %edx,%ebx
+  801923:	19 fb                	sbb    %edi,%ebx
+  801925:	72 af                	jb     8018d6 <__udivdi3+0x59>
+  801927:	29 f0                	sub    %esi,%eax
+  801929:	19 fa                	sbb    %edi,%edx
+  80192b:	89 cf                	mov    %ecx,%edi
+  80192d:	c1 ef 05             	shr    $0x5,%edi
+  801930:	83 e7 01             	and    $0x1,%edi
+  801933:	89 fe                	mov    %edi,%esi
+  801935:	83 f6 01             	xor    $0x1,%esi
+  801938:	d3 e6                	shl    %cl,%esi
+  80193a:	d3 e7                	shl    %cl,%edi
+  80193c:	09 74 24 18          	or     %esi,0x18(%esp)
+  801940:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  801944:	eb 90                	jmp    8018d6 <__udivdi3+0x59>
+  801946:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80194a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80194e:	83 c4 20             	add    $0x20,%esp
+  801951:	5b                   	pop    %ebx
+  801952:	5e                   	pop    %esi
+  801953:	5f                   	pop    %edi
+  801954:	c3                   	ret
+
+00801955 <__umoddi3>:
+  801955:	55                   	push   %ebp
+  801956:	57                   	push   %edi
+  801957:	56                   	push   %esi
+  801958:	53                   	push   %ebx
+  801959:	83 ec 1c             	sub    $0x1c,%esp
+  80195c:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801960:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801964:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801968:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80196c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801970:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801974:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801978:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80197c:	89 d6                	mov    %edx,%esi
+  80197e:	09 c6                	or     %eax,%esi
+  801980:	74 6c                	je     8019ee <__umoddi3+0x99>
+  801982:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801991:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801995:	eb 0e                	jmp    8019a5 <__umoddi3+0x50>
+  801997:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  80199c:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8019a0:	83 fe ff             	cmp    $0xffffffff,%esi
+  8019a3:	74 49                	je     8019ee <__umoddi3+0x99>
+  8019a5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8019a9:	01 c0                	add    %eax,%eax
+  8019ab:	89 c3                	mov    %eax,%ebx
+  8019ad:	89 d6                	mov    %edx,%esi
+  8019af:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8019b3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8019b7:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  8019bc:	0f ad d0             	shrd   %cl,%edx,%eax
+  8019bf:	d3 ea                	shr    %cl,%edx
+  8019c1:	f6 c1 20             	test   $0x20,%cl
+  8019c4:	74 04                	je     8019ca <__umoddi3+0x75>
+  8019c6:	89 d0                	mov    %edx,%eax
+  8019c8:	31 d2                	xor    %edx,%edx
+  8019ca:	83 e0 01             	and    $0x1,%eax
+  8019cd:	bd 00 00 00 00       	mov    $0x0,%ebp
+  8019d2:	89 ea                	mov    %ebp,%edx
+  8019d4:	09 d8                	or     %ebx,%eax
+  8019d6:	09 f2                	or     %esi,%edx
+  8019d8:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  8019dc:	8b 74 24 14          	mov    0x14(%esp),%esi
+  8019e0:	39 d8                	cmp    %ebx,%eax
+  8019e2:	89 d1                	mov    %edx,%ecx
+  8019e4:	19 f1                	sbb    %esi,%ecx
+  8019e6:	72 af                	jb     801997 <__umoddi3+0x42>
+  8019e8:	29 d8                	sub    %ebx,%eax
+  8019ea:	19 f2                	sbb    %esi,%edx
+  8019ec:	eb a9                	jmp    801997 <__umoddi3+0x42>
+  8019ee:	83 c4 1c             	add    $0x1c,%esp
+  8019f1:	5b                   	pop    %ebx
+  8019f2:	5e                   	pop    %esi
+  8019f3:	5f                   	pop    %edi
+  8019f4:	5d                   	pop    %ebp
+  8019f5:	c3                   	ret
+
+008019f6 <__divdi3>:
+  8019f6:	53                   	push   %ebx
+  8019f7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8019fb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8019ff:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801a03:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801a07:	85 d2                	test   %edx,%edx
+  801a09:	78 12                	js     801a1d <__divdi3+0x27>
+  801a0b:	85 db                	test   %ebx,%ebx
+  801a0d:	78 2e                	js     801a3d <__divdi3+0x47>
+  801a0f:	53                   	push   %ebx
+  801a10:	51                   	push   %ecx
+  801a11:	52                   	push   %edx
+  801a12:	50                   	push   %eax
+  801a13:	e8 65 fe ff ff       	call   80187d <__udivdi3>
+  801a18:	83 c4 10             	add    $0x10,%esp
+  801a1b:	eb 1e                	jmp    801a3b <__divdi3+0x45>
+  801a1d:	f7 d8                	neg    %eax
+  801a1f:	83 d2 00             	adc    $0x0,%edx
+  801a22:	f7 da                	neg    %edx
+  801a24:	85 db                	test   %ebx,%ebx
+  801a26:	78 2a                	js     801a52 <__divdi3+0x5c>
+  801a28:	53                   	push   %ebx
+  801a29:	51                   	push   %ecx
+  801a2a:	52                   	push   %edx
+  801a2b:	50                   	push   %eax
+  801a2c:	e8 4c fe ff ff       	call   80187d <__udivdi3>
+  801a31:	83 c4 10             	add    $0x10,%esp
+  801a34:	f7 d8                	neg    %eax
+  801a36:	83 d2 00             	adc    $0x0,%edx
+  801a39:	f7 da                	neg    %edx
+  801a3b:	5b                   	pop    %ebx
+  801a3c:	c3                   	ret
+  801a3d:	f7 d9                	neg    %ecx
+  801a3f:	83 d3 00             	adc    $0x0,%ebx
+  801a42:	f7 db                	neg    %ebx
+  801a44:	53                   	push   %ebx
+  801a45:	51                   	push   %ecx
+  801a46:	52                   	push   %edx
+  801a47:	50                   	push   %eax
+  801a48:	e8 30 fe ff ff       	call   80187d <__udivdi3>
+  801a4d:	83 c4 10             	add    $0x10,%esp
+  801a50:	eb e2                	jmp    801a34 <__divdi3+0x3e>
+  801a52:	f7 d9                	neg    %ecx
+  801a54:	83 d3 00             	adc    $0x0,%ebx
+  801a57:	f7 db                	neg    %ebx
+  801a59:	53                   	push   %ebx
+  801a5a:	51                   	push   %ecx
+  801a5b:	52                   	push   %edx
+  801a5c:	50                   	push   %eax
+  801a5d:	e8 1b fe ff ff       	call   80187d <__udivdi3>
+  801a62:	83 c4 10             	add    $0x10,%esp
+  801a65:	eb d4                	jmp    801a3b <__divdi3+0x45>
+
+00801a67 <__moddi3>:
+  801a67:	55                   	push   %ebp
+  801a68:	57                   	push   %edi
+  801a69:	56                   	push   %esi
+  801a6a:	53                   	push   %ebx
+  801a6b:	83 ec 14             	sub    $0x14,%esp
+  801a6e:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801a72:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801a76:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801a7a:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801a7e:	85 ed                	test   %ebp,%ebp
+  801a80:	78 2b                	js     801aad <__moddi3+0x46>
+  801a82:	89 c6                	mov    %eax,%esi
+  801a84:	f7 de                	neg    %esi
+  801a86:	89 34 24             	mov    %esi,(%esp)
+  801a89:	89 d6                	mov    %edx,%esi
+  801a8b:	83 d6 00             	adc    $0x0,%esi
+  801a8e:	f7 de                	neg    %esi
+  801a90:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801a94:	8b 34 24             	mov    (%esp),%esi
+  801a97:	0f 48 f0             	cmovs  %eax,%esi
+  801a9a:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801a9f:	52                   	push   %edx
+  801aa0:	56                   	push   %esi
+  801aa1:	55                   	push   %ebp
+  801aa2:	57                   	push   %edi
+  801aa3:	e8 ad fe ff ff       	call   801955 <__umoddi3>
+  801aa8:	83 c4 10             	add    $0x10,%esp
+  801aab:	eb 3c                	jmp    801ae9 <__moddi3+0x82>
+  801aad:	89 c3                	mov    %eax,%ebx
+  801aaf:	f7 db                	neg    %ebx
+  801ab1:	89 d1                	mov    %edx,%ecx
+  801ab3:	83 d1 00             	adc    $0x0,%ecx
+  801ab6:	f7 d9                	neg    %ecx
+  801ab8:	0f 49 c3             	cmovns %ebx,%eax
+  801abb:	89 04 24             	mov    %eax,(%esp)
+  801abe:	0f 49 d1             	cmovns %ecx,%edx
+  801ac1:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801ac5:	ff 74 24 04          	push   0x4(%esp)
+  801ac9:	ff 74 24 04          	push   0x4(%esp)
+  801acd:	89 f8                	mov    %edi,%eax
+  801acf:	89 ea                	mov    %ebp,%edx
+  801ad1:	f7 d8                	neg    %eax
+  801ad3:	83 d2 00             	adc    $0x0,%edx
+  801ad6:	f7 da                	neg    %edx
+  801ad8:	52                   	push   %edx
+  801ad9:	50                   	push   %eax
+  801ada:	e8 76 fe ff ff       	call   801955 <__umoddi3>
+  801adf:	83 c4 10             	add    $0x10,%esp
+  801ae2:	f7 d8                	neg    %eax
+  801ae4:	83 d2 00             	adc    $0x0,%edx
+  801ae7:	f7 da                	neg    %edx
+  801ae9:	83 c4 14             	add    $0x14,%esp
+  801aec:	5b                   	pop    %ebx
+  801aed:	5e                   	pop    %esi
+  801aee:	5f                   	pop    %edi
+  801aef:	5d                   	pop    %ebp
+  801af0:	c3                   	ret
@@ -0,0 +1,2735 @@
+
+obj/user/fairness:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 70 00 00 00       	call   8000a1 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+  80003b:	e8 16 0d 00 00       	call   800d56 <sys_getenvid>
+  800040:	89 c3                	mov    %eax,%ebx
+  800042:	81 3d 20 20 80 00 80 	cmpl   $0xed000380,0x802020
+  800049:	03 00 ed 
+  80004c:	74 2d                	je     80007b <umain+0x48>
+  80004e:	a1 c0 03 00 ed       	mov    0xed0003c0,%eax
+  800053:	83 ec 04             	sub    $0x4,%esp
+  800056:	50                   	push   %eax
+  800057:	53                   	push   %ebx
+  800058:	68 51 1b 80 00       	push   $0x801b51
+  80005d:	e8 37 01 00 00       	call   800199 <cprintf>
+  800062:	83 c4 10             	add    $0x10,%esp
+  800065:	a1 c0 03 00 ed       	mov    0xed0003c0,%eax
+  80006a:	6a 00                	push   $0x0
+  80006c:	6a 00                	push   $0x0
+  80006e:	6a 00                	push   $0x0
+  800070:	50                   	push   %eax
+  800071:	e8 89 15 00 00       	call   8015ff <ipc_send>
+  800076:	83 c4 10             	add    $0x10,%esp
+  800079:	eb ea                	jmp    800065 <umain+0x32>
+  80007b:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  80007e:	83 ec 04             	sub    $0x4,%esp
+  800081:	6a 00                	push   $0x0
+  800083:	6a 00                	push   $0x0
+  800085:	56                   	push   %esi
+  800086:	e8 ea 14 00 00       	call   801575 <ipc_recv>
+  80008b:	83 c4 0c             	add    $0xc,%esp
+  80008e:	ff 75 f4             	push   -0xc(%ebp)
+  800091:	53                   	push   %ebx
+  800092:	68 40 1b 80 00       	push   $0x801b40
+  800097:	e8 fd 00 00 00       	call   800199 <cprintf>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb dd                	jmp    80007e <umain+0x4b>
+
+008000a1 <libmain>:
+  8000a1:	55                   	push   %ebp
+  8000a2:	89 e5                	mov    %esp,%ebp
+  8000a4:	56                   	push   %esi
+  8000a5:	53                   	push   %ebx
+  8000a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000ac:	e8 28 16 00 00       	call   8016d9 <uinfo_envid>
+  8000b1:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8000b6:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8000bc:	05 00 00 00 ed       	add    $0xed000000,%eax
+  8000c1:	a3 20 20 80 00       	mov    %eax,0x802020
+  8000c6:	85 db                	test   %ebx,%ebx
+  8000c8:	7e 07                	jle    8000d1 <libmain+0x30>
+  8000ca:	8b 06                	mov    (%esi),%eax
+  8000cc:	a3 00 20 80 00       	mov    %eax,0x802000
+  8000d1:	83 ec 08             	sub    $0x8,%esp
+  8000d4:	56                   	push   %esi
+  8000d5:	53                   	push   %ebx
+  8000d6:	e8 58 ff ff ff       	call   800033 <umain>
+  8000db:	e8 0a 00 00 00       	call   8000ea <exit>
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5d                   	pop    %ebp
+  8000e9:	c3                   	ret
+
+008000ea <exit>:
+  8000ea:	55                   	push   %ebp
+  8000eb:	89 e5                	mov    %esp,%ebp
+  8000ed:	83 ec 08             	sub    $0x8,%esp
+  8000f0:	e8 7d 16 00 00       	call   801772 <bflush>
+  8000f5:	83 ec 0c             	sub    $0xc,%esp
+  8000f8:	6a 00                	push   $0x0
+  8000fa:	e8 cc 0b 00 00       	call   800ccb <sys_env_destroy>
+  8000ff:	83 c4 10             	add    $0x10,%esp
+  800102:	c9                   	leave
+  800103:	c3                   	ret
+
+00800104 <putch>:
+  800104:	55                   	push   %ebp
+  800105:	89 e5                	mov    %esp,%ebp
+  800107:	53                   	push   %ebx
+  800108:	83 ec 04             	sub    $0x4,%esp
+  80010b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80010e:	8b 13                	mov    (%ebx),%edx
+  800110:	8d 42 01             	lea    0x1(%edx),%eax
+  800113:	89 03                	mov    %eax,(%ebx)
+  800115:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800118:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80011c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800121:	74 09                	je     80012c <putch+0x28>
+  800123:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800127:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80012a:	c9                   	leave
+  80012b:	c3                   	ret
+  80012c:	83 ec 08             	sub    $0x8,%esp
+  80012f:	68 ff 00 00 00       	push   $0xff
+  800134:	8d 43 08             	lea    0x8(%ebx),%eax
+  800137:	50                   	push   %eax
+  800138:	e8 c0 0a 00 00       	call   800bfd <sys_cputs>
+  80013d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800143:	83 c4 10             	add    $0x10,%esp
+  800146:	eb db                	jmp    800123 <putch+0x1f>
+
+00800148 <vcprintf>:
+  800148:	55                   	push   %ebp
+  800149:	89 e5                	mov    %esp,%ebp
+  80014b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800151:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800158:	00 00 00 
+  80015b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800162:	00 00 00 
+  800165:	ff 75 0c             	push   0xc(%ebp)
+  800168:	ff 75 08             	push   0x8(%ebp)
+  80016b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800171:	50                   	push   %eax
+  800172:	68 04 01 80 00       	push   $0x800104
+  800177:	e8 14 01 00 00       	call   800290 <vprintfmt>
+  80017c:	83 c4 08             	add    $0x8,%esp
+  80017f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800185:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80018b:	50                   	push   %eax
+  80018c:	e8 6c 0a 00 00       	call   800bfd <sys_cputs>
+  800191:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800197:	c9                   	leave
+  800198:	c3                   	ret
+
+00800199 <cprintf>:
+  800199:	55                   	push   %ebp
+  80019a:	89 e5                	mov    %esp,%ebp
+  80019c:	83 ec 10             	sub    $0x10,%esp
+  80019f:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8001a2:	50                   	push   %eax
+  8001a3:	ff 75 08             	push   0x8(%ebp)
+  8001a6:	e8 9d ff ff ff       	call   800148 <vcprintf>
+  8001ab:	c9                   	leave
+  8001ac:	c3                   	ret
+
+008001ad <printnum>:
+  8001ad:	55                   	push   %ebp
+  8001ae:	89 e5                	mov    %esp,%ebp
+  8001b0:	57                   	push   %edi
+  8001b1:	56                   	push   %esi
+  8001b2:	53                   	push   %ebx
+  8001b3:	83 ec 1c             	sub    $0x1c,%esp
+  8001b6:	89 c7                	mov    %eax,%edi
+  8001b8:	89 d6                	mov    %edx,%esi
+  8001ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001c0:	89 d1                	mov    %edx,%ecx
+  8001c2:	89 c2                	mov    %eax,%edx
+  8001c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001c7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001ca:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001cd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8001d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001d3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001da:	39 c2                	cmp    %eax,%edx
+  8001dc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001df:	72 3e                	jb     80021f <printnum+0x72>
+  8001e1:	83 ec 0c             	sub    $0xc,%esp
+  8001e4:	ff 75 18             	push   0x18(%ebp)
+  8001e7:	83 eb 01             	sub    $0x1,%ebx
+  8001ea:	53                   	push   %ebx
+  8001eb:	50                   	push   %eax
+  8001ec:	83 ec 08             	sub    $0x8,%esp
+  8001ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8001f2:	ff 75 e0             	push   -0x20(%ebp)
+  8001f5:	ff 75 dc             	push   -0x24(%ebp)
+  8001f8:	ff 75 d8             	push   -0x28(%ebp)
+  8001fb:	e8 b4 16 00 00       	call   8018b4 <__udivdi3>
+  800200:	83 c4 18             	add    $0x18,%esp
+  800203:	52                   	push   %edx
+  800204:	50                   	push   %eax
+  800205:	89 f2                	mov    %esi,%edx
+  800207:	89 f8                	mov    %edi,%eax
+  800209:	e8 9f ff ff ff       	call   8001ad <printnum>
+  80020e:	83 c4 20             	add    $0x20,%esp
+  800211:	eb 13                	jmp    800226 <printnum+0x79>
+  800213:	83 ec 08             	sub    $0x8,%esp
+  800216:	56                   	push   %esi
+  800217:	ff 75 18             	push   0x18(%ebp)
+  80021a:	ff d7                	call   *%edi
+  80021c:	83 c4 10             	add    $0x10,%esp
+  80021f:	83 eb 01             	sub    $0x1,%ebx
+  800222:	85 db                	test   %ebx,%ebx
+  800224:	7f ed                	jg     800213 <printnum+0x66>
+  800226:	83 ec 08             	sub    $0x8,%esp
+  800229:	56                   	push   %esi
+  80022a:	83 ec 04             	sub    $0x4,%esp
+  80022d:	ff 75 e4             	push   -0x1c(%ebp)
+  800230:	ff 75 e0             	push   -0x20(%ebp)
+  800233:	ff 75 dc             	push   -0x24(%ebp)
+  800236:	ff 75 d8             	push   -0x28(%ebp)
+  800239:	e8 4e 17 00 00       	call   80198c <__umoddi3>
+  80023e:	83 c4 14             	add    $0x14,%esp
+  800241:	0f be 80 72 1b 80 00 	movsbl 0x801b72(%eax),%eax
+  800248:	50                   	push   %eax
+  800249:	ff d7                	call   *%edi
+  80024b:	83 c4 10             	add    $0x10,%esp
+  80024e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800251:	5b                   	pop    %ebx
+  800252:	5e                   	pop    %esi
+  800253:	5f                   	pop    %edi
+  800254:	5d                   	pop    %ebp
+  800255:	c3                   	ret
+
+00800256 <sprintputch>:
+  800256:	55                   	push   %ebp
+  800257:	89 e5                	mov    %esp,%ebp
+  800259:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80025c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800260:	8b 10                	mov    (%eax),%edx
+  800262:	3b 50 04             	cmp    0x4(%eax),%edx
+  800265:	73 0a                	jae    800271 <sprintputch+0x1b>
+  800267:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80026a:	89 08                	mov    %ecx,(%eax)
+  80026c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80026f:	88 02                	mov    %al,(%edx)
+  800271:	5d                   	pop    %ebp
+  800272:	c3                   	ret
+
+00800273 <printfmt>:
+  800273:	55                   	push   %ebp
+  800274:	89 e5                	mov    %esp,%ebp
+  800276:	83 ec 08             	sub    $0x8,%esp
+  800279:	8d 45 14             	lea    0x14(%ebp),%eax
+  80027c:	50                   	push   %eax
+  80027d:	ff 75 10             	push   0x10(%ebp)
+  800280:	ff 75 0c             	push   0xc(%ebp)
+  800283:	ff 75 08             	push   0x8(%ebp)
+  800286:	e8 05 00 00 00       	call   800290 <vprintfmt>
+  80028b:	83 c4 10             	add    $0x10,%esp
+  80028e:	c9                   	leave
+  80028f:	c3                   	ret
+
+00800290 <vprintfmt>:
+  800290:	55                   	push   %ebp
+  800291:	89 e5                	mov    %esp,%ebp
+  800293:	57                   	push   %edi
+  800294:	56                   	push   %esi
+  800295:	53                   	push   %ebx
+  800296:	83 ec 2c             	sub    $0x2c,%esp
+  800299:	8b 75 08             	mov    0x8(%ebp),%esi
+  80029c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80029f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002a2:	eb 0a                	jmp    8002ae <vprintfmt+0x1e>
+  8002a4:	83 ec 08             	sub    $0x8,%esp
+  8002a7:	53                   	push   %ebx
+  8002a8:	50                   	push   %eax
+  8002a9:	ff d6                	call   *%esi
+  8002ab:	83 c4 10             	add    $0x10,%esp
+  8002ae:	83 c7 01             	add    $0x1,%edi
+  8002b1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002b5:	83 f8 25             	cmp    $0x25,%eax
+  8002b8:	74 0c                	je     8002c6 <vprintfmt+0x36>
+  8002ba:	85 c0                	test   %eax,%eax
+  8002bc:	75 e6                	jne    8002a4 <vprintfmt+0x14>
+  8002be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c1:	5b                   	pop    %ebx
+  8002c2:	5e                   	pop    %esi
+  8002c3:	5f                   	pop    %edi
+  8002c4:	5d                   	pop    %ebp
+  8002c5:	c3                   	ret
+  8002c6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  8002ca:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8002d1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8002d8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  8002df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002e4:	8d 47 01             	lea    0x1(%edi),%eax
+  8002e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002ea:	0f b6 17             	movzbl (%edi),%edx
+  8002ed:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002f0:	3c 55                	cmp    $0x55,%al
+  8002f2:	0f 87 cf 03 00 00    	ja     8006c7 <vprintfmt+0x437>
+  8002f8:	0f b6 c0             	movzbl %al,%eax
+  8002fb:	ff 24 85 40 1c 80 00 	jmp    *0x801c40(,%eax,4)
+  800302:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800305:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800309:	eb d9                	jmp    8002e4 <vprintfmt+0x54>
+  80030b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80030e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800312:	eb d0                	jmp    8002e4 <vprintfmt+0x54>
+  800314:	0f b6 d2             	movzbl %dl,%edx
+  800317:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80031a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800322:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800325:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800329:	0f be 17             	movsbl (%edi),%edx
+  80032c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80032f:	83 f9 09             	cmp    $0x9,%ecx
+  800332:	77 55                	ja     800389 <vprintfmt+0xf9>
+  800334:	83 c7 01             	add    $0x1,%edi
+  800337:	eb e9                	jmp    800322 <vprintfmt+0x92>
+  800339:	8b 45 14             	mov    0x14(%ebp),%eax
+  80033c:	8b 00                	mov    (%eax),%eax
+  80033e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800341:	8b 45 14             	mov    0x14(%ebp),%eax
+  800344:	8d 40 04             	lea    0x4(%eax),%eax
+  800347:	89 45 14             	mov    %eax,0x14(%ebp)
+  80034a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80034d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800351:	79 91                	jns    8002e4 <vprintfmt+0x54>
+  800353:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800356:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800359:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800360:	eb 82                	jmp    8002e4 <vprintfmt+0x54>
+  800362:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800365:	85 d2                	test   %edx,%edx
+  800367:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036c:	0f 49 c2             	cmovns %edx,%eax
+  80036f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800372:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800375:	e9 6a ff ff ff       	jmp    8002e4 <vprintfmt+0x54>
+  80037a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80037d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800384:	e9 5b ff ff ff       	jmp    8002e4 <vprintfmt+0x54>
+  800389:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80038c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80038f:	eb bc                	jmp    80034d <vprintfmt+0xbd>
+  800391:	83 c1 01             	add    $0x1,%ecx
+  800394:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800397:	e9 48 ff ff ff       	jmp    8002e4 <vprintfmt+0x54>
+  80039c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039f:	8d 78 04             	lea    0x4(%eax),%edi
+  8003a2:	83 ec 08             	sub    $0x8,%esp
+  8003a5:	53                   	push   %ebx
+  8003a6:	ff 30                	push   (%eax)
+  8003a8:	ff d6                	call   *%esi
+  8003aa:	83 c4 10             	add    $0x10,%esp
+  8003ad:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003b0:	e9 b1 02 00 00       	jmp    800666 <vprintfmt+0x3d6>
+  8003b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b8:	8d 78 04             	lea    0x4(%eax),%edi
+  8003bb:	8b 10                	mov    (%eax),%edx
+  8003bd:	89 d0                	mov    %edx,%eax
+  8003bf:	f7 d8                	neg    %eax
+  8003c1:	0f 48 c2             	cmovs  %edx,%eax
+  8003c4:	83 f8 08             	cmp    $0x8,%eax
+  8003c7:	7f 23                	jg     8003ec <vprintfmt+0x15c>
+  8003c9:	8b 14 85 a0 1d 80 00 	mov    0x801da0(,%eax,4),%edx
+  8003d0:	85 d2                	test   %edx,%edx
+  8003d2:	74 18                	je     8003ec <vprintfmt+0x15c>
+  8003d4:	52                   	push   %edx
+  8003d5:	68 93 1b 80 00       	push   $0x801b93
+  8003da:	53                   	push   %ebx
+  8003db:	56                   	push   %esi
+  8003dc:	e8 92 fe ff ff       	call   800273 <printfmt>
+  8003e1:	83 c4 10             	add    $0x10,%esp
+  8003e4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003e7:	e9 7a 02 00 00       	jmp    800666 <vprintfmt+0x3d6>
+  8003ec:	50                   	push   %eax
+  8003ed:	68 8a 1b 80 00       	push   $0x801b8a
+  8003f2:	53                   	push   %ebx
+  8003f3:	56                   	push   %esi
+  8003f4:	e8 7a fe ff ff       	call   800273 <printfmt>
+  8003f9:	83 c4 10             	add    $0x10,%esp
+  8003fc:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003ff:	e9 62 02 00 00       	jmp    800666 <vprintfmt+0x3d6>
+  800404:	8b 45 14             	mov    0x14(%ebp),%eax
+  800407:	83 c0 04             	add    $0x4,%eax
+  80040a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80040d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800410:	8b 08                	mov    (%eax),%ecx
+  800412:	85 c9                	test   %ecx,%ecx
+  800414:	b8 83 1b 80 00       	mov    $0x801b83,%eax
+  800419:	0f 45 c1             	cmovne %ecx,%eax
+  80041c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80041f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800423:	7e 06                	jle    80042b <vprintfmt+0x19b>
+  800425:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800429:	75 0b                	jne    800436 <vprintfmt+0x1a6>
+  80042b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80042e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800431:	89 75 08             	mov    %esi,0x8(%ebp)
+  800434:	eb 5c                	jmp    800492 <vprintfmt+0x202>
+  800436:	83 ec 08             	sub    $0x8,%esp
+  800439:	ff 75 d0             	push   -0x30(%ebp)
+  80043c:	ff 75 cc             	push   -0x34(%ebp)
+  80043f:	e8 87 03 00 00       	call   8007cb <strnlen>
+  800444:	89 c2                	mov    %eax,%edx
+  800446:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800449:	29 d0                	sub    %edx,%eax
+  80044b:	83 c4 10             	add    $0x10,%esp
+  80044e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800452:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800455:	89 75 08             	mov    %esi,0x8(%ebp)
+  800458:	89 c6                	mov    %eax,%esi
+  80045a:	eb 0e                	jmp    80046a <vprintfmt+0x1da>
+  80045c:	83 ec 08             	sub    $0x8,%esp
+  80045f:	53                   	push   %ebx
+  800460:	57                   	push   %edi
+  800461:	ff 55 08             	call   *0x8(%ebp)
+  800464:	83 ee 01             	sub    $0x1,%esi
+  800467:	83 c4 10             	add    $0x10,%esp
+  80046a:	85 f6                	test   %esi,%esi
+  80046c:	7f ee                	jg     80045c <vprintfmt+0x1cc>
+  80046e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800471:	8b 75 08             	mov    0x8(%ebp),%esi
+  800474:	85 c0                	test   %eax,%eax
+  800476:	ba 00 00 00 00       	mov    $0x0,%edx
+  80047b:	0f 49 d0             	cmovns %eax,%edx
+  80047e:	29 d0                	sub    %edx,%eax
+  800480:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800483:	eb a6                	jmp    80042b <vprintfmt+0x19b>
+  800485:	83 ec 08             	sub    $0x8,%esp
+  800488:	53                   	push   %ebx
+  800489:	52                   	push   %edx
+  80048a:	ff 55 08             	call   *0x8(%ebp)
+  80048d:	83 c4 10             	add    $0x10,%esp
+  800490:	89 f1                	mov    %esi,%ecx
+  800492:	8d 71 01             	lea    0x1(%ecx),%esi
+  800495:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800499:	0f be d0             	movsbl %al,%edx
+  80049c:	85 d2                	test   %edx,%edx
+  80049e:	74 28                	je     8004c8 <vprintfmt+0x238>
+  8004a0:	85 ff                	test   %edi,%edi
+  8004a2:	78 05                	js     8004a9 <vprintfmt+0x219>
+  8004a4:	83 ef 01             	sub    $0x1,%edi
+  8004a7:	78 30                	js     8004d9 <vprintfmt+0x249>
+  8004a9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004ad:	74 d6                	je     800485 <vprintfmt+0x1f5>
+  8004af:	0f be c0             	movsbl %al,%eax
+  8004b2:	83 e8 20             	sub    $0x20,%eax
+  8004b5:	83 f8 5e             	cmp    $0x5e,%eax
+  8004b8:	76 cb                	jbe    800485 <vprintfmt+0x1f5>
+  8004ba:	83 ec 08             	sub    $0x8,%esp
+  8004bd:	53                   	push   %ebx
+  8004be:	6a 3f                	push   $0x3f
+  8004c0:	ff 55 08             	call   *0x8(%ebp)
+  8004c3:	83 c4 10             	add    $0x10,%esp
+  8004c6:	eb c8                	jmp    800490 <vprintfmt+0x200>
+  8004c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004cb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d1:	01 d0                	add    %edx,%eax
+  8004d3:	29 c8                	sub    %ecx,%eax
+  8004d5:	89 c7                	mov    %eax,%edi
+  8004d7:	eb 13                	jmp    8004ec <vprintfmt+0x25c>
+  8004d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004dc:	eb ed                	jmp    8004cb <vprintfmt+0x23b>
+  8004de:	83 ec 08             	sub    $0x8,%esp
+  8004e1:	53                   	push   %ebx
+  8004e2:	6a 20                	push   $0x20
+  8004e4:	ff d6                	call   *%esi
+  8004e6:	83 ef 01             	sub    $0x1,%edi
+  8004e9:	83 c4 10             	add    $0x10,%esp
+  8004ec:	85 ff                	test   %edi,%edi
+  8004ee:	7f ee                	jg     8004de <vprintfmt+0x24e>
+  8004f0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004f6:	e9 6b 01 00 00       	jmp    800666 <vprintfmt+0x3d6>
+  8004fb:	83 f9 01             	cmp    $0x1,%ecx
+  8004fe:	7f 1f                	jg     80051f <vprintfmt+0x28f>
+  800500:	85 c9                	test   %ecx,%ecx
+  800502:	74 67                	je     80056b <vprintfmt+0x2db>
+  800504:	8b 45 14             	mov    0x14(%ebp),%eax
+  800507:	8b 00                	mov    (%eax),%eax
+  800509:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80050c:	89 c1                	mov    %eax,%ecx
+  80050e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800511:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800514:	8b 45 14             	mov    0x14(%ebp),%eax
+  800517:	8d 40 04             	lea    0x4(%eax),%eax
+  80051a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80051d:	eb 17                	jmp    800536 <vprintfmt+0x2a6>
+  80051f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800522:	8b 50 04             	mov    0x4(%eax),%edx
+  800525:	8b 00                	mov    (%eax),%eax
+  800527:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80052d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800530:	8d 40 08             	lea    0x8(%eax),%eax
+  800533:	89 45 14             	mov    %eax,0x14(%ebp)
+  800536:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800539:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80053c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800541:	85 c9                	test   %ecx,%ecx
+  800543:	0f 89 03 01 00 00    	jns    80064c <vprintfmt+0x3bc>
+  800549:	83 ec 08             	sub    $0x8,%esp
+  80054c:	53                   	push   %ebx
+  80054d:	6a 2d                	push   $0x2d
+  80054f:	ff d6                	call   *%esi
+  800551:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800554:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800557:	f7 da                	neg    %edx
+  800559:	83 d1 00             	adc    $0x0,%ecx
+  80055c:	f7 d9                	neg    %ecx
+  80055e:	83 c4 10             	add    $0x10,%esp
+  800561:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800566:	e9 e1 00 00 00       	jmp    80064c <vprintfmt+0x3bc>
+  80056b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056e:	8b 00                	mov    (%eax),%eax
+  800570:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800573:	89 c1                	mov    %eax,%ecx
+  800575:	c1 f9 1f             	sar    $0x1f,%ecx
+  800578:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80057b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057e:	8d 40 04             	lea    0x4(%eax),%eax
+  800581:	89 45 14             	mov    %eax,0x14(%ebp)
+  800584:	eb b0                	jmp    800536 <vprintfmt+0x2a6>
+  800586:	83 f9 01             	cmp    $0x1,%ecx
+  800589:	7f 1e                	jg     8005a9 <vprintfmt+0x319>
+  80058b:	85 c9                	test   %ecx,%ecx
+  80058d:	74 32                	je     8005c1 <vprintfmt+0x331>
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8b 10                	mov    (%eax),%edx
+  800594:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800599:	8d 40 04             	lea    0x4(%eax),%eax
+  80059c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005a4:	e9 a3 00 00 00       	jmp    80064c <vprintfmt+0x3bc>
+  8005a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ac:	8b 10                	mov    (%eax),%edx
+  8005ae:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005b1:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005bc:	e9 8b 00 00 00       	jmp    80064c <vprintfmt+0x3bc>
+  8005c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c4:	8b 10                	mov    (%eax),%edx
+  8005c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ce:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005d6:	eb 74                	jmp    80064c <vprintfmt+0x3bc>
+  8005d8:	83 f9 01             	cmp    $0x1,%ecx
+  8005db:	7f 1b                	jg     8005f8 <vprintfmt+0x368>
+  8005dd:	85 c9                	test   %ecx,%ecx
+  8005df:	74 2c                	je     80060d <vprintfmt+0x37d>
+  8005e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e4:	8b 10                	mov    (%eax),%edx
+  8005e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005f6:	eb 54                	jmp    80064c <vprintfmt+0x3bc>
+  8005f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fb:	8b 10                	mov    (%eax),%edx
+  8005fd:	8b 48 04             	mov    0x4(%eax),%ecx
+  800600:	8d 40 08             	lea    0x8(%eax),%eax
+  800603:	89 45 14             	mov    %eax,0x14(%ebp)
+  800606:	bf 08 00 00 00       	mov    $0x8,%edi
+  80060b:	eb 3f                	jmp    80064c <vprintfmt+0x3bc>
+  80060d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800610:	8b 10                	mov    (%eax),%edx
+  800612:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800617:	8d 40 04             	lea    0x4(%eax),%eax
+  80061a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061d:	bf 08 00 00 00       	mov    $0x8,%edi
+  800622:	eb 28                	jmp    80064c <vprintfmt+0x3bc>
+  800624:	83 ec 08             	sub    $0x8,%esp
+  800627:	53                   	push   %ebx
+  800628:	6a 30                	push   $0x30
+  80062a:	ff d6                	call   *%esi
+  80062c:	83 c4 08             	add    $0x8,%esp
+  80062f:	53                   	push   %ebx
+  800630:	6a 78                	push   $0x78
+  800632:	ff d6                	call   *%esi
+  800634:	8b 45 14             	mov    0x14(%ebp),%eax
+  800637:	8b 10                	mov    (%eax),%edx
+  800639:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80063e:	83 c4 10             	add    $0x10,%esp
+  800641:	8d 40 04             	lea    0x4(%eax),%eax
+  800644:	89 45 14             	mov    %eax,0x14(%ebp)
+  800647:	bf 10 00 00 00       	mov    $0x10,%edi
+  80064c:	83 ec 0c             	sub    $0xc,%esp
+  80064f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800653:	50                   	push   %eax
+  800654:	ff 75 e0             	push   -0x20(%ebp)
+  800657:	57                   	push   %edi
+  800658:	51                   	push   %ecx
+  800659:	52                   	push   %edx
+  80065a:	89 da                	mov    %ebx,%edx
+  80065c:	89 f0                	mov    %esi,%eax
+  80065e:	e8 4a fb ff ff       	call   8001ad <printnum>
+  800663:	83 c4 20             	add    $0x20,%esp
+  800666:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800669:	e9 40 fc ff ff       	jmp    8002ae <vprintfmt+0x1e>
+  80066e:	83 f9 01             	cmp    $0x1,%ecx
+  800671:	7f 1b                	jg     80068e <vprintfmt+0x3fe>
+  800673:	85 c9                	test   %ecx,%ecx
+  800675:	74 2c                	je     8006a3 <vprintfmt+0x413>
+  800677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067a:	8b 10                	mov    (%eax),%edx
+  80067c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800681:	8d 40 04             	lea    0x4(%eax),%eax
+  800684:	89 45 14             	mov    %eax,0x14(%ebp)
+  800687:	bf 10 00 00 00       	mov    $0x10,%edi
+  80068c:	eb be                	jmp    80064c <vprintfmt+0x3bc>
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	8b 10                	mov    (%eax),%edx
+  800693:	8b 48 04             	mov    0x4(%eax),%ecx
+  800696:	8d 40 08             	lea    0x8(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069c:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006a1:	eb a9                	jmp    80064c <vprintfmt+0x3bc>
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8b 10                	mov    (%eax),%edx
+  8006a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b3:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006b8:	eb 92                	jmp    80064c <vprintfmt+0x3bc>
+  8006ba:	83 ec 08             	sub    $0x8,%esp
+  8006bd:	53                   	push   %ebx
+  8006be:	6a 25                	push   $0x25
+  8006c0:	ff d6                	call   *%esi
+  8006c2:	83 c4 10             	add    $0x10,%esp
+  8006c5:	eb 9f                	jmp    800666 <vprintfmt+0x3d6>
+  8006c7:	83 ec 08             	sub    $0x8,%esp
+  8006ca:	53                   	push   %ebx
+  8006cb:	6a 25                	push   $0x25
+  8006cd:	ff d6                	call   *%esi
+  8006cf:	83 c4 10             	add    $0x10,%esp
+  8006d2:	89 f8                	mov    %edi,%eax
+  8006d4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006d8:	74 05                	je     8006df <vprintfmt+0x44f>
+  8006da:	83 e8 01             	sub    $0x1,%eax
+  8006dd:	eb f5                	jmp    8006d4 <vprintfmt+0x444>
+  8006df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006e2:	eb 82                	jmp    800666 <vprintfmt+0x3d6>
+
+008006e4 <vsnprintf>:
+  8006e4:	55                   	push   %ebp
+  8006e5:	89 e5                	mov    %esp,%ebp
+  8006e7:	83 ec 18             	sub    $0x18,%esp
+  8006ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006f0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006f3:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006f7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006fa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800701:	85 c0                	test   %eax,%eax
+  800703:	74 26                	je     80072b <vsnprintf+0x47>
+  800705:	85 d2                	test   %edx,%edx
+  800707:	7e 22                	jle    80072b <vsnprintf+0x47>
+  800709:	ff 75 14             	push   0x14(%ebp)
+  80070c:	ff 75 10             	push   0x10(%ebp)
+  80070f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800712:	50                   	push   %eax
+  800713:	68 56 02 80 00       	push   $0x800256
+  800718:	e8 73 fb ff ff       	call   800290 <vprintfmt>
+  80071d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800720:	c6 00 00             	movb   $0x0,(%eax)
+  800723:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800726:	83 c4 10             	add    $0x10,%esp
+  800729:	c9                   	leave
+  80072a:	c3                   	ret
+  80072b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800730:	eb f7                	jmp    800729 <vsnprintf+0x45>
+
+00800732 <snprintf>:
+  800732:	55                   	push   %ebp
+  800733:	89 e5                	mov    %esp,%ebp
+  800735:	83 ec 08             	sub    $0x8,%esp
+  800738:	8d 45 14             	lea    0x14(%ebp),%eax
+  80073b:	50                   	push   %eax
+  80073c:	ff 75 10             	push   0x10(%ebp)
+  80073f:	ff 75 0c             	push   0xc(%ebp)
+  800742:	ff 75 08             	push   0x8(%ebp)
+  800745:	e8 9a ff ff ff       	call   8006e4 <vsnprintf>
+  80074a:	c9                   	leave
+  80074b:	c3                   	ret
+
+0080074c <copy_fwd>:
+  80074c:	55                   	push   %ebp
+  80074d:	89 e5                	mov    %esp,%ebp
+  80074f:	57                   	push   %edi
+  800750:	56                   	push   %esi
+  800751:	53                   	push   %ebx
+  800752:	89 c7                	mov    %eax,%edi
+  800754:	89 d6                	mov    %edx,%esi
+  800756:	89 c8                	mov    %ecx,%eax
+  800758:	83 f9 0f             	cmp    $0xf,%ecx
+  80075b:	76 1c                	jbe    800779 <copy_fwd+0x2d>
+  80075d:	89 f9                	mov    %edi,%ecx
+  80075f:	f7 d9                	neg    %ecx
+  800761:	89 cb                	mov    %ecx,%ebx
+  800763:	83 e3 03             	and    $0x3,%ebx
+  800766:	29 d8                	sub    %ebx,%eax
+  800768:	89 c2                	mov    %eax,%edx
+  80076a:	c1 ea 02             	shr    $0x2,%edx
+  80076d:	83 e0 03             	and    $0x3,%eax
+  800770:	89 d9                	mov    %ebx,%ecx
+  800772:	fc                   	cld
+  800773:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800775:	89 d1                	mov    %edx,%ecx
+  800777:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800779:	89 c1                	mov    %eax,%ecx
+  80077b:	fc                   	cld
+  80077c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80077e:	5b                   	pop    %ebx
+  80077f:	5e                   	pop    %esi
+  800780:	5f                   	pop    %edi
+  800781:	5d                   	pop    %ebp
+  800782:	c3                   	ret
+
+00800783 <have_sse2>:
+  800783:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80078a:	78 06                	js     800792 <have_sse2+0xf>
+  80078c:	a1 04 20 80 00       	mov    0x802004,%eax
+  800791:	c3                   	ret
+  800792:	55                   	push   %ebp
+  800793:	89 e5                	mov    %esp,%ebp
+  800795:	53                   	push   %ebx
+  800796:	b8 01 00 00 00       	mov    $0x1,%eax
+  80079b:	0f a2                	cpuid
+  80079d:	c1 ea 1a             	shr    $0x1a,%edx
+  8007a0:	83 e2 01             	and    $0x1,%edx
+  8007a3:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8007a9:	a1 04 20 80 00       	mov    0x802004,%eax
+  8007ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007b1:	c9                   	leave
+  8007b2:	c3                   	ret
+
+008007b3 <strlen>:
+  8007b3:	55                   	push   %ebp
+  8007b4:	89 e5                	mov    %esp,%ebp
+  8007b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007be:	eb 03                	jmp    8007c3 <strlen+0x10>
+  8007c0:	83 c0 01             	add    $0x1,%eax
+  8007c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007c7:	75 f7                	jne    8007c0 <strlen+0xd>
+  8007c9:	5d                   	pop    %ebp
+  8007ca:	c3                   	ret
+
+008007cb <strnlen>:
+  8007cb:	55                   	push   %ebp
+  8007cc:	89 e5                	mov    %esp,%ebp
+  8007ce:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d9:	eb 03                	jmp    8007de <strnlen+0x13>
+  8007db:	83 c0 01             	add    $0x1,%eax
+  8007de:	39 d0                	cmp    %edx,%eax
+  8007e0:	74 08                	je     8007ea <strnlen+0x1f>
+  8007e2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007e6:	75 f3                	jne    8007db <strnlen+0x10>
+  8007e8:	89 c2                	mov    %eax,%edx
+  8007ea:	89 d0                	mov    %edx,%eax
+  8007ec:	5d                   	pop    %ebp
+  8007ed:	c3                   	ret
+
+008007ee <strcpy>:
+  8007ee:	55                   	push   %ebp
+  8007ef:	89 e5                	mov    %esp,%ebp
+  8007f1:	53                   	push   %ebx
+  8007f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007f5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fd:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800801:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800804:	83 c0 01             	add    $0x1,%eax
+  800807:	84 d2                	test   %dl,%dl
+  800809:	75 f2                	jne    8007fd <strcpy+0xf>
+  80080b:	89 c8                	mov    %ecx,%eax
+  80080d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800810:	c9                   	leave
+  800811:	c3                   	ret
+
+00800812 <strcat>:
+  800812:	55                   	push   %ebp
+  800813:	89 e5                	mov    %esp,%ebp
+  800815:	53                   	push   %ebx
+  800816:	83 ec 10             	sub    $0x10,%esp
+  800819:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80081c:	53                   	push   %ebx
+  80081d:	e8 91 ff ff ff       	call   8007b3 <strlen>
+  800822:	83 c4 08             	add    $0x8,%esp
+  800825:	ff 75 0c             	push   0xc(%ebp)
+  800828:	01 d8                	add    %ebx,%eax
+  80082a:	50                   	push   %eax
+  80082b:	e8 be ff ff ff       	call   8007ee <strcpy>
+  800830:	89 d8                	mov    %ebx,%eax
+  800832:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800835:	c9                   	leave
+  800836:	c3                   	ret
+
+00800837 <strncpy>:
+  800837:	55                   	push   %ebp
+  800838:	89 e5                	mov    %esp,%ebp
+  80083a:	56                   	push   %esi
+  80083b:	53                   	push   %ebx
+  80083c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80083f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800842:	89 f3                	mov    %esi,%ebx
+  800844:	03 5d 10             	add    0x10(%ebp),%ebx
+  800847:	89 f0                	mov    %esi,%eax
+  800849:	eb 0f                	jmp    80085a <strncpy+0x23>
+  80084b:	83 c0 01             	add    $0x1,%eax
+  80084e:	0f b6 0a             	movzbl (%edx),%ecx
+  800851:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800854:	80 f9 01             	cmp    $0x1,%cl
+  800857:	83 da ff             	sbb    $0xffffffff,%edx
+  80085a:	39 d8                	cmp    %ebx,%eax
+  80085c:	75 ed                	jne    80084b <strncpy+0x14>
+  80085e:	89 f0                	mov    %esi,%eax
+  800860:	5b                   	pop    %ebx
+  800861:	5e                   	pop    %esi
+  800862:	5d                   	pop    %ebp
+  800863:	c3                   	ret
+
+00800864 <strlcpy>:
+  800864:	55                   	push   %ebp
+  800865:	89 e5                	mov    %esp,%ebp
+  800867:	56                   	push   %esi
+  800868:	53                   	push   %ebx
+  800869:	8b 75 08             	mov    0x8(%ebp),%esi
+  80086c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80086f:	8b 55 10             	mov    0x10(%ebp),%edx
+  800872:	89 f0                	mov    %esi,%eax
+  800874:	85 d2                	test   %edx,%edx
+  800876:	74 21                	je     800899 <strlcpy+0x35>
+  800878:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80087c:	89 f2                	mov    %esi,%edx
+  80087e:	eb 09                	jmp    800889 <strlcpy+0x25>
+  800880:	83 c1 01             	add    $0x1,%ecx
+  800883:	83 c2 01             	add    $0x1,%edx
+  800886:	88 5a ff             	mov    %bl,-0x1(%edx)
+  800889:	39 c2                	cmp    %eax,%edx
+  80088b:	74 09                	je     800896 <strlcpy+0x32>
+  80088d:	0f b6 19             	movzbl (%ecx),%ebx
+  800890:	84 db                	test   %bl,%bl
+  800892:	75 ec                	jne    800880 <strlcpy+0x1c>
+  800894:	89 d0                	mov    %edx,%eax
+  800896:	c6 00 00             	movb   $0x0,(%eax)
+  800899:	29 f0                	sub    %esi,%eax
+  80089b:	5b                   	pop    %ebx
+  80089c:	5e                   	pop    %esi
+  80089d:	5d                   	pop    %ebp
+  80089e:	c3                   	ret
+
+0080089f <strcmp>:
+  80089f:	55                   	push   %ebp
+  8008a0:	89 e5                	mov    %esp,%ebp
+  8008a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a8:	eb 06                	jmp    8008b0 <strcmp+0x11>
+  8008aa:	83 c1 01             	add    $0x1,%ecx
+  8008ad:	83 c2 01             	add    $0x1,%edx
+  8008b0:	0f b6 01             	movzbl (%ecx),%eax
+  8008b3:	84 c0                	test   %al,%al
+  8008b5:	74 04                	je     8008bb <strcmp+0x1c>
+  8008b7:	3a 02                	cmp    (%edx),%al
+  8008b9:	74 ef                	je     8008aa <strcmp+0xb>
+  8008bb:	0f b6 c0             	movzbl %al,%eax
+  8008be:	0f b6 12             	movzbl (%edx),%edx
+  8008c1:	29 d0                	sub    %edx,%eax
+  8008c3:	5d                   	pop    %ebp
+  8008c4:	c3                   	ret
+
+008008c5 <strncmp>:
+  8008c5:	55                   	push   %ebp
+  8008c6:	89 e5                	mov    %esp,%ebp
+  8008c8:	53                   	push   %ebx
+  8008c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008cf:	8b 55 10             	mov    0x10(%ebp),%edx
+  8008d2:	eb 09                	jmp    8008dd <strncmp+0x18>
+  8008d4:	83 ea 01             	sub    $0x1,%edx
+  8008d7:	83 c0 01             	add    $0x1,%eax
+  8008da:	83 c1 01             	add    $0x1,%ecx
+  8008dd:	85 d2                	test   %edx,%edx
+  8008df:	74 18                	je     8008f9 <strncmp+0x34>
+  8008e1:	0f b6 18             	movzbl (%eax),%ebx
+  8008e4:	84 db                	test   %bl,%bl
+  8008e6:	74 04                	je     8008ec <strncmp+0x27>
+  8008e8:	3a 19                	cmp    (%ecx),%bl
+  8008ea:	74 e8                	je     8008d4 <strncmp+0xf>
+  8008ec:	0f b6 00             	movzbl (%eax),%eax
+  8008ef:	0f b6 11             	movzbl (%ecx),%edx
+  8008f2:	29 d0                	sub    %edx,%eax
+  8008f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f7:	c9                   	leave
+  8008f8:	c3                   	ret
+  8008f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fe:	eb f4                	jmp    8008f4 <strncmp+0x2f>
+
+00800900 <strchr>:
+  800900:	55                   	push   %ebp
+  800901:	89 e5                	mov    %esp,%ebp
+  800903:	8b 45 08             	mov    0x8(%ebp),%eax
+  800906:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80090a:	eb 03                	jmp    80090f <strchr+0xf>
+  80090c:	83 c0 01             	add    $0x1,%eax
+  80090f:	0f b6 10             	movzbl (%eax),%edx
+  800912:	84 d2                	test   %dl,%dl
+  800914:	74 06                	je     80091c <strchr+0x1c>
+  800916:	38 ca                	cmp    %cl,%dl
+  800918:	75 f2                	jne    80090c <strchr+0xc>
+  80091a:	eb 05                	jmp    800921 <strchr+0x21>
+  80091c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800921:	5d                   	pop    %ebp
+  800922:	c3                   	ret
+
+00800923 <strfind>:
+  800923:	55                   	push   %ebp
+  800924:	89 e5                	mov    %esp,%ebp
+  800926:	8b 45 08             	mov    0x8(%ebp),%eax
+  800929:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80092d:	0f b6 10             	movzbl (%eax),%edx
+  800930:	38 ca                	cmp    %cl,%dl
+  800932:	74 09                	je     80093d <strfind+0x1a>
+  800934:	84 d2                	test   %dl,%dl
+  800936:	74 05                	je     80093d <strfind+0x1a>
+  800938:	83 c0 01             	add    $0x1,%eax
+  80093b:	eb f0                	jmp    80092d <strfind+0xa>
+  80093d:	5d                   	pop    %ebp
+  80093e:	c3                   	ret
+
+0080093f <memset>:
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	57                   	push   %edi
+  800943:	56                   	push   %esi
+  800944:	53                   	push   %ebx
+  800945:	83 ec 04             	sub    $0x4,%esp
+  800948:	8b 75 08             	mov    0x8(%ebp),%esi
+  80094b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80094e:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  800952:	89 f7                	mov    %esi,%edi
+  800954:	83 fa 0f             	cmp    $0xf,%edx
+  800957:	76 24                	jbe    80097d <memset+0x3e>
+  800959:	89 f1                	mov    %esi,%ecx
+  80095b:	f7 d9                	neg    %ecx
+  80095d:	83 e1 03             	and    $0x3,%ecx
+  800960:	29 ca                	sub    %ecx,%edx
+  800962:	89 d0                	mov    %edx,%eax
+  800964:	c1 e8 02             	shr    $0x2,%eax
+  800967:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  80096a:	83 e2 03             	and    $0x3,%edx
+  80096d:	89 d8                	mov    %ebx,%eax
+  80096f:	fc                   	cld
+  800970:	f3 aa                	rep stos %al,%es:(%edi)
+  800972:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  800978:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  80097b:	f3 ab                	rep stos %eax,%es:(%edi)
+  80097d:	89 d1                	mov    %edx,%ecx
+  80097f:	89 d8                	mov    %ebx,%eax
+  800981:	fc                   	cld
+  800982:	f3 aa                	rep stos %al,%es:(%edi)
+  800984:	89 f0                	mov    %esi,%eax
+  800986:	83 c4 04             	add    $0x4,%esp
+  800989:	5b                   	pop    %ebx
+  80098a:	5e                   	pop    %esi
+  80098b:	5f                   	pop    %edi
+  80098c:	5d                   	pop    %ebp
+  80098d:	c3                   	ret
+
+0080098e <memmove>:
+  80098e:	55                   	push   %ebp
+  80098f:	89 e5                	mov    %esp,%ebp
+  800991:	57                   	push   %edi
+  800992:	56                   	push   %esi
+  800993:	53                   	push   %ebx
+  800994:	83 ec 0c             	sub    $0xc,%esp
+  800997:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80099a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80099d:	8b 45 10             	mov    0x10(%ebp),%eax
+  8009a0:	85 c0                	test   %eax,%eax
+  8009a2:	74 14                	je     8009b8 <memmove+0x2a>
+  8009a4:	39 da                	cmp    %ebx,%edx
+  8009a6:	73 07                	jae    8009af <memmove+0x21>
+  8009a8:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8009ab:	39 cb                	cmp    %ecx,%ebx
+  8009ad:	72 13                	jb     8009c2 <memmove+0x34>
+  8009af:	89 c1                	mov    %eax,%ecx
+  8009b1:	89 d8                	mov    %ebx,%eax
+  8009b3:	e8 94 fd ff ff       	call   80074c <copy_fwd>
+  8009b8:	89 d8                	mov    %ebx,%eax
+  8009ba:	83 c4 0c             	add    $0xc,%esp
+  8009bd:	5b                   	pop    %ebx
+  8009be:	5e                   	pop    %esi
+  8009bf:	5f                   	pop    %edi
+  8009c0:	5d                   	pop    %ebp
+  8009c1:	c3                   	ret
+  8009c2:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  8009c5:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  8009c8:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  8009cb:	83 f8 0f             	cmp    $0xf,%eax
+  8009ce:	76 23                	jbe    8009f3 <memmove+0x65>
+  8009d0:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  8009d3:	83 e1 03             	and    $0x3,%ecx
+  8009d6:	29 c8                	sub    %ecx,%eax
+  8009d8:	89 c2                	mov    %eax,%edx
+  8009da:	c1 ea 02             	shr    $0x2,%edx
+  8009dd:	83 e0 03             	and    $0x3,%eax
+  8009e0:	fd                   	std
+  8009e1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8009e3:	83 ef 03             	sub    $0x3,%edi
+  8009e6:	83 ee 03             	sub    $0x3,%esi
+  8009e9:	89 d1                	mov    %edx,%ecx
+  8009eb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009ed:	83 c7 03             	add    $0x3,%edi
+  8009f0:	83 c6 03             	add    $0x3,%esi
+  8009f3:	89 c1                	mov    %eax,%ecx
+  8009f5:	fd                   	std
+  8009f6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8009f8:	fc                   	cld
+  8009f9:	eb bd                	jmp    8009b8 <memmove+0x2a>
+
+008009fb <memcpy>:
+  8009fb:	55                   	push   %ebp
+  8009fc:	89 e5                	mov    %esp,%ebp
+  8009fe:	53                   	push   %ebx
+  8009ff:	83 ec 04             	sub    $0x4,%esp
+  800a02:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a05:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a08:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a0b:	89 d8                	mov    %ebx,%eax
+  800a0d:	e8 3a fd ff ff       	call   80074c <copy_fwd>
+  800a12:	89 d8                	mov    %ebx,%eax
+  800a14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a17:	c9                   	leave
+  800a18:	c3                   	ret
+
+00800a19 <page_copy>:
+  800a19:	55                   	push   %ebp
+  800a1a:	89 e5                	mov    %esp,%ebp
+  800a1c:	57                   	push   %edi
+  800a1d:	56                   	push   %esi
+  800a1e:	53                   	push   %ebx
+  800a1f:	83 ec 0c             	sub    $0xc,%esp
+  800a22:	e8 5c fd ff ff       	call   800783 <have_sse2>
+  800a27:	85 c0                	test   %eax,%eax
+  800a29:	74 39                	je     800a64 <page_copy+0x4b>
+  800a2b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a2e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a31:	be 00 01 00 00       	mov    $0x100,%esi
+  800a36:	8b 03                	mov    (%ebx),%eax
+  800a38:	8b 53 04             	mov    0x4(%ebx),%edx
+  800a3b:	0f c3 01             	movnti %eax,(%ecx)
+  800a3e:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800a42:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a45:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800a48:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800a4c:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800a50:	83 c3 10             	add    $0x10,%ebx
+  800a53:	83 c1 10             	add    $0x10,%ecx
+  800a56:	4e                   	dec    %esi
+  800a57:	75 dd                	jne    800a36 <page_copy+0x1d>
+  800a59:	0f ae f8             	sfence
+  800a5c:	83 c4 0c             	add    $0xc,%esp
+  800a5f:	5b                   	pop    %ebx
+  800a60:	5e                   	pop    %esi
+  800a61:	5f                   	pop    %edi
+  800a62:	5d                   	pop    %ebp
+  800a63:	c3                   	ret
+  800a64:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a67:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a6a:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800a6f:	fc                   	cld
+  800a70:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a72:	eb e8                	jmp    800a5c <page_copy+0x43>
+
+00800a74 <page_zero>:
+  800a74:	55                   	push   %ebp
+  800a75:	89 e5                	mov    %esp,%ebp
+  800a77:	57                   	push   %edi
+  800a78:	83 ec 04             	sub    $0x4,%esp
+  800a7b:	e8 03 fd ff ff       	call   800783 <have_sse2>
+  800a80:	85 c0                	test   %eax,%eax
+  800a82:	74 3a                	je     800abe <page_zero+0x4a>
+  800a84:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a87:	ba 80 00 00 00       	mov    $0x80,%edx
+  800a8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a91:	0f c3 08             	movnti %ecx,(%eax)
+  800a94:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800a98:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800a9c:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800aa0:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800aa4:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800aa8:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800aac:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800ab0:	83 c0 20             	add    $0x20,%eax
+  800ab3:	4a                   	dec    %edx
+  800ab4:	75 db                	jne    800a91 <page_zero+0x1d>
+  800ab6:	0f ae f8             	sfence
+  800ab9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800abc:	c9                   	leave
+  800abd:	c3                   	ret
+  800abe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ac1:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800ac6:	fc                   	cld
+  800ac7:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ac9:	eb ee                	jmp    800ab9 <page_zero+0x45>
+
+00800acb <memcmp>:
+  800acb:	55                   	push   %ebp
+  800acc:	89 e5                	mov    %esp,%ebp
+  800ace:	56                   	push   %esi
+  800acf:	53                   	push   %ebx
+  800ad0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ad6:	89 c6                	mov    %eax,%esi
+  800ad8:	03 75 10             	add    0x10(%ebp),%esi
+  800adb:	eb 06                	jmp    800ae3 <memcmp+0x18>
+  800add:	83 c0 01             	add    $0x1,%eax
+  800ae0:	83 c2 01             	add    $0x1,%edx
+  800ae3:	39 f0                	cmp    %esi,%eax
+  800ae5:	74 14                	je     800afb <memcmp+0x30>
+  800ae7:	0f b6 08             	movzbl (%eax),%ecx
+  800aea:	0f b6 1a             	movzbl (%edx),%ebx
+  800aed:	38 d9                	cmp    %bl,%cl
+  800aef:	74 ec                	je     800add <memcmp+0x12>
+  800af1:	0f b6 c1             	movzbl %cl,%eax
+  800af4:	0f b6 db             	movzbl %bl,%ebx
+  800af7:	29 d8                	sub    %ebx,%eax
+  800af9:	eb 05                	jmp    800b00 <memcmp+0x35>
+  800afb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b00:	5b                   	pop    %ebx
+  800b01:	5e                   	pop    %esi
+  800b02:	5d                   	pop    %ebp
+  800b03:	c3                   	ret
+
+00800b04 <memfind>:
+  800b04:	55                   	push   %ebp
+  800b05:	89 e5                	mov    %esp,%ebp
+  800b07:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b0d:	89 c2                	mov    %eax,%edx
+  800b0f:	03 55 10             	add    0x10(%ebp),%edx
+  800b12:	eb 03                	jmp    800b17 <memfind+0x13>
+  800b14:	83 c0 01             	add    $0x1,%eax
+  800b17:	39 d0                	cmp    %edx,%eax
+  800b19:	73 04                	jae    800b1f <memfind+0x1b>
+  800b1b:	38 08                	cmp    %cl,(%eax)
+  800b1d:	75 f5                	jne    800b14 <memfind+0x10>
+  800b1f:	5d                   	pop    %ebp
+  800b20:	c3                   	ret
+
+00800b21 <strtol>:
+  800b21:	55                   	push   %ebp
+  800b22:	89 e5                	mov    %esp,%ebp
+  800b24:	57                   	push   %edi
+  800b25:	56                   	push   %esi
+  800b26:	53                   	push   %ebx
+  800b27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b2d:	eb 03                	jmp    800b32 <strtol+0x11>
+  800b2f:	83 c2 01             	add    $0x1,%edx
+  800b32:	0f b6 02             	movzbl (%edx),%eax
+  800b35:	3c 20                	cmp    $0x20,%al
+  800b37:	74 f6                	je     800b2f <strtol+0xe>
+  800b39:	3c 09                	cmp    $0x9,%al
+  800b3b:	74 f2                	je     800b2f <strtol+0xe>
+  800b3d:	3c 2b                	cmp    $0x2b,%al
+  800b3f:	74 2a                	je     800b6b <strtol+0x4a>
+  800b41:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b46:	3c 2d                	cmp    $0x2d,%al
+  800b48:	74 2b                	je     800b75 <strtol+0x54>
+  800b4a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b50:	75 0f                	jne    800b61 <strtol+0x40>
+  800b52:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b55:	74 28                	je     800b7f <strtol+0x5e>
+  800b57:	85 db                	test   %ebx,%ebx
+  800b59:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b5e:	0f 44 d8             	cmove  %eax,%ebx
+  800b61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b66:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b69:	eb 46                	jmp    800bb1 <strtol+0x90>
+  800b6b:	83 c2 01             	add    $0x1,%edx
+  800b6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b73:	eb d5                	jmp    800b4a <strtol+0x29>
+  800b75:	83 c2 01             	add    $0x1,%edx
+  800b78:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b7d:	eb cb                	jmp    800b4a <strtol+0x29>
+  800b7f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b83:	74 0e                	je     800b93 <strtol+0x72>
+  800b85:	85 db                	test   %ebx,%ebx
+  800b87:	75 d8                	jne    800b61 <strtol+0x40>
+  800b89:	83 c2 01             	add    $0x1,%edx
+  800b8c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b91:	eb ce                	jmp    800b61 <strtol+0x40>
+  800b93:	83 c2 02             	add    $0x2,%edx
+  800b96:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b9b:	eb c4                	jmp    800b61 <strtol+0x40>
+  800b9d:	0f be c0             	movsbl %al,%eax
+  800ba0:	83 e8 30             	sub    $0x30,%eax
+  800ba3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ba6:	7d 3a                	jge    800be2 <strtol+0xc1>
+  800ba8:	83 c2 01             	add    $0x1,%edx
+  800bab:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800baf:	01 c1                	add    %eax,%ecx
+  800bb1:	0f b6 02             	movzbl (%edx),%eax
+  800bb4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bb7:	89 f3                	mov    %esi,%ebx
+  800bb9:	80 fb 09             	cmp    $0x9,%bl
+  800bbc:	76 df                	jbe    800b9d <strtol+0x7c>
+  800bbe:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bc1:	89 f3                	mov    %esi,%ebx
+  800bc3:	80 fb 19             	cmp    $0x19,%bl
+  800bc6:	77 08                	ja     800bd0 <strtol+0xaf>
+  800bc8:	0f be c0             	movsbl %al,%eax
+  800bcb:	83 e8 57             	sub    $0x57,%eax
+  800bce:	eb d3                	jmp    800ba3 <strtol+0x82>
+  800bd0:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bd3:	89 f3                	mov    %esi,%ebx
+  800bd5:	80 fb 19             	cmp    $0x19,%bl
+  800bd8:	77 08                	ja     800be2 <strtol+0xc1>
+  800bda:	0f be c0             	movsbl %al,%eax
+  800bdd:	83 e8 37             	sub    $0x37,%eax
+  800be0:	eb c1                	jmp    800ba3 <strtol+0x82>
+  800be2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800be6:	74 05                	je     800bed <strtol+0xcc>
+  800be8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800beb:	89 10                	mov    %edx,(%eax)
+  800bed:	89 c8                	mov    %ecx,%eax
+  800bef:	f7 d8                	neg    %eax
+  800bf1:	85 ff                	test   %edi,%edi
+  800bf3:	0f 45 c8             	cmovne %eax,%ecx
+  800bf6:	89 c8                	mov    %ecx,%eax
+  800bf8:	5b                   	pop    %ebx
+  800bf9:	5e                   	pop    %esi
+  800bfa:	5f                   	pop    %edi
+  800bfb:	5d                   	pop    %ebp
+  800bfc:	c3                   	ret
+
+00800bfd <sys_cputs>:
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	57                   	push   %edi
+  800c01:	56                   	push   %esi
+  800c02:	53                   	push   %ebx
+  800c03:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c0a:	78 21                	js     800c2d <sys_cputs+0x30>
+  800c0c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c13:	75 2d                	jne    800c42 <sys_cputs+0x45>
+  800c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c20:	89 c3                	mov    %eax,%ebx
+  800c22:	89 c7                	mov    %eax,%edi
+  800c24:	89 c6                	mov    %eax,%esi
+  800c26:	cd 30                	int    $0x30
+  800c28:	5b                   	pop    %ebx
+  800c29:	5e                   	pop    %esi
+  800c2a:	5f                   	pop    %edi
+  800c2b:	5d                   	pop    %ebp
+  800c2c:	c3                   	ret
+  800c2d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c32:	0f a2                	cpuid
+  800c34:	c1 ea 0b             	shr    $0xb,%edx
+  800c37:	83 e2 01             	and    $0x1,%edx
+  800c3a:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800c40:	eb ca                	jmp    800c0c <sys_cputs+0xf>
+  800c42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c4d:	89 c3                	mov    %eax,%ebx
+  800c4f:	89 c7                	mov    %eax,%edi
+  800c51:	89 c6                	mov    %eax,%esi
+  800c53:	55                   	push   %ebp
+  800c54:	68 5d 0c 80 00       	push   $0x800c5d
+  800c59:	89 e5                	mov    %esp,%ebp
+  800c5b:	0f 34                	sysenter
+  800c5d:	83 c4 04             	add    $0x4,%esp
+  800c60:	5d                   	pop    %ebp
+  800c61:	eb c5                	jmp    800c28 <sys_cputs+0x2b>
+
+00800c63 <sys_cgetc>:
+  800c63:	55                   	push   %ebp
+  800c64:	89 e5                	mov    %esp,%ebp
+  800c66:	57                   	push   %edi
+  800c67:	56                   	push   %esi
+  800c68:	53                   	push   %ebx
+  800c69:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c70:	78 22                	js     800c94 <sys_cgetc+0x31>
+  800c72:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c79:	75 2e                	jne    800ca9 <sys_cgetc+0x46>
+  800c7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c80:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c85:	89 d1                	mov    %edx,%ecx
+  800c87:	89 d3                	mov    %edx,%ebx
+  800c89:	89 d7                	mov    %edx,%edi
+  800c8b:	89 d6                	mov    %edx,%esi
+  800c8d:	cd 30                	int    $0x30
+  800c8f:	5b                   	pop    %ebx
+  800c90:	5e                   	pop    %esi
+  800c91:	5f                   	pop    %edi
+  800c92:	5d                   	pop    %ebp
+  800c93:	c3                   	ret
+  800c94:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c99:	0f a2                	cpuid
+  800c9b:	c1 ea 0b             	shr    $0xb,%edx
+  800c9e:	83 e2 01             	and    $0x1,%edx
+  800ca1:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800ca7:	eb c9                	jmp    800c72 <sys_cgetc+0xf>
+  800ca9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cae:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cb3:	89 d1                	mov    %edx,%ecx
+  800cb5:	89 d3                	mov    %edx,%ebx
+  800cb7:	89 d7                	mov    %edx,%edi
+  800cb9:	89 d6                	mov    %edx,%esi
+  800cbb:	55                   	push   %ebp
+  800cbc:	68 c5 0c 80 00       	push   $0x800cc5
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	0f 34                	sysenter
+  800cc5:	83 c4 04             	add    $0x4,%esp
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	eb c4                	jmp    800c8f <sys_cgetc+0x2c>
+
+00800ccb <sys_env_destroy>:
+  800ccb:	55                   	push   %ebp
+  800ccc:	89 e5                	mov    %esp,%ebp
+  800cce:	57                   	push   %edi
+  800ccf:	56                   	push   %esi
+  800cd0:	53                   	push   %ebx
+  800cd1:	83 ec 0c             	sub    $0xc,%esp
+  800cd4:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800cdb:	78 2a                	js     800d07 <sys_env_destroy+0x3c>
+  800cdd:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800ce4:	75 36                	jne    800d1c <sys_env_destroy+0x51>
+  800ce6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ceb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cf0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf3:	89 cb                	mov    %ecx,%ebx
+  800cf5:	89 cf                	mov    %ecx,%edi
+  800cf7:	89 ce                	mov    %ecx,%esi
+  800cf9:	cd 30                	int    $0x30
+  800cfb:	85 c0                	test   %eax,%eax
+  800cfd:	7f 40                	jg     800d3f <sys_env_destroy+0x74>
+  800cff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d02:	5b                   	pop    %ebx
+  800d03:	5e                   	pop    %esi
+  800d04:	5f                   	pop    %edi
+  800d05:	5d                   	pop    %ebp
+  800d06:	c3                   	ret
+  800d07:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d0c:	0f a2                	cpuid
+  800d0e:	c1 ea 0b             	shr    $0xb,%edx
+  800d11:	83 e2 01             	and    $0x1,%edx
+  800d14:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800d1a:	eb c1                	jmp    800cdd <sys_env_destroy+0x12>
+  800d1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d24:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d29:	89 cb                	mov    %ecx,%ebx
+  800d2b:	89 cf                	mov    %ecx,%edi
+  800d2d:	89 ce                	mov    %ecx,%esi
+  800d2f:	55                   	push   %ebp
+  800d30:	68 39 0d 80 00       	push   $0x800d39
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	0f 34                	sysenter
+  800d39:	83 c4 04             	add    $0x4,%esp
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	eb bc                	jmp    800cfb <sys_env_destroy+0x30>
+  800d3f:	83 ec 0c             	sub    $0xc,%esp
+  800d42:	50                   	push   %eax
+  800d43:	6a 03                	push   $0x3
+  800d45:	68 c4 1d 80 00       	push   $0x801dc4
+  800d4a:	6a 49                	push   $0x49
+  800d4c:	68 e1 1d 80 00       	push   $0x801de1
+  800d51:	e8 13 0b 00 00       	call   801869 <_panic>
+
+00800d56 <sys_getenvid>:
+  800d56:	55                   	push   %ebp
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	57                   	push   %edi
+  800d5a:	56                   	push   %esi
+  800d5b:	53                   	push   %ebx
+  800d5c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d63:	78 22                	js     800d87 <sys_getenvid+0x31>
+  800d65:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d6c:	75 2e                	jne    800d9c <sys_getenvid+0x46>
+  800d6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d73:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d78:	89 d1                	mov    %edx,%ecx
+  800d7a:	89 d3                	mov    %edx,%ebx
+  800d7c:	89 d7                	mov    %edx,%edi
+  800d7e:	89 d6                	mov    %edx,%esi
+  800d80:	cd 30                	int    $0x30
+  800d82:	5b                   	pop    %ebx
+  800d83:	5e                   	pop    %esi
+  800d84:	5f                   	pop    %edi
+  800d85:	5d                   	pop    %ebp
+  800d86:	c3                   	ret
+  800d87:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d8c:	0f a2                	cpuid
+  800d8e:	c1 ea 0b             	shr    $0xb,%edx
+  800d91:	83 e2 01             	and    $0x1,%edx
+  800d94:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800d9a:	eb c9                	jmp    800d65 <sys_getenvid+0xf>
+  800d9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da1:	b8 02 00 00 00       	mov    $0x2,%eax
+  800da6:	89 d1                	mov    %edx,%ecx
+  800da8:	89 d3                	mov    %edx,%ebx
+  800daa:	89 d7                	mov    %edx,%edi
+  800dac:	89 d6                	mov    %edx,%esi
+  800dae:	55                   	push   %ebp
+  800daf:	68 b8 0d 80 00       	push   $0x800db8
+  800db4:	89 e5                	mov    %esp,%ebp
+  800db6:	0f 34                	sysenter
+  800db8:	83 c4 04             	add    $0x4,%esp
+  800dbb:	5d                   	pop    %ebp
+  800dbc:	eb c4                	jmp    800d82 <sys_getenvid+0x2c>
+
+00800dbe <sys_yield>:
+  800dbe:	55                   	push   %ebp
+  800dbf:	89 e5                	mov    %esp,%ebp
+  800dc1:	57                   	push   %edi
+  800dc2:	56                   	push   %esi
+  800dc3:	53                   	push   %ebx
+  800dc4:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800dcb:	78 22                	js     800def <sys_yield+0x31>
+  800dcd:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800dd4:	75 2e                	jne    800e04 <sys_yield+0x46>
+  800dd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ddb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800de0:	89 d1                	mov    %edx,%ecx
+  800de2:	89 d3                	mov    %edx,%ebx
+  800de4:	89 d7                	mov    %edx,%edi
+  800de6:	89 d6                	mov    %edx,%esi
+  800de8:	cd 30                	int    $0x30
+  800dea:	5b                   	pop    %ebx
+  800deb:	5e                   	pop    %esi
+  800dec:	5f                   	pop    %edi
+  800ded:	5d                   	pop    %ebp
+  800dee:	c3                   	ret
+  800def:	b8 01 00 00 00       	mov    $0x1,%eax
+  800df4:	0f a2                	cpuid
+  800df6:	c1 ea 0b             	shr    $0xb,%edx
+  800df9:	83 e2 01             	and    $0x1,%edx
+  800dfc:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800e02:	eb c9                	jmp    800dcd <sys_yield+0xf>
+  800e04:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e09:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e0e:	89 d1                	mov    %edx,%ecx
+  800e10:	89 d3                	mov    %edx,%ebx
+  800e12:	89 d7                	mov    %edx,%edi
+  800e14:	89 d6                	mov    %edx,%esi
+  800e16:	55                   	push   %ebp
+  800e17:	68 20 0e 80 00       	push   $0x800e20
+  800e1c:	89 e5                	mov    %esp,%ebp
+  800e1e:	0f 34                	sysenter
+  800e20:	83 c4 04             	add    $0x4,%esp
+  800e23:	5d                   	pop    %ebp
+  800e24:	eb c4                	jmp    800dea <sys_yield+0x2c>
+
+00800e26 <sys_env_set_cow>:
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	57                   	push   %edi
+  800e2a:	56                   	push   %esi
+  800e2b:	53                   	push   %ebx
+  800e2c:	83 ec 0c             	sub    $0xc,%esp
+  800e2f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e36:	78 2b                	js     800e63 <sys_env_set_cow+0x3d>
+  800e38:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e3f:	75 37                	jne    800e78 <sys_env_set_cow+0x52>
+  800e41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e46:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e51:	89 df                	mov    %ebx,%edi
+  800e53:	89 de                	mov    %ebx,%esi
+  800e55:	cd 30                	int    $0x30
+  800e57:	85 c0                	test   %eax,%eax
+  800e59:	7f 41                	jg     800e9c <sys_env_set_cow+0x76>
+  800e5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5e:	5b                   	pop    %ebx
+  800e5f:	5e                   	pop    %esi
+  800e60:	5f                   	pop    %edi
+  800e61:	5d                   	pop    %ebp
+  800e62:	c3                   	ret
+  800e63:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e68:	0f a2                	cpuid
+  800e6a:	c1 ea 0b             	shr    $0xb,%edx
+  800e6d:	83 e2 01             	and    $0x1,%edx
+  800e70:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800e76:	eb c0                	jmp    800e38 <sys_env_set_cow+0x12>
+  800e78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e83:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e88:	89 df                	mov    %ebx,%edi
+  800e8a:	89 de                	mov    %ebx,%esi
+  800e8c:	55                   	push   %ebp
+  800e8d:	68 96 0e 80 00       	push   $0x800e96
+  800e92:	89 e5                	mov    %esp,%ebp
+  800e94:	0f 34                	sysenter
+  800e96:	83 c4 04             	add    $0x4,%esp
+  800e99:	5d                   	pop    %ebp
+  800e9a:	eb bb                	jmp    800e57 <sys_env_set_cow+0x31>
+  800e9c:	83 ec 0c             	sub    $0xc,%esp
+  800e9f:	50                   	push   %eax
+  800ea0:	6a 0d                	push   $0xd
+  800ea2:	68 c4 1d 80 00       	push   $0x801dc4
+  800ea7:	6a 49                	push   $0x49
+  800ea9:	68 e1 1d 80 00       	push   $0x801de1
+  800eae:	e8 b6 09 00 00       	call   801869 <_panic>
+
+00800eb3 <sys_env_set_quota>:
+  800eb3:	55                   	push   %ebp
+  800eb4:	89 e5                	mov    %esp,%ebp
+  800eb6:	57                   	push   %edi
+  800eb7:	56                   	push   %esi
+  800eb8:	53                   	push   %ebx
+  800eb9:	83 ec 0c             	sub    $0xc,%esp
+  800ebc:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800ec3:	78 2b                	js     800ef0 <sys_env_set_quota+0x3d>
+  800ec5:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800ecc:	75 37                	jne    800f05 <sys_env_set_quota+0x52>
+  800ece:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ed8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ede:	89 df                	mov    %ebx,%edi
+  800ee0:	89 de                	mov    %ebx,%esi
+  800ee2:	cd 30                	int    $0x30
+  800ee4:	85 c0                	test   %eax,%eax
+  800ee6:	7f 41                	jg     800f29 <sys_env_set_quota+0x76>
+  800ee8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eeb:	5b                   	pop    %ebx
+  800eec:	5e                   	pop    %esi
+  800eed:	5f                   	pop    %edi
+  800eee:	5d                   	pop    %ebp
+  800eef:	c3                   	ret
+  800ef0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ef5:	0f a2                	cpuid
+  800ef7:	c1 ea 0b             	shr    $0xb,%edx
+  800efa:	83 e2 01             	and    $0x1,%edx
+  800efd:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800f03:	eb c0                	jmp    800ec5 <sys_env_set_quota+0x12>
+  800f05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f10:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f15:	89 df                	mov    %ebx,%edi
+  800f17:	89 de                	mov    %ebx,%esi
+  800f19:	55                   	push   %ebp
+  800f1a:	68 23 0f 80 00       	push   $0x800f23
+  800f1f:	89 e5                	mov    %esp,%ebp
+  800f21:	0f 34                	sysenter
+  800f23:	83 c4 04             	add    $0x4,%esp
+  800f26:	5d                   	pop    %ebp
+  800f27:	eb bb                	jmp    800ee4 <sys_env_set_quota+0x31>
+  800f29:	83 ec 0c             	sub    $0xc,%esp
+  800f2c:	50                   	push   %eax
+  800f2d:	6a 0f                	push   $0xf
+  800f2f:	68 c4 1d 80 00       	push   $0x801dc4
+  800f34:	6a 49                	push   $0x49
+  800f36:	68 e1 1d 80 00       	push   $0x801de1
+  800f3b:	e8 29 09 00 00       	call   801869 <_panic>
+
+00800f40 <sys_page_alloc>:
+  800f40:	55                   	push   %ebp
+  800f41:	89 e5                	mov    %esp,%ebp
+  800f43:	57                   	push   %edi
+  800f44:	56                   	push   %esi
+  800f45:	53                   	push   %ebx
+  800f46:	83 ec 0c             	sub    $0xc,%esp
+  800f49:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f50:	78 2c                	js     800f7e <sys_page_alloc+0x3e>
+  800f52:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f59:	75 38                	jne    800f93 <sys_page_alloc+0x53>
+  800f5b:	be 00 00 00 00       	mov    $0x0,%esi
+  800f60:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f6e:	89 f7                	mov    %esi,%edi
+  800f70:	cd 30                	int    $0x30
+  800f72:	85 c0                	test   %eax,%eax
+  800f74:	7f 42                	jg     800fb8 <sys_page_alloc+0x78>
+  800f76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f79:	5b                   	pop    %ebx
+  800f7a:	5e                   	pop    %esi
+  800f7b:	5f                   	pop    %edi
+  800f7c:	5d                   	pop    %ebp
+  800f7d:	c3                   	ret
+  800f7e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f83:	0f a2                	cpuid
+  800f85:	c1 ea 0b             	shr    $0xb,%edx
+  800f88:	83 e2 01             	and    $0x1,%edx
+  800f8b:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800f91:	eb bf                	jmp    800f52 <sys_page_alloc+0x12>
+  800f93:	be 00 00 00 00       	mov    $0x0,%esi
+  800f98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fa3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa6:	89 f7                	mov    %esi,%edi
+  800fa8:	55                   	push   %ebp
+  800fa9:	68 b2 0f 80 00       	push   $0x800fb2
+  800fae:	89 e5                	mov    %esp,%ebp
+  800fb0:	0f 34                	sysenter
+  800fb2:	83 c4 04             	add    $0x4,%esp
+  800fb5:	5d                   	pop    %ebp
+  800fb6:	eb ba                	jmp    800f72 <sys_page_alloc+0x32>
+  800fb8:	83 ec 0c             	sub    $0xc,%esp
+  800fbb:	50                   	push   %eax
+  800fbc:	6a 04                	push   $0x4
+  800fbe:	68 c4 1d 80 00       	push   $0x801dc4
+  800fc3:	6a 49                	push   $0x49
+  800fc5:	68 e1 1d 80 00       	push   $0x801de1
+  800fca:	e8 9a 08 00 00       	call   801869 <_panic>
+
+00800fcf <sys_page_map>:
+  800fcf:	55                   	push   %ebp
+  800fd0:	89 e5                	mov    %esp,%ebp
+  800fd2:	57                   	push   %edi
+  800fd3:	56                   	push   %esi
+  800fd4:	53                   	push   %ebx
+  800fd5:	83 ec 0c             	sub    $0xc,%esp
+  800fd8:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800fdf:	78 2b                	js     80100c <sys_page_map+0x3d>
+  800fe1:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800fe8:	75 37                	jne    801021 <sys_page_map+0x52>
+  800fea:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ffb:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ffe:	cd 30                	int    $0x30
+  801000:	85 c0                	test   %eax,%eax
+  801002:	7f 41                	jg     801045 <sys_page_map+0x76>
+  801004:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801007:	5b                   	pop    %ebx
+  801008:	5e                   	pop    %esi
+  801009:	5f                   	pop    %edi
+  80100a:	5d                   	pop    %ebp
+  80100b:	c3                   	ret
+  80100c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801011:	0f a2                	cpuid
+  801013:	c1 ea 0b             	shr    $0xb,%edx
+  801016:	83 e2 01             	and    $0x1,%edx
+  801019:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80101f:	eb c0                	jmp    800fe1 <sys_page_map+0x12>
+  801021:	8b 55 08             	mov    0x8(%ebp),%edx
+  801024:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801027:	b8 05 00 00 00       	mov    $0x5,%eax
+  80102c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80102f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801032:	8b 75 18             	mov    0x18(%ebp),%esi
+  801035:	55                   	push   %ebp
+  801036:	68 3f 10 80 00       	push   $0x80103f
+  80103b:	89 e5                	mov    %esp,%ebp
+  80103d:	0f 34                	sysenter
+  80103f:	83 c4 04             	add    $0x4,%esp
+  801042:	5d                   	pop    %ebp
+  801043:	eb bb                	jmp    801000 <sys_page_map+0x31>
+  801045:	83 ec 0c             	sub    $0xc,%esp
+  801048:	50                   	push   %eax
+  801049:	6a 05                	push   $0x5
+  80104b:	68 c4 1d 80 00       	push   $0x801dc4
+  801050:	6a 49                	push   $0x49
+  801052:	68 e1 1d 80 00       	push   $0x801de1
+  801057:	e8 0d 08 00 00       	call   801869 <_panic>
+
+0080105c <sys_page_unmap>:
+  80105c:	55                   	push   %ebp
+  80105d:	89 e5                	mov    %esp,%ebp
+  80105f:	57                   	push   %edi
+  801060:	56                   	push   %esi
+  801061:	53                   	push   %ebx
+  801062:	83 ec 0c             	sub    $0xc,%esp
+  801065:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80106c:	78 2b                	js     801099 <sys_page_unmap+0x3d>
+  80106e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801075:	75 37                	jne    8010ae <sys_page_unmap+0x52>
+  801077:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801081:	8b 55 08             	mov    0x8(%ebp),%edx
+  801084:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801087:	89 df                	mov    %ebx,%edi
+  801089:	89 de                	mov    %ebx,%esi
+  80108b:	cd 30                	int    $0x30
+  80108d:	85 c0                	test   %eax,%eax
+  80108f:	7f 41                	jg     8010d2 <sys_page_unmap+0x76>
+  801091:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801094:	5b                   	pop    %ebx
+  801095:	5e                   	pop    %esi
+  801096:	5f                   	pop    %edi
+  801097:	5d                   	pop    %ebp
+  801098:	c3                   	ret
+  801099:	b8 01 00 00 00       	mov    $0x1,%eax
+  80109e:	0f a2                	cpuid
+  8010a0:	c1 ea 0b             	shr    $0xb,%edx
+  8010a3:	83 e2 01             	and    $0x1,%edx
+  8010a6:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8010ac:	eb c0                	jmp    80106e <sys_page_unmap+0x12>
+  8010ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b9:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010be:	89 df                	mov    %ebx,%edi
+  8010c0:	89 de                	mov    %ebx,%esi
+  8010c2:	55                   	push   %ebp
+  8010c3:	68 cc 10 80 00       	push   $0x8010cc
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	0f 34                	sysenter
+  8010cc:	83 c4 04             	add    $0x4,%esp
+  8010cf:	5d                   	pop    %ebp
+  8010d0:	eb bb                	jmp    80108d <sys_page_unmap+0x31>
+  8010d2:	83 ec 0c             	sub    $0xc,%esp
+  8010d5:	50                   	push   %eax
+  8010d6:	6a 06                	push   $0x6
+  8010d8:	68 c4 1d 80 00       	push   $0x801dc4
+  8010dd:	6a 49                	push   $0x49
+  8010df:	68 e1 1d 80 00       	push   $0x801de1
+  8010e4:	e8 80 07 00 00       	call   801869 <_panic>
+
+008010e9 <sys_page_reuse>:
+  8010e9:	55                   	push   %ebp
+  8010ea:	89 e5                	mov    %esp,%ebp
+  8010ec:	57                   	push   %edi
+  8010ed:	56                   	push   %esi
+  8010ee:	53                   	push   %ebx
+  8010ef:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010f6:	78 24                	js     80111c <sys_page_reuse+0x33>
+  8010f8:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010ff:	75 30                	jne    801131 <sys_page_reuse+0x48>
+  801101:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801106:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80110b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801111:	89 df                	mov    %ebx,%edi
+  801113:	89 de                	mov    %ebx,%esi
+  801115:	cd 30                	int    $0x30
+  801117:	5b                   	pop    %ebx
+  801118:	5e                   	pop    %esi
+  801119:	5f                   	pop    %edi
+  80111a:	5d                   	pop    %ebp
+  80111b:	c3                   	ret
+  80111c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801121:	0f a2                	cpuid
+  801123:	c1 ea 0b             	shr    $0xb,%edx
+  801126:	83 e2 01             	and    $0x1,%edx
+  801129:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80112f:	eb c7                	jmp    8010f8 <sys_page_reuse+0xf>
+  801131:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801136:	8b 55 08             	mov    0x8(%ebp),%edx
+  801139:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801141:	89 df                	mov    %ebx,%edi
+  801143:	89 de                	mov    %ebx,%esi
+  801145:	55                   	push   %ebp
+  801146:	68 4f 11 80 00       	push   $0x80114f
+  80114b:	89 e5                	mov    %esp,%ebp
+  80114d:	0f 34                	sysenter
+  80114f:	83 c4 04             	add    $0x4,%esp
+  801152:	5d                   	pop    %ebp
+  801153:	eb c2                	jmp    801117 <sys_page_reuse+0x2e>
+
+00801155 <sys_env_set_status>:
+  801155:	55                   	push   %ebp
+  801156:	89 e5                	mov    %esp,%ebp
+  801158:	57                   	push   %edi
+  801159:	56                   	push   %esi
+  80115a:	53                   	push   %ebx
+  80115b:	83 ec 0c             	sub    $0xc,%esp
+  80115e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801165:	78 2b                	js     801192 <sys_env_set_status+0x3d>
+  801167:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80116e:	75 37                	jne    8011a7 <sys_env_set_status+0x52>
+  801170:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801175:	b8 08 00 00 00       	mov    $0x8,%eax
+  80117a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801180:	89 df                	mov    %ebx,%edi
+  801182:	89 de                	mov    %ebx,%esi
+  801184:	cd 30                	int    $0x30
+  801186:	85 c0                	test   %eax,%eax
+  801188:	7f 41                	jg     8011cb <sys_env_set_status+0x76>
+  80118a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80118d:	5b                   	pop    %ebx
+  80118e:	5e                   	pop    %esi
+  80118f:	5f                   	pop    %edi
+  801190:	5d                   	pop    %ebp
+  801191:	c3                   	ret
+  801192:	b8 01 00 00 00       	mov    $0x1,%eax
+  801197:	0f a2                	cpuid
+  801199:	c1 ea 0b             	shr    $0xb,%edx
+  80119c:	83 e2 01             	and    $0x1,%edx
+  80119f:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8011a5:	eb c0                	jmp    801167 <sys_env_set_status+0x12>
+  8011a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011b7:	89 df                	mov    %ebx,%edi
+  8011b9:	89 de                	mov    %ebx,%esi
+  8011bb:	55                   	push   %ebp
+  8011bc:	68 c5 11 80 00       	push   $0x8011c5
+  8011c1:	89 e5                	mov    %esp,%ebp
+  8011c3:	0f 34                	sysenter
+  8011c5:	83 c4 04             	add    $0x4,%esp
+  8011c8:	5d                   	pop    %ebp
+  8011c9:	eb bb                	jmp    801186 <sys_env_set_status+0x31>
+  8011cb:	83 ec 0c             	sub    $0xc,%esp
+  8011ce:	50                   	push   %eax
+  8011cf:	6a 08                	push   $0x8
+  8011d1:	68 c4 1d 80 00       	push   $0x801dc4
+  8011d6:	6a 49                	push   $0x49
+  8011d8:	68 e1 1d 80 00       	push   $0x801de1
+  8011dd:	e8 87 06 00 00       	call   801869 <_panic>
+
+008011e2 <sys_env_set_pgfault_upcall>:
+  8011e2:	55                   	push   %ebp
+  8011e3:	89 e5                	mov    %esp,%ebp
+  8011e5:	57                   	push   %edi
+  8011e6:	56                   	push   %esi
+  8011e7:	53                   	push   %ebx
+  8011e8:	83 ec 0c             	sub    $0xc,%esp
+  8011eb:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011f2:	78 2b                	js     80121f <sys_env_set_pgfault_upcall+0x3d>
+  8011f4:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011fb:	75 37                	jne    801234 <sys_env_set_pgfault_upcall+0x52>
+  8011fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801202:	b8 09 00 00 00       	mov    $0x9,%eax
+  801207:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120d:	89 df                	mov    %ebx,%edi
+  80120f:	89 de                	mov    %ebx,%esi
+  801211:	cd 30                	int    $0x30
+  801213:	85 c0                	test   %eax,%eax
+  801215:	7f 41                	jg     801258 <sys_env_set_pgfault_upcall+0x76>
+  801217:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80121a:	5b                   	pop    %ebx
+  80121b:	5e                   	pop    %esi
+  80121c:	5f                   	pop    %edi
+  80121d:	5d                   	pop    %ebp
+  80121e:	c3                   	ret
+  80121f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801224:	0f a2                	cpuid
+  801226:	c1 ea 0b             	shr    $0xb,%edx
+  801229:	83 e2 01             	and    $0x1,%edx
+  80122c:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801232:	eb c0                	jmp    8011f4 <sys_env_set_pgfault_upcall+0x12>
+  801234:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801239:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801244:	89 df                	mov    %ebx,%edi
+  801246:	89 de                	mov    %ebx,%esi
+  801248:	55                   	push   %ebp
+  801249:	68 52 12 80 00       	push   $0x801252
+  80124e:	89 e5                	mov    %esp,%ebp
+  801250:	0f 34                	sysenter
+  801252:	83 c4 04             	add    $0x4,%esp
+  801255:	5d                   	pop    %ebp
+  801256:	eb bb                	jmp    801213 <sys_env_set_pgfault_upcall+0x31>
+  801258:	83 ec 0c             	sub    $0xc,%esp
+  80125b:	50                   	push   %eax
+  80125c:	6a 09                	push   $0x9
+  80125e:	68 c4 1d 80 00       	push   $0x801dc4
+  801263:	6a 49                	push   $0x49
+  801265:	68 e1 1d 80 00       	push   $0x801de1
+  80126a:	e8 fa 05 00 00       	call   801869 <_panic>
+
+0080126f <sys_env_set_trace>:
+  80126f:	55                   	push   %ebp
+  801270:	89 e5                	mov    %esp,%ebp
+  801272:	57                   	push   %edi
+  801273:	56                   	push   %esi
+  801274:	53                   	push   %ebx
+  801275:	83 ec 0c             	sub    $0xc,%esp
+  801278:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80127f:	78 2b                	js     8012ac <sys_env_set_trace+0x3d>
+  801281:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801288:	75 37                	jne    8012c1 <sys_env_set_trace+0x52>
+  80128a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801294:	8b 55 08             	mov    0x8(%ebp),%edx
+  801297:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129a:	89 df                	mov    %ebx,%edi
+  80129c:	89 de                	mov    %ebx,%esi
+  80129e:	cd 30                	int    $0x30
+  8012a0:	85 c0                	test   %eax,%eax
+  8012a2:	7f 41                	jg     8012e5 <sys_env_set_trace+0x76>
+  8012a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a7:	5b                   	pop    %ebx
+  8012a8:	5e                   	pop    %esi
+  8012a9:	5f                   	pop    %edi
+  8012aa:	5d                   	pop    %ebp
+  8012ab:	c3                   	ret
+  8012ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012b1:	0f a2                	cpuid
+  8012b3:	c1 ea 0b             	shr    $0xb,%edx
+  8012b6:	83 e2 01             	and    $0x1,%edx
+  8012b9:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8012bf:	eb c0                	jmp    801281 <sys_env_set_trace+0x12>
+  8012c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012cc:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012d1:	89 df                	mov    %ebx,%edi
+  8012d3:	89 de                	mov    %ebx,%esi
+  8012d5:	55                   	push   %ebp
+  8012d6:	68 df 12 80 00       	push   $0x8012df
+  8012db:	89 e5                	mov    %esp,%ebp
+  8012dd:	0f 34                	sysenter
+  8012df:	83 c4 04             	add    $0x4,%esp
+  8012e2:	5d                   	pop    %ebp
+  8012e3:	eb bb                	jmp    8012a0 <sys_env_set_trace+0x31>
+  8012e5:	83 ec 0c             	sub    $0xc,%esp
+  8012e8:	50                   	push   %eax
+  8012e9:	6a 12                	push   $0x12
+  8012eb:	68 c4 1d 80 00       	push   $0x801dc4
+  8012f0:	6a 49                	push   $0x49
+  8012f2:	68 e1 1d 80 00       	push   $0x801de1
+  8012f7:	e8 6d 05 00 00       	call   801869 <_panic>
+
+008012fc <sys_env_set_rdpmc>:
+  8012fc:	55                   	push   %ebp
+  8012fd:	89 e5                	mov    %esp,%ebp
+  8012ff:	57                   	push   %edi
+  801300:	56                   	push   %esi
+  801301:	53                   	push   %ebx
+  801302:	83 ec 0c             	sub    $0xc,%esp
+  801305:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80130c:	78 2b                	js     801339 <sys_env_set_rdpmc+0x3d>
+  80130e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801315:	75 37                	jne    80134e <sys_env_set_rdpmc+0x52>
+  801317:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131c:	b8 13 00 00 00       	mov    $0x13,%eax
+  801321:	8b 55 08             	mov    0x8(%ebp),%edx
+  801324:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801327:	89 df                	mov    %ebx,%edi
+  801329:	89 de                	mov    %ebx,%esi
+  80132b:	cd 30                	int    $0x30
+  80132d:	85 c0                	test   %eax,%eax
+  80132f:	7f 41                	jg     801372 <sys_env_set_rdpmc+0x76>
+  801331:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801334:	5b                   	pop    %ebx
+  801335:	5e                   	pop    %esi
+  801336:	5f                   	pop    %edi
+  801337:	5d                   	pop    %ebp
+  801338:	c3                   	ret
+  801339:	b8 01 00 00 00       	mov    $0x1,%eax
+  80133e:	0f a2                	cpuid
+  801340:	c1 ea 0b             	shr    $0xb,%edx
+  801343:	83 e2 01             	and    $0x1,%edx
+  801346:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80134c:	eb c0                	jmp    80130e <sys_env_set_rdpmc+0x12>
+  80134e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801353:	8b 55 08             	mov    0x8(%ebp),%edx
+  801356:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801359:	b8 13 00 00 00       	mov    $0x13,%eax
+  80135e:	89 df                	mov    %ebx,%edi
+  801360:	89 de                	mov    %ebx,%esi
+  801362:	55                   	push   %ebp
+  801363:	68 6c 13 80 00       	push   $0x80136c
+  801368:	89 e5                	mov    %esp,%ebp
+  80136a:	0f 34                	sysenter
+  80136c:	83 c4 04             	add    $0x4,%esp
+  80136f:	5d                   	pop    %ebp
+  801370:	eb bb                	jmp    80132d <sys_env_set_rdpmc+0x31>
+  801372:	83 ec 0c             	sub    $0xc,%esp
+  801375:	50                   	push   %eax
+  801376:	6a 13                	push   $0x13
+  801378:	68 c4 1d 80 00       	push   $0x801dc4
+  80137d:	6a 49                	push   $0x49
+  80137f:	68 e1 1d 80 00       	push   $0x801de1
+  801384:	e8 e0 04 00 00       	call   801869 <_panic>
+
+00801389 <sys_ring_setup>:
+  801389:	55                   	push   %ebp
+  80138a:	89 e5                	mov    %esp,%ebp
+  80138c:	57                   	push   %edi
+  80138d:	56                   	push   %esi
+  80138e:	53                   	push   %ebx
+  80138f:	83 ec 0c             	sub    $0xc,%esp
+  801392:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801399:	78 29                	js     8013c4 <sys_ring_setup+0x3b>
+  80139b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8013a2:	75 35                	jne    8013d9 <sys_ring_setup+0x50>
+  8013a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a9:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013ae:	89 d1                	mov    %edx,%ecx
+  8013b0:	89 d3                	mov    %edx,%ebx
+  8013b2:	89 d7                	mov    %edx,%edi
+  8013b4:	89 d6                	mov    %edx,%esi
+  8013b6:	cd 30                	int    $0x30
+  8013b8:	85 c0                	test   %eax,%eax
+  8013ba:	7f 3f                	jg     8013fb <sys_ring_setup+0x72>
+  8013bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013bf:	5b                   	pop    %ebx
+  8013c0:	5e                   	pop    %esi
+  8013c1:	5f                   	pop    %edi
+  8013c2:	5d                   	pop    %ebp
+  8013c3:	c3                   	ret
+  8013c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013c9:	0f a2                	cpuid
+  8013cb:	c1 ea 0b             	shr    $0xb,%edx
+  8013ce:	83 e2 01             	and    $0x1,%edx
+  8013d1:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8013d7:	eb c2                	jmp    80139b <sys_ring_setup+0x12>
+  8013d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013de:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013e3:	89 d1                	mov    %edx,%ecx
+  8013e5:	89 d3                	mov    %edx,%ebx
+  8013e7:	89 d7                	mov    %edx,%edi
+  8013e9:	89 d6                	mov    %edx,%esi
+  8013eb:	55                   	push   %ebp
+  8013ec:	68 f5 13 80 00       	push   $0x8013f5
+  8013f1:	89 e5                	mov    %esp,%ebp
+  8013f3:	0f 34                	sysenter
+  8013f5:	83 c4 04             	add    $0x4,%esp
+  8013f8:	5d                   	pop    %ebp
+  8013f9:	eb bd                	jmp    8013b8 <sys_ring_setup+0x2f>
+  8013fb:	83 ec 0c             	sub    $0xc,%esp
+  8013fe:	50                   	push   %eax
+  8013ff:	6a 10                	push   $0x10
+  801401:	68 c4 1d 80 00       	push   $0x801dc4
+  801406:	6a 49                	push   $0x49
+  801408:	68 e1 1d 80 00       	push   $0x801de1
+  80140d:	e8 57 04 00 00       	call   801869 <_panic>
+
+00801412 <sys_ring_enter>:
+  801412:	55                   	push   %ebp
+  801413:	89 e5                	mov    %esp,%ebp
+  801415:	57                   	push   %edi
+  801416:	56                   	push   %esi
+  801417:	53                   	push   %ebx
+  801418:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80141f:	78 22                	js     801443 <sys_ring_enter+0x31>
+  801421:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801428:	75 2e                	jne    801458 <sys_ring_enter+0x46>
+  80142a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80142f:	b8 11 00 00 00       	mov    $0x11,%eax
+  801434:	89 d1                	mov    %edx,%ecx
+  801436:	89 d3                	mov    %edx,%ebx
+  801438:	89 d7                	mov    %edx,%edi
+  80143a:	89 d6                	mov    %edx,%esi
+  80143c:	cd 30                	int    $0x30
+  80143e:	5b                   	pop    %ebx
+  80143f:	5e                   	pop    %esi
+  801440:	5f                   	pop    %edi
+  801441:	5d                   	pop    %ebp
+  801442:	c3                   	ret
+  801443:	b8 01 00 00 00       	mov    $0x1,%eax
+  801448:	0f a2                	cpuid
+  80144a:	c1 ea 0b             	shr    $0xb,%edx
+  80144d:	83 e2 01             	and    $0x1,%edx
+  801450:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801456:	eb c9                	jmp    801421 <sys_ring_enter+0xf>
+  801458:	ba 00 00 00 00       	mov    $0x0,%edx
+  80145d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801462:	89 d1                	mov    %edx,%ecx
+  801464:	89 d3                	mov    %edx,%ebx
+  801466:	89 d7                	mov    %edx,%edi
+  801468:	89 d6                	mov    %edx,%esi
+  80146a:	55                   	push   %ebp
+  80146b:	68 74 14 80 00       	push   $0x801474
+  801470:	89 e5                	mov    %esp,%ebp
+  801472:	0f 34                	sysenter
+  801474:	83 c4 04             	add    $0x4,%esp
+  801477:	5d                   	pop    %ebp
+  801478:	eb c4                	jmp    80143e <sys_ring_enter+0x2c>
+
+0080147a <sys_ipc_try_send>:
+  80147a:	55                   	push   %ebp
+  80147b:	89 e5                	mov    %esp,%ebp
+  80147d:	57                   	push   %edi
+  80147e:	56                   	push   %esi
+  80147f:	53                   	push   %ebx
+  801480:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801487:	78 26                	js     8014af <sys_ipc_try_send+0x35>
+  801489:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801490:	75 32                	jne    8014c4 <sys_ipc_try_send+0x4a>
+  801492:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801497:	be 00 00 00 00       	mov    $0x0,%esi
+  80149c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014a5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014a8:	cd 30                	int    $0x30
+  8014aa:	5b                   	pop    %ebx
+  8014ab:	5e                   	pop    %esi
+  8014ac:	5f                   	pop    %edi
+  8014ad:	5d                   	pop    %ebp
+  8014ae:	c3                   	ret
+  8014af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014b4:	0f a2                	cpuid
+  8014b6:	c1 ea 0b             	shr    $0xb,%edx
+  8014b9:	83 e2 01             	and    $0x1,%edx
+  8014bc:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8014c2:	eb c5                	jmp    801489 <sys_ipc_try_send+0xf>
+  8014c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ca:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014da:	55                   	push   %ebp
+  8014db:	68 e4 14 80 00       	push   $0x8014e4
+  8014e0:	89 e5                	mov    %esp,%ebp
+  8014e2:	0f 34                	sysenter
+  8014e4:	83 c4 04             	add    $0x4,%esp
+  8014e7:	5d                   	pop    %ebp
+  8014e8:	eb c0                	jmp    8014aa <sys_ipc_try_send+0x30>
+
+008014ea <sys_ipc_recv>:
+  8014ea:	55                   	push   %ebp
+  8014eb:	89 e5                	mov    %esp,%ebp
+  8014ed:	57                   	push   %edi
+  8014ee:	56                   	push   %esi
+  8014ef:	53                   	push   %ebx
+  8014f0:	83 ec 0c             	sub    $0xc,%esp
+  8014f3:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014fa:	78 2a                	js     801526 <sys_ipc_recv+0x3c>
+  8014fc:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801503:	75 36                	jne    80153b <sys_ipc_recv+0x51>
+  801505:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80150a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80150f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801512:	89 cb                	mov    %ecx,%ebx
+  801514:	89 cf                	mov    %ecx,%edi
+  801516:	89 ce                	mov    %ecx,%esi
+  801518:	cd 30                	int    $0x30
+  80151a:	85 c0                	test   %eax,%eax
+  80151c:	7f 40                	jg     80155e <sys_ipc_recv+0x74>
+  80151e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801521:	5b                   	pop    %ebx
+  801522:	5e                   	pop    %esi
+  801523:	5f                   	pop    %edi
+  801524:	5d                   	pop    %ebp
+  801525:	c3                   	ret
+  801526:	b8 01 00 00 00       	mov    $0x1,%eax
+  80152b:	0f a2                	cpuid
+  80152d:	c1 ea 0b             	shr    $0xb,%edx
+  801530:	83 e2 01             	and    $0x1,%edx
+  801533:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801539:	eb c1                	jmp    8014fc <sys_ipc_recv+0x12>
+  80153b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801543:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801548:	89 cb                	mov    %ecx,%ebx
+  80154a:	89 cf                	mov    %ecx,%edi
+  80154c:	89 ce                	mov    %ecx,%esi
+  80154e:	55                   	push   %ebp
+  80154f:	68 58 15 80 00       	push   $0x801558
+  801554:	89 e5                	mov    %esp,%ebp
+  801556:	0f 34                	sysenter
+  801558:	83 c4 04             	add    $0x4,%esp
+  80155b:	5d                   	pop    %ebp
+  80155c:	eb bc                	jmp    80151a <sys_ipc_recv+0x30>
+  80155e:	83 ec 0c             	sub    $0xc,%esp
+  801561:	50                   	push   %eax
+  801562:	6a 0c                	push   $0xc
+  801564:	68 c4 1d 80 00       	push   $0x801dc4
+  801569:	6a 49                	push   $0x49
+  80156b:	68 e1 1d 80 00       	push   $0x801de1
+  801570:	e8 f4 02 00 00       	call   801869 <_panic>
+
+00801575 <ipc_recv>:
+  801575:	55                   	push   %ebp
+  801576:	89 e5                	mov    %esp,%ebp
+  801578:	56                   	push   %esi
+  801579:	53                   	push   %ebx
+  80157a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80157d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801580:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801583:	85 c0                	test   %eax,%eax
+  801585:	74 41                	je     8015c8 <ipc_recv+0x53>
+  801587:	83 ec 0c             	sub    $0xc,%esp
+  80158a:	50                   	push   %eax
+  80158b:	e8 5a ff ff ff       	call   8014ea <sys_ipc_recv>
+  801590:	83 c4 10             	add    $0x10,%esp
+  801593:	85 f6                	test   %esi,%esi
+  801595:	74 17                	je     8015ae <ipc_recv+0x39>
+  801597:	ba 00 00 00 00       	mov    $0x0,%edx
+  80159c:	85 c0                	test   %eax,%eax
+  80159e:	75 0c                	jne    8015ac <ipc_recv+0x37>
+  8015a0:	8b 15 20 20 80 00    	mov    0x802020,%edx
+  8015a6:	8b 92 0c 01 00 00    	mov    0x10c(%edx),%edx
+  8015ac:	89 16                	mov    %edx,(%esi)
+  8015ae:	85 db                	test   %ebx,%ebx
+  8015b0:	74 42                	je     8015f4 <ipc_recv+0x7f>
+  8015b2:	85 c0                	test   %eax,%eax
+  8015b4:	74 24                	je     8015da <ipc_recv+0x65>
+  8015b6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8015bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015c4:	5b                   	pop    %ebx
+  8015c5:	5e                   	pop    %esi
+  8015c6:	5d                   	pop    %ebp
+  8015c7:	c3                   	ret
+  8015c8:	83 ec 0c             	sub    $0xc,%esp
+  8015cb:	68 01 00 00 eb       	push   $0xeb000001
+  8015d0:	e8 15 ff ff ff       	call   8014ea <sys_ipc_recv>
+  8015d5:	83 c4 10             	add    $0x10,%esp
+  8015d8:	eb b9                	jmp    801593 <ipc_recv+0x1e>
+  8015da:	a1 20 20 80 00       	mov    0x802020,%eax
+  8015df:	8b 80 10 01 00 00    	mov    0x110(%eax),%eax
+  8015e5:	89 03                	mov    %eax,(%ebx)
+  8015e7:	a1 20 20 80 00       	mov    0x802020,%eax
+  8015ec:	8b 80 08 01 00 00    	mov    0x108(%eax),%eax
+  8015f2:	eb cd                	jmp    8015c1 <ipc_recv+0x4c>
+  8015f4:	85 c0                	test   %eax,%eax
+  8015f6:	74 ef                	je     8015e7 <ipc_recv+0x72>
+  8015f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fd:	eb c2                	jmp    8015c1 <ipc_recv+0x4c>
+
+008015ff <ipc_send>:
+  8015ff:	55                   	push   %ebp
+  801600:	89 e5                	mov    %esp,%ebp
+  801602:	57                   	push   %edi
+  801603:	56                   	push   %esi
+  801604:	53                   	push   %ebx
+  801605:	83 ec 0c             	sub    $0xc,%esp
+  801608:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80160b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80160e:	eb 21                	jmp    801631 <ipc_send+0x32>
+  801610:	ff 75 14             	push   0x14(%ebp)
+  801613:	68 01 00 00 eb       	push   $0xeb000001
+  801618:	ff 75 0c             	push   0xc(%ebp)
+  80161b:	57                   	push   %edi
+  80161c:	e8 59 fe ff ff       	call   80147a <sys_ipc_try_send>
+  801621:	89 c3                	mov    %eax,%ebx
+  801623:	83 c4 10             	add    $0x10,%esp
+  801626:	eb 1f                	jmp    801647 <ipc_send+0x48>
+  801628:	83 fb f9             	cmp    $0xfffffff9,%ebx
+  80162b:	74 37                	je     801664 <ipc_send+0x65>
+  80162d:	85 db                	test   %ebx,%ebx
+  80162f:	74 3a                	je     80166b <ipc_send+0x6c>
+  801631:	85 f6                	test   %esi,%esi
+  801633:	74 db                	je     801610 <ipc_send+0x11>
+  801635:	ff 75 14             	push   0x14(%ebp)
+  801638:	56                   	push   %esi
+  801639:	ff 75 0c             	push   0xc(%ebp)
+  80163c:	57                   	push   %edi
+  80163d:	e8 38 fe ff ff       	call   80147a <sys_ipc_try_send>
+  801642:	89 c3                	mov    %eax,%ebx
+  801644:	83 c4 10             	add    $0x10,%esp
+  801647:	85 db                	test   %ebx,%ebx
+  801649:	74 dd                	je     801628 <ipc_send+0x29>
+  80164b:	83 fb f9             	cmp    $0xfffffff9,%ebx
+  80164e:	74 d8                	je     801628 <ipc_send+0x29>
+  801650:	83 ec 04             	sub    $0x4,%esp
+  801653:	68 ef 1d 80 00       	push   $0x801def
+  801658:	6a 40                	push   $0x40
+  80165a:	68 02 1e 80 00       	push   $0x801e02
+  80165f:	e8 05 02 00 00       	call   801869 <_panic>
+  801664:	e8 55 f7 ff ff       	call   800dbe <sys_yield>
+  801669:	eb c2                	jmp    80162d <ipc_send+0x2e>
+  80166b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80166e:	5b                   	pop    %ebx
+  80166f:	5e                   	pop    %esi
+  801670:	5f                   	pop    %edi
+  801671:	5d                   	pop    %ebp
+  801672:	c3                   	ret
+
+00801673 <ipc_find_env>:
+  801673:	55                   	push   %ebp
+  801674:	89 e5                	mov    %esp,%ebp
+  801676:	56                   	push   %esi
+  801677:	53                   	push   %ebx
+  801678:	8b 75 08             	mov    0x8(%ebp),%esi
+  80167b:	b9 7f 03 00 ed       	mov    $0xed00037f,%ecx
+  801680:	b8 00 00 00 00       	mov    $0x0,%eax
+  801685:	89 c3                	mov    %eax,%ebx
+  801687:	83 c0 01             	add    $0x1,%eax
+  80168a:	89 ca                	mov    %ecx,%edx
+  80168c:	c1 ea 0c             	shr    $0xc,%edx
+  80168f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801696:	f6 c2 01             	test   $0x1,%dl
+  801699:	74 35                	je     8016d0 <ipc_find_env+0x5d>
+  80169b:	69 d3 80 03 00 00    	imul   $0x380,%ebx,%edx
+  8016a1:	81 c2 00 00 00 ed    	add    $0xed000000,%edx
+  8016a7:	8b 52 48             	mov    0x48(%edx),%edx
+  8016aa:	81 c1 80 03 00 00    	add    $0x380,%ecx
+  8016b0:	39 f2                	cmp    %esi,%edx
+  8016b2:	74 0e                	je     8016c2 <ipc_find_env+0x4f>
+  8016b4:	3d 00 80 00 00       	cmp    $0x8000,%eax
+  8016b9:	75 ca                	jne    801685 <ipc_find_env+0x12>
+  8016bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c0:	eb 13                	jmp    8016d5 <ipc_find_env+0x62>
+  8016c2:	69 db 80 03 00 00    	imul   $0x380,%ebx,%ebx
+  8016c8:	8b 83 40 00 00 ed    	mov    -0x12ffffc0(%ebx),%eax
+  8016ce:	eb 05                	jmp    8016d5 <ipc_find_env+0x62>
+  8016d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d5:	5b                   	pop    %ebx
+  8016d6:	5e                   	pop    %esi
+  8016d7:	5d                   	pop    %ebp
+  8016d8:	c3                   	ret
+
+008016d9 <uinfo_envid>:
+  8016d9:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  8016de:	c3                   	ret
+
+008016df <uinfo_cpunum>:
+  8016df:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  8016e4:	c3                   	ret
+
+008016e5 <uinfo_ticks>:
+  8016e5:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  8016ea:	c3                   	ret
+
+008016eb <uinfo_nsec>:
+  8016eb:	55                   	push   %ebp
+  8016ec:	89 e5                	mov    %esp,%ebp
+  8016ee:	57                   	push   %edi
+  8016ef:	56                   	push   %esi
+  8016f0:	53                   	push   %ebx
+  8016f1:	83 ec 1c             	sub    $0x1c,%esp
+  8016f4:	0f 31                	rdtsc
+  8016f6:	89 c6                	mov    %eax,%esi
+  8016f8:	89 d7                	mov    %edx,%edi
+  8016fa:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801700:	b8 00 00 00 00       	mov    $0x0,%eax
+  801705:	ba 00 00 00 00       	mov    $0x0,%edx
+  80170a:	85 c9                	test   %ecx,%ecx
+  80170c:	74 5c                	je     80176a <uinfo_nsec+0x7f>
+  80170e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801713:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801716:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801719:	52                   	push   %edx
+  80171a:	51                   	push   %ecx
+  80171b:	57                   	push   %edi
+  80171c:	56                   	push   %esi
+  80171d:	e8 6a 02 00 00       	call   80198c <__umoddi3>
+  801722:	83 c4 10             	add    $0x10,%esp
+  801725:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  80172b:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801730:	f7 e3                	mul    %ebx
+  801732:	01 ca                	add    %ecx,%edx
+  801734:	ff 75 e4             	push   -0x1c(%ebp)
+  801737:	ff 75 e0             	push   -0x20(%ebp)
+  80173a:	52                   	push   %edx
+  80173b:	50                   	push   %eax
+  80173c:	e8 73 01 00 00       	call   8018b4 <__udivdi3>
+  801741:	83 c4 10             	add    $0x10,%esp
+  801744:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801747:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80174a:	ff 75 e4             	push   -0x1c(%ebp)
+  80174d:	ff 75 e0             	push   -0x20(%ebp)
+  801750:	57                   	push   %edi
+  801751:	56                   	push   %esi
+  801752:	e8 5d 01 00 00       	call   8018b4 <__udivdi3>
+  801757:	83 c4 10             	add    $0x10,%esp
+  80175a:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801760:	f7 e3                	mul    %ebx
+  801762:	01 ca                	add    %ecx,%edx
+  801764:	03 45 d8             	add    -0x28(%ebp),%eax
+  801767:	13 55 dc             	adc    -0x24(%ebp),%edx
+  80176a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80176d:	5b                   	pop    %ebx
+  80176e:	5e                   	pop    %esi
+  80176f:	5f                   	pop    %edi
+  801770:	5d                   	pop    %ebp
+  801771:	c3                   	ret
+
+00801772 <bflush>:
+  801772:	a1 40 20 80 00       	mov    0x802040,%eax
+  801777:	85 c0                	test   %eax,%eax
+  801779:	75 01                	jne    80177c <bflush+0xa>
+  80177b:	c3                   	ret
+  80177c:	55                   	push   %ebp
+  80177d:	89 e5                	mov    %esp,%ebp
+  80177f:	83 ec 10             	sub    $0x10,%esp
+  801782:	50                   	push   %eax
+  801783:	68 44 20 80 00       	push   $0x802044
+  801788:	e8 70 f4 ff ff       	call   800bfd <sys_cputs>
+  80178d:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  801794:	00 00 00 
+  801797:	83 c4 10             	add    $0x10,%esp
+  80179a:	c9                   	leave
+  80179b:	c3                   	ret
+
+0080179c <bputch>:
+  80179c:	55                   	push   %ebp
+  80179d:	89 e5                	mov    %esp,%ebp
+  80179f:	53                   	push   %ebx
+  8017a0:	83 ec 04             	sub    $0x4,%esp
+  8017a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8017a6:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  8017ac:	8d 42 01             	lea    0x1(%edx),%eax
+  8017af:	a3 40 20 80 00       	mov    %eax,0x802040
+  8017b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8017b7:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  8017bd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8017c2:	77 08                	ja     8017cc <bputch+0x30>
+  8017c4:	83 03 01             	addl   $0x1,(%ebx)
+  8017c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017ca:	c9                   	leave
+  8017cb:	c3                   	ret
+  8017cc:	e8 a1 ff ff ff       	call   801772 <bflush>
+  8017d1:	eb f1                	jmp    8017c4 <bputch+0x28>
+
+008017d3 <vbprintf>:
+  8017d3:	55                   	push   %ebp
+  8017d4:	89 e5                	mov    %esp,%ebp
+  8017d6:	83 ec 18             	sub    $0x18,%esp
+  8017d9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8017e0:	ff 75 0c             	push   0xc(%ebp)
+  8017e3:	ff 75 08             	push   0x8(%ebp)
+  8017e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017e9:	50                   	push   %eax
+  8017ea:	68 9c 17 80 00       	push   $0x80179c
+  8017ef:	e8 9c ea ff ff       	call   800290 <vprintfmt>
+  8017f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017f7:	c9                   	leave
+  8017f8:	c3                   	ret
+
+008017f9 <bprintf>:
+  8017f9:	55                   	push   %ebp
+  8017fa:	89 e5                	mov    %esp,%ebp
+  8017fc:	83 ec 10             	sub    $0x10,%esp
+  8017ff:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801802:	50                   	push   %eax
+  801803:	ff 75 08             	push   0x8(%ebp)
+  801806:	e8 c8 ff ff ff       	call   8017d3 <vbprintf>
+  80180b:	c9                   	leave
+  80180c:	c3                   	ret
+
+0080180d <bwrite>:
+  80180d:	55                   	push   %ebp
+  80180e:	89 e5                	mov    %esp,%ebp
+  801810:	53                   	push   %ebx
+  801811:	83 ec 04             	sub    $0x4,%esp
+  801814:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801817:	89 d8                	mov    %ebx,%eax
+  801819:	03 05 40 20 80 00    	add    0x802040,%eax
+  80181f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801824:	76 0d                	jbe    801833 <bwrite+0x26>
+  801826:	e8 47 ff ff ff       	call   801772 <bflush>
+  80182b:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801831:	77 25                	ja     801858 <bwrite+0x4b>
+  801833:	83 ec 04             	sub    $0x4,%esp
+  801836:	53                   	push   %ebx
+  801837:	ff 75 08             	push   0x8(%ebp)
+  80183a:	a1 40 20 80 00       	mov    0x802040,%eax
+  80183f:	05 44 20 80 00       	add    $0x802044,%eax
+  801844:	50                   	push   %eax
+  801845:	e8 b1 f1 ff ff       	call   8009fb <memcpy>
+  80184a:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  801850:	83 c4 10             	add    $0x10,%esp
+  801853:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801856:	c9                   	leave
+  801857:	c3                   	ret
+  801858:	83 ec 08             	sub    $0x8,%esp
+  80185b:	53                   	push   %ebx
+  80185c:	ff 75 08             	push   0x8(%ebp)
+  80185f:	e8 99 f3 ff ff       	call   800bfd <sys_cputs>
+  801864:	83 c4 10             	add    $0x10,%esp
+  801867:	eb ea                	jmp    801853 <bwrite+0x46>
+
+00801869 <_panic>:
+  801869:	55                   	push   %ebp
+  80186a:	89 e5                	mov    %esp,%ebp
+  80186c:	56                   	push   %esi
+  80186d:	53                   	push   %ebx
+  80186e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  801871:	e8 fc fe ff ff       	call   801772 <bflush>
+  801876:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  80187c:	e8 d5 f4 ff ff       	call   800d56 <sys_getenvid>
+  801881:	83 ec 0c             	sub    $0xc,%esp
+  801884:	ff 75 0c             	push   0xc(%ebp)
+  801887:	ff 75 08             	push   0x8(%ebp)
+  80188a:	56                   	push   %esi
+  80188b:	50                   	push   %eax
+  80188c:	68 0c 1e 80 00       	push   $0x801e0c
+  801891:	e8 03 e9 ff ff       	call   800199 <cprintf>
+  801896:	83 c4 18             	add    $0x18,%esp
+  801899:	53                   	push   %ebx
+  80189a:	ff 75 10             	push   0x10(%ebp)
+  80189d:	e8 a6 e8 ff ff       	call   800148 <vcprintf>
+  8018a2:	c7 04 24 4f 1b 80 00 	movl   $0x801b4f,(%esp)
+  8018a9:	e8 eb e8 ff ff       	call   800199 <cprintf>
+  8018ae:	83 c4 10             	add    $0x10,%esp
+  8018b1:	cc                   	int3
+  8018b2:	eb fd                	jmp    8018b1 <_panic+0x48>
+
+008018b4 <__udivdi3>:
+  8018b4:	57                   	push   %edi
+  8018b5:	56                   	push   %esi
+  8018b6:	53                   	push   %ebx
+  8018b7:	83 ec 20             	sub    $0x20,%esp
+  8018ba:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8018be:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8018c2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8018c6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8018ca:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8018ce:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8018d2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8018d6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8018da:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8018de:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8018e2:	89 d1                	mov    %edx,%ecx
+  8018e4:	09 c1                	or     %eax,%ecx
+  8018e6:	0f 84 91 00 00 00    	je     80197d <__udivdi3+0xc9>
+  8018ec:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8018f3:	00 
+  8018f4:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8018fb:	00 
+  8018fc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801901:	b8 00 00 00 00       	mov    $0x0,%eax
+  801906:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190b:	eb 08                	jmp    801915 <__udivdi3+0x61>
+  80190d:	83 e9 01             	sub    $0x1,%ecx
+  801910:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801913:	74 68                	je     80197d <__udivdi3+0xc9>
+  801915:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801919:	01 c0                	add    %eax,%eax
+  80191b:	89 c6                	mov    %eax,%esi
+  80191d:	89 d7                	mov    %edx,%edi
+  80191f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801923:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801927:	0f ad d0             	shrd   %cl,%edx,%eax
+  80192a:	d3 ea                	shr    %cl,%edx
+  80192c:	f6 c1 20             	test   $0x20,%cl
+  80192f:	74 04                	je     801935 <__udivdi3+0x81>
+  801931:	89 d0                	mov    %edx,%eax
+  801933:	31 d2                	xor    %edx,%edx
+  801935:	83 e0 01             	and    $0x1,%eax
+  801938:	89 04 24             	mov    %eax,(%esp)
+  80193b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801942:	00 
+  801943:	8b 04 24             	mov    (%esp),%eax
+  801946:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80194a:	09 f0                	or     %esi,%eax
+  80194c:	09 fa                	or     %edi,%edx
+  80194e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801952:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801956:	39 f0                	cmp    %esi,%eax
+  801958:	89 d3                	mov    %edx,%ebx
+  80195a:	19 fb                	sbb    %edi,%ebx
+  80195c:	72 af                	jb     80190d <__udivdi3+0x59>
+  80195e:	29 f0                	sub    %esi,%eax
+  801960:	19 fa                	sbb    %edi,%edx
+  801962:	89 cf                	mov    %ecx,%edi
+  801964:	c1 ef 05             	shr    $0x5,%edi
+  801967:	83 e7 01             	and    $0x1,%edi
+  80196a:	89 fe                	mov    %edi,%esi
+  80196c:	83 f6 01             	xor    $0x1,%esi
+  80196f:	d3 e6                	shl    %cl,%esi
+  801971:	d3 e7                	shl    %cl,%edi
+  801973:	09 74 24 18          	or     %esi,0x18(%esp)
+  801977:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80197b:	eb 90                	jmp    80190d <__udivdi3+0x59>
+  80197d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801981:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  801985:	83 c4 20             	add    $0x20,%esp
+  801988:	5b                   	pop    %ebx
+  801989:	5e                   	pop    %esi
+  80198a:	5f                   	pop    %edi
+  80198b:	c3                   	ret
+
+0080198c <__umoddi3>:
+  80198c:	55                   	push   %ebp
+  80198d:	57                   	push   %edi
+  80198e:	56                   	push   %esi
+  80198f:	53                   	push   %ebx
+  801990:	83 ec 1c             	sub    $0x1c,%esp
+  801993:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801997:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80199b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80199f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8019a3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8019a7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8019ab:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8019af:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8019b3:	89 d6                	mov    %edx,%esi
+  8019b5:	09 c6                	or     %eax,%esi
+  8019b7:	74 6c                	je     801a25 <__umoddi3+0x99>
+  8019b9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8019be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019c8:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  8019cc:	eb 0e                	jmp    8019dc <__umoddi3+0x50>
+  8019ce:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  8019d3:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8019d7:	83 fe ff             	cmp    $0xffffffff,%esi
+  8019da:	74 49                	je     801a25 <__umoddi3+0x99>
+  8019dc:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8019e0:	01 c0                	add    %eax,%eax
+  8019e2:	89 c3                	mov    %eax,%ebx
+  8019e4:	89 d6                	mov    %edx,%esi
+  8019e6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8019ea:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8019ee:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  8019f3:	0f ad d0             	shrd   %cl,%edx,%eax
+  8019f6:	d3 ea                	shr    %cl,%edx
+  8019f8:	f6 c1 20             	test   $0x20,%cl
+  8019fb:	74 04                	je     801a01 <__umoddi3+0x75>
+  8019fd:	89 d0                	mov    %edx,%eax
+  8019ff:	31 d2                	xor    %edx,%edx
+  801a01:	83 e0 01             	and    $0x1,%eax
+  801a04:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801a09:	89 ea                	mov    %ebp,%edx
+  801a0b:	09 d8                	or     %ebx,%eax
+  801a0d:	09 f2                	or     %esi,%edx
+  801a0f:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801a13:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801a17:	39 d8                	cmp    %ebx,%eax
+  801a19:	89 d1                	mov    %edx,%ecx
+  801a1b:	19 f1                	sbb    %esi,%ecx
+  801a1d:	72 af                	jb     8019ce <__umoddi3+0x42>
+  801a1f:	29 d8                	sub    %ebx,%eax
+  801a21:	19 f2                	sbb    %esi,%edx
+  801a23:	eb a9                	jmp    8019ce <__umoddi3+0x42>
+  801a25:	83 c4 1c             	add    $0x1c,%esp
+  801a28:	5b                   	pop    %ebx
+  801a29:	5e                   	pop    %esi
+  801a2a:	5f                   	pop    %edi
+  801a2b:	5d                   	pop    %ebp
+  801a2c:	c3                   	ret
+
+00801a2d <__divdi3>:
+  801a2d:	53                   	push   %ebx
+  801a2e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801a32:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801a36:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801a3a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801a3e:	85 d2                	test   %edx,%edx
+  801a40:	78 12                	js     801a54 <__divdi3+0x27>
+  801a42:	85 db                	test   %ebx,%ebx
+  801a44:	78 2e                	js     801a74 <__divdi3+0x47>
+  801a46:	53                   	push   %ebx
+  801a47:	51                   	push   %ecx
+  801a48:	52                   	push   %edx
+  801a49:	50                   	push   %eax
+  801a4a:	e8 65 fe ff ff       	call   8018b4 <__udivdi3>
+  801a4f:	83 c4 10             	add    $0x10,%esp
+  801a52:	eb 1e                	jmp    801a72 <__divdi3+0x45>
+  801a54:	f7 d8                	neg    %eax
+  801a56:	83 d2 00             	adc    $0x0,%edx
+  801a59:	f7 da                	neg    %edx
+  801a5b:	85 db                	test   %ebx,%ebx
+  801a5d:	78 2a                	js     801a89 <__divdi3+0x5c>
+  801a5f:	53                   	push   %ebx
+  801a60:	51                   	push   %ecx
+  801a61:	52                   	push   %edx
+  801a62:	50                   	push   %eax
+  801a63:	e8 4c fe ff ff       	call   8018b4 <__udivdi3>
+  801a68:	83 c4 10             	add    $0x10,%esp
+  801a6b:	f7 d8                	neg    %eax
+  801a6d:	83 d2 00             	adc    $0x0,%edx
+  801a70:	f7 da                	neg    %edx
+  801a72:	5b                   	pop    %ebx
+  801a73:	c3                   	ret
+  801a74:	f7 d9                	neg    %ecx
+  801a76:	83 d3 00             	adc    $0x0,%ebx
+  801a79:	f7 db                	neg    %ebx
+  801a7b:	53                   	push   %ebx
+  801a7c:	51                   	push   %ecx
+  801a7d:	52                   	push   %edx
+  801a7e:	50                   	push   %eax
+  801a7f:	e8 30 fe ff ff       	call   8018b4 <__udivdi3>
+  801a84:	83 c4 10             	add    $0x10,%esp
+  801a87:	eb e2                	jmp    801a6b <__divdi3+0x3e>
+  801a89:	f7 d9                	neg    %ecx
+  801a8b:	83 d3 00             	adc    $0x0,%ebx
+  801a8e:	f7 db                	neg    %ebx
+  801a90:	53                   	push   %ebx
+  801a91:	51                   	push   %ecx
+  801a92:	52                   	push   %edx
+  801a93:	50                   	push   %eax
+  801a94:	e8 1b fe ff ff       	call   8018b4 <__udivdi3>
+  801a99:	83 c4 10             	add    $0x10,%esp
+  801a9c:	eb d4                	jmp    801a72 <__divdi3+0x45>
+
+00801a9e <__moddi3>:
+  801a9e:	55                   	push   %ebp
+  801a9f:	57                   	push   %edi
+  801aa0:	56                   	push   %esi
+  801aa1:	53                   	push   %ebx
+  801aa2:	83 ec 14             	sub    $0x14,%esp
+  801aa5:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801aa9:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801aad:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801ab1:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801ab5:	85 ed                	test   %ebp,%ebp
+  801ab7:	78 2b                	js     801ae4 <__moddi3+0x46>
+  801ab9:	89 c6                	mov    %eax,%esi
+  801abb:	f7 de                	neg    %esi
+  801abd:	89 34 24             	mov    %esi,(%esp)
+  801ac0:	89 d6                	mov    %edx,%esi
+  801ac2:	83 d6 00             	adc    $0x0,%esi
+  801ac5:	f7 de                	neg    %esi
+  801ac7:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801acb:	8b 34 24             	mov    (%esp),%esi
+  801ace:	0f 48 f0             	cmovs  %eax,%esi
+  801ad1:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801ad6:	52                   	push   %edx
+  801ad7:	56                   	push   %esi
+  801ad8:	55                   	push   %ebp
+  801ad9:	57                   	push   %edi
+  801ada:	e8 ad fe ff ff       	call   80198c <__umoddi3>
+  801adf:	83 c4 10             	add    $0x10,%esp
+  801ae2:	eb 3c                	jmp    801b20 <__moddi3+0x82>
+  801ae4:	89 c3                	mov    %eax,%ebx
+  801ae6:	f7 db                	neg    %ebx
+  801ae8:	89 d1                	mov    %edx,%ecx
+  801aea:	83 d1 00             	adc    $0x0,%ecx
+  801aed:	f7 d9                	neg    %ecx
+  801aef:	0f 49 c3             	cmovns %ebx,%eax
+  801af2:	89 04 24             	mov    %eax,(%esp)
+  801af5:	0f 49 d1             	cmovns %ecx,%edx
+  801af8:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801afc:	ff 74 24 04          	push   0x4(%esp)
+  801b00:	ff 74 24 04          	push   0x4(%esp)
+  801b04:	89 f8                	mov    %edi,%eax
+  801b06:	89 ea                	mov    %ebp,%edx
+  801b08:	f7 d8                	neg    %eax
+  801b0a:	83 d2 00             	adc    $0x0,%edx
+  801b0d:	f7 da                	neg    %edx
+  801b0f:	52                   	push   %edx
+  801b10:	50                   	push   %eax
+  801b11:	e8 76 fe ff ff       	call   80198c <__umoddi3>
+  801b16:	83 c4 10             	add    $0x10,%esp
+  801b19:	f7 d8                	neg    %eax
+  801b1b:	83 d2 00             	adc    $0x0,%edx
+  801b1e:	f7 da                	neg    %edx
+  801b20:	83 c4 14             	add    $0x14,%esp
+  801b23:	5b                   	pop    %ebx
+  801b24:	5e                   	pop    %esi
+  801b25:	5f                   	pop    %edi
+  801b26:	5d                   	pop    %ebp
+  801b27:	c3                   	ret
@@ -0,0 +1,2672 @@
+
+obj/user/faultalloc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 99 00 00 00       	call   8000ca <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+  80003f:	53                   	push   %ebx
+  800040:	68 a0 1a 80 00       	push   $0x801aa0
+  800045:	e8 c3 01 00 00       	call   80020d <cprintf>
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 56 0f 00 00       	call   800fb4 <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+  800065:	53                   	push   %ebx
+  800066:	68 ec 1a 80 00       	push   $0x801aec
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 33 07 00 00       	call   8007a6 <snprintf>
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 c0 1a 80 00       	push   $0x801ac0
+  800085:	6a 0e                	push   $0xe
+  800087:	68 aa 1a 80 00       	push   $0x801aaa
+  80008c:	e8 9c 00 00 00       	call   80012d <_panic>
+
+00800091 <umain>:
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 48 15 00 00       	call   8015e9 <set_pgfault_handler>
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	68 ef be ad de       	push   $0xdeadbeef
+  8000a9:	68 bc 1a 80 00       	push   $0x801abc
+  8000ae:	e8 5a 01 00 00       	call   80020d <cprintf>
+  8000b3:	83 c4 08             	add    $0x8,%esp
+  8000b6:	68 fe bf fe ca       	push   $0xcafebffe
+  8000bb:	68 bc 1a 80 00       	push   $0x801abc
+  8000c0:	e8 48 01 00 00       	call   80020d <cprintf>
+  8000c5:	83 c4 10             	add    $0x10,%esp
+  8000c8:	c9                   	leave
+  8000c9:	c3                   	ret
+
+008000ca <libmain>:
+  8000ca:	55                   	push   %ebp
+  8000cb:	89 e5                	mov    %esp,%ebp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000d5:	e8 a4 15 00 00       	call   80167e <uinfo_envid>
+  8000da:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8000df:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8000e5:	05 00 00 00 ed       	add    $0xed000000,%eax
+  8000ea:	a3 20 20 80 00       	mov    %eax,0x802020
+  8000ef:	85 db                	test   %ebx,%ebx
+  8000f1:	7e 07                	jle    8000fa <libmain+0x30>
+  8000f3:	8b 06                	mov    (%esi),%eax
+  8000f5:	a3 00 20 80 00       	mov    %eax,0x802000
+  8000fa:	83 ec 08             	sub    $0x8,%esp
+  8000fd:	56                   	push   %esi
+  8000fe:	53                   	push   %ebx
+  8000ff:	e8 8d ff ff ff       	call   800091 <umain>
+  800104:	e8 0a 00 00 00       	call   800113 <exit>
+  800109:	83 c4 10             	add    $0x10,%esp
+  80010c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80010f:	5b                   	pop    %ebx
+  800110:	5e                   	pop    %esi
+  800111:	5d                   	pop    %ebp
+  800112:	c3                   	ret
+
+00800113 <exit>:
+  800113:	55                   	push   %ebp
+  800114:	89 e5                	mov    %esp,%ebp
+  800116:	83 ec 08             	sub    $0x8,%esp
+  800119:	e8 f9 15 00 00       	call   801717 <bflush>
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	6a 00                	push   $0x0
+  800123:	e8 17 0c 00 00       	call   800d3f <sys_env_destroy>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	c9                   	leave
+  80012c:	c3                   	ret
+
+0080012d <_panic>:
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	56                   	push   %esi
+  800131:	53                   	push   %ebx
+  800132:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800135:	e8 dd 15 00 00       	call   801717 <bflush>
+  80013a:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  800140:	e8 85 0c 00 00       	call   800dca <sys_getenvid>
+  800145:	83 ec 0c             	sub    $0xc,%esp
+  800148:	ff 75 0c             	push   0xc(%ebp)
+  80014b:	ff 75 08             	push   0x8(%ebp)
+  80014e:	56                   	push   %esi
+  80014f:	50                   	push   %eax
+  800150:	68 18 1b 80 00       	push   $0x801b18
+  800155:	e8 b3 00 00 00       	call   80020d <cprintf>
+  80015a:	83 c4 18             	add    $0x18,%esp
+  80015d:	53                   	push   %ebx
+  80015e:	ff 75 10             	push   0x10(%ebp)
+  800161:	e8 56 00 00 00       	call   8001bc <vcprintf>
+  800166:	c7 04 24 be 1a 80 00 	movl   $0x801abe,(%esp)
+  80016d:	e8 9b 00 00 00       	call   80020d <cprintf>
+  800172:	83 c4 10             	add    $0x10,%esp
+  800175:	cc                   	int3
+  800176:	eb fd                	jmp    800175 <_panic+0x48>
+
+00800178 <putch>:
+  800178:	55                   	push   %ebp
+  800179:	89 e5                	mov    %esp,%ebp
+  80017b:	53                   	push   %ebx
+  80017c:	83 ec 04             	sub    $0x4,%esp
+  80017f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800182:	8b 13                	mov    (%ebx),%edx
+  800184:	8d 42 01             	lea    0x1(%edx),%eax
+  800187:	89 03                	mov    %eax,(%ebx)
+  800189:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80018c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800190:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800195:	74 09                	je     8001a0 <putch+0x28>
+  800197:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80019b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80019e:	c9                   	leave
+  80019f:	c3                   	ret
+  8001a0:	83 ec 08             	sub    $0x8,%esp
+  8001a3:	68 ff 00 00 00       	push   $0xff
+  8001a8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001ab:	50                   	push   %eax
+  8001ac:	e8 c0 0a 00 00       	call   800c71 <sys_cputs>
+  8001b1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001b7:	83 c4 10             	add    $0x10,%esp
+  8001ba:	eb db                	jmp    800197 <putch+0x1f>
+
+008001bc <vcprintf>:
+  8001bc:	55                   	push   %ebp
+  8001bd:	89 e5                	mov    %esp,%ebp
+  8001bf:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8001c5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001cc:	00 00 00 
+  8001cf:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001d6:	00 00 00 
+  8001d9:	ff 75 0c             	push   0xc(%ebp)
+  8001dc:	ff 75 08             	push   0x8(%ebp)
+  8001df:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001e5:	50                   	push   %eax
+  8001e6:	68 78 01 80 00       	push   $0x800178
+  8001eb:	e8 14 01 00 00       	call   800304 <vprintfmt>
+  8001f0:	83 c4 08             	add    $0x8,%esp
+  8001f3:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001f9:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ff:	50                   	push   %eax
+  800200:	e8 6c 0a 00 00       	call   800c71 <sys_cputs>
+  800205:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80020b:	c9                   	leave
+  80020c:	c3                   	ret
+
+0080020d <cprintf>:
+  80020d:	55                   	push   %ebp
+  80020e:	89 e5                	mov    %esp,%ebp
+  800210:	83 ec 10             	sub    $0x10,%esp
+  800213:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800216:	50                   	push   %eax
+  800217:	ff 75 08             	push   0x8(%ebp)
+  80021a:	e8 9d ff ff ff       	call   8001bc <vcprintf>
+  80021f:	c9                   	leave
+  800220:	c3                   	ret
+
+00800221 <printnum>:
+  800221:	55                   	push   %ebp
+  800222:	89 e5                	mov    %esp,%ebp
+  800224:	57                   	push   %edi
+  800225:	56                   	push   %esi
+  800226:	53                   	push   %ebx
+  800227:	83 ec 1c             	sub    $0x1c,%esp
+  80022a:	89 c7                	mov    %eax,%edi
+  80022c:	89 d6                	mov    %edx,%esi
+  80022e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800231:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800234:	89 d1                	mov    %edx,%ecx
+  800236:	89 c2                	mov    %eax,%edx
+  800238:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80023b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80023e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800241:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800244:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800247:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80024e:	39 c2                	cmp    %eax,%edx
+  800250:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800253:	72 3e                	jb     800293 <printnum+0x72>
+  800255:	83 ec 0c             	sub    $0xc,%esp
+  800258:	ff 75 18             	push   0x18(%ebp)
+  80025b:	83 eb 01             	sub    $0x1,%ebx
+  80025e:	53                   	push   %ebx
+  80025f:	50                   	push   %eax
+  800260:	83 ec 08             	sub    $0x8,%esp
+  800263:	ff 75 e4             	push   -0x1c(%ebp)
+  800266:	ff 75 e0             	push   -0x20(%ebp)
+  800269:	ff 75 dc             	push   -0x24(%ebp)
+  80026c:	ff 75 d8             	push   -0x28(%ebp)
+  80026f:	e8 9a 15 00 00       	call   80180e <__udivdi3>
+  800274:	83 c4 18             	add    $0x18,%esp
+  800277:	52                   	push   %edx
+  800278:	50                   	push   %eax
+  800279:	89 f2                	mov    %esi,%edx
+  80027b:	89 f8                	mov    %edi,%eax
+  80027d:	e8 9f ff ff ff       	call   800221 <printnum>
+  800282:	83 c4 20             	add    $0x20,%esp
+  800285:	eb 13                	jmp    80029a <printnum+0x79>
+  800287:	83 ec 08             	sub    $0x8,%esp
+  80028a:	56                   	push   %esi
+  80028b:	ff 75 18             	push   0x18(%ebp)
+  80028e:	ff d7                	call   *%edi
+  800290:	83 c4 10             	add    $0x10,%esp
+  800293:	83 eb 01             	sub    $0x1,%ebx
+  800296:	85 db                	test   %ebx,%ebx
+  800298:	7f ed                	jg     800287 <printnum+0x66>
+  80029a:	83 ec 08             	sub    $0x8,%esp
+  80029d:	56                   	push   %esi
+  80029e:	83 ec 04             	sub    $0x4,%esp
+  8002a1:	ff 75 e4             	push   -0x1c(%ebp)
+  8002a4:	ff 75 e0             	push   -0x20(%ebp)
+  8002a7:	ff 75 dc             	push   -0x24(%ebp)
+  8002aa:	ff 75 d8             	push   -0x28(%ebp)
+  8002ad:	e8 34 16 00 00       	call   8018e6 <__umoddi3>
+  8002b2:	83 c4 14             	add    $0x14,%esp
+  8002b5:	0f be 80 3b 1b 80 00 	movsbl 0x801b3b(%eax),%eax
+  8002bc:	50                   	push   %eax
+  8002bd:	ff d7                	call   *%edi
+  8002bf:	83 c4 10             	add    $0x10,%esp
+  8002c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c5:	5b                   	pop    %ebx
+  8002c6:	5e                   	pop    %esi
+  8002c7:	5f                   	pop    %edi
+  8002c8:	5d                   	pop    %ebp
+  8002c9:	c3                   	ret
+
+008002ca <sprintputch>:
+  8002ca:	55                   	push   %ebp
+  8002cb:	89 e5                	mov    %esp,%ebp
+  8002cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002d0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8002d4:	8b 10                	mov    (%eax),%edx
+  8002d6:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002d9:	73 0a                	jae    8002e5 <sprintputch+0x1b>
+  8002db:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002de:	89 08                	mov    %ecx,(%eax)
+  8002e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002e3:	88 02                	mov    %al,(%edx)
+  8002e5:	5d                   	pop    %ebp
+  8002e6:	c3                   	ret
+
+008002e7 <printfmt>:
+  8002e7:	55                   	push   %ebp
+  8002e8:	89 e5                	mov    %esp,%ebp
+  8002ea:	83 ec 08             	sub    $0x8,%esp
+  8002ed:	8d 45 14             	lea    0x14(%ebp),%eax
+  8002f0:	50                   	push   %eax
+  8002f1:	ff 75 10             	push   0x10(%ebp)
+  8002f4:	ff 75 0c             	push   0xc(%ebp)
+  8002f7:	ff 75 08             	push   0x8(%ebp)
+  8002fa:	e8 05 00 00 00       	call   800304 <vprintfmt>
+  8002ff:	83 c4 10             	add    $0x10,%esp
+  800302:	c9                   	leave
+  800303:	c3                   	ret
+
+00800304 <vprintfmt>:
+  800304:	55                   	push   %ebp
+  800305:	89 e5                	mov    %esp,%ebp
+  800307:	57                   	push   %edi
+  800308:	56                   	push   %esi
+  800309:	53                   	push   %ebx
+  80030a:	83 ec 2c             	sub    $0x2c,%esp
+  80030d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800310:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800313:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800316:	eb 0a                	jmp    800322 <vprintfmt+0x1e>
+  800318:	83 ec 08             	sub    $0x8,%esp
+  80031b:	53                   	push   %ebx
+  80031c:	50                   	push   %eax
+  80031d:	ff d6                	call   *%esi
+  80031f:	83 c4 10             	add    $0x10,%esp
+  800322:	83 c7 01             	add    $0x1,%edi
+  800325:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800329:	83 f8 25             	cmp    $0x25,%eax
+  80032c:	74 0c                	je     80033a <vprintfmt+0x36>
+  80032e:	85 c0                	test   %eax,%eax
+  800330:	75 e6                	jne    800318 <vprintfmt+0x14>
+  800332:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800335:	5b                   	pop    %ebx
+  800336:	5e                   	pop    %esi
+  800337:	5f                   	pop    %edi
+  800338:	5d                   	pop    %ebp
+  800339:	c3                   	ret
+  80033a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  80033e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800345:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80034c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800353:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800358:	8d 47 01             	lea    0x1(%edi),%eax
+  80035b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80035e:	0f b6 17             	movzbl (%edi),%edx
+  800361:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800364:	3c 55                	cmp    $0x55,%al
+  800366:	0f 87 cf 03 00 00    	ja     80073b <vprintfmt+0x437>
+  80036c:	0f b6 c0             	movzbl %al,%eax
+  80036f:	ff 24 85 00 1c 80 00 	jmp    *0x801c00(,%eax,4)
+  800376:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800379:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80037d:	eb d9                	jmp    800358 <vprintfmt+0x54>
+  80037f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800382:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800386:	eb d0                	jmp    800358 <vprintfmt+0x54>
+  800388:	0f b6 d2             	movzbl %dl,%edx
+  80038b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80038e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800393:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800396:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800399:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  80039d:	0f be 17             	movsbl (%edi),%edx
+  8003a0:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003a3:	83 f9 09             	cmp    $0x9,%ecx
+  8003a6:	77 55                	ja     8003fd <vprintfmt+0xf9>
+  8003a8:	83 c7 01             	add    $0x1,%edi
+  8003ab:	eb e9                	jmp    800396 <vprintfmt+0x92>
+  8003ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b0:	8b 00                	mov    (%eax),%eax
+  8003b2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8003bb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8003be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003c1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003c5:	79 91                	jns    800358 <vprintfmt+0x54>
+  8003c7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003cd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003d4:	eb 82                	jmp    800358 <vprintfmt+0x54>
+  8003d6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003d9:	85 d2                	test   %edx,%edx
+  8003db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e0:	0f 49 c2             	cmovns %edx,%eax
+  8003e3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003e9:	e9 6a ff ff ff       	jmp    800358 <vprintfmt+0x54>
+  8003ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003f1:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8003f8:	e9 5b ff ff ff       	jmp    800358 <vprintfmt+0x54>
+  8003fd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800400:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800403:	eb bc                	jmp    8003c1 <vprintfmt+0xbd>
+  800405:	83 c1 01             	add    $0x1,%ecx
+  800408:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80040b:	e9 48 ff ff ff       	jmp    800358 <vprintfmt+0x54>
+  800410:	8b 45 14             	mov    0x14(%ebp),%eax
+  800413:	8d 78 04             	lea    0x4(%eax),%edi
+  800416:	83 ec 08             	sub    $0x8,%esp
+  800419:	53                   	push   %ebx
+  80041a:	ff 30                	push   (%eax)
+  80041c:	ff d6                	call   *%esi
+  80041e:	83 c4 10             	add    $0x10,%esp
+  800421:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800424:	e9 b1 02 00 00       	jmp    8006da <vprintfmt+0x3d6>
+  800429:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042c:	8d 78 04             	lea    0x4(%eax),%edi
+  80042f:	8b 10                	mov    (%eax),%edx
+  800431:	89 d0                	mov    %edx,%eax
+  800433:	f7 d8                	neg    %eax
+  800435:	0f 48 c2             	cmovs  %edx,%eax
+  800438:	83 f8 08             	cmp    $0x8,%eax
+  80043b:	7f 23                	jg     800460 <vprintfmt+0x15c>
+  80043d:	8b 14 85 60 1d 80 00 	mov    0x801d60(,%eax,4),%edx
+  800444:	85 d2                	test   %edx,%edx
+  800446:	74 18                	je     800460 <vprintfmt+0x15c>
+  800448:	52                   	push   %edx
+  800449:	68 5c 1b 80 00       	push   $0x801b5c
+  80044e:	53                   	push   %ebx
+  80044f:	56                   	push   %esi
+  800450:	e8 92 fe ff ff       	call   8002e7 <printfmt>
+  800455:	83 c4 10             	add    $0x10,%esp
+  800458:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80045b:	e9 7a 02 00 00       	jmp    8006da <vprintfmt+0x3d6>
+  800460:	50                   	push   %eax
+  800461:	68 53 1b 80 00       	push   $0x801b53
+  800466:	53                   	push   %ebx
+  800467:	56                   	push   %esi
+  800468:	e8 7a fe ff ff       	call   8002e7 <printfmt>
+  80046d:	83 c4 10             	add    $0x10,%esp
+  800470:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800473:	e9 62 02 00 00       	jmp    8006da <vprintfmt+0x3d6>
+  800478:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047b:	83 c0 04             	add    $0x4,%eax
+  80047e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800481:	8b 45 14             	mov    0x14(%ebp),%eax
+  800484:	8b 08                	mov    (%eax),%ecx
+  800486:	85 c9                	test   %ecx,%ecx
+  800488:	b8 4c 1b 80 00       	mov    $0x801b4c,%eax
+  80048d:	0f 45 c1             	cmovne %ecx,%eax
+  800490:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800493:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800497:	7e 06                	jle    80049f <vprintfmt+0x19b>
+  800499:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80049d:	75 0b                	jne    8004aa <vprintfmt+0x1a6>
+  80049f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004a2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004a5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004a8:	eb 5c                	jmp    800506 <vprintfmt+0x202>
+  8004aa:	83 ec 08             	sub    $0x8,%esp
+  8004ad:	ff 75 d0             	push   -0x30(%ebp)
+  8004b0:	ff 75 cc             	push   -0x34(%ebp)
+  8004b3:	e8 87 03 00 00       	call   80083f <strnlen>
+  8004b8:	89 c2                	mov    %eax,%edx
+  8004ba:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004bd:	29 d0                	sub    %edx,%eax
+  8004bf:	83 c4 10             	add    $0x10,%esp
+  8004c2:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004cc:	89 c6                	mov    %eax,%esi
+  8004ce:	eb 0e                	jmp    8004de <vprintfmt+0x1da>
+  8004d0:	83 ec 08             	sub    $0x8,%esp
+  8004d3:	53                   	push   %ebx
+  8004d4:	57                   	push   %edi
+  8004d5:	ff 55 08             	call   *0x8(%ebp)
+  8004d8:	83 ee 01             	sub    $0x1,%esi
+  8004db:	83 c4 10             	add    $0x10,%esp
+  8004de:	85 f6                	test   %esi,%esi
+  8004e0:	7f ee                	jg     8004d0 <vprintfmt+0x1cc>
+  8004e2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e8:	85 c0                	test   %eax,%eax
+  8004ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004ef:	0f 49 d0             	cmovns %eax,%edx
+  8004f2:	29 d0                	sub    %edx,%eax
+  8004f4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f7:	eb a6                	jmp    80049f <vprintfmt+0x19b>
+  8004f9:	83 ec 08             	sub    $0x8,%esp
+  8004fc:	53                   	push   %ebx
+  8004fd:	52                   	push   %edx
+  8004fe:	ff 55 08             	call   *0x8(%ebp)
+  800501:	83 c4 10             	add    $0x10,%esp
+  800504:	89 f1                	mov    %esi,%ecx
+  800506:	8d 71 01             	lea    0x1(%ecx),%esi
+  800509:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80050d:	0f be d0             	movsbl %al,%edx
+  800510:	85 d2                	test   %edx,%edx
+  800512:	74 28                	je     80053c <vprintfmt+0x238>
+  800514:	85 ff                	test   %edi,%edi
+  800516:	78 05                	js     80051d <vprintfmt+0x219>
+  800518:	83 ef 01             	sub    $0x1,%edi
+  80051b:	78 30                	js     80054d <vprintfmt+0x249>
+  80051d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800521:	74 d6                	je     8004f9 <vprintfmt+0x1f5>
+  800523:	0f be c0             	movsbl %al,%eax
+  800526:	83 e8 20             	sub    $0x20,%eax
+  800529:	83 f8 5e             	cmp    $0x5e,%eax
+  80052c:	76 cb                	jbe    8004f9 <vprintfmt+0x1f5>
+  80052e:	83 ec 08             	sub    $0x8,%esp
+  800531:	53                   	push   %ebx
+  800532:	6a 3f                	push   $0x3f
+  800534:	ff 55 08             	call   *0x8(%ebp)
+  800537:	83 c4 10             	add    $0x10,%esp
+  80053a:	eb c8                	jmp    800504 <vprintfmt+0x200>
+  80053c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800542:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800545:	01 d0                	add    %edx,%eax
+  800547:	29 c8                	sub    %ecx,%eax
+  800549:	89 c7                	mov    %eax,%edi
+  80054b:	eb 13                	jmp    800560 <vprintfmt+0x25c>
+  80054d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800550:	eb ed                	jmp    80053f <vprintfmt+0x23b>
+  800552:	83 ec 08             	sub    $0x8,%esp
+  800555:	53                   	push   %ebx
+  800556:	6a 20                	push   $0x20
+  800558:	ff d6                	call   *%esi
+  80055a:	83 ef 01             	sub    $0x1,%edi
+  80055d:	83 c4 10             	add    $0x10,%esp
+  800560:	85 ff                	test   %edi,%edi
+  800562:	7f ee                	jg     800552 <vprintfmt+0x24e>
+  800564:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800567:	89 45 14             	mov    %eax,0x14(%ebp)
+  80056a:	e9 6b 01 00 00       	jmp    8006da <vprintfmt+0x3d6>
+  80056f:	83 f9 01             	cmp    $0x1,%ecx
+  800572:	7f 1f                	jg     800593 <vprintfmt+0x28f>
+  800574:	85 c9                	test   %ecx,%ecx
+  800576:	74 67                	je     8005df <vprintfmt+0x2db>
+  800578:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057b:	8b 00                	mov    (%eax),%eax
+  80057d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800580:	89 c1                	mov    %eax,%ecx
+  800582:	c1 f9 1f             	sar    $0x1f,%ecx
+  800585:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800588:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058b:	8d 40 04             	lea    0x4(%eax),%eax
+  80058e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800591:	eb 17                	jmp    8005aa <vprintfmt+0x2a6>
+  800593:	8b 45 14             	mov    0x14(%ebp),%eax
+  800596:	8b 50 04             	mov    0x4(%eax),%edx
+  800599:	8b 00                	mov    (%eax),%eax
+  80059b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80059e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a4:	8d 40 08             	lea    0x8(%eax),%eax
+  8005a7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005aa:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ad:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005b0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005b5:	85 c9                	test   %ecx,%ecx
+  8005b7:	0f 89 03 01 00 00    	jns    8006c0 <vprintfmt+0x3bc>
+  8005bd:	83 ec 08             	sub    $0x8,%esp
+  8005c0:	53                   	push   %ebx
+  8005c1:	6a 2d                	push   $0x2d
+  8005c3:	ff d6                	call   *%esi
+  8005c5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005cb:	f7 da                	neg    %edx
+  8005cd:	83 d1 00             	adc    $0x0,%ecx
+  8005d0:	f7 d9                	neg    %ecx
+  8005d2:	83 c4 10             	add    $0x10,%esp
+  8005d5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005da:	e9 e1 00 00 00       	jmp    8006c0 <vprintfmt+0x3bc>
+  8005df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e2:	8b 00                	mov    (%eax),%eax
+  8005e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e7:	89 c1                	mov    %eax,%ecx
+  8005e9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005ec:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f8:	eb b0                	jmp    8005aa <vprintfmt+0x2a6>
+  8005fa:	83 f9 01             	cmp    $0x1,%ecx
+  8005fd:	7f 1e                	jg     80061d <vprintfmt+0x319>
+  8005ff:	85 c9                	test   %ecx,%ecx
+  800601:	74 32                	je     800635 <vprintfmt+0x331>
+  800603:	8b 45 14             	mov    0x14(%ebp),%eax
+  800606:	8b 10                	mov    (%eax),%edx
+  800608:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80060d:	8d 40 04             	lea    0x4(%eax),%eax
+  800610:	89 45 14             	mov    %eax,0x14(%ebp)
+  800613:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800618:	e9 a3 00 00 00       	jmp    8006c0 <vprintfmt+0x3bc>
+  80061d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800620:	8b 10                	mov    (%eax),%edx
+  800622:	8b 48 04             	mov    0x4(%eax),%ecx
+  800625:	8d 40 08             	lea    0x8(%eax),%eax
+  800628:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800630:	e9 8b 00 00 00       	jmp    8006c0 <vprintfmt+0x3bc>
+  800635:	8b 45 14             	mov    0x14(%ebp),%eax
+  800638:	8b 10                	mov    (%eax),%edx
+  80063a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80063f:	8d 40 04             	lea    0x4(%eax),%eax
+  800642:	89 45 14             	mov    %eax,0x14(%ebp)
+  800645:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80064a:	eb 74                	jmp    8006c0 <vprintfmt+0x3bc>
+  80064c:	83 f9 01             	cmp    $0x1,%ecx
+  80064f:	7f 1b                	jg     80066c <vprintfmt+0x368>
+  800651:	85 c9                	test   %ecx,%ecx
+  800653:	74 2c                	je     800681 <vprintfmt+0x37d>
+  800655:	8b 45 14             	mov    0x14(%ebp),%eax
+  800658:	8b 10                	mov    (%eax),%edx
+  80065a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065f:	8d 40 04             	lea    0x4(%eax),%eax
+  800662:	89 45 14             	mov    %eax,0x14(%ebp)
+  800665:	bf 08 00 00 00       	mov    $0x8,%edi
+  80066a:	eb 54                	jmp    8006c0 <vprintfmt+0x3bc>
+  80066c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066f:	8b 10                	mov    (%eax),%edx
+  800671:	8b 48 04             	mov    0x4(%eax),%ecx
+  800674:	8d 40 08             	lea    0x8(%eax),%eax
+  800677:	89 45 14             	mov    %eax,0x14(%ebp)
+  80067a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80067f:	eb 3f                	jmp    8006c0 <vprintfmt+0x3bc>
+  800681:	8b 45 14             	mov    0x14(%ebp),%eax
+  800684:	8b 10                	mov    (%eax),%edx
+  800686:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068b:	8d 40 04             	lea    0x4(%eax),%eax
+  80068e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800691:	bf 08 00 00 00       	mov    $0x8,%edi
+  800696:	eb 28                	jmp    8006c0 <vprintfmt+0x3bc>
+  800698:	83 ec 08             	sub    $0x8,%esp
+  80069b:	53                   	push   %ebx
+  80069c:	6a 30                	push   $0x30
+  80069e:	ff d6                	call   *%esi
+  8006a0:	83 c4 08             	add    $0x8,%esp
+  8006a3:	53                   	push   %ebx
+  8006a4:	6a 78                	push   $0x78
+  8006a6:	ff d6                	call   *%esi
+  8006a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ab:	8b 10                	mov    (%eax),%edx
+  8006ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b2:	83 c4 10             	add    $0x10,%esp
+  8006b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bb:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006c0:	83 ec 0c             	sub    $0xc,%esp
+  8006c3:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006c7:	50                   	push   %eax
+  8006c8:	ff 75 e0             	push   -0x20(%ebp)
+  8006cb:	57                   	push   %edi
+  8006cc:	51                   	push   %ecx
+  8006cd:	52                   	push   %edx
+  8006ce:	89 da                	mov    %ebx,%edx
+  8006d0:	89 f0                	mov    %esi,%eax
+  8006d2:	e8 4a fb ff ff       	call   800221 <printnum>
+  8006d7:	83 c4 20             	add    $0x20,%esp
+  8006da:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8006dd:	e9 40 fc ff ff       	jmp    800322 <vprintfmt+0x1e>
+  8006e2:	83 f9 01             	cmp    $0x1,%ecx
+  8006e5:	7f 1b                	jg     800702 <vprintfmt+0x3fe>
+  8006e7:	85 c9                	test   %ecx,%ecx
+  8006e9:	74 2c                	je     800717 <vprintfmt+0x413>
+  8006eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ee:	8b 10                	mov    (%eax),%edx
+  8006f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006fb:	bf 10 00 00 00       	mov    $0x10,%edi
+  800700:	eb be                	jmp    8006c0 <vprintfmt+0x3bc>
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8b 10                	mov    (%eax),%edx
+  800707:	8b 48 04             	mov    0x4(%eax),%ecx
+  80070a:	8d 40 08             	lea    0x8(%eax),%eax
+  80070d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800710:	bf 10 00 00 00       	mov    $0x10,%edi
+  800715:	eb a9                	jmp    8006c0 <vprintfmt+0x3bc>
+  800717:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071a:	8b 10                	mov    (%eax),%edx
+  80071c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800721:	8d 40 04             	lea    0x4(%eax),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+  800727:	bf 10 00 00 00       	mov    $0x10,%edi
+  80072c:	eb 92                	jmp    8006c0 <vprintfmt+0x3bc>
+  80072e:	83 ec 08             	sub    $0x8,%esp
+  800731:	53                   	push   %ebx
+  800732:	6a 25                	push   $0x25
+  800734:	ff d6                	call   *%esi
+  800736:	83 c4 10             	add    $0x10,%esp
+  800739:	eb 9f                	jmp    8006da <vprintfmt+0x3d6>
+  80073b:	83 ec 08             	sub    $0x8,%esp
+  80073e:	53                   	push   %ebx
+  80073f:	6a 25                	push   $0x25
+  800741:	ff d6                	call   *%esi
+  800743:	83 c4 10             	add    $0x10,%esp
+  800746:	89 f8                	mov    %edi,%eax
+  800748:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80074c:	74 05                	je     800753 <vprintfmt+0x44f>
+  80074e:	83 e8 01             	sub    $0x1,%eax
+  800751:	eb f5                	jmp    800748 <vprintfmt+0x444>
+  800753:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800756:	eb 82                	jmp    8006da <vprintfmt+0x3d6>
+
+00800758 <vsnprintf>:
+  800758:	55                   	push   %ebp
+  800759:	89 e5                	mov    %esp,%ebp
+  80075b:	83 ec 18             	sub    $0x18,%esp
+  80075e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800761:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800764:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800767:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80076b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80076e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800775:	85 c0                	test   %eax,%eax
+  800777:	74 26                	je     80079f <vsnprintf+0x47>
+  800779:	85 d2                	test   %edx,%edx
+  80077b:	7e 22                	jle    80079f <vsnprintf+0x47>
+  80077d:	ff 75 14             	push   0x14(%ebp)
+  800780:	ff 75 10             	push   0x10(%ebp)
+  800783:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800786:	50                   	push   %eax
+  800787:	68 ca 02 80 00       	push   $0x8002ca
+  80078c:	e8 73 fb ff ff       	call   800304 <vprintfmt>
+  800791:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800794:	c6 00 00             	movb   $0x0,(%eax)
+  800797:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80079a:	83 c4 10             	add    $0x10,%esp
+  80079d:	c9                   	leave
+  80079e:	c3                   	ret
+  80079f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007a4:	eb f7                	jmp    80079d <vsnprintf+0x45>
+
+008007a6 <snprintf>:
+  8007a6:	55                   	push   %ebp
+  8007a7:	89 e5                	mov    %esp,%ebp
+  8007a9:	83 ec 08             	sub    $0x8,%esp
+  8007ac:	8d 45 14             	lea    0x14(%ebp),%eax
+  8007af:	50                   	push   %eax
+  8007b0:	ff 75 10             	push   0x10(%ebp)
+  8007b3:	ff 75 0c             	push   0xc(%ebp)
+  8007b6:	ff 75 08             	push   0x8(%ebp)
+  8007b9:	e8 9a ff ff ff       	call   800758 <vsnprintf>
+  8007be:	c9                   	leave
+  8007bf:	c3                   	ret
+
+008007c0 <copy_fwd>:
+  8007c0:	55                   	push   %ebp
+  8007c1:	89 e5                	mov    %esp,%ebp
+  8007c3:	57                   	push   %edi
+  8007c4:	56                   	push   %esi
+  8007c5:	53                   	push   %ebx
+  8007c6:	89 c7                	mov    %eax,%edi
+  8007c8:	89 d6                	mov    %edx,%esi
+  8007ca:	89 c8                	mov    %ecx,%eax
+  8007cc:	83 f9 0f             	cmp    $0xf,%ecx
+  8007cf:	76 1c                	jbe    8007ed <copy_fwd+0x2d>
+  8007d1:	89 f9                	mov    %edi,%ecx
+  8007d3:	f7 d9                	neg    %ecx
+  8007d5:	89 cb                	mov    %ecx,%ebx
+  8007d7:	83 e3 03             	and    $0x3,%ebx
+  8007da:	29 d8                	sub    %ebx,%eax
+  8007dc:	89 c2                	mov    %eax,%edx
+  8007de:	c1 ea 02             	shr    $0x2,%edx
+  8007e1:	83 e0 03             	and    $0x3,%eax
+  8007e4:	89 d9                	mov    %ebx,%ecx
+  8007e6:	fc                   	cld
+  8007e7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8007e9:	89 d1                	mov    %edx,%ecx
+  8007eb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8007ed:	89 c1                	mov    %eax,%ecx
+  8007ef:	fc                   	cld
+  8007f0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8007f2:	5b                   	pop    %ebx
+  8007f3:	5e                   	pop    %esi
+  8007f4:	5f                   	pop    %edi
+  8007f5:	5d                   	pop    %ebp
+  8007f6:	c3                   	ret
+
+008007f7 <have_sse2>:
+  8007f7:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007fe:	78 06                	js     800806 <have_sse2+0xf>
+  800800:	a1 04 20 80 00       	mov    0x802004,%eax
+  800805:	c3                   	ret
+  800806:	55                   	push   %ebp
+  800807:	89 e5                	mov    %esp,%ebp
+  800809:	53                   	push   %ebx
+  80080a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80080f:	0f a2                	cpuid
+  800811:	c1 ea 1a             	shr    $0x1a,%edx
+  800814:	83 e2 01             	and    $0x1,%edx
+  800817:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80081d:	a1 04 20 80 00       	mov    0x802004,%eax
+  800822:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800825:	c9                   	leave
+  800826:	c3                   	ret
+
+00800827 <strlen>:
+  800827:	55                   	push   %ebp
+  800828:	89 e5                	mov    %esp,%ebp
+  80082a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80082d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800832:	eb 03                	jmp    800837 <strlen+0x10>
+  800834:	83 c0 01             	add    $0x1,%eax
+  800837:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80083b:	75 f7                	jne    800834 <strlen+0xd>
+  80083d:	5d                   	pop    %ebp
+  80083e:	c3                   	ret
+
+0080083f <strnlen>:
+  80083f:	55                   	push   %ebp
+  800840:	89 e5                	mov    %esp,%ebp
+  800842:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800845:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800848:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084d:	eb 03                	jmp    800852 <strnlen+0x13>
+  80084f:	83 c0 01             	add    $0x1,%eax
+  800852:	39 d0                	cmp    %edx,%eax
+  800854:	74 08                	je     80085e <strnlen+0x1f>
+  800856:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80085a:	75 f3                	jne    80084f <strnlen+0x10>
+  80085c:	89 c2                	mov    %eax,%edx
+  80085e:	89 d0                	mov    %edx,%eax
+  800860:	5d                   	pop    %ebp
+  800861:	c3                   	ret
+
+00800862 <strcpy>:
+  800862:	55                   	push   %ebp
+  800863:	89 e5                	mov    %esp,%ebp
+  800865:	53                   	push   %ebx
+  800866:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800869:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80086c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800871:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800875:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800878:	83 c0 01             	add    $0x1,%eax
+  80087b:	84 d2                	test   %dl,%dl
+  80087d:	75 f2                	jne    800871 <strcpy+0xf>
+  80087f:	89 c8                	mov    %ecx,%eax
+  800881:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800884:	c9                   	leave
+  800885:	c3                   	ret
+
+00800886 <strcat>:
+  800886:	55                   	push   %ebp
+  800887:	89 e5                	mov    %esp,%ebp
+  800889:	53                   	push   %ebx
+  80088a:	83 ec 10             	sub    $0x10,%esp
+  80088d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800890:	53                   	push   %ebx
+  800891:	e8 91 ff ff ff       	call   800827 <strlen>
+  800896:	83 c4 08             	add    $0x8,%esp
+  800899:	ff 75 0c             	push   0xc(%ebp)
+  80089c:	01 d8                	add    %ebx,%eax
+  80089e:	50                   	push   %eax
+  80089f:	e8 be ff ff ff       	call   800862 <strcpy>
+  8008a4:	89 d8                	mov    %ebx,%eax
+  8008a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a9:	c9                   	leave
+  8008aa:	c3                   	ret
+
+008008ab <strncpy>:
+  8008ab:	55                   	push   %ebp
+  8008ac:	89 e5                	mov    %esp,%ebp
+  8008ae:	56                   	push   %esi
+  8008af:	53                   	push   %ebx
+  8008b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008b6:	89 f3                	mov    %esi,%ebx
+  8008b8:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008bb:	89 f0                	mov    %esi,%eax
+  8008bd:	eb 0f                	jmp    8008ce <strncpy+0x23>
+  8008bf:	83 c0 01             	add    $0x1,%eax
+  8008c2:	0f b6 0a             	movzbl (%edx),%ecx
+  8008c5:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8008c8:	80 f9 01             	cmp    $0x1,%cl
+  8008cb:	83 da ff             	sbb    $0xffffffff,%edx
+  8008ce:	39 d8                	cmp    %ebx,%eax
+  8008d0:	75 ed                	jne    8008bf <strncpy+0x14>
+  8008d2:	89 f0                	mov    %esi,%eax
+  8008d4:	5b                   	pop    %ebx
+  8008d5:	5e                   	pop    %esi
+  8008d6:	5d                   	pop    %ebp
+  8008d7:	c3                   	ret
+
+008008d8 <strlcpy>:
+  8008d8:	55                   	push   %ebp
+  8008d9:	89 e5                	mov    %esp,%ebp
+  8008db:	56                   	push   %esi
+  8008dc:	53                   	push   %ebx
+  8008dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008e3:	8b 55 10             	mov    0x10(%ebp),%edx
+  8008e6:	89 f0                	mov    %esi,%eax
+  8008e8:	85 d2                	test   %edx,%edx
+  8008ea:	74 21                	je     80090d <strlcpy+0x35>
+  8008ec:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008f0:	89 f2                	mov    %esi,%edx
+  8008f2:	eb 09                	jmp    8008fd <strlcpy+0x25>
+  8008f4:	83 c1 01             	add    $0x1,%ecx
+  8008f7:	83 c2 01             	add    $0x1,%edx
+  8008fa:	88 5a ff             	mov    %bl,-0x1(%edx)
+  8008fd:	39 c2                	cmp    %eax,%edx
+  8008ff:	74 09                	je     80090a <strlcpy+0x32>
+  800901:	0f b6 19             	movzbl (%ecx),%ebx
+  800904:	84 db                	test   %bl,%bl
+  800906:	75 ec                	jne    8008f4 <strlcpy+0x1c>
+  800908:	89 d0                	mov    %edx,%eax
+  80090a:	c6 00 00             	movb   $0x0,(%eax)
+  80090d:	29 f0                	sub    %esi,%eax
+  80090f:	5b                   	pop    %ebx
+  800910:	5e                   	pop    %esi
+  800911:	5d                   	pop    %ebp
+  800912:	c3                   	ret
+
+00800913 <strcmp>:
+  800913:	55                   	push   %ebp
+  800914:	89 e5                	mov    %esp,%ebp
+  800916:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800919:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80091c:	eb 06                	jmp    800924 <strcmp+0x11>
+  80091e:	83 c1 01             	add    $0x1,%ecx
+  800921:	83 c2 01             	add    $0x1,%edx
+  800924:	0f b6 01             	movzbl (%ecx),%eax
+  800927:	84 c0                	test   %al,%al
+  800929:	74 04                	je     80092f <strcmp+0x1c>
+  80092b:	3a 02                	cmp    (%edx),%al
+  80092d:	74 ef                	je     80091e <strcmp+0xb>
+  80092f:	0f b6 c0             	movzbl %al,%eax
+  800932:	0f b6 12             	movzbl (%edx),%edx
+  800935:	29 d0                	sub    %edx,%eax
+  800937:	5d                   	pop    %ebp
+  800938:	c3                   	ret
+
+00800939 <strncmp>:
+  800939:	55                   	push   %ebp
+  80093a:	89 e5                	mov    %esp,%ebp
+  80093c:	53                   	push   %ebx
+  80093d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800940:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800943:	8b 55 10             	mov    0x10(%ebp),%edx
+  800946:	eb 09                	jmp    800951 <strncmp+0x18>
+  800948:	83 ea 01             	sub    $0x1,%edx
+  80094b:	83 c0 01             	add    $0x1,%eax
+  80094e:	83 c1 01             	add    $0x1,%ecx
+  800951:	85 d2                	test   %edx,%edx
+  800953:	74 18                	je     80096d <strncmp+0x34>
+  800955:	0f b6 18             	movzbl (%eax),%ebx
+  800958:	84 db                	test   %bl,%bl
+  80095a:	74 04                	je     800960 <strncmp+0x27>
+  80095c:	3a 19                	cmp    (%ecx),%bl
+  80095e:	74 e8                	je     800948 <strncmp+0xf>
+  800960:	0f b6 00             	movzbl (%eax),%eax
+  800963:	0f b6 11             	movzbl (%ecx),%edx
+  800966:	29 d0                	sub    %edx,%eax
+  800968:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80096b:	c9                   	leave
+  80096c:	c3                   	ret
+  80096d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800972:	eb f4                	jmp    800968 <strncmp+0x2f>
+
+00800974 <strchr>:
+  800974:	55                   	push   %ebp
+  800975:	89 e5                	mov    %esp,%ebp
+  800977:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80097e:	eb 03                	jmp    800983 <strchr+0xf>
+  800980:	83 c0 01             	add    $0x1,%eax
+  800983:	0f b6 10             	movzbl (%eax),%edx
+  800986:	84 d2                	test   %dl,%dl
+  800988:	74 06                	je     800990 <strchr+0x1c>
+  80098a:	38 ca                	cmp    %cl,%dl
+  80098c:	75 f2                	jne    800980 <strchr+0xc>
+  80098e:	eb 05                	jmp    800995 <strchr+0x21>
+  800990:	b8 00 00 00 00       	mov    $0x0,%eax
+  800995:	5d                   	pop    %ebp
+  800996:	c3                   	ret
+
+00800997 <strfind>:
+  800997:	55                   	push   %ebp
+  800998:	89 e5                	mov    %esp,%ebp
+  80099a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8009a1:	0f b6 10             	movzbl (%eax),%edx
+  8009a4:	38 ca                	cmp    %cl,%dl
+  8009a6:	74 09                	je     8009b1 <strfind+0x1a>
+  8009a8:	84 d2                	test   %dl,%dl
+  8009aa:	74 05                	je     8009b1 <strfind+0x1a>
+  8009ac:	83 c0 01             	add    $0x1,%eax
+  8009af:	eb f0                	jmp    8009a1 <strfind+0xa>
+  8009b1:	5d                   	pop    %ebp
+  8009b2:	c3                   	ret
+
+008009b3 <memset>:
+  8009b3:	55                   	push   %ebp
+  8009b4:	89 e5                	mov    %esp,%ebp
+  8009b6:	57                   	push   %edi
+  8009b7:	56                   	push   %esi
+  8009b8:	53                   	push   %ebx
+  8009b9:	83 ec 04             	sub    $0x4,%esp
+  8009bc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009bf:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009c2:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  8009c6:	89 f7                	mov    %esi,%edi
+  8009c8:	83 fa 0f             	cmp    $0xf,%edx
+  8009cb:	76 24                	jbe    8009f1 <memset+0x3e>
+  8009cd:	89 f1                	mov    %esi,%ecx
+  8009cf:	f7 d9                	neg    %ecx
+  8009d1:	83 e1 03             	and    $0x3,%ecx
+  8009d4:	29 ca                	sub    %ecx,%edx
+  8009d6:	89 d0                	mov    %edx,%eax
+  8009d8:	c1 e8 02             	shr    $0x2,%eax
+  8009db:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  8009de:	83 e2 03             	and    $0x3,%edx
+  8009e1:	89 d8                	mov    %ebx,%eax
+  8009e3:	fc                   	cld
+  8009e4:	f3 aa                	rep stos %al,%es:(%edi)
+  8009e6:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  8009ec:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  8009ef:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009f1:	89 d1                	mov    %edx,%ecx
+  8009f3:	89 d8                	mov    %ebx,%eax
+  8009f5:	fc                   	cld
+  8009f6:	f3 aa                	rep stos %al,%es:(%edi)
+  8009f8:	89 f0                	mov    %esi,%eax
+  8009fa:	83 c4 04             	add    $0x4,%esp
+  8009fd:	5b                   	pop    %ebx
+  8009fe:	5e                   	pop    %esi
+  8009ff:	5f                   	pop    %edi
+  800a00:	5d                   	pop    %ebp
+  800a01:	c3                   	ret
+
+00800a02 <memmove>:
+  800a02:	55                   	push   %ebp
+  800a03:	89 e5                	mov    %esp,%ebp
+  800a05:	57                   	push   %edi
+  800a06:	56                   	push   %esi
+  800a07:	53                   	push   %ebx
+  800a08:	83 ec 0c             	sub    $0xc,%esp
+  800a0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a11:	8b 45 10             	mov    0x10(%ebp),%eax
+  800a14:	85 c0                	test   %eax,%eax
+  800a16:	74 14                	je     800a2c <memmove+0x2a>
+  800a18:	39 da                	cmp    %ebx,%edx
+  800a1a:	73 07                	jae    800a23 <memmove+0x21>
+  800a1c:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  800a1f:	39 cb                	cmp    %ecx,%ebx
+  800a21:	72 13                	jb     800a36 <memmove+0x34>
+  800a23:	89 c1                	mov    %eax,%ecx
+  800a25:	89 d8                	mov    %ebx,%eax
+  800a27:	e8 94 fd ff ff       	call   8007c0 <copy_fwd>
+  800a2c:	89 d8                	mov    %ebx,%eax
+  800a2e:	83 c4 0c             	add    $0xc,%esp
+  800a31:	5b                   	pop    %ebx
+  800a32:	5e                   	pop    %esi
+  800a33:	5f                   	pop    %edi
+  800a34:	5d                   	pop    %ebp
+  800a35:	c3                   	ret
+  800a36:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800a39:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800a3c:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800a3f:	83 f8 0f             	cmp    $0xf,%eax
+  800a42:	76 23                	jbe    800a67 <memmove+0x65>
+  800a44:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800a47:	83 e1 03             	and    $0x3,%ecx
+  800a4a:	29 c8                	sub    %ecx,%eax
+  800a4c:	89 c2                	mov    %eax,%edx
+  800a4e:	c1 ea 02             	shr    $0x2,%edx
+  800a51:	83 e0 03             	and    $0x3,%eax
+  800a54:	fd                   	std
+  800a55:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a57:	83 ef 03             	sub    $0x3,%edi
+  800a5a:	83 ee 03             	sub    $0x3,%esi
+  800a5d:	89 d1                	mov    %edx,%ecx
+  800a5f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a61:	83 c7 03             	add    $0x3,%edi
+  800a64:	83 c6 03             	add    $0x3,%esi
+  800a67:	89 c1                	mov    %eax,%ecx
+  800a69:	fd                   	std
+  800a6a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a6c:	fc                   	cld
+  800a6d:	eb bd                	jmp    800a2c <memmove+0x2a>
+
+00800a6f <memcpy>:
+  800a6f:	55                   	push   %ebp
+  800a70:	89 e5                	mov    %esp,%ebp
+  800a72:	53                   	push   %ebx
+  800a73:	83 ec 04             	sub    $0x4,%esp
+  800a76:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a79:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a7f:	89 d8                	mov    %ebx,%eax
+  800a81:	e8 3a fd ff ff       	call   8007c0 <copy_fwd>
+  800a86:	89 d8                	mov    %ebx,%eax
+  800a88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a8b:	c9                   	leave
+  800a8c:	c3                   	ret
+
+00800a8d <page_copy>:
+  800a8d:	55                   	push   %ebp
+  800a8e:	89 e5                	mov    %esp,%ebp
+  800a90:	57                   	push   %edi
+  800a91:	56                   	push   %esi
+  800a92:	53                   	push   %ebx
+  800a93:	83 ec 0c             	sub    $0xc,%esp
+  800a96:	e8 5c fd ff ff       	call   8007f7 <have_sse2>
+  800a9b:	85 c0                	test   %eax,%eax
+  800a9d:	74 39                	je     800ad8 <page_copy+0x4b>
+  800a9f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aa2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800aa5:	be 00 01 00 00       	mov    $0x100,%esi
+  800aaa:	8b 03                	mov    (%ebx),%eax
+  800aac:	8b 53 04             	mov    0x4(%ebx),%edx
+  800aaf:	0f c3 01             	movnti %eax,(%ecx)
+  800ab2:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800ab6:	8b 43 08             	mov    0x8(%ebx),%eax
+  800ab9:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800abc:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800ac0:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800ac4:	83 c3 10             	add    $0x10,%ebx
+  800ac7:	83 c1 10             	add    $0x10,%ecx
+  800aca:	4e                   	dec    %esi
+  800acb:	75 dd                	jne    800aaa <page_copy+0x1d>
+  800acd:	0f ae f8             	sfence
+  800ad0:	83 c4 0c             	add    $0xc,%esp
+  800ad3:	5b                   	pop    %ebx
+  800ad4:	5e                   	pop    %esi
+  800ad5:	5f                   	pop    %edi
+  800ad6:	5d                   	pop    %ebp
+  800ad7:	c3                   	ret
+  800ad8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800adb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ade:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800ae3:	fc                   	cld
+  800ae4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ae6:	eb e8                	jmp    800ad0 <page_copy+0x43>
+
+00800ae8 <page_zero>:
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	57                   	push   %edi
+  800aec:	83 ec 04             	sub    $0x4,%esp
+  800aef:	e8 03 fd ff ff       	call   8007f7 <have_sse2>
+  800af4:	85 c0                	test   %eax,%eax
+  800af6:	74 3a                	je     800b32 <page_zero+0x4a>
+  800af8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afb:	ba 80 00 00 00       	mov    $0x80,%edx
+  800b00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b05:	0f c3 08             	movnti %ecx,(%eax)
+  800b08:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800b0c:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800b10:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800b14:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800b18:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800b1c:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800b20:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800b24:	83 c0 20             	add    $0x20,%eax
+  800b27:	4a                   	dec    %edx
+  800b28:	75 db                	jne    800b05 <page_zero+0x1d>
+  800b2a:	0f ae f8             	sfence
+  800b2d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b30:	c9                   	leave
+  800b31:	c3                   	ret
+  800b32:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b35:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800b3a:	fc                   	cld
+  800b3b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b3d:	eb ee                	jmp    800b2d <page_zero+0x45>
+
+00800b3f <memcmp>:
+  800b3f:	55                   	push   %ebp
+  800b40:	89 e5                	mov    %esp,%ebp
+  800b42:	56                   	push   %esi
+  800b43:	53                   	push   %ebx
+  800b44:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b47:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b4a:	89 c6                	mov    %eax,%esi
+  800b4c:	03 75 10             	add    0x10(%ebp),%esi
+  800b4f:	eb 06                	jmp    800b57 <memcmp+0x18>
+  800b51:	83 c0 01             	add    $0x1,%eax
+  800b54:	83 c2 01             	add    $0x1,%edx
+  800b57:	39 f0                	cmp    %esi,%eax
+  800b59:	74 14                	je     800b6f <memcmp+0x30>
+  800b5b:	0f b6 08             	movzbl (%eax),%ecx
+  800b5e:	0f b6 1a             	movzbl (%edx),%ebx
+  800b61:	38 d9                	cmp    %bl,%cl
+  800b63:	74 ec                	je     800b51 <memcmp+0x12>
+  800b65:	0f b6 c1             	movzbl %cl,%eax
+  800b68:	0f b6 db             	movzbl %bl,%ebx
+  800b6b:	29 d8                	sub    %ebx,%eax
+  800b6d:	eb 05                	jmp    800b74 <memcmp+0x35>
+  800b6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b74:	5b                   	pop    %ebx
+  800b75:	5e                   	pop    %esi
+  800b76:	5d                   	pop    %ebp
+  800b77:	c3                   	ret
+
+00800b78 <memfind>:
+  800b78:	55                   	push   %ebp
+  800b79:	89 e5                	mov    %esp,%ebp
+  800b7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b81:	89 c2                	mov    %eax,%edx
+  800b83:	03 55 10             	add    0x10(%ebp),%edx
+  800b86:	eb 03                	jmp    800b8b <memfind+0x13>
+  800b88:	83 c0 01             	add    $0x1,%eax
+  800b8b:	39 d0                	cmp    %edx,%eax
+  800b8d:	73 04                	jae    800b93 <memfind+0x1b>
+  800b8f:	38 08                	cmp    %cl,(%eax)
+  800b91:	75 f5                	jne    800b88 <memfind+0x10>
+  800b93:	5d                   	pop    %ebp
+  800b94:	c3                   	ret
+
+00800b95 <strtol>:
+  800b95:	55                   	push   %ebp
+  800b96:	89 e5                	mov    %esp,%ebp
+  800b98:	57                   	push   %edi
+  800b99:	56                   	push   %esi
+  800b9a:	53                   	push   %ebx
+  800b9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b9e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ba1:	eb 03                	jmp    800ba6 <strtol+0x11>
+  800ba3:	83 c2 01             	add    $0x1,%edx
+  800ba6:	0f b6 02             	movzbl (%edx),%eax
+  800ba9:	3c 20                	cmp    $0x20,%al
+  800bab:	74 f6                	je     800ba3 <strtol+0xe>
+  800bad:	3c 09                	cmp    $0x9,%al
+  800baf:	74 f2                	je     800ba3 <strtol+0xe>
+  800bb1:	3c 2b                	cmp    $0x2b,%al
+  800bb3:	74 2a                	je     800bdf <strtol+0x4a>
+  800bb5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bba:	3c 2d                	cmp    $0x2d,%al
+  800bbc:	74 2b                	je     800be9 <strtol+0x54>
+  800bbe:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bc4:	75 0f                	jne    800bd5 <strtol+0x40>
+  800bc6:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bc9:	74 28                	je     800bf3 <strtol+0x5e>
+  800bcb:	85 db                	test   %ebx,%ebx
+  800bcd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bd2:	0f 44 d8             	cmove  %eax,%ebx
+  800bd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bda:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bdd:	eb 46                	jmp    800c25 <strtol+0x90>
+  800bdf:	83 c2 01             	add    $0x1,%edx
+  800be2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800be7:	eb d5                	jmp    800bbe <strtol+0x29>
+  800be9:	83 c2 01             	add    $0x1,%edx
+  800bec:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bf1:	eb cb                	jmp    800bbe <strtol+0x29>
+  800bf3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bf7:	74 0e                	je     800c07 <strtol+0x72>
+  800bf9:	85 db                	test   %ebx,%ebx
+  800bfb:	75 d8                	jne    800bd5 <strtol+0x40>
+  800bfd:	83 c2 01             	add    $0x1,%edx
+  800c00:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c05:	eb ce                	jmp    800bd5 <strtol+0x40>
+  800c07:	83 c2 02             	add    $0x2,%edx
+  800c0a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c0f:	eb c4                	jmp    800bd5 <strtol+0x40>
+  800c11:	0f be c0             	movsbl %al,%eax
+  800c14:	83 e8 30             	sub    $0x30,%eax
+  800c17:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c1a:	7d 3a                	jge    800c56 <strtol+0xc1>
+  800c1c:	83 c2 01             	add    $0x1,%edx
+  800c1f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c23:	01 c1                	add    %eax,%ecx
+  800c25:	0f b6 02             	movzbl (%edx),%eax
+  800c28:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c2b:	89 f3                	mov    %esi,%ebx
+  800c2d:	80 fb 09             	cmp    $0x9,%bl
+  800c30:	76 df                	jbe    800c11 <strtol+0x7c>
+  800c32:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c35:	89 f3                	mov    %esi,%ebx
+  800c37:	80 fb 19             	cmp    $0x19,%bl
+  800c3a:	77 08                	ja     800c44 <strtol+0xaf>
+  800c3c:	0f be c0             	movsbl %al,%eax
+  800c3f:	83 e8 57             	sub    $0x57,%eax
+  800c42:	eb d3                	jmp    800c17 <strtol+0x82>
+  800c44:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c47:	89 f3                	mov    %esi,%ebx
+  800c49:	80 fb 19             	cmp    $0x19,%bl
+  800c4c:	77 08                	ja     800c56 <strtol+0xc1>
+  800c4e:	0f be c0             	movsbl %al,%eax
+  800c51:	83 e8 37             	sub    $0x37,%eax
+  800c54:	eb c1                	jmp    800c17 <strtol+0x82>
+  800c56:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c5a:	74 05                	je     800c61 <strtol+0xcc>
+  800c5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c5f:	89 10                	mov    %edx,(%eax)
+  800c61:	89 c8                	mov    %ecx,%eax
+  800c63:	f7 d8                	neg    %eax
+  800c65:	85 ff                	test   %edi,%edi
+  800c67:	0f 45 c8             	cmovne %eax,%ecx
+  800c6a:	89 c8                	mov    %ecx,%eax
+  800c6c:	5b                   	pop    %ebx
+  800c6d:	5e                   	pop    %esi
+  800c6e:	5f                   	pop    %edi
+  800c6f:	5d                   	pop    %ebp
+  800c70:	c3                   	ret
+
+00800c71 <sys_cputs>:
+  800c71:	55                   	push   %ebp
+  800c72:	89 e5                	mov    %esp,%ebp
+  800c74:	57                   	push   %edi
+  800c75:	56                   	push   %esi
+  800c76:	53                   	push   %ebx
+  800c77:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c7e:	78 21                	js     800ca1 <sys_cputs+0x30>
+  800c80:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c87:	75 2d                	jne    800cb6 <sys_cputs+0x45>
+  800c89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c94:	89 c3                	mov    %eax,%ebx
+  800c96:	89 c7                	mov    %eax,%edi
+  800c98:	89 c6                	mov    %eax,%esi
+  800c9a:	cd 30                	int    $0x30
+  800c9c:	5b                   	pop    %ebx
+  800c9d:	5e                   	pop    %esi
+  800c9e:	5f                   	pop    %edi
+  800c9f:	5d                   	pop    %ebp
+  800ca0:	c3                   	ret
+  800ca1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ca6:	0f a2                	cpuid
+  800ca8:	c1 ea 0b             	shr    $0xb,%edx
+  800cab:	83 e2 01             	and    $0x1,%edx
+  800cae:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800cb4:	eb ca                	jmp    800c80 <sys_cputs+0xf>
+  800cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc1:	89 c3                	mov    %eax,%ebx
+  800cc3:	89 c7                	mov    %eax,%edi
+  800cc5:	89 c6                	mov    %eax,%esi
+  800cc7:	55                   	push   %ebp
+  800cc8:	68 d1 0c 80 00       	push   $0x800cd1
+  800ccd:	89 e5                	mov    %esp,%ebp
+  800ccf:	0f 34                	sysenter
+  800cd1:	83 c4 04             	add    $0x4,%esp
+  800cd4:	5d                   	pop    %ebp
+  800cd5:	eb c5                	jmp    800c9c <sys_cputs+0x2b>
+
+00800cd7 <sys_cgetc>:
+  800cd7:	55                   	push   %ebp
+  800cd8:	89 e5                	mov    %esp,%ebp
+  800cda:	57                   	push   %edi
+  800cdb:	56                   	push   %esi
+  800cdc:	53                   	push   %ebx
+  800cdd:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800ce4:	78 22                	js     800d08 <sys_cgetc+0x31>
+  800ce6:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800ced:	75 2e                	jne    800d1d <sys_cgetc+0x46>
+  800cef:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cf9:	89 d1                	mov    %edx,%ecx
+  800cfb:	89 d3                	mov    %edx,%ebx
+  800cfd:	89 d7                	mov    %edx,%edi
+  800cff:	89 d6                	mov    %edx,%esi
+  800d01:	cd 30                	int    $0x30
+  800d03:	5b                   	pop    %ebx
+  800d04:	5e                   	pop    %esi
+  800d05:	5f                   	pop    %edi
+  800d06:	5d                   	pop    %ebp
+  800d07:	c3                   	ret
+  800d08:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d0d:	0f a2                	cpuid
+  800d0f:	c1 ea 0b             	shr    $0xb,%edx
+  800d12:	83 e2 01             	and    $0x1,%edx
+  800d15:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800d1b:	eb c9                	jmp    800ce6 <sys_cgetc+0xf>
+  800d1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d22:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d27:	89 d1                	mov    %edx,%ecx
+  800d29:	89 d3                	mov    %edx,%ebx
+  800d2b:	89 d7                	mov    %edx,%edi
+  800d2d:	89 d6                	mov    %edx,%esi
+  800d2f:	55                   	push   %ebp
+  800d30:	68 39 0d 80 00       	push   $0x800d39
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	0f 34                	sysenter
+  800d39:	83 c4 04             	add    $0x4,%esp
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	eb c4                	jmp    800d03 <sys_cgetc+0x2c>
+
+00800d3f <sys_env_destroy>:
+  800d3f:	55                   	push   %ebp
+  800d40:	89 e5                	mov    %esp,%ebp
+  800d42:	57                   	push   %edi
+  800d43:	56                   	push   %esi
+  800d44:	53                   	push   %ebx
+  800d45:	83 ec 0c             	sub    $0xc,%esp
+  800d48:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d4f:	78 2a                	js     800d7b <sys_env_destroy+0x3c>
+  800d51:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d58:	75 36                	jne    800d90 <sys_env_destroy+0x51>
+  800d5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d5f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d67:	89 cb                	mov    %ecx,%ebx
+  800d69:	89 cf                	mov    %ecx,%edi
+  800d6b:	89 ce                	mov    %ecx,%esi
+  800d6d:	cd 30                	int    $0x30
+  800d6f:	85 c0                	test   %eax,%eax
+  800d71:	7f 40                	jg     800db3 <sys_env_destroy+0x74>
+  800d73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d76:	5b                   	pop    %ebx
+  800d77:	5e                   	pop    %esi
+  800d78:	5f                   	pop    %edi
+  800d79:	5d                   	pop    %ebp
+  800d7a:	c3                   	ret
+  800d7b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d80:	0f a2                	cpuid
+  800d82:	c1 ea 0b             	shr    $0xb,%edx
+  800d85:	83 e2 01             	and    $0x1,%edx
+  800d88:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800d8e:	eb c1                	jmp    800d51 <sys_env_destroy+0x12>
+  800d90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d98:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d9d:	89 cb                	mov    %ecx,%ebx
+  800d9f:	89 cf                	mov    %ecx,%edi
+  800da1:	89 ce                	mov    %ecx,%esi
+  800da3:	55                   	push   %ebp
+  800da4:	68 ad 0d 80 00       	push   $0x800dad
+  800da9:	89 e5                	mov    %esp,%ebp
+  800dab:	0f 34                	sysenter
+  800dad:	83 c4 04             	add    $0x4,%esp
+  800db0:	5d                   	pop    %ebp
+  800db1:	eb bc                	jmp    800d6f <sys_env_destroy+0x30>
+  800db3:	83 ec 0c             	sub    $0xc,%esp
+  800db6:	50                   	push   %eax
+  800db7:	6a 03                	push   $0x3
+  800db9:	68 84 1d 80 00       	push   $0x801d84
+  800dbe:	6a 49                	push   $0x49
+  800dc0:	68 a1 1d 80 00       	push   $0x801da1
+  800dc5:	e8 63 f3 ff ff       	call   80012d <_panic>
+
+00800dca <sys_getenvid>:
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	57                   	push   %edi
+  800dce:	56                   	push   %esi
+  800dcf:	53                   	push   %ebx
+  800dd0:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800dd7:	78 22                	js     800dfb <sys_getenvid+0x31>
+  800dd9:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800de0:	75 2e                	jne    800e10 <sys_getenvid+0x46>
+  800de2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dec:	89 d1                	mov    %edx,%ecx
+  800dee:	89 d3                	mov    %edx,%ebx
+  800df0:	89 d7                	mov    %edx,%edi
+  800df2:	89 d6                	mov    %edx,%esi
+  800df4:	cd 30                	int    $0x30
+  800df6:	5b                   	pop    %ebx
+  800df7:	5e                   	pop    %esi
+  800df8:	5f                   	pop    %edi
+  800df9:	5d                   	pop    %ebp
+  800dfa:	c3                   	ret
+  800dfb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e00:	0f a2                	cpuid
+  800e02:	c1 ea 0b             	shr    $0xb,%edx
+  800e05:	83 e2 01             	and    $0x1,%edx
+  800e08:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800e0e:	eb c9                	jmp    800dd9 <sys_getenvid+0xf>
+  800e10:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e15:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e1a:	89 d1                	mov    %edx,%ecx
+  800e1c:	89 d3                	mov    %edx,%ebx
+  800e1e:	89 d7                	mov    %edx,%edi
+  800e20:	89 d6                	mov    %edx,%esi
+  800e22:	55                   	push   %ebp
+  800e23:	68 2c 0e 80 00       	push   $0x800e2c
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	0f 34                	sysenter
+  800e2c:	83 c4 04             	add    $0x4,%esp
+  800e2f:	5d                   	pop    %ebp
+  800e30:	eb c4                	jmp    800df6 <sys_getenvid+0x2c>
+
+00800e32 <sys_yield>:
+  800e32:	55                   	push   %ebp
+  800e33:	89 e5                	mov    %esp,%ebp
+  800e35:	57                   	push   %edi
+  800e36:	56                   	push   %esi
+  800e37:	53                   	push   %ebx
+  800e38:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e3f:	78 22                	js     800e63 <sys_yield+0x31>
+  800e41:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e48:	75 2e                	jne    800e78 <sys_yield+0x46>
+  800e4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e54:	89 d1                	mov    %edx,%ecx
+  800e56:	89 d3                	mov    %edx,%ebx
+  800e58:	89 d7                	mov    %edx,%edi
+  800e5a:	89 d6                	mov    %edx,%esi
+  800e5c:	cd 30                	int    $0x30
+  800e5e:	5b                   	pop    %ebx
+  800e5f:	5e                   	pop    %esi
+  800e60:	5f                   	pop    %edi
+  800e61:	5d                   	pop    %ebp
+  800e62:	c3                   	ret
+  800e63:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e68:	0f a2                	cpuid
+  800e6a:	c1 ea 0b             	shr    $0xb,%edx
+  800e6d:	83 e2 01             	and    $0x1,%edx
+  800e70:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800e76:	eb c9                	jmp    800e41 <sys_yield+0xf>
+  800e78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e82:	89 d1                	mov    %edx,%ecx
+  800e84:	89 d3                	mov    %edx,%ebx
+  800e86:	89 d7                	mov    %edx,%edi
+  800e88:	89 d6                	mov    %edx,%esi
+  800e8a:	55                   	push   %ebp
+  800e8b:	68 94 0e 80 00       	push   $0x800e94
+  800e90:	89 e5                	mov    %esp,%ebp
+  800e92:	0f 34                	sysenter
+  800e94:	83 c4 04             	add    $0x4,%esp
+  800e97:	5d                   	pop    %ebp
+  800e98:	eb c4                	jmp    800e5e <sys_yield+0x2c>
+
+00800e9a <sys_env_set_cow>:
+  800e9a:	55                   	push   %ebp
+  800e9b:	89 e5                	mov    %esp,%ebp
+  800e9d:	57                   	push   %edi
+  800e9e:	56                   	push   %esi
+  800e9f:	53                   	push   %ebx
+  800ea0:	83 ec 0c             	sub    $0xc,%esp
+  800ea3:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800eaa:	78 2b                	js     800ed7 <sys_env_set_cow+0x3d>
+  800eac:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800eb3:	75 37                	jne    800eec <sys_env_set_cow+0x52>
+  800eb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eba:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ebf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec5:	89 df                	mov    %ebx,%edi
+  800ec7:	89 de                	mov    %ebx,%esi
+  800ec9:	cd 30                	int    $0x30
+  800ecb:	85 c0                	test   %eax,%eax
+  800ecd:	7f 41                	jg     800f10 <sys_env_set_cow+0x76>
+  800ecf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed2:	5b                   	pop    %ebx
+  800ed3:	5e                   	pop    %esi
+  800ed4:	5f                   	pop    %edi
+  800ed5:	5d                   	pop    %ebp
+  800ed6:	c3                   	ret
+  800ed7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800edc:	0f a2                	cpuid
+  800ede:	c1 ea 0b             	shr    $0xb,%edx
+  800ee1:	83 e2 01             	and    $0x1,%edx
+  800ee4:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800eea:	eb c0                	jmp    800eac <sys_env_set_cow+0x12>
+  800eec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800efc:	89 df                	mov    %ebx,%edi
+  800efe:	89 de                	mov    %ebx,%esi
+  800f00:	55                   	push   %ebp
+  800f01:	68 0a 0f 80 00       	push   $0x800f0a
+  800f06:	89 e5                	mov    %esp,%ebp
+  800f08:	0f 34                	sysenter
+  800f0a:	83 c4 04             	add    $0x4,%esp
+  800f0d:	5d                   	pop    %ebp
+  800f0e:	eb bb                	jmp    800ecb <sys_env_set_cow+0x31>
+  800f10:	83 ec 0c             	sub    $0xc,%esp
+  800f13:	50                   	push   %eax
+  800f14:	6a 0d                	push   $0xd
+  800f16:	68 84 1d 80 00       	push   $0x801d84
+  800f1b:	6a 49                	push   $0x49
+  800f1d:	68 a1 1d 80 00       	push   $0x801da1
+  800f22:	e8 06 f2 ff ff       	call   80012d <_panic>
+
+00800f27 <sys_env_set_quota>:
+  800f27:	55                   	push   %ebp
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	57                   	push   %edi
+  800f2b:	56                   	push   %esi
+  800f2c:	53                   	push   %ebx
+  800f2d:	83 ec 0c             	sub    $0xc,%esp
+  800f30:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f37:	78 2b                	js     800f64 <sys_env_set_quota+0x3d>
+  800f39:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f40:	75 37                	jne    800f79 <sys_env_set_quota+0x52>
+  800f42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f47:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f52:	89 df                	mov    %ebx,%edi
+  800f54:	89 de                	mov    %ebx,%esi
+  800f56:	cd 30                	int    $0x30
+  800f58:	85 c0                	test   %eax,%eax
+  800f5a:	7f 41                	jg     800f9d <sys_env_set_quota+0x76>
+  800f5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5f:	5b                   	pop    %ebx
+  800f60:	5e                   	pop    %esi
+  800f61:	5f                   	pop    %edi
+  800f62:	5d                   	pop    %ebp
+  800f63:	c3                   	ret
+  800f64:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f69:	0f a2                	cpuid
+  800f6b:	c1 ea 0b             	shr    $0xb,%edx
+  800f6e:	83 e2 01             	and    $0x1,%edx
+  800f71:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800f77:	eb c0                	jmp    800f39 <sys_env_set_quota+0x12>
+  800f79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f84:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f89:	89 df                	mov    %ebx,%edi
+  800f8b:	89 de                	mov    %ebx,%esi
+  800f8d:	55                   	push   %ebp
+  800f8e:	68 97 0f 80 00       	push   $0x800f97
+  800f93:	89 e5                	mov    %esp,%ebp
+  800f95:	0f 34                	sysenter
+  800f97:	83 c4 04             	add    $0x4,%esp
+  800f9a:	5d                   	pop    %ebp
+  800f9b:	eb bb                	jmp    800f58 <sys_env_set_quota+0x31>
+  800f9d:	83 ec 0c             	sub    $0xc,%esp
+  800fa0:	50                   	push   %eax
+  800fa1:	6a 0f                	push   $0xf
+  800fa3:	68 84 1d 80 00       	push   $0x801d84
+  800fa8:	6a 49                	push   $0x49
+  800faa:	68 a1 1d 80 00       	push   $0x801da1
+  800faf:	e8 79 f1 ff ff       	call   80012d <_panic>
+
+00800fb4 <sys_page_alloc>:
+  800fb4:	55                   	push   %ebp
+  800fb5:	89 e5                	mov    %esp,%ebp
+  800fb7:	57                   	push   %edi
+  800fb8:	56                   	push   %esi
+  800fb9:	53                   	push   %ebx
+  800fba:	83 ec 0c             	sub    $0xc,%esp
+  800fbd:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800fc4:	78 2c                	js     800ff2 <sys_page_alloc+0x3e>
+  800fc6:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800fcd:	75 38                	jne    801007 <sys_page_alloc+0x53>
+  800fcf:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe2:	89 f7                	mov    %esi,%edi
+  800fe4:	cd 30                	int    $0x30
+  800fe6:	85 c0                	test   %eax,%eax
+  800fe8:	7f 42                	jg     80102c <sys_page_alloc+0x78>
+  800fea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fed:	5b                   	pop    %ebx
+  800fee:	5e                   	pop    %esi
+  800fef:	5f                   	pop    %edi
+  800ff0:	5d                   	pop    %ebp
+  800ff1:	c3                   	ret
+  800ff2:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ff7:	0f a2                	cpuid
+  800ff9:	c1 ea 0b             	shr    $0xb,%edx
+  800ffc:	83 e2 01             	and    $0x1,%edx
+  800fff:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801005:	eb bf                	jmp    800fc6 <sys_page_alloc+0x12>
+  801007:	be 00 00 00 00       	mov    $0x0,%esi
+  80100c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801012:	b8 04 00 00 00       	mov    $0x4,%eax
+  801017:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80101a:	89 f7                	mov    %esi,%edi
+  80101c:	55                   	push   %ebp
+  80101d:	68 26 10 80 00       	push   $0x801026
+  801022:	89 e5                	mov    %esp,%ebp
+  801024:	0f 34                	sysenter
+  801026:	83 c4 04             	add    $0x4,%esp
+  801029:	5d                   	pop    %ebp
+  80102a:	eb ba                	jmp    800fe6 <sys_page_alloc+0x32>
+  80102c:	83 ec 0c             	sub    $0xc,%esp
+  80102f:	50                   	push   %eax
+  801030:	6a 04                	push   $0x4
+  801032:	68 84 1d 80 00       	push   $0x801d84
+  801037:	6a 49                	push   $0x49
+  801039:	68 a1 1d 80 00       	push   $0x801da1
+  80103e:	e8 ea f0 ff ff       	call   80012d <_panic>
+
+00801043 <sys_page_map>:
+  801043:	55                   	push   %ebp
+  801044:	89 e5                	mov    %esp,%ebp
+  801046:	57                   	push   %edi
+  801047:	56                   	push   %esi
+  801048:	53                   	push   %ebx
+  801049:	83 ec 0c             	sub    $0xc,%esp
+  80104c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801053:	78 2b                	js     801080 <sys_page_map+0x3d>
+  801055:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80105c:	75 37                	jne    801095 <sys_page_map+0x52>
+  80105e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801063:	8b 55 08             	mov    0x8(%ebp),%edx
+  801066:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801069:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80106c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80106f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801072:	cd 30                	int    $0x30
+  801074:	85 c0                	test   %eax,%eax
+  801076:	7f 41                	jg     8010b9 <sys_page_map+0x76>
+  801078:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107b:	5b                   	pop    %ebx
+  80107c:	5e                   	pop    %esi
+  80107d:	5f                   	pop    %edi
+  80107e:	5d                   	pop    %ebp
+  80107f:	c3                   	ret
+  801080:	b8 01 00 00 00       	mov    $0x1,%eax
+  801085:	0f a2                	cpuid
+  801087:	c1 ea 0b             	shr    $0xb,%edx
+  80108a:	83 e2 01             	and    $0x1,%edx
+  80108d:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801093:	eb c0                	jmp    801055 <sys_page_map+0x12>
+  801095:	8b 55 08             	mov    0x8(%ebp),%edx
+  801098:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109b:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010a9:	55                   	push   %ebp
+  8010aa:	68 b3 10 80 00       	push   $0x8010b3
+  8010af:	89 e5                	mov    %esp,%ebp
+  8010b1:	0f 34                	sysenter
+  8010b3:	83 c4 04             	add    $0x4,%esp
+  8010b6:	5d                   	pop    %ebp
+  8010b7:	eb bb                	jmp    801074 <sys_page_map+0x31>
+  8010b9:	83 ec 0c             	sub    $0xc,%esp
+  8010bc:	50                   	push   %eax
+  8010bd:	6a 05                	push   $0x5
+  8010bf:	68 84 1d 80 00       	push   $0x801d84
+  8010c4:	6a 49                	push   $0x49
+  8010c6:	68 a1 1d 80 00       	push   $0x801da1
+  8010cb:	e8 5d f0 ff ff       	call   80012d <_panic>
+
+008010d0 <sys_page_unmap>:
+  8010d0:	55                   	push   %ebp
+  8010d1:	89 e5                	mov    %esp,%ebp
+  8010d3:	57                   	push   %edi
+  8010d4:	56                   	push   %esi
+  8010d5:	53                   	push   %ebx
+  8010d6:	83 ec 0c             	sub    $0xc,%esp
+  8010d9:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010e0:	78 2b                	js     80110d <sys_page_unmap+0x3d>
+  8010e2:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010e9:	75 37                	jne    801122 <sys_page_unmap+0x52>
+  8010eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fb:	89 df                	mov    %ebx,%edi
+  8010fd:	89 de                	mov    %ebx,%esi
+  8010ff:	cd 30                	int    $0x30
+  801101:	85 c0                	test   %eax,%eax
+  801103:	7f 41                	jg     801146 <sys_page_unmap+0x76>
+  801105:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801108:	5b                   	pop    %ebx
+  801109:	5e                   	pop    %esi
+  80110a:	5f                   	pop    %edi
+  80110b:	5d                   	pop    %ebp
+  80110c:	c3                   	ret
+  80110d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801112:	0f a2                	cpuid
+  801114:	c1 ea 0b             	shr    $0xb,%edx
+  801117:	83 e2 01             	and    $0x1,%edx
+  80111a:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801120:	eb c0                	jmp    8010e2 <sys_page_unmap+0x12>
+  801122:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801127:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801132:	89 df                	mov    %ebx,%edi
+  801134:	89 de                	mov    %ebx,%esi
+  801136:	55                   	push   %ebp
+  801137:	68 40 11 80 00       	push   $0x801140
+  80113c:	89 e5                	mov    %esp,%ebp
+  80113e:	0f 34                	sysenter
+  801140:	83 c4 04             	add    $0x4,%esp
+  801143:	5d                   	pop    %ebp
+  801144:	eb bb                	jmp    801101 <sys_page_unmap+0x31>
+  801146:	83 ec 0c             	sub    $0xc,%esp
+  801149:	50                   	push   %eax
+  80114a:	6a 06                	push   $0x6
+  80114c:	68 84 1d 80 00       	push   $0x801d84
+  801151:	6a 49                	push   $0x49
+  801153:	68 a1 1d 80 00       	push   $0x801da1
+  801158:	e8 d0 ef ff ff       	call   80012d <_panic>
+
+0080115d <sys_page_reuse>:
+  80115d:	55                   	push   %ebp
+  80115e:	89 e5                	mov    %esp,%ebp
+  801160:	57                   	push   %edi
+  801161:	56                   	push   %esi
+  801162:	53                   	push   %ebx
+  801163:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80116a:	78 24                	js     801190 <sys_page_reuse+0x33>
+  80116c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801173:	75 30                	jne    8011a5 <sys_page_reuse+0x48>
+  801175:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80117f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801182:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801185:	89 df                	mov    %ebx,%edi
+  801187:	89 de                	mov    %ebx,%esi
+  801189:	cd 30                	int    $0x30
+  80118b:	5b                   	pop    %ebx
+  80118c:	5e                   	pop    %esi
+  80118d:	5f                   	pop    %edi
+  80118e:	5d                   	pop    %ebp
+  80118f:	c3                   	ret
+  801190:	b8 01 00 00 00       	mov    $0x1,%eax
+  801195:	0f a2                	cpuid
+  801197:	c1 ea 0b             	shr    $0xb,%edx
+  80119a:	83 e2 01             	and    $0x1,%edx
+  80119d:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8011a3:	eb c7                	jmp    80116c <sys_page_reuse+0xf>
+  8011a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011b5:	89 df                	mov    %ebx,%edi
+  8011b7:	89 de                	mov    %ebx,%esi
+  8011b9:	55                   	push   %ebp
+  8011ba:	68 c3 11 80 00       	push   $0x8011c3
+  8011bf:	89 e5                	mov    %esp,%ebp
+  8011c1:	0f 34                	sysenter
+  8011c3:	83 c4 04             	add    $0x4,%esp
+  8011c6:	5d                   	pop    %ebp
+  8011c7:	eb c2                	jmp    80118b <sys_page_reuse+0x2e>
+
+008011c9 <sys_env_set_status>:
+  8011c9:	55                   	push   %ebp
+  8011ca:	89 e5                	mov    %esp,%ebp
+  8011cc:	57                   	push   %edi
+  8011cd:	56                   	push   %esi
+  8011ce:	53                   	push   %ebx
+  8011cf:	83 ec 0c             	sub    $0xc,%esp
+  8011d2:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011d9:	78 2b                	js     801206 <sys_env_set_status+0x3d>
+  8011db:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011e2:	75 37                	jne    80121b <sys_env_set_status+0x52>
+  8011e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f4:	89 df                	mov    %ebx,%edi
+  8011f6:	89 de                	mov    %ebx,%esi
+  8011f8:	cd 30                	int    $0x30
+  8011fa:	85 c0                	test   %eax,%eax
+  8011fc:	7f 41                	jg     80123f <sys_env_set_status+0x76>
+  8011fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801201:	5b                   	pop    %ebx
+  801202:	5e                   	pop    %esi
+  801203:	5f                   	pop    %edi
+  801204:	5d                   	pop    %ebp
+  801205:	c3                   	ret
+  801206:	b8 01 00 00 00       	mov    $0x1,%eax
+  80120b:	0f a2                	cpuid
+  80120d:	c1 ea 0b             	shr    $0xb,%edx
+  801210:	83 e2 01             	and    $0x1,%edx
+  801213:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801219:	eb c0                	jmp    8011db <sys_env_set_status+0x12>
+  80121b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801220:	8b 55 08             	mov    0x8(%ebp),%edx
+  801223:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801226:	b8 08 00 00 00       	mov    $0x8,%eax
+  80122b:	89 df                	mov    %ebx,%edi
+  80122d:	89 de                	mov    %ebx,%esi
+  80122f:	55                   	push   %ebp
+  801230:	68 39 12 80 00       	push   $0x801239
+  801235:	89 e5                	mov    %esp,%ebp
+  801237:	0f 34                	sysenter
+  801239:	83 c4 04             	add    $0x4,%esp
+  80123c:	5d                   	pop    %ebp
+  80123d:	eb bb                	jmp    8011fa <sys_env_set_status+0x31>
+  80123f:	83 ec 0c             	sub    $0xc,%esp
+  801242:	50                   	push   %eax
+  801243:	6a 08                	push   $0x8
+  801245:	68 84 1d 80 00       	push   $0x801d84
+  80124a:	6a 49                	push   $0x49
+  80124c:	68 a1 1d 80 00       	push   $0x801da1
+  801251:	e8 d7 ee ff ff       	call   80012d <_panic>
+
+00801256 <sys_env_set_pgfault_upcall>:
+  801256:	55                   	push   %ebp
+  801257:	89 e5                	mov    %esp,%ebp
+  801259:	57                   	push   %edi
+  80125a:	56                   	push   %esi
+  80125b:	53                   	push   %ebx
+  80125c:	83 ec 0c             	sub    $0xc,%esp
+  80125f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801266:	78 2b                	js     801293 <sys_env_set_pgfault_upcall+0x3d>
+  801268:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80126f:	75 37                	jne    8012a8 <sys_env_set_pgfault_upcall+0x52>
+  801271:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801276:	b8 09 00 00 00       	mov    $0x9,%eax
+  80127b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801281:	89 df                	mov    %ebx,%edi
+  801283:	89 de                	mov    %ebx,%esi
+  801285:	cd 30                	int    $0x30
+  801287:	85 c0                	test   %eax,%eax
+  801289:	7f 41                	jg     8012cc <sys_env_set_pgfault_upcall+0x76>
+  80128b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128e:	5b                   	pop    %ebx
+  80128f:	5e                   	pop    %esi
+  801290:	5f                   	pop    %edi
+  801291:	5d                   	pop    %ebp
+  801292:	c3                   	ret
+  801293:	b8 01 00 00 00       	mov    $0x1,%eax
+  801298:	0f a2                	cpuid
+  80129a:	c1 ea 0b             	shr    $0xb,%edx
+  80129d:	83 e2 01             	and    $0x1,%edx
+  8012a0:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8012a6:	eb c0                	jmp    801268 <sys_env_set_pgfault_upcall+0x12>
+  8012a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012b8:	89 df                	mov    %ebx,%edi
+  8012ba:	89 de                	mov    %ebx,%esi
+  8012bc:	55                   	push   %ebp
+  8012bd:	68 c6 12 80 00       	push   $0x8012c6
+  8012c2:	89 e5                	mov    %esp,%ebp
+  8012c4:	0f 34                	sysenter
+  8012c6:	83 c4 04             	add    $0x4,%esp
+  8012c9:	5d                   	pop    %ebp
+  8012ca:	eb bb                	jmp    801287 <sys_env_set_pgfault_upcall+0x31>
+  8012cc:	83 ec 0c             	sub    $0xc,%esp
+  8012cf:	50                   	push   %eax
+  8012d0:	6a 09                	push   $0x9
+  8012d2:	68 84 1d 80 00       	push   $0x801d84
+  8012d7:	6a 49                	push   $0x49
+  8012d9:	68 a1 1d 80 00       	push   $0x801da1
+  8012de:	e8 4a ee ff ff       	call   80012d <_panic>
+
+008012e3 <sys_env_set_trace>:
+  8012e3:	55                   	push   %ebp
+  8012e4:	89 e5                	mov    %esp,%ebp
+  8012e6:	57                   	push   %edi
+  8012e7:	56                   	push   %esi
+  8012e8:	53                   	push   %ebx
+  8012e9:	83 ec 0c             	sub    $0xc,%esp
+  8012ec:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012f3:	78 2b                	js     801320 <sys_env_set_trace+0x3d>
+  8012f5:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012fc:	75 37                	jne    801335 <sys_env_set_trace+0x52>
+  8012fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801303:	b8 12 00 00 00       	mov    $0x12,%eax
+  801308:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130e:	89 df                	mov    %ebx,%edi
+  801310:	89 de                	mov    %ebx,%esi
+  801312:	cd 30                	int    $0x30
+  801314:	85 c0                	test   %eax,%eax
+  801316:	7f 41                	jg     801359 <sys_env_set_trace+0x76>
+  801318:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80131b:	5b                   	pop    %ebx
+  80131c:	5e                   	pop    %esi
+  80131d:	5f                   	pop    %edi
+  80131e:	5d                   	pop    %ebp
+  80131f:	c3                   	ret
+  801320:	b8 01 00 00 00       	mov    $0x1,%eax
+  801325:	0f a2                	cpuid
+  801327:	c1 ea 0b             	shr    $0xb,%edx
+  80132a:	83 e2 01             	and    $0x1,%edx
+  80132d:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801333:	eb c0                	jmp    8012f5 <sys_env_set_trace+0x12>
+  801335:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801340:	b8 12 00 00 00       	mov    $0x12,%eax
+  801345:	89 df                	mov    %ebx,%edi
+  801347:	89 de                	mov    %ebx,%esi
+  801349:	55                   	push   %ebp
+  80134a:	68 53 13 80 00       	push   $0x801353
+  80134f:	89 e5                	mov    %esp,%ebp
+  801351:	0f 34                	sysenter
+  801353:	83 c4 04             	add    $0x4,%esp
+  801356:	5d                   	pop    %ebp
+  801357:	eb bb                	jmp    801314 <sys_env_set_trace+0x31>
+  801359:	83 ec 0c             	sub    $0xc,%esp
+  80135c:	50                   	push   %eax
+  80135d:	6a 12                	push   $0x12
+  80135f:	68 84 1d 80 00       	push   $0x801d84
+  801364:	6a 49                	push   $0x49
+  801366:	68 a1 1d 80 00       	push   $0x801da1
+  80136b:	e8 bd ed ff ff       	call   80012d <_panic>
+
+00801370 <sys_env_set_rdpmc>:
+  801370:	55                   	push   %ebp
+  801371:	89 e5                	mov    %esp,%ebp
+  801373:	57                   	push   %edi
+  801374:	56                   	push   %esi
+  801375:	53                   	push   %ebx
+  801376:	83 ec 0c             	sub    $0xc,%esp
+  801379:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801380:	78 2b                	js     8013ad <sys_env_set_rdpmc+0x3d>
+  801382:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801389:	75 37                	jne    8013c2 <sys_env_set_rdpmc+0x52>
+  80138b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801390:	b8 13 00 00 00       	mov    $0x13,%eax
+  801395:	8b 55 08             	mov    0x8(%ebp),%edx
+  801398:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139b:	89 df                	mov    %ebx,%edi
+  80139d:	89 de                	mov    %ebx,%esi
+  80139f:	cd 30                	int    $0x30
+  8013a1:	85 c0                	test   %eax,%eax
+  8013a3:	7f 41                	jg     8013e6 <sys_env_set_rdpmc+0x76>
+  8013a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a8:	5b                   	pop    %ebx
+  8013a9:	5e                   	pop    %esi
+  8013aa:	5f                   	pop    %edi
+  8013ab:	5d                   	pop    %ebp
+  8013ac:	c3                   	ret
+  8013ad:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013b2:	0f a2                	cpuid
+  8013b4:	c1 ea 0b             	shr    $0xb,%edx
+  8013b7:	83 e2 01             	and    $0x1,%edx
+  8013ba:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8013c0:	eb c0                	jmp    801382 <sys_env_set_rdpmc+0x12>
+  8013c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cd:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013d2:	89 df                	mov    %ebx,%edi
+  8013d4:	89 de                	mov    %ebx,%esi
+  8013d6:	55                   	push   %ebp
+  8013d7:	68 e0 13 80 00       	push   $0x8013e0
+  8013dc:	89 e5                	mov    %esp,%ebp
+  8013de:	0f 34                	sysenter
+  8013e0:	83 c4 04             	add    $0x4,%esp
+  8013e3:	5d                   	pop    %ebp
+  8013e4:	eb bb                	jmp    8013a1 <sys_env_set_rdpmc+0x31>
+  8013e6:	83 ec 0c             	sub    $0xc,%esp
+  8013e9:	50                   	push   %eax
+  8013ea:	6a 13                	push   $0x13
+  8013ec:	68 84 1d 80 00       	push   $0x801d84
+  8013f1:	6a 49                	push   $0x49
+  8013f3:	68 a1 1d 80 00       	push   $0x801da1
+  8013f8:	e8 30 ed ff ff       	call   80012d <_panic>
+
+008013fd <sys_ring_setup>:
+  8013fd:	55                   	push   %ebp
+  8013fe:	89 e5                	mov    %esp,%ebp
+  801400:	57                   	push   %edi
+  801401:	56                   	push   %esi
+  801402:	53                   	push   %ebx
+  801403:	83 ec 0c             	sub    $0xc,%esp
+  801406:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80140d:	78 29                	js     801438 <sys_ring_setup+0x3b>
+  80140f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801416:	75 35                	jne    80144d <sys_ring_setup+0x50>
+  801418:	ba 00 00 00 00       	mov    $0x0,%edx
+  80141d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801422:	89 d1                	mov    %edx,%ecx
+  801424:	89 d3                	mov    %edx,%ebx
+  801426:	89 d7                	mov    %edx,%edi
+  801428:	89 d6                	mov    %edx,%esi
+  80142a:	cd 30                	int    $0x30
+  80142c:	85 c0                	test   %eax,%eax
+  80142e:	7f 3f                	jg     80146f <sys_ring_setup+0x72>
+  801430:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801433:	5b                   	pop    %ebx
+  801434:	5e                   	pop    %esi
+  801435:	5f                   	pop    %edi
+  801436:	5d                   	pop    %ebp
+  801437:	c3                   	ret
+  801438:	b8 01 00 00 00       	mov    $0x1,%eax
+  80143d:	0f a2                	cpuid
+  80143f:	c1 ea 0b             	shr    $0xb,%edx
+  801442:	83 e2 01             	and    $0x1,%edx
+  801445:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80144b:	eb c2                	jmp    80140f <sys_ring_setup+0x12>
+  80144d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801452:	b8 10 00 00 00       	mov    $0x10,%eax
+  801457:	89 d1                	mov    %edx,%ecx
+  801459:	89 d3                	mov    %edx,%ebx
+  80145b:	89 d7                	mov    %edx,%edi
+  80145d:	89 d6                	mov    %edx,%esi
+  80145f:	55                   	push   %ebp
+  801460:	68 69 14 80 00       	push   $0x801469
+  801465:	89 e5                	mov    %esp,%ebp
+  801467:	0f 34                	sysenter
+  801469:	83 c4 04             	add    $0x4,%esp
+  80146c:	5d                   	pop    %ebp
+  80146d:	eb bd                	jmp    80142c <sys_ring_setup+0x2f>
+  80146f:	83 ec 0c             	sub    $0xc,%esp
+  801472:	50                   	push   %eax
+  801473:	6a 10                	push   $0x10
+  801475:	68 84 1d 80 00       	push   $0x801d84
+  80147a:	6a 49                	push   $0x49
+  80147c:	68 a1 1d 80 00       	push   $0x801da1
+  801481:	e8 a7 ec ff ff       	call   80012d <_panic>
+
+00801486 <sys_ring_enter>:
+  801486:	55                   	push   %ebp
+  801487:	89 e5                	mov    %esp,%ebp
+  801489:	57                   	push   %edi
+  80148a:	56                   	push   %esi
+  80148b:	53                   	push   %ebx
+  80148c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801493:	78 22                	js     8014b7 <sys_ring_enter+0x31>
+  801495:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80149c:	75 2e                	jne    8014cc <sys_ring_enter+0x46>
+  80149e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a3:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014a8:	89 d1                	mov    %edx,%ecx
+  8014aa:	89 d3                	mov    %edx,%ebx
+  8014ac:	89 d7                	mov    %edx,%edi
+  8014ae:	89 d6                	mov    %edx,%esi
+  8014b0:	cd 30                	int    $0x30
+  8014b2:	5b                   	pop    %ebx
+  8014b3:	5e                   	pop    %esi
+  8014b4:	5f                   	pop    %edi
+  8014b5:	5d                   	pop    %ebp
+  8014b6:	c3                   	ret
+  8014b7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014bc:	0f a2                	cpuid
+  8014be:	c1 ea 0b             	shr    $0xb,%edx
+  8014c1:	83 e2 01             	and    $0x1,%edx
+  8014c4:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8014ca:	eb c9                	jmp    801495 <sys_ring_enter+0xf>
+  8014cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014d1:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014d6:	89 d1                	mov    %edx,%ecx
+  8014d8:	89 d3                	mov    %edx,%ebx
+  8014da:	89 d7                	mov    %edx,%edi
+  8014dc:	89 d6                	mov    %edx,%esi
+  8014de:	55                   	push   %ebp
+  8014df:	68 e8 14 80 00       	push   $0x8014e8
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	0f 34                	sysenter
+  8014e8:	83 c4 04             	add    $0x4,%esp
+  8014eb:	5d                   	pop    %ebp
+  8014ec:	eb c4                	jmp    8014b2 <sys_ring_enter+0x2c>
+
+008014ee <sys_ipc_try_send>:
+  8014ee:	55                   	push   %ebp
+  8014ef:	89 e5                	mov    %esp,%ebp
+  8014f1:	57                   	push   %edi
+  8014f2:	56                   	push   %esi
+  8014f3:	53                   	push   %ebx
+  8014f4:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014fb:	78 26                	js     801523 <sys_ipc_try_send+0x35>
+  8014fd:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801504:	75 32                	jne    801538 <sys_ipc_try_send+0x4a>
+  801506:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80150b:	be 00 00 00 00       	mov    $0x0,%esi
+  801510:	8b 55 08             	mov    0x8(%ebp),%edx
+  801513:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801516:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801519:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80151c:	cd 30                	int    $0x30
+  80151e:	5b                   	pop    %ebx
+  80151f:	5e                   	pop    %esi
+  801520:	5f                   	pop    %edi
+  801521:	5d                   	pop    %ebp
+  801522:	c3                   	ret
+  801523:	b8 01 00 00 00       	mov    $0x1,%eax
+  801528:	0f a2                	cpuid
+  80152a:	c1 ea 0b             	shr    $0xb,%edx
+  80152d:	83 e2 01             	and    $0x1,%edx
+  801530:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801536:	eb c5                	jmp    8014fd <sys_ipc_try_send+0xf>
+  801538:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80153e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801543:	be 00 00 00 00       	mov    $0x0,%esi
+  801548:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80154e:	55                   	push   %ebp
+  80154f:	68 58 15 80 00       	push   $0x801558
+  801554:	89 e5                	mov    %esp,%ebp
+  801556:	0f 34                	sysenter
+  801558:	83 c4 04             	add    $0x4,%esp
+  80155b:	5d                   	pop    %ebp
+  80155c:	eb c0                	jmp    80151e <sys_ipc_try_send+0x30>
+
+0080155e <sys_ipc_recv>:
+  80155e:	55                   	push   %ebp
+  80155f:	89 e5                	mov    %esp,%ebp
+  801561:	57                   	push   %edi
+  801562:	56                   	push   %esi
+  801563:	53                   	push   %ebx
+  801564:	83 ec 0c             	sub    $0xc,%esp
+  801567:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80156e:	78 2a                	js     80159a <sys_ipc_recv+0x3c>
+  801570:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801577:	75 36                	jne    8015af <sys_ipc_recv+0x51>
+  801579:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80157e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801583:	8b 55 08             	mov    0x8(%ebp),%edx
+  801586:	89 cb                	mov    %ecx,%ebx
+  801588:	89 cf                	mov    %ecx,%edi
+  80158a:	89 ce                	mov    %ecx,%esi
+  80158c:	cd 30                	int    $0x30
+  80158e:	85 c0                	test   %eax,%eax
+  801590:	7f 40                	jg     8015d2 <sys_ipc_recv+0x74>
+  801592:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801595:	5b                   	pop    %ebx
+  801596:	5e                   	pop    %esi
+  801597:	5f                   	pop    %edi
+  801598:	5d                   	pop    %ebp
+  801599:	c3                   	ret
+  80159a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80159f:	0f a2                	cpuid
+  8015a1:	c1 ea 0b             	shr    $0xb,%edx
+  8015a4:	83 e2 01             	and    $0x1,%edx
+  8015a7:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8015ad:	eb c1                	jmp    801570 <sys_ipc_recv+0x12>
+  8015af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8015bc:	89 cb                	mov    %ecx,%ebx
+  8015be:	89 cf                	mov    %ecx,%edi
+  8015c0:	89 ce                	mov    %ecx,%esi
+  8015c2:	55                   	push   %ebp
+  8015c3:	68 cc 15 80 00       	push   $0x8015cc
+  8015c8:	89 e5                	mov    %esp,%ebp
+  8015ca:	0f 34                	sysenter
+  8015cc:	83 c4 04             	add    $0x4,%esp
+  8015cf:	5d                   	pop    %ebp
+  8015d0:	eb bc                	jmp    80158e <sys_ipc_recv+0x30>
+  8015d2:	83 ec 0c             	sub    $0xc,%esp
+  8015d5:	50                   	push   %eax
+  8015d6:	6a 0c                	push   $0xc
+  8015d8:	68 84 1d 80 00       	push   $0x801d84
+  8015dd:	6a 49                	push   $0x49
+  8015df:	68 a1 1d 80 00       	push   $0x801da1
+  8015e4:	e8 44 eb ff ff       	call   80012d <_panic>
+
+008015e9 <set_pgfault_handler>:
+  8015e9:	55                   	push   %ebp
+  8015ea:	89 e5                	mov    %esp,%ebp
+  8015ec:	83 ec 08             	sub    $0x8,%esp
+  8015ef:	83 3d 24 20 80 00 00 	cmpl   $0x0,0x802024
+  8015f6:	74 0a                	je     801602 <set_pgfault_handler+0x19>
+  8015f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015fb:	a3 24 20 80 00       	mov    %eax,0x802024
+  801600:	c9                   	leave
+  801601:	c3                   	ret
+  801602:	83 ec 04             	sub    $0x4,%esp
+  801605:	6a 07                	push   $0x7
+  801607:	68 00 f0 ff ea       	push   $0xeafff000
+  80160c:	6a 00                	push   $0x0
+  80160e:	e8 a1 f9 ff ff       	call   800fb4 <sys_page_alloc>
+  801613:	83 c4 10             	add    $0x10,%esp
+  801616:	85 c0                	test   %eax,%eax
+  801618:	75 2a                	jne    801644 <set_pgfault_handler+0x5b>
+  80161a:	83 ec 08             	sub    $0x8,%esp
+  80161d:	68 58 16 80 00       	push   $0x801658
+  801622:	6a 00                	push   $0x0
+  801624:	e8 2d fc ff ff       	call   801256 <sys_env_set_pgfault_upcall>
+  801629:	83 c4 10             	add    $0x10,%esp
+  80162c:	85 c0                	test   %eax,%eax
+  80162e:	74 c8                	je     8015f8 <set_pgfault_handler+0xf>
+  801630:	83 ec 04             	sub    $0x4,%esp
+  801633:	68 d4 1d 80 00       	push   $0x801dd4
+  801638:	6a 28                	push   $0x28
+  80163a:	68 c5 1d 80 00       	push   $0x801dc5
+  80163f:	e8 e9 ea ff ff       	call   80012d <_panic>
+  801644:	83 ec 04             	sub    $0x4,%esp
+  801647:	68 af 1d 80 00       	push   $0x801daf
+  80164c:	6a 22                	push   $0x22
+  80164e:	68 c5 1d 80 00       	push   $0x801dc5
+  801653:	e8 d5 ea ff ff       	call   80012d <_panic>
+
+00801658 <_pgfault_upcall>:
+  801658:	54                   	push   %esp
+  801659:	a1 24 20 80 00       	mov    0x802024,%eax
+  80165e:	ff d0                	call   *%eax
+  801660:	83 c4 04             	add    $0x4,%esp
+  801663:	8b 44 24 28          	mov    0x28(%esp),%eax
+  801667:	89 e5                	mov    %esp,%ebp
+  801669:	8b 64 24 30          	mov    0x30(%esp),%esp
+  80166d:	50                   	push   %eax
+  80166e:	89 ec                	mov    %ebp,%esp
+  801670:	83 c4 08             	add    $0x8,%esp
+  801673:	61                   	popa
+  801674:	83 c4 04             	add    $0x4,%esp
+  801677:	9d                   	popf
+  801678:	5c                   	pop    %esp
+  801679:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+  80167d:	c3                   	ret
+
+0080167e <uinfo_envid>:
+  80167e:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  801683:	c3                   	ret
+
+00801684 <uinfo_cpunum>:
+  801684:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  801689:	c3                   	ret
+
+0080168a <uinfo_ticks>:
+  80168a:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  80168f:	c3                   	ret
+
+00801690 <uinfo_nsec>:
+  801690:	55                   	push   %ebp
+  801691:	89 e5                	mov    %esp,%ebp
+  801693:	57                   	push   %edi
+  801694:	56                   	push   %esi
+  801695:	53                   	push   %ebx
+  801696:	83 ec 1c             	sub    $0x1c,%esp
+  801699:	0f 31                	rdtsc
+  80169b:	89 c6                	mov    %eax,%esi
+  80169d:	89 d7                	mov    %edx,%edi
+  80169f:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  8016a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016af:	85 c9                	test   %ecx,%ecx
+  8016b1:	74 5c                	je     80170f <uinfo_nsec+0x7f>
+  8016b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016b8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8016bb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8016be:	52                   	push   %edx
+  8016bf:	51                   	push   %ecx
+  8016c0:	57                   	push   %edi
+  8016c1:	56                   	push   %esi
+  8016c2:	e8 1f 02 00 00       	call   8018e6 <__umoddi3>
+  8016c7:	83 c4 10             	add    $0x10,%esp
+  8016ca:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  8016d0:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  8016d5:	f7 e3                	mul    %ebx
+  8016d7:	01 ca                	add    %ecx,%edx
+  8016d9:	ff 75 e4             	push   -0x1c(%ebp)
+  8016dc:	ff 75 e0             	push   -0x20(%ebp)
+  8016df:	52                   	push   %edx
+  8016e0:	50                   	push   %eax
+  8016e1:	e8 28 01 00 00       	call   80180e <__udivdi3>
+  8016e6:	83 c4 10             	add    $0x10,%esp
+  8016e9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8016ec:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8016ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8016f2:	ff 75 e0             	push   -0x20(%ebp)
+  8016f5:	57                   	push   %edi
+  8016f6:	56                   	push   %esi
+  8016f7:	e8 12 01 00 00       	call   80180e <__udivdi3>
+  8016fc:	83 c4 10             	add    $0x10,%esp
+  8016ff:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801705:	f7 e3                	mul    %ebx
+  801707:	01 ca                	add    %ecx,%edx
+  801709:	03 45 d8             	add    -0x28(%ebp),%eax
+  80170c:	13 55 dc             	adc    -0x24(%ebp),%edx
+  80170f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801712:	5b                   	pop    %ebx
+  801713:	5e                   	pop    %esi
+  801714:	5f                   	pop    %edi
+  801715:	5d                   	pop    %ebp
+  801716:	c3                   	ret
+
+00801717 <bflush>:
+  801717:	a1 40 20 80 00       	mov    0x802040,%eax
+  80171c:	85 c0                	test   %eax,%eax
+  80171e:	75 01                	jne    801721 <bflush+0xa>
+  801720:	c3                   	ret
+  801721:	55                   	push   %ebp
+  801722:	89 e5                	mov    %esp,%ebp
+  801724:	83 ec 10             	sub    $0x10,%esp
+  801727:	50                   	push   %eax
+  801728:	68 44 20 80 00       	push   $0x802044
+  80172d:	e8 3f f5 ff ff       	call   800c71 <sys_cputs>
+  801732:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  801739:	00 00 00 
+  80173c:	83 c4 10             	add    $0x10,%esp
+  80173f:	c9                   	leave
+  801740:	c3                   	ret
+
+00801741 <bputch>:
+  801741:	55                   	push   %ebp
+  801742:	89 e5                	mov    %esp,%ebp
+  801744:	53                   	push   %ebx
+  801745:	83 ec 04             	sub    $0x4,%esp
+  801748:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80174b:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  801751:	8d 42 01             	lea    0x1(%edx),%eax
+  801754:	a3 40 20 80 00       	mov    %eax,0x802040
+  801759:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80175c:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  801762:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801767:	77 08                	ja     801771 <bputch+0x30>
+  801769:	83 03 01             	addl   $0x1,(%ebx)
+  80176c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80176f:	c9                   	leave
+  801770:	c3                   	ret
+  801771:	e8 a1 ff ff ff       	call   801717 <bflush>
+  801776:	eb f1                	jmp    801769 <bputch+0x28>
+
+00801778 <vbprintf>:
+  801778:	55                   	push   %ebp
+  801779:	89 e5                	mov    %esp,%ebp
+  80177b:	83 ec 18             	sub    $0x18,%esp
+  80177e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801785:	ff 75 0c             	push   0xc(%ebp)
+  801788:	ff 75 08             	push   0x8(%ebp)
+  80178b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80178e:	50                   	push   %eax
+  80178f:	68 41 17 80 00       	push   $0x801741
+  801794:	e8 6b eb ff ff       	call   800304 <vprintfmt>
+  801799:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80179c:	c9                   	leave
+  80179d:	c3                   	ret
+
+0080179e <bprintf>:
+  80179e:	55                   	push   %ebp
+  80179f:	89 e5                	mov    %esp,%ebp
+  8017a1:	83 ec 10             	sub    $0x10,%esp
+  8017a4:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8017a7:	50                   	push   %eax
+  8017a8:	ff 75 08             	push   0x8(%ebp)
+  8017ab:	e8 c8 ff ff ff       	call   801778 <vbprintf>
+  8017b0:	c9                   	leave
+  8017b1:	c3                   	ret
+
+008017b2 <bwrite>:
+  8017b2:	55                   	push   %ebp
+  8017b3:	89 e5                	mov    %esp,%ebp
+  8017b5:	53                   	push   %ebx
+  8017b6:	83 ec 04             	sub    $0x4,%esp
+  8017b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8017bc:	89 d8                	mov    %ebx,%eax
+  8017be:	03 05 40 20 80 00    	add    0x802040,%eax
+  8017c4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8017c9:	76 0d                	jbe    8017d8 <bwrite+0x26>
+  8017cb:	e8 47 ff ff ff       	call   801717 <bflush>
+  8017d0:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  8017d6:	77 25                	ja     8017fd <bwrite+0x4b>
+  8017d8:	83 ec 04             	sub    $0x4,%esp
+  8017db:	53                   	push   %ebx
+  8017dc:	ff 75 08             	push   0x8(%ebp)
+  8017df:	a1 40 20 80 00       	mov    0x802040,%eax
+  8017e4:	05 44 20 80 00       	add    $0x802044,%eax
+  8017e9:	50                   	push   %eax
+  8017ea:	e8 80 f2 ff ff       	call   800a6f <memcpy>
+  8017ef:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  8017f5:	83 c4 10             	add    $0x10,%esp
+  8017f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017fb:	c9                   	leave
+  8017fc:	c3                   	ret
+  8017fd:	83 ec 08             	sub    $0x8,%esp
+  801800:	53                   	push   %ebx
+  801801:	ff 75 08             	push   0x8(%ebp)
+  801804:	e8 68 f4 ff ff       	call   800c71 <sys_cputs>
+  801809:	83 c4 10             	add    $0x10,%esp
+  80180c:	eb ea                	jmp    8017f8 <bwrite+0x46>
+
+0080180e <__udivdi3>:
+  80180e:	57                   	push   %edi
+  80180f:	56                   	push   %esi
+  801810:	53                   	push   %ebx
+  801811:	83 ec 20             	sub    $0x20,%esp
+  801814:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801818:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80181c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801820:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801824:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801828:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80182c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801830:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801834:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801838:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  80183c:	89 d1                	mov    %edx,%ecx
+  80183e:	09 c1                	or     %eax,%ecx
+  801840:	0f 84 91 00 00 00    	je     8018d7 <__udivdi3+0xc9>
+  801846:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80184d:	00 
+  80184e:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801855:	00 
+  801856:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80185b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801860:	ba 00 00 00 00       	mov    $0x0,%edx
+  801865:	eb 08                	jmp    80186f <__udivdi3+0x61>
+  801867:	83 e9 01             	sub    $0x1,%ecx
+  80186a:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80186d:	74 68                	je     8018d7 <__udivdi3+0xc9>
+  80186f:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801873:	01 c0                	add    %eax,%eax
+  801875:	89 c6                	mov    %eax,%esi
+  801877:	89 d7                	mov    %edx,%edi
+  801879:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80187d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801881:	0f ad d0             	shrd   %cl,%edx,%eax
+  801884:	d3 ea                	shr    %cl,%edx
+  801886:	f6 c1 20             	test   $0x20,%cl
+  801889:	74 04                	je     80188f <__udivdi3+0x81>
+  80188b:	89 d0                	mov    %edx,%eax
+  80188d:	31 d2                	xor    %edx,%edx
+  80188f:	83 e0 01             	and    $0x1,%eax
+  801892:	89 04 24             	mov    %eax,(%esp)
+  801895:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80189c:	00 
+  80189d:	8b 04 24             	mov    (%esp),%eax
+  8018a0:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8018a4:	09 f0                	or     %esi,%eax
+  8018a6:	09 fa                	or     %edi,%edx
+  8018a8:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8018ac:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8018b0:	39 f0                	cmp    %esi,%eax
+  8018b2:	89 d3                	mov    %edx,%ebx
+  8018b4:	19 fb                	sbb    %edi,%ebx
+  8018b6:	72 af                	jb     801867 <__udivdi3+0x59>
+  8018b8:	29 f0                	sub    %esi,%eax
+  8018ba:	19 fa                	sbb    %edi,%edx
+  8018bc:	89 cf                	mov    %ecx,%edi
+  8018be:	c1 ef 05             	shr    $0x5,%edi
+  8018c1:	83 e7 01             	and    $0x1,%edi
+  8018c4:	89 fe                	mov    %edi,%esi
+  8018c6:	83 f6 01             	xor    $0x1,%esi
+  8018c9:	d3 e6                	shl    %cl,%esi
+  8018cb:	d3 e7                	shl    %cl,%edi
+  8018cd:	09 74 24 18          	or     %esi,0x18(%esp)
+  8018d1:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8018d5:	eb 90                	jmp    801867 <__udivdi3+0x59>
+  8018d7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8018db:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8018df:	83 c4 20             	add    $0x20,%esp
+  8018e2:	5b                   	pop    %ebx
+  8018e3:	5e                   	pop    %esi
+  8018e4:	5f                   	pop    %edi
+  8018e5:	c3                   	ret
+
+008018e6 <__umoddi3>:
+  8018e6:	55                   	push   %ebp
+  8018e7:	57                   	push   %edi
+  8018e8:	56                   	push   %esi
+  8018e9:	53                   	push   %ebx
+  8018ea:	83 ec 1c             	sub    $0x1c,%esp
+  8018ed:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8018f1:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8018f5:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8018f9:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8018fd:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801901:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801905:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801909:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80190d:	89 d6                	mov    %edx,%esi
+  80190f:	09 c6                	or     %eax,%esi
+  801911:	74 6c                	je     80197f <__umoddi3+0x99>
+  801913:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801918:	b8 00 00 00 00       	mov    $0x0,%eax
+  80191d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801922:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801926:	eb 0e                	jmp    801936 <__umoddi3+0x50>
+  801928:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  80192d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801931:	83 fe ff             	cmp    $0xffffffff,%esi
+  801934:	74 49                	je     80197f <__umoddi3+0x99>
+  801936:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80193a:	01 c0                	add    %eax,%eax
+  80193c:	89 c3                	mov    %eax,%ebx
+  80193e:	89 d6                	mov    %edx,%esi
+  801940:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801944:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801948:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  80194d:	0f ad d0             	shrd   %cl,%edx,%eax
+  801950:	d3 ea                	shr    %cl,%edx
+  801952:	f6 c1 20             	test   $0x20,%cl
+  801955:	74 04                	je     80195b <__umoddi3+0x75>
+  801957:	89 d0                	mov    %edx,%eax
+  801959:	31 d2                	xor    %edx,%edx
+  80195b:	83 e0 01             	and    $0x1,%eax
+  80195e:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801963:	89 ea                	mov    %ebp,%edx
+  801965:	09 d8                	or     %ebx,%eax
+  801967:	09 f2                	or     %esi,%edx
+  801969:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  80196d:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801971:	39 d8                	cmp    %ebx,%eax
+  801973:	89 d1                	mov    %edx,%ecx
+  801975:	19 f1                	sbb    %esi,%ecx
+  801977:	72 af                	jb     801928 <__umoddi3+0x42>
+  801979:	29 d8                	sub    %ebx,%eax
+  80197b:	19 f2                	sbb    %esi,%edx
+  80197d:	eb a9                	jmp    801928 <__umoddi3+0x42>
+  80197f:	83 c4 1c             	add    $0x1c,%esp
+  801982:	5b                   	pop    %ebx
+  801983:	5e                   	pop    %esi
+  801984:	5f                   	pop    %edi
+  801985:	5d                   	pop    %ebp
+  801986:	c3                   	ret
+
+00801987 <__divdi3>:
+  801987:	53                   	push   %ebx
+  801988:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80198c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801990:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801994:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801998:	85 d2                	test   %edx,%edx
+  80199a:	78 12                	js     8019ae <__divdi3+0x27>
+  80199c:	85 db                	test   %ebx,%ebx
+  80199e:	78 2e                	js     8019ce <__divdi3+0x47>
+  8019a0:	53                   	push   %ebx
+  8019a1:	51                   	push   %ecx
+  8019a2:	52                   	push   %edx
+  8019a3:	50                   	push   %eax
+  8019a4:	e8 65 fe ff ff       	call   80180e <__udivdi3>
+  8019a9:	83 c4 10             	add    $0x10,%esp
+  8019ac:	eb 1e                	jmp    8019cc <__divdi3+0x45>
+  8019ae:	f7 d8                	neg    %eax
+  8019b0:	83 d2 00             	adc    $0x0,%edx
+  8019b3:	f7 da                	neg    %edx
+  8019b5:	85 db                	test   %ebx,%ebx
+  8019b7:	78 2a                	js     8019e3 <__divdi3+0x5c>
+  8019b9:	53                   	push   %ebx
+  8019ba:	51                   	push   %ecx
+  8019bb:	52                   	push   %edx
+  8019bc:	50                   	push   %eax
+  8019bd:	e8 4c fe ff ff       	call   80180e <__udivdi3>
+  8019c2:	83 c4 10             	add    $0x10,%esp
+  8019c5:	f7 d8                	neg    %eax
+  8019c7:	83 d2 00             	adc    $0x0,%edx
+  8019ca:	f7 da                	neg    %edx
+  8019cc:	5b                   	pop    %ebx
+  8019cd:	c3                   	ret
+  8019ce:	f7 d9                	neg    %ecx
+  8019d0:	83 d3 00             	adc    $0x0,%ebx
+  8019d3:	f7 db                	neg    %ebx
+  8019d5:	53                   	push   %ebx
+  8019d6:	51                   	push   %ecx
+  8019d7:	52                   	push   %edx
+  8019d8:	50                   	push   %eax
+  8019d9:	e8 30 fe ff ff       	call   80180e <__udivdi3>
+  8019de:	83 c4 10             	add    $0x10,%esp
+  8019e1:	eb e2                	jmp    8019c5 <__divdi3+0x3e>
+  8019e3:	f7 d9                	neg    %ecx
+  8019e5:	83 d3 00             	adc    $0x0,%ebx
+  8019e8:	f7 db                	neg    %ebx
+  8019ea:	53                   	push   %ebx
+  8019eb:	51                   	push   %ecx
+  8019ec:	52                   	push   %edx
+  8019ed:	50                   	push   %eax
+  8019ee:	e8 1b fe ff ff       	call   80180e <__udivdi3>
+  8019f3:	83 c4 10             	add    $0x10,%esp
+  8019f6:	eb d4                	jmp    8019cc <__divdi3+0x45>
+
+008019f8 <__moddi3>:
+  8019f8:	55                   	push   %ebp
+  8019f9:	57                   	push   %edi
+  8019fa:	56                   	push   %esi
+  8019fb:	53                   	push   %ebx
+  8019fc:	83 ec 14             	sub    $0x14,%esp
+  8019ff:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801a03:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801a07:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801a0b:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801a0f:	85 ed                	test   %ebp,%ebp
+  801a11:	78 2b                	js     801a3e <__moddi3+0x46>
+  801a13:	89 c6                	mov    %eax,%esi
+  801a15:	f7 de                	neg    %esi
+  801a17:	89 34 24             	mov    %esi,(%esp)
+  801a1a:	89 d6                	mov    %edx,%esi
+  801a1c:	83 d6 00             	adc    $0x0,%esi
+  801a1f:	f7 de                	neg    %esi
+  801a21:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801a25:	8b 34 24             	mov    (%esp),%esi
+  801a28:	0f 48 f0             	cmovs  %eax,%esi
+  801a2b:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801a30:	52                   	push   %edx
+  801a31:	56                   	push   %esi
+  801a32:	55                   	push   %ebp
+  801a33:	57                   	push   %edi
+  801a34:	e8 ad fe ff ff       	call   8018e6 <__umoddi3>
+  801a39:	83 c4 10             	add    $0x10,%esp
+  801a3c:	eb 3c                	jmp    801a7a <__moddi3+0x82>
+  801a3e:	89 c3                	mov    %eax,%ebx
+  801a40:	f7 db                	neg    %ebx
+  801a42:	89 d1                	mov    %edx,%ecx
+  801a44:	83 d1 00             	adc    $0x0,%ecx
+  801a47:	f7 d9                	neg    %ecx
+  801a49:	0f 49 c3             	cmovns %ebx,%eax
+  801a4c:	89 04 24             	mov    %eax,(%esp)
+  801a4f:	0f 49 d1             	cmovns %ecx,%edx
+  801a52:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801a56:	ff 74 24 04          	push   0x4(%esp)
+  801a5a:	ff 74 24 04          	push   0x4(%esp)
+  801a5e:	89 f8                	mov    %edi,%eax
+  801a60:	89 ea                	mov    %ebp,%edx
+  801a62:	f7 d8                	neg    %eax
+  801a64:	83 d2 00             	adc    $0x0,%edx
+  801a67:	f7 da                	neg    %edx
+  801a69:	52                   	push   %edx
+  801a6a:	50                   	push   %eax
+  801a6b:	e8 76 fe ff ff       	call   8018e6 <__umoddi3>
+  801a70:	83 c4 10             	add    $0x10,%esp
+  801a73:	f7 d8                	neg    %eax
+  801a75:	83 d2 00             	adc    $0x0,%edx
+  801a78:	f7 da                	neg    %edx
+  801a7a:	83 c4 14             	add    $0x14,%esp
+  801a7d:	5b                   	pop    %ebx
+  801a7e:	5e                   	pop    %esi
+  801a7f:	5f                   	pop    %edi
+  801a80:	5d                   	pop    %ebp
+  801a81:	c3                   	ret
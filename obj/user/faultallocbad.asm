@@ -0,0 +1,2668 @@
+
+obj/user/faultallocbad:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+  80003f:	53                   	push   %ebx
+  800040:	68 80 1a 80 00       	push   $0x801a80
+  800045:	e8 ae 01 00 00       	call   8001f8 <cprintf>
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 41 0f 00 00       	call   800f9f <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+  800065:	53                   	push   %ebx
+  800066:	68 cc 1a 80 00       	push   $0x801acc
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 1e 07 00 00       	call   800791 <snprintf>
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 a0 1a 80 00       	push   $0x801aa0
+  800085:	6a 0f                	push   $0xf
+  800087:	68 8a 1a 80 00       	push   $0x801a8a
+  80008c:	e8 87 00 00 00       	call   800118 <_panic>
+
+00800091 <umain>:
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 33 15 00 00       	call   8015d4 <set_pgfault_handler>
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	6a 04                	push   $0x4
+  8000a6:	68 ef be ad de       	push   $0xdeadbeef
+  8000ab:	e8 ac 0b 00 00       	call   800c5c <sys_cputs>
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000c0:	e8 a4 15 00 00       	call   801669 <uinfo_envid>
+  8000c5:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8000ca:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8000d0:	05 00 00 00 ed       	add    $0xed000000,%eax
+  8000d5:	a3 20 20 80 00       	mov    %eax,0x802020
+  8000da:	85 db                	test   %ebx,%ebx
+  8000dc:	7e 07                	jle    8000e5 <libmain+0x30>
+  8000de:	8b 06                	mov    (%esi),%eax
+  8000e0:	a3 00 20 80 00       	mov    %eax,0x802000
+  8000e5:	83 ec 08             	sub    $0x8,%esp
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	e8 a2 ff ff ff       	call   800091 <umain>
+  8000ef:	e8 0a 00 00 00       	call   8000fe <exit>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <exit>:
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	83 ec 08             	sub    $0x8,%esp
+  800104:	e8 f9 15 00 00       	call   801702 <bflush>
+  800109:	83 ec 0c             	sub    $0xc,%esp
+  80010c:	6a 00                	push   $0x0
+  80010e:	e8 17 0c 00 00       	call   800d2a <sys_env_destroy>
+  800113:	83 c4 10             	add    $0x10,%esp
+  800116:	c9                   	leave
+  800117:	c3                   	ret
+
+00800118 <_panic>:
+  800118:	55                   	push   %ebp
+  800119:	89 e5                	mov    %esp,%ebp
+  80011b:	56                   	push   %esi
+  80011c:	53                   	push   %ebx
+  80011d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800120:	e8 dd 15 00 00       	call   801702 <bflush>
+  800125:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  80012b:	e8 85 0c 00 00       	call   800db5 <sys_getenvid>
+  800130:	83 ec 0c             	sub    $0xc,%esp
+  800133:	ff 75 0c             	push   0xc(%ebp)
+  800136:	ff 75 08             	push   0x8(%ebp)
+  800139:	56                   	push   %esi
+  80013a:	50                   	push   %eax
+  80013b:	68 f8 1a 80 00       	push   $0x801af8
+  800140:	e8 b3 00 00 00       	call   8001f8 <cprintf>
+  800145:	83 c4 18             	add    $0x18,%esp
+  800148:	53                   	push   %ebx
+  800149:	ff 75 10             	push   0x10(%ebp)
+  80014c:	e8 56 00 00 00       	call   8001a7 <vcprintf>
+  800151:	c7 04 24 88 1a 80 00 	movl   $0x801a88,(%esp)
+  800158:	e8 9b 00 00 00       	call   8001f8 <cprintf>
+  80015d:	83 c4 10             	add    $0x10,%esp
+  800160:	cc                   	int3
+  800161:	eb fd                	jmp    800160 <_panic+0x48>
+
+00800163 <putch>:
+  800163:	55                   	push   %ebp
+  800164:	89 e5                	mov    %esp,%ebp
+  800166:	53                   	push   %ebx
+  800167:	83 ec 04             	sub    $0x4,%esp
+  80016a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80016d:	8b 13                	mov    (%ebx),%edx
+  80016f:	8d 42 01             	lea    0x1(%edx),%eax
+  800172:	89 03                	mov    %eax,(%ebx)
+  800174:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800177:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80017b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800180:	74 09                	je     80018b <putch+0x28>
+  800182:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800186:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800189:	c9                   	leave
+  80018a:	c3                   	ret
+  80018b:	83 ec 08             	sub    $0x8,%esp
+  80018e:	68 ff 00 00 00       	push   $0xff
+  800193:	8d 43 08             	lea    0x8(%ebx),%eax
+  800196:	50                   	push   %eax
+  800197:	e8 c0 0a 00 00       	call   800c5c <sys_cputs>
+  80019c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001a2:	83 c4 10             	add    $0x10,%esp
+  8001a5:	eb db                	jmp    800182 <putch+0x1f>
+
+008001a7 <vcprintf>:
+  8001a7:	55                   	push   %ebp
+  8001a8:	89 e5                	mov    %esp,%ebp
+  8001aa:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8001b0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001b7:	00 00 00 
+  8001ba:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001c1:	00 00 00 
+  8001c4:	ff 75 0c             	push   0xc(%ebp)
+  8001c7:	ff 75 08             	push   0x8(%ebp)
+  8001ca:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001d0:	50                   	push   %eax
+  8001d1:	68 63 01 80 00       	push   $0x800163
+  8001d6:	e8 14 01 00 00       	call   8002ef <vprintfmt>
+  8001db:	83 c4 08             	add    $0x8,%esp
+  8001de:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001e4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ea:	50                   	push   %eax
+  8001eb:	e8 6c 0a 00 00       	call   800c5c <sys_cputs>
+  8001f0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f6:	c9                   	leave
+  8001f7:	c3                   	ret
+
+008001f8 <cprintf>:
+  8001f8:	55                   	push   %ebp
+  8001f9:	89 e5                	mov    %esp,%ebp
+  8001fb:	83 ec 10             	sub    $0x10,%esp
+  8001fe:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800201:	50                   	push   %eax
+  800202:	ff 75 08             	push   0x8(%ebp)
+  800205:	e8 9d ff ff ff       	call   8001a7 <vcprintf>
+  80020a:	c9                   	leave
+  80020b:	c3                   	ret
+
+0080020c <printnum>:
+  80020c:	55                   	push   %ebp
+  80020d:	89 e5                	mov    %esp,%ebp
+  80020f:	57                   	push   %edi
+  800210:	56                   	push   %esi
+  800211:	53                   	push   %ebx
+  800212:	83 ec 1c             	sub    $0x1c,%esp
+  800215:	89 c7                	mov    %eax,%edi
+  800217:	89 d6                	mov    %edx,%esi
+  800219:	8b 45 08             	mov    0x8(%ebp),%eax
+  80021c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80021f:	89 d1                	mov    %edx,%ecx
+  800221:	89 c2                	mov    %eax,%edx
+  800223:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800226:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800229:	8b 45 10             	mov    0x10(%ebp),%eax
+  80022c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80022f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800232:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800239:	39 c2                	cmp    %eax,%edx
+  80023b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80023e:	72 3e                	jb     80027e <printnum+0x72>
+  800240:	83 ec 0c             	sub    $0xc,%esp
+  800243:	ff 75 18             	push   0x18(%ebp)
+  800246:	83 eb 01             	sub    $0x1,%ebx
+  800249:	53                   	push   %ebx
+  80024a:	50                   	push   %eax
+  80024b:	83 ec 08             	sub    $0x8,%esp
+  80024e:	ff 75 e4             	push   -0x1c(%ebp)
+  800251:	ff 75 e0             	push   -0x20(%ebp)
+  800254:	ff 75 dc             	push   -0x24(%ebp)
+  800257:	ff 75 d8             	push   -0x28(%ebp)
+  80025a:	e8 9a 15 00 00       	call   8017f9 <__udivdi3>
+  80025f:	83 c4 18             	add    $0x18,%esp
+  800262:	52                   	push   %edx
+  800263:	50                   	push   %eax
+  800264:	89 f2                	mov    %esi,%edx
+  800266:	89 f8                	mov    %edi,%eax
+  800268:	e8 9f ff ff ff       	call   80020c <printnum>
+  80026d:	83 c4 20             	add    $0x20,%esp
+  800270:	eb 13                	jmp    800285 <printnum+0x79>
+  800272:	83 ec 08             	sub    $0x8,%esp
+  800275:	56                   	push   %esi
+  800276:	ff 75 18             	push   0x18(%ebp)
+  800279:	ff d7                	call   *%edi
+  80027b:	83 c4 10             	add    $0x10,%esp
+  80027e:	83 eb 01             	sub    $0x1,%ebx
+  800281:	85 db                	test   %ebx,%ebx
+  800283:	7f ed                	jg     800272 <printnum+0x66>
+  800285:	83 ec 08             	sub    $0x8,%esp
+  800288:	56                   	push   %esi
+  800289:	83 ec 04             	sub    $0x4,%esp
+  80028c:	ff 75 e4             	push   -0x1c(%ebp)
+  80028f:	ff 75 e0             	push   -0x20(%ebp)
+  800292:	ff 75 dc             	push   -0x24(%ebp)
+  800295:	ff 75 d8             	push   -0x28(%ebp)
+  800298:	e8 34 16 00 00       	call   8018d1 <__umoddi3>
+  80029d:	83 c4 14             	add    $0x14,%esp
+  8002a0:	0f be 80 1b 1b 80 00 	movsbl 0x801b1b(%eax),%eax
+  8002a7:	50                   	push   %eax
+  8002a8:	ff d7                	call   *%edi
+  8002aa:	83 c4 10             	add    $0x10,%esp
+  8002ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b0:	5b                   	pop    %ebx
+  8002b1:	5e                   	pop    %esi
+  8002b2:	5f                   	pop    %edi
+  8002b3:	5d                   	pop    %ebp
+  8002b4:	c3                   	ret
+
+008002b5 <sprintputch>:
+  8002b5:	55                   	push   %ebp
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002bb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8002bf:	8b 10                	mov    (%eax),%edx
+  8002c1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002c4:	73 0a                	jae    8002d0 <sprintputch+0x1b>
+  8002c6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002c9:	89 08                	mov    %ecx,(%eax)
+  8002cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ce:	88 02                	mov    %al,(%edx)
+  8002d0:	5d                   	pop    %ebp
+  8002d1:	c3                   	ret
+
+008002d2 <printfmt>:
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	83 ec 08             	sub    $0x8,%esp
+  8002d8:	8d 45 14             	lea    0x14(%ebp),%eax
+  8002db:	50                   	push   %eax
+  8002dc:	ff 75 10             	push   0x10(%ebp)
+  8002df:	ff 75 0c             	push   0xc(%ebp)
+  8002e2:	ff 75 08             	push   0x8(%ebp)
+  8002e5:	e8 05 00 00 00       	call   8002ef <vprintfmt>
+  8002ea:	83 c4 10             	add    $0x10,%esp
+  8002ed:	c9                   	leave
+  8002ee:	c3                   	ret
+
+008002ef <vprintfmt>:
+  8002ef:	55                   	push   %ebp
+  8002f0:	89 e5                	mov    %esp,%ebp
+  8002f2:	57                   	push   %edi
+  8002f3:	56                   	push   %esi
+  8002f4:	53                   	push   %ebx
+  8002f5:	83 ec 2c             	sub    $0x2c,%esp
+  8002f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002fe:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800301:	eb 0a                	jmp    80030d <vprintfmt+0x1e>
+  800303:	83 ec 08             	sub    $0x8,%esp
+  800306:	53                   	push   %ebx
+  800307:	50                   	push   %eax
+  800308:	ff d6                	call   *%esi
+  80030a:	83 c4 10             	add    $0x10,%esp
+  80030d:	83 c7 01             	add    $0x1,%edi
+  800310:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800314:	83 f8 25             	cmp    $0x25,%eax
+  800317:	74 0c                	je     800325 <vprintfmt+0x36>
+  800319:	85 c0                	test   %eax,%eax
+  80031b:	75 e6                	jne    800303 <vprintfmt+0x14>
+  80031d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800320:	5b                   	pop    %ebx
+  800321:	5e                   	pop    %esi
+  800322:	5f                   	pop    %edi
+  800323:	5d                   	pop    %ebp
+  800324:	c3                   	ret
+  800325:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800329:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800330:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800337:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  80033e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800343:	8d 47 01             	lea    0x1(%edi),%eax
+  800346:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800349:	0f b6 17             	movzbl (%edi),%edx
+  80034c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80034f:	3c 55                	cmp    $0x55,%al
+  800351:	0f 87 cf 03 00 00    	ja     800726 <vprintfmt+0x437>
+  800357:	0f b6 c0             	movzbl %al,%eax
+  80035a:	ff 24 85 e0 1b 80 00 	jmp    *0x801be0(,%eax,4)
+  800361:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800364:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800368:	eb d9                	jmp    800343 <vprintfmt+0x54>
+  80036a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80036d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800371:	eb d0                	jmp    800343 <vprintfmt+0x54>
+  800373:	0f b6 d2             	movzbl %dl,%edx
+  800376:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800379:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800381:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800384:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800388:	0f be 17             	movsbl (%edi),%edx
+  80038b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80038e:	83 f9 09             	cmp    $0x9,%ecx
+  800391:	77 55                	ja     8003e8 <vprintfmt+0xf9>
+  800393:	83 c7 01             	add    $0x1,%edi
+  800396:	eb e9                	jmp    800381 <vprintfmt+0x92>
+  800398:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039b:	8b 00                	mov    (%eax),%eax
+  80039d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8003a6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8003a9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003ac:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003b0:	79 91                	jns    800343 <vprintfmt+0x54>
+  8003b2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003bf:	eb 82                	jmp    800343 <vprintfmt+0x54>
+  8003c1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003c4:	85 d2                	test   %edx,%edx
+  8003c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cb:	0f 49 c2             	cmovns %edx,%eax
+  8003ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003d4:	e9 6a ff ff ff       	jmp    800343 <vprintfmt+0x54>
+  8003d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003dc:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8003e3:	e9 5b ff ff ff       	jmp    800343 <vprintfmt+0x54>
+  8003e8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ee:	eb bc                	jmp    8003ac <vprintfmt+0xbd>
+  8003f0:	83 c1 01             	add    $0x1,%ecx
+  8003f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003f6:	e9 48 ff ff ff       	jmp    800343 <vprintfmt+0x54>
+  8003fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fe:	8d 78 04             	lea    0x4(%eax),%edi
+  800401:	83 ec 08             	sub    $0x8,%esp
+  800404:	53                   	push   %ebx
+  800405:	ff 30                	push   (%eax)
+  800407:	ff d6                	call   *%esi
+  800409:	83 c4 10             	add    $0x10,%esp
+  80040c:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80040f:	e9 b1 02 00 00       	jmp    8006c5 <vprintfmt+0x3d6>
+  800414:	8b 45 14             	mov    0x14(%ebp),%eax
+  800417:	8d 78 04             	lea    0x4(%eax),%edi
+  80041a:	8b 10                	mov    (%eax),%edx
+  80041c:	89 d0                	mov    %edx,%eax
+  80041e:	f7 d8                	neg    %eax
+  800420:	0f 48 c2             	cmovs  %edx,%eax
+  800423:	83 f8 08             	cmp    $0x8,%eax
+  800426:	7f 23                	jg     80044b <vprintfmt+0x15c>
+  800428:	8b 14 85 40 1d 80 00 	mov    0x801d40(,%eax,4),%edx
+  80042f:	85 d2                	test   %edx,%edx
+  800431:	74 18                	je     80044b <vprintfmt+0x15c>
+  800433:	52                   	push   %edx
+  800434:	68 3c 1b 80 00       	push   $0x801b3c
+  800439:	53                   	push   %ebx
+  80043a:	56                   	push   %esi
+  80043b:	e8 92 fe ff ff       	call   8002d2 <printfmt>
+  800440:	83 c4 10             	add    $0x10,%esp
+  800443:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800446:	e9 7a 02 00 00       	jmp    8006c5 <vprintfmt+0x3d6>
+  80044b:	50                   	push   %eax
+  80044c:	68 33 1b 80 00       	push   $0x801b33
+  800451:	53                   	push   %ebx
+  800452:	56                   	push   %esi
+  800453:	e8 7a fe ff ff       	call   8002d2 <printfmt>
+  800458:	83 c4 10             	add    $0x10,%esp
+  80045b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80045e:	e9 62 02 00 00       	jmp    8006c5 <vprintfmt+0x3d6>
+  800463:	8b 45 14             	mov    0x14(%ebp),%eax
+  800466:	83 c0 04             	add    $0x4,%eax
+  800469:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80046c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046f:	8b 08                	mov    (%eax),%ecx
+  800471:	85 c9                	test   %ecx,%ecx
+  800473:	b8 2c 1b 80 00       	mov    $0x801b2c,%eax
+  800478:	0f 45 c1             	cmovne %ecx,%eax
+  80047b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80047e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800482:	7e 06                	jle    80048a <vprintfmt+0x19b>
+  800484:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800488:	75 0b                	jne    800495 <vprintfmt+0x1a6>
+  80048a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80048d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800490:	89 75 08             	mov    %esi,0x8(%ebp)
+  800493:	eb 5c                	jmp    8004f1 <vprintfmt+0x202>
+  800495:	83 ec 08             	sub    $0x8,%esp
+  800498:	ff 75 d0             	push   -0x30(%ebp)
+  80049b:	ff 75 cc             	push   -0x34(%ebp)
+  80049e:	e8 87 03 00 00       	call   80082a <strnlen>
+  8004a3:	89 c2                	mov    %eax,%edx
+  8004a5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004a8:	29 d0                	sub    %edx,%eax
+  8004aa:	83 c4 10             	add    $0x10,%esp
+  8004ad:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004b4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004b7:	89 c6                	mov    %eax,%esi
+  8004b9:	eb 0e                	jmp    8004c9 <vprintfmt+0x1da>
+  8004bb:	83 ec 08             	sub    $0x8,%esp
+  8004be:	53                   	push   %ebx
+  8004bf:	57                   	push   %edi
+  8004c0:	ff 55 08             	call   *0x8(%ebp)
+  8004c3:	83 ee 01             	sub    $0x1,%esi
+  8004c6:	83 c4 10             	add    $0x10,%esp
+  8004c9:	85 f6                	test   %esi,%esi
+  8004cb:	7f ee                	jg     8004bb <vprintfmt+0x1cc>
+  8004cd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d3:	85 c0                	test   %eax,%eax
+  8004d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004da:	0f 49 d0             	cmovns %eax,%edx
+  8004dd:	29 d0                	sub    %edx,%eax
+  8004df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e2:	eb a6                	jmp    80048a <vprintfmt+0x19b>
+  8004e4:	83 ec 08             	sub    $0x8,%esp
+  8004e7:	53                   	push   %ebx
+  8004e8:	52                   	push   %edx
+  8004e9:	ff 55 08             	call   *0x8(%ebp)
+  8004ec:	83 c4 10             	add    $0x10,%esp
+  8004ef:	89 f1                	mov    %esi,%ecx
+  8004f1:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004f4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004f8:	0f be d0             	movsbl %al,%edx
+  8004fb:	85 d2                	test   %edx,%edx
+  8004fd:	74 28                	je     800527 <vprintfmt+0x238>
+  8004ff:	85 ff                	test   %edi,%edi
+  800501:	78 05                	js     800508 <vprintfmt+0x219>
+  800503:	83 ef 01             	sub    $0x1,%edi
+  800506:	78 30                	js     800538 <vprintfmt+0x249>
+  800508:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80050c:	74 d6                	je     8004e4 <vprintfmt+0x1f5>
+  80050e:	0f be c0             	movsbl %al,%eax
+  800511:	83 e8 20             	sub    $0x20,%eax
+  800514:	83 f8 5e             	cmp    $0x5e,%eax
+  800517:	76 cb                	jbe    8004e4 <vprintfmt+0x1f5>
+  800519:	83 ec 08             	sub    $0x8,%esp
+  80051c:	53                   	push   %ebx
+  80051d:	6a 3f                	push   $0x3f
+  80051f:	ff 55 08             	call   *0x8(%ebp)
+  800522:	83 c4 10             	add    $0x10,%esp
+  800525:	eb c8                	jmp    8004ef <vprintfmt+0x200>
+  800527:	8b 75 08             	mov    0x8(%ebp),%esi
+  80052a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80052d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800530:	01 d0                	add    %edx,%eax
+  800532:	29 c8                	sub    %ecx,%eax
+  800534:	89 c7                	mov    %eax,%edi
+  800536:	eb 13                	jmp    80054b <vprintfmt+0x25c>
+  800538:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053b:	eb ed                	jmp    80052a <vprintfmt+0x23b>
+  80053d:	83 ec 08             	sub    $0x8,%esp
+  800540:	53                   	push   %ebx
+  800541:	6a 20                	push   $0x20
+  800543:	ff d6                	call   *%esi
+  800545:	83 ef 01             	sub    $0x1,%edi
+  800548:	83 c4 10             	add    $0x10,%esp
+  80054b:	85 ff                	test   %edi,%edi
+  80054d:	7f ee                	jg     80053d <vprintfmt+0x24e>
+  80054f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800552:	89 45 14             	mov    %eax,0x14(%ebp)
+  800555:	e9 6b 01 00 00       	jmp    8006c5 <vprintfmt+0x3d6>
+  80055a:	83 f9 01             	cmp    $0x1,%ecx
+  80055d:	7f 1f                	jg     80057e <vprintfmt+0x28f>
+  80055f:	85 c9                	test   %ecx,%ecx
+  800561:	74 67                	je     8005ca <vprintfmt+0x2db>
+  800563:	8b 45 14             	mov    0x14(%ebp),%eax
+  800566:	8b 00                	mov    (%eax),%eax
+  800568:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056b:	89 c1                	mov    %eax,%ecx
+  80056d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800570:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800573:	8b 45 14             	mov    0x14(%ebp),%eax
+  800576:	8d 40 04             	lea    0x4(%eax),%eax
+  800579:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057c:	eb 17                	jmp    800595 <vprintfmt+0x2a6>
+  80057e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800581:	8b 50 04             	mov    0x4(%eax),%edx
+  800584:	8b 00                	mov    (%eax),%eax
+  800586:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800589:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80058c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058f:	8d 40 08             	lea    0x8(%eax),%eax
+  800592:	89 45 14             	mov    %eax,0x14(%ebp)
+  800595:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800598:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80059b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005a0:	85 c9                	test   %ecx,%ecx
+  8005a2:	0f 89 03 01 00 00    	jns    8006ab <vprintfmt+0x3bc>
+  8005a8:	83 ec 08             	sub    $0x8,%esp
+  8005ab:	53                   	push   %ebx
+  8005ac:	6a 2d                	push   $0x2d
+  8005ae:	ff d6                	call   *%esi
+  8005b0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005b6:	f7 da                	neg    %edx
+  8005b8:	83 d1 00             	adc    $0x0,%ecx
+  8005bb:	f7 d9                	neg    %ecx
+  8005bd:	83 c4 10             	add    $0x10,%esp
+  8005c0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005c5:	e9 e1 00 00 00       	jmp    8006ab <vprintfmt+0x3bc>
+  8005ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cd:	8b 00                	mov    (%eax),%eax
+  8005cf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005d2:	89 c1                	mov    %eax,%ecx
+  8005d4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005d7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e3:	eb b0                	jmp    800595 <vprintfmt+0x2a6>
+  8005e5:	83 f9 01             	cmp    $0x1,%ecx
+  8005e8:	7f 1e                	jg     800608 <vprintfmt+0x319>
+  8005ea:	85 c9                	test   %ecx,%ecx
+  8005ec:	74 32                	je     800620 <vprintfmt+0x331>
+  8005ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f1:	8b 10                	mov    (%eax),%edx
+  8005f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fe:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800603:	e9 a3 00 00 00       	jmp    8006ab <vprintfmt+0x3bc>
+  800608:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060b:	8b 10                	mov    (%eax),%edx
+  80060d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800610:	8d 40 08             	lea    0x8(%eax),%eax
+  800613:	89 45 14             	mov    %eax,0x14(%ebp)
+  800616:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80061b:	e9 8b 00 00 00       	jmp    8006ab <vprintfmt+0x3bc>
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	8b 10                	mov    (%eax),%edx
+  800625:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062a:	8d 40 04             	lea    0x4(%eax),%eax
+  80062d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800630:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800635:	eb 74                	jmp    8006ab <vprintfmt+0x3bc>
+  800637:	83 f9 01             	cmp    $0x1,%ecx
+  80063a:	7f 1b                	jg     800657 <vprintfmt+0x368>
+  80063c:	85 c9                	test   %ecx,%ecx
+  80063e:	74 2c                	je     80066c <vprintfmt+0x37d>
+  800640:	8b 45 14             	mov    0x14(%ebp),%eax
+  800643:	8b 10                	mov    (%eax),%edx
+  800645:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064a:	8d 40 04             	lea    0x4(%eax),%eax
+  80064d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800650:	bf 08 00 00 00       	mov    $0x8,%edi
+  800655:	eb 54                	jmp    8006ab <vprintfmt+0x3bc>
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8b 10                	mov    (%eax),%edx
+  80065c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80065f:	8d 40 08             	lea    0x8(%eax),%eax
+  800662:	89 45 14             	mov    %eax,0x14(%ebp)
+  800665:	bf 08 00 00 00       	mov    $0x8,%edi
+  80066a:	eb 3f                	jmp    8006ab <vprintfmt+0x3bc>
+  80066c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066f:	8b 10                	mov    (%eax),%edx
+  800671:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800676:	8d 40 04             	lea    0x4(%eax),%eax
+  800679:	89 45 14             	mov    %eax,0x14(%ebp)
+  80067c:	bf 08 00 00 00       	mov    $0x8,%edi
+  800681:	eb 28                	jmp    8006ab <vprintfmt+0x3bc>
+  800683:	83 ec 08             	sub    $0x8,%esp
+  800686:	53                   	push   %ebx
+  800687:	6a 30                	push   $0x30
+  800689:	ff d6                	call   *%esi
+  80068b:	83 c4 08             	add    $0x8,%esp
+  80068e:	53                   	push   %ebx
+  80068f:	6a 78                	push   $0x78
+  800691:	ff d6                	call   *%esi
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8b 10                	mov    (%eax),%edx
+  800698:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069d:	83 c4 10             	add    $0x10,%esp
+  8006a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a6:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006ab:	83 ec 0c             	sub    $0xc,%esp
+  8006ae:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006b2:	50                   	push   %eax
+  8006b3:	ff 75 e0             	push   -0x20(%ebp)
+  8006b6:	57                   	push   %edi
+  8006b7:	51                   	push   %ecx
+  8006b8:	52                   	push   %edx
+  8006b9:	89 da                	mov    %ebx,%edx
+  8006bb:	89 f0                	mov    %esi,%eax
+  8006bd:	e8 4a fb ff ff       	call   80020c <printnum>
+  8006c2:	83 c4 20             	add    $0x20,%esp
+  8006c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8006c8:	e9 40 fc ff ff       	jmp    80030d <vprintfmt+0x1e>
+  8006cd:	83 f9 01             	cmp    $0x1,%ecx
+  8006d0:	7f 1b                	jg     8006ed <vprintfmt+0x3fe>
+  8006d2:	85 c9                	test   %ecx,%ecx
+  8006d4:	74 2c                	je     800702 <vprintfmt+0x413>
+  8006d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d9:	8b 10                	mov    (%eax),%edx
+  8006db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e6:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006eb:	eb be                	jmp    8006ab <vprintfmt+0x3bc>
+  8006ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f0:	8b 10                	mov    (%eax),%edx
+  8006f2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f5:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006fb:	bf 10 00 00 00       	mov    $0x10,%edi
+  800700:	eb a9                	jmp    8006ab <vprintfmt+0x3bc>
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8b 10                	mov    (%eax),%edx
+  800707:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070c:	8d 40 04             	lea    0x4(%eax),%eax
+  80070f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800712:	bf 10 00 00 00       	mov    $0x10,%edi
+  800717:	eb 92                	jmp    8006ab <vprintfmt+0x3bc>
+  800719:	83 ec 08             	sub    $0x8,%esp
+  80071c:	53                   	push   %ebx
+  80071d:	6a 25                	push   $0x25
+  80071f:	ff d6                	call   *%esi
+  800721:	83 c4 10             	add    $0x10,%esp
+  800724:	eb 9f                	jmp    8006c5 <vprintfmt+0x3d6>
+  800726:	83 ec 08             	sub    $0x8,%esp
+  800729:	53                   	push   %ebx
+  80072a:	6a 25                	push   $0x25
+  80072c:	ff d6                	call   *%esi
+  80072e:	83 c4 10             	add    $0x10,%esp
+  800731:	89 f8                	mov    %edi,%eax
+  800733:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800737:	74 05                	je     80073e <vprintfmt+0x44f>
+  800739:	83 e8 01             	sub    $0x1,%eax
+  80073c:	eb f5                	jmp    800733 <vprintfmt+0x444>
+  80073e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800741:	eb 82                	jmp    8006c5 <vprintfmt+0x3d6>
+
+00800743 <vsnprintf>:
+  800743:	55                   	push   %ebp
+  800744:	89 e5                	mov    %esp,%ebp
+  800746:	83 ec 18             	sub    $0x18,%esp
+  800749:	8b 45 08             	mov    0x8(%ebp),%eax
+  80074c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80074f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800752:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800756:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800759:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800760:	85 c0                	test   %eax,%eax
+  800762:	74 26                	je     80078a <vsnprintf+0x47>
+  800764:	85 d2                	test   %edx,%edx
+  800766:	7e 22                	jle    80078a <vsnprintf+0x47>
+  800768:	ff 75 14             	push   0x14(%ebp)
+  80076b:	ff 75 10             	push   0x10(%ebp)
+  80076e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800771:	50                   	push   %eax
+  800772:	68 b5 02 80 00       	push   $0x8002b5
+  800777:	e8 73 fb ff ff       	call   8002ef <vprintfmt>
+  80077c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80077f:	c6 00 00             	movb   $0x0,(%eax)
+  800782:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800785:	83 c4 10             	add    $0x10,%esp
+  800788:	c9                   	leave
+  800789:	c3                   	ret
+  80078a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80078f:	eb f7                	jmp    800788 <vsnprintf+0x45>
+
+00800791 <snprintf>:
+  800791:	55                   	push   %ebp
+  800792:	89 e5                	mov    %esp,%ebp
+  800794:	83 ec 08             	sub    $0x8,%esp
+  800797:	8d 45 14             	lea    0x14(%ebp),%eax
+  80079a:	50                   	push   %eax
+  80079b:	ff 75 10             	push   0x10(%ebp)
+  80079e:	ff 75 0c             	push   0xc(%ebp)
+  8007a1:	ff 75 08             	push   0x8(%ebp)
+  8007a4:	e8 9a ff ff ff       	call   800743 <vsnprintf>
+  8007a9:	c9                   	leave
+  8007aa:	c3                   	ret
+
+008007ab <copy_fwd>:
+  8007ab:	55                   	push   %ebp
+  8007ac:	89 e5                	mov    %esp,%ebp
+  8007ae:	57                   	push   %edi
+  8007af:	56                   	push   %esi
+  8007b0:	53                   	push   %ebx
+  8007b1:	89 c7                	mov    %eax,%edi
+  8007b3:	89 d6                	mov    %edx,%esi
+  8007b5:	89 c8                	mov    %ecx,%eax
+  8007b7:	83 f9 0f             	cmp    $0xf,%ecx
+  8007ba:	76 1c                	jbe    8007d8 <copy_fwd+0x2d>
+  8007bc:	89 f9                	mov    %edi,%ecx
+  8007be:	f7 d9                	neg    %ecx
+  8007c0:	89 cb                	mov    %ecx,%ebx
+  8007c2:	83 e3 03             	and    $0x3,%ebx
+  8007c5:	29 d8                	sub    %ebx,%eax
+  8007c7:	89 c2                	mov    %eax,%edx
+  8007c9:	c1 ea 02             	shr    $0x2,%edx
+  8007cc:	83 e0 03             	and    $0x3,%eax
+  8007cf:	89 d9                	mov    %ebx,%ecx
+  8007d1:	fc                   	cld
+  8007d2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8007d4:	89 d1                	mov    %edx,%ecx
+  8007d6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8007d8:	89 c1                	mov    %eax,%ecx
+  8007da:	fc                   	cld
+  8007db:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8007dd:	5b                   	pop    %ebx
+  8007de:	5e                   	pop    %esi
+  8007df:	5f                   	pop    %edi
+  8007e0:	5d                   	pop    %ebp
+  8007e1:	c3                   	ret
+
+008007e2 <have_sse2>:
+  8007e2:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007e9:	78 06                	js     8007f1 <have_sse2+0xf>
+  8007eb:	a1 04 20 80 00       	mov    0x802004,%eax
+  8007f0:	c3                   	ret
+  8007f1:	55                   	push   %ebp
+  8007f2:	89 e5                	mov    %esp,%ebp
+  8007f4:	53                   	push   %ebx
+  8007f5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007fa:	0f a2                	cpuid
+  8007fc:	c1 ea 1a             	shr    $0x1a,%edx
+  8007ff:	83 e2 01             	and    $0x1,%edx
+  800802:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800808:	a1 04 20 80 00       	mov    0x802004,%eax
+  80080d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800810:	c9                   	leave
+  800811:	c3                   	ret
+
+00800812 <strlen>:
+  800812:	55                   	push   %ebp
+  800813:	89 e5                	mov    %esp,%ebp
+  800815:	8b 55 08             	mov    0x8(%ebp),%edx
+  800818:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081d:	eb 03                	jmp    800822 <strlen+0x10>
+  80081f:	83 c0 01             	add    $0x1,%eax
+  800822:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800826:	75 f7                	jne    80081f <strlen+0xd>
+  800828:	5d                   	pop    %ebp
+  800829:	c3                   	ret
+
+0080082a <strnlen>:
+  80082a:	55                   	push   %ebp
+  80082b:	89 e5                	mov    %esp,%ebp
+  80082d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800830:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800833:	b8 00 00 00 00       	mov    $0x0,%eax
+  800838:	eb 03                	jmp    80083d <strnlen+0x13>
+  80083a:	83 c0 01             	add    $0x1,%eax
+  80083d:	39 d0                	cmp    %edx,%eax
+  80083f:	74 08                	je     800849 <strnlen+0x1f>
+  800841:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800845:	75 f3                	jne    80083a <strnlen+0x10>
+  800847:	89 c2                	mov    %eax,%edx
+  800849:	89 d0                	mov    %edx,%eax
+  80084b:	5d                   	pop    %ebp
+  80084c:	c3                   	ret
+
+0080084d <strcpy>:
+  80084d:	55                   	push   %ebp
+  80084e:	89 e5                	mov    %esp,%ebp
+  800850:	53                   	push   %ebx
+  800851:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800854:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800857:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800860:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800863:	83 c0 01             	add    $0x1,%eax
+  800866:	84 d2                	test   %dl,%dl
+  800868:	75 f2                	jne    80085c <strcpy+0xf>
+  80086a:	89 c8                	mov    %ecx,%eax
+  80086c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80086f:	c9                   	leave
+  800870:	c3                   	ret
+
+00800871 <strcat>:
+  800871:	55                   	push   %ebp
+  800872:	89 e5                	mov    %esp,%ebp
+  800874:	53                   	push   %ebx
+  800875:	83 ec 10             	sub    $0x10,%esp
+  800878:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80087b:	53                   	push   %ebx
+  80087c:	e8 91 ff ff ff       	call   800812 <strlen>
+  800881:	83 c4 08             	add    $0x8,%esp
+  800884:	ff 75 0c             	push   0xc(%ebp)
+  800887:	01 d8                	add    %ebx,%eax
+  800889:	50                   	push   %eax
+  80088a:	e8 be ff ff ff       	call   80084d <strcpy>
+  80088f:	89 d8                	mov    %ebx,%eax
+  800891:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800894:	c9                   	leave
+  800895:	c3                   	ret
+
+00800896 <strncpy>:
+  800896:	55                   	push   %ebp
+  800897:	89 e5                	mov    %esp,%ebp
+  800899:	56                   	push   %esi
+  80089a:	53                   	push   %ebx
+  80089b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80089e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a1:	89 f3                	mov    %esi,%ebx
+  8008a3:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008a6:	89 f0                	mov    %esi,%eax
+  8008a8:	eb 0f                	jmp    8008b9 <strncpy+0x23>
+  8008aa:	83 c0 01             	add    $0x1,%eax
+  8008ad:	0f b6 0a             	movzbl (%edx),%ecx
+  8008b0:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8008b3:	80 f9 01             	cmp    $0x1,%cl
+  8008b6:	83 da ff             	sbb    $0xffffffff,%edx
+  8008b9:	39 d8                	cmp    %ebx,%eax
+  8008bb:	75 ed                	jne    8008aa <strncpy+0x14>
+  8008bd:	89 f0                	mov    %esi,%eax
+  8008bf:	5b                   	pop    %ebx
+  8008c0:	5e                   	pop    %esi
+  8008c1:	5d                   	pop    %ebp
+  8008c2:	c3                   	ret
+
+008008c3 <strlcpy>:
+  8008c3:	55                   	push   %ebp
+  8008c4:	89 e5                	mov    %esp,%ebp
+  8008c6:	56                   	push   %esi
+  8008c7:	53                   	push   %ebx
+  8008c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ce:	8b 55 10             	mov    0x10(%ebp),%edx
+  8008d1:	89 f0                	mov    %esi,%eax
+  8008d3:	85 d2                	test   %edx,%edx
+  8008d5:	74 21                	je     8008f8 <strlcpy+0x35>
+  8008d7:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008db:	89 f2                	mov    %esi,%edx
+  8008dd:	eb 09                	jmp    8008e8 <strlcpy+0x25>
+  8008df:	83 c1 01             	add    $0x1,%ecx
+  8008e2:	83 c2 01             	add    $0x1,%edx
+  8008e5:	88 5a ff             	mov    %bl,-0x1(%edx)
+  8008e8:	39 c2                	cmp    %eax,%edx
+  8008ea:	74 09                	je     8008f5 <strlcpy+0x32>
+  8008ec:	0f b6 19             	movzbl (%ecx),%ebx
+  8008ef:	84 db                	test   %bl,%bl
+  8008f1:	75 ec                	jne    8008df <strlcpy+0x1c>
+  8008f3:	89 d0                	mov    %edx,%eax
+  8008f5:	c6 00 00             	movb   $0x0,(%eax)
+  8008f8:	29 f0                	sub    %esi,%eax
+  8008fa:	5b                   	pop    %ebx
+  8008fb:	5e                   	pop    %esi
+  8008fc:	5d                   	pop    %ebp
+  8008fd:	c3                   	ret
+
+008008fe <strcmp>:
+  8008fe:	55                   	push   %ebp
+  8008ff:	89 e5                	mov    %esp,%ebp
+  800901:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800904:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800907:	eb 06                	jmp    80090f <strcmp+0x11>
+  800909:	83 c1 01             	add    $0x1,%ecx
+  80090c:	83 c2 01             	add    $0x1,%edx
+  80090f:	0f b6 01             	movzbl (%ecx),%eax
+  800912:	84 c0                	test   %al,%al
+  800914:	74 04                	je     80091a <strcmp+0x1c>
+  800916:	3a 02                	cmp    (%edx),%al
+  800918:	74 ef                	je     800909 <strcmp+0xb>
+  80091a:	0f b6 c0             	movzbl %al,%eax
+  80091d:	0f b6 12             	movzbl (%edx),%edx
+  800920:	29 d0                	sub    %edx,%eax
+  800922:	5d                   	pop    %ebp
+  800923:	c3                   	ret
+
+00800924 <strncmp>:
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	53                   	push   %ebx
+  800928:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80092e:	8b 55 10             	mov    0x10(%ebp),%edx
+  800931:	eb 09                	jmp    80093c <strncmp+0x18>
+  800933:	83 ea 01             	sub    $0x1,%edx
+  800936:	83 c0 01             	add    $0x1,%eax
+  800939:	83 c1 01             	add    $0x1,%ecx
+  80093c:	85 d2                	test   %edx,%edx
+  80093e:	74 18                	je     800958 <strncmp+0x34>
+  800940:	0f b6 18             	movzbl (%eax),%ebx
+  800943:	84 db                	test   %bl,%bl
+  800945:	74 04                	je     80094b <strncmp+0x27>
+  800947:	3a 19                	cmp    (%ecx),%bl
+  800949:	74 e8                	je     800933 <strncmp+0xf>
+  80094b:	0f b6 00             	movzbl (%eax),%eax
+  80094e:	0f b6 11             	movzbl (%ecx),%edx
+  800951:	29 d0                	sub    %edx,%eax
+  800953:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800956:	c9                   	leave
+  800957:	c3                   	ret
+  800958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095d:	eb f4                	jmp    800953 <strncmp+0x2f>
+
+0080095f <strchr>:
+  80095f:	55                   	push   %ebp
+  800960:	89 e5                	mov    %esp,%ebp
+  800962:	8b 45 08             	mov    0x8(%ebp),%eax
+  800965:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800969:	eb 03                	jmp    80096e <strchr+0xf>
+  80096b:	83 c0 01             	add    $0x1,%eax
+  80096e:	0f b6 10             	movzbl (%eax),%edx
+  800971:	84 d2                	test   %dl,%dl
+  800973:	74 06                	je     80097b <strchr+0x1c>
+  800975:	38 ca                	cmp    %cl,%dl
+  800977:	75 f2                	jne    80096b <strchr+0xc>
+  800979:	eb 05                	jmp    800980 <strchr+0x21>
+  80097b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800980:	5d                   	pop    %ebp
+  800981:	c3                   	ret
+
+00800982 <strfind>:
+  800982:	55                   	push   %ebp
+  800983:	89 e5                	mov    %esp,%ebp
+  800985:	8b 45 08             	mov    0x8(%ebp),%eax
+  800988:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80098c:	0f b6 10             	movzbl (%eax),%edx
+  80098f:	38 ca                	cmp    %cl,%dl
+  800991:	74 09                	je     80099c <strfind+0x1a>
+  800993:	84 d2                	test   %dl,%dl
+  800995:	74 05                	je     80099c <strfind+0x1a>
+  800997:	83 c0 01             	add    $0x1,%eax
+  80099a:	eb f0                	jmp    80098c <strfind+0xa>
+  80099c:	5d                   	pop    %ebp
+  80099d:	c3                   	ret
+
+0080099e <memset>:
+  80099e:	55                   	push   %ebp
+  80099f:	89 e5                	mov    %esp,%ebp
+  8009a1:	57                   	push   %edi
+  8009a2:	56                   	push   %esi
+  8009a3:	53                   	push   %ebx
+  8009a4:	83 ec 04             	sub    $0x4,%esp
+  8009a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009aa:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009ad:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  8009b1:	89 f7                	mov    %esi,%edi
+  8009b3:	83 fa 0f             	cmp    $0xf,%edx
+  8009b6:	76 24                	jbe    8009dc <memset+0x3e>
+  8009b8:	89 f1                	mov    %esi,%ecx
+  8009ba:	f7 d9                	neg    %ecx
+  8009bc:	83 e1 03             	and    $0x3,%ecx
+  8009bf:	29 ca                	sub    %ecx,%edx
+  8009c1:	89 d0                	mov    %edx,%eax
+  8009c3:	c1 e8 02             	shr    $0x2,%eax
+  8009c6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  8009c9:	83 e2 03             	and    $0x3,%edx
+  8009cc:	89 d8                	mov    %ebx,%eax
+  8009ce:	fc                   	cld
+  8009cf:	f3 aa                	rep stos %al,%es:(%edi)
+  8009d1:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  8009d7:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  8009da:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009dc:	89 d1                	mov    %edx,%ecx
+  8009de:	89 d8                	mov    %ebx,%eax
+  8009e0:	fc                   	cld
+  8009e1:	f3 aa                	rep stos %al,%es:(%edi)
+  8009e3:	89 f0                	mov    %esi,%eax
+  8009e5:	83 c4 04             	add    $0x4,%esp
+  8009e8:	5b                   	pop    %ebx
+  8009e9:	5e                   	pop    %esi
+  8009ea:	5f                   	pop    %edi
+  8009eb:	5d                   	pop    %ebp
+  8009ec:	c3                   	ret
+
+008009ed <memmove>:
+  8009ed:	55                   	push   %ebp
+  8009ee:	89 e5                	mov    %esp,%ebp
+  8009f0:	57                   	push   %edi
+  8009f1:	56                   	push   %esi
+  8009f2:	53                   	push   %ebx
+  8009f3:	83 ec 0c             	sub    $0xc,%esp
+  8009f6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009fc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8009ff:	85 c0                	test   %eax,%eax
+  800a01:	74 14                	je     800a17 <memmove+0x2a>
+  800a03:	39 da                	cmp    %ebx,%edx
+  800a05:	73 07                	jae    800a0e <memmove+0x21>
+  800a07:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  800a0a:	39 cb                	cmp    %ecx,%ebx
+  800a0c:	72 13                	jb     800a21 <memmove+0x34>
+  800a0e:	89 c1                	mov    %eax,%ecx
+  800a10:	89 d8                	mov    %ebx,%eax
+  800a12:	e8 94 fd ff ff       	call   8007ab <copy_fwd>
+  800a17:	89 d8                	mov    %ebx,%eax
+  800a19:	83 c4 0c             	add    $0xc,%esp
+  800a1c:	5b                   	pop    %ebx
+  800a1d:	5e                   	pop    %esi
+  800a1e:	5f                   	pop    %edi
+  800a1f:	5d                   	pop    %ebp
+  800a20:	c3                   	ret
+  800a21:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800a24:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800a27:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800a2a:	83 f8 0f             	cmp    $0xf,%eax
+  800a2d:	76 23                	jbe    800a52 <memmove+0x65>
+  800a2f:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800a32:	83 e1 03             	and    $0x3,%ecx
+  800a35:	29 c8                	sub    %ecx,%eax
+  800a37:	89 c2                	mov    %eax,%edx
+  800a39:	c1 ea 02             	shr    $0x2,%edx
+  800a3c:	83 e0 03             	and    $0x3,%eax
+  800a3f:	fd                   	std
+  800a40:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a42:	83 ef 03             	sub    $0x3,%edi
+  800a45:	83 ee 03             	sub    $0x3,%esi
+  800a48:	89 d1                	mov    %edx,%ecx
+  800a4a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a4c:	83 c7 03             	add    $0x3,%edi
+  800a4f:	83 c6 03             	add    $0x3,%esi
+  800a52:	89 c1                	mov    %eax,%ecx
+  800a54:	fd                   	std
+  800a55:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a57:	fc                   	cld
+  800a58:	eb bd                	jmp    800a17 <memmove+0x2a>
+
+00800a5a <memcpy>:
+  800a5a:	55                   	push   %ebp
+  800a5b:	89 e5                	mov    %esp,%ebp
+  800a5d:	53                   	push   %ebx
+  800a5e:	83 ec 04             	sub    $0x4,%esp
+  800a61:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a64:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a67:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a6a:	89 d8                	mov    %ebx,%eax
+  800a6c:	e8 3a fd ff ff       	call   8007ab <copy_fwd>
+  800a71:	89 d8                	mov    %ebx,%eax
+  800a73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a76:	c9                   	leave
+  800a77:	c3                   	ret
+
+00800a78 <page_copy>:
+  800a78:	55                   	push   %ebp
+  800a79:	89 e5                	mov    %esp,%ebp
+  800a7b:	57                   	push   %edi
+  800a7c:	56                   	push   %esi
+  800a7d:	53                   	push   %ebx
+  800a7e:	83 ec 0c             	sub    $0xc,%esp
+  800a81:	e8 5c fd ff ff       	call   8007e2 <have_sse2>
+  800a86:	85 c0                	test   %eax,%eax
+  800a88:	74 39                	je     800ac3 <page_copy+0x4b>
+  800a8a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a8d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a90:	be 00 01 00 00       	mov    $0x100,%esi
+  800a95:	8b 03                	mov    (%ebx),%eax
+  800a97:	8b 53 04             	mov    0x4(%ebx),%edx
+  800a9a:	0f c3 01             	movnti %eax,(%ecx)
+  800a9d:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800aa1:	8b 43 08             	mov    0x8(%ebx),%eax
+  800aa4:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800aa7:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800aab:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800aaf:	83 c3 10             	add    $0x10,%ebx
+  800ab2:	83 c1 10             	add    $0x10,%ecx
+  800ab5:	4e                   	dec    %esi
+  800ab6:	75 dd                	jne    800a95 <page_copy+0x1d>
+  800ab8:	0f ae f8             	sfence
+  800abb:	83 c4 0c             	add    $0xc,%esp
+  800abe:	5b                   	pop    %ebx
+  800abf:	5e                   	pop    %esi
+  800ac0:	5f                   	pop    %edi
+  800ac1:	5d                   	pop    %ebp
+  800ac2:	c3                   	ret
+  800ac3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ac6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ac9:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800ace:	fc                   	cld
+  800acf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad1:	eb e8                	jmp    800abb <page_copy+0x43>
+
+00800ad3 <page_zero>:
+  800ad3:	55                   	push   %ebp
+  800ad4:	89 e5                	mov    %esp,%ebp
+  800ad6:	57                   	push   %edi
+  800ad7:	83 ec 04             	sub    $0x4,%esp
+  800ada:	e8 03 fd ff ff       	call   8007e2 <have_sse2>
+  800adf:	85 c0                	test   %eax,%eax
+  800ae1:	74 3a                	je     800b1d <page_zero+0x4a>
+  800ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae6:	ba 80 00 00 00       	mov    $0x80,%edx
+  800aeb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af0:	0f c3 08             	movnti %ecx,(%eax)
+  800af3:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800af7:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800afb:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800aff:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800b03:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800b07:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800b0b:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800b0f:	83 c0 20             	add    $0x20,%eax
+  800b12:	4a                   	dec    %edx
+  800b13:	75 db                	jne    800af0 <page_zero+0x1d>
+  800b15:	0f ae f8             	sfence
+  800b18:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b1b:	c9                   	leave
+  800b1c:	c3                   	ret
+  800b1d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b20:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800b25:	fc                   	cld
+  800b26:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b28:	eb ee                	jmp    800b18 <page_zero+0x45>
+
+00800b2a <memcmp>:
+  800b2a:	55                   	push   %ebp
+  800b2b:	89 e5                	mov    %esp,%ebp
+  800b2d:	56                   	push   %esi
+  800b2e:	53                   	push   %ebx
+  800b2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b32:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b35:	89 c6                	mov    %eax,%esi
+  800b37:	03 75 10             	add    0x10(%ebp),%esi
+  800b3a:	eb 06                	jmp    800b42 <memcmp+0x18>
+  800b3c:	83 c0 01             	add    $0x1,%eax
+  800b3f:	83 c2 01             	add    $0x1,%edx
+  800b42:	39 f0                	cmp    %esi,%eax
+  800b44:	74 14                	je     800b5a <memcmp+0x30>
+  800b46:	0f b6 08             	movzbl (%eax),%ecx
+  800b49:	0f b6 1a             	movzbl (%edx),%ebx
+  800b4c:	38 d9                	cmp    %bl,%cl
+  800b4e:	74 ec                	je     800b3c <memcmp+0x12>
+  800b50:	0f b6 c1             	movzbl %cl,%eax
+  800b53:	0f b6 db             	movzbl %bl,%ebx
+  800b56:	29 d8                	sub    %ebx,%eax
+  800b58:	eb 05                	jmp    800b5f <memcmp+0x35>
+  800b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5f:	5b                   	pop    %ebx
+  800b60:	5e                   	pop    %esi
+  800b61:	5d                   	pop    %ebp
+  800b62:	c3                   	ret
+
+00800b63 <memfind>:
+  800b63:	55                   	push   %ebp
+  800b64:	89 e5                	mov    %esp,%ebp
+  800b66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b6c:	89 c2                	mov    %eax,%edx
+  800b6e:	03 55 10             	add    0x10(%ebp),%edx
+  800b71:	eb 03                	jmp    800b76 <memfind+0x13>
+  800b73:	83 c0 01             	add    $0x1,%eax
+  800b76:	39 d0                	cmp    %edx,%eax
+  800b78:	73 04                	jae    800b7e <memfind+0x1b>
+  800b7a:	38 08                	cmp    %cl,(%eax)
+  800b7c:	75 f5                	jne    800b73 <memfind+0x10>
+  800b7e:	5d                   	pop    %ebp
+  800b7f:	c3                   	ret
+
+00800b80 <strtol>:
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	57                   	push   %edi
+  800b84:	56                   	push   %esi
+  800b85:	53                   	push   %ebx
+  800b86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b8c:	eb 03                	jmp    800b91 <strtol+0x11>
+  800b8e:	83 c2 01             	add    $0x1,%edx
+  800b91:	0f b6 02             	movzbl (%edx),%eax
+  800b94:	3c 20                	cmp    $0x20,%al
+  800b96:	74 f6                	je     800b8e <strtol+0xe>
+  800b98:	3c 09                	cmp    $0x9,%al
+  800b9a:	74 f2                	je     800b8e <strtol+0xe>
+  800b9c:	3c 2b                	cmp    $0x2b,%al
+  800b9e:	74 2a                	je     800bca <strtol+0x4a>
+  800ba0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ba5:	3c 2d                	cmp    $0x2d,%al
+  800ba7:	74 2b                	je     800bd4 <strtol+0x54>
+  800ba9:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800baf:	75 0f                	jne    800bc0 <strtol+0x40>
+  800bb1:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bb4:	74 28                	je     800bde <strtol+0x5e>
+  800bb6:	85 db                	test   %ebx,%ebx
+  800bb8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bbd:	0f 44 d8             	cmove  %eax,%ebx
+  800bc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc5:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bc8:	eb 46                	jmp    800c10 <strtol+0x90>
+  800bca:	83 c2 01             	add    $0x1,%edx
+  800bcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bd2:	eb d5                	jmp    800ba9 <strtol+0x29>
+  800bd4:	83 c2 01             	add    $0x1,%edx
+  800bd7:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bdc:	eb cb                	jmp    800ba9 <strtol+0x29>
+  800bde:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800be2:	74 0e                	je     800bf2 <strtol+0x72>
+  800be4:	85 db                	test   %ebx,%ebx
+  800be6:	75 d8                	jne    800bc0 <strtol+0x40>
+  800be8:	83 c2 01             	add    $0x1,%edx
+  800beb:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bf0:	eb ce                	jmp    800bc0 <strtol+0x40>
+  800bf2:	83 c2 02             	add    $0x2,%edx
+  800bf5:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bfa:	eb c4                	jmp    800bc0 <strtol+0x40>
+  800bfc:	0f be c0             	movsbl %al,%eax
+  800bff:	83 e8 30             	sub    $0x30,%eax
+  800c02:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c05:	7d 3a                	jge    800c41 <strtol+0xc1>
+  800c07:	83 c2 01             	add    $0x1,%edx
+  800c0a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c0e:	01 c1                	add    %eax,%ecx
+  800c10:	0f b6 02             	movzbl (%edx),%eax
+  800c13:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c16:	89 f3                	mov    %esi,%ebx
+  800c18:	80 fb 09             	cmp    $0x9,%bl
+  800c1b:	76 df                	jbe    800bfc <strtol+0x7c>
+  800c1d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c20:	89 f3                	mov    %esi,%ebx
+  800c22:	80 fb 19             	cmp    $0x19,%bl
+  800c25:	77 08                	ja     800c2f <strtol+0xaf>
+  800c27:	0f be c0             	movsbl %al,%eax
+  800c2a:	83 e8 57             	sub    $0x57,%eax
+  800c2d:	eb d3                	jmp    800c02 <strtol+0x82>
+  800c2f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c32:	89 f3                	mov    %esi,%ebx
+  800c34:	80 fb 19             	cmp    $0x19,%bl
+  800c37:	77 08                	ja     800c41 <strtol+0xc1>
+  800c39:	0f be c0             	movsbl %al,%eax
+  800c3c:	83 e8 37             	sub    $0x37,%eax
+  800c3f:	eb c1                	jmp    800c02 <strtol+0x82>
+  800c41:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c45:	74 05                	je     800c4c <strtol+0xcc>
+  800c47:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c4a:	89 10                	mov    %edx,(%eax)
+  800c4c:	89 c8                	mov    %ecx,%eax
+  800c4e:	f7 d8                	neg    %eax
+  800c50:	85 ff                	test   %edi,%edi
+  800c52:	0f 45 c8             	cmovne %eax,%ecx
+  800c55:	89 c8                	mov    %ecx,%eax
+  800c57:	5b                   	pop    %ebx
+  800c58:	5e                   	pop    %esi
+  800c59:	5f                   	pop    %edi
+  800c5a:	5d                   	pop    %ebp
+  800c5b:	c3                   	ret
+
+00800c5c <sys_cputs>:
+  800c5c:	55                   	push   %ebp
+  800c5d:	89 e5                	mov    %esp,%ebp
+  800c5f:	57                   	push   %edi
+  800c60:	56                   	push   %esi
+  800c61:	53                   	push   %ebx
+  800c62:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c69:	78 21                	js     800c8c <sys_cputs+0x30>
+  800c6b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c72:	75 2d                	jne    800ca1 <sys_cputs+0x45>
+  800c74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7f:	89 c3                	mov    %eax,%ebx
+  800c81:	89 c7                	mov    %eax,%edi
+  800c83:	89 c6                	mov    %eax,%esi
+  800c85:	cd 30                	int    $0x30
+  800c87:	5b                   	pop    %ebx
+  800c88:	5e                   	pop    %esi
+  800c89:	5f                   	pop    %edi
+  800c8a:	5d                   	pop    %ebp
+  800c8b:	c3                   	ret
+  800c8c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c91:	0f a2                	cpuid
+  800c93:	c1 ea 0b             	shr    $0xb,%edx
+  800c96:	83 e2 01             	and    $0x1,%edx
+  800c99:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800c9f:	eb ca                	jmp    800c6b <sys_cputs+0xf>
+  800ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cac:	89 c3                	mov    %eax,%ebx
+  800cae:	89 c7                	mov    %eax,%edi
+  800cb0:	89 c6                	mov    %eax,%esi
+  800cb2:	55                   	push   %ebp
+  800cb3:	68 bc 0c 80 00       	push   $0x800cbc
+  800cb8:	89 e5                	mov    %esp,%ebp
+  800cba:	0f 34                	sysenter
+  800cbc:	83 c4 04             	add    $0x4,%esp
+  800cbf:	5d                   	pop    %ebp
+  800cc0:	eb c5                	jmp    800c87 <sys_cputs+0x2b>
+
+00800cc2 <sys_cgetc>:
+  800cc2:	55                   	push   %ebp
+  800cc3:	89 e5                	mov    %esp,%ebp
+  800cc5:	57                   	push   %edi
+  800cc6:	56                   	push   %esi
+  800cc7:	53                   	push   %ebx
+  800cc8:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800ccf:	78 22                	js     800cf3 <sys_cgetc+0x31>
+  800cd1:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800cd8:	75 2e                	jne    800d08 <sys_cgetc+0x46>
+  800cda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cdf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ce4:	89 d1                	mov    %edx,%ecx
+  800ce6:	89 d3                	mov    %edx,%ebx
+  800ce8:	89 d7                	mov    %edx,%edi
+  800cea:	89 d6                	mov    %edx,%esi
+  800cec:	cd 30                	int    $0x30
+  800cee:	5b                   	pop    %ebx
+  800cef:	5e                   	pop    %esi
+  800cf0:	5f                   	pop    %edi
+  800cf1:	5d                   	pop    %ebp
+  800cf2:	c3                   	ret
+  800cf3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cf8:	0f a2                	cpuid
+  800cfa:	c1 ea 0b             	shr    $0xb,%edx
+  800cfd:	83 e2 01             	and    $0x1,%edx
+  800d00:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800d06:	eb c9                	jmp    800cd1 <sys_cgetc+0xf>
+  800d08:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d0d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d12:	89 d1                	mov    %edx,%ecx
+  800d14:	89 d3                	mov    %edx,%ebx
+  800d16:	89 d7                	mov    %edx,%edi
+  800d18:	89 d6                	mov    %edx,%esi
+  800d1a:	55                   	push   %ebp
+  800d1b:	68 24 0d 80 00       	push   $0x800d24
+  800d20:	89 e5                	mov    %esp,%ebp
+  800d22:	0f 34                	sysenter
+  800d24:	83 c4 04             	add    $0x4,%esp
+  800d27:	5d                   	pop    %ebp
+  800d28:	eb c4                	jmp    800cee <sys_cgetc+0x2c>
+
+00800d2a <sys_env_destroy>:
+  800d2a:	55                   	push   %ebp
+  800d2b:	89 e5                	mov    %esp,%ebp
+  800d2d:	57                   	push   %edi
+  800d2e:	56                   	push   %esi
+  800d2f:	53                   	push   %ebx
+  800d30:	83 ec 0c             	sub    $0xc,%esp
+  800d33:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d3a:	78 2a                	js     800d66 <sys_env_destroy+0x3c>
+  800d3c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d43:	75 36                	jne    800d7b <sys_env_destroy+0x51>
+  800d45:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d4a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d52:	89 cb                	mov    %ecx,%ebx
+  800d54:	89 cf                	mov    %ecx,%edi
+  800d56:	89 ce                	mov    %ecx,%esi
+  800d58:	cd 30                	int    $0x30
+  800d5a:	85 c0                	test   %eax,%eax
+  800d5c:	7f 40                	jg     800d9e <sys_env_destroy+0x74>
+  800d5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d61:	5b                   	pop    %ebx
+  800d62:	5e                   	pop    %esi
+  800d63:	5f                   	pop    %edi
+  800d64:	5d                   	pop    %ebp
+  800d65:	c3                   	ret
+  800d66:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d6b:	0f a2                	cpuid
+  800d6d:	c1 ea 0b             	shr    $0xb,%edx
+  800d70:	83 e2 01             	and    $0x1,%edx
+  800d73:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800d79:	eb c1                	jmp    800d3c <sys_env_destroy+0x12>
+  800d7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d83:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d88:	89 cb                	mov    %ecx,%ebx
+  800d8a:	89 cf                	mov    %ecx,%edi
+  800d8c:	89 ce                	mov    %ecx,%esi
+  800d8e:	55                   	push   %ebp
+  800d8f:	68 98 0d 80 00       	push   $0x800d98
+  800d94:	89 e5                	mov    %esp,%ebp
+  800d96:	0f 34                	sysenter
+  800d98:	83 c4 04             	add    $0x4,%esp
+  800d9b:	5d                   	pop    %ebp
+  800d9c:	eb bc                	jmp    800d5a <sys_env_destroy+0x30>
+  800d9e:	83 ec 0c             	sub    $0xc,%esp
+  800da1:	50                   	push   %eax
+  800da2:	6a 03                	push   $0x3
+  800da4:	68 64 1d 80 00       	push   $0x801d64
+  800da9:	6a 49                	push   $0x49
+  800dab:	68 81 1d 80 00       	push   $0x801d81
+  800db0:	e8 63 f3 ff ff       	call   800118 <_panic>
+
+00800db5 <sys_getenvid>:
+  800db5:	55                   	push   %ebp
+  800db6:	89 e5                	mov    %esp,%ebp
+  800db8:	57                   	push   %edi
+  800db9:	56                   	push   %esi
+  800dba:	53                   	push   %ebx
+  800dbb:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800dc2:	78 22                	js     800de6 <sys_getenvid+0x31>
+  800dc4:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800dcb:	75 2e                	jne    800dfb <sys_getenvid+0x46>
+  800dcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dd7:	89 d1                	mov    %edx,%ecx
+  800dd9:	89 d3                	mov    %edx,%ebx
+  800ddb:	89 d7                	mov    %edx,%edi
+  800ddd:	89 d6                	mov    %edx,%esi
+  800ddf:	cd 30                	int    $0x30
+  800de1:	5b                   	pop    %ebx
+  800de2:	5e                   	pop    %esi
+  800de3:	5f                   	pop    %edi
+  800de4:	5d                   	pop    %ebp
+  800de5:	c3                   	ret
+  800de6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800deb:	0f a2                	cpuid
+  800ded:	c1 ea 0b             	shr    $0xb,%edx
+  800df0:	83 e2 01             	and    $0x1,%edx
+  800df3:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800df9:	eb c9                	jmp    800dc4 <sys_getenvid+0xf>
+  800dfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e00:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e05:	89 d1                	mov    %edx,%ecx
+  800e07:	89 d3                	mov    %edx,%ebx
+  800e09:	89 d7                	mov    %edx,%edi
+  800e0b:	89 d6                	mov    %edx,%esi
+  800e0d:	55                   	push   %ebp
+  800e0e:	68 17 0e 80 00       	push   $0x800e17
+  800e13:	89 e5                	mov    %esp,%ebp
+  800e15:	0f 34                	sysenter
+  800e17:	83 c4 04             	add    $0x4,%esp
+  800e1a:	5d                   	pop    %ebp
+  800e1b:	eb c4                	jmp    800de1 <sys_getenvid+0x2c>
+
+00800e1d <sys_yield>:
+  800e1d:	55                   	push   %ebp
+  800e1e:	89 e5                	mov    %esp,%ebp
+  800e20:	57                   	push   %edi
+  800e21:	56                   	push   %esi
+  800e22:	53                   	push   %ebx
+  800e23:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e2a:	78 22                	js     800e4e <sys_yield+0x31>
+  800e2c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e33:	75 2e                	jne    800e63 <sys_yield+0x46>
+  800e35:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e3f:	89 d1                	mov    %edx,%ecx
+  800e41:	89 d3                	mov    %edx,%ebx
+  800e43:	89 d7                	mov    %edx,%edi
+  800e45:	89 d6                	mov    %edx,%esi
+  800e47:	cd 30                	int    $0x30
+  800e49:	5b                   	pop    %ebx
+  800e4a:	5e                   	pop    %esi
+  800e4b:	5f                   	pop    %edi
+  800e4c:	5d                   	pop    %ebp
+  800e4d:	c3                   	ret
+  800e4e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e53:	0f a2                	cpuid
+  800e55:	c1 ea 0b             	shr    $0xb,%edx
+  800e58:	83 e2 01             	and    $0x1,%edx
+  800e5b:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800e61:	eb c9                	jmp    800e2c <sys_yield+0xf>
+  800e63:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e68:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e6d:	89 d1                	mov    %edx,%ecx
+  800e6f:	89 d3                	mov    %edx,%ebx
+  800e71:	89 d7                	mov    %edx,%edi
+  800e73:	89 d6                	mov    %edx,%esi
+  800e75:	55                   	push   %ebp
+  800e76:	68 7f 0e 80 00       	push   $0x800e7f
+  800e7b:	89 e5                	mov    %esp,%ebp
+  800e7d:	0f 34                	sysenter
+  800e7f:	83 c4 04             	add    $0x4,%esp
+  800e82:	5d                   	pop    %ebp
+  800e83:	eb c4                	jmp    800e49 <sys_yield+0x2c>
+
+00800e85 <sys_env_set_cow>:
+  800e85:	55                   	push   %ebp
+  800e86:	89 e5                	mov    %esp,%ebp
+  800e88:	57                   	push   %edi
+  800e89:	56                   	push   %esi
+  800e8a:	53                   	push   %ebx
+  800e8b:	83 ec 0c             	sub    $0xc,%esp
+  800e8e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e95:	78 2b                	js     800ec2 <sys_env_set_cow+0x3d>
+  800e97:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e9e:	75 37                	jne    800ed7 <sys_env_set_cow+0x52>
+  800ea0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eaa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ead:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb0:	89 df                	mov    %ebx,%edi
+  800eb2:	89 de                	mov    %ebx,%esi
+  800eb4:	cd 30                	int    $0x30
+  800eb6:	85 c0                	test   %eax,%eax
+  800eb8:	7f 41                	jg     800efb <sys_env_set_cow+0x76>
+  800eba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ebd:	5b                   	pop    %ebx
+  800ebe:	5e                   	pop    %esi
+  800ebf:	5f                   	pop    %edi
+  800ec0:	5d                   	pop    %ebp
+  800ec1:	c3                   	ret
+  800ec2:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ec7:	0f a2                	cpuid
+  800ec9:	c1 ea 0b             	shr    $0xb,%edx
+  800ecc:	83 e2 01             	and    $0x1,%edx
+  800ecf:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800ed5:	eb c0                	jmp    800e97 <sys_env_set_cow+0x12>
+  800ed7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ee7:	89 df                	mov    %ebx,%edi
+  800ee9:	89 de                	mov    %ebx,%esi
+  800eeb:	55                   	push   %ebp
+  800eec:	68 f5 0e 80 00       	push   $0x800ef5
+  800ef1:	89 e5                	mov    %esp,%ebp
+  800ef3:	0f 34                	sysenter
+  800ef5:	83 c4 04             	add    $0x4,%esp
+  800ef8:	5d                   	pop    %ebp
+  800ef9:	eb bb                	jmp    800eb6 <sys_env_set_cow+0x31>
+  800efb:	83 ec 0c             	sub    $0xc,%esp
+  800efe:	50                   	push   %eax
+  800eff:	6a 0d                	push   $0xd
+  800f01:	68 64 1d 80 00       	push   $0x801d64
+  800f06:	6a 49                	push   $0x49
+  800f08:	68 81 1d 80 00       	push   $0x801d81
+  800f0d:	e8 06 f2 ff ff       	call   800118 <_panic>
+
+00800f12 <sys_env_set_quota>:
+  800f12:	55                   	push   %ebp
+  800f13:	89 e5                	mov    %esp,%ebp
+  800f15:	57                   	push   %edi
+  800f16:	56                   	push   %esi
+  800f17:	53                   	push   %ebx
+  800f18:	83 ec 0c             	sub    $0xc,%esp
+  800f1b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f22:	78 2b                	js     800f4f <sys_env_set_quota+0x3d>
+  800f24:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f2b:	75 37                	jne    800f64 <sys_env_set_quota+0x52>
+  800f2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f32:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3d:	89 df                	mov    %ebx,%edi
+  800f3f:	89 de                	mov    %ebx,%esi
+  800f41:	cd 30                	int    $0x30
+  800f43:	85 c0                	test   %eax,%eax
+  800f45:	7f 41                	jg     800f88 <sys_env_set_quota+0x76>
+  800f47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4a:	5b                   	pop    %ebx
+  800f4b:	5e                   	pop    %esi
+  800f4c:	5f                   	pop    %edi
+  800f4d:	5d                   	pop    %ebp
+  800f4e:	c3                   	ret
+  800f4f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f54:	0f a2                	cpuid
+  800f56:	c1 ea 0b             	shr    $0xb,%edx
+  800f59:	83 e2 01             	and    $0x1,%edx
+  800f5c:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800f62:	eb c0                	jmp    800f24 <sys_env_set_quota+0x12>
+  800f64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f74:	89 df                	mov    %ebx,%edi
+  800f76:	89 de                	mov    %ebx,%esi
+  800f78:	55                   	push   %ebp
+  800f79:	68 82 0f 80 00       	push   $0x800f82
+  800f7e:	89 e5                	mov    %esp,%ebp
+  800f80:	0f 34                	sysenter
+  800f82:	83 c4 04             	add    $0x4,%esp
+  800f85:	5d                   	pop    %ebp
+  800f86:	eb bb                	jmp    800f43 <sys_env_set_quota+0x31>
+  800f88:	83 ec 0c             	sub    $0xc,%esp
+  800f8b:	50                   	push   %eax
+  800f8c:	6a 0f                	push   $0xf
+  800f8e:	68 64 1d 80 00       	push   $0x801d64
+  800f93:	6a 49                	push   $0x49
+  800f95:	68 81 1d 80 00       	push   $0x801d81
+  800f9a:	e8 79 f1 ff ff       	call   800118 <_panic>
+
+00800f9f <sys_page_alloc>:
+  800f9f:	55                   	push   %ebp
+  800fa0:	89 e5                	mov    %esp,%ebp
+  800fa2:	57                   	push   %edi
+  800fa3:	56                   	push   %esi
+  800fa4:	53                   	push   %ebx
+  800fa5:	83 ec 0c             	sub    $0xc,%esp
+  800fa8:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800faf:	78 2c                	js     800fdd <sys_page_alloc+0x3e>
+  800fb1:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800fb8:	75 38                	jne    800ff2 <sys_page_alloc+0x53>
+  800fba:	be 00 00 00 00       	mov    $0x0,%esi
+  800fbf:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fc4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fcd:	89 f7                	mov    %esi,%edi
+  800fcf:	cd 30                	int    $0x30
+  800fd1:	85 c0                	test   %eax,%eax
+  800fd3:	7f 42                	jg     801017 <sys_page_alloc+0x78>
+  800fd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd8:	5b                   	pop    %ebx
+  800fd9:	5e                   	pop    %esi
+  800fda:	5f                   	pop    %edi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	c3                   	ret
+  800fdd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fe2:	0f a2                	cpuid
+  800fe4:	c1 ea 0b             	shr    $0xb,%edx
+  800fe7:	83 e2 01             	and    $0x1,%edx
+  800fea:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800ff0:	eb bf                	jmp    800fb1 <sys_page_alloc+0x12>
+  800ff2:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffd:	b8 04 00 00 00       	mov    $0x4,%eax
+  801002:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801005:	89 f7                	mov    %esi,%edi
+  801007:	55                   	push   %ebp
+  801008:	68 11 10 80 00       	push   $0x801011
+  80100d:	89 e5                	mov    %esp,%ebp
+  80100f:	0f 34                	sysenter
+  801011:	83 c4 04             	add    $0x4,%esp
+  801014:	5d                   	pop    %ebp
+  801015:	eb ba                	jmp    800fd1 <sys_page_alloc+0x32>
+  801017:	83 ec 0c             	sub    $0xc,%esp
+  80101a:	50                   	push   %eax
+  80101b:	6a 04                	push   $0x4
+  80101d:	68 64 1d 80 00       	push   $0x801d64
+  801022:	6a 49                	push   $0x49
+  801024:	68 81 1d 80 00       	push   $0x801d81
+  801029:	e8 ea f0 ff ff       	call   800118 <_panic>
+
+0080102e <sys_page_map>:
+  80102e:	55                   	push   %ebp
+  80102f:	89 e5                	mov    %esp,%ebp
+  801031:	57                   	push   %edi
+  801032:	56                   	push   %esi
+  801033:	53                   	push   %ebx
+  801034:	83 ec 0c             	sub    $0xc,%esp
+  801037:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80103e:	78 2b                	js     80106b <sys_page_map+0x3d>
+  801040:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801047:	75 37                	jne    801080 <sys_page_map+0x52>
+  801049:	b8 05 00 00 00       	mov    $0x5,%eax
+  80104e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801051:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801054:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801057:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80105a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80105d:	cd 30                	int    $0x30
+  80105f:	85 c0                	test   %eax,%eax
+  801061:	7f 41                	jg     8010a4 <sys_page_map+0x76>
+  801063:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801066:	5b                   	pop    %ebx
+  801067:	5e                   	pop    %esi
+  801068:	5f                   	pop    %edi
+  801069:	5d                   	pop    %ebp
+  80106a:	c3                   	ret
+  80106b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801070:	0f a2                	cpuid
+  801072:	c1 ea 0b             	shr    $0xb,%edx
+  801075:	83 e2 01             	and    $0x1,%edx
+  801078:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80107e:	eb c0                	jmp    801040 <sys_page_map+0x12>
+  801080:	8b 55 08             	mov    0x8(%ebp),%edx
+  801083:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801086:	b8 05 00 00 00       	mov    $0x5,%eax
+  80108b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80108e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801091:	8b 75 18             	mov    0x18(%ebp),%esi
+  801094:	55                   	push   %ebp
+  801095:	68 9e 10 80 00       	push   $0x80109e
+  80109a:	89 e5                	mov    %esp,%ebp
+  80109c:	0f 34                	sysenter
+  80109e:	83 c4 04             	add    $0x4,%esp
+  8010a1:	5d                   	pop    %ebp
+  8010a2:	eb bb                	jmp    80105f <sys_page_map+0x31>
+  8010a4:	83 ec 0c             	sub    $0xc,%esp
+  8010a7:	50                   	push   %eax
+  8010a8:	6a 05                	push   $0x5
+  8010aa:	68 64 1d 80 00       	push   $0x801d64
+  8010af:	6a 49                	push   $0x49
+  8010b1:	68 81 1d 80 00       	push   $0x801d81
+  8010b6:	e8 5d f0 ff ff       	call   800118 <_panic>
+
+008010bb <sys_page_unmap>:
+  8010bb:	55                   	push   %ebp
+  8010bc:	89 e5                	mov    %esp,%ebp
+  8010be:	57                   	push   %edi
+  8010bf:	56                   	push   %esi
+  8010c0:	53                   	push   %ebx
+  8010c1:	83 ec 0c             	sub    $0xc,%esp
+  8010c4:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010cb:	78 2b                	js     8010f8 <sys_page_unmap+0x3d>
+  8010cd:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010d4:	75 37                	jne    80110d <sys_page_unmap+0x52>
+  8010d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010db:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e6:	89 df                	mov    %ebx,%edi
+  8010e8:	89 de                	mov    %ebx,%esi
+  8010ea:	cd 30                	int    $0x30
+  8010ec:	85 c0                	test   %eax,%eax
+  8010ee:	7f 41                	jg     801131 <sys_page_unmap+0x76>
+  8010f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f3:	5b                   	pop    %ebx
+  8010f4:	5e                   	pop    %esi
+  8010f5:	5f                   	pop    %edi
+  8010f6:	5d                   	pop    %ebp
+  8010f7:	c3                   	ret
+  8010f8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010fd:	0f a2                	cpuid
+  8010ff:	c1 ea 0b             	shr    $0xb,%edx
+  801102:	83 e2 01             	and    $0x1,%edx
+  801105:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80110b:	eb c0                	jmp    8010cd <sys_page_unmap+0x12>
+  80110d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801112:	8b 55 08             	mov    0x8(%ebp),%edx
+  801115:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801118:	b8 06 00 00 00       	mov    $0x6,%eax
+  80111d:	89 df                	mov    %ebx,%edi
+  80111f:	89 de                	mov    %ebx,%esi
+  801121:	55                   	push   %ebp
+  801122:	68 2b 11 80 00       	push   $0x80112b
+  801127:	89 e5                	mov    %esp,%ebp
+  801129:	0f 34                	sysenter
+  80112b:	83 c4 04             	add    $0x4,%esp
+  80112e:	5d                   	pop    %ebp
+  80112f:	eb bb                	jmp    8010ec <sys_page_unmap+0x31>
+  801131:	83 ec 0c             	sub    $0xc,%esp
+  801134:	50                   	push   %eax
+  801135:	6a 06                	push   $0x6
+  801137:	68 64 1d 80 00       	push   $0x801d64
+  80113c:	6a 49                	push   $0x49
+  80113e:	68 81 1d 80 00       	push   $0x801d81
+  801143:	e8 d0 ef ff ff       	call   800118 <_panic>
+
+00801148 <sys_page_reuse>:
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	57                   	push   %edi
+  80114c:	56                   	push   %esi
+  80114d:	53                   	push   %ebx
+  80114e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801155:	78 24                	js     80117b <sys_page_reuse+0x33>
+  801157:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80115e:	75 30                	jne    801190 <sys_page_reuse+0x48>
+  801160:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801165:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80116a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801170:	89 df                	mov    %ebx,%edi
+  801172:	89 de                	mov    %ebx,%esi
+  801174:	cd 30                	int    $0x30
+  801176:	5b                   	pop    %ebx
+  801177:	5e                   	pop    %esi
+  801178:	5f                   	pop    %edi
+  801179:	5d                   	pop    %ebp
+  80117a:	c3                   	ret
+  80117b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801180:	0f a2                	cpuid
+  801182:	c1 ea 0b             	shr    $0xb,%edx
+  801185:	83 e2 01             	and    $0x1,%edx
+  801188:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80118e:	eb c7                	jmp    801157 <sys_page_reuse+0xf>
+  801190:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801195:	8b 55 08             	mov    0x8(%ebp),%edx
+  801198:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011a0:	89 df                	mov    %ebx,%edi
+  8011a2:	89 de                	mov    %ebx,%esi
+  8011a4:	55                   	push   %ebp
+  8011a5:	68 ae 11 80 00       	push   $0x8011ae
+  8011aa:	89 e5                	mov    %esp,%ebp
+  8011ac:	0f 34                	sysenter
+  8011ae:	83 c4 04             	add    $0x4,%esp
+  8011b1:	5d                   	pop    %ebp
+  8011b2:	eb c2                	jmp    801176 <sys_page_reuse+0x2e>
+
+008011b4 <sys_env_set_status>:
+  8011b4:	55                   	push   %ebp
+  8011b5:	89 e5                	mov    %esp,%ebp
+  8011b7:	57                   	push   %edi
+  8011b8:	56                   	push   %esi
+  8011b9:	53                   	push   %ebx
+  8011ba:	83 ec 0c             	sub    $0xc,%esp
+  8011bd:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011c4:	78 2b                	js     8011f1 <sys_env_set_status+0x3d>
+  8011c6:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011cd:	75 37                	jne    801206 <sys_env_set_status+0x52>
+  8011cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011df:	89 df                	mov    %ebx,%edi
+  8011e1:	89 de                	mov    %ebx,%esi
+  8011e3:	cd 30                	int    $0x30
+  8011e5:	85 c0                	test   %eax,%eax
+  8011e7:	7f 41                	jg     80122a <sys_env_set_status+0x76>
+  8011e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ec:	5b                   	pop    %ebx
+  8011ed:	5e                   	pop    %esi
+  8011ee:	5f                   	pop    %edi
+  8011ef:	5d                   	pop    %ebp
+  8011f0:	c3                   	ret
+  8011f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011f6:	0f a2                	cpuid
+  8011f8:	c1 ea 0b             	shr    $0xb,%edx
+  8011fb:	83 e2 01             	and    $0x1,%edx
+  8011fe:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801204:	eb c0                	jmp    8011c6 <sys_env_set_status+0x12>
+  801206:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801211:	b8 08 00 00 00       	mov    $0x8,%eax
+  801216:	89 df                	mov    %ebx,%edi
+  801218:	89 de                	mov    %ebx,%esi
+  80121a:	55                   	push   %ebp
+  80121b:	68 24 12 80 00       	push   $0x801224
+  801220:	89 e5                	mov    %esp,%ebp
+  801222:	0f 34                	sysenter
+  801224:	83 c4 04             	add    $0x4,%esp
+  801227:	5d                   	pop    %ebp
+  801228:	eb bb                	jmp    8011e5 <sys_env_set_status+0x31>
+  80122a:	83 ec 0c             	sub    $0xc,%esp
+  80122d:	50                   	push   %eax
+  80122e:	6a 08                	push   $0x8
+  801230:	68 64 1d 80 00       	push   $0x801d64
+  801235:	6a 49                	push   $0x49
+  801237:	68 81 1d 80 00       	push   $0x801d81
+  80123c:	e8 d7 ee ff ff       	call   800118 <_panic>
+
+00801241 <sys_env_set_pgfault_upcall>:
+  801241:	55                   	push   %ebp
+  801242:	89 e5                	mov    %esp,%ebp
+  801244:	57                   	push   %edi
+  801245:	56                   	push   %esi
+  801246:	53                   	push   %ebx
+  801247:	83 ec 0c             	sub    $0xc,%esp
+  80124a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801251:	78 2b                	js     80127e <sys_env_set_pgfault_upcall+0x3d>
+  801253:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80125a:	75 37                	jne    801293 <sys_env_set_pgfault_upcall+0x52>
+  80125c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801261:	b8 09 00 00 00       	mov    $0x9,%eax
+  801266:	8b 55 08             	mov    0x8(%ebp),%edx
+  801269:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126c:	89 df                	mov    %ebx,%edi
+  80126e:	89 de                	mov    %ebx,%esi
+  801270:	cd 30                	int    $0x30
+  801272:	85 c0                	test   %eax,%eax
+  801274:	7f 41                	jg     8012b7 <sys_env_set_pgfault_upcall+0x76>
+  801276:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801279:	5b                   	pop    %ebx
+  80127a:	5e                   	pop    %esi
+  80127b:	5f                   	pop    %edi
+  80127c:	5d                   	pop    %ebp
+  80127d:	c3                   	ret
+  80127e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801283:	0f a2                	cpuid
+  801285:	c1 ea 0b             	shr    $0xb,%edx
+  801288:	83 e2 01             	and    $0x1,%edx
+  80128b:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801291:	eb c0                	jmp    801253 <sys_env_set_pgfault_upcall+0x12>
+  801293:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801298:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129e:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012a3:	89 df                	mov    %ebx,%edi
+  8012a5:	89 de                	mov    %ebx,%esi
+  8012a7:	55                   	push   %ebp
+  8012a8:	68 b1 12 80 00       	push   $0x8012b1
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	0f 34                	sysenter
+  8012b1:	83 c4 04             	add    $0x4,%esp
+  8012b4:	5d                   	pop    %ebp
+  8012b5:	eb bb                	jmp    801272 <sys_env_set_pgfault_upcall+0x31>
+  8012b7:	83 ec 0c             	sub    $0xc,%esp
+  8012ba:	50                   	push   %eax
+  8012bb:	6a 09                	push   $0x9
+  8012bd:	68 64 1d 80 00       	push   $0x801d64
+  8012c2:	6a 49                	push   $0x49
+  8012c4:	68 81 1d 80 00       	push   $0x801d81
+  8012c9:	e8 4a ee ff ff       	call   800118 <_panic>
+
+008012ce <sys_env_set_trace>:
+  8012ce:	55                   	push   %ebp
+  8012cf:	89 e5                	mov    %esp,%ebp
+  8012d1:	57                   	push   %edi
+  8012d2:	56                   	push   %esi
+  8012d3:	53                   	push   %ebx
+  8012d4:	83 ec 0c             	sub    $0xc,%esp
+  8012d7:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012de:	78 2b                	js     80130b <sys_env_set_trace+0x3d>
+  8012e0:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012e7:	75 37                	jne    801320 <sys_env_set_trace+0x52>
+  8012e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ee:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f9:	89 df                	mov    %ebx,%edi
+  8012fb:	89 de                	mov    %ebx,%esi
+  8012fd:	cd 30                	int    $0x30
+  8012ff:	85 c0                	test   %eax,%eax
+  801301:	7f 41                	jg     801344 <sys_env_set_trace+0x76>
+  801303:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801306:	5b                   	pop    %ebx
+  801307:	5e                   	pop    %esi
+  801308:	5f                   	pop    %edi
+  801309:	5d                   	pop    %ebp
+  80130a:	c3                   	ret
+  80130b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801310:	0f a2                	cpuid
+  801312:	c1 ea 0b             	shr    $0xb,%edx
+  801315:	83 e2 01             	and    $0x1,%edx
+  801318:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80131e:	eb c0                	jmp    8012e0 <sys_env_set_trace+0x12>
+  801320:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801325:	8b 55 08             	mov    0x8(%ebp),%edx
+  801328:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80132b:	b8 12 00 00 00       	mov    $0x12,%eax
+  801330:	89 df                	mov    %ebx,%edi
+  801332:	89 de                	mov    %ebx,%esi
+  801334:	55                   	push   %ebp
+  801335:	68 3e 13 80 00       	push   $0x80133e
+  80133a:	89 e5                	mov    %esp,%ebp
+  80133c:	0f 34                	sysenter
+  80133e:	83 c4 04             	add    $0x4,%esp
+  801341:	5d                   	pop    %ebp
+  801342:	eb bb                	jmp    8012ff <sys_env_set_trace+0x31>
+  801344:	83 ec 0c             	sub    $0xc,%esp
+  801347:	50                   	push   %eax
+  801348:	6a 12                	push   $0x12
+  80134a:	68 64 1d 80 00       	push   $0x801d64
+  80134f:	6a 49                	push   $0x49
+  801351:	68 81 1d 80 00       	push   $0x801d81
+  801356:	e8 bd ed ff ff       	call   800118 <_panic>
+
+0080135b <sys_env_set_rdpmc>:
+  80135b:	55                   	push   %ebp
+  80135c:	89 e5                	mov    %esp,%ebp
+  80135e:	57                   	push   %edi
+  80135f:	56                   	push   %esi
+  801360:	53                   	push   %ebx
+  801361:	83 ec 0c             	sub    $0xc,%esp
+  801364:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80136b:	78 2b                	js     801398 <sys_env_set_rdpmc+0x3d>
+  80136d:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801374:	75 37                	jne    8013ad <sys_env_set_rdpmc+0x52>
+  801376:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801380:	8b 55 08             	mov    0x8(%ebp),%edx
+  801383:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801386:	89 df                	mov    %ebx,%edi
+  801388:	89 de                	mov    %ebx,%esi
+  80138a:	cd 30                	int    $0x30
+  80138c:	85 c0                	test   %eax,%eax
+  80138e:	7f 41                	jg     8013d1 <sys_env_set_rdpmc+0x76>
+  801390:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801393:	5b                   	pop    %ebx
+  801394:	5e                   	pop    %esi
+  801395:	5f                   	pop    %edi
+  801396:	5d                   	pop    %ebp
+  801397:	c3                   	ret
+  801398:	b8 01 00 00 00       	mov    $0x1,%eax
+  80139d:	0f a2                	cpuid
+  80139f:	c1 ea 0b             	shr    $0xb,%edx
+  8013a2:	83 e2 01             	and    $0x1,%edx
+  8013a5:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8013ab:	eb c0                	jmp    80136d <sys_env_set_rdpmc+0x12>
+  8013ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013bd:	89 df                	mov    %ebx,%edi
+  8013bf:	89 de                	mov    %ebx,%esi
+  8013c1:	55                   	push   %ebp
+  8013c2:	68 cb 13 80 00       	push   $0x8013cb
+  8013c7:	89 e5                	mov    %esp,%ebp
+  8013c9:	0f 34                	sysenter
+  8013cb:	83 c4 04             	add    $0x4,%esp
+  8013ce:	5d                   	pop    %ebp
+  8013cf:	eb bb                	jmp    80138c <sys_env_set_rdpmc+0x31>
+  8013d1:	83 ec 0c             	sub    $0xc,%esp
+  8013d4:	50                   	push   %eax
+  8013d5:	6a 13                	push   $0x13
+  8013d7:	68 64 1d 80 00       	push   $0x801d64
+  8013dc:	6a 49                	push   $0x49
+  8013de:	68 81 1d 80 00       	push   $0x801d81
+  8013e3:	e8 30 ed ff ff       	call   800118 <_panic>
+
+008013e8 <sys_ring_setup>:
+  8013e8:	55                   	push   %ebp
+  8013e9:	89 e5                	mov    %esp,%ebp
+  8013eb:	57                   	push   %edi
+  8013ec:	56                   	push   %esi
+  8013ed:	53                   	push   %ebx
+  8013ee:	83 ec 0c             	sub    $0xc,%esp
+  8013f1:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8013f8:	78 29                	js     801423 <sys_ring_setup+0x3b>
+  8013fa:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801401:	75 35                	jne    801438 <sys_ring_setup+0x50>
+  801403:	ba 00 00 00 00       	mov    $0x0,%edx
+  801408:	b8 10 00 00 00       	mov    $0x10,%eax
+  80140d:	89 d1                	mov    %edx,%ecx
+  80140f:	89 d3                	mov    %edx,%ebx
+  801411:	89 d7                	mov    %edx,%edi
+  801413:	89 d6                	mov    %edx,%esi
+  801415:	cd 30                	int    $0x30
+  801417:	85 c0                	test   %eax,%eax
+  801419:	7f 3f                	jg     80145a <sys_ring_setup+0x72>
+  80141b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141e:	5b                   	pop    %ebx
+  80141f:	5e                   	pop    %esi
+  801420:	5f                   	pop    %edi
+  801421:	5d                   	pop    %ebp
+  801422:	c3                   	ret
+  801423:	b8 01 00 00 00       	mov    $0x1,%eax
+  801428:	0f a2                	cpuid
+  80142a:	c1 ea 0b             	shr    $0xb,%edx
+  80142d:	83 e2 01             	and    $0x1,%edx
+  801430:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801436:	eb c2                	jmp    8013fa <sys_ring_setup+0x12>
+  801438:	ba 00 00 00 00       	mov    $0x0,%edx
+  80143d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801442:	89 d1                	mov    %edx,%ecx
+  801444:	89 d3                	mov    %edx,%ebx
+  801446:	89 d7                	mov    %edx,%edi
+  801448:	89 d6                	mov    %edx,%esi
+  80144a:	55                   	push   %ebp
+  80144b:	68 54 14 80 00       	push   $0x801454
+  801450:	89 e5                	mov    %esp,%ebp
+  801452:	0f 34                	sysenter
+  801454:	83 c4 04             	add    $0x4,%esp
+  801457:	5d                   	pop    %ebp
+  801458:	eb bd                	jmp    801417 <sys_ring_setup+0x2f>
+  80145a:	83 ec 0c             	sub    $0xc,%esp
+  80145d:	50                   	push   %eax
+  80145e:	6a 10                	push   $0x10
+  801460:	68 64 1d 80 00       	push   $0x801d64
+  801465:	6a 49                	push   $0x49
+  801467:	68 81 1d 80 00       	push   $0x801d81
+  80146c:	e8 a7 ec ff ff       	call   800118 <_panic>
+
+00801471 <sys_ring_enter>:
+  801471:	55                   	push   %ebp
+  801472:	89 e5                	mov    %esp,%ebp
+  801474:	57                   	push   %edi
+  801475:	56                   	push   %esi
+  801476:	53                   	push   %ebx
+  801477:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80147e:	78 22                	js     8014a2 <sys_ring_enter+0x31>
+  801480:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801487:	75 2e                	jne    8014b7 <sys_ring_enter+0x46>
+  801489:	ba 00 00 00 00       	mov    $0x0,%edx
+  80148e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801493:	89 d1                	mov    %edx,%ecx
+  801495:	89 d3                	mov    %edx,%ebx
+  801497:	89 d7                	mov    %edx,%edi
+  801499:	89 d6                	mov    %edx,%esi
+  80149b:	cd 30                	int    $0x30
+  80149d:	5b                   	pop    %ebx
+  80149e:	5e                   	pop    %esi
+  80149f:	5f                   	pop    %edi
+  8014a0:	5d                   	pop    %ebp
+  8014a1:	c3                   	ret
+  8014a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014a7:	0f a2                	cpuid
+  8014a9:	c1 ea 0b             	shr    $0xb,%edx
+  8014ac:	83 e2 01             	and    $0x1,%edx
+  8014af:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8014b5:	eb c9                	jmp    801480 <sys_ring_enter+0xf>
+  8014b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014bc:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014c1:	89 d1                	mov    %edx,%ecx
+  8014c3:	89 d3                	mov    %edx,%ebx
+  8014c5:	89 d7                	mov    %edx,%edi
+  8014c7:	89 d6                	mov    %edx,%esi
+  8014c9:	55                   	push   %ebp
+  8014ca:	68 d3 14 80 00       	push   $0x8014d3
+  8014cf:	89 e5                	mov    %esp,%ebp
+  8014d1:	0f 34                	sysenter
+  8014d3:	83 c4 04             	add    $0x4,%esp
+  8014d6:	5d                   	pop    %ebp
+  8014d7:	eb c4                	jmp    80149d <sys_ring_enter+0x2c>
+
+008014d9 <sys_ipc_try_send>:
+  8014d9:	55                   	push   %ebp
+  8014da:	89 e5                	mov    %esp,%ebp
+  8014dc:	57                   	push   %edi
+  8014dd:	56                   	push   %esi
+  8014de:	53                   	push   %ebx
+  8014df:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014e6:	78 26                	js     80150e <sys_ipc_try_send+0x35>
+  8014e8:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014ef:	75 32                	jne    801523 <sys_ipc_try_send+0x4a>
+  8014f1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801501:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801504:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801507:	cd 30                	int    $0x30
+  801509:	5b                   	pop    %ebx
+  80150a:	5e                   	pop    %esi
+  80150b:	5f                   	pop    %edi
+  80150c:	5d                   	pop    %ebp
+  80150d:	c3                   	ret
+  80150e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801513:	0f a2                	cpuid
+  801515:	c1 ea 0b             	shr    $0xb,%edx
+  801518:	83 e2 01             	and    $0x1,%edx
+  80151b:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801521:	eb c5                	jmp    8014e8 <sys_ipc_try_send+0xf>
+  801523:	8b 55 08             	mov    0x8(%ebp),%edx
+  801526:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801529:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80152e:	be 00 00 00 00       	mov    $0x0,%esi
+  801533:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801536:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801539:	55                   	push   %ebp
+  80153a:	68 43 15 80 00       	push   $0x801543
+  80153f:	89 e5                	mov    %esp,%ebp
+  801541:	0f 34                	sysenter
+  801543:	83 c4 04             	add    $0x4,%esp
+  801546:	5d                   	pop    %ebp
+  801547:	eb c0                	jmp    801509 <sys_ipc_try_send+0x30>
+
+00801549 <sys_ipc_recv>:
+  801549:	55                   	push   %ebp
+  80154a:	89 e5                	mov    %esp,%ebp
+  80154c:	57                   	push   %edi
+  80154d:	56                   	push   %esi
+  80154e:	53                   	push   %ebx
+  80154f:	83 ec 0c             	sub    $0xc,%esp
+  801552:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801559:	78 2a                	js     801585 <sys_ipc_recv+0x3c>
+  80155b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801562:	75 36                	jne    80159a <sys_ipc_recv+0x51>
+  801564:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801569:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80156e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801571:	89 cb                	mov    %ecx,%ebx
+  801573:	89 cf                	mov    %ecx,%edi
+  801575:	89 ce                	mov    %ecx,%esi
+  801577:	cd 30                	int    $0x30
+  801579:	85 c0                	test   %eax,%eax
+  80157b:	7f 40                	jg     8015bd <sys_ipc_recv+0x74>
+  80157d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801580:	5b                   	pop    %ebx
+  801581:	5e                   	pop    %esi
+  801582:	5f                   	pop    %edi
+  801583:	5d                   	pop    %ebp
+  801584:	c3                   	ret
+  801585:	b8 01 00 00 00       	mov    $0x1,%eax
+  80158a:	0f a2                	cpuid
+  80158c:	c1 ea 0b             	shr    $0xb,%edx
+  80158f:	83 e2 01             	and    $0x1,%edx
+  801592:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801598:	eb c1                	jmp    80155b <sys_ipc_recv+0x12>
+  80159a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8015a7:	89 cb                	mov    %ecx,%ebx
+  8015a9:	89 cf                	mov    %ecx,%edi
+  8015ab:	89 ce                	mov    %ecx,%esi
+  8015ad:	55                   	push   %ebp
+  8015ae:	68 b7 15 80 00       	push   $0x8015b7
+  8015b3:	89 e5                	mov    %esp,%ebp
+  8015b5:	0f 34                	sysenter
+  8015b7:	83 c4 04             	add    $0x4,%esp
+  8015ba:	5d                   	pop    %ebp
+  8015bb:	eb bc                	jmp    801579 <sys_ipc_recv+0x30>
+  8015bd:	83 ec 0c             	sub    $0xc,%esp
+  8015c0:	50                   	push   %eax
+  8015c1:	6a 0c                	push   $0xc
+  8015c3:	68 64 1d 80 00       	push   $0x801d64
+  8015c8:	6a 49                	push   $0x49
+  8015ca:	68 81 1d 80 00       	push   $0x801d81
+  8015cf:	e8 44 eb ff ff       	call   800118 <_panic>
+
+008015d4 <set_pgfault_handler>:
+  8015d4:	55                   	push   %ebp
+  8015d5:	89 e5                	mov    %esp,%ebp
+  8015d7:	83 ec 08             	sub    $0x8,%esp
+  8015da:	83 3d 24 20 80 00 00 	cmpl   $0x0,0x802024
+  8015e1:	74 0a                	je     8015ed <set_pgfault_handler+0x19>
+  8015e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e6:	a3 24 20 80 00       	mov    %eax,0x802024
+  8015eb:	c9                   	leave
+  8015ec:	c3                   	ret
+  8015ed:	83 ec 04             	sub    $0x4,%esp
+  8015f0:	6a 07                	push   $0x7
+  8015f2:	68 00 f0 ff ea       	push   $0xeafff000
+  8015f7:	6a 00                	push   $0x0
+  8015f9:	e8 a1 f9 ff ff       	call   800f9f <sys_page_alloc>
+  8015fe:	83 c4 10             	add    $0x10,%esp
+  801601:	85 c0                	test   %eax,%eax
+  801603:	75 2a                	jne    80162f <set_pgfault_handler+0x5b>
+  801605:	83 ec 08             	sub    $0x8,%esp
+  801608:	68 43 16 80 00       	push   $0x801643
+  80160d:	6a 00                	push   $0x0
+  80160f:	e8 2d fc ff ff       	call   801241 <sys_env_set_pgfault_upcall>
+  801614:	83 c4 10             	add    $0x10,%esp
+  801617:	85 c0                	test   %eax,%eax
+  801619:	74 c8                	je     8015e3 <set_pgfault_handler+0xf>
+  80161b:	83 ec 04             	sub    $0x4,%esp
+  80161e:	68 b4 1d 80 00       	push   $0x801db4
+  801623:	6a 28                	push   $0x28
+  801625:	68 a5 1d 80 00       	push   $0x801da5
+  80162a:	e8 e9 ea ff ff       	call   800118 <_panic>
+  80162f:	83 ec 04             	sub    $0x4,%esp
+  801632:	68 8f 1d 80 00       	push   $0x801d8f
+  801637:	6a 22                	push   $0x22
+  801639:	68 a5 1d 80 00       	push   $0x801da5
+  80163e:	e8 d5 ea ff ff       	call   800118 <_panic>
+
+00801643 <_pgfault_upcall>:
+  801643:	54                   	push   %esp
+  801644:	a1 24 20 80 00       	mov    0x802024,%eax
+  801649:	ff d0                	call   *%eax
+  80164b:	83 c4 04             	add    $0x4,%esp
+  80164e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  801652:	89 e5                	mov    %esp,%ebp
+  801654:	8b 64 24 30          	mov    0x30(%esp),%esp
+  801658:	50                   	push   %eax
+  801659:	89 ec                	mov    %ebp,%esp
+  80165b:	83 c4 08             	add    $0x8,%esp
+  80165e:	61                   	popa
+  80165f:	83 c4 04             	add    $0x4,%esp
+  801662:	9d                   	popf
+  801663:	5c                   	pop    %esp
+  801664:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+  801668:	c3                   	ret
+
+00801669 <uinfo_envid>:
+  801669:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  80166e:	c3                   	ret
+
+0080166f <uinfo_cpunum>:
+  80166f:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  801674:	c3                   	ret
+
+00801675 <uinfo_ticks>:
+  801675:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  80167a:	c3                   	ret
+
+0080167b <uinfo_nsec>:
+  80167b:	55                   	push   %ebp
+  80167c:	89 e5                	mov    %esp,%ebp
+  80167e:	57                   	push   %edi
+  80167f:	56                   	push   %esi
+  801680:	53                   	push   %ebx
+  801681:	83 ec 1c             	sub    $0x1c,%esp
+  801684:	0f 31                	rdtsc
+  801686:	89 c6                	mov    %eax,%esi
+  801688:	89 d7                	mov    %edx,%edi
+  80168a:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801690:	b8 00 00 00 00       	mov    $0x0,%eax
+  801695:	ba 00 00 00 00       	mov    $0x0,%edx
+  80169a:	85 c9                	test   %ecx,%ecx
+  80169c:	74 5c                	je     8016fa <uinfo_nsec+0x7f>
+  80169e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016a3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8016a6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8016a9:	52                   	push   %edx
+  8016aa:	51                   	push   %ecx
+  8016ab:	57                   	push   %edi
+  8016ac:	56                   	push   %esi
+  8016ad:	e8 1f 02 00 00       	call   8018d1 <__umoddi3>
+  8016b2:	83 c4 10             	add    $0x10,%esp
+  8016b5:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  8016bb:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  8016c0:	f7 e3                	mul    %ebx
+  8016c2:	01 ca                	add    %ecx,%edx
+  8016c4:	ff 75 e4             	push   -0x1c(%ebp)
+  8016c7:	ff 75 e0             	push   -0x20(%ebp)
+  8016ca:	52                   	push   %edx
+  8016cb:	50                   	push   %eax
+  8016cc:	e8 28 01 00 00       	call   8017f9 <__udivdi3>
+  8016d1:	83 c4 10             	add    $0x10,%esp
+  8016d4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8016d7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8016da:	ff 75 e4             	push   -0x1c(%ebp)
+  8016dd:	ff 75 e0             	push   -0x20(%ebp)
+  8016e0:	57                   	push   %edi
+  8016e1:	56                   	push   %esi
+  8016e2:	e8 12 01 00 00       	call   8017f9 <__udivdi3>
+  8016e7:	83 c4 10             	add    $0x10,%esp
+  8016ea:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  8016f0:	f7 e3                	mul    %ebx
+  8016f2:	01 ca                	add    %ecx,%edx
+  8016f4:	03 45 d8             	add    -0x28(%ebp),%eax
+  8016f7:	13 55 dc             	adc    -0x24(%ebp),%edx
+  8016fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016fd:	5b                   	pop    %ebx
+  8016fe:	5e                   	pop    %esi
+  8016ff:	5f                   	pop    %edi
+  801700:	5d                   	pop    %ebp
+  801701:	c3                   	ret
+
+00801702 <bflush>:
+  801702:	a1 40 20 80 00       	mov    0x802040,%eax
+  801707:	85 c0                	test   %eax,%eax
+  801709:	75 01                	jne    80170c <bflush+0xa>
+  80170b:	c3                   	ret
+  80170c:	55                   	push   %ebp
+  80170d:	89 e5                	mov    %esp,%ebp
+  80170f:	83 ec 10             	sub    $0x10,%esp
+  801712:	50                   	push   %eax
+  801713:	68 44 20 80 00       	push   $0x802044
+  801718:	e8 3f f5 ff ff       	call   800c5c <sys_cputs>
+  80171d:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  801724:	00 00 00 
+  801727:	83 c4 10             	add    $0x10,%esp
+  80172a:	c9                   	leave
+  80172b:	c3                   	ret
+
+0080172c <bputch>:
+  80172c:	55                   	push   %ebp
+  80172d:	89 e5                	mov    %esp,%ebp
+  80172f:	53                   	push   %ebx
+  801730:	83 ec 04             	sub    $0x4,%esp
+  801733:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801736:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  80173c:	8d 42 01             	lea    0x1(%edx),%eax
+  80173f:	a3 40 20 80 00       	mov    %eax,0x802040
+  801744:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801747:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  80174d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801752:	77 08                	ja     80175c <bputch+0x30>
+  801754:	83 03 01             	addl   $0x1,(%ebx)
+  801757:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80175a:	c9                   	leave
+  80175b:	c3                   	ret
+  80175c:	e8 a1 ff ff ff       	call   801702 <bflush>
+  801761:	eb f1                	jmp    801754 <bputch+0x28>
+
+00801763 <vbprintf>:
+  801763:	55                   	push   %ebp
+  801764:	89 e5                	mov    %esp,%ebp
+  801766:	83 ec 18             	sub    $0x18,%esp
+  801769:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801770:	ff 75 0c             	push   0xc(%ebp)
+  801773:	ff 75 08             	push   0x8(%ebp)
+  801776:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801779:	50                   	push   %eax
+  80177a:	68 2c 17 80 00       	push   $0x80172c
+  80177f:	e8 6b eb ff ff       	call   8002ef <vprintfmt>
+  801784:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801787:	c9                   	leave
+  801788:	c3                   	ret
+
+00801789 <bprintf>:
+  801789:	55                   	push   %ebp
+  80178a:	89 e5                	mov    %esp,%ebp
+  80178c:	83 ec 10             	sub    $0x10,%esp
+  80178f:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801792:	50                   	push   %eax
+  801793:	ff 75 08             	push   0x8(%ebp)
+  801796:	e8 c8 ff ff ff       	call   801763 <vbprintf>
+  80179b:	c9                   	leave
+  80179c:	c3                   	ret
+
+0080179d <bwrite>:
+  80179d:	55                   	push   %ebp
+  80179e:	89 e5                	mov    %esp,%ebp
+  8017a0:	53                   	push   %ebx
+  8017a1:	83 ec 04             	sub    $0x4,%esp
+  8017a4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8017a7:	89 d8                	mov    %ebx,%eax
+  8017a9:	03 05 40 20 80 00    	add    0x802040,%eax
+  8017af:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8017b4:	76 0d                	jbe    8017c3 <bwrite+0x26>
+  8017b6:	e8 47 ff ff ff       	call   801702 <bflush>
+  8017bb:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  8017c1:	77 25                	ja     8017e8 <bwrite+0x4b>
+  8017c3:	83 ec 04             	sub    $0x4,%esp
+  8017c6:	53                   	push   %ebx
+  8017c7:	ff 75 08             	push   0x8(%ebp)
+  8017ca:	a1 40 20 80 00       	mov    0x802040,%eax
+  8017cf:	05 44 20 80 00       	add    $0x802044,%eax
+  8017d4:	50                   	push   %eax
+  8017d5:	e8 80 f2 ff ff       	call   800a5a <memcpy>
+  8017da:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  8017e0:	83 c4 10             	add    $0x10,%esp
+  8017e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017e6:	c9                   	leave
+  8017e7:	c3                   	ret
+  8017e8:	83 ec 08             	sub    $0x8,%esp
+  8017eb:	53                   	push   %ebx
+  8017ec:	ff 75 08             	push   0x8(%ebp)
+  8017ef:	e8 68 f4 ff ff       	call   800c5c <sys_cputs>
+  8017f4:	83 c4 10             	add    $0x10,%esp
+  8017f7:	eb ea                	jmp    8017e3 <bwrite+0x46>
+
+008017f9 <__udivdi3>:
+  8017f9:	57                   	push   %edi
+  8017fa:	56                   	push   %esi
+  8017fb:	53                   	push   %ebx
+  8017fc:	83 ec 20             	sub    $0x20,%esp
+  8017ff:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801803:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801807:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80180b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80180f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801813:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801817:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80181b:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80181f:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801823:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801827:	89 d1                	mov    %edx,%ecx
+  801829:	09 c1                	or     %eax,%ecx
+  80182b:	0f 84 91 00 00 00    	je     8018c2 <__udivdi3+0xc9>
+  801831:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801838:	00 
+  801839:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801840:	00 
+  801841:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801846:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801850:	eb 08                	jmp    80185a <__udivdi3+0x61>
+  801852:	83 e9 01             	sub    $0x1,%ecx
+  801855:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801858:	74 68                	je     8018c2 <__udivdi3+0xc9>
+  80185a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80185e:	01 c0                	add    %eax,%eax
+  801860:	89 c6                	mov    %eax,%esi
+  801862:	89 d7                	mov    %edx,%edi
+  801864:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801868:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80186c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80186f:	d3 ea                	shr    %cl,%edx
+  801871:	f6 c1 20             	test   $0x20,%cl
+  801874:	74 04                	je     80187a <__udivdi3+0x81>
+  801876:	89 d0                	mov    %edx,%eax
+  801878:	31 d2                	xor    %edx,%edx
+  80187a:	83 e0 01             	and    $0x1,%eax
+  80187d:	89 04 24             	mov    %eax,(%esp)
+  801880:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801887:	00 
+  801888:	8b 04 24             	mov    (%esp),%eax
+  80188b:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80188f:	09 f0                	or     %esi,%eax
+  801891:	09 fa                	or     %edi,%edx
+  801893:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801897:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80189b:	39 f0                	cmp    %esi,%eax
+  80189d:	89 d3                	mov    %edx,%ebx
+  80189f:	19 fb                	sbb    %edi,%ebx
+  8018a1:	72 af                	jb     801852 <__udivdi3+0x59>
+  8018a3:	29 f0                	sub    %esi,%eax
+  8018a5:	19 fa                	sbb    %edi,%edx
+  8018a7:	89 cf                	mov    %ecx,%edi
+  8018a9:	c1 ef 05             	shr    $0x5,%edi
+  8018ac:	83 e7 01             	and    $0x1,%edi
+  8018af:	89 fe                	mov    %edi,%esi
+  8018b1:	83 f6 01             	xor    $0x1,%esi
+  8018b4:	d3 e6                	shl    %cl,%esi
+  8018b6:	d3 e7                	shl    %cl,%edi
+  8018b8:	09 74 24 18          	or     %esi,0x18(%esp)
+  8018bc:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8018c0:	eb 90                	jmp    801852 <__udivdi3+0x59>
+  8018c2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8018c6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8018ca:	83 c4 20             	add    $0x20,%esp
+  8018cd:	5b                   	pop    %ebx
+  8018ce:	5e                   	pop    %esi
+  8018cf:	5f                   	pop    %edi
+  8018d0:	c3                   	ret
+
+008018d1 <__umoddi3>:
+  8018d1:	55                   	push   %ebp
+  8018d2:	57                   	push   %edi
+  8018d3:	56                   	push   %esi
+  8018d4:	53                   	push   %ebx
+  8018d5:	83 ec 1c             	sub    $0x1c,%esp
+  8018d8:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8018dc:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8018e0:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8018e4:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8018e8:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8018ec:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8018f0:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8018f4:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8018f8:	89 d6                	mov    %edx,%esi
+  8018fa:	09 c6                	or     %eax,%esi
+  8018fc:	74 6c                	je     80196a <__umoddi3+0x99>
+  8018fe:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801903:	b8 00 00 00 00       	mov    $0x0,%eax
+  801908:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190d:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801911:	eb 0e                	jmp    801921 <__umoddi3+0x50>
+  801913:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801918:	8b 74 24 04          	mov    0x4(%esp),%esi
+  80191c:	83 fe ff             	cmp    $0xffffffff,%esi
+  80191f:	74 49                	je     80196a <__umoddi3+0x99>
+  801921:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801925:	01 c0                	add    %eax,%eax
+  801927:	89 c3                	mov    %eax,%ebx
+  801929:	89 d6                	mov    %edx,%esi
+  80192b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80192f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801933:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801938:	0f ad d0             	shrd   %cl,%edx,%eax
+  80193b:	d3 ea                	shr    %cl,%edx
+  80193d:	f6 c1 20             	test   $0x20,%cl
+  801940:	74 04                	je     801946 <__umoddi3+0x75>
+  801942:	89 d0                	mov    %edx,%eax
+  801944:	31 d2                	xor    %edx,%edx
+  801946:	83 e0 01             	and    $0x1,%eax
+  801949:	bd 00 00 00 00       	mov    $0x0,%ebp
+  80194e:	89 ea                	mov    %ebp,%edx
+  801950:	09 d8                	or     %ebx,%eax
+  801952:	09 f2                	or     %esi,%edx
+  801954:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801958:	8b 74 24 14          	mov    0x14(%esp),%esi
+  80195c:	39 d8                	cmp    %ebx,%eax
+  80195e:	89 d1                	mov    %edx,%ecx
+  801960:	19 f1                	sbb    %esi,%ecx
+  801962:	72 af                	jb     801913 <__umoddi3+0x42>
+  801964:	29 d8                	sub    %ebx,%eax
+  801966:	19 f2                	sbb    %esi,%edx
+  801968:	eb a9                	jmp    801913 <__umoddi3+0x42>
+  80196a:	83 c4 1c             	add    $0x1c,%esp
+  80196d:	5b                   	pop    %ebx
+  80196e:	5e                   	pop    %esi
+  80196f:	5f                   	pop    %edi
+  801970:	5d                   	pop    %ebp
+  801971:	c3                   	ret
+
+00801972 <__divdi3>:
+  801972:	53                   	push   %ebx
+  801973:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801977:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80197b:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80197f:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801983:	85 d2                	test   %edx,%edx
+  801985:	78 12                	js     801999 <__divdi3+0x27>
+  801987:	85 db                	test   %ebx,%ebx
+  801989:	78 2e                	js     8019b9 <__divdi3+0x47>
+  80198b:	53                   	push   %ebx
+  80198c:	51                   	push   %ecx
+  80198d:	52                   	push   %edx
+  80198e:	50                   	push   %eax
+  80198f:	e8 65 fe ff ff       	call   8017f9 <__udivdi3>
+  801994:	83 c4 10             	add    $0x10,%esp
+  801997:	eb 1e                	jmp    8019b7 <__divdi3+0x45>
+  801999:	f7 d8                	neg    %eax
+  80199b:	83 d2 00             	adc    $0x0,%edx
+  80199e:	f7 da                	neg    %edx
+  8019a0:	85 db                	test   %ebx,%ebx
+  8019a2:	78 2a                	js     8019ce <__divdi3+0x5c>
+  8019a4:	53                   	push   %ebx
+  8019a5:	51                   	push   %ecx
+  8019a6:	52                   	push   %edx
+  8019a7:	50                   	push   %eax
+  8019a8:	e8 4c fe ff ff       	call   8017f9 <__udivdi3>
+  8019ad:	83 c4 10             	add    $0x10,%esp
+  8019b0:	f7 d8                	neg    %eax
+  8019b2:	83 d2 00             	adc    $0x0,%edx
+  8019b5:	f7 da                	neg    %edx
+  8019b7:	5b                   	pop    %ebx
+  8019b8:	c3                   	ret
+  8019b9:	f7 d9                	neg    %ecx
+  8019bb:	83 d3 00             	adc    $0x0,%ebx
+  8019be:	f7 db                	neg    %ebx
+  8019c0:	53                   	push   %ebx
+  8019c1:	51                   	push   %ecx
+  8019c2:	52                   	push   %edx
+  8019c3:	50                   	push   %eax
+  8019c4:	e8 30 fe ff ff       	call   8017f9 <__udivdi3>
+  8019c9:	83 c4 10             	add    $0x10,%esp
+  8019cc:	eb e2                	jmp    8019b0 <__divdi3+0x3e>
+  8019ce:	f7 d9                	neg    %ecx
+  8019d0:	83 d3 00             	adc    $0x0,%ebx
+  8019d3:	f7 db                	neg    %ebx
+  8019d5:	53                   	push   %ebx
+  8019d6:	51                   	push   %ecx
+  8019d7:	52                   	push   %edx
+  8019d8:	50                   	push   %eax
+  8019d9:	e8 1b fe ff ff       	call   8017f9 <__udivdi3>
+  8019de:	83 c4 10             	add    $0x10,%esp
+  8019e1:	eb d4                	jmp    8019b7 <__divdi3+0x45>
+
+008019e3 <__moddi3>:
+  8019e3:	55                   	push   %ebp
+  8019e4:	57                   	push   %edi
+  8019e5:	56                   	push   %esi
+  8019e6:	53                   	push   %ebx
+  8019e7:	83 ec 14             	sub    $0x14,%esp
+  8019ea:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  8019ee:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  8019f2:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8019f6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8019fa:	85 ed                	test   %ebp,%ebp
+  8019fc:	78 2b                	js     801a29 <__moddi3+0x46>
+  8019fe:	89 c6                	mov    %eax,%esi
+  801a00:	f7 de                	neg    %esi
+  801a02:	89 34 24             	mov    %esi,(%esp)
+  801a05:	89 d6                	mov    %edx,%esi
+  801a07:	83 d6 00             	adc    $0x0,%esi
+  801a0a:	f7 de                	neg    %esi
+  801a0c:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801a10:	8b 34 24             	mov    (%esp),%esi
+  801a13:	0f 48 f0             	cmovs  %eax,%esi
+  801a16:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801a1b:	52                   	push   %edx
+  801a1c:	56                   	push   %esi
+  801a1d:	55                   	push   %ebp
+  801a1e:	57                   	push   %edi
+  801a1f:	e8 ad fe ff ff       	call   8018d1 <__umoddi3>
+  801a24:	83 c4 10             	add    $0x10,%esp
+  801a27:	eb 3c                	jmp    801a65 <__moddi3+0x82>
+  801a29:	89 c3                	mov    %eax,%ebx
+  801a2b:	f7 db                	neg    %ebx
+  801a2d:	89 d1                	mov    %edx,%ecx
+  801a2f:	83 d1 00             	adc    $0x0,%ecx
+  801a32:	f7 d9                	neg    %ecx
+  801a34:	0f 49 c3             	cmovns %ebx,%eax
+  801a37:	89 04 24             	mov    %eax,(%esp)
+  801a3a:	0f 49 d1             	cmovns %ecx,%edx
+  801a3d:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801a41:	ff 74 24 04          	push   0x4(%esp)
+  801a45:	ff 74 24 04          	push   0x4(%esp)
+  801a49:	89 f8                	mov    %edi,%eax
+  801a4b:	89 ea                	mov    %ebp,%edx
+  801a4d:	f7 d8                	neg    %eax
+  801a4f:	83 d2 00             	adc    $0x0,%edx
+  801a52:	f7 da                	neg    %edx
+  801a54:	52                   	push   %edx
+  801a55:	50                   	push   %eax
+  801a56:	e8 76 fe ff ff       	call   8018d1 <__umoddi3>
+  801a5b:	83 c4 10             	add    $0x10,%esp
+  801a5e:	f7 d8                	neg    %eax
+  801a60:	83 d2 00             	adc    $0x0,%edx
+  801a63:	f7 da                	neg    %edx
+  801a65:	83 c4 14             	add    $0x14,%esp
+  801a68:	5b                   	pop    %ebx
+  801a69:	5e                   	pop    %esi
+  801a6a:	5f                   	pop    %edi
+  801a6b:	5d                   	pop    %ebp
+  801a6c:	c3                   	ret
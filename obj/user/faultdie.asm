@@ -0,0 +1,2647 @@
+
+obj/user/faultdie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 4f 00 00 00       	call   800080 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+  800039:	8b 55 08             	mov    0x8(%ebp),%edx
+  80003c:	8b 42 04             	mov    0x4(%edx),%eax
+  80003f:	83 e0 07             	and    $0x7,%eax
+  800042:	50                   	push   %eax
+  800043:	ff 32                	push   (%edx)
+  800045:	68 40 1a 80 00       	push   $0x801a40
+  80004a:	e8 29 01 00 00       	call   800178 <cprintf>
+  80004f:	e8 e1 0c 00 00       	call   800d35 <sys_getenvid>
+  800054:	89 04 24             	mov    %eax,(%esp)
+  800057:	e8 4e 0c 00 00       	call   800caa <sys_env_destroy>
+  80005c:	83 c4 10             	add    $0x10,%esp
+  80005f:	c9                   	leave
+  800060:	c3                   	ret
+
+00800061 <umain>:
+  800061:	55                   	push   %ebp
+  800062:	89 e5                	mov    %esp,%ebp
+  800064:	83 ec 14             	sub    $0x14,%esp
+  800067:	68 33 00 80 00       	push   $0x800033
+  80006c:	e8 e3 14 00 00       	call   801554 <set_pgfault_handler>
+  800071:	c7 05 ef be ad de 00 	movl   $0x0,0xdeadbeef
+  800078:	00 00 00 
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	c9                   	leave
+  80007f:	c3                   	ret
+
+00800080 <libmain>:
+  800080:	55                   	push   %ebp
+  800081:	89 e5                	mov    %esp,%ebp
+  800083:	56                   	push   %esi
+  800084:	53                   	push   %ebx
+  800085:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800088:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80008b:	e8 59 15 00 00       	call   8015e9 <uinfo_envid>
+  800090:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  800095:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  80009b:	05 00 00 00 ed       	add    $0xed000000,%eax
+  8000a0:	a3 20 20 80 00       	mov    %eax,0x802020
+  8000a5:	85 db                	test   %ebx,%ebx
+  8000a7:	7e 07                	jle    8000b0 <libmain+0x30>
+  8000a9:	8b 06                	mov    (%esi),%eax
+  8000ab:	a3 00 20 80 00       	mov    %eax,0x802000
+  8000b0:	83 ec 08             	sub    $0x8,%esp
+  8000b3:	56                   	push   %esi
+  8000b4:	53                   	push   %ebx
+  8000b5:	e8 a7 ff ff ff       	call   800061 <umain>
+  8000ba:	e8 0a 00 00 00       	call   8000c9 <exit>
+  8000bf:	83 c4 10             	add    $0x10,%esp
+  8000c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c5:	5b                   	pop    %ebx
+  8000c6:	5e                   	pop    %esi
+  8000c7:	5d                   	pop    %ebp
+  8000c8:	c3                   	ret
+
+008000c9 <exit>:
+  8000c9:	55                   	push   %ebp
+  8000ca:	89 e5                	mov    %esp,%ebp
+  8000cc:	83 ec 08             	sub    $0x8,%esp
+  8000cf:	e8 ae 15 00 00       	call   801682 <bflush>
+  8000d4:	83 ec 0c             	sub    $0xc,%esp
+  8000d7:	6a 00                	push   $0x0
+  8000d9:	e8 cc 0b 00 00       	call   800caa <sys_env_destroy>
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+
+008000e3 <putch>:
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	53                   	push   %ebx
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8000ed:	8b 13                	mov    (%ebx),%edx
+  8000ef:	8d 42 01             	lea    0x1(%edx),%eax
+  8000f2:	89 03                	mov    %eax,(%ebx)
+  8000f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000f7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8000fb:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800100:	74 09                	je     80010b <putch+0x28>
+  800102:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800106:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800109:	c9                   	leave
+  80010a:	c3                   	ret
+  80010b:	83 ec 08             	sub    $0x8,%esp
+  80010e:	68 ff 00 00 00       	push   $0xff
+  800113:	8d 43 08             	lea    0x8(%ebx),%eax
+  800116:	50                   	push   %eax
+  800117:	e8 c0 0a 00 00       	call   800bdc <sys_cputs>
+  80011c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	eb db                	jmp    800102 <putch+0x1f>
+
+00800127 <vcprintf>:
+  800127:	55                   	push   %ebp
+  800128:	89 e5                	mov    %esp,%ebp
+  80012a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800130:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800137:	00 00 00 
+  80013a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800141:	00 00 00 
+  800144:	ff 75 0c             	push   0xc(%ebp)
+  800147:	ff 75 08             	push   0x8(%ebp)
+  80014a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800150:	50                   	push   %eax
+  800151:	68 e3 00 80 00       	push   $0x8000e3
+  800156:	e8 14 01 00 00       	call   80026f <vprintfmt>
+  80015b:	83 c4 08             	add    $0x8,%esp
+  80015e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800164:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80016a:	50                   	push   %eax
+  80016b:	e8 6c 0a 00 00       	call   800bdc <sys_cputs>
+  800170:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800176:	c9                   	leave
+  800177:	c3                   	ret
+
+00800178 <cprintf>:
+  800178:	55                   	push   %ebp
+  800179:	89 e5                	mov    %esp,%ebp
+  80017b:	83 ec 10             	sub    $0x10,%esp
+  80017e:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800181:	50                   	push   %eax
+  800182:	ff 75 08             	push   0x8(%ebp)
+  800185:	e8 9d ff ff ff       	call   800127 <vcprintf>
+  80018a:	c9                   	leave
+  80018b:	c3                   	ret
+
+0080018c <printnum>:
+  80018c:	55                   	push   %ebp
+  80018d:	89 e5                	mov    %esp,%ebp
+  80018f:	57                   	push   %edi
+  800190:	56                   	push   %esi
+  800191:	53                   	push   %ebx
+  800192:	83 ec 1c             	sub    $0x1c,%esp
+  800195:	89 c7                	mov    %eax,%edi
+  800197:	89 d6                	mov    %edx,%esi
+  800199:	8b 45 08             	mov    0x8(%ebp),%eax
+  80019c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80019f:	89 d1                	mov    %edx,%ecx
+  8001a1:	89 c2                	mov    %eax,%edx
+  8001a3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001a6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001a9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ac:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8001af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001b2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001b9:	39 c2                	cmp    %eax,%edx
+  8001bb:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001be:	72 3e                	jb     8001fe <printnum+0x72>
+  8001c0:	83 ec 0c             	sub    $0xc,%esp
+  8001c3:	ff 75 18             	push   0x18(%ebp)
+  8001c6:	83 eb 01             	sub    $0x1,%ebx
+  8001c9:	53                   	push   %ebx
+  8001ca:	50                   	push   %eax
+  8001cb:	83 ec 08             	sub    $0x8,%esp
+  8001ce:	ff 75 e4             	push   -0x1c(%ebp)
+  8001d1:	ff 75 e0             	push   -0x20(%ebp)
+  8001d4:	ff 75 dc             	push   -0x24(%ebp)
+  8001d7:	ff 75 d8             	push   -0x28(%ebp)
+  8001da:	e8 e5 15 00 00       	call   8017c4 <__udivdi3>
+  8001df:	83 c4 18             	add    $0x18,%esp
+  8001e2:	52                   	push   %edx
+  8001e3:	50                   	push   %eax
+  8001e4:	89 f2                	mov    %esi,%edx
+  8001e6:	89 f8                	mov    %edi,%eax
+  8001e8:	e8 9f ff ff ff       	call   80018c <printnum>
+  8001ed:	83 c4 20             	add    $0x20,%esp
+  8001f0:	eb 13                	jmp    800205 <printnum+0x79>
+  8001f2:	83 ec 08             	sub    $0x8,%esp
+  8001f5:	56                   	push   %esi
+  8001f6:	ff 75 18             	push   0x18(%ebp)
+  8001f9:	ff d7                	call   *%edi
+  8001fb:	83 c4 10             	add    $0x10,%esp
+  8001fe:	83 eb 01             	sub    $0x1,%ebx
+  800201:	85 db                	test   %ebx,%ebx
+  800203:	7f ed                	jg     8001f2 <printnum+0x66>
+  800205:	83 ec 08             	sub    $0x8,%esp
+  800208:	56                   	push   %esi
+  800209:	83 ec 04             	sub    $0x4,%esp
+  80020c:	ff 75 e4             	push   -0x1c(%ebp)
+  80020f:	ff 75 e0             	push   -0x20(%ebp)
+  800212:	ff 75 dc             	push   -0x24(%ebp)
+  800215:	ff 75 d8             	push   -0x28(%ebp)
+  800218:	e8 7f 16 00 00       	call   80189c <__umoddi3>
+  80021d:	83 c4 14             	add    $0x14,%esp
+  800220:	0f be 80 66 1a 80 00 	movsbl 0x801a66(%eax),%eax
+  800227:	50                   	push   %eax
+  800228:	ff d7                	call   *%edi
+  80022a:	83 c4 10             	add    $0x10,%esp
+  80022d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800230:	5b                   	pop    %ebx
+  800231:	5e                   	pop    %esi
+  800232:	5f                   	pop    %edi
+  800233:	5d                   	pop    %ebp
+  800234:	c3                   	ret
+
+00800235 <sprintputch>:
+  800235:	55                   	push   %ebp
+  800236:	89 e5                	mov    %esp,%ebp
+  800238:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80023b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80023f:	8b 10                	mov    (%eax),%edx
+  800241:	3b 50 04             	cmp    0x4(%eax),%edx
+  800244:	73 0a                	jae    800250 <sprintputch+0x1b>
+  800246:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800249:	89 08                	mov    %ecx,(%eax)
+  80024b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80024e:	88 02                	mov    %al,(%edx)
+  800250:	5d                   	pop    %ebp
+  800251:	c3                   	ret
+
+00800252 <printfmt>:
+  800252:	55                   	push   %ebp
+  800253:	89 e5                	mov    %esp,%ebp
+  800255:	83 ec 08             	sub    $0x8,%esp
+  800258:	8d 45 14             	lea    0x14(%ebp),%eax
+  80025b:	50                   	push   %eax
+  80025c:	ff 75 10             	push   0x10(%ebp)
+  80025f:	ff 75 0c             	push   0xc(%ebp)
+  800262:	ff 75 08             	push   0x8(%ebp)
+  800265:	e8 05 00 00 00       	call   80026f <vprintfmt>
+  80026a:	83 c4 10             	add    $0x10,%esp
+  80026d:	c9                   	leave
+  80026e:	c3                   	ret
+
+0080026f <vprintfmt>:
+  80026f:	55                   	push   %ebp
+  800270:	89 e5                	mov    %esp,%ebp
+  800272:	57                   	push   %edi
+  800273:	56                   	push   %esi
+  800274:	53                   	push   %ebx
+  800275:	83 ec 2c             	sub    $0x2c,%esp
+  800278:	8b 75 08             	mov    0x8(%ebp),%esi
+  80027b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80027e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800281:	eb 0a                	jmp    80028d <vprintfmt+0x1e>
+  800283:	83 ec 08             	sub    $0x8,%esp
+  800286:	53                   	push   %ebx
+  800287:	50                   	push   %eax
+  800288:	ff d6                	call   *%esi
+  80028a:	83 c4 10             	add    $0x10,%esp
+  80028d:	83 c7 01             	add    $0x1,%edi
+  800290:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800294:	83 f8 25             	cmp    $0x25,%eax
+  800297:	74 0c                	je     8002a5 <vprintfmt+0x36>
+  800299:	85 c0                	test   %eax,%eax
+  80029b:	75 e6                	jne    800283 <vprintfmt+0x14>
+  80029d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a0:	5b                   	pop    %ebx
+  8002a1:	5e                   	pop    %esi
+  8002a2:	5f                   	pop    %edi
+  8002a3:	5d                   	pop    %ebp
+  8002a4:	c3                   	ret
+  8002a5:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  8002a9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8002b0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8002b7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  8002be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002c3:	8d 47 01             	lea    0x1(%edi),%eax
+  8002c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002c9:	0f b6 17             	movzbl (%edi),%edx
+  8002cc:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002cf:	3c 55                	cmp    $0x55,%al
+  8002d1:	0f 87 cf 03 00 00    	ja     8006a6 <vprintfmt+0x437>
+  8002d7:	0f b6 c0             	movzbl %al,%eax
+  8002da:	ff 24 85 20 1b 80 00 	jmp    *0x801b20(,%eax,4)
+  8002e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002e4:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002e8:	eb d9                	jmp    8002c3 <vprintfmt+0x54>
+  8002ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002ed:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002f1:	eb d0                	jmp    8002c3 <vprintfmt+0x54>
+  8002f3:	0f b6 d2             	movzbl %dl,%edx
+  8002f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fe:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800301:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800304:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800308:	0f be 17             	movsbl (%edi),%edx
+  80030b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80030e:	83 f9 09             	cmp    $0x9,%ecx
+  800311:	77 55                	ja     800368 <vprintfmt+0xf9>
+  800313:	83 c7 01             	add    $0x1,%edi
+  800316:	eb e9                	jmp    800301 <vprintfmt+0x92>
+  800318:	8b 45 14             	mov    0x14(%ebp),%eax
+  80031b:	8b 00                	mov    (%eax),%eax
+  80031d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800320:	8b 45 14             	mov    0x14(%ebp),%eax
+  800323:	8d 40 04             	lea    0x4(%eax),%eax
+  800326:	89 45 14             	mov    %eax,0x14(%ebp)
+  800329:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80032c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800330:	79 91                	jns    8002c3 <vprintfmt+0x54>
+  800332:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800335:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800338:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80033f:	eb 82                	jmp    8002c3 <vprintfmt+0x54>
+  800341:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800344:	85 d2                	test   %edx,%edx
+  800346:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034b:	0f 49 c2             	cmovns %edx,%eax
+  80034e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800351:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800354:	e9 6a ff ff ff       	jmp    8002c3 <vprintfmt+0x54>
+  800359:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80035c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800363:	e9 5b ff ff ff       	jmp    8002c3 <vprintfmt+0x54>
+  800368:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80036b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80036e:	eb bc                	jmp    80032c <vprintfmt+0xbd>
+  800370:	83 c1 01             	add    $0x1,%ecx
+  800373:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800376:	e9 48 ff ff ff       	jmp    8002c3 <vprintfmt+0x54>
+  80037b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037e:	8d 78 04             	lea    0x4(%eax),%edi
+  800381:	83 ec 08             	sub    $0x8,%esp
+  800384:	53                   	push   %ebx
+  800385:	ff 30                	push   (%eax)
+  800387:	ff d6                	call   *%esi
+  800389:	83 c4 10             	add    $0x10,%esp
+  80038c:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80038f:	e9 b1 02 00 00       	jmp    800645 <vprintfmt+0x3d6>
+  800394:	8b 45 14             	mov    0x14(%ebp),%eax
+  800397:	8d 78 04             	lea    0x4(%eax),%edi
+  80039a:	8b 10                	mov    (%eax),%edx
+  80039c:	89 d0                	mov    %edx,%eax
+  80039e:	f7 d8                	neg    %eax
+  8003a0:	0f 48 c2             	cmovs  %edx,%eax
+  8003a3:	83 f8 08             	cmp    $0x8,%eax
+  8003a6:	7f 23                	jg     8003cb <vprintfmt+0x15c>
+  8003a8:	8b 14 85 80 1c 80 00 	mov    0x801c80(,%eax,4),%edx
+  8003af:	85 d2                	test   %edx,%edx
+  8003b1:	74 18                	je     8003cb <vprintfmt+0x15c>
+  8003b3:	52                   	push   %edx
+  8003b4:	68 87 1a 80 00       	push   $0x801a87
+  8003b9:	53                   	push   %ebx
+  8003ba:	56                   	push   %esi
+  8003bb:	e8 92 fe ff ff       	call   800252 <printfmt>
+  8003c0:	83 c4 10             	add    $0x10,%esp
+  8003c3:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003c6:	e9 7a 02 00 00       	jmp    800645 <vprintfmt+0x3d6>
+  8003cb:	50                   	push   %eax
+  8003cc:	68 7e 1a 80 00       	push   $0x801a7e
+  8003d1:	53                   	push   %ebx
+  8003d2:	56                   	push   %esi
+  8003d3:	e8 7a fe ff ff       	call   800252 <printfmt>
+  8003d8:	83 c4 10             	add    $0x10,%esp
+  8003db:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003de:	e9 62 02 00 00       	jmp    800645 <vprintfmt+0x3d6>
+  8003e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e6:	83 c0 04             	add    $0x4,%eax
+  8003e9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ef:	8b 08                	mov    (%eax),%ecx
+  8003f1:	85 c9                	test   %ecx,%ecx
+  8003f3:	b8 77 1a 80 00       	mov    $0x801a77,%eax
+  8003f8:	0f 45 c1             	cmovne %ecx,%eax
+  8003fb:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8003fe:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800402:	7e 06                	jle    80040a <vprintfmt+0x19b>
+  800404:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800408:	75 0b                	jne    800415 <vprintfmt+0x1a6>
+  80040a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80040d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800410:	89 75 08             	mov    %esi,0x8(%ebp)
+  800413:	eb 5c                	jmp    800471 <vprintfmt+0x202>
+  800415:	83 ec 08             	sub    $0x8,%esp
+  800418:	ff 75 d0             	push   -0x30(%ebp)
+  80041b:	ff 75 cc             	push   -0x34(%ebp)
+  80041e:	e8 87 03 00 00       	call   8007aa <strnlen>
+  800423:	89 c2                	mov    %eax,%edx
+  800425:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800428:	29 d0                	sub    %edx,%eax
+  80042a:	83 c4 10             	add    $0x10,%esp
+  80042d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800431:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800434:	89 75 08             	mov    %esi,0x8(%ebp)
+  800437:	89 c6                	mov    %eax,%esi
+  800439:	eb 0e                	jmp    800449 <vprintfmt+0x1da>
+  80043b:	83 ec 08             	sub    $0x8,%esp
+  80043e:	53                   	push   %ebx
+  80043f:	57                   	push   %edi
+  800440:	ff 55 08             	call   *0x8(%ebp)
+  800443:	83 ee 01             	sub    $0x1,%esi
+  800446:	83 c4 10             	add    $0x10,%esp
+  800449:	85 f6                	test   %esi,%esi
+  80044b:	7f ee                	jg     80043b <vprintfmt+0x1cc>
+  80044d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800450:	8b 75 08             	mov    0x8(%ebp),%esi
+  800453:	85 c0                	test   %eax,%eax
+  800455:	ba 00 00 00 00       	mov    $0x0,%edx
+  80045a:	0f 49 d0             	cmovns %eax,%edx
+  80045d:	29 d0                	sub    %edx,%eax
+  80045f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800462:	eb a6                	jmp    80040a <vprintfmt+0x19b>
+  800464:	83 ec 08             	sub    $0x8,%esp
+  800467:	53                   	push   %ebx
+  800468:	52                   	push   %edx
+  800469:	ff 55 08             	call   *0x8(%ebp)
+  80046c:	83 c4 10             	add    $0x10,%esp
+  80046f:	89 f1                	mov    %esi,%ecx
+  800471:	8d 71 01             	lea    0x1(%ecx),%esi
+  800474:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800478:	0f be d0             	movsbl %al,%edx
+  80047b:	85 d2                	test   %edx,%edx
+  80047d:	74 28                	je     8004a7 <vprintfmt+0x238>
+  80047f:	85 ff                	test   %edi,%edi
+  800481:	78 05                	js     800488 <vprintfmt+0x219>
+  800483:	83 ef 01             	sub    $0x1,%edi
+  800486:	78 30                	js     8004b8 <vprintfmt+0x249>
+  800488:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80048c:	74 d6                	je     800464 <vprintfmt+0x1f5>
+  80048e:	0f be c0             	movsbl %al,%eax
+  800491:	83 e8 20             	sub    $0x20,%eax
+  800494:	83 f8 5e             	cmp    $0x5e,%eax
+  800497:	76 cb                	jbe    800464 <vprintfmt+0x1f5>
+  800499:	83 ec 08             	sub    $0x8,%esp
+  80049c:	53                   	push   %ebx
+  80049d:	6a 3f                	push   $0x3f
+  80049f:	ff 55 08             	call   *0x8(%ebp)
+  8004a2:	83 c4 10             	add    $0x10,%esp
+  8004a5:	eb c8                	jmp    80046f <vprintfmt+0x200>
+  8004a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004aa:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ad:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004b0:	01 d0                	add    %edx,%eax
+  8004b2:	29 c8                	sub    %ecx,%eax
+  8004b4:	89 c7                	mov    %eax,%edi
+  8004b6:	eb 13                	jmp    8004cb <vprintfmt+0x25c>
+  8004b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004bb:	eb ed                	jmp    8004aa <vprintfmt+0x23b>
+  8004bd:	83 ec 08             	sub    $0x8,%esp
+  8004c0:	53                   	push   %ebx
+  8004c1:	6a 20                	push   $0x20
+  8004c3:	ff d6                	call   *%esi
+  8004c5:	83 ef 01             	sub    $0x1,%edi
+  8004c8:	83 c4 10             	add    $0x10,%esp
+  8004cb:	85 ff                	test   %edi,%edi
+  8004cd:	7f ee                	jg     8004bd <vprintfmt+0x24e>
+  8004cf:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004d2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004d5:	e9 6b 01 00 00       	jmp    800645 <vprintfmt+0x3d6>
+  8004da:	83 f9 01             	cmp    $0x1,%ecx
+  8004dd:	7f 1f                	jg     8004fe <vprintfmt+0x28f>
+  8004df:	85 c9                	test   %ecx,%ecx
+  8004e1:	74 67                	je     80054a <vprintfmt+0x2db>
+  8004e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e6:	8b 00                	mov    (%eax),%eax
+  8004e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004eb:	89 c1                	mov    %eax,%ecx
+  8004ed:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004f0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8004f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004fc:	eb 17                	jmp    800515 <vprintfmt+0x2a6>
+  8004fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800501:	8b 50 04             	mov    0x4(%eax),%edx
+  800504:	8b 00                	mov    (%eax),%eax
+  800506:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800509:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80050c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050f:	8d 40 08             	lea    0x8(%eax),%eax
+  800512:	89 45 14             	mov    %eax,0x14(%ebp)
+  800515:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800518:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80051b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800520:	85 c9                	test   %ecx,%ecx
+  800522:	0f 89 03 01 00 00    	jns    80062b <vprintfmt+0x3bc>
+  800528:	83 ec 08             	sub    $0x8,%esp
+  80052b:	53                   	push   %ebx
+  80052c:	6a 2d                	push   $0x2d
+  80052e:	ff d6                	call   *%esi
+  800530:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800533:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800536:	f7 da                	neg    %edx
+  800538:	83 d1 00             	adc    $0x0,%ecx
+  80053b:	f7 d9                	neg    %ecx
+  80053d:	83 c4 10             	add    $0x10,%esp
+  800540:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800545:	e9 e1 00 00 00       	jmp    80062b <vprintfmt+0x3bc>
+  80054a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054d:	8b 00                	mov    (%eax),%eax
+  80054f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800552:	89 c1                	mov    %eax,%ecx
+  800554:	c1 f9 1f             	sar    $0x1f,%ecx
+  800557:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80055a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055d:	8d 40 04             	lea    0x4(%eax),%eax
+  800560:	89 45 14             	mov    %eax,0x14(%ebp)
+  800563:	eb b0                	jmp    800515 <vprintfmt+0x2a6>
+  800565:	83 f9 01             	cmp    $0x1,%ecx
+  800568:	7f 1e                	jg     800588 <vprintfmt+0x319>
+  80056a:	85 c9                	test   %ecx,%ecx
+  80056c:	74 32                	je     8005a0 <vprintfmt+0x331>
+  80056e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800571:	8b 10                	mov    (%eax),%edx
+  800573:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800578:	8d 40 04             	lea    0x4(%eax),%eax
+  80057b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800583:	e9 a3 00 00 00       	jmp    80062b <vprintfmt+0x3bc>
+  800588:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058b:	8b 10                	mov    (%eax),%edx
+  80058d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800590:	8d 40 08             	lea    0x8(%eax),%eax
+  800593:	89 45 14             	mov    %eax,0x14(%ebp)
+  800596:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80059b:	e9 8b 00 00 00       	jmp    80062b <vprintfmt+0x3bc>
+  8005a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a3:	8b 10                	mov    (%eax),%edx
+  8005a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ad:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005b5:	eb 74                	jmp    80062b <vprintfmt+0x3bc>
+  8005b7:	83 f9 01             	cmp    $0x1,%ecx
+  8005ba:	7f 1b                	jg     8005d7 <vprintfmt+0x368>
+  8005bc:	85 c9                	test   %ecx,%ecx
+  8005be:	74 2c                	je     8005ec <vprintfmt+0x37d>
+  8005c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c3:	8b 10                	mov    (%eax),%edx
+  8005c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8005cd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d0:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005d5:	eb 54                	jmp    80062b <vprintfmt+0x3bc>
+  8005d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005da:	8b 10                	mov    (%eax),%edx
+  8005dc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005df:	8d 40 08             	lea    0x8(%eax),%eax
+  8005e2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e5:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005ea:	eb 3f                	jmp    80062b <vprintfmt+0x3bc>
+  8005ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ef:	8b 10                	mov    (%eax),%edx
+  8005f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fc:	bf 08 00 00 00       	mov    $0x8,%edi
+  800601:	eb 28                	jmp    80062b <vprintfmt+0x3bc>
+  800603:	83 ec 08             	sub    $0x8,%esp
+  800606:	53                   	push   %ebx
+  800607:	6a 30                	push   $0x30
+  800609:	ff d6                	call   *%esi
+  80060b:	83 c4 08             	add    $0x8,%esp
+  80060e:	53                   	push   %ebx
+  80060f:	6a 78                	push   $0x78
+  800611:	ff d6                	call   *%esi
+  800613:	8b 45 14             	mov    0x14(%ebp),%eax
+  800616:	8b 10                	mov    (%eax),%edx
+  800618:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061d:	83 c4 10             	add    $0x10,%esp
+  800620:	8d 40 04             	lea    0x4(%eax),%eax
+  800623:	89 45 14             	mov    %eax,0x14(%ebp)
+  800626:	bf 10 00 00 00       	mov    $0x10,%edi
+  80062b:	83 ec 0c             	sub    $0xc,%esp
+  80062e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800632:	50                   	push   %eax
+  800633:	ff 75 e0             	push   -0x20(%ebp)
+  800636:	57                   	push   %edi
+  800637:	51                   	push   %ecx
+  800638:	52                   	push   %edx
+  800639:	89 da                	mov    %ebx,%edx
+  80063b:	89 f0                	mov    %esi,%eax
+  80063d:	e8 4a fb ff ff       	call   80018c <printnum>
+  800642:	83 c4 20             	add    $0x20,%esp
+  800645:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800648:	e9 40 fc ff ff       	jmp    80028d <vprintfmt+0x1e>
+  80064d:	83 f9 01             	cmp    $0x1,%ecx
+  800650:	7f 1b                	jg     80066d <vprintfmt+0x3fe>
+  800652:	85 c9                	test   %ecx,%ecx
+  800654:	74 2c                	je     800682 <vprintfmt+0x413>
+  800656:	8b 45 14             	mov    0x14(%ebp),%eax
+  800659:	8b 10                	mov    (%eax),%edx
+  80065b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800660:	8d 40 04             	lea    0x4(%eax),%eax
+  800663:	89 45 14             	mov    %eax,0x14(%ebp)
+  800666:	bf 10 00 00 00       	mov    $0x10,%edi
+  80066b:	eb be                	jmp    80062b <vprintfmt+0x3bc>
+  80066d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800670:	8b 10                	mov    (%eax),%edx
+  800672:	8b 48 04             	mov    0x4(%eax),%ecx
+  800675:	8d 40 08             	lea    0x8(%eax),%eax
+  800678:	89 45 14             	mov    %eax,0x14(%ebp)
+  80067b:	bf 10 00 00 00       	mov    $0x10,%edi
+  800680:	eb a9                	jmp    80062b <vprintfmt+0x3bc>
+  800682:	8b 45 14             	mov    0x14(%ebp),%eax
+  800685:	8b 10                	mov    (%eax),%edx
+  800687:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068c:	8d 40 04             	lea    0x4(%eax),%eax
+  80068f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800692:	bf 10 00 00 00       	mov    $0x10,%edi
+  800697:	eb 92                	jmp    80062b <vprintfmt+0x3bc>
+  800699:	83 ec 08             	sub    $0x8,%esp
+  80069c:	53                   	push   %ebx
+  80069d:	6a 25                	push   $0x25
+  80069f:	ff d6                	call   *%esi
+  8006a1:	83 c4 10             	add    $0x10,%esp
+  8006a4:	eb 9f                	jmp    800645 <vprintfmt+0x3d6>
+  8006a6:	83 ec 08             	sub    $0x8,%esp
+  8006a9:	53                   	push   %ebx
+  8006aa:	6a 25                	push   $0x25
+  8006ac:	ff d6                	call   *%esi
+  8006ae:	83 c4 10             	add    $0x10,%esp
+  8006b1:	89 f8                	mov    %edi,%eax
+  8006b3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006b7:	74 05                	je     8006be <vprintfmt+0x44f>
+  8006b9:	83 e8 01             	sub    $0x1,%eax
+  8006bc:	eb f5                	jmp    8006b3 <vprintfmt+0x444>
+  8006be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006c1:	eb 82                	jmp    800645 <vprintfmt+0x3d6>
+
+008006c3 <vsnprintf>:
+  8006c3:	55                   	push   %ebp
+  8006c4:	89 e5                	mov    %esp,%ebp
+  8006c6:	83 ec 18             	sub    $0x18,%esp
+  8006c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006cf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006d2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006d6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006d9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8006e0:	85 c0                	test   %eax,%eax
+  8006e2:	74 26                	je     80070a <vsnprintf+0x47>
+  8006e4:	85 d2                	test   %edx,%edx
+  8006e6:	7e 22                	jle    80070a <vsnprintf+0x47>
+  8006e8:	ff 75 14             	push   0x14(%ebp)
+  8006eb:	ff 75 10             	push   0x10(%ebp)
+  8006ee:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006f1:	50                   	push   %eax
+  8006f2:	68 35 02 80 00       	push   $0x800235
+  8006f7:	e8 73 fb ff ff       	call   80026f <vprintfmt>
+  8006fc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006ff:	c6 00 00             	movb   $0x0,(%eax)
+  800702:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800705:	83 c4 10             	add    $0x10,%esp
+  800708:	c9                   	leave
+  800709:	c3                   	ret
+  80070a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80070f:	eb f7                	jmp    800708 <vsnprintf+0x45>
+
+00800711 <snprintf>:
+  800711:	55                   	push   %ebp
+  800712:	89 e5                	mov    %esp,%ebp
+  800714:	83 ec 08             	sub    $0x8,%esp
+  800717:	8d 45 14             	lea    0x14(%ebp),%eax
+  80071a:	50                   	push   %eax
+  80071b:	ff 75 10             	push   0x10(%ebp)
+  80071e:	ff 75 0c             	push   0xc(%ebp)
+  800721:	ff 75 08             	push   0x8(%ebp)
+  800724:	e8 9a ff ff ff       	call   8006c3 <vsnprintf>
+  800729:	c9                   	leave
+  80072a:	c3                   	ret
+
+0080072b <copy_fwd>:
+  80072b:	55                   	push   %ebp
+  80072c:	89 e5                	mov    %esp,%ebp
+  80072e:	57                   	push   %edi
+  80072f:	56                   	push   %esi
+  800730:	53                   	push   %ebx
+  800731:	89 c7                	mov    %eax,%edi
+  800733:	89 d6                	mov    %edx,%esi
+  800735:	89 c8                	mov    %ecx,%eax
+  800737:	83 f9 0f             	cmp    $0xf,%ecx
+  80073a:	76 1c                	jbe    800758 <copy_fwd+0x2d>
+  80073c:	89 f9                	mov    %edi,%ecx
+  80073e:	f7 d9                	neg    %ecx
+  800740:	89 cb                	mov    %ecx,%ebx
+  800742:	83 e3 03             	and    $0x3,%ebx
+  800745:	29 d8                	sub    %ebx,%eax
+  800747:	89 c2                	mov    %eax,%edx
+  800749:	c1 ea 02             	shr    $0x2,%edx
+  80074c:	83 e0 03             	and    $0x3,%eax
+  80074f:	89 d9                	mov    %ebx,%ecx
+  800751:	fc                   	cld
+  800752:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800754:	89 d1                	mov    %edx,%ecx
+  800756:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800758:	89 c1                	mov    %eax,%ecx
+  80075a:	fc                   	cld
+  80075b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80075d:	5b                   	pop    %ebx
+  80075e:	5e                   	pop    %esi
+  80075f:	5f                   	pop    %edi
+  800760:	5d                   	pop    %ebp
+  800761:	c3                   	ret
+
+00800762 <have_sse2>:
+  800762:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800769:	78 06                	js     800771 <have_sse2+0xf>
+  80076b:	a1 04 20 80 00       	mov    0x802004,%eax
+  800770:	c3                   	ret
+  800771:	55                   	push   %ebp
+  800772:	89 e5                	mov    %esp,%ebp
+  800774:	53                   	push   %ebx
+  800775:	b8 01 00 00 00       	mov    $0x1,%eax
+  80077a:	0f a2                	cpuid
+  80077c:	c1 ea 1a             	shr    $0x1a,%edx
+  80077f:	83 e2 01             	and    $0x1,%edx
+  800782:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800788:	a1 04 20 80 00       	mov    0x802004,%eax
+  80078d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800790:	c9                   	leave
+  800791:	c3                   	ret
+
+00800792 <strlen>:
+  800792:	55                   	push   %ebp
+  800793:	89 e5                	mov    %esp,%ebp
+  800795:	8b 55 08             	mov    0x8(%ebp),%edx
+  800798:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079d:	eb 03                	jmp    8007a2 <strlen+0x10>
+  80079f:	83 c0 01             	add    $0x1,%eax
+  8007a2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007a6:	75 f7                	jne    80079f <strlen+0xd>
+  8007a8:	5d                   	pop    %ebp
+  8007a9:	c3                   	ret
+
+008007aa <strnlen>:
+  8007aa:	55                   	push   %ebp
+  8007ab:	89 e5                	mov    %esp,%ebp
+  8007ad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b8:	eb 03                	jmp    8007bd <strnlen+0x13>
+  8007ba:	83 c0 01             	add    $0x1,%eax
+  8007bd:	39 d0                	cmp    %edx,%eax
+  8007bf:	74 08                	je     8007c9 <strnlen+0x1f>
+  8007c1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007c5:	75 f3                	jne    8007ba <strnlen+0x10>
+  8007c7:	89 c2                	mov    %eax,%edx
+  8007c9:	89 d0                	mov    %edx,%eax
+  8007cb:	5d                   	pop    %ebp
+  8007cc:	c3                   	ret
+
+008007cd <strcpy>:
+  8007cd:	55                   	push   %ebp
+  8007ce:	89 e5                	mov    %esp,%ebp
+  8007d0:	53                   	push   %ebx
+  8007d1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007dc:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007e0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007e3:	83 c0 01             	add    $0x1,%eax
+  8007e6:	84 d2                	test   %dl,%dl
+  8007e8:	75 f2                	jne    8007dc <strcpy+0xf>
+  8007ea:	89 c8                	mov    %ecx,%eax
+  8007ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ef:	c9                   	leave
+  8007f0:	c3                   	ret
+
+008007f1 <strcat>:
+  8007f1:	55                   	push   %ebp
+  8007f2:	89 e5                	mov    %esp,%ebp
+  8007f4:	53                   	push   %ebx
+  8007f5:	83 ec 10             	sub    $0x10,%esp
+  8007f8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8007fb:	53                   	push   %ebx
+  8007fc:	e8 91 ff ff ff       	call   800792 <strlen>
+  800801:	83 c4 08             	add    $0x8,%esp
+  800804:	ff 75 0c             	push   0xc(%ebp)
+  800807:	01 d8                	add    %ebx,%eax
+  800809:	50                   	push   %eax
+  80080a:	e8 be ff ff ff       	call   8007cd <strcpy>
+  80080f:	89 d8                	mov    %ebx,%eax
+  800811:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800814:	c9                   	leave
+  800815:	c3                   	ret
+
+00800816 <strncpy>:
+  800816:	55                   	push   %ebp
+  800817:	89 e5                	mov    %esp,%ebp
+  800819:	56                   	push   %esi
+  80081a:	53                   	push   %ebx
+  80081b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80081e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800821:	89 f3                	mov    %esi,%ebx
+  800823:	03 5d 10             	add    0x10(%ebp),%ebx
+  800826:	89 f0                	mov    %esi,%eax
+  800828:	eb 0f                	jmp    800839 <strncpy+0x23>
+  80082a:	83 c0 01             	add    $0x1,%eax
+  80082d:	0f b6 0a             	movzbl (%edx),%ecx
+  800830:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800833:	80 f9 01             	cmp    $0x1,%cl
+  800836:	83 da ff             	sbb    $0xffffffff,%edx
+  800839:	39 d8                	cmp    %ebx,%eax
+  80083b:	75 ed                	jne    80082a <strncpy+0x14>
+  80083d:	89 f0                	mov    %esi,%eax
+  80083f:	5b                   	pop    %ebx
+  800840:	5e                   	pop    %esi
+  800841:	5d                   	pop    %ebp
+  800842:	c3                   	ret
+
+00800843 <strlcpy>:
+  800843:	55                   	push   %ebp
+  800844:	89 e5                	mov    %esp,%ebp
+  800846:	56                   	push   %esi
+  800847:	53                   	push   %ebx
+  800848:	8b 75 08             	mov    0x8(%ebp),%esi
+  80084b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80084e:	8b 55 10             	mov    0x10(%ebp),%edx
+  800851:	89 f0                	mov    %esi,%eax
+  800853:	85 d2                	test   %edx,%edx
+  800855:	74 21                	je     800878 <strlcpy+0x35>
+  800857:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80085b:	89 f2                	mov    %esi,%edx
+  80085d:	eb 09                	jmp    800868 <strlcpy+0x25>
+  80085f:	83 c1 01             	add    $0x1,%ecx
+  800862:	83 c2 01             	add    $0x1,%edx
+  800865:	88 5a ff             	mov    %bl,-0x1(%edx)
+  800868:	39 c2                	cmp    %eax,%edx
+  80086a:	74 09                	je     800875 <strlcpy+0x32>
+  80086c:	0f b6 19             	movzbl (%ecx),%ebx
+  80086f:	84 db                	test   %bl,%bl
+  800871:	75 ec                	jne    80085f <strlcpy+0x1c>
+  800873:	89 d0                	mov    %edx,%eax
+  800875:	c6 00 00             	movb   $0x0,(%eax)
+  800878:	29 f0                	sub    %esi,%eax
+  80087a:	5b                   	pop    %ebx
+  80087b:	5e                   	pop    %esi
+  80087c:	5d                   	pop    %ebp
+  80087d:	c3                   	ret
+
+0080087e <strcmp>:
+  80087e:	55                   	push   %ebp
+  80087f:	89 e5                	mov    %esp,%ebp
+  800881:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800884:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800887:	eb 06                	jmp    80088f <strcmp+0x11>
+  800889:	83 c1 01             	add    $0x1,%ecx
+  80088c:	83 c2 01             	add    $0x1,%edx
+  80088f:	0f b6 01             	movzbl (%ecx),%eax
+  800892:	84 c0                	test   %al,%al
+  800894:	74 04                	je     80089a <strcmp+0x1c>
+  800896:	3a 02                	cmp    (%edx),%al
+  800898:	74 ef                	je     800889 <strcmp+0xb>
+  80089a:	0f b6 c0             	movzbl %al,%eax
+  80089d:	0f b6 12             	movzbl (%edx),%edx
+  8008a0:	29 d0                	sub    %edx,%eax
+  8008a2:	5d                   	pop    %ebp
+  8008a3:	c3                   	ret
+
+008008a4 <strncmp>:
+  8008a4:	55                   	push   %ebp
+  8008a5:	89 e5                	mov    %esp,%ebp
+  8008a7:	53                   	push   %ebx
+  8008a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ae:	8b 55 10             	mov    0x10(%ebp),%edx
+  8008b1:	eb 09                	jmp    8008bc <strncmp+0x18>
+  8008b3:	83 ea 01             	sub    $0x1,%edx
+  8008b6:	83 c0 01             	add    $0x1,%eax
+  8008b9:	83 c1 01             	add    $0x1,%ecx
+  8008bc:	85 d2                	test   %edx,%edx
+  8008be:	74 18                	je     8008d8 <strncmp+0x34>
+  8008c0:	0f b6 18             	movzbl (%eax),%ebx
+  8008c3:	84 db                	test   %bl,%bl
+  8008c5:	74 04                	je     8008cb <strncmp+0x27>
+  8008c7:	3a 19                	cmp    (%ecx),%bl
+  8008c9:	74 e8                	je     8008b3 <strncmp+0xf>
+  8008cb:	0f b6 00             	movzbl (%eax),%eax
+  8008ce:	0f b6 11             	movzbl (%ecx),%edx
+  8008d1:	29 d0                	sub    %edx,%eax
+  8008d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d6:	c9                   	leave
+  8008d7:	c3                   	ret
+  8008d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008dd:	eb f4                	jmp    8008d3 <strncmp+0x2f>
+
+008008df <strchr>:
+  8008df:	55                   	push   %ebp
+  8008e0:	89 e5                	mov    %esp,%ebp
+  8008e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8008e9:	eb 03                	jmp    8008ee <strchr+0xf>
+  8008eb:	83 c0 01             	add    $0x1,%eax
+  8008ee:	0f b6 10             	movzbl (%eax),%edx
+  8008f1:	84 d2                	test   %dl,%dl
+  8008f3:	74 06                	je     8008fb <strchr+0x1c>
+  8008f5:	38 ca                	cmp    %cl,%dl
+  8008f7:	75 f2                	jne    8008eb <strchr+0xc>
+  8008f9:	eb 05                	jmp    800900 <strchr+0x21>
+  8008fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800900:	5d                   	pop    %ebp
+  800901:	c3                   	ret
+
+00800902 <strfind>:
+  800902:	55                   	push   %ebp
+  800903:	89 e5                	mov    %esp,%ebp
+  800905:	8b 45 08             	mov    0x8(%ebp),%eax
+  800908:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80090c:	0f b6 10             	movzbl (%eax),%edx
+  80090f:	38 ca                	cmp    %cl,%dl
+  800911:	74 09                	je     80091c <strfind+0x1a>
+  800913:	84 d2                	test   %dl,%dl
+  800915:	74 05                	je     80091c <strfind+0x1a>
+  800917:	83 c0 01             	add    $0x1,%eax
+  80091a:	eb f0                	jmp    80090c <strfind+0xa>
+  80091c:	5d                   	pop    %ebp
+  80091d:	c3                   	ret
+
+0080091e <memset>:
+  80091e:	55                   	push   %ebp
+  80091f:	89 e5                	mov    %esp,%ebp
+  800921:	57                   	push   %edi
+  800922:	56                   	push   %esi
+  800923:	53                   	push   %ebx
+  800924:	83 ec 04             	sub    $0x4,%esp
+  800927:	8b 75 08             	mov    0x8(%ebp),%esi
+  80092a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80092d:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  800931:	89 f7                	mov    %esi,%edi
+  800933:	83 fa 0f             	cmp    $0xf,%edx
+  800936:	76 24                	jbe    80095c <memset+0x3e>
+  800938:	89 f1                	mov    %esi,%ecx
+  80093a:	f7 d9                	neg    %ecx
+  80093c:	83 e1 03             	and    $0x3,%ecx
+  80093f:	29 ca                	sub    %ecx,%edx
+  800941:	89 d0                	mov    %edx,%eax
+  800943:	c1 e8 02             	shr    $0x2,%eax
+  800946:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  800949:	83 e2 03             	and    $0x3,%edx
+  80094c:	89 d8                	mov    %ebx,%eax
+  80094e:	fc                   	cld
+  80094f:	f3 aa                	rep stos %al,%es:(%edi)
+  800951:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  800957:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  80095a:	f3 ab                	rep stos %eax,%es:(%edi)
+  80095c:	89 d1                	mov    %edx,%ecx
+  80095e:	89 d8                	mov    %ebx,%eax
+  800960:	fc                   	cld
+  800961:	f3 aa                	rep stos %al,%es:(%edi)
+  800963:	89 f0                	mov    %esi,%eax
+  800965:	83 c4 04             	add    $0x4,%esp
+  800968:	5b                   	pop    %ebx
+  800969:	5e                   	pop    %esi
+  80096a:	5f                   	pop    %edi
+  80096b:	5d                   	pop    %ebp
+  80096c:	c3                   	ret
+
+0080096d <memmove>:
+  80096d:	55                   	push   %ebp
+  80096e:	89 e5                	mov    %esp,%ebp
+  800970:	57                   	push   %edi
+  800971:	56                   	push   %esi
+  800972:	53                   	push   %ebx
+  800973:	83 ec 0c             	sub    $0xc,%esp
+  800976:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800979:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80097c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80097f:	85 c0                	test   %eax,%eax
+  800981:	74 14                	je     800997 <memmove+0x2a>
+  800983:	39 da                	cmp    %ebx,%edx
+  800985:	73 07                	jae    80098e <memmove+0x21>
+  800987:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  80098a:	39 cb                	cmp    %ecx,%ebx
+  80098c:	72 13                	jb     8009a1 <memmove+0x34>
+  80098e:	89 c1                	mov    %eax,%ecx
+  800990:	89 d8                	mov    %ebx,%eax
+  800992:	e8 94 fd ff ff       	call   80072b <copy_fwd>
+  800997:	89 d8                	mov    %ebx,%eax
+  800999:	83 c4 0c             	add    $0xc,%esp
+  80099c:	5b                   	pop    %ebx
+  80099d:	5e                   	pop    %esi
+  80099e:	5f                   	pop    %edi
+  80099f:	5d                   	pop    %ebp
+  8009a0:	c3                   	ret
+  8009a1:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  8009a4:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  8009a7:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  8009aa:	83 f8 0f             	cmp    $0xf,%eax
+  8009ad:	76 23                	jbe    8009d2 <memmove+0x65>
+  8009af:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  8009b2:	83 e1 03             	and    $0x3,%ecx
+  8009b5:	29 c8                	sub    %ecx,%eax
+  8009b7:	89 c2                	mov    %eax,%edx
+  8009b9:	c1 ea 02             	shr    $0x2,%edx
+  8009bc:	83 e0 03             	and    $0x3,%eax
+  8009bf:	fd                   	std
+  8009c0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8009c2:	83 ef 03             	sub    $0x3,%edi
+  8009c5:	83 ee 03             	sub    $0x3,%esi
+  8009c8:	89 d1                	mov    %edx,%ecx
+  8009ca:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009cc:	83 c7 03             	add    $0x3,%edi
+  8009cf:	83 c6 03             	add    $0x3,%esi
+  8009d2:	89 c1                	mov    %eax,%ecx
+  8009d4:	fd                   	std
+  8009d5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8009d7:	fc                   	cld
+  8009d8:	eb bd                	jmp    800997 <memmove+0x2a>
+
+008009da <memcpy>:
+  8009da:	55                   	push   %ebp
+  8009db:	89 e5                	mov    %esp,%ebp
+  8009dd:	53                   	push   %ebx
+  8009de:	83 ec 04             	sub    $0x4,%esp
+  8009e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009e4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8009e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009ea:	89 d8                	mov    %ebx,%eax
+  8009ec:	e8 3a fd ff ff       	call   80072b <copy_fwd>
+  8009f1:	89 d8                	mov    %ebx,%eax
+  8009f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009f6:	c9                   	leave
+  8009f7:	c3                   	ret
+
+008009f8 <page_copy>:
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	57                   	push   %edi
+  8009fc:	56                   	push   %esi
+  8009fd:	53                   	push   %ebx
+  8009fe:	83 ec 0c             	sub    $0xc,%esp
+  800a01:	e8 5c fd ff ff       	call   800762 <have_sse2>
+  800a06:	85 c0                	test   %eax,%eax
+  800a08:	74 39                	je     800a43 <page_copy+0x4b>
+  800a0a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a0d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a10:	be 00 01 00 00       	mov    $0x100,%esi
+  800a15:	8b 03                	mov    (%ebx),%eax
+  800a17:	8b 53 04             	mov    0x4(%ebx),%edx
+  800a1a:	0f c3 01             	movnti %eax,(%ecx)
+  800a1d:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800a21:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a24:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800a27:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800a2b:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800a2f:	83 c3 10             	add    $0x10,%ebx
+  800a32:	83 c1 10             	add    $0x10,%ecx
+  800a35:	4e                   	dec    %esi
+  800a36:	75 dd                	jne    800a15 <page_copy+0x1d>
+  800a38:	0f ae f8             	sfence
+  800a3b:	83 c4 0c             	add    $0xc,%esp
+  800a3e:	5b                   	pop    %ebx
+  800a3f:	5e                   	pop    %esi
+  800a40:	5f                   	pop    %edi
+  800a41:	5d                   	pop    %ebp
+  800a42:	c3                   	ret
+  800a43:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a46:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a49:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800a4e:	fc                   	cld
+  800a4f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a51:	eb e8                	jmp    800a3b <page_copy+0x43>
+
+00800a53 <page_zero>:
+  800a53:	55                   	push   %ebp
+  800a54:	89 e5                	mov    %esp,%ebp
+  800a56:	57                   	push   %edi
+  800a57:	83 ec 04             	sub    $0x4,%esp
+  800a5a:	e8 03 fd ff ff       	call   800762 <have_sse2>
+  800a5f:	85 c0                	test   %eax,%eax
+  800a61:	74 3a                	je     800a9d <page_zero+0x4a>
+  800a63:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a66:	ba 80 00 00 00       	mov    $0x80,%edx
+  800a6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a70:	0f c3 08             	movnti %ecx,(%eax)
+  800a73:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800a77:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800a7b:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800a7f:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800a83:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800a87:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800a8b:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800a8f:	83 c0 20             	add    $0x20,%eax
+  800a92:	4a                   	dec    %edx
+  800a93:	75 db                	jne    800a70 <page_zero+0x1d>
+  800a95:	0f ae f8             	sfence
+  800a98:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a9b:	c9                   	leave
+  800a9c:	c3                   	ret
+  800a9d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800aa0:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800aa5:	fc                   	cld
+  800aa6:	f3 ab                	rep stos %eax,%es:(%edi)
+  800aa8:	eb ee                	jmp    800a98 <page_zero+0x45>
+
+00800aaa <memcmp>:
+  800aaa:	55                   	push   %ebp
+  800aab:	89 e5                	mov    %esp,%ebp
+  800aad:	56                   	push   %esi
+  800aae:	53                   	push   %ebx
+  800aaf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ab5:	89 c6                	mov    %eax,%esi
+  800ab7:	03 75 10             	add    0x10(%ebp),%esi
+  800aba:	eb 06                	jmp    800ac2 <memcmp+0x18>
+  800abc:	83 c0 01             	add    $0x1,%eax
+  800abf:	83 c2 01             	add    $0x1,%edx
+  800ac2:	39 f0                	cmp    %esi,%eax
+  800ac4:	74 14                	je     800ada <memcmp+0x30>
+  800ac6:	0f b6 08             	movzbl (%eax),%ecx
+  800ac9:	0f b6 1a             	movzbl (%edx),%ebx
+  800acc:	38 d9                	cmp    %bl,%cl
+  800ace:	74 ec                	je     800abc <memcmp+0x12>
+  800ad0:	0f b6 c1             	movzbl %cl,%eax
+  800ad3:	0f b6 db             	movzbl %bl,%ebx
+  800ad6:	29 d8                	sub    %ebx,%eax
+  800ad8:	eb 05                	jmp    800adf <memcmp+0x35>
+  800ada:	b8 00 00 00 00       	mov    $0x0,%eax
+  800adf:	5b                   	pop    %ebx
+  800ae0:	5e                   	pop    %esi
+  800ae1:	5d                   	pop    %ebp
+  800ae2:	c3                   	ret
+
+00800ae3 <memfind>:
+  800ae3:	55                   	push   %ebp
+  800ae4:	89 e5                	mov    %esp,%ebp
+  800ae6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aec:	89 c2                	mov    %eax,%edx
+  800aee:	03 55 10             	add    0x10(%ebp),%edx
+  800af1:	eb 03                	jmp    800af6 <memfind+0x13>
+  800af3:	83 c0 01             	add    $0x1,%eax
+  800af6:	39 d0                	cmp    %edx,%eax
+  800af8:	73 04                	jae    800afe <memfind+0x1b>
+  800afa:	38 08                	cmp    %cl,(%eax)
+  800afc:	75 f5                	jne    800af3 <memfind+0x10>
+  800afe:	5d                   	pop    %ebp
+  800aff:	c3                   	ret
+
+00800b00 <strtol>:
+  800b00:	55                   	push   %ebp
+  800b01:	89 e5                	mov    %esp,%ebp
+  800b03:	57                   	push   %edi
+  800b04:	56                   	push   %esi
+  800b05:	53                   	push   %ebx
+  800b06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b09:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b0c:	eb 03                	jmp    800b11 <strtol+0x11>
+  800b0e:	83 c2 01             	add    $0x1,%edx
+  800b11:	0f b6 02             	movzbl (%edx),%eax
+  800b14:	3c 20                	cmp    $0x20,%al
+  800b16:	74 f6                	je     800b0e <strtol+0xe>
+  800b18:	3c 09                	cmp    $0x9,%al
+  800b1a:	74 f2                	je     800b0e <strtol+0xe>
+  800b1c:	3c 2b                	cmp    $0x2b,%al
+  800b1e:	74 2a                	je     800b4a <strtol+0x4a>
+  800b20:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b25:	3c 2d                	cmp    $0x2d,%al
+  800b27:	74 2b                	je     800b54 <strtol+0x54>
+  800b29:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b2f:	75 0f                	jne    800b40 <strtol+0x40>
+  800b31:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b34:	74 28                	je     800b5e <strtol+0x5e>
+  800b36:	85 db                	test   %ebx,%ebx
+  800b38:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b3d:	0f 44 d8             	cmove  %eax,%ebx
+  800b40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b45:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b48:	eb 46                	jmp    800b90 <strtol+0x90>
+  800b4a:	83 c2 01             	add    $0x1,%edx
+  800b4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b52:	eb d5                	jmp    800b29 <strtol+0x29>
+  800b54:	83 c2 01             	add    $0x1,%edx
+  800b57:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b5c:	eb cb                	jmp    800b29 <strtol+0x29>
+  800b5e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b62:	74 0e                	je     800b72 <strtol+0x72>
+  800b64:	85 db                	test   %ebx,%ebx
+  800b66:	75 d8                	jne    800b40 <strtol+0x40>
+  800b68:	83 c2 01             	add    $0x1,%edx
+  800b6b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b70:	eb ce                	jmp    800b40 <strtol+0x40>
+  800b72:	83 c2 02             	add    $0x2,%edx
+  800b75:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b7a:	eb c4                	jmp    800b40 <strtol+0x40>
+  800b7c:	0f be c0             	movsbl %al,%eax
+  800b7f:	83 e8 30             	sub    $0x30,%eax
+  800b82:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b85:	7d 3a                	jge    800bc1 <strtol+0xc1>
+  800b87:	83 c2 01             	add    $0x1,%edx
+  800b8a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b8e:	01 c1                	add    %eax,%ecx
+  800b90:	0f b6 02             	movzbl (%edx),%eax
+  800b93:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b96:	89 f3                	mov    %esi,%ebx
+  800b98:	80 fb 09             	cmp    $0x9,%bl
+  800b9b:	76 df                	jbe    800b7c <strtol+0x7c>
+  800b9d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ba0:	89 f3                	mov    %esi,%ebx
+  800ba2:	80 fb 19             	cmp    $0x19,%bl
+  800ba5:	77 08                	ja     800baf <strtol+0xaf>
+  800ba7:	0f be c0             	movsbl %al,%eax
+  800baa:	83 e8 57             	sub    $0x57,%eax
+  800bad:	eb d3                	jmp    800b82 <strtol+0x82>
+  800baf:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bb2:	89 f3                	mov    %esi,%ebx
+  800bb4:	80 fb 19             	cmp    $0x19,%bl
+  800bb7:	77 08                	ja     800bc1 <strtol+0xc1>
+  800bb9:	0f be c0             	movsbl %al,%eax
+  800bbc:	83 e8 37             	sub    $0x37,%eax
+  800bbf:	eb c1                	jmp    800b82 <strtol+0x82>
+  800bc1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bc5:	74 05                	je     800bcc <strtol+0xcc>
+  800bc7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bca:	89 10                	mov    %edx,(%eax)
+  800bcc:	89 c8                	mov    %ecx,%eax
+  800bce:	f7 d8                	neg    %eax
+  800bd0:	85 ff                	test   %edi,%edi
+  800bd2:	0f 45 c8             	cmovne %eax,%ecx
+  800bd5:	89 c8                	mov    %ecx,%eax
+  800bd7:	5b                   	pop    %ebx
+  800bd8:	5e                   	pop    %esi
+  800bd9:	5f                   	pop    %edi
+  800bda:	5d                   	pop    %ebp
+  800bdb:	c3                   	ret
+
+00800bdc <sys_cputs>:
+  800bdc:	55                   	push   %ebp
+  800bdd:	89 e5                	mov    %esp,%ebp
+  800bdf:	57                   	push   %edi
+  800be0:	56                   	push   %esi
+  800be1:	53                   	push   %ebx
+  800be2:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800be9:	78 21                	js     800c0c <sys_cputs+0x30>
+  800beb:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800bf2:	75 2d                	jne    800c21 <sys_cputs+0x45>
+  800bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bff:	89 c3                	mov    %eax,%ebx
+  800c01:	89 c7                	mov    %eax,%edi
+  800c03:	89 c6                	mov    %eax,%esi
+  800c05:	cd 30                	int    $0x30
+  800c07:	5b                   	pop    %ebx
+  800c08:	5e                   	pop    %esi
+  800c09:	5f                   	pop    %edi
+  800c0a:	5d                   	pop    %ebp
+  800c0b:	c3                   	ret
+  800c0c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c11:	0f a2                	cpuid
+  800c13:	c1 ea 0b             	shr    $0xb,%edx
+  800c16:	83 e2 01             	and    $0x1,%edx
+  800c19:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800c1f:	eb ca                	jmp    800beb <sys_cputs+0xf>
+  800c21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2c:	89 c3                	mov    %eax,%ebx
+  800c2e:	89 c7                	mov    %eax,%edi
+  800c30:	89 c6                	mov    %eax,%esi
+  800c32:	55                   	push   %ebp
+  800c33:	68 3c 0c 80 00       	push   $0x800c3c
+  800c38:	89 e5                	mov    %esp,%ebp
+  800c3a:	0f 34                	sysenter
+  800c3c:	83 c4 04             	add    $0x4,%esp
+  800c3f:	5d                   	pop    %ebp
+  800c40:	eb c5                	jmp    800c07 <sys_cputs+0x2b>
+
+00800c42 <sys_cgetc>:
+  800c42:	55                   	push   %ebp
+  800c43:	89 e5                	mov    %esp,%ebp
+  800c45:	57                   	push   %edi
+  800c46:	56                   	push   %esi
+  800c47:	53                   	push   %ebx
+  800c48:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c4f:	78 22                	js     800c73 <sys_cgetc+0x31>
+  800c51:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c58:	75 2e                	jne    800c88 <sys_cgetc+0x46>
+  800c5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c5f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c64:	89 d1                	mov    %edx,%ecx
+  800c66:	89 d3                	mov    %edx,%ebx
+  800c68:	89 d7                	mov    %edx,%edi
+  800c6a:	89 d6                	mov    %edx,%esi
+  800c6c:	cd 30                	int    $0x30
+  800c6e:	5b                   	pop    %ebx
+  800c6f:	5e                   	pop    %esi
+  800c70:	5f                   	pop    %edi
+  800c71:	5d                   	pop    %ebp
+  800c72:	c3                   	ret
+  800c73:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c78:	0f a2                	cpuid
+  800c7a:	c1 ea 0b             	shr    $0xb,%edx
+  800c7d:	83 e2 01             	and    $0x1,%edx
+  800c80:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800c86:	eb c9                	jmp    800c51 <sys_cgetc+0xf>
+  800c88:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c8d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c92:	89 d1                	mov    %edx,%ecx
+  800c94:	89 d3                	mov    %edx,%ebx
+  800c96:	89 d7                	mov    %edx,%edi
+  800c98:	89 d6                	mov    %edx,%esi
+  800c9a:	55                   	push   %ebp
+  800c9b:	68 a4 0c 80 00       	push   $0x800ca4
+  800ca0:	89 e5                	mov    %esp,%ebp
+  800ca2:	0f 34                	sysenter
+  800ca4:	83 c4 04             	add    $0x4,%esp
+  800ca7:	5d                   	pop    %ebp
+  800ca8:	eb c4                	jmp    800c6e <sys_cgetc+0x2c>
+
+00800caa <sys_env_destroy>:
+  800caa:	55                   	push   %ebp
+  800cab:	89 e5                	mov    %esp,%ebp
+  800cad:	57                   	push   %edi
+  800cae:	56                   	push   %esi
+  800caf:	53                   	push   %ebx
+  800cb0:	83 ec 0c             	sub    $0xc,%esp
+  800cb3:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800cba:	78 2a                	js     800ce6 <sys_env_destroy+0x3c>
+  800cbc:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800cc3:	75 36                	jne    800cfb <sys_env_destroy+0x51>
+  800cc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cca:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ccf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd2:	89 cb                	mov    %ecx,%ebx
+  800cd4:	89 cf                	mov    %ecx,%edi
+  800cd6:	89 ce                	mov    %ecx,%esi
+  800cd8:	cd 30                	int    $0x30
+  800cda:	85 c0                	test   %eax,%eax
+  800cdc:	7f 40                	jg     800d1e <sys_env_destroy+0x74>
+  800cde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce1:	5b                   	pop    %ebx
+  800ce2:	5e                   	pop    %esi
+  800ce3:	5f                   	pop    %edi
+  800ce4:	5d                   	pop    %ebp
+  800ce5:	c3                   	ret
+  800ce6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ceb:	0f a2                	cpuid
+  800ced:	c1 ea 0b             	shr    $0xb,%edx
+  800cf0:	83 e2 01             	and    $0x1,%edx
+  800cf3:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800cf9:	eb c1                	jmp    800cbc <sys_env_destroy+0x12>
+  800cfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d03:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d08:	89 cb                	mov    %ecx,%ebx
+  800d0a:	89 cf                	mov    %ecx,%edi
+  800d0c:	89 ce                	mov    %ecx,%esi
+  800d0e:	55                   	push   %ebp
+  800d0f:	68 18 0d 80 00       	push   $0x800d18
+  800d14:	89 e5                	mov    %esp,%ebp
+  800d16:	0f 34                	sysenter
+  800d18:	83 c4 04             	add    $0x4,%esp
+  800d1b:	5d                   	pop    %ebp
+  800d1c:	eb bc                	jmp    800cda <sys_env_destroy+0x30>
+  800d1e:	83 ec 0c             	sub    $0xc,%esp
+  800d21:	50                   	push   %eax
+  800d22:	6a 03                	push   $0x3
+  800d24:	68 a4 1c 80 00       	push   $0x801ca4
+  800d29:	6a 49                	push   $0x49
+  800d2b:	68 c1 1c 80 00       	push   $0x801cc1
+  800d30:	e8 44 0a 00 00       	call   801779 <_panic>
+
+00800d35 <sys_getenvid>:
+  800d35:	55                   	push   %ebp
+  800d36:	89 e5                	mov    %esp,%ebp
+  800d38:	57                   	push   %edi
+  800d39:	56                   	push   %esi
+  800d3a:	53                   	push   %ebx
+  800d3b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d42:	78 22                	js     800d66 <sys_getenvid+0x31>
+  800d44:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d4b:	75 2e                	jne    800d7b <sys_getenvid+0x46>
+  800d4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d52:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d57:	89 d1                	mov    %edx,%ecx
+  800d59:	89 d3                	mov    %edx,%ebx
+  800d5b:	89 d7                	mov    %edx,%edi
+  800d5d:	89 d6                	mov    %edx,%esi
+  800d5f:	cd 30                	int    $0x30
+  800d61:	5b                   	pop    %ebx
+  800d62:	5e                   	pop    %esi
+  800d63:	5f                   	pop    %edi
+  800d64:	5d                   	pop    %ebp
+  800d65:	c3                   	ret
+  800d66:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d6b:	0f a2                	cpuid
+  800d6d:	c1 ea 0b             	shr    $0xb,%edx
+  800d70:	83 e2 01             	and    $0x1,%edx
+  800d73:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800d79:	eb c9                	jmp    800d44 <sys_getenvid+0xf>
+  800d7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d80:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d85:	89 d1                	mov    %edx,%ecx
+  800d87:	89 d3                	mov    %edx,%ebx
+  800d89:	89 d7                	mov    %edx,%edi
+  800d8b:	89 d6                	mov    %edx,%esi
+  800d8d:	55                   	push   %ebp
+  800d8e:	68 97 0d 80 00       	push   $0x800d97
+  800d93:	89 e5                	mov    %esp,%ebp
+  800d95:	0f 34                	sysenter
+  800d97:	83 c4 04             	add    $0x4,%esp
+  800d9a:	5d                   	pop    %ebp
+  800d9b:	eb c4                	jmp    800d61 <sys_getenvid+0x2c>
+
+00800d9d <sys_yield>:
+  800d9d:	55                   	push   %ebp
+  800d9e:	89 e5                	mov    %esp,%ebp
+  800da0:	57                   	push   %edi
+  800da1:	56                   	push   %esi
+  800da2:	53                   	push   %ebx
+  800da3:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800daa:	78 22                	js     800dce <sys_yield+0x31>
+  800dac:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800db3:	75 2e                	jne    800de3 <sys_yield+0x46>
+  800db5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dba:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dbf:	89 d1                	mov    %edx,%ecx
+  800dc1:	89 d3                	mov    %edx,%ebx
+  800dc3:	89 d7                	mov    %edx,%edi
+  800dc5:	89 d6                	mov    %edx,%esi
+  800dc7:	cd 30                	int    $0x30
+  800dc9:	5b                   	pop    %ebx
+  800dca:	5e                   	pop    %esi
+  800dcb:	5f                   	pop    %edi
+  800dcc:	5d                   	pop    %ebp
+  800dcd:	c3                   	ret
+  800dce:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dd3:	0f a2                	cpuid
+  800dd5:	c1 ea 0b             	shr    $0xb,%edx
+  800dd8:	83 e2 01             	and    $0x1,%edx
+  800ddb:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800de1:	eb c9                	jmp    800dac <sys_yield+0xf>
+  800de3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ded:	89 d1                	mov    %edx,%ecx
+  800def:	89 d3                	mov    %edx,%ebx
+  800df1:	89 d7                	mov    %edx,%edi
+  800df3:	89 d6                	mov    %edx,%esi
+  800df5:	55                   	push   %ebp
+  800df6:	68 ff 0d 80 00       	push   $0x800dff
+  800dfb:	89 e5                	mov    %esp,%ebp
+  800dfd:	0f 34                	sysenter
+  800dff:	83 c4 04             	add    $0x4,%esp
+  800e02:	5d                   	pop    %ebp
+  800e03:	eb c4                	jmp    800dc9 <sys_yield+0x2c>
+
+00800e05 <sys_env_set_cow>:
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	57                   	push   %edi
+  800e09:	56                   	push   %esi
+  800e0a:	53                   	push   %ebx
+  800e0b:	83 ec 0c             	sub    $0xc,%esp
+  800e0e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e15:	78 2b                	js     800e42 <sys_env_set_cow+0x3d>
+  800e17:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e1e:	75 37                	jne    800e57 <sys_env_set_cow+0x52>
+  800e20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e25:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e30:	89 df                	mov    %ebx,%edi
+  800e32:	89 de                	mov    %ebx,%esi
+  800e34:	cd 30                	int    $0x30
+  800e36:	85 c0                	test   %eax,%eax
+  800e38:	7f 41                	jg     800e7b <sys_env_set_cow+0x76>
+  800e3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e3d:	5b                   	pop    %ebx
+  800e3e:	5e                   	pop    %esi
+  800e3f:	5f                   	pop    %edi
+  800e40:	5d                   	pop    %ebp
+  800e41:	c3                   	ret
+  800e42:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e47:	0f a2                	cpuid
+  800e49:	c1 ea 0b             	shr    $0xb,%edx
+  800e4c:	83 e2 01             	and    $0x1,%edx
+  800e4f:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800e55:	eb c0                	jmp    800e17 <sys_env_set_cow+0x12>
+  800e57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e62:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e67:	89 df                	mov    %ebx,%edi
+  800e69:	89 de                	mov    %ebx,%esi
+  800e6b:	55                   	push   %ebp
+  800e6c:	68 75 0e 80 00       	push   $0x800e75
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	0f 34                	sysenter
+  800e75:	83 c4 04             	add    $0x4,%esp
+  800e78:	5d                   	pop    %ebp
+  800e79:	eb bb                	jmp    800e36 <sys_env_set_cow+0x31>
+  800e7b:	83 ec 0c             	sub    $0xc,%esp
+  800e7e:	50                   	push   %eax
+  800e7f:	6a 0d                	push   $0xd
+  800e81:	68 a4 1c 80 00       	push   $0x801ca4
+  800e86:	6a 49                	push   $0x49
+  800e88:	68 c1 1c 80 00       	push   $0x801cc1
+  800e8d:	e8 e7 08 00 00       	call   801779 <_panic>
+
+00800e92 <sys_env_set_quota>:
+  800e92:	55                   	push   %ebp
+  800e93:	89 e5                	mov    %esp,%ebp
+  800e95:	57                   	push   %edi
+  800e96:	56                   	push   %esi
+  800e97:	53                   	push   %ebx
+  800e98:	83 ec 0c             	sub    $0xc,%esp
+  800e9b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800ea2:	78 2b                	js     800ecf <sys_env_set_quota+0x3d>
+  800ea4:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800eab:	75 37                	jne    800ee4 <sys_env_set_quota+0x52>
+  800ead:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800eb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebd:	89 df                	mov    %ebx,%edi
+  800ebf:	89 de                	mov    %ebx,%esi
+  800ec1:	cd 30                	int    $0x30
+  800ec3:	85 c0                	test   %eax,%eax
+  800ec5:	7f 41                	jg     800f08 <sys_env_set_quota+0x76>
+  800ec7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eca:	5b                   	pop    %ebx
+  800ecb:	5e                   	pop    %esi
+  800ecc:	5f                   	pop    %edi
+  800ecd:	5d                   	pop    %ebp
+  800ece:	c3                   	ret
+  800ecf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ed4:	0f a2                	cpuid
+  800ed6:	c1 ea 0b             	shr    $0xb,%edx
+  800ed9:	83 e2 01             	and    $0x1,%edx
+  800edc:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800ee2:	eb c0                	jmp    800ea4 <sys_env_set_quota+0x12>
+  800ee4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eef:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ef4:	89 df                	mov    %ebx,%edi
+  800ef6:	89 de                	mov    %ebx,%esi
+  800ef8:	55                   	push   %ebp
+  800ef9:	68 02 0f 80 00       	push   $0x800f02
+  800efe:	89 e5                	mov    %esp,%ebp
+  800f00:	0f 34                	sysenter
+  800f02:	83 c4 04             	add    $0x4,%esp
+  800f05:	5d                   	pop    %ebp
+  800f06:	eb bb                	jmp    800ec3 <sys_env_set_quota+0x31>
+  800f08:	83 ec 0c             	sub    $0xc,%esp
+  800f0b:	50                   	push   %eax
+  800f0c:	6a 0f                	push   $0xf
+  800f0e:	68 a4 1c 80 00       	push   $0x801ca4
+  800f13:	6a 49                	push   $0x49
+  800f15:	68 c1 1c 80 00       	push   $0x801cc1
+  800f1a:	e8 5a 08 00 00       	call   801779 <_panic>
+
+00800f1f <sys_page_alloc>:
+  800f1f:	55                   	push   %ebp
+  800f20:	89 e5                	mov    %esp,%ebp
+  800f22:	57                   	push   %edi
+  800f23:	56                   	push   %esi
+  800f24:	53                   	push   %ebx
+  800f25:	83 ec 0c             	sub    $0xc,%esp
+  800f28:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f2f:	78 2c                	js     800f5d <sys_page_alloc+0x3e>
+  800f31:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f38:	75 38                	jne    800f72 <sys_page_alloc+0x53>
+  800f3a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f3f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f4d:	89 f7                	mov    %esi,%edi
+  800f4f:	cd 30                	int    $0x30
+  800f51:	85 c0                	test   %eax,%eax
+  800f53:	7f 42                	jg     800f97 <sys_page_alloc+0x78>
+  800f55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f58:	5b                   	pop    %ebx
+  800f59:	5e                   	pop    %esi
+  800f5a:	5f                   	pop    %edi
+  800f5b:	5d                   	pop    %ebp
+  800f5c:	c3                   	ret
+  800f5d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f62:	0f a2                	cpuid
+  800f64:	c1 ea 0b             	shr    $0xb,%edx
+  800f67:	83 e2 01             	and    $0x1,%edx
+  800f6a:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800f70:	eb bf                	jmp    800f31 <sys_page_alloc+0x12>
+  800f72:	be 00 00 00 00       	mov    $0x0,%esi
+  800f77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f85:	89 f7                	mov    %esi,%edi
+  800f87:	55                   	push   %ebp
+  800f88:	68 91 0f 80 00       	push   $0x800f91
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	0f 34                	sysenter
+  800f91:	83 c4 04             	add    $0x4,%esp
+  800f94:	5d                   	pop    %ebp
+  800f95:	eb ba                	jmp    800f51 <sys_page_alloc+0x32>
+  800f97:	83 ec 0c             	sub    $0xc,%esp
+  800f9a:	50                   	push   %eax
+  800f9b:	6a 04                	push   $0x4
+  800f9d:	68 a4 1c 80 00       	push   $0x801ca4
+  800fa2:	6a 49                	push   $0x49
+  800fa4:	68 c1 1c 80 00       	push   $0x801cc1
+  800fa9:	e8 cb 07 00 00       	call   801779 <_panic>
+
+00800fae <sys_page_map>:
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  800fb1:	57                   	push   %edi
+  800fb2:	56                   	push   %esi
+  800fb3:	53                   	push   %ebx
+  800fb4:	83 ec 0c             	sub    $0xc,%esp
+  800fb7:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800fbe:	78 2b                	js     800feb <sys_page_map+0x3d>
+  800fc0:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800fc7:	75 37                	jne    801000 <sys_page_map+0x52>
+  800fc9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fda:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fdd:	cd 30                	int    $0x30
+  800fdf:	85 c0                	test   %eax,%eax
+  800fe1:	7f 41                	jg     801024 <sys_page_map+0x76>
+  800fe3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe6:	5b                   	pop    %ebx
+  800fe7:	5e                   	pop    %esi
+  800fe8:	5f                   	pop    %edi
+  800fe9:	5d                   	pop    %ebp
+  800fea:	c3                   	ret
+  800feb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ff0:	0f a2                	cpuid
+  800ff2:	c1 ea 0b             	shr    $0xb,%edx
+  800ff5:	83 e2 01             	and    $0x1,%edx
+  800ff8:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800ffe:	eb c0                	jmp    800fc0 <sys_page_map+0x12>
+  801000:	8b 55 08             	mov    0x8(%ebp),%edx
+  801003:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801006:	b8 05 00 00 00       	mov    $0x5,%eax
+  80100b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801011:	8b 75 18             	mov    0x18(%ebp),%esi
+  801014:	55                   	push   %ebp
+  801015:	68 1e 10 80 00       	push   $0x80101e
+  80101a:	89 e5                	mov    %esp,%ebp
+  80101c:	0f 34                	sysenter
+  80101e:	83 c4 04             	add    $0x4,%esp
+  801021:	5d                   	pop    %ebp
+  801022:	eb bb                	jmp    800fdf <sys_page_map+0x31>
+  801024:	83 ec 0c             	sub    $0xc,%esp
+  801027:	50                   	push   %eax
+  801028:	6a 05                	push   $0x5
+  80102a:	68 a4 1c 80 00       	push   $0x801ca4
+  80102f:	6a 49                	push   $0x49
+  801031:	68 c1 1c 80 00       	push   $0x801cc1
+  801036:	e8 3e 07 00 00       	call   801779 <_panic>
+
+0080103b <sys_page_unmap>:
+  80103b:	55                   	push   %ebp
+  80103c:	89 e5                	mov    %esp,%ebp
+  80103e:	57                   	push   %edi
+  80103f:	56                   	push   %esi
+  801040:	53                   	push   %ebx
+  801041:	83 ec 0c             	sub    $0xc,%esp
+  801044:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80104b:	78 2b                	js     801078 <sys_page_unmap+0x3d>
+  80104d:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801054:	75 37                	jne    80108d <sys_page_unmap+0x52>
+  801056:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801060:	8b 55 08             	mov    0x8(%ebp),%edx
+  801063:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801066:	89 df                	mov    %ebx,%edi
+  801068:	89 de                	mov    %ebx,%esi
+  80106a:	cd 30                	int    $0x30
+  80106c:	85 c0                	test   %eax,%eax
+  80106e:	7f 41                	jg     8010b1 <sys_page_unmap+0x76>
+  801070:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801073:	5b                   	pop    %ebx
+  801074:	5e                   	pop    %esi
+  801075:	5f                   	pop    %edi
+  801076:	5d                   	pop    %ebp
+  801077:	c3                   	ret
+  801078:	b8 01 00 00 00       	mov    $0x1,%eax
+  80107d:	0f a2                	cpuid
+  80107f:	c1 ea 0b             	shr    $0xb,%edx
+  801082:	83 e2 01             	and    $0x1,%edx
+  801085:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80108b:	eb c0                	jmp    80104d <sys_page_unmap+0x12>
+  80108d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801092:	8b 55 08             	mov    0x8(%ebp),%edx
+  801095:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801098:	b8 06 00 00 00       	mov    $0x6,%eax
+  80109d:	89 df                	mov    %ebx,%edi
+  80109f:	89 de                	mov    %ebx,%esi
+  8010a1:	55                   	push   %ebp
+  8010a2:	68 ab 10 80 00       	push   $0x8010ab
+  8010a7:	89 e5                	mov    %esp,%ebp
+  8010a9:	0f 34                	sysenter
+  8010ab:	83 c4 04             	add    $0x4,%esp
+  8010ae:	5d                   	pop    %ebp
+  8010af:	eb bb                	jmp    80106c <sys_page_unmap+0x31>
+  8010b1:	83 ec 0c             	sub    $0xc,%esp
+  8010b4:	50                   	push   %eax
+  8010b5:	6a 06                	push   $0x6
+  8010b7:	68 a4 1c 80 00       	push   $0x801ca4
+  8010bc:	6a 49                	push   $0x49
+  8010be:	68 c1 1c 80 00       	push   $0x801cc1
+  8010c3:	e8 b1 06 00 00       	call   801779 <_panic>
+
+008010c8 <sys_page_reuse>:
+  8010c8:	55                   	push   %ebp
+  8010c9:	89 e5                	mov    %esp,%ebp
+  8010cb:	57                   	push   %edi
+  8010cc:	56                   	push   %esi
+  8010cd:	53                   	push   %ebx
+  8010ce:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010d5:	78 24                	js     8010fb <sys_page_reuse+0x33>
+  8010d7:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010de:	75 30                	jne    801110 <sys_page_reuse+0x48>
+  8010e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f0:	89 df                	mov    %ebx,%edi
+  8010f2:	89 de                	mov    %ebx,%esi
+  8010f4:	cd 30                	int    $0x30
+  8010f6:	5b                   	pop    %ebx
+  8010f7:	5e                   	pop    %esi
+  8010f8:	5f                   	pop    %edi
+  8010f9:	5d                   	pop    %ebp
+  8010fa:	c3                   	ret
+  8010fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801100:	0f a2                	cpuid
+  801102:	c1 ea 0b             	shr    $0xb,%edx
+  801105:	83 e2 01             	and    $0x1,%edx
+  801108:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80110e:	eb c7                	jmp    8010d7 <sys_page_reuse+0xf>
+  801110:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801115:	8b 55 08             	mov    0x8(%ebp),%edx
+  801118:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801120:	89 df                	mov    %ebx,%edi
+  801122:	89 de                	mov    %ebx,%esi
+  801124:	55                   	push   %ebp
+  801125:	68 2e 11 80 00       	push   $0x80112e
+  80112a:	89 e5                	mov    %esp,%ebp
+  80112c:	0f 34                	sysenter
+  80112e:	83 c4 04             	add    $0x4,%esp
+  801131:	5d                   	pop    %ebp
+  801132:	eb c2                	jmp    8010f6 <sys_page_reuse+0x2e>
+
+00801134 <sys_env_set_status>:
+  801134:	55                   	push   %ebp
+  801135:	89 e5                	mov    %esp,%ebp
+  801137:	57                   	push   %edi
+  801138:	56                   	push   %esi
+  801139:	53                   	push   %ebx
+  80113a:	83 ec 0c             	sub    $0xc,%esp
+  80113d:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801144:	78 2b                	js     801171 <sys_env_set_status+0x3d>
+  801146:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80114d:	75 37                	jne    801186 <sys_env_set_status+0x52>
+  80114f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801154:	b8 08 00 00 00       	mov    $0x8,%eax
+  801159:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115f:	89 df                	mov    %ebx,%edi
+  801161:	89 de                	mov    %ebx,%esi
+  801163:	cd 30                	int    $0x30
+  801165:	85 c0                	test   %eax,%eax
+  801167:	7f 41                	jg     8011aa <sys_env_set_status+0x76>
+  801169:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116c:	5b                   	pop    %ebx
+  80116d:	5e                   	pop    %esi
+  80116e:	5f                   	pop    %edi
+  80116f:	5d                   	pop    %ebp
+  801170:	c3                   	ret
+  801171:	b8 01 00 00 00       	mov    $0x1,%eax
+  801176:	0f a2                	cpuid
+  801178:	c1 ea 0b             	shr    $0xb,%edx
+  80117b:	83 e2 01             	and    $0x1,%edx
+  80117e:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801184:	eb c0                	jmp    801146 <sys_env_set_status+0x12>
+  801186:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801191:	b8 08 00 00 00       	mov    $0x8,%eax
+  801196:	89 df                	mov    %ebx,%edi
+  801198:	89 de                	mov    %ebx,%esi
+  80119a:	55                   	push   %ebp
+  80119b:	68 a4 11 80 00       	push   $0x8011a4
+  8011a0:	89 e5                	mov    %esp,%ebp
+  8011a2:	0f 34                	sysenter
+  8011a4:	83 c4 04             	add    $0x4,%esp
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	eb bb                	jmp    801165 <sys_env_set_status+0x31>
+  8011aa:	83 ec 0c             	sub    $0xc,%esp
+  8011ad:	50                   	push   %eax
+  8011ae:	6a 08                	push   $0x8
+  8011b0:	68 a4 1c 80 00       	push   $0x801ca4
+  8011b5:	6a 49                	push   $0x49
+  8011b7:	68 c1 1c 80 00       	push   $0x801cc1
+  8011bc:	e8 b8 05 00 00       	call   801779 <_panic>
+
+008011c1 <sys_env_set_pgfault_upcall>:
+  8011c1:	55                   	push   %ebp
+  8011c2:	89 e5                	mov    %esp,%ebp
+  8011c4:	57                   	push   %edi
+  8011c5:	56                   	push   %esi
+  8011c6:	53                   	push   %ebx
+  8011c7:	83 ec 0c             	sub    $0xc,%esp
+  8011ca:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011d1:	78 2b                	js     8011fe <sys_env_set_pgfault_upcall+0x3d>
+  8011d3:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011da:	75 37                	jne    801213 <sys_env_set_pgfault_upcall+0x52>
+  8011dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ec:	89 df                	mov    %ebx,%edi
+  8011ee:	89 de                	mov    %ebx,%esi
+  8011f0:	cd 30                	int    $0x30
+  8011f2:	85 c0                	test   %eax,%eax
+  8011f4:	7f 41                	jg     801237 <sys_env_set_pgfault_upcall+0x76>
+  8011f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f9:	5b                   	pop    %ebx
+  8011fa:	5e                   	pop    %esi
+  8011fb:	5f                   	pop    %edi
+  8011fc:	5d                   	pop    %ebp
+  8011fd:	c3                   	ret
+  8011fe:	b8 01 00 00 00       	mov    $0x1,%eax
+  801203:	0f a2                	cpuid
+  801205:	c1 ea 0b             	shr    $0xb,%edx
+  801208:	83 e2 01             	and    $0x1,%edx
+  80120b:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801211:	eb c0                	jmp    8011d3 <sys_env_set_pgfault_upcall+0x12>
+  801213:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801218:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801223:	89 df                	mov    %ebx,%edi
+  801225:	89 de                	mov    %ebx,%esi
+  801227:	55                   	push   %ebp
+  801228:	68 31 12 80 00       	push   $0x801231
+  80122d:	89 e5                	mov    %esp,%ebp
+  80122f:	0f 34                	sysenter
+  801231:	83 c4 04             	add    $0x4,%esp
+  801234:	5d                   	pop    %ebp
+  801235:	eb bb                	jmp    8011f2 <sys_env_set_pgfault_upcall+0x31>
+  801237:	83 ec 0c             	sub    $0xc,%esp
+  80123a:	50                   	push   %eax
+  80123b:	6a 09                	push   $0x9
+  80123d:	68 a4 1c 80 00       	push   $0x801ca4
+  801242:	6a 49                	push   $0x49
+  801244:	68 c1 1c 80 00       	push   $0x801cc1
+  801249:	e8 2b 05 00 00       	call   801779 <_panic>
+
+0080124e <sys_env_set_trace>:
+  80124e:	55                   	push   %ebp
+  80124f:	89 e5                	mov    %esp,%ebp
+  801251:	57                   	push   %edi
+  801252:	56                   	push   %esi
+  801253:	53                   	push   %ebx
+  801254:	83 ec 0c             	sub    $0xc,%esp
+  801257:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80125e:	78 2b                	js     80128b <sys_env_set_trace+0x3d>
+  801260:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801267:	75 37                	jne    8012a0 <sys_env_set_trace+0x52>
+  801269:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801273:	8b 55 08             	mov    0x8(%ebp),%edx
+  801276:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801279:	89 df                	mov    %ebx,%edi
+  80127b:	89 de                	mov    %ebx,%esi
+  80127d:	cd 30                	int    $0x30
+  80127f:	85 c0                	test   %eax,%eax
+  801281:	7f 41                	jg     8012c4 <sys_env_set_trace+0x76>
+  801283:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801286:	5b                   	pop    %ebx
+  801287:	5e                   	pop    %esi
+  801288:	5f                   	pop    %edi
+  801289:	5d                   	pop    %ebp
+  80128a:	c3                   	ret
+  80128b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801290:	0f a2                	cpuid
+  801292:	c1 ea 0b             	shr    $0xb,%edx
+  801295:	83 e2 01             	and    $0x1,%edx
+  801298:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80129e:	eb c0                	jmp    801260 <sys_env_set_trace+0x12>
+  8012a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ab:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012b0:	89 df                	mov    %ebx,%edi
+  8012b2:	89 de                	mov    %ebx,%esi
+  8012b4:	55                   	push   %ebp
+  8012b5:	68 be 12 80 00       	push   $0x8012be
+  8012ba:	89 e5                	mov    %esp,%ebp
+  8012bc:	0f 34                	sysenter
+  8012be:	83 c4 04             	add    $0x4,%esp
+  8012c1:	5d                   	pop    %ebp
+  8012c2:	eb bb                	jmp    80127f <sys_env_set_trace+0x31>
+  8012c4:	83 ec 0c             	sub    $0xc,%esp
+  8012c7:	50                   	push   %eax
+  8012c8:	6a 12                	push   $0x12
+  8012ca:	68 a4 1c 80 00       	push   $0x801ca4
+  8012cf:	6a 49                	push   $0x49
+  8012d1:	68 c1 1c 80 00       	push   $0x801cc1
+  8012d6:	e8 9e 04 00 00       	call   801779 <_panic>
+
+008012db <sys_env_set_rdpmc>:
+  8012db:	55                   	push   %ebp
+  8012dc:	89 e5                	mov    %esp,%ebp
+  8012de:	57                   	push   %edi
+  8012df:	56                   	push   %esi
+  8012e0:	53                   	push   %ebx
+  8012e1:	83 ec 0c             	sub    $0xc,%esp
+  8012e4:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012eb:	78 2b                	js     801318 <sys_env_set_rdpmc+0x3d>
+  8012ed:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012f4:	75 37                	jne    80132d <sys_env_set_rdpmc+0x52>
+  8012f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012fb:	b8 13 00 00 00       	mov    $0x13,%eax
+  801300:	8b 55 08             	mov    0x8(%ebp),%edx
+  801303:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801306:	89 df                	mov    %ebx,%edi
+  801308:	89 de                	mov    %ebx,%esi
+  80130a:	cd 30                	int    $0x30
+  80130c:	85 c0                	test   %eax,%eax
+  80130e:	7f 41                	jg     801351 <sys_env_set_rdpmc+0x76>
+  801310:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801313:	5b                   	pop    %ebx
+  801314:	5e                   	pop    %esi
+  801315:	5f                   	pop    %edi
+  801316:	5d                   	pop    %ebp
+  801317:	c3                   	ret
+  801318:	b8 01 00 00 00       	mov    $0x1,%eax
+  80131d:	0f a2                	cpuid
+  80131f:	c1 ea 0b             	shr    $0xb,%edx
+  801322:	83 e2 01             	and    $0x1,%edx
+  801325:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80132b:	eb c0                	jmp    8012ed <sys_env_set_rdpmc+0x12>
+  80132d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801332:	8b 55 08             	mov    0x8(%ebp),%edx
+  801335:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801338:	b8 13 00 00 00       	mov    $0x13,%eax
+  80133d:	89 df                	mov    %ebx,%edi
+  80133f:	89 de                	mov    %ebx,%esi
+  801341:	55                   	push   %ebp
+  801342:	68 4b 13 80 00       	push   $0x80134b
+  801347:	89 e5                	mov    %esp,%ebp
+  801349:	0f 34                	sysenter
+  80134b:	83 c4 04             	add    $0x4,%esp
+  80134e:	5d                   	pop    %ebp
+  80134f:	eb bb                	jmp    80130c <sys_env_set_rdpmc+0x31>
+  801351:	83 ec 0c             	sub    $0xc,%esp
+  801354:	50                   	push   %eax
+  801355:	6a 13                	push   $0x13
+  801357:	68 a4 1c 80 00       	push   $0x801ca4
+  80135c:	6a 49                	push   $0x49
+  80135e:	68 c1 1c 80 00       	push   $0x801cc1
+  801363:	e8 11 04 00 00       	call   801779 <_panic>
+
+00801368 <sys_ring_setup>:
+  801368:	55                   	push   %ebp
+  801369:	89 e5                	mov    %esp,%ebp
+  80136b:	57                   	push   %edi
+  80136c:	56                   	push   %esi
+  80136d:	53                   	push   %ebx
+  80136e:	83 ec 0c             	sub    $0xc,%esp
+  801371:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801378:	78 29                	js     8013a3 <sys_ring_setup+0x3b>
+  80137a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801381:	75 35                	jne    8013b8 <sys_ring_setup+0x50>
+  801383:	ba 00 00 00 00       	mov    $0x0,%edx
+  801388:	b8 10 00 00 00       	mov    $0x10,%eax
+  80138d:	89 d1                	mov    %edx,%ecx
+  80138f:	89 d3                	mov    %edx,%ebx
+  801391:	89 d7                	mov    %edx,%edi
+  801393:	89 d6                	mov    %edx,%esi
+  801395:	cd 30                	int    $0x30
+  801397:	85 c0                	test   %eax,%eax
+  801399:	7f 3f                	jg     8013da <sys_ring_setup+0x72>
+  80139b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80139e:	5b                   	pop    %ebx
+  80139f:	5e                   	pop    %esi
+  8013a0:	5f                   	pop    %edi
+  8013a1:	5d                   	pop    %ebp
+  8013a2:	c3                   	ret
+  8013a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013a8:	0f a2                	cpuid
+  8013aa:	c1 ea 0b             	shr    $0xb,%edx
+  8013ad:	83 e2 01             	and    $0x1,%edx
+  8013b0:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8013b6:	eb c2                	jmp    80137a <sys_ring_setup+0x12>
+  8013b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013bd:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013c2:	89 d1                	mov    %edx,%ecx
+  8013c4:	89 d3                	mov    %edx,%ebx
+  8013c6:	89 d7                	mov    %edx,%edi
+  8013c8:	89 d6                	mov    %edx,%esi
+  8013ca:	55                   	push   %ebp
+  8013cb:	68 d4 13 80 00       	push   $0x8013d4
+  8013d0:	89 e5                	mov    %esp,%ebp
+  8013d2:	0f 34                	sysenter
+  8013d4:	83 c4 04             	add    $0x4,%esp
+  8013d7:	5d                   	pop    %ebp
+  8013d8:	eb bd                	jmp    801397 <sys_ring_setup+0x2f>
+  8013da:	83 ec 0c             	sub    $0xc,%esp
+  8013dd:	50                   	push   %eax
+  8013de:	6a 10                	push   $0x10
+  8013e0:	68 a4 1c 80 00       	push   $0x801ca4
+  8013e5:	6a 49                	push   $0x49
+  8013e7:	68 c1 1c 80 00       	push   $0x801cc1
+  8013ec:	e8 88 03 00 00       	call   801779 <_panic>
+
+008013f1 <sys_ring_enter>:
+  8013f1:	55                   	push   %ebp
+  8013f2:	89 e5                	mov    %esp,%ebp
+  8013f4:	57                   	push   %edi
+  8013f5:	56                   	push   %esi
+  8013f6:	53                   	push   %ebx
+  8013f7:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8013fe:	78 22                	js     801422 <sys_ring_enter+0x31>
+  801400:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801407:	75 2e                	jne    801437 <sys_ring_enter+0x46>
+  801409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801413:	89 d1                	mov    %edx,%ecx
+  801415:	89 d3                	mov    %edx,%ebx
+  801417:	89 d7                	mov    %edx,%edi
+  801419:	89 d6                	mov    %edx,%esi
+  80141b:	cd 30                	int    $0x30
+  80141d:	5b                   	pop    %ebx
+  80141e:	5e                   	pop    %esi
+  80141f:	5f                   	pop    %edi
+  801420:	5d                   	pop    %ebp
+  801421:	c3                   	ret
+  801422:	b8 01 00 00 00       	mov    $0x1,%eax
+  801427:	0f a2                	cpuid
+  801429:	c1 ea 0b             	shr    $0xb,%edx
+  80142c:	83 e2 01             	and    $0x1,%edx
+  80142f:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801435:	eb c9                	jmp    801400 <sys_ring_enter+0xf>
+  801437:	ba 00 00 00 00       	mov    $0x0,%edx
+  80143c:	b8 11 00 00 00       	mov    $0x11,%eax
+  801441:	89 d1                	mov    %edx,%ecx
+  801443:	89 d3                	mov    %edx,%ebx
+  801445:	89 d7                	mov    %edx,%edi
+  801447:	89 d6                	mov    %edx,%esi
+  801449:	55                   	push   %ebp
+  80144a:	68 53 14 80 00       	push   $0x801453
+  80144f:	89 e5                	mov    %esp,%ebp
+  801451:	0f 34                	sysenter
+  801453:	83 c4 04             	add    $0x4,%esp
+  801456:	5d                   	pop    %ebp
+  801457:	eb c4                	jmp    80141d <sys_ring_enter+0x2c>
+
+00801459 <sys_ipc_try_send>:
+  801459:	55                   	push   %ebp
+  80145a:	89 e5                	mov    %esp,%ebp
+  80145c:	57                   	push   %edi
+  80145d:	56                   	push   %esi
+  80145e:	53                   	push   %ebx
+  80145f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801466:	78 26                	js     80148e <sys_ipc_try_send+0x35>
+  801468:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80146f:	75 32                	jne    8014a3 <sys_ipc_try_send+0x4a>
+  801471:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801476:	be 00 00 00 00       	mov    $0x0,%esi
+  80147b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801481:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801484:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801487:	cd 30                	int    $0x30
+  801489:	5b                   	pop    %ebx
+  80148a:	5e                   	pop    %esi
+  80148b:	5f                   	pop    %edi
+  80148c:	5d                   	pop    %ebp
+  80148d:	c3                   	ret
+  80148e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801493:	0f a2                	cpuid
+  801495:	c1 ea 0b             	shr    $0xb,%edx
+  801498:	83 e2 01             	and    $0x1,%edx
+  80149b:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8014a1:	eb c5                	jmp    801468 <sys_ipc_try_send+0xf>
+  8014a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014b9:	55                   	push   %ebp
+  8014ba:	68 c3 14 80 00       	push   $0x8014c3
+  8014bf:	89 e5                	mov    %esp,%ebp
+  8014c1:	0f 34                	sysenter
+  8014c3:	83 c4 04             	add    $0x4,%esp
+  8014c6:	5d                   	pop    %ebp
+  8014c7:	eb c0                	jmp    801489 <sys_ipc_try_send+0x30>
+
+008014c9 <sys_ipc_recv>:
+  8014c9:	55                   	push   %ebp
+  8014ca:	89 e5                	mov    %esp,%ebp
+  8014cc:	57                   	push   %edi
+  8014cd:	56                   	push   %esi
+  8014ce:	53                   	push   %ebx
+  8014cf:	83 ec 0c             	sub    $0xc,%esp
+  8014d2:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014d9:	78 2a                	js     801505 <sys_ipc_recv+0x3c>
+  8014db:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014e2:	75 36                	jne    80151a <sys_ipc_recv+0x51>
+  8014e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014e9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f1:	89 cb                	mov    %ecx,%ebx
+  8014f3:	89 cf                	mov    %ecx,%edi
+  8014f5:	89 ce                	mov    %ecx,%esi
+  8014f7:	cd 30                	int    $0x30
+  8014f9:	85 c0                	test   %eax,%eax
+  8014fb:	7f 40                	jg     80153d <sys_ipc_recv+0x74>
+  8014fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801500:	5b                   	pop    %ebx
+  801501:	5e                   	pop    %esi
+  801502:	5f                   	pop    %edi
+  801503:	5d                   	pop    %ebp
+  801504:	c3                   	ret
+  801505:	b8 01 00 00 00       	mov    $0x1,%eax
+  80150a:	0f a2                	cpuid
+  80150c:	c1 ea 0b             	shr    $0xb,%edx
+  80150f:	83 e2 01             	and    $0x1,%edx
+  801512:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801518:	eb c1                	jmp    8014db <sys_ipc_recv+0x12>
+  80151a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801522:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801527:	89 cb                	mov    %ecx,%ebx
+  801529:	89 cf                	mov    %ecx,%edi
+  80152b:	89 ce                	mov    %ecx,%esi
+  80152d:	55                   	push   %ebp
+  80152e:	68 37 15 80 00       	push   $0x801537
+  801533:	89 e5                	mov    %esp,%ebp
+  801535:	0f 34                	sysenter
+  801537:	83 c4 04             	add    $0x4,%esp
+  80153a:	5d                   	pop    %ebp
+  80153b:	eb bc                	jmp    8014f9 <sys_ipc_recv+0x30>
+  80153d:	83 ec 0c             	sub    $0xc,%esp
+  801540:	50                   	push   %eax
+  801541:	6a 0c                	push   $0xc
+  801543:	68 a4 1c 80 00       	push   $0x801ca4
+  801548:	6a 49                	push   $0x49
+  80154a:	68 c1 1c 80 00       	push   $0x801cc1
+  80154f:	e8 25 02 00 00       	call   801779 <_panic>
+
+00801554 <set_pgfault_handler>:
+  801554:	55                   	push   %ebp
+  801555:	89 e5                	mov    %esp,%ebp
+  801557:	83 ec 08             	sub    $0x8,%esp
+  80155a:	83 3d 24 20 80 00 00 	cmpl   $0x0,0x802024
+  801561:	74 0a                	je     80156d <set_pgfault_handler+0x19>
+  801563:	8b 45 08             	mov    0x8(%ebp),%eax
+  801566:	a3 24 20 80 00       	mov    %eax,0x802024
+  80156b:	c9                   	leave
+  80156c:	c3                   	ret
+  80156d:	83 ec 04             	sub    $0x4,%esp
+  801570:	6a 07                	push   $0x7
+  801572:	68 00 f0 ff ea       	push   $0xeafff000
+  801577:	6a 00                	push   $0x0
+  801579:	e8 a1 f9 ff ff       	call   800f1f <sys_page_alloc>
+  80157e:	83 c4 10             	add    $0x10,%esp
+  801581:	85 c0                	test   %eax,%eax
+  801583:	75 2a                	jne    8015af <set_pgfault_handler+0x5b>
+  801585:	83 ec 08             	sub    $0x8,%esp
+  801588:	68 c3 15 80 00       	push   $0x8015c3
+  80158d:	6a 00                	push   $0x0
+  80158f:	e8 2d fc ff ff       	call   8011c1 <sys_env_set_pgfault_upcall>
+  801594:	83 c4 10             	add    $0x10,%esp
+  801597:	85 c0                	test   %eax,%eax
+  801599:	74 c8                	je     801563 <set_pgfault_handler+0xf>
+  80159b:	83 ec 04             	sub    $0x4,%esp
+  80159e:	68 f4 1c 80 00       	push   $0x801cf4
+  8015a3:	6a 28                	push   $0x28
+  8015a5:	68 e5 1c 80 00       	push   $0x801ce5
+  8015aa:	e8 ca 01 00 00       	call   801779 <_panic>
+  8015af:	83 ec 04             	sub    $0x4,%esp
+  8015b2:	68 cf 1c 80 00       	push   $0x801ccf
+  8015b7:	6a 22                	push   $0x22
+  8015b9:	68 e5 1c 80 00       	push   $0x801ce5
+  8015be:	e8 b6 01 00 00       	call   801779 <_panic>
+
+008015c3 <_pgfault_upcall>:
+  8015c3:	54                   	push   %esp
+  8015c4:	a1 24 20 80 00       	mov    0x802024,%eax
+  8015c9:	ff d0                	call   *%eax
+  8015cb:	83 c4 04             	add    $0x4,%esp
+  8015ce:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8015d2:	89 e5                	mov    %esp,%ebp
+  8015d4:	8b 64 24 30          	mov    0x30(%esp),%esp
+  8015d8:	50                   	push   %eax
+  8015d9:	89 ec                	mov    %ebp,%esp
+  8015db:	83 c4 08             	add    $0x8,%esp
+  8015de:	61                   	popa
+  8015df:	83 c4 04             	add    $0x4,%esp
+  8015e2:	9d                   	popf
+  8015e3:	5c                   	pop    %esp
+  8015e4:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+  8015e8:	c3                   	ret
+
+008015e9 <uinfo_envid>:
+  8015e9:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  8015ee:	c3                   	ret
+
+008015ef <uinfo_cpunum>:
+  8015ef:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  8015f4:	c3                   	ret
+
+008015f5 <uinfo_ticks>:
+  8015f5:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  8015fa:	c3                   	ret
+
+008015fb <uinfo_nsec>:
+  8015fb:	55                   	push   %ebp
+  8015fc:	89 e5                	mov    %esp,%ebp
+  8015fe:	57                   	push   %edi
+  8015ff:	56                   	push   %esi
+  801600:	53                   	push   %ebx
+  801601:	83 ec 1c             	sub    $0x1c,%esp
+  801604:	0f 31                	rdtsc
+  801606:	89 c6                	mov    %eax,%esi
+  801608:	89 d7                	mov    %edx,%edi
+  80160a:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801610:	b8 00 00 00 00       	mov    $0x0,%eax
+  801615:	ba 00 00 00 00       	mov    $0x0,%edx
+  80161a:	85 c9                	test   %ecx,%ecx
+  80161c:	74 5c                	je     80167a <uinfo_nsec+0x7f>
+  80161e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801623:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801626:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801629:	52                   	push   %edx
+  80162a:	51                   	push   %ecx
+  80162b:	57                   	push   %edi
+  80162c:	56                   	push   %esi
+  80162d:	e8 6a 02 00 00       	call   80189c <__umoddi3>
+  801632:	83 c4 10             	add    $0x10,%esp
+  801635:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  80163b:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801640:	f7 e3                	mul    %ebx
+  801642:	01 ca                	add    %ecx,%edx
+  801644:	ff 75 e4             	push   -0x1c(%ebp)
+  801647:	ff 75 e0             	push   -0x20(%ebp)
+  80164a:	52                   	push   %edx
+  80164b:	50                   	push   %eax
+  80164c:	e8 73 01 00 00       	call   8017c4 <__udivdi3>
+  801651:	83 c4 10             	add    $0x10,%esp
+  801654:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801657:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80165a:	ff 75 e4             	push   -0x1c(%ebp)
+  80165d:	ff 75 e0             	push   -0x20(%ebp)
+  801660:	57                   	push   %edi
+  801661:	56                   	push   %esi
+  801662:	e8 5d 01 00 00       	call   8017c4 <__udivdi3>
+  801667:	83 c4 10             	add    $0x10,%esp
+  80166a:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801670:	f7 e3                	mul    %ebx
+  801672:	01 ca                	add    %ecx,%edx
+  801674:	03 45 d8             	add    -0x28(%ebp),%eax
+  801677:	13 55 dc             	adc    -0x24(%ebp),%edx
+  80167a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80167d:	5b                   	pop    %ebx
+  80167e:	5e                   	pop    %esi
+  80167f:	5f                   	pop    %edi
+  801680:	5d                   	pop    %ebp
+  801681:	c3                   	ret
+
+00801682 <bflush>:
+  801682:	a1 40 20 80 00       	mov    0x802040,%eax
+  801687:	85 c0                	test   %eax,%eax
+  801689:	75 01                	jne    80168c <bflush+0xa>
+  80168b:	c3                   	ret
+  80168c:	55                   	push   %ebp
+  80168d:	89 e5                	mov    %esp,%ebp
+  80168f:	83 ec 10             	sub    $0x10,%esp
+  801692:	50                   	push   %eax
+  801693:	68 44 20 80 00       	push   $0x802044
+  801698:	e8 3f f5 ff ff       	call   800bdc <sys_cputs>
+  80169d:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  8016a4:	00 00 00 
+  8016a7:	83 c4 10             	add    $0x10,%esp
+  8016aa:	c9                   	leave
+  8016ab:	c3                   	ret
+
+008016ac <bputch>:
+  8016ac:	55                   	push   %ebp
+  8016ad:	89 e5                	mov    %esp,%ebp
+  8016af:	53                   	push   %ebx
+  8016b0:	83 ec 04             	sub    $0x4,%esp
+  8016b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8016b6:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  8016bc:	8d 42 01             	lea    0x1(%edx),%eax
+  8016bf:	a3 40 20 80 00       	mov    %eax,0x802040
+  8016c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8016c7:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  8016cd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8016d2:	77 08                	ja     8016dc <bputch+0x30>
+  8016d4:	83 03 01             	addl   $0x1,(%ebx)
+  8016d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016da:	c9                   	leave
+  8016db:	c3                   	ret
+  8016dc:	e8 a1 ff ff ff       	call   801682 <bflush>
+  8016e1:	eb f1                	jmp    8016d4 <bputch+0x28>
+
+008016e3 <vbprintf>:
+  8016e3:	55                   	push   %ebp
+  8016e4:	89 e5                	mov    %esp,%ebp
+  8016e6:	83 ec 18             	sub    $0x18,%esp
+  8016e9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8016f0:	ff 75 0c             	push   0xc(%ebp)
+  8016f3:	ff 75 08             	push   0x8(%ebp)
+  8016f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016f9:	50                   	push   %eax
+  8016fa:	68 ac 16 80 00       	push   $0x8016ac
+  8016ff:	e8 6b eb ff ff       	call   80026f <vprintfmt>
+  801704:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801707:	c9                   	leave
+  801708:	c3                   	ret
+
+00801709 <bprintf>:
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	83 ec 10             	sub    $0x10,%esp
+  80170f:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801712:	50                   	push   %eax
+  801713:	ff 75 08             	push   0x8(%ebp)
+  801716:	e8 c8 ff ff ff       	call   8016e3 <vbprintf>
+  80171b:	c9                   	leave
+  80171c:	c3                   	ret
+
+0080171d <bwrite>:
+  80171d:	55                   	push   %ebp
+  80171e:	89 e5                	mov    %esp,%ebp
+  801720:	53                   	push   %ebx
+  801721:	83 ec 04             	sub    $0x4,%esp
+  801724:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801727:	89 d8                	mov    %ebx,%eax
+  801729:	03 05 40 20 80 00    	add    0x802040,%eax
+  80172f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801734:	76 0d                	jbe    801743 <bwrite+0x26>
+  801736:	e8 47 ff ff ff       	call   801682 <bflush>
+  80173b:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801741:	77 25                	ja     801768 <bwrite+0x4b>
+  801743:	83 ec 04             	sub    $0x4,%esp
+  801746:	53                   	push   %ebx
+  801747:	ff 75 08             	push   0x8(%ebp)
+  80174a:	a1 40 20 80 00       	mov    0x802040,%eax
+  80174f:	05 44 20 80 00       	add    $0x802044,%eax
+  801754:	50                   	push   %eax
+  801755:	e8 80 f2 ff ff       	call   8009da <memcpy>
+  80175a:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  801760:	83 c4 10             	add    $0x10,%esp
+  801763:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801766:	c9                   	leave
+  801767:	c3                   	ret
+  801768:	83 ec 08             	sub    $0x8,%esp
+  80176b:	53                   	push   %ebx
+  80176c:	ff 75 08             	push   0x8(%ebp)
+  80176f:	e8 68 f4 ff ff       	call   800bdc <sys_cputs>
+  801774:	83 c4 10             	add    $0x10,%esp
+  801777:	eb ea                	jmp    801763 <bwrite+0x46>
+
+00801779 <_panic>:
+  801779:	55                   	push   %ebp
+  80177a:	89 e5                	mov    %esp,%ebp
+  80177c:	56                   	push   %esi
+  80177d:	53                   	push   %ebx
+  80177e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  801781:	e8 fc fe ff ff       	call   801682 <bflush>
+  801786:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  80178c:	e8 a4 f5 ff ff       	call   800d35 <sys_getenvid>
+  801791:	83 ec 0c             	sub    $0xc,%esp
+  801794:	ff 75 0c             	push   0xc(%ebp)
+  801797:	ff 75 08             	push   0x8(%ebp)
+  80179a:	56                   	push   %esi
+  80179b:	50                   	push   %eax
+  80179c:	68 18 1d 80 00       	push   $0x801d18
+  8017a1:	e8 d2 e9 ff ff       	call   800178 <cprintf>
+  8017a6:	83 c4 18             	add    $0x18,%esp
+  8017a9:	53                   	push   %ebx
+  8017aa:	ff 75 10             	push   0x10(%ebp)
+  8017ad:	e8 75 e9 ff ff       	call   800127 <vcprintf>
+  8017b2:	c7 04 24 5a 1a 80 00 	movl   $0x801a5a,(%esp)
+  8017b9:	e8 ba e9 ff ff       	call   800178 <cprintf>
+  8017be:	83 c4 10             	add    $0x10,%esp
+  8017c1:	cc                   	int3
+  8017c2:	eb fd                	jmp    8017c1 <_panic+0x48>
+
+008017c4 <__udivdi3>:
+  8017c4:	57                   	push   %edi
+  8017c5:	56                   	push   %esi
+  8017c6:	53                   	push   %ebx
+  8017c7:	83 ec 20             	sub    $0x20,%esp
+  8017ca:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8017ce:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8017d2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8017d6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8017da:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8017de:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8017e2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8017e6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8017ea:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8017ee:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8017f2:	89 d1                	mov    %edx,%ecx
+  8017f4:	09 c1                	or     %eax,%ecx
+  8017f6:	0f 84 91 00 00 00    	je     80188d <__udivdi3+0xc9>
+  8017fc:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801803:	00 
+  801804:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80180b:	00 
+  80180c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801811:	b8 00 00 00 00       	mov    $0x0,%eax
+  801816:	ba 00 00 00 00       	mov    $0x0,%edx
+  80181b:	eb 08                	jmp    801825 <__udivdi3+0x61>
+  80181d:	83 e9 01             	sub    $0x1,%ecx
+  801820:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801823:	74 68                	je     80188d <__udivdi3+0xc9>
+  801825:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801829:	01 c0                	add    %eax,%eax
+  80182b:	89 c6                	mov    %eax,%esi
+  80182d:	89 d7                	mov    %edx,%edi
+  80182f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801833:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801837:	0f ad d0             	shrd   %cl,%edx,%eax
+  80183a:	d3 ea                	shr    %cl,%edx
+  80183c:	f6 c1 20             	test   $0x20,%cl
+  80183f:	74 04                	je     801845 <__udivdi3+0x81>
+  801841:	89 d0                	mov    %edx,%eax
+  801843:	31 d2                	xor    %edx,%edx
+  801845:	83 e0 01             	and    $0x1,%eax
+  801848:	89 04 24             	mov    %eax,(%esp)
+  80184b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801852:	00 
+  801853:	8b 04 24             	mov    (%esp),%eax
+  801856:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80185a:	09 f0                	or     %esi,%eax
+  80185c:	09 fa                	or     %edi,%edx
+  80185e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801862:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801866:	39 f0                	cmp    %esi,%eax
+  801868:	89 d3                	mov    %edx,%ebx
+  80186a:	19 fb                	sbb    %edi,%ebx
+  80186c:	72 af                	jb     80181d <__udivdi3+0x59>
+  80186e:	29 f0                	sub    %esi,%eax
+  801870:	19 fa                	sbb    %edi,%edx
+  801872:	89 cf                	mov    %ecx,%edi
+  801874:	c1 ef 05             	shr    $0x5,%edi
+  801877:	83 e7 01             	and    $0x1,%edi
+  80187a:	89 fe                	mov    %edi,%esi
+  80187c:	83 f6 01             	xor    $0x1,%esi
+  80187f:	d3 e6                	shl    %cl,%esi
+  801881:	d3 e7                	shl    %cl,%edi
+  801883:	09 74 24 18          	or     %esi,0x18(%esp)
+  801887:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80188b:	eb 90                	jmp    80181d <__udivdi3+0x59>
+  80188d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801891:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  801895:	83 c4 20             	add    $0x20,%esp
+  801898:	5b                   	pop    %ebx
+  801899:	5e                   	pop    %esi
+  80189a:	5f                   	pop    %edi
+  80189b:	c3                   	ret
+
+0080189c <__umoddi3>:
+  80189c:	55                   	push   %ebp
+  80189d:	57                   	push   %edi
+  80189e:	56                   	push   %esi
+  80189f:	53                   	push   %ebx
+  8018a0:	83 ec 1c             	sub    $0x1c,%esp
+  8018a3:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8018a7:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8018ab:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8018af:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8018b3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8018b7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8018bb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8018bf:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8018c3:	89 d6                	mov    %edx,%esi
+  8018c5:	09 c6                	or     %eax,%esi
+  8018c7:	74 6c                	je     801935 <__umoddi3+0x99>
+  8018c9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8018ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d8:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  8018dc:	eb 0e                	jmp    8018ec <__umoddi3+0x50>
+  8018de:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  8018e3:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8018e7:	83 fe ff             	cmp    $0xffffffff,%esi
+  8018ea:	74 49                	je     801935 <__umoddi3+0x99>
+  8018ec:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8018f0:	01 c0                	add    %eax,%eax
+  8018f2:	89 c3                	mov    %eax,%ebx
+  8018f4:	89 d6                	mov    %edx,%esi
+  8018f6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8018fa:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8018fe:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801903:	0f ad d0             	shrd   %cl,%edx,%eax
+  801906:	d3 ea                	shr    %cl,%edx
+  801908:	f6 c1 20             	test   $0x20,%cl
+  80190b:	74 04                	je     801911 <__umoddi3+0x75>
+  80190d:	89 d0                	mov    %edx,%eax
+  80190f:	31 d2                	xor    %edx,%edx
+  801911:	83 e0 01             	and    $0x1,%eax
+  801914:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801919:	89 ea                	mov    %ebp,%edx
+  80191b:	09 d8                	or     %ebx,%eax
+  80191d:	09 f2                	or     %esi,%edx
+  80191f:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801923:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801927:	39 d8                	cmp    %ebx,%eax
+  801929:	89 d1                	mov    %edx,%ecx
+  80192b:	19 f1                	sbb    %esi,%ecx
+  80192d:	72 af                	jb     8018de <__umoddi3+0x42>
+  80192f:	29 d8                	sub    %ebx,%eax
+  801931:	19 f2                	sbb    %esi,%edx
+  801933:	eb a9                	jmp    8018de <__umoddi3+0x42>
+  801935:	83 c4 1c             	add    $0x1c,%esp
+  801938:	5b                   	pop    %ebx
+  801939:	5e                   	pop    %esi
+  80193a:	5f                   	pop    %edi
+  80193b:	5d                   	pop    %ebp
+  80193c:	c3                   	ret
+
+0080193d <__divdi3>:
+  80193d:	53                   	push   %ebx
+  80193e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801942:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801946:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80194a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80194e:	85 d2                	test   %edx,%edx
+  801950:	78 12                	js     801964 <__divdi3+0x27>
+  801952:	85 db                	test   %ebx,%ebx
+  801954:	78 2e                	js     801984 <__divdi3+0x47>
+  801956:	53                   	push   %ebx
+  801957:	51                   	push   %ecx
+  801958:	52                   	push   %edx
+  801959:	50                   	push   %eax
+  80195a:	e8 65 fe ff ff       	call   8017c4 <__udivdi3>
+  80195f:	83 c4 10             	add    $0x10,%esp
+  801962:	eb 1e                	jmp    801982 <__divdi3+0x45>
+  801964:	f7 d8                	neg    %eax
+  801966:	83 d2 00             	adc    $0x0,%edx
+  801969:	f7 da                	neg    %edx
+  80196b:	85 db                	test   %ebx,%ebx
+  80196d:	78 2a                	js     801999 <__divdi3+0x5c>
+  80196f:	53                   	push   %ebx
+  801970:	51                   	push   %ecx
+  801971:	52                   	push   %edx
+  801972:	50                   	push   %eax
+  801973:	e8 4c fe ff ff       	call   8017c4 <__udivdi3>
+  801978:	83 c4 10             	add    $0x10,%esp
+  80197b:	f7 d8                	neg    %eax
+  80197d:	83 d2 00             	adc    $0x0,%edx
+  801980:	f7 da                	neg    %edx
+  801982:	5b                   	pop    %ebx
+  801983:	c3                   	ret
+  801984:	f7 d9                	neg    %ecx
+  801986:	83 d3 00             	adc    $0x0,%ebx
+  801989:	f7 db                	neg    %ebx
+  80198b:	53                   	push   %ebx
+  80198c:	51                   	push   %ecx
+  80198d:	52                   	push   %edx
+  80198e:	50                   	push   %eax
+  80198f:	e8 30 fe ff ff       	call   8017c4 <__udivdi3>
+  801994:	83 c4 10             	add    $0x10,%esp
+  801997:	eb e2                	jmp    80197b <__divdi3+0x3e>
+  801999:	f7 d9                	neg    %ecx
+  80199b:	83 d3 00             	adc    $0x0,%ebx
+  80199e:	f7 db                	neg    %ebx
+  8019a0:	53                   	push   %ebx
+  8019a1:	51                   	push   %ecx
+  8019a2:	52                   	push   %edx
+  8019a3:	50                   	push   %eax
+  8019a4:	e8 1b fe ff ff       	call   8017c4 <__udivdi3>
+  8019a9:	83 c4 10             	add    $0x10,%esp
+  8019ac:	eb d4                	jmp    801982 <__divdi3+0x45>
+
+008019ae <__moddi3>:
+  8019ae:	55                   	push   %ebp
+  8019af:	57                   	push   %edi
+  8019b0:	56                   	push   %esi
+  8019b1:	53                   	push   %ebx
+  8019b2:	83 ec 14             	sub    $0x14,%esp
+  8019b5:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  8019b9:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  8019bd:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8019c1:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8019c5:	85 ed                	test   %ebp,%ebp
+  8019c7:	78 2b                	js     8019f4 <__moddi3+0x46>
+  8019c9:	89 c6                	mov    %eax,%esi
+  8019cb:	f7 de                	neg    %esi
+  8019cd:	89 34 24             	mov    %esi,(%esp)
+  8019d0:	89 d6                	mov    %edx,%esi
+  8019d2:	83 d6 00             	adc    $0x0,%esi
+  8019d5:	f7 de                	neg    %esi
+  8019d7:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8019db:	8b 34 24             	mov    (%esp),%esi
+  8019de:	0f 48 f0             	cmovs  %eax,%esi
+  8019e1:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  8019e6:	52                   	push   %edx
+  8019e7:	56                   	push   %esi
+  8019e8:	55                   	push   %ebp
+  8019e9:	57                   	push   %edi
+  8019ea:	e8 ad fe ff ff       	call   80189c <__umoddi3>
+  8019ef:	83 c4 10             	add    $0x10,%esp
+  8019f2:	eb 3c                	jmp    801a30 <__moddi3+0x82>
+  8019f4:	89 c3                	mov    %eax,%ebx
+  8019f6:	f7 db                	neg    %ebx
+  8019f8:	89 d1                	mov    %edx,%ecx
+  8019fa:	83 d1 00             	adc    $0x0,%ecx
+  8019fd:	f7 d9                	neg    %ecx
+  8019ff:	0f 49 c3             	cmovns %ebx,%eax
+  801a02:	89 04 24             	mov    %eax,(%esp)
+  801a05:	0f 49 d1             	cmovns %ecx,%edx
+  801a08:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801a0c:	ff 74 24 04          	push   0x4(%esp)
+  801a10:	ff 74 24 04          	push   0x4(%esp)
+  801a14:	89 f8                	mov    %edi,%eax
+  801a16:	89 ea                	mov    %ebp,%edx
+  801a18:	f7 d8                	neg    %eax
+  801a1a:	83 d2 00             	adc    $0x0,%edx
+  801a1d:	f7 da                	neg    %edx
+  801a1f:	52                   	push   %edx
+  801a20:	50                   	push   %eax
+  801a21:	e8 76 fe ff ff       	call   80189c <__umoddi3>
+  801a26:	83 c4 10             	add    $0x10,%esp
+  801a29:	f7 d8                	neg    %eax
+  801a2b:	83 d2 00             	adc    $0x0,%edx
+  801a2e:	f7 da                	neg    %edx
+  801a30:	83 c4 14             	add    $0x14,%esp
+  801a33:	5b                   	pop    %ebx
+  801a34:	5e                   	pop    %esi
+  801a35:	5f                   	pop    %edi
+  801a36:	5d                   	pop    %ebp
+  801a37:	c3                   	ret
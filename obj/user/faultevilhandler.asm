@@ -0,0 +1,2581 @@
+
+obj/user/faultevilhandler:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 34 00 00 00       	call   800065 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+  800039:	6a 07                	push   $0x7
+  80003b:	68 00 f0 ff ea       	push   $0xeafff000
+  800040:	6a 00                	push   $0x0
+  800042:	e8 c4 03 00 00       	call   80040b <sys_page_alloc>
+  800047:	83 c4 08             	add    $0x8,%esp
+  80004a:	68 20 00 10 f0       	push   $0xf0100020
+  80004f:	6a 00                	push   $0x0
+  800051:	e8 57 06 00 00       	call   8006ad <sys_env_set_pgfault_upcall>
+  800056:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80005d:	00 00 00 
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	c9                   	leave
+  800064:	c3                   	ret
+
+00800065 <libmain>:
+  800065:	55                   	push   %ebp
+  800066:	89 e5                	mov    %esp,%ebp
+  800068:	56                   	push   %esi
+  800069:	53                   	push   %ebx
+  80006a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80006d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800070:	e8 cb 09 00 00       	call   800a40 <uinfo_envid>
+  800075:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80007a:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  800080:	05 00 00 00 ed       	add    $0xed000000,%eax
+  800085:	a3 20 20 80 00       	mov    %eax,0x802020
+  80008a:	85 db                	test   %ebx,%ebx
+  80008c:	7e 07                	jle    800095 <libmain+0x30>
+  80008e:	8b 06                	mov    (%esi),%eax
+  800090:	a3 00 20 80 00       	mov    %eax,0x802000
+  800095:	83 ec 08             	sub    $0x8,%esp
+  800098:	56                   	push   %esi
+  800099:	53                   	push   %ebx
+  80009a:	e8 94 ff ff ff       	call   800033 <umain>
+  80009f:	e8 0a 00 00 00       	call   8000ae <exit>
+  8000a4:	83 c4 10             	add    $0x10,%esp
+  8000a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000aa:	5b                   	pop    %ebx
+  8000ab:	5e                   	pop    %esi
+  8000ac:	5d                   	pop    %ebp
+  8000ad:	c3                   	ret
+
+008000ae <exit>:
+  8000ae:	55                   	push   %ebp
+  8000af:	89 e5                	mov    %esp,%ebp
+  8000b1:	83 ec 08             	sub    $0x8,%esp
+  8000b4:	e8 20 0a 00 00       	call   800ad9 <bflush>
+  8000b9:	83 ec 0c             	sub    $0xc,%esp
+  8000bc:	6a 00                	push   $0x0
+  8000be:	e8 d3 00 00 00       	call   800196 <sys_env_destroy>
+  8000c3:	83 c4 10             	add    $0x10,%esp
+  8000c6:	c9                   	leave
+  8000c7:	c3                   	ret
+
+008000c8 <sys_cputs>:
+  8000c8:	55                   	push   %ebp
+  8000c9:	89 e5                	mov    %esp,%ebp
+  8000cb:	57                   	push   %edi
+  8000cc:	56                   	push   %esi
+  8000cd:	53                   	push   %ebx
+  8000ce:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000d5:	78 21                	js     8000f8 <sys_cputs+0x30>
+  8000d7:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000de:	75 2d                	jne    80010d <sys_cputs+0x45>
+  8000e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000eb:	89 c3                	mov    %eax,%ebx
+  8000ed:	89 c7                	mov    %eax,%edi
+  8000ef:	89 c6                	mov    %eax,%esi
+  8000f1:	cd 30                	int    $0x30
+  8000f3:	5b                   	pop    %ebx
+  8000f4:	5e                   	pop    %esi
+  8000f5:	5f                   	pop    %edi
+  8000f6:	5d                   	pop    %ebp
+  8000f7:	c3                   	ret
+  8000f8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000fd:	0f a2                	cpuid
+  8000ff:	c1 ea 0b             	shr    $0xb,%edx
+  800102:	83 e2 01             	and    $0x1,%edx
+  800105:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80010b:	eb ca                	jmp    8000d7 <sys_cputs+0xf>
+  80010d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800112:	8b 55 08             	mov    0x8(%ebp),%edx
+  800115:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800118:	89 c3                	mov    %eax,%ebx
+  80011a:	89 c7                	mov    %eax,%edi
+  80011c:	89 c6                	mov    %eax,%esi
+  80011e:	55                   	push   %ebp
+  80011f:	68 28 01 80 00       	push   $0x800128
+  800124:	89 e5                	mov    %esp,%ebp
+  800126:	0f 34                	sysenter
+  800128:	83 c4 04             	add    $0x4,%esp
+  80012b:	5d                   	pop    %ebp
+  80012c:	eb c5                	jmp    8000f3 <sys_cputs+0x2b>
+
+0080012e <sys_cgetc>:
+  80012e:	55                   	push   %ebp
+  80012f:	89 e5                	mov    %esp,%ebp
+  800131:	57                   	push   %edi
+  800132:	56                   	push   %esi
+  800133:	53                   	push   %ebx
+  800134:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80013b:	78 22                	js     80015f <sys_cgetc+0x31>
+  80013d:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800144:	75 2e                	jne    800174 <sys_cgetc+0x46>
+  800146:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800150:	89 d1                	mov    %edx,%ecx
+  800152:	89 d3                	mov    %edx,%ebx
+  800154:	89 d7                	mov    %edx,%edi
+  800156:	89 d6                	mov    %edx,%esi
+  800158:	cd 30                	int    $0x30
+  80015a:	5b                   	pop    %ebx
+  80015b:	5e                   	pop    %esi
+  80015c:	5f                   	pop    %edi
+  80015d:	5d                   	pop    %ebp
+  80015e:	c3                   	ret
+  80015f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800164:	0f a2                	cpuid
+  800166:	c1 ea 0b             	shr    $0xb,%edx
+  800169:	83 e2 01             	and    $0x1,%edx
+  80016c:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800172:	eb c9                	jmp    80013d <sys_cgetc+0xf>
+  800174:	ba 00 00 00 00       	mov    $0x0,%edx
+  800179:	b8 01 00 00 00       	mov    $0x1,%eax
+  80017e:	89 d1                	mov    %edx,%ecx
+  800180:	89 d3                	mov    %edx,%ebx
+  800182:	89 d7                	mov    %edx,%edi
+  800184:	89 d6                	mov    %edx,%esi
+  800186:	55                   	push   %ebp
+  800187:	68 90 01 80 00       	push   $0x800190
+  80018c:	89 e5                	mov    %esp,%ebp
+  80018e:	0f 34                	sysenter
+  800190:	83 c4 04             	add    $0x4,%esp
+  800193:	5d                   	pop    %ebp
+  800194:	eb c4                	jmp    80015a <sys_cgetc+0x2c>
+
+00800196 <sys_env_destroy>:
+  800196:	55                   	push   %ebp
+  800197:	89 e5                	mov    %esp,%ebp
+  800199:	57                   	push   %edi
+  80019a:	56                   	push   %esi
+  80019b:	53                   	push   %ebx
+  80019c:	83 ec 0c             	sub    $0xc,%esp
+  80019f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8001a6:	78 2a                	js     8001d2 <sys_env_destroy+0x3c>
+  8001a8:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8001af:	75 36                	jne    8001e7 <sys_env_destroy+0x51>
+  8001b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001b6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8001bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001be:	89 cb                	mov    %ecx,%ebx
+  8001c0:	89 cf                	mov    %ecx,%edi
+  8001c2:	89 ce                	mov    %ecx,%esi
+  8001c4:	cd 30                	int    $0x30
+  8001c6:	85 c0                	test   %eax,%eax
+  8001c8:	7f 40                	jg     80020a <sys_env_destroy+0x74>
+  8001ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001cd:	5b                   	pop    %ebx
+  8001ce:	5e                   	pop    %esi
+  8001cf:	5f                   	pop    %edi
+  8001d0:	5d                   	pop    %ebp
+  8001d1:	c3                   	ret
+  8001d2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001d7:	0f a2                	cpuid
+  8001d9:	c1 ea 0b             	shr    $0xb,%edx
+  8001dc:	83 e2 01             	and    $0x1,%edx
+  8001df:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8001e5:	eb c1                	jmp    8001a8 <sys_env_destroy+0x12>
+  8001e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001ef:	b8 03 00 00 00       	mov    $0x3,%eax
+  8001f4:	89 cb                	mov    %ecx,%ebx
+  8001f6:	89 cf                	mov    %ecx,%edi
+  8001f8:	89 ce                	mov    %ecx,%esi
+  8001fa:	55                   	push   %ebp
+  8001fb:	68 04 02 80 00       	push   $0x800204
+  800200:	89 e5                	mov    %esp,%ebp
+  800202:	0f 34                	sysenter
+  800204:	83 c4 04             	add    $0x4,%esp
+  800207:	5d                   	pop    %ebp
+  800208:	eb bc                	jmp    8001c6 <sys_env_destroy+0x30>
+  80020a:	83 ec 0c             	sub    $0xc,%esp
+  80020d:	50                   	push   %eax
+  80020e:	6a 03                	push   $0x3
+  800210:	68 aa 19 80 00       	push   $0x8019aa
+  800215:	6a 49                	push   $0x49
+  800217:	68 c7 19 80 00       	push   $0x8019c7
+  80021c:	e8 af 09 00 00       	call   800bd0 <_panic>
+
+00800221 <sys_getenvid>:
+  800221:	55                   	push   %ebp
+  800222:	89 e5                	mov    %esp,%ebp
+  800224:	57                   	push   %edi
+  800225:	56                   	push   %esi
+  800226:	53                   	push   %ebx
+  800227:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80022e:	78 22                	js     800252 <sys_getenvid+0x31>
+  800230:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800237:	75 2e                	jne    800267 <sys_getenvid+0x46>
+  800239:	ba 00 00 00 00       	mov    $0x0,%edx
+  80023e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800243:	89 d1                	mov    %edx,%ecx
+  800245:	89 d3                	mov    %edx,%ebx
+  800247:	89 d7                	mov    %edx,%edi
+  800249:	89 d6                	mov    %edx,%esi
+  80024b:	cd 30                	int    $0x30
+  80024d:	5b                   	pop    %ebx
+  80024e:	5e                   	pop    %esi
+  80024f:	5f                   	pop    %edi
+  800250:	5d                   	pop    %ebp
+  800251:	c3                   	ret
+  800252:	b8 01 00 00 00       	mov    $0x1,%eax
+  800257:	0f a2                	cpuid
+  800259:	c1 ea 0b             	shr    $0xb,%edx
+  80025c:	83 e2 01             	and    $0x1,%edx
+  80025f:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800265:	eb c9                	jmp    800230 <sys_getenvid+0xf>
+  800267:	ba 00 00 00 00       	mov    $0x0,%edx
+  80026c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800271:	89 d1                	mov    %edx,%ecx
+  800273:	89 d3                	mov    %edx,%ebx
+  800275:	89 d7                	mov    %edx,%edi
+  800277:	89 d6                	mov    %edx,%esi
+  800279:	55                   	push   %ebp
+  80027a:	68 83 02 80 00       	push   $0x800283
+  80027f:	89 e5                	mov    %esp,%ebp
+  800281:	0f 34                	sysenter
+  800283:	83 c4 04             	add    $0x4,%esp
+  800286:	5d                   	pop    %ebp
+  800287:	eb c4                	jmp    80024d <sys_getenvid+0x2c>
+
+00800289 <sys_yield>:
+  800289:	55                   	push   %ebp
+  80028a:	89 e5                	mov    %esp,%ebp
+  80028c:	57                   	push   %edi
+  80028d:	56                   	push   %esi
+  80028e:	53                   	push   %ebx
+  80028f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800296:	78 22                	js     8002ba <sys_yield+0x31>
+  800298:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80029f:	75 2e                	jne    8002cf <sys_yield+0x46>
+  8002a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002ab:	89 d1                	mov    %edx,%ecx
+  8002ad:	89 d3                	mov    %edx,%ebx
+  8002af:	89 d7                	mov    %edx,%edi
+  8002b1:	89 d6                	mov    %edx,%esi
+  8002b3:	cd 30                	int    $0x30
+  8002b5:	5b                   	pop    %ebx
+  8002b6:	5e                   	pop    %esi
+  8002b7:	5f                   	pop    %edi
+  8002b8:	5d                   	pop    %ebp
+  8002b9:	c3                   	ret
+  8002ba:	b8 01 00 00 00       	mov    $0x1,%eax
+  8002bf:	0f a2                	cpuid
+  8002c1:	c1 ea 0b             	shr    $0xb,%edx
+  8002c4:	83 e2 01             	and    $0x1,%edx
+  8002c7:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8002cd:	eb c9                	jmp    800298 <sys_yield+0xf>
+  8002cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002d4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002d9:	89 d1                	mov    %edx,%ecx
+  8002db:	89 d3                	mov    %edx,%ebx
+  8002dd:	89 d7                	mov    %edx,%edi
+  8002df:	89 d6                	mov    %edx,%esi
+  8002e1:	55                   	push   %ebp
+  8002e2:	68 eb 02 80 00       	push   $0x8002eb
+  8002e7:	89 e5                	mov    %esp,%ebp
+  8002e9:	0f 34                	sysenter
+  8002eb:	83 c4 04             	add    $0x4,%esp
+  8002ee:	5d                   	pop    %ebp
+  8002ef:	eb c4                	jmp    8002b5 <sys_yield+0x2c>
+
+008002f1 <sys_env_set_cow>:
+  8002f1:	55                   	push   %ebp
+  8002f2:	89 e5                	mov    %esp,%ebp
+  8002f4:	57                   	push   %edi
+  8002f5:	56                   	push   %esi
+  8002f6:	53                   	push   %ebx
+  8002f7:	83 ec 0c             	sub    $0xc,%esp
+  8002fa:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800301:	78 2b                	js     80032e <sys_env_set_cow+0x3d>
+  800303:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80030a:	75 37                	jne    800343 <sys_env_set_cow+0x52>
+  80030c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800311:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800316:	8b 55 08             	mov    0x8(%ebp),%edx
+  800319:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80031c:	89 df                	mov    %ebx,%edi
+  80031e:	89 de                	mov    %ebx,%esi
+  800320:	cd 30                	int    $0x30
+  800322:	85 c0                	test   %eax,%eax
+  800324:	7f 41                	jg     800367 <sys_env_set_cow+0x76>
+  800326:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800329:	5b                   	pop    %ebx
+  80032a:	5e                   	pop    %esi
+  80032b:	5f                   	pop    %edi
+  80032c:	5d                   	pop    %ebp
+  80032d:	c3                   	ret
+  80032e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800333:	0f a2                	cpuid
+  800335:	c1 ea 0b             	shr    $0xb,%edx
+  800338:	83 e2 01             	and    $0x1,%edx
+  80033b:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800341:	eb c0                	jmp    800303 <sys_env_set_cow+0x12>
+  800343:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800348:	8b 55 08             	mov    0x8(%ebp),%edx
+  80034b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80034e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800353:	89 df                	mov    %ebx,%edi
+  800355:	89 de                	mov    %ebx,%esi
+  800357:	55                   	push   %ebp
+  800358:	68 61 03 80 00       	push   $0x800361
+  80035d:	89 e5                	mov    %esp,%ebp
+  80035f:	0f 34                	sysenter
+  800361:	83 c4 04             	add    $0x4,%esp
+  800364:	5d                   	pop    %ebp
+  800365:	eb bb                	jmp    800322 <sys_env_set_cow+0x31>
+  800367:	83 ec 0c             	sub    $0xc,%esp
+  80036a:	50                   	push   %eax
+  80036b:	6a 0d                	push   $0xd
+  80036d:	68 aa 19 80 00       	push   $0x8019aa
+  800372:	6a 49                	push   $0x49
+  800374:	68 c7 19 80 00       	push   $0x8019c7
+  800379:	e8 52 08 00 00       	call   800bd0 <_panic>
+
+0080037e <sys_env_set_quota>:
+  80037e:	55                   	push   %ebp
+  80037f:	89 e5                	mov    %esp,%ebp
+  800381:	57                   	push   %edi
+  800382:	56                   	push   %esi
+  800383:	53                   	push   %ebx
+  800384:	83 ec 0c             	sub    $0xc,%esp
+  800387:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80038e:	78 2b                	js     8003bb <sys_env_set_quota+0x3d>
+  800390:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800397:	75 37                	jne    8003d0 <sys_env_set_quota+0x52>
+  800399:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80039e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003a9:	89 df                	mov    %ebx,%edi
+  8003ab:	89 de                	mov    %ebx,%esi
+  8003ad:	cd 30                	int    $0x30
+  8003af:	85 c0                	test   %eax,%eax
+  8003b1:	7f 41                	jg     8003f4 <sys_env_set_quota+0x76>
+  8003b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003b6:	5b                   	pop    %ebx
+  8003b7:	5e                   	pop    %esi
+  8003b8:	5f                   	pop    %edi
+  8003b9:	5d                   	pop    %ebp
+  8003ba:	c3                   	ret
+  8003bb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003c0:	0f a2                	cpuid
+  8003c2:	c1 ea 0b             	shr    $0xb,%edx
+  8003c5:	83 e2 01             	and    $0x1,%edx
+  8003c8:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8003ce:	eb c0                	jmp    800390 <sys_env_set_quota+0x12>
+  8003d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003db:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003e0:	89 df                	mov    %ebx,%edi
+  8003e2:	89 de                	mov    %ebx,%esi
+  8003e4:	55                   	push   %ebp
+  8003e5:	68 ee 03 80 00       	push   $0x8003ee
+  8003ea:	89 e5                	mov    %esp,%ebp
+  8003ec:	0f 34                	sysenter
+  8003ee:	83 c4 04             	add    $0x4,%esp
+  8003f1:	5d                   	pop    %ebp
+  8003f2:	eb bb                	jmp    8003af <sys_env_set_quota+0x31>
+  8003f4:	83 ec 0c             	sub    $0xc,%esp
+  8003f7:	50                   	push   %eax
+  8003f8:	6a 0f                	push   $0xf
+  8003fa:	68 aa 19 80 00       	push   $0x8019aa
+  8003ff:	6a 49                	push   $0x49
+  800401:	68 c7 19 80 00       	push   $0x8019c7
+  800406:	e8 c5 07 00 00       	call   800bd0 <_panic>
+
+0080040b <sys_page_alloc>:
+  80040b:	55                   	push   %ebp
+  80040c:	89 e5                	mov    %esp,%ebp
+  80040e:	57                   	push   %edi
+  80040f:	56                   	push   %esi
+  800410:	53                   	push   %ebx
+  800411:	83 ec 0c             	sub    $0xc,%esp
+  800414:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80041b:	78 2c                	js     800449 <sys_page_alloc+0x3e>
+  80041d:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800424:	75 38                	jne    80045e <sys_page_alloc+0x53>
+  800426:	be 00 00 00 00       	mov    $0x0,%esi
+  80042b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800430:	8b 55 08             	mov    0x8(%ebp),%edx
+  800433:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800436:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800439:	89 f7                	mov    %esi,%edi
+  80043b:	cd 30                	int    $0x30
+  80043d:	85 c0                	test   %eax,%eax
+  80043f:	7f 42                	jg     800483 <sys_page_alloc+0x78>
+  800441:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800444:	5b                   	pop    %ebx
+  800445:	5e                   	pop    %esi
+  800446:	5f                   	pop    %edi
+  800447:	5d                   	pop    %ebp
+  800448:	c3                   	ret
+  800449:	b8 01 00 00 00       	mov    $0x1,%eax
+  80044e:	0f a2                	cpuid
+  800450:	c1 ea 0b             	shr    $0xb,%edx
+  800453:	83 e2 01             	and    $0x1,%edx
+  800456:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80045c:	eb bf                	jmp    80041d <sys_page_alloc+0x12>
+  80045e:	be 00 00 00 00       	mov    $0x0,%esi
+  800463:	8b 55 08             	mov    0x8(%ebp),%edx
+  800466:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800469:	b8 04 00 00 00       	mov    $0x4,%eax
+  80046e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800471:	89 f7                	mov    %esi,%edi
+  800473:	55                   	push   %ebp
+  800474:	68 7d 04 80 00       	push   $0x80047d
+  800479:	89 e5                	mov    %esp,%ebp
+  80047b:	0f 34                	sysenter
+  80047d:	83 c4 04             	add    $0x4,%esp
+  800480:	5d                   	pop    %ebp
+  800481:	eb ba                	jmp    80043d <sys_page_alloc+0x32>
+  800483:	83 ec 0c             	sub    $0xc,%esp
+  800486:	50                   	push   %eax
+  800487:	6a 04                	push   $0x4
+  800489:	68 aa 19 80 00       	push   $0x8019aa
+  80048e:	6a 49                	push   $0x49
+  800490:	68 c7 19 80 00       	push   $0x8019c7
+  800495:	e8 36 07 00 00       	call   800bd0 <_panic>
+
+0080049a <sys_page_map>:
+  80049a:	55                   	push   %ebp
+  80049b:	89 e5                	mov    %esp,%ebp
+  80049d:	57                   	push   %edi
+  80049e:	56                   	push   %esi
+  80049f:	53                   	push   %ebx
+  8004a0:	83 ec 0c             	sub    $0xc,%esp
+  8004a3:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8004aa:	78 2b                	js     8004d7 <sys_page_map+0x3d>
+  8004ac:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8004b3:	75 37                	jne    8004ec <sys_page_map+0x52>
+  8004b5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8004ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004c6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004c9:	cd 30                	int    $0x30
+  8004cb:	85 c0                	test   %eax,%eax
+  8004cd:	7f 41                	jg     800510 <sys_page_map+0x76>
+  8004cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004d2:	5b                   	pop    %ebx
+  8004d3:	5e                   	pop    %esi
+  8004d4:	5f                   	pop    %edi
+  8004d5:	5d                   	pop    %ebp
+  8004d6:	c3                   	ret
+  8004d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004dc:	0f a2                	cpuid
+  8004de:	c1 ea 0b             	shr    $0xb,%edx
+  8004e1:	83 e2 01             	and    $0x1,%edx
+  8004e4:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8004ea:	eb c0                	jmp    8004ac <sys_page_map+0x12>
+  8004ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004f2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8004f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004fd:	8b 75 18             	mov    0x18(%ebp),%esi
+  800500:	55                   	push   %ebp
+  800501:	68 0a 05 80 00       	push   $0x80050a
+  800506:	89 e5                	mov    %esp,%ebp
+  800508:	0f 34                	sysenter
+  80050a:	83 c4 04             	add    $0x4,%esp
+  80050d:	5d                   	pop    %ebp
+  80050e:	eb bb                	jmp    8004cb <sys_page_map+0x31>
+  800510:	83 ec 0c             	sub    $0xc,%esp
+  800513:	50                   	push   %eax
+  800514:	6a 05                	push   $0x5
+  800516:	68 aa 19 80 00       	push   $0x8019aa
+  80051b:	6a 49                	push   $0x49
+  80051d:	68 c7 19 80 00       	push   $0x8019c7
+  800522:	e8 a9 06 00 00       	call   800bd0 <_panic>
+
+00800527 <sys_page_unmap>:
+  800527:	55                   	push   %ebp
+  800528:	89 e5                	mov    %esp,%ebp
+  80052a:	57                   	push   %edi
+  80052b:	56                   	push   %esi
+  80052c:	53                   	push   %ebx
+  80052d:	83 ec 0c             	sub    $0xc,%esp
+  800530:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800537:	78 2b                	js     800564 <sys_page_unmap+0x3d>
+  800539:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800540:	75 37                	jne    800579 <sys_page_unmap+0x52>
+  800542:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800547:	b8 06 00 00 00       	mov    $0x6,%eax
+  80054c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80054f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800552:	89 df                	mov    %ebx,%edi
+  800554:	89 de                	mov    %ebx,%esi
+  800556:	cd 30                	int    $0x30
+  800558:	85 c0                	test   %eax,%eax
+  80055a:	7f 41                	jg     80059d <sys_page_unmap+0x76>
+  80055c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80055f:	5b                   	pop    %ebx
+  800560:	5e                   	pop    %esi
+  800561:	5f                   	pop    %edi
+  800562:	5d                   	pop    %ebp
+  800563:	c3                   	ret
+  800564:	b8 01 00 00 00       	mov    $0x1,%eax
+  800569:	0f a2                	cpuid
+  80056b:	c1 ea 0b             	shr    $0xb,%edx
+  80056e:	83 e2 01             	and    $0x1,%edx
+  800571:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800577:	eb c0                	jmp    800539 <sys_page_unmap+0x12>
+  800579:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80057e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800581:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800584:	b8 06 00 00 00       	mov    $0x6,%eax
+  800589:	89 df                	mov    %ebx,%edi
+  80058b:	89 de                	mov    %ebx,%esi
+  80058d:	55                   	push   %ebp
+  80058e:	68 97 05 80 00       	push   $0x800597
+  800593:	89 e5                	mov    %esp,%ebp
+  800595:	0f 34                	sysenter
+  800597:	83 c4 04             	add    $0x4,%esp
+  80059a:	5d                   	pop    %ebp
+  80059b:	eb bb                	jmp    800558 <sys_page_unmap+0x31>
+  80059d:	83 ec 0c             	sub    $0xc,%esp
+  8005a0:	50                   	push   %eax
+  8005a1:	6a 06                	push   $0x6
+  8005a3:	68 aa 19 80 00       	push   $0x8019aa
+  8005a8:	6a 49                	push   $0x49
+  8005aa:	68 c7 19 80 00       	push   $0x8019c7
+  8005af:	e8 1c 06 00 00       	call   800bd0 <_panic>
+
+008005b4 <sys_page_reuse>:
+  8005b4:	55                   	push   %ebp
+  8005b5:	89 e5                	mov    %esp,%ebp
+  8005b7:	57                   	push   %edi
+  8005b8:	56                   	push   %esi
+  8005b9:	53                   	push   %ebx
+  8005ba:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8005c1:	78 24                	js     8005e7 <sys_page_reuse+0x33>
+  8005c3:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8005ca:	75 30                	jne    8005fc <sys_page_reuse+0x48>
+  8005cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005dc:	89 df                	mov    %ebx,%edi
+  8005de:	89 de                	mov    %ebx,%esi
+  8005e0:	cd 30                	int    $0x30
+  8005e2:	5b                   	pop    %ebx
+  8005e3:	5e                   	pop    %esi
+  8005e4:	5f                   	pop    %edi
+  8005e5:	5d                   	pop    %ebp
+  8005e6:	c3                   	ret
+  8005e7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005ec:	0f a2                	cpuid
+  8005ee:	c1 ea 0b             	shr    $0xb,%edx
+  8005f1:	83 e2 01             	and    $0x1,%edx
+  8005f4:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8005fa:	eb c7                	jmp    8005c3 <sys_page_reuse+0xf>
+  8005fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800601:	8b 55 08             	mov    0x8(%ebp),%edx
+  800604:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800607:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80060c:	89 df                	mov    %ebx,%edi
+  80060e:	89 de                	mov    %ebx,%esi
+  800610:	55                   	push   %ebp
+  800611:	68 1a 06 80 00       	push   $0x80061a
+  800616:	89 e5                	mov    %esp,%ebp
+  800618:	0f 34                	sysenter
+  80061a:	83 c4 04             	add    $0x4,%esp
+  80061d:	5d                   	pop    %ebp
+  80061e:	eb c2                	jmp    8005e2 <sys_page_reuse+0x2e>
+
+00800620 <sys_env_set_status>:
+  800620:	55                   	push   %ebp
+  800621:	89 e5                	mov    %esp,%ebp
+  800623:	57                   	push   %edi
+  800624:	56                   	push   %esi
+  800625:	53                   	push   %ebx
+  800626:	83 ec 0c             	sub    $0xc,%esp
+  800629:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800630:	78 2b                	js     80065d <sys_env_set_status+0x3d>
+  800632:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800639:	75 37                	jne    800672 <sys_env_set_status+0x52>
+  80063b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800640:	b8 08 00 00 00       	mov    $0x8,%eax
+  800645:	8b 55 08             	mov    0x8(%ebp),%edx
+  800648:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80064b:	89 df                	mov    %ebx,%edi
+  80064d:	89 de                	mov    %ebx,%esi
+  80064f:	cd 30                	int    $0x30
+  800651:	85 c0                	test   %eax,%eax
+  800653:	7f 41                	jg     800696 <sys_env_set_status+0x76>
+  800655:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800658:	5b                   	pop    %ebx
+  800659:	5e                   	pop    %esi
+  80065a:	5f                   	pop    %edi
+  80065b:	5d                   	pop    %ebp
+  80065c:	c3                   	ret
+  80065d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800662:	0f a2                	cpuid
+  800664:	c1 ea 0b             	shr    $0xb,%edx
+  800667:	83 e2 01             	and    $0x1,%edx
+  80066a:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800670:	eb c0                	jmp    800632 <sys_env_set_status+0x12>
+  800672:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800677:	8b 55 08             	mov    0x8(%ebp),%edx
+  80067a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80067d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800682:	89 df                	mov    %ebx,%edi
+  800684:	89 de                	mov    %ebx,%esi
+  800686:	55                   	push   %ebp
+  800687:	68 90 06 80 00       	push   $0x800690
+  80068c:	89 e5                	mov    %esp,%ebp
+  80068e:	0f 34                	sysenter
+  800690:	83 c4 04             	add    $0x4,%esp
+  800693:	5d                   	pop    %ebp
+  800694:	eb bb                	jmp    800651 <sys_env_set_status+0x31>
+  800696:	83 ec 0c             	sub    $0xc,%esp
+  800699:	50                   	push   %eax
+  80069a:	6a 08                	push   $0x8
+  80069c:	68 aa 19 80 00       	push   $0x8019aa
+  8006a1:	6a 49                	push   $0x49
+  8006a3:	68 c7 19 80 00       	push   $0x8019c7
+  8006a8:	e8 23 05 00 00       	call   800bd0 <_panic>
+
+008006ad <sys_env_set_pgfault_upcall>:
+  8006ad:	55                   	push   %ebp
+  8006ae:	89 e5                	mov    %esp,%ebp
+  8006b0:	57                   	push   %edi
+  8006b1:	56                   	push   %esi
+  8006b2:	53                   	push   %ebx
+  8006b3:	83 ec 0c             	sub    $0xc,%esp
+  8006b6:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8006bd:	78 2b                	js     8006ea <sys_env_set_pgfault_upcall+0x3d>
+  8006bf:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8006c6:	75 37                	jne    8006ff <sys_env_set_pgfault_upcall+0x52>
+  8006c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006cd:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006d8:	89 df                	mov    %ebx,%edi
+  8006da:	89 de                	mov    %ebx,%esi
+  8006dc:	cd 30                	int    $0x30
+  8006de:	85 c0                	test   %eax,%eax
+  8006e0:	7f 41                	jg     800723 <sys_env_set_pgfault_upcall+0x76>
+  8006e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006e5:	5b                   	pop    %ebx
+  8006e6:	5e                   	pop    %esi
+  8006e7:	5f                   	pop    %edi
+  8006e8:	5d                   	pop    %ebp
+  8006e9:	c3                   	ret
+  8006ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006ef:	0f a2                	cpuid
+  8006f1:	c1 ea 0b             	shr    $0xb,%edx
+  8006f4:	83 e2 01             	and    $0x1,%edx
+  8006f7:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8006fd:	eb c0                	jmp    8006bf <sys_env_set_pgfault_upcall+0x12>
+  8006ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800704:	8b 55 08             	mov    0x8(%ebp),%edx
+  800707:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80070a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80070f:	89 df                	mov    %ebx,%edi
+  800711:	89 de                	mov    %ebx,%esi
+  800713:	55                   	push   %ebp
+  800714:	68 1d 07 80 00       	push   $0x80071d
+  800719:	89 e5                	mov    %esp,%ebp
+  80071b:	0f 34                	sysenter
+  80071d:	83 c4 04             	add    $0x4,%esp
+  800720:	5d                   	pop    %ebp
+  800721:	eb bb                	jmp    8006de <sys_env_set_pgfault_upcall+0x31>
+  800723:	83 ec 0c             	sub    $0xc,%esp
+  800726:	50                   	push   %eax
+  800727:	6a 09                	push   $0x9
+  800729:	68 aa 19 80 00       	push   $0x8019aa
+  80072e:	6a 49                	push   $0x49
+  800730:	68 c7 19 80 00       	push   $0x8019c7
+  800735:	e8 96 04 00 00       	call   800bd0 <_panic>
+
+0080073a <sys_env_set_trace>:
+  80073a:	55                   	push   %ebp
+  80073b:	89 e5                	mov    %esp,%ebp
+  80073d:	57                   	push   %edi
+  80073e:	56                   	push   %esi
+  80073f:	53                   	push   %ebx
+  800740:	83 ec 0c             	sub    $0xc,%esp
+  800743:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80074a:	78 2b                	js     800777 <sys_env_set_trace+0x3d>
+  80074c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800753:	75 37                	jne    80078c <sys_env_set_trace+0x52>
+  800755:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80075a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80075f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800762:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800765:	89 df                	mov    %ebx,%edi
+  800767:	89 de                	mov    %ebx,%esi
+  800769:	cd 30                	int    $0x30
+  80076b:	85 c0                	test   %eax,%eax
+  80076d:	7f 41                	jg     8007b0 <sys_env_set_trace+0x76>
+  80076f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800772:	5b                   	pop    %ebx
+  800773:	5e                   	pop    %esi
+  800774:	5f                   	pop    %edi
+  800775:	5d                   	pop    %ebp
+  800776:	c3                   	ret
+  800777:	b8 01 00 00 00       	mov    $0x1,%eax
+  80077c:	0f a2                	cpuid
+  80077e:	c1 ea 0b             	shr    $0xb,%edx
+  800781:	83 e2 01             	and    $0x1,%edx
+  800784:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80078a:	eb c0                	jmp    80074c <sys_env_set_trace+0x12>
+  80078c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800791:	8b 55 08             	mov    0x8(%ebp),%edx
+  800794:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800797:	b8 12 00 00 00       	mov    $0x12,%eax
+  80079c:	89 df                	mov    %ebx,%edi
+  80079e:	89 de                	mov    %ebx,%esi
+  8007a0:	55                   	push   %ebp
+  8007a1:	68 aa 07 80 00       	push   $0x8007aa
+  8007a6:	89 e5                	mov    %esp,%ebp
+  8007a8:	0f 34                	sysenter
+  8007aa:	83 c4 04             	add    $0x4,%esp
+  8007ad:	5d                   	pop    %ebp
+  8007ae:	eb bb                	jmp    80076b <sys_env_set_trace+0x31>
+  8007b0:	83 ec 0c             	sub    $0xc,%esp
+  8007b3:	50                   	push   %eax
+  8007b4:	6a 12                	push   $0x12
+  8007b6:	68 aa 19 80 00       	push   $0x8019aa
+  8007bb:	6a 49                	push   $0x49
+  8007bd:	68 c7 19 80 00       	push   $0x8019c7
+  8007c2:	e8 09 04 00 00       	call   800bd0 <_panic>
+
+008007c7 <sys_env_set_rdpmc>:
+  8007c7:	55                   	push   %ebp
+  8007c8:	89 e5                	mov    %esp,%ebp
+  8007ca:	57                   	push   %edi
+  8007cb:	56                   	push   %esi
+  8007cc:	53                   	push   %ebx
+  8007cd:	83 ec 0c             	sub    $0xc,%esp
+  8007d0:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007d7:	78 2b                	js     800804 <sys_env_set_rdpmc+0x3d>
+  8007d9:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007e0:	75 37                	jne    800819 <sys_env_set_rdpmc+0x52>
+  8007e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007e7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8007ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f2:	89 df                	mov    %ebx,%edi
+  8007f4:	89 de                	mov    %ebx,%esi
+  8007f6:	cd 30                	int    $0x30
+  8007f8:	85 c0                	test   %eax,%eax
+  8007fa:	7f 41                	jg     80083d <sys_env_set_rdpmc+0x76>
+  8007fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ff:	5b                   	pop    %ebx
+  800800:	5e                   	pop    %esi
+  800801:	5f                   	pop    %edi
+  800802:	5d                   	pop    %ebp
+  800803:	c3                   	ret
+  800804:	b8 01 00 00 00       	mov    $0x1,%eax
+  800809:	0f a2                	cpuid
+  80080b:	c1 ea 0b             	shr    $0xb,%edx
+  80080e:	83 e2 01             	and    $0x1,%edx
+  800811:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800817:	eb c0                	jmp    8007d9 <sys_env_set_rdpmc+0x12>
+  800819:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80081e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800821:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800824:	b8 13 00 00 00       	mov    $0x13,%eax
+  800829:	89 df                	mov    %ebx,%edi
+  80082b:	89 de                	mov    %ebx,%esi
+  80082d:	55                   	push   %ebp
+  80082e:	68 37 08 80 00       	push   $0x800837
+  800833:	89 e5                	mov    %esp,%ebp
+  800835:	0f 34                	sysenter
+  800837:	83 c4 04             	add    $0x4,%esp
+  80083a:	5d                   	pop    %ebp
+  80083b:	eb bb                	jmp    8007f8 <sys_env_set_rdpmc+0x31>
+  80083d:	83 ec 0c             	sub    $0xc,%esp
+  800840:	50                   	push   %eax
+  800841:	6a 13                	push   $0x13
+  800843:	68 aa 19 80 00       	push   $0x8019aa
+  800848:	6a 49                	push   $0x49
+  80084a:	68 c7 19 80 00       	push   $0x8019c7
+  80084f:	e8 7c 03 00 00       	call   800bd0 <_panic>
+
+00800854 <sys_ring_setup>:
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	57                   	push   %edi
+  800858:	56                   	push   %esi
+  800859:	53                   	push   %ebx
+  80085a:	83 ec 0c             	sub    $0xc,%esp
+  80085d:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800864:	78 29                	js     80088f <sys_ring_setup+0x3b>
+  800866:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80086d:	75 35                	jne    8008a4 <sys_ring_setup+0x50>
+  80086f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800874:	b8 10 00 00 00       	mov    $0x10,%eax
+  800879:	89 d1                	mov    %edx,%ecx
+  80087b:	89 d3                	mov    %edx,%ebx
+  80087d:	89 d7                	mov    %edx,%edi
+  80087f:	89 d6                	mov    %edx,%esi
+  800881:	cd 30                	int    $0x30
+  800883:	85 c0                	test   %eax,%eax
+  800885:	7f 3f                	jg     8008c6 <sys_ring_setup+0x72>
+  800887:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80088a:	5b                   	pop    %ebx
+  80088b:	5e                   	pop    %esi
+  80088c:	5f                   	pop    %edi
+  80088d:	5d                   	pop    %ebp
+  80088e:	c3                   	ret
+  80088f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800894:	0f a2                	cpuid
+  800896:	c1 ea 0b             	shr    $0xb,%edx
+  800899:	83 e2 01             	and    $0x1,%edx
+  80089c:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8008a2:	eb c2                	jmp    800866 <sys_ring_setup+0x12>
+  8008a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008a9:	b8 10 00 00 00       	mov    $0x10,%eax
+  8008ae:	89 d1                	mov    %edx,%ecx
+  8008b0:	89 d3                	mov    %edx,%ebx
+  8008b2:	89 d7                	mov    %edx,%edi
+  8008b4:	89 d6                	mov    %edx,%esi
+  8008b6:	55                   	push   %ebp
+  8008b7:	68 c0 08 80 00       	push   $0x8008c0
+  8008bc:	89 e5                	mov    %esp,%ebp
+  8008be:	0f 34                	sysenter
+  8008c0:	83 c4 04             	add    $0x4,%esp
+  8008c3:	5d                   	pop    %ebp
+  8008c4:	eb bd                	jmp    800883 <sys_ring_setup+0x2f>
+  8008c6:	83 ec 0c             	sub    $0xc,%esp
+  8008c9:	50                   	push   %eax
+  8008ca:	6a 10                	push   $0x10
+  8008cc:	68 aa 19 80 00       	push   $0x8019aa
+  8008d1:	6a 49                	push   $0x49
+  8008d3:	68 c7 19 80 00       	push   $0x8019c7
+  8008d8:	e8 f3 02 00 00       	call   800bd0 <_panic>
+
+008008dd <sys_ring_enter>:
+  8008dd:	55                   	push   %ebp
+  8008de:	89 e5                	mov    %esp,%ebp
+  8008e0:	57                   	push   %edi
+  8008e1:	56                   	push   %esi
+  8008e2:	53                   	push   %ebx
+  8008e3:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008ea:	78 22                	js     80090e <sys_ring_enter+0x31>
+  8008ec:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008f3:	75 2e                	jne    800923 <sys_ring_enter+0x46>
+  8008f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008fa:	b8 11 00 00 00       	mov    $0x11,%eax
+  8008ff:	89 d1                	mov    %edx,%ecx
+  800901:	89 d3                	mov    %edx,%ebx
+  800903:	89 d7                	mov    %edx,%edi
+  800905:	89 d6                	mov    %edx,%esi
+  800907:	cd 30                	int    $0x30
+  800909:	5b                   	pop    %ebx
+  80090a:	5e                   	pop    %esi
+  80090b:	5f                   	pop    %edi
+  80090c:	5d                   	pop    %ebp
+  80090d:	c3                   	ret
+  80090e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800913:	0f a2                	cpuid
+  800915:	c1 ea 0b             	shr    $0xb,%edx
+  800918:	83 e2 01             	and    $0x1,%edx
+  80091b:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800921:	eb c9                	jmp    8008ec <sys_ring_enter+0xf>
+  800923:	ba 00 00 00 00       	mov    $0x0,%edx
+  800928:	b8 11 00 00 00       	mov    $0x11,%eax
+  80092d:	89 d1                	mov    %edx,%ecx
+  80092f:	89 d3                	mov    %edx,%ebx
+  800931:	89 d7                	mov    %edx,%edi
+  800933:	89 d6                	mov    %edx,%esi
+  800935:	55                   	push   %ebp
+  800936:	68 3f 09 80 00       	push   $0x80093f
+  80093b:	89 e5                	mov    %esp,%ebp
+  80093d:	0f 34                	sysenter
+  80093f:	83 c4 04             	add    $0x4,%esp
+  800942:	5d                   	pop    %ebp
+  800943:	eb c4                	jmp    800909 <sys_ring_enter+0x2c>
+
+00800945 <sys_ipc_try_send>:
+  800945:	55                   	push   %ebp
+  800946:	89 e5                	mov    %esp,%ebp
+  800948:	57                   	push   %edi
+  800949:	56                   	push   %esi
+  80094a:	53                   	push   %ebx
+  80094b:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800952:	78 26                	js     80097a <sys_ipc_try_send+0x35>
+  800954:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80095b:	75 32                	jne    80098f <sys_ipc_try_send+0x4a>
+  80095d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800962:	be 00 00 00 00       	mov    $0x0,%esi
+  800967:	8b 55 08             	mov    0x8(%ebp),%edx
+  80096a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80096d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800970:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800973:	cd 30                	int    $0x30
+  800975:	5b                   	pop    %ebx
+  800976:	5e                   	pop    %esi
+  800977:	5f                   	pop    %edi
+  800978:	5d                   	pop    %ebp
+  800979:	c3                   	ret
+  80097a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80097f:	0f a2                	cpuid
+  800981:	c1 ea 0b             	shr    $0xb,%edx
+  800984:	83 e2 01             	and    $0x1,%edx
+  800987:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80098d:	eb c5                	jmp    800954 <sys_ipc_try_send+0xf>
+  80098f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800992:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800995:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80099a:	be 00 00 00 00       	mov    $0x0,%esi
+  80099f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009a2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8009a5:	55                   	push   %ebp
+  8009a6:	68 af 09 80 00       	push   $0x8009af
+  8009ab:	89 e5                	mov    %esp,%ebp
+  8009ad:	0f 34                	sysenter
+  8009af:	83 c4 04             	add    $0x4,%esp
+  8009b2:	5d                   	pop    %ebp
+  8009b3:	eb c0                	jmp    800975 <sys_ipc_try_send+0x30>
+
+008009b5 <sys_ipc_recv>:
+  8009b5:	55                   	push   %ebp
+  8009b6:	89 e5                	mov    %esp,%ebp
+  8009b8:	57                   	push   %edi
+  8009b9:	56                   	push   %esi
+  8009ba:	53                   	push   %ebx
+  8009bb:	83 ec 0c             	sub    $0xc,%esp
+  8009be:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8009c5:	78 2a                	js     8009f1 <sys_ipc_recv+0x3c>
+  8009c7:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8009ce:	75 36                	jne    800a06 <sys_ipc_recv+0x51>
+  8009d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009dd:	89 cb                	mov    %ecx,%ebx
+  8009df:	89 cf                	mov    %ecx,%edi
+  8009e1:	89 ce                	mov    %ecx,%esi
+  8009e3:	cd 30                	int    $0x30
+  8009e5:	85 c0                	test   %eax,%eax
+  8009e7:	7f 40                	jg     800a29 <sys_ipc_recv+0x74>
+  8009e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009ec:	5b                   	pop    %ebx
+  8009ed:	5e                   	pop    %esi
+  8009ee:	5f                   	pop    %edi
+  8009ef:	5d                   	pop    %ebp
+  8009f0:	c3                   	ret
+  8009f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8009f6:	0f a2                	cpuid
+  8009f8:	c1 ea 0b             	shr    $0xb,%edx
+  8009fb:	83 e2 01             	and    $0x1,%edx
+  8009fe:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800a04:	eb c1                	jmp    8009c7 <sys_ipc_recv+0x12>
+  800a06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a09:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a0e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800a13:	89 cb                	mov    %ecx,%ebx
+  800a15:	89 cf                	mov    %ecx,%edi
+  800a17:	89 ce                	mov    %ecx,%esi
+  800a19:	55                   	push   %ebp
+  800a1a:	68 23 0a 80 00       	push   $0x800a23
+  800a1f:	89 e5                	mov    %esp,%ebp
+  800a21:	0f 34                	sysenter
+  800a23:	83 c4 04             	add    $0x4,%esp
+  800a26:	5d                   	pop    %ebp
+  800a27:	eb bc                	jmp    8009e5 <sys_ipc_recv+0x30>
+  800a29:	83 ec 0c             	sub    $0xc,%esp
+  800a2c:	50                   	push   %eax
+  800a2d:	6a 0c                	push   $0xc
+  800a2f:	68 aa 19 80 00       	push   $0x8019aa
+  800a34:	6a 49                	push   $0x49
+  800a36:	68 c7 19 80 00       	push   $0x8019c7
+  800a3b:	e8 90 01 00 00       	call   800bd0 <_panic>
+
+00800a40 <uinfo_envid>:
+  800a40:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  800a45:	c3                   	ret
+
+00800a46 <uinfo_cpunum>:
+  800a46:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  800a4b:	c3                   	ret
+
+00800a4c <uinfo_ticks>:
+  800a4c:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  800a51:	c3                   	ret
+
+00800a52 <uinfo_nsec>:
+  800a52:	55                   	push   %ebp
+  800a53:	89 e5                	mov    %esp,%ebp
+  800a55:	57                   	push   %edi
+  800a56:	56                   	push   %esi
+  800a57:	53                   	push   %ebx
+  800a58:	83 ec 1c             	sub    $0x1c,%esp
+  800a5b:	0f 31                	rdtsc
+  800a5d:	89 c6                	mov    %eax,%esi
+  800a5f:	89 d7                	mov    %edx,%edi
+  800a61:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  800a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a71:	85 c9                	test   %ecx,%ecx
+  800a73:	74 5c                	je     800ad1 <uinfo_nsec+0x7f>
+  800a75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a7a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800a7d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800a80:	52                   	push   %edx
+  800a81:	51                   	push   %ecx
+  800a82:	57                   	push   %edi
+  800a83:	56                   	push   %esi
+  800a84:	e8 63 0d 00 00       	call   8017ec <__umoddi3>
+  800a89:	83 c4 10             	add    $0x10,%esp
+  800a8c:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800a92:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  800a97:	f7 e3                	mul    %ebx
+  800a99:	01 ca                	add    %ecx,%edx
+  800a9b:	ff 75 e4             	push   -0x1c(%ebp)
+  800a9e:	ff 75 e0             	push   -0x20(%ebp)
+  800aa1:	52                   	push   %edx
+  800aa2:	50                   	push   %eax
+  800aa3:	e8 6c 0c 00 00       	call   801714 <__udivdi3>
+  800aa8:	83 c4 10             	add    $0x10,%esp
+  800aab:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800aae:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ab1:	ff 75 e4             	push   -0x1c(%ebp)
+  800ab4:	ff 75 e0             	push   -0x20(%ebp)
+  800ab7:	57                   	push   %edi
+  800ab8:	56                   	push   %esi
+  800ab9:	e8 56 0c 00 00       	call   801714 <__udivdi3>
+  800abe:	83 c4 10             	add    $0x10,%esp
+  800ac1:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800ac7:	f7 e3                	mul    %ebx
+  800ac9:	01 ca                	add    %ecx,%edx
+  800acb:	03 45 d8             	add    -0x28(%ebp),%eax
+  800ace:	13 55 dc             	adc    -0x24(%ebp),%edx
+  800ad1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ad4:	5b                   	pop    %ebx
+  800ad5:	5e                   	pop    %esi
+  800ad6:	5f                   	pop    %edi
+  800ad7:	5d                   	pop    %ebp
+  800ad8:	c3                   	ret
+
+00800ad9 <bflush>:
+  800ad9:	a1 40 20 80 00       	mov    0x802040,%eax
+  800ade:	85 c0                	test   %eax,%eax
+  800ae0:	75 01                	jne    800ae3 <bflush+0xa>
+  800ae2:	c3                   	ret
+  800ae3:	55                   	push   %ebp
+  800ae4:	89 e5                	mov    %esp,%ebp
+  800ae6:	83 ec 10             	sub    $0x10,%esp
+  800ae9:	50                   	push   %eax
+  800aea:	68 44 20 80 00       	push   $0x802044
+  800aef:	e8 d4 f5 ff ff       	call   8000c8 <sys_cputs>
+  800af4:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  800afb:	00 00 00 
+  800afe:	83 c4 10             	add    $0x10,%esp
+  800b01:	c9                   	leave
+  800b02:	c3                   	ret
+
+00800b03 <bputch>:
+  800b03:	55                   	push   %ebp
+  800b04:	89 e5                	mov    %esp,%ebp
+  800b06:	53                   	push   %ebx
+  800b07:	83 ec 04             	sub    $0x4,%esp
+  800b0a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b0d:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  800b13:	8d 42 01             	lea    0x1(%edx),%eax
+  800b16:	a3 40 20 80 00       	mov    %eax,0x802040
+  800b1b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b1e:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  800b24:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b29:	77 08                	ja     800b33 <bputch+0x30>
+  800b2b:	83 03 01             	addl   $0x1,(%ebx)
+  800b2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b31:	c9                   	leave
+  800b32:	c3                   	ret
+  800b33:	e8 a1 ff ff ff       	call   800ad9 <bflush>
+  800b38:	eb f1                	jmp    800b2b <bputch+0x28>
+
+00800b3a <vbprintf>:
+  800b3a:	55                   	push   %ebp
+  800b3b:	89 e5                	mov    %esp,%ebp
+  800b3d:	83 ec 18             	sub    $0x18,%esp
+  800b40:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800b47:	ff 75 0c             	push   0xc(%ebp)
+  800b4a:	ff 75 08             	push   0x8(%ebp)
+  800b4d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b50:	50                   	push   %eax
+  800b51:	68 03 0b 80 00       	push   $0x800b03
+  800b56:	e8 4c 02 00 00       	call   800da7 <vprintfmt>
+  800b5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b5e:	c9                   	leave
+  800b5f:	c3                   	ret
+
+00800b60 <bprintf>:
+  800b60:	55                   	push   %ebp
+  800b61:	89 e5                	mov    %esp,%ebp
+  800b63:	83 ec 10             	sub    $0x10,%esp
+  800b66:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800b69:	50                   	push   %eax
+  800b6a:	ff 75 08             	push   0x8(%ebp)
+  800b6d:	e8 c8 ff ff ff       	call   800b3a <vbprintf>
+  800b72:	c9                   	leave
+  800b73:	c3                   	ret
+
+00800b74 <bwrite>:
+  800b74:	55                   	push   %ebp
+  800b75:	89 e5                	mov    %esp,%ebp
+  800b77:	53                   	push   %ebx
+  800b78:	83 ec 04             	sub    $0x4,%esp
+  800b7b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b7e:	89 d8                	mov    %ebx,%eax
+  800b80:	03 05 40 20 80 00    	add    0x802040,%eax
+  800b86:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b8b:	76 0d                	jbe    800b9a <bwrite+0x26>
+  800b8d:	e8 47 ff ff ff       	call   800ad9 <bflush>
+  800b92:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  800b98:	77 25                	ja     800bbf <bwrite+0x4b>
+  800b9a:	83 ec 04             	sub    $0x4,%esp
+  800b9d:	53                   	push   %ebx
+  800b9e:	ff 75 08             	push   0x8(%ebp)
+  800ba1:	a1 40 20 80 00       	mov    0x802040,%eax
+  800ba6:	05 44 20 80 00       	add    $0x802044,%eax
+  800bab:	50                   	push   %eax
+  800bac:	e8 61 09 00 00       	call   801512 <memcpy>
+  800bb1:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  800bb7:	83 c4 10             	add    $0x10,%esp
+  800bba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bbd:	c9                   	leave
+  800bbe:	c3                   	ret
+  800bbf:	83 ec 08             	sub    $0x8,%esp
+  800bc2:	53                   	push   %ebx
+  800bc3:	ff 75 08             	push   0x8(%ebp)
+  800bc6:	e8 fd f4 ff ff       	call   8000c8 <sys_cputs>
+  800bcb:	83 c4 10             	add    $0x10,%esp
+  800bce:	eb ea                	jmp    800bba <bwrite+0x46>
+
+00800bd0 <_panic>:
+  800bd0:	55                   	push   %ebp
+  800bd1:	89 e5                	mov    %esp,%ebp
+  800bd3:	56                   	push   %esi
+  800bd4:	53                   	push   %ebx
+  800bd5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800bd8:	e8 fc fe ff ff       	call   800ad9 <bflush>
+  800bdd:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  800be3:	e8 39 f6 ff ff       	call   800221 <sys_getenvid>
+  800be8:	83 ec 0c             	sub    $0xc,%esp
+  800beb:	ff 75 0c             	push   0xc(%ebp)
+  800bee:	ff 75 08             	push   0x8(%ebp)
+  800bf1:	56                   	push   %esi
+  800bf2:	50                   	push   %eax
+  800bf3:	68 d8 19 80 00       	push   $0x8019d8
+  800bf8:	e8 b3 00 00 00       	call   800cb0 <cprintf>
+  800bfd:	83 c4 18             	add    $0x18,%esp
+  800c00:	53                   	push   %ebx
+  800c01:	ff 75 10             	push   0x10(%ebp)
+  800c04:	e8 56 00 00 00       	call   800c5f <vcprintf>
+  800c09:	c7 04 24 fb 19 80 00 	movl   $0x8019fb,(%esp)
+  800c10:	e8 9b 00 00 00       	call   800cb0 <cprintf>
+  800c15:	83 c4 10             	add    $0x10,%esp
+  800c18:	cc                   	int3
+  800c19:	eb fd                	jmp    800c18 <_panic+0x48>
+
+00800c1b <putch>:
+  800c1b:	55                   	push   %ebp
+  800c1c:	89 e5                	mov    %esp,%ebp
+  800c1e:	53                   	push   %ebx
+  800c1f:	83 ec 04             	sub    $0x4,%esp
+  800c22:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c25:	8b 13                	mov    (%ebx),%edx
+  800c27:	8d 42 01             	lea    0x1(%edx),%eax
+  800c2a:	89 03                	mov    %eax,(%ebx)
+  800c2c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c2f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800c33:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800c38:	74 09                	je     800c43 <putch+0x28>
+  800c3a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800c3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c41:	c9                   	leave
+  800c42:	c3                   	ret
+  800c43:	83 ec 08             	sub    $0x8,%esp
+  800c46:	68 ff 00 00 00       	push   $0xff
+  800c4b:	8d 43 08             	lea    0x8(%ebx),%eax
+  800c4e:	50                   	push   %eax
+  800c4f:	e8 74 f4 ff ff       	call   8000c8 <sys_cputs>
+  800c54:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800c5a:	83 c4 10             	add    $0x10,%esp
+  800c5d:	eb db                	jmp    800c3a <putch+0x1f>
+
+00800c5f <vcprintf>:
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800c68:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800c6f:	00 00 00 
+  800c72:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800c79:	00 00 00 
+  800c7c:	ff 75 0c             	push   0xc(%ebp)
+  800c7f:	ff 75 08             	push   0x8(%ebp)
+  800c82:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800c88:	50                   	push   %eax
+  800c89:	68 1b 0c 80 00       	push   $0x800c1b
+  800c8e:	e8 14 01 00 00       	call   800da7 <vprintfmt>
+  800c93:	83 c4 08             	add    $0x8,%esp
+  800c96:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800c9c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800ca2:	50                   	push   %eax
+  800ca3:	e8 20 f4 ff ff       	call   8000c8 <sys_cputs>
+  800ca8:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800cae:	c9                   	leave
+  800caf:	c3                   	ret
+
+00800cb0 <cprintf>:
+  800cb0:	55                   	push   %ebp
+  800cb1:	89 e5                	mov    %esp,%ebp
+  800cb3:	83 ec 10             	sub    $0x10,%esp
+  800cb6:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800cb9:	50                   	push   %eax
+  800cba:	ff 75 08             	push   0x8(%ebp)
+  800cbd:	e8 9d ff ff ff       	call   800c5f <vcprintf>
+  800cc2:	c9                   	leave
+  800cc3:	c3                   	ret
+
+00800cc4 <printnum>:
+  800cc4:	55                   	push   %ebp
+  800cc5:	89 e5                	mov    %esp,%ebp
+  800cc7:	57                   	push   %edi
+  800cc8:	56                   	push   %esi
+  800cc9:	53                   	push   %ebx
+  800cca:	83 ec 1c             	sub    $0x1c,%esp
+  800ccd:	89 c7                	mov    %eax,%edi
+  800ccf:	89 d6                	mov    %edx,%esi
+  800cd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cd7:	89 d1                	mov    %edx,%ecx
+  800cd9:	89 c2                	mov    %eax,%edx
+  800cdb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cde:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ce1:	8b 45 10             	mov    0x10(%ebp),%eax
+  800ce4:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800ce7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800cea:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800cf1:	39 c2                	cmp    %eax,%edx
+  800cf3:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800cf6:	72 3e                	jb     800d36 <printnum+0x72>
+  800cf8:	83 ec 0c             	sub    $0xc,%esp
+  800cfb:	ff 75 18             	push   0x18(%ebp)
+  800cfe:	83 eb 01             	sub    $0x1,%ebx
+  800d01:	53                   	push   %ebx
+  800d02:	50                   	push   %eax
+  800d03:	83 ec 08             	sub    $0x8,%esp
+  800d06:	ff 75 e4             	push   -0x1c(%ebp)
+  800d09:	ff 75 e0             	push   -0x20(%ebp)
+  800d0c:	ff 75 dc             	push   -0x24(%ebp)
+  800d0f:	ff 75 d8             	push   -0x28(%ebp)
+  800d12:	e8 fd 09 00 00       	call   801714 <__udivdi3>
+  800d17:	83 c4 18             	add    $0x18,%esp
+  800d1a:	52                   	push   %edx
+  800d1b:	50                   	push   %eax
+  800d1c:	89 f2                	mov    %esi,%edx
+  800d1e:	89 f8                	mov    %edi,%eax
+  800d20:	e8 9f ff ff ff       	call   800cc4 <printnum>
+  800d25:	83 c4 20             	add    $0x20,%esp
+  800d28:	eb 13                	jmp    800d3d <printnum+0x79>
+  800d2a:	83 ec 08             	sub    $0x8,%esp
+  800d2d:	56                   	push   %esi
+  800d2e:	ff 75 18             	push   0x18(%ebp)
+  800d31:	ff d7                	call   *%edi
+  800d33:	83 c4 10             	add    $0x10,%esp
+  800d36:	83 eb 01             	sub    $0x1,%ebx
+  800d39:	85 db                	test   %ebx,%ebx
+  800d3b:	7f ed                	jg     800d2a <printnum+0x66>
+  800d3d:	83 ec 08             	sub    $0x8,%esp
+  800d40:	56                   	push   %esi
+  800d41:	83 ec 04             	sub    $0x4,%esp
+  800d44:	ff 75 e4             	push   -0x1c(%ebp)
+  800d47:	ff 75 e0             	push   -0x20(%ebp)
+  800d4a:	ff 75 dc             	push   -0x24(%ebp)
+  800d4d:	ff 75 d8             	push   -0x28(%ebp)
+  800d50:	e8 97 0a 00 00       	call   8017ec <__umoddi3>
+  800d55:	83 c4 14             	add    $0x14,%esp
+  800d58:	0f be 80 fd 19 80 00 	movsbl 0x8019fd(%eax),%eax
+  800d5f:	50                   	push   %eax
+  800d60:	ff d7                	call   *%edi
+  800d62:	83 c4 10             	add    $0x10,%esp
+  800d65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d68:	5b                   	pop    %ebx
+  800d69:	5e                   	pop    %esi
+  800d6a:	5f                   	pop    %edi
+  800d6b:	5d                   	pop    %ebp
+  800d6c:	c3                   	ret
+
+00800d6d <sprintputch>:
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d73:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800d77:	8b 10                	mov    (%eax),%edx
+  800d79:	3b 50 04             	cmp    0x4(%eax),%edx
+  800d7c:	73 0a                	jae    800d88 <sprintputch+0x1b>
+  800d7e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800d81:	89 08                	mov    %ecx,(%eax)
+  800d83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d86:	88 02                	mov    %al,(%edx)
+  800d88:	5d                   	pop    %ebp
+  800d89:	c3                   	ret
+
+00800d8a <printfmt>:
+  800d8a:	55                   	push   %ebp
+  800d8b:	89 e5                	mov    %esp,%ebp
+  800d8d:	83 ec 08             	sub    $0x8,%esp
+  800d90:	8d 45 14             	lea    0x14(%ebp),%eax
+  800d93:	50                   	push   %eax
+  800d94:	ff 75 10             	push   0x10(%ebp)
+  800d97:	ff 75 0c             	push   0xc(%ebp)
+  800d9a:	ff 75 08             	push   0x8(%ebp)
+  800d9d:	e8 05 00 00 00       	call   800da7 <vprintfmt>
+  800da2:	83 c4 10             	add    $0x10,%esp
+  800da5:	c9                   	leave
+  800da6:	c3                   	ret
+
+00800da7 <vprintfmt>:
+  800da7:	55                   	push   %ebp
+  800da8:	89 e5                	mov    %esp,%ebp
+  800daa:	57                   	push   %edi
+  800dab:	56                   	push   %esi
+  800dac:	53                   	push   %ebx
+  800dad:	83 ec 2c             	sub    $0x2c,%esp
+  800db0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800db3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800db6:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800db9:	eb 0a                	jmp    800dc5 <vprintfmt+0x1e>
+  800dbb:	83 ec 08             	sub    $0x8,%esp
+  800dbe:	53                   	push   %ebx
+  800dbf:	50                   	push   %eax
+  800dc0:	ff d6                	call   *%esi
+  800dc2:	83 c4 10             	add    $0x10,%esp
+  800dc5:	83 c7 01             	add    $0x1,%edi
+  800dc8:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800dcc:	83 f8 25             	cmp    $0x25,%eax
+  800dcf:	74 0c                	je     800ddd <vprintfmt+0x36>
+  800dd1:	85 c0                	test   %eax,%eax
+  800dd3:	75 e6                	jne    800dbb <vprintfmt+0x14>
+  800dd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd8:	5b                   	pop    %ebx
+  800dd9:	5e                   	pop    %esi
+  800dda:	5f                   	pop    %edi
+  800ddb:	5d                   	pop    %ebp
+  800ddc:	c3                   	ret
+  800ddd:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800de1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800de8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800def:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800df6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dfb:	8d 47 01             	lea    0x1(%edi),%eax
+  800dfe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800e01:	0f b6 17             	movzbl (%edi),%edx
+  800e04:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800e07:	3c 55                	cmp    $0x55,%al
+  800e09:	0f 87 cf 03 00 00    	ja     8011de <vprintfmt+0x437>
+  800e0f:	0f b6 c0             	movzbl %al,%eax
+  800e12:	ff 24 85 c0 1a 80 00 	jmp    *0x801ac0(,%eax,4)
+  800e19:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e1c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800e20:	eb d9                	jmp    800dfb <vprintfmt+0x54>
+  800e22:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e25:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800e29:	eb d0                	jmp    800dfb <vprintfmt+0x54>
+  800e2b:	0f b6 d2             	movzbl %dl,%edx
+  800e2e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e36:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e39:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800e3c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800e40:	0f be 17             	movsbl (%edi),%edx
+  800e43:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800e46:	83 f9 09             	cmp    $0x9,%ecx
+  800e49:	77 55                	ja     800ea0 <vprintfmt+0xf9>
+  800e4b:	83 c7 01             	add    $0x1,%edi
+  800e4e:	eb e9                	jmp    800e39 <vprintfmt+0x92>
+  800e50:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e53:	8b 00                	mov    (%eax),%eax
+  800e55:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e58:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e5b:	8d 40 04             	lea    0x4(%eax),%eax
+  800e5e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e61:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e64:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800e68:	79 91                	jns    800dfb <vprintfmt+0x54>
+  800e6a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800e6d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e70:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800e77:	eb 82                	jmp    800dfb <vprintfmt+0x54>
+  800e79:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e7c:	85 d2                	test   %edx,%edx
+  800e7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e83:	0f 49 c2             	cmovns %edx,%eax
+  800e86:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e89:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e8c:	e9 6a ff ff ff       	jmp    800dfb <vprintfmt+0x54>
+  800e91:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e94:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800e9b:	e9 5b ff ff ff       	jmp    800dfb <vprintfmt+0x54>
+  800ea0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800ea3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800ea6:	eb bc                	jmp    800e64 <vprintfmt+0xbd>
+  800ea8:	83 c1 01             	add    $0x1,%ecx
+  800eab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800eae:	e9 48 ff ff ff       	jmp    800dfb <vprintfmt+0x54>
+  800eb3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800eb6:	8d 78 04             	lea    0x4(%eax),%edi
+  800eb9:	83 ec 08             	sub    $0x8,%esp
+  800ebc:	53                   	push   %ebx
+  800ebd:	ff 30                	push   (%eax)
+  800ebf:	ff d6                	call   *%esi
+  800ec1:	83 c4 10             	add    $0x10,%esp
+  800ec4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800ec7:	e9 b1 02 00 00       	jmp    80117d <vprintfmt+0x3d6>
+  800ecc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ecf:	8d 78 04             	lea    0x4(%eax),%edi
+  800ed2:	8b 10                	mov    (%eax),%edx
+  800ed4:	89 d0                	mov    %edx,%eax
+  800ed6:	f7 d8                	neg    %eax
+  800ed8:	0f 48 c2             	cmovs  %edx,%eax
+  800edb:	83 f8 08             	cmp    $0x8,%eax
+  800ede:	7f 23                	jg     800f03 <vprintfmt+0x15c>
+  800ee0:	8b 14 85 20 1c 80 00 	mov    0x801c20(,%eax,4),%edx
+  800ee7:	85 d2                	test   %edx,%edx
+  800ee9:	74 18                	je     800f03 <vprintfmt+0x15c>
+  800eeb:	52                   	push   %edx
+  800eec:	68 1e 1a 80 00       	push   $0x801a1e
+  800ef1:	53                   	push   %ebx
+  800ef2:	56                   	push   %esi
+  800ef3:	e8 92 fe ff ff       	call   800d8a <printfmt>
+  800ef8:	83 c4 10             	add    $0x10,%esp
+  800efb:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800efe:	e9 7a 02 00 00       	jmp    80117d <vprintfmt+0x3d6>
+  800f03:	50                   	push   %eax
+  800f04:	68 15 1a 80 00       	push   $0x801a15
+  800f09:	53                   	push   %ebx
+  800f0a:	56                   	push   %esi
+  800f0b:	e8 7a fe ff ff       	call   800d8a <printfmt>
+  800f10:	83 c4 10             	add    $0x10,%esp
+  800f13:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800f16:	e9 62 02 00 00       	jmp    80117d <vprintfmt+0x3d6>
+  800f1b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f1e:	83 c0 04             	add    $0x4,%eax
+  800f21:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800f24:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f27:	8b 08                	mov    (%eax),%ecx
+  800f29:	85 c9                	test   %ecx,%ecx
+  800f2b:	b8 0e 1a 80 00       	mov    $0x801a0e,%eax
+  800f30:	0f 45 c1             	cmovne %ecx,%eax
+  800f33:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800f36:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800f3a:	7e 06                	jle    800f42 <vprintfmt+0x19b>
+  800f3c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800f40:	75 0b                	jne    800f4d <vprintfmt+0x1a6>
+  800f42:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800f45:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800f48:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f4b:	eb 5c                	jmp    800fa9 <vprintfmt+0x202>
+  800f4d:	83 ec 08             	sub    $0x8,%esp
+  800f50:	ff 75 d0             	push   -0x30(%ebp)
+  800f53:	ff 75 cc             	push   -0x34(%ebp)
+  800f56:	e8 87 03 00 00       	call   8012e2 <strnlen>
+  800f5b:	89 c2                	mov    %eax,%edx
+  800f5d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f60:	29 d0                	sub    %edx,%eax
+  800f62:	83 c4 10             	add    $0x10,%esp
+  800f65:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800f69:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f6c:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f6f:	89 c6                	mov    %eax,%esi
+  800f71:	eb 0e                	jmp    800f81 <vprintfmt+0x1da>
+  800f73:	83 ec 08             	sub    $0x8,%esp
+  800f76:	53                   	push   %ebx
+  800f77:	57                   	push   %edi
+  800f78:	ff 55 08             	call   *0x8(%ebp)
+  800f7b:	83 ee 01             	sub    $0x1,%esi
+  800f7e:	83 c4 10             	add    $0x10,%esp
+  800f81:	85 f6                	test   %esi,%esi
+  800f83:	7f ee                	jg     800f73 <vprintfmt+0x1cc>
+  800f85:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f88:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f8b:	85 c0                	test   %eax,%eax
+  800f8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f92:	0f 49 d0             	cmovns %eax,%edx
+  800f95:	29 d0                	sub    %edx,%eax
+  800f97:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f9a:	eb a6                	jmp    800f42 <vprintfmt+0x19b>
+  800f9c:	83 ec 08             	sub    $0x8,%esp
+  800f9f:	53                   	push   %ebx
+  800fa0:	52                   	push   %edx
+  800fa1:	ff 55 08             	call   *0x8(%ebp)
+  800fa4:	83 c4 10             	add    $0x10,%esp
+  800fa7:	89 f1                	mov    %esi,%ecx
+  800fa9:	8d 71 01             	lea    0x1(%ecx),%esi
+  800fac:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800fb0:	0f be d0             	movsbl %al,%edx
+  800fb3:	85 d2                	test   %edx,%edx
+  800fb5:	74 28                	je     800fdf <vprintfmt+0x238>
+  800fb7:	85 ff                	test   %edi,%edi
+  800fb9:	78 05                	js     800fc0 <vprintfmt+0x219>
+  800fbb:	83 ef 01             	sub    $0x1,%edi
+  800fbe:	78 30                	js     800ff0 <vprintfmt+0x249>
+  800fc0:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800fc4:	74 d6                	je     800f9c <vprintfmt+0x1f5>
+  800fc6:	0f be c0             	movsbl %al,%eax
+  800fc9:	83 e8 20             	sub    $0x20,%eax
+  800fcc:	83 f8 5e             	cmp    $0x5e,%eax
+  800fcf:	76 cb                	jbe    800f9c <vprintfmt+0x1f5>
+  800fd1:	83 ec 08             	sub    $0x8,%esp
+  800fd4:	53                   	push   %ebx
+  800fd5:	6a 3f                	push   $0x3f
+  800fd7:	ff 55 08             	call   *0x8(%ebp)
+  800fda:	83 c4 10             	add    $0x10,%esp
+  800fdd:	eb c8                	jmp    800fa7 <vprintfmt+0x200>
+  800fdf:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fe2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800fe5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800fe8:	01 d0                	add    %edx,%eax
+  800fea:	29 c8                	sub    %ecx,%eax
+  800fec:	89 c7                	mov    %eax,%edi
+  800fee:	eb 13                	jmp    801003 <vprintfmt+0x25c>
+  800ff0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ff3:	eb ed                	jmp    800fe2 <vprintfmt+0x23b>
+  800ff5:	83 ec 08             	sub    $0x8,%esp
+  800ff8:	53                   	push   %ebx
+  800ff9:	6a 20                	push   $0x20
+  800ffb:	ff d6                	call   *%esi
+  800ffd:	83 ef 01             	sub    $0x1,%edi
+  801000:	83 c4 10             	add    $0x10,%esp
+  801003:	85 ff                	test   %edi,%edi
+  801005:	7f ee                	jg     800ff5 <vprintfmt+0x24e>
+  801007:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80100a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80100d:	e9 6b 01 00 00       	jmp    80117d <vprintfmt+0x3d6>
+  801012:	83 f9 01             	cmp    $0x1,%ecx
+  801015:	7f 1f                	jg     801036 <vprintfmt+0x28f>
+  801017:	85 c9                	test   %ecx,%ecx
+  801019:	74 67                	je     801082 <vprintfmt+0x2db>
+  80101b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80101e:	8b 00                	mov    (%eax),%eax
+  801020:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801023:	89 c1                	mov    %eax,%ecx
+  801025:	c1 f9 1f             	sar    $0x1f,%ecx
+  801028:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80102b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80102e:	8d 40 04             	lea    0x4(%eax),%eax
+  801031:	89 45 14             	mov    %eax,0x14(%ebp)
+  801034:	eb 17                	jmp    80104d <vprintfmt+0x2a6>
+  801036:	8b 45 14             	mov    0x14(%ebp),%eax
+  801039:	8b 50 04             	mov    0x4(%eax),%edx
+  80103c:	8b 00                	mov    (%eax),%eax
+  80103e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801041:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801044:	8b 45 14             	mov    0x14(%ebp),%eax
+  801047:	8d 40 08             	lea    0x8(%eax),%eax
+  80104a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80104d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801050:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801053:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801058:	85 c9                	test   %ecx,%ecx
+  80105a:	0f 89 03 01 00 00    	jns    801163 <vprintfmt+0x3bc>
+  801060:	83 ec 08             	sub    $0x8,%esp
+  801063:	53                   	push   %ebx
+  801064:	6a 2d                	push   $0x2d
+  801066:	ff d6                	call   *%esi
+  801068:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80106b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80106e:	f7 da                	neg    %edx
+  801070:	83 d1 00             	adc    $0x0,%ecx
+  801073:	f7 d9                	neg    %ecx
+  801075:	83 c4 10             	add    $0x10,%esp
+  801078:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80107d:	e9 e1 00 00 00       	jmp    801163 <vprintfmt+0x3bc>
+  801082:	8b 45 14             	mov    0x14(%ebp),%eax
+  801085:	8b 00                	mov    (%eax),%eax
+  801087:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80108a:	89 c1                	mov    %eax,%ecx
+  80108c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80108f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801092:	8b 45 14             	mov    0x14(%ebp),%eax
+  801095:	8d 40 04             	lea    0x4(%eax),%eax
+  801098:	89 45 14             	mov    %eax,0x14(%ebp)
+  80109b:	eb b0                	jmp    80104d <vprintfmt+0x2a6>
+  80109d:	83 f9 01             	cmp    $0x1,%ecx
+  8010a0:	7f 1e                	jg     8010c0 <vprintfmt+0x319>
+  8010a2:	85 c9                	test   %ecx,%ecx
+  8010a4:	74 32                	je     8010d8 <vprintfmt+0x331>
+  8010a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010a9:	8b 10                	mov    (%eax),%edx
+  8010ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8010b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010b6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010bb:	e9 a3 00 00 00       	jmp    801163 <vprintfmt+0x3bc>
+  8010c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010c3:	8b 10                	mov    (%eax),%edx
+  8010c5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8010c8:	8d 40 08             	lea    0x8(%eax),%eax
+  8010cb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010ce:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010d3:	e9 8b 00 00 00       	jmp    801163 <vprintfmt+0x3bc>
+  8010d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010db:	8b 10                	mov    (%eax),%edx
+  8010dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8010e5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010e8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010ed:	eb 74                	jmp    801163 <vprintfmt+0x3bc>
+  8010ef:	83 f9 01             	cmp    $0x1,%ecx
+  8010f2:	7f 1b                	jg     80110f <vprintfmt+0x368>
+  8010f4:	85 c9                	test   %ecx,%ecx
+  8010f6:	74 2c                	je     801124 <vprintfmt+0x37d>
+  8010f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010fb:	8b 10                	mov    (%eax),%edx
+  8010fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801102:	8d 40 04             	lea    0x4(%eax),%eax
+  801105:	89 45 14             	mov    %eax,0x14(%ebp)
+  801108:	bf 08 00 00 00       	mov    $0x8,%edi
+  80110d:	eb 54                	jmp    801163 <vprintfmt+0x3bc>
+  80110f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801112:	8b 10                	mov    (%eax),%edx
+  801114:	8b 48 04             	mov    0x4(%eax),%ecx
+  801117:	8d 40 08             	lea    0x8(%eax),%eax
+  80111a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80111d:	bf 08 00 00 00       	mov    $0x8,%edi
+  801122:	eb 3f                	jmp    801163 <vprintfmt+0x3bc>
+  801124:	8b 45 14             	mov    0x14(%ebp),%eax
+  801127:	8b 10                	mov    (%eax),%edx
+  801129:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80112e:	8d 40 04             	lea    0x4(%eax),%eax
+  801131:	89 45 14             	mov    %eax,0x14(%ebp)
+  801134:	bf 08 00 00 00       	mov    $0x8,%edi
+  801139:	eb 28                	jmp    801163 <vprintfmt+0x3bc>
+  80113b:	83 ec 08             	sub    $0x8,%esp
+  80113e:	53                   	push   %ebx
+  80113f:	6a 30                	push   $0x30
+  801141:	ff d6                	call   *%esi
+  801143:	83 c4 08             	add    $0x8,%esp
+  801146:	53                   	push   %ebx
+  801147:	6a 78                	push   $0x78
+  801149:	ff d6                	call   *%esi
+  80114b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80114e:	8b 10                	mov    (%eax),%edx
+  801150:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801155:	83 c4 10             	add    $0x10,%esp
+  801158:	8d 40 04             	lea    0x4(%eax),%eax
+  80115b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80115e:	bf 10 00 00 00       	mov    $0x10,%edi
+  801163:	83 ec 0c             	sub    $0xc,%esp
+  801166:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80116a:	50                   	push   %eax
+  80116b:	ff 75 e0             	push   -0x20(%ebp)
+  80116e:	57                   	push   %edi
+  80116f:	51                   	push   %ecx
+  801170:	52                   	push   %edx
+  801171:	89 da                	mov    %ebx,%edx
+  801173:	89 f0                	mov    %esi,%eax
+  801175:	e8 4a fb ff ff       	call   800cc4 <printnum>
+  80117a:	83 c4 20             	add    $0x20,%esp
+  80117d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801180:	e9 40 fc ff ff       	jmp    800dc5 <vprintfmt+0x1e>
+  801185:	83 f9 01             	cmp    $0x1,%ecx
+  801188:	7f 1b                	jg     8011a5 <vprintfmt+0x3fe>
+  80118a:	85 c9                	test   %ecx,%ecx
+  80118c:	74 2c                	je     8011ba <vprintfmt+0x413>
+  80118e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801191:	8b 10                	mov    (%eax),%edx
+  801193:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801198:	8d 40 04             	lea    0x4(%eax),%eax
+  80119b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80119e:	bf 10 00 00 00       	mov    $0x10,%edi
+  8011a3:	eb be                	jmp    801163 <vprintfmt+0x3bc>
+  8011a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011a8:	8b 10                	mov    (%eax),%edx
+  8011aa:	8b 48 04             	mov    0x4(%eax),%ecx
+  8011ad:	8d 40 08             	lea    0x8(%eax),%eax
+  8011b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8011b3:	bf 10 00 00 00       	mov    $0x10,%edi
+  8011b8:	eb a9                	jmp    801163 <vprintfmt+0x3bc>
+  8011ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011bd:	8b 10                	mov    (%eax),%edx
+  8011bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8011c7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8011ca:	bf 10 00 00 00       	mov    $0x10,%edi
+  8011cf:	eb 92                	jmp    801163 <vprintfmt+0x3bc>
+  8011d1:	83 ec 08             	sub    $0x8,%esp
+  8011d4:	53                   	push   %ebx
+  8011d5:	6a 25                	push   $0x25
+  8011d7:	ff d6                	call   *%esi
+  8011d9:	83 c4 10             	add    $0x10,%esp
+  8011dc:	eb 9f                	jmp    80117d <vprintfmt+0x3d6>
+  8011de:	83 ec 08             	sub    $0x8,%esp
+  8011e1:	53                   	push   %ebx
+  8011e2:	6a 25                	push   $0x25
+  8011e4:	ff d6                	call   *%esi
+  8011e6:	83 c4 10             	add    $0x10,%esp
+  8011e9:	89 f8                	mov    %edi,%eax
+  8011eb:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8011ef:	74 05                	je     8011f6 <vprintfmt+0x44f>
+  8011f1:	83 e8 01             	sub    $0x1,%eax
+  8011f4:	eb f5                	jmp    8011eb <vprintfmt+0x444>
+  8011f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8011f9:	eb 82                	jmp    80117d <vprintfmt+0x3d6>
+
+008011fb <vsnprintf>:
+  8011fb:	55                   	push   %ebp
+  8011fc:	89 e5                	mov    %esp,%ebp
+  8011fe:	83 ec 18             	sub    $0x18,%esp
+  801201:	8b 45 08             	mov    0x8(%ebp),%eax
+  801204:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801207:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80120a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80120e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801211:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801218:	85 c0                	test   %eax,%eax
+  80121a:	74 26                	je     801242 <vsnprintf+0x47>
+  80121c:	85 d2                	test   %edx,%edx
+  80121e:	7e 22                	jle    801242 <vsnprintf+0x47>
+  801220:	ff 75 14             	push   0x14(%ebp)
+  801223:	ff 75 10             	push   0x10(%ebp)
+  801226:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801229:	50                   	push   %eax
+  80122a:	68 6d 0d 80 00       	push   $0x800d6d
+  80122f:	e8 73 fb ff ff       	call   800da7 <vprintfmt>
+  801234:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801237:	c6 00 00             	movb   $0x0,(%eax)
+  80123a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80123d:	83 c4 10             	add    $0x10,%esp
+  801240:	c9                   	leave
+  801241:	c3                   	ret
+  801242:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801247:	eb f7                	jmp    801240 <vsnprintf+0x45>
+
+00801249 <snprintf>:
+  801249:	55                   	push   %ebp
+  80124a:	89 e5                	mov    %esp,%ebp
+  80124c:	83 ec 08             	sub    $0x8,%esp
+  80124f:	8d 45 14             	lea    0x14(%ebp),%eax
+  801252:	50                   	push   %eax
+  801253:	ff 75 10             	push   0x10(%ebp)
+  801256:	ff 75 0c             	push   0xc(%ebp)
+  801259:	ff 75 08             	push   0x8(%ebp)
+  80125c:	e8 9a ff ff ff       	call   8011fb <vsnprintf>
+  801261:	c9                   	leave
+  801262:	c3                   	ret
+
+00801263 <copy_fwd>:
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	57                   	push   %edi
+  801267:	56                   	push   %esi
+  801268:	53                   	push   %ebx
+  801269:	89 c7                	mov    %eax,%edi
+  80126b:	89 d6                	mov    %edx,%esi
+  80126d:	89 c8                	mov    %ecx,%eax
+  80126f:	83 f9 0f             	cmp    $0xf,%ecx
+  801272:	76 1c                	jbe    801290 <copy_fwd+0x2d>
+  801274:	89 f9                	mov    %edi,%ecx
+  801276:	f7 d9                	neg    %ecx
+  801278:	89 cb                	mov    %ecx,%ebx
+  80127a:	83 e3 03             	and    $0x3,%ebx
+  80127d:	29 d8                	sub    %ebx,%eax
+  80127f:	89 c2                	mov    %eax,%edx
+  801281:	c1 ea 02             	shr    $0x2,%edx
+  801284:	83 e0 03             	and    $0x3,%eax
+  801287:	89 d9                	mov    %ebx,%ecx
+  801289:	fc                   	cld
+  80128a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80128c:	89 d1                	mov    %edx,%ecx
+  80128e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801290:	89 c1                	mov    %eax,%ecx
+  801292:	fc                   	cld
+  801293:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  801295:	5b                   	pop    %ebx
+  801296:	5e                   	pop    %esi
+  801297:	5f                   	pop    %edi
+  801298:	5d                   	pop    %ebp
+  801299:	c3                   	ret
+
+0080129a <have_sse2>:
+  80129a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012a1:	78 06                	js     8012a9 <have_sse2+0xf>
+  8012a3:	a1 08 20 80 00       	mov    0x802008,%eax
+  8012a8:	c3                   	ret
+  8012a9:	55                   	push   %ebp
+  8012aa:	89 e5                	mov    %esp,%ebp
+  8012ac:	53                   	push   %ebx
+  8012ad:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012b2:	0f a2                	cpuid
+  8012b4:	c1 ea 1a             	shr    $0x1a,%edx
+  8012b7:	83 e2 01             	and    $0x1,%edx
+  8012ba:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8012c0:	a1 08 20 80 00       	mov    0x802008,%eax
+  8012c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012c8:	c9                   	leave
+  8012c9:	c3                   	ret
+
+008012ca <strlen>:
+  8012ca:	55                   	push   %ebp
+  8012cb:	89 e5                	mov    %esp,%ebp
+  8012cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d5:	eb 03                	jmp    8012da <strlen+0x10>
+  8012d7:	83 c0 01             	add    $0x1,%eax
+  8012da:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8012de:	75 f7                	jne    8012d7 <strlen+0xd>
+  8012e0:	5d                   	pop    %ebp
+  8012e1:	c3                   	ret
+
+008012e2 <strnlen>:
+  8012e2:	55                   	push   %ebp
+  8012e3:	89 e5                	mov    %esp,%ebp
+  8012e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f0:	eb 03                	jmp    8012f5 <strnlen+0x13>
+  8012f2:	83 c0 01             	add    $0x1,%eax
+  8012f5:	39 d0                	cmp    %edx,%eax
+  8012f7:	74 08                	je     801301 <strnlen+0x1f>
+  8012f9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8012fd:	75 f3                	jne    8012f2 <strnlen+0x10>
+  8012ff:	89 c2                	mov    %eax,%edx
+  801301:	89 d0                	mov    %edx,%eax
+  801303:	5d                   	pop    %ebp
+  801304:	c3                   	ret
+
+00801305 <strcpy>:
+  801305:	55                   	push   %ebp
+  801306:	89 e5                	mov    %esp,%ebp
+  801308:	53                   	push   %ebx
+  801309:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80130c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80130f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801314:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801318:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80131b:	83 c0 01             	add    $0x1,%eax
+  80131e:	84 d2                	test   %dl,%dl
+  801320:	75 f2                	jne    801314 <strcpy+0xf>
+  801322:	89 c8                	mov    %ecx,%eax
+  801324:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801327:	c9                   	leave
+  801328:	c3                   	ret
+
+00801329 <strcat>:
+  801329:	55                   	push   %ebp
+  80132a:	89 e5                	mov    %esp,%ebp
+  80132c:	53                   	push   %ebx
+  80132d:	83 ec 10             	sub    $0x10,%esp
+  801330:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801333:	53                   	push   %ebx
+  801334:	e8 91 ff ff ff       	call   8012ca <strlen>
+  801339:	83 c4 08             	add    $0x8,%esp
+  80133c:	ff 75 0c             	push   0xc(%ebp)
+  80133f:	01 d8                	add    %ebx,%eax
+  801341:	50                   	push   %eax
+  801342:	e8 be ff ff ff       	call   801305 <strcpy>
+  801347:	89 d8                	mov    %ebx,%eax
+  801349:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80134c:	c9                   	leave
+  80134d:	c3                   	ret
+
+0080134e <strncpy>:
+  80134e:	55                   	push   %ebp
+  80134f:	89 e5                	mov    %esp,%ebp
+  801351:	56                   	push   %esi
+  801352:	53                   	push   %ebx
+  801353:	8b 75 08             	mov    0x8(%ebp),%esi
+  801356:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801359:	89 f3                	mov    %esi,%ebx
+  80135b:	03 5d 10             	add    0x10(%ebp),%ebx
+  80135e:	89 f0                	mov    %esi,%eax
+  801360:	eb 0f                	jmp    801371 <strncpy+0x23>
+  801362:	83 c0 01             	add    $0x1,%eax
+  801365:	0f b6 0a             	movzbl (%edx),%ecx
+  801368:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80136b:	80 f9 01             	cmp    $0x1,%cl
+  80136e:	83 da ff             	sbb    $0xffffffff,%edx
+  801371:	39 d8                	cmp    %ebx,%eax
+  801373:	75 ed                	jne    801362 <strncpy+0x14>
+  801375:	89 f0                	mov    %esi,%eax
+  801377:	5b                   	pop    %ebx
+  801378:	5e                   	pop    %esi
+  801379:	5d                   	pop    %ebp
+  80137a:	c3                   	ret
+
+0080137b <strlcpy>:
+  80137b:	55                   	push   %ebp
+  80137c:	89 e5                	mov    %esp,%ebp
+  80137e:	56                   	push   %esi
+  80137f:	53                   	push   %ebx
+  801380:	8b 75 08             	mov    0x8(%ebp),%esi
+  801383:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801386:	8b 55 10             	mov    0x10(%ebp),%edx
+  801389:	89 f0                	mov    %esi,%eax
+  80138b:	85 d2                	test   %edx,%edx
+  80138d:	74 21                	je     8013b0 <strlcpy+0x35>
+  80138f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801393:	89 f2                	mov    %esi,%edx
+  801395:	eb 09                	jmp    8013a0 <strlcpy+0x25>
+  801397:	83 c1 01             	add    $0x1,%ecx
+  80139a:	83 c2 01             	add    $0x1,%edx
+  80139d:	88 5a ff             	mov    %bl,-0x1(%edx)
+  8013a0:	39 c2                	cmp    %eax,%edx
+  8013a2:	74 09                	je     8013ad <strlcpy+0x32>
+  8013a4:	0f b6 19             	movzbl (%ecx),%ebx
+  8013a7:	84 db                	test   %bl,%bl
+  8013a9:	75 ec                	jne    801397 <strlcpy+0x1c>
+  8013ab:	89 d0                	mov    %edx,%eax
+  8013ad:	c6 00 00             	movb   $0x0,(%eax)
+  8013b0:	29 f0                	sub    %esi,%eax
+  8013b2:	5b                   	pop    %ebx
+  8013b3:	5e                   	pop    %esi
+  8013b4:	5d                   	pop    %ebp
+  8013b5:	c3                   	ret
+
+008013b6 <strcmp>:
+  8013b6:	55                   	push   %ebp
+  8013b7:	89 e5                	mov    %esp,%ebp
+  8013b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8013bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013bf:	eb 06                	jmp    8013c7 <strcmp+0x11>
+  8013c1:	83 c1 01             	add    $0x1,%ecx
+  8013c4:	83 c2 01             	add    $0x1,%edx
+  8013c7:	0f b6 01             	movzbl (%ecx),%eax
+  8013ca:	84 c0                	test   %al,%al
+  8013cc:	74 04                	je     8013d2 <strcmp+0x1c>
+  8013ce:	3a 02                	cmp    (%edx),%al
+  8013d0:	74 ef                	je     8013c1 <strcmp+0xb>
+  8013d2:	0f b6 c0             	movzbl %al,%eax
+  8013d5:	0f b6 12             	movzbl (%edx),%edx
+  8013d8:	29 d0                	sub    %edx,%eax
+  8013da:	5d                   	pop    %ebp
+  8013db:	c3                   	ret
+
+008013dc <strncmp>:
+  8013dc:	55                   	push   %ebp
+  8013dd:	89 e5                	mov    %esp,%ebp
+  8013df:	53                   	push   %ebx
+  8013e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8013e9:	eb 09                	jmp    8013f4 <strncmp+0x18>
+  8013eb:	83 ea 01             	sub    $0x1,%edx
+  8013ee:	83 c0 01             	add    $0x1,%eax
+  8013f1:	83 c1 01             	add    $0x1,%ecx
+  8013f4:	85 d2                	test   %edx,%edx
+  8013f6:	74 18                	je     801410 <strncmp+0x34>
+  8013f8:	0f b6 18             	movzbl (%eax),%ebx
+  8013fb:	84 db                	test   %bl,%bl
+  8013fd:	74 04                	je     801403 <strncmp+0x27>
+  8013ff:	3a 19                	cmp    (%ecx),%bl
+  801401:	74 e8                	je     8013eb <strncmp+0xf>
+  801403:	0f b6 00             	movzbl (%eax),%eax
+  801406:	0f b6 11             	movzbl (%ecx),%edx
+  801409:	29 d0                	sub    %edx,%eax
+  80140b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80140e:	c9                   	leave
+  80140f:	c3                   	ret
+  801410:	b8 00 00 00 00       	mov    $0x0,%eax
+  801415:	eb f4                	jmp    80140b <strncmp+0x2f>
+
+00801417 <strchr>:
+  801417:	55                   	push   %ebp
+  801418:	89 e5                	mov    %esp,%ebp
+  80141a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80141d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  801421:	eb 03                	jmp    801426 <strchr+0xf>
+  801423:	83 c0 01             	add    $0x1,%eax
+  801426:	0f b6 10             	movzbl (%eax),%edx
+  801429:	84 d2                	test   %dl,%dl
+  80142b:	74 06                	je     801433 <strchr+0x1c>
+  80142d:	38 ca                	cmp    %cl,%dl
+  80142f:	75 f2                	jne    801423 <strchr+0xc>
+  801431:	eb 05                	jmp    801438 <strchr+0x21>
+  801433:	b8 00 00 00 00       	mov    $0x0,%eax
+  801438:	5d                   	pop    %ebp
+  801439:	c3                   	ret
+
+0080143a <strfind>:
+  80143a:	55                   	push   %ebp
+  80143b:	89 e5                	mov    %esp,%ebp
+  80143d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801440:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  801444:	0f b6 10             	movzbl (%eax),%edx
+  801447:	38 ca                	cmp    %cl,%dl
+  801449:	74 09                	je     801454 <strfind+0x1a>
+  80144b:	84 d2                	test   %dl,%dl
+  80144d:	74 05                	je     801454 <strfind+0x1a>
+  80144f:	83 c0 01             	add    $0x1,%eax
+  801452:	eb f0                	jmp    801444 <strfind+0xa>
+  801454:	5d                   	pop    %ebp
+  801455:	c3                   	ret
+
+00801456 <memset>:
+  801456:	55                   	push   %ebp
+  801457:	89 e5                	mov    %esp,%ebp
+  801459:	57                   	push   %edi
+  80145a:	56                   	push   %esi
+  80145b:	53                   	push   %ebx
+  80145c:	83 ec 04             	sub    $0x4,%esp
+  80145f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801462:	8b 55 10             	mov    0x10(%ebp),%edx
+  801465:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  801469:	89 f7                	mov    %esi,%edi
+  80146b:	83 fa 0f             	cmp    $0xf,%edx
+  80146e:	76 24                	jbe    801494 <memset+0x3e>
+  801470:	89 f1                	mov    %esi,%ecx
+  801472:	f7 d9                	neg    %ecx
+  801474:	83 e1 03             	and    $0x3,%ecx
+  801477:	29 ca                	sub    %ecx,%edx
+  801479:	89 d0                	mov    %edx,%eax
+  80147b:	c1 e8 02             	shr    $0x2,%eax
+  80147e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  801481:	83 e2 03             	and    $0x3,%edx
+  801484:	89 d8                	mov    %ebx,%eax
+  801486:	fc                   	cld
+  801487:	f3 aa                	rep stos %al,%es:(%edi)
+  801489:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  80148f:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  801492:	f3 ab                	rep stos %eax,%es:(%edi)
+  801494:	89 d1                	mov    %edx,%ecx
+  801496:	89 d8                	mov    %ebx,%eax
+  801498:	fc                   	cld
+  801499:	f3 aa                	rep stos %al,%es:(%edi)
+  80149b:	89 f0                	mov    %esi,%eax
+  80149d:	83 c4 04             	add    $0x4,%esp
+  8014a0:	5b                   	pop    %ebx
+  8014a1:	5e                   	pop    %esi
+  8014a2:	5f                   	pop    %edi
+  8014a3:	5d                   	pop    %ebp
+  8014a4:	c3                   	ret
+
+008014a5 <memmove>:
+  8014a5:	55                   	push   %ebp
+  8014a6:	89 e5                	mov    %esp,%ebp
+  8014a8:	57                   	push   %edi
+  8014a9:	56                   	push   %esi
+  8014aa:	53                   	push   %ebx
+  8014ab:	83 ec 0c             	sub    $0xc,%esp
+  8014ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8014b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014b4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8014b7:	85 c0                	test   %eax,%eax
+  8014b9:	74 14                	je     8014cf <memmove+0x2a>
+  8014bb:	39 da                	cmp    %ebx,%edx
+  8014bd:	73 07                	jae    8014c6 <memmove+0x21>
+  8014bf:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8014c2:	39 cb                	cmp    %ecx,%ebx
+  8014c4:	72 13                	jb     8014d9 <memmove+0x34>
+  8014c6:	89 c1                	mov    %eax,%ecx
+  8014c8:	89 d8                	mov    %ebx,%eax
+  8014ca:	e8 94 fd ff ff       	call   801263 <copy_fwd>
+  8014cf:	89 d8                	mov    %ebx,%eax
+  8014d1:	83 c4 0c             	add    $0xc,%esp
+  8014d4:	5b                   	pop    %ebx
+  8014d5:	5e                   	pop    %esi
+  8014d6:	5f                   	pop    %edi
+  8014d7:	5d                   	pop    %ebp
+  8014d8:	c3                   	ret
+  8014d9:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  8014dc:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  8014df:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  8014e2:	83 f8 0f             	cmp    $0xf,%eax
+  8014e5:	76 23                	jbe    80150a <memmove+0x65>
+  8014e7:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  8014ea:	83 e1 03             	and    $0x3,%ecx
+  8014ed:	29 c8                	sub    %ecx,%eax
+  8014ef:	89 c2                	mov    %eax,%edx
+  8014f1:	c1 ea 02             	shr    $0x2,%edx
+  8014f4:	83 e0 03             	and    $0x3,%eax
+  8014f7:	fd                   	std
+  8014f8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014fa:	83 ef 03             	sub    $0x3,%edi
+  8014fd:	83 ee 03             	sub    $0x3,%esi
+  801500:	89 d1                	mov    %edx,%ecx
+  801502:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801504:	83 c7 03             	add    $0x3,%edi
+  801507:	83 c6 03             	add    $0x3,%esi
+  80150a:	89 c1                	mov    %eax,%ecx
+  80150c:	fd                   	std
+  80150d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80150f:	fc                   	cld
+  801510:	eb bd                	jmp    8014cf <memmove+0x2a>
+
+00801512 <memcpy>:
+  801512:	55                   	push   %ebp
+  801513:	89 e5                	mov    %esp,%ebp
+  801515:	53                   	push   %ebx
+  801516:	83 ec 04             	sub    $0x4,%esp
+  801519:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80151c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80151f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801522:	89 d8                	mov    %ebx,%eax
+  801524:	e8 3a fd ff ff       	call   801263 <copy_fwd>
+  801529:	89 d8                	mov    %ebx,%eax
+  80152b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80152e:	c9                   	leave
+  80152f:	c3                   	ret
+
+00801530 <page_copy>:
+  801530:	55                   	push   %ebp
+  801531:	89 e5                	mov    %esp,%ebp
+  801533:	57                   	push   %edi
+  801534:	56                   	push   %esi
+  801535:	53                   	push   %ebx
+  801536:	83 ec 0c             	sub    $0xc,%esp
+  801539:	e8 5c fd ff ff       	call   80129a <have_sse2>
+  80153e:	85 c0                	test   %eax,%eax
+  801540:	74 39                	je     80157b <page_copy+0x4b>
+  801542:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801545:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801548:	be 00 01 00 00       	mov    $0x100,%esi
+  80154d:	8b 03                	mov    (%ebx),%eax
+  80154f:	8b 53 04             	mov    0x4(%ebx),%edx
+  801552:	0f c3 01             	movnti %eax,(%ecx)
+  801555:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  801559:	8b 43 08             	mov    0x8(%ebx),%eax
+  80155c:	8b 53 0c             	mov    0xc(%ebx),%edx
+  80155f:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  801563:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  801567:	83 c3 10             	add    $0x10,%ebx
+  80156a:	83 c1 10             	add    $0x10,%ecx
+  80156d:	4e                   	dec    %esi
+  80156e:	75 dd                	jne    80154d <page_copy+0x1d>
+  801570:	0f ae f8             	sfence
+  801573:	83 c4 0c             	add    $0xc,%esp
+  801576:	5b                   	pop    %ebx
+  801577:	5e                   	pop    %esi
+  801578:	5f                   	pop    %edi
+  801579:	5d                   	pop    %ebp
+  80157a:	c3                   	ret
+  80157b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80157e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801581:	b9 00 04 00 00       	mov    $0x400,%ecx
+  801586:	fc                   	cld
+  801587:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801589:	eb e8                	jmp    801573 <page_copy+0x43>
+
+0080158b <page_zero>:
+  80158b:	55                   	push   %ebp
+  80158c:	89 e5                	mov    %esp,%ebp
+  80158e:	57                   	push   %edi
+  80158f:	83 ec 04             	sub    $0x4,%esp
+  801592:	e8 03 fd ff ff       	call   80129a <have_sse2>
+  801597:	85 c0                	test   %eax,%eax
+  801599:	74 3a                	je     8015d5 <page_zero+0x4a>
+  80159b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80159e:	ba 80 00 00 00       	mov    $0x80,%edx
+  8015a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015a8:	0f c3 08             	movnti %ecx,(%eax)
+  8015ab:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  8015af:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  8015b3:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  8015b7:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  8015bb:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  8015bf:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  8015c3:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  8015c7:	83 c0 20             	add    $0x20,%eax
+  8015ca:	4a                   	dec    %edx
+  8015cb:	75 db                	jne    8015a8 <page_zero+0x1d>
+  8015cd:	0f ae f8             	sfence
+  8015d0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8015d3:	c9                   	leave
+  8015d4:	c3                   	ret
+  8015d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015d8:	b9 00 04 00 00       	mov    $0x400,%ecx
+  8015dd:	fc                   	cld
+  8015de:	f3 ab                	rep stos %eax,%es:(%edi)
+  8015e0:	eb ee                	jmp    8015d0 <page_zero+0x45>
+
+008015e2 <memcmp>:
+  8015e2:	55                   	push   %ebp
+  8015e3:	89 e5                	mov    %esp,%ebp
+  8015e5:	56                   	push   %esi
+  8015e6:	53                   	push   %ebx
+  8015e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015ed:	89 c6                	mov    %eax,%esi
+  8015ef:	03 75 10             	add    0x10(%ebp),%esi
+  8015f2:	eb 06                	jmp    8015fa <memcmp+0x18>
+  8015f4:	83 c0 01             	add    $0x1,%eax
+  8015f7:	83 c2 01             	add    $0x1,%edx
+  8015fa:	39 f0                	cmp    %esi,%eax
+  8015fc:	74 14                	je     801612 <memcmp+0x30>
+  8015fe:	0f b6 08             	movzbl (%eax),%ecx
+  801601:	0f b6 1a             	movzbl (%edx),%ebx
+  801604:	38 d9                	cmp    %bl,%cl
+  801606:	74 ec                	je     8015f4 <memcmp+0x12>
+  801608:	0f b6 c1             	movzbl %cl,%eax
+  80160b:	0f b6 db             	movzbl %bl,%ebx
+  80160e:	29 d8                	sub    %ebx,%eax
+  801610:	eb 05                	jmp    801617 <memcmp+0x35>
+  801612:	b8 00 00 00 00       	mov    $0x0,%eax
+  801617:	5b                   	pop    %ebx
+  801618:	5e                   	pop    %esi
+  801619:	5d                   	pop    %ebp
+  80161a:	c3                   	ret
+
+0080161b <memfind>:
+  80161b:	55                   	push   %ebp
+  80161c:	89 e5                	mov    %esp,%ebp
+  80161e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801621:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801624:	89 c2                	mov    %eax,%edx
+  801626:	03 55 10             	add    0x10(%ebp),%edx
+  801629:	eb 03                	jmp    80162e <memfind+0x13>
+  80162b:	83 c0 01             	add    $0x1,%eax
+  80162e:	39 d0                	cmp    %edx,%eax
+  801630:	73 04                	jae    801636 <memfind+0x1b>
+  801632:	38 08                	cmp    %cl,(%eax)
+  801634:	75 f5                	jne    80162b <memfind+0x10>
+  801636:	5d                   	pop    %ebp
+  801637:	c3                   	ret
+
+00801638 <strtol>:
+  801638:	55                   	push   %ebp
+  801639:	89 e5                	mov    %esp,%ebp
+  80163b:	57                   	push   %edi
+  80163c:	56                   	push   %esi
+  80163d:	53                   	push   %ebx
+  80163e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801641:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801644:	eb 03                	jmp    801649 <strtol+0x11>
+  801646:	83 c2 01             	add    $0x1,%edx
+  801649:	0f b6 02             	movzbl (%edx),%eax
+  80164c:	3c 20                	cmp    $0x20,%al
+  80164e:	74 f6                	je     801646 <strtol+0xe>
+  801650:	3c 09                	cmp    $0x9,%al
+  801652:	74 f2                	je     801646 <strtol+0xe>
+  801654:	3c 2b                	cmp    $0x2b,%al
+  801656:	74 2a                	je     801682 <strtol+0x4a>
+  801658:	bf 00 00 00 00       	mov    $0x0,%edi
+  80165d:	3c 2d                	cmp    $0x2d,%al
+  80165f:	74 2b                	je     80168c <strtol+0x54>
+  801661:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801667:	75 0f                	jne    801678 <strtol+0x40>
+  801669:	80 3a 30             	cmpb   $0x30,(%edx)
+  80166c:	74 28                	je     801696 <strtol+0x5e>
+  80166e:	85 db                	test   %ebx,%ebx
+  801670:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801675:	0f 44 d8             	cmove  %eax,%ebx
+  801678:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80167d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801680:	eb 46                	jmp    8016c8 <strtol+0x90>
+  801682:	83 c2 01             	add    $0x1,%edx
+  801685:	bf 00 00 00 00       	mov    $0x0,%edi
+  80168a:	eb d5                	jmp    801661 <strtol+0x29>
+  80168c:	83 c2 01             	add    $0x1,%edx
+  80168f:	bf 01 00 00 00       	mov    $0x1,%edi
+  801694:	eb cb                	jmp    801661 <strtol+0x29>
+  801696:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80169a:	74 0e                	je     8016aa <strtol+0x72>
+  80169c:	85 db                	test   %ebx,%ebx
+  80169e:	75 d8                	jne    801678 <strtol+0x40>
+  8016a0:	83 c2 01             	add    $0x1,%edx
+  8016a3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8016a8:	eb ce                	jmp    801678 <strtol+0x40>
+  8016aa:	83 c2 02             	add    $0x2,%edx
+  8016ad:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8016b2:	eb c4                	jmp    801678 <strtol+0x40>
+  8016b4:	0f be c0             	movsbl %al,%eax
+  8016b7:	83 e8 30             	sub    $0x30,%eax
+  8016ba:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8016bd:	7d 3a                	jge    8016f9 <strtol+0xc1>
+  8016bf:	83 c2 01             	add    $0x1,%edx
+  8016c2:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8016c6:	01 c1                	add    %eax,%ecx
+  8016c8:	0f b6 02             	movzbl (%edx),%eax
+  8016cb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8016ce:	89 f3                	mov    %esi,%ebx
+  8016d0:	80 fb 09             	cmp    $0x9,%bl
+  8016d3:	76 df                	jbe    8016b4 <strtol+0x7c>
+  8016d5:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8016d8:	89 f3                	mov    %esi,%ebx
+  8016da:	80 fb 19             	cmp    $0x19,%bl
+  8016dd:	77 08                	ja     8016e7 <strtol+0xaf>
+  8016df:	0f be c0             	movsbl %al,%eax
+  8016e2:	83 e8 57             	sub    $0x57,%eax
+  8016e5:	eb d3                	jmp    8016ba <strtol+0x82>
+  8016e7:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8016ea:	89 f3                	mov    %esi,%ebx
+  8016ec:	80 fb 19             	cmp    $0x19,%bl
+  8016ef:	77 08                	ja     8016f9 <strtol+0xc1>
+  8016f1:	0f be c0             	movsbl %al,%eax
+  8016f4:	83 e8 37             	sub    $0x37,%eax
+  8016f7:	eb c1                	jmp    8016ba <strtol+0x82>
+  8016f9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8016fd:	74 05                	je     801704 <strtol+0xcc>
+  8016ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801702:	89 10                	mov    %edx,(%eax)
+  801704:	89 c8                	mov    %ecx,%eax
+  801706:	f7 d8                	neg    %eax
+  801708:	85 ff                	test   %edi,%edi
+  80170a:	0f 45 c8             	cmovne %eax,%ecx
+  80170d:	89 c8                	mov    %ecx,%eax
+  80170f:	5b                   	pop    %ebx
+  801710:	5e                   	pop    %esi
+  801711:	5f                   	pop    %edi
+  801712:	5d                   	pop    %ebp
+  801713:	c3                   	ret
+
+00801714 <__udivdi3>:
+  801714:	57                   	push   %edi
+  801715:	56                   	push   %esi
+  801716:	53                   	push   %ebx
+  801717:	83 ec 20             	sub    $0x20,%esp
+  80171a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80171e:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801722:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801726:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80172a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80172e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801732:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801736:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80173a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80173e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801742:	89 d1                	mov    %edx,%ecx
+  801744:	09 c1                	or     %eax,%ecx
+  801746:	0f 84 91 00 00 00    	je     8017dd <__udivdi3+0xc9>
+  80174c:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801753:	00 
+  801754:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80175b:	00 
+  80175c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801761:	b8 00 00 00 00       	mov    $0x0,%eax
+  801766:	ba 00 00 00 00       	mov    $0x0,%edx
+  80176b:	eb 08                	jmp    801775 <__udivdi3+0x61>
+  80176d:	83 e9 01             	sub    $0x1,%ecx
+  801770:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801773:	74 68                	je     8017dd <__udivdi3+0xc9>
+  801775:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801779:	01 c0                	add    %eax,%eax
+  80177b:	89 c6                	mov    %eax,%esi
+  80177d:	89 d7                	mov    %edx,%edi
+  80177f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801783:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801787:	0f ad d0             	shrd   %cl,%edx,%eax
+  80178a:	d3 ea                	shr    %cl,%edx
+  80178c:	f6 c1 20             	test   $0x20,%cl
+  80178f:	74 04                	je     801795 <__udivdi3+0x81>
+  801791:	89 d0                	mov    %edx,%eax
+  801793:	31 d2                	xor    %edx,%edx
+  801795:	83 e0 01             	and    $0x1,%eax
+  801798:	89 04 24             	mov    %eax,(%esp)
+  80179b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8017a2:	00 
+  8017a3:	8b 04 24             	mov    (%esp),%eax
+  8017a6:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8017aa:	09 f0                	or     %esi,%eax
+  8017ac:	09 fa                	or     %edi,%edx
+  8017ae:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8017b2:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8017b6:	39 f0                	cmp    %esi,%eax
+  8017b8:	89 d3                	mov    %edx,%ebx
+  8017ba:	19 fb                	sbb    %edi,%ebx
+  8017bc:	72 af                	jb     80176d <__udivdi3+0x59>
+  8017be:	29 f0                	sub    %esi,%eax
+  8017c0:	19 fa                	sbb    %edi,%edx
+  8017c2:	89 cf                	mov    %ecx,%edi
+  8017c4:	c1 ef 05             	shr    $0x5,%edi
+  8017c7:	83 e7 01             	and    $0x1,%edi
+  8017ca:	89 fe                	mov    %edi,%esi
+  8017cc:	83 f6 01             	xor    $0x1,%esi
+  8017cf:	d3 e6                	shl    %cl,%esi
+  8017d1:	d3 e7                	shl    %cl,%edi
+  8017d3:	09 74 24 18          	or     %esi,0x18(%esp)
+  8017d7:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8017db:	eb 90                	jmp    80176d <__udivdi3+0x59>
+  8017dd:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8017e1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8017e5:	83 c4 20             	add    $0x20,%esp
+  8017e8:	5b                   	pop    %ebx
+  8017e9:	5e                   	pop    %esi
+  8017ea:	5f                   	pop    %edi
+  8017eb:	c3                   	ret
+
+008017ec <__umoddi3>:
+  8017ec:	55                   	push   %ebp
+  8017ed:	57                   	push   %edi
+  8017ee:	56                   	push   %esi
+  8017ef:	53                   	push   %ebx
+  8017f0:	83 ec 1c             	sub    $0x1c,%esp
+  8017f3:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8017f7:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8017fb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8017ff:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801803:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801807:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80180b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80180f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801813:	89 d6                	mov    %edx,%esi
+  801815:	09 c6                	or     %eax,%esi
+  801817:	74 6c                	je     801885 <__umoddi3+0x99>
+  801819:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80181e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801823:	ba 00 00 00 00       	mov    $0x0,%edx
+  801828:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  80182c:	eb 0e                	jmp    80183c <__umoddi3+0x50>
+  80182e:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801833:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801837:	83 fe ff             	cmp    $0xffffffff,%esi
+  80183a:	74 49                	je     801885 <__umoddi3+0x99>
+  80183c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801840:	01 c0                	add    %eax,%eax
+  801842:	89 c3                	mov    %eax,%ebx
+  801844:	89 d6                	mov    %edx,%esi
+  801846:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80184a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80184e:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801853:	0f ad d0             	shrd   %cl,%edx,%eax
+  801856:	d3 ea                	shr    %cl,%edx
+  801858:	f6 c1 20             	test   $0x20,%cl
+  80185b:	74 04                	je     801861 <__umoddi3+0x75>
+  80185d:	89 d0                	mov    %edx,%eax
+  80185f:	31 d2                	xor    %edx,%edx
+  801861:	83 e0 01             	and    $0x1,%eax
+  801864:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801869:	89 ea                	mov    %ebp,%edx
+  80186b:	09 d8                	or     %ebx,%eax
+  80186d:	09 f2                	or     %esi,%edx
+  80186f:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801873:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801877:	39 d8                	cmp    %ebx,%eax
+  801879:	89 d1                	mov    %edx,%ecx
+  80187b:	19 f1                	sbb    %esi,%ecx
+  80187d:	72 af                	jb     80182e <__umoddi3+0x42>
+  80187f:	29 d8                	sub    %ebx,%eax
+  801881:	19 f2                	sbb    %esi,%edx
+  801883:	eb a9                	jmp    80182e <__umoddi3+0x42>
+  801885:	83 c4 1c             	add    $0x1c,%esp
+  801888:	5b                   	pop    %ebx
+  801889:	5e                   	pop    %esi
+  80188a:	5f                   	pop    %edi
+  80188b:	5d                   	pop    %ebp
+  80188c:	c3                   	ret
+
+0080188d <__divdi3>:
+  80188d:	53                   	push   %ebx
+  80188e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801892:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801896:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80189a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80189e:	85 d2                	test   %edx,%edx
+  8018a0:	78 12                	js     8018b4 <__divdi3+0x27>
+  8018a2:	85 db                	test   %ebx,%ebx
+  8018a4:	78 2e                	js     8018d4 <__divdi3+0x47>
+  8018a6:	53                   	push   %ebx
+  8018a7:	51                   	push   %ecx
+  8018a8:	52                   	push   %edx
+  8018a9:	50                   	push   %eax
+  8018aa:	e8 65 fe ff ff       	call   801714 <__udivdi3>
+  8018af:	83 c4 10             	add    $0x10,%esp
+  8018b2:	eb 1e                	jmp    8018d2 <__divdi3+0x45>
+  8018b4:	f7 d8                	neg    %eax
+  8018b6:	83 d2 00             	adc    $0x0,%edx
+  8018b9:	f7 da                	neg    %edx
+  8018bb:	85 db                	test   %ebx,%ebx
+  8018bd:	78 2a                	js     8018e9 <__divdi3+0x5c>
+  8018bf:	53                   	push   %ebx
+  8018c0:	51                   	push   %ecx
+  8018c1:	52                   	push   %edx
+  8018c2:	50                   	push   %eax
+  8018c3:	e8 4c fe ff ff       	call   801714 <__udivdi3>
+  8018c8:	83 c4 10             	add    $0x10,%esp
+  8018cb:	f7 d8                	neg    %eax
+  8018cd:	83 d2 00             	adc    $0x0,%edx
+  8018d0:	f7 da                	neg    %edx
+  8018d2:	5b                   	pop    %ebx
+  8018d3:	c3                   	ret
+  8018d4:	f7 d9                	neg    %ecx
+  8018d6:	83 d3 00             	adc    $0x0,%ebx
+  8018d9:	f7 db                	neg    %ebx
+  8018db:	53                   	push   %ebx
+  8018dc:	51                   	push   %ecx
+  8018dd:	52                   	push   %edx
+  8018de:	50                   	push   %eax
+  8018df:	e8 30 fe ff ff       	call   801714 <__udivdi3>
+  8018e4:	83 c4 10             	add    $0x10,%esp
+  8018e7:	eb e2                	jmp    8018cb <__divdi3+0x3e>
+  8018e9:	f7 d9                	neg    %ecx
+  8018eb:	83 d3 00             	adc    $0x0,%ebx
+  8018ee:	f7 db                	neg    %ebx
+  8018f0:	53                   	push   %ebx
+  8018f1:	51                   	push   %ecx
+  8018f2:	52                   	push   %edx
+  8018f3:	50                   	push   %eax
+  8018f4:	e8 1b fe ff ff       	call   801714 <__udivdi3>
+  8018f9:	83 c4 10             	add    $0x10,%esp
+  8018fc:	eb d4                	jmp    8018d2 <__divdi3+0x45>
+
+008018fe <__moddi3>:
+  8018fe:	55                   	push   %ebp
+  8018ff:	57                   	push   %edi
+  801900:	56                   	push   %esi
+  801901:	53                   	push   %ebx
+  801902:	83 ec 14             	sub    $0x14,%esp
+  801905:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801909:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  80190d:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801911:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801915:	85 ed                	test   %ebp,%ebp
+  801917:	78 2b                	js     801944 <__moddi3+0x46>
+  801919:	89 c6                	mov    %eax,%esi
+  80191b:	f7 de                	neg    %esi
+  80191d:	89 34 24             	mov    %esi,(%esp)
+  801920:	89 d6                	mov    %edx,%esi
+  801922:	83 d6 00             	adc    $0x0,%esi
+  801925:	f7 de                	neg    %esi
+  801927:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80192b:	8b 34 24             	mov    (%esp),%esi
+  80192e:	0f 48 f0             	cmovs  %eax,%esi
+  801931:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801936:	52                   	push   %edx
+  801937:	56                   	push   %esi
+  801938:	55                   	push   %ebp
+  801939:	57                   	push   %edi
+  80193a:	e8 ad fe ff ff       	call   8017ec <__umoddi3>
+  80193f:	83 c4 10             	add    $0x10,%esp
+  801942:	eb 3c                	jmp    801980 <__moddi3+0x82>
+  801944:	89 c3                	mov    %eax,%ebx
+  801946:	f7 db                	neg    %ebx
+  801948:	89 d1                	mov    %edx,%ecx
+  80194a:	83 d1 00             	adc    $0x0,%ecx
+  80194d:	f7 d9                	neg    %ecx
+  80194f:	0f 49 c3             	cmovns %ebx,%eax
+  801952:	89 04 24             	mov    %eax,(%esp)
+  801955:	0f 49 d1             	cmovns %ecx,%edx
+  801958:	89 54 24 04          	mov    %edx,0x4(%esp)
+  80195c:	ff 74 24 04          	push   0x4(%esp)
+  801960:	ff 74 24 04          	push   0x4(%esp)
+  801964:	89 f8                	mov    %edi,%eax
+  801966:	89 ea                	mov    %ebp,%edx
+  801968:	f7 d8                	neg    %eax
+  80196a:	83 d2 00             	adc    $0x0,%edx
+  80196d:	f7 da                	neg    %edx
+  80196f:	52                   	push   %edx
+  801970:	50                   	push   %eax
+  801971:	e8 76 fe ff ff       	call   8017ec <__umoddi3>
+  801976:	83 c4 10             	add    $0x10,%esp
+  801979:	f7 d8                	neg    %eax
+  80197b:	83 d2 00             	adc    $0x0,%edx
+  80197e:	f7 da                	neg    %edx
+  801980:	83 c4 14             	add    $0x14,%esp
+  801983:	5b                   	pop    %ebx
+  801984:	5e                   	pop    %esi
+  801985:	5f                   	pop    %edi
+  801986:	5d                   	pop    %ebp
+  801987:	c3                   	ret
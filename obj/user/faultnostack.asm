@@ -0,0 +1,2630 @@
+
+obj/user/faultnostack:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	68 2f 0a 80 00       	push   $0x800a2f
+  80003e:	6a 00                	push   $0x0
+  800040:	e8 57 06 00 00       	call   80069c <sys_env_set_pgfault_upcall>
+  800045:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80004c:	00 00 00 
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80005f:	e8 f1 09 00 00       	call   800a55 <uinfo_envid>
+  800064:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  800069:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  80006f:	05 00 00 00 ed       	add    $0xed000000,%eax
+  800074:	a3 20 20 80 00       	mov    %eax,0x802020
+  800079:	85 db                	test   %ebx,%ebx
+  80007b:	7e 07                	jle    800084 <libmain+0x30>
+  80007d:	8b 06                	mov    (%esi),%eax
+  80007f:	a3 00 20 80 00       	mov    %eax,0x802000
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	56                   	push   %esi
+  800088:	53                   	push   %ebx
+  800089:	e8 a5 ff ff ff       	call   800033 <umain>
+  80008e:	e8 0a 00 00 00       	call   80009d <exit>
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+
+0080009d <exit>:
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+  8000a3:	e8 46 0a 00 00       	call   800aee <bflush>
+  8000a8:	83 ec 0c             	sub    $0xc,%esp
+  8000ab:	6a 00                	push   $0x0
+  8000ad:	e8 d3 00 00 00       	call   800185 <sys_env_destroy>
+  8000b2:	83 c4 10             	add    $0x10,%esp
+  8000b5:	c9                   	leave
+  8000b6:	c3                   	ret
+
+008000b7 <sys_cputs>:
+  8000b7:	55                   	push   %ebp
+  8000b8:	89 e5                	mov    %esp,%ebp
+  8000ba:	57                   	push   %edi
+  8000bb:	56                   	push   %esi
+  8000bc:	53                   	push   %ebx
+  8000bd:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000c4:	78 21                	js     8000e7 <sys_cputs+0x30>
+  8000c6:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000cd:	75 2d                	jne    8000fc <sys_cputs+0x45>
+  8000cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000da:	89 c3                	mov    %eax,%ebx
+  8000dc:	89 c7                	mov    %eax,%edi
+  8000de:	89 c6                	mov    %eax,%esi
+  8000e0:	cd 30                	int    $0x30
+  8000e2:	5b                   	pop    %ebx
+  8000e3:	5e                   	pop    %esi
+  8000e4:	5f                   	pop    %edi
+  8000e5:	5d                   	pop    %ebp
+  8000e6:	c3                   	ret
+  8000e7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000ec:	0f a2                	cpuid
+  8000ee:	c1 ea 0b             	shr    $0xb,%edx
+  8000f1:	83 e2 01             	and    $0x1,%edx
+  8000f4:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8000fa:	eb ca                	jmp    8000c6 <sys_cputs+0xf>
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800101:	8b 55 08             	mov    0x8(%ebp),%edx
+  800104:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800107:	89 c3                	mov    %eax,%ebx
+  800109:	89 c7                	mov    %eax,%edi
+  80010b:	89 c6                	mov    %eax,%esi
+  80010d:	55                   	push   %ebp
+  80010e:	68 17 01 80 00       	push   $0x800117
+  800113:	89 e5                	mov    %esp,%ebp
+  800115:	0f 34                	sysenter
+  800117:	83 c4 04             	add    $0x4,%esp
+  80011a:	5d                   	pop    %ebp
+  80011b:	eb c5                	jmp    8000e2 <sys_cputs+0x2b>
+
+0080011d <sys_cgetc>:
+  80011d:	55                   	push   %ebp
+  80011e:	89 e5                	mov    %esp,%ebp
+  800120:	57                   	push   %edi
+  800121:	56                   	push   %esi
+  800122:	53                   	push   %ebx
+  800123:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80012a:	78 22                	js     80014e <sys_cgetc+0x31>
+  80012c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800133:	75 2e                	jne    800163 <sys_cgetc+0x46>
+  800135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80013f:	89 d1                	mov    %edx,%ecx
+  800141:	89 d3                	mov    %edx,%ebx
+  800143:	89 d7                	mov    %edx,%edi
+  800145:	89 d6                	mov    %edx,%esi
+  800147:	cd 30                	int    $0x30
+  800149:	5b                   	pop    %ebx
+  80014a:	5e                   	pop    %esi
+  80014b:	5f                   	pop    %edi
+  80014c:	5d                   	pop    %ebp
+  80014d:	c3                   	ret
+  80014e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800153:	0f a2                	cpuid
+  800155:	c1 ea 0b             	shr    $0xb,%edx
+  800158:	83 e2 01             	and    $0x1,%edx
+  80015b:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800161:	eb c9                	jmp    80012c <sys_cgetc+0xf>
+  800163:	ba 00 00 00 00       	mov    $0x0,%edx
+  800168:	b8 01 00 00 00       	mov    $0x1,%eax
+  80016d:	89 d1                	mov    %edx,%ecx
+  80016f:	89 d3                	mov    %edx,%ebx
+  800171:	89 d7                	mov    %edx,%edi
+  800173:	89 d6                	mov    %edx,%esi
+  800175:	55                   	push   %ebp
+  800176:	68 7f 01 80 00       	push   $0x80017f
+  80017b:	89 e5                	mov    %esp,%ebp
+  80017d:	0f 34                	sysenter
+  80017f:	83 c4 04             	add    $0x4,%esp
+  800182:	5d                   	pop    %ebp
+  800183:	eb c4                	jmp    800149 <sys_cgetc+0x2c>
+
+00800185 <sys_env_destroy>:
+  800185:	55                   	push   %ebp
+  800186:	89 e5                	mov    %esp,%ebp
+  800188:	57                   	push   %edi
+  800189:	56                   	push   %esi
+  80018a:	53                   	push   %ebx
+  80018b:	83 ec 0c             	sub    $0xc,%esp
+  80018e:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800195:	78 2a                	js     8001c1 <sys_env_destroy+0x3c>
+  800197:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80019e:	75 36                	jne    8001d6 <sys_env_destroy+0x51>
+  8001a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001a5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8001aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ad:	89 cb                	mov    %ecx,%ebx
+  8001af:	89 cf                	mov    %ecx,%edi
+  8001b1:	89 ce                	mov    %ecx,%esi
+  8001b3:	cd 30                	int    $0x30
+  8001b5:	85 c0                	test   %eax,%eax
+  8001b7:	7f 40                	jg     8001f9 <sys_env_destroy+0x74>
+  8001b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001bc:	5b                   	pop    %ebx
+  8001bd:	5e                   	pop    %esi
+  8001be:	5f                   	pop    %edi
+  8001bf:	5d                   	pop    %ebp
+  8001c0:	c3                   	ret
+  8001c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001c6:	0f a2                	cpuid
+  8001c8:	c1 ea 0b             	shr    $0xb,%edx
+  8001cb:	83 e2 01             	and    $0x1,%edx
+  8001ce:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8001d4:	eb c1                	jmp    800197 <sys_env_destroy+0x12>
+  8001d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001de:	b8 03 00 00 00       	mov    $0x3,%eax
+  8001e3:	89 cb                	mov    %ecx,%ebx
+  8001e5:	89 cf                	mov    %ecx,%edi
+  8001e7:	89 ce                	mov    %ecx,%esi
+  8001e9:	55                   	push   %ebp
+  8001ea:	68 f3 01 80 00       	push   $0x8001f3
+  8001ef:	89 e5                	mov    %esp,%ebp
+  8001f1:	0f 34                	sysenter
+  8001f3:	83 c4 04             	add    $0x4,%esp
+  8001f6:	5d                   	pop    %ebp
+  8001f7:	eb bc                	jmp    8001b5 <sys_env_destroy+0x30>
+  8001f9:	83 ec 0c             	sub    $0xc,%esp
+  8001fc:	50                   	push   %eax
+  8001fd:	6a 03                	push   $0x3
+  8001ff:	68 2a 1a 80 00       	push   $0x801a2a
+  800204:	6a 49                	push   $0x49
+  800206:	68 47 1a 80 00       	push   $0x801a47
+  80020b:	e8 d5 09 00 00       	call   800be5 <_panic>
+
+00800210 <sys_getenvid>:
+  800210:	55                   	push   %ebp
+  800211:	89 e5                	mov    %esp,%ebp
+  800213:	57                   	push   %edi
+  800214:	56                   	push   %esi
+  800215:	53                   	push   %ebx
+  800216:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80021d:	78 22                	js     800241 <sys_getenvid+0x31>
+  80021f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800226:	75 2e                	jne    800256 <sys_getenvid+0x46>
+  800228:	ba 00 00 00 00       	mov    $0x0,%edx
+  80022d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800232:	89 d1                	mov    %edx,%ecx
+  800234:	89 d3                	mov    %edx,%ebx
+  800236:	89 d7                	mov    %edx,%edi
+  800238:	89 d6                	mov    %edx,%esi
+  80023a:	cd 30                	int    $0x30
+  80023c:	5b                   	pop    %ebx
+  80023d:	5e                   	pop    %esi
+  80023e:	5f                   	pop    %edi
+  80023f:	5d                   	pop    %ebp
+  800240:	c3                   	ret
+  800241:	b8 01 00 00 00       	mov    $0x1,%eax
+  800246:	0f a2                	cpuid
+  800248:	c1 ea 0b             	shr    $0xb,%edx
+  80024b:	83 e2 01             	and    $0x1,%edx
+  80024e:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800254:	eb c9                	jmp    80021f <sys_getenvid+0xf>
+  800256:	ba 00 00 00 00       	mov    $0x0,%edx
+  80025b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800260:	89 d1                	mov    %edx,%ecx
+  800262:	89 d3                	mov    %edx,%ebx
+  800264:	89 d7                	mov    %edx,%edi
+  800266:	89 d6                	mov    %edx,%esi
+  800268:	55                   	push   %ebp
+  800269:	68 72 02 80 00       	push   $0x800272
+  80026e:	89 e5                	mov    %esp,%ebp
+  800270:	0f 34                	sysenter
+  800272:	83 c4 04             	add    $0x4,%esp
+  800275:	5d                   	pop    %ebp
+  800276:	eb c4                	jmp    80023c <sys_getenvid+0x2c>
+
+00800278 <sys_yield>:
+  800278:	55                   	push   %ebp
+  800279:	89 e5                	mov    %esp,%ebp
+  80027b:	57                   	push   %edi
+  80027c:	56                   	push   %esi
+  80027d:	53                   	push   %ebx
+  80027e:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800285:	78 22                	js     8002a9 <sys_yield+0x31>
+  800287:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80028e:	75 2e                	jne    8002be <sys_yield+0x46>
+  800290:	ba 00 00 00 00       	mov    $0x0,%edx
+  800295:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80029a:	89 d1                	mov    %edx,%ecx
+  80029c:	89 d3                	mov    %edx,%ebx
+  80029e:	89 d7                	mov    %edx,%edi
+  8002a0:	89 d6                	mov    %edx,%esi
+  8002a2:	cd 30                	int    $0x30
+  8002a4:	5b                   	pop    %ebx
+  8002a5:	5e                   	pop    %esi
+  8002a6:	5f                   	pop    %edi
+  8002a7:	5d                   	pop    %ebp
+  8002a8:	c3                   	ret
+  8002a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8002ae:	0f a2                	cpuid
+  8002b0:	c1 ea 0b             	shr    $0xb,%edx
+  8002b3:	83 e2 01             	and    $0x1,%edx
+  8002b6:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8002bc:	eb c9                	jmp    800287 <sys_yield+0xf>
+  8002be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002c8:	89 d1                	mov    %edx,%ecx
+  8002ca:	89 d3                	mov    %edx,%ebx
+  8002cc:	89 d7                	mov    %edx,%edi
+  8002ce:	89 d6                	mov    %edx,%esi
+  8002d0:	55                   	push   %ebp
+  8002d1:	68 da 02 80 00       	push   $0x8002da
+  8002d6:	89 e5                	mov    %esp,%ebp
+  8002d8:	0f 34                	sysenter
+  8002da:	83 c4 04             	add    $0x4,%esp
+  8002dd:	5d                   	pop    %ebp
+  8002de:	eb c4                	jmp    8002a4 <sys_yield+0x2c>
+
+008002e0 <sys_env_set_cow>:
+  8002e0:	55                   	push   %ebp
+  8002e1:	89 e5                	mov    %esp,%ebp
+  8002e3:	57                   	push   %edi
+  8002e4:	56                   	push   %esi
+  8002e5:	53                   	push   %ebx
+  8002e6:	83 ec 0c             	sub    $0xc,%esp
+  8002e9:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8002f0:	78 2b                	js     80031d <sys_env_set_cow+0x3d>
+  8002f2:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8002f9:	75 37                	jne    800332 <sys_env_set_cow+0x52>
+  8002fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800300:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800305:	8b 55 08             	mov    0x8(%ebp),%edx
+  800308:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80030b:	89 df                	mov    %ebx,%edi
+  80030d:	89 de                	mov    %ebx,%esi
+  80030f:	cd 30                	int    $0x30
+  800311:	85 c0                	test   %eax,%eax
+  800313:	7f 41                	jg     800356 <sys_env_set_cow+0x76>
+  800315:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800318:	5b                   	pop    %ebx
+  800319:	5e                   	pop    %esi
+  80031a:	5f                   	pop    %edi
+  80031b:	5d                   	pop    %ebp
+  80031c:	c3                   	ret
+  80031d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800322:	0f a2                	cpuid
+  800324:	c1 ea 0b             	shr    $0xb,%edx
+  800327:	83 e2 01             	and    $0x1,%edx
+  80032a:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800330:	eb c0                	jmp    8002f2 <sys_env_set_cow+0x12>
+  800332:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800337:	8b 55 08             	mov    0x8(%ebp),%edx
+  80033a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80033d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800342:	89 df                	mov    %ebx,%edi
+  800344:	89 de                	mov    %ebx,%esi
+  800346:	55                   	push   %ebp
+  800347:	68 50 03 80 00       	push   $0x800350
+  80034c:	89 e5                	mov    %esp,%ebp
+  80034e:	0f 34                	sysenter
+  800350:	83 c4 04             	add    $0x4,%esp
+  800353:	5d                   	pop    %ebp
+  800354:	eb bb                	jmp    800311 <sys_env_set_cow+0x31>
+  800356:	83 ec 0c             	sub    $0xc,%esp
+  800359:	50                   	push   %eax
+  80035a:	6a 0d                	push   $0xd
+  80035c:	68 2a 1a 80 00       	push   $0x801a2a
+  800361:	6a 49                	push   $0x49
+  800363:	68 47 1a 80 00       	push   $0x801a47
+  800368:	e8 78 08 00 00       	call   800be5 <_panic>
+
+0080036d <sys_env_set_quota>:
+  80036d:	55                   	push   %ebp
+  80036e:	89 e5                	mov    %esp,%ebp
+  800370:	57                   	push   %edi
+  800371:	56                   	push   %esi
+  800372:	53                   	push   %ebx
+  800373:	83 ec 0c             	sub    $0xc,%esp
+  800376:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80037d:	78 2b                	js     8003aa <sys_env_set_quota+0x3d>
+  80037f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800386:	75 37                	jne    8003bf <sys_env_set_quota+0x52>
+  800388:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80038d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800392:	8b 55 08             	mov    0x8(%ebp),%edx
+  800395:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800398:	89 df                	mov    %ebx,%edi
+  80039a:	89 de                	mov    %ebx,%esi
+  80039c:	cd 30                	int    $0x30
+  80039e:	85 c0                	test   %eax,%eax
+  8003a0:	7f 41                	jg     8003e3 <sys_env_set_quota+0x76>
+  8003a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a5:	5b                   	pop    %ebx
+  8003a6:	5e                   	pop    %esi
+  8003a7:	5f                   	pop    %edi
+  8003a8:	5d                   	pop    %ebp
+  8003a9:	c3                   	ret
+  8003aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003af:	0f a2                	cpuid
+  8003b1:	c1 ea 0b             	shr    $0xb,%edx
+  8003b4:	83 e2 01             	and    $0x1,%edx
+  8003b7:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8003bd:	eb c0                	jmp    80037f <sys_env_set_quota+0x12>
+  8003bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003ca:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003cf:	89 df                	mov    %ebx,%edi
+  8003d1:	89 de                	mov    %ebx,%esi
+  8003d3:	55                   	push   %ebp
+  8003d4:	68 dd 03 80 00       	push   $0x8003dd
+  8003d9:	89 e5                	mov    %esp,%ebp
+  8003db:	0f 34                	sysenter
+  8003dd:	83 c4 04             	add    $0x4,%esp
+  8003e0:	5d                   	pop    %ebp
+  8003e1:	eb bb                	jmp    80039e <sys_env_set_quota+0x31>
+  8003e3:	83 ec 0c             	sub    $0xc,%esp
+  8003e6:	50                   	push   %eax
+  8003e7:	6a 0f                	push   $0xf
+  8003e9:	68 2a 1a 80 00       	push   $0x801a2a
+  8003ee:	6a 49                	push   $0x49
+  8003f0:	68 47 1a 80 00       	push   $0x801a47
+  8003f5:	e8 eb 07 00 00       	call   800be5 <_panic>
+
+008003fa <sys_page_alloc>:
+  8003fa:	55                   	push   %ebp
+  8003fb:	89 e5                	mov    %esp,%ebp
+  8003fd:	57                   	push   %edi
+  8003fe:	56                   	push   %esi
+  8003ff:	53                   	push   %ebx
+  800400:	83 ec 0c             	sub    $0xc,%esp
+  800403:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80040a:	78 2c                	js     800438 <sys_page_alloc+0x3e>
+  80040c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800413:	75 38                	jne    80044d <sys_page_alloc+0x53>
+  800415:	be 00 00 00 00       	mov    $0x0,%esi
+  80041a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80041f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800422:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800425:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800428:	89 f7                	mov    %esi,%edi
+  80042a:	cd 30                	int    $0x30
+  80042c:	85 c0                	test   %eax,%eax
+  80042e:	7f 42                	jg     800472 <sys_page_alloc+0x78>
+  800430:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800433:	5b                   	pop    %ebx
+  800434:	5e                   	pop    %esi
+  800435:	5f                   	pop    %edi
+  800436:	5d                   	pop    %ebp
+  800437:	c3                   	ret
+  800438:	b8 01 00 00 00       	mov    $0x1,%eax
+  80043d:	0f a2                	cpuid
+  80043f:	c1 ea 0b             	shr    $0xb,%edx
+  800442:	83 e2 01             	and    $0x1,%edx
+  800445:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80044b:	eb bf                	jmp    80040c <sys_page_alloc+0x12>
+  80044d:	be 00 00 00 00       	mov    $0x0,%esi
+  800452:	8b 55 08             	mov    0x8(%ebp),%edx
+  800455:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800458:	b8 04 00 00 00       	mov    $0x4,%eax
+  80045d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800460:	89 f7                	mov    %esi,%edi
+  800462:	55                   	push   %ebp
+  800463:	68 6c 04 80 00       	push   $0x80046c
+  800468:	89 e5                	mov    %esp,%ebp
+  80046a:	0f 34                	sysenter
+  80046c:	83 c4 04             	add    $0x4,%esp
+  80046f:	5d                   	pop    %ebp
+  800470:	eb ba                	jmp    80042c <sys_page_alloc+0x32>
+  800472:	83 ec 0c             	sub    $0xc,%esp
+  800475:	50                   	push   %eax
+  800476:	6a 04                	push   $0x4
+  800478:	68 2a 1a 80 00       	push   $0x801a2a
+  80047d:	6a 49                	push   $0x49
+  80047f:	68 47 1a 80 00       	push   $0x801a47
+  800484:	e8 5c 07 00 00       	call   800be5 <_panic>
+
+00800489 <sys_page_map>:
+  800489:	55                   	push   %ebp
+  80048a:	89 e5                	mov    %esp,%ebp
+  80048c:	57                   	push   %edi
+  80048d:	56                   	push   %esi
+  80048e:	53                   	push   %ebx
+  80048f:	83 ec 0c             	sub    $0xc,%esp
+  800492:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800499:	78 2b                	js     8004c6 <sys_page_map+0x3d>
+  80049b:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8004a2:	75 37                	jne    8004db <sys_page_map+0x52>
+  8004a4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8004a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004b2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004b5:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004b8:	cd 30                	int    $0x30
+  8004ba:	85 c0                	test   %eax,%eax
+  8004bc:	7f 41                	jg     8004ff <sys_page_map+0x76>
+  8004be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c1:	5b                   	pop    %ebx
+  8004c2:	5e                   	pop    %esi
+  8004c3:	5f                   	pop    %edi
+  8004c4:	5d                   	pop    %ebp
+  8004c5:	c3                   	ret
+  8004c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004cb:	0f a2                	cpuid
+  8004cd:	c1 ea 0b             	shr    $0xb,%edx
+  8004d0:	83 e2 01             	and    $0x1,%edx
+  8004d3:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8004d9:	eb c0                	jmp    80049b <sys_page_map+0x12>
+  8004db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8004e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004e9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004ec:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004ef:	55                   	push   %ebp
+  8004f0:	68 f9 04 80 00       	push   $0x8004f9
+  8004f5:	89 e5                	mov    %esp,%ebp
+  8004f7:	0f 34                	sysenter
+  8004f9:	83 c4 04             	add    $0x4,%esp
+  8004fc:	5d                   	pop    %ebp
+  8004fd:	eb bb                	jmp    8004ba <sys_page_map+0x31>
+  8004ff:	83 ec 0c             	sub    $0xc,%esp
+  800502:	50                   	push   %eax
+  800503:	6a 05                	push   $0x5
+  800505:	68 2a 1a 80 00       	push   $0x801a2a
+  80050a:	6a 49                	push   $0x49
+  80050c:	68 47 1a 80 00       	push   $0x801a47
+  800511:	e8 cf 06 00 00       	call   800be5 <_panic>
+
+00800516 <sys_page_unmap>:
+  800516:	55                   	push   %ebp
+  800517:	89 e5                	mov    %esp,%ebp
+  800519:	57                   	push   %edi
+  80051a:	56                   	push   %esi
+  80051b:	53                   	push   %ebx
+  80051c:	83 ec 0c             	sub    $0xc,%esp
+  80051f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800526:	78 2b                	js     800553 <sys_page_unmap+0x3d>
+  800528:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80052f:	75 37                	jne    800568 <sys_page_unmap+0x52>
+  800531:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800536:	b8 06 00 00 00       	mov    $0x6,%eax
+  80053b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80053e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800541:	89 df                	mov    %ebx,%edi
+  800543:	89 de                	mov    %ebx,%esi
+  800545:	cd 30                	int    $0x30
+  800547:	85 c0                	test   %eax,%eax
+  800549:	7f 41                	jg     80058c <sys_page_unmap+0x76>
+  80054b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80054e:	5b                   	pop    %ebx
+  80054f:	5e                   	pop    %esi
+  800550:	5f                   	pop    %edi
+  800551:	5d                   	pop    %ebp
+  800552:	c3                   	ret
+  800553:	b8 01 00 00 00       	mov    $0x1,%eax
+  800558:	0f a2                	cpuid
+  80055a:	c1 ea 0b             	shr    $0xb,%edx
+  80055d:	83 e2 01             	and    $0x1,%edx
+  800560:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800566:	eb c0                	jmp    800528 <sys_page_unmap+0x12>
+  800568:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80056d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800570:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800573:	b8 06 00 00 00       	mov    $0x6,%eax
+  800578:	89 df                	mov    %ebx,%edi
+  80057a:	89 de                	mov    %ebx,%esi
+  80057c:	55                   	push   %ebp
+  80057d:	68 86 05 80 00       	push   $0x800586
+  800582:	89 e5                	mov    %esp,%ebp
+  800584:	0f 34                	sysenter
+  800586:	83 c4 04             	add    $0x4,%esp
+  800589:	5d                   	pop    %ebp
+  80058a:	eb bb                	jmp    800547 <sys_page_unmap+0x31>
+  80058c:	83 ec 0c             	sub    $0xc,%esp
+  80058f:	50                   	push   %eax
+  800590:	6a 06                	push   $0x6
+  800592:	68 2a 1a 80 00       	push   $0x801a2a
+  800597:	6a 49                	push   $0x49
+  800599:	68 47 1a 80 00       	push   $0x801a47
+  80059e:	e8 42 06 00 00       	call   800be5 <_panic>
+
+008005a3 <sys_page_reuse>:
+  8005a3:	55                   	push   %ebp
+  8005a4:	89 e5                	mov    %esp,%ebp
+  8005a6:	57                   	push   %edi
+  8005a7:	56                   	push   %esi
+  8005a8:	53                   	push   %ebx
+  8005a9:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8005b0:	78 24                	js     8005d6 <sys_page_reuse+0x33>
+  8005b2:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8005b9:	75 30                	jne    8005eb <sys_page_reuse+0x48>
+  8005bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005c0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005cb:	89 df                	mov    %ebx,%edi
+  8005cd:	89 de                	mov    %ebx,%esi
+  8005cf:	cd 30                	int    $0x30
+  8005d1:	5b                   	pop    %ebx
+  8005d2:	5e                   	pop    %esi
+  8005d3:	5f                   	pop    %edi
+  8005d4:	5d                   	pop    %ebp
+  8005d5:	c3                   	ret
+  8005d6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005db:	0f a2                	cpuid
+  8005dd:	c1 ea 0b             	shr    $0xb,%edx
+  8005e0:	83 e2 01             	and    $0x1,%edx
+  8005e3:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8005e9:	eb c7                	jmp    8005b2 <sys_page_reuse+0xf>
+  8005eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005f6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005fb:	89 df                	mov    %ebx,%edi
+  8005fd:	89 de                	mov    %ebx,%esi
+  8005ff:	55                   	push   %ebp
+  800600:	68 09 06 80 00       	push   $0x800609
+  800605:	89 e5                	mov    %esp,%ebp
+  800607:	0f 34                	sysenter
+  800609:	83 c4 04             	add    $0x4,%esp
+  80060c:	5d                   	pop    %ebp
+  80060d:	eb c2                	jmp    8005d1 <sys_page_reuse+0x2e>
+
+0080060f <sys_env_set_status>:
+  80060f:	55                   	push   %ebp
+  800610:	89 e5                	mov    %esp,%ebp
+  800612:	57                   	push   %edi
+  800613:	56                   	push   %esi
+  800614:	53                   	push   %ebx
+  800615:	83 ec 0c             	sub    $0xc,%esp
+  800618:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80061f:	78 2b                	js     80064c <sys_env_set_status+0x3d>
+  800621:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800628:	75 37                	jne    800661 <sys_env_set_status+0x52>
+  80062a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80062f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800634:	8b 55 08             	mov    0x8(%ebp),%edx
+  800637:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80063a:	89 df                	mov    %ebx,%edi
+  80063c:	89 de                	mov    %ebx,%esi
+  80063e:	cd 30                	int    $0x30
+  800640:	85 c0                	test   %eax,%eax
+  800642:	7f 41                	jg     800685 <sys_env_set_status+0x76>
+  800644:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800647:	5b                   	pop    %ebx
+  800648:	5e                   	pop    %esi
+  800649:	5f                   	pop    %edi
+  80064a:	5d                   	pop    %ebp
+  80064b:	c3                   	ret
+  80064c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800651:	0f a2                	cpuid
+  800653:	c1 ea 0b             	shr    $0xb,%edx
+  800656:	83 e2 01             	and    $0x1,%edx
+  800659:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80065f:	eb c0                	jmp    800621 <sys_env_set_status+0x12>
+  800661:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800666:	8b 55 08             	mov    0x8(%ebp),%edx
+  800669:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80066c:	b8 08 00 00 00       	mov    $0x8,%eax
+  800671:	89 df                	mov    %ebx,%edi
+  800673:	89 de                	mov    %ebx,%esi
+  800675:	55                   	push   %ebp
+  800676:	68 7f 06 80 00       	push   $0x80067f
+  80067b:	89 e5                	mov    %esp,%ebp
+  80067d:	0f 34                	sysenter
+  80067f:	83 c4 04             	add    $0x4,%esp
+  800682:	5d                   	pop    %ebp
+  800683:	eb bb                	jmp    800640 <sys_env_set_status+0x31>
+  800685:	83 ec 0c             	sub    $0xc,%esp
+  800688:	50                   	push   %eax
+  800689:	6a 08                	push   $0x8
+  80068b:	68 2a 1a 80 00       	push   $0x801a2a
+  800690:	6a 49                	push   $0x49
+  800692:	68 47 1a 80 00       	push   $0x801a47
+  800697:	e8 49 05 00 00       	call   800be5 <_panic>
+
+0080069c <sys_env_set_pgfault_upcall>:
+  80069c:	55                   	push   %ebp
+  80069d:	89 e5                	mov    %esp,%ebp
+  80069f:	57                   	push   %edi
+  8006a0:	56                   	push   %esi
+  8006a1:	53                   	push   %ebx
+  8006a2:	83 ec 0c             	sub    $0xc,%esp
+  8006a5:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8006ac:	78 2b                	js     8006d9 <sys_env_set_pgfault_upcall+0x3d>
+  8006ae:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8006b5:	75 37                	jne    8006ee <sys_env_set_pgfault_upcall+0x52>
+  8006b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006bc:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006c7:	89 df                	mov    %ebx,%edi
+  8006c9:	89 de                	mov    %ebx,%esi
+  8006cb:	cd 30                	int    $0x30
+  8006cd:	85 c0                	test   %eax,%eax
+  8006cf:	7f 41                	jg     800712 <sys_env_set_pgfault_upcall+0x76>
+  8006d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006d4:	5b                   	pop    %ebx
+  8006d5:	5e                   	pop    %esi
+  8006d6:	5f                   	pop    %edi
+  8006d7:	5d                   	pop    %ebp
+  8006d8:	c3                   	ret
+  8006d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006de:	0f a2                	cpuid
+  8006e0:	c1 ea 0b             	shr    $0xb,%edx
+  8006e3:	83 e2 01             	and    $0x1,%edx
+  8006e6:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8006ec:	eb c0                	jmp    8006ae <sys_env_set_pgfault_upcall+0x12>
+  8006ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006f9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006fe:	89 df                	mov    %ebx,%edi
+  800700:	89 de                	mov    %ebx,%esi
+  800702:	55                   	push   %ebp
+  800703:	68 0c 07 80 00       	push   $0x80070c
+  800708:	89 e5                	mov    %esp,%ebp
+  80070a:	0f 34                	sysenter
+  80070c:	83 c4 04             	add    $0x4,%esp
+  80070f:	5d                   	pop    %ebp
+  800710:	eb bb                	jmp    8006cd <sys_env_set_pgfault_upcall+0x31>
+  800712:	83 ec 0c             	sub    $0xc,%esp
+  800715:	50                   	push   %eax
+  800716:	6a 09                	push   $0x9
+  800718:	68 2a 1a 80 00       	push   $0x801a2a
+  80071d:	6a 49                	push   $0x49
+  80071f:	68 47 1a 80 00       	push   $0x801a47
+  800724:	e8 bc 04 00 00       	call   800be5 <_panic>
+
+00800729 <sys_env_set_trace>:
+  800729:	55                   	push   %ebp
+  80072a:	89 e5                	mov    %esp,%ebp
+  80072c:	57                   	push   %edi
+  80072d:	56                   	push   %esi
+  80072e:	53                   	push   %ebx
+  80072f:	83 ec 0c             	sub    $0xc,%esp
+  800732:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800739:	78 2b                	js     800766 <sys_env_set_trace+0x3d>
+  80073b:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800742:	75 37                	jne    80077b <sys_env_set_trace+0x52>
+  800744:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800749:	b8 12 00 00 00       	mov    $0x12,%eax
+  80074e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800751:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800754:	89 df                	mov    %ebx,%edi
+  800756:	89 de                	mov    %ebx,%esi
+  800758:	cd 30                	int    $0x30
+  80075a:	85 c0                	test   %eax,%eax
+  80075c:	7f 41                	jg     80079f <sys_env_set_trace+0x76>
+  80075e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800761:	5b                   	pop    %ebx
+  800762:	5e                   	pop    %esi
+  800763:	5f                   	pop    %edi
+  800764:	5d                   	pop    %ebp
+  800765:	c3                   	ret
+  800766:	b8 01 00 00 00       	mov    $0x1,%eax
+  80076b:	0f a2                	cpuid
+  80076d:	c1 ea 0b             	shr    $0xb,%edx
+  800770:	83 e2 01             	and    $0x1,%edx
+  800773:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800779:	eb c0                	jmp    80073b <sys_env_set_trace+0x12>
+  80077b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800780:	8b 55 08             	mov    0x8(%ebp),%edx
+  800783:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800786:	b8 12 00 00 00       	mov    $0x12,%eax
+  80078b:	89 df                	mov    %ebx,%edi
+  80078d:	89 de                	mov    %ebx,%esi
+  80078f:	55                   	push   %ebp
+  800790:	68 99 07 80 00       	push   $0x800799
+  800795:	89 e5                	mov    %esp,%ebp
+  800797:	0f 34                	sysenter
+  800799:	83 c4 04             	add    $0x4,%esp
+  80079c:	5d                   	pop    %ebp
+  80079d:	eb bb                	jmp    80075a <sys_env_set_trace+0x31>
+  80079f:	83 ec 0c             	sub    $0xc,%esp
+  8007a2:	50                   	push   %eax
+  8007a3:	6a 12                	push   $0x12
+  8007a5:	68 2a 1a 80 00       	push   $0x801a2a
+  8007aa:	6a 49                	push   $0x49
+  8007ac:	68 47 1a 80 00       	push   $0x801a47
+  8007b1:	e8 2f 04 00 00       	call   800be5 <_panic>
+
+008007b6 <sys_env_set_rdpmc>:
+  8007b6:	55                   	push   %ebp
+  8007b7:	89 e5                	mov    %esp,%ebp
+  8007b9:	57                   	push   %edi
+  8007ba:	56                   	push   %esi
+  8007bb:	53                   	push   %ebx
+  8007bc:	83 ec 0c             	sub    $0xc,%esp
+  8007bf:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007c6:	78 2b                	js     8007f3 <sys_env_set_rdpmc+0x3d>
+  8007c8:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007cf:	75 37                	jne    800808 <sys_env_set_rdpmc+0x52>
+  8007d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007d6:	b8 13 00 00 00       	mov    $0x13,%eax
+  8007db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007e1:	89 df                	mov    %ebx,%edi
+  8007e3:	89 de                	mov    %ebx,%esi
+  8007e5:	cd 30                	int    $0x30
+  8007e7:	85 c0                	test   %eax,%eax
+  8007e9:	7f 41                	jg     80082c <sys_env_set_rdpmc+0x76>
+  8007eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ee:	5b                   	pop    %ebx
+  8007ef:	5e                   	pop    %esi
+  8007f0:	5f                   	pop    %edi
+  8007f1:	5d                   	pop    %ebp
+  8007f2:	c3                   	ret
+  8007f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007f8:	0f a2                	cpuid
+  8007fa:	c1 ea 0b             	shr    $0xb,%edx
+  8007fd:	83 e2 01             	and    $0x1,%edx
+  800800:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800806:	eb c0                	jmp    8007c8 <sys_env_set_rdpmc+0x12>
+  800808:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80080d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800810:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800813:	b8 13 00 00 00       	mov    $0x13,%eax
+  800818:	89 df                	mov    %ebx,%edi
+  80081a:	89 de                	mov    %ebx,%esi
+  80081c:	55                   	push   %ebp
+  80081d:	68 26 08 80 00       	push   $0x800826
+  800822:	89 e5                	mov    %esp,%ebp
+  800824:	0f 34                	sysenter
+  800826:	83 c4 04             	add    $0x4,%esp
+  800829:	5d                   	pop    %ebp
+  80082a:	eb bb                	jmp    8007e7 <sys_env_set_rdpmc+0x31>
+  80082c:	83 ec 0c             	sub    $0xc,%esp
+  80082f:	50                   	push   %eax
+  800830:	6a 13                	push   $0x13
+  800832:	68 2a 1a 80 00       	push   $0x801a2a
+  800837:	6a 49                	push   $0x49
+  800839:	68 47 1a 80 00       	push   $0x801a47
+  80083e:	e8 a2 03 00 00       	call   800be5 <_panic>
+
+00800843 <sys_ring_setup>:
+  800843:	55                   	push   %ebp
+  800844:	89 e5                	mov    %esp,%ebp
+  800846:	57                   	push   %edi
+  800847:	56                   	push   %esi
+  800848:	53                   	push   %ebx
+  800849:	83 ec 0c             	sub    $0xc,%esp
+  80084c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800853:	78 29                	js     80087e <sys_ring_setup+0x3b>
+  800855:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80085c:	75 35                	jne    800893 <sys_ring_setup+0x50>
+  80085e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800863:	b8 10 00 00 00       	mov    $0x10,%eax
+  800868:	89 d1                	mov    %edx,%ecx
+  80086a:	89 d3                	mov    %edx,%ebx
+  80086c:	89 d7                	mov    %edx,%edi
+  80086e:	89 d6                	mov    %edx,%esi
+  800870:	cd 30                	int    $0x30
+  800872:	85 c0                	test   %eax,%eax
+  800874:	7f 3f                	jg     8008b5 <sys_ring_setup+0x72>
+  800876:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800879:	5b                   	pop    %ebx
+  80087a:	5e                   	pop    %esi
+  80087b:	5f                   	pop    %edi
+  80087c:	5d                   	pop    %ebp
+  80087d:	c3                   	ret
+  80087e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800883:	0f a2                	cpuid
+  800885:	c1 ea 0b             	shr    $0xb,%edx
+  800888:	83 e2 01             	and    $0x1,%edx
+  80088b:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800891:	eb c2                	jmp    800855 <sys_ring_setup+0x12>
+  800893:	ba 00 00 00 00       	mov    $0x0,%edx
+  800898:	b8 10 00 00 00       	mov    $0x10,%eax
+  80089d:	89 d1                	mov    %edx,%ecx
+  80089f:	89 d3                	mov    %edx,%ebx
+  8008a1:	89 d7                	mov    %edx,%edi
+  8008a3:	89 d6                	mov    %edx,%esi
+  8008a5:	55                   	push   %ebp
+  8008a6:	68 af 08 80 00       	push   $0x8008af
+  8008ab:	89 e5                	mov    %esp,%ebp
+  8008ad:	0f 34                	sysenter
+  8008af:	83 c4 04             	add    $0x4,%esp
+  8008b2:	5d                   	pop    %ebp
+  8008b3:	eb bd                	jmp    800872 <sys_ring_setup+0x2f>
+  8008b5:	83 ec 0c             	sub    $0xc,%esp
+  8008b8:	50                   	push   %eax
+  8008b9:	6a 10                	push   $0x10
+  8008bb:	68 2a 1a 80 00       	push   $0x801a2a
+  8008c0:	6a 49                	push   $0x49
+  8008c2:	68 47 1a 80 00       	push   $0x801a47
+  8008c7:	e8 19 03 00 00       	call   800be5 <_panic>
+
+008008cc <sys_ring_enter>:
+  8008cc:	55                   	push   %ebp
+  8008cd:	89 e5                	mov    %esp,%ebp
+  8008cf:	57                   	push   %edi
+  8008d0:	56                   	push   %esi
+  8008d1:	53                   	push   %ebx
+  8008d2:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008d9:	78 22                	js     8008fd <sys_ring_enter+0x31>
+  8008db:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008e2:	75 2e                	jne    800912 <sys_ring_enter+0x46>
+  8008e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008e9:	b8 11 00 00 00       	mov    $0x11,%eax
+  8008ee:	89 d1                	mov    %edx,%ecx
+  8008f0:	89 d3                	mov    %edx,%ebx
+  8008f2:	89 d7                	mov    %edx,%edi
+  8008f4:	89 d6                	mov    %edx,%esi
+  8008f6:	cd 30                	int    $0x30
+  8008f8:	5b                   	pop    %ebx
+  8008f9:	5e                   	pop    %esi
+  8008fa:	5f                   	pop    %edi
+  8008fb:	5d                   	pop    %ebp
+  8008fc:	c3                   	ret
+  8008fd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800902:	0f a2                	cpuid
+  800904:	c1 ea 0b             	shr    $0xb,%edx
+  800907:	83 e2 01             	and    $0x1,%edx
+  80090a:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800910:	eb c9                	jmp    8008db <sys_ring_enter+0xf>
+  800912:	ba 00 00 00 00       	mov    $0x0,%edx
+  800917:	b8 11 00 00 00       	mov    $0x11,%eax
+  80091c:	89 d1                	mov    %edx,%ecx
+  80091e:	89 d3                	mov    %edx,%ebx
+  800920:	89 d7                	mov    %edx,%edi
+  800922:	89 d6                	mov    %edx,%esi
+  800924:	55                   	push   %ebp
+  800925:	68 2e 09 80 00       	push   $0x80092e
+  80092a:	89 e5                	mov    %esp,%ebp
+  80092c:	0f 34                	sysenter
+  80092e:	83 c4 04             	add    $0x4,%esp
+  800931:	5d                   	pop    %ebp
+  800932:	eb c4                	jmp    8008f8 <sys_ring_enter+0x2c>
+
+00800934 <sys_ipc_try_send>:
+  800934:	55                   	push   %ebp
+  800935:	89 e5                	mov    %esp,%ebp
+  800937:	57                   	push   %edi
+  800938:	56                   	push   %esi
+  800939:	53                   	push   %ebx
+  80093a:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800941:	78 26                	js     800969 <sys_ipc_try_send+0x35>
+  800943:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80094a:	75 32                	jne    80097e <sys_ipc_try_send+0x4a>
+  80094c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800951:	be 00 00 00 00       	mov    $0x0,%esi
+  800956:	8b 55 08             	mov    0x8(%ebp),%edx
+  800959:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80095c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80095f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800962:	cd 30                	int    $0x30
+  800964:	5b                   	pop    %ebx
+  800965:	5e                   	pop    %esi
+  800966:	5f                   	pop    %edi
+  800967:	5d                   	pop    %ebp
+  800968:	c3                   	ret
+  800969:	b8 01 00 00 00       	mov    $0x1,%eax
+  80096e:	0f a2                	cpuid
+  800970:	c1 ea 0b             	shr    $0xb,%edx
+  800973:	83 e2 01             	and    $0x1,%edx
+  800976:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80097c:	eb c5                	jmp    800943 <sys_ipc_try_send+0xf>
+  80097e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800981:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800984:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800989:	be 00 00 00 00       	mov    $0x0,%esi
+  80098e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800991:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800994:	55                   	push   %ebp
+  800995:	68 9e 09 80 00       	push   $0x80099e
+  80099a:	89 e5                	mov    %esp,%ebp
+  80099c:	0f 34                	sysenter
+  80099e:	83 c4 04             	add    $0x4,%esp
+  8009a1:	5d                   	pop    %ebp
+  8009a2:	eb c0                	jmp    800964 <sys_ipc_try_send+0x30>
+
+008009a4 <sys_ipc_recv>:
+  8009a4:	55                   	push   %ebp
+  8009a5:	89 e5                	mov    %esp,%ebp
+  8009a7:	57                   	push   %edi
+  8009a8:	56                   	push   %esi
+  8009a9:	53                   	push   %ebx
+  8009aa:	83 ec 0c             	sub    $0xc,%esp
+  8009ad:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8009b4:	78 2a                	js     8009e0 <sys_ipc_recv+0x3c>
+  8009b6:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8009bd:	75 36                	jne    8009f5 <sys_ipc_recv+0x51>
+  8009bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009c4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009cc:	89 cb                	mov    %ecx,%ebx
+  8009ce:	89 cf                	mov    %ecx,%edi
+  8009d0:	89 ce                	mov    %ecx,%esi
+  8009d2:	cd 30                	int    $0x30
+  8009d4:	85 c0                	test   %eax,%eax
+  8009d6:	7f 40                	jg     800a18 <sys_ipc_recv+0x74>
+  8009d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009db:	5b                   	pop    %ebx
+  8009dc:	5e                   	pop    %esi
+  8009dd:	5f                   	pop    %edi
+  8009de:	5d                   	pop    %ebp
+  8009df:	c3                   	ret
+  8009e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8009e5:	0f a2                	cpuid
+  8009e7:	c1 ea 0b             	shr    $0xb,%edx
+  8009ea:	83 e2 01             	and    $0x1,%edx
+  8009ed:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8009f3:	eb c1                	jmp    8009b6 <sys_ipc_recv+0x12>
+  8009f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009fd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800a02:	89 cb                	mov    %ecx,%ebx
+  800a04:	89 cf                	mov    %ecx,%edi
+  800a06:	89 ce                	mov    %ecx,%esi
+  800a08:	55                   	push   %ebp
+  800a09:	68 12 0a 80 00       	push   $0x800a12
+  800a0e:	89 e5                	mov    %esp,%ebp
+  800a10:	0f 34                	sysenter
+  800a12:	83 c4 04             	add    $0x4,%esp
+  800a15:	5d                   	pop    %ebp
+  800a16:	eb bc                	jmp    8009d4 <sys_ipc_recv+0x30>
+  800a18:	83 ec 0c             	sub    $0xc,%esp
+  800a1b:	50                   	push   %eax
+  800a1c:	6a 0c                	push   $0xc
+  800a1e:	68 2a 1a 80 00       	push   $0x801a2a
+  800a23:	6a 49                	push   $0x49
+  800a25:	68 47 1a 80 00       	push   $0x801a47
+  800a2a:	e8 b6 01 00 00       	call   800be5 <_panic>
+
+00800a2f <_pgfault_upcall>:
+  800a2f:	54                   	push   %esp
+  800a30:	a1 44 24 80 00       	mov    0x802444,%eax
+  800a35:	ff d0                	call   *%eax
+  800a37:	83 c4 04             	add    $0x4,%esp
+  800a3a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  800a3e:	89 e5                	mov    %esp,%ebp
+  800a40:	8b 64 24 30          	mov    0x30(%esp),%esp
+  800a44:	50                   	push   %eax
+  800a45:	89 ec                	mov    %ebp,%esp
+  800a47:	83 c4 08             	add    $0x8,%esp
+  800a4a:	61                   	popa
+  800a4b:	83 c4 04             	add    $0x4,%esp
+  800a4e:	9d                   	popf
+  800a4f:	5c                   	pop    %esp
+  800a50:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+  800a54:	c3                   	ret
+
+00800a55 <uinfo_envid>:
+  800a55:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  800a5a:	c3                   	ret
+
+00800a5b <uinfo_cpunum>:
+  800a5b:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  800a60:	c3                   	ret
+
+00800a61 <uinfo_ticks>:
+  800a61:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  800a66:	c3                   	ret
+
+00800a67 <uinfo_nsec>:
+  800a67:	55                   	push   %ebp
+  800a68:	89 e5                	mov    %esp,%ebp
+  800a6a:	57                   	push   %edi
+  800a6b:	56                   	push   %esi
+  800a6c:	53                   	push   %ebx
+  800a6d:	83 ec 1c             	sub    $0x1c,%esp
+  800a70:	0f 31                	rdtsc
+  800a72:	89 c6                	mov    %eax,%esi
+  800a74:	89 d7                	mov    %edx,%edi
+  800a76:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  800a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a81:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a86:	85 c9                	test   %ecx,%ecx
+  800a88:	74 5c                	je     800ae6 <uinfo_nsec+0x7f>
+  800a8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a8f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800a92:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800a95:	52                   	push   %edx
+  800a96:	51                   	push   %ecx
+  800a97:	57                   	push   %edi
+  800a98:	56                   	push   %esi
+  800a99:	e8 d2 0d 00 00       	call   801870 <__umoddi3>
+  800a9e:	83 c4 10             	add    $0x10,%esp
+  800aa1:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800aa7:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  800aac:	f7 e3                	mul    %ebx
+  800aae:	01 ca                	add    %ecx,%edx
+  800ab0:	ff 75 e4             	push   -0x1c(%ebp)
+  800ab3:	ff 75 e0             	push   -0x20(%ebp)
+  800ab6:	52                   	push   %edx
+  800ab7:	50                   	push   %eax
+  800ab8:	e8 db 0c 00 00       	call   801798 <__udivdi3>
+  800abd:	83 c4 10             	add    $0x10,%esp
+  800ac0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ac3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ac6:	ff 75 e4             	push   -0x1c(%ebp)
+  800ac9:	ff 75 e0             	push   -0x20(%ebp)
+  800acc:	57                   	push   %edi
+  800acd:	56                   	push   %esi
+  800ace:	e8 c5 0c 00 00       	call   801798 <__udivdi3>
+  800ad3:	83 c4 10             	add    $0x10,%esp
+  800ad6:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800adc:	f7 e3                	mul    %ebx
+  800ade:	01 ca                	add    %ecx,%edx
+  800ae0:	03 45 d8             	add    -0x28(%ebp),%eax
+  800ae3:	13 55 dc             	adc    -0x24(%ebp),%edx
+  800ae6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ae9:	5b                   	pop    %ebx
+  800aea:	5e                   	pop    %esi
+  800aeb:	5f                   	pop    %edi
+  800aec:	5d                   	pop    %ebp
+  800aed:	c3                   	ret
+
+00800aee <bflush>:
+  800aee:	a1 40 20 80 00       	mov    0x802040,%eax
+  800af3:	85 c0                	test   %eax,%eax
+  800af5:	75 01                	jne    800af8 <bflush+0xa>
+  800af7:	c3                   	ret
+  800af8:	55                   	push   %ebp
+  800af9:	89 e5                	mov    %esp,%ebp
+  800afb:	83 ec 10             	sub    $0x10,%esp
+  800afe:	50                   	push   %eax
+  800aff:	68 44 20 80 00       	push   $0x802044
+  800b04:	e8 ae f5 ff ff       	call   8000b7 <sys_cputs>
+  800b09:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  800b10:	00 00 00 
+  800b13:	83 c4 10             	add    $0x10,%esp
+  800b16:	c9                   	leave
+  800b17:	c3                   	ret
+
+00800b18 <bputch>:
+  800b18:	55                   	push   %ebp
+  800b19:	89 e5                	mov    %esp,%ebp
+  800b1b:	53                   	push   %ebx
+  800b1c:	83 ec 04             	sub    $0x4,%esp
+  800b1f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b22:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  800b28:	8d 42 01             	lea    0x1(%edx),%eax
+  800b2b:	a3 40 20 80 00       	mov    %eax,0x802040
+  800b30:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b33:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  800b39:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b3e:	77 08                	ja     800b48 <bputch+0x30>
+  800b40:	83 03 01             	addl   $0x1,(%ebx)
+  800b43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b46:	c9                   	leave
+  800b47:	c3                   	ret
+  800b48:	e8 a1 ff ff ff       	call   800aee <bflush>
+  800b4d:	eb f1                	jmp    800b40 <bputch+0x28>
+
+00800b4f <vbprintf>:
+  800b4f:	55                   	push   %ebp
+  800b50:	89 e5                	mov    %esp,%ebp
+  800b52:	83 ec 18             	sub    $0x18,%esp
+  800b55:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800b5c:	ff 75 0c             	push   0xc(%ebp)
+  800b5f:	ff 75 08             	push   0x8(%ebp)
+  800b62:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b65:	50                   	push   %eax
+  800b66:	68 18 0b 80 00       	push   $0x800b18
+  800b6b:	e8 4c 02 00 00       	call   800dbc <vprintfmt>
+  800b70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b73:	c9                   	leave
+  800b74:	c3                   	ret
+
+00800b75 <bprintf>:
+  800b75:	55                   	push   %ebp
+  800b76:	89 e5                	mov    %esp,%ebp
+  800b78:	83 ec 10             	sub    $0x10,%esp
+  800b7b:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800b7e:	50                   	push   %eax
+  800b7f:	ff 75 08             	push   0x8(%ebp)
+  800b82:	e8 c8 ff ff ff       	call   800b4f <vbprintf>
+  800b87:	c9                   	leave
+  800b88:	c3                   	ret
+
+00800b89 <bwrite>:
+  800b89:	55                   	push   %ebp
+  800b8a:	89 e5                	mov    %esp,%ebp
+  800b8c:	53                   	push   %ebx
+  800b8d:	83 ec 04             	sub    $0x4,%esp
+  800b90:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b93:	89 d8                	mov    %ebx,%eax
+  800b95:	03 05 40 20 80 00    	add    0x802040,%eax
+  800b9b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800ba0:	76 0d                	jbe    800baf <bwrite+0x26>
+  800ba2:	e8 47 ff ff ff       	call   800aee <bflush>
+  800ba7:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  800bad:	77 25                	ja     800bd4 <bwrite+0x4b>
+  800baf:	83 ec 04             	sub    $0x4,%esp
+  800bb2:	53                   	push   %ebx
+  800bb3:	ff 75 08             	push   0x8(%ebp)
+  800bb6:	a1 40 20 80 00       	mov    0x802040,%eax
+  800bbb:	05 44 20 80 00       	add    $0x802044,%eax
+  800bc0:	50                   	push   %eax
+  800bc1:	e8 61 09 00 00       	call   801527 <memcpy>
+  800bc6:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  800bcc:	83 c4 10             	add    $0x10,%esp
+  800bcf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bd2:	c9                   	leave
+  800bd3:	c3                   	ret
+  800bd4:	83 ec 08             	sub    $0x8,%esp
+  800bd7:	53                   	push   %ebx
+  800bd8:	ff 75 08             	push   0x8(%ebp)
+  800bdb:	e8 d7 f4 ff ff       	call   8000b7 <sys_cputs>
+  800be0:	83 c4 10             	add    $0x10,%esp
+  800be3:	eb ea                	jmp    800bcf <bwrite+0x46>
+
+00800be5 <_panic>:
+  800be5:	55                   	push   %ebp
+  800be6:	89 e5                	mov    %esp,%ebp
+  800be8:	56                   	push   %esi
+  800be9:	53                   	push   %ebx
+  800bea:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800bed:	e8 fc fe ff ff       	call   800aee <bflush>
+  800bf2:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  800bf8:	e8 13 f6 ff ff       	call   800210 <sys_getenvid>
+  800bfd:	83 ec 0c             	sub    $0xc,%esp
+  800c00:	ff 75 0c             	push   0xc(%ebp)
+  800c03:	ff 75 08             	push   0x8(%ebp)
+  800c06:	56                   	push   %esi
+  800c07:	50                   	push   %eax
+  800c08:	68 58 1a 80 00       	push   $0x801a58
+  800c0d:	e8 b3 00 00 00       	call   800cc5 <cprintf>
+  800c12:	83 c4 18             	add    $0x18,%esp
+  800c15:	53                   	push   %ebx
+  800c16:	ff 75 10             	push   0x10(%ebp)
+  800c19:	e8 56 00 00 00       	call   800c74 <vcprintf>
+  800c1e:	c7 04 24 7b 1a 80 00 	movl   $0x801a7b,(%esp)
+  800c25:	e8 9b 00 00 00       	call   800cc5 <cprintf>
+  800c2a:	83 c4 10             	add    $0x10,%esp
+  800c2d:	cc                   	int3
+  800c2e:	eb fd                	jmp    800c2d <_panic+0x48>
+
+00800c30 <putch>:
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	53                   	push   %ebx
+  800c34:	83 ec 04             	sub    $0x4,%esp
+  800c37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c3a:	8b 13                	mov    (%ebx),%edx
+  800c3c:	8d 42 01             	lea    0x1(%edx),%eax
+  800c3f:	89 03                	mov    %eax,(%ebx)
+  800c41:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c44:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800c48:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800c4d:	74 09                	je     800c58 <putch+0x28>
+  800c4f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800c53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c56:	c9                   	leave
+  800c57:	c3                   	ret
+  800c58:	83 ec 08             	sub    $0x8,%esp
+  800c5b:	68 ff 00 00 00       	push   $0xff
+  800c60:	8d 43 08             	lea    0x8(%ebx),%eax
+  800c63:	50                   	push   %eax
+  800c64:	e8 4e f4 ff ff       	call   8000b7 <sys_cputs>
+  800c69:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800c6f:	83 c4 10             	add    $0x10,%esp
+  800c72:	eb db                	jmp    800c4f <putch+0x1f>
+
+00800c74 <vcprintf>:
+  800c74:	55                   	push   %ebp
+  800c75:	89 e5                	mov    %esp,%ebp
+  800c77:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800c7d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800c84:	00 00 00 
+  800c87:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800c8e:	00 00 00 
+  800c91:	ff 75 0c             	push   0xc(%ebp)
+  800c94:	ff 75 08             	push   0x8(%ebp)
+  800c97:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800c9d:	50                   	push   %eax
+  800c9e:	68 30 0c 80 00       	push   $0x800c30
+  800ca3:	e8 14 01 00 00       	call   800dbc <vprintfmt>
+  800ca8:	83 c4 08             	add    $0x8,%esp
+  800cab:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800cb1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800cb7:	50                   	push   %eax
+  800cb8:	e8 fa f3 ff ff       	call   8000b7 <sys_cputs>
+  800cbd:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800cc3:	c9                   	leave
+  800cc4:	c3                   	ret
+
+00800cc5 <cprintf>:
+  800cc5:	55                   	push   %ebp
+  800cc6:	89 e5                	mov    %esp,%ebp
+  800cc8:	83 ec 10             	sub    $0x10,%esp
+  800ccb:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800cce:	50                   	push   %eax
+  800ccf:	ff 75 08             	push   0x8(%ebp)
+  800cd2:	e8 9d ff ff ff       	call   800c74 <vcprintf>
+  800cd7:	c9                   	leave
+  800cd8:	c3                   	ret
+
+00800cd9 <printnum>:
+  800cd9:	55                   	push   %ebp
+  800cda:	89 e5                	mov    %esp,%ebp
+  800cdc:	57                   	push   %edi
+  800cdd:	56                   	push   %esi
+  800cde:	53                   	push   %ebx
+  800cdf:	83 ec 1c             	sub    $0x1c,%esp
+  800ce2:	89 c7                	mov    %eax,%edi
+  800ce4:	89 d6                	mov    %edx,%esi
+  800ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cec:	89 d1                	mov    %edx,%ecx
+  800cee:	89 c2                	mov    %eax,%edx
+  800cf0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cf3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800cf6:	8b 45 10             	mov    0x10(%ebp),%eax
+  800cf9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800cfc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800cff:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800d06:	39 c2                	cmp    %eax,%edx
+  800d08:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800d0b:	72 3e                	jb     800d4b <printnum+0x72>
+  800d0d:	83 ec 0c             	sub    $0xc,%esp
+  800d10:	ff 75 18             	push   0x18(%ebp)
+  800d13:	83 eb 01             	sub    $0x1,%ebx
+  800d16:	53                   	push   %ebx
+  800d17:	50                   	push   %eax
+  800d18:	83 ec 08             	sub    $0x8,%esp
+  800d1b:	ff 75 e4             	push   -0x1c(%ebp)
+  800d1e:	ff 75 e0             	push   -0x20(%ebp)
+  800d21:	ff 75 dc             	push   -0x24(%ebp)
+  800d24:	ff 75 d8             	push   -0x28(%ebp)
+  800d27:	e8 6c 0a 00 00       	call   801798 <__udivdi3>
+  800d2c:	83 c4 18             	add    $0x18,%esp
+  800d2f:	52                   	push   %edx
+  800d30:	50                   	push   %eax
+  800d31:	89 f2                	mov    %esi,%edx
+  800d33:	89 f8                	mov    %edi,%eax
+  800d35:	e8 9f ff ff ff       	call   800cd9 <printnum>
+  800d3a:	83 c4 20             	add    $0x20,%esp
+  800d3d:	eb 13                	jmp    800d52 <printnum+0x79>
+  800d3f:	83 ec 08             	sub    $0x8,%esp
+  800d42:	56                   	push   %esi
+  800d43:	ff 75 18             	push   0x18(%ebp)
+  800d46:	ff d7                	call   *%edi
+  800d48:	83 c4 10             	add    $0x10,%esp
+  800d4b:	83 eb 01             	sub    $0x1,%ebx
+  800d4e:	85 db                	test   %ebx,%ebx
+  800d50:	7f ed                	jg     800d3f <printnum+0x66>
+  800d52:	83 ec 08             	sub    $0x8,%esp
+  800d55:	56                   	push   %esi
+  800d56:	83 ec 04             	sub    $0x4,%esp
+  800d59:	ff 75 e4             	push   -0x1c(%ebp)
+  800d5c:	ff 75 e0             	push   -0x20(%ebp)
+  800d5f:	ff 75 dc             	push   -0x24(%ebp)
+  800d62:	ff 75 d8             	push   -0x28(%ebp)
+  800d65:	e8 06 0b 00 00       	call   801870 <__umoddi3>
+  800d6a:	83 c4 14             	add    $0x14,%esp
+  800d6d:	0f be 80 7d 1a 80 00 	movsbl 0x801a7d(%eax),%eax
+  800d74:	50                   	push   %eax
+  800d75:	ff d7                	call   *%edi
+  800d77:	83 c4 10             	add    $0x10,%esp
+  800d7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d7d:	5b                   	pop    %ebx
+  800d7e:	5e                   	pop    %esi
+  800d7f:	5f                   	pop    %edi
+  800d80:	5d                   	pop    %ebp
+  800d81:	c3                   	ret
+
+00800d82 <sprintputch>:
+  800d82:	55                   	push   %ebp
+  800d83:	89 e5                	mov    %esp,%ebp
+  800d85:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d88:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800d8c:	8b 10                	mov    (%eax),%edx
+  800d8e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800d91:	73 0a                	jae    800d9d <sprintputch+0x1b>
+  800d93:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800d96:	89 08                	mov    %ecx,(%eax)
+  800d98:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d9b:	88 02                	mov    %al,(%edx)
+  800d9d:	5d                   	pop    %ebp
+  800d9e:	c3                   	ret
+
+00800d9f <printfmt>:
+  800d9f:	55                   	push   %ebp
+  800da0:	89 e5                	mov    %esp,%ebp
+  800da2:	83 ec 08             	sub    $0x8,%esp
+  800da5:	8d 45 14             	lea    0x14(%ebp),%eax
+  800da8:	50                   	push   %eax
+  800da9:	ff 75 10             	push   0x10(%ebp)
+  800dac:	ff 75 0c             	push   0xc(%ebp)
+  800daf:	ff 75 08             	push   0x8(%ebp)
+  800db2:	e8 05 00 00 00       	call   800dbc <vprintfmt>
+  800db7:	83 c4 10             	add    $0x10,%esp
+  800dba:	c9                   	leave
+  800dbb:	c3                   	ret
+
+00800dbc <vprintfmt>:
+  800dbc:	55                   	push   %ebp
+  800dbd:	89 e5                	mov    %esp,%ebp
+  800dbf:	57                   	push   %edi
+  800dc0:	56                   	push   %esi
+  800dc1:	53                   	push   %ebx
+  800dc2:	83 ec 2c             	sub    $0x2c,%esp
+  800dc5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dc8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800dcb:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800dce:	eb 0a                	jmp    800dda <vprintfmt+0x1e>
+  800dd0:	83 ec 08             	sub    $0x8,%esp
+  800dd3:	53                   	push   %ebx
+  800dd4:	50                   	push   %eax
+  800dd5:	ff d6                	call   *%esi
+  800dd7:	83 c4 10             	add    $0x10,%esp
+  800dda:	83 c7 01             	add    $0x1,%edi
+  800ddd:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800de1:	83 f8 25             	cmp    $0x25,%eax
+  800de4:	74 0c                	je     800df2 <vprintfmt+0x36>
+  800de6:	85 c0                	test   %eax,%eax
+  800de8:	75 e6                	jne    800dd0 <vprintfmt+0x14>
+  800dea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ded:	5b                   	pop    %ebx
+  800dee:	5e                   	pop    %esi
+  800def:	5f                   	pop    %edi
+  800df0:	5d                   	pop    %ebp
+  800df1:	c3                   	ret
+  800df2:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800df6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800dfd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800e04:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800e0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e10:	8d 47 01             	lea    0x1(%edi),%eax
+  800e13:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800e16:	0f b6 17             	movzbl (%edi),%edx
+  800e19:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800e1c:	3c 55                	cmp    $0x55,%al
+  800e1e:	0f 87 cf 03 00 00    	ja     8011f3 <vprintfmt+0x437>
+  800e24:	0f b6 c0             	movzbl %al,%eax
+  800e27:	ff 24 85 40 1b 80 00 	jmp    *0x801b40(,%eax,4)
+  800e2e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e31:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800e35:	eb d9                	jmp    800e10 <vprintfmt+0x54>
+  800e37:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e3a:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800e3e:	eb d0                	jmp    800e10 <vprintfmt+0x54>
+  800e40:	0f b6 d2             	movzbl %dl,%edx
+  800e43:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e4e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800e51:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800e55:	0f be 17             	movsbl (%edi),%edx
+  800e58:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800e5b:	83 f9 09             	cmp    $0x9,%ecx
+  800e5e:	77 55                	ja     800eb5 <vprintfmt+0xf9>
+  800e60:	83 c7 01             	add    $0x1,%edi
+  800e63:	eb e9                	jmp    800e4e <vprintfmt+0x92>
+  800e65:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e68:	8b 00                	mov    (%eax),%eax
+  800e6a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e6d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e70:	8d 40 04             	lea    0x4(%eax),%eax
+  800e73:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e76:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e79:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800e7d:	79 91                	jns    800e10 <vprintfmt+0x54>
+  800e7f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800e82:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e85:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800e8c:	eb 82                	jmp    800e10 <vprintfmt+0x54>
+  800e8e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e91:	85 d2                	test   %edx,%edx
+  800e93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e98:	0f 49 c2             	cmovns %edx,%eax
+  800e9b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e9e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800ea1:	e9 6a ff ff ff       	jmp    800e10 <vprintfmt+0x54>
+  800ea6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800ea9:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800eb0:	e9 5b ff ff ff       	jmp    800e10 <vprintfmt+0x54>
+  800eb5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800eb8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800ebb:	eb bc                	jmp    800e79 <vprintfmt+0xbd>
+  800ebd:	83 c1 01             	add    $0x1,%ecx
+  800ec0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800ec3:	e9 48 ff ff ff       	jmp    800e10 <vprintfmt+0x54>
+  800ec8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ecb:	8d 78 04             	lea    0x4(%eax),%edi
+  800ece:	83 ec 08             	sub    $0x8,%esp
+  800ed1:	53                   	push   %ebx
+  800ed2:	ff 30                	push   (%eax)
+  800ed4:	ff d6                	call   *%esi
+  800ed6:	83 c4 10             	add    $0x10,%esp
+  800ed9:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800edc:	e9 b1 02 00 00       	jmp    801192 <vprintfmt+0x3d6>
+  800ee1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ee4:	8d 78 04             	lea    0x4(%eax),%edi
+  800ee7:	8b 10                	mov    (%eax),%edx
+  800ee9:	89 d0                	mov    %edx,%eax
+  800eeb:	f7 d8                	neg    %eax
+  800eed:	0f 48 c2             	cmovs  %edx,%eax
+  800ef0:	83 f8 08             	cmp    $0x8,%eax
+  800ef3:	7f 23                	jg     800f18 <vprintfmt+0x15c>
+  800ef5:	8b 14 85 a0 1c 80 00 	mov    0x801ca0(,%eax,4),%edx
+  800efc:	85 d2                	test   %edx,%edx
+  800efe:	74 18                	je     800f18 <vprintfmt+0x15c>
+  800f00:	52                   	push   %edx
+  800f01:	68 9e 1a 80 00       	push   $0x801a9e
+  800f06:	53                   	push   %ebx
+  800f07:	56                   	push   %esi
+  800f08:	e8 92 fe ff ff       	call   800d9f <printfmt>
+  800f0d:	83 c4 10             	add    $0x10,%esp
+  800f10:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800f13:	e9 7a 02 00 00       	jmp    801192 <vprintfmt+0x3d6>
+  800f18:	50                   	push   %eax
+  800f19:	68 95 1a 80 00       	push   $0x801a95
+  800f1e:	53                   	push   %ebx
+  800f1f:	56                   	push   %esi
+  800f20:	e8 7a fe ff ff       	call   800d9f <printfmt>
+  800f25:	83 c4 10             	add    $0x10,%esp
+  800f28:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800f2b:	e9 62 02 00 00       	jmp    801192 <vprintfmt+0x3d6>
+  800f30:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f33:	83 c0 04             	add    $0x4,%eax
+  800f36:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800f39:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f3c:	8b 08                	mov    (%eax),%ecx
+  800f3e:	85 c9                	test   %ecx,%ecx
+  800f40:	b8 8e 1a 80 00       	mov    $0x801a8e,%eax
+  800f45:	0f 45 c1             	cmovne %ecx,%eax
+  800f48:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800f4b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800f4f:	7e 06                	jle    800f57 <vprintfmt+0x19b>
+  800f51:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800f55:	75 0b                	jne    800f62 <vprintfmt+0x1a6>
+  800f57:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800f5a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800f5d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f60:	eb 5c                	jmp    800fbe <vprintfmt+0x202>
+  800f62:	83 ec 08             	sub    $0x8,%esp
+  800f65:	ff 75 d0             	push   -0x30(%ebp)
+  800f68:	ff 75 cc             	push   -0x34(%ebp)
+  800f6b:	e8 87 03 00 00       	call   8012f7 <strnlen>
+  800f70:	89 c2                	mov    %eax,%edx
+  800f72:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f75:	29 d0                	sub    %edx,%eax
+  800f77:	83 c4 10             	add    $0x10,%esp
+  800f7a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800f7e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f81:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f84:	89 c6                	mov    %eax,%esi
+  800f86:	eb 0e                	jmp    800f96 <vprintfmt+0x1da>
+  800f88:	83 ec 08             	sub    $0x8,%esp
+  800f8b:	53                   	push   %ebx
+  800f8c:	57                   	push   %edi
+  800f8d:	ff 55 08             	call   *0x8(%ebp)
+  800f90:	83 ee 01             	sub    $0x1,%esi
+  800f93:	83 c4 10             	add    $0x10,%esp
+  800f96:	85 f6                	test   %esi,%esi
+  800f98:	7f ee                	jg     800f88 <vprintfmt+0x1cc>
+  800f9a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f9d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fa0:	85 c0                	test   %eax,%eax
+  800fa2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa7:	0f 49 d0             	cmovns %eax,%edx
+  800faa:	29 d0                	sub    %edx,%eax
+  800fac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800faf:	eb a6                	jmp    800f57 <vprintfmt+0x19b>
+  800fb1:	83 ec 08             	sub    $0x8,%esp
+  800fb4:	53                   	push   %ebx
+  800fb5:	52                   	push   %edx
+  800fb6:	ff 55 08             	call   *0x8(%ebp)
+  800fb9:	83 c4 10             	add    $0x10,%esp
+  800fbc:	89 f1                	mov    %esi,%ecx
+  800fbe:	8d 71 01             	lea    0x1(%ecx),%esi
+  800fc1:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800fc5:	0f be d0             	movsbl %al,%edx
+  800fc8:	85 d2                	test   %edx,%edx
+  800fca:	74 28                	je     800ff4 <vprintfmt+0x238>
+  800fcc:	85 ff                	test   %edi,%edi
+  800fce:	78 05                	js     800fd5 <vprintfmt+0x219>
+  800fd0:	83 ef 01             	sub    $0x1,%edi
+  800fd3:	78 30                	js     801005 <vprintfmt+0x249>
+  800fd5:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800fd9:	74 d6                	je     800fb1 <vprintfmt+0x1f5>
+  800fdb:	0f be c0             	movsbl %al,%eax
+  800fde:	83 e8 20             	sub    $0x20,%eax
+  800fe1:	83 f8 5e             	cmp    $0x5e,%eax
+  800fe4:	76 cb                	jbe    800fb1 <vprintfmt+0x1f5>
+  800fe6:	83 ec 08             	sub    $0x8,%esp
+  800fe9:	53                   	push   %ebx
+  800fea:	6a 3f                	push   $0x3f
+  800fec:	ff 55 08             	call   *0x8(%ebp)
+  800fef:	83 c4 10             	add    $0x10,%esp
+  800ff2:	eb c8                	jmp    800fbc <vprintfmt+0x200>
+  800ff4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ff7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800ffa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800ffd:	01 d0                	add    %edx,%eax
+  800fff:	29 c8                	sub    %ecx,%eax
+  801001:	89 c7                	mov    %eax,%edi
+  801003:	eb 13                	jmp    801018 <vprintfmt+0x25c>
+  801005:	8b 75 08             	mov    0x8(%ebp),%esi
+  801008:	eb ed                	jmp    800ff7 <vprintfmt+0x23b>
+  80100a:	83 ec 08             	sub    $0x8,%esp
+  80100d:	53                   	push   %ebx
+  80100e:	6a 20                	push   $0x20
+  801010:	ff d6                	call   *%esi
+  801012:	83 ef 01             	sub    $0x1,%edi
+  801015:	83 c4 10             	add    $0x10,%esp
+  801018:	85 ff                	test   %edi,%edi
+  80101a:	7f ee                	jg     80100a <vprintfmt+0x24e>
+  80101c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80101f:	89 45 14             	mov    %eax,0x14(%ebp)
+  801022:	e9 6b 01 00 00       	jmp    801192 <vprintfmt+0x3d6>
+  801027:	83 f9 01             	cmp    $0x1,%ecx
+  80102a:	7f 1f                	jg     80104b <vprintfmt+0x28f>
+  80102c:	85 c9                	test   %ecx,%ecx
+  80102e:	74 67                	je     801097 <vprintfmt+0x2db>
+  801030:	8b 45 14             	mov    0x14(%ebp),%eax
+  801033:	8b 00                	mov    (%eax),%eax
+  801035:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801038:	89 c1                	mov    %eax,%ecx
+  80103a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80103d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801040:	8b 45 14             	mov    0x14(%ebp),%eax
+  801043:	8d 40 04             	lea    0x4(%eax),%eax
+  801046:	89 45 14             	mov    %eax,0x14(%ebp)
+  801049:	eb 17                	jmp    801062 <vprintfmt+0x2a6>
+  80104b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80104e:	8b 50 04             	mov    0x4(%eax),%edx
+  801051:	8b 00                	mov    (%eax),%eax
+  801053:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801056:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801059:	8b 45 14             	mov    0x14(%ebp),%eax
+  80105c:	8d 40 08             	lea    0x8(%eax),%eax
+  80105f:	89 45 14             	mov    %eax,0x14(%ebp)
+  801062:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801065:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801068:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80106d:	85 c9                	test   %ecx,%ecx
+  80106f:	0f 89 03 01 00 00    	jns    801178 <vprintfmt+0x3bc>
+  801075:	83 ec 08             	sub    $0x8,%esp
+  801078:	53                   	push   %ebx
+  801079:	6a 2d                	push   $0x2d
+  80107b:	ff d6                	call   *%esi
+  80107d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801080:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801083:	f7 da                	neg    %edx
+  801085:	83 d1 00             	adc    $0x0,%ecx
+  801088:	f7 d9                	neg    %ecx
+  80108a:	83 c4 10             	add    $0x10,%esp
+  80108d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801092:	e9 e1 00 00 00       	jmp    801178 <vprintfmt+0x3bc>
+  801097:	8b 45 14             	mov    0x14(%ebp),%eax
+  80109a:	8b 00                	mov    (%eax),%eax
+  80109c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80109f:	89 c1                	mov    %eax,%ecx
+  8010a1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8010a4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8010a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8010ad:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010b0:	eb b0                	jmp    801062 <vprintfmt+0x2a6>
+  8010b2:	83 f9 01             	cmp    $0x1,%ecx
+  8010b5:	7f 1e                	jg     8010d5 <vprintfmt+0x319>
+  8010b7:	85 c9                	test   %ecx,%ecx
+  8010b9:	74 32                	je     8010ed <vprintfmt+0x331>
+  8010bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010be:	8b 10                	mov    (%eax),%edx
+  8010c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8010c8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010d0:	e9 a3 00 00 00       	jmp    801178 <vprintfmt+0x3bc>
+  8010d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010d8:	8b 10                	mov    (%eax),%edx
+  8010da:	8b 48 04             	mov    0x4(%eax),%ecx
+  8010dd:	8d 40 08             	lea    0x8(%eax),%eax
+  8010e0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010e3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010e8:	e9 8b 00 00 00       	jmp    801178 <vprintfmt+0x3bc>
+  8010ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010f0:	8b 10                	mov    (%eax),%edx
+  8010f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8010fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010fd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801102:	eb 74                	jmp    801178 <vprintfmt+0x3bc>
+  801104:	83 f9 01             	cmp    $0x1,%ecx
+  801107:	7f 1b                	jg     801124 <vprintfmt+0x368>
+  801109:	85 c9                	test   %ecx,%ecx
+  80110b:	74 2c                	je     801139 <vprintfmt+0x37d>
+  80110d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801110:	8b 10                	mov    (%eax),%edx
+  801112:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801117:	8d 40 04             	lea    0x4(%eax),%eax
+  80111a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80111d:	bf 08 00 00 00       	mov    $0x8,%edi
+  801122:	eb 54                	jmp    801178 <vprintfmt+0x3bc>
+  801124:	8b 45 14             	mov    0x14(%ebp),%eax
+  801127:	8b 10                	mov    (%eax),%edx
+  801129:	8b 48 04             	mov    0x4(%eax),%ecx
+  80112c:	8d 40 08             	lea    0x8(%eax),%eax
+  80112f:	89 45 14             	mov    %eax,0x14(%ebp)
+  801132:	bf 08 00 00 00       	mov    $0x8,%edi
+  801137:	eb 3f                	jmp    801178 <vprintfmt+0x3bc>
+  801139:	8b 45 14             	mov    0x14(%ebp),%eax
+  80113c:	8b 10                	mov    (%eax),%edx
+  80113e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801143:	8d 40 04             	lea    0x4(%eax),%eax
+  801146:	89 45 14             	mov    %eax,0x14(%ebp)
+  801149:	bf 08 00 00 00       	mov    $0x8,%edi
+  80114e:	eb 28                	jmp    801178 <vprintfmt+0x3bc>
+  801150:	83 ec 08             	sub    $0x8,%esp
+  801153:	53                   	push   %ebx
+  801154:	6a 30                	push   $0x30
+  801156:	ff d6                	call   *%esi
+  801158:	83 c4 08             	add    $0x8,%esp
+  80115b:	53                   	push   %ebx
+  80115c:	6a 78                	push   $0x78
+  80115e:	ff d6                	call   *%esi
+  801160:	8b 45 14             	mov    0x14(%ebp),%eax
+  801163:	8b 10                	mov    (%eax),%edx
+  801165:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80116a:	83 c4 10             	add    $0x10,%esp
+  80116d:	8d 40 04             	lea    0x4(%eax),%eax
+  801170:	89 45 14             	mov    %eax,0x14(%ebp)
+  801173:	bf 10 00 00 00       	mov    $0x10,%edi
+  801178:	83 ec 0c             	sub    $0xc,%esp
+  80117b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80117f:	50                   	push   %eax
+  801180:	ff 75 e0             	push   -0x20(%ebp)
+  801183:	57                   	push   %edi
+  801184:	51                   	push   %ecx
+  801185:	52                   	push   %edx
+  801186:	89 da                	mov    %ebx,%edx
+  801188:	89 f0                	mov    %esi,%eax
+  80118a:	e8 4a fb ff ff       	call   800cd9 <printnum>
+  80118f:	83 c4 20             	add    $0x20,%esp
+  801192:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801195:	e9 40 fc ff ff       	jmp    800dda <vprintfmt+0x1e>
+  80119a:	83 f9 01             	cmp    $0x1,%ecx
+  80119d:	7f 1b                	jg     8011ba <vprintfmt+0x3fe>
+  80119f:	85 c9                	test   %ecx,%ecx
+  8011a1:	74 2c                	je     8011cf <vprintfmt+0x413>
+  8011a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011a6:	8b 10                	mov    (%eax),%edx
+  8011a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8011b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8011b3:	bf 10 00 00 00       	mov    $0x10,%edi
+  8011b8:	eb be                	jmp    801178 <vprintfmt+0x3bc>
+  8011ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011bd:	8b 10                	mov    (%eax),%edx
+  8011bf:	8b 48 04             	mov    0x4(%eax),%ecx
+  8011c2:	8d 40 08             	lea    0x8(%eax),%eax
+  8011c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8011c8:	bf 10 00 00 00       	mov    $0x10,%edi
+  8011cd:	eb a9                	jmp    801178 <vprintfmt+0x3bc>
+  8011cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011d2:	8b 10                	mov    (%eax),%edx
+  8011d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8011dc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8011df:	bf 10 00 00 00       	mov    $0x10,%edi
+  8011e4:	eb 92                	jmp    801178 <vprintfmt+0x3bc>
+  8011e6:	83 ec 08             	sub    $0x8,%esp
+  8011e9:	53                   	push   %ebx
+  8011ea:	6a 25                	push   $0x25
+  8011ec:	ff d6                	call   *%esi
+  8011ee:	83 c4 10             	add    $0x10,%esp
+  8011f1:	eb 9f                	jmp    801192 <vprintfmt+0x3d6>
+  8011f3:	83 ec 08             	sub    $0x8,%esp
+  8011f6:	53                   	push   %ebx
+  8011f7:	6a 25                	push   $0x25
+  8011f9:	ff d6                	call   *%esi
+  8011fb:	83 c4 10             	add    $0x10,%esp
+  8011fe:	89 f8                	mov    %edi,%eax
+  801200:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801204:	74 05                	je     80120b <vprintfmt+0x44f>
+  801206:	83 e8 01             	sub    $0x1,%eax
+  801209:	eb f5                	jmp    801200 <vprintfmt+0x444>
+  80120b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80120e:	eb 82                	jmp    801192 <vprintfmt+0x3d6>
+
+00801210 <vsnprintf>:
+  801210:	55                   	push   %ebp
+  801211:	89 e5                	mov    %esp,%ebp
+  801213:	83 ec 18             	sub    $0x18,%esp
+  801216:	8b 45 08             	mov    0x8(%ebp),%eax
+  801219:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80121c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80121f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801223:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801226:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  80122d:	85 c0                	test   %eax,%eax
+  80122f:	74 26                	je     801257 <vsnprintf+0x47>
+  801231:	85 d2                	test   %edx,%edx
+  801233:	7e 22                	jle    801257 <vsnprintf+0x47>
+  801235:	ff 75 14             	push   0x14(%ebp)
+  801238:	ff 75 10             	push   0x10(%ebp)
+  80123b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80123e:	50                   	push   %eax
+  80123f:	68 82 0d 80 00       	push   $0x800d82
+  801244:	e8 73 fb ff ff       	call   800dbc <vprintfmt>
+  801249:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80124c:	c6 00 00             	movb   $0x0,(%eax)
+  80124f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801252:	83 c4 10             	add    $0x10,%esp
+  801255:	c9                   	leave
+  801256:	c3                   	ret
+  801257:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80125c:	eb f7                	jmp    801255 <vsnprintf+0x45>
+
+0080125e <snprintf>:
+  80125e:	55                   	push   %ebp
+  80125f:	89 e5                	mov    %esp,%ebp
+  801261:	83 ec 08             	sub    $0x8,%esp
+  801264:	8d 45 14             	lea    0x14(%ebp),%eax
+  801267:	50                   	push   %eax
+  801268:	ff 75 10             	push   0x10(%ebp)
+  80126b:	ff 75 0c             	push   0xc(%ebp)
+  80126e:	ff 75 08             	push   0x8(%ebp)
+  801271:	e8 9a ff ff ff       	call   801210 <vsnprintf>
+  801276:	c9                   	leave
+  801277:	c3                   	ret
+
+00801278 <copy_fwd>:
+  801278:	55                   	push   %ebp
+  801279:	89 e5                	mov    %esp,%ebp
+  80127b:	57                   	push   %edi
+  80127c:	56                   	push   %esi
+  80127d:	53                   	push   %ebx
+  80127e:	89 c7                	mov    %eax,%edi
+  801280:	89 d6                	mov    %edx,%esi
+  801282:	89 c8                	mov    %ecx,%eax
+  801284:	83 f9 0f             	cmp    $0xf,%ecx
+  801287:	76 1c                	jbe    8012a5 <copy_fwd+0x2d>
+  801289:	89 f9                	mov    %edi,%ecx
+  80128b:	f7 d9                	neg    %ecx
+  80128d:	89 cb                	mov    %ecx,%ebx
+  80128f:	83 e3 03             	and    $0x3,%ebx
+  801292:	29 d8                	sub    %ebx,%eax
+  801294:	89 c2                	mov    %eax,%edx
+  801296:	c1 ea 02             	shr    $0x2,%edx
+  801299:	83 e0 03             	and    $0x3,%eax
+  80129c:	89 d9                	mov    %ebx,%ecx
+  80129e:	fc                   	cld
+  80129f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8012a1:	89 d1                	mov    %edx,%ecx
+  8012a3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8012a5:	89 c1                	mov    %eax,%ecx
+  8012a7:	fc                   	cld
+  8012a8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8012aa:	5b                   	pop    %ebx
+  8012ab:	5e                   	pop    %esi
+  8012ac:	5f                   	pop    %edi
+  8012ad:	5d                   	pop    %ebp
+  8012ae:	c3                   	ret
+
+008012af <have_sse2>:
+  8012af:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012b6:	78 06                	js     8012be <have_sse2+0xf>
+  8012b8:	a1 08 20 80 00       	mov    0x802008,%eax
+  8012bd:	c3                   	ret
+  8012be:	55                   	push   %ebp
+  8012bf:	89 e5                	mov    %esp,%ebp
+  8012c1:	53                   	push   %ebx
+  8012c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012c7:	0f a2                	cpuid
+  8012c9:	c1 ea 1a             	shr    $0x1a,%edx
+  8012cc:	83 e2 01             	and    $0x1,%edx
+  8012cf:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8012d5:	a1 08 20 80 00       	mov    0x802008,%eax
+  8012da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012dd:	c9                   	leave
+  8012de:	c3                   	ret
+
+008012df <strlen>:
+  8012df:	55                   	push   %ebp
+  8012e0:	89 e5                	mov    %esp,%ebp
+  8012e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ea:	eb 03                	jmp    8012ef <strlen+0x10>
+  8012ec:	83 c0 01             	add    $0x1,%eax
+  8012ef:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8012f3:	75 f7                	jne    8012ec <strlen+0xd>
+  8012f5:	5d                   	pop    %ebp
+  8012f6:	c3                   	ret
+
+008012f7 <strnlen>:
+  8012f7:	55                   	push   %ebp
+  8012f8:	89 e5                	mov    %esp,%ebp
+  8012fa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801300:	b8 00 00 00 00       	mov    $0x0,%eax
+  801305:	eb 03                	jmp    80130a <strnlen+0x13>
+  801307:	83 c0 01             	add    $0x1,%eax
+  80130a:	39 d0                	cmp    %edx,%eax
+  80130c:	74 08                	je     801316 <strnlen+0x1f>
+  80130e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801312:	75 f3                	jne    801307 <strnlen+0x10>
+  801314:	89 c2                	mov    %eax,%edx
+  801316:	89 d0                	mov    %edx,%eax
+  801318:	5d                   	pop    %ebp
+  801319:	c3                   	ret
+
+0080131a <strcpy>:
+  80131a:	55                   	push   %ebp
+  80131b:	89 e5                	mov    %esp,%ebp
+  80131d:	53                   	push   %ebx
+  80131e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801321:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801324:	b8 00 00 00 00       	mov    $0x0,%eax
+  801329:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80132d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801330:	83 c0 01             	add    $0x1,%eax
+  801333:	84 d2                	test   %dl,%dl
+  801335:	75 f2                	jne    801329 <strcpy+0xf>
+  801337:	89 c8                	mov    %ecx,%eax
+  801339:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80133c:	c9                   	leave
+  80133d:	c3                   	ret
+
+0080133e <strcat>:
+  80133e:	55                   	push   %ebp
+  80133f:	89 e5                	mov    %esp,%ebp
+  801341:	53                   	push   %ebx
+  801342:	83 ec 10             	sub    $0x10,%esp
+  801345:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801348:	53                   	push   %ebx
+  801349:	e8 91 ff ff ff       	call   8012df <strlen>
+  80134e:	83 c4 08             	add    $0x8,%esp
+  801351:	ff 75 0c             	push   0xc(%ebp)
+  801354:	01 d8                	add    %ebx,%eax
+  801356:	50                   	push   %eax
+  801357:	e8 be ff ff ff       	call   80131a <strcpy>
+  80135c:	89 d8                	mov    %ebx,%eax
+  80135e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801361:	c9                   	leave
+  801362:	c3                   	ret
+
+00801363 <strncpy>:
+  801363:	55                   	push   %ebp
+  801364:	89 e5                	mov    %esp,%ebp
+  801366:	56                   	push   %esi
+  801367:	53                   	push   %ebx
+  801368:	8b 75 08             	mov    0x8(%ebp),%esi
+  80136b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80136e:	89 f3                	mov    %esi,%ebx
+  801370:	03 5d 10             	add    0x10(%ebp),%ebx
+  801373:	89 f0                	mov    %esi,%eax
+  801375:	eb 0f                	jmp    801386 <strncpy+0x23>
+  801377:	83 c0 01             	add    $0x1,%eax
+  80137a:	0f b6 0a             	movzbl (%edx),%ecx
+  80137d:	88 48 ff             	mov    %cl,-0x1(%eax)
+  801380:	80 f9 01             	cmp    $0x1,%cl
+  801383:	83 da ff             	sbb    $0xffffffff,%edx
+  801386:	39 d8                	cmp    %ebx,%eax
+  801388:	75 ed                	jne    801377 <strncpy+0x14>
+  80138a:	89 f0                	mov    %esi,%eax
+  80138c:	5b                   	pop    %ebx
+  80138d:	5e                   	pop    %esi
+  80138e:	5d                   	pop    %ebp
+  80138f:	c3                   	ret
+
+00801390 <strlcpy>:
+  801390:	55                   	push   %ebp
+  801391:	89 e5                	mov    %esp,%ebp
+  801393:	56                   	push   %esi
+  801394:	53                   	push   %ebx
+  801395:	8b 75 08             	mov    0x8(%ebp),%esi
+  801398:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80139e:	89 f0                	mov    %esi,%eax
+  8013a0:	85 d2                	test   %edx,%edx
+  8013a2:	74 21                	je     8013c5 <strlcpy+0x35>
+  8013a4:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8013a8:	89 f2                	mov    %esi,%edx
+  8013aa:	eb 09                	jmp    8013b5 <strlcpy+0x25>
+  8013ac:	83 c1 01             	add    $0x1,%ecx
+  8013af:	83 c2 01             	add    $0x1,%edx
+  8013b2:	88 5a ff             	mov    %bl,-0x1(%edx)
+  8013b5:	39 c2                	cmp    %eax,%edx
+  8013b7:	74 09                	je     8013c2 <strlcpy+0x32>
+  8013b9:	0f b6 19             	movzbl (%ecx),%ebx
+  8013bc:	84 db                	test   %bl,%bl
+  8013be:	75 ec                	jne    8013ac <strlcpy+0x1c>
+  8013c0:	89 d0                	mov    %edx,%eax
+  8013c2:	c6 00 00             	movb   $0x0,(%eax)
+  8013c5:	29 f0                	sub    %esi,%eax
+  8013c7:	5b                   	pop    %ebx
+  8013c8:	5e                   	pop    %esi
+  8013c9:	5d                   	pop    %ebp
+  8013ca:	c3                   	ret
+
+008013cb <strcmp>:
+  8013cb:	55                   	push   %ebp
+  8013cc:	89 e5                	mov    %esp,%ebp
+  8013ce:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8013d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013d4:	eb 06                	jmp    8013dc <strcmp+0x11>
+  8013d6:	83 c1 01             	add    $0x1,%ecx
+  8013d9:	83 c2 01             	add    $0x1,%edx
+  8013dc:	0f b6 01             	movzbl (%ecx),%eax
+  8013df:	84 c0                	test   %al,%al
+  8013e1:	74 04                	je     8013e7 <strcmp+0x1c>
+  8013e3:	3a 02                	cmp    (%edx),%al
+  8013e5:	74 ef                	je     8013d6 <strcmp+0xb>
+  8013e7:	0f b6 c0             	movzbl %al,%eax
+  8013ea:	0f b6 12             	movzbl (%edx),%edx
+  8013ed:	29 d0                	sub    %edx,%eax
+  8013ef:	5d                   	pop    %ebp
+  8013f0:	c3                   	ret
+
+008013f1 <strncmp>:
+  8013f1:	55                   	push   %ebp
+  8013f2:	89 e5                	mov    %esp,%ebp
+  8013f4:	53                   	push   %ebx
+  8013f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013fb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8013fe:	eb 09                	jmp    801409 <strncmp+0x18>
+  801400:	83 ea 01             	sub    $0x1,%edx
+  801403:	83 c0 01             	add    $0x1,%eax
+  801406:	83 c1 01             	add    $0x1,%ecx
+  801409:	85 d2                	test   %edx,%edx
+  80140b:	74 18                	je     801425 <strncmp+0x34>
+  80140d:	0f b6 18             	movzbl (%eax),%ebx
+  801410:	84 db                	test   %bl,%bl
+  801412:	74 04                	je     801418 <strncmp+0x27>
+  801414:	3a 19                	cmp    (%ecx),%bl
+  801416:	74 e8                	je     801400 <strncmp+0xf>
+  801418:	0f b6 00             	movzbl (%eax),%eax
+  80141b:	0f b6 11             	movzbl (%ecx),%edx
+  80141e:	29 d0                	sub    %edx,%eax
+  801420:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801423:	c9                   	leave
+  801424:	c3                   	ret
+  801425:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142a:	eb f4                	jmp    801420 <strncmp+0x2f>
+
+0080142c <strchr>:
+  80142c:	55                   	push   %ebp
+  80142d:	89 e5                	mov    %esp,%ebp
+  80142f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801432:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  801436:	eb 03                	jmp    80143b <strchr+0xf>
+  801438:	83 c0 01             	add    $0x1,%eax
+  80143b:	0f b6 10             	movzbl (%eax),%edx
+  80143e:	84 d2                	test   %dl,%dl
+  801440:	74 06                	je     801448 <strchr+0x1c>
+  801442:	38 ca                	cmp    %cl,%dl
+  801444:	75 f2                	jne    801438 <strchr+0xc>
+  801446:	eb 05                	jmp    80144d <strchr+0x21>
+  801448:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144d:	5d                   	pop    %ebp
+  80144e:	c3                   	ret
+
+0080144f <strfind>:
+  80144f:	55                   	push   %ebp
+  801450:	89 e5                	mov    %esp,%ebp
+  801452:	8b 45 08             	mov    0x8(%ebp),%eax
+  801455:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  801459:	0f b6 10             	movzbl (%eax),%edx
+  80145c:	38 ca                	cmp    %cl,%dl
+  80145e:	74 09                	je     801469 <strfind+0x1a>
+  801460:	84 d2                	test   %dl,%dl
+  801462:	74 05                	je     801469 <strfind+0x1a>
+  801464:	83 c0 01             	add    $0x1,%eax
+  801467:	eb f0                	jmp    801459 <strfind+0xa>
+  801469:	5d                   	pop    %ebp
+  80146a:	c3                   	ret
+
+0080146b <memset>:
+  80146b:	55                   	push   %ebp
+  80146c:	89 e5                	mov    %esp,%ebp
+  80146e:	57                   	push   %edi
+  80146f:	56                   	push   %esi
+  801470:	53                   	push   %ebx
+  801471:	83 ec 04             	sub    $0x4,%esp
+  801474:	8b 75 08             	mov    0x8(%ebp),%esi
+  801477:	8b 55 10             	mov    0x10(%ebp),%edx
+  80147a:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  80147e:	89 f7                	mov    %esi,%edi
+  801480:	83 fa 0f             	cmp    $0xf,%edx
+  801483:	76 24                	jbe    8014a9 <memset+0x3e>
+  801485:	89 f1                	mov    %esi,%ecx
+  801487:	f7 d9                	neg    %ecx
+  801489:	83 e1 03             	and    $0x3,%ecx
+  80148c:	29 ca                	sub    %ecx,%edx
+  80148e:	89 d0                	mov    %edx,%eax
+  801490:	c1 e8 02             	shr    $0x2,%eax
+  801493:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  801496:	83 e2 03             	and    $0x3,%edx
+  801499:	89 d8                	mov    %ebx,%eax
+  80149b:	fc                   	cld
+  80149c:	f3 aa                	rep stos %al,%es:(%edi)
+  80149e:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  8014a4:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  8014a7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8014a9:	89 d1                	mov    %edx,%ecx
+  8014ab:	89 d8                	mov    %ebx,%eax
+  8014ad:	fc                   	cld
+  8014ae:	f3 aa                	rep stos %al,%es:(%edi)
+  8014b0:	89 f0                	mov    %esi,%eax
+  8014b2:	83 c4 04             	add    $0x4,%esp
+  8014b5:	5b                   	pop    %ebx
+  8014b6:	5e                   	pop    %esi
+  8014b7:	5f                   	pop    %edi
+  8014b8:	5d                   	pop    %ebp
+  8014b9:	c3                   	ret
+
+008014ba <memmove>:
+  8014ba:	55                   	push   %ebp
+  8014bb:	89 e5                	mov    %esp,%ebp
+  8014bd:	57                   	push   %edi
+  8014be:	56                   	push   %esi
+  8014bf:	53                   	push   %ebx
+  8014c0:	83 ec 0c             	sub    $0xc,%esp
+  8014c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8014c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014c9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8014cc:	85 c0                	test   %eax,%eax
+  8014ce:	74 14                	je     8014e4 <memmove+0x2a>
+  8014d0:	39 da                	cmp    %ebx,%edx
+  8014d2:	73 07                	jae    8014db <memmove+0x21>
+  8014d4:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8014d7:	39 cb                	cmp    %ecx,%ebx
+  8014d9:	72 13                	jb     8014ee <memmove+0x34>
+  8014db:	89 c1                	mov    %eax,%ecx
+  8014dd:	89 d8                	mov    %ebx,%eax
+  8014df:	e8 94 fd ff ff       	call   801278 <copy_fwd>
+  8014e4:	89 d8                	mov    %ebx,%eax
+  8014e6:	83 c4 0c             	add    $0xc,%esp
+  8014e9:	5b                   	pop    %ebx
+  8014ea:	5e                   	pop    %esi
+  8014eb:	5f                   	pop    %edi
+  8014ec:	5d                   	pop    %ebp
+  8014ed:	c3                   	ret
+  8014ee:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  8014f1:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  8014f4:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  8014f7:	83 f8 0f             	cmp    $0xf,%eax
+  8014fa:	76 23                	jbe    80151f <memmove+0x65>
+  8014fc:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  8014ff:	83 e1 03             	and    $0x3,%ecx
+  801502:	29 c8                	sub    %ecx,%eax
+  801504:	89 c2                	mov    %eax,%edx
+  801506:	c1 ea 02             	shr    $0x2,%edx
+  801509:	83 e0 03             	and    $0x3,%eax
+  80150c:	fd                   	std
+  80150d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80150f:	83 ef 03             	sub    $0x3,%edi
+  801512:	83 ee 03             	sub    $0x3,%esi
+  801515:	89 d1                	mov    %edx,%ecx
+  801517:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801519:	83 c7 03             	add    $0x3,%edi
+  80151c:	83 c6 03             	add    $0x3,%esi
+  80151f:	89 c1                	mov    %eax,%ecx
+  801521:	fd                   	std
+  801522:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  801524:	fc                   	cld
+  801525:	eb bd                	jmp    8014e4 <memmove+0x2a>
+
+00801527 <memcpy>:
+  801527:	55                   	push   %ebp
+  801528:	89 e5                	mov    %esp,%ebp
+  80152a:	53                   	push   %ebx
+  80152b:	83 ec 04             	sub    $0x4,%esp
+  80152e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801531:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801534:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801537:	89 d8                	mov    %ebx,%eax
+  801539:	e8 3a fd ff ff       	call   801278 <copy_fwd>
+  80153e:	89 d8                	mov    %ebx,%eax
+  801540:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801543:	c9                   	leave
+  801544:	c3                   	ret
+
+00801545 <page_copy>:
+  801545:	55                   	push   %ebp
+  801546:	89 e5                	mov    %esp,%ebp
+  801548:	57                   	push   %edi
+  801549:	56                   	push   %esi
+  80154a:	53                   	push   %ebx
+  80154b:	83 ec 0c             	sub    $0xc,%esp
+  80154e:	e8 5c fd ff ff       	call   8012af <have_sse2>
+  801553:	85 c0                	test   %eax,%eax
+  801555:	74 39                	je     801590 <page_copy+0x4b>
+  801557:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80155a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80155d:	be 00 01 00 00       	mov    $0x100,%esi
+  801562:	8b 03                	mov    (%ebx),%eax
+  801564:	8b 53 04             	mov    0x4(%ebx),%edx
+  801567:	0f c3 01             	movnti %eax,(%ecx)
+  80156a:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  80156e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801571:	8b 53 0c             	mov    0xc(%ebx),%edx
+  801574:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  801578:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  80157c:	83 c3 10             	add    $0x10,%ebx
+  80157f:	83 c1 10             	add    $0x10,%ecx
+  801582:	4e                   	dec    %esi
+  801583:	75 dd                	jne    801562 <page_copy+0x1d>
+  801585:	0f ae f8             	sfence
+  801588:	83 c4 0c             	add    $0xc,%esp
+  80158b:	5b                   	pop    %ebx
+  80158c:	5e                   	pop    %esi
+  80158d:	5f                   	pop    %edi
+  80158e:	5d                   	pop    %ebp
+  80158f:	c3                   	ret
+  801590:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801593:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801596:	b9 00 04 00 00       	mov    $0x400,%ecx
+  80159b:	fc                   	cld
+  80159c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80159e:	eb e8                	jmp    801588 <page_copy+0x43>
+
+008015a0 <page_zero>:
+  8015a0:	55                   	push   %ebp
+  8015a1:	89 e5                	mov    %esp,%ebp
+  8015a3:	57                   	push   %edi
+  8015a4:	83 ec 04             	sub    $0x4,%esp
+  8015a7:	e8 03 fd ff ff       	call   8012af <have_sse2>
+  8015ac:	85 c0                	test   %eax,%eax
+  8015ae:	74 3a                	je     8015ea <page_zero+0x4a>
+  8015b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015b3:	ba 80 00 00 00       	mov    $0x80,%edx
+  8015b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015bd:	0f c3 08             	movnti %ecx,(%eax)
+  8015c0:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  8015c4:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  8015c8:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  8015cc:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  8015d0:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  8015d4:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  8015d8:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  8015dc:	83 c0 20             	add    $0x20,%eax
+  8015df:	4a                   	dec    %edx
+  8015e0:	75 db                	jne    8015bd <page_zero+0x1d>
+  8015e2:	0f ae f8             	sfence
+  8015e5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8015e8:	c9                   	leave
+  8015e9:	c3                   	ret
+  8015ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015ed:	b9 00 04 00 00       	mov    $0x400,%ecx
+  8015f2:	fc                   	cld
+  8015f3:	f3 ab                	rep stos %eax,%es:(%edi)
+  8015f5:	eb ee                	jmp    8015e5 <page_zero+0x45>
+
+008015f7 <memcmp>:
+  8015f7:	55                   	push   %ebp
+  8015f8:	89 e5                	mov    %esp,%ebp
+  8015fa:	56                   	push   %esi
+  8015fb:	53                   	push   %ebx
+  8015fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801602:	89 c6                	mov    %eax,%esi
+  801604:	03 75 10             	add    0x10(%ebp),%esi
+  801607:	eb 06                	jmp    80160f <memcmp+0x18>
+  801609:	83 c0 01             	add    $0x1,%eax
+  80160c:	83 c2 01             	add    $0x1,%edx
+  80160f:	39 f0                	cmp    %esi,%eax
+  801611:	74 14                	je     801627 <memcmp+0x30>
+  801613:	0f b6 08             	movzbl (%eax),%ecx
+  801616:	0f b6 1a             	movzbl (%edx),%ebx
+  801619:	38 d9                	cmp    %bl,%cl
+  80161b:	74 ec                	je     801609 <memcmp+0x12>
+  80161d:	0f b6 c1             	movzbl %cl,%eax
+  801620:	0f b6 db             	movzbl %bl,%ebx
+  801623:	29 d8                	sub    %ebx,%eax
+  801625:	eb 05                	jmp    80162c <memcmp+0x35>
+  801627:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162c:	5b                   	pop    %ebx
+  80162d:	5e                   	pop    %esi
+  80162e:	5d                   	pop    %ebp
+  80162f:	c3                   	ret
+
+00801630 <memfind>:
+  801630:	55                   	push   %ebp
+  801631:	89 e5                	mov    %esp,%ebp
+  801633:	8b 45 08             	mov    0x8(%ebp),%eax
+  801636:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801639:	89 c2                	mov    %eax,%edx
+  80163b:	03 55 10             	add    0x10(%ebp),%edx
+  80163e:	eb 03                	jmp    801643 <memfind+0x13>
+  801640:	83 c0 01             	add    $0x1,%eax
+  801643:	39 d0                	cmp    %edx,%eax
+  801645:	73 04                	jae    80164b <memfind+0x1b>
+  801647:	38 08                	cmp    %cl,(%eax)
+  801649:	75 f5                	jne    801640 <memfind+0x10>
+  80164b:	5d                   	pop    %ebp
+  80164c:	c3                   	ret
+
+0080164d <strtol>:
+  80164d:	55                   	push   %ebp
+  80164e:	89 e5                	mov    %esp,%ebp
+  801650:	57                   	push   %edi
+  801651:	56                   	push   %esi
+  801652:	53                   	push   %ebx
+  801653:	8b 55 08             	mov    0x8(%ebp),%edx
+  801656:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801659:	eb 03                	jmp    80165e <strtol+0x11>
+  80165b:	83 c2 01             	add    $0x1,%edx
+  80165e:	0f b6 02             	movzbl (%edx),%eax
+  801661:	3c 20                	cmp    $0x20,%al
+  801663:	74 f6                	je     80165b <strtol+0xe>
+  801665:	3c 09                	cmp    $0x9,%al
+  801667:	74 f2                	je     80165b <strtol+0xe>
+  801669:	3c 2b                	cmp    $0x2b,%al
+  80166b:	74 2a                	je     801697 <strtol+0x4a>
+  80166d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801672:	3c 2d                	cmp    $0x2d,%al
+  801674:	74 2b                	je     8016a1 <strtol+0x54>
+  801676:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80167c:	75 0f                	jne    80168d <strtol+0x40>
+  80167e:	80 3a 30             	cmpb   $0x30,(%edx)
+  801681:	74 28                	je     8016ab <strtol+0x5e>
+  801683:	85 db                	test   %ebx,%ebx
+  801685:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80168a:	0f 44 d8             	cmove  %eax,%ebx
+  80168d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801692:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801695:	eb 46                	jmp    8016dd <strtol+0x90>
+  801697:	83 c2 01             	add    $0x1,%edx
+  80169a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80169f:	eb d5                	jmp    801676 <strtol+0x29>
+  8016a1:	83 c2 01             	add    $0x1,%edx
+  8016a4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8016a9:	eb cb                	jmp    801676 <strtol+0x29>
+  8016ab:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8016af:	74 0e                	je     8016bf <strtol+0x72>
+  8016b1:	85 db                	test   %ebx,%ebx
+  8016b3:	75 d8                	jne    80168d <strtol+0x40>
+  8016b5:	83 c2 01             	add    $0x1,%edx
+  8016b8:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8016bd:	eb ce                	jmp    80168d <strtol+0x40>
+  8016bf:	83 c2 02             	add    $0x2,%edx
+  8016c2:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8016c7:	eb c4                	jmp    80168d <strtol+0x40>
+  8016c9:	0f be c0             	movsbl %al,%eax
+  8016cc:	83 e8 30             	sub    $0x30,%eax
+  8016cf:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8016d2:	7d 3a                	jge    80170e <strtol+0xc1>
+  8016d4:	83 c2 01             	add    $0x1,%edx
+  8016d7:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8016db:	01 c1                	add    %eax,%ecx
+  8016dd:	0f b6 02             	movzbl (%edx),%eax
+  8016e0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8016e3:	89 f3                	mov    %esi,%ebx
+  8016e5:	80 fb 09             	cmp    $0x9,%bl
+  8016e8:	76 df                	jbe    8016c9 <strtol+0x7c>
+  8016ea:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8016ed:	89 f3                	mov    %esi,%ebx
+  8016ef:	80 fb 19             	cmp    $0x19,%bl
+  8016f2:	77 08                	ja     8016fc <strtol+0xaf>
+  8016f4:	0f be c0             	movsbl %al,%eax
+  8016f7:	83 e8 57             	sub    $0x57,%eax
+  8016fa:	eb d3                	jmp    8016cf <strtol+0x82>
+  8016fc:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8016ff:	89 f3                	mov    %esi,%ebx
+  801701:	80 fb 19             	cmp    $0x19,%bl
+  801704:	77 08                	ja     80170e <strtol+0xc1>
+  801706:	0f be c0             	movsbl %al,%eax
+  801709:	83 e8 37             	sub    $0x37,%eax
+  80170c:	eb c1                	jmp    8016cf <strtol+0x82>
+  80170e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801712:	74 05                	je     801719 <strtol+0xcc>
+  801714:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801717:	89 10                	mov    %edx,(%eax)
+  801719:	89 c8                	mov    %ecx,%eax
+  80171b:	f7 d8                	neg    %eax
+  80171d:	85 ff                	test   %edi,%edi
+  80171f:	0f 45 c8             	cmovne %eax,%ecx
+  801722:	89 c8                	mov    %ecx,%eax
+  801724:	5b                   	pop    %ebx
+  801725:	5e                   	pop    %esi
+  801726:	5f                   	pop    %edi
+  801727:	5d                   	pop    %ebp
+  801728:	c3                   	ret
+
+00801729 <set_pgfault_handler>:
+  801729:	55                   	push   %ebp
+  80172a:	89 e5                	mov    %esp,%ebp
+  80172c:	83 ec 08             	sub    $0x8,%esp
+  80172f:	83 3d 44 24 80 00 00 	cmpl   $0x0,0x802444
+  801736:	74 0a                	je     801742 <set_pgfault_handler+0x19>
+  801738:	8b 45 08             	mov    0x8(%ebp),%eax
+  80173b:	a3 44 24 80 00       	mov    %eax,0x802444
+  801740:	c9                   	leave
+  801741:	c3                   	ret
+  801742:	83 ec 04             	sub    $0x4,%esp
+  801745:	6a 07                	push   $0x7
+  801747:	68 00 f0 ff ea       	push   $0xeafff000
+  80174c:	6a 00                	push   $0x0
+  80174e:	e8 a7 ec ff ff       	call   8003fa <sys_page_alloc>
+  801753:	83 c4 10             	add    $0x10,%esp
+  801756:	85 c0                	test   %eax,%eax
+  801758:	75 2a                	jne    801784 <set_pgfault_handler+0x5b>
+  80175a:	83 ec 08             	sub    $0x8,%esp
+  80175d:	68 2f 0a 80 00       	push   $0x800a2f
+  801762:	6a 00                	push   $0x0
+  801764:	e8 33 ef ff ff       	call   80069c <sys_env_set_pgfault_upcall>
+  801769:	83 c4 10             	add    $0x10,%esp
+  80176c:	85 c0                	test   %eax,%eax
+  80176e:	74 c8                	je     801738 <set_pgfault_handler+0xf>
+  801770:	83 ec 04             	sub    $0x4,%esp
+  801773:	68 e8 1c 80 00       	push   $0x801ce8
+  801778:	6a 28                	push   $0x28
+  80177a:	68 da 1c 80 00       	push   $0x801cda
+  80177f:	e8 61 f4 ff ff       	call   800be5 <_panic>
+  801784:	83 ec 04             	sub    $0x4,%esp
+  801787:	68 c4 1c 80 00       	push   $0x801cc4
+  80178c:	6a 22                	push   $0x22
+  80178e:	68 da 1c 80 00       	push   $0x801cda
+  801793:	e8 4d f4 ff ff       	call   800be5 <_panic>
+
+00801798 <__udivdi3>:
+  801798:	57                   	push   %edi
+  801799:	56                   	push   %esi
+  80179a:	53                   	push   %ebx
+  80179b:	83 ec 20             	sub    $0x20,%esp
+  80179e:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8017a2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8017a6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8017aa:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8017ae:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8017b2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8017b6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8017ba:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8017be:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8017c2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8017c6:	89 d1                	mov    %edx,%ecx
+  8017c8:	09 c1                	or     %eax,%ecx
+  8017ca:	0f 84 91 00 00 00    	je     801861 <__udivdi3+0xc9>
+  8017d0:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8017d7:	00 
+  8017d8:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8017df:	00 
+  8017e0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8017e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ef:	eb 08                	jmp    8017f9 <__udivdi3+0x61>
+  8017f1:	83 e9 01             	sub    $0x1,%ecx
+  8017f4:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8017f7:	74 68                	je     801861 <__udivdi3+0xc9>
+  8017f9:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8017fd:	01 c0                	add    %eax,%eax
+  8017ff:	89 c6                	mov    %eax,%esi
+  801801:	89 d7                	mov    %edx,%edi
+  801803:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801807:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80180b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80180e:	d3 ea                	shr    %cl,%edx
+  801810:	f6 c1 20             	test   $0x20,%cl
+  801813:	74 04                	je     801819 <__udivdi3+0x81>
+  801815:	89 d0                	mov    %edx,%eax
+  801817:	31 d2                	xor    %edx,%edx
+  801819:	83 e0 01             	and    $0x1,%eax
+  80181c:	89 04 24             	mov    %eax,(%esp)
+  80181f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801826:	00 
+  801827:	8b 04 24             	mov    (%esp),%eax
+  80182a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80182e:	09 f0                	or     %esi,%eax
+  801830:	09 fa                	or     %edi,%edx
+  801832:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801836:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80183a:	39 f0                	cmp    %esi,%eax
+  80183c:	89 d3                	mov    %edx,%ebx
+  80183e:	19 fb                	sbb    %edi,%ebx
+  801840:	72 af                	jb     8017f1 <__udivdi3+0x59>
+  801842:	29 f0                	sub    %esi,%eax
+  801844:	19 fa                	sbb    %edi,%edx
+  801846:	89 cf                	mov    %ecx,%edi
+  801848:	c1 ef 05             	shr    $0x5,%edi
+  80184b:	83 e7 01             	and    $0x1,%edi
+  80184e:	89 fe                	mov    %edi,%esi
+  801850:	83 f6 01             	xor    $0x1,%esi
+  801853:	d3 e6                	shl    %cl,%esi
+  801855:	d3 e7                	shl    %cl,%edi
+  801857:	09 74 24 18          	or     %esi,0x18(%esp)
+  80185b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80185f:	eb 90                	jmp    8017f1 <__udivdi3+0x59>
+  801861:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801865:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  801869:	83 c4 20             	add    $0x20,%esp
+  80186c:	5b                   	pop    %ebx
+  80186d:	5e                   	pop    %esi
+  80186e:	5f                   	pop    %edi
+  80186f:	c3                   	ret
+
+00801870 <__umoddi3>:
+  801870:	55                   	push   %ebp
+  801871:	57                   	push   %edi
+  801872:	56                   	push   %esi
+  801873:	53                   	push   %ebx
+  801874:	83 ec 1c             	sub    $0x1c,%esp
+  801877:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80187b:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80187f:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801883:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801887:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80188b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80188f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801893:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801897:	89 d6                	mov    %edx,%esi
+  801899:	09 c6                	or     %eax,%esi
+  80189b:	74 6c                	je     801909 <__umoddi3+0x99>
+  80189d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8018a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ac:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  8018b0:	eb 0e                	jmp    8018c0 <__umoddi3+0x50>
+  8018b2:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  8018b7:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8018bb:	83 fe ff             	cmp    $0xffffffff,%esi
+  8018be:	74 49                	je     801909 <__umoddi3+0x99>
+  8018c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8018c4:	01 c0                	add    %eax,%eax
+  8018c6:	89 c3                	mov    %eax,%ebx
+  8018c8:	89 d6                	mov    %edx,%esi
+  8018ca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8018ce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8018d2:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  8018d7:	0f ad d0             	shrd   %cl,%edx,%eax
+  8018da:	d3 ea                	shr    %cl,%edx
+  8018dc:	f6 c1 20             	test   $0x20,%cl
+  8018df:	74 04                	je     8018e5 <__umoddi3+0x75>
+  8018e1:	89 d0                	mov    %edx,%eax
+  8018e3:	31 d2                	xor    %edx,%edx
+  8018e5:	83 e0 01             	and    $0x1,%eax
+  8018e8:	bd 00 00 00 00       	mov    $0x0,%ebp
+  8018ed:	89 ea                	mov    %ebp,%edx
+  8018ef:	09 d8                	or     %ebx,%eax
+  8018f1:	09 f2                	or     %esi,%edx
+  8018f3:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  8018f7:	8b 74 24 14          	mov    0x14(%esp),%esi
+  8018fb:	39 d8                	cmp    %ebx,%eax
+  8018fd:	89 d1                	mov    %edx,%ecx
+  8018ff:	19 f1                	sbb    %esi,%ecx
+  801901:	72 af                	jb     8018b2 <__umoddi3+0x42>
+  801903:	29 d8                	sub    %ebx,%eax
+  801905:	19 f2                	sbb    %esi,%edx
+  801907:	eb a9                	jmp    8018b2 <__umoddi3+0x42>
+  801909:	83 c4 1c             	add    $0x1c,%esp
+  80190c:	5b                   	pop    %ebx
+  80190d:	5e                   	pop    %esi
+  80190e:	5f                   	pop    %edi
+  80190f:	5d                   	pop    %ebp
+  801910:	c3                   	ret
+
+00801911 <__divdi3>:
+  801911:	53                   	push   %ebx
+  801912:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801916:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80191a:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80191e:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801922:	85 d2                	test   %edx,%edx
+  801924:	78 12                	js     801938 <__divdi3+0x27>
+  801926:	85 db                	test   %ebx,%ebx
+  801928:	78 2e                	js     801958 <__divdi3+0x47>
+  80192a:	53                   	push   %ebx
+  80192b:	51                   	push   %ecx
+  80192c:	52                   	push   %edx
+  80192d:	50                   	push   %eax
+  80192e:	e8 65 fe ff ff       	call   801798 <__udivdi3>
+  801933:	83 c4 10             	add    $0x10,%esp
+  801936:	eb 1e                	jmp    801956 <__divdi3+0x45>
+  801938:	f7 d8                	neg    %eax
+  80193a:	83 d2 00             	adc    $0x0,%edx
+  80193d:	f7 da                	neg    %edx
+  80193f:	85 db                	test   %ebx,%ebx
+  801941:	78 2a                	js     80196d <__divdi3+0x5c>
+  801943:	53                   	push   %ebx
+  801944:	51                   	push   %ecx
+  801945:	52                   	push   %edx
+  801946:	50                   	push   %eax
+  801947:	e8 4c fe ff ff       	call   801798 <__udivdi3>
+  80194c:	83 c4 10             	add    $0x10,%esp
+  80194f:	f7 d8                	neg    %eax
+  801951:	83 d2 00             	adc    $0x0,%edx
+  801954:	f7 da                	neg    %edx
+  801956:	5b                   	pop    %ebx
+  801957:	c3                   	ret
+  801958:	f7 d9                	neg    %ecx
+  80195a:	83 d3 00             	adc    $0x0,%ebx
+  80195d:	f7 db                	neg    %ebx
+  80195f:	53                   	push   %ebx
+  801960:	51                   	push   %ecx
+  801961:	52                   	push   %edx
+  801962:	50                   	push   %eax
+  801963:	e8 30 fe ff ff       	call   801798 <__udivdi3>
+  801968:	83 c4 10             	add    $0x10,%esp
+  80196b:	eb e2                	jmp    80194f <__divdi3+0x3e>
+  80196d:	f7 d9                	neg    %ecx
+  80196f:	83 d3 00             	adc    $0x0,%ebx
+  801972:	f7 db                	neg    %ebx
+  801974:	53                   	push   %ebx
+  801975:	51                   	push   %ecx
+  801976:	52                   	push   %edx
+  801977:	50                   	push   %eax
+  801978:	e8 1b fe ff ff       	call   801798 <__udivdi3>
+  80197d:	83 c4 10             	add    $0x10,%esp
+  801980:	eb d4                	jmp    801956 <__divdi3+0x45>
+
+00801982 <__moddi3>:
+  801982:	55                   	push   %ebp
+  801983:	57                   	push   %edi
+  801984:	56                   	push   %esi
+  801985:	53                   	push   %ebx
+  801986:	83 ec 14             	sub    $0x14,%esp
+  801989:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  80198d:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801991:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801995:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801999:	85 ed                	test   %ebp,%ebp
+  80199b:	78 2b                	js     8019c8 <__moddi3+0x46>
+  80199d:	89 c6                	mov    %eax,%esi
+  80199f:	f7 de                	neg    %esi
+  8019a1:	89 34 24             	mov    %esi,(%esp)
+  8019a4:	89 d6                	mov    %edx,%esi
+  8019a6:	83 d6 00             	adc    $0x0,%esi
+  8019a9:	f7 de                	neg    %esi
+  8019ab:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8019af:	8b 34 24             	mov    (%esp),%esi
+  8019b2:	0f 48 f0             	cmovs  %eax,%esi
+  8019b5:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  8019ba:	52                   	push   %edx
+  8019bb:	56                   	push   %esi
+  8019bc:	55                   	push   %ebp
+  8019bd:	57                   	push   %edi
+  8019be:	e8 ad fe ff ff       	call   801870 <__umoddi3>
+  8019c3:	83 c4 10             	add    $0x10,%esp
+  8019c6:	eb 3c                	jmp    801a04 <__moddi3+0x82>
+  8019c8:	89 c3                	mov    %eax,%ebx
+  8019ca:	f7 db                	neg    %ebx
+  8019cc:	89 d1                	mov    %edx,%ecx
+  8019ce:	83 d1 00             	adc    $0x0,%ecx
+  8019d1:	f7 d9                	neg    %ecx
+  8019d3:	0f 49 c3             	cmovns %ebx,%eax
+  8019d6:	89 04 24             	mov    %eax,(%esp)
+  8019d9:	0f 49 d1             	cmovns %ecx,%edx
+  8019dc:	89 54 24 04          	mov    %edx,0x4(%esp)
+  8019e0:	ff 74 24 04          	push   0x4(%esp)
+  8019e4:	ff 74 24 04          	push   0x4(%esp)
+  8019e8:	89 f8                	mov    %edi,%eax
+  8019ea:	89 ea                	mov    %ebp,%edx
+  8019ec:	f7 d8                	neg    %eax
+  8019ee:	83 d2 00             	adc    $0x0,%edx
+  8019f1:	f7 da                	neg    %edx
+  8019f3:	52                   	push   %edx
+  8019f4:	50                   	push   %eax
+  8019f5:	e8 76 fe ff ff       	call   801870 <__umoddi3>
+  8019fa:	83 c4 10             	add    $0x10,%esp
+  8019fd:	f7 d8                	neg    %eax
+  8019ff:	83 d2 00             	adc    $0x0,%edx
+  801a02:	f7 da                	neg    %edx
+  801a04:	83 c4 14             	add    $0x14,%esp
+  801a07:	5b                   	pop    %ebx
+  801a08:	5e                   	pop    %esi
+  801a09:	5f                   	pop    %edi
+  801a0a:	5d                   	pop    %ebp
+  801a0b:	c3                   	ret
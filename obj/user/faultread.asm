@@ -0,0 +1,2574 @@
+
+obj/user/faultread:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	ff 35 00 00 00 00    	push   0x0
+  80003f:	68 80 19 80 00       	push   $0x801980
+  800044:	e8 fd 00 00 00       	call   800146 <cprintf>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800059:	e8 c4 14 00 00       	call   801522 <uinfo_envid>
+  80005e:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  800063:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  800069:	05 00 00 00 ed       	add    $0xed000000,%eax
+  80006e:	a3 20 20 80 00       	mov    %eax,0x802020
+  800073:	85 db                	test   %ebx,%ebx
+  800075:	7e 07                	jle    80007e <libmain+0x30>
+  800077:	8b 06                	mov    (%esi),%eax
+  800079:	a3 00 20 80 00       	mov    %eax,0x802000
+  80007e:	83 ec 08             	sub    $0x8,%esp
+  800081:	56                   	push   %esi
+  800082:	53                   	push   %ebx
+  800083:	e8 ab ff ff ff       	call   800033 <umain>
+  800088:	e8 0a 00 00 00       	call   800097 <exit>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800093:	5b                   	pop    %ebx
+  800094:	5e                   	pop    %esi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+
+00800097 <exit>:
+  800097:	55                   	push   %ebp
+  800098:	89 e5                	mov    %esp,%ebp
+  80009a:	83 ec 08             	sub    $0x8,%esp
+  80009d:	e8 19 15 00 00       	call   8015bb <bflush>
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	6a 00                	push   $0x0
+  8000a7:	e8 cc 0b 00 00       	call   800c78 <sys_env_destroy>
+  8000ac:	83 c4 10             	add    $0x10,%esp
+  8000af:	c9                   	leave
+  8000b0:	c3                   	ret
+
+008000b1 <putch>:
+  8000b1:	55                   	push   %ebp
+  8000b2:	89 e5                	mov    %esp,%ebp
+  8000b4:	53                   	push   %ebx
+  8000b5:	83 ec 04             	sub    $0x4,%esp
+  8000b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8000bb:	8b 13                	mov    (%ebx),%edx
+  8000bd:	8d 42 01             	lea    0x1(%edx),%eax
+  8000c0:	89 03                	mov    %eax,(%ebx)
+  8000c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000c5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8000c9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000ce:	74 09                	je     8000d9 <putch+0x28>
+  8000d0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8000d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000d7:	c9                   	leave
+  8000d8:	c3                   	ret
+  8000d9:	83 ec 08             	sub    $0x8,%esp
+  8000dc:	68 ff 00 00 00       	push   $0xff
+  8000e1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000e4:	50                   	push   %eax
+  8000e5:	e8 c0 0a 00 00       	call   800baa <sys_cputs>
+  8000ea:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000f0:	83 c4 10             	add    $0x10,%esp
+  8000f3:	eb db                	jmp    8000d0 <putch+0x1f>
+
+008000f5 <vcprintf>:
+  8000f5:	55                   	push   %ebp
+  8000f6:	89 e5                	mov    %esp,%ebp
+  8000f8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8000fe:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800105:	00 00 00 
+  800108:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80010f:	00 00 00 
+  800112:	ff 75 0c             	push   0xc(%ebp)
+  800115:	ff 75 08             	push   0x8(%ebp)
+  800118:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80011e:	50                   	push   %eax
+  80011f:	68 b1 00 80 00       	push   $0x8000b1
+  800124:	e8 14 01 00 00       	call   80023d <vprintfmt>
+  800129:	83 c4 08             	add    $0x8,%esp
+  80012c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800132:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800138:	50                   	push   %eax
+  800139:	e8 6c 0a 00 00       	call   800baa <sys_cputs>
+  80013e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800144:	c9                   	leave
+  800145:	c3                   	ret
+
+00800146 <cprintf>:
+  800146:	55                   	push   %ebp
+  800147:	89 e5                	mov    %esp,%ebp
+  800149:	83 ec 10             	sub    $0x10,%esp
+  80014c:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80014f:	50                   	push   %eax
+  800150:	ff 75 08             	push   0x8(%ebp)
+  800153:	e8 9d ff ff ff       	call   8000f5 <vcprintf>
+  800158:	c9                   	leave
+  800159:	c3                   	ret
+
+0080015a <printnum>:
+  80015a:	55                   	push   %ebp
+  80015b:	89 e5                	mov    %esp,%ebp
+  80015d:	57                   	push   %edi
+  80015e:	56                   	push   %esi
+  80015f:	53                   	push   %ebx
+  800160:	83 ec 1c             	sub    $0x1c,%esp
+  800163:	89 c7                	mov    %eax,%edi
+  800165:	89 d6                	mov    %edx,%esi
+  800167:	8b 45 08             	mov    0x8(%ebp),%eax
+  80016a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80016d:	89 d1                	mov    %edx,%ecx
+  80016f:	89 c2                	mov    %eax,%edx
+  800171:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800174:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800177:	8b 45 10             	mov    0x10(%ebp),%eax
+  80017a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80017d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800180:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800187:	39 c2                	cmp    %eax,%edx
+  800189:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80018c:	72 3e                	jb     8001cc <printnum+0x72>
+  80018e:	83 ec 0c             	sub    $0xc,%esp
+  800191:	ff 75 18             	push   0x18(%ebp)
+  800194:	83 eb 01             	sub    $0x1,%ebx
+  800197:	53                   	push   %ebx
+  800198:	50                   	push   %eax
+  800199:	83 ec 08             	sub    $0x8,%esp
+  80019c:	ff 75 e4             	push   -0x1c(%ebp)
+  80019f:	ff 75 e0             	push   -0x20(%ebp)
+  8001a2:	ff 75 dc             	push   -0x24(%ebp)
+  8001a5:	ff 75 d8             	push   -0x28(%ebp)
+  8001a8:	e8 50 15 00 00       	call   8016fd <__udivdi3>
+  8001ad:	83 c4 18             	add    $0x18,%esp
+  8001b0:	52                   	push   %edx
+  8001b1:	50                   	push   %eax
+  8001b2:	89 f2                	mov    %esi,%edx
+  8001b4:	89 f8                	mov    %edi,%eax
+  8001b6:	e8 9f ff ff ff       	call   80015a <printnum>
+  8001bb:	83 c4 20             	add    $0x20,%esp
+  8001be:	eb 13                	jmp    8001d3 <printnum+0x79>
+  8001c0:	83 ec 08             	sub    $0x8,%esp
+  8001c3:	56                   	push   %esi
+  8001c4:	ff 75 18             	push   0x18(%ebp)
+  8001c7:	ff d7                	call   *%edi
+  8001c9:	83 c4 10             	add    $0x10,%esp
+  8001cc:	83 eb 01             	sub    $0x1,%ebx
+  8001cf:	85 db                	test   %ebx,%ebx
+  8001d1:	7f ed                	jg     8001c0 <printnum+0x66>
+  8001d3:	83 ec 08             	sub    $0x8,%esp
+  8001d6:	56                   	push   %esi
+  8001d7:	83 ec 04             	sub    $0x4,%esp
+  8001da:	ff 75 e4             	push   -0x1c(%ebp)
+  8001dd:	ff 75 e0             	push   -0x20(%ebp)
+  8001e0:	ff 75 dc             	push   -0x24(%ebp)
+  8001e3:	ff 75 d8             	push   -0x28(%ebp)
+  8001e6:	e8 ea 15 00 00       	call   8017d5 <__umoddi3>
+  8001eb:	83 c4 14             	add    $0x14,%esp
+  8001ee:	0f be 80 a8 19 80 00 	movsbl 0x8019a8(%eax),%eax
+  8001f5:	50                   	push   %eax
+  8001f6:	ff d7                	call   *%edi
+  8001f8:	83 c4 10             	add    $0x10,%esp
+  8001fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fe:	5b                   	pop    %ebx
+  8001ff:	5e                   	pop    %esi
+  800200:	5f                   	pop    %edi
+  800201:	5d                   	pop    %ebp
+  800202:	c3                   	ret
+
+00800203 <sprintputch>:
+  800203:	55                   	push   %ebp
+  800204:	89 e5                	mov    %esp,%ebp
+  800206:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800209:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80020d:	8b 10                	mov    (%eax),%edx
+  80020f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800212:	73 0a                	jae    80021e <sprintputch+0x1b>
+  800214:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800217:	89 08                	mov    %ecx,(%eax)
+  800219:	8b 45 08             	mov    0x8(%ebp),%eax
+  80021c:	88 02                	mov    %al,(%edx)
+  80021e:	5d                   	pop    %ebp
+  80021f:	c3                   	ret
+
+00800220 <printfmt>:
+  800220:	55                   	push   %ebp
+  800221:	89 e5                	mov    %esp,%ebp
+  800223:	83 ec 08             	sub    $0x8,%esp
+  800226:	8d 45 14             	lea    0x14(%ebp),%eax
+  800229:	50                   	push   %eax
+  80022a:	ff 75 10             	push   0x10(%ebp)
+  80022d:	ff 75 0c             	push   0xc(%ebp)
+  800230:	ff 75 08             	push   0x8(%ebp)
+  800233:	e8 05 00 00 00       	call   80023d <vprintfmt>
+  800238:	83 c4 10             	add    $0x10,%esp
+  80023b:	c9                   	leave
+  80023c:	c3                   	ret
+
+0080023d <vprintfmt>:
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	57                   	push   %edi
+  800241:	56                   	push   %esi
+  800242:	53                   	push   %ebx
+  800243:	83 ec 2c             	sub    $0x2c,%esp
+  800246:	8b 75 08             	mov    0x8(%ebp),%esi
+  800249:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80024c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80024f:	eb 0a                	jmp    80025b <vprintfmt+0x1e>
+  800251:	83 ec 08             	sub    $0x8,%esp
+  800254:	53                   	push   %ebx
+  800255:	50                   	push   %eax
+  800256:	ff d6                	call   *%esi
+  800258:	83 c4 10             	add    $0x10,%esp
+  80025b:	83 c7 01             	add    $0x1,%edi
+  80025e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800262:	83 f8 25             	cmp    $0x25,%eax
+  800265:	74 0c                	je     800273 <vprintfmt+0x36>
+  800267:	85 c0                	test   %eax,%eax
+  800269:	75 e6                	jne    800251 <vprintfmt+0x14>
+  80026b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80026e:	5b                   	pop    %ebx
+  80026f:	5e                   	pop    %esi
+  800270:	5f                   	pop    %edi
+  800271:	5d                   	pop    %ebp
+  800272:	c3                   	ret
+  800273:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800277:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80027e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800285:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  80028c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800291:	8d 47 01             	lea    0x1(%edi),%eax
+  800294:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800297:	0f b6 17             	movzbl (%edi),%edx
+  80029a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80029d:	3c 55                	cmp    $0x55,%al
+  80029f:	0f 87 cf 03 00 00    	ja     800674 <vprintfmt+0x437>
+  8002a5:	0f b6 c0             	movzbl %al,%eax
+  8002a8:	ff 24 85 60 1a 80 00 	jmp    *0x801a60(,%eax,4)
+  8002af:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002b2:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002b6:	eb d9                	jmp    800291 <vprintfmt+0x54>
+  8002b8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002bb:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002bf:	eb d0                	jmp    800291 <vprintfmt+0x54>
+  8002c1:	0f b6 d2             	movzbl %dl,%edx
+  8002c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8002cf:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002d2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  8002d6:	0f be 17             	movsbl (%edi),%edx
+  8002d9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002dc:	83 f9 09             	cmp    $0x9,%ecx
+  8002df:	77 55                	ja     800336 <vprintfmt+0xf9>
+  8002e1:	83 c7 01             	add    $0x1,%edi
+  8002e4:	eb e9                	jmp    8002cf <vprintfmt+0x92>
+  8002e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002e9:	8b 00                	mov    (%eax),%eax
+  8002eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8002f4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8002f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002fa:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8002fe:	79 91                	jns    800291 <vprintfmt+0x54>
+  800300:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800303:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800306:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80030d:	eb 82                	jmp    800291 <vprintfmt+0x54>
+  80030f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800312:	85 d2                	test   %edx,%edx
+  800314:	b8 00 00 00 00       	mov    $0x0,%eax
+  800319:	0f 49 c2             	cmovns %edx,%eax
+  80031c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80031f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800322:	e9 6a ff ff ff       	jmp    800291 <vprintfmt+0x54>
+  800327:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80032a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800331:	e9 5b ff ff ff       	jmp    800291 <vprintfmt+0x54>
+  800336:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800339:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80033c:	eb bc                	jmp    8002fa <vprintfmt+0xbd>
+  80033e:	83 c1 01             	add    $0x1,%ecx
+  800341:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800344:	e9 48 ff ff ff       	jmp    800291 <vprintfmt+0x54>
+  800349:	8b 45 14             	mov    0x14(%ebp),%eax
+  80034c:	8d 78 04             	lea    0x4(%eax),%edi
+  80034f:	83 ec 08             	sub    $0x8,%esp
+  800352:	53                   	push   %ebx
+  800353:	ff 30                	push   (%eax)
+  800355:	ff d6                	call   *%esi
+  800357:	83 c4 10             	add    $0x10,%esp
+  80035a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80035d:	e9 b1 02 00 00       	jmp    800613 <vprintfmt+0x3d6>
+  800362:	8b 45 14             	mov    0x14(%ebp),%eax
+  800365:	8d 78 04             	lea    0x4(%eax),%edi
+  800368:	8b 10                	mov    (%eax),%edx
+  80036a:	89 d0                	mov    %edx,%eax
+  80036c:	f7 d8                	neg    %eax
+  80036e:	0f 48 c2             	cmovs  %edx,%eax
+  800371:	83 f8 08             	cmp    $0x8,%eax
+  800374:	7f 23                	jg     800399 <vprintfmt+0x15c>
+  800376:	8b 14 85 c0 1b 80 00 	mov    0x801bc0(,%eax,4),%edx
+  80037d:	85 d2                	test   %edx,%edx
+  80037f:	74 18                	je     800399 <vprintfmt+0x15c>
+  800381:	52                   	push   %edx
+  800382:	68 c9 19 80 00       	push   $0x8019c9
+  800387:	53                   	push   %ebx
+  800388:	56                   	push   %esi
+  800389:	e8 92 fe ff ff       	call   800220 <printfmt>
+  80038e:	83 c4 10             	add    $0x10,%esp
+  800391:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800394:	e9 7a 02 00 00       	jmp    800613 <vprintfmt+0x3d6>
+  800399:	50                   	push   %eax
+  80039a:	68 c0 19 80 00       	push   $0x8019c0
+  80039f:	53                   	push   %ebx
+  8003a0:	56                   	push   %esi
+  8003a1:	e8 7a fe ff ff       	call   800220 <printfmt>
+  8003a6:	83 c4 10             	add    $0x10,%esp
+  8003a9:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003ac:	e9 62 02 00 00       	jmp    800613 <vprintfmt+0x3d6>
+  8003b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b4:	83 c0 04             	add    $0x4,%eax
+  8003b7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bd:	8b 08                	mov    (%eax),%ecx
+  8003bf:	85 c9                	test   %ecx,%ecx
+  8003c1:	b8 b9 19 80 00       	mov    $0x8019b9,%eax
+  8003c6:	0f 45 c1             	cmovne %ecx,%eax
+  8003c9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8003cc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d0:	7e 06                	jle    8003d8 <vprintfmt+0x19b>
+  8003d2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003d6:	75 0b                	jne    8003e3 <vprintfmt+0x1a6>
+  8003d8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003db:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003de:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003e1:	eb 5c                	jmp    80043f <vprintfmt+0x202>
+  8003e3:	83 ec 08             	sub    $0x8,%esp
+  8003e6:	ff 75 d0             	push   -0x30(%ebp)
+  8003e9:	ff 75 cc             	push   -0x34(%ebp)
+  8003ec:	e8 87 03 00 00       	call   800778 <strnlen>
+  8003f1:	89 c2                	mov    %eax,%edx
+  8003f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003f6:	29 d0                	sub    %edx,%eax
+  8003f8:	83 c4 10             	add    $0x10,%esp
+  8003fb:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8003ff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800402:	89 75 08             	mov    %esi,0x8(%ebp)
+  800405:	89 c6                	mov    %eax,%esi
+  800407:	eb 0e                	jmp    800417 <vprintfmt+0x1da>
+  800409:	83 ec 08             	sub    $0x8,%esp
+  80040c:	53                   	push   %ebx
+  80040d:	57                   	push   %edi
+  80040e:	ff 55 08             	call   *0x8(%ebp)
+  800411:	83 ee 01             	sub    $0x1,%esi
+  800414:	83 c4 10             	add    $0x10,%esp
+  800417:	85 f6                	test   %esi,%esi
+  800419:	7f ee                	jg     800409 <vprintfmt+0x1cc>
+  80041b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80041e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800421:	85 c0                	test   %eax,%eax
+  800423:	ba 00 00 00 00       	mov    $0x0,%edx
+  800428:	0f 49 d0             	cmovns %eax,%edx
+  80042b:	29 d0                	sub    %edx,%eax
+  80042d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800430:	eb a6                	jmp    8003d8 <vprintfmt+0x19b>
+  800432:	83 ec 08             	sub    $0x8,%esp
+  800435:	53                   	push   %ebx
+  800436:	52                   	push   %edx
+  800437:	ff 55 08             	call   *0x8(%ebp)
+  80043a:	83 c4 10             	add    $0x10,%esp
+  80043d:	89 f1                	mov    %esi,%ecx
+  80043f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800442:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800446:	0f be d0             	movsbl %al,%edx
+  800449:	85 d2                	test   %edx,%edx
+  80044b:	74 28                	je     800475 <vprintfmt+0x238>
+  80044d:	85 ff                	test   %edi,%edi
+  80044f:	78 05                	js     800456 <vprintfmt+0x219>
+  800451:	83 ef 01             	sub    $0x1,%edi
+  800454:	78 30                	js     800486 <vprintfmt+0x249>
+  800456:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80045a:	74 d6                	je     800432 <vprintfmt+0x1f5>
+  80045c:	0f be c0             	movsbl %al,%eax
+  80045f:	83 e8 20             	sub    $0x20,%eax
+  800462:	83 f8 5e             	cmp    $0x5e,%eax
+  800465:	76 cb                	jbe    800432 <vprintfmt+0x1f5>
+  800467:	83 ec 08             	sub    $0x8,%esp
+  80046a:	53                   	push   %ebx
+  80046b:	6a 3f                	push   $0x3f
+  80046d:	ff 55 08             	call   *0x8(%ebp)
+  800470:	83 c4 10             	add    $0x10,%esp
+  800473:	eb c8                	jmp    80043d <vprintfmt+0x200>
+  800475:	8b 75 08             	mov    0x8(%ebp),%esi
+  800478:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80047b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80047e:	01 d0                	add    %edx,%eax
+  800480:	29 c8                	sub    %ecx,%eax
+  800482:	89 c7                	mov    %eax,%edi
+  800484:	eb 13                	jmp    800499 <vprintfmt+0x25c>
+  800486:	8b 75 08             	mov    0x8(%ebp),%esi
+  800489:	eb ed                	jmp    800478 <vprintfmt+0x23b>
+  80048b:	83 ec 08             	sub    $0x8,%esp
+  80048e:	53                   	push   %ebx
+  80048f:	6a 20                	push   $0x20
+  800491:	ff d6                	call   *%esi
+  800493:	83 ef 01             	sub    $0x1,%edi
+  800496:	83 c4 10             	add    $0x10,%esp
+  800499:	85 ff                	test   %edi,%edi
+  80049b:	7f ee                	jg     80048b <vprintfmt+0x24e>
+  80049d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004a3:	e9 6b 01 00 00       	jmp    800613 <vprintfmt+0x3d6>
+  8004a8:	83 f9 01             	cmp    $0x1,%ecx
+  8004ab:	7f 1f                	jg     8004cc <vprintfmt+0x28f>
+  8004ad:	85 c9                	test   %ecx,%ecx
+  8004af:	74 67                	je     800518 <vprintfmt+0x2db>
+  8004b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b4:	8b 00                	mov    (%eax),%eax
+  8004b6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004b9:	89 c1                	mov    %eax,%ecx
+  8004bb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004be:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8004c7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004ca:	eb 17                	jmp    8004e3 <vprintfmt+0x2a6>
+  8004cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cf:	8b 50 04             	mov    0x4(%eax),%edx
+  8004d2:	8b 00                	mov    (%eax),%eax
+  8004d4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004d7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dd:	8d 40 08             	lea    0x8(%eax),%eax
+  8004e0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004e3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004e6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8004e9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8004ee:	85 c9                	test   %ecx,%ecx
+  8004f0:	0f 89 03 01 00 00    	jns    8005f9 <vprintfmt+0x3bc>
+  8004f6:	83 ec 08             	sub    $0x8,%esp
+  8004f9:	53                   	push   %ebx
+  8004fa:	6a 2d                	push   $0x2d
+  8004fc:	ff d6                	call   *%esi
+  8004fe:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800501:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800504:	f7 da                	neg    %edx
+  800506:	83 d1 00             	adc    $0x0,%ecx
+  800509:	f7 d9                	neg    %ecx
+  80050b:	83 c4 10             	add    $0x10,%esp
+  80050e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800513:	e9 e1 00 00 00       	jmp    8005f9 <vprintfmt+0x3bc>
+  800518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051b:	8b 00                	mov    (%eax),%eax
+  80051d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800520:	89 c1                	mov    %eax,%ecx
+  800522:	c1 f9 1f             	sar    $0x1f,%ecx
+  800525:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8d 40 04             	lea    0x4(%eax),%eax
+  80052e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800531:	eb b0                	jmp    8004e3 <vprintfmt+0x2a6>
+  800533:	83 f9 01             	cmp    $0x1,%ecx
+  800536:	7f 1e                	jg     800556 <vprintfmt+0x319>
+  800538:	85 c9                	test   %ecx,%ecx
+  80053a:	74 32                	je     80056e <vprintfmt+0x331>
+  80053c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053f:	8b 10                	mov    (%eax),%edx
+  800541:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800546:	8d 40 04             	lea    0x4(%eax),%eax
+  800549:	89 45 14             	mov    %eax,0x14(%ebp)
+  80054c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800551:	e9 a3 00 00 00       	jmp    8005f9 <vprintfmt+0x3bc>
+  800556:	8b 45 14             	mov    0x14(%ebp),%eax
+  800559:	8b 10                	mov    (%eax),%edx
+  80055b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80055e:	8d 40 08             	lea    0x8(%eax),%eax
+  800561:	89 45 14             	mov    %eax,0x14(%ebp)
+  800564:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800569:	e9 8b 00 00 00       	jmp    8005f9 <vprintfmt+0x3bc>
+  80056e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800571:	8b 10                	mov    (%eax),%edx
+  800573:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800578:	8d 40 04             	lea    0x4(%eax),%eax
+  80057b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800583:	eb 74                	jmp    8005f9 <vprintfmt+0x3bc>
+  800585:	83 f9 01             	cmp    $0x1,%ecx
+  800588:	7f 1b                	jg     8005a5 <vprintfmt+0x368>
+  80058a:	85 c9                	test   %ecx,%ecx
+  80058c:	74 2c                	je     8005ba <vprintfmt+0x37d>
+  80058e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800591:	8b 10                	mov    (%eax),%edx
+  800593:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800598:	8d 40 04             	lea    0x4(%eax),%eax
+  80059b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059e:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005a3:	eb 54                	jmp    8005f9 <vprintfmt+0x3bc>
+  8005a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a8:	8b 10                	mov    (%eax),%edx
+  8005aa:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005ad:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005b8:	eb 3f                	jmp    8005f9 <vprintfmt+0x3bc>
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	8b 10                	mov    (%eax),%edx
+  8005bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ca:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005cf:	eb 28                	jmp    8005f9 <vprintfmt+0x3bc>
+  8005d1:	83 ec 08             	sub    $0x8,%esp
+  8005d4:	53                   	push   %ebx
+  8005d5:	6a 30                	push   $0x30
+  8005d7:	ff d6                	call   *%esi
+  8005d9:	83 c4 08             	add    $0x8,%esp
+  8005dc:	53                   	push   %ebx
+  8005dd:	6a 78                	push   $0x78
+  8005df:	ff d6                	call   *%esi
+  8005e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e4:	8b 10                	mov    (%eax),%edx
+  8005e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005eb:	83 c4 10             	add    $0x10,%esp
+  8005ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f4:	bf 10 00 00 00       	mov    $0x10,%edi
+  8005f9:	83 ec 0c             	sub    $0xc,%esp
+  8005fc:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800600:	50                   	push   %eax
+  800601:	ff 75 e0             	push   -0x20(%ebp)
+  800604:	57                   	push   %edi
+  800605:	51                   	push   %ecx
+  800606:	52                   	push   %edx
+  800607:	89 da                	mov    %ebx,%edx
+  800609:	89 f0                	mov    %esi,%eax
+  80060b:	e8 4a fb ff ff       	call   80015a <printnum>
+  800610:	83 c4 20             	add    $0x20,%esp
+  800613:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800616:	e9 40 fc ff ff       	jmp    80025b <vprintfmt+0x1e>
+  80061b:	83 f9 01             	cmp    $0x1,%ecx
+  80061e:	7f 1b                	jg     80063b <vprintfmt+0x3fe>
+  800620:	85 c9                	test   %ecx,%ecx
+  800622:	74 2c                	je     800650 <vprintfmt+0x413>
+  800624:	8b 45 14             	mov    0x14(%ebp),%eax
+  800627:	8b 10                	mov    (%eax),%edx
+  800629:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062e:	8d 40 04             	lea    0x4(%eax),%eax
+  800631:	89 45 14             	mov    %eax,0x14(%ebp)
+  800634:	bf 10 00 00 00       	mov    $0x10,%edi
+  800639:	eb be                	jmp    8005f9 <vprintfmt+0x3bc>
+  80063b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063e:	8b 10                	mov    (%eax),%edx
+  800640:	8b 48 04             	mov    0x4(%eax),%ecx
+  800643:	8d 40 08             	lea    0x8(%eax),%eax
+  800646:	89 45 14             	mov    %eax,0x14(%ebp)
+  800649:	bf 10 00 00 00       	mov    $0x10,%edi
+  80064e:	eb a9                	jmp    8005f9 <vprintfmt+0x3bc>
+  800650:	8b 45 14             	mov    0x14(%ebp),%eax
+  800653:	8b 10                	mov    (%eax),%edx
+  800655:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065a:	8d 40 04             	lea    0x4(%eax),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800660:	bf 10 00 00 00       	mov    $0x10,%edi
+  800665:	eb 92                	jmp    8005f9 <vprintfmt+0x3bc>
+  800667:	83 ec 08             	sub    $0x8,%esp
+  80066a:	53                   	push   %ebx
+  80066b:	6a 25                	push   $0x25
+  80066d:	ff d6                	call   *%esi
+  80066f:	83 c4 10             	add    $0x10,%esp
+  800672:	eb 9f                	jmp    800613 <vprintfmt+0x3d6>
+  800674:	83 ec 08             	sub    $0x8,%esp
+  800677:	53                   	push   %ebx
+  800678:	6a 25                	push   $0x25
+  80067a:	ff d6                	call   *%esi
+  80067c:	83 c4 10             	add    $0x10,%esp
+  80067f:	89 f8                	mov    %edi,%eax
+  800681:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800685:	74 05                	je     80068c <vprintfmt+0x44f>
+  800687:	83 e8 01             	sub    $0x1,%eax
+  80068a:	eb f5                	jmp    800681 <vprintfmt+0x444>
+  80068c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80068f:	eb 82                	jmp    800613 <vprintfmt+0x3d6>
+
+00800691 <vsnprintf>:
+  800691:	55                   	push   %ebp
+  800692:	89 e5                	mov    %esp,%ebp
+  800694:	83 ec 18             	sub    $0x18,%esp
+  800697:	8b 45 08             	mov    0x8(%ebp),%eax
+  80069a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80069d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006a0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006a4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8006ae:	85 c0                	test   %eax,%eax
+  8006b0:	74 26                	je     8006d8 <vsnprintf+0x47>
+  8006b2:	85 d2                	test   %edx,%edx
+  8006b4:	7e 22                	jle    8006d8 <vsnprintf+0x47>
+  8006b6:	ff 75 14             	push   0x14(%ebp)
+  8006b9:	ff 75 10             	push   0x10(%ebp)
+  8006bc:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006bf:	50                   	push   %eax
+  8006c0:	68 03 02 80 00       	push   $0x800203
+  8006c5:	e8 73 fb ff ff       	call   80023d <vprintfmt>
+  8006ca:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006cd:	c6 00 00             	movb   $0x0,(%eax)
+  8006d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006d3:	83 c4 10             	add    $0x10,%esp
+  8006d6:	c9                   	leave
+  8006d7:	c3                   	ret
+  8006d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006dd:	eb f7                	jmp    8006d6 <vsnprintf+0x45>
+
+008006df <snprintf>:
+  8006df:	55                   	push   %ebp
+  8006e0:	89 e5                	mov    %esp,%ebp
+  8006e2:	83 ec 08             	sub    $0x8,%esp
+  8006e5:	8d 45 14             	lea    0x14(%ebp),%eax
+  8006e8:	50                   	push   %eax
+  8006e9:	ff 75 10             	push   0x10(%ebp)
+  8006ec:	ff 75 0c             	push   0xc(%ebp)
+  8006ef:	ff 75 08             	push   0x8(%ebp)
+  8006f2:	e8 9a ff ff ff       	call   800691 <vsnprintf>
+  8006f7:	c9                   	leave
+  8006f8:	c3                   	ret
+
+008006f9 <copy_fwd>:
+  8006f9:	55                   	push   %ebp
+  8006fa:	89 e5                	mov    %esp,%ebp
+  8006fc:	57                   	push   %edi
+  8006fd:	56                   	push   %esi
+  8006fe:	53                   	push   %ebx
+  8006ff:	89 c7                	mov    %eax,%edi
+  800701:	89 d6                	mov    %edx,%esi
+  800703:	89 c8                	mov    %ecx,%eax
+  800705:	83 f9 0f             	cmp    $0xf,%ecx
+  800708:	76 1c                	jbe    800726 <copy_fwd+0x2d>
+  80070a:	89 f9                	mov    %edi,%ecx
+  80070c:	f7 d9                	neg    %ecx
+  80070e:	89 cb                	mov    %ecx,%ebx
+  800710:	83 e3 03             	and    $0x3,%ebx
+  800713:	29 d8                	sub    %ebx,%eax
+  800715:	89 c2                	mov    %eax,%edx
+  800717:	c1 ea 02             	shr    $0x2,%edx
+  80071a:	83 e0 03             	and    $0x3,%eax
+  80071d:	89 d9                	mov    %ebx,%ecx
+  80071f:	fc                   	cld
+  800720:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800722:	89 d1                	mov    %edx,%ecx
+  800724:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800726:	89 c1                	mov    %eax,%ecx
+  800728:	fc                   	cld
+  800729:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80072b:	5b                   	pop    %ebx
+  80072c:	5e                   	pop    %esi
+  80072d:	5f                   	pop    %edi
+  80072e:	5d                   	pop    %ebp
+  80072f:	c3                   	ret
+
+00800730 <have_sse2>:
+  800730:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800737:	78 06                	js     80073f <have_sse2+0xf>
+  800739:	a1 04 20 80 00       	mov    0x802004,%eax
+  80073e:	c3                   	ret
+  80073f:	55                   	push   %ebp
+  800740:	89 e5                	mov    %esp,%ebp
+  800742:	53                   	push   %ebx
+  800743:	b8 01 00 00 00       	mov    $0x1,%eax
+  800748:	0f a2                	cpuid
+  80074a:	c1 ea 1a             	shr    $0x1a,%edx
+  80074d:	83 e2 01             	and    $0x1,%edx
+  800750:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800756:	a1 04 20 80 00       	mov    0x802004,%eax
+  80075b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80075e:	c9                   	leave
+  80075f:	c3                   	ret
+
+00800760 <strlen>:
+  800760:	55                   	push   %ebp
+  800761:	89 e5                	mov    %esp,%ebp
+  800763:	8b 55 08             	mov    0x8(%ebp),%edx
+  800766:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076b:	eb 03                	jmp    800770 <strlen+0x10>
+  80076d:	83 c0 01             	add    $0x1,%eax
+  800770:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800774:	75 f7                	jne    80076d <strlen+0xd>
+  800776:	5d                   	pop    %ebp
+  800777:	c3                   	ret
+
+00800778 <strnlen>:
+  800778:	55                   	push   %ebp
+  800779:	89 e5                	mov    %esp,%ebp
+  80077b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80077e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800781:	b8 00 00 00 00       	mov    $0x0,%eax
+  800786:	eb 03                	jmp    80078b <strnlen+0x13>
+  800788:	83 c0 01             	add    $0x1,%eax
+  80078b:	39 d0                	cmp    %edx,%eax
+  80078d:	74 08                	je     800797 <strnlen+0x1f>
+  80078f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800793:	75 f3                	jne    800788 <strnlen+0x10>
+  800795:	89 c2                	mov    %eax,%edx
+  800797:	89 d0                	mov    %edx,%eax
+  800799:	5d                   	pop    %ebp
+  80079a:	c3                   	ret
+
+0080079b <strcpy>:
+  80079b:	55                   	push   %ebp
+  80079c:	89 e5                	mov    %esp,%ebp
+  80079e:	53                   	push   %ebx
+  80079f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007aa:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007ae:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007b1:	83 c0 01             	add    $0x1,%eax
+  8007b4:	84 d2                	test   %dl,%dl
+  8007b6:	75 f2                	jne    8007aa <strcpy+0xf>
+  8007b8:	89 c8                	mov    %ecx,%eax
+  8007ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007bd:	c9                   	leave
+  8007be:	c3                   	ret
+
+008007bf <strcat>:
+  8007bf:	55                   	push   %ebp
+  8007c0:	89 e5                	mov    %esp,%ebp
+  8007c2:	53                   	push   %ebx
+  8007c3:	83 ec 10             	sub    $0x10,%esp
+  8007c6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8007c9:	53                   	push   %ebx
+  8007ca:	e8 91 ff ff ff       	call   800760 <strlen>
+  8007cf:	83 c4 08             	add    $0x8,%esp
+  8007d2:	ff 75 0c             	push   0xc(%ebp)
+  8007d5:	01 d8                	add    %ebx,%eax
+  8007d7:	50                   	push   %eax
+  8007d8:	e8 be ff ff ff       	call   80079b <strcpy>
+  8007dd:	89 d8                	mov    %ebx,%eax
+  8007df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007e2:	c9                   	leave
+  8007e3:	c3                   	ret
+
+008007e4 <strncpy>:
+  8007e4:	55                   	push   %ebp
+  8007e5:	89 e5                	mov    %esp,%ebp
+  8007e7:	56                   	push   %esi
+  8007e8:	53                   	push   %ebx
+  8007e9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007ef:	89 f3                	mov    %esi,%ebx
+  8007f1:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007f4:	89 f0                	mov    %esi,%eax
+  8007f6:	eb 0f                	jmp    800807 <strncpy+0x23>
+  8007f8:	83 c0 01             	add    $0x1,%eax
+  8007fb:	0f b6 0a             	movzbl (%edx),%ecx
+  8007fe:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800801:	80 f9 01             	cmp    $0x1,%cl
+  800804:	83 da ff             	sbb    $0xffffffff,%edx
+  800807:	39 d8                	cmp    %ebx,%eax
+  800809:	75 ed                	jne    8007f8 <strncpy+0x14>
+  80080b:	89 f0                	mov    %esi,%eax
+  80080d:	5b                   	pop    %ebx
+  80080e:	5e                   	pop    %esi
+  80080f:	5d                   	pop    %ebp
+  800810:	c3                   	ret
+
+00800811 <strlcpy>:
+  800811:	55                   	push   %ebp
+  800812:	89 e5                	mov    %esp,%ebp
+  800814:	56                   	push   %esi
+  800815:	53                   	push   %ebx
+  800816:	8b 75 08             	mov    0x8(%ebp),%esi
+  800819:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80081c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80081f:	89 f0                	mov    %esi,%eax
+  800821:	85 d2                	test   %edx,%edx
+  800823:	74 21                	je     800846 <strlcpy+0x35>
+  800825:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800829:	89 f2                	mov    %esi,%edx
+  80082b:	eb 09                	jmp    800836 <strlcpy+0x25>
+  80082d:	83 c1 01             	add    $0x1,%ecx
+  800830:	83 c2 01             	add    $0x1,%edx
+  800833:	88 5a ff             	mov    %bl,-0x1(%edx)
+  800836:	39 c2                	cmp    %eax,%edx
+  800838:	74 09                	je     800843 <strlcpy+0x32>
+  80083a:	0f b6 19             	movzbl (%ecx),%ebx
+  80083d:	84 db                	test   %bl,%bl
+  80083f:	75 ec                	jne    80082d <strlcpy+0x1c>
+  800841:	89 d0                	mov    %edx,%eax
+  800843:	c6 00 00             	movb   $0x0,(%eax)
+  800846:	29 f0                	sub    %esi,%eax
+  800848:	5b                   	pop    %ebx
+  800849:	5e                   	pop    %esi
+  80084a:	5d                   	pop    %ebp
+  80084b:	c3                   	ret
+
+0080084c <strcmp>:
+  80084c:	55                   	push   %ebp
+  80084d:	89 e5                	mov    %esp,%ebp
+  80084f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800852:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800855:	eb 06                	jmp    80085d <strcmp+0x11>
+  800857:	83 c1 01             	add    $0x1,%ecx
+  80085a:	83 c2 01             	add    $0x1,%edx
+  80085d:	0f b6 01             	movzbl (%ecx),%eax
+  800860:	84 c0                	test   %al,%al
+  800862:	74 04                	je     800868 <strcmp+0x1c>
+  800864:	3a 02                	cmp    (%edx),%al
+  800866:	74 ef                	je     800857 <strcmp+0xb>
+  800868:	0f b6 c0             	movzbl %al,%eax
+  80086b:	0f b6 12             	movzbl (%edx),%edx
+  80086e:	29 d0                	sub    %edx,%eax
+  800870:	5d                   	pop    %ebp
+  800871:	c3                   	ret
+
+00800872 <strncmp>:
+  800872:	55                   	push   %ebp
+  800873:	89 e5                	mov    %esp,%ebp
+  800875:	53                   	push   %ebx
+  800876:	8b 45 08             	mov    0x8(%ebp),%eax
+  800879:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80087c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80087f:	eb 09                	jmp    80088a <strncmp+0x18>
+  800881:	83 ea 01             	sub    $0x1,%edx
+  800884:	83 c0 01             	add    $0x1,%eax
+  800887:	83 c1 01             	add    $0x1,%ecx
+  80088a:	85 d2                	test   %edx,%edx
+  80088c:	74 18                	je     8008a6 <strncmp+0x34>
+  80088e:	0f b6 18             	movzbl (%eax),%ebx
+  800891:	84 db                	test   %bl,%bl
+  800893:	74 04                	je     800899 <strncmp+0x27>
+  800895:	3a 19                	cmp    (%ecx),%bl
+  800897:	74 e8                	je     800881 <strncmp+0xf>
+  800899:	0f b6 00             	movzbl (%eax),%eax
+  80089c:	0f b6 11             	movzbl (%ecx),%edx
+  80089f:	29 d0                	sub    %edx,%eax
+  8008a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a4:	c9                   	leave
+  8008a5:	c3                   	ret
+  8008a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ab:	eb f4                	jmp    8008a1 <strncmp+0x2f>
+
+008008ad <strchr>:
+  8008ad:	55                   	push   %ebp
+  8008ae:	89 e5                	mov    %esp,%ebp
+  8008b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8008b7:	eb 03                	jmp    8008bc <strchr+0xf>
+  8008b9:	83 c0 01             	add    $0x1,%eax
+  8008bc:	0f b6 10             	movzbl (%eax),%edx
+  8008bf:	84 d2                	test   %dl,%dl
+  8008c1:	74 06                	je     8008c9 <strchr+0x1c>
+  8008c3:	38 ca                	cmp    %cl,%dl
+  8008c5:	75 f2                	jne    8008b9 <strchr+0xc>
+  8008c7:	eb 05                	jmp    8008ce <strchr+0x21>
+  8008c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ce:	5d                   	pop    %ebp
+  8008cf:	c3                   	ret
+
+008008d0 <strfind>:
+  8008d0:	55                   	push   %ebp
+  8008d1:	89 e5                	mov    %esp,%ebp
+  8008d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8008da:	0f b6 10             	movzbl (%eax),%edx
+  8008dd:	38 ca                	cmp    %cl,%dl
+  8008df:	74 09                	je     8008ea <strfind+0x1a>
+  8008e1:	84 d2                	test   %dl,%dl
+  8008e3:	74 05                	je     8008ea <strfind+0x1a>
+  8008e5:	83 c0 01             	add    $0x1,%eax
+  8008e8:	eb f0                	jmp    8008da <strfind+0xa>
+  8008ea:	5d                   	pop    %ebp
+  8008eb:	c3                   	ret
+
+008008ec <memset>:
+  8008ec:	55                   	push   %ebp
+  8008ed:	89 e5                	mov    %esp,%ebp
+  8008ef:	57                   	push   %edi
+  8008f0:	56                   	push   %esi
+  8008f1:	53                   	push   %ebx
+  8008f2:	83 ec 04             	sub    $0x4,%esp
+  8008f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f8:	8b 55 10             	mov    0x10(%ebp),%edx
+  8008fb:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  8008ff:	89 f7                	mov    %esi,%edi
+  800901:	83 fa 0f             	cmp    $0xf,%edx
+  800904:	76 24                	jbe    80092a <memset+0x3e>
+  800906:	89 f1                	mov    %esi,%ecx
+  800908:	f7 d9                	neg    %ecx
+  80090a:	83 e1 03             	and    $0x3,%ecx
+  80090d:	29 ca                	sub    %ecx,%edx
+  80090f:	89 d0                	mov    %edx,%eax
+  800911:	c1 e8 02             	shr    $0x2,%eax
+  800914:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  800917:	83 e2 03             	and    $0x3,%edx
+  80091a:	89 d8                	mov    %ebx,%eax
+  80091c:	fc                   	cld
+  80091d:	f3 aa                	rep stos %al,%es:(%edi)
+  80091f:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  800925:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  800928:	f3 ab                	rep stos %eax,%es:(%edi)
+  80092a:	89 d1                	mov    %edx,%ecx
+  80092c:	89 d8                	mov    %ebx,%eax
+  80092e:	fc                   	cld
+  80092f:	f3 aa                	rep stos %al,%es:(%edi)
+  800931:	89 f0                	mov    %esi,%eax
+  800933:	83 c4 04             	add    $0x4,%esp
+  800936:	5b                   	pop    %ebx
+  800937:	5e                   	pop    %esi
+  800938:	5f                   	pop    %edi
+  800939:	5d                   	pop    %ebp
+  80093a:	c3                   	ret
+
+0080093b <memmove>:
+  80093b:	55                   	push   %ebp
+  80093c:	89 e5                	mov    %esp,%ebp
+  80093e:	57                   	push   %edi
+  80093f:	56                   	push   %esi
+  800940:	53                   	push   %ebx
+  800941:	83 ec 0c             	sub    $0xc,%esp
+  800944:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800947:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80094a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80094d:	85 c0                	test   %eax,%eax
+  80094f:	74 14                	je     800965 <memmove+0x2a>
+  800951:	39 da                	cmp    %ebx,%edx
+  800953:	73 07                	jae    80095c <memmove+0x21>
+  800955:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  800958:	39 cb                	cmp    %ecx,%ebx
+  80095a:	72 13                	jb     80096f <memmove+0x34>
+  80095c:	89 c1                	mov    %eax,%ecx
+  80095e:	89 d8                	mov    %ebx,%eax
+  800960:	e8 94 fd ff ff       	call   8006f9 <copy_fwd>
+  800965:	89 d8                	mov    %ebx,%eax
+  800967:	83 c4 0c             	add    $0xc,%esp
+  80096a:	5b                   	pop    %ebx
+  80096b:	5e                   	pop    %esi
+  80096c:	5f                   	pop    %edi
+  80096d:	5d                   	pop    %ebp
+  80096e:	c3                   	ret
+  80096f:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800972:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800975:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800978:	83 f8 0f             	cmp    $0xf,%eax
+  80097b:	76 23                	jbe    8009a0 <memmove+0x65>
+  80097d:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800980:	83 e1 03             	and    $0x3,%ecx
+  800983:	29 c8                	sub    %ecx,%eax
+  800985:	89 c2                	mov    %eax,%edx
+  800987:	c1 ea 02             	shr    $0x2,%edx
+  80098a:	83 e0 03             	and    $0x3,%eax
+  80098d:	fd                   	std
+  80098e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800990:	83 ef 03             	sub    $0x3,%edi
+  800993:	83 ee 03             	sub    $0x3,%esi
+  800996:	89 d1                	mov    %edx,%ecx
+  800998:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80099a:	83 c7 03             	add    $0x3,%edi
+  80099d:	83 c6 03             	add    $0x3,%esi
+  8009a0:	89 c1                	mov    %eax,%ecx
+  8009a2:	fd                   	std
+  8009a3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8009a5:	fc                   	cld
+  8009a6:	eb bd                	jmp    800965 <memmove+0x2a>
+
+008009a8 <memcpy>:
+  8009a8:	55                   	push   %ebp
+  8009a9:	89 e5                	mov    %esp,%ebp
+  8009ab:	53                   	push   %ebx
+  8009ac:	83 ec 04             	sub    $0x4,%esp
+  8009af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009b2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8009b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009b8:	89 d8                	mov    %ebx,%eax
+  8009ba:	e8 3a fd ff ff       	call   8006f9 <copy_fwd>
+  8009bf:	89 d8                	mov    %ebx,%eax
+  8009c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c4:	c9                   	leave
+  8009c5:	c3                   	ret
+
+008009c6 <page_copy>:
+  8009c6:	55                   	push   %ebp
+  8009c7:	89 e5                	mov    %esp,%ebp
+  8009c9:	57                   	push   %edi
+  8009ca:	56                   	push   %esi
+  8009cb:	53                   	push   %ebx
+  8009cc:	83 ec 0c             	sub    $0xc,%esp
+  8009cf:	e8 5c fd ff ff       	call   800730 <have_sse2>
+  8009d4:	85 c0                	test   %eax,%eax
+  8009d6:	74 39                	je     800a11 <page_copy+0x4b>
+  8009d8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009de:	be 00 01 00 00       	mov    $0x100,%esi
+  8009e3:	8b 03                	mov    (%ebx),%eax
+  8009e5:	8b 53 04             	mov    0x4(%ebx),%edx
+  8009e8:	0f c3 01             	movnti %eax,(%ecx)
+  8009eb:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  8009ef:	8b 43 08             	mov    0x8(%ebx),%eax
+  8009f2:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8009f5:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  8009f9:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  8009fd:	83 c3 10             	add    $0x10,%ebx
+  800a00:	83 c1 10             	add    $0x10,%ecx
+  800a03:	4e                   	dec    %esi
+  800a04:	75 dd                	jne    8009e3 <page_copy+0x1d>
+  800a06:	0f ae f8             	sfence
+  800a09:	83 c4 0c             	add    $0xc,%esp
+  800a0c:	5b                   	pop    %ebx
+  800a0d:	5e                   	pop    %esi
+  800a0e:	5f                   	pop    %edi
+  800a0f:	5d                   	pop    %ebp
+  800a10:	c3                   	ret
+  800a11:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a14:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a17:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800a1c:	fc                   	cld
+  800a1d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a1f:	eb e8                	jmp    800a09 <page_copy+0x43>
+
+00800a21 <page_zero>:
+  800a21:	55                   	push   %ebp
+  800a22:	89 e5                	mov    %esp,%ebp
+  800a24:	57                   	push   %edi
+  800a25:	83 ec 04             	sub    $0x4,%esp
+  800a28:	e8 03 fd ff ff       	call   800730 <have_sse2>
+  800a2d:	85 c0                	test   %eax,%eax
+  800a2f:	74 3a                	je     800a6b <page_zero+0x4a>
+  800a31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a34:	ba 80 00 00 00       	mov    $0x80,%edx
+  800a39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a3e:	0f c3 08             	movnti %ecx,(%eax)
+  800a41:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800a45:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800a49:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800a4d:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800a51:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800a55:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800a59:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800a5d:	83 c0 20             	add    $0x20,%eax
+  800a60:	4a                   	dec    %edx
+  800a61:	75 db                	jne    800a3e <page_zero+0x1d>
+  800a63:	0f ae f8             	sfence
+  800a66:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a69:	c9                   	leave
+  800a6a:	c3                   	ret
+  800a6b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a6e:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800a73:	fc                   	cld
+  800a74:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a76:	eb ee                	jmp    800a66 <page_zero+0x45>
+
+00800a78 <memcmp>:
+  800a78:	55                   	push   %ebp
+  800a79:	89 e5                	mov    %esp,%ebp
+  800a7b:	56                   	push   %esi
+  800a7c:	53                   	push   %ebx
+  800a7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a80:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a83:	89 c6                	mov    %eax,%esi
+  800a85:	03 75 10             	add    0x10(%ebp),%esi
+  800a88:	eb 06                	jmp    800a90 <memcmp+0x18>
+  800a8a:	83 c0 01             	add    $0x1,%eax
+  800a8d:	83 c2 01             	add    $0x1,%edx
+  800a90:	39 f0                	cmp    %esi,%eax
+  800a92:	74 14                	je     800aa8 <memcmp+0x30>
+  800a94:	0f b6 08             	movzbl (%eax),%ecx
+  800a97:	0f b6 1a             	movzbl (%edx),%ebx
+  800a9a:	38 d9                	cmp    %bl,%cl
+  800a9c:	74 ec                	je     800a8a <memcmp+0x12>
+  800a9e:	0f b6 c1             	movzbl %cl,%eax
+  800aa1:	0f b6 db             	movzbl %bl,%ebx
+  800aa4:	29 d8                	sub    %ebx,%eax
+  800aa6:	eb 05                	jmp    800aad <memcmp+0x35>
+  800aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aad:	5b                   	pop    %ebx
+  800aae:	5e                   	pop    %esi
+  800aaf:	5d                   	pop    %ebp
+  800ab0:	c3                   	ret
+
+00800ab1 <memfind>:
+  800ab1:	55                   	push   %ebp
+  800ab2:	89 e5                	mov    %esp,%ebp
+  800ab4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aba:	89 c2                	mov    %eax,%edx
+  800abc:	03 55 10             	add    0x10(%ebp),%edx
+  800abf:	eb 03                	jmp    800ac4 <memfind+0x13>
+  800ac1:	83 c0 01             	add    $0x1,%eax
+  800ac4:	39 d0                	cmp    %edx,%eax
+  800ac6:	73 04                	jae    800acc <memfind+0x1b>
+  800ac8:	38 08                	cmp    %cl,(%eax)
+  800aca:	75 f5                	jne    800ac1 <memfind+0x10>
+  800acc:	5d                   	pop    %ebp
+  800acd:	c3                   	ret
+
+00800ace <strtol>:
+  800ace:	55                   	push   %ebp
+  800acf:	89 e5                	mov    %esp,%ebp
+  800ad1:	57                   	push   %edi
+  800ad2:	56                   	push   %esi
+  800ad3:	53                   	push   %ebx
+  800ad4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ad7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ada:	eb 03                	jmp    800adf <strtol+0x11>
+  800adc:	83 c2 01             	add    $0x1,%edx
+  800adf:	0f b6 02             	movzbl (%edx),%eax
+  800ae2:	3c 20                	cmp    $0x20,%al
+  800ae4:	74 f6                	je     800adc <strtol+0xe>
+  800ae6:	3c 09                	cmp    $0x9,%al
+  800ae8:	74 f2                	je     800adc <strtol+0xe>
+  800aea:	3c 2b                	cmp    $0x2b,%al
+  800aec:	74 2a                	je     800b18 <strtol+0x4a>
+  800aee:	bf 00 00 00 00       	mov    $0x0,%edi
+  800af3:	3c 2d                	cmp    $0x2d,%al
+  800af5:	74 2b                	je     800b22 <strtol+0x54>
+  800af7:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800afd:	75 0f                	jne    800b0e <strtol+0x40>
+  800aff:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b02:	74 28                	je     800b2c <strtol+0x5e>
+  800b04:	85 db                	test   %ebx,%ebx
+  800b06:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b0b:	0f 44 d8             	cmove  %eax,%ebx
+  800b0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b13:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b16:	eb 46                	jmp    800b5e <strtol+0x90>
+  800b18:	83 c2 01             	add    $0x1,%edx
+  800b1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b20:	eb d5                	jmp    800af7 <strtol+0x29>
+  800b22:	83 c2 01             	add    $0x1,%edx
+  800b25:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b2a:	eb cb                	jmp    800af7 <strtol+0x29>
+  800b2c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b30:	74 0e                	je     800b40 <strtol+0x72>
+  800b32:	85 db                	test   %ebx,%ebx
+  800b34:	75 d8                	jne    800b0e <strtol+0x40>
+  800b36:	83 c2 01             	add    $0x1,%edx
+  800b39:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b3e:	eb ce                	jmp    800b0e <strtol+0x40>
+  800b40:	83 c2 02             	add    $0x2,%edx
+  800b43:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b48:	eb c4                	jmp    800b0e <strtol+0x40>
+  800b4a:	0f be c0             	movsbl %al,%eax
+  800b4d:	83 e8 30             	sub    $0x30,%eax
+  800b50:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b53:	7d 3a                	jge    800b8f <strtol+0xc1>
+  800b55:	83 c2 01             	add    $0x1,%edx
+  800b58:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b5c:	01 c1                	add    %eax,%ecx
+  800b5e:	0f b6 02             	movzbl (%edx),%eax
+  800b61:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b64:	89 f3                	mov    %esi,%ebx
+  800b66:	80 fb 09             	cmp    $0x9,%bl
+  800b69:	76 df                	jbe    800b4a <strtol+0x7c>
+  800b6b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b6e:	89 f3                	mov    %esi,%ebx
+  800b70:	80 fb 19             	cmp    $0x19,%bl
+  800b73:	77 08                	ja     800b7d <strtol+0xaf>
+  800b75:	0f be c0             	movsbl %al,%eax
+  800b78:	83 e8 57             	sub    $0x57,%eax
+  800b7b:	eb d3                	jmp    800b50 <strtol+0x82>
+  800b7d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b80:	89 f3                	mov    %esi,%ebx
+  800b82:	80 fb 19             	cmp    $0x19,%bl
+  800b85:	77 08                	ja     800b8f <strtol+0xc1>
+  800b87:	0f be c0             	movsbl %al,%eax
+  800b8a:	83 e8 37             	sub    $0x37,%eax
+  800b8d:	eb c1                	jmp    800b50 <strtol+0x82>
+  800b8f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b93:	74 05                	je     800b9a <strtol+0xcc>
+  800b95:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b98:	89 10                	mov    %edx,(%eax)
+  800b9a:	89 c8                	mov    %ecx,%eax
+  800b9c:	f7 d8                	neg    %eax
+  800b9e:	85 ff                	test   %edi,%edi
+  800ba0:	0f 45 c8             	cmovne %eax,%ecx
+  800ba3:	89 c8                	mov    %ecx,%eax
+  800ba5:	5b                   	pop    %ebx
+  800ba6:	5e                   	pop    %esi
+  800ba7:	5f                   	pop    %edi
+  800ba8:	5d                   	pop    %ebp
+  800ba9:	c3                   	ret
+
+00800baa <sys_cputs>:
+  800baa:	55                   	push   %ebp
+  800bab:	89 e5                	mov    %esp,%ebp
+  800bad:	57                   	push   %edi
+  800bae:	56                   	push   %esi
+  800baf:	53                   	push   %ebx
+  800bb0:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800bb7:	78 21                	js     800bda <sys_cputs+0x30>
+  800bb9:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800bc0:	75 2d                	jne    800bef <sys_cputs+0x45>
+  800bc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bcd:	89 c3                	mov    %eax,%ebx
+  800bcf:	89 c7                	mov    %eax,%edi
+  800bd1:	89 c6                	mov    %eax,%esi
+  800bd3:	cd 30                	int    $0x30
+  800bd5:	5b                   	pop    %ebx
+  800bd6:	5e                   	pop    %esi
+  800bd7:	5f                   	pop    %edi
+  800bd8:	5d                   	pop    %ebp
+  800bd9:	c3                   	ret
+  800bda:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bdf:	0f a2                	cpuid
+  800be1:	c1 ea 0b             	shr    $0xb,%edx
+  800be4:	83 e2 01             	and    $0x1,%edx
+  800be7:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800bed:	eb ca                	jmp    800bb9 <sys_cputs+0xf>
+  800bef:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bfa:	89 c3                	mov    %eax,%ebx
+  800bfc:	89 c7                	mov    %eax,%edi
+  800bfe:	89 c6                	mov    %eax,%esi
+  800c00:	55                   	push   %ebp
+  800c01:	68 0a 0c 80 00       	push   $0x800c0a
+  800c06:	89 e5                	mov    %esp,%ebp
+  800c08:	0f 34                	sysenter
+  800c0a:	83 c4 04             	add    $0x4,%esp
+  800c0d:	5d                   	pop    %ebp
+  800c0e:	eb c5                	jmp    800bd5 <sys_cputs+0x2b>
+
+00800c10 <sys_cgetc>:
+  800c10:	55                   	push   %ebp
+  800c11:	89 e5                	mov    %esp,%ebp
+  800c13:	57                   	push   %edi
+  800c14:	56                   	push   %esi
+  800c15:	53                   	push   %ebx
+  800c16:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c1d:	78 22                	js     800c41 <sys_cgetc+0x31>
+  800c1f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c26:	75 2e                	jne    800c56 <sys_cgetc+0x46>
+  800c28:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c2d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c32:	89 d1                	mov    %edx,%ecx
+  800c34:	89 d3                	mov    %edx,%ebx
+  800c36:	89 d7                	mov    %edx,%edi
+  800c38:	89 d6                	mov    %edx,%esi
+  800c3a:	cd 30                	int    $0x30
+  800c3c:	5b                   	pop    %ebx
+  800c3d:	5e                   	pop    %esi
+  800c3e:	5f                   	pop    %edi
+  800c3f:	5d                   	pop    %ebp
+  800c40:	c3                   	ret
+  800c41:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c46:	0f a2                	cpuid
+  800c48:	c1 ea 0b             	shr    $0xb,%edx
+  800c4b:	83 e2 01             	and    $0x1,%edx
+  800c4e:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800c54:	eb c9                	jmp    800c1f <sys_cgetc+0xf>
+  800c56:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c5b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c60:	89 d1                	mov    %edx,%ecx
+  800c62:	89 d3                	mov    %edx,%ebx
+  800c64:	89 d7                	mov    %edx,%edi
+  800c66:	89 d6                	mov    %edx,%esi
+  800c68:	55                   	push   %ebp
+  800c69:	68 72 0c 80 00       	push   $0x800c72
+  800c6e:	89 e5                	mov    %esp,%ebp
+  800c70:	0f 34                	sysenter
+  800c72:	83 c4 04             	add    $0x4,%esp
+  800c75:	5d                   	pop    %ebp
+  800c76:	eb c4                	jmp    800c3c <sys_cgetc+0x2c>
+
+00800c78 <sys_env_destroy>:
+  800c78:	55                   	push   %ebp
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	57                   	push   %edi
+  800c7c:	56                   	push   %esi
+  800c7d:	53                   	push   %ebx
+  800c7e:	83 ec 0c             	sub    $0xc,%esp
+  800c81:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c88:	78 2a                	js     800cb4 <sys_env_destroy+0x3c>
+  800c8a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c91:	75 36                	jne    800cc9 <sys_env_destroy+0x51>
+  800c93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c98:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca0:	89 cb                	mov    %ecx,%ebx
+  800ca2:	89 cf                	mov    %ecx,%edi
+  800ca4:	89 ce                	mov    %ecx,%esi
+  800ca6:	cd 30                	int    $0x30
+  800ca8:	85 c0                	test   %eax,%eax
+  800caa:	7f 40                	jg     800cec <sys_env_destroy+0x74>
+  800cac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800caf:	5b                   	pop    %ebx
+  800cb0:	5e                   	pop    %esi
+  800cb1:	5f                   	pop    %edi
+  800cb2:	5d                   	pop    %ebp
+  800cb3:	c3                   	ret
+  800cb4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cb9:	0f a2                	cpuid
+  800cbb:	c1 ea 0b             	shr    $0xb,%edx
+  800cbe:	83 e2 01             	and    $0x1,%edx
+  800cc1:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800cc7:	eb c1                	jmp    800c8a <sys_env_destroy+0x12>
+  800cc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ccc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cd1:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cd6:	89 cb                	mov    %ecx,%ebx
+  800cd8:	89 cf                	mov    %ecx,%edi
+  800cda:	89 ce                	mov    %ecx,%esi
+  800cdc:	55                   	push   %ebp
+  800cdd:	68 e6 0c 80 00       	push   $0x800ce6
+  800ce2:	89 e5                	mov    %esp,%ebp
+  800ce4:	0f 34                	sysenter
+  800ce6:	83 c4 04             	add    $0x4,%esp
+  800ce9:	5d                   	pop    %ebp
+  800cea:	eb bc                	jmp    800ca8 <sys_env_destroy+0x30>
+  800cec:	83 ec 0c             	sub    $0xc,%esp
+  800cef:	50                   	push   %eax
+  800cf0:	6a 03                	push   $0x3
+  800cf2:	68 e4 1b 80 00       	push   $0x801be4
+  800cf7:	6a 49                	push   $0x49
+  800cf9:	68 01 1c 80 00       	push   $0x801c01
+  800cfe:	e8 af 09 00 00       	call   8016b2 <_panic>
+
+00800d03 <sys_getenvid>:
+  800d03:	55                   	push   %ebp
+  800d04:	89 e5                	mov    %esp,%ebp
+  800d06:	57                   	push   %edi
+  800d07:	56                   	push   %esi
+  800d08:	53                   	push   %ebx
+  800d09:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d10:	78 22                	js     800d34 <sys_getenvid+0x31>
+  800d12:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d19:	75 2e                	jne    800d49 <sys_getenvid+0x46>
+  800d1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d20:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d25:	89 d1                	mov    %edx,%ecx
+  800d27:	89 d3                	mov    %edx,%ebx
+  800d29:	89 d7                	mov    %edx,%edi
+  800d2b:	89 d6                	mov    %edx,%esi
+  800d2d:	cd 30                	int    $0x30
+  800d2f:	5b                   	pop    %ebx
+  800d30:	5e                   	pop    %esi
+  800d31:	5f                   	pop    %edi
+  800d32:	5d                   	pop    %ebp
+  800d33:	c3                   	ret
+  800d34:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d39:	0f a2                	cpuid
+  800d3b:	c1 ea 0b             	shr    $0xb,%edx
+  800d3e:	83 e2 01             	and    $0x1,%edx
+  800d41:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800d47:	eb c9                	jmp    800d12 <sys_getenvid+0xf>
+  800d49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d53:	89 d1                	mov    %edx,%ecx
+  800d55:	89 d3                	mov    %edx,%ebx
+  800d57:	89 d7                	mov    %edx,%edi
+  800d59:	89 d6                	mov    %edx,%esi
+  800d5b:	55                   	push   %ebp
+  800d5c:	68 65 0d 80 00       	push   $0x800d65
+  800d61:	89 e5                	mov    %esp,%ebp
+  800d63:	0f 34                	sysenter
+  800d65:	83 c4 04             	add    $0x4,%esp
+  800d68:	5d                   	pop    %ebp
+  800d69:	eb c4                	jmp    800d2f <sys_getenvid+0x2c>
+
+00800d6b <sys_yield>:
+  800d6b:	55                   	push   %ebp
+  800d6c:	89 e5                	mov    %esp,%ebp
+  800d6e:	57                   	push   %edi
+  800d6f:	56                   	push   %esi
+  800d70:	53                   	push   %ebx
+  800d71:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d78:	78 22                	js     800d9c <sys_yield+0x31>
+  800d7a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d81:	75 2e                	jne    800db1 <sys_yield+0x46>
+  800d83:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d88:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d8d:	89 d1                	mov    %edx,%ecx
+  800d8f:	89 d3                	mov    %edx,%ebx
+  800d91:	89 d7                	mov    %edx,%edi
+  800d93:	89 d6                	mov    %edx,%esi
+  800d95:	cd 30                	int    $0x30
+  800d97:	5b                   	pop    %ebx
+  800d98:	5e                   	pop    %esi
+  800d99:	5f                   	pop    %edi
+  800d9a:	5d                   	pop    %ebp
+  800d9b:	c3                   	ret
+  800d9c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da1:	0f a2                	cpuid
+  800da3:	c1 ea 0b             	shr    $0xb,%edx
+  800da6:	83 e2 01             	and    $0x1,%edx
+  800da9:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800daf:	eb c9                	jmp    800d7a <sys_yield+0xf>
+  800db1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dbb:	89 d1                	mov    %edx,%ecx
+  800dbd:	89 d3                	mov    %edx,%ebx
+  800dbf:	89 d7                	mov    %edx,%edi
+  800dc1:	89 d6                	mov    %edx,%esi
+  800dc3:	55                   	push   %ebp
+  800dc4:	68 cd 0d 80 00       	push   $0x800dcd
+  800dc9:	89 e5                	mov    %esp,%ebp
+  800dcb:	0f 34                	sysenter
+  800dcd:	83 c4 04             	add    $0x4,%esp
+  800dd0:	5d                   	pop    %ebp
+  800dd1:	eb c4                	jmp    800d97 <sys_yield+0x2c>
+
+00800dd3 <sys_env_set_cow>:
+  800dd3:	55                   	push   %ebp
+  800dd4:	89 e5                	mov    %esp,%ebp
+  800dd6:	57                   	push   %edi
+  800dd7:	56                   	push   %esi
+  800dd8:	53                   	push   %ebx
+  800dd9:	83 ec 0c             	sub    $0xc,%esp
+  800ddc:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800de3:	78 2b                	js     800e10 <sys_env_set_cow+0x3d>
+  800de5:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800dec:	75 37                	jne    800e25 <sys_env_set_cow+0x52>
+  800dee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800df8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfe:	89 df                	mov    %ebx,%edi
+  800e00:	89 de                	mov    %ebx,%esi
+  800e02:	cd 30                	int    $0x30
+  800e04:	85 c0                	test   %eax,%eax
+  800e06:	7f 41                	jg     800e49 <sys_env_set_cow+0x76>
+  800e08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0b:	5b                   	pop    %ebx
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5f                   	pop    %edi
+  800e0e:	5d                   	pop    %ebp
+  800e0f:	c3                   	ret
+  800e10:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e15:	0f a2                	cpuid
+  800e17:	c1 ea 0b             	shr    $0xb,%edx
+  800e1a:	83 e2 01             	and    $0x1,%edx
+  800e1d:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800e23:	eb c0                	jmp    800de5 <sys_env_set_cow+0x12>
+  800e25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e30:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e35:	89 df                	mov    %ebx,%edi
+  800e37:	89 de                	mov    %ebx,%esi
+  800e39:	55                   	push   %ebp
+  800e3a:	68 43 0e 80 00       	push   $0x800e43
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	0f 34                	sysenter
+  800e43:	83 c4 04             	add    $0x4,%esp
+  800e46:	5d                   	pop    %ebp
+  800e47:	eb bb                	jmp    800e04 <sys_env_set_cow+0x31>
+  800e49:	83 ec 0c             	sub    $0xc,%esp
+  800e4c:	50                   	push   %eax
+  800e4d:	6a 0d                	push   $0xd
+  800e4f:	68 e4 1b 80 00       	push   $0x801be4
+  800e54:	6a 49                	push   $0x49
+  800e56:	68 01 1c 80 00       	push   $0x801c01
+  800e5b:	e8 52 08 00 00       	call   8016b2 <_panic>
+
+00800e60 <sys_env_set_quota>:
+  800e60:	55                   	push   %ebp
+  800e61:	89 e5                	mov    %esp,%ebp
+  800e63:	57                   	push   %edi
+  800e64:	56                   	push   %esi
+  800e65:	53                   	push   %ebx
+  800e66:	83 ec 0c             	sub    $0xc,%esp
+  800e69:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e70:	78 2b                	js     800e9d <sys_env_set_quota+0x3d>
+  800e72:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e79:	75 37                	jne    800eb2 <sys_env_set_quota+0x52>
+  800e7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e80:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8b:	89 df                	mov    %ebx,%edi
+  800e8d:	89 de                	mov    %ebx,%esi
+  800e8f:	cd 30                	int    $0x30
+  800e91:	85 c0                	test   %eax,%eax
+  800e93:	7f 41                	jg     800ed6 <sys_env_set_quota+0x76>
+  800e95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e98:	5b                   	pop    %ebx
+  800e99:	5e                   	pop    %esi
+  800e9a:	5f                   	pop    %edi
+  800e9b:	5d                   	pop    %ebp
+  800e9c:	c3                   	ret
+  800e9d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ea2:	0f a2                	cpuid
+  800ea4:	c1 ea 0b             	shr    $0xb,%edx
+  800ea7:	83 e2 01             	and    $0x1,%edx
+  800eaa:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800eb0:	eb c0                	jmp    800e72 <sys_env_set_quota+0x12>
+  800eb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ec2:	89 df                	mov    %ebx,%edi
+  800ec4:	89 de                	mov    %ebx,%esi
+  800ec6:	55                   	push   %ebp
+  800ec7:	68 d0 0e 80 00       	push   $0x800ed0
+  800ecc:	89 e5                	mov    %esp,%ebp
+  800ece:	0f 34                	sysenter
+  800ed0:	83 c4 04             	add    $0x4,%esp
+  800ed3:	5d                   	pop    %ebp
+  800ed4:	eb bb                	jmp    800e91 <sys_env_set_quota+0x31>
+  800ed6:	83 ec 0c             	sub    $0xc,%esp
+  800ed9:	50                   	push   %eax
+  800eda:	6a 0f                	push   $0xf
+  800edc:	68 e4 1b 80 00       	push   $0x801be4
+  800ee1:	6a 49                	push   $0x49
+  800ee3:	68 01 1c 80 00       	push   $0x801c01
+  800ee8:	e8 c5 07 00 00       	call   8016b2 <_panic>
+
+00800eed <sys_page_alloc>:
+  800eed:	55                   	push   %ebp
+  800eee:	89 e5                	mov    %esp,%ebp
+  800ef0:	57                   	push   %edi
+  800ef1:	56                   	push   %esi
+  800ef2:	53                   	push   %ebx
+  800ef3:	83 ec 0c             	sub    $0xc,%esp
+  800ef6:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800efd:	78 2c                	js     800f2b <sys_page_alloc+0x3e>
+  800eff:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f06:	75 38                	jne    800f40 <sys_page_alloc+0x53>
+  800f08:	be 00 00 00 00       	mov    $0x0,%esi
+  800f0d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f1b:	89 f7                	mov    %esi,%edi
+  800f1d:	cd 30                	int    $0x30
+  800f1f:	85 c0                	test   %eax,%eax
+  800f21:	7f 42                	jg     800f65 <sys_page_alloc+0x78>
+  800f23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f26:	5b                   	pop    %ebx
+  800f27:	5e                   	pop    %esi
+  800f28:	5f                   	pop    %edi
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+  800f2b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f30:	0f a2                	cpuid
+  800f32:	c1 ea 0b             	shr    $0xb,%edx
+  800f35:	83 e2 01             	and    $0x1,%edx
+  800f38:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800f3e:	eb bf                	jmp    800eff <sys_page_alloc+0x12>
+  800f40:	be 00 00 00 00       	mov    $0x0,%esi
+  800f45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f53:	89 f7                	mov    %esi,%edi
+  800f55:	55                   	push   %ebp
+  800f56:	68 5f 0f 80 00       	push   $0x800f5f
+  800f5b:	89 e5                	mov    %esp,%ebp
+  800f5d:	0f 34                	sysenter
+  800f5f:	83 c4 04             	add    $0x4,%esp
+  800f62:	5d                   	pop    %ebp
+  800f63:	eb ba                	jmp    800f1f <sys_page_alloc+0x32>
+  800f65:	83 ec 0c             	sub    $0xc,%esp
+  800f68:	50                   	push   %eax
+  800f69:	6a 04                	push   $0x4
+  800f6b:	68 e4 1b 80 00       	push   $0x801be4
+  800f70:	6a 49                	push   $0x49
+  800f72:	68 01 1c 80 00       	push   $0x801c01
+  800f77:	e8 36 07 00 00       	call   8016b2 <_panic>
+
+00800f7c <sys_page_map>:
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	57                   	push   %edi
+  800f80:	56                   	push   %esi
+  800f81:	53                   	push   %ebx
+  800f82:	83 ec 0c             	sub    $0xc,%esp
+  800f85:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f8c:	78 2b                	js     800fb9 <sys_page_map+0x3d>
+  800f8e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f95:	75 37                	jne    800fce <sys_page_map+0x52>
+  800f97:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fa8:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fab:	cd 30                	int    $0x30
+  800fad:	85 c0                	test   %eax,%eax
+  800faf:	7f 41                	jg     800ff2 <sys_page_map+0x76>
+  800fb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb4:	5b                   	pop    %ebx
+  800fb5:	5e                   	pop    %esi
+  800fb6:	5f                   	pop    %edi
+  800fb7:	5d                   	pop    %ebp
+  800fb8:	c3                   	ret
+  800fb9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fbe:	0f a2                	cpuid
+  800fc0:	c1 ea 0b             	shr    $0xb,%edx
+  800fc3:	83 e2 01             	and    $0x1,%edx
+  800fc6:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800fcc:	eb c0                	jmp    800f8e <sys_page_map+0x12>
+  800fce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fd9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fdc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fdf:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fe2:	55                   	push   %ebp
+  800fe3:	68 ec 0f 80 00       	push   $0x800fec
+  800fe8:	89 e5                	mov    %esp,%ebp
+  800fea:	0f 34                	sysenter
+  800fec:	83 c4 04             	add    $0x4,%esp
+  800fef:	5d                   	pop    %ebp
+  800ff0:	eb bb                	jmp    800fad <sys_page_map+0x31>
+  800ff2:	83 ec 0c             	sub    $0xc,%esp
+  800ff5:	50                   	push   %eax
+  800ff6:	6a 05                	push   $0x5
+  800ff8:	68 e4 1b 80 00       	push   $0x801be4
+  800ffd:	6a 49                	push   $0x49
+  800fff:	68 01 1c 80 00       	push   $0x801c01
+  801004:	e8 a9 06 00 00       	call   8016b2 <_panic>
+
+00801009 <sys_page_unmap>:
+  801009:	55                   	push   %ebp
+  80100a:	89 e5                	mov    %esp,%ebp
+  80100c:	57                   	push   %edi
+  80100d:	56                   	push   %esi
+  80100e:	53                   	push   %ebx
+  80100f:	83 ec 0c             	sub    $0xc,%esp
+  801012:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801019:	78 2b                	js     801046 <sys_page_unmap+0x3d>
+  80101b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801022:	75 37                	jne    80105b <sys_page_unmap+0x52>
+  801024:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801029:	b8 06 00 00 00       	mov    $0x6,%eax
+  80102e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801031:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801034:	89 df                	mov    %ebx,%edi
+  801036:	89 de                	mov    %ebx,%esi
+  801038:	cd 30                	int    $0x30
+  80103a:	85 c0                	test   %eax,%eax
+  80103c:	7f 41                	jg     80107f <sys_page_unmap+0x76>
+  80103e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801041:	5b                   	pop    %ebx
+  801042:	5e                   	pop    %esi
+  801043:	5f                   	pop    %edi
+  801044:	5d                   	pop    %ebp
+  801045:	c3                   	ret
+  801046:	b8 01 00 00 00       	mov    $0x1,%eax
+  80104b:	0f a2                	cpuid
+  80104d:	c1 ea 0b             	shr    $0xb,%edx
+  801050:	83 e2 01             	and    $0x1,%edx
+  801053:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801059:	eb c0                	jmp    80101b <sys_page_unmap+0x12>
+  80105b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801060:	8b 55 08             	mov    0x8(%ebp),%edx
+  801063:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801066:	b8 06 00 00 00       	mov    $0x6,%eax
+  80106b:	89 df                	mov    %ebx,%edi
+  80106d:	89 de                	mov    %ebx,%esi
+  80106f:	55                   	push   %ebp
+  801070:	68 79 10 80 00       	push   $0x801079
+  801075:	89 e5                	mov    %esp,%ebp
+  801077:	0f 34                	sysenter
+  801079:	83 c4 04             	add    $0x4,%esp
+  80107c:	5d                   	pop    %ebp
+  80107d:	eb bb                	jmp    80103a <sys_page_unmap+0x31>
+  80107f:	83 ec 0c             	sub    $0xc,%esp
+  801082:	50                   	push   %eax
+  801083:	6a 06                	push   $0x6
+  801085:	68 e4 1b 80 00       	push   $0x801be4
+  80108a:	6a 49                	push   $0x49
+  80108c:	68 01 1c 80 00       	push   $0x801c01
+  801091:	e8 1c 06 00 00       	call   8016b2 <_panic>
+
+00801096 <sys_page_reuse>:
+  801096:	55                   	push   %ebp
+  801097:	89 e5                	mov    %esp,%ebp
+  801099:	57                   	push   %edi
+  80109a:	56                   	push   %esi
+  80109b:	53                   	push   %ebx
+  80109c:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010a3:	78 24                	js     8010c9 <sys_page_reuse+0x33>
+  8010a5:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010ac:	75 30                	jne    8010de <sys_page_reuse+0x48>
+  8010ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010be:	89 df                	mov    %ebx,%edi
+  8010c0:	89 de                	mov    %ebx,%esi
+  8010c2:	cd 30                	int    $0x30
+  8010c4:	5b                   	pop    %ebx
+  8010c5:	5e                   	pop    %esi
+  8010c6:	5f                   	pop    %edi
+  8010c7:	5d                   	pop    %ebp
+  8010c8:	c3                   	ret
+  8010c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010ce:	0f a2                	cpuid
+  8010d0:	c1 ea 0b             	shr    $0xb,%edx
+  8010d3:	83 e2 01             	and    $0x1,%edx
+  8010d6:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8010dc:	eb c7                	jmp    8010a5 <sys_page_reuse+0xf>
+  8010de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010ee:	89 df                	mov    %ebx,%edi
+  8010f0:	89 de                	mov    %ebx,%esi
+  8010f2:	55                   	push   %ebp
+  8010f3:	68 fc 10 80 00       	push   $0x8010fc
+  8010f8:	89 e5                	mov    %esp,%ebp
+  8010fa:	0f 34                	sysenter
+  8010fc:	83 c4 04             	add    $0x4,%esp
+  8010ff:	5d                   	pop    %ebp
+  801100:	eb c2                	jmp    8010c4 <sys_page_reuse+0x2e>
+
+00801102 <sys_env_set_status>:
+  801102:	55                   	push   %ebp
+  801103:	89 e5                	mov    %esp,%ebp
+  801105:	57                   	push   %edi
+  801106:	56                   	push   %esi
+  801107:	53                   	push   %ebx
+  801108:	83 ec 0c             	sub    $0xc,%esp
+  80110b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801112:	78 2b                	js     80113f <sys_env_set_status+0x3d>
+  801114:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80111b:	75 37                	jne    801154 <sys_env_set_status+0x52>
+  80111d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801122:	b8 08 00 00 00       	mov    $0x8,%eax
+  801127:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112d:	89 df                	mov    %ebx,%edi
+  80112f:	89 de                	mov    %ebx,%esi
+  801131:	cd 30                	int    $0x30
+  801133:	85 c0                	test   %eax,%eax
+  801135:	7f 41                	jg     801178 <sys_env_set_status+0x76>
+  801137:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113a:	5b                   	pop    %ebx
+  80113b:	5e                   	pop    %esi
+  80113c:	5f                   	pop    %edi
+  80113d:	5d                   	pop    %ebp
+  80113e:	c3                   	ret
+  80113f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801144:	0f a2                	cpuid
+  801146:	c1 ea 0b             	shr    $0xb,%edx
+  801149:	83 e2 01             	and    $0x1,%edx
+  80114c:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801152:	eb c0                	jmp    801114 <sys_env_set_status+0x12>
+  801154:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801159:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801164:	89 df                	mov    %ebx,%edi
+  801166:	89 de                	mov    %ebx,%esi
+  801168:	55                   	push   %ebp
+  801169:	68 72 11 80 00       	push   $0x801172
+  80116e:	89 e5                	mov    %esp,%ebp
+  801170:	0f 34                	sysenter
+  801172:	83 c4 04             	add    $0x4,%esp
+  801175:	5d                   	pop    %ebp
+  801176:	eb bb                	jmp    801133 <sys_env_set_status+0x31>
+  801178:	83 ec 0c             	sub    $0xc,%esp
+  80117b:	50                   	push   %eax
+  80117c:	6a 08                	push   $0x8
+  80117e:	68 e4 1b 80 00       	push   $0x801be4
+  801183:	6a 49                	push   $0x49
+  801185:	68 01 1c 80 00       	push   $0x801c01
+  80118a:	e8 23 05 00 00       	call   8016b2 <_panic>
+
+0080118f <sys_env_set_pgfault_upcall>:
+  80118f:	55                   	push   %ebp
+  801190:	89 e5                	mov    %esp,%ebp
+  801192:	57                   	push   %edi
+  801193:	56                   	push   %esi
+  801194:	53                   	push   %ebx
+  801195:	83 ec 0c             	sub    $0xc,%esp
+  801198:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80119f:	78 2b                	js     8011cc <sys_env_set_pgfault_upcall+0x3d>
+  8011a1:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011a8:	75 37                	jne    8011e1 <sys_env_set_pgfault_upcall+0x52>
+  8011aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011af:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ba:	89 df                	mov    %ebx,%edi
+  8011bc:	89 de                	mov    %ebx,%esi
+  8011be:	cd 30                	int    $0x30
+  8011c0:	85 c0                	test   %eax,%eax
+  8011c2:	7f 41                	jg     801205 <sys_env_set_pgfault_upcall+0x76>
+  8011c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c7:	5b                   	pop    %ebx
+  8011c8:	5e                   	pop    %esi
+  8011c9:	5f                   	pop    %edi
+  8011ca:	5d                   	pop    %ebp
+  8011cb:	c3                   	ret
+  8011cc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011d1:	0f a2                	cpuid
+  8011d3:	c1 ea 0b             	shr    $0xb,%edx
+  8011d6:	83 e2 01             	and    $0x1,%edx
+  8011d9:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8011df:	eb c0                	jmp    8011a1 <sys_env_set_pgfault_upcall+0x12>
+  8011e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ec:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011f1:	89 df                	mov    %ebx,%edi
+  8011f3:	89 de                	mov    %ebx,%esi
+  8011f5:	55                   	push   %ebp
+  8011f6:	68 ff 11 80 00       	push   $0x8011ff
+  8011fb:	89 e5                	mov    %esp,%ebp
+  8011fd:	0f 34                	sysenter
+  8011ff:	83 c4 04             	add    $0x4,%esp
+  801202:	5d                   	pop    %ebp
+  801203:	eb bb                	jmp    8011c0 <sys_env_set_pgfault_upcall+0x31>
+  801205:	83 ec 0c             	sub    $0xc,%esp
+  801208:	50                   	push   %eax
+  801209:	6a 09                	push   $0x9
+  80120b:	68 e4 1b 80 00       	push   $0x801be4
+  801210:	6a 49                	push   $0x49
+  801212:	68 01 1c 80 00       	push   $0x801c01
+  801217:	e8 96 04 00 00       	call   8016b2 <_panic>
+
+0080121c <sys_env_set_trace>:
+  80121c:	55                   	push   %ebp
+  80121d:	89 e5                	mov    %esp,%ebp
+  80121f:	57                   	push   %edi
+  801220:	56                   	push   %esi
+  801221:	53                   	push   %ebx
+  801222:	83 ec 0c             	sub    $0xc,%esp
+  801225:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80122c:	78 2b                	js     801259 <sys_env_set_trace+0x3d>
+  80122e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801235:	75 37                	jne    80126e <sys_env_set_trace+0x52>
+  801237:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801241:	8b 55 08             	mov    0x8(%ebp),%edx
+  801244:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801247:	89 df                	mov    %ebx,%edi
+  801249:	89 de                	mov    %ebx,%esi
+  80124b:	cd 30                	int    $0x30
+  80124d:	85 c0                	test   %eax,%eax
+  80124f:	7f 41                	jg     801292 <sys_env_set_trace+0x76>
+  801251:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801254:	5b                   	pop    %ebx
+  801255:	5e                   	pop    %esi
+  801256:	5f                   	pop    %edi
+  801257:	5d                   	pop    %ebp
+  801258:	c3                   	ret
+  801259:	b8 01 00 00 00       	mov    $0x1,%eax
+  80125e:	0f a2                	cpuid
+  801260:	c1 ea 0b             	shr    $0xb,%edx
+  801263:	83 e2 01             	and    $0x1,%edx
+  801266:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80126c:	eb c0                	jmp    80122e <sys_env_set_trace+0x12>
+  80126e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801273:	8b 55 08             	mov    0x8(%ebp),%edx
+  801276:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801279:	b8 12 00 00 00       	mov    $0x12,%eax
+  80127e:	89 df                	mov    %ebx,%edi
+  801280:	89 de                	mov    %ebx,%esi
+  801282:	55                   	push   %ebp
+  801283:	68 8c 12 80 00       	push   $0x80128c
+  801288:	89 e5                	mov    %esp,%ebp
+  80128a:	0f 34                	sysenter
+  80128c:	83 c4 04             	add    $0x4,%esp
+  80128f:	5d                   	pop    %ebp
+  801290:	eb bb                	jmp    80124d <sys_env_set_trace+0x31>
+  801292:	83 ec 0c             	sub    $0xc,%esp
+  801295:	50                   	push   %eax
+  801296:	6a 12                	push   $0x12
+  801298:	68 e4 1b 80 00       	push   $0x801be4
+  80129d:	6a 49                	push   $0x49
+  80129f:	68 01 1c 80 00       	push   $0x801c01
+  8012a4:	e8 09 04 00 00       	call   8016b2 <_panic>
+
+008012a9 <sys_env_set_rdpmc>:
+  8012a9:	55                   	push   %ebp
+  8012aa:	89 e5                	mov    %esp,%ebp
+  8012ac:	57                   	push   %edi
+  8012ad:	56                   	push   %esi
+  8012ae:	53                   	push   %ebx
+  8012af:	83 ec 0c             	sub    $0xc,%esp
+  8012b2:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012b9:	78 2b                	js     8012e6 <sys_env_set_rdpmc+0x3d>
+  8012bb:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012c2:	75 37                	jne    8012fb <sys_env_set_rdpmc+0x52>
+  8012c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d4:	89 df                	mov    %ebx,%edi
+  8012d6:	89 de                	mov    %ebx,%esi
+  8012d8:	cd 30                	int    $0x30
+  8012da:	85 c0                	test   %eax,%eax
+  8012dc:	7f 41                	jg     80131f <sys_env_set_rdpmc+0x76>
+  8012de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e1:	5b                   	pop    %ebx
+  8012e2:	5e                   	pop    %esi
+  8012e3:	5f                   	pop    %edi
+  8012e4:	5d                   	pop    %ebp
+  8012e5:	c3                   	ret
+  8012e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012eb:	0f a2                	cpuid
+  8012ed:	c1 ea 0b             	shr    $0xb,%edx
+  8012f0:	83 e2 01             	and    $0x1,%edx
+  8012f3:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8012f9:	eb c0                	jmp    8012bb <sys_env_set_rdpmc+0x12>
+  8012fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801300:	8b 55 08             	mov    0x8(%ebp),%edx
+  801303:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801306:	b8 13 00 00 00       	mov    $0x13,%eax
+  80130b:	89 df                	mov    %ebx,%edi
+  80130d:	89 de                	mov    %ebx,%esi
+  80130f:	55                   	push   %ebp
+  801310:	68 19 13 80 00       	push   $0x801319
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	0f 34                	sysenter
+  801319:	83 c4 04             	add    $0x4,%esp
+  80131c:	5d                   	pop    %ebp
+  80131d:	eb bb                	jmp    8012da <sys_env_set_rdpmc+0x31>
+  80131f:	83 ec 0c             	sub    $0xc,%esp
+  801322:	50                   	push   %eax
+  801323:	6a 13                	push   $0x13
+  801325:	68 e4 1b 80 00       	push   $0x801be4
+  80132a:	6a 49                	push   $0x49
+  80132c:	68 01 1c 80 00       	push   $0x801c01
+  801331:	e8 7c 03 00 00       	call   8016b2 <_panic>
+
+00801336 <sys_ring_setup>:
+  801336:	55                   	push   %ebp
+  801337:	89 e5                	mov    %esp,%ebp
+  801339:	57                   	push   %edi
+  80133a:	56                   	push   %esi
+  80133b:	53                   	push   %ebx
+  80133c:	83 ec 0c             	sub    $0xc,%esp
+  80133f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801346:	78 29                	js     801371 <sys_ring_setup+0x3b>
+  801348:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80134f:	75 35                	jne    801386 <sys_ring_setup+0x50>
+  801351:	ba 00 00 00 00       	mov    $0x0,%edx
+  801356:	b8 10 00 00 00       	mov    $0x10,%eax
+  80135b:	89 d1                	mov    %edx,%ecx
+  80135d:	89 d3                	mov    %edx,%ebx
+  80135f:	89 d7                	mov    %edx,%edi
+  801361:	89 d6                	mov    %edx,%esi
+  801363:	cd 30                	int    $0x30
+  801365:	85 c0                	test   %eax,%eax
+  801367:	7f 3f                	jg     8013a8 <sys_ring_setup+0x72>
+  801369:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136c:	5b                   	pop    %ebx
+  80136d:	5e                   	pop    %esi
+  80136e:	5f                   	pop    %edi
+  80136f:	5d                   	pop    %ebp
+  801370:	c3                   	ret
+  801371:	b8 01 00 00 00       	mov    $0x1,%eax
+  801376:	0f a2                	cpuid
+  801378:	c1 ea 0b             	shr    $0xb,%edx
+  80137b:	83 e2 01             	and    $0x1,%edx
+  80137e:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801384:	eb c2                	jmp    801348 <sys_ring_setup+0x12>
+  801386:	ba 00 00 00 00       	mov    $0x0,%edx
+  80138b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801390:	89 d1                	mov    %edx,%ecx
+  801392:	89 d3                	mov    %edx,%ebx
+  801394:	89 d7                	mov    %edx,%edi
+  801396:	89 d6                	mov    %edx,%esi
+  801398:	55                   	push   %ebp
+  801399:	68 a2 13 80 00       	push   $0x8013a2
+  80139e:	89 e5                	mov    %esp,%ebp
+  8013a0:	0f 34                	sysenter
+  8013a2:	83 c4 04             	add    $0x4,%esp
+  8013a5:	5d                   	pop    %ebp
+  8013a6:	eb bd                	jmp    801365 <sys_ring_setup+0x2f>
+  8013a8:	83 ec 0c             	sub    $0xc,%esp
+  8013ab:	50                   	push   %eax
+  8013ac:	6a 10                	push   $0x10
+  8013ae:	68 e4 1b 80 00       	push   $0x801be4
+  8013b3:	6a 49                	push   $0x49
+  8013b5:	68 01 1c 80 00       	push   $0x801c01
+  8013ba:	e8 f3 02 00 00       	call   8016b2 <_panic>
+
+008013bf <sys_ring_enter>:
+  8013bf:	55                   	push   %ebp
+  8013c0:	89 e5                	mov    %esp,%ebp
+  8013c2:	57                   	push   %edi
+  8013c3:	56                   	push   %esi
+  8013c4:	53                   	push   %ebx
+  8013c5:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8013cc:	78 22                	js     8013f0 <sys_ring_enter+0x31>
+  8013ce:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8013d5:	75 2e                	jne    801405 <sys_ring_enter+0x46>
+  8013d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013dc:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013e1:	89 d1                	mov    %edx,%ecx
+  8013e3:	89 d3                	mov    %edx,%ebx
+  8013e5:	89 d7                	mov    %edx,%edi
+  8013e7:	89 d6                	mov    %edx,%esi
+  8013e9:	cd 30                	int    $0x30
+  8013eb:	5b                   	pop    %ebx
+  8013ec:	5e                   	pop    %esi
+  8013ed:	5f                   	pop    %edi
+  8013ee:	5d                   	pop    %ebp
+  8013ef:	c3                   	ret
+  8013f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013f5:	0f a2                	cpuid
+  8013f7:	c1 ea 0b             	shr    $0xb,%edx
+  8013fa:	83 e2 01             	and    $0x1,%edx
+  8013fd:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801403:	eb c9                	jmp    8013ce <sys_ring_enter+0xf>
+  801405:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80140f:	89 d1                	mov    %edx,%ecx
+  801411:	89 d3                	mov    %edx,%ebx
+  801413:	89 d7                	mov    %edx,%edi
+  801415:	89 d6                	mov    %edx,%esi
+  801417:	55                   	push   %ebp
+  801418:	68 21 14 80 00       	push   $0x801421
+  80141d:	89 e5                	mov    %esp,%ebp
+  80141f:	0f 34                	sysenter
+  801421:	83 c4 04             	add    $0x4,%esp
+  801424:	5d                   	pop    %ebp
+  801425:	eb c4                	jmp    8013eb <sys_ring_enter+0x2c>
+
+00801427 <sys_ipc_try_send>:
+  801427:	55                   	push   %ebp
+  801428:	89 e5                	mov    %esp,%ebp
+  80142a:	57                   	push   %edi
+  80142b:	56                   	push   %esi
+  80142c:	53                   	push   %ebx
+  80142d:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801434:	78 26                	js     80145c <sys_ipc_try_send+0x35>
+  801436:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80143d:	75 32                	jne    801471 <sys_ipc_try_send+0x4a>
+  80143f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801444:	be 00 00 00 00       	mov    $0x0,%esi
+  801449:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801452:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801455:	cd 30                	int    $0x30
+  801457:	5b                   	pop    %ebx
+  801458:	5e                   	pop    %esi
+  801459:	5f                   	pop    %edi
+  80145a:	5d                   	pop    %ebp
+  80145b:	c3                   	ret
+  80145c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801461:	0f a2                	cpuid
+  801463:	c1 ea 0b             	shr    $0xb,%edx
+  801466:	83 e2 01             	and    $0x1,%edx
+  801469:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80146f:	eb c5                	jmp    801436 <sys_ipc_try_send+0xf>
+  801471:	8b 55 08             	mov    0x8(%ebp),%edx
+  801474:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801477:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80147c:	be 00 00 00 00       	mov    $0x0,%esi
+  801481:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801484:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801487:	55                   	push   %ebp
+  801488:	68 91 14 80 00       	push   $0x801491
+  80148d:	89 e5                	mov    %esp,%ebp
+  80148f:	0f 34                	sysenter
+  801491:	83 c4 04             	add    $0x4,%esp
+  801494:	5d                   	pop    %ebp
+  801495:	eb c0                	jmp    801457 <sys_ipc_try_send+0x30>
+
+00801497 <sys_ipc_recv>:
+  801497:	55                   	push   %ebp
+  801498:	89 e5                	mov    %esp,%ebp
+  80149a:	57                   	push   %edi
+  80149b:	56                   	push   %esi
+  80149c:	53                   	push   %ebx
+  80149d:	83 ec 0c             	sub    $0xc,%esp
+  8014a0:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014a7:	78 2a                	js     8014d3 <sys_ipc_recv+0x3c>
+  8014a9:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014b0:	75 36                	jne    8014e8 <sys_ipc_recv+0x51>
+  8014b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014b7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bf:	89 cb                	mov    %ecx,%ebx
+  8014c1:	89 cf                	mov    %ecx,%edi
+  8014c3:	89 ce                	mov    %ecx,%esi
+  8014c5:	cd 30                	int    $0x30
+  8014c7:	85 c0                	test   %eax,%eax
+  8014c9:	7f 40                	jg     80150b <sys_ipc_recv+0x74>
+  8014cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ce:	5b                   	pop    %ebx
+  8014cf:	5e                   	pop    %esi
+  8014d0:	5f                   	pop    %edi
+  8014d1:	5d                   	pop    %ebp
+  8014d2:	c3                   	ret
+  8014d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014d8:	0f a2                	cpuid
+  8014da:	c1 ea 0b             	shr    $0xb,%edx
+  8014dd:	83 e2 01             	and    $0x1,%edx
+  8014e0:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8014e6:	eb c1                	jmp    8014a9 <sys_ipc_recv+0x12>
+  8014e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014f5:	89 cb                	mov    %ecx,%ebx
+  8014f7:	89 cf                	mov    %ecx,%edi
+  8014f9:	89 ce                	mov    %ecx,%esi
+  8014fb:	55                   	push   %ebp
+  8014fc:	68 05 15 80 00       	push   $0x801505
+  801501:	89 e5                	mov    %esp,%ebp
+  801503:	0f 34                	sysenter
+  801505:	83 c4 04             	add    $0x4,%esp
+  801508:	5d                   	pop    %ebp
+  801509:	eb bc                	jmp    8014c7 <sys_ipc_recv+0x30>
+  80150b:	83 ec 0c             	sub    $0xc,%esp
+  80150e:	50                   	push   %eax
+  80150f:	6a 0c                	push   $0xc
+  801511:	68 e4 1b 80 00       	push   $0x801be4
+  801516:	6a 49                	push   $0x49
+  801518:	68 01 1c 80 00       	push   $0x801c01
+  80151d:	e8 90 01 00 00       	call   8016b2 <_panic>
+
+00801522 <uinfo_envid>:
+  801522:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  801527:	c3                   	ret
+
+00801528 <uinfo_cpunum>:
+  801528:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  80152d:	c3                   	ret
+
+0080152e <uinfo_ticks>:
+  80152e:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  801533:	c3                   	ret
+
+00801534 <uinfo_nsec>:
+  801534:	55                   	push   %ebp
+  801535:	89 e5                	mov    %esp,%ebp
+  801537:	57                   	push   %edi
+  801538:	56                   	push   %esi
+  801539:	53                   	push   %ebx
+  80153a:	83 ec 1c             	sub    $0x1c,%esp
+  80153d:	0f 31                	rdtsc
+  80153f:	89 c6                	mov    %eax,%esi
+  801541:	89 d7                	mov    %edx,%edi
+  801543:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801549:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801553:	85 c9                	test   %ecx,%ecx
+  801555:	74 5c                	je     8015b3 <uinfo_nsec+0x7f>
+  801557:	ba 00 00 00 00       	mov    $0x0,%edx
+  80155c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80155f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801562:	52                   	push   %edx
+  801563:	51                   	push   %ecx
+  801564:	57                   	push   %edi
+  801565:	56                   	push   %esi
+  801566:	e8 6a 02 00 00       	call   8017d5 <__umoddi3>
+  80156b:	83 c4 10             	add    $0x10,%esp
+  80156e:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801574:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801579:	f7 e3                	mul    %ebx
+  80157b:	01 ca                	add    %ecx,%edx
+  80157d:	ff 75 e4             	push   -0x1c(%ebp)
+  801580:	ff 75 e0             	push   -0x20(%ebp)
+  801583:	52                   	push   %edx
+  801584:	50                   	push   %eax
+  801585:	e8 73 01 00 00       	call   8016fd <__udivdi3>
+  80158a:	83 c4 10             	add    $0x10,%esp
+  80158d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801590:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801593:	ff 75 e4             	push   -0x1c(%ebp)
+  801596:	ff 75 e0             	push   -0x20(%ebp)
+  801599:	57                   	push   %edi
+  80159a:	56                   	push   %esi
+  80159b:	e8 5d 01 00 00       	call   8016fd <__udivdi3>
+  8015a0:	83 c4 10             	add    $0x10,%esp
+  8015a3:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  8015a9:	f7 e3                	mul    %ebx
+  8015ab:	01 ca                	add    %ecx,%edx
+  8015ad:	03 45 d8             	add    -0x28(%ebp),%eax
+  8015b0:	13 55 dc             	adc    -0x24(%ebp),%edx
+  8015b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b6:	5b                   	pop    %ebx
+  8015b7:	5e                   	pop    %esi
+  8015b8:	5f                   	pop    %edi
+  8015b9:	5d                   	pop    %ebp
+  8015ba:	c3                   	ret
+
+008015bb <bflush>:
+  8015bb:	a1 40 20 80 00       	mov    0x802040,%eax
+  8015c0:	85 c0                	test   %eax,%eax
+  8015c2:	75 01                	jne    8015c5 <bflush+0xa>
+  8015c4:	c3                   	ret
+  8015c5:	55                   	push   %ebp
+  8015c6:	89 e5                	mov    %esp,%ebp
+  8015c8:	83 ec 10             	sub    $0x10,%esp
+  8015cb:	50                   	push   %eax
+  8015cc:	68 44 20 80 00       	push   $0x802044
+  8015d1:	e8 d4 f5 ff ff       	call   800baa <sys_cputs>
+  8015d6:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  8015dd:	00 00 00 
+  8015e0:	83 c4 10             	add    $0x10,%esp
+  8015e3:	c9                   	leave
+  8015e4:	c3                   	ret
+
+008015e5 <bputch>:
+  8015e5:	55                   	push   %ebp
+  8015e6:	89 e5                	mov    %esp,%ebp
+  8015e8:	53                   	push   %ebx
+  8015e9:	83 ec 04             	sub    $0x4,%esp
+  8015ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8015ef:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  8015f5:	8d 42 01             	lea    0x1(%edx),%eax
+  8015f8:	a3 40 20 80 00       	mov    %eax,0x802040
+  8015fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801600:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  801606:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80160b:	77 08                	ja     801615 <bputch+0x30>
+  80160d:	83 03 01             	addl   $0x1,(%ebx)
+  801610:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801613:	c9                   	leave
+  801614:	c3                   	ret
+  801615:	e8 a1 ff ff ff       	call   8015bb <bflush>
+  80161a:	eb f1                	jmp    80160d <bputch+0x28>
+
+0080161c <vbprintf>:
+  80161c:	55                   	push   %ebp
+  80161d:	89 e5                	mov    %esp,%ebp
+  80161f:	83 ec 18             	sub    $0x18,%esp
+  801622:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801629:	ff 75 0c             	push   0xc(%ebp)
+  80162c:	ff 75 08             	push   0x8(%ebp)
+  80162f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801632:	50                   	push   %eax
+  801633:	68 e5 15 80 00       	push   $0x8015e5
+  801638:	e8 00 ec ff ff       	call   80023d <vprintfmt>
+  80163d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801640:	c9                   	leave
+  801641:	c3                   	ret
+
+00801642 <bprintf>:
+  801642:	55                   	push   %ebp
+  801643:	89 e5                	mov    %esp,%ebp
+  801645:	83 ec 10             	sub    $0x10,%esp
+  801648:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80164b:	50                   	push   %eax
+  80164c:	ff 75 08             	push   0x8(%ebp)
+  80164f:	e8 c8 ff ff ff       	call   80161c <vbprintf>
+  801654:	c9                   	leave
+  801655:	c3                   	ret
+
+00801656 <bwrite>:
+  801656:	55                   	push   %ebp
+  801657:	89 e5                	mov    %esp,%ebp
+  801659:	53                   	push   %ebx
+  80165a:	83 ec 04             	sub    $0x4,%esp
+  80165d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801660:	89 d8                	mov    %ebx,%eax
+  801662:	03 05 40 20 80 00    	add    0x802040,%eax
+  801668:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80166d:	76 0d                	jbe    80167c <bwrite+0x26>
+  80166f:	e8 47 ff ff ff       	call   8015bb <bflush>
+  801674:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  80167a:	77 25                	ja     8016a1 <bwrite+0x4b>
+  80167c:	83 ec 04             	sub    $0x4,%esp
+  80167f:	53                   	push   %ebx
+  801680:	ff 75 08             	push   0x8(%ebp)
+  801683:	a1 40 20 80 00       	mov    0x802040,%eax
+  801688:	05 44 20 80 00       	add    $0x802044,%eax
+  80168d:	50                   	push   %eax
+  80168e:	e8 15 f3 ff ff       	call   8009a8 <memcpy>
+  801693:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  801699:	83 c4 10             	add    $0x10,%esp
+  80169c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80169f:	c9                   	leave
+  8016a0:	c3                   	ret
+  8016a1:	83 ec 08             	sub    $0x8,%esp
+  8016a4:	53                   	push   %ebx
+  8016a5:	ff 75 08             	push   0x8(%ebp)
+  8016a8:	e8 fd f4 ff ff       	call   800baa <sys_cputs>
+  8016ad:	83 c4 10             	add    $0x10,%esp
+  8016b0:	eb ea                	jmp    80169c <bwrite+0x46>
+
+008016b2 <_panic>:
+  8016b2:	55                   	push   %ebp
+  8016b3:	89 e5                	mov    %esp,%ebp
+  8016b5:	56                   	push   %esi
+  8016b6:	53                   	push   %ebx
+  8016b7:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8016ba:	e8 fc fe ff ff       	call   8015bb <bflush>
+  8016bf:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  8016c5:	e8 39 f6 ff ff       	call   800d03 <sys_getenvid>
+  8016ca:	83 ec 0c             	sub    $0xc,%esp
+  8016cd:	ff 75 0c             	push   0xc(%ebp)
+  8016d0:	ff 75 08             	push   0x8(%ebp)
+  8016d3:	56                   	push   %esi
+  8016d4:	50                   	push   %eax
+  8016d5:	68 10 1c 80 00       	push   $0x801c10
+  8016da:	e8 67 ea ff ff       	call   800146 <cprintf>
+  8016df:	83 c4 18             	add    $0x18,%esp
+  8016e2:	53                   	push   %ebx
+  8016e3:	ff 75 10             	push   0x10(%ebp)
+  8016e6:	e8 0a ea ff ff       	call   8000f5 <vcprintf>
+  8016eb:	c7 04 24 9c 19 80 00 	movl   $0x80199c,(%esp)
+  8016f2:	e8 4f ea ff ff       	call   800146 <cprintf>
+  8016f7:	83 c4 10             	add    $0x10,%esp
+  8016fa:	cc                   	int3
+  8016fb:	eb fd                	jmp    8016fa <_panic+0x48>
+
+008016fd <__udivdi3>:
+  8016fd:	57                   	push   %edi
+  8016fe:	56                   	push   %esi
+  8016ff:	53                   	push   %ebx
+  801700:	83 ec 20             	sub    $0x20,%esp
+  801703:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801707:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80170b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80170f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801713:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801717:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80171b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80171f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801723:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801727:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  80172b:	89 d1                	mov    %edx,%ecx
+  80172d:	09 c1                	or     %eax,%ecx
+  80172f:	0f 84 91 00 00 00    	je     8017c6 <__udivdi3+0xc9>
+  801735:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80173c:	00 
+  80173d:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801744:	00 
+  801745:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80174a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801754:	eb 08                	jmp    80175e <__udivdi3+0x61>
+  801756:	83 e9 01             	sub    $0x1,%ecx
+  801759:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80175c:	74 68                	je     8017c6 <__udivdi3+0xc9>
+  80175e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801762:	01 c0                	add    %eax,%eax
+  801764:	89 c6                	mov    %eax,%esi
+  801766:	89 d7                	mov    %edx,%edi
+  801768:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80176c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801770:	0f ad d0             	shrd   %cl,%edx,%eax
+  801773:	d3 ea                	shr    %cl,%edx
+  801775:	f6 c1 20             	test   $0x20,%cl
+  801778:	74 04                	je     80177e <__udivdi3+0x81>
+  80177a:	89 d0                	mov    %edx,%eax
+  80177c:	31 d2                	xor    %edx,%edx
+  80177e:	83 e0 01             	and    $0x1,%eax
+  801781:	89 04 24             	mov    %eax,(%esp)
+  801784:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80178b:	00 
+  80178c:	8b 04 24             	mov    (%esp),%eax
+  80178f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801793:	09 f0                	or     %esi,%eax
+  801795:	09 fa                	or     %edi,%edx
+  801797:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80179b:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80179f:	39 f0                	cmp    %esi,%eax
+  8017a1:	89 d3                	mov    %edx,%ebx
+  8017a3:	19 fb                	sbb    %edi,%ebx
+  8017a5:	72 af                	jb     801756 <__udivdi3+0x59>
+  8017a7:	29 f0                	sub    %esi,%eax
+  8017a9:	19 fa                	sbb    %edi,%edx
+  8017ab:	89 cf                	mov    %ecx,%edi
+  8017ad:	c1 ef 05             	shr    $0x5,%edi
+  8017b0:	83 e7 01             	and    $0x1,%edi
+  8017b3:	89 fe                	mov    %edi,%esi
+  8017b5:	83 f6 01             	xor    $0x1,%esi
+  8017b8:	d3 e6                	shl    %cl,%esi
+  8017ba:	d3 e7                	shl    %cl,%edi
+  8017bc:	09 74 24 18          	or     %esi,0x18(%esp)
+  8017c0:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8017c4:	eb 90                	jmp    801756 <__udivdi3+0x59>
+  8017c6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8017ca:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8017ce:	83 c4 20             	add    $0x20,%esp
+  8017d1:	5b                   	pop    %ebx
+  8017d2:	5e                   	pop    %esi
+  8017d3:	5f                   	pop    %edi
+  8017d4:	c3                   	ret
+
+008017d5 <__umoddi3>:
+  8017d5:	55                   	push   %ebp
+  8017d6:	57                   	push   %edi
+  8017d7:	56                   	push   %esi
+  8017d8:	53                   	push   %ebx
+  8017d9:	83 ec 1c             	sub    $0x1c,%esp
+  8017dc:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8017e0:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8017e4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8017e8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8017ec:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8017f0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8017f4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8017f8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8017fc:	89 d6                	mov    %edx,%esi
+  8017fe:	09 c6                	or     %eax,%esi
+  801800:	74 6c                	je     80186e <__umoddi3+0x99>
+  801802:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801811:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801815:	eb 0e                	jmp    801825 <__umoddi3+0x50>
+  801817:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  80181c:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801820:	83 fe ff             	cmp    $0xffffffff,%esi
+  801823:	74 49                	je     80186e <__umoddi3+0x99>
+  801825:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801829:	01 c0                	add    %eax,%eax
+  80182b:	89 c3                	mov    %eax,%ebx
+  80182d:	89 d6                	mov    %edx,%esi
+  80182f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801833:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801837:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  80183c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80183f:	d3 ea                	shr    %cl,%edx
+  801841:	f6 c1 20             	test   $0x20,%cl
+  801844:	74 04                	je     80184a <__umoddi3+0x75>
+  801846:	89 d0                	mov    %edx,%eax
+  801848:	31 d2                	xor    %edx,%edx
+  80184a:	83 e0 01             	and    $0x1,%eax
+  80184d:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801852:	89 ea                	mov    %ebp,%edx
+  801854:	09 d8                	or     %ebx,%eax
+  801856:	09 f2                	or     %esi,%edx
+  801858:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  80185c:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801860:	39 d8                	cmp    %ebx,%eax
+  801862:	89 d1                	mov    %edx,%ecx
+  801864:	19 f1                	sbb    %esi,%ecx
+  801866:	72 af                	jb     801817 <__umoddi3+0x42>
+  801868:	29 d8                	sub    %ebx,%eax
+  80186a:	19 f2                	sbb    %esi,%edx
+  80186c:	eb a9                	jmp    801817 <__umoddi3+0x42>
+  80186e:	83 c4 1c             	add    $0x1c,%esp
+  801871:	5b                   	pop    %ebx
+  801872:	5e                   	pop    %esi
+  801873:	5f                   	pop    %edi
+  801874:	5d                   	pop    %ebp
+  801875:	c3                   	ret
+
+00801876 <__divdi3>:
+  801876:	53                   	push   %ebx
+  801877:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80187b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80187f:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801883:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801887:	85 d2                	test   %edx,%edx
+  801889:	78 12                	js     80189d <__divdi3+0x27>
+  80188b:	85 db                	test   %ebx,%ebx
+  80188d:	78 2e                	js     8018bd <__divdi3+0x47>
+  80188f:	53                   	push   %ebx
+  801890:	51                   	push   %ecx
+  801891:	52                   	push   %edx
+  801892:	50                   	push   %eax
+  801893:	e8 65 fe ff ff       	call   8016fd <__udivdi3>
+  801898:	83 c4 10             	add    $0x10,%esp
+  80189b:	eb 1e                	jmp    8018bb <__divdi3+0x45>
+  80189d:	f7 d8                	neg    %eax
+  80189f:	83 d2 00             	adc    $0x0,%edx
+  8018a2:	f7 da                	neg    %edx
+  8018a4:	85 db                	test   %ebx,%ebx
+  8018a6:	78 2a                	js     8018d2 <__divdi3+0x5c>
+  8018a8:	53                   	push   %ebx
+  8018a9:	51                   	push   %ecx
+  8018aa:	52                   	push   %edx
+  8018ab:	50                   	push   %eax
+  8018ac:	e8 4c fe ff ff       	call   8016fd <__udivdi3>
+  8018b1:	83 c4 10             	add    $0x10,%esp
+  8018b4:	f7 d8                	neg    %eax
+  8018b6:	83 d2 00             	adc    $0x0,%edx
+  8018b9:	f7 da                	neg    %edx
+  8018bb:	5b                   	pop    %ebx
+  8018bc:	c3                   	ret
+  8018bd:	f7 d9                	neg    %ecx
+  8018bf:	83 d3 00             	adc    $0x0,%ebx
+  8018c2:	f7 db                	neg    %ebx
+  8018c4:	53                   	push   %ebx
+  8018c5:	51                   	push   %ecx
+  8018c6:	52                   	push   %edx
+  8018c7:	50                   	push   %eax
+  8018c8:	e8 30 fe ff ff       	call   8016fd <__udivdi3>
+  8018cd:	83 c4 10             	add    $0x10,%esp
+  8018d0:	eb e2                	jmp    8018b4 <__divdi3+0x3e>
+  8018d2:	f7 d9                	neg    %ecx
+  8018d4:	83 d3 00             	adc    $0x0,%ebx
+  8018d7:	f7 db                	neg    %ebx
+  8018d9:	53                   	push   %ebx
+  8018da:	51                   	push   %ecx
+  8018db:	52                   	push   %edx
+  8018dc:	50                   	push   %eax
+  8018dd:	e8 1b fe ff ff       	call   8016fd <__udivdi3>
+  8018e2:	83 c4 10             	add    $0x10,%esp
+  8018e5:	eb d4                	jmp    8018bb <__divdi3+0x45>
+
+008018e7 <__moddi3>:
+  8018e7:	55                   	push   %ebp
+  8018e8:	57                   	push   %edi
+  8018e9:	56                   	push   %esi
+  8018ea:	53                   	push   %ebx
+  8018eb:	83 ec 14             	sub    $0x14,%esp
+  8018ee:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  8018f2:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  8018f6:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8018fa:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8018fe:	85 ed                	test   %ebp,%ebp
+  801900:	78 2b                	js     80192d <__moddi3+0x46>
+  801902:	89 c6                	mov    %eax,%esi
+  801904:	f7 de                	neg    %esi
+  801906:	89 34 24             	mov    %esi,(%esp)
+  801909:	89 d6                	mov    %edx,%esi
+  80190b:	83 d6 00             	adc    $0x0,%esi
+  80190e:	f7 de                	neg    %esi
+  801910:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801914:	8b 34 24             	mov    (%esp),%esi
+  801917:	0f 48 f0             	cmovs  %eax,%esi
+  80191a:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  80191f:	52                   	push   %edx
+  801920:	56                   	push   %esi
+  801921:	55                   	push   %ebp
+  801922:	57                   	push   %edi
+  801923:	e8 ad fe ff ff       	call   8017d5 <__umoddi3>
+  801928:	83 c4 10             	add    $0x10,%esp
+  80192b:	eb 3c                	jmp    801969 <__moddi3+0x82>
+  80192d:	89 c3                	mov    %eax,%ebx
+  80192f:	f7 db                	neg    %ebx
+  801931:	89 d1                	mov    %edx,%ecx
+  801933:	83 d1 00             	adc    $0x0,%ecx
+  801936:	f7 d9                	neg    %ecx
+  801938:	0f 49 c3             	cmovns %ebx,%eax
+  80193b:	89 04 24             	mov    %eax,(%esp)
+  80193e:	0f 49 d1             	cmovns %ecx,%edx
+  801941:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801945:	ff 74 24 04          	push   0x4(%esp)
+  801949:	ff 74 24 04          	push   0x4(%esp)
+  80194d:	89 f8                	mov    %edi,%eax
+  80194f:	89 ea                	mov    %ebp,%edx
+  801951:	f7 d8                	neg    %eax
+  801953:	83 d2 00             	adc    $0x0,%edx
+  801956:	f7 da                	neg    %edx
+  801958:	52                   	push   %edx
+  801959:	50                   	push   %eax
+  80195a:	e8 76 fe ff ff       	call   8017d5 <__umoddi3>
+  80195f:	83 c4 10             	add    $0x10,%esp
+  801962:	f7 d8                	neg    %eax
+  801964:	83 d2 00             	adc    $0x0,%edx
+  801967:	f7 da                	neg    %edx
+  801969:	83 c4 14             	add    $0x14,%esp
+  80196c:	5b                   	pop    %ebx
+  80196d:	5e                   	pop    %esi
+  80196e:	5f                   	pop    %edi
+  80196f:	5d                   	pop    %ebp
+  801970:	c3                   	ret
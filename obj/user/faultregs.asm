@@ -0,0 +1,2989 @@
+
+obj/user/faultregs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 b0 05 00 00       	call   8005e1 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <check_regs>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	89 c6                	mov    %eax,%esi
+  80003e:	89 cb                	mov    %ecx,%ebx
+  800040:	ff 75 08             	push   0x8(%ebp)
+  800043:	52                   	push   %edx
+  800044:	68 d1 1f 80 00       	push   $0x801fd1
+  800049:	68 a0 1f 80 00       	push   $0x801fa0
+  80004e:	e8 d1 06 00 00       	call   800724 <cprintf>
+  800053:	ff 33                	push   (%ebx)
+  800055:	ff 36                	push   (%esi)
+  800057:	68 b0 1f 80 00       	push   $0x801fb0
+  80005c:	68 b4 1f 80 00       	push   $0x801fb4
+  800061:	e8 be 06 00 00       	call   800724 <cprintf>
+  800066:	83 c4 20             	add    $0x20,%esp
+  800069:	8b 03                	mov    (%ebx),%eax
+  80006b:	39 06                	cmp    %eax,(%esi)
+  80006d:	0f 84 2e 02 00 00    	je     8002a1 <check_regs+0x26e>
+  800073:	83 ec 0c             	sub    $0xc,%esp
+  800076:	68 c8 1f 80 00       	push   $0x801fc8
+  80007b:	e8 a4 06 00 00       	call   800724 <cprintf>
+  800080:	83 c4 10             	add    $0x10,%esp
+  800083:	bf 01 00 00 00       	mov    $0x1,%edi
+  800088:	ff 73 04             	push   0x4(%ebx)
+  80008b:	ff 76 04             	push   0x4(%esi)
+  80008e:	68 d2 1f 80 00       	push   $0x801fd2
+  800093:	68 b4 1f 80 00       	push   $0x801fb4
+  800098:	e8 87 06 00 00       	call   800724 <cprintf>
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8000a3:	39 46 04             	cmp    %eax,0x4(%esi)
+  8000a6:	0f 84 0f 02 00 00    	je     8002bb <check_regs+0x288>
+  8000ac:	83 ec 0c             	sub    $0xc,%esp
+  8000af:	68 c8 1f 80 00       	push   $0x801fc8
+  8000b4:	e8 6b 06 00 00       	call   800724 <cprintf>
+  8000b9:	83 c4 10             	add    $0x10,%esp
+  8000bc:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000c1:	ff 73 08             	push   0x8(%ebx)
+  8000c4:	ff 76 08             	push   0x8(%esi)
+  8000c7:	68 d6 1f 80 00       	push   $0x801fd6
+  8000cc:	68 b4 1f 80 00       	push   $0x801fb4
+  8000d1:	e8 4e 06 00 00       	call   800724 <cprintf>
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8000dc:	39 46 08             	cmp    %eax,0x8(%esi)
+  8000df:	0f 84 eb 01 00 00    	je     8002d0 <check_regs+0x29d>
+  8000e5:	83 ec 0c             	sub    $0xc,%esp
+  8000e8:	68 c8 1f 80 00       	push   $0x801fc8
+  8000ed:	e8 32 06 00 00       	call   800724 <cprintf>
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000fa:	ff 73 10             	push   0x10(%ebx)
+  8000fd:	ff 76 10             	push   0x10(%esi)
+  800100:	68 da 1f 80 00       	push   $0x801fda
+  800105:	68 b4 1f 80 00       	push   $0x801fb4
+  80010a:	e8 15 06 00 00       	call   800724 <cprintf>
+  80010f:	83 c4 10             	add    $0x10,%esp
+  800112:	8b 43 10             	mov    0x10(%ebx),%eax
+  800115:	39 46 10             	cmp    %eax,0x10(%esi)
+  800118:	0f 84 c7 01 00 00    	je     8002e5 <check_regs+0x2b2>
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	68 c8 1f 80 00       	push   $0x801fc8
+  800126:	e8 f9 05 00 00       	call   800724 <cprintf>
+  80012b:	83 c4 10             	add    $0x10,%esp
+  80012e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800133:	ff 73 14             	push   0x14(%ebx)
+  800136:	ff 76 14             	push   0x14(%esi)
+  800139:	68 de 1f 80 00       	push   $0x801fde
+  80013e:	68 b4 1f 80 00       	push   $0x801fb4
+  800143:	e8 dc 05 00 00       	call   800724 <cprintf>
+  800148:	83 c4 10             	add    $0x10,%esp
+  80014b:	8b 43 14             	mov    0x14(%ebx),%eax
+  80014e:	39 46 14             	cmp    %eax,0x14(%esi)
+  800151:	0f 84 a3 01 00 00    	je     8002fa <check_regs+0x2c7>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	68 c8 1f 80 00       	push   $0x801fc8
+  80015f:	e8 c0 05 00 00       	call   800724 <cprintf>
+  800164:	83 c4 10             	add    $0x10,%esp
+  800167:	bf 01 00 00 00       	mov    $0x1,%edi
+  80016c:	ff 73 18             	push   0x18(%ebx)
+  80016f:	ff 76 18             	push   0x18(%esi)
+  800172:	68 e2 1f 80 00       	push   $0x801fe2
+  800177:	68 b4 1f 80 00       	push   $0x801fb4
+  80017c:	e8 a3 05 00 00       	call   800724 <cprintf>
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	8b 43 18             	mov    0x18(%ebx),%eax
+  800187:	39 46 18             	cmp    %eax,0x18(%esi)
+  80018a:	0f 84 7f 01 00 00    	je     80030f <check_regs+0x2dc>
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	68 c8 1f 80 00       	push   $0x801fc8
+  800198:	e8 87 05 00 00       	call   800724 <cprintf>
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001a5:	ff 73 1c             	push   0x1c(%ebx)
+  8001a8:	ff 76 1c             	push   0x1c(%esi)
+  8001ab:	68 e6 1f 80 00       	push   $0x801fe6
+  8001b0:	68 b4 1f 80 00       	push   $0x801fb4
+  8001b5:	e8 6a 05 00 00       	call   800724 <cprintf>
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8001c0:	39 46 1c             	cmp    %eax,0x1c(%esi)
+  8001c3:	0f 84 5b 01 00 00    	je     800324 <check_regs+0x2f1>
+  8001c9:	83 ec 0c             	sub    $0xc,%esp
+  8001cc:	68 c8 1f 80 00       	push   $0x801fc8
+  8001d1:	e8 4e 05 00 00       	call   800724 <cprintf>
+  8001d6:	83 c4 10             	add    $0x10,%esp
+  8001d9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001de:	ff 73 20             	push   0x20(%ebx)
+  8001e1:	ff 76 20             	push   0x20(%esi)
+  8001e4:	68 ea 1f 80 00       	push   $0x801fea
+  8001e9:	68 b4 1f 80 00       	push   $0x801fb4
+  8001ee:	e8 31 05 00 00       	call   800724 <cprintf>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+  8001f6:	8b 43 20             	mov    0x20(%ebx),%eax
+  8001f9:	39 46 20             	cmp    %eax,0x20(%esi)
+  8001fc:	0f 84 37 01 00 00    	je     800339 <check_regs+0x306>
+  800202:	83 ec 0c             	sub    $0xc,%esp
+  800205:	68 c8 1f 80 00       	push   $0x801fc8
+  80020a:	e8 15 05 00 00       	call   800724 <cprintf>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	bf 01 00 00 00       	mov    $0x1,%edi
+  800217:	ff 73 24             	push   0x24(%ebx)
+  80021a:	ff 76 24             	push   0x24(%esi)
+  80021d:	68 ee 1f 80 00       	push   $0x801fee
+  800222:	68 b4 1f 80 00       	push   $0x801fb4
+  800227:	e8 f8 04 00 00       	call   800724 <cprintf>
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	8b 43 24             	mov    0x24(%ebx),%eax
+  800232:	39 46 24             	cmp    %eax,0x24(%esi)
+  800235:	0f 84 13 01 00 00    	je     80034e <check_regs+0x31b>
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	68 c8 1f 80 00       	push   $0x801fc8
+  800243:	e8 dc 04 00 00       	call   800724 <cprintf>
+  800248:	ff 73 28             	push   0x28(%ebx)
+  80024b:	ff 76 28             	push   0x28(%esi)
+  80024e:	68 f5 1f 80 00       	push   $0x801ff5
+  800253:	68 b4 1f 80 00       	push   $0x801fb4
+  800258:	e8 c7 04 00 00       	call   800724 <cprintf>
+  80025d:	83 c4 20             	add    $0x20,%esp
+  800260:	8b 43 28             	mov    0x28(%ebx),%eax
+  800263:	39 46 28             	cmp    %eax,0x28(%esi)
+  800266:	0f 84 53 01 00 00    	je     8003bf <check_regs+0x38c>
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+  80026f:	68 c8 1f 80 00       	push   $0x801fc8
+  800274:	e8 ab 04 00 00       	call   800724 <cprintf>
+  800279:	83 c4 08             	add    $0x8,%esp
+  80027c:	ff 75 0c             	push   0xc(%ebp)
+  80027f:	68 f9 1f 80 00       	push   $0x801ff9
+  800284:	e8 9b 04 00 00       	call   800724 <cprintf>
+  800289:	83 c4 10             	add    $0x10,%esp
+  80028c:	83 ec 0c             	sub    $0xc,%esp
+  80028f:	68 c8 1f 80 00       	push   $0x801fc8
+  800294:	e8 8b 04 00 00       	call   800724 <cprintf>
+  800299:	83 c4 10             	add    $0x10,%esp
+  80029c:	e9 16 01 00 00       	jmp    8003b7 <check_regs+0x384>
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	68 c4 1f 80 00       	push   $0x801fc4
+  8002a9:	e8 76 04 00 00       	call   800724 <cprintf>
+  8002ae:	83 c4 10             	add    $0x10,%esp
+  8002b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b6:	e9 cd fd ff ff       	jmp    800088 <check_regs+0x55>
+  8002bb:	83 ec 0c             	sub    $0xc,%esp
+  8002be:	68 c4 1f 80 00       	push   $0x801fc4
+  8002c3:	e8 5c 04 00 00       	call   800724 <cprintf>
+  8002c8:	83 c4 10             	add    $0x10,%esp
+  8002cb:	e9 f1 fd ff ff       	jmp    8000c1 <check_regs+0x8e>
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+  8002d3:	68 c4 1f 80 00       	push   $0x801fc4
+  8002d8:	e8 47 04 00 00       	call   800724 <cprintf>
+  8002dd:	83 c4 10             	add    $0x10,%esp
+  8002e0:	e9 15 fe ff ff       	jmp    8000fa <check_regs+0xc7>
+  8002e5:	83 ec 0c             	sub    $0xc,%esp
+  8002e8:	68 c4 1f 80 00       	push   $0x801fc4
+  8002ed:	e8 32 04 00 00       	call   800724 <cprintf>
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	e9 39 fe ff ff       	jmp    800133 <check_regs+0x100>
+  8002fa:	83 ec 0c             	sub    $0xc,%esp
+  8002fd:	68 c4 1f 80 00       	push   $0x801fc4
+  800302:	e8 1d 04 00 00       	call   800724 <cprintf>
+  800307:	83 c4 10             	add    $0x10,%esp
+  80030a:	e9 5d fe ff ff       	jmp    80016c <check_regs+0x139>
+  80030f:	83 ec 0c             	sub    $0xc,%esp
+  800312:	68 c4 1f 80 00       	push   $0x801fc4
+  800317:	e8 08 04 00 00       	call   800724 <cprintf>
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	e9 81 fe ff ff       	jmp    8001a5 <check_regs+0x172>
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	68 c4 1f 80 00       	push   $0x801fc4
+  80032c:	e8 f3 03 00 00       	call   800724 <cprintf>
+  800331:	83 c4 10             	add    $0x10,%esp
+  800334:	e9 a5 fe ff ff       	jmp    8001de <check_regs+0x1ab>
+  800339:	83 ec 0c             	sub    $0xc,%esp
+  80033c:	68 c4 1f 80 00       	push   $0x801fc4
+  800341:	e8 de 03 00 00       	call   800724 <cprintf>
+  800346:	83 c4 10             	add    $0x10,%esp
+  800349:	e9 c9 fe ff ff       	jmp    800217 <check_regs+0x1e4>
+  80034e:	83 ec 0c             	sub    $0xc,%esp
+  800351:	68 c4 1f 80 00       	push   $0x801fc4
+  800356:	e8 c9 03 00 00       	call   800724 <cprintf>
+  80035b:	ff 73 28             	push   0x28(%ebx)
+  80035e:	ff 76 28             	push   0x28(%esi)
+  800361:	68 f5 1f 80 00       	push   $0x801ff5
+  800366:	68 b4 1f 80 00       	push   $0x801fb4
+  80036b:	e8 b4 03 00 00       	call   800724 <cprintf>
+  800370:	83 c4 20             	add    $0x20,%esp
+  800373:	8b 43 28             	mov    0x28(%ebx),%eax
+  800376:	39 46 28             	cmp    %eax,0x28(%esi)
+  800379:	0f 85 ed fe ff ff    	jne    80026c <check_regs+0x239>
+  80037f:	83 ec 0c             	sub    $0xc,%esp
+  800382:	68 c4 1f 80 00       	push   $0x801fc4
+  800387:	e8 98 03 00 00       	call   800724 <cprintf>
+  80038c:	83 c4 08             	add    $0x8,%esp
+  80038f:	ff 75 0c             	push   0xc(%ebp)
+  800392:	68 f9 1f 80 00       	push   $0x801ff9
+  800397:	e8 88 03 00 00       	call   800724 <cprintf>
+  80039c:	83 c4 10             	add    $0x10,%esp
+  80039f:	85 ff                	test   %edi,%edi
+  8003a1:	0f 85 e5 fe ff ff    	jne    80028c <check_regs+0x259>
+  8003a7:	83 ec 0c             	sub    $0xc,%esp
+  8003aa:	68 c4 1f 80 00       	push   $0x801fc4
+  8003af:	e8 70 03 00 00       	call   800724 <cprintf>
+  8003b4:	83 c4 10             	add    $0x10,%esp
+  8003b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ba:	5b                   	pop    %ebx
+  8003bb:	5e                   	pop    %esi
+  8003bc:	5f                   	pop    %edi
+  8003bd:	5d                   	pop    %ebp
+  8003be:	c3                   	ret
+  8003bf:	83 ec 0c             	sub    $0xc,%esp
+  8003c2:	68 c4 1f 80 00       	push   $0x801fc4
+  8003c7:	e8 58 03 00 00       	call   800724 <cprintf>
+  8003cc:	83 c4 08             	add    $0x8,%esp
+  8003cf:	ff 75 0c             	push   0xc(%ebp)
+  8003d2:	68 f9 1f 80 00       	push   $0x801ff9
+  8003d7:	e8 48 03 00 00       	call   800724 <cprintf>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	e9 a8 fe ff ff       	jmp    80028c <check_regs+0x259>
+
+008003e4 <pgfault>:
+  8003e4:	55                   	push   %ebp
+  8003e5:	89 e5                	mov    %esp,%ebp
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003ed:	8b 10                	mov    (%eax),%edx
+  8003ef:	81 fa 00 00 40 00    	cmp    $0x400000,%edx
+  8003f5:	0f 85 a3 00 00 00    	jne    80049e <pgfault+0xba>
+  8003fb:	8b 50 08             	mov    0x8(%eax),%edx
+  8003fe:	89 15 60 30 80 00    	mov    %edx,0x803060
+  800404:	8b 50 0c             	mov    0xc(%eax),%edx
+  800407:	89 15 64 30 80 00    	mov    %edx,0x803064
+  80040d:	8b 50 10             	mov    0x10(%eax),%edx
+  800410:	89 15 68 30 80 00    	mov    %edx,0x803068
+  800416:	8b 50 14             	mov    0x14(%eax),%edx
+  800419:	89 15 6c 30 80 00    	mov    %edx,0x80306c
+  80041f:	8b 50 18             	mov    0x18(%eax),%edx
+  800422:	89 15 70 30 80 00    	mov    %edx,0x803070
+  800428:	8b 50 1c             	mov    0x1c(%eax),%edx
+  80042b:	89 15 74 30 80 00    	mov    %edx,0x803074
+  800431:	8b 50 20             	mov    0x20(%eax),%edx
+  800434:	89 15 78 30 80 00    	mov    %edx,0x803078
+  80043a:	8b 50 24             	mov    0x24(%eax),%edx
+  80043d:	89 15 7c 30 80 00    	mov    %edx,0x80307c
+  800443:	8b 50 28             	mov    0x28(%eax),%edx
+  800446:	89 15 80 30 80 00    	mov    %edx,0x803080
+  80044c:	8b 50 2c             	mov    0x2c(%eax),%edx
+  80044f:	81 e2 ff ff fe ff    	and    $0xfffeffff,%edx
+  800455:	89 15 84 30 80 00    	mov    %edx,0x803084
+  80045b:	8b 40 30             	mov    0x30(%eax),%eax
+  80045e:	a3 88 30 80 00       	mov    %eax,0x803088
+  800463:	83 ec 08             	sub    $0x8,%esp
+  800466:	68 1f 20 80 00       	push   $0x80201f
+  80046b:	68 2d 20 80 00       	push   $0x80202d
+  800470:	b9 60 30 80 00       	mov    $0x803060,%ecx
+  800475:	ba 18 20 80 00       	mov    $0x802018,%edx
+  80047a:	b8 a0 30 80 00       	mov    $0x8030a0,%eax
+  80047f:	e8 af fb ff ff       	call   800033 <check_regs>
+  800484:	83 c4 0c             	add    $0xc,%esp
+  800487:	6a 07                	push   $0x7
+  800489:	68 00 00 40 00       	push   $0x400000
+  80048e:	6a 00                	push   $0x0
+  800490:	e8 36 10 00 00       	call   8014cb <sys_page_alloc>
+  800495:	83 c4 10             	add    $0x10,%esp
+  800498:	85 c0                	test   %eax,%eax
+  80049a:	78 1a                	js     8004b6 <pgfault+0xd2>
+  80049c:	c9                   	leave
+  80049d:	c3                   	ret
+  80049e:	83 ec 0c             	sub    $0xc,%esp
+  8004a1:	ff 70 28             	push   0x28(%eax)
+  8004a4:	52                   	push   %edx
+  8004a5:	68 60 20 80 00       	push   $0x802060
+  8004aa:	6a 50                	push   $0x50
+  8004ac:	68 07 20 80 00       	push   $0x802007
+  8004b1:	e8 8e 01 00 00       	call   800644 <_panic>
+  8004b6:	50                   	push   %eax
+  8004b7:	68 34 20 80 00       	push   $0x802034
+  8004bc:	6a 5c                	push   $0x5c
+  8004be:	68 07 20 80 00       	push   $0x802007
+  8004c3:	e8 7c 01 00 00       	call   800644 <_panic>
+
+008004c8 <umain>:
+  8004c8:	55                   	push   %ebp
+  8004c9:	89 e5                	mov    %esp,%ebp
+  8004cb:	83 ec 14             	sub    $0x14,%esp
+  8004ce:	68 e4 03 80 00       	push   $0x8003e4
+  8004d3:	e8 28 16 00 00       	call   801b00 <set_pgfault_handler>
+  8004d8:	50                   	push   %eax
+  8004d9:	9c                   	pushf
+  8004da:	58                   	pop    %eax
+  8004db:	0d d5 08 00 00       	or     $0x8d5,%eax
+  8004e0:	50                   	push   %eax
+  8004e1:	9d                   	popf
+  8004e2:	a3 c4 30 80 00       	mov    %eax,0x8030c4
+  8004e7:	8d 05 22 05 80 00    	lea    0x800522,%eax
+  8004ed:	a3 c0 30 80 00       	mov    %eax,0x8030c0
+  8004f2:	58                   	pop    %eax
+  8004f3:	89 3d a0 30 80 00    	mov    %edi,0x8030a0
+  8004f9:	89 35 a4 30 80 00    	mov    %esi,0x8030a4
+  8004ff:	89 2d a8 30 80 00    	mov    %ebp,0x8030a8
+  800505:	89 1d b0 30 80 00    	mov    %ebx,0x8030b0
+  80050b:	89 15 b4 30 80 00    	mov    %edx,0x8030b4
+  800511:	89 0d b8 30 80 00    	mov    %ecx,0x8030b8
+  800517:	a3 bc 30 80 00       	mov    %eax,0x8030bc
+  80051c:	89 25 c8 30 80 00    	mov    %esp,0x8030c8
+  800522:	c7 05 00 00 40 00 2a 	movl   $0x2a,0x400000
+  800529:	00 00 00 
+  80052c:	89 3d 20 30 80 00    	mov    %edi,0x803020
+  800532:	89 35 24 30 80 00    	mov    %esi,0x803024
+  800538:	89 2d 28 30 80 00    	mov    %ebp,0x803028
+  80053e:	89 1d 30 30 80 00    	mov    %ebx,0x803030
+  800544:	89 15 34 30 80 00    	mov    %edx,0x803034
+  80054a:	89 0d 38 30 80 00    	mov    %ecx,0x803038
+  800550:	a3 3c 30 80 00       	mov    %eax,0x80303c
+  800555:	89 25 48 30 80 00    	mov    %esp,0x803048
+  80055b:	8b 3d a0 30 80 00    	mov    0x8030a0,%edi
+  800561:	8b 35 a4 30 80 00    	mov    0x8030a4,%esi
+  800567:	8b 2d a8 30 80 00    	mov    0x8030a8,%ebp
+  80056d:	8b 1d b0 30 80 00    	mov    0x8030b0,%ebx
+  800573:	8b 15 b4 30 80 00    	mov    0x8030b4,%edx
+  800579:	8b 0d b8 30 80 00    	mov    0x8030b8,%ecx
+  80057f:	a1 bc 30 80 00       	mov    0x8030bc,%eax
+  800584:	8b 25 c8 30 80 00    	mov    0x8030c8,%esp
+  80058a:	50                   	push   %eax
+  80058b:	9c                   	pushf
+  80058c:	58                   	pop    %eax
+  80058d:	a3 44 30 80 00       	mov    %eax,0x803044
+  800592:	58                   	pop    %eax
+  800593:	83 c4 10             	add    $0x10,%esp
+  800596:	83 3d 00 00 40 00 2a 	cmpl   $0x2a,0x400000
+  80059d:	75 30                	jne    8005cf <umain+0x107>
+  80059f:	a1 c0 30 80 00       	mov    0x8030c0,%eax
+  8005a4:	a3 40 30 80 00       	mov    %eax,0x803040
+  8005a9:	83 ec 08             	sub    $0x8,%esp
+  8005ac:	68 47 20 80 00       	push   $0x802047
+  8005b1:	68 58 20 80 00       	push   $0x802058
+  8005b6:	b9 20 30 80 00       	mov    $0x803020,%ecx
+  8005bb:	ba 18 20 80 00       	mov    $0x802018,%edx
+  8005c0:	b8 a0 30 80 00       	mov    $0x8030a0,%eax
+  8005c5:	e8 69 fa ff ff       	call   800033 <check_regs>
+  8005ca:	83 c4 10             	add    $0x10,%esp
+  8005cd:	c9                   	leave
+  8005ce:	c3                   	ret
+  8005cf:	83 ec 0c             	sub    $0xc,%esp
+  8005d2:	68 94 20 80 00       	push   $0x802094
+  8005d7:	e8 48 01 00 00       	call   800724 <cprintf>
+  8005dc:	83 c4 10             	add    $0x10,%esp
+  8005df:	eb be                	jmp    80059f <umain+0xd7>
+
+008005e1 <libmain>:
+  8005e1:	55                   	push   %ebp
+  8005e2:	89 e5                	mov    %esp,%ebp
+  8005e4:	56                   	push   %esi
+  8005e5:	53                   	push   %ebx
+  8005e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8005ec:	e8 a4 15 00 00       	call   801b95 <uinfo_envid>
+  8005f1:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8005f6:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8005fc:	05 00 00 00 ed       	add    $0xed000000,%eax
+  800601:	a3 cc 30 80 00       	mov    %eax,0x8030cc
+  800606:	85 db                	test   %ebx,%ebx
+  800608:	7e 07                	jle    800611 <libmain+0x30>
+  80060a:	8b 06                	mov    (%esi),%eax
+  80060c:	a3 00 30 80 00       	mov    %eax,0x803000
+  800611:	83 ec 08             	sub    $0x8,%esp
+  800614:	56                   	push   %esi
+  800615:	53                   	push   %ebx
+  800616:	e8 ad fe ff ff       	call   8004c8 <umain>
+  80061b:	e8 0a 00 00 00       	call   80062a <exit>
+  800620:	83 c4 10             	add    $0x10,%esp
+  800623:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800626:	5b                   	pop    %ebx
+  800627:	5e                   	pop    %esi
+  800628:	5d                   	pop    %ebp
+  800629:	c3                   	ret
+
+0080062a <exit>:
+  80062a:	55                   	push   %ebp
+  80062b:	89 e5                	mov    %esp,%ebp
+  80062d:	83 ec 08             	sub    $0x8,%esp
+  800630:	e8 f9 15 00 00       	call   801c2e <bflush>
+  800635:	83 ec 0c             	sub    $0xc,%esp
+  800638:	6a 00                	push   $0x0
+  80063a:	e8 17 0c 00 00       	call   801256 <sys_env_destroy>
+  80063f:	83 c4 10             	add    $0x10,%esp
+  800642:	c9                   	leave
+  800643:	c3                   	ret
+
+00800644 <_panic>:
+  800644:	55                   	push   %ebp
+  800645:	89 e5                	mov    %esp,%ebp
+  800647:	56                   	push   %esi
+  800648:	53                   	push   %ebx
+  800649:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80064c:	e8 dd 15 00 00       	call   801c2e <bflush>
+  800651:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  800657:	e8 85 0c 00 00       	call   8012e1 <sys_getenvid>
+  80065c:	83 ec 0c             	sub    $0xc,%esp
+  80065f:	ff 75 0c             	push   0xc(%ebp)
+  800662:	ff 75 08             	push   0x8(%ebp)
+  800665:	56                   	push   %esi
+  800666:	50                   	push   %eax
+  800667:	68 c0 20 80 00       	push   $0x8020c0
+  80066c:	e8 b3 00 00 00       	call   800724 <cprintf>
+  800671:	83 c4 18             	add    $0x18,%esp
+  800674:	53                   	push   %ebx
+  800675:	ff 75 10             	push   0x10(%ebp)
+  800678:	e8 56 00 00 00       	call   8006d3 <vcprintf>
+  80067d:	c7 04 24 d0 1f 80 00 	movl   $0x801fd0,(%esp)
+  800684:	e8 9b 00 00 00       	call   800724 <cprintf>
+  800689:	83 c4 10             	add    $0x10,%esp
+  80068c:	cc                   	int3
+  80068d:	eb fd                	jmp    80068c <_panic+0x48>
+
+0080068f <putch>:
+  80068f:	55                   	push   %ebp
+  800690:	89 e5                	mov    %esp,%ebp
+  800692:	53                   	push   %ebx
+  800693:	83 ec 04             	sub    $0x4,%esp
+  800696:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800699:	8b 13                	mov    (%ebx),%edx
+  80069b:	8d 42 01             	lea    0x1(%edx),%eax
+  80069e:	89 03                	mov    %eax,(%ebx)
+  8006a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8006a3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8006a7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8006ac:	74 09                	je     8006b7 <putch+0x28>
+  8006ae:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8006b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006b5:	c9                   	leave
+  8006b6:	c3                   	ret
+  8006b7:	83 ec 08             	sub    $0x8,%esp
+  8006ba:	68 ff 00 00 00       	push   $0xff
+  8006bf:	8d 43 08             	lea    0x8(%ebx),%eax
+  8006c2:	50                   	push   %eax
+  8006c3:	e8 c0 0a 00 00       	call   801188 <sys_cputs>
+  8006c8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8006ce:	83 c4 10             	add    $0x10,%esp
+  8006d1:	eb db                	jmp    8006ae <putch+0x1f>
+
+008006d3 <vcprintf>:
+  8006d3:	55                   	push   %ebp
+  8006d4:	89 e5                	mov    %esp,%ebp
+  8006d6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8006dc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8006e3:	00 00 00 
+  8006e6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8006ed:	00 00 00 
+  8006f0:	ff 75 0c             	push   0xc(%ebp)
+  8006f3:	ff 75 08             	push   0x8(%ebp)
+  8006f6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8006fc:	50                   	push   %eax
+  8006fd:	68 8f 06 80 00       	push   $0x80068f
+  800702:	e8 14 01 00 00       	call   80081b <vprintfmt>
+  800707:	83 c4 08             	add    $0x8,%esp
+  80070a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800710:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800716:	50                   	push   %eax
+  800717:	e8 6c 0a 00 00       	call   801188 <sys_cputs>
+  80071c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800722:	c9                   	leave
+  800723:	c3                   	ret
+
+00800724 <cprintf>:
+  800724:	55                   	push   %ebp
+  800725:	89 e5                	mov    %esp,%ebp
+  800727:	83 ec 10             	sub    $0x10,%esp
+  80072a:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80072d:	50                   	push   %eax
+  80072e:	ff 75 08             	push   0x8(%ebp)
+  800731:	e8 9d ff ff ff       	call   8006d3 <vcprintf>
+  800736:	c9                   	leave
+  800737:	c3                   	ret
+
+00800738 <printnum>:
+  800738:	55                   	push   %ebp
+  800739:	89 e5                	mov    %esp,%ebp
+  80073b:	57                   	push   %edi
+  80073c:	56                   	push   %esi
+  80073d:	53                   	push   %ebx
+  80073e:	83 ec 1c             	sub    $0x1c,%esp
+  800741:	89 c7                	mov    %eax,%edi
+  800743:	89 d6                	mov    %edx,%esi
+  800745:	8b 45 08             	mov    0x8(%ebp),%eax
+  800748:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80074b:	89 d1                	mov    %edx,%ecx
+  80074d:	89 c2                	mov    %eax,%edx
+  80074f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800752:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800755:	8b 45 10             	mov    0x10(%ebp),%eax
+  800758:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80075b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80075e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800765:	39 c2                	cmp    %eax,%edx
+  800767:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80076a:	72 3e                	jb     8007aa <printnum+0x72>
+  80076c:	83 ec 0c             	sub    $0xc,%esp
+  80076f:	ff 75 18             	push   0x18(%ebp)
+  800772:	83 eb 01             	sub    $0x1,%ebx
+  800775:	53                   	push   %ebx
+  800776:	50                   	push   %eax
+  800777:	83 ec 08             	sub    $0x8,%esp
+  80077a:	ff 75 e4             	push   -0x1c(%ebp)
+  80077d:	ff 75 e0             	push   -0x20(%ebp)
+  800780:	ff 75 dc             	push   -0x24(%ebp)
+  800783:	ff 75 d8             	push   -0x28(%ebp)
+  800786:	e8 9a 15 00 00       	call   801d25 <__udivdi3>
+  80078b:	83 c4 18             	add    $0x18,%esp
+  80078e:	52                   	push   %edx
+  80078f:	50                   	push   %eax
+  800790:	89 f2                	mov    %esi,%edx
+  800792:	89 f8                	mov    %edi,%eax
+  800794:	e8 9f ff ff ff       	call   800738 <printnum>
+  800799:	83 c4 20             	add    $0x20,%esp
+  80079c:	eb 13                	jmp    8007b1 <printnum+0x79>
+  80079e:	83 ec 08             	sub    $0x8,%esp
+  8007a1:	56                   	push   %esi
+  8007a2:	ff 75 18             	push   0x18(%ebp)
+  8007a5:	ff d7                	call   *%edi
+  8007a7:	83 c4 10             	add    $0x10,%esp
+  8007aa:	83 eb 01             	sub    $0x1,%ebx
+  8007ad:	85 db                	test   %ebx,%ebx
+  8007af:	7f ed                	jg     80079e <printnum+0x66>
+  8007b1:	83 ec 08             	sub    $0x8,%esp
+  8007b4:	56                   	push   %esi
+  8007b5:	83 ec 04             	sub    $0x4,%esp
+  8007b8:	ff 75 e4             	push   -0x1c(%ebp)
+  8007bb:	ff 75 e0             	push   -0x20(%ebp)
+  8007be:	ff 75 dc             	push   -0x24(%ebp)
+  8007c1:	ff 75 d8             	push   -0x28(%ebp)
+  8007c4:	e8 34 16 00 00       	call   801dfd <__umoddi3>
+  8007c9:	83 c4 14             	add    $0x14,%esp
+  8007cc:	0f be 80 e3 20 80 00 	movsbl 0x8020e3(%eax),%eax
+  8007d3:	50                   	push   %eax
+  8007d4:	ff d7                	call   *%edi
+  8007d6:	83 c4 10             	add    $0x10,%esp
+  8007d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007dc:	5b                   	pop    %ebx
+  8007dd:	5e                   	pop    %esi
+  8007de:	5f                   	pop    %edi
+  8007df:	5d                   	pop    %ebp
+  8007e0:	c3                   	ret
+
+008007e1 <sprintputch>:
+  8007e1:	55                   	push   %ebp
+  8007e2:	89 e5                	mov    %esp,%ebp
+  8007e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8007e7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8007eb:	8b 10                	mov    (%eax),%edx
+  8007ed:	3b 50 04             	cmp    0x4(%eax),%edx
+  8007f0:	73 0a                	jae    8007fc <sprintputch+0x1b>
+  8007f2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8007f5:	89 08                	mov    %ecx,(%eax)
+  8007f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007fa:	88 02                	mov    %al,(%edx)
+  8007fc:	5d                   	pop    %ebp
+  8007fd:	c3                   	ret
+
+008007fe <printfmt>:
+  8007fe:	55                   	push   %ebp
+  8007ff:	89 e5                	mov    %esp,%ebp
+  800801:	83 ec 08             	sub    $0x8,%esp
+  800804:	8d 45 14             	lea    0x14(%ebp),%eax
+  800807:	50                   	push   %eax
+  800808:	ff 75 10             	push   0x10(%ebp)
+  80080b:	ff 75 0c             	push   0xc(%ebp)
+  80080e:	ff 75 08             	push   0x8(%ebp)
+  800811:	e8 05 00 00 00       	call   80081b <vprintfmt>
+  800816:	83 c4 10             	add    $0x10,%esp
+  800819:	c9                   	leave
+  80081a:	c3                   	ret
+
+0080081b <vprintfmt>:
+  80081b:	55                   	push   %ebp
+  80081c:	89 e5                	mov    %esp,%ebp
+  80081e:	57                   	push   %edi
+  80081f:	56                   	push   %esi
+  800820:	53                   	push   %ebx
+  800821:	83 ec 2c             	sub    $0x2c,%esp
+  800824:	8b 75 08             	mov    0x8(%ebp),%esi
+  800827:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80082a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80082d:	eb 0a                	jmp    800839 <vprintfmt+0x1e>
+  80082f:	83 ec 08             	sub    $0x8,%esp
+  800832:	53                   	push   %ebx
+  800833:	50                   	push   %eax
+  800834:	ff d6                	call   *%esi
+  800836:	83 c4 10             	add    $0x10,%esp
+  800839:	83 c7 01             	add    $0x1,%edi
+  80083c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800840:	83 f8 25             	cmp    $0x25,%eax
+  800843:	74 0c                	je     800851 <vprintfmt+0x36>
+  800845:	85 c0                	test   %eax,%eax
+  800847:	75 e6                	jne    80082f <vprintfmt+0x14>
+  800849:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80084c:	5b                   	pop    %ebx
+  80084d:	5e                   	pop    %esi
+  80084e:	5f                   	pop    %edi
+  80084f:	5d                   	pop    %ebp
+  800850:	c3                   	ret
+  800851:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800855:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80085c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800863:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  80086a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80086f:	8d 47 01             	lea    0x1(%edi),%eax
+  800872:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800875:	0f b6 17             	movzbl (%edi),%edx
+  800878:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80087b:	3c 55                	cmp    $0x55,%al
+  80087d:	0f 87 cf 03 00 00    	ja     800c52 <vprintfmt+0x437>
+  800883:	0f b6 c0             	movzbl %al,%eax
+  800886:	ff 24 85 a0 21 80 00 	jmp    *0x8021a0(,%eax,4)
+  80088d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800890:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800894:	eb d9                	jmp    80086f <vprintfmt+0x54>
+  800896:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800899:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80089d:	eb d0                	jmp    80086f <vprintfmt+0x54>
+  80089f:	0f b6 d2             	movzbl %dl,%edx
+  8008a2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8008a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008aa:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8008ad:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8008b0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  8008b4:	0f be 17             	movsbl (%edi),%edx
+  8008b7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8008ba:	83 f9 09             	cmp    $0x9,%ecx
+  8008bd:	77 55                	ja     800914 <vprintfmt+0xf9>
+  8008bf:	83 c7 01             	add    $0x1,%edi
+  8008c2:	eb e9                	jmp    8008ad <vprintfmt+0x92>
+  8008c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c7:	8b 00                	mov    (%eax),%eax
+  8008c9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8008d8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8008dc:	79 91                	jns    80086f <vprintfmt+0x54>
+  8008de:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008e4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8008eb:	eb 82                	jmp    80086f <vprintfmt+0x54>
+  8008ed:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008f0:	85 d2                	test   %edx,%edx
+  8008f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f7:	0f 49 c2             	cmovns %edx,%eax
+  8008fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800900:	e9 6a ff ff ff       	jmp    80086f <vprintfmt+0x54>
+  800905:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800908:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80090f:	e9 5b ff ff ff       	jmp    80086f <vprintfmt+0x54>
+  800914:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800917:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80091a:	eb bc                	jmp    8008d8 <vprintfmt+0xbd>
+  80091c:	83 c1 01             	add    $0x1,%ecx
+  80091f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800922:	e9 48 ff ff ff       	jmp    80086f <vprintfmt+0x54>
+  800927:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092a:	8d 78 04             	lea    0x4(%eax),%edi
+  80092d:	83 ec 08             	sub    $0x8,%esp
+  800930:	53                   	push   %ebx
+  800931:	ff 30                	push   (%eax)
+  800933:	ff d6                	call   *%esi
+  800935:	83 c4 10             	add    $0x10,%esp
+  800938:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80093b:	e9 b1 02 00 00       	jmp    800bf1 <vprintfmt+0x3d6>
+  800940:	8b 45 14             	mov    0x14(%ebp),%eax
+  800943:	8d 78 04             	lea    0x4(%eax),%edi
+  800946:	8b 10                	mov    (%eax),%edx
+  800948:	89 d0                	mov    %edx,%eax
+  80094a:	f7 d8                	neg    %eax
+  80094c:	0f 48 c2             	cmovs  %edx,%eax
+  80094f:	83 f8 08             	cmp    $0x8,%eax
+  800952:	7f 23                	jg     800977 <vprintfmt+0x15c>
+  800954:	8b 14 85 00 23 80 00 	mov    0x802300(,%eax,4),%edx
+  80095b:	85 d2                	test   %edx,%edx
+  80095d:	74 18                	je     800977 <vprintfmt+0x15c>
+  80095f:	52                   	push   %edx
+  800960:	68 04 21 80 00       	push   $0x802104
+  800965:	53                   	push   %ebx
+  800966:	56                   	push   %esi
+  800967:	e8 92 fe ff ff       	call   8007fe <printfmt>
+  80096c:	83 c4 10             	add    $0x10,%esp
+  80096f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800972:	e9 7a 02 00 00       	jmp    800bf1 <vprintfmt+0x3d6>
+  800977:	50                   	push   %eax
+  800978:	68 fb 20 80 00       	push   $0x8020fb
+  80097d:	53                   	push   %ebx
+  80097e:	56                   	push   %esi
+  80097f:	e8 7a fe ff ff       	call   8007fe <printfmt>
+  800984:	83 c4 10             	add    $0x10,%esp
+  800987:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80098a:	e9 62 02 00 00       	jmp    800bf1 <vprintfmt+0x3d6>
+  80098f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800992:	83 c0 04             	add    $0x4,%eax
+  800995:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800998:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099b:	8b 08                	mov    (%eax),%ecx
+  80099d:	85 c9                	test   %ecx,%ecx
+  80099f:	b8 f4 20 80 00       	mov    $0x8020f4,%eax
+  8009a4:	0f 45 c1             	cmovne %ecx,%eax
+  8009a7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8009aa:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8009ae:	7e 06                	jle    8009b6 <vprintfmt+0x19b>
+  8009b0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8009b4:	75 0b                	jne    8009c1 <vprintfmt+0x1a6>
+  8009b6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8009b9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8009bc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009bf:	eb 5c                	jmp    800a1d <vprintfmt+0x202>
+  8009c1:	83 ec 08             	sub    $0x8,%esp
+  8009c4:	ff 75 d0             	push   -0x30(%ebp)
+  8009c7:	ff 75 cc             	push   -0x34(%ebp)
+  8009ca:	e8 87 03 00 00       	call   800d56 <strnlen>
+  8009cf:	89 c2                	mov    %eax,%edx
+  8009d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009d4:	29 d0                	sub    %edx,%eax
+  8009d6:	83 c4 10             	add    $0x10,%esp
+  8009d9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8009dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009e0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009e3:	89 c6                	mov    %eax,%esi
+  8009e5:	eb 0e                	jmp    8009f5 <vprintfmt+0x1da>
+  8009e7:	83 ec 08             	sub    $0x8,%esp
+  8009ea:	53                   	push   %ebx
+  8009eb:	57                   	push   %edi
+  8009ec:	ff 55 08             	call   *0x8(%ebp)
+  8009ef:	83 ee 01             	sub    $0x1,%esi
+  8009f2:	83 c4 10             	add    $0x10,%esp
+  8009f5:	85 f6                	test   %esi,%esi
+  8009f7:	7f ee                	jg     8009e7 <vprintfmt+0x1cc>
+  8009f9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ff:	85 c0                	test   %eax,%eax
+  800a01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a06:	0f 49 d0             	cmovns %eax,%edx
+  800a09:	29 d0                	sub    %edx,%eax
+  800a0b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a0e:	eb a6                	jmp    8009b6 <vprintfmt+0x19b>
+  800a10:	83 ec 08             	sub    $0x8,%esp
+  800a13:	53                   	push   %ebx
+  800a14:	52                   	push   %edx
+  800a15:	ff 55 08             	call   *0x8(%ebp)
+  800a18:	83 c4 10             	add    $0x10,%esp
+  800a1b:	89 f1                	mov    %esi,%ecx
+  800a1d:	8d 71 01             	lea    0x1(%ecx),%esi
+  800a20:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800a24:	0f be d0             	movsbl %al,%edx
+  800a27:	85 d2                	test   %edx,%edx
+  800a29:	74 28                	je     800a53 <vprintfmt+0x238>
+  800a2b:	85 ff                	test   %edi,%edi
+  800a2d:	78 05                	js     800a34 <vprintfmt+0x219>
+  800a2f:	83 ef 01             	sub    $0x1,%edi
+  800a32:	78 30                	js     800a64 <vprintfmt+0x249>
+  800a34:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800a38:	74 d6                	je     800a10 <vprintfmt+0x1f5>
+  800a3a:	0f be c0             	movsbl %al,%eax
+  800a3d:	83 e8 20             	sub    $0x20,%eax
+  800a40:	83 f8 5e             	cmp    $0x5e,%eax
+  800a43:	76 cb                	jbe    800a10 <vprintfmt+0x1f5>
+  800a45:	83 ec 08             	sub    $0x8,%esp
+  800a48:	53                   	push   %ebx
+  800a49:	6a 3f                	push   $0x3f
+  800a4b:	ff 55 08             	call   *0x8(%ebp)
+  800a4e:	83 c4 10             	add    $0x10,%esp
+  800a51:	eb c8                	jmp    800a1b <vprintfmt+0x200>
+  800a53:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a56:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a59:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800a5c:	01 d0                	add    %edx,%eax
+  800a5e:	29 c8                	sub    %ecx,%eax
+  800a60:	89 c7                	mov    %eax,%edi
+  800a62:	eb 13                	jmp    800a77 <vprintfmt+0x25c>
+  800a64:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a67:	eb ed                	jmp    800a56 <vprintfmt+0x23b>
+  800a69:	83 ec 08             	sub    $0x8,%esp
+  800a6c:	53                   	push   %ebx
+  800a6d:	6a 20                	push   $0x20
+  800a6f:	ff d6                	call   *%esi
+  800a71:	83 ef 01             	sub    $0x1,%edi
+  800a74:	83 c4 10             	add    $0x10,%esp
+  800a77:	85 ff                	test   %edi,%edi
+  800a79:	7f ee                	jg     800a69 <vprintfmt+0x24e>
+  800a7b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800a7e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a81:	e9 6b 01 00 00       	jmp    800bf1 <vprintfmt+0x3d6>
+  800a86:	83 f9 01             	cmp    $0x1,%ecx
+  800a89:	7f 1f                	jg     800aaa <vprintfmt+0x28f>
+  800a8b:	85 c9                	test   %ecx,%ecx
+  800a8d:	74 67                	je     800af6 <vprintfmt+0x2db>
+  800a8f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a92:	8b 00                	mov    (%eax),%eax
+  800a94:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a97:	89 c1                	mov    %eax,%ecx
+  800a99:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a9c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a9f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa2:	8d 40 04             	lea    0x4(%eax),%eax
+  800aa5:	89 45 14             	mov    %eax,0x14(%ebp)
+  800aa8:	eb 17                	jmp    800ac1 <vprintfmt+0x2a6>
+  800aaa:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aad:	8b 50 04             	mov    0x4(%eax),%edx
+  800ab0:	8b 00                	mov    (%eax),%eax
+  800ab2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ab5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ab8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800abb:	8d 40 08             	lea    0x8(%eax),%eax
+  800abe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ac1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800ac4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ac7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800acc:	85 c9                	test   %ecx,%ecx
+  800ace:	0f 89 03 01 00 00    	jns    800bd7 <vprintfmt+0x3bc>
+  800ad4:	83 ec 08             	sub    $0x8,%esp
+  800ad7:	53                   	push   %ebx
+  800ad8:	6a 2d                	push   $0x2d
+  800ada:	ff d6                	call   *%esi
+  800adc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800adf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ae2:	f7 da                	neg    %edx
+  800ae4:	83 d1 00             	adc    $0x0,%ecx
+  800ae7:	f7 d9                	neg    %ecx
+  800ae9:	83 c4 10             	add    $0x10,%esp
+  800aec:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800af1:	e9 e1 00 00 00       	jmp    800bd7 <vprintfmt+0x3bc>
+  800af6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af9:	8b 00                	mov    (%eax),%eax
+  800afb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800afe:	89 c1                	mov    %eax,%ecx
+  800b00:	c1 f9 1f             	sar    $0x1f,%ecx
+  800b03:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b06:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b09:	8d 40 04             	lea    0x4(%eax),%eax
+  800b0c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b0f:	eb b0                	jmp    800ac1 <vprintfmt+0x2a6>
+  800b11:	83 f9 01             	cmp    $0x1,%ecx
+  800b14:	7f 1e                	jg     800b34 <vprintfmt+0x319>
+  800b16:	85 c9                	test   %ecx,%ecx
+  800b18:	74 32                	je     800b4c <vprintfmt+0x331>
+  800b1a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b1d:	8b 10                	mov    (%eax),%edx
+  800b1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b24:	8d 40 04             	lea    0x4(%eax),%eax
+  800b27:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b2a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800b2f:	e9 a3 00 00 00       	jmp    800bd7 <vprintfmt+0x3bc>
+  800b34:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b37:	8b 10                	mov    (%eax),%edx
+  800b39:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b3c:	8d 40 08             	lea    0x8(%eax),%eax
+  800b3f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b42:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800b47:	e9 8b 00 00 00       	jmp    800bd7 <vprintfmt+0x3bc>
+  800b4c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b4f:	8b 10                	mov    (%eax),%edx
+  800b51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b56:	8d 40 04             	lea    0x4(%eax),%eax
+  800b59:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b5c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800b61:	eb 74                	jmp    800bd7 <vprintfmt+0x3bc>
+  800b63:	83 f9 01             	cmp    $0x1,%ecx
+  800b66:	7f 1b                	jg     800b83 <vprintfmt+0x368>
+  800b68:	85 c9                	test   %ecx,%ecx
+  800b6a:	74 2c                	je     800b98 <vprintfmt+0x37d>
+  800b6c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b6f:	8b 10                	mov    (%eax),%edx
+  800b71:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b76:	8d 40 04             	lea    0x4(%eax),%eax
+  800b79:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b7c:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b81:	eb 54                	jmp    800bd7 <vprintfmt+0x3bc>
+  800b83:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b86:	8b 10                	mov    (%eax),%edx
+  800b88:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b8b:	8d 40 08             	lea    0x8(%eax),%eax
+  800b8e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b91:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b96:	eb 3f                	jmp    800bd7 <vprintfmt+0x3bc>
+  800b98:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b9b:	8b 10                	mov    (%eax),%edx
+  800b9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba2:	8d 40 04             	lea    0x4(%eax),%eax
+  800ba5:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ba8:	bf 08 00 00 00       	mov    $0x8,%edi
+  800bad:	eb 28                	jmp    800bd7 <vprintfmt+0x3bc>
+  800baf:	83 ec 08             	sub    $0x8,%esp
+  800bb2:	53                   	push   %ebx
+  800bb3:	6a 30                	push   $0x30
+  800bb5:	ff d6                	call   *%esi
+  800bb7:	83 c4 08             	add    $0x8,%esp
+  800bba:	53                   	push   %ebx
+  800bbb:	6a 78                	push   $0x78
+  800bbd:	ff d6                	call   *%esi
+  800bbf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc2:	8b 10                	mov    (%eax),%edx
+  800bc4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc9:	83 c4 10             	add    $0x10,%esp
+  800bcc:	8d 40 04             	lea    0x4(%eax),%eax
+  800bcf:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bd2:	bf 10 00 00 00       	mov    $0x10,%edi
+  800bd7:	83 ec 0c             	sub    $0xc,%esp
+  800bda:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800bde:	50                   	push   %eax
+  800bdf:	ff 75 e0             	push   -0x20(%ebp)
+  800be2:	57                   	push   %edi
+  800be3:	51                   	push   %ecx
+  800be4:	52                   	push   %edx
+  800be5:	89 da                	mov    %ebx,%edx
+  800be7:	89 f0                	mov    %esi,%eax
+  800be9:	e8 4a fb ff ff       	call   800738 <printnum>
+  800bee:	83 c4 20             	add    $0x20,%esp
+  800bf1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800bf4:	e9 40 fc ff ff       	jmp    800839 <vprintfmt+0x1e>
+  800bf9:	83 f9 01             	cmp    $0x1,%ecx
+  800bfc:	7f 1b                	jg     800c19 <vprintfmt+0x3fe>
+  800bfe:	85 c9                	test   %ecx,%ecx
+  800c00:	74 2c                	je     800c2e <vprintfmt+0x413>
+  800c02:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c05:	8b 10                	mov    (%eax),%edx
+  800c07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c0c:	8d 40 04             	lea    0x4(%eax),%eax
+  800c0f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c12:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c17:	eb be                	jmp    800bd7 <vprintfmt+0x3bc>
+  800c19:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c1c:	8b 10                	mov    (%eax),%edx
+  800c1e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c21:	8d 40 08             	lea    0x8(%eax),%eax
+  800c24:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c27:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c2c:	eb a9                	jmp    800bd7 <vprintfmt+0x3bc>
+  800c2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c31:	8b 10                	mov    (%eax),%edx
+  800c33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c38:	8d 40 04             	lea    0x4(%eax),%eax
+  800c3b:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c3e:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c43:	eb 92                	jmp    800bd7 <vprintfmt+0x3bc>
+  800c45:	83 ec 08             	sub    $0x8,%esp
+  800c48:	53                   	push   %ebx
+  800c49:	6a 25                	push   $0x25
+  800c4b:	ff d6                	call   *%esi
+  800c4d:	83 c4 10             	add    $0x10,%esp
+  800c50:	eb 9f                	jmp    800bf1 <vprintfmt+0x3d6>
+  800c52:	83 ec 08             	sub    $0x8,%esp
+  800c55:	53                   	push   %ebx
+  800c56:	6a 25                	push   $0x25
+  800c58:	ff d6                	call   *%esi
+  800c5a:	83 c4 10             	add    $0x10,%esp
+  800c5d:	89 f8                	mov    %edi,%eax
+  800c5f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c63:	74 05                	je     800c6a <vprintfmt+0x44f>
+  800c65:	83 e8 01             	sub    $0x1,%eax
+  800c68:	eb f5                	jmp    800c5f <vprintfmt+0x444>
+  800c6a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800c6d:	eb 82                	jmp    800bf1 <vprintfmt+0x3d6>
+
+00800c6f <vsnprintf>:
+  800c6f:	55                   	push   %ebp
+  800c70:	89 e5                	mov    %esp,%ebp
+  800c72:	83 ec 18             	sub    $0x18,%esp
+  800c75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c78:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c7b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c7e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c82:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c85:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800c8c:	85 c0                	test   %eax,%eax
+  800c8e:	74 26                	je     800cb6 <vsnprintf+0x47>
+  800c90:	85 d2                	test   %edx,%edx
+  800c92:	7e 22                	jle    800cb6 <vsnprintf+0x47>
+  800c94:	ff 75 14             	push   0x14(%ebp)
+  800c97:	ff 75 10             	push   0x10(%ebp)
+  800c9a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c9d:	50                   	push   %eax
+  800c9e:	68 e1 07 80 00       	push   $0x8007e1
+  800ca3:	e8 73 fb ff ff       	call   80081b <vprintfmt>
+  800ca8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800cab:	c6 00 00             	movb   $0x0,(%eax)
+  800cae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cb1:	83 c4 10             	add    $0x10,%esp
+  800cb4:	c9                   	leave
+  800cb5:	c3                   	ret
+  800cb6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cbb:	eb f7                	jmp    800cb4 <vsnprintf+0x45>
+
+00800cbd <snprintf>:
+  800cbd:	55                   	push   %ebp
+  800cbe:	89 e5                	mov    %esp,%ebp
+  800cc0:	83 ec 08             	sub    $0x8,%esp
+  800cc3:	8d 45 14             	lea    0x14(%ebp),%eax
+  800cc6:	50                   	push   %eax
+  800cc7:	ff 75 10             	push   0x10(%ebp)
+  800cca:	ff 75 0c             	push   0xc(%ebp)
+  800ccd:	ff 75 08             	push   0x8(%ebp)
+  800cd0:	e8 9a ff ff ff       	call   800c6f <vsnprintf>
+  800cd5:	c9                   	leave
+  800cd6:	c3                   	ret
+
+00800cd7 <copy_fwd>:
+  800cd7:	55                   	push   %ebp
+  800cd8:	89 e5                	mov    %esp,%ebp
+  800cda:	57                   	push   %edi
+  800cdb:	56                   	push   %esi
+  800cdc:	53                   	push   %ebx
+  800cdd:	89 c7                	mov    %eax,%edi
+  800cdf:	89 d6                	mov    %edx,%esi
+  800ce1:	89 c8                	mov    %ecx,%eax
+  800ce3:	83 f9 0f             	cmp    $0xf,%ecx
+  800ce6:	76 1c                	jbe    800d04 <copy_fwd+0x2d>
+  800ce8:	89 f9                	mov    %edi,%ecx
+  800cea:	f7 d9                	neg    %ecx
+  800cec:	89 cb                	mov    %ecx,%ebx
+  800cee:	83 e3 03             	and    $0x3,%ebx
+  800cf1:	29 d8                	sub    %ebx,%eax
+  800cf3:	89 c2                	mov    %eax,%edx
+  800cf5:	c1 ea 02             	shr    $0x2,%edx
+  800cf8:	83 e0 03             	and    $0x3,%eax
+  800cfb:	89 d9                	mov    %ebx,%ecx
+  800cfd:	fc                   	cld
+  800cfe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800d00:	89 d1                	mov    %edx,%ecx
+  800d02:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d04:	89 c1                	mov    %eax,%ecx
+  800d06:	fc                   	cld
+  800d07:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800d09:	5b                   	pop    %ebx
+  800d0a:	5e                   	pop    %esi
+  800d0b:	5f                   	pop    %edi
+  800d0c:	5d                   	pop    %ebp
+  800d0d:	c3                   	ret
+
+00800d0e <have_sse2>:
+  800d0e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d15:	78 06                	js     800d1d <have_sse2+0xf>
+  800d17:	a1 04 30 80 00       	mov    0x803004,%eax
+  800d1c:	c3                   	ret
+  800d1d:	55                   	push   %ebp
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	53                   	push   %ebx
+  800d21:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d26:	0f a2                	cpuid
+  800d28:	c1 ea 1a             	shr    $0x1a,%edx
+  800d2b:	83 e2 01             	and    $0x1,%edx
+  800d2e:	89 15 04 30 80 00    	mov    %edx,0x803004
+  800d34:	a1 04 30 80 00       	mov    0x803004,%eax
+  800d39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d3c:	c9                   	leave
+  800d3d:	c3                   	ret
+
+00800d3e <strlen>:
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d44:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d49:	eb 03                	jmp    800d4e <strlen+0x10>
+  800d4b:	83 c0 01             	add    $0x1,%eax
+  800d4e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800d52:	75 f7                	jne    800d4b <strlen+0xd>
+  800d54:	5d                   	pop    %ebp
+  800d55:	c3                   	ret
+
+00800d56 <strnlen>:
+  800d56:	55                   	push   %ebp
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d64:	eb 03                	jmp    800d69 <strnlen+0x13>
+  800d66:	83 c0 01             	add    $0x1,%eax
+  800d69:	39 d0                	cmp    %edx,%eax
+  800d6b:	74 08                	je     800d75 <strnlen+0x1f>
+  800d6d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800d71:	75 f3                	jne    800d66 <strnlen+0x10>
+  800d73:	89 c2                	mov    %eax,%edx
+  800d75:	89 d0                	mov    %edx,%eax
+  800d77:	5d                   	pop    %ebp
+  800d78:	c3                   	ret
+
+00800d79 <strcpy>:
+  800d79:	55                   	push   %ebp
+  800d7a:	89 e5                	mov    %esp,%ebp
+  800d7c:	53                   	push   %ebx
+  800d7d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d80:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d88:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d8c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d8f:	83 c0 01             	add    $0x1,%eax
+  800d92:	84 d2                	test   %dl,%dl
+  800d94:	75 f2                	jne    800d88 <strcpy+0xf>
+  800d96:	89 c8                	mov    %ecx,%eax
+  800d98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d9b:	c9                   	leave
+  800d9c:	c3                   	ret
+
+00800d9d <strcat>:
+  800d9d:	55                   	push   %ebp
+  800d9e:	89 e5                	mov    %esp,%ebp
+  800da0:	53                   	push   %ebx
+  800da1:	83 ec 10             	sub    $0x10,%esp
+  800da4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800da7:	53                   	push   %ebx
+  800da8:	e8 91 ff ff ff       	call   800d3e <strlen>
+  800dad:	83 c4 08             	add    $0x8,%esp
+  800db0:	ff 75 0c             	push   0xc(%ebp)
+  800db3:	01 d8                	add    %ebx,%eax
+  800db5:	50                   	push   %eax
+  800db6:	e8 be ff ff ff       	call   800d79 <strcpy>
+  800dbb:	89 d8                	mov    %ebx,%eax
+  800dbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dc0:	c9                   	leave
+  800dc1:	c3                   	ret
+
+00800dc2 <strncpy>:
+  800dc2:	55                   	push   %ebp
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	56                   	push   %esi
+  800dc6:	53                   	push   %ebx
+  800dc7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800dcd:	89 f3                	mov    %esi,%ebx
+  800dcf:	03 5d 10             	add    0x10(%ebp),%ebx
+  800dd2:	89 f0                	mov    %esi,%eax
+  800dd4:	eb 0f                	jmp    800de5 <strncpy+0x23>
+  800dd6:	83 c0 01             	add    $0x1,%eax
+  800dd9:	0f b6 0a             	movzbl (%edx),%ecx
+  800ddc:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800ddf:	80 f9 01             	cmp    $0x1,%cl
+  800de2:	83 da ff             	sbb    $0xffffffff,%edx
+  800de5:	39 d8                	cmp    %ebx,%eax
+  800de7:	75 ed                	jne    800dd6 <strncpy+0x14>
+  800de9:	89 f0                	mov    %esi,%eax
+  800deb:	5b                   	pop    %ebx
+  800dec:	5e                   	pop    %esi
+  800ded:	5d                   	pop    %ebp
+  800dee:	c3                   	ret
+
+00800def <strlcpy>:
+  800def:	55                   	push   %ebp
+  800df0:	89 e5                	mov    %esp,%ebp
+  800df2:	56                   	push   %esi
+  800df3:	53                   	push   %ebx
+  800df4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800df7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfa:	8b 55 10             	mov    0x10(%ebp),%edx
+  800dfd:	89 f0                	mov    %esi,%eax
+  800dff:	85 d2                	test   %edx,%edx
+  800e01:	74 21                	je     800e24 <strlcpy+0x35>
+  800e03:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800e07:	89 f2                	mov    %esi,%edx
+  800e09:	eb 09                	jmp    800e14 <strlcpy+0x25>
+  800e0b:	83 c1 01             	add    $0x1,%ecx
+  800e0e:	83 c2 01             	add    $0x1,%edx
+  800e11:	88 5a ff             	mov    %bl,-0x1(%edx)
+  800e14:	39 c2                	cmp    %eax,%edx
+  800e16:	74 09                	je     800e21 <strlcpy+0x32>
+  800e18:	0f b6 19             	movzbl (%ecx),%ebx
+  800e1b:	84 db                	test   %bl,%bl
+  800e1d:	75 ec                	jne    800e0b <strlcpy+0x1c>
+  800e1f:	89 d0                	mov    %edx,%eax
+  800e21:	c6 00 00             	movb   $0x0,(%eax)
+  800e24:	29 f0                	sub    %esi,%eax
+  800e26:	5b                   	pop    %ebx
+  800e27:	5e                   	pop    %esi
+  800e28:	5d                   	pop    %ebp
+  800e29:	c3                   	ret
+
+00800e2a <strcmp>:
+  800e2a:	55                   	push   %ebp
+  800e2b:	89 e5                	mov    %esp,%ebp
+  800e2d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e30:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e33:	eb 06                	jmp    800e3b <strcmp+0x11>
+  800e35:	83 c1 01             	add    $0x1,%ecx
+  800e38:	83 c2 01             	add    $0x1,%edx
+  800e3b:	0f b6 01             	movzbl (%ecx),%eax
+  800e3e:	84 c0                	test   %al,%al
+  800e40:	74 04                	je     800e46 <strcmp+0x1c>
+  800e42:	3a 02                	cmp    (%edx),%al
+  800e44:	74 ef                	je     800e35 <strcmp+0xb>
+  800e46:	0f b6 c0             	movzbl %al,%eax
+  800e49:	0f b6 12             	movzbl (%edx),%edx
+  800e4c:	29 d0                	sub    %edx,%eax
+  800e4e:	5d                   	pop    %ebp
+  800e4f:	c3                   	ret
+
+00800e50 <strncmp>:
+  800e50:	55                   	push   %ebp
+  800e51:	89 e5                	mov    %esp,%ebp
+  800e53:	53                   	push   %ebx
+  800e54:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5a:	8b 55 10             	mov    0x10(%ebp),%edx
+  800e5d:	eb 09                	jmp    800e68 <strncmp+0x18>
+  800e5f:	83 ea 01             	sub    $0x1,%edx
+  800e62:	83 c0 01             	add    $0x1,%eax
+  800e65:	83 c1 01             	add    $0x1,%ecx
+  800e68:	85 d2                	test   %edx,%edx
+  800e6a:	74 18                	je     800e84 <strncmp+0x34>
+  800e6c:	0f b6 18             	movzbl (%eax),%ebx
+  800e6f:	84 db                	test   %bl,%bl
+  800e71:	74 04                	je     800e77 <strncmp+0x27>
+  800e73:	3a 19                	cmp    (%ecx),%bl
+  800e75:	74 e8                	je     800e5f <strncmp+0xf>
+  800e77:	0f b6 00             	movzbl (%eax),%eax
+  800e7a:	0f b6 11             	movzbl (%ecx),%edx
+  800e7d:	29 d0                	sub    %edx,%eax
+  800e7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e82:	c9                   	leave
+  800e83:	c3                   	ret
+  800e84:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e89:	eb f4                	jmp    800e7f <strncmp+0x2f>
+
+00800e8b <strchr>:
+  800e8b:	55                   	push   %ebp
+  800e8c:	89 e5                	mov    %esp,%ebp
+  800e8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e91:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800e95:	eb 03                	jmp    800e9a <strchr+0xf>
+  800e97:	83 c0 01             	add    $0x1,%eax
+  800e9a:	0f b6 10             	movzbl (%eax),%edx
+  800e9d:	84 d2                	test   %dl,%dl
+  800e9f:	74 06                	je     800ea7 <strchr+0x1c>
+  800ea1:	38 ca                	cmp    %cl,%dl
+  800ea3:	75 f2                	jne    800e97 <strchr+0xc>
+  800ea5:	eb 05                	jmp    800eac <strchr+0x21>
+  800ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eac:	5d                   	pop    %ebp
+  800ead:	c3                   	ret
+
+00800eae <strfind>:
+  800eae:	55                   	push   %ebp
+  800eaf:	89 e5                	mov    %esp,%ebp
+  800eb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eb4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800eb8:	0f b6 10             	movzbl (%eax),%edx
+  800ebb:	38 ca                	cmp    %cl,%dl
+  800ebd:	74 09                	je     800ec8 <strfind+0x1a>
+  800ebf:	84 d2                	test   %dl,%dl
+  800ec1:	74 05                	je     800ec8 <strfind+0x1a>
+  800ec3:	83 c0 01             	add    $0x1,%eax
+  800ec6:	eb f0                	jmp    800eb8 <strfind+0xa>
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+
+00800eca <memset>:
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	57                   	push   %edi
+  800ece:	56                   	push   %esi
+  800ecf:	53                   	push   %ebx
+  800ed0:	83 ec 04             	sub    $0x4,%esp
+  800ed3:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ed6:	8b 55 10             	mov    0x10(%ebp),%edx
+  800ed9:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  800edd:	89 f7                	mov    %esi,%edi
+  800edf:	83 fa 0f             	cmp    $0xf,%edx
+  800ee2:	76 24                	jbe    800f08 <memset+0x3e>
+  800ee4:	89 f1                	mov    %esi,%ecx
+  800ee6:	f7 d9                	neg    %ecx
+  800ee8:	83 e1 03             	and    $0x3,%ecx
+  800eeb:	29 ca                	sub    %ecx,%edx
+  800eed:	89 d0                	mov    %edx,%eax
+  800eef:	c1 e8 02             	shr    $0x2,%eax
+  800ef2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  800ef5:	83 e2 03             	and    $0x3,%edx
+  800ef8:	89 d8                	mov    %ebx,%eax
+  800efa:	fc                   	cld
+  800efb:	f3 aa                	rep stos %al,%es:(%edi)
+  800efd:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  800f03:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  800f06:	f3 ab                	rep stos %eax,%es:(%edi)
+  800f08:	89 d1                	mov    %edx,%ecx
+  800f0a:	89 d8                	mov    %ebx,%eax
+  800f0c:	fc                   	cld
+  800f0d:	f3 aa                	rep stos %al,%es:(%edi)
+  800f0f:	89 f0                	mov    %esi,%eax
+  800f11:	83 c4 04             	add    $0x4,%esp
+  800f14:	5b                   	pop    %ebx
+  800f15:	5e                   	pop    %esi
+  800f16:	5f                   	pop    %edi
+  800f17:	5d                   	pop    %ebp
+  800f18:	c3                   	ret
+
+00800f19 <memmove>:
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	57                   	push   %edi
+  800f1d:	56                   	push   %esi
+  800f1e:	53                   	push   %ebx
+  800f1f:	83 ec 0c             	sub    $0xc,%esp
+  800f22:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800f25:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f28:	8b 45 10             	mov    0x10(%ebp),%eax
+  800f2b:	85 c0                	test   %eax,%eax
+  800f2d:	74 14                	je     800f43 <memmove+0x2a>
+  800f2f:	39 da                	cmp    %ebx,%edx
+  800f31:	73 07                	jae    800f3a <memmove+0x21>
+  800f33:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  800f36:	39 cb                	cmp    %ecx,%ebx
+  800f38:	72 13                	jb     800f4d <memmove+0x34>
+  800f3a:	89 c1                	mov    %eax,%ecx
+  800f3c:	89 d8                	mov    %ebx,%eax
+  800f3e:	e8 94 fd ff ff       	call   800cd7 <copy_fwd>
+  800f43:	89 d8                	mov    %ebx,%eax
+  800f45:	83 c4 0c             	add    $0xc,%esp
+  800f48:	5b                   	pop    %ebx
+  800f49:	5e                   	pop    %esi
+  800f4a:	5f                   	pop    %edi
+  800f4b:	5d                   	pop    %ebp
+  800f4c:	c3                   	ret
+  800f4d:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800f50:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800f53:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800f56:	83 f8 0f             	cmp    $0xf,%eax
+  800f59:	76 23                	jbe    800f7e <memmove+0x65>
+  800f5b:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800f5e:	83 e1 03             	and    $0x3,%ecx
+  800f61:	29 c8                	sub    %ecx,%eax
+  800f63:	89 c2                	mov    %eax,%edx
+  800f65:	c1 ea 02             	shr    $0x2,%edx
+  800f68:	83 e0 03             	and    $0x3,%eax
+  800f6b:	fd                   	std
+  800f6c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800f6e:	83 ef 03             	sub    $0x3,%edi
+  800f71:	83 ee 03             	sub    $0x3,%esi
+  800f74:	89 d1                	mov    %edx,%ecx
+  800f76:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f78:	83 c7 03             	add    $0x3,%edi
+  800f7b:	83 c6 03             	add    $0x3,%esi
+  800f7e:	89 c1                	mov    %eax,%ecx
+  800f80:	fd                   	std
+  800f81:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800f83:	fc                   	cld
+  800f84:	eb bd                	jmp    800f43 <memmove+0x2a>
+
+00800f86 <memcpy>:
+  800f86:	55                   	push   %ebp
+  800f87:	89 e5                	mov    %esp,%ebp
+  800f89:	53                   	push   %ebx
+  800f8a:	83 ec 04             	sub    $0x4,%esp
+  800f8d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800f90:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800f93:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f96:	89 d8                	mov    %ebx,%eax
+  800f98:	e8 3a fd ff ff       	call   800cd7 <copy_fwd>
+  800f9d:	89 d8                	mov    %ebx,%eax
+  800f9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fa2:	c9                   	leave
+  800fa3:	c3                   	ret
+
+00800fa4 <page_copy>:
+  800fa4:	55                   	push   %ebp
+  800fa5:	89 e5                	mov    %esp,%ebp
+  800fa7:	57                   	push   %edi
+  800fa8:	56                   	push   %esi
+  800fa9:	53                   	push   %ebx
+  800faa:	83 ec 0c             	sub    $0xc,%esp
+  800fad:	e8 5c fd ff ff       	call   800d0e <have_sse2>
+  800fb2:	85 c0                	test   %eax,%eax
+  800fb4:	74 39                	je     800fef <page_copy+0x4b>
+  800fb6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800fb9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800fbc:	be 00 01 00 00       	mov    $0x100,%esi
+  800fc1:	8b 03                	mov    (%ebx),%eax
+  800fc3:	8b 53 04             	mov    0x4(%ebx),%edx
+  800fc6:	0f c3 01             	movnti %eax,(%ecx)
+  800fc9:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800fcd:	8b 43 08             	mov    0x8(%ebx),%eax
+  800fd0:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800fd3:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800fd7:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800fdb:	83 c3 10             	add    $0x10,%ebx
+  800fde:	83 c1 10             	add    $0x10,%ecx
+  800fe1:	4e                   	dec    %esi
+  800fe2:	75 dd                	jne    800fc1 <page_copy+0x1d>
+  800fe4:	0f ae f8             	sfence
+  800fe7:	83 c4 0c             	add    $0xc,%esp
+  800fea:	5b                   	pop    %ebx
+  800feb:	5e                   	pop    %esi
+  800fec:	5f                   	pop    %edi
+  800fed:	5d                   	pop    %ebp
+  800fee:	c3                   	ret
+  800fef:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ff2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ff5:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800ffa:	fc                   	cld
+  800ffb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ffd:	eb e8                	jmp    800fe7 <page_copy+0x43>
+
+00800fff <page_zero>:
+  800fff:	55                   	push   %ebp
+  801000:	89 e5                	mov    %esp,%ebp
+  801002:	57                   	push   %edi
+  801003:	83 ec 04             	sub    $0x4,%esp
+  801006:	e8 03 fd ff ff       	call   800d0e <have_sse2>
+  80100b:	85 c0                	test   %eax,%eax
+  80100d:	74 3a                	je     801049 <page_zero+0x4a>
+  80100f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801012:	ba 80 00 00 00       	mov    $0x80,%edx
+  801017:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80101c:	0f c3 08             	movnti %ecx,(%eax)
+  80101f:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  801023:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  801027:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  80102b:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  80102f:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  801033:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  801037:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  80103b:	83 c0 20             	add    $0x20,%eax
+  80103e:	4a                   	dec    %edx
+  80103f:	75 db                	jne    80101c <page_zero+0x1d>
+  801041:	0f ae f8             	sfence
+  801044:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801047:	c9                   	leave
+  801048:	c3                   	ret
+  801049:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80104c:	b9 00 04 00 00       	mov    $0x400,%ecx
+  801051:	fc                   	cld
+  801052:	f3 ab                	rep stos %eax,%es:(%edi)
+  801054:	eb ee                	jmp    801044 <page_zero+0x45>
+
+00801056 <memcmp>:
+  801056:	55                   	push   %ebp
+  801057:	89 e5                	mov    %esp,%ebp
+  801059:	56                   	push   %esi
+  80105a:	53                   	push   %ebx
+  80105b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80105e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801061:	89 c6                	mov    %eax,%esi
+  801063:	03 75 10             	add    0x10(%ebp),%esi
+  801066:	eb 06                	jmp    80106e <memcmp+0x18>
+  801068:	83 c0 01             	add    $0x1,%eax
+  80106b:	83 c2 01             	add    $0x1,%edx
+  80106e:	39 f0                	cmp    %esi,%eax
+  801070:	74 14                	je     801086 <memcmp+0x30>
+  801072:	0f b6 08             	movzbl (%eax),%ecx
+  801075:	0f b6 1a             	movzbl (%edx),%ebx
+  801078:	38 d9                	cmp    %bl,%cl
+  80107a:	74 ec                	je     801068 <memcmp+0x12>
+  80107c:	0f b6 c1             	movzbl %cl,%eax
+  80107f:	0f b6 db             	movzbl %bl,%ebx
+  801082:	29 d8                	sub    %ebx,%eax
+  801084:	eb 05                	jmp    80108b <memcmp+0x35>
+  801086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108b:	5b                   	pop    %ebx
+  80108c:	5e                   	pop    %esi
+  80108d:	5d                   	pop    %ebp
+  80108e:	c3                   	ret
+
+0080108f <memfind>:
+  80108f:	55                   	push   %ebp
+  801090:	89 e5                	mov    %esp,%ebp
+  801092:	8b 45 08             	mov    0x8(%ebp),%eax
+  801095:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801098:	89 c2                	mov    %eax,%edx
+  80109a:	03 55 10             	add    0x10(%ebp),%edx
+  80109d:	eb 03                	jmp    8010a2 <memfind+0x13>
+  80109f:	83 c0 01             	add    $0x1,%eax
+  8010a2:	39 d0                	cmp    %edx,%eax
+  8010a4:	73 04                	jae    8010aa <memfind+0x1b>
+  8010a6:	38 08                	cmp    %cl,(%eax)
+  8010a8:	75 f5                	jne    80109f <memfind+0x10>
+  8010aa:	5d                   	pop    %ebp
+  8010ab:	c3                   	ret
+
+008010ac <strtol>:
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	57                   	push   %edi
+  8010b0:	56                   	push   %esi
+  8010b1:	53                   	push   %ebx
+  8010b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b8:	eb 03                	jmp    8010bd <strtol+0x11>
+  8010ba:	83 c2 01             	add    $0x1,%edx
+  8010bd:	0f b6 02             	movzbl (%edx),%eax
+  8010c0:	3c 20                	cmp    $0x20,%al
+  8010c2:	74 f6                	je     8010ba <strtol+0xe>
+  8010c4:	3c 09                	cmp    $0x9,%al
+  8010c6:	74 f2                	je     8010ba <strtol+0xe>
+  8010c8:	3c 2b                	cmp    $0x2b,%al
+  8010ca:	74 2a                	je     8010f6 <strtol+0x4a>
+  8010cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010d1:	3c 2d                	cmp    $0x2d,%al
+  8010d3:	74 2b                	je     801100 <strtol+0x54>
+  8010d5:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8010db:	75 0f                	jne    8010ec <strtol+0x40>
+  8010dd:	80 3a 30             	cmpb   $0x30,(%edx)
+  8010e0:	74 28                	je     80110a <strtol+0x5e>
+  8010e2:	85 db                	test   %ebx,%ebx
+  8010e4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010e9:	0f 44 d8             	cmove  %eax,%ebx
+  8010ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f1:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8010f4:	eb 46                	jmp    80113c <strtol+0x90>
+  8010f6:	83 c2 01             	add    $0x1,%edx
+  8010f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010fe:	eb d5                	jmp    8010d5 <strtol+0x29>
+  801100:	83 c2 01             	add    $0x1,%edx
+  801103:	bf 01 00 00 00       	mov    $0x1,%edi
+  801108:	eb cb                	jmp    8010d5 <strtol+0x29>
+  80110a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80110e:	74 0e                	je     80111e <strtol+0x72>
+  801110:	85 db                	test   %ebx,%ebx
+  801112:	75 d8                	jne    8010ec <strtol+0x40>
+  801114:	83 c2 01             	add    $0x1,%edx
+  801117:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80111c:	eb ce                	jmp    8010ec <strtol+0x40>
+  80111e:	83 c2 02             	add    $0x2,%edx
+  801121:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801126:	eb c4                	jmp    8010ec <strtol+0x40>
+  801128:	0f be c0             	movsbl %al,%eax
+  80112b:	83 e8 30             	sub    $0x30,%eax
+  80112e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801131:	7d 3a                	jge    80116d <strtol+0xc1>
+  801133:	83 c2 01             	add    $0x1,%edx
+  801136:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80113a:	01 c1                	add    %eax,%ecx
+  80113c:	0f b6 02             	movzbl (%edx),%eax
+  80113f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801142:	89 f3                	mov    %esi,%ebx
+  801144:	80 fb 09             	cmp    $0x9,%bl
+  801147:	76 df                	jbe    801128 <strtol+0x7c>
+  801149:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80114c:	89 f3                	mov    %esi,%ebx
+  80114e:	80 fb 19             	cmp    $0x19,%bl
+  801151:	77 08                	ja     80115b <strtol+0xaf>
+  801153:	0f be c0             	movsbl %al,%eax
+  801156:	83 e8 57             	sub    $0x57,%eax
+  801159:	eb d3                	jmp    80112e <strtol+0x82>
+  80115b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80115e:	89 f3                	mov    %esi,%ebx
+  801160:	80 fb 19             	cmp    $0x19,%bl
+  801163:	77 08                	ja     80116d <strtol+0xc1>
+  801165:	0f be c0             	movsbl %al,%eax
+  801168:	83 e8 37             	sub    $0x37,%eax
+  80116b:	eb c1                	jmp    80112e <strtol+0x82>
+  80116d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801171:	74 05                	je     801178 <strtol+0xcc>
+  801173:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801176:	89 10                	mov    %edx,(%eax)
+  801178:	89 c8                	mov    %ecx,%eax
+  80117a:	f7 d8                	neg    %eax
+  80117c:	85 ff                	test   %edi,%edi
+  80117e:	0f 45 c8             	cmovne %eax,%ecx
+  801181:	89 c8                	mov    %ecx,%eax
+  801183:	5b                   	pop    %ebx
+  801184:	5e                   	pop    %esi
+  801185:	5f                   	pop    %edi
+  801186:	5d                   	pop    %ebp
+  801187:	c3                   	ret
+
+00801188 <sys_cputs>:
+  801188:	55                   	push   %ebp
+  801189:	89 e5                	mov    %esp,%ebp
+  80118b:	57                   	push   %edi
+  80118c:	56                   	push   %esi
+  80118d:	53                   	push   %ebx
+  80118e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801195:	78 21                	js     8011b8 <sys_cputs+0x30>
+  801197:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80119e:	75 2d                	jne    8011cd <sys_cputs+0x45>
+  8011a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ab:	89 c3                	mov    %eax,%ebx
+  8011ad:	89 c7                	mov    %eax,%edi
+  8011af:	89 c6                	mov    %eax,%esi
+  8011b1:	cd 30                	int    $0x30
+  8011b3:	5b                   	pop    %ebx
+  8011b4:	5e                   	pop    %esi
+  8011b5:	5f                   	pop    %edi
+  8011b6:	5d                   	pop    %ebp
+  8011b7:	c3                   	ret
+  8011b8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011bd:	0f a2                	cpuid
+  8011bf:	c1 ea 0b             	shr    $0xb,%edx
+  8011c2:	83 e2 01             	and    $0x1,%edx
+  8011c5:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8011cb:	eb ca                	jmp    801197 <sys_cputs+0xf>
+  8011cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d8:	89 c3                	mov    %eax,%ebx
+  8011da:	89 c7                	mov    %eax,%edi
+  8011dc:	89 c6                	mov    %eax,%esi
+  8011de:	55                   	push   %ebp
+  8011df:	68 e8 11 80 00       	push   $0x8011e8
+  8011e4:	89 e5                	mov    %esp,%ebp
+  8011e6:	0f 34                	sysenter
+  8011e8:	83 c4 04             	add    $0x4,%esp
+  8011eb:	5d                   	pop    %ebp
+  8011ec:	eb c5                	jmp    8011b3 <sys_cputs+0x2b>
+
+008011ee <sys_cgetc>:
+  8011ee:	55                   	push   %ebp
+  8011ef:	89 e5                	mov    %esp,%ebp
+  8011f1:	57                   	push   %edi
+  8011f2:	56                   	push   %esi
+  8011f3:	53                   	push   %ebx
+  8011f4:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8011fb:	78 22                	js     80121f <sys_cgetc+0x31>
+  8011fd:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801204:	75 2e                	jne    801234 <sys_cgetc+0x46>
+  801206:	ba 00 00 00 00       	mov    $0x0,%edx
+  80120b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801210:	89 d1                	mov    %edx,%ecx
+  801212:	89 d3                	mov    %edx,%ebx
+  801214:	89 d7                	mov    %edx,%edi
+  801216:	89 d6                	mov    %edx,%esi
+  801218:	cd 30                	int    $0x30
+  80121a:	5b                   	pop    %ebx
+  80121b:	5e                   	pop    %esi
+  80121c:	5f                   	pop    %edi
+  80121d:	5d                   	pop    %ebp
+  80121e:	c3                   	ret
+  80121f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801224:	0f a2                	cpuid
+  801226:	c1 ea 0b             	shr    $0xb,%edx
+  801229:	83 e2 01             	and    $0x1,%edx
+  80122c:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801232:	eb c9                	jmp    8011fd <sys_cgetc+0xf>
+  801234:	ba 00 00 00 00       	mov    $0x0,%edx
+  801239:	b8 01 00 00 00       	mov    $0x1,%eax
+  80123e:	89 d1                	mov    %edx,%ecx
+  801240:	89 d3                	mov    %edx,%ebx
+  801242:	89 d7                	mov    %edx,%edi
+  801244:	89 d6                	mov    %edx,%esi
+  801246:	55                   	push   %ebp
+  801247:	68 50 12 80 00       	push   $0x801250
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	0f 34                	sysenter
+  801250:	83 c4 04             	add    $0x4,%esp
+  801253:	5d                   	pop    %ebp
+  801254:	eb c4                	jmp    80121a <sys_cgetc+0x2c>
+
+00801256 <sys_env_destroy>:
+  801256:	55                   	push   %ebp
+  801257:	89 e5                	mov    %esp,%ebp
+  801259:	57                   	push   %edi
+  80125a:	56                   	push   %esi
+  80125b:	53                   	push   %ebx
+  80125c:	83 ec 0c             	sub    $0xc,%esp
+  80125f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801266:	78 2a                	js     801292 <sys_env_destroy+0x3c>
+  801268:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80126f:	75 36                	jne    8012a7 <sys_env_destroy+0x51>
+  801271:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801276:	b8 03 00 00 00       	mov    $0x3,%eax
+  80127b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127e:	89 cb                	mov    %ecx,%ebx
+  801280:	89 cf                	mov    %ecx,%edi
+  801282:	89 ce                	mov    %ecx,%esi
+  801284:	cd 30                	int    $0x30
+  801286:	85 c0                	test   %eax,%eax
+  801288:	7f 40                	jg     8012ca <sys_env_destroy+0x74>
+  80128a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128d:	5b                   	pop    %ebx
+  80128e:	5e                   	pop    %esi
+  80128f:	5f                   	pop    %edi
+  801290:	5d                   	pop    %ebp
+  801291:	c3                   	ret
+  801292:	b8 01 00 00 00       	mov    $0x1,%eax
+  801297:	0f a2                	cpuid
+  801299:	c1 ea 0b             	shr    $0xb,%edx
+  80129c:	83 e2 01             	and    $0x1,%edx
+  80129f:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8012a5:	eb c1                	jmp    801268 <sys_env_destroy+0x12>
+  8012a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012af:	b8 03 00 00 00       	mov    $0x3,%eax
+  8012b4:	89 cb                	mov    %ecx,%ebx
+  8012b6:	89 cf                	mov    %ecx,%edi
+  8012b8:	89 ce                	mov    %ecx,%esi
+  8012ba:	55                   	push   %ebp
+  8012bb:	68 c4 12 80 00       	push   $0x8012c4
+  8012c0:	89 e5                	mov    %esp,%ebp
+  8012c2:	0f 34                	sysenter
+  8012c4:	83 c4 04             	add    $0x4,%esp
+  8012c7:	5d                   	pop    %ebp
+  8012c8:	eb bc                	jmp    801286 <sys_env_destroy+0x30>
+  8012ca:	83 ec 0c             	sub    $0xc,%esp
+  8012cd:	50                   	push   %eax
+  8012ce:	6a 03                	push   $0x3
+  8012d0:	68 24 23 80 00       	push   $0x802324
+  8012d5:	6a 49                	push   $0x49
+  8012d7:	68 41 23 80 00       	push   $0x802341
+  8012dc:	e8 63 f3 ff ff       	call   800644 <_panic>
+
+008012e1 <sys_getenvid>:
+  8012e1:	55                   	push   %ebp
+  8012e2:	89 e5                	mov    %esp,%ebp
+  8012e4:	57                   	push   %edi
+  8012e5:	56                   	push   %esi
+  8012e6:	53                   	push   %ebx
+  8012e7:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8012ee:	78 22                	js     801312 <sys_getenvid+0x31>
+  8012f0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8012f7:	75 2e                	jne    801327 <sys_getenvid+0x46>
+  8012f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fe:	b8 02 00 00 00       	mov    $0x2,%eax
+  801303:	89 d1                	mov    %edx,%ecx
+  801305:	89 d3                	mov    %edx,%ebx
+  801307:	89 d7                	mov    %edx,%edi
+  801309:	89 d6                	mov    %edx,%esi
+  80130b:	cd 30                	int    $0x30
+  80130d:	5b                   	pop    %ebx
+  80130e:	5e                   	pop    %esi
+  80130f:	5f                   	pop    %edi
+  801310:	5d                   	pop    %ebp
+  801311:	c3                   	ret
+  801312:	b8 01 00 00 00       	mov    $0x1,%eax
+  801317:	0f a2                	cpuid
+  801319:	c1 ea 0b             	shr    $0xb,%edx
+  80131c:	83 e2 01             	and    $0x1,%edx
+  80131f:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801325:	eb c9                	jmp    8012f0 <sys_getenvid+0xf>
+  801327:	ba 00 00 00 00       	mov    $0x0,%edx
+  80132c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801331:	89 d1                	mov    %edx,%ecx
+  801333:	89 d3                	mov    %edx,%ebx
+  801335:	89 d7                	mov    %edx,%edi
+  801337:	89 d6                	mov    %edx,%esi
+  801339:	55                   	push   %ebp
+  80133a:	68 43 13 80 00       	push   $0x801343
+  80133f:	89 e5                	mov    %esp,%ebp
+  801341:	0f 34                	sysenter
+  801343:	83 c4 04             	add    $0x4,%esp
+  801346:	5d                   	pop    %ebp
+  801347:	eb c4                	jmp    80130d <sys_getenvid+0x2c>
+
+00801349 <sys_yield>:
+  801349:	55                   	push   %ebp
+  80134a:	89 e5                	mov    %esp,%ebp
+  80134c:	57                   	push   %edi
+  80134d:	56                   	push   %esi
+  80134e:	53                   	push   %ebx
+  80134f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801356:	78 22                	js     80137a <sys_yield+0x31>
+  801358:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80135f:	75 2e                	jne    80138f <sys_yield+0x46>
+  801361:	ba 00 00 00 00       	mov    $0x0,%edx
+  801366:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80136b:	89 d1                	mov    %edx,%ecx
+  80136d:	89 d3                	mov    %edx,%ebx
+  80136f:	89 d7                	mov    %edx,%edi
+  801371:	89 d6                	mov    %edx,%esi
+  801373:	cd 30                	int    $0x30
+  801375:	5b                   	pop    %ebx
+  801376:	5e                   	pop    %esi
+  801377:	5f                   	pop    %edi
+  801378:	5d                   	pop    %ebp
+  801379:	c3                   	ret
+  80137a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80137f:	0f a2                	cpuid
+  801381:	c1 ea 0b             	shr    $0xb,%edx
+  801384:	83 e2 01             	and    $0x1,%edx
+  801387:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80138d:	eb c9                	jmp    801358 <sys_yield+0xf>
+  80138f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801394:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801399:	89 d1                	mov    %edx,%ecx
+  80139b:	89 d3                	mov    %edx,%ebx
+  80139d:	89 d7                	mov    %edx,%edi
+  80139f:	89 d6                	mov    %edx,%esi
+  8013a1:	55                   	push   %ebp
+  8013a2:	68 ab 13 80 00       	push   $0x8013ab
+  8013a7:	89 e5                	mov    %esp,%ebp
+  8013a9:	0f 34                	sysenter
+  8013ab:	83 c4 04             	add    $0x4,%esp
+  8013ae:	5d                   	pop    %ebp
+  8013af:	eb c4                	jmp    801375 <sys_yield+0x2c>
+
+008013b1 <sys_env_set_cow>:
+  8013b1:	55                   	push   %ebp
+  8013b2:	89 e5                	mov    %esp,%ebp
+  8013b4:	57                   	push   %edi
+  8013b5:	56                   	push   %esi
+  8013b6:	53                   	push   %ebx
+  8013b7:	83 ec 0c             	sub    $0xc,%esp
+  8013ba:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013c1:	78 2b                	js     8013ee <sys_env_set_cow+0x3d>
+  8013c3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013ca:	75 37                	jne    801403 <sys_env_set_cow+0x52>
+  8013cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013dc:	89 df                	mov    %ebx,%edi
+  8013de:	89 de                	mov    %ebx,%esi
+  8013e0:	cd 30                	int    $0x30
+  8013e2:	85 c0                	test   %eax,%eax
+  8013e4:	7f 41                	jg     801427 <sys_env_set_cow+0x76>
+  8013e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e9:	5b                   	pop    %ebx
+  8013ea:	5e                   	pop    %esi
+  8013eb:	5f                   	pop    %edi
+  8013ec:	5d                   	pop    %ebp
+  8013ed:	c3                   	ret
+  8013ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013f3:	0f a2                	cpuid
+  8013f5:	c1 ea 0b             	shr    $0xb,%edx
+  8013f8:	83 e2 01             	and    $0x1,%edx
+  8013fb:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801401:	eb c0                	jmp    8013c3 <sys_env_set_cow+0x12>
+  801403:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801408:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801413:	89 df                	mov    %ebx,%edi
+  801415:	89 de                	mov    %ebx,%esi
+  801417:	55                   	push   %ebp
+  801418:	68 21 14 80 00       	push   $0x801421
+  80141d:	89 e5                	mov    %esp,%ebp
+  80141f:	0f 34                	sysenter
+  801421:	83 c4 04             	add    $0x4,%esp
+  801424:	5d                   	pop    %ebp
+  801425:	eb bb                	jmp    8013e2 <sys_env_set_cow+0x31>
+  801427:	83 ec 0c             	sub    $0xc,%esp
+  80142a:	50                   	push   %eax
+  80142b:	6a 0d                	push   $0xd
+  80142d:	68 24 23 80 00       	push   $0x802324
+  801432:	6a 49                	push   $0x49
+  801434:	68 41 23 80 00       	push   $0x802341
+  801439:	e8 06 f2 ff ff       	call   800644 <_panic>
+
+0080143e <sys_env_set_quota>:
+  80143e:	55                   	push   %ebp
+  80143f:	89 e5                	mov    %esp,%ebp
+  801441:	57                   	push   %edi
+  801442:	56                   	push   %esi
+  801443:	53                   	push   %ebx
+  801444:	83 ec 0c             	sub    $0xc,%esp
+  801447:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80144e:	78 2b                	js     80147b <sys_env_set_quota+0x3d>
+  801450:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801457:	75 37                	jne    801490 <sys_env_set_quota+0x52>
+  801459:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80145e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801463:	8b 55 08             	mov    0x8(%ebp),%edx
+  801466:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801469:	89 df                	mov    %ebx,%edi
+  80146b:	89 de                	mov    %ebx,%esi
+  80146d:	cd 30                	int    $0x30
+  80146f:	85 c0                	test   %eax,%eax
+  801471:	7f 41                	jg     8014b4 <sys_env_set_quota+0x76>
+  801473:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801476:	5b                   	pop    %ebx
+  801477:	5e                   	pop    %esi
+  801478:	5f                   	pop    %edi
+  801479:	5d                   	pop    %ebp
+  80147a:	c3                   	ret
+  80147b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801480:	0f a2                	cpuid
+  801482:	c1 ea 0b             	shr    $0xb,%edx
+  801485:	83 e2 01             	and    $0x1,%edx
+  801488:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80148e:	eb c0                	jmp    801450 <sys_env_set_quota+0x12>
+  801490:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801495:	8b 55 08             	mov    0x8(%ebp),%edx
+  801498:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8014a0:	89 df                	mov    %ebx,%edi
+  8014a2:	89 de                	mov    %ebx,%esi
+  8014a4:	55                   	push   %ebp
+  8014a5:	68 ae 14 80 00       	push   $0x8014ae
+  8014aa:	89 e5                	mov    %esp,%ebp
+  8014ac:	0f 34                	sysenter
+  8014ae:	83 c4 04             	add    $0x4,%esp
+  8014b1:	5d                   	pop    %ebp
+  8014b2:	eb bb                	jmp    80146f <sys_env_set_quota+0x31>
+  8014b4:	83 ec 0c             	sub    $0xc,%esp
+  8014b7:	50                   	push   %eax
+  8014b8:	6a 0f                	push   $0xf
+  8014ba:	68 24 23 80 00       	push   $0x802324
+  8014bf:	6a 49                	push   $0x49
+  8014c1:	68 41 23 80 00       	push   $0x802341
+  8014c6:	e8 79 f1 ff ff       	call   800644 <_panic>
+
+008014cb <sys_page_alloc>:
+  8014cb:	55                   	push   %ebp
+  8014cc:	89 e5                	mov    %esp,%ebp
+  8014ce:	57                   	push   %edi
+  8014cf:	56                   	push   %esi
+  8014d0:	53                   	push   %ebx
+  8014d1:	83 ec 0c             	sub    $0xc,%esp
+  8014d4:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014db:	78 2c                	js     801509 <sys_page_alloc+0x3e>
+  8014dd:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014e4:	75 38                	jne    80151e <sys_page_alloc+0x53>
+  8014e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014eb:	b8 04 00 00 00       	mov    $0x4,%eax
+  8014f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014f9:	89 f7                	mov    %esi,%edi
+  8014fb:	cd 30                	int    $0x30
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	7f 42                	jg     801543 <sys_page_alloc+0x78>
+  801501:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801504:	5b                   	pop    %ebx
+  801505:	5e                   	pop    %esi
+  801506:	5f                   	pop    %edi
+  801507:	5d                   	pop    %ebp
+  801508:	c3                   	ret
+  801509:	b8 01 00 00 00       	mov    $0x1,%eax
+  80150e:	0f a2                	cpuid
+  801510:	c1 ea 0b             	shr    $0xb,%edx
+  801513:	83 e2 01             	and    $0x1,%edx
+  801516:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80151c:	eb bf                	jmp    8014dd <sys_page_alloc+0x12>
+  80151e:	be 00 00 00 00       	mov    $0x0,%esi
+  801523:	8b 55 08             	mov    0x8(%ebp),%edx
+  801526:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801529:	b8 04 00 00 00       	mov    $0x4,%eax
+  80152e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801531:	89 f7                	mov    %esi,%edi
+  801533:	55                   	push   %ebp
+  801534:	68 3d 15 80 00       	push   $0x80153d
+  801539:	89 e5                	mov    %esp,%ebp
+  80153b:	0f 34                	sysenter
+  80153d:	83 c4 04             	add    $0x4,%esp
+  801540:	5d                   	pop    %ebp
+  801541:	eb ba                	jmp    8014fd <sys_page_alloc+0x32>
+  801543:	83 ec 0c             	sub    $0xc,%esp
+  801546:	50                   	push   %eax
+  801547:	6a 04                	push   $0x4
+  801549:	68 24 23 80 00       	push   $0x802324
+  80154e:	6a 49                	push   $0x49
+  801550:	68 41 23 80 00       	push   $0x802341
+  801555:	e8 ea f0 ff ff       	call   800644 <_panic>
+
+0080155a <sys_page_map>:
+  80155a:	55                   	push   %ebp
+  80155b:	89 e5                	mov    %esp,%ebp
+  80155d:	57                   	push   %edi
+  80155e:	56                   	push   %esi
+  80155f:	53                   	push   %ebx
+  801560:	83 ec 0c             	sub    $0xc,%esp
+  801563:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80156a:	78 2b                	js     801597 <sys_page_map+0x3d>
+  80156c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801573:	75 37                	jne    8015ac <sys_page_map+0x52>
+  801575:	b8 05 00 00 00       	mov    $0x5,%eax
+  80157a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801580:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801583:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801586:	8b 75 18             	mov    0x18(%ebp),%esi
+  801589:	cd 30                	int    $0x30
+  80158b:	85 c0                	test   %eax,%eax
+  80158d:	7f 41                	jg     8015d0 <sys_page_map+0x76>
+  80158f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801592:	5b                   	pop    %ebx
+  801593:	5e                   	pop    %esi
+  801594:	5f                   	pop    %edi
+  801595:	5d                   	pop    %ebp
+  801596:	c3                   	ret
+  801597:	b8 01 00 00 00       	mov    $0x1,%eax
+  80159c:	0f a2                	cpuid
+  80159e:	c1 ea 0b             	shr    $0xb,%edx
+  8015a1:	83 e2 01             	and    $0x1,%edx
+  8015a4:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8015aa:	eb c0                	jmp    80156c <sys_page_map+0x12>
+  8015ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8015b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ba:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015bd:	8b 75 18             	mov    0x18(%ebp),%esi
+  8015c0:	55                   	push   %ebp
+  8015c1:	68 ca 15 80 00       	push   $0x8015ca
+  8015c6:	89 e5                	mov    %esp,%ebp
+  8015c8:	0f 34                	sysenter
+  8015ca:	83 c4 04             	add    $0x4,%esp
+  8015cd:	5d                   	pop    %ebp
+  8015ce:	eb bb                	jmp    80158b <sys_page_map+0x31>
+  8015d0:	83 ec 0c             	sub    $0xc,%esp
+  8015d3:	50                   	push   %eax
+  8015d4:	6a 05                	push   $0x5
+  8015d6:	68 24 23 80 00       	push   $0x802324
+  8015db:	6a 49                	push   $0x49
+  8015dd:	68 41 23 80 00       	push   $0x802341
+  8015e2:	e8 5d f0 ff ff       	call   800644 <_panic>
+
+008015e7 <sys_page_unmap>:
+  8015e7:	55                   	push   %ebp
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	57                   	push   %edi
+  8015eb:	56                   	push   %esi
+  8015ec:	53                   	push   %ebx
+  8015ed:	83 ec 0c             	sub    $0xc,%esp
+  8015f0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8015f7:	78 2b                	js     801624 <sys_page_unmap+0x3d>
+  8015f9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801600:	75 37                	jne    801639 <sys_page_unmap+0x52>
+  801602:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801607:	b8 06 00 00 00       	mov    $0x6,%eax
+  80160c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801612:	89 df                	mov    %ebx,%edi
+  801614:	89 de                	mov    %ebx,%esi
+  801616:	cd 30                	int    $0x30
+  801618:	85 c0                	test   %eax,%eax
+  80161a:	7f 41                	jg     80165d <sys_page_unmap+0x76>
+  80161c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80161f:	5b                   	pop    %ebx
+  801620:	5e                   	pop    %esi
+  801621:	5f                   	pop    %edi
+  801622:	5d                   	pop    %ebp
+  801623:	c3                   	ret
+  801624:	b8 01 00 00 00       	mov    $0x1,%eax
+  801629:	0f a2                	cpuid
+  80162b:	c1 ea 0b             	shr    $0xb,%edx
+  80162e:	83 e2 01             	and    $0x1,%edx
+  801631:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801637:	eb c0                	jmp    8015f9 <sys_page_unmap+0x12>
+  801639:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801641:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801644:	b8 06 00 00 00       	mov    $0x6,%eax
+  801649:	89 df                	mov    %ebx,%edi
+  80164b:	89 de                	mov    %ebx,%esi
+  80164d:	55                   	push   %ebp
+  80164e:	68 57 16 80 00       	push   $0x801657
+  801653:	89 e5                	mov    %esp,%ebp
+  801655:	0f 34                	sysenter
+  801657:	83 c4 04             	add    $0x4,%esp
+  80165a:	5d                   	pop    %ebp
+  80165b:	eb bb                	jmp    801618 <sys_page_unmap+0x31>
+  80165d:	83 ec 0c             	sub    $0xc,%esp
+  801660:	50                   	push   %eax
+  801661:	6a 06                	push   $0x6
+  801663:	68 24 23 80 00       	push   $0x802324
+  801668:	6a 49                	push   $0x49
+  80166a:	68 41 23 80 00       	push   $0x802341
+  80166f:	e8 d0 ef ff ff       	call   800644 <_panic>
+
+00801674 <sys_page_reuse>:
+  801674:	55                   	push   %ebp
+  801675:	89 e5                	mov    %esp,%ebp
+  801677:	57                   	push   %edi
+  801678:	56                   	push   %esi
+  801679:	53                   	push   %ebx
+  80167a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801681:	78 24                	js     8016a7 <sys_page_reuse+0x33>
+  801683:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80168a:	75 30                	jne    8016bc <sys_page_reuse+0x48>
+  80168c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801691:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801696:	8b 55 08             	mov    0x8(%ebp),%edx
+  801699:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169c:	89 df                	mov    %ebx,%edi
+  80169e:	89 de                	mov    %ebx,%esi
+  8016a0:	cd 30                	int    $0x30
+  8016a2:	5b                   	pop    %ebx
+  8016a3:	5e                   	pop    %esi
+  8016a4:	5f                   	pop    %edi
+  8016a5:	5d                   	pop    %ebp
+  8016a6:	c3                   	ret
+  8016a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016ac:	0f a2                	cpuid
+  8016ae:	c1 ea 0b             	shr    $0xb,%edx
+  8016b1:	83 e2 01             	and    $0x1,%edx
+  8016b4:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8016ba:	eb c7                	jmp    801683 <sys_page_reuse+0xf>
+  8016bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8016cc:	89 df                	mov    %ebx,%edi
+  8016ce:	89 de                	mov    %ebx,%esi
+  8016d0:	55                   	push   %ebp
+  8016d1:	68 da 16 80 00       	push   $0x8016da
+  8016d6:	89 e5                	mov    %esp,%ebp
+  8016d8:	0f 34                	sysenter
+  8016da:	83 c4 04             	add    $0x4,%esp
+  8016dd:	5d                   	pop    %ebp
+  8016de:	eb c2                	jmp    8016a2 <sys_page_reuse+0x2e>
+
+008016e0 <sys_env_set_status>:
+  8016e0:	55                   	push   %ebp
+  8016e1:	89 e5                	mov    %esp,%ebp
+  8016e3:	57                   	push   %edi
+  8016e4:	56                   	push   %esi
+  8016e5:	53                   	push   %ebx
+  8016e6:	83 ec 0c             	sub    $0xc,%esp
+  8016e9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8016f0:	78 2b                	js     80171d <sys_env_set_status+0x3d>
+  8016f2:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8016f9:	75 37                	jne    801732 <sys_env_set_status+0x52>
+  8016fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801700:	b8 08 00 00 00       	mov    $0x8,%eax
+  801705:	8b 55 08             	mov    0x8(%ebp),%edx
+  801708:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80170b:	89 df                	mov    %ebx,%edi
+  80170d:	89 de                	mov    %ebx,%esi
+  80170f:	cd 30                	int    $0x30
+  801711:	85 c0                	test   %eax,%eax
+  801713:	7f 41                	jg     801756 <sys_env_set_status+0x76>
+  801715:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801718:	5b                   	pop    %ebx
+  801719:	5e                   	pop    %esi
+  80171a:	5f                   	pop    %edi
+  80171b:	5d                   	pop    %ebp
+  80171c:	c3                   	ret
+  80171d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801722:	0f a2                	cpuid
+  801724:	c1 ea 0b             	shr    $0xb,%edx
+  801727:	83 e2 01             	and    $0x1,%edx
+  80172a:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801730:	eb c0                	jmp    8016f2 <sys_env_set_status+0x12>
+  801732:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801737:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80173d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801742:	89 df                	mov    %ebx,%edi
+  801744:	89 de                	mov    %ebx,%esi
+  801746:	55                   	push   %ebp
+  801747:	68 50 17 80 00       	push   $0x801750
+  80174c:	89 e5                	mov    %esp,%ebp
+  80174e:	0f 34                	sysenter
+  801750:	83 c4 04             	add    $0x4,%esp
+  801753:	5d                   	pop    %ebp
+  801754:	eb bb                	jmp    801711 <sys_env_set_status+0x31>
+  801756:	83 ec 0c             	sub    $0xc,%esp
+  801759:	50                   	push   %eax
+  80175a:	6a 08                	push   $0x8
+  80175c:	68 24 23 80 00       	push   $0x802324
+  801761:	6a 49                	push   $0x49
+  801763:	68 41 23 80 00       	push   $0x802341
+  801768:	e8 d7 ee ff ff       	call   800644 <_panic>
+
+0080176d <sys_env_set_pgfault_upcall>:
+  80176d:	55                   	push   %ebp
+  80176e:	89 e5                	mov    %esp,%ebp
+  801770:	57                   	push   %edi
+  801771:	56                   	push   %esi
+  801772:	53                   	push   %ebx
+  801773:	83 ec 0c             	sub    $0xc,%esp
+  801776:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80177d:	78 2b                	js     8017aa <sys_env_set_pgfault_upcall+0x3d>
+  80177f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801786:	75 37                	jne    8017bf <sys_env_set_pgfault_upcall+0x52>
+  801788:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801792:	8b 55 08             	mov    0x8(%ebp),%edx
+  801795:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801798:	89 df                	mov    %ebx,%edi
+  80179a:	89 de                	mov    %ebx,%esi
+  80179c:	cd 30                	int    $0x30
+  80179e:	85 c0                	test   %eax,%eax
+  8017a0:	7f 41                	jg     8017e3 <sys_env_set_pgfault_upcall+0x76>
+  8017a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017a5:	5b                   	pop    %ebx
+  8017a6:	5e                   	pop    %esi
+  8017a7:	5f                   	pop    %edi
+  8017a8:	5d                   	pop    %ebp
+  8017a9:	c3                   	ret
+  8017aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017af:	0f a2                	cpuid
+  8017b1:	c1 ea 0b             	shr    $0xb,%edx
+  8017b4:	83 e2 01             	and    $0x1,%edx
+  8017b7:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8017bd:	eb c0                	jmp    80177f <sys_env_set_pgfault_upcall+0x12>
+  8017bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ca:	b8 09 00 00 00       	mov    $0x9,%eax
+  8017cf:	89 df                	mov    %ebx,%edi
+  8017d1:	89 de                	mov    %ebx,%esi
+  8017d3:	55                   	push   %ebp
+  8017d4:	68 dd 17 80 00       	push   $0x8017dd
+  8017d9:	89 e5                	mov    %esp,%ebp
+  8017db:	0f 34                	sysenter
+  8017dd:	83 c4 04             	add    $0x4,%esp
+  8017e0:	5d                   	pop    %ebp
+  8017e1:	eb bb                	jmp    80179e <sys_env_set_pgfault_upcall+0x31>
+  8017e3:	83 ec 0c             	sub    $0xc,%esp
+  8017e6:	50                   	push   %eax
+  8017e7:	6a 09                	push   $0x9
+  8017e9:	68 24 23 80 00       	push   $0x802324
+  8017ee:	6a 49                	push   $0x49
+  8017f0:	68 41 23 80 00       	push   $0x802341
+  8017f5:	e8 4a ee ff ff       	call   800644 <_panic>
+
+008017fa <sys_env_set_trace>:
+  8017fa:	55                   	push   %ebp
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	57                   	push   %edi
+  8017fe:	56                   	push   %esi
+  8017ff:	53                   	push   %ebx
+  801800:	83 ec 0c             	sub    $0xc,%esp
+  801803:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80180a:	78 2b                	js     801837 <sys_env_set_trace+0x3d>
+  80180c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801813:	75 37                	jne    80184c <sys_env_set_trace+0x52>
+  801815:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80181a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80181f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801822:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801825:	89 df                	mov    %ebx,%edi
+  801827:	89 de                	mov    %ebx,%esi
+  801829:	cd 30                	int    $0x30
+  80182b:	85 c0                	test   %eax,%eax
+  80182d:	7f 41                	jg     801870 <sys_env_set_trace+0x76>
+  80182f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801832:	5b                   	pop    %ebx
+  801833:	5e                   	pop    %esi
+  801834:	5f                   	pop    %edi
+  801835:	5d                   	pop    %ebp
+  801836:	c3                   	ret
+  801837:	b8 01 00 00 00       	mov    $0x1,%eax
+  80183c:	0f a2                	cpuid
+  80183e:	c1 ea 0b             	shr    $0xb,%edx
+  801841:	83 e2 01             	and    $0x1,%edx
+  801844:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80184a:	eb c0                	jmp    80180c <sys_env_set_trace+0x12>
+  80184c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801851:	8b 55 08             	mov    0x8(%ebp),%edx
+  801854:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801857:	b8 12 00 00 00       	mov    $0x12,%eax
+  80185c:	89 df                	mov    %ebx,%edi
+  80185e:	89 de                	mov    %ebx,%esi
+  801860:	55                   	push   %ebp
+  801861:	68 6a 18 80 00       	push   $0x80186a
+  801866:	89 e5                	mov    %esp,%ebp
+  801868:	0f 34                	sysenter
+  80186a:	83 c4 04             	add    $0x4,%esp
+  80186d:	5d                   	pop    %ebp
+  80186e:	eb bb                	jmp    80182b <sys_env_set_trace+0x31>
+  801870:	83 ec 0c             	sub    $0xc,%esp
+  801873:	50                   	push   %eax
+  801874:	6a 12                	push   $0x12
+  801876:	68 24 23 80 00       	push   $0x802324
+  80187b:	6a 49                	push   $0x49
+  80187d:	68 41 23 80 00       	push   $0x802341
+  801882:	e8 bd ed ff ff       	call   800644 <_panic>
+
+00801887 <sys_env_set_rdpmc>:
+  801887:	55                   	push   %ebp
+  801888:	89 e5                	mov    %esp,%ebp
+  80188a:	57                   	push   %edi
+  80188b:	56                   	push   %esi
+  80188c:	53                   	push   %ebx
+  80188d:	83 ec 0c             	sub    $0xc,%esp
+  801890:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801897:	78 2b                	js     8018c4 <sys_env_set_rdpmc+0x3d>
+  801899:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8018a0:	75 37                	jne    8018d9 <sys_env_set_rdpmc+0x52>
+  8018a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8018ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018b2:	89 df                	mov    %ebx,%edi
+  8018b4:	89 de                	mov    %ebx,%esi
+  8018b6:	cd 30                	int    $0x30
+  8018b8:	85 c0                	test   %eax,%eax
+  8018ba:	7f 41                	jg     8018fd <sys_env_set_rdpmc+0x76>
+  8018bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018bf:	5b                   	pop    %ebx
+  8018c0:	5e                   	pop    %esi
+  8018c1:	5f                   	pop    %edi
+  8018c2:	5d                   	pop    %ebp
+  8018c3:	c3                   	ret
+  8018c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018c9:	0f a2                	cpuid
+  8018cb:	c1 ea 0b             	shr    $0xb,%edx
+  8018ce:	83 e2 01             	and    $0x1,%edx
+  8018d1:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8018d7:	eb c0                	jmp    801899 <sys_env_set_rdpmc+0x12>
+  8018d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018e4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8018e9:	89 df                	mov    %ebx,%edi
+  8018eb:	89 de                	mov    %ebx,%esi
+  8018ed:	55                   	push   %ebp
+  8018ee:	68 f7 18 80 00       	push   $0x8018f7
+  8018f3:	89 e5                	mov    %esp,%ebp
+  8018f5:	0f 34                	sysenter
+  8018f7:	83 c4 04             	add    $0x4,%esp
+  8018fa:	5d                   	pop    %ebp
+  8018fb:	eb bb                	jmp    8018b8 <sys_env_set_rdpmc+0x31>
+  8018fd:	83 ec 0c             	sub    $0xc,%esp
+  801900:	50                   	push   %eax
+  801901:	6a 13                	push   $0x13
+  801903:	68 24 23 80 00       	push   $0x802324
+  801908:	6a 49                	push   $0x49
+  80190a:	68 41 23 80 00       	push   $0x802341
+  80190f:	e8 30 ed ff ff       	call   800644 <_panic>
+
+00801914 <sys_ring_setup>:
+  801914:	55                   	push   %ebp
+  801915:	89 e5                	mov    %esp,%ebp
+  801917:	57                   	push   %edi
+  801918:	56                   	push   %esi
+  801919:	53                   	push   %ebx
+  80191a:	83 ec 0c             	sub    $0xc,%esp
+  80191d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801924:	78 29                	js     80194f <sys_ring_setup+0x3b>
+  801926:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80192d:	75 35                	jne    801964 <sys_ring_setup+0x50>
+  80192f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801934:	b8 10 00 00 00       	mov    $0x10,%eax
+  801939:	89 d1                	mov    %edx,%ecx
+  80193b:	89 d3                	mov    %edx,%ebx
+  80193d:	89 d7                	mov    %edx,%edi
+  80193f:	89 d6                	mov    %edx,%esi
+  801941:	cd 30                	int    $0x30
+  801943:	85 c0                	test   %eax,%eax
+  801945:	7f 3f                	jg     801986 <sys_ring_setup+0x72>
+  801947:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80194a:	5b                   	pop    %ebx
+  80194b:	5e                   	pop    %esi
+  80194c:	5f                   	pop    %edi
+  80194d:	5d                   	pop    %ebp
+  80194e:	c3                   	ret
+  80194f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801954:	0f a2                	cpuid
+  801956:	c1 ea 0b             	shr    $0xb,%edx
+  801959:	83 e2 01             	and    $0x1,%edx
+  80195c:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801962:	eb c2                	jmp    801926 <sys_ring_setup+0x12>
+  801964:	ba 00 00 00 00       	mov    $0x0,%edx
+  801969:	b8 10 00 00 00       	mov    $0x10,%eax
+  80196e:	89 d1                	mov    %edx,%ecx
+  801970:	89 d3                	mov    %edx,%ebx
+  801972:	89 d7                	mov    %edx,%edi
+  801974:	89 d6                	mov    %edx,%esi
+  801976:	55                   	push   %ebp
+  801977:	68 80 19 80 00       	push   $0x801980
+  80197c:	89 e5                	mov    %esp,%ebp
+  80197e:	0f 34                	sysenter
+  801980:	83 c4 04             	add    $0x4,%esp
+  801983:	5d                   	pop    %ebp
+  801984:	eb bd                	jmp    801943 <sys_ring_setup+0x2f>
+  801986:	83 ec 0c             	sub    $0xc,%esp
+  801989:	50                   	push   %eax
+  80198a:	6a 10                	push   $0x10
+  80198c:	68 24 23 80 00       	push   $0x802324
+  801991:	6a 49                	push   $0x49
+  801993:	68 41 23 80 00       	push   $0x802341
+  801998:	e8 a7 ec ff ff       	call   800644 <_panic>
+
+0080199d <sys_ring_enter>:
+  80199d:	55                   	push   %ebp
+  80199e:	89 e5                	mov    %esp,%ebp
+  8019a0:	57                   	push   %edi
+  8019a1:	56                   	push   %esi
+  8019a2:	53                   	push   %ebx
+  8019a3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8019aa:	78 22                	js     8019ce <sys_ring_enter+0x31>
+  8019ac:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8019b3:	75 2e                	jne    8019e3 <sys_ring_enter+0x46>
+  8019b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ba:	b8 11 00 00 00       	mov    $0x11,%eax
+  8019bf:	89 d1                	mov    %edx,%ecx
+  8019c1:	89 d3                	mov    %edx,%ebx
+  8019c3:	89 d7                	mov    %edx,%edi
+  8019c5:	89 d6                	mov    %edx,%esi
+  8019c7:	cd 30                	int    $0x30
+  8019c9:	5b                   	pop    %ebx
+  8019ca:	5e                   	pop    %esi
+  8019cb:	5f                   	pop    %edi
+  8019cc:	5d                   	pop    %ebp
+  8019cd:	c3                   	ret
+  8019ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019d3:	0f a2                	cpuid
+  8019d5:	c1 ea 0b             	shr    $0xb,%edx
+  8019d8:	83 e2 01             	and    $0x1,%edx
+  8019db:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8019e1:	eb c9                	jmp    8019ac <sys_ring_enter+0xf>
+  8019e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e8:	b8 11 00 00 00       	mov    $0x11,%eax
+  8019ed:	89 d1                	mov    %edx,%ecx
+  8019ef:	89 d3                	mov    %edx,%ebx
+  8019f1:	89 d7                	mov    %edx,%edi
+  8019f3:	89 d6                	mov    %edx,%esi
+  8019f5:	55                   	push   %ebp
+  8019f6:	68 ff 19 80 00       	push   $0x8019ff
+  8019fb:	89 e5                	mov    %esp,%ebp
+  8019fd:	0f 34                	sysenter
+  8019ff:	83 c4 04             	add    $0x4,%esp
+  801a02:	5d                   	pop    %ebp
+  801a03:	eb c4                	jmp    8019c9 <sys_ring_enter+0x2c>
+
+00801a05 <sys_ipc_try_send>:
+  801a05:	55                   	push   %ebp
+  801a06:	89 e5                	mov    %esp,%ebp
+  801a08:	57                   	push   %edi
+  801a09:	56                   	push   %esi
+  801a0a:	53                   	push   %ebx
+  801a0b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801a12:	78 26                	js     801a3a <sys_ipc_try_send+0x35>
+  801a14:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801a1b:	75 32                	jne    801a4f <sys_ipc_try_send+0x4a>
+  801a1d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801a22:	be 00 00 00 00       	mov    $0x0,%esi
+  801a27:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a30:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a33:	cd 30                	int    $0x30
+  801a35:	5b                   	pop    %ebx
+  801a36:	5e                   	pop    %esi
+  801a37:	5f                   	pop    %edi
+  801a38:	5d                   	pop    %ebp
+  801a39:	c3                   	ret
+  801a3a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a3f:	0f a2                	cpuid
+  801a41:	c1 ea 0b             	shr    $0xb,%edx
+  801a44:	83 e2 01             	and    $0x1,%edx
+  801a47:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801a4d:	eb c5                	jmp    801a14 <sys_ipc_try_send+0xf>
+  801a4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a55:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801a5a:	be 00 00 00 00       	mov    $0x0,%esi
+  801a5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a62:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a65:	55                   	push   %ebp
+  801a66:	68 6f 1a 80 00       	push   $0x801a6f
+  801a6b:	89 e5                	mov    %esp,%ebp
+  801a6d:	0f 34                	sysenter
+  801a6f:	83 c4 04             	add    $0x4,%esp
+  801a72:	5d                   	pop    %ebp
+  801a73:	eb c0                	jmp    801a35 <sys_ipc_try_send+0x30>
+
+00801a75 <sys_ipc_recv>:
+  801a75:	55                   	push   %ebp
+  801a76:	89 e5                	mov    %esp,%ebp
+  801a78:	57                   	push   %edi
+  801a79:	56                   	push   %esi
+  801a7a:	53                   	push   %ebx
+  801a7b:	83 ec 0c             	sub    $0xc,%esp
+  801a7e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801a85:	78 2a                	js     801ab1 <sys_ipc_recv+0x3c>
+  801a87:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801a8e:	75 36                	jne    801ac6 <sys_ipc_recv+0x51>
+  801a90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a95:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a9d:	89 cb                	mov    %ecx,%ebx
+  801a9f:	89 cf                	mov    %ecx,%edi
+  801aa1:	89 ce                	mov    %ecx,%esi
+  801aa3:	cd 30                	int    $0x30
+  801aa5:	85 c0                	test   %eax,%eax
+  801aa7:	7f 40                	jg     801ae9 <sys_ipc_recv+0x74>
+  801aa9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aac:	5b                   	pop    %ebx
+  801aad:	5e                   	pop    %esi
+  801aae:	5f                   	pop    %edi
+  801aaf:	5d                   	pop    %ebp
+  801ab0:	c3                   	ret
+  801ab1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ab6:	0f a2                	cpuid
+  801ab8:	c1 ea 0b             	shr    $0xb,%edx
+  801abb:	83 e2 01             	and    $0x1,%edx
+  801abe:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801ac4:	eb c1                	jmp    801a87 <sys_ipc_recv+0x12>
+  801ac6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ac9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ace:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801ad3:	89 cb                	mov    %ecx,%ebx
+  801ad5:	89 cf                	mov    %ecx,%edi
+  801ad7:	89 ce                	mov    %ecx,%esi
+  801ad9:	55                   	push   %ebp
+  801ada:	68 e3 1a 80 00       	push   $0x801ae3
+  801adf:	89 e5                	mov    %esp,%ebp
+  801ae1:	0f 34                	sysenter
+  801ae3:	83 c4 04             	add    $0x4,%esp
+  801ae6:	5d                   	pop    %ebp
+  801ae7:	eb bc                	jmp    801aa5 <sys_ipc_recv+0x30>
+  801ae9:	83 ec 0c             	sub    $0xc,%esp
+  801aec:	50                   	push   %eax
+  801aed:	6a 0c                	push   $0xc
+  801aef:	68 24 23 80 00       	push   $0x802324
+  801af4:	6a 49                	push   $0x49
+  801af6:	68 41 23 80 00       	push   $0x802341
+  801afb:	e8 44 eb ff ff       	call   800644 <_panic>
+
+00801b00 <set_pgfault_handler>:
+  801b00:	55                   	push   %ebp
+  801b01:	89 e5                	mov    %esp,%ebp
+  801b03:	83 ec 08             	sub    $0x8,%esp
+  801b06:	83 3d d0 30 80 00 00 	cmpl   $0x0,0x8030d0
+  801b0d:	74 0a                	je     801b19 <set_pgfault_handler+0x19>
+  801b0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b12:	a3 d0 30 80 00       	mov    %eax,0x8030d0
+  801b17:	c9                   	leave
+  801b18:	c3                   	ret
+  801b19:	83 ec 04             	sub    $0x4,%esp
+  801b1c:	6a 07                	push   $0x7
+  801b1e:	68 00 f0 ff ea       	push   $0xeafff000
+  801b23:	6a 00                	push   $0x0
+  801b25:	e8 a1 f9 ff ff       	call   8014cb <sys_page_alloc>
+  801b2a:	83 c4 10             	add    $0x10,%esp
+  801b2d:	85 c0                	test   %eax,%eax
+  801b2f:	75 2a                	jne    801b5b <set_pgfault_handler+0x5b>
+  801b31:	83 ec 08             	sub    $0x8,%esp
+  801b34:	68 6f 1b 80 00       	push   $0x801b6f
+  801b39:	6a 00                	push   $0x0
+  801b3b:	e8 2d fc ff ff       	call   80176d <sys_env_set_pgfault_upcall>
+  801b40:	83 c4 10             	add    $0x10,%esp
+  801b43:	85 c0                	test   %eax,%eax
+  801b45:	74 c8                	je     801b0f <set_pgfault_handler+0xf>
+  801b47:	83 ec 04             	sub    $0x4,%esp
+  801b4a:	68 74 23 80 00       	push   $0x802374
+  801b4f:	6a 28                	push   $0x28
+  801b51:	68 65 23 80 00       	push   $0x802365
+  801b56:	e8 e9 ea ff ff       	call   800644 <_panic>
+  801b5b:	83 ec 04             	sub    $0x4,%esp
+  801b5e:	68 4f 23 80 00       	push   $0x80234f
+  801b63:	6a 22                	push   $0x22
+  801b65:	68 65 23 80 00       	push   $0x802365
+  801b6a:	e8 d5 ea ff ff       	call   800644 <_panic>
+
+00801b6f <_pgfault_upcall>:
+  801b6f:	54                   	push   %esp
+  801b70:	a1 d0 30 80 00       	mov    0x8030d0,%eax
+  801b75:	ff d0                	call   *%eax
+  801b77:	83 c4 04             	add    $0x4,%esp
+  801b7a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  801b7e:	89 e5                	mov    %esp,%ebp
+  801b80:	8b 64 24 30          	mov    0x30(%esp),%esp
+  801b84:	50                   	push   %eax
+  801b85:	89 ec                	mov    %ebp,%esp
+  801b87:	83 c4 08             	add    $0x8,%esp
+  801b8a:	61                   	popa
+  801b8b:	83 c4 04             	add    $0x4,%esp
+  801b8e:	9d                   	popf
+  801b8f:	5c                   	pop    %esp
+  801b90:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+  801b94:	c3                   	ret
+
+00801b95 <uinfo_envid>:
+  801b95:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  801b9a:	c3                   	ret
+
+00801b9b <uinfo_cpunum>:
+  801b9b:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  801ba0:	c3                   	ret
+
+00801ba1 <uinfo_ticks>:
+  801ba1:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  801ba6:	c3                   	ret
+
+00801ba7 <uinfo_nsec>:
+  801ba7:	55                   	push   %ebp
+  801ba8:	89 e5                	mov    %esp,%ebp
+  801baa:	57                   	push   %edi
+  801bab:	56                   	push   %esi
+  801bac:	53                   	push   %ebx
+  801bad:	83 ec 1c             	sub    $0x1c,%esp
+  801bb0:	0f 31                	rdtsc
+  801bb2:	89 c6                	mov    %eax,%esi
+  801bb4:	89 d7                	mov    %edx,%edi
+  801bb6:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc6:	85 c9                	test   %ecx,%ecx
+  801bc8:	74 5c                	je     801c26 <uinfo_nsec+0x7f>
+  801bca:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bcf:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801bd2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801bd5:	52                   	push   %edx
+  801bd6:	51                   	push   %ecx
+  801bd7:	57                   	push   %edi
+  801bd8:	56                   	push   %esi
+  801bd9:	e8 1f 02 00 00       	call   801dfd <__umoddi3>
+  801bde:	83 c4 10             	add    $0x10,%esp
+  801be1:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801be7:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801bec:	f7 e3                	mul    %ebx
+  801bee:	01 ca                	add    %ecx,%edx
+  801bf0:	ff 75 e4             	push   -0x1c(%ebp)
+  801bf3:	ff 75 e0             	push   -0x20(%ebp)
+  801bf6:	52                   	push   %edx
+  801bf7:	50                   	push   %eax
+  801bf8:	e8 28 01 00 00       	call   801d25 <__udivdi3>
+  801bfd:	83 c4 10             	add    $0x10,%esp
+  801c00:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801c03:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801c06:	ff 75 e4             	push   -0x1c(%ebp)
+  801c09:	ff 75 e0             	push   -0x20(%ebp)
+  801c0c:	57                   	push   %edi
+  801c0d:	56                   	push   %esi
+  801c0e:	e8 12 01 00 00       	call   801d25 <__udivdi3>
+  801c13:	83 c4 10             	add    $0x10,%esp
+  801c16:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801c1c:	f7 e3                	mul    %ebx
+  801c1e:	01 ca                	add    %ecx,%edx
+  801c20:	03 45 d8             	add    -0x28(%ebp),%eax
+  801c23:	13 55 dc             	adc    -0x24(%ebp),%edx
+  801c26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c29:	5b                   	pop    %ebx
+  801c2a:	5e                   	pop    %esi
+  801c2b:	5f                   	pop    %edi
+  801c2c:	5d                   	pop    %ebp
+  801c2d:	c3                   	ret
+
+00801c2e <bflush>:
+  801c2e:	a1 e0 30 80 00       	mov    0x8030e0,%eax
+  801c33:	85 c0                	test   %eax,%eax
+  801c35:	75 01                	jne    801c38 <bflush+0xa>
+  801c37:	c3                   	ret
+  801c38:	55                   	push   %ebp
+  801c39:	89 e5                	mov    %esp,%ebp
+  801c3b:	83 ec 10             	sub    $0x10,%esp
+  801c3e:	50                   	push   %eax
+  801c3f:	68 e4 30 80 00       	push   $0x8030e4
+  801c44:	e8 3f f5 ff ff       	call   801188 <sys_cputs>
+  801c49:	c7 05 e0 30 80 00 00 	movl   $0x0,0x8030e0
+  801c50:	00 00 00 
+  801c53:	83 c4 10             	add    $0x10,%esp
+  801c56:	c9                   	leave
+  801c57:	c3                   	ret
+
+00801c58 <bputch>:
+  801c58:	55                   	push   %ebp
+  801c59:	89 e5                	mov    %esp,%ebp
+  801c5b:	53                   	push   %ebx
+  801c5c:	83 ec 04             	sub    $0x4,%esp
+  801c5f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c62:	8b 15 e0 30 80 00    	mov    0x8030e0,%edx
+  801c68:	8d 42 01             	lea    0x1(%edx),%eax
+  801c6b:	a3 e0 30 80 00       	mov    %eax,0x8030e0
+  801c70:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c73:	88 8a e4 30 80 00    	mov    %cl,0x8030e4(%edx)
+  801c79:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c7e:	77 08                	ja     801c88 <bputch+0x30>
+  801c80:	83 03 01             	addl   $0x1,(%ebx)
+  801c83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c86:	c9                   	leave
+  801c87:	c3                   	ret
+  801c88:	e8 a1 ff ff ff       	call   801c2e <bflush>
+  801c8d:	eb f1                	jmp    801c80 <bputch+0x28>
+
+00801c8f <vbprintf>:
+  801c8f:	55                   	push   %ebp
+  801c90:	89 e5                	mov    %esp,%ebp
+  801c92:	83 ec 18             	sub    $0x18,%esp
+  801c95:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801c9c:	ff 75 0c             	push   0xc(%ebp)
+  801c9f:	ff 75 08             	push   0x8(%ebp)
+  801ca2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ca5:	50                   	push   %eax
+  801ca6:	68 58 1c 80 00       	push   $0x801c58
+  801cab:	e8 6b eb ff ff       	call   80081b <vprintfmt>
+  801cb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cb3:	c9                   	leave
+  801cb4:	c3                   	ret
+
+00801cb5 <bprintf>:
+  801cb5:	55                   	push   %ebp
+  801cb6:	89 e5                	mov    %esp,%ebp
+  801cb8:	83 ec 10             	sub    $0x10,%esp
+  801cbb:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801cbe:	50                   	push   %eax
+  801cbf:	ff 75 08             	push   0x8(%ebp)
+  801cc2:	e8 c8 ff ff ff       	call   801c8f <vbprintf>
+  801cc7:	c9                   	leave
+  801cc8:	c3                   	ret
+
+00801cc9 <bwrite>:
+  801cc9:	55                   	push   %ebp
+  801cca:	89 e5                	mov    %esp,%ebp
+  801ccc:	53                   	push   %ebx
+  801ccd:	83 ec 04             	sub    $0x4,%esp
+  801cd0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801cd3:	89 d8                	mov    %ebx,%eax
+  801cd5:	03 05 e0 30 80 00    	add    0x8030e0,%eax
+  801cdb:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ce0:	76 0d                	jbe    801cef <bwrite+0x26>
+  801ce2:	e8 47 ff ff ff       	call   801c2e <bflush>
+  801ce7:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801ced:	77 25                	ja     801d14 <bwrite+0x4b>
+  801cef:	83 ec 04             	sub    $0x4,%esp
+  801cf2:	53                   	push   %ebx
+  801cf3:	ff 75 08             	push   0x8(%ebp)
+  801cf6:	a1 e0 30 80 00       	mov    0x8030e0,%eax
+  801cfb:	05 e4 30 80 00       	add    $0x8030e4,%eax
+  801d00:	50                   	push   %eax
+  801d01:	e8 80 f2 ff ff       	call   800f86 <memcpy>
+  801d06:	01 1d e0 30 80 00    	add    %ebx,0x8030e0
+  801d0c:	83 c4 10             	add    $0x10,%esp
+  801d0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d12:	c9                   	leave
+  801d13:	c3                   	ret
+  801d14:	83 ec 08             	sub    $0x8,%esp
+  801d17:	53                   	push   %ebx
+  801d18:	ff 75 08             	push   0x8(%ebp)
+  801d1b:	e8 68 f4 ff ff       	call   801188 <sys_cputs>
+  801d20:	83 c4 10             	add    $0x10,%esp
+  801d23:	eb ea                	jmp    801d0f <bwrite+0x46>
+
+00801d25 <__udivdi3>:
+  801d25:	57                   	push   %edi
+  801d26:	56                   	push   %esi
+  801d27:	53                   	push   %ebx
+  801d28:	83 ec 20             	sub    $0x20,%esp
+  801d2b:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801d2f:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801d33:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801d37:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801d3b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801d3f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801d43:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801d47:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801d4b:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801d4f:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801d53:	89 d1                	mov    %edx,%ecx
+  801d55:	09 c1                	or     %eax,%ecx
+  801d57:	0f 84 91 00 00 00    	je     801dee <__udivdi3+0xc9>
+  801d5d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801d64:	00 
+  801d65:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801d6c:	00 
+  801d6d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801d72:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d77:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d7c:	eb 08                	jmp    801d86 <__udivdi3+0x61>
+  801d7e:	83 e9 01             	sub    $0x1,%ecx
+  801d81:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801d84:	74 68                	je     801dee <__udivdi3+0xc9>
+  801d86:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801d8a:	01 c0                	add    %eax,%eax
+  801d8c:	89 c6                	mov    %eax,%esi
+  801d8e:	89 d7                	mov    %edx,%edi
+  801d90:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801d94:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801d98:	0f ad d0             	shrd   %cl,%edx,%eax
+  801d9b:	d3 ea                	shr    %cl,%edx
+  801d9d:	f6 c1 20             	test   $0x20,%cl
+  801da0:	74 04                	je     801da6 <__udivdi3+0x81>
+  801da2:	89 d0                	mov    %edx,%eax
+  801da4:	31 d2                	xor    %edx,%edx
+  801da6:	83 e0 01             	and    $0x1,%eax
+  801da9:	89 04 24             	mov    %eax,(%esp)
+  801dac:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801db3:	00 
+  801db4:	8b 04 24             	mov    (%esp),%eax
+  801db7:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801dbb:	09 f0                	or     %esi,%eax
+  801dbd:	09 fa                	or     %edi,%edx
+  801dbf:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801dc3:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801dc7:	39 f0                	cmp    %esi,%eax
+  801dc9:	89 d3                	mov    %edx,%ebx
+  801dcb:	19 fb                	sbb    %edi,%ebx
+  801dcd:	72 af                	jb     801d7e <__udivdi3+0x59>
+  801dcf:	29 f0                	sub    %esi,%eax
+  801dd1:	19 fa                	sbb    %edi,%edx
+  801dd3:	89 cf                	mov    %ecx,%edi
+  801dd5:	c1 ef 05             	shr    $0x5,%edi
+  801dd8:	83 e7 01             	and    $0x1,%edi
+  801ddb:	89 fe                	mov    %edi,%esi
+  801ddd:	83 f6 01             	xor    $0x1,%esi
+  801de0:	d3 e6                	shl    %cl,%esi
+  801de2:	d3 e7                	shl    %cl,%edi
+  801de4:	09 74 24 18          	or     %esi,0x18(%esp)
+  801de8:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  801dec:	eb 90                	jmp    801d7e <__udivdi3+0x59>
+  801dee:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801df2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  801df6:	83 c4 20             	add    $0x20,%esp
+  801df9:	5b                   	pop    %ebx
+  801dfa:	5e                   	pop    %esi
+  801dfb:	5f                   	pop    %edi
+  801dfc:	c3                   	ret
+
+00801dfd <__umoddi3>:
+  801dfd:	55                   	push   %ebp
+  801dfe:	57                   	push   %edi
+  801dff:	56                   	push   %esi
+  801e00:	53                   	push   %ebx
+  801e01:	83 ec 1c             	sub    $0x1c,%esp
+  801e04:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801e08:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801e0c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801e10:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801e14:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801e18:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801e1c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801e20:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801e24:	89 d6                	mov    %edx,%esi
+  801e26:	09 c6                	or     %eax,%esi
+  801e28:	74 6c                	je     801e96 <__umoddi3+0x99>
+  801e2a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e39:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801e3d:	eb 0e                	jmp    801e4d <__umoddi3+0x50>
+  801e3f:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801e44:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801e48:	83 fe ff             	cmp    $0xffffffff,%esi
+  801e4b:	74 49                	je     801e96 <__umoddi3+0x99>
+  801e4d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801e51:	01 c0                	add    %eax,%eax
+  801e53:	89 c3                	mov    %eax,%ebx
+  801e55:	89 d6                	mov    %edx,%esi
+  801e57:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801e5b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801e5f:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801e64:	0f ad d0             	shrd   %cl,%edx,%eax
+  801e67:	d3 ea                	shr    %cl,%edx
+  801e69:	f6 c1 20             	test   $0x20,%cl
+  801e6c:	74 04                	je     801e72 <__umoddi3+0x75>
+  801e6e:	89 d0                	mov    %edx,%eax
+  801e70:	31 d2                	xor    %edx,%edx
+  801e72:	83 e0 01             	and    $0x1,%eax
+  801e75:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801e7a:	89 ea                	mov    %ebp,%edx
+  801e7c:	09 d8                	or     %ebx,%eax
+  801e7e:	09 f2                	or     %esi,%edx
+  801e80:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801e84:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801e88:	39 d8                	cmp    %ebx,%eax
+  801e8a:	89 d1                	mov    %edx,%ecx
+  801e8c:	19 f1                	sbb    %esi,%ecx
+  801e8e:	72 af                	jb     801e3f <__umoddi3+0x42>
+  801e90:	29 d8                	sub    %ebx,%eax
+  801e92:	19 f2                	sbb    %esi,%edx
+  801e94:	eb a9                	jmp    801e3f <__umoddi3+0x42>
+  801e96:	83 c4 1c             	add    $0x1c,%esp
+  801e99:	5b                   	pop    %ebx
+  801e9a:	5e                   	pop    %esi
+  801e9b:	5f                   	pop    %edi
+  801e9c:	5d                   	pop    %ebp
+  801e9d:	c3                   	ret
+
+00801e9e <__divdi3>:
+  801e9e:	53                   	push   %ebx
+  801e9f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801ea3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801ea7:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801eab:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801eaf:	85 d2                	test   %edx,%edx
+  801eb1:	78 12                	js     801ec5 <__divdi3+0x27>
+  801eb3:	85 db                	test   %ebx,%ebx
+  801eb5:	78 2e                	js     801ee5 <__divdi3+0x47>
+  801eb7:	53                   	push   %ebx
+  801eb8:	51                   	push   %ecx
+  801eb9:	52                   	push   %edx
+  801eba:	50                   	push   %eax
+  801ebb:	e8 65 fe ff ff       	call   801d25 <__udivdi3>
+  801ec0:	83 c4 10             	add    $0x10,%esp
+  801ec3:	eb 1e                	jmp    801ee3 <__divdi3+0x45>
+  801ec5:	f7 d8                	neg    %eax
+  801ec7:	83 d2 00             	adc    $0x0,%edx
+  801eca:	f7 da                	neg    %edx
+  801ecc:	85 db                	test   %ebx,%ebx
+  801ece:	78 2a                	js     801efa <__divdi3+0x5c>
+  801ed0:	53                   	push   %ebx
+  801ed1:	51                   	push   %ecx
+  801ed2:	52                   	push   %edx
+  801ed3:	50                   	push   %eax
+  801ed4:	e8 4c fe ff ff       	call   801d25 <__udivdi3>
+  801ed9:	83 c4 10             	add    $0x10,%esp
+  801edc:	f7 d8                	neg    %eax
+  801ede:	83 d2 00             	adc    $0x0,%edx
+  801ee1:	f7 da                	neg    %edx
+  801ee3:	5b                   	pop    %ebx
+  801ee4:	c3                   	ret
+  801ee5:	f7 d9                	neg    %ecx
+  801ee7:	83 d3 00             	adc    $0x0,%ebx
+  801eea:	f7 db                	neg    %ebx
+  801eec:	53                   	push   %ebx
+  801eed:	51                   	push   %ecx
+  801eee:	52                   	push   %edx
+  801eef:	50                   	push   %eax
+  801ef0:	e8 30 fe ff ff       	call   801d25 <__udivdi3>
+  801ef5:	83 c4 10             	add    $0x10,%esp
+  801ef8:	eb e2                	jmp    801edc <__divdi3+0x3e>
+  801efa:	f7 d9                	neg    %ecx
+  801efc:	83 d3 00             	adc    $0x0,%ebx
+  801eff:	f7 db                	neg    %ebx
+  801f01:	53                   	push   %ebx
+  801f02:	51                   	push   %ecx
+  801f03:	52                   	push   %edx
+  801f04:	50                   	push   %eax
+  801f05:	e8 1b fe ff ff       	call   801d25 <__udivdi3>
+  801f0a:	83 c4 10             	add    $0x10,%esp
+  801f0d:	eb d4                	jmp    801ee3 <__divdi3+0x45>
+
+00801f0f <__moddi3>:
+  801f0f:	55                   	push   %ebp
+  801f10:	57                   	push   %edi
+  801f11:	56                   	push   %esi
+  801f12:	53                   	push   %ebx
+  801f13:	83 ec 14             	sub    $0x14,%esp
+  801f16:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801f1a:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801f1e:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801f22:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801f26:	85 ed                	test   %ebp,%ebp
+  801f28:	78 2b                	js     801f55 <__moddi3+0x46>
+  801f2a:	89 c6                	mov    %eax,%esi
+  801f2c:	f7 de                	neg    %esi
+  801f2e:	89 34 24             	mov    %esi,(%esp)
+  801f31:	89 d6                	mov    %edx,%esi
+  801f33:	83 d6 00             	adc    $0x0,%esi
+  801f36:	f7 de                	neg    %esi
+  801f38:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801f3c:	8b 34 24             	mov    (%esp),%esi
+  801f3f:	0f 48 f0             	cmovs  %eax,%esi
+  801f42:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801f47:	52                   	push   %edx
+  801f48:	56                   	push   %esi
+  801f49:	55                   	push   %ebp
+  801f4a:	57                   	push   %edi
+  801f4b:	e8 ad fe ff ff       	call   801dfd <__umoddi3>
+  801f50:	83 c4 10             	add    $0x10,%esp
+  801f53:	eb 3c                	jmp    801f91 <__moddi3+0x82>
+  801f55:	89 c3                	mov    %eax,%ebx
+  801f57:	f7 db                	neg    %ebx
+  801f59:	89 d1                	mov    %edx,%ecx
+  801f5b:	83 d1 00             	adc    $0x0,%ecx
+  801f5e:	f7 d9                	neg    %ecx
+  801f60:	0f 49 c3             	cmovns %ebx,%eax
+  801f63:	89 04 24             	mov    %eax,(%esp)
+  801f66:	0f 49 d1             	cmovns %ecx,%edx
+  801f69:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801f6d:	ff 74 24 04          	push   0x4(%esp)
+  801f71:	ff 74 24 04          	push   0x4(%esp)
+  801f75:	89 f8                	mov    %edi,%eax
+  801f77:	89 ea                	mov    %ebp,%edx
+  801f79:	f7 d8                	neg    %eax
+  801f7b:	83 d2 00             	adc    $0x0,%edx
+  801f7e:	f7 da                	neg    %edx
+  801f80:	52                   	push   %edx
+  801f81:	50                   	push   %eax
+  801f82:	e8 76 fe ff ff       	call   801dfd <__umoddi3>
+  801f87:	83 c4 10             	add    $0x10,%esp
+  801f8a:	f7 d8                	neg    %eax
+  801f8c:	83 d2 00             	adc    $0x0,%edx
+  801f8f:	f7 da                	neg    %edx
+  801f91:	83 c4 14             	add    $0x14,%esp
+  801f94:	5b                   	pop    %ebx
+  801f95:	5e                   	pop    %esi
+  801f96:	5f                   	pop    %edi
+  801f97:	5d                   	pop    %ebp
+  801f98:	c3                   	ret
@@ -0,0 +1,2568 @@
+
+obj/user/faultwritekernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 0d 00 00 00       	call   80003e <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	c7 05 00 00 10 f0 00 	movl   $0x0,0xf0100000
+  80003a:	00 00 00 
+  80003d:	c3                   	ret
+
+0080003e <libmain>:
+  80003e:	55                   	push   %ebp
+  80003f:	89 e5                	mov    %esp,%ebp
+  800041:	56                   	push   %esi
+  800042:	53                   	push   %ebx
+  800043:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800046:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800049:	e8 cb 09 00 00       	call   800a19 <uinfo_envid>
+  80004e:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  800053:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  800059:	05 00 00 00 ed       	add    $0xed000000,%eax
+  80005e:	a3 20 20 80 00       	mov    %eax,0x802020
+  800063:	85 db                	test   %ebx,%ebx
+  800065:	7e 07                	jle    80006e <libmain+0x30>
+  800067:	8b 06                	mov    (%esi),%eax
+  800069:	a3 00 20 80 00       	mov    %eax,0x802000
+  80006e:	83 ec 08             	sub    $0x8,%esp
+  800071:	56                   	push   %esi
+  800072:	53                   	push   %ebx
+  800073:	e8 bb ff ff ff       	call   800033 <umain>
+  800078:	e8 0a 00 00 00       	call   800087 <exit>
+  80007d:	83 c4 10             	add    $0x10,%esp
+  800080:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800083:	5b                   	pop    %ebx
+  800084:	5e                   	pop    %esi
+  800085:	5d                   	pop    %ebp
+  800086:	c3                   	ret
+
+00800087 <exit>:
+  800087:	55                   	push   %ebp
+  800088:	89 e5                	mov    %esp,%ebp
+  80008a:	83 ec 08             	sub    $0x8,%esp
+  80008d:	e8 20 0a 00 00       	call   800ab2 <bflush>
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	6a 00                	push   $0x0
+  800097:	e8 d3 00 00 00       	call   80016f <sys_env_destroy>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	c9                   	leave
+  8000a0:	c3                   	ret
+
+008000a1 <sys_cputs>:
+  8000a1:	55                   	push   %ebp
+  8000a2:	89 e5                	mov    %esp,%ebp
+  8000a4:	57                   	push   %edi
+  8000a5:	56                   	push   %esi
+  8000a6:	53                   	push   %ebx
+  8000a7:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000ae:	78 21                	js     8000d1 <sys_cputs+0x30>
+  8000b0:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000b7:	75 2d                	jne    8000e6 <sys_cputs+0x45>
+  8000b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000c4:	89 c3                	mov    %eax,%ebx
+  8000c6:	89 c7                	mov    %eax,%edi
+  8000c8:	89 c6                	mov    %eax,%esi
+  8000ca:	cd 30                	int    $0x30
+  8000cc:	5b                   	pop    %ebx
+  8000cd:	5e                   	pop    %esi
+  8000ce:	5f                   	pop    %edi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+  8000d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d6:	0f a2                	cpuid
+  8000d8:	c1 ea 0b             	shr    $0xb,%edx
+  8000db:	83 e2 01             	and    $0x1,%edx
+  8000de:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8000e4:	eb ca                	jmp    8000b0 <sys_cputs+0xf>
+  8000e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000f1:	89 c3                	mov    %eax,%ebx
+  8000f3:	89 c7                	mov    %eax,%edi
+  8000f5:	89 c6                	mov    %eax,%esi
+  8000f7:	55                   	push   %ebp
+  8000f8:	68 01 01 80 00       	push   $0x800101
+  8000fd:	89 e5                	mov    %esp,%ebp
+  8000ff:	0f 34                	sysenter
+  800101:	83 c4 04             	add    $0x4,%esp
+  800104:	5d                   	pop    %ebp
+  800105:	eb c5                	jmp    8000cc <sys_cputs+0x2b>
+
+00800107 <sys_cgetc>:
+  800107:	55                   	push   %ebp
+  800108:	89 e5                	mov    %esp,%ebp
+  80010a:	57                   	push   %edi
+  80010b:	56                   	push   %esi
+  80010c:	53                   	push   %ebx
+  80010d:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800114:	78 22                	js     800138 <sys_cgetc+0x31>
+  800116:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80011d:	75 2e                	jne    80014d <sys_cgetc+0x46>
+  80011f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800124:	b8 01 00 00 00       	mov    $0x1,%eax
+  800129:	89 d1                	mov    %edx,%ecx
+  80012b:	89 d3                	mov    %edx,%ebx
+  80012d:	89 d7                	mov    %edx,%edi
+  80012f:	89 d6                	mov    %edx,%esi
+  800131:	cd 30                	int    $0x30
+  800133:	5b                   	pop    %ebx
+  800134:	5e                   	pop    %esi
+  800135:	5f                   	pop    %edi
+  800136:	5d                   	pop    %ebp
+  800137:	c3                   	ret
+  800138:	b8 01 00 00 00       	mov    $0x1,%eax
+  80013d:	0f a2                	cpuid
+  80013f:	c1 ea 0b             	shr    $0xb,%edx
+  800142:	83 e2 01             	and    $0x1,%edx
+  800145:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80014b:	eb c9                	jmp    800116 <sys_cgetc+0xf>
+  80014d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800152:	b8 01 00 00 00       	mov    $0x1,%eax
+  800157:	89 d1                	mov    %edx,%ecx
+  800159:	89 d3                	mov    %edx,%ebx
+  80015b:	89 d7                	mov    %edx,%edi
+  80015d:	89 d6                	mov    %edx,%esi
+  80015f:	55                   	push   %ebp
+  800160:	68 69 01 80 00       	push   $0x800169
+  800165:	89 e5                	mov    %esp,%ebp
+  800167:	0f 34                	sysenter
+  800169:	83 c4 04             	add    $0x4,%esp
+  80016c:	5d                   	pop    %ebp
+  80016d:	eb c4                	jmp    800133 <sys_cgetc+0x2c>
+
+0080016f <sys_env_destroy>:
+  80016f:	55                   	push   %ebp
+  800170:	89 e5                	mov    %esp,%ebp
+  800172:	57                   	push   %edi
+  800173:	56                   	push   %esi
+  800174:	53                   	push   %ebx
+  800175:	83 ec 0c             	sub    $0xc,%esp
+  800178:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80017f:	78 2a                	js     8001ab <sys_env_destroy+0x3c>
+  800181:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800188:	75 36                	jne    8001c0 <sys_env_destroy+0x51>
+  80018a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80018f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800194:	8b 55 08             	mov    0x8(%ebp),%edx
+  800197:	89 cb                	mov    %ecx,%ebx
+  800199:	89 cf                	mov    %ecx,%edi
+  80019b:	89 ce                	mov    %ecx,%esi
+  80019d:	cd 30                	int    $0x30
+  80019f:	85 c0                	test   %eax,%eax
+  8001a1:	7f 40                	jg     8001e3 <sys_env_destroy+0x74>
+  8001a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a6:	5b                   	pop    %ebx
+  8001a7:	5e                   	pop    %esi
+  8001a8:	5f                   	pop    %edi
+  8001a9:	5d                   	pop    %ebp
+  8001aa:	c3                   	ret
+  8001ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001b0:	0f a2                	cpuid
+  8001b2:	c1 ea 0b             	shr    $0xb,%edx
+  8001b5:	83 e2 01             	and    $0x1,%edx
+  8001b8:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8001be:	eb c1                	jmp    800181 <sys_env_destroy+0x12>
+  8001c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001c8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8001cd:	89 cb                	mov    %ecx,%ebx
+  8001cf:	89 cf                	mov    %ecx,%edi
+  8001d1:	89 ce                	mov    %ecx,%esi
+  8001d3:	55                   	push   %ebp
+  8001d4:	68 dd 01 80 00       	push   $0x8001dd
+  8001d9:	89 e5                	mov    %esp,%ebp
+  8001db:	0f 34                	sysenter
+  8001dd:	83 c4 04             	add    $0x4,%esp
+  8001e0:	5d                   	pop    %ebp
+  8001e1:	eb bc                	jmp    80019f <sys_env_destroy+0x30>
+  8001e3:	83 ec 0c             	sub    $0xc,%esp
+  8001e6:	50                   	push   %eax
+  8001e7:	6a 03                	push   $0x3
+  8001e9:	68 8a 19 80 00       	push   $0x80198a
+  8001ee:	6a 49                	push   $0x49
+  8001f0:	68 a7 19 80 00       	push   $0x8019a7
+  8001f5:	e8 af 09 00 00       	call   800ba9 <_panic>
+
+008001fa <sys_getenvid>:
+  8001fa:	55                   	push   %ebp
+  8001fb:	89 e5                	mov    %esp,%ebp
+  8001fd:	57                   	push   %edi
+  8001fe:	56                   	push   %esi
+  8001ff:	53                   	push   %ebx
+  800200:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800207:	78 22                	js     80022b <sys_getenvid+0x31>
+  800209:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800210:	75 2e                	jne    800240 <sys_getenvid+0x46>
+  800212:	ba 00 00 00 00       	mov    $0x0,%edx
+  800217:	b8 02 00 00 00       	mov    $0x2,%eax
+  80021c:	89 d1                	mov    %edx,%ecx
+  80021e:	89 d3                	mov    %edx,%ebx
+  800220:	89 d7                	mov    %edx,%edi
+  800222:	89 d6                	mov    %edx,%esi
+  800224:	cd 30                	int    $0x30
+  800226:	5b                   	pop    %ebx
+  800227:	5e                   	pop    %esi
+  800228:	5f                   	pop    %edi
+  800229:	5d                   	pop    %ebp
+  80022a:	c3                   	ret
+  80022b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800230:	0f a2                	cpuid
+  800232:	c1 ea 0b             	shr    $0xb,%edx
+  800235:	83 e2 01             	and    $0x1,%edx
+  800238:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80023e:	eb c9                	jmp    800209 <sys_getenvid+0xf>
+  800240:	ba 00 00 00 00       	mov    $0x0,%edx
+  800245:	b8 02 00 00 00       	mov    $0x2,%eax
+  80024a:	89 d1                	mov    %edx,%ecx
+  80024c:	89 d3                	mov    %edx,%ebx
+  80024e:	89 d7                	mov    %edx,%edi
+  800250:	89 d6                	mov    %edx,%esi
+  800252:	55                   	push   %ebp
+  800253:	68 5c 02 80 00       	push   $0x80025c
+  800258:	89 e5                	mov    %esp,%ebp
+  80025a:	0f 34                	sysenter
+  80025c:	83 c4 04             	add    $0x4,%esp
+  80025f:	5d                   	pop    %ebp
+  800260:	eb c4                	jmp    800226 <sys_getenvid+0x2c>
+
+00800262 <sys_yield>:
+  800262:	55                   	push   %ebp
+  800263:	89 e5                	mov    %esp,%ebp
+  800265:	57                   	push   %edi
+  800266:	56                   	push   %esi
+  800267:	53                   	push   %ebx
+  800268:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80026f:	78 22                	js     800293 <sys_yield+0x31>
+  800271:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800278:	75 2e                	jne    8002a8 <sys_yield+0x46>
+  80027a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80027f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800284:	89 d1                	mov    %edx,%ecx
+  800286:	89 d3                	mov    %edx,%ebx
+  800288:	89 d7                	mov    %edx,%edi
+  80028a:	89 d6                	mov    %edx,%esi
+  80028c:	cd 30                	int    $0x30
+  80028e:	5b                   	pop    %ebx
+  80028f:	5e                   	pop    %esi
+  800290:	5f                   	pop    %edi
+  800291:	5d                   	pop    %ebp
+  800292:	c3                   	ret
+  800293:	b8 01 00 00 00       	mov    $0x1,%eax
+  800298:	0f a2                	cpuid
+  80029a:	c1 ea 0b             	shr    $0xb,%edx
+  80029d:	83 e2 01             	and    $0x1,%edx
+  8002a0:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8002a6:	eb c9                	jmp    800271 <sys_yield+0xf>
+  8002a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ad:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002b2:	89 d1                	mov    %edx,%ecx
+  8002b4:	89 d3                	mov    %edx,%ebx
+  8002b6:	89 d7                	mov    %edx,%edi
+  8002b8:	89 d6                	mov    %edx,%esi
+  8002ba:	55                   	push   %ebp
+  8002bb:	68 c4 02 80 00       	push   $0x8002c4
+  8002c0:	89 e5                	mov    %esp,%ebp
+  8002c2:	0f 34                	sysenter
+  8002c4:	83 c4 04             	add    $0x4,%esp
+  8002c7:	5d                   	pop    %ebp
+  8002c8:	eb c4                	jmp    80028e <sys_yield+0x2c>
+
+008002ca <sys_env_set_cow>:
+  8002ca:	55                   	push   %ebp
+  8002cb:	89 e5                	mov    %esp,%ebp
+  8002cd:	57                   	push   %edi
+  8002ce:	56                   	push   %esi
+  8002cf:	53                   	push   %ebx
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+  8002d3:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8002da:	78 2b                	js     800307 <sys_env_set_cow+0x3d>
+  8002dc:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8002e3:	75 37                	jne    80031c <sys_env_set_cow+0x52>
+  8002e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ea:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8002ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f5:	89 df                	mov    %ebx,%edi
+  8002f7:	89 de                	mov    %ebx,%esi
+  8002f9:	cd 30                	int    $0x30
+  8002fb:	85 c0                	test   %eax,%eax
+  8002fd:	7f 41                	jg     800340 <sys_env_set_cow+0x76>
+  8002ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800302:	5b                   	pop    %ebx
+  800303:	5e                   	pop    %esi
+  800304:	5f                   	pop    %edi
+  800305:	5d                   	pop    %ebp
+  800306:	c3                   	ret
+  800307:	b8 01 00 00 00       	mov    $0x1,%eax
+  80030c:	0f a2                	cpuid
+  80030e:	c1 ea 0b             	shr    $0xb,%edx
+  800311:	83 e2 01             	and    $0x1,%edx
+  800314:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80031a:	eb c0                	jmp    8002dc <sys_env_set_cow+0x12>
+  80031c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800321:	8b 55 08             	mov    0x8(%ebp),%edx
+  800324:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800327:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80032c:	89 df                	mov    %ebx,%edi
+  80032e:	89 de                	mov    %ebx,%esi
+  800330:	55                   	push   %ebp
+  800331:	68 3a 03 80 00       	push   $0x80033a
+  800336:	89 e5                	mov    %esp,%ebp
+  800338:	0f 34                	sysenter
+  80033a:	83 c4 04             	add    $0x4,%esp
+  80033d:	5d                   	pop    %ebp
+  80033e:	eb bb                	jmp    8002fb <sys_env_set_cow+0x31>
+  800340:	83 ec 0c             	sub    $0xc,%esp
+  800343:	50                   	push   %eax
+  800344:	6a 0d                	push   $0xd
+  800346:	68 8a 19 80 00       	push   $0x80198a
+  80034b:	6a 49                	push   $0x49
+  80034d:	68 a7 19 80 00       	push   $0x8019a7
+  800352:	e8 52 08 00 00       	call   800ba9 <_panic>
+
+00800357 <sys_env_set_quota>:
+  800357:	55                   	push   %ebp
+  800358:	89 e5                	mov    %esp,%ebp
+  80035a:	57                   	push   %edi
+  80035b:	56                   	push   %esi
+  80035c:	53                   	push   %ebx
+  80035d:	83 ec 0c             	sub    $0xc,%esp
+  800360:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800367:	78 2b                	js     800394 <sys_env_set_quota+0x3d>
+  800369:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800370:	75 37                	jne    8003a9 <sys_env_set_quota+0x52>
+  800372:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800377:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80037c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80037f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800382:	89 df                	mov    %ebx,%edi
+  800384:	89 de                	mov    %ebx,%esi
+  800386:	cd 30                	int    $0x30
+  800388:	85 c0                	test   %eax,%eax
+  80038a:	7f 41                	jg     8003cd <sys_env_set_quota+0x76>
+  80038c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80038f:	5b                   	pop    %ebx
+  800390:	5e                   	pop    %esi
+  800391:	5f                   	pop    %edi
+  800392:	5d                   	pop    %ebp
+  800393:	c3                   	ret
+  800394:	b8 01 00 00 00       	mov    $0x1,%eax
+  800399:	0f a2                	cpuid
+  80039b:	c1 ea 0b             	shr    $0xb,%edx
+  80039e:	83 e2 01             	and    $0x1,%edx
+  8003a1:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8003a7:	eb c0                	jmp    800369 <sys_env_set_quota+0x12>
+  8003a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003b4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003b9:	89 df                	mov    %ebx,%edi
+  8003bb:	89 de                	mov    %ebx,%esi
+  8003bd:	55                   	push   %ebp
+  8003be:	68 c7 03 80 00       	push   $0x8003c7
+  8003c3:	89 e5                	mov    %esp,%ebp
+  8003c5:	0f 34                	sysenter
+  8003c7:	83 c4 04             	add    $0x4,%esp
+  8003ca:	5d                   	pop    %ebp
+  8003cb:	eb bb                	jmp    800388 <sys_env_set_quota+0x31>
+  8003cd:	83 ec 0c             	sub    $0xc,%esp
+  8003d0:	50                   	push   %eax
+  8003d1:	6a 0f                	push   $0xf
+  8003d3:	68 8a 19 80 00       	push   $0x80198a
+  8003d8:	6a 49                	push   $0x49
+  8003da:	68 a7 19 80 00       	push   $0x8019a7
+  8003df:	e8 c5 07 00 00       	call   800ba9 <_panic>
+
+008003e4 <sys_page_alloc>:
+  8003e4:	55                   	push   %ebp
+  8003e5:	89 e5                	mov    %esp,%ebp
+  8003e7:	57                   	push   %edi
+  8003e8:	56                   	push   %esi
+  8003e9:	53                   	push   %ebx
+  8003ea:	83 ec 0c             	sub    $0xc,%esp
+  8003ed:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8003f4:	78 2c                	js     800422 <sys_page_alloc+0x3e>
+  8003f6:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8003fd:	75 38                	jne    800437 <sys_page_alloc+0x53>
+  8003ff:	be 00 00 00 00       	mov    $0x0,%esi
+  800404:	b8 04 00 00 00       	mov    $0x4,%eax
+  800409:	8b 55 08             	mov    0x8(%ebp),%edx
+  80040c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80040f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800412:	89 f7                	mov    %esi,%edi
+  800414:	cd 30                	int    $0x30
+  800416:	85 c0                	test   %eax,%eax
+  800418:	7f 42                	jg     80045c <sys_page_alloc+0x78>
+  80041a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80041d:	5b                   	pop    %ebx
+  80041e:	5e                   	pop    %esi
+  80041f:	5f                   	pop    %edi
+  800420:	5d                   	pop    %ebp
+  800421:	c3                   	ret
+  800422:	b8 01 00 00 00       	mov    $0x1,%eax
+  800427:	0f a2                	cpuid
+  800429:	c1 ea 0b             	shr    $0xb,%edx
+  80042c:	83 e2 01             	and    $0x1,%edx
+  80042f:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800435:	eb bf                	jmp    8003f6 <sys_page_alloc+0x12>
+  800437:	be 00 00 00 00       	mov    $0x0,%esi
+  80043c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80043f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800442:	b8 04 00 00 00       	mov    $0x4,%eax
+  800447:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80044a:	89 f7                	mov    %esi,%edi
+  80044c:	55                   	push   %ebp
+  80044d:	68 56 04 80 00       	push   $0x800456
+  800452:	89 e5                	mov    %esp,%ebp
+  800454:	0f 34                	sysenter
+  800456:	83 c4 04             	add    $0x4,%esp
+  800459:	5d                   	pop    %ebp
+  80045a:	eb ba                	jmp    800416 <sys_page_alloc+0x32>
+  80045c:	83 ec 0c             	sub    $0xc,%esp
+  80045f:	50                   	push   %eax
+  800460:	6a 04                	push   $0x4
+  800462:	68 8a 19 80 00       	push   $0x80198a
+  800467:	6a 49                	push   $0x49
+  800469:	68 a7 19 80 00       	push   $0x8019a7
+  80046e:	e8 36 07 00 00       	call   800ba9 <_panic>
+
+00800473 <sys_page_map>:
+  800473:	55                   	push   %ebp
+  800474:	89 e5                	mov    %esp,%ebp
+  800476:	57                   	push   %edi
+  800477:	56                   	push   %esi
+  800478:	53                   	push   %ebx
+  800479:	83 ec 0c             	sub    $0xc,%esp
+  80047c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800483:	78 2b                	js     8004b0 <sys_page_map+0x3d>
+  800485:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80048c:	75 37                	jne    8004c5 <sys_page_map+0x52>
+  80048e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800493:	8b 55 08             	mov    0x8(%ebp),%edx
+  800496:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800499:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80049c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80049f:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004a2:	cd 30                	int    $0x30
+  8004a4:	85 c0                	test   %eax,%eax
+  8004a6:	7f 41                	jg     8004e9 <sys_page_map+0x76>
+  8004a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004ab:	5b                   	pop    %ebx
+  8004ac:	5e                   	pop    %esi
+  8004ad:	5f                   	pop    %edi
+  8004ae:	5d                   	pop    %ebp
+  8004af:	c3                   	ret
+  8004b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004b5:	0f a2                	cpuid
+  8004b7:	c1 ea 0b             	shr    $0xb,%edx
+  8004ba:	83 e2 01             	and    $0x1,%edx
+  8004bd:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8004c3:	eb c0                	jmp    800485 <sys_page_map+0x12>
+  8004c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004cb:	b8 05 00 00 00       	mov    $0x5,%eax
+  8004d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004d3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004d6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004d9:	55                   	push   %ebp
+  8004da:	68 e3 04 80 00       	push   $0x8004e3
+  8004df:	89 e5                	mov    %esp,%ebp
+  8004e1:	0f 34                	sysenter
+  8004e3:	83 c4 04             	add    $0x4,%esp
+  8004e6:	5d                   	pop    %ebp
+  8004e7:	eb bb                	jmp    8004a4 <sys_page_map+0x31>
+  8004e9:	83 ec 0c             	sub    $0xc,%esp
+  8004ec:	50                   	push   %eax
+  8004ed:	6a 05                	push   $0x5
+  8004ef:	68 8a 19 80 00       	push   $0x80198a
+  8004f4:	6a 49                	push   $0x49
+  8004f6:	68 a7 19 80 00       	push   $0x8019a7
+  8004fb:	e8 a9 06 00 00       	call   800ba9 <_panic>
+
+00800500 <sys_page_unmap>:
+  800500:	55                   	push   %ebp
+  800501:	89 e5                	mov    %esp,%ebp
+  800503:	57                   	push   %edi
+  800504:	56                   	push   %esi
+  800505:	53                   	push   %ebx
+  800506:	83 ec 0c             	sub    $0xc,%esp
+  800509:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800510:	78 2b                	js     80053d <sys_page_unmap+0x3d>
+  800512:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800519:	75 37                	jne    800552 <sys_page_unmap+0x52>
+  80051b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800520:	b8 06 00 00 00       	mov    $0x6,%eax
+  800525:	8b 55 08             	mov    0x8(%ebp),%edx
+  800528:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80052b:	89 df                	mov    %ebx,%edi
+  80052d:	89 de                	mov    %ebx,%esi
+  80052f:	cd 30                	int    $0x30
+  800531:	85 c0                	test   %eax,%eax
+  800533:	7f 41                	jg     800576 <sys_page_unmap+0x76>
+  800535:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800538:	5b                   	pop    %ebx
+  800539:	5e                   	pop    %esi
+  80053a:	5f                   	pop    %edi
+  80053b:	5d                   	pop    %ebp
+  80053c:	c3                   	ret
+  80053d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800542:	0f a2                	cpuid
+  800544:	c1 ea 0b             	shr    $0xb,%edx
+  800547:	83 e2 01             	and    $0x1,%edx
+  80054a:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800550:	eb c0                	jmp    800512 <sys_page_unmap+0x12>
+  800552:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800557:	8b 55 08             	mov    0x8(%ebp),%edx
+  80055a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80055d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800562:	89 df                	mov    %ebx,%edi
+  800564:	89 de                	mov    %ebx,%esi
+  800566:	55                   	push   %ebp
+  800567:	68 70 05 80 00       	push   $0x800570
+  80056c:	89 e5                	mov    %esp,%ebp
+  80056e:	0f 34                	sysenter
+  800570:	83 c4 04             	add    $0x4,%esp
+  800573:	5d                   	pop    %ebp
+  800574:	eb bb                	jmp    800531 <sys_page_unmap+0x31>
+  800576:	83 ec 0c             	sub    $0xc,%esp
+  800579:	50                   	push   %eax
+  80057a:	6a 06                	push   $0x6
+  80057c:	68 8a 19 80 00       	push   $0x80198a
+  800581:	6a 49                	push   $0x49
+  800583:	68 a7 19 80 00       	push   $0x8019a7
+  800588:	e8 1c 06 00 00       	call   800ba9 <_panic>
+
+0080058d <sys_page_reuse>:
+  80058d:	55                   	push   %ebp
+  80058e:	89 e5                	mov    %esp,%ebp
+  800590:	57                   	push   %edi
+  800591:	56                   	push   %esi
+  800592:	53                   	push   %ebx
+  800593:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80059a:	78 24                	js     8005c0 <sys_page_reuse+0x33>
+  80059c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8005a3:	75 30                	jne    8005d5 <sys_page_reuse+0x48>
+  8005a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005aa:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005b5:	89 df                	mov    %ebx,%edi
+  8005b7:	89 de                	mov    %ebx,%esi
+  8005b9:	cd 30                	int    $0x30
+  8005bb:	5b                   	pop    %ebx
+  8005bc:	5e                   	pop    %esi
+  8005bd:	5f                   	pop    %edi
+  8005be:	5d                   	pop    %ebp
+  8005bf:	c3                   	ret
+  8005c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005c5:	0f a2                	cpuid
+  8005c7:	c1 ea 0b             	shr    $0xb,%edx
+  8005ca:	83 e2 01             	and    $0x1,%edx
+  8005cd:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8005d3:	eb c7                	jmp    80059c <sys_page_reuse+0xf>
+  8005d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005e0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005e5:	89 df                	mov    %ebx,%edi
+  8005e7:	89 de                	mov    %ebx,%esi
+  8005e9:	55                   	push   %ebp
+  8005ea:	68 f3 05 80 00       	push   $0x8005f3
+  8005ef:	89 e5                	mov    %esp,%ebp
+  8005f1:	0f 34                	sysenter
+  8005f3:	83 c4 04             	add    $0x4,%esp
+  8005f6:	5d                   	pop    %ebp
+  8005f7:	eb c2                	jmp    8005bb <sys_page_reuse+0x2e>
+
+008005f9 <sys_env_set_status>:
+  8005f9:	55                   	push   %ebp
+  8005fa:	89 e5                	mov    %esp,%ebp
+  8005fc:	57                   	push   %edi
+  8005fd:	56                   	push   %esi
+  8005fe:	53                   	push   %ebx
+  8005ff:	83 ec 0c             	sub    $0xc,%esp
+  800602:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800609:	78 2b                	js     800636 <sys_env_set_status+0x3d>
+  80060b:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800612:	75 37                	jne    80064b <sys_env_set_status+0x52>
+  800614:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800619:	b8 08 00 00 00       	mov    $0x8,%eax
+  80061e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800621:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800624:	89 df                	mov    %ebx,%edi
+  800626:	89 de                	mov    %ebx,%esi
+  800628:	cd 30                	int    $0x30
+  80062a:	85 c0                	test   %eax,%eax
+  80062c:	7f 41                	jg     80066f <sys_env_set_status+0x76>
+  80062e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800631:	5b                   	pop    %ebx
+  800632:	5e                   	pop    %esi
+  800633:	5f                   	pop    %edi
+  800634:	5d                   	pop    %ebp
+  800635:	c3                   	ret
+  800636:	b8 01 00 00 00       	mov    $0x1,%eax
+  80063b:	0f a2                	cpuid
+  80063d:	c1 ea 0b             	shr    $0xb,%edx
+  800640:	83 e2 01             	and    $0x1,%edx
+  800643:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800649:	eb c0                	jmp    80060b <sys_env_set_status+0x12>
+  80064b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800650:	8b 55 08             	mov    0x8(%ebp),%edx
+  800653:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800656:	b8 08 00 00 00       	mov    $0x8,%eax
+  80065b:	89 df                	mov    %ebx,%edi
+  80065d:	89 de                	mov    %ebx,%esi
+  80065f:	55                   	push   %ebp
+  800660:	68 69 06 80 00       	push   $0x800669
+  800665:	89 e5                	mov    %esp,%ebp
+  800667:	0f 34                	sysenter
+  800669:	83 c4 04             	add    $0x4,%esp
+  80066c:	5d                   	pop    %ebp
+  80066d:	eb bb                	jmp    80062a <sys_env_set_status+0x31>
+  80066f:	83 ec 0c             	sub    $0xc,%esp
+  800672:	50                   	push   %eax
+  800673:	6a 08                	push   $0x8
+  800675:	68 8a 19 80 00       	push   $0x80198a
+  80067a:	6a 49                	push   $0x49
+  80067c:	68 a7 19 80 00       	push   $0x8019a7
+  800681:	e8 23 05 00 00       	call   800ba9 <_panic>
+
+00800686 <sys_env_set_pgfault_upcall>:
+  800686:	55                   	push   %ebp
+  800687:	89 e5                	mov    %esp,%ebp
+  800689:	57                   	push   %edi
+  80068a:	56                   	push   %esi
+  80068b:	53                   	push   %ebx
+  80068c:	83 ec 0c             	sub    $0xc,%esp
+  80068f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800696:	78 2b                	js     8006c3 <sys_env_set_pgfault_upcall+0x3d>
+  800698:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80069f:	75 37                	jne    8006d8 <sys_env_set_pgfault_upcall+0x52>
+  8006a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006a6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006b1:	89 df                	mov    %ebx,%edi
+  8006b3:	89 de                	mov    %ebx,%esi
+  8006b5:	cd 30                	int    $0x30
+  8006b7:	85 c0                	test   %eax,%eax
+  8006b9:	7f 41                	jg     8006fc <sys_env_set_pgfault_upcall+0x76>
+  8006bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006be:	5b                   	pop    %ebx
+  8006bf:	5e                   	pop    %esi
+  8006c0:	5f                   	pop    %edi
+  8006c1:	5d                   	pop    %ebp
+  8006c2:	c3                   	ret
+  8006c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006c8:	0f a2                	cpuid
+  8006ca:	c1 ea 0b             	shr    $0xb,%edx
+  8006cd:	83 e2 01             	and    $0x1,%edx
+  8006d0:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8006d6:	eb c0                	jmp    800698 <sys_env_set_pgfault_upcall+0x12>
+  8006d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006e3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006e8:	89 df                	mov    %ebx,%edi
+  8006ea:	89 de                	mov    %ebx,%esi
+  8006ec:	55                   	push   %ebp
+  8006ed:	68 f6 06 80 00       	push   $0x8006f6
+  8006f2:	89 e5                	mov    %esp,%ebp
+  8006f4:	0f 34                	sysenter
+  8006f6:	83 c4 04             	add    $0x4,%esp
+  8006f9:	5d                   	pop    %ebp
+  8006fa:	eb bb                	jmp    8006b7 <sys_env_set_pgfault_upcall+0x31>
+  8006fc:	83 ec 0c             	sub    $0xc,%esp
+  8006ff:	50                   	push   %eax
+  800700:	6a 09                	push   $0x9
+  800702:	68 8a 19 80 00       	push   $0x80198a
+  800707:	6a 49                	push   $0x49
+  800709:	68 a7 19 80 00       	push   $0x8019a7
+  80070e:	e8 96 04 00 00       	call   800ba9 <_panic>
+
+00800713 <sys_env_set_trace>:
+  800713:	55                   	push   %ebp
+  800714:	89 e5                	mov    %esp,%ebp
+  800716:	57                   	push   %edi
+  800717:	56                   	push   %esi
+  800718:	53                   	push   %ebx
+  800719:	83 ec 0c             	sub    $0xc,%esp
+  80071c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800723:	78 2b                	js     800750 <sys_env_set_trace+0x3d>
+  800725:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80072c:	75 37                	jne    800765 <sys_env_set_trace+0x52>
+  80072e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800733:	b8 12 00 00 00       	mov    $0x12,%eax
+  800738:	8b 55 08             	mov    0x8(%ebp),%edx
+  80073b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80073e:	89 df                	mov    %ebx,%edi
+  800740:	89 de                	mov    %ebx,%esi
+  800742:	cd 30                	int    $0x30
+  800744:	85 c0                	test   %eax,%eax
+  800746:	7f 41                	jg     800789 <sys_env_set_trace+0x76>
+  800748:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80074b:	5b                   	pop    %ebx
+  80074c:	5e                   	pop    %esi
+  80074d:	5f                   	pop    %edi
+  80074e:	5d                   	pop    %ebp
+  80074f:	c3                   	ret
+  800750:	b8 01 00 00 00       	mov    $0x1,%eax
+  800755:	0f a2                	cpuid
+  800757:	c1 ea 0b             	shr    $0xb,%edx
+  80075a:	83 e2 01             	and    $0x1,%edx
+  80075d:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800763:	eb c0                	jmp    800725 <sys_env_set_trace+0x12>
+  800765:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80076a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80076d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800770:	b8 12 00 00 00       	mov    $0x12,%eax
+  800775:	89 df                	mov    %ebx,%edi
+  800777:	89 de                	mov    %ebx,%esi
+  800779:	55                   	push   %ebp
+  80077a:	68 83 07 80 00       	push   $0x800783
+  80077f:	89 e5                	mov    %esp,%ebp
+  800781:	0f 34                	sysenter
+  800783:	83 c4 04             	add    $0x4,%esp
+  800786:	5d                   	pop    %ebp
+  800787:	eb bb                	jmp    800744 <sys_env_set_trace+0x31>
+  800789:	83 ec 0c             	sub    $0xc,%esp
+  80078c:	50                   	push   %eax
+  80078d:	6a 12                	push   $0x12
+  80078f:	68 8a 19 80 00       	push   $0x80198a
+  800794:	6a 49                	push   $0x49
+  800796:	68 a7 19 80 00       	push   $0x8019a7
+  80079b:	e8 09 04 00 00       	call   800ba9 <_panic>
+
+008007a0 <sys_env_set_rdpmc>:
+  8007a0:	55                   	push   %ebp
+  8007a1:	89 e5                	mov    %esp,%ebp
+  8007a3:	57                   	push   %edi
+  8007a4:	56                   	push   %esi
+  8007a5:	53                   	push   %ebx
+  8007a6:	83 ec 0c             	sub    $0xc,%esp
+  8007a9:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007b0:	78 2b                	js     8007dd <sys_env_set_rdpmc+0x3d>
+  8007b2:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007b9:	75 37                	jne    8007f2 <sys_env_set_rdpmc+0x52>
+  8007bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007c0:	b8 13 00 00 00       	mov    $0x13,%eax
+  8007c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007cb:	89 df                	mov    %ebx,%edi
+  8007cd:	89 de                	mov    %ebx,%esi
+  8007cf:	cd 30                	int    $0x30
+  8007d1:	85 c0                	test   %eax,%eax
+  8007d3:	7f 41                	jg     800816 <sys_env_set_rdpmc+0x76>
+  8007d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007d8:	5b                   	pop    %ebx
+  8007d9:	5e                   	pop    %esi
+  8007da:	5f                   	pop    %edi
+  8007db:	5d                   	pop    %ebp
+  8007dc:	c3                   	ret
+  8007dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007e2:	0f a2                	cpuid
+  8007e4:	c1 ea 0b             	shr    $0xb,%edx
+  8007e7:	83 e2 01             	and    $0x1,%edx
+  8007ea:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8007f0:	eb c0                	jmp    8007b2 <sys_env_set_rdpmc+0x12>
+  8007f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007fd:	b8 13 00 00 00       	mov    $0x13,%eax
+  800802:	89 df                	mov    %ebx,%edi
+  800804:	89 de                	mov    %ebx,%esi
+  800806:	55                   	push   %ebp
+  800807:	68 10 08 80 00       	push   $0x800810
+  80080c:	89 e5                	mov    %esp,%ebp
+  80080e:	0f 34                	sysenter
+  800810:	83 c4 04             	add    $0x4,%esp
+  800813:	5d                   	pop    %ebp
+  800814:	eb bb                	jmp    8007d1 <sys_env_set_rdpmc+0x31>
+  800816:	83 ec 0c             	sub    $0xc,%esp
+  800819:	50                   	push   %eax
+  80081a:	6a 13                	push   $0x13
+  80081c:	68 8a 19 80 00       	push   $0x80198a
+  800821:	6a 49                	push   $0x49
+  800823:	68 a7 19 80 00       	push   $0x8019a7
+  800828:	e8 7c 03 00 00       	call   800ba9 <_panic>
+
+0080082d <sys_ring_setup>:
+  80082d:	55                   	push   %ebp
+  80082e:	89 e5                	mov    %esp,%ebp
+  800830:	57                   	push   %edi
+  800831:	56                   	push   %esi
+  800832:	53                   	push   %ebx
+  800833:	83 ec 0c             	sub    $0xc,%esp
+  800836:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80083d:	78 29                	js     800868 <sys_ring_setup+0x3b>
+  80083f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800846:	75 35                	jne    80087d <sys_ring_setup+0x50>
+  800848:	ba 00 00 00 00       	mov    $0x0,%edx
+  80084d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800852:	89 d1                	mov    %edx,%ecx
+  800854:	89 d3                	mov    %edx,%ebx
+  800856:	89 d7                	mov    %edx,%edi
+  800858:	89 d6                	mov    %edx,%esi
+  80085a:	cd 30                	int    $0x30
+  80085c:	85 c0                	test   %eax,%eax
+  80085e:	7f 3f                	jg     80089f <sys_ring_setup+0x72>
+  800860:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800863:	5b                   	pop    %ebx
+  800864:	5e                   	pop    %esi
+  800865:	5f                   	pop    %edi
+  800866:	5d                   	pop    %ebp
+  800867:	c3                   	ret
+  800868:	b8 01 00 00 00       	mov    $0x1,%eax
+  80086d:	0f a2                	cpuid
+  80086f:	c1 ea 0b             	shr    $0xb,%edx
+  800872:	83 e2 01             	and    $0x1,%edx
+  800875:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80087b:	eb c2                	jmp    80083f <sys_ring_setup+0x12>
+  80087d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800882:	b8 10 00 00 00       	mov    $0x10,%eax
+  800887:	89 d1                	mov    %edx,%ecx
+  800889:	89 d3                	mov    %edx,%ebx
+  80088b:	89 d7                	mov    %edx,%edi
+  80088d:	89 d6                	mov    %edx,%esi
+  80088f:	55                   	push   %ebp
+  800890:	68 99 08 80 00       	push   $0x800899
+  800895:	89 e5                	mov    %esp,%ebp
+  800897:	0f 34                	sysenter
+  800899:	83 c4 04             	add    $0x4,%esp
+  80089c:	5d                   	pop    %ebp
+  80089d:	eb bd                	jmp    80085c <sys_ring_setup+0x2f>
+  80089f:	83 ec 0c             	sub    $0xc,%esp
+  8008a2:	50                   	push   %eax
+  8008a3:	6a 10                	push   $0x10
+  8008a5:	68 8a 19 80 00       	push   $0x80198a
+  8008aa:	6a 49                	push   $0x49
+  8008ac:	68 a7 19 80 00       	push   $0x8019a7
+  8008b1:	e8 f3 02 00 00       	call   800ba9 <_panic>
+
+008008b6 <sys_ring_enter>:
+  8008b6:	55                   	push   %ebp
+  8008b7:	89 e5                	mov    %esp,%ebp
+  8008b9:	57                   	push   %edi
+  8008ba:	56                   	push   %esi
+  8008bb:	53                   	push   %ebx
+  8008bc:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008c3:	78 22                	js     8008e7 <sys_ring_enter+0x31>
+  8008c5:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008cc:	75 2e                	jne    8008fc <sys_ring_enter+0x46>
+  8008ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008d3:	b8 11 00 00 00       	mov    $0x11,%eax
+  8008d8:	89 d1                	mov    %edx,%ecx
+  8008da:	89 d3                	mov    %edx,%ebx
+  8008dc:	89 d7                	mov    %edx,%edi
+  8008de:	89 d6                	mov    %edx,%esi
+  8008e0:	cd 30                	int    $0x30
+  8008e2:	5b                   	pop    %ebx
+  8008e3:	5e                   	pop    %esi
+  8008e4:	5f                   	pop    %edi
+  8008e5:	5d                   	pop    %ebp
+  8008e6:	c3                   	ret
+  8008e7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008ec:	0f a2                	cpuid
+  8008ee:	c1 ea 0b             	shr    $0xb,%edx
+  8008f1:	83 e2 01             	and    $0x1,%edx
+  8008f4:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8008fa:	eb c9                	jmp    8008c5 <sys_ring_enter+0xf>
+  8008fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800901:	b8 11 00 00 00       	mov    $0x11,%eax
+  800906:	89 d1                	mov    %edx,%ecx
+  800908:	89 d3                	mov    %edx,%ebx
+  80090a:	89 d7                	mov    %edx,%edi
+  80090c:	89 d6                	mov    %edx,%esi
+  80090e:	55                   	push   %ebp
+  80090f:	68 18 09 80 00       	push   $0x800918
+  800914:	89 e5                	mov    %esp,%ebp
+  800916:	0f 34                	sysenter
+  800918:	83 c4 04             	add    $0x4,%esp
+  80091b:	5d                   	pop    %ebp
+  80091c:	eb c4                	jmp    8008e2 <sys_ring_enter+0x2c>
+
+0080091e <sys_ipc_try_send>:
+  80091e:	55                   	push   %ebp
+  80091f:	89 e5                	mov    %esp,%ebp
+  800921:	57                   	push   %edi
+  800922:	56                   	push   %esi
+  800923:	53                   	push   %ebx
+  800924:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80092b:	78 26                	js     800953 <sys_ipc_try_send+0x35>
+  80092d:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800934:	75 32                	jne    800968 <sys_ipc_try_send+0x4a>
+  800936:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80093b:	be 00 00 00 00       	mov    $0x0,%esi
+  800940:	8b 55 08             	mov    0x8(%ebp),%edx
+  800943:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800946:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800949:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80094c:	cd 30                	int    $0x30
+  80094e:	5b                   	pop    %ebx
+  80094f:	5e                   	pop    %esi
+  800950:	5f                   	pop    %edi
+  800951:	5d                   	pop    %ebp
+  800952:	c3                   	ret
+  800953:	b8 01 00 00 00       	mov    $0x1,%eax
+  800958:	0f a2                	cpuid
+  80095a:	c1 ea 0b             	shr    $0xb,%edx
+  80095d:	83 e2 01             	and    $0x1,%edx
+  800960:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800966:	eb c5                	jmp    80092d <sys_ipc_try_send+0xf>
+  800968:	8b 55 08             	mov    0x8(%ebp),%edx
+  80096b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80096e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800973:	be 00 00 00 00       	mov    $0x0,%esi
+  800978:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80097b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80097e:	55                   	push   %ebp
+  80097f:	68 88 09 80 00       	push   $0x800988
+  800984:	89 e5                	mov    %esp,%ebp
+  800986:	0f 34                	sysenter
+  800988:	83 c4 04             	add    $0x4,%esp
+  80098b:	5d                   	pop    %ebp
+  80098c:	eb c0                	jmp    80094e <sys_ipc_try_send+0x30>
+
+0080098e <sys_ipc_recv>:
+  80098e:	55                   	push   %ebp
+  80098f:	89 e5                	mov    %esp,%ebp
+  800991:	57                   	push   %edi
+  800992:	56                   	push   %esi
+  800993:	53                   	push   %ebx
+  800994:	83 ec 0c             	sub    $0xc,%esp
+  800997:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80099e:	78 2a                	js     8009ca <sys_ipc_recv+0x3c>
+  8009a0:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8009a7:	75 36                	jne    8009df <sys_ipc_recv+0x51>
+  8009a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ae:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009b6:	89 cb                	mov    %ecx,%ebx
+  8009b8:	89 cf                	mov    %ecx,%edi
+  8009ba:	89 ce                	mov    %ecx,%esi
+  8009bc:	cd 30                	int    $0x30
+  8009be:	85 c0                	test   %eax,%eax
+  8009c0:	7f 40                	jg     800a02 <sys_ipc_recv+0x74>
+  8009c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009c5:	5b                   	pop    %ebx
+  8009c6:	5e                   	pop    %esi
+  8009c7:	5f                   	pop    %edi
+  8009c8:	5d                   	pop    %ebp
+  8009c9:	c3                   	ret
+  8009ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8009cf:	0f a2                	cpuid
+  8009d1:	c1 ea 0b             	shr    $0xb,%edx
+  8009d4:	83 e2 01             	and    $0x1,%edx
+  8009d7:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8009dd:	eb c1                	jmp    8009a0 <sys_ipc_recv+0x12>
+  8009df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009ec:	89 cb                	mov    %ecx,%ebx
+  8009ee:	89 cf                	mov    %ecx,%edi
+  8009f0:	89 ce                	mov    %ecx,%esi
+  8009f2:	55                   	push   %ebp
+  8009f3:	68 fc 09 80 00       	push   $0x8009fc
+  8009f8:	89 e5                	mov    %esp,%ebp
+  8009fa:	0f 34                	sysenter
+  8009fc:	83 c4 04             	add    $0x4,%esp
+  8009ff:	5d                   	pop    %ebp
+  800a00:	eb bc                	jmp    8009be <sys_ipc_recv+0x30>
+  800a02:	83 ec 0c             	sub    $0xc,%esp
+  800a05:	50                   	push   %eax
+  800a06:	6a 0c                	push   $0xc
+  800a08:	68 8a 19 80 00       	push   $0x80198a
+  800a0d:	6a 49                	push   $0x49
+  800a0f:	68 a7 19 80 00       	push   $0x8019a7
+  800a14:	e8 90 01 00 00       	call   800ba9 <_panic>
+
+00800a19 <uinfo_envid>:
+  800a19:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  800a1e:	c3                   	ret
+
+00800a1f <uinfo_cpunum>:
+  800a1f:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  800a24:	c3                   	ret
+
+00800a25 <uinfo_ticks>:
+  800a25:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  800a2a:	c3                   	ret
+
+00800a2b <uinfo_nsec>:
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	57                   	push   %edi
+  800a2f:	56                   	push   %esi
+  800a30:	53                   	push   %ebx
+  800a31:	83 ec 1c             	sub    $0x1c,%esp
+  800a34:	0f 31                	rdtsc
+  800a36:	89 c6                	mov    %eax,%esi
+  800a38:	89 d7                	mov    %edx,%edi
+  800a3a:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  800a40:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a4a:	85 c9                	test   %ecx,%ecx
+  800a4c:	74 5c                	je     800aaa <uinfo_nsec+0x7f>
+  800a4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a53:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800a56:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800a59:	52                   	push   %edx
+  800a5a:	51                   	push   %ecx
+  800a5b:	57                   	push   %edi
+  800a5c:	56                   	push   %esi
+  800a5d:	e8 63 0d 00 00       	call   8017c5 <__umoddi3>
+  800a62:	83 c4 10             	add    $0x10,%esp
+  800a65:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800a6b:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  800a70:	f7 e3                	mul    %ebx
+  800a72:	01 ca                	add    %ecx,%edx
+  800a74:	ff 75 e4             	push   -0x1c(%ebp)
+  800a77:	ff 75 e0             	push   -0x20(%ebp)
+  800a7a:	52                   	push   %edx
+  800a7b:	50                   	push   %eax
+  800a7c:	e8 6c 0c 00 00       	call   8016ed <__udivdi3>
+  800a81:	83 c4 10             	add    $0x10,%esp
+  800a84:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a87:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a8a:	ff 75 e4             	push   -0x1c(%ebp)
+  800a8d:	ff 75 e0             	push   -0x20(%ebp)
+  800a90:	57                   	push   %edi
+  800a91:	56                   	push   %esi
+  800a92:	e8 56 0c 00 00       	call   8016ed <__udivdi3>
+  800a97:	83 c4 10             	add    $0x10,%esp
+  800a9a:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800aa0:	f7 e3                	mul    %ebx
+  800aa2:	01 ca                	add    %ecx,%edx
+  800aa4:	03 45 d8             	add    -0x28(%ebp),%eax
+  800aa7:	13 55 dc             	adc    -0x24(%ebp),%edx
+  800aaa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aad:	5b                   	pop    %ebx
+  800aae:	5e                   	pop    %esi
+  800aaf:	5f                   	pop    %edi
+  800ab0:	5d                   	pop    %ebp
+  800ab1:	c3                   	ret
+
+00800ab2 <bflush>:
+  800ab2:	a1 40 20 80 00       	mov    0x802040,%eax
+  800ab7:	85 c0                	test   %eax,%eax
+  800ab9:	75 01                	jne    800abc <bflush+0xa>
+  800abb:	c3                   	ret
+  800abc:	55                   	push   %ebp
+  800abd:	89 e5                	mov    %esp,%ebp
+  800abf:	83 ec 10             	sub    $0x10,%esp
+  800ac2:	50                   	push   %eax
+  800ac3:	68 44 20 80 00       	push   $0x802044
+  800ac8:	e8 d4 f5 ff ff       	call   8000a1 <sys_cputs>
+  800acd:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  800ad4:	00 00 00 
+  800ad7:	83 c4 10             	add    $0x10,%esp
+  800ada:	c9                   	leave
+  800adb:	c3                   	ret
+
+00800adc <bputch>:
+  800adc:	55                   	push   %ebp
+  800add:	89 e5                	mov    %esp,%ebp
+  800adf:	53                   	push   %ebx
+  800ae0:	83 ec 04             	sub    $0x4,%esp
+  800ae3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ae6:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  800aec:	8d 42 01             	lea    0x1(%edx),%eax
+  800aef:	a3 40 20 80 00       	mov    %eax,0x802040
+  800af4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800af7:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  800afd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b02:	77 08                	ja     800b0c <bputch+0x30>
+  800b04:	83 03 01             	addl   $0x1,(%ebx)
+  800b07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b0a:	c9                   	leave
+  800b0b:	c3                   	ret
+  800b0c:	e8 a1 ff ff ff       	call   800ab2 <bflush>
+  800b11:	eb f1                	jmp    800b04 <bputch+0x28>
+
+00800b13 <vbprintf>:
+  800b13:	55                   	push   %ebp
+  800b14:	89 e5                	mov    %esp,%ebp
+  800b16:	83 ec 18             	sub    $0x18,%esp
+  800b19:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800b20:	ff 75 0c             	push   0xc(%ebp)
+  800b23:	ff 75 08             	push   0x8(%ebp)
+  800b26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b29:	50                   	push   %eax
+  800b2a:	68 dc 0a 80 00       	push   $0x800adc
+  800b2f:	e8 4c 02 00 00       	call   800d80 <vprintfmt>
+  800b34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b37:	c9                   	leave
+  800b38:	c3                   	ret
+
+00800b39 <bprintf>:
+  800b39:	55                   	push   %ebp
+  800b3a:	89 e5                	mov    %esp,%ebp
+  800b3c:	83 ec 10             	sub    $0x10,%esp
+  800b3f:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800b42:	50                   	push   %eax
+  800b43:	ff 75 08             	push   0x8(%ebp)
+  800b46:	e8 c8 ff ff ff       	call   800b13 <vbprintf>
+  800b4b:	c9                   	leave
+  800b4c:	c3                   	ret
+
+00800b4d <bwrite>:
+  800b4d:	55                   	push   %ebp
+  800b4e:	89 e5                	mov    %esp,%ebp
+  800b50:	53                   	push   %ebx
+  800b51:	83 ec 04             	sub    $0x4,%esp
+  800b54:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b57:	89 d8                	mov    %ebx,%eax
+  800b59:	03 05 40 20 80 00    	add    0x802040,%eax
+  800b5f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b64:	76 0d                	jbe    800b73 <bwrite+0x26>
+  800b66:	e8 47 ff ff ff       	call   800ab2 <bflush>
+  800b6b:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  800b71:	77 25                	ja     800b98 <bwrite+0x4b>
+  800b73:	83 ec 04             	sub    $0x4,%esp
+  800b76:	53                   	push   %ebx
+  800b77:	ff 75 08             	push   0x8(%ebp)
+  800b7a:	a1 40 20 80 00       	mov    0x802040,%eax
+  800b7f:	05 44 20 80 00       	add    $0x802044,%eax
+  800b84:	50                   	push   %eax
+  800b85:	e8 61 09 00 00       	call   8014eb <memcpy>
+  800b8a:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  800b90:	83 c4 10             	add    $0x10,%esp
+  800b93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b96:	c9                   	leave
+  800b97:	c3                   	ret
+  800b98:	83 ec 08             	sub    $0x8,%esp
+  800b9b:	53                   	push   %ebx
+  800b9c:	ff 75 08             	push   0x8(%ebp)
+  800b9f:	e8 fd f4 ff ff       	call   8000a1 <sys_cputs>
+  800ba4:	83 c4 10             	add    $0x10,%esp
+  800ba7:	eb ea                	jmp    800b93 <bwrite+0x46>
+
+00800ba9 <_panic>:
+  800ba9:	55                   	push   %ebp
+  800baa:	89 e5                	mov    %esp,%ebp
+  800bac:	56                   	push   %esi
+  800bad:	53                   	push   %ebx
+  800bae:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800bb1:	e8 fc fe ff ff       	call   800ab2 <bflush>
+  800bb6:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  800bbc:	e8 39 f6 ff ff       	call   8001fa <sys_getenvid>
+  800bc1:	83 ec 0c             	sub    $0xc,%esp
+  800bc4:	ff 75 0c             	push   0xc(%ebp)
+  800bc7:	ff 75 08             	push   0x8(%ebp)
+  800bca:	56                   	push   %esi
+  800bcb:	50                   	push   %eax
+  800bcc:	68 b8 19 80 00       	push   $0x8019b8
+  800bd1:	e8 b3 00 00 00       	call   800c89 <cprintf>
+  800bd6:	83 c4 18             	add    $0x18,%esp
+  800bd9:	53                   	push   %ebx
+  800bda:	ff 75 10             	push   0x10(%ebp)
+  800bdd:	e8 56 00 00 00       	call   800c38 <vcprintf>
+  800be2:	c7 04 24 db 19 80 00 	movl   $0x8019db,(%esp)
+  800be9:	e8 9b 00 00 00       	call   800c89 <cprintf>
+  800bee:	83 c4 10             	add    $0x10,%esp
+  800bf1:	cc                   	int3
+  800bf2:	eb fd                	jmp    800bf1 <_panic+0x48>
+
+00800bf4 <putch>:
+  800bf4:	55                   	push   %ebp
+  800bf5:	89 e5                	mov    %esp,%ebp
+  800bf7:	53                   	push   %ebx
+  800bf8:	83 ec 04             	sub    $0x4,%esp
+  800bfb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800bfe:	8b 13                	mov    (%ebx),%edx
+  800c00:	8d 42 01             	lea    0x1(%edx),%eax
+  800c03:	89 03                	mov    %eax,(%ebx)
+  800c05:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c08:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800c0c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800c11:	74 09                	je     800c1c <putch+0x28>
+  800c13:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800c17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c1a:	c9                   	leave
+  800c1b:	c3                   	ret
+  800c1c:	83 ec 08             	sub    $0x8,%esp
+  800c1f:	68 ff 00 00 00       	push   $0xff
+  800c24:	8d 43 08             	lea    0x8(%ebx),%eax
+  800c27:	50                   	push   %eax
+  800c28:	e8 74 f4 ff ff       	call   8000a1 <sys_cputs>
+  800c2d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800c33:	83 c4 10             	add    $0x10,%esp
+  800c36:	eb db                	jmp    800c13 <putch+0x1f>
+
+00800c38 <vcprintf>:
+  800c38:	55                   	push   %ebp
+  800c39:	89 e5                	mov    %esp,%ebp
+  800c3b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800c41:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800c48:	00 00 00 
+  800c4b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800c52:	00 00 00 
+  800c55:	ff 75 0c             	push   0xc(%ebp)
+  800c58:	ff 75 08             	push   0x8(%ebp)
+  800c5b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800c61:	50                   	push   %eax
+  800c62:	68 f4 0b 80 00       	push   $0x800bf4
+  800c67:	e8 14 01 00 00       	call   800d80 <vprintfmt>
+  800c6c:	83 c4 08             	add    $0x8,%esp
+  800c6f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800c75:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800c7b:	50                   	push   %eax
+  800c7c:	e8 20 f4 ff ff       	call   8000a1 <sys_cputs>
+  800c81:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800c87:	c9                   	leave
+  800c88:	c3                   	ret
+
+00800c89 <cprintf>:
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	83 ec 10             	sub    $0x10,%esp
+  800c8f:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800c92:	50                   	push   %eax
+  800c93:	ff 75 08             	push   0x8(%ebp)
+  800c96:	e8 9d ff ff ff       	call   800c38 <vcprintf>
+  800c9b:	c9                   	leave
+  800c9c:	c3                   	ret
+
+00800c9d <printnum>:
+  800c9d:	55                   	push   %ebp
+  800c9e:	89 e5                	mov    %esp,%ebp
+  800ca0:	57                   	push   %edi
+  800ca1:	56                   	push   %esi
+  800ca2:	53                   	push   %ebx
+  800ca3:	83 ec 1c             	sub    $0x1c,%esp
+  800ca6:	89 c7                	mov    %eax,%edi
+  800ca8:	89 d6                	mov    %edx,%esi
+  800caa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cb0:	89 d1                	mov    %edx,%ecx
+  800cb2:	89 c2                	mov    %eax,%edx
+  800cb4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cb7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800cba:	8b 45 10             	mov    0x10(%ebp),%eax
+  800cbd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800cc0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800cc3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800cca:	39 c2                	cmp    %eax,%edx
+  800ccc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800ccf:	72 3e                	jb     800d0f <printnum+0x72>
+  800cd1:	83 ec 0c             	sub    $0xc,%esp
+  800cd4:	ff 75 18             	push   0x18(%ebp)
+  800cd7:	83 eb 01             	sub    $0x1,%ebx
+  800cda:	53                   	push   %ebx
+  800cdb:	50                   	push   %eax
+  800cdc:	83 ec 08             	sub    $0x8,%esp
+  800cdf:	ff 75 e4             	push   -0x1c(%ebp)
+  800ce2:	ff 75 e0             	push   -0x20(%ebp)
+  800ce5:	ff 75 dc             	push   -0x24(%ebp)
+  800ce8:	ff 75 d8             	push   -0x28(%ebp)
+  800ceb:	e8 fd 09 00 00       	call   8016ed <__udivdi3>
+  800cf0:	83 c4 18             	add    $0x18,%esp
+  800cf3:	52                   	push   %edx
+  800cf4:	50                   	push   %eax
+  800cf5:	89 f2                	mov    %esi,%edx
+  800cf7:	89 f8                	mov    %edi,%eax
+  800cf9:	e8 9f ff ff ff       	call   800c9d <printnum>
+  800cfe:	83 c4 20             	add    $0x20,%esp
+  800d01:	eb 13                	jmp    800d16 <printnum+0x79>
+  800d03:	83 ec 08             	sub    $0x8,%esp
+  800d06:	56                   	push   %esi
+  800d07:	ff 75 18             	push   0x18(%ebp)
+  800d0a:	ff d7                	call   *%edi
+  800d0c:	83 c4 10             	add    $0x10,%esp
+  800d0f:	83 eb 01             	sub    $0x1,%ebx
+  800d12:	85 db                	test   %ebx,%ebx
+  800d14:	7f ed                	jg     800d03 <printnum+0x66>
+  800d16:	83 ec 08             	sub    $0x8,%esp
+  800d19:	56                   	push   %esi
+  800d1a:	83 ec 04             	sub    $0x4,%esp
+  800d1d:	ff 75 e4             	push   -0x1c(%ebp)
+  800d20:	ff 75 e0             	push   -0x20(%ebp)
+  800d23:	ff 75 dc             	push   -0x24(%ebp)
+  800d26:	ff 75 d8             	push   -0x28(%ebp)
+  800d29:	e8 97 0a 00 00       	call   8017c5 <__umoddi3>
+  800d2e:	83 c4 14             	add    $0x14,%esp
+  800d31:	0f be 80 dd 19 80 00 	movsbl 0x8019dd(%eax),%eax
+  800d38:	50                   	push   %eax
+  800d39:	ff d7                	call   *%edi
+  800d3b:	83 c4 10             	add    $0x10,%esp
+  800d3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d41:	5b                   	pop    %ebx
+  800d42:	5e                   	pop    %esi
+  800d43:	5f                   	pop    %edi
+  800d44:	5d                   	pop    %ebp
+  800d45:	c3                   	ret
+
+00800d46 <sprintputch>:
+  800d46:	55                   	push   %ebp
+  800d47:	89 e5                	mov    %esp,%ebp
+  800d49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d4c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800d50:	8b 10                	mov    (%eax),%edx
+  800d52:	3b 50 04             	cmp    0x4(%eax),%edx
+  800d55:	73 0a                	jae    800d61 <sprintputch+0x1b>
+  800d57:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800d5a:	89 08                	mov    %ecx,(%eax)
+  800d5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d5f:	88 02                	mov    %al,(%edx)
+  800d61:	5d                   	pop    %ebp
+  800d62:	c3                   	ret
+
+00800d63 <printfmt>:
+  800d63:	55                   	push   %ebp
+  800d64:	89 e5                	mov    %esp,%ebp
+  800d66:	83 ec 08             	sub    $0x8,%esp
+  800d69:	8d 45 14             	lea    0x14(%ebp),%eax
+  800d6c:	50                   	push   %eax
+  800d6d:	ff 75 10             	push   0x10(%ebp)
+  800d70:	ff 75 0c             	push   0xc(%ebp)
+  800d73:	ff 75 08             	push   0x8(%ebp)
+  800d76:	e8 05 00 00 00       	call   800d80 <vprintfmt>
+  800d7b:	83 c4 10             	add    $0x10,%esp
+  800d7e:	c9                   	leave
+  800d7f:	c3                   	ret
+
+00800d80 <vprintfmt>:
+  800d80:	55                   	push   %ebp
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	57                   	push   %edi
+  800d84:	56                   	push   %esi
+  800d85:	53                   	push   %ebx
+  800d86:	83 ec 2c             	sub    $0x2c,%esp
+  800d89:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d8c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d8f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d92:	eb 0a                	jmp    800d9e <vprintfmt+0x1e>
+  800d94:	83 ec 08             	sub    $0x8,%esp
+  800d97:	53                   	push   %ebx
+  800d98:	50                   	push   %eax
+  800d99:	ff d6                	call   *%esi
+  800d9b:	83 c4 10             	add    $0x10,%esp
+  800d9e:	83 c7 01             	add    $0x1,%edi
+  800da1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800da5:	83 f8 25             	cmp    $0x25,%eax
+  800da8:	74 0c                	je     800db6 <vprintfmt+0x36>
+  800daa:	85 c0                	test   %eax,%eax
+  800dac:	75 e6                	jne    800d94 <vprintfmt+0x14>
+  800dae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db1:	5b                   	pop    %ebx
+  800db2:	5e                   	pop    %esi
+  800db3:	5f                   	pop    %edi
+  800db4:	5d                   	pop    %ebp
+  800db5:	c3                   	ret
+  800db6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800dba:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800dc1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800dc8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800dcf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dd4:	8d 47 01             	lea    0x1(%edi),%eax
+  800dd7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800dda:	0f b6 17             	movzbl (%edi),%edx
+  800ddd:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800de0:	3c 55                	cmp    $0x55,%al
+  800de2:	0f 87 cf 03 00 00    	ja     8011b7 <vprintfmt+0x437>
+  800de8:	0f b6 c0             	movzbl %al,%eax
+  800deb:	ff 24 85 a0 1a 80 00 	jmp    *0x801aa0(,%eax,4)
+  800df2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800df5:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800df9:	eb d9                	jmp    800dd4 <vprintfmt+0x54>
+  800dfb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800dfe:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800e02:	eb d0                	jmp    800dd4 <vprintfmt+0x54>
+  800e04:	0f b6 d2             	movzbl %dl,%edx
+  800e07:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e12:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800e15:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800e19:	0f be 17             	movsbl (%edi),%edx
+  800e1c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800e1f:	83 f9 09             	cmp    $0x9,%ecx
+  800e22:	77 55                	ja     800e79 <vprintfmt+0xf9>
+  800e24:	83 c7 01             	add    $0x1,%edi
+  800e27:	eb e9                	jmp    800e12 <vprintfmt+0x92>
+  800e29:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e2c:	8b 00                	mov    (%eax),%eax
+  800e2e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e31:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e34:	8d 40 04             	lea    0x4(%eax),%eax
+  800e37:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e3a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e3d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800e41:	79 91                	jns    800dd4 <vprintfmt+0x54>
+  800e43:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800e46:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e49:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800e50:	eb 82                	jmp    800dd4 <vprintfmt+0x54>
+  800e52:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e55:	85 d2                	test   %edx,%edx
+  800e57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5c:	0f 49 c2             	cmovns %edx,%eax
+  800e5f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e62:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e65:	e9 6a ff ff ff       	jmp    800dd4 <vprintfmt+0x54>
+  800e6a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e6d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800e74:	e9 5b ff ff ff       	jmp    800dd4 <vprintfmt+0x54>
+  800e79:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e7c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e7f:	eb bc                	jmp    800e3d <vprintfmt+0xbd>
+  800e81:	83 c1 01             	add    $0x1,%ecx
+  800e84:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e87:	e9 48 ff ff ff       	jmp    800dd4 <vprintfmt+0x54>
+  800e8c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e8f:	8d 78 04             	lea    0x4(%eax),%edi
+  800e92:	83 ec 08             	sub    $0x8,%esp
+  800e95:	53                   	push   %ebx
+  800e96:	ff 30                	push   (%eax)
+  800e98:	ff d6                	call   *%esi
+  800e9a:	83 c4 10             	add    $0x10,%esp
+  800e9d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800ea0:	e9 b1 02 00 00       	jmp    801156 <vprintfmt+0x3d6>
+  800ea5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ea8:	8d 78 04             	lea    0x4(%eax),%edi
+  800eab:	8b 10                	mov    (%eax),%edx
+  800ead:	89 d0                	mov    %edx,%eax
+  800eaf:	f7 d8                	neg    %eax
+  800eb1:	0f 48 c2             	cmovs  %edx,%eax
+  800eb4:	83 f8 08             	cmp    $0x8,%eax
+  800eb7:	7f 23                	jg     800edc <vprintfmt+0x15c>
+  800eb9:	8b 14 85 00 1c 80 00 	mov    0x801c00(,%eax,4),%edx
+  800ec0:	85 d2                	test   %edx,%edx
+  800ec2:	74 18                	je     800edc <vprintfmt+0x15c>
+  800ec4:	52                   	push   %edx
+  800ec5:	68 fe 19 80 00       	push   $0x8019fe
+  800eca:	53                   	push   %ebx
+  800ecb:	56                   	push   %esi
+  800ecc:	e8 92 fe ff ff       	call   800d63 <printfmt>
+  800ed1:	83 c4 10             	add    $0x10,%esp
+  800ed4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800ed7:	e9 7a 02 00 00       	jmp    801156 <vprintfmt+0x3d6>
+  800edc:	50                   	push   %eax
+  800edd:	68 f5 19 80 00       	push   $0x8019f5
+  800ee2:	53                   	push   %ebx
+  800ee3:	56                   	push   %esi
+  800ee4:	e8 7a fe ff ff       	call   800d63 <printfmt>
+  800ee9:	83 c4 10             	add    $0x10,%esp
+  800eec:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800eef:	e9 62 02 00 00       	jmp    801156 <vprintfmt+0x3d6>
+  800ef4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ef7:	83 c0 04             	add    $0x4,%eax
+  800efa:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800efd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f00:	8b 08                	mov    (%eax),%ecx
+  800f02:	85 c9                	test   %ecx,%ecx
+  800f04:	b8 ee 19 80 00       	mov    $0x8019ee,%eax
+  800f09:	0f 45 c1             	cmovne %ecx,%eax
+  800f0c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800f0f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800f13:	7e 06                	jle    800f1b <vprintfmt+0x19b>
+  800f15:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800f19:	75 0b                	jne    800f26 <vprintfmt+0x1a6>
+  800f1b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800f1e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800f21:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f24:	eb 5c                	jmp    800f82 <vprintfmt+0x202>
+  800f26:	83 ec 08             	sub    $0x8,%esp
+  800f29:	ff 75 d0             	push   -0x30(%ebp)
+  800f2c:	ff 75 cc             	push   -0x34(%ebp)
+  800f2f:	e8 87 03 00 00       	call   8012bb <strnlen>
+  800f34:	89 c2                	mov    %eax,%edx
+  800f36:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f39:	29 d0                	sub    %edx,%eax
+  800f3b:	83 c4 10             	add    $0x10,%esp
+  800f3e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800f42:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f45:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f48:	89 c6                	mov    %eax,%esi
+  800f4a:	eb 0e                	jmp    800f5a <vprintfmt+0x1da>
+  800f4c:	83 ec 08             	sub    $0x8,%esp
+  800f4f:	53                   	push   %ebx
+  800f50:	57                   	push   %edi
+  800f51:	ff 55 08             	call   *0x8(%ebp)
+  800f54:	83 ee 01             	sub    $0x1,%esi
+  800f57:	83 c4 10             	add    $0x10,%esp
+  800f5a:	85 f6                	test   %esi,%esi
+  800f5c:	7f ee                	jg     800f4c <vprintfmt+0x1cc>
+  800f5e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f61:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f64:	85 c0                	test   %eax,%eax
+  800f66:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6b:	0f 49 d0             	cmovns %eax,%edx
+  800f6e:	29 d0                	sub    %edx,%eax
+  800f70:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f73:	eb a6                	jmp    800f1b <vprintfmt+0x19b>
+  800f75:	83 ec 08             	sub    $0x8,%esp
+  800f78:	53                   	push   %ebx
+  800f79:	52                   	push   %edx
+  800f7a:	ff 55 08             	call   *0x8(%ebp)
+  800f7d:	83 c4 10             	add    $0x10,%esp
+  800f80:	89 f1                	mov    %esi,%ecx
+  800f82:	8d 71 01             	lea    0x1(%ecx),%esi
+  800f85:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800f89:	0f be d0             	movsbl %al,%edx
+  800f8c:	85 d2                	test   %edx,%edx
+  800f8e:	74 28                	je     800fb8 <vprintfmt+0x238>
+  800f90:	85 ff                	test   %edi,%edi
+  800f92:	78 05                	js     800f99 <vprintfmt+0x219>
+  800f94:	83 ef 01             	sub    $0x1,%edi
+  800f97:	78 30                	js     800fc9 <vprintfmt+0x249>
+  800f99:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800f9d:	74 d6                	je     800f75 <vprintfmt+0x1f5>
+  800f9f:	0f be c0             	movsbl %al,%eax
+  800fa2:	83 e8 20             	sub    $0x20,%eax
+  800fa5:	83 f8 5e             	cmp    $0x5e,%eax
+  800fa8:	76 cb                	jbe    800f75 <vprintfmt+0x1f5>
+  800faa:	83 ec 08             	sub    $0x8,%esp
+  800fad:	53                   	push   %ebx
+  800fae:	6a 3f                	push   $0x3f
+  800fb0:	ff 55 08             	call   *0x8(%ebp)
+  800fb3:	83 c4 10             	add    $0x10,%esp
+  800fb6:	eb c8                	jmp    800f80 <vprintfmt+0x200>
+  800fb8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fbb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800fbe:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800fc1:	01 d0                	add    %edx,%eax
+  800fc3:	29 c8                	sub    %ecx,%eax
+  800fc5:	89 c7                	mov    %eax,%edi
+  800fc7:	eb 13                	jmp    800fdc <vprintfmt+0x25c>
+  800fc9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fcc:	eb ed                	jmp    800fbb <vprintfmt+0x23b>
+  800fce:	83 ec 08             	sub    $0x8,%esp
+  800fd1:	53                   	push   %ebx
+  800fd2:	6a 20                	push   $0x20
+  800fd4:	ff d6                	call   *%esi
+  800fd6:	83 ef 01             	sub    $0x1,%edi
+  800fd9:	83 c4 10             	add    $0x10,%esp
+  800fdc:	85 ff                	test   %edi,%edi
+  800fde:	7f ee                	jg     800fce <vprintfmt+0x24e>
+  800fe0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800fe3:	89 45 14             	mov    %eax,0x14(%ebp)
+  800fe6:	e9 6b 01 00 00       	jmp    801156 <vprintfmt+0x3d6>
+  800feb:	83 f9 01             	cmp    $0x1,%ecx
+  800fee:	7f 1f                	jg     80100f <vprintfmt+0x28f>
+  800ff0:	85 c9                	test   %ecx,%ecx
+  800ff2:	74 67                	je     80105b <vprintfmt+0x2db>
+  800ff4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ff7:	8b 00                	mov    (%eax),%eax
+  800ff9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ffc:	89 c1                	mov    %eax,%ecx
+  800ffe:	c1 f9 1f             	sar    $0x1f,%ecx
+  801001:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801004:	8b 45 14             	mov    0x14(%ebp),%eax
+  801007:	8d 40 04             	lea    0x4(%eax),%eax
+  80100a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80100d:	eb 17                	jmp    801026 <vprintfmt+0x2a6>
+  80100f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801012:	8b 50 04             	mov    0x4(%eax),%edx
+  801015:	8b 00                	mov    (%eax),%eax
+  801017:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80101a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80101d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801020:	8d 40 08             	lea    0x8(%eax),%eax
+  801023:	89 45 14             	mov    %eax,0x14(%ebp)
+  801026:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801029:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80102c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801031:	85 c9                	test   %ecx,%ecx
+  801033:	0f 89 03 01 00 00    	jns    80113c <vprintfmt+0x3bc>
+  801039:	83 ec 08             	sub    $0x8,%esp
+  80103c:	53                   	push   %ebx
+  80103d:	6a 2d                	push   $0x2d
+  80103f:	ff d6                	call   *%esi
+  801041:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801044:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801047:	f7 da                	neg    %edx
+  801049:	83 d1 00             	adc    $0x0,%ecx
+  80104c:	f7 d9                	neg    %ecx
+  80104e:	83 c4 10             	add    $0x10,%esp
+  801051:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801056:	e9 e1 00 00 00       	jmp    80113c <vprintfmt+0x3bc>
+  80105b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80105e:	8b 00                	mov    (%eax),%eax
+  801060:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801063:	89 c1                	mov    %eax,%ecx
+  801065:	c1 f9 1f             	sar    $0x1f,%ecx
+  801068:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80106b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80106e:	8d 40 04             	lea    0x4(%eax),%eax
+  801071:	89 45 14             	mov    %eax,0x14(%ebp)
+  801074:	eb b0                	jmp    801026 <vprintfmt+0x2a6>
+  801076:	83 f9 01             	cmp    $0x1,%ecx
+  801079:	7f 1e                	jg     801099 <vprintfmt+0x319>
+  80107b:	85 c9                	test   %ecx,%ecx
+  80107d:	74 32                	je     8010b1 <vprintfmt+0x331>
+  80107f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801082:	8b 10                	mov    (%eax),%edx
+  801084:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801089:	8d 40 04             	lea    0x4(%eax),%eax
+  80108c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80108f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801094:	e9 a3 00 00 00       	jmp    80113c <vprintfmt+0x3bc>
+  801099:	8b 45 14             	mov    0x14(%ebp),%eax
+  80109c:	8b 10                	mov    (%eax),%edx
+  80109e:	8b 48 04             	mov    0x4(%eax),%ecx
+  8010a1:	8d 40 08             	lea    0x8(%eax),%eax
+  8010a4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010a7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010ac:	e9 8b 00 00 00       	jmp    80113c <vprintfmt+0x3bc>
+  8010b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010b4:	8b 10                	mov    (%eax),%edx
+  8010b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8010be:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010c1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010c6:	eb 74                	jmp    80113c <vprintfmt+0x3bc>
+  8010c8:	83 f9 01             	cmp    $0x1,%ecx
+  8010cb:	7f 1b                	jg     8010e8 <vprintfmt+0x368>
+  8010cd:	85 c9                	test   %ecx,%ecx
+  8010cf:	74 2c                	je     8010fd <vprintfmt+0x37d>
+  8010d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010d4:	8b 10                	mov    (%eax),%edx
+  8010d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010db:	8d 40 04             	lea    0x4(%eax),%eax
+  8010de:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010e1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8010e6:	eb 54                	jmp    80113c <vprintfmt+0x3bc>
+  8010e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010eb:	8b 10                	mov    (%eax),%edx
+  8010ed:	8b 48 04             	mov    0x4(%eax),%ecx
+  8010f0:	8d 40 08             	lea    0x8(%eax),%eax
+  8010f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010f6:	bf 08 00 00 00       	mov    $0x8,%edi
+  8010fb:	eb 3f                	jmp    80113c <vprintfmt+0x3bc>
+  8010fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  801100:	8b 10                	mov    (%eax),%edx
+  801102:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801107:	8d 40 04             	lea    0x4(%eax),%eax
+  80110a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80110d:	bf 08 00 00 00       	mov    $0x8,%edi
+  801112:	eb 28                	jmp    80113c <vprintfmt+0x3bc>
+  801114:	83 ec 08             	sub    $0x8,%esp
+  801117:	53                   	push   %ebx
+  801118:	6a 30                	push   $0x30
+  80111a:	ff d6                	call   *%esi
+  80111c:	83 c4 08             	add    $0x8,%esp
+  80111f:	53                   	push   %ebx
+  801120:	6a 78                	push   $0x78
+  801122:	ff d6                	call   *%esi
+  801124:	8b 45 14             	mov    0x14(%ebp),%eax
+  801127:	8b 10                	mov    (%eax),%edx
+  801129:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80112e:	83 c4 10             	add    $0x10,%esp
+  801131:	8d 40 04             	lea    0x4(%eax),%eax
+  801134:	89 45 14             	mov    %eax,0x14(%ebp)
+  801137:	bf 10 00 00 00       	mov    $0x10,%edi
+  80113c:	83 ec 0c             	sub    $0xc,%esp
+  80113f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801143:	50                   	push   %eax
+  801144:	ff 75 e0             	push   -0x20(%ebp)
+  801147:	57                   	push   %edi
+  801148:	51                   	push   %ecx
+  801149:	52                   	push   %edx
+  80114a:	89 da                	mov    %ebx,%edx
+  80114c:	89 f0                	mov    %esi,%eax
+  80114e:	e8 4a fb ff ff       	call   800c9d <printnum>
+  801153:	83 c4 20             	add    $0x20,%esp
+  801156:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801159:	e9 40 fc ff ff       	jmp    800d9e <vprintfmt+0x1e>
+  80115e:	83 f9 01             	cmp    $0x1,%ecx
+  801161:	7f 1b                	jg     80117e <vprintfmt+0x3fe>
+  801163:	85 c9                	test   %ecx,%ecx
+  801165:	74 2c                	je     801193 <vprintfmt+0x413>
+  801167:	8b 45 14             	mov    0x14(%ebp),%eax
+  80116a:	8b 10                	mov    (%eax),%edx
+  80116c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801171:	8d 40 04             	lea    0x4(%eax),%eax
+  801174:	89 45 14             	mov    %eax,0x14(%ebp)
+  801177:	bf 10 00 00 00       	mov    $0x10,%edi
+  80117c:	eb be                	jmp    80113c <vprintfmt+0x3bc>
+  80117e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801181:	8b 10                	mov    (%eax),%edx
+  801183:	8b 48 04             	mov    0x4(%eax),%ecx
+  801186:	8d 40 08             	lea    0x8(%eax),%eax
+  801189:	89 45 14             	mov    %eax,0x14(%ebp)
+  80118c:	bf 10 00 00 00       	mov    $0x10,%edi
+  801191:	eb a9                	jmp    80113c <vprintfmt+0x3bc>
+  801193:	8b 45 14             	mov    0x14(%ebp),%eax
+  801196:	8b 10                	mov    (%eax),%edx
+  801198:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80119d:	8d 40 04             	lea    0x4(%eax),%eax
+  8011a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8011a3:	bf 10 00 00 00       	mov    $0x10,%edi
+  8011a8:	eb 92                	jmp    80113c <vprintfmt+0x3bc>
+  8011aa:	83 ec 08             	sub    $0x8,%esp
+  8011ad:	53                   	push   %ebx
+  8011ae:	6a 25                	push   $0x25
+  8011b0:	ff d6                	call   *%esi
+  8011b2:	83 c4 10             	add    $0x10,%esp
+  8011b5:	eb 9f                	jmp    801156 <vprintfmt+0x3d6>
+  8011b7:	83 ec 08             	sub    $0x8,%esp
+  8011ba:	53                   	push   %ebx
+  8011bb:	6a 25                	push   $0x25
+  8011bd:	ff d6                	call   *%esi
+  8011bf:	83 c4 10             	add    $0x10,%esp
+  8011c2:	89 f8                	mov    %edi,%eax
+  8011c4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8011c8:	74 05                	je     8011cf <vprintfmt+0x44f>
+  8011ca:	83 e8 01             	sub    $0x1,%eax
+  8011cd:	eb f5                	jmp    8011c4 <vprintfmt+0x444>
+  8011cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8011d2:	eb 82                	jmp    801156 <vprintfmt+0x3d6>
+
+008011d4 <vsnprintf>:
+  8011d4:	55                   	push   %ebp
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	83 ec 18             	sub    $0x18,%esp
+  8011da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011e0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8011e3:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8011e7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8011ea:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8011f1:	85 c0                	test   %eax,%eax
+  8011f3:	74 26                	je     80121b <vsnprintf+0x47>
+  8011f5:	85 d2                	test   %edx,%edx
+  8011f7:	7e 22                	jle    80121b <vsnprintf+0x47>
+  8011f9:	ff 75 14             	push   0x14(%ebp)
+  8011fc:	ff 75 10             	push   0x10(%ebp)
+  8011ff:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801202:	50                   	push   %eax
+  801203:	68 46 0d 80 00       	push   $0x800d46
+  801208:	e8 73 fb ff ff       	call   800d80 <vprintfmt>
+  80120d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801210:	c6 00 00             	movb   $0x0,(%eax)
+  801213:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801216:	83 c4 10             	add    $0x10,%esp
+  801219:	c9                   	leave
+  80121a:	c3                   	ret
+  80121b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801220:	eb f7                	jmp    801219 <vsnprintf+0x45>
+
+00801222 <snprintf>:
+  801222:	55                   	push   %ebp
+  801223:	89 e5                	mov    %esp,%ebp
+  801225:	83 ec 08             	sub    $0x8,%esp
+  801228:	8d 45 14             	lea    0x14(%ebp),%eax
+  80122b:	50                   	push   %eax
+  80122c:	ff 75 10             	push   0x10(%ebp)
+  80122f:	ff 75 0c             	push   0xc(%ebp)
+  801232:	ff 75 08             	push   0x8(%ebp)
+  801235:	e8 9a ff ff ff       	call   8011d4 <vsnprintf>
+  80123a:	c9                   	leave
+  80123b:	c3                   	ret
+
+0080123c <copy_fwd>:
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	57                   	push   %edi
+  801240:	56                   	push   %esi
+  801241:	53                   	push   %ebx
+  801242:	89 c7                	mov    %eax,%edi
+  801244:	89 d6                	mov    %edx,%esi
+  801246:	89 c8                	mov    %ecx,%eax
+  801248:	83 f9 0f             	cmp    $0xf,%ecx
+  80124b:	76 1c                	jbe    801269 <copy_fwd+0x2d>
+  80124d:	89 f9                	mov    %edi,%ecx
+  80124f:	f7 d9                	neg    %ecx
+  801251:	89 cb                	mov    %ecx,%ebx
+  801253:	83 e3 03             	and    $0x3,%ebx
+  801256:	29 d8                	sub    %ebx,%eax
+  801258:	89 c2                	mov    %eax,%edx
+  80125a:	c1 ea 02             	shr    $0x2,%edx
+  80125d:	83 e0 03             	and    $0x3,%eax
+  801260:	89 d9                	mov    %ebx,%ecx
+  801262:	fc                   	cld
+  801263:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  801265:	89 d1                	mov    %edx,%ecx
+  801267:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801269:	89 c1                	mov    %eax,%ecx
+  80126b:	fc                   	cld
+  80126c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80126e:	5b                   	pop    %ebx
+  80126f:	5e                   	pop    %esi
+  801270:	5f                   	pop    %edi
+  801271:	5d                   	pop    %ebp
+  801272:	c3                   	ret
+
+00801273 <have_sse2>:
+  801273:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80127a:	78 06                	js     801282 <have_sse2+0xf>
+  80127c:	a1 08 20 80 00       	mov    0x802008,%eax
+  801281:	c3                   	ret
+  801282:	55                   	push   %ebp
+  801283:	89 e5                	mov    %esp,%ebp
+  801285:	53                   	push   %ebx
+  801286:	b8 01 00 00 00       	mov    $0x1,%eax
+  80128b:	0f a2                	cpuid
+  80128d:	c1 ea 1a             	shr    $0x1a,%edx
+  801290:	83 e2 01             	and    $0x1,%edx
+  801293:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801299:	a1 08 20 80 00       	mov    0x802008,%eax
+  80129e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012a1:	c9                   	leave
+  8012a2:	c3                   	ret
+
+008012a3 <strlen>:
+  8012a3:	55                   	push   %ebp
+  8012a4:	89 e5                	mov    %esp,%ebp
+  8012a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ae:	eb 03                	jmp    8012b3 <strlen+0x10>
+  8012b0:	83 c0 01             	add    $0x1,%eax
+  8012b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8012b7:	75 f7                	jne    8012b0 <strlen+0xd>
+  8012b9:	5d                   	pop    %ebp
+  8012ba:	c3                   	ret
+
+008012bb <strnlen>:
+  8012bb:	55                   	push   %ebp
+  8012bc:	89 e5                	mov    %esp,%ebp
+  8012be:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c9:	eb 03                	jmp    8012ce <strnlen+0x13>
+  8012cb:	83 c0 01             	add    $0x1,%eax
+  8012ce:	39 d0                	cmp    %edx,%eax
+  8012d0:	74 08                	je     8012da <strnlen+0x1f>
+  8012d2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8012d6:	75 f3                	jne    8012cb <strnlen+0x10>
+  8012d8:	89 c2                	mov    %eax,%edx
+  8012da:	89 d0                	mov    %edx,%eax
+  8012dc:	5d                   	pop    %ebp
+  8012dd:	c3                   	ret
+
+008012de <strcpy>:
+  8012de:	55                   	push   %ebp
+  8012df:	89 e5                	mov    %esp,%ebp
+  8012e1:	53                   	push   %ebx
+  8012e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8012e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ed:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8012f1:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8012f4:	83 c0 01             	add    $0x1,%eax
+  8012f7:	84 d2                	test   %dl,%dl
+  8012f9:	75 f2                	jne    8012ed <strcpy+0xf>
+  8012fb:	89 c8                	mov    %ecx,%eax
+  8012fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801300:	c9                   	leave
+  801301:	c3                   	ret
+
+00801302 <strcat>:
+  801302:	55                   	push   %ebp
+  801303:	89 e5                	mov    %esp,%ebp
+  801305:	53                   	push   %ebx
+  801306:	83 ec 10             	sub    $0x10,%esp
+  801309:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80130c:	53                   	push   %ebx
+  80130d:	e8 91 ff ff ff       	call   8012a3 <strlen>
+  801312:	83 c4 08             	add    $0x8,%esp
+  801315:	ff 75 0c             	push   0xc(%ebp)
+  801318:	01 d8                	add    %ebx,%eax
+  80131a:	50                   	push   %eax
+  80131b:	e8 be ff ff ff       	call   8012de <strcpy>
+  801320:	89 d8                	mov    %ebx,%eax
+  801322:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801325:	c9                   	leave
+  801326:	c3                   	ret
+
+00801327 <strncpy>:
+  801327:	55                   	push   %ebp
+  801328:	89 e5                	mov    %esp,%ebp
+  80132a:	56                   	push   %esi
+  80132b:	53                   	push   %ebx
+  80132c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80132f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801332:	89 f3                	mov    %esi,%ebx
+  801334:	03 5d 10             	add    0x10(%ebp),%ebx
+  801337:	89 f0                	mov    %esi,%eax
+  801339:	eb 0f                	jmp    80134a <strncpy+0x23>
+  80133b:	83 c0 01             	add    $0x1,%eax
+  80133e:	0f b6 0a             	movzbl (%edx),%ecx
+  801341:	88 48 ff             	mov    %cl,-0x1(%eax)
+  801344:	80 f9 01             	cmp    $0x1,%cl
+  801347:	83 da ff             	sbb    $0xffffffff,%edx
+  80134a:	39 d8                	cmp    %ebx,%eax
+  80134c:	75 ed                	jne    80133b <strncpy+0x14>
+  80134e:	89 f0                	mov    %esi,%eax
+  801350:	5b                   	pop    %ebx
+  801351:	5e                   	pop    %esi
+  801352:	5d                   	pop    %ebp
+  801353:	c3                   	ret
+
+00801354 <strlcpy>:
+  801354:	55                   	push   %ebp
+  801355:	89 e5                	mov    %esp,%ebp
+  801357:	56                   	push   %esi
+  801358:	53                   	push   %ebx
+  801359:	8b 75 08             	mov    0x8(%ebp),%esi
+  80135c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135f:	8b 55 10             	mov    0x10(%ebp),%edx
+  801362:	89 f0                	mov    %esi,%eax
+  801364:	85 d2                	test   %edx,%edx
+  801366:	74 21                	je     801389 <strlcpy+0x35>
+  801368:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80136c:	89 f2                	mov    %esi,%edx
+  80136e:	eb 09                	jmp    801379 <strlcpy+0x25>
+  801370:	83 c1 01             	add    $0x1,%ecx
+  801373:	83 c2 01             	add    $0x1,%edx
+  801376:	88 5a ff             	mov    %bl,-0x1(%edx)
+  801379:	39 c2                	cmp    %eax,%edx
+  80137b:	74 09                	je     801386 <strlcpy+0x32>
+  80137d:	0f b6 19             	movzbl (%ecx),%ebx
+  801380:	84 db                	test   %bl,%bl
+  801382:	75 ec                	jne    801370 <strlcpy+0x1c>
+  801384:	89 d0                	mov    %edx,%eax
+  801386:	c6 00 00             	movb   $0x0,(%eax)
+  801389:	29 f0                	sub    %esi,%eax
+  80138b:	5b                   	pop    %ebx
+  80138c:	5e                   	pop    %esi
+  80138d:	5d                   	pop    %ebp
+  80138e:	c3                   	ret
+
+0080138f <strcmp>:
+  80138f:	55                   	push   %ebp
+  801390:	89 e5                	mov    %esp,%ebp
+  801392:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801395:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801398:	eb 06                	jmp    8013a0 <strcmp+0x11>
+  80139a:	83 c1 01             	add    $0x1,%ecx
+  80139d:	83 c2 01             	add    $0x1,%edx
+  8013a0:	0f b6 01             	movzbl (%ecx),%eax
+  8013a3:	84 c0                	test   %al,%al
+  8013a5:	74 04                	je     8013ab <strcmp+0x1c>
+  8013a7:	3a 02                	cmp    (%edx),%al
+  8013a9:	74 ef                	je     80139a <strcmp+0xb>
+  8013ab:	0f b6 c0             	movzbl %al,%eax
+  8013ae:	0f b6 12             	movzbl (%edx),%edx
+  8013b1:	29 d0                	sub    %edx,%eax
+  8013b3:	5d                   	pop    %ebp
+  8013b4:	c3                   	ret
+
+008013b5 <strncmp>:
+  8013b5:	55                   	push   %ebp
+  8013b6:	89 e5                	mov    %esp,%ebp
+  8013b8:	53                   	push   %ebx
+  8013b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013bf:	8b 55 10             	mov    0x10(%ebp),%edx
+  8013c2:	eb 09                	jmp    8013cd <strncmp+0x18>
+  8013c4:	83 ea 01             	sub    $0x1,%edx
+  8013c7:	83 c0 01             	add    $0x1,%eax
+  8013ca:	83 c1 01             	add    $0x1,%ecx
+  8013cd:	85 d2                	test   %edx,%edx
+  8013cf:	74 18                	je     8013e9 <strncmp+0x34>
+  8013d1:	0f b6 18             	movzbl (%eax),%ebx
+  8013d4:	84 db                	test   %bl,%bl
+  8013d6:	74 04                	je     8013dc <strncmp+0x27>
+  8013d8:	3a 19                	cmp    (%ecx),%bl
+  8013da:	74 e8                	je     8013c4 <strncmp+0xf>
+  8013dc:	0f b6 00             	movzbl (%eax),%eax
+  8013df:	0f b6 11             	movzbl (%ecx),%edx
+  8013e2:	29 d0                	sub    %edx,%eax
+  8013e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013e7:	c9                   	leave
+  8013e8:	c3                   	ret
+  8013e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ee:	eb f4                	jmp    8013e4 <strncmp+0x2f>
+
+008013f0 <strchr>:
+  8013f0:	55                   	push   %ebp
+  8013f1:	89 e5                	mov    %esp,%ebp
+  8013f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8013fa:	eb 03                	jmp    8013ff <strchr+0xf>
+  8013fc:	83 c0 01             	add    $0x1,%eax
+  8013ff:	0f b6 10             	movzbl (%eax),%edx
+  801402:	84 d2                	test   %dl,%dl
+  801404:	74 06                	je     80140c <strchr+0x1c>
+  801406:	38 ca                	cmp    %cl,%dl
+  801408:	75 f2                	jne    8013fc <strchr+0xc>
+  80140a:	eb 05                	jmp    801411 <strchr+0x21>
+  80140c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801411:	5d                   	pop    %ebp
+  801412:	c3                   	ret
+
+00801413 <strfind>:
+  801413:	55                   	push   %ebp
+  801414:	89 e5                	mov    %esp,%ebp
+  801416:	8b 45 08             	mov    0x8(%ebp),%eax
+  801419:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80141d:	0f b6 10             	movzbl (%eax),%edx
+  801420:	38 ca                	cmp    %cl,%dl
+  801422:	74 09                	je     80142d <strfind+0x1a>
+  801424:	84 d2                	test   %dl,%dl
+  801426:	74 05                	je     80142d <strfind+0x1a>
+  801428:	83 c0 01             	add    $0x1,%eax
+  80142b:	eb f0                	jmp    80141d <strfind+0xa>
+  80142d:	5d                   	pop    %ebp
+  80142e:	c3                   	ret
+
+0080142f <memset>:
+  80142f:	55                   	push   %ebp
+  801430:	89 e5                	mov    %esp,%ebp
+  801432:	57                   	push   %edi
+  801433:	56                   	push   %esi
+  801434:	53                   	push   %ebx
+  801435:	83 ec 04             	sub    $0x4,%esp
+  801438:	8b 75 08             	mov    0x8(%ebp),%esi
+  80143b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80143e:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  801442:	89 f7                	mov    %esi,%edi
+  801444:	83 fa 0f             	cmp    $0xf,%edx
+  801447:	76 24                	jbe    80146d <memset+0x3e>
+  801449:	89 f1                	mov    %esi,%ecx
+  80144b:	f7 d9                	neg    %ecx
+  80144d:	83 e1 03             	and    $0x3,%ecx
+  801450:	29 ca                	sub    %ecx,%edx
+  801452:	89 d0                	mov    %edx,%eax
+  801454:	c1 e8 02             	shr    $0x2,%eax
+  801457:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  80145a:	83 e2 03             	and    $0x3,%edx
+  80145d:	89 d8                	mov    %ebx,%eax
+  80145f:	fc                   	cld
+  801460:	f3 aa                	rep stos %al,%es:(%edi)
+  801462:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  801468:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  80146b:	f3 ab                	rep stos %eax,%es:(%edi)
+  80146d:	89 d1                	mov    %edx,%ecx
+  80146f:	89 d8                	mov    %ebx,%eax
+  801471:	fc                   	cld
+  801472:	f3 aa                	rep stos %al,%es:(%edi)
+  801474:	89 f0                	mov    %esi,%eax
+  801476:	83 c4 04             	add    $0x4,%esp
+  801479:	5b                   	pop    %ebx
+  80147a:	5e                   	pop    %esi
+  80147b:	5f                   	pop    %edi
+  80147c:	5d                   	pop    %ebp
+  80147d:	c3                   	ret
+
+0080147e <memmove>:
+  80147e:	55                   	push   %ebp
+  80147f:	89 e5                	mov    %esp,%ebp
+  801481:	57                   	push   %edi
+  801482:	56                   	push   %esi
+  801483:	53                   	push   %ebx
+  801484:	83 ec 0c             	sub    $0xc,%esp
+  801487:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80148a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80148d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801490:	85 c0                	test   %eax,%eax
+  801492:	74 14                	je     8014a8 <memmove+0x2a>
+  801494:	39 da                	cmp    %ebx,%edx
+  801496:	73 07                	jae    80149f <memmove+0x21>
+  801498:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  80149b:	39 cb                	cmp    %ecx,%ebx
+  80149d:	72 13                	jb     8014b2 <memmove+0x34>
+  80149f:	89 c1                	mov    %eax,%ecx
+  8014a1:	89 d8                	mov    %ebx,%eax
+  8014a3:	e8 94 fd ff ff       	call   80123c <copy_fwd>
+  8014a8:	89 d8                	mov    %ebx,%eax
+  8014aa:	83 c4 0c             	add    $0xc,%esp
+  8014ad:	5b                   	pop    %ebx
+  8014ae:	5e                   	pop    %esi
+  8014af:	5f                   	pop    %edi
+  8014b0:	5d                   	pop    %ebp
+  8014b1:	c3                   	ret
+  8014b2:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  8014b5:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  8014b8:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  8014bb:	83 f8 0f             	cmp    $0xf,%eax
+  8014be:	76 23                	jbe    8014e3 <memmove+0x65>
+  8014c0:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  8014c3:	83 e1 03             	and    $0x3,%ecx
+  8014c6:	29 c8                	sub    %ecx,%eax
+  8014c8:	89 c2                	mov    %eax,%edx
+  8014ca:	c1 ea 02             	shr    $0x2,%edx
+  8014cd:	83 e0 03             	and    $0x3,%eax
+  8014d0:	fd                   	std
+  8014d1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014d3:	83 ef 03             	sub    $0x3,%edi
+  8014d6:	83 ee 03             	sub    $0x3,%esi
+  8014d9:	89 d1                	mov    %edx,%ecx
+  8014db:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8014dd:	83 c7 03             	add    $0x3,%edi
+  8014e0:	83 c6 03             	add    $0x3,%esi
+  8014e3:	89 c1                	mov    %eax,%ecx
+  8014e5:	fd                   	std
+  8014e6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014e8:	fc                   	cld
+  8014e9:	eb bd                	jmp    8014a8 <memmove+0x2a>
+
+008014eb <memcpy>:
+  8014eb:	55                   	push   %ebp
+  8014ec:	89 e5                	mov    %esp,%ebp
+  8014ee:	53                   	push   %ebx
+  8014ef:	83 ec 04             	sub    $0x4,%esp
+  8014f2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8014f5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8014f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014fb:	89 d8                	mov    %ebx,%eax
+  8014fd:	e8 3a fd ff ff       	call   80123c <copy_fwd>
+  801502:	89 d8                	mov    %ebx,%eax
+  801504:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801507:	c9                   	leave
+  801508:	c3                   	ret
+
+00801509 <page_copy>:
+  801509:	55                   	push   %ebp
+  80150a:	89 e5                	mov    %esp,%ebp
+  80150c:	57                   	push   %edi
+  80150d:	56                   	push   %esi
+  80150e:	53                   	push   %ebx
+  80150f:	83 ec 0c             	sub    $0xc,%esp
+  801512:	e8 5c fd ff ff       	call   801273 <have_sse2>
+  801517:	85 c0                	test   %eax,%eax
+  801519:	74 39                	je     801554 <page_copy+0x4b>
+  80151b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80151e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801521:	be 00 01 00 00       	mov    $0x100,%esi
+  801526:	8b 03                	mov    (%ebx),%eax
+  801528:	8b 53 04             	mov    0x4(%ebx),%edx
+  80152b:	0f c3 01             	movnti %eax,(%ecx)
+  80152e:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  801532:	8b 43 08             	mov    0x8(%ebx),%eax
+  801535:	8b 53 0c             	mov    0xc(%ebx),%edx
+  801538:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  80153c:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  801540:	83 c3 10             	add    $0x10,%ebx
+  801543:	83 c1 10             	add    $0x10,%ecx
+  801546:	4e                   	dec    %esi
+  801547:	75 dd                	jne    801526 <page_copy+0x1d>
+  801549:	0f ae f8             	sfence
+  80154c:	83 c4 0c             	add    $0xc,%esp
+  80154f:	5b                   	pop    %ebx
+  801550:	5e                   	pop    %esi
+  801551:	5f                   	pop    %edi
+  801552:	5d                   	pop    %ebp
+  801553:	c3                   	ret
+  801554:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801557:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80155a:	b9 00 04 00 00       	mov    $0x400,%ecx
+  80155f:	fc                   	cld
+  801560:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801562:	eb e8                	jmp    80154c <page_copy+0x43>
+
+00801564 <page_zero>:
+  801564:	55                   	push   %ebp
+  801565:	89 e5                	mov    %esp,%ebp
+  801567:	57                   	push   %edi
+  801568:	83 ec 04             	sub    $0x4,%esp
+  80156b:	e8 03 fd ff ff       	call   801273 <have_sse2>
+  801570:	85 c0                	test   %eax,%eax
+  801572:	74 3a                	je     8015ae <page_zero+0x4a>
+  801574:	8b 45 08             	mov    0x8(%ebp),%eax
+  801577:	ba 80 00 00 00       	mov    $0x80,%edx
+  80157c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801581:	0f c3 08             	movnti %ecx,(%eax)
+  801584:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  801588:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  80158c:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  801590:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  801594:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  801598:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  80159c:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  8015a0:	83 c0 20             	add    $0x20,%eax
+  8015a3:	4a                   	dec    %edx
+  8015a4:	75 db                	jne    801581 <page_zero+0x1d>
+  8015a6:	0f ae f8             	sfence
+  8015a9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8015ac:	c9                   	leave
+  8015ad:	c3                   	ret
+  8015ae:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015b1:	b9 00 04 00 00       	mov    $0x400,%ecx
+  8015b6:	fc                   	cld
+  8015b7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8015b9:	eb ee                	jmp    8015a9 <page_zero+0x45>
+
+008015bb <memcmp>:
+  8015bb:	55                   	push   %ebp
+  8015bc:	89 e5                	mov    %esp,%ebp
+  8015be:	56                   	push   %esi
+  8015bf:	53                   	push   %ebx
+  8015c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015c6:	89 c6                	mov    %eax,%esi
+  8015c8:	03 75 10             	add    0x10(%ebp),%esi
+  8015cb:	eb 06                	jmp    8015d3 <memcmp+0x18>
+  8015cd:	83 c0 01             	add    $0x1,%eax
+  8015d0:	83 c2 01             	add    $0x1,%edx
+  8015d3:	39 f0                	cmp    %esi,%eax
+  8015d5:	74 14                	je     8015eb <memcmp+0x30>
+  8015d7:	0f b6 08             	movzbl (%eax),%ecx
+  8015da:	0f b6 1a             	movzbl (%edx),%ebx
+  8015dd:	38 d9                	cmp    %bl,%cl
+  8015df:	74 ec                	je     8015cd <memcmp+0x12>
+  8015e1:	0f b6 c1             	movzbl %cl,%eax
+  8015e4:	0f b6 db             	movzbl %bl,%ebx
+  8015e7:	29 d8                	sub    %ebx,%eax
+  8015e9:	eb 05                	jmp    8015f0 <memcmp+0x35>
+  8015eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f0:	5b                   	pop    %ebx
+  8015f1:	5e                   	pop    %esi
+  8015f2:	5d                   	pop    %ebp
+  8015f3:	c3                   	ret
+
+008015f4 <memfind>:
+  8015f4:	55                   	push   %ebp
+  8015f5:	89 e5                	mov    %esp,%ebp
+  8015f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015fd:	89 c2                	mov    %eax,%edx
+  8015ff:	03 55 10             	add    0x10(%ebp),%edx
+  801602:	eb 03                	jmp    801607 <memfind+0x13>
+  801604:	83 c0 01             	add    $0x1,%eax
+  801607:	39 d0                	cmp    %edx,%eax
+  801609:	73 04                	jae    80160f <memfind+0x1b>
+  80160b:	38 08                	cmp    %cl,(%eax)
+  80160d:	75 f5                	jne    801604 <memfind+0x10>
+  80160f:	5d                   	pop    %ebp
+  801610:	c3                   	ret
+
+00801611 <strtol>:
+  801611:	55                   	push   %ebp
+  801612:	89 e5                	mov    %esp,%ebp
+  801614:	57                   	push   %edi
+  801615:	56                   	push   %esi
+  801616:	53                   	push   %ebx
+  801617:	8b 55 08             	mov    0x8(%ebp),%edx
+  80161a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80161d:	eb 03                	jmp    801622 <strtol+0x11>
+  80161f:	83 c2 01             	add    $0x1,%edx
+  801622:	0f b6 02             	movzbl (%edx),%eax
+  801625:	3c 20                	cmp    $0x20,%al
+  801627:	74 f6                	je     80161f <strtol+0xe>
+  801629:	3c 09                	cmp    $0x9,%al
+  80162b:	74 f2                	je     80161f <strtol+0xe>
+  80162d:	3c 2b                	cmp    $0x2b,%al
+  80162f:	74 2a                	je     80165b <strtol+0x4a>
+  801631:	bf 00 00 00 00       	mov    $0x0,%edi
+  801636:	3c 2d                	cmp    $0x2d,%al
+  801638:	74 2b                	je     801665 <strtol+0x54>
+  80163a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801640:	75 0f                	jne    801651 <strtol+0x40>
+  801642:	80 3a 30             	cmpb   $0x30,(%edx)
+  801645:	74 28                	je     80166f <strtol+0x5e>
+  801647:	85 db                	test   %ebx,%ebx
+  801649:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80164e:	0f 44 d8             	cmove  %eax,%ebx
+  801651:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801656:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801659:	eb 46                	jmp    8016a1 <strtol+0x90>
+  80165b:	83 c2 01             	add    $0x1,%edx
+  80165e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801663:	eb d5                	jmp    80163a <strtol+0x29>
+  801665:	83 c2 01             	add    $0x1,%edx
+  801668:	bf 01 00 00 00       	mov    $0x1,%edi
+  80166d:	eb cb                	jmp    80163a <strtol+0x29>
+  80166f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801673:	74 0e                	je     801683 <strtol+0x72>
+  801675:	85 db                	test   %ebx,%ebx
+  801677:	75 d8                	jne    801651 <strtol+0x40>
+  801679:	83 c2 01             	add    $0x1,%edx
+  80167c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801681:	eb ce                	jmp    801651 <strtol+0x40>
+  801683:	83 c2 02             	add    $0x2,%edx
+  801686:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80168b:	eb c4                	jmp    801651 <strtol+0x40>
+  80168d:	0f be c0             	movsbl %al,%eax
+  801690:	83 e8 30             	sub    $0x30,%eax
+  801693:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801696:	7d 3a                	jge    8016d2 <strtol+0xc1>
+  801698:	83 c2 01             	add    $0x1,%edx
+  80169b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80169f:	01 c1                	add    %eax,%ecx
+  8016a1:	0f b6 02             	movzbl (%edx),%eax
+  8016a4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8016a7:	89 f3                	mov    %esi,%ebx
+  8016a9:	80 fb 09             	cmp    $0x9,%bl
+  8016ac:	76 df                	jbe    80168d <strtol+0x7c>
+  8016ae:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8016b1:	89 f3                	mov    %esi,%ebx
+  8016b3:	80 fb 19             	cmp    $0x19,%bl
+  8016b6:	77 08                	ja     8016c0 <strtol+0xaf>
+  8016b8:	0f be c0             	movsbl %al,%eax
+  8016bb:	83 e8 57             	sub    $0x57,%eax
+  8016be:	eb d3                	jmp    801693 <strtol+0x82>
+  8016c0:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8016c3:	89 f3                	mov    %esi,%ebx
+  8016c5:	80 fb 19             	cmp    $0x19,%bl
+  8016c8:	77 08                	ja     8016d2 <strtol+0xc1>
+  8016ca:	0f be c0             	movsbl %al,%eax
+  8016cd:	83 e8 37             	sub    $0x37,%eax
+  8016d0:	eb c1                	jmp    801693 <strtol+0x82>
+  8016d2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8016d6:	74 05                	je     8016dd <strtol+0xcc>
+  8016d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016db:	89 10                	mov    %edx,(%eax)
+  8016dd:	89 c8                	mov    %ecx,%eax
+  8016df:	f7 d8                	neg    %eax
+  8016e1:	85 ff                	test   %edi,%edi
+  8016e3:	0f 45 c8             	cmovne %eax,%ecx
+  8016e6:	89 c8                	mov    %ecx,%eax
+  8016e8:	5b                   	pop    %ebx
+  8016e9:	5e                   	pop    %esi
+  8016ea:	5f                   	pop    %edi
+  8016eb:	5d                   	pop    %ebp
+  8016ec:	c3                   	ret
+
+008016ed <__udivdi3>:
+  8016ed:	57                   	push   %edi
+  8016ee:	56                   	push   %esi
+  8016ef:	53                   	push   %ebx
+  8016f0:	83 ec 20             	sub    $0x20,%esp
+  8016f3:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8016f7:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8016fb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8016ff:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801703:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801707:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80170b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80170f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801713:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801717:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  80171b:	89 d1                	mov    %edx,%ecx
+  80171d:	09 c1                	or     %eax,%ecx
+  80171f:	0f 84 91 00 00 00    	je     8017b6 <__udivdi3+0xc9>
+  801725:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80172c:	00 
+  80172d:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801734:	00 
+  801735:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80173a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801744:	eb 08                	jmp    80174e <__udivdi3+0x61>
+  801746:	83 e9 01             	sub    $0x1,%ecx
+  801749:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80174c:	74 68                	je     8017b6 <__udivdi3+0xc9>
+  80174e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801752:	01 c0                	add    %eax,%eax
+  801754:	89 c6                	mov    %eax,%esi
+  801756:	89 d7                	mov    %edx,%edi
+  801758:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80175c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801760:	0f ad d0             	shrd   %cl,%edx,%eax
+  801763:	d3 ea                	shr    %cl,%edx
+  801765:	f6 c1 20             	test   $0x20,%cl
+  801768:	74 04                	je     80176e <__udivdi3+0x81>
+  80176a:	89 d0                	mov    %edx,%eax
+  80176c:	31 d2                	xor    %edx,%edx
+  80176e:	83 e0 01             	and    $0x1,%eax
+  801771:	89 04 24             	mov    %eax,(%esp)
+  801774:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80177b:	00 
+  80177c:	8b 04 24             	mov    (%esp),%eax
+  80177f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801783:	09 f0                	or     %esi,%eax
+  801785:	09 fa                	or     %edi,%edx
+  801787:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80178b:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80178f:	39 f0                	cmp    %esi,%eax
+  801791:	89 d3                	mov    %edx,%ebx
+  801793:	19 fb                	sbb    %edi,%ebx
+  801795:	72 af                	jb     801746 <__udivdi3+0x59>
+  801797:	29 f0                	sub    %esi,%eax
+  801799:	19 fa                	sbb    %edi,%edx
+  80179b:	89 cf                	mov    %ecx,%edi
+  80179d:	c1 ef 05             	shr    $0x5,%edi
+  8017a0:	83 e7 01             	and    $0x1,%edi
+  8017a3:	89 fe                	mov    %edi,%esi
+  8017a5:	83 f6 01             	xor    $0x1,%esi
+  8017a8:	d3 e6                	shl    %cl,%esi
+  8017aa:	d3 e7                	shl    %cl,%edi
+  8017ac:	09 74 24 18          	or     %esi,0x18(%esp)
+  8017b0:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8017b4:	eb 90                	jmp    801746 <__udivdi3+0x59>
+  8017b6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8017ba:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8017be:	83 c4 20             	add    $0x20,%esp
+  8017c1:	5b                   	pop    %ebx
+  8017c2:	5e                   	pop    %esi
+  8017c3:	5f                   	pop    %edi
+  8017c4:	c3                   	ret
+
+008017c5 <__umoddi3>:
+  8017c5:	55                   	push   %ebp
+  8017c6:	57                   	push   %edi
+  8017c7:	56                   	push   %esi
+  8017c8:	53                   	push   %ebx
+  8017c9:	83 ec 1c             	sub    $0x1c,%esp
+  8017cc:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8017d0:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8017d4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8017d8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8017dc:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8017e0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8017e4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8017e8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8017ec:	89 d6                	mov    %edx,%esi
+  8017ee:	09 c6                	or     %eax,%esi
+  8017f0:	74 6c                	je     80185e <__umoddi3+0x99>
+  8017f2:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8017f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801801:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801805:	eb 0e                	jmp    801815 <__umoddi3+0x50>
+  801807:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  80180c:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801810:	83 fe ff             	cmp    $0xffffffff,%esi
+  801813:	74 49                	je     80185e <__umoddi3+0x99>
+  801815:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801819:	01 c0                	add    %eax,%eax
+  80181b:	89 c3                	mov    %eax,%ebx
+  80181d:	89 d6                	mov    %edx,%esi
+  80181f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801823:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801827:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  80182c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80182f:	d3 ea                	shr    %cl,%edx
+  801831:	f6 c1 20             	test   $0x20,%cl
+  801834:	74 04                	je     80183a <__umoddi3+0x75>
+  801836:	89 d0                	mov    %edx,%eax
+  801838:	31 d2                	xor    %edx,%edx
+  80183a:	83 e0 01             	and    $0x1,%eax
+  80183d:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801842:	89 ea                	mov    %ebp,%edx
+  801844:	09 d8                	or     %ebx,%eax
+  801846:	09 f2                	or     %esi,%edx
+  801848:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  80184c:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801850:	39 d8                	cmp    %ebx,%eax
+  801852:	89 d1                	mov    %edx,%ecx
+  801854:	19 f1                	sbb    %esi,%ecx
+  801856:	72 af                	jb     801807 <__umoddi3+0x42>
+  801858:	29 d8                	sub    %ebx,%eax
+  80185a:	19 f2                	sbb    %esi,%edx
+  80185c:	eb a9                	jmp    801807 <__umoddi3+0x42>
+  80185e:	83 c4 1c             	add    $0x1c,%esp
+  801861:	5b                   	pop    %ebx
+  801862:	5e                   	pop    %esi
+  801863:	5f                   	pop    %edi
+  801864:	5d                   	pop    %ebp
+  801865:	c3                   	ret
+
+00801866 <__divdi3>:
+  801866:	53                   	push   %ebx
+  801867:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80186b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80186f:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801873:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801877:	85 d2                	test   %edx,%edx
+  801879:	78 12                	js     80188d <__divdi3+0x27>
+  80187b:	85 db                	test   %ebx,%ebx
+  80187d:	78 2e                	js     8018ad <__divdi3+0x47>
+  80187f:	53                   	push   %ebx
+  801880:	51                   	push   %ecx
+  801881:	52                   	push   %edx
+  801882:	50                   	push   %eax
+  801883:	e8 65 fe ff ff       	call   8016ed <__udivdi3>
+  801888:	83 c4 10             	add    $0x10,%esp
+  80188b:	eb 1e                	jmp    8018ab <__divdi3+0x45>
+  80188d:	f7 d8                	neg    %eax
+  80188f:	83 d2 00             	adc    $0x0,%edx
+  801892:	f7 da                	neg    %edx
+  801894:	85 db                	test   %ebx,%ebx
+  801896:	78 2a                	js     8018c2 <__divdi3+0x5c>
+  801898:	53                   	push   %ebx
+  801899:	51                   	push   %ecx
+  80189a:	52                   	push   %edx
+  80189b:	50                   	push   %eax
+  80189c:	e8 4c fe ff ff       	call   8016ed <__udivdi3>
+  8018a1:	83 c4 10             	add    $0x10,%esp
+  8018a4:	f7 d8                	neg    %eax
+  8018a6:	83 d2 00             	adc    $0x0,%edx
+  8018a9:	f7 da                	neg    %edx
+  8018ab:	5b                   	pop    %ebx
+  8018ac:	c3                   	ret
+  8018ad:	f7 d9                	neg    %ecx
+  8018af:	83 d3 00             	adc    $0x0,%ebx
+  8018b2:	f7 db                	neg    %ebx
+  8018b4:	53                   	push   %ebx
+  8018b5:	51                   	push   %ecx
+  8018b6:	52                   	push   %edx
+  8018b7:	50                   	push   %eax
+  8018b8:	e8 30 fe ff ff       	call   8016ed <__udivdi3>
+  8018bd:	83 c4 10             	add    $0x10,%esp
+  8018c0:	eb e2                	jmp    8018a4 <__divdi3+0x3e>
+  8018c2:	f7 d9                	neg    %ecx
+  8018c4:	83 d3 00             	adc    $0x0,%ebx
+  8018c7:	f7 db                	neg    %ebx
+  8018c9:	53                   	push   %ebx
+  8018ca:	51                   	push   %ecx
+  8018cb:	52                   	push   %edx
+  8018cc:	50                   	push   %eax
+  8018cd:	e8 1b fe ff ff       	call   8016ed <__udivdi3>
+  8018d2:	83 c4 10             	add    $0x10,%esp
+  8018d5:	eb d4                	jmp    8018ab <__divdi3+0x45>
+
+008018d7 <__moddi3>:
+  8018d7:	55                   	push   %ebp
+  8018d8:	57                   	push   %edi
+  8018d9:	56                   	push   %esi
+  8018da:	53                   	push   %ebx
+  8018db:	83 ec 14             	sub    $0x14,%esp
+  8018de:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  8018e2:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  8018e6:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8018ea:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8018ee:	85 ed                	test   %ebp,%ebp
+  8018f0:	78 2b                	js     80191d <__moddi3+0x46>
+  8018f2:	89 c6                	mov    %eax,%esi
+  8018f4:	f7 de                	neg    %esi
+  8018f6:	89 34 24             	mov    %esi,(%esp)
+  8018f9:	89 d6                	mov    %edx,%esi
+  8018fb:	83 d6 00             	adc    $0x0,%esi
+  8018fe:	f7 de                	neg    %esi
+  801900:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801904:	8b 34 24             	mov    (%esp),%esi
+  801907:	0f 48 f0             	cmovs  %eax,%esi
+  80190a:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  80190f:	52                   	push   %edx
+  801910:	56                   	push   %esi
+  801911:	55                   	push   %ebp
+  801912:	57                   	push   %edi
+  801913:	e8 ad fe ff ff       	call   8017c5 <__umoddi3>
+  801918:	83 c4 10             	add    $0x10,%esp
+  80191b:	eb 3c                	jmp    801959 <__moddi3+0x82>
+  80191d:	89 c3                	mov    %eax,%ebx
+  80191f:	f7 db                	neg    %ebx
+  801921:	89 d1                	mov    %edx,%ecx
+  801923:	83 d1 00             	adc    $0x0,%ecx
+  801926:	f7 d9                	neg    %ecx
+  801928:	0f 49 c3             	cmovns %ebx,%eax
+  80192b:	89 04 24             	mov    %eax,(%esp)
+  80192e:	0f 49 d1             	cmovns %ecx,%edx
+  801931:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801935:	ff 74 24 04          	push   0x4(%esp)
+  801939:	ff 74 24 04          	push   0x4(%esp)
+  80193d:	89 f8                	mov    %edi,%eax
+  80193f:	89 ea                	mov    %ebp,%edx
+  801941:	f7 d8                	neg    %eax
+  801943:	83 d2 00             	adc    $0x0,%edx
+  801946:	f7 da                	neg    %edx
+  801948:	52                   	push   %edx
+  801949:	50                   	push   %eax
+  80194a:	e8 76 fe ff ff       	call   8017c5 <__umoddi3>
+  80194f:	83 c4 10             	add    $0x10,%esp
+  801952:	f7 d8                	neg    %eax
+  801954:	83 d2 00             	adc    $0x0,%edx
+  801957:	f7 da                	neg    %edx
+  801959:	83 c4 14             	add    $0x14,%esp
+  80195c:	5b                   	pop    %ebx
+  80195d:	5e                   	pop    %esi
+  80195e:	5f                   	pop    %edi
+  80195f:	5d                   	pop    %ebp
+  801960:	c3                   	ret
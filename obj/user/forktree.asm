@@ -0,0 +1,2959 @@
+
+obj/user/forktree:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 b2 00 00 00       	call   8000e3 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <forktree>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003d:	e8 56 0d 00 00       	call   800d98 <sys_getenvid>
+  800042:	83 ec 04             	sub    $0x4,%esp
+  800045:	53                   	push   %ebx
+  800046:	50                   	push   %eax
+  800047:	68 e0 1d 80 00       	push   $0x801de0
+  80004c:	e8 8a 01 00 00       	call   8001db <cprintf>
+  800051:	83 c4 08             	add    $0x8,%esp
+  800054:	6a 30                	push   $0x30
+  800056:	53                   	push   %ebx
+  800057:	e8 13 00 00 00       	call   80006f <forkchild>
+  80005c:	83 c4 08             	add    $0x8,%esp
+  80005f:	6a 31                	push   $0x31
+  800061:	53                   	push   %ebx
+  800062:	e8 08 00 00 00       	call   80006f <forkchild>
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80006d:	c9                   	leave
+  80006e:	c3                   	ret
+
+0080006f <forkchild>:
+  80006f:	55                   	push   %ebp
+  800070:	89 e5                	mov    %esp,%ebp
+  800072:	56                   	push   %esi
+  800073:	53                   	push   %ebx
+  800074:	83 ec 1c             	sub    $0x1c,%esp
+  800077:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80007a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80007d:	53                   	push   %ebx
+  80007e:	e8 72 07 00 00       	call   8007f5 <strlen>
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	83 f8 02             	cmp    $0x2,%eax
+  800089:	7e 07                	jle    800092 <forkchild+0x23>
+  80008b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008e:	5b                   	pop    %ebx
+  80008f:	5e                   	pop    %esi
+  800090:	5d                   	pop    %ebp
+  800091:	c3                   	ret
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	89 f0                	mov    %esi,%eax
+  800097:	0f be f0             	movsbl %al,%esi
+  80009a:	56                   	push   %esi
+  80009b:	53                   	push   %ebx
+  80009c:	68 f1 1d 80 00       	push   $0x801df1
+  8000a1:	6a 04                	push   $0x4
+  8000a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a6:	50                   	push   %eax
+  8000a7:	e8 c8 06 00 00       	call   800774 <snprintf>
+  8000ac:	83 c4 20             	add    $0x20,%esp
+  8000af:	e8 c2 16 00 00       	call   801776 <fork>
+  8000b4:	85 c0                	test   %eax,%eax
+  8000b6:	75 d3                	jne    80008b <forkchild+0x1c>
+  8000b8:	83 ec 0c             	sub    $0xc,%esp
+  8000bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000be:	50                   	push   %eax
+  8000bf:	e8 6f ff ff ff       	call   800033 <forktree>
+  8000c4:	e8 63 00 00 00       	call   80012c <exit>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+  8000cc:	eb bd                	jmp    80008b <forkchild+0x1c>
+
+008000ce <umain>:
+  8000ce:	55                   	push   %ebp
+  8000cf:	89 e5                	mov    %esp,%ebp
+  8000d1:	83 ec 14             	sub    $0x14,%esp
+  8000d4:	68 f0 1d 80 00       	push   $0x801df0
+  8000d9:	e8 55 ff ff ff       	call   800033 <forktree>
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+
+008000e3 <libmain>:
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	56                   	push   %esi
+  8000e7:	53                   	push   %ebx
+  8000e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000ee:	e8 08 18 00 00       	call   8018fb <uinfo_envid>
+  8000f3:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8000f8:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8000fe:	05 00 00 00 ed       	add    $0xed000000,%eax
+  800103:	a3 20 30 80 00       	mov    %eax,0x803020
+  800108:	85 db                	test   %ebx,%ebx
+  80010a:	7e 07                	jle    800113 <libmain+0x30>
+  80010c:	8b 06                	mov    (%esi),%eax
+  80010e:	a3 00 30 80 00       	mov    %eax,0x803000
+  800113:	83 ec 08             	sub    $0x8,%esp
+  800116:	56                   	push   %esi
+  800117:	53                   	push   %ebx
+  800118:	e8 b1 ff ff ff       	call   8000ce <umain>
+  80011d:	e8 0a 00 00 00       	call   80012c <exit>
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800128:	5b                   	pop    %ebx
+  800129:	5e                   	pop    %esi
+  80012a:	5d                   	pop    %ebp
+  80012b:	c3                   	ret
+
+0080012c <exit>:
+  80012c:	55                   	push   %ebp
+  80012d:	89 e5                	mov    %esp,%ebp
+  80012f:	83 ec 08             	sub    $0x8,%esp
+  800132:	e8 5d 18 00 00       	call   801994 <bflush>
+  800137:	83 ec 0c             	sub    $0xc,%esp
+  80013a:	6a 00                	push   $0x0
+  80013c:	e8 cc 0b 00 00       	call   800d0d <sys_env_destroy>
+  800141:	83 c4 10             	add    $0x10,%esp
+  800144:	c9                   	leave
+  800145:	c3                   	ret
+
+00800146 <putch>:
+  800146:	55                   	push   %ebp
+  800147:	89 e5                	mov    %esp,%ebp
+  800149:	53                   	push   %ebx
+  80014a:	83 ec 04             	sub    $0x4,%esp
+  80014d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800150:	8b 13                	mov    (%ebx),%edx
+  800152:	8d 42 01             	lea    0x1(%edx),%eax
+  800155:	89 03                	mov    %eax,(%ebx)
+  800157:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80015a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80015e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800163:	74 09                	je     80016e <putch+0x28>
+  800165:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800169:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80016c:	c9                   	leave
+  80016d:	c3                   	ret
+  80016e:	83 ec 08             	sub    $0x8,%esp
+  800171:	68 ff 00 00 00       	push   $0xff
+  800176:	8d 43 08             	lea    0x8(%ebx),%eax
+  800179:	50                   	push   %eax
+  80017a:	e8 c0 0a 00 00       	call   800c3f <sys_cputs>
+  80017f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800185:	83 c4 10             	add    $0x10,%esp
+  800188:	eb db                	jmp    800165 <putch+0x1f>
+
+0080018a <vcprintf>:
+  80018a:	55                   	push   %ebp
+  80018b:	89 e5                	mov    %esp,%ebp
+  80018d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800193:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80019a:	00 00 00 
+  80019d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001a4:	00 00 00 
+  8001a7:	ff 75 0c             	push   0xc(%ebp)
+  8001aa:	ff 75 08             	push   0x8(%ebp)
+  8001ad:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001b3:	50                   	push   %eax
+  8001b4:	68 46 01 80 00       	push   $0x800146
+  8001b9:	e8 14 01 00 00       	call   8002d2 <vprintfmt>
+  8001be:	83 c4 08             	add    $0x8,%esp
+  8001c1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001c7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001cd:	50                   	push   %eax
+  8001ce:	e8 6c 0a 00 00       	call   800c3f <sys_cputs>
+  8001d3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001d9:	c9                   	leave
+  8001da:	c3                   	ret
+
+008001db <cprintf>:
+  8001db:	55                   	push   %ebp
+  8001dc:	89 e5                	mov    %esp,%ebp
+  8001de:	83 ec 10             	sub    $0x10,%esp
+  8001e1:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8001e4:	50                   	push   %eax
+  8001e5:	ff 75 08             	push   0x8(%ebp)
+  8001e8:	e8 9d ff ff ff       	call   80018a <vcprintf>
+  8001ed:	c9                   	leave
+  8001ee:	c3                   	ret
+
+008001ef <printnum>:
+  8001ef:	55                   	push   %ebp
+  8001f0:	89 e5                	mov    %esp,%ebp
+  8001f2:	57                   	push   %edi
+  8001f3:	56                   	push   %esi
+  8001f4:	53                   	push   %ebx
+  8001f5:	83 ec 1c             	sub    $0x1c,%esp
+  8001f8:	89 c7                	mov    %eax,%edi
+  8001fa:	89 d6                	mov    %edx,%esi
+  8001fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800202:	89 d1                	mov    %edx,%ecx
+  800204:	89 c2                	mov    %eax,%edx
+  800206:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800209:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80020c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80020f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800212:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800215:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80021c:	39 c2                	cmp    %eax,%edx
+  80021e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800221:	72 3e                	jb     800261 <printnum+0x72>
+  800223:	83 ec 0c             	sub    $0xc,%esp
+  800226:	ff 75 18             	push   0x18(%ebp)
+  800229:	83 eb 01             	sub    $0x1,%ebx
+  80022c:	53                   	push   %ebx
+  80022d:	50                   	push   %eax
+  80022e:	83 ec 08             	sub    $0x8,%esp
+  800231:	ff 75 e4             	push   -0x1c(%ebp)
+  800234:	ff 75 e0             	push   -0x20(%ebp)
+  800237:	ff 75 dc             	push   -0x24(%ebp)
+  80023a:	ff 75 d8             	push   -0x28(%ebp)
+  80023d:	e8 29 19 00 00       	call   801b6b <__udivdi3>
+  800242:	83 c4 18             	add    $0x18,%esp
+  800245:	52                   	push   %edx
+  800246:	50                   	push   %eax
+  800247:	89 f2                	mov    %esi,%edx
+  800249:	89 f8                	mov    %edi,%eax
+  80024b:	e8 9f ff ff ff       	call   8001ef <printnum>
+  800250:	83 c4 20             	add    $0x20,%esp
+  800253:	eb 13                	jmp    800268 <printnum+0x79>
+  800255:	83 ec 08             	sub    $0x8,%esp
+  800258:	56                   	push   %esi
+  800259:	ff 75 18             	push   0x18(%ebp)
+  80025c:	ff d7                	call   *%edi
+  80025e:	83 c4 10             	add    $0x10,%esp
+  800261:	83 eb 01             	sub    $0x1,%ebx
+  800264:	85 db                	test   %ebx,%ebx
+  800266:	7f ed                	jg     800255 <printnum+0x66>
+  800268:	83 ec 08             	sub    $0x8,%esp
+  80026b:	56                   	push   %esi
+  80026c:	83 ec 04             	sub    $0x4,%esp
+  80026f:	ff 75 e4             	push   -0x1c(%ebp)
+  800272:	ff 75 e0             	push   -0x20(%ebp)
+  800275:	ff 75 dc             	push   -0x24(%ebp)
+  800278:	ff 75 d8             	push   -0x28(%ebp)
+  80027b:	e8 c3 19 00 00       	call   801c43 <__umoddi3>
+  800280:	83 c4 14             	add    $0x14,%esp
+  800283:	0f be 80 00 1e 80 00 	movsbl 0x801e00(%eax),%eax
+  80028a:	50                   	push   %eax
+  80028b:	ff d7                	call   *%edi
+  80028d:	83 c4 10             	add    $0x10,%esp
+  800290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800293:	5b                   	pop    %ebx
+  800294:	5e                   	pop    %esi
+  800295:	5f                   	pop    %edi
+  800296:	5d                   	pop    %ebp
+  800297:	c3                   	ret
+
+00800298 <sprintputch>:
+  800298:	55                   	push   %ebp
+  800299:	89 e5                	mov    %esp,%ebp
+  80029b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80029e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8002a2:	8b 10                	mov    (%eax),%edx
+  8002a4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002a7:	73 0a                	jae    8002b3 <sprintputch+0x1b>
+  8002a9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002ac:	89 08                	mov    %ecx,(%eax)
+  8002ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002b1:	88 02                	mov    %al,(%edx)
+  8002b3:	5d                   	pop    %ebp
+  8002b4:	c3                   	ret
+
+008002b5 <printfmt>:
+  8002b5:	55                   	push   %ebp
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	83 ec 08             	sub    $0x8,%esp
+  8002bb:	8d 45 14             	lea    0x14(%ebp),%eax
+  8002be:	50                   	push   %eax
+  8002bf:	ff 75 10             	push   0x10(%ebp)
+  8002c2:	ff 75 0c             	push   0xc(%ebp)
+  8002c5:	ff 75 08             	push   0x8(%ebp)
+  8002c8:	e8 05 00 00 00       	call   8002d2 <vprintfmt>
+  8002cd:	83 c4 10             	add    $0x10,%esp
+  8002d0:	c9                   	leave
+  8002d1:	c3                   	ret
+
+008002d2 <vprintfmt>:
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	57                   	push   %edi
+  8002d6:	56                   	push   %esi
+  8002d7:	53                   	push   %ebx
+  8002d8:	83 ec 2c             	sub    $0x2c,%esp
+  8002db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002e1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002e4:	eb 0a                	jmp    8002f0 <vprintfmt+0x1e>
+  8002e6:	83 ec 08             	sub    $0x8,%esp
+  8002e9:	53                   	push   %ebx
+  8002ea:	50                   	push   %eax
+  8002eb:	ff d6                	call   *%esi
+  8002ed:	83 c4 10             	add    $0x10,%esp
+  8002f0:	83 c7 01             	add    $0x1,%edi
+  8002f3:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002f7:	83 f8 25             	cmp    $0x25,%eax
+  8002fa:	74 0c                	je     800308 <vprintfmt+0x36>
+  8002fc:	85 c0                	test   %eax,%eax
+  8002fe:	75 e6                	jne    8002e6 <vprintfmt+0x14>
+  800300:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800303:	5b                   	pop    %ebx
+  800304:	5e                   	pop    %esi
+  800305:	5f                   	pop    %edi
+  800306:	5d                   	pop    %ebp
+  800307:	c3                   	ret
+  800308:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  80030c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800313:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80031a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800321:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800326:	8d 47 01             	lea    0x1(%edi),%eax
+  800329:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80032c:	0f b6 17             	movzbl (%edi),%edx
+  80032f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800332:	3c 55                	cmp    $0x55,%al
+  800334:	0f 87 cf 03 00 00    	ja     800709 <vprintfmt+0x437>
+  80033a:	0f b6 c0             	movzbl %al,%eax
+  80033d:	ff 24 85 c0 1e 80 00 	jmp    *0x801ec0(,%eax,4)
+  800344:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800347:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80034b:	eb d9                	jmp    800326 <vprintfmt+0x54>
+  80034d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800350:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800354:	eb d0                	jmp    800326 <vprintfmt+0x54>
+  800356:	0f b6 d2             	movzbl %dl,%edx
+  800359:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80035c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800361:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800364:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800367:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  80036b:	0f be 17             	movsbl (%edi),%edx
+  80036e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800371:	83 f9 09             	cmp    $0x9,%ecx
+  800374:	77 55                	ja     8003cb <vprintfmt+0xf9>
+  800376:	83 c7 01             	add    $0x1,%edi
+  800379:	eb e9                	jmp    800364 <vprintfmt+0x92>
+  80037b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037e:	8b 00                	mov    (%eax),%eax
+  800380:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800383:	8b 45 14             	mov    0x14(%ebp),%eax
+  800386:	8d 40 04             	lea    0x4(%eax),%eax
+  800389:	89 45 14             	mov    %eax,0x14(%ebp)
+  80038c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80038f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800393:	79 91                	jns    800326 <vprintfmt+0x54>
+  800395:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800398:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80039b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003a2:	eb 82                	jmp    800326 <vprintfmt+0x54>
+  8003a4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003a7:	85 d2                	test   %edx,%edx
+  8003a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ae:	0f 49 c2             	cmovns %edx,%eax
+  8003b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003b7:	e9 6a ff ff ff       	jmp    800326 <vprintfmt+0x54>
+  8003bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003bf:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8003c6:	e9 5b ff ff ff       	jmp    800326 <vprintfmt+0x54>
+  8003cb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ce:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003d1:	eb bc                	jmp    80038f <vprintfmt+0xbd>
+  8003d3:	83 c1 01             	add    $0x1,%ecx
+  8003d6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003d9:	e9 48 ff ff ff       	jmp    800326 <vprintfmt+0x54>
+  8003de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e1:	8d 78 04             	lea    0x4(%eax),%edi
+  8003e4:	83 ec 08             	sub    $0x8,%esp
+  8003e7:	53                   	push   %ebx
+  8003e8:	ff 30                	push   (%eax)
+  8003ea:	ff d6                	call   *%esi
+  8003ec:	83 c4 10             	add    $0x10,%esp
+  8003ef:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003f2:	e9 b1 02 00 00       	jmp    8006a8 <vprintfmt+0x3d6>
+  8003f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fa:	8d 78 04             	lea    0x4(%eax),%edi
+  8003fd:	8b 10                	mov    (%eax),%edx
+  8003ff:	89 d0                	mov    %edx,%eax
+  800401:	f7 d8                	neg    %eax
+  800403:	0f 48 c2             	cmovs  %edx,%eax
+  800406:	83 f8 08             	cmp    $0x8,%eax
+  800409:	7f 23                	jg     80042e <vprintfmt+0x15c>
+  80040b:	8b 14 85 20 20 80 00 	mov    0x802020(,%eax,4),%edx
+  800412:	85 d2                	test   %edx,%edx
+  800414:	74 18                	je     80042e <vprintfmt+0x15c>
+  800416:	52                   	push   %edx
+  800417:	68 21 1e 80 00       	push   $0x801e21
+  80041c:	53                   	push   %ebx
+  80041d:	56                   	push   %esi
+  80041e:	e8 92 fe ff ff       	call   8002b5 <printfmt>
+  800423:	83 c4 10             	add    $0x10,%esp
+  800426:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800429:	e9 7a 02 00 00       	jmp    8006a8 <vprintfmt+0x3d6>
+  80042e:	50                   	push   %eax
+  80042f:	68 18 1e 80 00       	push   $0x801e18
+  800434:	53                   	push   %ebx
+  800435:	56                   	push   %esi
+  800436:	e8 7a fe ff ff       	call   8002b5 <printfmt>
+  80043b:	83 c4 10             	add    $0x10,%esp
+  80043e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800441:	e9 62 02 00 00       	jmp    8006a8 <vprintfmt+0x3d6>
+  800446:	8b 45 14             	mov    0x14(%ebp),%eax
+  800449:	83 c0 04             	add    $0x4,%eax
+  80044c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80044f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800452:	8b 08                	mov    (%eax),%ecx
+  800454:	85 c9                	test   %ecx,%ecx
+  800456:	b8 11 1e 80 00       	mov    $0x801e11,%eax
+  80045b:	0f 45 c1             	cmovne %ecx,%eax
+  80045e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800461:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800465:	7e 06                	jle    80046d <vprintfmt+0x19b>
+  800467:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80046b:	75 0b                	jne    800478 <vprintfmt+0x1a6>
+  80046d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800470:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800473:	89 75 08             	mov    %esi,0x8(%ebp)
+  800476:	eb 5c                	jmp    8004d4 <vprintfmt+0x202>
+  800478:	83 ec 08             	sub    $0x8,%esp
+  80047b:	ff 75 d0             	push   -0x30(%ebp)
+  80047e:	ff 75 cc             	push   -0x34(%ebp)
+  800481:	e8 87 03 00 00       	call   80080d <strnlen>
+  800486:	89 c2                	mov    %eax,%edx
+  800488:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80048b:	29 d0                	sub    %edx,%eax
+  80048d:	83 c4 10             	add    $0x10,%esp
+  800490:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800494:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800497:	89 75 08             	mov    %esi,0x8(%ebp)
+  80049a:	89 c6                	mov    %eax,%esi
+  80049c:	eb 0e                	jmp    8004ac <vprintfmt+0x1da>
+  80049e:	83 ec 08             	sub    $0x8,%esp
+  8004a1:	53                   	push   %ebx
+  8004a2:	57                   	push   %edi
+  8004a3:	ff 55 08             	call   *0x8(%ebp)
+  8004a6:	83 ee 01             	sub    $0x1,%esi
+  8004a9:	83 c4 10             	add    $0x10,%esp
+  8004ac:	85 f6                	test   %esi,%esi
+  8004ae:	7f ee                	jg     80049e <vprintfmt+0x1cc>
+  8004b0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004b6:	85 c0                	test   %eax,%eax
+  8004b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004bd:	0f 49 d0             	cmovns %eax,%edx
+  8004c0:	29 d0                	sub    %edx,%eax
+  8004c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c5:	eb a6                	jmp    80046d <vprintfmt+0x19b>
+  8004c7:	83 ec 08             	sub    $0x8,%esp
+  8004ca:	53                   	push   %ebx
+  8004cb:	52                   	push   %edx
+  8004cc:	ff 55 08             	call   *0x8(%ebp)
+  8004cf:	83 c4 10             	add    $0x10,%esp
+  8004d2:	89 f1                	mov    %esi,%ecx
+  8004d4:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004d7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004db:	0f be d0             	movsbl %al,%edx
+  8004de:	85 d2                	test   %edx,%edx
+  8004e0:	74 28                	je     80050a <vprintfmt+0x238>
+  8004e2:	85 ff                	test   %edi,%edi
+  8004e4:	78 05                	js     8004eb <vprintfmt+0x219>
+  8004e6:	83 ef 01             	sub    $0x1,%edi
+  8004e9:	78 30                	js     80051b <vprintfmt+0x249>
+  8004eb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004ef:	74 d6                	je     8004c7 <vprintfmt+0x1f5>
+  8004f1:	0f be c0             	movsbl %al,%eax
+  8004f4:	83 e8 20             	sub    $0x20,%eax
+  8004f7:	83 f8 5e             	cmp    $0x5e,%eax
+  8004fa:	76 cb                	jbe    8004c7 <vprintfmt+0x1f5>
+  8004fc:	83 ec 08             	sub    $0x8,%esp
+  8004ff:	53                   	push   %ebx
+  800500:	6a 3f                	push   $0x3f
+  800502:	ff 55 08             	call   *0x8(%ebp)
+  800505:	83 c4 10             	add    $0x10,%esp
+  800508:	eb c8                	jmp    8004d2 <vprintfmt+0x200>
+  80050a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800510:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800513:	01 d0                	add    %edx,%eax
+  800515:	29 c8                	sub    %ecx,%eax
+  800517:	89 c7                	mov    %eax,%edi
+  800519:	eb 13                	jmp    80052e <vprintfmt+0x25c>
+  80051b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80051e:	eb ed                	jmp    80050d <vprintfmt+0x23b>
+  800520:	83 ec 08             	sub    $0x8,%esp
+  800523:	53                   	push   %ebx
+  800524:	6a 20                	push   $0x20
+  800526:	ff d6                	call   *%esi
+  800528:	83 ef 01             	sub    $0x1,%edi
+  80052b:	83 c4 10             	add    $0x10,%esp
+  80052e:	85 ff                	test   %edi,%edi
+  800530:	7f ee                	jg     800520 <vprintfmt+0x24e>
+  800532:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800535:	89 45 14             	mov    %eax,0x14(%ebp)
+  800538:	e9 6b 01 00 00       	jmp    8006a8 <vprintfmt+0x3d6>
+  80053d:	83 f9 01             	cmp    $0x1,%ecx
+  800540:	7f 1f                	jg     800561 <vprintfmt+0x28f>
+  800542:	85 c9                	test   %ecx,%ecx
+  800544:	74 67                	je     8005ad <vprintfmt+0x2db>
+  800546:	8b 45 14             	mov    0x14(%ebp),%eax
+  800549:	8b 00                	mov    (%eax),%eax
+  80054b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80054e:	89 c1                	mov    %eax,%ecx
+  800550:	c1 f9 1f             	sar    $0x1f,%ecx
+  800553:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800556:	8b 45 14             	mov    0x14(%ebp),%eax
+  800559:	8d 40 04             	lea    0x4(%eax),%eax
+  80055c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80055f:	eb 17                	jmp    800578 <vprintfmt+0x2a6>
+  800561:	8b 45 14             	mov    0x14(%ebp),%eax
+  800564:	8b 50 04             	mov    0x4(%eax),%edx
+  800567:	8b 00                	mov    (%eax),%eax
+  800569:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80056f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800572:	8d 40 08             	lea    0x8(%eax),%eax
+  800575:	89 45 14             	mov    %eax,0x14(%ebp)
+  800578:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80057b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80057e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800583:	85 c9                	test   %ecx,%ecx
+  800585:	0f 89 03 01 00 00    	jns    80068e <vprintfmt+0x3bc>
+  80058b:	83 ec 08             	sub    $0x8,%esp
+  80058e:	53                   	push   %ebx
+  80058f:	6a 2d                	push   $0x2d
+  800591:	ff d6                	call   *%esi
+  800593:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800596:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800599:	f7 da                	neg    %edx
+  80059b:	83 d1 00             	adc    $0x0,%ecx
+  80059e:	f7 d9                	neg    %ecx
+  8005a0:	83 c4 10             	add    $0x10,%esp
+  8005a3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005a8:	e9 e1 00 00 00       	jmp    80068e <vprintfmt+0x3bc>
+  8005ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b0:	8b 00                	mov    (%eax),%eax
+  8005b2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b5:	89 c1                	mov    %eax,%ecx
+  8005b7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005ba:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c6:	eb b0                	jmp    800578 <vprintfmt+0x2a6>
+  8005c8:	83 f9 01             	cmp    $0x1,%ecx
+  8005cb:	7f 1e                	jg     8005eb <vprintfmt+0x319>
+  8005cd:	85 c9                	test   %ecx,%ecx
+  8005cf:	74 32                	je     800603 <vprintfmt+0x331>
+  8005d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d4:	8b 10                	mov    (%eax),%edx
+  8005d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005db:	8d 40 04             	lea    0x4(%eax),%eax
+  8005de:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005e6:	e9 a3 00 00 00       	jmp    80068e <vprintfmt+0x3bc>
+  8005eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ee:	8b 10                	mov    (%eax),%edx
+  8005f0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005f3:	8d 40 08             	lea    0x8(%eax),%eax
+  8005f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005fe:	e9 8b 00 00 00       	jmp    80068e <vprintfmt+0x3bc>
+  800603:	8b 45 14             	mov    0x14(%ebp),%eax
+  800606:	8b 10                	mov    (%eax),%edx
+  800608:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80060d:	8d 40 04             	lea    0x4(%eax),%eax
+  800610:	89 45 14             	mov    %eax,0x14(%ebp)
+  800613:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800618:	eb 74                	jmp    80068e <vprintfmt+0x3bc>
+  80061a:	83 f9 01             	cmp    $0x1,%ecx
+  80061d:	7f 1b                	jg     80063a <vprintfmt+0x368>
+  80061f:	85 c9                	test   %ecx,%ecx
+  800621:	74 2c                	je     80064f <vprintfmt+0x37d>
+  800623:	8b 45 14             	mov    0x14(%ebp),%eax
+  800626:	8b 10                	mov    (%eax),%edx
+  800628:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062d:	8d 40 04             	lea    0x4(%eax),%eax
+  800630:	89 45 14             	mov    %eax,0x14(%ebp)
+  800633:	bf 08 00 00 00       	mov    $0x8,%edi
+  800638:	eb 54                	jmp    80068e <vprintfmt+0x3bc>
+  80063a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063d:	8b 10                	mov    (%eax),%edx
+  80063f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800642:	8d 40 08             	lea    0x8(%eax),%eax
+  800645:	89 45 14             	mov    %eax,0x14(%ebp)
+  800648:	bf 08 00 00 00       	mov    $0x8,%edi
+  80064d:	eb 3f                	jmp    80068e <vprintfmt+0x3bc>
+  80064f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800652:	8b 10                	mov    (%eax),%edx
+  800654:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800659:	8d 40 04             	lea    0x4(%eax),%eax
+  80065c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80065f:	bf 08 00 00 00       	mov    $0x8,%edi
+  800664:	eb 28                	jmp    80068e <vprintfmt+0x3bc>
+  800666:	83 ec 08             	sub    $0x8,%esp
+  800669:	53                   	push   %ebx
+  80066a:	6a 30                	push   $0x30
+  80066c:	ff d6                	call   *%esi
+  80066e:	83 c4 08             	add    $0x8,%esp
+  800671:	53                   	push   %ebx
+  800672:	6a 78                	push   $0x78
+  800674:	ff d6                	call   *%esi
+  800676:	8b 45 14             	mov    0x14(%ebp),%eax
+  800679:	8b 10                	mov    (%eax),%edx
+  80067b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800680:	83 c4 10             	add    $0x10,%esp
+  800683:	8d 40 04             	lea    0x4(%eax),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+  800689:	bf 10 00 00 00       	mov    $0x10,%edi
+  80068e:	83 ec 0c             	sub    $0xc,%esp
+  800691:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800695:	50                   	push   %eax
+  800696:	ff 75 e0             	push   -0x20(%ebp)
+  800699:	57                   	push   %edi
+  80069a:	51                   	push   %ecx
+  80069b:	52                   	push   %edx
+  80069c:	89 da                	mov    %ebx,%edx
+  80069e:	89 f0                	mov    %esi,%eax
+  8006a0:	e8 4a fb ff ff       	call   8001ef <printnum>
+  8006a5:	83 c4 20             	add    $0x20,%esp
+  8006a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8006ab:	e9 40 fc ff ff       	jmp    8002f0 <vprintfmt+0x1e>
+  8006b0:	83 f9 01             	cmp    $0x1,%ecx
+  8006b3:	7f 1b                	jg     8006d0 <vprintfmt+0x3fe>
+  8006b5:	85 c9                	test   %ecx,%ecx
+  8006b7:	74 2c                	je     8006e5 <vprintfmt+0x413>
+  8006b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bc:	8b 10                	mov    (%eax),%edx
+  8006be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c9:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006ce:	eb be                	jmp    80068e <vprintfmt+0x3bc>
+  8006d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d3:	8b 10                	mov    (%eax),%edx
+  8006d5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d8:	8d 40 08             	lea    0x8(%eax),%eax
+  8006db:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006de:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006e3:	eb a9                	jmp    80068e <vprintfmt+0x3bc>
+  8006e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e8:	8b 10                	mov    (%eax),%edx
+  8006ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f5:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006fa:	eb 92                	jmp    80068e <vprintfmt+0x3bc>
+  8006fc:	83 ec 08             	sub    $0x8,%esp
+  8006ff:	53                   	push   %ebx
+  800700:	6a 25                	push   $0x25
+  800702:	ff d6                	call   *%esi
+  800704:	83 c4 10             	add    $0x10,%esp
+  800707:	eb 9f                	jmp    8006a8 <vprintfmt+0x3d6>
+  800709:	83 ec 08             	sub    $0x8,%esp
+  80070c:	53                   	push   %ebx
+  80070d:	6a 25                	push   $0x25
+  80070f:	ff d6                	call   *%esi
+  800711:	83 c4 10             	add    $0x10,%esp
+  800714:	89 f8                	mov    %edi,%eax
+  800716:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80071a:	74 05                	je     800721 <vprintfmt+0x44f>
+  80071c:	83 e8 01             	sub    $0x1,%eax
+  80071f:	eb f5                	jmp    800716 <vprintfmt+0x444>
+  800721:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800724:	eb 82                	jmp    8006a8 <vprintfmt+0x3d6>
+
+00800726 <vsnprintf>:
+  800726:	55                   	push   %ebp
+  800727:	89 e5                	mov    %esp,%ebp
+  800729:	83 ec 18             	sub    $0x18,%esp
+  80072c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80072f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800732:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800735:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800739:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80073c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800743:	85 c0                	test   %eax,%eax
+  800745:	74 26                	je     80076d <vsnprintf+0x47>
+  800747:	85 d2                	test   %edx,%edx
+  800749:	7e 22                	jle    80076d <vsnprintf+0x47>
+  80074b:	ff 75 14             	push   0x14(%ebp)
+  80074e:	ff 75 10             	push   0x10(%ebp)
+  800751:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800754:	50                   	push   %eax
+  800755:	68 98 02 80 00       	push   $0x800298
+  80075a:	e8 73 fb ff ff       	call   8002d2 <vprintfmt>
+  80075f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800762:	c6 00 00             	movb   $0x0,(%eax)
+  800765:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800768:	83 c4 10             	add    $0x10,%esp
+  80076b:	c9                   	leave
+  80076c:	c3                   	ret
+  80076d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800772:	eb f7                	jmp    80076b <vsnprintf+0x45>
+
+00800774 <snprintf>:
+  800774:	55                   	push   %ebp
+  800775:	89 e5                	mov    %esp,%ebp
+  800777:	83 ec 08             	sub    $0x8,%esp
+  80077a:	8d 45 14             	lea    0x14(%ebp),%eax
+  80077d:	50                   	push   %eax
+  80077e:	ff 75 10             	push   0x10(%ebp)
+  800781:	ff 75 0c             	push   0xc(%ebp)
+  800784:	ff 75 08             	push   0x8(%ebp)
+  800787:	e8 9a ff ff ff       	call   800726 <vsnprintf>
+  80078c:	c9                   	leave
+  80078d:	c3                   	ret
+
+0080078e <copy_fwd>:
+  80078e:	55                   	push   %ebp
+  80078f:	89 e5                	mov    %esp,%ebp
+  800791:	57                   	push   %edi
+  800792:	56                   	push   %esi
+  800793:	53                   	push   %ebx
+  800794:	89 c7                	mov    %eax,%edi
+  800796:	89 d6                	mov    %edx,%esi
+  800798:	89 c8                	mov    %ecx,%eax
+  80079a:	83 f9 0f             	cmp    $0xf,%ecx
+  80079d:	76 1c                	jbe    8007bb <copy_fwd+0x2d>
+  80079f:	89 f9                	mov    %edi,%ecx
+  8007a1:	f7 d9                	neg    %ecx
+  8007a3:	89 cb                	mov    %ecx,%ebx
+  8007a5:	83 e3 03             	and    $0x3,%ebx
+  8007a8:	29 d8                	sub    %ebx,%eax
+  8007aa:	89 c2                	mov    %eax,%edx
+  8007ac:	c1 ea 02             	shr    $0x2,%edx
+  8007af:	83 e0 03             	and    $0x3,%eax
+  8007b2:	89 d9                	mov    %ebx,%ecx
+  8007b4:	fc                   	cld
+  8007b5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8007b7:	89 d1                	mov    %edx,%ecx
+  8007b9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8007bb:	89 c1                	mov    %eax,%ecx
+  8007bd:	fc                   	cld
+  8007be:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8007c0:	5b                   	pop    %ebx
+  8007c1:	5e                   	pop    %esi
+  8007c2:	5f                   	pop    %edi
+  8007c3:	5d                   	pop    %ebp
+  8007c4:	c3                   	ret
+
+008007c5 <have_sse2>:
+  8007c5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007cc:	78 06                	js     8007d4 <have_sse2+0xf>
+  8007ce:	a1 04 30 80 00       	mov    0x803004,%eax
+  8007d3:	c3                   	ret
+  8007d4:	55                   	push   %ebp
+  8007d5:	89 e5                	mov    %esp,%ebp
+  8007d7:	53                   	push   %ebx
+  8007d8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007dd:	0f a2                	cpuid
+  8007df:	c1 ea 1a             	shr    $0x1a,%edx
+  8007e2:	83 e2 01             	and    $0x1,%edx
+  8007e5:	89 15 04 30 80 00    	mov    %edx,0x803004
+  8007eb:	a1 04 30 80 00       	mov    0x803004,%eax
+  8007f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007f3:	c9                   	leave
+  8007f4:	c3                   	ret
+
+008007f5 <strlen>:
+  8007f5:	55                   	push   %ebp
+  8007f6:	89 e5                	mov    %esp,%ebp
+  8007f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800800:	eb 03                	jmp    800805 <strlen+0x10>
+  800802:	83 c0 01             	add    $0x1,%eax
+  800805:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800809:	75 f7                	jne    800802 <strlen+0xd>
+  80080b:	5d                   	pop    %ebp
+  80080c:	c3                   	ret
+
+0080080d <strnlen>:
+  80080d:	55                   	push   %ebp
+  80080e:	89 e5                	mov    %esp,%ebp
+  800810:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800813:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800816:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081b:	eb 03                	jmp    800820 <strnlen+0x13>
+  80081d:	83 c0 01             	add    $0x1,%eax
+  800820:	39 d0                	cmp    %edx,%eax
+  800822:	74 08                	je     80082c <strnlen+0x1f>
+  800824:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800828:	75 f3                	jne    80081d <strnlen+0x10>
+  80082a:	89 c2                	mov    %eax,%edx
+  80082c:	89 d0                	mov    %edx,%eax
+  80082e:	5d                   	pop    %ebp
+  80082f:	c3                   	ret
+
+00800830 <strcpy>:
+  800830:	55                   	push   %ebp
+  800831:	89 e5                	mov    %esp,%ebp
+  800833:	53                   	push   %ebx
+  800834:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800837:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80083a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800843:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800846:	83 c0 01             	add    $0x1,%eax
+  800849:	84 d2                	test   %dl,%dl
+  80084b:	75 f2                	jne    80083f <strcpy+0xf>
+  80084d:	89 c8                	mov    %ecx,%eax
+  80084f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800852:	c9                   	leave
+  800853:	c3                   	ret
+
+00800854 <strcat>:
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	53                   	push   %ebx
+  800858:	83 ec 10             	sub    $0x10,%esp
+  80085b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80085e:	53                   	push   %ebx
+  80085f:	e8 91 ff ff ff       	call   8007f5 <strlen>
+  800864:	83 c4 08             	add    $0x8,%esp
+  800867:	ff 75 0c             	push   0xc(%ebp)
+  80086a:	01 d8                	add    %ebx,%eax
+  80086c:	50                   	push   %eax
+  80086d:	e8 be ff ff ff       	call   800830 <strcpy>
+  800872:	89 d8                	mov    %ebx,%eax
+  800874:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800877:	c9                   	leave
+  800878:	c3                   	ret
+
+00800879 <strncpy>:
+  800879:	55                   	push   %ebp
+  80087a:	89 e5                	mov    %esp,%ebp
+  80087c:	56                   	push   %esi
+  80087d:	53                   	push   %ebx
+  80087e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800881:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800884:	89 f3                	mov    %esi,%ebx
+  800886:	03 5d 10             	add    0x10(%ebp),%ebx
+  800889:	89 f0                	mov    %esi,%eax
+  80088b:	eb 0f                	jmp    80089c <strncpy+0x23>
+  80088d:	83 c0 01             	add    $0x1,%eax
+  800890:	0f b6 0a             	movzbl (%edx),%ecx
+  800893:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800896:	80 f9 01             	cmp    $0x1,%cl
+  800899:	83 da ff             	sbb    $0xffffffff,%edx
+  80089c:	39 d8                	cmp    %ebx,%eax
+  80089e:	75 ed                	jne    80088d <strncpy+0x14>
+  8008a0:	89 f0                	mov    %esi,%eax
+  8008a2:	5b                   	pop    %ebx
+  8008a3:	5e                   	pop    %esi
+  8008a4:	5d                   	pop    %ebp
+  8008a5:	c3                   	ret
+
+008008a6 <strlcpy>:
+  8008a6:	55                   	push   %ebp
+  8008a7:	89 e5                	mov    %esp,%ebp
+  8008a9:	56                   	push   %esi
+  8008aa:	53                   	push   %ebx
+  8008ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008b1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8008b4:	89 f0                	mov    %esi,%eax
+  8008b6:	85 d2                	test   %edx,%edx
+  8008b8:	74 21                	je     8008db <strlcpy+0x35>
+  8008ba:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008be:	89 f2                	mov    %esi,%edx
+  8008c0:	eb 09                	jmp    8008cb <strlcpy+0x25>
+  8008c2:	83 c1 01             	add    $0x1,%ecx
+  8008c5:	83 c2 01             	add    $0x1,%edx
+  8008c8:	88 5a ff             	mov    %bl,-0x1(%edx)
+  8008cb:	39 c2                	cmp    %eax,%edx
+  8008cd:	74 09                	je     8008d8 <strlcpy+0x32>
+  8008cf:	0f b6 19             	movzbl (%ecx),%ebx
+  8008d2:	84 db                	test   %bl,%bl
+  8008d4:	75 ec                	jne    8008c2 <strlcpy+0x1c>
+  8008d6:	89 d0                	mov    %edx,%eax
+  8008d8:	c6 00 00             	movb   $0x0,(%eax)
+  8008db:	29 f0                	sub    %esi,%eax
+  8008dd:	5b                   	pop    %ebx
+  8008de:	5e                   	pop    %esi
+  8008df:	5d                   	pop    %ebp
+  8008e0:	c3                   	ret
+
+008008e1 <strcmp>:
+  8008e1:	55                   	push   %ebp
+  8008e2:	89 e5                	mov    %esp,%ebp
+  8008e4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008ea:	eb 06                	jmp    8008f2 <strcmp+0x11>
+  8008ec:	83 c1 01             	add    $0x1,%ecx
+  8008ef:	83 c2 01             	add    $0x1,%edx
+  8008f2:	0f b6 01             	movzbl (%ecx),%eax
+  8008f5:	84 c0                	test   %al,%al
+  8008f7:	74 04                	je     8008fd <strcmp+0x1c>
+  8008f9:	3a 02                	cmp    (%edx),%al
+  8008fb:	74 ef                	je     8008ec <strcmp+0xb>
+  8008fd:	0f b6 c0             	movzbl %al,%eax
+  800900:	0f b6 12             	movzbl (%edx),%edx
+  800903:	29 d0                	sub    %edx,%eax
+  800905:	5d                   	pop    %ebp
+  800906:	c3                   	ret
+
+00800907 <strncmp>:
+  800907:	55                   	push   %ebp
+  800908:	89 e5                	mov    %esp,%ebp
+  80090a:	53                   	push   %ebx
+  80090b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800911:	8b 55 10             	mov    0x10(%ebp),%edx
+  800914:	eb 09                	jmp    80091f <strncmp+0x18>
+  800916:	83 ea 01             	sub    $0x1,%edx
+  800919:	83 c0 01             	add    $0x1,%eax
+  80091c:	83 c1 01             	add    $0x1,%ecx
+  80091f:	85 d2                	test   %edx,%edx
+  800921:	74 18                	je     80093b <strncmp+0x34>
+  800923:	0f b6 18             	movzbl (%eax),%ebx
+  800926:	84 db                	test   %bl,%bl
+  800928:	74 04                	je     80092e <strncmp+0x27>
+  80092a:	3a 19                	cmp    (%ecx),%bl
+  80092c:	74 e8                	je     800916 <strncmp+0xf>
+  80092e:	0f b6 00             	movzbl (%eax),%eax
+  800931:	0f b6 11             	movzbl (%ecx),%edx
+  800934:	29 d0                	sub    %edx,%eax
+  800936:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800939:	c9                   	leave
+  80093a:	c3                   	ret
+  80093b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800940:	eb f4                	jmp    800936 <strncmp+0x2f>
+
+00800942 <strchr>:
+  800942:	55                   	push   %ebp
+  800943:	89 e5                	mov    %esp,%ebp
+  800945:	8b 45 08             	mov    0x8(%ebp),%eax
+  800948:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80094c:	eb 03                	jmp    800951 <strchr+0xf>
+  80094e:	83 c0 01             	add    $0x1,%eax
+  800951:	0f b6 10             	movzbl (%eax),%edx
+  800954:	84 d2                	test   %dl,%dl
+  800956:	74 06                	je     80095e <strchr+0x1c>
+  800958:	38 ca                	cmp    %cl,%dl
+  80095a:	75 f2                	jne    80094e <strchr+0xc>
+  80095c:	eb 05                	jmp    800963 <strchr+0x21>
+  80095e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800963:	5d                   	pop    %ebp
+  800964:	c3                   	ret
+
+00800965 <strfind>:
+  800965:	55                   	push   %ebp
+  800966:	89 e5                	mov    %esp,%ebp
+  800968:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80096f:	0f b6 10             	movzbl (%eax),%edx
+  800972:	38 ca                	cmp    %cl,%dl
+  800974:	74 09                	je     80097f <strfind+0x1a>
+  800976:	84 d2                	test   %dl,%dl
+  800978:	74 05                	je     80097f <strfind+0x1a>
+  80097a:	83 c0 01             	add    $0x1,%eax
+  80097d:	eb f0                	jmp    80096f <strfind+0xa>
+  80097f:	5d                   	pop    %ebp
+  800980:	c3                   	ret
+
+00800981 <memset>:
+  800981:	55                   	push   %ebp
+  800982:	89 e5                	mov    %esp,%ebp
+  800984:	57                   	push   %edi
+  800985:	56                   	push   %esi
+  800986:	53                   	push   %ebx
+  800987:	83 ec 04             	sub    $0x4,%esp
+  80098a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80098d:	8b 55 10             	mov    0x10(%ebp),%edx
+  800990:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  800994:	89 f7                	mov    %esi,%edi
+  800996:	83 fa 0f             	cmp    $0xf,%edx
+  800999:	76 24                	jbe    8009bf <memset+0x3e>
+  80099b:	89 f1                	mov    %esi,%ecx
+  80099d:	f7 d9                	neg    %ecx
+  80099f:	83 e1 03             	and    $0x3,%ecx
+  8009a2:	29 ca                	sub    %ecx,%edx
+  8009a4:	89 d0                	mov    %edx,%eax
+  8009a6:	c1 e8 02             	shr    $0x2,%eax
+  8009a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  8009ac:	83 e2 03             	and    $0x3,%edx
+  8009af:	89 d8                	mov    %ebx,%eax
+  8009b1:	fc                   	cld
+  8009b2:	f3 aa                	rep stos %al,%es:(%edi)
+  8009b4:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  8009ba:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  8009bd:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009bf:	89 d1                	mov    %edx,%ecx
+  8009c1:	89 d8                	mov    %ebx,%eax
+  8009c3:	fc                   	cld
+  8009c4:	f3 aa                	rep stos %al,%es:(%edi)
+  8009c6:	89 f0                	mov    %esi,%eax
+  8009c8:	83 c4 04             	add    $0x4,%esp
+  8009cb:	5b                   	pop    %ebx
+  8009cc:	5e                   	pop    %esi
+  8009cd:	5f                   	pop    %edi
+  8009ce:	5d                   	pop    %ebp
+  8009cf:	c3                   	ret
+
+008009d0 <memmove>:
+  8009d0:	55                   	push   %ebp
+  8009d1:	89 e5                	mov    %esp,%ebp
+  8009d3:	57                   	push   %edi
+  8009d4:	56                   	push   %esi
+  8009d5:	53                   	push   %ebx
+  8009d6:	83 ec 0c             	sub    $0xc,%esp
+  8009d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009df:	8b 45 10             	mov    0x10(%ebp),%eax
+  8009e2:	85 c0                	test   %eax,%eax
+  8009e4:	74 14                	je     8009fa <memmove+0x2a>
+  8009e6:	39 da                	cmp    %ebx,%edx
+  8009e8:	73 07                	jae    8009f1 <memmove+0x21>
+  8009ea:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8009ed:	39 cb                	cmp    %ecx,%ebx
+  8009ef:	72 13                	jb     800a04 <memmove+0x34>
+  8009f1:	89 c1                	mov    %eax,%ecx
+  8009f3:	89 d8                	mov    %ebx,%eax
+  8009f5:	e8 94 fd ff ff       	call   80078e <copy_fwd>
+  8009fa:	89 d8                	mov    %ebx,%eax
+  8009fc:	83 c4 0c             	add    $0xc,%esp
+  8009ff:	5b                   	pop    %ebx
+  800a00:	5e                   	pop    %esi
+  800a01:	5f                   	pop    %edi
+  800a02:	5d                   	pop    %ebp
+  800a03:	c3                   	ret
+  800a04:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800a07:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800a0a:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800a0d:	83 f8 0f             	cmp    $0xf,%eax
+  800a10:	76 23                	jbe    800a35 <memmove+0x65>
+  800a12:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800a15:	83 e1 03             	and    $0x3,%ecx
+  800a18:	29 c8                	sub    %ecx,%eax
+  800a1a:	89 c2                	mov    %eax,%edx
+  800a1c:	c1 ea 02             	shr    $0x2,%edx
+  800a1f:	83 e0 03             	and    $0x3,%eax
+  800a22:	fd                   	std
+  800a23:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a25:	83 ef 03             	sub    $0x3,%edi
+  800a28:	83 ee 03             	sub    $0x3,%esi
+  800a2b:	89 d1                	mov    %edx,%ecx
+  800a2d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a2f:	83 c7 03             	add    $0x3,%edi
+  800a32:	83 c6 03             	add    $0x3,%esi
+  800a35:	89 c1                	mov    %eax,%ecx
+  800a37:	fd                   	std
+  800a38:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a3a:	fc                   	cld
+  800a3b:	eb bd                	jmp    8009fa <memmove+0x2a>
+
+00800a3d <memcpy>:
+  800a3d:	55                   	push   %ebp
+  800a3e:	89 e5                	mov    %esp,%ebp
+  800a40:	53                   	push   %ebx
+  800a41:	83 ec 04             	sub    $0x4,%esp
+  800a44:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a47:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a4a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a4d:	89 d8                	mov    %ebx,%eax
+  800a4f:	e8 3a fd ff ff       	call   80078e <copy_fwd>
+  800a54:	89 d8                	mov    %ebx,%eax
+  800a56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a59:	c9                   	leave
+  800a5a:	c3                   	ret
+
+00800a5b <page_copy>:
+  800a5b:	55                   	push   %ebp
+  800a5c:	89 e5                	mov    %esp,%ebp
+  800a5e:	57                   	push   %edi
+  800a5f:	56                   	push   %esi
+  800a60:	53                   	push   %ebx
+  800a61:	83 ec 0c             	sub    $0xc,%esp
+  800a64:	e8 5c fd ff ff       	call   8007c5 <have_sse2>
+  800a69:	85 c0                	test   %eax,%eax
+  800a6b:	74 39                	je     800aa6 <page_copy+0x4b>
+  800a6d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a70:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a73:	be 00 01 00 00       	mov    $0x100,%esi
+  800a78:	8b 03                	mov    (%ebx),%eax
+  800a7a:	8b 53 04             	mov    0x4(%ebx),%edx
+  800a7d:	0f c3 01             	movnti %eax,(%ecx)
+  800a80:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800a84:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a87:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800a8a:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800a8e:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800a92:	83 c3 10             	add    $0x10,%ebx
+  800a95:	83 c1 10             	add    $0x10,%ecx
+  800a98:	4e                   	dec    %esi
+  800a99:	75 dd                	jne    800a78 <page_copy+0x1d>
+  800a9b:	0f ae f8             	sfence
+  800a9e:	83 c4 0c             	add    $0xc,%esp
+  800aa1:	5b                   	pop    %ebx
+  800aa2:	5e                   	pop    %esi
+  800aa3:	5f                   	pop    %edi
+  800aa4:	5d                   	pop    %ebp
+  800aa5:	c3                   	ret
+  800aa6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800aa9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aac:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800ab1:	fc                   	cld
+  800ab2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ab4:	eb e8                	jmp    800a9e <page_copy+0x43>
+
+00800ab6 <page_zero>:
+  800ab6:	55                   	push   %ebp
+  800ab7:	89 e5                	mov    %esp,%ebp
+  800ab9:	57                   	push   %edi
+  800aba:	83 ec 04             	sub    $0x4,%esp
+  800abd:	e8 03 fd ff ff       	call   8007c5 <have_sse2>
+  800ac2:	85 c0                	test   %eax,%eax
+  800ac4:	74 3a                	je     800b00 <page_zero+0x4a>
+  800ac6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac9:	ba 80 00 00 00       	mov    $0x80,%edx
+  800ace:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad3:	0f c3 08             	movnti %ecx,(%eax)
+  800ad6:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800ada:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800ade:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800ae2:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800ae6:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800aea:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800aee:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800af2:	83 c0 20             	add    $0x20,%eax
+  800af5:	4a                   	dec    %edx
+  800af6:	75 db                	jne    800ad3 <page_zero+0x1d>
+  800af8:	0f ae f8             	sfence
+  800afb:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800afe:	c9                   	leave
+  800aff:	c3                   	ret
+  800b00:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b03:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800b08:	fc                   	cld
+  800b09:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b0b:	eb ee                	jmp    800afb <page_zero+0x45>
+
+00800b0d <memcmp>:
+  800b0d:	55                   	push   %ebp
+  800b0e:	89 e5                	mov    %esp,%ebp
+  800b10:	56                   	push   %esi
+  800b11:	53                   	push   %ebx
+  800b12:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b15:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b18:	89 c6                	mov    %eax,%esi
+  800b1a:	03 75 10             	add    0x10(%ebp),%esi
+  800b1d:	eb 06                	jmp    800b25 <memcmp+0x18>
+  800b1f:	83 c0 01             	add    $0x1,%eax
+  800b22:	83 c2 01             	add    $0x1,%edx
+  800b25:	39 f0                	cmp    %esi,%eax
+  800b27:	74 14                	je     800b3d <memcmp+0x30>
+  800b29:	0f b6 08             	movzbl (%eax),%ecx
+  800b2c:	0f b6 1a             	movzbl (%edx),%ebx
+  800b2f:	38 d9                	cmp    %bl,%cl
+  800b31:	74 ec                	je     800b1f <memcmp+0x12>
+  800b33:	0f b6 c1             	movzbl %cl,%eax
+  800b36:	0f b6 db             	movzbl %bl,%ebx
+  800b39:	29 d8                	sub    %ebx,%eax
+  800b3b:	eb 05                	jmp    800b42 <memcmp+0x35>
+  800b3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b42:	5b                   	pop    %ebx
+  800b43:	5e                   	pop    %esi
+  800b44:	5d                   	pop    %ebp
+  800b45:	c3                   	ret
+
+00800b46 <memfind>:
+  800b46:	55                   	push   %ebp
+  800b47:	89 e5                	mov    %esp,%ebp
+  800b49:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b4f:	89 c2                	mov    %eax,%edx
+  800b51:	03 55 10             	add    0x10(%ebp),%edx
+  800b54:	eb 03                	jmp    800b59 <memfind+0x13>
+  800b56:	83 c0 01             	add    $0x1,%eax
+  800b59:	39 d0                	cmp    %edx,%eax
+  800b5b:	73 04                	jae    800b61 <memfind+0x1b>
+  800b5d:	38 08                	cmp    %cl,(%eax)
+  800b5f:	75 f5                	jne    800b56 <memfind+0x10>
+  800b61:	5d                   	pop    %ebp
+  800b62:	c3                   	ret
+
+00800b63 <strtol>:
+  800b63:	55                   	push   %ebp
+  800b64:	89 e5                	mov    %esp,%ebp
+  800b66:	57                   	push   %edi
+  800b67:	56                   	push   %esi
+  800b68:	53                   	push   %ebx
+  800b69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b6f:	eb 03                	jmp    800b74 <strtol+0x11>
+  800b71:	83 c2 01             	add    $0x1,%edx
+  800b74:	0f b6 02             	movzbl (%edx),%eax
+  800b77:	3c 20                	cmp    $0x20,%al
+  800b79:	74 f6                	je     800b71 <strtol+0xe>
+  800b7b:	3c 09                	cmp    $0x9,%al
+  800b7d:	74 f2                	je     800b71 <strtol+0xe>
+  800b7f:	3c 2b                	cmp    $0x2b,%al
+  800b81:	74 2a                	je     800bad <strtol+0x4a>
+  800b83:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b88:	3c 2d                	cmp    $0x2d,%al
+  800b8a:	74 2b                	je     800bb7 <strtol+0x54>
+  800b8c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b92:	75 0f                	jne    800ba3 <strtol+0x40>
+  800b94:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b97:	74 28                	je     800bc1 <strtol+0x5e>
+  800b99:	85 db                	test   %ebx,%ebx
+  800b9b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ba0:	0f 44 d8             	cmove  %eax,%ebx
+  800ba3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba8:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bab:	eb 46                	jmp    800bf3 <strtol+0x90>
+  800bad:	83 c2 01             	add    $0x1,%edx
+  800bb0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bb5:	eb d5                	jmp    800b8c <strtol+0x29>
+  800bb7:	83 c2 01             	add    $0x1,%edx
+  800bba:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bbf:	eb cb                	jmp    800b8c <strtol+0x29>
+  800bc1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bc5:	74 0e                	je     800bd5 <strtol+0x72>
+  800bc7:	85 db                	test   %ebx,%ebx
+  800bc9:	75 d8                	jne    800ba3 <strtol+0x40>
+  800bcb:	83 c2 01             	add    $0x1,%edx
+  800bce:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bd3:	eb ce                	jmp    800ba3 <strtol+0x40>
+  800bd5:	83 c2 02             	add    $0x2,%edx
+  800bd8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bdd:	eb c4                	jmp    800ba3 <strtol+0x40>
+  800bdf:	0f be c0             	movsbl %al,%eax
+  800be2:	83 e8 30             	sub    $0x30,%eax
+  800be5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800be8:	7d 3a                	jge    800c24 <strtol+0xc1>
+  800bea:	83 c2 01             	add    $0x1,%edx
+  800bed:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bf1:	01 c1                	add    %eax,%ecx
+  800bf3:	0f b6 02             	movzbl (%edx),%eax
+  800bf6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bf9:	89 f3                	mov    %esi,%ebx
+  800bfb:	80 fb 09             	cmp    $0x9,%bl
+  800bfe:	76 df                	jbe    800bdf <strtol+0x7c>
+  800c00:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c03:	89 f3                	mov    %esi,%ebx
+  800c05:	80 fb 19             	cmp    $0x19,%bl
+  800c08:	77 08                	ja     800c12 <strtol+0xaf>
+  800c0a:	0f be c0             	movsbl %al,%eax
+  800c0d:	83 e8 57             	sub    $0x57,%eax
+  800c10:	eb d3                	jmp    800be5 <strtol+0x82>
+  800c12:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c15:	89 f3                	mov    %esi,%ebx
+  800c17:	80 fb 19             	cmp    $0x19,%bl
+  800c1a:	77 08                	ja     800c24 <strtol+0xc1>
+  800c1c:	0f be c0             	movsbl %al,%eax
+  800c1f:	83 e8 37             	sub    $0x37,%eax
+  800c22:	eb c1                	jmp    800be5 <strtol+0x82>
+  800c24:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c28:	74 05                	je     800c2f <strtol+0xcc>
+  800c2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c2d:	89 10                	mov    %edx,(%eax)
+  800c2f:	89 c8                	mov    %ecx,%eax
+  800c31:	f7 d8                	neg    %eax
+  800c33:	85 ff                	test   %edi,%edi
+  800c35:	0f 45 c8             	cmovne %eax,%ecx
+  800c38:	89 c8                	mov    %ecx,%eax
+  800c3a:	5b                   	pop    %ebx
+  800c3b:	5e                   	pop    %esi
+  800c3c:	5f                   	pop    %edi
+  800c3d:	5d                   	pop    %ebp
+  800c3e:	c3                   	ret
+
+00800c3f <sys_cputs>:
+  800c3f:	55                   	push   %ebp
+  800c40:	89 e5                	mov    %esp,%ebp
+  800c42:	57                   	push   %edi
+  800c43:	56                   	push   %esi
+  800c44:	53                   	push   %ebx
+  800c45:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c4c:	78 21                	js     800c6f <sys_cputs+0x30>
+  800c4e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c55:	75 2d                	jne    800c84 <sys_cputs+0x45>
+  800c57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c62:	89 c3                	mov    %eax,%ebx
+  800c64:	89 c7                	mov    %eax,%edi
+  800c66:	89 c6                	mov    %eax,%esi
+  800c68:	cd 30                	int    $0x30
+  800c6a:	5b                   	pop    %ebx
+  800c6b:	5e                   	pop    %esi
+  800c6c:	5f                   	pop    %edi
+  800c6d:	5d                   	pop    %ebp
+  800c6e:	c3                   	ret
+  800c6f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c74:	0f a2                	cpuid
+  800c76:	c1 ea 0b             	shr    $0xb,%edx
+  800c79:	83 e2 01             	and    $0x1,%edx
+  800c7c:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800c82:	eb ca                	jmp    800c4e <sys_cputs+0xf>
+  800c84:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8f:	89 c3                	mov    %eax,%ebx
+  800c91:	89 c7                	mov    %eax,%edi
+  800c93:	89 c6                	mov    %eax,%esi
+  800c95:	55                   	push   %ebp
+  800c96:	68 9f 0c 80 00       	push   $0x800c9f
+  800c9b:	89 e5                	mov    %esp,%ebp
+  800c9d:	0f 34                	sysenter
+  800c9f:	83 c4 04             	add    $0x4,%esp
+  800ca2:	5d                   	pop    %ebp
+  800ca3:	eb c5                	jmp    800c6a <sys_cputs+0x2b>
+
+00800ca5 <sys_cgetc>:
+  800ca5:	55                   	push   %ebp
+  800ca6:	89 e5                	mov    %esp,%ebp
+  800ca8:	57                   	push   %edi
+  800ca9:	56                   	push   %esi
+  800caa:	53                   	push   %ebx
+  800cab:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800cb2:	78 22                	js     800cd6 <sys_cgetc+0x31>
+  800cb4:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800cbb:	75 2e                	jne    800ceb <sys_cgetc+0x46>
+  800cbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc2:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cc7:	89 d1                	mov    %edx,%ecx
+  800cc9:	89 d3                	mov    %edx,%ebx
+  800ccb:	89 d7                	mov    %edx,%edi
+  800ccd:	89 d6                	mov    %edx,%esi
+  800ccf:	cd 30                	int    $0x30
+  800cd1:	5b                   	pop    %ebx
+  800cd2:	5e                   	pop    %esi
+  800cd3:	5f                   	pop    %edi
+  800cd4:	5d                   	pop    %ebp
+  800cd5:	c3                   	ret
+  800cd6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cdb:	0f a2                	cpuid
+  800cdd:	c1 ea 0b             	shr    $0xb,%edx
+  800ce0:	83 e2 01             	and    $0x1,%edx
+  800ce3:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800ce9:	eb c9                	jmp    800cb4 <sys_cgetc+0xf>
+  800ceb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cf5:	89 d1                	mov    %edx,%ecx
+  800cf7:	89 d3                	mov    %edx,%ebx
+  800cf9:	89 d7                	mov    %edx,%edi
+  800cfb:	89 d6                	mov    %edx,%esi
+  800cfd:	55                   	push   %ebp
+  800cfe:	68 07 0d 80 00       	push   $0x800d07
+  800d03:	89 e5                	mov    %esp,%ebp
+  800d05:	0f 34                	sysenter
+  800d07:	83 c4 04             	add    $0x4,%esp
+  800d0a:	5d                   	pop    %ebp
+  800d0b:	eb c4                	jmp    800cd1 <sys_cgetc+0x2c>
+
+00800d0d <sys_env_destroy>:
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	57                   	push   %edi
+  800d11:	56                   	push   %esi
+  800d12:	53                   	push   %ebx
+  800d13:	83 ec 0c             	sub    $0xc,%esp
+  800d16:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d1d:	78 2a                	js     800d49 <sys_env_destroy+0x3c>
+  800d1f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d26:	75 36                	jne    800d5e <sys_env_destroy+0x51>
+  800d28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d2d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d35:	89 cb                	mov    %ecx,%ebx
+  800d37:	89 cf                	mov    %ecx,%edi
+  800d39:	89 ce                	mov    %ecx,%esi
+  800d3b:	cd 30                	int    $0x30
+  800d3d:	85 c0                	test   %eax,%eax
+  800d3f:	7f 40                	jg     800d81 <sys_env_destroy+0x74>
+  800d41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d44:	5b                   	pop    %ebx
+  800d45:	5e                   	pop    %esi
+  800d46:	5f                   	pop    %edi
+  800d47:	5d                   	pop    %ebp
+  800d48:	c3                   	ret
+  800d49:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d4e:	0f a2                	cpuid
+  800d50:	c1 ea 0b             	shr    $0xb,%edx
+  800d53:	83 e2 01             	and    $0x1,%edx
+  800d56:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800d5c:	eb c1                	jmp    800d1f <sys_env_destroy+0x12>
+  800d5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d66:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d6b:	89 cb                	mov    %ecx,%ebx
+  800d6d:	89 cf                	mov    %ecx,%edi
+  800d6f:	89 ce                	mov    %ecx,%esi
+  800d71:	55                   	push   %ebp
+  800d72:	68 7b 0d 80 00       	push   $0x800d7b
+  800d77:	89 e5                	mov    %esp,%ebp
+  800d79:	0f 34                	sysenter
+  800d7b:	83 c4 04             	add    $0x4,%esp
+  800d7e:	5d                   	pop    %ebp
+  800d7f:	eb bc                	jmp    800d3d <sys_env_destroy+0x30>
+  800d81:	83 ec 0c             	sub    $0xc,%esp
+  800d84:	50                   	push   %eax
+  800d85:	6a 03                	push   $0x3
+  800d87:	68 44 20 80 00       	push   $0x802044
+  800d8c:	6a 49                	push   $0x49
+  800d8e:	68 61 20 80 00       	push   $0x802061
+  800d93:	e8 f3 0c 00 00       	call   801a8b <_panic>
+
+00800d98 <sys_getenvid>:
+  800d98:	55                   	push   %ebp
+  800d99:	89 e5                	mov    %esp,%ebp
+  800d9b:	57                   	push   %edi
+  800d9c:	56                   	push   %esi
+  800d9d:	53                   	push   %ebx
+  800d9e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800da5:	78 22                	js     800dc9 <sys_getenvid+0x31>
+  800da7:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800dae:	75 2e                	jne    800dde <sys_getenvid+0x46>
+  800db0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db5:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dba:	89 d1                	mov    %edx,%ecx
+  800dbc:	89 d3                	mov    %edx,%ebx
+  800dbe:	89 d7                	mov    %edx,%edi
+  800dc0:	89 d6                	mov    %edx,%esi
+  800dc2:	cd 30                	int    $0x30
+  800dc4:	5b                   	pop    %ebx
+  800dc5:	5e                   	pop    %esi
+  800dc6:	5f                   	pop    %edi
+  800dc7:	5d                   	pop    %ebp
+  800dc8:	c3                   	ret
+  800dc9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dce:	0f a2                	cpuid
+  800dd0:	c1 ea 0b             	shr    $0xb,%edx
+  800dd3:	83 e2 01             	and    $0x1,%edx
+  800dd6:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800ddc:	eb c9                	jmp    800da7 <sys_getenvid+0xf>
+  800dde:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800de8:	89 d1                	mov    %edx,%ecx
+  800dea:	89 d3                	mov    %edx,%ebx
+  800dec:	89 d7                	mov    %edx,%edi
+  800dee:	89 d6                	mov    %edx,%esi
+  800df0:	55                   	push   %ebp
+  800df1:	68 fa 0d 80 00       	push   $0x800dfa
+  800df6:	89 e5                	mov    %esp,%ebp
+  800df8:	0f 34                	sysenter
+  800dfa:	83 c4 04             	add    $0x4,%esp
+  800dfd:	5d                   	pop    %ebp
+  800dfe:	eb c4                	jmp    800dc4 <sys_getenvid+0x2c>
+
+00800e00 <sys_yield>:
+  800e00:	55                   	push   %ebp
+  800e01:	89 e5                	mov    %esp,%ebp
+  800e03:	57                   	push   %edi
+  800e04:	56                   	push   %esi
+  800e05:	53                   	push   %ebx
+  800e06:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e0d:	78 22                	js     800e31 <sys_yield+0x31>
+  800e0f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e16:	75 2e                	jne    800e46 <sys_yield+0x46>
+  800e18:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e22:	89 d1                	mov    %edx,%ecx
+  800e24:	89 d3                	mov    %edx,%ebx
+  800e26:	89 d7                	mov    %edx,%edi
+  800e28:	89 d6                	mov    %edx,%esi
+  800e2a:	cd 30                	int    $0x30
+  800e2c:	5b                   	pop    %ebx
+  800e2d:	5e                   	pop    %esi
+  800e2e:	5f                   	pop    %edi
+  800e2f:	5d                   	pop    %ebp
+  800e30:	c3                   	ret
+  800e31:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e36:	0f a2                	cpuid
+  800e38:	c1 ea 0b             	shr    $0xb,%edx
+  800e3b:	83 e2 01             	and    $0x1,%edx
+  800e3e:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800e44:	eb c9                	jmp    800e0f <sys_yield+0xf>
+  800e46:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e50:	89 d1                	mov    %edx,%ecx
+  800e52:	89 d3                	mov    %edx,%ebx
+  800e54:	89 d7                	mov    %edx,%edi
+  800e56:	89 d6                	mov    %edx,%esi
+  800e58:	55                   	push   %ebp
+  800e59:	68 62 0e 80 00       	push   $0x800e62
+  800e5e:	89 e5                	mov    %esp,%ebp
+  800e60:	0f 34                	sysenter
+  800e62:	83 c4 04             	add    $0x4,%esp
+  800e65:	5d                   	pop    %ebp
+  800e66:	eb c4                	jmp    800e2c <sys_yield+0x2c>
+
+00800e68 <sys_env_set_cow>:
+  800e68:	55                   	push   %ebp
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	57                   	push   %edi
+  800e6c:	56                   	push   %esi
+  800e6d:	53                   	push   %ebx
+  800e6e:	83 ec 0c             	sub    $0xc,%esp
+  800e71:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e78:	78 2b                	js     800ea5 <sys_env_set_cow+0x3d>
+  800e7a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e81:	75 37                	jne    800eba <sys_env_set_cow+0x52>
+  800e83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e88:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e93:	89 df                	mov    %ebx,%edi
+  800e95:	89 de                	mov    %ebx,%esi
+  800e97:	cd 30                	int    $0x30
+  800e99:	85 c0                	test   %eax,%eax
+  800e9b:	7f 41                	jg     800ede <sys_env_set_cow+0x76>
+  800e9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea0:	5b                   	pop    %ebx
+  800ea1:	5e                   	pop    %esi
+  800ea2:	5f                   	pop    %edi
+  800ea3:	5d                   	pop    %ebp
+  800ea4:	c3                   	ret
+  800ea5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eaa:	0f a2                	cpuid
+  800eac:	c1 ea 0b             	shr    $0xb,%edx
+  800eaf:	83 e2 01             	and    $0x1,%edx
+  800eb2:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800eb8:	eb c0                	jmp    800e7a <sys_env_set_cow+0x12>
+  800eba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eca:	89 df                	mov    %ebx,%edi
+  800ecc:	89 de                	mov    %ebx,%esi
+  800ece:	55                   	push   %ebp
+  800ecf:	68 d8 0e 80 00       	push   $0x800ed8
+  800ed4:	89 e5                	mov    %esp,%ebp
+  800ed6:	0f 34                	sysenter
+  800ed8:	83 c4 04             	add    $0x4,%esp
+  800edb:	5d                   	pop    %ebp
+  800edc:	eb bb                	jmp    800e99 <sys_env_set_cow+0x31>
+  800ede:	83 ec 0c             	sub    $0xc,%esp
+  800ee1:	50                   	push   %eax
+  800ee2:	6a 0d                	push   $0xd
+  800ee4:	68 44 20 80 00       	push   $0x802044
+  800ee9:	6a 49                	push   $0x49
+  800eeb:	68 61 20 80 00       	push   $0x802061
+  800ef0:	e8 96 0b 00 00       	call   801a8b <_panic>
+
+00800ef5 <sys_env_set_quota>:
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	57                   	push   %edi
+  800ef9:	56                   	push   %esi
+  800efa:	53                   	push   %ebx
+  800efb:	83 ec 0c             	sub    $0xc,%esp
+  800efe:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f05:	78 2b                	js     800f32 <sys_env_set_quota+0x3d>
+  800f07:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f0e:	75 37                	jne    800f47 <sys_env_set_quota+0x52>
+  800f10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f15:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f20:	89 df                	mov    %ebx,%edi
+  800f22:	89 de                	mov    %ebx,%esi
+  800f24:	cd 30                	int    $0x30
+  800f26:	85 c0                	test   %eax,%eax
+  800f28:	7f 41                	jg     800f6b <sys_env_set_quota+0x76>
+  800f2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2d:	5b                   	pop    %ebx
+  800f2e:	5e                   	pop    %esi
+  800f2f:	5f                   	pop    %edi
+  800f30:	5d                   	pop    %ebp
+  800f31:	c3                   	ret
+  800f32:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f37:	0f a2                	cpuid
+  800f39:	c1 ea 0b             	shr    $0xb,%edx
+  800f3c:	83 e2 01             	and    $0x1,%edx
+  800f3f:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800f45:	eb c0                	jmp    800f07 <sys_env_set_quota+0x12>
+  800f47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f52:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f57:	89 df                	mov    %ebx,%edi
+  800f59:	89 de                	mov    %ebx,%esi
+  800f5b:	55                   	push   %ebp
+  800f5c:	68 65 0f 80 00       	push   $0x800f65
+  800f61:	89 e5                	mov    %esp,%ebp
+  800f63:	0f 34                	sysenter
+  800f65:	83 c4 04             	add    $0x4,%esp
+  800f68:	5d                   	pop    %ebp
+  800f69:	eb bb                	jmp    800f26 <sys_env_set_quota+0x31>
+  800f6b:	83 ec 0c             	sub    $0xc,%esp
+  800f6e:	50                   	push   %eax
+  800f6f:	6a 0f                	push   $0xf
+  800f71:	68 44 20 80 00       	push   $0x802044
+  800f76:	6a 49                	push   $0x49
+  800f78:	68 61 20 80 00       	push   $0x802061
+  800f7d:	e8 09 0b 00 00       	call   801a8b <_panic>
+
+00800f82 <sys_page_alloc>:
+  800f82:	55                   	push   %ebp
+  800f83:	89 e5                	mov    %esp,%ebp
+  800f85:	57                   	push   %edi
+  800f86:	56                   	push   %esi
+  800f87:	53                   	push   %ebx
+  800f88:	83 ec 0c             	sub    $0xc,%esp
+  800f8b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f92:	78 2c                	js     800fc0 <sys_page_alloc+0x3e>
+  800f94:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f9b:	75 38                	jne    800fd5 <sys_page_alloc+0x53>
+  800f9d:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fa7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800faa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb0:	89 f7                	mov    %esi,%edi
+  800fb2:	cd 30                	int    $0x30
+  800fb4:	85 c0                	test   %eax,%eax
+  800fb6:	7f 42                	jg     800ffa <sys_page_alloc+0x78>
+  800fb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbb:	5b                   	pop    %ebx
+  800fbc:	5e                   	pop    %esi
+  800fbd:	5f                   	pop    %edi
+  800fbe:	5d                   	pop    %ebp
+  800fbf:	c3                   	ret
+  800fc0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fc5:	0f a2                	cpuid
+  800fc7:	c1 ea 0b             	shr    $0xb,%edx
+  800fca:	83 e2 01             	and    $0x1,%edx
+  800fcd:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800fd3:	eb bf                	jmp    800f94 <sys_page_alloc+0x12>
+  800fd5:	be 00 00 00 00       	mov    $0x0,%esi
+  800fda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fe5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe8:	89 f7                	mov    %esi,%edi
+  800fea:	55                   	push   %ebp
+  800feb:	68 f4 0f 80 00       	push   $0x800ff4
+  800ff0:	89 e5                	mov    %esp,%ebp
+  800ff2:	0f 34                	sysenter
+  800ff4:	83 c4 04             	add    $0x4,%esp
+  800ff7:	5d                   	pop    %ebp
+  800ff8:	eb ba                	jmp    800fb4 <sys_page_alloc+0x32>
+  800ffa:	83 ec 0c             	sub    $0xc,%esp
+  800ffd:	50                   	push   %eax
+  800ffe:	6a 04                	push   $0x4
+  801000:	68 44 20 80 00       	push   $0x802044
+  801005:	6a 49                	push   $0x49
+  801007:	68 61 20 80 00       	push   $0x802061
+  80100c:	e8 7a 0a 00 00       	call   801a8b <_panic>
+
+00801011 <sys_page_map>:
+  801011:	55                   	push   %ebp
+  801012:	89 e5                	mov    %esp,%ebp
+  801014:	57                   	push   %edi
+  801015:	56                   	push   %esi
+  801016:	53                   	push   %ebx
+  801017:	83 ec 0c             	sub    $0xc,%esp
+  80101a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801021:	78 2b                	js     80104e <sys_page_map+0x3d>
+  801023:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80102a:	75 37                	jne    801063 <sys_page_map+0x52>
+  80102c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801031:	8b 55 08             	mov    0x8(%ebp),%edx
+  801034:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801037:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80103a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80103d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801040:	cd 30                	int    $0x30
+  801042:	85 c0                	test   %eax,%eax
+  801044:	7f 41                	jg     801087 <sys_page_map+0x76>
+  801046:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801049:	5b                   	pop    %ebx
+  80104a:	5e                   	pop    %esi
+  80104b:	5f                   	pop    %edi
+  80104c:	5d                   	pop    %ebp
+  80104d:	c3                   	ret
+  80104e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801053:	0f a2                	cpuid
+  801055:	c1 ea 0b             	shr    $0xb,%edx
+  801058:	83 e2 01             	and    $0x1,%edx
+  80105b:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801061:	eb c0                	jmp    801023 <sys_page_map+0x12>
+  801063:	8b 55 08             	mov    0x8(%ebp),%edx
+  801066:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801069:	b8 05 00 00 00       	mov    $0x5,%eax
+  80106e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801071:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801074:	8b 75 18             	mov    0x18(%ebp),%esi
+  801077:	55                   	push   %ebp
+  801078:	68 81 10 80 00       	push   $0x801081
+  80107d:	89 e5                	mov    %esp,%ebp
+  80107f:	0f 34                	sysenter
+  801081:	83 c4 04             	add    $0x4,%esp
+  801084:	5d                   	pop    %ebp
+  801085:	eb bb                	jmp    801042 <sys_page_map+0x31>
+  801087:	83 ec 0c             	sub    $0xc,%esp
+  80108a:	50                   	push   %eax
+  80108b:	6a 05                	push   $0x5
+  80108d:	68 44 20 80 00       	push   $0x802044
+  801092:	6a 49                	push   $0x49
+  801094:	68 61 20 80 00       	push   $0x802061
+  801099:	e8 ed 09 00 00       	call   801a8b <_panic>
+
+0080109e <sys_page_unmap>:
+  80109e:	55                   	push   %ebp
+  80109f:	89 e5                	mov    %esp,%ebp
+  8010a1:	57                   	push   %edi
+  8010a2:	56                   	push   %esi
+  8010a3:	53                   	push   %ebx
+  8010a4:	83 ec 0c             	sub    $0xc,%esp
+  8010a7:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8010ae:	78 2b                	js     8010db <sys_page_unmap+0x3d>
+  8010b0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8010b7:	75 37                	jne    8010f0 <sys_page_unmap+0x52>
+  8010b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010be:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c9:	89 df                	mov    %ebx,%edi
+  8010cb:	89 de                	mov    %ebx,%esi
+  8010cd:	cd 30                	int    $0x30
+  8010cf:	85 c0                	test   %eax,%eax
+  8010d1:	7f 41                	jg     801114 <sys_page_unmap+0x76>
+  8010d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d6:	5b                   	pop    %ebx
+  8010d7:	5e                   	pop    %esi
+  8010d8:	5f                   	pop    %edi
+  8010d9:	5d                   	pop    %ebp
+  8010da:	c3                   	ret
+  8010db:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010e0:	0f a2                	cpuid
+  8010e2:	c1 ea 0b             	shr    $0xb,%edx
+  8010e5:	83 e2 01             	and    $0x1,%edx
+  8010e8:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8010ee:	eb c0                	jmp    8010b0 <sys_page_unmap+0x12>
+  8010f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fb:	b8 06 00 00 00       	mov    $0x6,%eax
+  801100:	89 df                	mov    %ebx,%edi
+  801102:	89 de                	mov    %ebx,%esi
+  801104:	55                   	push   %ebp
+  801105:	68 0e 11 80 00       	push   $0x80110e
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	0f 34                	sysenter
+  80110e:	83 c4 04             	add    $0x4,%esp
+  801111:	5d                   	pop    %ebp
+  801112:	eb bb                	jmp    8010cf <sys_page_unmap+0x31>
+  801114:	83 ec 0c             	sub    $0xc,%esp
+  801117:	50                   	push   %eax
+  801118:	6a 06                	push   $0x6
+  80111a:	68 44 20 80 00       	push   $0x802044
+  80111f:	6a 49                	push   $0x49
+  801121:	68 61 20 80 00       	push   $0x802061
+  801126:	e8 60 09 00 00       	call   801a8b <_panic>
+
+0080112b <sys_page_reuse>:
+  80112b:	55                   	push   %ebp
+  80112c:	89 e5                	mov    %esp,%ebp
+  80112e:	57                   	push   %edi
+  80112f:	56                   	push   %esi
+  801130:	53                   	push   %ebx
+  801131:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801138:	78 24                	js     80115e <sys_page_reuse+0x33>
+  80113a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801141:	75 30                	jne    801173 <sys_page_reuse+0x48>
+  801143:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801148:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80114d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801150:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801153:	89 df                	mov    %ebx,%edi
+  801155:	89 de                	mov    %ebx,%esi
+  801157:	cd 30                	int    $0x30
+  801159:	5b                   	pop    %ebx
+  80115a:	5e                   	pop    %esi
+  80115b:	5f                   	pop    %edi
+  80115c:	5d                   	pop    %ebp
+  80115d:	c3                   	ret
+  80115e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801163:	0f a2                	cpuid
+  801165:	c1 ea 0b             	shr    $0xb,%edx
+  801168:	83 e2 01             	and    $0x1,%edx
+  80116b:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801171:	eb c7                	jmp    80113a <sys_page_reuse+0xf>
+  801173:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801178:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801183:	89 df                	mov    %ebx,%edi
+  801185:	89 de                	mov    %ebx,%esi
+  801187:	55                   	push   %ebp
+  801188:	68 91 11 80 00       	push   $0x801191
+  80118d:	89 e5                	mov    %esp,%ebp
+  80118f:	0f 34                	sysenter
+  801191:	83 c4 04             	add    $0x4,%esp
+  801194:	5d                   	pop    %ebp
+  801195:	eb c2                	jmp    801159 <sys_page_reuse+0x2e>
+
+00801197 <sys_env_set_status>:
+  801197:	55                   	push   %ebp
+  801198:	89 e5                	mov    %esp,%ebp
+  80119a:	57                   	push   %edi
+  80119b:	56                   	push   %esi
+  80119c:	53                   	push   %ebx
+  80119d:	83 ec 0c             	sub    $0xc,%esp
+  8011a0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8011a7:	78 2b                	js     8011d4 <sys_env_set_status+0x3d>
+  8011a9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8011b0:	75 37                	jne    8011e9 <sys_env_set_status+0x52>
+  8011b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c2:	89 df                	mov    %ebx,%edi
+  8011c4:	89 de                	mov    %ebx,%esi
+  8011c6:	cd 30                	int    $0x30
+  8011c8:	85 c0                	test   %eax,%eax
+  8011ca:	7f 41                	jg     80120d <sys_env_set_status+0x76>
+  8011cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011cf:	5b                   	pop    %ebx
+  8011d0:	5e                   	pop    %esi
+  8011d1:	5f                   	pop    %edi
+  8011d2:	5d                   	pop    %ebp
+  8011d3:	c3                   	ret
+  8011d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011d9:	0f a2                	cpuid
+  8011db:	c1 ea 0b             	shr    $0xb,%edx
+  8011de:	83 e2 01             	and    $0x1,%edx
+  8011e1:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8011e7:	eb c0                	jmp    8011a9 <sys_env_set_status+0x12>
+  8011e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011f9:	89 df                	mov    %ebx,%edi
+  8011fb:	89 de                	mov    %ebx,%esi
+  8011fd:	55                   	push   %ebp
+  8011fe:	68 07 12 80 00       	push   $0x801207
+  801203:	89 e5                	mov    %esp,%ebp
+  801205:	0f 34                	sysenter
+  801207:	83 c4 04             	add    $0x4,%esp
+  80120a:	5d                   	pop    %ebp
+  80120b:	eb bb                	jmp    8011c8 <sys_env_set_status+0x31>
+  80120d:	83 ec 0c             	sub    $0xc,%esp
+  801210:	50                   	push   %eax
+  801211:	6a 08                	push   $0x8
+  801213:	68 44 20 80 00       	push   $0x802044
+  801218:	6a 49                	push   $0x49
+  80121a:	68 61 20 80 00       	push   $0x802061
+  80121f:	e8 67 08 00 00       	call   801a8b <_panic>
+
+00801224 <sys_env_set_pgfault_upcall>:
+  801224:	55                   	push   %ebp
+  801225:	89 e5                	mov    %esp,%ebp
+  801227:	57                   	push   %edi
+  801228:	56                   	push   %esi
+  801229:	53                   	push   %ebx
+  80122a:	83 ec 0c             	sub    $0xc,%esp
+  80122d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801234:	78 2b                	js     801261 <sys_env_set_pgfault_upcall+0x3d>
+  801236:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80123d:	75 37                	jne    801276 <sys_env_set_pgfault_upcall+0x52>
+  80123f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801244:	b8 09 00 00 00       	mov    $0x9,%eax
+  801249:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124f:	89 df                	mov    %ebx,%edi
+  801251:	89 de                	mov    %ebx,%esi
+  801253:	cd 30                	int    $0x30
+  801255:	85 c0                	test   %eax,%eax
+  801257:	7f 41                	jg     80129a <sys_env_set_pgfault_upcall+0x76>
+  801259:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125c:	5b                   	pop    %ebx
+  80125d:	5e                   	pop    %esi
+  80125e:	5f                   	pop    %edi
+  80125f:	5d                   	pop    %ebp
+  801260:	c3                   	ret
+  801261:	b8 01 00 00 00       	mov    $0x1,%eax
+  801266:	0f a2                	cpuid
+  801268:	c1 ea 0b             	shr    $0xb,%edx
+  80126b:	83 e2 01             	and    $0x1,%edx
+  80126e:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801274:	eb c0                	jmp    801236 <sys_env_set_pgfault_upcall+0x12>
+  801276:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801281:	b8 09 00 00 00       	mov    $0x9,%eax
+  801286:	89 df                	mov    %ebx,%edi
+  801288:	89 de                	mov    %ebx,%esi
+  80128a:	55                   	push   %ebp
+  80128b:	68 94 12 80 00       	push   $0x801294
+  801290:	89 e5                	mov    %esp,%ebp
+  801292:	0f 34                	sysenter
+  801294:	83 c4 04             	add    $0x4,%esp
+  801297:	5d                   	pop    %ebp
+  801298:	eb bb                	jmp    801255 <sys_env_set_pgfault_upcall+0x31>
+  80129a:	83 ec 0c             	sub    $0xc,%esp
+  80129d:	50                   	push   %eax
+  80129e:	6a 09                	push   $0x9
+  8012a0:	68 44 20 80 00       	push   $0x802044
+  8012a5:	6a 49                	push   $0x49
+  8012a7:	68 61 20 80 00       	push   $0x802061
+  8012ac:	e8 da 07 00 00       	call   801a8b <_panic>
+
+008012b1 <sys_env_set_trace>:
+  8012b1:	55                   	push   %ebp
+  8012b2:	89 e5                	mov    %esp,%ebp
+  8012b4:	57                   	push   %edi
+  8012b5:	56                   	push   %esi
+  8012b6:	53                   	push   %ebx
+  8012b7:	83 ec 0c             	sub    $0xc,%esp
+  8012ba:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8012c1:	78 2b                	js     8012ee <sys_env_set_trace+0x3d>
+  8012c3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8012ca:	75 37                	jne    801303 <sys_env_set_trace+0x52>
+  8012cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012dc:	89 df                	mov    %ebx,%edi
+  8012de:	89 de                	mov    %ebx,%esi
+  8012e0:	cd 30                	int    $0x30
+  8012e2:	85 c0                	test   %eax,%eax
+  8012e4:	7f 41                	jg     801327 <sys_env_set_trace+0x76>
+  8012e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e9:	5b                   	pop    %ebx
+  8012ea:	5e                   	pop    %esi
+  8012eb:	5f                   	pop    %edi
+  8012ec:	5d                   	pop    %ebp
+  8012ed:	c3                   	ret
+  8012ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012f3:	0f a2                	cpuid
+  8012f5:	c1 ea 0b             	shr    $0xb,%edx
+  8012f8:	83 e2 01             	and    $0x1,%edx
+  8012fb:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801301:	eb c0                	jmp    8012c3 <sys_env_set_trace+0x12>
+  801303:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801308:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801313:	89 df                	mov    %ebx,%edi
+  801315:	89 de                	mov    %ebx,%esi
+  801317:	55                   	push   %ebp
+  801318:	68 21 13 80 00       	push   $0x801321
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	0f 34                	sysenter
+  801321:	83 c4 04             	add    $0x4,%esp
+  801324:	5d                   	pop    %ebp
+  801325:	eb bb                	jmp    8012e2 <sys_env_set_trace+0x31>
+  801327:	83 ec 0c             	sub    $0xc,%esp
+  80132a:	50                   	push   %eax
+  80132b:	6a 12                	push   $0x12
+  80132d:	68 44 20 80 00       	push   $0x802044
+  801332:	6a 49                	push   $0x49
+  801334:	68 61 20 80 00       	push   $0x802061
+  801339:	e8 4d 07 00 00       	call   801a8b <_panic>
+
+0080133e <sys_env_set_rdpmc>:
+  80133e:	55                   	push   %ebp
+  80133f:	89 e5                	mov    %esp,%ebp
+  801341:	57                   	push   %edi
+  801342:	56                   	push   %esi
+  801343:	53                   	push   %ebx
+  801344:	83 ec 0c             	sub    $0xc,%esp
+  801347:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80134e:	78 2b                	js     80137b <sys_env_set_rdpmc+0x3d>
+  801350:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801357:	75 37                	jne    801390 <sys_env_set_rdpmc+0x52>
+  801359:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80135e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801363:	8b 55 08             	mov    0x8(%ebp),%edx
+  801366:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801369:	89 df                	mov    %ebx,%edi
+  80136b:	89 de                	mov    %ebx,%esi
+  80136d:	cd 30                	int    $0x30
+  80136f:	85 c0                	test   %eax,%eax
+  801371:	7f 41                	jg     8013b4 <sys_env_set_rdpmc+0x76>
+  801373:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801376:	5b                   	pop    %ebx
+  801377:	5e                   	pop    %esi
+  801378:	5f                   	pop    %edi
+  801379:	5d                   	pop    %ebp
+  80137a:	c3                   	ret
+  80137b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801380:	0f a2                	cpuid
+  801382:	c1 ea 0b             	shr    $0xb,%edx
+  801385:	83 e2 01             	and    $0x1,%edx
+  801388:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80138e:	eb c0                	jmp    801350 <sys_env_set_rdpmc+0x12>
+  801390:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801395:	8b 55 08             	mov    0x8(%ebp),%edx
+  801398:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139b:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013a0:	89 df                	mov    %ebx,%edi
+  8013a2:	89 de                	mov    %ebx,%esi
+  8013a4:	55                   	push   %ebp
+  8013a5:	68 ae 13 80 00       	push   $0x8013ae
+  8013aa:	89 e5                	mov    %esp,%ebp
+  8013ac:	0f 34                	sysenter
+  8013ae:	83 c4 04             	add    $0x4,%esp
+  8013b1:	5d                   	pop    %ebp
+  8013b2:	eb bb                	jmp    80136f <sys_env_set_rdpmc+0x31>
+  8013b4:	83 ec 0c             	sub    $0xc,%esp
+  8013b7:	50                   	push   %eax
+  8013b8:	6a 13                	push   $0x13
+  8013ba:	68 44 20 80 00       	push   $0x802044
+  8013bf:	6a 49                	push   $0x49
+  8013c1:	68 61 20 80 00       	push   $0x802061
+  8013c6:	e8 c0 06 00 00       	call   801a8b <_panic>
+
+008013cb <sys_ring_setup>:
+  8013cb:	55                   	push   %ebp
+  8013cc:	89 e5                	mov    %esp,%ebp
+  8013ce:	57                   	push   %edi
+  8013cf:	56                   	push   %esi
+  8013d0:	53                   	push   %ebx
+  8013d1:	83 ec 0c             	sub    $0xc,%esp
+  8013d4:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013db:	78 29                	js     801406 <sys_ring_setup+0x3b>
+  8013dd:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013e4:	75 35                	jne    80141b <sys_ring_setup+0x50>
+  8013e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013eb:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013f0:	89 d1                	mov    %edx,%ecx
+  8013f2:	89 d3                	mov    %edx,%ebx
+  8013f4:	89 d7                	mov    %edx,%edi
+  8013f6:	89 d6                	mov    %edx,%esi
+  8013f8:	cd 30                	int    $0x30
+  8013fa:	85 c0                	test   %eax,%eax
+  8013fc:	7f 3f                	jg     80143d <sys_ring_setup+0x72>
+  8013fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801401:	5b                   	pop    %ebx
+  801402:	5e                   	pop    %esi
+  801403:	5f                   	pop    %edi
+  801404:	5d                   	pop    %ebp
+  801405:	c3                   	ret
+  801406:	b8 01 00 00 00       	mov    $0x1,%eax
+  80140b:	0f a2                	cpuid
+  80140d:	c1 ea 0b             	shr    $0xb,%edx
+  801410:	83 e2 01             	and    $0x1,%edx
+  801413:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801419:	eb c2                	jmp    8013dd <sys_ring_setup+0x12>
+  80141b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801420:	b8 10 00 00 00       	mov    $0x10,%eax
+  801425:	89 d1                	mov    %edx,%ecx
+  801427:	89 d3                	mov    %edx,%ebx
+  801429:	89 d7                	mov    %edx,%edi
+  80142b:	89 d6                	mov    %edx,%esi
+  80142d:	55                   	push   %ebp
+  80142e:	68 37 14 80 00       	push   $0x801437
+  801433:	89 e5                	mov    %esp,%ebp
+  801435:	0f 34                	sysenter
+  801437:	83 c4 04             	add    $0x4,%esp
+  80143a:	5d                   	pop    %ebp
+  80143b:	eb bd                	jmp    8013fa <sys_ring_setup+0x2f>
+  80143d:	83 ec 0c             	sub    $0xc,%esp
+  801440:	50                   	push   %eax
+  801441:	6a 10                	push   $0x10
+  801443:	68 44 20 80 00       	push   $0x802044
+  801448:	6a 49                	push   $0x49
+  80144a:	68 61 20 80 00       	push   $0x802061
+  80144f:	e8 37 06 00 00       	call   801a8b <_panic>
+
+00801454 <sys_ring_enter>:
+  801454:	55                   	push   %ebp
+  801455:	89 e5                	mov    %esp,%ebp
+  801457:	57                   	push   %edi
+  801458:	56                   	push   %esi
+  801459:	53                   	push   %ebx
+  80145a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801461:	78 22                	js     801485 <sys_ring_enter+0x31>
+  801463:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80146a:	75 2e                	jne    80149a <sys_ring_enter+0x46>
+  80146c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801471:	b8 11 00 00 00       	mov    $0x11,%eax
+  801476:	89 d1                	mov    %edx,%ecx
+  801478:	89 d3                	mov    %edx,%ebx
+  80147a:	89 d7                	mov    %edx,%edi
+  80147c:	89 d6                	mov    %edx,%esi
+  80147e:	cd 30                	int    $0x30
+  801480:	5b                   	pop    %ebx
+  801481:	5e                   	pop    %esi
+  801482:	5f                   	pop    %edi
+  801483:	5d                   	pop    %ebp
+  801484:	c3                   	ret
+  801485:	b8 01 00 00 00       	mov    $0x1,%eax
+  80148a:	0f a2                	cpuid
+  80148c:	c1 ea 0b             	shr    $0xb,%edx
+  80148f:	83 e2 01             	and    $0x1,%edx
+  801492:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801498:	eb c9                	jmp    801463 <sys_ring_enter+0xf>
+  80149a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80149f:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014a4:	89 d1                	mov    %edx,%ecx
+  8014a6:	89 d3                	mov    %edx,%ebx
+  8014a8:	89 d7                	mov    %edx,%edi
+  8014aa:	89 d6                	mov    %edx,%esi
+  8014ac:	55                   	push   %ebp
+  8014ad:	68 b6 14 80 00       	push   $0x8014b6
+  8014b2:	89 e5                	mov    %esp,%ebp
+  8014b4:	0f 34                	sysenter
+  8014b6:	83 c4 04             	add    $0x4,%esp
+  8014b9:	5d                   	pop    %ebp
+  8014ba:	eb c4                	jmp    801480 <sys_ring_enter+0x2c>
+
+008014bc <sys_ipc_try_send>:
+  8014bc:	55                   	push   %ebp
+  8014bd:	89 e5                	mov    %esp,%ebp
+  8014bf:	57                   	push   %edi
+  8014c0:	56                   	push   %esi
+  8014c1:	53                   	push   %ebx
+  8014c2:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014c9:	78 26                	js     8014f1 <sys_ipc_try_send+0x35>
+  8014cb:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014d2:	75 32                	jne    801506 <sys_ipc_try_send+0x4a>
+  8014d4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014e7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014ea:	cd 30                	int    $0x30
+  8014ec:	5b                   	pop    %ebx
+  8014ed:	5e                   	pop    %esi
+  8014ee:	5f                   	pop    %edi
+  8014ef:	5d                   	pop    %ebp
+  8014f0:	c3                   	ret
+  8014f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014f6:	0f a2                	cpuid
+  8014f8:	c1 ea 0b             	shr    $0xb,%edx
+  8014fb:	83 e2 01             	and    $0x1,%edx
+  8014fe:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801504:	eb c5                	jmp    8014cb <sys_ipc_try_send+0xf>
+  801506:	8b 55 08             	mov    0x8(%ebp),%edx
+  801509:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801511:	be 00 00 00 00       	mov    $0x0,%esi
+  801516:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801519:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80151c:	55                   	push   %ebp
+  80151d:	68 26 15 80 00       	push   $0x801526
+  801522:	89 e5                	mov    %esp,%ebp
+  801524:	0f 34                	sysenter
+  801526:	83 c4 04             	add    $0x4,%esp
+  801529:	5d                   	pop    %ebp
+  80152a:	eb c0                	jmp    8014ec <sys_ipc_try_send+0x30>
+
+0080152c <sys_ipc_recv>:
+  80152c:	55                   	push   %ebp
+  80152d:	89 e5                	mov    %esp,%ebp
+  80152f:	57                   	push   %edi
+  801530:	56                   	push   %esi
+  801531:	53                   	push   %ebx
+  801532:	83 ec 0c             	sub    $0xc,%esp
+  801535:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80153c:	78 2a                	js     801568 <sys_ipc_recv+0x3c>
+  80153e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801545:	75 36                	jne    80157d <sys_ipc_recv+0x51>
+  801547:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80154c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801551:	8b 55 08             	mov    0x8(%ebp),%edx
+  801554:	89 cb                	mov    %ecx,%ebx
+  801556:	89 cf                	mov    %ecx,%edi
+  801558:	89 ce                	mov    %ecx,%esi
+  80155a:	cd 30                	int    $0x30
+  80155c:	85 c0                	test   %eax,%eax
+  80155e:	7f 40                	jg     8015a0 <sys_ipc_recv+0x74>
+  801560:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801563:	5b                   	pop    %ebx
+  801564:	5e                   	pop    %esi
+  801565:	5f                   	pop    %edi
+  801566:	5d                   	pop    %ebp
+  801567:	c3                   	ret
+  801568:	b8 01 00 00 00       	mov    $0x1,%eax
+  80156d:	0f a2                	cpuid
+  80156f:	c1 ea 0b             	shr    $0xb,%edx
+  801572:	83 e2 01             	and    $0x1,%edx
+  801575:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80157b:	eb c1                	jmp    80153e <sys_ipc_recv+0x12>
+  80157d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801585:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80158a:	89 cb                	mov    %ecx,%ebx
+  80158c:	89 cf                	mov    %ecx,%edi
+  80158e:	89 ce                	mov    %ecx,%esi
+  801590:	55                   	push   %ebp
+  801591:	68 9a 15 80 00       	push   $0x80159a
+  801596:	89 e5                	mov    %esp,%ebp
+  801598:	0f 34                	sysenter
+  80159a:	83 c4 04             	add    $0x4,%esp
+  80159d:	5d                   	pop    %ebp
+  80159e:	eb bc                	jmp    80155c <sys_ipc_recv+0x30>
+  8015a0:	83 ec 0c             	sub    $0xc,%esp
+  8015a3:	50                   	push   %eax
+  8015a4:	6a 0c                	push   $0xc
+  8015a6:	68 44 20 80 00       	push   $0x802044
+  8015ab:	6a 49                	push   $0x49
+  8015ad:	68 61 20 80 00       	push   $0x802061
+  8015b2:	e8 d4 04 00 00       	call   801a8b <_panic>
+
+008015b7 <duppage>:
+  8015b7:	55                   	push   %ebp
+  8015b8:	89 e5                	mov    %esp,%ebp
+  8015ba:	53                   	push   %ebx
+  8015bb:	83 ec 04             	sub    $0x4,%esp
+  8015be:	89 d3                	mov    %edx,%ebx
+  8015c0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015c7:	f6 c2 02             	test   $0x2,%dl
+  8015ca:	75 0c                	jne    8015d8 <duppage+0x21>
+  8015cc:	8b 14 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edx
+  8015d3:	f6 c6 08             	test   $0x8,%dh
+  8015d6:	74 64                	je     80163c <duppage+0x85>
+  8015d8:	c1 e3 0c             	shl    $0xc,%ebx
+  8015db:	83 ec 0c             	sub    $0xc,%esp
+  8015de:	68 05 08 00 00       	push   $0x805
+  8015e3:	53                   	push   %ebx
+  8015e4:	50                   	push   %eax
+  8015e5:	53                   	push   %ebx
+  8015e6:	6a 00                	push   $0x0
+  8015e8:	e8 24 fa ff ff       	call   801011 <sys_page_map>
+  8015ed:	83 c4 20             	add    $0x20,%esp
+  8015f0:	85 c0                	test   %eax,%eax
+  8015f2:	78 24                	js     801618 <duppage+0x61>
+  8015f4:	83 ec 0c             	sub    $0xc,%esp
+  8015f7:	68 05 08 00 00       	push   $0x805
+  8015fc:	53                   	push   %ebx
+  8015fd:	6a 00                	push   $0x0
+  8015ff:	53                   	push   %ebx
+  801600:	6a 00                	push   $0x0
+  801602:	e8 0a fa ff ff       	call   801011 <sys_page_map>
+  801607:	83 c4 20             	add    $0x20,%esp
+  80160a:	85 c0                	test   %eax,%eax
+  80160c:	78 1c                	js     80162a <duppage+0x73>
+  80160e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801613:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801616:	c9                   	leave
+  801617:	c3                   	ret
+  801618:	50                   	push   %eax
+  801619:	68 6f 20 80 00       	push   $0x80206f
+  80161e:	6a 52                	push   $0x52
+  801620:	68 80 20 80 00       	push   $0x802080
+  801625:	e8 61 04 00 00       	call   801a8b <_panic>
+  80162a:	50                   	push   %eax
+  80162b:	68 6f 20 80 00       	push   $0x80206f
+  801630:	6a 55                	push   $0x55
+  801632:	68 80 20 80 00       	push   $0x802080
+  801637:	e8 4f 04 00 00       	call   801a8b <_panic>
+  80163c:	c1 e3 0c             	shl    $0xc,%ebx
+  80163f:	83 ec 0c             	sub    $0xc,%esp
+  801642:	6a 05                	push   $0x5
+  801644:	53                   	push   %ebx
+  801645:	50                   	push   %eax
+  801646:	53                   	push   %ebx
+  801647:	6a 00                	push   $0x0
+  801649:	e8 c3 f9 ff ff       	call   801011 <sys_page_map>
+  80164e:	83 c4 20             	add    $0x20,%esp
+  801651:	85 c0                	test   %eax,%eax
+  801653:	79 b9                	jns    80160e <duppage+0x57>
+  801655:	50                   	push   %eax
+  801656:	68 6f 20 80 00       	push   $0x80206f
+  80165b:	6a 59                	push   $0x59
+  80165d:	68 80 20 80 00       	push   $0x802080
+  801662:	e8 24 04 00 00       	call   801a8b <_panic>
+
+00801667 <pgfault>:
+  801667:	55                   	push   %ebp
+  801668:	89 e5                	mov    %esp,%ebp
+  80166a:	53                   	push   %ebx
+  80166b:	83 ec 04             	sub    $0x4,%esp
+  80166e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801671:	8b 18                	mov    (%eax),%ebx
+  801673:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801677:	0f 84 90 00 00 00    	je     80170d <pgfault+0xa6>
+  80167d:	89 d8                	mov    %ebx,%eax
+  80167f:	c1 e8 0c             	shr    $0xc,%eax
+  801682:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801689:	f7 c2 01 08 00 00    	test   $0x801,%edx
+  80168f:	74 7c                	je     80170d <pgfault+0xa6>
+  801691:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801698:	c1 e8 0c             	shr    $0xc,%eax
+  80169b:	0f b7 04 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%eax
+  8016a2:	ef 
+  8016a3:	66 83 f8 01          	cmp    $0x1,%ax
+  8016a7:	74 78                	je     801721 <pgfault+0xba>
+  8016a9:	83 ec 04             	sub    $0x4,%esp
+  8016ac:	6a 07                	push   $0x7
+  8016ae:	68 00 f0 7f 00       	push   $0x7ff000
+  8016b3:	6a 00                	push   $0x0
+  8016b5:	e8 c8 f8 ff ff       	call   800f82 <sys_page_alloc>
+  8016ba:	83 c4 10             	add    $0x10,%esp
+  8016bd:	85 c0                	test   %eax,%eax
+  8016bf:	78 7f                	js     801740 <pgfault+0xd9>
+  8016c1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8016c7:	83 ec 08             	sub    $0x8,%esp
+  8016ca:	53                   	push   %ebx
+  8016cb:	68 00 f0 7f 00       	push   $0x7ff000
+  8016d0:	e8 86 f3 ff ff       	call   800a5b <page_copy>
+  8016d5:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8016dc:	53                   	push   %ebx
+  8016dd:	6a 00                	push   $0x0
+  8016df:	68 00 f0 7f 00       	push   $0x7ff000
+  8016e4:	6a 00                	push   $0x0
+  8016e6:	e8 26 f9 ff ff       	call   801011 <sys_page_map>
+  8016eb:	83 c4 20             	add    $0x20,%esp
+  8016ee:	85 c0                	test   %eax,%eax
+  8016f0:	78 60                	js     801752 <pgfault+0xeb>
+  8016f2:	83 ec 08             	sub    $0x8,%esp
+  8016f5:	68 00 f0 7f 00       	push   $0x7ff000
+  8016fa:	6a 00                	push   $0x0
+  8016fc:	e8 9d f9 ff ff       	call   80109e <sys_page_unmap>
+  801701:	83 c4 10             	add    $0x10,%esp
+  801704:	85 c0                	test   %eax,%eax
+  801706:	78 5c                	js     801764 <pgfault+0xfd>
+  801708:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80170b:	c9                   	leave
+  80170c:	c3                   	ret
+  80170d:	83 ec 04             	sub    $0x4,%esp
+  801710:	68 8b 20 80 00       	push   $0x80208b
+  801715:	6a 1c                	push   $0x1c
+  801717:	68 80 20 80 00       	push   $0x802080
+  80171c:	e8 6a 03 00 00       	call   801a8b <_panic>
+  801721:	83 ec 08             	sub    $0x8,%esp
+  801724:	89 d8                	mov    %ebx,%eax
+  801726:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80172b:	50                   	push   %eax
+  80172c:	6a 00                	push   $0x0
+  80172e:	e8 f8 f9 ff ff       	call   80112b <sys_page_reuse>
+  801733:	83 c4 10             	add    $0x10,%esp
+  801736:	85 c0                	test   %eax,%eax
+  801738:	0f 85 6b ff ff ff    	jne    8016a9 <pgfault+0x42>
+  80173e:	eb c8                	jmp    801708 <pgfault+0xa1>
+  801740:	50                   	push   %eax
+  801741:	68 a8 20 80 00       	push   $0x8020a8
+  801746:	6a 31                	push   $0x31
+  801748:	68 80 20 80 00       	push   $0x802080
+  80174d:	e8 39 03 00 00       	call   801a8b <_panic>
+  801752:	50                   	push   %eax
+  801753:	68 6f 20 80 00       	push   $0x80206f
+  801758:	6a 36                	push   $0x36
+  80175a:	68 80 20 80 00       	push   $0x802080
+  80175f:	e8 27 03 00 00       	call   801a8b <_panic>
+  801764:	50                   	push   %eax
+  801765:	68 bb 20 80 00       	push   $0x8020bb
+  80176a:	6a 38                	push   $0x38
+  80176c:	68 80 20 80 00       	push   $0x802080
+  801771:	e8 15 03 00 00       	call   801a8b <_panic>
+
+00801776 <fork>:
+  801776:	55                   	push   %ebp
+  801777:	89 e5                	mov    %esp,%ebp
+  801779:	53                   	push   %ebx
+  80177a:	83 ec 20             	sub    $0x20,%esp
+  80177d:	68 67 16 80 00       	push   $0x801667
+  801782:	e8 4f 03 00 00       	call   801ad6 <set_pgfault_handler>
+  801787:	83 c4 08             	add    $0x8,%esp
+  80178a:	6a 01                	push   $0x1
+  80178c:	6a 00                	push   $0x0
+  80178e:	e8 d5 f6 ff ff       	call   800e68 <sys_env_set_cow>
+  801793:	83 c4 10             	add    $0x10,%esp
+  801796:	85 c0                	test   %eax,%eax
+  801798:	78 38                	js     8017d2 <fork+0x5c>
+  80179a:	e8 f5 01 00 00       	call   801994 <bflush>
+  80179f:	b8 07 00 00 00       	mov    $0x7,%eax
+  8017a4:	cd 30                	int    $0x30
+  8017a6:	89 c3                	mov    %eax,%ebx
+  8017a8:	85 c0                	test   %eax,%eax
+  8017aa:	78 38                	js     8017e4 <fork+0x6e>
+  8017ac:	ba 00 00 80 00       	mov    $0x800000,%edx
+  8017b1:	75 4f                	jne    801802 <fork+0x8c>
+  8017b3:	e8 43 01 00 00       	call   8018fb <uinfo_envid>
+  8017b8:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8017bd:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8017c3:	05 00 00 00 ed       	add    $0xed000000,%eax
+  8017c8:	a3 20 30 80 00       	mov    %eax,0x803020
+  8017cd:	e9 c9 00 00 00       	jmp    80189b <fork+0x125>
+  8017d2:	50                   	push   %eax
+  8017d3:	68 ce 20 80 00       	push   $0x8020ce
+  8017d8:	6a 7c                	push   $0x7c
+  8017da:	68 80 20 80 00       	push   $0x802080
+  8017df:	e8 a7 02 00 00       	call   801a8b <_panic>
+  8017e4:	50                   	push   %eax
+  8017e5:	68 e2 20 80 00       	push   $0x8020e2
+  8017ea:	68 88 00 00 00       	push   $0x88
+  8017ef:	68 80 20 80 00       	push   $0x802080
+  8017f4:	e8 92 02 00 00       	call   801a8b <_panic>
+  8017f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017fc:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801802:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  801805:	81 fa ff ff ff ea    	cmp    $0xeaffffff,%edx
+  80180b:	77 34                	ja     801841 <fork+0xcb>
+  80180d:	81 fa 00 f0 ff ea    	cmp    $0xeafff000,%edx
+  801813:	74 e4                	je     8017f9 <fork+0x83>
+  801815:	89 d0                	mov    %edx,%eax
+  801817:	c1 e8 16             	shr    $0x16,%eax
+  80181a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801821:	a8 01                	test   $0x1,%al
+  801823:	74 d4                	je     8017f9 <fork+0x83>
+  801825:	89 d0                	mov    %edx,%eax
+  801827:	c1 e8 0c             	shr    $0xc,%eax
+  80182a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801831:	a8 01                	test   $0x1,%al
+  801833:	74 c4                	je     8017f9 <fork+0x83>
+  801835:	c1 ea 0c             	shr    $0xc,%edx
+  801838:	89 d8                	mov    %ebx,%eax
+  80183a:	e8 78 fd ff ff       	call   8015b7 <duppage>
+  80183f:	eb b8                	jmp    8017f9 <fork+0x83>
+  801841:	83 ec 04             	sub    $0x4,%esp
+  801844:	6a 07                	push   $0x7
+  801846:	68 00 f0 ff ea       	push   $0xeafff000
+  80184b:	53                   	push   %ebx
+  80184c:	e8 31 f7 ff ff       	call   800f82 <sys_page_alloc>
+  801851:	83 c4 10             	add    $0x10,%esp
+  801854:	85 c0                	test   %eax,%eax
+  801856:	78 4a                	js     8018a2 <fork+0x12c>
+  801858:	a1 20 30 80 00       	mov    0x803020,%eax
+  80185d:	8b 40 58             	mov    0x58(%eax),%eax
+  801860:	83 ec 08             	sub    $0x8,%esp
+  801863:	50                   	push   %eax
+  801864:	53                   	push   %ebx
+  801865:	e8 ba f9 ff ff       	call   801224 <sys_env_set_pgfault_upcall>
+  80186a:	83 c4 08             	add    $0x8,%esp
+  80186d:	6a 01                	push   $0x1
+  80186f:	53                   	push   %ebx
+  801870:	e8 f3 f5 ff ff       	call   800e68 <sys_env_set_cow>
+  801875:	83 c4 10             	add    $0x10,%esp
+  801878:	85 c0                	test   %eax,%eax
+  80187a:	78 3b                	js     8018b7 <fork+0x141>
+  80187c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80187f:	c1 ea 0c             	shr    $0xc,%edx
+  801882:	89 d8                	mov    %ebx,%eax
+  801884:	e8 2e fd ff ff       	call   8015b7 <duppage>
+  801889:	83 ec 08             	sub    $0x8,%esp
+  80188c:	6a 02                	push   $0x2
+  80188e:	53                   	push   %ebx
+  80188f:	e8 03 f9 ff ff       	call   801197 <sys_env_set_status>
+  801894:	83 c4 10             	add    $0x10,%esp
+  801897:	85 c0                	test   %eax,%eax
+  801899:	78 31                	js     8018cc <fork+0x156>
+  80189b:	89 d8                	mov    %ebx,%eax
+  80189d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018a0:	c9                   	leave
+  8018a1:	c3                   	ret
+  8018a2:	50                   	push   %eax
+  8018a3:	68 a8 20 80 00       	push   $0x8020a8
+  8018a8:	68 a1 00 00 00       	push   $0xa1
+  8018ad:	68 80 20 80 00       	push   $0x802080
+  8018b2:	e8 d4 01 00 00       	call   801a8b <_panic>
+  8018b7:	50                   	push   %eax
+  8018b8:	68 ce 20 80 00       	push   $0x8020ce
+  8018bd:	68 a6 00 00 00       	push   $0xa6
+  8018c2:	68 80 20 80 00       	push   $0x802080
+  8018c7:	e8 bf 01 00 00       	call   801a8b <_panic>
+  8018cc:	50                   	push   %eax
+  8018cd:	68 f2 20 80 00       	push   $0x8020f2
+  8018d2:	68 ad 00 00 00       	push   $0xad
+  8018d7:	68 80 20 80 00       	push   $0x802080
+  8018dc:	e8 aa 01 00 00       	call   801a8b <_panic>
+
+008018e1 <sfork>:
+  8018e1:	55                   	push   %ebp
+  8018e2:	89 e5                	mov    %esp,%ebp
+  8018e4:	83 ec 0c             	sub    $0xc,%esp
+  8018e7:	68 09 21 80 00       	push   $0x802109
+  8018ec:	68 b6 00 00 00       	push   $0xb6
+  8018f1:	68 80 20 80 00       	push   $0x802080
+  8018f6:	e8 90 01 00 00       	call   801a8b <_panic>
+
+008018fb <uinfo_envid>:
+  8018fb:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  801900:	c3                   	ret
+
+00801901 <uinfo_cpunum>:
+  801901:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  801906:	c3                   	ret
+
+00801907 <uinfo_ticks>:
+  801907:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  80190c:	c3                   	ret
+
+0080190d <uinfo_nsec>:
+  80190d:	55                   	push   %ebp
+  80190e:	89 e5                	mov    %esp,%ebp
+  801910:	57                   	push   %edi
+  801911:	56                   	push   %esi
+  801912:	53                   	push   %ebx
+  801913:	83 ec 1c             	sub    $0x1c,%esp
+  801916:	0f 31                	rdtsc
+  801918:	89 c6                	mov    %eax,%esi
+  80191a:	89 d7                	mov    %edx,%edi
+  80191c:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801922:	b8 00 00 00 00       	mov    $0x0,%eax
+  801927:	ba 00 00 00 00       	mov    $0x0,%edx
+  80192c:	85 c9                	test   %ecx,%ecx
+  80192e:	74 5c                	je     80198c <uinfo_nsec+0x7f>
+  801930:	ba 00 00 00 00       	mov    $0x0,%edx
+  801935:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801938:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80193b:	52                   	push   %edx
+  80193c:	51                   	push   %ecx
+  80193d:	57                   	push   %edi
+  80193e:	56                   	push   %esi
+  80193f:	e8 ff 02 00 00       	call   801c43 <__umoddi3>
+  801944:	83 c4 10             	add    $0x10,%esp
+  801947:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  80194d:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801952:	f7 e3                	mul    %ebx
+  801954:	01 ca                	add    %ecx,%edx
+  801956:	ff 75 e4             	push   -0x1c(%ebp)
+  801959:	ff 75 e0             	push   -0x20(%ebp)
+  80195c:	52                   	push   %edx
+  80195d:	50                   	push   %eax
+  80195e:	e8 08 02 00 00       	call   801b6b <__udivdi3>
+  801963:	83 c4 10             	add    $0x10,%esp
+  801966:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801969:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80196c:	ff 75 e4             	push   -0x1c(%ebp)
+  80196f:	ff 75 e0             	push   -0x20(%ebp)
+  801972:	57                   	push   %edi
+  801973:	56                   	push   %esi
+  801974:	e8 f2 01 00 00       	call   801b6b <__udivdi3>
+  801979:	83 c4 10             	add    $0x10,%esp
+  80197c:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801982:	f7 e3                	mul    %ebx
+  801984:	01 ca                	add    %ecx,%edx
+  801986:	03 45 d8             	add    -0x28(%ebp),%eax
+  801989:	13 55 dc             	adc    -0x24(%ebp),%edx
+  80198c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80198f:	5b                   	pop    %ebx
+  801990:	5e                   	pop    %esi
+  801991:	5f                   	pop    %edi
+  801992:	5d                   	pop    %ebp
+  801993:	c3                   	ret
+
+00801994 <bflush>:
+  801994:	a1 40 30 80 00       	mov    0x803040,%eax
+  801999:	85 c0                	test   %eax,%eax
+  80199b:	75 01                	jne    80199e <bflush+0xa>
+  80199d:	c3                   	ret
+  80199e:	55                   	push   %ebp
+  80199f:	89 e5                	mov    %esp,%ebp
+  8019a1:	83 ec 10             	sub    $0x10,%esp
+  8019a4:	50                   	push   %eax
+  8019a5:	68 44 30 80 00       	push   $0x803044
+  8019aa:	e8 90 f2 ff ff       	call   800c3f <sys_cputs>
+  8019af:	c7 05 40 30 80 00 00 	movl   $0x0,0x803040
+  8019b6:	00 00 00 
+  8019b9:	83 c4 10             	add    $0x10,%esp
+  8019bc:	c9                   	leave
+  8019bd:	c3                   	ret
+
+008019be <bputch>:
+  8019be:	55                   	push   %ebp
+  8019bf:	89 e5                	mov    %esp,%ebp
+  8019c1:	53                   	push   %ebx
+  8019c2:	83 ec 04             	sub    $0x4,%esp
+  8019c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8019c8:	8b 15 40 30 80 00    	mov    0x803040,%edx
+  8019ce:	8d 42 01             	lea    0x1(%edx),%eax
+  8019d1:	a3 40 30 80 00       	mov    %eax,0x803040
+  8019d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8019d9:	88 8a 44 30 80 00    	mov    %cl,0x803044(%edx)
+  8019df:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019e4:	77 08                	ja     8019ee <bputch+0x30>
+  8019e6:	83 03 01             	addl   $0x1,(%ebx)
+  8019e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ec:	c9                   	leave
+  8019ed:	c3                   	ret
+  8019ee:	e8 a1 ff ff ff       	call   801994 <bflush>
+  8019f3:	eb f1                	jmp    8019e6 <bputch+0x28>
+
+008019f5 <vbprintf>:
+  8019f5:	55                   	push   %ebp
+  8019f6:	89 e5                	mov    %esp,%ebp
+  8019f8:	83 ec 18             	sub    $0x18,%esp
+  8019fb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801a02:	ff 75 0c             	push   0xc(%ebp)
+  801a05:	ff 75 08             	push   0x8(%ebp)
+  801a08:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a0b:	50                   	push   %eax
+  801a0c:	68 be 19 80 00       	push   $0x8019be
+  801a11:	e8 bc e8 ff ff       	call   8002d2 <vprintfmt>
+  801a16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a19:	c9                   	leave
+  801a1a:	c3                   	ret
+
+00801a1b <bprintf>:
+  801a1b:	55                   	push   %ebp
+  801a1c:	89 e5                	mov    %esp,%ebp
+  801a1e:	83 ec 10             	sub    $0x10,%esp
+  801a21:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801a24:	50                   	push   %eax
+  801a25:	ff 75 08             	push   0x8(%ebp)
+  801a28:	e8 c8 ff ff ff       	call   8019f5 <vbprintf>
+  801a2d:	c9                   	leave
+  801a2e:	c3                   	ret
+
+00801a2f <bwrite>:
+  801a2f:	55                   	push   %ebp
+  801a30:	89 e5                	mov    %esp,%ebp
+  801a32:	53                   	push   %ebx
+  801a33:	83 ec 04             	sub    $0x4,%esp
+  801a36:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a39:	89 d8                	mov    %ebx,%eax
+  801a3b:	03 05 40 30 80 00    	add    0x803040,%eax
+  801a41:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a46:	76 0d                	jbe    801a55 <bwrite+0x26>
+  801a48:	e8 47 ff ff ff       	call   801994 <bflush>
+  801a4d:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801a53:	77 25                	ja     801a7a <bwrite+0x4b>
+  801a55:	83 ec 04             	sub    $0x4,%esp
+  801a58:	53                   	push   %ebx
+  801a59:	ff 75 08             	push   0x8(%ebp)
+  801a5c:	a1 40 30 80 00       	mov    0x803040,%eax
+  801a61:	05 44 30 80 00       	add    $0x803044,%eax
+  801a66:	50                   	push   %eax
+  801a67:	e8 d1 ef ff ff       	call   800a3d <memcpy>
+  801a6c:	01 1d 40 30 80 00    	add    %ebx,0x803040
+  801a72:	83 c4 10             	add    $0x10,%esp
+  801a75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a78:	c9                   	leave
+  801a79:	c3                   	ret
+  801a7a:	83 ec 08             	sub    $0x8,%esp
+  801a7d:	53                   	push   %ebx
+  801a7e:	ff 75 08             	push   0x8(%ebp)
+  801a81:	e8 b9 f1 ff ff       	call   800c3f <sys_cputs>
+  801a86:	83 c4 10             	add    $0x10,%esp
+  801a89:	eb ea                	jmp    801a75 <bwrite+0x46>
+
+00801a8b <_panic>:
+  801a8b:	55                   	push   %ebp
+  801a8c:	89 e5                	mov    %esp,%ebp
+  801a8e:	56                   	push   %esi
+  801a8f:	53                   	push   %ebx
+  801a90:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  801a93:	e8 fc fe ff ff       	call   801994 <bflush>
+  801a98:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801a9e:	e8 f5 f2 ff ff       	call   800d98 <sys_getenvid>
+  801aa3:	83 ec 0c             	sub    $0xc,%esp
+  801aa6:	ff 75 0c             	push   0xc(%ebp)
+  801aa9:	ff 75 08             	push   0x8(%ebp)
+  801aac:	56                   	push   %esi
+  801aad:	50                   	push   %eax
+  801aae:	68 20 21 80 00       	push   $0x802120
+  801ab3:	e8 23 e7 ff ff       	call   8001db <cprintf>
+  801ab8:	83 c4 18             	add    $0x18,%esp
+  801abb:	53                   	push   %ebx
+  801abc:	ff 75 10             	push   0x10(%ebp)
+  801abf:	e8 c6 e6 ff ff       	call   80018a <vcprintf>
+  801ac4:	c7 04 24 ef 1d 80 00 	movl   $0x801def,(%esp)
+  801acb:	e8 0b e7 ff ff       	call   8001db <cprintf>
+  801ad0:	83 c4 10             	add    $0x10,%esp
+  801ad3:	cc                   	int3
+  801ad4:	eb fd                	jmp    801ad3 <_panic+0x48>
+
+00801ad6 <set_pgfault_handler>:
+  801ad6:	55                   	push   %ebp
+  801ad7:	89 e5                	mov    %esp,%ebp
+  801ad9:	83 ec 08             	sub    $0x8,%esp
+  801adc:	83 3d 44 34 80 00 00 	cmpl   $0x0,0x803444
+  801ae3:	74 0a                	je     801aef <set_pgfault_handler+0x19>
+  801ae5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae8:	a3 44 34 80 00       	mov    %eax,0x803444
+  801aed:	c9                   	leave
+  801aee:	c3                   	ret
+  801aef:	83 ec 04             	sub    $0x4,%esp
+  801af2:	6a 07                	push   $0x7
+  801af4:	68 00 f0 ff ea       	push   $0xeafff000
+  801af9:	6a 00                	push   $0x0
+  801afb:	e8 82 f4 ff ff       	call   800f82 <sys_page_alloc>
+  801b00:	83 c4 10             	add    $0x10,%esp
+  801b03:	85 c0                	test   %eax,%eax
+  801b05:	75 2a                	jne    801b31 <set_pgfault_handler+0x5b>
+  801b07:	83 ec 08             	sub    $0x8,%esp
+  801b0a:	68 45 1b 80 00       	push   $0x801b45
+  801b0f:	6a 00                	push   $0x0
+  801b11:	e8 0e f7 ff ff       	call   801224 <sys_env_set_pgfault_upcall>
+  801b16:	83 c4 10             	add    $0x10,%esp
+  801b19:	85 c0                	test   %eax,%eax
+  801b1b:	74 c8                	je     801ae5 <set_pgfault_handler+0xf>
+  801b1d:	83 ec 04             	sub    $0x4,%esp
+  801b20:	68 68 21 80 00       	push   $0x802168
+  801b25:	6a 28                	push   $0x28
+  801b27:	68 59 21 80 00       	push   $0x802159
+  801b2c:	e8 5a ff ff ff       	call   801a8b <_panic>
+  801b31:	83 ec 04             	sub    $0x4,%esp
+  801b34:	68 43 21 80 00       	push   $0x802143
+  801b39:	6a 22                	push   $0x22
+  801b3b:	68 59 21 80 00       	push   $0x802159
+  801b40:	e8 46 ff ff ff       	call   801a8b <_panic>
+
+00801b45 <_pgfault_upcall>:
+  801b45:	54                   	push   %esp
+  801b46:	a1 44 34 80 00       	mov    0x803444,%eax
+  801b4b:	ff d0                	call   *%eax
+  801b4d:	83 c4 04             	add    $0x4,%esp
+  801b50:	8b 44 24 28          	mov    0x28(%esp),%eax
+  801b54:	89 e5                	mov    %esp,%ebp
+  801b56:	8b 64 24 30          	mov    0x30(%esp),%esp
+  801b5a:	50                   	push   %eax
+  801b5b:	89 ec                	mov    %ebp,%esp
+  801b5d:	83 c4 08             	add    $0x8,%esp
+  801b60:	61                   	popa
+  801b61:	83 c4 04             	add    $0x4,%esp
+  801b64:	9d                   	popf
+  801b65:	5c                   	pop    %esp
+  801b66:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+  801b6a:	c3                   	ret
+
+00801b6b <__udivdi3>:
+  801b6b:	57                   	push   %edi
+  801b6c:	56                   	push   %esi
+  801b6d:	53                   	push   %ebx
+  801b6e:	83 ec 20             	sub    $0x20,%esp
+  801b71:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801b75:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801b79:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801b7d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801b81:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801b85:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801b89:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801b8d:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801b91:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801b95:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801b99:	89 d1                	mov    %edx,%ecx
+  801b9b:	09 c1                	or     %eax,%ecx
+  801b9d:	0f 84 91 00 00 00    	je     801c34 <__udivdi3+0xc9>
+  801ba3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801baa:	00 
+  801bab:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801bb2:	00 
+  801bb3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc2:	eb 08                	jmp    801bcc <__udivdi3+0x61>
+  801bc4:	83 e9 01             	sub    $0x1,%ecx
+  801bc7:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801bca:	74 68                	je     801c34 <__udivdi3+0xc9>
+  801bcc:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801bd0:	01 c0                	add    %eax,%eax
+  801bd2:	89 c6                	mov    %eax,%esi
+  801bd4:	89 d7                	mov    %edx,%edi
+  801bd6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801bda:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801bde:	0f ad d0             	shrd   %cl,%edx,%eax
+  801be1:	d3 ea                	shr    %cl,%edx
+  801be3:	f6 c1 20             	test   $0x20,%cl
+  801be6:	74 04                	je     801bec <__udivdi3+0x81>
+  801be8:	89 d0                	mov    %edx,%eax
+  801bea:	31 d2                	xor    %edx,%edx
+  801bec:	83 e0 01             	and    $0x1,%eax
+  801bef:	89 04 24             	mov    %eax,(%esp)
+  801bf2:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801bf9:	00 
+  801bfa:	8b 04 24             	mov    (%esp),%eax
+  801bfd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801c01:	09 f0                	or     %esi,%eax
+  801c03:	09 fa                	or     %edi,%edx
+  801c05:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801c09:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801c0d:	39 f0                	cmp    %esi,%eax
+  801c0f:	89 d3                	mov    %edx,%ebx
+  801c11:	19 fb                	sbb    %edi,%ebx
+  801c13:	72 af                	jb     801bc4 <__udivdi3+0x59>
+  801c15:	29 f0                	sub    %esi,%eax
+  801c17:	19 fa                	sbb    %edi,%edx
+  801c19:	89 cf                	mov    %ecx,%edi
+  801c1b:	c1 ef 05             	shr    $0x5,%edi
+  801c1e:	83 e7 01             	and    $0x1,%edi
+  801c21:	89 fe                	mov    %edi,%esi
+  801c23:	83 f6 01             	xor    $0x1,%esi
+  801c26:	d3 e6                	shl    %cl,%esi
+  801c28:	d3 e7                	shl    %cl,%edi
+  801c2a:	09 74 24 18          	or     %esi,0x18(%esp)
+  801c2e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  801c32:	eb 90                	jmp    801bc4 <__udivdi3+0x59>
+  801c34:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801c38:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  801c3c:	83 c4 20             	add    $0x20,%esp
+  801c3f:	5b                   	pop    %ebx
+  801c40:	5e                   	pop    %esi
+  801c41:	5f                   	pop    %edi
+  801c42:	c3                   	ret
+
+00801c43 <__umoddi3>:
+  801c43:	55                   	push   %ebp
+  801c44:	57                   	push   %edi
+  801c45:	56                   	push   %esi
+  801c46:	53                   	push   %ebx
+  801c47:	83 ec 1c             	sub    $0x1c,%esp
+  801c4a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801c4e:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801c52:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801c56:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801c5a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801c5e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801c62:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801c66:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801c6a:	89 d6                	mov    %edx,%esi
+  801c6c:	09 c6                	or     %eax,%esi
+  801c6e:	74 6c                	je     801cdc <__umoddi3+0x99>
+  801c70:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7f:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801c83:	eb 0e                	jmp    801c93 <__umoddi3+0x50>
+  801c85:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801c8a:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801c8e:	83 fe ff             	cmp    $0xffffffff,%esi
+  801c91:	74 49                	je     801cdc <__umoddi3+0x99>
+  801c93:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801c97:	01 c0                	add    %eax,%eax
+  801c99:	89 c3                	mov    %eax,%ebx
+  801c9b:	89 d6                	mov    %edx,%esi
+  801c9d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801ca1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801ca5:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801caa:	0f ad d0             	shrd   %cl,%edx,%eax
+  801cad:	d3 ea                	shr    %cl,%edx
+  801caf:	f6 c1 20             	test   $0x20,%cl
+  801cb2:	74 04                	je     801cb8 <__umoddi3+0x75>
+  801cb4:	89 d0                	mov    %edx,%eax
+  801cb6:	31 d2                	xor    %edx,%edx
+  801cb8:	83 e0 01             	and    $0x1,%eax
+  801cbb:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801cc0:	89 ea                	mov    %ebp,%edx
+  801cc2:	09 d8                	or     %ebx,%eax
+  801cc4:	09 f2                	or     %esi,%edx
+  801cc6:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801cca:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801cce:	39 d8                	cmp    %ebx,%eax
+  801cd0:	89 d1                	mov    %edx,%ecx
+  801cd2:	19 f1                	sbb    %esi,%ecx
+  801cd4:	72 af                	jb     801c85 <__umoddi3+0x42>
+  801cd6:	29 d8                	sub    %ebx,%eax
+  801cd8:	19 f2                	sbb    %esi,%edx
+  801cda:	eb a9                	jmp    801c85 <__umoddi3+0x42>
+  801cdc:	83 c4 1c             	add    $0x1c,%esp
+  801cdf:	5b                   	pop    %ebx
+  801ce0:	5e                   	pop    %esi
+  801ce1:	5f                   	pop    %edi
+  801ce2:	5d                   	pop    %ebp
+  801ce3:	c3                   	ret
+
+00801ce4 <__divdi3>:
+  801ce4:	53                   	push   %ebx
+  801ce5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801ce9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801ced:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801cf1:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801cf5:	85 d2                	test   %edx,%edx
+  801cf7:	78 12                	js     801d0b <__divdi3+0x27>
+  801cf9:	85 db                	test   %ebx,%ebx
+  801cfb:	78 2e                	js     801d2b <__divdi3+0x47>
+  801cfd:	53                   	push   %ebx
+  801cfe:	51                   	push   %ecx
+  801cff:	52                   	push   %edx
+  801d00:	50                   	push   %eax
+  801d01:	e8 65 fe ff ff       	call   801b6b <__udivdi3>
+  801d06:	83 c4 10             	add    $0x10,%esp
+  801d09:	eb 1e                	jmp    801d29 <__divdi3+0x45>
+  801d0b:	f7 d8                	neg    %eax
+  801d0d:	83 d2 00             	adc    $0x0,%edx
+  801d10:	f7 da                	neg    %edx
+  801d12:	85 db                	test   %ebx,%ebx
+  801d14:	78 2a                	js     801d40 <__divdi3+0x5c>
+  801d16:	53                   	push   %ebx
+  801d17:	51                   	push   %ecx
+  801d18:	52                   	push   %edx
+  801d19:	50                   	push   %eax
+  801d1a:	e8 4c fe ff ff       	call   801b6b <__udivdi3>
+  801d1f:	83 c4 10             	add    $0x10,%esp
+  801d22:	f7 d8                	neg    %eax
+  801d24:	83 d2 00             	adc    $0x0,%edx
+  801d27:	f7 da                	neg    %edx
+  801d29:	5b                   	pop    %ebx
+  801d2a:	c3                   	ret
+  801d2b:	f7 d9                	neg    %ecx
+  801d2d:	83 d3 00             	adc    $0x0,%ebx
+  801d30:	f7 db                	neg    %ebx
+  801d32:	53                   	push   %ebx
+  801d33:	51                   	push   %ecx
+  801d34:	52                   	push   %edx
+  801d35:	50                   	push   %eax
+  801d36:	e8 30 fe ff ff       	call   801b6b <__udivdi3>
+  801d3b:	83 c4 10             	add    $0x10,%esp
+  801d3e:	eb e2                	jmp    801d22 <__divdi3+0x3e>
+  801d40:	f7 d9                	neg    %ecx
+  801d42:	83 d3 00             	adc    $0x0,%ebx
+  801d45:	f7 db                	neg    %ebx
+  801d47:	53                   	push   %ebx
+  801d48:	51                   	push   %ecx
+  801d49:	52                   	push   %edx
+  801d4a:	50                   	push   %eax
+  801d4b:	e8 1b fe ff ff       	call   801b6b <__udivdi3>
+  801d50:	83 c4 10             	add    $0x10,%esp
+  801d53:	eb d4                	jmp    801d29 <__divdi3+0x45>
+
+00801d55 <__moddi3>:
+  801d55:	55                   	push   %ebp
+  801d56:	57                   	push   %edi
+  801d57:	56                   	push   %esi
+  801d58:	53                   	push   %ebx
+  801d59:	83 ec 14             	sub    $0x14,%esp
+  801d5c:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801d60:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801d64:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801d68:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801d6c:	85 ed                	test   %ebp,%ebp
+  801d6e:	78 2b                	js     801d9b <__moddi3+0x46>
+  801d70:	89 c6                	mov    %eax,%esi
+  801d72:	f7 de                	neg    %esi
+  801d74:	89 34 24             	mov    %esi,(%esp)
+  801d77:	89 d6                	mov    %edx,%esi
+  801d79:	83 d6 00             	adc    $0x0,%esi
+  801d7c:	f7 de                	neg    %esi
+  801d7e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801d82:	8b 34 24             	mov    (%esp),%esi
+  801d85:	0f 48 f0             	cmovs  %eax,%esi
+  801d88:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801d8d:	52                   	push   %edx
+  801d8e:	56                   	push   %esi
+  801d8f:	55                   	push   %ebp
+  801d90:	57                   	push   %edi
+  801d91:	e8 ad fe ff ff       	call   801c43 <__umoddi3>
+  801d96:	83 c4 10             	add    $0x10,%esp
+  801d99:	eb 3c                	jmp    801dd7 <__moddi3+0x82>
+  801d9b:	89 c3                	mov    %eax,%ebx
+  801d9d:	f7 db                	neg    %ebx
+  801d9f:	89 d1                	mov    %edx,%ecx
+  801da1:	83 d1 00             	adc    $0x0,%ecx
+  801da4:	f7 d9                	neg    %ecx
+  801da6:	0f 49 c3             	cmovns %ebx,%eax
+  801da9:	89 04 24             	mov    %eax,(%esp)
+  801dac:	0f 49 d1             	cmovns %ecx,%edx
+  801daf:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801db3:	ff 74 24 04          	push   0x4(%esp)
+  801db7:	ff 74 24 04          	push   0x4(%esp)
+  801dbb:	89 f8                	mov    %edi,%eax
+  801dbd:	89 ea                	mov    %ebp,%edx
+  801dbf:	f7 d8                	neg    %eax
+  801dc1:	83 d2 00             	adc    $0x0,%edx
+  801dc4:	f7 da                	neg    %edx
+  801dc6:	52                   	push   %edx
+  801dc7:	50                   	push   %eax
+  801dc8:	e8 76 fe ff ff       	call   801c43 <__umoddi3>
+  801dcd:	83 c4 10             	add    $0x10,%esp
+  801dd0:	f7 d8                	neg    %eax
+  801dd2:	83 d2 00             	adc    $0x0,%edx
+  801dd5:	f7 da                	neg    %edx
+  801dd7:	83 c4 14             	add    $0x14,%esp
+  801dda:	5b                   	pop    %ebx
+  801ddb:	5e                   	pop    %esi
+  801ddc:	5f                   	pop    %edi
+  801ddd:	5d                   	pop    %ebp
+  801dde:	c3                   	ret
@@ -0,0 +1,2579 @@
+
+obj/user/hello:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 2d 00 00 00       	call   80005e <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+  800039:	68 a0 19 80 00       	push   $0x8019a0
+  80003e:	e8 13 01 00 00       	call   800156 <cprintf>
+  800043:	a1 20 20 80 00       	mov    0x802020,%eax
+  800048:	8b 40 40             	mov    0x40(%eax),%eax
+  80004b:	83 c4 08             	add    $0x8,%esp
+  80004e:	50                   	push   %eax
+  80004f:	68 ae 19 80 00       	push   $0x8019ae
+  800054:	e8 fd 00 00 00       	call   800156 <cprintf>
+  800059:	83 c4 10             	add    $0x10,%esp
+  80005c:	c9                   	leave
+  80005d:	c3                   	ret
+
+0080005e <libmain>:
+  80005e:	55                   	push   %ebp
+  80005f:	89 e5                	mov    %esp,%ebp
+  800061:	56                   	push   %esi
+  800062:	53                   	push   %ebx
+  800063:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800066:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800069:	e8 c4 14 00 00       	call   801532 <uinfo_envid>
+  80006e:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  800073:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  800079:	05 00 00 00 ed       	add    $0xed000000,%eax
+  80007e:	a3 20 20 80 00       	mov    %eax,0x802020
+  800083:	85 db                	test   %ebx,%ebx
+  800085:	7e 07                	jle    80008e <libmain+0x30>
+  800087:	8b 06                	mov    (%esi),%eax
+  800089:	a3 00 20 80 00       	mov    %eax,0x802000
+  80008e:	83 ec 08             	sub    $0x8,%esp
+  800091:	56                   	push   %esi
+  800092:	53                   	push   %ebx
+  800093:	e8 9b ff ff ff       	call   800033 <umain>
+  800098:	e8 0a 00 00 00       	call   8000a7 <exit>
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000a3:	5b                   	pop    %ebx
+  8000a4:	5e                   	pop    %esi
+  8000a5:	5d                   	pop    %ebp
+  8000a6:	c3                   	ret
+
+008000a7 <exit>:
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	83 ec 08             	sub    $0x8,%esp
+  8000ad:	e8 19 15 00 00       	call   8015cb <bflush>
+  8000b2:	83 ec 0c             	sub    $0xc,%esp
+  8000b5:	6a 00                	push   $0x0
+  8000b7:	e8 cc 0b 00 00       	call   800c88 <sys_env_destroy>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	c9                   	leave
+  8000c0:	c3                   	ret
+
+008000c1 <putch>:
+  8000c1:	55                   	push   %ebp
+  8000c2:	89 e5                	mov    %esp,%ebp
+  8000c4:	53                   	push   %ebx
+  8000c5:	83 ec 04             	sub    $0x4,%esp
+  8000c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8000cb:	8b 13                	mov    (%ebx),%edx
+  8000cd:	8d 42 01             	lea    0x1(%edx),%eax
+  8000d0:	89 03                	mov    %eax,(%ebx)
+  8000d2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000d5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8000d9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000de:	74 09                	je     8000e9 <putch+0x28>
+  8000e0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8000e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000e7:	c9                   	leave
+  8000e8:	c3                   	ret
+  8000e9:	83 ec 08             	sub    $0x8,%esp
+  8000ec:	68 ff 00 00 00       	push   $0xff
+  8000f1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000f4:	50                   	push   %eax
+  8000f5:	e8 c0 0a 00 00       	call   800bba <sys_cputs>
+  8000fa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800100:	83 c4 10             	add    $0x10,%esp
+  800103:	eb db                	jmp    8000e0 <putch+0x1f>
+
+00800105 <vcprintf>:
+  800105:	55                   	push   %ebp
+  800106:	89 e5                	mov    %esp,%ebp
+  800108:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80010e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800115:	00 00 00 
+  800118:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80011f:	00 00 00 
+  800122:	ff 75 0c             	push   0xc(%ebp)
+  800125:	ff 75 08             	push   0x8(%ebp)
+  800128:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80012e:	50                   	push   %eax
+  80012f:	68 c1 00 80 00       	push   $0x8000c1
+  800134:	e8 14 01 00 00       	call   80024d <vprintfmt>
+  800139:	83 c4 08             	add    $0x8,%esp
+  80013c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800142:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800148:	50                   	push   %eax
+  800149:	e8 6c 0a 00 00       	call   800bba <sys_cputs>
+  80014e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+
+00800156 <cprintf>:
+  800156:	55                   	push   %ebp
+  800157:	89 e5                	mov    %esp,%ebp
+  800159:	83 ec 10             	sub    $0x10,%esp
+  80015c:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80015f:	50                   	push   %eax
+  800160:	ff 75 08             	push   0x8(%ebp)
+  800163:	e8 9d ff ff ff       	call   800105 <vcprintf>
+  800168:	c9                   	leave
+  800169:	c3                   	ret
+
+0080016a <printnum>:
+  80016a:	55                   	push   %ebp
+  80016b:	89 e5                	mov    %esp,%ebp
+  80016d:	57                   	push   %edi
+  80016e:	56                   	push   %esi
+  80016f:	53                   	push   %ebx
+  800170:	83 ec 1c             	sub    $0x1c,%esp
+  800173:	89 c7                	mov    %eax,%edi
+  800175:	89 d6                	mov    %edx,%esi
+  800177:	8b 45 08             	mov    0x8(%ebp),%eax
+  80017a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80017d:	89 d1                	mov    %edx,%ecx
+  80017f:	89 c2                	mov    %eax,%edx
+  800181:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800184:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800187:	8b 45 10             	mov    0x10(%ebp),%eax
+  80018a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80018d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800190:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800197:	39 c2                	cmp    %eax,%edx
+  800199:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80019c:	72 3e                	jb     8001dc <printnum+0x72>
+  80019e:	83 ec 0c             	sub    $0xc,%esp
+  8001a1:	ff 75 18             	push   0x18(%ebp)
+  8001a4:	83 eb 01             	sub    $0x1,%ebx
+  8001a7:	53                   	push   %ebx
+  8001a8:	50                   	push   %eax
+  8001a9:	83 ec 08             	sub    $0x8,%esp
+  8001ac:	ff 75 e4             	push   -0x1c(%ebp)
+  8001af:	ff 75 e0             	push   -0x20(%ebp)
+  8001b2:	ff 75 dc             	push   -0x24(%ebp)
+  8001b5:	ff 75 d8             	push   -0x28(%ebp)
+  8001b8:	e8 50 15 00 00       	call   80170d <__udivdi3>
+  8001bd:	83 c4 18             	add    $0x18,%esp
+  8001c0:	52                   	push   %edx
+  8001c1:	50                   	push   %eax
+  8001c2:	89 f2                	mov    %esi,%edx
+  8001c4:	89 f8                	mov    %edi,%eax
+  8001c6:	e8 9f ff ff ff       	call   80016a <printnum>
+  8001cb:	83 c4 20             	add    $0x20,%esp
+  8001ce:	eb 13                	jmp    8001e3 <printnum+0x79>
+  8001d0:	83 ec 08             	sub    $0x8,%esp
+  8001d3:	56                   	push   %esi
+  8001d4:	ff 75 18             	push   0x18(%ebp)
+  8001d7:	ff d7                	call   *%edi
+  8001d9:	83 c4 10             	add    $0x10,%esp
+  8001dc:	83 eb 01             	sub    $0x1,%ebx
+  8001df:	85 db                	test   %ebx,%ebx
+  8001e1:	7f ed                	jg     8001d0 <printnum+0x66>
+  8001e3:	83 ec 08             	sub    $0x8,%esp
+  8001e6:	56                   	push   %esi
+  8001e7:	83 ec 04             	sub    $0x4,%esp
+  8001ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8001ed:	ff 75 e0             	push   -0x20(%ebp)
+  8001f0:	ff 75 dc             	push   -0x24(%ebp)
+  8001f3:	ff 75 d8             	push   -0x28(%ebp)
+  8001f6:	e8 ea 15 00 00       	call   8017e5 <__umoddi3>
+  8001fb:	83 c4 14             	add    $0x14,%esp
+  8001fe:	0f be 80 cf 19 80 00 	movsbl 0x8019cf(%eax),%eax
+  800205:	50                   	push   %eax
+  800206:	ff d7                	call   *%edi
+  800208:	83 c4 10             	add    $0x10,%esp
+  80020b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020e:	5b                   	pop    %ebx
+  80020f:	5e                   	pop    %esi
+  800210:	5f                   	pop    %edi
+  800211:	5d                   	pop    %ebp
+  800212:	c3                   	ret
+
+00800213 <sprintputch>:
+  800213:	55                   	push   %ebp
+  800214:	89 e5                	mov    %esp,%ebp
+  800216:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800219:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80021d:	8b 10                	mov    (%eax),%edx
+  80021f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800222:	73 0a                	jae    80022e <sprintputch+0x1b>
+  800224:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800227:	89 08                	mov    %ecx,(%eax)
+  800229:	8b 45 08             	mov    0x8(%ebp),%eax
+  80022c:	88 02                	mov    %al,(%edx)
+  80022e:	5d                   	pop    %ebp
+  80022f:	c3                   	ret
+
+00800230 <printfmt>:
+  800230:	55                   	push   %ebp
+  800231:	89 e5                	mov    %esp,%ebp
+  800233:	83 ec 08             	sub    $0x8,%esp
+  800236:	8d 45 14             	lea    0x14(%ebp),%eax
+  800239:	50                   	push   %eax
+  80023a:	ff 75 10             	push   0x10(%ebp)
+  80023d:	ff 75 0c             	push   0xc(%ebp)
+  800240:	ff 75 08             	push   0x8(%ebp)
+  800243:	e8 05 00 00 00       	call   80024d <vprintfmt>
+  800248:	83 c4 10             	add    $0x10,%esp
+  80024b:	c9                   	leave
+  80024c:	c3                   	ret
+
+0080024d <vprintfmt>:
+  80024d:	55                   	push   %ebp
+  80024e:	89 e5                	mov    %esp,%ebp
+  800250:	57                   	push   %edi
+  800251:	56                   	push   %esi
+  800252:	53                   	push   %ebx
+  800253:	83 ec 2c             	sub    $0x2c,%esp
+  800256:	8b 75 08             	mov    0x8(%ebp),%esi
+  800259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80025c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80025f:	eb 0a                	jmp    80026b <vprintfmt+0x1e>
+  800261:	83 ec 08             	sub    $0x8,%esp
+  800264:	53                   	push   %ebx
+  800265:	50                   	push   %eax
+  800266:	ff d6                	call   *%esi
+  800268:	83 c4 10             	add    $0x10,%esp
+  80026b:	83 c7 01             	add    $0x1,%edi
+  80026e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800272:	83 f8 25             	cmp    $0x25,%eax
+  800275:	74 0c                	je     800283 <vprintfmt+0x36>
+  800277:	85 c0                	test   %eax,%eax
+  800279:	75 e6                	jne    800261 <vprintfmt+0x14>
+  80027b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027e:	5b                   	pop    %ebx
+  80027f:	5e                   	pop    %esi
+  800280:	5f                   	pop    %edi
+  800281:	5d                   	pop    %ebp
+  800282:	c3                   	ret
+  800283:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800287:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80028e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800295:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  80029c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002a1:	8d 47 01             	lea    0x1(%edi),%eax
+  8002a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002a7:	0f b6 17             	movzbl (%edi),%edx
+  8002aa:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002ad:	3c 55                	cmp    $0x55,%al
+  8002af:	0f 87 cf 03 00 00    	ja     800684 <vprintfmt+0x437>
+  8002b5:	0f b6 c0             	movzbl %al,%eax
+  8002b8:	ff 24 85 a0 1a 80 00 	jmp    *0x801aa0(,%eax,4)
+  8002bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002c2:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002c6:	eb d9                	jmp    8002a1 <vprintfmt+0x54>
+  8002c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002cb:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002cf:	eb d0                	jmp    8002a1 <vprintfmt+0x54>
+  8002d1:	0f b6 d2             	movzbl %dl,%edx
+  8002d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002dc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8002df:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002e2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  8002e6:	0f be 17             	movsbl (%edi),%edx
+  8002e9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002ec:	83 f9 09             	cmp    $0x9,%ecx
+  8002ef:	77 55                	ja     800346 <vprintfmt+0xf9>
+  8002f1:	83 c7 01             	add    $0x1,%edi
+  8002f4:	eb e9                	jmp    8002df <vprintfmt+0x92>
+  8002f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f9:	8b 00                	mov    (%eax),%eax
+  8002fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800301:	8d 40 04             	lea    0x4(%eax),%eax
+  800304:	89 45 14             	mov    %eax,0x14(%ebp)
+  800307:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80030a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80030e:	79 91                	jns    8002a1 <vprintfmt+0x54>
+  800310:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800313:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800316:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80031d:	eb 82                	jmp    8002a1 <vprintfmt+0x54>
+  80031f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800322:	85 d2                	test   %edx,%edx
+  800324:	b8 00 00 00 00       	mov    $0x0,%eax
+  800329:	0f 49 c2             	cmovns %edx,%eax
+  80032c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80032f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800332:	e9 6a ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+  800337:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80033a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800341:	e9 5b ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+  800346:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800349:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80034c:	eb bc                	jmp    80030a <vprintfmt+0xbd>
+  80034e:	83 c1 01             	add    $0x1,%ecx
+  800351:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800354:	e9 48 ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+  800359:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035c:	8d 78 04             	lea    0x4(%eax),%edi
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	53                   	push   %ebx
+  800363:	ff 30                	push   (%eax)
+  800365:	ff d6                	call   *%esi
+  800367:	83 c4 10             	add    $0x10,%esp
+  80036a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80036d:	e9 b1 02 00 00       	jmp    800623 <vprintfmt+0x3d6>
+  800372:	8b 45 14             	mov    0x14(%ebp),%eax
+  800375:	8d 78 04             	lea    0x4(%eax),%edi
+  800378:	8b 10                	mov    (%eax),%edx
+  80037a:	89 d0                	mov    %edx,%eax
+  80037c:	f7 d8                	neg    %eax
+  80037e:	0f 48 c2             	cmovs  %edx,%eax
+  800381:	83 f8 08             	cmp    $0x8,%eax
+  800384:	7f 23                	jg     8003a9 <vprintfmt+0x15c>
+  800386:	8b 14 85 00 1c 80 00 	mov    0x801c00(,%eax,4),%edx
+  80038d:	85 d2                	test   %edx,%edx
+  80038f:	74 18                	je     8003a9 <vprintfmt+0x15c>
+  800391:	52                   	push   %edx
+  800392:	68 f0 19 80 00       	push   $0x8019f0
+  800397:	53                   	push   %ebx
+  800398:	56                   	push   %esi
+  800399:	e8 92 fe ff ff       	call   800230 <printfmt>
+  80039e:	83 c4 10             	add    $0x10,%esp
+  8003a1:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003a4:	e9 7a 02 00 00       	jmp    800623 <vprintfmt+0x3d6>
+  8003a9:	50                   	push   %eax
+  8003aa:	68 e7 19 80 00       	push   $0x8019e7
+  8003af:	53                   	push   %ebx
+  8003b0:	56                   	push   %esi
+  8003b1:	e8 7a fe ff ff       	call   800230 <printfmt>
+  8003b6:	83 c4 10             	add    $0x10,%esp
+  8003b9:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003bc:	e9 62 02 00 00       	jmp    800623 <vprintfmt+0x3d6>
+  8003c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c4:	83 c0 04             	add    $0x4,%eax
+  8003c7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cd:	8b 08                	mov    (%eax),%ecx
+  8003cf:	85 c9                	test   %ecx,%ecx
+  8003d1:	b8 e0 19 80 00       	mov    $0x8019e0,%eax
+  8003d6:	0f 45 c1             	cmovne %ecx,%eax
+  8003d9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8003dc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003e0:	7e 06                	jle    8003e8 <vprintfmt+0x19b>
+  8003e2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003e6:	75 0b                	jne    8003f3 <vprintfmt+0x1a6>
+  8003e8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003eb:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003ee:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003f1:	eb 5c                	jmp    80044f <vprintfmt+0x202>
+  8003f3:	83 ec 08             	sub    $0x8,%esp
+  8003f6:	ff 75 d0             	push   -0x30(%ebp)
+  8003f9:	ff 75 cc             	push   -0x34(%ebp)
+  8003fc:	e8 87 03 00 00       	call   800788 <strnlen>
+  800401:	89 c2                	mov    %eax,%edx
+  800403:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800406:	29 d0                	sub    %edx,%eax
+  800408:	83 c4 10             	add    $0x10,%esp
+  80040b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80040f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800412:	89 75 08             	mov    %esi,0x8(%ebp)
+  800415:	89 c6                	mov    %eax,%esi
+  800417:	eb 0e                	jmp    800427 <vprintfmt+0x1da>
+  800419:	83 ec 08             	sub    $0x8,%esp
+  80041c:	53                   	push   %ebx
+  80041d:	57                   	push   %edi
+  80041e:	ff 55 08             	call   *0x8(%ebp)
+  800421:	83 ee 01             	sub    $0x1,%esi
+  800424:	83 c4 10             	add    $0x10,%esp
+  800427:	85 f6                	test   %esi,%esi
+  800429:	7f ee                	jg     800419 <vprintfmt+0x1cc>
+  80042b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80042e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800431:	85 c0                	test   %eax,%eax
+  800433:	ba 00 00 00 00       	mov    $0x0,%edx
+  800438:	0f 49 d0             	cmovns %eax,%edx
+  80043b:	29 d0                	sub    %edx,%eax
+  80043d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800440:	eb a6                	jmp    8003e8 <vprintfmt+0x19b>
+  800442:	83 ec 08             	sub    $0x8,%esp
+  800445:	53                   	push   %ebx
+  800446:	52                   	push   %edx
+  800447:	ff 55 08             	call   *0x8(%ebp)
+  80044a:	83 c4 10             	add    $0x10,%esp
+  80044d:	89 f1                	mov    %esi,%ecx
+  80044f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800452:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800456:	0f be d0             	movsbl %al,%edx
+  800459:	85 d2                	test   %edx,%edx
+  80045b:	74 28                	je     800485 <vprintfmt+0x238>
+  80045d:	85 ff                	test   %edi,%edi
+  80045f:	78 05                	js     800466 <vprintfmt+0x219>
+  800461:	83 ef 01             	sub    $0x1,%edi
+  800464:	78 30                	js     800496 <vprintfmt+0x249>
+  800466:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80046a:	74 d6                	je     800442 <vprintfmt+0x1f5>
+  80046c:	0f be c0             	movsbl %al,%eax
+  80046f:	83 e8 20             	sub    $0x20,%eax
+  800472:	83 f8 5e             	cmp    $0x5e,%eax
+  800475:	76 cb                	jbe    800442 <vprintfmt+0x1f5>
+  800477:	83 ec 08             	sub    $0x8,%esp
+  80047a:	53                   	push   %ebx
+  80047b:	6a 3f                	push   $0x3f
+  80047d:	ff 55 08             	call   *0x8(%ebp)
+  800480:	83 c4 10             	add    $0x10,%esp
+  800483:	eb c8                	jmp    80044d <vprintfmt+0x200>
+  800485:	8b 75 08             	mov    0x8(%ebp),%esi
+  800488:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80048b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80048e:	01 d0                	add    %edx,%eax
+  800490:	29 c8                	sub    %ecx,%eax
+  800492:	89 c7                	mov    %eax,%edi
+  800494:	eb 13                	jmp    8004a9 <vprintfmt+0x25c>
+  800496:	8b 75 08             	mov    0x8(%ebp),%esi
+  800499:	eb ed                	jmp    800488 <vprintfmt+0x23b>
+  80049b:	83 ec 08             	sub    $0x8,%esp
+  80049e:	53                   	push   %ebx
+  80049f:	6a 20                	push   $0x20
+  8004a1:	ff d6                	call   *%esi
+  8004a3:	83 ef 01             	sub    $0x1,%edi
+  8004a6:	83 c4 10             	add    $0x10,%esp
+  8004a9:	85 ff                	test   %edi,%edi
+  8004ab:	7f ee                	jg     80049b <vprintfmt+0x24e>
+  8004ad:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004b3:	e9 6b 01 00 00       	jmp    800623 <vprintfmt+0x3d6>
+  8004b8:	83 f9 01             	cmp    $0x1,%ecx
+  8004bb:	7f 1f                	jg     8004dc <vprintfmt+0x28f>
+  8004bd:	85 c9                	test   %ecx,%ecx
+  8004bf:	74 67                	je     800528 <vprintfmt+0x2db>
+  8004c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c4:	8b 00                	mov    (%eax),%eax
+  8004c6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004c9:	89 c1                	mov    %eax,%ecx
+  8004cb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004ce:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8004d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004da:	eb 17                	jmp    8004f3 <vprintfmt+0x2a6>
+  8004dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004df:	8b 50 04             	mov    0x4(%eax),%edx
+  8004e2:	8b 00                	mov    (%eax),%eax
+  8004e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004e7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ed:	8d 40 08             	lea    0x8(%eax),%eax
+  8004f0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004f3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004f6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8004f9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8004fe:	85 c9                	test   %ecx,%ecx
+  800500:	0f 89 03 01 00 00    	jns    800609 <vprintfmt+0x3bc>
+  800506:	83 ec 08             	sub    $0x8,%esp
+  800509:	53                   	push   %ebx
+  80050a:	6a 2d                	push   $0x2d
+  80050c:	ff d6                	call   *%esi
+  80050e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800511:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800514:	f7 da                	neg    %edx
+  800516:	83 d1 00             	adc    $0x0,%ecx
+  800519:	f7 d9                	neg    %ecx
+  80051b:	83 c4 10             	add    $0x10,%esp
+  80051e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800523:	e9 e1 00 00 00       	jmp    800609 <vprintfmt+0x3bc>
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8b 00                	mov    (%eax),%eax
+  80052d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800530:	89 c1                	mov    %eax,%ecx
+  800532:	c1 f9 1f             	sar    $0x1f,%ecx
+  800535:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800538:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053b:	8d 40 04             	lea    0x4(%eax),%eax
+  80053e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800541:	eb b0                	jmp    8004f3 <vprintfmt+0x2a6>
+  800543:	83 f9 01             	cmp    $0x1,%ecx
+  800546:	7f 1e                	jg     800566 <vprintfmt+0x319>
+  800548:	85 c9                	test   %ecx,%ecx
+  80054a:	74 32                	je     80057e <vprintfmt+0x331>
+  80054c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054f:	8b 10                	mov    (%eax),%edx
+  800551:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800556:	8d 40 04             	lea    0x4(%eax),%eax
+  800559:	89 45 14             	mov    %eax,0x14(%ebp)
+  80055c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800561:	e9 a3 00 00 00       	jmp    800609 <vprintfmt+0x3bc>
+  800566:	8b 45 14             	mov    0x14(%ebp),%eax
+  800569:	8b 10                	mov    (%eax),%edx
+  80056b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80056e:	8d 40 08             	lea    0x8(%eax),%eax
+  800571:	89 45 14             	mov    %eax,0x14(%ebp)
+  800574:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800579:	e9 8b 00 00 00       	jmp    800609 <vprintfmt+0x3bc>
+  80057e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800581:	8b 10                	mov    (%eax),%edx
+  800583:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800588:	8d 40 04             	lea    0x4(%eax),%eax
+  80058b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80058e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800593:	eb 74                	jmp    800609 <vprintfmt+0x3bc>
+  800595:	83 f9 01             	cmp    $0x1,%ecx
+  800598:	7f 1b                	jg     8005b5 <vprintfmt+0x368>
+  80059a:	85 c9                	test   %ecx,%ecx
+  80059c:	74 2c                	je     8005ca <vprintfmt+0x37d>
+  80059e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a1:	8b 10                	mov    (%eax),%edx
+  8005a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ae:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005b3:	eb 54                	jmp    800609 <vprintfmt+0x3bc>
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8b 10                	mov    (%eax),%edx
+  8005ba:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005bd:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005c8:	eb 3f                	jmp    800609 <vprintfmt+0x3bc>
+  8005ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cd:	8b 10                	mov    (%eax),%edx
+  8005cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005da:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005df:	eb 28                	jmp    800609 <vprintfmt+0x3bc>
+  8005e1:	83 ec 08             	sub    $0x8,%esp
+  8005e4:	53                   	push   %ebx
+  8005e5:	6a 30                	push   $0x30
+  8005e7:	ff d6                	call   *%esi
+  8005e9:	83 c4 08             	add    $0x8,%esp
+  8005ec:	53                   	push   %ebx
+  8005ed:	6a 78                	push   $0x78
+  8005ef:	ff d6                	call   *%esi
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8b 10                	mov    (%eax),%edx
+  8005f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005fb:	83 c4 10             	add    $0x10,%esp
+  8005fe:	8d 40 04             	lea    0x4(%eax),%eax
+  800601:	89 45 14             	mov    %eax,0x14(%ebp)
+  800604:	bf 10 00 00 00       	mov    $0x10,%edi
+  800609:	83 ec 0c             	sub    $0xc,%esp
+  80060c:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800610:	50                   	push   %eax
+  800611:	ff 75 e0             	push   -0x20(%ebp)
+  800614:	57                   	push   %edi
+  800615:	51                   	push   %ecx
+  800616:	52                   	push   %edx
+  800617:	89 da                	mov    %ebx,%edx
+  800619:	89 f0                	mov    %esi,%eax
+  80061b:	e8 4a fb ff ff       	call   80016a <printnum>
+  800620:	83 c4 20             	add    $0x20,%esp
+  800623:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800626:	e9 40 fc ff ff       	jmp    80026b <vprintfmt+0x1e>
+  80062b:	83 f9 01             	cmp    $0x1,%ecx
+  80062e:	7f 1b                	jg     80064b <vprintfmt+0x3fe>
+  800630:	85 c9                	test   %ecx,%ecx
+  800632:	74 2c                	je     800660 <vprintfmt+0x413>
+  800634:	8b 45 14             	mov    0x14(%ebp),%eax
+  800637:	8b 10                	mov    (%eax),%edx
+  800639:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80063e:	8d 40 04             	lea    0x4(%eax),%eax
+  800641:	89 45 14             	mov    %eax,0x14(%ebp)
+  800644:	bf 10 00 00 00       	mov    $0x10,%edi
+  800649:	eb be                	jmp    800609 <vprintfmt+0x3bc>
+  80064b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064e:	8b 10                	mov    (%eax),%edx
+  800650:	8b 48 04             	mov    0x4(%eax),%ecx
+  800653:	8d 40 08             	lea    0x8(%eax),%eax
+  800656:	89 45 14             	mov    %eax,0x14(%ebp)
+  800659:	bf 10 00 00 00       	mov    $0x10,%edi
+  80065e:	eb a9                	jmp    800609 <vprintfmt+0x3bc>
+  800660:	8b 45 14             	mov    0x14(%ebp),%eax
+  800663:	8b 10                	mov    (%eax),%edx
+  800665:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066a:	8d 40 04             	lea    0x4(%eax),%eax
+  80066d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800670:	bf 10 00 00 00       	mov    $0x10,%edi
+  800675:	eb 92                	jmp    800609 <vprintfmt+0x3bc>
+  800677:	83 ec 08             	sub    $0x8,%esp
+  80067a:	53                   	push   %ebx
+  80067b:	6a 25                	push   $0x25
+  80067d:	ff d6                	call   *%esi
+  80067f:	83 c4 10             	add    $0x10,%esp
+  800682:	eb 9f                	jmp    800623 <vprintfmt+0x3d6>
+  800684:	83 ec 08             	sub    $0x8,%esp
+  800687:	53                   	push   %ebx
+  800688:	6a 25                	push   $0x25
+  80068a:	ff d6                	call   *%esi
+  80068c:	83 c4 10             	add    $0x10,%esp
+  80068f:	89 f8                	mov    %edi,%eax
+  800691:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800695:	74 05                	je     80069c <vprintfmt+0x44f>
+  800697:	83 e8 01             	sub    $0x1,%eax
+  80069a:	eb f5                	jmp    800691 <vprintfmt+0x444>
+  80069c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80069f:	eb 82                	jmp    800623 <vprintfmt+0x3d6>
+
+008006a1 <vsnprintf>:
+  8006a1:	55                   	push   %ebp
+  8006a2:	89 e5                	mov    %esp,%ebp
+  8006a4:	83 ec 18             	sub    $0x18,%esp
+  8006a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006ad:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006b0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006b4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006b7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8006be:	85 c0                	test   %eax,%eax
+  8006c0:	74 26                	je     8006e8 <vsnprintf+0x47>
+  8006c2:	85 d2                	test   %edx,%edx
+  8006c4:	7e 22                	jle    8006e8 <vsnprintf+0x47>
+  8006c6:	ff 75 14             	push   0x14(%ebp)
+  8006c9:	ff 75 10             	push   0x10(%ebp)
+  8006cc:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006cf:	50                   	push   %eax
+  8006d0:	68 13 02 80 00       	push   $0x800213
+  8006d5:	e8 73 fb ff ff       	call   80024d <vprintfmt>
+  8006da:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006dd:	c6 00 00             	movb   $0x0,(%eax)
+  8006e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006e3:	83 c4 10             	add    $0x10,%esp
+  8006e6:	c9                   	leave
+  8006e7:	c3                   	ret
+  8006e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006ed:	eb f7                	jmp    8006e6 <vsnprintf+0x45>
+
+008006ef <snprintf>:
+  8006ef:	55                   	push   %ebp
+  8006f0:	89 e5                	mov    %esp,%ebp
+  8006f2:	83 ec 08             	sub    $0x8,%esp
+  8006f5:	8d 45 14             	lea    0x14(%ebp),%eax
+  8006f8:	50                   	push   %eax
+  8006f9:	ff 75 10             	push   0x10(%ebp)
+  8006fc:	ff 75 0c             	push   0xc(%ebp)
+  8006ff:	ff 75 08             	push   0x8(%ebp)
+  800702:	e8 9a ff ff ff       	call   8006a1 <vsnprintf>
+  800707:	c9                   	leave
+  800708:	c3                   	ret
+
+00800709 <copy_fwd>:
+  800709:	55                   	push   %ebp
+  80070a:	89 e5                	mov    %esp,%ebp
+  80070c:	57                   	push   %edi
+  80070d:	56                   	push   %esi
+  80070e:	53                   	push   %ebx
+  80070f:	89 c7                	mov    %eax,%edi
+  800711:	89 d6                	mov    %edx,%esi
+  800713:	89 c8                	mov    %ecx,%eax
+  800715:	83 f9 0f             	cmp    $0xf,%ecx
+  800718:	76 1c                	jbe    800736 <copy_fwd+0x2d>
+  80071a:	89 f9                	mov    %edi,%ecx
+  80071c:	f7 d9                	neg    %ecx
+  80071e:	89 cb                	mov    %ecx,%ebx
+  800720:	83 e3 03             	and    $0x3,%ebx
+  800723:	29 d8                	sub    %ebx,%eax
+  800725:	89 c2                	mov    %eax,%edx
+  800727:	c1 ea 02             	shr    $0x2,%edx
+  80072a:	83 e0 03             	and    $0x3,%eax
+  80072d:	89 d9                	mov    %ebx,%ecx
+  80072f:	fc                   	cld
+  800730:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800732:	89 d1                	mov    %edx,%ecx
+  800734:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800736:	89 c1                	mov    %eax,%ecx
+  800738:	fc                   	cld
+  800739:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80073b:	5b                   	pop    %ebx
+  80073c:	5e                   	pop    %esi
+  80073d:	5f                   	pop    %edi
+  80073e:	5d                   	pop    %ebp
+  80073f:	c3                   	ret
+
+00800740 <have_sse2>:
+  800740:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800747:	78 06                	js     80074f <have_sse2+0xf>
+  800749:	a1 04 20 80 00       	mov    0x802004,%eax
+  80074e:	c3                   	ret
+  80074f:	55                   	push   %ebp
+  800750:	89 e5                	mov    %esp,%ebp
+  800752:	53                   	push   %ebx
+  800753:	b8 01 00 00 00       	mov    $0x1,%eax
+  800758:	0f a2                	cpuid
+  80075a:	c1 ea 1a             	shr    $0x1a,%edx
+  80075d:	83 e2 01             	and    $0x1,%edx
+  800760:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800766:	a1 04 20 80 00       	mov    0x802004,%eax
+  80076b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80076e:	c9                   	leave
+  80076f:	c3                   	ret
+
+00800770 <strlen>:
+  800770:	55                   	push   %ebp
+  800771:	89 e5                	mov    %esp,%ebp
+  800773:	8b 55 08             	mov    0x8(%ebp),%edx
+  800776:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077b:	eb 03                	jmp    800780 <strlen+0x10>
+  80077d:	83 c0 01             	add    $0x1,%eax
+  800780:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800784:	75 f7                	jne    80077d <strlen+0xd>
+  800786:	5d                   	pop    %ebp
+  800787:	c3                   	ret
+
+00800788 <strnlen>:
+  800788:	55                   	push   %ebp
+  800789:	89 e5                	mov    %esp,%ebp
+  80078b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80078e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800791:	b8 00 00 00 00       	mov    $0x0,%eax
+  800796:	eb 03                	jmp    80079b <strnlen+0x13>
+  800798:	83 c0 01             	add    $0x1,%eax
+  80079b:	39 d0                	cmp    %edx,%eax
+  80079d:	74 08                	je     8007a7 <strnlen+0x1f>
+  80079f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007a3:	75 f3                	jne    800798 <strnlen+0x10>
+  8007a5:	89 c2                	mov    %eax,%edx
+  8007a7:	89 d0                	mov    %edx,%eax
+  8007a9:	5d                   	pop    %ebp
+  8007aa:	c3                   	ret
+
+008007ab <strcpy>:
+  8007ab:	55                   	push   %ebp
+  8007ac:	89 e5                	mov    %esp,%ebp
+  8007ae:	53                   	push   %ebx
+  8007af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007b2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ba:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007be:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007c1:	83 c0 01             	add    $0x1,%eax
+  8007c4:	84 d2                	test   %dl,%dl
+  8007c6:	75 f2                	jne    8007ba <strcpy+0xf>
+  8007c8:	89 c8                	mov    %ecx,%eax
+  8007ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007cd:	c9                   	leave
+  8007ce:	c3                   	ret
+
+008007cf <strcat>:
+  8007cf:	55                   	push   %ebp
+  8007d0:	89 e5                	mov    %esp,%ebp
+  8007d2:	53                   	push   %ebx
+  8007d3:	83 ec 10             	sub    $0x10,%esp
+  8007d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8007d9:	53                   	push   %ebx
+  8007da:	e8 91 ff ff ff       	call   800770 <strlen>
+  8007df:	83 c4 08             	add    $0x8,%esp
+  8007e2:	ff 75 0c             	push   0xc(%ebp)
+  8007e5:	01 d8                	add    %ebx,%eax
+  8007e7:	50                   	push   %eax
+  8007e8:	e8 be ff ff ff       	call   8007ab <strcpy>
+  8007ed:	89 d8                	mov    %ebx,%eax
+  8007ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007f2:	c9                   	leave
+  8007f3:	c3                   	ret
+
+008007f4 <strncpy>:
+  8007f4:	55                   	push   %ebp
+  8007f5:	89 e5                	mov    %esp,%ebp
+  8007f7:	56                   	push   %esi
+  8007f8:	53                   	push   %ebx
+  8007f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007ff:	89 f3                	mov    %esi,%ebx
+  800801:	03 5d 10             	add    0x10(%ebp),%ebx
+  800804:	89 f0                	mov    %esi,%eax
+  800806:	eb 0f                	jmp    800817 <strncpy+0x23>
+  800808:	83 c0 01             	add    $0x1,%eax
+  80080b:	0f b6 0a             	movzbl (%edx),%ecx
+  80080e:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800811:	80 f9 01             	cmp    $0x1,%cl
+  800814:	83 da ff             	sbb    $0xffffffff,%edx
+  800817:	39 d8                	cmp    %ebx,%eax
+  800819:	75 ed                	jne    800808 <strncpy+0x14>
+  80081b:	89 f0                	mov    %esi,%eax
+  80081d:	5b                   	pop    %ebx
+  80081e:	5e                   	pop    %esi
+  80081f:	5d                   	pop    %ebp
+  800820:	c3                   	ret
+
+00800821 <strlcpy>:
+  800821:	55                   	push   %ebp
+  800822:	89 e5                	mov    %esp,%ebp
+  800824:	56                   	push   %esi
+  800825:	53                   	push   %ebx
+  800826:	8b 75 08             	mov    0x8(%ebp),%esi
+  800829:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80082c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80082f:	89 f0                	mov    %esi,%eax
+  800831:	85 d2                	test   %edx,%edx
+  800833:	74 21                	je     800856 <strlcpy+0x35>
+  800835:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800839:	89 f2                	mov    %esi,%edx
+  80083b:	eb 09                	jmp    800846 <strlcpy+0x25>
+  80083d:	83 c1 01             	add    $0x1,%ecx
+  800840:	83 c2 01             	add    $0x1,%edx
+  800843:	88 5a ff             	mov    %bl,-0x1(%edx)
+  800846:	39 c2                	cmp    %eax,%edx
+  800848:	74 09                	je     800853 <strlcpy+0x32>
+  80084a:	0f b6 19             	movzbl (%ecx),%ebx
+  80084d:	84 db                	test   %bl,%bl
+  80084f:	75 ec                	jne    80083d <strlcpy+0x1c>
+  800851:	89 d0                	mov    %edx,%eax
+  800853:	c6 00 00             	movb   $0x0,(%eax)
+  800856:	29 f0                	sub    %esi,%eax
+  800858:	5b                   	pop    %ebx
+  800859:	5e                   	pop    %esi
+  80085a:	5d                   	pop    %ebp
+  80085b:	c3                   	ret
+
+0080085c <strcmp>:
+  80085c:	55                   	push   %ebp
+  80085d:	89 e5                	mov    %esp,%ebp
+  80085f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800862:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800865:	eb 06                	jmp    80086d <strcmp+0x11>
+  800867:	83 c1 01             	add    $0x1,%ecx
+  80086a:	83 c2 01             	add    $0x1,%edx
+  80086d:	0f b6 01             	movzbl (%ecx),%eax
+  800870:	84 c0                	test   %al,%al
+  800872:	74 04                	je     800878 <strcmp+0x1c>
+  800874:	3a 02                	cmp    (%edx),%al
+  800876:	74 ef                	je     800867 <strcmp+0xb>
+  800878:	0f b6 c0             	movzbl %al,%eax
+  80087b:	0f b6 12             	movzbl (%edx),%edx
+  80087e:	29 d0                	sub    %edx,%eax
+  800880:	5d                   	pop    %ebp
+  800881:	c3                   	ret
+
+00800882 <strncmp>:
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	53                   	push   %ebx
+  800886:	8b 45 08             	mov    0x8(%ebp),%eax
+  800889:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80088c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80088f:	eb 09                	jmp    80089a <strncmp+0x18>
+  800891:	83 ea 01             	sub    $0x1,%edx
+  800894:	83 c0 01             	add    $0x1,%eax
+  800897:	83 c1 01             	add    $0x1,%ecx
+  80089a:	85 d2                	test   %edx,%edx
+  80089c:	74 18                	je     8008b6 <strncmp+0x34>
+  80089e:	0f b6 18             	movzbl (%eax),%ebx
+  8008a1:	84 db                	test   %bl,%bl
+  8008a3:	74 04                	je     8008a9 <strncmp+0x27>
+  8008a5:	3a 19                	cmp    (%ecx),%bl
+  8008a7:	74 e8                	je     800891 <strncmp+0xf>
+  8008a9:	0f b6 00             	movzbl (%eax),%eax
+  8008ac:	0f b6 11             	movzbl (%ecx),%edx
+  8008af:	29 d0                	sub    %edx,%eax
+  8008b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008b4:	c9                   	leave
+  8008b5:	c3                   	ret
+  8008b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bb:	eb f4                	jmp    8008b1 <strncmp+0x2f>
+
+008008bd <strchr>:
+  8008bd:	55                   	push   %ebp
+  8008be:	89 e5                	mov    %esp,%ebp
+  8008c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8008c7:	eb 03                	jmp    8008cc <strchr+0xf>
+  8008c9:	83 c0 01             	add    $0x1,%eax
+  8008cc:	0f b6 10             	movzbl (%eax),%edx
+  8008cf:	84 d2                	test   %dl,%dl
+  8008d1:	74 06                	je     8008d9 <strchr+0x1c>
+  8008d3:	38 ca                	cmp    %cl,%dl
+  8008d5:	75 f2                	jne    8008c9 <strchr+0xc>
+  8008d7:	eb 05                	jmp    8008de <strchr+0x21>
+  8008d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008de:	5d                   	pop    %ebp
+  8008df:	c3                   	ret
+
+008008e0 <strfind>:
+  8008e0:	55                   	push   %ebp
+  8008e1:	89 e5                	mov    %esp,%ebp
+  8008e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8008ea:	0f b6 10             	movzbl (%eax),%edx
+  8008ed:	38 ca                	cmp    %cl,%dl
+  8008ef:	74 09                	je     8008fa <strfind+0x1a>
+  8008f1:	84 d2                	test   %dl,%dl
+  8008f3:	74 05                	je     8008fa <strfind+0x1a>
+  8008f5:	83 c0 01             	add    $0x1,%eax
+  8008f8:	eb f0                	jmp    8008ea <strfind+0xa>
+  8008fa:	5d                   	pop    %ebp
+  8008fb:	c3                   	ret
+
+008008fc <memset>:
+  8008fc:	55                   	push   %ebp
+  8008fd:	89 e5                	mov    %esp,%ebp
+  8008ff:	57                   	push   %edi
+  800900:	56                   	push   %esi
+  800901:	53                   	push   %ebx
+  800902:	83 ec 04             	sub    $0x4,%esp
+  800905:	8b 75 08             	mov    0x8(%ebp),%esi
+  800908:	8b 55 10             	mov    0x10(%ebp),%edx
+  80090b:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  80090f:	89 f7                	mov    %esi,%edi
+  800911:	83 fa 0f             	cmp    $0xf,%edx
+  800914:	76 24                	jbe    80093a <memset+0x3e>
+  800916:	89 f1                	mov    %esi,%ecx
+  800918:	f7 d9                	neg    %ecx
+  80091a:	83 e1 03             	and    $0x3,%ecx
+  80091d:	29 ca                	sub    %ecx,%edx
+  80091f:	89 d0                	mov    %edx,%eax
+  800921:	c1 e8 02             	shr    $0x2,%eax
+  800924:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  800927:	83 e2 03             	and    $0x3,%edx
+  80092a:	89 d8                	mov    %ebx,%eax
+  80092c:	fc                   	cld
+  80092d:	f3 aa                	rep stos %al,%es:(%edi)
+  80092f:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  800935:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  800938:	f3 ab                	rep stos %eax,%es:(%edi)
+  80093a:	89 d1                	mov    %edx,%ecx
+  80093c:	89 d8                	mov    %ebx,%eax
+  80093e:	fc                   	cld
+  80093f:	f3 aa                	rep stos %al,%es:(%edi)
+  800941:	89 f0                	mov    %esi,%eax
+  800943:	83 c4 04             	add    $0x4,%esp
+  800946:	5b                   	pop    %ebx
+  800947:	5e                   	pop    %esi
+  800948:	5f                   	pop    %edi
+  800949:	5d                   	pop    %ebp
+  80094a:	c3                   	ret
+
+0080094b <memmove>:
+  80094b:	55                   	push   %ebp
+  80094c:	89 e5                	mov    %esp,%ebp
+  80094e:	57                   	push   %edi
+  80094f:	56                   	push   %esi
+  800950:	53                   	push   %ebx
+  800951:	83 ec 0c             	sub    $0xc,%esp
+  800954:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800957:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80095a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80095d:	85 c0                	test   %eax,%eax
+  80095f:	74 14                	je     800975 <memmove+0x2a>
+  800961:	39 da                	cmp    %ebx,%edx
+  800963:	73 07                	jae    80096c <memmove+0x21>
+  800965:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  800968:	39 cb                	cmp    %ecx,%ebx
+  80096a:	72 13                	jb     80097f <memmove+0x34>
+  80096c:	89 c1                	mov    %eax,%ecx
+  80096e:	89 d8                	mov    %ebx,%eax
+  800970:	e8 94 fd ff ff       	call   800709 <copy_fwd>
+  800975:	89 d8                	mov    %ebx,%eax
+  800977:	83 c4 0c             	add    $0xc,%esp
+  80097a:	5b                   	pop    %ebx
+  80097b:	5e                   	pop    %esi
+  80097c:	5f                   	pop    %edi
+  80097d:	5d                   	pop    %ebp
+  80097e:	c3                   	ret
+  80097f:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800982:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800985:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800988:	83 f8 0f             	cmp    $0xf,%eax
+  80098b:	76 23                	jbe    8009b0 <memmove+0x65>
+  80098d:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800990:	83 e1 03             	and    $0x3,%ecx
+  800993:	29 c8                	sub    %ecx,%eax
+  800995:	89 c2                	mov    %eax,%edx
+  800997:	c1 ea 02             	shr    $0x2,%edx
+  80099a:	83 e0 03             	and    $0x3,%eax
+  80099d:	fd                   	std
+  80099e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8009a0:	83 ef 03             	sub    $0x3,%edi
+  8009a3:	83 ee 03             	sub    $0x3,%esi
+  8009a6:	89 d1                	mov    %edx,%ecx
+  8009a8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009aa:	83 c7 03             	add    $0x3,%edi
+  8009ad:	83 c6 03             	add    $0x3,%esi
+  8009b0:	89 c1                	mov    %eax,%ecx
+  8009b2:	fd                   	std
+  8009b3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8009b5:	fc                   	cld
+  8009b6:	eb bd                	jmp    800975 <memmove+0x2a>
+
+008009b8 <memcpy>:
+  8009b8:	55                   	push   %ebp
+  8009b9:	89 e5                	mov    %esp,%ebp
+  8009bb:	53                   	push   %ebx
+  8009bc:	83 ec 04             	sub    $0x4,%esp
+  8009bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009c2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8009c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009c8:	89 d8                	mov    %ebx,%eax
+  8009ca:	e8 3a fd ff ff       	call   800709 <copy_fwd>
+  8009cf:	89 d8                	mov    %ebx,%eax
+  8009d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d4:	c9                   	leave
+  8009d5:	c3                   	ret
+
+008009d6 <page_copy>:
+  8009d6:	55                   	push   %ebp
+  8009d7:	89 e5                	mov    %esp,%ebp
+  8009d9:	57                   	push   %edi
+  8009da:	56                   	push   %esi
+  8009db:	53                   	push   %ebx
+  8009dc:	83 ec 0c             	sub    $0xc,%esp
+  8009df:	e8 5c fd ff ff       	call   800740 <have_sse2>
+  8009e4:	85 c0                	test   %eax,%eax
+  8009e6:	74 39                	je     800a21 <page_copy+0x4b>
+  8009e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009eb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009ee:	be 00 01 00 00       	mov    $0x100,%esi
+  8009f3:	8b 03                	mov    (%ebx),%eax
+  8009f5:	8b 53 04             	mov    0x4(%ebx),%edx
+  8009f8:	0f c3 01             	movnti %eax,(%ecx)
+  8009fb:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  8009ff:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a02:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800a05:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800a09:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800a0d:	83 c3 10             	add    $0x10,%ebx
+  800a10:	83 c1 10             	add    $0x10,%ecx
+  800a13:	4e                   	dec    %esi
+  800a14:	75 dd                	jne    8009f3 <page_copy+0x1d>
+  800a16:	0f ae f8             	sfence
+  800a19:	83 c4 0c             	add    $0xc,%esp
+  800a1c:	5b                   	pop    %ebx
+  800a1d:	5e                   	pop    %esi
+  800a1e:	5f                   	pop    %edi
+  800a1f:	5d                   	pop    %ebp
+  800a20:	c3                   	ret
+  800a21:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a24:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a27:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800a2c:	fc                   	cld
+  800a2d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a2f:	eb e8                	jmp    800a19 <page_copy+0x43>
+
+00800a31 <page_zero>:
+  800a31:	55                   	push   %ebp
+  800a32:	89 e5                	mov    %esp,%ebp
+  800a34:	57                   	push   %edi
+  800a35:	83 ec 04             	sub    $0x4,%esp
+  800a38:	e8 03 fd ff ff       	call   800740 <have_sse2>
+  800a3d:	85 c0                	test   %eax,%eax
+  800a3f:	74 3a                	je     800a7b <page_zero+0x4a>
+  800a41:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a44:	ba 80 00 00 00       	mov    $0x80,%edx
+  800a49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a4e:	0f c3 08             	movnti %ecx,(%eax)
+  800a51:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800a55:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800a59:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800a5d:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800a61:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800a65:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800a69:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800a6d:	83 c0 20             	add    $0x20,%eax
+  800a70:	4a                   	dec    %edx
+  800a71:	75 db                	jne    800a4e <page_zero+0x1d>
+  800a73:	0f ae f8             	sfence
+  800a76:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a79:	c9                   	leave
+  800a7a:	c3                   	ret
+  800a7b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a7e:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800a83:	fc                   	cld
+  800a84:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a86:	eb ee                	jmp    800a76 <page_zero+0x45>
+
+00800a88 <memcmp>:
+  800a88:	55                   	push   %ebp
+  800a89:	89 e5                	mov    %esp,%ebp
+  800a8b:	56                   	push   %esi
+  800a8c:	53                   	push   %ebx
+  800a8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a90:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a93:	89 c6                	mov    %eax,%esi
+  800a95:	03 75 10             	add    0x10(%ebp),%esi
+  800a98:	eb 06                	jmp    800aa0 <memcmp+0x18>
+  800a9a:	83 c0 01             	add    $0x1,%eax
+  800a9d:	83 c2 01             	add    $0x1,%edx
+  800aa0:	39 f0                	cmp    %esi,%eax
+  800aa2:	74 14                	je     800ab8 <memcmp+0x30>
+  800aa4:	0f b6 08             	movzbl (%eax),%ecx
+  800aa7:	0f b6 1a             	movzbl (%edx),%ebx
+  800aaa:	38 d9                	cmp    %bl,%cl
+  800aac:	74 ec                	je     800a9a <memcmp+0x12>
+  800aae:	0f b6 c1             	movzbl %cl,%eax
+  800ab1:	0f b6 db             	movzbl %bl,%ebx
+  800ab4:	29 d8                	sub    %ebx,%eax
+  800ab6:	eb 05                	jmp    800abd <memcmp+0x35>
+  800ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abd:	5b                   	pop    %ebx
+  800abe:	5e                   	pop    %esi
+  800abf:	5d                   	pop    %ebp
+  800ac0:	c3                   	ret
+
+00800ac1 <memfind>:
+  800ac1:	55                   	push   %ebp
+  800ac2:	89 e5                	mov    %esp,%ebp
+  800ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aca:	89 c2                	mov    %eax,%edx
+  800acc:	03 55 10             	add    0x10(%ebp),%edx
+  800acf:	eb 03                	jmp    800ad4 <memfind+0x13>
+  800ad1:	83 c0 01             	add    $0x1,%eax
+  800ad4:	39 d0                	cmp    %edx,%eax
+  800ad6:	73 04                	jae    800adc <memfind+0x1b>
+  800ad8:	38 08                	cmp    %cl,(%eax)
+  800ada:	75 f5                	jne    800ad1 <memfind+0x10>
+  800adc:	5d                   	pop    %ebp
+  800add:	c3                   	ret
+
+00800ade <strtol>:
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	57                   	push   %edi
+  800ae2:	56                   	push   %esi
+  800ae3:	53                   	push   %ebx
+  800ae4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800aea:	eb 03                	jmp    800aef <strtol+0x11>
+  800aec:	83 c2 01             	add    $0x1,%edx
+  800aef:	0f b6 02             	movzbl (%edx),%eax
+  800af2:	3c 20                	cmp    $0x20,%al
+  800af4:	74 f6                	je     800aec <strtol+0xe>
+  800af6:	3c 09                	cmp    $0x9,%al
+  800af8:	74 f2                	je     800aec <strtol+0xe>
+  800afa:	3c 2b                	cmp    $0x2b,%al
+  800afc:	74 2a                	je     800b28 <strtol+0x4a>
+  800afe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b03:	3c 2d                	cmp    $0x2d,%al
+  800b05:	74 2b                	je     800b32 <strtol+0x54>
+  800b07:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b0d:	75 0f                	jne    800b1e <strtol+0x40>
+  800b0f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b12:	74 28                	je     800b3c <strtol+0x5e>
+  800b14:	85 db                	test   %ebx,%ebx
+  800b16:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b1b:	0f 44 d8             	cmove  %eax,%ebx
+  800b1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b23:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b26:	eb 46                	jmp    800b6e <strtol+0x90>
+  800b28:	83 c2 01             	add    $0x1,%edx
+  800b2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b30:	eb d5                	jmp    800b07 <strtol+0x29>
+  800b32:	83 c2 01             	add    $0x1,%edx
+  800b35:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b3a:	eb cb                	jmp    800b07 <strtol+0x29>
+  800b3c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b40:	74 0e                	je     800b50 <strtol+0x72>
+  800b42:	85 db                	test   %ebx,%ebx
+  800b44:	75 d8                	jne    800b1e <strtol+0x40>
+  800b46:	83 c2 01             	add    $0x1,%edx
+  800b49:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b4e:	eb ce                	jmp    800b1e <strtol+0x40>
+  800b50:	83 c2 02             	add    $0x2,%edx
+  800b53:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b58:	eb c4                	jmp    800b1e <strtol+0x40>
+  800b5a:	0f be c0             	movsbl %al,%eax
+  800b5d:	83 e8 30             	sub    $0x30,%eax
+  800b60:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b63:	7d 3a                	jge    800b9f <strtol+0xc1>
+  800b65:	83 c2 01             	add    $0x1,%edx
+  800b68:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b6c:	01 c1                	add    %eax,%ecx
+  800b6e:	0f b6 02             	movzbl (%edx),%eax
+  800b71:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b74:	89 f3                	mov    %esi,%ebx
+  800b76:	80 fb 09             	cmp    $0x9,%bl
+  800b79:	76 df                	jbe    800b5a <strtol+0x7c>
+  800b7b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b7e:	89 f3                	mov    %esi,%ebx
+  800b80:	80 fb 19             	cmp    $0x19,%bl
+  800b83:	77 08                	ja     800b8d <strtol+0xaf>
+  800b85:	0f be c0             	movsbl %al,%eax
+  800b88:	83 e8 57             	sub    $0x57,%eax
+  800b8b:	eb d3                	jmp    800b60 <strtol+0x82>
+  800b8d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b90:	89 f3                	mov    %esi,%ebx
+  800b92:	80 fb 19             	cmp    $0x19,%bl
+  800b95:	77 08                	ja     800b9f <strtol+0xc1>
+  800b97:	0f be c0             	movsbl %al,%eax
+  800b9a:	83 e8 37             	sub    $0x37,%eax
+  800b9d:	eb c1                	jmp    800b60 <strtol+0x82>
+  800b9f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ba3:	74 05                	je     800baa <strtol+0xcc>
+  800ba5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ba8:	89 10                	mov    %edx,(%eax)
+  800baa:	89 c8                	mov    %ecx,%eax
+  800bac:	f7 d8                	neg    %eax
+  800bae:	85 ff                	test   %edi,%edi
+  800bb0:	0f 45 c8             	cmovne %eax,%ecx
+  800bb3:	89 c8                	mov    %ecx,%eax
+  800bb5:	5b                   	pop    %ebx
+  800bb6:	5e                   	pop    %esi
+  800bb7:	5f                   	pop    %edi
+  800bb8:	5d                   	pop    %ebp
+  800bb9:	c3                   	ret
+
+00800bba <sys_cputs>:
+  800bba:	55                   	push   %ebp
+  800bbb:	89 e5                	mov    %esp,%ebp
+  800bbd:	57                   	push   %edi
+  800bbe:	56                   	push   %esi
+  800bbf:	53                   	push   %ebx
+  800bc0:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800bc7:	78 21                	js     800bea <sys_cputs+0x30>
+  800bc9:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800bd0:	75 2d                	jne    800bff <sys_cputs+0x45>
+  800bd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bdd:	89 c3                	mov    %eax,%ebx
+  800bdf:	89 c7                	mov    %eax,%edi
+  800be1:	89 c6                	mov    %eax,%esi
+  800be3:	cd 30                	int    $0x30
+  800be5:	5b                   	pop    %ebx
+  800be6:	5e                   	pop    %esi
+  800be7:	5f                   	pop    %edi
+  800be8:	5d                   	pop    %ebp
+  800be9:	c3                   	ret
+  800bea:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bef:	0f a2                	cpuid
+  800bf1:	c1 ea 0b             	shr    $0xb,%edx
+  800bf4:	83 e2 01             	and    $0x1,%edx
+  800bf7:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800bfd:	eb ca                	jmp    800bc9 <sys_cputs+0xf>
+  800bff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c0a:	89 c3                	mov    %eax,%ebx
+  800c0c:	89 c7                	mov    %eax,%edi
+  800c0e:	89 c6                	mov    %eax,%esi
+  800c10:	55                   	push   %ebp
+  800c11:	68 1a 0c 80 00       	push   $0x800c1a
+  800c16:	89 e5                	mov    %esp,%ebp
+  800c18:	0f 34                	sysenter
+  800c1a:	83 c4 04             	add    $0x4,%esp
+  800c1d:	5d                   	pop    %ebp
+  800c1e:	eb c5                	jmp    800be5 <sys_cputs+0x2b>
+
+00800c20 <sys_cgetc>:
+  800c20:	55                   	push   %ebp
+  800c21:	89 e5                	mov    %esp,%ebp
+  800c23:	57                   	push   %edi
+  800c24:	56                   	push   %esi
+  800c25:	53                   	push   %ebx
+  800c26:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c2d:	78 22                	js     800c51 <sys_cgetc+0x31>
+  800c2f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c36:	75 2e                	jne    800c66 <sys_cgetc+0x46>
+  800c38:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c3d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c42:	89 d1                	mov    %edx,%ecx
+  800c44:	89 d3                	mov    %edx,%ebx
+  800c46:	89 d7                	mov    %edx,%edi
+  800c48:	89 d6                	mov    %edx,%esi
+  800c4a:	cd 30                	int    $0x30
+  800c4c:	5b                   	pop    %ebx
+  800c4d:	5e                   	pop    %esi
+  800c4e:	5f                   	pop    %edi
+  800c4f:	5d                   	pop    %ebp
+  800c50:	c3                   	ret
+  800c51:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c56:	0f a2                	cpuid
+  800c58:	c1 ea 0b             	shr    $0xb,%edx
+  800c5b:	83 e2 01             	and    $0x1,%edx
+  800c5e:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800c64:	eb c9                	jmp    800c2f <sys_cgetc+0xf>
+  800c66:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c6b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c70:	89 d1                	mov    %edx,%ecx
+  800c72:	89 d3                	mov    %edx,%ebx
+  800c74:	89 d7                	mov    %edx,%edi
+  800c76:	89 d6                	mov    %edx,%esi
+  800c78:	55                   	push   %ebp
+  800c79:	68 82 0c 80 00       	push   $0x800c82
+  800c7e:	89 e5                	mov    %esp,%ebp
+  800c80:	0f 34                	sysenter
+  800c82:	83 c4 04             	add    $0x4,%esp
+  800c85:	5d                   	pop    %ebp
+  800c86:	eb c4                	jmp    800c4c <sys_cgetc+0x2c>
+
+00800c88 <sys_env_destroy>:
+  800c88:	55                   	push   %ebp
+  800c89:	89 e5                	mov    %esp,%ebp
+  800c8b:	57                   	push   %edi
+  800c8c:	56                   	push   %esi
+  800c8d:	53                   	push   %ebx
+  800c8e:	83 ec 0c             	sub    $0xc,%esp
+  800c91:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c98:	78 2a                	js     800cc4 <sys_env_destroy+0x3c>
+  800c9a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800ca1:	75 36                	jne    800cd9 <sys_env_destroy+0x51>
+  800ca3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ca8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb0:	89 cb                	mov    %ecx,%ebx
+  800cb2:	89 cf                	mov    %ecx,%edi
+  800cb4:	89 ce                	mov    %ecx,%esi
+  800cb6:	cd 30                	int    $0x30
+  800cb8:	85 c0                	test   %eax,%eax
+  800cba:	7f 40                	jg     800cfc <sys_env_destroy+0x74>
+  800cbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbf:	5b                   	pop    %ebx
+  800cc0:	5e                   	pop    %esi
+  800cc1:	5f                   	pop    %edi
+  800cc2:	5d                   	pop    %ebp
+  800cc3:	c3                   	ret
+  800cc4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cc9:	0f a2                	cpuid
+  800ccb:	c1 ea 0b             	shr    $0xb,%edx
+  800cce:	83 e2 01             	and    $0x1,%edx
+  800cd1:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800cd7:	eb c1                	jmp    800c9a <sys_env_destroy+0x12>
+  800cd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce1:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ce6:	89 cb                	mov    %ecx,%ebx
+  800ce8:	89 cf                	mov    %ecx,%edi
+  800cea:	89 ce                	mov    %ecx,%esi
+  800cec:	55                   	push   %ebp
+  800ced:	68 f6 0c 80 00       	push   $0x800cf6
+  800cf2:	89 e5                	mov    %esp,%ebp
+  800cf4:	0f 34                	sysenter
+  800cf6:	83 c4 04             	add    $0x4,%esp
+  800cf9:	5d                   	pop    %ebp
+  800cfa:	eb bc                	jmp    800cb8 <sys_env_destroy+0x30>
+  800cfc:	83 ec 0c             	sub    $0xc,%esp
+  800cff:	50                   	push   %eax
+  800d00:	6a 03                	push   $0x3
+  800d02:	68 24 1c 80 00       	push   $0x801c24
+  800d07:	6a 49                	push   $0x49
+  800d09:	68 41 1c 80 00       	push   $0x801c41
+  800d0e:	e8 af 09 00 00       	call   8016c2 <_panic>
+
+00800d13 <sys_getenvid>:
+  800d13:	55                   	push   %ebp
+  800d14:	89 e5                	mov    %esp,%ebp
+  800d16:	57                   	push   %edi
+  800d17:	56                   	push   %esi
+  800d18:	53                   	push   %ebx
+  800d19:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d20:	78 22                	js     800d44 <sys_getenvid+0x31>
+  800d22:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d29:	75 2e                	jne    800d59 <sys_getenvid+0x46>
+  800d2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d30:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d35:	89 d1                	mov    %edx,%ecx
+  800d37:	89 d3                	mov    %edx,%ebx
+  800d39:	89 d7                	mov    %edx,%edi
+  800d3b:	89 d6                	mov    %edx,%esi
+  800d3d:	cd 30                	int    $0x30
+  800d3f:	5b                   	pop    %ebx
+  800d40:	5e                   	pop    %esi
+  800d41:	5f                   	pop    %edi
+  800d42:	5d                   	pop    %ebp
+  800d43:	c3                   	ret
+  800d44:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d49:	0f a2                	cpuid
+  800d4b:	c1 ea 0b             	shr    $0xb,%edx
+  800d4e:	83 e2 01             	and    $0x1,%edx
+  800d51:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800d57:	eb c9                	jmp    800d22 <sys_getenvid+0xf>
+  800d59:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d63:	89 d1                	mov    %edx,%ecx
+  800d65:	89 d3                	mov    %edx,%ebx
+  800d67:	89 d7                	mov    %edx,%edi
+  800d69:	89 d6                	mov    %edx,%esi
+  800d6b:	55                   	push   %ebp
+  800d6c:	68 75 0d 80 00       	push   $0x800d75
+  800d71:	89 e5                	mov    %esp,%ebp
+  800d73:	0f 34                	sysenter
+  800d75:	83 c4 04             	add    $0x4,%esp
+  800d78:	5d                   	pop    %ebp
+  800d79:	eb c4                	jmp    800d3f <sys_getenvid+0x2c>
+
+00800d7b <sys_yield>:
+  800d7b:	55                   	push   %ebp
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	57                   	push   %edi
+  800d7f:	56                   	push   %esi
+  800d80:	53                   	push   %ebx
+  800d81:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d88:	78 22                	js     800dac <sys_yield+0x31>
+  800d8a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d91:	75 2e                	jne    800dc1 <sys_yield+0x46>
+  800d93:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d98:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d9d:	89 d1                	mov    %edx,%ecx
+  800d9f:	89 d3                	mov    %edx,%ebx
+  800da1:	89 d7                	mov    %edx,%edi
+  800da3:	89 d6                	mov    %edx,%esi
+  800da5:	cd 30                	int    $0x30
+  800da7:	5b                   	pop    %ebx
+  800da8:	5e                   	pop    %esi
+  800da9:	5f                   	pop    %edi
+  800daa:	5d                   	pop    %ebp
+  800dab:	c3                   	ret
+  800dac:	b8 01 00 00 00       	mov    $0x1,%eax
+  800db1:	0f a2                	cpuid
+  800db3:	c1 ea 0b             	shr    $0xb,%edx
+  800db6:	83 e2 01             	and    $0x1,%edx
+  800db9:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800dbf:	eb c9                	jmp    800d8a <sys_yield+0xf>
+  800dc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dcb:	89 d1                	mov    %edx,%ecx
+  800dcd:	89 d3                	mov    %edx,%ebx
+  800dcf:	89 d7                	mov    %edx,%edi
+  800dd1:	89 d6                	mov    %edx,%esi
+  800dd3:	55                   	push   %ebp
+  800dd4:	68 dd 0d 80 00       	push   $0x800ddd
+  800dd9:	89 e5                	mov    %esp,%ebp
+  800ddb:	0f 34                	sysenter
+  800ddd:	83 c4 04             	add    $0x4,%esp
+  800de0:	5d                   	pop    %ebp
+  800de1:	eb c4                	jmp    800da7 <sys_yield+0x2c>
+
+00800de3 <sys_env_set_cow>:
+  800de3:	55                   	push   %ebp
+  800de4:	89 e5                	mov    %esp,%ebp
+  800de6:	57                   	push   %edi
+  800de7:	56                   	push   %esi
+  800de8:	53                   	push   %ebx
+  800de9:	83 ec 0c             	sub    $0xc,%esp
+  800dec:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800df3:	78 2b                	js     800e20 <sys_env_set_cow+0x3d>
+  800df5:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800dfc:	75 37                	jne    800e35 <sys_env_set_cow+0x52>
+  800dfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e03:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0e:	89 df                	mov    %ebx,%edi
+  800e10:	89 de                	mov    %ebx,%esi
+  800e12:	cd 30                	int    $0x30
+  800e14:	85 c0                	test   %eax,%eax
+  800e16:	7f 41                	jg     800e59 <sys_env_set_cow+0x76>
+  800e18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1b:	5b                   	pop    %ebx
+  800e1c:	5e                   	pop    %esi
+  800e1d:	5f                   	pop    %edi
+  800e1e:	5d                   	pop    %ebp
+  800e1f:	c3                   	ret
+  800e20:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e25:	0f a2                	cpuid
+  800e27:	c1 ea 0b             	shr    $0xb,%edx
+  800e2a:	83 e2 01             	and    $0x1,%edx
+  800e2d:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800e33:	eb c0                	jmp    800df5 <sys_env_set_cow+0x12>
+  800e35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e40:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e45:	89 df                	mov    %ebx,%edi
+  800e47:	89 de                	mov    %ebx,%esi
+  800e49:	55                   	push   %ebp
+  800e4a:	68 53 0e 80 00       	push   $0x800e53
+  800e4f:	89 e5                	mov    %esp,%ebp
+  800e51:	0f 34                	sysenter
+  800e53:	83 c4 04             	add    $0x4,%esp
+  800e56:	5d                   	pop    %ebp
+  800e57:	eb bb                	jmp    800e14 <sys_env_set_cow+0x31>
+  800e59:	83 ec 0c             	sub    $0xc,%esp
+  800e5c:	50                   	push   %eax
+  800e5d:	6a 0d                	push   $0xd
+  800e5f:	68 24 1c 80 00       	push   $0x801c24
+  800e64:	6a 49                	push   $0x49
+  800e66:	68 41 1c 80 00       	push   $0x801c41
+  800e6b:	e8 52 08 00 00       	call   8016c2 <_panic>
+
+00800e70 <sys_env_set_quota>:
+  800e70:	55                   	push   %ebp
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	57                   	push   %edi
+  800e74:	56                   	push   %esi
+  800e75:	53                   	push   %ebx
+  800e76:	83 ec 0c             	sub    $0xc,%esp
+  800e79:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e80:	78 2b                	js     800ead <sys_env_set_quota+0x3d>
+  800e82:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e89:	75 37                	jne    800ec2 <sys_env_set_quota+0x52>
+  800e8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e90:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9b:	89 df                	mov    %ebx,%edi
+  800e9d:	89 de                	mov    %ebx,%esi
+  800e9f:	cd 30                	int    $0x30
+  800ea1:	85 c0                	test   %eax,%eax
+  800ea3:	7f 41                	jg     800ee6 <sys_env_set_quota+0x76>
+  800ea5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea8:	5b                   	pop    %ebx
+  800ea9:	5e                   	pop    %esi
+  800eaa:	5f                   	pop    %edi
+  800eab:	5d                   	pop    %ebp
+  800eac:	c3                   	ret
+  800ead:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eb2:	0f a2                	cpuid
+  800eb4:	c1 ea 0b             	shr    $0xb,%edx
+  800eb7:	83 e2 01             	and    $0x1,%edx
+  800eba:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800ec0:	eb c0                	jmp    800e82 <sys_env_set_quota+0x12>
+  800ec2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ed2:	89 df                	mov    %ebx,%edi
+  800ed4:	89 de                	mov    %ebx,%esi
+  800ed6:	55                   	push   %ebp
+  800ed7:	68 e0 0e 80 00       	push   $0x800ee0
+  800edc:	89 e5                	mov    %esp,%ebp
+  800ede:	0f 34                	sysenter
+  800ee0:	83 c4 04             	add    $0x4,%esp
+  800ee3:	5d                   	pop    %ebp
+  800ee4:	eb bb                	jmp    800ea1 <sys_env_set_quota+0x31>
+  800ee6:	83 ec 0c             	sub    $0xc,%esp
+  800ee9:	50                   	push   %eax
+  800eea:	6a 0f                	push   $0xf
+  800eec:	68 24 1c 80 00       	push   $0x801c24
+  800ef1:	6a 49                	push   $0x49
+  800ef3:	68 41 1c 80 00       	push   $0x801c41
+  800ef8:	e8 c5 07 00 00       	call   8016c2 <_panic>
+
+00800efd <sys_page_alloc>:
+  800efd:	55                   	push   %ebp
+  800efe:	89 e5                	mov    %esp,%ebp
+  800f00:	57                   	push   %edi
+  800f01:	56                   	push   %esi
+  800f02:	53                   	push   %ebx
+  800f03:	83 ec 0c             	sub    $0xc,%esp
+  800f06:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f0d:	78 2c                	js     800f3b <sys_page_alloc+0x3e>
+  800f0f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f16:	75 38                	jne    800f50 <sys_page_alloc+0x53>
+  800f18:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2b:	89 f7                	mov    %esi,%edi
+  800f2d:	cd 30                	int    $0x30
+  800f2f:	85 c0                	test   %eax,%eax
+  800f31:	7f 42                	jg     800f75 <sys_page_alloc+0x78>
+  800f33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f36:	5b                   	pop    %ebx
+  800f37:	5e                   	pop    %esi
+  800f38:	5f                   	pop    %edi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+  800f3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f40:	0f a2                	cpuid
+  800f42:	c1 ea 0b             	shr    $0xb,%edx
+  800f45:	83 e2 01             	and    $0x1,%edx
+  800f48:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800f4e:	eb bf                	jmp    800f0f <sys_page_alloc+0x12>
+  800f50:	be 00 00 00 00       	mov    $0x0,%esi
+  800f55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f63:	89 f7                	mov    %esi,%edi
+  800f65:	55                   	push   %ebp
+  800f66:	68 6f 0f 80 00       	push   $0x800f6f
+  800f6b:	89 e5                	mov    %esp,%ebp
+  800f6d:	0f 34                	sysenter
+  800f6f:	83 c4 04             	add    $0x4,%esp
+  800f72:	5d                   	pop    %ebp
+  800f73:	eb ba                	jmp    800f2f <sys_page_alloc+0x32>
+  800f75:	83 ec 0c             	sub    $0xc,%esp
+  800f78:	50                   	push   %eax
+  800f79:	6a 04                	push   $0x4
+  800f7b:	68 24 1c 80 00       	push   $0x801c24
+  800f80:	6a 49                	push   $0x49
+  800f82:	68 41 1c 80 00       	push   $0x801c41
+  800f87:	e8 36 07 00 00       	call   8016c2 <_panic>
+
+00800f8c <sys_page_map>:
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	57                   	push   %edi
+  800f90:	56                   	push   %esi
+  800f91:	53                   	push   %ebx
+  800f92:	83 ec 0c             	sub    $0xc,%esp
+  800f95:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f9c:	78 2b                	js     800fc9 <sys_page_map+0x3d>
+  800f9e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800fa5:	75 37                	jne    800fde <sys_page_map+0x52>
+  800fa7:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800faf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fb8:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fbb:	cd 30                	int    $0x30
+  800fbd:	85 c0                	test   %eax,%eax
+  800fbf:	7f 41                	jg     801002 <sys_page_map+0x76>
+  800fc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc4:	5b                   	pop    %ebx
+  800fc5:	5e                   	pop    %esi
+  800fc6:	5f                   	pop    %edi
+  800fc7:	5d                   	pop    %ebp
+  800fc8:	c3                   	ret
+  800fc9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fce:	0f a2                	cpuid
+  800fd0:	c1 ea 0b             	shr    $0xb,%edx
+  800fd3:	83 e2 01             	and    $0x1,%edx
+  800fd6:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800fdc:	eb c0                	jmp    800f9e <sys_page_map+0x12>
+  800fde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fe9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fef:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ff2:	55                   	push   %ebp
+  800ff3:	68 fc 0f 80 00       	push   $0x800ffc
+  800ff8:	89 e5                	mov    %esp,%ebp
+  800ffa:	0f 34                	sysenter
+  800ffc:	83 c4 04             	add    $0x4,%esp
+  800fff:	5d                   	pop    %ebp
+  801000:	eb bb                	jmp    800fbd <sys_page_map+0x31>
+  801002:	83 ec 0c             	sub    $0xc,%esp
+  801005:	50                   	push   %eax
+  801006:	6a 05                	push   $0x5
+  801008:	68 24 1c 80 00       	push   $0x801c24
+  80100d:	6a 49                	push   $0x49
+  80100f:	68 41 1c 80 00       	push   $0x801c41
+  801014:	e8 a9 06 00 00       	call   8016c2 <_panic>
+
+00801019 <sys_page_unmap>:
+  801019:	55                   	push   %ebp
+  80101a:	89 e5                	mov    %esp,%ebp
+  80101c:	57                   	push   %edi
+  80101d:	56                   	push   %esi
+  80101e:	53                   	push   %ebx
+  80101f:	83 ec 0c             	sub    $0xc,%esp
+  801022:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801029:	78 2b                	js     801056 <sys_page_unmap+0x3d>
+  80102b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801032:	75 37                	jne    80106b <sys_page_unmap+0x52>
+  801034:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801039:	b8 06 00 00 00       	mov    $0x6,%eax
+  80103e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801041:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801044:	89 df                	mov    %ebx,%edi
+  801046:	89 de                	mov    %ebx,%esi
+  801048:	cd 30                	int    $0x30
+  80104a:	85 c0                	test   %eax,%eax
+  80104c:	7f 41                	jg     80108f <sys_page_unmap+0x76>
+  80104e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801051:	5b                   	pop    %ebx
+  801052:	5e                   	pop    %esi
+  801053:	5f                   	pop    %edi
+  801054:	5d                   	pop    %ebp
+  801055:	c3                   	ret
+  801056:	b8 01 00 00 00       	mov    $0x1,%eax
+  80105b:	0f a2                	cpuid
+  80105d:	c1 ea 0b             	shr    $0xb,%edx
+  801060:	83 e2 01             	and    $0x1,%edx
+  801063:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801069:	eb c0                	jmp    80102b <sys_page_unmap+0x12>
+  80106b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801070:	8b 55 08             	mov    0x8(%ebp),%edx
+  801073:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801076:	b8 06 00 00 00       	mov    $0x6,%eax
+  80107b:	89 df                	mov    %ebx,%edi
+  80107d:	89 de                	mov    %ebx,%esi
+  80107f:	55                   	push   %ebp
+  801080:	68 89 10 80 00       	push   $0x801089
+  801085:	89 e5                	mov    %esp,%ebp
+  801087:	0f 34                	sysenter
+  801089:	83 c4 04             	add    $0x4,%esp
+  80108c:	5d                   	pop    %ebp
+  80108d:	eb bb                	jmp    80104a <sys_page_unmap+0x31>
+  80108f:	83 ec 0c             	sub    $0xc,%esp
+  801092:	50                   	push   %eax
+  801093:	6a 06                	push   $0x6
+  801095:	68 24 1c 80 00       	push   $0x801c24
+  80109a:	6a 49                	push   $0x49
+  80109c:	68 41 1c 80 00       	push   $0x801c41
+  8010a1:	e8 1c 06 00 00       	call   8016c2 <_panic>
+
+008010a6 <sys_page_reuse>:
+  8010a6:	55                   	push   %ebp
+  8010a7:	89 e5                	mov    %esp,%ebp
+  8010a9:	57                   	push   %edi
+  8010aa:	56                   	push   %esi
+  8010ab:	53                   	push   %ebx
+  8010ac:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010b3:	78 24                	js     8010d9 <sys_page_reuse+0x33>
+  8010b5:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010bc:	75 30                	jne    8010ee <sys_page_reuse+0x48>
+  8010be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ce:	89 df                	mov    %ebx,%edi
+  8010d0:	89 de                	mov    %ebx,%esi
+  8010d2:	cd 30                	int    $0x30
+  8010d4:	5b                   	pop    %ebx
+  8010d5:	5e                   	pop    %esi
+  8010d6:	5f                   	pop    %edi
+  8010d7:	5d                   	pop    %ebp
+  8010d8:	c3                   	ret
+  8010d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010de:	0f a2                	cpuid
+  8010e0:	c1 ea 0b             	shr    $0xb,%edx
+  8010e3:	83 e2 01             	and    $0x1,%edx
+  8010e6:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8010ec:	eb c7                	jmp    8010b5 <sys_page_reuse+0xf>
+  8010ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010fe:	89 df                	mov    %ebx,%edi
+  801100:	89 de                	mov    %ebx,%esi
+  801102:	55                   	push   %ebp
+  801103:	68 0c 11 80 00       	push   $0x80110c
+  801108:	89 e5                	mov    %esp,%ebp
+  80110a:	0f 34                	sysenter
+  80110c:	83 c4 04             	add    $0x4,%esp
+  80110f:	5d                   	pop    %ebp
+  801110:	eb c2                	jmp    8010d4 <sys_page_reuse+0x2e>
+
+00801112 <sys_env_set_status>:
+  801112:	55                   	push   %ebp
+  801113:	89 e5                	mov    %esp,%ebp
+  801115:	57                   	push   %edi
+  801116:	56                   	push   %esi
+  801117:	53                   	push   %ebx
+  801118:	83 ec 0c             	sub    $0xc,%esp
+  80111b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801122:	78 2b                	js     80114f <sys_env_set_status+0x3d>
+  801124:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80112b:	75 37                	jne    801164 <sys_env_set_status+0x52>
+  80112d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801132:	b8 08 00 00 00       	mov    $0x8,%eax
+  801137:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113d:	89 df                	mov    %ebx,%edi
+  80113f:	89 de                	mov    %ebx,%esi
+  801141:	cd 30                	int    $0x30
+  801143:	85 c0                	test   %eax,%eax
+  801145:	7f 41                	jg     801188 <sys_env_set_status+0x76>
+  801147:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114a:	5b                   	pop    %ebx
+  80114b:	5e                   	pop    %esi
+  80114c:	5f                   	pop    %edi
+  80114d:	5d                   	pop    %ebp
+  80114e:	c3                   	ret
+  80114f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801154:	0f a2                	cpuid
+  801156:	c1 ea 0b             	shr    $0xb,%edx
+  801159:	83 e2 01             	and    $0x1,%edx
+  80115c:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801162:	eb c0                	jmp    801124 <sys_env_set_status+0x12>
+  801164:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801169:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801174:	89 df                	mov    %ebx,%edi
+  801176:	89 de                	mov    %ebx,%esi
+  801178:	55                   	push   %ebp
+  801179:	68 82 11 80 00       	push   $0x801182
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	0f 34                	sysenter
+  801182:	83 c4 04             	add    $0x4,%esp
+  801185:	5d                   	pop    %ebp
+  801186:	eb bb                	jmp    801143 <sys_env_set_status+0x31>
+  801188:	83 ec 0c             	sub    $0xc,%esp
+  80118b:	50                   	push   %eax
+  80118c:	6a 08                	push   $0x8
+  80118e:	68 24 1c 80 00       	push   $0x801c24
+  801193:	6a 49                	push   $0x49
+  801195:	68 41 1c 80 00       	push   $0x801c41
+  80119a:	e8 23 05 00 00       	call   8016c2 <_panic>
+
+0080119f <sys_env_set_pgfault_upcall>:
+  80119f:	55                   	push   %ebp
+  8011a0:	89 e5                	mov    %esp,%ebp
+  8011a2:	57                   	push   %edi
+  8011a3:	56                   	push   %esi
+  8011a4:	53                   	push   %ebx
+  8011a5:	83 ec 0c             	sub    $0xc,%esp
+  8011a8:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011af:	78 2b                	js     8011dc <sys_env_set_pgfault_upcall+0x3d>
+  8011b1:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011b8:	75 37                	jne    8011f1 <sys_env_set_pgfault_upcall+0x52>
+  8011ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011bf:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ca:	89 df                	mov    %ebx,%edi
+  8011cc:	89 de                	mov    %ebx,%esi
+  8011ce:	cd 30                	int    $0x30
+  8011d0:	85 c0                	test   %eax,%eax
+  8011d2:	7f 41                	jg     801215 <sys_env_set_pgfault_upcall+0x76>
+  8011d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d7:	5b                   	pop    %ebx
+  8011d8:	5e                   	pop    %esi
+  8011d9:	5f                   	pop    %edi
+  8011da:	5d                   	pop    %ebp
+  8011db:	c3                   	ret
+  8011dc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011e1:	0f a2                	cpuid
+  8011e3:	c1 ea 0b             	shr    $0xb,%edx
+  8011e6:	83 e2 01             	and    $0x1,%edx
+  8011e9:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8011ef:	eb c0                	jmp    8011b1 <sys_env_set_pgfault_upcall+0x12>
+  8011f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011fc:	b8 09 00 00 00       	mov    $0x9,%eax
+  801201:	89 df                	mov    %ebx,%edi
+  801203:	89 de                	mov    %ebx,%esi
+  801205:	55                   	push   %ebp
+  801206:	68 0f 12 80 00       	push   $0x80120f
+  80120b:	89 e5                	mov    %esp,%ebp
+  80120d:	0f 34                	sysenter
+  80120f:	83 c4 04             	add    $0x4,%esp
+  801212:	5d                   	pop    %ebp
+  801213:	eb bb                	jmp    8011d0 <sys_env_set_pgfault_upcall+0x31>
+  801215:	83 ec 0c             	sub    $0xc,%esp
+  801218:	50                   	push   %eax
+  801219:	6a 09                	push   $0x9
+  80121b:	68 24 1c 80 00       	push   $0x801c24
+  801220:	6a 49                	push   $0x49
+  801222:	68 41 1c 80 00       	push   $0x801c41
+  801227:	e8 96 04 00 00       	call   8016c2 <_panic>
+
+0080122c <sys_env_set_trace>:
+  80122c:	55                   	push   %ebp
+  80122d:	89 e5                	mov    %esp,%ebp
+  80122f:	57                   	push   %edi
+  801230:	56                   	push   %esi
+  801231:	53                   	push   %ebx
+  801232:	83 ec 0c             	sub    $0xc,%esp
+  801235:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80123c:	78 2b                	js     801269 <sys_env_set_trace+0x3d>
+  80123e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801245:	75 37                	jne    80127e <sys_env_set_trace+0x52>
+  801247:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801251:	8b 55 08             	mov    0x8(%ebp),%edx
+  801254:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801257:	89 df                	mov    %ebx,%edi
+  801259:	89 de                	mov    %ebx,%esi
+  80125b:	cd 30                	int    $0x30
+  80125d:	85 c0                	test   %eax,%eax
+  80125f:	7f 41                	jg     8012a2 <sys_env_set_trace+0x76>
+  801261:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801264:	5b                   	pop    %ebx
+  801265:	5e                   	pop    %esi
+  801266:	5f                   	pop    %edi
+  801267:	5d                   	pop    %ebp
+  801268:	c3                   	ret
+  801269:	b8 01 00 00 00       	mov    $0x1,%eax
+  80126e:	0f a2                	cpuid
+  801270:	c1 ea 0b             	shr    $0xb,%edx
+  801273:	83 e2 01             	and    $0x1,%edx
+  801276:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80127c:	eb c0                	jmp    80123e <sys_env_set_trace+0x12>
+  80127e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801283:	8b 55 08             	mov    0x8(%ebp),%edx
+  801286:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801289:	b8 12 00 00 00       	mov    $0x12,%eax
+  80128e:	89 df                	mov    %ebx,%edi
+  801290:	89 de                	mov    %ebx,%esi
+  801292:	55                   	push   %ebp
+  801293:	68 9c 12 80 00       	push   $0x80129c
+  801298:	89 e5                	mov    %esp,%ebp
+  80129a:	0f 34                	sysenter
+  80129c:	83 c4 04             	add    $0x4,%esp
+  80129f:	5d                   	pop    %ebp
+  8012a0:	eb bb                	jmp    80125d <sys_env_set_trace+0x31>
+  8012a2:	83 ec 0c             	sub    $0xc,%esp
+  8012a5:	50                   	push   %eax
+  8012a6:	6a 12                	push   $0x12
+  8012a8:	68 24 1c 80 00       	push   $0x801c24
+  8012ad:	6a 49                	push   $0x49
+  8012af:	68 41 1c 80 00       	push   $0x801c41
+  8012b4:	e8 09 04 00 00       	call   8016c2 <_panic>
+
+008012b9 <sys_env_set_rdpmc>:
+  8012b9:	55                   	push   %ebp
+  8012ba:	89 e5                	mov    %esp,%ebp
+  8012bc:	57                   	push   %edi
+  8012bd:	56                   	push   %esi
+  8012be:	53                   	push   %ebx
+  8012bf:	83 ec 0c             	sub    $0xc,%esp
+  8012c2:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012c9:	78 2b                	js     8012f6 <sys_env_set_rdpmc+0x3d>
+  8012cb:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8012d2:	75 37                	jne    80130b <sys_env_set_rdpmc+0x52>
+  8012d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e4:	89 df                	mov    %ebx,%edi
+  8012e6:	89 de                	mov    %ebx,%esi
+  8012e8:	cd 30                	int    $0x30
+  8012ea:	85 c0                	test   %eax,%eax
+  8012ec:	7f 41                	jg     80132f <sys_env_set_rdpmc+0x76>
+  8012ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f1:	5b                   	pop    %ebx
+  8012f2:	5e                   	pop    %esi
+  8012f3:	5f                   	pop    %edi
+  8012f4:	5d                   	pop    %ebp
+  8012f5:	c3                   	ret
+  8012f6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012fb:	0f a2                	cpuid
+  8012fd:	c1 ea 0b             	shr    $0xb,%edx
+  801300:	83 e2 01             	and    $0x1,%edx
+  801303:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801309:	eb c0                	jmp    8012cb <sys_env_set_rdpmc+0x12>
+  80130b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801310:	8b 55 08             	mov    0x8(%ebp),%edx
+  801313:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801316:	b8 13 00 00 00       	mov    $0x13,%eax
+  80131b:	89 df                	mov    %ebx,%edi
+  80131d:	89 de                	mov    %ebx,%esi
+  80131f:	55                   	push   %ebp
+  801320:	68 29 13 80 00       	push   $0x801329
+  801325:	89 e5                	mov    %esp,%ebp
+  801327:	0f 34                	sysenter
+  801329:	83 c4 04             	add    $0x4,%esp
+  80132c:	5d                   	pop    %ebp
+  80132d:	eb bb                	jmp    8012ea <sys_env_set_rdpmc+0x31>
+  80132f:	83 ec 0c             	sub    $0xc,%esp
+  801332:	50                   	push   %eax
+  801333:	6a 13                	push   $0x13
+  801335:	68 24 1c 80 00       	push   $0x801c24
+  80133a:	6a 49                	push   $0x49
+  80133c:	68 41 1c 80 00       	push   $0x801c41
+  801341:	e8 7c 03 00 00       	call   8016c2 <_panic>
+
+00801346 <sys_ring_setup>:
+  801346:	55                   	push   %ebp
+  801347:	89 e5                	mov    %esp,%ebp
+  801349:	57                   	push   %edi
+  80134a:	56                   	push   %esi
+  80134b:	53                   	push   %ebx
+  80134c:	83 ec 0c             	sub    $0xc,%esp
+  80134f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801356:	78 29                	js     801381 <sys_ring_setup+0x3b>
+  801358:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80135f:	75 35                	jne    801396 <sys_ring_setup+0x50>
+  801361:	ba 00 00 00 00       	mov    $0x0,%edx
+  801366:	b8 10 00 00 00       	mov    $0x10,%eax
+  80136b:	89 d1                	mov    %edx,%ecx
+  80136d:	89 d3                	mov    %edx,%ebx
+  80136f:	89 d7                	mov    %edx,%edi
+  801371:	89 d6                	mov    %edx,%esi
+  801373:	cd 30                	int    $0x30
+  801375:	85 c0                	test   %eax,%eax
+  801377:	7f 3f                	jg     8013b8 <sys_ring_setup+0x72>
+  801379:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137c:	5b                   	pop    %ebx
+  80137d:	5e                   	pop    %esi
+  80137e:	5f                   	pop    %edi
+  80137f:	5d                   	pop    %ebp
+  801380:	c3                   	ret
+  801381:	b8 01 00 00 00       	mov    $0x1,%eax
+  801386:	0f a2                	cpuid
+  801388:	c1 ea 0b             	shr    $0xb,%edx
+  80138b:	83 e2 01             	and    $0x1,%edx
+  80138e:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801394:	eb c2                	jmp    801358 <sys_ring_setup+0x12>
+  801396:	ba 00 00 00 00       	mov    $0x0,%edx
+  80139b:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013a0:	89 d1                	mov    %edx,%ecx
+  8013a2:	89 d3                	mov    %edx,%ebx
+  8013a4:	89 d7                	mov    %edx,%edi
+  8013a6:	89 d6                	mov    %edx,%esi
+  8013a8:	55                   	push   %ebp
+  8013a9:	68 b2 13 80 00       	push   $0x8013b2
+  8013ae:	89 e5                	mov    %esp,%ebp
+  8013b0:	0f 34                	sysenter
+  8013b2:	83 c4 04             	add    $0x4,%esp
+  8013b5:	5d                   	pop    %ebp
+  8013b6:	eb bd                	jmp    801375 <sys_ring_setup+0x2f>
+  8013b8:	83 ec 0c             	sub    $0xc,%esp
+  8013bb:	50                   	push   %eax
+  8013bc:	6a 10                	push   $0x10
+  8013be:	68 24 1c 80 00       	push   $0x801c24
+  8013c3:	6a 49                	push   $0x49
+  8013c5:	68 41 1c 80 00       	push   $0x801c41
+  8013ca:	e8 f3 02 00 00       	call   8016c2 <_panic>
+
+008013cf <sys_ring_enter>:
+  8013cf:	55                   	push   %ebp
+  8013d0:	89 e5                	mov    %esp,%ebp
+  8013d2:	57                   	push   %edi
+  8013d3:	56                   	push   %esi
+  8013d4:	53                   	push   %ebx
+  8013d5:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8013dc:	78 22                	js     801400 <sys_ring_enter+0x31>
+  8013de:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8013e5:	75 2e                	jne    801415 <sys_ring_enter+0x46>
+  8013e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ec:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013f1:	89 d1                	mov    %edx,%ecx
+  8013f3:	89 d3                	mov    %edx,%ebx
+  8013f5:	89 d7                	mov    %edx,%edi
+  8013f7:	89 d6                	mov    %edx,%esi
+  8013f9:	cd 30                	int    $0x30
+  8013fb:	5b                   	pop    %ebx
+  8013fc:	5e                   	pop    %esi
+  8013fd:	5f                   	pop    %edi
+  8013fe:	5d                   	pop    %ebp
+  8013ff:	c3                   	ret
+  801400:	b8 01 00 00 00       	mov    $0x1,%eax
+  801405:	0f a2                	cpuid
+  801407:	c1 ea 0b             	shr    $0xb,%edx
+  80140a:	83 e2 01             	and    $0x1,%edx
+  80140d:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801413:	eb c9                	jmp    8013de <sys_ring_enter+0xf>
+  801415:	ba 00 00 00 00       	mov    $0x0,%edx
+  80141a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80141f:	89 d1                	mov    %edx,%ecx
+  801421:	89 d3                	mov    %edx,%ebx
+  801423:	89 d7                	mov    %edx,%edi
+  801425:	89 d6                	mov    %edx,%esi
+  801427:	55                   	push   %ebp
+  801428:	68 31 14 80 00       	push   $0x801431
+  80142d:	89 e5                	mov    %esp,%ebp
+  80142f:	0f 34                	sysenter
+  801431:	83 c4 04             	add    $0x4,%esp
+  801434:	5d                   	pop    %ebp
+  801435:	eb c4                	jmp    8013fb <sys_ring_enter+0x2c>
+
+00801437 <sys_ipc_try_send>:
+  801437:	55                   	push   %ebp
+  801438:	89 e5                	mov    %esp,%ebp
+  80143a:	57                   	push   %edi
+  80143b:	56                   	push   %esi
+  80143c:	53                   	push   %ebx
+  80143d:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801444:	78 26                	js     80146c <sys_ipc_try_send+0x35>
+  801446:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80144d:	75 32                	jne    801481 <sys_ipc_try_send+0x4a>
+  80144f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801454:	be 00 00 00 00       	mov    $0x0,%esi
+  801459:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801462:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801465:	cd 30                	int    $0x30
+  801467:	5b                   	pop    %ebx
+  801468:	5e                   	pop    %esi
+  801469:	5f                   	pop    %edi
+  80146a:	5d                   	pop    %ebp
+  80146b:	c3                   	ret
+  80146c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801471:	0f a2                	cpuid
+  801473:	c1 ea 0b             	shr    $0xb,%edx
+  801476:	83 e2 01             	and    $0x1,%edx
+  801479:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80147f:	eb c5                	jmp    801446 <sys_ipc_try_send+0xf>
+  801481:	8b 55 08             	mov    0x8(%ebp),%edx
+  801484:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801487:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80148c:	be 00 00 00 00       	mov    $0x0,%esi
+  801491:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801494:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801497:	55                   	push   %ebp
+  801498:	68 a1 14 80 00       	push   $0x8014a1
+  80149d:	89 e5                	mov    %esp,%ebp
+  80149f:	0f 34                	sysenter
+  8014a1:	83 c4 04             	add    $0x4,%esp
+  8014a4:	5d                   	pop    %ebp
+  8014a5:	eb c0                	jmp    801467 <sys_ipc_try_send+0x30>
+
+008014a7 <sys_ipc_recv>:
+  8014a7:	55                   	push   %ebp
+  8014a8:	89 e5                	mov    %esp,%ebp
+  8014aa:	57                   	push   %edi
+  8014ab:	56                   	push   %esi
+  8014ac:	53                   	push   %ebx
+  8014ad:	83 ec 0c             	sub    $0xc,%esp
+  8014b0:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014b7:	78 2a                	js     8014e3 <sys_ipc_recv+0x3c>
+  8014b9:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014c0:	75 36                	jne    8014f8 <sys_ipc_recv+0x51>
+  8014c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014c7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014cf:	89 cb                	mov    %ecx,%ebx
+  8014d1:	89 cf                	mov    %ecx,%edi
+  8014d3:	89 ce                	mov    %ecx,%esi
+  8014d5:	cd 30                	int    $0x30
+  8014d7:	85 c0                	test   %eax,%eax
+  8014d9:	7f 40                	jg     80151b <sys_ipc_recv+0x74>
+  8014db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014de:	5b                   	pop    %ebx
+  8014df:	5e                   	pop    %esi
+  8014e0:	5f                   	pop    %edi
+  8014e1:	5d                   	pop    %ebp
+  8014e2:	c3                   	ret
+  8014e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014e8:	0f a2                	cpuid
+  8014ea:	c1 ea 0b             	shr    $0xb,%edx
+  8014ed:	83 e2 01             	and    $0x1,%edx
+  8014f0:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8014f6:	eb c1                	jmp    8014b9 <sys_ipc_recv+0x12>
+  8014f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801500:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801505:	89 cb                	mov    %ecx,%ebx
+  801507:	89 cf                	mov    %ecx,%edi
+  801509:	89 ce                	mov    %ecx,%esi
+  80150b:	55                   	push   %ebp
+  80150c:	68 15 15 80 00       	push   $0x801515
+  801511:	89 e5                	mov    %esp,%ebp
+  801513:	0f 34                	sysenter
+  801515:	83 c4 04             	add    $0x4,%esp
+  801518:	5d                   	pop    %ebp
+  801519:	eb bc                	jmp    8014d7 <sys_ipc_recv+0x30>
+  80151b:	83 ec 0c             	sub    $0xc,%esp
+  80151e:	50                   	push   %eax
+  80151f:	6a 0c                	push   $0xc
+  801521:	68 24 1c 80 00       	push   $0x801c24
+  801526:	6a 49                	push   $0x49
+  801528:	68 41 1c 80 00       	push   $0x801c41
+  80152d:	e8 90 01 00 00       	call   8016c2 <_panic>
+
+00801532 <uinfo_envid>:
+  801532:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  801537:	c3                   	ret
+
+00801538 <uinfo_cpunum>:
+  801538:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  80153d:	c3                   	ret
+
+0080153e <uinfo_ticks>:
+  80153e:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  801543:	c3                   	ret
+
+00801544 <uinfo_nsec>:
+  801544:	55                   	push   %ebp
+  801545:	89 e5                	mov    %esp,%ebp
+  801547:	57                   	push   %edi
+  801548:	56                   	push   %esi
+  801549:	53                   	push   %ebx
+  80154a:	83 ec 1c             	sub    $0x1c,%esp
+  80154d:	0f 31                	rdtsc
+  80154f:	89 c6                	mov    %eax,%esi
+  801551:	89 d7                	mov    %edx,%edi
+  801553:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801559:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801563:	85 c9                	test   %ecx,%ecx
+  801565:	74 5c                	je     8015c3 <uinfo_nsec+0x7f>
+  801567:	ba 00 00 00 00       	mov    $0x0,%edx
+  80156c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80156f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801572:	52                   	push   %edx
+  801573:	51                   	push   %ecx
+  801574:	57                   	push   %edi
+  801575:	56                   	push   %esi
+  801576:	e8 6a 02 00 00       	call   8017e5 <__umoddi3>
+  80157b:	83 c4 10             	add    $0x10,%esp
+  80157e:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801584:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801589:	f7 e3                	mul    %ebx
+  80158b:	01 ca                	add    %ecx,%edx
+  80158d:	ff 75 e4             	push   -0x1c(%ebp)
+  801590:	ff 75 e0             	push   -0x20(%ebp)
+  801593:	52                   	push   %edx
+  801594:	50                   	push   %eax
+  801595:	e8 73 01 00 00       	call   80170d <__udivdi3>
+  80159a:	83 c4 10             	add    $0x10,%esp
+  80159d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8015a0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8015a3:	ff 75 e4             	push   -0x1c(%ebp)
+  8015a6:	ff 75 e0             	push   -0x20(%ebp)
+  8015a9:	57                   	push   %edi
+  8015aa:	56                   	push   %esi
+  8015ab:	e8 5d 01 00 00       	call   80170d <__udivdi3>
+  8015b0:	83 c4 10             	add    $0x10,%esp
+  8015b3:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  8015b9:	f7 e3                	mul    %ebx
+  8015bb:	01 ca                	add    %ecx,%edx
+  8015bd:	03 45 d8             	add    -0x28(%ebp),%eax
+  8015c0:	13 55 dc             	adc    -0x24(%ebp),%edx
+  8015c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c6:	5b                   	pop    %ebx
+  8015c7:	5e                   	pop    %esi
+  8015c8:	5f                   	pop    %edi
+  8015c9:	5d                   	pop    %ebp
+  8015ca:	c3                   	ret
+
+008015cb <bflush>:
+  8015cb:	a1 40 20 80 00       	mov    0x802040,%eax
+  8015d0:	85 c0                	test   %eax,%eax
+  8015d2:	75 01                	jne    8015d5 <bflush+0xa>
+  8015d4:	c3                   	ret
+  8015d5:	55                   	push   %ebp
+  8015d6:	89 e5                	mov    %esp,%ebp
+  8015d8:	83 ec 10             	sub    $0x10,%esp
+  8015db:	50                   	push   %eax
+  8015dc:	68 44 20 80 00       	push   $0x802044
+  8015e1:	e8 d4 f5 ff ff       	call   800bba <sys_cputs>
+  8015e6:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  8015ed:	00 00 00 
+  8015f0:	83 c4 10             	add    $0x10,%esp
+  8015f3:	c9                   	leave
+  8015f4:	c3                   	ret
+
+008015f5 <bputch>:
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	53                   	push   %ebx
+  8015f9:	83 ec 04             	sub    $0x4,%esp
+  8015fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8015ff:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  801605:	8d 42 01             	lea    0x1(%edx),%eax
+  801608:	a3 40 20 80 00       	mov    %eax,0x802040
+  80160d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801610:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  801616:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80161b:	77 08                	ja     801625 <bputch+0x30>
+  80161d:	83 03 01             	addl   $0x1,(%ebx)
+  801620:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801623:	c9                   	leave
+  801624:	c3                   	ret
+  801625:	e8 a1 ff ff ff       	call   8015cb <bflush>
+  80162a:	eb f1                	jmp    80161d <bputch+0x28>
+
+0080162c <vbprintf>:
+  80162c:	55                   	push   %ebp
+  80162d:	89 e5                	mov    %esp,%ebp
+  80162f:	83 ec 18             	sub    $0x18,%esp
+  801632:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801639:	ff 75 0c             	push   0xc(%ebp)
+  80163c:	ff 75 08             	push   0x8(%ebp)
+  80163f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801642:	50                   	push   %eax
+  801643:	68 f5 15 80 00       	push   $0x8015f5
+  801648:	e8 00 ec ff ff       	call   80024d <vprintfmt>
+  80164d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801650:	c9                   	leave
+  801651:	c3                   	ret
+
+00801652 <bprintf>:
+  801652:	55                   	push   %ebp
+  801653:	89 e5                	mov    %esp,%ebp
+  801655:	83 ec 10             	sub    $0x10,%esp
+  801658:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80165b:	50                   	push   %eax
+  80165c:	ff 75 08             	push   0x8(%ebp)
+  80165f:	e8 c8 ff ff ff       	call   80162c <vbprintf>
+  801664:	c9                   	leave
+  801665:	c3                   	ret
+
+00801666 <bwrite>:
+  801666:	55                   	push   %ebp
+  801667:	89 e5                	mov    %esp,%ebp
+  801669:	53                   	push   %ebx
+  80166a:	83 ec 04             	sub    $0x4,%esp
+  80166d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801670:	89 d8                	mov    %ebx,%eax
+  801672:	03 05 40 20 80 00    	add    0x802040,%eax
+  801678:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80167d:	76 0d                	jbe    80168c <bwrite+0x26>
+  80167f:	e8 47 ff ff ff       	call   8015cb <bflush>
+  801684:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  80168a:	77 25                	ja     8016b1 <bwrite+0x4b>
+  80168c:	83 ec 04             	sub    $0x4,%esp
+  80168f:	53                   	push   %ebx
+  801690:	ff 75 08             	push   0x8(%ebp)
+  801693:	a1 40 20 80 00       	mov    0x802040,%eax
+  801698:	05 44 20 80 00       	add    $0x802044,%eax
+  80169d:	50                   	push   %eax
+  80169e:	e8 15 f3 ff ff       	call   8009b8 <memcpy>
+  8016a3:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  8016a9:	83 c4 10             	add    $0x10,%esp
+  8016ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016af:	c9                   	leave
+  8016b0:	c3                   	ret
+  8016b1:	83 ec 08             	sub    $0x8,%esp
+  8016b4:	53                   	push   %ebx
+  8016b5:	ff 75 08             	push   0x8(%ebp)
+  8016b8:	e8 fd f4 ff ff       	call   800bba <sys_cputs>
+  8016bd:	83 c4 10             	add    $0x10,%esp
+  8016c0:	eb ea                	jmp    8016ac <bwrite+0x46>
+
+008016c2 <_panic>:
+  8016c2:	55                   	push   %ebp
+  8016c3:	89 e5                	mov    %esp,%ebp
+  8016c5:	56                   	push   %esi
+  8016c6:	53                   	push   %ebx
+  8016c7:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8016ca:	e8 fc fe ff ff       	call   8015cb <bflush>
+  8016cf:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  8016d5:	e8 39 f6 ff ff       	call   800d13 <sys_getenvid>
+  8016da:	83 ec 0c             	sub    $0xc,%esp
+  8016dd:	ff 75 0c             	push   0xc(%ebp)
+  8016e0:	ff 75 08             	push   0x8(%ebp)
+  8016e3:	56                   	push   %esi
+  8016e4:	50                   	push   %eax
+  8016e5:	68 50 1c 80 00       	push   $0x801c50
+  8016ea:	e8 67 ea ff ff       	call   800156 <cprintf>
+  8016ef:	83 c4 18             	add    $0x18,%esp
+  8016f2:	53                   	push   %ebx
+  8016f3:	ff 75 10             	push   0x10(%ebp)
+  8016f6:	e8 0a ea ff ff       	call   800105 <vcprintf>
+  8016fb:	c7 04 24 ac 19 80 00 	movl   $0x8019ac,(%esp)
+  801702:	e8 4f ea ff ff       	call   800156 <cprintf>
+  801707:	83 c4 10             	add    $0x10,%esp
+  80170a:	cc                   	int3
+  80170b:	eb fd                	jmp    80170a <_panic+0x48>
+
+0080170d <__udivdi3>:
+  80170d:	57                   	push   %edi
+  80170e:	56                   	push   %esi
+  80170f:	53                   	push   %ebx
+  801710:	83 ec 20             	sub    $0x20,%esp
+  801713:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801717:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80171b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80171f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801723:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801727:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80172b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80172f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801733:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801737:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  80173b:	89 d1                	mov    %edx,%ecx
+  80173d:	09 c1                	or     %eax,%ecx
+  80173f:	0f 84 91 00 00 00    	je     8017d6 <__udivdi3+0xc9>
+  801745:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80174c:	00 
+  80174d:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801754:	00 
+  801755:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80175a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801764:	eb 08                	jmp    80176e <__udivdi3+0x61>
+  801766:	83 e9 01             	sub    $0x1,%ecx
+  801769:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80176c:	74 68                	je     8017d6 <__udivdi3+0xc9>
+  80176e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801772:	01 c0                	add    %eax,%eax
+  801774:	89 c6                	mov    %eax,%esi
+  801776:	89 d7                	mov    %edx,%edi
+  801778:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80177c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801780:	0f ad d0             	shrd   %cl,%edx,%eax
+  801783:	d3 ea                	shr    %cl,%edx
+  801785:	f6 c1 20             	test   $0x20,%cl
+  801788:	74 04                	je     80178e <__udivdi3+0x81>
+  80178a:	89 d0                	mov    %edx,%eax
+  80178c:	31 d2                	xor    %edx,%edx
+  80178e:	83 e0 01             	and    $0x1,%eax
+  801791:	89 04 24             	mov    %eax,(%esp)
+  801794:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80179b:	00 
+  80179c:	8b 04 24             	mov    (%esp),%eax
+  80179f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8017a3:	09 f0                	or     %esi,%eax
+  8017a5:	09 fa                	or     %edi,%edx
+  8017a7:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8017ab:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8017af:	39 f0                	cmp    %esi,%eax
+  8017b1:	89 d3                	mov    %edx,%ebx
+  8017b3:	19 fb                	sbb    %edi,%ebx
+  8017b5:	72 af                	jb     801766 <__udivdi3+0x59>
+  8017b7:	29 f0                	sub    %esi,%eax
+  8017b9:	19 fa                	sbb    %edi,%edx
+  8017bb:	89 cf                	mov    %ecx,%edi
+  8017bd:	c1 ef 05             	shr    $0x5,%edi
+  8017c0:	83 e7 01             	and    $0x1,%edi
+  8017c3:	89 fe                	mov    %edi,%esi
+  8017c5:	83 f6 01             	xor    $0x1,%esi
+  8017c8:	d3 e6                	shl    %cl,%esi
+  8017ca:	d3 e7                	shl    %cl,%edi
+  8017cc:	09 74 24 18          	or     %esi,0x18(%esp)
+  8017d0:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8017d4:	eb 90                	jmp    801766 <__udivdi3+0x59>
+  8017d6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8017da:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8017de:	83 c4 20             	add    $0x20,%esp
+  8017e1:	5b                   	pop    %ebx
+  8017e2:	5e                   	pop    %esi
+  8017e3:	5f                   	pop    %edi
+  8017e4:	c3                   	ret
+
+008017e5 <__umoddi3>:
+  8017e5:	55                   	push   %ebp
+  8017e6:	57                   	push   %edi
+  8017e7:	56                   	push   %esi
+  8017e8:	53                   	push   %ebx
+  8017e9:	83 ec 1c             	sub    $0x1c,%esp
+  8017ec:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8017f0:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8017f4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8017f8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8017fc:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801800:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801804:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801808:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80180c:	89 d6                	mov    %edx,%esi
+  80180e:	09 c6                	or     %eax,%esi
+  801810:	74 6c                	je     80187e <__umoddi3+0x99>
+  801812:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801821:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801825:	eb 0e                	jmp    801835 <__umoddi3+0x50>
+  801827:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  80182c:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801830:	83 fe ff             	cmp    $0xffffffff,%esi
+  801833:	74 49                	je     80187e <__umoddi3+0x99>
+  801835:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801839:	01 c0                	add    %eax,%eax
+  80183b:	89 c3                	mov    %eax,%ebx
+  80183d:	89 d6                	mov    %edx,%esi
+  80183f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801843:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801847:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  80184c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80184f:	d3 ea                	shr    %cl,%edx
+  801851:	f6 c1 20             	test   $0x20,%cl
+  801854:	74 04                	je     80185a <__umoddi3+0x75>
+  801856:	89 d0                	mov    %edx,%eax
+  801858:	31 d2                	xor    %edx,%edx
+  80185a:	83 e0 01             	and    $0x1,%eax
+  80185d:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801862:	89 ea                	mov    %ebp,%edx
+  801864:	09 d8                	or     %ebx,%eax
+  801866:	09 f2                	or     %esi,%edx
+  801868:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  80186c:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801870:	39 d8                	cmp    %ebx,%eax
+  801872:	89 d1                	mov    %edx,%ecx
+  801874:	19 f1                	sbb    %esi,%ecx
+  801876:	72 af                	jb     801827 <__umoddi3+0x42>
+  801878:	29 d8                	sub    %ebx,%eax
+  80187a:	19 f2                	sbb    %esi,%edx
+  80187c:	eb a9                	jmp    801827 <__umoddi3+0x42>
+  80187e:	83 c4 1c             	add    $0x1c,%esp
+  801881:	5b                   	pop    %ebx
+  801882:	5e                   	pop    %esi
+  801883:	5f                   	pop    %edi
+  801884:	5d                   	pop    %ebp
+  801885:	c3                   	ret
+
+00801886 <__divdi3>:
+  801886:	53                   	push   %ebx
+  801887:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80188b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80188f:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801893:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801897:	85 d2                	test   %edx,%edx
+  801899:	78 12                	js     8018ad <__divdi3+0x27>
+  80189b:	85 db                	test   %ebx,%ebx
+  80189d:	78 2e                	js     8018cd <__divdi3+0x47>
+  80189f:	53                   	push   %ebx
+  8018a0:	51                   	push   %ecx
+  8018a1:	52                   	push   %edx
+  8018a2:	50                   	push   %eax
+  8018a3:	e8 65 fe ff ff       	call   80170d <__udivdi3>
+  8018a8:	83 c4 10             	add    $0x10,%esp
+  8018ab:	eb 1e                	jmp    8018cb <__divdi3+0x45>
+  8018ad:	f7 d8                	neg    %eax
+  8018af:	83 d2 00             	adc    $0x0,%edx
+  8018b2:	f7 da                	neg    %edx
+  8018b4:	85 db                	test   %ebx,%ebx
+  8018b6:	78 2a                	js     8018e2 <__divdi3+0x5c>
+  8018b8:	53                   	push   %ebx
+  8018b9:	51                   	push   %ecx
+  8018ba:	52                   	push   %edx
+  8018bb:	50                   	push   %eax
+  8018bc:	e8 4c fe ff ff       	call   80170d <__udivdi3>
+  8018c1:	83 c4 10             	add    $0x10,%esp
+  8018c4:	f7 d8                	neg    %eax
+  8018c6:	83 d2 00             	adc    $0x0,%edx
+  8018c9:	f7 da                	neg    %edx
+  8018cb:	5b                   	pop    %ebx
+  8018cc:	c3                   	ret
+  8018cd:	f7 d9                	neg    %ecx
+  8018cf:	83 d3 00             	adc    $0x0,%ebx
+  8018d2:	f7 db                	neg    %ebx
+  8018d4:	53                   	push   %ebx
+  8018d5:	51                   	push   %ecx
+  8018d6:	52                   	push   %edx
+  8018d7:	50                   	push   %eax
+  8018d8:	e8 30 fe ff ff       	call   80170d <__udivdi3>
+  8018dd:	83 c4 10             	add    $0x10,%esp
+  8018e0:	eb e2                	jmp    8018c4 <__divdi3+0x3e>
+  8018e2:	f7 d9                	neg    %ecx
+  8018e4:	83 d3 00             	adc    $0x0,%ebx
+  8018e7:	f7 db                	neg    %ebx
+  8018e9:	53                   	push   %ebx
+  8018ea:	51                   	push   %ecx
+  8018eb:	52                   	push   %edx
+  8018ec:	50                   	push   %eax
+  8018ed:	e8 1b fe ff ff       	call   80170d <__udivdi3>
+  8018f2:	83 c4 10             	add    $0x10,%esp
+  8018f5:	eb d4                	jmp    8018cb <__divdi3+0x45>
+
+008018f7 <__moddi3>:
+  8018f7:	55                   	push   %ebp
+  8018f8:	57                   	push   %edi
+  8018f9:	56                   	push   %esi
+  8018fa:	53                   	push   %ebx
+  8018fb:	83 ec 14             	sub    $0x14,%esp
+  8018fe:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801902:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801906:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80190a:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80190e:	85 ed                	test   %ebp,%ebp
+  801910:	78 2b                	js     80193d <__moddi3+0x46>
+  801912:	89 c6                	mov    %eax,%esi
+  801914:	f7 de                	neg    %esi
+  801916:	89 34 24             	mov    %esi,(%esp)
+  801919:	89 d6                	mov    %edx,%esi
+  80191b:	83 d6 00             	adc    $0x0,%esi
+  80191e:	f7 de                	neg    %esi
+  801920:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801924:	8b 34 24             	mov    (%esp),%esi
+  801927:	0f 48 f0             	cmovs  %eax,%esi
+  80192a:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  80192f:	52                   	push   %edx
+  801930:	56                   	push   %esi
+  801931:	55                   	push   %ebp
+  801932:	57                   	push   %edi
+  801933:	e8 ad fe ff ff       	call   8017e5 <__umoddi3>
+  801938:	83 c4 10             	add    $0x10,%esp
+  80193b:	eb 3c                	jmp    801979 <__moddi3+0x82>
+  80193d:	89 c3                	mov    %eax,%ebx
+  80193f:	f7 db                	neg    %ebx
+  801941:	89 d1                	mov    %edx,%ecx
+  801943:	83 d1 00             	adc    $0x0,%ecx
+  801946:	f7 d9                	neg    %ecx
+  801948:	0f 49 c3             	cmovns %ebx,%eax
+  80194b:	89 04 24             	mov    %eax,(%esp)
+  80194e:	0f 49 d1             	cmovns %ecx,%edx
+  801951:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801955:	ff 74 24 04          	push   0x4(%esp)
+  801959:	ff 74 24 04          	push   0x4(%esp)
+  80195d:	89 f8                	mov    %edi,%eax
+  80195f:	89 ea                	mov    %ebp,%edx
+  801961:	f7 d8                	neg    %eax
+  801963:	83 d2 00             	adc    $0x0,%edx
+  801966:	f7 da                	neg    %edx
+  801968:	52                   	push   %edx
+  801969:	50                   	push   %eax
+  80196a:	e8 76 fe ff ff       	call   8017e5 <__umoddi3>
+  80196f:	83 c4 10             	add    $0x10,%esp
+  801972:	f7 d8                	neg    %eax
+  801974:	83 d2 00             	adc    $0x0,%edx
+  801977:	f7 da                	neg    %edx
+  801979:	83 c4 14             	add    $0x14,%esp
+  80197c:	5b                   	pop    %ebx
+  80197d:	5e                   	pop    %esi
+  80197e:	5f                   	pop    %edi
+  80197f:	5d                   	pop    %ebp
+  801980:	c3                   	ret
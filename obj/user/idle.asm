@@ -0,0 +1,2572 @@
+
+obj/user/idle:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 19 00 00 00       	call   80004a <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+  800039:	c7 05 00 20 80 00 80 	movl   $0x801980,0x802000
+  800040:	19 80 00 
+  800043:	e8 26 02 00 00       	call   80026e <sys_yield>
+  800048:	eb f9                	jmp    800043 <umain+0x10>
+
+0080004a <libmain>:
+  80004a:	55                   	push   %ebp
+  80004b:	89 e5                	mov    %esp,%ebp
+  80004d:	56                   	push   %esi
+  80004e:	53                   	push   %ebx
+  80004f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800052:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800055:	e8 cb 09 00 00       	call   800a25 <uinfo_envid>
+  80005a:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80005f:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  800065:	05 00 00 00 ed       	add    $0xed000000,%eax
+  80006a:	a3 20 20 80 00       	mov    %eax,0x802020
+  80006f:	85 db                	test   %ebx,%ebx
+  800071:	7e 07                	jle    80007a <libmain+0x30>
+  800073:	8b 06                	mov    (%esi),%eax
+  800075:	a3 00 20 80 00       	mov    %eax,0x802000
+  80007a:	83 ec 08             	sub    $0x8,%esp
+  80007d:	56                   	push   %esi
+  80007e:	53                   	push   %ebx
+  80007f:	e8 af ff ff ff       	call   800033 <umain>
+  800084:	e8 0a 00 00 00       	call   800093 <exit>
+  800089:	83 c4 10             	add    $0x10,%esp
+  80008c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008f:	5b                   	pop    %ebx
+  800090:	5e                   	pop    %esi
+  800091:	5d                   	pop    %ebp
+  800092:	c3                   	ret
+
+00800093 <exit>:
+  800093:	55                   	push   %ebp
+  800094:	89 e5                	mov    %esp,%ebp
+  800096:	83 ec 08             	sub    $0x8,%esp
+  800099:	e8 20 0a 00 00       	call   800abe <bflush>
+  80009e:	83 ec 0c             	sub    $0xc,%esp
+  8000a1:	6a 00                	push   $0x0
+  8000a3:	e8 d3 00 00 00       	call   80017b <sys_env_destroy>
+  8000a8:	83 c4 10             	add    $0x10,%esp
+  8000ab:	c9                   	leave
+  8000ac:	c3                   	ret
+
+008000ad <sys_cputs>:
+  8000ad:	55                   	push   %ebp
+  8000ae:	89 e5                	mov    %esp,%ebp
+  8000b0:	57                   	push   %edi
+  8000b1:	56                   	push   %esi
+  8000b2:	53                   	push   %ebx
+  8000b3:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000ba:	78 21                	js     8000dd <sys_cputs+0x30>
+  8000bc:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000c3:	75 2d                	jne    8000f2 <sys_cputs+0x45>
+  8000c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000d0:	89 c3                	mov    %eax,%ebx
+  8000d2:	89 c7                	mov    %eax,%edi
+  8000d4:	89 c6                	mov    %eax,%esi
+  8000d6:	cd 30                	int    $0x30
+  8000d8:	5b                   	pop    %ebx
+  8000d9:	5e                   	pop    %esi
+  8000da:	5f                   	pop    %edi
+  8000db:	5d                   	pop    %ebp
+  8000dc:	c3                   	ret
+  8000dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000e2:	0f a2                	cpuid
+  8000e4:	c1 ea 0b             	shr    $0xb,%edx
+  8000e7:	83 e2 01             	and    $0x1,%edx
+  8000ea:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8000f0:	eb ca                	jmp    8000bc <sys_cputs+0xf>
+  8000f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000fd:	89 c3                	mov    %eax,%ebx
+  8000ff:	89 c7                	mov    %eax,%edi
+  800101:	89 c6                	mov    %eax,%esi
+  800103:	55                   	push   %ebp
+  800104:	68 0d 01 80 00       	push   $0x80010d
+  800109:	89 e5                	mov    %esp,%ebp
+  80010b:	0f 34                	sysenter
+  80010d:	83 c4 04             	add    $0x4,%esp
+  800110:	5d                   	pop    %ebp
+  800111:	eb c5                	jmp    8000d8 <sys_cputs+0x2b>
+
+00800113 <sys_cgetc>:
+  800113:	55                   	push   %ebp
+  800114:	89 e5                	mov    %esp,%ebp
+  800116:	57                   	push   %edi
+  800117:	56                   	push   %esi
+  800118:	53                   	push   %ebx
+  800119:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800120:	78 22                	js     800144 <sys_cgetc+0x31>
+  800122:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800129:	75 2e                	jne    800159 <sys_cgetc+0x46>
+  80012b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800130:	b8 01 00 00 00       	mov    $0x1,%eax
+  800135:	89 d1                	mov    %edx,%ecx
+  800137:	89 d3                	mov    %edx,%ebx
+  800139:	89 d7                	mov    %edx,%edi
+  80013b:	89 d6                	mov    %edx,%esi
+  80013d:	cd 30                	int    $0x30
+  80013f:	5b                   	pop    %ebx
+  800140:	5e                   	pop    %esi
+  800141:	5f                   	pop    %edi
+  800142:	5d                   	pop    %ebp
+  800143:	c3                   	ret
+  800144:	b8 01 00 00 00       	mov    $0x1,%eax
+  800149:	0f a2                	cpuid
+  80014b:	c1 ea 0b             	shr    $0xb,%edx
+  80014e:	83 e2 01             	and    $0x1,%edx
+  800151:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800157:	eb c9                	jmp    800122 <sys_cgetc+0xf>
+  800159:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800163:	89 d1                	mov    %edx,%ecx
+  800165:	89 d3                	mov    %edx,%ebx
+  800167:	89 d7                	mov    %edx,%edi
+  800169:	89 d6                	mov    %edx,%esi
+  80016b:	55                   	push   %ebp
+  80016c:	68 75 01 80 00       	push   $0x800175
+  800171:	89 e5                	mov    %esp,%ebp
+  800173:	0f 34                	sysenter
+  800175:	83 c4 04             	add    $0x4,%esp
+  800178:	5d                   	pop    %ebp
+  800179:	eb c4                	jmp    80013f <sys_cgetc+0x2c>
+
+0080017b <sys_env_destroy>:
+  80017b:	55                   	push   %ebp
+  80017c:	89 e5                	mov    %esp,%ebp
+  80017e:	57                   	push   %edi
+  80017f:	56                   	push   %esi
+  800180:	53                   	push   %ebx
+  800181:	83 ec 0c             	sub    $0xc,%esp
+  800184:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80018b:	78 2a                	js     8001b7 <sys_env_destroy+0x3c>
+  80018d:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800194:	75 36                	jne    8001cc <sys_env_destroy+0x51>
+  800196:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80019b:	b8 03 00 00 00       	mov    $0x3,%eax
+  8001a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001a3:	89 cb                	mov    %ecx,%ebx
+  8001a5:	89 cf                	mov    %ecx,%edi
+  8001a7:	89 ce                	mov    %ecx,%esi
+  8001a9:	cd 30                	int    $0x30
+  8001ab:	85 c0                	test   %eax,%eax
+  8001ad:	7f 40                	jg     8001ef <sys_env_destroy+0x74>
+  8001af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001b2:	5b                   	pop    %ebx
+  8001b3:	5e                   	pop    %esi
+  8001b4:	5f                   	pop    %edi
+  8001b5:	5d                   	pop    %ebp
+  8001b6:	c3                   	ret
+  8001b7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001bc:	0f a2                	cpuid
+  8001be:	c1 ea 0b             	shr    $0xb,%edx
+  8001c1:	83 e2 01             	and    $0x1,%edx
+  8001c4:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8001ca:	eb c1                	jmp    80018d <sys_env_destroy+0x12>
+  8001cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001d4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8001d9:	89 cb                	mov    %ecx,%ebx
+  8001db:	89 cf                	mov    %ecx,%edi
+  8001dd:	89 ce                	mov    %ecx,%esi
+  8001df:	55                   	push   %ebp
+  8001e0:	68 e9 01 80 00       	push   $0x8001e9
+  8001e5:	89 e5                	mov    %esp,%ebp
+  8001e7:	0f 34                	sysenter
+  8001e9:	83 c4 04             	add    $0x4,%esp
+  8001ec:	5d                   	pop    %ebp
+  8001ed:	eb bc                	jmp    8001ab <sys_env_destroy+0x30>
+  8001ef:	83 ec 0c             	sub    $0xc,%esp
+  8001f2:	50                   	push   %eax
+  8001f3:	6a 03                	push   $0x3
+  8001f5:	68 8f 19 80 00       	push   $0x80198f
+  8001fa:	6a 49                	push   $0x49
+  8001fc:	68 ac 19 80 00       	push   $0x8019ac
+  800201:	e8 af 09 00 00       	call   800bb5 <_panic>
+
+00800206 <sys_getenvid>:
+  800206:	55                   	push   %ebp
+  800207:	89 e5                	mov    %esp,%ebp
+  800209:	57                   	push   %edi
+  80020a:	56                   	push   %esi
+  80020b:	53                   	push   %ebx
+  80020c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800213:	78 22                	js     800237 <sys_getenvid+0x31>
+  800215:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80021c:	75 2e                	jne    80024c <sys_getenvid+0x46>
+  80021e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800223:	b8 02 00 00 00       	mov    $0x2,%eax
+  800228:	89 d1                	mov    %edx,%ecx
+  80022a:	89 d3                	mov    %edx,%ebx
+  80022c:	89 d7                	mov    %edx,%edi
+  80022e:	89 d6                	mov    %edx,%esi
+  800230:	cd 30                	int    $0x30
+  800232:	5b                   	pop    %ebx
+  800233:	5e                   	pop    %esi
+  800234:	5f                   	pop    %edi
+  800235:	5d                   	pop    %ebp
+  800236:	c3                   	ret
+  800237:	b8 01 00 00 00       	mov    $0x1,%eax
+  80023c:	0f a2                	cpuid
+  80023e:	c1 ea 0b             	shr    $0xb,%edx
+  800241:	83 e2 01             	and    $0x1,%edx
+  800244:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80024a:	eb c9                	jmp    800215 <sys_getenvid+0xf>
+  80024c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800251:	b8 02 00 00 00       	mov    $0x2,%eax
+  800256:	89 d1                	mov    %edx,%ecx
+  800258:	89 d3                	mov    %edx,%ebx
+  80025a:	89 d7                	mov    %edx,%edi
+  80025c:	89 d6                	mov    %edx,%esi
+  80025e:	55                   	push   %ebp
+  80025f:	68 68 02 80 00       	push   $0x800268
+  800264:	89 e5                	mov    %esp,%ebp
+  800266:	0f 34                	sysenter
+  800268:	83 c4 04             	add    $0x4,%esp
+  80026b:	5d                   	pop    %ebp
+  80026c:	eb c4                	jmp    800232 <sys_getenvid+0x2c>
+
+0080026e <sys_yield>:
+  80026e:	55                   	push   %ebp
+  80026f:	89 e5                	mov    %esp,%ebp
+  800271:	57                   	push   %edi
+  800272:	56                   	push   %esi
+  800273:	53                   	push   %ebx
+  800274:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80027b:	78 22                	js     80029f <sys_yield+0x31>
+  80027d:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800284:	75 2e                	jne    8002b4 <sys_yield+0x46>
+  800286:	ba 00 00 00 00       	mov    $0x0,%edx
+  80028b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800290:	89 d1                	mov    %edx,%ecx
+  800292:	89 d3                	mov    %edx,%ebx
+  800294:	89 d7                	mov    %edx,%edi
+  800296:	89 d6                	mov    %edx,%esi
+  800298:	cd 30                	int    $0x30
+  80029a:	5b                   	pop    %ebx
+  80029b:	5e                   	pop    %esi
+  80029c:	5f                   	pop    %edi
+  80029d:	5d                   	pop    %ebp
+  80029e:	c3                   	ret
+  80029f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8002a4:	0f a2                	cpuid
+  8002a6:	c1 ea 0b             	shr    $0xb,%edx
+  8002a9:	83 e2 01             	and    $0x1,%edx
+  8002ac:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8002b2:	eb c9                	jmp    80027d <sys_yield+0xf>
+  8002b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002be:	89 d1                	mov    %edx,%ecx
+  8002c0:	89 d3                	mov    %edx,%ebx
+  8002c2:	89 d7                	mov    %edx,%edi
+  8002c4:	89 d6                	mov    %edx,%esi
+  8002c6:	55                   	push   %ebp
+  8002c7:	68 d0 02 80 00       	push   $0x8002d0
+  8002cc:	89 e5                	mov    %esp,%ebp
+  8002ce:	0f 34                	sysenter
+  8002d0:	83 c4 04             	add    $0x4,%esp
+  8002d3:	5d                   	pop    %ebp
+  8002d4:	eb c4                	jmp    80029a <sys_yield+0x2c>
+
+008002d6 <sys_env_set_cow>:
+  8002d6:	55                   	push   %ebp
+  8002d7:	89 e5                	mov    %esp,%ebp
+  8002d9:	57                   	push   %edi
+  8002da:	56                   	push   %esi
+  8002db:	53                   	push   %ebx
+  8002dc:	83 ec 0c             	sub    $0xc,%esp
+  8002df:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8002e6:	78 2b                	js     800313 <sys_env_set_cow+0x3d>
+  8002e8:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8002ef:	75 37                	jne    800328 <sys_env_set_cow+0x52>
+  8002f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002f6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8002fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800301:	89 df                	mov    %ebx,%edi
+  800303:	89 de                	mov    %ebx,%esi
+  800305:	cd 30                	int    $0x30
+  800307:	85 c0                	test   %eax,%eax
+  800309:	7f 41                	jg     80034c <sys_env_set_cow+0x76>
+  80030b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030e:	5b                   	pop    %ebx
+  80030f:	5e                   	pop    %esi
+  800310:	5f                   	pop    %edi
+  800311:	5d                   	pop    %ebp
+  800312:	c3                   	ret
+  800313:	b8 01 00 00 00       	mov    $0x1,%eax
+  800318:	0f a2                	cpuid
+  80031a:	c1 ea 0b             	shr    $0xb,%edx
+  80031d:	83 e2 01             	and    $0x1,%edx
+  800320:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800326:	eb c0                	jmp    8002e8 <sys_env_set_cow+0x12>
+  800328:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80032d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800330:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800333:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800338:	89 df                	mov    %ebx,%edi
+  80033a:	89 de                	mov    %ebx,%esi
+  80033c:	55                   	push   %ebp
+  80033d:	68 46 03 80 00       	push   $0x800346
+  800342:	89 e5                	mov    %esp,%ebp
+  800344:	0f 34                	sysenter
+  800346:	83 c4 04             	add    $0x4,%esp
+  800349:	5d                   	pop    %ebp
+  80034a:	eb bb                	jmp    800307 <sys_env_set_cow+0x31>
+  80034c:	83 ec 0c             	sub    $0xc,%esp
+  80034f:	50                   	push   %eax
+  800350:	6a 0d                	push   $0xd
+  800352:	68 8f 19 80 00       	push   $0x80198f
+  800357:	6a 49                	push   $0x49
+  800359:	68 ac 19 80 00       	push   $0x8019ac
+  80035e:	e8 52 08 00 00       	call   800bb5 <_panic>
+
+00800363 <sys_env_set_quota>:
+  800363:	55                   	push   %ebp
+  800364:	89 e5                	mov    %esp,%ebp
+  800366:	57                   	push   %edi
+  800367:	56                   	push   %esi
+  800368:	53                   	push   %ebx
+  800369:	83 ec 0c             	sub    $0xc,%esp
+  80036c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800373:	78 2b                	js     8003a0 <sys_env_set_quota+0x3d>
+  800375:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80037c:	75 37                	jne    8003b5 <sys_env_set_quota+0x52>
+  80037e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800383:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800388:	8b 55 08             	mov    0x8(%ebp),%edx
+  80038b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80038e:	89 df                	mov    %ebx,%edi
+  800390:	89 de                	mov    %ebx,%esi
+  800392:	cd 30                	int    $0x30
+  800394:	85 c0                	test   %eax,%eax
+  800396:	7f 41                	jg     8003d9 <sys_env_set_quota+0x76>
+  800398:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80039b:	5b                   	pop    %ebx
+  80039c:	5e                   	pop    %esi
+  80039d:	5f                   	pop    %edi
+  80039e:	5d                   	pop    %ebp
+  80039f:	c3                   	ret
+  8003a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003a5:	0f a2                	cpuid
+  8003a7:	c1 ea 0b             	shr    $0xb,%edx
+  8003aa:	83 e2 01             	and    $0x1,%edx
+  8003ad:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8003b3:	eb c0                	jmp    800375 <sys_env_set_quota+0x12>
+  8003b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003c5:	89 df                	mov    %ebx,%edi
+  8003c7:	89 de                	mov    %ebx,%esi
+  8003c9:	55                   	push   %ebp
+  8003ca:	68 d3 03 80 00       	push   $0x8003d3
+  8003cf:	89 e5                	mov    %esp,%ebp
+  8003d1:	0f 34                	sysenter
+  8003d3:	83 c4 04             	add    $0x4,%esp
+  8003d6:	5d                   	pop    %ebp
+  8003d7:	eb bb                	jmp    800394 <sys_env_set_quota+0x31>
+  8003d9:	83 ec 0c             	sub    $0xc,%esp
+  8003dc:	50                   	push   %eax
+  8003dd:	6a 0f                	push   $0xf
+  8003df:	68 8f 19 80 00       	push   $0x80198f
+  8003e4:	6a 49                	push   $0x49
+  8003e6:	68 ac 19 80 00       	push   $0x8019ac
+  8003eb:	e8 c5 07 00 00       	call   800bb5 <_panic>
+
+008003f0 <sys_page_alloc>:
+  8003f0:	55                   	push   %ebp
+  8003f1:	89 e5                	mov    %esp,%ebp
+  8003f3:	57                   	push   %edi
+  8003f4:	56                   	push   %esi
+  8003f5:	53                   	push   %ebx
+  8003f6:	83 ec 0c             	sub    $0xc,%esp
+  8003f9:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800400:	78 2c                	js     80042e <sys_page_alloc+0x3e>
+  800402:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800409:	75 38                	jne    800443 <sys_page_alloc+0x53>
+  80040b:	be 00 00 00 00       	mov    $0x0,%esi
+  800410:	b8 04 00 00 00       	mov    $0x4,%eax
+  800415:	8b 55 08             	mov    0x8(%ebp),%edx
+  800418:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80041b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80041e:	89 f7                	mov    %esi,%edi
+  800420:	cd 30                	int    $0x30
+  800422:	85 c0                	test   %eax,%eax
+  800424:	7f 42                	jg     800468 <sys_page_alloc+0x78>
+  800426:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800429:	5b                   	pop    %ebx
+  80042a:	5e                   	pop    %esi
+  80042b:	5f                   	pop    %edi
+  80042c:	5d                   	pop    %ebp
+  80042d:	c3                   	ret
+  80042e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800433:	0f a2                	cpuid
+  800435:	c1 ea 0b             	shr    $0xb,%edx
+  800438:	83 e2 01             	and    $0x1,%edx
+  80043b:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800441:	eb bf                	jmp    800402 <sys_page_alloc+0x12>
+  800443:	be 00 00 00 00       	mov    $0x0,%esi
+  800448:	8b 55 08             	mov    0x8(%ebp),%edx
+  80044b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80044e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800453:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800456:	89 f7                	mov    %esi,%edi
+  800458:	55                   	push   %ebp
+  800459:	68 62 04 80 00       	push   $0x800462
+  80045e:	89 e5                	mov    %esp,%ebp
+  800460:	0f 34                	sysenter
+  800462:	83 c4 04             	add    $0x4,%esp
+  800465:	5d                   	pop    %ebp
+  800466:	eb ba                	jmp    800422 <sys_page_alloc+0x32>
+  800468:	83 ec 0c             	sub    $0xc,%esp
+  80046b:	50                   	push   %eax
+  80046c:	6a 04                	push   $0x4
+  80046e:	68 8f 19 80 00       	push   $0x80198f
+  800473:	6a 49                	push   $0x49
+  800475:	68 ac 19 80 00       	push   $0x8019ac
+  80047a:	e8 36 07 00 00       	call   800bb5 <_panic>
+
+0080047f <sys_page_map>:
+  80047f:	55                   	push   %ebp
+  800480:	89 e5                	mov    %esp,%ebp
+  800482:	57                   	push   %edi
+  800483:	56                   	push   %esi
+  800484:	53                   	push   %ebx
+  800485:	83 ec 0c             	sub    $0xc,%esp
+  800488:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80048f:	78 2b                	js     8004bc <sys_page_map+0x3d>
+  800491:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800498:	75 37                	jne    8004d1 <sys_page_map+0x52>
+  80049a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80049f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004a8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004ab:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004ae:	cd 30                	int    $0x30
+  8004b0:	85 c0                	test   %eax,%eax
+  8004b2:	7f 41                	jg     8004f5 <sys_page_map+0x76>
+  8004b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b7:	5b                   	pop    %ebx
+  8004b8:	5e                   	pop    %esi
+  8004b9:	5f                   	pop    %edi
+  8004ba:	5d                   	pop    %ebp
+  8004bb:	c3                   	ret
+  8004bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004c1:	0f a2                	cpuid
+  8004c3:	c1 ea 0b             	shr    $0xb,%edx
+  8004c6:	83 e2 01             	and    $0x1,%edx
+  8004c9:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8004cf:	eb c0                	jmp    800491 <sys_page_map+0x12>
+  8004d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004d7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8004dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004df:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004e2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004e5:	55                   	push   %ebp
+  8004e6:	68 ef 04 80 00       	push   $0x8004ef
+  8004eb:	89 e5                	mov    %esp,%ebp
+  8004ed:	0f 34                	sysenter
+  8004ef:	83 c4 04             	add    $0x4,%esp
+  8004f2:	5d                   	pop    %ebp
+  8004f3:	eb bb                	jmp    8004b0 <sys_page_map+0x31>
+  8004f5:	83 ec 0c             	sub    $0xc,%esp
+  8004f8:	50                   	push   %eax
+  8004f9:	6a 05                	push   $0x5
+  8004fb:	68 8f 19 80 00       	push   $0x80198f
+  800500:	6a 49                	push   $0x49
+  800502:	68 ac 19 80 00       	push   $0x8019ac
+  800507:	e8 a9 06 00 00       	call   800bb5 <_panic>
+
+0080050c <sys_page_unmap>:
+  80050c:	55                   	push   %ebp
+  80050d:	89 e5                	mov    %esp,%ebp
+  80050f:	57                   	push   %edi
+  800510:	56                   	push   %esi
+  800511:	53                   	push   %ebx
+  800512:	83 ec 0c             	sub    $0xc,%esp
+  800515:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80051c:	78 2b                	js     800549 <sys_page_unmap+0x3d>
+  80051e:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800525:	75 37                	jne    80055e <sys_page_unmap+0x52>
+  800527:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80052c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800531:	8b 55 08             	mov    0x8(%ebp),%edx
+  800534:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800537:	89 df                	mov    %ebx,%edi
+  800539:	89 de                	mov    %ebx,%esi
+  80053b:	cd 30                	int    $0x30
+  80053d:	85 c0                	test   %eax,%eax
+  80053f:	7f 41                	jg     800582 <sys_page_unmap+0x76>
+  800541:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800544:	5b                   	pop    %ebx
+  800545:	5e                   	pop    %esi
+  800546:	5f                   	pop    %edi
+  800547:	5d                   	pop    %ebp
+  800548:	c3                   	ret
+  800549:	b8 01 00 00 00       	mov    $0x1,%eax
+  80054e:	0f a2                	cpuid
+  800550:	c1 ea 0b             	shr    $0xb,%edx
+  800553:	83 e2 01             	and    $0x1,%edx
+  800556:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80055c:	eb c0                	jmp    80051e <sys_page_unmap+0x12>
+  80055e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800563:	8b 55 08             	mov    0x8(%ebp),%edx
+  800566:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800569:	b8 06 00 00 00       	mov    $0x6,%eax
+  80056e:	89 df                	mov    %ebx,%edi
+  800570:	89 de                	mov    %ebx,%esi
+  800572:	55                   	push   %ebp
+  800573:	68 7c 05 80 00       	push   $0x80057c
+  800578:	89 e5                	mov    %esp,%ebp
+  80057a:	0f 34                	sysenter
+  80057c:	83 c4 04             	add    $0x4,%esp
+  80057f:	5d                   	pop    %ebp
+  800580:	eb bb                	jmp    80053d <sys_page_unmap+0x31>
+  800582:	83 ec 0c             	sub    $0xc,%esp
+  800585:	50                   	push   %eax
+  800586:	6a 06                	push   $0x6
+  800588:	68 8f 19 80 00       	push   $0x80198f
+  80058d:	6a 49                	push   $0x49
+  80058f:	68 ac 19 80 00       	push   $0x8019ac
+  800594:	e8 1c 06 00 00       	call   800bb5 <_panic>
+
+00800599 <sys_page_reuse>:
+  800599:	55                   	push   %ebp
+  80059a:	89 e5                	mov    %esp,%ebp
+  80059c:	57                   	push   %edi
+  80059d:	56                   	push   %esi
+  80059e:	53                   	push   %ebx
+  80059f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8005a6:	78 24                	js     8005cc <sys_page_reuse+0x33>
+  8005a8:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8005af:	75 30                	jne    8005e1 <sys_page_reuse+0x48>
+  8005b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005b6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005c1:	89 df                	mov    %ebx,%edi
+  8005c3:	89 de                	mov    %ebx,%esi
+  8005c5:	cd 30                	int    $0x30
+  8005c7:	5b                   	pop    %ebx
+  8005c8:	5e                   	pop    %esi
+  8005c9:	5f                   	pop    %edi
+  8005ca:	5d                   	pop    %ebp
+  8005cb:	c3                   	ret
+  8005cc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005d1:	0f a2                	cpuid
+  8005d3:	c1 ea 0b             	shr    $0xb,%edx
+  8005d6:	83 e2 01             	and    $0x1,%edx
+  8005d9:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8005df:	eb c7                	jmp    8005a8 <sys_page_reuse+0xf>
+  8005e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005ec:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005f1:	89 df                	mov    %ebx,%edi
+  8005f3:	89 de                	mov    %ebx,%esi
+  8005f5:	55                   	push   %ebp
+  8005f6:	68 ff 05 80 00       	push   $0x8005ff
+  8005fb:	89 e5                	mov    %esp,%ebp
+  8005fd:	0f 34                	sysenter
+  8005ff:	83 c4 04             	add    $0x4,%esp
+  800602:	5d                   	pop    %ebp
+  800603:	eb c2                	jmp    8005c7 <sys_page_reuse+0x2e>
+
+00800605 <sys_env_set_status>:
+  800605:	55                   	push   %ebp
+  800606:	89 e5                	mov    %esp,%ebp
+  800608:	57                   	push   %edi
+  800609:	56                   	push   %esi
+  80060a:	53                   	push   %ebx
+  80060b:	83 ec 0c             	sub    $0xc,%esp
+  80060e:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800615:	78 2b                	js     800642 <sys_env_set_status+0x3d>
+  800617:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80061e:	75 37                	jne    800657 <sys_env_set_status+0x52>
+  800620:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800625:	b8 08 00 00 00       	mov    $0x8,%eax
+  80062a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80062d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800630:	89 df                	mov    %ebx,%edi
+  800632:	89 de                	mov    %ebx,%esi
+  800634:	cd 30                	int    $0x30
+  800636:	85 c0                	test   %eax,%eax
+  800638:	7f 41                	jg     80067b <sys_env_set_status+0x76>
+  80063a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80063d:	5b                   	pop    %ebx
+  80063e:	5e                   	pop    %esi
+  80063f:	5f                   	pop    %edi
+  800640:	5d                   	pop    %ebp
+  800641:	c3                   	ret
+  800642:	b8 01 00 00 00       	mov    $0x1,%eax
+  800647:	0f a2                	cpuid
+  800649:	c1 ea 0b             	shr    $0xb,%edx
+  80064c:	83 e2 01             	and    $0x1,%edx
+  80064f:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800655:	eb c0                	jmp    800617 <sys_env_set_status+0x12>
+  800657:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80065c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80065f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800662:	b8 08 00 00 00       	mov    $0x8,%eax
+  800667:	89 df                	mov    %ebx,%edi
+  800669:	89 de                	mov    %ebx,%esi
+  80066b:	55                   	push   %ebp
+  80066c:	68 75 06 80 00       	push   $0x800675
+  800671:	89 e5                	mov    %esp,%ebp
+  800673:	0f 34                	sysenter
+  800675:	83 c4 04             	add    $0x4,%esp
+  800678:	5d                   	pop    %ebp
+  800679:	eb bb                	jmp    800636 <sys_env_set_status+0x31>
+  80067b:	83 ec 0c             	sub    $0xc,%esp
+  80067e:	50                   	push   %eax
+  80067f:	6a 08                	push   $0x8
+  800681:	68 8f 19 80 00       	push   $0x80198f
+  800686:	6a 49                	push   $0x49
+  800688:	68 ac 19 80 00       	push   $0x8019ac
+  80068d:	e8 23 05 00 00       	call   800bb5 <_panic>
+
+00800692 <sys_env_set_pgfault_upcall>:
+  800692:	55                   	push   %ebp
+  800693:	89 e5                	mov    %esp,%ebp
+  800695:	57                   	push   %edi
+  800696:	56                   	push   %esi
+  800697:	53                   	push   %ebx
+  800698:	83 ec 0c             	sub    $0xc,%esp
+  80069b:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8006a2:	78 2b                	js     8006cf <sys_env_set_pgfault_upcall+0x3d>
+  8006a4:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8006ab:	75 37                	jne    8006e4 <sys_env_set_pgfault_upcall+0x52>
+  8006ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006b2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006bd:	89 df                	mov    %ebx,%edi
+  8006bf:	89 de                	mov    %ebx,%esi
+  8006c1:	cd 30                	int    $0x30
+  8006c3:	85 c0                	test   %eax,%eax
+  8006c5:	7f 41                	jg     800708 <sys_env_set_pgfault_upcall+0x76>
+  8006c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006ca:	5b                   	pop    %ebx
+  8006cb:	5e                   	pop    %esi
+  8006cc:	5f                   	pop    %edi
+  8006cd:	5d                   	pop    %ebp
+  8006ce:	c3                   	ret
+  8006cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006d4:	0f a2                	cpuid
+  8006d6:	c1 ea 0b             	shr    $0xb,%edx
+  8006d9:	83 e2 01             	and    $0x1,%edx
+  8006dc:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8006e2:	eb c0                	jmp    8006a4 <sys_env_set_pgfault_upcall+0x12>
+  8006e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006ef:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006f4:	89 df                	mov    %ebx,%edi
+  8006f6:	89 de                	mov    %ebx,%esi
+  8006f8:	55                   	push   %ebp
+  8006f9:	68 02 07 80 00       	push   $0x800702
+  8006fe:	89 e5                	mov    %esp,%ebp
+  800700:	0f 34                	sysenter
+  800702:	83 c4 04             	add    $0x4,%esp
+  800705:	5d                   	pop    %ebp
+  800706:	eb bb                	jmp    8006c3 <sys_env_set_pgfault_upcall+0x31>
+  800708:	83 ec 0c             	sub    $0xc,%esp
+  80070b:	50                   	push   %eax
+  80070c:	6a 09                	push   $0x9
+  80070e:	68 8f 19 80 00       	push   $0x80198f
+  800713:	6a 49                	push   $0x49
+  800715:	68 ac 19 80 00       	push   $0x8019ac
+  80071a:	e8 96 04 00 00       	call   800bb5 <_panic>
+
+0080071f <sys_env_set_trace>:
+  80071f:	55                   	push   %ebp
+  800720:	89 e5                	mov    %esp,%ebp
+  800722:	57                   	push   %edi
+  800723:	56                   	push   %esi
+  800724:	53                   	push   %ebx
+  800725:	83 ec 0c             	sub    $0xc,%esp
+  800728:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80072f:	78 2b                	js     80075c <sys_env_set_trace+0x3d>
+  800731:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800738:	75 37                	jne    800771 <sys_env_set_trace+0x52>
+  80073a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80073f:	b8 12 00 00 00       	mov    $0x12,%eax
+  800744:	8b 55 08             	mov    0x8(%ebp),%edx
+  800747:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80074a:	89 df                	mov    %ebx,%edi
+  80074c:	89 de                	mov    %ebx,%esi
+  80074e:	cd 30                	int    $0x30
+  800750:	85 c0                	test   %eax,%eax
+  800752:	7f 41                	jg     800795 <sys_env_set_trace+0x76>
+  800754:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800757:	5b                   	pop    %ebx
+  800758:	5e                   	pop    %esi
+  800759:	5f                   	pop    %edi
+  80075a:	5d                   	pop    %ebp
+  80075b:	c3                   	ret
+  80075c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800761:	0f a2                	cpuid
+  800763:	c1 ea 0b             	shr    $0xb,%edx
+  800766:	83 e2 01             	and    $0x1,%edx
+  800769:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80076f:	eb c0                	jmp    800731 <sys_env_set_trace+0x12>
+  800771:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800776:	8b 55 08             	mov    0x8(%ebp),%edx
+  800779:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80077c:	b8 12 00 00 00       	mov    $0x12,%eax
+  800781:	89 df                	mov    %ebx,%edi
+  800783:	89 de                	mov    %ebx,%esi
+  800785:	55                   	push   %ebp
+  800786:	68 8f 07 80 00       	push   $0x80078f
+  80078b:	89 e5                	mov    %esp,%ebp
+  80078d:	0f 34                	sysenter
+  80078f:	83 c4 04             	add    $0x4,%esp
+  800792:	5d                   	pop    %ebp
+  800793:	eb bb                	jmp    800750 <sys_env_set_trace+0x31>
+  800795:	83 ec 0c             	sub    $0xc,%esp
+  800798:	50                   	push   %eax
+  800799:	6a 12                	push   $0x12
+  80079b:	68 8f 19 80 00       	push   $0x80198f
+  8007a0:	6a 49                	push   $0x49
+  8007a2:	68 ac 19 80 00       	push   $0x8019ac
+  8007a7:	e8 09 04 00 00       	call   800bb5 <_panic>
+
+008007ac <sys_env_set_rdpmc>:
+  8007ac:	55                   	push   %ebp
+  8007ad:	89 e5                	mov    %esp,%ebp
+  8007af:	57                   	push   %edi
+  8007b0:	56                   	push   %esi
+  8007b1:	53                   	push   %ebx
+  8007b2:	83 ec 0c             	sub    $0xc,%esp
+  8007b5:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007bc:	78 2b                	js     8007e9 <sys_env_set_rdpmc+0x3d>
+  8007be:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007c5:	75 37                	jne    8007fe <sys_env_set_rdpmc+0x52>
+  8007c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007cc:	b8 13 00 00 00       	mov    $0x13,%eax
+  8007d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007d7:	89 df                	mov    %ebx,%edi
+  8007d9:	89 de                	mov    %ebx,%esi
+  8007db:	cd 30                	int    $0x30
+  8007dd:	85 c0                	test   %eax,%eax
+  8007df:	7f 41                	jg     800822 <sys_env_set_rdpmc+0x76>
+  8007e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e4:	5b                   	pop    %ebx
+  8007e5:	5e                   	pop    %esi
+  8007e6:	5f                   	pop    %edi
+  8007e7:	5d                   	pop    %ebp
+  8007e8:	c3                   	ret
+  8007e9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007ee:	0f a2                	cpuid
+  8007f0:	c1 ea 0b             	shr    $0xb,%edx
+  8007f3:	83 e2 01             	and    $0x1,%edx
+  8007f6:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8007fc:	eb c0                	jmp    8007be <sys_env_set_rdpmc+0x12>
+  8007fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800803:	8b 55 08             	mov    0x8(%ebp),%edx
+  800806:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800809:	b8 13 00 00 00       	mov    $0x13,%eax
+  80080e:	89 df                	mov    %ebx,%edi
+  800810:	89 de                	mov    %ebx,%esi
+  800812:	55                   	push   %ebp
+  800813:	68 1c 08 80 00       	push   $0x80081c
+  800818:	89 e5                	mov    %esp,%ebp
+  80081a:	0f 34                	sysenter
+  80081c:	83 c4 04             	add    $0x4,%esp
+  80081f:	5d                   	pop    %ebp
+  800820:	eb bb                	jmp    8007dd <sys_env_set_rdpmc+0x31>
+  800822:	83 ec 0c             	sub    $0xc,%esp
+  800825:	50                   	push   %eax
+  800826:	6a 13                	push   $0x13
+  800828:	68 8f 19 80 00       	push   $0x80198f
+  80082d:	6a 49                	push   $0x49
+  80082f:	68 ac 19 80 00       	push   $0x8019ac
+  800834:	e8 7c 03 00 00       	call   800bb5 <_panic>
+
+00800839 <sys_ring_setup>:
+  800839:	55                   	push   %ebp
+  80083a:	89 e5                	mov    %esp,%ebp
+  80083c:	57                   	push   %edi
+  80083d:	56                   	push   %esi
+  80083e:	53                   	push   %ebx
+  80083f:	83 ec 0c             	sub    $0xc,%esp
+  800842:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800849:	78 29                	js     800874 <sys_ring_setup+0x3b>
+  80084b:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800852:	75 35                	jne    800889 <sys_ring_setup+0x50>
+  800854:	ba 00 00 00 00       	mov    $0x0,%edx
+  800859:	b8 10 00 00 00       	mov    $0x10,%eax
+  80085e:	89 d1                	mov    %edx,%ecx
+  800860:	89 d3                	mov    %edx,%ebx
+  800862:	89 d7                	mov    %edx,%edi
+  800864:	89 d6                	mov    %edx,%esi
+  800866:	cd 30                	int    $0x30
+  800868:	85 c0                	test   %eax,%eax
+  80086a:	7f 3f                	jg     8008ab <sys_ring_setup+0x72>
+  80086c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80086f:	5b                   	pop    %ebx
+  800870:	5e                   	pop    %esi
+  800871:	5f                   	pop    %edi
+  800872:	5d                   	pop    %ebp
+  800873:	c3                   	ret
+  800874:	b8 01 00 00 00       	mov    $0x1,%eax
+  800879:	0f a2                	cpuid
+  80087b:	c1 ea 0b             	shr    $0xb,%edx
+  80087e:	83 e2 01             	and    $0x1,%edx
+  800881:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800887:	eb c2                	jmp    80084b <sys_ring_setup+0x12>
+  800889:	ba 00 00 00 00       	mov    $0x0,%edx
+  80088e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800893:	89 d1                	mov    %edx,%ecx
+  800895:	89 d3                	mov    %edx,%ebx
+  800897:	89 d7                	mov    %edx,%edi
+  800899:	89 d6                	mov    %edx,%esi
+  80089b:	55                   	push   %ebp
+  80089c:	68 a5 08 80 00       	push   $0x8008a5
+  8008a1:	89 e5                	mov    %esp,%ebp
+  8008a3:	0f 34                	sysenter
+  8008a5:	83 c4 04             	add    $0x4,%esp
+  8008a8:	5d                   	pop    %ebp
+  8008a9:	eb bd                	jmp    800868 <sys_ring_setup+0x2f>
+  8008ab:	83 ec 0c             	sub    $0xc,%esp
+  8008ae:	50                   	push   %eax
+  8008af:	6a 10                	push   $0x10
+  8008b1:	68 8f 19 80 00       	push   $0x80198f
+  8008b6:	6a 49                	push   $0x49
+  8008b8:	68 ac 19 80 00       	push   $0x8019ac
+  8008bd:	e8 f3 02 00 00       	call   800bb5 <_panic>
+
+008008c2 <sys_ring_enter>:
+  8008c2:	55                   	push   %ebp
+  8008c3:	89 e5                	mov    %esp,%ebp
+  8008c5:	57                   	push   %edi
+  8008c6:	56                   	push   %esi
+  8008c7:	53                   	push   %ebx
+  8008c8:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008cf:	78 22                	js     8008f3 <sys_ring_enter+0x31>
+  8008d1:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008d8:	75 2e                	jne    800908 <sys_ring_enter+0x46>
+  8008da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008df:	b8 11 00 00 00       	mov    $0x11,%eax
+  8008e4:	89 d1                	mov    %edx,%ecx
+  8008e6:	89 d3                	mov    %edx,%ebx
+  8008e8:	89 d7                	mov    %edx,%edi
+  8008ea:	89 d6                	mov    %edx,%esi
+  8008ec:	cd 30                	int    $0x30
+  8008ee:	5b                   	pop    %ebx
+  8008ef:	5e                   	pop    %esi
+  8008f0:	5f                   	pop    %edi
+  8008f1:	5d                   	pop    %ebp
+  8008f2:	c3                   	ret
+  8008f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008f8:	0f a2                	cpuid
+  8008fa:	c1 ea 0b             	shr    $0xb,%edx
+  8008fd:	83 e2 01             	and    $0x1,%edx
+  800900:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800906:	eb c9                	jmp    8008d1 <sys_ring_enter+0xf>
+  800908:	ba 00 00 00 00       	mov    $0x0,%edx
+  80090d:	b8 11 00 00 00       	mov    $0x11,%eax
+  800912:	89 d1                	mov    %edx,%ecx
+  800914:	89 d3                	mov    %edx,%ebx
+  800916:	89 d7                	mov    %edx,%edi
+  800918:	89 d6                	mov    %edx,%esi
+  80091a:	55                   	push   %ebp
+  80091b:	68 24 09 80 00       	push   $0x800924
+  800920:	89 e5                	mov    %esp,%ebp
+  800922:	0f 34                	sysenter
+  800924:	83 c4 04             	add    $0x4,%esp
+  800927:	5d                   	pop    %ebp
+  800928:	eb c4                	jmp    8008ee <sys_ring_enter+0x2c>
+
+0080092a <sys_ipc_try_send>:
+  80092a:	55                   	push   %ebp
+  80092b:	89 e5                	mov    %esp,%ebp
+  80092d:	57                   	push   %edi
+  80092e:	56                   	push   %esi
+  80092f:	53                   	push   %ebx
+  800930:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800937:	78 26                	js     80095f <sys_ipc_try_send+0x35>
+  800939:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800940:	75 32                	jne    800974 <sys_ipc_try_send+0x4a>
+  800942:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800947:	be 00 00 00 00       	mov    $0x0,%esi
+  80094c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80094f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800952:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800955:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800958:	cd 30                	int    $0x30
+  80095a:	5b                   	pop    %ebx
+  80095b:	5e                   	pop    %esi
+  80095c:	5f                   	pop    %edi
+  80095d:	5d                   	pop    %ebp
+  80095e:	c3                   	ret
+  80095f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800964:	0f a2                	cpuid
+  800966:	c1 ea 0b             	shr    $0xb,%edx
+  800969:	83 e2 01             	and    $0x1,%edx
+  80096c:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800972:	eb c5                	jmp    800939 <sys_ipc_try_send+0xf>
+  800974:	8b 55 08             	mov    0x8(%ebp),%edx
+  800977:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80097a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80097f:	be 00 00 00 00       	mov    $0x0,%esi
+  800984:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800987:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80098a:	55                   	push   %ebp
+  80098b:	68 94 09 80 00       	push   $0x800994
+  800990:	89 e5                	mov    %esp,%ebp
+  800992:	0f 34                	sysenter
+  800994:	83 c4 04             	add    $0x4,%esp
+  800997:	5d                   	pop    %ebp
+  800998:	eb c0                	jmp    80095a <sys_ipc_try_send+0x30>
+
+0080099a <sys_ipc_recv>:
+  80099a:	55                   	push   %ebp
+  80099b:	89 e5                	mov    %esp,%ebp
+  80099d:	57                   	push   %edi
+  80099e:	56                   	push   %esi
+  80099f:	53                   	push   %ebx
+  8009a0:	83 ec 0c             	sub    $0xc,%esp
+  8009a3:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8009aa:	78 2a                	js     8009d6 <sys_ipc_recv+0x3c>
+  8009ac:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8009b3:	75 36                	jne    8009eb <sys_ipc_recv+0x51>
+  8009b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ba:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009c2:	89 cb                	mov    %ecx,%ebx
+  8009c4:	89 cf                	mov    %ecx,%edi
+  8009c6:	89 ce                	mov    %ecx,%esi
+  8009c8:	cd 30                	int    $0x30
+  8009ca:	85 c0                	test   %eax,%eax
+  8009cc:	7f 40                	jg     800a0e <sys_ipc_recv+0x74>
+  8009ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009d1:	5b                   	pop    %ebx
+  8009d2:	5e                   	pop    %esi
+  8009d3:	5f                   	pop    %edi
+  8009d4:	5d                   	pop    %ebp
+  8009d5:	c3                   	ret
+  8009d6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8009db:	0f a2                	cpuid
+  8009dd:	c1 ea 0b             	shr    $0xb,%edx
+  8009e0:	83 e2 01             	and    $0x1,%edx
+  8009e3:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8009e9:	eb c1                	jmp    8009ac <sys_ipc_recv+0x12>
+  8009eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009f8:	89 cb                	mov    %ecx,%ebx
+  8009fa:	89 cf                	mov    %ecx,%edi
+  8009fc:	89 ce                	mov    %ecx,%esi
+  8009fe:	55                   	push   %ebp
+  8009ff:	68 08 0a 80 00       	push   $0x800a08
+  800a04:	89 e5                	mov    %esp,%ebp
+  800a06:	0f 34                	sysenter
+  800a08:	83 c4 04             	add    $0x4,%esp
+  800a0b:	5d                   	pop    %ebp
+  800a0c:	eb bc                	jmp    8009ca <sys_ipc_recv+0x30>
+  800a0e:	83 ec 0c             	sub    $0xc,%esp
+  800a11:	50                   	push   %eax
+  800a12:	6a 0c                	push   $0xc
+  800a14:	68 8f 19 80 00       	push   $0x80198f
+  800a19:	6a 49                	push   $0x49
+  800a1b:	68 ac 19 80 00       	push   $0x8019ac
+  800a20:	e8 90 01 00 00       	call   800bb5 <_panic>
+
+00800a25 <uinfo_envid>:
+  800a25:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  800a2a:	c3                   	ret
+
+00800a2b <uinfo_cpunum>:
+  800a2b:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  800a30:	c3                   	ret
+
+00800a31 <uinfo_ticks>:
+  800a31:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  800a36:	c3                   	ret
+
+00800a37 <uinfo_nsec>:
+  800a37:	55                   	push   %ebp
+  800a38:	89 e5                	mov    %esp,%ebp
+  800a3a:	57                   	push   %edi
+  800a3b:	56                   	push   %esi
+  800a3c:	53                   	push   %ebx
+  800a3d:	83 ec 1c             	sub    $0x1c,%esp
+  800a40:	0f 31                	rdtsc
+  800a42:	89 c6                	mov    %eax,%esi
+  800a44:	89 d7                	mov    %edx,%edi
+  800a46:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  800a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a51:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a56:	85 c9                	test   %ecx,%ecx
+  800a58:	74 5c                	je     800ab6 <uinfo_nsec+0x7f>
+  800a5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a5f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800a62:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800a65:	52                   	push   %edx
+  800a66:	51                   	push   %ecx
+  800a67:	57                   	push   %edi
+  800a68:	56                   	push   %esi
+  800a69:	e8 63 0d 00 00       	call   8017d1 <__umoddi3>
+  800a6e:	83 c4 10             	add    $0x10,%esp
+  800a71:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800a77:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  800a7c:	f7 e3                	mul    %ebx
+  800a7e:	01 ca                	add    %ecx,%edx
+  800a80:	ff 75 e4             	push   -0x1c(%ebp)
+  800a83:	ff 75 e0             	push   -0x20(%ebp)
+  800a86:	52                   	push   %edx
+  800a87:	50                   	push   %eax
+  800a88:	e8 6c 0c 00 00       	call   8016f9 <__udivdi3>
+  800a8d:	83 c4 10             	add    $0x10,%esp
+  800a90:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a93:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a96:	ff 75 e4             	push   -0x1c(%ebp)
+  800a99:	ff 75 e0             	push   -0x20(%ebp)
+  800a9c:	57                   	push   %edi
+  800a9d:	56                   	push   %esi
+  800a9e:	e8 56 0c 00 00       	call   8016f9 <__udivdi3>
+  800aa3:	83 c4 10             	add    $0x10,%esp
+  800aa6:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800aac:	f7 e3                	mul    %ebx
+  800aae:	01 ca                	add    %ecx,%edx
+  800ab0:	03 45 d8             	add    -0x28(%ebp),%eax
+  800ab3:	13 55 dc             	adc    -0x24(%ebp),%edx
+  800ab6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ab9:	5b                   	pop    %ebx
+  800aba:	5e                   	pop    %esi
+  800abb:	5f                   	pop    %edi
+  800abc:	5d                   	pop    %ebp
+  800abd:	c3                   	ret
+
+00800abe <bflush>:
+  800abe:	a1 40 20 80 00       	mov    0x802040,%eax
+  800ac3:	85 c0                	test   %eax,%eax
+  800ac5:	75 01                	jne    800ac8 <bflush+0xa>
+  800ac7:	c3                   	ret
+  800ac8:	55                   	push   %ebp
+  800ac9:	89 e5                	mov    %esp,%ebp
+  800acb:	83 ec 10             	sub    $0x10,%esp
+  800ace:	50                   	push   %eax
+  800acf:	68 44 20 80 00       	push   $0x802044
+  800ad4:	e8 d4 f5 ff ff       	call   8000ad <sys_cputs>
+  800ad9:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  800ae0:	00 00 00 
+  800ae3:	83 c4 10             	add    $0x10,%esp
+  800ae6:	c9                   	leave
+  800ae7:	c3                   	ret
+
+00800ae8 <bputch>:
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	53                   	push   %ebx
+  800aec:	83 ec 04             	sub    $0x4,%esp
+  800aef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800af2:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  800af8:	8d 42 01             	lea    0x1(%edx),%eax
+  800afb:	a3 40 20 80 00       	mov    %eax,0x802040
+  800b00:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b03:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  800b09:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b0e:	77 08                	ja     800b18 <bputch+0x30>
+  800b10:	83 03 01             	addl   $0x1,(%ebx)
+  800b13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b16:	c9                   	leave
+  800b17:	c3                   	ret
+  800b18:	e8 a1 ff ff ff       	call   800abe <bflush>
+  800b1d:	eb f1                	jmp    800b10 <bputch+0x28>
+
+00800b1f <vbprintf>:
+  800b1f:	55                   	push   %ebp
+  800b20:	89 e5                	mov    %esp,%ebp
+  800b22:	83 ec 18             	sub    $0x18,%esp
+  800b25:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800b2c:	ff 75 0c             	push   0xc(%ebp)
+  800b2f:	ff 75 08             	push   0x8(%ebp)
+  800b32:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b35:	50                   	push   %eax
+  800b36:	68 e8 0a 80 00       	push   $0x800ae8
+  800b3b:	e8 4c 02 00 00       	call   800d8c <vprintfmt>
+  800b40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b43:	c9                   	leave
+  800b44:	c3                   	ret
+
+00800b45 <bprintf>:
+  800b45:	55                   	push   %ebp
+  800b46:	89 e5                	mov    %esp,%ebp
+  800b48:	83 ec 10             	sub    $0x10,%esp
+  800b4b:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800b4e:	50                   	push   %eax
+  800b4f:	ff 75 08             	push   0x8(%ebp)
+  800b52:	e8 c8 ff ff ff       	call   800b1f <vbprintf>
+  800b57:	c9                   	leave
+  800b58:	c3                   	ret
+
+00800b59 <bwrite>:
+  800b59:	55                   	push   %ebp
+  800b5a:	89 e5                	mov    %esp,%ebp
+  800b5c:	53                   	push   %ebx
+  800b5d:	83 ec 04             	sub    $0x4,%esp
+  800b60:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b63:	89 d8                	mov    %ebx,%eax
+  800b65:	03 05 40 20 80 00    	add    0x802040,%eax
+  800b6b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b70:	76 0d                	jbe    800b7f <bwrite+0x26>
+  800b72:	e8 47 ff ff ff       	call   800abe <bflush>
+  800b77:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  800b7d:	77 25                	ja     800ba4 <bwrite+0x4b>
+  800b7f:	83 ec 04             	sub    $0x4,%esp
+  800b82:	53                   	push   %ebx
+  800b83:	ff 75 08             	push   0x8(%ebp)
+  800b86:	a1 40 20 80 00       	mov    0x802040,%eax
+  800b8b:	05 44 20 80 00       	add    $0x802044,%eax
+  800b90:	50                   	push   %eax
+  800b91:	e8 61 09 00 00       	call   8014f7 <memcpy>
+  800b96:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  800b9c:	83 c4 10             	add    $0x10,%esp
+  800b9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ba2:	c9                   	leave
+  800ba3:	c3                   	ret
+  800ba4:	83 ec 08             	sub    $0x8,%esp
+  800ba7:	53                   	push   %ebx
+  800ba8:	ff 75 08             	push   0x8(%ebp)
+  800bab:	e8 fd f4 ff ff       	call   8000ad <sys_cputs>
+  800bb0:	83 c4 10             	add    $0x10,%esp
+  800bb3:	eb ea                	jmp    800b9f <bwrite+0x46>
+
+00800bb5 <_panic>:
+  800bb5:	55                   	push   %ebp
+  800bb6:	89 e5                	mov    %esp,%ebp
+  800bb8:	56                   	push   %esi
+  800bb9:	53                   	push   %ebx
+  800bba:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800bbd:	e8 fc fe ff ff       	call   800abe <bflush>
+  800bc2:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  800bc8:	e8 39 f6 ff ff       	call   800206 <sys_getenvid>
+  800bcd:	83 ec 0c             	sub    $0xc,%esp
+  800bd0:	ff 75 0c             	push   0xc(%ebp)
+  800bd3:	ff 75 08             	push   0x8(%ebp)
+  800bd6:	56                   	push   %esi
+  800bd7:	50                   	push   %eax
+  800bd8:	68 bc 19 80 00       	push   $0x8019bc
+  800bdd:	e8 b3 00 00 00       	call   800c95 <cprintf>
+  800be2:	83 c4 18             	add    $0x18,%esp
+  800be5:	53                   	push   %ebx
+  800be6:	ff 75 10             	push   0x10(%ebp)
+  800be9:	e8 56 00 00 00       	call   800c44 <vcprintf>
+  800bee:	c7 04 24 df 19 80 00 	movl   $0x8019df,(%esp)
+  800bf5:	e8 9b 00 00 00       	call   800c95 <cprintf>
+  800bfa:	83 c4 10             	add    $0x10,%esp
+  800bfd:	cc                   	int3
+  800bfe:	eb fd                	jmp    800bfd <_panic+0x48>
+
+00800c00 <putch>:
+  800c00:	55                   	push   %ebp
+  800c01:	89 e5                	mov    %esp,%ebp
+  800c03:	53                   	push   %ebx
+  800c04:	83 ec 04             	sub    $0x4,%esp
+  800c07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c0a:	8b 13                	mov    (%ebx),%edx
+  800c0c:	8d 42 01             	lea    0x1(%edx),%eax
+  800c0f:	89 03                	mov    %eax,(%ebx)
+  800c11:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c14:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800c18:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800c1d:	74 09                	je     800c28 <putch+0x28>
+  800c1f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800c23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c26:	c9                   	leave
+  800c27:	c3                   	ret
+  800c28:	83 ec 08             	sub    $0x8,%esp
+  800c2b:	68 ff 00 00 00       	push   $0xff
+  800c30:	8d 43 08             	lea    0x8(%ebx),%eax
+  800c33:	50                   	push   %eax
+  800c34:	e8 74 f4 ff ff       	call   8000ad <sys_cputs>
+  800c39:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800c3f:	83 c4 10             	add    $0x10,%esp
+  800c42:	eb db                	jmp    800c1f <putch+0x1f>
+
+00800c44 <vcprintf>:
+  800c44:	55                   	push   %ebp
+  800c45:	89 e5                	mov    %esp,%ebp
+  800c47:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800c4d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800c54:	00 00 00 
+  800c57:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800c5e:	00 00 00 
+  800c61:	ff 75 0c             	push   0xc(%ebp)
+  800c64:	ff 75 08             	push   0x8(%ebp)
+  800c67:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800c6d:	50                   	push   %eax
+  800c6e:	68 00 0c 80 00       	push   $0x800c00
+  800c73:	e8 14 01 00 00       	call   800d8c <vprintfmt>
+  800c78:	83 c4 08             	add    $0x8,%esp
+  800c7b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800c81:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800c87:	50                   	push   %eax
+  800c88:	e8 20 f4 ff ff       	call   8000ad <sys_cputs>
+  800c8d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800c93:	c9                   	leave
+  800c94:	c3                   	ret
+
+00800c95 <cprintf>:
+  800c95:	55                   	push   %ebp
+  800c96:	89 e5                	mov    %esp,%ebp
+  800c98:	83 ec 10             	sub    $0x10,%esp
+  800c9b:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800c9e:	50                   	push   %eax
+  800c9f:	ff 75 08             	push   0x8(%ebp)
+  800ca2:	e8 9d ff ff ff       	call   800c44 <vcprintf>
+  800ca7:	c9                   	leave
+  800ca8:	c3                   	ret
+
+00800ca9 <printnum>:
+  800ca9:	55                   	push   %ebp
+  800caa:	89 e5                	mov    %esp,%ebp
+  800cac:	57                   	push   %edi
+  800cad:	56                   	push   %esi
+  800cae:	53                   	push   %ebx
+  800caf:	83 ec 1c             	sub    $0x1c,%esp
+  800cb2:	89 c7                	mov    %eax,%edi
+  800cb4:	89 d6                	mov    %edx,%esi
+  800cb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cbc:	89 d1                	mov    %edx,%ecx
+  800cbe:	89 c2                	mov    %eax,%edx
+  800cc0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cc3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800cc6:	8b 45 10             	mov    0x10(%ebp),%eax
+  800cc9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800ccc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800ccf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800cd6:	39 c2                	cmp    %eax,%edx
+  800cd8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800cdb:	72 3e                	jb     800d1b <printnum+0x72>
+  800cdd:	83 ec 0c             	sub    $0xc,%esp
+  800ce0:	ff 75 18             	push   0x18(%ebp)
+  800ce3:	83 eb 01             	sub    $0x1,%ebx
+  800ce6:	53                   	push   %ebx
+  800ce7:	50                   	push   %eax
+  800ce8:	83 ec 08             	sub    $0x8,%esp
+  800ceb:	ff 75 e4             	push   -0x1c(%ebp)
+  800cee:	ff 75 e0             	push   -0x20(%ebp)
+  800cf1:	ff 75 dc             	push   -0x24(%ebp)
+  800cf4:	ff 75 d8             	push   -0x28(%ebp)
+  800cf7:	e8 fd 09 00 00       	call   8016f9 <__udivdi3>
+  800cfc:	83 c4 18             	add    $0x18,%esp
+  800cff:	52                   	push   %edx
+  800d00:	50                   	push   %eax
+  800d01:	89 f2                	mov    %esi,%edx
+  800d03:	89 f8                	mov    %edi,%eax
+  800d05:	e8 9f ff ff ff       	call   800ca9 <printnum>
+  800d0a:	83 c4 20             	add    $0x20,%esp
+  800d0d:	eb 13                	jmp    800d22 <printnum+0x79>
+  800d0f:	83 ec 08             	sub    $0x8,%esp
+  800d12:	56                   	push   %esi
+  800d13:	ff 75 18             	push   0x18(%ebp)
+  800d16:	ff d7                	call   *%edi
+  800d18:	83 c4 10             	add    $0x10,%esp
+  800d1b:	83 eb 01             	sub    $0x1,%ebx
+  800d1e:	85 db                	test   %ebx,%ebx
+  800d20:	7f ed                	jg     800d0f <printnum+0x66>
+  800d22:	83 ec 08             	sub    $0x8,%esp
+  800d25:	56                   	push   %esi
+  800d26:	83 ec 04             	sub    $0x4,%esp
+  800d29:	ff 75 e4             	push   -0x1c(%ebp)
+  800d2c:	ff 75 e0             	push   -0x20(%ebp)
+  800d2f:	ff 75 dc             	push   -0x24(%ebp)
+  800d32:	ff 75 d8             	push   -0x28(%ebp)
+  800d35:	e8 97 0a 00 00       	call   8017d1 <__umoddi3>
+  800d3a:	83 c4 14             	add    $0x14,%esp
+  800d3d:	0f be 80 e1 19 80 00 	movsbl 0x8019e1(%eax),%eax
+  800d44:	50                   	push   %eax
+  800d45:	ff d7                	call   *%edi
+  800d47:	83 c4 10             	add    $0x10,%esp
+  800d4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4d:	5b                   	pop    %ebx
+  800d4e:	5e                   	pop    %esi
+  800d4f:	5f                   	pop    %edi
+  800d50:	5d                   	pop    %ebp
+  800d51:	c3                   	ret
+
+00800d52 <sprintputch>:
+  800d52:	55                   	push   %ebp
+  800d53:	89 e5                	mov    %esp,%ebp
+  800d55:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d58:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800d5c:	8b 10                	mov    (%eax),%edx
+  800d5e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800d61:	73 0a                	jae    800d6d <sprintputch+0x1b>
+  800d63:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800d66:	89 08                	mov    %ecx,(%eax)
+  800d68:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d6b:	88 02                	mov    %al,(%edx)
+  800d6d:	5d                   	pop    %ebp
+  800d6e:	c3                   	ret
+
+00800d6f <printfmt>:
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	83 ec 08             	sub    $0x8,%esp
+  800d75:	8d 45 14             	lea    0x14(%ebp),%eax
+  800d78:	50                   	push   %eax
+  800d79:	ff 75 10             	push   0x10(%ebp)
+  800d7c:	ff 75 0c             	push   0xc(%ebp)
+  800d7f:	ff 75 08             	push   0x8(%ebp)
+  800d82:	e8 05 00 00 00       	call   800d8c <vprintfmt>
+  800d87:	83 c4 10             	add    $0x10,%esp
+  800d8a:	c9                   	leave
+  800d8b:	c3                   	ret
+
+00800d8c <vprintfmt>:
+  800d8c:	55                   	push   %ebp
+  800d8d:	89 e5                	mov    %esp,%ebp
+  800d8f:	57                   	push   %edi
+  800d90:	56                   	push   %esi
+  800d91:	53                   	push   %ebx
+  800d92:	83 ec 2c             	sub    $0x2c,%esp
+  800d95:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d98:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d9b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d9e:	eb 0a                	jmp    800daa <vprintfmt+0x1e>
+  800da0:	83 ec 08             	sub    $0x8,%esp
+  800da3:	53                   	push   %ebx
+  800da4:	50                   	push   %eax
+  800da5:	ff d6                	call   *%esi
+  800da7:	83 c4 10             	add    $0x10,%esp
+  800daa:	83 c7 01             	add    $0x1,%edi
+  800dad:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800db1:	83 f8 25             	cmp    $0x25,%eax
+  800db4:	74 0c                	je     800dc2 <vprintfmt+0x36>
+  800db6:	85 c0                	test   %eax,%eax
+  800db8:	75 e6                	jne    800da0 <vprintfmt+0x14>
+  800dba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dbd:	5b                   	pop    %ebx
+  800dbe:	5e                   	pop    %esi
+  800dbf:	5f                   	pop    %edi
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	c3                   	ret
+  800dc2:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800dc6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800dcd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800dd4:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800ddb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800de0:	8d 47 01             	lea    0x1(%edi),%eax
+  800de3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800de6:	0f b6 17             	movzbl (%edi),%edx
+  800de9:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800dec:	3c 55                	cmp    $0x55,%al
+  800dee:	0f 87 cf 03 00 00    	ja     8011c3 <vprintfmt+0x437>
+  800df4:	0f b6 c0             	movzbl %al,%eax
+  800df7:	ff 24 85 a0 1a 80 00 	jmp    *0x801aa0(,%eax,4)
+  800dfe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e01:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800e05:	eb d9                	jmp    800de0 <vprintfmt+0x54>
+  800e07:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e0a:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800e0e:	eb d0                	jmp    800de0 <vprintfmt+0x54>
+  800e10:	0f b6 d2             	movzbl %dl,%edx
+  800e13:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e1e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800e21:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800e25:	0f be 17             	movsbl (%edi),%edx
+  800e28:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800e2b:	83 f9 09             	cmp    $0x9,%ecx
+  800e2e:	77 55                	ja     800e85 <vprintfmt+0xf9>
+  800e30:	83 c7 01             	add    $0x1,%edi
+  800e33:	eb e9                	jmp    800e1e <vprintfmt+0x92>
+  800e35:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e38:	8b 00                	mov    (%eax),%eax
+  800e3a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e3d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e40:	8d 40 04             	lea    0x4(%eax),%eax
+  800e43:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e46:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e49:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800e4d:	79 91                	jns    800de0 <vprintfmt+0x54>
+  800e4f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800e52:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e55:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800e5c:	eb 82                	jmp    800de0 <vprintfmt+0x54>
+  800e5e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e61:	85 d2                	test   %edx,%edx
+  800e63:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e68:	0f 49 c2             	cmovns %edx,%eax
+  800e6b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e6e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e71:	e9 6a ff ff ff       	jmp    800de0 <vprintfmt+0x54>
+  800e76:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e79:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800e80:	e9 5b ff ff ff       	jmp    800de0 <vprintfmt+0x54>
+  800e85:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e88:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e8b:	eb bc                	jmp    800e49 <vprintfmt+0xbd>
+  800e8d:	83 c1 01             	add    $0x1,%ecx
+  800e90:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e93:	e9 48 ff ff ff       	jmp    800de0 <vprintfmt+0x54>
+  800e98:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e9b:	8d 78 04             	lea    0x4(%eax),%edi
+  800e9e:	83 ec 08             	sub    $0x8,%esp
+  800ea1:	53                   	push   %ebx
+  800ea2:	ff 30                	push   (%eax)
+  800ea4:	ff d6                	call   *%esi
+  800ea6:	83 c4 10             	add    $0x10,%esp
+  800ea9:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800eac:	e9 b1 02 00 00       	jmp    801162 <vprintfmt+0x3d6>
+  800eb1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800eb4:	8d 78 04             	lea    0x4(%eax),%edi
+  800eb7:	8b 10                	mov    (%eax),%edx
+  800eb9:	89 d0                	mov    %edx,%eax
+  800ebb:	f7 d8                	neg    %eax
+  800ebd:	0f 48 c2             	cmovs  %edx,%eax
+  800ec0:	83 f8 08             	cmp    $0x8,%eax
+  800ec3:	7f 23                	jg     800ee8 <vprintfmt+0x15c>
+  800ec5:	8b 14 85 00 1c 80 00 	mov    0x801c00(,%eax,4),%edx
+  800ecc:	85 d2                	test   %edx,%edx
+  800ece:	74 18                	je     800ee8 <vprintfmt+0x15c>
+  800ed0:	52                   	push   %edx
+  800ed1:	68 02 1a 80 00       	push   $0x801a02
+  800ed6:	53                   	push   %ebx
+  800ed7:	56                   	push   %esi
+  800ed8:	e8 92 fe ff ff       	call   800d6f <printfmt>
+  800edd:	83 c4 10             	add    $0x10,%esp
+  800ee0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800ee3:	e9 7a 02 00 00       	jmp    801162 <vprintfmt+0x3d6>
+  800ee8:	50                   	push   %eax
+  800ee9:	68 f9 19 80 00       	push   $0x8019f9
+  800eee:	53                   	push   %ebx
+  800eef:	56                   	push   %esi
+  800ef0:	e8 7a fe ff ff       	call   800d6f <printfmt>
+  800ef5:	83 c4 10             	add    $0x10,%esp
+  800ef8:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800efb:	e9 62 02 00 00       	jmp    801162 <vprintfmt+0x3d6>
+  800f00:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f03:	83 c0 04             	add    $0x4,%eax
+  800f06:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800f09:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f0c:	8b 08                	mov    (%eax),%ecx
+  800f0e:	85 c9                	test   %ecx,%ecx
+  800f10:	b8 f2 19 80 00       	mov    $0x8019f2,%eax
+  800f15:	0f 45 c1             	cmovne %ecx,%eax
+  800f18:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800f1b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800f1f:	7e 06                	jle    800f27 <vprintfmt+0x19b>
+  800f21:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800f25:	75 0b                	jne    800f32 <vprintfmt+0x1a6>
+  800f27:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800f2a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800f2d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f30:	eb 5c                	jmp    800f8e <vprintfmt+0x202>
+  800f32:	83 ec 08             	sub    $0x8,%esp
+  800f35:	ff 75 d0             	push   -0x30(%ebp)
+  800f38:	ff 75 cc             	push   -0x34(%ebp)
+  800f3b:	e8 87 03 00 00       	call   8012c7 <strnlen>
+  800f40:	89 c2                	mov    %eax,%edx
+  800f42:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f45:	29 d0                	sub    %edx,%eax
+  800f47:	83 c4 10             	add    $0x10,%esp
+  800f4a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800f4e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f51:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f54:	89 c6                	mov    %eax,%esi
+  800f56:	eb 0e                	jmp    800f66 <vprintfmt+0x1da>
+  800f58:	83 ec 08             	sub    $0x8,%esp
+  800f5b:	53                   	push   %ebx
+  800f5c:	57                   	push   %edi
+  800f5d:	ff 55 08             	call   *0x8(%ebp)
+  800f60:	83 ee 01             	sub    $0x1,%esi
+  800f63:	83 c4 10             	add    $0x10,%esp
+  800f66:	85 f6                	test   %esi,%esi
+  800f68:	7f ee                	jg     800f58 <vprintfmt+0x1cc>
+  800f6a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f6d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f70:	85 c0                	test   %eax,%eax
+  800f72:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f77:	0f 49 d0             	cmovns %eax,%edx
+  800f7a:	29 d0                	sub    %edx,%eax
+  800f7c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f7f:	eb a6                	jmp    800f27 <vprintfmt+0x19b>
+  800f81:	83 ec 08             	sub    $0x8,%esp
+  800f84:	53                   	push   %ebx
+  800f85:	52                   	push   %edx
+  800f86:	ff 55 08             	call   *0x8(%ebp)
+  800f89:	83 c4 10             	add    $0x10,%esp
+  800f8c:	89 f1                	mov    %esi,%ecx
+  800f8e:	8d 71 01             	lea    0x1(%ecx),%esi
+  800f91:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800f95:	0f be d0             	movsbl %al,%edx
+  800f98:	85 d2                	test   %edx,%edx
+  800f9a:	74 28                	je     800fc4 <vprintfmt+0x238>
+  800f9c:	85 ff                	test   %edi,%edi
+  800f9e:	78 05                	js     800fa5 <vprintfmt+0x219>
+  800fa0:	83 ef 01             	sub    $0x1,%edi
+  800fa3:	78 30                	js     800fd5 <vprintfmt+0x249>
+  800fa5:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800fa9:	74 d6                	je     800f81 <vprintfmt+0x1f5>
+  800fab:	0f be c0             	movsbl %al,%eax
+  800fae:	83 e8 20             	sub    $0x20,%eax
+  800fb1:	83 f8 5e             	cmp    $0x5e,%eax
+  800fb4:	76 cb                	jbe    800f81 <vprintfmt+0x1f5>
+  800fb6:	83 ec 08             	sub    $0x8,%esp
+  800fb9:	53                   	push   %ebx
+  800fba:	6a 3f                	push   $0x3f
+  800fbc:	ff 55 08             	call   *0x8(%ebp)
+  800fbf:	83 c4 10             	add    $0x10,%esp
+  800fc2:	eb c8                	jmp    800f8c <vprintfmt+0x200>
+  800fc4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fc7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800fca:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800fcd:	01 d0                	add    %edx,%eax
+  800fcf:	29 c8                	sub    %ecx,%eax
+  800fd1:	89 c7                	mov    %eax,%edi
+  800fd3:	eb 13                	jmp    800fe8 <vprintfmt+0x25c>
+  800fd5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fd8:	eb ed                	jmp    800fc7 <vprintfmt+0x23b>
+  800fda:	83 ec 08             	sub    $0x8,%esp
+  800fdd:	53                   	push   %ebx
+  800fde:	6a 20                	push   $0x20
+  800fe0:	ff d6                	call   *%esi
+  800fe2:	83 ef 01             	sub    $0x1,%edi
+  800fe5:	83 c4 10             	add    $0x10,%esp
+  800fe8:	85 ff                	test   %edi,%edi
+  800fea:	7f ee                	jg     800fda <vprintfmt+0x24e>
+  800fec:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800fef:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ff2:	e9 6b 01 00 00       	jmp    801162 <vprintfmt+0x3d6>
+  800ff7:	83 f9 01             	cmp    $0x1,%ecx
+  800ffa:	7f 1f                	jg     80101b <vprintfmt+0x28f>
+  800ffc:	85 c9                	test   %ecx,%ecx
+  800ffe:	74 67                	je     801067 <vprintfmt+0x2db>
+  801000:	8b 45 14             	mov    0x14(%ebp),%eax
+  801003:	8b 00                	mov    (%eax),%eax
+  801005:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801008:	89 c1                	mov    %eax,%ecx
+  80100a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80100d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801010:	8b 45 14             	mov    0x14(%ebp),%eax
+  801013:	8d 40 04             	lea    0x4(%eax),%eax
+  801016:	89 45 14             	mov    %eax,0x14(%ebp)
+  801019:	eb 17                	jmp    801032 <vprintfmt+0x2a6>
+  80101b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80101e:	8b 50 04             	mov    0x4(%eax),%edx
+  801021:	8b 00                	mov    (%eax),%eax
+  801023:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801026:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801029:	8b 45 14             	mov    0x14(%ebp),%eax
+  80102c:	8d 40 08             	lea    0x8(%eax),%eax
+  80102f:	89 45 14             	mov    %eax,0x14(%ebp)
+  801032:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801035:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801038:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80103d:	85 c9                	test   %ecx,%ecx
+  80103f:	0f 89 03 01 00 00    	jns    801148 <vprintfmt+0x3bc>
+  801045:	83 ec 08             	sub    $0x8,%esp
+  801048:	53                   	push   %ebx
+  801049:	6a 2d                	push   $0x2d
+  80104b:	ff d6                	call   *%esi
+  80104d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801050:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801053:	f7 da                	neg    %edx
+  801055:	83 d1 00             	adc    $0x0,%ecx
+  801058:	f7 d9                	neg    %ecx
+  80105a:	83 c4 10             	add    $0x10,%esp
+  80105d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801062:	e9 e1 00 00 00       	jmp    801148 <vprintfmt+0x3bc>
+  801067:	8b 45 14             	mov    0x14(%ebp),%eax
+  80106a:	8b 00                	mov    (%eax),%eax
+  80106c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80106f:	89 c1                	mov    %eax,%ecx
+  801071:	c1 f9 1f             	sar    $0x1f,%ecx
+  801074:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801077:	8b 45 14             	mov    0x14(%ebp),%eax
+  80107a:	8d 40 04             	lea    0x4(%eax),%eax
+  80107d:	89 45 14             	mov    %eax,0x14(%ebp)
+  801080:	eb b0                	jmp    801032 <vprintfmt+0x2a6>
+  801082:	83 f9 01             	cmp    $0x1,%ecx
+  801085:	7f 1e                	jg     8010a5 <vprintfmt+0x319>
+  801087:	85 c9                	test   %ecx,%ecx
+  801089:	74 32                	je     8010bd <vprintfmt+0x331>
+  80108b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80108e:	8b 10                	mov    (%eax),%edx
+  801090:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801095:	8d 40 04             	lea    0x4(%eax),%eax
+  801098:	89 45 14             	mov    %eax,0x14(%ebp)
+  80109b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010a0:	e9 a3 00 00 00       	jmp    801148 <vprintfmt+0x3bc>
+  8010a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010a8:	8b 10                	mov    (%eax),%edx
+  8010aa:	8b 48 04             	mov    0x4(%eax),%ecx
+  8010ad:	8d 40 08             	lea    0x8(%eax),%eax
+  8010b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010b3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010b8:	e9 8b 00 00 00       	jmp    801148 <vprintfmt+0x3bc>
+  8010bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010c0:	8b 10                	mov    (%eax),%edx
+  8010c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8010ca:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010cd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010d2:	eb 74                	jmp    801148 <vprintfmt+0x3bc>
+  8010d4:	83 f9 01             	cmp    $0x1,%ecx
+  8010d7:	7f 1b                	jg     8010f4 <vprintfmt+0x368>
+  8010d9:	85 c9                	test   %ecx,%ecx
+  8010db:	74 2c                	je     801109 <vprintfmt+0x37d>
+  8010dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010e0:	8b 10                	mov    (%eax),%edx
+  8010e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8010ea:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010ed:	bf 08 00 00 00       	mov    $0x8,%edi
+  8010f2:	eb 54                	jmp    801148 <vprintfmt+0x3bc>
+  8010f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010f7:	8b 10                	mov    (%eax),%edx
+  8010f9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8010fc:	8d 40 08             	lea    0x8(%eax),%eax
+  8010ff:	89 45 14             	mov    %eax,0x14(%ebp)
+  801102:	bf 08 00 00 00       	mov    $0x8,%edi
+  801107:	eb 3f                	jmp    801148 <vprintfmt+0x3bc>
+  801109:	8b 45 14             	mov    0x14(%ebp),%eax
+  80110c:	8b 10                	mov    (%eax),%edx
+  80110e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801113:	8d 40 04             	lea    0x4(%eax),%eax
+  801116:	89 45 14             	mov    %eax,0x14(%ebp)
+  801119:	bf 08 00 00 00       	mov    $0x8,%edi
+  80111e:	eb 28                	jmp    801148 <vprintfmt+0x3bc>
+  801120:	83 ec 08             	sub    $0x8,%esp
+  801123:	53                   	push   %ebx
+  801124:	6a 30                	push   $0x30
+  801126:	ff d6                	call   *%esi
+  801128:	83 c4 08             	add    $0x8,%esp
+  80112b:	53                   	push   %ebx
+  80112c:	6a 78                	push   $0x78
+  80112e:	ff d6                	call   *%esi
+  801130:	8b 45 14             	mov    0x14(%ebp),%eax
+  801133:	8b 10                	mov    (%eax),%edx
+  801135:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80113a:	83 c4 10             	add    $0x10,%esp
+  80113d:	8d 40 04             	lea    0x4(%eax),%eax
+  801140:	89 45 14             	mov    %eax,0x14(%ebp)
+  801143:	bf 10 00 00 00       	mov    $0x10,%edi
+  801148:	83 ec 0c             	sub    $0xc,%esp
+  80114b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80114f:	50                   	push   %eax
+  801150:	ff 75 e0             	push   -0x20(%ebp)
+  801153:	57                   	push   %edi
+  801154:	51                   	push   %ecx
+  801155:	52                   	push   %edx
+  801156:	89 da                	mov    %ebx,%edx
+  801158:	89 f0                	mov    %esi,%eax
+  80115a:	e8 4a fb ff ff       	call   800ca9 <printnum>
+  80115f:	83 c4 20             	add    $0x20,%esp
+  801162:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801165:	e9 40 fc ff ff       	jmp    800daa <vprintfmt+0x1e>
+  80116a:	83 f9 01             	cmp    $0x1,%ecx
+  80116d:	7f 1b                	jg     80118a <vprintfmt+0x3fe>
+  80116f:	85 c9                	test   %ecx,%ecx
+  801171:	74 2c                	je     80119f <vprintfmt+0x413>
+  801173:	8b 45 14             	mov    0x14(%ebp),%eax
+  801176:	8b 10                	mov    (%eax),%edx
+  801178:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80117d:	8d 40 04             	lea    0x4(%eax),%eax
+  801180:	89 45 14             	mov    %eax,0x14(%ebp)
+  801183:	bf 10 00 00 00       	mov    $0x10,%edi
+  801188:	eb be                	jmp    801148 <vprintfmt+0x3bc>
+  80118a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80118d:	8b 10                	mov    (%eax),%edx
+  80118f:	8b 48 04             	mov    0x4(%eax),%ecx
+  801192:	8d 40 08             	lea    0x8(%eax),%eax
+  801195:	89 45 14             	mov    %eax,0x14(%ebp)
+  801198:	bf 10 00 00 00       	mov    $0x10,%edi
+  80119d:	eb a9                	jmp    801148 <vprintfmt+0x3bc>
+  80119f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011a2:	8b 10                	mov    (%eax),%edx
+  8011a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011a9:	8d 40 04             	lea    0x4(%eax),%eax
+  8011ac:	89 45 14             	mov    %eax,0x14(%ebp)
+  8011af:	bf 10 00 00 00       	mov    $0x10,%edi
+  8011b4:	eb 92                	jmp    801148 <vprintfmt+0x3bc>
+  8011b6:	83 ec 08             	sub    $0x8,%esp
+  8011b9:	53                   	push   %ebx
+  8011ba:	6a 25                	push   $0x25
+  8011bc:	ff d6                	call   *%esi
+  8011be:	83 c4 10             	add    $0x10,%esp
+  8011c1:	eb 9f                	jmp    801162 <vprintfmt+0x3d6>
+  8011c3:	83 ec 08             	sub    $0x8,%esp
+  8011c6:	53                   	push   %ebx
+  8011c7:	6a 25                	push   $0x25
+  8011c9:	ff d6                	call   *%esi
+  8011cb:	83 c4 10             	add    $0x10,%esp
+  8011ce:	89 f8                	mov    %edi,%eax
+  8011d0:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8011d4:	74 05                	je     8011db <vprintfmt+0x44f>
+  8011d6:	83 e8 01             	sub    $0x1,%eax
+  8011d9:	eb f5                	jmp    8011d0 <vprintfmt+0x444>
+  8011db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8011de:	eb 82                	jmp    801162 <vprintfmt+0x3d6>
+
+008011e0 <vsnprintf>:
+  8011e0:	55                   	push   %ebp
+  8011e1:	89 e5                	mov    %esp,%ebp
+  8011e3:	83 ec 18             	sub    $0x18,%esp
+  8011e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011ec:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8011ef:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8011f3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8011f6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8011fd:	85 c0                	test   %eax,%eax
+  8011ff:	74 26                	je     801227 <vsnprintf+0x47>
+  801201:	85 d2                	test   %edx,%edx
+  801203:	7e 22                	jle    801227 <vsnprintf+0x47>
+  801205:	ff 75 14             	push   0x14(%ebp)
+  801208:	ff 75 10             	push   0x10(%ebp)
+  80120b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80120e:	50                   	push   %eax
+  80120f:	68 52 0d 80 00       	push   $0x800d52
+  801214:	e8 73 fb ff ff       	call   800d8c <vprintfmt>
+  801219:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80121c:	c6 00 00             	movb   $0x0,(%eax)
+  80121f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801222:	83 c4 10             	add    $0x10,%esp
+  801225:	c9                   	leave
+  801226:	c3                   	ret
+  801227:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80122c:	eb f7                	jmp    801225 <vsnprintf+0x45>
+
+0080122e <snprintf>:
+  80122e:	55                   	push   %ebp
+  80122f:	89 e5                	mov    %esp,%ebp
+  801231:	83 ec 08             	sub    $0x8,%esp
+  801234:	8d 45 14             	lea    0x14(%ebp),%eax
+  801237:	50                   	push   %eax
+  801238:	ff 75 10             	push   0x10(%ebp)
+  80123b:	ff 75 0c             	push   0xc(%ebp)
+  80123e:	ff 75 08             	push   0x8(%ebp)
+  801241:	e8 9a ff ff ff       	call   8011e0 <vsnprintf>
+  801246:	c9                   	leave
+  801247:	c3                   	ret
+
+00801248 <copy_fwd>:
+  801248:	55                   	push   %ebp
+  801249:	89 e5                	mov    %esp,%ebp
+  80124b:	57                   	push   %edi
+  80124c:	56                   	push   %esi
+  80124d:	53                   	push   %ebx
+  80124e:	89 c7                	mov    %eax,%edi
+  801250:	89 d6                	mov    %edx,%esi
+  801252:	89 c8                	mov    %ecx,%eax
+  801254:	83 f9 0f             	cmp    $0xf,%ecx
+  801257:	76 1c                	jbe    801275 <copy_fwd+0x2d>
+  801259:	89 f9                	mov    %edi,%ecx
+  80125b:	f7 d9                	neg    %ecx
+  80125d:	89 cb                	mov    %ecx,%ebx
+  80125f:	83 e3 03             	and    $0x3,%ebx
+  801262:	29 d8                	sub    %ebx,%eax
+  801264:	89 c2                	mov    %eax,%edx
+  801266:	c1 ea 02             	shr    $0x2,%edx
+  801269:	83 e0 03             	and    $0x3,%eax
+  80126c:	89 d9                	mov    %ebx,%ecx
+  80126e:	fc                   	cld
+  80126f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  801271:	89 d1                	mov    %edx,%ecx
+  801273:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801275:	89 c1                	mov    %eax,%ecx
+  801277:	fc                   	cld
+  801278:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80127a:	5b                   	pop    %ebx
+  80127b:	5e                   	pop    %esi
+  80127c:	5f                   	pop    %edi
+  80127d:	5d                   	pop    %ebp
+  80127e:	c3                   	ret
+
+0080127f <have_sse2>:
+  80127f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801286:	78 06                	js     80128e <have_sse2+0xf>
+  801288:	a1 08 20 80 00       	mov    0x802008,%eax
+  80128d:	c3                   	ret
+  80128e:	55                   	push   %ebp
+  80128f:	89 e5                	mov    %esp,%ebp
+  801291:	53                   	push   %ebx
+  801292:	b8 01 00 00 00       	mov    $0x1,%eax
+  801297:	0f a2                	cpuid
+  801299:	c1 ea 1a             	shr    $0x1a,%edx
+  80129c:	83 e2 01             	and    $0x1,%edx
+  80129f:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8012a5:	a1 08 20 80 00       	mov    0x802008,%eax
+  8012aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012ad:	c9                   	leave
+  8012ae:	c3                   	ret
+
+008012af <strlen>:
+  8012af:	55                   	push   %ebp
+  8012b0:	89 e5                	mov    %esp,%ebp
+  8012b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ba:	eb 03                	jmp    8012bf <strlen+0x10>
+  8012bc:	83 c0 01             	add    $0x1,%eax
+  8012bf:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8012c3:	75 f7                	jne    8012bc <strlen+0xd>
+  8012c5:	5d                   	pop    %ebp
+  8012c6:	c3                   	ret
+
+008012c7 <strnlen>:
+  8012c7:	55                   	push   %ebp
+  8012c8:	89 e5                	mov    %esp,%ebp
+  8012ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d5:	eb 03                	jmp    8012da <strnlen+0x13>
+  8012d7:	83 c0 01             	add    $0x1,%eax
+  8012da:	39 d0                	cmp    %edx,%eax
+  8012dc:	74 08                	je     8012e6 <strnlen+0x1f>
+  8012de:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8012e2:	75 f3                	jne    8012d7 <strnlen+0x10>
+  8012e4:	89 c2                	mov    %eax,%edx
+  8012e6:	89 d0                	mov    %edx,%eax
+  8012e8:	5d                   	pop    %ebp
+  8012e9:	c3                   	ret
+
+008012ea <strcpy>:
+  8012ea:	55                   	push   %ebp
+  8012eb:	89 e5                	mov    %esp,%ebp
+  8012ed:	53                   	push   %ebx
+  8012ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8012f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8012fd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801300:	83 c0 01             	add    $0x1,%eax
+  801303:	84 d2                	test   %dl,%dl
+  801305:	75 f2                	jne    8012f9 <strcpy+0xf>
+  801307:	89 c8                	mov    %ecx,%eax
+  801309:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80130c:	c9                   	leave
+  80130d:	c3                   	ret
+
+0080130e <strcat>:
+  80130e:	55                   	push   %ebp
+  80130f:	89 e5                	mov    %esp,%ebp
+  801311:	53                   	push   %ebx
+  801312:	83 ec 10             	sub    $0x10,%esp
+  801315:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801318:	53                   	push   %ebx
+  801319:	e8 91 ff ff ff       	call   8012af <strlen>
+  80131e:	83 c4 08             	add    $0x8,%esp
+  801321:	ff 75 0c             	push   0xc(%ebp)
+  801324:	01 d8                	add    %ebx,%eax
+  801326:	50                   	push   %eax
+  801327:	e8 be ff ff ff       	call   8012ea <strcpy>
+  80132c:	89 d8                	mov    %ebx,%eax
+  80132e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801331:	c9                   	leave
+  801332:	c3                   	ret
+
+00801333 <strncpy>:
+  801333:	55                   	push   %ebp
+  801334:	89 e5                	mov    %esp,%ebp
+  801336:	56                   	push   %esi
+  801337:	53                   	push   %ebx
+  801338:	8b 75 08             	mov    0x8(%ebp),%esi
+  80133b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80133e:	89 f3                	mov    %esi,%ebx
+  801340:	03 5d 10             	add    0x10(%ebp),%ebx
+  801343:	89 f0                	mov    %esi,%eax
+  801345:	eb 0f                	jmp    801356 <strncpy+0x23>
+  801347:	83 c0 01             	add    $0x1,%eax
+  80134a:	0f b6 0a             	movzbl (%edx),%ecx
+  80134d:	88 48 ff             	mov    %cl,-0x1(%eax)
+  801350:	80 f9 01             	cmp    $0x1,%cl
+  801353:	83 da ff             	sbb    $0xffffffff,%edx
+  801356:	39 d8                	cmp    %ebx,%eax
+  801358:	75 ed                	jne    801347 <strncpy+0x14>
+  80135a:	89 f0                	mov    %esi,%eax
+  80135c:	5b                   	pop    %ebx
+  80135d:	5e                   	pop    %esi
+  80135e:	5d                   	pop    %ebp
+  80135f:	c3                   	ret
+
+00801360 <strlcpy>:
+  801360:	55                   	push   %ebp
+  801361:	89 e5                	mov    %esp,%ebp
+  801363:	56                   	push   %esi
+  801364:	53                   	push   %ebx
+  801365:	8b 75 08             	mov    0x8(%ebp),%esi
+  801368:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80136e:	89 f0                	mov    %esi,%eax
+  801370:	85 d2                	test   %edx,%edx
+  801372:	74 21                	je     801395 <strlcpy+0x35>
+  801374:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801378:	89 f2                	mov    %esi,%edx
+  80137a:	eb 09                	jmp    801385 <strlcpy+0x25>
+  80137c:	83 c1 01             	add    $0x1,%ecx
+  80137f:	83 c2 01             	add    $0x1,%edx
+  801382:	88 5a ff             	mov    %bl,-0x1(%edx)
+  801385:	39 c2                	cmp    %eax,%edx
+  801387:	74 09                	je     801392 <strlcpy+0x32>
+  801389:	0f b6 19             	movzbl (%ecx),%ebx
+  80138c:	84 db                	test   %bl,%bl
+  80138e:	75 ec                	jne    80137c <strlcpy+0x1c>
+  801390:	89 d0                	mov    %edx,%eax
+  801392:	c6 00 00             	movb   $0x0,(%eax)
+  801395:	29 f0                	sub    %esi,%eax
+  801397:	5b                   	pop    %ebx
+  801398:	5e                   	pop    %esi
+  801399:	5d                   	pop    %ebp
+  80139a:	c3                   	ret
+
+0080139b <strcmp>:
+  80139b:	55                   	push   %ebp
+  80139c:	89 e5                	mov    %esp,%ebp
+  80139e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8013a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013a4:	eb 06                	jmp    8013ac <strcmp+0x11>
+  8013a6:	83 c1 01             	add    $0x1,%ecx
+  8013a9:	83 c2 01             	add    $0x1,%edx
+  8013ac:	0f b6 01             	movzbl (%ecx),%eax
+  8013af:	84 c0                	test   %al,%al
+  8013b1:	74 04                	je     8013b7 <strcmp+0x1c>
+  8013b3:	3a 02                	cmp    (%edx),%al
+  8013b5:	74 ef                	je     8013a6 <strcmp+0xb>
+  8013b7:	0f b6 c0             	movzbl %al,%eax
+  8013ba:	0f b6 12             	movzbl (%edx),%edx
+  8013bd:	29 d0                	sub    %edx,%eax
+  8013bf:	5d                   	pop    %ebp
+  8013c0:	c3                   	ret
+
+008013c1 <strncmp>:
+  8013c1:	55                   	push   %ebp
+  8013c2:	89 e5                	mov    %esp,%ebp
+  8013c4:	53                   	push   %ebx
+  8013c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8013ce:	eb 09                	jmp    8013d9 <strncmp+0x18>
+  8013d0:	83 ea 01             	sub    $0x1,%edx
+  8013d3:	83 c0 01             	add    $0x1,%eax
+  8013d6:	83 c1 01             	add    $0x1,%ecx
+  8013d9:	85 d2                	test   %edx,%edx
+  8013db:	74 18                	je     8013f5 <strncmp+0x34>
+  8013dd:	0f b6 18             	movzbl (%eax),%ebx
+  8013e0:	84 db                	test   %bl,%bl
+  8013e2:	74 04                	je     8013e8 <strncmp+0x27>
+  8013e4:	3a 19                	cmp    (%ecx),%bl
+  8013e6:	74 e8                	je     8013d0 <strncmp+0xf>
+  8013e8:	0f b6 00             	movzbl (%eax),%eax
+  8013eb:	0f b6 11             	movzbl (%ecx),%edx
+  8013ee:	29 d0                	sub    %edx,%eax
+  8013f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013f3:	c9                   	leave
+  8013f4:	c3                   	ret
+  8013f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fa:	eb f4                	jmp    8013f0 <strncmp+0x2f>
+
+008013fc <strchr>:
+  8013fc:	55                   	push   %ebp
+  8013fd:	89 e5                	mov    %esp,%ebp
+  8013ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801402:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  801406:	eb 03                	jmp    80140b <strchr+0xf>
+  801408:	83 c0 01             	add    $0x1,%eax
+  80140b:	0f b6 10             	movzbl (%eax),%edx
+  80140e:	84 d2                	test   %dl,%dl
+  801410:	74 06                	je     801418 <strchr+0x1c>
+  801412:	38 ca                	cmp    %cl,%dl
+  801414:	75 f2                	jne    801408 <strchr+0xc>
+  801416:	eb 05                	jmp    80141d <strchr+0x21>
+  801418:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141d:	5d                   	pop    %ebp
+  80141e:	c3                   	ret
+
+0080141f <strfind>:
+  80141f:	55                   	push   %ebp
+  801420:	89 e5                	mov    %esp,%ebp
+  801422:	8b 45 08             	mov    0x8(%ebp),%eax
+  801425:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  801429:	0f b6 10             	movzbl (%eax),%edx
+  80142c:	38 ca                	cmp    %cl,%dl
+  80142e:	74 09                	je     801439 <strfind+0x1a>
+  801430:	84 d2                	test   %dl,%dl
+  801432:	74 05                	je     801439 <strfind+0x1a>
+  801434:	83 c0 01             	add    $0x1,%eax
+  801437:	eb f0                	jmp    801429 <strfind+0xa>
+  801439:	5d                   	pop    %ebp
+  80143a:	c3                   	ret
+
+0080143b <memset>:
+  80143b:	55                   	push   %ebp
+  80143c:	89 e5                	mov    %esp,%ebp
+  80143e:	57                   	push   %edi
+  80143f:	56                   	push   %esi
+  801440:	53                   	push   %ebx
+  801441:	83 ec 04             	sub    $0x4,%esp
+  801444:	8b 75 08             	mov    0x8(%ebp),%esi
+  801447:	8b 55 10             	mov    0x10(%ebp),%edx
+  80144a:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  80144e:	89 f7                	mov    %esi,%edi
+  801450:	83 fa 0f             	cmp    $0xf,%edx
+  801453:	76 24                	jbe    801479 <memset+0x3e>
+  801455:	89 f1                	mov    %esi,%ecx
+  801457:	f7 d9                	neg    %ecx
+  801459:	83 e1 03             	and    $0x3,%ecx
+  80145c:	29 ca                	sub    %ecx,%edx
+  80145e:	89 d0                	mov    %edx,%eax
+  801460:	c1 e8 02             	shr    $0x2,%eax
+  801463:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  801466:	83 e2 03             	and    $0x3,%edx
+  801469:	89 d8                	mov    %ebx,%eax
+  80146b:	fc                   	cld
+  80146c:	f3 aa                	rep stos %al,%es:(%edi)
+  80146e:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  801474:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  801477:	f3 ab                	rep stos %eax,%es:(%edi)
+  801479:	89 d1                	mov    %edx,%ecx
+  80147b:	89 d8                	mov    %ebx,%eax
+  80147d:	fc                   	cld
+  80147e:	f3 aa                	rep stos %al,%es:(%edi)
+  801480:	89 f0                	mov    %esi,%eax
+  801482:	83 c4 04             	add    $0x4,%esp
+  801485:	5b                   	pop    %ebx
+  801486:	5e                   	pop    %esi
+  801487:	5f                   	pop    %edi
+  801488:	5d                   	pop    %ebp
+  801489:	c3                   	ret
+
+0080148a <memmove>:
+  80148a:	55                   	push   %ebp
+  80148b:	89 e5                	mov    %esp,%ebp
+  80148d:	57                   	push   %edi
+  80148e:	56                   	push   %esi
+  80148f:	53                   	push   %ebx
+  801490:	83 ec 0c             	sub    $0xc,%esp
+  801493:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801496:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801499:	8b 45 10             	mov    0x10(%ebp),%eax
+  80149c:	85 c0                	test   %eax,%eax
+  80149e:	74 14                	je     8014b4 <memmove+0x2a>
+  8014a0:	39 da                	cmp    %ebx,%edx
+  8014a2:	73 07                	jae    8014ab <memmove+0x21>
+  8014a4:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8014a7:	39 cb                	cmp    %ecx,%ebx
+  8014a9:	72 13                	jb     8014be <memmove+0x34>
+  8014ab:	89 c1                	mov    %eax,%ecx
+  8014ad:	89 d8                	mov    %ebx,%eax
+  8014af:	e8 94 fd ff ff       	call   801248 <copy_fwd>
+  8014b4:	89 d8                	mov    %ebx,%eax
+  8014b6:	83 c4 0c             	add    $0xc,%esp
+  8014b9:	5b                   	pop    %ebx
+  8014ba:	5e                   	pop    %esi
+  8014bb:	5f                   	pop    %edi
+  8014bc:	5d                   	pop    %ebp
+  8014bd:	c3                   	ret
+  8014be:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  8014c1:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  8014c4:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  8014c7:	83 f8 0f             	cmp    $0xf,%eax
+  8014ca:	76 23                	jbe    8014ef <memmove+0x65>
+  8014cc:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  8014cf:	83 e1 03             	and    $0x3,%ecx
+  8014d2:	29 c8                	sub    %ecx,%eax
+  8014d4:	89 c2                	mov    %eax,%edx
+  8014d6:	c1 ea 02             	shr    $0x2,%edx
+  8014d9:	83 e0 03             	and    $0x3,%eax
+  8014dc:	fd                   	std
+  8014dd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014df:	83 ef 03             	sub    $0x3,%edi
+  8014e2:	83 ee 03             	sub    $0x3,%esi
+  8014e5:	89 d1                	mov    %edx,%ecx
+  8014e7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8014e9:	83 c7 03             	add    $0x3,%edi
+  8014ec:	83 c6 03             	add    $0x3,%esi
+  8014ef:	89 c1                	mov    %eax,%ecx
+  8014f1:	fd                   	std
+  8014f2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014f4:	fc                   	cld
+  8014f5:	eb bd                	jmp    8014b4 <memmove+0x2a>
+
+008014f7 <memcpy>:
+  8014f7:	55                   	push   %ebp
+  8014f8:	89 e5                	mov    %esp,%ebp
+  8014fa:	53                   	push   %ebx
+  8014fb:	83 ec 04             	sub    $0x4,%esp
+  8014fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801501:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801504:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801507:	89 d8                	mov    %ebx,%eax
+  801509:	e8 3a fd ff ff       	call   801248 <copy_fwd>
+  80150e:	89 d8                	mov    %ebx,%eax
+  801510:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801513:	c9                   	leave
+  801514:	c3                   	ret
+
+00801515 <page_copy>:
+  801515:	55                   	push   %ebp
+  801516:	89 e5                	mov    %esp,%ebp
+  801518:	57                   	push   %edi
+  801519:	56                   	push   %esi
+  80151a:	53                   	push   %ebx
+  80151b:	83 ec 0c             	sub    $0xc,%esp
+  80151e:	e8 5c fd ff ff       	call   80127f <have_sse2>
+  801523:	85 c0                	test   %eax,%eax
+  801525:	74 39                	je     801560 <page_copy+0x4b>
+  801527:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80152a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80152d:	be 00 01 00 00       	mov    $0x100,%esi
+  801532:	8b 03                	mov    (%ebx),%eax
+  801534:	8b 53 04             	mov    0x4(%ebx),%edx
+  801537:	0f c3 01             	movnti %eax,(%ecx)
+  80153a:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  80153e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801541:	8b 53 0c             	mov    0xc(%ebx),%edx
+  801544:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  801548:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  80154c:	83 c3 10             	add    $0x10,%ebx
+  80154f:	83 c1 10             	add    $0x10,%ecx
+  801552:	4e                   	dec    %esi
+  801553:	75 dd                	jne    801532 <page_copy+0x1d>
+  801555:	0f ae f8             	sfence
+  801558:	83 c4 0c             	add    $0xc,%esp
+  80155b:	5b                   	pop    %ebx
+  80155c:	5e                   	pop    %esi
+  80155d:	5f                   	pop    %edi
+  80155e:	5d                   	pop    %ebp
+  80155f:	c3                   	ret
+  801560:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801563:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801566:	b9 00 04 00 00       	mov    $0x400,%ecx
+  80156b:	fc                   	cld
+  80156c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80156e:	eb e8                	jmp    801558 <page_copy+0x43>
+
+00801570 <page_zero>:
+  801570:	55                   	push   %ebp
+  801571:	89 e5                	mov    %esp,%ebp
+  801573:	57                   	push   %edi
+  801574:	83 ec 04             	sub    $0x4,%esp
+  801577:	e8 03 fd ff ff       	call   80127f <have_sse2>
+  80157c:	85 c0                	test   %eax,%eax
+  80157e:	74 3a                	je     8015ba <page_zero+0x4a>
+  801580:	8b 45 08             	mov    0x8(%ebp),%eax
+  801583:	ba 80 00 00 00       	mov    $0x80,%edx
+  801588:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80158d:	0f c3 08             	movnti %ecx,(%eax)
+  801590:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  801594:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  801598:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  80159c:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  8015a0:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  8015a4:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  8015a8:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  8015ac:	83 c0 20             	add    $0x20,%eax
+  8015af:	4a                   	dec    %edx
+  8015b0:	75 db                	jne    80158d <page_zero+0x1d>
+  8015b2:	0f ae f8             	sfence
+  8015b5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8015b8:	c9                   	leave
+  8015b9:	c3                   	ret
+  8015ba:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015bd:	b9 00 04 00 00       	mov    $0x400,%ecx
+  8015c2:	fc                   	cld
+  8015c3:	f3 ab                	rep stos %eax,%es:(%edi)
+  8015c5:	eb ee                	jmp    8015b5 <page_zero+0x45>
+
+008015c7 <memcmp>:
+  8015c7:	55                   	push   %ebp
+  8015c8:	89 e5                	mov    %esp,%ebp
+  8015ca:	56                   	push   %esi
+  8015cb:	53                   	push   %ebx
+  8015cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015d2:	89 c6                	mov    %eax,%esi
+  8015d4:	03 75 10             	add    0x10(%ebp),%esi
+  8015d7:	eb 06                	jmp    8015df <memcmp+0x18>
+  8015d9:	83 c0 01             	add    $0x1,%eax
+  8015dc:	83 c2 01             	add    $0x1,%edx
+  8015df:	39 f0                	cmp    %esi,%eax
+  8015e1:	74 14                	je     8015f7 <memcmp+0x30>
+  8015e3:	0f b6 08             	movzbl (%eax),%ecx
+  8015e6:	0f b6 1a             	movzbl (%edx),%ebx
+  8015e9:	38 d9                	cmp    %bl,%cl
+  8015eb:	74 ec                	je     8015d9 <memcmp+0x12>
+  8015ed:	0f b6 c1             	movzbl %cl,%eax
+  8015f0:	0f b6 db             	movzbl %bl,%ebx
+  8015f3:	29 d8                	sub    %ebx,%eax
+  8015f5:	eb 05                	jmp    8015fc <memcmp+0x35>
+  8015f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fc:	5b                   	pop    %ebx
+  8015fd:	5e                   	pop    %esi
+  8015fe:	5d                   	pop    %ebp
+  8015ff:	c3                   	ret
+
+00801600 <memfind>:
+  801600:	55                   	push   %ebp
+  801601:	89 e5                	mov    %esp,%ebp
+  801603:	8b 45 08             	mov    0x8(%ebp),%eax
+  801606:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801609:	89 c2                	mov    %eax,%edx
+  80160b:	03 55 10             	add    0x10(%ebp),%edx
+  80160e:	eb 03                	jmp    801613 <memfind+0x13>
+  801610:	83 c0 01             	add    $0x1,%eax
+  801613:	39 d0                	cmp    %edx,%eax
+  801615:	73 04                	jae    80161b <memfind+0x1b>
+  801617:	38 08                	cmp    %cl,(%eax)
+  801619:	75 f5                	jne    801610 <memfind+0x10>
+  80161b:	5d                   	pop    %ebp
+  80161c:	c3                   	ret
+
+0080161d <strtol>:
+  80161d:	55                   	push   %ebp
+  80161e:	89 e5                	mov    %esp,%ebp
+  801620:	57                   	push   %edi
+  801621:	56                   	push   %esi
+  801622:	53                   	push   %ebx
+  801623:	8b 55 08             	mov    0x8(%ebp),%edx
+  801626:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801629:	eb 03                	jmp    80162e <strtol+0x11>
+  80162b:	83 c2 01             	add    $0x1,%edx
+  80162e:	0f b6 02             	movzbl (%edx),%eax
+  801631:	3c 20                	cmp    $0x20,%al
+  801633:	74 f6                	je     80162b <strtol+0xe>
+  801635:	3c 09                	cmp    $0x9,%al
+  801637:	74 f2                	je     80162b <strtol+0xe>
+  801639:	3c 2b                	cmp    $0x2b,%al
+  80163b:	74 2a                	je     801667 <strtol+0x4a>
+  80163d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801642:	3c 2d                	cmp    $0x2d,%al
+  801644:	74 2b                	je     801671 <strtol+0x54>
+  801646:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80164c:	75 0f                	jne    80165d <strtol+0x40>
+  80164e:	80 3a 30             	cmpb   $0x30,(%edx)
+  801651:	74 28                	je     80167b <strtol+0x5e>
+  801653:	85 db                	test   %ebx,%ebx
+  801655:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80165a:	0f 44 d8             	cmove  %eax,%ebx
+  80165d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801662:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801665:	eb 46                	jmp    8016ad <strtol+0x90>
+  801667:	83 c2 01             	add    $0x1,%edx
+  80166a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80166f:	eb d5                	jmp    801646 <strtol+0x29>
+  801671:	83 c2 01             	add    $0x1,%edx
+  801674:	bf 01 00 00 00       	mov    $0x1,%edi
+  801679:	eb cb                	jmp    801646 <strtol+0x29>
+  80167b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80167f:	74 0e                	je     80168f <strtol+0x72>
+  801681:	85 db                	test   %ebx,%ebx
+  801683:	75 d8                	jne    80165d <strtol+0x40>
+  801685:	83 c2 01             	add    $0x1,%edx
+  801688:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80168d:	eb ce                	jmp    80165d <strtol+0x40>
+  80168f:	83 c2 02             	add    $0x2,%edx
+  801692:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801697:	eb c4                	jmp    80165d <strtol+0x40>
+  801699:	0f be c0             	movsbl %al,%eax
+  80169c:	83 e8 30             	sub    $0x30,%eax
+  80169f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8016a2:	7d 3a                	jge    8016de <strtol+0xc1>
+  8016a4:	83 c2 01             	add    $0x1,%edx
+  8016a7:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8016ab:	01 c1                	add    %eax,%ecx
+  8016ad:	0f b6 02             	movzbl (%edx),%eax
+  8016b0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8016b3:	89 f3                	mov    %esi,%ebx
+  8016b5:	80 fb 09             	cmp    $0x9,%bl
+  8016b8:	76 df                	jbe    801699 <strtol+0x7c>
+  8016ba:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8016bd:	89 f3                	mov    %esi,%ebx
+  8016bf:	80 fb 19             	cmp    $0x19,%bl
+  8016c2:	77 08                	ja     8016cc <strtol+0xaf>
+  8016c4:	0f be c0             	movsbl %al,%eax
+  8016c7:	83 e8 57             	sub    $0x57,%eax
+  8016ca:	eb d3                	jmp    80169f <strtol+0x82>
+  8016cc:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8016cf:	89 f3                	mov    %esi,%ebx
+  8016d1:	80 fb 19             	cmp    $0x19,%bl
+  8016d4:	77 08                	ja     8016de <strtol+0xc1>
+  8016d6:	0f be c0             	movsbl %al,%eax
+  8016d9:	83 e8 37             	sub    $0x37,%eax
+  8016dc:	eb c1                	jmp    80169f <strtol+0x82>
+  8016de:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8016e2:	74 05                	je     8016e9 <strtol+0xcc>
+  8016e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016e7:	89 10                	mov    %edx,(%eax)
+  8016e9:	89 c8                	mov    %ecx,%eax
+  8016eb:	f7 d8                	neg    %eax
+  8016ed:	85 ff                	test   %edi,%edi
+  8016ef:	0f 45 c8             	cmovne %eax,%ecx
+  8016f2:	89 c8                	mov    %ecx,%eax
+  8016f4:	5b                   	pop    %ebx
+  8016f5:	5e                   	pop    %esi
+  8016f6:	5f                   	pop    %edi
+  8016f7:	5d                   	pop    %ebp
+  8016f8:	c3                   	ret
+
+008016f9 <__udivdi3>:
+  8016f9:	57                   	push   %edi
+  8016fa:	56                   	push   %esi
+  8016fb:	53                   	push   %ebx
+  8016fc:	83 ec 20             	sub    $0x20,%esp
+  8016ff:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801703:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801707:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80170b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80170f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801713:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801717:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80171b:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80171f:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801723:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801727:	89 d1                	mov    %edx,%ecx
+  801729:	09 c1                	or     %eax,%ecx
+  80172b:	0f 84 91 00 00 00    	je     8017c2 <__udivdi3+0xc9>
+  801731:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801738:	00 
+  801739:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801740:	00 
+  801741:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801746:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801750:	eb 08                	jmp    80175a <__udivdi3+0x61>
+  801752:	83 e9 01             	sub    $0x1,%ecx
+  801755:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801758:	74 68                	je     8017c2 <__udivdi3+0xc9>
+  80175a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80175e:	01 c0                	add    %eax,%eax
+  801760:	89 c6                	mov    %eax,%esi
+  801762:	89 d7                	mov    %edx,%edi
+  801764:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801768:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80176c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80176f:	d3 ea                	shr    %cl,%edx
+  801771:	f6 c1 20             	test   $0x20,%cl
+  801774:	74 04                	je     80177a <__udivdi3+0x81>
+  801776:	89 d0                	mov    %edx,%eax
+  801778:	31 d2                	xor    %edx,%edx
+  80177a:	83 e0 01             	and    $0x1,%eax
+  80177d:	89 04 24             	mov    %eax,(%esp)
+  801780:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801787:	00 
+  801788:	8b 04 24             	mov    (%esp),%eax
+  80178b:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80178f:	09 f0                	or     %esi,%eax
+  801791:	09 fa                	or     %edi,%edx
+  801793:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801797:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80179b:	39 f0                	cmp    %esi,%eax
+  80179d:	89 d3                	mov    %edx,%ebx
+  80179f:	19 fb                	sbb    %edi,%ebx
+  8017a1:	72 af                	jb     801752 <__udivdi3+0x59>
+  8017a3:	29 f0                	sub    %esi,%eax
+  8017a5:	19 fa                	sbb    %edi,%edx
+  8017a7:	89 cf                	mov    %ecx,%edi
+  8017a9:	c1 ef 05             	shr    $0x5,%edi
+  8017ac:	83 e7 01             	and    $0x1,%edi
+  8017af:	89 fe                	mov    %edi,%esi
+  8017b1:	83 f6 01             	xor    $0x1,%esi
+  8017b4:	d3 e6                	shl    %cl,%esi
+  8017b6:	d3 e7                	shl    %cl,%edi
+  8017b8:	09 74 24 18          	or     %esi,0x18(%esp)
+  8017bc:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8017c0:	eb 90                	jmp    801752 <__udivdi3+0x59>
+  8017c2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8017c6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8017ca:	83 c4 20             	add    $0x20,%esp
+  8017cd:	5b                   	pop    %ebx
+  8017ce:	5e                   	pop    %esi
+  8017cf:	5f                   	pop    %edi
+  8017d0:	c3                   	ret
+
+008017d1 <__umoddi3>:
+  8017d1:	55                   	push   %ebp
+  8017d2:	57                   	push   %edi
+  8017d3:	56                   	push   %esi
+  8017d4:	53                   	push   %ebx
+  8017d5:	83 ec 1c             	sub    $0x1c,%esp
+  8017d8:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8017dc:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8017e0:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8017e4:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8017e8:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8017ec:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8017f0:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8017f4:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8017f8:	89 d6                	mov    %edx,%esi
+  8017fa:	09 c6                	or     %eax,%esi
+  8017fc:	74 6c                	je     80186a <__umoddi3+0x99>
+  8017fe:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801803:	b8 00 00 00 00       	mov    $0x0,%eax
+  801808:	ba 00 00 00 00       	mov    $0x0,%edx
+  80180d:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801811:	eb 0e                	jmp    801821 <__umoddi3+0x50>
+  801813:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801818:	8b 74 24 04          	mov    0x4(%esp),%esi
+  80181c:	83 fe ff             	cmp    $0xffffffff,%esi
+  80181f:	74 49                	je     80186a <__umoddi3+0x99>
+  801821:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801825:	01 c0                	add    %eax,%eax
+  801827:	89 c3                	mov    %eax,%ebx
+  801829:	89 d6                	mov    %edx,%esi
+  80182b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80182f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801833:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801838:	0f ad d0             	shrd   %cl,%edx,%eax
+  80183b:	d3 ea                	shr    %cl,%edx
+  80183d:	f6 c1 20             	test   $0x20,%cl
+  801840:	74 04                	je     801846 <__umoddi3+0x75>
+  801842:	89 d0                	mov    %edx,%eax
+  801844:	31 d2                	xor    %edx,%edx
+  801846:	83 e0 01             	and    $0x1,%eax
+  801849:	bd 00 00 00 00       	mov    $0x0,%ebp
+  80184e:	89 ea                	mov    %ebp,%edx
+  801850:	09 d8                	or     %ebx,%eax
+  801852:	09 f2                	or     %esi,%edx
+  801854:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801858:	8b 74 24 14          	mov    0x14(%esp),%esi
+  80185c:	39 d8                	cmp    %ebx,%eax
+  80185e:	89 d1                	mov    %edx,%ecx
+  801860:	19 f1                	sbb    %esi,%ecx
+  801862:	72 af                	jb     801813 <__umoddi3+0x42>
+  801864:	29 d8                	sub    %ebx,%eax
+  801866:	19 f2                	sbb    %esi,%edx
+  801868:	eb a9                	jmp    801813 <__umoddi3+0x42>
+  80186a:	83 c4 1c             	add    $0x1c,%esp
+  80186d:	5b                   	pop    %ebx
+  80186e:	5e                   	pop    %esi
+  80186f:	5f                   	pop    %edi
+  801870:	5d                   	pop    %ebp
+  801871:	c3                   	ret
+
+00801872 <__divdi3>:
+  801872:	53                   	push   %ebx
+  801873:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801877:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80187b:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80187f:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801883:	85 d2                	test   %edx,%edx
+  801885:	78 12                	js     801899 <__divdi3+0x27>
+  801887:	85 db                	test   %ebx,%ebx
+  801889:	78 2e                	js     8018b9 <__divdi3+0x47>
+  80188b:	53                   	push   %ebx
+  80188c:	51                   	push   %ecx
+  80188d:	52                   	push   %edx
+  80188e:	50                   	push   %eax
+  80188f:	e8 65 fe ff ff       	call   8016f9 <__udivdi3>
+  801894:	83 c4 10             	add    $0x10,%esp
+  801897:	eb 1e                	jmp    8018b7 <__divdi3+0x45>
+  801899:	f7 d8                	neg    %eax
+  80189b:	83 d2 00             	adc    $0x0,%edx
+  80189e:	f7 da                	neg    %edx
+  8018a0:	85 db                	test   %ebx,%ebx
+  8018a2:	78 2a                	js     8018ce <__divdi3+0x5c>
+  8018a4:	53                   	push   %ebx
+  8018a5:	51                   	push   %ecx
+  8018a6:	52                   	push   %edx
+  8018a7:	50                   	push   %eax
+  8018a8:	e8 4c fe ff ff       	call   8016f9 <__udivdi3>
+  8018ad:	83 c4 10             	add    $0x10,%esp
+  8018b0:	f7 d8                	neg    %eax
+  8018b2:	83 d2 00             	adc    $0x0,%edx
+  8018b5:	f7 da                	neg    %edx
+  8018b7:	5b                   	pop    %ebx
+  8018b8:	c3                   	ret
+  8018b9:	f7 d9                	neg    %ecx
+  8018bb:	83 d3 00             	adc    $0x0,%ebx
+  8018be:	f7 db                	neg    %ebx
+  8018c0:	53                   	push   %ebx
+  8018c1:	51                   	push   %ecx
+  8018c2:	52                   	push   %edx
+  8018c3:	50                   	push   %eax
+  8018c4:	e8 30 fe ff ff       	call   8016f9 <__udivdi3>
+  8018c9:	83 c4 10             	add    $0x10,%esp
+  8018cc:	eb e2                	jmp    8018b0 <__divdi3+0x3e>
+  8018ce:	f7 d9                	neg    %ecx
+  8018d0:	83 d3 00             	adc    $0x0,%ebx
+  8018d3:	f7 db                	neg    %ebx
+  8018d5:	53                   	push   %ebx
+  8018d6:	51                   	push   %ecx
+  8018d7:	52                   	push   %edx
+  8018d8:	50                   	push   %eax
+  8018d9:	e8 1b fe ff ff       	call   8016f9 <__udivdi3>
+  8018de:	83 c4 10             	add    $0x10,%esp
+  8018e1:	eb d4                	jmp    8018b7 <__divdi3+0x45>
+
+008018e3 <__moddi3>:
+  8018e3:	55                   	push   %ebp
+  8018e4:	57                   	push   %edi
+  8018e5:	56                   	push   %esi
+  8018e6:	53                   	push   %ebx
+  8018e7:	83 ec 14             	sub    $0x14,%esp
+  8018ea:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  8018ee:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  8018f2:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8018f6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8018fa:	85 ed                	test   %ebp,%ebp
+  8018fc:	78 2b                	js     801929 <__moddi3+0x46>
+  8018fe:	89 c6                	mov    %eax,%esi
+  801900:	f7 de                	neg    %esi
+  801902:	89 34 24             	mov    %esi,(%esp)
+  801905:	89 d6                	mov    %edx,%esi
+  801907:	83 d6 00             	adc    $0x0,%esi
+  80190a:	f7 de                	neg    %esi
+  80190c:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801910:	8b 34 24             	mov    (%esp),%esi
+  801913:	0f 48 f0             	cmovs  %eax,%esi
+  801916:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  80191b:	52                   	push   %edx
+  80191c:	56                   	push   %esi
+  80191d:	55                   	push   %ebp
+  80191e:	57                   	push   %edi
+  80191f:	e8 ad fe ff ff       	call   8017d1 <__umoddi3>
+  801924:	83 c4 10             	add    $0x10,%esp
+  801927:	eb 3c                	jmp    801965 <__moddi3+0x82>
+  801929:	89 c3                	mov    %eax,%ebx
+  80192b:	f7 db                	neg    %ebx
+  80192d:	89 d1                	mov    %edx,%ecx
+  80192f:	83 d1 00             	adc    $0x0,%ecx
+  801932:	f7 d9                	neg    %ecx
+  801934:	0f 49 c3             	cmovns %ebx,%eax
+  801937:	89 04 24             	mov    %eax,(%esp)
+  80193a:	0f 49 d1             	cmovns %ecx,%edx
+  80193d:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801941:	ff 74 24 04          	push   0x4(%esp)
+  801945:	ff 74 24 04          	push   0x4(%esp)
+  801949:	89 f8                	mov    %edi,%eax
+  80194b:	89 ea                	mov    %ebp,%edx
+  80194d:	f7 d8                	neg    %eax
+  80194f:	83 d2 00             	adc    $0x0,%edx
+  801952:	f7 da                	neg    %edx
+  801954:	52                   	push   %edx
+  801955:	50                   	push   %eax
+  801956:	e8 76 fe ff ff       	call   8017d1 <__umoddi3>
+  80195b:	83 c4 10             	add    $0x10,%esp
+  80195e:	f7 d8                	neg    %eax
+  801960:	83 d2 00             	adc    $0x0,%edx
+  801963:	f7 da                	neg    %edx
+  801965:	83 c4 14             	add    $0x14,%esp
+  801968:	5b                   	pop    %ebx
+  801969:	5e                   	pop    %esi
+  80196a:	5f                   	pop    %edi
+  80196b:	5d                   	pop    %ebp
+  80196c:	c3                   	ret
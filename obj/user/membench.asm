@@ -0,0 +1,2880 @@
+
+obj/user/membench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 fb 03 00 00       	call   80042c <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 20             	sub    $0x20,%esp
+  80003c:	68 00 20 00 00       	push   $0x2000
+  800041:	6a 5a                	push   $0x5a
+  800043:	68 00 60 80 00       	push   $0x806000
+  800048:	e8 7d 0c 00 00       	call   800cca <memset>
+  80004d:	83 c4 0c             	add    $0xc,%esp
+  800050:	68 00 20 00 00       	push   $0x2000
+  800055:	6a 00                	push   $0x0
+  800057:	68 00 40 80 00       	push   $0x804000
+  80005c:	e8 69 0c 00 00       	call   800cca <memset>
+  800061:	83 c4 08             	add    $0x8,%esp
+  800064:	68 00 01 00 00       	push   $0x100
+  800069:	68 60 1d 80 00       	push   $0x801d60
+  80006e:	e8 b1 04 00 00       	call   800524 <cprintf>
+  800073:	83 c4 08             	add    $0x8,%esp
+  800076:	68 00 10 00 00       	push   $0x1000
+  80007b:	68 79 1d 80 00       	push   $0x801d79
+  800080:	e8 9f 04 00 00       	call   800524 <cprintf>
+  800085:	0f 31                	rdtsc
+  800087:	89 c1                	mov    %eax,%ecx
+  800089:	89 d3                	mov    %edx,%ebx
+  80008b:	83 c4 10             	add    $0x10,%esp
+  80008e:	bf 01 01 00 00       	mov    $0x101,%edi
+  800093:	eb 2b                	jmp    8000c0 <umain+0x8d>
+  800095:	ba 00 40 80 00       	mov    $0x804000,%edx
+  80009a:	b8 00 60 80 00       	mov    $0x806000,%eax
+  80009f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8000a2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8000a5:	83 c0 01             	add    $0x1,%eax
+  8000a8:	89 d6                	mov    %edx,%esi
+  8000aa:	83 c2 01             	add    $0x1,%edx
+  8000ad:	0f b6 48 ff          	movzbl -0x1(%eax),%ecx
+  8000b1:	88 0e                	mov    %cl,(%esi)
+  8000b3:	3d 00 70 80 00       	cmp    $0x807000,%eax
+  8000b8:	75 eb                	jne    8000a5 <umain+0x72>
+  8000ba:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8000bd:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8000c0:	83 ef 01             	sub    $0x1,%edi
+  8000c3:	75 d0                	jne    800095 <umain+0x62>
+  8000c5:	0f 31                	rdtsc
+  8000c7:	83 ec 04             	sub    $0x4,%esp
+  8000ca:	29 c8                	sub    %ecx,%eax
+  8000cc:	19 da                	sbb    %ebx,%edx
+  8000ce:	0f ac d0 08          	shrd   $0x8,%edx,%eax
+  8000d2:	c1 ea 08             	shr    $0x8,%edx
+  8000d5:	50                   	push   %eax
+  8000d6:	68 90 1d 80 00       	push   $0x801d90
+  8000db:	68 9a 1d 80 00       	push   $0x801d9a
+  8000e0:	e8 3f 04 00 00       	call   800524 <cprintf>
+  8000e5:	0f 31                	rdtsc
+  8000e7:	89 c6                	mov    %eax,%esi
+  8000e9:	89 d7                	mov    %edx,%edi
+  8000eb:	83 c4 10             	add    $0x10,%esp
+  8000ee:	bb 01 01 00 00       	mov    $0x101,%ebx
+  8000f3:	eb 1a                	jmp    80010f <umain+0xdc>
+  8000f5:	83 ec 04             	sub    $0x4,%esp
+  8000f8:	68 00 10 00 00       	push   $0x1000
+  8000fd:	68 00 60 80 00       	push   $0x806000
+  800102:	68 00 40 80 00       	push   $0x804000
+  800107:	e8 7a 0c 00 00       	call   800d86 <memcpy>
+  80010c:	83 c4 10             	add    $0x10,%esp
+  80010f:	83 eb 01             	sub    $0x1,%ebx
+  800112:	75 e1                	jne    8000f5 <umain+0xc2>
+  800114:	0f 31                	rdtsc
+  800116:	83 ec 04             	sub    $0x4,%esp
+  800119:	29 f0                	sub    %esi,%eax
+  80011b:	19 fa                	sbb    %edi,%edx
+  80011d:	0f ac d0 08          	shrd   $0x8,%edx,%eax
+  800121:	c1 ea 08             	shr    $0x8,%edx
+  800124:	50                   	push   %eax
+  800125:	68 b1 1d 80 00       	push   $0x801db1
+  80012a:	68 9a 1d 80 00       	push   $0x801d9a
+  80012f:	e8 f0 03 00 00       	call   800524 <cprintf>
+  800134:	0f 31                	rdtsc
+  800136:	89 c6                	mov    %eax,%esi
+  800138:	89 d7                	mov    %edx,%edi
+  80013a:	83 c4 10             	add    $0x10,%esp
+  80013d:	bb 01 01 00 00       	mov    $0x101,%ebx
+  800142:	eb 15                	jmp    800159 <umain+0x126>
+  800144:	83 ec 08             	sub    $0x8,%esp
+  800147:	68 00 60 80 00       	push   $0x806000
+  80014c:	68 00 40 80 00       	push   $0x804000
+  800151:	e8 4e 0c 00 00       	call   800da4 <page_copy>
+  800156:	83 c4 10             	add    $0x10,%esp
+  800159:	83 eb 01             	sub    $0x1,%ebx
+  80015c:	75 e6                	jne    800144 <umain+0x111>
+  80015e:	0f 31                	rdtsc
+  800160:	83 ec 04             	sub    $0x4,%esp
+  800163:	29 f0                	sub    %esi,%eax
+  800165:	19 fa                	sbb    %edi,%edx
+  800167:	0f ac d0 08          	shrd   $0x8,%edx,%eax
+  80016b:	c1 ea 08             	shr    $0x8,%edx
+  80016e:	50                   	push   %eax
+  80016f:	68 b8 1d 80 00       	push   $0x801db8
+  800174:	68 9a 1d 80 00       	push   $0x801d9a
+  800179:	e8 a6 03 00 00       	call   800524 <cprintf>
+  80017e:	83 c4 08             	add    $0x8,%esp
+  800181:	68 00 10 00 00       	push   $0x1000
+  800186:	68 c2 1d 80 00       	push   $0x801dc2
+  80018b:	e8 94 03 00 00       	call   800524 <cprintf>
+  800190:	0f 31                	rdtsc
+  800192:	89 c6                	mov    %eax,%esi
+  800194:	89 d7                	mov    %edx,%edi
+  800196:	83 c4 10             	add    $0x10,%esp
+  800199:	bb 01 01 00 00       	mov    $0x101,%ebx
+  80019e:	eb 17                	jmp    8001b7 <umain+0x184>
+  8001a0:	83 ec 04             	sub    $0x4,%esp
+  8001a3:	68 00 10 00 00       	push   $0x1000
+  8001a8:	6a 00                	push   $0x0
+  8001aa:	68 00 40 80 00       	push   $0x804000
+  8001af:	e8 16 0b 00 00       	call   800cca <memset>
+  8001b4:	83 c4 10             	add    $0x10,%esp
+  8001b7:	83 eb 01             	sub    $0x1,%ebx
+  8001ba:	75 e4                	jne    8001a0 <umain+0x16d>
+  8001bc:	0f 31                	rdtsc
+  8001be:	83 ec 04             	sub    $0x4,%esp
+  8001c1:	29 f0                	sub    %esi,%eax
+  8001c3:	19 fa                	sbb    %edi,%edx
+  8001c5:	0f ac d0 08          	shrd   $0x8,%edx,%eax
+  8001c9:	c1 ea 08             	shr    $0x8,%edx
+  8001cc:	50                   	push   %eax
+  8001cd:	68 d9 1d 80 00       	push   $0x801dd9
+  8001d2:	68 9a 1d 80 00       	push   $0x801d9a
+  8001d7:	e8 48 03 00 00       	call   800524 <cprintf>
+  8001dc:	0f 31                	rdtsc
+  8001de:	89 c6                	mov    %eax,%esi
+  8001e0:	89 d7                	mov    %edx,%edi
+  8001e2:	83 c4 10             	add    $0x10,%esp
+  8001e5:	bb 01 01 00 00       	mov    $0x101,%ebx
+  8001ea:	eb 10                	jmp    8001fc <umain+0x1c9>
+  8001ec:	83 ec 0c             	sub    $0xc,%esp
+  8001ef:	68 00 40 80 00       	push   $0x804000
+  8001f4:	e8 06 0c 00 00       	call   800dff <page_zero>
+  8001f9:	83 c4 10             	add    $0x10,%esp
+  8001fc:	83 eb 01             	sub    $0x1,%ebx
+  8001ff:	75 eb                	jne    8001ec <umain+0x1b9>
+  800201:	0f 31                	rdtsc
+  800203:	83 ec 04             	sub    $0x4,%esp
+  800206:	29 f0                	sub    %esi,%eax
+  800208:	19 fa                	sbb    %edi,%edx
+  80020a:	0f ac d0 08          	shrd   $0x8,%edx,%eax
+  80020e:	c1 ea 08             	shr    $0x8,%edx
+  800211:	50                   	push   %eax
+  800212:	68 e0 1d 80 00       	push   $0x801de0
+  800217:	68 9a 1d 80 00       	push   $0x801d9a
+  80021c:	e8 03 03 00 00       	call   800524 <cprintf>
+  800221:	83 c4 08             	add    $0x8,%esp
+  800224:	68 f9 0f 00 00       	push   $0xff9
+  800229:	68 10 1e 80 00       	push   $0x801e10
+  80022e:	e8 f1 02 00 00       	call   800524 <cprintf>
+  800233:	0f 31                	rdtsc
+  800235:	89 c1                	mov    %eax,%ecx
+  800237:	89 d3                	mov    %edx,%ebx
+  800239:	83 c4 10             	add    $0x10,%esp
+  80023c:	bf 01 01 00 00       	mov    $0x101,%edi
+  800241:	eb 2b                	jmp    80026e <umain+0x23b>
+  800243:	ba 01 40 80 00       	mov    $0x804001,%edx
+  800248:	b8 03 60 80 00       	mov    $0x806003,%eax
+  80024d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800250:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800253:	83 c0 01             	add    $0x1,%eax
+  800256:	89 d6                	mov    %edx,%esi
+  800258:	83 c2 01             	add    $0x1,%edx
+  80025b:	0f b6 58 ff          	movzbl -0x1(%eax),%ebx
+  80025f:	88 1e                	mov    %bl,(%esi)
+  800261:	3d fc 6f 80 00       	cmp    $0x806ffc,%eax
+  800266:	75 eb                	jne    800253 <umain+0x220>
+  800268:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80026b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80026e:	83 ef 01             	sub    $0x1,%edi
+  800271:	75 d0                	jne    800243 <umain+0x210>
+  800273:	0f 31                	rdtsc
+  800275:	83 ec 04             	sub    $0x4,%esp
+  800278:	29 c8                	sub    %ecx,%eax
+  80027a:	19 da                	sbb    %ebx,%edx
+  80027c:	0f ac d0 08          	shrd   $0x8,%edx,%eax
+  800280:	c1 ea 08             	shr    $0x8,%edx
+  800283:	50                   	push   %eax
+  800284:	68 90 1d 80 00       	push   $0x801d90
+  800289:	68 9a 1d 80 00       	push   $0x801d9a
+  80028e:	e8 91 02 00 00       	call   800524 <cprintf>
+  800293:	0f 31                	rdtsc
+  800295:	89 c6                	mov    %eax,%esi
+  800297:	89 d7                	mov    %edx,%edi
+  800299:	83 c4 10             	add    $0x10,%esp
+  80029c:	bb 01 01 00 00       	mov    $0x101,%ebx
+  8002a1:	eb 1a                	jmp    8002bd <umain+0x28a>
+  8002a3:	83 ec 04             	sub    $0x4,%esp
+  8002a6:	68 f9 0f 00 00       	push   $0xff9
+  8002ab:	68 03 60 80 00       	push   $0x806003
+  8002b0:	68 01 40 80 00       	push   $0x804001
+  8002b5:	e8 cc 0a 00 00       	call   800d86 <memcpy>
+  8002ba:	83 c4 10             	add    $0x10,%esp
+  8002bd:	83 eb 01             	sub    $0x1,%ebx
+  8002c0:	75 e1                	jne    8002a3 <umain+0x270>
+  8002c2:	0f 31                	rdtsc
+  8002c4:	83 ec 04             	sub    $0x4,%esp
+  8002c7:	29 f0                	sub    %esi,%eax
+  8002c9:	19 fa                	sbb    %edi,%edx
+  8002cb:	0f ac d0 08          	shrd   $0x8,%edx,%eax
+  8002cf:	c1 ea 08             	shr    $0x8,%edx
+  8002d2:	50                   	push   %eax
+  8002d3:	68 b1 1d 80 00       	push   $0x801db1
+  8002d8:	68 9a 1d 80 00       	push   $0x801d9a
+  8002dd:	e8 42 02 00 00       	call   800524 <cprintf>
+  8002e2:	0f 31                	rdtsc
+  8002e4:	89 c6                	mov    %eax,%esi
+  8002e6:	89 d7                	mov    %edx,%edi
+  8002e8:	83 c4 10             	add    $0x10,%esp
+  8002eb:	bb 01 01 00 00       	mov    $0x101,%ebx
+  8002f0:	eb 1a                	jmp    80030c <umain+0x2d9>
+  8002f2:	83 ec 04             	sub    $0x4,%esp
+  8002f5:	68 f9 0f 00 00       	push   $0xff9
+  8002fa:	68 00 40 80 00       	push   $0x804000
+  8002ff:	68 01 40 80 00       	push   $0x804001
+  800304:	e8 10 0a 00 00       	call   800d19 <memmove>
+  800309:	83 c4 10             	add    $0x10,%esp
+  80030c:	83 eb 01             	sub    $0x1,%ebx
+  80030f:	75 e1                	jne    8002f2 <umain+0x2bf>
+  800311:	0f 31                	rdtsc
+  800313:	83 ec 04             	sub    $0x4,%esp
+  800316:	29 f0                	sub    %esi,%eax
+  800318:	19 fa                	sbb    %edi,%edx
+  80031a:	0f ac d0 08          	shrd   $0x8,%edx,%eax
+  80031e:	c1 ea 08             	shr    $0x8,%edx
+  800321:	50                   	push   %eax
+  800322:	68 ea 1d 80 00       	push   $0x801dea
+  800327:	68 9a 1d 80 00       	push   $0x801d9a
+  80032c:	e8 f3 01 00 00       	call   800524 <cprintf>
+  800331:	0f 31                	rdtsc
+  800333:	89 c6                	mov    %eax,%esi
+  800335:	89 d7                	mov    %edx,%edi
+  800337:	83 c4 10             	add    $0x10,%esp
+  80033a:	bb 01 01 00 00       	mov    $0x101,%ebx
+  80033f:	eb 1a                	jmp    80035b <umain+0x328>
+  800341:	83 ec 04             	sub    $0x4,%esp
+  800344:	68 f9 0f 00 00       	push   $0xff9
+  800349:	68 a5 00 00 00       	push   $0xa5
+  80034e:	68 01 40 80 00       	push   $0x804001
+  800353:	e8 72 09 00 00       	call   800cca <memset>
+  800358:	83 c4 10             	add    $0x10,%esp
+  80035b:	83 eb 01             	sub    $0x1,%ebx
+  80035e:	75 e1                	jne    800341 <umain+0x30e>
+  800360:	0f 31                	rdtsc
+  800362:	83 ec 04             	sub    $0x4,%esp
+  800365:	29 f0                	sub    %esi,%eax
+  800367:	19 fa                	sbb    %edi,%edx
+  800369:	0f ac d0 08          	shrd   $0x8,%edx,%eax
+  80036d:	c1 ea 08             	shr    $0x8,%edx
+  800370:	50                   	push   %eax
+  800371:	68 d9 1d 80 00       	push   $0x801dd9
+  800376:	68 9a 1d 80 00       	push   $0x801d9a
+  80037b:	e8 a4 01 00 00       	call   800524 <cprintf>
+  800380:	c7 04 24 fc 1d 80 00 	movl   $0x801dfc,(%esp)
+  800387:	e8 98 01 00 00       	call   800524 <cprintf>
+  80038c:	0f 31                	rdtsc
+  80038e:	89 c6                	mov    %eax,%esi
+  800390:	89 d7                	mov    %edx,%edi
+  800392:	83 c4 10             	add    $0x10,%esp
+  800395:	bb 01 01 00 00       	mov    $0x101,%ebx
+  80039a:	eb 17                	jmp    8003b3 <umain+0x380>
+  80039c:	83 ec 04             	sub    $0x4,%esp
+  80039f:	6a 25                	push   $0x25
+  8003a1:	68 02 60 80 00       	push   $0x806002
+  8003a6:	68 05 40 80 00       	push   $0x804005
+  8003ab:	e8 d6 09 00 00       	call   800d86 <memcpy>
+  8003b0:	83 c4 10             	add    $0x10,%esp
+  8003b3:	83 eb 01             	sub    $0x1,%ebx
+  8003b6:	75 e4                	jne    80039c <umain+0x369>
+  8003b8:	0f 31                	rdtsc
+  8003ba:	83 ec 04             	sub    $0x4,%esp
+  8003bd:	29 f0                	sub    %esi,%eax
+  8003bf:	19 fa                	sbb    %edi,%edx
+  8003c1:	0f ac d0 08          	shrd   $0x8,%edx,%eax
+  8003c5:	c1 ea 08             	shr    $0x8,%edx
+  8003c8:	50                   	push   %eax
+  8003c9:	68 b1 1d 80 00       	push   $0x801db1
+  8003ce:	68 9a 1d 80 00       	push   $0x801d9a
+  8003d3:	e8 4c 01 00 00       	call   800524 <cprintf>
+  8003d8:	0f 31                	rdtsc
+  8003da:	89 c6                	mov    %eax,%esi
+  8003dc:	89 d7                	mov    %edx,%edi
+  8003de:	83 c4 10             	add    $0x10,%esp
+  8003e1:	bb 01 01 00 00       	mov    $0x101,%ebx
+  8003e6:	eb 14                	jmp    8003fc <umain+0x3c9>
+  8003e8:	83 ec 04             	sub    $0x4,%esp
+  8003eb:	6a 25                	push   $0x25
+  8003ed:	6a 00                	push   $0x0
+  8003ef:	68 05 40 80 00       	push   $0x804005
+  8003f4:	e8 d1 08 00 00       	call   800cca <memset>
+  8003f9:	83 c4 10             	add    $0x10,%esp
+  8003fc:	83 eb 01             	sub    $0x1,%ebx
+  8003ff:	75 e7                	jne    8003e8 <umain+0x3b5>
+  800401:	0f 31                	rdtsc
+  800403:	83 ec 04             	sub    $0x4,%esp
+  800406:	29 f0                	sub    %esi,%eax
+  800408:	19 fa                	sbb    %edi,%edx
+  80040a:	0f ac d0 08          	shrd   $0x8,%edx,%eax
+  80040e:	c1 ea 08             	shr    $0x8,%edx
+  800411:	50                   	push   %eax
+  800412:	68 d9 1d 80 00       	push   $0x801dd9
+  800417:	68 9a 1d 80 00       	push   $0x801d9a
+  80041c:	e8 03 01 00 00       	call   800524 <cprintf>
+  800421:	83 c4 10             	add    $0x10,%esp
+  800424:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800427:	5b                   	pop    %ebx
+  800428:	5e                   	pop    %esi
+  800429:	5f                   	pop    %edi
+  80042a:	5d                   	pop    %ebp
+  80042b:	c3                   	ret
+
+0080042c <libmain>:
+  80042c:	55                   	push   %ebp
+  80042d:	89 e5                	mov    %esp,%ebp
+  80042f:	56                   	push   %esi
+  800430:	53                   	push   %ebx
+  800431:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800434:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800437:	e8 c4 14 00 00       	call   801900 <uinfo_envid>
+  80043c:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  800441:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  800447:	05 00 00 00 ed       	add    $0xed000000,%eax
+  80044c:	a3 00 80 80 00       	mov    %eax,0x808000
+  800451:	85 db                	test   %ebx,%ebx
+  800453:	7e 07                	jle    80045c <libmain+0x30>
+  800455:	8b 06                	mov    (%esi),%eax
+  800457:	a3 00 30 80 00       	mov    %eax,0x803000
+  80045c:	83 ec 08             	sub    $0x8,%esp
+  80045f:	56                   	push   %esi
+  800460:	53                   	push   %ebx
+  800461:	e8 cd fb ff ff       	call   800033 <umain>
+  800466:	e8 0a 00 00 00       	call   800475 <exit>
+  80046b:	83 c4 10             	add    $0x10,%esp
+  80046e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800471:	5b                   	pop    %ebx
+  800472:	5e                   	pop    %esi
+  800473:	5d                   	pop    %ebp
+  800474:	c3                   	ret
+
+00800475 <exit>:
+  800475:	55                   	push   %ebp
+  800476:	89 e5                	mov    %esp,%ebp
+  800478:	83 ec 08             	sub    $0x8,%esp
+  80047b:	e8 19 15 00 00       	call   801999 <bflush>
+  800480:	83 ec 0c             	sub    $0xc,%esp
+  800483:	6a 00                	push   $0x0
+  800485:	e8 cc 0b 00 00       	call   801056 <sys_env_destroy>
+  80048a:	83 c4 10             	add    $0x10,%esp
+  80048d:	c9                   	leave
+  80048e:	c3                   	ret
+
+0080048f <putch>:
+  80048f:	55                   	push   %ebp
+  800490:	89 e5                	mov    %esp,%ebp
+  800492:	53                   	push   %ebx
+  800493:	83 ec 04             	sub    $0x4,%esp
+  800496:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800499:	8b 13                	mov    (%ebx),%edx
+  80049b:	8d 42 01             	lea    0x1(%edx),%eax
+  80049e:	89 03                	mov    %eax,(%ebx)
+  8004a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8004a3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8004a7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8004ac:	74 09                	je     8004b7 <putch+0x28>
+  8004ae:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8004b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8004b5:	c9                   	leave
+  8004b6:	c3                   	ret
+  8004b7:	83 ec 08             	sub    $0x8,%esp
+  8004ba:	68 ff 00 00 00       	push   $0xff
+  8004bf:	8d 43 08             	lea    0x8(%ebx),%eax
+  8004c2:	50                   	push   %eax
+  8004c3:	e8 c0 0a 00 00       	call   800f88 <sys_cputs>
+  8004c8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004ce:	83 c4 10             	add    $0x10,%esp
+  8004d1:	eb db                	jmp    8004ae <putch+0x1f>
+
+008004d3 <vcprintf>:
+  8004d3:	55                   	push   %ebp
+  8004d4:	89 e5                	mov    %esp,%ebp
+  8004d6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8004dc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004e3:	00 00 00 
+  8004e6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004ed:	00 00 00 
+  8004f0:	ff 75 0c             	push   0xc(%ebp)
+  8004f3:	ff 75 08             	push   0x8(%ebp)
+  8004f6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004fc:	50                   	push   %eax
+  8004fd:	68 8f 04 80 00       	push   $0x80048f
+  800502:	e8 14 01 00 00       	call   80061b <vprintfmt>
+  800507:	83 c4 08             	add    $0x8,%esp
+  80050a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800510:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800516:	50                   	push   %eax
+  800517:	e8 6c 0a 00 00       	call   800f88 <sys_cputs>
+  80051c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800522:	c9                   	leave
+  800523:	c3                   	ret
+
+00800524 <cprintf>:
+  800524:	55                   	push   %ebp
+  800525:	89 e5                	mov    %esp,%ebp
+  800527:	83 ec 10             	sub    $0x10,%esp
+  80052a:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80052d:	50                   	push   %eax
+  80052e:	ff 75 08             	push   0x8(%ebp)
+  800531:	e8 9d ff ff ff       	call   8004d3 <vcprintf>
+  800536:	c9                   	leave
+  800537:	c3                   	ret
+
+00800538 <printnum>:
+  800538:	55                   	push   %ebp
+  800539:	89 e5                	mov    %esp,%ebp
+  80053b:	57                   	push   %edi
+  80053c:	56                   	push   %esi
+  80053d:	53                   	push   %ebx
+  80053e:	83 ec 1c             	sub    $0x1c,%esp
+  800541:	89 c7                	mov    %eax,%edi
+  800543:	89 d6                	mov    %edx,%esi
+  800545:	8b 45 08             	mov    0x8(%ebp),%eax
+  800548:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80054b:	89 d1                	mov    %edx,%ecx
+  80054d:	89 c2                	mov    %eax,%edx
+  80054f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800552:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800555:	8b 45 10             	mov    0x10(%ebp),%eax
+  800558:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80055b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80055e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800565:	39 c2                	cmp    %eax,%edx
+  800567:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80056a:	72 3e                	jb     8005aa <printnum+0x72>
+  80056c:	83 ec 0c             	sub    $0xc,%esp
+  80056f:	ff 75 18             	push   0x18(%ebp)
+  800572:	83 eb 01             	sub    $0x1,%ebx
+  800575:	53                   	push   %ebx
+  800576:	50                   	push   %eax
+  800577:	83 ec 08             	sub    $0x8,%esp
+  80057a:	ff 75 e4             	push   -0x1c(%ebp)
+  80057d:	ff 75 e0             	push   -0x20(%ebp)
+  800580:	ff 75 dc             	push   -0x24(%ebp)
+  800583:	ff 75 d8             	push   -0x28(%ebp)
+  800586:	e8 50 15 00 00       	call   801adb <__udivdi3>
+  80058b:	83 c4 18             	add    $0x18,%esp
+  80058e:	52                   	push   %edx
+  80058f:	50                   	push   %eax
+  800590:	89 f2                	mov    %esi,%edx
+  800592:	89 f8                	mov    %edi,%eax
+  800594:	e8 9f ff ff ff       	call   800538 <printnum>
+  800599:	83 c4 20             	add    $0x20,%esp
+  80059c:	eb 13                	jmp    8005b1 <printnum+0x79>
+  80059e:	83 ec 08             	sub    $0x8,%esp
+  8005a1:	56                   	push   %esi
+  8005a2:	ff 75 18             	push   0x18(%ebp)
+  8005a5:	ff d7                	call   *%edi
+  8005a7:	83 c4 10             	add    $0x10,%esp
+  8005aa:	83 eb 01             	sub    $0x1,%ebx
+  8005ad:	85 db                	test   %ebx,%ebx
+  8005af:	7f ed                	jg     80059e <printnum+0x66>
+  8005b1:	83 ec 08             	sub    $0x8,%esp
+  8005b4:	56                   	push   %esi
+  8005b5:	83 ec 04             	sub    $0x4,%esp
+  8005b8:	ff 75 e4             	push   -0x1c(%ebp)
+  8005bb:	ff 75 e0             	push   -0x20(%ebp)
+  8005be:	ff 75 dc             	push   -0x24(%ebp)
+  8005c1:	ff 75 d8             	push   -0x28(%ebp)
+  8005c4:	e8 ea 15 00 00       	call   801bb3 <__umoddi3>
+  8005c9:	83 c4 14             	add    $0x14,%esp
+  8005cc:	0f be 80 3f 1e 80 00 	movsbl 0x801e3f(%eax),%eax
+  8005d3:	50                   	push   %eax
+  8005d4:	ff d7                	call   *%edi
+  8005d6:	83 c4 10             	add    $0x10,%esp
+  8005d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005dc:	5b                   	pop    %ebx
+  8005dd:	5e                   	pop    %esi
+  8005de:	5f                   	pop    %edi
+  8005df:	5d                   	pop    %ebp
+  8005e0:	c3                   	ret
+
+008005e1 <sprintputch>:
+  8005e1:	55                   	push   %ebp
+  8005e2:	89 e5                	mov    %esp,%ebp
+  8005e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8005e7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8005eb:	8b 10                	mov    (%eax),%edx
+  8005ed:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005f0:	73 0a                	jae    8005fc <sprintputch+0x1b>
+  8005f2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005f5:	89 08                	mov    %ecx,(%eax)
+  8005f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005fa:	88 02                	mov    %al,(%edx)
+  8005fc:	5d                   	pop    %ebp
+  8005fd:	c3                   	ret
+
+008005fe <printfmt>:
+  8005fe:	55                   	push   %ebp
+  8005ff:	89 e5                	mov    %esp,%ebp
+  800601:	83 ec 08             	sub    $0x8,%esp
+  800604:	8d 45 14             	lea    0x14(%ebp),%eax
+  800607:	50                   	push   %eax
+  800608:	ff 75 10             	push   0x10(%ebp)
+  80060b:	ff 75 0c             	push   0xc(%ebp)
+  80060e:	ff 75 08             	push   0x8(%ebp)
+  800611:	e8 05 00 00 00       	call   80061b <vprintfmt>
+  800616:	83 c4 10             	add    $0x10,%esp
+  800619:	c9                   	leave
+  80061a:	c3                   	ret
+
+0080061b <vprintfmt>:
+  80061b:	55                   	push   %ebp
+  80061c:	89 e5                	mov    %esp,%ebp
+  80061e:	57                   	push   %edi
+  80061f:	56                   	push   %esi
+  800620:	53                   	push   %ebx
+  800621:	83 ec 2c             	sub    $0x2c,%esp
+  800624:	8b 75 08             	mov    0x8(%ebp),%esi
+  800627:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80062a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80062d:	eb 0a                	jmp    800639 <vprintfmt+0x1e>
+  80062f:	83 ec 08             	sub    $0x8,%esp
+  800632:	53                   	push   %ebx
+  800633:	50                   	push   %eax
+  800634:	ff d6                	call   *%esi
+  800636:	83 c4 10             	add    $0x10,%esp
+  800639:	83 c7 01             	add    $0x1,%edi
+  80063c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800640:	83 f8 25             	cmp    $0x25,%eax
+  800643:	74 0c                	je     800651 <vprintfmt+0x36>
+  800645:	85 c0                	test   %eax,%eax
+  800647:	75 e6                	jne    80062f <vprintfmt+0x14>
+  800649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80064c:	5b                   	pop    %ebx
+  80064d:	5e                   	pop    %esi
+  80064e:	5f                   	pop    %edi
+  80064f:	5d                   	pop    %ebp
+  800650:	c3                   	ret
+  800651:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800655:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80065c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800663:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  80066a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066f:	8d 47 01             	lea    0x1(%edi),%eax
+  800672:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800675:	0f b6 17             	movzbl (%edi),%edx
+  800678:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80067b:	3c 55                	cmp    $0x55,%al
+  80067d:	0f 87 cf 03 00 00    	ja     800a52 <vprintfmt+0x437>
+  800683:	0f b6 c0             	movzbl %al,%eax
+  800686:	ff 24 85 00 1f 80 00 	jmp    *0x801f00(,%eax,4)
+  80068d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800690:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800694:	eb d9                	jmp    80066f <vprintfmt+0x54>
+  800696:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800699:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80069d:	eb d0                	jmp    80066f <vprintfmt+0x54>
+  80069f:	0f b6 d2             	movzbl %dl,%edx
+  8006a2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8006a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006aa:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8006ad:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8006b0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  8006b4:	0f be 17             	movsbl (%edi),%edx
+  8006b7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8006ba:	83 f9 09             	cmp    $0x9,%ecx
+  8006bd:	77 55                	ja     800714 <vprintfmt+0xf9>
+  8006bf:	83 c7 01             	add    $0x1,%edi
+  8006c2:	eb e9                	jmp    8006ad <vprintfmt+0x92>
+  8006c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c7:	8b 00                	mov    (%eax),%eax
+  8006c9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8006d8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006dc:	79 91                	jns    80066f <vprintfmt+0x54>
+  8006de:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006e4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8006eb:	eb 82                	jmp    80066f <vprintfmt+0x54>
+  8006ed:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006f0:	85 d2                	test   %edx,%edx
+  8006f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f7:	0f 49 c2             	cmovns %edx,%eax
+  8006fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800700:	e9 6a ff ff ff       	jmp    80066f <vprintfmt+0x54>
+  800705:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800708:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80070f:	e9 5b ff ff ff       	jmp    80066f <vprintfmt+0x54>
+  800714:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800717:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80071a:	eb bc                	jmp    8006d8 <vprintfmt+0xbd>
+  80071c:	83 c1 01             	add    $0x1,%ecx
+  80071f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800722:	e9 48 ff ff ff       	jmp    80066f <vprintfmt+0x54>
+  800727:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072a:	8d 78 04             	lea    0x4(%eax),%edi
+  80072d:	83 ec 08             	sub    $0x8,%esp
+  800730:	53                   	push   %ebx
+  800731:	ff 30                	push   (%eax)
+  800733:	ff d6                	call   *%esi
+  800735:	83 c4 10             	add    $0x10,%esp
+  800738:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80073b:	e9 b1 02 00 00       	jmp    8009f1 <vprintfmt+0x3d6>
+  800740:	8b 45 14             	mov    0x14(%ebp),%eax
+  800743:	8d 78 04             	lea    0x4(%eax),%edi
+  800746:	8b 10                	mov    (%eax),%edx
+  800748:	89 d0                	mov    %edx,%eax
+  80074a:	f7 d8                	neg    %eax
+  80074c:	0f 48 c2             	cmovs  %edx,%eax
+  80074f:	83 f8 08             	cmp    $0x8,%eax
+  800752:	7f 23                	jg     800777 <vprintfmt+0x15c>
+  800754:	8b 14 85 60 20 80 00 	mov    0x802060(,%eax,4),%edx
+  80075b:	85 d2                	test   %edx,%edx
+  80075d:	74 18                	je     800777 <vprintfmt+0x15c>
+  80075f:	52                   	push   %edx
+  800760:	68 60 1e 80 00       	push   $0x801e60
+  800765:	53                   	push   %ebx
+  800766:	56                   	push   %esi
+  800767:	e8 92 fe ff ff       	call   8005fe <printfmt>
+  80076c:	83 c4 10             	add    $0x10,%esp
+  80076f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800772:	e9 7a 02 00 00       	jmp    8009f1 <vprintfmt+0x3d6>
+  800777:	50                   	push   %eax
+  800778:	68 57 1e 80 00       	push   $0x801e57
+  80077d:	53                   	push   %ebx
+  80077e:	56                   	push   %esi
+  80077f:	e8 7a fe ff ff       	call   8005fe <printfmt>
+  800784:	83 c4 10             	add    $0x10,%esp
+  800787:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80078a:	e9 62 02 00 00       	jmp    8009f1 <vprintfmt+0x3d6>
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	83 c0 04             	add    $0x4,%eax
+  800795:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800798:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079b:	8b 08                	mov    (%eax),%ecx
+  80079d:	85 c9                	test   %ecx,%ecx
+  80079f:	b8 50 1e 80 00       	mov    $0x801e50,%eax
+  8007a4:	0f 45 c1             	cmovne %ecx,%eax
+  8007a7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8007aa:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8007ae:	7e 06                	jle    8007b6 <vprintfmt+0x19b>
+  8007b0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8007b4:	75 0b                	jne    8007c1 <vprintfmt+0x1a6>
+  8007b6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8007b9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8007bc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8007bf:	eb 5c                	jmp    80081d <vprintfmt+0x202>
+  8007c1:	83 ec 08             	sub    $0x8,%esp
+  8007c4:	ff 75 d0             	push   -0x30(%ebp)
+  8007c7:	ff 75 cc             	push   -0x34(%ebp)
+  8007ca:	e8 87 03 00 00       	call   800b56 <strnlen>
+  8007cf:	89 c2                	mov    %eax,%edx
+  8007d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007d4:	29 d0                	sub    %edx,%eax
+  8007d6:	83 c4 10             	add    $0x10,%esp
+  8007d9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8007dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007e0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8007e3:	89 c6                	mov    %eax,%esi
+  8007e5:	eb 0e                	jmp    8007f5 <vprintfmt+0x1da>
+  8007e7:	83 ec 08             	sub    $0x8,%esp
+  8007ea:	53                   	push   %ebx
+  8007eb:	57                   	push   %edi
+  8007ec:	ff 55 08             	call   *0x8(%ebp)
+  8007ef:	83 ee 01             	sub    $0x1,%esi
+  8007f2:	83 c4 10             	add    $0x10,%esp
+  8007f5:	85 f6                	test   %esi,%esi
+  8007f7:	7f ee                	jg     8007e7 <vprintfmt+0x1cc>
+  8007f9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ff:	85 c0                	test   %eax,%eax
+  800801:	ba 00 00 00 00       	mov    $0x0,%edx
+  800806:	0f 49 d0             	cmovns %eax,%edx
+  800809:	29 d0                	sub    %edx,%eax
+  80080b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80080e:	eb a6                	jmp    8007b6 <vprintfmt+0x19b>
+  800810:	83 ec 08             	sub    $0x8,%esp
+  800813:	53                   	push   %ebx
+  800814:	52                   	push   %edx
+  800815:	ff 55 08             	call   *0x8(%ebp)
+  800818:	83 c4 10             	add    $0x10,%esp
+  80081b:	89 f1                	mov    %esi,%ecx
+  80081d:	8d 71 01             	lea    0x1(%ecx),%esi
+  800820:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800824:	0f be d0             	movsbl %al,%edx
+  800827:	85 d2                	test   %edx,%edx
+  800829:	74 28                	je     800853 <vprintfmt+0x238>
+  80082b:	85 ff                	test   %edi,%edi
+  80082d:	78 05                	js     800834 <vprintfmt+0x219>
+  80082f:	83 ef 01             	sub    $0x1,%edi
+  800832:	78 30                	js     800864 <vprintfmt+0x249>
+  800834:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800838:	74 d6                	je     800810 <vprintfmt+0x1f5>
+  80083a:	0f be c0             	movsbl %al,%eax
+  80083d:	83 e8 20             	sub    $0x20,%eax
+  800840:	83 f8 5e             	cmp    $0x5e,%eax
+  800843:	76 cb                	jbe    800810 <vprintfmt+0x1f5>
+  800845:	83 ec 08             	sub    $0x8,%esp
+  800848:	53                   	push   %ebx
+  800849:	6a 3f                	push   $0x3f
+  80084b:	ff 55 08             	call   *0x8(%ebp)
+  80084e:	83 c4 10             	add    $0x10,%esp
+  800851:	eb c8                	jmp    80081b <vprintfmt+0x200>
+  800853:	8b 75 08             	mov    0x8(%ebp),%esi
+  800856:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800859:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80085c:	01 d0                	add    %edx,%eax
+  80085e:	29 c8                	sub    %ecx,%eax
+  800860:	89 c7                	mov    %eax,%edi
+  800862:	eb 13                	jmp    800877 <vprintfmt+0x25c>
+  800864:	8b 75 08             	mov    0x8(%ebp),%esi
+  800867:	eb ed                	jmp    800856 <vprintfmt+0x23b>
+  800869:	83 ec 08             	sub    $0x8,%esp
+  80086c:	53                   	push   %ebx
+  80086d:	6a 20                	push   $0x20
+  80086f:	ff d6                	call   *%esi
+  800871:	83 ef 01             	sub    $0x1,%edi
+  800874:	83 c4 10             	add    $0x10,%esp
+  800877:	85 ff                	test   %edi,%edi
+  800879:	7f ee                	jg     800869 <vprintfmt+0x24e>
+  80087b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80087e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800881:	e9 6b 01 00 00       	jmp    8009f1 <vprintfmt+0x3d6>
+  800886:	83 f9 01             	cmp    $0x1,%ecx
+  800889:	7f 1f                	jg     8008aa <vprintfmt+0x28f>
+  80088b:	85 c9                	test   %ecx,%ecx
+  80088d:	74 67                	je     8008f6 <vprintfmt+0x2db>
+  80088f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800892:	8b 00                	mov    (%eax),%eax
+  800894:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800897:	89 c1                	mov    %eax,%ecx
+  800899:	c1 f9 1f             	sar    $0x1f,%ecx
+  80089c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80089f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008a8:	eb 17                	jmp    8008c1 <vprintfmt+0x2a6>
+  8008aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ad:	8b 50 04             	mov    0x4(%eax),%edx
+  8008b0:	8b 00                	mov    (%eax),%eax
+  8008b2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008b5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8008b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bb:	8d 40 08             	lea    0x8(%eax),%eax
+  8008be:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008c1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008c4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008c7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8008cc:	85 c9                	test   %ecx,%ecx
+  8008ce:	0f 89 03 01 00 00    	jns    8009d7 <vprintfmt+0x3bc>
+  8008d4:	83 ec 08             	sub    $0x8,%esp
+  8008d7:	53                   	push   %ebx
+  8008d8:	6a 2d                	push   $0x2d
+  8008da:	ff d6                	call   *%esi
+  8008dc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008df:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008e2:	f7 da                	neg    %edx
+  8008e4:	83 d1 00             	adc    $0x0,%ecx
+  8008e7:	f7 d9                	neg    %ecx
+  8008e9:	83 c4 10             	add    $0x10,%esp
+  8008ec:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8008f1:	e9 e1 00 00 00       	jmp    8009d7 <vprintfmt+0x3bc>
+  8008f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f9:	8b 00                	mov    (%eax),%eax
+  8008fb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008fe:	89 c1                	mov    %eax,%ecx
+  800900:	c1 f9 1f             	sar    $0x1f,%ecx
+  800903:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800906:	8b 45 14             	mov    0x14(%ebp),%eax
+  800909:	8d 40 04             	lea    0x4(%eax),%eax
+  80090c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80090f:	eb b0                	jmp    8008c1 <vprintfmt+0x2a6>
+  800911:	83 f9 01             	cmp    $0x1,%ecx
+  800914:	7f 1e                	jg     800934 <vprintfmt+0x319>
+  800916:	85 c9                	test   %ecx,%ecx
+  800918:	74 32                	je     80094c <vprintfmt+0x331>
+  80091a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091d:	8b 10                	mov    (%eax),%edx
+  80091f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800924:	8d 40 04             	lea    0x4(%eax),%eax
+  800927:	89 45 14             	mov    %eax,0x14(%ebp)
+  80092a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80092f:	e9 a3 00 00 00       	jmp    8009d7 <vprintfmt+0x3bc>
+  800934:	8b 45 14             	mov    0x14(%ebp),%eax
+  800937:	8b 10                	mov    (%eax),%edx
+  800939:	8b 48 04             	mov    0x4(%eax),%ecx
+  80093c:	8d 40 08             	lea    0x8(%eax),%eax
+  80093f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800942:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800947:	e9 8b 00 00 00       	jmp    8009d7 <vprintfmt+0x3bc>
+  80094c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094f:	8b 10                	mov    (%eax),%edx
+  800951:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800956:	8d 40 04             	lea    0x4(%eax),%eax
+  800959:	89 45 14             	mov    %eax,0x14(%ebp)
+  80095c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800961:	eb 74                	jmp    8009d7 <vprintfmt+0x3bc>
+  800963:	83 f9 01             	cmp    $0x1,%ecx
+  800966:	7f 1b                	jg     800983 <vprintfmt+0x368>
+  800968:	85 c9                	test   %ecx,%ecx
+  80096a:	74 2c                	je     800998 <vprintfmt+0x37d>
+  80096c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096f:	8b 10                	mov    (%eax),%edx
+  800971:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800976:	8d 40 04             	lea    0x4(%eax),%eax
+  800979:	89 45 14             	mov    %eax,0x14(%ebp)
+  80097c:	bf 08 00 00 00       	mov    $0x8,%edi
+  800981:	eb 54                	jmp    8009d7 <vprintfmt+0x3bc>
+  800983:	8b 45 14             	mov    0x14(%ebp),%eax
+  800986:	8b 10                	mov    (%eax),%edx
+  800988:	8b 48 04             	mov    0x4(%eax),%ecx
+  80098b:	8d 40 08             	lea    0x8(%eax),%eax
+  80098e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800991:	bf 08 00 00 00       	mov    $0x8,%edi
+  800996:	eb 3f                	jmp    8009d7 <vprintfmt+0x3bc>
+  800998:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099b:	8b 10                	mov    (%eax),%edx
+  80099d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009a8:	bf 08 00 00 00       	mov    $0x8,%edi
+  8009ad:	eb 28                	jmp    8009d7 <vprintfmt+0x3bc>
+  8009af:	83 ec 08             	sub    $0x8,%esp
+  8009b2:	53                   	push   %ebx
+  8009b3:	6a 30                	push   $0x30
+  8009b5:	ff d6                	call   *%esi
+  8009b7:	83 c4 08             	add    $0x8,%esp
+  8009ba:	53                   	push   %ebx
+  8009bb:	6a 78                	push   $0x78
+  8009bd:	ff d6                	call   *%esi
+  8009bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c2:	8b 10                	mov    (%eax),%edx
+  8009c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009c9:	83 c4 10             	add    $0x10,%esp
+  8009cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8009cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009d2:	bf 10 00 00 00       	mov    $0x10,%edi
+  8009d7:	83 ec 0c             	sub    $0xc,%esp
+  8009da:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8009de:	50                   	push   %eax
+  8009df:	ff 75 e0             	push   -0x20(%ebp)
+  8009e2:	57                   	push   %edi
+  8009e3:	51                   	push   %ecx
+  8009e4:	52                   	push   %edx
+  8009e5:	89 da                	mov    %ebx,%edx
+  8009e7:	89 f0                	mov    %esi,%eax
+  8009e9:	e8 4a fb ff ff       	call   800538 <printnum>
+  8009ee:	83 c4 20             	add    $0x20,%esp
+  8009f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8009f4:	e9 40 fc ff ff       	jmp    800639 <vprintfmt+0x1e>
+  8009f9:	83 f9 01             	cmp    $0x1,%ecx
+  8009fc:	7f 1b                	jg     800a19 <vprintfmt+0x3fe>
+  8009fe:	85 c9                	test   %ecx,%ecx
+  800a00:	74 2c                	je     800a2e <vprintfmt+0x413>
+  800a02:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a05:	8b 10                	mov    (%eax),%edx
+  800a07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a0c:	8d 40 04             	lea    0x4(%eax),%eax
+  800a0f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a12:	bf 10 00 00 00       	mov    $0x10,%edi
+  800a17:	eb be                	jmp    8009d7 <vprintfmt+0x3bc>
+  800a19:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1c:	8b 10                	mov    (%eax),%edx
+  800a1e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a21:	8d 40 08             	lea    0x8(%eax),%eax
+  800a24:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a27:	bf 10 00 00 00       	mov    $0x10,%edi
+  800a2c:	eb a9                	jmp    8009d7 <vprintfmt+0x3bc>
+  800a2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a31:	8b 10                	mov    (%eax),%edx
+  800a33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a38:	8d 40 04             	lea    0x4(%eax),%eax
+  800a3b:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a3e:	bf 10 00 00 00       	mov    $0x10,%edi
+  800a43:	eb 92                	jmp    8009d7 <vprintfmt+0x3bc>
+  800a45:	83 ec 08             	sub    $0x8,%esp
+  800a48:	53                   	push   %ebx
+  800a49:	6a 25                	push   $0x25
+  800a4b:	ff d6                	call   *%esi
+  800a4d:	83 c4 10             	add    $0x10,%esp
+  800a50:	eb 9f                	jmp    8009f1 <vprintfmt+0x3d6>
+  800a52:	83 ec 08             	sub    $0x8,%esp
+  800a55:	53                   	push   %ebx
+  800a56:	6a 25                	push   $0x25
+  800a58:	ff d6                	call   *%esi
+  800a5a:	83 c4 10             	add    $0x10,%esp
+  800a5d:	89 f8                	mov    %edi,%eax
+  800a5f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a63:	74 05                	je     800a6a <vprintfmt+0x44f>
+  800a65:	83 e8 01             	sub    $0x1,%eax
+  800a68:	eb f5                	jmp    800a5f <vprintfmt+0x444>
+  800a6a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a6d:	eb 82                	jmp    8009f1 <vprintfmt+0x3d6>
+
+00800a6f <vsnprintf>:
+  800a6f:	55                   	push   %ebp
+  800a70:	89 e5                	mov    %esp,%ebp
+  800a72:	83 ec 18             	sub    $0x18,%esp
+  800a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a78:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a7b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a7e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a82:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a85:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800a8c:	85 c0                	test   %eax,%eax
+  800a8e:	74 26                	je     800ab6 <vsnprintf+0x47>
+  800a90:	85 d2                	test   %edx,%edx
+  800a92:	7e 22                	jle    800ab6 <vsnprintf+0x47>
+  800a94:	ff 75 14             	push   0x14(%ebp)
+  800a97:	ff 75 10             	push   0x10(%ebp)
+  800a9a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a9d:	50                   	push   %eax
+  800a9e:	68 e1 05 80 00       	push   $0x8005e1
+  800aa3:	e8 73 fb ff ff       	call   80061b <vprintfmt>
+  800aa8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800aab:	c6 00 00             	movb   $0x0,(%eax)
+  800aae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ab1:	83 c4 10             	add    $0x10,%esp
+  800ab4:	c9                   	leave
+  800ab5:	c3                   	ret
+  800ab6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800abb:	eb f7                	jmp    800ab4 <vsnprintf+0x45>
+
+00800abd <snprintf>:
+  800abd:	55                   	push   %ebp
+  800abe:	89 e5                	mov    %esp,%ebp
+  800ac0:	83 ec 08             	sub    $0x8,%esp
+  800ac3:	8d 45 14             	lea    0x14(%ebp),%eax
+  800ac6:	50                   	push   %eax
+  800ac7:	ff 75 10             	push   0x10(%ebp)
+  800aca:	ff 75 0c             	push   0xc(%ebp)
+  800acd:	ff 75 08             	push   0x8(%ebp)
+  800ad0:	e8 9a ff ff ff       	call   800a6f <vsnprintf>
+  800ad5:	c9                   	leave
+  800ad6:	c3                   	ret
+
+00800ad7 <copy_fwd>:
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	57                   	push   %edi
+  800adb:	56                   	push   %esi
+  800adc:	53                   	push   %ebx
+  800add:	89 c7                	mov    %eax,%edi
+  800adf:	89 d6                	mov    %edx,%esi
+  800ae1:	89 c8                	mov    %ecx,%eax
+  800ae3:	83 f9 0f             	cmp    $0xf,%ecx
+  800ae6:	76 1c                	jbe    800b04 <copy_fwd+0x2d>
+  800ae8:	89 f9                	mov    %edi,%ecx
+  800aea:	f7 d9                	neg    %ecx
+  800aec:	89 cb                	mov    %ecx,%ebx
+  800aee:	83 e3 03             	and    $0x3,%ebx
+  800af1:	29 d8                	sub    %ebx,%eax
+  800af3:	89 c2                	mov    %eax,%edx
+  800af5:	c1 ea 02             	shr    $0x2,%edx
+  800af8:	83 e0 03             	and    $0x3,%eax
+  800afb:	89 d9                	mov    %ebx,%ecx
+  800afd:	fc                   	cld
+  800afe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b00:	89 d1                	mov    %edx,%ecx
+  800b02:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b04:	89 c1                	mov    %eax,%ecx
+  800b06:	fc                   	cld
+  800b07:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b09:	5b                   	pop    %ebx
+  800b0a:	5e                   	pop    %esi
+  800b0b:	5f                   	pop    %edi
+  800b0c:	5d                   	pop    %ebp
+  800b0d:	c3                   	ret
+
+00800b0e <have_sse2>:
+  800b0e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b15:	78 06                	js     800b1d <have_sse2+0xf>
+  800b17:	a1 04 30 80 00       	mov    0x803004,%eax
+  800b1c:	c3                   	ret
+  800b1d:	55                   	push   %ebp
+  800b1e:	89 e5                	mov    %esp,%ebp
+  800b20:	53                   	push   %ebx
+  800b21:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b26:	0f a2                	cpuid
+  800b28:	c1 ea 1a             	shr    $0x1a,%edx
+  800b2b:	83 e2 01             	and    $0x1,%edx
+  800b2e:	89 15 04 30 80 00    	mov    %edx,0x803004
+  800b34:	a1 04 30 80 00       	mov    0x803004,%eax
+  800b39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b3c:	c9                   	leave
+  800b3d:	c3                   	ret
+
+00800b3e <strlen>:
+  800b3e:	55                   	push   %ebp
+  800b3f:	89 e5                	mov    %esp,%ebp
+  800b41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b44:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b49:	eb 03                	jmp    800b4e <strlen+0x10>
+  800b4b:	83 c0 01             	add    $0x1,%eax
+  800b4e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b52:	75 f7                	jne    800b4b <strlen+0xd>
+  800b54:	5d                   	pop    %ebp
+  800b55:	c3                   	ret
+
+00800b56 <strnlen>:
+  800b56:	55                   	push   %ebp
+  800b57:	89 e5                	mov    %esp,%ebp
+  800b59:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b64:	eb 03                	jmp    800b69 <strnlen+0x13>
+  800b66:	83 c0 01             	add    $0x1,%eax
+  800b69:	39 d0                	cmp    %edx,%eax
+  800b6b:	74 08                	je     800b75 <strnlen+0x1f>
+  800b6d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b71:	75 f3                	jne    800b66 <strnlen+0x10>
+  800b73:	89 c2                	mov    %eax,%edx
+  800b75:	89 d0                	mov    %edx,%eax
+  800b77:	5d                   	pop    %ebp
+  800b78:	c3                   	ret
+
+00800b79 <strcpy>:
+  800b79:	55                   	push   %ebp
+  800b7a:	89 e5                	mov    %esp,%ebp
+  800b7c:	53                   	push   %ebx
+  800b7d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b80:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b88:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b8c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b8f:	83 c0 01             	add    $0x1,%eax
+  800b92:	84 d2                	test   %dl,%dl
+  800b94:	75 f2                	jne    800b88 <strcpy+0xf>
+  800b96:	89 c8                	mov    %ecx,%eax
+  800b98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b9b:	c9                   	leave
+  800b9c:	c3                   	ret
+
+00800b9d <strcat>:
+  800b9d:	55                   	push   %ebp
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	53                   	push   %ebx
+  800ba1:	83 ec 10             	sub    $0x10,%esp
+  800ba4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800ba7:	53                   	push   %ebx
+  800ba8:	e8 91 ff ff ff       	call   800b3e <strlen>
+  800bad:	83 c4 08             	add    $0x8,%esp
+  800bb0:	ff 75 0c             	push   0xc(%ebp)
+  800bb3:	01 d8                	add    %ebx,%eax
+  800bb5:	50                   	push   %eax
+  800bb6:	e8 be ff ff ff       	call   800b79 <strcpy>
+  800bbb:	89 d8                	mov    %ebx,%eax
+  800bbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bc0:	c9                   	leave
+  800bc1:	c3                   	ret
+
+00800bc2 <strncpy>:
+  800bc2:	55                   	push   %ebp
+  800bc3:	89 e5                	mov    %esp,%ebp
+  800bc5:	56                   	push   %esi
+  800bc6:	53                   	push   %ebx
+  800bc7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bcd:	89 f3                	mov    %esi,%ebx
+  800bcf:	03 5d 10             	add    0x10(%ebp),%ebx
+  800bd2:	89 f0                	mov    %esi,%eax
+  800bd4:	eb 0f                	jmp    800be5 <strncpy+0x23>
+  800bd6:	83 c0 01             	add    $0x1,%eax
+  800bd9:	0f b6 0a             	movzbl (%edx),%ecx
+  800bdc:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800bdf:	80 f9 01             	cmp    $0x1,%cl
+  800be2:	83 da ff             	sbb    $0xffffffff,%edx
+  800be5:	39 d8                	cmp    %ebx,%eax
+  800be7:	75 ed                	jne    800bd6 <strncpy+0x14>
+  800be9:	89 f0                	mov    %esi,%eax
+  800beb:	5b                   	pop    %ebx
+  800bec:	5e                   	pop    %esi
+  800bed:	5d                   	pop    %ebp
+  800bee:	c3                   	ret
+
+00800bef <strlcpy>:
+  800bef:	55                   	push   %ebp
+  800bf0:	89 e5                	mov    %esp,%ebp
+  800bf2:	56                   	push   %esi
+  800bf3:	53                   	push   %ebx
+  800bf4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bf7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bfa:	8b 55 10             	mov    0x10(%ebp),%edx
+  800bfd:	89 f0                	mov    %esi,%eax
+  800bff:	85 d2                	test   %edx,%edx
+  800c01:	74 21                	je     800c24 <strlcpy+0x35>
+  800c03:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c07:	89 f2                	mov    %esi,%edx
+  800c09:	eb 09                	jmp    800c14 <strlcpy+0x25>
+  800c0b:	83 c1 01             	add    $0x1,%ecx
+  800c0e:	83 c2 01             	add    $0x1,%edx
+  800c11:	88 5a ff             	mov    %bl,-0x1(%edx)
+  800c14:	39 c2                	cmp    %eax,%edx
+  800c16:	74 09                	je     800c21 <strlcpy+0x32>
+  800c18:	0f b6 19             	movzbl (%ecx),%ebx
+  800c1b:	84 db                	test   %bl,%bl
+  800c1d:	75 ec                	jne    800c0b <strlcpy+0x1c>
+  800c1f:	89 d0                	mov    %edx,%eax
+  800c21:	c6 00 00             	movb   $0x0,(%eax)
+  800c24:	29 f0                	sub    %esi,%eax
+  800c26:	5b                   	pop    %ebx
+  800c27:	5e                   	pop    %esi
+  800c28:	5d                   	pop    %ebp
+  800c29:	c3                   	ret
+
+00800c2a <strcmp>:
+  800c2a:	55                   	push   %ebp
+  800c2b:	89 e5                	mov    %esp,%ebp
+  800c2d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c30:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c33:	eb 06                	jmp    800c3b <strcmp+0x11>
+  800c35:	83 c1 01             	add    $0x1,%ecx
+  800c38:	83 c2 01             	add    $0x1,%edx
+  800c3b:	0f b6 01             	movzbl (%ecx),%eax
+  800c3e:	84 c0                	test   %al,%al
+  800c40:	74 04                	je     800c46 <strcmp+0x1c>
+  800c42:	3a 02                	cmp    (%edx),%al
+  800c44:	74 ef                	je     800c35 <strcmp+0xb>
+  800c46:	0f b6 c0             	movzbl %al,%eax
+  800c49:	0f b6 12             	movzbl (%edx),%edx
+  800c4c:	29 d0                	sub    %edx,%eax
+  800c4e:	5d                   	pop    %ebp
+  800c4f:	c3                   	ret
+
+00800c50 <strncmp>:
+  800c50:	55                   	push   %ebp
+  800c51:	89 e5                	mov    %esp,%ebp
+  800c53:	53                   	push   %ebx
+  800c54:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5a:	8b 55 10             	mov    0x10(%ebp),%edx
+  800c5d:	eb 09                	jmp    800c68 <strncmp+0x18>
+  800c5f:	83 ea 01             	sub    $0x1,%edx
+  800c62:	83 c0 01             	add    $0x1,%eax
+  800c65:	83 c1 01             	add    $0x1,%ecx
+  800c68:	85 d2                	test   %edx,%edx
+  800c6a:	74 18                	je     800c84 <strncmp+0x34>
+  800c6c:	0f b6 18             	movzbl (%eax),%ebx
+  800c6f:	84 db                	test   %bl,%bl
+  800c71:	74 04                	je     800c77 <strncmp+0x27>
+  800c73:	3a 19                	cmp    (%ecx),%bl
+  800c75:	74 e8                	je     800c5f <strncmp+0xf>
+  800c77:	0f b6 00             	movzbl (%eax),%eax
+  800c7a:	0f b6 11             	movzbl (%ecx),%edx
+  800c7d:	29 d0                	sub    %edx,%eax
+  800c7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c82:	c9                   	leave
+  800c83:	c3                   	ret
+  800c84:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c89:	eb f4                	jmp    800c7f <strncmp+0x2f>
+
+00800c8b <strchr>:
+  800c8b:	55                   	push   %ebp
+  800c8c:	89 e5                	mov    %esp,%ebp
+  800c8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c91:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800c95:	eb 03                	jmp    800c9a <strchr+0xf>
+  800c97:	83 c0 01             	add    $0x1,%eax
+  800c9a:	0f b6 10             	movzbl (%eax),%edx
+  800c9d:	84 d2                	test   %dl,%dl
+  800c9f:	74 06                	je     800ca7 <strchr+0x1c>
+  800ca1:	38 ca                	cmp    %cl,%dl
+  800ca3:	75 f2                	jne    800c97 <strchr+0xc>
+  800ca5:	eb 05                	jmp    800cac <strchr+0x21>
+  800ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cac:	5d                   	pop    %ebp
+  800cad:	c3                   	ret
+
+00800cae <strfind>:
+  800cae:	55                   	push   %ebp
+  800caf:	89 e5                	mov    %esp,%ebp
+  800cb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800cb8:	0f b6 10             	movzbl (%eax),%edx
+  800cbb:	38 ca                	cmp    %cl,%dl
+  800cbd:	74 09                	je     800cc8 <strfind+0x1a>
+  800cbf:	84 d2                	test   %dl,%dl
+  800cc1:	74 05                	je     800cc8 <strfind+0x1a>
+  800cc3:	83 c0 01             	add    $0x1,%eax
+  800cc6:	eb f0                	jmp    800cb8 <strfind+0xa>
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	c3                   	ret
+
+00800cca <memset>:
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	57                   	push   %edi
+  800cce:	56                   	push   %esi
+  800ccf:	53                   	push   %ebx
+  800cd0:	83 ec 04             	sub    $0x4,%esp
+  800cd3:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cd6:	8b 55 10             	mov    0x10(%ebp),%edx
+  800cd9:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  800cdd:	89 f7                	mov    %esi,%edi
+  800cdf:	83 fa 0f             	cmp    $0xf,%edx
+  800ce2:	76 24                	jbe    800d08 <memset+0x3e>
+  800ce4:	89 f1                	mov    %esi,%ecx
+  800ce6:	f7 d9                	neg    %ecx
+  800ce8:	83 e1 03             	and    $0x3,%ecx
+  800ceb:	29 ca                	sub    %ecx,%edx
+  800ced:	89 d0                	mov    %edx,%eax
+  800cef:	c1 e8 02             	shr    $0x2,%eax
+  800cf2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  800cf5:	83 e2 03             	and    $0x3,%edx
+  800cf8:	89 d8                	mov    %ebx,%eax
+  800cfa:	fc                   	cld
+  800cfb:	f3 aa                	rep stos %al,%es:(%edi)
+  800cfd:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  800d03:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  800d06:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d08:	89 d1                	mov    %edx,%ecx
+  800d0a:	89 d8                	mov    %ebx,%eax
+  800d0c:	fc                   	cld
+  800d0d:	f3 aa                	rep stos %al,%es:(%edi)
+  800d0f:	89 f0                	mov    %esi,%eax
+  800d11:	83 c4 04             	add    $0x4,%esp
+  800d14:	5b                   	pop    %ebx
+  800d15:	5e                   	pop    %esi
+  800d16:	5f                   	pop    %edi
+  800d17:	5d                   	pop    %ebp
+  800d18:	c3                   	ret
+
+00800d19 <memmove>:
+  800d19:	55                   	push   %ebp
+  800d1a:	89 e5                	mov    %esp,%ebp
+  800d1c:	57                   	push   %edi
+  800d1d:	56                   	push   %esi
+  800d1e:	53                   	push   %ebx
+  800d1f:	83 ec 0c             	sub    $0xc,%esp
+  800d22:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800d25:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d28:	8b 45 10             	mov    0x10(%ebp),%eax
+  800d2b:	85 c0                	test   %eax,%eax
+  800d2d:	74 14                	je     800d43 <memmove+0x2a>
+  800d2f:	39 da                	cmp    %ebx,%edx
+  800d31:	73 07                	jae    800d3a <memmove+0x21>
+  800d33:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  800d36:	39 cb                	cmp    %ecx,%ebx
+  800d38:	72 13                	jb     800d4d <memmove+0x34>
+  800d3a:	89 c1                	mov    %eax,%ecx
+  800d3c:	89 d8                	mov    %ebx,%eax
+  800d3e:	e8 94 fd ff ff       	call   800ad7 <copy_fwd>
+  800d43:	89 d8                	mov    %ebx,%eax
+  800d45:	83 c4 0c             	add    $0xc,%esp
+  800d48:	5b                   	pop    %ebx
+  800d49:	5e                   	pop    %esi
+  800d4a:	5f                   	pop    %edi
+  800d4b:	5d                   	pop    %ebp
+  800d4c:	c3                   	ret
+  800d4d:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800d50:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800d53:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800d56:	83 f8 0f             	cmp    $0xf,%eax
+  800d59:	76 23                	jbe    800d7e <memmove+0x65>
+  800d5b:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800d5e:	83 e1 03             	and    $0x3,%ecx
+  800d61:	29 c8                	sub    %ecx,%eax
+  800d63:	89 c2                	mov    %eax,%edx
+  800d65:	c1 ea 02             	shr    $0x2,%edx
+  800d68:	83 e0 03             	and    $0x3,%eax
+  800d6b:	fd                   	std
+  800d6c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800d6e:	83 ef 03             	sub    $0x3,%edi
+  800d71:	83 ee 03             	sub    $0x3,%esi
+  800d74:	89 d1                	mov    %edx,%ecx
+  800d76:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d78:	83 c7 03             	add    $0x3,%edi
+  800d7b:	83 c6 03             	add    $0x3,%esi
+  800d7e:	89 c1                	mov    %eax,%ecx
+  800d80:	fd                   	std
+  800d81:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800d83:	fc                   	cld
+  800d84:	eb bd                	jmp    800d43 <memmove+0x2a>
+
+00800d86 <memcpy>:
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	53                   	push   %ebx
+  800d8a:	83 ec 04             	sub    $0x4,%esp
+  800d8d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800d90:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800d93:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d96:	89 d8                	mov    %ebx,%eax
+  800d98:	e8 3a fd ff ff       	call   800ad7 <copy_fwd>
+  800d9d:	89 d8                	mov    %ebx,%eax
+  800d9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800da2:	c9                   	leave
+  800da3:	c3                   	ret
+
+00800da4 <page_copy>:
+  800da4:	55                   	push   %ebp
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	57                   	push   %edi
+  800da8:	56                   	push   %esi
+  800da9:	53                   	push   %ebx
+  800daa:	83 ec 0c             	sub    $0xc,%esp
+  800dad:	e8 5c fd ff ff       	call   800b0e <have_sse2>
+  800db2:	85 c0                	test   %eax,%eax
+  800db4:	74 39                	je     800def <page_copy+0x4b>
+  800db6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800db9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800dbc:	be 00 01 00 00       	mov    $0x100,%esi
+  800dc1:	8b 03                	mov    (%ebx),%eax
+  800dc3:	8b 53 04             	mov    0x4(%ebx),%edx
+  800dc6:	0f c3 01             	movnti %eax,(%ecx)
+  800dc9:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800dcd:	8b 43 08             	mov    0x8(%ebx),%eax
+  800dd0:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800dd3:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800dd7:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800ddb:	83 c3 10             	add    $0x10,%ebx
+  800dde:	83 c1 10             	add    $0x10,%ecx
+  800de1:	4e                   	dec    %esi
+  800de2:	75 dd                	jne    800dc1 <page_copy+0x1d>
+  800de4:	0f ae f8             	sfence
+  800de7:	83 c4 0c             	add    $0xc,%esp
+  800dea:	5b                   	pop    %ebx
+  800deb:	5e                   	pop    %esi
+  800dec:	5f                   	pop    %edi
+  800ded:	5d                   	pop    %ebp
+  800dee:	c3                   	ret
+  800def:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800df2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800df5:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800dfa:	fc                   	cld
+  800dfb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dfd:	eb e8                	jmp    800de7 <page_copy+0x43>
+
+00800dff <page_zero>:
+  800dff:	55                   	push   %ebp
+  800e00:	89 e5                	mov    %esp,%ebp
+  800e02:	57                   	push   %edi
+  800e03:	83 ec 04             	sub    $0x4,%esp
+  800e06:	e8 03 fd ff ff       	call   800b0e <have_sse2>
+  800e0b:	85 c0                	test   %eax,%eax
+  800e0d:	74 3a                	je     800e49 <page_zero+0x4a>
+  800e0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e12:	ba 80 00 00 00       	mov    $0x80,%edx
+  800e17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e1c:	0f c3 08             	movnti %ecx,(%eax)
+  800e1f:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800e23:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800e27:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800e2b:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800e2f:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800e33:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800e37:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800e3b:	83 c0 20             	add    $0x20,%eax
+  800e3e:	4a                   	dec    %edx
+  800e3f:	75 db                	jne    800e1c <page_zero+0x1d>
+  800e41:	0f ae f8             	sfence
+  800e44:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800e47:	c9                   	leave
+  800e48:	c3                   	ret
+  800e49:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e4c:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800e51:	fc                   	cld
+  800e52:	f3 ab                	rep stos %eax,%es:(%edi)
+  800e54:	eb ee                	jmp    800e44 <page_zero+0x45>
+
+00800e56 <memcmp>:
+  800e56:	55                   	push   %ebp
+  800e57:	89 e5                	mov    %esp,%ebp
+  800e59:	56                   	push   %esi
+  800e5a:	53                   	push   %ebx
+  800e5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e61:	89 c6                	mov    %eax,%esi
+  800e63:	03 75 10             	add    0x10(%ebp),%esi
+  800e66:	eb 06                	jmp    800e6e <memcmp+0x18>
+  800e68:	83 c0 01             	add    $0x1,%eax
+  800e6b:	83 c2 01             	add    $0x1,%edx
+  800e6e:	39 f0                	cmp    %esi,%eax
+  800e70:	74 14                	je     800e86 <memcmp+0x30>
+  800e72:	0f b6 08             	movzbl (%eax),%ecx
+  800e75:	0f b6 1a             	movzbl (%edx),%ebx
+  800e78:	38 d9                	cmp    %bl,%cl
+  800e7a:	74 ec                	je     800e68 <memcmp+0x12>
+  800e7c:	0f b6 c1             	movzbl %cl,%eax
+  800e7f:	0f b6 db             	movzbl %bl,%ebx
+  800e82:	29 d8                	sub    %ebx,%eax
+  800e84:	eb 05                	jmp    800e8b <memcmp+0x35>
+  800e86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e8b:	5b                   	pop    %ebx
+  800e8c:	5e                   	pop    %esi
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	c3                   	ret
+
+00800e8f <memfind>:
+  800e8f:	55                   	push   %ebp
+  800e90:	89 e5                	mov    %esp,%ebp
+  800e92:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e98:	89 c2                	mov    %eax,%edx
+  800e9a:	03 55 10             	add    0x10(%ebp),%edx
+  800e9d:	eb 03                	jmp    800ea2 <memfind+0x13>
+  800e9f:	83 c0 01             	add    $0x1,%eax
+  800ea2:	39 d0                	cmp    %edx,%eax
+  800ea4:	73 04                	jae    800eaa <memfind+0x1b>
+  800ea6:	38 08                	cmp    %cl,(%eax)
+  800ea8:	75 f5                	jne    800e9f <memfind+0x10>
+  800eaa:	5d                   	pop    %ebp
+  800eab:	c3                   	ret
+
+00800eac <strtol>:
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	57                   	push   %edi
+  800eb0:	56                   	push   %esi
+  800eb1:	53                   	push   %ebx
+  800eb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eb8:	eb 03                	jmp    800ebd <strtol+0x11>
+  800eba:	83 c2 01             	add    $0x1,%edx
+  800ebd:	0f b6 02             	movzbl (%edx),%eax
+  800ec0:	3c 20                	cmp    $0x20,%al
+  800ec2:	74 f6                	je     800eba <strtol+0xe>
+  800ec4:	3c 09                	cmp    $0x9,%al
+  800ec6:	74 f2                	je     800eba <strtol+0xe>
+  800ec8:	3c 2b                	cmp    $0x2b,%al
+  800eca:	74 2a                	je     800ef6 <strtol+0x4a>
+  800ecc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ed1:	3c 2d                	cmp    $0x2d,%al
+  800ed3:	74 2b                	je     800f00 <strtol+0x54>
+  800ed5:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800edb:	75 0f                	jne    800eec <strtol+0x40>
+  800edd:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ee0:	74 28                	je     800f0a <strtol+0x5e>
+  800ee2:	85 db                	test   %ebx,%ebx
+  800ee4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ee9:	0f 44 d8             	cmove  %eax,%ebx
+  800eec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ef1:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ef4:	eb 46                	jmp    800f3c <strtol+0x90>
+  800ef6:	83 c2 01             	add    $0x1,%edx
+  800ef9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800efe:	eb d5                	jmp    800ed5 <strtol+0x29>
+  800f00:	83 c2 01             	add    $0x1,%edx
+  800f03:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f08:	eb cb                	jmp    800ed5 <strtol+0x29>
+  800f0a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800f0e:	74 0e                	je     800f1e <strtol+0x72>
+  800f10:	85 db                	test   %ebx,%ebx
+  800f12:	75 d8                	jne    800eec <strtol+0x40>
+  800f14:	83 c2 01             	add    $0x1,%edx
+  800f17:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800f1c:	eb ce                	jmp    800eec <strtol+0x40>
+  800f1e:	83 c2 02             	add    $0x2,%edx
+  800f21:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800f26:	eb c4                	jmp    800eec <strtol+0x40>
+  800f28:	0f be c0             	movsbl %al,%eax
+  800f2b:	83 e8 30             	sub    $0x30,%eax
+  800f2e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800f31:	7d 3a                	jge    800f6d <strtol+0xc1>
+  800f33:	83 c2 01             	add    $0x1,%edx
+  800f36:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800f3a:	01 c1                	add    %eax,%ecx
+  800f3c:	0f b6 02             	movzbl (%edx),%eax
+  800f3f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800f42:	89 f3                	mov    %esi,%ebx
+  800f44:	80 fb 09             	cmp    $0x9,%bl
+  800f47:	76 df                	jbe    800f28 <strtol+0x7c>
+  800f49:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800f4c:	89 f3                	mov    %esi,%ebx
+  800f4e:	80 fb 19             	cmp    $0x19,%bl
+  800f51:	77 08                	ja     800f5b <strtol+0xaf>
+  800f53:	0f be c0             	movsbl %al,%eax
+  800f56:	83 e8 57             	sub    $0x57,%eax
+  800f59:	eb d3                	jmp    800f2e <strtol+0x82>
+  800f5b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f5e:	89 f3                	mov    %esi,%ebx
+  800f60:	80 fb 19             	cmp    $0x19,%bl
+  800f63:	77 08                	ja     800f6d <strtol+0xc1>
+  800f65:	0f be c0             	movsbl %al,%eax
+  800f68:	83 e8 37             	sub    $0x37,%eax
+  800f6b:	eb c1                	jmp    800f2e <strtol+0x82>
+  800f6d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f71:	74 05                	je     800f78 <strtol+0xcc>
+  800f73:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f76:	89 10                	mov    %edx,(%eax)
+  800f78:	89 c8                	mov    %ecx,%eax
+  800f7a:	f7 d8                	neg    %eax
+  800f7c:	85 ff                	test   %edi,%edi
+  800f7e:	0f 45 c8             	cmovne %eax,%ecx
+  800f81:	89 c8                	mov    %ecx,%eax
+  800f83:	5b                   	pop    %ebx
+  800f84:	5e                   	pop    %esi
+  800f85:	5f                   	pop    %edi
+  800f86:	5d                   	pop    %ebp
+  800f87:	c3                   	ret
+
+00800f88 <sys_cputs>:
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	57                   	push   %edi
+  800f8c:	56                   	push   %esi
+  800f8d:	53                   	push   %ebx
+  800f8e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f95:	78 21                	js     800fb8 <sys_cputs+0x30>
+  800f97:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f9e:	75 2d                	jne    800fcd <sys_cputs+0x45>
+  800fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fab:	89 c3                	mov    %eax,%ebx
+  800fad:	89 c7                	mov    %eax,%edi
+  800faf:	89 c6                	mov    %eax,%esi
+  800fb1:	cd 30                	int    $0x30
+  800fb3:	5b                   	pop    %ebx
+  800fb4:	5e                   	pop    %esi
+  800fb5:	5f                   	pop    %edi
+  800fb6:	5d                   	pop    %ebp
+  800fb7:	c3                   	ret
+  800fb8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fbd:	0f a2                	cpuid
+  800fbf:	c1 ea 0b             	shr    $0xb,%edx
+  800fc2:	83 e2 01             	and    $0x1,%edx
+  800fc5:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800fcb:	eb ca                	jmp    800f97 <sys_cputs+0xf>
+  800fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd8:	89 c3                	mov    %eax,%ebx
+  800fda:	89 c7                	mov    %eax,%edi
+  800fdc:	89 c6                	mov    %eax,%esi
+  800fde:	55                   	push   %ebp
+  800fdf:	68 e8 0f 80 00       	push   $0x800fe8
+  800fe4:	89 e5                	mov    %esp,%ebp
+  800fe6:	0f 34                	sysenter
+  800fe8:	83 c4 04             	add    $0x4,%esp
+  800feb:	5d                   	pop    %ebp
+  800fec:	eb c5                	jmp    800fb3 <sys_cputs+0x2b>
+
+00800fee <sys_cgetc>:
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	57                   	push   %edi
+  800ff2:	56                   	push   %esi
+  800ff3:	53                   	push   %ebx
+  800ff4:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ffb:	78 22                	js     80101f <sys_cgetc+0x31>
+  800ffd:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801004:	75 2e                	jne    801034 <sys_cgetc+0x46>
+  801006:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801010:	89 d1                	mov    %edx,%ecx
+  801012:	89 d3                	mov    %edx,%ebx
+  801014:	89 d7                	mov    %edx,%edi
+  801016:	89 d6                	mov    %edx,%esi
+  801018:	cd 30                	int    $0x30
+  80101a:	5b                   	pop    %ebx
+  80101b:	5e                   	pop    %esi
+  80101c:	5f                   	pop    %edi
+  80101d:	5d                   	pop    %ebp
+  80101e:	c3                   	ret
+  80101f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801024:	0f a2                	cpuid
+  801026:	c1 ea 0b             	shr    $0xb,%edx
+  801029:	83 e2 01             	and    $0x1,%edx
+  80102c:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801032:	eb c9                	jmp    800ffd <sys_cgetc+0xf>
+  801034:	ba 00 00 00 00       	mov    $0x0,%edx
+  801039:	b8 01 00 00 00       	mov    $0x1,%eax
+  80103e:	89 d1                	mov    %edx,%ecx
+  801040:	89 d3                	mov    %edx,%ebx
+  801042:	89 d7                	mov    %edx,%edi
+  801044:	89 d6                	mov    %edx,%esi
+  801046:	55                   	push   %ebp
+  801047:	68 50 10 80 00       	push   $0x801050
+  80104c:	89 e5                	mov    %esp,%ebp
+  80104e:	0f 34                	sysenter
+  801050:	83 c4 04             	add    $0x4,%esp
+  801053:	5d                   	pop    %ebp
+  801054:	eb c4                	jmp    80101a <sys_cgetc+0x2c>
+
+00801056 <sys_env_destroy>:
+  801056:	55                   	push   %ebp
+  801057:	89 e5                	mov    %esp,%ebp
+  801059:	57                   	push   %edi
+  80105a:	56                   	push   %esi
+  80105b:	53                   	push   %ebx
+  80105c:	83 ec 0c             	sub    $0xc,%esp
+  80105f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801066:	78 2a                	js     801092 <sys_env_destroy+0x3c>
+  801068:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80106f:	75 36                	jne    8010a7 <sys_env_destroy+0x51>
+  801071:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801076:	b8 03 00 00 00       	mov    $0x3,%eax
+  80107b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107e:	89 cb                	mov    %ecx,%ebx
+  801080:	89 cf                	mov    %ecx,%edi
+  801082:	89 ce                	mov    %ecx,%esi
+  801084:	cd 30                	int    $0x30
+  801086:	85 c0                	test   %eax,%eax
+  801088:	7f 40                	jg     8010ca <sys_env_destroy+0x74>
+  80108a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108d:	5b                   	pop    %ebx
+  80108e:	5e                   	pop    %esi
+  80108f:	5f                   	pop    %edi
+  801090:	5d                   	pop    %ebp
+  801091:	c3                   	ret
+  801092:	b8 01 00 00 00       	mov    $0x1,%eax
+  801097:	0f a2                	cpuid
+  801099:	c1 ea 0b             	shr    $0xb,%edx
+  80109c:	83 e2 01             	and    $0x1,%edx
+  80109f:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8010a5:	eb c1                	jmp    801068 <sys_env_destroy+0x12>
+  8010a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010af:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010b4:	89 cb                	mov    %ecx,%ebx
+  8010b6:	89 cf                	mov    %ecx,%edi
+  8010b8:	89 ce                	mov    %ecx,%esi
+  8010ba:	55                   	push   %ebp
+  8010bb:	68 c4 10 80 00       	push   $0x8010c4
+  8010c0:	89 e5                	mov    %esp,%ebp
+  8010c2:	0f 34                	sysenter
+  8010c4:	83 c4 04             	add    $0x4,%esp
+  8010c7:	5d                   	pop    %ebp
+  8010c8:	eb bc                	jmp    801086 <sys_env_destroy+0x30>
+  8010ca:	83 ec 0c             	sub    $0xc,%esp
+  8010cd:	50                   	push   %eax
+  8010ce:	6a 03                	push   $0x3
+  8010d0:	68 84 20 80 00       	push   $0x802084
+  8010d5:	6a 49                	push   $0x49
+  8010d7:	68 a1 20 80 00       	push   $0x8020a1
+  8010dc:	e8 af 09 00 00       	call   801a90 <_panic>
+
+008010e1 <sys_getenvid>:
+  8010e1:	55                   	push   %ebp
+  8010e2:	89 e5                	mov    %esp,%ebp
+  8010e4:	57                   	push   %edi
+  8010e5:	56                   	push   %esi
+  8010e6:	53                   	push   %ebx
+  8010e7:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8010ee:	78 22                	js     801112 <sys_getenvid+0x31>
+  8010f0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8010f7:	75 2e                	jne    801127 <sys_getenvid+0x46>
+  8010f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fe:	b8 02 00 00 00       	mov    $0x2,%eax
+  801103:	89 d1                	mov    %edx,%ecx
+  801105:	89 d3                	mov    %edx,%ebx
+  801107:	89 d7                	mov    %edx,%edi
+  801109:	89 d6                	mov    %edx,%esi
+  80110b:	cd 30                	int    $0x30
+  80110d:	5b                   	pop    %ebx
+  80110e:	5e                   	pop    %esi
+  80110f:	5f                   	pop    %edi
+  801110:	5d                   	pop    %ebp
+  801111:	c3                   	ret
+  801112:	b8 01 00 00 00       	mov    $0x1,%eax
+  801117:	0f a2                	cpuid
+  801119:	c1 ea 0b             	shr    $0xb,%edx
+  80111c:	83 e2 01             	and    $0x1,%edx
+  80111f:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801125:	eb c9                	jmp    8010f0 <sys_getenvid+0xf>
+  801127:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801131:	89 d1                	mov    %edx,%ecx
+  801133:	89 d3                	mov    %edx,%ebx
+  801135:	89 d7                	mov    %edx,%edi
+  801137:	89 d6                	mov    %edx,%esi
+  801139:	55                   	push   %ebp
+  80113a:	68 43 11 80 00       	push   $0x801143
+  80113f:	89 e5                	mov    %esp,%ebp
+  801141:	0f 34                	sysenter
+  801143:	83 c4 04             	add    $0x4,%esp
+  801146:	5d                   	pop    %ebp
+  801147:	eb c4                	jmp    80110d <sys_getenvid+0x2c>
+
+00801149 <sys_yield>:
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	57                   	push   %edi
+  80114d:	56                   	push   %esi
+  80114e:	53                   	push   %ebx
+  80114f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801156:	78 22                	js     80117a <sys_yield+0x31>
+  801158:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80115f:	75 2e                	jne    80118f <sys_yield+0x46>
+  801161:	ba 00 00 00 00       	mov    $0x0,%edx
+  801166:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80116b:	89 d1                	mov    %edx,%ecx
+  80116d:	89 d3                	mov    %edx,%ebx
+  80116f:	89 d7                	mov    %edx,%edi
+  801171:	89 d6                	mov    %edx,%esi
+  801173:	cd 30                	int    $0x30
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+  80117a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80117f:	0f a2                	cpuid
+  801181:	c1 ea 0b             	shr    $0xb,%edx
+  801184:	83 e2 01             	and    $0x1,%edx
+  801187:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80118d:	eb c9                	jmp    801158 <sys_yield+0xf>
+  80118f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801194:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801199:	89 d1                	mov    %edx,%ecx
+  80119b:	89 d3                	mov    %edx,%ebx
+  80119d:	89 d7                	mov    %edx,%edi
+  80119f:	89 d6                	mov    %edx,%esi
+  8011a1:	55                   	push   %ebp
+  8011a2:	68 ab 11 80 00       	push   $0x8011ab
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	0f 34                	sysenter
+  8011ab:	83 c4 04             	add    $0x4,%esp
+  8011ae:	5d                   	pop    %ebp
+  8011af:	eb c4                	jmp    801175 <sys_yield+0x2c>
+
+008011b1 <sys_env_set_cow>:
+  8011b1:	55                   	push   %ebp
+  8011b2:	89 e5                	mov    %esp,%ebp
+  8011b4:	57                   	push   %edi
+  8011b5:	56                   	push   %esi
+  8011b6:	53                   	push   %ebx
+  8011b7:	83 ec 0c             	sub    $0xc,%esp
+  8011ba:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8011c1:	78 2b                	js     8011ee <sys_env_set_cow+0x3d>
+  8011c3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8011ca:	75 37                	jne    801203 <sys_env_set_cow+0x52>
+  8011cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011dc:	89 df                	mov    %ebx,%edi
+  8011de:	89 de                	mov    %ebx,%esi
+  8011e0:	cd 30                	int    $0x30
+  8011e2:	85 c0                	test   %eax,%eax
+  8011e4:	7f 41                	jg     801227 <sys_env_set_cow+0x76>
+  8011e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e9:	5b                   	pop    %ebx
+  8011ea:	5e                   	pop    %esi
+  8011eb:	5f                   	pop    %edi
+  8011ec:	5d                   	pop    %ebp
+  8011ed:	c3                   	ret
+  8011ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011f3:	0f a2                	cpuid
+  8011f5:	c1 ea 0b             	shr    $0xb,%edx
+  8011f8:	83 e2 01             	and    $0x1,%edx
+  8011fb:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801201:	eb c0                	jmp    8011c3 <sys_env_set_cow+0x12>
+  801203:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801208:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801213:	89 df                	mov    %ebx,%edi
+  801215:	89 de                	mov    %ebx,%esi
+  801217:	55                   	push   %ebp
+  801218:	68 21 12 80 00       	push   $0x801221
+  80121d:	89 e5                	mov    %esp,%ebp
+  80121f:	0f 34                	sysenter
+  801221:	83 c4 04             	add    $0x4,%esp
+  801224:	5d                   	pop    %ebp
+  801225:	eb bb                	jmp    8011e2 <sys_env_set_cow+0x31>
+  801227:	83 ec 0c             	sub    $0xc,%esp
+  80122a:	50                   	push   %eax
+  80122b:	6a 0d                	push   $0xd
+  80122d:	68 84 20 80 00       	push   $0x802084
+  801232:	6a 49                	push   $0x49
+  801234:	68 a1 20 80 00       	push   $0x8020a1
+  801239:	e8 52 08 00 00       	call   801a90 <_panic>
+
+0080123e <sys_env_set_quota>:
+  80123e:	55                   	push   %ebp
+  80123f:	89 e5                	mov    %esp,%ebp
+  801241:	57                   	push   %edi
+  801242:	56                   	push   %esi
+  801243:	53                   	push   %ebx
+  801244:	83 ec 0c             	sub    $0xc,%esp
+  801247:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80124e:	78 2b                	js     80127b <sys_env_set_quota+0x3d>
+  801250:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801257:	75 37                	jne    801290 <sys_env_set_quota+0x52>
+  801259:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801263:	8b 55 08             	mov    0x8(%ebp),%edx
+  801266:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801269:	89 df                	mov    %ebx,%edi
+  80126b:	89 de                	mov    %ebx,%esi
+  80126d:	cd 30                	int    $0x30
+  80126f:	85 c0                	test   %eax,%eax
+  801271:	7f 41                	jg     8012b4 <sys_env_set_quota+0x76>
+  801273:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801276:	5b                   	pop    %ebx
+  801277:	5e                   	pop    %esi
+  801278:	5f                   	pop    %edi
+  801279:	5d                   	pop    %ebp
+  80127a:	c3                   	ret
+  80127b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801280:	0f a2                	cpuid
+  801282:	c1 ea 0b             	shr    $0xb,%edx
+  801285:	83 e2 01             	and    $0x1,%edx
+  801288:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80128e:	eb c0                	jmp    801250 <sys_env_set_quota+0x12>
+  801290:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801295:	8b 55 08             	mov    0x8(%ebp),%edx
+  801298:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012a0:	89 df                	mov    %ebx,%edi
+  8012a2:	89 de                	mov    %ebx,%esi
+  8012a4:	55                   	push   %ebp
+  8012a5:	68 ae 12 80 00       	push   $0x8012ae
+  8012aa:	89 e5                	mov    %esp,%ebp
+  8012ac:	0f 34                	sysenter
+  8012ae:	83 c4 04             	add    $0x4,%esp
+  8012b1:	5d                   	pop    %ebp
+  8012b2:	eb bb                	jmp    80126f <sys_env_set_quota+0x31>
+  8012b4:	83 ec 0c             	sub    $0xc,%esp
+  8012b7:	50                   	push   %eax
+  8012b8:	6a 0f                	push   $0xf
+  8012ba:	68 84 20 80 00       	push   $0x802084
+  8012bf:	6a 49                	push   $0x49
+  8012c1:	68 a1 20 80 00       	push   $0x8020a1
+  8012c6:	e8 c5 07 00 00       	call   801a90 <_panic>
+
+008012cb <sys_page_alloc>:
+  8012cb:	55                   	push   %ebp
+  8012cc:	89 e5                	mov    %esp,%ebp
+  8012ce:	57                   	push   %edi
+  8012cf:	56                   	push   %esi
+  8012d0:	53                   	push   %ebx
+  8012d1:	83 ec 0c             	sub    $0xc,%esp
+  8012d4:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8012db:	78 2c                	js     801309 <sys_page_alloc+0x3e>
+  8012dd:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8012e4:	75 38                	jne    80131e <sys_page_alloc+0x53>
+  8012e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012eb:	b8 04 00 00 00       	mov    $0x4,%eax
+  8012f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f9:	89 f7                	mov    %esi,%edi
+  8012fb:	cd 30                	int    $0x30
+  8012fd:	85 c0                	test   %eax,%eax
+  8012ff:	7f 42                	jg     801343 <sys_page_alloc+0x78>
+  801301:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801304:	5b                   	pop    %ebx
+  801305:	5e                   	pop    %esi
+  801306:	5f                   	pop    %edi
+  801307:	5d                   	pop    %ebp
+  801308:	c3                   	ret
+  801309:	b8 01 00 00 00       	mov    $0x1,%eax
+  80130e:	0f a2                	cpuid
+  801310:	c1 ea 0b             	shr    $0xb,%edx
+  801313:	83 e2 01             	and    $0x1,%edx
+  801316:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80131c:	eb bf                	jmp    8012dd <sys_page_alloc+0x12>
+  80131e:	be 00 00 00 00       	mov    $0x0,%esi
+  801323:	8b 55 08             	mov    0x8(%ebp),%edx
+  801326:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801329:	b8 04 00 00 00       	mov    $0x4,%eax
+  80132e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801331:	89 f7                	mov    %esi,%edi
+  801333:	55                   	push   %ebp
+  801334:	68 3d 13 80 00       	push   $0x80133d
+  801339:	89 e5                	mov    %esp,%ebp
+  80133b:	0f 34                	sysenter
+  80133d:	83 c4 04             	add    $0x4,%esp
+  801340:	5d                   	pop    %ebp
+  801341:	eb ba                	jmp    8012fd <sys_page_alloc+0x32>
+  801343:	83 ec 0c             	sub    $0xc,%esp
+  801346:	50                   	push   %eax
+  801347:	6a 04                	push   $0x4
+  801349:	68 84 20 80 00       	push   $0x802084
+  80134e:	6a 49                	push   $0x49
+  801350:	68 a1 20 80 00       	push   $0x8020a1
+  801355:	e8 36 07 00 00       	call   801a90 <_panic>
+
+0080135a <sys_page_map>:
+  80135a:	55                   	push   %ebp
+  80135b:	89 e5                	mov    %esp,%ebp
+  80135d:	57                   	push   %edi
+  80135e:	56                   	push   %esi
+  80135f:	53                   	push   %ebx
+  801360:	83 ec 0c             	sub    $0xc,%esp
+  801363:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80136a:	78 2b                	js     801397 <sys_page_map+0x3d>
+  80136c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801373:	75 37                	jne    8013ac <sys_page_map+0x52>
+  801375:	b8 05 00 00 00       	mov    $0x5,%eax
+  80137a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801380:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801383:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801386:	8b 75 18             	mov    0x18(%ebp),%esi
+  801389:	cd 30                	int    $0x30
+  80138b:	85 c0                	test   %eax,%eax
+  80138d:	7f 41                	jg     8013d0 <sys_page_map+0x76>
+  80138f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801392:	5b                   	pop    %ebx
+  801393:	5e                   	pop    %esi
+  801394:	5f                   	pop    %edi
+  801395:	5d                   	pop    %ebp
+  801396:	c3                   	ret
+  801397:	b8 01 00 00 00       	mov    $0x1,%eax
+  80139c:	0f a2                	cpuid
+  80139e:	c1 ea 0b             	shr    $0xb,%edx
+  8013a1:	83 e2 01             	and    $0x1,%edx
+  8013a4:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8013aa:	eb c0                	jmp    80136c <sys_page_map+0x12>
+  8013ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8013b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ba:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013bd:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013c0:	55                   	push   %ebp
+  8013c1:	68 ca 13 80 00       	push   $0x8013ca
+  8013c6:	89 e5                	mov    %esp,%ebp
+  8013c8:	0f 34                	sysenter
+  8013ca:	83 c4 04             	add    $0x4,%esp
+  8013cd:	5d                   	pop    %ebp
+  8013ce:	eb bb                	jmp    80138b <sys_page_map+0x31>
+  8013d0:	83 ec 0c             	sub    $0xc,%esp
+  8013d3:	50                   	push   %eax
+  8013d4:	6a 05                	push   $0x5
+  8013d6:	68 84 20 80 00       	push   $0x802084
+  8013db:	6a 49                	push   $0x49
+  8013dd:	68 a1 20 80 00       	push   $0x8020a1
+  8013e2:	e8 a9 06 00 00       	call   801a90 <_panic>
+
+008013e7 <sys_page_unmap>:
+  8013e7:	55                   	push   %ebp
+  8013e8:	89 e5                	mov    %esp,%ebp
+  8013ea:	57                   	push   %edi
+  8013eb:	56                   	push   %esi
+  8013ec:	53                   	push   %ebx
+  8013ed:	83 ec 0c             	sub    $0xc,%esp
+  8013f0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013f7:	78 2b                	js     801424 <sys_page_unmap+0x3d>
+  8013f9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801400:	75 37                	jne    801439 <sys_page_unmap+0x52>
+  801402:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801407:	b8 06 00 00 00       	mov    $0x6,%eax
+  80140c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801412:	89 df                	mov    %ebx,%edi
+  801414:	89 de                	mov    %ebx,%esi
+  801416:	cd 30                	int    $0x30
+  801418:	85 c0                	test   %eax,%eax
+  80141a:	7f 41                	jg     80145d <sys_page_unmap+0x76>
+  80141c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141f:	5b                   	pop    %ebx
+  801420:	5e                   	pop    %esi
+  801421:	5f                   	pop    %edi
+  801422:	5d                   	pop    %ebp
+  801423:	c3                   	ret
+  801424:	b8 01 00 00 00       	mov    $0x1,%eax
+  801429:	0f a2                	cpuid
+  80142b:	c1 ea 0b             	shr    $0xb,%edx
+  80142e:	83 e2 01             	and    $0x1,%edx
+  801431:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801437:	eb c0                	jmp    8013f9 <sys_page_unmap+0x12>
+  801439:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801441:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801444:	b8 06 00 00 00       	mov    $0x6,%eax
+  801449:	89 df                	mov    %ebx,%edi
+  80144b:	89 de                	mov    %ebx,%esi
+  80144d:	55                   	push   %ebp
+  80144e:	68 57 14 80 00       	push   $0x801457
+  801453:	89 e5                	mov    %esp,%ebp
+  801455:	0f 34                	sysenter
+  801457:	83 c4 04             	add    $0x4,%esp
+  80145a:	5d                   	pop    %ebp
+  80145b:	eb bb                	jmp    801418 <sys_page_unmap+0x31>
+  80145d:	83 ec 0c             	sub    $0xc,%esp
+  801460:	50                   	push   %eax
+  801461:	6a 06                	push   $0x6
+  801463:	68 84 20 80 00       	push   $0x802084
+  801468:	6a 49                	push   $0x49
+  80146a:	68 a1 20 80 00       	push   $0x8020a1
+  80146f:	e8 1c 06 00 00       	call   801a90 <_panic>
+
+00801474 <sys_page_reuse>:
+  801474:	55                   	push   %ebp
+  801475:	89 e5                	mov    %esp,%ebp
+  801477:	57                   	push   %edi
+  801478:	56                   	push   %esi
+  801479:	53                   	push   %ebx
+  80147a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801481:	78 24                	js     8014a7 <sys_page_reuse+0x33>
+  801483:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80148a:	75 30                	jne    8014bc <sys_page_reuse+0x48>
+  80148c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801491:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801496:	8b 55 08             	mov    0x8(%ebp),%edx
+  801499:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149c:	89 df                	mov    %ebx,%edi
+  80149e:	89 de                	mov    %ebx,%esi
+  8014a0:	cd 30                	int    $0x30
+  8014a2:	5b                   	pop    %ebx
+  8014a3:	5e                   	pop    %esi
+  8014a4:	5f                   	pop    %edi
+  8014a5:	5d                   	pop    %ebp
+  8014a6:	c3                   	ret
+  8014a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014ac:	0f a2                	cpuid
+  8014ae:	c1 ea 0b             	shr    $0xb,%edx
+  8014b1:	83 e2 01             	and    $0x1,%edx
+  8014b4:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8014ba:	eb c7                	jmp    801483 <sys_page_reuse+0xf>
+  8014bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014cc:	89 df                	mov    %ebx,%edi
+  8014ce:	89 de                	mov    %ebx,%esi
+  8014d0:	55                   	push   %ebp
+  8014d1:	68 da 14 80 00       	push   $0x8014da
+  8014d6:	89 e5                	mov    %esp,%ebp
+  8014d8:	0f 34                	sysenter
+  8014da:	83 c4 04             	add    $0x4,%esp
+  8014dd:	5d                   	pop    %ebp
+  8014de:	eb c2                	jmp    8014a2 <sys_page_reuse+0x2e>
+
+008014e0 <sys_env_set_status>:
+  8014e0:	55                   	push   %ebp
+  8014e1:	89 e5                	mov    %esp,%ebp
+  8014e3:	57                   	push   %edi
+  8014e4:	56                   	push   %esi
+  8014e5:	53                   	push   %ebx
+  8014e6:	83 ec 0c             	sub    $0xc,%esp
+  8014e9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014f0:	78 2b                	js     80151d <sys_env_set_status+0x3d>
+  8014f2:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014f9:	75 37                	jne    801532 <sys_env_set_status+0x52>
+  8014fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801500:	b8 08 00 00 00       	mov    $0x8,%eax
+  801505:	8b 55 08             	mov    0x8(%ebp),%edx
+  801508:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150b:	89 df                	mov    %ebx,%edi
+  80150d:	89 de                	mov    %ebx,%esi
+  80150f:	cd 30                	int    $0x30
+  801511:	85 c0                	test   %eax,%eax
+  801513:	7f 41                	jg     801556 <sys_env_set_status+0x76>
+  801515:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801518:	5b                   	pop    %ebx
+  801519:	5e                   	pop    %esi
+  80151a:	5f                   	pop    %edi
+  80151b:	5d                   	pop    %ebp
+  80151c:	c3                   	ret
+  80151d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801522:	0f a2                	cpuid
+  801524:	c1 ea 0b             	shr    $0xb,%edx
+  801527:	83 e2 01             	and    $0x1,%edx
+  80152a:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801530:	eb c0                	jmp    8014f2 <sys_env_set_status+0x12>
+  801532:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801537:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80153d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801542:	89 df                	mov    %ebx,%edi
+  801544:	89 de                	mov    %ebx,%esi
+  801546:	55                   	push   %ebp
+  801547:	68 50 15 80 00       	push   $0x801550
+  80154c:	89 e5                	mov    %esp,%ebp
+  80154e:	0f 34                	sysenter
+  801550:	83 c4 04             	add    $0x4,%esp
+  801553:	5d                   	pop    %ebp
+  801554:	eb bb                	jmp    801511 <sys_env_set_status+0x31>
+  801556:	83 ec 0c             	sub    $0xc,%esp
+  801559:	50                   	push   %eax
+  80155a:	6a 08                	push   $0x8
+  80155c:	68 84 20 80 00       	push   $0x802084
+  801561:	6a 49                	push   $0x49
+  801563:	68 a1 20 80 00       	push   $0x8020a1
+  801568:	e8 23 05 00 00       	call   801a90 <_panic>
+
+0080156d <sys_env_set_pgfault_upcall>:
+  80156d:	55                   	push   %ebp
+  80156e:	89 e5                	mov    %esp,%ebp
+  801570:	57                   	push   %edi
+  801571:	56                   	push   %esi
+  801572:	53                   	push   %ebx
+  801573:	83 ec 0c             	sub    $0xc,%esp
+  801576:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80157d:	78 2b                	js     8015aa <sys_env_set_pgfault_upcall+0x3d>
+  80157f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801586:	75 37                	jne    8015bf <sys_env_set_pgfault_upcall+0x52>
+  801588:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801592:	8b 55 08             	mov    0x8(%ebp),%edx
+  801595:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801598:	89 df                	mov    %ebx,%edi
+  80159a:	89 de                	mov    %ebx,%esi
+  80159c:	cd 30                	int    $0x30
+  80159e:	85 c0                	test   %eax,%eax
+  8015a0:	7f 41                	jg     8015e3 <sys_env_set_pgfault_upcall+0x76>
+  8015a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a5:	5b                   	pop    %ebx
+  8015a6:	5e                   	pop    %esi
+  8015a7:	5f                   	pop    %edi
+  8015a8:	5d                   	pop    %ebp
+  8015a9:	c3                   	ret
+  8015aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015af:	0f a2                	cpuid
+  8015b1:	c1 ea 0b             	shr    $0xb,%edx
+  8015b4:	83 e2 01             	and    $0x1,%edx
+  8015b7:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8015bd:	eb c0                	jmp    80157f <sys_env_set_pgfault_upcall+0x12>
+  8015bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ca:	b8 09 00 00 00       	mov    $0x9,%eax
+  8015cf:	89 df                	mov    %ebx,%edi
+  8015d1:	89 de                	mov    %ebx,%esi
+  8015d3:	55                   	push   %ebp
+  8015d4:	68 dd 15 80 00       	push   $0x8015dd
+  8015d9:	89 e5                	mov    %esp,%ebp
+  8015db:	0f 34                	sysenter
+  8015dd:	83 c4 04             	add    $0x4,%esp
+  8015e0:	5d                   	pop    %ebp
+  8015e1:	eb bb                	jmp    80159e <sys_env_set_pgfault_upcall+0x31>
+  8015e3:	83 ec 0c             	sub    $0xc,%esp
+  8015e6:	50                   	push   %eax
+  8015e7:	6a 09                	push   $0x9
+  8015e9:	68 84 20 80 00       	push   $0x802084
+  8015ee:	6a 49                	push   $0x49
+  8015f0:	68 a1 20 80 00       	push   $0x8020a1
+  8015f5:	e8 96 04 00 00       	call   801a90 <_panic>
+
+008015fa <sys_env_set_trace>:
+  8015fa:	55                   	push   %ebp
+  8015fb:	89 e5                	mov    %esp,%ebp
+  8015fd:	57                   	push   %edi
+  8015fe:	56                   	push   %esi
+  8015ff:	53                   	push   %ebx
+  801600:	83 ec 0c             	sub    $0xc,%esp
+  801603:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80160a:	78 2b                	js     801637 <sys_env_set_trace+0x3d>
+  80160c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801613:	75 37                	jne    80164c <sys_env_set_trace+0x52>
+  801615:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80161f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801622:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801625:	89 df                	mov    %ebx,%edi
+  801627:	89 de                	mov    %ebx,%esi
+  801629:	cd 30                	int    $0x30
+  80162b:	85 c0                	test   %eax,%eax
+  80162d:	7f 41                	jg     801670 <sys_env_set_trace+0x76>
+  80162f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801632:	5b                   	pop    %ebx
+  801633:	5e                   	pop    %esi
+  801634:	5f                   	pop    %edi
+  801635:	5d                   	pop    %ebp
+  801636:	c3                   	ret
+  801637:	b8 01 00 00 00       	mov    $0x1,%eax
+  80163c:	0f a2                	cpuid
+  80163e:	c1 ea 0b             	shr    $0xb,%edx
+  801641:	83 e2 01             	and    $0x1,%edx
+  801644:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80164a:	eb c0                	jmp    80160c <sys_env_set_trace+0x12>
+  80164c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801651:	8b 55 08             	mov    0x8(%ebp),%edx
+  801654:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801657:	b8 12 00 00 00       	mov    $0x12,%eax
+  80165c:	89 df                	mov    %ebx,%edi
+  80165e:	89 de                	mov    %ebx,%esi
+  801660:	55                   	push   %ebp
+  801661:	68 6a 16 80 00       	push   $0x80166a
+  801666:	89 e5                	mov    %esp,%ebp
+  801668:	0f 34                	sysenter
+  80166a:	83 c4 04             	add    $0x4,%esp
+  80166d:	5d                   	pop    %ebp
+  80166e:	eb bb                	jmp    80162b <sys_env_set_trace+0x31>
+  801670:	83 ec 0c             	sub    $0xc,%esp
+  801673:	50                   	push   %eax
+  801674:	6a 12                	push   $0x12
+  801676:	68 84 20 80 00       	push   $0x802084
+  80167b:	6a 49                	push   $0x49
+  80167d:	68 a1 20 80 00       	push   $0x8020a1
+  801682:	e8 09 04 00 00       	call   801a90 <_panic>
+
+00801687 <sys_env_set_rdpmc>:
+  801687:	55                   	push   %ebp
+  801688:	89 e5                	mov    %esp,%ebp
+  80168a:	57                   	push   %edi
+  80168b:	56                   	push   %esi
+  80168c:	53                   	push   %ebx
+  80168d:	83 ec 0c             	sub    $0xc,%esp
+  801690:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801697:	78 2b                	js     8016c4 <sys_env_set_rdpmc+0x3d>
+  801699:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8016a0:	75 37                	jne    8016d9 <sys_env_set_rdpmc+0x52>
+  8016a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b2:	89 df                	mov    %ebx,%edi
+  8016b4:	89 de                	mov    %ebx,%esi
+  8016b6:	cd 30                	int    $0x30
+  8016b8:	85 c0                	test   %eax,%eax
+  8016ba:	7f 41                	jg     8016fd <sys_env_set_rdpmc+0x76>
+  8016bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016bf:	5b                   	pop    %ebx
+  8016c0:	5e                   	pop    %esi
+  8016c1:	5f                   	pop    %edi
+  8016c2:	5d                   	pop    %ebp
+  8016c3:	c3                   	ret
+  8016c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016c9:	0f a2                	cpuid
+  8016cb:	c1 ea 0b             	shr    $0xb,%edx
+  8016ce:	83 e2 01             	and    $0x1,%edx
+  8016d1:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8016d7:	eb c0                	jmp    801699 <sys_env_set_rdpmc+0x12>
+  8016d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016e9:	89 df                	mov    %ebx,%edi
+  8016eb:	89 de                	mov    %ebx,%esi
+  8016ed:	55                   	push   %ebp
+  8016ee:	68 f7 16 80 00       	push   $0x8016f7
+  8016f3:	89 e5                	mov    %esp,%ebp
+  8016f5:	0f 34                	sysenter
+  8016f7:	83 c4 04             	add    $0x4,%esp
+  8016fa:	5d                   	pop    %ebp
+  8016fb:	eb bb                	jmp    8016b8 <sys_env_set_rdpmc+0x31>
+  8016fd:	83 ec 0c             	sub    $0xc,%esp
+  801700:	50                   	push   %eax
+  801701:	6a 13                	push   $0x13
+  801703:	68 84 20 80 00       	push   $0x802084
+  801708:	6a 49                	push   $0x49
+  80170a:	68 a1 20 80 00       	push   $0x8020a1
+  80170f:	e8 7c 03 00 00       	call   801a90 <_panic>
+
+00801714 <sys_ring_setup>:
+  801714:	55                   	push   %ebp
+  801715:	89 e5                	mov    %esp,%ebp
+  801717:	57                   	push   %edi
+  801718:	56                   	push   %esi
+  801719:	53                   	push   %ebx
+  80171a:	83 ec 0c             	sub    $0xc,%esp
+  80171d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801724:	78 29                	js     80174f <sys_ring_setup+0x3b>
+  801726:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80172d:	75 35                	jne    801764 <sys_ring_setup+0x50>
+  80172f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801734:	b8 10 00 00 00       	mov    $0x10,%eax
+  801739:	89 d1                	mov    %edx,%ecx
+  80173b:	89 d3                	mov    %edx,%ebx
+  80173d:	89 d7                	mov    %edx,%edi
+  80173f:	89 d6                	mov    %edx,%esi
+  801741:	cd 30                	int    $0x30
+  801743:	85 c0                	test   %eax,%eax
+  801745:	7f 3f                	jg     801786 <sys_ring_setup+0x72>
+  801747:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174a:	5b                   	pop    %ebx
+  80174b:	5e                   	pop    %esi
+  80174c:	5f                   	pop    %edi
+  80174d:	5d                   	pop    %ebp
+  80174e:	c3                   	ret
+  80174f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801754:	0f a2                	cpuid
+  801756:	c1 ea 0b             	shr    $0xb,%edx
+  801759:	83 e2 01             	and    $0x1,%edx
+  80175c:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801762:	eb c2                	jmp    801726 <sys_ring_setup+0x12>
+  801764:	ba 00 00 00 00       	mov    $0x0,%edx
+  801769:	b8 10 00 00 00       	mov    $0x10,%eax
+  80176e:	89 d1                	mov    %edx,%ecx
+  801770:	89 d3                	mov    %edx,%ebx
+  801772:	89 d7                	mov    %edx,%edi
+  801774:	89 d6                	mov    %edx,%esi
+  801776:	55                   	push   %ebp
+  801777:	68 80 17 80 00       	push   $0x801780
+  80177c:	89 e5                	mov    %esp,%ebp
+  80177e:	0f 34                	sysenter
+  801780:	83 c4 04             	add    $0x4,%esp
+  801783:	5d                   	pop    %ebp
+  801784:	eb bd                	jmp    801743 <sys_ring_setup+0x2f>
+  801786:	83 ec 0c             	sub    $0xc,%esp
+  801789:	50                   	push   %eax
+  80178a:	6a 10                	push   $0x10
+  80178c:	68 84 20 80 00       	push   $0x802084
+  801791:	6a 49                	push   $0x49
+  801793:	68 a1 20 80 00       	push   $0x8020a1
+  801798:	e8 f3 02 00 00       	call   801a90 <_panic>
+
+0080179d <sys_ring_enter>:
+  80179d:	55                   	push   %ebp
+  80179e:	89 e5                	mov    %esp,%ebp
+  8017a0:	57                   	push   %edi
+  8017a1:	56                   	push   %esi
+  8017a2:	53                   	push   %ebx
+  8017a3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8017aa:	78 22                	js     8017ce <sys_ring_enter+0x31>
+  8017ac:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8017b3:	75 2e                	jne    8017e3 <sys_ring_enter+0x46>
+  8017b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ba:	b8 11 00 00 00       	mov    $0x11,%eax
+  8017bf:	89 d1                	mov    %edx,%ecx
+  8017c1:	89 d3                	mov    %edx,%ebx
+  8017c3:	89 d7                	mov    %edx,%edi
+  8017c5:	89 d6                	mov    %edx,%esi
+  8017c7:	cd 30                	int    $0x30
+  8017c9:	5b                   	pop    %ebx
+  8017ca:	5e                   	pop    %esi
+  8017cb:	5f                   	pop    %edi
+  8017cc:	5d                   	pop    %ebp
+  8017cd:	c3                   	ret
+  8017ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017d3:	0f a2                	cpuid
+  8017d5:	c1 ea 0b             	shr    $0xb,%edx
+  8017d8:	83 e2 01             	and    $0x1,%edx
+  8017db:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8017e1:	eb c9                	jmp    8017ac <sys_ring_enter+0xf>
+  8017e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e8:	b8 11 00 00 00       	mov    $0x11,%eax
+  8017ed:	89 d1                	mov    %edx,%ecx
+  8017ef:	89 d3                	mov    %edx,%ebx
+  8017f1:	89 d7                	mov    %edx,%edi
+  8017f3:	89 d6                	mov    %edx,%esi
+  8017f5:	55                   	push   %ebp
+  8017f6:	68 ff 17 80 00       	push   $0x8017ff
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	0f 34                	sysenter
+  8017ff:	83 c4 04             	add    $0x4,%esp
+  801802:	5d                   	pop    %ebp
+  801803:	eb c4                	jmp    8017c9 <sys_ring_enter+0x2c>
+
+00801805 <sys_ipc_try_send>:
+  801805:	55                   	push   %ebp
+  801806:	89 e5                	mov    %esp,%ebp
+  801808:	57                   	push   %edi
+  801809:	56                   	push   %esi
+  80180a:	53                   	push   %ebx
+  80180b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801812:	78 26                	js     80183a <sys_ipc_try_send+0x35>
+  801814:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80181b:	75 32                	jne    80184f <sys_ipc_try_send+0x4a>
+  80181d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801822:	be 00 00 00 00       	mov    $0x0,%esi
+  801827:	8b 55 08             	mov    0x8(%ebp),%edx
+  80182a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80182d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801830:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801833:	cd 30                	int    $0x30
+  801835:	5b                   	pop    %ebx
+  801836:	5e                   	pop    %esi
+  801837:	5f                   	pop    %edi
+  801838:	5d                   	pop    %ebp
+  801839:	c3                   	ret
+  80183a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80183f:	0f a2                	cpuid
+  801841:	c1 ea 0b             	shr    $0xb,%edx
+  801844:	83 e2 01             	and    $0x1,%edx
+  801847:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80184d:	eb c5                	jmp    801814 <sys_ipc_try_send+0xf>
+  80184f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801852:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801855:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80185a:	be 00 00 00 00       	mov    $0x0,%esi
+  80185f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801862:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801865:	55                   	push   %ebp
+  801866:	68 6f 18 80 00       	push   $0x80186f
+  80186b:	89 e5                	mov    %esp,%ebp
+  80186d:	0f 34                	sysenter
+  80186f:	83 c4 04             	add    $0x4,%esp
+  801872:	5d                   	pop    %ebp
+  801873:	eb c0                	jmp    801835 <sys_ipc_try_send+0x30>
+
+00801875 <sys_ipc_recv>:
+  801875:	55                   	push   %ebp
+  801876:	89 e5                	mov    %esp,%ebp
+  801878:	57                   	push   %edi
+  801879:	56                   	push   %esi
+  80187a:	53                   	push   %ebx
+  80187b:	83 ec 0c             	sub    $0xc,%esp
+  80187e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801885:	78 2a                	js     8018b1 <sys_ipc_recv+0x3c>
+  801887:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80188e:	75 36                	jne    8018c6 <sys_ipc_recv+0x51>
+  801890:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801895:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80189a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80189d:	89 cb                	mov    %ecx,%ebx
+  80189f:	89 cf                	mov    %ecx,%edi
+  8018a1:	89 ce                	mov    %ecx,%esi
+  8018a3:	cd 30                	int    $0x30
+  8018a5:	85 c0                	test   %eax,%eax
+  8018a7:	7f 40                	jg     8018e9 <sys_ipc_recv+0x74>
+  8018a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ac:	5b                   	pop    %ebx
+  8018ad:	5e                   	pop    %esi
+  8018ae:	5f                   	pop    %edi
+  8018af:	5d                   	pop    %ebp
+  8018b0:	c3                   	ret
+  8018b1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018b6:	0f a2                	cpuid
+  8018b8:	c1 ea 0b             	shr    $0xb,%edx
+  8018bb:	83 e2 01             	and    $0x1,%edx
+  8018be:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8018c4:	eb c1                	jmp    801887 <sys_ipc_recv+0x12>
+  8018c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018ce:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018d3:	89 cb                	mov    %ecx,%ebx
+  8018d5:	89 cf                	mov    %ecx,%edi
+  8018d7:	89 ce                	mov    %ecx,%esi
+  8018d9:	55                   	push   %ebp
+  8018da:	68 e3 18 80 00       	push   $0x8018e3
+  8018df:	89 e5                	mov    %esp,%ebp
+  8018e1:	0f 34                	sysenter
+  8018e3:	83 c4 04             	add    $0x4,%esp
+  8018e6:	5d                   	pop    %ebp
+  8018e7:	eb bc                	jmp    8018a5 <sys_ipc_recv+0x30>
+  8018e9:	83 ec 0c             	sub    $0xc,%esp
+  8018ec:	50                   	push   %eax
+  8018ed:	6a 0c                	push   $0xc
+  8018ef:	68 84 20 80 00       	push   $0x802084
+  8018f4:	6a 49                	push   $0x49
+  8018f6:	68 a1 20 80 00       	push   $0x8020a1
+  8018fb:	e8 90 01 00 00       	call   801a90 <_panic>
+
+00801900 <uinfo_envid>:
+  801900:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  801905:	c3                   	ret
+
+00801906 <uinfo_cpunum>:
+  801906:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  80190b:	c3                   	ret
+
+0080190c <uinfo_ticks>:
+  80190c:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  801911:	c3                   	ret
+
+00801912 <uinfo_nsec>:
+  801912:	55                   	push   %ebp
+  801913:	89 e5                	mov    %esp,%ebp
+  801915:	57                   	push   %edi
+  801916:	56                   	push   %esi
+  801917:	53                   	push   %ebx
+  801918:	83 ec 1c             	sub    $0x1c,%esp
+  80191b:	0f 31                	rdtsc
+  80191d:	89 c6                	mov    %eax,%esi
+  80191f:	89 d7                	mov    %edx,%edi
+  801921:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801931:	85 c9                	test   %ecx,%ecx
+  801933:	74 5c                	je     801991 <uinfo_nsec+0x7f>
+  801935:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80193d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801940:	52                   	push   %edx
+  801941:	51                   	push   %ecx
+  801942:	57                   	push   %edi
+  801943:	56                   	push   %esi
+  801944:	e8 6a 02 00 00       	call   801bb3 <__umoddi3>
+  801949:	83 c4 10             	add    $0x10,%esp
+  80194c:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801952:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801957:	f7 e3                	mul    %ebx
+  801959:	01 ca                	add    %ecx,%edx
+  80195b:	ff 75 e4             	push   -0x1c(%ebp)
+  80195e:	ff 75 e0             	push   -0x20(%ebp)
+  801961:	52                   	push   %edx
+  801962:	50                   	push   %eax
+  801963:	e8 73 01 00 00       	call   801adb <__udivdi3>
+  801968:	83 c4 10             	add    $0x10,%esp
+  80196b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80196e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801971:	ff 75 e4             	push   -0x1c(%ebp)
+  801974:	ff 75 e0             	push   -0x20(%ebp)
+  801977:	57                   	push   %edi
+  801978:	56                   	push   %esi
+  801979:	e8 5d 01 00 00       	call   801adb <__udivdi3>
+  80197e:	83 c4 10             	add    $0x10,%esp
+  801981:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801987:	f7 e3                	mul    %ebx
+  801989:	01 ca                	add    %ecx,%edx
+  80198b:	03 45 d8             	add    -0x28(%ebp),%eax
+  80198e:	13 55 dc             	adc    -0x24(%ebp),%edx
+  801991:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801994:	5b                   	pop    %ebx
+  801995:	5e                   	pop    %esi
+  801996:	5f                   	pop    %edi
+  801997:	5d                   	pop    %ebp
+  801998:	c3                   	ret
+
+00801999 <bflush>:
+  801999:	a1 20 80 80 00       	mov    0x808020,%eax
+  80199e:	85 c0                	test   %eax,%eax
+  8019a0:	75 01                	jne    8019a3 <bflush+0xa>
+  8019a2:	c3                   	ret
+  8019a3:	55                   	push   %ebp
+  8019a4:	89 e5                	mov    %esp,%ebp
+  8019a6:	83 ec 10             	sub    $0x10,%esp
+  8019a9:	50                   	push   %eax
+  8019aa:	68 24 80 80 00       	push   $0x808024
+  8019af:	e8 d4 f5 ff ff       	call   800f88 <sys_cputs>
+  8019b4:	c7 05 20 80 80 00 00 	movl   $0x0,0x808020
+  8019bb:	00 00 00 
+  8019be:	83 c4 10             	add    $0x10,%esp
+  8019c1:	c9                   	leave
+  8019c2:	c3                   	ret
+
+008019c3 <bputch>:
+  8019c3:	55                   	push   %ebp
+  8019c4:	89 e5                	mov    %esp,%ebp
+  8019c6:	53                   	push   %ebx
+  8019c7:	83 ec 04             	sub    $0x4,%esp
+  8019ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8019cd:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8019d3:	8d 42 01             	lea    0x1(%edx),%eax
+  8019d6:	a3 20 80 80 00       	mov    %eax,0x808020
+  8019db:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8019de:	88 8a 24 80 80 00    	mov    %cl,0x808024(%edx)
+  8019e4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019e9:	77 08                	ja     8019f3 <bputch+0x30>
+  8019eb:	83 03 01             	addl   $0x1,(%ebx)
+  8019ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019f1:	c9                   	leave
+  8019f2:	c3                   	ret
+  8019f3:	e8 a1 ff ff ff       	call   801999 <bflush>
+  8019f8:	eb f1                	jmp    8019eb <bputch+0x28>
+
+008019fa <vbprintf>:
+  8019fa:	55                   	push   %ebp
+  8019fb:	89 e5                	mov    %esp,%ebp
+  8019fd:	83 ec 18             	sub    $0x18,%esp
+  801a00:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801a07:	ff 75 0c             	push   0xc(%ebp)
+  801a0a:	ff 75 08             	push   0x8(%ebp)
+  801a0d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a10:	50                   	push   %eax
+  801a11:	68 c3 19 80 00       	push   $0x8019c3
+  801a16:	e8 00 ec ff ff       	call   80061b <vprintfmt>
+  801a1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a1e:	c9                   	leave
+  801a1f:	c3                   	ret
+
+00801a20 <bprintf>:
+  801a20:	55                   	push   %ebp
+  801a21:	89 e5                	mov    %esp,%ebp
+  801a23:	83 ec 10             	sub    $0x10,%esp
+  801a26:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801a29:	50                   	push   %eax
+  801a2a:	ff 75 08             	push   0x8(%ebp)
+  801a2d:	e8 c8 ff ff ff       	call   8019fa <vbprintf>
+  801a32:	c9                   	leave
+  801a33:	c3                   	ret
+
+00801a34 <bwrite>:
+  801a34:	55                   	push   %ebp
+  801a35:	89 e5                	mov    %esp,%ebp
+  801a37:	53                   	push   %ebx
+  801a38:	83 ec 04             	sub    $0x4,%esp
+  801a3b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a3e:	89 d8                	mov    %ebx,%eax
+  801a40:	03 05 20 80 80 00    	add    0x808020,%eax
+  801a46:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a4b:	76 0d                	jbe    801a5a <bwrite+0x26>
+  801a4d:	e8 47 ff ff ff       	call   801999 <bflush>
+  801a52:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801a58:	77 25                	ja     801a7f <bwrite+0x4b>
+  801a5a:	83 ec 04             	sub    $0x4,%esp
+  801a5d:	53                   	push   %ebx
+  801a5e:	ff 75 08             	push   0x8(%ebp)
+  801a61:	a1 20 80 80 00       	mov    0x808020,%eax
+  801a66:	05 24 80 80 00       	add    $0x808024,%eax
+  801a6b:	50                   	push   %eax
+  801a6c:	e8 15 f3 ff ff       	call   800d86 <memcpy>
+  801a71:	01 1d 20 80 80 00    	add    %ebx,0x808020
+  801a77:	83 c4 10             	add    $0x10,%esp
+  801a7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a7d:	c9                   	leave
+  801a7e:	c3                   	ret
+  801a7f:	83 ec 08             	sub    $0x8,%esp
+  801a82:	53                   	push   %ebx
+  801a83:	ff 75 08             	push   0x8(%ebp)
+  801a86:	e8 fd f4 ff ff       	call   800f88 <sys_cputs>
+  801a8b:	83 c4 10             	add    $0x10,%esp
+  801a8e:	eb ea                	jmp    801a7a <bwrite+0x46>
+
+00801a90 <_panic>:
+  801a90:	55                   	push   %ebp
+  801a91:	89 e5                	mov    %esp,%ebp
+  801a93:	56                   	push   %esi
+  801a94:	53                   	push   %ebx
+  801a95:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  801a98:	e8 fc fe ff ff       	call   801999 <bflush>
+  801a9d:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801aa3:	e8 39 f6 ff ff       	call   8010e1 <sys_getenvid>
+  801aa8:	83 ec 0c             	sub    $0xc,%esp
+  801aab:	ff 75 0c             	push   0xc(%ebp)
+  801aae:	ff 75 08             	push   0x8(%ebp)
+  801ab1:	56                   	push   %esi
+  801ab2:	50                   	push   %eax
+  801ab3:	68 b0 20 80 00       	push   $0x8020b0
+  801ab8:	e8 67 ea ff ff       	call   800524 <cprintf>
+  801abd:	83 c4 18             	add    $0x18,%esp
+  801ac0:	53                   	push   %ebx
+  801ac1:	ff 75 10             	push   0x10(%ebp)
+  801ac4:	e8 0a ea ff ff       	call   8004d3 <vcprintf>
+  801ac9:	c7 04 24 0d 1e 80 00 	movl   $0x801e0d,(%esp)
+  801ad0:	e8 4f ea ff ff       	call   800524 <cprintf>
+  801ad5:	83 c4 10             	add    $0x10,%esp
+  801ad8:	cc                   	int3
+  801ad9:	eb fd                	jmp    801ad8 <_panic+0x48>
+
+00801adb <__udivdi3>:
+  801adb:	57                   	push   %edi
+  801adc:	56                   	push   %esi
+  801add:	53                   	push   %ebx
+  801ade:	83 ec 20             	sub    $0x20,%esp
+  801ae1:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801ae5:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801ae9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801aed:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801af1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801af5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801af9:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801afd:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801b01:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801b05:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801b09:	89 d1                	mov    %edx,%ecx
+  801b0b:	09 c1                	or     %eax,%ecx
+  801b0d:	0f 84 91 00 00 00    	je     801ba4 <__udivdi3+0xc9>
+  801b13:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801b1a:	00 
+  801b1b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801b22:	00 
+  801b23:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801b28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b32:	eb 08                	jmp    801b3c <__udivdi3+0x61>
+  801b34:	83 e9 01             	sub    $0x1,%ecx
+  801b37:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801b3a:	74 68                	je     801ba4 <__udivdi3+0xc9>
+  801b3c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801b40:	01 c0                	add    %eax,%eax
+  801b42:	89 c6                	mov    %eax,%esi
+  801b44:	89 d7                	mov    %edx,%edi
+  801b46:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801b4a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801b4e:	0f ad d0             	shrd   %cl,%edx,%eax
+  801b51:	d3 ea                	shr    %cl,%edx
+  801b53:	f6 c1 20             	test   $0x20,%cl
+  801b56:	74 04                	je     801b5c <__udivdi3+0x81>
+  801b58:	89 d0                	mov    %edx,%eax
+  801b5a:	31 d2                	xor    %edx,%edx
+  801b5c:	83 e0 01             	and    $0x1,%eax
+  801b5f:	89 04 24             	mov    %eax,(%esp)
+  801b62:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801b69:	00 
+  801b6a:	8b 04 24             	mov    (%esp),%eax
+  801b6d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801b71:	09 f0                	or     %esi,%eax
+  801b73:	09 fa                	or     %edi,%edx
+  801b75:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801b79:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801b7d:	39 f0                	cmp    %esi,%eax
+  801b7f:	89 d3                	mov    %edx,%ebx
+  801b81:	19 fb                	sbb    %edi,%ebx
+  801b83:	72 af                	jb     801b34 <__udivdi3+0x59>
+  801b85:	29 f0                	sub    %esi,%eax
+  801b87:	19 fa                	sbb    %edi,%edx
+  801b89:	89 cf                	mov    %ecx,%edi
+  801b8b:	c1 ef 05             	shr    $0x5,%edi
+  801b8e:	83 e7 01             	and    $0x1,%edi
+  801b91:	89 fe                	mov    %edi,%esi
+  801b93:	83 f6 01             	xor    $0x1,%esi
+  801b96:	d3 e6                	shl    %cl,%esi
+  801b98:	d3 e7                	shl    %cl,%edi
+  801b9a:	09 74 24 18          	or     %esi,0x18(%esp)
+  801b9e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  801ba2:	eb 90                	jmp    801b34 <__udivdi3+0x59>
+  801ba4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801ba8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  801bac:	83 c4 20             	add    $0x20,%esp
+  801baf:	5b                   	pop    %ebx
+  801bb0:	5e                   	pop    %esi
+  801bb1:	5f                   	pop    %edi
+  801bb2:	c3                   	ret
+
+00801bb3 <__umoddi3>:
+  801bb3:	55                   	push   %ebp
+  801bb4:	57                   	push   %edi
+  801bb5:	56                   	push   %esi
+  801bb6:	53                   	push   %ebx
+  801bb7:	83 ec 1c             	sub    $0x1c,%esp
+  801bba:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801bbe:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801bc2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801bc6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801bca:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801bce:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801bd2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801bd6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801bda:	89 d6                	mov    %edx,%esi
+  801bdc:	09 c6                	or     %eax,%esi
+  801bde:	74 6c                	je     801c4c <__umoddi3+0x99>
+  801be0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801be5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bea:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bef:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801bf3:	eb 0e                	jmp    801c03 <__umoddi3+0x50>
+  801bf5:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801bfa:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801bfe:	83 fe ff             	cmp    $0xffffffff,%esi
+  801c01:	74 49                	je     801c4c <__umoddi3+0x99>
+  801c03:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801c07:	01 c0                	add    %eax,%eax
+  801c09:	89 c3                	mov    %eax,%ebx
+  801c0b:	89 d6                	mov    %edx,%esi
+  801c0d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801c11:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801c15:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801c1a:	0f ad d0             	shrd   %cl,%edx,%eax
+  801c1d:	d3 ea                	shr    %cl,%edx
+  801c1f:	f6 c1 20             	test   $0x20,%cl
+  801c22:	74 04                	je     801c28 <__umoddi3+0x75>
+  801c24:	89 d0                	mov    %edx,%eax
+  801c26:	31 d2                	xor    %edx,%edx
+  801c28:	83 e0 01             	and    $0x1,%eax
+  801c2b:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801c30:	89 ea                	mov    %ebp,%edx
+  801c32:	09 d8                	or     %ebx,%eax
+  801c34:	09 f2                	or     %esi,%edx
+  801c36:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801c3a:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801c3e:	39 d8                	cmp    %ebx,%eax
+  801c40:	89 d1                	mov    %edx,%ecx
+  801c42:	19 f1                	sbb    %esi,%ecx
+  801c44:	72 af                	jb     801bf5 <__umoddi3+0x42>
+  801c46:	29 d8                	sub    %ebx,%eax
+  801c48:	19 f2                	sbb    %esi,%edx
+  801c4a:	eb a9                	jmp    801bf5 <__umoddi3+0x42>
+  801c4c:	83 c4 1c             	add    $0x1c,%esp
+  801c4f:	5b                   	pop    %ebx
+  801c50:	5e                   	pop    %esi
+  801c51:	5f                   	pop    %edi
+  801c52:	5d                   	pop    %ebp
+  801c53:	c3                   	ret
+
+00801c54 <__divdi3>:
+  801c54:	53                   	push   %ebx
+  801c55:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801c59:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801c5d:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801c61:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801c65:	85 d2                	test   %edx,%edx
+  801c67:	78 12                	js     801c7b <__divdi3+0x27>
+  801c69:	85 db                	test   %ebx,%ebx
+  801c6b:	78 2e                	js     801c9b <__divdi3+0x47>
+  801c6d:	53                   	push   %ebx
+  801c6e:	51                   	push   %ecx
+  801c6f:	52                   	push   %edx
+  801c70:	50                   	push   %eax
+  801c71:	e8 65 fe ff ff       	call   801adb <__udivdi3>
+  801c76:	83 c4 10             	add    $0x10,%esp
+  801c79:	eb 1e                	jmp    801c99 <__divdi3+0x45>
+  801c7b:	f7 d8                	neg    %eax
+  801c7d:	83 d2 00             	adc    $0x0,%edx
+  801c80:	f7 da                	neg    %edx
+  801c82:	85 db                	test   %ebx,%ebx
+  801c84:	78 2a                	js     801cb0 <__divdi3+0x5c>
+  801c86:	53                   	push   %ebx
+  801c87:	51                   	push   %ecx
+  801c88:	52                   	push   %edx
+  801c89:	50                   	push   %eax
+  801c8a:	e8 4c fe ff ff       	call   801adb <__udivdi3>
+  801c8f:	83 c4 10             	add    $0x10,%esp
+  801c92:	f7 d8                	neg    %eax
+  801c94:	83 d2 00             	adc    $0x0,%edx
+  801c97:	f7 da                	neg    %edx
+  801c99:	5b                   	pop    %ebx
+  801c9a:	c3                   	ret
+  801c9b:	f7 d9                	neg    %ecx
+  801c9d:	83 d3 00             	adc    $0x0,%ebx
+  801ca0:	f7 db                	neg    %ebx
+  801ca2:	53                   	push   %ebx
+  801ca3:	51                   	push   %ecx
+  801ca4:	52                   	push   %edx
+  801ca5:	50                   	push   %eax
+  801ca6:	e8 30 fe ff ff       	call   801adb <__udivdi3>
+  801cab:	83 c4 10             	add    $0x10,%esp
+  801cae:	eb e2                	jmp    801c92 <__divdi3+0x3e>
+  801cb0:	f7 d9                	neg    %ecx
+  801cb2:	83 d3 00             	adc    $0x0,%ebx
+  801cb5:	f7 db                	neg    %ebx
+  801cb7:	53                   	push   %ebx
+  801cb8:	51                   	push   %ecx
+  801cb9:	52                   	push   %edx
+  801cba:	50                   	push   %eax
+  801cbb:	e8 1b fe ff ff       	call   801adb <__udivdi3>
+  801cc0:	83 c4 10             	add    $0x10,%esp
+  801cc3:	eb d4                	jmp    801c99 <__divdi3+0x45>
+
+00801cc5 <__moddi3>:
+  801cc5:	55                   	push   %ebp
+  801cc6:	57                   	push   %edi
+  801cc7:	56                   	push   %esi
+  801cc8:	53                   	push   %ebx
+  801cc9:	83 ec 14             	sub    $0x14,%esp
+  801ccc:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801cd0:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801cd4:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801cd8:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801cdc:	85 ed                	test   %ebp,%ebp
+  801cde:	78 2b                	js     801d0b <__moddi3+0x46>
+  801ce0:	89 c6                	mov    %eax,%esi
+  801ce2:	f7 de                	neg    %esi
+  801ce4:	89 34 24             	mov    %esi,(%esp)
+  801ce7:	89 d6                	mov    %edx,%esi
+  801ce9:	83 d6 00             	adc    $0x0,%esi
+  801cec:	f7 de                	neg    %esi
+  801cee:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801cf2:	8b 34 24             	mov    (%esp),%esi
+  801cf5:	0f 48 f0             	cmovs  %eax,%esi
+  801cf8:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801cfd:	52                   	push   %edx
+  801cfe:	56                   	push   %esi
+  801cff:	55                   	push   %ebp
+  801d00:	57                   	push   %edi
+  801d01:	e8 ad fe ff ff       	call   801bb3 <__umoddi3>
+  801d06:	83 c4 10             	add    $0x10,%esp
+  801d09:	eb 3c                	jmp    801d47 <__moddi3+0x82>
+  801d0b:	89 c3                	mov    %eax,%ebx
+  801d0d:	f7 db                	neg    %ebx
+  801d0f:	89 d1                	mov    %edx,%ecx
+  801d11:	83 d1 00             	adc    $0x0,%ecx
+  801d14:	f7 d9                	neg    %ecx
+  801d16:	0f 49 c3             	cmovns %ebx,%eax
+  801d19:	89 04 24             	mov    %eax,(%esp)
+  801d1c:	0f 49 d1             	cmovns %ecx,%edx
+  801d1f:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801d23:	ff 74 24 04          	push   0x4(%esp)
+  801d27:	ff 74 24 04          	push   0x4(%esp)
+  801d2b:	89 f8                	mov    %edi,%eax
+  801d2d:	89 ea                	mov    %ebp,%edx
+  801d2f:	f7 d8                	neg    %eax
+  801d31:	83 d2 00             	adc    $0x0,%edx
+  801d34:	f7 da                	neg    %edx
+  801d36:	52                   	push   %edx
+  801d37:	50                   	push   %eax
+  801d38:	e8 76 fe ff ff       	call   801bb3 <__umoddi3>
+  801d3d:	83 c4 10             	add    $0x10,%esp
+  801d40:	f7 d8                	neg    %eax
+  801d42:	83 d2 00             	adc    $0x0,%edx
+  801d45:	f7 da                	neg    %edx
+  801d47:	83 c4 14             	add    $0x14,%esp
+  801d4a:	5b                   	pop    %ebx
+  801d4b:	5e                   	pop    %esi
+  801d4c:	5f                   	pop    %edi
+  801d4d:	5d                   	pop    %ebp
+  801d4e:	c3                   	ret
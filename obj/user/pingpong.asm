@@ -0,0 +1,3074 @@
+
+obj/user/pingpong:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 8f 00 00 00       	call   8000c0 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	e8 12 17 00 00       	call   801753 <fork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 4f                	jne    800097 <umain+0x64>
+  800048:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80004b:	83 ec 04             	sub    $0x4,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	6a 00                	push   $0x0
+  800052:	56                   	push   %esi
+  800053:	e8 80 18 00 00       	call   8018d8 <ipc_recv>
+  800058:	89 c3                	mov    %eax,%ebx
+  80005a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80005d:	e8 13 0d 00 00       	call   800d75 <sys_getenvid>
+  800062:	57                   	push   %edi
+  800063:	53                   	push   %ebx
+  800064:	50                   	push   %eax
+  800065:	68 36 1f 80 00       	push   $0x801f36
+  80006a:	e8 49 01 00 00       	call   8001b8 <cprintf>
+  80006f:	83 c4 20             	add    $0x20,%esp
+  800072:	83 fb 0a             	cmp    $0xa,%ebx
+  800075:	74 18                	je     80008f <umain+0x5c>
+  800077:	83 c3 01             	add    $0x1,%ebx
+  80007a:	6a 00                	push   $0x0
+  80007c:	6a 00                	push   $0x0
+  80007e:	53                   	push   %ebx
+  80007f:	ff 75 e4             	push   -0x1c(%ebp)
+  800082:	e8 db 18 00 00       	call   801962 <ipc_send>
+  800087:	83 c4 10             	add    $0x10,%esp
+  80008a:	83 fb 0a             	cmp    $0xa,%ebx
+  80008d:	75 bc                	jne    80004b <umain+0x18>
+  80008f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800092:	5b                   	pop    %ebx
+  800093:	5e                   	pop    %esi
+  800094:	5f                   	pop    %edi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+  800097:	89 c3                	mov    %eax,%ebx
+  800099:	e8 d7 0c 00 00       	call   800d75 <sys_getenvid>
+  80009e:	83 ec 04             	sub    $0x4,%esp
+  8000a1:	53                   	push   %ebx
+  8000a2:	50                   	push   %eax
+  8000a3:	68 20 1f 80 00       	push   $0x801f20
+  8000a8:	e8 0b 01 00 00       	call   8001b8 <cprintf>
+  8000ad:	6a 00                	push   $0x0
+  8000af:	6a 00                	push   $0x0
+  8000b1:	6a 00                	push   $0x0
+  8000b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b6:	e8 a7 18 00 00       	call   801962 <ipc_send>
+  8000bb:	83 c4 20             	add    $0x20,%esp
+  8000be:	eb 88                	jmp    800048 <umain+0x15>
+
+008000c0 <libmain>:
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	56                   	push   %esi
+  8000c4:	53                   	push   %ebx
+  8000c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000cb:	e8 6c 19 00 00       	call   801a3c <uinfo_envid>
+  8000d0:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8000d5:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8000db:	05 00 00 00 ed       	add    $0xed000000,%eax
+  8000e0:	a3 20 30 80 00       	mov    %eax,0x803020
+  8000e5:	85 db                	test   %ebx,%ebx
+  8000e7:	7e 07                	jle    8000f0 <libmain+0x30>
+  8000e9:	8b 06                	mov    (%esi),%eax
+  8000eb:	a3 00 30 80 00       	mov    %eax,0x803000
+  8000f0:	83 ec 08             	sub    $0x8,%esp
+  8000f3:	56                   	push   %esi
+  8000f4:	53                   	push   %ebx
+  8000f5:	e8 39 ff ff ff       	call   800033 <umain>
+  8000fa:	e8 0a 00 00 00       	call   800109 <exit>
+  8000ff:	83 c4 10             	add    $0x10,%esp
+  800102:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800105:	5b                   	pop    %ebx
+  800106:	5e                   	pop    %esi
+  800107:	5d                   	pop    %ebp
+  800108:	c3                   	ret
+
+00800109 <exit>:
+  800109:	55                   	push   %ebp
+  80010a:	89 e5                	mov    %esp,%ebp
+  80010c:	83 ec 08             	sub    $0x8,%esp
+  80010f:	e8 c1 19 00 00       	call   801ad5 <bflush>
+  800114:	83 ec 0c             	sub    $0xc,%esp
+  800117:	6a 00                	push   $0x0
+  800119:	e8 cc 0b 00 00       	call   800cea <sys_env_destroy>
+  80011e:	83 c4 10             	add    $0x10,%esp
+  800121:	c9                   	leave
+  800122:	c3                   	ret
+
+00800123 <putch>:
+  800123:	55                   	push   %ebp
+  800124:	89 e5                	mov    %esp,%ebp
+  800126:	53                   	push   %ebx
+  800127:	83 ec 04             	sub    $0x4,%esp
+  80012a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80012d:	8b 13                	mov    (%ebx),%edx
+  80012f:	8d 42 01             	lea    0x1(%edx),%eax
+  800132:	89 03                	mov    %eax,(%ebx)
+  800134:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800137:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80013b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800140:	74 09                	je     80014b <putch+0x28>
+  800142:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800146:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800149:	c9                   	leave
+  80014a:	c3                   	ret
+  80014b:	83 ec 08             	sub    $0x8,%esp
+  80014e:	68 ff 00 00 00       	push   $0xff
+  800153:	8d 43 08             	lea    0x8(%ebx),%eax
+  800156:	50                   	push   %eax
+  800157:	e8 c0 0a 00 00       	call   800c1c <sys_cputs>
+  80015c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800162:	83 c4 10             	add    $0x10,%esp
+  800165:	eb db                	jmp    800142 <putch+0x1f>
+
+00800167 <vcprintf>:
+  800167:	55                   	push   %ebp
+  800168:	89 e5                	mov    %esp,%ebp
+  80016a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800170:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800177:	00 00 00 
+  80017a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800181:	00 00 00 
+  800184:	ff 75 0c             	push   0xc(%ebp)
+  800187:	ff 75 08             	push   0x8(%ebp)
+  80018a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800190:	50                   	push   %eax
+  800191:	68 23 01 80 00       	push   $0x800123
+  800196:	e8 14 01 00 00       	call   8002af <vprintfmt>
+  80019b:	83 c4 08             	add    $0x8,%esp
+  80019e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001a4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001aa:	50                   	push   %eax
+  8001ab:	e8 6c 0a 00 00       	call   800c1c <sys_cputs>
+  8001b0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001b6:	c9                   	leave
+  8001b7:	c3                   	ret
+
+008001b8 <cprintf>:
+  8001b8:	55                   	push   %ebp
+  8001b9:	89 e5                	mov    %esp,%ebp
+  8001bb:	83 ec 10             	sub    $0x10,%esp
+  8001be:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8001c1:	50                   	push   %eax
+  8001c2:	ff 75 08             	push   0x8(%ebp)
+  8001c5:	e8 9d ff ff ff       	call   800167 <vcprintf>
+  8001ca:	c9                   	leave
+  8001cb:	c3                   	ret
+
+008001cc <printnum>:
+  8001cc:	55                   	push   %ebp
+  8001cd:	89 e5                	mov    %esp,%ebp
+  8001cf:	57                   	push   %edi
+  8001d0:	56                   	push   %esi
+  8001d1:	53                   	push   %ebx
+  8001d2:	83 ec 1c             	sub    $0x1c,%esp
+  8001d5:	89 c7                	mov    %eax,%edi
+  8001d7:	89 d6                	mov    %edx,%esi
+  8001d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001df:	89 d1                	mov    %edx,%ecx
+  8001e1:	89 c2                	mov    %eax,%edx
+  8001e3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001e6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001e9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ec:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8001ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001f2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001f9:	39 c2                	cmp    %eax,%edx
+  8001fb:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001fe:	72 3e                	jb     80023e <printnum+0x72>
+  800200:	83 ec 0c             	sub    $0xc,%esp
+  800203:	ff 75 18             	push   0x18(%ebp)
+  800206:	83 eb 01             	sub    $0x1,%ebx
+  800209:	53                   	push   %ebx
+  80020a:	50                   	push   %eax
+  80020b:	83 ec 08             	sub    $0x8,%esp
+  80020e:	ff 75 e4             	push   -0x1c(%ebp)
+  800211:	ff 75 e0             	push   -0x20(%ebp)
+  800214:	ff 75 dc             	push   -0x24(%ebp)
+  800217:	ff 75 d8             	push   -0x28(%ebp)
+  80021a:	e8 8d 1a 00 00       	call   801cac <__udivdi3>
+  80021f:	83 c4 18             	add    $0x18,%esp
+  800222:	52                   	push   %edx
+  800223:	50                   	push   %eax
+  800224:	89 f2                	mov    %esi,%edx
+  800226:	89 f8                	mov    %edi,%eax
+  800228:	e8 9f ff ff ff       	call   8001cc <printnum>
+  80022d:	83 c4 20             	add    $0x20,%esp
+  800230:	eb 13                	jmp    800245 <printnum+0x79>
+  800232:	83 ec 08             	sub    $0x8,%esp
+  800235:	56                   	push   %esi
+  800236:	ff 75 18             	push   0x18(%ebp)
+  800239:	ff d7                	call   *%edi
+  80023b:	83 c4 10             	add    $0x10,%esp
+  80023e:	83 eb 01             	sub    $0x1,%ebx
+  800241:	85 db                	test   %ebx,%ebx
+  800243:	7f ed                	jg     800232 <printnum+0x66>
+  800245:	83 ec 08             	sub    $0x8,%esp
+  800248:	56                   	push   %esi
+  800249:	83 ec 04             	sub    $0x4,%esp
+  80024c:	ff 75 e4             	push   -0x1c(%ebp)
+  80024f:	ff 75 e0             	push   -0x20(%ebp)
+  800252:	ff 75 dc             	push   -0x24(%ebp)
+  800255:	ff 75 d8             	push   -0x28(%ebp)
+  800258:	e8 27 1b 00 00       	call   801d84 <__umoddi3>
+  80025d:	83 c4 14             	add    $0x14,%esp
+  800260:	0f be 80 53 1f 80 00 	movsbl 0x801f53(%eax),%eax
+  800267:	50                   	push   %eax
+  800268:	ff d7                	call   *%edi
+  80026a:	83 c4 10             	add    $0x10,%esp
+  80026d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800270:	5b                   	pop    %ebx
+  800271:	5e                   	pop    %esi
+  800272:	5f                   	pop    %edi
+  800273:	5d                   	pop    %ebp
+  800274:	c3                   	ret
+
+00800275 <sprintputch>:
+  800275:	55                   	push   %ebp
+  800276:	89 e5                	mov    %esp,%ebp
+  800278:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80027b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80027f:	8b 10                	mov    (%eax),%edx
+  800281:	3b 50 04             	cmp    0x4(%eax),%edx
+  800284:	73 0a                	jae    800290 <sprintputch+0x1b>
+  800286:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800289:	89 08                	mov    %ecx,(%eax)
+  80028b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028e:	88 02                	mov    %al,(%edx)
+  800290:	5d                   	pop    %ebp
+  800291:	c3                   	ret
+
+00800292 <printfmt>:
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	83 ec 08             	sub    $0x8,%esp
+  800298:	8d 45 14             	lea    0x14(%ebp),%eax
+  80029b:	50                   	push   %eax
+  80029c:	ff 75 10             	push   0x10(%ebp)
+  80029f:	ff 75 0c             	push   0xc(%ebp)
+  8002a2:	ff 75 08             	push   0x8(%ebp)
+  8002a5:	e8 05 00 00 00       	call   8002af <vprintfmt>
+  8002aa:	83 c4 10             	add    $0x10,%esp
+  8002ad:	c9                   	leave
+  8002ae:	c3                   	ret
+
+008002af <vprintfmt>:
+  8002af:	55                   	push   %ebp
+  8002b0:	89 e5                	mov    %esp,%ebp
+  8002b2:	57                   	push   %edi
+  8002b3:	56                   	push   %esi
+  8002b4:	53                   	push   %ebx
+  8002b5:	83 ec 2c             	sub    $0x2c,%esp
+  8002b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002be:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002c1:	eb 0a                	jmp    8002cd <vprintfmt+0x1e>
+  8002c3:	83 ec 08             	sub    $0x8,%esp
+  8002c6:	53                   	push   %ebx
+  8002c7:	50                   	push   %eax
+  8002c8:	ff d6                	call   *%esi
+  8002ca:	83 c4 10             	add    $0x10,%esp
+  8002cd:	83 c7 01             	add    $0x1,%edi
+  8002d0:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002d4:	83 f8 25             	cmp    $0x25,%eax
+  8002d7:	74 0c                	je     8002e5 <vprintfmt+0x36>
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	75 e6                	jne    8002c3 <vprintfmt+0x14>
+  8002dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e0:	5b                   	pop    %ebx
+  8002e1:	5e                   	pop    %esi
+  8002e2:	5f                   	pop    %edi
+  8002e3:	5d                   	pop    %ebp
+  8002e4:	c3                   	ret
+  8002e5:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  8002e9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8002f0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8002f7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  8002fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800303:	8d 47 01             	lea    0x1(%edi),%eax
+  800306:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800309:	0f b6 17             	movzbl (%edi),%edx
+  80030c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80030f:	3c 55                	cmp    $0x55,%al
+  800311:	0f 87 cf 03 00 00    	ja     8006e6 <vprintfmt+0x437>
+  800317:	0f b6 c0             	movzbl %al,%eax
+  80031a:	ff 24 85 20 20 80 00 	jmp    *0x802020(,%eax,4)
+  800321:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800324:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800328:	eb d9                	jmp    800303 <vprintfmt+0x54>
+  80032a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80032d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800331:	eb d0                	jmp    800303 <vprintfmt+0x54>
+  800333:	0f b6 d2             	movzbl %dl,%edx
+  800336:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800339:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800341:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800344:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800348:	0f be 17             	movsbl (%edi),%edx
+  80034b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80034e:	83 f9 09             	cmp    $0x9,%ecx
+  800351:	77 55                	ja     8003a8 <vprintfmt+0xf9>
+  800353:	83 c7 01             	add    $0x1,%edi
+  800356:	eb e9                	jmp    800341 <vprintfmt+0x92>
+  800358:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035b:	8b 00                	mov    (%eax),%eax
+  80035d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800360:	8b 45 14             	mov    0x14(%ebp),%eax
+  800363:	8d 40 04             	lea    0x4(%eax),%eax
+  800366:	89 45 14             	mov    %eax,0x14(%ebp)
+  800369:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80036c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800370:	79 91                	jns    800303 <vprintfmt+0x54>
+  800372:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800375:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800378:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80037f:	eb 82                	jmp    800303 <vprintfmt+0x54>
+  800381:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800384:	85 d2                	test   %edx,%edx
+  800386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038b:	0f 49 c2             	cmovns %edx,%eax
+  80038e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800391:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800394:	e9 6a ff ff ff       	jmp    800303 <vprintfmt+0x54>
+  800399:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80039c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8003a3:	e9 5b ff ff ff       	jmp    800303 <vprintfmt+0x54>
+  8003a8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ae:	eb bc                	jmp    80036c <vprintfmt+0xbd>
+  8003b0:	83 c1 01             	add    $0x1,%ecx
+  8003b3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003b6:	e9 48 ff ff ff       	jmp    800303 <vprintfmt+0x54>
+  8003bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003be:	8d 78 04             	lea    0x4(%eax),%edi
+  8003c1:	83 ec 08             	sub    $0x8,%esp
+  8003c4:	53                   	push   %ebx
+  8003c5:	ff 30                	push   (%eax)
+  8003c7:	ff d6                	call   *%esi
+  8003c9:	83 c4 10             	add    $0x10,%esp
+  8003cc:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003cf:	e9 b1 02 00 00       	jmp    800685 <vprintfmt+0x3d6>
+  8003d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d7:	8d 78 04             	lea    0x4(%eax),%edi
+  8003da:	8b 10                	mov    (%eax),%edx
+  8003dc:	89 d0                	mov    %edx,%eax
+  8003de:	f7 d8                	neg    %eax
+  8003e0:	0f 48 c2             	cmovs  %edx,%eax
+  8003e3:	83 f8 08             	cmp    $0x8,%eax
+  8003e6:	7f 23                	jg     80040b <vprintfmt+0x15c>
+  8003e8:	8b 14 85 80 21 80 00 	mov    0x802180(,%eax,4),%edx
+  8003ef:	85 d2                	test   %edx,%edx
+  8003f1:	74 18                	je     80040b <vprintfmt+0x15c>
+  8003f3:	52                   	push   %edx
+  8003f4:	68 74 1f 80 00       	push   $0x801f74
+  8003f9:	53                   	push   %ebx
+  8003fa:	56                   	push   %esi
+  8003fb:	e8 92 fe ff ff       	call   800292 <printfmt>
+  800400:	83 c4 10             	add    $0x10,%esp
+  800403:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800406:	e9 7a 02 00 00       	jmp    800685 <vprintfmt+0x3d6>
+  80040b:	50                   	push   %eax
+  80040c:	68 6b 1f 80 00       	push   $0x801f6b
+  800411:	53                   	push   %ebx
+  800412:	56                   	push   %esi
+  800413:	e8 7a fe ff ff       	call   800292 <printfmt>
+  800418:	83 c4 10             	add    $0x10,%esp
+  80041b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80041e:	e9 62 02 00 00       	jmp    800685 <vprintfmt+0x3d6>
+  800423:	8b 45 14             	mov    0x14(%ebp),%eax
+  800426:	83 c0 04             	add    $0x4,%eax
+  800429:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80042c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042f:	8b 08                	mov    (%eax),%ecx
+  800431:	85 c9                	test   %ecx,%ecx
+  800433:	b8 64 1f 80 00       	mov    $0x801f64,%eax
+  800438:	0f 45 c1             	cmovne %ecx,%eax
+  80043b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80043e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800442:	7e 06                	jle    80044a <vprintfmt+0x19b>
+  800444:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800448:	75 0b                	jne    800455 <vprintfmt+0x1a6>
+  80044a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80044d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800450:	89 75 08             	mov    %esi,0x8(%ebp)
+  800453:	eb 5c                	jmp    8004b1 <vprintfmt+0x202>
+  800455:	83 ec 08             	sub    $0x8,%esp
+  800458:	ff 75 d0             	push   -0x30(%ebp)
+  80045b:	ff 75 cc             	push   -0x34(%ebp)
+  80045e:	e8 87 03 00 00       	call   8007ea <strnlen>
+  800463:	89 c2                	mov    %eax,%edx
+  800465:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800468:	29 d0                	sub    %edx,%eax
+  80046a:	83 c4 10             	add    $0x10,%esp
+  80046d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800471:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800474:	89 75 08             	mov    %esi,0x8(%ebp)
+  800477:	89 c6                	mov    %eax,%esi
+  800479:	eb 0e                	jmp    800489 <vprintfmt+0x1da>
+  80047b:	83 ec 08             	sub    $0x8,%esp
+  80047e:	53                   	push   %ebx
+  80047f:	57                   	push   %edi
+  800480:	ff 55 08             	call   *0x8(%ebp)
+  800483:	83 ee 01             	sub    $0x1,%esi
+  800486:	83 c4 10             	add    $0x10,%esp
+  800489:	85 f6                	test   %esi,%esi
+  80048b:	7f ee                	jg     80047b <vprintfmt+0x1cc>
+  80048d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800490:	8b 75 08             	mov    0x8(%ebp),%esi
+  800493:	85 c0                	test   %eax,%eax
+  800495:	ba 00 00 00 00       	mov    $0x0,%edx
+  80049a:	0f 49 d0             	cmovns %eax,%edx
+  80049d:	29 d0                	sub    %edx,%eax
+  80049f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004a2:	eb a6                	jmp    80044a <vprintfmt+0x19b>
+  8004a4:	83 ec 08             	sub    $0x8,%esp
+  8004a7:	53                   	push   %ebx
+  8004a8:	52                   	push   %edx
+  8004a9:	ff 55 08             	call   *0x8(%ebp)
+  8004ac:	83 c4 10             	add    $0x10,%esp
+  8004af:	89 f1                	mov    %esi,%ecx
+  8004b1:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004b4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004b8:	0f be d0             	movsbl %al,%edx
+  8004bb:	85 d2                	test   %edx,%edx
+  8004bd:	74 28                	je     8004e7 <vprintfmt+0x238>
+  8004bf:	85 ff                	test   %edi,%edi
+  8004c1:	78 05                	js     8004c8 <vprintfmt+0x219>
+  8004c3:	83 ef 01             	sub    $0x1,%edi
+  8004c6:	78 30                	js     8004f8 <vprintfmt+0x249>
+  8004c8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004cc:	74 d6                	je     8004a4 <vprintfmt+0x1f5>
+  8004ce:	0f be c0             	movsbl %al,%eax
+  8004d1:	83 e8 20             	sub    $0x20,%eax
+  8004d4:	83 f8 5e             	cmp    $0x5e,%eax
+  8004d7:	76 cb                	jbe    8004a4 <vprintfmt+0x1f5>
+  8004d9:	83 ec 08             	sub    $0x8,%esp
+  8004dc:	53                   	push   %ebx
+  8004dd:	6a 3f                	push   $0x3f
+  8004df:	ff 55 08             	call   *0x8(%ebp)
+  8004e2:	83 c4 10             	add    $0x10,%esp
+  8004e5:	eb c8                	jmp    8004af <vprintfmt+0x200>
+  8004e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ea:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ed:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004f0:	01 d0                	add    %edx,%eax
+  8004f2:	29 c8                	sub    %ecx,%eax
+  8004f4:	89 c7                	mov    %eax,%edi
+  8004f6:	eb 13                	jmp    80050b <vprintfmt+0x25c>
+  8004f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004fb:	eb ed                	jmp    8004ea <vprintfmt+0x23b>
+  8004fd:	83 ec 08             	sub    $0x8,%esp
+  800500:	53                   	push   %ebx
+  800501:	6a 20                	push   $0x20
+  800503:	ff d6                	call   *%esi
+  800505:	83 ef 01             	sub    $0x1,%edi
+  800508:	83 c4 10             	add    $0x10,%esp
+  80050b:	85 ff                	test   %edi,%edi
+  80050d:	7f ee                	jg     8004fd <vprintfmt+0x24e>
+  80050f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800512:	89 45 14             	mov    %eax,0x14(%ebp)
+  800515:	e9 6b 01 00 00       	jmp    800685 <vprintfmt+0x3d6>
+  80051a:	83 f9 01             	cmp    $0x1,%ecx
+  80051d:	7f 1f                	jg     80053e <vprintfmt+0x28f>
+  80051f:	85 c9                	test   %ecx,%ecx
+  800521:	74 67                	je     80058a <vprintfmt+0x2db>
+  800523:	8b 45 14             	mov    0x14(%ebp),%eax
+  800526:	8b 00                	mov    (%eax),%eax
+  800528:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052b:	89 c1                	mov    %eax,%ecx
+  80052d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800530:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800533:	8b 45 14             	mov    0x14(%ebp),%eax
+  800536:	8d 40 04             	lea    0x4(%eax),%eax
+  800539:	89 45 14             	mov    %eax,0x14(%ebp)
+  80053c:	eb 17                	jmp    800555 <vprintfmt+0x2a6>
+  80053e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800541:	8b 50 04             	mov    0x4(%eax),%edx
+  800544:	8b 00                	mov    (%eax),%eax
+  800546:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800549:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80054c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054f:	8d 40 08             	lea    0x8(%eax),%eax
+  800552:	89 45 14             	mov    %eax,0x14(%ebp)
+  800555:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800558:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80055b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800560:	85 c9                	test   %ecx,%ecx
+  800562:	0f 89 03 01 00 00    	jns    80066b <vprintfmt+0x3bc>
+  800568:	83 ec 08             	sub    $0x8,%esp
+  80056b:	53                   	push   %ebx
+  80056c:	6a 2d                	push   $0x2d
+  80056e:	ff d6                	call   *%esi
+  800570:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800573:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800576:	f7 da                	neg    %edx
+  800578:	83 d1 00             	adc    $0x0,%ecx
+  80057b:	f7 d9                	neg    %ecx
+  80057d:	83 c4 10             	add    $0x10,%esp
+  800580:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800585:	e9 e1 00 00 00       	jmp    80066b <vprintfmt+0x3bc>
+  80058a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058d:	8b 00                	mov    (%eax),%eax
+  80058f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800592:	89 c1                	mov    %eax,%ecx
+  800594:	c1 f9 1f             	sar    $0x1f,%ecx
+  800597:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80059a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059d:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a3:	eb b0                	jmp    800555 <vprintfmt+0x2a6>
+  8005a5:	83 f9 01             	cmp    $0x1,%ecx
+  8005a8:	7f 1e                	jg     8005c8 <vprintfmt+0x319>
+  8005aa:	85 c9                	test   %ecx,%ecx
+  8005ac:	74 32                	je     8005e0 <vprintfmt+0x331>
+  8005ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b1:	8b 10                	mov    (%eax),%edx
+  8005b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005be:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005c3:	e9 a3 00 00 00       	jmp    80066b <vprintfmt+0x3bc>
+  8005c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cb:	8b 10                	mov    (%eax),%edx
+  8005cd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005d0:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005db:	e9 8b 00 00 00       	jmp    80066b <vprintfmt+0x3bc>
+  8005e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e3:	8b 10                	mov    (%eax),%edx
+  8005e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ed:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005f5:	eb 74                	jmp    80066b <vprintfmt+0x3bc>
+  8005f7:	83 f9 01             	cmp    $0x1,%ecx
+  8005fa:	7f 1b                	jg     800617 <vprintfmt+0x368>
+  8005fc:	85 c9                	test   %ecx,%ecx
+  8005fe:	74 2c                	je     80062c <vprintfmt+0x37d>
+  800600:	8b 45 14             	mov    0x14(%ebp),%eax
+  800603:	8b 10                	mov    (%eax),%edx
+  800605:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80060a:	8d 40 04             	lea    0x4(%eax),%eax
+  80060d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800610:	bf 08 00 00 00       	mov    $0x8,%edi
+  800615:	eb 54                	jmp    80066b <vprintfmt+0x3bc>
+  800617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061a:	8b 10                	mov    (%eax),%edx
+  80061c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80061f:	8d 40 08             	lea    0x8(%eax),%eax
+  800622:	89 45 14             	mov    %eax,0x14(%ebp)
+  800625:	bf 08 00 00 00       	mov    $0x8,%edi
+  80062a:	eb 3f                	jmp    80066b <vprintfmt+0x3bc>
+  80062c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062f:	8b 10                	mov    (%eax),%edx
+  800631:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800636:	8d 40 04             	lea    0x4(%eax),%eax
+  800639:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063c:	bf 08 00 00 00       	mov    $0x8,%edi
+  800641:	eb 28                	jmp    80066b <vprintfmt+0x3bc>
+  800643:	83 ec 08             	sub    $0x8,%esp
+  800646:	53                   	push   %ebx
+  800647:	6a 30                	push   $0x30
+  800649:	ff d6                	call   *%esi
+  80064b:	83 c4 08             	add    $0x8,%esp
+  80064e:	53                   	push   %ebx
+  80064f:	6a 78                	push   $0x78
+  800651:	ff d6                	call   *%esi
+  800653:	8b 45 14             	mov    0x14(%ebp),%eax
+  800656:	8b 10                	mov    (%eax),%edx
+  800658:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065d:	83 c4 10             	add    $0x10,%esp
+  800660:	8d 40 04             	lea    0x4(%eax),%eax
+  800663:	89 45 14             	mov    %eax,0x14(%ebp)
+  800666:	bf 10 00 00 00       	mov    $0x10,%edi
+  80066b:	83 ec 0c             	sub    $0xc,%esp
+  80066e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800672:	50                   	push   %eax
+  800673:	ff 75 e0             	push   -0x20(%ebp)
+  800676:	57                   	push   %edi
+  800677:	51                   	push   %ecx
+  800678:	52                   	push   %edx
+  800679:	89 da                	mov    %ebx,%edx
+  80067b:	89 f0                	mov    %esi,%eax
+  80067d:	e8 4a fb ff ff       	call   8001cc <printnum>
+  800682:	83 c4 20             	add    $0x20,%esp
+  800685:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800688:	e9 40 fc ff ff       	jmp    8002cd <vprintfmt+0x1e>
+  80068d:	83 f9 01             	cmp    $0x1,%ecx
+  800690:	7f 1b                	jg     8006ad <vprintfmt+0x3fe>
+  800692:	85 c9                	test   %ecx,%ecx
+  800694:	74 2c                	je     8006c2 <vprintfmt+0x413>
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8b 10                	mov    (%eax),%edx
+  80069b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a6:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006ab:	eb be                	jmp    80066b <vprintfmt+0x3bc>
+  8006ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b0:	8b 10                	mov    (%eax),%edx
+  8006b2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b5:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bb:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006c0:	eb a9                	jmp    80066b <vprintfmt+0x3bc>
+  8006c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c5:	8b 10                	mov    (%eax),%edx
+  8006c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d2:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006d7:	eb 92                	jmp    80066b <vprintfmt+0x3bc>
+  8006d9:	83 ec 08             	sub    $0x8,%esp
+  8006dc:	53                   	push   %ebx
+  8006dd:	6a 25                	push   $0x25
+  8006df:	ff d6                	call   *%esi
+  8006e1:	83 c4 10             	add    $0x10,%esp
+  8006e4:	eb 9f                	jmp    800685 <vprintfmt+0x3d6>
+  8006e6:	83 ec 08             	sub    $0x8,%esp
+  8006e9:	53                   	push   %ebx
+  8006ea:	6a 25                	push   $0x25
+  8006ec:	ff d6                	call   *%esi
+  8006ee:	83 c4 10             	add    $0x10,%esp
+  8006f1:	89 f8                	mov    %edi,%eax
+  8006f3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006f7:	74 05                	je     8006fe <vprintfmt+0x44f>
+  8006f9:	83 e8 01             	sub    $0x1,%eax
+  8006fc:	eb f5                	jmp    8006f3 <vprintfmt+0x444>
+  8006fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800701:	eb 82                	jmp    800685 <vprintfmt+0x3d6>
+
+00800703 <vsnprintf>:
+  800703:	55                   	push   %ebp
+  800704:	89 e5                	mov    %esp,%ebp
+  800706:	83 ec 18             	sub    $0x18,%esp
+  800709:	8b 45 08             	mov    0x8(%ebp),%eax
+  80070c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80070f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800712:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800716:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800719:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800720:	85 c0                	test   %eax,%eax
+  800722:	74 26                	je     80074a <vsnprintf+0x47>
+  800724:	85 d2                	test   %edx,%edx
+  800726:	7e 22                	jle    80074a <vsnprintf+0x47>
+  800728:	ff 75 14             	push   0x14(%ebp)
+  80072b:	ff 75 10             	push   0x10(%ebp)
+  80072e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800731:	50                   	push   %eax
+  800732:	68 75 02 80 00       	push   $0x800275
+  800737:	e8 73 fb ff ff       	call   8002af <vprintfmt>
+  80073c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80073f:	c6 00 00             	movb   $0x0,(%eax)
+  800742:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800745:	83 c4 10             	add    $0x10,%esp
+  800748:	c9                   	leave
+  800749:	c3                   	ret
+  80074a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80074f:	eb f7                	jmp    800748 <vsnprintf+0x45>
+
+00800751 <snprintf>:
+  800751:	55                   	push   %ebp
+  800752:	89 e5                	mov    %esp,%ebp
+  800754:	83 ec 08             	sub    $0x8,%esp
+  800757:	8d 45 14             	lea    0x14(%ebp),%eax
+  80075a:	50                   	push   %eax
+  80075b:	ff 75 10             	push   0x10(%ebp)
+  80075e:	ff 75 0c             	push   0xc(%ebp)
+  800761:	ff 75 08             	push   0x8(%ebp)
+  800764:	e8 9a ff ff ff       	call   800703 <vsnprintf>
+  800769:	c9                   	leave
+  80076a:	c3                   	ret
+
+0080076b <copy_fwd>:
+  80076b:	55                   	push   %ebp
+  80076c:	89 e5                	mov    %esp,%ebp
+  80076e:	57                   	push   %edi
+  80076f:	56                   	push   %esi
+  800770:	53                   	push   %ebx
+  800771:	89 c7                	mov    %eax,%edi
+  800773:	89 d6                	mov    %edx,%esi
+  800775:	89 c8                	mov    %ecx,%eax
+  800777:	83 f9 0f             	cmp    $0xf,%ecx
+  80077a:	76 1c                	jbe    800798 <copy_fwd+0x2d>
+  80077c:	89 f9                	mov    %edi,%ecx
+  80077e:	f7 d9                	neg    %ecx
+  800780:	89 cb                	mov    %ecx,%ebx
+  800782:	83 e3 03             	and    $0x3,%ebx
+  800785:	29 d8                	sub    %ebx,%eax
+  800787:	89 c2                	mov    %eax,%edx
+  800789:	c1 ea 02             	shr    $0x2,%edx
+  80078c:	83 e0 03             	and    $0x3,%eax
+  80078f:	89 d9                	mov    %ebx,%ecx
+  800791:	fc                   	cld
+  800792:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800794:	89 d1                	mov    %edx,%ecx
+  800796:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800798:	89 c1                	mov    %eax,%ecx
+  80079a:	fc                   	cld
+  80079b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80079d:	5b                   	pop    %ebx
+  80079e:	5e                   	pop    %esi
+  80079f:	5f                   	pop    %edi
+  8007a0:	5d                   	pop    %ebp
+  8007a1:	c3                   	ret
+
+008007a2 <have_sse2>:
+  8007a2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007a9:	78 06                	js     8007b1 <have_sse2+0xf>
+  8007ab:	a1 04 30 80 00       	mov    0x803004,%eax
+  8007b0:	c3                   	ret
+  8007b1:	55                   	push   %ebp
+  8007b2:	89 e5                	mov    %esp,%ebp
+  8007b4:	53                   	push   %ebx
+  8007b5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007ba:	0f a2                	cpuid
+  8007bc:	c1 ea 1a             	shr    $0x1a,%edx
+  8007bf:	83 e2 01             	and    $0x1,%edx
+  8007c2:	89 15 04 30 80 00    	mov    %edx,0x803004
+  8007c8:	a1 04 30 80 00       	mov    0x803004,%eax
+  8007cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007d0:	c9                   	leave
+  8007d1:	c3                   	ret
+
+008007d2 <strlen>:
+  8007d2:	55                   	push   %ebp
+  8007d3:	89 e5                	mov    %esp,%ebp
+  8007d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007dd:	eb 03                	jmp    8007e2 <strlen+0x10>
+  8007df:	83 c0 01             	add    $0x1,%eax
+  8007e2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007e6:	75 f7                	jne    8007df <strlen+0xd>
+  8007e8:	5d                   	pop    %ebp
+  8007e9:	c3                   	ret
+
+008007ea <strnlen>:
+  8007ea:	55                   	push   %ebp
+  8007eb:	89 e5                	mov    %esp,%ebp
+  8007ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f8:	eb 03                	jmp    8007fd <strnlen+0x13>
+  8007fa:	83 c0 01             	add    $0x1,%eax
+  8007fd:	39 d0                	cmp    %edx,%eax
+  8007ff:	74 08                	je     800809 <strnlen+0x1f>
+  800801:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800805:	75 f3                	jne    8007fa <strnlen+0x10>
+  800807:	89 c2                	mov    %eax,%edx
+  800809:	89 d0                	mov    %edx,%eax
+  80080b:	5d                   	pop    %ebp
+  80080c:	c3                   	ret
+
+0080080d <strcpy>:
+  80080d:	55                   	push   %ebp
+  80080e:	89 e5                	mov    %esp,%ebp
+  800810:	53                   	push   %ebx
+  800811:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800814:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800820:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800823:	83 c0 01             	add    $0x1,%eax
+  800826:	84 d2                	test   %dl,%dl
+  800828:	75 f2                	jne    80081c <strcpy+0xf>
+  80082a:	89 c8                	mov    %ecx,%eax
+  80082c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80082f:	c9                   	leave
+  800830:	c3                   	ret
+
+00800831 <strcat>:
+  800831:	55                   	push   %ebp
+  800832:	89 e5                	mov    %esp,%ebp
+  800834:	53                   	push   %ebx
+  800835:	83 ec 10             	sub    $0x10,%esp
+  800838:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80083b:	53                   	push   %ebx
+  80083c:	e8 91 ff ff ff       	call   8007d2 <strlen>
+  800841:	83 c4 08             	add    $0x8,%esp
+  800844:	ff 75 0c             	push   0xc(%ebp)
+  800847:	01 d8                	add    %ebx,%eax
+  800849:	50                   	push   %eax
+  80084a:	e8 be ff ff ff       	call   80080d <strcpy>
+  80084f:	89 d8                	mov    %ebx,%eax
+  800851:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800854:	c9                   	leave
+  800855:	c3                   	ret
+
+00800856 <strncpy>:
+  800856:	55                   	push   %ebp
+  800857:	89 e5                	mov    %esp,%ebp
+  800859:	56                   	push   %esi
+  80085a:	53                   	push   %ebx
+  80085b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80085e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800861:	89 f3                	mov    %esi,%ebx
+  800863:	03 5d 10             	add    0x10(%ebp),%ebx
+  800866:	89 f0                	mov    %esi,%eax
+  800868:	eb 0f                	jmp    800879 <strncpy+0x23>
+  80086a:	83 c0 01             	add    $0x1,%eax
+  80086d:	0f b6 0a             	movzbl (%edx),%ecx
+  800870:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800873:	80 f9 01             	cmp    $0x1,%cl
+  800876:	83 da ff             	sbb    $0xffffffff,%edx
+  800879:	39 d8                	cmp    %ebx,%eax
+  80087b:	75 ed                	jne    80086a <strncpy+0x14>
+  80087d:	89 f0                	mov    %esi,%eax
+  80087f:	5b                   	pop    %ebx
+  800880:	5e                   	pop    %esi
+  800881:	5d                   	pop    %ebp
+  800882:	c3                   	ret
+
+00800883 <strlcpy>:
+  800883:	55                   	push   %ebp
+  800884:	89 e5                	mov    %esp,%ebp
+  800886:	56                   	push   %esi
+  800887:	53                   	push   %ebx
+  800888:	8b 75 08             	mov    0x8(%ebp),%esi
+  80088b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80088e:	8b 55 10             	mov    0x10(%ebp),%edx
+  800891:	89 f0                	mov    %esi,%eax
+  800893:	85 d2                	test   %edx,%edx
+  800895:	74 21                	je     8008b8 <strlcpy+0x35>
+  800897:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80089b:	89 f2                	mov    %esi,%edx
+  80089d:	eb 09                	jmp    8008a8 <strlcpy+0x25>
+  80089f:	83 c1 01             	add    $0x1,%ecx
+  8008a2:	83 c2 01             	add    $0x1,%edx
+  8008a5:	88 5a ff             	mov    %bl,-0x1(%edx)
+  8008a8:	39 c2                	cmp    %eax,%edx
+  8008aa:	74 09                	je     8008b5 <strlcpy+0x32>
+  8008ac:	0f b6 19             	movzbl (%ecx),%ebx
+  8008af:	84 db                	test   %bl,%bl
+  8008b1:	75 ec                	jne    80089f <strlcpy+0x1c>
+  8008b3:	89 d0                	mov    %edx,%eax
+  8008b5:	c6 00 00             	movb   $0x0,(%eax)
+  8008b8:	29 f0                	sub    %esi,%eax
+  8008ba:	5b                   	pop    %ebx
+  8008bb:	5e                   	pop    %esi
+  8008bc:	5d                   	pop    %ebp
+  8008bd:	c3                   	ret
+
+008008be <strcmp>:
+  8008be:	55                   	push   %ebp
+  8008bf:	89 e5                	mov    %esp,%ebp
+  8008c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008c7:	eb 06                	jmp    8008cf <strcmp+0x11>
+  8008c9:	83 c1 01             	add    $0x1,%ecx
+  8008cc:	83 c2 01             	add    $0x1,%edx
+  8008cf:	0f b6 01             	movzbl (%ecx),%eax
+  8008d2:	84 c0                	test   %al,%al
+  8008d4:	74 04                	je     8008da <strcmp+0x1c>
+  8008d6:	3a 02                	cmp    (%edx),%al
+  8008d8:	74 ef                	je     8008c9 <strcmp+0xb>
+  8008da:	0f b6 c0             	movzbl %al,%eax
+  8008dd:	0f b6 12             	movzbl (%edx),%edx
+  8008e0:	29 d0                	sub    %edx,%eax
+  8008e2:	5d                   	pop    %ebp
+  8008e3:	c3                   	ret
+
+008008e4 <strncmp>:
+  8008e4:	55                   	push   %ebp
+  8008e5:	89 e5                	mov    %esp,%ebp
+  8008e7:	53                   	push   %ebx
+  8008e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ee:	8b 55 10             	mov    0x10(%ebp),%edx
+  8008f1:	eb 09                	jmp    8008fc <strncmp+0x18>
+  8008f3:	83 ea 01             	sub    $0x1,%edx
+  8008f6:	83 c0 01             	add    $0x1,%eax
+  8008f9:	83 c1 01             	add    $0x1,%ecx
+  8008fc:	85 d2                	test   %edx,%edx
+  8008fe:	74 18                	je     800918 <strncmp+0x34>
+  800900:	0f b6 18             	movzbl (%eax),%ebx
+  800903:	84 db                	test   %bl,%bl
+  800905:	74 04                	je     80090b <strncmp+0x27>
+  800907:	3a 19                	cmp    (%ecx),%bl
+  800909:	74 e8                	je     8008f3 <strncmp+0xf>
+  80090b:	0f b6 00             	movzbl (%eax),%eax
+  80090e:	0f b6 11             	movzbl (%ecx),%edx
+  800911:	29 d0                	sub    %edx,%eax
+  800913:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800916:	c9                   	leave
+  800917:	c3                   	ret
+  800918:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091d:	eb f4                	jmp    800913 <strncmp+0x2f>
+
+0080091f <strchr>:
+  80091f:	55                   	push   %ebp
+  800920:	89 e5                	mov    %esp,%ebp
+  800922:	8b 45 08             	mov    0x8(%ebp),%eax
+  800925:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800929:	eb 03                	jmp    80092e <strchr+0xf>
+  80092b:	83 c0 01             	add    $0x1,%eax
+  80092e:	0f b6 10             	movzbl (%eax),%edx
+  800931:	84 d2                	test   %dl,%dl
+  800933:	74 06                	je     80093b <strchr+0x1c>
+  800935:	38 ca                	cmp    %cl,%dl
+  800937:	75 f2                	jne    80092b <strchr+0xc>
+  800939:	eb 05                	jmp    800940 <strchr+0x21>
+  80093b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800940:	5d                   	pop    %ebp
+  800941:	c3                   	ret
+
+00800942 <strfind>:
+  800942:	55                   	push   %ebp
+  800943:	89 e5                	mov    %esp,%ebp
+  800945:	8b 45 08             	mov    0x8(%ebp),%eax
+  800948:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80094c:	0f b6 10             	movzbl (%eax),%edx
+  80094f:	38 ca                	cmp    %cl,%dl
+  800951:	74 09                	je     80095c <strfind+0x1a>
+  800953:	84 d2                	test   %dl,%dl
+  800955:	74 05                	je     80095c <strfind+0x1a>
+  800957:	83 c0 01             	add    $0x1,%eax
+  80095a:	eb f0                	jmp    80094c <strfind+0xa>
+  80095c:	5d                   	pop    %ebp
+  80095d:	c3                   	ret
+
+0080095e <memset>:
+  80095e:	55                   	push   %ebp
+  80095f:	89 e5                	mov    %esp,%ebp
+  800961:	57                   	push   %edi
+  800962:	56                   	push   %esi
+  800963:	53                   	push   %ebx
+  800964:	83 ec 04             	sub    $0x4,%esp
+  800967:	8b 75 08             	mov    0x8(%ebp),%esi
+  80096a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80096d:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  800971:	89 f7                	mov    %esi,%edi
+  800973:	83 fa 0f             	cmp    $0xf,%edx
+  800976:	76 24                	jbe    80099c <memset+0x3e>
+  800978:	89 f1                	mov    %esi,%ecx
+  80097a:	f7 d9                	neg    %ecx
+  80097c:	83 e1 03             	and    $0x3,%ecx
+  80097f:	29 ca                	sub    %ecx,%edx
+  800981:	89 d0                	mov    %edx,%eax
+  800983:	c1 e8 02             	shr    $0x2,%eax
+  800986:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  800989:	83 e2 03             	and    $0x3,%edx
+  80098c:	89 d8                	mov    %ebx,%eax
+  80098e:	fc                   	cld
+  80098f:	f3 aa                	rep stos %al,%es:(%edi)
+  800991:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  800997:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  80099a:	f3 ab                	rep stos %eax,%es:(%edi)
+  80099c:	89 d1                	mov    %edx,%ecx
+  80099e:	89 d8                	mov    %ebx,%eax
+  8009a0:	fc                   	cld
+  8009a1:	f3 aa                	rep stos %al,%es:(%edi)
+  8009a3:	89 f0                	mov    %esi,%eax
+  8009a5:	83 c4 04             	add    $0x4,%esp
+  8009a8:	5b                   	pop    %ebx
+  8009a9:	5e                   	pop    %esi
+  8009aa:	5f                   	pop    %edi
+  8009ab:	5d                   	pop    %ebp
+  8009ac:	c3                   	ret
+
+008009ad <memmove>:
+  8009ad:	55                   	push   %ebp
+  8009ae:	89 e5                	mov    %esp,%ebp
+  8009b0:	57                   	push   %edi
+  8009b1:	56                   	push   %esi
+  8009b2:	53                   	push   %ebx
+  8009b3:	83 ec 0c             	sub    $0xc,%esp
+  8009b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009bc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8009bf:	85 c0                	test   %eax,%eax
+  8009c1:	74 14                	je     8009d7 <memmove+0x2a>
+  8009c3:	39 da                	cmp    %ebx,%edx
+  8009c5:	73 07                	jae    8009ce <memmove+0x21>
+  8009c7:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8009ca:	39 cb                	cmp    %ecx,%ebx
+  8009cc:	72 13                	jb     8009e1 <memmove+0x34>
+  8009ce:	89 c1                	mov    %eax,%ecx
+  8009d0:	89 d8                	mov    %ebx,%eax
+  8009d2:	e8 94 fd ff ff       	call   80076b <copy_fwd>
+  8009d7:	89 d8                	mov    %ebx,%eax
+  8009d9:	83 c4 0c             	add    $0xc,%esp
+  8009dc:	5b                   	pop    %ebx
+  8009dd:	5e                   	pop    %esi
+  8009de:	5f                   	pop    %edi
+  8009df:	5d                   	pop    %ebp
+  8009e0:	c3                   	ret
+  8009e1:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  8009e4:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  8009e7:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  8009ea:	83 f8 0f             	cmp    $0xf,%eax
+  8009ed:	76 23                	jbe    800a12 <memmove+0x65>
+  8009ef:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  8009f2:	83 e1 03             	and    $0x3,%ecx
+  8009f5:	29 c8                	sub    %ecx,%eax
+  8009f7:	89 c2                	mov    %eax,%edx
+  8009f9:	c1 ea 02             	shr    $0x2,%edx
+  8009fc:	83 e0 03             	and    $0x3,%eax
+  8009ff:	fd                   	std
+  800a00:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a02:	83 ef 03             	sub    $0x3,%edi
+  800a05:	83 ee 03             	sub    $0x3,%esi
+  800a08:	89 d1                	mov    %edx,%ecx
+  800a0a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a0c:	83 c7 03             	add    $0x3,%edi
+  800a0f:	83 c6 03             	add    $0x3,%esi
+  800a12:	89 c1                	mov    %eax,%ecx
+  800a14:	fd                   	std
+  800a15:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a17:	fc                   	cld
+  800a18:	eb bd                	jmp    8009d7 <memmove+0x2a>
+
+00800a1a <memcpy>:
+  800a1a:	55                   	push   %ebp
+  800a1b:	89 e5                	mov    %esp,%ebp
+  800a1d:	53                   	push   %ebx
+  800a1e:	83 ec 04             	sub    $0x4,%esp
+  800a21:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a24:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a27:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a2a:	89 d8                	mov    %ebx,%eax
+  800a2c:	e8 3a fd ff ff       	call   80076b <copy_fwd>
+  800a31:	89 d8                	mov    %ebx,%eax
+  800a33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a36:	c9                   	leave
+  800a37:	c3                   	ret
+
+00800a38 <page_copy>:
+  800a38:	55                   	push   %ebp
+  800a39:	89 e5                	mov    %esp,%ebp
+  800a3b:	57                   	push   %edi
+  800a3c:	56                   	push   %esi
+  800a3d:	53                   	push   %ebx
+  800a3e:	83 ec 0c             	sub    $0xc,%esp
+  800a41:	e8 5c fd ff ff       	call   8007a2 <have_sse2>
+  800a46:	85 c0                	test   %eax,%eax
+  800a48:	74 39                	je     800a83 <page_copy+0x4b>
+  800a4a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a4d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a50:	be 00 01 00 00       	mov    $0x100,%esi
+  800a55:	8b 03                	mov    (%ebx),%eax
+  800a57:	8b 53 04             	mov    0x4(%ebx),%edx
+  800a5a:	0f c3 01             	movnti %eax,(%ecx)
+  800a5d:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800a61:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a64:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800a67:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800a6b:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800a6f:	83 c3 10             	add    $0x10,%ebx
+  800a72:	83 c1 10             	add    $0x10,%ecx
+  800a75:	4e                   	dec    %esi
+  800a76:	75 dd                	jne    800a55 <page_copy+0x1d>
+  800a78:	0f ae f8             	sfence
+  800a7b:	83 c4 0c             	add    $0xc,%esp
+  800a7e:	5b                   	pop    %ebx
+  800a7f:	5e                   	pop    %esi
+  800a80:	5f                   	pop    %edi
+  800a81:	5d                   	pop    %ebp
+  800a82:	c3                   	ret
+  800a83:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a86:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a89:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800a8e:	fc                   	cld
+  800a8f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a91:	eb e8                	jmp    800a7b <page_copy+0x43>
+
+00800a93 <page_zero>:
+  800a93:	55                   	push   %ebp
+  800a94:	89 e5                	mov    %esp,%ebp
+  800a96:	57                   	push   %edi
+  800a97:	83 ec 04             	sub    $0x4,%esp
+  800a9a:	e8 03 fd ff ff       	call   8007a2 <have_sse2>
+  800a9f:	85 c0                	test   %eax,%eax
+  800aa1:	74 3a                	je     800add <page_zero+0x4a>
+  800aa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa6:	ba 80 00 00 00       	mov    $0x80,%edx
+  800aab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ab0:	0f c3 08             	movnti %ecx,(%eax)
+  800ab3:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800ab7:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800abb:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800abf:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800ac3:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800ac7:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800acb:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800acf:	83 c0 20             	add    $0x20,%eax
+  800ad2:	4a                   	dec    %edx
+  800ad3:	75 db                	jne    800ab0 <page_zero+0x1d>
+  800ad5:	0f ae f8             	sfence
+  800ad8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800adb:	c9                   	leave
+  800adc:	c3                   	ret
+  800add:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ae0:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800ae5:	fc                   	cld
+  800ae6:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ae8:	eb ee                	jmp    800ad8 <page_zero+0x45>
+
+00800aea <memcmp>:
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	56                   	push   %esi
+  800aee:	53                   	push   %ebx
+  800aef:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800af5:	89 c6                	mov    %eax,%esi
+  800af7:	03 75 10             	add    0x10(%ebp),%esi
+  800afa:	eb 06                	jmp    800b02 <memcmp+0x18>
+  800afc:	83 c0 01             	add    $0x1,%eax
+  800aff:	83 c2 01             	add    $0x1,%edx
+  800b02:	39 f0                	cmp    %esi,%eax
+  800b04:	74 14                	je     800b1a <memcmp+0x30>
+  800b06:	0f b6 08             	movzbl (%eax),%ecx
+  800b09:	0f b6 1a             	movzbl (%edx),%ebx
+  800b0c:	38 d9                	cmp    %bl,%cl
+  800b0e:	74 ec                	je     800afc <memcmp+0x12>
+  800b10:	0f b6 c1             	movzbl %cl,%eax
+  800b13:	0f b6 db             	movzbl %bl,%ebx
+  800b16:	29 d8                	sub    %ebx,%eax
+  800b18:	eb 05                	jmp    800b1f <memcmp+0x35>
+  800b1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1f:	5b                   	pop    %ebx
+  800b20:	5e                   	pop    %esi
+  800b21:	5d                   	pop    %ebp
+  800b22:	c3                   	ret
+
+00800b23 <memfind>:
+  800b23:	55                   	push   %ebp
+  800b24:	89 e5                	mov    %esp,%ebp
+  800b26:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b2c:	89 c2                	mov    %eax,%edx
+  800b2e:	03 55 10             	add    0x10(%ebp),%edx
+  800b31:	eb 03                	jmp    800b36 <memfind+0x13>
+  800b33:	83 c0 01             	add    $0x1,%eax
+  800b36:	39 d0                	cmp    %edx,%eax
+  800b38:	73 04                	jae    800b3e <memfind+0x1b>
+  800b3a:	38 08                	cmp    %cl,(%eax)
+  800b3c:	75 f5                	jne    800b33 <memfind+0x10>
+  800b3e:	5d                   	pop    %ebp
+  800b3f:	c3                   	ret
+
+00800b40 <strtol>:
+  800b40:	55                   	push   %ebp
+  800b41:	89 e5                	mov    %esp,%ebp
+  800b43:	57                   	push   %edi
+  800b44:	56                   	push   %esi
+  800b45:	53                   	push   %ebx
+  800b46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b4c:	eb 03                	jmp    800b51 <strtol+0x11>
+  800b4e:	83 c2 01             	add    $0x1,%edx
+  800b51:	0f b6 02             	movzbl (%edx),%eax
+  800b54:	3c 20                	cmp    $0x20,%al
+  800b56:	74 f6                	je     800b4e <strtol+0xe>
+  800b58:	3c 09                	cmp    $0x9,%al
+  800b5a:	74 f2                	je     800b4e <strtol+0xe>
+  800b5c:	3c 2b                	cmp    $0x2b,%al
+  800b5e:	74 2a                	je     800b8a <strtol+0x4a>
+  800b60:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b65:	3c 2d                	cmp    $0x2d,%al
+  800b67:	74 2b                	je     800b94 <strtol+0x54>
+  800b69:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b6f:	75 0f                	jne    800b80 <strtol+0x40>
+  800b71:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b74:	74 28                	je     800b9e <strtol+0x5e>
+  800b76:	85 db                	test   %ebx,%ebx
+  800b78:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b7d:	0f 44 d8             	cmove  %eax,%ebx
+  800b80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b85:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b88:	eb 46                	jmp    800bd0 <strtol+0x90>
+  800b8a:	83 c2 01             	add    $0x1,%edx
+  800b8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b92:	eb d5                	jmp    800b69 <strtol+0x29>
+  800b94:	83 c2 01             	add    $0x1,%edx
+  800b97:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b9c:	eb cb                	jmp    800b69 <strtol+0x29>
+  800b9e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ba2:	74 0e                	je     800bb2 <strtol+0x72>
+  800ba4:	85 db                	test   %ebx,%ebx
+  800ba6:	75 d8                	jne    800b80 <strtol+0x40>
+  800ba8:	83 c2 01             	add    $0x1,%edx
+  800bab:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bb0:	eb ce                	jmp    800b80 <strtol+0x40>
+  800bb2:	83 c2 02             	add    $0x2,%edx
+  800bb5:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bba:	eb c4                	jmp    800b80 <strtol+0x40>
+  800bbc:	0f be c0             	movsbl %al,%eax
+  800bbf:	83 e8 30             	sub    $0x30,%eax
+  800bc2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bc5:	7d 3a                	jge    800c01 <strtol+0xc1>
+  800bc7:	83 c2 01             	add    $0x1,%edx
+  800bca:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bce:	01 c1                	add    %eax,%ecx
+  800bd0:	0f b6 02             	movzbl (%edx),%eax
+  800bd3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bd6:	89 f3                	mov    %esi,%ebx
+  800bd8:	80 fb 09             	cmp    $0x9,%bl
+  800bdb:	76 df                	jbe    800bbc <strtol+0x7c>
+  800bdd:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800be0:	89 f3                	mov    %esi,%ebx
+  800be2:	80 fb 19             	cmp    $0x19,%bl
+  800be5:	77 08                	ja     800bef <strtol+0xaf>
+  800be7:	0f be c0             	movsbl %al,%eax
+  800bea:	83 e8 57             	sub    $0x57,%eax
+  800bed:	eb d3                	jmp    800bc2 <strtol+0x82>
+  800bef:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bf2:	89 f3                	mov    %esi,%ebx
+  800bf4:	80 fb 19             	cmp    $0x19,%bl
+  800bf7:	77 08                	ja     800c01 <strtol+0xc1>
+  800bf9:	0f be c0             	movsbl %al,%eax
+  800bfc:	83 e8 37             	sub    $0x37,%eax
+  800bff:	eb c1                	jmp    800bc2 <strtol+0x82>
+  800c01:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c05:	74 05                	je     800c0c <strtol+0xcc>
+  800c07:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c0a:	89 10                	mov    %edx,(%eax)
+  800c0c:	89 c8                	mov    %ecx,%eax
+  800c0e:	f7 d8                	neg    %eax
+  800c10:	85 ff                	test   %edi,%edi
+  800c12:	0f 45 c8             	cmovne %eax,%ecx
+  800c15:	89 c8                	mov    %ecx,%eax
+  800c17:	5b                   	pop    %ebx
+  800c18:	5e                   	pop    %esi
+  800c19:	5f                   	pop    %edi
+  800c1a:	5d                   	pop    %ebp
+  800c1b:	c3                   	ret
+
+00800c1c <sys_cputs>:
+  800c1c:	55                   	push   %ebp
+  800c1d:	89 e5                	mov    %esp,%ebp
+  800c1f:	57                   	push   %edi
+  800c20:	56                   	push   %esi
+  800c21:	53                   	push   %ebx
+  800c22:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c29:	78 21                	js     800c4c <sys_cputs+0x30>
+  800c2b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c32:	75 2d                	jne    800c61 <sys_cputs+0x45>
+  800c34:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3f:	89 c3                	mov    %eax,%ebx
+  800c41:	89 c7                	mov    %eax,%edi
+  800c43:	89 c6                	mov    %eax,%esi
+  800c45:	cd 30                	int    $0x30
+  800c47:	5b                   	pop    %ebx
+  800c48:	5e                   	pop    %esi
+  800c49:	5f                   	pop    %edi
+  800c4a:	5d                   	pop    %ebp
+  800c4b:	c3                   	ret
+  800c4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c51:	0f a2                	cpuid
+  800c53:	c1 ea 0b             	shr    $0xb,%edx
+  800c56:	83 e2 01             	and    $0x1,%edx
+  800c59:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800c5f:	eb ca                	jmp    800c2b <sys_cputs+0xf>
+  800c61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c6c:	89 c3                	mov    %eax,%ebx
+  800c6e:	89 c7                	mov    %eax,%edi
+  800c70:	89 c6                	mov    %eax,%esi
+  800c72:	55                   	push   %ebp
+  800c73:	68 7c 0c 80 00       	push   $0x800c7c
+  800c78:	89 e5                	mov    %esp,%ebp
+  800c7a:	0f 34                	sysenter
+  800c7c:	83 c4 04             	add    $0x4,%esp
+  800c7f:	5d                   	pop    %ebp
+  800c80:	eb c5                	jmp    800c47 <sys_cputs+0x2b>
+
+00800c82 <sys_cgetc>:
+  800c82:	55                   	push   %ebp
+  800c83:	89 e5                	mov    %esp,%ebp
+  800c85:	57                   	push   %edi
+  800c86:	56                   	push   %esi
+  800c87:	53                   	push   %ebx
+  800c88:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c8f:	78 22                	js     800cb3 <sys_cgetc+0x31>
+  800c91:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c98:	75 2e                	jne    800cc8 <sys_cgetc+0x46>
+  800c9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c9f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ca4:	89 d1                	mov    %edx,%ecx
+  800ca6:	89 d3                	mov    %edx,%ebx
+  800ca8:	89 d7                	mov    %edx,%edi
+  800caa:	89 d6                	mov    %edx,%esi
+  800cac:	cd 30                	int    $0x30
+  800cae:	5b                   	pop    %ebx
+  800caf:	5e                   	pop    %esi
+  800cb0:	5f                   	pop    %edi
+  800cb1:	5d                   	pop    %ebp
+  800cb2:	c3                   	ret
+  800cb3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cb8:	0f a2                	cpuid
+  800cba:	c1 ea 0b             	shr    $0xb,%edx
+  800cbd:	83 e2 01             	and    $0x1,%edx
+  800cc0:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800cc6:	eb c9                	jmp    800c91 <sys_cgetc+0xf>
+  800cc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ccd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cd2:	89 d1                	mov    %edx,%ecx
+  800cd4:	89 d3                	mov    %edx,%ebx
+  800cd6:	89 d7                	mov    %edx,%edi
+  800cd8:	89 d6                	mov    %edx,%esi
+  800cda:	55                   	push   %ebp
+  800cdb:	68 e4 0c 80 00       	push   $0x800ce4
+  800ce0:	89 e5                	mov    %esp,%ebp
+  800ce2:	0f 34                	sysenter
+  800ce4:	83 c4 04             	add    $0x4,%esp
+  800ce7:	5d                   	pop    %ebp
+  800ce8:	eb c4                	jmp    800cae <sys_cgetc+0x2c>
+
+00800cea <sys_env_destroy>:
+  800cea:	55                   	push   %ebp
+  800ceb:	89 e5                	mov    %esp,%ebp
+  800ced:	57                   	push   %edi
+  800cee:	56                   	push   %esi
+  800cef:	53                   	push   %ebx
+  800cf0:	83 ec 0c             	sub    $0xc,%esp
+  800cf3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800cfa:	78 2a                	js     800d26 <sys_env_destroy+0x3c>
+  800cfc:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d03:	75 36                	jne    800d3b <sys_env_destroy+0x51>
+  800d05:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d0a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d12:	89 cb                	mov    %ecx,%ebx
+  800d14:	89 cf                	mov    %ecx,%edi
+  800d16:	89 ce                	mov    %ecx,%esi
+  800d18:	cd 30                	int    $0x30
+  800d1a:	85 c0                	test   %eax,%eax
+  800d1c:	7f 40                	jg     800d5e <sys_env_destroy+0x74>
+  800d1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d21:	5b                   	pop    %ebx
+  800d22:	5e                   	pop    %esi
+  800d23:	5f                   	pop    %edi
+  800d24:	5d                   	pop    %ebp
+  800d25:	c3                   	ret
+  800d26:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d2b:	0f a2                	cpuid
+  800d2d:	c1 ea 0b             	shr    $0xb,%edx
+  800d30:	83 e2 01             	and    $0x1,%edx
+  800d33:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800d39:	eb c1                	jmp    800cfc <sys_env_destroy+0x12>
+  800d3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d43:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d48:	89 cb                	mov    %ecx,%ebx
+  800d4a:	89 cf                	mov    %ecx,%edi
+  800d4c:	89 ce                	mov    %ecx,%esi
+  800d4e:	55                   	push   %ebp
+  800d4f:	68 58 0d 80 00       	push   $0x800d58
+  800d54:	89 e5                	mov    %esp,%ebp
+  800d56:	0f 34                	sysenter
+  800d58:	83 c4 04             	add    $0x4,%esp
+  800d5b:	5d                   	pop    %ebp
+  800d5c:	eb bc                	jmp    800d1a <sys_env_destroy+0x30>
+  800d5e:	83 ec 0c             	sub    $0xc,%esp
+  800d61:	50                   	push   %eax
+  800d62:	6a 03                	push   $0x3
+  800d64:	68 a4 21 80 00       	push   $0x8021a4
+  800d69:	6a 49                	push   $0x49
+  800d6b:	68 c1 21 80 00       	push   $0x8021c1
+  800d70:	e8 57 0e 00 00       	call   801bcc <_panic>
+
+00800d75 <sys_getenvid>:
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	57                   	push   %edi
+  800d79:	56                   	push   %esi
+  800d7a:	53                   	push   %ebx
+  800d7b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d82:	78 22                	js     800da6 <sys_getenvid+0x31>
+  800d84:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d8b:	75 2e                	jne    800dbb <sys_getenvid+0x46>
+  800d8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d92:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d97:	89 d1                	mov    %edx,%ecx
+  800d99:	89 d3                	mov    %edx,%ebx
+  800d9b:	89 d7                	mov    %edx,%edi
+  800d9d:	89 d6                	mov    %edx,%esi
+  800d9f:	cd 30                	int    $0x30
+  800da1:	5b                   	pop    %ebx
+  800da2:	5e                   	pop    %esi
+  800da3:	5f                   	pop    %edi
+  800da4:	5d                   	pop    %ebp
+  800da5:	c3                   	ret
+  800da6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dab:	0f a2                	cpuid
+  800dad:	c1 ea 0b             	shr    $0xb,%edx
+  800db0:	83 e2 01             	and    $0x1,%edx
+  800db3:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800db9:	eb c9                	jmp    800d84 <sys_getenvid+0xf>
+  800dbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc0:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dc5:	89 d1                	mov    %edx,%ecx
+  800dc7:	89 d3                	mov    %edx,%ebx
+  800dc9:	89 d7                	mov    %edx,%edi
+  800dcb:	89 d6                	mov    %edx,%esi
+  800dcd:	55                   	push   %ebp
+  800dce:	68 d7 0d 80 00       	push   $0x800dd7
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	0f 34                	sysenter
+  800dd7:	83 c4 04             	add    $0x4,%esp
+  800dda:	5d                   	pop    %ebp
+  800ddb:	eb c4                	jmp    800da1 <sys_getenvid+0x2c>
+
+00800ddd <sys_yield>:
+  800ddd:	55                   	push   %ebp
+  800dde:	89 e5                	mov    %esp,%ebp
+  800de0:	57                   	push   %edi
+  800de1:	56                   	push   %esi
+  800de2:	53                   	push   %ebx
+  800de3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800dea:	78 22                	js     800e0e <sys_yield+0x31>
+  800dec:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800df3:	75 2e                	jne    800e23 <sys_yield+0x46>
+  800df5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dfa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dff:	89 d1                	mov    %edx,%ecx
+  800e01:	89 d3                	mov    %edx,%ebx
+  800e03:	89 d7                	mov    %edx,%edi
+  800e05:	89 d6                	mov    %edx,%esi
+  800e07:	cd 30                	int    $0x30
+  800e09:	5b                   	pop    %ebx
+  800e0a:	5e                   	pop    %esi
+  800e0b:	5f                   	pop    %edi
+  800e0c:	5d                   	pop    %ebp
+  800e0d:	c3                   	ret
+  800e0e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e13:	0f a2                	cpuid
+  800e15:	c1 ea 0b             	shr    $0xb,%edx
+  800e18:	83 e2 01             	and    $0x1,%edx
+  800e1b:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800e21:	eb c9                	jmp    800dec <sys_yield+0xf>
+  800e23:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e28:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e2d:	89 d1                	mov    %edx,%ecx
+  800e2f:	89 d3                	mov    %edx,%ebx
+  800e31:	89 d7                	mov    %edx,%edi
+  800e33:	89 d6                	mov    %edx,%esi
+  800e35:	55                   	push   %ebp
+  800e36:	68 3f 0e 80 00       	push   $0x800e3f
+  800e3b:	89 e5                	mov    %esp,%ebp
+  800e3d:	0f 34                	sysenter
+  800e3f:	83 c4 04             	add    $0x4,%esp
+  800e42:	5d                   	pop    %ebp
+  800e43:	eb c4                	jmp    800e09 <sys_yield+0x2c>
+
+00800e45 <sys_env_set_cow>:
+  800e45:	55                   	push   %ebp
+  800e46:	89 e5                	mov    %esp,%ebp
+  800e48:	57                   	push   %edi
+  800e49:	56                   	push   %esi
+  800e4a:	53                   	push   %ebx
+  800e4b:	83 ec 0c             	sub    $0xc,%esp
+  800e4e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e55:	78 2b                	js     800e82 <sys_env_set_cow+0x3d>
+  800e57:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e5e:	75 37                	jne    800e97 <sys_env_set_cow+0x52>
+  800e60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e65:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e70:	89 df                	mov    %ebx,%edi
+  800e72:	89 de                	mov    %ebx,%esi
+  800e74:	cd 30                	int    $0x30
+  800e76:	85 c0                	test   %eax,%eax
+  800e78:	7f 41                	jg     800ebb <sys_env_set_cow+0x76>
+  800e7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7d:	5b                   	pop    %ebx
+  800e7e:	5e                   	pop    %esi
+  800e7f:	5f                   	pop    %edi
+  800e80:	5d                   	pop    %ebp
+  800e81:	c3                   	ret
+  800e82:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e87:	0f a2                	cpuid
+  800e89:	c1 ea 0b             	shr    $0xb,%edx
+  800e8c:	83 e2 01             	and    $0x1,%edx
+  800e8f:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800e95:	eb c0                	jmp    800e57 <sys_env_set_cow+0x12>
+  800e97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ea7:	89 df                	mov    %ebx,%edi
+  800ea9:	89 de                	mov    %ebx,%esi
+  800eab:	55                   	push   %ebp
+  800eac:	68 b5 0e 80 00       	push   $0x800eb5
+  800eb1:	89 e5                	mov    %esp,%ebp
+  800eb3:	0f 34                	sysenter
+  800eb5:	83 c4 04             	add    $0x4,%esp
+  800eb8:	5d                   	pop    %ebp
+  800eb9:	eb bb                	jmp    800e76 <sys_env_set_cow+0x31>
+  800ebb:	83 ec 0c             	sub    $0xc,%esp
+  800ebe:	50                   	push   %eax
+  800ebf:	6a 0d                	push   $0xd
+  800ec1:	68 a4 21 80 00       	push   $0x8021a4
+  800ec6:	6a 49                	push   $0x49
+  800ec8:	68 c1 21 80 00       	push   $0x8021c1
+  800ecd:	e8 fa 0c 00 00       	call   801bcc <_panic>
+
+00800ed2 <sys_env_set_quota>:
+  800ed2:	55                   	push   %ebp
+  800ed3:	89 e5                	mov    %esp,%ebp
+  800ed5:	57                   	push   %edi
+  800ed6:	56                   	push   %esi
+  800ed7:	53                   	push   %ebx
+  800ed8:	83 ec 0c             	sub    $0xc,%esp
+  800edb:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ee2:	78 2b                	js     800f0f <sys_env_set_quota+0x3d>
+  800ee4:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800eeb:	75 37                	jne    800f24 <sys_env_set_quota+0x52>
+  800eed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ef7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efd:	89 df                	mov    %ebx,%edi
+  800eff:	89 de                	mov    %ebx,%esi
+  800f01:	cd 30                	int    $0x30
+  800f03:	85 c0                	test   %eax,%eax
+  800f05:	7f 41                	jg     800f48 <sys_env_set_quota+0x76>
+  800f07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0a:	5b                   	pop    %ebx
+  800f0b:	5e                   	pop    %esi
+  800f0c:	5f                   	pop    %edi
+  800f0d:	5d                   	pop    %ebp
+  800f0e:	c3                   	ret
+  800f0f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f14:	0f a2                	cpuid
+  800f16:	c1 ea 0b             	shr    $0xb,%edx
+  800f19:	83 e2 01             	and    $0x1,%edx
+  800f1c:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800f22:	eb c0                	jmp    800ee4 <sys_env_set_quota+0x12>
+  800f24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f34:	89 df                	mov    %ebx,%edi
+  800f36:	89 de                	mov    %ebx,%esi
+  800f38:	55                   	push   %ebp
+  800f39:	68 42 0f 80 00       	push   $0x800f42
+  800f3e:	89 e5                	mov    %esp,%ebp
+  800f40:	0f 34                	sysenter
+  800f42:	83 c4 04             	add    $0x4,%esp
+  800f45:	5d                   	pop    %ebp
+  800f46:	eb bb                	jmp    800f03 <sys_env_set_quota+0x31>
+  800f48:	83 ec 0c             	sub    $0xc,%esp
+  800f4b:	50                   	push   %eax
+  800f4c:	6a 0f                	push   $0xf
+  800f4e:	68 a4 21 80 00       	push   $0x8021a4
+  800f53:	6a 49                	push   $0x49
+  800f55:	68 c1 21 80 00       	push   $0x8021c1
+  800f5a:	e8 6d 0c 00 00       	call   801bcc <_panic>
+
+00800f5f <sys_page_alloc>:
+  800f5f:	55                   	push   %ebp
+  800f60:	89 e5                	mov    %esp,%ebp
+  800f62:	57                   	push   %edi
+  800f63:	56                   	push   %esi
+  800f64:	53                   	push   %ebx
+  800f65:	83 ec 0c             	sub    $0xc,%esp
+  800f68:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f6f:	78 2c                	js     800f9d <sys_page_alloc+0x3e>
+  800f71:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f78:	75 38                	jne    800fb2 <sys_page_alloc+0x53>
+  800f7a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f7f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f8d:	89 f7                	mov    %esi,%edi
+  800f8f:	cd 30                	int    $0x30
+  800f91:	85 c0                	test   %eax,%eax
+  800f93:	7f 42                	jg     800fd7 <sys_page_alloc+0x78>
+  800f95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f98:	5b                   	pop    %ebx
+  800f99:	5e                   	pop    %esi
+  800f9a:	5f                   	pop    %edi
+  800f9b:	5d                   	pop    %ebp
+  800f9c:	c3                   	ret
+  800f9d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fa2:	0f a2                	cpuid
+  800fa4:	c1 ea 0b             	shr    $0xb,%edx
+  800fa7:	83 e2 01             	and    $0x1,%edx
+  800faa:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800fb0:	eb bf                	jmp    800f71 <sys_page_alloc+0x12>
+  800fb2:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbd:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fc2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc5:	89 f7                	mov    %esi,%edi
+  800fc7:	55                   	push   %ebp
+  800fc8:	68 d1 0f 80 00       	push   $0x800fd1
+  800fcd:	89 e5                	mov    %esp,%ebp
+  800fcf:	0f 34                	sysenter
+  800fd1:	83 c4 04             	add    $0x4,%esp
+  800fd4:	5d                   	pop    %ebp
+  800fd5:	eb ba                	jmp    800f91 <sys_page_alloc+0x32>
+  800fd7:	83 ec 0c             	sub    $0xc,%esp
+  800fda:	50                   	push   %eax
+  800fdb:	6a 04                	push   $0x4
+  800fdd:	68 a4 21 80 00       	push   $0x8021a4
+  800fe2:	6a 49                	push   $0x49
+  800fe4:	68 c1 21 80 00       	push   $0x8021c1
+  800fe9:	e8 de 0b 00 00       	call   801bcc <_panic>
+
+00800fee <sys_page_map>:
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	57                   	push   %edi
+  800ff2:	56                   	push   %esi
+  800ff3:	53                   	push   %ebx
+  800ff4:	83 ec 0c             	sub    $0xc,%esp
+  800ff7:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ffe:	78 2b                	js     80102b <sys_page_map+0x3d>
+  801000:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801007:	75 37                	jne    801040 <sys_page_map+0x52>
+  801009:	b8 05 00 00 00       	mov    $0x5,%eax
+  80100e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801011:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801014:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801017:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80101a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80101d:	cd 30                	int    $0x30
+  80101f:	85 c0                	test   %eax,%eax
+  801021:	7f 41                	jg     801064 <sys_page_map+0x76>
+  801023:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801026:	5b                   	pop    %ebx
+  801027:	5e                   	pop    %esi
+  801028:	5f                   	pop    %edi
+  801029:	5d                   	pop    %ebp
+  80102a:	c3                   	ret
+  80102b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801030:	0f a2                	cpuid
+  801032:	c1 ea 0b             	shr    $0xb,%edx
+  801035:	83 e2 01             	and    $0x1,%edx
+  801038:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80103e:	eb c0                	jmp    801000 <sys_page_map+0x12>
+  801040:	8b 55 08             	mov    0x8(%ebp),%edx
+  801043:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801046:	b8 05 00 00 00       	mov    $0x5,%eax
+  80104b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80104e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801051:	8b 75 18             	mov    0x18(%ebp),%esi
+  801054:	55                   	push   %ebp
+  801055:	68 5e 10 80 00       	push   $0x80105e
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	0f 34                	sysenter
+  80105e:	83 c4 04             	add    $0x4,%esp
+  801061:	5d                   	pop    %ebp
+  801062:	eb bb                	jmp    80101f <sys_page_map+0x31>
+  801064:	83 ec 0c             	sub    $0xc,%esp
+  801067:	50                   	push   %eax
+  801068:	6a 05                	push   $0x5
+  80106a:	68 a4 21 80 00       	push   $0x8021a4
+  80106f:	6a 49                	push   $0x49
+  801071:	68 c1 21 80 00       	push   $0x8021c1
+  801076:	e8 51 0b 00 00       	call   801bcc <_panic>
+
+0080107b <sys_page_unmap>:
+  80107b:	55                   	push   %ebp
+  80107c:	89 e5                	mov    %esp,%ebp
+  80107e:	57                   	push   %edi
+  80107f:	56                   	push   %esi
+  801080:	53                   	push   %ebx
+  801081:	83 ec 0c             	sub    $0xc,%esp
+  801084:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80108b:	78 2b                	js     8010b8 <sys_page_unmap+0x3d>
+  80108d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801094:	75 37                	jne    8010cd <sys_page_unmap+0x52>
+  801096:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109b:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a6:	89 df                	mov    %ebx,%edi
+  8010a8:	89 de                	mov    %ebx,%esi
+  8010aa:	cd 30                	int    $0x30
+  8010ac:	85 c0                	test   %eax,%eax
+  8010ae:	7f 41                	jg     8010f1 <sys_page_unmap+0x76>
+  8010b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b3:	5b                   	pop    %ebx
+  8010b4:	5e                   	pop    %esi
+  8010b5:	5f                   	pop    %edi
+  8010b6:	5d                   	pop    %ebp
+  8010b7:	c3                   	ret
+  8010b8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010bd:	0f a2                	cpuid
+  8010bf:	c1 ea 0b             	shr    $0xb,%edx
+  8010c2:	83 e2 01             	and    $0x1,%edx
+  8010c5:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8010cb:	eb c0                	jmp    80108d <sys_page_unmap+0x12>
+  8010cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010dd:	89 df                	mov    %ebx,%edi
+  8010df:	89 de                	mov    %ebx,%esi
+  8010e1:	55                   	push   %ebp
+  8010e2:	68 eb 10 80 00       	push   $0x8010eb
+  8010e7:	89 e5                	mov    %esp,%ebp
+  8010e9:	0f 34                	sysenter
+  8010eb:	83 c4 04             	add    $0x4,%esp
+  8010ee:	5d                   	pop    %ebp
+  8010ef:	eb bb                	jmp    8010ac <sys_page_unmap+0x31>
+  8010f1:	83 ec 0c             	sub    $0xc,%esp
+  8010f4:	50                   	push   %eax
+  8010f5:	6a 06                	push   $0x6
+  8010f7:	68 a4 21 80 00       	push   $0x8021a4
+  8010fc:	6a 49                	push   $0x49
+  8010fe:	68 c1 21 80 00       	push   $0x8021c1
+  801103:	e8 c4 0a 00 00       	call   801bcc <_panic>
+
+00801108 <sys_page_reuse>:
+  801108:	55                   	push   %ebp
+  801109:	89 e5                	mov    %esp,%ebp
+  80110b:	57                   	push   %edi
+  80110c:	56                   	push   %esi
+  80110d:	53                   	push   %ebx
+  80110e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801115:	78 24                	js     80113b <sys_page_reuse+0x33>
+  801117:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80111e:	75 30                	jne    801150 <sys_page_reuse+0x48>
+  801120:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801125:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80112a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801130:	89 df                	mov    %ebx,%edi
+  801132:	89 de                	mov    %ebx,%esi
+  801134:	cd 30                	int    $0x30
+  801136:	5b                   	pop    %ebx
+  801137:	5e                   	pop    %esi
+  801138:	5f                   	pop    %edi
+  801139:	5d                   	pop    %ebp
+  80113a:	c3                   	ret
+  80113b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801140:	0f a2                	cpuid
+  801142:	c1 ea 0b             	shr    $0xb,%edx
+  801145:	83 e2 01             	and    $0x1,%edx
+  801148:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80114e:	eb c7                	jmp    801117 <sys_page_reuse+0xf>
+  801150:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801155:	8b 55 08             	mov    0x8(%ebp),%edx
+  801158:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801160:	89 df                	mov    %ebx,%edi
+  801162:	89 de                	mov    %ebx,%esi
+  801164:	55                   	push   %ebp
+  801165:	68 6e 11 80 00       	push   $0x80116e
+  80116a:	89 e5                	mov    %esp,%ebp
+  80116c:	0f 34                	sysenter
+  80116e:	83 c4 04             	add    $0x4,%esp
+  801171:	5d                   	pop    %ebp
+  801172:	eb c2                	jmp    801136 <sys_page_reuse+0x2e>
+
+00801174 <sys_env_set_status>:
+  801174:	55                   	push   %ebp
+  801175:	89 e5                	mov    %esp,%ebp
+  801177:	57                   	push   %edi
+  801178:	56                   	push   %esi
+  801179:	53                   	push   %ebx
+  80117a:	83 ec 0c             	sub    $0xc,%esp
+  80117d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801184:	78 2b                	js     8011b1 <sys_env_set_status+0x3d>
+  801186:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80118d:	75 37                	jne    8011c6 <sys_env_set_status+0x52>
+  80118f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801194:	b8 08 00 00 00       	mov    $0x8,%eax
+  801199:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119f:	89 df                	mov    %ebx,%edi
+  8011a1:	89 de                	mov    %ebx,%esi
+  8011a3:	cd 30                	int    $0x30
+  8011a5:	85 c0                	test   %eax,%eax
+  8011a7:	7f 41                	jg     8011ea <sys_env_set_status+0x76>
+  8011a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ac:	5b                   	pop    %ebx
+  8011ad:	5e                   	pop    %esi
+  8011ae:	5f                   	pop    %edi
+  8011af:	5d                   	pop    %ebp
+  8011b0:	c3                   	ret
+  8011b1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011b6:	0f a2                	cpuid
+  8011b8:	c1 ea 0b             	shr    $0xb,%edx
+  8011bb:	83 e2 01             	and    $0x1,%edx
+  8011be:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8011c4:	eb c0                	jmp    801186 <sys_env_set_status+0x12>
+  8011c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011d6:	89 df                	mov    %ebx,%edi
+  8011d8:	89 de                	mov    %ebx,%esi
+  8011da:	55                   	push   %ebp
+  8011db:	68 e4 11 80 00       	push   $0x8011e4
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	0f 34                	sysenter
+  8011e4:	83 c4 04             	add    $0x4,%esp
+  8011e7:	5d                   	pop    %ebp
+  8011e8:	eb bb                	jmp    8011a5 <sys_env_set_status+0x31>
+  8011ea:	83 ec 0c             	sub    $0xc,%esp
+  8011ed:	50                   	push   %eax
+  8011ee:	6a 08                	push   $0x8
+  8011f0:	68 a4 21 80 00       	push   $0x8021a4
+  8011f5:	6a 49                	push   $0x49
+  8011f7:	68 c1 21 80 00       	push   $0x8021c1
+  8011fc:	e8 cb 09 00 00       	call   801bcc <_panic>
+
+00801201 <sys_env_set_pgfault_upcall>:
+  801201:	55                   	push   %ebp
+  801202:	89 e5                	mov    %esp,%ebp
+  801204:	57                   	push   %edi
+  801205:	56                   	push   %esi
+  801206:	53                   	push   %ebx
+  801207:	83 ec 0c             	sub    $0xc,%esp
+  80120a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801211:	78 2b                	js     80123e <sys_env_set_pgfault_upcall+0x3d>
+  801213:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80121a:	75 37                	jne    801253 <sys_env_set_pgfault_upcall+0x52>
+  80121c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801221:	b8 09 00 00 00       	mov    $0x9,%eax
+  801226:	8b 55 08             	mov    0x8(%ebp),%edx
+  801229:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122c:	89 df                	mov    %ebx,%edi
+  80122e:	89 de                	mov    %ebx,%esi
+  801230:	cd 30                	int    $0x30
+  801232:	85 c0                	test   %eax,%eax
+  801234:	7f 41                	jg     801277 <sys_env_set_pgfault_upcall+0x76>
+  801236:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801239:	5b                   	pop    %ebx
+  80123a:	5e                   	pop    %esi
+  80123b:	5f                   	pop    %edi
+  80123c:	5d                   	pop    %ebp
+  80123d:	c3                   	ret
+  80123e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801243:	0f a2                	cpuid
+  801245:	c1 ea 0b             	shr    $0xb,%edx
+  801248:	83 e2 01             	and    $0x1,%edx
+  80124b:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801251:	eb c0                	jmp    801213 <sys_env_set_pgfault_upcall+0x12>
+  801253:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801258:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801263:	89 df                	mov    %ebx,%edi
+  801265:	89 de                	mov    %ebx,%esi
+  801267:	55                   	push   %ebp
+  801268:	68 71 12 80 00       	push   $0x801271
+  80126d:	89 e5                	mov    %esp,%ebp
+  80126f:	0f 34                	sysenter
+  801271:	83 c4 04             	add    $0x4,%esp
+  801274:	5d                   	pop    %ebp
+  801275:	eb bb                	jmp    801232 <sys_env_set_pgfault_upcall+0x31>
+  801277:	83 ec 0c             	sub    $0xc,%esp
+  80127a:	50                   	push   %eax
+  80127b:	6a 09                	push   $0x9
+  80127d:	68 a4 21 80 00       	push   $0x8021a4
+  801282:	6a 49                	push   $0x49
+  801284:	68 c1 21 80 00       	push   $0x8021c1
+  801289:	e8 3e 09 00 00       	call   801bcc <_panic>
+
+0080128e <sys_env_set_trace>:
+  80128e:	55                   	push   %ebp
+  80128f:	89 e5                	mov    %esp,%ebp
+  801291:	57                   	push   %edi
+  801292:	56                   	push   %esi
+  801293:	53                   	push   %ebx
+  801294:	83 ec 0c             	sub    $0xc,%esp
+  801297:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80129e:	78 2b                	js     8012cb <sys_env_set_trace+0x3d>
+  8012a0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8012a7:	75 37                	jne    8012e0 <sys_env_set_trace+0x52>
+  8012a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ae:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b9:	89 df                	mov    %ebx,%edi
+  8012bb:	89 de                	mov    %ebx,%esi
+  8012bd:	cd 30                	int    $0x30
+  8012bf:	85 c0                	test   %eax,%eax
+  8012c1:	7f 41                	jg     801304 <sys_env_set_trace+0x76>
+  8012c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c6:	5b                   	pop    %ebx
+  8012c7:	5e                   	pop    %esi
+  8012c8:	5f                   	pop    %edi
+  8012c9:	5d                   	pop    %ebp
+  8012ca:	c3                   	ret
+  8012cb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012d0:	0f a2                	cpuid
+  8012d2:	c1 ea 0b             	shr    $0xb,%edx
+  8012d5:	83 e2 01             	and    $0x1,%edx
+  8012d8:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8012de:	eb c0                	jmp    8012a0 <sys_env_set_trace+0x12>
+  8012e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012eb:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012f0:	89 df                	mov    %ebx,%edi
+  8012f2:	89 de                	mov    %ebx,%esi
+  8012f4:	55                   	push   %ebp
+  8012f5:	68 fe 12 80 00       	push   $0x8012fe
+  8012fa:	89 e5                	mov    %esp,%ebp
+  8012fc:	0f 34                	sysenter
+  8012fe:	83 c4 04             	add    $0x4,%esp
+  801301:	5d                   	pop    %ebp
+  801302:	eb bb                	jmp    8012bf <sys_env_set_trace+0x31>
+  801304:	83 ec 0c             	sub    $0xc,%esp
+  801307:	50                   	push   %eax
+  801308:	6a 12                	push   $0x12
+  80130a:	68 a4 21 80 00       	push   $0x8021a4
+  80130f:	6a 49                	push   $0x49
+  801311:	68 c1 21 80 00       	push   $0x8021c1
+  801316:	e8 b1 08 00 00       	call   801bcc <_panic>
+
+0080131b <sys_env_set_rdpmc>:
+  80131b:	55                   	push   %ebp
+  80131c:	89 e5                	mov    %esp,%ebp
+  80131e:	57                   	push   %edi
+  80131f:	56                   	push   %esi
+  801320:	53                   	push   %ebx
+  801321:	83 ec 0c             	sub    $0xc,%esp
+  801324:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80132b:	78 2b                	js     801358 <sys_env_set_rdpmc+0x3d>
+  80132d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801334:	75 37                	jne    80136d <sys_env_set_rdpmc+0x52>
+  801336:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801340:	8b 55 08             	mov    0x8(%ebp),%edx
+  801343:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801346:	89 df                	mov    %ebx,%edi
+  801348:	89 de                	mov    %ebx,%esi
+  80134a:	cd 30                	int    $0x30
+  80134c:	85 c0                	test   %eax,%eax
+  80134e:	7f 41                	jg     801391 <sys_env_set_rdpmc+0x76>
+  801350:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801353:	5b                   	pop    %ebx
+  801354:	5e                   	pop    %esi
+  801355:	5f                   	pop    %edi
+  801356:	5d                   	pop    %ebp
+  801357:	c3                   	ret
+  801358:	b8 01 00 00 00       	mov    $0x1,%eax
+  80135d:	0f a2                	cpuid
+  80135f:	c1 ea 0b             	shr    $0xb,%edx
+  801362:	83 e2 01             	and    $0x1,%edx
+  801365:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80136b:	eb c0                	jmp    80132d <sys_env_set_rdpmc+0x12>
+  80136d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801372:	8b 55 08             	mov    0x8(%ebp),%edx
+  801375:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801378:	b8 13 00 00 00       	mov    $0x13,%eax
+  80137d:	89 df                	mov    %ebx,%edi
+  80137f:	89 de                	mov    %ebx,%esi
+  801381:	55                   	push   %ebp
+  801382:	68 8b 13 80 00       	push   $0x80138b
+  801387:	89 e5                	mov    %esp,%ebp
+  801389:	0f 34                	sysenter
+  80138b:	83 c4 04             	add    $0x4,%esp
+  80138e:	5d                   	pop    %ebp
+  80138f:	eb bb                	jmp    80134c <sys_env_set_rdpmc+0x31>
+  801391:	83 ec 0c             	sub    $0xc,%esp
+  801394:	50                   	push   %eax
+  801395:	6a 13                	push   $0x13
+  801397:	68 a4 21 80 00       	push   $0x8021a4
+  80139c:	6a 49                	push   $0x49
+  80139e:	68 c1 21 80 00       	push   $0x8021c1
+  8013a3:	e8 24 08 00 00       	call   801bcc <_panic>
+
+008013a8 <sys_ring_setup>:
+  8013a8:	55                   	push   %ebp
+  8013a9:	89 e5                	mov    %esp,%ebp
+  8013ab:	57                   	push   %edi
+  8013ac:	56                   	push   %esi
+  8013ad:	53                   	push   %ebx
+  8013ae:	83 ec 0c             	sub    $0xc,%esp
+  8013b1:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013b8:	78 29                	js     8013e3 <sys_ring_setup+0x3b>
+  8013ba:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013c1:	75 35                	jne    8013f8 <sys_ring_setup+0x50>
+  8013c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013cd:	89 d1                	mov    %edx,%ecx
+  8013cf:	89 d3                	mov    %edx,%ebx
+  8013d1:	89 d7                	mov    %edx,%edi
+  8013d3:	89 d6                	mov    %edx,%esi
+  8013d5:	cd 30                	int    $0x30
+  8013d7:	85 c0                	test   %eax,%eax
+  8013d9:	7f 3f                	jg     80141a <sys_ring_setup+0x72>
+  8013db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013de:	5b                   	pop    %ebx
+  8013df:	5e                   	pop    %esi
+  8013e0:	5f                   	pop    %edi
+  8013e1:	5d                   	pop    %ebp
+  8013e2:	c3                   	ret
+  8013e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013e8:	0f a2                	cpuid
+  8013ea:	c1 ea 0b             	shr    $0xb,%edx
+  8013ed:	83 e2 01             	and    $0x1,%edx
+  8013f0:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8013f6:	eb c2                	jmp    8013ba <sys_ring_setup+0x12>
+  8013f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013fd:	b8 10 00 00 00       	mov    $0x10,%eax
+  801402:	89 d1                	mov    %edx,%ecx
+  801404:	89 d3                	mov    %edx,%ebx
+  801406:	89 d7                	mov    %edx,%edi
+  801408:	89 d6                	mov    %edx,%esi
+  80140a:	55                   	push   %ebp
+  80140b:	68 14 14 80 00       	push   $0x801414
+  801410:	89 e5                	mov    %esp,%ebp
+  801412:	0f 34                	sysenter
+  801414:	83 c4 04             	add    $0x4,%esp
+  801417:	5d                   	pop    %ebp
+  801418:	eb bd                	jmp    8013d7 <sys_ring_setup+0x2f>
+  80141a:	83 ec 0c             	sub    $0xc,%esp
+  80141d:	50                   	push   %eax
+  80141e:	6a 10                	push   $0x10
+  801420:	68 a4 21 80 00       	push   $0x8021a4
+  801425:	6a 49                	push   $0x49
+  801427:	68 c1 21 80 00       	push   $0x8021c1
+  80142c:	e8 9b 07 00 00       	call   801bcc <_panic>
+
+00801431 <sys_ring_enter>:
+  801431:	55                   	push   %ebp
+  801432:	89 e5                	mov    %esp,%ebp
+  801434:	57                   	push   %edi
+  801435:	56                   	push   %esi
+  801436:	53                   	push   %ebx
+  801437:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80143e:	78 22                	js     801462 <sys_ring_enter+0x31>
+  801440:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801447:	75 2e                	jne    801477 <sys_ring_enter+0x46>
+  801449:	ba 00 00 00 00       	mov    $0x0,%edx
+  80144e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801453:	89 d1                	mov    %edx,%ecx
+  801455:	89 d3                	mov    %edx,%ebx
+  801457:	89 d7                	mov    %edx,%edi
+  801459:	89 d6                	mov    %edx,%esi
+  80145b:	cd 30                	int    $0x30
+  80145d:	5b                   	pop    %ebx
+  80145e:	5e                   	pop    %esi
+  80145f:	5f                   	pop    %edi
+  801460:	5d                   	pop    %ebp
+  801461:	c3                   	ret
+  801462:	b8 01 00 00 00       	mov    $0x1,%eax
+  801467:	0f a2                	cpuid
+  801469:	c1 ea 0b             	shr    $0xb,%edx
+  80146c:	83 e2 01             	and    $0x1,%edx
+  80146f:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801475:	eb c9                	jmp    801440 <sys_ring_enter+0xf>
+  801477:	ba 00 00 00 00       	mov    $0x0,%edx
+  80147c:	b8 11 00 00 00       	mov    $0x11,%eax
+  801481:	89 d1                	mov    %edx,%ecx
+  801483:	89 d3                	mov    %edx,%ebx
+  801485:	89 d7                	mov    %edx,%edi
+  801487:	89 d6                	mov    %edx,%esi
+  801489:	55                   	push   %ebp
+  80148a:	68 93 14 80 00       	push   $0x801493
+  80148f:	89 e5                	mov    %esp,%ebp
+  801491:	0f 34                	sysenter
+  801493:	83 c4 04             	add    $0x4,%esp
+  801496:	5d                   	pop    %ebp
+  801497:	eb c4                	jmp    80145d <sys_ring_enter+0x2c>
+
+00801499 <sys_ipc_try_send>:
+  801499:	55                   	push   %ebp
+  80149a:	89 e5                	mov    %esp,%ebp
+  80149c:	57                   	push   %edi
+  80149d:	56                   	push   %esi
+  80149e:	53                   	push   %ebx
+  80149f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014a6:	78 26                	js     8014ce <sys_ipc_try_send+0x35>
+  8014a8:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014af:	75 32                	jne    8014e3 <sys_ipc_try_send+0x4a>
+  8014b1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014c4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014c7:	cd 30                	int    $0x30
+  8014c9:	5b                   	pop    %ebx
+  8014ca:	5e                   	pop    %esi
+  8014cb:	5f                   	pop    %edi
+  8014cc:	5d                   	pop    %ebp
+  8014cd:	c3                   	ret
+  8014ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014d3:	0f a2                	cpuid
+  8014d5:	c1 ea 0b             	shr    $0xb,%edx
+  8014d8:	83 e2 01             	and    $0x1,%edx
+  8014db:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8014e1:	eb c5                	jmp    8014a8 <sys_ipc_try_send+0xf>
+  8014e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014f6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014f9:	55                   	push   %ebp
+  8014fa:	68 03 15 80 00       	push   $0x801503
+  8014ff:	89 e5                	mov    %esp,%ebp
+  801501:	0f 34                	sysenter
+  801503:	83 c4 04             	add    $0x4,%esp
+  801506:	5d                   	pop    %ebp
+  801507:	eb c0                	jmp    8014c9 <sys_ipc_try_send+0x30>
+
+00801509 <sys_ipc_recv>:
+  801509:	55                   	push   %ebp
+  80150a:	89 e5                	mov    %esp,%ebp
+  80150c:	57                   	push   %edi
+  80150d:	56                   	push   %esi
+  80150e:	53                   	push   %ebx
+  80150f:	83 ec 0c             	sub    $0xc,%esp
+  801512:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801519:	78 2a                	js     801545 <sys_ipc_recv+0x3c>
+  80151b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801522:	75 36                	jne    80155a <sys_ipc_recv+0x51>
+  801524:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801529:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80152e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801531:	89 cb                	mov    %ecx,%ebx
+  801533:	89 cf                	mov    %ecx,%edi
+  801535:	89 ce                	mov    %ecx,%esi
+  801537:	cd 30                	int    $0x30
+  801539:	85 c0                	test   %eax,%eax
+  80153b:	7f 40                	jg     80157d <sys_ipc_recv+0x74>
+  80153d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801540:	5b                   	pop    %ebx
+  801541:	5e                   	pop    %esi
+  801542:	5f                   	pop    %edi
+  801543:	5d                   	pop    %ebp
+  801544:	c3                   	ret
+  801545:	b8 01 00 00 00       	mov    $0x1,%eax
+  80154a:	0f a2                	cpuid
+  80154c:	c1 ea 0b             	shr    $0xb,%edx
+  80154f:	83 e2 01             	and    $0x1,%edx
+  801552:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801558:	eb c1                	jmp    80151b <sys_ipc_recv+0x12>
+  80155a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801562:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801567:	89 cb                	mov    %ecx,%ebx
+  801569:	89 cf                	mov    %ecx,%edi
+  80156b:	89 ce                	mov    %ecx,%esi
+  80156d:	55                   	push   %ebp
+  80156e:	68 77 15 80 00       	push   $0x801577
+  801573:	89 e5                	mov    %esp,%ebp
+  801575:	0f 34                	sysenter
+  801577:	83 c4 04             	add    $0x4,%esp
+  80157a:	5d                   	pop    %ebp
+  80157b:	eb bc                	jmp    801539 <sys_ipc_recv+0x30>
+  80157d:	83 ec 0c             	sub    $0xc,%esp
+  801580:	50                   	push   %eax
+  801581:	6a 0c                	push   $0xc
+  801583:	68 a4 21 80 00       	push   $0x8021a4
+  801588:	6a 49                	push   $0x49
+  80158a:	68 c1 21 80 00       	push   $0x8021c1
+  80158f:	e8 38 06 00 00       	call   801bcc <_panic>
+
+00801594 <duppage>:
+  801594:	55                   	push   %ebp
+  801595:	89 e5                	mov    %esp,%ebp
+  801597:	53                   	push   %ebx
+  801598:	83 ec 04             	sub    $0x4,%esp
+  80159b:	89 d3                	mov    %edx,%ebx
+  80159d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015a4:	f6 c2 02             	test   $0x2,%dl
+  8015a7:	75 0c                	jne    8015b5 <duppage+0x21>
+  8015a9:	8b 14 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edx
+  8015b0:	f6 c6 08             	test   $0x8,%dh
+  8015b3:	74 64                	je     801619 <duppage+0x85>
+  8015b5:	c1 e3 0c             	shl    $0xc,%ebx
+  8015b8:	83 ec 0c             	sub    $0xc,%esp
+  8015bb:	68 05 08 00 00       	push   $0x805
+  8015c0:	53                   	push   %ebx
+  8015c1:	50                   	push   %eax
+  8015c2:	53                   	push   %ebx
+  8015c3:	6a 00                	push   $0x0
+  8015c5:	e8 24 fa ff ff       	call   800fee <sys_page_map>
+  8015ca:	83 c4 20             	add    $0x20,%esp
+  8015cd:	85 c0                	test   %eax,%eax
+  8015cf:	78 24                	js     8015f5 <duppage+0x61>
+  8015d1:	83 ec 0c             	sub    $0xc,%esp
+  8015d4:	68 05 08 00 00       	push   $0x805
+  8015d9:	53                   	push   %ebx
+  8015da:	6a 00                	push   $0x0
+  8015dc:	53                   	push   %ebx
+  8015dd:	6a 00                	push   $0x0
+  8015df:	e8 0a fa ff ff       	call   800fee <sys_page_map>
+  8015e4:	83 c4 20             	add    $0x20,%esp
+  8015e7:	85 c0                	test   %eax,%eax
+  8015e9:	78 1c                	js     801607 <duppage+0x73>
+  8015eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015f3:	c9                   	leave
+  8015f4:	c3                   	ret
+  8015f5:	50                   	push   %eax
+  8015f6:	68 cf 21 80 00       	push   $0x8021cf
+  8015fb:	6a 52                	push   $0x52
+  8015fd:	68 e0 21 80 00       	push   $0x8021e0
+  801602:	e8 c5 05 00 00       	call   801bcc <_panic>
+  801607:	50                   	push   %eax
+  801608:	68 cf 21 80 00       	push   $0x8021cf
+  80160d:	6a 55                	push   $0x55
+  80160f:	68 e0 21 80 00       	push   $0x8021e0
+  801614:	e8 b3 05 00 00       	call   801bcc <_panic>
+  801619:	c1 e3 0c             	shl    $0xc,%ebx
+  80161c:	83 ec 0c             	sub    $0xc,%esp
+  80161f:	6a 05                	push   $0x5
+  801621:	53                   	push   %ebx
+  801622:	50                   	push   %eax
+  801623:	53                   	push   %ebx
+  801624:	6a 00                	push   $0x0
+  801626:	e8 c3 f9 ff ff       	call   800fee <sys_page_map>
+  80162b:	83 c4 20             	add    $0x20,%esp
+  80162e:	85 c0                	test   %eax,%eax
+  801630:	79 b9                	jns    8015eb <duppage+0x57>
+  801632:	50                   	push   %eax
+  801633:	68 cf 21 80 00       	push   $0x8021cf
+  801638:	6a 59                	push   $0x59
+  80163a:	68 e0 21 80 00       	push   $0x8021e0
+  80163f:	e8 88 05 00 00       	call   801bcc <_panic>
+
+00801644 <pgfault>:
+  801644:	55                   	push   %ebp
+  801645:	89 e5                	mov    %esp,%ebp
+  801647:	53                   	push   %ebx
+  801648:	83 ec 04             	sub    $0x4,%esp
+  80164b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80164e:	8b 18                	mov    (%eax),%ebx
+  801650:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801654:	0f 84 90 00 00 00    	je     8016ea <pgfault+0xa6>
+  80165a:	89 d8                	mov    %ebx,%eax
+  80165c:	c1 e8 0c             	shr    $0xc,%eax
+  80165f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801666:	f7 c2 01 08 00 00    	test   $0x801,%edx
+  80166c:	74 7c                	je     8016ea <pgfault+0xa6>
+  80166e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801675:	c1 e8 0c             	shr    $0xc,%eax
+  801678:	0f b7 04 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%eax
+  80167f:	ef 
+  801680:	66 83 f8 01          	cmp    $0x1,%ax
+  801684:	74 78                	je     8016fe <pgfault+0xba>
+  801686:	83 ec 04             	sub    $0x4,%esp
+  801689:	6a 07                	push   $0x7
+  80168b:	68 00 f0 7f 00       	push   $0x7ff000
+  801690:	6a 00                	push   $0x0
+  801692:	e8 c8 f8 ff ff       	call   800f5f <sys_page_alloc>
+  801697:	83 c4 10             	add    $0x10,%esp
+  80169a:	85 c0                	test   %eax,%eax
+  80169c:	78 7f                	js     80171d <pgfault+0xd9>
+  80169e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8016a4:	83 ec 08             	sub    $0x8,%esp
+  8016a7:	53                   	push   %ebx
+  8016a8:	68 00 f0 7f 00       	push   $0x7ff000
+  8016ad:	e8 86 f3 ff ff       	call   800a38 <page_copy>
+  8016b2:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8016b9:	53                   	push   %ebx
+  8016ba:	6a 00                	push   $0x0
+  8016bc:	68 00 f0 7f 00       	push   $0x7ff000
+  8016c1:	6a 00                	push   $0x0
+  8016c3:	e8 26 f9 ff ff       	call   800fee <sys_page_map>
+  8016c8:	83 c4 20             	add    $0x20,%esp
+  8016cb:	85 c0                	test   %eax,%eax
+  8016cd:	78 60                	js     80172f <pgfault+0xeb>
+  8016cf:	83 ec 08             	sub    $0x8,%esp
+  8016d2:	68 00 f0 7f 00       	push   $0x7ff000
+  8016d7:	6a 00                	push   $0x0
+  8016d9:	e8 9d f9 ff ff       	call   80107b <sys_page_unmap>
+  8016de:	83 c4 10             	add    $0x10,%esp
+  8016e1:	85 c0                	test   %eax,%eax
+  8016e3:	78 5c                	js     801741 <pgfault+0xfd>
+  8016e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016e8:	c9                   	leave
+  8016e9:	c3                   	ret
+  8016ea:	83 ec 04             	sub    $0x4,%esp
+  8016ed:	68 eb 21 80 00       	push   $0x8021eb
+  8016f2:	6a 1c                	push   $0x1c
+  8016f4:	68 e0 21 80 00       	push   $0x8021e0
+  8016f9:	e8 ce 04 00 00       	call   801bcc <_panic>
+  8016fe:	83 ec 08             	sub    $0x8,%esp
+  801701:	89 d8                	mov    %ebx,%eax
+  801703:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801708:	50                   	push   %eax
+  801709:	6a 00                	push   $0x0
+  80170b:	e8 f8 f9 ff ff       	call   801108 <sys_page_reuse>
+  801710:	83 c4 10             	add    $0x10,%esp
+  801713:	85 c0                	test   %eax,%eax
+  801715:	0f 85 6b ff ff ff    	jne    801686 <pgfault+0x42>
+  80171b:	eb c8                	jmp    8016e5 <pgfault+0xa1>
+  80171d:	50                   	push   %eax
+  80171e:	68 08 22 80 00       	push   $0x802208
+  801723:	6a 31                	push   $0x31
+  801725:	68 e0 21 80 00       	push   $0x8021e0
+  80172a:	e8 9d 04 00 00       	call   801bcc <_panic>
+  80172f:	50                   	push   %eax
+  801730:	68 cf 21 80 00       	push   $0x8021cf
+  801735:	6a 36                	push   $0x36
+  801737:	68 e0 21 80 00       	push   $0x8021e0
+  80173c:	e8 8b 04 00 00       	call   801bcc <_panic>
+  801741:	50                   	push   %eax
+  801742:	68 1b 22 80 00       	push   $0x80221b
+  801747:	6a 38                	push   $0x38
+  801749:	68 e0 21 80 00       	push   $0x8021e0
+  80174e:	e8 79 04 00 00       	call   801bcc <_panic>
+
+00801753 <fork>:
+  801753:	55                   	push   %ebp
+  801754:	89 e5                	mov    %esp,%ebp
+  801756:	53                   	push   %ebx
+  801757:	83 ec 20             	sub    $0x20,%esp
+  80175a:	68 44 16 80 00       	push   $0x801644
+  80175f:	e8 b3 04 00 00       	call   801c17 <set_pgfault_handler>
+  801764:	83 c4 08             	add    $0x8,%esp
+  801767:	6a 01                	push   $0x1
+  801769:	6a 00                	push   $0x0
+  80176b:	e8 d5 f6 ff ff       	call   800e45 <sys_env_set_cow>
+  801770:	83 c4 10             	add    $0x10,%esp
+  801773:	85 c0                	test   %eax,%eax
+  801775:	78 38                	js     8017af <fork+0x5c>
+  801777:	e8 59 03 00 00       	call   801ad5 <bflush>
+  80177c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801781:	cd 30                	int    $0x30
+  801783:	89 c3                	mov    %eax,%ebx
+  801785:	85 c0                	test   %eax,%eax
+  801787:	78 38                	js     8017c1 <fork+0x6e>
+  801789:	ba 00 00 80 00       	mov    $0x800000,%edx
+  80178e:	75 4f                	jne    8017df <fork+0x8c>
+  801790:	e8 a7 02 00 00       	call   801a3c <uinfo_envid>
+  801795:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80179a:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8017a0:	05 00 00 00 ed       	add    $0xed000000,%eax
+  8017a5:	a3 20 30 80 00       	mov    %eax,0x803020
+  8017aa:	e9 c9 00 00 00       	jmp    801878 <fork+0x125>
+  8017af:	50                   	push   %eax
+  8017b0:	68 2e 22 80 00       	push   $0x80222e
+  8017b5:	6a 7c                	push   $0x7c
+  8017b7:	68 e0 21 80 00       	push   $0x8021e0
+  8017bc:	e8 0b 04 00 00       	call   801bcc <_panic>
+  8017c1:	50                   	push   %eax
+  8017c2:	68 42 22 80 00       	push   $0x802242
+  8017c7:	68 88 00 00 00       	push   $0x88
+  8017cc:	68 e0 21 80 00       	push   $0x8021e0
+  8017d1:	e8 f6 03 00 00       	call   801bcc <_panic>
+  8017d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017d9:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017df:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  8017e2:	81 fa ff ff ff ea    	cmp    $0xeaffffff,%edx
+  8017e8:	77 34                	ja     80181e <fork+0xcb>
+  8017ea:	81 fa 00 f0 ff ea    	cmp    $0xeafff000,%edx
+  8017f0:	74 e4                	je     8017d6 <fork+0x83>
+  8017f2:	89 d0                	mov    %edx,%eax
+  8017f4:	c1 e8 16             	shr    $0x16,%eax
+  8017f7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8017fe:	a8 01                	test   $0x1,%al
+  801800:	74 d4                	je     8017d6 <fork+0x83>
+  801802:	89 d0                	mov    %edx,%eax
+  801804:	c1 e8 0c             	shr    $0xc,%eax
+  801807:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80180e:	a8 01                	test   $0x1,%al
+  801810:	74 c4                	je     8017d6 <fork+0x83>
+  801812:	c1 ea 0c             	shr    $0xc,%edx
+  801815:	89 d8                	mov    %ebx,%eax
+  801817:	e8 78 fd ff ff       	call   801594 <duppage>
+  80181c:	eb b8                	jmp    8017d6 <fork+0x83>
+  80181e:	83 ec 04             	sub    $0x4,%esp
+  801821:	6a 07                	push   $0x7
+  801823:	68 00 f0 ff ea       	push   $0xeafff000
+  801828:	53                   	push   %ebx
+  801829:	e8 31 f7 ff ff       	call   800f5f <sys_page_alloc>
+  80182e:	83 c4 10             	add    $0x10,%esp
+  801831:	85 c0                	test   %eax,%eax
+  801833:	78 4a                	js     80187f <fork+0x12c>
+  801835:	a1 20 30 80 00       	mov    0x803020,%eax
+  80183a:	8b 40 58             	mov    0x58(%eax),%eax
+  80183d:	83 ec 08             	sub    $0x8,%esp
+  801840:	50                   	push   %eax
+  801841:	53                   	push   %ebx
+  801842:	e8 ba f9 ff ff       	call   801201 <sys_env_set_pgfault_upcall>
+  801847:	83 c4 08             	add    $0x8,%esp
+  80184a:	6a 01                	push   $0x1
+  80184c:	53                   	push   %ebx
+  80184d:	e8 f3 f5 ff ff       	call   800e45 <sys_env_set_cow>
+  801852:	83 c4 10             	add    $0x10,%esp
+  801855:	85 c0                	test   %eax,%eax
+  801857:	78 3b                	js     801894 <fork+0x141>
+  801859:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80185c:	c1 ea 0c             	shr    $0xc,%edx
+  80185f:	89 d8                	mov    %ebx,%eax
+  801861:	e8 2e fd ff ff       	call   801594 <duppage>
+  801866:	83 ec 08             	sub    $0x8,%esp
+  801869:	6a 02                	push   $0x2
+  80186b:	53                   	push   %ebx
+  80186c:	e8 03 f9 ff ff       	call   801174 <sys_env_set_status>
+  801871:	83 c4 10             	add    $0x10,%esp
+  801874:	85 c0                	test   %eax,%eax
+  801876:	78 31                	js     8018a9 <fork+0x156>
+  801878:	89 d8                	mov    %ebx,%eax
+  80187a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80187d:	c9                   	leave
+  80187e:	c3                   	ret
+  80187f:	50                   	push   %eax
+  801880:	68 08 22 80 00       	push   $0x802208
+  801885:	68 a1 00 00 00       	push   $0xa1
+  80188a:	68 e0 21 80 00       	push   $0x8021e0
+  80188f:	e8 38 03 00 00       	call   801bcc <_panic>
+  801894:	50                   	push   %eax
+  801895:	68 2e 22 80 00       	push   $0x80222e
+  80189a:	68 a6 00 00 00       	push   $0xa6
+  80189f:	68 e0 21 80 00       	push   $0x8021e0
+  8018a4:	e8 23 03 00 00       	call   801bcc <_panic>
+  8018a9:	50                   	push   %eax
+  8018aa:	68 52 22 80 00       	push   $0x802252
+  8018af:	68 ad 00 00 00       	push   $0xad
+  8018b4:	68 e0 21 80 00       	push   $0x8021e0
+  8018b9:	e8 0e 03 00 00       	call   801bcc <_panic>
+
+008018be <sfork>:
+  8018be:	55                   	push   %ebp
+  8018bf:	89 e5                	mov    %esp,%ebp
+  8018c1:	83 ec 0c             	sub    $0xc,%esp
+  8018c4:	68 69 22 80 00       	push   $0x802269
+  8018c9:	68 b6 00 00 00       	push   $0xb6
+  8018ce:	68 e0 21 80 00       	push   $0x8021e0
+  8018d3:	e8 f4 02 00 00       	call   801bcc <_panic>
+
+008018d8 <ipc_recv>:
+  8018d8:	55                   	push   %ebp
+  8018d9:	89 e5                	mov    %esp,%ebp
+  8018db:	56                   	push   %esi
+  8018dc:	53                   	push   %ebx
+  8018dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018e6:	85 c0                	test   %eax,%eax
+  8018e8:	74 41                	je     80192b <ipc_recv+0x53>
+  8018ea:	83 ec 0c             	sub    $0xc,%esp
+  8018ed:	50                   	push   %eax
+  8018ee:	e8 16 fc ff ff       	call   801509 <sys_ipc_recv>
+  8018f3:	83 c4 10             	add    $0x10,%esp
+  8018f6:	85 f6                	test   %esi,%esi
+  8018f8:	74 17                	je     801911 <ipc_recv+0x39>
+  8018fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ff:	85 c0                	test   %eax,%eax
+  801901:	75 0c                	jne    80190f <ipc_recv+0x37>
+  801903:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801909:	8b 92 0c 01 00 00    	mov    0x10c(%edx),%edx
+  80190f:	89 16                	mov    %edx,(%esi)
+  801911:	85 db                	test   %ebx,%ebx
+  801913:	74 42                	je     801957 <ipc_recv+0x7f>
+  801915:	85 c0                	test   %eax,%eax
+  801917:	74 24                	je     80193d <ipc_recv+0x65>
+  801919:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80191f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801924:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801927:	5b                   	pop    %ebx
+  801928:	5e                   	pop    %esi
+  801929:	5d                   	pop    %ebp
+  80192a:	c3                   	ret
+  80192b:	83 ec 0c             	sub    $0xc,%esp
+  80192e:	68 01 00 00 eb       	push   $0xeb000001
+  801933:	e8 d1 fb ff ff       	call   801509 <sys_ipc_recv>
+  801938:	83 c4 10             	add    $0x10,%esp
+  80193b:	eb b9                	jmp    8018f6 <ipc_recv+0x1e>
+  80193d:	a1 20 30 80 00       	mov    0x803020,%eax
+  801942:	8b 80 10 01 00 00    	mov    0x110(%eax),%eax
+  801948:	89 03                	mov    %eax,(%ebx)
+  80194a:	a1 20 30 80 00       	mov    0x803020,%eax
+  80194f:	8b 80 08 01 00 00    	mov    0x108(%eax),%eax
+  801955:	eb cd                	jmp    801924 <ipc_recv+0x4c>
+  801957:	85 c0                	test   %eax,%eax
+  801959:	74 ef                	je     80194a <ipc_recv+0x72>
+  80195b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801960:	eb c2                	jmp    801924 <ipc_recv+0x4c>
+
+00801962 <ipc_send>:
+  801962:	55                   	push   %ebp
+  801963:	89 e5                	mov    %esp,%ebp
+  801965:	57                   	push   %edi
+  801966:	56                   	push   %esi
+  801967:	53                   	push   %ebx
+  801968:	83 ec 0c             	sub    $0xc,%esp
+  80196b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80196e:	8b 75 10             	mov    0x10(%ebp),%esi
+  801971:	eb 21                	jmp    801994 <ipc_send+0x32>
+  801973:	ff 75 14             	push   0x14(%ebp)
+  801976:	68 01 00 00 eb       	push   $0xeb000001
+  80197b:	ff 75 0c             	push   0xc(%ebp)
+  80197e:	57                   	push   %edi
+  80197f:	e8 15 fb ff ff       	call   801499 <sys_ipc_try_send>
+  801984:	89 c3                	mov    %eax,%ebx
+  801986:	83 c4 10             	add    $0x10,%esp
+  801989:	eb 1f                	jmp    8019aa <ipc_send+0x48>
+  80198b:	83 fb f9             	cmp    $0xfffffff9,%ebx
+  80198e:	74 37                	je     8019c7 <ipc_send+0x65>
+  801990:	85 db                	test   %ebx,%ebx
+  801992:	74 3a                	je     8019ce <ipc_send+0x6c>
+  801994:	85 f6                	test   %esi,%esi
+  801996:	74 db                	je     801973 <ipc_send+0x11>
+  801998:	ff 75 14             	push   0x14(%ebp)
+  80199b:	56                   	push   %esi
+  80199c:	ff 75 0c             	push   0xc(%ebp)
+  80199f:	57                   	push   %edi
+  8019a0:	e8 f4 fa ff ff       	call   801499 <sys_ipc_try_send>
+  8019a5:	89 c3                	mov    %eax,%ebx
+  8019a7:	83 c4 10             	add    $0x10,%esp
+  8019aa:	85 db                	test   %ebx,%ebx
+  8019ac:	74 dd                	je     80198b <ipc_send+0x29>
+  8019ae:	83 fb f9             	cmp    $0xfffffff9,%ebx
+  8019b1:	74 d8                	je     80198b <ipc_send+0x29>
+  8019b3:	83 ec 04             	sub    $0x4,%esp
+  8019b6:	68 7f 22 80 00       	push   $0x80227f
+  8019bb:	6a 40                	push   $0x40
+  8019bd:	68 92 22 80 00       	push   $0x802292
+  8019c2:	e8 05 02 00 00       	call   801bcc <_panic>
+  8019c7:	e8 11 f4 ff ff       	call   800ddd <sys_yield>
+  8019cc:	eb c2                	jmp    801990 <ipc_send+0x2e>
+  8019ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d1:	5b                   	pop    %ebx
+  8019d2:	5e                   	pop    %esi
+  8019d3:	5f                   	pop    %edi
+  8019d4:	5d                   	pop    %ebp
+  8019d5:	c3                   	ret
+
+008019d6 <ipc_find_env>:
+  8019d6:	55                   	push   %ebp
+  8019d7:	89 e5                	mov    %esp,%ebp
+  8019d9:	56                   	push   %esi
+  8019da:	53                   	push   %ebx
+  8019db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019de:	b9 7f 03 00 ed       	mov    $0xed00037f,%ecx
+  8019e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e8:	89 c3                	mov    %eax,%ebx
+  8019ea:	83 c0 01             	add    $0x1,%eax
+  8019ed:	89 ca                	mov    %ecx,%edx
+  8019ef:	c1 ea 0c             	shr    $0xc,%edx
+  8019f2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019f9:	f6 c2 01             	test   $0x1,%dl
+  8019fc:	74 35                	je     801a33 <ipc_find_env+0x5d>
+  8019fe:	69 d3 80 03 00 00    	imul   $0x380,%ebx,%edx
+  801a04:	81 c2 00 00 00 ed    	add    $0xed000000,%edx
+  801a0a:	8b 52 48             	mov    0x48(%edx),%edx
+  801a0d:	81 c1 80 03 00 00    	add    $0x380,%ecx
+  801a13:	39 f2                	cmp    %esi,%edx
+  801a15:	74 0e                	je     801a25 <ipc_find_env+0x4f>
+  801a17:	3d 00 80 00 00       	cmp    $0x8000,%eax
+  801a1c:	75 ca                	jne    8019e8 <ipc_find_env+0x12>
+  801a1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a23:	eb 13                	jmp    801a38 <ipc_find_env+0x62>
+  801a25:	69 db 80 03 00 00    	imul   $0x380,%ebx,%ebx
+  801a2b:	8b 83 40 00 00 ed    	mov    -0x12ffffc0(%ebx),%eax
+  801a31:	eb 05                	jmp    801a38 <ipc_find_env+0x62>
+  801a33:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a38:	5b                   	pop    %ebx
+  801a39:	5e                   	pop    %esi
+  801a3a:	5d                   	pop    %ebp
+  801a3b:	c3                   	ret
+
+00801a3c <uinfo_envid>:
+  801a3c:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  801a41:	c3                   	ret
+
+00801a42 <uinfo_cpunum>:
+  801a42:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  801a47:	c3                   	ret
+
+00801a48 <uinfo_ticks>:
+  801a48:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  801a4d:	c3                   	ret
+
+00801a4e <uinfo_nsec>:
+  801a4e:	55                   	push   %ebp
+  801a4f:	89 e5                	mov    %esp,%ebp
+  801a51:	57                   	push   %edi
+  801a52:	56                   	push   %esi
+  801a53:	53                   	push   %ebx
+  801a54:	83 ec 1c             	sub    $0x1c,%esp
+  801a57:	0f 31                	rdtsc
+  801a59:	89 c6                	mov    %eax,%esi
+  801a5b:	89 d7                	mov    %edx,%edi
+  801a5d:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801a63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6d:	85 c9                	test   %ecx,%ecx
+  801a6f:	74 5c                	je     801acd <uinfo_nsec+0x7f>
+  801a71:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a76:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801a79:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a7c:	52                   	push   %edx
+  801a7d:	51                   	push   %ecx
+  801a7e:	57                   	push   %edi
+  801a7f:	56                   	push   %esi
+  801a80:	e8 ff 02 00 00       	call   801d84 <__umoddi3>
+  801a85:	83 c4 10             	add    $0x10,%esp
+  801a88:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801a8e:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801a93:	f7 e3                	mul    %ebx
+  801a95:	01 ca                	add    %ecx,%edx
+  801a97:	ff 75 e4             	push   -0x1c(%ebp)
+  801a9a:	ff 75 e0             	push   -0x20(%ebp)
+  801a9d:	52                   	push   %edx
+  801a9e:	50                   	push   %eax
+  801a9f:	e8 08 02 00 00       	call   801cac <__udivdi3>
+  801aa4:	83 c4 10             	add    $0x10,%esp
+  801aa7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801aaa:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801aad:	ff 75 e4             	push   -0x1c(%ebp)
+  801ab0:	ff 75 e0             	push   -0x20(%ebp)
+  801ab3:	57                   	push   %edi
+  801ab4:	56                   	push   %esi
+  801ab5:	e8 f2 01 00 00       	call   801cac <__udivdi3>
+  801aba:	83 c4 10             	add    $0x10,%esp
+  801abd:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801ac3:	f7 e3                	mul    %ebx
+  801ac5:	01 ca                	add    %ecx,%edx
+  801ac7:	03 45 d8             	add    -0x28(%ebp),%eax
+  801aca:	13 55 dc             	adc    -0x24(%ebp),%edx
+  801acd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ad0:	5b                   	pop    %ebx
+  801ad1:	5e                   	pop    %esi
+  801ad2:	5f                   	pop    %edi
+  801ad3:	5d                   	pop    %ebp
+  801ad4:	c3                   	ret
+
+00801ad5 <bflush>:
+  801ad5:	a1 40 30 80 00       	mov    0x803040,%eax
+  801ada:	85 c0                	test   %eax,%eax
+  801adc:	75 01                	jne    801adf <bflush+0xa>
+  801ade:	c3                   	ret
+  801adf:	55                   	push   %ebp
+  801ae0:	89 e5                	mov    %esp,%ebp
+  801ae2:	83 ec 10             	sub    $0x10,%esp
+  801ae5:	50                   	push   %eax
+  801ae6:	68 44 30 80 00       	push   $0x803044
+  801aeb:	e8 2c f1 ff ff       	call   800c1c <sys_cputs>
+  801af0:	c7 05 40 30 80 00 00 	movl   $0x0,0x803040
+  801af7:	00 00 00 
+  801afa:	83 c4 10             	add    $0x10,%esp
+  801afd:	c9                   	leave
+  801afe:	c3                   	ret
+
+00801aff <bputch>:
+  801aff:	55                   	push   %ebp
+  801b00:	89 e5                	mov    %esp,%ebp
+  801b02:	53                   	push   %ebx
+  801b03:	83 ec 04             	sub    $0x4,%esp
+  801b06:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b09:	8b 15 40 30 80 00    	mov    0x803040,%edx
+  801b0f:	8d 42 01             	lea    0x1(%edx),%eax
+  801b12:	a3 40 30 80 00       	mov    %eax,0x803040
+  801b17:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801b1a:	88 8a 44 30 80 00    	mov    %cl,0x803044(%edx)
+  801b20:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b25:	77 08                	ja     801b2f <bputch+0x30>
+  801b27:	83 03 01             	addl   $0x1,(%ebx)
+  801b2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b2d:	c9                   	leave
+  801b2e:	c3                   	ret
+  801b2f:	e8 a1 ff ff ff       	call   801ad5 <bflush>
+  801b34:	eb f1                	jmp    801b27 <bputch+0x28>
+
+00801b36 <vbprintf>:
+  801b36:	55                   	push   %ebp
+  801b37:	89 e5                	mov    %esp,%ebp
+  801b39:	83 ec 18             	sub    $0x18,%esp
+  801b3c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801b43:	ff 75 0c             	push   0xc(%ebp)
+  801b46:	ff 75 08             	push   0x8(%ebp)
+  801b49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b4c:	50                   	push   %eax
+  801b4d:	68 ff 1a 80 00       	push   $0x801aff
+  801b52:	e8 58 e7 ff ff       	call   8002af <vprintfmt>
+  801b57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b5a:	c9                   	leave
+  801b5b:	c3                   	ret
+
+00801b5c <bprintf>:
+  801b5c:	55                   	push   %ebp
+  801b5d:	89 e5                	mov    %esp,%ebp
+  801b5f:	83 ec 10             	sub    $0x10,%esp
+  801b62:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801b65:	50                   	push   %eax
+  801b66:	ff 75 08             	push   0x8(%ebp)
+  801b69:	e8 c8 ff ff ff       	call   801b36 <vbprintf>
+  801b6e:	c9                   	leave
+  801b6f:	c3                   	ret
+
+00801b70 <bwrite>:
+  801b70:	55                   	push   %ebp
+  801b71:	89 e5                	mov    %esp,%ebp
+  801b73:	53                   	push   %ebx
+  801b74:	83 ec 04             	sub    $0x4,%esp
+  801b77:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b7a:	89 d8                	mov    %ebx,%eax
+  801b7c:	03 05 40 30 80 00    	add    0x803040,%eax
+  801b82:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b87:	76 0d                	jbe    801b96 <bwrite+0x26>
+  801b89:	e8 47 ff ff ff       	call   801ad5 <bflush>
+  801b8e:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801b94:	77 25                	ja     801bbb <bwrite+0x4b>
+  801b96:	83 ec 04             	sub    $0x4,%esp
+  801b99:	53                   	push   %ebx
+  801b9a:	ff 75 08             	push   0x8(%ebp)
+  801b9d:	a1 40 30 80 00       	mov    0x803040,%eax
+  801ba2:	05 44 30 80 00       	add    $0x803044,%eax
+  801ba7:	50                   	push   %eax
+  801ba8:	e8 6d ee ff ff       	call   800a1a <memcpy>
+  801bad:	01 1d 40 30 80 00    	add    %ebx,0x803040
+  801bb3:	83 c4 10             	add    $0x10,%esp
+  801bb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bb9:	c9                   	leave
+  801bba:	c3                   	ret
+  801bbb:	83 ec 08             	sub    $0x8,%esp
+  801bbe:	53                   	push   %ebx
+  801bbf:	ff 75 08             	push   0x8(%ebp)
+  801bc2:	e8 55 f0 ff ff       	call   800c1c <sys_cputs>
+  801bc7:	83 c4 10             	add    $0x10,%esp
+  801bca:	eb ea                	jmp    801bb6 <bwrite+0x46>
+
+00801bcc <_panic>:
+  801bcc:	55                   	push   %ebp
+  801bcd:	89 e5                	mov    %esp,%ebp
+  801bcf:	56                   	push   %esi
+  801bd0:	53                   	push   %ebx
+  801bd1:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  801bd4:	e8 fc fe ff ff       	call   801ad5 <bflush>
+  801bd9:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801bdf:	e8 91 f1 ff ff       	call   800d75 <sys_getenvid>
+  801be4:	83 ec 0c             	sub    $0xc,%esp
+  801be7:	ff 75 0c             	push   0xc(%ebp)
+  801bea:	ff 75 08             	push   0x8(%ebp)
+  801bed:	56                   	push   %esi
+  801bee:	50                   	push   %eax
+  801bef:	68 9c 22 80 00       	push   $0x80229c
+  801bf4:	e8 bf e5 ff ff       	call   8001b8 <cprintf>
+  801bf9:	83 c4 18             	add    $0x18,%esp
+  801bfc:	53                   	push   %ebx
+  801bfd:	ff 75 10             	push   0x10(%ebp)
+  801c00:	e8 62 e5 ff ff       	call   800167 <vcprintf>
+  801c05:	c7 04 24 47 1f 80 00 	movl   $0x801f47,(%esp)
+  801c0c:	e8 a7 e5 ff ff       	call   8001b8 <cprintf>
+  801c11:	83 c4 10             	add    $0x10,%esp
+  801c14:	cc                   	int3
+  801c15:	eb fd                	jmp    801c14 <_panic+0x48>
+
+00801c17 <set_pgfault_handler>:
+  801c17:	55                   	push   %ebp
+  801c18:	89 e5                	mov    %esp,%ebp
+  801c1a:	83 ec 08             	sub    $0x8,%esp
+  801c1d:	83 3d 44 34 80 00 00 	cmpl   $0x0,0x803444
+  801c24:	74 0a                	je     801c30 <set_pgfault_handler+0x19>
+  801c26:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c29:	a3 44 34 80 00       	mov    %eax,0x803444
+  801c2e:	c9                   	leave
+  801c2f:	c3                   	ret
+  801c30:	83 ec 04             	sub    $0x4,%esp
+  801c33:	6a 07                	push   $0x7
+  801c35:	68 00 f0 ff ea       	push   $0xeafff000
+  801c3a:	6a 00                	push   $0x0
+  801c3c:	e8 1e f3 ff ff       	call   800f5f <sys_page_alloc>
+  801c41:	83 c4 10             	add    $0x10,%esp
+  801c44:	85 c0                	test   %eax,%eax
+  801c46:	75 2a                	jne    801c72 <set_pgfault_handler+0x5b>
+  801c48:	83 ec 08             	sub    $0x8,%esp
+  801c4b:	68 86 1c 80 00       	push   $0x801c86
+  801c50:	6a 00                	push   $0x0
+  801c52:	e8 aa f5 ff ff       	call   801201 <sys_env_set_pgfault_upcall>
+  801c57:	83 c4 10             	add    $0x10,%esp
+  801c5a:	85 c0                	test   %eax,%eax
+  801c5c:	74 c8                	je     801c26 <set_pgfault_handler+0xf>
+  801c5e:	83 ec 04             	sub    $0x4,%esp
+  801c61:	68 e4 22 80 00       	push   $0x8022e4
+  801c66:	6a 28                	push   $0x28
+  801c68:	68 d5 22 80 00       	push   $0x8022d5
+  801c6d:	e8 5a ff ff ff       	call   801bcc <_panic>
+  801c72:	83 ec 04             	sub    $0x4,%esp
+  801c75:	68 bf 22 80 00       	push   $0x8022bf
+  801c7a:	6a 22                	push   $0x22
+  801c7c:	68 d5 22 80 00       	push   $0x8022d5
+  801c81:	e8 46 ff ff ff       	call   801bcc <_panic>
+
+00801c86 <_pgfault_upcall>:
+  801c86:	54                   	push   %esp
+  801c87:	a1 44 34 80 00       	mov    0x803444,%eax
+  801c8c:	ff d0                	call   *%eax
+  801c8e:	83 c4 04             	add    $0x4,%esp
+  801c91:	8b 44 24 28          	mov    0x28(%esp),%eax
+  801c95:	89 e5                	mov    %esp,%ebp
+  801c97:	8b 64 24 30          	mov    0x30(%esp),%esp
+  801c9b:	50                   	push   %eax
+  801c9c:	89 ec                	mov    %ebp,%esp
+  801c9e:	83 c4 08             	add    $0x8,%esp
+  801ca1:	61                   	popa
+  801ca2:	83 c4 04             	add    $0x4,%esp
+  801ca5:	9d                   	popf
+  801ca6:	5c                   	pop    %esp
+  801ca7:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+  801cab:	c3                   	ret
+
+00801cac <__udivdi3>:
+  801cac:	57                   	push   %edi
+  801cad:	56                   	push   %esi
+  801cae:	53                   	push   %ebx
+  801caf:	83 ec 20             	sub    $0x20,%esp
+  801cb2:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801cb6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801cba:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801cbe:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801cc2:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801cc6:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801cca:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801cce:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801cd2:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801cd6:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801cda:	89 d1                	mov    %edx,%ecx
+  801cdc:	09 c1                	or     %eax,%ecx
+  801cde:	0f 84 91 00 00 00    	je     801d75 <__udivdi3+0xc9>
+  801ce4:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801ceb:	00 
+  801cec:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801cf3:	00 
+  801cf4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d03:	eb 08                	jmp    801d0d <__udivdi3+0x61>
+  801d05:	83 e9 01             	sub    $0x1,%ecx
+  801d08:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801d0b:	74 68                	je     801d75 <__udivdi3+0xc9>
+  801d0d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801d11:	01 c0                	add    %eax,%eax
+  801d13:	89 c6                	mov    %eax,%esi
+  801d15:	89 d7                	mov    %edx,%edi
+  801d17:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801d1b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801d1f:	0f ad d0             	shrd   %cl,%edx,%eax
+  801d22:	d3 ea                	shr    %cl,%edx
+  801d24:	f6 c1 20             	test   $0x20,%cl
+  801d27:	74 04                	je     801d2d <__udivdi3+0x81>
+  801d29:	89 d0                	mov    %edx,%eax
+  801d2b:	31 d2                	xor    %edx,%edx
+  801d2d:	83 e0 01             	and    $0x1,%eax
+  801d30:	89 04 24             	mov    %eax,(%esp)
+  801d33:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801d3a:	00 
+  801d3b:	8b 04 24             	mov    (%esp),%eax
+  801d3e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801d42:	09 f0                	or     %esi,%eax
+  801d44:	09 fa                	or     %edi,%edx
+  801d46:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801d4a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801d4e:	39 f0                	cmp    %esi,%eax
+  801d50:	89 d3                	mov    %edx,%ebx
+  801d52:	19 fb                	sbb    %edi,%ebx
+  801d54:	72 af                	jb     801d05 <__udivdi3+0x59>
+  801d56:	29 f0                	sub    %esi,%eax
+  801d58:	19 fa                	sbb    %edi,%edx
+  801d5a:	89 cf                	mov    %ecx,%edi
+  801d5c:	c1 ef 05             	shr    $0x5,%edi
+  801d5f:	83 e7 01             	and    $0x1,%edi
+  801d62:	89 fe                	mov    %edi,%esi
+  801d64:	83 f6 01             	xor    $0x1,%esi
+  801d67:	d3 e6                	shl    %cl,%esi
+  801d69:	d3 e7                	shl    %cl,%edi
+  801d6b:	09 74 24 18          	or     %esi,0x18(%esp)
+  801d6f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  801d73:	eb 90                	jmp    801d05 <__udivdi3+0x59>
+  801d75:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801d79:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  801d7d:	83 c4 20             	add    $0x20,%esp
+  801d80:	5b                   	pop    %ebx
+  801d81:	5e                   	pop    %esi
+  801d82:	5f                   	pop    %edi
+  801d83:	c3                   	ret
+
+00801d84 <__umoddi3>:
+  801d84:	55                   	push   %ebp
+  801d85:	57                   	push   %edi
+  801d86:	56                   	push   %esi
+  801d87:	53                   	push   %ebx
+  801d88:	83 ec 1c             	sub    $0x1c,%esp
+  801d8b:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801d8f:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801d93:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801d97:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801d9b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801d9f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801da3:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801da7:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801dab:	89 d6                	mov    %edx,%esi
+  801dad:	09 c6                	or     %eax,%esi
+  801daf:	74 6c                	je     801e1d <__umoddi3+0x99>
+  801db1:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dc0:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801dc4:	eb 0e                	jmp    801dd4 <__umoddi3+0x50>
+  801dc6:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801dcb:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801dcf:	83 fe ff             	cmp    $0xffffffff,%esi
+  801dd2:	74 49                	je     801e1d <__umoddi3+0x99>
+  801dd4:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801dd8:	01 c0                	add    %eax,%eax
+  801dda:	89 c3                	mov    %eax,%ebx
+  801ddc:	89 d6                	mov    %edx,%esi
+  801dde:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801de2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801de6:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801deb:	0f ad d0             	shrd   %cl,%edx,%eax
+  801dee:	d3 ea                	shr    %cl,%edx
+  801df0:	f6 c1 20             	test   $0x20,%cl
+  801df3:	74 04                	je     801df9 <__umoddi3+0x75>
+  801df5:	89 d0                	mov    %edx,%eax
+  801df7:	31 d2                	xor    %edx,%edx
+  801df9:	83 e0 01             	and    $0x1,%eax
+  801dfc:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801e01:	89 ea                	mov    %ebp,%edx
+  801e03:	09 d8                	or     %ebx,%eax
+  801e05:	09 f2                	or     %esi,%edx
+  801e07:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801e0b:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801e0f:	39 d8                	cmp    %ebx,%eax
+  801e11:	89 d1                	mov    %edx,%ecx
+  801e13:	19 f1                	sbb    %esi,%ecx
+  801e15:	72 af                	jb     801dc6 <__umoddi3+0x42>
+  801e17:	29 d8                	sub    %ebx,%eax
+  801e19:	19 f2                	sbb    %esi,%edx
+  801e1b:	eb a9                	jmp    801dc6 <__umoddi3+0x42>
+  801e1d:	83 c4 1c             	add    $0x1c,%esp
+  801e20:	5b                   	pop    %ebx
+  801e21:	5e                   	pop    %esi
+  801e22:	5f                   	pop    %edi
+  801e23:	5d                   	pop    %ebp
+  801e24:	c3                   	ret
+
+00801e25 <__divdi3>:
+  801e25:	53                   	push   %ebx
+  801e26:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801e2a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801e2e:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801e32:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801e36:	85 d2                	test   %edx,%edx
+  801e38:	78 12                	js     801e4c <__divdi3+0x27>
+  801e3a:	85 db                	test   %ebx,%ebx
+  801e3c:	78 2e                	js     801e6c <__divdi3+0x47>
+  801e3e:	53                   	push   %ebx
+  801e3f:	51                   	push   %ecx
+  801e40:	52                   	push   %edx
+  801e41:	50                   	push   %eax
+  801e42:	e8 65 fe ff ff       	call   801cac <__udivdi3>
+  801e47:	83 c4 10             	add    $0x10,%esp
+  801e4a:	eb 1e                	jmp    801e6a <__divdi3+0x45>
+  801e4c:	f7 d8                	neg    %eax
+  801e4e:	83 d2 00             	adc    $0x0,%edx
+  801e51:	f7 da                	neg    %edx
+  801e53:	85 db                	test   %ebx,%ebx
+  801e55:	78 2a                	js     801e81 <__divdi3+0x5c>
+  801e57:	53                   	push   %ebx
+  801e58:	51                   	push   %ecx
+  801e59:	52                   	push   %edx
+  801e5a:	50                   	push   %eax
+  801e5b:	e8 4c fe ff ff       	call   801cac <__udivdi3>
+  801e60:	83 c4 10             	add    $0x10,%esp
+  801e63:	f7 d8                	neg    %eax
+  801e65:	83 d2 00             	adc    $0x0,%edx
+  801e68:	f7 da                	neg    %edx
+  801e6a:	5b                   	pop    %ebx
+  801e6b:	c3                   	ret
+  801e6c:	f7 d9                	neg    %ecx
+  801e6e:	83 d3 00             	adc    $0x0,%ebx
+  801e71:	f7 db                	neg    %ebx
+  801e73:	53                   	push   %ebx
+  801e74:	51                   	push   %ecx
+  801e75:	52                   	push   %edx
+  801e76:	50                   	push   %eax
+  801e77:	e8 30 fe ff ff       	call   801cac <__udivdi3>
+  801e7c:	83 c4 10             	add    $0x10,%esp
+  801e7f:	eb e2                	jmp    801e63 <__divdi3+0x3e>
+  801e81:	f7 d9                	neg    %ecx
+  801e83:	83 d3 00             	adc    $0x0,%ebx
+  801e86:	f7 db                	neg    %ebx
+  801e88:	53                   	push   %ebx
+  801e89:	51                   	push   %ecx
+  801e8a:	52                   	push   %edx
+  801e8b:	50                   	push   %eax
+  801e8c:	e8 1b fe ff ff       	call   801cac <__udivdi3>
+  801e91:	83 c4 10             	add    $0x10,%esp
+  801e94:	eb d4                	jmp    801e6a <__divdi3+0x45>
+
+00801e96 <__moddi3>:
+  801e96:	55                   	push   %ebp
+  801e97:	57                   	push   %edi
+  801e98:	56                   	push   %esi
+  801e99:	53                   	push   %ebx
+  801e9a:	83 ec 14             	sub    $0x14,%esp
+  801e9d:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801ea1:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801ea5:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801ea9:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801ead:	85 ed                	test   %ebp,%ebp
+  801eaf:	78 2b                	js     801edc <__moddi3+0x46>
+  801eb1:	89 c6                	mov    %eax,%esi
+  801eb3:	f7 de                	neg    %esi
+  801eb5:	89 34 24             	mov    %esi,(%esp)
+  801eb8:	89 d6                	mov    %edx,%esi
+  801eba:	83 d6 00             	adc    $0x0,%esi
+  801ebd:	f7 de                	neg    %esi
+  801ebf:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801ec3:	8b 34 24             	mov    (%esp),%esi
+  801ec6:	0f 48 f0             	cmovs  %eax,%esi
+  801ec9:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801ece:	52                   	push   %edx
+  801ecf:	56                   	push   %esi
+  801ed0:	55                   	push   %ebp
+  801ed1:	57                   	push   %edi
+  801ed2:	e8 ad fe ff ff       	call   801d84 <__umoddi3>
+  801ed7:	83 c4 10             	add    $0x10,%esp
+  801eda:	eb 3c                	jmp    801f18 <__moddi3+0x82>
+  801edc:	89 c3                	mov    %eax,%ebx
+  801ede:	f7 db                	neg    %ebx
+  801ee0:	89 d1                	mov    %edx,%ecx
+  801ee2:	83 d1 00             	adc    $0x0,%ecx
+  801ee5:	f7 d9                	neg    %ecx
+  801ee7:	0f 49 c3             	cmovns %ebx,%eax
+  801eea:	89 04 24             	mov    %eax,(%esp)
+  801eed:	0f 49 d1             	cmovns %ecx,%edx
+  801ef0:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801ef4:	ff 74 24 04          	push   0x4(%esp)
+  801ef8:	ff 74 24 04          	push   0x4(%esp)
+  801efc:	89 f8                	mov    %edi,%eax
+  801efe:	89 ea                	mov    %ebp,%edx
+  801f00:	f7 d8                	neg    %eax
+  801f02:	83 d2 00             	adc    $0x0,%edx
+  801f05:	f7 da                	neg    %edx
+  801f07:	52                   	push   %edx
+  801f08:	50                   	push   %eax
+  801f09:	e8 76 fe ff ff       	call   801d84 <__umoddi3>
+  801f0e:	83 c4 10             	add    $0x10,%esp
+  801f11:	f7 d8                	neg    %eax
+  801f13:	83 d2 00             	adc    $0x0,%edx
+  801f16:	f7 da                	neg    %edx
+  801f18:	83 c4 14             	add    $0x14,%esp
+  801f1b:	5b                   	pop    %ebx
+  801f1c:	5e                   	pop    %esi
+  801f1d:	5f                   	pop    %edi
+  801f1e:	5d                   	pop    %ebp
+  801f1f:	c3                   	ret
@@ -0,0 +1,3089 @@
+
+obj/user/pingpongs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 d2 00 00 00       	call   800103 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+  80003c:	e8 c0 18 00 00       	call   801901 <sfork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 74                	jne    8000bc <umain+0x89>
+  800048:	83 ec 04             	sub    $0x4,%esp
+  80004b:	6a 00                	push   $0x0
+  80004d:	6a 00                	push   $0x0
+  80004f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800052:	50                   	push   %eax
+  800053:	e8 c3 18 00 00       	call   80191b <ipc_recv>
+  800058:	8b 1d 24 30 80 00    	mov    0x803024,%ebx
+  80005e:	8b 7b 40             	mov    0x40(%ebx),%edi
+  800061:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800064:	a1 20 30 80 00       	mov    0x803020,%eax
+  800069:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80006c:	e8 47 0d 00 00       	call   800db8 <sys_getenvid>
+  800071:	83 c4 08             	add    $0x8,%esp
+  800074:	57                   	push   %edi
+  800075:	53                   	push   %ebx
+  800076:	56                   	push   %esi
+  800077:	ff 75 d4             	push   -0x2c(%ebp)
+  80007a:	50                   	push   %eax
+  80007b:	68 b0 1f 80 00       	push   $0x801fb0
+  800080:	e8 76 01 00 00       	call   8001fb <cprintf>
+  800085:	a1 20 30 80 00       	mov    0x803020,%eax
+  80008a:	83 c4 20             	add    $0x20,%esp
+  80008d:	83 f8 0a             	cmp    $0xa,%eax
+  800090:	74 22                	je     8000b4 <umain+0x81>
+  800092:	83 c0 01             	add    $0x1,%eax
+  800095:	a3 20 30 80 00       	mov    %eax,0x803020
+  80009a:	6a 00                	push   $0x0
+  80009c:	6a 00                	push   $0x0
+  80009e:	6a 00                	push   $0x0
+  8000a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8000a3:	e8 fd 18 00 00       	call   8019a5 <ipc_send>
+  8000a8:	83 c4 10             	add    $0x10,%esp
+  8000ab:	83 3d 20 30 80 00 0a 	cmpl   $0xa,0x803020
+  8000b2:	75 94                	jne    800048 <umain+0x15>
+  8000b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000b7:	5b                   	pop    %ebx
+  8000b8:	5e                   	pop    %esi
+  8000b9:	5f                   	pop    %edi
+  8000ba:	5d                   	pop    %ebp
+  8000bb:	c3                   	ret
+  8000bc:	8b 1d 24 30 80 00    	mov    0x803024,%ebx
+  8000c2:	e8 f1 0c 00 00       	call   800db8 <sys_getenvid>
+  8000c7:	83 ec 04             	sub    $0x4,%esp
+  8000ca:	53                   	push   %ebx
+  8000cb:	50                   	push   %eax
+  8000cc:	68 80 1f 80 00       	push   $0x801f80
+  8000d1:	e8 25 01 00 00       	call   8001fb <cprintf>
+  8000d6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8000d9:	e8 da 0c 00 00       	call   800db8 <sys_getenvid>
+  8000de:	83 c4 0c             	add    $0xc,%esp
+  8000e1:	53                   	push   %ebx
+  8000e2:	50                   	push   %eax
+  8000e3:	68 9a 1f 80 00       	push   $0x801f9a
+  8000e8:	e8 0e 01 00 00       	call   8001fb <cprintf>
+  8000ed:	6a 00                	push   $0x0
+  8000ef:	6a 00                	push   $0x0
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000f6:	e8 aa 18 00 00       	call   8019a5 <ipc_send>
+  8000fb:	83 c4 20             	add    $0x20,%esp
+  8000fe:	e9 45 ff ff ff       	jmp    800048 <umain+0x15>
+
+00800103 <libmain>:
+  800103:	55                   	push   %ebp
+  800104:	89 e5                	mov    %esp,%ebp
+  800106:	56                   	push   %esi
+  800107:	53                   	push   %ebx
+  800108:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80010b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80010e:	e8 6c 19 00 00       	call   801a7f <uinfo_envid>
+  800113:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  800118:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  80011e:	05 00 00 00 ed       	add    $0xed000000,%eax
+  800123:	a3 24 30 80 00       	mov    %eax,0x803024
+  800128:	85 db                	test   %ebx,%ebx
+  80012a:	7e 07                	jle    800133 <libmain+0x30>
+  80012c:	8b 06                	mov    (%esi),%eax
+  80012e:	a3 00 30 80 00       	mov    %eax,0x803000
+  800133:	83 ec 08             	sub    $0x8,%esp
+  800136:	56                   	push   %esi
+  800137:	53                   	push   %ebx
+  800138:	e8 f6 fe ff ff       	call   800033 <umain>
+  80013d:	e8 0a 00 00 00       	call   80014c <exit>
+  800142:	83 c4 10             	add    $0x10,%esp
+  800145:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800148:	5b                   	pop    %ebx
+  800149:	5e                   	pop    %esi
+  80014a:	5d                   	pop    %ebp
+  80014b:	c3                   	ret
+
+0080014c <exit>:
+  80014c:	55                   	push   %ebp
+  80014d:	89 e5                	mov    %esp,%ebp
+  80014f:	83 ec 08             	sub    $0x8,%esp
+  800152:	e8 c1 19 00 00       	call   801b18 <bflush>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	6a 00                	push   $0x0
+  80015c:	e8 cc 0b 00 00       	call   800d2d <sys_env_destroy>
+  800161:	83 c4 10             	add    $0x10,%esp
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+
+00800166 <putch>:
+  800166:	55                   	push   %ebp
+  800167:	89 e5                	mov    %esp,%ebp
+  800169:	53                   	push   %ebx
+  80016a:	83 ec 04             	sub    $0x4,%esp
+  80016d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800170:	8b 13                	mov    (%ebx),%edx
+  800172:	8d 42 01             	lea    0x1(%edx),%eax
+  800175:	89 03                	mov    %eax,(%ebx)
+  800177:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80017a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80017e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800183:	74 09                	je     80018e <putch+0x28>
+  800185:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800189:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80018c:	c9                   	leave
+  80018d:	c3                   	ret
+  80018e:	83 ec 08             	sub    $0x8,%esp
+  800191:	68 ff 00 00 00       	push   $0xff
+  800196:	8d 43 08             	lea    0x8(%ebx),%eax
+  800199:	50                   	push   %eax
+  80019a:	e8 c0 0a 00 00       	call   800c5f <sys_cputs>
+  80019f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001a5:	83 c4 10             	add    $0x10,%esp
+  8001a8:	eb db                	jmp    800185 <putch+0x1f>
+
+008001aa <vcprintf>:
+  8001aa:	55                   	push   %ebp
+  8001ab:	89 e5                	mov    %esp,%ebp
+  8001ad:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8001b3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001ba:	00 00 00 
+  8001bd:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001c4:	00 00 00 
+  8001c7:	ff 75 0c             	push   0xc(%ebp)
+  8001ca:	ff 75 08             	push   0x8(%ebp)
+  8001cd:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001d3:	50                   	push   %eax
+  8001d4:	68 66 01 80 00       	push   $0x800166
+  8001d9:	e8 14 01 00 00       	call   8002f2 <vprintfmt>
+  8001de:	83 c4 08             	add    $0x8,%esp
+  8001e1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001e7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ed:	50                   	push   %eax
+  8001ee:	e8 6c 0a 00 00       	call   800c5f <sys_cputs>
+  8001f3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f9:	c9                   	leave
+  8001fa:	c3                   	ret
+
+008001fb <cprintf>:
+  8001fb:	55                   	push   %ebp
+  8001fc:	89 e5                	mov    %esp,%ebp
+  8001fe:	83 ec 10             	sub    $0x10,%esp
+  800201:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800204:	50                   	push   %eax
+  800205:	ff 75 08             	push   0x8(%ebp)
+  800208:	e8 9d ff ff ff       	call   8001aa <vcprintf>
+  80020d:	c9                   	leave
+  80020e:	c3                   	ret
+
+0080020f <printnum>:
+  80020f:	55                   	push   %ebp
+  800210:	89 e5                	mov    %esp,%ebp
+  800212:	57                   	push   %edi
+  800213:	56                   	push   %esi
+  800214:	53                   	push   %ebx
+  800215:	83 ec 1c             	sub    $0x1c,%esp
+  800218:	89 c7                	mov    %eax,%edi
+  80021a:	89 d6                	mov    %edx,%esi
+  80021c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80021f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800222:	89 d1                	mov    %edx,%ecx
+  800224:	89 c2                	mov    %eax,%edx
+  800226:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800229:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80022c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80022f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800232:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800235:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80023c:	39 c2                	cmp    %eax,%edx
+  80023e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800241:	72 3e                	jb     800281 <printnum+0x72>
+  800243:	83 ec 0c             	sub    $0xc,%esp
+  800246:	ff 75 18             	push   0x18(%ebp)
+  800249:	83 eb 01             	sub    $0x1,%ebx
+  80024c:	53                   	push   %ebx
+  80024d:	50                   	push   %eax
+  80024e:	83 ec 08             	sub    $0x8,%esp
+  800251:	ff 75 e4             	push   -0x1c(%ebp)
+  800254:	ff 75 e0             	push   -0x20(%ebp)
+  800257:	ff 75 dc             	push   -0x24(%ebp)
+  80025a:	ff 75 d8             	push   -0x28(%ebp)
+  80025d:	e8 8d 1a 00 00       	call   801cef <__udivdi3>
+  800262:	83 c4 18             	add    $0x18,%esp
+  800265:	52                   	push   %edx
+  800266:	50                   	push   %eax
+  800267:	89 f2                	mov    %esi,%edx
+  800269:	89 f8                	mov    %edi,%eax
+  80026b:	e8 9f ff ff ff       	call   80020f <printnum>
+  800270:	83 c4 20             	add    $0x20,%esp
+  800273:	eb 13                	jmp    800288 <printnum+0x79>
+  800275:	83 ec 08             	sub    $0x8,%esp
+  800278:	56                   	push   %esi
+  800279:	ff 75 18             	push   0x18(%ebp)
+  80027c:	ff d7                	call   *%edi
+  80027e:	83 c4 10             	add    $0x10,%esp
+  800281:	83 eb 01             	sub    $0x1,%ebx
+  800284:	85 db                	test   %ebx,%ebx
+  800286:	7f ed                	jg     800275 <printnum+0x66>
+  800288:	83 ec 08             	sub    $0x8,%esp
+  80028b:	56                   	push   %esi
+  80028c:	83 ec 04             	sub    $0x4,%esp
+  80028f:	ff 75 e4             	push   -0x1c(%ebp)
+  800292:	ff 75 e0             	push   -0x20(%ebp)
+  800295:	ff 75 dc             	push   -0x24(%ebp)
+  800298:	ff 75 d8             	push   -0x28(%ebp)
+  80029b:	e8 27 1b 00 00       	call   801dc7 <__umoddi3>
+  8002a0:	83 c4 14             	add    $0x14,%esp
+  8002a3:	0f be 80 e0 1f 80 00 	movsbl 0x801fe0(%eax),%eax
+  8002aa:	50                   	push   %eax
+  8002ab:	ff d7                	call   *%edi
+  8002ad:	83 c4 10             	add    $0x10,%esp
+  8002b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b3:	5b                   	pop    %ebx
+  8002b4:	5e                   	pop    %esi
+  8002b5:	5f                   	pop    %edi
+  8002b6:	5d                   	pop    %ebp
+  8002b7:	c3                   	ret
+
+008002b8 <sprintputch>:
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002be:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8002c2:	8b 10                	mov    (%eax),%edx
+  8002c4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002c7:	73 0a                	jae    8002d3 <sprintputch+0x1b>
+  8002c9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002cc:	89 08                	mov    %ecx,(%eax)
+  8002ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d1:	88 02                	mov    %al,(%edx)
+  8002d3:	5d                   	pop    %ebp
+  8002d4:	c3                   	ret
+
+008002d5 <printfmt>:
+  8002d5:	55                   	push   %ebp
+  8002d6:	89 e5                	mov    %esp,%ebp
+  8002d8:	83 ec 08             	sub    $0x8,%esp
+  8002db:	8d 45 14             	lea    0x14(%ebp),%eax
+  8002de:	50                   	push   %eax
+  8002df:	ff 75 10             	push   0x10(%ebp)
+  8002e2:	ff 75 0c             	push   0xc(%ebp)
+  8002e5:	ff 75 08             	push   0x8(%ebp)
+  8002e8:	e8 05 00 00 00       	call   8002f2 <vprintfmt>
+  8002ed:	83 c4 10             	add    $0x10,%esp
+  8002f0:	c9                   	leave
+  8002f1:	c3                   	ret
+
+008002f2 <vprintfmt>:
+  8002f2:	55                   	push   %ebp
+  8002f3:	89 e5                	mov    %esp,%ebp
+  8002f5:	57                   	push   %edi
+  8002f6:	56                   	push   %esi
+  8002f7:	53                   	push   %ebx
+  8002f8:	83 ec 2c             	sub    $0x2c,%esp
+  8002fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800301:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800304:	eb 0a                	jmp    800310 <vprintfmt+0x1e>
+  800306:	83 ec 08             	sub    $0x8,%esp
+  800309:	53                   	push   %ebx
+  80030a:	50                   	push   %eax
+  80030b:	ff d6                	call   *%esi
+  80030d:	83 c4 10             	add    $0x10,%esp
+  800310:	83 c7 01             	add    $0x1,%edi
+  800313:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800317:	83 f8 25             	cmp    $0x25,%eax
+  80031a:	74 0c                	je     800328 <vprintfmt+0x36>
+  80031c:	85 c0                	test   %eax,%eax
+  80031e:	75 e6                	jne    800306 <vprintfmt+0x14>
+  800320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800323:	5b                   	pop    %ebx
+  800324:	5e                   	pop    %esi
+  800325:	5f                   	pop    %edi
+  800326:	5d                   	pop    %ebp
+  800327:	c3                   	ret
+  800328:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  80032c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800333:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80033a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800341:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800346:	8d 47 01             	lea    0x1(%edi),%eax
+  800349:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80034c:	0f b6 17             	movzbl (%edi),%edx
+  80034f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800352:	3c 55                	cmp    $0x55,%al
+  800354:	0f 87 cf 03 00 00    	ja     800729 <vprintfmt+0x437>
+  80035a:	0f b6 c0             	movzbl %al,%eax
+  80035d:	ff 24 85 a0 20 80 00 	jmp    *0x8020a0(,%eax,4)
+  800364:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800367:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80036b:	eb d9                	jmp    800346 <vprintfmt+0x54>
+  80036d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800370:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800374:	eb d0                	jmp    800346 <vprintfmt+0x54>
+  800376:	0f b6 d2             	movzbl %dl,%edx
+  800379:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80037c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800381:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800384:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800387:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  80038b:	0f be 17             	movsbl (%edi),%edx
+  80038e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800391:	83 f9 09             	cmp    $0x9,%ecx
+  800394:	77 55                	ja     8003eb <vprintfmt+0xf9>
+  800396:	83 c7 01             	add    $0x1,%edi
+  800399:	eb e9                	jmp    800384 <vprintfmt+0x92>
+  80039b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039e:	8b 00                	mov    (%eax),%eax
+  8003a0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8003a9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8003ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003af:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003b3:	79 91                	jns    800346 <vprintfmt+0x54>
+  8003b5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003bb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003c2:	eb 82                	jmp    800346 <vprintfmt+0x54>
+  8003c4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003c7:	85 d2                	test   %edx,%edx
+  8003c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ce:	0f 49 c2             	cmovns %edx,%eax
+  8003d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003d7:	e9 6a ff ff ff       	jmp    800346 <vprintfmt+0x54>
+  8003dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003df:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8003e6:	e9 5b ff ff ff       	jmp    800346 <vprintfmt+0x54>
+  8003eb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ee:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003f1:	eb bc                	jmp    8003af <vprintfmt+0xbd>
+  8003f3:	83 c1 01             	add    $0x1,%ecx
+  8003f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003f9:	e9 48 ff ff ff       	jmp    800346 <vprintfmt+0x54>
+  8003fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800401:	8d 78 04             	lea    0x4(%eax),%edi
+  800404:	83 ec 08             	sub    $0x8,%esp
+  800407:	53                   	push   %ebx
+  800408:	ff 30                	push   (%eax)
+  80040a:	ff d6                	call   *%esi
+  80040c:	83 c4 10             	add    $0x10,%esp
+  80040f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800412:	e9 b1 02 00 00       	jmp    8006c8 <vprintfmt+0x3d6>
+  800417:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041a:	8d 78 04             	lea    0x4(%eax),%edi
+  80041d:	8b 10                	mov    (%eax),%edx
+  80041f:	89 d0                	mov    %edx,%eax
+  800421:	f7 d8                	neg    %eax
+  800423:	0f 48 c2             	cmovs  %edx,%eax
+  800426:	83 f8 08             	cmp    $0x8,%eax
+  800429:	7f 23                	jg     80044e <vprintfmt+0x15c>
+  80042b:	8b 14 85 00 22 80 00 	mov    0x802200(,%eax,4),%edx
+  800432:	85 d2                	test   %edx,%edx
+  800434:	74 18                	je     80044e <vprintfmt+0x15c>
+  800436:	52                   	push   %edx
+  800437:	68 01 20 80 00       	push   $0x802001
+  80043c:	53                   	push   %ebx
+  80043d:	56                   	push   %esi
+  80043e:	e8 92 fe ff ff       	call   8002d5 <printfmt>
+  800443:	83 c4 10             	add    $0x10,%esp
+  800446:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800449:	e9 7a 02 00 00       	jmp    8006c8 <vprintfmt+0x3d6>
+  80044e:	50                   	push   %eax
+  80044f:	68 f8 1f 80 00       	push   $0x801ff8
+  800454:	53                   	push   %ebx
+  800455:	56                   	push   %esi
+  800456:	e8 7a fe ff ff       	call   8002d5 <printfmt>
+  80045b:	83 c4 10             	add    $0x10,%esp
+  80045e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800461:	e9 62 02 00 00       	jmp    8006c8 <vprintfmt+0x3d6>
+  800466:	8b 45 14             	mov    0x14(%ebp),%eax
+  800469:	83 c0 04             	add    $0x4,%eax
+  80046c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80046f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800472:	8b 08                	mov    (%eax),%ecx
+  800474:	85 c9                	test   %ecx,%ecx
+  800476:	b8 f1 1f 80 00       	mov    $0x801ff1,%eax
+  80047b:	0f 45 c1             	cmovne %ecx,%eax
+  80047e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800481:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800485:	7e 06                	jle    80048d <vprintfmt+0x19b>
+  800487:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80048b:	75 0b                	jne    800498 <vprintfmt+0x1a6>
+  80048d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800490:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800493:	89 75 08             	mov    %esi,0x8(%ebp)
+  800496:	eb 5c                	jmp    8004f4 <vprintfmt+0x202>
+  800498:	83 ec 08             	sub    $0x8,%esp
+  80049b:	ff 75 d0             	push   -0x30(%ebp)
+  80049e:	ff 75 cc             	push   -0x34(%ebp)
+  8004a1:	e8 87 03 00 00       	call   80082d <strnlen>
+  8004a6:	89 c2                	mov    %eax,%edx
+  8004a8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ab:	29 d0                	sub    %edx,%eax
+  8004ad:	83 c4 10             	add    $0x10,%esp
+  8004b0:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004b4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004b7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ba:	89 c6                	mov    %eax,%esi
+  8004bc:	eb 0e                	jmp    8004cc <vprintfmt+0x1da>
+  8004be:	83 ec 08             	sub    $0x8,%esp
+  8004c1:	53                   	push   %ebx
+  8004c2:	57                   	push   %edi
+  8004c3:	ff 55 08             	call   *0x8(%ebp)
+  8004c6:	83 ee 01             	sub    $0x1,%esi
+  8004c9:	83 c4 10             	add    $0x10,%esp
+  8004cc:	85 f6                	test   %esi,%esi
+  8004ce:	7f ee                	jg     8004be <vprintfmt+0x1cc>
+  8004d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d6:	85 c0                	test   %eax,%eax
+  8004d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004dd:	0f 49 d0             	cmovns %eax,%edx
+  8004e0:	29 d0                	sub    %edx,%eax
+  8004e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e5:	eb a6                	jmp    80048d <vprintfmt+0x19b>
+  8004e7:	83 ec 08             	sub    $0x8,%esp
+  8004ea:	53                   	push   %ebx
+  8004eb:	52                   	push   %edx
+  8004ec:	ff 55 08             	call   *0x8(%ebp)
+  8004ef:	83 c4 10             	add    $0x10,%esp
+  8004f2:	89 f1                	mov    %esi,%ecx
+  8004f4:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004f7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004fb:	0f be d0             	movsbl %al,%edx
+  8004fe:	85 d2                	test   %edx,%edx
+  800500:	74 28                	je     80052a <vprintfmt+0x238>
+  800502:	85 ff                	test   %edi,%edi
+  800504:	78 05                	js     80050b <vprintfmt+0x219>
+  800506:	83 ef 01             	sub    $0x1,%edi
+  800509:	78 30                	js     80053b <vprintfmt+0x249>
+  80050b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80050f:	74 d6                	je     8004e7 <vprintfmt+0x1f5>
+  800511:	0f be c0             	movsbl %al,%eax
+  800514:	83 e8 20             	sub    $0x20,%eax
+  800517:	83 f8 5e             	cmp    $0x5e,%eax
+  80051a:	76 cb                	jbe    8004e7 <vprintfmt+0x1f5>
+  80051c:	83 ec 08             	sub    $0x8,%esp
+  80051f:	53                   	push   %ebx
+  800520:	6a 3f                	push   $0x3f
+  800522:	ff 55 08             	call   *0x8(%ebp)
+  800525:	83 c4 10             	add    $0x10,%esp
+  800528:	eb c8                	jmp    8004f2 <vprintfmt+0x200>
+  80052a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80052d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800530:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800533:	01 d0                	add    %edx,%eax
+  800535:	29 c8                	sub    %ecx,%eax
+  800537:	89 c7                	mov    %eax,%edi
+  800539:	eb 13                	jmp    80054e <vprintfmt+0x25c>
+  80053b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053e:	eb ed                	jmp    80052d <vprintfmt+0x23b>
+  800540:	83 ec 08             	sub    $0x8,%esp
+  800543:	53                   	push   %ebx
+  800544:	6a 20                	push   $0x20
+  800546:	ff d6                	call   *%esi
+  800548:	83 ef 01             	sub    $0x1,%edi
+  80054b:	83 c4 10             	add    $0x10,%esp
+  80054e:	85 ff                	test   %edi,%edi
+  800550:	7f ee                	jg     800540 <vprintfmt+0x24e>
+  800552:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800555:	89 45 14             	mov    %eax,0x14(%ebp)
+  800558:	e9 6b 01 00 00       	jmp    8006c8 <vprintfmt+0x3d6>
+  80055d:	83 f9 01             	cmp    $0x1,%ecx
+  800560:	7f 1f                	jg     800581 <vprintfmt+0x28f>
+  800562:	85 c9                	test   %ecx,%ecx
+  800564:	74 67                	je     8005cd <vprintfmt+0x2db>
+  800566:	8b 45 14             	mov    0x14(%ebp),%eax
+  800569:	8b 00                	mov    (%eax),%eax
+  80056b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056e:	89 c1                	mov    %eax,%ecx
+  800570:	c1 f9 1f             	sar    $0x1f,%ecx
+  800573:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800576:	8b 45 14             	mov    0x14(%ebp),%eax
+  800579:	8d 40 04             	lea    0x4(%eax),%eax
+  80057c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057f:	eb 17                	jmp    800598 <vprintfmt+0x2a6>
+  800581:	8b 45 14             	mov    0x14(%ebp),%eax
+  800584:	8b 50 04             	mov    0x4(%eax),%edx
+  800587:	8b 00                	mov    (%eax),%eax
+  800589:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80058c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8d 40 08             	lea    0x8(%eax),%eax
+  800595:	89 45 14             	mov    %eax,0x14(%ebp)
+  800598:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80059b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80059e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005a3:	85 c9                	test   %ecx,%ecx
+  8005a5:	0f 89 03 01 00 00    	jns    8006ae <vprintfmt+0x3bc>
+  8005ab:	83 ec 08             	sub    $0x8,%esp
+  8005ae:	53                   	push   %ebx
+  8005af:	6a 2d                	push   $0x2d
+  8005b1:	ff d6                	call   *%esi
+  8005b3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005b9:	f7 da                	neg    %edx
+  8005bb:	83 d1 00             	adc    $0x0,%ecx
+  8005be:	f7 d9                	neg    %ecx
+  8005c0:	83 c4 10             	add    $0x10,%esp
+  8005c3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005c8:	e9 e1 00 00 00       	jmp    8006ae <vprintfmt+0x3bc>
+  8005cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d0:	8b 00                	mov    (%eax),%eax
+  8005d2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005d5:	89 c1                	mov    %eax,%ecx
+  8005d7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005da:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e6:	eb b0                	jmp    800598 <vprintfmt+0x2a6>
+  8005e8:	83 f9 01             	cmp    $0x1,%ecx
+  8005eb:	7f 1e                	jg     80060b <vprintfmt+0x319>
+  8005ed:	85 c9                	test   %ecx,%ecx
+  8005ef:	74 32                	je     800623 <vprintfmt+0x331>
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8b 10                	mov    (%eax),%edx
+  8005f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800601:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800606:	e9 a3 00 00 00       	jmp    8006ae <vprintfmt+0x3bc>
+  80060b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060e:	8b 10                	mov    (%eax),%edx
+  800610:	8b 48 04             	mov    0x4(%eax),%ecx
+  800613:	8d 40 08             	lea    0x8(%eax),%eax
+  800616:	89 45 14             	mov    %eax,0x14(%ebp)
+  800619:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80061e:	e9 8b 00 00 00       	jmp    8006ae <vprintfmt+0x3bc>
+  800623:	8b 45 14             	mov    0x14(%ebp),%eax
+  800626:	8b 10                	mov    (%eax),%edx
+  800628:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062d:	8d 40 04             	lea    0x4(%eax),%eax
+  800630:	89 45 14             	mov    %eax,0x14(%ebp)
+  800633:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800638:	eb 74                	jmp    8006ae <vprintfmt+0x3bc>
+  80063a:	83 f9 01             	cmp    $0x1,%ecx
+  80063d:	7f 1b                	jg     80065a <vprintfmt+0x368>
+  80063f:	85 c9                	test   %ecx,%ecx
+  800641:	74 2c                	je     80066f <vprintfmt+0x37d>
+  800643:	8b 45 14             	mov    0x14(%ebp),%eax
+  800646:	8b 10                	mov    (%eax),%edx
+  800648:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064d:	8d 40 04             	lea    0x4(%eax),%eax
+  800650:	89 45 14             	mov    %eax,0x14(%ebp)
+  800653:	bf 08 00 00 00       	mov    $0x8,%edi
+  800658:	eb 54                	jmp    8006ae <vprintfmt+0x3bc>
+  80065a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065d:	8b 10                	mov    (%eax),%edx
+  80065f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800662:	8d 40 08             	lea    0x8(%eax),%eax
+  800665:	89 45 14             	mov    %eax,0x14(%ebp)
+  800668:	bf 08 00 00 00       	mov    $0x8,%edi
+  80066d:	eb 3f                	jmp    8006ae <vprintfmt+0x3bc>
+  80066f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800672:	8b 10                	mov    (%eax),%edx
+  800674:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800679:	8d 40 04             	lea    0x4(%eax),%eax
+  80067c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80067f:	bf 08 00 00 00       	mov    $0x8,%edi
+  800684:	eb 28                	jmp    8006ae <vprintfmt+0x3bc>
+  800686:	83 ec 08             	sub    $0x8,%esp
+  800689:	53                   	push   %ebx
+  80068a:	6a 30                	push   $0x30
+  80068c:	ff d6                	call   *%esi
+  80068e:	83 c4 08             	add    $0x8,%esp
+  800691:	53                   	push   %ebx
+  800692:	6a 78                	push   $0x78
+  800694:	ff d6                	call   *%esi
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8b 10                	mov    (%eax),%edx
+  80069b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a0:	83 c4 10             	add    $0x10,%esp
+  8006a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a9:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006ae:	83 ec 0c             	sub    $0xc,%esp
+  8006b1:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006b5:	50                   	push   %eax
+  8006b6:	ff 75 e0             	push   -0x20(%ebp)
+  8006b9:	57                   	push   %edi
+  8006ba:	51                   	push   %ecx
+  8006bb:	52                   	push   %edx
+  8006bc:	89 da                	mov    %ebx,%edx
+  8006be:	89 f0                	mov    %esi,%eax
+  8006c0:	e8 4a fb ff ff       	call   80020f <printnum>
+  8006c5:	83 c4 20             	add    $0x20,%esp
+  8006c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8006cb:	e9 40 fc ff ff       	jmp    800310 <vprintfmt+0x1e>
+  8006d0:	83 f9 01             	cmp    $0x1,%ecx
+  8006d3:	7f 1b                	jg     8006f0 <vprintfmt+0x3fe>
+  8006d5:	85 c9                	test   %ecx,%ecx
+  8006d7:	74 2c                	je     800705 <vprintfmt+0x413>
+  8006d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dc:	8b 10                	mov    (%eax),%edx
+  8006de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e9:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006ee:	eb be                	jmp    8006ae <vprintfmt+0x3bc>
+  8006f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f3:	8b 10                	mov    (%eax),%edx
+  8006f5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f8:	8d 40 08             	lea    0x8(%eax),%eax
+  8006fb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006fe:	bf 10 00 00 00       	mov    $0x10,%edi
+  800703:	eb a9                	jmp    8006ae <vprintfmt+0x3bc>
+  800705:	8b 45 14             	mov    0x14(%ebp),%eax
+  800708:	8b 10                	mov    (%eax),%edx
+  80070a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070f:	8d 40 04             	lea    0x4(%eax),%eax
+  800712:	89 45 14             	mov    %eax,0x14(%ebp)
+  800715:	bf 10 00 00 00       	mov    $0x10,%edi
+  80071a:	eb 92                	jmp    8006ae <vprintfmt+0x3bc>
+  80071c:	83 ec 08             	sub    $0x8,%esp
+  80071f:	53                   	push   %ebx
+  800720:	6a 25                	push   $0x25
+  800722:	ff d6                	call   *%esi
+  800724:	83 c4 10             	add    $0x10,%esp
+  800727:	eb 9f                	jmp    8006c8 <vprintfmt+0x3d6>
+  800729:	83 ec 08             	sub    $0x8,%esp
+  80072c:	53                   	push   %ebx
+  80072d:	6a 25                	push   $0x25
+  80072f:	ff d6                	call   *%esi
+  800731:	83 c4 10             	add    $0x10,%esp
+  800734:	89 f8                	mov    %edi,%eax
+  800736:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80073a:	74 05                	je     800741 <vprintfmt+0x44f>
+  80073c:	83 e8 01             	sub    $0x1,%eax
+  80073f:	eb f5                	jmp    800736 <vprintfmt+0x444>
+  800741:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800744:	eb 82                	jmp    8006c8 <vprintfmt+0x3d6>
+
+00800746 <vsnprintf>:
+  800746:	55                   	push   %ebp
+  800747:	89 e5                	mov    %esp,%ebp
+  800749:	83 ec 18             	sub    $0x18,%esp
+  80074c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80074f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800752:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800755:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800759:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80075c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800763:	85 c0                	test   %eax,%eax
+  800765:	74 26                	je     80078d <vsnprintf+0x47>
+  800767:	85 d2                	test   %edx,%edx
+  800769:	7e 22                	jle    80078d <vsnprintf+0x47>
+  80076b:	ff 75 14             	push   0x14(%ebp)
+  80076e:	ff 75 10             	push   0x10(%ebp)
+  800771:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800774:	50                   	push   %eax
+  800775:	68 b8 02 80 00       	push   $0x8002b8
+  80077a:	e8 73 fb ff ff       	call   8002f2 <vprintfmt>
+  80077f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800782:	c6 00 00             	movb   $0x0,(%eax)
+  800785:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800788:	83 c4 10             	add    $0x10,%esp
+  80078b:	c9                   	leave
+  80078c:	c3                   	ret
+  80078d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800792:	eb f7                	jmp    80078b <vsnprintf+0x45>
+
+00800794 <snprintf>:
+  800794:	55                   	push   %ebp
+  800795:	89 e5                	mov    %esp,%ebp
+  800797:	83 ec 08             	sub    $0x8,%esp
+  80079a:	8d 45 14             	lea    0x14(%ebp),%eax
+  80079d:	50                   	push   %eax
+  80079e:	ff 75 10             	push   0x10(%ebp)
+  8007a1:	ff 75 0c             	push   0xc(%ebp)
+  8007a4:	ff 75 08             	push   0x8(%ebp)
+  8007a7:	e8 9a ff ff ff       	call   800746 <vsnprintf>
+  8007ac:	c9                   	leave
+  8007ad:	c3                   	ret
+
+008007ae <copy_fwd>:
+  8007ae:	55                   	push   %ebp
+  8007af:	89 e5                	mov    %esp,%ebp
+  8007b1:	57                   	push   %edi
+  8007b2:	56                   	push   %esi
+  8007b3:	53                   	push   %ebx
+  8007b4:	89 c7                	mov    %eax,%edi
+  8007b6:	89 d6                	mov    %edx,%esi
+  8007b8:	89 c8                	mov    %ecx,%eax
+  8007ba:	83 f9 0f             	cmp    $0xf,%ecx
+  8007bd:	76 1c                	jbe    8007db <copy_fwd+0x2d>
+  8007bf:	89 f9                	mov    %edi,%ecx
+  8007c1:	f7 d9                	neg    %ecx
+  8007c3:	89 cb                	mov    %ecx,%ebx
+  8007c5:	83 e3 03             	and    $0x3,%ebx
+  8007c8:	29 d8                	sub    %ebx,%eax
+  8007ca:	89 c2                	mov    %eax,%edx
+  8007cc:	c1 ea 02             	shr    $0x2,%edx
+  8007cf:	83 e0 03             	and    $0x3,%eax
+  8007d2:	89 d9                	mov    %ebx,%ecx
+  8007d4:	fc                   	cld
+  8007d5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8007d7:	89 d1                	mov    %edx,%ecx
+  8007d9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8007db:	89 c1                	mov    %eax,%ecx
+  8007dd:	fc                   	cld
+  8007de:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8007e0:	5b                   	pop    %ebx
+  8007e1:	5e                   	pop    %esi
+  8007e2:	5f                   	pop    %edi
+  8007e3:	5d                   	pop    %ebp
+  8007e4:	c3                   	ret
+
+008007e5 <have_sse2>:
+  8007e5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007ec:	78 06                	js     8007f4 <have_sse2+0xf>
+  8007ee:	a1 04 30 80 00       	mov    0x803004,%eax
+  8007f3:	c3                   	ret
+  8007f4:	55                   	push   %ebp
+  8007f5:	89 e5                	mov    %esp,%ebp
+  8007f7:	53                   	push   %ebx
+  8007f8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007fd:	0f a2                	cpuid
+  8007ff:	c1 ea 1a             	shr    $0x1a,%edx
+  800802:	83 e2 01             	and    $0x1,%edx
+  800805:	89 15 04 30 80 00    	mov    %edx,0x803004
+  80080b:	a1 04 30 80 00       	mov    0x803004,%eax
+  800810:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800813:	c9                   	leave
+  800814:	c3                   	ret
+
+00800815 <strlen>:
+  800815:	55                   	push   %ebp
+  800816:	89 e5                	mov    %esp,%ebp
+  800818:	8b 55 08             	mov    0x8(%ebp),%edx
+  80081b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800820:	eb 03                	jmp    800825 <strlen+0x10>
+  800822:	83 c0 01             	add    $0x1,%eax
+  800825:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800829:	75 f7                	jne    800822 <strlen+0xd>
+  80082b:	5d                   	pop    %ebp
+  80082c:	c3                   	ret
+
+0080082d <strnlen>:
+  80082d:	55                   	push   %ebp
+  80082e:	89 e5                	mov    %esp,%ebp
+  800830:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800833:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083b:	eb 03                	jmp    800840 <strnlen+0x13>
+  80083d:	83 c0 01             	add    $0x1,%eax
+  800840:	39 d0                	cmp    %edx,%eax
+  800842:	74 08                	je     80084c <strnlen+0x1f>
+  800844:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800848:	75 f3                	jne    80083d <strnlen+0x10>
+  80084a:	89 c2                	mov    %eax,%edx
+  80084c:	89 d0                	mov    %edx,%eax
+  80084e:	5d                   	pop    %ebp
+  80084f:	c3                   	ret
+
+00800850 <strcpy>:
+  800850:	55                   	push   %ebp
+  800851:	89 e5                	mov    %esp,%ebp
+  800853:	53                   	push   %ebx
+  800854:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800857:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80085a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800863:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800866:	83 c0 01             	add    $0x1,%eax
+  800869:	84 d2                	test   %dl,%dl
+  80086b:	75 f2                	jne    80085f <strcpy+0xf>
+  80086d:	89 c8                	mov    %ecx,%eax
+  80086f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800872:	c9                   	leave
+  800873:	c3                   	ret
+
+00800874 <strcat>:
+  800874:	55                   	push   %ebp
+  800875:	89 e5                	mov    %esp,%ebp
+  800877:	53                   	push   %ebx
+  800878:	83 ec 10             	sub    $0x10,%esp
+  80087b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80087e:	53                   	push   %ebx
+  80087f:	e8 91 ff ff ff       	call   800815 <strlen>
+  800884:	83 c4 08             	add    $0x8,%esp
+  800887:	ff 75 0c             	push   0xc(%ebp)
+  80088a:	01 d8                	add    %ebx,%eax
+  80088c:	50                   	push   %eax
+  80088d:	e8 be ff ff ff       	call   800850 <strcpy>
+  800892:	89 d8                	mov    %ebx,%eax
+  800894:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800897:	c9                   	leave
+  800898:	c3                   	ret
+
+00800899 <strncpy>:
+  800899:	55                   	push   %ebp
+  80089a:	89 e5                	mov    %esp,%ebp
+  80089c:	56                   	push   %esi
+  80089d:	53                   	push   %ebx
+  80089e:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a4:	89 f3                	mov    %esi,%ebx
+  8008a6:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008a9:	89 f0                	mov    %esi,%eax
+  8008ab:	eb 0f                	jmp    8008bc <strncpy+0x23>
+  8008ad:	83 c0 01             	add    $0x1,%eax
+  8008b0:	0f b6 0a             	movzbl (%edx),%ecx
+  8008b3:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8008b6:	80 f9 01             	cmp    $0x1,%cl
+  8008b9:	83 da ff             	sbb    $0xffffffff,%edx
+  8008bc:	39 d8                	cmp    %ebx,%eax
+  8008be:	75 ed                	jne    8008ad <strncpy+0x14>
+  8008c0:	89 f0                	mov    %esi,%eax
+  8008c2:	5b                   	pop    %ebx
+  8008c3:	5e                   	pop    %esi
+  8008c4:	5d                   	pop    %ebp
+  8008c5:	c3                   	ret
+
+008008c6 <strlcpy>:
+  8008c6:	55                   	push   %ebp
+  8008c7:	89 e5                	mov    %esp,%ebp
+  8008c9:	56                   	push   %esi
+  8008ca:	53                   	push   %ebx
+  8008cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8008d4:	89 f0                	mov    %esi,%eax
+  8008d6:	85 d2                	test   %edx,%edx
+  8008d8:	74 21                	je     8008fb <strlcpy+0x35>
+  8008da:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008de:	89 f2                	mov    %esi,%edx
+  8008e0:	eb 09                	jmp    8008eb <strlcpy+0x25>
+  8008e2:	83 c1 01             	add    $0x1,%ecx
+  8008e5:	83 c2 01             	add    $0x1,%edx
+  8008e8:	88 5a ff             	mov    %bl,-0x1(%edx)
+  8008eb:	39 c2                	cmp    %eax,%edx
+  8008ed:	74 09                	je     8008f8 <strlcpy+0x32>
+  8008ef:	0f b6 19             	movzbl (%ecx),%ebx
+  8008f2:	84 db                	test   %bl,%bl
+  8008f4:	75 ec                	jne    8008e2 <strlcpy+0x1c>
+  8008f6:	89 d0                	mov    %edx,%eax
+  8008f8:	c6 00 00             	movb   $0x0,(%eax)
+  8008fb:	29 f0                	sub    %esi,%eax
+  8008fd:	5b                   	pop    %ebx
+  8008fe:	5e                   	pop    %esi
+  8008ff:	5d                   	pop    %ebp
+  800900:	c3                   	ret
+
+00800901 <strcmp>:
+  800901:	55                   	push   %ebp
+  800902:	89 e5                	mov    %esp,%ebp
+  800904:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800907:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80090a:	eb 06                	jmp    800912 <strcmp+0x11>
+  80090c:	83 c1 01             	add    $0x1,%ecx
+  80090f:	83 c2 01             	add    $0x1,%edx
+  800912:	0f b6 01             	movzbl (%ecx),%eax
+  800915:	84 c0                	test   %al,%al
+  800917:	74 04                	je     80091d <strcmp+0x1c>
+  800919:	3a 02                	cmp    (%edx),%al
+  80091b:	74 ef                	je     80090c <strcmp+0xb>
+  80091d:	0f b6 c0             	movzbl %al,%eax
+  800920:	0f b6 12             	movzbl (%edx),%edx
+  800923:	29 d0                	sub    %edx,%eax
+  800925:	5d                   	pop    %ebp
+  800926:	c3                   	ret
+
+00800927 <strncmp>:
+  800927:	55                   	push   %ebp
+  800928:	89 e5                	mov    %esp,%ebp
+  80092a:	53                   	push   %ebx
+  80092b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800931:	8b 55 10             	mov    0x10(%ebp),%edx
+  800934:	eb 09                	jmp    80093f <strncmp+0x18>
+  800936:	83 ea 01             	sub    $0x1,%edx
+  800939:	83 c0 01             	add    $0x1,%eax
+  80093c:	83 c1 01             	add    $0x1,%ecx
+  80093f:	85 d2                	test   %edx,%edx
+  800941:	74 18                	je     80095b <strncmp+0x34>
+  800943:	0f b6 18             	movzbl (%eax),%ebx
+  800946:	84 db                	test   %bl,%bl
+  800948:	74 04                	je     80094e <strncmp+0x27>
+  80094a:	3a 19                	cmp    (%ecx),%bl
+  80094c:	74 e8                	je     800936 <strncmp+0xf>
+  80094e:	0f b6 00             	movzbl (%eax),%eax
+  800951:	0f b6 11             	movzbl (%ecx),%edx
+  800954:	29 d0                	sub    %edx,%eax
+  800956:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800959:	c9                   	leave
+  80095a:	c3                   	ret
+  80095b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800960:	eb f4                	jmp    800956 <strncmp+0x2f>
+
+00800962 <strchr>:
+  800962:	55                   	push   %ebp
+  800963:	89 e5                	mov    %esp,%ebp
+  800965:	8b 45 08             	mov    0x8(%ebp),%eax
+  800968:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80096c:	eb 03                	jmp    800971 <strchr+0xf>
+  80096e:	83 c0 01             	add    $0x1,%eax
+  800971:	0f b6 10             	movzbl (%eax),%edx
+  800974:	84 d2                	test   %dl,%dl
+  800976:	74 06                	je     80097e <strchr+0x1c>
+  800978:	38 ca                	cmp    %cl,%dl
+  80097a:	75 f2                	jne    80096e <strchr+0xc>
+  80097c:	eb 05                	jmp    800983 <strchr+0x21>
+  80097e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800983:	5d                   	pop    %ebp
+  800984:	c3                   	ret
+
+00800985 <strfind>:
+  800985:	55                   	push   %ebp
+  800986:	89 e5                	mov    %esp,%ebp
+  800988:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80098f:	0f b6 10             	movzbl (%eax),%edx
+  800992:	38 ca                	cmp    %cl,%dl
+  800994:	74 09                	je     80099f <strfind+0x1a>
+  800996:	84 d2                	test   %dl,%dl
+  800998:	74 05                	je     80099f <strfind+0x1a>
+  80099a:	83 c0 01             	add    $0x1,%eax
+  80099d:	eb f0                	jmp    80098f <strfind+0xa>
+  80099f:	5d                   	pop    %ebp
+  8009a0:	c3                   	ret
+
+008009a1 <memset>:
+  8009a1:	55                   	push   %ebp
+  8009a2:	89 e5                	mov    %esp,%ebp
+  8009a4:	57                   	push   %edi
+  8009a5:	56                   	push   %esi
+  8009a6:	53                   	push   %ebx
+  8009a7:	83 ec 04             	sub    $0x4,%esp
+  8009aa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ad:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009b0:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  8009b4:	89 f7                	mov    %esi,%edi
+  8009b6:	83 fa 0f             	cmp    $0xf,%edx
+  8009b9:	76 24                	jbe    8009df <memset+0x3e>
+  8009bb:	89 f1                	mov    %esi,%ecx
+  8009bd:	f7 d9                	neg    %ecx
+  8009bf:	83 e1 03             	and    $0x3,%ecx
+  8009c2:	29 ca                	sub    %ecx,%edx
+  8009c4:	89 d0                	mov    %edx,%eax
+  8009c6:	c1 e8 02             	shr    $0x2,%eax
+  8009c9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  8009cc:	83 e2 03             	and    $0x3,%edx
+  8009cf:	89 d8                	mov    %ebx,%eax
+  8009d1:	fc                   	cld
+  8009d2:	f3 aa                	rep stos %al,%es:(%edi)
+  8009d4:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  8009da:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  8009dd:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009df:	89 d1                	mov    %edx,%ecx
+  8009e1:	89 d8                	mov    %ebx,%eax
+  8009e3:	fc                   	cld
+  8009e4:	f3 aa                	rep stos %al,%es:(%edi)
+  8009e6:	89 f0                	mov    %esi,%eax
+  8009e8:	83 c4 04             	add    $0x4,%esp
+  8009eb:	5b                   	pop    %ebx
+  8009ec:	5e                   	pop    %esi
+  8009ed:	5f                   	pop    %edi
+  8009ee:	5d                   	pop    %ebp
+  8009ef:	c3                   	ret
+
+008009f0 <memmove>:
+  8009f0:	55                   	push   %ebp
+  8009f1:	89 e5                	mov    %esp,%ebp
+  8009f3:	57                   	push   %edi
+  8009f4:	56                   	push   %esi
+  8009f5:	53                   	push   %ebx
+  8009f6:	83 ec 0c             	sub    $0xc,%esp
+  8009f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009ff:	8b 45 10             	mov    0x10(%ebp),%eax
+  800a02:	85 c0                	test   %eax,%eax
+  800a04:	74 14                	je     800a1a <memmove+0x2a>
+  800a06:	39 da                	cmp    %ebx,%edx
+  800a08:	73 07                	jae    800a11 <memmove+0x21>
+  800a0a:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  800a0d:	39 cb                	cmp    %ecx,%ebx
+  800a0f:	72 13                	jb     800a24 <memmove+0x34>
+  800a11:	89 c1                	mov    %eax,%ecx
+  800a13:	89 d8                	mov    %ebx,%eax
+  800a15:	e8 94 fd ff ff       	call   8007ae <copy_fwd>
+  800a1a:	89 d8                	mov    %ebx,%eax
+  800a1c:	83 c4 0c             	add    $0xc,%esp
+  800a1f:	5b                   	pop    %ebx
+  800a20:	5e                   	pop    %esi
+  800a21:	5f                   	pop    %edi
+  800a22:	5d                   	pop    %ebp
+  800a23:	c3                   	ret
+  800a24:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800a27:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800a2a:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800a2d:	83 f8 0f             	cmp    $0xf,%eax
+  800a30:	76 23                	jbe    800a55 <memmove+0x65>
+  800a32:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800a35:	83 e1 03             	and    $0x3,%ecx
+  800a38:	29 c8                	sub    %ecx,%eax
+  800a3a:	89 c2                	mov    %eax,%edx
+  800a3c:	c1 ea 02             	shr    $0x2,%edx
+  800a3f:	83 e0 03             	and    $0x3,%eax
+  800a42:	fd                   	std
+  800a43:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a45:	83 ef 03             	sub    $0x3,%edi
+  800a48:	83 ee 03             	sub    $0x3,%esi
+  800a4b:	89 d1                	mov    %edx,%ecx
+  800a4d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a4f:	83 c7 03             	add    $0x3,%edi
+  800a52:	83 c6 03             	add    $0x3,%esi
+  800a55:	89 c1                	mov    %eax,%ecx
+  800a57:	fd                   	std
+  800a58:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a5a:	fc                   	cld
+  800a5b:	eb bd                	jmp    800a1a <memmove+0x2a>
+
+00800a5d <memcpy>:
+  800a5d:	55                   	push   %ebp
+  800a5e:	89 e5                	mov    %esp,%ebp
+  800a60:	53                   	push   %ebx
+  800a61:	83 ec 04             	sub    $0x4,%esp
+  800a64:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a67:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a6d:	89 d8                	mov    %ebx,%eax
+  800a6f:	e8 3a fd ff ff       	call   8007ae <copy_fwd>
+  800a74:	89 d8                	mov    %ebx,%eax
+  800a76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a79:	c9                   	leave
+  800a7a:	c3                   	ret
+
+00800a7b <page_copy>:
+  800a7b:	55                   	push   %ebp
+  800a7c:	89 e5                	mov    %esp,%ebp
+  800a7e:	57                   	push   %edi
+  800a7f:	56                   	push   %esi
+  800a80:	53                   	push   %ebx
+  800a81:	83 ec 0c             	sub    $0xc,%esp
+  800a84:	e8 5c fd ff ff       	call   8007e5 <have_sse2>
+  800a89:	85 c0                	test   %eax,%eax
+  800a8b:	74 39                	je     800ac6 <page_copy+0x4b>
+  800a8d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a90:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a93:	be 00 01 00 00       	mov    $0x100,%esi
+  800a98:	8b 03                	mov    (%ebx),%eax
+  800a9a:	8b 53 04             	mov    0x4(%ebx),%edx
+  800a9d:	0f c3 01             	movnti %eax,(%ecx)
+  800aa0:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800aa4:	8b 43 08             	mov    0x8(%ebx),%eax
+  800aa7:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800aaa:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800aae:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800ab2:	83 c3 10             	add    $0x10,%ebx
+  800ab5:	83 c1 10             	add    $0x10,%ecx
+  800ab8:	4e                   	dec    %esi
+  800ab9:	75 dd                	jne    800a98 <page_copy+0x1d>
+  800abb:	0f ae f8             	sfence
+  800abe:	83 c4 0c             	add    $0xc,%esp
+  800ac1:	5b                   	pop    %ebx
+  800ac2:	5e                   	pop    %esi
+  800ac3:	5f                   	pop    %edi
+  800ac4:	5d                   	pop    %ebp
+  800ac5:	c3                   	ret
+  800ac6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ac9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800acc:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800ad1:	fc                   	cld
+  800ad2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad4:	eb e8                	jmp    800abe <page_copy+0x43>
+
+00800ad6 <page_zero>:
+  800ad6:	55                   	push   %ebp
+  800ad7:	89 e5                	mov    %esp,%ebp
+  800ad9:	57                   	push   %edi
+  800ada:	83 ec 04             	sub    $0x4,%esp
+  800add:	e8 03 fd ff ff       	call   8007e5 <have_sse2>
+  800ae2:	85 c0                	test   %eax,%eax
+  800ae4:	74 3a                	je     800b20 <page_zero+0x4a>
+  800ae6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae9:	ba 80 00 00 00       	mov    $0x80,%edx
+  800aee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af3:	0f c3 08             	movnti %ecx,(%eax)
+  800af6:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800afa:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800afe:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800b02:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800b06:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800b0a:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800b0e:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800b12:	83 c0 20             	add    $0x20,%eax
+  800b15:	4a                   	dec    %edx
+  800b16:	75 db                	jne    800af3 <page_zero+0x1d>
+  800b18:	0f ae f8             	sfence
+  800b1b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b1e:	c9                   	leave
+  800b1f:	c3                   	ret
+  800b20:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b23:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800b28:	fc                   	cld
+  800b29:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b2b:	eb ee                	jmp    800b1b <page_zero+0x45>
+
+00800b2d <memcmp>:
+  800b2d:	55                   	push   %ebp
+  800b2e:	89 e5                	mov    %esp,%ebp
+  800b30:	56                   	push   %esi
+  800b31:	53                   	push   %ebx
+  800b32:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b35:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b38:	89 c6                	mov    %eax,%esi
+  800b3a:	03 75 10             	add    0x10(%ebp),%esi
+  800b3d:	eb 06                	jmp    800b45 <memcmp+0x18>
+  800b3f:	83 c0 01             	add    $0x1,%eax
+  800b42:	83 c2 01             	add    $0x1,%edx
+  800b45:	39 f0                	cmp    %esi,%eax
+  800b47:	74 14                	je     800b5d <memcmp+0x30>
+  800b49:	0f b6 08             	movzbl (%eax),%ecx
+  800b4c:	0f b6 1a             	movzbl (%edx),%ebx
+  800b4f:	38 d9                	cmp    %bl,%cl
+  800b51:	74 ec                	je     800b3f <memcmp+0x12>
+  800b53:	0f b6 c1             	movzbl %cl,%eax
+  800b56:	0f b6 db             	movzbl %bl,%ebx
+  800b59:	29 d8                	sub    %ebx,%eax
+  800b5b:	eb 05                	jmp    800b62 <memcmp+0x35>
+  800b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b62:	5b                   	pop    %ebx
+  800b63:	5e                   	pop    %esi
+  800b64:	5d                   	pop    %ebp
+  800b65:	c3                   	ret
+
+00800b66 <memfind>:
+  800b66:	55                   	push   %ebp
+  800b67:	89 e5                	mov    %esp,%ebp
+  800b69:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b6f:	89 c2                	mov    %eax,%edx
+  800b71:	03 55 10             	add    0x10(%ebp),%edx
+  800b74:	eb 03                	jmp    800b79 <memfind+0x13>
+  800b76:	83 c0 01             	add    $0x1,%eax
+  800b79:	39 d0                	cmp    %edx,%eax
+  800b7b:	73 04                	jae    800b81 <memfind+0x1b>
+  800b7d:	38 08                	cmp    %cl,(%eax)
+  800b7f:	75 f5                	jne    800b76 <memfind+0x10>
+  800b81:	5d                   	pop    %ebp
+  800b82:	c3                   	ret
+
+00800b83 <strtol>:
+  800b83:	55                   	push   %ebp
+  800b84:	89 e5                	mov    %esp,%ebp
+  800b86:	57                   	push   %edi
+  800b87:	56                   	push   %esi
+  800b88:	53                   	push   %ebx
+  800b89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b8f:	eb 03                	jmp    800b94 <strtol+0x11>
+  800b91:	83 c2 01             	add    $0x1,%edx
+  800b94:	0f b6 02             	movzbl (%edx),%eax
+  800b97:	3c 20                	cmp    $0x20,%al
+  800b99:	74 f6                	je     800b91 <strtol+0xe>
+  800b9b:	3c 09                	cmp    $0x9,%al
+  800b9d:	74 f2                	je     800b91 <strtol+0xe>
+  800b9f:	3c 2b                	cmp    $0x2b,%al
+  800ba1:	74 2a                	je     800bcd <strtol+0x4a>
+  800ba3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ba8:	3c 2d                	cmp    $0x2d,%al
+  800baa:	74 2b                	je     800bd7 <strtol+0x54>
+  800bac:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bb2:	75 0f                	jne    800bc3 <strtol+0x40>
+  800bb4:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bb7:	74 28                	je     800be1 <strtol+0x5e>
+  800bb9:	85 db                	test   %ebx,%ebx
+  800bbb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bc0:	0f 44 d8             	cmove  %eax,%ebx
+  800bc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc8:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bcb:	eb 46                	jmp    800c13 <strtol+0x90>
+  800bcd:	83 c2 01             	add    $0x1,%edx
+  800bd0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bd5:	eb d5                	jmp    800bac <strtol+0x29>
+  800bd7:	83 c2 01             	add    $0x1,%edx
+  800bda:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bdf:	eb cb                	jmp    800bac <strtol+0x29>
+  800be1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800be5:	74 0e                	je     800bf5 <strtol+0x72>
+  800be7:	85 db                	test   %ebx,%ebx
+  800be9:	75 d8                	jne    800bc3 <strtol+0x40>
+  800beb:	83 c2 01             	add    $0x1,%edx
+  800bee:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bf3:	eb ce                	jmp    800bc3 <strtol+0x40>
+  800bf5:	83 c2 02             	add    $0x2,%edx
+  800bf8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bfd:	eb c4                	jmp    800bc3 <strtol+0x40>
+  800bff:	0f be c0             	movsbl %al,%eax
+  800c02:	83 e8 30             	sub    $0x30,%eax
+  800c05:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c08:	7d 3a                	jge    800c44 <strtol+0xc1>
+  800c0a:	83 c2 01             	add    $0x1,%edx
+  800c0d:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c11:	01 c1                	add    %eax,%ecx
+  800c13:	0f b6 02             	movzbl (%edx),%eax
+  800c16:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c19:	89 f3                	mov    %esi,%ebx
+  800c1b:	80 fb 09             	cmp    $0x9,%bl
+  800c1e:	76 df                	jbe    800bff <strtol+0x7c>
+  800c20:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c23:	89 f3                	mov    %esi,%ebx
+  800c25:	80 fb 19             	cmp    $0x19,%bl
+  800c28:	77 08                	ja     800c32 <strtol+0xaf>
+  800c2a:	0f be c0             	movsbl %al,%eax
+  800c2d:	83 e8 57             	sub    $0x57,%eax
+  800c30:	eb d3                	jmp    800c05 <strtol+0x82>
+  800c32:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c35:	89 f3                	mov    %esi,%ebx
+  800c37:	80 fb 19             	cmp    $0x19,%bl
+  800c3a:	77 08                	ja     800c44 <strtol+0xc1>
+  800c3c:	0f be c0             	movsbl %al,%eax
+  800c3f:	83 e8 37             	sub    $0x37,%eax
+  800c42:	eb c1                	jmp    800c05 <strtol+0x82>
+  800c44:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c48:	74 05                	je     800c4f <strtol+0xcc>
+  800c4a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c4d:	89 10                	mov    %edx,(%eax)
+  800c4f:	89 c8                	mov    %ecx,%eax
+  800c51:	f7 d8                	neg    %eax
+  800c53:	85 ff                	test   %edi,%edi
+  800c55:	0f 45 c8             	cmovne %eax,%ecx
+  800c58:	89 c8                	mov    %ecx,%eax
+  800c5a:	5b                   	pop    %ebx
+  800c5b:	5e                   	pop    %esi
+  800c5c:	5f                   	pop    %edi
+  800c5d:	5d                   	pop    %ebp
+  800c5e:	c3                   	ret
+
+00800c5f <sys_cputs>:
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	57                   	push   %edi
+  800c63:	56                   	push   %esi
+  800c64:	53                   	push   %ebx
+  800c65:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c6c:	78 21                	js     800c8f <sys_cputs+0x30>
+  800c6e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c75:	75 2d                	jne    800ca4 <sys_cputs+0x45>
+  800c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c82:	89 c3                	mov    %eax,%ebx
+  800c84:	89 c7                	mov    %eax,%edi
+  800c86:	89 c6                	mov    %eax,%esi
+  800c88:	cd 30                	int    $0x30
+  800c8a:	5b                   	pop    %ebx
+  800c8b:	5e                   	pop    %esi
+  800c8c:	5f                   	pop    %edi
+  800c8d:	5d                   	pop    %ebp
+  800c8e:	c3                   	ret
+  800c8f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c94:	0f a2                	cpuid
+  800c96:	c1 ea 0b             	shr    $0xb,%edx
+  800c99:	83 e2 01             	and    $0x1,%edx
+  800c9c:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800ca2:	eb ca                	jmp    800c6e <sys_cputs+0xf>
+  800ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800caf:	89 c3                	mov    %eax,%ebx
+  800cb1:	89 c7                	mov    %eax,%edi
+  800cb3:	89 c6                	mov    %eax,%esi
+  800cb5:	55                   	push   %ebp
+  800cb6:	68 bf 0c 80 00       	push   $0x800cbf
+  800cbb:	89 e5                	mov    %esp,%ebp
+  800cbd:	0f 34                	sysenter
+  800cbf:	83 c4 04             	add    $0x4,%esp
+  800cc2:	5d                   	pop    %ebp
+  800cc3:	eb c5                	jmp    800c8a <sys_cputs+0x2b>
+
+00800cc5 <sys_cgetc>:
+  800cc5:	55                   	push   %ebp
+  800cc6:	89 e5                	mov    %esp,%ebp
+  800cc8:	57                   	push   %edi
+  800cc9:	56                   	push   %esi
+  800cca:	53                   	push   %ebx
+  800ccb:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800cd2:	78 22                	js     800cf6 <sys_cgetc+0x31>
+  800cd4:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800cdb:	75 2e                	jne    800d0b <sys_cgetc+0x46>
+  800cdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce2:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ce7:	89 d1                	mov    %edx,%ecx
+  800ce9:	89 d3                	mov    %edx,%ebx
+  800ceb:	89 d7                	mov    %edx,%edi
+  800ced:	89 d6                	mov    %edx,%esi
+  800cef:	cd 30                	int    $0x30
+  800cf1:	5b                   	pop    %ebx
+  800cf2:	5e                   	pop    %esi
+  800cf3:	5f                   	pop    %edi
+  800cf4:	5d                   	pop    %ebp
+  800cf5:	c3                   	ret
+  800cf6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cfb:	0f a2                	cpuid
+  800cfd:	c1 ea 0b             	shr    $0xb,%edx
+  800d00:	83 e2 01             	and    $0x1,%edx
+  800d03:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800d09:	eb c9                	jmp    800cd4 <sys_cgetc+0xf>
+  800d0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d10:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d15:	89 d1                	mov    %edx,%ecx
+  800d17:	89 d3                	mov    %edx,%ebx
+  800d19:	89 d7                	mov    %edx,%edi
+  800d1b:	89 d6                	mov    %edx,%esi
+  800d1d:	55                   	push   %ebp
+  800d1e:	68 27 0d 80 00       	push   $0x800d27
+  800d23:	89 e5                	mov    %esp,%ebp
+  800d25:	0f 34                	sysenter
+  800d27:	83 c4 04             	add    $0x4,%esp
+  800d2a:	5d                   	pop    %ebp
+  800d2b:	eb c4                	jmp    800cf1 <sys_cgetc+0x2c>
+
+00800d2d <sys_env_destroy>:
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	57                   	push   %edi
+  800d31:	56                   	push   %esi
+  800d32:	53                   	push   %ebx
+  800d33:	83 ec 0c             	sub    $0xc,%esp
+  800d36:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d3d:	78 2a                	js     800d69 <sys_env_destroy+0x3c>
+  800d3f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d46:	75 36                	jne    800d7e <sys_env_destroy+0x51>
+  800d48:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d4d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d52:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d55:	89 cb                	mov    %ecx,%ebx
+  800d57:	89 cf                	mov    %ecx,%edi
+  800d59:	89 ce                	mov    %ecx,%esi
+  800d5b:	cd 30                	int    $0x30
+  800d5d:	85 c0                	test   %eax,%eax
+  800d5f:	7f 40                	jg     800da1 <sys_env_destroy+0x74>
+  800d61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d64:	5b                   	pop    %ebx
+  800d65:	5e                   	pop    %esi
+  800d66:	5f                   	pop    %edi
+  800d67:	5d                   	pop    %ebp
+  800d68:	c3                   	ret
+  800d69:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d6e:	0f a2                	cpuid
+  800d70:	c1 ea 0b             	shr    $0xb,%edx
+  800d73:	83 e2 01             	and    $0x1,%edx
+  800d76:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800d7c:	eb c1                	jmp    800d3f <sys_env_destroy+0x12>
+  800d7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d81:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d86:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d8b:	89 cb                	mov    %ecx,%ebx
+  800d8d:	89 cf                	mov    %ecx,%edi
+  800d8f:	89 ce                	mov    %ecx,%esi
+  800d91:	55                   	push   %ebp
+  800d92:	68 9b 0d 80 00       	push   $0x800d9b
+  800d97:	89 e5                	mov    %esp,%ebp
+  800d99:	0f 34                	sysenter
+  800d9b:	83 c4 04             	add    $0x4,%esp
+  800d9e:	5d                   	pop    %ebp
+  800d9f:	eb bc                	jmp    800d5d <sys_env_destroy+0x30>
+  800da1:	83 ec 0c             	sub    $0xc,%esp
+  800da4:	50                   	push   %eax
+  800da5:	6a 03                	push   $0x3
+  800da7:	68 24 22 80 00       	push   $0x802224
+  800dac:	6a 49                	push   $0x49
+  800dae:	68 41 22 80 00       	push   $0x802241
+  800db3:	e8 57 0e 00 00       	call   801c0f <_panic>
+
+00800db8 <sys_getenvid>:
+  800db8:	55                   	push   %ebp
+  800db9:	89 e5                	mov    %esp,%ebp
+  800dbb:	57                   	push   %edi
+  800dbc:	56                   	push   %esi
+  800dbd:	53                   	push   %ebx
+  800dbe:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800dc5:	78 22                	js     800de9 <sys_getenvid+0x31>
+  800dc7:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800dce:	75 2e                	jne    800dfe <sys_getenvid+0x46>
+  800dd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd5:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dda:	89 d1                	mov    %edx,%ecx
+  800ddc:	89 d3                	mov    %edx,%ebx
+  800dde:	89 d7                	mov    %edx,%edi
+  800de0:	89 d6                	mov    %edx,%esi
+  800de2:	cd 30                	int    $0x30
+  800de4:	5b                   	pop    %ebx
+  800de5:	5e                   	pop    %esi
+  800de6:	5f                   	pop    %edi
+  800de7:	5d                   	pop    %ebp
+  800de8:	c3                   	ret
+  800de9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dee:	0f a2                	cpuid
+  800df0:	c1 ea 0b             	shr    $0xb,%edx
+  800df3:	83 e2 01             	and    $0x1,%edx
+  800df6:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800dfc:	eb c9                	jmp    800dc7 <sys_getenvid+0xf>
+  800dfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e03:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e08:	89 d1                	mov    %edx,%ecx
+  800e0a:	89 d3                	mov    %edx,%ebx
+  800e0c:	89 d7                	mov    %edx,%edi
+  800e0e:	89 d6                	mov    %edx,%esi
+  800e10:	55                   	push   %ebp
+  800e11:	68 1a 0e 80 00       	push   $0x800e1a
+  800e16:	89 e5                	mov    %esp,%ebp
+  800e18:	0f 34                	sysenter
+  800e1a:	83 c4 04             	add    $0x4,%esp
+  800e1d:	5d                   	pop    %ebp
+  800e1e:	eb c4                	jmp    800de4 <sys_getenvid+0x2c>
+
+00800e20 <sys_yield>:
+  800e20:	55                   	push   %ebp
+  800e21:	89 e5                	mov    %esp,%ebp
+  800e23:	57                   	push   %edi
+  800e24:	56                   	push   %esi
+  800e25:	53                   	push   %ebx
+  800e26:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e2d:	78 22                	js     800e51 <sys_yield+0x31>
+  800e2f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e36:	75 2e                	jne    800e66 <sys_yield+0x46>
+  800e38:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e42:	89 d1                	mov    %edx,%ecx
+  800e44:	89 d3                	mov    %edx,%ebx
+  800e46:	89 d7                	mov    %edx,%edi
+  800e48:	89 d6                	mov    %edx,%esi
+  800e4a:	cd 30                	int    $0x30
+  800e4c:	5b                   	pop    %ebx
+  800e4d:	5e                   	pop    %esi
+  800e4e:	5f                   	pop    %edi
+  800e4f:	5d                   	pop    %ebp
+  800e50:	c3                   	ret
+  800e51:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e56:	0f a2                	cpuid
+  800e58:	c1 ea 0b             	shr    $0xb,%edx
+  800e5b:	83 e2 01             	and    $0x1,%edx
+  800e5e:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800e64:	eb c9                	jmp    800e2f <sys_yield+0xf>
+  800e66:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e70:	89 d1                	mov    %edx,%ecx
+  800e72:	89 d3                	mov    %edx,%ebx
+  800e74:	89 d7                	mov    %edx,%edi
+  800e76:	89 d6                	mov    %edx,%esi
+  800e78:	55                   	push   %ebp
+  800e79:	68 82 0e 80 00       	push   $0x800e82
+  800e7e:	89 e5                	mov    %esp,%ebp
+  800e80:	0f 34                	sysenter
+  800e82:	83 c4 04             	add    $0x4,%esp
+  800e85:	5d                   	pop    %ebp
+  800e86:	eb c4                	jmp    800e4c <sys_yield+0x2c>
+
+00800e88 <sys_env_set_cow>:
+  800e88:	55                   	push   %ebp
+  800e89:	89 e5                	mov    %esp,%ebp
+  800e8b:	57                   	push   %edi
+  800e8c:	56                   	push   %esi
+  800e8d:	53                   	push   %ebx
+  800e8e:	83 ec 0c             	sub    $0xc,%esp
+  800e91:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e98:	78 2b                	js     800ec5 <sys_env_set_cow+0x3d>
+  800e9a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ea1:	75 37                	jne    800eda <sys_env_set_cow+0x52>
+  800ea3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ead:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb3:	89 df                	mov    %ebx,%edi
+  800eb5:	89 de                	mov    %ebx,%esi
+  800eb7:	cd 30                	int    $0x30
+  800eb9:	85 c0                	test   %eax,%eax
+  800ebb:	7f 41                	jg     800efe <sys_env_set_cow+0x76>
+  800ebd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec0:	5b                   	pop    %ebx
+  800ec1:	5e                   	pop    %esi
+  800ec2:	5f                   	pop    %edi
+  800ec3:	5d                   	pop    %ebp
+  800ec4:	c3                   	ret
+  800ec5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eca:	0f a2                	cpuid
+  800ecc:	c1 ea 0b             	shr    $0xb,%edx
+  800ecf:	83 e2 01             	and    $0x1,%edx
+  800ed2:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800ed8:	eb c0                	jmp    800e9a <sys_env_set_cow+0x12>
+  800eda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eea:	89 df                	mov    %ebx,%edi
+  800eec:	89 de                	mov    %ebx,%esi
+  800eee:	55                   	push   %ebp
+  800eef:	68 f8 0e 80 00       	push   $0x800ef8
+  800ef4:	89 e5                	mov    %esp,%ebp
+  800ef6:	0f 34                	sysenter
+  800ef8:	83 c4 04             	add    $0x4,%esp
+  800efb:	5d                   	pop    %ebp
+  800efc:	eb bb                	jmp    800eb9 <sys_env_set_cow+0x31>
+  800efe:	83 ec 0c             	sub    $0xc,%esp
+  800f01:	50                   	push   %eax
+  800f02:	6a 0d                	push   $0xd
+  800f04:	68 24 22 80 00       	push   $0x802224
+  800f09:	6a 49                	push   $0x49
+  800f0b:	68 41 22 80 00       	push   $0x802241
+  800f10:	e8 fa 0c 00 00       	call   801c0f <_panic>
+
+00800f15 <sys_env_set_quota>:
+  800f15:	55                   	push   %ebp
+  800f16:	89 e5                	mov    %esp,%ebp
+  800f18:	57                   	push   %edi
+  800f19:	56                   	push   %esi
+  800f1a:	53                   	push   %ebx
+  800f1b:	83 ec 0c             	sub    $0xc,%esp
+  800f1e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f25:	78 2b                	js     800f52 <sys_env_set_quota+0x3d>
+  800f27:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f2e:	75 37                	jne    800f67 <sys_env_set_quota+0x52>
+  800f30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f35:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f40:	89 df                	mov    %ebx,%edi
+  800f42:	89 de                	mov    %ebx,%esi
+  800f44:	cd 30                	int    $0x30
+  800f46:	85 c0                	test   %eax,%eax
+  800f48:	7f 41                	jg     800f8b <sys_env_set_quota+0x76>
+  800f4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4d:	5b                   	pop    %ebx
+  800f4e:	5e                   	pop    %esi
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+  800f52:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f57:	0f a2                	cpuid
+  800f59:	c1 ea 0b             	shr    $0xb,%edx
+  800f5c:	83 e2 01             	and    $0x1,%edx
+  800f5f:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800f65:	eb c0                	jmp    800f27 <sys_env_set_quota+0x12>
+  800f67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f72:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f77:	89 df                	mov    %ebx,%edi
+  800f79:	89 de                	mov    %ebx,%esi
+  800f7b:	55                   	push   %ebp
+  800f7c:	68 85 0f 80 00       	push   $0x800f85
+  800f81:	89 e5                	mov    %esp,%ebp
+  800f83:	0f 34                	sysenter
+  800f85:	83 c4 04             	add    $0x4,%esp
+  800f88:	5d                   	pop    %ebp
+  800f89:	eb bb                	jmp    800f46 <sys_env_set_quota+0x31>
+  800f8b:	83 ec 0c             	sub    $0xc,%esp
+  800f8e:	50                   	push   %eax
+  800f8f:	6a 0f                	push   $0xf
+  800f91:	68 24 22 80 00       	push   $0x802224
+  800f96:	6a 49                	push   $0x49
+  800f98:	68 41 22 80 00       	push   $0x802241
+  800f9d:	e8 6d 0c 00 00       	call   801c0f <_panic>
+
+00800fa2 <sys_page_alloc>:
+  800fa2:	55                   	push   %ebp
+  800fa3:	89 e5                	mov    %esp,%ebp
+  800fa5:	57                   	push   %edi
+  800fa6:	56                   	push   %esi
+  800fa7:	53                   	push   %ebx
+  800fa8:	83 ec 0c             	sub    $0xc,%esp
+  800fab:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800fb2:	78 2c                	js     800fe0 <sys_page_alloc+0x3e>
+  800fb4:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800fbb:	75 38                	jne    800ff5 <sys_page_alloc+0x53>
+  800fbd:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd0:	89 f7                	mov    %esi,%edi
+  800fd2:	cd 30                	int    $0x30
+  800fd4:	85 c0                	test   %eax,%eax
+  800fd6:	7f 42                	jg     80101a <sys_page_alloc+0x78>
+  800fd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdb:	5b                   	pop    %ebx
+  800fdc:	5e                   	pop    %esi
+  800fdd:	5f                   	pop    %edi
+  800fde:	5d                   	pop    %ebp
+  800fdf:	c3                   	ret
+  800fe0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fe5:	0f a2                	cpuid
+  800fe7:	c1 ea 0b             	shr    $0xb,%edx
+  800fea:	83 e2 01             	and    $0x1,%edx
+  800fed:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800ff3:	eb bf                	jmp    800fb4 <sys_page_alloc+0x12>
+  800ff5:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801000:	b8 04 00 00 00       	mov    $0x4,%eax
+  801005:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801008:	89 f7                	mov    %esi,%edi
+  80100a:	55                   	push   %ebp
+  80100b:	68 14 10 80 00       	push   $0x801014
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	0f 34                	sysenter
+  801014:	83 c4 04             	add    $0x4,%esp
+  801017:	5d                   	pop    %ebp
+  801018:	eb ba                	jmp    800fd4 <sys_page_alloc+0x32>
+  80101a:	83 ec 0c             	sub    $0xc,%esp
+  80101d:	50                   	push   %eax
+  80101e:	6a 04                	push   $0x4
+  801020:	68 24 22 80 00       	push   $0x802224
+  801025:	6a 49                	push   $0x49
+  801027:	68 41 22 80 00       	push   $0x802241
+  80102c:	e8 de 0b 00 00       	call   801c0f <_panic>
+
+00801031 <sys_page_map>:
+  801031:	55                   	push   %ebp
+  801032:	89 e5                	mov    %esp,%ebp
+  801034:	57                   	push   %edi
+  801035:	56                   	push   %esi
+  801036:	53                   	push   %ebx
+  801037:	83 ec 0c             	sub    $0xc,%esp
+  80103a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801041:	78 2b                	js     80106e <sys_page_map+0x3d>
+  801043:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80104a:	75 37                	jne    801083 <sys_page_map+0x52>
+  80104c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801051:	8b 55 08             	mov    0x8(%ebp),%edx
+  801054:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801057:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80105a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80105d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801060:	cd 30                	int    $0x30
+  801062:	85 c0                	test   %eax,%eax
+  801064:	7f 41                	jg     8010a7 <sys_page_map+0x76>
+  801066:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801069:	5b                   	pop    %ebx
+  80106a:	5e                   	pop    %esi
+  80106b:	5f                   	pop    %edi
+  80106c:	5d                   	pop    %ebp
+  80106d:	c3                   	ret
+  80106e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801073:	0f a2                	cpuid
+  801075:	c1 ea 0b             	shr    $0xb,%edx
+  801078:	83 e2 01             	and    $0x1,%edx
+  80107b:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801081:	eb c0                	jmp    801043 <sys_page_map+0x12>
+  801083:	8b 55 08             	mov    0x8(%ebp),%edx
+  801086:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801089:	b8 05 00 00 00       	mov    $0x5,%eax
+  80108e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801091:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801094:	8b 75 18             	mov    0x18(%ebp),%esi
+  801097:	55                   	push   %ebp
+  801098:	68 a1 10 80 00       	push   $0x8010a1
+  80109d:	89 e5                	mov    %esp,%ebp
+  80109f:	0f 34                	sysenter
+  8010a1:	83 c4 04             	add    $0x4,%esp
+  8010a4:	5d                   	pop    %ebp
+  8010a5:	eb bb                	jmp    801062 <sys_page_map+0x31>
+  8010a7:	83 ec 0c             	sub    $0xc,%esp
+  8010aa:	50                   	push   %eax
+  8010ab:	6a 05                	push   $0x5
+  8010ad:	68 24 22 80 00       	push   $0x802224
+  8010b2:	6a 49                	push   $0x49
+  8010b4:	68 41 22 80 00       	push   $0x802241
+  8010b9:	e8 51 0b 00 00       	call   801c0f <_panic>
+
+008010be <sys_page_unmap>:
+  8010be:	55                   	push   %ebp
+  8010bf:	89 e5                	mov    %esp,%ebp
+  8010c1:	57                   	push   %edi
+  8010c2:	56                   	push   %esi
+  8010c3:	53                   	push   %ebx
+  8010c4:	83 ec 0c             	sub    $0xc,%esp
+  8010c7:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8010ce:	78 2b                	js     8010fb <sys_page_unmap+0x3d>
+  8010d0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8010d7:	75 37                	jne    801110 <sys_page_unmap+0x52>
+  8010d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010de:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e9:	89 df                	mov    %ebx,%edi
+  8010eb:	89 de                	mov    %ebx,%esi
+  8010ed:	cd 30                	int    $0x30
+  8010ef:	85 c0                	test   %eax,%eax
+  8010f1:	7f 41                	jg     801134 <sys_page_unmap+0x76>
+  8010f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f6:	5b                   	pop    %ebx
+  8010f7:	5e                   	pop    %esi
+  8010f8:	5f                   	pop    %edi
+  8010f9:	5d                   	pop    %ebp
+  8010fa:	c3                   	ret
+  8010fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801100:	0f a2                	cpuid
+  801102:	c1 ea 0b             	shr    $0xb,%edx
+  801105:	83 e2 01             	and    $0x1,%edx
+  801108:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80110e:	eb c0                	jmp    8010d0 <sys_page_unmap+0x12>
+  801110:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801115:	8b 55 08             	mov    0x8(%ebp),%edx
+  801118:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801120:	89 df                	mov    %ebx,%edi
+  801122:	89 de                	mov    %ebx,%esi
+  801124:	55                   	push   %ebp
+  801125:	68 2e 11 80 00       	push   $0x80112e
+  80112a:	89 e5                	mov    %esp,%ebp
+  80112c:	0f 34                	sysenter
+  80112e:	83 c4 04             	add    $0x4,%esp
+  801131:	5d                   	pop    %ebp
+  801132:	eb bb                	jmp    8010ef <sys_page_unmap+0x31>
+  801134:	83 ec 0c             	sub    $0xc,%esp
+  801137:	50                   	push   %eax
+  801138:	6a 06                	push   $0x6
+  80113a:	68 24 22 80 00       	push   $0x802224
+  80113f:	6a 49                	push   $0x49
+  801141:	68 41 22 80 00       	push   $0x802241
+  801146:	e8 c4 0a 00 00       	call   801c0f <_panic>
+
+0080114b <sys_page_reuse>:
+  80114b:	55                   	push   %ebp
+  80114c:	89 e5                	mov    %esp,%ebp
+  80114e:	57                   	push   %edi
+  80114f:	56                   	push   %esi
+  801150:	53                   	push   %ebx
+  801151:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801158:	78 24                	js     80117e <sys_page_reuse+0x33>
+  80115a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801161:	75 30                	jne    801193 <sys_page_reuse+0x48>
+  801163:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801168:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80116d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801170:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801173:	89 df                	mov    %ebx,%edi
+  801175:	89 de                	mov    %ebx,%esi
+  801177:	cd 30                	int    $0x30
+  801179:	5b                   	pop    %ebx
+  80117a:	5e                   	pop    %esi
+  80117b:	5f                   	pop    %edi
+  80117c:	5d                   	pop    %ebp
+  80117d:	c3                   	ret
+  80117e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801183:	0f a2                	cpuid
+  801185:	c1 ea 0b             	shr    $0xb,%edx
+  801188:	83 e2 01             	and    $0x1,%edx
+  80118b:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801191:	eb c7                	jmp    80115a <sys_page_reuse+0xf>
+  801193:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801198:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011a3:	89 df                	mov    %ebx,%edi
+  8011a5:	89 de                	mov    %ebx,%esi
+  8011a7:	55                   	push   %ebp
+  8011a8:	68 b1 11 80 00       	push   $0x8011b1
+  8011ad:	89 e5                	mov    %esp,%ebp
+  8011af:	0f 34                	sysenter
+  8011b1:	83 c4 04             	add    $0x4,%esp
+  8011b4:	5d                   	pop    %ebp
+  8011b5:	eb c2                	jmp    801179 <sys_page_reuse+0x2e>
+
+008011b7 <sys_env_set_status>:
+  8011b7:	55                   	push   %ebp
+  8011b8:	89 e5                	mov    %esp,%ebp
+  8011ba:	57                   	push   %edi
+  8011bb:	56                   	push   %esi
+  8011bc:	53                   	push   %ebx
+  8011bd:	83 ec 0c             	sub    $0xc,%esp
+  8011c0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8011c7:	78 2b                	js     8011f4 <sys_env_set_status+0x3d>
+  8011c9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8011d0:	75 37                	jne    801209 <sys_env_set_status+0x52>
+  8011d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e2:	89 df                	mov    %ebx,%edi
+  8011e4:	89 de                	mov    %ebx,%esi
+  8011e6:	cd 30                	int    $0x30
+  8011e8:	85 c0                	test   %eax,%eax
+  8011ea:	7f 41                	jg     80122d <sys_env_set_status+0x76>
+  8011ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ef:	5b                   	pop    %ebx
+  8011f0:	5e                   	pop    %esi
+  8011f1:	5f                   	pop    %edi
+  8011f2:	5d                   	pop    %ebp
+  8011f3:	c3                   	ret
+  8011f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011f9:	0f a2                	cpuid
+  8011fb:	c1 ea 0b             	shr    $0xb,%edx
+  8011fe:	83 e2 01             	and    $0x1,%edx
+  801201:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801207:	eb c0                	jmp    8011c9 <sys_env_set_status+0x12>
+  801209:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801211:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801214:	b8 08 00 00 00       	mov    $0x8,%eax
+  801219:	89 df                	mov    %ebx,%edi
+  80121b:	89 de                	mov    %ebx,%esi
+  80121d:	55                   	push   %ebp
+  80121e:	68 27 12 80 00       	push   $0x801227
+  801223:	89 e5                	mov    %esp,%ebp
+  801225:	0f 34                	sysenter
+  801227:	83 c4 04             	add    $0x4,%esp
+  80122a:	5d                   	pop    %ebp
+  80122b:	eb bb                	jmp    8011e8 <sys_env_set_status+0x31>
+  80122d:	83 ec 0c             	sub    $0xc,%esp
+  801230:	50                   	push   %eax
+  801231:	6a 08                	push   $0x8
+  801233:	68 24 22 80 00       	push   $0x802224
+  801238:	6a 49                	push   $0x49
+  80123a:	68 41 22 80 00       	push   $0x802241
+  80123f:	e8 cb 09 00 00       	call   801c0f <_panic>
+
+00801244 <sys_env_set_pgfault_upcall>:
+  801244:	55                   	push   %ebp
+  801245:	89 e5                	mov    %esp,%ebp
+  801247:	57                   	push   %edi
+  801248:	56                   	push   %esi
+  801249:	53                   	push   %ebx
+  80124a:	83 ec 0c             	sub    $0xc,%esp
+  80124d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801254:	78 2b                	js     801281 <sys_env_set_pgfault_upcall+0x3d>
+  801256:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80125d:	75 37                	jne    801296 <sys_env_set_pgfault_upcall+0x52>
+  80125f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801264:	b8 09 00 00 00       	mov    $0x9,%eax
+  801269:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126f:	89 df                	mov    %ebx,%edi
+  801271:	89 de                	mov    %ebx,%esi
+  801273:	cd 30                	int    $0x30
+  801275:	85 c0                	test   %eax,%eax
+  801277:	7f 41                	jg     8012ba <sys_env_set_pgfault_upcall+0x76>
+  801279:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127c:	5b                   	pop    %ebx
+  80127d:	5e                   	pop    %esi
+  80127e:	5f                   	pop    %edi
+  80127f:	5d                   	pop    %ebp
+  801280:	c3                   	ret
+  801281:	b8 01 00 00 00       	mov    $0x1,%eax
+  801286:	0f a2                	cpuid
+  801288:	c1 ea 0b             	shr    $0xb,%edx
+  80128b:	83 e2 01             	and    $0x1,%edx
+  80128e:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801294:	eb c0                	jmp    801256 <sys_env_set_pgfault_upcall+0x12>
+  801296:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012a6:	89 df                	mov    %ebx,%edi
+  8012a8:	89 de                	mov    %ebx,%esi
+  8012aa:	55                   	push   %ebp
+  8012ab:	68 b4 12 80 00       	push   $0x8012b4
+  8012b0:	89 e5                	mov    %esp,%ebp
+  8012b2:	0f 34                	sysenter
+  8012b4:	83 c4 04             	add    $0x4,%esp
+  8012b7:	5d                   	pop    %ebp
+  8012b8:	eb bb                	jmp    801275 <sys_env_set_pgfault_upcall+0x31>
+  8012ba:	83 ec 0c             	sub    $0xc,%esp
+  8012bd:	50                   	push   %eax
+  8012be:	6a 09                	push   $0x9
+  8012c0:	68 24 22 80 00       	push   $0x802224
+  8012c5:	6a 49                	push   $0x49
+  8012c7:	68 41 22 80 00       	push   $0x802241
+  8012cc:	e8 3e 09 00 00       	call   801c0f <_panic>
+
+008012d1 <sys_env_set_trace>:
+  8012d1:	55                   	push   %ebp
+  8012d2:	89 e5                	mov    %esp,%ebp
+  8012d4:	57                   	push   %edi
+  8012d5:	56                   	push   %esi
+  8012d6:	53                   	push   %ebx
+  8012d7:	83 ec 0c             	sub    $0xc,%esp
+  8012da:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8012e1:	78 2b                	js     80130e <sys_env_set_trace+0x3d>
+  8012e3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8012ea:	75 37                	jne    801323 <sys_env_set_trace+0x52>
+  8012ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fc:	89 df                	mov    %ebx,%edi
+  8012fe:	89 de                	mov    %ebx,%esi
+  801300:	cd 30                	int    $0x30
+  801302:	85 c0                	test   %eax,%eax
+  801304:	7f 41                	jg     801347 <sys_env_set_trace+0x76>
+  801306:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801309:	5b                   	pop    %ebx
+  80130a:	5e                   	pop    %esi
+  80130b:	5f                   	pop    %edi
+  80130c:	5d                   	pop    %ebp
+  80130d:	c3                   	ret
+  80130e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801313:	0f a2                	cpuid
+  801315:	c1 ea 0b             	shr    $0xb,%edx
+  801318:	83 e2 01             	and    $0x1,%edx
+  80131b:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801321:	eb c0                	jmp    8012e3 <sys_env_set_trace+0x12>
+  801323:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801328:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80132e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801333:	89 df                	mov    %ebx,%edi
+  801335:	89 de                	mov    %ebx,%esi
+  801337:	55                   	push   %ebp
+  801338:	68 41 13 80 00       	push   $0x801341
+  80133d:	89 e5                	mov    %esp,%ebp
+  80133f:	0f 34                	sysenter
+  801341:	83 c4 04             	add    $0x4,%esp
+  801344:	5d                   	pop    %ebp
+  801345:	eb bb                	jmp    801302 <sys_env_set_trace+0x31>
+  801347:	83 ec 0c             	sub    $0xc,%esp
+  80134a:	50                   	push   %eax
+  80134b:	6a 12                	push   $0x12
+  80134d:	68 24 22 80 00       	push   $0x802224
+  801352:	6a 49                	push   $0x49
+  801354:	68 41 22 80 00       	push   $0x802241
+  801359:	e8 b1 08 00 00       	call   801c0f <_panic>
+
+0080135e <sys_env_set_rdpmc>:
+  80135e:	55                   	push   %ebp
+  80135f:	89 e5                	mov    %esp,%ebp
+  801361:	57                   	push   %edi
+  801362:	56                   	push   %esi
+  801363:	53                   	push   %ebx
+  801364:	83 ec 0c             	sub    $0xc,%esp
+  801367:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80136e:	78 2b                	js     80139b <sys_env_set_rdpmc+0x3d>
+  801370:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801377:	75 37                	jne    8013b0 <sys_env_set_rdpmc+0x52>
+  801379:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801383:	8b 55 08             	mov    0x8(%ebp),%edx
+  801386:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801389:	89 df                	mov    %ebx,%edi
+  80138b:	89 de                	mov    %ebx,%esi
+  80138d:	cd 30                	int    $0x30
+  80138f:	85 c0                	test   %eax,%eax
+  801391:	7f 41                	jg     8013d4 <sys_env_set_rdpmc+0x76>
+  801393:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801396:	5b                   	pop    %ebx
+  801397:	5e                   	pop    %esi
+  801398:	5f                   	pop    %edi
+  801399:	5d                   	pop    %ebp
+  80139a:	c3                   	ret
+  80139b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013a0:	0f a2                	cpuid
+  8013a2:	c1 ea 0b             	shr    $0xb,%edx
+  8013a5:	83 e2 01             	and    $0x1,%edx
+  8013a8:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8013ae:	eb c0                	jmp    801370 <sys_env_set_rdpmc+0x12>
+  8013b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013bb:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013c0:	89 df                	mov    %ebx,%edi
+  8013c2:	89 de                	mov    %ebx,%esi
+  8013c4:	55                   	push   %ebp
+  8013c5:	68 ce 13 80 00       	push   $0x8013ce
+  8013ca:	89 e5                	mov    %esp,%ebp
+  8013cc:	0f 34                	sysenter
+  8013ce:	83 c4 04             	add    $0x4,%esp
+  8013d1:	5d                   	pop    %ebp
+  8013d2:	eb bb                	jmp    80138f <sys_env_set_rdpmc+0x31>
+  8013d4:	83 ec 0c             	sub    $0xc,%esp
+  8013d7:	50                   	push   %eax
+  8013d8:	6a 13                	push   $0x13
+  8013da:	68 24 22 80 00       	push   $0x802224
+  8013df:	6a 49                	push   $0x49
+  8013e1:	68 41 22 80 00       	push   $0x802241
+  8013e6:	e8 24 08 00 00       	call   801c0f <_panic>
+
+008013eb <sys_ring_setup>:
+  8013eb:	55                   	push   %ebp
+  8013ec:	89 e5                	mov    %esp,%ebp
+  8013ee:	57                   	push   %edi
+  8013ef:	56                   	push   %esi
+  8013f0:	53                   	push   %ebx
+  8013f1:	83 ec 0c             	sub    $0xc,%esp
+  8013f4:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013fb:	78 29                	js     801426 <sys_ring_setup+0x3b>
+  8013fd:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801404:	75 35                	jne    80143b <sys_ring_setup+0x50>
+  801406:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801410:	89 d1                	mov    %edx,%ecx
+  801412:	89 d3                	mov    %edx,%ebx
+  801414:	89 d7                	mov    %edx,%edi
+  801416:	89 d6                	mov    %edx,%esi
+  801418:	cd 30                	int    $0x30
+  80141a:	85 c0                	test   %eax,%eax
+  80141c:	7f 3f                	jg     80145d <sys_ring_setup+0x72>
+  80141e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801421:	5b                   	pop    %ebx
+  801422:	5e                   	pop    %esi
+  801423:	5f                   	pop    %edi
+  801424:	5d                   	pop    %ebp
+  801425:	c3                   	ret
+  801426:	b8 01 00 00 00       	mov    $0x1,%eax
+  80142b:	0f a2                	cpuid
+  80142d:	c1 ea 0b             	shr    $0xb,%edx
+  801430:	83 e2 01             	and    $0x1,%edx
+  801433:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801439:	eb c2                	jmp    8013fd <sys_ring_setup+0x12>
+  80143b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801440:	b8 10 00 00 00       	mov    $0x10,%eax
+  801445:	89 d1                	mov    %edx,%ecx
+  801447:	89 d3                	mov    %edx,%ebx
+  801449:	89 d7                	mov    %edx,%edi
+  80144b:	89 d6                	mov    %edx,%esi
+  80144d:	55                   	push   %ebp
+  80144e:	68 57 14 80 00       	push   $0x801457
+  801453:	89 e5                	mov    %esp,%ebp
+  801455:	0f 34                	sysenter
+  801457:	83 c4 04             	add    $0x4,%esp
+  80145a:	5d                   	pop    %ebp
+  80145b:	eb bd                	jmp    80141a <sys_ring_setup+0x2f>
+  80145d:	83 ec 0c             	sub    $0xc,%esp
+  801460:	50                   	push   %eax
+  801461:	6a 10                	push   $0x10
+  801463:	68 24 22 80 00       	push   $0x802224
+  801468:	6a 49                	push   $0x49
+  80146a:	68 41 22 80 00       	push   $0x802241
+  80146f:	e8 9b 07 00 00       	call   801c0f <_panic>
+
+00801474 <sys_ring_enter>:
+  801474:	55                   	push   %ebp
+  801475:	89 e5                	mov    %esp,%ebp
+  801477:	57                   	push   %edi
+  801478:	56                   	push   %esi
+  801479:	53                   	push   %ebx
+  80147a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801481:	78 22                	js     8014a5 <sys_ring_enter+0x31>
+  801483:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80148a:	75 2e                	jne    8014ba <sys_ring_enter+0x46>
+  80148c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801491:	b8 11 00 00 00       	mov    $0x11,%eax
+  801496:	89 d1                	mov    %edx,%ecx
+  801498:	89 d3                	mov    %edx,%ebx
+  80149a:	89 d7                	mov    %edx,%edi
+  80149c:	89 d6                	mov    %edx,%esi
+  80149e:	cd 30                	int    $0x30
+  8014a0:	5b                   	pop    %ebx
+  8014a1:	5e                   	pop    %esi
+  8014a2:	5f                   	pop    %edi
+  8014a3:	5d                   	pop    %ebp
+  8014a4:	c3                   	ret
+  8014a5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014aa:	0f a2                	cpuid
+  8014ac:	c1 ea 0b             	shr    $0xb,%edx
+  8014af:	83 e2 01             	and    $0x1,%edx
+  8014b2:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8014b8:	eb c9                	jmp    801483 <sys_ring_enter+0xf>
+  8014ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014bf:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014c4:	89 d1                	mov    %edx,%ecx
+  8014c6:	89 d3                	mov    %edx,%ebx
+  8014c8:	89 d7                	mov    %edx,%edi
+  8014ca:	89 d6                	mov    %edx,%esi
+  8014cc:	55                   	push   %ebp
+  8014cd:	68 d6 14 80 00       	push   $0x8014d6
+  8014d2:	89 e5                	mov    %esp,%ebp
+  8014d4:	0f 34                	sysenter
+  8014d6:	83 c4 04             	add    $0x4,%esp
+  8014d9:	5d                   	pop    %ebp
+  8014da:	eb c4                	jmp    8014a0 <sys_ring_enter+0x2c>
+
+008014dc <sys_ipc_try_send>:
+  8014dc:	55                   	push   %ebp
+  8014dd:	89 e5                	mov    %esp,%ebp
+  8014df:	57                   	push   %edi
+  8014e0:	56                   	push   %esi
+  8014e1:	53                   	push   %ebx
+  8014e2:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014e9:	78 26                	js     801511 <sys_ipc_try_send+0x35>
+  8014eb:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014f2:	75 32                	jne    801526 <sys_ipc_try_send+0x4a>
+  8014f4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801501:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801504:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801507:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80150a:	cd 30                	int    $0x30
+  80150c:	5b                   	pop    %ebx
+  80150d:	5e                   	pop    %esi
+  80150e:	5f                   	pop    %edi
+  80150f:	5d                   	pop    %ebp
+  801510:	c3                   	ret
+  801511:	b8 01 00 00 00       	mov    $0x1,%eax
+  801516:	0f a2                	cpuid
+  801518:	c1 ea 0b             	shr    $0xb,%edx
+  80151b:	83 e2 01             	and    $0x1,%edx
+  80151e:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801524:	eb c5                	jmp    8014eb <sys_ipc_try_send+0xf>
+  801526:	8b 55 08             	mov    0x8(%ebp),%edx
+  801529:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80152c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801531:	be 00 00 00 00       	mov    $0x0,%esi
+  801536:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801539:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80153c:	55                   	push   %ebp
+  80153d:	68 46 15 80 00       	push   $0x801546
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	0f 34                	sysenter
+  801546:	83 c4 04             	add    $0x4,%esp
+  801549:	5d                   	pop    %ebp
+  80154a:	eb c0                	jmp    80150c <sys_ipc_try_send+0x30>
+
+0080154c <sys_ipc_recv>:
+  80154c:	55                   	push   %ebp
+  80154d:	89 e5                	mov    %esp,%ebp
+  80154f:	57                   	push   %edi
+  801550:	56                   	push   %esi
+  801551:	53                   	push   %ebx
+  801552:	83 ec 0c             	sub    $0xc,%esp
+  801555:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80155c:	78 2a                	js     801588 <sys_ipc_recv+0x3c>
+  80155e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801565:	75 36                	jne    80159d <sys_ipc_recv+0x51>
+  801567:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80156c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801571:	8b 55 08             	mov    0x8(%ebp),%edx
+  801574:	89 cb                	mov    %ecx,%ebx
+  801576:	89 cf                	mov    %ecx,%edi
+  801578:	89 ce                	mov    %ecx,%esi
+  80157a:	cd 30                	int    $0x30
+  80157c:	85 c0                	test   %eax,%eax
+  80157e:	7f 40                	jg     8015c0 <sys_ipc_recv+0x74>
+  801580:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801583:	5b                   	pop    %ebx
+  801584:	5e                   	pop    %esi
+  801585:	5f                   	pop    %edi
+  801586:	5d                   	pop    %ebp
+  801587:	c3                   	ret
+  801588:	b8 01 00 00 00       	mov    $0x1,%eax
+  80158d:	0f a2                	cpuid
+  80158f:	c1 ea 0b             	shr    $0xb,%edx
+  801592:	83 e2 01             	and    $0x1,%edx
+  801595:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80159b:	eb c1                	jmp    80155e <sys_ipc_recv+0x12>
+  80159d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015a5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8015aa:	89 cb                	mov    %ecx,%ebx
+  8015ac:	89 cf                	mov    %ecx,%edi
+  8015ae:	89 ce                	mov    %ecx,%esi
+  8015b0:	55                   	push   %ebp
+  8015b1:	68 ba 15 80 00       	push   $0x8015ba
+  8015b6:	89 e5                	mov    %esp,%ebp
+  8015b8:	0f 34                	sysenter
+  8015ba:	83 c4 04             	add    $0x4,%esp
+  8015bd:	5d                   	pop    %ebp
+  8015be:	eb bc                	jmp    80157c <sys_ipc_recv+0x30>
+  8015c0:	83 ec 0c             	sub    $0xc,%esp
+  8015c3:	50                   	push   %eax
+  8015c4:	6a 0c                	push   $0xc
+  8015c6:	68 24 22 80 00       	push   $0x802224
+  8015cb:	6a 49                	push   $0x49
+  8015cd:	68 41 22 80 00       	push   $0x802241
+  8015d2:	e8 38 06 00 00       	call   801c0f <_panic>
+
+008015d7 <duppage>:
+  8015d7:	55                   	push   %ebp
+  8015d8:	89 e5                	mov    %esp,%ebp
+  8015da:	53                   	push   %ebx
+  8015db:	83 ec 04             	sub    $0x4,%esp
+  8015de:	89 d3                	mov    %edx,%ebx
+  8015e0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015e7:	f6 c2 02             	test   $0x2,%dl
+  8015ea:	75 0c                	jne    8015f8 <duppage+0x21>
+  8015ec:	8b 14 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edx
+  8015f3:	f6 c6 08             	test   $0x8,%dh
+  8015f6:	74 64                	je     80165c <duppage+0x85>
+  8015f8:	c1 e3 0c             	shl    $0xc,%ebx
+  8015fb:	83 ec 0c             	sub    $0xc,%esp
+  8015fe:	68 05 08 00 00       	push   $0x805
+  801603:	53                   	push   %ebx
+  801604:	50                   	push   %eax
+  801605:	53                   	push   %ebx
+  801606:	6a 00                	push   $0x0
+  801608:	e8 24 fa ff ff       	call   801031 <sys_page_map>
+  80160d:	83 c4 20             	add    $0x20,%esp
+  801610:	85 c0                	test   %eax,%eax
+  801612:	78 24                	js     801638 <duppage+0x61>
+  801614:	83 ec 0c             	sub    $0xc,%esp
+  801617:	68 05 08 00 00       	push   $0x805
+  80161c:	53                   	push   %ebx
+  80161d:	6a 00                	push   $0x0
+  80161f:	53                   	push   %ebx
+  801620:	6a 00                	push   $0x0
+  801622:	e8 0a fa ff ff       	call   801031 <sys_page_map>
+  801627:	83 c4 20             	add    $0x20,%esp
+  80162a:	85 c0                	test   %eax,%eax
+  80162c:	78 1c                	js     80164a <duppage+0x73>
+  80162e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801633:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801636:	c9                   	leave
+  801637:	c3                   	ret
+  801638:	50                   	push   %eax
+  801639:	68 4f 22 80 00       	push   $0x80224f
+  80163e:	6a 52                	push   $0x52
+  801640:	68 60 22 80 00       	push   $0x802260
+  801645:	e8 c5 05 00 00       	call   801c0f <_panic>
+  80164a:	50                   	push   %eax
+  80164b:	68 4f 22 80 00       	push   $0x80224f
+  801650:	6a 55                	push   $0x55
+  801652:	68 60 22 80 00       	push   $0x802260
+  801657:	e8 b3 05 00 00       	call   801c0f <_panic>
+  80165c:	c1 e3 0c             	shl    $0xc,%ebx
+  80165f:	83 ec 0c             	sub    $0xc,%esp
+  801662:	6a 05                	push   $0x5
+  801664:	53                   	push   %ebx
+  801665:	50                   	push   %eax
+  801666:	53                   	push   %ebx
+  801667:	6a 00                	push   $0x0
+  801669:	e8 c3 f9 ff ff       	call   801031 <sys_page_map>
+  80166e:	83 c4 20             	add    $0x20,%esp
+  801671:	85 c0                	test   %eax,%eax
+  801673:	79 b9                	jns    80162e <duppage+0x57>
+  801675:	50                   	push   %eax
+  801676:	68 4f 22 80 00       	push   $0x80224f
+  80167b:	6a 59                	push   $0x59
+  80167d:	68 60 22 80 00       	push   $0x802260
+  801682:	e8 88 05 00 00       	call   801c0f <_panic>
+
+00801687 <pgfault>:
+  801687:	55                   	push   %ebp
+  801688:	89 e5                	mov    %esp,%ebp
+  80168a:	53                   	push   %ebx
+  80168b:	83 ec 04             	sub    $0x4,%esp
+  80168e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801691:	8b 18                	mov    (%eax),%ebx
+  801693:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801697:	0f 84 90 00 00 00    	je     80172d <pgfault+0xa6>
+  80169d:	89 d8                	mov    %ebx,%eax
+  80169f:	c1 e8 0c             	shr    $0xc,%eax
+  8016a2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016a9:	f7 c2 01 08 00 00    	test   $0x801,%edx
+  8016af:	74 7c                	je     80172d <pgfault+0xa6>
+  8016b1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016b8:	c1 e8 0c             	shr    $0xc,%eax
+  8016bb:	0f b7 04 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%eax
+  8016c2:	ef 
+  8016c3:	66 83 f8 01          	cmp    $0x1,%ax
+  8016c7:	74 78                	je     801741 <pgfault+0xba>
+  8016c9:	83 ec 04             	sub    $0x4,%esp
+  8016cc:	6a 07                	push   $0x7
+  8016ce:	68 00 f0 7f 00       	push   $0x7ff000
+  8016d3:	6a 00                	push   $0x0
+  8016d5:	e8 c8 f8 ff ff       	call   800fa2 <sys_page_alloc>
+  8016da:	83 c4 10             	add    $0x10,%esp
+  8016dd:	85 c0                	test   %eax,%eax
+  8016df:	78 7f                	js     801760 <pgfault+0xd9>
+  8016e1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8016e7:	83 ec 08             	sub    $0x8,%esp
+  8016ea:	53                   	push   %ebx
+  8016eb:	68 00 f0 7f 00       	push   $0x7ff000
+  8016f0:	e8 86 f3 ff ff       	call   800a7b <page_copy>
+  8016f5:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8016fc:	53                   	push   %ebx
+  8016fd:	6a 00                	push   $0x0
+  8016ff:	68 00 f0 7f 00       	push   $0x7ff000
+  801704:	6a 00                	push   $0x0
+  801706:	e8 26 f9 ff ff       	call   801031 <sys_page_map>
+  80170b:	83 c4 20             	add    $0x20,%esp
+  80170e:	85 c0                	test   %eax,%eax
+  801710:	78 60                	js     801772 <pgfault+0xeb>
+  801712:	83 ec 08             	sub    $0x8,%esp
+  801715:	68 00 f0 7f 00       	push   $0x7ff000
+  80171a:	6a 00                	push   $0x0
+  80171c:	e8 9d f9 ff ff       	call   8010be <sys_page_unmap>
+  801721:	83 c4 10             	add    $0x10,%esp
+  801724:	85 c0                	test   %eax,%eax
+  801726:	78 5c                	js     801784 <pgfault+0xfd>
+  801728:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80172b:	c9                   	leave
+  80172c:	c3                   	ret
+  80172d:	83 ec 04             	sub    $0x4,%esp
+  801730:	68 6b 22 80 00       	push   $0x80226b
+  801735:	6a 1c                	push   $0x1c
+  801737:	68 60 22 80 00       	push   $0x802260
+  80173c:	e8 ce 04 00 00       	call   801c0f <_panic>
+  801741:	83 ec 08             	sub    $0x8,%esp
+  801744:	89 d8                	mov    %ebx,%eax
+  801746:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80174b:	50                   	push   %eax
+  80174c:	6a 00                	push   $0x0
+  80174e:	e8 f8 f9 ff ff       	call   80114b <sys_page_reuse>
+  801753:	83 c4 10             	add    $0x10,%esp
+  801756:	85 c0                	test   %eax,%eax
+  801758:	0f 85 6b ff ff ff    	jne    8016c9 <pgfault+0x42>
+  80175e:	eb c8                	jmp    801728 <pgfault+0xa1>
+  801760:	50                   	push   %eax
+  801761:	68 88 22 80 00       	push   $0x802288
+  801766:	6a 31                	push   $0x31
+  801768:	68 60 22 80 00       	push   $0x802260
+  80176d:	e8 9d 04 00 00       	call   801c0f <_panic>
+  801772:	50                   	push   %eax
+  801773:	68 4f 22 80 00       	push   $0x80224f
+  801778:	6a 36                	push   $0x36
+  80177a:	68 60 22 80 00       	push   $0x802260
+  80177f:	e8 8b 04 00 00       	call   801c0f <_panic>
+  801784:	50                   	push   %eax
+  801785:	68 9b 22 80 00       	push   $0x80229b
+  80178a:	6a 38                	push   $0x38
+  80178c:	68 60 22 80 00       	push   $0x802260
+  801791:	e8 79 04 00 00       	call   801c0f <_panic>
+
+00801796 <fork>:
+  801796:	55                   	push   %ebp
+  801797:	89 e5                	mov    %esp,%ebp
+  801799:	53                   	push   %ebx
+  80179a:	83 ec 20             	sub    $0x20,%esp
+  80179d:	68 87 16 80 00       	push   $0x801687
+  8017a2:	e8 b3 04 00 00       	call   801c5a <set_pgfault_handler>
+  8017a7:	83 c4 08             	add    $0x8,%esp
+  8017aa:	6a 01                	push   $0x1
+  8017ac:	6a 00                	push   $0x0
+  8017ae:	e8 d5 f6 ff ff       	call   800e88 <sys_env_set_cow>
+  8017b3:	83 c4 10             	add    $0x10,%esp
+  8017b6:	85 c0                	test   %eax,%eax
+  8017b8:	78 38                	js     8017f2 <fork+0x5c>
+  8017ba:	e8 59 03 00 00       	call   801b18 <bflush>
+  8017bf:	b8 07 00 00 00       	mov    $0x7,%eax
+  8017c4:	cd 30                	int    $0x30
+  8017c6:	89 c3                	mov    %eax,%ebx
+  8017c8:	85 c0                	test   %eax,%eax
+  8017ca:	78 38                	js     801804 <fork+0x6e>
+  8017cc:	ba 00 00 80 00       	mov    $0x800000,%edx
+  8017d1:	75 4f                	jne    801822 <fork+0x8c>
+  8017d3:	e8 a7 02 00 00       	call   801a7f <uinfo_envid>
+  8017d8:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8017dd:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8017e3:	05 00 00 00 ed       	add    $0xed000000,%eax
+  8017e8:	a3 24 30 80 00       	mov    %eax,0x803024
+  8017ed:	e9 c9 00 00 00       	jmp    8018bb <fork+0x125>
+  8017f2:	50                   	push   %eax
+  8017f3:	68 ae 22 80 00       	push   $0x8022ae
+  8017f8:	6a 7c                	push   $0x7c
+  8017fa:	68 60 22 80 00       	push   $0x802260
+  8017ff:	e8 0b 04 00 00       	call   801c0f <_panic>
+  801804:	50                   	push   %eax
+  801805:	68 c2 22 80 00       	push   $0x8022c2
+  80180a:	68 88 00 00 00       	push   $0x88
+  80180f:	68 60 22 80 00       	push   $0x802260
+  801814:	e8 f6 03 00 00       	call   801c0f <_panic>
+  801819:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80181c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801822:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  801825:	81 fa ff ff ff ea    	cmp    $0xeaffffff,%edx
+  80182b:	77 34                	ja     801861 <fork+0xcb>
+  80182d:	81 fa 00 f0 ff ea    	cmp    $0xeafff000,%edx
+  801833:	74 e4                	je     801819 <fork+0x83>
+  801835:	89 d0                	mov    %edx,%eax
+  801837:	c1 e8 16             	shr    $0x16,%eax
+  80183a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801841:	a8 01                	test   $0x1,%al
+  801843:	74 d4                	je     801819 <fork+0x83>
+  801845:	89 d0                	mov    %edx,%eax
+  801847:	c1 e8 0c             	shr    $0xc,%eax
+  80184a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801851:	a8 01                	test   $0x1,%al
+  801853:	74 c4                	je     801819 <fork+0x83>
+  801855:	c1 ea 0c             	shr    $0xc,%edx
+  801858:	89 d8                	mov    %ebx,%eax
+  80185a:	e8 78 fd ff ff       	call   8015d7 <duppage>
+  80185f:	eb b8                	jmp    801819 <fork+0x83>
+  801861:	83 ec 04             	sub    $0x4,%esp
+  801864:	6a 07                	push   $0x7
+  801866:	68 00 f0 ff ea       	push   $0xeafff000
+  80186b:	53                   	push   %ebx
+  80186c:	e8 31 f7 ff ff       	call   800fa2 <sys_page_alloc>
+  801871:	83 c4 10             	add    $0x10,%esp
+  801874:	85 c0                	test   %eax,%eax
+  801876:	78 4a                	js     8018c2 <fork+0x12c>
+  801878:	a1 24 30 80 00       	mov    0x803024,%eax
+  80187d:	8b 40 58             	mov    0x58(%eax),%eax
+  801880:	83 ec 08             	sub    $0x8,%esp
+  801883:	50                   	push   %eax
+  801884:	53                   	push   %ebx
+  801885:	e8 ba f9 ff ff       	call   801244 <sys_env_set_pgfault_upcall>
+  80188a:	83 c4 08             	add    $0x8,%esp
+  80188d:	6a 01                	push   $0x1
+  80188f:	53                   	push   %ebx
+  801890:	e8 f3 f5 ff ff       	call   800e88 <sys_env_set_cow>
+  801895:	83 c4 10             	add    $0x10,%esp
+  801898:	85 c0                	test   %eax,%eax
+  80189a:	78 3b                	js     8018d7 <fork+0x141>
+  80189c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80189f:	c1 ea 0c             	shr    $0xc,%edx
+  8018a2:	89 d8                	mov    %ebx,%eax
+  8018a4:	e8 2e fd ff ff       	call   8015d7 <duppage>
+  8018a9:	83 ec 08             	sub    $0x8,%esp
+  8018ac:	6a 02                	push   $0x2
+  8018ae:	53                   	push   %ebx
+  8018af:	e8 03 f9 ff ff       	call   8011b7 <sys_env_set_status>
+  8018b4:	83 c4 10             	add    $0x10,%esp
+  8018b7:	85 c0                	test   %eax,%eax
+  8018b9:	78 31                	js     8018ec <fork+0x156>
+  8018bb:	89 d8                	mov    %ebx,%eax
+  8018bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018c0:	c9                   	leave
+  8018c1:	c3                   	ret
+  8018c2:	50                   	push   %eax
+  8018c3:	68 88 22 80 00       	push   $0x802288
+  8018c8:	68 a1 00 00 00       	push   $0xa1
+  8018cd:	68 60 22 80 00       	push   $0x802260
+  8018d2:	e8 38 03 00 00       	call   801c0f <_panic>
+  8018d7:	50                   	push   %eax
+  8018d8:	68 ae 22 80 00       	push   $0x8022ae
+  8018dd:	68 a6 00 00 00       	push   $0xa6
+  8018e2:	68 60 22 80 00       	push   $0x802260
+  8018e7:	e8 23 03 00 00       	call   801c0f <_panic>
+  8018ec:	50                   	push   %eax
+  8018ed:	68 d2 22 80 00       	push   $0x8022d2
+  8018f2:	68 ad 00 00 00       	push   $0xad
+  8018f7:	68 60 22 80 00       	push   $0x802260
+  8018fc:	e8 0e 03 00 00       	call   801c0f <_panic>
+
+00801901 <sfork>:
+  801901:	55                   	push   %ebp
+  801902:	89 e5                	mov    %esp,%ebp
+  801904:	83 ec 0c             	sub    $0xc,%esp
+  801907:	68 e9 22 80 00       	push   $0x8022e9
+  80190c:	68 b6 00 00 00       	push   $0xb6
+  801911:	68 60 22 80 00       	push   $0x802260
+  801916:	e8 f4 02 00 00       	call   801c0f <_panic>
+
+0080191b <ipc_recv>:
+  80191b:	55                   	push   %ebp
+  80191c:	89 e5                	mov    %esp,%ebp
+  80191e:	56                   	push   %esi
+  80191f:	53                   	push   %ebx
+  801920:	8b 75 08             	mov    0x8(%ebp),%esi
+  801923:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801926:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801929:	85 c0                	test   %eax,%eax
+  80192b:	74 41                	je     80196e <ipc_recv+0x53>
+  80192d:	83 ec 0c             	sub    $0xc,%esp
+  801930:	50                   	push   %eax
+  801931:	e8 16 fc ff ff       	call   80154c <sys_ipc_recv>
+  801936:	83 c4 10             	add    $0x10,%esp
+  801939:	85 f6                	test   %esi,%esi
+  80193b:	74 17                	je     801954 <ipc_recv+0x39>
+  80193d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801942:	85 c0                	test   %eax,%eax
+  801944:	75 0c                	jne    801952 <ipc_recv+0x37>
+  801946:	8b 15 24 30 80 00    	mov    0x803024,%edx
+  80194c:	8b 92 0c 01 00 00    	mov    0x10c(%edx),%edx
+  801952:	89 16                	mov    %edx,(%esi)
+  801954:	85 db                	test   %ebx,%ebx
+  801956:	74 42                	je     80199a <ipc_recv+0x7f>
+  801958:	85 c0                	test   %eax,%eax
+  80195a:	74 24                	je     801980 <ipc_recv+0x65>
+  80195c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801962:	b8 00 00 00 00       	mov    $0x0,%eax
+  801967:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80196a:	5b                   	pop    %ebx
+  80196b:	5e                   	pop    %esi
+  80196c:	5d                   	pop    %ebp
+  80196d:	c3                   	ret
+  80196e:	83 ec 0c             	sub    $0xc,%esp
+  801971:	68 01 00 00 eb       	push   $0xeb000001
+  801976:	e8 d1 fb ff ff       	call   80154c <sys_ipc_recv>
+  80197b:	83 c4 10             	add    $0x10,%esp
+  80197e:	eb b9                	jmp    801939 <ipc_recv+0x1e>
+  801980:	a1 24 30 80 00       	mov    0x803024,%eax
+  801985:	8b 80 10 01 00 00    	mov    0x110(%eax),%eax
+  80198b:	89 03                	mov    %eax,(%ebx)
+  80198d:	a1 24 30 80 00       	mov    0x803024,%eax
+  801992:	8b 80 08 01 00 00    	mov    0x108(%eax),%eax
+  801998:	eb cd                	jmp    801967 <ipc_recv+0x4c>
+  80199a:	85 c0                	test   %eax,%eax
+  80199c:	74 ef                	je     80198d <ipc_recv+0x72>
+  80199e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a3:	eb c2                	jmp    801967 <ipc_recv+0x4c>
+
+008019a5 <ipc_send>:
+  8019a5:	55                   	push   %ebp
+  8019a6:	89 e5                	mov    %esp,%ebp
+  8019a8:	57                   	push   %edi
+  8019a9:	56                   	push   %esi
+  8019aa:	53                   	push   %ebx
+  8019ab:	83 ec 0c             	sub    $0xc,%esp
+  8019ae:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8019b1:	8b 75 10             	mov    0x10(%ebp),%esi
+  8019b4:	eb 21                	jmp    8019d7 <ipc_send+0x32>
+  8019b6:	ff 75 14             	push   0x14(%ebp)
+  8019b9:	68 01 00 00 eb       	push   $0xeb000001
+  8019be:	ff 75 0c             	push   0xc(%ebp)
+  8019c1:	57                   	push   %edi
+  8019c2:	e8 15 fb ff ff       	call   8014dc <sys_ipc_try_send>
+  8019c7:	89 c3                	mov    %eax,%ebx
+  8019c9:	83 c4 10             	add    $0x10,%esp
+  8019cc:	eb 1f                	jmp    8019ed <ipc_send+0x48>
+  8019ce:	83 fb f9             	cmp    $0xfffffff9,%ebx
+  8019d1:	74 37                	je     801a0a <ipc_send+0x65>
+  8019d3:	85 db                	test   %ebx,%ebx
+  8019d5:	74 3a                	je     801a11 <ipc_send+0x6c>
+  8019d7:	85 f6                	test   %esi,%esi
+  8019d9:	74 db                	je     8019b6 <ipc_send+0x11>
+  8019db:	ff 75 14             	push   0x14(%ebp)
+  8019de:	56                   	push   %esi
+  8019df:	ff 75 0c             	push   0xc(%ebp)
+  8019e2:	57                   	push   %edi
+  8019e3:	e8 f4 fa ff ff       	call   8014dc <sys_ipc_try_send>
+  8019e8:	89 c3                	mov    %eax,%ebx
+  8019ea:	83 c4 10             	add    $0x10,%esp
+  8019ed:	85 db                	test   %ebx,%ebx
+  8019ef:	74 dd                	je     8019ce <ipc_send+0x29>
+  8019f1:	83 fb f9             	cmp    $0xfffffff9,%ebx
+  8019f4:	74 d8                	je     8019ce <ipc_send+0x29>
+  8019f6:	83 ec 04             	sub    $0x4,%esp
+  8019f9:	68 ff 22 80 00       	push   $0x8022ff
+  8019fe:	6a 40                	push   $0x40
+  801a00:	68 12 23 80 00       	push   $0x802312
+  801a05:	e8 05 02 00 00       	call   801c0f <_panic>
+  801a0a:	e8 11 f4 ff ff       	call   800e20 <sys_yield>
+  801a0f:	eb c2                	jmp    8019d3 <ipc_send+0x2e>
+  801a11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a14:	5b                   	pop    %ebx
+  801a15:	5e                   	pop    %esi
+  801a16:	5f                   	pop    %edi
+  801a17:	5d                   	pop    %ebp
+  801a18:	c3                   	ret
+
+00801a19 <ipc_find_env>:
+  801a19:	55                   	push   %ebp
+  801a1a:	89 e5                	mov    %esp,%ebp
+  801a1c:	56                   	push   %esi
+  801a1d:	53                   	push   %ebx
+  801a1e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a21:	b9 7f 03 00 ed       	mov    $0xed00037f,%ecx
+  801a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2b:	89 c3                	mov    %eax,%ebx
+  801a2d:	83 c0 01             	add    $0x1,%eax
+  801a30:	89 ca                	mov    %ecx,%edx
+  801a32:	c1 ea 0c             	shr    $0xc,%edx
+  801a35:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a3c:	f6 c2 01             	test   $0x1,%dl
+  801a3f:	74 35                	je     801a76 <ipc_find_env+0x5d>
+  801a41:	69 d3 80 03 00 00    	imul   $0x380,%ebx,%edx
+  801a47:	81 c2 00 00 00 ed    	add    $0xed000000,%edx
+  801a4d:	8b 52 48             	mov    0x48(%edx),%edx
+  801a50:	81 c1 80 03 00 00    	add    $0x380,%ecx
+  801a56:	39 f2                	cmp    %esi,%edx
+  801a58:	74 0e                	je     801a68 <ipc_find_env+0x4f>
+  801a5a:	3d 00 80 00 00       	cmp    $0x8000,%eax
+  801a5f:	75 ca                	jne    801a2b <ipc_find_env+0x12>
+  801a61:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a66:	eb 13                	jmp    801a7b <ipc_find_env+0x62>
+  801a68:	69 db 80 03 00 00    	imul   $0x380,%ebx,%ebx
+  801a6e:	8b 83 40 00 00 ed    	mov    -0x12ffffc0(%ebx),%eax
+  801a74:	eb 05                	jmp    801a7b <ipc_find_env+0x62>
+  801a76:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a7b:	5b                   	pop    %ebx
+  801a7c:	5e                   	pop    %esi
+  801a7d:	5d                   	pop    %ebp
+  801a7e:	c3                   	ret
+
+00801a7f <uinfo_envid>:
+  801a7f:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  801a84:	c3                   	ret
+
+00801a85 <uinfo_cpunum>:
+  801a85:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  801a8a:	c3                   	ret
+
+00801a8b <uinfo_ticks>:
+  801a8b:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  801a90:	c3                   	ret
+
+00801a91 <uinfo_nsec>:
+  801a91:	55                   	push   %ebp
+  801a92:	89 e5                	mov    %esp,%ebp
+  801a94:	57                   	push   %edi
+  801a95:	56                   	push   %esi
+  801a96:	53                   	push   %ebx
+  801a97:	83 ec 1c             	sub    $0x1c,%esp
+  801a9a:	0f 31                	rdtsc
+  801a9c:	89 c6                	mov    %eax,%esi
+  801a9e:	89 d7                	mov    %edx,%edi
+  801aa0:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aab:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab0:	85 c9                	test   %ecx,%ecx
+  801ab2:	74 5c                	je     801b10 <uinfo_nsec+0x7f>
+  801ab4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801abc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801abf:	52                   	push   %edx
+  801ac0:	51                   	push   %ecx
+  801ac1:	57                   	push   %edi
+  801ac2:	56                   	push   %esi
+  801ac3:	e8 ff 02 00 00       	call   801dc7 <__umoddi3>
+  801ac8:	83 c4 10             	add    $0x10,%esp
+  801acb:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801ad1:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801ad6:	f7 e3                	mul    %ebx
+  801ad8:	01 ca                	add    %ecx,%edx
+  801ada:	ff 75 e4             	push   -0x1c(%ebp)
+  801add:	ff 75 e0             	push   -0x20(%ebp)
+  801ae0:	52                   	push   %edx
+  801ae1:	50                   	push   %eax
+  801ae2:	e8 08 02 00 00       	call   801cef <__udivdi3>
+  801ae7:	83 c4 10             	add    $0x10,%esp
+  801aea:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801aed:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801af0:	ff 75 e4             	push   -0x1c(%ebp)
+  801af3:	ff 75 e0             	push   -0x20(%ebp)
+  801af6:	57                   	push   %edi
+  801af7:	56                   	push   %esi
+  801af8:	e8 f2 01 00 00       	call   801cef <__udivdi3>
+  801afd:	83 c4 10             	add    $0x10,%esp
+  801b00:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801b06:	f7 e3                	mul    %ebx
+  801b08:	01 ca                	add    %ecx,%edx
+  801b0a:	03 45 d8             	add    -0x28(%ebp),%eax
+  801b0d:	13 55 dc             	adc    -0x24(%ebp),%edx
+  801b10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b13:	5b                   	pop    %ebx
+  801b14:	5e                   	pop    %esi
+  801b15:	5f                   	pop    %edi
+  801b16:	5d                   	pop    %ebp
+  801b17:	c3                   	ret
+
+00801b18 <bflush>:
+  801b18:	a1 40 30 80 00       	mov    0x803040,%eax
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	75 01                	jne    801b22 <bflush+0xa>
+  801b21:	c3                   	ret
+  801b22:	55                   	push   %ebp
+  801b23:	89 e5                	mov    %esp,%ebp
+  801b25:	83 ec 10             	sub    $0x10,%esp
+  801b28:	50                   	push   %eax
+  801b29:	68 44 30 80 00       	push   $0x803044
+  801b2e:	e8 2c f1 ff ff       	call   800c5f <sys_cputs>
+  801b33:	c7 05 40 30 80 00 00 	movl   $0x0,0x803040
+  801b3a:	00 00 00 
+  801b3d:	83 c4 10             	add    $0x10,%esp
+  801b40:	c9                   	leave
+  801b41:	c3                   	ret
+
+00801b42 <bputch>:
+  801b42:	55                   	push   %ebp
+  801b43:	89 e5                	mov    %esp,%ebp
+  801b45:	53                   	push   %ebx
+  801b46:	83 ec 04             	sub    $0x4,%esp
+  801b49:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b4c:	8b 15 40 30 80 00    	mov    0x803040,%edx
+  801b52:	8d 42 01             	lea    0x1(%edx),%eax
+  801b55:	a3 40 30 80 00       	mov    %eax,0x803040
+  801b5a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801b5d:	88 8a 44 30 80 00    	mov    %cl,0x803044(%edx)
+  801b63:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b68:	77 08                	ja     801b72 <bputch+0x30>
+  801b6a:	83 03 01             	addl   $0x1,(%ebx)
+  801b6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b70:	c9                   	leave
+  801b71:	c3                   	ret
+  801b72:	e8 a1 ff ff ff       	call   801b18 <bflush>
+  801b77:	eb f1                	jmp    801b6a <bputch+0x28>
+
+00801b79 <vbprintf>:
+  801b79:	55                   	push   %ebp
+  801b7a:	89 e5                	mov    %esp,%ebp
+  801b7c:	83 ec 18             	sub    $0x18,%esp
+  801b7f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801b86:	ff 75 0c             	push   0xc(%ebp)
+  801b89:	ff 75 08             	push   0x8(%ebp)
+  801b8c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b8f:	50                   	push   %eax
+  801b90:	68 42 1b 80 00       	push   $0x801b42
+  801b95:	e8 58 e7 ff ff       	call   8002f2 <vprintfmt>
+  801b9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b9d:	c9                   	leave
+  801b9e:	c3                   	ret
+
+00801b9f <bprintf>:
+  801b9f:	55                   	push   %ebp
+  801ba0:	89 e5                	mov    %esp,%ebp
+  801ba2:	83 ec 10             	sub    $0x10,%esp
+  801ba5:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801ba8:	50                   	push   %eax
+  801ba9:	ff 75 08             	push   0x8(%ebp)
+  801bac:	e8 c8 ff ff ff       	call   801b79 <vbprintf>
+  801bb1:	c9                   	leave
+  801bb2:	c3                   	ret
+
+00801bb3 <bwrite>:
+  801bb3:	55                   	push   %ebp
+  801bb4:	89 e5                	mov    %esp,%ebp
+  801bb6:	53                   	push   %ebx
+  801bb7:	83 ec 04             	sub    $0x4,%esp
+  801bba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801bbd:	89 d8                	mov    %ebx,%eax
+  801bbf:	03 05 40 30 80 00    	add    0x803040,%eax
+  801bc5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bca:	76 0d                	jbe    801bd9 <bwrite+0x26>
+  801bcc:	e8 47 ff ff ff       	call   801b18 <bflush>
+  801bd1:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801bd7:	77 25                	ja     801bfe <bwrite+0x4b>
+  801bd9:	83 ec 04             	sub    $0x4,%esp
+  801bdc:	53                   	push   %ebx
+  801bdd:	ff 75 08             	push   0x8(%ebp)
+  801be0:	a1 40 30 80 00       	mov    0x803040,%eax
+  801be5:	05 44 30 80 00       	add    $0x803044,%eax
+  801bea:	50                   	push   %eax
+  801beb:	e8 6d ee ff ff       	call   800a5d <memcpy>
+  801bf0:	01 1d 40 30 80 00    	add    %ebx,0x803040
+  801bf6:	83 c4 10             	add    $0x10,%esp
+  801bf9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bfc:	c9                   	leave
+  801bfd:	c3                   	ret
+  801bfe:	83 ec 08             	sub    $0x8,%esp
+  801c01:	53                   	push   %ebx
+  801c02:	ff 75 08             	push   0x8(%ebp)
+  801c05:	e8 55 f0 ff ff       	call   800c5f <sys_cputs>
+  801c0a:	83 c4 10             	add    $0x10,%esp
+  801c0d:	eb ea                	jmp    801bf9 <bwrite+0x46>
+
+00801c0f <_panic>:
+  801c0f:	55                   	push   %ebp
+  801c10:	89 e5                	mov    %esp,%ebp
+  801c12:	56                   	push   %esi
+  801c13:	53                   	push   %ebx
+  801c14:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  801c17:	e8 fc fe ff ff       	call   801b18 <bflush>
+  801c1c:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801c22:	e8 91 f1 ff ff       	call   800db8 <sys_getenvid>
+  801c27:	83 ec 0c             	sub    $0xc,%esp
+  801c2a:	ff 75 0c             	push   0xc(%ebp)
+  801c2d:	ff 75 08             	push   0x8(%ebp)
+  801c30:	56                   	push   %esi
+  801c31:	50                   	push   %eax
+  801c32:	68 1c 23 80 00       	push   $0x80231c
+  801c37:	e8 bf e5 ff ff       	call   8001fb <cprintf>
+  801c3c:	83 c4 18             	add    $0x18,%esp
+  801c3f:	53                   	push   %ebx
+  801c40:	ff 75 10             	push   0x10(%ebp)
+  801c43:	e8 62 e5 ff ff       	call   8001aa <vcprintf>
+  801c48:	c7 04 24 98 1f 80 00 	movl   $0x801f98,(%esp)
+  801c4f:	e8 a7 e5 ff ff       	call   8001fb <cprintf>
+  801c54:	83 c4 10             	add    $0x10,%esp
+  801c57:	cc                   	int3
+  801c58:	eb fd                	jmp    801c57 <_panic+0x48>
+
+00801c5a <set_pgfault_handler>:
+  801c5a:	55                   	push   %ebp
+  801c5b:	89 e5                	mov    %esp,%ebp
+  801c5d:	83 ec 08             	sub    $0x8,%esp
+  801c60:	83 3d 44 34 80 00 00 	cmpl   $0x0,0x803444
+  801c67:	74 0a                	je     801c73 <set_pgfault_handler+0x19>
+  801c69:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c6c:	a3 44 34 80 00       	mov    %eax,0x803444
+  801c71:	c9                   	leave
+  801c72:	c3                   	ret
+  801c73:	83 ec 04             	sub    $0x4,%esp
+  801c76:	6a 07                	push   $0x7
+  801c78:	68 00 f0 ff ea       	push   $0xeafff000
+  801c7d:	6a 00                	push   $0x0
+  801c7f:	e8 1e f3 ff ff       	call   800fa2 <sys_page_alloc>
+  801c84:	83 c4 10             	add    $0x10,%esp
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	75 2a                	jne    801cb5 <set_pgfault_handler+0x5b>
+  801c8b:	83 ec 08             	sub    $0x8,%esp
+  801c8e:	68 c9 1c 80 00       	push   $0x801cc9
+  801c93:	6a 00                	push   $0x0
+  801c95:	e8 aa f5 ff ff       	call   801244 <sys_env_set_pgfault_upcall>
+  801c9a:	83 c4 10             	add    $0x10,%esp
+  801c9d:	85 c0                	test   %eax,%eax
+  801c9f:	74 c8                	je     801c69 <set_pgfault_handler+0xf>
+  801ca1:	83 ec 04             	sub    $0x4,%esp
+  801ca4:	68 64 23 80 00       	push   $0x802364
+  801ca9:	6a 28                	push   $0x28
+  801cab:	68 55 23 80 00       	push   $0x802355
+  801cb0:	e8 5a ff ff ff       	call   801c0f <_panic>
+  801cb5:	83 ec 04             	sub    $0x4,%esp
+  801cb8:	68 3f 23 80 00       	push   $0x80233f
+  801cbd:	6a 22                	push   $0x22
+  801cbf:	68 55 23 80 00       	push   $0x802355
+  801cc4:	e8 46 ff ff ff       	call   801c0f <_panic>
+
+00801cc9 <_pgfault_upcall>:
+  801cc9:	54                   	push   %esp
+  801cca:	a1 44 34 80 00       	mov    0x803444,%eax
+  801ccf:	ff d0                	call   *%eax
+  801cd1:	83 c4 04             	add    $0x4,%esp
+  801cd4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  801cd8:	89 e5                	mov    %esp,%ebp
+  801cda:	8b 64 24 30          	mov    0x30(%esp),%esp
+  801cde:	50                   	push   %eax
+  801cdf:	89 ec                	mov    %ebp,%esp
+  801ce1:	83 c4 08             	add    $0x8,%esp
+  801ce4:	61                   	popa
+  801ce5:	83 c4 04             	add    $0x4,%esp
+  801ce8:	9d                   	popf
+  801ce9:	5c                   	pop    %esp
+  801cea:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+  801cee:	c3                   	ret
+
+00801cef <__udivdi3>:
+  801cef:	57                   	push   %edi
+  801cf0:	56                   	push   %esi
+  801cf1:	53                   	push   %ebx
+  801cf2:	83 ec 20             	sub    $0x20,%esp
+  801cf5:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801cf9:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801cfd:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801d01:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801d05:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801d09:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801d0d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801d11:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801d15:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801d19:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801d1d:	89 d1                	mov    %edx,%ecx
+  801d1f:	09 c1                	or     %eax,%ecx
+  801d21:	0f 84 91 00 00 00    	je     801db8 <__udivdi3+0xc9>
+  801d27:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801d2e:	00 
+  801d2f:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801d36:	00 
+  801d37:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d41:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d46:	eb 08                	jmp    801d50 <__udivdi3+0x61>
+  801d48:	83 e9 01             	sub    $0x1,%ecx
+  801d4b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801d4e:	74 68                	je     801db8 <__udivdi3+0xc9>
+  801d50:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801d54:	01 c0                	add    %eax,%eax
+  801d56:	89 c6                	mov    %eax,%esi
+  801d58:	89 d7                	mov    %edx,%edi
+  801d5a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801d5e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801d62:	0f ad d0             	shrd   %cl,%edx,%eax
+  801d65:	d3 ea                	shr    %cl,%edx
+  801d67:	f6 c1 20             	test   $0x20,%cl
+  801d6a:	74 04                	je     801d70 <__udivdi3+0x81>
+  801d6c:	89 d0                	mov    %edx,%eax
+  801d6e:	31 d2                	xor    %edx,%edx
+  801d70:	83 e0 01             	and    $0x1,%eax
+  801d73:	89 04 24             	mov    %eax,(%esp)
+  801d76:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801d7d:	00 
+  801d7e:	8b 04 24             	mov    (%esp),%eax
+  801d81:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801d85:	09 f0                	or     %esi,%eax
+  801d87:	09 fa                	or     %edi,%edx
+  801d89:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801d8d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801d91:	39 f0                	cmp    %esi,%eax
+  801d93:	89 d3                	mov    %edx,%ebx
+  801d95:	19 fb                	sbb    %edi,%ebx
+  801d97:	72 af                	jb     801d48 <__udivdi3+0x59>
+  801d99:	29 f0                	sub    %esi,%eax
+  801d9b:	19 fa                	sbb    %edi,%edx
+  801d9d:	89 cf                	mov    %ecx,%edi
+  801d9f:	c1 ef 05             	shr    $0x5,%edi
+  801da2:	83 e7 01             	and    $0x1,%edi
+  801da5:	89 fe                	mov    %edi,%esi
+  801da7:	83 f6 01             	xor    $0x1,%esi
+  801daa:	d3 e6                	shl    %cl,%esi
+  801dac:	d3 e7                	shl    %cl,%edi
+  801dae:	09 74 24 18          	or     %esi,0x18(%esp)
+  801db2:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  801db6:	eb 90                	jmp    801d48 <__udivdi3+0x59>
+  801db8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801dbc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  801dc0:	83 c4 20             	add    $0x20,%esp
+  801dc3:	5b                   	pop    %ebx
+  801dc4:	5e                   	pop    %esi
+  801dc5:	5f                   	pop    %edi
+  801dc6:	c3                   	ret
+
+00801dc7 <__umoddi3>:
+  801dc7:	55                   	push   %ebp
+  801dc8:	57                   	push   %edi
+  801dc9:	56                   	push   %esi
+  801dca:	53                   	push   %ebx
+  801dcb:	83 ec 1c             	sub    $0x1c,%esp
+  801dce:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801dd2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801dd6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801dda:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801dde:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801de2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801de6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801dea:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801dee:	89 d6                	mov    %edx,%esi
+  801df0:	09 c6                	or     %eax,%esi
+  801df2:	74 6c                	je     801e60 <__umoddi3+0x99>
+  801df4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801df9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e03:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801e07:	eb 0e                	jmp    801e17 <__umoddi3+0x50>
+  801e09:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801e0e:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801e12:	83 fe ff             	cmp    $0xffffffff,%esi
+  801e15:	74 49                	je     801e60 <__umoddi3+0x99>
+  801e17:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801e1b:	01 c0                	add    %eax,%eax
+  801e1d:	89 c3                	mov    %eax,%ebx
+  801e1f:	89 d6                	mov    %edx,%esi
+  801e21:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801e25:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801e29:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801e2e:	0f ad d0             	shrd   %cl,%edx,%eax
+  801e31:	d3 ea                	shr    %cl,%edx
+  801e33:	f6 c1 20             	test   $0x20,%cl
+  801e36:	74 04                	je     801e3c <__umoddi3+0x75>
+  801e38:	89 d0                	mov    %edx,%eax
+  801e3a:	31 d2                	xor    %edx,%edx
+  801e3c:	83 e0 01             	and    $0x1,%eax
+  801e3f:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801e44:	89 ea                	mov    %ebp,%edx
+  801e46:	09 d8                	or     %ebx,%eax
+  801e48:	09 f2                	or     %esi,%edx
+  801e4a:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801e4e:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801e52:	39 d8                	cmp    %ebx,%eax
+  801e54:	89 d1                	mov    %edx,%ecx
+  801e56:	19 f1                	sbb    %esi,%ecx
+  801e58:	72 af                	jb     801e09 <__umoddi3+0x42>
+  801e5a:	29 d8                	sub    %ebx,%eax
+  801e5c:	19 f2                	sbb    %esi,%edx
+  801e5e:	eb a9                	jmp    801e09 <__umoddi3+0x42>
+  801e60:	83 c4 1c             	add    $0x1c,%esp
+  801e63:	5b                   	pop    %ebx
+  801e64:	5e                   	pop    %esi
+  801e65:	5f                   	pop    %edi
+  801e66:	5d                   	pop    %ebp
+  801e67:	c3                   	ret
+
+00801e68 <__divdi3>:
+  801e68:	53                   	push   %ebx
+  801e69:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801e6d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801e71:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801e75:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801e79:	85 d2                	test   %edx,%edx
+  801e7b:	78 12                	js     801e8f <__divdi3+0x27>
+  801e7d:	85 db                	test   %ebx,%ebx
+  801e7f:	78 2e                	js     801eaf <__divdi3+0x47>
+  801e81:	53                   	push   %ebx
+  801e82:	51                   	push   %ecx
+  801e83:	52                   	push   %edx
+  801e84:	50                   	push   %eax
+  801e85:	e8 65 fe ff ff       	call   801cef <__udivdi3>
+  801e8a:	83 c4 10             	add    $0x10,%esp
+  801e8d:	eb 1e                	jmp    801ead <__divdi3+0x45>
+  801e8f:	f7 d8                	neg    %eax
+  801e91:	83 d2 00             	adc    $0x0,%edx
+  801e94:	f7 da                	neg    %edx
+  801e96:	85 db                	test   %ebx,%ebx
+  801e98:	78 2a                	js     801ec4 <__divdi3+0x5c>
+  801e9a:	53                   	push   %ebx
+  801e9b:	51                   	push   %ecx
+  801e9c:	52                   	push   %edx
+  801e9d:	50                   	push   %eax
+  801e9e:	e8 4c fe ff ff       	call   801cef <__udivdi3>
+  801ea3:	83 c4 10             	add    $0x10,%esp
+  801ea6:	f7 d8                	neg    %eax
+  801ea8:	83 d2 00             	adc    $0x0,%edx
+  801eab:	f7 da                	neg    %edx
+  801ead:	5b                   	pop    %ebx
+  801eae:	c3                   	ret
+  801eaf:	f7 d9                	neg    %ecx
+  801eb1:	83 d3 00             	adc    $0x0,%ebx
+  801eb4:	f7 db                	neg    %ebx
+  801eb6:	53                   	push   %ebx
+  801eb7:	51                   	push   %ecx
+  801eb8:	52                   	push   %edx
+  801eb9:	50                   	push   %eax
+  801eba:	e8 30 fe ff ff       	call   801cef <__udivdi3>
+  801ebf:	83 c4 10             	add    $0x10,%esp
+  801ec2:	eb e2                	jmp    801ea6 <__divdi3+0x3e>
+  801ec4:	f7 d9                	neg    %ecx
+  801ec6:	83 d3 00             	adc    $0x0,%ebx
+  801ec9:	f7 db                	neg    %ebx
+  801ecb:	53                   	push   %ebx
+  801ecc:	51                   	push   %ecx
+  801ecd:	52                   	push   %edx
+  801ece:	50                   	push   %eax
+  801ecf:	e8 1b fe ff ff       	call   801cef <__udivdi3>
+  801ed4:	83 c4 10             	add    $0x10,%esp
+  801ed7:	eb d4                	jmp    801ead <__divdi3+0x45>
+
+00801ed9 <__moddi3>:
+  801ed9:	55                   	push   %ebp
+  801eda:	57                   	push   %edi
+  801edb:	56                   	push   %esi
+  801edc:	53                   	push   %ebx
+  801edd:	83 ec 14             	sub    $0x14,%esp
+  801ee0:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801ee4:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801ee8:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801eec:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801ef0:	85 ed                	test   %ebp,%ebp
+  801ef2:	78 2b                	js     801f1f <__moddi3+0x46>
+  801ef4:	89 c6                	mov    %eax,%esi
+  801ef6:	f7 de                	neg    %esi
+  801ef8:	89 34 24             	mov    %esi,(%esp)
+  801efb:	89 d6                	mov    %edx,%esi
+  801efd:	83 d6 00             	adc    $0x0,%esi
+  801f00:	f7 de                	neg    %esi
+  801f02:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801f06:	8b 34 24             	mov    (%esp),%esi
+  801f09:	0f 48 f0             	cmovs  %eax,%esi
+  801f0c:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801f11:	52                   	push   %edx
+  801f12:	56                   	push   %esi
+  801f13:	55                   	push   %ebp
+  801f14:	57                   	push   %edi
+  801f15:	e8 ad fe ff ff       	call   801dc7 <__umoddi3>
+  801f1a:	83 c4 10             	add    $0x10,%esp
+  801f1d:	eb 3c                	jmp    801f5b <__moddi3+0x82>
+  801f1f:	89 c3                	mov    %eax,%ebx
+  801f21:	f7 db                	neg    %ebx
+  801f23:	89 d1                	mov    %edx,%ecx
+  801f25:	83 d1 00             	adc    $0x0,%ecx
+  801f28:	f7 d9                	neg    %ecx
+  801f2a:	0f 49 c3             	cmovns %ebx,%eax
+  801f2d:	89 04 24             	mov    %eax,(%esp)
+  801f30:	0f 49 d1             	cmovns %ecx,%edx
+  801f33:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801f37:	ff 74 24 04          	push   0x4(%esp)
+  801f3b:	ff 74 24 04          	push   0x4(%esp)
+  801f3f:	89 f8                	mov    %edi,%eax
+  801f41:	89 ea                	mov    %ebp,%edx
+  801f43:	f7 d8                	neg    %eax
+  801f45:	83 d2 00             	adc    $0x0,%edx
+  801f48:	f7 da                	neg    %edx
+  801f4a:	52                   	push   %edx
+  801f4b:	50                   	push   %eax
+  801f4c:	e8 76 fe ff ff       	call   801dc7 <__umoddi3>
+  801f51:	83 c4 10             	add    $0x10,%esp
+  801f54:	f7 d8                	neg    %eax
+  801f56:	83 d2 00             	adc    $0x0,%edx
+  801f59:	f7 da                	neg    %edx
+  801f5b:	83 c4 14             	add    $0x14,%esp
+  801f5e:	5b                   	pop    %ebx
+  801f5f:	5e                   	pop    %esi
+  801f60:	5f                   	pop    %edi
+  801f61:	5d                   	pop    %ebp
+  801f62:	c3                   	ret
@@ -0,0 +1,3094 @@
+
+obj/user/primes:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 c3 00 00 00       	call   8000f4 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80003f:	83 ec 04             	sub    $0x4,%esp
+  800042:	6a 00                	push   $0x0
+  800044:	6a 00                	push   $0x0
+  800046:	56                   	push   %esi
+  800047:	e8 0b 19 00 00       	call   801957 <ipc_recv>
+  80004c:	89 c3                	mov    %eax,%ebx
+  80004e:	a1 20 30 80 00       	mov    0x803020,%eax
+  800053:	8b 40 04             	mov    0x4(%eax),%eax
+  800056:	83 c4 0c             	add    $0xc,%esp
+  800059:	53                   	push   %ebx
+  80005a:	50                   	push   %eax
+  80005b:	68 60 1f 80 00       	push   $0x801f60
+  800060:	e8 76 1b 00 00       	call   801bdb <bprintf>
+  800065:	e8 68 17 00 00       	call   8017d2 <fork>
+  80006a:	89 c7                	mov    %eax,%edi
+  80006c:	83 c4 10             	add    $0x10,%esp
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	78 2e                	js     8000a1 <primeproc+0x6e>
+  800073:	74 ca                	je     80003f <primeproc+0xc>
+  800075:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800078:	83 ec 04             	sub    $0x4,%esp
+  80007b:	6a 00                	push   $0x0
+  80007d:	6a 00                	push   $0x0
+  80007f:	56                   	push   %esi
+  800080:	e8 d2 18 00 00       	call   801957 <ipc_recv>
+  800085:	89 c1                	mov    %eax,%ecx
+  800087:	99                   	cltd
+  800088:	f7 fb                	idiv   %ebx
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	85 d2                	test   %edx,%edx
+  80008f:	74 e7                	je     800078 <primeproc+0x45>
+  800091:	6a 00                	push   $0x0
+  800093:	6a 00                	push   $0x0
+  800095:	51                   	push   %ecx
+  800096:	57                   	push   %edi
+  800097:	e8 45 19 00 00       	call   8019e1 <ipc_send>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb d7                	jmp    800078 <primeproc+0x45>
+  8000a1:	50                   	push   %eax
+  8000a2:	68 89 22 80 00       	push   $0x802289
+  8000a7:	6a 1c                	push   $0x1c
+  8000a9:	68 6c 1f 80 00       	push   $0x801f6c
+  8000ae:	e8 a4 00 00 00       	call   800157 <_panic>
+
+008000b3 <umain>:
+  8000b3:	55                   	push   %ebp
+  8000b4:	89 e5                	mov    %esp,%ebp
+  8000b6:	56                   	push   %esi
+  8000b7:	53                   	push   %ebx
+  8000b8:	e8 15 17 00 00       	call   8017d2 <fork>
+  8000bd:	89 c6                	mov    %eax,%esi
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	78 1a                	js     8000dd <umain+0x2a>
+  8000c3:	bb 02 00 00 00       	mov    $0x2,%ebx
+  8000c8:	74 25                	je     8000ef <umain+0x3c>
+  8000ca:	6a 00                	push   $0x0
+  8000cc:	6a 00                	push   $0x0
+  8000ce:	53                   	push   %ebx
+  8000cf:	56                   	push   %esi
+  8000d0:	e8 0c 19 00 00       	call   8019e1 <ipc_send>
+  8000d5:	83 c3 01             	add    $0x1,%ebx
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	eb ed                	jmp    8000ca <umain+0x17>
+  8000dd:	50                   	push   %eax
+  8000de:	68 89 22 80 00       	push   $0x802289
+  8000e3:	6a 2f                	push   $0x2f
+  8000e5:	68 6c 1f 80 00       	push   $0x801f6c
+  8000ea:	e8 68 00 00 00       	call   800157 <_panic>
+  8000ef:	e8 3f ff ff ff       	call   800033 <primeproc>
+
+008000f4 <libmain>:
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	56                   	push   %esi
+  8000f8:	53                   	push   %ebx
+  8000f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000ff:	e8 b7 19 00 00       	call   801abb <uinfo_envid>
+  800104:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  800109:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  80010f:	05 00 00 00 ed       	add    $0xed000000,%eax
+  800114:	a3 20 30 80 00       	mov    %eax,0x803020
+  800119:	85 db                	test   %ebx,%ebx
+  80011b:	7e 07                	jle    800124 <libmain+0x30>
+  80011d:	8b 06                	mov    (%esi),%eax
+  80011f:	a3 00 30 80 00       	mov    %eax,0x803000
+  800124:	83 ec 08             	sub    $0x8,%esp
+  800127:	56                   	push   %esi
+  800128:	53                   	push   %ebx
+  800129:	e8 85 ff ff ff       	call   8000b3 <umain>
+  80012e:	e8 0a 00 00 00       	call   80013d <exit>
+  800133:	83 c4 10             	add    $0x10,%esp
+  800136:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800139:	5b                   	pop    %ebx
+  80013a:	5e                   	pop    %esi
+  80013b:	5d                   	pop    %ebp
+  80013c:	c3                   	ret
+
+0080013d <exit>:
+  80013d:	55                   	push   %ebp
+  80013e:	89 e5                	mov    %esp,%ebp
+  800140:	83 ec 08             	sub    $0x8,%esp
+  800143:	e8 0c 1a 00 00       	call   801b54 <bflush>
+  800148:	83 ec 0c             	sub    $0xc,%esp
+  80014b:	6a 00                	push   $0x0
+  80014d:	e8 17 0c 00 00       	call   800d69 <sys_env_destroy>
+  800152:	83 c4 10             	add    $0x10,%esp
+  800155:	c9                   	leave
+  800156:	c3                   	ret
+
+00800157 <_panic>:
+  800157:	55                   	push   %ebp
+  800158:	89 e5                	mov    %esp,%ebp
+  80015a:	56                   	push   %esi
+  80015b:	53                   	push   %ebx
+  80015c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80015f:	e8 f0 19 00 00       	call   801b54 <bflush>
+  800164:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80016a:	e8 85 0c 00 00       	call   800df4 <sys_getenvid>
+  80016f:	83 ec 0c             	sub    $0xc,%esp
+  800172:	ff 75 0c             	push   0xc(%ebp)
+  800175:	ff 75 08             	push   0x8(%ebp)
+  800178:	56                   	push   %esi
+  800179:	50                   	push   %eax
+  80017a:	68 84 1f 80 00       	push   $0x801f84
+  80017f:	e8 b3 00 00 00       	call   800237 <cprintf>
+  800184:	83 c4 18             	add    $0x18,%esp
+  800187:	53                   	push   %ebx
+  800188:	ff 75 10             	push   0x10(%ebp)
+  80018b:	e8 56 00 00 00       	call   8001e6 <vcprintf>
+  800190:	c7 04 24 a7 1f 80 00 	movl   $0x801fa7,(%esp)
+  800197:	e8 9b 00 00 00       	call   800237 <cprintf>
+  80019c:	83 c4 10             	add    $0x10,%esp
+  80019f:	cc                   	int3
+  8001a0:	eb fd                	jmp    80019f <_panic+0x48>
+
+008001a2 <putch>:
+  8001a2:	55                   	push   %ebp
+  8001a3:	89 e5                	mov    %esp,%ebp
+  8001a5:	53                   	push   %ebx
+  8001a6:	83 ec 04             	sub    $0x4,%esp
+  8001a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001ac:	8b 13                	mov    (%ebx),%edx
+  8001ae:	8d 42 01             	lea    0x1(%edx),%eax
+  8001b1:	89 03                	mov    %eax,(%ebx)
+  8001b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001b6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8001ba:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001bf:	74 09                	je     8001ca <putch+0x28>
+  8001c1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8001c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c8:	c9                   	leave
+  8001c9:	c3                   	ret
+  8001ca:	83 ec 08             	sub    $0x8,%esp
+  8001cd:	68 ff 00 00 00       	push   $0xff
+  8001d2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001d5:	50                   	push   %eax
+  8001d6:	e8 c0 0a 00 00       	call   800c9b <sys_cputs>
+  8001db:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001e1:	83 c4 10             	add    $0x10,%esp
+  8001e4:	eb db                	jmp    8001c1 <putch+0x1f>
+
+008001e6 <vcprintf>:
+  8001e6:	55                   	push   %ebp
+  8001e7:	89 e5                	mov    %esp,%ebp
+  8001e9:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8001ef:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001f6:	00 00 00 
+  8001f9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800200:	00 00 00 
+  800203:	ff 75 0c             	push   0xc(%ebp)
+  800206:	ff 75 08             	push   0x8(%ebp)
+  800209:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80020f:	50                   	push   %eax
+  800210:	68 a2 01 80 00       	push   $0x8001a2
+  800215:	e8 14 01 00 00       	call   80032e <vprintfmt>
+  80021a:	83 c4 08             	add    $0x8,%esp
+  80021d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800223:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800229:	50                   	push   %eax
+  80022a:	e8 6c 0a 00 00       	call   800c9b <sys_cputs>
+  80022f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800235:	c9                   	leave
+  800236:	c3                   	ret
+
+00800237 <cprintf>:
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	83 ec 10             	sub    $0x10,%esp
+  80023d:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800240:	50                   	push   %eax
+  800241:	ff 75 08             	push   0x8(%ebp)
+  800244:	e8 9d ff ff ff       	call   8001e6 <vcprintf>
+  800249:	c9                   	leave
+  80024a:	c3                   	ret
+
+0080024b <printnum>:
+  80024b:	55                   	push   %ebp
+  80024c:	89 e5                	mov    %esp,%ebp
+  80024e:	57                   	push   %edi
+  80024f:	56                   	push   %esi
+  800250:	53                   	push   %ebx
+  800251:	83 ec 1c             	sub    $0x1c,%esp
+  800254:	89 c7                	mov    %eax,%edi
+  800256:	89 d6                	mov    %edx,%esi
+  800258:	8b 45 08             	mov    0x8(%ebp),%eax
+  80025b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80025e:	89 d1                	mov    %edx,%ecx
+  800260:	89 c2                	mov    %eax,%edx
+  800262:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800265:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800268:	8b 45 10             	mov    0x10(%ebp),%eax
+  80026b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80026e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800271:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800278:	39 c2                	cmp    %eax,%edx
+  80027a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80027d:	72 3e                	jb     8002bd <printnum+0x72>
+  80027f:	83 ec 0c             	sub    $0xc,%esp
+  800282:	ff 75 18             	push   0x18(%ebp)
+  800285:	83 eb 01             	sub    $0x1,%ebx
+  800288:	53                   	push   %ebx
+  800289:	50                   	push   %eax
+  80028a:	83 ec 08             	sub    $0x8,%esp
+  80028d:	ff 75 e4             	push   -0x1c(%ebp)
+  800290:	ff 75 e0             	push   -0x20(%ebp)
+  800293:	ff 75 dc             	push   -0x24(%ebp)
+  800296:	ff 75 d8             	push   -0x28(%ebp)
+  800299:	e8 42 1a 00 00       	call   801ce0 <__udivdi3>
+  80029e:	83 c4 18             	add    $0x18,%esp
+  8002a1:	52                   	push   %edx
+  8002a2:	50                   	push   %eax
+  8002a3:	89 f2                	mov    %esi,%edx
+  8002a5:	89 f8                	mov    %edi,%eax
+  8002a7:	e8 9f ff ff ff       	call   80024b <printnum>
+  8002ac:	83 c4 20             	add    $0x20,%esp
+  8002af:	eb 13                	jmp    8002c4 <printnum+0x79>
+  8002b1:	83 ec 08             	sub    $0x8,%esp
+  8002b4:	56                   	push   %esi
+  8002b5:	ff 75 18             	push   0x18(%ebp)
+  8002b8:	ff d7                	call   *%edi
+  8002ba:	83 c4 10             	add    $0x10,%esp
+  8002bd:	83 eb 01             	sub    $0x1,%ebx
+  8002c0:	85 db                	test   %ebx,%ebx
+  8002c2:	7f ed                	jg     8002b1 <printnum+0x66>
+  8002c4:	83 ec 08             	sub    $0x8,%esp
+  8002c7:	56                   	push   %esi
+  8002c8:	83 ec 04             	sub    $0x4,%esp
+  8002cb:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ce:	ff 75 e0             	push   -0x20(%ebp)
+  8002d1:	ff 75 dc             	push   -0x24(%ebp)
+  8002d4:	ff 75 d8             	push   -0x28(%ebp)
+  8002d7:	e8 dc 1a 00 00       	call   801db8 <__umoddi3>
+  8002dc:	83 c4 14             	add    $0x14,%esp
+  8002df:	0f be 80 a9 1f 80 00 	movsbl 0x801fa9(%eax),%eax
+  8002e6:	50                   	push   %eax
+  8002e7:	ff d7                	call   *%edi
+  8002e9:	83 c4 10             	add    $0x10,%esp
+  8002ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ef:	5b                   	pop    %ebx
+  8002f0:	5e                   	pop    %esi
+  8002f1:	5f                   	pop    %edi
+  8002f2:	5d                   	pop    %ebp
+  8002f3:	c3                   	ret
+
+008002f4 <sprintputch>:
+  8002f4:	55                   	push   %ebp
+  8002f5:	89 e5                	mov    %esp,%ebp
+  8002f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002fa:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8002fe:	8b 10                	mov    (%eax),%edx
+  800300:	3b 50 04             	cmp    0x4(%eax),%edx
+  800303:	73 0a                	jae    80030f <sprintputch+0x1b>
+  800305:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800308:	89 08                	mov    %ecx,(%eax)
+  80030a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80030d:	88 02                	mov    %al,(%edx)
+  80030f:	5d                   	pop    %ebp
+  800310:	c3                   	ret
+
+00800311 <printfmt>:
+  800311:	55                   	push   %ebp
+  800312:	89 e5                	mov    %esp,%ebp
+  800314:	83 ec 08             	sub    $0x8,%esp
+  800317:	8d 45 14             	lea    0x14(%ebp),%eax
+  80031a:	50                   	push   %eax
+  80031b:	ff 75 10             	push   0x10(%ebp)
+  80031e:	ff 75 0c             	push   0xc(%ebp)
+  800321:	ff 75 08             	push   0x8(%ebp)
+  800324:	e8 05 00 00 00       	call   80032e <vprintfmt>
+  800329:	83 c4 10             	add    $0x10,%esp
+  80032c:	c9                   	leave
+  80032d:	c3                   	ret
+
+0080032e <vprintfmt>:
+  80032e:	55                   	push   %ebp
+  80032f:	89 e5                	mov    %esp,%ebp
+  800331:	57                   	push   %edi
+  800332:	56                   	push   %esi
+  800333:	53                   	push   %ebx
+  800334:	83 ec 2c             	sub    $0x2c,%esp
+  800337:	8b 75 08             	mov    0x8(%ebp),%esi
+  80033a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80033d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800340:	eb 0a                	jmp    80034c <vprintfmt+0x1e>
+  800342:	83 ec 08             	sub    $0x8,%esp
+  800345:	53                   	push   %ebx
+  800346:	50                   	push   %eax
+  800347:	ff d6                	call   *%esi
+  800349:	83 c4 10             	add    $0x10,%esp
+  80034c:	83 c7 01             	add    $0x1,%edi
+  80034f:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800353:	83 f8 25             	cmp    $0x25,%eax
+  800356:	74 0c                	je     800364 <vprintfmt+0x36>
+  800358:	85 c0                	test   %eax,%eax
+  80035a:	75 e6                	jne    800342 <vprintfmt+0x14>
+  80035c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80035f:	5b                   	pop    %ebx
+  800360:	5e                   	pop    %esi
+  800361:	5f                   	pop    %edi
+  800362:	5d                   	pop    %ebp
+  800363:	c3                   	ret
+  800364:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800368:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80036f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800376:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  80037d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800382:	8d 47 01             	lea    0x1(%edi),%eax
+  800385:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800388:	0f b6 17             	movzbl (%edi),%edx
+  80038b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80038e:	3c 55                	cmp    $0x55,%al
+  800390:	0f 87 cf 03 00 00    	ja     800765 <vprintfmt+0x437>
+  800396:	0f b6 c0             	movzbl %al,%eax
+  800399:	ff 24 85 60 20 80 00 	jmp    *0x802060(,%eax,4)
+  8003a0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003a3:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003a7:	eb d9                	jmp    800382 <vprintfmt+0x54>
+  8003a9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003ac:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003b0:	eb d0                	jmp    800382 <vprintfmt+0x54>
+  8003b2:	0f b6 d2             	movzbl %dl,%edx
+  8003b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bd:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8003c0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003c3:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  8003c7:	0f be 17             	movsbl (%edi),%edx
+  8003ca:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003cd:	83 f9 09             	cmp    $0x9,%ecx
+  8003d0:	77 55                	ja     800427 <vprintfmt+0xf9>
+  8003d2:	83 c7 01             	add    $0x1,%edi
+  8003d5:	eb e9                	jmp    8003c0 <vprintfmt+0x92>
+  8003d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003da:	8b 00                	mov    (%eax),%eax
+  8003dc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8003e5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8003e8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003eb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ef:	79 91                	jns    800382 <vprintfmt+0x54>
+  8003f1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003f4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003f7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003fe:	eb 82                	jmp    800382 <vprintfmt+0x54>
+  800400:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800403:	85 d2                	test   %edx,%edx
+  800405:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040a:	0f 49 c2             	cmovns %edx,%eax
+  80040d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800410:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800413:	e9 6a ff ff ff       	jmp    800382 <vprintfmt+0x54>
+  800418:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80041b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800422:	e9 5b ff ff ff       	jmp    800382 <vprintfmt+0x54>
+  800427:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80042a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80042d:	eb bc                	jmp    8003eb <vprintfmt+0xbd>
+  80042f:	83 c1 01             	add    $0x1,%ecx
+  800432:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800435:	e9 48 ff ff ff       	jmp    800382 <vprintfmt+0x54>
+  80043a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043d:	8d 78 04             	lea    0x4(%eax),%edi
+  800440:	83 ec 08             	sub    $0x8,%esp
+  800443:	53                   	push   %ebx
+  800444:	ff 30                	push   (%eax)
+  800446:	ff d6                	call   *%esi
+  800448:	83 c4 10             	add    $0x10,%esp
+  80044b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80044e:	e9 b1 02 00 00       	jmp    800704 <vprintfmt+0x3d6>
+  800453:	8b 45 14             	mov    0x14(%ebp),%eax
+  800456:	8d 78 04             	lea    0x4(%eax),%edi
+  800459:	8b 10                	mov    (%eax),%edx
+  80045b:	89 d0                	mov    %edx,%eax
+  80045d:	f7 d8                	neg    %eax
+  80045f:	0f 48 c2             	cmovs  %edx,%eax
+  800462:	83 f8 08             	cmp    $0x8,%eax
+  800465:	7f 23                	jg     80048a <vprintfmt+0x15c>
+  800467:	8b 14 85 c0 21 80 00 	mov    0x8021c0(,%eax,4),%edx
+  80046e:	85 d2                	test   %edx,%edx
+  800470:	74 18                	je     80048a <vprintfmt+0x15c>
+  800472:	52                   	push   %edx
+  800473:	68 ca 1f 80 00       	push   $0x801fca
+  800478:	53                   	push   %ebx
+  800479:	56                   	push   %esi
+  80047a:	e8 92 fe ff ff       	call   800311 <printfmt>
+  80047f:	83 c4 10             	add    $0x10,%esp
+  800482:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800485:	e9 7a 02 00 00       	jmp    800704 <vprintfmt+0x3d6>
+  80048a:	50                   	push   %eax
+  80048b:	68 c1 1f 80 00       	push   $0x801fc1
+  800490:	53                   	push   %ebx
+  800491:	56                   	push   %esi
+  800492:	e8 7a fe ff ff       	call   800311 <printfmt>
+  800497:	83 c4 10             	add    $0x10,%esp
+  80049a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80049d:	e9 62 02 00 00       	jmp    800704 <vprintfmt+0x3d6>
+  8004a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a5:	83 c0 04             	add    $0x4,%eax
+  8004a8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ae:	8b 08                	mov    (%eax),%ecx
+  8004b0:	85 c9                	test   %ecx,%ecx
+  8004b2:	b8 ba 1f 80 00       	mov    $0x801fba,%eax
+  8004b7:	0f 45 c1             	cmovne %ecx,%eax
+  8004ba:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004bd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c1:	7e 06                	jle    8004c9 <vprintfmt+0x19b>
+  8004c3:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004c7:	75 0b                	jne    8004d4 <vprintfmt+0x1a6>
+  8004c9:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004cc:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004cf:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004d2:	eb 5c                	jmp    800530 <vprintfmt+0x202>
+  8004d4:	83 ec 08             	sub    $0x8,%esp
+  8004d7:	ff 75 d0             	push   -0x30(%ebp)
+  8004da:	ff 75 cc             	push   -0x34(%ebp)
+  8004dd:	e8 87 03 00 00       	call   800869 <strnlen>
+  8004e2:	89 c2                	mov    %eax,%edx
+  8004e4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e7:	29 d0                	sub    %edx,%eax
+  8004e9:	83 c4 10             	add    $0x10,%esp
+  8004ec:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f3:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004f6:	89 c6                	mov    %eax,%esi
+  8004f8:	eb 0e                	jmp    800508 <vprintfmt+0x1da>
+  8004fa:	83 ec 08             	sub    $0x8,%esp
+  8004fd:	53                   	push   %ebx
+  8004fe:	57                   	push   %edi
+  8004ff:	ff 55 08             	call   *0x8(%ebp)
+  800502:	83 ee 01             	sub    $0x1,%esi
+  800505:	83 c4 10             	add    $0x10,%esp
+  800508:	85 f6                	test   %esi,%esi
+  80050a:	7f ee                	jg     8004fa <vprintfmt+0x1cc>
+  80050c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80050f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800512:	85 c0                	test   %eax,%eax
+  800514:	ba 00 00 00 00       	mov    $0x0,%edx
+  800519:	0f 49 d0             	cmovns %eax,%edx
+  80051c:	29 d0                	sub    %edx,%eax
+  80051e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800521:	eb a6                	jmp    8004c9 <vprintfmt+0x19b>
+  800523:	83 ec 08             	sub    $0x8,%esp
+  800526:	53                   	push   %ebx
+  800527:	52                   	push   %edx
+  800528:	ff 55 08             	call   *0x8(%ebp)
+  80052b:	83 c4 10             	add    $0x10,%esp
+  80052e:	89 f1                	mov    %esi,%ecx
+  800530:	8d 71 01             	lea    0x1(%ecx),%esi
+  800533:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800537:	0f be d0             	movsbl %al,%edx
+  80053a:	85 d2                	test   %edx,%edx
+  80053c:	74 28                	je     800566 <vprintfmt+0x238>
+  80053e:	85 ff                	test   %edi,%edi
+  800540:	78 05                	js     800547 <vprintfmt+0x219>
+  800542:	83 ef 01             	sub    $0x1,%edi
+  800545:	78 30                	js     800577 <vprintfmt+0x249>
+  800547:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80054b:	74 d6                	je     800523 <vprintfmt+0x1f5>
+  80054d:	0f be c0             	movsbl %al,%eax
+  800550:	83 e8 20             	sub    $0x20,%eax
+  800553:	83 f8 5e             	cmp    $0x5e,%eax
+  800556:	76 cb                	jbe    800523 <vprintfmt+0x1f5>
+  800558:	83 ec 08             	sub    $0x8,%esp
+  80055b:	53                   	push   %ebx
+  80055c:	6a 3f                	push   $0x3f
+  80055e:	ff 55 08             	call   *0x8(%ebp)
+  800561:	83 c4 10             	add    $0x10,%esp
+  800564:	eb c8                	jmp    80052e <vprintfmt+0x200>
+  800566:	8b 75 08             	mov    0x8(%ebp),%esi
+  800569:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80056c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80056f:	01 d0                	add    %edx,%eax
+  800571:	29 c8                	sub    %ecx,%eax
+  800573:	89 c7                	mov    %eax,%edi
+  800575:	eb 13                	jmp    80058a <vprintfmt+0x25c>
+  800577:	8b 75 08             	mov    0x8(%ebp),%esi
+  80057a:	eb ed                	jmp    800569 <vprintfmt+0x23b>
+  80057c:	83 ec 08             	sub    $0x8,%esp
+  80057f:	53                   	push   %ebx
+  800580:	6a 20                	push   $0x20
+  800582:	ff d6                	call   *%esi
+  800584:	83 ef 01             	sub    $0x1,%edi
+  800587:	83 c4 10             	add    $0x10,%esp
+  80058a:	85 ff                	test   %edi,%edi
+  80058c:	7f ee                	jg     80057c <vprintfmt+0x24e>
+  80058e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800591:	89 45 14             	mov    %eax,0x14(%ebp)
+  800594:	e9 6b 01 00 00       	jmp    800704 <vprintfmt+0x3d6>
+  800599:	83 f9 01             	cmp    $0x1,%ecx
+  80059c:	7f 1f                	jg     8005bd <vprintfmt+0x28f>
+  80059e:	85 c9                	test   %ecx,%ecx
+  8005a0:	74 67                	je     800609 <vprintfmt+0x2db>
+  8005a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a5:	8b 00                	mov    (%eax),%eax
+  8005a7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005aa:	89 c1                	mov    %eax,%ecx
+  8005ac:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005af:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005bb:	eb 17                	jmp    8005d4 <vprintfmt+0x2a6>
+  8005bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c0:	8b 50 04             	mov    0x4(%eax),%edx
+  8005c3:	8b 00                	mov    (%eax),%eax
+  8005c5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ce:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005da:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005df:	85 c9                	test   %ecx,%ecx
+  8005e1:	0f 89 03 01 00 00    	jns    8006ea <vprintfmt+0x3bc>
+  8005e7:	83 ec 08             	sub    $0x8,%esp
+  8005ea:	53                   	push   %ebx
+  8005eb:	6a 2d                	push   $0x2d
+  8005ed:	ff d6                	call   *%esi
+  8005ef:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005f2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005f5:	f7 da                	neg    %edx
+  8005f7:	83 d1 00             	adc    $0x0,%ecx
+  8005fa:	f7 d9                	neg    %ecx
+  8005fc:	83 c4 10             	add    $0x10,%esp
+  8005ff:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800604:	e9 e1 00 00 00       	jmp    8006ea <vprintfmt+0x3bc>
+  800609:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060c:	8b 00                	mov    (%eax),%eax
+  80060e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800611:	89 c1                	mov    %eax,%ecx
+  800613:	c1 f9 1f             	sar    $0x1f,%ecx
+  800616:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800619:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061c:	8d 40 04             	lea    0x4(%eax),%eax
+  80061f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800622:	eb b0                	jmp    8005d4 <vprintfmt+0x2a6>
+  800624:	83 f9 01             	cmp    $0x1,%ecx
+  800627:	7f 1e                	jg     800647 <vprintfmt+0x319>
+  800629:	85 c9                	test   %ecx,%ecx
+  80062b:	74 32                	je     80065f <vprintfmt+0x331>
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8b 10                	mov    (%eax),%edx
+  800632:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800637:	8d 40 04             	lea    0x4(%eax),%eax
+  80063a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800642:	e9 a3 00 00 00       	jmp    8006ea <vprintfmt+0x3bc>
+  800647:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064a:	8b 10                	mov    (%eax),%edx
+  80064c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80064f:	8d 40 08             	lea    0x8(%eax),%eax
+  800652:	89 45 14             	mov    %eax,0x14(%ebp)
+  800655:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80065a:	e9 8b 00 00 00       	jmp    8006ea <vprintfmt+0x3bc>
+  80065f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800662:	8b 10                	mov    (%eax),%edx
+  800664:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800669:	8d 40 04             	lea    0x4(%eax),%eax
+  80066c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800674:	eb 74                	jmp    8006ea <vprintfmt+0x3bc>
+  800676:	83 f9 01             	cmp    $0x1,%ecx
+  800679:	7f 1b                	jg     800696 <vprintfmt+0x368>
+  80067b:	85 c9                	test   %ecx,%ecx
+  80067d:	74 2c                	je     8006ab <vprintfmt+0x37d>
+  80067f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800682:	8b 10                	mov    (%eax),%edx
+  800684:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800689:	8d 40 04             	lea    0x4(%eax),%eax
+  80068c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068f:	bf 08 00 00 00       	mov    $0x8,%edi
+  800694:	eb 54                	jmp    8006ea <vprintfmt+0x3bc>
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8b 10                	mov    (%eax),%edx
+  80069b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80069e:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8006a9:	eb 3f                	jmp    8006ea <vprintfmt+0x3bc>
+  8006ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ae:	8b 10                	mov    (%eax),%edx
+  8006b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bb:	bf 08 00 00 00       	mov    $0x8,%edi
+  8006c0:	eb 28                	jmp    8006ea <vprintfmt+0x3bc>
+  8006c2:	83 ec 08             	sub    $0x8,%esp
+  8006c5:	53                   	push   %ebx
+  8006c6:	6a 30                	push   $0x30
+  8006c8:	ff d6                	call   *%esi
+  8006ca:	83 c4 08             	add    $0x8,%esp
+  8006cd:	53                   	push   %ebx
+  8006ce:	6a 78                	push   $0x78
+  8006d0:	ff d6                	call   *%esi
+  8006d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d5:	8b 10                	mov    (%eax),%edx
+  8006d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006dc:	83 c4 10             	add    $0x10,%esp
+  8006df:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e5:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006ea:	83 ec 0c             	sub    $0xc,%esp
+  8006ed:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006f1:	50                   	push   %eax
+  8006f2:	ff 75 e0             	push   -0x20(%ebp)
+  8006f5:	57                   	push   %edi
+  8006f6:	51                   	push   %ecx
+  8006f7:	52                   	push   %edx
+  8006f8:	89 da                	mov    %ebx,%edx
+  8006fa:	89 f0                	mov    %esi,%eax
+  8006fc:	e8 4a fb ff ff       	call   80024b <printnum>
+  800701:	83 c4 20             	add    $0x20,%esp
+  800704:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800707:	e9 40 fc ff ff       	jmp    80034c <vprintfmt+0x1e>
+  80070c:	83 f9 01             	cmp    $0x1,%ecx
+  80070f:	7f 1b                	jg     80072c <vprintfmt+0x3fe>
+  800711:	85 c9                	test   %ecx,%ecx
+  800713:	74 2c                	je     800741 <vprintfmt+0x413>
+  800715:	8b 45 14             	mov    0x14(%ebp),%eax
+  800718:	8b 10                	mov    (%eax),%edx
+  80071a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071f:	8d 40 04             	lea    0x4(%eax),%eax
+  800722:	89 45 14             	mov    %eax,0x14(%ebp)
+  800725:	bf 10 00 00 00       	mov    $0x10,%edi
+  80072a:	eb be                	jmp    8006ea <vprintfmt+0x3bc>
+  80072c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072f:	8b 10                	mov    (%eax),%edx
+  800731:	8b 48 04             	mov    0x4(%eax),%ecx
+  800734:	8d 40 08             	lea    0x8(%eax),%eax
+  800737:	89 45 14             	mov    %eax,0x14(%ebp)
+  80073a:	bf 10 00 00 00       	mov    $0x10,%edi
+  80073f:	eb a9                	jmp    8006ea <vprintfmt+0x3bc>
+  800741:	8b 45 14             	mov    0x14(%ebp),%eax
+  800744:	8b 10                	mov    (%eax),%edx
+  800746:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074b:	8d 40 04             	lea    0x4(%eax),%eax
+  80074e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800751:	bf 10 00 00 00       	mov    $0x10,%edi
+  800756:	eb 92                	jmp    8006ea <vprintfmt+0x3bc>
+  800758:	83 ec 08             	sub    $0x8,%esp
+  80075b:	53                   	push   %ebx
+  80075c:	6a 25                	push   $0x25
+  80075e:	ff d6                	call   *%esi
+  800760:	83 c4 10             	add    $0x10,%esp
+  800763:	eb 9f                	jmp    800704 <vprintfmt+0x3d6>
+  800765:	83 ec 08             	sub    $0x8,%esp
+  800768:	53                   	push   %ebx
+  800769:	6a 25                	push   $0x25
+  80076b:	ff d6                	call   *%esi
+  80076d:	83 c4 10             	add    $0x10,%esp
+  800770:	89 f8                	mov    %edi,%eax
+  800772:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800776:	74 05                	je     80077d <vprintfmt+0x44f>
+  800778:	83 e8 01             	sub    $0x1,%eax
+  80077b:	eb f5                	jmp    800772 <vprintfmt+0x444>
+  80077d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800780:	eb 82                	jmp    800704 <vprintfmt+0x3d6>
+
+00800782 <vsnprintf>:
+  800782:	55                   	push   %ebp
+  800783:	89 e5                	mov    %esp,%ebp
+  800785:	83 ec 18             	sub    $0x18,%esp
+  800788:	8b 45 08             	mov    0x8(%ebp),%eax
+  80078b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80078e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800791:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800795:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800798:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  80079f:	85 c0                	test   %eax,%eax
+  8007a1:	74 26                	je     8007c9 <vsnprintf+0x47>
+  8007a3:	85 d2                	test   %edx,%edx
+  8007a5:	7e 22                	jle    8007c9 <vsnprintf+0x47>
+  8007a7:	ff 75 14             	push   0x14(%ebp)
+  8007aa:	ff 75 10             	push   0x10(%ebp)
+  8007ad:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007b0:	50                   	push   %eax
+  8007b1:	68 f4 02 80 00       	push   $0x8002f4
+  8007b6:	e8 73 fb ff ff       	call   80032e <vprintfmt>
+  8007bb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007be:	c6 00 00             	movb   $0x0,(%eax)
+  8007c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007c4:	83 c4 10             	add    $0x10,%esp
+  8007c7:	c9                   	leave
+  8007c8:	c3                   	ret
+  8007c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007ce:	eb f7                	jmp    8007c7 <vsnprintf+0x45>
+
+008007d0 <snprintf>:
+  8007d0:	55                   	push   %ebp
+  8007d1:	89 e5                	mov    %esp,%ebp
+  8007d3:	83 ec 08             	sub    $0x8,%esp
+  8007d6:	8d 45 14             	lea    0x14(%ebp),%eax
+  8007d9:	50                   	push   %eax
+  8007da:	ff 75 10             	push   0x10(%ebp)
+  8007dd:	ff 75 0c             	push   0xc(%ebp)
+  8007e0:	ff 75 08             	push   0x8(%ebp)
+  8007e3:	e8 9a ff ff ff       	call   800782 <vsnprintf>
+  8007e8:	c9                   	leave
+  8007e9:	c3                   	ret
+
+008007ea <copy_fwd>:
+  8007ea:	55                   	push   %ebp
+  8007eb:	89 e5                	mov    %esp,%ebp
+  8007ed:	57                   	push   %edi
+  8007ee:	56                   	push   %esi
+  8007ef:	53                   	push   %ebx
+  8007f0:	89 c7                	mov    %eax,%edi
+  8007f2:	89 d6                	mov    %edx,%esi
+  8007f4:	89 c8                	mov    %ecx,%eax
+  8007f6:	83 f9 0f             	cmp    $0xf,%ecx
+  8007f9:	76 1c                	jbe    800817 <copy_fwd+0x2d>
+  8007fb:	89 f9                	mov    %edi,%ecx
+  8007fd:	f7 d9                	neg    %ecx
+  8007ff:	89 cb                	mov    %ecx,%ebx
+  800801:	83 e3 03             	and    $0x3,%ebx
+  800804:	29 d8                	sub    %ebx,%eax
+  800806:	89 c2                	mov    %eax,%edx
+  800808:	c1 ea 02             	shr    $0x2,%edx
+  80080b:	83 e0 03             	and    $0x3,%eax
+  80080e:	89 d9                	mov    %ebx,%ecx
+  800810:	fc                   	cld
+  800811:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800813:	89 d1                	mov    %edx,%ecx
+  800815:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800817:	89 c1                	mov    %eax,%ecx
+  800819:	fc                   	cld
+  80081a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80081c:	5b                   	pop    %ebx
+  80081d:	5e                   	pop    %esi
+  80081e:	5f                   	pop    %edi
+  80081f:	5d                   	pop    %ebp
+  800820:	c3                   	ret
+
+00800821 <have_sse2>:
+  800821:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800828:	78 06                	js     800830 <have_sse2+0xf>
+  80082a:	a1 04 30 80 00       	mov    0x803004,%eax
+  80082f:	c3                   	ret
+  800830:	55                   	push   %ebp
+  800831:	89 e5                	mov    %esp,%ebp
+  800833:	53                   	push   %ebx
+  800834:	b8 01 00 00 00       	mov    $0x1,%eax
+  800839:	0f a2                	cpuid
+  80083b:	c1 ea 1a             	shr    $0x1a,%edx
+  80083e:	83 e2 01             	and    $0x1,%edx
+  800841:	89 15 04 30 80 00    	mov    %edx,0x803004
+  800847:	a1 04 30 80 00       	mov    0x803004,%eax
+  80084c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80084f:	c9                   	leave
+  800850:	c3                   	ret
+
+00800851 <strlen>:
+  800851:	55                   	push   %ebp
+  800852:	89 e5                	mov    %esp,%ebp
+  800854:	8b 55 08             	mov    0x8(%ebp),%edx
+  800857:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085c:	eb 03                	jmp    800861 <strlen+0x10>
+  80085e:	83 c0 01             	add    $0x1,%eax
+  800861:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800865:	75 f7                	jne    80085e <strlen+0xd>
+  800867:	5d                   	pop    %ebp
+  800868:	c3                   	ret
+
+00800869 <strnlen>:
+  800869:	55                   	push   %ebp
+  80086a:	89 e5                	mov    %esp,%ebp
+  80086c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80086f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800872:	b8 00 00 00 00       	mov    $0x0,%eax
+  800877:	eb 03                	jmp    80087c <strnlen+0x13>
+  800879:	83 c0 01             	add    $0x1,%eax
+  80087c:	39 d0                	cmp    %edx,%eax
+  80087e:	74 08                	je     800888 <strnlen+0x1f>
+  800880:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800884:	75 f3                	jne    800879 <strnlen+0x10>
+  800886:	89 c2                	mov    %eax,%edx
+  800888:	89 d0                	mov    %edx,%eax
+  80088a:	5d                   	pop    %ebp
+  80088b:	c3                   	ret
+
+0080088c <strcpy>:
+  80088c:	55                   	push   %ebp
+  80088d:	89 e5                	mov    %esp,%ebp
+  80088f:	53                   	push   %ebx
+  800890:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800893:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800896:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80089f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008a2:	83 c0 01             	add    $0x1,%eax
+  8008a5:	84 d2                	test   %dl,%dl
+  8008a7:	75 f2                	jne    80089b <strcpy+0xf>
+  8008a9:	89 c8                	mov    %ecx,%eax
+  8008ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ae:	c9                   	leave
+  8008af:	c3                   	ret
+
+008008b0 <strcat>:
+  8008b0:	55                   	push   %ebp
+  8008b1:	89 e5                	mov    %esp,%ebp
+  8008b3:	53                   	push   %ebx
+  8008b4:	83 ec 10             	sub    $0x10,%esp
+  8008b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8008ba:	53                   	push   %ebx
+  8008bb:	e8 91 ff ff ff       	call   800851 <strlen>
+  8008c0:	83 c4 08             	add    $0x8,%esp
+  8008c3:	ff 75 0c             	push   0xc(%ebp)
+  8008c6:	01 d8                	add    %ebx,%eax
+  8008c8:	50                   	push   %eax
+  8008c9:	e8 be ff ff ff       	call   80088c <strcpy>
+  8008ce:	89 d8                	mov    %ebx,%eax
+  8008d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d3:	c9                   	leave
+  8008d4:	c3                   	ret
+
+008008d5 <strncpy>:
+  8008d5:	55                   	push   %ebp
+  8008d6:	89 e5                	mov    %esp,%ebp
+  8008d8:	56                   	push   %esi
+  8008d9:	53                   	push   %ebx
+  8008da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008e0:	89 f3                	mov    %esi,%ebx
+  8008e2:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008e5:	89 f0                	mov    %esi,%eax
+  8008e7:	eb 0f                	jmp    8008f8 <strncpy+0x23>
+  8008e9:	83 c0 01             	add    $0x1,%eax
+  8008ec:	0f b6 0a             	movzbl (%edx),%ecx
+  8008ef:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8008f2:	80 f9 01             	cmp    $0x1,%cl
+  8008f5:	83 da ff             	sbb    $0xffffffff,%edx
+  8008f8:	39 d8                	cmp    %ebx,%eax
+  8008fa:	75 ed                	jne    8008e9 <strncpy+0x14>
+  8008fc:	89 f0                	mov    %esi,%eax
+  8008fe:	5b                   	pop    %ebx
+  8008ff:	5e                   	pop    %esi
+  800900:	5d                   	pop    %ebp
+  800901:	c3                   	ret
+
+00800902 <strlcpy>:
+  800902:	55                   	push   %ebp
+  800903:	89 e5                	mov    %esp,%ebp
+  800905:	56                   	push   %esi
+  800906:	53                   	push   %ebx
+  800907:	8b 75 08             	mov    0x8(%ebp),%esi
+  80090a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80090d:	8b 55 10             	mov    0x10(%ebp),%edx
+  800910:	89 f0                	mov    %esi,%eax
+  800912:	85 d2                	test   %edx,%edx
+  800914:	74 21                	je     800937 <strlcpy+0x35>
+  800916:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80091a:	89 f2                	mov    %esi,%edx
+  80091c:	eb 09                	jmp    800927 <strlcpy+0x25>
+  80091e:	83 c1 01             	add    $0x1,%ecx
+  800921:	83 c2 01             	add    $0x1,%edx
+  800924:	88 5a ff             	mov    %bl,-0x1(%edx)
+  800927:	39 c2                	cmp    %eax,%edx
+  800929:	74 09                	je     800934 <strlcpy+0x32>
+  80092b:	0f b6 19             	movzbl (%ecx),%ebx
+  80092e:	84 db                	test   %bl,%bl
+  800930:	75 ec                	jne    80091e <strlcpy+0x1c>
+  800932:	89 d0                	mov    %edx,%eax
+  800934:	c6 00 00             	movb   $0x0,(%eax)
+  800937:	29 f0                	sub    %esi,%eax
+  800939:	5b                   	pop    %ebx
+  80093a:	5e                   	pop    %esi
+  80093b:	5d                   	pop    %ebp
+  80093c:	c3                   	ret
+
+0080093d <strcmp>:
+  80093d:	55                   	push   %ebp
+  80093e:	89 e5                	mov    %esp,%ebp
+  800940:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800943:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800946:	eb 06                	jmp    80094e <strcmp+0x11>
+  800948:	83 c1 01             	add    $0x1,%ecx
+  80094b:	83 c2 01             	add    $0x1,%edx
+  80094e:	0f b6 01             	movzbl (%ecx),%eax
+  800951:	84 c0                	test   %al,%al
+  800953:	74 04                	je     800959 <strcmp+0x1c>
+  800955:	3a 02                	cmp    (%edx),%al
+  800957:	74 ef                	je     800948 <strcmp+0xb>
+  800959:	0f b6 c0             	movzbl %al,%eax
+  80095c:	0f b6 12             	movzbl (%edx),%edx
+  80095f:	29 d0                	sub    %edx,%eax
+  800961:	5d                   	pop    %ebp
+  800962:	c3                   	ret
+
+00800963 <strncmp>:
+  800963:	55                   	push   %ebp
+  800964:	89 e5                	mov    %esp,%ebp
+  800966:	53                   	push   %ebx
+  800967:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80096d:	8b 55 10             	mov    0x10(%ebp),%edx
+  800970:	eb 09                	jmp    80097b <strncmp+0x18>
+  800972:	83 ea 01             	sub    $0x1,%edx
+  800975:	83 c0 01             	add    $0x1,%eax
+  800978:	83 c1 01             	add    $0x1,%ecx
+  80097b:	85 d2                	test   %edx,%edx
+  80097d:	74 18                	je     800997 <strncmp+0x34>
+  80097f:	0f b6 18             	movzbl (%eax),%ebx
+  800982:	84 db                	test   %bl,%bl
+  800984:	74 04                	je     80098a <strncmp+0x27>
+  800986:	3a 19                	cmp    (%ecx),%bl
+  800988:	74 e8                	je     800972 <strncmp+0xf>
+  80098a:	0f b6 00             	movzbl (%eax),%eax
+  80098d:	0f b6 11             	movzbl (%ecx),%edx
+  800990:	29 d0                	sub    %edx,%eax
+  800992:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800995:	c9                   	leave
+  800996:	c3                   	ret
+  800997:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099c:	eb f4                	jmp    800992 <strncmp+0x2f>
+
+0080099e <strchr>:
+  80099e:	55                   	push   %ebp
+  80099f:	89 e5                	mov    %esp,%ebp
+  8009a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8009a8:	eb 03                	jmp    8009ad <strchr+0xf>
+  8009aa:	83 c0 01             	add    $0x1,%eax
+  8009ad:	0f b6 10             	movzbl (%eax),%edx
+  8009b0:	84 d2                	test   %dl,%dl
+  8009b2:	74 06                	je     8009ba <strchr+0x1c>
+  8009b4:	38 ca                	cmp    %cl,%dl
+  8009b6:	75 f2                	jne    8009aa <strchr+0xc>
+  8009b8:	eb 05                	jmp    8009bf <strchr+0x21>
+  8009ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009bf:	5d                   	pop    %ebp
+  8009c0:	c3                   	ret
+
+008009c1 <strfind>:
+  8009c1:	55                   	push   %ebp
+  8009c2:	89 e5                	mov    %esp,%ebp
+  8009c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8009cb:	0f b6 10             	movzbl (%eax),%edx
+  8009ce:	38 ca                	cmp    %cl,%dl
+  8009d0:	74 09                	je     8009db <strfind+0x1a>
+  8009d2:	84 d2                	test   %dl,%dl
+  8009d4:	74 05                	je     8009db <strfind+0x1a>
+  8009d6:	83 c0 01             	add    $0x1,%eax
+  8009d9:	eb f0                	jmp    8009cb <strfind+0xa>
+  8009db:	5d                   	pop    %ebp
+  8009dc:	c3                   	ret
+
+008009dd <memset>:
+  8009dd:	55                   	push   %ebp
+  8009de:	89 e5                	mov    %esp,%ebp
+  8009e0:	57                   	push   %edi
+  8009e1:	56                   	push   %esi
+  8009e2:	53                   	push   %ebx
+  8009e3:	83 ec 04             	sub    $0x4,%esp
+  8009e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009e9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009ec:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  8009f0:	89 f7                	mov    %esi,%edi
+  8009f2:	83 fa 0f             	cmp    $0xf,%edx
+  8009f5:	76 24                	jbe    800a1b <memset+0x3e>
+  8009f7:	89 f1                	mov    %esi,%ecx
+  8009f9:	f7 d9                	neg    %ecx
+  8009fb:	83 e1 03             	and    $0x3,%ecx
+  8009fe:	29 ca                	sub    %ecx,%edx
+  800a00:	89 d0                	mov    %edx,%eax
+  800a02:	c1 e8 02             	shr    $0x2,%eax
+  800a05:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  800a08:	83 e2 03             	and    $0x3,%edx
+  800a0b:	89 d8                	mov    %ebx,%eax
+  800a0d:	fc                   	cld
+  800a0e:	f3 aa                	rep stos %al,%es:(%edi)
+  800a10:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  800a16:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  800a19:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a1b:	89 d1                	mov    %edx,%ecx
+  800a1d:	89 d8                	mov    %ebx,%eax
+  800a1f:	fc                   	cld
+  800a20:	f3 aa                	rep stos %al,%es:(%edi)
+  800a22:	89 f0                	mov    %esi,%eax
+  800a24:	83 c4 04             	add    $0x4,%esp
+  800a27:	5b                   	pop    %ebx
+  800a28:	5e                   	pop    %esi
+  800a29:	5f                   	pop    %edi
+  800a2a:	5d                   	pop    %ebp
+  800a2b:	c3                   	ret
+
+00800a2c <memmove>:
+  800a2c:	55                   	push   %ebp
+  800a2d:	89 e5                	mov    %esp,%ebp
+  800a2f:	57                   	push   %edi
+  800a30:	56                   	push   %esi
+  800a31:	53                   	push   %ebx
+  800a32:	83 ec 0c             	sub    $0xc,%esp
+  800a35:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a38:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a3b:	8b 45 10             	mov    0x10(%ebp),%eax
+  800a3e:	85 c0                	test   %eax,%eax
+  800a40:	74 14                	je     800a56 <memmove+0x2a>
+  800a42:	39 da                	cmp    %ebx,%edx
+  800a44:	73 07                	jae    800a4d <memmove+0x21>
+  800a46:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  800a49:	39 cb                	cmp    %ecx,%ebx
+  800a4b:	72 13                	jb     800a60 <memmove+0x34>
+  800a4d:	89 c1                	mov    %eax,%ecx
+  800a4f:	89 d8                	mov    %ebx,%eax
+  800a51:	e8 94 fd ff ff       	call   8007ea <copy_fwd>
+  800a56:	89 d8                	mov    %ebx,%eax
+  800a58:	83 c4 0c             	add    $0xc,%esp
+  800a5b:	5b                   	pop    %ebx
+  800a5c:	5e                   	pop    %esi
+  800a5d:	5f                   	pop    %edi
+  800a5e:	5d                   	pop    %ebp
+  800a5f:	c3                   	ret
+  800a60:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800a63:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800a66:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800a69:	83 f8 0f             	cmp    $0xf,%eax
+  800a6c:	76 23                	jbe    800a91 <memmove+0x65>
+  800a6e:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800a71:	83 e1 03             	and    $0x3,%ecx
+  800a74:	29 c8                	sub    %ecx,%eax
+  800a76:	89 c2                	mov    %eax,%edx
+  800a78:	c1 ea 02             	shr    $0x2,%edx
+  800a7b:	83 e0 03             	and    $0x3,%eax
+  800a7e:	fd                   	std
+  800a7f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a81:	83 ef 03             	sub    $0x3,%edi
+  800a84:	83 ee 03             	sub    $0x3,%esi
+  800a87:	89 d1                	mov    %edx,%ecx
+  800a89:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a8b:	83 c7 03             	add    $0x3,%edi
+  800a8e:	83 c6 03             	add    $0x3,%esi
+  800a91:	89 c1                	mov    %eax,%ecx
+  800a93:	fd                   	std
+  800a94:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a96:	fc                   	cld
+  800a97:	eb bd                	jmp    800a56 <memmove+0x2a>
+
+00800a99 <memcpy>:
+  800a99:	55                   	push   %ebp
+  800a9a:	89 e5                	mov    %esp,%ebp
+  800a9c:	53                   	push   %ebx
+  800a9d:	83 ec 04             	sub    $0x4,%esp
+  800aa0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800aa3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800aa6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aa9:	89 d8                	mov    %ebx,%eax
+  800aab:	e8 3a fd ff ff       	call   8007ea <copy_fwd>
+  800ab0:	89 d8                	mov    %ebx,%eax
+  800ab2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ab5:	c9                   	leave
+  800ab6:	c3                   	ret
+
+00800ab7 <page_copy>:
+  800ab7:	55                   	push   %ebp
+  800ab8:	89 e5                	mov    %esp,%ebp
+  800aba:	57                   	push   %edi
+  800abb:	56                   	push   %esi
+  800abc:	53                   	push   %ebx
+  800abd:	83 ec 0c             	sub    $0xc,%esp
+  800ac0:	e8 5c fd ff ff       	call   800821 <have_sse2>
+  800ac5:	85 c0                	test   %eax,%eax
+  800ac7:	74 39                	je     800b02 <page_copy+0x4b>
+  800ac9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800acc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800acf:	be 00 01 00 00       	mov    $0x100,%esi
+  800ad4:	8b 03                	mov    (%ebx),%eax
+  800ad6:	8b 53 04             	mov    0x4(%ebx),%edx
+  800ad9:	0f c3 01             	movnti %eax,(%ecx)
+  800adc:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800ae0:	8b 43 08             	mov    0x8(%ebx),%eax
+  800ae3:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800ae6:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800aea:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800aee:	83 c3 10             	add    $0x10,%ebx
+  800af1:	83 c1 10             	add    $0x10,%ecx
+  800af4:	4e                   	dec    %esi
+  800af5:	75 dd                	jne    800ad4 <page_copy+0x1d>
+  800af7:	0f ae f8             	sfence
+  800afa:	83 c4 0c             	add    $0xc,%esp
+  800afd:	5b                   	pop    %ebx
+  800afe:	5e                   	pop    %esi
+  800aff:	5f                   	pop    %edi
+  800b00:	5d                   	pop    %ebp
+  800b01:	c3                   	ret
+  800b02:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b05:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b08:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800b0d:	fc                   	cld
+  800b0e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b10:	eb e8                	jmp    800afa <page_copy+0x43>
+
+00800b12 <page_zero>:
+  800b12:	55                   	push   %ebp
+  800b13:	89 e5                	mov    %esp,%ebp
+  800b15:	57                   	push   %edi
+  800b16:	83 ec 04             	sub    $0x4,%esp
+  800b19:	e8 03 fd ff ff       	call   800821 <have_sse2>
+  800b1e:	85 c0                	test   %eax,%eax
+  800b20:	74 3a                	je     800b5c <page_zero+0x4a>
+  800b22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b25:	ba 80 00 00 00       	mov    $0x80,%edx
+  800b2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b2f:	0f c3 08             	movnti %ecx,(%eax)
+  800b32:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800b36:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800b3a:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800b3e:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800b42:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800b46:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800b4a:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800b4e:	83 c0 20             	add    $0x20,%eax
+  800b51:	4a                   	dec    %edx
+  800b52:	75 db                	jne    800b2f <page_zero+0x1d>
+  800b54:	0f ae f8             	sfence
+  800b57:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b5a:	c9                   	leave
+  800b5b:	c3                   	ret
+  800b5c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b5f:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800b64:	fc                   	cld
+  800b65:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b67:	eb ee                	jmp    800b57 <page_zero+0x45>
+
+00800b69 <memcmp>:
+  800b69:	55                   	push   %ebp
+  800b6a:	89 e5                	mov    %esp,%ebp
+  800b6c:	56                   	push   %esi
+  800b6d:	53                   	push   %ebx
+  800b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b71:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b74:	89 c6                	mov    %eax,%esi
+  800b76:	03 75 10             	add    0x10(%ebp),%esi
+  800b79:	eb 06                	jmp    800b81 <memcmp+0x18>
+  800b7b:	83 c0 01             	add    $0x1,%eax
+  800b7e:	83 c2 01             	add    $0x1,%edx
+  800b81:	39 f0                	cmp    %esi,%eax
+  800b83:	74 14                	je     800b99 <memcmp+0x30>
+  800b85:	0f b6 08             	movzbl (%eax),%ecx
+  800b88:	0f b6 1a             	movzbl (%edx),%ebx
+  800b8b:	38 d9                	cmp    %bl,%cl
+  800b8d:	74 ec                	je     800b7b <memcmp+0x12>
+  800b8f:	0f b6 c1             	movzbl %cl,%eax
+  800b92:	0f b6 db             	movzbl %bl,%ebx
+  800b95:	29 d8                	sub    %ebx,%eax
+  800b97:	eb 05                	jmp    800b9e <memcmp+0x35>
+  800b99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9e:	5b                   	pop    %ebx
+  800b9f:	5e                   	pop    %esi
+  800ba0:	5d                   	pop    %ebp
+  800ba1:	c3                   	ret
+
+00800ba2 <memfind>:
+  800ba2:	55                   	push   %ebp
+  800ba3:	89 e5                	mov    %esp,%ebp
+  800ba5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ba8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bab:	89 c2                	mov    %eax,%edx
+  800bad:	03 55 10             	add    0x10(%ebp),%edx
+  800bb0:	eb 03                	jmp    800bb5 <memfind+0x13>
+  800bb2:	83 c0 01             	add    $0x1,%eax
+  800bb5:	39 d0                	cmp    %edx,%eax
+  800bb7:	73 04                	jae    800bbd <memfind+0x1b>
+  800bb9:	38 08                	cmp    %cl,(%eax)
+  800bbb:	75 f5                	jne    800bb2 <memfind+0x10>
+  800bbd:	5d                   	pop    %ebp
+  800bbe:	c3                   	ret
+
+00800bbf <strtol>:
+  800bbf:	55                   	push   %ebp
+  800bc0:	89 e5                	mov    %esp,%ebp
+  800bc2:	57                   	push   %edi
+  800bc3:	56                   	push   %esi
+  800bc4:	53                   	push   %ebx
+  800bc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bcb:	eb 03                	jmp    800bd0 <strtol+0x11>
+  800bcd:	83 c2 01             	add    $0x1,%edx
+  800bd0:	0f b6 02             	movzbl (%edx),%eax
+  800bd3:	3c 20                	cmp    $0x20,%al
+  800bd5:	74 f6                	je     800bcd <strtol+0xe>
+  800bd7:	3c 09                	cmp    $0x9,%al
+  800bd9:	74 f2                	je     800bcd <strtol+0xe>
+  800bdb:	3c 2b                	cmp    $0x2b,%al
+  800bdd:	74 2a                	je     800c09 <strtol+0x4a>
+  800bdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800be4:	3c 2d                	cmp    $0x2d,%al
+  800be6:	74 2b                	je     800c13 <strtol+0x54>
+  800be8:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bee:	75 0f                	jne    800bff <strtol+0x40>
+  800bf0:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bf3:	74 28                	je     800c1d <strtol+0x5e>
+  800bf5:	85 db                	test   %ebx,%ebx
+  800bf7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bfc:	0f 44 d8             	cmove  %eax,%ebx
+  800bff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c04:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c07:	eb 46                	jmp    800c4f <strtol+0x90>
+  800c09:	83 c2 01             	add    $0x1,%edx
+  800c0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c11:	eb d5                	jmp    800be8 <strtol+0x29>
+  800c13:	83 c2 01             	add    $0x1,%edx
+  800c16:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c1b:	eb cb                	jmp    800be8 <strtol+0x29>
+  800c1d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c21:	74 0e                	je     800c31 <strtol+0x72>
+  800c23:	85 db                	test   %ebx,%ebx
+  800c25:	75 d8                	jne    800bff <strtol+0x40>
+  800c27:	83 c2 01             	add    $0x1,%edx
+  800c2a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c2f:	eb ce                	jmp    800bff <strtol+0x40>
+  800c31:	83 c2 02             	add    $0x2,%edx
+  800c34:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c39:	eb c4                	jmp    800bff <strtol+0x40>
+  800c3b:	0f be c0             	movsbl %al,%eax
+  800c3e:	83 e8 30             	sub    $0x30,%eax
+  800c41:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c44:	7d 3a                	jge    800c80 <strtol+0xc1>
+  800c46:	83 c2 01             	add    $0x1,%edx
+  800c49:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c4d:	01 c1                	add    %eax,%ecx
+  800c4f:	0f b6 02             	movzbl (%edx),%eax
+  800c52:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c55:	89 f3                	mov    %esi,%ebx
+  800c57:	80 fb 09             	cmp    $0x9,%bl
+  800c5a:	76 df                	jbe    800c3b <strtol+0x7c>
+  800c5c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c5f:	89 f3                	mov    %esi,%ebx
+  800c61:	80 fb 19             	cmp    $0x19,%bl
+  800c64:	77 08                	ja     800c6e <strtol+0xaf>
+  800c66:	0f be c0             	movsbl %al,%eax
+  800c69:	83 e8 57             	sub    $0x57,%eax
+  800c6c:	eb d3                	jmp    800c41 <strtol+0x82>
+  800c6e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c71:	89 f3                	mov    %esi,%ebx
+  800c73:	80 fb 19             	cmp    $0x19,%bl
+  800c76:	77 08                	ja     800c80 <strtol+0xc1>
+  800c78:	0f be c0             	movsbl %al,%eax
+  800c7b:	83 e8 37             	sub    $0x37,%eax
+  800c7e:	eb c1                	jmp    800c41 <strtol+0x82>
+  800c80:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c84:	74 05                	je     800c8b <strtol+0xcc>
+  800c86:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c89:	89 10                	mov    %edx,(%eax)
+  800c8b:	89 c8                	mov    %ecx,%eax
+  800c8d:	f7 d8                	neg    %eax
+  800c8f:	85 ff                	test   %edi,%edi
+  800c91:	0f 45 c8             	cmovne %eax,%ecx
+  800c94:	89 c8                	mov    %ecx,%eax
+  800c96:	5b                   	pop    %ebx
+  800c97:	5e                   	pop    %esi
+  800c98:	5f                   	pop    %edi
+  800c99:	5d                   	pop    %ebp
+  800c9a:	c3                   	ret
+
+00800c9b <sys_cputs>:
+  800c9b:	55                   	push   %ebp
+  800c9c:	89 e5                	mov    %esp,%ebp
+  800c9e:	57                   	push   %edi
+  800c9f:	56                   	push   %esi
+  800ca0:	53                   	push   %ebx
+  800ca1:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ca8:	78 21                	js     800ccb <sys_cputs+0x30>
+  800caa:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800cb1:	75 2d                	jne    800ce0 <sys_cputs+0x45>
+  800cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbe:	89 c3                	mov    %eax,%ebx
+  800cc0:	89 c7                	mov    %eax,%edi
+  800cc2:	89 c6                	mov    %eax,%esi
+  800cc4:	cd 30                	int    $0x30
+  800cc6:	5b                   	pop    %ebx
+  800cc7:	5e                   	pop    %esi
+  800cc8:	5f                   	pop    %edi
+  800cc9:	5d                   	pop    %ebp
+  800cca:	c3                   	ret
+  800ccb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cd0:	0f a2                	cpuid
+  800cd2:	c1 ea 0b             	shr    $0xb,%edx
+  800cd5:	83 e2 01             	and    $0x1,%edx
+  800cd8:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800cde:	eb ca                	jmp    800caa <sys_cputs+0xf>
+  800ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ceb:	89 c3                	mov    %eax,%ebx
+  800ced:	89 c7                	mov    %eax,%edi
+  800cef:	89 c6                	mov    %eax,%esi
+  800cf1:	55                   	push   %ebp
+  800cf2:	68 fb 0c 80 00       	push   $0x800cfb
+  800cf7:	89 e5                	mov    %esp,%ebp
+  800cf9:	0f 34                	sysenter
+  800cfb:	83 c4 04             	add    $0x4,%esp
+  800cfe:	5d                   	pop    %ebp
+  800cff:	eb c5                	jmp    800cc6 <sys_cputs+0x2b>
+
+00800d01 <sys_cgetc>:
+  800d01:	55                   	push   %ebp
+  800d02:	89 e5                	mov    %esp,%ebp
+  800d04:	57                   	push   %edi
+  800d05:	56                   	push   %esi
+  800d06:	53                   	push   %ebx
+  800d07:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d0e:	78 22                	js     800d32 <sys_cgetc+0x31>
+  800d10:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d17:	75 2e                	jne    800d47 <sys_cgetc+0x46>
+  800d19:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d23:	89 d1                	mov    %edx,%ecx
+  800d25:	89 d3                	mov    %edx,%ebx
+  800d27:	89 d7                	mov    %edx,%edi
+  800d29:	89 d6                	mov    %edx,%esi
+  800d2b:	cd 30                	int    $0x30
+  800d2d:	5b                   	pop    %ebx
+  800d2e:	5e                   	pop    %esi
+  800d2f:	5f                   	pop    %edi
+  800d30:	5d                   	pop    %ebp
+  800d31:	c3                   	ret
+  800d32:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d37:	0f a2                	cpuid
+  800d39:	c1 ea 0b             	shr    $0xb,%edx
+  800d3c:	83 e2 01             	and    $0x1,%edx
+  800d3f:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800d45:	eb c9                	jmp    800d10 <sys_cgetc+0xf>
+  800d47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d51:	89 d1                	mov    %edx,%ecx
+  800d53:	89 d3                	mov    %edx,%ebx
+  800d55:	89 d7                	mov    %edx,%edi
+  800d57:	89 d6                	mov    %edx,%esi
+  800d59:	55                   	push   %ebp
+  800d5a:	68 63 0d 80 00       	push   $0x800d63
+  800d5f:	89 e5                	mov    %esp,%ebp
+  800d61:	0f 34                	sysenter
+  800d63:	83 c4 04             	add    $0x4,%esp
+  800d66:	5d                   	pop    %ebp
+  800d67:	eb c4                	jmp    800d2d <sys_cgetc+0x2c>
+
+00800d69 <sys_env_destroy>:
+  800d69:	55                   	push   %ebp
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	57                   	push   %edi
+  800d6d:	56                   	push   %esi
+  800d6e:	53                   	push   %ebx
+  800d6f:	83 ec 0c             	sub    $0xc,%esp
+  800d72:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d79:	78 2a                	js     800da5 <sys_env_destroy+0x3c>
+  800d7b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d82:	75 36                	jne    800dba <sys_env_destroy+0x51>
+  800d84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d89:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d91:	89 cb                	mov    %ecx,%ebx
+  800d93:	89 cf                	mov    %ecx,%edi
+  800d95:	89 ce                	mov    %ecx,%esi
+  800d97:	cd 30                	int    $0x30
+  800d99:	85 c0                	test   %eax,%eax
+  800d9b:	7f 40                	jg     800ddd <sys_env_destroy+0x74>
+  800d9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da0:	5b                   	pop    %ebx
+  800da1:	5e                   	pop    %esi
+  800da2:	5f                   	pop    %edi
+  800da3:	5d                   	pop    %ebp
+  800da4:	c3                   	ret
+  800da5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800daa:	0f a2                	cpuid
+  800dac:	c1 ea 0b             	shr    $0xb,%edx
+  800daf:	83 e2 01             	and    $0x1,%edx
+  800db2:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800db8:	eb c1                	jmp    800d7b <sys_env_destroy+0x12>
+  800dba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dc2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dc7:	89 cb                	mov    %ecx,%ebx
+  800dc9:	89 cf                	mov    %ecx,%edi
+  800dcb:	89 ce                	mov    %ecx,%esi
+  800dcd:	55                   	push   %ebp
+  800dce:	68 d7 0d 80 00       	push   $0x800dd7
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	0f 34                	sysenter
+  800dd7:	83 c4 04             	add    $0x4,%esp
+  800dda:	5d                   	pop    %ebp
+  800ddb:	eb bc                	jmp    800d99 <sys_env_destroy+0x30>
+  800ddd:	83 ec 0c             	sub    $0xc,%esp
+  800de0:	50                   	push   %eax
+  800de1:	6a 03                	push   $0x3
+  800de3:	68 e4 21 80 00       	push   $0x8021e4
+  800de8:	6a 49                	push   $0x49
+  800dea:	68 01 22 80 00       	push   $0x802201
+  800def:	e8 63 f3 ff ff       	call   800157 <_panic>
+
+00800df4 <sys_getenvid>:
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	57                   	push   %edi
+  800df8:	56                   	push   %esi
+  800df9:	53                   	push   %ebx
+  800dfa:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e01:	78 22                	js     800e25 <sys_getenvid+0x31>
+  800e03:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e0a:	75 2e                	jne    800e3a <sys_getenvid+0x46>
+  800e0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e11:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e16:	89 d1                	mov    %edx,%ecx
+  800e18:	89 d3                	mov    %edx,%ebx
+  800e1a:	89 d7                	mov    %edx,%edi
+  800e1c:	89 d6                	mov    %edx,%esi
+  800e1e:	cd 30                	int    $0x30
+  800e20:	5b                   	pop    %ebx
+  800e21:	5e                   	pop    %esi
+  800e22:	5f                   	pop    %edi
+  800e23:	5d                   	pop    %ebp
+  800e24:	c3                   	ret
+  800e25:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e2a:	0f a2                	cpuid
+  800e2c:	c1 ea 0b             	shr    $0xb,%edx
+  800e2f:	83 e2 01             	and    $0x1,%edx
+  800e32:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800e38:	eb c9                	jmp    800e03 <sys_getenvid+0xf>
+  800e3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e44:	89 d1                	mov    %edx,%ecx
+  800e46:	89 d3                	mov    %edx,%ebx
+  800e48:	89 d7                	mov    %edx,%edi
+  800e4a:	89 d6                	mov    %edx,%esi
+  800e4c:	55                   	push   %ebp
+  800e4d:	68 56 0e 80 00       	push   $0x800e56
+  800e52:	89 e5                	mov    %esp,%ebp
+  800e54:	0f 34                	sysenter
+  800e56:	83 c4 04             	add    $0x4,%esp
+  800e59:	5d                   	pop    %ebp
+  800e5a:	eb c4                	jmp    800e20 <sys_getenvid+0x2c>
+
+00800e5c <sys_yield>:
+  800e5c:	55                   	push   %ebp
+  800e5d:	89 e5                	mov    %esp,%ebp
+  800e5f:	57                   	push   %edi
+  800e60:	56                   	push   %esi
+  800e61:	53                   	push   %ebx
+  800e62:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e69:	78 22                	js     800e8d <sys_yield+0x31>
+  800e6b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e72:	75 2e                	jne    800ea2 <sys_yield+0x46>
+  800e74:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e79:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e7e:	89 d1                	mov    %edx,%ecx
+  800e80:	89 d3                	mov    %edx,%ebx
+  800e82:	89 d7                	mov    %edx,%edi
+  800e84:	89 d6                	mov    %edx,%esi
+  800e86:	cd 30                	int    $0x30
+  800e88:	5b                   	pop    %ebx
+  800e89:	5e                   	pop    %esi
+  800e8a:	5f                   	pop    %edi
+  800e8b:	5d                   	pop    %ebp
+  800e8c:	c3                   	ret
+  800e8d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e92:	0f a2                	cpuid
+  800e94:	c1 ea 0b             	shr    $0xb,%edx
+  800e97:	83 e2 01             	and    $0x1,%edx
+  800e9a:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800ea0:	eb c9                	jmp    800e6b <sys_yield+0xf>
+  800ea2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eac:	89 d1                	mov    %edx,%ecx
+  800eae:	89 d3                	mov    %edx,%ebx
+  800eb0:	89 d7                	mov    %edx,%edi
+  800eb2:	89 d6                	mov    %edx,%esi
+  800eb4:	55                   	push   %ebp
+  800eb5:	68 be 0e 80 00       	push   $0x800ebe
+  800eba:	89 e5                	mov    %esp,%ebp
+  800ebc:	0f 34                	sysenter
+  800ebe:	83 c4 04             	add    $0x4,%esp
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	eb c4                	jmp    800e88 <sys_yield+0x2c>
+
+00800ec4 <sys_env_set_cow>:
+  800ec4:	55                   	push   %ebp
+  800ec5:	89 e5                	mov    %esp,%ebp
+  800ec7:	57                   	push   %edi
+  800ec8:	56                   	push   %esi
+  800ec9:	53                   	push   %ebx
+  800eca:	83 ec 0c             	sub    $0xc,%esp
+  800ecd:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ed4:	78 2b                	js     800f01 <sys_env_set_cow+0x3d>
+  800ed6:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800edd:	75 37                	jne    800f16 <sys_env_set_cow+0x52>
+  800edf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ee9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eef:	89 df                	mov    %ebx,%edi
+  800ef1:	89 de                	mov    %ebx,%esi
+  800ef3:	cd 30                	int    $0x30
+  800ef5:	85 c0                	test   %eax,%eax
+  800ef7:	7f 41                	jg     800f3a <sys_env_set_cow+0x76>
+  800ef9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efc:	5b                   	pop    %ebx
+  800efd:	5e                   	pop    %esi
+  800efe:	5f                   	pop    %edi
+  800eff:	5d                   	pop    %ebp
+  800f00:	c3                   	ret
+  800f01:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f06:	0f a2                	cpuid
+  800f08:	c1 ea 0b             	shr    $0xb,%edx
+  800f0b:	83 e2 01             	and    $0x1,%edx
+  800f0e:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800f14:	eb c0                	jmp    800ed6 <sys_env_set_cow+0x12>
+  800f16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f21:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f26:	89 df                	mov    %ebx,%edi
+  800f28:	89 de                	mov    %ebx,%esi
+  800f2a:	55                   	push   %ebp
+  800f2b:	68 34 0f 80 00       	push   $0x800f34
+  800f30:	89 e5                	mov    %esp,%ebp
+  800f32:	0f 34                	sysenter
+  800f34:	83 c4 04             	add    $0x4,%esp
+  800f37:	5d                   	pop    %ebp
+  800f38:	eb bb                	jmp    800ef5 <sys_env_set_cow+0x31>
+  800f3a:	83 ec 0c             	sub    $0xc,%esp
+  800f3d:	50                   	push   %eax
+  800f3e:	6a 0d                	push   $0xd
+  800f40:	68 e4 21 80 00       	push   $0x8021e4
+  800f45:	6a 49                	push   $0x49
+  800f47:	68 01 22 80 00       	push   $0x802201
+  800f4c:	e8 06 f2 ff ff       	call   800157 <_panic>
+
+00800f51 <sys_env_set_quota>:
+  800f51:	55                   	push   %ebp
+  800f52:	89 e5                	mov    %esp,%ebp
+  800f54:	57                   	push   %edi
+  800f55:	56                   	push   %esi
+  800f56:	53                   	push   %ebx
+  800f57:	83 ec 0c             	sub    $0xc,%esp
+  800f5a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f61:	78 2b                	js     800f8e <sys_env_set_quota+0x3d>
+  800f63:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f6a:	75 37                	jne    800fa3 <sys_env_set_quota+0x52>
+  800f6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f71:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7c:	89 df                	mov    %ebx,%edi
+  800f7e:	89 de                	mov    %ebx,%esi
+  800f80:	cd 30                	int    $0x30
+  800f82:	85 c0                	test   %eax,%eax
+  800f84:	7f 41                	jg     800fc7 <sys_env_set_quota+0x76>
+  800f86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f89:	5b                   	pop    %ebx
+  800f8a:	5e                   	pop    %esi
+  800f8b:	5f                   	pop    %edi
+  800f8c:	5d                   	pop    %ebp
+  800f8d:	c3                   	ret
+  800f8e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f93:	0f a2                	cpuid
+  800f95:	c1 ea 0b             	shr    $0xb,%edx
+  800f98:	83 e2 01             	and    $0x1,%edx
+  800f9b:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800fa1:	eb c0                	jmp    800f63 <sys_env_set_quota+0x12>
+  800fa3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fae:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fb3:	89 df                	mov    %ebx,%edi
+  800fb5:	89 de                	mov    %ebx,%esi
+  800fb7:	55                   	push   %ebp
+  800fb8:	68 c1 0f 80 00       	push   $0x800fc1
+  800fbd:	89 e5                	mov    %esp,%ebp
+  800fbf:	0f 34                	sysenter
+  800fc1:	83 c4 04             	add    $0x4,%esp
+  800fc4:	5d                   	pop    %ebp
+  800fc5:	eb bb                	jmp    800f82 <sys_env_set_quota+0x31>
+  800fc7:	83 ec 0c             	sub    $0xc,%esp
+  800fca:	50                   	push   %eax
+  800fcb:	6a 0f                	push   $0xf
+  800fcd:	68 e4 21 80 00       	push   $0x8021e4
+  800fd2:	6a 49                	push   $0x49
+  800fd4:	68 01 22 80 00       	push   $0x802201
+  800fd9:	e8 79 f1 ff ff       	call   800157 <_panic>
+
+00800fde <sys_page_alloc>:
+  800fde:	55                   	push   %ebp
+  800fdf:	89 e5                	mov    %esp,%ebp
+  800fe1:	57                   	push   %edi
+  800fe2:	56                   	push   %esi
+  800fe3:	53                   	push   %ebx
+  800fe4:	83 ec 0c             	sub    $0xc,%esp
+  800fe7:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800fee:	78 2c                	js     80101c <sys_page_alloc+0x3e>
+  800ff0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ff7:	75 38                	jne    801031 <sys_page_alloc+0x53>
+  800ff9:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffe:	b8 04 00 00 00       	mov    $0x4,%eax
+  801003:	8b 55 08             	mov    0x8(%ebp),%edx
+  801006:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801009:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100c:	89 f7                	mov    %esi,%edi
+  80100e:	cd 30                	int    $0x30
+  801010:	85 c0                	test   %eax,%eax
+  801012:	7f 42                	jg     801056 <sys_page_alloc+0x78>
+  801014:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801017:	5b                   	pop    %ebx
+  801018:	5e                   	pop    %esi
+  801019:	5f                   	pop    %edi
+  80101a:	5d                   	pop    %ebp
+  80101b:	c3                   	ret
+  80101c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801021:	0f a2                	cpuid
+  801023:	c1 ea 0b             	shr    $0xb,%edx
+  801026:	83 e2 01             	and    $0x1,%edx
+  801029:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80102f:	eb bf                	jmp    800ff0 <sys_page_alloc+0x12>
+  801031:	be 00 00 00 00       	mov    $0x0,%esi
+  801036:	8b 55 08             	mov    0x8(%ebp),%edx
+  801039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801041:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801044:	89 f7                	mov    %esi,%edi
+  801046:	55                   	push   %ebp
+  801047:	68 50 10 80 00       	push   $0x801050
+  80104c:	89 e5                	mov    %esp,%ebp
+  80104e:	0f 34                	sysenter
+  801050:	83 c4 04             	add    $0x4,%esp
+  801053:	5d                   	pop    %ebp
+  801054:	eb ba                	jmp    801010 <sys_page_alloc+0x32>
+  801056:	83 ec 0c             	sub    $0xc,%esp
+  801059:	50                   	push   %eax
+  80105a:	6a 04                	push   $0x4
+  80105c:	68 e4 21 80 00       	push   $0x8021e4
+  801061:	6a 49                	push   $0x49
+  801063:	68 01 22 80 00       	push   $0x802201
+  801068:	e8 ea f0 ff ff       	call   800157 <_panic>
+
+0080106d <sys_page_map>:
+  80106d:	55                   	push   %ebp
+  80106e:	89 e5                	mov    %esp,%ebp
+  801070:	57                   	push   %edi
+  801071:	56                   	push   %esi
+  801072:	53                   	push   %ebx
+  801073:	83 ec 0c             	sub    $0xc,%esp
+  801076:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80107d:	78 2b                	js     8010aa <sys_page_map+0x3d>
+  80107f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801086:	75 37                	jne    8010bf <sys_page_map+0x52>
+  801088:	b8 05 00 00 00       	mov    $0x5,%eax
+  80108d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801090:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801093:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801096:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801099:	8b 75 18             	mov    0x18(%ebp),%esi
+  80109c:	cd 30                	int    $0x30
+  80109e:	85 c0                	test   %eax,%eax
+  8010a0:	7f 41                	jg     8010e3 <sys_page_map+0x76>
+  8010a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a5:	5b                   	pop    %ebx
+  8010a6:	5e                   	pop    %esi
+  8010a7:	5f                   	pop    %edi
+  8010a8:	5d                   	pop    %ebp
+  8010a9:	c3                   	ret
+  8010aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010af:	0f a2                	cpuid
+  8010b1:	c1 ea 0b             	shr    $0xb,%edx
+  8010b4:	83 e2 01             	and    $0x1,%edx
+  8010b7:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8010bd:	eb c0                	jmp    80107f <sys_page_map+0x12>
+  8010bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010cd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010d0:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010d3:	55                   	push   %ebp
+  8010d4:	68 dd 10 80 00       	push   $0x8010dd
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	0f 34                	sysenter
+  8010dd:	83 c4 04             	add    $0x4,%esp
+  8010e0:	5d                   	pop    %ebp
+  8010e1:	eb bb                	jmp    80109e <sys_page_map+0x31>
+  8010e3:	83 ec 0c             	sub    $0xc,%esp
+  8010e6:	50                   	push   %eax
+  8010e7:	6a 05                	push   $0x5
+  8010e9:	68 e4 21 80 00       	push   $0x8021e4
+  8010ee:	6a 49                	push   $0x49
+  8010f0:	68 01 22 80 00       	push   $0x802201
+  8010f5:	e8 5d f0 ff ff       	call   800157 <_panic>
+
+008010fa <sys_page_unmap>:
+  8010fa:	55                   	push   %ebp
+  8010fb:	89 e5                	mov    %esp,%ebp
+  8010fd:	57                   	push   %edi
+  8010fe:	56                   	push   %esi
+  8010ff:	53                   	push   %ebx
+  801100:	83 ec 0c             	sub    $0xc,%esp
+  801103:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80110a:	78 2b                	js     801137 <sys_page_unmap+0x3d>
+  80110c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801113:	75 37                	jne    80114c <sys_page_unmap+0x52>
+  801115:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80111f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801122:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801125:	89 df                	mov    %ebx,%edi
+  801127:	89 de                	mov    %ebx,%esi
+  801129:	cd 30                	int    $0x30
+  80112b:	85 c0                	test   %eax,%eax
+  80112d:	7f 41                	jg     801170 <sys_page_unmap+0x76>
+  80112f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801132:	5b                   	pop    %ebx
+  801133:	5e                   	pop    %esi
+  801134:	5f                   	pop    %edi
+  801135:	5d                   	pop    %ebp
+  801136:	c3                   	ret
+  801137:	b8 01 00 00 00       	mov    $0x1,%eax
+  80113c:	0f a2                	cpuid
+  80113e:	c1 ea 0b             	shr    $0xb,%edx
+  801141:	83 e2 01             	and    $0x1,%edx
+  801144:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80114a:	eb c0                	jmp    80110c <sys_page_unmap+0x12>
+  80114c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801151:	8b 55 08             	mov    0x8(%ebp),%edx
+  801154:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801157:	b8 06 00 00 00       	mov    $0x6,%eax
+  80115c:	89 df                	mov    %ebx,%edi
+  80115e:	89 de                	mov    %ebx,%esi
+  801160:	55                   	push   %ebp
+  801161:	68 6a 11 80 00       	push   $0x80116a
+  801166:	89 e5                	mov    %esp,%ebp
+  801168:	0f 34                	sysenter
+  80116a:	83 c4 04             	add    $0x4,%esp
+  80116d:	5d                   	pop    %ebp
+  80116e:	eb bb                	jmp    80112b <sys_page_unmap+0x31>
+  801170:	83 ec 0c             	sub    $0xc,%esp
+  801173:	50                   	push   %eax
+  801174:	6a 06                	push   $0x6
+  801176:	68 e4 21 80 00       	push   $0x8021e4
+  80117b:	6a 49                	push   $0x49
+  80117d:	68 01 22 80 00       	push   $0x802201
+  801182:	e8 d0 ef ff ff       	call   800157 <_panic>
+
+00801187 <sys_page_reuse>:
+  801187:	55                   	push   %ebp
+  801188:	89 e5                	mov    %esp,%ebp
+  80118a:	57                   	push   %edi
+  80118b:	56                   	push   %esi
+  80118c:	53                   	push   %ebx
+  80118d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801194:	78 24                	js     8011ba <sys_page_reuse+0x33>
+  801196:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80119d:	75 30                	jne    8011cf <sys_page_reuse+0x48>
+  80119f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011af:	89 df                	mov    %ebx,%edi
+  8011b1:	89 de                	mov    %ebx,%esi
+  8011b3:	cd 30                	int    $0x30
+  8011b5:	5b                   	pop    %ebx
+  8011b6:	5e                   	pop    %esi
+  8011b7:	5f                   	pop    %edi
+  8011b8:	5d                   	pop    %ebp
+  8011b9:	c3                   	ret
+  8011ba:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011bf:	0f a2                	cpuid
+  8011c1:	c1 ea 0b             	shr    $0xb,%edx
+  8011c4:	83 e2 01             	and    $0x1,%edx
+  8011c7:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8011cd:	eb c7                	jmp    801196 <sys_page_reuse+0xf>
+  8011cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011da:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011df:	89 df                	mov    %ebx,%edi
+  8011e1:	89 de                	mov    %ebx,%esi
+  8011e3:	55                   	push   %ebp
+  8011e4:	68 ed 11 80 00       	push   $0x8011ed
+  8011e9:	89 e5                	mov    %esp,%ebp
+  8011eb:	0f 34                	sysenter
+  8011ed:	83 c4 04             	add    $0x4,%esp
+  8011f0:	5d                   	pop    %ebp
+  8011f1:	eb c2                	jmp    8011b5 <sys_page_reuse+0x2e>
+
+008011f3 <sys_env_set_status>:
+  8011f3:	55                   	push   %ebp
+  8011f4:	89 e5                	mov    %esp,%ebp
+  8011f6:	57                   	push   %edi
+  8011f7:	56                   	push   %esi
+  8011f8:	53                   	push   %ebx
+  8011f9:	83 ec 0c             	sub    $0xc,%esp
+  8011fc:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801203:	78 2b                	js     801230 <sys_env_set_status+0x3d>
+  801205:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80120c:	75 37                	jne    801245 <sys_env_set_status+0x52>
+  80120e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801213:	b8 08 00 00 00       	mov    $0x8,%eax
+  801218:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121e:	89 df                	mov    %ebx,%edi
+  801220:	89 de                	mov    %ebx,%esi
+  801222:	cd 30                	int    $0x30
+  801224:	85 c0                	test   %eax,%eax
+  801226:	7f 41                	jg     801269 <sys_env_set_status+0x76>
+  801228:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122b:	5b                   	pop    %ebx
+  80122c:	5e                   	pop    %esi
+  80122d:	5f                   	pop    %edi
+  80122e:	5d                   	pop    %ebp
+  80122f:	c3                   	ret
+  801230:	b8 01 00 00 00       	mov    $0x1,%eax
+  801235:	0f a2                	cpuid
+  801237:	c1 ea 0b             	shr    $0xb,%edx
+  80123a:	83 e2 01             	and    $0x1,%edx
+  80123d:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801243:	eb c0                	jmp    801205 <sys_env_set_status+0x12>
+  801245:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801250:	b8 08 00 00 00       	mov    $0x8,%eax
+  801255:	89 df                	mov    %ebx,%edi
+  801257:	89 de                	mov    %ebx,%esi
+  801259:	55                   	push   %ebp
+  80125a:	68 63 12 80 00       	push   $0x801263
+  80125f:	89 e5                	mov    %esp,%ebp
+  801261:	0f 34                	sysenter
+  801263:	83 c4 04             	add    $0x4,%esp
+  801266:	5d                   	pop    %ebp
+  801267:	eb bb                	jmp    801224 <sys_env_set_status+0x31>
+  801269:	83 ec 0c             	sub    $0xc,%esp
+  80126c:	50                   	push   %eax
+  80126d:	6a 08                	push   $0x8
+  80126f:	68 e4 21 80 00       	push   $0x8021e4
+  801274:	6a 49                	push   $0x49
+  801276:	68 01 22 80 00       	push   $0x802201
+  80127b:	e8 d7 ee ff ff       	call   800157 <_panic>
+
+00801280 <sys_env_set_pgfault_upcall>:
+  801280:	55                   	push   %ebp
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	57                   	push   %edi
+  801284:	56                   	push   %esi
+  801285:	53                   	push   %ebx
+  801286:	83 ec 0c             	sub    $0xc,%esp
+  801289:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801290:	78 2b                	js     8012bd <sys_env_set_pgfault_upcall+0x3d>
+  801292:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801299:	75 37                	jne    8012d2 <sys_env_set_pgfault_upcall+0x52>
+  80129b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ab:	89 df                	mov    %ebx,%edi
+  8012ad:	89 de                	mov    %ebx,%esi
+  8012af:	cd 30                	int    $0x30
+  8012b1:	85 c0                	test   %eax,%eax
+  8012b3:	7f 41                	jg     8012f6 <sys_env_set_pgfault_upcall+0x76>
+  8012b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b8:	5b                   	pop    %ebx
+  8012b9:	5e                   	pop    %esi
+  8012ba:	5f                   	pop    %edi
+  8012bb:	5d                   	pop    %ebp
+  8012bc:	c3                   	ret
+  8012bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012c2:	0f a2                	cpuid
+  8012c4:	c1 ea 0b             	shr    $0xb,%edx
+  8012c7:	83 e2 01             	and    $0x1,%edx
+  8012ca:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8012d0:	eb c0                	jmp    801292 <sys_env_set_pgfault_upcall+0x12>
+  8012d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012dd:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012e2:	89 df                	mov    %ebx,%edi
+  8012e4:	89 de                	mov    %ebx,%esi
+  8012e6:	55                   	push   %ebp
+  8012e7:	68 f0 12 80 00       	push   $0x8012f0
+  8012ec:	89 e5                	mov    %esp,%ebp
+  8012ee:	0f 34                	sysenter
+  8012f0:	83 c4 04             	add    $0x4,%esp
+  8012f3:	5d                   	pop    %ebp
+  8012f4:	eb bb                	jmp    8012b1 <sys_env_set_pgfault_upcall+0x31>
+  8012f6:	83 ec 0c             	sub    $0xc,%esp
+  8012f9:	50                   	push   %eax
+  8012fa:	6a 09                	push   $0x9
+  8012fc:	68 e4 21 80 00       	push   $0x8021e4
+  801301:	6a 49                	push   $0x49
+  801303:	68 01 22 80 00       	push   $0x802201
+  801308:	e8 4a ee ff ff       	call   800157 <_panic>
+
+0080130d <sys_env_set_trace>:
+  80130d:	55                   	push   %ebp
+  80130e:	89 e5                	mov    %esp,%ebp
+  801310:	57                   	push   %edi
+  801311:	56                   	push   %esi
+  801312:	53                   	push   %ebx
+  801313:	83 ec 0c             	sub    $0xc,%esp
+  801316:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80131d:	78 2b                	js     80134a <sys_env_set_trace+0x3d>
+  80131f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801326:	75 37                	jne    80135f <sys_env_set_trace+0x52>
+  801328:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801332:	8b 55 08             	mov    0x8(%ebp),%edx
+  801335:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801338:	89 df                	mov    %ebx,%edi
+  80133a:	89 de                	mov    %ebx,%esi
+  80133c:	cd 30                	int    $0x30
+  80133e:	85 c0                	test   %eax,%eax
+  801340:	7f 41                	jg     801383 <sys_env_set_trace+0x76>
+  801342:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801345:	5b                   	pop    %ebx
+  801346:	5e                   	pop    %esi
+  801347:	5f                   	pop    %edi
+  801348:	5d                   	pop    %ebp
+  801349:	c3                   	ret
+  80134a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80134f:	0f a2                	cpuid
+  801351:	c1 ea 0b             	shr    $0xb,%edx
+  801354:	83 e2 01             	and    $0x1,%edx
+  801357:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80135d:	eb c0                	jmp    80131f <sys_env_set_trace+0x12>
+  80135f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801364:	8b 55 08             	mov    0x8(%ebp),%edx
+  801367:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80136f:	89 df                	mov    %ebx,%edi
+  801371:	89 de                	mov    %ebx,%esi
+  801373:	55                   	push   %ebp
+  801374:	68 7d 13 80 00       	push   $0x80137d
+  801379:	89 e5                	mov    %esp,%ebp
+  80137b:	0f 34                	sysenter
+  80137d:	83 c4 04             	add    $0x4,%esp
+  801380:	5d                   	pop    %ebp
+  801381:	eb bb                	jmp    80133e <sys_env_set_trace+0x31>
+  801383:	83 ec 0c             	sub    $0xc,%esp
+  801386:	50                   	push   %eax
+  801387:	6a 12                	push   $0x12
+  801389:	68 e4 21 80 00       	push   $0x8021e4
+  80138e:	6a 49                	push   $0x49
+  801390:	68 01 22 80 00       	push   $0x802201
+  801395:	e8 bd ed ff ff       	call   800157 <_panic>
+
+0080139a <sys_env_set_rdpmc>:
+  80139a:	55                   	push   %ebp
+  80139b:	89 e5                	mov    %esp,%ebp
+  80139d:	57                   	push   %edi
+  80139e:	56                   	push   %esi
+  80139f:	53                   	push   %ebx
+  8013a0:	83 ec 0c             	sub    $0xc,%esp
+  8013a3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013aa:	78 2b                	js     8013d7 <sys_env_set_rdpmc+0x3d>
+  8013ac:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013b3:	75 37                	jne    8013ec <sys_env_set_rdpmc+0x52>
+  8013b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ba:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c5:	89 df                	mov    %ebx,%edi
+  8013c7:	89 de                	mov    %ebx,%esi
+  8013c9:	cd 30                	int    $0x30
+  8013cb:	85 c0                	test   %eax,%eax
+  8013cd:	7f 41                	jg     801410 <sys_env_set_rdpmc+0x76>
+  8013cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d2:	5b                   	pop    %ebx
+  8013d3:	5e                   	pop    %esi
+  8013d4:	5f                   	pop    %edi
+  8013d5:	5d                   	pop    %ebp
+  8013d6:	c3                   	ret
+  8013d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013dc:	0f a2                	cpuid
+  8013de:	c1 ea 0b             	shr    $0xb,%edx
+  8013e1:	83 e2 01             	and    $0x1,%edx
+  8013e4:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8013ea:	eb c0                	jmp    8013ac <sys_env_set_rdpmc+0x12>
+  8013ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013fc:	89 df                	mov    %ebx,%edi
+  8013fe:	89 de                	mov    %ebx,%esi
+  801400:	55                   	push   %ebp
+  801401:	68 0a 14 80 00       	push   $0x80140a
+  801406:	89 e5                	mov    %esp,%ebp
+  801408:	0f 34                	sysenter
+  80140a:	83 c4 04             	add    $0x4,%esp
+  80140d:	5d                   	pop    %ebp
+  80140e:	eb bb                	jmp    8013cb <sys_env_set_rdpmc+0x31>
+  801410:	83 ec 0c             	sub    $0xc,%esp
+  801413:	50                   	push   %eax
+  801414:	6a 13                	push   $0x13
+  801416:	68 e4 21 80 00       	push   $0x8021e4
+  80141b:	6a 49                	push   $0x49
+  80141d:	68 01 22 80 00       	push   $0x802201
+  801422:	e8 30 ed ff ff       	call   800157 <_panic>
+
+00801427 <sys_ring_setup>:
+  801427:	55                   	push   %ebp
+  801428:	89 e5                	mov    %esp,%ebp
+  80142a:	57                   	push   %edi
+  80142b:	56                   	push   %esi
+  80142c:	53                   	push   %ebx
+  80142d:	83 ec 0c             	sub    $0xc,%esp
+  801430:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801437:	78 29                	js     801462 <sys_ring_setup+0x3b>
+  801439:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801440:	75 35                	jne    801477 <sys_ring_setup+0x50>
+  801442:	ba 00 00 00 00       	mov    $0x0,%edx
+  801447:	b8 10 00 00 00       	mov    $0x10,%eax
+  80144c:	89 d1                	mov    %edx,%ecx
+  80144e:	89 d3                	mov    %edx,%ebx
+  801450:	89 d7                	mov    %edx,%edi
+  801452:	89 d6                	mov    %edx,%esi
+  801454:	cd 30                	int    $0x30
+  801456:	85 c0                	test   %eax,%eax
+  801458:	7f 3f                	jg     801499 <sys_ring_setup+0x72>
+  80145a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80145d:	5b                   	pop    %ebx
+  80145e:	5e                   	pop    %esi
+  80145f:	5f                   	pop    %edi
+  801460:	5d                   	pop    %ebp
+  801461:	c3                   	ret
+  801462:	b8 01 00 00 00       	mov    $0x1,%eax
+  801467:	0f a2                	cpuid
+  801469:	c1 ea 0b             	shr    $0xb,%edx
+  80146c:	83 e2 01             	and    $0x1,%edx
+  80146f:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801475:	eb c2                	jmp    801439 <sys_ring_setup+0x12>
+  801477:	ba 00 00 00 00       	mov    $0x0,%edx
+  80147c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801481:	89 d1                	mov    %edx,%ecx
+  801483:	89 d3                	mov    %edx,%ebx
+  801485:	89 d7                	mov    %edx,%edi
+  801487:	89 d6                	mov    %edx,%esi
+  801489:	55                   	push   %ebp
+  80148a:	68 93 14 80 00       	push   $0x801493
+  80148f:	89 e5                	mov    %esp,%ebp
+  801491:	0f 34                	sysenter
+  801493:	83 c4 04             	add    $0x4,%esp
+  801496:	5d                   	pop    %ebp
+  801497:	eb bd                	jmp    801456 <sys_ring_setup+0x2f>
+  801499:	83 ec 0c             	sub    $0xc,%esp
+  80149c:	50                   	push   %eax
+  80149d:	6a 10                	push   $0x10
+  80149f:	68 e4 21 80 00       	push   $0x8021e4
+  8014a4:	6a 49                	push   $0x49
+  8014a6:	68 01 22 80 00       	push   $0x802201
+  8014ab:	e8 a7 ec ff ff       	call   800157 <_panic>
+
+008014b0 <sys_ring_enter>:
+  8014b0:	55                   	push   %ebp
+  8014b1:	89 e5                	mov    %esp,%ebp
+  8014b3:	57                   	push   %edi
+  8014b4:	56                   	push   %esi
+  8014b5:	53                   	push   %ebx
+  8014b6:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014bd:	78 22                	js     8014e1 <sys_ring_enter+0x31>
+  8014bf:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014c6:	75 2e                	jne    8014f6 <sys_ring_enter+0x46>
+  8014c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014cd:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014d2:	89 d1                	mov    %edx,%ecx
+  8014d4:	89 d3                	mov    %edx,%ebx
+  8014d6:	89 d7                	mov    %edx,%edi
+  8014d8:	89 d6                	mov    %edx,%esi
+  8014da:	cd 30                	int    $0x30
+  8014dc:	5b                   	pop    %ebx
+  8014dd:	5e                   	pop    %esi
+  8014de:	5f                   	pop    %edi
+  8014df:	5d                   	pop    %ebp
+  8014e0:	c3                   	ret
+  8014e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014e6:	0f a2                	cpuid
+  8014e8:	c1 ea 0b             	shr    $0xb,%edx
+  8014eb:	83 e2 01             	and    $0x1,%edx
+  8014ee:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8014f4:	eb c9                	jmp    8014bf <sys_ring_enter+0xf>
+  8014f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014fb:	b8 11 00 00 00       	mov    $0x11,%eax
+  801500:	89 d1                	mov    %edx,%ecx
+  801502:	89 d3                	mov    %edx,%ebx
+  801504:	89 d7                	mov    %edx,%edi
+  801506:	89 d6                	mov    %edx,%esi
+  801508:	55                   	push   %ebp
+  801509:	68 12 15 80 00       	push   $0x801512
+  80150e:	89 e5                	mov    %esp,%ebp
+  801510:	0f 34                	sysenter
+  801512:	83 c4 04             	add    $0x4,%esp
+  801515:	5d                   	pop    %ebp
+  801516:	eb c4                	jmp    8014dc <sys_ring_enter+0x2c>
+
+00801518 <sys_ipc_try_send>:
+  801518:	55                   	push   %ebp
+  801519:	89 e5                	mov    %esp,%ebp
+  80151b:	57                   	push   %edi
+  80151c:	56                   	push   %esi
+  80151d:	53                   	push   %ebx
+  80151e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801525:	78 26                	js     80154d <sys_ipc_try_send+0x35>
+  801527:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80152e:	75 32                	jne    801562 <sys_ipc_try_send+0x4a>
+  801530:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801535:	be 00 00 00 00       	mov    $0x0,%esi
+  80153a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801540:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801543:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801546:	cd 30                	int    $0x30
+  801548:	5b                   	pop    %ebx
+  801549:	5e                   	pop    %esi
+  80154a:	5f                   	pop    %edi
+  80154b:	5d                   	pop    %ebp
+  80154c:	c3                   	ret
+  80154d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801552:	0f a2                	cpuid
+  801554:	c1 ea 0b             	shr    $0xb,%edx
+  801557:	83 e2 01             	and    $0x1,%edx
+  80155a:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801560:	eb c5                	jmp    801527 <sys_ipc_try_send+0xf>
+  801562:	8b 55 08             	mov    0x8(%ebp),%edx
+  801565:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801568:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80156d:	be 00 00 00 00       	mov    $0x0,%esi
+  801572:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801575:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801578:	55                   	push   %ebp
+  801579:	68 82 15 80 00       	push   $0x801582
+  80157e:	89 e5                	mov    %esp,%ebp
+  801580:	0f 34                	sysenter
+  801582:	83 c4 04             	add    $0x4,%esp
+  801585:	5d                   	pop    %ebp
+  801586:	eb c0                	jmp    801548 <sys_ipc_try_send+0x30>
+
+00801588 <sys_ipc_recv>:
+  801588:	55                   	push   %ebp
+  801589:	89 e5                	mov    %esp,%ebp
+  80158b:	57                   	push   %edi
+  80158c:	56                   	push   %esi
+  80158d:	53                   	push   %ebx
+  80158e:	83 ec 0c             	sub    $0xc,%esp
+  801591:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801598:	78 2a                	js     8015c4 <sys_ipc_recv+0x3c>
+  80159a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8015a1:	75 36                	jne    8015d9 <sys_ipc_recv+0x51>
+  8015a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8015ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b0:	89 cb                	mov    %ecx,%ebx
+  8015b2:	89 cf                	mov    %ecx,%edi
+  8015b4:	89 ce                	mov    %ecx,%esi
+  8015b6:	cd 30                	int    $0x30
+  8015b8:	85 c0                	test   %eax,%eax
+  8015ba:	7f 40                	jg     8015fc <sys_ipc_recv+0x74>
+  8015bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015bf:	5b                   	pop    %ebx
+  8015c0:	5e                   	pop    %esi
+  8015c1:	5f                   	pop    %edi
+  8015c2:	5d                   	pop    %ebp
+  8015c3:	c3                   	ret
+  8015c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015c9:	0f a2                	cpuid
+  8015cb:	c1 ea 0b             	shr    $0xb,%edx
+  8015ce:	83 e2 01             	and    $0x1,%edx
+  8015d1:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8015d7:	eb c1                	jmp    80159a <sys_ipc_recv+0x12>
+  8015d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015e1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8015e6:	89 cb                	mov    %ecx,%ebx
+  8015e8:	89 cf                	mov    %ecx,%edi
+  8015ea:	89 ce                	mov    %ecx,%esi
+  8015ec:	55                   	push   %ebp
+  8015ed:	68 f6 15 80 00       	push   $0x8015f6
+  8015f2:	89 e5                	mov    %esp,%ebp
+  8015f4:	0f 34                	sysenter
+  8015f6:	83 c4 04             	add    $0x4,%esp
+  8015f9:	5d                   	pop    %ebp
+  8015fa:	eb bc                	jmp    8015b8 <sys_ipc_recv+0x30>
+  8015fc:	83 ec 0c             	sub    $0xc,%esp
+  8015ff:	50                   	push   %eax
+  801600:	6a 0c                	push   $0xc
+  801602:	68 e4 21 80 00       	push   $0x8021e4
+  801607:	6a 49                	push   $0x49
+  801609:	68 01 22 80 00       	push   $0x802201
+  80160e:	e8 44 eb ff ff       	call   800157 <_panic>
+
+00801613 <duppage>:
+  801613:	55                   	push   %ebp
+  801614:	89 e5                	mov    %esp,%ebp
+  801616:	53                   	push   %ebx
+  801617:	83 ec 04             	sub    $0x4,%esp
+  80161a:	89 d3                	mov    %edx,%ebx
+  80161c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801623:	f6 c2 02             	test   $0x2,%dl
+  801626:	75 0c                	jne    801634 <duppage+0x21>
+  801628:	8b 14 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edx
+  80162f:	f6 c6 08             	test   $0x8,%dh
+  801632:	74 64                	je     801698 <duppage+0x85>
+  801634:	c1 e3 0c             	shl    $0xc,%ebx
+  801637:	83 ec 0c             	sub    $0xc,%esp
+  80163a:	68 05 08 00 00       	push   $0x805
+  80163f:	53                   	push   %ebx
+  801640:	50                   	push   %eax
+  801641:	53                   	push   %ebx
+  801642:	6a 00                	push   $0x0
+  801644:	e8 24 fa ff ff       	call   80106d <sys_page_map>
+  801649:	83 c4 20             	add    $0x20,%esp
+  80164c:	85 c0                	test   %eax,%eax
+  80164e:	78 24                	js     801674 <duppage+0x61>
+  801650:	83 ec 0c             	sub    $0xc,%esp
+  801653:	68 05 08 00 00       	push   $0x805
+  801658:	53                   	push   %ebx
+  801659:	6a 00                	push   $0x0
+  80165b:	53                   	push   %ebx
+  80165c:	6a 00                	push   $0x0
+  80165e:	e8 0a fa ff ff       	call   80106d <sys_page_map>
+  801663:	83 c4 20             	add    $0x20,%esp
+  801666:	85 c0                	test   %eax,%eax
+  801668:	78 1c                	js     801686 <duppage+0x73>
+  80166a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801672:	c9                   	leave
+  801673:	c3                   	ret
+  801674:	50                   	push   %eax
+  801675:	68 0f 22 80 00       	push   $0x80220f
+  80167a:	6a 52                	push   $0x52
+  80167c:	68 20 22 80 00       	push   $0x802220
+  801681:	e8 d1 ea ff ff       	call   800157 <_panic>
+  801686:	50                   	push   %eax
+  801687:	68 0f 22 80 00       	push   $0x80220f
+  80168c:	6a 55                	push   $0x55
+  80168e:	68 20 22 80 00       	push   $0x802220
+  801693:	e8 bf ea ff ff       	call   800157 <_panic>
+  801698:	c1 e3 0c             	shl    $0xc,%ebx
+  80169b:	83 ec 0c             	sub    $0xc,%esp
+  80169e:	6a 05                	push   $0x5
+  8016a0:	53                   	push   %ebx
+  8016a1:	50                   	push   %eax
+  8016a2:	53                   	push   %ebx
+  8016a3:	6a 00                	push   $0x0
+  8016a5:	e8 c3 f9 ff ff       	call   80106d <sys_page_map>
+  8016aa:	83 c4 20             	add    $0x20,%esp
+  8016ad:	85 c0                	test   %eax,%eax
+  8016af:	79 b9                	jns    80166a <duppage+0x57>
+  8016b1:	50                   	push   %eax
+  8016b2:	68 0f 22 80 00       	push   $0x80220f
+  8016b7:	6a 59                	push   $0x59
+  8016b9:	68 20 22 80 00       	push   $0x802220
+  8016be:	e8 94 ea ff ff       	call   800157 <_panic>
+
+008016c3 <pgfault>:
+  8016c3:	55                   	push   %ebp
+  8016c4:	89 e5                	mov    %esp,%ebp
+  8016c6:	53                   	push   %ebx
+  8016c7:	83 ec 04             	sub    $0x4,%esp
+  8016ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016cd:	8b 18                	mov    (%eax),%ebx
+  8016cf:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8016d3:	0f 84 90 00 00 00    	je     801769 <pgfault+0xa6>
+  8016d9:	89 d8                	mov    %ebx,%eax
+  8016db:	c1 e8 0c             	shr    $0xc,%eax
+  8016de:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016e5:	f7 c2 01 08 00 00    	test   $0x801,%edx
+  8016eb:	74 7c                	je     801769 <pgfault+0xa6>
+  8016ed:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016f4:	c1 e8 0c             	shr    $0xc,%eax
+  8016f7:	0f b7 04 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%eax
+  8016fe:	ef 
+  8016ff:	66 83 f8 01          	cmp    $0x1,%ax
+  801703:	74 78                	je     80177d <pgfault+0xba>
+  801705:	83 ec 04             	sub    $0x4,%esp
+  801708:	6a 07                	push   $0x7
+  80170a:	68 00 f0 7f 00       	push   $0x7ff000
+  80170f:	6a 00                	push   $0x0
+  801711:	e8 c8 f8 ff ff       	call   800fde <sys_page_alloc>
+  801716:	83 c4 10             	add    $0x10,%esp
+  801719:	85 c0                	test   %eax,%eax
+  80171b:	78 7f                	js     80179c <pgfault+0xd9>
+  80171d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  801723:	83 ec 08             	sub    $0x8,%esp
+  801726:	53                   	push   %ebx
+  801727:	68 00 f0 7f 00       	push   $0x7ff000
+  80172c:	e8 86 f3 ff ff       	call   800ab7 <page_copy>
+  801731:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801738:	53                   	push   %ebx
+  801739:	6a 00                	push   $0x0
+  80173b:	68 00 f0 7f 00       	push   $0x7ff000
+  801740:	6a 00                	push   $0x0
+  801742:	e8 26 f9 ff ff       	call   80106d <sys_page_map>
+  801747:	83 c4 20             	add    $0x20,%esp
+  80174a:	85 c0                	test   %eax,%eax
+  80174c:	78 60                	js     8017ae <pgfault+0xeb>
+  80174e:	83 ec 08             	sub    $0x8,%esp
+  801751:	68 00 f0 7f 00       	push   $0x7ff000
+  801756:	6a 00                	push   $0x0
+  801758:	e8 9d f9 ff ff       	call   8010fa <sys_page_unmap>
+  80175d:	83 c4 10             	add    $0x10,%esp
+  801760:	85 c0                	test   %eax,%eax
+  801762:	78 5c                	js     8017c0 <pgfault+0xfd>
+  801764:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801767:	c9                   	leave
+  801768:	c3                   	ret
+  801769:	83 ec 04             	sub    $0x4,%esp
+  80176c:	68 2b 22 80 00       	push   $0x80222b
+  801771:	6a 1c                	push   $0x1c
+  801773:	68 20 22 80 00       	push   $0x802220
+  801778:	e8 da e9 ff ff       	call   800157 <_panic>
+  80177d:	83 ec 08             	sub    $0x8,%esp
+  801780:	89 d8                	mov    %ebx,%eax
+  801782:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801787:	50                   	push   %eax
+  801788:	6a 00                	push   $0x0
+  80178a:	e8 f8 f9 ff ff       	call   801187 <sys_page_reuse>
+  80178f:	83 c4 10             	add    $0x10,%esp
+  801792:	85 c0                	test   %eax,%eax
+  801794:	0f 85 6b ff ff ff    	jne    801705 <pgfault+0x42>
+  80179a:	eb c8                	jmp    801764 <pgfault+0xa1>
+  80179c:	50                   	push   %eax
+  80179d:	68 48 22 80 00       	push   $0x802248
+  8017a2:	6a 31                	push   $0x31
+  8017a4:	68 20 22 80 00       	push   $0x802220
+  8017a9:	e8 a9 e9 ff ff       	call   800157 <_panic>
+  8017ae:	50                   	push   %eax
+  8017af:	68 0f 22 80 00       	push   $0x80220f
+  8017b4:	6a 36                	push   $0x36
+  8017b6:	68 20 22 80 00       	push   $0x802220
+  8017bb:	e8 97 e9 ff ff       	call   800157 <_panic>
+  8017c0:	50                   	push   %eax
+  8017c1:	68 5b 22 80 00       	push   $0x80225b
+  8017c6:	6a 38                	push   $0x38
+  8017c8:	68 20 22 80 00       	push   $0x802220
+  8017cd:	e8 85 e9 ff ff       	call   800157 <_panic>
+
+008017d2 <fork>:
+  8017d2:	55                   	push   %ebp
+  8017d3:	89 e5                	mov    %esp,%ebp
+  8017d5:	53                   	push   %ebx
+  8017d6:	83 ec 20             	sub    $0x20,%esp
+  8017d9:	68 c3 16 80 00       	push   $0x8016c3
+  8017de:	e8 68 04 00 00       	call   801c4b <set_pgfault_handler>
+  8017e3:	83 c4 08             	add    $0x8,%esp
+  8017e6:	6a 01                	push   $0x1
+  8017e8:	6a 00                	push   $0x0
+  8017ea:	e8 d5 f6 ff ff       	call   800ec4 <sys_env_set_cow>
+  8017ef:	83 c4 10             	add    $0x10,%esp
+  8017f2:	85 c0                	test   %eax,%eax
+  8017f4:	78 38                	js     80182e <fork+0x5c>
+  8017f6:	e8 59 03 00 00       	call   801b54 <bflush>
+  8017fb:	b8 07 00 00 00       	mov    $0x7,%eax
+  801800:	cd 30                	int    $0x30
+  801802:	89 c3                	mov    %eax,%ebx
+  801804:	85 c0                	test   %eax,%eax
+  801806:	78 38                	js     801840 <fork+0x6e>
+  801808:	ba 00 00 80 00       	mov    $0x800000,%edx
+  80180d:	75 4f                	jne    80185e <fork+0x8c>
+  80180f:	e8 a7 02 00 00       	call   801abb <uinfo_envid>
+  801814:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801819:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  80181f:	05 00 00 00 ed       	add    $0xed000000,%eax
+  801824:	a3 20 30 80 00       	mov    %eax,0x803020
+  801829:	e9 c9 00 00 00       	jmp    8018f7 <fork+0x125>
+  80182e:	50                   	push   %eax
+  80182f:	68 6e 22 80 00       	push   $0x80226e
+  801834:	6a 7c                	push   $0x7c
+  801836:	68 20 22 80 00       	push   $0x802220
+  80183b:	e8 17 e9 ff ff       	call   800157 <_panic>
+  801840:	50                   	push   %eax
+  801841:	68 82 22 80 00       	push   $0x802282
+  801846:	68 88 00 00 00       	push   $0x88
+  80184b:	68 20 22 80 00       	push   $0x802220
+  801850:	e8 02 e9 ff ff       	call   800157 <_panic>
+  801855:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801858:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80185e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  801861:	81 fa ff ff ff ea    	cmp    $0xeaffffff,%edx
+  801867:	77 34                	ja     80189d <fork+0xcb>
+  801869:	81 fa 00 f0 ff ea    	cmp    $0xeafff000,%edx
+  80186f:	74 e4                	je     801855 <fork+0x83>
+  801871:	89 d0                	mov    %edx,%eax
+  801873:	c1 e8 16             	shr    $0x16,%eax
+  801876:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80187d:	a8 01                	test   $0x1,%al
+  80187f:	74 d4                	je     801855 <fork+0x83>
+  801881:	89 d0                	mov    %edx,%eax
+  801883:	c1 e8 0c             	shr    $0xc,%eax
+  801886:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80188d:	a8 01                	test   $0x1,%al
+  80188f:	74 c4                	je     801855 <fork+0x83>
+  801891:	c1 ea 0c             	shr    $0xc,%edx
+  801894:	89 d8                	mov    %ebx,%eax
+  801896:	e8 78 fd ff ff       	call   801613 <duppage>
+  80189b:	eb b8                	jmp    801855 <fork+0x83>
+  80189d:	83 ec 04             	sub    $0x4,%esp
+  8018a0:	6a 07                	push   $0x7
+  8018a2:	68 00 f0 ff ea       	push   $0xeafff000
+  8018a7:	53                   	push   %ebx
+  8018a8:	e8 31 f7 ff ff       	call   800fde <sys_page_alloc>
+  8018ad:	83 c4 10             	add    $0x10,%esp
+  8018b0:	85 c0                	test   %eax,%eax
+  8018b2:	78 4a                	js     8018fe <fork+0x12c>
+  8018b4:	a1 20 30 80 00       	mov    0x803020,%eax
+  8018b9:	8b 40 58             	mov    0x58(%eax),%eax
+  8018bc:	83 ec 08             	sub    $0x8,%esp
+  8018bf:	50                   	push   %eax
+  8018c0:	53                   	push   %ebx
+  8018c1:	e8 ba f9 ff ff       	call   801280 <sys_env_set_pgfault_upcall>
+  8018c6:	83 c4 08             	add    $0x8,%esp
+  8018c9:	6a 01                	push   $0x1
+  8018cb:	53                   	push   %ebx
+  8018cc:	e8 f3 f5 ff ff       	call   800ec4 <sys_env_set_cow>
+  8018d1:	83 c4 10             	add    $0x10,%esp
+  8018d4:	85 c0                	test   %eax,%eax
+  8018d6:	78 3b                	js     801913 <fork+0x141>
+  8018d8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8018db:	c1 ea 0c             	shr    $0xc,%edx
+  8018de:	89 d8                	mov    %ebx,%eax
+  8018e0:	e8 2e fd ff ff       	call   801613 <duppage>
+  8018e5:	83 ec 08             	sub    $0x8,%esp
+  8018e8:	6a 02                	push   $0x2
+  8018ea:	53                   	push   %ebx
+  8018eb:	e8 03 f9 ff ff       	call   8011f3 <sys_env_set_status>
+  8018f0:	83 c4 10             	add    $0x10,%esp
+  8018f3:	85 c0                	test   %eax,%eax
+  8018f5:	78 31                	js     801928 <fork+0x156>
+  8018f7:	89 d8                	mov    %ebx,%eax
+  8018f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018fc:	c9                   	leave
+  8018fd:	c3                   	ret
+  8018fe:	50                   	push   %eax
+  8018ff:	68 48 22 80 00       	push   $0x802248
+  801904:	68 a1 00 00 00       	push   $0xa1
+  801909:	68 20 22 80 00       	push   $0x802220
+  80190e:	e8 44 e8 ff ff       	call   800157 <_panic>
+  801913:	50                   	push   %eax
+  801914:	68 6e 22 80 00       	push   $0x80226e
+  801919:	68 a6 00 00 00       	push   $0xa6
+  80191e:	68 20 22 80 00       	push   $0x802220
+  801923:	e8 2f e8 ff ff       	call   800157 <_panic>
+  801928:	50                   	push   %eax
+  801929:	68 92 22 80 00       	push   $0x802292
+  80192e:	68 ad 00 00 00       	push   $0xad
+  801933:	68 20 22 80 00       	push   $0x802220
+  801938:	e8 1a e8 ff ff       	call   800157 <_panic>
+
+0080193d <sfork>:
+  80193d:	55                   	push   %ebp
+  80193e:	89 e5                	mov    %esp,%ebp
+  801940:	83 ec 0c             	sub    $0xc,%esp
+  801943:	68 a9 22 80 00       	push   $0x8022a9
+  801948:	68 b6 00 00 00       	push   $0xb6
+  80194d:	68 20 22 80 00       	push   $0x802220
+  801952:	e8 00 e8 ff ff       	call   800157 <_panic>
+
+00801957 <ipc_recv>:
+  801957:	55                   	push   %ebp
+  801958:	89 e5                	mov    %esp,%ebp
+  80195a:	56                   	push   %esi
+  80195b:	53                   	push   %ebx
+  80195c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80195f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801962:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801965:	85 c0                	test   %eax,%eax
+  801967:	74 41                	je     8019aa <ipc_recv+0x53>
+  801969:	83 ec 0c             	sub    $0xc,%esp
+  80196c:	50                   	push   %eax
+  80196d:	e8 16 fc ff ff       	call   801588 <sys_ipc_recv>
+  801972:	83 c4 10             	add    $0x10,%esp
+  801975:	85 f6                	test   %esi,%esi
+  801977:	74 17                	je     801990 <ipc_recv+0x39>
+  801979:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197e:	85 c0                	test   %eax,%eax
+  801980:	75 0c                	jne    80198e <ipc_recv+0x37>
+  801982:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801988:	8b 92 0c 01 00 00    	mov    0x10c(%edx),%edx
+  80198e:	89 16                	mov    %edx,(%esi)
+  801990:	85 db                	test   %ebx,%ebx
+  801992:	74 42                	je     8019d6 <ipc_recv+0x7f>
+  801994:	85 c0                	test   %eax,%eax
+  801996:	74 24                	je     8019bc <ipc_recv+0x65>
+  801998:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80199e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019a6:	5b                   	pop    %ebx
+  8019a7:	5e                   	pop    %esi
+  8019a8:	5d                   	pop    %ebp
+  8019a9:	c3                   	ret
+  8019aa:	83 ec 0c             	sub    $0xc,%esp
+  8019ad:	68 01 00 00 eb       	push   $0xeb000001
+  8019b2:	e8 d1 fb ff ff       	call   801588 <sys_ipc_recv>
+  8019b7:	83 c4 10             	add    $0x10,%esp
+  8019ba:	eb b9                	jmp    801975 <ipc_recv+0x1e>
+  8019bc:	a1 20 30 80 00       	mov    0x803020,%eax
+  8019c1:	8b 80 10 01 00 00    	mov    0x110(%eax),%eax
+  8019c7:	89 03                	mov    %eax,(%ebx)
+  8019c9:	a1 20 30 80 00       	mov    0x803020,%eax
+  8019ce:	8b 80 08 01 00 00    	mov    0x108(%eax),%eax
+  8019d4:	eb cd                	jmp    8019a3 <ipc_recv+0x4c>
+  8019d6:	85 c0                	test   %eax,%eax
+  8019d8:	74 ef                	je     8019c9 <ipc_recv+0x72>
+  8019da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019df:	eb c2                	jmp    8019a3 <ipc_recv+0x4c>
+
+008019e1 <ipc_send>:
+  8019e1:	55                   	push   %ebp
+  8019e2:	89 e5                	mov    %esp,%ebp
+  8019e4:	57                   	push   %edi
+  8019e5:	56                   	push   %esi
+  8019e6:	53                   	push   %ebx
+  8019e7:	83 ec 0c             	sub    $0xc,%esp
+  8019ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8019ed:	8b 75 10             	mov    0x10(%ebp),%esi
+  8019f0:	eb 21                	jmp    801a13 <ipc_send+0x32>
+  8019f2:	ff 75 14             	push   0x14(%ebp)
+  8019f5:	68 01 00 00 eb       	push   $0xeb000001
+  8019fa:	ff 75 0c             	push   0xc(%ebp)
+  8019fd:	57                   	push   %edi
+  8019fe:	e8 15 fb ff ff       	call   801518 <sys_ipc_try_send>
+  801a03:	89 c3                	mov    %eax,%ebx
+  801a05:	83 c4 10             	add    $0x10,%esp
+  801a08:	eb 1f                	jmp    801a29 <ipc_send+0x48>
+  801a0a:	83 fb f9             	cmp    $0xfffffff9,%ebx
+  801a0d:	74 37                	je     801a46 <ipc_send+0x65>
+  801a0f:	85 db                	test   %ebx,%ebx
+  801a11:	74 3a                	je     801a4d <ipc_send+0x6c>
+  801a13:	85 f6                	test   %esi,%esi
+  801a15:	74 db                	je     8019f2 <ipc_send+0x11>
+  801a17:	ff 75 14             	push   0x14(%ebp)
+  801a1a:	56                   	push   %esi
+  801a1b:	ff 75 0c             	push   0xc(%ebp)
+  801a1e:	57                   	push   %edi
+  801a1f:	e8 f4 fa ff ff       	call   801518 <sys_ipc_try_send>
+  801a24:	89 c3                	mov    %eax,%ebx
+  801a26:	83 c4 10             	add    $0x10,%esp
+  801a29:	85 db                	test   %ebx,%ebx
+  801a2b:	74 dd                	je     801a0a <ipc_send+0x29>
+  801a2d:	83 fb f9             	cmp    $0xfffffff9,%ebx
+  801a30:	74 d8                	je     801a0a <ipc_send+0x29>
+  801a32:	83 ec 04             	sub    $0x4,%esp
+  801a35:	68 bf 22 80 00       	push   $0x8022bf
+  801a3a:	6a 40                	push   $0x40
+  801a3c:	68 d2 22 80 00       	push   $0x8022d2
+  801a41:	e8 11 e7 ff ff       	call   800157 <_panic>
+  801a46:	e8 11 f4 ff ff       	call   800e5c <sys_yield>
+  801a4b:	eb c2                	jmp    801a0f <ipc_send+0x2e>
+  801a4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a50:	5b                   	pop    %ebx
+  801a51:	5e                   	pop    %esi
+  801a52:	5f                   	pop    %edi
+  801a53:	5d                   	pop    %ebp
+  801a54:	c3                   	ret
+
+00801a55 <ipc_find_env>:
+  801a55:	55                   	push   %ebp
+  801a56:	89 e5                	mov    %esp,%ebp
+  801a58:	56                   	push   %esi
+  801a59:	53                   	push   %ebx
+  801a5a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a5d:	b9 7f 03 00 ed       	mov    $0xed00037f,%ecx
+  801a62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a67:	89 c3                	mov    %eax,%ebx
+  801a69:	83 c0 01             	add    $0x1,%eax
+  801a6c:	89 ca                	mov    %ecx,%edx
+  801a6e:	c1 ea 0c             	shr    $0xc,%edx
+  801a71:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a78:	f6 c2 01             	test   $0x1,%dl
+  801a7b:	74 35                	je     801ab2 <ipc_find_env+0x5d>
+  801a7d:	69 d3 80 03 00 00    	imul   $0x380,%ebx,%edx
+  801a83:	81 c2 00 00 00 ed    	add    $0xed000000,%edx
+  801a89:	8b 52 48             	mov    0x48(%edx),%edx
+  801a8c:	81 c1 80 03 00 00    	add    $0x380,%ecx
+  801a92:	39 f2                	cmp    %esi,%edx
+  801a94:	74 0e                	je     801aa4 <ipc_find_env+0x4f>
+  801a96:	3d 00 80 00 00       	cmp    $0x8000,%eax
+  801a9b:	75 ca                	jne    801a67 <ipc_find_env+0x12>
+  801a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa2:	eb 13                	jmp    801ab7 <ipc_find_env+0x62>
+  801aa4:	69 db 80 03 00 00    	imul   $0x380,%ebx,%ebx
+  801aaa:	8b 83 40 00 00 ed    	mov    -0x12ffffc0(%ebx),%eax
+  801ab0:	eb 05                	jmp    801ab7 <ipc_find_env+0x62>
+  801ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab7:	5b                   	pop    %ebx
+  801ab8:	5e                   	pop    %esi
+  801ab9:	5d                   	pop    %ebp
+  801aba:	c3                   	ret
+
+00801abb <uinfo_envid>:
+  801abb:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  801ac0:	c3                   	ret
+
+00801ac1 <uinfo_cpunum>:
+  801ac1:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  801ac6:	c3                   	ret
+
+00801ac7 <uinfo_ticks>:
+  801ac7:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  801acc:	c3                   	ret
+
+00801acd <uinfo_nsec>:
+  801acd:	55                   	push   %ebp
+  801ace:	89 e5                	mov    %esp,%ebp
+  801ad0:	57                   	push   %edi
+  801ad1:	56                   	push   %esi
+  801ad2:	53                   	push   %ebx
+  801ad3:	83 ec 1c             	sub    $0x1c,%esp
+  801ad6:	0f 31                	rdtsc
+  801ad8:	89 c6                	mov    %eax,%esi
+  801ada:	89 d7                	mov    %edx,%edi
+  801adc:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aec:	85 c9                	test   %ecx,%ecx
+  801aee:	74 5c                	je     801b4c <uinfo_nsec+0x7f>
+  801af0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801af8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801afb:	52                   	push   %edx
+  801afc:	51                   	push   %ecx
+  801afd:	57                   	push   %edi
+  801afe:	56                   	push   %esi
+  801aff:	e8 b4 02 00 00       	call   801db8 <__umoddi3>
+  801b04:	83 c4 10             	add    $0x10,%esp
+  801b07:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801b0d:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801b12:	f7 e3                	mul    %ebx
+  801b14:	01 ca                	add    %ecx,%edx
+  801b16:	ff 75 e4             	push   -0x1c(%ebp)
+  801b19:	ff 75 e0             	push   -0x20(%ebp)
+  801b1c:	52                   	push   %edx
+  801b1d:	50                   	push   %eax
+  801b1e:	e8 bd 01 00 00       	call   801ce0 <__udivdi3>
+  801b23:	83 c4 10             	add    $0x10,%esp
+  801b26:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b29:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b2c:	ff 75 e4             	push   -0x1c(%ebp)
+  801b2f:	ff 75 e0             	push   -0x20(%ebp)
+  801b32:	57                   	push   %edi
+  801b33:	56                   	push   %esi
+  801b34:	e8 a7 01 00 00       	call   801ce0 <__udivdi3>
+  801b39:	83 c4 10             	add    $0x10,%esp
+  801b3c:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801b42:	f7 e3                	mul    %ebx
+  801b44:	01 ca                	add    %ecx,%edx
+  801b46:	03 45 d8             	add    -0x28(%ebp),%eax
+  801b49:	13 55 dc             	adc    -0x24(%ebp),%edx
+  801b4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b4f:	5b                   	pop    %ebx
+  801b50:	5e                   	pop    %esi
+  801b51:	5f                   	pop    %edi
+  801b52:	5d                   	pop    %ebp
+  801b53:	c3                   	ret
+
+00801b54 <bflush>:
+  801b54:	a1 40 30 80 00       	mov    0x803040,%eax
+  801b59:	85 c0                	test   %eax,%eax
+  801b5b:	75 01                	jne    801b5e <bflush+0xa>
+  801b5d:	c3                   	ret
+  801b5e:	55                   	push   %ebp
+  801b5f:	89 e5                	mov    %esp,%ebp
+  801b61:	83 ec 10             	sub    $0x10,%esp
+  801b64:	50                   	push   %eax
+  801b65:	68 44 30 80 00       	push   $0x803044
+  801b6a:	e8 2c f1 ff ff       	call   800c9b <sys_cputs>
+  801b6f:	c7 05 40 30 80 00 00 	movl   $0x0,0x803040
+  801b76:	00 00 00 
+  801b79:	83 c4 10             	add    $0x10,%esp
+  801b7c:	c9                   	leave
+  801b7d:	c3                   	ret
+
+00801b7e <bputch>:
+  801b7e:	55                   	push   %ebp
+  801b7f:	89 e5                	mov    %esp,%ebp
+  801b81:	53                   	push   %ebx
+  801b82:	83 ec 04             	sub    $0x4,%esp
+  801b85:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b88:	8b 15 40 30 80 00    	mov    0x803040,%edx
+  801b8e:	8d 42 01             	lea    0x1(%edx),%eax
+  801b91:	a3 40 30 80 00       	mov    %eax,0x803040
+  801b96:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801b99:	88 8a 44 30 80 00    	mov    %cl,0x803044(%edx)
+  801b9f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ba4:	77 08                	ja     801bae <bputch+0x30>
+  801ba6:	83 03 01             	addl   $0x1,(%ebx)
+  801ba9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bac:	c9                   	leave
+  801bad:	c3                   	ret
+  801bae:	e8 a1 ff ff ff       	call   801b54 <bflush>
+  801bb3:	eb f1                	jmp    801ba6 <bputch+0x28>
+
+00801bb5 <vbprintf>:
+  801bb5:	55                   	push   %ebp
+  801bb6:	89 e5                	mov    %esp,%ebp
+  801bb8:	83 ec 18             	sub    $0x18,%esp
+  801bbb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801bc2:	ff 75 0c             	push   0xc(%ebp)
+  801bc5:	ff 75 08             	push   0x8(%ebp)
+  801bc8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bcb:	50                   	push   %eax
+  801bcc:	68 7e 1b 80 00       	push   $0x801b7e
+  801bd1:	e8 58 e7 ff ff       	call   80032e <vprintfmt>
+  801bd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bd9:	c9                   	leave
+  801bda:	c3                   	ret
+
+00801bdb <bprintf>:
+  801bdb:	55                   	push   %ebp
+  801bdc:	89 e5                	mov    %esp,%ebp
+  801bde:	83 ec 10             	sub    $0x10,%esp
+  801be1:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801be4:	50                   	push   %eax
+  801be5:	ff 75 08             	push   0x8(%ebp)
+  801be8:	e8 c8 ff ff ff       	call   801bb5 <vbprintf>
+  801bed:	c9                   	leave
+  801bee:	c3                   	ret
+
+00801bef <bwrite>:
+  801bef:	55                   	push   %ebp
+  801bf0:	89 e5                	mov    %esp,%ebp
+  801bf2:	53                   	push   %ebx
+  801bf3:	83 ec 04             	sub    $0x4,%esp
+  801bf6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801bf9:	89 d8                	mov    %ebx,%eax
+  801bfb:	03 05 40 30 80 00    	add    0x803040,%eax
+  801c01:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c06:	76 0d                	jbe    801c15 <bwrite+0x26>
+  801c08:	e8 47 ff ff ff       	call   801b54 <bflush>
+  801c0d:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801c13:	77 25                	ja     801c3a <bwrite+0x4b>
+  801c15:	83 ec 04             	sub    $0x4,%esp
+  801c18:	53                   	push   %ebx
+  801c19:	ff 75 08             	push   0x8(%ebp)
+  801c1c:	a1 40 30 80 00       	mov    0x803040,%eax
+  801c21:	05 44 30 80 00       	add    $0x803044,%eax
+  801c26:	50                   	push   %eax
+  801c27:	e8 6d ee ff ff       	call   800a99 <memcpy>
+  801c2c:	01 1d 40 30 80 00    	add    %ebx,0x803040
+  801c32:	83 c4 10             	add    $0x10,%esp
+  801c35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c38:	c9                   	leave
+  801c39:	c3                   	ret
+  801c3a:	83 ec 08             	sub    $0x8,%esp
+  801c3d:	53                   	push   %ebx
+  801c3e:	ff 75 08             	push   0x8(%ebp)
+  801c41:	e8 55 f0 ff ff       	call   800c9b <sys_cputs>
+  801c46:	83 c4 10             	add    $0x10,%esp
+  801c49:	eb ea                	jmp    801c35 <bwrite+0x46>
+
+00801c4b <set_pgfault_handler>:
+  801c4b:	55                   	push   %ebp
+  801c4c:	89 e5                	mov    %esp,%ebp
+  801c4e:	83 ec 08             	sub    $0x8,%esp
+  801c51:	83 3d 44 34 80 00 00 	cmpl   $0x0,0x803444
+  801c58:	74 0a                	je     801c64 <set_pgfault_handler+0x19>
+  801c5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c5d:	a3 44 34 80 00       	mov    %eax,0x803444
+  801c62:	c9                   	leave
+  801c63:	c3                   	ret
+  801c64:	83 ec 04             	sub    $0x4,%esp
+  801c67:	6a 07                	push   $0x7
+  801c69:	68 00 f0 ff ea       	push   $0xeafff000
+  801c6e:	6a 00                	push   $0x0
+  801c70:	e8 69 f3 ff ff       	call   800fde <sys_page_alloc>
+  801c75:	83 c4 10             	add    $0x10,%esp
+  801c78:	85 c0                	test   %eax,%eax
+  801c7a:	75 2a                	jne    801ca6 <set_pgfault_handler+0x5b>
+  801c7c:	83 ec 08             	sub    $0x8,%esp
+  801c7f:	68 ba 1c 80 00       	push   $0x801cba
+  801c84:	6a 00                	push   $0x0
+  801c86:	e8 f5 f5 ff ff       	call   801280 <sys_env_set_pgfault_upcall>
+  801c8b:	83 c4 10             	add    $0x10,%esp
+  801c8e:	85 c0                	test   %eax,%eax
+  801c90:	74 c8                	je     801c5a <set_pgfault_handler+0xf>
+  801c92:	83 ec 04             	sub    $0x4,%esp
+  801c95:	68 00 23 80 00       	push   $0x802300
+  801c9a:	6a 28                	push   $0x28
+  801c9c:	68 f2 22 80 00       	push   $0x8022f2
+  801ca1:	e8 b1 e4 ff ff       	call   800157 <_panic>
+  801ca6:	83 ec 04             	sub    $0x4,%esp
+  801ca9:	68 dc 22 80 00       	push   $0x8022dc
+  801cae:	6a 22                	push   $0x22
+  801cb0:	68 f2 22 80 00       	push   $0x8022f2
+  801cb5:	e8 9d e4 ff ff       	call   800157 <_panic>
+
+00801cba <_pgfault_upcall>:
+  801cba:	54                   	push   %esp
+  801cbb:	a1 44 34 80 00       	mov    0x803444,%eax
+  801cc0:	ff d0                	call   *%eax
+  801cc2:	83 c4 04             	add    $0x4,%esp
+  801cc5:	8b 44 24 28          	mov    0x28(%esp),%eax
+  801cc9:	89 e5                	mov    %esp,%ebp
+  801ccb:	8b 64 24 30          	mov    0x30(%esp),%esp
+  801ccf:	50                   	push   %eax
+  801cd0:	89 ec                	mov    %ebp,%esp
+  801cd2:	83 c4 08             	add    $0x8,%esp
+  801cd5:	61                   	popa
+  801cd6:	83 c4 04             	add    $0x4,%esp
+  801cd9:	9d                   	popf
+  801cda:	5c                   	pop    %esp
+  801cdb:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+  801cdf:	c3                   	ret
+
+00801ce0 <__udivdi3>:
+  801ce0:	57                   	push   %edi
+  801ce1:	56                   	push   %esi
+  801ce2:	53                   	push   %ebx
+  801ce3:	83 ec 20             	sub    $0x20,%esp
+  801ce6:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801cea:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801cee:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801cf2:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801cf6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801cfa:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801cfe:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801d02:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801d06:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801d0a:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801d0e:	89 d1                	mov    %edx,%ecx
+  801d10:	09 c1                	or     %eax,%ecx
+  801d12:	0f 84 91 00 00 00    	je     801da9 <__udivdi3+0xc9>
+  801d18:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801d1f:	00 
+  801d20:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801d27:	00 
+  801d28:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d32:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d37:	eb 08                	jmp    801d41 <__udivdi3+0x61>
+  801d39:	83 e9 01             	sub    $0x1,%ecx
+  801d3c:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801d3f:	74 68                	je     801da9 <__udivdi3+0xc9>
+  801d41:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801d45:	01 c0                	add    %eax,%eax
+  801d47:	89 c6                	mov    %eax,%esi
+  801d49:	89 d7                	mov    %edx,%edi
+  801d4b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801d4f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801d53:	0f ad d0             	shrd   %cl,%edx,%eax
+  801d56:	d3 ea                	shr    %cl,%edx
+  801d58:	f6 c1 20             	test   $0x20,%cl
+  801d5b:	74 04                	je     801d61 <__udivdi3+0x81>
+  801d5d:	89 d0                	mov    %edx,%eax
+  801d5f:	31 d2                	xor    %edx,%edx
+  801d61:	83 e0 01             	and    $0x1,%eax
+  801d64:	89 04 24             	mov    %eax,(%esp)
+  801d67:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801d6e:	00 
+  801d6f:	8b 04 24             	mov    (%esp),%eax
+  801d72:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801d76:	09 f0                	or     %esi,%eax
+  801d78:	09 fa                	or     %edi,%edx
+  801d7a:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801d7e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801d82:	39 f0                	cmp    %esi,%eax
+  801d84:	89 d3                	mov    %edx,%ebx
+  801d86:	19 fb                	sbb    %edi,%ebx
+  801d88:	72 af                	jb     801d39 <__udivdi3+0x59>
+  801d8a:	29 f0                	sub    %esi,%eax
+  801d8c:	19 fa                	sbb    %edi,%edx
+  801d8e:	89 cf                	mov    %ecx,%edi
+  801d90:	c1 ef 05             	shr    $0x5,%edi
+  801d93:	83 e7 01             	and    $0x1,%edi
+  801d96:	89 fe                	mov    %edi,%esi
+  801d98:	83 f6 01             	xor    $0x1,%esi
+  801d9b:	d3 e6                	shl    %cl,%esi
+  801d9d:	d3 e7                	shl    %cl,%edi
+  801d9f:	09 74 24 18          	or     %esi,0x18(%esp)
+  801da3:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  801da7:	eb 90                	jmp    801d39 <__udivdi3+0x59>
+  801da9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801dad:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  801db1:	83 c4 20             	add    $0x20,%esp
+  801db4:	5b                   	pop    %ebx
+  801db5:	5e                   	pop    %esi
+  801db6:	5f                   	pop    %edi
+  801db7:	c3                   	ret
+
+00801db8 <__umoddi3>:
+  801db8:	55                   	push   %ebp
+  801db9:	57                   	push   %edi
+  801dba:	56                   	push   %esi
+  801dbb:	53                   	push   %ebx
+  801dbc:	83 ec 1c             	sub    $0x1c,%esp
+  801dbf:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801dc3:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801dc7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801dcb:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801dcf:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801dd3:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801dd7:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801ddb:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801ddf:	89 d6                	mov    %edx,%esi
+  801de1:	09 c6                	or     %eax,%esi
+  801de3:	74 6c                	je     801e51 <__umoddi3+0x99>
+  801de5:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801dea:	b8 00 00 00 00       	mov    $0x0,%eax
+  801def:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df4:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801df8:	eb 0e                	jmp    801e08 <__umoddi3+0x50>
+  801dfa:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801dff:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801e03:	83 fe ff             	cmp    $0xffffffff,%esi
+  801e06:	74 49                	je     801e51 <__umoddi3+0x99>
+  801e08:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801e0c:	01 c0                	add    %eax,%eax
+  801e0e:	89 c3                	mov    %eax,%ebx
+  801e10:	89 d6                	mov    %edx,%esi
+  801e12:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801e16:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801e1a:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801e1f:	0f ad d0             	shrd   %cl,%edx,%eax
+  801e22:	d3 ea                	shr    %cl,%edx
+  801e24:	f6 c1 20             	test   $0x20,%cl
+  801e27:	74 04                	je     801e2d <__umoddi3+0x75>
+  801e29:	89 d0                	mov    %edx,%eax
+  801e2b:	31 d2                	xor    %edx,%edx
+  801e2d:	83 e0 01             	and    $0x1,%eax
+  801e30:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801e35:	89 ea                	mov    %ebp,%edx
+  801e37:	09 d8                	or     %ebx,%eax
+  801e39:	09 f2                	or     %esi,%edx
+  801e3b:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801e3f:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801e43:	39 d8                	cmp    %ebx,%eax
+  801e45:	89 d1                	mov    %edx,%ecx
+  801e47:	19 f1                	sbb    %esi,%ecx
+  801e49:	72 af                	jb     801dfa <__umoddi3+0x42>
+  801e4b:	29 d8                	sub    %ebx,%eax
+  801e4d:	19 f2                	sbb    %esi,%edx
+  801e4f:	eb a9                	jmp    801dfa <__umoddi3+0x42>
+  801e51:	83 c4 1c             	add    $0x1c,%esp
+  801e54:	5b                   	pop    %ebx
+  801e55:	5e                   	pop    %esi
+  801e56:	5f                   	pop    %edi
+  801e57:	5d                   	pop    %ebp
+  801e58:	c3                   	ret
+
+00801e59 <__divdi3>:
+  801e59:	53                   	push   %ebx
+  801e5a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801e5e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801e62:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801e66:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801e6a:	85 d2                	test   %edx,%edx
+  801e6c:	78 12                	js     801e80 <__divdi3+0x27>
+  801e6e:	85 db                	test   %ebx,%ebx
+  801e70:	78 2e                	js     801ea0 <__divdi3+0x47>
+  801e72:	53                   	push   %ebx
+  801e73:	51                   	push   %ecx
+  801e74:	52                   	push   %edx
+  801e75:	50                   	push   %eax
+  801e76:	e8 65 fe ff ff       	call   801ce0 <__udivdi3>
+  801e7b:	83 c4 10             	add    $0x10,%esp
+  801e7e:	eb 1e                	jmp    801e9e <__divdi3+0x45>
+  801e80:	f7 d8                	neg    %eax
+  801e82:	83 d2 00             	adc    $0x0,%edx
+  801e85:	f7 da                	neg    %edx
+  801e87:	85 db                	test   %ebx,%ebx
+  801e89:	78 2a                	js     801eb5 <__divdi3+0x5c>
+  801e8b:	53                   	push   %ebx
+  801e8c:	51                   	push   %ecx
+  801e8d:	52                   	push   %edx
+  801e8e:	50                   	push   %eax
+  801e8f:	e8 4c fe ff ff       	call   801ce0 <__udivdi3>
+  801e94:	83 c4 10             	add    $0x10,%esp
+  801e97:	f7 d8                	neg    %eax
+  801e99:	83 d2 00             	adc    $0x0,%edx
+  801e9c:	f7 da                	neg    %edx
+  801e9e:	5b                   	pop    %ebx
+  801e9f:	c3                   	ret
+  801ea0:	f7 d9                	neg    %ecx
+  801ea2:	83 d3 00             	adc    $0x0,%ebx
+  801ea5:	f7 db                	neg    %ebx
+  801ea7:	53                   	push   %ebx
+  801ea8:	51                   	push   %ecx
+  801ea9:	52                   	push   %edx
+  801eaa:	50                   	push   %eax
+  801eab:	e8 30 fe ff ff       	call   801ce0 <__udivdi3>
+  801eb0:	83 c4 10             	add    $0x10,%esp
+  801eb3:	eb e2                	jmp    801e97 <__divdi3+0x3e>
+  801eb5:	f7 d9                	neg    %ecx
+  801eb7:	83 d3 00             	adc    $0x0,%ebx
+  801eba:	f7 db                	neg    %ebx
+  801ebc:	53                   	push   %ebx
+  801ebd:	51                   	push   %ecx
+  801ebe:	52                   	push   %edx
+  801ebf:	50                   	push   %eax
+  801ec0:	e8 1b fe ff ff       	call   801ce0 <__udivdi3>
+  801ec5:	83 c4 10             	add    $0x10,%esp
+  801ec8:	eb d4                	jmp    801e9e <__divdi3+0x45>
+
+00801eca <__moddi3>:
+  801eca:	55                   	push   %ebp
+  801ecb:	57                   	push   %edi
+  801ecc:	56                   	push   %esi
+  801ecd:	53                   	push   %ebx
+  801ece:	83 ec 14             	sub    $0x14,%esp
+  801ed1:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801ed5:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801ed9:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801edd:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801ee1:	85 ed                	test   %ebp,%ebp
+  801ee3:	78 2b                	js     801f10 <__moddi3+0x46>
+  801ee5:	89 c6                	mov    %eax,%esi
+  801ee7:	f7 de                	neg    %esi
+  801ee9:	89 34 24             	mov    %esi,(%esp)
+  801eec:	89 d6                	mov    %edx,%esi
+  801eee:	83 d6 00             	adc    $0x0,%esi
+  801ef1:	f7 de                	neg    %esi
+  801ef3:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801ef7:	8b 34 24             	mov    (%esp),%esi
+  801efa:	0f 48 f0             	cmovs  %eax,%esi
+  801efd:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801f02:	52                   	push   %edx
+  801f03:	56                   	push   %esi
+  801f04:	55                   	push   %ebp
+  801f05:	57                   	push   %edi
+  801f06:	e8 ad fe ff ff       	call   801db8 <__umoddi3>
+  801f0b:	83 c4 10             	add    $0x10,%esp
+  801f0e:	eb 3c                	jmp    801f4c <__moddi3+0x82>
+  801f10:	89 c3                	mov    %eax,%ebx
+  801f12:	f7 db                	neg    %ebx
+  801f14:	89 d1                	mov    %edx,%ecx
+  801f16:	83 d1 00             	adc    $0x0,%ecx
+  801f19:	f7 d9                	neg    %ecx
+  801f1b:	0f 49 c3             	cmovns %ebx,%eax
+  801f1e:	89 04 24             	mov    %eax,(%esp)
+  801f21:	0f 49 d1             	cmovns %ecx,%edx
+  801f24:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801f28:	ff 74 24 04          	push   0x4(%esp)
+  801f2c:	ff 74 24 04          	push   0x4(%esp)
+  801f30:	89 f8                	mov    %edi,%eax
+  801f32:	89 ea                	mov    %ebp,%edx
+  801f34:	f7 d8                	neg    %eax
+  801f36:	83 d2 00             	adc    $0x0,%edx
+  801f39:	f7 da                	neg    %edx
+  801f3b:	52                   	push   %edx
+  801f3c:	50                   	push   %eax
+  801f3d:	e8 76 fe ff ff       	call   801db8 <__umoddi3>
+  801f42:	83 c4 10             	add    $0x10,%esp
+  801f45:	f7 d8                	neg    %eax
+  801f47:	83 d2 00             	adc    $0x0,%edx
+  801f4a:	f7 da                	neg    %edx
+  801f4c:	83 c4 14             	add    $0x14,%esp
+  801f4f:	5b                   	pop    %ebx
+  801f50:	5e                   	pop    %esi
+  801f51:	5f                   	pop    %edi
+  801f52:	5d                   	pop    %ebp
+  801f53:	c3                   	ret
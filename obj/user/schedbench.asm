@@ -0,0 +1,3100 @@
+
+obj/user/schedbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 f6 00 00 00       	call   800127 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	e8 e6 0d 00 00       	call   800e27 <sys_getenvid>
+  800041:	89 c7                	mov    %eax,%edi
+  800043:	83 ec 04             	sub    $0x4,%esp
+  800046:	68 00 10 00 00       	push   $0x1000
+  80004b:	6a 08                	push   $0x8
+  80004d:	68 a0 1f 80 00       	push   $0x801fa0
+  800052:	e8 13 02 00 00       	call   80026a <cprintf>
+  800057:	83 c4 10             	add    $0x10,%esp
+  80005a:	bb 09 00 00 00       	mov    $0x9,%ebx
+  80005f:	83 eb 01             	sub    $0x1,%ebx
+  800062:	74 69                	je     8000cd <umain+0x9a>
+  800064:	e8 9c 17 00 00       	call   801805 <fork>
+  800069:	85 c0                	test   %eax,%eax
+  80006b:	78 1f                	js     80008c <umain+0x59>
+  80006d:	75 f0                	jne    80005f <umain+0x2c>
+  80006f:	0f 31                	rdtsc
+  800071:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800074:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800077:	bb 01 10 00 00       	mov    $0x1001,%ebx
+  80007c:	89 fe                	mov    %edi,%esi
+  80007e:	81 e6 ff 7f 00 00    	and    $0x7fff,%esi
+  800084:	69 f6 80 03 00 00    	imul   $0x380,%esi,%esi
+  80008a:	eb 1d                	jmp    8000a9 <umain+0x76>
+  80008c:	50                   	push   %eax
+  80008d:	68 29 23 80 00       	push   $0x802329
+  800092:	6a 29                	push   $0x29
+  800094:	68 c5 1f 80 00       	push   $0x801fc5
+  800099:	e8 ec 00 00 00       	call   80018a <_panic>
+  80009e:	e8 ec 0d 00 00       	call   800e8f <sys_yield>
+  8000a3:	8b 86 00 00 00 ed    	mov    -0x13000000(%esi),%eax
+  8000a9:	83 eb 01             	sub    $0x1,%ebx
+  8000ac:	75 f0                	jne    80009e <umain+0x6b>
+  8000ae:	0f 31                	rdtsc
+  8000b0:	6a 00                	push   $0x0
+  8000b2:	6a 00                	push   $0x0
+  8000b4:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  8000b7:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  8000ba:	0f ac d0 0c          	shrd   $0xc,%edx,%eax
+  8000be:	c1 ea 0c             	shr    $0xc,%edx
+  8000c1:	50                   	push   %eax
+  8000c2:	57                   	push   %edi
+  8000c3:	e8 4c 19 00 00       	call   801a14 <ipc_send>
+  8000c8:	83 c4 10             	add    $0x10,%esp
+  8000cb:	eb 52                	jmp    80011f <umain+0xec>
+  8000cd:	89 de                	mov    %ebx,%esi
+  8000cf:	bf 09 00 00 00       	mov    $0x9,%edi
+  8000d4:	eb 18                	jmp    8000ee <umain+0xbb>
+  8000d6:	83 ec 04             	sub    $0x4,%esp
+  8000d9:	6a 00                	push   $0x0
+  8000db:	6a 00                	push   $0x0
+  8000dd:	6a 00                	push   $0x0
+  8000df:	e8 a6 18 00 00       	call   80198a <ipc_recv>
+  8000e4:	01 c3                	add    %eax,%ebx
+  8000e6:	39 c6                	cmp    %eax,%esi
+  8000e8:	0f 42 f0             	cmovb  %eax,%esi
+  8000eb:	83 c4 10             	add    $0x10,%esp
+  8000ee:	83 ef 01             	sub    $0x1,%edi
+  8000f1:	75 e3                	jne    8000d6 <umain+0xa3>
+  8000f3:	83 ec 04             	sub    $0x4,%esp
+  8000f6:	c1 eb 03             	shr    $0x3,%ebx
+  8000f9:	53                   	push   %ebx
+  8000fa:	68 d7 1f 80 00       	push   $0x801fd7
+  8000ff:	68 e8 1f 80 00       	push   $0x801fe8
+  800104:	e8 61 01 00 00       	call   80026a <cprintf>
+  800109:	83 c4 0c             	add    $0xc,%esp
+  80010c:	56                   	push   %esi
+  80010d:	68 ff 1f 80 00       	push   $0x801fff
+  800112:	68 e8 1f 80 00       	push   $0x801fe8
+  800117:	e8 4e 01 00 00       	call   80026a <cprintf>
+  80011c:	83 c4 10             	add    $0x10,%esp
+  80011f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800122:	5b                   	pop    %ebx
+  800123:	5e                   	pop    %esi
+  800124:	5f                   	pop    %edi
+  800125:	5d                   	pop    %ebp
+  800126:	c3                   	ret
+
+00800127 <libmain>:
+  800127:	55                   	push   %ebp
+  800128:	89 e5                	mov    %esp,%ebp
+  80012a:	56                   	push   %esi
+  80012b:	53                   	push   %ebx
+  80012c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80012f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800132:	e8 b7 19 00 00       	call   801aee <uinfo_envid>
+  800137:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80013c:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  800142:	05 00 00 00 ed       	add    $0xed000000,%eax
+  800147:	a3 20 30 80 00       	mov    %eax,0x803020
+  80014c:	85 db                	test   %ebx,%ebx
+  80014e:	7e 07                	jle    800157 <libmain+0x30>
+  800150:	8b 06                	mov    (%esi),%eax
+  800152:	a3 00 30 80 00       	mov    %eax,0x803000
+  800157:	83 ec 08             	sub    $0x8,%esp
+  80015a:	56                   	push   %esi
+  80015b:	53                   	push   %ebx
+  80015c:	e8 d2 fe ff ff       	call   800033 <umain>
+  800161:	e8 0a 00 00 00       	call   800170 <exit>
+  800166:	83 c4 10             	add    $0x10,%esp
+  800169:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80016c:	5b                   	pop    %ebx
+  80016d:	5e                   	pop    %esi
+  80016e:	5d                   	pop    %ebp
+  80016f:	c3                   	ret
+
+00800170 <exit>:
+  800170:	55                   	push   %ebp
+  800171:	89 e5                	mov    %esp,%ebp
+  800173:	83 ec 08             	sub    $0x8,%esp
+  800176:	e8 0c 1a 00 00       	call   801b87 <bflush>
+  80017b:	83 ec 0c             	sub    $0xc,%esp
+  80017e:	6a 00                	push   $0x0
+  800180:	e8 17 0c 00 00       	call   800d9c <sys_env_destroy>
+  800185:	83 c4 10             	add    $0x10,%esp
+  800188:	c9                   	leave
+  800189:	c3                   	ret
+
+0080018a <_panic>:
+  80018a:	55                   	push   %ebp
+  80018b:	89 e5                	mov    %esp,%ebp
+  80018d:	56                   	push   %esi
+  80018e:	53                   	push   %ebx
+  80018f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800192:	e8 f0 19 00 00       	call   801b87 <bflush>
+  800197:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80019d:	e8 85 0c 00 00       	call   800e27 <sys_getenvid>
+  8001a2:	83 ec 0c             	sub    $0xc,%esp
+  8001a5:	ff 75 0c             	push   0xc(%ebp)
+  8001a8:	ff 75 08             	push   0x8(%ebp)
+  8001ab:	56                   	push   %esi
+  8001ac:	50                   	push   %eax
+  8001ad:	68 24 20 80 00       	push   $0x802024
+  8001b2:	e8 b3 00 00 00       	call   80026a <cprintf>
+  8001b7:	83 c4 18             	add    $0x18,%esp
+  8001ba:	53                   	push   %ebx
+  8001bb:	ff 75 10             	push   0x10(%ebp)
+  8001be:	e8 56 00 00 00       	call   800219 <vcprintf>
+  8001c3:	c7 04 24 fd 1f 80 00 	movl   $0x801ffd,(%esp)
+  8001ca:	e8 9b 00 00 00       	call   80026a <cprintf>
+  8001cf:	83 c4 10             	add    $0x10,%esp
+  8001d2:	cc                   	int3
+  8001d3:	eb fd                	jmp    8001d2 <_panic+0x48>
+
+008001d5 <putch>:
+  8001d5:	55                   	push   %ebp
+  8001d6:	89 e5                	mov    %esp,%ebp
+  8001d8:	53                   	push   %ebx
+  8001d9:	83 ec 04             	sub    $0x4,%esp
+  8001dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001df:	8b 13                	mov    (%ebx),%edx
+  8001e1:	8d 42 01             	lea    0x1(%edx),%eax
+  8001e4:	89 03                	mov    %eax,(%ebx)
+  8001e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001e9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8001ed:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001f2:	74 09                	je     8001fd <putch+0x28>
+  8001f4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8001f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001fb:	c9                   	leave
+  8001fc:	c3                   	ret
+  8001fd:	83 ec 08             	sub    $0x8,%esp
+  800200:	68 ff 00 00 00       	push   $0xff
+  800205:	8d 43 08             	lea    0x8(%ebx),%eax
+  800208:	50                   	push   %eax
+  800209:	e8 c0 0a 00 00       	call   800cce <sys_cputs>
+  80020e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800214:	83 c4 10             	add    $0x10,%esp
+  800217:	eb db                	jmp    8001f4 <putch+0x1f>
+
+00800219 <vcprintf>:
+  800219:	55                   	push   %ebp
+  80021a:	89 e5                	mov    %esp,%ebp
+  80021c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800222:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800229:	00 00 00 
+  80022c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800233:	00 00 00 
+  800236:	ff 75 0c             	push   0xc(%ebp)
+  800239:	ff 75 08             	push   0x8(%ebp)
+  80023c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800242:	50                   	push   %eax
+  800243:	68 d5 01 80 00       	push   $0x8001d5
+  800248:	e8 14 01 00 00       	call   800361 <vprintfmt>
+  80024d:	83 c4 08             	add    $0x8,%esp
+  800250:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800256:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80025c:	50                   	push   %eax
+  80025d:	e8 6c 0a 00 00       	call   800cce <sys_cputs>
+  800262:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800268:	c9                   	leave
+  800269:	c3                   	ret
+
+0080026a <cprintf>:
+  80026a:	55                   	push   %ebp
+  80026b:	89 e5                	mov    %esp,%ebp
+  80026d:	83 ec 10             	sub    $0x10,%esp
+  800270:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800273:	50                   	push   %eax
+  800274:	ff 75 08             	push   0x8(%ebp)
+  800277:	e8 9d ff ff ff       	call   800219 <vcprintf>
+  80027c:	c9                   	leave
+  80027d:	c3                   	ret
+
+0080027e <printnum>:
+  80027e:	55                   	push   %ebp
+  80027f:	89 e5                	mov    %esp,%ebp
+  800281:	57                   	push   %edi
+  800282:	56                   	push   %esi
+  800283:	53                   	push   %ebx
+  800284:	83 ec 1c             	sub    $0x1c,%esp
+  800287:	89 c7                	mov    %eax,%edi
+  800289:	89 d6                	mov    %edx,%esi
+  80028b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800291:	89 d1                	mov    %edx,%ecx
+  800293:	89 c2                	mov    %eax,%edx
+  800295:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800298:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80029b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80029e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8002a1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002a4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002ab:	39 c2                	cmp    %eax,%edx
+  8002ad:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002b0:	72 3e                	jb     8002f0 <printnum+0x72>
+  8002b2:	83 ec 0c             	sub    $0xc,%esp
+  8002b5:	ff 75 18             	push   0x18(%ebp)
+  8002b8:	83 eb 01             	sub    $0x1,%ebx
+  8002bb:	53                   	push   %ebx
+  8002bc:	50                   	push   %eax
+  8002bd:	83 ec 08             	sub    $0x8,%esp
+  8002c0:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c3:	ff 75 e0             	push   -0x20(%ebp)
+  8002c6:	ff 75 dc             	push   -0x24(%ebp)
+  8002c9:	ff 75 d8             	push   -0x28(%ebp)
+  8002cc:	e8 42 1a 00 00       	call   801d13 <__udivdi3>
+  8002d1:	83 c4 18             	add    $0x18,%esp
+  8002d4:	52                   	push   %edx
+  8002d5:	50                   	push   %eax
+  8002d6:	89 f2                	mov    %esi,%edx
+  8002d8:	89 f8                	mov    %edi,%eax
+  8002da:	e8 9f ff ff ff       	call   80027e <printnum>
+  8002df:	83 c4 20             	add    $0x20,%esp
+  8002e2:	eb 13                	jmp    8002f7 <printnum+0x79>
+  8002e4:	83 ec 08             	sub    $0x8,%esp
+  8002e7:	56                   	push   %esi
+  8002e8:	ff 75 18             	push   0x18(%ebp)
+  8002eb:	ff d7                	call   *%edi
+  8002ed:	83 c4 10             	add    $0x10,%esp
+  8002f0:	83 eb 01             	sub    $0x1,%ebx
+  8002f3:	85 db                	test   %ebx,%ebx
+  8002f5:	7f ed                	jg     8002e4 <printnum+0x66>
+  8002f7:	83 ec 08             	sub    $0x8,%esp
+  8002fa:	56                   	push   %esi
+  8002fb:	83 ec 04             	sub    $0x4,%esp
+  8002fe:	ff 75 e4             	push   -0x1c(%ebp)
+  800301:	ff 75 e0             	push   -0x20(%ebp)
+  800304:	ff 75 dc             	push   -0x24(%ebp)
+  800307:	ff 75 d8             	push   -0x28(%ebp)
+  80030a:	e8 dc 1a 00 00       	call   801deb <__umoddi3>
+  80030f:	83 c4 14             	add    $0x14,%esp
+  800312:	0f be 80 47 20 80 00 	movsbl 0x802047(%eax),%eax
+  800319:	50                   	push   %eax
+  80031a:	ff d7                	call   *%edi
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800322:	5b                   	pop    %ebx
+  800323:	5e                   	pop    %esi
+  800324:	5f                   	pop    %edi
+  800325:	5d                   	pop    %ebp
+  800326:	c3                   	ret
+
+00800327 <sprintputch>:
+  800327:	55                   	push   %ebp
+  800328:	89 e5                	mov    %esp,%ebp
+  80032a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80032d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800331:	8b 10                	mov    (%eax),%edx
+  800333:	3b 50 04             	cmp    0x4(%eax),%edx
+  800336:	73 0a                	jae    800342 <sprintputch+0x1b>
+  800338:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80033b:	89 08                	mov    %ecx,(%eax)
+  80033d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800340:	88 02                	mov    %al,(%edx)
+  800342:	5d                   	pop    %ebp
+  800343:	c3                   	ret
+
+00800344 <printfmt>:
+  800344:	55                   	push   %ebp
+  800345:	89 e5                	mov    %esp,%ebp
+  800347:	83 ec 08             	sub    $0x8,%esp
+  80034a:	8d 45 14             	lea    0x14(%ebp),%eax
+  80034d:	50                   	push   %eax
+  80034e:	ff 75 10             	push   0x10(%ebp)
+  800351:	ff 75 0c             	push   0xc(%ebp)
+  800354:	ff 75 08             	push   0x8(%ebp)
+  800357:	e8 05 00 00 00       	call   800361 <vprintfmt>
+  80035c:	83 c4 10             	add    $0x10,%esp
+  80035f:	c9                   	leave
+  800360:	c3                   	ret
+
+00800361 <vprintfmt>:
+  800361:	55                   	push   %ebp
+  800362:	89 e5                	mov    %esp,%ebp
+  800364:	57                   	push   %edi
+  800365:	56                   	push   %esi
+  800366:	53                   	push   %ebx
+  800367:	83 ec 2c             	sub    $0x2c,%esp
+  80036a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80036d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800370:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800373:	eb 0a                	jmp    80037f <vprintfmt+0x1e>
+  800375:	83 ec 08             	sub    $0x8,%esp
+  800378:	53                   	push   %ebx
+  800379:	50                   	push   %eax
+  80037a:	ff d6                	call   *%esi
+  80037c:	83 c4 10             	add    $0x10,%esp
+  80037f:	83 c7 01             	add    $0x1,%edi
+  800382:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800386:	83 f8 25             	cmp    $0x25,%eax
+  800389:	74 0c                	je     800397 <vprintfmt+0x36>
+  80038b:	85 c0                	test   %eax,%eax
+  80038d:	75 e6                	jne    800375 <vprintfmt+0x14>
+  80038f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800392:	5b                   	pop    %ebx
+  800393:	5e                   	pop    %esi
+  800394:	5f                   	pop    %edi
+  800395:	5d                   	pop    %ebp
+  800396:	c3                   	ret
+  800397:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  80039b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8003a2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003a9:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  8003b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003b5:	8d 47 01             	lea    0x1(%edi),%eax
+  8003b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003bb:	0f b6 17             	movzbl (%edi),%edx
+  8003be:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003c1:	3c 55                	cmp    $0x55,%al
+  8003c3:	0f 87 cf 03 00 00    	ja     800798 <vprintfmt+0x437>
+  8003c9:	0f b6 c0             	movzbl %al,%eax
+  8003cc:	ff 24 85 00 21 80 00 	jmp    *0x802100(,%eax,4)
+  8003d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003d6:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003da:	eb d9                	jmp    8003b5 <vprintfmt+0x54>
+  8003dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003df:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003e3:	eb d0                	jmp    8003b5 <vprintfmt+0x54>
+  8003e5:	0f b6 d2             	movzbl %dl,%edx
+  8003e8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8003f3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003f6:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  8003fa:	0f be 17             	movsbl (%edi),%edx
+  8003fd:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800400:	83 f9 09             	cmp    $0x9,%ecx
+  800403:	77 55                	ja     80045a <vprintfmt+0xf9>
+  800405:	83 c7 01             	add    $0x1,%edi
+  800408:	eb e9                	jmp    8003f3 <vprintfmt+0x92>
+  80040a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040d:	8b 00                	mov    (%eax),%eax
+  80040f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800412:	8b 45 14             	mov    0x14(%ebp),%eax
+  800415:	8d 40 04             	lea    0x4(%eax),%eax
+  800418:	89 45 14             	mov    %eax,0x14(%ebp)
+  80041b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80041e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800422:	79 91                	jns    8003b5 <vprintfmt+0x54>
+  800424:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800427:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80042a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800431:	eb 82                	jmp    8003b5 <vprintfmt+0x54>
+  800433:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800436:	85 d2                	test   %edx,%edx
+  800438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043d:	0f 49 c2             	cmovns %edx,%eax
+  800440:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800443:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800446:	e9 6a ff ff ff       	jmp    8003b5 <vprintfmt+0x54>
+  80044b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80044e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800455:	e9 5b ff ff ff       	jmp    8003b5 <vprintfmt+0x54>
+  80045a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80045d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800460:	eb bc                	jmp    80041e <vprintfmt+0xbd>
+  800462:	83 c1 01             	add    $0x1,%ecx
+  800465:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800468:	e9 48 ff ff ff       	jmp    8003b5 <vprintfmt+0x54>
+  80046d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800470:	8d 78 04             	lea    0x4(%eax),%edi
+  800473:	83 ec 08             	sub    $0x8,%esp
+  800476:	53                   	push   %ebx
+  800477:	ff 30                	push   (%eax)
+  800479:	ff d6                	call   *%esi
+  80047b:	83 c4 10             	add    $0x10,%esp
+  80047e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800481:	e9 b1 02 00 00       	jmp    800737 <vprintfmt+0x3d6>
+  800486:	8b 45 14             	mov    0x14(%ebp),%eax
+  800489:	8d 78 04             	lea    0x4(%eax),%edi
+  80048c:	8b 10                	mov    (%eax),%edx
+  80048e:	89 d0                	mov    %edx,%eax
+  800490:	f7 d8                	neg    %eax
+  800492:	0f 48 c2             	cmovs  %edx,%eax
+  800495:	83 f8 08             	cmp    $0x8,%eax
+  800498:	7f 23                	jg     8004bd <vprintfmt+0x15c>
+  80049a:	8b 14 85 60 22 80 00 	mov    0x802260(,%eax,4),%edx
+  8004a1:	85 d2                	test   %edx,%edx
+  8004a3:	74 18                	je     8004bd <vprintfmt+0x15c>
+  8004a5:	52                   	push   %edx
+  8004a6:	68 68 20 80 00       	push   $0x802068
+  8004ab:	53                   	push   %ebx
+  8004ac:	56                   	push   %esi
+  8004ad:	e8 92 fe ff ff       	call   800344 <printfmt>
+  8004b2:	83 c4 10             	add    $0x10,%esp
+  8004b5:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004b8:	e9 7a 02 00 00       	jmp    800737 <vprintfmt+0x3d6>
+  8004bd:	50                   	push   %eax
+  8004be:	68 5f 20 80 00       	push   $0x80205f
+  8004c3:	53                   	push   %ebx
+  8004c4:	56                   	push   %esi
+  8004c5:	e8 7a fe ff ff       	call   800344 <printfmt>
+  8004ca:	83 c4 10             	add    $0x10,%esp
+  8004cd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004d0:	e9 62 02 00 00       	jmp    800737 <vprintfmt+0x3d6>
+  8004d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d8:	83 c0 04             	add    $0x4,%eax
+  8004db:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e1:	8b 08                	mov    (%eax),%ecx
+  8004e3:	85 c9                	test   %ecx,%ecx
+  8004e5:	b8 58 20 80 00       	mov    $0x802058,%eax
+  8004ea:	0f 45 c1             	cmovne %ecx,%eax
+  8004ed:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004f0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004f4:	7e 06                	jle    8004fc <vprintfmt+0x19b>
+  8004f6:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004fa:	75 0b                	jne    800507 <vprintfmt+0x1a6>
+  8004fc:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004ff:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800502:	89 75 08             	mov    %esi,0x8(%ebp)
+  800505:	eb 5c                	jmp    800563 <vprintfmt+0x202>
+  800507:	83 ec 08             	sub    $0x8,%esp
+  80050a:	ff 75 d0             	push   -0x30(%ebp)
+  80050d:	ff 75 cc             	push   -0x34(%ebp)
+  800510:	e8 87 03 00 00       	call   80089c <strnlen>
+  800515:	89 c2                	mov    %eax,%edx
+  800517:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80051a:	29 d0                	sub    %edx,%eax
+  80051c:	83 c4 10             	add    $0x10,%esp
+  80051f:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800523:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800526:	89 75 08             	mov    %esi,0x8(%ebp)
+  800529:	89 c6                	mov    %eax,%esi
+  80052b:	eb 0e                	jmp    80053b <vprintfmt+0x1da>
+  80052d:	83 ec 08             	sub    $0x8,%esp
+  800530:	53                   	push   %ebx
+  800531:	57                   	push   %edi
+  800532:	ff 55 08             	call   *0x8(%ebp)
+  800535:	83 ee 01             	sub    $0x1,%esi
+  800538:	83 c4 10             	add    $0x10,%esp
+  80053b:	85 f6                	test   %esi,%esi
+  80053d:	7f ee                	jg     80052d <vprintfmt+0x1cc>
+  80053f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800542:	8b 75 08             	mov    0x8(%ebp),%esi
+  800545:	85 c0                	test   %eax,%eax
+  800547:	ba 00 00 00 00       	mov    $0x0,%edx
+  80054c:	0f 49 d0             	cmovns %eax,%edx
+  80054f:	29 d0                	sub    %edx,%eax
+  800551:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800554:	eb a6                	jmp    8004fc <vprintfmt+0x19b>
+  800556:	83 ec 08             	sub    $0x8,%esp
+  800559:	53                   	push   %ebx
+  80055a:	52                   	push   %edx
+  80055b:	ff 55 08             	call   *0x8(%ebp)
+  80055e:	83 c4 10             	add    $0x10,%esp
+  800561:	89 f1                	mov    %esi,%ecx
+  800563:	8d 71 01             	lea    0x1(%ecx),%esi
+  800566:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80056a:	0f be d0             	movsbl %al,%edx
+  80056d:	85 d2                	test   %edx,%edx
+  80056f:	74 28                	je     800599 <vprintfmt+0x238>
+  800571:	85 ff                	test   %edi,%edi
+  800573:	78 05                	js     80057a <vprintfmt+0x219>
+  800575:	83 ef 01             	sub    $0x1,%edi
+  800578:	78 30                	js     8005aa <vprintfmt+0x249>
+  80057a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80057e:	74 d6                	je     800556 <vprintfmt+0x1f5>
+  800580:	0f be c0             	movsbl %al,%eax
+  800583:	83 e8 20             	sub    $0x20,%eax
+  800586:	83 f8 5e             	cmp    $0x5e,%eax
+  800589:	76 cb                	jbe    800556 <vprintfmt+0x1f5>
+  80058b:	83 ec 08             	sub    $0x8,%esp
+  80058e:	53                   	push   %ebx
+  80058f:	6a 3f                	push   $0x3f
+  800591:	ff 55 08             	call   *0x8(%ebp)
+  800594:	83 c4 10             	add    $0x10,%esp
+  800597:	eb c8                	jmp    800561 <vprintfmt+0x200>
+  800599:	8b 75 08             	mov    0x8(%ebp),%esi
+  80059c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80059f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005a2:	01 d0                	add    %edx,%eax
+  8005a4:	29 c8                	sub    %ecx,%eax
+  8005a6:	89 c7                	mov    %eax,%edi
+  8005a8:	eb 13                	jmp    8005bd <vprintfmt+0x25c>
+  8005aa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ad:	eb ed                	jmp    80059c <vprintfmt+0x23b>
+  8005af:	83 ec 08             	sub    $0x8,%esp
+  8005b2:	53                   	push   %ebx
+  8005b3:	6a 20                	push   $0x20
+  8005b5:	ff d6                	call   *%esi
+  8005b7:	83 ef 01             	sub    $0x1,%edi
+  8005ba:	83 c4 10             	add    $0x10,%esp
+  8005bd:	85 ff                	test   %edi,%edi
+  8005bf:	7f ee                	jg     8005af <vprintfmt+0x24e>
+  8005c1:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c7:	e9 6b 01 00 00       	jmp    800737 <vprintfmt+0x3d6>
+  8005cc:	83 f9 01             	cmp    $0x1,%ecx
+  8005cf:	7f 1f                	jg     8005f0 <vprintfmt+0x28f>
+  8005d1:	85 c9                	test   %ecx,%ecx
+  8005d3:	74 67                	je     80063c <vprintfmt+0x2db>
+  8005d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d8:	8b 00                	mov    (%eax),%eax
+  8005da:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005dd:	89 c1                	mov    %eax,%ecx
+  8005df:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005e2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ee:	eb 17                	jmp    800607 <vprintfmt+0x2a6>
+  8005f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f3:	8b 50 04             	mov    0x4(%eax),%edx
+  8005f6:	8b 00                	mov    (%eax),%eax
+  8005f8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005fb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	8d 40 08             	lea    0x8(%eax),%eax
+  800604:	89 45 14             	mov    %eax,0x14(%ebp)
+  800607:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80060a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80060d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800612:	85 c9                	test   %ecx,%ecx
+  800614:	0f 89 03 01 00 00    	jns    80071d <vprintfmt+0x3bc>
+  80061a:	83 ec 08             	sub    $0x8,%esp
+  80061d:	53                   	push   %ebx
+  80061e:	6a 2d                	push   $0x2d
+  800620:	ff d6                	call   *%esi
+  800622:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800625:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800628:	f7 da                	neg    %edx
+  80062a:	83 d1 00             	adc    $0x0,%ecx
+  80062d:	f7 d9                	neg    %ecx
+  80062f:	83 c4 10             	add    $0x10,%esp
+  800632:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800637:	e9 e1 00 00 00       	jmp    80071d <vprintfmt+0x3bc>
+  80063c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063f:	8b 00                	mov    (%eax),%eax
+  800641:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800644:	89 c1                	mov    %eax,%ecx
+  800646:	c1 f9 1f             	sar    $0x1f,%ecx
+  800649:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80064c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064f:	8d 40 04             	lea    0x4(%eax),%eax
+  800652:	89 45 14             	mov    %eax,0x14(%ebp)
+  800655:	eb b0                	jmp    800607 <vprintfmt+0x2a6>
+  800657:	83 f9 01             	cmp    $0x1,%ecx
+  80065a:	7f 1e                	jg     80067a <vprintfmt+0x319>
+  80065c:	85 c9                	test   %ecx,%ecx
+  80065e:	74 32                	je     800692 <vprintfmt+0x331>
+  800660:	8b 45 14             	mov    0x14(%ebp),%eax
+  800663:	8b 10                	mov    (%eax),%edx
+  800665:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066a:	8d 40 04             	lea    0x4(%eax),%eax
+  80066d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800670:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800675:	e9 a3 00 00 00       	jmp    80071d <vprintfmt+0x3bc>
+  80067a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067d:	8b 10                	mov    (%eax),%edx
+  80067f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800682:	8d 40 08             	lea    0x8(%eax),%eax
+  800685:	89 45 14             	mov    %eax,0x14(%ebp)
+  800688:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80068d:	e9 8b 00 00 00       	jmp    80071d <vprintfmt+0x3bc>
+  800692:	8b 45 14             	mov    0x14(%ebp),%eax
+  800695:	8b 10                	mov    (%eax),%edx
+  800697:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069c:	8d 40 04             	lea    0x4(%eax),%eax
+  80069f:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006a7:	eb 74                	jmp    80071d <vprintfmt+0x3bc>
+  8006a9:	83 f9 01             	cmp    $0x1,%ecx
+  8006ac:	7f 1b                	jg     8006c9 <vprintfmt+0x368>
+  8006ae:	85 c9                	test   %ecx,%ecx
+  8006b0:	74 2c                	je     8006de <vprintfmt+0x37d>
+  8006b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b5:	8b 10                	mov    (%eax),%edx
+  8006b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c2:	bf 08 00 00 00       	mov    $0x8,%edi
+  8006c7:	eb 54                	jmp    80071d <vprintfmt+0x3bc>
+  8006c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cc:	8b 10                	mov    (%eax),%edx
+  8006ce:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d1:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d7:	bf 08 00 00 00       	mov    $0x8,%edi
+  8006dc:	eb 3f                	jmp    80071d <vprintfmt+0x3bc>
+  8006de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e1:	8b 10                	mov    (%eax),%edx
+  8006e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ee:	bf 08 00 00 00       	mov    $0x8,%edi
+  8006f3:	eb 28                	jmp    80071d <vprintfmt+0x3bc>
+  8006f5:	83 ec 08             	sub    $0x8,%esp
+  8006f8:	53                   	push   %ebx
+  8006f9:	6a 30                	push   $0x30
+  8006fb:	ff d6                	call   *%esi
+  8006fd:	83 c4 08             	add    $0x8,%esp
+  800700:	53                   	push   %ebx
+  800701:	6a 78                	push   $0x78
+  800703:	ff d6                	call   *%esi
+  800705:	8b 45 14             	mov    0x14(%ebp),%eax
+  800708:	8b 10                	mov    (%eax),%edx
+  80070a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070f:	83 c4 10             	add    $0x10,%esp
+  800712:	8d 40 04             	lea    0x4(%eax),%eax
+  800715:	89 45 14             	mov    %eax,0x14(%ebp)
+  800718:	bf 10 00 00 00       	mov    $0x10,%edi
+  80071d:	83 ec 0c             	sub    $0xc,%esp
+  800720:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800724:	50                   	push   %eax
+  800725:	ff 75 e0             	push   -0x20(%ebp)
+  800728:	57                   	push   %edi
+  800729:	51                   	push   %ecx
+  80072a:	52                   	push   %edx
+  80072b:	89 da                	mov    %ebx,%edx
+  80072d:	89 f0                	mov    %esi,%eax
+  80072f:	e8 4a fb ff ff       	call   80027e <printnum>
+  800734:	83 c4 20             	add    $0x20,%esp
+  800737:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80073a:	e9 40 fc ff ff       	jmp    80037f <vprintfmt+0x1e>
+  80073f:	83 f9 01             	cmp    $0x1,%ecx
+  800742:	7f 1b                	jg     80075f <vprintfmt+0x3fe>
+  800744:	85 c9                	test   %ecx,%ecx
+  800746:	74 2c                	je     800774 <vprintfmt+0x413>
+  800748:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074b:	8b 10                	mov    (%eax),%edx
+  80074d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800752:	8d 40 04             	lea    0x4(%eax),%eax
+  800755:	89 45 14             	mov    %eax,0x14(%ebp)
+  800758:	bf 10 00 00 00       	mov    $0x10,%edi
+  80075d:	eb be                	jmp    80071d <vprintfmt+0x3bc>
+  80075f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800762:	8b 10                	mov    (%eax),%edx
+  800764:	8b 48 04             	mov    0x4(%eax),%ecx
+  800767:	8d 40 08             	lea    0x8(%eax),%eax
+  80076a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076d:	bf 10 00 00 00       	mov    $0x10,%edi
+  800772:	eb a9                	jmp    80071d <vprintfmt+0x3bc>
+  800774:	8b 45 14             	mov    0x14(%ebp),%eax
+  800777:	8b 10                	mov    (%eax),%edx
+  800779:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077e:	8d 40 04             	lea    0x4(%eax),%eax
+  800781:	89 45 14             	mov    %eax,0x14(%ebp)
+  800784:	bf 10 00 00 00       	mov    $0x10,%edi
+  800789:	eb 92                	jmp    80071d <vprintfmt+0x3bc>
+  80078b:	83 ec 08             	sub    $0x8,%esp
+  80078e:	53                   	push   %ebx
+  80078f:	6a 25                	push   $0x25
+  800791:	ff d6                	call   *%esi
+  800793:	83 c4 10             	add    $0x10,%esp
+  800796:	eb 9f                	jmp    800737 <vprintfmt+0x3d6>
+  800798:	83 ec 08             	sub    $0x8,%esp
+  80079b:	53                   	push   %ebx
+  80079c:	6a 25                	push   $0x25
+  80079e:	ff d6                	call   *%esi
+  8007a0:	83 c4 10             	add    $0x10,%esp
+  8007a3:	89 f8                	mov    %edi,%eax
+  8007a5:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007a9:	74 05                	je     8007b0 <vprintfmt+0x44f>
+  8007ab:	83 e8 01             	sub    $0x1,%eax
+  8007ae:	eb f5                	jmp    8007a5 <vprintfmt+0x444>
+  8007b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007b3:	eb 82                	jmp    800737 <vprintfmt+0x3d6>
+
+008007b5 <vsnprintf>:
+  8007b5:	55                   	push   %ebp
+  8007b6:	89 e5                	mov    %esp,%ebp
+  8007b8:	83 ec 18             	sub    $0x18,%esp
+  8007bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007c1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007c4:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007c8:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007cb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8007d2:	85 c0                	test   %eax,%eax
+  8007d4:	74 26                	je     8007fc <vsnprintf+0x47>
+  8007d6:	85 d2                	test   %edx,%edx
+  8007d8:	7e 22                	jle    8007fc <vsnprintf+0x47>
+  8007da:	ff 75 14             	push   0x14(%ebp)
+  8007dd:	ff 75 10             	push   0x10(%ebp)
+  8007e0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007e3:	50                   	push   %eax
+  8007e4:	68 27 03 80 00       	push   $0x800327
+  8007e9:	e8 73 fb ff ff       	call   800361 <vprintfmt>
+  8007ee:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007f1:	c6 00 00             	movb   $0x0,(%eax)
+  8007f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007f7:	83 c4 10             	add    $0x10,%esp
+  8007fa:	c9                   	leave
+  8007fb:	c3                   	ret
+  8007fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800801:	eb f7                	jmp    8007fa <vsnprintf+0x45>
+
+00800803 <snprintf>:
+  800803:	55                   	push   %ebp
+  800804:	89 e5                	mov    %esp,%ebp
+  800806:	83 ec 08             	sub    $0x8,%esp
+  800809:	8d 45 14             	lea    0x14(%ebp),%eax
+  80080c:	50                   	push   %eax
+  80080d:	ff 75 10             	push   0x10(%ebp)
+  800810:	ff 75 0c             	push   0xc(%ebp)
+  800813:	ff 75 08             	push   0x8(%ebp)
+  800816:	e8 9a ff ff ff       	call   8007b5 <vsnprintf>
+  80081b:	c9                   	leave
+  80081c:	c3                   	ret
+
+0080081d <copy_fwd>:
+  80081d:	55                   	push   %ebp
+  80081e:	89 e5                	mov    %esp,%ebp
+  800820:	57                   	push   %edi
+  800821:	56                   	push   %esi
+  800822:	53                   	push   %ebx
+  800823:	89 c7                	mov    %eax,%edi
+  800825:	89 d6                	mov    %edx,%esi
+  800827:	89 c8                	mov    %ecx,%eax
+  800829:	83 f9 0f             	cmp    $0xf,%ecx
+  80082c:	76 1c                	jbe    80084a <copy_fwd+0x2d>
+  80082e:	89 f9                	mov    %edi,%ecx
+  800830:	f7 d9                	neg    %ecx
+  800832:	89 cb                	mov    %ecx,%ebx
+  800834:	83 e3 03             	and    $0x3,%ebx
+  800837:	29 d8                	sub    %ebx,%eax
+  800839:	89 c2                	mov    %eax,%edx
+  80083b:	c1 ea 02             	shr    $0x2,%edx
+  80083e:	83 e0 03             	and    $0x3,%eax
+  800841:	89 d9                	mov    %ebx,%ecx
+  800843:	fc                   	cld
+  800844:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800846:	89 d1                	mov    %edx,%ecx
+  800848:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80084a:	89 c1                	mov    %eax,%ecx
+  80084c:	fc                   	cld
+  80084d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80084f:	5b                   	pop    %ebx
+  800850:	5e                   	pop    %esi
+  800851:	5f                   	pop    %edi
+  800852:	5d                   	pop    %ebp
+  800853:	c3                   	ret
+
+00800854 <have_sse2>:
+  800854:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80085b:	78 06                	js     800863 <have_sse2+0xf>
+  80085d:	a1 04 30 80 00       	mov    0x803004,%eax
+  800862:	c3                   	ret
+  800863:	55                   	push   %ebp
+  800864:	89 e5                	mov    %esp,%ebp
+  800866:	53                   	push   %ebx
+  800867:	b8 01 00 00 00       	mov    $0x1,%eax
+  80086c:	0f a2                	cpuid
+  80086e:	c1 ea 1a             	shr    $0x1a,%edx
+  800871:	83 e2 01             	and    $0x1,%edx
+  800874:	89 15 04 30 80 00    	mov    %edx,0x803004
+  80087a:	a1 04 30 80 00       	mov    0x803004,%eax
+  80087f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800882:	c9                   	leave
+  800883:	c3                   	ret
+
+00800884 <strlen>:
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	8b 55 08             	mov    0x8(%ebp),%edx
+  80088a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088f:	eb 03                	jmp    800894 <strlen+0x10>
+  800891:	83 c0 01             	add    $0x1,%eax
+  800894:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800898:	75 f7                	jne    800891 <strlen+0xd>
+  80089a:	5d                   	pop    %ebp
+  80089b:	c3                   	ret
+
+0080089c <strnlen>:
+  80089c:	55                   	push   %ebp
+  80089d:	89 e5                	mov    %esp,%ebp
+  80089f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008aa:	eb 03                	jmp    8008af <strnlen+0x13>
+  8008ac:	83 c0 01             	add    $0x1,%eax
+  8008af:	39 d0                	cmp    %edx,%eax
+  8008b1:	74 08                	je     8008bb <strnlen+0x1f>
+  8008b3:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008b7:	75 f3                	jne    8008ac <strnlen+0x10>
+  8008b9:	89 c2                	mov    %eax,%edx
+  8008bb:	89 d0                	mov    %edx,%eax
+  8008bd:	5d                   	pop    %ebp
+  8008be:	c3                   	ret
+
+008008bf <strcpy>:
+  8008bf:	55                   	push   %ebp
+  8008c0:	89 e5                	mov    %esp,%ebp
+  8008c2:	53                   	push   %ebx
+  8008c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ce:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008d2:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008d5:	83 c0 01             	add    $0x1,%eax
+  8008d8:	84 d2                	test   %dl,%dl
+  8008da:	75 f2                	jne    8008ce <strcpy+0xf>
+  8008dc:	89 c8                	mov    %ecx,%eax
+  8008de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e1:	c9                   	leave
+  8008e2:	c3                   	ret
+
+008008e3 <strcat>:
+  8008e3:	55                   	push   %ebp
+  8008e4:	89 e5                	mov    %esp,%ebp
+  8008e6:	53                   	push   %ebx
+  8008e7:	83 ec 10             	sub    $0x10,%esp
+  8008ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8008ed:	53                   	push   %ebx
+  8008ee:	e8 91 ff ff ff       	call   800884 <strlen>
+  8008f3:	83 c4 08             	add    $0x8,%esp
+  8008f6:	ff 75 0c             	push   0xc(%ebp)
+  8008f9:	01 d8                	add    %ebx,%eax
+  8008fb:	50                   	push   %eax
+  8008fc:	e8 be ff ff ff       	call   8008bf <strcpy>
+  800901:	89 d8                	mov    %ebx,%eax
+  800903:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800906:	c9                   	leave
+  800907:	c3                   	ret
+
+00800908 <strncpy>:
+  800908:	55                   	push   %ebp
+  800909:	89 e5                	mov    %esp,%ebp
+  80090b:	56                   	push   %esi
+  80090c:	53                   	push   %ebx
+  80090d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800910:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800913:	89 f3                	mov    %esi,%ebx
+  800915:	03 5d 10             	add    0x10(%ebp),%ebx
+  800918:	89 f0                	mov    %esi,%eax
+  80091a:	eb 0f                	jmp    80092b <strncpy+0x23>
+  80091c:	83 c0 01             	add    $0x1,%eax
+  80091f:	0f b6 0a             	movzbl (%edx),%ecx
+  800922:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800925:	80 f9 01             	cmp    $0x1,%cl
+  800928:	83 da ff             	sbb    $0xffffffff,%edx
+  80092b:	39 d8                	cmp    %ebx,%eax
+  80092d:	75 ed                	jne    80091c <strncpy+0x14>
+  80092f:	89 f0                	mov    %esi,%eax
+  800931:	5b                   	pop    %ebx
+  800932:	5e                   	pop    %esi
+  800933:	5d                   	pop    %ebp
+  800934:	c3                   	ret
+
+00800935 <strlcpy>:
+  800935:	55                   	push   %ebp
+  800936:	89 e5                	mov    %esp,%ebp
+  800938:	56                   	push   %esi
+  800939:	53                   	push   %ebx
+  80093a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80093d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800940:	8b 55 10             	mov    0x10(%ebp),%edx
+  800943:	89 f0                	mov    %esi,%eax
+  800945:	85 d2                	test   %edx,%edx
+  800947:	74 21                	je     80096a <strlcpy+0x35>
+  800949:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80094d:	89 f2                	mov    %esi,%edx
+  80094f:	eb 09                	jmp    80095a <strlcpy+0x25>
+  800951:	83 c1 01             	add    $0x1,%ecx
+  800954:	83 c2 01             	add    $0x1,%edx
+  800957:	88 5a ff             	mov    %bl,-0x1(%edx)
+  80095a:	39 c2                	cmp    %eax,%edx
+  80095c:	74 09                	je     800967 <strlcpy+0x32>
+  80095e:	0f b6 19             	movzbl (%ecx),%ebx
+  800961:	84 db                	test   %bl,%bl
+  800963:	75 ec                	jne    800951 <strlcpy+0x1c>
+  800965:	89 d0                	mov    %edx,%eax
+  800967:	c6 00 00             	movb   $0x0,(%eax)
+  80096a:	29 f0                	sub    %esi,%eax
+  80096c:	5b                   	pop    %ebx
+  80096d:	5e                   	pop    %esi
+  80096e:	5d                   	pop    %ebp
+  80096f:	c3                   	ret
+
+00800970 <strcmp>:
+  800970:	55                   	push   %ebp
+  800971:	89 e5                	mov    %esp,%ebp
+  800973:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800976:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800979:	eb 06                	jmp    800981 <strcmp+0x11>
+  80097b:	83 c1 01             	add    $0x1,%ecx
+  80097e:	83 c2 01             	add    $0x1,%edx
+  800981:	0f b6 01             	movzbl (%ecx),%eax
+  800984:	84 c0                	test   %al,%al
+  800986:	74 04                	je     80098c <strcmp+0x1c>
+  800988:	3a 02                	cmp    (%edx),%al
+  80098a:	74 ef                	je     80097b <strcmp+0xb>
+  80098c:	0f b6 c0             	movzbl %al,%eax
+  80098f:	0f b6 12             	movzbl (%edx),%edx
+  800992:	29 d0                	sub    %edx,%eax
+  800994:	5d                   	pop    %ebp
+  800995:	c3                   	ret
+
+00800996 <strncmp>:
+  800996:	55                   	push   %ebp
+  800997:	89 e5                	mov    %esp,%ebp
+  800999:	53                   	push   %ebx
+  80099a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009a0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009a3:	eb 09                	jmp    8009ae <strncmp+0x18>
+  8009a5:	83 ea 01             	sub    $0x1,%edx
+  8009a8:	83 c0 01             	add    $0x1,%eax
+  8009ab:	83 c1 01             	add    $0x1,%ecx
+  8009ae:	85 d2                	test   %edx,%edx
+  8009b0:	74 18                	je     8009ca <strncmp+0x34>
+  8009b2:	0f b6 18             	movzbl (%eax),%ebx
+  8009b5:	84 db                	test   %bl,%bl
+  8009b7:	74 04                	je     8009bd <strncmp+0x27>
+  8009b9:	3a 19                	cmp    (%ecx),%bl
+  8009bb:	74 e8                	je     8009a5 <strncmp+0xf>
+  8009bd:	0f b6 00             	movzbl (%eax),%eax
+  8009c0:	0f b6 11             	movzbl (%ecx),%edx
+  8009c3:	29 d0                	sub    %edx,%eax
+  8009c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c8:	c9                   	leave
+  8009c9:	c3                   	ret
+  8009ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009cf:	eb f4                	jmp    8009c5 <strncmp+0x2f>
+
+008009d1 <strchr>:
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8009db:	eb 03                	jmp    8009e0 <strchr+0xf>
+  8009dd:	83 c0 01             	add    $0x1,%eax
+  8009e0:	0f b6 10             	movzbl (%eax),%edx
+  8009e3:	84 d2                	test   %dl,%dl
+  8009e5:	74 06                	je     8009ed <strchr+0x1c>
+  8009e7:	38 ca                	cmp    %cl,%dl
+  8009e9:	75 f2                	jne    8009dd <strchr+0xc>
+  8009eb:	eb 05                	jmp    8009f2 <strchr+0x21>
+  8009ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f2:	5d                   	pop    %ebp
+  8009f3:	c3                   	ret
+
+008009f4 <strfind>:
+  8009f4:	55                   	push   %ebp
+  8009f5:	89 e5                	mov    %esp,%ebp
+  8009f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fa:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8009fe:	0f b6 10             	movzbl (%eax),%edx
+  800a01:	38 ca                	cmp    %cl,%dl
+  800a03:	74 09                	je     800a0e <strfind+0x1a>
+  800a05:	84 d2                	test   %dl,%dl
+  800a07:	74 05                	je     800a0e <strfind+0x1a>
+  800a09:	83 c0 01             	add    $0x1,%eax
+  800a0c:	eb f0                	jmp    8009fe <strfind+0xa>
+  800a0e:	5d                   	pop    %ebp
+  800a0f:	c3                   	ret
+
+00800a10 <memset>:
+  800a10:	55                   	push   %ebp
+  800a11:	89 e5                	mov    %esp,%ebp
+  800a13:	57                   	push   %edi
+  800a14:	56                   	push   %esi
+  800a15:	53                   	push   %ebx
+  800a16:	83 ec 04             	sub    $0x4,%esp
+  800a19:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a1c:	8b 55 10             	mov    0x10(%ebp),%edx
+  800a1f:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  800a23:	89 f7                	mov    %esi,%edi
+  800a25:	83 fa 0f             	cmp    $0xf,%edx
+  800a28:	76 24                	jbe    800a4e <memset+0x3e>
+  800a2a:	89 f1                	mov    %esi,%ecx
+  800a2c:	f7 d9                	neg    %ecx
+  800a2e:	83 e1 03             	and    $0x3,%ecx
+  800a31:	29 ca                	sub    %ecx,%edx
+  800a33:	89 d0                	mov    %edx,%eax
+  800a35:	c1 e8 02             	shr    $0x2,%eax
+  800a38:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  800a3b:	83 e2 03             	and    $0x3,%edx
+  800a3e:	89 d8                	mov    %ebx,%eax
+  800a40:	fc                   	cld
+  800a41:	f3 aa                	rep stos %al,%es:(%edi)
+  800a43:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  800a49:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  800a4c:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a4e:	89 d1                	mov    %edx,%ecx
+  800a50:	89 d8                	mov    %ebx,%eax
+  800a52:	fc                   	cld
+  800a53:	f3 aa                	rep stos %al,%es:(%edi)
+  800a55:	89 f0                	mov    %esi,%eax
+  800a57:	83 c4 04             	add    $0x4,%esp
+  800a5a:	5b                   	pop    %ebx
+  800a5b:	5e                   	pop    %esi
+  800a5c:	5f                   	pop    %edi
+  800a5d:	5d                   	pop    %ebp
+  800a5e:	c3                   	ret
+
+00800a5f <memmove>:
+  800a5f:	55                   	push   %ebp
+  800a60:	89 e5                	mov    %esp,%ebp
+  800a62:	57                   	push   %edi
+  800a63:	56                   	push   %esi
+  800a64:	53                   	push   %ebx
+  800a65:	83 ec 0c             	sub    $0xc,%esp
+  800a68:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a6b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a6e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800a71:	85 c0                	test   %eax,%eax
+  800a73:	74 14                	je     800a89 <memmove+0x2a>
+  800a75:	39 da                	cmp    %ebx,%edx
+  800a77:	73 07                	jae    800a80 <memmove+0x21>
+  800a79:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  800a7c:	39 cb                	cmp    %ecx,%ebx
+  800a7e:	72 13                	jb     800a93 <memmove+0x34>
+  800a80:	89 c1                	mov    %eax,%ecx
+  800a82:	89 d8                	mov    %ebx,%eax
+  800a84:	e8 94 fd ff ff       	call   80081d <copy_fwd>
+  800a89:	89 d8                	mov    %ebx,%eax
+  800a8b:	83 c4 0c             	add    $0xc,%esp
+  800a8e:	5b                   	pop    %ebx
+  800a8f:	5e                   	pop    %esi
+  800a90:	5f                   	pop    %edi
+  800a91:	5d                   	pop    %ebp
+  800a92:	c3                   	ret
+  800a93:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800a96:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800a99:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800a9c:	83 f8 0f             	cmp    $0xf,%eax
+  800a9f:	76 23                	jbe    800ac4 <memmove+0x65>
+  800aa1:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800aa4:	83 e1 03             	and    $0x3,%ecx
+  800aa7:	29 c8                	sub    %ecx,%eax
+  800aa9:	89 c2                	mov    %eax,%edx
+  800aab:	c1 ea 02             	shr    $0x2,%edx
+  800aae:	83 e0 03             	and    $0x3,%eax
+  800ab1:	fd                   	std
+  800ab2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800ab4:	83 ef 03             	sub    $0x3,%edi
+  800ab7:	83 ee 03             	sub    $0x3,%esi
+  800aba:	89 d1                	mov    %edx,%ecx
+  800abc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800abe:	83 c7 03             	add    $0x3,%edi
+  800ac1:	83 c6 03             	add    $0x3,%esi
+  800ac4:	89 c1                	mov    %eax,%ecx
+  800ac6:	fd                   	std
+  800ac7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800ac9:	fc                   	cld
+  800aca:	eb bd                	jmp    800a89 <memmove+0x2a>
+
+00800acc <memcpy>:
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	53                   	push   %ebx
+  800ad0:	83 ec 04             	sub    $0x4,%esp
+  800ad3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800ad6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800ad9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800adc:	89 d8                	mov    %ebx,%eax
+  800ade:	e8 3a fd ff ff       	call   80081d <copy_fwd>
+  800ae3:	89 d8                	mov    %ebx,%eax
+  800ae5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ae8:	c9                   	leave
+  800ae9:	c3                   	ret
+
+00800aea <page_copy>:
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	57                   	push   %edi
+  800aee:	56                   	push   %esi
+  800aef:	53                   	push   %ebx
+  800af0:	83 ec 0c             	sub    $0xc,%esp
+  800af3:	e8 5c fd ff ff       	call   800854 <have_sse2>
+  800af8:	85 c0                	test   %eax,%eax
+  800afa:	74 39                	je     800b35 <page_copy+0x4b>
+  800afc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b02:	be 00 01 00 00       	mov    $0x100,%esi
+  800b07:	8b 03                	mov    (%ebx),%eax
+  800b09:	8b 53 04             	mov    0x4(%ebx),%edx
+  800b0c:	0f c3 01             	movnti %eax,(%ecx)
+  800b0f:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800b13:	8b 43 08             	mov    0x8(%ebx),%eax
+  800b16:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800b19:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800b1d:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800b21:	83 c3 10             	add    $0x10,%ebx
+  800b24:	83 c1 10             	add    $0x10,%ecx
+  800b27:	4e                   	dec    %esi
+  800b28:	75 dd                	jne    800b07 <page_copy+0x1d>
+  800b2a:	0f ae f8             	sfence
+  800b2d:	83 c4 0c             	add    $0xc,%esp
+  800b30:	5b                   	pop    %ebx
+  800b31:	5e                   	pop    %esi
+  800b32:	5f                   	pop    %edi
+  800b33:	5d                   	pop    %ebp
+  800b34:	c3                   	ret
+  800b35:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b38:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b3b:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800b40:	fc                   	cld
+  800b41:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b43:	eb e8                	jmp    800b2d <page_copy+0x43>
+
+00800b45 <page_zero>:
+  800b45:	55                   	push   %ebp
+  800b46:	89 e5                	mov    %esp,%ebp
+  800b48:	57                   	push   %edi
+  800b49:	83 ec 04             	sub    $0x4,%esp
+  800b4c:	e8 03 fd ff ff       	call   800854 <have_sse2>
+  800b51:	85 c0                	test   %eax,%eax
+  800b53:	74 3a                	je     800b8f <page_zero+0x4a>
+  800b55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b58:	ba 80 00 00 00       	mov    $0x80,%edx
+  800b5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b62:	0f c3 08             	movnti %ecx,(%eax)
+  800b65:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800b69:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800b6d:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800b71:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800b75:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800b79:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800b7d:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800b81:	83 c0 20             	add    $0x20,%eax
+  800b84:	4a                   	dec    %edx
+  800b85:	75 db                	jne    800b62 <page_zero+0x1d>
+  800b87:	0f ae f8             	sfence
+  800b8a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b8d:	c9                   	leave
+  800b8e:	c3                   	ret
+  800b8f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b92:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800b97:	fc                   	cld
+  800b98:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b9a:	eb ee                	jmp    800b8a <page_zero+0x45>
+
+00800b9c <memcmp>:
+  800b9c:	55                   	push   %ebp
+  800b9d:	89 e5                	mov    %esp,%ebp
+  800b9f:	56                   	push   %esi
+  800ba0:	53                   	push   %ebx
+  800ba1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ba4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ba7:	89 c6                	mov    %eax,%esi
+  800ba9:	03 75 10             	add    0x10(%ebp),%esi
+  800bac:	eb 06                	jmp    800bb4 <memcmp+0x18>
+  800bae:	83 c0 01             	add    $0x1,%eax
+  800bb1:	83 c2 01             	add    $0x1,%edx
+  800bb4:	39 f0                	cmp    %esi,%eax
+  800bb6:	74 14                	je     800bcc <memcmp+0x30>
+  800bb8:	0f b6 08             	movzbl (%eax),%ecx
+  800bbb:	0f b6 1a             	movzbl (%edx),%ebx
+  800bbe:	38 d9                	cmp    %bl,%cl
+  800bc0:	74 ec                	je     800bae <memcmp+0x12>
+  800bc2:	0f b6 c1             	movzbl %cl,%eax
+  800bc5:	0f b6 db             	movzbl %bl,%ebx
+  800bc8:	29 d8                	sub    %ebx,%eax
+  800bca:	eb 05                	jmp    800bd1 <memcmp+0x35>
+  800bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd1:	5b                   	pop    %ebx
+  800bd2:	5e                   	pop    %esi
+  800bd3:	5d                   	pop    %ebp
+  800bd4:	c3                   	ret
+
+00800bd5 <memfind>:
+  800bd5:	55                   	push   %ebp
+  800bd6:	89 e5                	mov    %esp,%ebp
+  800bd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bde:	89 c2                	mov    %eax,%edx
+  800be0:	03 55 10             	add    0x10(%ebp),%edx
+  800be3:	eb 03                	jmp    800be8 <memfind+0x13>
+  800be5:	83 c0 01             	add    $0x1,%eax
+  800be8:	39 d0                	cmp    %edx,%eax
+  800bea:	73 04                	jae    800bf0 <memfind+0x1b>
+  800bec:	38 08                	cmp    %cl,(%eax)
+  800bee:	75 f5                	jne    800be5 <memfind+0x10>
+  800bf0:	5d                   	pop    %ebp
+  800bf1:	c3                   	ret
+
+00800bf2 <strtol>:
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	57                   	push   %edi
+  800bf6:	56                   	push   %esi
+  800bf7:	53                   	push   %ebx
+  800bf8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bfe:	eb 03                	jmp    800c03 <strtol+0x11>
+  800c00:	83 c2 01             	add    $0x1,%edx
+  800c03:	0f b6 02             	movzbl (%edx),%eax
+  800c06:	3c 20                	cmp    $0x20,%al
+  800c08:	74 f6                	je     800c00 <strtol+0xe>
+  800c0a:	3c 09                	cmp    $0x9,%al
+  800c0c:	74 f2                	je     800c00 <strtol+0xe>
+  800c0e:	3c 2b                	cmp    $0x2b,%al
+  800c10:	74 2a                	je     800c3c <strtol+0x4a>
+  800c12:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c17:	3c 2d                	cmp    $0x2d,%al
+  800c19:	74 2b                	je     800c46 <strtol+0x54>
+  800c1b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c21:	75 0f                	jne    800c32 <strtol+0x40>
+  800c23:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c26:	74 28                	je     800c50 <strtol+0x5e>
+  800c28:	85 db                	test   %ebx,%ebx
+  800c2a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c2f:	0f 44 d8             	cmove  %eax,%ebx
+  800c32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c37:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c3a:	eb 46                	jmp    800c82 <strtol+0x90>
+  800c3c:	83 c2 01             	add    $0x1,%edx
+  800c3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c44:	eb d5                	jmp    800c1b <strtol+0x29>
+  800c46:	83 c2 01             	add    $0x1,%edx
+  800c49:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c4e:	eb cb                	jmp    800c1b <strtol+0x29>
+  800c50:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c54:	74 0e                	je     800c64 <strtol+0x72>
+  800c56:	85 db                	test   %ebx,%ebx
+  800c58:	75 d8                	jne    800c32 <strtol+0x40>
+  800c5a:	83 c2 01             	add    $0x1,%edx
+  800c5d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c62:	eb ce                	jmp    800c32 <strtol+0x40>
+  800c64:	83 c2 02             	add    $0x2,%edx
+  800c67:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c6c:	eb c4                	jmp    800c32 <strtol+0x40>
+  800c6e:	0f be c0             	movsbl %al,%eax
+  800c71:	83 e8 30             	sub    $0x30,%eax
+  800c74:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c77:	7d 3a                	jge    800cb3 <strtol+0xc1>
+  800c79:	83 c2 01             	add    $0x1,%edx
+  800c7c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c80:	01 c1                	add    %eax,%ecx
+  800c82:	0f b6 02             	movzbl (%edx),%eax
+  800c85:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c88:	89 f3                	mov    %esi,%ebx
+  800c8a:	80 fb 09             	cmp    $0x9,%bl
+  800c8d:	76 df                	jbe    800c6e <strtol+0x7c>
+  800c8f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c92:	89 f3                	mov    %esi,%ebx
+  800c94:	80 fb 19             	cmp    $0x19,%bl
+  800c97:	77 08                	ja     800ca1 <strtol+0xaf>
+  800c99:	0f be c0             	movsbl %al,%eax
+  800c9c:	83 e8 57             	sub    $0x57,%eax
+  800c9f:	eb d3                	jmp    800c74 <strtol+0x82>
+  800ca1:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ca4:	89 f3                	mov    %esi,%ebx
+  800ca6:	80 fb 19             	cmp    $0x19,%bl
+  800ca9:	77 08                	ja     800cb3 <strtol+0xc1>
+  800cab:	0f be c0             	movsbl %al,%eax
+  800cae:	83 e8 37             	sub    $0x37,%eax
+  800cb1:	eb c1                	jmp    800c74 <strtol+0x82>
+  800cb3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cb7:	74 05                	je     800cbe <strtol+0xcc>
+  800cb9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cbc:	89 10                	mov    %edx,(%eax)
+  800cbe:	89 c8                	mov    %ecx,%eax
+  800cc0:	f7 d8                	neg    %eax
+  800cc2:	85 ff                	test   %edi,%edi
+  800cc4:	0f 45 c8             	cmovne %eax,%ecx
+  800cc7:	89 c8                	mov    %ecx,%eax
+  800cc9:	5b                   	pop    %ebx
+  800cca:	5e                   	pop    %esi
+  800ccb:	5f                   	pop    %edi
+  800ccc:	5d                   	pop    %ebp
+  800ccd:	c3                   	ret
+
+00800cce <sys_cputs>:
+  800cce:	55                   	push   %ebp
+  800ccf:	89 e5                	mov    %esp,%ebp
+  800cd1:	57                   	push   %edi
+  800cd2:	56                   	push   %esi
+  800cd3:	53                   	push   %ebx
+  800cd4:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800cdb:	78 21                	js     800cfe <sys_cputs+0x30>
+  800cdd:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ce4:	75 2d                	jne    800d13 <sys_cputs+0x45>
+  800ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ceb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf1:	89 c3                	mov    %eax,%ebx
+  800cf3:	89 c7                	mov    %eax,%edi
+  800cf5:	89 c6                	mov    %eax,%esi
+  800cf7:	cd 30                	int    $0x30
+  800cf9:	5b                   	pop    %ebx
+  800cfa:	5e                   	pop    %esi
+  800cfb:	5f                   	pop    %edi
+  800cfc:	5d                   	pop    %ebp
+  800cfd:	c3                   	ret
+  800cfe:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d03:	0f a2                	cpuid
+  800d05:	c1 ea 0b             	shr    $0xb,%edx
+  800d08:	83 e2 01             	and    $0x1,%edx
+  800d0b:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800d11:	eb ca                	jmp    800cdd <sys_cputs+0xf>
+  800d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1e:	89 c3                	mov    %eax,%ebx
+  800d20:	89 c7                	mov    %eax,%edi
+  800d22:	89 c6                	mov    %eax,%esi
+  800d24:	55                   	push   %ebp
+  800d25:	68 2e 0d 80 00       	push   $0x800d2e
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	0f 34                	sysenter
+  800d2e:	83 c4 04             	add    $0x4,%esp
+  800d31:	5d                   	pop    %ebp
+  800d32:	eb c5                	jmp    800cf9 <sys_cputs+0x2b>
+
+00800d34 <sys_cgetc>:
+  800d34:	55                   	push   %ebp
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	57                   	push   %edi
+  800d38:	56                   	push   %esi
+  800d39:	53                   	push   %ebx
+  800d3a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d41:	78 22                	js     800d65 <sys_cgetc+0x31>
+  800d43:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d4a:	75 2e                	jne    800d7a <sys_cgetc+0x46>
+  800d4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d51:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d56:	89 d1                	mov    %edx,%ecx
+  800d58:	89 d3                	mov    %edx,%ebx
+  800d5a:	89 d7                	mov    %edx,%edi
+  800d5c:	89 d6                	mov    %edx,%esi
+  800d5e:	cd 30                	int    $0x30
+  800d60:	5b                   	pop    %ebx
+  800d61:	5e                   	pop    %esi
+  800d62:	5f                   	pop    %edi
+  800d63:	5d                   	pop    %ebp
+  800d64:	c3                   	ret
+  800d65:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d6a:	0f a2                	cpuid
+  800d6c:	c1 ea 0b             	shr    $0xb,%edx
+  800d6f:	83 e2 01             	and    $0x1,%edx
+  800d72:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800d78:	eb c9                	jmp    800d43 <sys_cgetc+0xf>
+  800d7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d84:	89 d1                	mov    %edx,%ecx
+  800d86:	89 d3                	mov    %edx,%ebx
+  800d88:	89 d7                	mov    %edx,%edi
+  800d8a:	89 d6                	mov    %edx,%esi
+  800d8c:	55                   	push   %ebp
+  800d8d:	68 96 0d 80 00       	push   $0x800d96
+  800d92:	89 e5                	mov    %esp,%ebp
+  800d94:	0f 34                	sysenter
+  800d96:	83 c4 04             	add    $0x4,%esp
+  800d99:	5d                   	pop    %ebp
+  800d9a:	eb c4                	jmp    800d60 <sys_cgetc+0x2c>
+
+00800d9c <sys_env_destroy>:
+  800d9c:	55                   	push   %ebp
+  800d9d:	89 e5                	mov    %esp,%ebp
+  800d9f:	57                   	push   %edi
+  800da0:	56                   	push   %esi
+  800da1:	53                   	push   %ebx
+  800da2:	83 ec 0c             	sub    $0xc,%esp
+  800da5:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800dac:	78 2a                	js     800dd8 <sys_env_destroy+0x3c>
+  800dae:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800db5:	75 36                	jne    800ded <sys_env_destroy+0x51>
+  800db7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dbc:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc4:	89 cb                	mov    %ecx,%ebx
+  800dc6:	89 cf                	mov    %ecx,%edi
+  800dc8:	89 ce                	mov    %ecx,%esi
+  800dca:	cd 30                	int    $0x30
+  800dcc:	85 c0                	test   %eax,%eax
+  800dce:	7f 40                	jg     800e10 <sys_env_destroy+0x74>
+  800dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd3:	5b                   	pop    %ebx
+  800dd4:	5e                   	pop    %esi
+  800dd5:	5f                   	pop    %edi
+  800dd6:	5d                   	pop    %ebp
+  800dd7:	c3                   	ret
+  800dd8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ddd:	0f a2                	cpuid
+  800ddf:	c1 ea 0b             	shr    $0xb,%edx
+  800de2:	83 e2 01             	and    $0x1,%edx
+  800de5:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800deb:	eb c1                	jmp    800dae <sys_env_destroy+0x12>
+  800ded:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dfa:	89 cb                	mov    %ecx,%ebx
+  800dfc:	89 cf                	mov    %ecx,%edi
+  800dfe:	89 ce                	mov    %ecx,%esi
+  800e00:	55                   	push   %ebp
+  800e01:	68 0a 0e 80 00       	push   $0x800e0a
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	0f 34                	sysenter
+  800e0a:	83 c4 04             	add    $0x4,%esp
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	eb bc                	jmp    800dcc <sys_env_destroy+0x30>
+  800e10:	83 ec 0c             	sub    $0xc,%esp
+  800e13:	50                   	push   %eax
+  800e14:	6a 03                	push   $0x3
+  800e16:	68 84 22 80 00       	push   $0x802284
+  800e1b:	6a 49                	push   $0x49
+  800e1d:	68 a1 22 80 00       	push   $0x8022a1
+  800e22:	e8 63 f3 ff ff       	call   80018a <_panic>
+
+00800e27 <sys_getenvid>:
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	56                   	push   %esi
+  800e2c:	53                   	push   %ebx
+  800e2d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e34:	78 22                	js     800e58 <sys_getenvid+0x31>
+  800e36:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e3d:	75 2e                	jne    800e6d <sys_getenvid+0x46>
+  800e3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e44:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e49:	89 d1                	mov    %edx,%ecx
+  800e4b:	89 d3                	mov    %edx,%ebx
+  800e4d:	89 d7                	mov    %edx,%edi
+  800e4f:	89 d6                	mov    %edx,%esi
+  800e51:	cd 30                	int    $0x30
+  800e53:	5b                   	pop    %ebx
+  800e54:	5e                   	pop    %esi
+  800e55:	5f                   	pop    %edi
+  800e56:	5d                   	pop    %ebp
+  800e57:	c3                   	ret
+  800e58:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e5d:	0f a2                	cpuid
+  800e5f:	c1 ea 0b             	shr    $0xb,%edx
+  800e62:	83 e2 01             	and    $0x1,%edx
+  800e65:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800e6b:	eb c9                	jmp    800e36 <sys_getenvid+0xf>
+  800e6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e72:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e77:	89 d1                	mov    %edx,%ecx
+  800e79:	89 d3                	mov    %edx,%ebx
+  800e7b:	89 d7                	mov    %edx,%edi
+  800e7d:	89 d6                	mov    %edx,%esi
+  800e7f:	55                   	push   %ebp
+  800e80:	68 89 0e 80 00       	push   $0x800e89
+  800e85:	89 e5                	mov    %esp,%ebp
+  800e87:	0f 34                	sysenter
+  800e89:	83 c4 04             	add    $0x4,%esp
+  800e8c:	5d                   	pop    %ebp
+  800e8d:	eb c4                	jmp    800e53 <sys_getenvid+0x2c>
+
+00800e8f <sys_yield>:
+  800e8f:	55                   	push   %ebp
+  800e90:	89 e5                	mov    %esp,%ebp
+  800e92:	57                   	push   %edi
+  800e93:	56                   	push   %esi
+  800e94:	53                   	push   %ebx
+  800e95:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e9c:	78 22                	js     800ec0 <sys_yield+0x31>
+  800e9e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ea5:	75 2e                	jne    800ed5 <sys_yield+0x46>
+  800ea7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eac:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eb1:	89 d1                	mov    %edx,%ecx
+  800eb3:	89 d3                	mov    %edx,%ebx
+  800eb5:	89 d7                	mov    %edx,%edi
+  800eb7:	89 d6                	mov    %edx,%esi
+  800eb9:	cd 30                	int    $0x30
+  800ebb:	5b                   	pop    %ebx
+  800ebc:	5e                   	pop    %esi
+  800ebd:	5f                   	pop    %edi
+  800ebe:	5d                   	pop    %ebp
+  800ebf:	c3                   	ret
+  800ec0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ec5:	0f a2                	cpuid
+  800ec7:	c1 ea 0b             	shr    $0xb,%edx
+  800eca:	83 e2 01             	and    $0x1,%edx
+  800ecd:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800ed3:	eb c9                	jmp    800e9e <sys_yield+0xf>
+  800ed5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eda:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800edf:	89 d1                	mov    %edx,%ecx
+  800ee1:	89 d3                	mov    %edx,%ebx
+  800ee3:	89 d7                	mov    %edx,%edi
+  800ee5:	89 d6                	mov    %edx,%esi
+  800ee7:	55                   	push   %ebp
+  800ee8:	68 f1 0e 80 00       	push   $0x800ef1
+  800eed:	89 e5                	mov    %esp,%ebp
+  800eef:	0f 34                	sysenter
+  800ef1:	83 c4 04             	add    $0x4,%esp
+  800ef4:	5d                   	pop    %ebp
+  800ef5:	eb c4                	jmp    800ebb <sys_yield+0x2c>
+
+00800ef7 <sys_env_set_cow>:
+  800ef7:	55                   	push   %ebp
+  800ef8:	89 e5                	mov    %esp,%ebp
+  800efa:	57                   	push   %edi
+  800efb:	56                   	push   %esi
+  800efc:	53                   	push   %ebx
+  800efd:	83 ec 0c             	sub    $0xc,%esp
+  800f00:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f07:	78 2b                	js     800f34 <sys_env_set_cow+0x3d>
+  800f09:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f10:	75 37                	jne    800f49 <sys_env_set_cow+0x52>
+  800f12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f17:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f22:	89 df                	mov    %ebx,%edi
+  800f24:	89 de                	mov    %ebx,%esi
+  800f26:	cd 30                	int    $0x30
+  800f28:	85 c0                	test   %eax,%eax
+  800f2a:	7f 41                	jg     800f6d <sys_env_set_cow+0x76>
+  800f2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2f:	5b                   	pop    %ebx
+  800f30:	5e                   	pop    %esi
+  800f31:	5f                   	pop    %edi
+  800f32:	5d                   	pop    %ebp
+  800f33:	c3                   	ret
+  800f34:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f39:	0f a2                	cpuid
+  800f3b:	c1 ea 0b             	shr    $0xb,%edx
+  800f3e:	83 e2 01             	and    $0x1,%edx
+  800f41:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800f47:	eb c0                	jmp    800f09 <sys_env_set_cow+0x12>
+  800f49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f54:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f59:	89 df                	mov    %ebx,%edi
+  800f5b:	89 de                	mov    %ebx,%esi
+  800f5d:	55                   	push   %ebp
+  800f5e:	68 67 0f 80 00       	push   $0x800f67
+  800f63:	89 e5                	mov    %esp,%ebp
+  800f65:	0f 34                	sysenter
+  800f67:	83 c4 04             	add    $0x4,%esp
+  800f6a:	5d                   	pop    %ebp
+  800f6b:	eb bb                	jmp    800f28 <sys_env_set_cow+0x31>
+  800f6d:	83 ec 0c             	sub    $0xc,%esp
+  800f70:	50                   	push   %eax
+  800f71:	6a 0d                	push   $0xd
+  800f73:	68 84 22 80 00       	push   $0x802284
+  800f78:	6a 49                	push   $0x49
+  800f7a:	68 a1 22 80 00       	push   $0x8022a1
+  800f7f:	e8 06 f2 ff ff       	call   80018a <_panic>
+
+00800f84 <sys_env_set_quota>:
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	57                   	push   %edi
+  800f88:	56                   	push   %esi
+  800f89:	53                   	push   %ebx
+  800f8a:	83 ec 0c             	sub    $0xc,%esp
+  800f8d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f94:	78 2b                	js     800fc1 <sys_env_set_quota+0x3d>
+  800f96:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f9d:	75 37                	jne    800fd6 <sys_env_set_quota+0x52>
+  800f9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fa9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faf:	89 df                	mov    %ebx,%edi
+  800fb1:	89 de                	mov    %ebx,%esi
+  800fb3:	cd 30                	int    $0x30
+  800fb5:	85 c0                	test   %eax,%eax
+  800fb7:	7f 41                	jg     800ffa <sys_env_set_quota+0x76>
+  800fb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbc:	5b                   	pop    %ebx
+  800fbd:	5e                   	pop    %esi
+  800fbe:	5f                   	pop    %edi
+  800fbf:	5d                   	pop    %ebp
+  800fc0:	c3                   	ret
+  800fc1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fc6:	0f a2                	cpuid
+  800fc8:	c1 ea 0b             	shr    $0xb,%edx
+  800fcb:	83 e2 01             	and    $0x1,%edx
+  800fce:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800fd4:	eb c0                	jmp    800f96 <sys_env_set_quota+0x12>
+  800fd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fe6:	89 df                	mov    %ebx,%edi
+  800fe8:	89 de                	mov    %ebx,%esi
+  800fea:	55                   	push   %ebp
+  800feb:	68 f4 0f 80 00       	push   $0x800ff4
+  800ff0:	89 e5                	mov    %esp,%ebp
+  800ff2:	0f 34                	sysenter
+  800ff4:	83 c4 04             	add    $0x4,%esp
+  800ff7:	5d                   	pop    %ebp
+  800ff8:	eb bb                	jmp    800fb5 <sys_env_set_quota+0x31>
+  800ffa:	83 ec 0c             	sub    $0xc,%esp
+  800ffd:	50                   	push   %eax
+  800ffe:	6a 0f                	push   $0xf
+  801000:	68 84 22 80 00       	push   $0x802284
+  801005:	6a 49                	push   $0x49
+  801007:	68 a1 22 80 00       	push   $0x8022a1
+  80100c:	e8 79 f1 ff ff       	call   80018a <_panic>
+
+00801011 <sys_page_alloc>:
+  801011:	55                   	push   %ebp
+  801012:	89 e5                	mov    %esp,%ebp
+  801014:	57                   	push   %edi
+  801015:	56                   	push   %esi
+  801016:	53                   	push   %ebx
+  801017:	83 ec 0c             	sub    $0xc,%esp
+  80101a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801021:	78 2c                	js     80104f <sys_page_alloc+0x3e>
+  801023:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80102a:	75 38                	jne    801064 <sys_page_alloc+0x53>
+  80102c:	be 00 00 00 00       	mov    $0x0,%esi
+  801031:	b8 04 00 00 00       	mov    $0x4,%eax
+  801036:	8b 55 08             	mov    0x8(%ebp),%edx
+  801039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80103f:	89 f7                	mov    %esi,%edi
+  801041:	cd 30                	int    $0x30
+  801043:	85 c0                	test   %eax,%eax
+  801045:	7f 42                	jg     801089 <sys_page_alloc+0x78>
+  801047:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104a:	5b                   	pop    %ebx
+  80104b:	5e                   	pop    %esi
+  80104c:	5f                   	pop    %edi
+  80104d:	5d                   	pop    %ebp
+  80104e:	c3                   	ret
+  80104f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801054:	0f a2                	cpuid
+  801056:	c1 ea 0b             	shr    $0xb,%edx
+  801059:	83 e2 01             	and    $0x1,%edx
+  80105c:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801062:	eb bf                	jmp    801023 <sys_page_alloc+0x12>
+  801064:	be 00 00 00 00       	mov    $0x0,%esi
+  801069:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801074:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801077:	89 f7                	mov    %esi,%edi
+  801079:	55                   	push   %ebp
+  80107a:	68 83 10 80 00       	push   $0x801083
+  80107f:	89 e5                	mov    %esp,%ebp
+  801081:	0f 34                	sysenter
+  801083:	83 c4 04             	add    $0x4,%esp
+  801086:	5d                   	pop    %ebp
+  801087:	eb ba                	jmp    801043 <sys_page_alloc+0x32>
+  801089:	83 ec 0c             	sub    $0xc,%esp
+  80108c:	50                   	push   %eax
+  80108d:	6a 04                	push   $0x4
+  80108f:	68 84 22 80 00       	push   $0x802284
+  801094:	6a 49                	push   $0x49
+  801096:	68 a1 22 80 00       	push   $0x8022a1
+  80109b:	e8 ea f0 ff ff       	call   80018a <_panic>
+
+008010a0 <sys_page_map>:
+  8010a0:	55                   	push   %ebp
+  8010a1:	89 e5                	mov    %esp,%ebp
+  8010a3:	57                   	push   %edi
+  8010a4:	56                   	push   %esi
+  8010a5:	53                   	push   %ebx
+  8010a6:	83 ec 0c             	sub    $0xc,%esp
+  8010a9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8010b0:	78 2b                	js     8010dd <sys_page_map+0x3d>
+  8010b2:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8010b9:	75 37                	jne    8010f2 <sys_page_map+0x52>
+  8010bb:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010cc:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010cf:	cd 30                	int    $0x30
+  8010d1:	85 c0                	test   %eax,%eax
+  8010d3:	7f 41                	jg     801116 <sys_page_map+0x76>
+  8010d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d8:	5b                   	pop    %ebx
+  8010d9:	5e                   	pop    %esi
+  8010da:	5f                   	pop    %edi
+  8010db:	5d                   	pop    %ebp
+  8010dc:	c3                   	ret
+  8010dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010e2:	0f a2                	cpuid
+  8010e4:	c1 ea 0b             	shr    $0xb,%edx
+  8010e7:	83 e2 01             	and    $0x1,%edx
+  8010ea:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8010f0:	eb c0                	jmp    8010b2 <sys_page_map+0x12>
+  8010f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801100:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801103:	8b 75 18             	mov    0x18(%ebp),%esi
+  801106:	55                   	push   %ebp
+  801107:	68 10 11 80 00       	push   $0x801110
+  80110c:	89 e5                	mov    %esp,%ebp
+  80110e:	0f 34                	sysenter
+  801110:	83 c4 04             	add    $0x4,%esp
+  801113:	5d                   	pop    %ebp
+  801114:	eb bb                	jmp    8010d1 <sys_page_map+0x31>
+  801116:	83 ec 0c             	sub    $0xc,%esp
+  801119:	50                   	push   %eax
+  80111a:	6a 05                	push   $0x5
+  80111c:	68 84 22 80 00       	push   $0x802284
+  801121:	6a 49                	push   $0x49
+  801123:	68 a1 22 80 00       	push   $0x8022a1
+  801128:	e8 5d f0 ff ff       	call   80018a <_panic>
+
+0080112d <sys_page_unmap>:
+  80112d:	55                   	push   %ebp
+  80112e:	89 e5                	mov    %esp,%ebp
+  801130:	57                   	push   %edi
+  801131:	56                   	push   %esi
+  801132:	53                   	push   %ebx
+  801133:	83 ec 0c             	sub    $0xc,%esp
+  801136:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80113d:	78 2b                	js     80116a <sys_page_unmap+0x3d>
+  80113f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801146:	75 37                	jne    80117f <sys_page_unmap+0x52>
+  801148:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801152:	8b 55 08             	mov    0x8(%ebp),%edx
+  801155:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801158:	89 df                	mov    %ebx,%edi
+  80115a:	89 de                	mov    %ebx,%esi
+  80115c:	cd 30                	int    $0x30
+  80115e:	85 c0                	test   %eax,%eax
+  801160:	7f 41                	jg     8011a3 <sys_page_unmap+0x76>
+  801162:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801165:	5b                   	pop    %ebx
+  801166:	5e                   	pop    %esi
+  801167:	5f                   	pop    %edi
+  801168:	5d                   	pop    %ebp
+  801169:	c3                   	ret
+  80116a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80116f:	0f a2                	cpuid
+  801171:	c1 ea 0b             	shr    $0xb,%edx
+  801174:	83 e2 01             	and    $0x1,%edx
+  801177:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80117d:	eb c0                	jmp    80113f <sys_page_unmap+0x12>
+  80117f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801184:	8b 55 08             	mov    0x8(%ebp),%edx
+  801187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80118f:	89 df                	mov    %ebx,%edi
+  801191:	89 de                	mov    %ebx,%esi
+  801193:	55                   	push   %ebp
+  801194:	68 9d 11 80 00       	push   $0x80119d
+  801199:	89 e5                	mov    %esp,%ebp
+  80119b:	0f 34                	sysenter
+  80119d:	83 c4 04             	add    $0x4,%esp
+  8011a0:	5d                   	pop    %ebp
+  8011a1:	eb bb                	jmp    80115e <sys_page_unmap+0x31>
+  8011a3:	83 ec 0c             	sub    $0xc,%esp
+  8011a6:	50                   	push   %eax
+  8011a7:	6a 06                	push   $0x6
+  8011a9:	68 84 22 80 00       	push   $0x802284
+  8011ae:	6a 49                	push   $0x49
+  8011b0:	68 a1 22 80 00       	push   $0x8022a1
+  8011b5:	e8 d0 ef ff ff       	call   80018a <_panic>
+
+008011ba <sys_page_reuse>:
+  8011ba:	55                   	push   %ebp
+  8011bb:	89 e5                	mov    %esp,%ebp
+  8011bd:	57                   	push   %edi
+  8011be:	56                   	push   %esi
+  8011bf:	53                   	push   %ebx
+  8011c0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8011c7:	78 24                	js     8011ed <sys_page_reuse+0x33>
+  8011c9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8011d0:	75 30                	jne    801202 <sys_page_reuse+0x48>
+  8011d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e2:	89 df                	mov    %ebx,%edi
+  8011e4:	89 de                	mov    %ebx,%esi
+  8011e6:	cd 30                	int    $0x30
+  8011e8:	5b                   	pop    %ebx
+  8011e9:	5e                   	pop    %esi
+  8011ea:	5f                   	pop    %edi
+  8011eb:	5d                   	pop    %ebp
+  8011ec:	c3                   	ret
+  8011ed:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011f2:	0f a2                	cpuid
+  8011f4:	c1 ea 0b             	shr    $0xb,%edx
+  8011f7:	83 e2 01             	and    $0x1,%edx
+  8011fa:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801200:	eb c7                	jmp    8011c9 <sys_page_reuse+0xf>
+  801202:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801207:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801212:	89 df                	mov    %ebx,%edi
+  801214:	89 de                	mov    %ebx,%esi
+  801216:	55                   	push   %ebp
+  801217:	68 20 12 80 00       	push   $0x801220
+  80121c:	89 e5                	mov    %esp,%ebp
+  80121e:	0f 34                	sysenter
+  801220:	83 c4 04             	add    $0x4,%esp
+  801223:	5d                   	pop    %ebp
+  801224:	eb c2                	jmp    8011e8 <sys_page_reuse+0x2e>
+
+00801226 <sys_env_set_status>:
+  801226:	55                   	push   %ebp
+  801227:	89 e5                	mov    %esp,%ebp
+  801229:	57                   	push   %edi
+  80122a:	56                   	push   %esi
+  80122b:	53                   	push   %ebx
+  80122c:	83 ec 0c             	sub    $0xc,%esp
+  80122f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801236:	78 2b                	js     801263 <sys_env_set_status+0x3d>
+  801238:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80123f:	75 37                	jne    801278 <sys_env_set_status+0x52>
+  801241:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801246:	b8 08 00 00 00       	mov    $0x8,%eax
+  80124b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801251:	89 df                	mov    %ebx,%edi
+  801253:	89 de                	mov    %ebx,%esi
+  801255:	cd 30                	int    $0x30
+  801257:	85 c0                	test   %eax,%eax
+  801259:	7f 41                	jg     80129c <sys_env_set_status+0x76>
+  80125b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125e:	5b                   	pop    %ebx
+  80125f:	5e                   	pop    %esi
+  801260:	5f                   	pop    %edi
+  801261:	5d                   	pop    %ebp
+  801262:	c3                   	ret
+  801263:	b8 01 00 00 00       	mov    $0x1,%eax
+  801268:	0f a2                	cpuid
+  80126a:	c1 ea 0b             	shr    $0xb,%edx
+  80126d:	83 e2 01             	and    $0x1,%edx
+  801270:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801276:	eb c0                	jmp    801238 <sys_env_set_status+0x12>
+  801278:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801280:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801283:	b8 08 00 00 00       	mov    $0x8,%eax
+  801288:	89 df                	mov    %ebx,%edi
+  80128a:	89 de                	mov    %ebx,%esi
+  80128c:	55                   	push   %ebp
+  80128d:	68 96 12 80 00       	push   $0x801296
+  801292:	89 e5                	mov    %esp,%ebp
+  801294:	0f 34                	sysenter
+  801296:	83 c4 04             	add    $0x4,%esp
+  801299:	5d                   	pop    %ebp
+  80129a:	eb bb                	jmp    801257 <sys_env_set_status+0x31>
+  80129c:	83 ec 0c             	sub    $0xc,%esp
+  80129f:	50                   	push   %eax
+  8012a0:	6a 08                	push   $0x8
+  8012a2:	68 84 22 80 00       	push   $0x802284
+  8012a7:	6a 49                	push   $0x49
+  8012a9:	68 a1 22 80 00       	push   $0x8022a1
+  8012ae:	e8 d7 ee ff ff       	call   80018a <_panic>
+
+008012b3 <sys_env_set_pgfault_upcall>:
+  8012b3:	55                   	push   %ebp
+  8012b4:	89 e5                	mov    %esp,%ebp
+  8012b6:	57                   	push   %edi
+  8012b7:	56                   	push   %esi
+  8012b8:	53                   	push   %ebx
+  8012b9:	83 ec 0c             	sub    $0xc,%esp
+  8012bc:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8012c3:	78 2b                	js     8012f0 <sys_env_set_pgfault_upcall+0x3d>
+  8012c5:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8012cc:	75 37                	jne    801305 <sys_env_set_pgfault_upcall+0x52>
+  8012ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012de:	89 df                	mov    %ebx,%edi
+  8012e0:	89 de                	mov    %ebx,%esi
+  8012e2:	cd 30                	int    $0x30
+  8012e4:	85 c0                	test   %eax,%eax
+  8012e6:	7f 41                	jg     801329 <sys_env_set_pgfault_upcall+0x76>
+  8012e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012eb:	5b                   	pop    %ebx
+  8012ec:	5e                   	pop    %esi
+  8012ed:	5f                   	pop    %edi
+  8012ee:	5d                   	pop    %ebp
+  8012ef:	c3                   	ret
+  8012f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012f5:	0f a2                	cpuid
+  8012f7:	c1 ea 0b             	shr    $0xb,%edx
+  8012fa:	83 e2 01             	and    $0x1,%edx
+  8012fd:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801303:	eb c0                	jmp    8012c5 <sys_env_set_pgfault_upcall+0x12>
+  801305:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801310:	b8 09 00 00 00       	mov    $0x9,%eax
+  801315:	89 df                	mov    %ebx,%edi
+  801317:	89 de                	mov    %ebx,%esi
+  801319:	55                   	push   %ebp
+  80131a:	68 23 13 80 00       	push   $0x801323
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	0f 34                	sysenter
+  801323:	83 c4 04             	add    $0x4,%esp
+  801326:	5d                   	pop    %ebp
+  801327:	eb bb                	jmp    8012e4 <sys_env_set_pgfault_upcall+0x31>
+  801329:	83 ec 0c             	sub    $0xc,%esp
+  80132c:	50                   	push   %eax
+  80132d:	6a 09                	push   $0x9
+  80132f:	68 84 22 80 00       	push   $0x802284
+  801334:	6a 49                	push   $0x49
+  801336:	68 a1 22 80 00       	push   $0x8022a1
+  80133b:	e8 4a ee ff ff       	call   80018a <_panic>
+
+00801340 <sys_env_set_trace>:
+  801340:	55                   	push   %ebp
+  801341:	89 e5                	mov    %esp,%ebp
+  801343:	57                   	push   %edi
+  801344:	56                   	push   %esi
+  801345:	53                   	push   %ebx
+  801346:	83 ec 0c             	sub    $0xc,%esp
+  801349:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801350:	78 2b                	js     80137d <sys_env_set_trace+0x3d>
+  801352:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801359:	75 37                	jne    801392 <sys_env_set_trace+0x52>
+  80135b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801360:	b8 12 00 00 00       	mov    $0x12,%eax
+  801365:	8b 55 08             	mov    0x8(%ebp),%edx
+  801368:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136b:	89 df                	mov    %ebx,%edi
+  80136d:	89 de                	mov    %ebx,%esi
+  80136f:	cd 30                	int    $0x30
+  801371:	85 c0                	test   %eax,%eax
+  801373:	7f 41                	jg     8013b6 <sys_env_set_trace+0x76>
+  801375:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801378:	5b                   	pop    %ebx
+  801379:	5e                   	pop    %esi
+  80137a:	5f                   	pop    %edi
+  80137b:	5d                   	pop    %ebp
+  80137c:	c3                   	ret
+  80137d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801382:	0f a2                	cpuid
+  801384:	c1 ea 0b             	shr    $0xb,%edx
+  801387:	83 e2 01             	and    $0x1,%edx
+  80138a:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801390:	eb c0                	jmp    801352 <sys_env_set_trace+0x12>
+  801392:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801397:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139d:	b8 12 00 00 00       	mov    $0x12,%eax
+  8013a2:	89 df                	mov    %ebx,%edi
+  8013a4:	89 de                	mov    %ebx,%esi
+  8013a6:	55                   	push   %ebp
+  8013a7:	68 b0 13 80 00       	push   $0x8013b0
+  8013ac:	89 e5                	mov    %esp,%ebp
+  8013ae:	0f 34                	sysenter
+  8013b0:	83 c4 04             	add    $0x4,%esp
+  8013b3:	5d                   	pop    %ebp
+  8013b4:	eb bb                	jmp    801371 <sys_env_set_trace+0x31>
+  8013b6:	83 ec 0c             	sub    $0xc,%esp
+  8013b9:	50                   	push   %eax
+  8013ba:	6a 12                	push   $0x12
+  8013bc:	68 84 22 80 00       	push   $0x802284
+  8013c1:	6a 49                	push   $0x49
+  8013c3:	68 a1 22 80 00       	push   $0x8022a1
+  8013c8:	e8 bd ed ff ff       	call   80018a <_panic>
+
+008013cd <sys_env_set_rdpmc>:
+  8013cd:	55                   	push   %ebp
+  8013ce:	89 e5                	mov    %esp,%ebp
+  8013d0:	57                   	push   %edi
+  8013d1:	56                   	push   %esi
+  8013d2:	53                   	push   %ebx
+  8013d3:	83 ec 0c             	sub    $0xc,%esp
+  8013d6:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013dd:	78 2b                	js     80140a <sys_env_set_rdpmc+0x3d>
+  8013df:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013e6:	75 37                	jne    80141f <sys_env_set_rdpmc+0x52>
+  8013e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ed:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f8:	89 df                	mov    %ebx,%edi
+  8013fa:	89 de                	mov    %ebx,%esi
+  8013fc:	cd 30                	int    $0x30
+  8013fe:	85 c0                	test   %eax,%eax
+  801400:	7f 41                	jg     801443 <sys_env_set_rdpmc+0x76>
+  801402:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801405:	5b                   	pop    %ebx
+  801406:	5e                   	pop    %esi
+  801407:	5f                   	pop    %edi
+  801408:	5d                   	pop    %ebp
+  801409:	c3                   	ret
+  80140a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80140f:	0f a2                	cpuid
+  801411:	c1 ea 0b             	shr    $0xb,%edx
+  801414:	83 e2 01             	and    $0x1,%edx
+  801417:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80141d:	eb c0                	jmp    8013df <sys_env_set_rdpmc+0x12>
+  80141f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801424:	8b 55 08             	mov    0x8(%ebp),%edx
+  801427:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80142f:	89 df                	mov    %ebx,%edi
+  801431:	89 de                	mov    %ebx,%esi
+  801433:	55                   	push   %ebp
+  801434:	68 3d 14 80 00       	push   $0x80143d
+  801439:	89 e5                	mov    %esp,%ebp
+  80143b:	0f 34                	sysenter
+  80143d:	83 c4 04             	add    $0x4,%esp
+  801440:	5d                   	pop    %ebp
+  801441:	eb bb                	jmp    8013fe <sys_env_set_rdpmc+0x31>
+  801443:	83 ec 0c             	sub    $0xc,%esp
+  801446:	50                   	push   %eax
+  801447:	6a 13                	push   $0x13
+  801449:	68 84 22 80 00       	push   $0x802284
+  80144e:	6a 49                	push   $0x49
+  801450:	68 a1 22 80 00       	push   $0x8022a1
+  801455:	e8 30 ed ff ff       	call   80018a <_panic>
+
+0080145a <sys_ring_setup>:
+  80145a:	55                   	push   %ebp
+  80145b:	89 e5                	mov    %esp,%ebp
+  80145d:	57                   	push   %edi
+  80145e:	56                   	push   %esi
+  80145f:	53                   	push   %ebx
+  801460:	83 ec 0c             	sub    $0xc,%esp
+  801463:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80146a:	78 29                	js     801495 <sys_ring_setup+0x3b>
+  80146c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801473:	75 35                	jne    8014aa <sys_ring_setup+0x50>
+  801475:	ba 00 00 00 00       	mov    $0x0,%edx
+  80147a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80147f:	89 d1                	mov    %edx,%ecx
+  801481:	89 d3                	mov    %edx,%ebx
+  801483:	89 d7                	mov    %edx,%edi
+  801485:	89 d6                	mov    %edx,%esi
+  801487:	cd 30                	int    $0x30
+  801489:	85 c0                	test   %eax,%eax
+  80148b:	7f 3f                	jg     8014cc <sys_ring_setup+0x72>
+  80148d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801490:	5b                   	pop    %ebx
+  801491:	5e                   	pop    %esi
+  801492:	5f                   	pop    %edi
+  801493:	5d                   	pop    %ebp
+  801494:	c3                   	ret
+  801495:	b8 01 00 00 00       	mov    $0x1,%eax
+  80149a:	0f a2                	cpuid
+  80149c:	c1 ea 0b             	shr    $0xb,%edx
+  80149f:	83 e2 01             	and    $0x1,%edx
+  8014a2:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8014a8:	eb c2                	jmp    80146c <sys_ring_setup+0x12>
+  8014aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014af:	b8 10 00 00 00       	mov    $0x10,%eax
+  8014b4:	89 d1                	mov    %edx,%ecx
+  8014b6:	89 d3                	mov    %edx,%ebx
+  8014b8:	89 d7                	mov    %edx,%edi
+  8014ba:	89 d6                	mov    %edx,%esi
+  8014bc:	55                   	push   %ebp
+  8014bd:	68 c6 14 80 00       	push   $0x8014c6
+  8014c2:	89 e5                	mov    %esp,%ebp
+  8014c4:	0f 34                	sysenter
+  8014c6:	83 c4 04             	add    $0x4,%esp
+  8014c9:	5d                   	pop    %ebp
+  8014ca:	eb bd                	jmp    801489 <sys_ring_setup+0x2f>
+  8014cc:	83 ec 0c             	sub    $0xc,%esp
+  8014cf:	50                   	push   %eax
+  8014d0:	6a 10                	push   $0x10
+  8014d2:	68 84 22 80 00       	push   $0x802284
+  8014d7:	6a 49                	push   $0x49
+  8014d9:	68 a1 22 80 00       	push   $0x8022a1
+  8014de:	e8 a7 ec ff ff       	call   80018a <_panic>
+
+008014e3 <sys_ring_enter>:
+  8014e3:	55                   	push   %ebp
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	57                   	push   %edi
+  8014e7:	56                   	push   %esi
+  8014e8:	53                   	push   %ebx
+  8014e9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014f0:	78 22                	js     801514 <sys_ring_enter+0x31>
+  8014f2:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014f9:	75 2e                	jne    801529 <sys_ring_enter+0x46>
+  8014fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801500:	b8 11 00 00 00       	mov    $0x11,%eax
+  801505:	89 d1                	mov    %edx,%ecx
+  801507:	89 d3                	mov    %edx,%ebx
+  801509:	89 d7                	mov    %edx,%edi
+  80150b:	89 d6                	mov    %edx,%esi
+  80150d:	cd 30                	int    $0x30
+  80150f:	5b                   	pop    %ebx
+  801510:	5e                   	pop    %esi
+  801511:	5f                   	pop    %edi
+  801512:	5d                   	pop    %ebp
+  801513:	c3                   	ret
+  801514:	b8 01 00 00 00       	mov    $0x1,%eax
+  801519:	0f a2                	cpuid
+  80151b:	c1 ea 0b             	shr    $0xb,%edx
+  80151e:	83 e2 01             	and    $0x1,%edx
+  801521:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801527:	eb c9                	jmp    8014f2 <sys_ring_enter+0xf>
+  801529:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801533:	89 d1                	mov    %edx,%ecx
+  801535:	89 d3                	mov    %edx,%ebx
+  801537:	89 d7                	mov    %edx,%edi
+  801539:	89 d6                	mov    %edx,%esi
+  80153b:	55                   	push   %ebp
+  80153c:	68 45 15 80 00       	push   $0x801545
+  801541:	89 e5                	mov    %esp,%ebp
+  801543:	0f 34                	sysenter
+  801545:	83 c4 04             	add    $0x4,%esp
+  801548:	5d                   	pop    %ebp
+  801549:	eb c4                	jmp    80150f <sys_ring_enter+0x2c>
+
+0080154b <sys_ipc_try_send>:
+  80154b:	55                   	push   %ebp
+  80154c:	89 e5                	mov    %esp,%ebp
+  80154e:	57                   	push   %edi
+  80154f:	56                   	push   %esi
+  801550:	53                   	push   %ebx
+  801551:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801558:	78 26                	js     801580 <sys_ipc_try_send+0x35>
+  80155a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801561:	75 32                	jne    801595 <sys_ipc_try_send+0x4a>
+  801563:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801568:	be 00 00 00 00       	mov    $0x0,%esi
+  80156d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801570:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801573:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801576:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801579:	cd 30                	int    $0x30
+  80157b:	5b                   	pop    %ebx
+  80157c:	5e                   	pop    %esi
+  80157d:	5f                   	pop    %edi
+  80157e:	5d                   	pop    %ebp
+  80157f:	c3                   	ret
+  801580:	b8 01 00 00 00       	mov    $0x1,%eax
+  801585:	0f a2                	cpuid
+  801587:	c1 ea 0b             	shr    $0xb,%edx
+  80158a:	83 e2 01             	and    $0x1,%edx
+  80158d:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801593:	eb c5                	jmp    80155a <sys_ipc_try_send+0xf>
+  801595:	8b 55 08             	mov    0x8(%ebp),%edx
+  801598:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80159b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015ab:	55                   	push   %ebp
+  8015ac:	68 b5 15 80 00       	push   $0x8015b5
+  8015b1:	89 e5                	mov    %esp,%ebp
+  8015b3:	0f 34                	sysenter
+  8015b5:	83 c4 04             	add    $0x4,%esp
+  8015b8:	5d                   	pop    %ebp
+  8015b9:	eb c0                	jmp    80157b <sys_ipc_try_send+0x30>
+
+008015bb <sys_ipc_recv>:
+  8015bb:	55                   	push   %ebp
+  8015bc:	89 e5                	mov    %esp,%ebp
+  8015be:	57                   	push   %edi
+  8015bf:	56                   	push   %esi
+  8015c0:	53                   	push   %ebx
+  8015c1:	83 ec 0c             	sub    $0xc,%esp
+  8015c4:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8015cb:	78 2a                	js     8015f7 <sys_ipc_recv+0x3c>
+  8015cd:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8015d4:	75 36                	jne    80160c <sys_ipc_recv+0x51>
+  8015d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015db:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8015e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e3:	89 cb                	mov    %ecx,%ebx
+  8015e5:	89 cf                	mov    %ecx,%edi
+  8015e7:	89 ce                	mov    %ecx,%esi
+  8015e9:	cd 30                	int    $0x30
+  8015eb:	85 c0                	test   %eax,%eax
+  8015ed:	7f 40                	jg     80162f <sys_ipc_recv+0x74>
+  8015ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f2:	5b                   	pop    %ebx
+  8015f3:	5e                   	pop    %esi
+  8015f4:	5f                   	pop    %edi
+  8015f5:	5d                   	pop    %ebp
+  8015f6:	c3                   	ret
+  8015f7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015fc:	0f a2                	cpuid
+  8015fe:	c1 ea 0b             	shr    $0xb,%edx
+  801601:	83 e2 01             	and    $0x1,%edx
+  801604:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80160a:	eb c1                	jmp    8015cd <sys_ipc_recv+0x12>
+  80160c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801614:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801619:	89 cb                	mov    %ecx,%ebx
+  80161b:	89 cf                	mov    %ecx,%edi
+  80161d:	89 ce                	mov    %ecx,%esi
+  80161f:	55                   	push   %ebp
+  801620:	68 29 16 80 00       	push   $0x801629
+  801625:	89 e5                	mov    %esp,%ebp
+  801627:	0f 34                	sysenter
+  801629:	83 c4 04             	add    $0x4,%esp
+  80162c:	5d                   	pop    %ebp
+  80162d:	eb bc                	jmp    8015eb <sys_ipc_recv+0x30>
+  80162f:	83 ec 0c             	sub    $0xc,%esp
+  801632:	50                   	push   %eax
+  801633:	6a 0c                	push   $0xc
+  801635:	68 84 22 80 00       	push   $0x802284
+  80163a:	6a 49                	push   $0x49
+  80163c:	68 a1 22 80 00       	push   $0x8022a1
+  801641:	e8 44 eb ff ff       	call   80018a <_panic>
+
+00801646 <duppage>:
+  801646:	55                   	push   %ebp
+  801647:	89 e5                	mov    %esp,%ebp
+  801649:	53                   	push   %ebx
+  80164a:	83 ec 04             	sub    $0x4,%esp
+  80164d:	89 d3                	mov    %edx,%ebx
+  80164f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801656:	f6 c2 02             	test   $0x2,%dl
+  801659:	75 0c                	jne    801667 <duppage+0x21>
+  80165b:	8b 14 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edx
+  801662:	f6 c6 08             	test   $0x8,%dh
+  801665:	74 64                	je     8016cb <duppage+0x85>
+  801667:	c1 e3 0c             	shl    $0xc,%ebx
+  80166a:	83 ec 0c             	sub    $0xc,%esp
+  80166d:	68 05 08 00 00       	push   $0x805
+  801672:	53                   	push   %ebx
+  801673:	50                   	push   %eax
+  801674:	53                   	push   %ebx
+  801675:	6a 00                	push   $0x0
+  801677:	e8 24 fa ff ff       	call   8010a0 <sys_page_map>
+  80167c:	83 c4 20             	add    $0x20,%esp
+  80167f:	85 c0                	test   %eax,%eax
+  801681:	78 24                	js     8016a7 <duppage+0x61>
+  801683:	83 ec 0c             	sub    $0xc,%esp
+  801686:	68 05 08 00 00       	push   $0x805
+  80168b:	53                   	push   %ebx
+  80168c:	6a 00                	push   $0x0
+  80168e:	53                   	push   %ebx
+  80168f:	6a 00                	push   $0x0
+  801691:	e8 0a fa ff ff       	call   8010a0 <sys_page_map>
+  801696:	83 c4 20             	add    $0x20,%esp
+  801699:	85 c0                	test   %eax,%eax
+  80169b:	78 1c                	js     8016b9 <duppage+0x73>
+  80169d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016a5:	c9                   	leave
+  8016a6:	c3                   	ret
+  8016a7:	50                   	push   %eax
+  8016a8:	68 af 22 80 00       	push   $0x8022af
+  8016ad:	6a 52                	push   $0x52
+  8016af:	68 c0 22 80 00       	push   $0x8022c0
+  8016b4:	e8 d1 ea ff ff       	call   80018a <_panic>
+  8016b9:	50                   	push   %eax
+  8016ba:	68 af 22 80 00       	push   $0x8022af
+  8016bf:	6a 55                	push   $0x55
+  8016c1:	68 c0 22 80 00       	push   $0x8022c0
+  8016c6:	e8 bf ea ff ff       	call   80018a <_panic>
+  8016cb:	c1 e3 0c             	shl    $0xc,%ebx
+  8016ce:	83 ec 0c             	sub    $0xc,%esp
+  8016d1:	6a 05                	push   $0x5
+  8016d3:	53                   	push   %ebx
+  8016d4:	50                   	push   %eax
+  8016d5:	53                   	push   %ebx
+  8016d6:	6a 00                	push   $0x0
+  8016d8:	e8 c3 f9 ff ff       	call   8010a0 <sys_page_map>
+  8016dd:	83 c4 20             	add    $0x20,%esp
+  8016e0:	85 c0                	test   %eax,%eax
+  8016e2:	79 b9                	jns    80169d <duppage+0x57>
+  8016e4:	50                   	push   %eax
+  8016e5:	68 af 22 80 00       	push   $0x8022af
+  8016ea:	6a 59                	push   $0x59
+  8016ec:	68 c0 22 80 00       	push   $0x8022c0
+  8016f1:	e8 94 ea ff ff       	call   80018a <_panic>
+
+008016f6 <pgfault>:
+  8016f6:	55                   	push   %ebp
+  8016f7:	89 e5                	mov    %esp,%ebp
+  8016f9:	53                   	push   %ebx
+  8016fa:	83 ec 04             	sub    $0x4,%esp
+  8016fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801700:	8b 18                	mov    (%eax),%ebx
+  801702:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801706:	0f 84 90 00 00 00    	je     80179c <pgfault+0xa6>
+  80170c:	89 d8                	mov    %ebx,%eax
+  80170e:	c1 e8 0c             	shr    $0xc,%eax
+  801711:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801718:	f7 c2 01 08 00 00    	test   $0x801,%edx
+  80171e:	74 7c                	je     80179c <pgfault+0xa6>
+  801720:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801727:	c1 e8 0c             	shr    $0xc,%eax
+  80172a:	0f b7 04 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%eax
+  801731:	ef 
+  801732:	66 83 f8 01          	cmp    $0x1,%ax
+  801736:	74 78                	je     8017b0 <pgfault+0xba>
+  801738:	83 ec 04             	sub    $0x4,%esp
+  80173b:	6a 07                	push   $0x7
+  80173d:	68 00 f0 7f 00       	push   $0x7ff000
+  801742:	6a 00                	push   $0x0
+  801744:	e8 c8 f8 ff ff       	call   801011 <sys_page_alloc>
+  801749:	83 c4 10             	add    $0x10,%esp
+  80174c:	85 c0                	test   %eax,%eax
+  80174e:	78 7f                	js     8017cf <pgfault+0xd9>
+  801750:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  801756:	83 ec 08             	sub    $0x8,%esp
+  801759:	53                   	push   %ebx
+  80175a:	68 00 f0 7f 00       	push   $0x7ff000
+  80175f:	e8 86 f3 ff ff       	call   800aea <page_copy>
+  801764:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80176b:	53                   	push   %ebx
+  80176c:	6a 00                	push   $0x0
+  80176e:	68 00 f0 7f 00       	push   $0x7ff000
+  801773:	6a 00                	push   $0x0
+  801775:	e8 26 f9 ff ff       	call   8010a0 <sys_page_map>
+  80177a:	83 c4 20             	add    $0x20,%esp
+  80177d:	85 c0                	test   %eax,%eax
+  80177f:	78 60                	js     8017e1 <pgfault+0xeb>
+  801781:	83 ec 08             	sub    $0x8,%esp
+  801784:	68 00 f0 7f 00       	push   $0x7ff000
+  801789:	6a 00                	push   $0x0
+  80178b:	e8 9d f9 ff ff       	call   80112d <sys_page_unmap>
+  801790:	83 c4 10             	add    $0x10,%esp
+  801793:	85 c0                	test   %eax,%eax
+  801795:	78 5c                	js     8017f3 <pgfault+0xfd>
+  801797:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80179a:	c9                   	leave
+  80179b:	c3                   	ret
+  80179c:	83 ec 04             	sub    $0x4,%esp
+  80179f:	68 cb 22 80 00       	push   $0x8022cb
+  8017a4:	6a 1c                	push   $0x1c
+  8017a6:	68 c0 22 80 00       	push   $0x8022c0
+  8017ab:	e8 da e9 ff ff       	call   80018a <_panic>
+  8017b0:	83 ec 08             	sub    $0x8,%esp
+  8017b3:	89 d8                	mov    %ebx,%eax
+  8017b5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017ba:	50                   	push   %eax
+  8017bb:	6a 00                	push   $0x0
+  8017bd:	e8 f8 f9 ff ff       	call   8011ba <sys_page_reuse>
+  8017c2:	83 c4 10             	add    $0x10,%esp
+  8017c5:	85 c0                	test   %eax,%eax
+  8017c7:	0f 85 6b ff ff ff    	jne    801738 <pgfault+0x42>
+  8017cd:	eb c8                	jmp    801797 <pgfault+0xa1>
+  8017cf:	50                   	push   %eax
+  8017d0:	68 e8 22 80 00       	push   $0x8022e8
+  8017d5:	6a 31                	push   $0x31
+  8017d7:	68 c0 22 80 00       	push   $0x8022c0
+  8017dc:	e8 a9 e9 ff ff       	call   80018a <_panic>
+  8017e1:	50                   	push   %eax
+  8017e2:	68 af 22 80 00       	push   $0x8022af
+  8017e7:	6a 36                	push   $0x36
+  8017e9:	68 c0 22 80 00       	push   $0x8022c0
+  8017ee:	e8 97 e9 ff ff       	call   80018a <_panic>
+  8017f3:	50                   	push   %eax
+  8017f4:	68 fb 22 80 00       	push   $0x8022fb
+  8017f9:	6a 38                	push   $0x38
+  8017fb:	68 c0 22 80 00       	push   $0x8022c0
+  801800:	e8 85 e9 ff ff       	call   80018a <_panic>
+
+00801805 <fork>:
+  801805:	55                   	push   %ebp
+  801806:	89 e5                	mov    %esp,%ebp
+  801808:	53                   	push   %ebx
+  801809:	83 ec 20             	sub    $0x20,%esp
+  80180c:	68 f6 16 80 00       	push   $0x8016f6
+  801811:	e8 68 04 00 00       	call   801c7e <set_pgfault_handler>
+  801816:	83 c4 08             	add    $0x8,%esp
+  801819:	6a 01                	push   $0x1
+  80181b:	6a 00                	push   $0x0
+  80181d:	e8 d5 f6 ff ff       	call   800ef7 <sys_env_set_cow>
+  801822:	83 c4 10             	add    $0x10,%esp
+  801825:	85 c0                	test   %eax,%eax
+  801827:	78 38                	js     801861 <fork+0x5c>
+  801829:	e8 59 03 00 00       	call   801b87 <bflush>
+  80182e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801833:	cd 30                	int    $0x30
+  801835:	89 c3                	mov    %eax,%ebx
+  801837:	85 c0                	test   %eax,%eax
+  801839:	78 38                	js     801873 <fork+0x6e>
+  80183b:	ba 00 00 80 00       	mov    $0x800000,%edx
+  801840:	75 4f                	jne    801891 <fork+0x8c>
+  801842:	e8 a7 02 00 00       	call   801aee <uinfo_envid>
+  801847:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80184c:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  801852:	05 00 00 00 ed       	add    $0xed000000,%eax
+  801857:	a3 20 30 80 00       	mov    %eax,0x803020
+  80185c:	e9 c9 00 00 00       	jmp    80192a <fork+0x125>
+  801861:	50                   	push   %eax
+  801862:	68 0e 23 80 00       	push   $0x80230e
+  801867:	6a 7c                	push   $0x7c
+  801869:	68 c0 22 80 00       	push   $0x8022c0
+  80186e:	e8 17 e9 ff ff       	call   80018a <_panic>
+  801873:	50                   	push   %eax
+  801874:	68 22 23 80 00       	push   $0x802322
+  801879:	68 88 00 00 00       	push   $0x88
+  80187e:	68 c0 22 80 00       	push   $0x8022c0
+  801883:	e8 02 e9 ff ff       	call   80018a <_panic>
+  801888:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80188b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801891:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  801894:	81 fa ff ff ff ea    	cmp    $0xeaffffff,%edx
+  80189a:	77 34                	ja     8018d0 <fork+0xcb>
+  80189c:	81 fa 00 f0 ff ea    	cmp    $0xeafff000,%edx
+  8018a2:	74 e4                	je     801888 <fork+0x83>
+  8018a4:	89 d0                	mov    %edx,%eax
+  8018a6:	c1 e8 16             	shr    $0x16,%eax
+  8018a9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8018b0:	a8 01                	test   $0x1,%al
+  8018b2:	74 d4                	je     801888 <fork+0x83>
+  8018b4:	89 d0                	mov    %edx,%eax
+  8018b6:	c1 e8 0c             	shr    $0xc,%eax
+  8018b9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018c0:	a8 01                	test   $0x1,%al
+  8018c2:	74 c4                	je     801888 <fork+0x83>
+  8018c4:	c1 ea 0c             	shr    $0xc,%edx
+  8018c7:	89 d8                	mov    %ebx,%eax
+  8018c9:	e8 78 fd ff ff       	call   801646 <duppage>
+  8018ce:	eb b8                	jmp    801888 <fork+0x83>
+  8018d0:	83 ec 04             	sub    $0x4,%esp
+  8018d3:	6a 07                	push   $0x7
+  8018d5:	68 00 f0 ff ea       	push   $0xeafff000
+  8018da:	53                   	push   %ebx
+  8018db:	e8 31 f7 ff ff       	call   801011 <sys_page_alloc>
+  8018e0:	83 c4 10             	add    $0x10,%esp
+  8018e3:	85 c0                	test   %eax,%eax
+  8018e5:	78 4a                	js     801931 <fork+0x12c>
+  8018e7:	a1 20 30 80 00       	mov    0x803020,%eax
+  8018ec:	8b 40 58             	mov    0x58(%eax),%eax
+  8018ef:	83 ec 08             	sub    $0x8,%esp
+  8018f2:	50                   	push   %eax
+  8018f3:	53                   	push   %ebx
+  8018f4:	e8 ba f9 ff ff       	call   8012b3 <sys_env_set_pgfault_upcall>
+  8018f9:	83 c4 08             	add    $0x8,%esp
+  8018fc:	6a 01                	push   $0x1
+  8018fe:	53                   	push   %ebx
+  8018ff:	e8 f3 f5 ff ff       	call   800ef7 <sys_env_set_cow>
+  801904:	83 c4 10             	add    $0x10,%esp
+  801907:	85 c0                	test   %eax,%eax
+  801909:	78 3b                	js     801946 <fork+0x141>
+  80190b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80190e:	c1 ea 0c             	shr    $0xc,%edx
+  801911:	89 d8                	mov    %ebx,%eax
+  801913:	e8 2e fd ff ff       	call   801646 <duppage>
+  801918:	83 ec 08             	sub    $0x8,%esp
+  80191b:	6a 02                	push   $0x2
+  80191d:	53                   	push   %ebx
+  80191e:	e8 03 f9 ff ff       	call   801226 <sys_env_set_status>
+  801923:	83 c4 10             	add    $0x10,%esp
+  801926:	85 c0                	test   %eax,%eax
+  801928:	78 31                	js     80195b <fork+0x156>
+  80192a:	89 d8                	mov    %ebx,%eax
+  80192c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80192f:	c9                   	leave
+  801930:	c3                   	ret
+  801931:	50                   	push   %eax
+  801932:	68 e8 22 80 00       	push   $0x8022e8
+  801937:	68 a1 00 00 00       	push   $0xa1
+  80193c:	68 c0 22 80 00       	push   $0x8022c0
+  801941:	e8 44 e8 ff ff       	call   80018a <_panic>
+  801946:	50                   	push   %eax
+  801947:	68 0e 23 80 00       	push   $0x80230e
+  80194c:	68 a6 00 00 00       	push   $0xa6
+  801951:	68 c0 22 80 00       	push   $0x8022c0
+  801956:	e8 2f e8 ff ff       	call   80018a <_panic>
+  80195b:	50                   	push   %eax
+  80195c:	68 32 23 80 00       	push   $0x802332
+  801961:	68 ad 00 00 00       	push   $0xad
+  801966:	68 c0 22 80 00       	push   $0x8022c0
+  80196b:	e8 1a e8 ff ff       	call   80018a <_panic>
+
+00801970 <sfork>:
+  801970:	55                   	push   %ebp
+  801971:	89 e5                	mov    %esp,%ebp
+  801973:	83 ec 0c             	sub    $0xc,%esp
+  801976:	68 49 23 80 00       	push   $0x802349
+  80197b:	68 b6 00 00 00       	push   $0xb6
+  801980:	68 c0 22 80 00       	push   $0x8022c0
+  801985:	e8 00 e8 ff ff       	call   80018a <_panic>
+
+0080198a <ipc_recv>:
+  80198a:	55                   	push   %ebp
+  80198b:	89 e5                	mov    %esp,%ebp
+  80198d:	56                   	push   %esi
+  80198e:	53                   	push   %ebx
+  80198f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801992:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801995:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801998:	85 c0                	test   %eax,%eax
+  80199a:	74 41                	je     8019dd <ipc_recv+0x53>
+  80199c:	83 ec 0c             	sub    $0xc,%esp
+  80199f:	50                   	push   %eax
+  8019a0:	e8 16 fc ff ff       	call   8015bb <sys_ipc_recv>
+  8019a5:	83 c4 10             	add    $0x10,%esp
+  8019a8:	85 f6                	test   %esi,%esi
+  8019aa:	74 17                	je     8019c3 <ipc_recv+0x39>
+  8019ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b1:	85 c0                	test   %eax,%eax
+  8019b3:	75 0c                	jne    8019c1 <ipc_recv+0x37>
+  8019b5:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8019bb:	8b 92 0c 01 00 00    	mov    0x10c(%edx),%edx
+  8019c1:	89 16                	mov    %edx,(%esi)
+  8019c3:	85 db                	test   %ebx,%ebx
+  8019c5:	74 42                	je     801a09 <ipc_recv+0x7f>
+  8019c7:	85 c0                	test   %eax,%eax
+  8019c9:	74 24                	je     8019ef <ipc_recv+0x65>
+  8019cb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8019d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019d9:	5b                   	pop    %ebx
+  8019da:	5e                   	pop    %esi
+  8019db:	5d                   	pop    %ebp
+  8019dc:	c3                   	ret
+  8019dd:	83 ec 0c             	sub    $0xc,%esp
+  8019e0:	68 01 00 00 eb       	push   $0xeb000001
+  8019e5:	e8 d1 fb ff ff       	call   8015bb <sys_ipc_recv>
+  8019ea:	83 c4 10             	add    $0x10,%esp
+  8019ed:	eb b9                	jmp    8019a8 <ipc_recv+0x1e>
+  8019ef:	a1 20 30 80 00       	mov    0x803020,%eax
+  8019f4:	8b 80 10 01 00 00    	mov    0x110(%eax),%eax
+  8019fa:	89 03                	mov    %eax,(%ebx)
+  8019fc:	a1 20 30 80 00       	mov    0x803020,%eax
+  801a01:	8b 80 08 01 00 00    	mov    0x108(%eax),%eax
+  801a07:	eb cd                	jmp    8019d6 <ipc_recv+0x4c>
+  801a09:	85 c0                	test   %eax,%eax
+  801a0b:	74 ef                	je     8019fc <ipc_recv+0x72>
+  801a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a12:	eb c2                	jmp    8019d6 <ipc_recv+0x4c>
+
+00801a14 <ipc_send>:
+  801a14:	55                   	push   %ebp
+  801a15:	89 e5                	mov    %esp,%ebp
+  801a17:	57                   	push   %edi
+  801a18:	56                   	push   %esi
+  801a19:	53                   	push   %ebx
+  801a1a:	83 ec 0c             	sub    $0xc,%esp
+  801a1d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801a20:	8b 75 10             	mov    0x10(%ebp),%esi
+  801a23:	eb 21                	jmp    801a46 <ipc_send+0x32>
+  801a25:	ff 75 14             	push   0x14(%ebp)
+  801a28:	68 01 00 00 eb       	push   $0xeb000001
+  801a2d:	ff 75 0c             	push   0xc(%ebp)
+  801a30:	57                   	push   %edi
+  801a31:	e8 15 fb ff ff       	call   80154b <sys_ipc_try_send>
+  801a36:	89 c3                	mov    %eax,%ebx
+  801a38:	83 c4 10             	add    $0x10,%esp
+  801a3b:	eb 1f                	jmp    801a5c <ipc_send+0x48>
+  801a3d:	83 fb f9             	cmp    $0xfffffff9,%ebx
+  801a40:	74 37                	je     801a79 <ipc_send+0x65>
+  801a42:	85 db                	test   %ebx,%ebx
+  801a44:	74 3a                	je     801a80 <ipc_send+0x6c>
+  801a46:	85 f6                	test   %esi,%esi
+  801a48:	74 db                	je     801a25 <ipc_send+0x11>
+  801a4a:	ff 75 14             	push   0x14(%ebp)
+  801a4d:	56                   	push   %esi
+  801a4e:	ff 75 0c             	push   0xc(%ebp)
+  801a51:	57                   	push   %edi
+  801a52:	e8 f4 fa ff ff       	call   80154b <sys_ipc_try_send>
+  801a57:	89 c3                	mov    %eax,%ebx
+  801a59:	83 c4 10             	add    $0x10,%esp
+  801a5c:	85 db                	test   %ebx,%ebx
+  801a5e:	74 dd                	je     801a3d <ipc_send+0x29>
+  801a60:	83 fb f9             	cmp    $0xfffffff9,%ebx
+  801a63:	74 d8                	je     801a3d <ipc_send+0x29>
+  801a65:	83 ec 04             	sub    $0x4,%esp
+  801a68:	68 5f 23 80 00       	push   $0x80235f
+  801a6d:	6a 40                	push   $0x40
+  801a6f:	68 72 23 80 00       	push   $0x802372
+  801a74:	e8 11 e7 ff ff       	call   80018a <_panic>
+  801a79:	e8 11 f4 ff ff       	call   800e8f <sys_yield>
+  801a7e:	eb c2                	jmp    801a42 <ipc_send+0x2e>
+  801a80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a83:	5b                   	pop    %ebx
+  801a84:	5e                   	pop    %esi
+  801a85:	5f                   	pop    %edi
+  801a86:	5d                   	pop    %ebp
+  801a87:	c3                   	ret
+
+00801a88 <ipc_find_env>:
+  801a88:	55                   	push   %ebp
+  801a89:	89 e5                	mov    %esp,%ebp
+  801a8b:	56                   	push   %esi
+  801a8c:	53                   	push   %ebx
+  801a8d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a90:	b9 7f 03 00 ed       	mov    $0xed00037f,%ecx
+  801a95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9a:	89 c3                	mov    %eax,%ebx
+  801a9c:	83 c0 01             	add    $0x1,%eax
+  801a9f:	89 ca                	mov    %ecx,%edx
+  801aa1:	c1 ea 0c             	shr    $0xc,%edx
+  801aa4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801aab:	f6 c2 01             	test   $0x1,%dl
+  801aae:	74 35                	je     801ae5 <ipc_find_env+0x5d>
+  801ab0:	69 d3 80 03 00 00    	imul   $0x380,%ebx,%edx
+  801ab6:	81 c2 00 00 00 ed    	add    $0xed000000,%edx
+  801abc:	8b 52 48             	mov    0x48(%edx),%edx
+  801abf:	81 c1 80 03 00 00    	add    $0x380,%ecx
+  801ac5:	39 f2                	cmp    %esi,%edx
+  801ac7:	74 0e                	je     801ad7 <ipc_find_env+0x4f>
+  801ac9:	3d 00 80 00 00       	cmp    $0x8000,%eax
+  801ace:	75 ca                	jne    801a9a <ipc_find_env+0x12>
+  801ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad5:	eb 13                	jmp    801aea <ipc_find_env+0x62>
+  801ad7:	69 db 80 03 00 00    	imul   $0x380,%ebx,%ebx
+  801add:	8b 83 40 00 00 ed    	mov    -0x12ffffc0(%ebx),%eax
+  801ae3:	eb 05                	jmp    801aea <ipc_find_env+0x62>
+  801ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aea:	5b                   	pop    %ebx
+  801aeb:	5e                   	pop    %esi
+  801aec:	5d                   	pop    %ebp
+  801aed:	c3                   	ret
+
+00801aee <uinfo_envid>:
+  801aee:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  801af3:	c3                   	ret
+
+00801af4 <uinfo_cpunum>:
+  801af4:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  801af9:	c3                   	ret
+
+00801afa <uinfo_ticks>:
+  801afa:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  801aff:	c3                   	ret
+
+00801b00 <uinfo_nsec>:
+  801b00:	55                   	push   %ebp
+  801b01:	89 e5                	mov    %esp,%ebp
+  801b03:	57                   	push   %edi
+  801b04:	56                   	push   %esi
+  801b05:	53                   	push   %ebx
+  801b06:	83 ec 1c             	sub    $0x1c,%esp
+  801b09:	0f 31                	rdtsc
+  801b0b:	89 c6                	mov    %eax,%esi
+  801b0d:	89 d7                	mov    %edx,%edi
+  801b0f:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801b15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b1f:	85 c9                	test   %ecx,%ecx
+  801b21:	74 5c                	je     801b7f <uinfo_nsec+0x7f>
+  801b23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b28:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801b2b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b2e:	52                   	push   %edx
+  801b2f:	51                   	push   %ecx
+  801b30:	57                   	push   %edi
+  801b31:	56                   	push   %esi
+  801b32:	e8 b4 02 00 00       	call   801deb <__umoddi3>
+  801b37:	83 c4 10             	add    $0x10,%esp
+  801b3a:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801b40:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801b45:	f7 e3                	mul    %ebx
+  801b47:	01 ca                	add    %ecx,%edx
+  801b49:	ff 75 e4             	push   -0x1c(%ebp)
+  801b4c:	ff 75 e0             	push   -0x20(%ebp)
+  801b4f:	52                   	push   %edx
+  801b50:	50                   	push   %eax
+  801b51:	e8 bd 01 00 00       	call   801d13 <__udivdi3>
+  801b56:	83 c4 10             	add    $0x10,%esp
+  801b59:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b5c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b5f:	ff 75 e4             	push   -0x1c(%ebp)
+  801b62:	ff 75 e0             	push   -0x20(%ebp)
+  801b65:	57                   	push   %edi
+  801b66:	56                   	push   %esi
+  801b67:	e8 a7 01 00 00       	call   801d13 <__udivdi3>
+  801b6c:	83 c4 10             	add    $0x10,%esp
+  801b6f:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801b75:	f7 e3                	mul    %ebx
+  801b77:	01 ca                	add    %ecx,%edx
+  801b79:	03 45 d8             	add    -0x28(%ebp),%eax
+  801b7c:	13 55 dc             	adc    -0x24(%ebp),%edx
+  801b7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b82:	5b                   	pop    %ebx
+  801b83:	5e                   	pop    %esi
+  801b84:	5f                   	pop    %edi
+  801b85:	5d                   	pop    %ebp
+  801b86:	c3                   	ret
+
+00801b87 <bflush>:
+  801b87:	a1 40 30 80 00       	mov    0x803040,%eax
+  801b8c:	85 c0                	test   %eax,%eax
+  801b8e:	75 01                	jne    801b91 <bflush+0xa>
+  801b90:	c3                   	ret
+  801b91:	55                   	push   %ebp
+  801b92:	89 e5                	mov    %esp,%ebp
+  801b94:	83 ec 10             	sub    $0x10,%esp
+  801b97:	50                   	push   %eax
+  801b98:	68 44 30 80 00       	push   $0x803044
+  801b9d:	e8 2c f1 ff ff       	call   800cce <sys_cputs>
+  801ba2:	c7 05 40 30 80 00 00 	movl   $0x0,0x803040
+  801ba9:	00 00 00 
+  801bac:	83 c4 10             	add    $0x10,%esp
+  801baf:	c9                   	leave
+  801bb0:	c3                   	ret
+
+00801bb1 <bputch>:
+  801bb1:	55                   	push   %ebp
+  801bb2:	89 e5                	mov    %esp,%ebp
+  801bb4:	53                   	push   %ebx
+  801bb5:	83 ec 04             	sub    $0x4,%esp
+  801bb8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801bbb:	8b 15 40 30 80 00    	mov    0x803040,%edx
+  801bc1:	8d 42 01             	lea    0x1(%edx),%eax
+  801bc4:	a3 40 30 80 00       	mov    %eax,0x803040
+  801bc9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bcc:	88 8a 44 30 80 00    	mov    %cl,0x803044(%edx)
+  801bd2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bd7:	77 08                	ja     801be1 <bputch+0x30>
+  801bd9:	83 03 01             	addl   $0x1,(%ebx)
+  801bdc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bdf:	c9                   	leave
+  801be0:	c3                   	ret
+  801be1:	e8 a1 ff ff ff       	call   801b87 <bflush>
+  801be6:	eb f1                	jmp    801bd9 <bputch+0x28>
+
+00801be8 <vbprintf>:
+  801be8:	55                   	push   %ebp
+  801be9:	89 e5                	mov    %esp,%ebp
+  801beb:	83 ec 18             	sub    $0x18,%esp
+  801bee:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801bf5:	ff 75 0c             	push   0xc(%ebp)
+  801bf8:	ff 75 08             	push   0x8(%ebp)
+  801bfb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bfe:	50                   	push   %eax
+  801bff:	68 b1 1b 80 00       	push   $0x801bb1
+  801c04:	e8 58 e7 ff ff       	call   800361 <vprintfmt>
+  801c09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c0c:	c9                   	leave
+  801c0d:	c3                   	ret
+
+00801c0e <bprintf>:
+  801c0e:	55                   	push   %ebp
+  801c0f:	89 e5                	mov    %esp,%ebp
+  801c11:	83 ec 10             	sub    $0x10,%esp
+  801c14:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801c17:	50                   	push   %eax
+  801c18:	ff 75 08             	push   0x8(%ebp)
+  801c1b:	e8 c8 ff ff ff       	call   801be8 <vbprintf>
+  801c20:	c9                   	leave
+  801c21:	c3                   	ret
+
+00801c22 <bwrite>:
+  801c22:	55                   	push   %ebp
+  801c23:	89 e5                	mov    %esp,%ebp
+  801c25:	53                   	push   %ebx
+  801c26:	83 ec 04             	sub    $0x4,%esp
+  801c29:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c2c:	89 d8                	mov    %ebx,%eax
+  801c2e:	03 05 40 30 80 00    	add    0x803040,%eax
+  801c34:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c39:	76 0d                	jbe    801c48 <bwrite+0x26>
+  801c3b:	e8 47 ff ff ff       	call   801b87 <bflush>
+  801c40:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801c46:	77 25                	ja     801c6d <bwrite+0x4b>
+  801c48:	83 ec 04             	sub    $0x4,%esp
+  801c4b:	53                   	push   %ebx
+  801c4c:	ff 75 08             	push   0x8(%ebp)
+  801c4f:	a1 40 30 80 00       	mov    0x803040,%eax
+  801c54:	05 44 30 80 00       	add    $0x803044,%eax
+  801c59:	50                   	push   %eax
+  801c5a:	e8 6d ee ff ff       	call   800acc <memcpy>
+  801c5f:	01 1d 40 30 80 00    	add    %ebx,0x803040
+  801c65:	83 c4 10             	add    $0x10,%esp
+  801c68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c6b:	c9                   	leave
+  801c6c:	c3                   	ret
+  801c6d:	83 ec 08             	sub    $0x8,%esp
+  801c70:	53                   	push   %ebx
+  801c71:	ff 75 08             	push   0x8(%ebp)
+  801c74:	e8 55 f0 ff ff       	call   800cce <sys_cputs>
+  801c79:	83 c4 10             	add    $0x10,%esp
+  801c7c:	eb ea                	jmp    801c68 <bwrite+0x46>
+
+00801c7e <set_pgfault_handler>:
+  801c7e:	55                   	push   %ebp
+  801c7f:	89 e5                	mov    %esp,%ebp
+  801c81:	83 ec 08             	sub    $0x8,%esp
+  801c84:	83 3d 44 34 80 00 00 	cmpl   $0x0,0x803444
+  801c8b:	74 0a                	je     801c97 <set_pgfault_handler+0x19>
+  801c8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c90:	a3 44 34 80 00       	mov    %eax,0x803444
+  801c95:	c9                   	leave
+  801c96:	c3                   	ret
+  801c97:	83 ec 04             	sub    $0x4,%esp
+  801c9a:	6a 07                	push   $0x7
+  801c9c:	68 00 f0 ff ea       	push   $0xeafff000
+  801ca1:	6a 00                	push   $0x0
+  801ca3:	e8 69 f3 ff ff       	call   801011 <sys_page_alloc>
+  801ca8:	83 c4 10             	add    $0x10,%esp
+  801cab:	85 c0                	test   %eax,%eax
+  801cad:	75 2a                	jne    801cd9 <set_pgfault_handler+0x5b>
+  801caf:	83 ec 08             	sub    $0x8,%esp
+  801cb2:	68 ed 1c 80 00       	push   $0x801ced
+  801cb7:	6a 00                	push   $0x0
+  801cb9:	e8 f5 f5 ff ff       	call   8012b3 <sys_env_set_pgfault_upcall>
+  801cbe:	83 c4 10             	add    $0x10,%esp
+  801cc1:	85 c0                	test   %eax,%eax
+  801cc3:	74 c8                	je     801c8d <set_pgfault_handler+0xf>
+  801cc5:	83 ec 04             	sub    $0x4,%esp
+  801cc8:	68 a0 23 80 00       	push   $0x8023a0
+  801ccd:	6a 28                	push   $0x28
+  801ccf:	68 92 23 80 00       	push   $0x802392
+  801cd4:	e8 b1 e4 ff ff       	call   80018a <_panic>
+  801cd9:	83 ec 04             	sub    $0x4,%esp
+  801cdc:	68 7c 23 80 00       	push   $0x80237c
+  801ce1:	6a 22                	push   $0x22
+  801ce3:	68 92 23 80 00       	push   $0x802392
+  801ce8:	e8 9d e4 ff ff       	call   80018a <_panic>
+
+00801ced <_pgfault_upcall>:
+  801ced:	54                   	push   %esp
+  801cee:	a1 44 34 80 00       	mov    0x803444,%eax
+  801cf3:	ff d0                	call   *%eax
+  801cf5:	83 c4 04             	add    $0x4,%esp
+  801cf8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  801cfc:	89 e5                	mov    %esp,%ebp
+  801cfe:	8b 64 24 30          	mov    0x30(%esp),%esp
+  801d02:	50                   	push   %eax
+  801d03:	89 ec                	mov    %ebp,%esp
+  801d05:	83 c4 08             	add    $0x8,%esp
+  801d08:	61                   	popa
+  801d09:	83 c4 04             	add    $0x4,%esp
+  801d0c:	9d                   	popf
+  801d0d:	5c                   	pop    %esp
+  801d0e:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+  801d12:	c3                   	ret
+
+00801d13 <__udivdi3>:
+  801d13:	57                   	push   %edi
+  801d14:	56                   	push   %esi
+  801d15:	53                   	push   %ebx
+  801d16:	83 ec 20             	sub    $0x20,%esp
+  801d19:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801d1d:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801d21:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801d25:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801d29:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801d2d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801d31:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801d35:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801d39:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801d3d:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801d41:	89 d1                	mov    %edx,%ecx
+  801d43:	09 c1                	or     %eax,%ecx
+  801d45:	0f 84 91 00 00 00    	je     801ddc <__udivdi3+0xc9>
+  801d4b:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801d52:	00 
+  801d53:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801d5a:	00 
+  801d5b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801d60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d65:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d6a:	eb 08                	jmp    801d74 <__udivdi3+0x61>
+  801d6c:	83 e9 01             	sub    $0x1,%ecx
+  801d6f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801d72:	74 68                	je     801ddc <__udivdi3+0xc9>
+  801d74:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801d78:	01 c0                	add    %eax,%eax
+  801d7a:	89 c6                	mov    %eax,%esi
+  801d7c:	89 d7                	mov    %edx,%edi
+  801d7e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801d82:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801d86:	0f ad d0             	shrd   %cl,%edx,%eax
+  801d89:	d3 ea                	shr    %cl,%edx
+  801d8b:	f6 c1 20             	test   $0x20,%cl
+  801d8e:	74 04                	je     801d94 <__udivdi3+0x81>
+  801d90:	89 d0                	mov    %edx,%eax
+  801d92:	31 d2                	xor    %edx,%edx
+  801d94:	83 e0 01             	and    $0x1,%eax
+  801d97:	89 04 24             	mov    %eax,(%esp)
+  801d9a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801da1:	00 
+  801da2:	8b 04 24             	mov    (%esp),%eax
+  801da5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801da9:	09 f0                	or     %esi,%eax
+  801dab:	09 fa                	or     %edi,%edx
+  801dad:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801db1:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801db5:	39 f0                	cmp    %esi,%eax
+  801db7:	89 d3                	mov    %edx,%ebx
+  801db9:	19 fb                	sbb    %edi,%ebx
+  801dbb:	72 af                	jb     801d6c <__udivdi3+0x59>
+  801dbd:	29 f0                	sub    %esi,%eax
+  801dbf:	19 fa                	sbb    %edi,%edx
+  801dc1:	89 cf                	mov    %ecx,%edi
+  801dc3:	c1 ef 05             	shr    $0x5,%edi
+  801dc6:	83 e7 01             	and    $0x1,%edi
+  801dc9:	89 fe                	mov    %edi,%esi
+  801dcb:	83 f6 01             	xor    $0x1,%esi
+  801dce:	d3 e6                	shl    %cl,%esi
+  801dd0:	d3 e7                	shl    %cl,%edi
+  801dd2:	09 74 24 18          	or     %esi,0x18(%esp)
+  801dd6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  801dda:	eb 90                	jmp    801d6c <__udivdi3+0x59>
+  801ddc:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801de0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  801de4:	83 c4 20             	add    $0x20,%esp
+  801de7:	5b                   	pop    %ebx
+  801de8:	5e                   	pop    %esi
+  801de9:	5f                   	pop    %edi
+  801dea:	c3                   	ret
+
+00801deb <__umoddi3>:
+  801deb:	55                   	push   %ebp
+  801dec:	57                   	push   %edi
+  801ded:	56                   	push   %esi
+  801dee:	53                   	push   %ebx
+  801def:	83 ec 1c             	sub    $0x1c,%esp
+  801df2:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801df6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801dfa:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801dfe:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801e02:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801e06:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801e0a:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801e0e:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801e12:	89 d6                	mov    %edx,%esi
+  801e14:	09 c6                	or     %eax,%esi
+  801e16:	74 6c                	je     801e84 <__umoddi3+0x99>
+  801e18:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e22:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e27:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801e2b:	eb 0e                	jmp    801e3b <__umoddi3+0x50>
+  801e2d:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801e32:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801e36:	83 fe ff             	cmp    $0xffffffff,%esi
+  801e39:	74 49                	je     801e84 <__umoddi3+0x99>
+  801e3b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801e3f:	01 c0                	add    %eax,%eax
+  801e41:	89 c3                	mov    %eax,%ebx
+  801e43:	89 d6                	mov    %edx,%esi
+  801e45:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801e49:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801e4d:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801e52:	0f ad d0             	shrd   %cl,%edx,%eax
+  801e55:	d3 ea                	shr    %cl,%edx
+  801e57:	f6 c1 20             	test   $0x20,%cl
+  801e5a:	74 04                	je     801e60 <__umoddi3+0x75>
+  801e5c:	89 d0                	mov    %edx,%eax
+  801e5e:	31 d2                	xor    %edx,%edx
+  801e60:	83 e0 01             	and    $0x1,%eax
+  801e63:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801e68:	89 ea                	mov    %ebp,%edx
+  801e6a:	09 d8                	or     %ebx,%eax
+  801e6c:	09 f2                	or     %esi,%edx
+  801e6e:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801e72:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801e76:	39 d8                	cmp    %ebx,%eax
+  801e78:	89 d1                	mov    %edx,%ecx
+  801e7a:	19 f1                	sbb    %esi,%ecx
+  801e7c:	72 af                	jb     801e2d <__umoddi3+0x42>
+  801e7e:	29 d8                	sub    %ebx,%eax
+  801e80:	19 f2                	sbb    %esi,%edx
+  801e82:	eb a9                	jmp    801e2d <__umoddi3+0x42>
+  801e84:	83 c4 1c             	add    $0x1c,%esp
+  801e87:	5b                   	pop    %ebx
+  801e88:	5e                   	pop    %esi
+  801e89:	5f                   	pop    %edi
+  801e8a:	5d                   	pop    %ebp
+  801e8b:	c3                   	ret
+
+00801e8c <__divdi3>:
+  801e8c:	53                   	push   %ebx
+  801e8d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801e91:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801e95:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801e99:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801e9d:	85 d2                	test   %edx,%edx
+  801e9f:	78 12                	js     801eb3 <__divdi3+0x27>
+  801ea1:	85 db                	test   %ebx,%ebx
+  801ea3:	78 2e                	js     801ed3 <__divdi3+0x47>
+  801ea5:	53                   	push   %ebx
+  801ea6:	51                   	push   %ecx
+  801ea7:	52                   	push   %edx
+  801ea8:	50                   	push   %eax
+  801ea9:	e8 65 fe ff ff       	call   801d13 <__udivdi3>
+  801eae:	83 c4 10             	add    $0x10,%esp
+  801eb1:	eb 1e                	jmp    801ed1 <__divdi3+0x45>
+  801eb3:	f7 d8                	neg    %eax
+  801eb5:	83 d2 00             	adc    $0x0,%edx
+  801eb8:	f7 da                	neg    %edx
+  801eba:	85 db                	test   %ebx,%ebx
+  801ebc:	78 2a                	js     801ee8 <__divdi3+0x5c>
+  801ebe:	53                   	push   %ebx
+  801ebf:	51                   	push   %ecx
+  801ec0:	52                   	push   %edx
+  801ec1:	50                   	push   %eax
+  801ec2:	e8 4c fe ff ff       	call   801d13 <__udivdi3>
+  801ec7:	83 c4 10             	add    $0x10,%esp
+  801eca:	f7 d8                	neg    %eax
+  801ecc:	83 d2 00             	adc    $0x0,%edx
+  801ecf:	f7 da                	neg    %edx
+  801ed1:	5b                   	pop    %ebx
+  801ed2:	c3                   	ret
+  801ed3:	f7 d9                	neg    %ecx
+  801ed5:	83 d3 00             	adc    $0x0,%ebx
+  801ed8:	f7 db                	neg    %ebx
+  801eda:	53                   	push   %ebx
+  801edb:	51                   	push   %ecx
+  801edc:	52                   	push   %edx
+  801edd:	50                   	push   %eax
+  801ede:	e8 30 fe ff ff       	call   801d13 <__udivdi3>
+  801ee3:	83 c4 10             	add    $0x10,%esp
+  801ee6:	eb e2                	jmp    801eca <__divdi3+0x3e>
+  801ee8:	f7 d9                	neg    %ecx
+  801eea:	83 d3 00             	adc    $0x0,%ebx
+  801eed:	f7 db                	neg    %ebx
+  801eef:	53                   	push   %ebx
+  801ef0:	51                   	push   %ecx
+  801ef1:	52                   	push   %edx
+  801ef2:	50                   	push   %eax
+  801ef3:	e8 1b fe ff ff       	call   801d13 <__udivdi3>
+  801ef8:	83 c4 10             	add    $0x10,%esp
+  801efb:	eb d4                	jmp    801ed1 <__divdi3+0x45>
+
+00801efd <__moddi3>:
+  801efd:	55                   	push   %ebp
+  801efe:	57                   	push   %edi
+  801eff:	56                   	push   %esi
+  801f00:	53                   	push   %ebx
+  801f01:	83 ec 14             	sub    $0x14,%esp
+  801f04:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801f08:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801f0c:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801f10:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801f14:	85 ed                	test   %ebp,%ebp
+  801f16:	78 2b                	js     801f43 <__moddi3+0x46>
+  801f18:	89 c6                	mov    %eax,%esi
+  801f1a:	f7 de                	neg    %esi
+  801f1c:	89 34 24             	mov    %esi,(%esp)
+  801f1f:	89 d6                	mov    %edx,%esi
+  801f21:	83 d6 00             	adc    $0x0,%esi
+  801f24:	f7 de                	neg    %esi
+  801f26:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801f2a:	8b 34 24             	mov    (%esp),%esi
+  801f2d:	0f 48 f0             	cmovs  %eax,%esi
+  801f30:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801f35:	52                   	push   %edx
+  801f36:	56                   	push   %esi
+  801f37:	55                   	push   %ebp
+  801f38:	57                   	push   %edi
+  801f39:	e8 ad fe ff ff       	call   801deb <__umoddi3>
+  801f3e:	83 c4 10             	add    $0x10,%esp
+  801f41:	eb 3c                	jmp    801f7f <__moddi3+0x82>
+  801f43:	89 c3                	mov    %eax,%ebx
+  801f45:	f7 db                	neg    %ebx
+  801f47:	89 d1                	mov    %edx,%ecx
+  801f49:	83 d1 00             	adc    $0x0,%ecx
+  801f4c:	f7 d9                	neg    %ecx
+  801f4e:	0f 49 c3             	cmovns %ebx,%eax
+  801f51:	89 04 24             	mov    %eax,(%esp)
+  801f54:	0f 49 d1             	cmovns %ecx,%edx
+  801f57:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801f5b:	ff 74 24 04          	push   0x4(%esp)
+  801f5f:	ff 74 24 04          	push   0x4(%esp)
+  801f63:	89 f8                	mov    %edi,%eax
+  801f65:	89 ea                	mov    %ebp,%edx
+  801f67:	f7 d8                	neg    %eax
+  801f69:	83 d2 00             	adc    $0x0,%edx
+  801f6c:	f7 da                	neg    %edx
+  801f6e:	52                   	push   %edx
+  801f6f:	50                   	push   %eax
+  801f70:	e8 76 fe ff ff       	call   801deb <__umoddi3>
+  801f75:	83 c4 10             	add    $0x10,%esp
+  801f78:	f7 d8                	neg    %eax
+  801f7a:	83 d2 00             	adc    $0x0,%edx
+  801f7d:	f7 da                	neg    %edx
+  801f7f:	83 c4 14             	add    $0x14,%esp
+  801f82:	5b                   	pop    %ebx
+  801f83:	5e                   	pop    %esi
+  801f84:	5f                   	pop    %edi
+  801f85:	5d                   	pop    %ebp
+  801f86:	c3                   	ret
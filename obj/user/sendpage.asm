@@ -0,0 +1,3118 @@
+
+obj/user/sendpage:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 73 01 00 00       	call   8001a4 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 18             	sub    $0x18,%esp
+  800039:	e8 f9 17 00 00       	call   801837 <fork>
+  80003e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800041:	85 c0                	test   %eax,%eax
+  800043:	0f 84 a5 00 00 00    	je     8000ee <umain+0xbb>
+  800049:	a1 20 30 80 00       	mov    0x803020,%eax
+  80004e:	8b 40 40             	mov    0x40(%eax),%eax
+  800051:	83 ec 04             	sub    $0x4,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 a0 00       	push   $0xa00000
+  80005b:	50                   	push   %eax
+  80005c:	e8 e2 0f 00 00       	call   801043 <sys_page_alloc>
+  800061:	83 c4 04             	add    $0x4,%esp
+  800064:	ff 35 04 30 80 00    	push   0x803004
+  80006a:	e8 47 08 00 00       	call   8008b6 <strlen>
+  80006f:	83 c4 0c             	add    $0xc,%esp
+  800072:	83 c0 01             	add    $0x1,%eax
+  800075:	50                   	push   %eax
+  800076:	ff 35 04 30 80 00    	push   0x803004
+  80007c:	68 00 00 a0 00       	push   $0xa00000
+  800081:	e8 78 0a 00 00       	call   800afe <memcpy>
+  800086:	6a 07                	push   $0x7
+  800088:	68 00 00 a0 00       	push   $0xa00000
+  80008d:	6a 00                	push   $0x0
+  80008f:	ff 75 f4             	push   -0xc(%ebp)
+  800092:	e8 af 19 00 00       	call   801a46 <ipc_send>
+  800097:	83 c4 1c             	add    $0x1c,%esp
+  80009a:	6a 00                	push   $0x0
+  80009c:	68 00 00 a0 00       	push   $0xa00000
+  8000a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a4:	50                   	push   %eax
+  8000a5:	e8 12 19 00 00       	call   8019bc <ipc_recv>
+  8000aa:	83 c4 0c             	add    $0xc,%esp
+  8000ad:	68 00 00 a0 00       	push   $0xa00000
+  8000b2:	ff 75 f4             	push   -0xc(%ebp)
+  8000b5:	68 20 20 80 00       	push   $0x802020
+  8000ba:	e8 dd 01 00 00       	call   80029c <cprintf>
+  8000bf:	83 c4 04             	add    $0x4,%esp
+  8000c2:	ff 35 00 30 80 00    	push   0x803000
+  8000c8:	e8 e9 07 00 00       	call   8008b6 <strlen>
+  8000cd:	83 c4 0c             	add    $0xc,%esp
+  8000d0:	50                   	push   %eax
+  8000d1:	ff 35 00 30 80 00    	push   0x803000
+  8000d7:	68 00 00 a0 00       	push   $0xa00000
+  8000dc:	e8 e7 08 00 00       	call   8009c8 <strncmp>
+  8000e1:	83 c4 10             	add    $0x10,%esp
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	0f 84 a3 00 00 00    	je     80018f <umain+0x15c>
+  8000ec:	c9                   	leave
+  8000ed:	c3                   	ret
+  8000ee:	83 ec 04             	sub    $0x4,%esp
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	68 00 00 b0 00       	push   $0xb00000
+  8000f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000fb:	50                   	push   %eax
+  8000fc:	e8 bb 18 00 00       	call   8019bc <ipc_recv>
+  800101:	83 c4 0c             	add    $0xc,%esp
+  800104:	68 00 00 b0 00       	push   $0xb00000
+  800109:	ff 75 f4             	push   -0xc(%ebp)
+  80010c:	68 20 20 80 00       	push   $0x802020
+  800111:	e8 86 01 00 00       	call   80029c <cprintf>
+  800116:	83 c4 04             	add    $0x4,%esp
+  800119:	ff 35 04 30 80 00    	push   0x803004
+  80011f:	e8 92 07 00 00       	call   8008b6 <strlen>
+  800124:	83 c4 0c             	add    $0xc,%esp
+  800127:	50                   	push   %eax
+  800128:	ff 35 04 30 80 00    	push   0x803004
+  80012e:	68 00 00 b0 00       	push   $0xb00000
+  800133:	e8 90 08 00 00       	call   8009c8 <strncmp>
+  800138:	83 c4 10             	add    $0x10,%esp
+  80013b:	85 c0                	test   %eax,%eax
+  80013d:	74 3e                	je     80017d <umain+0x14a>
+  80013f:	83 ec 0c             	sub    $0xc,%esp
+  800142:	ff 35 00 30 80 00    	push   0x803000
+  800148:	e8 69 07 00 00       	call   8008b6 <strlen>
+  80014d:	83 c4 0c             	add    $0xc,%esp
+  800150:	83 c0 01             	add    $0x1,%eax
+  800153:	50                   	push   %eax
+  800154:	ff 35 00 30 80 00    	push   0x803000
+  80015a:	68 00 00 b0 00       	push   $0xb00000
+  80015f:	e8 9a 09 00 00       	call   800afe <memcpy>
+  800164:	6a 07                	push   $0x7
+  800166:	68 00 00 b0 00       	push   $0xb00000
+  80016b:	6a 00                	push   $0x0
+  80016d:	ff 75 f4             	push   -0xc(%ebp)
+  800170:	e8 d1 18 00 00       	call   801a46 <ipc_send>
+  800175:	83 c4 20             	add    $0x20,%esp
+  800178:	e9 6f ff ff ff       	jmp    8000ec <umain+0xb9>
+  80017d:	83 ec 0c             	sub    $0xc,%esp
+  800180:	68 34 20 80 00       	push   $0x802034
+  800185:	e8 12 01 00 00       	call   80029c <cprintf>
+  80018a:	83 c4 10             	add    $0x10,%esp
+  80018d:	eb b0                	jmp    80013f <umain+0x10c>
+  80018f:	83 ec 0c             	sub    $0xc,%esp
+  800192:	68 54 20 80 00       	push   $0x802054
+  800197:	e8 00 01 00 00       	call   80029c <cprintf>
+  80019c:	83 c4 10             	add    $0x10,%esp
+  80019f:	e9 48 ff ff ff       	jmp    8000ec <umain+0xb9>
+
+008001a4 <libmain>:
+  8001a4:	55                   	push   %ebp
+  8001a5:	89 e5                	mov    %esp,%ebp
+  8001a7:	56                   	push   %esi
+  8001a8:	53                   	push   %ebx
+  8001a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8001af:	e8 6c 19 00 00       	call   801b20 <uinfo_envid>
+  8001b4:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8001b9:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8001bf:	05 00 00 00 ed       	add    $0xed000000,%eax
+  8001c4:	a3 20 30 80 00       	mov    %eax,0x803020
+  8001c9:	85 db                	test   %ebx,%ebx
+  8001cb:	7e 07                	jle    8001d4 <libmain+0x30>
+  8001cd:	8b 06                	mov    (%esi),%eax
+  8001cf:	a3 08 30 80 00       	mov    %eax,0x803008
+  8001d4:	83 ec 08             	sub    $0x8,%esp
+  8001d7:	56                   	push   %esi
+  8001d8:	53                   	push   %ebx
+  8001d9:	e8 55 fe ff ff       	call   800033 <umain>
+  8001de:	e8 0a 00 00 00       	call   8001ed <exit>
+  8001e3:	83 c4 10             	add    $0x10,%esp
+  8001e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001e9:	5b                   	pop    %ebx
+  8001ea:	5e                   	pop    %esi
+  8001eb:	5d                   	pop    %ebp
+  8001ec:	c3                   	ret
+
+008001ed <exit>:
+  8001ed:	55                   	push   %ebp
+  8001ee:	89 e5                	mov    %esp,%ebp
+  8001f0:	83 ec 08             	sub    $0x8,%esp
+  8001f3:	e8 c1 19 00 00       	call   801bb9 <bflush>
+  8001f8:	83 ec 0c             	sub    $0xc,%esp
+  8001fb:	6a 00                	push   $0x0
+  8001fd:	e8 cc 0b 00 00       	call   800dce <sys_env_destroy>
+  800202:	83 c4 10             	add    $0x10,%esp
+  800205:	c9                   	leave
+  800206:	c3                   	ret
+
+00800207 <putch>:
+  800207:	55                   	push   %ebp
+  800208:	89 e5                	mov    %esp,%ebp
+  80020a:	53                   	push   %ebx
+  80020b:	83 ec 04             	sub    $0x4,%esp
+  80020e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800211:	8b 13                	mov    (%ebx),%edx
+  800213:	8d 42 01             	lea    0x1(%edx),%eax
+  800216:	89 03                	mov    %eax,(%ebx)
+  800218:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80021b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80021f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800224:	74 09                	je     80022f <putch+0x28>
+  800226:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80022a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80022d:	c9                   	leave
+  80022e:	c3                   	ret
+  80022f:	83 ec 08             	sub    $0x8,%esp
+  800232:	68 ff 00 00 00       	push   $0xff
+  800237:	8d 43 08             	lea    0x8(%ebx),%eax
+  80023a:	50                   	push   %eax
+  80023b:	e8 c0 0a 00 00       	call   800d00 <sys_cputs>
+  800240:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800246:	83 c4 10             	add    $0x10,%esp
+  800249:	eb db                	jmp    800226 <putch+0x1f>
+
+0080024b <vcprintf>:
+  80024b:	55                   	push   %ebp
+  80024c:	89 e5                	mov    %esp,%ebp
+  80024e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800254:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80025b:	00 00 00 
+  80025e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800265:	00 00 00 
+  800268:	ff 75 0c             	push   0xc(%ebp)
+  80026b:	ff 75 08             	push   0x8(%ebp)
+  80026e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800274:	50                   	push   %eax
+  800275:	68 07 02 80 00       	push   $0x800207
+  80027a:	e8 14 01 00 00       	call   800393 <vprintfmt>
+  80027f:	83 c4 08             	add    $0x8,%esp
+  800282:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800288:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80028e:	50                   	push   %eax
+  80028f:	e8 6c 0a 00 00       	call   800d00 <sys_cputs>
+  800294:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80029a:	c9                   	leave
+  80029b:	c3                   	ret
+
+0080029c <cprintf>:
+  80029c:	55                   	push   %ebp
+  80029d:	89 e5                	mov    %esp,%ebp
+  80029f:	83 ec 10             	sub    $0x10,%esp
+  8002a2:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8002a5:	50                   	push   %eax
+  8002a6:	ff 75 08             	push   0x8(%ebp)
+  8002a9:	e8 9d ff ff ff       	call   80024b <vcprintf>
+  8002ae:	c9                   	leave
+  8002af:	c3                   	ret
+
+008002b0 <printnum>:
+  8002b0:	55                   	push   %ebp
+  8002b1:	89 e5                	mov    %esp,%ebp
+  8002b3:	57                   	push   %edi
+  8002b4:	56                   	push   %esi
+  8002b5:	53                   	push   %ebx
+  8002b6:	83 ec 1c             	sub    $0x1c,%esp
+  8002b9:	89 c7                	mov    %eax,%edi
+  8002bb:	89 d6                	mov    %edx,%esi
+  8002bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002c3:	89 d1                	mov    %edx,%ecx
+  8002c5:	89 c2                	mov    %eax,%edx
+  8002c7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002ca:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002cd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002d0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8002d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002d6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002dd:	39 c2                	cmp    %eax,%edx
+  8002df:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002e2:	72 3e                	jb     800322 <printnum+0x72>
+  8002e4:	83 ec 0c             	sub    $0xc,%esp
+  8002e7:	ff 75 18             	push   0x18(%ebp)
+  8002ea:	83 eb 01             	sub    $0x1,%ebx
+  8002ed:	53                   	push   %ebx
+  8002ee:	50                   	push   %eax
+  8002ef:	83 ec 08             	sub    $0x8,%esp
+  8002f2:	ff 75 e4             	push   -0x1c(%ebp)
+  8002f5:	ff 75 e0             	push   -0x20(%ebp)
+  8002f8:	ff 75 dc             	push   -0x24(%ebp)
+  8002fb:	ff 75 d8             	push   -0x28(%ebp)
+  8002fe:	e8 8d 1a 00 00       	call   801d90 <__udivdi3>
+  800303:	83 c4 18             	add    $0x18,%esp
+  800306:	52                   	push   %edx
+  800307:	50                   	push   %eax
+  800308:	89 f2                	mov    %esi,%edx
+  80030a:	89 f8                	mov    %edi,%eax
+  80030c:	e8 9f ff ff ff       	call   8002b0 <printnum>
+  800311:	83 c4 20             	add    $0x20,%esp
+  800314:	eb 13                	jmp    800329 <printnum+0x79>
+  800316:	83 ec 08             	sub    $0x8,%esp
+  800319:	56                   	push   %esi
+  80031a:	ff 75 18             	push   0x18(%ebp)
+  80031d:	ff d7                	call   *%edi
+  80031f:	83 c4 10             	add    $0x10,%esp
+  800322:	83 eb 01             	sub    $0x1,%ebx
+  800325:	85 db                	test   %ebx,%ebx
+  800327:	7f ed                	jg     800316 <printnum+0x66>
+  800329:	83 ec 08             	sub    $0x8,%esp
+  80032c:	56                   	push   %esi
+  80032d:	83 ec 04             	sub    $0x4,%esp
+  800330:	ff 75 e4             	push   -0x1c(%ebp)
+  800333:	ff 75 e0             	push   -0x20(%ebp)
+  800336:	ff 75 dc             	push   -0x24(%ebp)
+  800339:	ff 75 d8             	push   -0x28(%ebp)
+  80033c:	e8 27 1b 00 00       	call   801e68 <__umoddi3>
+  800341:	83 c4 14             	add    $0x14,%esp
+  800344:	0f be 80 cc 20 80 00 	movsbl 0x8020cc(%eax),%eax
+  80034b:	50                   	push   %eax
+  80034c:	ff d7                	call   *%edi
+  80034e:	83 c4 10             	add    $0x10,%esp
+  800351:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800354:	5b                   	pop    %ebx
+  800355:	5e                   	pop    %esi
+  800356:	5f                   	pop    %edi
+  800357:	5d                   	pop    %ebp
+  800358:	c3                   	ret
+
+00800359 <sprintputch>:
+  800359:	55                   	push   %ebp
+  80035a:	89 e5                	mov    %esp,%ebp
+  80035c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80035f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800363:	8b 10                	mov    (%eax),%edx
+  800365:	3b 50 04             	cmp    0x4(%eax),%edx
+  800368:	73 0a                	jae    800374 <sprintputch+0x1b>
+  80036a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80036d:	89 08                	mov    %ecx,(%eax)
+  80036f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800372:	88 02                	mov    %al,(%edx)
+  800374:	5d                   	pop    %ebp
+  800375:	c3                   	ret
+
+00800376 <printfmt>:
+  800376:	55                   	push   %ebp
+  800377:	89 e5                	mov    %esp,%ebp
+  800379:	83 ec 08             	sub    $0x8,%esp
+  80037c:	8d 45 14             	lea    0x14(%ebp),%eax
+  80037f:	50                   	push   %eax
+  800380:	ff 75 10             	push   0x10(%ebp)
+  800383:	ff 75 0c             	push   0xc(%ebp)
+  800386:	ff 75 08             	push   0x8(%ebp)
+  800389:	e8 05 00 00 00       	call   800393 <vprintfmt>
+  80038e:	83 c4 10             	add    $0x10,%esp
+  800391:	c9                   	leave
+  800392:	c3                   	ret
+
+00800393 <vprintfmt>:
+  800393:	55                   	push   %ebp
+  800394:	89 e5                	mov    %esp,%ebp
+  800396:	57                   	push   %edi
+  800397:	56                   	push   %esi
+  800398:	53                   	push   %ebx
+  800399:	83 ec 2c             	sub    $0x2c,%esp
+  80039c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80039f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003a2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003a5:	eb 0a                	jmp    8003b1 <vprintfmt+0x1e>
+  8003a7:	83 ec 08             	sub    $0x8,%esp
+  8003aa:	53                   	push   %ebx
+  8003ab:	50                   	push   %eax
+  8003ac:	ff d6                	call   *%esi
+  8003ae:	83 c4 10             	add    $0x10,%esp
+  8003b1:	83 c7 01             	add    $0x1,%edi
+  8003b4:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003b8:	83 f8 25             	cmp    $0x25,%eax
+  8003bb:	74 0c                	je     8003c9 <vprintfmt+0x36>
+  8003bd:	85 c0                	test   %eax,%eax
+  8003bf:	75 e6                	jne    8003a7 <vprintfmt+0x14>
+  8003c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c4:	5b                   	pop    %ebx
+  8003c5:	5e                   	pop    %esi
+  8003c6:	5f                   	pop    %edi
+  8003c7:	5d                   	pop    %ebp
+  8003c8:	c3                   	ret
+  8003c9:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  8003cd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8003d4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003db:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  8003e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003e7:	8d 47 01             	lea    0x1(%edi),%eax
+  8003ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ed:	0f b6 17             	movzbl (%edi),%edx
+  8003f0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003f3:	3c 55                	cmp    $0x55,%al
+  8003f5:	0f 87 cf 03 00 00    	ja     8007ca <vprintfmt+0x437>
+  8003fb:	0f b6 c0             	movzbl %al,%eax
+  8003fe:	ff 24 85 a0 21 80 00 	jmp    *0x8021a0(,%eax,4)
+  800405:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800408:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80040c:	eb d9                	jmp    8003e7 <vprintfmt+0x54>
+  80040e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800411:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800415:	eb d0                	jmp    8003e7 <vprintfmt+0x54>
+  800417:	0f b6 d2             	movzbl %dl,%edx
+  80041a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80041d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800422:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800425:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800428:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  80042c:	0f be 17             	movsbl (%edi),%edx
+  80042f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800432:	83 f9 09             	cmp    $0x9,%ecx
+  800435:	77 55                	ja     80048c <vprintfmt+0xf9>
+  800437:	83 c7 01             	add    $0x1,%edi
+  80043a:	eb e9                	jmp    800425 <vprintfmt+0x92>
+  80043c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043f:	8b 00                	mov    (%eax),%eax
+  800441:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800444:	8b 45 14             	mov    0x14(%ebp),%eax
+  800447:	8d 40 04             	lea    0x4(%eax),%eax
+  80044a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80044d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800450:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800454:	79 91                	jns    8003e7 <vprintfmt+0x54>
+  800456:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800459:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80045c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800463:	eb 82                	jmp    8003e7 <vprintfmt+0x54>
+  800465:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800468:	85 d2                	test   %edx,%edx
+  80046a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046f:	0f 49 c2             	cmovns %edx,%eax
+  800472:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800475:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800478:	e9 6a ff ff ff       	jmp    8003e7 <vprintfmt+0x54>
+  80047d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800480:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800487:	e9 5b ff ff ff       	jmp    8003e7 <vprintfmt+0x54>
+  80048c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80048f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800492:	eb bc                	jmp    800450 <vprintfmt+0xbd>
+  800494:	83 c1 01             	add    $0x1,%ecx
+  800497:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80049a:	e9 48 ff ff ff       	jmp    8003e7 <vprintfmt+0x54>
+  80049f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a2:	8d 78 04             	lea    0x4(%eax),%edi
+  8004a5:	83 ec 08             	sub    $0x8,%esp
+  8004a8:	53                   	push   %ebx
+  8004a9:	ff 30                	push   (%eax)
+  8004ab:	ff d6                	call   *%esi
+  8004ad:	83 c4 10             	add    $0x10,%esp
+  8004b0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004b3:	e9 b1 02 00 00       	jmp    800769 <vprintfmt+0x3d6>
+  8004b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bb:	8d 78 04             	lea    0x4(%eax),%edi
+  8004be:	8b 10                	mov    (%eax),%edx
+  8004c0:	89 d0                	mov    %edx,%eax
+  8004c2:	f7 d8                	neg    %eax
+  8004c4:	0f 48 c2             	cmovs  %edx,%eax
+  8004c7:	83 f8 08             	cmp    $0x8,%eax
+  8004ca:	7f 23                	jg     8004ef <vprintfmt+0x15c>
+  8004cc:	8b 14 85 00 23 80 00 	mov    0x802300(,%eax,4),%edx
+  8004d3:	85 d2                	test   %edx,%edx
+  8004d5:	74 18                	je     8004ef <vprintfmt+0x15c>
+  8004d7:	52                   	push   %edx
+  8004d8:	68 ed 20 80 00       	push   $0x8020ed
+  8004dd:	53                   	push   %ebx
+  8004de:	56                   	push   %esi
+  8004df:	e8 92 fe ff ff       	call   800376 <printfmt>
+  8004e4:	83 c4 10             	add    $0x10,%esp
+  8004e7:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004ea:	e9 7a 02 00 00       	jmp    800769 <vprintfmt+0x3d6>
+  8004ef:	50                   	push   %eax
+  8004f0:	68 e4 20 80 00       	push   $0x8020e4
+  8004f5:	53                   	push   %ebx
+  8004f6:	56                   	push   %esi
+  8004f7:	e8 7a fe ff ff       	call   800376 <printfmt>
+  8004fc:	83 c4 10             	add    $0x10,%esp
+  8004ff:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800502:	e9 62 02 00 00       	jmp    800769 <vprintfmt+0x3d6>
+  800507:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050a:	83 c0 04             	add    $0x4,%eax
+  80050d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800510:	8b 45 14             	mov    0x14(%ebp),%eax
+  800513:	8b 08                	mov    (%eax),%ecx
+  800515:	85 c9                	test   %ecx,%ecx
+  800517:	b8 dd 20 80 00       	mov    $0x8020dd,%eax
+  80051c:	0f 45 c1             	cmovne %ecx,%eax
+  80051f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800522:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800526:	7e 06                	jle    80052e <vprintfmt+0x19b>
+  800528:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80052c:	75 0b                	jne    800539 <vprintfmt+0x1a6>
+  80052e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800531:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800534:	89 75 08             	mov    %esi,0x8(%ebp)
+  800537:	eb 5c                	jmp    800595 <vprintfmt+0x202>
+  800539:	83 ec 08             	sub    $0x8,%esp
+  80053c:	ff 75 d0             	push   -0x30(%ebp)
+  80053f:	ff 75 cc             	push   -0x34(%ebp)
+  800542:	e8 87 03 00 00       	call   8008ce <strnlen>
+  800547:	89 c2                	mov    %eax,%edx
+  800549:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80054c:	29 d0                	sub    %edx,%eax
+  80054e:	83 c4 10             	add    $0x10,%esp
+  800551:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800555:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800558:	89 75 08             	mov    %esi,0x8(%ebp)
+  80055b:	89 c6                	mov    %eax,%esi
+  80055d:	eb 0e                	jmp    80056d <vprintfmt+0x1da>
+  80055f:	83 ec 08             	sub    $0x8,%esp
+  800562:	53                   	push   %ebx
+  800563:	57                   	push   %edi
+  800564:	ff 55 08             	call   *0x8(%ebp)
+  800567:	83 ee 01             	sub    $0x1,%esi
+  80056a:	83 c4 10             	add    $0x10,%esp
+  80056d:	85 f6                	test   %esi,%esi
+  80056f:	7f ee                	jg     80055f <vprintfmt+0x1cc>
+  800571:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800574:	8b 75 08             	mov    0x8(%ebp),%esi
+  800577:	85 c0                	test   %eax,%eax
+  800579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80057e:	0f 49 d0             	cmovns %eax,%edx
+  800581:	29 d0                	sub    %edx,%eax
+  800583:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800586:	eb a6                	jmp    80052e <vprintfmt+0x19b>
+  800588:	83 ec 08             	sub    $0x8,%esp
+  80058b:	53                   	push   %ebx
+  80058c:	52                   	push   %edx
+  80058d:	ff 55 08             	call   *0x8(%ebp)
+  800590:	83 c4 10             	add    $0x10,%esp
+  800593:	89 f1                	mov    %esi,%ecx
+  800595:	8d 71 01             	lea    0x1(%ecx),%esi
+  800598:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80059c:	0f be d0             	movsbl %al,%edx
+  80059f:	85 d2                	test   %edx,%edx
+  8005a1:	74 28                	je     8005cb <vprintfmt+0x238>
+  8005a3:	85 ff                	test   %edi,%edi
+  8005a5:	78 05                	js     8005ac <vprintfmt+0x219>
+  8005a7:	83 ef 01             	sub    $0x1,%edi
+  8005aa:	78 30                	js     8005dc <vprintfmt+0x249>
+  8005ac:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005b0:	74 d6                	je     800588 <vprintfmt+0x1f5>
+  8005b2:	0f be c0             	movsbl %al,%eax
+  8005b5:	83 e8 20             	sub    $0x20,%eax
+  8005b8:	83 f8 5e             	cmp    $0x5e,%eax
+  8005bb:	76 cb                	jbe    800588 <vprintfmt+0x1f5>
+  8005bd:	83 ec 08             	sub    $0x8,%esp
+  8005c0:	53                   	push   %ebx
+  8005c1:	6a 3f                	push   $0x3f
+  8005c3:	ff 55 08             	call   *0x8(%ebp)
+  8005c6:	83 c4 10             	add    $0x10,%esp
+  8005c9:	eb c8                	jmp    800593 <vprintfmt+0x200>
+  8005cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ce:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005d4:	01 d0                	add    %edx,%eax
+  8005d6:	29 c8                	sub    %ecx,%eax
+  8005d8:	89 c7                	mov    %eax,%edi
+  8005da:	eb 13                	jmp    8005ef <vprintfmt+0x25c>
+  8005dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005df:	eb ed                	jmp    8005ce <vprintfmt+0x23b>
+  8005e1:	83 ec 08             	sub    $0x8,%esp
+  8005e4:	53                   	push   %ebx
+  8005e5:	6a 20                	push   $0x20
+  8005e7:	ff d6                	call   *%esi
+  8005e9:	83 ef 01             	sub    $0x1,%edi
+  8005ec:	83 c4 10             	add    $0x10,%esp
+  8005ef:	85 ff                	test   %edi,%edi
+  8005f1:	7f ee                	jg     8005e1 <vprintfmt+0x24e>
+  8005f3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f9:	e9 6b 01 00 00       	jmp    800769 <vprintfmt+0x3d6>
+  8005fe:	83 f9 01             	cmp    $0x1,%ecx
+  800601:	7f 1f                	jg     800622 <vprintfmt+0x28f>
+  800603:	85 c9                	test   %ecx,%ecx
+  800605:	74 67                	je     80066e <vprintfmt+0x2db>
+  800607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060a:	8b 00                	mov    (%eax),%eax
+  80060c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80060f:	89 c1                	mov    %eax,%ecx
+  800611:	c1 f9 1f             	sar    $0x1f,%ecx
+  800614:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061a:	8d 40 04             	lea    0x4(%eax),%eax
+  80061d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800620:	eb 17                	jmp    800639 <vprintfmt+0x2a6>
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8b 50 04             	mov    0x4(%eax),%edx
+  800628:	8b 00                	mov    (%eax),%eax
+  80062a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8d 40 08             	lea    0x8(%eax),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+  800639:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80063c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80063f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800644:	85 c9                	test   %ecx,%ecx
+  800646:	0f 89 03 01 00 00    	jns    80074f <vprintfmt+0x3bc>
+  80064c:	83 ec 08             	sub    $0x8,%esp
+  80064f:	53                   	push   %ebx
+  800650:	6a 2d                	push   $0x2d
+  800652:	ff d6                	call   *%esi
+  800654:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800657:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80065a:	f7 da                	neg    %edx
+  80065c:	83 d1 00             	adc    $0x0,%ecx
+  80065f:	f7 d9                	neg    %ecx
+  800661:	83 c4 10             	add    $0x10,%esp
+  800664:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800669:	e9 e1 00 00 00       	jmp    80074f <vprintfmt+0x3bc>
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	8b 00                	mov    (%eax),%eax
+  800673:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800676:	89 c1                	mov    %eax,%ecx
+  800678:	c1 f9 1f             	sar    $0x1f,%ecx
+  80067b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80067e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800681:	8d 40 04             	lea    0x4(%eax),%eax
+  800684:	89 45 14             	mov    %eax,0x14(%ebp)
+  800687:	eb b0                	jmp    800639 <vprintfmt+0x2a6>
+  800689:	83 f9 01             	cmp    $0x1,%ecx
+  80068c:	7f 1e                	jg     8006ac <vprintfmt+0x319>
+  80068e:	85 c9                	test   %ecx,%ecx
+  800690:	74 32                	je     8006c4 <vprintfmt+0x331>
+  800692:	8b 45 14             	mov    0x14(%ebp),%eax
+  800695:	8b 10                	mov    (%eax),%edx
+  800697:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069c:	8d 40 04             	lea    0x4(%eax),%eax
+  80069f:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006a7:	e9 a3 00 00 00       	jmp    80074f <vprintfmt+0x3bc>
+  8006ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006af:	8b 10                	mov    (%eax),%edx
+  8006b1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ba:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006bf:	e9 8b 00 00 00       	jmp    80074f <vprintfmt+0x3bc>
+  8006c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c7:	8b 10                	mov    (%eax),%edx
+  8006c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006d9:	eb 74                	jmp    80074f <vprintfmt+0x3bc>
+  8006db:	83 f9 01             	cmp    $0x1,%ecx
+  8006de:	7f 1b                	jg     8006fb <vprintfmt+0x368>
+  8006e0:	85 c9                	test   %ecx,%ecx
+  8006e2:	74 2c                	je     800710 <vprintfmt+0x37d>
+  8006e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e7:	8b 10                	mov    (%eax),%edx
+  8006e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8006f9:	eb 54                	jmp    80074f <vprintfmt+0x3bc>
+  8006fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fe:	8b 10                	mov    (%eax),%edx
+  800700:	8b 48 04             	mov    0x4(%eax),%ecx
+  800703:	8d 40 08             	lea    0x8(%eax),%eax
+  800706:	89 45 14             	mov    %eax,0x14(%ebp)
+  800709:	bf 08 00 00 00       	mov    $0x8,%edi
+  80070e:	eb 3f                	jmp    80074f <vprintfmt+0x3bc>
+  800710:	8b 45 14             	mov    0x14(%ebp),%eax
+  800713:	8b 10                	mov    (%eax),%edx
+  800715:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071a:	8d 40 04             	lea    0x4(%eax),%eax
+  80071d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800720:	bf 08 00 00 00       	mov    $0x8,%edi
+  800725:	eb 28                	jmp    80074f <vprintfmt+0x3bc>
+  800727:	83 ec 08             	sub    $0x8,%esp
+  80072a:	53                   	push   %ebx
+  80072b:	6a 30                	push   $0x30
+  80072d:	ff d6                	call   *%esi
+  80072f:	83 c4 08             	add    $0x8,%esp
+  800732:	53                   	push   %ebx
+  800733:	6a 78                	push   $0x78
+  800735:	ff d6                	call   *%esi
+  800737:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073a:	8b 10                	mov    (%eax),%edx
+  80073c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800741:	83 c4 10             	add    $0x10,%esp
+  800744:	8d 40 04             	lea    0x4(%eax),%eax
+  800747:	89 45 14             	mov    %eax,0x14(%ebp)
+  80074a:	bf 10 00 00 00       	mov    $0x10,%edi
+  80074f:	83 ec 0c             	sub    $0xc,%esp
+  800752:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800756:	50                   	push   %eax
+  800757:	ff 75 e0             	push   -0x20(%ebp)
+  80075a:	57                   	push   %edi
+  80075b:	51                   	push   %ecx
+  80075c:	52                   	push   %edx
+  80075d:	89 da                	mov    %ebx,%edx
+  80075f:	89 f0                	mov    %esi,%eax
+  800761:	e8 4a fb ff ff       	call   8002b0 <printnum>
+  800766:	83 c4 20             	add    $0x20,%esp
+  800769:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80076c:	e9 40 fc ff ff       	jmp    8003b1 <vprintfmt+0x1e>
+  800771:	83 f9 01             	cmp    $0x1,%ecx
+  800774:	7f 1b                	jg     800791 <vprintfmt+0x3fe>
+  800776:	85 c9                	test   %ecx,%ecx
+  800778:	74 2c                	je     8007a6 <vprintfmt+0x413>
+  80077a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077d:	8b 10                	mov    (%eax),%edx
+  80077f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800784:	8d 40 04             	lea    0x4(%eax),%eax
+  800787:	89 45 14             	mov    %eax,0x14(%ebp)
+  80078a:	bf 10 00 00 00       	mov    $0x10,%edi
+  80078f:	eb be                	jmp    80074f <vprintfmt+0x3bc>
+  800791:	8b 45 14             	mov    0x14(%ebp),%eax
+  800794:	8b 10                	mov    (%eax),%edx
+  800796:	8b 48 04             	mov    0x4(%eax),%ecx
+  800799:	8d 40 08             	lea    0x8(%eax),%eax
+  80079c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80079f:	bf 10 00 00 00       	mov    $0x10,%edi
+  8007a4:	eb a9                	jmp    80074f <vprintfmt+0x3bc>
+  8007a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a9:	8b 10                	mov    (%eax),%edx
+  8007ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b6:	bf 10 00 00 00       	mov    $0x10,%edi
+  8007bb:	eb 92                	jmp    80074f <vprintfmt+0x3bc>
+  8007bd:	83 ec 08             	sub    $0x8,%esp
+  8007c0:	53                   	push   %ebx
+  8007c1:	6a 25                	push   $0x25
+  8007c3:	ff d6                	call   *%esi
+  8007c5:	83 c4 10             	add    $0x10,%esp
+  8007c8:	eb 9f                	jmp    800769 <vprintfmt+0x3d6>
+  8007ca:	83 ec 08             	sub    $0x8,%esp
+  8007cd:	53                   	push   %ebx
+  8007ce:	6a 25                	push   $0x25
+  8007d0:	ff d6                	call   *%esi
+  8007d2:	83 c4 10             	add    $0x10,%esp
+  8007d5:	89 f8                	mov    %edi,%eax
+  8007d7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007db:	74 05                	je     8007e2 <vprintfmt+0x44f>
+  8007dd:	83 e8 01             	sub    $0x1,%eax
+  8007e0:	eb f5                	jmp    8007d7 <vprintfmt+0x444>
+  8007e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007e5:	eb 82                	jmp    800769 <vprintfmt+0x3d6>
+
+008007e7 <vsnprintf>:
+  8007e7:	55                   	push   %ebp
+  8007e8:	89 e5                	mov    %esp,%ebp
+  8007ea:	83 ec 18             	sub    $0x18,%esp
+  8007ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007f3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007f6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007fa:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007fd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800804:	85 c0                	test   %eax,%eax
+  800806:	74 26                	je     80082e <vsnprintf+0x47>
+  800808:	85 d2                	test   %edx,%edx
+  80080a:	7e 22                	jle    80082e <vsnprintf+0x47>
+  80080c:	ff 75 14             	push   0x14(%ebp)
+  80080f:	ff 75 10             	push   0x10(%ebp)
+  800812:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800815:	50                   	push   %eax
+  800816:	68 59 03 80 00       	push   $0x800359
+  80081b:	e8 73 fb ff ff       	call   800393 <vprintfmt>
+  800820:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800823:	c6 00 00             	movb   $0x0,(%eax)
+  800826:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800829:	83 c4 10             	add    $0x10,%esp
+  80082c:	c9                   	leave
+  80082d:	c3                   	ret
+  80082e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800833:	eb f7                	jmp    80082c <vsnprintf+0x45>
+
+00800835 <snprintf>:
+  800835:	55                   	push   %ebp
+  800836:	89 e5                	mov    %esp,%ebp
+  800838:	83 ec 08             	sub    $0x8,%esp
+  80083b:	8d 45 14             	lea    0x14(%ebp),%eax
+  80083e:	50                   	push   %eax
+  80083f:	ff 75 10             	push   0x10(%ebp)
+  800842:	ff 75 0c             	push   0xc(%ebp)
+  800845:	ff 75 08             	push   0x8(%ebp)
+  800848:	e8 9a ff ff ff       	call   8007e7 <vsnprintf>
+  80084d:	c9                   	leave
+  80084e:	c3                   	ret
+
+0080084f <copy_fwd>:
+  80084f:	55                   	push   %ebp
+  800850:	89 e5                	mov    %esp,%ebp
+  800852:	57                   	push   %edi
+  800853:	56                   	push   %esi
+  800854:	53                   	push   %ebx
+  800855:	89 c7                	mov    %eax,%edi
+  800857:	89 d6                	mov    %edx,%esi
+  800859:	89 c8                	mov    %ecx,%eax
+  80085b:	83 f9 0f             	cmp    $0xf,%ecx
+  80085e:	76 1c                	jbe    80087c <copy_fwd+0x2d>
+  800860:	89 f9                	mov    %edi,%ecx
+  800862:	f7 d9                	neg    %ecx
+  800864:	89 cb                	mov    %ecx,%ebx
+  800866:	83 e3 03             	and    $0x3,%ebx
+  800869:	29 d8                	sub    %ebx,%eax
+  80086b:	89 c2                	mov    %eax,%edx
+  80086d:	c1 ea 02             	shr    $0x2,%edx
+  800870:	83 e0 03             	and    $0x3,%eax
+  800873:	89 d9                	mov    %ebx,%ecx
+  800875:	fc                   	cld
+  800876:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800878:	89 d1                	mov    %edx,%ecx
+  80087a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80087c:	89 c1                	mov    %eax,%ecx
+  80087e:	fc                   	cld
+  80087f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800881:	5b                   	pop    %ebx
+  800882:	5e                   	pop    %esi
+  800883:	5f                   	pop    %edi
+  800884:	5d                   	pop    %ebp
+  800885:	c3                   	ret
+
+00800886 <have_sse2>:
+  800886:	83 3d 0c 30 80 00 00 	cmpl   $0x0,0x80300c
+  80088d:	78 06                	js     800895 <have_sse2+0xf>
+  80088f:	a1 0c 30 80 00       	mov    0x80300c,%eax
+  800894:	c3                   	ret
+  800895:	55                   	push   %ebp
+  800896:	89 e5                	mov    %esp,%ebp
+  800898:	53                   	push   %ebx
+  800899:	b8 01 00 00 00       	mov    $0x1,%eax
+  80089e:	0f a2                	cpuid
+  8008a0:	c1 ea 1a             	shr    $0x1a,%edx
+  8008a3:	83 e2 01             	and    $0x1,%edx
+  8008a6:	89 15 0c 30 80 00    	mov    %edx,0x80300c
+  8008ac:	a1 0c 30 80 00       	mov    0x80300c,%eax
+  8008b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008b4:	c9                   	leave
+  8008b5:	c3                   	ret
+
+008008b6 <strlen>:
+  8008b6:	55                   	push   %ebp
+  8008b7:	89 e5                	mov    %esp,%ebp
+  8008b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c1:	eb 03                	jmp    8008c6 <strlen+0x10>
+  8008c3:	83 c0 01             	add    $0x1,%eax
+  8008c6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008ca:	75 f7                	jne    8008c3 <strlen+0xd>
+  8008cc:	5d                   	pop    %ebp
+  8008cd:	c3                   	ret
+
+008008ce <strnlen>:
+  8008ce:	55                   	push   %ebp
+  8008cf:	89 e5                	mov    %esp,%ebp
+  8008d1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008dc:	eb 03                	jmp    8008e1 <strnlen+0x13>
+  8008de:	83 c0 01             	add    $0x1,%eax
+  8008e1:	39 d0                	cmp    %edx,%eax
+  8008e3:	74 08                	je     8008ed <strnlen+0x1f>
+  8008e5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008e9:	75 f3                	jne    8008de <strnlen+0x10>
+  8008eb:	89 c2                	mov    %eax,%edx
+  8008ed:	89 d0                	mov    %edx,%eax
+  8008ef:	5d                   	pop    %ebp
+  8008f0:	c3                   	ret
+
+008008f1 <strcpy>:
+  8008f1:	55                   	push   %ebp
+  8008f2:	89 e5                	mov    %esp,%ebp
+  8008f4:	53                   	push   %ebx
+  8008f5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800900:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800904:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800907:	83 c0 01             	add    $0x1,%eax
+  80090a:	84 d2                	test   %dl,%dl
+  80090c:	75 f2                	jne    800900 <strcpy+0xf>
+  80090e:	89 c8                	mov    %ecx,%eax
+  800910:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800913:	c9                   	leave
+  800914:	c3                   	ret
+
+00800915 <strcat>:
+  800915:	55                   	push   %ebp
+  800916:	89 e5                	mov    %esp,%ebp
+  800918:	53                   	push   %ebx
+  800919:	83 ec 10             	sub    $0x10,%esp
+  80091c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80091f:	53                   	push   %ebx
+  800920:	e8 91 ff ff ff       	call   8008b6 <strlen>
+  800925:	83 c4 08             	add    $0x8,%esp
+  800928:	ff 75 0c             	push   0xc(%ebp)
+  80092b:	01 d8                	add    %ebx,%eax
+  80092d:	50                   	push   %eax
+  80092e:	e8 be ff ff ff       	call   8008f1 <strcpy>
+  800933:	89 d8                	mov    %ebx,%eax
+  800935:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800938:	c9                   	leave
+  800939:	c3                   	ret
+
+0080093a <strncpy>:
+  80093a:	55                   	push   %ebp
+  80093b:	89 e5                	mov    %esp,%ebp
+  80093d:	56                   	push   %esi
+  80093e:	53                   	push   %ebx
+  80093f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800942:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800945:	89 f3                	mov    %esi,%ebx
+  800947:	03 5d 10             	add    0x10(%ebp),%ebx
+  80094a:	89 f0                	mov    %esi,%eax
+  80094c:	eb 0f                	jmp    80095d <strncpy+0x23>
+  80094e:	83 c0 01             	add    $0x1,%eax
+  800951:	0f b6 0a             	movzbl (%edx),%ecx
+  800954:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800957:	80 f9 01             	cmp    $0x1,%cl
+  80095a:	83 da ff             	sbb    $0xffffffff,%edx
+  80095d:	39 d8                	cmp    %ebx,%eax
+  80095f:	75 ed                	jne    80094e <strncpy+0x14>
+  800961:	89 f0                	mov    %esi,%eax
+  800963:	5b                   	pop    %ebx
+  800964:	5e                   	pop    %esi
+  800965:	5d                   	pop    %ebp
+  800966:	c3                   	ret
+
+00800967 <strlcpy>:
+  800967:	55                   	push   %ebp
+  800968:	89 e5                	mov    %esp,%ebp
+  80096a:	56                   	push   %esi
+  80096b:	53                   	push   %ebx
+  80096c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80096f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800972:	8b 55 10             	mov    0x10(%ebp),%edx
+  800975:	89 f0                	mov    %esi,%eax
+  800977:	85 d2                	test   %edx,%edx
+  800979:	74 21                	je     80099c <strlcpy+0x35>
+  80097b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80097f:	89 f2                	mov    %esi,%edx
+  800981:	eb 09                	jmp    80098c <strlcpy+0x25>
+  800983:	83 c1 01             	add    $0x1,%ecx
+  800986:	83 c2 01             	add    $0x1,%edx
+  800989:	88 5a ff             	mov    %bl,-0x1(%edx)
+  80098c:	39 c2                	cmp    %eax,%edx
+  80098e:	74 09                	je     800999 <strlcpy+0x32>
+  800990:	0f b6 19             	movzbl (%ecx),%ebx
+  800993:	84 db                	test   %bl,%bl
+  800995:	75 ec                	jne    800983 <strlcpy+0x1c>
+  800997:	89 d0                	mov    %edx,%eax
+  800999:	c6 00 00             	movb   $0x0,(%eax)
+  80099c:	29 f0                	sub    %esi,%eax
+  80099e:	5b                   	pop    %ebx
+  80099f:	5e                   	pop    %esi
+  8009a0:	5d                   	pop    %ebp
+  8009a1:	c3                   	ret
+
+008009a2 <strcmp>:
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009ab:	eb 06                	jmp    8009b3 <strcmp+0x11>
+  8009ad:	83 c1 01             	add    $0x1,%ecx
+  8009b0:	83 c2 01             	add    $0x1,%edx
+  8009b3:	0f b6 01             	movzbl (%ecx),%eax
+  8009b6:	84 c0                	test   %al,%al
+  8009b8:	74 04                	je     8009be <strcmp+0x1c>
+  8009ba:	3a 02                	cmp    (%edx),%al
+  8009bc:	74 ef                	je     8009ad <strcmp+0xb>
+  8009be:	0f b6 c0             	movzbl %al,%eax
+  8009c1:	0f b6 12             	movzbl (%edx),%edx
+  8009c4:	29 d0                	sub    %edx,%eax
+  8009c6:	5d                   	pop    %ebp
+  8009c7:	c3                   	ret
+
+008009c8 <strncmp>:
+  8009c8:	55                   	push   %ebp
+  8009c9:	89 e5                	mov    %esp,%ebp
+  8009cb:	53                   	push   %ebx
+  8009cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d2:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009d5:	eb 09                	jmp    8009e0 <strncmp+0x18>
+  8009d7:	83 ea 01             	sub    $0x1,%edx
+  8009da:	83 c0 01             	add    $0x1,%eax
+  8009dd:	83 c1 01             	add    $0x1,%ecx
+  8009e0:	85 d2                	test   %edx,%edx
+  8009e2:	74 18                	je     8009fc <strncmp+0x34>
+  8009e4:	0f b6 18             	movzbl (%eax),%ebx
+  8009e7:	84 db                	test   %bl,%bl
+  8009e9:	74 04                	je     8009ef <strncmp+0x27>
+  8009eb:	3a 19                	cmp    (%ecx),%bl
+  8009ed:	74 e8                	je     8009d7 <strncmp+0xf>
+  8009ef:	0f b6 00             	movzbl (%eax),%eax
+  8009f2:	0f b6 11             	movzbl (%ecx),%edx
+  8009f5:	29 d0                	sub    %edx,%eax
+  8009f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009fa:	c9                   	leave
+  8009fb:	c3                   	ret
+  8009fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a01:	eb f4                	jmp    8009f7 <strncmp+0x2f>
+
+00800a03 <strchr>:
+  800a03:	55                   	push   %ebp
+  800a04:	89 e5                	mov    %esp,%ebp
+  800a06:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a09:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800a0d:	eb 03                	jmp    800a12 <strchr+0xf>
+  800a0f:	83 c0 01             	add    $0x1,%eax
+  800a12:	0f b6 10             	movzbl (%eax),%edx
+  800a15:	84 d2                	test   %dl,%dl
+  800a17:	74 06                	je     800a1f <strchr+0x1c>
+  800a19:	38 ca                	cmp    %cl,%dl
+  800a1b:	75 f2                	jne    800a0f <strchr+0xc>
+  800a1d:	eb 05                	jmp    800a24 <strchr+0x21>
+  800a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a24:	5d                   	pop    %ebp
+  800a25:	c3                   	ret
+
+00800a26 <strfind>:
+  800a26:	55                   	push   %ebp
+  800a27:	89 e5                	mov    %esp,%ebp
+  800a29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800a30:	0f b6 10             	movzbl (%eax),%edx
+  800a33:	38 ca                	cmp    %cl,%dl
+  800a35:	74 09                	je     800a40 <strfind+0x1a>
+  800a37:	84 d2                	test   %dl,%dl
+  800a39:	74 05                	je     800a40 <strfind+0x1a>
+  800a3b:	83 c0 01             	add    $0x1,%eax
+  800a3e:	eb f0                	jmp    800a30 <strfind+0xa>
+  800a40:	5d                   	pop    %ebp
+  800a41:	c3                   	ret
+
+00800a42 <memset>:
+  800a42:	55                   	push   %ebp
+  800a43:	89 e5                	mov    %esp,%ebp
+  800a45:	57                   	push   %edi
+  800a46:	56                   	push   %esi
+  800a47:	53                   	push   %ebx
+  800a48:	83 ec 04             	sub    $0x4,%esp
+  800a4b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a4e:	8b 55 10             	mov    0x10(%ebp),%edx
+  800a51:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  800a55:	89 f7                	mov    %esi,%edi
+  800a57:	83 fa 0f             	cmp    $0xf,%edx
+  800a5a:	76 24                	jbe    800a80 <memset+0x3e>
+  800a5c:	89 f1                	mov    %esi,%ecx
+  800a5e:	f7 d9                	neg    %ecx
+  800a60:	83 e1 03             	and    $0x3,%ecx
+  800a63:	29 ca                	sub    %ecx,%edx
+  800a65:	89 d0                	mov    %edx,%eax
+  800a67:	c1 e8 02             	shr    $0x2,%eax
+  800a6a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  800a6d:	83 e2 03             	and    $0x3,%edx
+  800a70:	89 d8                	mov    %ebx,%eax
+  800a72:	fc                   	cld
+  800a73:	f3 aa                	rep stos %al,%es:(%edi)
+  800a75:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  800a7b:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  800a7e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a80:	89 d1                	mov    %edx,%ecx
+  800a82:	89 d8                	mov    %ebx,%eax
+  800a84:	fc                   	cld
+  800a85:	f3 aa                	rep stos %al,%es:(%edi)
+  800a87:	89 f0                	mov    %esi,%eax
+  800a89:	83 c4 04             	add    $0x4,%esp
+  800a8c:	5b                   	pop    %ebx
+  800a8d:	5e                   	pop    %esi
+  800a8e:	5f                   	pop    %edi
+  800a8f:	5d                   	pop    %ebp
+  800a90:	c3                   	ret
+
+00800a91 <memmove>:
+  800a91:	55                   	push   %ebp
+  800a92:	89 e5                	mov    %esp,%ebp
+  800a94:	57                   	push   %edi
+  800a95:	56                   	push   %esi
+  800a96:	53                   	push   %ebx
+  800a97:	83 ec 0c             	sub    $0xc,%esp
+  800a9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aa0:	8b 45 10             	mov    0x10(%ebp),%eax
+  800aa3:	85 c0                	test   %eax,%eax
+  800aa5:	74 14                	je     800abb <memmove+0x2a>
+  800aa7:	39 da                	cmp    %ebx,%edx
+  800aa9:	73 07                	jae    800ab2 <memmove+0x21>
+  800aab:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  800aae:	39 cb                	cmp    %ecx,%ebx
+  800ab0:	72 13                	jb     800ac5 <memmove+0x34>
+  800ab2:	89 c1                	mov    %eax,%ecx
+  800ab4:	89 d8                	mov    %ebx,%eax
+  800ab6:	e8 94 fd ff ff       	call   80084f <copy_fwd>
+  800abb:	89 d8                	mov    %ebx,%eax
+  800abd:	83 c4 0c             	add    $0xc,%esp
+  800ac0:	5b                   	pop    %ebx
+  800ac1:	5e                   	pop    %esi
+  800ac2:	5f                   	pop    %edi
+  800ac3:	5d                   	pop    %ebp
+  800ac4:	c3                   	ret
+  800ac5:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800ac8:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800acb:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800ace:	83 f8 0f             	cmp    $0xf,%eax
+  800ad1:	76 23                	jbe    800af6 <memmove+0x65>
+  800ad3:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800ad6:	83 e1 03             	and    $0x3,%ecx
+  800ad9:	29 c8                	sub    %ecx,%eax
+  800adb:	89 c2                	mov    %eax,%edx
+  800add:	c1 ea 02             	shr    $0x2,%edx
+  800ae0:	83 e0 03             	and    $0x3,%eax
+  800ae3:	fd                   	std
+  800ae4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800ae6:	83 ef 03             	sub    $0x3,%edi
+  800ae9:	83 ee 03             	sub    $0x3,%esi
+  800aec:	89 d1                	mov    %edx,%ecx
+  800aee:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800af0:	83 c7 03             	add    $0x3,%edi
+  800af3:	83 c6 03             	add    $0x3,%esi
+  800af6:	89 c1                	mov    %eax,%ecx
+  800af8:	fd                   	std
+  800af9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800afb:	fc                   	cld
+  800afc:	eb bd                	jmp    800abb <memmove+0x2a>
+
+00800afe <memcpy>:
+  800afe:	55                   	push   %ebp
+  800aff:	89 e5                	mov    %esp,%ebp
+  800b01:	53                   	push   %ebx
+  800b02:	83 ec 04             	sub    $0x4,%esp
+  800b05:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b08:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b0b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b0e:	89 d8                	mov    %ebx,%eax
+  800b10:	e8 3a fd ff ff       	call   80084f <copy_fwd>
+  800b15:	89 d8                	mov    %ebx,%eax
+  800b17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b1a:	c9                   	leave
+  800b1b:	c3                   	ret
+
+00800b1c <page_copy>:
+  800b1c:	55                   	push   %ebp
+  800b1d:	89 e5                	mov    %esp,%ebp
+  800b1f:	57                   	push   %edi
+  800b20:	56                   	push   %esi
+  800b21:	53                   	push   %ebx
+  800b22:	83 ec 0c             	sub    $0xc,%esp
+  800b25:	e8 5c fd ff ff       	call   800886 <have_sse2>
+  800b2a:	85 c0                	test   %eax,%eax
+  800b2c:	74 39                	je     800b67 <page_copy+0x4b>
+  800b2e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b31:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b34:	be 00 01 00 00       	mov    $0x100,%esi
+  800b39:	8b 03                	mov    (%ebx),%eax
+  800b3b:	8b 53 04             	mov    0x4(%ebx),%edx
+  800b3e:	0f c3 01             	movnti %eax,(%ecx)
+  800b41:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800b45:	8b 43 08             	mov    0x8(%ebx),%eax
+  800b48:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800b4b:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800b4f:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800b53:	83 c3 10             	add    $0x10,%ebx
+  800b56:	83 c1 10             	add    $0x10,%ecx
+  800b59:	4e                   	dec    %esi
+  800b5a:	75 dd                	jne    800b39 <page_copy+0x1d>
+  800b5c:	0f ae f8             	sfence
+  800b5f:	83 c4 0c             	add    $0xc,%esp
+  800b62:	5b                   	pop    %ebx
+  800b63:	5e                   	pop    %esi
+  800b64:	5f                   	pop    %edi
+  800b65:	5d                   	pop    %ebp
+  800b66:	c3                   	ret
+  800b67:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b6a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b6d:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800b72:	fc                   	cld
+  800b73:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b75:	eb e8                	jmp    800b5f <page_copy+0x43>
+
+00800b77 <page_zero>:
+  800b77:	55                   	push   %ebp
+  800b78:	89 e5                	mov    %esp,%ebp
+  800b7a:	57                   	push   %edi
+  800b7b:	83 ec 04             	sub    $0x4,%esp
+  800b7e:	e8 03 fd ff ff       	call   800886 <have_sse2>
+  800b83:	85 c0                	test   %eax,%eax
+  800b85:	74 3a                	je     800bc1 <page_zero+0x4a>
+  800b87:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8a:	ba 80 00 00 00       	mov    $0x80,%edx
+  800b8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b94:	0f c3 08             	movnti %ecx,(%eax)
+  800b97:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800b9b:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800b9f:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800ba3:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800ba7:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800bab:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800baf:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800bb3:	83 c0 20             	add    $0x20,%eax
+  800bb6:	4a                   	dec    %edx
+  800bb7:	75 db                	jne    800b94 <page_zero+0x1d>
+  800bb9:	0f ae f8             	sfence
+  800bbc:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bbf:	c9                   	leave
+  800bc0:	c3                   	ret
+  800bc1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bc4:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800bc9:	fc                   	cld
+  800bca:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bcc:	eb ee                	jmp    800bbc <page_zero+0x45>
+
+00800bce <memcmp>:
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	56                   	push   %esi
+  800bd2:	53                   	push   %ebx
+  800bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bd9:	89 c6                	mov    %eax,%esi
+  800bdb:	03 75 10             	add    0x10(%ebp),%esi
+  800bde:	eb 06                	jmp    800be6 <memcmp+0x18>
+  800be0:	83 c0 01             	add    $0x1,%eax
+  800be3:	83 c2 01             	add    $0x1,%edx
+  800be6:	39 f0                	cmp    %esi,%eax
+  800be8:	74 14                	je     800bfe <memcmp+0x30>
+  800bea:	0f b6 08             	movzbl (%eax),%ecx
+  800bed:	0f b6 1a             	movzbl (%edx),%ebx
+  800bf0:	38 d9                	cmp    %bl,%cl
+  800bf2:	74 ec                	je     800be0 <memcmp+0x12>
+  800bf4:	0f b6 c1             	movzbl %cl,%eax
+  800bf7:	0f b6 db             	movzbl %bl,%ebx
+  800bfa:	29 d8                	sub    %ebx,%eax
+  800bfc:	eb 05                	jmp    800c03 <memcmp+0x35>
+  800bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c03:	5b                   	pop    %ebx
+  800c04:	5e                   	pop    %esi
+  800c05:	5d                   	pop    %ebp
+  800c06:	c3                   	ret
+
+00800c07 <memfind>:
+  800c07:	55                   	push   %ebp
+  800c08:	89 e5                	mov    %esp,%ebp
+  800c0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c10:	89 c2                	mov    %eax,%edx
+  800c12:	03 55 10             	add    0x10(%ebp),%edx
+  800c15:	eb 03                	jmp    800c1a <memfind+0x13>
+  800c17:	83 c0 01             	add    $0x1,%eax
+  800c1a:	39 d0                	cmp    %edx,%eax
+  800c1c:	73 04                	jae    800c22 <memfind+0x1b>
+  800c1e:	38 08                	cmp    %cl,(%eax)
+  800c20:	75 f5                	jne    800c17 <memfind+0x10>
+  800c22:	5d                   	pop    %ebp
+  800c23:	c3                   	ret
+
+00800c24 <strtol>:
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	57                   	push   %edi
+  800c28:	56                   	push   %esi
+  800c29:	53                   	push   %ebx
+  800c2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c30:	eb 03                	jmp    800c35 <strtol+0x11>
+  800c32:	83 c2 01             	add    $0x1,%edx
+  800c35:	0f b6 02             	movzbl (%edx),%eax
+  800c38:	3c 20                	cmp    $0x20,%al
+  800c3a:	74 f6                	je     800c32 <strtol+0xe>
+  800c3c:	3c 09                	cmp    $0x9,%al
+  800c3e:	74 f2                	je     800c32 <strtol+0xe>
+  800c40:	3c 2b                	cmp    $0x2b,%al
+  800c42:	74 2a                	je     800c6e <strtol+0x4a>
+  800c44:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c49:	3c 2d                	cmp    $0x2d,%al
+  800c4b:	74 2b                	je     800c78 <strtol+0x54>
+  800c4d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c53:	75 0f                	jne    800c64 <strtol+0x40>
+  800c55:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c58:	74 28                	je     800c82 <strtol+0x5e>
+  800c5a:	85 db                	test   %ebx,%ebx
+  800c5c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c61:	0f 44 d8             	cmove  %eax,%ebx
+  800c64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c69:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c6c:	eb 46                	jmp    800cb4 <strtol+0x90>
+  800c6e:	83 c2 01             	add    $0x1,%edx
+  800c71:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c76:	eb d5                	jmp    800c4d <strtol+0x29>
+  800c78:	83 c2 01             	add    $0x1,%edx
+  800c7b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c80:	eb cb                	jmp    800c4d <strtol+0x29>
+  800c82:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c86:	74 0e                	je     800c96 <strtol+0x72>
+  800c88:	85 db                	test   %ebx,%ebx
+  800c8a:	75 d8                	jne    800c64 <strtol+0x40>
+  800c8c:	83 c2 01             	add    $0x1,%edx
+  800c8f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c94:	eb ce                	jmp    800c64 <strtol+0x40>
+  800c96:	83 c2 02             	add    $0x2,%edx
+  800c99:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c9e:	eb c4                	jmp    800c64 <strtol+0x40>
+  800ca0:	0f be c0             	movsbl %al,%eax
+  800ca3:	83 e8 30             	sub    $0x30,%eax
+  800ca6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ca9:	7d 3a                	jge    800ce5 <strtol+0xc1>
+  800cab:	83 c2 01             	add    $0x1,%edx
+  800cae:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cb2:	01 c1                	add    %eax,%ecx
+  800cb4:	0f b6 02             	movzbl (%edx),%eax
+  800cb7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cba:	89 f3                	mov    %esi,%ebx
+  800cbc:	80 fb 09             	cmp    $0x9,%bl
+  800cbf:	76 df                	jbe    800ca0 <strtol+0x7c>
+  800cc1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cc4:	89 f3                	mov    %esi,%ebx
+  800cc6:	80 fb 19             	cmp    $0x19,%bl
+  800cc9:	77 08                	ja     800cd3 <strtol+0xaf>
+  800ccb:	0f be c0             	movsbl %al,%eax
+  800cce:	83 e8 57             	sub    $0x57,%eax
+  800cd1:	eb d3                	jmp    800ca6 <strtol+0x82>
+  800cd3:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cd6:	89 f3                	mov    %esi,%ebx
+  800cd8:	80 fb 19             	cmp    $0x19,%bl
+  800cdb:	77 08                	ja     800ce5 <strtol+0xc1>
+  800cdd:	0f be c0             	movsbl %al,%eax
+  800ce0:	83 e8 37             	sub    $0x37,%eax
+  800ce3:	eb c1                	jmp    800ca6 <strtol+0x82>
+  800ce5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ce9:	74 05                	je     800cf0 <strtol+0xcc>
+  800ceb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cee:	89 10                	mov    %edx,(%eax)
+  800cf0:	89 c8                	mov    %ecx,%eax
+  800cf2:	f7 d8                	neg    %eax
+  800cf4:	85 ff                	test   %edi,%edi
+  800cf6:	0f 45 c8             	cmovne %eax,%ecx
+  800cf9:	89 c8                	mov    %ecx,%eax
+  800cfb:	5b                   	pop    %ebx
+  800cfc:	5e                   	pop    %esi
+  800cfd:	5f                   	pop    %edi
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+
+00800d00 <sys_cputs>:
+  800d00:	55                   	push   %ebp
+  800d01:	89 e5                	mov    %esp,%ebp
+  800d03:	57                   	push   %edi
+  800d04:	56                   	push   %esi
+  800d05:	53                   	push   %ebx
+  800d06:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  800d0d:	78 21                	js     800d30 <sys_cputs+0x30>
+  800d0f:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  800d16:	75 2d                	jne    800d45 <sys_cputs+0x45>
+  800d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d23:	89 c3                	mov    %eax,%ebx
+  800d25:	89 c7                	mov    %eax,%edi
+  800d27:	89 c6                	mov    %eax,%esi
+  800d29:	cd 30                	int    $0x30
+  800d2b:	5b                   	pop    %ebx
+  800d2c:	5e                   	pop    %esi
+  800d2d:	5f                   	pop    %edi
+  800d2e:	5d                   	pop    %ebp
+  800d2f:	c3                   	ret
+  800d30:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d35:	0f a2                	cpuid
+  800d37:	c1 ea 0b             	shr    $0xb,%edx
+  800d3a:	83 e2 01             	and    $0x1,%edx
+  800d3d:	89 15 10 30 80 00    	mov    %edx,0x803010
+  800d43:	eb ca                	jmp    800d0f <sys_cputs+0xf>
+  800d45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d50:	89 c3                	mov    %eax,%ebx
+  800d52:	89 c7                	mov    %eax,%edi
+  800d54:	89 c6                	mov    %eax,%esi
+  800d56:	55                   	push   %ebp
+  800d57:	68 60 0d 80 00       	push   $0x800d60
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	0f 34                	sysenter
+  800d60:	83 c4 04             	add    $0x4,%esp
+  800d63:	5d                   	pop    %ebp
+  800d64:	eb c5                	jmp    800d2b <sys_cputs+0x2b>
+
+00800d66 <sys_cgetc>:
+  800d66:	55                   	push   %ebp
+  800d67:	89 e5                	mov    %esp,%ebp
+  800d69:	57                   	push   %edi
+  800d6a:	56                   	push   %esi
+  800d6b:	53                   	push   %ebx
+  800d6c:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  800d73:	78 22                	js     800d97 <sys_cgetc+0x31>
+  800d75:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  800d7c:	75 2e                	jne    800dac <sys_cgetc+0x46>
+  800d7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d83:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d88:	89 d1                	mov    %edx,%ecx
+  800d8a:	89 d3                	mov    %edx,%ebx
+  800d8c:	89 d7                	mov    %edx,%edi
+  800d8e:	89 d6                	mov    %edx,%esi
+  800d90:	cd 30                	int    $0x30
+  800d92:	5b                   	pop    %ebx
+  800d93:	5e                   	pop    %esi
+  800d94:	5f                   	pop    %edi
+  800d95:	5d                   	pop    %ebp
+  800d96:	c3                   	ret
+  800d97:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d9c:	0f a2                	cpuid
+  800d9e:	c1 ea 0b             	shr    $0xb,%edx
+  800da1:	83 e2 01             	and    $0x1,%edx
+  800da4:	89 15 10 30 80 00    	mov    %edx,0x803010
+  800daa:	eb c9                	jmp    800d75 <sys_cgetc+0xf>
+  800dac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800db6:	89 d1                	mov    %edx,%ecx
+  800db8:	89 d3                	mov    %edx,%ebx
+  800dba:	89 d7                	mov    %edx,%edi
+  800dbc:	89 d6                	mov    %edx,%esi
+  800dbe:	55                   	push   %ebp
+  800dbf:	68 c8 0d 80 00       	push   $0x800dc8
+  800dc4:	89 e5                	mov    %esp,%ebp
+  800dc6:	0f 34                	sysenter
+  800dc8:	83 c4 04             	add    $0x4,%esp
+  800dcb:	5d                   	pop    %ebp
+  800dcc:	eb c4                	jmp    800d92 <sys_cgetc+0x2c>
+
+00800dce <sys_env_destroy>:
+  800dce:	55                   	push   %ebp
+  800dcf:	89 e5                	mov    %esp,%ebp
+  800dd1:	57                   	push   %edi
+  800dd2:	56                   	push   %esi
+  800dd3:	53                   	push   %ebx
+  800dd4:	83 ec 0c             	sub    $0xc,%esp
+  800dd7:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  800dde:	78 2a                	js     800e0a <sys_env_destroy+0x3c>
+  800de0:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  800de7:	75 36                	jne    800e1f <sys_env_destroy+0x51>
+  800de9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dee:	b8 03 00 00 00       	mov    $0x3,%eax
+  800df3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df6:	89 cb                	mov    %ecx,%ebx
+  800df8:	89 cf                	mov    %ecx,%edi
+  800dfa:	89 ce                	mov    %ecx,%esi
+  800dfc:	cd 30                	int    $0x30
+  800dfe:	85 c0                	test   %eax,%eax
+  800e00:	7f 40                	jg     800e42 <sys_env_destroy+0x74>
+  800e02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e05:	5b                   	pop    %ebx
+  800e06:	5e                   	pop    %esi
+  800e07:	5f                   	pop    %edi
+  800e08:	5d                   	pop    %ebp
+  800e09:	c3                   	ret
+  800e0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e0f:	0f a2                	cpuid
+  800e11:	c1 ea 0b             	shr    $0xb,%edx
+  800e14:	83 e2 01             	and    $0x1,%edx
+  800e17:	89 15 10 30 80 00    	mov    %edx,0x803010
+  800e1d:	eb c1                	jmp    800de0 <sys_env_destroy+0x12>
+  800e1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e27:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e2c:	89 cb                	mov    %ecx,%ebx
+  800e2e:	89 cf                	mov    %ecx,%edi
+  800e30:	89 ce                	mov    %ecx,%esi
+  800e32:	55                   	push   %ebp
+  800e33:	68 3c 0e 80 00       	push   $0x800e3c
+  800e38:	89 e5                	mov    %esp,%ebp
+  800e3a:	0f 34                	sysenter
+  800e3c:	83 c4 04             	add    $0x4,%esp
+  800e3f:	5d                   	pop    %ebp
+  800e40:	eb bc                	jmp    800dfe <sys_env_destroy+0x30>
+  800e42:	83 ec 0c             	sub    $0xc,%esp
+  800e45:	50                   	push   %eax
+  800e46:	6a 03                	push   $0x3
+  800e48:	68 24 23 80 00       	push   $0x802324
+  800e4d:	6a 49                	push   $0x49
+  800e4f:	68 41 23 80 00       	push   $0x802341
+  800e54:	e8 57 0e 00 00       	call   801cb0 <_panic>
+
+00800e59 <sys_getenvid>:
+  800e59:	55                   	push   %ebp
+  800e5a:	89 e5                	mov    %esp,%ebp
+  800e5c:	57                   	push   %edi
+  800e5d:	56                   	push   %esi
+  800e5e:	53                   	push   %ebx
+  800e5f:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  800e66:	78 22                	js     800e8a <sys_getenvid+0x31>
+  800e68:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  800e6f:	75 2e                	jne    800e9f <sys_getenvid+0x46>
+  800e71:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e76:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e7b:	89 d1                	mov    %edx,%ecx
+  800e7d:	89 d3                	mov    %edx,%ebx
+  800e7f:	89 d7                	mov    %edx,%edi
+  800e81:	89 d6                	mov    %edx,%esi
+  800e83:	cd 30                	int    $0x30
+  800e85:	5b                   	pop    %ebx
+  800e86:	5e                   	pop    %esi
+  800e87:	5f                   	pop    %edi
+  800e88:	5d                   	pop    %ebp
+  800e89:	c3                   	ret
+  800e8a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e8f:	0f a2                	cpuid
+  800e91:	c1 ea 0b             	shr    $0xb,%edx
+  800e94:	83 e2 01             	and    $0x1,%edx
+  800e97:	89 15 10 30 80 00    	mov    %edx,0x803010
+  800e9d:	eb c9                	jmp    800e68 <sys_getenvid+0xf>
+  800e9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea4:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ea9:	89 d1                	mov    %edx,%ecx
+  800eab:	89 d3                	mov    %edx,%ebx
+  800ead:	89 d7                	mov    %edx,%edi
+  800eaf:	89 d6                	mov    %edx,%esi
+  800eb1:	55                   	push   %ebp
+  800eb2:	68 bb 0e 80 00       	push   $0x800ebb
+  800eb7:	89 e5                	mov    %esp,%ebp
+  800eb9:	0f 34                	sysenter
+  800ebb:	83 c4 04             	add    $0x4,%esp
+  800ebe:	5d                   	pop    %ebp
+  800ebf:	eb c4                	jmp    800e85 <sys_getenvid+0x2c>
+
+00800ec1 <sys_yield>:
+  800ec1:	55                   	push   %ebp
+  800ec2:	89 e5                	mov    %esp,%ebp
+  800ec4:	57                   	push   %edi
+  800ec5:	56                   	push   %esi
+  800ec6:	53                   	push   %ebx
+  800ec7:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  800ece:	78 22                	js     800ef2 <sys_yield+0x31>
+  800ed0:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  800ed7:	75 2e                	jne    800f07 <sys_yield+0x46>
+  800ed9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ede:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ee3:	89 d1                	mov    %edx,%ecx
+  800ee5:	89 d3                	mov    %edx,%ebx
+  800ee7:	89 d7                	mov    %edx,%edi
+  800ee9:	89 d6                	mov    %edx,%esi
+  800eeb:	cd 30                	int    $0x30
+  800eed:	5b                   	pop    %ebx
+  800eee:	5e                   	pop    %esi
+  800eef:	5f                   	pop    %edi
+  800ef0:	5d                   	pop    %ebp
+  800ef1:	c3                   	ret
+  800ef2:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ef7:	0f a2                	cpuid
+  800ef9:	c1 ea 0b             	shr    $0xb,%edx
+  800efc:	83 e2 01             	and    $0x1,%edx
+  800eff:	89 15 10 30 80 00    	mov    %edx,0x803010
+  800f05:	eb c9                	jmp    800ed0 <sys_yield+0xf>
+  800f07:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f0c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f11:	89 d1                	mov    %edx,%ecx
+  800f13:	89 d3                	mov    %edx,%ebx
+  800f15:	89 d7                	mov    %edx,%edi
+  800f17:	89 d6                	mov    %edx,%esi
+  800f19:	55                   	push   %ebp
+  800f1a:	68 23 0f 80 00       	push   $0x800f23
+  800f1f:	89 e5                	mov    %esp,%ebp
+  800f21:	0f 34                	sysenter
+  800f23:	83 c4 04             	add    $0x4,%esp
+  800f26:	5d                   	pop    %ebp
+  800f27:	eb c4                	jmp    800eed <sys_yield+0x2c>
+
+00800f29 <sys_env_set_cow>:
+  800f29:	55                   	push   %ebp
+  800f2a:	89 e5                	mov    %esp,%ebp
+  800f2c:	57                   	push   %edi
+  800f2d:	56                   	push   %esi
+  800f2e:	53                   	push   %ebx
+  800f2f:	83 ec 0c             	sub    $0xc,%esp
+  800f32:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  800f39:	78 2b                	js     800f66 <sys_env_set_cow+0x3d>
+  800f3b:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  800f42:	75 37                	jne    800f7b <sys_env_set_cow+0x52>
+  800f44:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f49:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f54:	89 df                	mov    %ebx,%edi
+  800f56:	89 de                	mov    %ebx,%esi
+  800f58:	cd 30                	int    $0x30
+  800f5a:	85 c0                	test   %eax,%eax
+  800f5c:	7f 41                	jg     800f9f <sys_env_set_cow+0x76>
+  800f5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f61:	5b                   	pop    %ebx
+  800f62:	5e                   	pop    %esi
+  800f63:	5f                   	pop    %edi
+  800f64:	5d                   	pop    %ebp
+  800f65:	c3                   	ret
+  800f66:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f6b:	0f a2                	cpuid
+  800f6d:	c1 ea 0b             	shr    $0xb,%edx
+  800f70:	83 e2 01             	and    $0x1,%edx
+  800f73:	89 15 10 30 80 00    	mov    %edx,0x803010
+  800f79:	eb c0                	jmp    800f3b <sys_env_set_cow+0x12>
+  800f7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f86:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f8b:	89 df                	mov    %ebx,%edi
+  800f8d:	89 de                	mov    %ebx,%esi
+  800f8f:	55                   	push   %ebp
+  800f90:	68 99 0f 80 00       	push   $0x800f99
+  800f95:	89 e5                	mov    %esp,%ebp
+  800f97:	0f 34                	sysenter
+  800f99:	83 c4 04             	add    $0x4,%esp
+  800f9c:	5d                   	pop    %ebp
+  800f9d:	eb bb                	jmp    800f5a <sys_env_set_cow+0x31>
+  800f9f:	83 ec 0c             	sub    $0xc,%esp
+  800fa2:	50                   	push   %eax
+  800fa3:	6a 0d                	push   $0xd
+  800fa5:	68 24 23 80 00       	push   $0x802324
+  800faa:	6a 49                	push   $0x49
+  800fac:	68 41 23 80 00       	push   $0x802341
+  800fb1:	e8 fa 0c 00 00       	call   801cb0 <_panic>
+
+00800fb6 <sys_env_set_quota>:
+  800fb6:	55                   	push   %ebp
+  800fb7:	89 e5                	mov    %esp,%ebp
+  800fb9:	57                   	push   %edi
+  800fba:	56                   	push   %esi
+  800fbb:	53                   	push   %ebx
+  800fbc:	83 ec 0c             	sub    $0xc,%esp
+  800fbf:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  800fc6:	78 2b                	js     800ff3 <sys_env_set_quota+0x3d>
+  800fc8:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  800fcf:	75 37                	jne    801008 <sys_env_set_quota+0x52>
+  800fd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe1:	89 df                	mov    %ebx,%edi
+  800fe3:	89 de                	mov    %ebx,%esi
+  800fe5:	cd 30                	int    $0x30
+  800fe7:	85 c0                	test   %eax,%eax
+  800fe9:	7f 41                	jg     80102c <sys_env_set_quota+0x76>
+  800feb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fee:	5b                   	pop    %ebx
+  800fef:	5e                   	pop    %esi
+  800ff0:	5f                   	pop    %edi
+  800ff1:	5d                   	pop    %ebp
+  800ff2:	c3                   	ret
+  800ff3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ff8:	0f a2                	cpuid
+  800ffa:	c1 ea 0b             	shr    $0xb,%edx
+  800ffd:	83 e2 01             	and    $0x1,%edx
+  801000:	89 15 10 30 80 00    	mov    %edx,0x803010
+  801006:	eb c0                	jmp    800fc8 <sys_env_set_quota+0x12>
+  801008:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801010:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801013:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801018:	89 df                	mov    %ebx,%edi
+  80101a:	89 de                	mov    %ebx,%esi
+  80101c:	55                   	push   %ebp
+  80101d:	68 26 10 80 00       	push   $0x801026
+  801022:	89 e5                	mov    %esp,%ebp
+  801024:	0f 34                	sysenter
+  801026:	83 c4 04             	add    $0x4,%esp
+  801029:	5d                   	pop    %ebp
+  80102a:	eb bb                	jmp    800fe7 <sys_env_set_quota+0x31>
+  80102c:	83 ec 0c             	sub    $0xc,%esp
+  80102f:	50                   	push   %eax
+  801030:	6a 0f                	push   $0xf
+  801032:	68 24 23 80 00       	push   $0x802324
+  801037:	6a 49                	push   $0x49
+  801039:	68 41 23 80 00       	push   $0x802341
+  80103e:	e8 6d 0c 00 00       	call   801cb0 <_panic>
+
+00801043 <sys_page_alloc>:
+  801043:	55                   	push   %ebp
+  801044:	89 e5                	mov    %esp,%ebp
+  801046:	57                   	push   %edi
+  801047:	56                   	push   %esi
+  801048:	53                   	push   %ebx
+  801049:	83 ec 0c             	sub    $0xc,%esp
+  80104c:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  801053:	78 2c                	js     801081 <sys_page_alloc+0x3e>
+  801055:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  80105c:	75 38                	jne    801096 <sys_page_alloc+0x53>
+  80105e:	be 00 00 00 00       	mov    $0x0,%esi
+  801063:	b8 04 00 00 00       	mov    $0x4,%eax
+  801068:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801071:	89 f7                	mov    %esi,%edi
+  801073:	cd 30                	int    $0x30
+  801075:	85 c0                	test   %eax,%eax
+  801077:	7f 42                	jg     8010bb <sys_page_alloc+0x78>
+  801079:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107c:	5b                   	pop    %ebx
+  80107d:	5e                   	pop    %esi
+  80107e:	5f                   	pop    %edi
+  80107f:	5d                   	pop    %ebp
+  801080:	c3                   	ret
+  801081:	b8 01 00 00 00       	mov    $0x1,%eax
+  801086:	0f a2                	cpuid
+  801088:	c1 ea 0b             	shr    $0xb,%edx
+  80108b:	83 e2 01             	and    $0x1,%edx
+  80108e:	89 15 10 30 80 00    	mov    %edx,0x803010
+  801094:	eb bf                	jmp    801055 <sys_page_alloc+0x12>
+  801096:	be 00 00 00 00       	mov    $0x0,%esi
+  80109b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a9:	89 f7                	mov    %esi,%edi
+  8010ab:	55                   	push   %ebp
+  8010ac:	68 b5 10 80 00       	push   $0x8010b5
+  8010b1:	89 e5                	mov    %esp,%ebp
+  8010b3:	0f 34                	sysenter
+  8010b5:	83 c4 04             	add    $0x4,%esp
+  8010b8:	5d                   	pop    %ebp
+  8010b9:	eb ba                	jmp    801075 <sys_page_alloc+0x32>
+  8010bb:	83 ec 0c             	sub    $0xc,%esp
+  8010be:	50                   	push   %eax
+  8010bf:	6a 04                	push   $0x4
+  8010c1:	68 24 23 80 00       	push   $0x802324
+  8010c6:	6a 49                	push   $0x49
+  8010c8:	68 41 23 80 00       	push   $0x802341
+  8010cd:	e8 de 0b 00 00       	call   801cb0 <_panic>
+
+008010d2 <sys_page_map>:
+  8010d2:	55                   	push   %ebp
+  8010d3:	89 e5                	mov    %esp,%ebp
+  8010d5:	57                   	push   %edi
+  8010d6:	56                   	push   %esi
+  8010d7:	53                   	push   %ebx
+  8010d8:	83 ec 0c             	sub    $0xc,%esp
+  8010db:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  8010e2:	78 2b                	js     80110f <sys_page_map+0x3d>
+  8010e4:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  8010eb:	75 37                	jne    801124 <sys_page_map+0x52>
+  8010ed:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010fb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010fe:	8b 75 18             	mov    0x18(%ebp),%esi
+  801101:	cd 30                	int    $0x30
+  801103:	85 c0                	test   %eax,%eax
+  801105:	7f 41                	jg     801148 <sys_page_map+0x76>
+  801107:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110a:	5b                   	pop    %ebx
+  80110b:	5e                   	pop    %esi
+  80110c:	5f                   	pop    %edi
+  80110d:	5d                   	pop    %ebp
+  80110e:	c3                   	ret
+  80110f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801114:	0f a2                	cpuid
+  801116:	c1 ea 0b             	shr    $0xb,%edx
+  801119:	83 e2 01             	and    $0x1,%edx
+  80111c:	89 15 10 30 80 00    	mov    %edx,0x803010
+  801122:	eb c0                	jmp    8010e4 <sys_page_map+0x12>
+  801124:	8b 55 08             	mov    0x8(%ebp),%edx
+  801127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80112f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801132:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801135:	8b 75 18             	mov    0x18(%ebp),%esi
+  801138:	55                   	push   %ebp
+  801139:	68 42 11 80 00       	push   $0x801142
+  80113e:	89 e5                	mov    %esp,%ebp
+  801140:	0f 34                	sysenter
+  801142:	83 c4 04             	add    $0x4,%esp
+  801145:	5d                   	pop    %ebp
+  801146:	eb bb                	jmp    801103 <sys_page_map+0x31>
+  801148:	83 ec 0c             	sub    $0xc,%esp
+  80114b:	50                   	push   %eax
+  80114c:	6a 05                	push   $0x5
+  80114e:	68 24 23 80 00       	push   $0x802324
+  801153:	6a 49                	push   $0x49
+  801155:	68 41 23 80 00       	push   $0x802341
+  80115a:	e8 51 0b 00 00       	call   801cb0 <_panic>
+
+0080115f <sys_page_unmap>:
+  80115f:	55                   	push   %ebp
+  801160:	89 e5                	mov    %esp,%ebp
+  801162:	57                   	push   %edi
+  801163:	56                   	push   %esi
+  801164:	53                   	push   %ebx
+  801165:	83 ec 0c             	sub    $0xc,%esp
+  801168:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  80116f:	78 2b                	js     80119c <sys_page_unmap+0x3d>
+  801171:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  801178:	75 37                	jne    8011b1 <sys_page_unmap+0x52>
+  80117a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801184:	8b 55 08             	mov    0x8(%ebp),%edx
+  801187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118a:	89 df                	mov    %ebx,%edi
+  80118c:	89 de                	mov    %ebx,%esi
+  80118e:	cd 30                	int    $0x30
+  801190:	85 c0                	test   %eax,%eax
+  801192:	7f 41                	jg     8011d5 <sys_page_unmap+0x76>
+  801194:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801197:	5b                   	pop    %ebx
+  801198:	5e                   	pop    %esi
+  801199:	5f                   	pop    %edi
+  80119a:	5d                   	pop    %ebp
+  80119b:	c3                   	ret
+  80119c:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011a1:	0f a2                	cpuid
+  8011a3:	c1 ea 0b             	shr    $0xb,%edx
+  8011a6:	83 e2 01             	and    $0x1,%edx
+  8011a9:	89 15 10 30 80 00    	mov    %edx,0x803010
+  8011af:	eb c0                	jmp    801171 <sys_page_unmap+0x12>
+  8011b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011bc:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011c1:	89 df                	mov    %ebx,%edi
+  8011c3:	89 de                	mov    %ebx,%esi
+  8011c5:	55                   	push   %ebp
+  8011c6:	68 cf 11 80 00       	push   $0x8011cf
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	0f 34                	sysenter
+  8011cf:	83 c4 04             	add    $0x4,%esp
+  8011d2:	5d                   	pop    %ebp
+  8011d3:	eb bb                	jmp    801190 <sys_page_unmap+0x31>
+  8011d5:	83 ec 0c             	sub    $0xc,%esp
+  8011d8:	50                   	push   %eax
+  8011d9:	6a 06                	push   $0x6
+  8011db:	68 24 23 80 00       	push   $0x802324
+  8011e0:	6a 49                	push   $0x49
+  8011e2:	68 41 23 80 00       	push   $0x802341
+  8011e7:	e8 c4 0a 00 00       	call   801cb0 <_panic>
+
+008011ec <sys_page_reuse>:
+  8011ec:	55                   	push   %ebp
+  8011ed:	89 e5                	mov    %esp,%ebp
+  8011ef:	57                   	push   %edi
+  8011f0:	56                   	push   %esi
+  8011f1:	53                   	push   %ebx
+  8011f2:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  8011f9:	78 24                	js     80121f <sys_page_reuse+0x33>
+  8011fb:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  801202:	75 30                	jne    801234 <sys_page_reuse+0x48>
+  801204:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801209:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80120e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801211:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801214:	89 df                	mov    %ebx,%edi
+  801216:	89 de                	mov    %ebx,%esi
+  801218:	cd 30                	int    $0x30
+  80121a:	5b                   	pop    %ebx
+  80121b:	5e                   	pop    %esi
+  80121c:	5f                   	pop    %edi
+  80121d:	5d                   	pop    %ebp
+  80121e:	c3                   	ret
+  80121f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801224:	0f a2                	cpuid
+  801226:	c1 ea 0b             	shr    $0xb,%edx
+  801229:	83 e2 01             	and    $0x1,%edx
+  80122c:	89 15 10 30 80 00    	mov    %edx,0x803010
+  801232:	eb c7                	jmp    8011fb <sys_page_reuse+0xf>
+  801234:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801239:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801244:	89 df                	mov    %ebx,%edi
+  801246:	89 de                	mov    %ebx,%esi
+  801248:	55                   	push   %ebp
+  801249:	68 52 12 80 00       	push   $0x801252
+  80124e:	89 e5                	mov    %esp,%ebp
+  801250:	0f 34                	sysenter
+  801252:	83 c4 04             	add    $0x4,%esp
+  801255:	5d                   	pop    %ebp
+  801256:	eb c2                	jmp    80121a <sys_page_reuse+0x2e>
+
+00801258 <sys_env_set_status>:
+  801258:	55                   	push   %ebp
+  801259:	89 e5                	mov    %esp,%ebp
+  80125b:	57                   	push   %edi
+  80125c:	56                   	push   %esi
+  80125d:	53                   	push   %ebx
+  80125e:	83 ec 0c             	sub    $0xc,%esp
+  801261:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  801268:	78 2b                	js     801295 <sys_env_set_status+0x3d>
+  80126a:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  801271:	75 37                	jne    8012aa <sys_env_set_status+0x52>
+  801273:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801278:	b8 08 00 00 00       	mov    $0x8,%eax
+  80127d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801280:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801283:	89 df                	mov    %ebx,%edi
+  801285:	89 de                	mov    %ebx,%esi
+  801287:	cd 30                	int    $0x30
+  801289:	85 c0                	test   %eax,%eax
+  80128b:	7f 41                	jg     8012ce <sys_env_set_status+0x76>
+  80128d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801290:	5b                   	pop    %ebx
+  801291:	5e                   	pop    %esi
+  801292:	5f                   	pop    %edi
+  801293:	5d                   	pop    %ebp
+  801294:	c3                   	ret
+  801295:	b8 01 00 00 00       	mov    $0x1,%eax
+  80129a:	0f a2                	cpuid
+  80129c:	c1 ea 0b             	shr    $0xb,%edx
+  80129f:	83 e2 01             	and    $0x1,%edx
+  8012a2:	89 15 10 30 80 00    	mov    %edx,0x803010
+  8012a8:	eb c0                	jmp    80126a <sys_env_set_status+0x12>
+  8012aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012ba:	89 df                	mov    %ebx,%edi
+  8012bc:	89 de                	mov    %ebx,%esi
+  8012be:	55                   	push   %ebp
+  8012bf:	68 c8 12 80 00       	push   $0x8012c8
+  8012c4:	89 e5                	mov    %esp,%ebp
+  8012c6:	0f 34                	sysenter
+  8012c8:	83 c4 04             	add    $0x4,%esp
+  8012cb:	5d                   	pop    %ebp
+  8012cc:	eb bb                	jmp    801289 <sys_env_set_status+0x31>
+  8012ce:	83 ec 0c             	sub    $0xc,%esp
+  8012d1:	50                   	push   %eax
+  8012d2:	6a 08                	push   $0x8
+  8012d4:	68 24 23 80 00       	push   $0x802324
+  8012d9:	6a 49                	push   $0x49
+  8012db:	68 41 23 80 00       	push   $0x802341
+  8012e0:	e8 cb 09 00 00       	call   801cb0 <_panic>
+
+008012e5 <sys_env_set_pgfault_upcall>:
+  8012e5:	55                   	push   %ebp
+  8012e6:	89 e5                	mov    %esp,%ebp
+  8012e8:	57                   	push   %edi
+  8012e9:	56                   	push   %esi
+  8012ea:	53                   	push   %ebx
+  8012eb:	83 ec 0c             	sub    $0xc,%esp
+  8012ee:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  8012f5:	78 2b                	js     801322 <sys_env_set_pgfault_upcall+0x3d>
+  8012f7:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  8012fe:	75 37                	jne    801337 <sys_env_set_pgfault_upcall+0x52>
+  801300:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801305:	b8 09 00 00 00       	mov    $0x9,%eax
+  80130a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801310:	89 df                	mov    %ebx,%edi
+  801312:	89 de                	mov    %ebx,%esi
+  801314:	cd 30                	int    $0x30
+  801316:	85 c0                	test   %eax,%eax
+  801318:	7f 41                	jg     80135b <sys_env_set_pgfault_upcall+0x76>
+  80131a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80131d:	5b                   	pop    %ebx
+  80131e:	5e                   	pop    %esi
+  80131f:	5f                   	pop    %edi
+  801320:	5d                   	pop    %ebp
+  801321:	c3                   	ret
+  801322:	b8 01 00 00 00       	mov    $0x1,%eax
+  801327:	0f a2                	cpuid
+  801329:	c1 ea 0b             	shr    $0xb,%edx
+  80132c:	83 e2 01             	and    $0x1,%edx
+  80132f:	89 15 10 30 80 00    	mov    %edx,0x803010
+  801335:	eb c0                	jmp    8012f7 <sys_env_set_pgfault_upcall+0x12>
+  801337:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801342:	b8 09 00 00 00       	mov    $0x9,%eax
+  801347:	89 df                	mov    %ebx,%edi
+  801349:	89 de                	mov    %ebx,%esi
+  80134b:	55                   	push   %ebp
+  80134c:	68 55 13 80 00       	push   $0x801355
+  801351:	89 e5                	mov    %esp,%ebp
+  801353:	0f 34                	sysenter
+  801355:	83 c4 04             	add    $0x4,%esp
+  801358:	5d                   	pop    %ebp
+  801359:	eb bb                	jmp    801316 <sys_env_set_pgfault_upcall+0x31>
+  80135b:	83 ec 0c             	sub    $0xc,%esp
+  80135e:	50                   	push   %eax
+  80135f:	6a 09                	push   $0x9
+  801361:	68 24 23 80 00       	push   $0x802324
+  801366:	6a 49                	push   $0x49
+  801368:	68 41 23 80 00       	push   $0x802341
+  80136d:	e8 3e 09 00 00       	call   801cb0 <_panic>
+
+00801372 <sys_env_set_trace>:
+  801372:	55                   	push   %ebp
+  801373:	89 e5                	mov    %esp,%ebp
+  801375:	57                   	push   %edi
+  801376:	56                   	push   %esi
+  801377:	53                   	push   %ebx
+  801378:	83 ec 0c             	sub    $0xc,%esp
+  80137b:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  801382:	78 2b                	js     8013af <sys_env_set_trace+0x3d>
+  801384:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  80138b:	75 37                	jne    8013c4 <sys_env_set_trace+0x52>
+  80138d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801392:	b8 12 00 00 00       	mov    $0x12,%eax
+  801397:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139d:	89 df                	mov    %ebx,%edi
+  80139f:	89 de                	mov    %ebx,%esi
+  8013a1:	cd 30                	int    $0x30
+  8013a3:	85 c0                	test   %eax,%eax
+  8013a5:	7f 41                	jg     8013e8 <sys_env_set_trace+0x76>
+  8013a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013aa:	5b                   	pop    %ebx
+  8013ab:	5e                   	pop    %esi
+  8013ac:	5f                   	pop    %edi
+  8013ad:	5d                   	pop    %ebp
+  8013ae:	c3                   	ret
+  8013af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013b4:	0f a2                	cpuid
+  8013b6:	c1 ea 0b             	shr    $0xb,%edx
+  8013b9:	83 e2 01             	and    $0x1,%edx
+  8013bc:	89 15 10 30 80 00    	mov    %edx,0x803010
+  8013c2:	eb c0                	jmp    801384 <sys_env_set_trace+0x12>
+  8013c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cf:	b8 12 00 00 00       	mov    $0x12,%eax
+  8013d4:	89 df                	mov    %ebx,%edi
+  8013d6:	89 de                	mov    %ebx,%esi
+  8013d8:	55                   	push   %ebp
+  8013d9:	68 e2 13 80 00       	push   $0x8013e2
+  8013de:	89 e5                	mov    %esp,%ebp
+  8013e0:	0f 34                	sysenter
+  8013e2:	83 c4 04             	add    $0x4,%esp
+  8013e5:	5d                   	pop    %ebp
+  8013e6:	eb bb                	jmp    8013a3 <sys_env_set_trace+0x31>
+  8013e8:	83 ec 0c             	sub    $0xc,%esp
+  8013eb:	50                   	push   %eax
+  8013ec:	6a 12                	push   $0x12
+  8013ee:	68 24 23 80 00       	push   $0x802324
+  8013f3:	6a 49                	push   $0x49
+  8013f5:	68 41 23 80 00       	push   $0x802341
+  8013fa:	e8 b1 08 00 00       	call   801cb0 <_panic>
+
+008013ff <sys_env_set_rdpmc>:
+  8013ff:	55                   	push   %ebp
+  801400:	89 e5                	mov    %esp,%ebp
+  801402:	57                   	push   %edi
+  801403:	56                   	push   %esi
+  801404:	53                   	push   %ebx
+  801405:	83 ec 0c             	sub    $0xc,%esp
+  801408:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  80140f:	78 2b                	js     80143c <sys_env_set_rdpmc+0x3d>
+  801411:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  801418:	75 37                	jne    801451 <sys_env_set_rdpmc+0x52>
+  80141a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801424:	8b 55 08             	mov    0x8(%ebp),%edx
+  801427:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142a:	89 df                	mov    %ebx,%edi
+  80142c:	89 de                	mov    %ebx,%esi
+  80142e:	cd 30                	int    $0x30
+  801430:	85 c0                	test   %eax,%eax
+  801432:	7f 41                	jg     801475 <sys_env_set_rdpmc+0x76>
+  801434:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801437:	5b                   	pop    %ebx
+  801438:	5e                   	pop    %esi
+  801439:	5f                   	pop    %edi
+  80143a:	5d                   	pop    %ebp
+  80143b:	c3                   	ret
+  80143c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801441:	0f a2                	cpuid
+  801443:	c1 ea 0b             	shr    $0xb,%edx
+  801446:	83 e2 01             	and    $0x1,%edx
+  801449:	89 15 10 30 80 00    	mov    %edx,0x803010
+  80144f:	eb c0                	jmp    801411 <sys_env_set_rdpmc+0x12>
+  801451:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801456:	8b 55 08             	mov    0x8(%ebp),%edx
+  801459:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145c:	b8 13 00 00 00       	mov    $0x13,%eax
+  801461:	89 df                	mov    %ebx,%edi
+  801463:	89 de                	mov    %ebx,%esi
+  801465:	55                   	push   %ebp
+  801466:	68 6f 14 80 00       	push   $0x80146f
+  80146b:	89 e5                	mov    %esp,%ebp
+  80146d:	0f 34                	sysenter
+  80146f:	83 c4 04             	add    $0x4,%esp
+  801472:	5d                   	pop    %ebp
+  801473:	eb bb                	jmp    801430 <sys_env_set_rdpmc+0x31>
+  801475:	83 ec 0c             	sub    $0xc,%esp
+  801478:	50                   	push   %eax
+  801479:	6a 13                	push   $0x13
+  80147b:	68 24 23 80 00       	push   $0x802324
+  801480:	6a 49                	push   $0x49
+  801482:	68 41 23 80 00       	push   $0x802341
+  801487:	e8 24 08 00 00       	call   801cb0 <_panic>
+
+0080148c <sys_ring_setup>:
+  80148c:	55                   	push   %ebp
+  80148d:	89 e5                	mov    %esp,%ebp
+  80148f:	57                   	push   %edi
+  801490:	56                   	push   %esi
+  801491:	53                   	push   %ebx
+  801492:	83 ec 0c             	sub    $0xc,%esp
+  801495:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  80149c:	78 29                	js     8014c7 <sys_ring_setup+0x3b>
+  80149e:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  8014a5:	75 35                	jne    8014dc <sys_ring_setup+0x50>
+  8014a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ac:	b8 10 00 00 00       	mov    $0x10,%eax
+  8014b1:	89 d1                	mov    %edx,%ecx
+  8014b3:	89 d3                	mov    %edx,%ebx
+  8014b5:	89 d7                	mov    %edx,%edi
+  8014b7:	89 d6                	mov    %edx,%esi
+  8014b9:	cd 30                	int    $0x30
+  8014bb:	85 c0                	test   %eax,%eax
+  8014bd:	7f 3f                	jg     8014fe <sys_ring_setup+0x72>
+  8014bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c2:	5b                   	pop    %ebx
+  8014c3:	5e                   	pop    %esi
+  8014c4:	5f                   	pop    %edi
+  8014c5:	5d                   	pop    %ebp
+  8014c6:	c3                   	ret
+  8014c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014cc:	0f a2                	cpuid
+  8014ce:	c1 ea 0b             	shr    $0xb,%edx
+  8014d1:	83 e2 01             	and    $0x1,%edx
+  8014d4:	89 15 10 30 80 00    	mov    %edx,0x803010
+  8014da:	eb c2                	jmp    80149e <sys_ring_setup+0x12>
+  8014dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8014e6:	89 d1                	mov    %edx,%ecx
+  8014e8:	89 d3                	mov    %edx,%ebx
+  8014ea:	89 d7                	mov    %edx,%edi
+  8014ec:	89 d6                	mov    %edx,%esi
+  8014ee:	55                   	push   %ebp
+  8014ef:	68 f8 14 80 00       	push   $0x8014f8
+  8014f4:	89 e5                	mov    %esp,%ebp
+  8014f6:	0f 34                	sysenter
+  8014f8:	83 c4 04             	add    $0x4,%esp
+  8014fb:	5d                   	pop    %ebp
+  8014fc:	eb bd                	jmp    8014bb <sys_ring_setup+0x2f>
+  8014fe:	83 ec 0c             	sub    $0xc,%esp
+  801501:	50                   	push   %eax
+  801502:	6a 10                	push   $0x10
+  801504:	68 24 23 80 00       	push   $0x802324
+  801509:	6a 49                	push   $0x49
+  80150b:	68 41 23 80 00       	push   $0x802341
+  801510:	e8 9b 07 00 00       	call   801cb0 <_panic>
+
+00801515 <sys_ring_enter>:
+  801515:	55                   	push   %ebp
+  801516:	89 e5                	mov    %esp,%ebp
+  801518:	57                   	push   %edi
+  801519:	56                   	push   %esi
+  80151a:	53                   	push   %ebx
+  80151b:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  801522:	78 22                	js     801546 <sys_ring_enter+0x31>
+  801524:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  80152b:	75 2e                	jne    80155b <sys_ring_enter+0x46>
+  80152d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801532:	b8 11 00 00 00       	mov    $0x11,%eax
+  801537:	89 d1                	mov    %edx,%ecx
+  801539:	89 d3                	mov    %edx,%ebx
+  80153b:	89 d7                	mov    %edx,%edi
+  80153d:	89 d6                	mov    %edx,%esi
+  80153f:	cd 30                	int    $0x30
+  801541:	5b                   	pop    %ebx
+  801542:	5e                   	pop    %esi
+  801543:	5f                   	pop    %edi
+  801544:	5d                   	pop    %ebp
+  801545:	c3                   	ret
+  801546:	b8 01 00 00 00       	mov    $0x1,%eax
+  80154b:	0f a2                	cpuid
+  80154d:	c1 ea 0b             	shr    $0xb,%edx
+  801550:	83 e2 01             	and    $0x1,%edx
+  801553:	89 15 10 30 80 00    	mov    %edx,0x803010
+  801559:	eb c9                	jmp    801524 <sys_ring_enter+0xf>
+  80155b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801560:	b8 11 00 00 00       	mov    $0x11,%eax
+  801565:	89 d1                	mov    %edx,%ecx
+  801567:	89 d3                	mov    %edx,%ebx
+  801569:	89 d7                	mov    %edx,%edi
+  80156b:	89 d6                	mov    %edx,%esi
+  80156d:	55                   	push   %ebp
+  80156e:	68 77 15 80 00       	push   $0x801577
+  801573:	89 e5                	mov    %esp,%ebp
+  801575:	0f 34                	sysenter
+  801577:	83 c4 04             	add    $0x4,%esp
+  80157a:	5d                   	pop    %ebp
+  80157b:	eb c4                	jmp    801541 <sys_ring_enter+0x2c>
+
+0080157d <sys_ipc_try_send>:
+  80157d:	55                   	push   %ebp
+  80157e:	89 e5                	mov    %esp,%ebp
+  801580:	57                   	push   %edi
+  801581:	56                   	push   %esi
+  801582:	53                   	push   %ebx
+  801583:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  80158a:	78 26                	js     8015b2 <sys_ipc_try_send+0x35>
+  80158c:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  801593:	75 32                	jne    8015c7 <sys_ipc_try_send+0x4a>
+  801595:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80159a:	be 00 00 00 00       	mov    $0x0,%esi
+  80159f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015ab:	cd 30                	int    $0x30
+  8015ad:	5b                   	pop    %ebx
+  8015ae:	5e                   	pop    %esi
+  8015af:	5f                   	pop    %edi
+  8015b0:	5d                   	pop    %ebp
+  8015b1:	c3                   	ret
+  8015b2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015b7:	0f a2                	cpuid
+  8015b9:	c1 ea 0b             	shr    $0xb,%edx
+  8015bc:	83 e2 01             	and    $0x1,%edx
+  8015bf:	89 15 10 30 80 00    	mov    %edx,0x803010
+  8015c5:	eb c5                	jmp    80158c <sys_ipc_try_send+0xf>
+  8015c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015cd:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015da:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015dd:	55                   	push   %ebp
+  8015de:	68 e7 15 80 00       	push   $0x8015e7
+  8015e3:	89 e5                	mov    %esp,%ebp
+  8015e5:	0f 34                	sysenter
+  8015e7:	83 c4 04             	add    $0x4,%esp
+  8015ea:	5d                   	pop    %ebp
+  8015eb:	eb c0                	jmp    8015ad <sys_ipc_try_send+0x30>
+
+008015ed <sys_ipc_recv>:
+  8015ed:	55                   	push   %ebp
+  8015ee:	89 e5                	mov    %esp,%ebp
+  8015f0:	57                   	push   %edi
+  8015f1:	56                   	push   %esi
+  8015f2:	53                   	push   %ebx
+  8015f3:	83 ec 0c             	sub    $0xc,%esp
+  8015f6:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  8015fd:	78 2a                	js     801629 <sys_ipc_recv+0x3c>
+  8015ff:	83 3d 10 30 80 00 00 	cmpl   $0x0,0x803010
+  801606:	75 36                	jne    80163e <sys_ipc_recv+0x51>
+  801608:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80160d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801612:	8b 55 08             	mov    0x8(%ebp),%edx
+  801615:	89 cb                	mov    %ecx,%ebx
+  801617:	89 cf                	mov    %ecx,%edi
+  801619:	89 ce                	mov    %ecx,%esi
+  80161b:	cd 30                	int    $0x30
+  80161d:	85 c0                	test   %eax,%eax
+  80161f:	7f 40                	jg     801661 <sys_ipc_recv+0x74>
+  801621:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801624:	5b                   	pop    %ebx
+  801625:	5e                   	pop    %esi
+  801626:	5f                   	pop    %edi
+  801627:	5d                   	pop    %ebp
+  801628:	c3                   	ret
+  801629:	b8 01 00 00 00       	mov    $0x1,%eax
+  80162e:	0f a2                	cpuid
+  801630:	c1 ea 0b             	shr    $0xb,%edx
+  801633:	83 e2 01             	and    $0x1,%edx
+  801636:	89 15 10 30 80 00    	mov    %edx,0x803010
+  80163c:	eb c1                	jmp    8015ff <sys_ipc_recv+0x12>
+  80163e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801641:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801646:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80164b:	89 cb                	mov    %ecx,%ebx
+  80164d:	89 cf                	mov    %ecx,%edi
+  80164f:	89 ce                	mov    %ecx,%esi
+  801651:	55                   	push   %ebp
+  801652:	68 5b 16 80 00       	push   $0x80165b
+  801657:	89 e5                	mov    %esp,%ebp
+  801659:	0f 34                	sysenter
+  80165b:	83 c4 04             	add    $0x4,%esp
+  80165e:	5d                   	pop    %ebp
+  80165f:	eb bc                	jmp    80161d <sys_ipc_recv+0x30>
+  801661:	83 ec 0c             	sub    $0xc,%esp
+  801664:	50                   	push   %eax
+  801665:	6a 0c                	push   $0xc
+  801667:	68 24 23 80 00       	push   $0x802324
+  80166c:	6a 49                	push   $0x49
+  80166e:	68 41 23 80 00       	push   $0x802341
+  801673:	e8 38 06 00 00       	call   801cb0 <_panic>
+
+00801678 <duppage>:
+  801678:	55                   	push   %ebp
+  801679:	89 e5                	mov    %esp,%ebp
+  80167b:	53                   	push   %ebx
+  80167c:	83 ec 04             	sub    $0x4,%esp
+  80167f:	89 d3                	mov    %edx,%ebx
+  801681:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801688:	f6 c2 02             	test   $0x2,%dl
+  80168b:	75 0c                	jne    801699 <duppage+0x21>
+  80168d:	8b 14 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edx
+  801694:	f6 c6 08             	test   $0x8,%dh
+  801697:	74 64                	je     8016fd <duppage+0x85>
+  801699:	c1 e3 0c             	shl    $0xc,%ebx
+  80169c:	83 ec 0c             	sub    $0xc,%esp
+  80169f:	68 05 08 00 00       	push   $0x805
+  8016a4:	53                   	push   %ebx
+  8016a5:	50                   	push   %eax
+  8016a6:	53                   	push   %ebx
+  8016a7:	6a 00                	push   $0x0
+  8016a9:	e8 24 fa ff ff       	call   8010d2 <sys_page_map>
+  8016ae:	83 c4 20             	add    $0x20,%esp
+  8016b1:	85 c0                	test   %eax,%eax
+  8016b3:	78 24                	js     8016d9 <duppage+0x61>
+  8016b5:	83 ec 0c             	sub    $0xc,%esp
+  8016b8:	68 05 08 00 00       	push   $0x805
+  8016bd:	53                   	push   %ebx
+  8016be:	6a 00                	push   $0x0
+  8016c0:	53                   	push   %ebx
+  8016c1:	6a 00                	push   $0x0
+  8016c3:	e8 0a fa ff ff       	call   8010d2 <sys_page_map>
+  8016c8:	83 c4 20             	add    $0x20,%esp
+  8016cb:	85 c0                	test   %eax,%eax
+  8016cd:	78 1c                	js     8016eb <duppage+0x73>
+  8016cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016d7:	c9                   	leave
+  8016d8:	c3                   	ret
+  8016d9:	50                   	push   %eax
+  8016da:	68 4f 23 80 00       	push   $0x80234f
+  8016df:	6a 52                	push   $0x52
+  8016e1:	68 60 23 80 00       	push   $0x802360
+  8016e6:	e8 c5 05 00 00       	call   801cb0 <_panic>
+  8016eb:	50                   	push   %eax
+  8016ec:	68 4f 23 80 00       	push   $0x80234f
+  8016f1:	6a 55                	push   $0x55
+  8016f3:	68 60 23 80 00       	push   $0x802360
+  8016f8:	e8 b3 05 00 00       	call   801cb0 <_panic>
+  8016fd:	c1 e3 0c             	shl    $0xc,%ebx
+  801700:	83 ec 0c             	sub    $0xc,%esp
+  801703:	6a 05                	push   $0x5
+  801705:	53                   	push   %ebx
+  801706:	50                   	push   %eax
+  801707:	53                   	push   %ebx
+  801708:	6a 00                	push   $0x0
+  80170a:	e8 c3 f9 ff ff       	call   8010d2 <sys_page_map>
+  80170f:	83 c4 20             	add    $0x20,%esp
+  801712:	85 c0                	test   %eax,%eax
+  801714:	79 b9                	jns    8016cf <duppage+0x57>
+  801716:	50                   	push   %eax
+  801717:	68 4f 23 80 00       	push   $0x80234f
+  80171c:	6a 59                	push   $0x59
+  80171e:	68 60 23 80 00       	push   $0x802360
+  801723:	e8 88 05 00 00       	call   801cb0 <_panic>
+
+00801728 <pgfault>:
+  801728:	55                   	push   %ebp
+  801729:	89 e5                	mov    %esp,%ebp
+  80172b:	53                   	push   %ebx
+  80172c:	83 ec 04             	sub    $0x4,%esp
+  80172f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801732:	8b 18                	mov    (%eax),%ebx
+  801734:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801738:	0f 84 90 00 00 00    	je     8017ce <pgfault+0xa6>
+  80173e:	89 d8                	mov    %ebx,%eax
+  801740:	c1 e8 0c             	shr    $0xc,%eax
+  801743:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80174a:	f7 c2 01 08 00 00    	test   $0x801,%edx
+  801750:	74 7c                	je     8017ce <pgfault+0xa6>
+  801752:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801759:	c1 e8 0c             	shr    $0xc,%eax
+  80175c:	0f b7 04 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%eax
+  801763:	ef 
+  801764:	66 83 f8 01          	cmp    $0x1,%ax
+  801768:	74 78                	je     8017e2 <pgfault+0xba>
+  80176a:	83 ec 04             	sub    $0x4,%esp
+  80176d:	6a 07                	push   $0x7
+  80176f:	68 00 f0 7f 00       	push   $0x7ff000
+  801774:	6a 00                	push   $0x0
+  801776:	e8 c8 f8 ff ff       	call   801043 <sys_page_alloc>
+  80177b:	83 c4 10             	add    $0x10,%esp
+  80177e:	85 c0                	test   %eax,%eax
+  801780:	78 7f                	js     801801 <pgfault+0xd9>
+  801782:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  801788:	83 ec 08             	sub    $0x8,%esp
+  80178b:	53                   	push   %ebx
+  80178c:	68 00 f0 7f 00       	push   $0x7ff000
+  801791:	e8 86 f3 ff ff       	call   800b1c <page_copy>
+  801796:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80179d:	53                   	push   %ebx
+  80179e:	6a 00                	push   $0x0
+  8017a0:	68 00 f0 7f 00       	push   $0x7ff000
+  8017a5:	6a 00                	push   $0x0
+  8017a7:	e8 26 f9 ff ff       	call   8010d2 <sys_page_map>
+  8017ac:	83 c4 20             	add    $0x20,%esp
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	78 60                	js     801813 <pgfault+0xeb>
+  8017b3:	83 ec 08             	sub    $0x8,%esp
+  8017b6:	68 00 f0 7f 00       	push   $0x7ff000
+  8017bb:	6a 00                	push   $0x0
+  8017bd:	e8 9d f9 ff ff       	call   80115f <sys_page_unmap>
+  8017c2:	83 c4 10             	add    $0x10,%esp
+  8017c5:	85 c0                	test   %eax,%eax
+  8017c7:	78 5c                	js     801825 <pgfault+0xfd>
+  8017c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017cc:	c9                   	leave
+  8017cd:	c3                   	ret
+  8017ce:	83 ec 04             	sub    $0x4,%esp
+  8017d1:	68 6b 23 80 00       	push   $0x80236b
+  8017d6:	6a 1c                	push   $0x1c
+  8017d8:	68 60 23 80 00       	push   $0x802360
+  8017dd:	e8 ce 04 00 00       	call   801cb0 <_panic>
+  8017e2:	83 ec 08             	sub    $0x8,%esp
+  8017e5:	89 d8                	mov    %ebx,%eax
+  8017e7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017ec:	50                   	push   %eax
+  8017ed:	6a 00                	push   $0x0
+  8017ef:	e8 f8 f9 ff ff       	call   8011ec <sys_page_reuse>
+  8017f4:	83 c4 10             	add    $0x10,%esp
+  8017f7:	85 c0                	test   %eax,%eax
+  8017f9:	0f 85 6b ff ff ff    	jne    80176a <pgfault+0x42>
+  8017ff:	eb c8                	jmp    8017c9 <pgfault+0xa1>
+  801801:	50                   	push   %eax
+  801802:	68 88 23 80 00       	push   $0x802388
+  801807:	6a 31                	push   $0x31
+  801809:	68 60 23 80 00       	push   $0x802360
+  80180e:	e8 9d 04 00 00       	call   801cb0 <_panic>
+  801813:	50                   	push   %eax
+  801814:	68 4f 23 80 00       	push   $0x80234f
+  801819:	6a 36                	push   $0x36
+  80181b:	68 60 23 80 00       	push   $0x802360
+  801820:	e8 8b 04 00 00       	call   801cb0 <_panic>
+  801825:	50                   	push   %eax
+  801826:	68 9b 23 80 00       	push   $0x80239b
+  80182b:	6a 38                	push   $0x38
+  80182d:	68 60 23 80 00       	push   $0x802360
+  801832:	e8 79 04 00 00       	call   801cb0 <_panic>
+
+00801837 <fork>:
+  801837:	55                   	push   %ebp
+  801838:	89 e5                	mov    %esp,%ebp
+  80183a:	53                   	push   %ebx
+  80183b:	83 ec 20             	sub    $0x20,%esp
+  80183e:	68 28 17 80 00       	push   $0x801728
+  801843:	e8 b3 04 00 00       	call   801cfb <set_pgfault_handler>
+  801848:	83 c4 08             	add    $0x8,%esp
+  80184b:	6a 01                	push   $0x1
+  80184d:	6a 00                	push   $0x0
+  80184f:	e8 d5 f6 ff ff       	call   800f29 <sys_env_set_cow>
+  801854:	83 c4 10             	add    $0x10,%esp
+  801857:	85 c0                	test   %eax,%eax
+  801859:	78 38                	js     801893 <fork+0x5c>
+  80185b:	e8 59 03 00 00       	call   801bb9 <bflush>
+  801860:	b8 07 00 00 00       	mov    $0x7,%eax
+  801865:	cd 30                	int    $0x30
+  801867:	89 c3                	mov    %eax,%ebx
+  801869:	85 c0                	test   %eax,%eax
+  80186b:	78 38                	js     8018a5 <fork+0x6e>
+  80186d:	ba 00 00 80 00       	mov    $0x800000,%edx
+  801872:	75 4f                	jne    8018c3 <fork+0x8c>
+  801874:	e8 a7 02 00 00       	call   801b20 <uinfo_envid>
+  801879:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80187e:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  801884:	05 00 00 00 ed       	add    $0xed000000,%eax
+  801889:	a3 20 30 80 00       	mov    %eax,0x803020
+  80188e:	e9 c9 00 00 00       	jmp    80195c <fork+0x125>
+  801893:	50                   	push   %eax
+  801894:	68 ae 23 80 00       	push   $0x8023ae
+  801899:	6a 7c                	push   $0x7c
+  80189b:	68 60 23 80 00       	push   $0x802360
+  8018a0:	e8 0b 04 00 00       	call   801cb0 <_panic>
+  8018a5:	50                   	push   %eax
+  8018a6:	68 c2 23 80 00       	push   $0x8023c2
+  8018ab:	68 88 00 00 00       	push   $0x88
+  8018b0:	68 60 23 80 00       	push   $0x802360
+  8018b5:	e8 f6 03 00 00       	call   801cb0 <_panic>
+  8018ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018bd:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8018c3:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  8018c6:	81 fa ff ff ff ea    	cmp    $0xeaffffff,%edx
+  8018cc:	77 34                	ja     801902 <fork+0xcb>
+  8018ce:	81 fa 00 f0 ff ea    	cmp    $0xeafff000,%edx
+  8018d4:	74 e4                	je     8018ba <fork+0x83>
+  8018d6:	89 d0                	mov    %edx,%eax
+  8018d8:	c1 e8 16             	shr    $0x16,%eax
+  8018db:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8018e2:	a8 01                	test   $0x1,%al
+  8018e4:	74 d4                	je     8018ba <fork+0x83>
+  8018e6:	89 d0                	mov    %edx,%eax
+  8018e8:	c1 e8 0c             	shr    $0xc,%eax
+  8018eb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018f2:	a8 01                	test   $0x1,%al
+  8018f4:	74 c4                	je     8018ba <fork+0x83>
+  8018f6:	c1 ea 0c             	shr    $0xc,%edx
+  8018f9:	89 d8                	mov    %ebx,%eax
+  8018fb:	e8 78 fd ff ff       	call   801678 <duppage>
+  801900:	eb b8                	jmp    8018ba <fork+0x83>
+  801902:	83 ec 04             	sub    $0x4,%esp
+  801905:	6a 07                	push   $0x7
+  801907:	68 00 f0 ff ea       	push   $0xeafff000
+  80190c:	53                   	push   %ebx
+  80190d:	e8 31 f7 ff ff       	call   801043 <sys_page_alloc>
+  801912:	83 c4 10             	add    $0x10,%esp
+  801915:	85 c0                	test   %eax,%eax
+  801917:	78 4a                	js     801963 <fork+0x12c>
+  801919:	a1 20 30 80 00       	mov    0x803020,%eax
+  80191e:	8b 40 58             	mov    0x58(%eax),%eax
+  801921:	83 ec 08             	sub    $0x8,%esp
+  801924:	50                   	push   %eax
+  801925:	53                   	push   %ebx
+  801926:	e8 ba f9 ff ff       	call   8012e5 <sys_env_set_pgfault_upcall>
+  80192b:	83 c4 08             	add    $0x8,%esp
+  80192e:	6a 01                	push   $0x1
+  801930:	53                   	push   %ebx
+  801931:	e8 f3 f5 ff ff       	call   800f29 <sys_env_set_cow>
+  801936:	83 c4 10             	add    $0x10,%esp
+  801939:	85 c0                	test   %eax,%eax
+  80193b:	78 3b                	js     801978 <fork+0x141>
+  80193d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801940:	c1 ea 0c             	shr    $0xc,%edx
+  801943:	89 d8                	mov    %ebx,%eax
+  801945:	e8 2e fd ff ff       	call   801678 <duppage>
+  80194a:	83 ec 08             	sub    $0x8,%esp
+  80194d:	6a 02                	push   $0x2
+  80194f:	53                   	push   %ebx
+  801950:	e8 03 f9 ff ff       	call   801258 <sys_env_set_status>
+  801955:	83 c4 10             	add    $0x10,%esp
+  801958:	85 c0                	test   %eax,%eax
+  80195a:	78 31                	js     80198d <fork+0x156>
+  80195c:	89 d8                	mov    %ebx,%eax
+  80195e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801961:	c9                   	leave
+  801962:	c3                   	ret
+  801963:	50                   	push   %eax
+  801964:	68 88 23 80 00       	push   $0x802388
+  801969:	68 a1 00 00 00       	push   $0xa1
+  80196e:	68 60 23 80 00       	push   $0x802360
+  801973:	e8 38 03 00 00       	call   801cb0 <_panic>
+  801978:	50                   	push   %eax
+  801979:	68 ae 23 80 00       	push   $0x8023ae
+  80197e:	68 a6 00 00 00       	push   $0xa6
+  801983:	68 60 23 80 00       	push   $0x802360
+  801988:	e8 23 03 00 00       	call   801cb0 <_panic>
+  80198d:	50                   	push   %eax
+  80198e:	68 d2 23 80 00       	push   $0x8023d2
+  801993:	68 ad 00 00 00       	push   $0xad
+  801998:	68 60 23 80 00       	push   $0x802360
+  80199d:	e8 0e 03 00 00       	call   801cb0 <_panic>
+
+008019a2 <sfork>:
+  8019a2:	55                   	push   %ebp
+  8019a3:	89 e5                	mov    %esp,%ebp
+  8019a5:	83 ec 0c             	sub    $0xc,%esp
+  8019a8:	68 e9 23 80 00       	push   $0x8023e9
+  8019ad:	68 b6 00 00 00       	push   $0xb6
+  8019b2:	68 60 23 80 00       	push   $0x802360
+  8019b7:	e8 f4 02 00 00       	call   801cb0 <_panic>
+
+008019bc <ipc_recv>:
+  8019bc:	55                   	push   %ebp
+  8019bd:	89 e5                	mov    %esp,%ebp
+  8019bf:	56                   	push   %esi
+  8019c0:	53                   	push   %ebx
+  8019c1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019ca:	85 c0                	test   %eax,%eax
+  8019cc:	74 41                	je     801a0f <ipc_recv+0x53>
+  8019ce:	83 ec 0c             	sub    $0xc,%esp
+  8019d1:	50                   	push   %eax
+  8019d2:	e8 16 fc ff ff       	call   8015ed <sys_ipc_recv>
+  8019d7:	83 c4 10             	add    $0x10,%esp
+  8019da:	85 f6                	test   %esi,%esi
+  8019dc:	74 17                	je     8019f5 <ipc_recv+0x39>
+  8019de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e3:	85 c0                	test   %eax,%eax
+  8019e5:	75 0c                	jne    8019f3 <ipc_recv+0x37>
+  8019e7:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8019ed:	8b 92 0c 01 00 00    	mov    0x10c(%edx),%edx
+  8019f3:	89 16                	mov    %edx,(%esi)
+  8019f5:	85 db                	test   %ebx,%ebx
+  8019f7:	74 42                	je     801a3b <ipc_recv+0x7f>
+  8019f9:	85 c0                	test   %eax,%eax
+  8019fb:	74 24                	je     801a21 <ipc_recv+0x65>
+  8019fd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801a03:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a0b:	5b                   	pop    %ebx
+  801a0c:	5e                   	pop    %esi
+  801a0d:	5d                   	pop    %ebp
+  801a0e:	c3                   	ret
+  801a0f:	83 ec 0c             	sub    $0xc,%esp
+  801a12:	68 01 00 00 eb       	push   $0xeb000001
+  801a17:	e8 d1 fb ff ff       	call   8015ed <sys_ipc_recv>
+  801a1c:	83 c4 10             	add    $0x10,%esp
+  801a1f:	eb b9                	jmp    8019da <ipc_recv+0x1e>
+  801a21:	a1 20 30 80 00       	mov    0x803020,%eax
+  801a26:	8b 80 10 01 00 00    	mov    0x110(%eax),%eax
+  801a2c:	89 03                	mov    %eax,(%ebx)
+  801a2e:	a1 20 30 80 00       	mov    0x803020,%eax
+  801a33:	8b 80 08 01 00 00    	mov    0x108(%eax),%eax
+  801a39:	eb cd                	jmp    801a08 <ipc_recv+0x4c>
+  801a3b:	85 c0                	test   %eax,%eax
+  801a3d:	74 ef                	je     801a2e <ipc_recv+0x72>
+  801a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a44:	eb c2                	jmp    801a08 <ipc_recv+0x4c>
+
+00801a46 <ipc_send>:
+  801a46:	55                   	push   %ebp
+  801a47:	89 e5                	mov    %esp,%ebp
+  801a49:	57                   	push   %edi
+  801a4a:	56                   	push   %esi
+  801a4b:	53                   	push   %ebx
+  801a4c:	83 ec 0c             	sub    $0xc,%esp
+  801a4f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801a52:	8b 75 10             	mov    0x10(%ebp),%esi
+  801a55:	eb 21                	jmp    801a78 <ipc_send+0x32>
+  801a57:	ff 75 14             	push   0x14(%ebp)
+  801a5a:	68 01 00 00 eb       	push   $0xeb000001
+  801a5f:	ff 75 0c             	push   0xc(%ebp)
+  801a62:	57                   	push   %edi
+  801a63:	e8 15 fb ff ff       	call   80157d <sys_ipc_try_send>
+  801a68:	89 c3                	mov    %eax,%ebx
+  801a6a:	83 c4 10             	add    $0x10,%esp
+  801a6d:	eb 1f                	jmp    801a8e <ipc_send+0x48>
+  801a6f:	83 fb f9             	cmp    $0xfffffff9,%ebx
+  801a72:	74 37                	je     801aab <ipc_send+0x65>
+  801a74:	85 db                	test   %ebx,%ebx
+  801a76:	74 3a                	je     801ab2 <ipc_send+0x6c>
+  801a78:	85 f6                	test   %esi,%esi
+  801a7a:	74 db                	je     801a57 <ipc_send+0x11>
+  801a7c:	ff 75 14             	push   0x14(%ebp)
+  801a7f:	56                   	push   %esi
+  801a80:	ff 75 0c             	push   0xc(%ebp)
+  801a83:	57                   	push   %edi
+  801a84:	e8 f4 fa ff ff       	call   80157d <sys_ipc_try_send>
+  801a89:	89 c3                	mov    %eax,%ebx
+  801a8b:	83 c4 10             	add    $0x10,%esp
+  801a8e:	85 db                	test   %ebx,%ebx
+  801a90:	74 dd                	je     801a6f <ipc_send+0x29>
+  801a92:	83 fb f9             	cmp    $0xfffffff9,%ebx
+  801a95:	74 d8                	je     801a6f <ipc_send+0x29>
+  801a97:	83 ec 04             	sub    $0x4,%esp
+  801a9a:	68 ff 23 80 00       	push   $0x8023ff
+  801a9f:	6a 40                	push   $0x40
+  801aa1:	68 12 24 80 00       	push   $0x802412
+  801aa6:	e8 05 02 00 00       	call   801cb0 <_panic>
+  801aab:	e8 11 f4 ff ff       	call   800ec1 <sys_yield>
+  801ab0:	eb c2                	jmp    801a74 <ipc_send+0x2e>
+  801ab2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ab5:	5b                   	pop    %ebx
+  801ab6:	5e                   	pop    %esi
+  801ab7:	5f                   	pop    %edi
+  801ab8:	5d                   	pop    %ebp
+  801ab9:	c3                   	ret
+
+00801aba <ipc_find_env>:
+  801aba:	55                   	push   %ebp
+  801abb:	89 e5                	mov    %esp,%ebp
+  801abd:	56                   	push   %esi
+  801abe:	53                   	push   %ebx
+  801abf:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ac2:	b9 7f 03 00 ed       	mov    $0xed00037f,%ecx
+  801ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acc:	89 c3                	mov    %eax,%ebx
+  801ace:	83 c0 01             	add    $0x1,%eax
+  801ad1:	89 ca                	mov    %ecx,%edx
+  801ad3:	c1 ea 0c             	shr    $0xc,%edx
+  801ad6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801add:	f6 c2 01             	test   $0x1,%dl
+  801ae0:	74 35                	je     801b17 <ipc_find_env+0x5d>
+  801ae2:	69 d3 80 03 00 00    	imul   $0x380,%ebx,%edx
+  801ae8:	81 c2 00 00 00 ed    	add    $0xed000000,%edx
+  801aee:	8b 52 48             	mov    0x48(%edx),%edx
+  801af1:	81 c1 80 03 00 00    	add    $0x380,%ecx
+  801af7:	39 f2                	cmp    %esi,%edx
+  801af9:	74 0e                	je     801b09 <ipc_find_env+0x4f>
+  801afb:	3d 00 80 00 00       	cmp    $0x8000,%eax
+  801b00:	75 ca                	jne    801acc <ipc_find_env+0x12>
+  801b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b07:	eb 13                	jmp    801b1c <ipc_find_env+0x62>
+  801b09:	69 db 80 03 00 00    	imul   $0x380,%ebx,%ebx
+  801b0f:	8b 83 40 00 00 ed    	mov    -0x12ffffc0(%ebx),%eax
+  801b15:	eb 05                	jmp    801b1c <ipc_find_env+0x62>
+  801b17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1c:	5b                   	pop    %ebx
+  801b1d:	5e                   	pop    %esi
+  801b1e:	5d                   	pop    %ebp
+  801b1f:	c3                   	ret
+
+00801b20 <uinfo_envid>:
+  801b20:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  801b25:	c3                   	ret
+
+00801b26 <uinfo_cpunum>:
+  801b26:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  801b2b:	c3                   	ret
+
+00801b2c <uinfo_ticks>:
+  801b2c:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  801b31:	c3                   	ret
+
+00801b32 <uinfo_nsec>:
+  801b32:	55                   	push   %ebp
+  801b33:	89 e5                	mov    %esp,%ebp
+  801b35:	57                   	push   %edi
+  801b36:	56                   	push   %esi
+  801b37:	53                   	push   %ebx
+  801b38:	83 ec 1c             	sub    $0x1c,%esp
+  801b3b:	0f 31                	rdtsc
+  801b3d:	89 c6                	mov    %eax,%esi
+  801b3f:	89 d7                	mov    %edx,%edi
+  801b41:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801b47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b51:	85 c9                	test   %ecx,%ecx
+  801b53:	74 5c                	je     801bb1 <uinfo_nsec+0x7f>
+  801b55:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801b5d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b60:	52                   	push   %edx
+  801b61:	51                   	push   %ecx
+  801b62:	57                   	push   %edi
+  801b63:	56                   	push   %esi
+  801b64:	e8 ff 02 00 00       	call   801e68 <__umoddi3>
+  801b69:	83 c4 10             	add    $0x10,%esp
+  801b6c:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801b72:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801b77:	f7 e3                	mul    %ebx
+  801b79:	01 ca                	add    %ecx,%edx
+  801b7b:	ff 75 e4             	push   -0x1c(%ebp)
+  801b7e:	ff 75 e0             	push   -0x20(%ebp)
+  801b81:	52                   	push   %edx
+  801b82:	50                   	push   %eax
+  801b83:	e8 08 02 00 00       	call   801d90 <__udivdi3>
+  801b88:	83 c4 10             	add    $0x10,%esp
+  801b8b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b8e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b91:	ff 75 e4             	push   -0x1c(%ebp)
+  801b94:	ff 75 e0             	push   -0x20(%ebp)
+  801b97:	57                   	push   %edi
+  801b98:	56                   	push   %esi
+  801b99:	e8 f2 01 00 00       	call   801d90 <__udivdi3>
+  801b9e:	83 c4 10             	add    $0x10,%esp
+  801ba1:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801ba7:	f7 e3                	mul    %ebx
+  801ba9:	01 ca                	add    %ecx,%edx
+  801bab:	03 45 d8             	add    -0x28(%ebp),%eax
+  801bae:	13 55 dc             	adc    -0x24(%ebp),%edx
+  801bb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bb4:	5b                   	pop    %ebx
+  801bb5:	5e                   	pop    %esi
+  801bb6:	5f                   	pop    %edi
+  801bb7:	5d                   	pop    %ebp
+  801bb8:	c3                   	ret
+
+00801bb9 <bflush>:
+  801bb9:	a1 40 30 80 00       	mov    0x803040,%eax
+  801bbe:	85 c0                	test   %eax,%eax
+  801bc0:	75 01                	jne    801bc3 <bflush+0xa>
+  801bc2:	c3                   	ret
+  801bc3:	55                   	push   %ebp
+  801bc4:	89 e5                	mov    %esp,%ebp
+  801bc6:	83 ec 10             	sub    $0x10,%esp
+  801bc9:	50                   	push   %eax
+  801bca:	68 44 30 80 00       	push   $0x803044
+  801bcf:	e8 2c f1 ff ff       	call   800d00 <sys_cputs>
+  801bd4:	c7 05 40 30 80 00 00 	movl   $0x0,0x803040
+  801bdb:	00 00 00 
+  801bde:	83 c4 10             	add    $0x10,%esp
+  801be1:	c9                   	leave
+  801be2:	c3                   	ret
+
+00801be3 <bputch>:
+  801be3:	55                   	push   %ebp
+  801be4:	89 e5                	mov    %esp,%ebp
+  801be6:	53                   	push   %ebx
+  801be7:	83 ec 04             	sub    $0x4,%esp
+  801bea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801bed:	8b 15 40 30 80 00    	mov    0x803040,%edx
+  801bf3:	8d 42 01             	lea    0x1(%edx),%eax
+  801bf6:	a3 40 30 80 00       	mov    %eax,0x803040
+  801bfb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bfe:	88 8a 44 30 80 00    	mov    %cl,0x803044(%edx)
+  801c04:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c09:	77 08                	ja     801c13 <bputch+0x30>
+  801c0b:	83 03 01             	addl   $0x1,(%ebx)
+  801c0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c11:	c9                   	leave
+  801c12:	c3                   	ret
+  801c13:	e8 a1 ff ff ff       	call   801bb9 <bflush>
+  801c18:	eb f1                	jmp    801c0b <bputch+0x28>
+
+00801c1a <vbprintf>:
+  801c1a:	55                   	push   %ebp
+  801c1b:	89 e5                	mov    %esp,%ebp
+  801c1d:	83 ec 18             	sub    $0x18,%esp
+  801c20:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801c27:	ff 75 0c             	push   0xc(%ebp)
+  801c2a:	ff 75 08             	push   0x8(%ebp)
+  801c2d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c30:	50                   	push   %eax
+  801c31:	68 e3 1b 80 00       	push   $0x801be3
+  801c36:	e8 58 e7 ff ff       	call   800393 <vprintfmt>
+  801c3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c3e:	c9                   	leave
+  801c3f:	c3                   	ret
+
+00801c40 <bprintf>:
+  801c40:	55                   	push   %ebp
+  801c41:	89 e5                	mov    %esp,%ebp
+  801c43:	83 ec 10             	sub    $0x10,%esp
+  801c46:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801c49:	50                   	push   %eax
+  801c4a:	ff 75 08             	push   0x8(%ebp)
+  801c4d:	e8 c8 ff ff ff       	call   801c1a <vbprintf>
+  801c52:	c9                   	leave
+  801c53:	c3                   	ret
+
+00801c54 <bwrite>:
+  801c54:	55                   	push   %ebp
+  801c55:	89 e5                	mov    %esp,%ebp
+  801c57:	53                   	push   %ebx
+  801c58:	83 ec 04             	sub    $0x4,%esp
+  801c5b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c5e:	89 d8                	mov    %ebx,%eax
+  801c60:	03 05 40 30 80 00    	add    0x803040,%eax
+  801c66:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c6b:	76 0d                	jbe    801c7a <bwrite+0x26>
+  801c6d:	e8 47 ff ff ff       	call   801bb9 <bflush>
+  801c72:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801c78:	77 25                	ja     801c9f <bwrite+0x4b>
+  801c7a:	83 ec 04             	sub    $0x4,%esp
+  801c7d:	53                   	push   %ebx
+  801c7e:	ff 75 08             	push   0x8(%ebp)
+  801c81:	a1 40 30 80 00       	mov    0x803040,%eax
+  801c86:	05 44 30 80 00       	add    $0x803044,%eax
+  801c8b:	50                   	push   %eax
+  801c8c:	e8 6d ee ff ff       	call   800afe <memcpy>
+  801c91:	01 1d 40 30 80 00    	add    %ebx,0x803040
+  801c97:	83 c4 10             	add    $0x10,%esp
+  801c9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c9d:	c9                   	leave
+  801c9e:	c3                   	ret
+  801c9f:	83 ec 08             	sub    $0x8,%esp
+  801ca2:	53                   	push   %ebx
+  801ca3:	ff 75 08             	push   0x8(%ebp)
+  801ca6:	e8 55 f0 ff ff       	call   800d00 <sys_cputs>
+  801cab:	83 c4 10             	add    $0x10,%esp
+  801cae:	eb ea                	jmp    801c9a <bwrite+0x46>
+
+00801cb0 <_panic>:
+  801cb0:	55                   	push   %ebp
+  801cb1:	89 e5                	mov    %esp,%ebp
+  801cb3:	56                   	push   %esi
+  801cb4:	53                   	push   %ebx
+  801cb5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  801cb8:	e8 fc fe ff ff       	call   801bb9 <bflush>
+  801cbd:	8b 35 08 30 80 00    	mov    0x803008,%esi
+  801cc3:	e8 91 f1 ff ff       	call   800e59 <sys_getenvid>
+  801cc8:	83 ec 0c             	sub    $0xc,%esp
+  801ccb:	ff 75 0c             	push   0xc(%ebp)
+  801cce:	ff 75 08             	push   0x8(%ebp)
+  801cd1:	56                   	push   %esi
+  801cd2:	50                   	push   %eax
+  801cd3:	68 1c 24 80 00       	push   $0x80241c
+  801cd8:	e8 bf e5 ff ff       	call   80029c <cprintf>
+  801cdd:	83 c4 18             	add    $0x18,%esp
+  801ce0:	53                   	push   %ebx
+  801ce1:	ff 75 10             	push   0x10(%ebp)
+  801ce4:	e8 62 e5 ff ff       	call   80024b <vcprintf>
+  801ce9:	c7 04 24 32 20 80 00 	movl   $0x802032,(%esp)
+  801cf0:	e8 a7 e5 ff ff       	call   80029c <cprintf>
+  801cf5:	83 c4 10             	add    $0x10,%esp
+  801cf8:	cc                   	int3
+  801cf9:	eb fd                	jmp    801cf8 <_panic+0x48>
+
+00801cfb <set_pgfault_handler>:
+  801cfb:	55                   	push   %ebp
+  801cfc:	89 e5                	mov    %esp,%ebp
+  801cfe:	83 ec 08             	sub    $0x8,%esp
+  801d01:	83 3d 44 34 80 00 00 	cmpl   $0x0,0x803444
+  801d08:	74 0a                	je     801d14 <set_pgfault_handler+0x19>
+  801d0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d0d:	a3 44 34 80 00       	mov    %eax,0x803444
+  801d12:	c9                   	leave
+  801d13:	c3                   	ret
+  801d14:	83 ec 04             	sub    $0x4,%esp
+  801d17:	6a 07                	push   $0x7
+  801d19:	68 00 f0 ff ea       	push   $0xeafff000
+  801d1e:	6a 00                	push   $0x0
+  801d20:	e8 1e f3 ff ff       	call   801043 <sys_page_alloc>
+  801d25:	83 c4 10             	add    $0x10,%esp
+  801d28:	85 c0                	test   %eax,%eax
+  801d2a:	75 2a                	jne    801d56 <set_pgfault_handler+0x5b>
+  801d2c:	83 ec 08             	sub    $0x8,%esp
+  801d2f:	68 6a 1d 80 00       	push   $0x801d6a
+  801d34:	6a 00                	push   $0x0
+  801d36:	e8 aa f5 ff ff       	call   8012e5 <sys_env_set_pgfault_upcall>
+  801d3b:	83 c4 10             	add    $0x10,%esp
+  801d3e:	85 c0                	test   %eax,%eax
+  801d40:	74 c8                	je     801d0a <set_pgfault_handler+0xf>
+  801d42:	83 ec 04             	sub    $0x4,%esp
+  801d45:	68 64 24 80 00       	push   $0x802464
+  801d4a:	6a 28                	push   $0x28
+  801d4c:	68 55 24 80 00       	push   $0x802455
+  801d51:	e8 5a ff ff ff       	call   801cb0 <_panic>
+  801d56:	83 ec 04             	sub    $0x4,%esp
+  801d59:	68 3f 24 80 00       	push   $0x80243f
+  801d5e:	6a 22                	push   $0x22
+  801d60:	68 55 24 80 00       	push   $0x802455
+  801d65:	e8 46 ff ff ff       	call   801cb0 <_panic>
+
+00801d6a <_pgfault_upcall>:
+  801d6a:	54                   	push   %esp
+  801d6b:	a1 44 34 80 00       	mov    0x803444,%eax
+  801d70:	ff d0                	call   *%eax
+  801d72:	83 c4 04             	add    $0x4,%esp
+  801d75:	8b 44 24 28          	mov    0x28(%esp),%eax
+  801d79:	89 e5                	mov    %esp,%ebp
+  801d7b:	8b 64 24 30          	mov    0x30(%esp),%esp
+  801d7f:	50                   	push   %eax
+  801d80:	89 ec                	mov    %ebp,%esp
+  801d82:	83 c4 08             	add    $0x8,%esp
+  801d85:	61                   	popa
+  801d86:	83 c4 04             	add    $0x4,%esp
+  801d89:	9d                   	popf
+  801d8a:	5c                   	pop    %esp
+  801d8b:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+  801d8f:	c3                   	ret
+
+00801d90 <__udivdi3>:
+  801d90:	57                   	push   %edi
+  801d91:	56                   	push   %esi
+  801d92:	53                   	push   %ebx
+  801d93:	83 ec 20             	sub    $0x20,%esp
+  801d96:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801d9a:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801d9e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801da2:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801da6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801daa:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801dae:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801db2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801db6:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801dba:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801dbe:	89 d1                	mov    %edx,%ecx
+  801dc0:	09 c1                	or     %eax,%ecx
+  801dc2:	0f 84 91 00 00 00    	je     801e59 <__udivdi3+0xc9>
+  801dc8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801dcf:	00 
+  801dd0:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801dd7:	00 
+  801dd8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801de7:	eb 08                	jmp    801df1 <__udivdi3+0x61>
+  801de9:	83 e9 01             	sub    $0x1,%ecx
+  801dec:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801def:	74 68                	je     801e59 <__udivdi3+0xc9>
+  801df1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801df5:	01 c0                	add    %eax,%eax
+  801df7:	89 c6                	mov    %eax,%esi
+  801df9:	89 d7                	mov    %edx,%edi
+  801dfb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801dff:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801e03:	0f ad d0             	shrd   %cl,%edx,%eax
+  801e06:	d3 ea                	shr    %cl,%edx
+  801e08:	f6 c1 20             	test   $0x20,%cl
+  801e0b:	74 04                	je     801e11 <__udivdi3+0x81>
+  801e0d:	89 d0                	mov    %edx,%eax
+  801e0f:	31 d2                	xor    %edx,%edx
+  801e11:	83 e0 01             	and    $0x1,%eax
+  801e14:	89 04 24             	mov    %eax,(%esp)
+  801e17:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801e1e:	00 
+  801e1f:	8b 04 24             	mov    (%esp),%eax
+  801e22:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801e26:	09 f0                	or     %esi,%eax
+  801e28:	09 fa                	or     %edi,%edx
+  801e2a:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801e2e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801e32:	39 f0                	cmp    %esi,%eax
+  801e34:	89 d3                	mov    %edx,%ebx
+  801e36:	19 fb                	sbb    %edi,%ebx
+  801e38:	72 af                	jb     801de9 <__udivdi3+0x59>
+  801e3a:	29 f0                	sub    %esi,%eax
+  801e3c:	19 fa                	sbb    %edi,%edx
+  801e3e:	89 cf                	mov    %ecx,%edi
+  801e40:	c1 ef 05             	shr    $0x5,%edi
+  801e43:	83 e7 01             	and    $0x1,%edi
+  801e46:	89 fe                	mov    %edi,%esi
+  801e48:	83 f6 01             	xor    $0x1,%esi
+  801e4b:	d3 e6                	shl    %cl,%esi
+  801e4d:	d3 e7                	shl    %cl,%edi
+  801e4f:	09 74 24 18          	or     %esi,0x18(%esp)
+  801e53:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  801e57:	eb 90                	jmp    801de9 <__udivdi3+0x59>
+  801e59:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801e5d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  801e61:	83 c4 20             	add    $0x20,%esp
+  801e64:	5b                   	pop    %ebx
+  801e65:	5e                   	pop    %esi
+  801e66:	5f                   	pop    %edi
+  801e67:	c3                   	ret
+
+00801e68 <__umoddi3>:
+  801e68:	55                   	push   %ebp
+  801e69:	57                   	push   %edi
+  801e6a:	56                   	push   %esi
+  801e6b:	53                   	push   %ebx
+  801e6c:	83 ec 1c             	sub    $0x1c,%esp
+  801e6f:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801e73:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801e77:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801e7b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801e7f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801e83:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801e87:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801e8b:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801e8f:	89 d6                	mov    %edx,%esi
+  801e91:	09 c6                	or     %eax,%esi
+  801e93:	74 6c                	je     801f01 <__umoddi3+0x99>
+  801e95:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801e9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea4:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801ea8:	eb 0e                	jmp    801eb8 <__umoddi3+0x50>
+  801eaa:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801eaf:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801eb3:	83 fe ff             	cmp    $0xffffffff,%esi
+  801eb6:	74 49                	je     801f01 <__umoddi3+0x99>
+  801eb8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801ebc:	01 c0                	add    %eax,%eax
+  801ebe:	89 c3                	mov    %eax,%ebx
+  801ec0:	89 d6                	mov    %edx,%esi
+  801ec2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801ec6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801eca:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801ecf:	0f ad d0             	shrd   %cl,%edx,%eax
+  801ed2:	d3 ea                	shr    %cl,%edx
+  801ed4:	f6 c1 20             	test   $0x20,%cl
+  801ed7:	74 04                	je     801edd <__umoddi3+0x75>
+  801ed9:	89 d0                	mov    %edx,%eax
+  801edb:	31 d2                	xor    %edx,%edx
+  801edd:	83 e0 01             	and    $0x1,%eax
+  801ee0:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801ee5:	89 ea                	mov    %ebp,%edx
+  801ee7:	09 d8                	or     %ebx,%eax
+  801ee9:	09 f2                	or     %esi,%edx
+  801eeb:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801eef:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801ef3:	39 d8                	cmp    %ebx,%eax
+  801ef5:	89 d1                	mov    %edx,%ecx
+  801ef7:	19 f1                	sbb    %esi,%ecx
+  801ef9:	72 af                	jb     801eaa <__umoddi3+0x42>
+  801efb:	29 d8                	sub    %ebx,%eax
+  801efd:	19 f2                	sbb    %esi,%edx
+  801eff:	eb a9                	jmp    801eaa <__umoddi3+0x42>
+  801f01:	83 c4 1c             	add    $0x1c,%esp
+  801f04:	5b                   	pop    %ebx
+  801f05:	5e                   	pop    %esi
+  801f06:	5f                   	pop    %edi
+  801f07:	5d                   	pop    %ebp
+  801f08:	c3                   	ret
+
+00801f09 <__divdi3>:
+  801f09:	53                   	push   %ebx
+  801f0a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801f0e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801f12:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801f16:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801f1a:	85 d2                	test   %edx,%edx
+  801f1c:	78 12                	js     801f30 <__divdi3+0x27>
+  801f1e:	85 db                	test   %ebx,%ebx
+  801f20:	78 2e                	js     801f50 <__divdi3+0x47>
+  801f22:	53                   	push   %ebx
+  801f23:	51                   	push   %ecx
+  801f24:	52                   	push   %edx
+  801f25:	50                   	push   %eax
+  801f26:	e8 65 fe ff ff       	call   801d90 <__udivdi3>
+  801f2b:	83 c4 10             	add    $0x10,%esp
+  801f2e:	eb 1e                	jmp    801f4e <__divdi3+0x45>
+  801f30:	f7 d8                	neg    %eax
+  801f32:	83 d2 00             	adc    $0x0,%edx
+  801f35:	f7 da                	neg    %edx
+  801f37:	85 db                	test   %ebx,%ebx
+  801f39:	78 2a                	js     801f65 <__divdi3+0x5c>
+  801f3b:	53                   	push   %ebx
+  801f3c:	51                   	push   %ecx
+  801f3d:	52                   	push   %edx
+  801f3e:	50                   	push   %eax
+  801f3f:	e8 4c fe ff ff       	call   801d90 <__udivdi3>
+  801f44:	83 c4 10             	add    $0x10,%esp
+  801f47:	f7 d8                	neg    %eax
+  801f49:	83 d2 00             	adc    $0x0,%edx
+  801f4c:	f7 da                	neg    %edx
+  801f4e:	5b                   	pop    %ebx
+  801f4f:	c3                   	ret
+  801f50:	f7 d9                	neg    %ecx
+  801f52:	83 d3 00             	adc    $0x0,%ebx
+  801f55:	f7 db                	neg    %ebx
+  801f57:	53                   	push   %ebx
+  801f58:	51                   	push   %ecx
+  801f59:	52                   	push   %edx
+  801f5a:	50                   	push   %eax
+  801f5b:	e8 30 fe ff ff       	call   801d90 <__udivdi3>
+  801f60:	83 c4 10             	add    $0x10,%esp
+  801f63:	eb e2                	jmp    801f47 <__divdi3+0x3e>
+  801f65:	f7 d9                	neg    %ecx
+  801f67:	83 d3 00             	adc    $0x0,%ebx
+  801f6a:	f7 db                	neg    %ebx
+  801f6c:	53                   	push   %ebx
+  801f6d:	51                   	push   %ecx
+  801f6e:	52                   	push   %edx
+  801f6f:	50                   	push   %eax
+  801f70:	e8 1b fe ff ff       	call   801d90 <__udivdi3>
+  801f75:	83 c4 10             	add    $0x10,%esp
+  801f78:	eb d4                	jmp    801f4e <__divdi3+0x45>
+
+00801f7a <__moddi3>:
+  801f7a:	55                   	push   %ebp
+  801f7b:	57                   	push   %edi
+  801f7c:	56                   	push   %esi
+  801f7d:	53                   	push   %ebx
+  801f7e:	83 ec 14             	sub    $0x14,%esp
+  801f81:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801f85:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801f89:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801f8d:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801f91:	85 ed                	test   %ebp,%ebp
+  801f93:	78 2b                	js     801fc0 <__moddi3+0x46>
+  801f95:	89 c6                	mov    %eax,%esi
+  801f97:	f7 de                	neg    %esi
+  801f99:	89 34 24             	mov    %esi,(%esp)
+  801f9c:	89 d6                	mov    %edx,%esi
+  801f9e:	83 d6 00             	adc    $0x0,%esi
+  801fa1:	f7 de                	neg    %esi
+  801fa3:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801fa7:	8b 34 24             	mov    (%esp),%esi
+  801faa:	0f 48 f0             	cmovs  %eax,%esi
+  801fad:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801fb2:	52                   	push   %edx
+  801fb3:	56                   	push   %esi
+  801fb4:	55                   	push   %ebp
+  801fb5:	57                   	push   %edi
+  801fb6:	e8 ad fe ff ff       	call   801e68 <__umoddi3>
+  801fbb:	83 c4 10             	add    $0x10,%esp
+  801fbe:	eb 3c                	jmp    801ffc <__moddi3+0x82>
+  801fc0:	89 c3                	mov    %eax,%ebx
+  801fc2:	f7 db                	neg    %ebx
+  801fc4:	89 d1                	mov    %edx,%ecx
+  801fc6:	83 d1 00             	adc    $0x0,%ecx
+  801fc9:	f7 d9                	neg    %ecx
+  801fcb:	0f 49 c3             	cmovns %ebx,%eax
+  801fce:	89 04 24             	mov    %eax,(%esp)
+  801fd1:	0f 49 d1             	cmovns %ecx,%edx
+  801fd4:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801fd8:	ff 74 24 04          	push   0x4(%esp)
+  801fdc:	ff 74 24 04          	push   0x4(%esp)
+  801fe0:	89 f8                	mov    %edi,%eax
+  801fe2:	89 ea                	mov    %ebp,%edx
+  801fe4:	f7 d8                	neg    %eax
+  801fe6:	83 d2 00             	adc    $0x0,%edx
+  801fe9:	f7 da                	neg    %edx
+  801feb:	52                   	push   %edx
+  801fec:	50                   	push   %eax
+  801fed:	e8 76 fe ff ff       	call   801e68 <__umoddi3>
+  801ff2:	83 c4 10             	add    $0x10,%esp
+  801ff5:	f7 d8                	neg    %eax
+  801ff7:	83 d2 00             	adc    $0x0,%edx
+  801ffa:	f7 da                	neg    %edx
+  801ffc:	83 c4 14             	add    $0x14,%esp
+  801fff:	5b                   	pop    %ebx
+  802000:	5e                   	pop    %esi
+  802001:	5f                   	pop    %edi
+  802002:	5d                   	pop    %ebp
+  802003:	c3                   	ret
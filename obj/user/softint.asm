@@ -0,0 +1,2567 @@
+
+obj/user/softint:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 05 00 00 00       	call   800036 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	cd 0e                	int    $0xe
+  800035:	c3                   	ret
+
+00800036 <libmain>:
+  800036:	55                   	push   %ebp
+  800037:	89 e5                	mov    %esp,%ebp
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800041:	e8 cb 09 00 00       	call   800a11 <uinfo_envid>
+  800046:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80004b:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  800051:	05 00 00 00 ed       	add    $0xed000000,%eax
+  800056:	a3 20 20 80 00       	mov    %eax,0x802020
+  80005b:	85 db                	test   %ebx,%ebx
+  80005d:	7e 07                	jle    800066 <libmain+0x30>
+  80005f:	8b 06                	mov    (%esi),%eax
+  800061:	a3 00 20 80 00       	mov    %eax,0x802000
+  800066:	83 ec 08             	sub    $0x8,%esp
+  800069:	56                   	push   %esi
+  80006a:	53                   	push   %ebx
+  80006b:	e8 c3 ff ff ff       	call   800033 <umain>
+  800070:	e8 0a 00 00 00       	call   80007f <exit>
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007b:	5b                   	pop    %ebx
+  80007c:	5e                   	pop    %esi
+  80007d:	5d                   	pop    %ebp
+  80007e:	c3                   	ret
+
+0080007f <exit>:
+  80007f:	55                   	push   %ebp
+  800080:	89 e5                	mov    %esp,%ebp
+  800082:	83 ec 08             	sub    $0x8,%esp
+  800085:	e8 20 0a 00 00       	call   800aaa <bflush>
+  80008a:	83 ec 0c             	sub    $0xc,%esp
+  80008d:	6a 00                	push   $0x0
+  80008f:	e8 d3 00 00 00       	call   800167 <sys_env_destroy>
+  800094:	83 c4 10             	add    $0x10,%esp
+  800097:	c9                   	leave
+  800098:	c3                   	ret
+
+00800099 <sys_cputs>:
+  800099:	55                   	push   %ebp
+  80009a:	89 e5                	mov    %esp,%ebp
+  80009c:	57                   	push   %edi
+  80009d:	56                   	push   %esi
+  80009e:	53                   	push   %ebx
+  80009f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000a6:	78 21                	js     8000c9 <sys_cputs+0x30>
+  8000a8:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8000af:	75 2d                	jne    8000de <sys_cputs+0x45>
+  8000b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000bc:	89 c3                	mov    %eax,%ebx
+  8000be:	89 c7                	mov    %eax,%edi
+  8000c0:	89 c6                	mov    %eax,%esi
+  8000c2:	cd 30                	int    $0x30
+  8000c4:	5b                   	pop    %ebx
+  8000c5:	5e                   	pop    %esi
+  8000c6:	5f                   	pop    %edi
+  8000c7:	5d                   	pop    %ebp
+  8000c8:	c3                   	ret
+  8000c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000ce:	0f a2                	cpuid
+  8000d0:	c1 ea 0b             	shr    $0xb,%edx
+  8000d3:	83 e2 01             	and    $0x1,%edx
+  8000d6:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8000dc:	eb ca                	jmp    8000a8 <sys_cputs+0xf>
+  8000de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000e9:	89 c3                	mov    %eax,%ebx
+  8000eb:	89 c7                	mov    %eax,%edi
+  8000ed:	89 c6                	mov    %eax,%esi
+  8000ef:	55                   	push   %ebp
+  8000f0:	68 f9 00 80 00       	push   $0x8000f9
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	0f 34                	sysenter
+  8000f9:	83 c4 04             	add    $0x4,%esp
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	eb c5                	jmp    8000c4 <sys_cputs+0x2b>
+
+008000ff <sys_cgetc>:
+  8000ff:	55                   	push   %ebp
+  800100:	89 e5                	mov    %esp,%ebp
+  800102:	57                   	push   %edi
+  800103:	56                   	push   %esi
+  800104:	53                   	push   %ebx
+  800105:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80010c:	78 22                	js     800130 <sys_cgetc+0x31>
+  80010e:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800115:	75 2e                	jne    800145 <sys_cgetc+0x46>
+  800117:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800121:	89 d1                	mov    %edx,%ecx
+  800123:	89 d3                	mov    %edx,%ebx
+  800125:	89 d7                	mov    %edx,%edi
+  800127:	89 d6                	mov    %edx,%esi
+  800129:	cd 30                	int    $0x30
+  80012b:	5b                   	pop    %ebx
+  80012c:	5e                   	pop    %esi
+  80012d:	5f                   	pop    %edi
+  80012e:	5d                   	pop    %ebp
+  80012f:	c3                   	ret
+  800130:	b8 01 00 00 00       	mov    $0x1,%eax
+  800135:	0f a2                	cpuid
+  800137:	c1 ea 0b             	shr    $0xb,%edx
+  80013a:	83 e2 01             	and    $0x1,%edx
+  80013d:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800143:	eb c9                	jmp    80010e <sys_cgetc+0xf>
+  800145:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80014f:	89 d1                	mov    %edx,%ecx
+  800151:	89 d3                	mov    %edx,%ebx
+  800153:	89 d7                	mov    %edx,%edi
+  800155:	89 d6                	mov    %edx,%esi
+  800157:	55                   	push   %ebp
+  800158:	68 61 01 80 00       	push   $0x800161
+  80015d:	89 e5                	mov    %esp,%ebp
+  80015f:	0f 34                	sysenter
+  800161:	83 c4 04             	add    $0x4,%esp
+  800164:	5d                   	pop    %ebp
+  800165:	eb c4                	jmp    80012b <sys_cgetc+0x2c>
+
+00800167 <sys_env_destroy>:
+  800167:	55                   	push   %ebp
+  800168:	89 e5                	mov    %esp,%ebp
+  80016a:	57                   	push   %edi
+  80016b:	56                   	push   %esi
+  80016c:	53                   	push   %ebx
+  80016d:	83 ec 0c             	sub    $0xc,%esp
+  800170:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800177:	78 2a                	js     8001a3 <sys_env_destroy+0x3c>
+  800179:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800180:	75 36                	jne    8001b8 <sys_env_destroy+0x51>
+  800182:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800187:	b8 03 00 00 00       	mov    $0x3,%eax
+  80018c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80018f:	89 cb                	mov    %ecx,%ebx
+  800191:	89 cf                	mov    %ecx,%edi
+  800193:	89 ce                	mov    %ecx,%esi
+  800195:	cd 30                	int    $0x30
+  800197:	85 c0                	test   %eax,%eax
+  800199:	7f 40                	jg     8001db <sys_env_destroy+0x74>
+  80019b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80019e:	5b                   	pop    %ebx
+  80019f:	5e                   	pop    %esi
+  8001a0:	5f                   	pop    %edi
+  8001a1:	5d                   	pop    %ebp
+  8001a2:	c3                   	ret
+  8001a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001a8:	0f a2                	cpuid
+  8001aa:	c1 ea 0b             	shr    $0xb,%edx
+  8001ad:	83 e2 01             	and    $0x1,%edx
+  8001b0:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8001b6:	eb c1                	jmp    800179 <sys_env_destroy+0x12>
+  8001b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001c0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8001c5:	89 cb                	mov    %ecx,%ebx
+  8001c7:	89 cf                	mov    %ecx,%edi
+  8001c9:	89 ce                	mov    %ecx,%esi
+  8001cb:	55                   	push   %ebp
+  8001cc:	68 d5 01 80 00       	push   $0x8001d5
+  8001d1:	89 e5                	mov    %esp,%ebp
+  8001d3:	0f 34                	sysenter
+  8001d5:	83 c4 04             	add    $0x4,%esp
+  8001d8:	5d                   	pop    %ebp
+  8001d9:	eb bc                	jmp    800197 <sys_env_destroy+0x30>
+  8001db:	83 ec 0c             	sub    $0xc,%esp
+  8001de:	50                   	push   %eax
+  8001df:	6a 03                	push   $0x3
+  8001e1:	68 6a 19 80 00       	push   $0x80196a
+  8001e6:	6a 49                	push   $0x49
+  8001e8:	68 87 19 80 00       	push   $0x801987
+  8001ed:	e8 af 09 00 00       	call   800ba1 <_panic>
+
+008001f2 <sys_getenvid>:
+  8001f2:	55                   	push   %ebp
+  8001f3:	89 e5                	mov    %esp,%ebp
+  8001f5:	57                   	push   %edi
+  8001f6:	56                   	push   %esi
+  8001f7:	53                   	push   %ebx
+  8001f8:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8001ff:	78 22                	js     800223 <sys_getenvid+0x31>
+  800201:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800208:	75 2e                	jne    800238 <sys_getenvid+0x46>
+  80020a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80020f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800214:	89 d1                	mov    %edx,%ecx
+  800216:	89 d3                	mov    %edx,%ebx
+  800218:	89 d7                	mov    %edx,%edi
+  80021a:	89 d6                	mov    %edx,%esi
+  80021c:	cd 30                	int    $0x30
+  80021e:	5b                   	pop    %ebx
+  80021f:	5e                   	pop    %esi
+  800220:	5f                   	pop    %edi
+  800221:	5d                   	pop    %ebp
+  800222:	c3                   	ret
+  800223:	b8 01 00 00 00       	mov    $0x1,%eax
+  800228:	0f a2                	cpuid
+  80022a:	c1 ea 0b             	shr    $0xb,%edx
+  80022d:	83 e2 01             	and    $0x1,%edx
+  800230:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800236:	eb c9                	jmp    800201 <sys_getenvid+0xf>
+  800238:	ba 00 00 00 00       	mov    $0x0,%edx
+  80023d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800242:	89 d1                	mov    %edx,%ecx
+  800244:	89 d3                	mov    %edx,%ebx
+  800246:	89 d7                	mov    %edx,%edi
+  800248:	89 d6                	mov    %edx,%esi
+  80024a:	55                   	push   %ebp
+  80024b:	68 54 02 80 00       	push   $0x800254
+  800250:	89 e5                	mov    %esp,%ebp
+  800252:	0f 34                	sysenter
+  800254:	83 c4 04             	add    $0x4,%esp
+  800257:	5d                   	pop    %ebp
+  800258:	eb c4                	jmp    80021e <sys_getenvid+0x2c>
+
+0080025a <sys_yield>:
+  80025a:	55                   	push   %ebp
+  80025b:	89 e5                	mov    %esp,%ebp
+  80025d:	57                   	push   %edi
+  80025e:	56                   	push   %esi
+  80025f:	53                   	push   %ebx
+  800260:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800267:	78 22                	js     80028b <sys_yield+0x31>
+  800269:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800270:	75 2e                	jne    8002a0 <sys_yield+0x46>
+  800272:	ba 00 00 00 00       	mov    $0x0,%edx
+  800277:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80027c:	89 d1                	mov    %edx,%ecx
+  80027e:	89 d3                	mov    %edx,%ebx
+  800280:	89 d7                	mov    %edx,%edi
+  800282:	89 d6                	mov    %edx,%esi
+  800284:	cd 30                	int    $0x30
+  800286:	5b                   	pop    %ebx
+  800287:	5e                   	pop    %esi
+  800288:	5f                   	pop    %edi
+  800289:	5d                   	pop    %ebp
+  80028a:	c3                   	ret
+  80028b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800290:	0f a2                	cpuid
+  800292:	c1 ea 0b             	shr    $0xb,%edx
+  800295:	83 e2 01             	and    $0x1,%edx
+  800298:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80029e:	eb c9                	jmp    800269 <sys_yield+0xf>
+  8002a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002aa:	89 d1                	mov    %edx,%ecx
+  8002ac:	89 d3                	mov    %edx,%ebx
+  8002ae:	89 d7                	mov    %edx,%edi
+  8002b0:	89 d6                	mov    %edx,%esi
+  8002b2:	55                   	push   %ebp
+  8002b3:	68 bc 02 80 00       	push   $0x8002bc
+  8002b8:	89 e5                	mov    %esp,%ebp
+  8002ba:	0f 34                	sysenter
+  8002bc:	83 c4 04             	add    $0x4,%esp
+  8002bf:	5d                   	pop    %ebp
+  8002c0:	eb c4                	jmp    800286 <sys_yield+0x2c>
+
+008002c2 <sys_env_set_cow>:
+  8002c2:	55                   	push   %ebp
+  8002c3:	89 e5                	mov    %esp,%ebp
+  8002c5:	57                   	push   %edi
+  8002c6:	56                   	push   %esi
+  8002c7:	53                   	push   %ebx
+  8002c8:	83 ec 0c             	sub    $0xc,%esp
+  8002cb:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8002d2:	78 2b                	js     8002ff <sys_env_set_cow+0x3d>
+  8002d4:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8002db:	75 37                	jne    800314 <sys_env_set_cow+0x52>
+  8002dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002e2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8002e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002ed:	89 df                	mov    %ebx,%edi
+  8002ef:	89 de                	mov    %ebx,%esi
+  8002f1:	cd 30                	int    $0x30
+  8002f3:	85 c0                	test   %eax,%eax
+  8002f5:	7f 41                	jg     800338 <sys_env_set_cow+0x76>
+  8002f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002fa:	5b                   	pop    %ebx
+  8002fb:	5e                   	pop    %esi
+  8002fc:	5f                   	pop    %edi
+  8002fd:	5d                   	pop    %ebp
+  8002fe:	c3                   	ret
+  8002ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  800304:	0f a2                	cpuid
+  800306:	c1 ea 0b             	shr    $0xb,%edx
+  800309:	83 e2 01             	and    $0x1,%edx
+  80030c:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800312:	eb c0                	jmp    8002d4 <sys_env_set_cow+0x12>
+  800314:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800319:	8b 55 08             	mov    0x8(%ebp),%edx
+  80031c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80031f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800324:	89 df                	mov    %ebx,%edi
+  800326:	89 de                	mov    %ebx,%esi
+  800328:	55                   	push   %ebp
+  800329:	68 32 03 80 00       	push   $0x800332
+  80032e:	89 e5                	mov    %esp,%ebp
+  800330:	0f 34                	sysenter
+  800332:	83 c4 04             	add    $0x4,%esp
+  800335:	5d                   	pop    %ebp
+  800336:	eb bb                	jmp    8002f3 <sys_env_set_cow+0x31>
+  800338:	83 ec 0c             	sub    $0xc,%esp
+  80033b:	50                   	push   %eax
+  80033c:	6a 0d                	push   $0xd
+  80033e:	68 6a 19 80 00       	push   $0x80196a
+  800343:	6a 49                	push   $0x49
+  800345:	68 87 19 80 00       	push   $0x801987
+  80034a:	e8 52 08 00 00       	call   800ba1 <_panic>
+
+0080034f <sys_env_set_quota>:
+  80034f:	55                   	push   %ebp
+  800350:	89 e5                	mov    %esp,%ebp
+  800352:	57                   	push   %edi
+  800353:	56                   	push   %esi
+  800354:	53                   	push   %ebx
+  800355:	83 ec 0c             	sub    $0xc,%esp
+  800358:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80035f:	78 2b                	js     80038c <sys_env_set_quota+0x3d>
+  800361:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800368:	75 37                	jne    8003a1 <sys_env_set_quota+0x52>
+  80036a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80036f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800374:	8b 55 08             	mov    0x8(%ebp),%edx
+  800377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80037a:	89 df                	mov    %ebx,%edi
+  80037c:	89 de                	mov    %ebx,%esi
+  80037e:	cd 30                	int    $0x30
+  800380:	85 c0                	test   %eax,%eax
+  800382:	7f 41                	jg     8003c5 <sys_env_set_quota+0x76>
+  800384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800387:	5b                   	pop    %ebx
+  800388:	5e                   	pop    %esi
+  800389:	5f                   	pop    %edi
+  80038a:	5d                   	pop    %ebp
+  80038b:	c3                   	ret
+  80038c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800391:	0f a2                	cpuid
+  800393:	c1 ea 0b             	shr    $0xb,%edx
+  800396:	83 e2 01             	and    $0x1,%edx
+  800399:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80039f:	eb c0                	jmp    800361 <sys_env_set_quota+0x12>
+  8003a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003ac:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003b1:	89 df                	mov    %ebx,%edi
+  8003b3:	89 de                	mov    %ebx,%esi
+  8003b5:	55                   	push   %ebp
+  8003b6:	68 bf 03 80 00       	push   $0x8003bf
+  8003bb:	89 e5                	mov    %esp,%ebp
+  8003bd:	0f 34                	sysenter
+  8003bf:	83 c4 04             	add    $0x4,%esp
+  8003c2:	5d                   	pop    %ebp
+  8003c3:	eb bb                	jmp    800380 <sys_env_set_quota+0x31>
+  8003c5:	83 ec 0c             	sub    $0xc,%esp
+  8003c8:	50                   	push   %eax
+  8003c9:	6a 0f                	push   $0xf
+  8003cb:	68 6a 19 80 00       	push   $0x80196a
+  8003d0:	6a 49                	push   $0x49
+  8003d2:	68 87 19 80 00       	push   $0x801987
+  8003d7:	e8 c5 07 00 00       	call   800ba1 <_panic>
+
+008003dc <sys_page_alloc>:
+  8003dc:	55                   	push   %ebp
+  8003dd:	89 e5                	mov    %esp,%ebp
+  8003df:	57                   	push   %edi
+  8003e0:	56                   	push   %esi
+  8003e1:	53                   	push   %ebx
+  8003e2:	83 ec 0c             	sub    $0xc,%esp
+  8003e5:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8003ec:	78 2c                	js     80041a <sys_page_alloc+0x3e>
+  8003ee:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8003f5:	75 38                	jne    80042f <sys_page_alloc+0x53>
+  8003f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8003fc:	b8 04 00 00 00       	mov    $0x4,%eax
+  800401:	8b 55 08             	mov    0x8(%ebp),%edx
+  800404:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800407:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80040a:	89 f7                	mov    %esi,%edi
+  80040c:	cd 30                	int    $0x30
+  80040e:	85 c0                	test   %eax,%eax
+  800410:	7f 42                	jg     800454 <sys_page_alloc+0x78>
+  800412:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800415:	5b                   	pop    %ebx
+  800416:	5e                   	pop    %esi
+  800417:	5f                   	pop    %edi
+  800418:	5d                   	pop    %ebp
+  800419:	c3                   	ret
+  80041a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80041f:	0f a2                	cpuid
+  800421:	c1 ea 0b             	shr    $0xb,%edx
+  800424:	83 e2 01             	and    $0x1,%edx
+  800427:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80042d:	eb bf                	jmp    8003ee <sys_page_alloc+0x12>
+  80042f:	be 00 00 00 00       	mov    $0x0,%esi
+  800434:	8b 55 08             	mov    0x8(%ebp),%edx
+  800437:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80043a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80043f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800442:	89 f7                	mov    %esi,%edi
+  800444:	55                   	push   %ebp
+  800445:	68 4e 04 80 00       	push   $0x80044e
+  80044a:	89 e5                	mov    %esp,%ebp
+  80044c:	0f 34                	sysenter
+  80044e:	83 c4 04             	add    $0x4,%esp
+  800451:	5d                   	pop    %ebp
+  800452:	eb ba                	jmp    80040e <sys_page_alloc+0x32>
+  800454:	83 ec 0c             	sub    $0xc,%esp
+  800457:	50                   	push   %eax
+  800458:	6a 04                	push   $0x4
+  80045a:	68 6a 19 80 00       	push   $0x80196a
+  80045f:	6a 49                	push   $0x49
+  800461:	68 87 19 80 00       	push   $0x801987
+  800466:	e8 36 07 00 00       	call   800ba1 <_panic>
+
+0080046b <sys_page_map>:
+  80046b:	55                   	push   %ebp
+  80046c:	89 e5                	mov    %esp,%ebp
+  80046e:	57                   	push   %edi
+  80046f:	56                   	push   %esi
+  800470:	53                   	push   %ebx
+  800471:	83 ec 0c             	sub    $0xc,%esp
+  800474:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80047b:	78 2b                	js     8004a8 <sys_page_map+0x3d>
+  80047d:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800484:	75 37                	jne    8004bd <sys_page_map+0x52>
+  800486:	b8 05 00 00 00       	mov    $0x5,%eax
+  80048b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80048e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800491:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800494:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800497:	8b 75 18             	mov    0x18(%ebp),%esi
+  80049a:	cd 30                	int    $0x30
+  80049c:	85 c0                	test   %eax,%eax
+  80049e:	7f 41                	jg     8004e1 <sys_page_map+0x76>
+  8004a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004a3:	5b                   	pop    %ebx
+  8004a4:	5e                   	pop    %esi
+  8004a5:	5f                   	pop    %edi
+  8004a6:	5d                   	pop    %ebp
+  8004a7:	c3                   	ret
+  8004a8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004ad:	0f a2                	cpuid
+  8004af:	c1 ea 0b             	shr    $0xb,%edx
+  8004b2:	83 e2 01             	and    $0x1,%edx
+  8004b5:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8004bb:	eb c0                	jmp    80047d <sys_page_map+0x12>
+  8004bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8004c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004cb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004ce:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004d1:	55                   	push   %ebp
+  8004d2:	68 db 04 80 00       	push   $0x8004db
+  8004d7:	89 e5                	mov    %esp,%ebp
+  8004d9:	0f 34                	sysenter
+  8004db:	83 c4 04             	add    $0x4,%esp
+  8004de:	5d                   	pop    %ebp
+  8004df:	eb bb                	jmp    80049c <sys_page_map+0x31>
+  8004e1:	83 ec 0c             	sub    $0xc,%esp
+  8004e4:	50                   	push   %eax
+  8004e5:	6a 05                	push   $0x5
+  8004e7:	68 6a 19 80 00       	push   $0x80196a
+  8004ec:	6a 49                	push   $0x49
+  8004ee:	68 87 19 80 00       	push   $0x801987
+  8004f3:	e8 a9 06 00 00       	call   800ba1 <_panic>
+
+008004f8 <sys_page_unmap>:
+  8004f8:	55                   	push   %ebp
+  8004f9:	89 e5                	mov    %esp,%ebp
+  8004fb:	57                   	push   %edi
+  8004fc:	56                   	push   %esi
+  8004fd:	53                   	push   %ebx
+  8004fe:	83 ec 0c             	sub    $0xc,%esp
+  800501:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800508:	78 2b                	js     800535 <sys_page_unmap+0x3d>
+  80050a:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800511:	75 37                	jne    80054a <sys_page_unmap+0x52>
+  800513:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800518:	b8 06 00 00 00       	mov    $0x6,%eax
+  80051d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800520:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800523:	89 df                	mov    %ebx,%edi
+  800525:	89 de                	mov    %ebx,%esi
+  800527:	cd 30                	int    $0x30
+  800529:	85 c0                	test   %eax,%eax
+  80052b:	7f 41                	jg     80056e <sys_page_unmap+0x76>
+  80052d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800530:	5b                   	pop    %ebx
+  800531:	5e                   	pop    %esi
+  800532:	5f                   	pop    %edi
+  800533:	5d                   	pop    %ebp
+  800534:	c3                   	ret
+  800535:	b8 01 00 00 00       	mov    $0x1,%eax
+  80053a:	0f a2                	cpuid
+  80053c:	c1 ea 0b             	shr    $0xb,%edx
+  80053f:	83 e2 01             	and    $0x1,%edx
+  800542:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800548:	eb c0                	jmp    80050a <sys_page_unmap+0x12>
+  80054a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80054f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800552:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800555:	b8 06 00 00 00       	mov    $0x6,%eax
+  80055a:	89 df                	mov    %ebx,%edi
+  80055c:	89 de                	mov    %ebx,%esi
+  80055e:	55                   	push   %ebp
+  80055f:	68 68 05 80 00       	push   $0x800568
+  800564:	89 e5                	mov    %esp,%ebp
+  800566:	0f 34                	sysenter
+  800568:	83 c4 04             	add    $0x4,%esp
+  80056b:	5d                   	pop    %ebp
+  80056c:	eb bb                	jmp    800529 <sys_page_unmap+0x31>
+  80056e:	83 ec 0c             	sub    $0xc,%esp
+  800571:	50                   	push   %eax
+  800572:	6a 06                	push   $0x6
+  800574:	68 6a 19 80 00       	push   $0x80196a
+  800579:	6a 49                	push   $0x49
+  80057b:	68 87 19 80 00       	push   $0x801987
+  800580:	e8 1c 06 00 00       	call   800ba1 <_panic>
+
+00800585 <sys_page_reuse>:
+  800585:	55                   	push   %ebp
+  800586:	89 e5                	mov    %esp,%ebp
+  800588:	57                   	push   %edi
+  800589:	56                   	push   %esi
+  80058a:	53                   	push   %ebx
+  80058b:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800592:	78 24                	js     8005b8 <sys_page_reuse+0x33>
+  800594:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80059b:	75 30                	jne    8005cd <sys_page_reuse+0x48>
+  80059d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005a2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005ad:	89 df                	mov    %ebx,%edi
+  8005af:	89 de                	mov    %ebx,%esi
+  8005b1:	cd 30                	int    $0x30
+  8005b3:	5b                   	pop    %ebx
+  8005b4:	5e                   	pop    %esi
+  8005b5:	5f                   	pop    %edi
+  8005b6:	5d                   	pop    %ebp
+  8005b7:	c3                   	ret
+  8005b8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005bd:	0f a2                	cpuid
+  8005bf:	c1 ea 0b             	shr    $0xb,%edx
+  8005c2:	83 e2 01             	and    $0x1,%edx
+  8005c5:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8005cb:	eb c7                	jmp    800594 <sys_page_reuse+0xf>
+  8005cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005d8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8005dd:	89 df                	mov    %ebx,%edi
+  8005df:	89 de                	mov    %ebx,%esi
+  8005e1:	55                   	push   %ebp
+  8005e2:	68 eb 05 80 00       	push   $0x8005eb
+  8005e7:	89 e5                	mov    %esp,%ebp
+  8005e9:	0f 34                	sysenter
+  8005eb:	83 c4 04             	add    $0x4,%esp
+  8005ee:	5d                   	pop    %ebp
+  8005ef:	eb c2                	jmp    8005b3 <sys_page_reuse+0x2e>
+
+008005f1 <sys_env_set_status>:
+  8005f1:	55                   	push   %ebp
+  8005f2:	89 e5                	mov    %esp,%ebp
+  8005f4:	57                   	push   %edi
+  8005f5:	56                   	push   %esi
+  8005f6:	53                   	push   %ebx
+  8005f7:	83 ec 0c             	sub    $0xc,%esp
+  8005fa:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800601:	78 2b                	js     80062e <sys_env_set_status+0x3d>
+  800603:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80060a:	75 37                	jne    800643 <sys_env_set_status+0x52>
+  80060c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800611:	b8 08 00 00 00       	mov    $0x8,%eax
+  800616:	8b 55 08             	mov    0x8(%ebp),%edx
+  800619:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80061c:	89 df                	mov    %ebx,%edi
+  80061e:	89 de                	mov    %ebx,%esi
+  800620:	cd 30                	int    $0x30
+  800622:	85 c0                	test   %eax,%eax
+  800624:	7f 41                	jg     800667 <sys_env_set_status+0x76>
+  800626:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800629:	5b                   	pop    %ebx
+  80062a:	5e                   	pop    %esi
+  80062b:	5f                   	pop    %edi
+  80062c:	5d                   	pop    %ebp
+  80062d:	c3                   	ret
+  80062e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800633:	0f a2                	cpuid
+  800635:	c1 ea 0b             	shr    $0xb,%edx
+  800638:	83 e2 01             	and    $0x1,%edx
+  80063b:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800641:	eb c0                	jmp    800603 <sys_env_set_status+0x12>
+  800643:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800648:	8b 55 08             	mov    0x8(%ebp),%edx
+  80064b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80064e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800653:	89 df                	mov    %ebx,%edi
+  800655:	89 de                	mov    %ebx,%esi
+  800657:	55                   	push   %ebp
+  800658:	68 61 06 80 00       	push   $0x800661
+  80065d:	89 e5                	mov    %esp,%ebp
+  80065f:	0f 34                	sysenter
+  800661:	83 c4 04             	add    $0x4,%esp
+  800664:	5d                   	pop    %ebp
+  800665:	eb bb                	jmp    800622 <sys_env_set_status+0x31>
+  800667:	83 ec 0c             	sub    $0xc,%esp
+  80066a:	50                   	push   %eax
+  80066b:	6a 08                	push   $0x8
+  80066d:	68 6a 19 80 00       	push   $0x80196a
+  800672:	6a 49                	push   $0x49
+  800674:	68 87 19 80 00       	push   $0x801987
+  800679:	e8 23 05 00 00       	call   800ba1 <_panic>
+
+0080067e <sys_env_set_pgfault_upcall>:
+  80067e:	55                   	push   %ebp
+  80067f:	89 e5                	mov    %esp,%ebp
+  800681:	57                   	push   %edi
+  800682:	56                   	push   %esi
+  800683:	53                   	push   %ebx
+  800684:	83 ec 0c             	sub    $0xc,%esp
+  800687:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80068e:	78 2b                	js     8006bb <sys_env_set_pgfault_upcall+0x3d>
+  800690:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800697:	75 37                	jne    8006d0 <sys_env_set_pgfault_upcall+0x52>
+  800699:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80069e:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006a9:	89 df                	mov    %ebx,%edi
+  8006ab:	89 de                	mov    %ebx,%esi
+  8006ad:	cd 30                	int    $0x30
+  8006af:	85 c0                	test   %eax,%eax
+  8006b1:	7f 41                	jg     8006f4 <sys_env_set_pgfault_upcall+0x76>
+  8006b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006b6:	5b                   	pop    %ebx
+  8006b7:	5e                   	pop    %esi
+  8006b8:	5f                   	pop    %edi
+  8006b9:	5d                   	pop    %ebp
+  8006ba:	c3                   	ret
+  8006bb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006c0:	0f a2                	cpuid
+  8006c2:	c1 ea 0b             	shr    $0xb,%edx
+  8006c5:	83 e2 01             	and    $0x1,%edx
+  8006c8:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8006ce:	eb c0                	jmp    800690 <sys_env_set_pgfault_upcall+0x12>
+  8006d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006db:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006e0:	89 df                	mov    %ebx,%edi
+  8006e2:	89 de                	mov    %ebx,%esi
+  8006e4:	55                   	push   %ebp
+  8006e5:	68 ee 06 80 00       	push   $0x8006ee
+  8006ea:	89 e5                	mov    %esp,%ebp
+  8006ec:	0f 34                	sysenter
+  8006ee:	83 c4 04             	add    $0x4,%esp
+  8006f1:	5d                   	pop    %ebp
+  8006f2:	eb bb                	jmp    8006af <sys_env_set_pgfault_upcall+0x31>
+  8006f4:	83 ec 0c             	sub    $0xc,%esp
+  8006f7:	50                   	push   %eax
+  8006f8:	6a 09                	push   $0x9
+  8006fa:	68 6a 19 80 00       	push   $0x80196a
+  8006ff:	6a 49                	push   $0x49
+  800701:	68 87 19 80 00       	push   $0x801987
+  800706:	e8 96 04 00 00       	call   800ba1 <_panic>
+
+0080070b <sys_env_set_trace>:
+  80070b:	55                   	push   %ebp
+  80070c:	89 e5                	mov    %esp,%ebp
+  80070e:	57                   	push   %edi
+  80070f:	56                   	push   %esi
+  800710:	53                   	push   %ebx
+  800711:	83 ec 0c             	sub    $0xc,%esp
+  800714:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80071b:	78 2b                	js     800748 <sys_env_set_trace+0x3d>
+  80071d:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800724:	75 37                	jne    80075d <sys_env_set_trace+0x52>
+  800726:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80072b:	b8 12 00 00 00       	mov    $0x12,%eax
+  800730:	8b 55 08             	mov    0x8(%ebp),%edx
+  800733:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800736:	89 df                	mov    %ebx,%edi
+  800738:	89 de                	mov    %ebx,%esi
+  80073a:	cd 30                	int    $0x30
+  80073c:	85 c0                	test   %eax,%eax
+  80073e:	7f 41                	jg     800781 <sys_env_set_trace+0x76>
+  800740:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800743:	5b                   	pop    %ebx
+  800744:	5e                   	pop    %esi
+  800745:	5f                   	pop    %edi
+  800746:	5d                   	pop    %ebp
+  800747:	c3                   	ret
+  800748:	b8 01 00 00 00       	mov    $0x1,%eax
+  80074d:	0f a2                	cpuid
+  80074f:	c1 ea 0b             	shr    $0xb,%edx
+  800752:	83 e2 01             	and    $0x1,%edx
+  800755:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80075b:	eb c0                	jmp    80071d <sys_env_set_trace+0x12>
+  80075d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800762:	8b 55 08             	mov    0x8(%ebp),%edx
+  800765:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800768:	b8 12 00 00 00       	mov    $0x12,%eax
+  80076d:	89 df                	mov    %ebx,%edi
+  80076f:	89 de                	mov    %ebx,%esi
+  800771:	55                   	push   %ebp
+  800772:	68 7b 07 80 00       	push   $0x80077b
+  800777:	89 e5                	mov    %esp,%ebp
+  800779:	0f 34                	sysenter
+  80077b:	83 c4 04             	add    $0x4,%esp
+  80077e:	5d                   	pop    %ebp
+  80077f:	eb bb                	jmp    80073c <sys_env_set_trace+0x31>
+  800781:	83 ec 0c             	sub    $0xc,%esp
+  800784:	50                   	push   %eax
+  800785:	6a 12                	push   $0x12
+  800787:	68 6a 19 80 00       	push   $0x80196a
+  80078c:	6a 49                	push   $0x49
+  80078e:	68 87 19 80 00       	push   $0x801987
+  800793:	e8 09 04 00 00       	call   800ba1 <_panic>
+
+00800798 <sys_env_set_rdpmc>:
+  800798:	55                   	push   %ebp
+  800799:	89 e5                	mov    %esp,%ebp
+  80079b:	57                   	push   %edi
+  80079c:	56                   	push   %esi
+  80079d:	53                   	push   %ebx
+  80079e:	83 ec 0c             	sub    $0xc,%esp
+  8007a1:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007a8:	78 2b                	js     8007d5 <sys_env_set_rdpmc+0x3d>
+  8007aa:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8007b1:	75 37                	jne    8007ea <sys_env_set_rdpmc+0x52>
+  8007b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007b8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8007bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007c3:	89 df                	mov    %ebx,%edi
+  8007c5:	89 de                	mov    %ebx,%esi
+  8007c7:	cd 30                	int    $0x30
+  8007c9:	85 c0                	test   %eax,%eax
+  8007cb:	7f 41                	jg     80080e <sys_env_set_rdpmc+0x76>
+  8007cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007d0:	5b                   	pop    %ebx
+  8007d1:	5e                   	pop    %esi
+  8007d2:	5f                   	pop    %edi
+  8007d3:	5d                   	pop    %ebp
+  8007d4:	c3                   	ret
+  8007d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007da:	0f a2                	cpuid
+  8007dc:	c1 ea 0b             	shr    $0xb,%edx
+  8007df:	83 e2 01             	and    $0x1,%edx
+  8007e2:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8007e8:	eb c0                	jmp    8007aa <sys_env_set_rdpmc+0x12>
+  8007ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f5:	b8 13 00 00 00       	mov    $0x13,%eax
+  8007fa:	89 df                	mov    %ebx,%edi
+  8007fc:	89 de                	mov    %ebx,%esi
+  8007fe:	55                   	push   %ebp
+  8007ff:	68 08 08 80 00       	push   $0x800808
+  800804:	89 e5                	mov    %esp,%ebp
+  800806:	0f 34                	sysenter
+  800808:	83 c4 04             	add    $0x4,%esp
+  80080b:	5d                   	pop    %ebp
+  80080c:	eb bb                	jmp    8007c9 <sys_env_set_rdpmc+0x31>
+  80080e:	83 ec 0c             	sub    $0xc,%esp
+  800811:	50                   	push   %eax
+  800812:	6a 13                	push   $0x13
+  800814:	68 6a 19 80 00       	push   $0x80196a
+  800819:	6a 49                	push   $0x49
+  80081b:	68 87 19 80 00       	push   $0x801987
+  800820:	e8 7c 03 00 00       	call   800ba1 <_panic>
+
+00800825 <sys_ring_setup>:
+  800825:	55                   	push   %ebp
+  800826:	89 e5                	mov    %esp,%ebp
+  800828:	57                   	push   %edi
+  800829:	56                   	push   %esi
+  80082a:	53                   	push   %ebx
+  80082b:	83 ec 0c             	sub    $0xc,%esp
+  80082e:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800835:	78 29                	js     800860 <sys_ring_setup+0x3b>
+  800837:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80083e:	75 35                	jne    800875 <sys_ring_setup+0x50>
+  800840:	ba 00 00 00 00       	mov    $0x0,%edx
+  800845:	b8 10 00 00 00       	mov    $0x10,%eax
+  80084a:	89 d1                	mov    %edx,%ecx
+  80084c:	89 d3                	mov    %edx,%ebx
+  80084e:	89 d7                	mov    %edx,%edi
+  800850:	89 d6                	mov    %edx,%esi
+  800852:	cd 30                	int    $0x30
+  800854:	85 c0                	test   %eax,%eax
+  800856:	7f 3f                	jg     800897 <sys_ring_setup+0x72>
+  800858:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80085b:	5b                   	pop    %ebx
+  80085c:	5e                   	pop    %esi
+  80085d:	5f                   	pop    %edi
+  80085e:	5d                   	pop    %ebp
+  80085f:	c3                   	ret
+  800860:	b8 01 00 00 00       	mov    $0x1,%eax
+  800865:	0f a2                	cpuid
+  800867:	c1 ea 0b             	shr    $0xb,%edx
+  80086a:	83 e2 01             	and    $0x1,%edx
+  80086d:	89 15 04 20 80 00    	mov    %edx,0x802004
+  800873:	eb c2                	jmp    800837 <sys_ring_setup+0x12>
+  800875:	ba 00 00 00 00       	mov    $0x0,%edx
+  80087a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80087f:	89 d1                	mov    %edx,%ecx
+  800881:	89 d3                	mov    %edx,%ebx
+  800883:	89 d7                	mov    %edx,%edi
+  800885:	89 d6                	mov    %edx,%esi
+  800887:	55                   	push   %ebp
+  800888:	68 91 08 80 00       	push   $0x800891
+  80088d:	89 e5                	mov    %esp,%ebp
+  80088f:	0f 34                	sysenter
+  800891:	83 c4 04             	add    $0x4,%esp
+  800894:	5d                   	pop    %ebp
+  800895:	eb bd                	jmp    800854 <sys_ring_setup+0x2f>
+  800897:	83 ec 0c             	sub    $0xc,%esp
+  80089a:	50                   	push   %eax
+  80089b:	6a 10                	push   $0x10
+  80089d:	68 6a 19 80 00       	push   $0x80196a
+  8008a2:	6a 49                	push   $0x49
+  8008a4:	68 87 19 80 00       	push   $0x801987
+  8008a9:	e8 f3 02 00 00       	call   800ba1 <_panic>
+
+008008ae <sys_ring_enter>:
+  8008ae:	55                   	push   %ebp
+  8008af:	89 e5                	mov    %esp,%ebp
+  8008b1:	57                   	push   %edi
+  8008b2:	56                   	push   %esi
+  8008b3:	53                   	push   %ebx
+  8008b4:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008bb:	78 22                	js     8008df <sys_ring_enter+0x31>
+  8008bd:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  8008c4:	75 2e                	jne    8008f4 <sys_ring_enter+0x46>
+  8008c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008cb:	b8 11 00 00 00       	mov    $0x11,%eax
+  8008d0:	89 d1                	mov    %edx,%ecx
+  8008d2:	89 d3                	mov    %edx,%ebx
+  8008d4:	89 d7                	mov    %edx,%edi
+  8008d6:	89 d6                	mov    %edx,%esi
+  8008d8:	cd 30                	int    $0x30
+  8008da:	5b                   	pop    %ebx
+  8008db:	5e                   	pop    %esi
+  8008dc:	5f                   	pop    %edi
+  8008dd:	5d                   	pop    %ebp
+  8008de:	c3                   	ret
+  8008df:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008e4:	0f a2                	cpuid
+  8008e6:	c1 ea 0b             	shr    $0xb,%edx
+  8008e9:	83 e2 01             	and    $0x1,%edx
+  8008ec:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8008f2:	eb c9                	jmp    8008bd <sys_ring_enter+0xf>
+  8008f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008f9:	b8 11 00 00 00       	mov    $0x11,%eax
+  8008fe:	89 d1                	mov    %edx,%ecx
+  800900:	89 d3                	mov    %edx,%ebx
+  800902:	89 d7                	mov    %edx,%edi
+  800904:	89 d6                	mov    %edx,%esi
+  800906:	55                   	push   %ebp
+  800907:	68 10 09 80 00       	push   $0x800910
+  80090c:	89 e5                	mov    %esp,%ebp
+  80090e:	0f 34                	sysenter
+  800910:	83 c4 04             	add    $0x4,%esp
+  800913:	5d                   	pop    %ebp
+  800914:	eb c4                	jmp    8008da <sys_ring_enter+0x2c>
+
+00800916 <sys_ipc_try_send>:
+  800916:	55                   	push   %ebp
+  800917:	89 e5                	mov    %esp,%ebp
+  800919:	57                   	push   %edi
+  80091a:	56                   	push   %esi
+  80091b:	53                   	push   %ebx
+  80091c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800923:	78 26                	js     80094b <sys_ipc_try_send+0x35>
+  800925:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80092c:	75 32                	jne    800960 <sys_ipc_try_send+0x4a>
+  80092e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800933:	be 00 00 00 00       	mov    $0x0,%esi
+  800938:	8b 55 08             	mov    0x8(%ebp),%edx
+  80093b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80093e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800941:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800944:	cd 30                	int    $0x30
+  800946:	5b                   	pop    %ebx
+  800947:	5e                   	pop    %esi
+  800948:	5f                   	pop    %edi
+  800949:	5d                   	pop    %ebp
+  80094a:	c3                   	ret
+  80094b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800950:	0f a2                	cpuid
+  800952:	c1 ea 0b             	shr    $0xb,%edx
+  800955:	83 e2 01             	and    $0x1,%edx
+  800958:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80095e:	eb c5                	jmp    800925 <sys_ipc_try_send+0xf>
+  800960:	8b 55 08             	mov    0x8(%ebp),%edx
+  800963:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800966:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80096b:	be 00 00 00 00       	mov    $0x0,%esi
+  800970:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800973:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800976:	55                   	push   %ebp
+  800977:	68 80 09 80 00       	push   $0x800980
+  80097c:	89 e5                	mov    %esp,%ebp
+  80097e:	0f 34                	sysenter
+  800980:	83 c4 04             	add    $0x4,%esp
+  800983:	5d                   	pop    %ebp
+  800984:	eb c0                	jmp    800946 <sys_ipc_try_send+0x30>
+
+00800986 <sys_ipc_recv>:
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	57                   	push   %edi
+  80098a:	56                   	push   %esi
+  80098b:	53                   	push   %ebx
+  80098c:	83 ec 0c             	sub    $0xc,%esp
+  80098f:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800996:	78 2a                	js     8009c2 <sys_ipc_recv+0x3c>
+  800998:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  80099f:	75 36                	jne    8009d7 <sys_ipc_recv+0x51>
+  8009a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009a6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009ae:	89 cb                	mov    %ecx,%ebx
+  8009b0:	89 cf                	mov    %ecx,%edi
+  8009b2:	89 ce                	mov    %ecx,%esi
+  8009b4:	cd 30                	int    $0x30
+  8009b6:	85 c0                	test   %eax,%eax
+  8009b8:	7f 40                	jg     8009fa <sys_ipc_recv+0x74>
+  8009ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009bd:	5b                   	pop    %ebx
+  8009be:	5e                   	pop    %esi
+  8009bf:	5f                   	pop    %edi
+  8009c0:	5d                   	pop    %ebp
+  8009c1:	c3                   	ret
+  8009c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8009c7:	0f a2                	cpuid
+  8009c9:	c1 ea 0b             	shr    $0xb,%edx
+  8009cc:	83 e2 01             	and    $0x1,%edx
+  8009cf:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8009d5:	eb c1                	jmp    800998 <sys_ipc_recv+0x12>
+  8009d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009df:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8009e4:	89 cb                	mov    %ecx,%ebx
+  8009e6:	89 cf                	mov    %ecx,%edi
+  8009e8:	89 ce                	mov    %ecx,%esi
+  8009ea:	55                   	push   %ebp
+  8009eb:	68 f4 09 80 00       	push   $0x8009f4
+  8009f0:	89 e5                	mov    %esp,%ebp
+  8009f2:	0f 34                	sysenter
+  8009f4:	83 c4 04             	add    $0x4,%esp
+  8009f7:	5d                   	pop    %ebp
+  8009f8:	eb bc                	jmp    8009b6 <sys_ipc_recv+0x30>
+  8009fa:	83 ec 0c             	sub    $0xc,%esp
+  8009fd:	50                   	push   %eax
+  8009fe:	6a 0c                	push   $0xc
+  800a00:	68 6a 19 80 00       	push   $0x80196a
+  800a05:	6a 49                	push   $0x49
+  800a07:	68 87 19 80 00       	push   $0x801987
+  800a0c:	e8 90 01 00 00       	call   800ba1 <_panic>
+
+00800a11 <uinfo_envid>:
+  800a11:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  800a16:	c3                   	ret
+
+00800a17 <uinfo_cpunum>:
+  800a17:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  800a1c:	c3                   	ret
+
+00800a1d <uinfo_ticks>:
+  800a1d:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  800a22:	c3                   	ret
+
+00800a23 <uinfo_nsec>:
+  800a23:	55                   	push   %ebp
+  800a24:	89 e5                	mov    %esp,%ebp
+  800a26:	57                   	push   %edi
+  800a27:	56                   	push   %esi
+  800a28:	53                   	push   %ebx
+  800a29:	83 ec 1c             	sub    $0x1c,%esp
+  800a2c:	0f 31                	rdtsc
+  800a2e:	89 c6                	mov    %eax,%esi
+  800a30:	89 d7                	mov    %edx,%edi
+  800a32:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  800a38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a42:	85 c9                	test   %ecx,%ecx
+  800a44:	74 5c                	je     800aa2 <uinfo_nsec+0x7f>
+  800a46:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a4b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800a4e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800a51:	52                   	push   %edx
+  800a52:	51                   	push   %ecx
+  800a53:	57                   	push   %edi
+  800a54:	56                   	push   %esi
+  800a55:	e8 63 0d 00 00       	call   8017bd <__umoddi3>
+  800a5a:	83 c4 10             	add    $0x10,%esp
+  800a5d:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800a63:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  800a68:	f7 e3                	mul    %ebx
+  800a6a:	01 ca                	add    %ecx,%edx
+  800a6c:	ff 75 e4             	push   -0x1c(%ebp)
+  800a6f:	ff 75 e0             	push   -0x20(%ebp)
+  800a72:	52                   	push   %edx
+  800a73:	50                   	push   %eax
+  800a74:	e8 6c 0c 00 00       	call   8016e5 <__udivdi3>
+  800a79:	83 c4 10             	add    $0x10,%esp
+  800a7c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a7f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a82:	ff 75 e4             	push   -0x1c(%ebp)
+  800a85:	ff 75 e0             	push   -0x20(%ebp)
+  800a88:	57                   	push   %edi
+  800a89:	56                   	push   %esi
+  800a8a:	e8 56 0c 00 00       	call   8016e5 <__udivdi3>
+  800a8f:	83 c4 10             	add    $0x10,%esp
+  800a92:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  800a98:	f7 e3                	mul    %ebx
+  800a9a:	01 ca                	add    %ecx,%edx
+  800a9c:	03 45 d8             	add    -0x28(%ebp),%eax
+  800a9f:	13 55 dc             	adc    -0x24(%ebp),%edx
+  800aa2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aa5:	5b                   	pop    %ebx
+  800aa6:	5e                   	pop    %esi
+  800aa7:	5f                   	pop    %edi
+  800aa8:	5d                   	pop    %ebp
+  800aa9:	c3                   	ret
+
+00800aaa <bflush>:
+  800aaa:	a1 40 20 80 00       	mov    0x802040,%eax
+  800aaf:	85 c0                	test   %eax,%eax
+  800ab1:	75 01                	jne    800ab4 <bflush+0xa>
+  800ab3:	c3                   	ret
+  800ab4:	55                   	push   %ebp
+  800ab5:	89 e5                	mov    %esp,%ebp
+  800ab7:	83 ec 10             	sub    $0x10,%esp
+  800aba:	50                   	push   %eax
+  800abb:	68 44 20 80 00       	push   $0x802044
+  800ac0:	e8 d4 f5 ff ff       	call   800099 <sys_cputs>
+  800ac5:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  800acc:	00 00 00 
+  800acf:	83 c4 10             	add    $0x10,%esp
+  800ad2:	c9                   	leave
+  800ad3:	c3                   	ret
+
+00800ad4 <bputch>:
+  800ad4:	55                   	push   %ebp
+  800ad5:	89 e5                	mov    %esp,%ebp
+  800ad7:	53                   	push   %ebx
+  800ad8:	83 ec 04             	sub    $0x4,%esp
+  800adb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ade:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  800ae4:	8d 42 01             	lea    0x1(%edx),%eax
+  800ae7:	a3 40 20 80 00       	mov    %eax,0x802040
+  800aec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aef:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  800af5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800afa:	77 08                	ja     800b04 <bputch+0x30>
+  800afc:	83 03 01             	addl   $0x1,(%ebx)
+  800aff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b02:	c9                   	leave
+  800b03:	c3                   	ret
+  800b04:	e8 a1 ff ff ff       	call   800aaa <bflush>
+  800b09:	eb f1                	jmp    800afc <bputch+0x28>
+
+00800b0b <vbprintf>:
+  800b0b:	55                   	push   %ebp
+  800b0c:	89 e5                	mov    %esp,%ebp
+  800b0e:	83 ec 18             	sub    $0x18,%esp
+  800b11:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800b18:	ff 75 0c             	push   0xc(%ebp)
+  800b1b:	ff 75 08             	push   0x8(%ebp)
+  800b1e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b21:	50                   	push   %eax
+  800b22:	68 d4 0a 80 00       	push   $0x800ad4
+  800b27:	e8 4c 02 00 00       	call   800d78 <vprintfmt>
+  800b2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b2f:	c9                   	leave
+  800b30:	c3                   	ret
+
+00800b31 <bprintf>:
+  800b31:	55                   	push   %ebp
+  800b32:	89 e5                	mov    %esp,%ebp
+  800b34:	83 ec 10             	sub    $0x10,%esp
+  800b37:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800b3a:	50                   	push   %eax
+  800b3b:	ff 75 08             	push   0x8(%ebp)
+  800b3e:	e8 c8 ff ff ff       	call   800b0b <vbprintf>
+  800b43:	c9                   	leave
+  800b44:	c3                   	ret
+
+00800b45 <bwrite>:
+  800b45:	55                   	push   %ebp
+  800b46:	89 e5                	mov    %esp,%ebp
+  800b48:	53                   	push   %ebx
+  800b49:	83 ec 04             	sub    $0x4,%esp
+  800b4c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b4f:	89 d8                	mov    %ebx,%eax
+  800b51:	03 05 40 20 80 00    	add    0x802040,%eax
+  800b57:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b5c:	76 0d                	jbe    800b6b <bwrite+0x26>
+  800b5e:	e8 47 ff ff ff       	call   800aaa <bflush>
+  800b63:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  800b69:	77 25                	ja     800b90 <bwrite+0x4b>
+  800b6b:	83 ec 04             	sub    $0x4,%esp
+  800b6e:	53                   	push   %ebx
+  800b6f:	ff 75 08             	push   0x8(%ebp)
+  800b72:	a1 40 20 80 00       	mov    0x802040,%eax
+  800b77:	05 44 20 80 00       	add    $0x802044,%eax
+  800b7c:	50                   	push   %eax
+  800b7d:	e8 61 09 00 00       	call   8014e3 <memcpy>
+  800b82:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  800b88:	83 c4 10             	add    $0x10,%esp
+  800b8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b8e:	c9                   	leave
+  800b8f:	c3                   	ret
+  800b90:	83 ec 08             	sub    $0x8,%esp
+  800b93:	53                   	push   %ebx
+  800b94:	ff 75 08             	push   0x8(%ebp)
+  800b97:	e8 fd f4 ff ff       	call   800099 <sys_cputs>
+  800b9c:	83 c4 10             	add    $0x10,%esp
+  800b9f:	eb ea                	jmp    800b8b <bwrite+0x46>
+
+00800ba1 <_panic>:
+  800ba1:	55                   	push   %ebp
+  800ba2:	89 e5                	mov    %esp,%ebp
+  800ba4:	56                   	push   %esi
+  800ba5:	53                   	push   %ebx
+  800ba6:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800ba9:	e8 fc fe ff ff       	call   800aaa <bflush>
+  800bae:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  800bb4:	e8 39 f6 ff ff       	call   8001f2 <sys_getenvid>
+  800bb9:	83 ec 0c             	sub    $0xc,%esp
+  800bbc:	ff 75 0c             	push   0xc(%ebp)
+  800bbf:	ff 75 08             	push   0x8(%ebp)
+  800bc2:	56                   	push   %esi
+  800bc3:	50                   	push   %eax
+  800bc4:	68 98 19 80 00       	push   $0x801998
+  800bc9:	e8 b3 00 00 00       	call   800c81 <cprintf>
+  800bce:	83 c4 18             	add    $0x18,%esp
+  800bd1:	53                   	push   %ebx
+  800bd2:	ff 75 10             	push   0x10(%ebp)
+  800bd5:	e8 56 00 00 00       	call   800c30 <vcprintf>
+  800bda:	c7 04 24 bb 19 80 00 	movl   $0x8019bb,(%esp)
+  800be1:	e8 9b 00 00 00       	call   800c81 <cprintf>
+  800be6:	83 c4 10             	add    $0x10,%esp
+  800be9:	cc                   	int3
+  800bea:	eb fd                	jmp    800be9 <_panic+0x48>
+
+00800bec <putch>:
+  800bec:	55                   	push   %ebp
+  800bed:	89 e5                	mov    %esp,%ebp
+  800bef:	53                   	push   %ebx
+  800bf0:	83 ec 04             	sub    $0x4,%esp
+  800bf3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800bf6:	8b 13                	mov    (%ebx),%edx
+  800bf8:	8d 42 01             	lea    0x1(%edx),%eax
+  800bfb:	89 03                	mov    %eax,(%ebx)
+  800bfd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c00:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800c04:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800c09:	74 09                	je     800c14 <putch+0x28>
+  800c0b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800c0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c12:	c9                   	leave
+  800c13:	c3                   	ret
+  800c14:	83 ec 08             	sub    $0x8,%esp
+  800c17:	68 ff 00 00 00       	push   $0xff
+  800c1c:	8d 43 08             	lea    0x8(%ebx),%eax
+  800c1f:	50                   	push   %eax
+  800c20:	e8 74 f4 ff ff       	call   800099 <sys_cputs>
+  800c25:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800c2b:	83 c4 10             	add    $0x10,%esp
+  800c2e:	eb db                	jmp    800c0b <putch+0x1f>
+
+00800c30 <vcprintf>:
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800c39:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800c40:	00 00 00 
+  800c43:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800c4a:	00 00 00 
+  800c4d:	ff 75 0c             	push   0xc(%ebp)
+  800c50:	ff 75 08             	push   0x8(%ebp)
+  800c53:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800c59:	50                   	push   %eax
+  800c5a:	68 ec 0b 80 00       	push   $0x800bec
+  800c5f:	e8 14 01 00 00       	call   800d78 <vprintfmt>
+  800c64:	83 c4 08             	add    $0x8,%esp
+  800c67:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800c6d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800c73:	50                   	push   %eax
+  800c74:	e8 20 f4 ff ff       	call   800099 <sys_cputs>
+  800c79:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800c7f:	c9                   	leave
+  800c80:	c3                   	ret
+
+00800c81 <cprintf>:
+  800c81:	55                   	push   %ebp
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	83 ec 10             	sub    $0x10,%esp
+  800c87:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800c8a:	50                   	push   %eax
+  800c8b:	ff 75 08             	push   0x8(%ebp)
+  800c8e:	e8 9d ff ff ff       	call   800c30 <vcprintf>
+  800c93:	c9                   	leave
+  800c94:	c3                   	ret
+
+00800c95 <printnum>:
+  800c95:	55                   	push   %ebp
+  800c96:	89 e5                	mov    %esp,%ebp
+  800c98:	57                   	push   %edi
+  800c99:	56                   	push   %esi
+  800c9a:	53                   	push   %ebx
+  800c9b:	83 ec 1c             	sub    $0x1c,%esp
+  800c9e:	89 c7                	mov    %eax,%edi
+  800ca0:	89 d6                	mov    %edx,%esi
+  800ca2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ca8:	89 d1                	mov    %edx,%ecx
+  800caa:	89 c2                	mov    %eax,%edx
+  800cac:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800caf:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800cb2:	8b 45 10             	mov    0x10(%ebp),%eax
+  800cb5:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800cb8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800cbb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800cc2:	39 c2                	cmp    %eax,%edx
+  800cc4:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800cc7:	72 3e                	jb     800d07 <printnum+0x72>
+  800cc9:	83 ec 0c             	sub    $0xc,%esp
+  800ccc:	ff 75 18             	push   0x18(%ebp)
+  800ccf:	83 eb 01             	sub    $0x1,%ebx
+  800cd2:	53                   	push   %ebx
+  800cd3:	50                   	push   %eax
+  800cd4:	83 ec 08             	sub    $0x8,%esp
+  800cd7:	ff 75 e4             	push   -0x1c(%ebp)
+  800cda:	ff 75 e0             	push   -0x20(%ebp)
+  800cdd:	ff 75 dc             	push   -0x24(%ebp)
+  800ce0:	ff 75 d8             	push   -0x28(%ebp)
+  800ce3:	e8 fd 09 00 00       	call   8016e5 <__udivdi3>
+  800ce8:	83 c4 18             	add    $0x18,%esp
+  800ceb:	52                   	push   %edx
+  800cec:	50                   	push   %eax
+  800ced:	89 f2                	mov    %esi,%edx
+  800cef:	89 f8                	mov    %edi,%eax
+  800cf1:	e8 9f ff ff ff       	call   800c95 <printnum>
+  800cf6:	83 c4 20             	add    $0x20,%esp
+  800cf9:	eb 13                	jmp    800d0e <printnum+0x79>
+  800cfb:	83 ec 08             	sub    $0x8,%esp
+  800cfe:	56                   	push   %esi
+  800cff:	ff 75 18             	push   0x18(%ebp)
+  800d02:	ff d7                	call   *%edi
+  800d04:	83 c4 10             	add    $0x10,%esp
+  800d07:	83 eb 01             	sub    $0x1,%ebx
+  800d0a:	85 db                	test   %ebx,%ebx
+  800d0c:	7f ed                	jg     800cfb <printnum+0x66>
+  800d0e:	83 ec 08             	sub    $0x8,%esp
+  800d11:	56                   	push   %esi
+  800d12:	83 ec 04             	sub    $0x4,%esp
+  800d15:	ff 75 e4             	push   -0x1c(%ebp)
+  800d18:	ff 75 e0             	push   -0x20(%ebp)
+  800d1b:	ff 75 dc             	push   -0x24(%ebp)
+  800d1e:	ff 75 d8             	push   -0x28(%ebp)
+  800d21:	e8 97 0a 00 00       	call   8017bd <__umoddi3>
+  800d26:	83 c4 14             	add    $0x14,%esp
+  800d29:	0f be 80 bd 19 80 00 	movsbl 0x8019bd(%eax),%eax
+  800d30:	50                   	push   %eax
+  800d31:	ff d7                	call   *%edi
+  800d33:	83 c4 10             	add    $0x10,%esp
+  800d36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d39:	5b                   	pop    %ebx
+  800d3a:	5e                   	pop    %esi
+  800d3b:	5f                   	pop    %edi
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	c3                   	ret
+
+00800d3e <sprintputch>:
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d44:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800d48:	8b 10                	mov    (%eax),%edx
+  800d4a:	3b 50 04             	cmp    0x4(%eax),%edx
+  800d4d:	73 0a                	jae    800d59 <sprintputch+0x1b>
+  800d4f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800d52:	89 08                	mov    %ecx,(%eax)
+  800d54:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d57:	88 02                	mov    %al,(%edx)
+  800d59:	5d                   	pop    %ebp
+  800d5a:	c3                   	ret
+
+00800d5b <printfmt>:
+  800d5b:	55                   	push   %ebp
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	83 ec 08             	sub    $0x8,%esp
+  800d61:	8d 45 14             	lea    0x14(%ebp),%eax
+  800d64:	50                   	push   %eax
+  800d65:	ff 75 10             	push   0x10(%ebp)
+  800d68:	ff 75 0c             	push   0xc(%ebp)
+  800d6b:	ff 75 08             	push   0x8(%ebp)
+  800d6e:	e8 05 00 00 00       	call   800d78 <vprintfmt>
+  800d73:	83 c4 10             	add    $0x10,%esp
+  800d76:	c9                   	leave
+  800d77:	c3                   	ret
+
+00800d78 <vprintfmt>:
+  800d78:	55                   	push   %ebp
+  800d79:	89 e5                	mov    %esp,%ebp
+  800d7b:	57                   	push   %edi
+  800d7c:	56                   	push   %esi
+  800d7d:	53                   	push   %ebx
+  800d7e:	83 ec 2c             	sub    $0x2c,%esp
+  800d81:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d84:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d87:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d8a:	eb 0a                	jmp    800d96 <vprintfmt+0x1e>
+  800d8c:	83 ec 08             	sub    $0x8,%esp
+  800d8f:	53                   	push   %ebx
+  800d90:	50                   	push   %eax
+  800d91:	ff d6                	call   *%esi
+  800d93:	83 c4 10             	add    $0x10,%esp
+  800d96:	83 c7 01             	add    $0x1,%edi
+  800d99:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800d9d:	83 f8 25             	cmp    $0x25,%eax
+  800da0:	74 0c                	je     800dae <vprintfmt+0x36>
+  800da2:	85 c0                	test   %eax,%eax
+  800da4:	75 e6                	jne    800d8c <vprintfmt+0x14>
+  800da6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da9:	5b                   	pop    %ebx
+  800daa:	5e                   	pop    %esi
+  800dab:	5f                   	pop    %edi
+  800dac:	5d                   	pop    %ebp
+  800dad:	c3                   	ret
+  800dae:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800db2:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800db9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800dc0:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800dc7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dcc:	8d 47 01             	lea    0x1(%edi),%eax
+  800dcf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800dd2:	0f b6 17             	movzbl (%edi),%edx
+  800dd5:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800dd8:	3c 55                	cmp    $0x55,%al
+  800dda:	0f 87 cf 03 00 00    	ja     8011af <vprintfmt+0x437>
+  800de0:	0f b6 c0             	movzbl %al,%eax
+  800de3:	ff 24 85 80 1a 80 00 	jmp    *0x801a80(,%eax,4)
+  800dea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800ded:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800df1:	eb d9                	jmp    800dcc <vprintfmt+0x54>
+  800df3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800df6:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800dfa:	eb d0                	jmp    800dcc <vprintfmt+0x54>
+  800dfc:	0f b6 d2             	movzbl %dl,%edx
+  800dff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e07:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e0a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800e0d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800e11:	0f be 17             	movsbl (%edi),%edx
+  800e14:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800e17:	83 f9 09             	cmp    $0x9,%ecx
+  800e1a:	77 55                	ja     800e71 <vprintfmt+0xf9>
+  800e1c:	83 c7 01             	add    $0x1,%edi
+  800e1f:	eb e9                	jmp    800e0a <vprintfmt+0x92>
+  800e21:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e24:	8b 00                	mov    (%eax),%eax
+  800e26:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e29:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e2c:	8d 40 04             	lea    0x4(%eax),%eax
+  800e2f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e32:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e35:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800e39:	79 91                	jns    800dcc <vprintfmt+0x54>
+  800e3b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800e3e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e41:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800e48:	eb 82                	jmp    800dcc <vprintfmt+0x54>
+  800e4a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e4d:	85 d2                	test   %edx,%edx
+  800e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e54:	0f 49 c2             	cmovns %edx,%eax
+  800e57:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e5a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e5d:	e9 6a ff ff ff       	jmp    800dcc <vprintfmt+0x54>
+  800e62:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e65:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800e6c:	e9 5b ff ff ff       	jmp    800dcc <vprintfmt+0x54>
+  800e71:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e74:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e77:	eb bc                	jmp    800e35 <vprintfmt+0xbd>
+  800e79:	83 c1 01             	add    $0x1,%ecx
+  800e7c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e7f:	e9 48 ff ff ff       	jmp    800dcc <vprintfmt+0x54>
+  800e84:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e87:	8d 78 04             	lea    0x4(%eax),%edi
+  800e8a:	83 ec 08             	sub    $0x8,%esp
+  800e8d:	53                   	push   %ebx
+  800e8e:	ff 30                	push   (%eax)
+  800e90:	ff d6                	call   *%esi
+  800e92:	83 c4 10             	add    $0x10,%esp
+  800e95:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800e98:	e9 b1 02 00 00       	jmp    80114e <vprintfmt+0x3d6>
+  800e9d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ea0:	8d 78 04             	lea    0x4(%eax),%edi
+  800ea3:	8b 10                	mov    (%eax),%edx
+  800ea5:	89 d0                	mov    %edx,%eax
+  800ea7:	f7 d8                	neg    %eax
+  800ea9:	0f 48 c2             	cmovs  %edx,%eax
+  800eac:	83 f8 08             	cmp    $0x8,%eax
+  800eaf:	7f 23                	jg     800ed4 <vprintfmt+0x15c>
+  800eb1:	8b 14 85 e0 1b 80 00 	mov    0x801be0(,%eax,4),%edx
+  800eb8:	85 d2                	test   %edx,%edx
+  800eba:	74 18                	je     800ed4 <vprintfmt+0x15c>
+  800ebc:	52                   	push   %edx
+  800ebd:	68 de 19 80 00       	push   $0x8019de
+  800ec2:	53                   	push   %ebx
+  800ec3:	56                   	push   %esi
+  800ec4:	e8 92 fe ff ff       	call   800d5b <printfmt>
+  800ec9:	83 c4 10             	add    $0x10,%esp
+  800ecc:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800ecf:	e9 7a 02 00 00       	jmp    80114e <vprintfmt+0x3d6>
+  800ed4:	50                   	push   %eax
+  800ed5:	68 d5 19 80 00       	push   $0x8019d5
+  800eda:	53                   	push   %ebx
+  800edb:	56                   	push   %esi
+  800edc:	e8 7a fe ff ff       	call   800d5b <printfmt>
+  800ee1:	83 c4 10             	add    $0x10,%esp
+  800ee4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800ee7:	e9 62 02 00 00       	jmp    80114e <vprintfmt+0x3d6>
+  800eec:	8b 45 14             	mov    0x14(%ebp),%eax
+  800eef:	83 c0 04             	add    $0x4,%eax
+  800ef2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800ef5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ef8:	8b 08                	mov    (%eax),%ecx
+  800efa:	85 c9                	test   %ecx,%ecx
+  800efc:	b8 ce 19 80 00       	mov    $0x8019ce,%eax
+  800f01:	0f 45 c1             	cmovne %ecx,%eax
+  800f04:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800f07:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800f0b:	7e 06                	jle    800f13 <vprintfmt+0x19b>
+  800f0d:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800f11:	75 0b                	jne    800f1e <vprintfmt+0x1a6>
+  800f13:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800f16:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800f19:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f1c:	eb 5c                	jmp    800f7a <vprintfmt+0x202>
+  800f1e:	83 ec 08             	sub    $0x8,%esp
+  800f21:	ff 75 d0             	push   -0x30(%ebp)
+  800f24:	ff 75 cc             	push   -0x34(%ebp)
+  800f27:	e8 87 03 00 00       	call   8012b3 <strnlen>
+  800f2c:	89 c2                	mov    %eax,%edx
+  800f2e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f31:	29 d0                	sub    %edx,%eax
+  800f33:	83 c4 10             	add    $0x10,%esp
+  800f36:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800f3a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f3d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f40:	89 c6                	mov    %eax,%esi
+  800f42:	eb 0e                	jmp    800f52 <vprintfmt+0x1da>
+  800f44:	83 ec 08             	sub    $0x8,%esp
+  800f47:	53                   	push   %ebx
+  800f48:	57                   	push   %edi
+  800f49:	ff 55 08             	call   *0x8(%ebp)
+  800f4c:	83 ee 01             	sub    $0x1,%esi
+  800f4f:	83 c4 10             	add    $0x10,%esp
+  800f52:	85 f6                	test   %esi,%esi
+  800f54:	7f ee                	jg     800f44 <vprintfmt+0x1cc>
+  800f56:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f59:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f5c:	85 c0                	test   %eax,%eax
+  800f5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f63:	0f 49 d0             	cmovns %eax,%edx
+  800f66:	29 d0                	sub    %edx,%eax
+  800f68:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f6b:	eb a6                	jmp    800f13 <vprintfmt+0x19b>
+  800f6d:	83 ec 08             	sub    $0x8,%esp
+  800f70:	53                   	push   %ebx
+  800f71:	52                   	push   %edx
+  800f72:	ff 55 08             	call   *0x8(%ebp)
+  800f75:	83 c4 10             	add    $0x10,%esp
+  800f78:	89 f1                	mov    %esi,%ecx
+  800f7a:	8d 71 01             	lea    0x1(%ecx),%esi
+  800f7d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800f81:	0f be d0             	movsbl %al,%edx
+  800f84:	85 d2                	test   %edx,%edx
+  800f86:	74 28                	je     800fb0 <vprintfmt+0x238>
+  800f88:	85 ff                	test   %edi,%edi
+  800f8a:	78 05                	js     800f91 <vprintfmt+0x219>
+  800f8c:	83 ef 01             	sub    $0x1,%edi
+  800f8f:	78 30                	js     800fc1 <vprintfmt+0x249>
+  800f91:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800f95:	74 d6                	je     800f6d <vprintfmt+0x1f5>
+  800f97:	0f be c0             	movsbl %al,%eax
+  800f9a:	83 e8 20             	sub    $0x20,%eax
+  800f9d:	83 f8 5e             	cmp    $0x5e,%eax
+  800fa0:	76 cb                	jbe    800f6d <vprintfmt+0x1f5>
+  800fa2:	83 ec 08             	sub    $0x8,%esp
+  800fa5:	53                   	push   %ebx
+  800fa6:	6a 3f                	push   $0x3f
+  800fa8:	ff 55 08             	call   *0x8(%ebp)
+  800fab:	83 c4 10             	add    $0x10,%esp
+  800fae:	eb c8                	jmp    800f78 <vprintfmt+0x200>
+  800fb0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fb3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800fb6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800fb9:	01 d0                	add    %edx,%eax
+  800fbb:	29 c8                	sub    %ecx,%eax
+  800fbd:	89 c7                	mov    %eax,%edi
+  800fbf:	eb 13                	jmp    800fd4 <vprintfmt+0x25c>
+  800fc1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fc4:	eb ed                	jmp    800fb3 <vprintfmt+0x23b>
+  800fc6:	83 ec 08             	sub    $0x8,%esp
+  800fc9:	53                   	push   %ebx
+  800fca:	6a 20                	push   $0x20
+  800fcc:	ff d6                	call   *%esi
+  800fce:	83 ef 01             	sub    $0x1,%edi
+  800fd1:	83 c4 10             	add    $0x10,%esp
+  800fd4:	85 ff                	test   %edi,%edi
+  800fd6:	7f ee                	jg     800fc6 <vprintfmt+0x24e>
+  800fd8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800fdb:	89 45 14             	mov    %eax,0x14(%ebp)
+  800fde:	e9 6b 01 00 00       	jmp    80114e <vprintfmt+0x3d6>
+  800fe3:	83 f9 01             	cmp    $0x1,%ecx
+  800fe6:	7f 1f                	jg     801007 <vprintfmt+0x28f>
+  800fe8:	85 c9                	test   %ecx,%ecx
+  800fea:	74 67                	je     801053 <vprintfmt+0x2db>
+  800fec:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fef:	8b 00                	mov    (%eax),%eax
+  800ff1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ff4:	89 c1                	mov    %eax,%ecx
+  800ff6:	c1 f9 1f             	sar    $0x1f,%ecx
+  800ff9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ffc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fff:	8d 40 04             	lea    0x4(%eax),%eax
+  801002:	89 45 14             	mov    %eax,0x14(%ebp)
+  801005:	eb 17                	jmp    80101e <vprintfmt+0x2a6>
+  801007:	8b 45 14             	mov    0x14(%ebp),%eax
+  80100a:	8b 50 04             	mov    0x4(%eax),%edx
+  80100d:	8b 00                	mov    (%eax),%eax
+  80100f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801012:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801015:	8b 45 14             	mov    0x14(%ebp),%eax
+  801018:	8d 40 08             	lea    0x8(%eax),%eax
+  80101b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80101e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801021:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801024:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801029:	85 c9                	test   %ecx,%ecx
+  80102b:	0f 89 03 01 00 00    	jns    801134 <vprintfmt+0x3bc>
+  801031:	83 ec 08             	sub    $0x8,%esp
+  801034:	53                   	push   %ebx
+  801035:	6a 2d                	push   $0x2d
+  801037:	ff d6                	call   *%esi
+  801039:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80103c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80103f:	f7 da                	neg    %edx
+  801041:	83 d1 00             	adc    $0x0,%ecx
+  801044:	f7 d9                	neg    %ecx
+  801046:	83 c4 10             	add    $0x10,%esp
+  801049:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80104e:	e9 e1 00 00 00       	jmp    801134 <vprintfmt+0x3bc>
+  801053:	8b 45 14             	mov    0x14(%ebp),%eax
+  801056:	8b 00                	mov    (%eax),%eax
+  801058:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80105b:	89 c1                	mov    %eax,%ecx
+  80105d:	c1 f9 1f             	sar    $0x1f,%ecx
+  801060:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801063:	8b 45 14             	mov    0x14(%ebp),%eax
+  801066:	8d 40 04             	lea    0x4(%eax),%eax
+  801069:	89 45 14             	mov    %eax,0x14(%ebp)
+  80106c:	eb b0                	jmp    80101e <vprintfmt+0x2a6>
+  80106e:	83 f9 01             	cmp    $0x1,%ecx
+  801071:	7f 1e                	jg     801091 <vprintfmt+0x319>
+  801073:	85 c9                	test   %ecx,%ecx
+  801075:	74 32                	je     8010a9 <vprintfmt+0x331>
+  801077:	8b 45 14             	mov    0x14(%ebp),%eax
+  80107a:	8b 10                	mov    (%eax),%edx
+  80107c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801081:	8d 40 04             	lea    0x4(%eax),%eax
+  801084:	89 45 14             	mov    %eax,0x14(%ebp)
+  801087:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80108c:	e9 a3 00 00 00       	jmp    801134 <vprintfmt+0x3bc>
+  801091:	8b 45 14             	mov    0x14(%ebp),%eax
+  801094:	8b 10                	mov    (%eax),%edx
+  801096:	8b 48 04             	mov    0x4(%eax),%ecx
+  801099:	8d 40 08             	lea    0x8(%eax),%eax
+  80109c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80109f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010a4:	e9 8b 00 00 00       	jmp    801134 <vprintfmt+0x3bc>
+  8010a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010ac:	8b 10                	mov    (%eax),%edx
+  8010ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8010b6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010b9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010be:	eb 74                	jmp    801134 <vprintfmt+0x3bc>
+  8010c0:	83 f9 01             	cmp    $0x1,%ecx
+  8010c3:	7f 1b                	jg     8010e0 <vprintfmt+0x368>
+  8010c5:	85 c9                	test   %ecx,%ecx
+  8010c7:	74 2c                	je     8010f5 <vprintfmt+0x37d>
+  8010c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010cc:	8b 10                	mov    (%eax),%edx
+  8010ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8010d6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010d9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8010de:	eb 54                	jmp    801134 <vprintfmt+0x3bc>
+  8010e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010e3:	8b 10                	mov    (%eax),%edx
+  8010e5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8010e8:	8d 40 08             	lea    0x8(%eax),%eax
+  8010eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010ee:	bf 08 00 00 00       	mov    $0x8,%edi
+  8010f3:	eb 3f                	jmp    801134 <vprintfmt+0x3bc>
+  8010f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010f8:	8b 10                	mov    (%eax),%edx
+  8010fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010ff:	8d 40 04             	lea    0x4(%eax),%eax
+  801102:	89 45 14             	mov    %eax,0x14(%ebp)
+  801105:	bf 08 00 00 00       	mov    $0x8,%edi
+  80110a:	eb 28                	jmp    801134 <vprintfmt+0x3bc>
+  80110c:	83 ec 08             	sub    $0x8,%esp
+  80110f:	53                   	push   %ebx
+  801110:	6a 30                	push   $0x30
+  801112:	ff d6                	call   *%esi
+  801114:	83 c4 08             	add    $0x8,%esp
+  801117:	53                   	push   %ebx
+  801118:	6a 78                	push   $0x78
+  80111a:	ff d6                	call   *%esi
+  80111c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80111f:	8b 10                	mov    (%eax),%edx
+  801121:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801126:	83 c4 10             	add    $0x10,%esp
+  801129:	8d 40 04             	lea    0x4(%eax),%eax
+  80112c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80112f:	bf 10 00 00 00       	mov    $0x10,%edi
+  801134:	83 ec 0c             	sub    $0xc,%esp
+  801137:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80113b:	50                   	push   %eax
+  80113c:	ff 75 e0             	push   -0x20(%ebp)
+  80113f:	57                   	push   %edi
+  801140:	51                   	push   %ecx
+  801141:	52                   	push   %edx
+  801142:	89 da                	mov    %ebx,%edx
+  801144:	89 f0                	mov    %esi,%eax
+  801146:	e8 4a fb ff ff       	call   800c95 <printnum>
+  80114b:	83 c4 20             	add    $0x20,%esp
+  80114e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801151:	e9 40 fc ff ff       	jmp    800d96 <vprintfmt+0x1e>
+  801156:	83 f9 01             	cmp    $0x1,%ecx
+  801159:	7f 1b                	jg     801176 <vprintfmt+0x3fe>
+  80115b:	85 c9                	test   %ecx,%ecx
+  80115d:	74 2c                	je     80118b <vprintfmt+0x413>
+  80115f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801162:	8b 10                	mov    (%eax),%edx
+  801164:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801169:	8d 40 04             	lea    0x4(%eax),%eax
+  80116c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80116f:	bf 10 00 00 00       	mov    $0x10,%edi
+  801174:	eb be                	jmp    801134 <vprintfmt+0x3bc>
+  801176:	8b 45 14             	mov    0x14(%ebp),%eax
+  801179:	8b 10                	mov    (%eax),%edx
+  80117b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80117e:	8d 40 08             	lea    0x8(%eax),%eax
+  801181:	89 45 14             	mov    %eax,0x14(%ebp)
+  801184:	bf 10 00 00 00       	mov    $0x10,%edi
+  801189:	eb a9                	jmp    801134 <vprintfmt+0x3bc>
+  80118b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80118e:	8b 10                	mov    (%eax),%edx
+  801190:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801195:	8d 40 04             	lea    0x4(%eax),%eax
+  801198:	89 45 14             	mov    %eax,0x14(%ebp)
+  80119b:	bf 10 00 00 00       	mov    $0x10,%edi
+  8011a0:	eb 92                	jmp    801134 <vprintfmt+0x3bc>
+  8011a2:	83 ec 08             	sub    $0x8,%esp
+  8011a5:	53                   	push   %ebx
+  8011a6:	6a 25                	push   $0x25
+  8011a8:	ff d6                	call   *%esi
+  8011aa:	83 c4 10             	add    $0x10,%esp
+  8011ad:	eb 9f                	jmp    80114e <vprintfmt+0x3d6>
+  8011af:	83 ec 08             	sub    $0x8,%esp
+  8011b2:	53                   	push   %ebx
+  8011b3:	6a 25                	push   $0x25
+  8011b5:	ff d6                	call   *%esi
+  8011b7:	83 c4 10             	add    $0x10,%esp
+  8011ba:	89 f8                	mov    %edi,%eax
+  8011bc:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8011c0:	74 05                	je     8011c7 <vprintfmt+0x44f>
+  8011c2:	83 e8 01             	sub    $0x1,%eax
+  8011c5:	eb f5                	jmp    8011bc <vprintfmt+0x444>
+  8011c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8011ca:	eb 82                	jmp    80114e <vprintfmt+0x3d6>
+
+008011cc <vsnprintf>:
+  8011cc:	55                   	push   %ebp
+  8011cd:	89 e5                	mov    %esp,%ebp
+  8011cf:	83 ec 18             	sub    $0x18,%esp
+  8011d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011d8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8011db:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8011df:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8011e2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8011e9:	85 c0                	test   %eax,%eax
+  8011eb:	74 26                	je     801213 <vsnprintf+0x47>
+  8011ed:	85 d2                	test   %edx,%edx
+  8011ef:	7e 22                	jle    801213 <vsnprintf+0x47>
+  8011f1:	ff 75 14             	push   0x14(%ebp)
+  8011f4:	ff 75 10             	push   0x10(%ebp)
+  8011f7:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8011fa:	50                   	push   %eax
+  8011fb:	68 3e 0d 80 00       	push   $0x800d3e
+  801200:	e8 73 fb ff ff       	call   800d78 <vprintfmt>
+  801205:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801208:	c6 00 00             	movb   $0x0,(%eax)
+  80120b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80120e:	83 c4 10             	add    $0x10,%esp
+  801211:	c9                   	leave
+  801212:	c3                   	ret
+  801213:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801218:	eb f7                	jmp    801211 <vsnprintf+0x45>
+
+0080121a <snprintf>:
+  80121a:	55                   	push   %ebp
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	83 ec 08             	sub    $0x8,%esp
+  801220:	8d 45 14             	lea    0x14(%ebp),%eax
+  801223:	50                   	push   %eax
+  801224:	ff 75 10             	push   0x10(%ebp)
+  801227:	ff 75 0c             	push   0xc(%ebp)
+  80122a:	ff 75 08             	push   0x8(%ebp)
+  80122d:	e8 9a ff ff ff       	call   8011cc <vsnprintf>
+  801232:	c9                   	leave
+  801233:	c3                   	ret
+
+00801234 <copy_fwd>:
+  801234:	55                   	push   %ebp
+  801235:	89 e5                	mov    %esp,%ebp
+  801237:	57                   	push   %edi
+  801238:	56                   	push   %esi
+  801239:	53                   	push   %ebx
+  80123a:	89 c7                	mov    %eax,%edi
+  80123c:	89 d6                	mov    %edx,%esi
+  80123e:	89 c8                	mov    %ecx,%eax
+  801240:	83 f9 0f             	cmp    $0xf,%ecx
+  801243:	76 1c                	jbe    801261 <copy_fwd+0x2d>
+  801245:	89 f9                	mov    %edi,%ecx
+  801247:	f7 d9                	neg    %ecx
+  801249:	89 cb                	mov    %ecx,%ebx
+  80124b:	83 e3 03             	and    $0x3,%ebx
+  80124e:	29 d8                	sub    %ebx,%eax
+  801250:	89 c2                	mov    %eax,%edx
+  801252:	c1 ea 02             	shr    $0x2,%edx
+  801255:	83 e0 03             	and    $0x3,%eax
+  801258:	89 d9                	mov    %ebx,%ecx
+  80125a:	fc                   	cld
+  80125b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80125d:	89 d1                	mov    %edx,%ecx
+  80125f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801261:	89 c1                	mov    %eax,%ecx
+  801263:	fc                   	cld
+  801264:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  801266:	5b                   	pop    %ebx
+  801267:	5e                   	pop    %esi
+  801268:	5f                   	pop    %edi
+  801269:	5d                   	pop    %ebp
+  80126a:	c3                   	ret
+
+0080126b <have_sse2>:
+  80126b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801272:	78 06                	js     80127a <have_sse2+0xf>
+  801274:	a1 08 20 80 00       	mov    0x802008,%eax
+  801279:	c3                   	ret
+  80127a:	55                   	push   %ebp
+  80127b:	89 e5                	mov    %esp,%ebp
+  80127d:	53                   	push   %ebx
+  80127e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801283:	0f a2                	cpuid
+  801285:	c1 ea 1a             	shr    $0x1a,%edx
+  801288:	83 e2 01             	and    $0x1,%edx
+  80128b:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801291:	a1 08 20 80 00       	mov    0x802008,%eax
+  801296:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801299:	c9                   	leave
+  80129a:	c3                   	ret
+
+0080129b <strlen>:
+  80129b:	55                   	push   %ebp
+  80129c:	89 e5                	mov    %esp,%ebp
+  80129e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a6:	eb 03                	jmp    8012ab <strlen+0x10>
+  8012a8:	83 c0 01             	add    $0x1,%eax
+  8012ab:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8012af:	75 f7                	jne    8012a8 <strlen+0xd>
+  8012b1:	5d                   	pop    %ebp
+  8012b2:	c3                   	ret
+
+008012b3 <strnlen>:
+  8012b3:	55                   	push   %ebp
+  8012b4:	89 e5                	mov    %esp,%ebp
+  8012b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c1:	eb 03                	jmp    8012c6 <strnlen+0x13>
+  8012c3:	83 c0 01             	add    $0x1,%eax
+  8012c6:	39 d0                	cmp    %edx,%eax
+  8012c8:	74 08                	je     8012d2 <strnlen+0x1f>
+  8012ca:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8012ce:	75 f3                	jne    8012c3 <strnlen+0x10>
+  8012d0:	89 c2                	mov    %eax,%edx
+  8012d2:	89 d0                	mov    %edx,%eax
+  8012d4:	5d                   	pop    %ebp
+  8012d5:	c3                   	ret
+
+008012d6 <strcpy>:
+  8012d6:	55                   	push   %ebp
+  8012d7:	89 e5                	mov    %esp,%ebp
+  8012d9:	53                   	push   %ebx
+  8012da:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8012e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8012e9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8012ec:	83 c0 01             	add    $0x1,%eax
+  8012ef:	84 d2                	test   %dl,%dl
+  8012f1:	75 f2                	jne    8012e5 <strcpy+0xf>
+  8012f3:	89 c8                	mov    %ecx,%eax
+  8012f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012f8:	c9                   	leave
+  8012f9:	c3                   	ret
+
+008012fa <strcat>:
+  8012fa:	55                   	push   %ebp
+  8012fb:	89 e5                	mov    %esp,%ebp
+  8012fd:	53                   	push   %ebx
+  8012fe:	83 ec 10             	sub    $0x10,%esp
+  801301:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801304:	53                   	push   %ebx
+  801305:	e8 91 ff ff ff       	call   80129b <strlen>
+  80130a:	83 c4 08             	add    $0x8,%esp
+  80130d:	ff 75 0c             	push   0xc(%ebp)
+  801310:	01 d8                	add    %ebx,%eax
+  801312:	50                   	push   %eax
+  801313:	e8 be ff ff ff       	call   8012d6 <strcpy>
+  801318:	89 d8                	mov    %ebx,%eax
+  80131a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80131d:	c9                   	leave
+  80131e:	c3                   	ret
+
+0080131f <strncpy>:
+  80131f:	55                   	push   %ebp
+  801320:	89 e5                	mov    %esp,%ebp
+  801322:	56                   	push   %esi
+  801323:	53                   	push   %ebx
+  801324:	8b 75 08             	mov    0x8(%ebp),%esi
+  801327:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80132a:	89 f3                	mov    %esi,%ebx
+  80132c:	03 5d 10             	add    0x10(%ebp),%ebx
+  80132f:	89 f0                	mov    %esi,%eax
+  801331:	eb 0f                	jmp    801342 <strncpy+0x23>
+  801333:	83 c0 01             	add    $0x1,%eax
+  801336:	0f b6 0a             	movzbl (%edx),%ecx
+  801339:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80133c:	80 f9 01             	cmp    $0x1,%cl
+  80133f:	83 da ff             	sbb    $0xffffffff,%edx
+  801342:	39 d8                	cmp    %ebx,%eax
+  801344:	75 ed                	jne    801333 <strncpy+0x14>
+  801346:	89 f0                	mov    %esi,%eax
+  801348:	5b                   	pop    %ebx
+  801349:	5e                   	pop    %esi
+  80134a:	5d                   	pop    %ebp
+  80134b:	c3                   	ret
+
+0080134c <strlcpy>:
+  80134c:	55                   	push   %ebp
+  80134d:	89 e5                	mov    %esp,%ebp
+  80134f:	56                   	push   %esi
+  801350:	53                   	push   %ebx
+  801351:	8b 75 08             	mov    0x8(%ebp),%esi
+  801354:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801357:	8b 55 10             	mov    0x10(%ebp),%edx
+  80135a:	89 f0                	mov    %esi,%eax
+  80135c:	85 d2                	test   %edx,%edx
+  80135e:	74 21                	je     801381 <strlcpy+0x35>
+  801360:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801364:	89 f2                	mov    %esi,%edx
+  801366:	eb 09                	jmp    801371 <strlcpy+0x25>
+  801368:	83 c1 01             	add    $0x1,%ecx
+  80136b:	83 c2 01             	add    $0x1,%edx
+  80136e:	88 5a ff             	mov    %bl,-0x1(%edx)
+  801371:	39 c2                	cmp    %eax,%edx
+  801373:	74 09                	je     80137e <strlcpy+0x32>
+  801375:	0f b6 19             	movzbl (%ecx),%ebx
+  801378:	84 db                	test   %bl,%bl
+  80137a:	75 ec                	jne    801368 <strlcpy+0x1c>
+  80137c:	89 d0                	mov    %edx,%eax
+  80137e:	c6 00 00             	movb   $0x0,(%eax)
+  801381:	29 f0                	sub    %esi,%eax
+  801383:	5b                   	pop    %ebx
+  801384:	5e                   	pop    %esi
+  801385:	5d                   	pop    %ebp
+  801386:	c3                   	ret
+
+00801387 <strcmp>:
+  801387:	55                   	push   %ebp
+  801388:	89 e5                	mov    %esp,%ebp
+  80138a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80138d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801390:	eb 06                	jmp    801398 <strcmp+0x11>
+  801392:	83 c1 01             	add    $0x1,%ecx
+  801395:	83 c2 01             	add    $0x1,%edx
+  801398:	0f b6 01             	movzbl (%ecx),%eax
+  80139b:	84 c0                	test   %al,%al
+  80139d:	74 04                	je     8013a3 <strcmp+0x1c>
+  80139f:	3a 02                	cmp    (%edx),%al
+  8013a1:	74 ef                	je     801392 <strcmp+0xb>
+  8013a3:	0f b6 c0             	movzbl %al,%eax
+  8013a6:	0f b6 12             	movzbl (%edx),%edx
+  8013a9:	29 d0                	sub    %edx,%eax
+  8013ab:	5d                   	pop    %ebp
+  8013ac:	c3                   	ret
+
+008013ad <strncmp>:
+  8013ad:	55                   	push   %ebp
+  8013ae:	89 e5                	mov    %esp,%ebp
+  8013b0:	53                   	push   %ebx
+  8013b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8013ba:	eb 09                	jmp    8013c5 <strncmp+0x18>
+  8013bc:	83 ea 01             	sub    $0x1,%edx
+  8013bf:	83 c0 01             	add    $0x1,%eax
+  8013c2:	83 c1 01             	add    $0x1,%ecx
+  8013c5:	85 d2                	test   %edx,%edx
+  8013c7:	74 18                	je     8013e1 <strncmp+0x34>
+  8013c9:	0f b6 18             	movzbl (%eax),%ebx
+  8013cc:	84 db                	test   %bl,%bl
+  8013ce:	74 04                	je     8013d4 <strncmp+0x27>
+  8013d0:	3a 19                	cmp    (%ecx),%bl
+  8013d2:	74 e8                	je     8013bc <strncmp+0xf>
+  8013d4:	0f b6 00             	movzbl (%eax),%eax
+  8013d7:	0f b6 11             	movzbl (%ecx),%edx
+  8013da:	29 d0                	sub    %edx,%eax
+  8013dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013df:	c9                   	leave
+  8013e0:	c3                   	ret
+  8013e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e6:	eb f4                	jmp    8013dc <strncmp+0x2f>
+
+008013e8 <strchr>:
+  8013e8:	55                   	push   %ebp
+  8013e9:	89 e5                	mov    %esp,%ebp
+  8013eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013ee:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8013f2:	eb 03                	jmp    8013f7 <strchr+0xf>
+  8013f4:	83 c0 01             	add    $0x1,%eax
+  8013f7:	0f b6 10             	movzbl (%eax),%edx
+  8013fa:	84 d2                	test   %dl,%dl
+  8013fc:	74 06                	je     801404 <strchr+0x1c>
+  8013fe:	38 ca                	cmp    %cl,%dl
+  801400:	75 f2                	jne    8013f4 <strchr+0xc>
+  801402:	eb 05                	jmp    801409 <strchr+0x21>
+  801404:	b8 00 00 00 00       	mov    $0x0,%eax
+  801409:	5d                   	pop    %ebp
+  80140a:	c3                   	ret
+
+0080140b <strfind>:
+  80140b:	55                   	push   %ebp
+  80140c:	89 e5                	mov    %esp,%ebp
+  80140e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801411:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  801415:	0f b6 10             	movzbl (%eax),%edx
+  801418:	38 ca                	cmp    %cl,%dl
+  80141a:	74 09                	je     801425 <strfind+0x1a>
+  80141c:	84 d2                	test   %dl,%dl
+  80141e:	74 05                	je     801425 <strfind+0x1a>
+  801420:	83 c0 01             	add    $0x1,%eax
+  801423:	eb f0                	jmp    801415 <strfind+0xa>
+  801425:	5d                   	pop    %ebp
+  801426:	c3                   	ret
+
+00801427 <memset>:
+  801427:	55                   	push   %ebp
+  801428:	89 e5                	mov    %esp,%ebp
+  80142a:	57                   	push   %edi
+  80142b:	56                   	push   %esi
+  80142c:	53                   	push   %ebx
+  80142d:	83 ec 04             	sub    $0x4,%esp
+  801430:	8b 75 08             	mov    0x8(%ebp),%esi
+  801433:	8b 55 10             	mov    0x10(%ebp),%edx
+  801436:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  80143a:	89 f7                	mov    %esi,%edi
+  80143c:	83 fa 0f             	cmp    $0xf,%edx
+  80143f:	76 24                	jbe    801465 <memset+0x3e>
+  801441:	89 f1                	mov    %esi,%ecx
+  801443:	f7 d9                	neg    %ecx
+  801445:	83 e1 03             	and    $0x3,%ecx
+  801448:	29 ca                	sub    %ecx,%edx
+  80144a:	89 d0                	mov    %edx,%eax
+  80144c:	c1 e8 02             	shr    $0x2,%eax
+  80144f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  801452:	83 e2 03             	and    $0x3,%edx
+  801455:	89 d8                	mov    %ebx,%eax
+  801457:	fc                   	cld
+  801458:	f3 aa                	rep stos %al,%es:(%edi)
+  80145a:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  801460:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  801463:	f3 ab                	rep stos %eax,%es:(%edi)
+  801465:	89 d1                	mov    %edx,%ecx
+  801467:	89 d8                	mov    %ebx,%eax
+  801469:	fc                   	cld
+  80146a:	f3 aa                	rep stos %al,%es:(%edi)
+  80146c:	89 f0                	mov    %esi,%eax
+  80146e:	83 c4 04             	add    $0x4,%esp
+  801471:	5b                   	pop    %ebx
+  801472:	5e                   	pop    %esi
+  801473:	5f                   	pop    %edi
+  801474:	5d                   	pop    %ebp
+  801475:	c3                   	ret
+
+00801476 <memmove>:
+  801476:	55                   	push   %ebp
+  801477:	89 e5                	mov    %esp,%ebp
+  801479:	57                   	push   %edi
+  80147a:	56                   	push   %esi
+  80147b:	53                   	push   %ebx
+  80147c:	83 ec 0c             	sub    $0xc,%esp
+  80147f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801482:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801485:	8b 45 10             	mov    0x10(%ebp),%eax
+  801488:	85 c0                	test   %eax,%eax
+  80148a:	74 14                	je     8014a0 <memmove+0x2a>
+  80148c:	39 da                	cmp    %ebx,%edx
+  80148e:	73 07                	jae    801497 <memmove+0x21>
+  801490:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  801493:	39 cb                	cmp    %ecx,%ebx
+  801495:	72 13                	jb     8014aa <memmove+0x34>
+  801497:	89 c1                	mov    %eax,%ecx
+  801499:	89 d8                	mov    %ebx,%eax
+  80149b:	e8 94 fd ff ff       	call   801234 <copy_fwd>
+  8014a0:	89 d8                	mov    %ebx,%eax
+  8014a2:	83 c4 0c             	add    $0xc,%esp
+  8014a5:	5b                   	pop    %ebx
+  8014a6:	5e                   	pop    %esi
+  8014a7:	5f                   	pop    %edi
+  8014a8:	5d                   	pop    %ebp
+  8014a9:	c3                   	ret
+  8014aa:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  8014ad:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  8014b0:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  8014b3:	83 f8 0f             	cmp    $0xf,%eax
+  8014b6:	76 23                	jbe    8014db <memmove+0x65>
+  8014b8:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  8014bb:	83 e1 03             	and    $0x3,%ecx
+  8014be:	29 c8                	sub    %ecx,%eax
+  8014c0:	89 c2                	mov    %eax,%edx
+  8014c2:	c1 ea 02             	shr    $0x2,%edx
+  8014c5:	83 e0 03             	and    $0x3,%eax
+  8014c8:	fd                   	std
+  8014c9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014cb:	83 ef 03             	sub    $0x3,%edi
+  8014ce:	83 ee 03             	sub    $0x3,%esi
+  8014d1:	89 d1                	mov    %edx,%ecx
+  8014d3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8014d5:	83 c7 03             	add    $0x3,%edi
+  8014d8:	83 c6 03             	add    $0x3,%esi
+  8014db:	89 c1                	mov    %eax,%ecx
+  8014dd:	fd                   	std
+  8014de:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014e0:	fc                   	cld
+  8014e1:	eb bd                	jmp    8014a0 <memmove+0x2a>
+
+008014e3 <memcpy>:
+  8014e3:	55                   	push   %ebp
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	53                   	push   %ebx
+  8014e7:	83 ec 04             	sub    $0x4,%esp
+  8014ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8014ed:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8014f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014f3:	89 d8                	mov    %ebx,%eax
+  8014f5:	e8 3a fd ff ff       	call   801234 <copy_fwd>
+  8014fa:	89 d8                	mov    %ebx,%eax
+  8014fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014ff:	c9                   	leave
+  801500:	c3                   	ret
+
+00801501 <page_copy>:
+  801501:	55                   	push   %ebp
+  801502:	89 e5                	mov    %esp,%ebp
+  801504:	57                   	push   %edi
+  801505:	56                   	push   %esi
+  801506:	53                   	push   %ebx
+  801507:	83 ec 0c             	sub    $0xc,%esp
+  80150a:	e8 5c fd ff ff       	call   80126b <have_sse2>
+  80150f:	85 c0                	test   %eax,%eax
+  801511:	74 39                	je     80154c <page_copy+0x4b>
+  801513:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801516:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801519:	be 00 01 00 00       	mov    $0x100,%esi
+  80151e:	8b 03                	mov    (%ebx),%eax
+  801520:	8b 53 04             	mov    0x4(%ebx),%edx
+  801523:	0f c3 01             	movnti %eax,(%ecx)
+  801526:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  80152a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80152d:	8b 53 0c             	mov    0xc(%ebx),%edx
+  801530:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  801534:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  801538:	83 c3 10             	add    $0x10,%ebx
+  80153b:	83 c1 10             	add    $0x10,%ecx
+  80153e:	4e                   	dec    %esi
+  80153f:	75 dd                	jne    80151e <page_copy+0x1d>
+  801541:	0f ae f8             	sfence
+  801544:	83 c4 0c             	add    $0xc,%esp
+  801547:	5b                   	pop    %ebx
+  801548:	5e                   	pop    %esi
+  801549:	5f                   	pop    %edi
+  80154a:	5d                   	pop    %ebp
+  80154b:	c3                   	ret
+  80154c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80154f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801552:	b9 00 04 00 00       	mov    $0x400,%ecx
+  801557:	fc                   	cld
+  801558:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80155a:	eb e8                	jmp    801544 <page_copy+0x43>
+
+0080155c <page_zero>:
+  80155c:	55                   	push   %ebp
+  80155d:	89 e5                	mov    %esp,%ebp
+  80155f:	57                   	push   %edi
+  801560:	83 ec 04             	sub    $0x4,%esp
+  801563:	e8 03 fd ff ff       	call   80126b <have_sse2>
+  801568:	85 c0                	test   %eax,%eax
+  80156a:	74 3a                	je     8015a6 <page_zero+0x4a>
+  80156c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80156f:	ba 80 00 00 00       	mov    $0x80,%edx
+  801574:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801579:	0f c3 08             	movnti %ecx,(%eax)
+  80157c:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  801580:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  801584:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  801588:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  80158c:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  801590:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  801594:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  801598:	83 c0 20             	add    $0x20,%eax
+  80159b:	4a                   	dec    %edx
+  80159c:	75 db                	jne    801579 <page_zero+0x1d>
+  80159e:	0f ae f8             	sfence
+  8015a1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8015a4:	c9                   	leave
+  8015a5:	c3                   	ret
+  8015a6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015a9:	b9 00 04 00 00       	mov    $0x400,%ecx
+  8015ae:	fc                   	cld
+  8015af:	f3 ab                	rep stos %eax,%es:(%edi)
+  8015b1:	eb ee                	jmp    8015a1 <page_zero+0x45>
+
+008015b3 <memcmp>:
+  8015b3:	55                   	push   %ebp
+  8015b4:	89 e5                	mov    %esp,%ebp
+  8015b6:	56                   	push   %esi
+  8015b7:	53                   	push   %ebx
+  8015b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015be:	89 c6                	mov    %eax,%esi
+  8015c0:	03 75 10             	add    0x10(%ebp),%esi
+  8015c3:	eb 06                	jmp    8015cb <memcmp+0x18>
+  8015c5:	83 c0 01             	add    $0x1,%eax
+  8015c8:	83 c2 01             	add    $0x1,%edx
+  8015cb:	39 f0                	cmp    %esi,%eax
+  8015cd:	74 14                	je     8015e3 <memcmp+0x30>
+  8015cf:	0f b6 08             	movzbl (%eax),%ecx
+  8015d2:	0f b6 1a             	movzbl (%edx),%ebx
+  8015d5:	38 d9                	cmp    %bl,%cl
+  8015d7:	74 ec                	je     8015c5 <memcmp+0x12>
+  8015d9:	0f b6 c1             	movzbl %cl,%eax
+  8015dc:	0f b6 db             	movzbl %bl,%ebx
+  8015df:	29 d8                	sub    %ebx,%eax
+  8015e1:	eb 05                	jmp    8015e8 <memcmp+0x35>
+  8015e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e8:	5b                   	pop    %ebx
+  8015e9:	5e                   	pop    %esi
+  8015ea:	5d                   	pop    %ebp
+  8015eb:	c3                   	ret
+
+008015ec <memfind>:
+  8015ec:	55                   	push   %ebp
+  8015ed:	89 e5                	mov    %esp,%ebp
+  8015ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f5:	89 c2                	mov    %eax,%edx
+  8015f7:	03 55 10             	add    0x10(%ebp),%edx
+  8015fa:	eb 03                	jmp    8015ff <memfind+0x13>
+  8015fc:	83 c0 01             	add    $0x1,%eax
+  8015ff:	39 d0                	cmp    %edx,%eax
+  801601:	73 04                	jae    801607 <memfind+0x1b>
+  801603:	38 08                	cmp    %cl,(%eax)
+  801605:	75 f5                	jne    8015fc <memfind+0x10>
+  801607:	5d                   	pop    %ebp
+  801608:	c3                   	ret
+
+00801609 <strtol>:
+  801609:	55                   	push   %ebp
+  80160a:	89 e5                	mov    %esp,%ebp
+  80160c:	57                   	push   %edi
+  80160d:	56                   	push   %esi
+  80160e:	53                   	push   %ebx
+  80160f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801612:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801615:	eb 03                	jmp    80161a <strtol+0x11>
+  801617:	83 c2 01             	add    $0x1,%edx
+  80161a:	0f b6 02             	movzbl (%edx),%eax
+  80161d:	3c 20                	cmp    $0x20,%al
+  80161f:	74 f6                	je     801617 <strtol+0xe>
+  801621:	3c 09                	cmp    $0x9,%al
+  801623:	74 f2                	je     801617 <strtol+0xe>
+  801625:	3c 2b                	cmp    $0x2b,%al
+  801627:	74 2a                	je     801653 <strtol+0x4a>
+  801629:	bf 00 00 00 00       	mov    $0x0,%edi
+  80162e:	3c 2d                	cmp    $0x2d,%al
+  801630:	74 2b                	je     80165d <strtol+0x54>
+  801632:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801638:	75 0f                	jne    801649 <strtol+0x40>
+  80163a:	80 3a 30             	cmpb   $0x30,(%edx)
+  80163d:	74 28                	je     801667 <strtol+0x5e>
+  80163f:	85 db                	test   %ebx,%ebx
+  801641:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801646:	0f 44 d8             	cmove  %eax,%ebx
+  801649:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80164e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801651:	eb 46                	jmp    801699 <strtol+0x90>
+  801653:	83 c2 01             	add    $0x1,%edx
+  801656:	bf 00 00 00 00       	mov    $0x0,%edi
+  80165b:	eb d5                	jmp    801632 <strtol+0x29>
+  80165d:	83 c2 01             	add    $0x1,%edx
+  801660:	bf 01 00 00 00       	mov    $0x1,%edi
+  801665:	eb cb                	jmp    801632 <strtol+0x29>
+  801667:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80166b:	74 0e                	je     80167b <strtol+0x72>
+  80166d:	85 db                	test   %ebx,%ebx
+  80166f:	75 d8                	jne    801649 <strtol+0x40>
+  801671:	83 c2 01             	add    $0x1,%edx
+  801674:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801679:	eb ce                	jmp    801649 <strtol+0x40>
+  80167b:	83 c2 02             	add    $0x2,%edx
+  80167e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801683:	eb c4                	jmp    801649 <strtol+0x40>
+  801685:	0f be c0             	movsbl %al,%eax
+  801688:	83 e8 30             	sub    $0x30,%eax
+  80168b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80168e:	7d 3a                	jge    8016ca <strtol+0xc1>
+  801690:	83 c2 01             	add    $0x1,%edx
+  801693:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801697:	01 c1                	add    %eax,%ecx
+  801699:	0f b6 02             	movzbl (%edx),%eax
+  80169c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80169f:	89 f3                	mov    %esi,%ebx
+  8016a1:	80 fb 09             	cmp    $0x9,%bl
+  8016a4:	76 df                	jbe    801685 <strtol+0x7c>
+  8016a6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8016a9:	89 f3                	mov    %esi,%ebx
+  8016ab:	80 fb 19             	cmp    $0x19,%bl
+  8016ae:	77 08                	ja     8016b8 <strtol+0xaf>
+  8016b0:	0f be c0             	movsbl %al,%eax
+  8016b3:	83 e8 57             	sub    $0x57,%eax
+  8016b6:	eb d3                	jmp    80168b <strtol+0x82>
+  8016b8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8016bb:	89 f3                	mov    %esi,%ebx
+  8016bd:	80 fb 19             	cmp    $0x19,%bl
+  8016c0:	77 08                	ja     8016ca <strtol+0xc1>
+  8016c2:	0f be c0             	movsbl %al,%eax
+  8016c5:	83 e8 37             	sub    $0x37,%eax
+  8016c8:	eb c1                	jmp    80168b <strtol+0x82>
+  8016ca:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8016ce:	74 05                	je     8016d5 <strtol+0xcc>
+  8016d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016d3:	89 10                	mov    %edx,(%eax)
+  8016d5:	89 c8                	mov    %ecx,%eax
+  8016d7:	f7 d8                	neg    %eax
+  8016d9:	85 ff                	test   %edi,%edi
+  8016db:	0f 45 c8             	cmovne %eax,%ecx
+  8016de:	89 c8                	mov    %ecx,%eax
+  8016e0:	5b                   	pop    %ebx
+  8016e1:	5e                   	pop    %esi
+  8016e2:	5f                   	pop    %edi
+  8016e3:	5d                   	pop    %ebp
+  8016e4:	c3                   	ret
+
+008016e5 <__udivdi3>:
+  8016e5:	57                   	push   %edi
+  8016e6:	56                   	push   %esi
+  8016e7:	53                   	push   %ebx
+  8016e8:	83 ec 20             	sub    $0x20,%esp
+  8016eb:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8016ef:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8016f3:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8016f7:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8016fb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8016ff:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801703:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801707:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80170b:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80170f:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801713:	89 d1                	mov    %edx,%ecx
+  801715:	09 c1                	or     %eax,%ecx
+  801717:	0f 84 91 00 00 00    	je     8017ae <__udivdi3+0xc9>
+  80171d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801724:	00 
+  801725:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80172c:	00 
+  80172d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801732:	b8 00 00 00 00       	mov    $0x0,%eax
+  801737:	ba 00 00 00 00       	mov    $0x0,%edx
+  80173c:	eb 08                	jmp    801746 <__udivdi3+0x61>
+  80173e:	83 e9 01             	sub    $0x1,%ecx
+  801741:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801744:	74 68                	je     8017ae <__udivdi3+0xc9>
+  801746:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80174a:	01 c0                	add    %eax,%eax
+  80174c:	89 c6                	mov    %eax,%esi
+  80174e:	89 d7                	mov    %edx,%edi
+  801750:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801754:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801758:	0f ad d0             	shrd   %cl,%edx,%eax
+  80175b:	d3 ea                	shr    %cl,%edx
+  80175d:	f6 c1 20             	test   $0x20,%cl
+  801760:	74 04                	je     801766 <__udivdi3+0x81>
+  801762:	89 d0                	mov    %edx,%eax
+  801764:	31 d2                	xor    %edx,%edx
+  801766:	83 e0 01             	and    $0x1,%eax
+  801769:	89 04 24             	mov    %eax,(%esp)
+  80176c:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801773:	00 
+  801774:	8b 04 24             	mov    (%esp),%eax
+  801777:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80177b:	09 f0                	or     %esi,%eax
+  80177d:	09 fa                	or     %edi,%edx
+  80177f:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801783:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801787:	39 f0                	cmp    %esi,%eax
+  801789:	89 d3                	mov    %edx,%ebx
+  80178b:	19 fb                	sbb    %edi,%ebx
+  80178d:	72 af                	jb     80173e <__udivdi3+0x59>
+  80178f:	29 f0                	sub    %esi,%eax
+  801791:	19 fa                	sbb    %edi,%edx
+  801793:	89 cf                	mov    %ecx,%edi
+  801795:	c1 ef 05             	shr    $0x5,%edi
+  801798:	83 e7 01             	and    $0x1,%edi
+  80179b:	89 fe                	mov    %edi,%esi
+  80179d:	83 f6 01             	xor    $0x1,%esi
+  8017a0:	d3 e6                	shl    %cl,%esi
+  8017a2:	d3 e7                	shl    %cl,%edi
+  8017a4:	09 74 24 18          	or     %esi,0x18(%esp)
+  8017a8:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8017ac:	eb 90                	jmp    80173e <__udivdi3+0x59>
+  8017ae:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8017b2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8017b6:	83 c4 20             	add    $0x20,%esp
+  8017b9:	5b                   	pop    %ebx
+  8017ba:	5e                   	pop    %esi
+  8017bb:	5f                   	pop    %edi
+  8017bc:	c3                   	ret
+
+008017bd <__umoddi3>:
+  8017bd:	55                   	push   %ebp
+  8017be:	57                   	push   %edi
+  8017bf:	56                   	push   %esi
+  8017c0:	53                   	push   %ebx
+  8017c1:	83 ec 1c             	sub    $0x1c,%esp
+  8017c4:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8017c8:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8017cc:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8017d0:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8017d4:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8017d8:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8017dc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8017e0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8017e4:	89 d6                	mov    %edx,%esi
+  8017e6:	09 c6                	or     %eax,%esi
+  8017e8:	74 6c                	je     801856 <__umoddi3+0x99>
+  8017ea:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8017ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f9:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  8017fd:	eb 0e                	jmp    80180d <__umoddi3+0x50>
+  8017ff:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801804:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801808:	83 fe ff             	cmp    $0xffffffff,%esi
+  80180b:	74 49                	je     801856 <__umoddi3+0x99>
+  80180d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801811:	01 c0                	add    %eax,%eax
+  801813:	89 c3                	mov    %eax,%ebx
+  801815:	89 d6                	mov    %edx,%esi
+  801817:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80181b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80181f:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801824:	0f ad d0             	shrd   %cl,%edx,%eax
+  801827:	d3 ea                	shr    %cl,%edx
+  801829:	f6 c1 20             	test   $0x20,%cl
+  80182c:	74 04                	je     801832 <__umoddi3+0x75>
+  80182e:	89 d0                	mov    %edx,%eax
+  801830:	31 d2                	xor    %edx,%edx
+  801832:	83 e0 01             	and    $0x1,%eax
+  801835:	bd 00 00 00 00       	mov    $0x0,%ebp
+  80183a:	89 ea                	mov    %ebp,%edx
+  80183c:	09 d8                	or     %ebx,%eax
+  80183e:	09 f2                	or     %esi,%edx
+  801840:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801844:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801848:	39 d8                	cmp    %ebx,%eax
+  80184a:	89 d1                	mov    %edx,%ecx
+  80184c:	19 f1                	sbb    %esi,%ecx
+  80184e:	72 af                	jb     8017ff <__umoddi3+0x42>
+  801850:	29 d8                	sub    %ebx,%eax
+  801852:	19 f2                	sbb    %esi,%edx
+  801854:	eb a9                	jmp    8017ff <__umoddi3+0x42>
+  801856:	83 c4 1c             	add    $0x1c,%esp
+  801859:	5b                   	pop    %ebx
+  80185a:	5e                   	pop    %esi
+  80185b:	5f                   	pop    %edi
+  80185c:	5d                   	pop    %ebp
+  80185d:	c3                   	ret
+
+0080185e <__divdi3>:
+  80185e:	53                   	push   %ebx
+  80185f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801863:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801867:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80186b:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80186f:	85 d2                	test   %edx,%edx
+  801871:	78 12                	js     801885 <__divdi3+0x27>
+  801873:	85 db                	test   %ebx,%ebx
+  801875:	78 2e                	js     8018a5 <__divdi3+0x47>
+  801877:	53                   	push   %ebx
+  801878:	51                   	push   %ecx
+  801879:	52                   	push   %edx
+  80187a:	50                   	push   %eax
+  80187b:	e8 65 fe ff ff       	call   8016e5 <__udivdi3>
+  801880:	83 c4 10             	add    $0x10,%esp
+  801883:	eb 1e                	jmp    8018a3 <__divdi3+0x45>
+  801885:	f7 d8                	neg    %eax
+  801887:	83 d2 00             	adc    $0x0,%edx
+  80188a:	f7 da                	neg    %edx
+  80188c:	85 db                	test   %ebx,%ebx
+  80188e:	78 2a                	js     8018ba <__divdi3+0x5c>
+  801890:	53                   	push   %ebx
+  801891:	51                   	push   %ecx
+  801892:	52                   	push   %edx
+  801893:	50                   	push   %eax
+  801894:	e8 4c fe ff ff       	call   8016e5 <__udivdi3>
+  801899:	83 c4 10             	add    $0x10,%esp
+  80189c:	f7 d8                	neg    %eax
+  80189e:	83 d2 00             	adc    $0x0,%edx
+  8018a1:	f7 da                	neg    %edx
+  8018a3:	5b                   	pop    %ebx
+  8018a4:	c3                   	ret
+  8018a5:	f7 d9                	neg    %ecx
+  8018a7:	83 d3 00             	adc    $0x0,%ebx
+  8018aa:	f7 db                	neg    %ebx
+  8018ac:	53                   	push   %ebx
+  8018ad:	51                   	push   %ecx
+  8018ae:	52                   	push   %edx
+  8018af:	50                   	push   %eax
+  8018b0:	e8 30 fe ff ff       	call   8016e5 <__udivdi3>
+  8018b5:	83 c4 10             	add    $0x10,%esp
+  8018b8:	eb e2                	jmp    80189c <__divdi3+0x3e>
+  8018ba:	f7 d9                	neg    %ecx
+  8018bc:	83 d3 00             	adc    $0x0,%ebx
+  8018bf:	f7 db                	neg    %ebx
+  8018c1:	53                   	push   %ebx
+  8018c2:	51                   	push   %ecx
+  8018c3:	52                   	push   %edx
+  8018c4:	50                   	push   %eax
+  8018c5:	e8 1b fe ff ff       	call   8016e5 <__udivdi3>
+  8018ca:	83 c4 10             	add    $0x10,%esp
+  8018cd:	eb d4                	jmp    8018a3 <__divdi3+0x45>
+
+008018cf <__moddi3>:
+  8018cf:	55                   	push   %ebp
+  8018d0:	57                   	push   %edi
+  8018d1:	56                   	push   %esi
+  8018d2:	53                   	push   %ebx
+  8018d3:	83 ec 14             	sub    $0x14,%esp
+  8018d6:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  8018da:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  8018de:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8018e2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8018e6:	85 ed                	test   %ebp,%ebp
+  8018e8:	78 2b                	js     801915 <__moddi3+0x46>
+  8018ea:	89 c6                	mov    %eax,%esi
+  8018ec:	f7 de                	neg    %esi
+  8018ee:	89 34 24             	mov    %esi,(%esp)
+  8018f1:	89 d6                	mov    %edx,%esi
+  8018f3:	83 d6 00             	adc    $0x0,%esi
+  8018f6:	f7 de                	neg    %esi
+  8018f8:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8018fc:	8b 34 24             	mov    (%esp),%esi
+  8018ff:	0f 48 f0             	cmovs  %eax,%esi
+  801902:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801907:	52                   	push   %edx
+  801908:	56                   	push   %esi
+  801909:	55                   	push   %ebp
+  80190a:	57                   	push   %edi
+  80190b:	e8 ad fe ff ff       	call   8017bd <__umoddi3>
+  801910:	83 c4 10             	add    $0x10,%esp
+  801913:	eb 3c                	jmp    801951 <__moddi3+0x82>
+  801915:	89 c3                	mov    %eax,%ebx
+  801917:	f7 db                	neg    %ebx
+  801919:	89 d1                	mov    %edx,%ecx
+  80191b:	83 d1 00             	adc    $0x0,%ecx
+  80191e:	f7 d9                	neg    %ecx
+  801920:	0f 49 c3             	cmovns %ebx,%eax
+  801923:	89 04 24             	mov    %eax,(%esp)
+  801926:	0f 49 d1             	cmovns %ecx,%edx
+  801929:	89 54 24 04          	mov    %edx,0x4(%esp)
+  80192d:	ff 74 24 04          	push   0x4(%esp)
+  801931:	ff 74 24 04          	push   0x4(%esp)
+  801935:	89 f8                	mov    %edi,%eax
+  801937:	89 ea                	mov    %ebp,%edx
+  801939:	f7 d8                	neg    %eax
+  80193b:	83 d2 00             	adc    $0x0,%edx
+  80193e:	f7 da                	neg    %edx
+  801940:	52                   	push   %edx
+  801941:	50                   	push   %eax
+  801942:	e8 76 fe ff ff       	call   8017bd <__umoddi3>
+  801947:	83 c4 10             	add    $0x10,%esp
+  80194a:	f7 d8                	neg    %eax
+  80194c:	83 d2 00             	adc    $0x0,%edx
+  80194f:	f7 da                	neg    %edx
+  801951:	83 c4 14             	add    $0x14,%esp
+  801954:	5b                   	pop    %ebx
+  801955:	5e                   	pop    %esi
+  801956:	5f                   	pop    %edi
+  801957:	5d                   	pop    %ebp
+  801958:	c3                   	ret
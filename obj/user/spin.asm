@@ -0,0 +1,2921 @@
+
+obj/user/spin:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 10             	sub    $0x10,%esp
+  80003a:	68 c0 1d 80 00       	push   $0x801dc0
+  80003f:	e8 69 01 00 00       	call   8001ad <cprintf>
+  800044:	e8 ff 16 00 00       	call   801748 <fork>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	85 c0                	test   %eax,%eax
+  80004e:	75 12                	jne    800062 <umain+0x2f>
+  800050:	83 ec 0c             	sub    $0xc,%esp
+  800053:	68 38 1e 80 00       	push   $0x801e38
+  800058:	e8 50 01 00 00       	call   8001ad <cprintf>
+  80005d:	83 c4 10             	add    $0x10,%esp
+  800060:	eb fe                	jmp    800060 <umain+0x2d>
+  800062:	89 c3                	mov    %eax,%ebx
+  800064:	83 ec 0c             	sub    $0xc,%esp
+  800067:	68 e8 1d 80 00       	push   $0x801de8
+  80006c:	e8 3c 01 00 00       	call   8001ad <cprintf>
+  800071:	e8 5c 0d 00 00       	call   800dd2 <sys_yield>
+  800076:	e8 57 0d 00 00       	call   800dd2 <sys_yield>
+  80007b:	e8 52 0d 00 00       	call   800dd2 <sys_yield>
+  800080:	e8 4d 0d 00 00       	call   800dd2 <sys_yield>
+  800085:	e8 48 0d 00 00       	call   800dd2 <sys_yield>
+  80008a:	e8 43 0d 00 00       	call   800dd2 <sys_yield>
+  80008f:	e8 3e 0d 00 00       	call   800dd2 <sys_yield>
+  800094:	e8 39 0d 00 00       	call   800dd2 <sys_yield>
+  800099:	c7 04 24 10 1e 80 00 	movl   $0x801e10,(%esp)
+  8000a0:	e8 08 01 00 00       	call   8001ad <cprintf>
+  8000a5:	89 1c 24             	mov    %ebx,(%esp)
+  8000a8:	e8 32 0c 00 00       	call   800cdf <sys_env_destroy>
+  8000ad:	83 c4 10             	add    $0x10,%esp
+  8000b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000c0:	e8 08 18 00 00       	call   8018cd <uinfo_envid>
+  8000c5:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8000ca:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8000d0:	05 00 00 00 ed       	add    $0xed000000,%eax
+  8000d5:	a3 20 30 80 00       	mov    %eax,0x803020
+  8000da:	85 db                	test   %ebx,%ebx
+  8000dc:	7e 07                	jle    8000e5 <libmain+0x30>
+  8000de:	8b 06                	mov    (%esi),%eax
+  8000e0:	a3 00 30 80 00       	mov    %eax,0x803000
+  8000e5:	83 ec 08             	sub    $0x8,%esp
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	e8 44 ff ff ff       	call   800033 <umain>
+  8000ef:	e8 0a 00 00 00       	call   8000fe <exit>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <exit>:
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	83 ec 08             	sub    $0x8,%esp
+  800104:	e8 5d 18 00 00       	call   801966 <bflush>
+  800109:	83 ec 0c             	sub    $0xc,%esp
+  80010c:	6a 00                	push   $0x0
+  80010e:	e8 cc 0b 00 00       	call   800cdf <sys_env_destroy>
+  800113:	83 c4 10             	add    $0x10,%esp
+  800116:	c9                   	leave
+  800117:	c3                   	ret
+
+00800118 <putch>:
+  800118:	55                   	push   %ebp
+  800119:	89 e5                	mov    %esp,%ebp
+  80011b:	53                   	push   %ebx
+  80011c:	83 ec 04             	sub    $0x4,%esp
+  80011f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800122:	8b 13                	mov    (%ebx),%edx
+  800124:	8d 42 01             	lea    0x1(%edx),%eax
+  800127:	89 03                	mov    %eax,(%ebx)
+  800129:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80012c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800130:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800135:	74 09                	je     800140 <putch+0x28>
+  800137:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80013b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80013e:	c9                   	leave
+  80013f:	c3                   	ret
+  800140:	83 ec 08             	sub    $0x8,%esp
+  800143:	68 ff 00 00 00       	push   $0xff
+  800148:	8d 43 08             	lea    0x8(%ebx),%eax
+  80014b:	50                   	push   %eax
+  80014c:	e8 c0 0a 00 00       	call   800c11 <sys_cputs>
+  800151:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800157:	83 c4 10             	add    $0x10,%esp
+  80015a:	eb db                	jmp    800137 <putch+0x1f>
+
+0080015c <vcprintf>:
+  80015c:	55                   	push   %ebp
+  80015d:	89 e5                	mov    %esp,%ebp
+  80015f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800165:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80016c:	00 00 00 
+  80016f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800176:	00 00 00 
+  800179:	ff 75 0c             	push   0xc(%ebp)
+  80017c:	ff 75 08             	push   0x8(%ebp)
+  80017f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800185:	50                   	push   %eax
+  800186:	68 18 01 80 00       	push   $0x800118
+  80018b:	e8 14 01 00 00       	call   8002a4 <vprintfmt>
+  800190:	83 c4 08             	add    $0x8,%esp
+  800193:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800199:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80019f:	50                   	push   %eax
+  8001a0:	e8 6c 0a 00 00       	call   800c11 <sys_cputs>
+  8001a5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001ab:	c9                   	leave
+  8001ac:	c3                   	ret
+
+008001ad <cprintf>:
+  8001ad:	55                   	push   %ebp
+  8001ae:	89 e5                	mov    %esp,%ebp
+  8001b0:	83 ec 10             	sub    $0x10,%esp
+  8001b3:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8001b6:	50                   	push   %eax
+  8001b7:	ff 75 08             	push   0x8(%ebp)
+  8001ba:	e8 9d ff ff ff       	call   80015c <vcprintf>
+  8001bf:	c9                   	leave
+  8001c0:	c3                   	ret
+
+008001c1 <printnum>:
+  8001c1:	55                   	push   %ebp
+  8001c2:	89 e5                	mov    %esp,%ebp
+  8001c4:	57                   	push   %edi
+  8001c5:	56                   	push   %esi
+  8001c6:	53                   	push   %ebx
+  8001c7:	83 ec 1c             	sub    $0x1c,%esp
+  8001ca:	89 c7                	mov    %eax,%edi
+  8001cc:	89 d6                	mov    %edx,%esi
+  8001ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001d4:	89 d1                	mov    %edx,%ecx
+  8001d6:	89 c2                	mov    %eax,%edx
+  8001d8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001db:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001de:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001e1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8001e4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001e7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001ee:	39 c2                	cmp    %eax,%edx
+  8001f0:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001f3:	72 3e                	jb     800233 <printnum+0x72>
+  8001f5:	83 ec 0c             	sub    $0xc,%esp
+  8001f8:	ff 75 18             	push   0x18(%ebp)
+  8001fb:	83 eb 01             	sub    $0x1,%ebx
+  8001fe:	53                   	push   %ebx
+  8001ff:	50                   	push   %eax
+  800200:	83 ec 08             	sub    $0x8,%esp
+  800203:	ff 75 e4             	push   -0x1c(%ebp)
+  800206:	ff 75 e0             	push   -0x20(%ebp)
+  800209:	ff 75 dc             	push   -0x24(%ebp)
+  80020c:	ff 75 d8             	push   -0x28(%ebp)
+  80020f:	e8 29 19 00 00       	call   801b3d <__udivdi3>
+  800214:	83 c4 18             	add    $0x18,%esp
+  800217:	52                   	push   %edx
+  800218:	50                   	push   %eax
+  800219:	89 f2                	mov    %esi,%edx
+  80021b:	89 f8                	mov    %edi,%eax
+  80021d:	e8 9f ff ff ff       	call   8001c1 <printnum>
+  800222:	83 c4 20             	add    $0x20,%esp
+  800225:	eb 13                	jmp    80023a <printnum+0x79>
+  800227:	83 ec 08             	sub    $0x8,%esp
+  80022a:	56                   	push   %esi
+  80022b:	ff 75 18             	push   0x18(%ebp)
+  80022e:	ff d7                	call   *%edi
+  800230:	83 c4 10             	add    $0x10,%esp
+  800233:	83 eb 01             	sub    $0x1,%ebx
+  800236:	85 db                	test   %ebx,%ebx
+  800238:	7f ed                	jg     800227 <printnum+0x66>
+  80023a:	83 ec 08             	sub    $0x8,%esp
+  80023d:	56                   	push   %esi
+  80023e:	83 ec 04             	sub    $0x4,%esp
+  800241:	ff 75 e4             	push   -0x1c(%ebp)
+  800244:	ff 75 e0             	push   -0x20(%ebp)
+  800247:	ff 75 dc             	push   -0x24(%ebp)
+  80024a:	ff 75 d8             	push   -0x28(%ebp)
+  80024d:	e8 c3 19 00 00       	call   801c15 <__umoddi3>
+  800252:	83 c4 14             	add    $0x14,%esp
+  800255:	0f be 80 60 1e 80 00 	movsbl 0x801e60(%eax),%eax
+  80025c:	50                   	push   %eax
+  80025d:	ff d7                	call   *%edi
+  80025f:	83 c4 10             	add    $0x10,%esp
+  800262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800265:	5b                   	pop    %ebx
+  800266:	5e                   	pop    %esi
+  800267:	5f                   	pop    %edi
+  800268:	5d                   	pop    %ebp
+  800269:	c3                   	ret
+
+0080026a <sprintputch>:
+  80026a:	55                   	push   %ebp
+  80026b:	89 e5                	mov    %esp,%ebp
+  80026d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800270:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800274:	8b 10                	mov    (%eax),%edx
+  800276:	3b 50 04             	cmp    0x4(%eax),%edx
+  800279:	73 0a                	jae    800285 <sprintputch+0x1b>
+  80027b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80027e:	89 08                	mov    %ecx,(%eax)
+  800280:	8b 45 08             	mov    0x8(%ebp),%eax
+  800283:	88 02                	mov    %al,(%edx)
+  800285:	5d                   	pop    %ebp
+  800286:	c3                   	ret
+
+00800287 <printfmt>:
+  800287:	55                   	push   %ebp
+  800288:	89 e5                	mov    %esp,%ebp
+  80028a:	83 ec 08             	sub    $0x8,%esp
+  80028d:	8d 45 14             	lea    0x14(%ebp),%eax
+  800290:	50                   	push   %eax
+  800291:	ff 75 10             	push   0x10(%ebp)
+  800294:	ff 75 0c             	push   0xc(%ebp)
+  800297:	ff 75 08             	push   0x8(%ebp)
+  80029a:	e8 05 00 00 00       	call   8002a4 <vprintfmt>
+  80029f:	83 c4 10             	add    $0x10,%esp
+  8002a2:	c9                   	leave
+  8002a3:	c3                   	ret
+
+008002a4 <vprintfmt>:
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  8002a7:	57                   	push   %edi
+  8002a8:	56                   	push   %esi
+  8002a9:	53                   	push   %ebx
+  8002aa:	83 ec 2c             	sub    $0x2c,%esp
+  8002ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002b3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002b6:	eb 0a                	jmp    8002c2 <vprintfmt+0x1e>
+  8002b8:	83 ec 08             	sub    $0x8,%esp
+  8002bb:	53                   	push   %ebx
+  8002bc:	50                   	push   %eax
+  8002bd:	ff d6                	call   *%esi
+  8002bf:	83 c4 10             	add    $0x10,%esp
+  8002c2:	83 c7 01             	add    $0x1,%edi
+  8002c5:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002c9:	83 f8 25             	cmp    $0x25,%eax
+  8002cc:	74 0c                	je     8002da <vprintfmt+0x36>
+  8002ce:	85 c0                	test   %eax,%eax
+  8002d0:	75 e6                	jne    8002b8 <vprintfmt+0x14>
+  8002d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d5:	5b                   	pop    %ebx
+  8002d6:	5e                   	pop    %esi
+  8002d7:	5f                   	pop    %edi
+  8002d8:	5d                   	pop    %ebp
+  8002d9:	c3                   	ret
+  8002da:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  8002de:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8002e5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8002ec:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  8002f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002f8:	8d 47 01             	lea    0x1(%edi),%eax
+  8002fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002fe:	0f b6 17             	movzbl (%edi),%edx
+  800301:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800304:	3c 55                	cmp    $0x55,%al
+  800306:	0f 87 cf 03 00 00    	ja     8006db <vprintfmt+0x437>
+  80030c:	0f b6 c0             	movzbl %al,%eax
+  80030f:	ff 24 85 20 1f 80 00 	jmp    *0x801f20(,%eax,4)
+  800316:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800319:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80031d:	eb d9                	jmp    8002f8 <vprintfmt+0x54>
+  80031f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800322:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800326:	eb d0                	jmp    8002f8 <vprintfmt+0x54>
+  800328:	0f b6 d2             	movzbl %dl,%edx
+  80032b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80032e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800333:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800336:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800339:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  80033d:	0f be 17             	movsbl (%edi),%edx
+  800340:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800343:	83 f9 09             	cmp    $0x9,%ecx
+  800346:	77 55                	ja     80039d <vprintfmt+0xf9>
+  800348:	83 c7 01             	add    $0x1,%edi
+  80034b:	eb e9                	jmp    800336 <vprintfmt+0x92>
+  80034d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800350:	8b 00                	mov    (%eax),%eax
+  800352:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800355:	8b 45 14             	mov    0x14(%ebp),%eax
+  800358:	8d 40 04             	lea    0x4(%eax),%eax
+  80035b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80035e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800361:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800365:	79 91                	jns    8002f8 <vprintfmt+0x54>
+  800367:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80036a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80036d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800374:	eb 82                	jmp    8002f8 <vprintfmt+0x54>
+  800376:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800379:	85 d2                	test   %edx,%edx
+  80037b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800380:	0f 49 c2             	cmovns %edx,%eax
+  800383:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800386:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800389:	e9 6a ff ff ff       	jmp    8002f8 <vprintfmt+0x54>
+  80038e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800391:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800398:	e9 5b ff ff ff       	jmp    8002f8 <vprintfmt+0x54>
+  80039d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003a0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a3:	eb bc                	jmp    800361 <vprintfmt+0xbd>
+  8003a5:	83 c1 01             	add    $0x1,%ecx
+  8003a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003ab:	e9 48 ff ff ff       	jmp    8002f8 <vprintfmt+0x54>
+  8003b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b3:	8d 78 04             	lea    0x4(%eax),%edi
+  8003b6:	83 ec 08             	sub    $0x8,%esp
+  8003b9:	53                   	push   %ebx
+  8003ba:	ff 30                	push   (%eax)
+  8003bc:	ff d6                	call   *%esi
+  8003be:	83 c4 10             	add    $0x10,%esp
+  8003c1:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003c4:	e9 b1 02 00 00       	jmp    80067a <vprintfmt+0x3d6>
+  8003c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cc:	8d 78 04             	lea    0x4(%eax),%edi
+  8003cf:	8b 10                	mov    (%eax),%edx
+  8003d1:	89 d0                	mov    %edx,%eax
+  8003d3:	f7 d8                	neg    %eax
+  8003d5:	0f 48 c2             	cmovs  %edx,%eax
+  8003d8:	83 f8 08             	cmp    $0x8,%eax
+  8003db:	7f 23                	jg     800400 <vprintfmt+0x15c>
+  8003dd:	8b 14 85 80 20 80 00 	mov    0x802080(,%eax,4),%edx
+  8003e4:	85 d2                	test   %edx,%edx
+  8003e6:	74 18                	je     800400 <vprintfmt+0x15c>
+  8003e8:	52                   	push   %edx
+  8003e9:	68 81 1e 80 00       	push   $0x801e81
+  8003ee:	53                   	push   %ebx
+  8003ef:	56                   	push   %esi
+  8003f0:	e8 92 fe ff ff       	call   800287 <printfmt>
+  8003f5:	83 c4 10             	add    $0x10,%esp
+  8003f8:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003fb:	e9 7a 02 00 00       	jmp    80067a <vprintfmt+0x3d6>
+  800400:	50                   	push   %eax
+  800401:	68 78 1e 80 00       	push   $0x801e78
+  800406:	53                   	push   %ebx
+  800407:	56                   	push   %esi
+  800408:	e8 7a fe ff ff       	call   800287 <printfmt>
+  80040d:	83 c4 10             	add    $0x10,%esp
+  800410:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800413:	e9 62 02 00 00       	jmp    80067a <vprintfmt+0x3d6>
+  800418:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041b:	83 c0 04             	add    $0x4,%eax
+  80041e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800421:	8b 45 14             	mov    0x14(%ebp),%eax
+  800424:	8b 08                	mov    (%eax),%ecx
+  800426:	85 c9                	test   %ecx,%ecx
+  800428:	b8 71 1e 80 00       	mov    $0x801e71,%eax
+  80042d:	0f 45 c1             	cmovne %ecx,%eax
+  800430:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800433:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800437:	7e 06                	jle    80043f <vprintfmt+0x19b>
+  800439:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80043d:	75 0b                	jne    80044a <vprintfmt+0x1a6>
+  80043f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800442:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800445:	89 75 08             	mov    %esi,0x8(%ebp)
+  800448:	eb 5c                	jmp    8004a6 <vprintfmt+0x202>
+  80044a:	83 ec 08             	sub    $0x8,%esp
+  80044d:	ff 75 d0             	push   -0x30(%ebp)
+  800450:	ff 75 cc             	push   -0x34(%ebp)
+  800453:	e8 87 03 00 00       	call   8007df <strnlen>
+  800458:	89 c2                	mov    %eax,%edx
+  80045a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80045d:	29 d0                	sub    %edx,%eax
+  80045f:	83 c4 10             	add    $0x10,%esp
+  800462:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800466:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800469:	89 75 08             	mov    %esi,0x8(%ebp)
+  80046c:	89 c6                	mov    %eax,%esi
+  80046e:	eb 0e                	jmp    80047e <vprintfmt+0x1da>
+  800470:	83 ec 08             	sub    $0x8,%esp
+  800473:	53                   	push   %ebx
+  800474:	57                   	push   %edi
+  800475:	ff 55 08             	call   *0x8(%ebp)
+  800478:	83 ee 01             	sub    $0x1,%esi
+  80047b:	83 c4 10             	add    $0x10,%esp
+  80047e:	85 f6                	test   %esi,%esi
+  800480:	7f ee                	jg     800470 <vprintfmt+0x1cc>
+  800482:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800485:	8b 75 08             	mov    0x8(%ebp),%esi
+  800488:	85 c0                	test   %eax,%eax
+  80048a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80048f:	0f 49 d0             	cmovns %eax,%edx
+  800492:	29 d0                	sub    %edx,%eax
+  800494:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800497:	eb a6                	jmp    80043f <vprintfmt+0x19b>
+  800499:	83 ec 08             	sub    $0x8,%esp
+  80049c:	53                   	push   %ebx
+  80049d:	52                   	push   %edx
+  80049e:	ff 55 08             	call   *0x8(%ebp)
+  8004a1:	83 c4 10             	add    $0x10,%esp
+  8004a4:	89 f1                	mov    %esi,%ecx
+  8004a6:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004a9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004ad:	0f be d0             	movsbl %al,%edx
+  8004b0:	85 d2                	test   %edx,%edx
+  8004b2:	74 28                	je     8004dc <vprintfmt+0x238>
+  8004b4:	85 ff                	test   %edi,%edi
+  8004b6:	78 05                	js     8004bd <vprintfmt+0x219>
+  8004b8:	83 ef 01             	sub    $0x1,%edi
+  8004bb:	78 30                	js     8004ed <vprintfmt+0x249>
+  8004bd:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004c1:	74 d6                	je     800499 <vprintfmt+0x1f5>
+  8004c3:	0f be c0             	movsbl %al,%eax
+  8004c6:	83 e8 20             	sub    $0x20,%eax
+  8004c9:	83 f8 5e             	cmp    $0x5e,%eax
+  8004cc:	76 cb                	jbe    800499 <vprintfmt+0x1f5>
+  8004ce:	83 ec 08             	sub    $0x8,%esp
+  8004d1:	53                   	push   %ebx
+  8004d2:	6a 3f                	push   $0x3f
+  8004d4:	ff 55 08             	call   *0x8(%ebp)
+  8004d7:	83 c4 10             	add    $0x10,%esp
+  8004da:	eb c8                	jmp    8004a4 <vprintfmt+0x200>
+  8004dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004df:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004e2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004e5:	01 d0                	add    %edx,%eax
+  8004e7:	29 c8                	sub    %ecx,%eax
+  8004e9:	89 c7                	mov    %eax,%edi
+  8004eb:	eb 13                	jmp    800500 <vprintfmt+0x25c>
+  8004ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f0:	eb ed                	jmp    8004df <vprintfmt+0x23b>
+  8004f2:	83 ec 08             	sub    $0x8,%esp
+  8004f5:	53                   	push   %ebx
+  8004f6:	6a 20                	push   $0x20
+  8004f8:	ff d6                	call   *%esi
+  8004fa:	83 ef 01             	sub    $0x1,%edi
+  8004fd:	83 c4 10             	add    $0x10,%esp
+  800500:	85 ff                	test   %edi,%edi
+  800502:	7f ee                	jg     8004f2 <vprintfmt+0x24e>
+  800504:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800507:	89 45 14             	mov    %eax,0x14(%ebp)
+  80050a:	e9 6b 01 00 00       	jmp    80067a <vprintfmt+0x3d6>
+  80050f:	83 f9 01             	cmp    $0x1,%ecx
+  800512:	7f 1f                	jg     800533 <vprintfmt+0x28f>
+  800514:	85 c9                	test   %ecx,%ecx
+  800516:	74 67                	je     80057f <vprintfmt+0x2db>
+  800518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051b:	8b 00                	mov    (%eax),%eax
+  80051d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800520:	89 c1                	mov    %eax,%ecx
+  800522:	c1 f9 1f             	sar    $0x1f,%ecx
+  800525:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8d 40 04             	lea    0x4(%eax),%eax
+  80052e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800531:	eb 17                	jmp    80054a <vprintfmt+0x2a6>
+  800533:	8b 45 14             	mov    0x14(%ebp),%eax
+  800536:	8b 50 04             	mov    0x4(%eax),%edx
+  800539:	8b 00                	mov    (%eax),%eax
+  80053b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80053e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800541:	8b 45 14             	mov    0x14(%ebp),%eax
+  800544:	8d 40 08             	lea    0x8(%eax),%eax
+  800547:	89 45 14             	mov    %eax,0x14(%ebp)
+  80054a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80054d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800550:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800555:	85 c9                	test   %ecx,%ecx
+  800557:	0f 89 03 01 00 00    	jns    800660 <vprintfmt+0x3bc>
+  80055d:	83 ec 08             	sub    $0x8,%esp
+  800560:	53                   	push   %ebx
+  800561:	6a 2d                	push   $0x2d
+  800563:	ff d6                	call   *%esi
+  800565:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800568:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80056b:	f7 da                	neg    %edx
+  80056d:	83 d1 00             	adc    $0x0,%ecx
+  800570:	f7 d9                	neg    %ecx
+  800572:	83 c4 10             	add    $0x10,%esp
+  800575:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80057a:	e9 e1 00 00 00       	jmp    800660 <vprintfmt+0x3bc>
+  80057f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800582:	8b 00                	mov    (%eax),%eax
+  800584:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800587:	89 c1                	mov    %eax,%ecx
+  800589:	c1 f9 1f             	sar    $0x1f,%ecx
+  80058c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8d 40 04             	lea    0x4(%eax),%eax
+  800595:	89 45 14             	mov    %eax,0x14(%ebp)
+  800598:	eb b0                	jmp    80054a <vprintfmt+0x2a6>
+  80059a:	83 f9 01             	cmp    $0x1,%ecx
+  80059d:	7f 1e                	jg     8005bd <vprintfmt+0x319>
+  80059f:	85 c9                	test   %ecx,%ecx
+  8005a1:	74 32                	je     8005d5 <vprintfmt+0x331>
+  8005a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a6:	8b 10                	mov    (%eax),%edx
+  8005a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005b8:	e9 a3 00 00 00       	jmp    800660 <vprintfmt+0x3bc>
+  8005bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c0:	8b 10                	mov    (%eax),%edx
+  8005c2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005c5:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005d0:	e9 8b 00 00 00       	jmp    800660 <vprintfmt+0x3bc>
+  8005d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d8:	8b 10                	mov    (%eax),%edx
+  8005da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005df:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005ea:	eb 74                	jmp    800660 <vprintfmt+0x3bc>
+  8005ec:	83 f9 01             	cmp    $0x1,%ecx
+  8005ef:	7f 1b                	jg     80060c <vprintfmt+0x368>
+  8005f1:	85 c9                	test   %ecx,%ecx
+  8005f3:	74 2c                	je     800621 <vprintfmt+0x37d>
+  8005f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f8:	8b 10                	mov    (%eax),%edx
+  8005fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800602:	89 45 14             	mov    %eax,0x14(%ebp)
+  800605:	bf 08 00 00 00       	mov    $0x8,%edi
+  80060a:	eb 54                	jmp    800660 <vprintfmt+0x3bc>
+  80060c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060f:	8b 10                	mov    (%eax),%edx
+  800611:	8b 48 04             	mov    0x4(%eax),%ecx
+  800614:	8d 40 08             	lea    0x8(%eax),%eax
+  800617:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80061f:	eb 3f                	jmp    800660 <vprintfmt+0x3bc>
+  800621:	8b 45 14             	mov    0x14(%ebp),%eax
+  800624:	8b 10                	mov    (%eax),%edx
+  800626:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062b:	8d 40 04             	lea    0x4(%eax),%eax
+  80062e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800631:	bf 08 00 00 00       	mov    $0x8,%edi
+  800636:	eb 28                	jmp    800660 <vprintfmt+0x3bc>
+  800638:	83 ec 08             	sub    $0x8,%esp
+  80063b:	53                   	push   %ebx
+  80063c:	6a 30                	push   $0x30
+  80063e:	ff d6                	call   *%esi
+  800640:	83 c4 08             	add    $0x8,%esp
+  800643:	53                   	push   %ebx
+  800644:	6a 78                	push   $0x78
+  800646:	ff d6                	call   *%esi
+  800648:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064b:	8b 10                	mov    (%eax),%edx
+  80064d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800652:	83 c4 10             	add    $0x10,%esp
+  800655:	8d 40 04             	lea    0x4(%eax),%eax
+  800658:	89 45 14             	mov    %eax,0x14(%ebp)
+  80065b:	bf 10 00 00 00       	mov    $0x10,%edi
+  800660:	83 ec 0c             	sub    $0xc,%esp
+  800663:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800667:	50                   	push   %eax
+  800668:	ff 75 e0             	push   -0x20(%ebp)
+  80066b:	57                   	push   %edi
+  80066c:	51                   	push   %ecx
+  80066d:	52                   	push   %edx
+  80066e:	89 da                	mov    %ebx,%edx
+  800670:	89 f0                	mov    %esi,%eax
+  800672:	e8 4a fb ff ff       	call   8001c1 <printnum>
+  800677:	83 c4 20             	add    $0x20,%esp
+  80067a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80067d:	e9 40 fc ff ff       	jmp    8002c2 <vprintfmt+0x1e>
+  800682:	83 f9 01             	cmp    $0x1,%ecx
+  800685:	7f 1b                	jg     8006a2 <vprintfmt+0x3fe>
+  800687:	85 c9                	test   %ecx,%ecx
+  800689:	74 2c                	je     8006b7 <vprintfmt+0x413>
+  80068b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068e:	8b 10                	mov    (%eax),%edx
+  800690:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800695:	8d 40 04             	lea    0x4(%eax),%eax
+  800698:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069b:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006a0:	eb be                	jmp    800660 <vprintfmt+0x3bc>
+  8006a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a5:	8b 10                	mov    (%eax),%edx
+  8006a7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006aa:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ad:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b0:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006b5:	eb a9                	jmp    800660 <vprintfmt+0x3bc>
+  8006b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ba:	8b 10                	mov    (%eax),%edx
+  8006bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c7:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006cc:	eb 92                	jmp    800660 <vprintfmt+0x3bc>
+  8006ce:	83 ec 08             	sub    $0x8,%esp
+  8006d1:	53                   	push   %ebx
+  8006d2:	6a 25                	push   $0x25
+  8006d4:	ff d6                	call   *%esi
+  8006d6:	83 c4 10             	add    $0x10,%esp
+  8006d9:	eb 9f                	jmp    80067a <vprintfmt+0x3d6>
+  8006db:	83 ec 08             	sub    $0x8,%esp
+  8006de:	53                   	push   %ebx
+  8006df:	6a 25                	push   $0x25
+  8006e1:	ff d6                	call   *%esi
+  8006e3:	83 c4 10             	add    $0x10,%esp
+  8006e6:	89 f8                	mov    %edi,%eax
+  8006e8:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006ec:	74 05                	je     8006f3 <vprintfmt+0x44f>
+  8006ee:	83 e8 01             	sub    $0x1,%eax
+  8006f1:	eb f5                	jmp    8006e8 <vprintfmt+0x444>
+  8006f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006f6:	eb 82                	jmp    80067a <vprintfmt+0x3d6>
+
+008006f8 <vsnprintf>:
+  8006f8:	55                   	push   %ebp
+  8006f9:	89 e5                	mov    %esp,%ebp
+  8006fb:	83 ec 18             	sub    $0x18,%esp
+  8006fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800701:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800704:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800707:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80070b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80070e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800715:	85 c0                	test   %eax,%eax
+  800717:	74 26                	je     80073f <vsnprintf+0x47>
+  800719:	85 d2                	test   %edx,%edx
+  80071b:	7e 22                	jle    80073f <vsnprintf+0x47>
+  80071d:	ff 75 14             	push   0x14(%ebp)
+  800720:	ff 75 10             	push   0x10(%ebp)
+  800723:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800726:	50                   	push   %eax
+  800727:	68 6a 02 80 00       	push   $0x80026a
+  80072c:	e8 73 fb ff ff       	call   8002a4 <vprintfmt>
+  800731:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800734:	c6 00 00             	movb   $0x0,(%eax)
+  800737:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80073a:	83 c4 10             	add    $0x10,%esp
+  80073d:	c9                   	leave
+  80073e:	c3                   	ret
+  80073f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800744:	eb f7                	jmp    80073d <vsnprintf+0x45>
+
+00800746 <snprintf>:
+  800746:	55                   	push   %ebp
+  800747:	89 e5                	mov    %esp,%ebp
+  800749:	83 ec 08             	sub    $0x8,%esp
+  80074c:	8d 45 14             	lea    0x14(%ebp),%eax
+  80074f:	50                   	push   %eax
+  800750:	ff 75 10             	push   0x10(%ebp)
+  800753:	ff 75 0c             	push   0xc(%ebp)
+  800756:	ff 75 08             	push   0x8(%ebp)
+  800759:	e8 9a ff ff ff       	call   8006f8 <vsnprintf>
+  80075e:	c9                   	leave
+  80075f:	c3                   	ret
+
+00800760 <copy_fwd>:
+  800760:	55                   	push   %ebp
+  800761:	89 e5                	mov    %esp,%ebp
+  800763:	57                   	push   %edi
+  800764:	56                   	push   %esi
+  800765:	53                   	push   %ebx
+  800766:	89 c7                	mov    %eax,%edi
+  800768:	89 d6                	mov    %edx,%esi
+  80076a:	89 c8                	mov    %ecx,%eax
+  80076c:	83 f9 0f             	cmp    $0xf,%ecx
+  80076f:	76 1c                	jbe    80078d <copy_fwd+0x2d>
+  800771:	89 f9                	mov    %edi,%ecx
+  800773:	f7 d9                	neg    %ecx
+  800775:	89 cb                	mov    %ecx,%ebx
+  800777:	83 e3 03             	and    $0x3,%ebx
+  80077a:	29 d8                	sub    %ebx,%eax
+  80077c:	89 c2                	mov    %eax,%edx
+  80077e:	c1 ea 02             	shr    $0x2,%edx
+  800781:	83 e0 03             	and    $0x3,%eax
+  800784:	89 d9                	mov    %ebx,%ecx
+  800786:	fc                   	cld
+  800787:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800789:	89 d1                	mov    %edx,%ecx
+  80078b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80078d:	89 c1                	mov    %eax,%ecx
+  80078f:	fc                   	cld
+  800790:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800792:	5b                   	pop    %ebx
+  800793:	5e                   	pop    %esi
+  800794:	5f                   	pop    %edi
+  800795:	5d                   	pop    %ebp
+  800796:	c3                   	ret
+
+00800797 <have_sse2>:
+  800797:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80079e:	78 06                	js     8007a6 <have_sse2+0xf>
+  8007a0:	a1 04 30 80 00       	mov    0x803004,%eax
+  8007a5:	c3                   	ret
+  8007a6:	55                   	push   %ebp
+  8007a7:	89 e5                	mov    %esp,%ebp
+  8007a9:	53                   	push   %ebx
+  8007aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007af:	0f a2                	cpuid
+  8007b1:	c1 ea 1a             	shr    $0x1a,%edx
+  8007b4:	83 e2 01             	and    $0x1,%edx
+  8007b7:	89 15 04 30 80 00    	mov    %edx,0x803004
+  8007bd:	a1 04 30 80 00       	mov    0x803004,%eax
+  8007c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c5:	c9                   	leave
+  8007c6:	c3                   	ret
+
+008007c7 <strlen>:
+  8007c7:	55                   	push   %ebp
+  8007c8:	89 e5                	mov    %esp,%ebp
+  8007ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d2:	eb 03                	jmp    8007d7 <strlen+0x10>
+  8007d4:	83 c0 01             	add    $0x1,%eax
+  8007d7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007db:	75 f7                	jne    8007d4 <strlen+0xd>
+  8007dd:	5d                   	pop    %ebp
+  8007de:	c3                   	ret
+
+008007df <strnlen>:
+  8007df:	55                   	push   %ebp
+  8007e0:	89 e5                	mov    %esp,%ebp
+  8007e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ed:	eb 03                	jmp    8007f2 <strnlen+0x13>
+  8007ef:	83 c0 01             	add    $0x1,%eax
+  8007f2:	39 d0                	cmp    %edx,%eax
+  8007f4:	74 08                	je     8007fe <strnlen+0x1f>
+  8007f6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007fa:	75 f3                	jne    8007ef <strnlen+0x10>
+  8007fc:	89 c2                	mov    %eax,%edx
+  8007fe:	89 d0                	mov    %edx,%eax
+  800800:	5d                   	pop    %ebp
+  800801:	c3                   	ret
+
+00800802 <strcpy>:
+  800802:	55                   	push   %ebp
+  800803:	89 e5                	mov    %esp,%ebp
+  800805:	53                   	push   %ebx
+  800806:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800809:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80080c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800811:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800815:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800818:	83 c0 01             	add    $0x1,%eax
+  80081b:	84 d2                	test   %dl,%dl
+  80081d:	75 f2                	jne    800811 <strcpy+0xf>
+  80081f:	89 c8                	mov    %ecx,%eax
+  800821:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800824:	c9                   	leave
+  800825:	c3                   	ret
+
+00800826 <strcat>:
+  800826:	55                   	push   %ebp
+  800827:	89 e5                	mov    %esp,%ebp
+  800829:	53                   	push   %ebx
+  80082a:	83 ec 10             	sub    $0x10,%esp
+  80082d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800830:	53                   	push   %ebx
+  800831:	e8 91 ff ff ff       	call   8007c7 <strlen>
+  800836:	83 c4 08             	add    $0x8,%esp
+  800839:	ff 75 0c             	push   0xc(%ebp)
+  80083c:	01 d8                	add    %ebx,%eax
+  80083e:	50                   	push   %eax
+  80083f:	e8 be ff ff ff       	call   800802 <strcpy>
+  800844:	89 d8                	mov    %ebx,%eax
+  800846:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800849:	c9                   	leave
+  80084a:	c3                   	ret
+
+0080084b <strncpy>:
+  80084b:	55                   	push   %ebp
+  80084c:	89 e5                	mov    %esp,%ebp
+  80084e:	56                   	push   %esi
+  80084f:	53                   	push   %ebx
+  800850:	8b 75 08             	mov    0x8(%ebp),%esi
+  800853:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800856:	89 f3                	mov    %esi,%ebx
+  800858:	03 5d 10             	add    0x10(%ebp),%ebx
+  80085b:	89 f0                	mov    %esi,%eax
+  80085d:	eb 0f                	jmp    80086e <strncpy+0x23>
+  80085f:	83 c0 01             	add    $0x1,%eax
+  800862:	0f b6 0a             	movzbl (%edx),%ecx
+  800865:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800868:	80 f9 01             	cmp    $0x1,%cl
+  80086b:	83 da ff             	sbb    $0xffffffff,%edx
+  80086e:	39 d8                	cmp    %ebx,%eax
+  800870:	75 ed                	jne    80085f <strncpy+0x14>
+  800872:	89 f0                	mov    %esi,%eax
+  800874:	5b                   	pop    %ebx
+  800875:	5e                   	pop    %esi
+  800876:	5d                   	pop    %ebp
+  800877:	c3                   	ret
+
+00800878 <strlcpy>:
+  800878:	55                   	push   %ebp
+  800879:	89 e5                	mov    %esp,%ebp
+  80087b:	56                   	push   %esi
+  80087c:	53                   	push   %ebx
+  80087d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800880:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800883:	8b 55 10             	mov    0x10(%ebp),%edx
+  800886:	89 f0                	mov    %esi,%eax
+  800888:	85 d2                	test   %edx,%edx
+  80088a:	74 21                	je     8008ad <strlcpy+0x35>
+  80088c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800890:	89 f2                	mov    %esi,%edx
+  800892:	eb 09                	jmp    80089d <strlcpy+0x25>
+  800894:	83 c1 01             	add    $0x1,%ecx
+  800897:	83 c2 01             	add    $0x1,%edx
+  80089a:	88 5a ff             	mov    %bl,-0x1(%edx)
+  80089d:	39 c2                	cmp    %eax,%edx
+  80089f:	74 09                	je     8008aa <strlcpy+0x32>
+  8008a1:	0f b6 19             	movzbl (%ecx),%ebx
+  8008a4:	84 db                	test   %bl,%bl
+  8008a6:	75 ec                	jne    800894 <strlcpy+0x1c>
+  8008a8:	89 d0                	mov    %edx,%eax
+  8008aa:	c6 00 00             	movb   $0x0,(%eax)
+  8008ad:	29 f0                	sub    %esi,%eax
+  8008af:	5b                   	pop    %ebx
+  8008b0:	5e                   	pop    %esi
+  8008b1:	5d                   	pop    %ebp
+  8008b2:	c3                   	ret
+
+008008b3 <strcmp>:
+  8008b3:	55                   	push   %ebp
+  8008b4:	89 e5                	mov    %esp,%ebp
+  8008b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008bc:	eb 06                	jmp    8008c4 <strcmp+0x11>
+  8008be:	83 c1 01             	add    $0x1,%ecx
+  8008c1:	83 c2 01             	add    $0x1,%edx
+  8008c4:	0f b6 01             	movzbl (%ecx),%eax
+  8008c7:	84 c0                	test   %al,%al
+  8008c9:	74 04                	je     8008cf <strcmp+0x1c>
+  8008cb:	3a 02                	cmp    (%edx),%al
+  8008cd:	74 ef                	je     8008be <strcmp+0xb>
+  8008cf:	0f b6 c0             	movzbl %al,%eax
+  8008d2:	0f b6 12             	movzbl (%edx),%edx
+  8008d5:	29 d0                	sub    %edx,%eax
+  8008d7:	5d                   	pop    %ebp
+  8008d8:	c3                   	ret
+
+008008d9 <strncmp>:
+  8008d9:	55                   	push   %ebp
+  8008da:	89 e5                	mov    %esp,%ebp
+  8008dc:	53                   	push   %ebx
+  8008dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008e3:	8b 55 10             	mov    0x10(%ebp),%edx
+  8008e6:	eb 09                	jmp    8008f1 <strncmp+0x18>
+  8008e8:	83 ea 01             	sub    $0x1,%edx
+  8008eb:	83 c0 01             	add    $0x1,%eax
+  8008ee:	83 c1 01             	add    $0x1,%ecx
+  8008f1:	85 d2                	test   %edx,%edx
+  8008f3:	74 18                	je     80090d <strncmp+0x34>
+  8008f5:	0f b6 18             	movzbl (%eax),%ebx
+  8008f8:	84 db                	test   %bl,%bl
+  8008fa:	74 04                	je     800900 <strncmp+0x27>
+  8008fc:	3a 19                	cmp    (%ecx),%bl
+  8008fe:	74 e8                	je     8008e8 <strncmp+0xf>
+  800900:	0f b6 00             	movzbl (%eax),%eax
+  800903:	0f b6 11             	movzbl (%ecx),%edx
+  800906:	29 d0                	sub    %edx,%eax
+  800908:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80090b:	c9                   	leave
+  80090c:	c3                   	ret
+  80090d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800912:	eb f4                	jmp    800908 <strncmp+0x2f>
+
+00800914 <strchr>:
+  800914:	55                   	push   %ebp
+  800915:	89 e5                	mov    %esp,%ebp
+  800917:	8b 45 08             	mov    0x8(%ebp),%eax
+  80091a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80091e:	eb 03                	jmp    800923 <strchr+0xf>
+  800920:	83 c0 01             	add    $0x1,%eax
+  800923:	0f b6 10             	movzbl (%eax),%edx
+  800926:	84 d2                	test   %dl,%dl
+  800928:	74 06                	je     800930 <strchr+0x1c>
+  80092a:	38 ca                	cmp    %cl,%dl
+  80092c:	75 f2                	jne    800920 <strchr+0xc>
+  80092e:	eb 05                	jmp    800935 <strchr+0x21>
+  800930:	b8 00 00 00 00       	mov    $0x0,%eax
+  800935:	5d                   	pop    %ebp
+  800936:	c3                   	ret
+
+00800937 <strfind>:
+  800937:	55                   	push   %ebp
+  800938:	89 e5                	mov    %esp,%ebp
+  80093a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800941:	0f b6 10             	movzbl (%eax),%edx
+  800944:	38 ca                	cmp    %cl,%dl
+  800946:	74 09                	je     800951 <strfind+0x1a>
+  800948:	84 d2                	test   %dl,%dl
+  80094a:	74 05                	je     800951 <strfind+0x1a>
+  80094c:	83 c0 01             	add    $0x1,%eax
+  80094f:	eb f0                	jmp    800941 <strfind+0xa>
+  800951:	5d                   	pop    %ebp
+  800952:	c3                   	ret
+
+00800953 <memset>:
+  800953:	55                   	push   %ebp
+  800954:	89 e5                	mov    %esp,%ebp
+  800956:	57                   	push   %edi
+  800957:	56                   	push   %esi
+  800958:	53                   	push   %ebx
+  800959:	83 ec 04             	sub    $0x4,%esp
+  80095c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80095f:	8b 55 10             	mov    0x10(%ebp),%edx
+  800962:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  800966:	89 f7                	mov    %esi,%edi
+  800968:	83 fa 0f             	cmp    $0xf,%edx
+  80096b:	76 24                	jbe    800991 <memset+0x3e>
+  80096d:	89 f1                	mov    %esi,%ecx
+  80096f:	f7 d9                	neg    %ecx
+  800971:	83 e1 03             	and    $0x3,%ecx
+  800974:	29 ca                	sub    %ecx,%edx
+  800976:	89 d0                	mov    %edx,%eax
+  800978:	c1 e8 02             	shr    $0x2,%eax
+  80097b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  80097e:	83 e2 03             	and    $0x3,%edx
+  800981:	89 d8                	mov    %ebx,%eax
+  800983:	fc                   	cld
+  800984:	f3 aa                	rep stos %al,%es:(%edi)
+  800986:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  80098c:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  80098f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800991:	89 d1                	mov    %edx,%ecx
+  800993:	89 d8                	mov    %ebx,%eax
+  800995:	fc                   	cld
+  800996:	f3 aa                	rep stos %al,%es:(%edi)
+  800998:	89 f0                	mov    %esi,%eax
+  80099a:	83 c4 04             	add    $0x4,%esp
+  80099d:	5b                   	pop    %ebx
+  80099e:	5e                   	pop    %esi
+  80099f:	5f                   	pop    %edi
+  8009a0:	5d                   	pop    %ebp
+  8009a1:	c3                   	ret
+
+008009a2 <memmove>:
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	57                   	push   %edi
+  8009a6:	56                   	push   %esi
+  8009a7:	53                   	push   %ebx
+  8009a8:	83 ec 0c             	sub    $0xc,%esp
+  8009ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009b1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8009b4:	85 c0                	test   %eax,%eax
+  8009b6:	74 14                	je     8009cc <memmove+0x2a>
+  8009b8:	39 da                	cmp    %ebx,%edx
+  8009ba:	73 07                	jae    8009c3 <memmove+0x21>
+  8009bc:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8009bf:	39 cb                	cmp    %ecx,%ebx
+  8009c1:	72 13                	jb     8009d6 <memmove+0x34>
+  8009c3:	89 c1                	mov    %eax,%ecx
+  8009c5:	89 d8                	mov    %ebx,%eax
+  8009c7:	e8 94 fd ff ff       	call   800760 <copy_fwd>
+  8009cc:	89 d8                	mov    %ebx,%eax
+  8009ce:	83 c4 0c             	add    $0xc,%esp
+  8009d1:	5b                   	pop    %ebx
+  8009d2:	5e                   	pop    %esi
+  8009d3:	5f                   	pop    %edi
+  8009d4:	5d                   	pop    %ebp
+  8009d5:	c3                   	ret
+  8009d6:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  8009d9:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  8009dc:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  8009df:	83 f8 0f             	cmp    $0xf,%eax
+  8009e2:	76 23                	jbe    800a07 <memmove+0x65>
+  8009e4:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  8009e7:	83 e1 03             	and    $0x3,%ecx
+  8009ea:	29 c8                	sub    %ecx,%eax
+  8009ec:	89 c2                	mov    %eax,%edx
+  8009ee:	c1 ea 02             	shr    $0x2,%edx
+  8009f1:	83 e0 03             	and    $0x3,%eax
+  8009f4:	fd                   	std
+  8009f5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8009f7:	83 ef 03             	sub    $0x3,%edi
+  8009fa:	83 ee 03             	sub    $0x3,%esi
+  8009fd:	89 d1                	mov    %edx,%ecx
+  8009ff:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a01:	83 c7 03             	add    $0x3,%edi
+  800a04:	83 c6 03             	add    $0x3,%esi
+  800a07:	89 c1                	mov    %eax,%ecx
+  800a09:	fd                   	std
+  800a0a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a0c:	fc                   	cld
+  800a0d:	eb bd                	jmp    8009cc <memmove+0x2a>
+
+00800a0f <memcpy>:
+  800a0f:	55                   	push   %ebp
+  800a10:	89 e5                	mov    %esp,%ebp
+  800a12:	53                   	push   %ebx
+  800a13:	83 ec 04             	sub    $0x4,%esp
+  800a16:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a19:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a1c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a1f:	89 d8                	mov    %ebx,%eax
+  800a21:	e8 3a fd ff ff       	call   800760 <copy_fwd>
+  800a26:	89 d8                	mov    %ebx,%eax
+  800a28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a2b:	c9                   	leave
+  800a2c:	c3                   	ret
+
+00800a2d <page_copy>:
+  800a2d:	55                   	push   %ebp
+  800a2e:	89 e5                	mov    %esp,%ebp
+  800a30:	57                   	push   %edi
+  800a31:	56                   	push   %esi
+  800a32:	53                   	push   %ebx
+  800a33:	83 ec 0c             	sub    $0xc,%esp
+  800a36:	e8 5c fd ff ff       	call   800797 <have_sse2>
+  800a3b:	85 c0                	test   %eax,%eax
+  800a3d:	74 39                	je     800a78 <page_copy+0x4b>
+  800a3f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a42:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a45:	be 00 01 00 00       	mov    $0x100,%esi
+  800a4a:	8b 03                	mov    (%ebx),%eax
+  800a4c:	8b 53 04             	mov    0x4(%ebx),%edx
+  800a4f:	0f c3 01             	movnti %eax,(%ecx)
+  800a52:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800a56:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a59:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800a5c:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800a60:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800a64:	83 c3 10             	add    $0x10,%ebx
+  800a67:	83 c1 10             	add    $0x10,%ecx
+  800a6a:	4e                   	dec    %esi
+  800a6b:	75 dd                	jne    800a4a <page_copy+0x1d>
+  800a6d:	0f ae f8             	sfence
+  800a70:	83 c4 0c             	add    $0xc,%esp
+  800a73:	5b                   	pop    %ebx
+  800a74:	5e                   	pop    %esi
+  800a75:	5f                   	pop    %edi
+  800a76:	5d                   	pop    %ebp
+  800a77:	c3                   	ret
+  800a78:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a7b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a7e:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800a83:	fc                   	cld
+  800a84:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a86:	eb e8                	jmp    800a70 <page_copy+0x43>
+
+00800a88 <page_zero>:
+  800a88:	55                   	push   %ebp
+  800a89:	89 e5                	mov    %esp,%ebp
+  800a8b:	57                   	push   %edi
+  800a8c:	83 ec 04             	sub    $0x4,%esp
+  800a8f:	e8 03 fd ff ff       	call   800797 <have_sse2>
+  800a94:	85 c0                	test   %eax,%eax
+  800a96:	74 3a                	je     800ad2 <page_zero+0x4a>
+  800a98:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9b:	ba 80 00 00 00       	mov    $0x80,%edx
+  800aa0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa5:	0f c3 08             	movnti %ecx,(%eax)
+  800aa8:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800aac:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800ab0:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800ab4:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800ab8:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800abc:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800ac0:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800ac4:	83 c0 20             	add    $0x20,%eax
+  800ac7:	4a                   	dec    %edx
+  800ac8:	75 db                	jne    800aa5 <page_zero+0x1d>
+  800aca:	0f ae f8             	sfence
+  800acd:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ad0:	c9                   	leave
+  800ad1:	c3                   	ret
+  800ad2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ad5:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800ada:	fc                   	cld
+  800adb:	f3 ab                	rep stos %eax,%es:(%edi)
+  800add:	eb ee                	jmp    800acd <page_zero+0x45>
+
+00800adf <memcmp>:
+  800adf:	55                   	push   %ebp
+  800ae0:	89 e5                	mov    %esp,%ebp
+  800ae2:	56                   	push   %esi
+  800ae3:	53                   	push   %ebx
+  800ae4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aea:	89 c6                	mov    %eax,%esi
+  800aec:	03 75 10             	add    0x10(%ebp),%esi
+  800aef:	eb 06                	jmp    800af7 <memcmp+0x18>
+  800af1:	83 c0 01             	add    $0x1,%eax
+  800af4:	83 c2 01             	add    $0x1,%edx
+  800af7:	39 f0                	cmp    %esi,%eax
+  800af9:	74 14                	je     800b0f <memcmp+0x30>
+  800afb:	0f b6 08             	movzbl (%eax),%ecx
+  800afe:	0f b6 1a             	movzbl (%edx),%ebx
+  800b01:	38 d9                	cmp    %bl,%cl
+  800b03:	74 ec                	je     800af1 <memcmp+0x12>
+  800b05:	0f b6 c1             	movzbl %cl,%eax
+  800b08:	0f b6 db             	movzbl %bl,%ebx
+  800b0b:	29 d8                	sub    %ebx,%eax
+  800b0d:	eb 05                	jmp    800b14 <memcmp+0x35>
+  800b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b14:	5b                   	pop    %ebx
+  800b15:	5e                   	pop    %esi
+  800b16:	5d                   	pop    %ebp
+  800b17:	c3                   	ret
+
+00800b18 <memfind>:
+  800b18:	55                   	push   %ebp
+  800b19:	89 e5                	mov    %esp,%ebp
+  800b1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b21:	89 c2                	mov    %eax,%edx
+  800b23:	03 55 10             	add    0x10(%ebp),%edx
+  800b26:	eb 03                	jmp    800b2b <memfind+0x13>
+  800b28:	83 c0 01             	add    $0x1,%eax
+  800b2b:	39 d0                	cmp    %edx,%eax
+  800b2d:	73 04                	jae    800b33 <memfind+0x1b>
+  800b2f:	38 08                	cmp    %cl,(%eax)
+  800b31:	75 f5                	jne    800b28 <memfind+0x10>
+  800b33:	5d                   	pop    %ebp
+  800b34:	c3                   	ret
+
+00800b35 <strtol>:
+  800b35:	55                   	push   %ebp
+  800b36:	89 e5                	mov    %esp,%ebp
+  800b38:	57                   	push   %edi
+  800b39:	56                   	push   %esi
+  800b3a:	53                   	push   %ebx
+  800b3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b41:	eb 03                	jmp    800b46 <strtol+0x11>
+  800b43:	83 c2 01             	add    $0x1,%edx
+  800b46:	0f b6 02             	movzbl (%edx),%eax
+  800b49:	3c 20                	cmp    $0x20,%al
+  800b4b:	74 f6                	je     800b43 <strtol+0xe>
+  800b4d:	3c 09                	cmp    $0x9,%al
+  800b4f:	74 f2                	je     800b43 <strtol+0xe>
+  800b51:	3c 2b                	cmp    $0x2b,%al
+  800b53:	74 2a                	je     800b7f <strtol+0x4a>
+  800b55:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b5a:	3c 2d                	cmp    $0x2d,%al
+  800b5c:	74 2b                	je     800b89 <strtol+0x54>
+  800b5e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b64:	75 0f                	jne    800b75 <strtol+0x40>
+  800b66:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b69:	74 28                	je     800b93 <strtol+0x5e>
+  800b6b:	85 db                	test   %ebx,%ebx
+  800b6d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b72:	0f 44 d8             	cmove  %eax,%ebx
+  800b75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b7a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b7d:	eb 46                	jmp    800bc5 <strtol+0x90>
+  800b7f:	83 c2 01             	add    $0x1,%edx
+  800b82:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b87:	eb d5                	jmp    800b5e <strtol+0x29>
+  800b89:	83 c2 01             	add    $0x1,%edx
+  800b8c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b91:	eb cb                	jmp    800b5e <strtol+0x29>
+  800b93:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b97:	74 0e                	je     800ba7 <strtol+0x72>
+  800b99:	85 db                	test   %ebx,%ebx
+  800b9b:	75 d8                	jne    800b75 <strtol+0x40>
+  800b9d:	83 c2 01             	add    $0x1,%edx
+  800ba0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ba5:	eb ce                	jmp    800b75 <strtol+0x40>
+  800ba7:	83 c2 02             	add    $0x2,%edx
+  800baa:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800baf:	eb c4                	jmp    800b75 <strtol+0x40>
+  800bb1:	0f be c0             	movsbl %al,%eax
+  800bb4:	83 e8 30             	sub    $0x30,%eax
+  800bb7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bba:	7d 3a                	jge    800bf6 <strtol+0xc1>
+  800bbc:	83 c2 01             	add    $0x1,%edx
+  800bbf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bc3:	01 c1                	add    %eax,%ecx
+  800bc5:	0f b6 02             	movzbl (%edx),%eax
+  800bc8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bcb:	89 f3                	mov    %esi,%ebx
+  800bcd:	80 fb 09             	cmp    $0x9,%bl
+  800bd0:	76 df                	jbe    800bb1 <strtol+0x7c>
+  800bd2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bd5:	89 f3                	mov    %esi,%ebx
+  800bd7:	80 fb 19             	cmp    $0x19,%bl
+  800bda:	77 08                	ja     800be4 <strtol+0xaf>
+  800bdc:	0f be c0             	movsbl %al,%eax
+  800bdf:	83 e8 57             	sub    $0x57,%eax
+  800be2:	eb d3                	jmp    800bb7 <strtol+0x82>
+  800be4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800be7:	89 f3                	mov    %esi,%ebx
+  800be9:	80 fb 19             	cmp    $0x19,%bl
+  800bec:	77 08                	ja     800bf6 <strtol+0xc1>
+  800bee:	0f be c0             	movsbl %al,%eax
+  800bf1:	83 e8 37             	sub    $0x37,%eax
+  800bf4:	eb c1                	jmp    800bb7 <strtol+0x82>
+  800bf6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bfa:	74 05                	je     800c01 <strtol+0xcc>
+  800bfc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bff:	89 10                	mov    %edx,(%eax)
+  800c01:	89 c8                	mov    %ecx,%eax
+  800c03:	f7 d8                	neg    %eax
+  800c05:	85 ff                	test   %edi,%edi
+  800c07:	0f 45 c8             	cmovne %eax,%ecx
+  800c0a:	89 c8                	mov    %ecx,%eax
+  800c0c:	5b                   	pop    %ebx
+  800c0d:	5e                   	pop    %esi
+  800c0e:	5f                   	pop    %edi
+  800c0f:	5d                   	pop    %ebp
+  800c10:	c3                   	ret
+
+00800c11 <sys_cputs>:
+  800c11:	55                   	push   %ebp
+  800c12:	89 e5                	mov    %esp,%ebp
+  800c14:	57                   	push   %edi
+  800c15:	56                   	push   %esi
+  800c16:	53                   	push   %ebx
+  800c17:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c1e:	78 21                	js     800c41 <sys_cputs+0x30>
+  800c20:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c27:	75 2d                	jne    800c56 <sys_cputs+0x45>
+  800c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c34:	89 c3                	mov    %eax,%ebx
+  800c36:	89 c7                	mov    %eax,%edi
+  800c38:	89 c6                	mov    %eax,%esi
+  800c3a:	cd 30                	int    $0x30
+  800c3c:	5b                   	pop    %ebx
+  800c3d:	5e                   	pop    %esi
+  800c3e:	5f                   	pop    %edi
+  800c3f:	5d                   	pop    %ebp
+  800c40:	c3                   	ret
+  800c41:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c46:	0f a2                	cpuid
+  800c48:	c1 ea 0b             	shr    $0xb,%edx
+  800c4b:	83 e2 01             	and    $0x1,%edx
+  800c4e:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800c54:	eb ca                	jmp    800c20 <sys_cputs+0xf>
+  800c56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c61:	89 c3                	mov    %eax,%ebx
+  800c63:	89 c7                	mov    %eax,%edi
+  800c65:	89 c6                	mov    %eax,%esi
+  800c67:	55                   	push   %ebp
+  800c68:	68 71 0c 80 00       	push   $0x800c71
+  800c6d:	89 e5                	mov    %esp,%ebp
+  800c6f:	0f 34                	sysenter
+  800c71:	83 c4 04             	add    $0x4,%esp
+  800c74:	5d                   	pop    %ebp
+  800c75:	eb c5                	jmp    800c3c <sys_cputs+0x2b>
+
+00800c77 <sys_cgetc>:
+  800c77:	55                   	push   %ebp
+  800c78:	89 e5                	mov    %esp,%ebp
+  800c7a:	57                   	push   %edi
+  800c7b:	56                   	push   %esi
+  800c7c:	53                   	push   %ebx
+  800c7d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c84:	78 22                	js     800ca8 <sys_cgetc+0x31>
+  800c86:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c8d:	75 2e                	jne    800cbd <sys_cgetc+0x46>
+  800c8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c94:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c99:	89 d1                	mov    %edx,%ecx
+  800c9b:	89 d3                	mov    %edx,%ebx
+  800c9d:	89 d7                	mov    %edx,%edi
+  800c9f:	89 d6                	mov    %edx,%esi
+  800ca1:	cd 30                	int    $0x30
+  800ca3:	5b                   	pop    %ebx
+  800ca4:	5e                   	pop    %esi
+  800ca5:	5f                   	pop    %edi
+  800ca6:	5d                   	pop    %ebp
+  800ca7:	c3                   	ret
+  800ca8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cad:	0f a2                	cpuid
+  800caf:	c1 ea 0b             	shr    $0xb,%edx
+  800cb2:	83 e2 01             	and    $0x1,%edx
+  800cb5:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800cbb:	eb c9                	jmp    800c86 <sys_cgetc+0xf>
+  800cbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc2:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cc7:	89 d1                	mov    %edx,%ecx
+  800cc9:	89 d3                	mov    %edx,%ebx
+  800ccb:	89 d7                	mov    %edx,%edi
+  800ccd:	89 d6                	mov    %edx,%esi
+  800ccf:	55                   	push   %ebp
+  800cd0:	68 d9 0c 80 00       	push   $0x800cd9
+  800cd5:	89 e5                	mov    %esp,%ebp
+  800cd7:	0f 34                	sysenter
+  800cd9:	83 c4 04             	add    $0x4,%esp
+  800cdc:	5d                   	pop    %ebp
+  800cdd:	eb c4                	jmp    800ca3 <sys_cgetc+0x2c>
+
+00800cdf <sys_env_destroy>:
+  800cdf:	55                   	push   %ebp
+  800ce0:	89 e5                	mov    %esp,%ebp
+  800ce2:	57                   	push   %edi
+  800ce3:	56                   	push   %esi
+  800ce4:	53                   	push   %ebx
+  800ce5:	83 ec 0c             	sub    $0xc,%esp
+  800ce8:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800cef:	78 2a                	js     800d1b <sys_env_destroy+0x3c>
+  800cf1:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800cf8:	75 36                	jne    800d30 <sys_env_destroy+0x51>
+  800cfa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cff:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d07:	89 cb                	mov    %ecx,%ebx
+  800d09:	89 cf                	mov    %ecx,%edi
+  800d0b:	89 ce                	mov    %ecx,%esi
+  800d0d:	cd 30                	int    $0x30
+  800d0f:	85 c0                	test   %eax,%eax
+  800d11:	7f 40                	jg     800d53 <sys_env_destroy+0x74>
+  800d13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d16:	5b                   	pop    %ebx
+  800d17:	5e                   	pop    %esi
+  800d18:	5f                   	pop    %edi
+  800d19:	5d                   	pop    %ebp
+  800d1a:	c3                   	ret
+  800d1b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d20:	0f a2                	cpuid
+  800d22:	c1 ea 0b             	shr    $0xb,%edx
+  800d25:	83 e2 01             	and    $0x1,%edx
+  800d28:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800d2e:	eb c1                	jmp    800cf1 <sys_env_destroy+0x12>
+  800d30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d38:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d3d:	89 cb                	mov    %ecx,%ebx
+  800d3f:	89 cf                	mov    %ecx,%edi
+  800d41:	89 ce                	mov    %ecx,%esi
+  800d43:	55                   	push   %ebp
+  800d44:	68 4d 0d 80 00       	push   $0x800d4d
+  800d49:	89 e5                	mov    %esp,%ebp
+  800d4b:	0f 34                	sysenter
+  800d4d:	83 c4 04             	add    $0x4,%esp
+  800d50:	5d                   	pop    %ebp
+  800d51:	eb bc                	jmp    800d0f <sys_env_destroy+0x30>
+  800d53:	83 ec 0c             	sub    $0xc,%esp
+  800d56:	50                   	push   %eax
+  800d57:	6a 03                	push   $0x3
+  800d59:	68 a4 20 80 00       	push   $0x8020a4
+  800d5e:	6a 49                	push   $0x49
+  800d60:	68 c1 20 80 00       	push   $0x8020c1
+  800d65:	e8 f3 0c 00 00       	call   801a5d <_panic>
+
+00800d6a <sys_getenvid>:
+  800d6a:	55                   	push   %ebp
+  800d6b:	89 e5                	mov    %esp,%ebp
+  800d6d:	57                   	push   %edi
+  800d6e:	56                   	push   %esi
+  800d6f:	53                   	push   %ebx
+  800d70:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d77:	78 22                	js     800d9b <sys_getenvid+0x31>
+  800d79:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d80:	75 2e                	jne    800db0 <sys_getenvid+0x46>
+  800d82:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d87:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d8c:	89 d1                	mov    %edx,%ecx
+  800d8e:	89 d3                	mov    %edx,%ebx
+  800d90:	89 d7                	mov    %edx,%edi
+  800d92:	89 d6                	mov    %edx,%esi
+  800d94:	cd 30                	int    $0x30
+  800d96:	5b                   	pop    %ebx
+  800d97:	5e                   	pop    %esi
+  800d98:	5f                   	pop    %edi
+  800d99:	5d                   	pop    %ebp
+  800d9a:	c3                   	ret
+  800d9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da0:	0f a2                	cpuid
+  800da2:	c1 ea 0b             	shr    $0xb,%edx
+  800da5:	83 e2 01             	and    $0x1,%edx
+  800da8:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800dae:	eb c9                	jmp    800d79 <sys_getenvid+0xf>
+  800db0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db5:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dba:	89 d1                	mov    %edx,%ecx
+  800dbc:	89 d3                	mov    %edx,%ebx
+  800dbe:	89 d7                	mov    %edx,%edi
+  800dc0:	89 d6                	mov    %edx,%esi
+  800dc2:	55                   	push   %ebp
+  800dc3:	68 cc 0d 80 00       	push   $0x800dcc
+  800dc8:	89 e5                	mov    %esp,%ebp
+  800dca:	0f 34                	sysenter
+  800dcc:	83 c4 04             	add    $0x4,%esp
+  800dcf:	5d                   	pop    %ebp
+  800dd0:	eb c4                	jmp    800d96 <sys_getenvid+0x2c>
+
+00800dd2 <sys_yield>:
+  800dd2:	55                   	push   %ebp
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	57                   	push   %edi
+  800dd6:	56                   	push   %esi
+  800dd7:	53                   	push   %ebx
+  800dd8:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ddf:	78 22                	js     800e03 <sys_yield+0x31>
+  800de1:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800de8:	75 2e                	jne    800e18 <sys_yield+0x46>
+  800dea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800def:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800df4:	89 d1                	mov    %edx,%ecx
+  800df6:	89 d3                	mov    %edx,%ebx
+  800df8:	89 d7                	mov    %edx,%edi
+  800dfa:	89 d6                	mov    %edx,%esi
+  800dfc:	cd 30                	int    $0x30
+  800dfe:	5b                   	pop    %ebx
+  800dff:	5e                   	pop    %esi
+  800e00:	5f                   	pop    %edi
+  800e01:	5d                   	pop    %ebp
+  800e02:	c3                   	ret
+  800e03:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e08:	0f a2                	cpuid
+  800e0a:	c1 ea 0b             	shr    $0xb,%edx
+  800e0d:	83 e2 01             	and    $0x1,%edx
+  800e10:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800e16:	eb c9                	jmp    800de1 <sys_yield+0xf>
+  800e18:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e22:	89 d1                	mov    %edx,%ecx
+  800e24:	89 d3                	mov    %edx,%ebx
+  800e26:	89 d7                	mov    %edx,%edi
+  800e28:	89 d6                	mov    %edx,%esi
+  800e2a:	55                   	push   %ebp
+  800e2b:	68 34 0e 80 00       	push   $0x800e34
+  800e30:	89 e5                	mov    %esp,%ebp
+  800e32:	0f 34                	sysenter
+  800e34:	83 c4 04             	add    $0x4,%esp
+  800e37:	5d                   	pop    %ebp
+  800e38:	eb c4                	jmp    800dfe <sys_yield+0x2c>
+
+00800e3a <sys_env_set_cow>:
+  800e3a:	55                   	push   %ebp
+  800e3b:	89 e5                	mov    %esp,%ebp
+  800e3d:	57                   	push   %edi
+  800e3e:	56                   	push   %esi
+  800e3f:	53                   	push   %ebx
+  800e40:	83 ec 0c             	sub    $0xc,%esp
+  800e43:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e4a:	78 2b                	js     800e77 <sys_env_set_cow+0x3d>
+  800e4c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e53:	75 37                	jne    800e8c <sys_env_set_cow+0x52>
+  800e55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e5a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e65:	89 df                	mov    %ebx,%edi
+  800e67:	89 de                	mov    %ebx,%esi
+  800e69:	cd 30                	int    $0x30
+  800e6b:	85 c0                	test   %eax,%eax
+  800e6d:	7f 41                	jg     800eb0 <sys_env_set_cow+0x76>
+  800e6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e72:	5b                   	pop    %ebx
+  800e73:	5e                   	pop    %esi
+  800e74:	5f                   	pop    %edi
+  800e75:	5d                   	pop    %ebp
+  800e76:	c3                   	ret
+  800e77:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e7c:	0f a2                	cpuid
+  800e7e:	c1 ea 0b             	shr    $0xb,%edx
+  800e81:	83 e2 01             	and    $0x1,%edx
+  800e84:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800e8a:	eb c0                	jmp    800e4c <sys_env_set_cow+0x12>
+  800e8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e97:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e9c:	89 df                	mov    %ebx,%edi
+  800e9e:	89 de                	mov    %ebx,%esi
+  800ea0:	55                   	push   %ebp
+  800ea1:	68 aa 0e 80 00       	push   $0x800eaa
+  800ea6:	89 e5                	mov    %esp,%ebp
+  800ea8:	0f 34                	sysenter
+  800eaa:	83 c4 04             	add    $0x4,%esp
+  800ead:	5d                   	pop    %ebp
+  800eae:	eb bb                	jmp    800e6b <sys_env_set_cow+0x31>
+  800eb0:	83 ec 0c             	sub    $0xc,%esp
+  800eb3:	50                   	push   %eax
+  800eb4:	6a 0d                	push   $0xd
+  800eb6:	68 a4 20 80 00       	push   $0x8020a4
+  800ebb:	6a 49                	push   $0x49
+  800ebd:	68 c1 20 80 00       	push   $0x8020c1
+  800ec2:	e8 96 0b 00 00       	call   801a5d <_panic>
+
+00800ec7 <sys_env_set_quota>:
+  800ec7:	55                   	push   %ebp
+  800ec8:	89 e5                	mov    %esp,%ebp
+  800eca:	57                   	push   %edi
+  800ecb:	56                   	push   %esi
+  800ecc:	53                   	push   %ebx
+  800ecd:	83 ec 0c             	sub    $0xc,%esp
+  800ed0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ed7:	78 2b                	js     800f04 <sys_env_set_quota+0x3d>
+  800ed9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ee0:	75 37                	jne    800f19 <sys_env_set_quota+0x52>
+  800ee2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800eec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef2:	89 df                	mov    %ebx,%edi
+  800ef4:	89 de                	mov    %ebx,%esi
+  800ef6:	cd 30                	int    $0x30
+  800ef8:	85 c0                	test   %eax,%eax
+  800efa:	7f 41                	jg     800f3d <sys_env_set_quota+0x76>
+  800efc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eff:	5b                   	pop    %ebx
+  800f00:	5e                   	pop    %esi
+  800f01:	5f                   	pop    %edi
+  800f02:	5d                   	pop    %ebp
+  800f03:	c3                   	ret
+  800f04:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f09:	0f a2                	cpuid
+  800f0b:	c1 ea 0b             	shr    $0xb,%edx
+  800f0e:	83 e2 01             	and    $0x1,%edx
+  800f11:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800f17:	eb c0                	jmp    800ed9 <sys_env_set_quota+0x12>
+  800f19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f24:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f29:	89 df                	mov    %ebx,%edi
+  800f2b:	89 de                	mov    %ebx,%esi
+  800f2d:	55                   	push   %ebp
+  800f2e:	68 37 0f 80 00       	push   $0x800f37
+  800f33:	89 e5                	mov    %esp,%ebp
+  800f35:	0f 34                	sysenter
+  800f37:	83 c4 04             	add    $0x4,%esp
+  800f3a:	5d                   	pop    %ebp
+  800f3b:	eb bb                	jmp    800ef8 <sys_env_set_quota+0x31>
+  800f3d:	83 ec 0c             	sub    $0xc,%esp
+  800f40:	50                   	push   %eax
+  800f41:	6a 0f                	push   $0xf
+  800f43:	68 a4 20 80 00       	push   $0x8020a4
+  800f48:	6a 49                	push   $0x49
+  800f4a:	68 c1 20 80 00       	push   $0x8020c1
+  800f4f:	e8 09 0b 00 00       	call   801a5d <_panic>
+
+00800f54 <sys_page_alloc>:
+  800f54:	55                   	push   %ebp
+  800f55:	89 e5                	mov    %esp,%ebp
+  800f57:	57                   	push   %edi
+  800f58:	56                   	push   %esi
+  800f59:	53                   	push   %ebx
+  800f5a:	83 ec 0c             	sub    $0xc,%esp
+  800f5d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f64:	78 2c                	js     800f92 <sys_page_alloc+0x3e>
+  800f66:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f6d:	75 38                	jne    800fa7 <sys_page_alloc+0x53>
+  800f6f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f74:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f82:	89 f7                	mov    %esi,%edi
+  800f84:	cd 30                	int    $0x30
+  800f86:	85 c0                	test   %eax,%eax
+  800f88:	7f 42                	jg     800fcc <sys_page_alloc+0x78>
+  800f8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8d:	5b                   	pop    %ebx
+  800f8e:	5e                   	pop    %esi
+  800f8f:	5f                   	pop    %edi
+  800f90:	5d                   	pop    %ebp
+  800f91:	c3                   	ret
+  800f92:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f97:	0f a2                	cpuid
+  800f99:	c1 ea 0b             	shr    $0xb,%edx
+  800f9c:	83 e2 01             	and    $0x1,%edx
+  800f9f:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800fa5:	eb bf                	jmp    800f66 <sys_page_alloc+0x12>
+  800fa7:	be 00 00 00 00       	mov    $0x0,%esi
+  800fac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800faf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fb7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fba:	89 f7                	mov    %esi,%edi
+  800fbc:	55                   	push   %ebp
+  800fbd:	68 c6 0f 80 00       	push   $0x800fc6
+  800fc2:	89 e5                	mov    %esp,%ebp
+  800fc4:	0f 34                	sysenter
+  800fc6:	83 c4 04             	add    $0x4,%esp
+  800fc9:	5d                   	pop    %ebp
+  800fca:	eb ba                	jmp    800f86 <sys_page_alloc+0x32>
+  800fcc:	83 ec 0c             	sub    $0xc,%esp
+  800fcf:	50                   	push   %eax
+  800fd0:	6a 04                	push   $0x4
+  800fd2:	68 a4 20 80 00       	push   $0x8020a4
+  800fd7:	6a 49                	push   $0x49
+  800fd9:	68 c1 20 80 00       	push   $0x8020c1
+  800fde:	e8 7a 0a 00 00       	call   801a5d <_panic>
+
+00800fe3 <sys_page_map>:
+  800fe3:	55                   	push   %ebp
+  800fe4:	89 e5                	mov    %esp,%ebp
+  800fe6:	57                   	push   %edi
+  800fe7:	56                   	push   %esi
+  800fe8:	53                   	push   %ebx
+  800fe9:	83 ec 0c             	sub    $0xc,%esp
+  800fec:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ff3:	78 2b                	js     801020 <sys_page_map+0x3d>
+  800ff5:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ffc:	75 37                	jne    801035 <sys_page_map+0x52>
+  800ffe:	b8 05 00 00 00       	mov    $0x5,%eax
+  801003:	8b 55 08             	mov    0x8(%ebp),%edx
+  801006:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801009:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80100f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801012:	cd 30                	int    $0x30
+  801014:	85 c0                	test   %eax,%eax
+  801016:	7f 41                	jg     801059 <sys_page_map+0x76>
+  801018:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101b:	5b                   	pop    %ebx
+  80101c:	5e                   	pop    %esi
+  80101d:	5f                   	pop    %edi
+  80101e:	5d                   	pop    %ebp
+  80101f:	c3                   	ret
+  801020:	b8 01 00 00 00       	mov    $0x1,%eax
+  801025:	0f a2                	cpuid
+  801027:	c1 ea 0b             	shr    $0xb,%edx
+  80102a:	83 e2 01             	and    $0x1,%edx
+  80102d:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801033:	eb c0                	jmp    800ff5 <sys_page_map+0x12>
+  801035:	8b 55 08             	mov    0x8(%ebp),%edx
+  801038:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801040:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801043:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801046:	8b 75 18             	mov    0x18(%ebp),%esi
+  801049:	55                   	push   %ebp
+  80104a:	68 53 10 80 00       	push   $0x801053
+  80104f:	89 e5                	mov    %esp,%ebp
+  801051:	0f 34                	sysenter
+  801053:	83 c4 04             	add    $0x4,%esp
+  801056:	5d                   	pop    %ebp
+  801057:	eb bb                	jmp    801014 <sys_page_map+0x31>
+  801059:	83 ec 0c             	sub    $0xc,%esp
+  80105c:	50                   	push   %eax
+  80105d:	6a 05                	push   $0x5
+  80105f:	68 a4 20 80 00       	push   $0x8020a4
+  801064:	6a 49                	push   $0x49
+  801066:	68 c1 20 80 00       	push   $0x8020c1
+  80106b:	e8 ed 09 00 00       	call   801a5d <_panic>
+
+00801070 <sys_page_unmap>:
+  801070:	55                   	push   %ebp
+  801071:	89 e5                	mov    %esp,%ebp
+  801073:	57                   	push   %edi
+  801074:	56                   	push   %esi
+  801075:	53                   	push   %ebx
+  801076:	83 ec 0c             	sub    $0xc,%esp
+  801079:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801080:	78 2b                	js     8010ad <sys_page_unmap+0x3d>
+  801082:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801089:	75 37                	jne    8010c2 <sys_page_unmap+0x52>
+  80108b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801090:	b8 06 00 00 00       	mov    $0x6,%eax
+  801095:	8b 55 08             	mov    0x8(%ebp),%edx
+  801098:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109b:	89 df                	mov    %ebx,%edi
+  80109d:	89 de                	mov    %ebx,%esi
+  80109f:	cd 30                	int    $0x30
+  8010a1:	85 c0                	test   %eax,%eax
+  8010a3:	7f 41                	jg     8010e6 <sys_page_unmap+0x76>
+  8010a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a8:	5b                   	pop    %ebx
+  8010a9:	5e                   	pop    %esi
+  8010aa:	5f                   	pop    %edi
+  8010ab:	5d                   	pop    %ebp
+  8010ac:	c3                   	ret
+  8010ad:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010b2:	0f a2                	cpuid
+  8010b4:	c1 ea 0b             	shr    $0xb,%edx
+  8010b7:	83 e2 01             	and    $0x1,%edx
+  8010ba:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8010c0:	eb c0                	jmp    801082 <sys_page_unmap+0x12>
+  8010c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cd:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010d2:	89 df                	mov    %ebx,%edi
+  8010d4:	89 de                	mov    %ebx,%esi
+  8010d6:	55                   	push   %ebp
+  8010d7:	68 e0 10 80 00       	push   $0x8010e0
+  8010dc:	89 e5                	mov    %esp,%ebp
+  8010de:	0f 34                	sysenter
+  8010e0:	83 c4 04             	add    $0x4,%esp
+  8010e3:	5d                   	pop    %ebp
+  8010e4:	eb bb                	jmp    8010a1 <sys_page_unmap+0x31>
+  8010e6:	83 ec 0c             	sub    $0xc,%esp
+  8010e9:	50                   	push   %eax
+  8010ea:	6a 06                	push   $0x6
+  8010ec:	68 a4 20 80 00       	push   $0x8020a4
+  8010f1:	6a 49                	push   $0x49
+  8010f3:	68 c1 20 80 00       	push   $0x8020c1
+  8010f8:	e8 60 09 00 00       	call   801a5d <_panic>
+
+008010fd <sys_page_reuse>:
+  8010fd:	55                   	push   %ebp
+  8010fe:	89 e5                	mov    %esp,%ebp
+  801100:	57                   	push   %edi
+  801101:	56                   	push   %esi
+  801102:	53                   	push   %ebx
+  801103:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80110a:	78 24                	js     801130 <sys_page_reuse+0x33>
+  80110c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801113:	75 30                	jne    801145 <sys_page_reuse+0x48>
+  801115:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80111f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801122:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801125:	89 df                	mov    %ebx,%edi
+  801127:	89 de                	mov    %ebx,%esi
+  801129:	cd 30                	int    $0x30
+  80112b:	5b                   	pop    %ebx
+  80112c:	5e                   	pop    %esi
+  80112d:	5f                   	pop    %edi
+  80112e:	5d                   	pop    %ebp
+  80112f:	c3                   	ret
+  801130:	b8 01 00 00 00       	mov    $0x1,%eax
+  801135:	0f a2                	cpuid
+  801137:	c1 ea 0b             	shr    $0xb,%edx
+  80113a:	83 e2 01             	and    $0x1,%edx
+  80113d:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801143:	eb c7                	jmp    80110c <sys_page_reuse+0xf>
+  801145:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801150:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801155:	89 df                	mov    %ebx,%edi
+  801157:	89 de                	mov    %ebx,%esi
+  801159:	55                   	push   %ebp
+  80115a:	68 63 11 80 00       	push   $0x801163
+  80115f:	89 e5                	mov    %esp,%ebp
+  801161:	0f 34                	sysenter
+  801163:	83 c4 04             	add    $0x4,%esp
+  801166:	5d                   	pop    %ebp
+  801167:	eb c2                	jmp    80112b <sys_page_reuse+0x2e>
+
+00801169 <sys_env_set_status>:
+  801169:	55                   	push   %ebp
+  80116a:	89 e5                	mov    %esp,%ebp
+  80116c:	57                   	push   %edi
+  80116d:	56                   	push   %esi
+  80116e:	53                   	push   %ebx
+  80116f:	83 ec 0c             	sub    $0xc,%esp
+  801172:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801179:	78 2b                	js     8011a6 <sys_env_set_status+0x3d>
+  80117b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801182:	75 37                	jne    8011bb <sys_env_set_status+0x52>
+  801184:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801189:	b8 08 00 00 00       	mov    $0x8,%eax
+  80118e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801191:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801194:	89 df                	mov    %ebx,%edi
+  801196:	89 de                	mov    %ebx,%esi
+  801198:	cd 30                	int    $0x30
+  80119a:	85 c0                	test   %eax,%eax
+  80119c:	7f 41                	jg     8011df <sys_env_set_status+0x76>
+  80119e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a1:	5b                   	pop    %ebx
+  8011a2:	5e                   	pop    %esi
+  8011a3:	5f                   	pop    %edi
+  8011a4:	5d                   	pop    %ebp
+  8011a5:	c3                   	ret
+  8011a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011ab:	0f a2                	cpuid
+  8011ad:	c1 ea 0b             	shr    $0xb,%edx
+  8011b0:	83 e2 01             	and    $0x1,%edx
+  8011b3:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8011b9:	eb c0                	jmp    80117b <sys_env_set_status+0x12>
+  8011bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011cb:	89 df                	mov    %ebx,%edi
+  8011cd:	89 de                	mov    %ebx,%esi
+  8011cf:	55                   	push   %ebp
+  8011d0:	68 d9 11 80 00       	push   $0x8011d9
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	0f 34                	sysenter
+  8011d9:	83 c4 04             	add    $0x4,%esp
+  8011dc:	5d                   	pop    %ebp
+  8011dd:	eb bb                	jmp    80119a <sys_env_set_status+0x31>
+  8011df:	83 ec 0c             	sub    $0xc,%esp
+  8011e2:	50                   	push   %eax
+  8011e3:	6a 08                	push   $0x8
+  8011e5:	68 a4 20 80 00       	push   $0x8020a4
+  8011ea:	6a 49                	push   $0x49
+  8011ec:	68 c1 20 80 00       	push   $0x8020c1
+  8011f1:	e8 67 08 00 00       	call   801a5d <_panic>
+
+008011f6 <sys_env_set_pgfault_upcall>:
+  8011f6:	55                   	push   %ebp
+  8011f7:	89 e5                	mov    %esp,%ebp
+  8011f9:	57                   	push   %edi
+  8011fa:	56                   	push   %esi
+  8011fb:	53                   	push   %ebx
+  8011fc:	83 ec 0c             	sub    $0xc,%esp
+  8011ff:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801206:	78 2b                	js     801233 <sys_env_set_pgfault_upcall+0x3d>
+  801208:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80120f:	75 37                	jne    801248 <sys_env_set_pgfault_upcall+0x52>
+  801211:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801216:	b8 09 00 00 00       	mov    $0x9,%eax
+  80121b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801221:	89 df                	mov    %ebx,%edi
+  801223:	89 de                	mov    %ebx,%esi
+  801225:	cd 30                	int    $0x30
+  801227:	85 c0                	test   %eax,%eax
+  801229:	7f 41                	jg     80126c <sys_env_set_pgfault_upcall+0x76>
+  80122b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122e:	5b                   	pop    %ebx
+  80122f:	5e                   	pop    %esi
+  801230:	5f                   	pop    %edi
+  801231:	5d                   	pop    %ebp
+  801232:	c3                   	ret
+  801233:	b8 01 00 00 00       	mov    $0x1,%eax
+  801238:	0f a2                	cpuid
+  80123a:	c1 ea 0b             	shr    $0xb,%edx
+  80123d:	83 e2 01             	and    $0x1,%edx
+  801240:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801246:	eb c0                	jmp    801208 <sys_env_set_pgfault_upcall+0x12>
+  801248:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801250:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801253:	b8 09 00 00 00       	mov    $0x9,%eax
+  801258:	89 df                	mov    %ebx,%edi
+  80125a:	89 de                	mov    %ebx,%esi
+  80125c:	55                   	push   %ebp
+  80125d:	68 66 12 80 00       	push   $0x801266
+  801262:	89 e5                	mov    %esp,%ebp
+  801264:	0f 34                	sysenter
+  801266:	83 c4 04             	add    $0x4,%esp
+  801269:	5d                   	pop    %ebp
+  80126a:	eb bb                	jmp    801227 <sys_env_set_pgfault_upcall+0x31>
+  80126c:	83 ec 0c             	sub    $0xc,%esp
+  80126f:	50                   	push   %eax
+  801270:	6a 09                	push   $0x9
+  801272:	68 a4 20 80 00       	push   $0x8020a4
+  801277:	6a 49                	push   $0x49
+  801279:	68 c1 20 80 00       	push   $0x8020c1
+  80127e:	e8 da 07 00 00       	call   801a5d <_panic>
+
+00801283 <sys_env_set_trace>:
+  801283:	55                   	push   %ebp
+  801284:	89 e5                	mov    %esp,%ebp
+  801286:	57                   	push   %edi
+  801287:	56                   	push   %esi
+  801288:	53                   	push   %ebx
+  801289:	83 ec 0c             	sub    $0xc,%esp
+  80128c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801293:	78 2b                	js     8012c0 <sys_env_set_trace+0x3d>
+  801295:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80129c:	75 37                	jne    8012d5 <sys_env_set_trace+0x52>
+  80129e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a3:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ae:	89 df                	mov    %ebx,%edi
+  8012b0:	89 de                	mov    %ebx,%esi
+  8012b2:	cd 30                	int    $0x30
+  8012b4:	85 c0                	test   %eax,%eax
+  8012b6:	7f 41                	jg     8012f9 <sys_env_set_trace+0x76>
+  8012b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012bb:	5b                   	pop    %ebx
+  8012bc:	5e                   	pop    %esi
+  8012bd:	5f                   	pop    %edi
+  8012be:	5d                   	pop    %ebp
+  8012bf:	c3                   	ret
+  8012c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012c5:	0f a2                	cpuid
+  8012c7:	c1 ea 0b             	shr    $0xb,%edx
+  8012ca:	83 e2 01             	and    $0x1,%edx
+  8012cd:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8012d3:	eb c0                	jmp    801295 <sys_env_set_trace+0x12>
+  8012d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e0:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012e5:	89 df                	mov    %ebx,%edi
+  8012e7:	89 de                	mov    %ebx,%esi
+  8012e9:	55                   	push   %ebp
+  8012ea:	68 f3 12 80 00       	push   $0x8012f3
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	0f 34                	sysenter
+  8012f3:	83 c4 04             	add    $0x4,%esp
+  8012f6:	5d                   	pop    %ebp
+  8012f7:	eb bb                	jmp    8012b4 <sys_env_set_trace+0x31>
+  8012f9:	83 ec 0c             	sub    $0xc,%esp
+  8012fc:	50                   	push   %eax
+  8012fd:	6a 12                	push   $0x12
+  8012ff:	68 a4 20 80 00       	push   $0x8020a4
+  801304:	6a 49                	push   $0x49
+  801306:	68 c1 20 80 00       	push   $0x8020c1
+  80130b:	e8 4d 07 00 00       	call   801a5d <_panic>
+
+00801310 <sys_env_set_rdpmc>:
+  801310:	55                   	push   %ebp
+  801311:	89 e5                	mov    %esp,%ebp
+  801313:	57                   	push   %edi
+  801314:	56                   	push   %esi
+  801315:	53                   	push   %ebx
+  801316:	83 ec 0c             	sub    $0xc,%esp
+  801319:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801320:	78 2b                	js     80134d <sys_env_set_rdpmc+0x3d>
+  801322:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801329:	75 37                	jne    801362 <sys_env_set_rdpmc+0x52>
+  80132b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801330:	b8 13 00 00 00       	mov    $0x13,%eax
+  801335:	8b 55 08             	mov    0x8(%ebp),%edx
+  801338:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133b:	89 df                	mov    %ebx,%edi
+  80133d:	89 de                	mov    %ebx,%esi
+  80133f:	cd 30                	int    $0x30
+  801341:	85 c0                	test   %eax,%eax
+  801343:	7f 41                	jg     801386 <sys_env_set_rdpmc+0x76>
+  801345:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801348:	5b                   	pop    %ebx
+  801349:	5e                   	pop    %esi
+  80134a:	5f                   	pop    %edi
+  80134b:	5d                   	pop    %ebp
+  80134c:	c3                   	ret
+  80134d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801352:	0f a2                	cpuid
+  801354:	c1 ea 0b             	shr    $0xb,%edx
+  801357:	83 e2 01             	and    $0x1,%edx
+  80135a:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801360:	eb c0                	jmp    801322 <sys_env_set_rdpmc+0x12>
+  801362:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801367:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801372:	89 df                	mov    %ebx,%edi
+  801374:	89 de                	mov    %ebx,%esi
+  801376:	55                   	push   %ebp
+  801377:	68 80 13 80 00       	push   $0x801380
+  80137c:	89 e5                	mov    %esp,%ebp
+  80137e:	0f 34                	sysenter
+  801380:	83 c4 04             	add    $0x4,%esp
+  801383:	5d                   	pop    %ebp
+  801384:	eb bb                	jmp    801341 <sys_env_set_rdpmc+0x31>
+  801386:	83 ec 0c             	sub    $0xc,%esp
+  801389:	50                   	push   %eax
+  80138a:	6a 13                	push   $0x13
+  80138c:	68 a4 20 80 00       	push   $0x8020a4
+  801391:	6a 49                	push   $0x49
+  801393:	68 c1 20 80 00       	push   $0x8020c1
+  801398:	e8 c0 06 00 00       	call   801a5d <_panic>
+
+0080139d <sys_ring_setup>:
+  80139d:	55                   	push   %ebp
+  80139e:	89 e5                	mov    %esp,%ebp
+  8013a0:	57                   	push   %edi
+  8013a1:	56                   	push   %esi
+  8013a2:	53                   	push   %ebx
+  8013a3:	83 ec 0c             	sub    $0xc,%esp
+  8013a6:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013ad:	78 29                	js     8013d8 <sys_ring_setup+0x3b>
+  8013af:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013b6:	75 35                	jne    8013ed <sys_ring_setup+0x50>
+  8013b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013bd:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013c2:	89 d1                	mov    %edx,%ecx
+  8013c4:	89 d3                	mov    %edx,%ebx
+  8013c6:	89 d7                	mov    %edx,%edi
+  8013c8:	89 d6                	mov    %edx,%esi
+  8013ca:	cd 30                	int    $0x30
+  8013cc:	85 c0                	test   %eax,%eax
+  8013ce:	7f 3f                	jg     80140f <sys_ring_setup+0x72>
+  8013d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d3:	5b                   	pop    %ebx
+  8013d4:	5e                   	pop    %esi
+  8013d5:	5f                   	pop    %edi
+  8013d6:	5d                   	pop    %ebp
+  8013d7:	c3                   	ret
+  8013d8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013dd:	0f a2                	cpuid
+  8013df:	c1 ea 0b             	shr    $0xb,%edx
+  8013e2:	83 e2 01             	and    $0x1,%edx
+  8013e5:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8013eb:	eb c2                	jmp    8013af <sys_ring_setup+0x12>
+  8013ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f2:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013f7:	89 d1                	mov    %edx,%ecx
+  8013f9:	89 d3                	mov    %edx,%ebx
+  8013fb:	89 d7                	mov    %edx,%edi
+  8013fd:	89 d6                	mov    %edx,%esi
+  8013ff:	55                   	push   %ebp
+  801400:	68 09 14 80 00       	push   $0x801409
+  801405:	89 e5                	mov    %esp,%ebp
+  801407:	0f 34                	sysenter
+  801409:	83 c4 04             	add    $0x4,%esp
+  80140c:	5d                   	pop    %ebp
+  80140d:	eb bd                	jmp    8013cc <sys_ring_setup+0x2f>
+  80140f:	83 ec 0c             	sub    $0xc,%esp
+  801412:	50                   	push   %eax
+  801413:	6a 10                	push   $0x10
+  801415:	68 a4 20 80 00       	push   $0x8020a4
+  80141a:	6a 49                	push   $0x49
+  80141c:	68 c1 20 80 00       	push   $0x8020c1
+  801421:	e8 37 06 00 00       	call   801a5d <_panic>
+
+00801426 <sys_ring_enter>:
+  801426:	55                   	push   %ebp
+  801427:	89 e5                	mov    %esp,%ebp
+  801429:	57                   	push   %edi
+  80142a:	56                   	push   %esi
+  80142b:	53                   	push   %ebx
+  80142c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801433:	78 22                	js     801457 <sys_ring_enter+0x31>
+  801435:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80143c:	75 2e                	jne    80146c <sys_ring_enter+0x46>
+  80143e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801443:	b8 11 00 00 00       	mov    $0x11,%eax
+  801448:	89 d1                	mov    %edx,%ecx
+  80144a:	89 d3                	mov    %edx,%ebx
+  80144c:	89 d7                	mov    %edx,%edi
+  80144e:	89 d6                	mov    %edx,%esi
+  801450:	cd 30                	int    $0x30
+  801452:	5b                   	pop    %ebx
+  801453:	5e                   	pop    %esi
+  801454:	5f                   	pop    %edi
+  801455:	5d                   	pop    %ebp
+  801456:	c3                   	ret
+  801457:	b8 01 00 00 00       	mov    $0x1,%eax
+  80145c:	0f a2                	cpuid
+  80145e:	c1 ea 0b             	shr    $0xb,%edx
+  801461:	83 e2 01             	and    $0x1,%edx
+  801464:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80146a:	eb c9                	jmp    801435 <sys_ring_enter+0xf>
+  80146c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801471:	b8 11 00 00 00       	mov    $0x11,%eax
+  801476:	89 d1                	mov    %edx,%ecx
+  801478:	89 d3                	mov    %edx,%ebx
+  80147a:	89 d7                	mov    %edx,%edi
+  80147c:	89 d6                	mov    %edx,%esi
+  80147e:	55                   	push   %ebp
+  80147f:	68 88 14 80 00       	push   $0x801488
+  801484:	89 e5                	mov    %esp,%ebp
+  801486:	0f 34                	sysenter
+  801488:	83 c4 04             	add    $0x4,%esp
+  80148b:	5d                   	pop    %ebp
+  80148c:	eb c4                	jmp    801452 <sys_ring_enter+0x2c>
+
+0080148e <sys_ipc_try_send>:
+  80148e:	55                   	push   %ebp
+  80148f:	89 e5                	mov    %esp,%ebp
+  801491:	57                   	push   %edi
+  801492:	56                   	push   %esi
+  801493:	53                   	push   %ebx
+  801494:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80149b:	78 26                	js     8014c3 <sys_ipc_try_send+0x35>
+  80149d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014a4:	75 32                	jne    8014d8 <sys_ipc_try_send+0x4a>
+  8014a6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014bc:	cd 30                	int    $0x30
+  8014be:	5b                   	pop    %ebx
+  8014bf:	5e                   	pop    %esi
+  8014c0:	5f                   	pop    %edi
+  8014c1:	5d                   	pop    %ebp
+  8014c2:	c3                   	ret
+  8014c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014c8:	0f a2                	cpuid
+  8014ca:	c1 ea 0b             	shr    $0xb,%edx
+  8014cd:	83 e2 01             	and    $0x1,%edx
+  8014d0:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8014d6:	eb c5                	jmp    80149d <sys_ipc_try_send+0xf>
+  8014d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014de:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014eb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014ee:	55                   	push   %ebp
+  8014ef:	68 f8 14 80 00       	push   $0x8014f8
+  8014f4:	89 e5                	mov    %esp,%ebp
+  8014f6:	0f 34                	sysenter
+  8014f8:	83 c4 04             	add    $0x4,%esp
+  8014fb:	5d                   	pop    %ebp
+  8014fc:	eb c0                	jmp    8014be <sys_ipc_try_send+0x30>
+
+008014fe <sys_ipc_recv>:
+  8014fe:	55                   	push   %ebp
+  8014ff:	89 e5                	mov    %esp,%ebp
+  801501:	57                   	push   %edi
+  801502:	56                   	push   %esi
+  801503:	53                   	push   %ebx
+  801504:	83 ec 0c             	sub    $0xc,%esp
+  801507:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80150e:	78 2a                	js     80153a <sys_ipc_recv+0x3c>
+  801510:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801517:	75 36                	jne    80154f <sys_ipc_recv+0x51>
+  801519:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80151e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801523:	8b 55 08             	mov    0x8(%ebp),%edx
+  801526:	89 cb                	mov    %ecx,%ebx
+  801528:	89 cf                	mov    %ecx,%edi
+  80152a:	89 ce                	mov    %ecx,%esi
+  80152c:	cd 30                	int    $0x30
+  80152e:	85 c0                	test   %eax,%eax
+  801530:	7f 40                	jg     801572 <sys_ipc_recv+0x74>
+  801532:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801535:	5b                   	pop    %ebx
+  801536:	5e                   	pop    %esi
+  801537:	5f                   	pop    %edi
+  801538:	5d                   	pop    %ebp
+  801539:	c3                   	ret
+  80153a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80153f:	0f a2                	cpuid
+  801541:	c1 ea 0b             	shr    $0xb,%edx
+  801544:	83 e2 01             	and    $0x1,%edx
+  801547:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80154d:	eb c1                	jmp    801510 <sys_ipc_recv+0x12>
+  80154f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801552:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801557:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80155c:	89 cb                	mov    %ecx,%ebx
+  80155e:	89 cf                	mov    %ecx,%edi
+  801560:	89 ce                	mov    %ecx,%esi
+  801562:	55                   	push   %ebp
+  801563:	68 6c 15 80 00       	push   $0x80156c
+  801568:	89 e5                	mov    %esp,%ebp
+  80156a:	0f 34                	sysenter
+  80156c:	83 c4 04             	add    $0x4,%esp
+  80156f:	5d                   	pop    %ebp
+  801570:	eb bc                	jmp    80152e <sys_ipc_recv+0x30>
+  801572:	83 ec 0c             	sub    $0xc,%esp
+  801575:	50                   	push   %eax
+  801576:	6a 0c                	push   $0xc
+  801578:	68 a4 20 80 00       	push   $0x8020a4
+  80157d:	6a 49                	push   $0x49
+  80157f:	68 c1 20 80 00       	push   $0x8020c1
+  801584:	e8 d4 04 00 00       	call   801a5d <_panic>
+
+00801589 <duppage>:
+  801589:	55                   	push   %ebp
+  80158a:	89 e5                	mov    %esp,%ebp
+  80158c:	53                   	push   %ebx
+  80158d:	83 ec 04             	sub    $0x4,%esp
+  801590:	89 d3                	mov    %edx,%ebx
+  801592:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801599:	f6 c2 02             	test   $0x2,%dl
+  80159c:	75 0c                	jne    8015aa <duppage+0x21>
+  80159e:	8b 14 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edx
+  8015a5:	f6 c6 08             	test   $0x8,%dh
+  8015a8:	74 64                	je     80160e <duppage+0x85>
+  8015aa:	c1 e3 0c             	shl    $0xc,%ebx
+  8015ad:	83 ec 0c             	sub    $0xc,%esp
+  8015b0:	68 05 08 00 00       	push   $0x805
+  8015b5:	53                   	push   %ebx
+  8015b6:	50                   	push   %eax
+  8015b7:	53                   	push   %ebx
+  8015b8:	6a 00                	push   $0x0
+  8015ba:	e8 24 fa ff ff       	call   800fe3 <sys_page_map>
+  8015bf:	83 c4 20             	add    $0x20,%esp
+  8015c2:	85 c0                	test   %eax,%eax
+  8015c4:	78 24                	js     8015ea <duppage+0x61>
+  8015c6:	83 ec 0c             	sub    $0xc,%esp
+  8015c9:	68 05 08 00 00       	push   $0x805
+  8015ce:	53                   	push   %ebx
+  8015cf:	6a 00                	push   $0x0
+  8015d1:	53                   	push   %ebx
+  8015d2:	6a 00                	push   $0x0
+  8015d4:	e8 0a fa ff ff       	call   800fe3 <sys_page_map>
+  8015d9:	83 c4 20             	add    $0x20,%esp
+  8015dc:	85 c0                	test   %eax,%eax
+  8015de:	78 1c                	js     8015fc <duppage+0x73>
+  8015e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015e8:	c9                   	leave
+  8015e9:	c3                   	ret
+  8015ea:	50                   	push   %eax
+  8015eb:	68 cf 20 80 00       	push   $0x8020cf
+  8015f0:	6a 52                	push   $0x52
+  8015f2:	68 e0 20 80 00       	push   $0x8020e0
+  8015f7:	e8 61 04 00 00       	call   801a5d <_panic>
+  8015fc:	50                   	push   %eax
+  8015fd:	68 cf 20 80 00       	push   $0x8020cf
+  801602:	6a 55                	push   $0x55
+  801604:	68 e0 20 80 00       	push   $0x8020e0
+  801609:	e8 4f 04 00 00       	call   801a5d <_panic>
+  80160e:	c1 e3 0c             	shl    $0xc,%ebx
+  801611:	83 ec 0c             	sub    $0xc,%esp
+  801614:	6a 05                	push   $0x5
+  801616:	53                   	push   %ebx
+  801617:	50                   	push   %eax
+  801618:	53                   	push   %ebx
+  801619:	6a 00                	push   $0x0
+  80161b:	e8 c3 f9 ff ff       	call   800fe3 <sys_page_map>
+  801620:	83 c4 20             	add    $0x20,%esp
+  801623:	85 c0                	test   %eax,%eax
+  801625:	79 b9                	jns    8015e0 <duppage+0x57>
+  801627:	50                   	push   %eax
+  801628:	68 cf 20 80 00       	push   $0x8020cf
+  80162d:	6a 59                	push   $0x59
+  80162f:	68 e0 20 80 00       	push   $0x8020e0
+  801634:	e8 24 04 00 00       	call   801a5d <_panic>
+
+00801639 <pgfault>:
+  801639:	55                   	push   %ebp
+  80163a:	89 e5                	mov    %esp,%ebp
+  80163c:	53                   	push   %ebx
+  80163d:	83 ec 04             	sub    $0x4,%esp
+  801640:	8b 45 08             	mov    0x8(%ebp),%eax
+  801643:	8b 18                	mov    (%eax),%ebx
+  801645:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801649:	0f 84 90 00 00 00    	je     8016df <pgfault+0xa6>
+  80164f:	89 d8                	mov    %ebx,%eax
+  801651:	c1 e8 0c             	shr    $0xc,%eax
+  801654:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80165b:	f7 c2 01 08 00 00    	test   $0x801,%edx
+  801661:	74 7c                	je     8016df <pgfault+0xa6>
+  801663:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80166a:	c1 e8 0c             	shr    $0xc,%eax
+  80166d:	0f b7 04 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%eax
+  801674:	ef 
+  801675:	66 83 f8 01          	cmp    $0x1,%ax
+  801679:	74 78                	je     8016f3 <pgfault+0xba>
+  80167b:	83 ec 04             	sub    $0x4,%esp
+  80167e:	6a 07                	push   $0x7
+  801680:	68 00 f0 7f 00       	push   $0x7ff000
+  801685:	6a 00                	push   $0x0
+  801687:	e8 c8 f8 ff ff       	call   800f54 <sys_page_alloc>
+  80168c:	83 c4 10             	add    $0x10,%esp
+  80168f:	85 c0                	test   %eax,%eax
+  801691:	78 7f                	js     801712 <pgfault+0xd9>
+  801693:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  801699:	83 ec 08             	sub    $0x8,%esp
+  80169c:	53                   	push   %ebx
+  80169d:	68 00 f0 7f 00       	push   $0x7ff000
+  8016a2:	e8 86 f3 ff ff       	call   800a2d <page_copy>
+  8016a7:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8016ae:	53                   	push   %ebx
+  8016af:	6a 00                	push   $0x0
+  8016b1:	68 00 f0 7f 00       	push   $0x7ff000
+  8016b6:	6a 00                	push   $0x0
+  8016b8:	e8 26 f9 ff ff       	call   800fe3 <sys_page_map>
+  8016bd:	83 c4 20             	add    $0x20,%esp
+  8016c0:	85 c0                	test   %eax,%eax
+  8016c2:	78 60                	js     801724 <pgfault+0xeb>
+  8016c4:	83 ec 08             	sub    $0x8,%esp
+  8016c7:	68 00 f0 7f 00       	push   $0x7ff000
+  8016cc:	6a 00                	push   $0x0
+  8016ce:	e8 9d f9 ff ff       	call   801070 <sys_page_unmap>
+  8016d3:	83 c4 10             	add    $0x10,%esp
+  8016d6:	85 c0                	test   %eax,%eax
+  8016d8:	78 5c                	js     801736 <pgfault+0xfd>
+  8016da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016dd:	c9                   	leave
+  8016de:	c3                   	ret
+  8016df:	83 ec 04             	sub    $0x4,%esp
+  8016e2:	68 eb 20 80 00       	push   $0x8020eb
+  8016e7:	6a 1c                	push   $0x1c
+  8016e9:	68 e0 20 80 00       	push   $0x8020e0
+  8016ee:	e8 6a 03 00 00       	call   801a5d <_panic>
+  8016f3:	83 ec 08             	sub    $0x8,%esp
+  8016f6:	89 d8                	mov    %ebx,%eax
+  8016f8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8016fd:	50                   	push   %eax
+  8016fe:	6a 00                	push   $0x0
+  801700:	e8 f8 f9 ff ff       	call   8010fd <sys_page_reuse>
+  801705:	83 c4 10             	add    $0x10,%esp
+  801708:	85 c0                	test   %eax,%eax
+  80170a:	0f 85 6b ff ff ff    	jne    80167b <pgfault+0x42>
+  801710:	eb c8                	jmp    8016da <pgfault+0xa1>
+  801712:	50                   	push   %eax
+  801713:	68 08 21 80 00       	push   $0x802108
+  801718:	6a 31                	push   $0x31
+  80171a:	68 e0 20 80 00       	push   $0x8020e0
+  80171f:	e8 39 03 00 00       	call   801a5d <_panic>
+  801724:	50                   	push   %eax
+  801725:	68 cf 20 80 00       	push   $0x8020cf
+  80172a:	6a 36                	push   $0x36
+  80172c:	68 e0 20 80 00       	push   $0x8020e0
+  801731:	e8 27 03 00 00       	call   801a5d <_panic>
+  801736:	50                   	push   %eax
+  801737:	68 1b 21 80 00       	push   $0x80211b
+  80173c:	6a 38                	push   $0x38
+  80173e:	68 e0 20 80 00       	push   $0x8020e0
+  801743:	e8 15 03 00 00       	call   801a5d <_panic>
+
+00801748 <fork>:
+  801748:	55                   	push   %ebp
+  801749:	89 e5                	mov    %esp,%ebp
+  80174b:	53                   	push   %ebx
+  80174c:	83 ec 20             	sub    $0x20,%esp
+  80174f:	68 39 16 80 00       	push   $0x801639
+  801754:	e8 4f 03 00 00       	call   801aa8 <set_pgfault_handler>
+  801759:	83 c4 08             	add    $0x8,%esp
+  80175c:	6a 01                	push   $0x1
+  80175e:	6a 00                	push   $0x0
+  801760:	e8 d5 f6 ff ff       	call   800e3a <sys_env_set_cow>
+  801765:	83 c4 10             	add    $0x10,%esp
+  801768:	85 c0                	test   %eax,%eax
+  80176a:	78 38                	js     8017a4 <fork+0x5c>
+  80176c:	e8 f5 01 00 00       	call   801966 <bflush>
+  801771:	b8 07 00 00 00       	mov    $0x7,%eax
+  801776:	cd 30                	int    $0x30
+  801778:	89 c3                	mov    %eax,%ebx
+  80177a:	85 c0                	test   %eax,%eax
+  80177c:	78 38                	js     8017b6 <fork+0x6e>
+  80177e:	ba 00 00 80 00       	mov    $0x800000,%edx
+  801783:	75 4f                	jne    8017d4 <fork+0x8c>
+  801785:	e8 43 01 00 00       	call   8018cd <uinfo_envid>
+  80178a:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80178f:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  801795:	05 00 00 00 ed       	add    $0xed000000,%eax
+  80179a:	a3 20 30 80 00       	mov    %eax,0x803020
+  80179f:	e9 c9 00 00 00       	jmp    80186d <fork+0x125>
+  8017a4:	50                   	push   %eax
+  8017a5:	68 2e 21 80 00       	push   $0x80212e
+  8017aa:	6a 7c                	push   $0x7c
+  8017ac:	68 e0 20 80 00       	push   $0x8020e0
+  8017b1:	e8 a7 02 00 00       	call   801a5d <_panic>
+  8017b6:	50                   	push   %eax
+  8017b7:	68 42 21 80 00       	push   $0x802142
+  8017bc:	68 88 00 00 00       	push   $0x88
+  8017c1:	68 e0 20 80 00       	push   $0x8020e0
+  8017c6:	e8 92 02 00 00       	call   801a5d <_panic>
+  8017cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017ce:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017d4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  8017d7:	81 fa ff ff ff ea    	cmp    $0xeaffffff,%edx
+  8017dd:	77 34                	ja     801813 <fork+0xcb>
+  8017df:	81 fa 00 f0 ff ea    	cmp    $0xeafff000,%edx
+  8017e5:	74 e4                	je     8017cb <fork+0x83>
+  8017e7:	89 d0                	mov    %edx,%eax
+  8017e9:	c1 e8 16             	shr    $0x16,%eax
+  8017ec:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8017f3:	a8 01                	test   $0x1,%al
+  8017f5:	74 d4                	je     8017cb <fork+0x83>
+  8017f7:	89 d0                	mov    %edx,%eax
+  8017f9:	c1 e8 0c             	shr    $0xc,%eax
+  8017fc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801803:	a8 01                	test   $0x1,%al
+  801805:	74 c4                	je     8017cb <fork+0x83>
+  801807:	c1 ea 0c             	shr    $0xc,%edx
+  80180a:	89 d8                	mov    %ebx,%eax
+  80180c:	e8 78 fd ff ff       	call   801589 <duppage>
+  801811:	eb b8                	jmp    8017cb <fork+0x83>
+  801813:	83 ec 04             	sub    $0x4,%esp
+  801816:	6a 07                	push   $0x7
+  801818:	68 00 f0 ff ea       	push   $0xeafff000
+  80181d:	53                   	push   %ebx
+  80181e:	e8 31 f7 ff ff       	call   800f54 <sys_page_alloc>
+  801823:	83 c4 10             	add    $0x10,%esp
+  801826:	85 c0                	test   %eax,%eax
+  801828:	78 4a                	js     801874 <fork+0x12c>
+  80182a:	a1 20 30 80 00       	mov    0x803020,%eax
+  80182f:	8b 40 58             	mov    0x58(%eax),%eax
+  801832:	83 ec 08             	sub    $0x8,%esp
+  801835:	50                   	push   %eax
+  801836:	53                   	push   %ebx
+  801837:	e8 ba f9 ff ff       	call   8011f6 <sys_env_set_pgfault_upcall>
+  80183c:	83 c4 08             	add    $0x8,%esp
+  80183f:	6a 01                	push   $0x1
+  801841:	53                   	push   %ebx
+  801842:	e8 f3 f5 ff ff       	call   800e3a <sys_env_set_cow>
+  801847:	83 c4 10             	add    $0x10,%esp
+  80184a:	85 c0                	test   %eax,%eax
+  80184c:	78 3b                	js     801889 <fork+0x141>
+  80184e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801851:	c1 ea 0c             	shr    $0xc,%edx
+  801854:	89 d8                	mov    %ebx,%eax
+  801856:	e8 2e fd ff ff       	call   801589 <duppage>
+  80185b:	83 ec 08             	sub    $0x8,%esp
+  80185e:	6a 02                	push   $0x2
+  801860:	53                   	push   %ebx
+  801861:	e8 03 f9 ff ff       	call   801169 <sys_env_set_status>
+  801866:	83 c4 10             	add    $0x10,%esp
+  801869:	85 c0                	test   %eax,%eax
+  80186b:	78 31                	js     80189e <fork+0x156>
+  80186d:	89 d8                	mov    %ebx,%eax
+  80186f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801872:	c9                   	leave
+  801873:	c3                   	ret
+  801874:	50                   	push   %eax
+  801875:	68 08 21 80 00       	push   $0x802108
+  80187a:	68 a1 00 00 00       	push   $0xa1
+  80187f:	68 e0 20 80 00       	push   $0x8020e0
+  801884:	e8 d4 01 00 00       	call   801a5d <_panic>
+  801889:	50                   	push   %eax
+  80188a:	68 2e 21 80 00       	push   $0x80212e
+  80188f:	68 a6 00 00 00       	push   $0xa6
+  801894:	68 e0 20 80 00       	push   $0x8020e0
+  801899:	e8 bf 01 00 00       	call   801a5d <_panic>
+  80189e:	50                   	push   %eax
+  80189f:	68 52 21 80 00       	push   $0x802152
+  8018a4:	68 ad 00 00 00       	push   $0xad
+  8018a9:	68 e0 20 80 00       	push   $0x8020e0
+  8018ae:	e8 aa 01 00 00       	call   801a5d <_panic>
+
+008018b3 <sfork>:
+  8018b3:	55                   	push   %ebp
+  8018b4:	89 e5                	mov    %esp,%ebp
+  8018b6:	83 ec 0c             	sub    $0xc,%esp
+  8018b9:	68 69 21 80 00       	push   $0x802169
+  8018be:	68 b6 00 00 00       	push   $0xb6
+  8018c3:	68 e0 20 80 00       	push   $0x8020e0
+  8018c8:	e8 90 01 00 00       	call   801a5d <_panic>
+
+008018cd <uinfo_envid>:
+  8018cd:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  8018d2:	c3                   	ret
+
+008018d3 <uinfo_cpunum>:
+  8018d3:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  8018d8:	c3                   	ret
+
+008018d9 <uinfo_ticks>:
+  8018d9:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  8018de:	c3                   	ret
+
+008018df <uinfo_nsec>:
+  8018df:	55                   	push   %ebp
+  8018e0:	89 e5                	mov    %esp,%ebp
+  8018e2:	57                   	push   %edi
+  8018e3:	56                   	push   %esi
+  8018e4:	53                   	push   %ebx
+  8018e5:	83 ec 1c             	sub    $0x1c,%esp
+  8018e8:	0f 31                	rdtsc
+  8018ea:	89 c6                	mov    %eax,%esi
+  8018ec:	89 d7                	mov    %edx,%edi
+  8018ee:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  8018f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018fe:	85 c9                	test   %ecx,%ecx
+  801900:	74 5c                	je     80195e <uinfo_nsec+0x7f>
+  801902:	ba 00 00 00 00       	mov    $0x0,%edx
+  801907:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80190a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80190d:	52                   	push   %edx
+  80190e:	51                   	push   %ecx
+  80190f:	57                   	push   %edi
+  801910:	56                   	push   %esi
+  801911:	e8 ff 02 00 00       	call   801c15 <__umoddi3>
+  801916:	83 c4 10             	add    $0x10,%esp
+  801919:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  80191f:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801924:	f7 e3                	mul    %ebx
+  801926:	01 ca                	add    %ecx,%edx
+  801928:	ff 75 e4             	push   -0x1c(%ebp)
+  80192b:	ff 75 e0             	push   -0x20(%ebp)
+  80192e:	52                   	push   %edx
+  80192f:	50                   	push   %eax
+  801930:	e8 08 02 00 00       	call   801b3d <__udivdi3>
+  801935:	83 c4 10             	add    $0x10,%esp
+  801938:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80193b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80193e:	ff 75 e4             	push   -0x1c(%ebp)
+  801941:	ff 75 e0             	push   -0x20(%ebp)
+  801944:	57                   	push   %edi
+  801945:	56                   	push   %esi
+  801946:	e8 f2 01 00 00       	call   801b3d <__udivdi3>
+  80194b:	83 c4 10             	add    $0x10,%esp
+  80194e:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801954:	f7 e3                	mul    %ebx
+  801956:	01 ca                	add    %ecx,%edx
+  801958:	03 45 d8             	add    -0x28(%ebp),%eax
+  80195b:	13 55 dc             	adc    -0x24(%ebp),%edx
+  80195e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801961:	5b                   	pop    %ebx
+  801962:	5e                   	pop    %esi
+  801963:	5f                   	pop    %edi
+  801964:	5d                   	pop    %ebp
+  801965:	c3                   	ret
+
+00801966 <bflush>:
+  801966:	a1 40 30 80 00       	mov    0x803040,%eax
+  80196b:	85 c0                	test   %eax,%eax
+  80196d:	75 01                	jne    801970 <bflush+0xa>
+  80196f:	c3                   	ret
+  801970:	55                   	push   %ebp
+  801971:	89 e5                	mov    %esp,%ebp
+  801973:	83 ec 10             	sub    $0x10,%esp
+  801976:	50                   	push   %eax
+  801977:	68 44 30 80 00       	push   $0x803044
+  80197c:	e8 90 f2 ff ff       	call   800c11 <sys_cputs>
+  801981:	c7 05 40 30 80 00 00 	movl   $0x0,0x803040
+  801988:	00 00 00 
+  80198b:	83 c4 10             	add    $0x10,%esp
+  80198e:	c9                   	leave
+  80198f:	c3                   	ret
+
+00801990 <bputch>:
+  801990:	55                   	push   %ebp
+  801991:	89 e5                	mov    %esp,%ebp
+  801993:	53                   	push   %ebx
+  801994:	83 ec 04             	sub    $0x4,%esp
+  801997:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80199a:	8b 15 40 30 80 00    	mov    0x803040,%edx
+  8019a0:	8d 42 01             	lea    0x1(%edx),%eax
+  8019a3:	a3 40 30 80 00       	mov    %eax,0x803040
+  8019a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8019ab:	88 8a 44 30 80 00    	mov    %cl,0x803044(%edx)
+  8019b1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019b6:	77 08                	ja     8019c0 <bputch+0x30>
+  8019b8:	83 03 01             	addl   $0x1,(%ebx)
+  8019bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019be:	c9                   	leave
+  8019bf:	c3                   	ret
+  8019c0:	e8 a1 ff ff ff       	call   801966 <bflush>
+  8019c5:	eb f1                	jmp    8019b8 <bputch+0x28>
+
+008019c7 <vbprintf>:
+  8019c7:	55                   	push   %ebp
+  8019c8:	89 e5                	mov    %esp,%ebp
+  8019ca:	83 ec 18             	sub    $0x18,%esp
+  8019cd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8019d4:	ff 75 0c             	push   0xc(%ebp)
+  8019d7:	ff 75 08             	push   0x8(%ebp)
+  8019da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019dd:	50                   	push   %eax
+  8019de:	68 90 19 80 00       	push   $0x801990
+  8019e3:	e8 bc e8 ff ff       	call   8002a4 <vprintfmt>
+  8019e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019eb:	c9                   	leave
+  8019ec:	c3                   	ret
+
+008019ed <bprintf>:
+  8019ed:	55                   	push   %ebp
+  8019ee:	89 e5                	mov    %esp,%ebp
+  8019f0:	83 ec 10             	sub    $0x10,%esp
+  8019f3:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8019f6:	50                   	push   %eax
+  8019f7:	ff 75 08             	push   0x8(%ebp)
+  8019fa:	e8 c8 ff ff ff       	call   8019c7 <vbprintf>
+  8019ff:	c9                   	leave
+  801a00:	c3                   	ret
+
+00801a01 <bwrite>:
+  801a01:	55                   	push   %ebp
+  801a02:	89 e5                	mov    %esp,%ebp
+  801a04:	53                   	push   %ebx
+  801a05:	83 ec 04             	sub    $0x4,%esp
+  801a08:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a0b:	89 d8                	mov    %ebx,%eax
+  801a0d:	03 05 40 30 80 00    	add    0x803040,%eax
+  801a13:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a18:	76 0d                	jbe    801a27 <bwrite+0x26>
+  801a1a:	e8 47 ff ff ff       	call   801966 <bflush>
+  801a1f:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801a25:	77 25                	ja     801a4c <bwrite+0x4b>
+  801a27:	83 ec 04             	sub    $0x4,%esp
+  801a2a:	53                   	push   %ebx
+  801a2b:	ff 75 08             	push   0x8(%ebp)
+  801a2e:	a1 40 30 80 00       	mov    0x803040,%eax
+  801a33:	05 44 30 80 00       	add    $0x803044,%eax
+  801a38:	50                   	push   %eax
+  801a39:	e8 d1 ef ff ff       	call   800a0f <memcpy>
+  801a3e:	01 1d 40 30 80 00    	add    %ebx,0x803040
+  801a44:	83 c4 10             	add    $0x10,%esp
+  801a47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a4a:	c9                   	leave
+  801a4b:	c3                   	ret
+  801a4c:	83 ec 08             	sub    $0x8,%esp
+  801a4f:	53                   	push   %ebx
+  801a50:	ff 75 08             	push   0x8(%ebp)
+  801a53:	e8 b9 f1 ff ff       	call   800c11 <sys_cputs>
+  801a58:	83 c4 10             	add    $0x10,%esp
+  801a5b:	eb ea                	jmp    801a47 <bwrite+0x46>
+
+00801a5d <_panic>:
+  801a5d:	55                   	push   %ebp
+  801a5e:	89 e5                	mov    %esp,%ebp
+  801a60:	56                   	push   %esi
+  801a61:	53                   	push   %ebx
+  801a62:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  801a65:	e8 fc fe ff ff       	call   801966 <bflush>
+  801a6a:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801a70:	e8 f5 f2 ff ff       	call   800d6a <sys_getenvid>
+  801a75:	83 ec 0c             	sub    $0xc,%esp
+  801a78:	ff 75 0c             	push   0xc(%ebp)
+  801a7b:	ff 75 08             	push   0x8(%ebp)
+  801a7e:	56                   	push   %esi
+  801a7f:	50                   	push   %eax
+  801a80:	68 80 21 80 00       	push   $0x802180
+  801a85:	e8 23 e7 ff ff       	call   8001ad <cprintf>
+  801a8a:	83 c4 18             	add    $0x18,%esp
+  801a8d:	53                   	push   %ebx
+  801a8e:	ff 75 10             	push   0x10(%ebp)
+  801a91:	e8 c6 e6 ff ff       	call   80015c <vcprintf>
+  801a96:	c7 04 24 54 1e 80 00 	movl   $0x801e54,(%esp)
+  801a9d:	e8 0b e7 ff ff       	call   8001ad <cprintf>
+  801aa2:	83 c4 10             	add    $0x10,%esp
+  801aa5:	cc                   	int3
+  801aa6:	eb fd                	jmp    801aa5 <_panic+0x48>
+
+00801aa8 <set_pgfault_handler>:
+  801aa8:	55                   	push   %ebp
+  801aa9:	89 e5                	mov    %esp,%ebp
+  801aab:	83 ec 08             	sub    $0x8,%esp
+  801aae:	83 3d 44 34 80 00 00 	cmpl   $0x0,0x803444
+  801ab5:	74 0a                	je     801ac1 <set_pgfault_handler+0x19>
+  801ab7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aba:	a3 44 34 80 00       	mov    %eax,0x803444
+  801abf:	c9                   	leave
+  801ac0:	c3                   	ret
+  801ac1:	83 ec 04             	sub    $0x4,%esp
+  801ac4:	6a 07                	push   $0x7
+  801ac6:	68 00 f0 ff ea       	push   $0xeafff000
+  801acb:	6a 00                	push   $0x0
+  801acd:	e8 82 f4 ff ff       	call   800f54 <sys_page_alloc>
+  801ad2:	83 c4 10             	add    $0x10,%esp
+  801ad5:	85 c0                	test   %eax,%eax
+  801ad7:	75 2a                	jne    801b03 <set_pgfault_handler+0x5b>
+  801ad9:	83 ec 08             	sub    $0x8,%esp
+  801adc:	68 17 1b 80 00       	push   $0x801b17
+  801ae1:	6a 00                	push   $0x0
+  801ae3:	e8 0e f7 ff ff       	call   8011f6 <sys_env_set_pgfault_upcall>
+  801ae8:	83 c4 10             	add    $0x10,%esp
+  801aeb:	85 c0                	test   %eax,%eax
+  801aed:	74 c8                	je     801ab7 <set_pgfault_handler+0xf>
+  801aef:	83 ec 04             	sub    $0x4,%esp
+  801af2:	68 c8 21 80 00       	push   $0x8021c8
+  801af7:	6a 28                	push   $0x28
+  801af9:	68 b9 21 80 00       	push   $0x8021b9
+  801afe:	e8 5a ff ff ff       	call   801a5d <_panic>
+  801b03:	83 ec 04             	sub    $0x4,%esp
+  801b06:	68 a3 21 80 00       	push   $0x8021a3
+  801b0b:	6a 22                	push   $0x22
+  801b0d:	68 b9 21 80 00       	push   $0x8021b9
+  801b12:	e8 46 ff ff ff       	call   801a5d <_panic>
+
+00801b17 <_pgfault_upcall>:
+  801b17:	54                   	push   %esp
+  801b18:	a1 44 34 80 00       	mov    0x803444,%eax
+  801b1d:	ff d0                	call   *%eax
+  801b1f:	83 c4 04             	add    $0x4,%esp
+  801b22:	8b 44 24 28          	mov    0x28(%esp),%eax
+  801b26:	89 e5                	mov    %esp,%ebp
+  801b28:	8b 64 24 30          	mov    0x30(%esp),%esp
+  801b2c:	50                   	push   %eax
+  801b2d:	89 ec                	mov    %ebp,%esp
+  801b2f:	83 c4 08             	add    $0x8,%esp
+  801b32:	61                   	popa
+  801b33:	83 c4 04             	add    $0x4,%esp
+  801b36:	9d                   	popf
+  801b37:	5c                   	pop    %esp
+  801b38:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+  801b3c:	c3                   	ret
+
+00801b3d <__udivdi3>:
+  801b3d:	57                   	push   %edi
+  801b3e:	56                   	push   %esi
+  801b3f:	53                   	push   %ebx
+  801b40:	83 ec 20             	sub    $0x20,%esp
+  801b43:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801b47:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801b4b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801b4f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801b53:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801b57:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801b5b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801b5f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801b63:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801b67:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801b6b:	89 d1                	mov    %edx,%ecx
+  801b6d:	09 c1                	or     %eax,%ecx
+  801b6f:	0f 84 91 00 00 00    	je     801c06 <__udivdi3+0xc9>
+  801b75:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801b7c:	00 
+  801b7d:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801b84:	00 
+  801b85:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b94:	eb 08                	jmp    801b9e <__udivdi3+0x61>
+  801b96:	83 e9 01             	sub    $0x1,%ecx
+  801b99:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801b9c:	74 68                	je     801c06 <__udivdi3+0xc9>
+  801b9e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801ba2:	01 c0                	add    %eax,%eax
+  801ba4:	89 c6                	mov    %eax,%esi
+  801ba6:	89 d7                	mov    %edx,%edi
+  801ba8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801bac:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801bb0:	0f ad d0             	shrd   %cl,%edx,%eax
+  801bb3:	d3 ea                	shr    %cl,%edx
+  801bb5:	f6 c1 20             	test   $0x20,%cl
+  801bb8:	74 04                	je     801bbe <__udivdi3+0x81>
+  801bba:	89 d0                	mov    %edx,%eax
+  801bbc:	31 d2                	xor    %edx,%edx
+  801bbe:	83 e0 01             	and    $0x1,%eax
+  801bc1:	89 04 24             	mov    %eax,(%esp)
+  801bc4:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801bcb:	00 
+  801bcc:	8b 04 24             	mov    (%esp),%eax
+  801bcf:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801bd3:	09 f0                	or     %esi,%eax
+  801bd5:	09 fa                	or     %edi,%edx
+  801bd7:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801bdb:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801bdf:	39 f0                	cmp    %esi,%eax
+  801be1:	89 d3                	mov    %edx,%ebx
+  801be3:	19 fb                	sbb    %edi,%ebx
+  801be5:	72 af                	jb     801b96 <__udivdi3+0x59>
+  801be7:	29 f0                	sub    %esi,%eax
+  801be9:	19 fa                	sbb    %edi,%edx
+  801beb:	89 cf                	mov    %ecx,%edi
+  801bed:	c1 ef 05             	shr    $0x5,%edi
+  801bf0:	83 e7 01             	and    $0x1,%edi
+  801bf3:	89 fe                	mov    %edi,%esi
+  801bf5:	83 f6 01             	xor    $0x1,%esi
+  801bf8:	d3 e6                	shl    %cl,%esi
+  801bfa:	d3 e7                	shl    %cl,%edi
+  801bfc:	09 74 24 18          	or     %esi,0x18(%esp)
+  801c00:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  801c04:	eb 90                	jmp    801b96 <__udivdi3+0x59>
+  801c06:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801c0a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  801c0e:	83 c4 20             	add    $0x20,%esp
+  801c11:	5b                   	pop    %ebx
+  801c12:	5e                   	pop    %esi
+  801c13:	5f                   	pop    %edi
+  801c14:	c3                   	ret
+
+00801c15 <__umoddi3>:
+  801c15:	55                   	push   %ebp
+  801c16:	57                   	push   %edi
+  801c17:	56                   	push   %esi
+  801c18:	53                   	push   %ebx
+  801c19:	83 ec 1c             	sub    $0x1c,%esp
+  801c1c:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801c20:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801c24:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801c28:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801c2c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801c30:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801c34:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801c38:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801c3c:	89 d6                	mov    %edx,%esi
+  801c3e:	09 c6                	or     %eax,%esi
+  801c40:	74 6c                	je     801cae <__umoddi3+0x99>
+  801c42:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c51:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801c55:	eb 0e                	jmp    801c65 <__umoddi3+0x50>
+  801c57:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801c5c:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801c60:	83 fe ff             	cmp    $0xffffffff,%esi
+  801c63:	74 49                	je     801cae <__umoddi3+0x99>
+  801c65:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801c69:	01 c0                	add    %eax,%eax
+  801c6b:	89 c3                	mov    %eax,%ebx
+  801c6d:	89 d6                	mov    %edx,%esi
+  801c6f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801c73:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801c77:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801c7c:	0f ad d0             	shrd   %cl,%edx,%eax
+  801c7f:	d3 ea                	shr    %cl,%edx
+  801c81:	f6 c1 20             	test   $0x20,%cl
+  801c84:	74 04                	je     801c8a <__umoddi3+0x75>
+  801c86:	89 d0                	mov    %edx,%eax
+  801c88:	31 d2                	xor    %edx,%edx
+  801c8a:	83 e0 01             	and    $0x1,%eax
+  801c8d:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801c92:	89 ea                	mov    %ebp,%edx
+  801c94:	09 d8                	or     %ebx,%eax
+  801c96:	09 f2                	or     %esi,%edx
+  801c98:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801c9c:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801ca0:	39 d8                	cmp    %ebx,%eax
+  801ca2:	89 d1                	mov    %edx,%ecx
+  801ca4:	19 f1                	sbb    %esi,%ecx
+  801ca6:	72 af                	jb     801c57 <__umoddi3+0x42>
+  801ca8:	29 d8                	sub    %ebx,%eax
+  801caa:	19 f2                	sbb    %esi,%edx
+  801cac:	eb a9                	jmp    801c57 <__umoddi3+0x42>
+  801cae:	83 c4 1c             	add    $0x1c,%esp
+  801cb1:	5b                   	pop    %ebx
+  801cb2:	5e                   	pop    %esi
+  801cb3:	5f                   	pop    %edi
+  801cb4:	5d                   	pop    %ebp
+  801cb5:	c3                   	ret
+
+00801cb6 <__divdi3>:
+  801cb6:	53                   	push   %ebx
+  801cb7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801cbb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801cbf:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801cc3:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801cc7:	85 d2                	test   %edx,%edx
+  801cc9:	78 12                	js     801cdd <__divdi3+0x27>
+  801ccb:	85 db                	test   %ebx,%ebx
+  801ccd:	78 2e                	js     801cfd <__divdi3+0x47>
+  801ccf:	53                   	push   %ebx
+  801cd0:	51                   	push   %ecx
+  801cd1:	52                   	push   %edx
+  801cd2:	50                   	push   %eax
+  801cd3:	e8 65 fe ff ff       	call   801b3d <__udivdi3>
+  801cd8:	83 c4 10             	add    $0x10,%esp
+  801cdb:	eb 1e                	jmp    801cfb <__divdi3+0x45>
+  801cdd:	f7 d8                	neg    %eax
+  801cdf:	83 d2 00             	adc    $0x0,%edx
+  801ce2:	f7 da                	neg    %edx
+  801ce4:	85 db                	test   %ebx,%ebx
+  801ce6:	78 2a                	js     801d12 <__divdi3+0x5c>
+  801ce8:	53                   	push   %ebx
+  801ce9:	51                   	push   %ecx
+  801cea:	52                   	push   %edx
+  801ceb:	50                   	push   %eax
+  801cec:	e8 4c fe ff ff       	call   801b3d <__udivdi3>
+  801cf1:	83 c4 10             	add    $0x10,%esp
+  801cf4:	f7 d8                	neg    %eax
+  801cf6:	83 d2 00             	adc    $0x0,%edx
+  801cf9:	f7 da                	neg    %edx
+  801cfb:	5b                   	pop    %ebx
+  801cfc:	c3                   	ret
+  801cfd:	f7 d9                	neg    %ecx
+  801cff:	83 d3 00             	adc    $0x0,%ebx
+  801d02:	f7 db                	neg    %ebx
+  801d04:	53                   	push   %ebx
+  801d05:	51                   	push   %ecx
+  801d06:	52                   	push   %edx
+  801d07:	50                   	push   %eax
+  801d08:	e8 30 fe ff ff       	call   801b3d <__udivdi3>
+  801d0d:	83 c4 10             	add    $0x10,%esp
+  801d10:	eb e2                	jmp    801cf4 <__divdi3+0x3e>
+  801d12:	f7 d9                	neg    %ecx
+  801d14:	83 d3 00             	adc    $0x0,%ebx
+  801d17:	f7 db                	neg    %ebx
+  801d19:	53                   	push   %ebx
+  801d1a:	51                   	push   %ecx
+  801d1b:	52                   	push   %edx
+  801d1c:	50                   	push   %eax
+  801d1d:	e8 1b fe ff ff       	call   801b3d <__udivdi3>
+  801d22:	83 c4 10             	add    $0x10,%esp
+  801d25:	eb d4                	jmp    801cfb <__divdi3+0x45>
+
+00801d27 <__moddi3>:
+  801d27:	55                   	push   %ebp
+  801d28:	57                   	push   %edi
+  801d29:	56                   	push   %esi
+  801d2a:	53                   	push   %ebx
+  801d2b:	83 ec 14             	sub    $0x14,%esp
+  801d2e:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801d32:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801d36:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801d3a:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801d3e:	85 ed                	test   %ebp,%ebp
+  801d40:	78 2b                	js     801d6d <__moddi3+0x46>
+  801d42:	89 c6                	mov    %eax,%esi
+  801d44:	f7 de                	neg    %esi
+  801d46:	89 34 24             	mov    %esi,(%esp)
+  801d49:	89 d6                	mov    %edx,%esi
+  801d4b:	83 d6 00             	adc    $0x0,%esi
+  801d4e:	f7 de                	neg    %esi
+  801d50:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801d54:	8b 34 24             	mov    (%esp),%esi
+  801d57:	0f 48 f0             	cmovs  %eax,%esi
+  801d5a:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801d5f:	52                   	push   %edx
+  801d60:	56                   	push   %esi
+  801d61:	55                   	push   %ebp
+  801d62:	57                   	push   %edi
+  801d63:	e8 ad fe ff ff       	call   801c15 <__umoddi3>
+  801d68:	83 c4 10             	add    $0x10,%esp
+  801d6b:	eb 3c                	jmp    801da9 <__moddi3+0x82>
+  801d6d:	89 c3                	mov    %eax,%ebx
+  801d6f:	f7 db                	neg    %ebx
+  801d71:	89 d1                	mov    %edx,%ecx
+  801d73:	83 d1 00             	adc    $0x0,%ecx
+  801d76:	f7 d9                	neg    %ecx
+  801d78:	0f 49 c3             	cmovns %ebx,%eax
+  801d7b:	89 04 24             	mov    %eax,(%esp)
+  801d7e:	0f 49 d1             	cmovns %ecx,%edx
+  801d81:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801d85:	ff 74 24 04          	push   0x4(%esp)
+  801d89:	ff 74 24 04          	push   0x4(%esp)
+  801d8d:	89 f8                	mov    %edi,%eax
+  801d8f:	89 ea                	mov    %ebp,%edx
+  801d91:	f7 d8                	neg    %eax
+  801d93:	83 d2 00             	adc    $0x0,%edx
+  801d96:	f7 da                	neg    %edx
+  801d98:	52                   	push   %edx
+  801d99:	50                   	push   %eax
+  801d9a:	e8 76 fe ff ff       	call   801c15 <__umoddi3>
+  801d9f:	83 c4 10             	add    $0x10,%esp
+  801da2:	f7 d8                	neg    %eax
+  801da4:	83 d2 00             	adc    $0x0,%edx
+  801da7:	f7 da                	neg    %edx
+  801da9:	83 c4 14             	add    $0x14,%esp
+  801dac:	5b                   	pop    %ebx
+  801dad:	5e                   	pop    %esi
+  801dae:	5f                   	pop    %edi
+  801daf:	5d                   	pop    %ebp
+  801db0:	c3                   	ret
@@ -0,0 +1,2943 @@
+
+obj/user/stresssched:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 b6 00 00 00       	call   8000e7 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	e8 aa 0d 00 00       	call   800de7 <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+  80003f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800044:	e8 7c 17 00 00       	call   8017c5 <fork>
+  800049:	85 c0                	test   %eax,%eax
+  80004b:	74 0f                	je     80005c <umain+0x29>
+  80004d:	83 c3 01             	add    $0x1,%ebx
+  800050:	83 fb 14             	cmp    $0x14,%ebx
+  800053:	75 ef                	jne    800044 <umain+0x11>
+  800055:	e8 f5 0d 00 00       	call   800e4f <sys_yield>
+  80005a:	eb 6d                	jmp    8000c9 <umain+0x96>
+  80005c:	81 e6 ff 7f 00 00    	and    $0x7fff,%esi
+  800062:	69 d6 80 03 00 00    	imul   $0x380,%esi,%edx
+  800068:	eb 02                	jmp    80006c <umain+0x39>
+  80006a:	f3 90                	pause
+  80006c:	8b 82 00 00 00 ed    	mov    -0x13000000(%edx),%eax
+  800072:	85 c0                	test   %eax,%eax
+  800074:	75 f4                	jne    80006a <umain+0x37>
+  800076:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  80007b:	eb 12                	jmp    80008f <umain+0x5c>
+  80007d:	a1 20 30 80 00       	mov    0x803020,%eax
+  800082:	83 c0 01             	add    $0x1,%eax
+  800085:	a3 20 30 80 00       	mov    %eax,0x803020
+  80008a:	83 ea 01             	sub    $0x1,%edx
+  80008d:	75 ee                	jne    80007d <umain+0x4a>
+  80008f:	83 eb 01             	sub    $0x1,%ebx
+  800092:	74 0c                	je     8000a0 <umain+0x6d>
+  800094:	e8 b6 0d 00 00       	call   800e4f <sys_yield>
+  800099:	ba 11 27 00 00       	mov    $0x2711,%edx
+  80009e:	eb ea                	jmp    80008a <umain+0x57>
+  8000a0:	a1 20 30 80 00       	mov    0x803020,%eax
+  8000a5:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  8000aa:	75 24                	jne    8000d0 <umain+0x9d>
+  8000ac:	a1 24 30 80 00       	mov    0x803024,%eax
+  8000b1:	8b 50 04             	mov    0x4(%eax),%edx
+  8000b4:	8b 40 40             	mov    0x40(%eax),%eax
+  8000b7:	83 ec 04             	sub    $0x4,%esp
+  8000ba:	52                   	push   %edx
+  8000bb:	50                   	push   %eax
+  8000bc:	68 3b 1e 80 00       	push   $0x801e3b
+  8000c1:	e8 64 01 00 00       	call   80022a <cprintf>
+  8000c6:	83 c4 10             	add    $0x10,%esp
+  8000c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000cc:	5b                   	pop    %ebx
+  8000cd:	5e                   	pop    %esi
+  8000ce:	5d                   	pop    %ebp
+  8000cf:	c3                   	ret
+  8000d0:	a1 20 30 80 00       	mov    0x803020,%eax
+  8000d5:	50                   	push   %eax
+  8000d6:	68 00 1e 80 00       	push   $0x801e00
+  8000db:	6a 21                	push   $0x21
+  8000dd:	68 28 1e 80 00       	push   $0x801e28
+  8000e2:	e8 63 00 00 00       	call   80014a <_panic>
+
+008000e7 <libmain>:
+  8000e7:	55                   	push   %ebp
+  8000e8:	89 e5                	mov    %esp,%ebp
+  8000ea:	56                   	push   %esi
+  8000eb:	53                   	push   %ebx
+  8000ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ef:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000f2:	e8 53 18 00 00       	call   80194a <uinfo_envid>
+  8000f7:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8000fc:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  800102:	05 00 00 00 ed       	add    $0xed000000,%eax
+  800107:	a3 24 30 80 00       	mov    %eax,0x803024
+  80010c:	85 db                	test   %ebx,%ebx
+  80010e:	7e 07                	jle    800117 <libmain+0x30>
+  800110:	8b 06                	mov    (%esi),%eax
+  800112:	a3 00 30 80 00       	mov    %eax,0x803000
+  800117:	83 ec 08             	sub    $0x8,%esp
+  80011a:	56                   	push   %esi
+  80011b:	53                   	push   %ebx
+  80011c:	e8 12 ff ff ff       	call   800033 <umain>
+  800121:	e8 0a 00 00 00       	call   800130 <exit>
+  800126:	83 c4 10             	add    $0x10,%esp
+  800129:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80012c:	5b                   	pop    %ebx
+  80012d:	5e                   	pop    %esi
+  80012e:	5d                   	pop    %ebp
+  80012f:	c3                   	ret
+
+00800130 <exit>:
+  800130:	55                   	push   %ebp
+  800131:	89 e5                	mov    %esp,%ebp
+  800133:	83 ec 08             	sub    $0x8,%esp
+  800136:	e8 a8 18 00 00       	call   8019e3 <bflush>
+  80013b:	83 ec 0c             	sub    $0xc,%esp
+  80013e:	6a 00                	push   $0x0
+  800140:	e8 17 0c 00 00       	call   800d5c <sys_env_destroy>
+  800145:	83 c4 10             	add    $0x10,%esp
+  800148:	c9                   	leave
+  800149:	c3                   	ret
+
+0080014a <_panic>:
+  80014a:	55                   	push   %ebp
+  80014b:	89 e5                	mov    %esp,%ebp
+  80014d:	56                   	push   %esi
+  80014e:	53                   	push   %ebx
+  80014f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800152:	e8 8c 18 00 00       	call   8019e3 <bflush>
+  800157:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80015d:	e8 85 0c 00 00       	call   800de7 <sys_getenvid>
+  800162:	83 ec 0c             	sub    $0xc,%esp
+  800165:	ff 75 0c             	push   0xc(%ebp)
+  800168:	ff 75 08             	push   0x8(%ebp)
+  80016b:	56                   	push   %esi
+  80016c:	50                   	push   %eax
+  80016d:	68 64 1e 80 00       	push   $0x801e64
+  800172:	e8 b3 00 00 00       	call   80022a <cprintf>
+  800177:	83 c4 18             	add    $0x18,%esp
+  80017a:	53                   	push   %ebx
+  80017b:	ff 75 10             	push   0x10(%ebp)
+  80017e:	e8 56 00 00 00       	call   8001d9 <vcprintf>
+  800183:	c7 04 24 57 1e 80 00 	movl   $0x801e57,(%esp)
+  80018a:	e8 9b 00 00 00       	call   80022a <cprintf>
+  80018f:	83 c4 10             	add    $0x10,%esp
+  800192:	cc                   	int3
+  800193:	eb fd                	jmp    800192 <_panic+0x48>
+
+00800195 <putch>:
+  800195:	55                   	push   %ebp
+  800196:	89 e5                	mov    %esp,%ebp
+  800198:	53                   	push   %ebx
+  800199:	83 ec 04             	sub    $0x4,%esp
+  80019c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80019f:	8b 13                	mov    (%ebx),%edx
+  8001a1:	8d 42 01             	lea    0x1(%edx),%eax
+  8001a4:	89 03                	mov    %eax,(%ebx)
+  8001a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001a9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8001ad:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001b2:	74 09                	je     8001bd <putch+0x28>
+  8001b4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8001b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001bb:	c9                   	leave
+  8001bc:	c3                   	ret
+  8001bd:	83 ec 08             	sub    $0x8,%esp
+  8001c0:	68 ff 00 00 00       	push   $0xff
+  8001c5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001c8:	50                   	push   %eax
+  8001c9:	e8 c0 0a 00 00       	call   800c8e <sys_cputs>
+  8001ce:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001d4:	83 c4 10             	add    $0x10,%esp
+  8001d7:	eb db                	jmp    8001b4 <putch+0x1f>
+
+008001d9 <vcprintf>:
+  8001d9:	55                   	push   %ebp
+  8001da:	89 e5                	mov    %esp,%ebp
+  8001dc:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8001e2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001e9:	00 00 00 
+  8001ec:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001f3:	00 00 00 
+  8001f6:	ff 75 0c             	push   0xc(%ebp)
+  8001f9:	ff 75 08             	push   0x8(%ebp)
+  8001fc:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800202:	50                   	push   %eax
+  800203:	68 95 01 80 00       	push   $0x800195
+  800208:	e8 14 01 00 00       	call   800321 <vprintfmt>
+  80020d:	83 c4 08             	add    $0x8,%esp
+  800210:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800216:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80021c:	50                   	push   %eax
+  80021d:	e8 6c 0a 00 00       	call   800c8e <sys_cputs>
+  800222:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800228:	c9                   	leave
+  800229:	c3                   	ret
+
+0080022a <cprintf>:
+  80022a:	55                   	push   %ebp
+  80022b:	89 e5                	mov    %esp,%ebp
+  80022d:	83 ec 10             	sub    $0x10,%esp
+  800230:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800233:	50                   	push   %eax
+  800234:	ff 75 08             	push   0x8(%ebp)
+  800237:	e8 9d ff ff ff       	call   8001d9 <vcprintf>
+  80023c:	c9                   	leave
+  80023d:	c3                   	ret
+
+0080023e <printnum>:
+  80023e:	55                   	push   %ebp
+  80023f:	89 e5                	mov    %esp,%ebp
+  800241:	57                   	push   %edi
+  800242:	56                   	push   %esi
+  800243:	53                   	push   %ebx
+  800244:	83 ec 1c             	sub    $0x1c,%esp
+  800247:	89 c7                	mov    %eax,%edi
+  800249:	89 d6                	mov    %edx,%esi
+  80024b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80024e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800251:	89 d1                	mov    %edx,%ecx
+  800253:	89 c2                	mov    %eax,%edx
+  800255:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800258:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80025b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80025e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800261:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800264:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80026b:	39 c2                	cmp    %eax,%edx
+  80026d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800270:	72 3e                	jb     8002b0 <printnum+0x72>
+  800272:	83 ec 0c             	sub    $0xc,%esp
+  800275:	ff 75 18             	push   0x18(%ebp)
+  800278:	83 eb 01             	sub    $0x1,%ebx
+  80027b:	53                   	push   %ebx
+  80027c:	50                   	push   %eax
+  80027d:	83 ec 08             	sub    $0x8,%esp
+  800280:	ff 75 e4             	push   -0x1c(%ebp)
+  800283:	ff 75 e0             	push   -0x20(%ebp)
+  800286:	ff 75 dc             	push   -0x24(%ebp)
+  800289:	ff 75 d8             	push   -0x28(%ebp)
+  80028c:	e8 de 18 00 00       	call   801b6f <__udivdi3>
+  800291:	83 c4 18             	add    $0x18,%esp
+  800294:	52                   	push   %edx
+  800295:	50                   	push   %eax
+  800296:	89 f2                	mov    %esi,%edx
+  800298:	89 f8                	mov    %edi,%eax
+  80029a:	e8 9f ff ff ff       	call   80023e <printnum>
+  80029f:	83 c4 20             	add    $0x20,%esp
+  8002a2:	eb 13                	jmp    8002b7 <printnum+0x79>
+  8002a4:	83 ec 08             	sub    $0x8,%esp
+  8002a7:	56                   	push   %esi
+  8002a8:	ff 75 18             	push   0x18(%ebp)
+  8002ab:	ff d7                	call   *%edi
+  8002ad:	83 c4 10             	add    $0x10,%esp
+  8002b0:	83 eb 01             	sub    $0x1,%ebx
+  8002b3:	85 db                	test   %ebx,%ebx
+  8002b5:	7f ed                	jg     8002a4 <printnum+0x66>
+  8002b7:	83 ec 08             	sub    $0x8,%esp
+  8002ba:	56                   	push   %esi
+  8002bb:	83 ec 04             	sub    $0x4,%esp
+  8002be:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c1:	ff 75 e0             	push   -0x20(%ebp)
+  8002c4:	ff 75 dc             	push   -0x24(%ebp)
+  8002c7:	ff 75 d8             	push   -0x28(%ebp)
+  8002ca:	e8 78 19 00 00       	call   801c47 <__umoddi3>
+  8002cf:	83 c4 14             	add    $0x14,%esp
+  8002d2:	0f be 80 87 1e 80 00 	movsbl 0x801e87(%eax),%eax
+  8002d9:	50                   	push   %eax
+  8002da:	ff d7                	call   *%edi
+  8002dc:	83 c4 10             	add    $0x10,%esp
+  8002df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e2:	5b                   	pop    %ebx
+  8002e3:	5e                   	pop    %esi
+  8002e4:	5f                   	pop    %edi
+  8002e5:	5d                   	pop    %ebp
+  8002e6:	c3                   	ret
+
+008002e7 <sprintputch>:
+  8002e7:	55                   	push   %ebp
+  8002e8:	89 e5                	mov    %esp,%ebp
+  8002ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002ed:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8002f1:	8b 10                	mov    (%eax),%edx
+  8002f3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002f6:	73 0a                	jae    800302 <sprintputch+0x1b>
+  8002f8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002fb:	89 08                	mov    %ecx,(%eax)
+  8002fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800300:	88 02                	mov    %al,(%edx)
+  800302:	5d                   	pop    %ebp
+  800303:	c3                   	ret
+
+00800304 <printfmt>:
+  800304:	55                   	push   %ebp
+  800305:	89 e5                	mov    %esp,%ebp
+  800307:	83 ec 08             	sub    $0x8,%esp
+  80030a:	8d 45 14             	lea    0x14(%ebp),%eax
+  80030d:	50                   	push   %eax
+  80030e:	ff 75 10             	push   0x10(%ebp)
+  800311:	ff 75 0c             	push   0xc(%ebp)
+  800314:	ff 75 08             	push   0x8(%ebp)
+  800317:	e8 05 00 00 00       	call   800321 <vprintfmt>
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	c9                   	leave
+  800320:	c3                   	ret
+
+00800321 <vprintfmt>:
+  800321:	55                   	push   %ebp
+  800322:	89 e5                	mov    %esp,%ebp
+  800324:	57                   	push   %edi
+  800325:	56                   	push   %esi
+  800326:	53                   	push   %ebx
+  800327:	83 ec 2c             	sub    $0x2c,%esp
+  80032a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80032d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800330:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800333:	eb 0a                	jmp    80033f <vprintfmt+0x1e>
+  800335:	83 ec 08             	sub    $0x8,%esp
+  800338:	53                   	push   %ebx
+  800339:	50                   	push   %eax
+  80033a:	ff d6                	call   *%esi
+  80033c:	83 c4 10             	add    $0x10,%esp
+  80033f:	83 c7 01             	add    $0x1,%edi
+  800342:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800346:	83 f8 25             	cmp    $0x25,%eax
+  800349:	74 0c                	je     800357 <vprintfmt+0x36>
+  80034b:	85 c0                	test   %eax,%eax
+  80034d:	75 e6                	jne    800335 <vprintfmt+0x14>
+  80034f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800352:	5b                   	pop    %ebx
+  800353:	5e                   	pop    %esi
+  800354:	5f                   	pop    %edi
+  800355:	5d                   	pop    %ebp
+  800356:	c3                   	ret
+  800357:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  80035b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800362:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800369:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800370:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800375:	8d 47 01             	lea    0x1(%edi),%eax
+  800378:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80037b:	0f b6 17             	movzbl (%edi),%edx
+  80037e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800381:	3c 55                	cmp    $0x55,%al
+  800383:	0f 87 cf 03 00 00    	ja     800758 <vprintfmt+0x437>
+  800389:	0f b6 c0             	movzbl %al,%eax
+  80038c:	ff 24 85 40 1f 80 00 	jmp    *0x801f40(,%eax,4)
+  800393:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800396:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80039a:	eb d9                	jmp    800375 <vprintfmt+0x54>
+  80039c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80039f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003a3:	eb d0                	jmp    800375 <vprintfmt+0x54>
+  8003a5:	0f b6 d2             	movzbl %dl,%edx
+  8003a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8003b3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003b6:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  8003ba:	0f be 17             	movsbl (%edi),%edx
+  8003bd:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003c0:	83 f9 09             	cmp    $0x9,%ecx
+  8003c3:	77 55                	ja     80041a <vprintfmt+0xf9>
+  8003c5:	83 c7 01             	add    $0x1,%edi
+  8003c8:	eb e9                	jmp    8003b3 <vprintfmt+0x92>
+  8003ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cd:	8b 00                	mov    (%eax),%eax
+  8003cf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8003d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8003db:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003de:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003e2:	79 91                	jns    800375 <vprintfmt+0x54>
+  8003e4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003e7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003ea:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003f1:	eb 82                	jmp    800375 <vprintfmt+0x54>
+  8003f3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003f6:	85 d2                	test   %edx,%edx
+  8003f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003fd:	0f 49 c2             	cmovns %edx,%eax
+  800400:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800403:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800406:	e9 6a ff ff ff       	jmp    800375 <vprintfmt+0x54>
+  80040b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80040e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800415:	e9 5b ff ff ff       	jmp    800375 <vprintfmt+0x54>
+  80041a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80041d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800420:	eb bc                	jmp    8003de <vprintfmt+0xbd>
+  800422:	83 c1 01             	add    $0x1,%ecx
+  800425:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800428:	e9 48 ff ff ff       	jmp    800375 <vprintfmt+0x54>
+  80042d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800430:	8d 78 04             	lea    0x4(%eax),%edi
+  800433:	83 ec 08             	sub    $0x8,%esp
+  800436:	53                   	push   %ebx
+  800437:	ff 30                	push   (%eax)
+  800439:	ff d6                	call   *%esi
+  80043b:	83 c4 10             	add    $0x10,%esp
+  80043e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800441:	e9 b1 02 00 00       	jmp    8006f7 <vprintfmt+0x3d6>
+  800446:	8b 45 14             	mov    0x14(%ebp),%eax
+  800449:	8d 78 04             	lea    0x4(%eax),%edi
+  80044c:	8b 10                	mov    (%eax),%edx
+  80044e:	89 d0                	mov    %edx,%eax
+  800450:	f7 d8                	neg    %eax
+  800452:	0f 48 c2             	cmovs  %edx,%eax
+  800455:	83 f8 08             	cmp    $0x8,%eax
+  800458:	7f 23                	jg     80047d <vprintfmt+0x15c>
+  80045a:	8b 14 85 a0 20 80 00 	mov    0x8020a0(,%eax,4),%edx
+  800461:	85 d2                	test   %edx,%edx
+  800463:	74 18                	je     80047d <vprintfmt+0x15c>
+  800465:	52                   	push   %edx
+  800466:	68 a8 1e 80 00       	push   $0x801ea8
+  80046b:	53                   	push   %ebx
+  80046c:	56                   	push   %esi
+  80046d:	e8 92 fe ff ff       	call   800304 <printfmt>
+  800472:	83 c4 10             	add    $0x10,%esp
+  800475:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800478:	e9 7a 02 00 00       	jmp    8006f7 <vprintfmt+0x3d6>
+  80047d:	50                   	push   %eax
+  80047e:	68 9f 1e 80 00       	push   $0x801e9f
+  800483:	53                   	push   %ebx
+  800484:	56                   	push   %esi
+  800485:	e8 7a fe ff ff       	call   800304 <printfmt>
+  80048a:	83 c4 10             	add    $0x10,%esp
+  80048d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800490:	e9 62 02 00 00       	jmp    8006f7 <vprintfmt+0x3d6>
+  800495:	8b 45 14             	mov    0x14(%ebp),%eax
+  800498:	83 c0 04             	add    $0x4,%eax
+  80049b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80049e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a1:	8b 08                	mov    (%eax),%ecx
+  8004a3:	85 c9                	test   %ecx,%ecx
+  8004a5:	b8 98 1e 80 00       	mov    $0x801e98,%eax
+  8004aa:	0f 45 c1             	cmovne %ecx,%eax
+  8004ad:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004b0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004b4:	7e 06                	jle    8004bc <vprintfmt+0x19b>
+  8004b6:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004ba:	75 0b                	jne    8004c7 <vprintfmt+0x1a6>
+  8004bc:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004bf:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004c2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004c5:	eb 5c                	jmp    800523 <vprintfmt+0x202>
+  8004c7:	83 ec 08             	sub    $0x8,%esp
+  8004ca:	ff 75 d0             	push   -0x30(%ebp)
+  8004cd:	ff 75 cc             	push   -0x34(%ebp)
+  8004d0:	e8 87 03 00 00       	call   80085c <strnlen>
+  8004d5:	89 c2                	mov    %eax,%edx
+  8004d7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004da:	29 d0                	sub    %edx,%eax
+  8004dc:	83 c4 10             	add    $0x10,%esp
+  8004df:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004e3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004e9:	89 c6                	mov    %eax,%esi
+  8004eb:	eb 0e                	jmp    8004fb <vprintfmt+0x1da>
+  8004ed:	83 ec 08             	sub    $0x8,%esp
+  8004f0:	53                   	push   %ebx
+  8004f1:	57                   	push   %edi
+  8004f2:	ff 55 08             	call   *0x8(%ebp)
+  8004f5:	83 ee 01             	sub    $0x1,%esi
+  8004f8:	83 c4 10             	add    $0x10,%esp
+  8004fb:	85 f6                	test   %esi,%esi
+  8004fd:	7f ee                	jg     8004ed <vprintfmt+0x1cc>
+  8004ff:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800502:	8b 75 08             	mov    0x8(%ebp),%esi
+  800505:	85 c0                	test   %eax,%eax
+  800507:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050c:	0f 49 d0             	cmovns %eax,%edx
+  80050f:	29 d0                	sub    %edx,%eax
+  800511:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800514:	eb a6                	jmp    8004bc <vprintfmt+0x19b>
+  800516:	83 ec 08             	sub    $0x8,%esp
+  800519:	53                   	push   %ebx
+  80051a:	52                   	push   %edx
+  80051b:	ff 55 08             	call   *0x8(%ebp)
+  80051e:	83 c4 10             	add    $0x10,%esp
+  800521:	89 f1                	mov    %esi,%ecx
+  800523:	8d 71 01             	lea    0x1(%ecx),%esi
+  800526:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80052a:	0f be d0             	movsbl %al,%edx
+  80052d:	85 d2                	test   %edx,%edx
+  80052f:	74 28                	je     800559 <vprintfmt+0x238>
+  800531:	85 ff                	test   %edi,%edi
+  800533:	78 05                	js     80053a <vprintfmt+0x219>
+  800535:	83 ef 01             	sub    $0x1,%edi
+  800538:	78 30                	js     80056a <vprintfmt+0x249>
+  80053a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80053e:	74 d6                	je     800516 <vprintfmt+0x1f5>
+  800540:	0f be c0             	movsbl %al,%eax
+  800543:	83 e8 20             	sub    $0x20,%eax
+  800546:	83 f8 5e             	cmp    $0x5e,%eax
+  800549:	76 cb                	jbe    800516 <vprintfmt+0x1f5>
+  80054b:	83 ec 08             	sub    $0x8,%esp
+  80054e:	53                   	push   %ebx
+  80054f:	6a 3f                	push   $0x3f
+  800551:	ff 55 08             	call   *0x8(%ebp)
+  800554:	83 c4 10             	add    $0x10,%esp
+  800557:	eb c8                	jmp    800521 <vprintfmt+0x200>
+  800559:	8b 75 08             	mov    0x8(%ebp),%esi
+  80055c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80055f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800562:	01 d0                	add    %edx,%eax
+  800564:	29 c8                	sub    %ecx,%eax
+  800566:	89 c7                	mov    %eax,%edi
+  800568:	eb 13                	jmp    80057d <vprintfmt+0x25c>
+  80056a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80056d:	eb ed                	jmp    80055c <vprintfmt+0x23b>
+  80056f:	83 ec 08             	sub    $0x8,%esp
+  800572:	53                   	push   %ebx
+  800573:	6a 20                	push   $0x20
+  800575:	ff d6                	call   *%esi
+  800577:	83 ef 01             	sub    $0x1,%edi
+  80057a:	83 c4 10             	add    $0x10,%esp
+  80057d:	85 ff                	test   %edi,%edi
+  80057f:	7f ee                	jg     80056f <vprintfmt+0x24e>
+  800581:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800584:	89 45 14             	mov    %eax,0x14(%ebp)
+  800587:	e9 6b 01 00 00       	jmp    8006f7 <vprintfmt+0x3d6>
+  80058c:	83 f9 01             	cmp    $0x1,%ecx
+  80058f:	7f 1f                	jg     8005b0 <vprintfmt+0x28f>
+  800591:	85 c9                	test   %ecx,%ecx
+  800593:	74 67                	je     8005fc <vprintfmt+0x2db>
+  800595:	8b 45 14             	mov    0x14(%ebp),%eax
+  800598:	8b 00                	mov    (%eax),%eax
+  80059a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80059d:	89 c1                	mov    %eax,%ecx
+  80059f:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005a2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ae:	eb 17                	jmp    8005c7 <vprintfmt+0x2a6>
+  8005b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b3:	8b 50 04             	mov    0x4(%eax),%edx
+  8005b6:	8b 00                	mov    (%eax),%eax
+  8005b8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005bb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c1:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ca:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005cd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005d2:	85 c9                	test   %ecx,%ecx
+  8005d4:	0f 89 03 01 00 00    	jns    8006dd <vprintfmt+0x3bc>
+  8005da:	83 ec 08             	sub    $0x8,%esp
+  8005dd:	53                   	push   %ebx
+  8005de:	6a 2d                	push   $0x2d
+  8005e0:	ff d6                	call   *%esi
+  8005e2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005e5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005e8:	f7 da                	neg    %edx
+  8005ea:	83 d1 00             	adc    $0x0,%ecx
+  8005ed:	f7 d9                	neg    %ecx
+  8005ef:	83 c4 10             	add    $0x10,%esp
+  8005f2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005f7:	e9 e1 00 00 00       	jmp    8006dd <vprintfmt+0x3bc>
+  8005fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ff:	8b 00                	mov    (%eax),%eax
+  800601:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800604:	89 c1                	mov    %eax,%ecx
+  800606:	c1 f9 1f             	sar    $0x1f,%ecx
+  800609:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80060c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060f:	8d 40 04             	lea    0x4(%eax),%eax
+  800612:	89 45 14             	mov    %eax,0x14(%ebp)
+  800615:	eb b0                	jmp    8005c7 <vprintfmt+0x2a6>
+  800617:	83 f9 01             	cmp    $0x1,%ecx
+  80061a:	7f 1e                	jg     80063a <vprintfmt+0x319>
+  80061c:	85 c9                	test   %ecx,%ecx
+  80061e:	74 32                	je     800652 <vprintfmt+0x331>
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	8b 10                	mov    (%eax),%edx
+  800625:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062a:	8d 40 04             	lea    0x4(%eax),%eax
+  80062d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800630:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800635:	e9 a3 00 00 00       	jmp    8006dd <vprintfmt+0x3bc>
+  80063a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063d:	8b 10                	mov    (%eax),%edx
+  80063f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800642:	8d 40 08             	lea    0x8(%eax),%eax
+  800645:	89 45 14             	mov    %eax,0x14(%ebp)
+  800648:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80064d:	e9 8b 00 00 00       	jmp    8006dd <vprintfmt+0x3bc>
+  800652:	8b 45 14             	mov    0x14(%ebp),%eax
+  800655:	8b 10                	mov    (%eax),%edx
+  800657:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065c:	8d 40 04             	lea    0x4(%eax),%eax
+  80065f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800662:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800667:	eb 74                	jmp    8006dd <vprintfmt+0x3bc>
+  800669:	83 f9 01             	cmp    $0x1,%ecx
+  80066c:	7f 1b                	jg     800689 <vprintfmt+0x368>
+  80066e:	85 c9                	test   %ecx,%ecx
+  800670:	74 2c                	je     80069e <vprintfmt+0x37d>
+  800672:	8b 45 14             	mov    0x14(%ebp),%eax
+  800675:	8b 10                	mov    (%eax),%edx
+  800677:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067c:	8d 40 04             	lea    0x4(%eax),%eax
+  80067f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800682:	bf 08 00 00 00       	mov    $0x8,%edi
+  800687:	eb 54                	jmp    8006dd <vprintfmt+0x3bc>
+  800689:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068c:	8b 10                	mov    (%eax),%edx
+  80068e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800691:	8d 40 08             	lea    0x8(%eax),%eax
+  800694:	89 45 14             	mov    %eax,0x14(%ebp)
+  800697:	bf 08 00 00 00       	mov    $0x8,%edi
+  80069c:	eb 3f                	jmp    8006dd <vprintfmt+0x3bc>
+  80069e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a1:	8b 10                	mov    (%eax),%edx
+  8006a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ae:	bf 08 00 00 00       	mov    $0x8,%edi
+  8006b3:	eb 28                	jmp    8006dd <vprintfmt+0x3bc>
+  8006b5:	83 ec 08             	sub    $0x8,%esp
+  8006b8:	53                   	push   %ebx
+  8006b9:	6a 30                	push   $0x30
+  8006bb:	ff d6                	call   *%esi
+  8006bd:	83 c4 08             	add    $0x8,%esp
+  8006c0:	53                   	push   %ebx
+  8006c1:	6a 78                	push   $0x78
+  8006c3:	ff d6                	call   *%esi
+  8006c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c8:	8b 10                	mov    (%eax),%edx
+  8006ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006cf:	83 c4 10             	add    $0x10,%esp
+  8006d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d8:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006dd:	83 ec 0c             	sub    $0xc,%esp
+  8006e0:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006e4:	50                   	push   %eax
+  8006e5:	ff 75 e0             	push   -0x20(%ebp)
+  8006e8:	57                   	push   %edi
+  8006e9:	51                   	push   %ecx
+  8006ea:	52                   	push   %edx
+  8006eb:	89 da                	mov    %ebx,%edx
+  8006ed:	89 f0                	mov    %esi,%eax
+  8006ef:	e8 4a fb ff ff       	call   80023e <printnum>
+  8006f4:	83 c4 20             	add    $0x20,%esp
+  8006f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8006fa:	e9 40 fc ff ff       	jmp    80033f <vprintfmt+0x1e>
+  8006ff:	83 f9 01             	cmp    $0x1,%ecx
+  800702:	7f 1b                	jg     80071f <vprintfmt+0x3fe>
+  800704:	85 c9                	test   %ecx,%ecx
+  800706:	74 2c                	je     800734 <vprintfmt+0x413>
+  800708:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070b:	8b 10                	mov    (%eax),%edx
+  80070d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800712:	8d 40 04             	lea    0x4(%eax),%eax
+  800715:	89 45 14             	mov    %eax,0x14(%ebp)
+  800718:	bf 10 00 00 00       	mov    $0x10,%edi
+  80071d:	eb be                	jmp    8006dd <vprintfmt+0x3bc>
+  80071f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800722:	8b 10                	mov    (%eax),%edx
+  800724:	8b 48 04             	mov    0x4(%eax),%ecx
+  800727:	8d 40 08             	lea    0x8(%eax),%eax
+  80072a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80072d:	bf 10 00 00 00       	mov    $0x10,%edi
+  800732:	eb a9                	jmp    8006dd <vprintfmt+0x3bc>
+  800734:	8b 45 14             	mov    0x14(%ebp),%eax
+  800737:	8b 10                	mov    (%eax),%edx
+  800739:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073e:	8d 40 04             	lea    0x4(%eax),%eax
+  800741:	89 45 14             	mov    %eax,0x14(%ebp)
+  800744:	bf 10 00 00 00       	mov    $0x10,%edi
+  800749:	eb 92                	jmp    8006dd <vprintfmt+0x3bc>
+  80074b:	83 ec 08             	sub    $0x8,%esp
+  80074e:	53                   	push   %ebx
+  80074f:	6a 25                	push   $0x25
+  800751:	ff d6                	call   *%esi
+  800753:	83 c4 10             	add    $0x10,%esp
+  800756:	eb 9f                	jmp    8006f7 <vprintfmt+0x3d6>
+  800758:	83 ec 08             	sub    $0x8,%esp
+  80075b:	53                   	push   %ebx
+  80075c:	6a 25                	push   $0x25
+  80075e:	ff d6                	call   *%esi
+  800760:	83 c4 10             	add    $0x10,%esp
+  800763:	89 f8                	mov    %edi,%eax
+  800765:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800769:	74 05                	je     800770 <vprintfmt+0x44f>
+  80076b:	83 e8 01             	sub    $0x1,%eax
+  80076e:	eb f5                	jmp    800765 <vprintfmt+0x444>
+  800770:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800773:	eb 82                	jmp    8006f7 <vprintfmt+0x3d6>
+
+00800775 <vsnprintf>:
+  800775:	55                   	push   %ebp
+  800776:	89 e5                	mov    %esp,%ebp
+  800778:	83 ec 18             	sub    $0x18,%esp
+  80077b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80077e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800781:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800784:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800788:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80078b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800792:	85 c0                	test   %eax,%eax
+  800794:	74 26                	je     8007bc <vsnprintf+0x47>
+  800796:	85 d2                	test   %edx,%edx
+  800798:	7e 22                	jle    8007bc <vsnprintf+0x47>
+  80079a:	ff 75 14             	push   0x14(%ebp)
+  80079d:	ff 75 10             	push   0x10(%ebp)
+  8007a0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007a3:	50                   	push   %eax
+  8007a4:	68 e7 02 80 00       	push   $0x8002e7
+  8007a9:	e8 73 fb ff ff       	call   800321 <vprintfmt>
+  8007ae:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007b1:	c6 00 00             	movb   $0x0,(%eax)
+  8007b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007b7:	83 c4 10             	add    $0x10,%esp
+  8007ba:	c9                   	leave
+  8007bb:	c3                   	ret
+  8007bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007c1:	eb f7                	jmp    8007ba <vsnprintf+0x45>
+
+008007c3 <snprintf>:
+  8007c3:	55                   	push   %ebp
+  8007c4:	89 e5                	mov    %esp,%ebp
+  8007c6:	83 ec 08             	sub    $0x8,%esp
+  8007c9:	8d 45 14             	lea    0x14(%ebp),%eax
+  8007cc:	50                   	push   %eax
+  8007cd:	ff 75 10             	push   0x10(%ebp)
+  8007d0:	ff 75 0c             	push   0xc(%ebp)
+  8007d3:	ff 75 08             	push   0x8(%ebp)
+  8007d6:	e8 9a ff ff ff       	call   800775 <vsnprintf>
+  8007db:	c9                   	leave
+  8007dc:	c3                   	ret
+
+008007dd <copy_fwd>:
+  8007dd:	55                   	push   %ebp
+  8007de:	89 e5                	mov    %esp,%ebp
+  8007e0:	57                   	push   %edi
+  8007e1:	56                   	push   %esi
+  8007e2:	53                   	push   %ebx
+  8007e3:	89 c7                	mov    %eax,%edi
+  8007e5:	89 d6                	mov    %edx,%esi
+  8007e7:	89 c8                	mov    %ecx,%eax
+  8007e9:	83 f9 0f             	cmp    $0xf,%ecx
+  8007ec:	76 1c                	jbe    80080a <copy_fwd+0x2d>
+  8007ee:	89 f9                	mov    %edi,%ecx
+  8007f0:	f7 d9                	neg    %ecx
+  8007f2:	89 cb                	mov    %ecx,%ebx
+  8007f4:	83 e3 03             	and    $0x3,%ebx
+  8007f7:	29 d8                	sub    %ebx,%eax
+  8007f9:	89 c2                	mov    %eax,%edx
+  8007fb:	c1 ea 02             	shr    $0x2,%edx
+  8007fe:	83 e0 03             	and    $0x3,%eax
+  800801:	89 d9                	mov    %ebx,%ecx
+  800803:	fc                   	cld
+  800804:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800806:	89 d1                	mov    %edx,%ecx
+  800808:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80080a:	89 c1                	mov    %eax,%ecx
+  80080c:	fc                   	cld
+  80080d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80080f:	5b                   	pop    %ebx
+  800810:	5e                   	pop    %esi
+  800811:	5f                   	pop    %edi
+  800812:	5d                   	pop    %ebp
+  800813:	c3                   	ret
+
+00800814 <have_sse2>:
+  800814:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80081b:	78 06                	js     800823 <have_sse2+0xf>
+  80081d:	a1 04 30 80 00       	mov    0x803004,%eax
+  800822:	c3                   	ret
+  800823:	55                   	push   %ebp
+  800824:	89 e5                	mov    %esp,%ebp
+  800826:	53                   	push   %ebx
+  800827:	b8 01 00 00 00       	mov    $0x1,%eax
+  80082c:	0f a2                	cpuid
+  80082e:	c1 ea 1a             	shr    $0x1a,%edx
+  800831:	83 e2 01             	and    $0x1,%edx
+  800834:	89 15 04 30 80 00    	mov    %edx,0x803004
+  80083a:	a1 04 30 80 00       	mov    0x803004,%eax
+  80083f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800842:	c9                   	leave
+  800843:	c3                   	ret
+
+00800844 <strlen>:
+  800844:	55                   	push   %ebp
+  800845:	89 e5                	mov    %esp,%ebp
+  800847:	8b 55 08             	mov    0x8(%ebp),%edx
+  80084a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084f:	eb 03                	jmp    800854 <strlen+0x10>
+  800851:	83 c0 01             	add    $0x1,%eax
+  800854:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800858:	75 f7                	jne    800851 <strlen+0xd>
+  80085a:	5d                   	pop    %ebp
+  80085b:	c3                   	ret
+
+0080085c <strnlen>:
+  80085c:	55                   	push   %ebp
+  80085d:	89 e5                	mov    %esp,%ebp
+  80085f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800862:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800865:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086a:	eb 03                	jmp    80086f <strnlen+0x13>
+  80086c:	83 c0 01             	add    $0x1,%eax
+  80086f:	39 d0                	cmp    %edx,%eax
+  800871:	74 08                	je     80087b <strnlen+0x1f>
+  800873:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800877:	75 f3                	jne    80086c <strnlen+0x10>
+  800879:	89 c2                	mov    %eax,%edx
+  80087b:	89 d0                	mov    %edx,%eax
+  80087d:	5d                   	pop    %ebp
+  80087e:	c3                   	ret
+
+0080087f <strcpy>:
+  80087f:	55                   	push   %ebp
+  800880:	89 e5                	mov    %esp,%ebp
+  800882:	53                   	push   %ebx
+  800883:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800886:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800889:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800892:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800895:	83 c0 01             	add    $0x1,%eax
+  800898:	84 d2                	test   %dl,%dl
+  80089a:	75 f2                	jne    80088e <strcpy+0xf>
+  80089c:	89 c8                	mov    %ecx,%eax
+  80089e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a1:	c9                   	leave
+  8008a2:	c3                   	ret
+
+008008a3 <strcat>:
+  8008a3:	55                   	push   %ebp
+  8008a4:	89 e5                	mov    %esp,%ebp
+  8008a6:	53                   	push   %ebx
+  8008a7:	83 ec 10             	sub    $0x10,%esp
+  8008aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8008ad:	53                   	push   %ebx
+  8008ae:	e8 91 ff ff ff       	call   800844 <strlen>
+  8008b3:	83 c4 08             	add    $0x8,%esp
+  8008b6:	ff 75 0c             	push   0xc(%ebp)
+  8008b9:	01 d8                	add    %ebx,%eax
+  8008bb:	50                   	push   %eax
+  8008bc:	e8 be ff ff ff       	call   80087f <strcpy>
+  8008c1:	89 d8                	mov    %ebx,%eax
+  8008c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008c6:	c9                   	leave
+  8008c7:	c3                   	ret
+
+008008c8 <strncpy>:
+  8008c8:	55                   	push   %ebp
+  8008c9:	89 e5                	mov    %esp,%ebp
+  8008cb:	56                   	push   %esi
+  8008cc:	53                   	push   %ebx
+  8008cd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008d3:	89 f3                	mov    %esi,%ebx
+  8008d5:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008d8:	89 f0                	mov    %esi,%eax
+  8008da:	eb 0f                	jmp    8008eb <strncpy+0x23>
+  8008dc:	83 c0 01             	add    $0x1,%eax
+  8008df:	0f b6 0a             	movzbl (%edx),%ecx
+  8008e2:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8008e5:	80 f9 01             	cmp    $0x1,%cl
+  8008e8:	83 da ff             	sbb    $0xffffffff,%edx
+  8008eb:	39 d8                	cmp    %ebx,%eax
+  8008ed:	75 ed                	jne    8008dc <strncpy+0x14>
+  8008ef:	89 f0                	mov    %esi,%eax
+  8008f1:	5b                   	pop    %ebx
+  8008f2:	5e                   	pop    %esi
+  8008f3:	5d                   	pop    %ebp
+  8008f4:	c3                   	ret
+
+008008f5 <strlcpy>:
+  8008f5:	55                   	push   %ebp
+  8008f6:	89 e5                	mov    %esp,%ebp
+  8008f8:	56                   	push   %esi
+  8008f9:	53                   	push   %ebx
+  8008fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800900:	8b 55 10             	mov    0x10(%ebp),%edx
+  800903:	89 f0                	mov    %esi,%eax
+  800905:	85 d2                	test   %edx,%edx
+  800907:	74 21                	je     80092a <strlcpy+0x35>
+  800909:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80090d:	89 f2                	mov    %esi,%edx
+  80090f:	eb 09                	jmp    80091a <strlcpy+0x25>
+  800911:	83 c1 01             	add    $0x1,%ecx
+  800914:	83 c2 01             	add    $0x1,%edx
+  800917:	88 5a ff             	mov    %bl,-0x1(%edx)
+  80091a:	39 c2                	cmp    %eax,%edx
+  80091c:	74 09                	je     800927 <strlcpy+0x32>
+  80091e:	0f b6 19             	movzbl (%ecx),%ebx
+  800921:	84 db                	test   %bl,%bl
+  800923:	75 ec                	jne    800911 <strlcpy+0x1c>
+  800925:	89 d0                	mov    %edx,%eax
+  800927:	c6 00 00             	movb   $0x0,(%eax)
+  80092a:	29 f0                	sub    %esi,%eax
+  80092c:	5b                   	pop    %ebx
+  80092d:	5e                   	pop    %esi
+  80092e:	5d                   	pop    %ebp
+  80092f:	c3                   	ret
+
+00800930 <strcmp>:
+  800930:	55                   	push   %ebp
+  800931:	89 e5                	mov    %esp,%ebp
+  800933:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800936:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800939:	eb 06                	jmp    800941 <strcmp+0x11>
+  80093b:	83 c1 01             	add    $0x1,%ecx
+  80093e:	83 c2 01             	add    $0x1,%edx
+  800941:	0f b6 01             	movzbl (%ecx),%eax
+  800944:	84 c0                	test   %al,%al
+  800946:	74 04                	je     80094c <strcmp+0x1c>
+  800948:	3a 02                	cmp    (%edx),%al
+  80094a:	74 ef                	je     80093b <strcmp+0xb>
+  80094c:	0f b6 c0             	movzbl %al,%eax
+  80094f:	0f b6 12             	movzbl (%edx),%edx
+  800952:	29 d0                	sub    %edx,%eax
+  800954:	5d                   	pop    %ebp
+  800955:	c3                   	ret
+
+00800956 <strncmp>:
+  800956:	55                   	push   %ebp
+  800957:	89 e5                	mov    %esp,%ebp
+  800959:	53                   	push   %ebx
+  80095a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800960:	8b 55 10             	mov    0x10(%ebp),%edx
+  800963:	eb 09                	jmp    80096e <strncmp+0x18>
+  800965:	83 ea 01             	sub    $0x1,%edx
+  800968:	83 c0 01             	add    $0x1,%eax
+  80096b:	83 c1 01             	add    $0x1,%ecx
+  80096e:	85 d2                	test   %edx,%edx
+  800970:	74 18                	je     80098a <strncmp+0x34>
+  800972:	0f b6 18             	movzbl (%eax),%ebx
+  800975:	84 db                	test   %bl,%bl
+  800977:	74 04                	je     80097d <strncmp+0x27>
+  800979:	3a 19                	cmp    (%ecx),%bl
+  80097b:	74 e8                	je     800965 <strncmp+0xf>
+  80097d:	0f b6 00             	movzbl (%eax),%eax
+  800980:	0f b6 11             	movzbl (%ecx),%edx
+  800983:	29 d0                	sub    %edx,%eax
+  800985:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800988:	c9                   	leave
+  800989:	c3                   	ret
+  80098a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098f:	eb f4                	jmp    800985 <strncmp+0x2f>
+
+00800991 <strchr>:
+  800991:	55                   	push   %ebp
+  800992:	89 e5                	mov    %esp,%ebp
+  800994:	8b 45 08             	mov    0x8(%ebp),%eax
+  800997:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80099b:	eb 03                	jmp    8009a0 <strchr+0xf>
+  80099d:	83 c0 01             	add    $0x1,%eax
+  8009a0:	0f b6 10             	movzbl (%eax),%edx
+  8009a3:	84 d2                	test   %dl,%dl
+  8009a5:	74 06                	je     8009ad <strchr+0x1c>
+  8009a7:	38 ca                	cmp    %cl,%dl
+  8009a9:	75 f2                	jne    80099d <strchr+0xc>
+  8009ab:	eb 05                	jmp    8009b2 <strchr+0x21>
+  8009ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b2:	5d                   	pop    %ebp
+  8009b3:	c3                   	ret
+
+008009b4 <strfind>:
+  8009b4:	55                   	push   %ebp
+  8009b5:	89 e5                	mov    %esp,%ebp
+  8009b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ba:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8009be:	0f b6 10             	movzbl (%eax),%edx
+  8009c1:	38 ca                	cmp    %cl,%dl
+  8009c3:	74 09                	je     8009ce <strfind+0x1a>
+  8009c5:	84 d2                	test   %dl,%dl
+  8009c7:	74 05                	je     8009ce <strfind+0x1a>
+  8009c9:	83 c0 01             	add    $0x1,%eax
+  8009cc:	eb f0                	jmp    8009be <strfind+0xa>
+  8009ce:	5d                   	pop    %ebp
+  8009cf:	c3                   	ret
+
+008009d0 <memset>:
+  8009d0:	55                   	push   %ebp
+  8009d1:	89 e5                	mov    %esp,%ebp
+  8009d3:	57                   	push   %edi
+  8009d4:	56                   	push   %esi
+  8009d5:	53                   	push   %ebx
+  8009d6:	83 ec 04             	sub    $0x4,%esp
+  8009d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009dc:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009df:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  8009e3:	89 f7                	mov    %esi,%edi
+  8009e5:	83 fa 0f             	cmp    $0xf,%edx
+  8009e8:	76 24                	jbe    800a0e <memset+0x3e>
+  8009ea:	89 f1                	mov    %esi,%ecx
+  8009ec:	f7 d9                	neg    %ecx
+  8009ee:	83 e1 03             	and    $0x3,%ecx
+  8009f1:	29 ca                	sub    %ecx,%edx
+  8009f3:	89 d0                	mov    %edx,%eax
+  8009f5:	c1 e8 02             	shr    $0x2,%eax
+  8009f8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  8009fb:	83 e2 03             	and    $0x3,%edx
+  8009fe:	89 d8                	mov    %ebx,%eax
+  800a00:	fc                   	cld
+  800a01:	f3 aa                	rep stos %al,%es:(%edi)
+  800a03:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  800a09:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  800a0c:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a0e:	89 d1                	mov    %edx,%ecx
+  800a10:	89 d8                	mov    %ebx,%eax
+  800a12:	fc                   	cld
+  800a13:	f3 aa                	rep stos %al,%es:(%edi)
+  800a15:	89 f0                	mov    %esi,%eax
+  800a17:	83 c4 04             	add    $0x4,%esp
+  800a1a:	5b                   	pop    %ebx
+  800a1b:	5e                   	pop    %esi
+  800a1c:	5f                   	pop    %edi
+  800a1d:	5d                   	pop    %ebp
+  800a1e:	c3                   	ret
+
+00800a1f <memmove>:
+  800a1f:	55                   	push   %ebp
+  800a20:	89 e5                	mov    %esp,%ebp
+  800a22:	57                   	push   %edi
+  800a23:	56                   	push   %esi
+  800a24:	53                   	push   %ebx
+  800a25:	83 ec 0c             	sub    $0xc,%esp
+  800a28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a2b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a2e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800a31:	85 c0                	test   %eax,%eax
+  800a33:	74 14                	je     800a49 <memmove+0x2a>
+  800a35:	39 da                	cmp    %ebx,%edx
+  800a37:	73 07                	jae    800a40 <memmove+0x21>
+  800a39:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  800a3c:	39 cb                	cmp    %ecx,%ebx
+  800a3e:	72 13                	jb     800a53 <memmove+0x34>
+  800a40:	89 c1                	mov    %eax,%ecx
+  800a42:	89 d8                	mov    %ebx,%eax
+  800a44:	e8 94 fd ff ff       	call   8007dd <copy_fwd>
+  800a49:	89 d8                	mov    %ebx,%eax
+  800a4b:	83 c4 0c             	add    $0xc,%esp
+  800a4e:	5b                   	pop    %ebx
+  800a4f:	5e                   	pop    %esi
+  800a50:	5f                   	pop    %edi
+  800a51:	5d                   	pop    %ebp
+  800a52:	c3                   	ret
+  800a53:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800a56:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800a59:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800a5c:	83 f8 0f             	cmp    $0xf,%eax
+  800a5f:	76 23                	jbe    800a84 <memmove+0x65>
+  800a61:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800a64:	83 e1 03             	and    $0x3,%ecx
+  800a67:	29 c8                	sub    %ecx,%eax
+  800a69:	89 c2                	mov    %eax,%edx
+  800a6b:	c1 ea 02             	shr    $0x2,%edx
+  800a6e:	83 e0 03             	and    $0x3,%eax
+  800a71:	fd                   	std
+  800a72:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a74:	83 ef 03             	sub    $0x3,%edi
+  800a77:	83 ee 03             	sub    $0x3,%esi
+  800a7a:	89 d1                	mov    %edx,%ecx
+  800a7c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a7e:	83 c7 03             	add    $0x3,%edi
+  800a81:	83 c6 03             	add    $0x3,%esi
+  800a84:	89 c1                	mov    %eax,%ecx
+  800a86:	fd                   	std
+  800a87:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a89:	fc                   	cld
+  800a8a:	eb bd                	jmp    800a49 <memmove+0x2a>
+
+00800a8c <memcpy>:
+  800a8c:	55                   	push   %ebp
+  800a8d:	89 e5                	mov    %esp,%ebp
+  800a8f:	53                   	push   %ebx
+  800a90:	83 ec 04             	sub    $0x4,%esp
+  800a93:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a96:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a99:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a9c:	89 d8                	mov    %ebx,%eax
+  800a9e:	e8 3a fd ff ff       	call   8007dd <copy_fwd>
+  800aa3:	89 d8                	mov    %ebx,%eax
+  800aa5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa8:	c9                   	leave
+  800aa9:	c3                   	ret
+
+00800aaa <page_copy>:
+  800aaa:	55                   	push   %ebp
+  800aab:	89 e5                	mov    %esp,%ebp
+  800aad:	57                   	push   %edi
+  800aae:	56                   	push   %esi
+  800aaf:	53                   	push   %ebx
+  800ab0:	83 ec 0c             	sub    $0xc,%esp
+  800ab3:	e8 5c fd ff ff       	call   800814 <have_sse2>
+  800ab8:	85 c0                	test   %eax,%eax
+  800aba:	74 39                	je     800af5 <page_copy+0x4b>
+  800abc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800abf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ac2:	be 00 01 00 00       	mov    $0x100,%esi
+  800ac7:	8b 03                	mov    (%ebx),%eax
+  800ac9:	8b 53 04             	mov    0x4(%ebx),%edx
+  800acc:	0f c3 01             	movnti %eax,(%ecx)
+  800acf:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800ad3:	8b 43 08             	mov    0x8(%ebx),%eax
+  800ad6:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800ad9:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800add:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800ae1:	83 c3 10             	add    $0x10,%ebx
+  800ae4:	83 c1 10             	add    $0x10,%ecx
+  800ae7:	4e                   	dec    %esi
+  800ae8:	75 dd                	jne    800ac7 <page_copy+0x1d>
+  800aea:	0f ae f8             	sfence
+  800aed:	83 c4 0c             	add    $0xc,%esp
+  800af0:	5b                   	pop    %ebx
+  800af1:	5e                   	pop    %esi
+  800af2:	5f                   	pop    %edi
+  800af3:	5d                   	pop    %ebp
+  800af4:	c3                   	ret
+  800af5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800af8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800afb:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800b00:	fc                   	cld
+  800b01:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b03:	eb e8                	jmp    800aed <page_copy+0x43>
+
+00800b05 <page_zero>:
+  800b05:	55                   	push   %ebp
+  800b06:	89 e5                	mov    %esp,%ebp
+  800b08:	57                   	push   %edi
+  800b09:	83 ec 04             	sub    $0x4,%esp
+  800b0c:	e8 03 fd ff ff       	call   800814 <have_sse2>
+  800b11:	85 c0                	test   %eax,%eax
+  800b13:	74 3a                	je     800b4f <page_zero+0x4a>
+  800b15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b18:	ba 80 00 00 00       	mov    $0x80,%edx
+  800b1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b22:	0f c3 08             	movnti %ecx,(%eax)
+  800b25:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800b29:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800b2d:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800b31:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800b35:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800b39:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800b3d:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800b41:	83 c0 20             	add    $0x20,%eax
+  800b44:	4a                   	dec    %edx
+  800b45:	75 db                	jne    800b22 <page_zero+0x1d>
+  800b47:	0f ae f8             	sfence
+  800b4a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b4d:	c9                   	leave
+  800b4e:	c3                   	ret
+  800b4f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b52:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800b57:	fc                   	cld
+  800b58:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b5a:	eb ee                	jmp    800b4a <page_zero+0x45>
+
+00800b5c <memcmp>:
+  800b5c:	55                   	push   %ebp
+  800b5d:	89 e5                	mov    %esp,%ebp
+  800b5f:	56                   	push   %esi
+  800b60:	53                   	push   %ebx
+  800b61:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b64:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b67:	89 c6                	mov    %eax,%esi
+  800b69:	03 75 10             	add    0x10(%ebp),%esi
+  800b6c:	eb 06                	jmp    800b74 <memcmp+0x18>
+  800b6e:	83 c0 01             	add    $0x1,%eax
+  800b71:	83 c2 01             	add    $0x1,%edx
+  800b74:	39 f0                	cmp    %esi,%eax
+  800b76:	74 14                	je     800b8c <memcmp+0x30>
+  800b78:	0f b6 08             	movzbl (%eax),%ecx
+  800b7b:	0f b6 1a             	movzbl (%edx),%ebx
+  800b7e:	38 d9                	cmp    %bl,%cl
+  800b80:	74 ec                	je     800b6e <memcmp+0x12>
+  800b82:	0f b6 c1             	movzbl %cl,%eax
+  800b85:	0f b6 db             	movzbl %bl,%ebx
+  800b88:	29 d8                	sub    %ebx,%eax
+  800b8a:	eb 05                	jmp    800b91 <memcmp+0x35>
+  800b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b91:	5b                   	pop    %ebx
+  800b92:	5e                   	pop    %esi
+  800b93:	5d                   	pop    %ebp
+  800b94:	c3                   	ret
+
+00800b95 <memfind>:
+  800b95:	55                   	push   %ebp
+  800b96:	89 e5                	mov    %esp,%ebp
+  800b98:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b9e:	89 c2                	mov    %eax,%edx
+  800ba0:	03 55 10             	add    0x10(%ebp),%edx
+  800ba3:	eb 03                	jmp    800ba8 <memfind+0x13>
+  800ba5:	83 c0 01             	add    $0x1,%eax
+  800ba8:	39 d0                	cmp    %edx,%eax
+  800baa:	73 04                	jae    800bb0 <memfind+0x1b>
+  800bac:	38 08                	cmp    %cl,(%eax)
+  800bae:	75 f5                	jne    800ba5 <memfind+0x10>
+  800bb0:	5d                   	pop    %ebp
+  800bb1:	c3                   	ret
+
+00800bb2 <strtol>:
+  800bb2:	55                   	push   %ebp
+  800bb3:	89 e5                	mov    %esp,%ebp
+  800bb5:	57                   	push   %edi
+  800bb6:	56                   	push   %esi
+  800bb7:	53                   	push   %ebx
+  800bb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bbe:	eb 03                	jmp    800bc3 <strtol+0x11>
+  800bc0:	83 c2 01             	add    $0x1,%edx
+  800bc3:	0f b6 02             	movzbl (%edx),%eax
+  800bc6:	3c 20                	cmp    $0x20,%al
+  800bc8:	74 f6                	je     800bc0 <strtol+0xe>
+  800bca:	3c 09                	cmp    $0x9,%al
+  800bcc:	74 f2                	je     800bc0 <strtol+0xe>
+  800bce:	3c 2b                	cmp    $0x2b,%al
+  800bd0:	74 2a                	je     800bfc <strtol+0x4a>
+  800bd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bd7:	3c 2d                	cmp    $0x2d,%al
+  800bd9:	74 2b                	je     800c06 <strtol+0x54>
+  800bdb:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800be1:	75 0f                	jne    800bf2 <strtol+0x40>
+  800be3:	80 3a 30             	cmpb   $0x30,(%edx)
+  800be6:	74 28                	je     800c10 <strtol+0x5e>
+  800be8:	85 db                	test   %ebx,%ebx
+  800bea:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bef:	0f 44 d8             	cmove  %eax,%ebx
+  800bf2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bfa:	eb 46                	jmp    800c42 <strtol+0x90>
+  800bfc:	83 c2 01             	add    $0x1,%edx
+  800bff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c04:	eb d5                	jmp    800bdb <strtol+0x29>
+  800c06:	83 c2 01             	add    $0x1,%edx
+  800c09:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c0e:	eb cb                	jmp    800bdb <strtol+0x29>
+  800c10:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c14:	74 0e                	je     800c24 <strtol+0x72>
+  800c16:	85 db                	test   %ebx,%ebx
+  800c18:	75 d8                	jne    800bf2 <strtol+0x40>
+  800c1a:	83 c2 01             	add    $0x1,%edx
+  800c1d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c22:	eb ce                	jmp    800bf2 <strtol+0x40>
+  800c24:	83 c2 02             	add    $0x2,%edx
+  800c27:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c2c:	eb c4                	jmp    800bf2 <strtol+0x40>
+  800c2e:	0f be c0             	movsbl %al,%eax
+  800c31:	83 e8 30             	sub    $0x30,%eax
+  800c34:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c37:	7d 3a                	jge    800c73 <strtol+0xc1>
+  800c39:	83 c2 01             	add    $0x1,%edx
+  800c3c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c40:	01 c1                	add    %eax,%ecx
+  800c42:	0f b6 02             	movzbl (%edx),%eax
+  800c45:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c48:	89 f3                	mov    %esi,%ebx
+  800c4a:	80 fb 09             	cmp    $0x9,%bl
+  800c4d:	76 df                	jbe    800c2e <strtol+0x7c>
+  800c4f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c52:	89 f3                	mov    %esi,%ebx
+  800c54:	80 fb 19             	cmp    $0x19,%bl
+  800c57:	77 08                	ja     800c61 <strtol+0xaf>
+  800c59:	0f be c0             	movsbl %al,%eax
+  800c5c:	83 e8 57             	sub    $0x57,%eax
+  800c5f:	eb d3                	jmp    800c34 <strtol+0x82>
+  800c61:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c64:	89 f3                	mov    %esi,%ebx
+  800c66:	80 fb 19             	cmp    $0x19,%bl
+  800c69:	77 08                	ja     800c73 <strtol+0xc1>
+  800c6b:	0f be c0             	movsbl %al,%eax
+  800c6e:	83 e8 37             	sub    $0x37,%eax
+  800c71:	eb c1                	jmp    800c34 <strtol+0x82>
+  800c73:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c77:	74 05                	je     800c7e <strtol+0xcc>
+  800c79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c7c:	89 10                	mov    %edx,(%eax)
+  800c7e:	89 c8                	mov    %ecx,%eax
+  800c80:	f7 d8                	neg    %eax
+  800c82:	85 ff                	test   %edi,%edi
+  800c84:	0f 45 c8             	cmovne %eax,%ecx
+  800c87:	89 c8                	mov    %ecx,%eax
+  800c89:	5b                   	pop    %ebx
+  800c8a:	5e                   	pop    %esi
+  800c8b:	5f                   	pop    %edi
+  800c8c:	5d                   	pop    %ebp
+  800c8d:	c3                   	ret
+
+00800c8e <sys_cputs>:
+  800c8e:	55                   	push   %ebp
+  800c8f:	89 e5                	mov    %esp,%ebp
+  800c91:	57                   	push   %edi
+  800c92:	56                   	push   %esi
+  800c93:	53                   	push   %ebx
+  800c94:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c9b:	78 21                	js     800cbe <sys_cputs+0x30>
+  800c9d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ca4:	75 2d                	jne    800cd3 <sys_cputs+0x45>
+  800ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb1:	89 c3                	mov    %eax,%ebx
+  800cb3:	89 c7                	mov    %eax,%edi
+  800cb5:	89 c6                	mov    %eax,%esi
+  800cb7:	cd 30                	int    $0x30
+  800cb9:	5b                   	pop    %ebx
+  800cba:	5e                   	pop    %esi
+  800cbb:	5f                   	pop    %edi
+  800cbc:	5d                   	pop    %ebp
+  800cbd:	c3                   	ret
+  800cbe:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cc3:	0f a2                	cpuid
+  800cc5:	c1 ea 0b             	shr    $0xb,%edx
+  800cc8:	83 e2 01             	and    $0x1,%edx
+  800ccb:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800cd1:	eb ca                	jmp    800c9d <sys_cputs+0xf>
+  800cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cde:	89 c3                	mov    %eax,%ebx
+  800ce0:	89 c7                	mov    %eax,%edi
+  800ce2:	89 c6                	mov    %eax,%esi
+  800ce4:	55                   	push   %ebp
+  800ce5:	68 ee 0c 80 00       	push   $0x800cee
+  800cea:	89 e5                	mov    %esp,%ebp
+  800cec:	0f 34                	sysenter
+  800cee:	83 c4 04             	add    $0x4,%esp
+  800cf1:	5d                   	pop    %ebp
+  800cf2:	eb c5                	jmp    800cb9 <sys_cputs+0x2b>
+
+00800cf4 <sys_cgetc>:
+  800cf4:	55                   	push   %ebp
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	57                   	push   %edi
+  800cf8:	56                   	push   %esi
+  800cf9:	53                   	push   %ebx
+  800cfa:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d01:	78 22                	js     800d25 <sys_cgetc+0x31>
+  800d03:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d0a:	75 2e                	jne    800d3a <sys_cgetc+0x46>
+  800d0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d11:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d16:	89 d1                	mov    %edx,%ecx
+  800d18:	89 d3                	mov    %edx,%ebx
+  800d1a:	89 d7                	mov    %edx,%edi
+  800d1c:	89 d6                	mov    %edx,%esi
+  800d1e:	cd 30                	int    $0x30
+  800d20:	5b                   	pop    %ebx
+  800d21:	5e                   	pop    %esi
+  800d22:	5f                   	pop    %edi
+  800d23:	5d                   	pop    %ebp
+  800d24:	c3                   	ret
+  800d25:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d2a:	0f a2                	cpuid
+  800d2c:	c1 ea 0b             	shr    $0xb,%edx
+  800d2f:	83 e2 01             	and    $0x1,%edx
+  800d32:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800d38:	eb c9                	jmp    800d03 <sys_cgetc+0xf>
+  800d3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d3f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d44:	89 d1                	mov    %edx,%ecx
+  800d46:	89 d3                	mov    %edx,%ebx
+  800d48:	89 d7                	mov    %edx,%edi
+  800d4a:	89 d6                	mov    %edx,%esi
+  800d4c:	55                   	push   %ebp
+  800d4d:	68 56 0d 80 00       	push   $0x800d56
+  800d52:	89 e5                	mov    %esp,%ebp
+  800d54:	0f 34                	sysenter
+  800d56:	83 c4 04             	add    $0x4,%esp
+  800d59:	5d                   	pop    %ebp
+  800d5a:	eb c4                	jmp    800d20 <sys_cgetc+0x2c>
+
+00800d5c <sys_env_destroy>:
+  800d5c:	55                   	push   %ebp
+  800d5d:	89 e5                	mov    %esp,%ebp
+  800d5f:	57                   	push   %edi
+  800d60:	56                   	push   %esi
+  800d61:	53                   	push   %ebx
+  800d62:	83 ec 0c             	sub    $0xc,%esp
+  800d65:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d6c:	78 2a                	js     800d98 <sys_env_destroy+0x3c>
+  800d6e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d75:	75 36                	jne    800dad <sys_env_destroy+0x51>
+  800d77:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d7c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d84:	89 cb                	mov    %ecx,%ebx
+  800d86:	89 cf                	mov    %ecx,%edi
+  800d88:	89 ce                	mov    %ecx,%esi
+  800d8a:	cd 30                	int    $0x30
+  800d8c:	85 c0                	test   %eax,%eax
+  800d8e:	7f 40                	jg     800dd0 <sys_env_destroy+0x74>
+  800d90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d93:	5b                   	pop    %ebx
+  800d94:	5e                   	pop    %esi
+  800d95:	5f                   	pop    %edi
+  800d96:	5d                   	pop    %ebp
+  800d97:	c3                   	ret
+  800d98:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d9d:	0f a2                	cpuid
+  800d9f:	c1 ea 0b             	shr    $0xb,%edx
+  800da2:	83 e2 01             	and    $0x1,%edx
+  800da5:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800dab:	eb c1                	jmp    800d6e <sys_env_destroy+0x12>
+  800dad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800db5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dba:	89 cb                	mov    %ecx,%ebx
+  800dbc:	89 cf                	mov    %ecx,%edi
+  800dbe:	89 ce                	mov    %ecx,%esi
+  800dc0:	55                   	push   %ebp
+  800dc1:	68 ca 0d 80 00       	push   $0x800dca
+  800dc6:	89 e5                	mov    %esp,%ebp
+  800dc8:	0f 34                	sysenter
+  800dca:	83 c4 04             	add    $0x4,%esp
+  800dcd:	5d                   	pop    %ebp
+  800dce:	eb bc                	jmp    800d8c <sys_env_destroy+0x30>
+  800dd0:	83 ec 0c             	sub    $0xc,%esp
+  800dd3:	50                   	push   %eax
+  800dd4:	6a 03                	push   $0x3
+  800dd6:	68 c4 20 80 00       	push   $0x8020c4
+  800ddb:	6a 49                	push   $0x49
+  800ddd:	68 e1 20 80 00       	push   $0x8020e1
+  800de2:	e8 63 f3 ff ff       	call   80014a <_panic>
+
+00800de7 <sys_getenvid>:
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	57                   	push   %edi
+  800deb:	56                   	push   %esi
+  800dec:	53                   	push   %ebx
+  800ded:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800df4:	78 22                	js     800e18 <sys_getenvid+0x31>
+  800df6:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800dfd:	75 2e                	jne    800e2d <sys_getenvid+0x46>
+  800dff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e04:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e09:	89 d1                	mov    %edx,%ecx
+  800e0b:	89 d3                	mov    %edx,%ebx
+  800e0d:	89 d7                	mov    %edx,%edi
+  800e0f:	89 d6                	mov    %edx,%esi
+  800e11:	cd 30                	int    $0x30
+  800e13:	5b                   	pop    %ebx
+  800e14:	5e                   	pop    %esi
+  800e15:	5f                   	pop    %edi
+  800e16:	5d                   	pop    %ebp
+  800e17:	c3                   	ret
+  800e18:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e1d:	0f a2                	cpuid
+  800e1f:	c1 ea 0b             	shr    $0xb,%edx
+  800e22:	83 e2 01             	and    $0x1,%edx
+  800e25:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800e2b:	eb c9                	jmp    800df6 <sys_getenvid+0xf>
+  800e2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e32:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e37:	89 d1                	mov    %edx,%ecx
+  800e39:	89 d3                	mov    %edx,%ebx
+  800e3b:	89 d7                	mov    %edx,%edi
+  800e3d:	89 d6                	mov    %edx,%esi
+  800e3f:	55                   	push   %ebp
+  800e40:	68 49 0e 80 00       	push   $0x800e49
+  800e45:	89 e5                	mov    %esp,%ebp
+  800e47:	0f 34                	sysenter
+  800e49:	83 c4 04             	add    $0x4,%esp
+  800e4c:	5d                   	pop    %ebp
+  800e4d:	eb c4                	jmp    800e13 <sys_getenvid+0x2c>
+
+00800e4f <sys_yield>:
+  800e4f:	55                   	push   %ebp
+  800e50:	89 e5                	mov    %esp,%ebp
+  800e52:	57                   	push   %edi
+  800e53:	56                   	push   %esi
+  800e54:	53                   	push   %ebx
+  800e55:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e5c:	78 22                	js     800e80 <sys_yield+0x31>
+  800e5e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e65:	75 2e                	jne    800e95 <sys_yield+0x46>
+  800e67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e71:	89 d1                	mov    %edx,%ecx
+  800e73:	89 d3                	mov    %edx,%ebx
+  800e75:	89 d7                	mov    %edx,%edi
+  800e77:	89 d6                	mov    %edx,%esi
+  800e79:	cd 30                	int    $0x30
+  800e7b:	5b                   	pop    %ebx
+  800e7c:	5e                   	pop    %esi
+  800e7d:	5f                   	pop    %edi
+  800e7e:	5d                   	pop    %ebp
+  800e7f:	c3                   	ret
+  800e80:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e85:	0f a2                	cpuid
+  800e87:	c1 ea 0b             	shr    $0xb,%edx
+  800e8a:	83 e2 01             	and    $0x1,%edx
+  800e8d:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800e93:	eb c9                	jmp    800e5e <sys_yield+0xf>
+  800e95:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e9a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e9f:	89 d1                	mov    %edx,%ecx
+  800ea1:	89 d3                	mov    %edx,%ebx
+  800ea3:	89 d7                	mov    %edx,%edi
+  800ea5:	89 d6                	mov    %edx,%esi
+  800ea7:	55                   	push   %ebp
+  800ea8:	68 b1 0e 80 00       	push   $0x800eb1
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	0f 34                	sysenter
+  800eb1:	83 c4 04             	add    $0x4,%esp
+  800eb4:	5d                   	pop    %ebp
+  800eb5:	eb c4                	jmp    800e7b <sys_yield+0x2c>
+
+00800eb7 <sys_env_set_cow>:
+  800eb7:	55                   	push   %ebp
+  800eb8:	89 e5                	mov    %esp,%ebp
+  800eba:	57                   	push   %edi
+  800ebb:	56                   	push   %esi
+  800ebc:	53                   	push   %ebx
+  800ebd:	83 ec 0c             	sub    $0xc,%esp
+  800ec0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ec7:	78 2b                	js     800ef4 <sys_env_set_cow+0x3d>
+  800ec9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ed0:	75 37                	jne    800f09 <sys_env_set_cow+0x52>
+  800ed2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800edc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee2:	89 df                	mov    %ebx,%edi
+  800ee4:	89 de                	mov    %ebx,%esi
+  800ee6:	cd 30                	int    $0x30
+  800ee8:	85 c0                	test   %eax,%eax
+  800eea:	7f 41                	jg     800f2d <sys_env_set_cow+0x76>
+  800eec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eef:	5b                   	pop    %ebx
+  800ef0:	5e                   	pop    %esi
+  800ef1:	5f                   	pop    %edi
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	c3                   	ret
+  800ef4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ef9:	0f a2                	cpuid
+  800efb:	c1 ea 0b             	shr    $0xb,%edx
+  800efe:	83 e2 01             	and    $0x1,%edx
+  800f01:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800f07:	eb c0                	jmp    800ec9 <sys_env_set_cow+0x12>
+  800f09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f14:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f19:	89 df                	mov    %ebx,%edi
+  800f1b:	89 de                	mov    %ebx,%esi
+  800f1d:	55                   	push   %ebp
+  800f1e:	68 27 0f 80 00       	push   $0x800f27
+  800f23:	89 e5                	mov    %esp,%ebp
+  800f25:	0f 34                	sysenter
+  800f27:	83 c4 04             	add    $0x4,%esp
+  800f2a:	5d                   	pop    %ebp
+  800f2b:	eb bb                	jmp    800ee8 <sys_env_set_cow+0x31>
+  800f2d:	83 ec 0c             	sub    $0xc,%esp
+  800f30:	50                   	push   %eax
+  800f31:	6a 0d                	push   $0xd
+  800f33:	68 c4 20 80 00       	push   $0x8020c4
+  800f38:	6a 49                	push   $0x49
+  800f3a:	68 e1 20 80 00       	push   $0x8020e1
+  800f3f:	e8 06 f2 ff ff       	call   80014a <_panic>
+
+00800f44 <sys_env_set_quota>:
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	57                   	push   %edi
+  800f48:	56                   	push   %esi
+  800f49:	53                   	push   %ebx
+  800f4a:	83 ec 0c             	sub    $0xc,%esp
+  800f4d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f54:	78 2b                	js     800f81 <sys_env_set_quota+0x3d>
+  800f56:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f5d:	75 37                	jne    800f96 <sys_env_set_quota+0x52>
+  800f5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f64:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6f:	89 df                	mov    %ebx,%edi
+  800f71:	89 de                	mov    %ebx,%esi
+  800f73:	cd 30                	int    $0x30
+  800f75:	85 c0                	test   %eax,%eax
+  800f77:	7f 41                	jg     800fba <sys_env_set_quota+0x76>
+  800f79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7c:	5b                   	pop    %ebx
+  800f7d:	5e                   	pop    %esi
+  800f7e:	5f                   	pop    %edi
+  800f7f:	5d                   	pop    %ebp
+  800f80:	c3                   	ret
+  800f81:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f86:	0f a2                	cpuid
+  800f88:	c1 ea 0b             	shr    $0xb,%edx
+  800f8b:	83 e2 01             	and    $0x1,%edx
+  800f8e:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800f94:	eb c0                	jmp    800f56 <sys_env_set_quota+0x12>
+  800f96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fa6:	89 df                	mov    %ebx,%edi
+  800fa8:	89 de                	mov    %ebx,%esi
+  800faa:	55                   	push   %ebp
+  800fab:	68 b4 0f 80 00       	push   $0x800fb4
+  800fb0:	89 e5                	mov    %esp,%ebp
+  800fb2:	0f 34                	sysenter
+  800fb4:	83 c4 04             	add    $0x4,%esp
+  800fb7:	5d                   	pop    %ebp
+  800fb8:	eb bb                	jmp    800f75 <sys_env_set_quota+0x31>
+  800fba:	83 ec 0c             	sub    $0xc,%esp
+  800fbd:	50                   	push   %eax
+  800fbe:	6a 0f                	push   $0xf
+  800fc0:	68 c4 20 80 00       	push   $0x8020c4
+  800fc5:	6a 49                	push   $0x49
+  800fc7:	68 e1 20 80 00       	push   $0x8020e1
+  800fcc:	e8 79 f1 ff ff       	call   80014a <_panic>
+
+00800fd1 <sys_page_alloc>:
+  800fd1:	55                   	push   %ebp
+  800fd2:	89 e5                	mov    %esp,%ebp
+  800fd4:	57                   	push   %edi
+  800fd5:	56                   	push   %esi
+  800fd6:	53                   	push   %ebx
+  800fd7:	83 ec 0c             	sub    $0xc,%esp
+  800fda:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800fe1:	78 2c                	js     80100f <sys_page_alloc+0x3e>
+  800fe3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800fea:	75 38                	jne    801024 <sys_page_alloc+0x53>
+  800fec:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ff6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fff:	89 f7                	mov    %esi,%edi
+  801001:	cd 30                	int    $0x30
+  801003:	85 c0                	test   %eax,%eax
+  801005:	7f 42                	jg     801049 <sys_page_alloc+0x78>
+  801007:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100a:	5b                   	pop    %ebx
+  80100b:	5e                   	pop    %esi
+  80100c:	5f                   	pop    %edi
+  80100d:	5d                   	pop    %ebp
+  80100e:	c3                   	ret
+  80100f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801014:	0f a2                	cpuid
+  801016:	c1 ea 0b             	shr    $0xb,%edx
+  801019:	83 e2 01             	and    $0x1,%edx
+  80101c:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801022:	eb bf                	jmp    800fe3 <sys_page_alloc+0x12>
+  801024:	be 00 00 00 00       	mov    $0x0,%esi
+  801029:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801034:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801037:	89 f7                	mov    %esi,%edi
+  801039:	55                   	push   %ebp
+  80103a:	68 43 10 80 00       	push   $0x801043
+  80103f:	89 e5                	mov    %esp,%ebp
+  801041:	0f 34                	sysenter
+  801043:	83 c4 04             	add    $0x4,%esp
+  801046:	5d                   	pop    %ebp
+  801047:	eb ba                	jmp    801003 <sys_page_alloc+0x32>
+  801049:	83 ec 0c             	sub    $0xc,%esp
+  80104c:	50                   	push   %eax
+  80104d:	6a 04                	push   $0x4
+  80104f:	68 c4 20 80 00       	push   $0x8020c4
+  801054:	6a 49                	push   $0x49
+  801056:	68 e1 20 80 00       	push   $0x8020e1
+  80105b:	e8 ea f0 ff ff       	call   80014a <_panic>
+
+00801060 <sys_page_map>:
+  801060:	55                   	push   %ebp
+  801061:	89 e5                	mov    %esp,%ebp
+  801063:	57                   	push   %edi
+  801064:	56                   	push   %esi
+  801065:	53                   	push   %ebx
+  801066:	83 ec 0c             	sub    $0xc,%esp
+  801069:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801070:	78 2b                	js     80109d <sys_page_map+0x3d>
+  801072:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801079:	75 37                	jne    8010b2 <sys_page_map+0x52>
+  80107b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801080:	8b 55 08             	mov    0x8(%ebp),%edx
+  801083:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801086:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801089:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80108c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80108f:	cd 30                	int    $0x30
+  801091:	85 c0                	test   %eax,%eax
+  801093:	7f 41                	jg     8010d6 <sys_page_map+0x76>
+  801095:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801098:	5b                   	pop    %ebx
+  801099:	5e                   	pop    %esi
+  80109a:	5f                   	pop    %edi
+  80109b:	5d                   	pop    %ebp
+  80109c:	c3                   	ret
+  80109d:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010a2:	0f a2                	cpuid
+  8010a4:	c1 ea 0b             	shr    $0xb,%edx
+  8010a7:	83 e2 01             	and    $0x1,%edx
+  8010aa:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8010b0:	eb c0                	jmp    801072 <sys_page_map+0x12>
+  8010b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010c6:	55                   	push   %ebp
+  8010c7:	68 d0 10 80 00       	push   $0x8010d0
+  8010cc:	89 e5                	mov    %esp,%ebp
+  8010ce:	0f 34                	sysenter
+  8010d0:	83 c4 04             	add    $0x4,%esp
+  8010d3:	5d                   	pop    %ebp
+  8010d4:	eb bb                	jmp    801091 <sys_page_map+0x31>
+  8010d6:	83 ec 0c             	sub    $0xc,%esp
+  8010d9:	50                   	push   %eax
+  8010da:	6a 05                	push   $0x5
+  8010dc:	68 c4 20 80 00       	push   $0x8020c4
+  8010e1:	6a 49                	push   $0x49
+  8010e3:	68 e1 20 80 00       	push   $0x8020e1
+  8010e8:	e8 5d f0 ff ff       	call   80014a <_panic>
+
+008010ed <sys_page_unmap>:
+  8010ed:	55                   	push   %ebp
+  8010ee:	89 e5                	mov    %esp,%ebp
+  8010f0:	57                   	push   %edi
+  8010f1:	56                   	push   %esi
+  8010f2:	53                   	push   %ebx
+  8010f3:	83 ec 0c             	sub    $0xc,%esp
+  8010f6:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8010fd:	78 2b                	js     80112a <sys_page_unmap+0x3d>
+  8010ff:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801106:	75 37                	jne    80113f <sys_page_unmap+0x52>
+  801108:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801112:	8b 55 08             	mov    0x8(%ebp),%edx
+  801115:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801118:	89 df                	mov    %ebx,%edi
+  80111a:	89 de                	mov    %ebx,%esi
+  80111c:	cd 30                	int    $0x30
+  80111e:	85 c0                	test   %eax,%eax
+  801120:	7f 41                	jg     801163 <sys_page_unmap+0x76>
+  801122:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801125:	5b                   	pop    %ebx
+  801126:	5e                   	pop    %esi
+  801127:	5f                   	pop    %edi
+  801128:	5d                   	pop    %ebp
+  801129:	c3                   	ret
+  80112a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80112f:	0f a2                	cpuid
+  801131:	c1 ea 0b             	shr    $0xb,%edx
+  801134:	83 e2 01             	and    $0x1,%edx
+  801137:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80113d:	eb c0                	jmp    8010ff <sys_page_unmap+0x12>
+  80113f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801144:	8b 55 08             	mov    0x8(%ebp),%edx
+  801147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80114f:	89 df                	mov    %ebx,%edi
+  801151:	89 de                	mov    %ebx,%esi
+  801153:	55                   	push   %ebp
+  801154:	68 5d 11 80 00       	push   $0x80115d
+  801159:	89 e5                	mov    %esp,%ebp
+  80115b:	0f 34                	sysenter
+  80115d:	83 c4 04             	add    $0x4,%esp
+  801160:	5d                   	pop    %ebp
+  801161:	eb bb                	jmp    80111e <sys_page_unmap+0x31>
+  801163:	83 ec 0c             	sub    $0xc,%esp
+  801166:	50                   	push   %eax
+  801167:	6a 06                	push   $0x6
+  801169:	68 c4 20 80 00       	push   $0x8020c4
+  80116e:	6a 49                	push   $0x49
+  801170:	68 e1 20 80 00       	push   $0x8020e1
+  801175:	e8 d0 ef ff ff       	call   80014a <_panic>
+
+0080117a <sys_page_reuse>:
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	57                   	push   %edi
+  80117e:	56                   	push   %esi
+  80117f:	53                   	push   %ebx
+  801180:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801187:	78 24                	js     8011ad <sys_page_reuse+0x33>
+  801189:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801190:	75 30                	jne    8011c2 <sys_page_reuse+0x48>
+  801192:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801197:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80119c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a2:	89 df                	mov    %ebx,%edi
+  8011a4:	89 de                	mov    %ebx,%esi
+  8011a6:	cd 30                	int    $0x30
+  8011a8:	5b                   	pop    %ebx
+  8011a9:	5e                   	pop    %esi
+  8011aa:	5f                   	pop    %edi
+  8011ab:	5d                   	pop    %ebp
+  8011ac:	c3                   	ret
+  8011ad:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011b2:	0f a2                	cpuid
+  8011b4:	c1 ea 0b             	shr    $0xb,%edx
+  8011b7:	83 e2 01             	and    $0x1,%edx
+  8011ba:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8011c0:	eb c7                	jmp    801189 <sys_page_reuse+0xf>
+  8011c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011cd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011d2:	89 df                	mov    %ebx,%edi
+  8011d4:	89 de                	mov    %ebx,%esi
+  8011d6:	55                   	push   %ebp
+  8011d7:	68 e0 11 80 00       	push   $0x8011e0
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	0f 34                	sysenter
+  8011e0:	83 c4 04             	add    $0x4,%esp
+  8011e3:	5d                   	pop    %ebp
+  8011e4:	eb c2                	jmp    8011a8 <sys_page_reuse+0x2e>
+
+008011e6 <sys_env_set_status>:
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	57                   	push   %edi
+  8011ea:	56                   	push   %esi
+  8011eb:	53                   	push   %ebx
+  8011ec:	83 ec 0c             	sub    $0xc,%esp
+  8011ef:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8011f6:	78 2b                	js     801223 <sys_env_set_status+0x3d>
+  8011f8:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8011ff:	75 37                	jne    801238 <sys_env_set_status+0x52>
+  801201:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801206:	b8 08 00 00 00       	mov    $0x8,%eax
+  80120b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801211:	89 df                	mov    %ebx,%edi
+  801213:	89 de                	mov    %ebx,%esi
+  801215:	cd 30                	int    $0x30
+  801217:	85 c0                	test   %eax,%eax
+  801219:	7f 41                	jg     80125c <sys_env_set_status+0x76>
+  80121b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80121e:	5b                   	pop    %ebx
+  80121f:	5e                   	pop    %esi
+  801220:	5f                   	pop    %edi
+  801221:	5d                   	pop    %ebp
+  801222:	c3                   	ret
+  801223:	b8 01 00 00 00       	mov    $0x1,%eax
+  801228:	0f a2                	cpuid
+  80122a:	c1 ea 0b             	shr    $0xb,%edx
+  80122d:	83 e2 01             	and    $0x1,%edx
+  801230:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801236:	eb c0                	jmp    8011f8 <sys_env_set_status+0x12>
+  801238:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801240:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801243:	b8 08 00 00 00       	mov    $0x8,%eax
+  801248:	89 df                	mov    %ebx,%edi
+  80124a:	89 de                	mov    %ebx,%esi
+  80124c:	55                   	push   %ebp
+  80124d:	68 56 12 80 00       	push   $0x801256
+  801252:	89 e5                	mov    %esp,%ebp
+  801254:	0f 34                	sysenter
+  801256:	83 c4 04             	add    $0x4,%esp
+  801259:	5d                   	pop    %ebp
+  80125a:	eb bb                	jmp    801217 <sys_env_set_status+0x31>
+  80125c:	83 ec 0c             	sub    $0xc,%esp
+  80125f:	50                   	push   %eax
+  801260:	6a 08                	push   $0x8
+  801262:	68 c4 20 80 00       	push   $0x8020c4
+  801267:	6a 49                	push   $0x49
+  801269:	68 e1 20 80 00       	push   $0x8020e1
+  80126e:	e8 d7 ee ff ff       	call   80014a <_panic>
+
+00801273 <sys_env_set_pgfault_upcall>:
+  801273:	55                   	push   %ebp
+  801274:	89 e5                	mov    %esp,%ebp
+  801276:	57                   	push   %edi
+  801277:	56                   	push   %esi
+  801278:	53                   	push   %ebx
+  801279:	83 ec 0c             	sub    $0xc,%esp
+  80127c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801283:	78 2b                	js     8012b0 <sys_env_set_pgfault_upcall+0x3d>
+  801285:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80128c:	75 37                	jne    8012c5 <sys_env_set_pgfault_upcall+0x52>
+  80128e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801293:	b8 09 00 00 00       	mov    $0x9,%eax
+  801298:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129e:	89 df                	mov    %ebx,%edi
+  8012a0:	89 de                	mov    %ebx,%esi
+  8012a2:	cd 30                	int    $0x30
+  8012a4:	85 c0                	test   %eax,%eax
+  8012a6:	7f 41                	jg     8012e9 <sys_env_set_pgfault_upcall+0x76>
+  8012a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ab:	5b                   	pop    %ebx
+  8012ac:	5e                   	pop    %esi
+  8012ad:	5f                   	pop    %edi
+  8012ae:	5d                   	pop    %ebp
+  8012af:	c3                   	ret
+  8012b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012b5:	0f a2                	cpuid
+  8012b7:	c1 ea 0b             	shr    $0xb,%edx
+  8012ba:	83 e2 01             	and    $0x1,%edx
+  8012bd:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8012c3:	eb c0                	jmp    801285 <sys_env_set_pgfault_upcall+0x12>
+  8012c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012d5:	89 df                	mov    %ebx,%edi
+  8012d7:	89 de                	mov    %ebx,%esi
+  8012d9:	55                   	push   %ebp
+  8012da:	68 e3 12 80 00       	push   $0x8012e3
+  8012df:	89 e5                	mov    %esp,%ebp
+  8012e1:	0f 34                	sysenter
+  8012e3:	83 c4 04             	add    $0x4,%esp
+  8012e6:	5d                   	pop    %ebp
+  8012e7:	eb bb                	jmp    8012a4 <sys_env_set_pgfault_upcall+0x31>
+  8012e9:	83 ec 0c             	sub    $0xc,%esp
+  8012ec:	50                   	push   %eax
+  8012ed:	6a 09                	push   $0x9
+  8012ef:	68 c4 20 80 00       	push   $0x8020c4
+  8012f4:	6a 49                	push   $0x49
+  8012f6:	68 e1 20 80 00       	push   $0x8020e1
+  8012fb:	e8 4a ee ff ff       	call   80014a <_panic>
+
+00801300 <sys_env_set_trace>:
+  801300:	55                   	push   %ebp
+  801301:	89 e5                	mov    %esp,%ebp
+  801303:	57                   	push   %edi
+  801304:	56                   	push   %esi
+  801305:	53                   	push   %ebx
+  801306:	83 ec 0c             	sub    $0xc,%esp
+  801309:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801310:	78 2b                	js     80133d <sys_env_set_trace+0x3d>
+  801312:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801319:	75 37                	jne    801352 <sys_env_set_trace+0x52>
+  80131b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801320:	b8 12 00 00 00       	mov    $0x12,%eax
+  801325:	8b 55 08             	mov    0x8(%ebp),%edx
+  801328:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80132b:	89 df                	mov    %ebx,%edi
+  80132d:	89 de                	mov    %ebx,%esi
+  80132f:	cd 30                	int    $0x30
+  801331:	85 c0                	test   %eax,%eax
+  801333:	7f 41                	jg     801376 <sys_env_set_trace+0x76>
+  801335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801338:	5b                   	pop    %ebx
+  801339:	5e                   	pop    %esi
+  80133a:	5f                   	pop    %edi
+  80133b:	5d                   	pop    %ebp
+  80133c:	c3                   	ret
+  80133d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801342:	0f a2                	cpuid
+  801344:	c1 ea 0b             	shr    $0xb,%edx
+  801347:	83 e2 01             	and    $0x1,%edx
+  80134a:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801350:	eb c0                	jmp    801312 <sys_env_set_trace+0x12>
+  801352:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801357:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801362:	89 df                	mov    %ebx,%edi
+  801364:	89 de                	mov    %ebx,%esi
+  801366:	55                   	push   %ebp
+  801367:	68 70 13 80 00       	push   $0x801370
+  80136c:	89 e5                	mov    %esp,%ebp
+  80136e:	0f 34                	sysenter
+  801370:	83 c4 04             	add    $0x4,%esp
+  801373:	5d                   	pop    %ebp
+  801374:	eb bb                	jmp    801331 <sys_env_set_trace+0x31>
+  801376:	83 ec 0c             	sub    $0xc,%esp
+  801379:	50                   	push   %eax
+  80137a:	6a 12                	push   $0x12
+  80137c:	68 c4 20 80 00       	push   $0x8020c4
+  801381:	6a 49                	push   $0x49
+  801383:	68 e1 20 80 00       	push   $0x8020e1
+  801388:	e8 bd ed ff ff       	call   80014a <_panic>
+
+0080138d <sys_env_set_rdpmc>:
+  80138d:	55                   	push   %ebp
+  80138e:	89 e5                	mov    %esp,%ebp
+  801390:	57                   	push   %edi
+  801391:	56                   	push   %esi
+  801392:	53                   	push   %ebx
+  801393:	83 ec 0c             	sub    $0xc,%esp
+  801396:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80139d:	78 2b                	js     8013ca <sys_env_set_rdpmc+0x3d>
+  80139f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013a6:	75 37                	jne    8013df <sys_env_set_rdpmc+0x52>
+  8013a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ad:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b8:	89 df                	mov    %ebx,%edi
+  8013ba:	89 de                	mov    %ebx,%esi
+  8013bc:	cd 30                	int    $0x30
+  8013be:	85 c0                	test   %eax,%eax
+  8013c0:	7f 41                	jg     801403 <sys_env_set_rdpmc+0x76>
+  8013c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c5:	5b                   	pop    %ebx
+  8013c6:	5e                   	pop    %esi
+  8013c7:	5f                   	pop    %edi
+  8013c8:	5d                   	pop    %ebp
+  8013c9:	c3                   	ret
+  8013ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013cf:	0f a2                	cpuid
+  8013d1:	c1 ea 0b             	shr    $0xb,%edx
+  8013d4:	83 e2 01             	and    $0x1,%edx
+  8013d7:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8013dd:	eb c0                	jmp    80139f <sys_env_set_rdpmc+0x12>
+  8013df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ea:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013ef:	89 df                	mov    %ebx,%edi
+  8013f1:	89 de                	mov    %ebx,%esi
+  8013f3:	55                   	push   %ebp
+  8013f4:	68 fd 13 80 00       	push   $0x8013fd
+  8013f9:	89 e5                	mov    %esp,%ebp
+  8013fb:	0f 34                	sysenter
+  8013fd:	83 c4 04             	add    $0x4,%esp
+  801400:	5d                   	pop    %ebp
+  801401:	eb bb                	jmp    8013be <sys_env_set_rdpmc+0x31>
+  801403:	83 ec 0c             	sub    $0xc,%esp
+  801406:	50                   	push   %eax
+  801407:	6a 13                	push   $0x13
+  801409:	68 c4 20 80 00       	push   $0x8020c4
+  80140e:	6a 49                	push   $0x49
+  801410:	68 e1 20 80 00       	push   $0x8020e1
+  801415:	e8 30 ed ff ff       	call   80014a <_panic>
+
+0080141a <sys_ring_setup>:
+  80141a:	55                   	push   %ebp
+  80141b:	89 e5                	mov    %esp,%ebp
+  80141d:	57                   	push   %edi
+  80141e:	56                   	push   %esi
+  80141f:	53                   	push   %ebx
+  801420:	83 ec 0c             	sub    $0xc,%esp
+  801423:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80142a:	78 29                	js     801455 <sys_ring_setup+0x3b>
+  80142c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801433:	75 35                	jne    80146a <sys_ring_setup+0x50>
+  801435:	ba 00 00 00 00       	mov    $0x0,%edx
+  80143a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80143f:	89 d1                	mov    %edx,%ecx
+  801441:	89 d3                	mov    %edx,%ebx
+  801443:	89 d7                	mov    %edx,%edi
+  801445:	89 d6                	mov    %edx,%esi
+  801447:	cd 30                	int    $0x30
+  801449:	85 c0                	test   %eax,%eax
+  80144b:	7f 3f                	jg     80148c <sys_ring_setup+0x72>
+  80144d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801450:	5b                   	pop    %ebx
+  801451:	5e                   	pop    %esi
+  801452:	5f                   	pop    %edi
+  801453:	5d                   	pop    %ebp
+  801454:	c3                   	ret
+  801455:	b8 01 00 00 00       	mov    $0x1,%eax
+  80145a:	0f a2                	cpuid
+  80145c:	c1 ea 0b             	shr    $0xb,%edx
+  80145f:	83 e2 01             	and    $0x1,%edx
+  801462:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801468:	eb c2                	jmp    80142c <sys_ring_setup+0x12>
+  80146a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80146f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801474:	89 d1                	mov    %edx,%ecx
+  801476:	89 d3                	mov    %edx,%ebx
+  801478:	89 d7                	mov    %edx,%edi
+  80147a:	89 d6                	mov    %edx,%esi
+  80147c:	55                   	push   %ebp
+  80147d:	68 86 14 80 00       	push   $0x801486
+  801482:	89 e5                	mov    %esp,%ebp
+  801484:	0f 34                	sysenter
+  801486:	83 c4 04             	add    $0x4,%esp
+  801489:	5d                   	pop    %ebp
+  80148a:	eb bd                	jmp    801449 <sys_ring_setup+0x2f>
+  80148c:	83 ec 0c             	sub    $0xc,%esp
+  80148f:	50                   	push   %eax
+  801490:	6a 10                	push   $0x10
+  801492:	68 c4 20 80 00       	push   $0x8020c4
+  801497:	6a 49                	push   $0x49
+  801499:	68 e1 20 80 00       	push   $0x8020e1
+  80149e:	e8 a7 ec ff ff       	call   80014a <_panic>
+
+008014a3 <sys_ring_enter>:
+  8014a3:	55                   	push   %ebp
+  8014a4:	89 e5                	mov    %esp,%ebp
+  8014a6:	57                   	push   %edi
+  8014a7:	56                   	push   %esi
+  8014a8:	53                   	push   %ebx
+  8014a9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014b0:	78 22                	js     8014d4 <sys_ring_enter+0x31>
+  8014b2:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014b9:	75 2e                	jne    8014e9 <sys_ring_enter+0x46>
+  8014bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c0:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014c5:	89 d1                	mov    %edx,%ecx
+  8014c7:	89 d3                	mov    %edx,%ebx
+  8014c9:	89 d7                	mov    %edx,%edi
+  8014cb:	89 d6                	mov    %edx,%esi
+  8014cd:	cd 30                	int    $0x30
+  8014cf:	5b                   	pop    %ebx
+  8014d0:	5e                   	pop    %esi
+  8014d1:	5f                   	pop    %edi
+  8014d2:	5d                   	pop    %ebp
+  8014d3:	c3                   	ret
+  8014d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014d9:	0f a2                	cpuid
+  8014db:	c1 ea 0b             	shr    $0xb,%edx
+  8014de:	83 e2 01             	and    $0x1,%edx
+  8014e1:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8014e7:	eb c9                	jmp    8014b2 <sys_ring_enter+0xf>
+  8014e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ee:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014f3:	89 d1                	mov    %edx,%ecx
+  8014f5:	89 d3                	mov    %edx,%ebx
+  8014f7:	89 d7                	mov    %edx,%edi
+  8014f9:	89 d6                	mov    %edx,%esi
+  8014fb:	55                   	push   %ebp
+  8014fc:	68 05 15 80 00       	push   $0x801505
+  801501:	89 e5                	mov    %esp,%ebp
+  801503:	0f 34                	sysenter
+  801505:	83 c4 04             	add    $0x4,%esp
+  801508:	5d                   	pop    %ebp
+  801509:	eb c4                	jmp    8014cf <sys_ring_enter+0x2c>
+
+0080150b <sys_ipc_try_send>:
+  80150b:	55                   	push   %ebp
+  80150c:	89 e5                	mov    %esp,%ebp
+  80150e:	57                   	push   %edi
+  80150f:	56                   	push   %esi
+  801510:	53                   	push   %ebx
+  801511:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801518:	78 26                	js     801540 <sys_ipc_try_send+0x35>
+  80151a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801521:	75 32                	jne    801555 <sys_ipc_try_send+0x4a>
+  801523:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801528:	be 00 00 00 00       	mov    $0x0,%esi
+  80152d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801530:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801533:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801536:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801539:	cd 30                	int    $0x30
+  80153b:	5b                   	pop    %ebx
+  80153c:	5e                   	pop    %esi
+  80153d:	5f                   	pop    %edi
+  80153e:	5d                   	pop    %ebp
+  80153f:	c3                   	ret
+  801540:	b8 01 00 00 00       	mov    $0x1,%eax
+  801545:	0f a2                	cpuid
+  801547:	c1 ea 0b             	shr    $0xb,%edx
+  80154a:	83 e2 01             	and    $0x1,%edx
+  80154d:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801553:	eb c5                	jmp    80151a <sys_ipc_try_send+0xf>
+  801555:	8b 55 08             	mov    0x8(%ebp),%edx
+  801558:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801560:	be 00 00 00 00       	mov    $0x0,%esi
+  801565:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801568:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80156b:	55                   	push   %ebp
+  80156c:	68 75 15 80 00       	push   $0x801575
+  801571:	89 e5                	mov    %esp,%ebp
+  801573:	0f 34                	sysenter
+  801575:	83 c4 04             	add    $0x4,%esp
+  801578:	5d                   	pop    %ebp
+  801579:	eb c0                	jmp    80153b <sys_ipc_try_send+0x30>
+
+0080157b <sys_ipc_recv>:
+  80157b:	55                   	push   %ebp
+  80157c:	89 e5                	mov    %esp,%ebp
+  80157e:	57                   	push   %edi
+  80157f:	56                   	push   %esi
+  801580:	53                   	push   %ebx
+  801581:	83 ec 0c             	sub    $0xc,%esp
+  801584:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80158b:	78 2a                	js     8015b7 <sys_ipc_recv+0x3c>
+  80158d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801594:	75 36                	jne    8015cc <sys_ipc_recv+0x51>
+  801596:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80159b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8015a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a3:	89 cb                	mov    %ecx,%ebx
+  8015a5:	89 cf                	mov    %ecx,%edi
+  8015a7:	89 ce                	mov    %ecx,%esi
+  8015a9:	cd 30                	int    $0x30
+  8015ab:	85 c0                	test   %eax,%eax
+  8015ad:	7f 40                	jg     8015ef <sys_ipc_recv+0x74>
+  8015af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b2:	5b                   	pop    %ebx
+  8015b3:	5e                   	pop    %esi
+  8015b4:	5f                   	pop    %edi
+  8015b5:	5d                   	pop    %ebp
+  8015b6:	c3                   	ret
+  8015b7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015bc:	0f a2                	cpuid
+  8015be:	c1 ea 0b             	shr    $0xb,%edx
+  8015c1:	83 e2 01             	and    $0x1,%edx
+  8015c4:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8015ca:	eb c1                	jmp    80158d <sys_ipc_recv+0x12>
+  8015cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8015d9:	89 cb                	mov    %ecx,%ebx
+  8015db:	89 cf                	mov    %ecx,%edi
+  8015dd:	89 ce                	mov    %ecx,%esi
+  8015df:	55                   	push   %ebp
+  8015e0:	68 e9 15 80 00       	push   $0x8015e9
+  8015e5:	89 e5                	mov    %esp,%ebp
+  8015e7:	0f 34                	sysenter
+  8015e9:	83 c4 04             	add    $0x4,%esp
+  8015ec:	5d                   	pop    %ebp
+  8015ed:	eb bc                	jmp    8015ab <sys_ipc_recv+0x30>
+  8015ef:	83 ec 0c             	sub    $0xc,%esp
+  8015f2:	50                   	push   %eax
+  8015f3:	6a 0c                	push   $0xc
+  8015f5:	68 c4 20 80 00       	push   $0x8020c4
+  8015fa:	6a 49                	push   $0x49
+  8015fc:	68 e1 20 80 00       	push   $0x8020e1
+  801601:	e8 44 eb ff ff       	call   80014a <_panic>
+
+00801606 <duppage>:
+  801606:	55                   	push   %ebp
+  801607:	89 e5                	mov    %esp,%ebp
+  801609:	53                   	push   %ebx
+  80160a:	83 ec 04             	sub    $0x4,%esp
+  80160d:	89 d3                	mov    %edx,%ebx
+  80160f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801616:	f6 c2 02             	test   $0x2,%dl
+  801619:	75 0c                	jne    801627 <duppage+0x21>
+  80161b:	8b 14 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%edx
+  801622:	f6 c6 08             	test   $0x8,%dh
+  801625:	74 64                	je     80168b <duppage+0x85>
+  801627:	c1 e3 0c             	shl    $0xc,%ebx
+  80162a:	83 ec 0c             	sub    $0xc,%esp
+  80162d:	68 05 08 00 00       	push   $0x805
+  801632:	53                   	push   %ebx
+  801633:	50                   	push   %eax
+  801634:	53                   	push   %ebx
+  801635:	6a 00                	push   $0x0
+  801637:	e8 24 fa ff ff       	call   801060 <sys_page_map>
+  80163c:	83 c4 20             	add    $0x20,%esp
+  80163f:	85 c0                	test   %eax,%eax
+  801641:	78 24                	js     801667 <duppage+0x61>
+  801643:	83 ec 0c             	sub    $0xc,%esp
+  801646:	68 05 08 00 00       	push   $0x805
+  80164b:	53                   	push   %ebx
+  80164c:	6a 00                	push   $0x0
+  80164e:	53                   	push   %ebx
+  80164f:	6a 00                	push   $0x0
+  801651:	e8 0a fa ff ff       	call   801060 <sys_page_map>
+  801656:	83 c4 20             	add    $0x20,%esp
+  801659:	85 c0                	test   %eax,%eax
+  80165b:	78 1c                	js     801679 <duppage+0x73>
+  80165d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801662:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801665:	c9                   	leave
+  801666:	c3                   	ret
+  801667:	50                   	push   %eax
+  801668:	68 ef 20 80 00       	push   $0x8020ef
+  80166d:	6a 52                	push   $0x52
+  80166f:	68 00 21 80 00       	push   $0x802100
+  801674:	e8 d1 ea ff ff       	call   80014a <_panic>
+  801679:	50                   	push   %eax
+  80167a:	68 ef 20 80 00       	push   $0x8020ef
+  80167f:	6a 55                	push   $0x55
+  801681:	68 00 21 80 00       	push   $0x802100
+  801686:	e8 bf ea ff ff       	call   80014a <_panic>
+  80168b:	c1 e3 0c             	shl    $0xc,%ebx
+  80168e:	83 ec 0c             	sub    $0xc,%esp
+  801691:	6a 05                	push   $0x5
+  801693:	53                   	push   %ebx
+  801694:	50                   	push   %eax
+  801695:	53                   	push   %ebx
+  801696:	6a 00                	push   $0x0
+  801698:	e8 c3 f9 ff ff       	call   801060 <sys_page_map>
+  80169d:	83 c4 20             	add    $0x20,%esp
+  8016a0:	85 c0                	test   %eax,%eax
+  8016a2:	79 b9                	jns    80165d <duppage+0x57>
+  8016a4:	50                   	push   %eax
+  8016a5:	68 ef 20 80 00       	push   $0x8020ef
+  8016aa:	6a 59                	push   $0x59
+  8016ac:	68 00 21 80 00       	push   $0x802100
+  8016b1:	e8 94 ea ff ff       	call   80014a <_panic>
+
+008016b6 <pgfault>:
+  8016b6:	55                   	push   %ebp
+  8016b7:	89 e5                	mov    %esp,%ebp
+  8016b9:	53                   	push   %ebx
+  8016ba:	83 ec 04             	sub    $0x4,%esp
+  8016bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016c0:	8b 18                	mov    (%eax),%ebx
+  8016c2:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8016c6:	0f 84 90 00 00 00    	je     80175c <pgfault+0xa6>
+  8016cc:	89 d8                	mov    %ebx,%eax
+  8016ce:	c1 e8 0c             	shr    $0xc,%eax
+  8016d1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016d8:	f7 c2 01 08 00 00    	test   $0x801,%edx
+  8016de:	74 7c                	je     80175c <pgfault+0xa6>
+  8016e0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016e7:	c1 e8 0c             	shr    $0xc,%eax
+  8016ea:	0f b7 04 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%eax
+  8016f1:	ef 
+  8016f2:	66 83 f8 01          	cmp    $0x1,%ax
+  8016f6:	74 78                	je     801770 <pgfault+0xba>
+  8016f8:	83 ec 04             	sub    $0x4,%esp
+  8016fb:	6a 07                	push   $0x7
+  8016fd:	68 00 f0 7f 00       	push   $0x7ff000
+  801702:	6a 00                	push   $0x0
+  801704:	e8 c8 f8 ff ff       	call   800fd1 <sys_page_alloc>
+  801709:	83 c4 10             	add    $0x10,%esp
+  80170c:	85 c0                	test   %eax,%eax
+  80170e:	78 7f                	js     80178f <pgfault+0xd9>
+  801710:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  801716:	83 ec 08             	sub    $0x8,%esp
+  801719:	53                   	push   %ebx
+  80171a:	68 00 f0 7f 00       	push   $0x7ff000
+  80171f:	e8 86 f3 ff ff       	call   800aaa <page_copy>
+  801724:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80172b:	53                   	push   %ebx
+  80172c:	6a 00                	push   $0x0
+  80172e:	68 00 f0 7f 00       	push   $0x7ff000
+  801733:	6a 00                	push   $0x0
+  801735:	e8 26 f9 ff ff       	call   801060 <sys_page_map>
+  80173a:	83 c4 20             	add    $0x20,%esp
+  80173d:	85 c0                	test   %eax,%eax
+  80173f:	78 60                	js     8017a1 <pgfault+0xeb>
+  801741:	83 ec 08             	sub    $0x8,%esp
+  801744:	68 00 f0 7f 00       	push   $0x7ff000
+  801749:	6a 00                	push   $0x0
+  80174b:	e8 9d f9 ff ff       	call   8010ed <sys_page_unmap>
+  801750:	83 c4 10             	add    $0x10,%esp
+  801753:	85 c0                	test   %eax,%eax
+  801755:	78 5c                	js     8017b3 <pgfault+0xfd>
+  801757:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80175a:	c9                   	leave
+  80175b:	c3                   	ret
+  80175c:	83 ec 04             	sub    $0x4,%esp
+  80175f:	68 0b 21 80 00       	push   $0x80210b
+  801764:	6a 1c                	push   $0x1c
+  801766:	68 00 21 80 00       	push   $0x802100
+  80176b:	e8 da e9 ff ff       	call   80014a <_panic>
+  801770:	83 ec 08             	sub    $0x8,%esp
+  801773:	89 d8                	mov    %ebx,%eax
+  801775:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80177a:	50                   	push   %eax
+  80177b:	6a 00                	push   $0x0
+  80177d:	e8 f8 f9 ff ff       	call   80117a <sys_page_reuse>
+  801782:	83 c4 10             	add    $0x10,%esp
+  801785:	85 c0                	test   %eax,%eax
+  801787:	0f 85 6b ff ff ff    	jne    8016f8 <pgfault+0x42>
+  80178d:	eb c8                	jmp    801757 <pgfault+0xa1>
+  80178f:	50                   	push   %eax
+  801790:	68 28 21 80 00       	push   $0x802128
+  801795:	6a 31                	push   $0x31
+  801797:	68 00 21 80 00       	push   $0x802100
+  80179c:	e8 a9 e9 ff ff       	call   80014a <_panic>
+  8017a1:	50                   	push   %eax
+  8017a2:	68 ef 20 80 00       	push   $0x8020ef
+  8017a7:	6a 36                	push   $0x36
+  8017a9:	68 00 21 80 00       	push   $0x802100
+  8017ae:	e8 97 e9 ff ff       	call   80014a <_panic>
+  8017b3:	50                   	push   %eax
+  8017b4:	68 3b 21 80 00       	push   $0x80213b
+  8017b9:	6a 38                	push   $0x38
+  8017bb:	68 00 21 80 00       	push   $0x802100
+  8017c0:	e8 85 e9 ff ff       	call   80014a <_panic>
+
+008017c5 <fork>:
+  8017c5:	55                   	push   %ebp
+  8017c6:	89 e5                	mov    %esp,%ebp
+  8017c8:	53                   	push   %ebx
+  8017c9:	83 ec 20             	sub    $0x20,%esp
+  8017cc:	68 b6 16 80 00       	push   $0x8016b6
+  8017d1:	e8 04 03 00 00       	call   801ada <set_pgfault_handler>
+  8017d6:	83 c4 08             	add    $0x8,%esp
+  8017d9:	6a 01                	push   $0x1
+  8017db:	6a 00                	push   $0x0
+  8017dd:	e8 d5 f6 ff ff       	call   800eb7 <sys_env_set_cow>
+  8017e2:	83 c4 10             	add    $0x10,%esp
+  8017e5:	85 c0                	test   %eax,%eax
+  8017e7:	78 38                	js     801821 <fork+0x5c>
+  8017e9:	e8 f5 01 00 00       	call   8019e3 <bflush>
+  8017ee:	b8 07 00 00 00       	mov    $0x7,%eax
+  8017f3:	cd 30                	int    $0x30
+  8017f5:	89 c3                	mov    %eax,%ebx
+  8017f7:	85 c0                	test   %eax,%eax
+  8017f9:	78 38                	js     801833 <fork+0x6e>
+  8017fb:	ba 00 00 80 00       	mov    $0x800000,%edx
+  801800:	75 4f                	jne    801851 <fork+0x8c>
+  801802:	e8 43 01 00 00       	call   80194a <uinfo_envid>
+  801807:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80180c:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  801812:	05 00 00 00 ed       	add    $0xed000000,%eax
+  801817:	a3 24 30 80 00       	mov    %eax,0x803024
+  80181c:	e9 c9 00 00 00       	jmp    8018ea <fork+0x125>
+  801821:	50                   	push   %eax
+  801822:	68 4e 21 80 00       	push   $0x80214e
+  801827:	6a 7c                	push   $0x7c
+  801829:	68 00 21 80 00       	push   $0x802100
+  80182e:	e8 17 e9 ff ff       	call   80014a <_panic>
+  801833:	50                   	push   %eax
+  801834:	68 62 21 80 00       	push   $0x802162
+  801839:	68 88 00 00 00       	push   $0x88
+  80183e:	68 00 21 80 00       	push   $0x802100
+  801843:	e8 02 e9 ff ff       	call   80014a <_panic>
+  801848:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80184b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801851:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  801854:	81 fa ff ff ff ea    	cmp    $0xeaffffff,%edx
+  80185a:	77 34                	ja     801890 <fork+0xcb>
+  80185c:	81 fa 00 f0 ff ea    	cmp    $0xeafff000,%edx
+  801862:	74 e4                	je     801848 <fork+0x83>
+  801864:	89 d0                	mov    %edx,%eax
+  801866:	c1 e8 16             	shr    $0x16,%eax
+  801869:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801870:	a8 01                	test   $0x1,%al
+  801872:	74 d4                	je     801848 <fork+0x83>
+  801874:	89 d0                	mov    %edx,%eax
+  801876:	c1 e8 0c             	shr    $0xc,%eax
+  801879:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801880:	a8 01                	test   $0x1,%al
+  801882:	74 c4                	je     801848 <fork+0x83>
+  801884:	c1 ea 0c             	shr    $0xc,%edx
+  801887:	89 d8                	mov    %ebx,%eax
+  801889:	e8 78 fd ff ff       	call   801606 <duppage>
+  80188e:	eb b8                	jmp    801848 <fork+0x83>
+  801890:	83 ec 04             	sub    $0x4,%esp
+  801893:	6a 07                	push   $0x7
+  801895:	68 00 f0 ff ea       	push   $0xeafff000
+  80189a:	53                   	push   %ebx
+  80189b:	e8 31 f7 ff ff       	call   800fd1 <sys_page_alloc>
+  8018a0:	83 c4 10             	add    $0x10,%esp
+  8018a3:	85 c0                	test   %eax,%eax
+  8018a5:	78 4a                	js     8018f1 <fork+0x12c>
+  8018a7:	a1 24 30 80 00       	mov    0x803024,%eax
+  8018ac:	8b 40 58             	mov    0x58(%eax),%eax
+  8018af:	83 ec 08             	sub    $0x8,%esp
+  8018b2:	50                   	push   %eax
+  8018b3:	53                   	push   %ebx
+  8018b4:	e8 ba f9 ff ff       	call   801273 <sys_env_set_pgfault_upcall>
+  8018b9:	83 c4 08             	add    $0x8,%esp
+  8018bc:	6a 01                	push   $0x1
+  8018be:	53                   	push   %ebx
+  8018bf:	e8 f3 f5 ff ff       	call   800eb7 <sys_env_set_cow>
+  8018c4:	83 c4 10             	add    $0x10,%esp
+  8018c7:	85 c0                	test   %eax,%eax
+  8018c9:	78 3b                	js     801906 <fork+0x141>
+  8018cb:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8018ce:	c1 ea 0c             	shr    $0xc,%edx
+  8018d1:	89 d8                	mov    %ebx,%eax
+  8018d3:	e8 2e fd ff ff       	call   801606 <duppage>
+  8018d8:	83 ec 08             	sub    $0x8,%esp
+  8018db:	6a 02                	push   $0x2
+  8018dd:	53                   	push   %ebx
+  8018de:	e8 03 f9 ff ff       	call   8011e6 <sys_env_set_status>
+  8018e3:	83 c4 10             	add    $0x10,%esp
+  8018e6:	85 c0                	test   %eax,%eax
+  8018e8:	78 31                	js     80191b <fork+0x156>
+  8018ea:	89 d8                	mov    %ebx,%eax
+  8018ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ef:	c9                   	leave
+  8018f0:	c3                   	ret
+  8018f1:	50                   	push   %eax
+  8018f2:	68 28 21 80 00       	push   $0x802128
+  8018f7:	68 a1 00 00 00       	push   $0xa1
+  8018fc:	68 00 21 80 00       	push   $0x802100
+  801901:	e8 44 e8 ff ff       	call   80014a <_panic>
+  801906:	50                   	push   %eax
+  801907:	68 4e 21 80 00       	push   $0x80214e
+  80190c:	68 a6 00 00 00       	push   $0xa6
+  801911:	68 00 21 80 00       	push   $0x802100
+  801916:	e8 2f e8 ff ff       	call   80014a <_panic>
+  80191b:	50                   	push   %eax
+  80191c:	68 72 21 80 00       	push   $0x802172
+  801921:	68 ad 00 00 00       	push   $0xad
+  801926:	68 00 21 80 00       	push   $0x802100
+  80192b:	e8 1a e8 ff ff       	call   80014a <_panic>
+
+00801930 <sfork>:
+  801930:	55                   	push   %ebp
+  801931:	89 e5                	mov    %esp,%ebp
+  801933:	83 ec 0c             	sub    $0xc,%esp
+  801936:	68 89 21 80 00       	push   $0x802189
+  80193b:	68 b6 00 00 00       	push   $0xb6
+  801940:	68 00 21 80 00       	push   $0x802100
+  801945:	e8 00 e8 ff ff       	call   80014a <_panic>
+
+0080194a <uinfo_envid>:
+  80194a:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  80194f:	c3                   	ret
+
+00801950 <uinfo_cpunum>:
+  801950:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  801955:	c3                   	ret
+
+00801956 <uinfo_ticks>:
+  801956:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  80195b:	c3                   	ret
+
+0080195c <uinfo_nsec>:
+  80195c:	55                   	push   %ebp
+  80195d:	89 e5                	mov    %esp,%ebp
+  80195f:	57                   	push   %edi
+  801960:	56                   	push   %esi
+  801961:	53                   	push   %ebx
+  801962:	83 ec 1c             	sub    $0x1c,%esp
+  801965:	0f 31                	rdtsc
+  801967:	89 c6                	mov    %eax,%esi
+  801969:	89 d7                	mov    %edx,%edi
+  80196b:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801971:	b8 00 00 00 00       	mov    $0x0,%eax
+  801976:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197b:	85 c9                	test   %ecx,%ecx
+  80197d:	74 5c                	je     8019db <uinfo_nsec+0x7f>
+  80197f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801984:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801987:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80198a:	52                   	push   %edx
+  80198b:	51                   	push   %ecx
+  80198c:	57                   	push   %edi
+  80198d:	56                   	push   %esi
+  80198e:	e8 b4 02 00 00       	call   801c47 <__umoddi3>
+  801993:	83 c4 10             	add    $0x10,%esp
+  801996:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  80199c:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  8019a1:	f7 e3                	mul    %ebx
+  8019a3:	01 ca                	add    %ecx,%edx
+  8019a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8019a8:	ff 75 e0             	push   -0x20(%ebp)
+  8019ab:	52                   	push   %edx
+  8019ac:	50                   	push   %eax
+  8019ad:	e8 bd 01 00 00       	call   801b6f <__udivdi3>
+  8019b2:	83 c4 10             	add    $0x10,%esp
+  8019b5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019b8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8019bb:	ff 75 e4             	push   -0x1c(%ebp)
+  8019be:	ff 75 e0             	push   -0x20(%ebp)
+  8019c1:	57                   	push   %edi
+  8019c2:	56                   	push   %esi
+  8019c3:	e8 a7 01 00 00       	call   801b6f <__udivdi3>
+  8019c8:	83 c4 10             	add    $0x10,%esp
+  8019cb:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  8019d1:	f7 e3                	mul    %ebx
+  8019d3:	01 ca                	add    %ecx,%edx
+  8019d5:	03 45 d8             	add    -0x28(%ebp),%eax
+  8019d8:	13 55 dc             	adc    -0x24(%ebp),%edx
+  8019db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019de:	5b                   	pop    %ebx
+  8019df:	5e                   	pop    %esi
+  8019e0:	5f                   	pop    %edi
+  8019e1:	5d                   	pop    %ebp
+  8019e2:	c3                   	ret
+
+008019e3 <bflush>:
+  8019e3:	a1 40 30 80 00       	mov    0x803040,%eax
+  8019e8:	85 c0                	test   %eax,%eax
+  8019ea:	75 01                	jne    8019ed <bflush+0xa>
+  8019ec:	c3                   	ret
+  8019ed:	55                   	push   %ebp
+  8019ee:	89 e5                	mov    %esp,%ebp
+  8019f0:	83 ec 10             	sub    $0x10,%esp
+  8019f3:	50                   	push   %eax
+  8019f4:	68 44 30 80 00       	push   $0x803044
+  8019f9:	e8 90 f2 ff ff       	call   800c8e <sys_cputs>
+  8019fe:	c7 05 40 30 80 00 00 	movl   $0x0,0x803040
+  801a05:	00 00 00 
+  801a08:	83 c4 10             	add    $0x10,%esp
+  801a0b:	c9                   	leave
+  801a0c:	c3                   	ret
+
+00801a0d <bputch>:
+  801a0d:	55                   	push   %ebp
+  801a0e:	89 e5                	mov    %esp,%ebp
+  801a10:	53                   	push   %ebx
+  801a11:	83 ec 04             	sub    $0x4,%esp
+  801a14:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a17:	8b 15 40 30 80 00    	mov    0x803040,%edx
+  801a1d:	8d 42 01             	lea    0x1(%edx),%eax
+  801a20:	a3 40 30 80 00       	mov    %eax,0x803040
+  801a25:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801a28:	88 8a 44 30 80 00    	mov    %cl,0x803044(%edx)
+  801a2e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a33:	77 08                	ja     801a3d <bputch+0x30>
+  801a35:	83 03 01             	addl   $0x1,(%ebx)
+  801a38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a3b:	c9                   	leave
+  801a3c:	c3                   	ret
+  801a3d:	e8 a1 ff ff ff       	call   8019e3 <bflush>
+  801a42:	eb f1                	jmp    801a35 <bputch+0x28>
+
+00801a44 <vbprintf>:
+  801a44:	55                   	push   %ebp
+  801a45:	89 e5                	mov    %esp,%ebp
+  801a47:	83 ec 18             	sub    $0x18,%esp
+  801a4a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801a51:	ff 75 0c             	push   0xc(%ebp)
+  801a54:	ff 75 08             	push   0x8(%ebp)
+  801a57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a5a:	50                   	push   %eax
+  801a5b:	68 0d 1a 80 00       	push   $0x801a0d
+  801a60:	e8 bc e8 ff ff       	call   800321 <vprintfmt>
+  801a65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a68:	c9                   	leave
+  801a69:	c3                   	ret
+
+00801a6a <bprintf>:
+  801a6a:	55                   	push   %ebp
+  801a6b:	89 e5                	mov    %esp,%ebp
+  801a6d:	83 ec 10             	sub    $0x10,%esp
+  801a70:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801a73:	50                   	push   %eax
+  801a74:	ff 75 08             	push   0x8(%ebp)
+  801a77:	e8 c8 ff ff ff       	call   801a44 <vbprintf>
+  801a7c:	c9                   	leave
+  801a7d:	c3                   	ret
+
+00801a7e <bwrite>:
+  801a7e:	55                   	push   %ebp
+  801a7f:	89 e5                	mov    %esp,%ebp
+  801a81:	53                   	push   %ebx
+  801a82:	83 ec 04             	sub    $0x4,%esp
+  801a85:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a88:	89 d8                	mov    %ebx,%eax
+  801a8a:	03 05 40 30 80 00    	add    0x803040,%eax
+  801a90:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a95:	76 0d                	jbe    801aa4 <bwrite+0x26>
+  801a97:	e8 47 ff ff ff       	call   8019e3 <bflush>
+  801a9c:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801aa2:	77 25                	ja     801ac9 <bwrite+0x4b>
+  801aa4:	83 ec 04             	sub    $0x4,%esp
+  801aa7:	53                   	push   %ebx
+  801aa8:	ff 75 08             	push   0x8(%ebp)
+  801aab:	a1 40 30 80 00       	mov    0x803040,%eax
+  801ab0:	05 44 30 80 00       	add    $0x803044,%eax
+  801ab5:	50                   	push   %eax
+  801ab6:	e8 d1 ef ff ff       	call   800a8c <memcpy>
+  801abb:	01 1d 40 30 80 00    	add    %ebx,0x803040
+  801ac1:	83 c4 10             	add    $0x10,%esp
+  801ac4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ac7:	c9                   	leave
+  801ac8:	c3                   	ret
+  801ac9:	83 ec 08             	sub    $0x8,%esp
+  801acc:	53                   	push   %ebx
+  801acd:	ff 75 08             	push   0x8(%ebp)
+  801ad0:	e8 b9 f1 ff ff       	call   800c8e <sys_cputs>
+  801ad5:	83 c4 10             	add    $0x10,%esp
+  801ad8:	eb ea                	jmp    801ac4 <bwrite+0x46>
+
+00801ada <set_pgfault_handler>:
+  801ada:	55                   	push   %ebp
+  801adb:	89 e5                	mov    %esp,%ebp
+  801add:	83 ec 08             	sub    $0x8,%esp
+  801ae0:	83 3d 44 34 80 00 00 	cmpl   $0x0,0x803444
+  801ae7:	74 0a                	je     801af3 <set_pgfault_handler+0x19>
+  801ae9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aec:	a3 44 34 80 00       	mov    %eax,0x803444
+  801af1:	c9                   	leave
+  801af2:	c3                   	ret
+  801af3:	83 ec 04             	sub    $0x4,%esp
+  801af6:	6a 07                	push   $0x7
+  801af8:	68 00 f0 ff ea       	push   $0xeafff000
+  801afd:	6a 00                	push   $0x0
+  801aff:	e8 cd f4 ff ff       	call   800fd1 <sys_page_alloc>
+  801b04:	83 c4 10             	add    $0x10,%esp
+  801b07:	85 c0                	test   %eax,%eax
+  801b09:	75 2a                	jne    801b35 <set_pgfault_handler+0x5b>
+  801b0b:	83 ec 08             	sub    $0x8,%esp
+  801b0e:	68 49 1b 80 00       	push   $0x801b49
+  801b13:	6a 00                	push   $0x0
+  801b15:	e8 59 f7 ff ff       	call   801273 <sys_env_set_pgfault_upcall>
+  801b1a:	83 c4 10             	add    $0x10,%esp
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	74 c8                	je     801ae9 <set_pgfault_handler+0xf>
+  801b21:	83 ec 04             	sub    $0x4,%esp
+  801b24:	68 c4 21 80 00       	push   $0x8021c4
+  801b29:	6a 28                	push   $0x28
+  801b2b:	68 b5 21 80 00       	push   $0x8021b5
+  801b30:	e8 15 e6 ff ff       	call   80014a <_panic>
+  801b35:	83 ec 04             	sub    $0x4,%esp
+  801b38:	68 9f 21 80 00       	push   $0x80219f
+  801b3d:	6a 22                	push   $0x22
+  801b3f:	68 b5 21 80 00       	push   $0x8021b5
+  801b44:	e8 01 e6 ff ff       	call   80014a <_panic>
+
+00801b49 <_pgfault_upcall>:
+  801b49:	54                   	push   %esp
+  801b4a:	a1 44 34 80 00       	mov    0x803444,%eax
+  801b4f:	ff d0                	call   *%eax
+  801b51:	83 c4 04             	add    $0x4,%esp
+  801b54:	8b 44 24 28          	mov    0x28(%esp),%eax
+  801b58:	89 e5                	mov    %esp,%ebp
+  801b5a:	8b 64 24 30          	mov    0x30(%esp),%esp
+  801b5e:	50                   	push   %eax
+  801b5f:	89 ec                	mov    %ebp,%esp
+  801b61:	83 c4 08             	add    $0x8,%esp
+  801b64:	61                   	popa
+  801b65:	83 c4 04             	add    $0x4,%esp
+  801b68:	9d                   	popf
+  801b69:	5c                   	pop    %esp
+  801b6a:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+  801b6e:	c3                   	ret
+
+00801b6f <__udivdi3>:
+  801b6f:	57                   	push   %edi
+  801b70:	56                   	push   %esi
+  801b71:	53                   	push   %ebx
+  801b72:	83 ec 20             	sub    $0x20,%esp
+  801b75:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801b79:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801b7d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801b81:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801b85:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801b89:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801b8d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801b91:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801b95:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801b99:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801b9d:	89 d1                	mov    %edx,%ecx
+  801b9f:	09 c1                	or     %eax,%ecx
+  801ba1:	0f 84 91 00 00 00    	je     801c38 <__udivdi3+0xc9>
+  801ba7:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801bae:	00 
+  801baf:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801bb6:	00 
+  801bb7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc6:	eb 08                	jmp    801bd0 <__udivdi3+0x61>
+  801bc8:	83 e9 01             	sub    $0x1,%ecx
+  801bcb:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801bce:	74 68                	je     801c38 <__udivdi3+0xc9>
+  801bd0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801bd4:	01 c0                	add    %eax,%eax
+  801bd6:	89 c6                	mov    %eax,%esi
+  801bd8:	89 d7                	mov    %edx,%edi
+  801bda:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801bde:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801be2:	0f ad d0             	shrd   %cl,%edx,%eax
+  801be5:	d3 ea                	shr    %cl,%edx
+  801be7:	f6 c1 20             	test   $0x20,%cl
+  801bea:	74 04                	je     801bf0 <__udivdi3+0x81>
+  801bec:	89 d0                	mov    %edx,%eax
+  801bee:	31 d2                	xor    %edx,%edx
+  801bf0:	83 e0 01             	and    $0x1,%eax
+  801bf3:	89 04 24             	mov    %eax,(%esp)
+  801bf6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801bfd:	00 
+  801bfe:	8b 04 24             	mov    (%esp),%eax
+  801c01:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801c05:	09 f0                	or     %esi,%eax
+  801c07:	09 fa                	or     %edi,%edx
+  801c09:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801c0d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801c11:	39 f0                	cmp    %esi,%eax
+  801c13:	89 d3                	mov    %edx,%ebx
+  801c15:	19 fb                	sbb    %edi,%ebx
+  801c17:	72 af                	jb     801bc8 <__udivdi3+0x59>
+  801c19:	29 f0                	sub    %esi,%eax
+  801c1b:	19 fa                	sbb    %edi,%edx
+  801c1d:	89 cf                	mov    %ecx,%edi
+  801c1f:	c1 ef 05             	shr    $0x5,%edi
+  801c22:	83 e7 01             	and    $0x1,%edi
+  801c25:	89 fe                	mov    %edi,%esi
+  801c27:	83 f6 01             	xor    $0x1,%esi
+  801c2a:	d3 e6                	shl    %cl,%esi
+  801c2c:	d3 e7                	shl    %cl,%edi
+  801c2e:	09 74 24 18          	or     %esi,0x18(%esp)
+  801c32:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  801c36:	eb 90                	jmp    801bc8 <__udivdi3+0x59>
+  801c38:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801c3c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  801c40:	83 c4 20             	add    $0x20,%esp
+  801c43:	5b                   	pop    %ebx
+  801c44:	5e                   	pop    %esi
+  801c45:	5f                   	pop    %edi
+  801c46:	c3                   	ret
+
+00801c47 <__umoddi3>:
+  801c47:	55                   	push   %ebp
+  801c48:	57                   	push   %edi
+  801c49:	56                   	push   %esi
+  801c4a:	53                   	push   %ebx
+  801c4b:	83 ec 1c             	sub    $0x1c,%esp
+  801c4e:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801c52:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801c56:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801c5a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801c5e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801c62:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801c66:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801c6a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801c6e:	89 d6                	mov    %edx,%esi
+  801c70:	09 c6                	or     %eax,%esi
+  801c72:	74 6c                	je     801ce0 <__umoddi3+0x99>
+  801c74:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c83:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801c87:	eb 0e                	jmp    801c97 <__umoddi3+0x50>
+  801c89:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801c8e:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801c92:	83 fe ff             	cmp    $0xffffffff,%esi
+  801c95:	74 49                	je     801ce0 <__umoddi3+0x99>
+  801c97:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801c9b:	01 c0                	add    %eax,%eax
+  801c9d:	89 c3                	mov    %eax,%ebx
+  801c9f:	89 d6                	mov    %edx,%esi
+  801ca1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801ca5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801ca9:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801cae:	0f ad d0             	shrd   %cl,%edx,%eax
+  801cb1:	d3 ea                	shr    %cl,%edx
+  801cb3:	f6 c1 20             	test   $0x20,%cl
+  801cb6:	74 04                	je     801cbc <__umoddi3+0x75>
+  801cb8:	89 d0                	mov    %edx,%eax
+  801cba:	31 d2                	xor    %edx,%edx
+  801cbc:	83 e0 01             	and    $0x1,%eax
+  801cbf:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801cc4:	89 ea                	mov    %ebp,%edx
+  801cc6:	09 d8                	or     %ebx,%eax
+  801cc8:	09 f2                	or     %esi,%edx
+  801cca:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801cce:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801cd2:	39 d8                	cmp    %ebx,%eax
+  801cd4:	89 d1                	mov    %edx,%ecx
+  801cd6:	19 f1                	sbb    %esi,%ecx
+  801cd8:	72 af                	jb     801c89 <__umoddi3+0x42>
+  801cda:	29 d8                	sub    %ebx,%eax
+  801cdc:	19 f2                	sbb    %esi,%edx
+  801cde:	eb a9                	jmp    801c89 <__umoddi3+0x42>
+  801ce0:	83 c4 1c             	add    $0x1c,%esp
+  801ce3:	5b                   	pop    %ebx
+  801ce4:	5e                   	pop    %esi
+  801ce5:	5f                   	pop    %edi
+  801ce6:	5d                   	pop    %ebp
+  801ce7:	c3                   	ret
+
+00801ce8 <__divdi3>:
+  801ce8:	53                   	push   %ebx
+  801ce9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801ced:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801cf1:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801cf5:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801cf9:	85 d2                	test   %edx,%edx
+  801cfb:	78 12                	js     801d0f <__divdi3+0x27>
+  801cfd:	85 db                	test   %ebx,%ebx
+  801cff:	78 2e                	js     801d2f <__divdi3+0x47>
+  801d01:	53                   	push   %ebx
+  801d02:	51                   	push   %ecx
+  801d03:	52                   	push   %edx
+  801d04:	50                   	push   %eax
+  801d05:	e8 65 fe ff ff       	call   801b6f <__udivdi3>
+  801d0a:	83 c4 10             	add    $0x10,%esp
+  801d0d:	eb 1e                	jmp    801d2d <__divdi3+0x45>
+  801d0f:	f7 d8                	neg    %eax
+  801d11:	83 d2 00             	adc    $0x0,%edx
+  801d14:	f7 da                	neg    %edx
+  801d16:	85 db                	test   %ebx,%ebx
+  801d18:	78 2a                	js     801d44 <__divdi3+0x5c>
+  801d1a:	53                   	push   %ebx
+  801d1b:	51                   	push   %ecx
+  801d1c:	52                   	push   %edx
+  801d1d:	50                   	push   %eax
+  801d1e:	e8 4c fe ff ff       	call   801b6f <__udivdi3>
+  801d23:	83 c4 10             	add    $0x10,%esp
+  801d26:	f7 d8                	neg    %eax
+  801d28:	83 d2 00             	adc    $0x0,%edx
+  801d2b:	f7 da                	neg    %edx
+  801d2d:	5b                   	pop    %ebx
+  801d2e:	c3                   	ret
+  801d2f:	f7 d9                	neg    %ecx
+  801d31:	83 d3 00             	adc    $0x0,%ebx
+  801d34:	f7 db                	neg    %ebx
+  801d36:	53                   	push   %ebx
+  801d37:	51                   	push   %ecx
+  801d38:	52                   	push   %edx
+  801d39:	50                   	push   %eax
+  801d3a:	e8 30 fe ff ff       	call   801b6f <__udivdi3>
+  801d3f:	83 c4 10             	add    $0x10,%esp
+  801d42:	eb e2                	jmp    801d26 <__divdi3+0x3e>
+  801d44:	f7 d9                	neg    %ecx
+  801d46:	83 d3 00             	adc    $0x0,%ebx
+  801d49:	f7 db                	neg    %ebx
+  801d4b:	53                   	push   %ebx
+  801d4c:	51                   	push   %ecx
+  801d4d:	52                   	push   %edx
+  801d4e:	50                   	push   %eax
+  801d4f:	e8 1b fe ff ff       	call   801b6f <__udivdi3>
+  801d54:	83 c4 10             	add    $0x10,%esp
+  801d57:	eb d4                	jmp    801d2d <__divdi3+0x45>
+
+00801d59 <__moddi3>:
+  801d59:	55                   	push   %ebp
+  801d5a:	57                   	push   %edi
+  801d5b:	56                   	push   %esi
+  801d5c:	53                   	push   %ebx
+  801d5d:	83 ec 14             	sub    $0x14,%esp
+  801d60:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801d64:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801d68:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801d6c:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801d70:	85 ed                	test   %ebp,%ebp
+  801d72:	78 2b                	js     801d9f <__moddi3+0x46>
+  801d74:	89 c6                	mov    %eax,%esi
+  801d76:	f7 de                	neg    %esi
+  801d78:	89 34 24             	mov    %esi,(%esp)
+  801d7b:	89 d6                	mov    %edx,%esi
+  801d7d:	83 d6 00             	adc    $0x0,%esi
+  801d80:	f7 de                	neg    %esi
+  801d82:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801d86:	8b 34 24             	mov    (%esp),%esi
+  801d89:	0f 48 f0             	cmovs  %eax,%esi
+  801d8c:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801d91:	52                   	push   %edx
+  801d92:	56                   	push   %esi
+  801d93:	55                   	push   %ebp
+  801d94:	57                   	push   %edi
+  801d95:	e8 ad fe ff ff       	call   801c47 <__umoddi3>
+  801d9a:	83 c4 10             	add    $0x10,%esp
+  801d9d:	eb 3c                	jmp    801ddb <__moddi3+0x82>
+  801d9f:	89 c3                	mov    %eax,%ebx
+  801da1:	f7 db                	neg    %ebx
+  801da3:	89 d1                	mov    %edx,%ecx
+  801da5:	83 d1 00             	adc    $0x0,%ecx
+  801da8:	f7 d9                	neg    %ecx
+  801daa:	0f 49 c3             	cmovns %ebx,%eax
+  801dad:	89 04 24             	mov    %eax,(%esp)
+  801db0:	0f 49 d1             	cmovns %ecx,%edx
+  801db3:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801db7:	ff 74 24 04          	push   0x4(%esp)
+  801dbb:	ff 74 24 04          	push   0x4(%esp)
+  801dbf:	89 f8                	mov    %edi,%eax
+  801dc1:	89 ea                	mov    %ebp,%edx
+  801dc3:	f7 d8                	neg    %eax
+  801dc5:	83 d2 00             	adc    $0x0,%edx
+  801dc8:	f7 da                	neg    %edx
+  801dca:	52                   	push   %edx
+  801dcb:	50                   	push   %eax
+  801dcc:	e8 76 fe ff ff       	call   801c47 <__umoddi3>
+  801dd1:	83 c4 10             	add    $0x10,%esp
+  801dd4:	f7 d8                	neg    %eax
+  801dd6:	83 d2 00             	adc    $0x0,%edx
+  801dd9:	f7 da                	neg    %edx
+  801ddb:	83 c4 14             	add    $0x14,%esp
+  801dde:	5b                   	pop    %ebx
+  801ddf:	5e                   	pop    %esi
+  801de0:	5f                   	pop    %edi
+  801de1:	5d                   	pop    %ebp
+  801de2:	c3                   	ret
@@ -0,0 +1,2858 @@
+
+obj/user/sysbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 7c 02 00 00       	call   8002ad <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 30             	sub    $0x30,%esp
+  80003c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800041:	0f a2                	cpuid
+  800043:	f6 c6 08             	test   $0x8,%dh
+  800046:	b8 c0 1c 80 00       	mov    $0x801cc0,%eax
+  80004b:	ba c2 1c 80 00       	mov    $0x801cc2,%edx
+  800050:	0f 45 c2             	cmovne %edx,%eax
+  800053:	50                   	push   %eax
+  800054:	68 00 10 00 00       	push   $0x1000
+  800059:	68 9c 1d 80 00       	push   $0x801d9c
+  80005e:	e8 8d 03 00 00       	call   8003f0 <cprintf>
+  800063:	83 c4 0c             	add    $0xc,%esp
+  800066:	6a 07                	push   $0x7
+  800068:	68 00 00 40 00       	push   $0x400000
+  80006d:	6a 00                	push   $0x0
+  80006f:	e8 23 11 00 00       	call   801197 <sys_page_alloc>
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 12                	js     80008d <umain+0x5a>
+  80007b:	0f 31                	rdtsc
+  80007d:	89 c1                	mov    %eax,%ecx
+  80007f:	89 d3                	mov    %edx,%ebx
+  800081:	ba 01 10 00 00       	mov    $0x1001,%edx
+  800086:	be 02 00 00 00       	mov    $0x2,%esi
+  80008b:	eb 16                	jmp    8000a3 <umain+0x70>
+  80008d:	50                   	push   %eax
+  80008e:	68 cc 1c 80 00       	push   $0x801ccc
+  800093:	6a 2c                	push   $0x2c
+  800095:	68 df 1c 80 00       	push   $0x801cdf
+  80009a:	e8 71 02 00 00       	call   800310 <_panic>
+  80009f:	89 f0                	mov    %esi,%eax
+  8000a1:	cd 30                	int    $0x30
+  8000a3:	83 ea 01             	sub    $0x1,%edx
+  8000a6:	75 f7                	jne    80009f <umain+0x6c>
+  8000a8:	0f 31                	rdtsc
+  8000aa:	83 ec 04             	sub    $0x4,%esp
+  8000ad:	29 c8                	sub    %ecx,%eax
+  8000af:	19 da                	sbb    %ebx,%edx
+  8000b1:	0f ac d0 0c          	shrd   $0xc,%edx,%eax
+  8000b5:	c1 ea 0c             	shr    $0xc,%edx
+  8000b8:	50                   	push   %eax
+  8000b9:	68 ef 1c 80 00       	push   $0x801cef
+  8000be:	68 fe 1c 80 00       	push   $0x801cfe
+  8000c3:	e8 28 03 00 00       	call   8003f0 <cprintf>
+  8000c8:	0f 31                	rdtsc
+  8000ca:	89 c6                	mov    %eax,%esi
+  8000cc:	89 d7                	mov    %edx,%edi
+  8000ce:	83 c4 10             	add    $0x10,%esp
+  8000d1:	bb 01 10 00 00       	mov    $0x1001,%ebx
+  8000d6:	eb 05                	jmp    8000dd <umain+0xaa>
+  8000d8:	e8 d0 0e 00 00       	call   800fad <sys_getenvid>
+  8000dd:	83 eb 01             	sub    $0x1,%ebx
+  8000e0:	75 f6                	jne    8000d8 <umain+0xa5>
+  8000e2:	0f 31                	rdtsc
+  8000e4:	83 ec 04             	sub    $0x4,%esp
+  8000e7:	29 f0                	sub    %esi,%eax
+  8000e9:	19 fa                	sbb    %edi,%edx
+  8000eb:	0f ac d0 0c          	shrd   $0xc,%edx,%eax
+  8000ef:	c1 ea 0c             	shr    $0xc,%edx
+  8000f2:	50                   	push   %eax
+  8000f3:	68 15 1d 80 00       	push   $0x801d15
+  8000f8:	68 fe 1c 80 00       	push   $0x801cfe
+  8000fd:	e8 ee 02 00 00       	call   8003f0 <cprintf>
+  800102:	0f 31                	rdtsc
+  800104:	89 c6                	mov    %eax,%esi
+  800106:	89 d7                	mov    %edx,%edi
+  800108:	83 c4 10             	add    $0x10,%esp
+  80010b:	bb 01 10 00 00       	mov    $0x1001,%ebx
+  800110:	eb 05                	jmp    800117 <umain+0xe4>
+  800112:	e8 b5 16 00 00       	call   8017cc <uinfo_envid>
+  800117:	83 eb 01             	sub    $0x1,%ebx
+  80011a:	75 f6                	jne    800112 <umain+0xdf>
+  80011c:	0f 31                	rdtsc
+  80011e:	83 ec 04             	sub    $0x4,%esp
+  800121:	29 f0                	sub    %esi,%eax
+  800123:	19 fa                	sbb    %edi,%edx
+  800125:	0f ac d0 0c          	shrd   $0xc,%edx,%eax
+  800129:	c1 ea 0c             	shr    $0xc,%edx
+  80012c:	50                   	push   %eax
+  80012d:	68 25 1d 80 00       	push   $0x801d25
+  800132:	68 fe 1c 80 00       	push   $0x801cfe
+  800137:	e8 b4 02 00 00       	call   8003f0 <cprintf>
+  80013c:	0f 31                	rdtsc
+  80013e:	89 c6                	mov    %eax,%esi
+  800140:	89 d7                	mov    %edx,%edi
+  800142:	83 c4 10             	add    $0x10,%esp
+  800145:	bb 01 10 00 00       	mov    $0x1001,%ebx
+  80014a:	eb 2a                	jmp    800176 <umain+0x143>
+  80014c:	83 ec 0c             	sub    $0xc,%esp
+  80014f:	6a 07                	push   $0x7
+  800151:	68 00 10 40 00       	push   $0x401000
+  800156:	6a 00                	push   $0x0
+  800158:	68 00 00 40 00       	push   $0x400000
+  80015d:	6a 00                	push   $0x0
+  80015f:	e8 c2 10 00 00       	call   801226 <sys_page_map>
+  800164:	83 c4 18             	add    $0x18,%esp
+  800167:	68 00 10 40 00       	push   $0x401000
+  80016c:	6a 00                	push   $0x0
+  80016e:	e8 40 11 00 00       	call   8012b3 <sys_page_unmap>
+  800173:	83 c4 10             	add    $0x10,%esp
+  800176:	83 eb 01             	sub    $0x1,%ebx
+  800179:	75 d1                	jne    80014c <umain+0x119>
+  80017b:	0f 31                	rdtsc
+  80017d:	83 ec 04             	sub    $0x4,%esp
+  800180:	29 f0                	sub    %esi,%eax
+  800182:	19 fa                	sbb    %edi,%edx
+  800184:	0f ac d0 0c          	shrd   $0xc,%edx,%eax
+  800188:	c1 ea 0c             	shr    $0xc,%edx
+  80018b:	50                   	push   %eax
+  80018c:	68 36 1d 80 00       	push   $0x801d36
+  800191:	68 fe 1c 80 00       	push   $0x801cfe
+  800196:	e8 55 02 00 00       	call   8003f0 <cprintf>
+  80019b:	e8 c5 16 00 00       	call   801865 <sysring_setup>
+  8001a0:	83 c4 10             	add    $0x10,%esp
+  8001a3:	85 c0                	test   %eax,%eax
+  8001a5:	78 20                	js     8001c7 <umain+0x194>
+  8001a7:	0f 31                	rdtsc
+  8001a9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8001ac:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  8001af:	bf 81 00 00 00       	mov    $0x81,%edi
+  8001b4:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8001b7:	83 ef 01             	sub    $0x1,%edi
+  8001ba:	0f 84 86 00 00 00    	je     800246 <umain+0x213>
+  8001c0:	bb 21 00 00 00       	mov    $0x21,%ebx
+  8001c5:	eb 4a                	jmp    800211 <umain+0x1de>
+  8001c7:	50                   	push   %eax
+  8001c8:	68 4c 1d 80 00       	push   $0x801d4c
+  8001cd:	6a 43                	push   $0x43
+  8001cf:	68 df 1c 80 00       	push   $0x801cdf
+  8001d4:	e8 37 01 00 00       	call   800310 <_panic>
+  8001d9:	83 ec 04             	sub    $0x4,%esp
+  8001dc:	6a 07                	push   $0x7
+  8001de:	68 00 10 40 00       	push   $0x401000
+  8001e3:	6a 00                	push   $0x0
+  8001e5:	68 00 00 40 00       	push   $0x400000
+  8001ea:	6a 00                	push   $0x0
+  8001ec:	6a 05                	push   $0x5
+  8001ee:	6a 00                	push   $0x0
+  8001f0:	e8 7d 16 00 00       	call   801872 <sysring_submit>
+  8001f5:	83 c4 1c             	add    $0x1c,%esp
+  8001f8:	6a 00                	push   $0x0
+  8001fa:	6a 00                	push   $0x0
+  8001fc:	6a 00                	push   $0x0
+  8001fe:	68 00 10 40 00       	push   $0x401000
+  800203:	6a 00                	push   $0x0
+  800205:	6a 06                	push   $0x6
+  800207:	6a 01                	push   $0x1
+  800209:	e8 64 16 00 00       	call   801872 <sysring_submit>
+  80020e:	83 c4 20             	add    $0x20,%esp
+  800211:	83 eb 01             	sub    $0x1,%ebx
+  800214:	75 c3                	jne    8001d9 <umain+0x1a6>
+  800216:	e8 c4 16 00 00       	call   8018df <sysring_enter>
+  80021b:	83 ec 08             	sub    $0x8,%esp
+  80021e:	56                   	push   %esi
+  80021f:	6a 00                	push   $0x0
+  800221:	e8 c6 16 00 00       	call   8018ec <sysring_reap>
+  800226:	83 c4 10             	add    $0x10,%esp
+  800229:	85 c0                	test   %eax,%eax
+  80022b:	74 8a                	je     8001b7 <umain+0x184>
+  80022d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800230:	85 c0                	test   %eax,%eax
+  800232:	79 e7                	jns    80021b <umain+0x1e8>
+  800234:	50                   	push   %eax
+  800235:	68 5e 1d 80 00       	push   $0x801d5e
+  80023a:	6a 4f                	push   $0x4f
+  80023c:	68 df 1c 80 00       	push   $0x801cdf
+  800241:	e8 ca 00 00 00       	call   800310 <_panic>
+  800246:	0f 31                	rdtsc
+  800248:	83 ec 04             	sub    $0x4,%esp
+  80024b:	2b 45 d0             	sub    -0x30(%ebp),%eax
+  80024e:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+  800251:	0f ac d0 0c          	shrd   $0xc,%edx,%eax
+  800255:	c1 ea 0c             	shr    $0xc,%edx
+  800258:	50                   	push   %eax
+  800259:	68 76 1d 80 00       	push   $0x801d76
+  80025e:	68 fe 1c 80 00       	push   $0x801cfe
+  800263:	e8 88 01 00 00       	call   8003f0 <cprintf>
+  800268:	0f 31                	rdtsc
+  80026a:	89 c6                	mov    %eax,%esi
+  80026c:	89 d7                	mov    %edx,%edi
+  80026e:	83 c4 10             	add    $0x10,%esp
+  800271:	bb 01 10 00 00       	mov    $0x1001,%ebx
+  800276:	eb 05                	jmp    80027d <umain+0x24a>
+  800278:	e8 98 0d 00 00       	call   801015 <sys_yield>
+  80027d:	83 eb 01             	sub    $0x1,%ebx
+  800280:	75 f6                	jne    800278 <umain+0x245>
+  800282:	0f 31                	rdtsc
+  800284:	83 ec 04             	sub    $0x4,%esp
+  800287:	29 f0                	sub    %esi,%eax
+  800289:	19 fa                	sbb    %edi,%edx
+  80028b:	0f ac d0 0c          	shrd   $0xc,%edx,%eax
+  80028f:	c1 ea 0c             	shr    $0xc,%edx
+  800292:	50                   	push   %eax
+  800293:	68 93 1d 80 00       	push   $0x801d93
+  800298:	68 fe 1c 80 00       	push   $0x801cfe
+  80029d:	e8 4e 01 00 00       	call   8003f0 <cprintf>
+  8002a2:	83 c4 10             	add    $0x10,%esp
+  8002a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a8:	5b                   	pop    %ebx
+  8002a9:	5e                   	pop    %esi
+  8002aa:	5f                   	pop    %edi
+  8002ab:	5d                   	pop    %ebp
+  8002ac:	c3                   	ret
+
+008002ad <libmain>:
+  8002ad:	55                   	push   %ebp
+  8002ae:	89 e5                	mov    %esp,%ebp
+  8002b0:	56                   	push   %esi
+  8002b1:	53                   	push   %ebx
+  8002b2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002b5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8002b8:	e8 0f 15 00 00       	call   8017cc <uinfo_envid>
+  8002bd:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8002c2:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8002c8:	05 00 00 00 ed       	add    $0xed000000,%eax
+  8002cd:	a3 20 30 80 00       	mov    %eax,0x803020
+  8002d2:	85 db                	test   %ebx,%ebx
+  8002d4:	7e 07                	jle    8002dd <libmain+0x30>
+  8002d6:	8b 06                	mov    (%esi),%eax
+  8002d8:	a3 00 30 80 00       	mov    %eax,0x803000
+  8002dd:	83 ec 08             	sub    $0x8,%esp
+  8002e0:	56                   	push   %esi
+  8002e1:	53                   	push   %ebx
+  8002e2:	e8 4c fd ff ff       	call   800033 <umain>
+  8002e7:	e8 0a 00 00 00       	call   8002f6 <exit>
+  8002ec:	83 c4 10             	add    $0x10,%esp
+  8002ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002f2:	5b                   	pop    %ebx
+  8002f3:	5e                   	pop    %esi
+  8002f4:	5d                   	pop    %ebp
+  8002f5:	c3                   	ret
+
+008002f6 <exit>:
+  8002f6:	55                   	push   %ebp
+  8002f7:	89 e5                	mov    %esp,%ebp
+  8002f9:	83 ec 08             	sub    $0x8,%esp
+  8002fc:	e8 3f 16 00 00       	call   801940 <bflush>
+  800301:	83 ec 0c             	sub    $0xc,%esp
+  800304:	6a 00                	push   $0x0
+  800306:	e8 17 0c 00 00       	call   800f22 <sys_env_destroy>
+  80030b:	83 c4 10             	add    $0x10,%esp
+  80030e:	c9                   	leave
+  80030f:	c3                   	ret
+
+00800310 <_panic>:
+  800310:	55                   	push   %ebp
+  800311:	89 e5                	mov    %esp,%ebp
+  800313:	56                   	push   %esi
+  800314:	53                   	push   %ebx
+  800315:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800318:	e8 23 16 00 00       	call   801940 <bflush>
+  80031d:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  800323:	e8 85 0c 00 00       	call   800fad <sys_getenvid>
+  800328:	83 ec 0c             	sub    $0xc,%esp
+  80032b:	ff 75 0c             	push   0xc(%ebp)
+  80032e:	ff 75 08             	push   0x8(%ebp)
+  800331:	56                   	push   %esi
+  800332:	50                   	push   %eax
+  800333:	68 cc 1d 80 00       	push   $0x801dcc
+  800338:	e8 b3 00 00 00       	call   8003f0 <cprintf>
+  80033d:	83 c4 18             	add    $0x18,%esp
+  800340:	53                   	push   %ebx
+  800341:	ff 75 10             	push   0x10(%ebp)
+  800344:	e8 56 00 00 00       	call   80039f <vcprintf>
+  800349:	c7 04 24 13 1d 80 00 	movl   $0x801d13,(%esp)
+  800350:	e8 9b 00 00 00       	call   8003f0 <cprintf>
+  800355:	83 c4 10             	add    $0x10,%esp
+  800358:	cc                   	int3
+  800359:	eb fd                	jmp    800358 <_panic+0x48>
+
+0080035b <putch>:
+  80035b:	55                   	push   %ebp
+  80035c:	89 e5                	mov    %esp,%ebp
+  80035e:	53                   	push   %ebx
+  80035f:	83 ec 04             	sub    $0x4,%esp
+  800362:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800365:	8b 13                	mov    (%ebx),%edx
+  800367:	8d 42 01             	lea    0x1(%edx),%eax
+  80036a:	89 03                	mov    %eax,(%ebx)
+  80036c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80036f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800373:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800378:	74 09                	je     800383 <putch+0x28>
+  80037a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80037e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800381:	c9                   	leave
+  800382:	c3                   	ret
+  800383:	83 ec 08             	sub    $0x8,%esp
+  800386:	68 ff 00 00 00       	push   $0xff
+  80038b:	8d 43 08             	lea    0x8(%ebx),%eax
+  80038e:	50                   	push   %eax
+  80038f:	e8 c0 0a 00 00       	call   800e54 <sys_cputs>
+  800394:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80039a:	83 c4 10             	add    $0x10,%esp
+  80039d:	eb db                	jmp    80037a <putch+0x1f>
+
+0080039f <vcprintf>:
+  80039f:	55                   	push   %ebp
+  8003a0:	89 e5                	mov    %esp,%ebp
+  8003a2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8003a8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003af:	00 00 00 
+  8003b2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003b9:	00 00 00 
+  8003bc:	ff 75 0c             	push   0xc(%ebp)
+  8003bf:	ff 75 08             	push   0x8(%ebp)
+  8003c2:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003c8:	50                   	push   %eax
+  8003c9:	68 5b 03 80 00       	push   $0x80035b
+  8003ce:	e8 14 01 00 00       	call   8004e7 <vprintfmt>
+  8003d3:	83 c4 08             	add    $0x8,%esp
+  8003d6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003dc:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003e2:	50                   	push   %eax
+  8003e3:	e8 6c 0a 00 00       	call   800e54 <sys_cputs>
+  8003e8:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003ee:	c9                   	leave
+  8003ef:	c3                   	ret
+
+008003f0 <cprintf>:
+  8003f0:	55                   	push   %ebp
+  8003f1:	89 e5                	mov    %esp,%ebp
+  8003f3:	83 ec 10             	sub    $0x10,%esp
+  8003f6:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8003f9:	50                   	push   %eax
+  8003fa:	ff 75 08             	push   0x8(%ebp)
+  8003fd:	e8 9d ff ff ff       	call   80039f <vcprintf>
+  800402:	c9                   	leave
+  800403:	c3                   	ret
+
+00800404 <printnum>:
+  800404:	55                   	push   %ebp
+  800405:	89 e5                	mov    %esp,%ebp
+  800407:	57                   	push   %edi
+  800408:	56                   	push   %esi
+  800409:	53                   	push   %ebx
+  80040a:	83 ec 1c             	sub    $0x1c,%esp
+  80040d:	89 c7                	mov    %eax,%edi
+  80040f:	89 d6                	mov    %edx,%esi
+  800411:	8b 45 08             	mov    0x8(%ebp),%eax
+  800414:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800417:	89 d1                	mov    %edx,%ecx
+  800419:	89 c2                	mov    %eax,%edx
+  80041b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80041e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800421:	8b 45 10             	mov    0x10(%ebp),%eax
+  800424:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800427:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80042a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800431:	39 c2                	cmp    %eax,%edx
+  800433:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800436:	72 3e                	jb     800476 <printnum+0x72>
+  800438:	83 ec 0c             	sub    $0xc,%esp
+  80043b:	ff 75 18             	push   0x18(%ebp)
+  80043e:	83 eb 01             	sub    $0x1,%ebx
+  800441:	53                   	push   %ebx
+  800442:	50                   	push   %eax
+  800443:	83 ec 08             	sub    $0x8,%esp
+  800446:	ff 75 e4             	push   -0x1c(%ebp)
+  800449:	ff 75 e0             	push   -0x20(%ebp)
+  80044c:	ff 75 dc             	push   -0x24(%ebp)
+  80044f:	ff 75 d8             	push   -0x28(%ebp)
+  800452:	e8 e0 15 00 00       	call   801a37 <__udivdi3>
+  800457:	83 c4 18             	add    $0x18,%esp
+  80045a:	52                   	push   %edx
+  80045b:	50                   	push   %eax
+  80045c:	89 f2                	mov    %esi,%edx
+  80045e:	89 f8                	mov    %edi,%eax
+  800460:	e8 9f ff ff ff       	call   800404 <printnum>
+  800465:	83 c4 20             	add    $0x20,%esp
+  800468:	eb 13                	jmp    80047d <printnum+0x79>
+  80046a:	83 ec 08             	sub    $0x8,%esp
+  80046d:	56                   	push   %esi
+  80046e:	ff 75 18             	push   0x18(%ebp)
+  800471:	ff d7                	call   *%edi
+  800473:	83 c4 10             	add    $0x10,%esp
+  800476:	83 eb 01             	sub    $0x1,%ebx
+  800479:	85 db                	test   %ebx,%ebx
+  80047b:	7f ed                	jg     80046a <printnum+0x66>
+  80047d:	83 ec 08             	sub    $0x8,%esp
+  800480:	56                   	push   %esi
+  800481:	83 ec 04             	sub    $0x4,%esp
+  800484:	ff 75 e4             	push   -0x1c(%ebp)
+  800487:	ff 75 e0             	push   -0x20(%ebp)
+  80048a:	ff 75 dc             	push   -0x24(%ebp)
+  80048d:	ff 75 d8             	push   -0x28(%ebp)
+  800490:	e8 7a 16 00 00       	call   801b0f <__umoddi3>
+  800495:	83 c4 14             	add    $0x14,%esp
+  800498:	0f be 80 ef 1d 80 00 	movsbl 0x801def(%eax),%eax
+  80049f:	50                   	push   %eax
+  8004a0:	ff d7                	call   *%edi
+  8004a2:	83 c4 10             	add    $0x10,%esp
+  8004a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004a8:	5b                   	pop    %ebx
+  8004a9:	5e                   	pop    %esi
+  8004aa:	5f                   	pop    %edi
+  8004ab:	5d                   	pop    %ebp
+  8004ac:	c3                   	ret
+
+008004ad <sprintputch>:
+  8004ad:	55                   	push   %ebp
+  8004ae:	89 e5                	mov    %esp,%ebp
+  8004b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8004b3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8004b7:	8b 10                	mov    (%eax),%edx
+  8004b9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004bc:	73 0a                	jae    8004c8 <sprintputch+0x1b>
+  8004be:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004c1:	89 08                	mov    %ecx,(%eax)
+  8004c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004c6:	88 02                	mov    %al,(%edx)
+  8004c8:	5d                   	pop    %ebp
+  8004c9:	c3                   	ret
+
+008004ca <printfmt>:
+  8004ca:	55                   	push   %ebp
+  8004cb:	89 e5                	mov    %esp,%ebp
+  8004cd:	83 ec 08             	sub    $0x8,%esp
+  8004d0:	8d 45 14             	lea    0x14(%ebp),%eax
+  8004d3:	50                   	push   %eax
+  8004d4:	ff 75 10             	push   0x10(%ebp)
+  8004d7:	ff 75 0c             	push   0xc(%ebp)
+  8004da:	ff 75 08             	push   0x8(%ebp)
+  8004dd:	e8 05 00 00 00       	call   8004e7 <vprintfmt>
+  8004e2:	83 c4 10             	add    $0x10,%esp
+  8004e5:	c9                   	leave
+  8004e6:	c3                   	ret
+
+008004e7 <vprintfmt>:
+  8004e7:	55                   	push   %ebp
+  8004e8:	89 e5                	mov    %esp,%ebp
+  8004ea:	57                   	push   %edi
+  8004eb:	56                   	push   %esi
+  8004ec:	53                   	push   %ebx
+  8004ed:	83 ec 2c             	sub    $0x2c,%esp
+  8004f0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004f6:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8004f9:	eb 0a                	jmp    800505 <vprintfmt+0x1e>
+  8004fb:	83 ec 08             	sub    $0x8,%esp
+  8004fe:	53                   	push   %ebx
+  8004ff:	50                   	push   %eax
+  800500:	ff d6                	call   *%esi
+  800502:	83 c4 10             	add    $0x10,%esp
+  800505:	83 c7 01             	add    $0x1,%edi
+  800508:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80050c:	83 f8 25             	cmp    $0x25,%eax
+  80050f:	74 0c                	je     80051d <vprintfmt+0x36>
+  800511:	85 c0                	test   %eax,%eax
+  800513:	75 e6                	jne    8004fb <vprintfmt+0x14>
+  800515:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800518:	5b                   	pop    %ebx
+  800519:	5e                   	pop    %esi
+  80051a:	5f                   	pop    %edi
+  80051b:	5d                   	pop    %ebp
+  80051c:	c3                   	ret
+  80051d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800521:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800528:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80052f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800536:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80053b:	8d 47 01             	lea    0x1(%edi),%eax
+  80053e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800541:	0f b6 17             	movzbl (%edi),%edx
+  800544:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800547:	3c 55                	cmp    $0x55,%al
+  800549:	0f 87 cf 03 00 00    	ja     80091e <vprintfmt+0x437>
+  80054f:	0f b6 c0             	movzbl %al,%eax
+  800552:	ff 24 85 c0 1e 80 00 	jmp    *0x801ec0(,%eax,4)
+  800559:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80055c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800560:	eb d9                	jmp    80053b <vprintfmt+0x54>
+  800562:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800565:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800569:	eb d0                	jmp    80053b <vprintfmt+0x54>
+  80056b:	0f b6 d2             	movzbl %dl,%edx
+  80056e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800571:	b8 00 00 00 00       	mov    $0x0,%eax
+  800576:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800579:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80057c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800580:	0f be 17             	movsbl (%edi),%edx
+  800583:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800586:	83 f9 09             	cmp    $0x9,%ecx
+  800589:	77 55                	ja     8005e0 <vprintfmt+0xf9>
+  80058b:	83 c7 01             	add    $0x1,%edi
+  80058e:	eb e9                	jmp    800579 <vprintfmt+0x92>
+  800590:	8b 45 14             	mov    0x14(%ebp),%eax
+  800593:	8b 00                	mov    (%eax),%eax
+  800595:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800598:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059b:	8d 40 04             	lea    0x4(%eax),%eax
+  80059e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005a4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005a8:	79 91                	jns    80053b <vprintfmt+0x54>
+  8005aa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005ad:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005b0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005b7:	eb 82                	jmp    80053b <vprintfmt+0x54>
+  8005b9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005bc:	85 d2                	test   %edx,%edx
+  8005be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c3:	0f 49 c2             	cmovns %edx,%eax
+  8005c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005cc:	e9 6a ff ff ff       	jmp    80053b <vprintfmt+0x54>
+  8005d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005d4:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8005db:	e9 5b ff ff ff       	jmp    80053b <vprintfmt+0x54>
+  8005e0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005e3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005e6:	eb bc                	jmp    8005a4 <vprintfmt+0xbd>
+  8005e8:	83 c1 01             	add    $0x1,%ecx
+  8005eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005ee:	e9 48 ff ff ff       	jmp    80053b <vprintfmt+0x54>
+  8005f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f6:	8d 78 04             	lea    0x4(%eax),%edi
+  8005f9:	83 ec 08             	sub    $0x8,%esp
+  8005fc:	53                   	push   %ebx
+  8005fd:	ff 30                	push   (%eax)
+  8005ff:	ff d6                	call   *%esi
+  800601:	83 c4 10             	add    $0x10,%esp
+  800604:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800607:	e9 b1 02 00 00       	jmp    8008bd <vprintfmt+0x3d6>
+  80060c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060f:	8d 78 04             	lea    0x4(%eax),%edi
+  800612:	8b 10                	mov    (%eax),%edx
+  800614:	89 d0                	mov    %edx,%eax
+  800616:	f7 d8                	neg    %eax
+  800618:	0f 48 c2             	cmovs  %edx,%eax
+  80061b:	83 f8 08             	cmp    $0x8,%eax
+  80061e:	7f 23                	jg     800643 <vprintfmt+0x15c>
+  800620:	8b 14 85 20 20 80 00 	mov    0x802020(,%eax,4),%edx
+  800627:	85 d2                	test   %edx,%edx
+  800629:	74 18                	je     800643 <vprintfmt+0x15c>
+  80062b:	52                   	push   %edx
+  80062c:	68 10 1e 80 00       	push   $0x801e10
+  800631:	53                   	push   %ebx
+  800632:	56                   	push   %esi
+  800633:	e8 92 fe ff ff       	call   8004ca <printfmt>
+  800638:	83 c4 10             	add    $0x10,%esp
+  80063b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80063e:	e9 7a 02 00 00       	jmp    8008bd <vprintfmt+0x3d6>
+  800643:	50                   	push   %eax
+  800644:	68 07 1e 80 00       	push   $0x801e07
+  800649:	53                   	push   %ebx
+  80064a:	56                   	push   %esi
+  80064b:	e8 7a fe ff ff       	call   8004ca <printfmt>
+  800650:	83 c4 10             	add    $0x10,%esp
+  800653:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800656:	e9 62 02 00 00       	jmp    8008bd <vprintfmt+0x3d6>
+  80065b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065e:	83 c0 04             	add    $0x4,%eax
+  800661:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800664:	8b 45 14             	mov    0x14(%ebp),%eax
+  800667:	8b 08                	mov    (%eax),%ecx
+  800669:	85 c9                	test   %ecx,%ecx
+  80066b:	b8 00 1e 80 00       	mov    $0x801e00,%eax
+  800670:	0f 45 c1             	cmovne %ecx,%eax
+  800673:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800676:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80067a:	7e 06                	jle    800682 <vprintfmt+0x19b>
+  80067c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800680:	75 0b                	jne    80068d <vprintfmt+0x1a6>
+  800682:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800685:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800688:	89 75 08             	mov    %esi,0x8(%ebp)
+  80068b:	eb 5c                	jmp    8006e9 <vprintfmt+0x202>
+  80068d:	83 ec 08             	sub    $0x8,%esp
+  800690:	ff 75 d0             	push   -0x30(%ebp)
+  800693:	ff 75 cc             	push   -0x34(%ebp)
+  800696:	e8 87 03 00 00       	call   800a22 <strnlen>
+  80069b:	89 c2                	mov    %eax,%edx
+  80069d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006a0:	29 d0                	sub    %edx,%eax
+  8006a2:	83 c4 10             	add    $0x10,%esp
+  8006a5:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006ac:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006af:	89 c6                	mov    %eax,%esi
+  8006b1:	eb 0e                	jmp    8006c1 <vprintfmt+0x1da>
+  8006b3:	83 ec 08             	sub    $0x8,%esp
+  8006b6:	53                   	push   %ebx
+  8006b7:	57                   	push   %edi
+  8006b8:	ff 55 08             	call   *0x8(%ebp)
+  8006bb:	83 ee 01             	sub    $0x1,%esi
+  8006be:	83 c4 10             	add    $0x10,%esp
+  8006c1:	85 f6                	test   %esi,%esi
+  8006c3:	7f ee                	jg     8006b3 <vprintfmt+0x1cc>
+  8006c5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006cb:	85 c0                	test   %eax,%eax
+  8006cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006d2:	0f 49 d0             	cmovns %eax,%edx
+  8006d5:	29 d0                	sub    %edx,%eax
+  8006d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006da:	eb a6                	jmp    800682 <vprintfmt+0x19b>
+  8006dc:	83 ec 08             	sub    $0x8,%esp
+  8006df:	53                   	push   %ebx
+  8006e0:	52                   	push   %edx
+  8006e1:	ff 55 08             	call   *0x8(%ebp)
+  8006e4:	83 c4 10             	add    $0x10,%esp
+  8006e7:	89 f1                	mov    %esi,%ecx
+  8006e9:	8d 71 01             	lea    0x1(%ecx),%esi
+  8006ec:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006f0:	0f be d0             	movsbl %al,%edx
+  8006f3:	85 d2                	test   %edx,%edx
+  8006f5:	74 28                	je     80071f <vprintfmt+0x238>
+  8006f7:	85 ff                	test   %edi,%edi
+  8006f9:	78 05                	js     800700 <vprintfmt+0x219>
+  8006fb:	83 ef 01             	sub    $0x1,%edi
+  8006fe:	78 30                	js     800730 <vprintfmt+0x249>
+  800700:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800704:	74 d6                	je     8006dc <vprintfmt+0x1f5>
+  800706:	0f be c0             	movsbl %al,%eax
+  800709:	83 e8 20             	sub    $0x20,%eax
+  80070c:	83 f8 5e             	cmp    $0x5e,%eax
+  80070f:	76 cb                	jbe    8006dc <vprintfmt+0x1f5>
+  800711:	83 ec 08             	sub    $0x8,%esp
+  800714:	53                   	push   %ebx
+  800715:	6a 3f                	push   $0x3f
+  800717:	ff 55 08             	call   *0x8(%ebp)
+  80071a:	83 c4 10             	add    $0x10,%esp
+  80071d:	eb c8                	jmp    8006e7 <vprintfmt+0x200>
+  80071f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800722:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800725:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800728:	01 d0                	add    %edx,%eax
+  80072a:	29 c8                	sub    %ecx,%eax
+  80072c:	89 c7                	mov    %eax,%edi
+  80072e:	eb 13                	jmp    800743 <vprintfmt+0x25c>
+  800730:	8b 75 08             	mov    0x8(%ebp),%esi
+  800733:	eb ed                	jmp    800722 <vprintfmt+0x23b>
+  800735:	83 ec 08             	sub    $0x8,%esp
+  800738:	53                   	push   %ebx
+  800739:	6a 20                	push   $0x20
+  80073b:	ff d6                	call   *%esi
+  80073d:	83 ef 01             	sub    $0x1,%edi
+  800740:	83 c4 10             	add    $0x10,%esp
+  800743:	85 ff                	test   %edi,%edi
+  800745:	7f ee                	jg     800735 <vprintfmt+0x24e>
+  800747:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80074a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80074d:	e9 6b 01 00 00       	jmp    8008bd <vprintfmt+0x3d6>
+  800752:	83 f9 01             	cmp    $0x1,%ecx
+  800755:	7f 1f                	jg     800776 <vprintfmt+0x28f>
+  800757:	85 c9                	test   %ecx,%ecx
+  800759:	74 67                	je     8007c2 <vprintfmt+0x2db>
+  80075b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075e:	8b 00                	mov    (%eax),%eax
+  800760:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800763:	89 c1                	mov    %eax,%ecx
+  800765:	c1 f9 1f             	sar    $0x1f,%ecx
+  800768:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80076b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076e:	8d 40 04             	lea    0x4(%eax),%eax
+  800771:	89 45 14             	mov    %eax,0x14(%ebp)
+  800774:	eb 17                	jmp    80078d <vprintfmt+0x2a6>
+  800776:	8b 45 14             	mov    0x14(%ebp),%eax
+  800779:	8b 50 04             	mov    0x4(%eax),%edx
+  80077c:	8b 00                	mov    (%eax),%eax
+  80077e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800781:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800784:	8b 45 14             	mov    0x14(%ebp),%eax
+  800787:	8d 40 08             	lea    0x8(%eax),%eax
+  80078a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80078d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800790:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800793:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800798:	85 c9                	test   %ecx,%ecx
+  80079a:	0f 89 03 01 00 00    	jns    8008a3 <vprintfmt+0x3bc>
+  8007a0:	83 ec 08             	sub    $0x8,%esp
+  8007a3:	53                   	push   %ebx
+  8007a4:	6a 2d                	push   $0x2d
+  8007a6:	ff d6                	call   *%esi
+  8007a8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007ab:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007ae:	f7 da                	neg    %edx
+  8007b0:	83 d1 00             	adc    $0x0,%ecx
+  8007b3:	f7 d9                	neg    %ecx
+  8007b5:	83 c4 10             	add    $0x10,%esp
+  8007b8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007bd:	e9 e1 00 00 00       	jmp    8008a3 <vprintfmt+0x3bc>
+  8007c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c5:	8b 00                	mov    (%eax),%eax
+  8007c7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ca:	89 c1                	mov    %eax,%ecx
+  8007cc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007cf:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007db:	eb b0                	jmp    80078d <vprintfmt+0x2a6>
+  8007dd:	83 f9 01             	cmp    $0x1,%ecx
+  8007e0:	7f 1e                	jg     800800 <vprintfmt+0x319>
+  8007e2:	85 c9                	test   %ecx,%ecx
+  8007e4:	74 32                	je     800818 <vprintfmt+0x331>
+  8007e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e9:	8b 10                	mov    (%eax),%edx
+  8007eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007fb:	e9 a3 00 00 00       	jmp    8008a3 <vprintfmt+0x3bc>
+  800800:	8b 45 14             	mov    0x14(%ebp),%eax
+  800803:	8b 10                	mov    (%eax),%edx
+  800805:	8b 48 04             	mov    0x4(%eax),%ecx
+  800808:	8d 40 08             	lea    0x8(%eax),%eax
+  80080b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80080e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800813:	e9 8b 00 00 00       	jmp    8008a3 <vprintfmt+0x3bc>
+  800818:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081b:	8b 10                	mov    (%eax),%edx
+  80081d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800822:	8d 40 04             	lea    0x4(%eax),%eax
+  800825:	89 45 14             	mov    %eax,0x14(%ebp)
+  800828:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80082d:	eb 74                	jmp    8008a3 <vprintfmt+0x3bc>
+  80082f:	83 f9 01             	cmp    $0x1,%ecx
+  800832:	7f 1b                	jg     80084f <vprintfmt+0x368>
+  800834:	85 c9                	test   %ecx,%ecx
+  800836:	74 2c                	je     800864 <vprintfmt+0x37d>
+  800838:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083b:	8b 10                	mov    (%eax),%edx
+  80083d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800842:	8d 40 04             	lea    0x4(%eax),%eax
+  800845:	89 45 14             	mov    %eax,0x14(%ebp)
+  800848:	bf 08 00 00 00       	mov    $0x8,%edi
+  80084d:	eb 54                	jmp    8008a3 <vprintfmt+0x3bc>
+  80084f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800852:	8b 10                	mov    (%eax),%edx
+  800854:	8b 48 04             	mov    0x4(%eax),%ecx
+  800857:	8d 40 08             	lea    0x8(%eax),%eax
+  80085a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80085d:	bf 08 00 00 00       	mov    $0x8,%edi
+  800862:	eb 3f                	jmp    8008a3 <vprintfmt+0x3bc>
+  800864:	8b 45 14             	mov    0x14(%ebp),%eax
+  800867:	8b 10                	mov    (%eax),%edx
+  800869:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80086e:	8d 40 04             	lea    0x4(%eax),%eax
+  800871:	89 45 14             	mov    %eax,0x14(%ebp)
+  800874:	bf 08 00 00 00       	mov    $0x8,%edi
+  800879:	eb 28                	jmp    8008a3 <vprintfmt+0x3bc>
+  80087b:	83 ec 08             	sub    $0x8,%esp
+  80087e:	53                   	push   %ebx
+  80087f:	6a 30                	push   $0x30
+  800881:	ff d6                	call   *%esi
+  800883:	83 c4 08             	add    $0x8,%esp
+  800886:	53                   	push   %ebx
+  800887:	6a 78                	push   $0x78
+  800889:	ff d6                	call   *%esi
+  80088b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088e:	8b 10                	mov    (%eax),%edx
+  800890:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800895:	83 c4 10             	add    $0x10,%esp
+  800898:	8d 40 04             	lea    0x4(%eax),%eax
+  80089b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80089e:	bf 10 00 00 00       	mov    $0x10,%edi
+  8008a3:	83 ec 0c             	sub    $0xc,%esp
+  8008a6:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008aa:	50                   	push   %eax
+  8008ab:	ff 75 e0             	push   -0x20(%ebp)
+  8008ae:	57                   	push   %edi
+  8008af:	51                   	push   %ecx
+  8008b0:	52                   	push   %edx
+  8008b1:	89 da                	mov    %ebx,%edx
+  8008b3:	89 f0                	mov    %esi,%eax
+  8008b5:	e8 4a fb ff ff       	call   800404 <printnum>
+  8008ba:	83 c4 20             	add    $0x20,%esp
+  8008bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8008c0:	e9 40 fc ff ff       	jmp    800505 <vprintfmt+0x1e>
+  8008c5:	83 f9 01             	cmp    $0x1,%ecx
+  8008c8:	7f 1b                	jg     8008e5 <vprintfmt+0x3fe>
+  8008ca:	85 c9                	test   %ecx,%ecx
+  8008cc:	74 2c                	je     8008fa <vprintfmt+0x413>
+  8008ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d1:	8b 10                	mov    (%eax),%edx
+  8008d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008db:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008de:	bf 10 00 00 00       	mov    $0x10,%edi
+  8008e3:	eb be                	jmp    8008a3 <vprintfmt+0x3bc>
+  8008e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e8:	8b 10                	mov    (%eax),%edx
+  8008ea:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008ed:	8d 40 08             	lea    0x8(%eax),%eax
+  8008f0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008f3:	bf 10 00 00 00       	mov    $0x10,%edi
+  8008f8:	eb a9                	jmp    8008a3 <vprintfmt+0x3bc>
+  8008fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fd:	8b 10                	mov    (%eax),%edx
+  8008ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800904:	8d 40 04             	lea    0x4(%eax),%eax
+  800907:	89 45 14             	mov    %eax,0x14(%ebp)
+  80090a:	bf 10 00 00 00       	mov    $0x10,%edi
+  80090f:	eb 92                	jmp    8008a3 <vprintfmt+0x3bc>
+  800911:	83 ec 08             	sub    $0x8,%esp
+  800914:	53                   	push   %ebx
+  800915:	6a 25                	push   $0x25
+  800917:	ff d6                	call   *%esi
+  800919:	83 c4 10             	add    $0x10,%esp
+  80091c:	eb 9f                	jmp    8008bd <vprintfmt+0x3d6>
+  80091e:	83 ec 08             	sub    $0x8,%esp
+  800921:	53                   	push   %ebx
+  800922:	6a 25                	push   $0x25
+  800924:	ff d6                	call   *%esi
+  800926:	83 c4 10             	add    $0x10,%esp
+  800929:	89 f8                	mov    %edi,%eax
+  80092b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80092f:	74 05                	je     800936 <vprintfmt+0x44f>
+  800931:	83 e8 01             	sub    $0x1,%eax
+  800934:	eb f5                	jmp    80092b <vprintfmt+0x444>
+  800936:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800939:	eb 82                	jmp    8008bd <vprintfmt+0x3d6>
+
+0080093b <vsnprintf>:
+  80093b:	55                   	push   %ebp
+  80093c:	89 e5                	mov    %esp,%ebp
+  80093e:	83 ec 18             	sub    $0x18,%esp
+  800941:	8b 45 08             	mov    0x8(%ebp),%eax
+  800944:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800947:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80094a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80094e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800951:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800958:	85 c0                	test   %eax,%eax
+  80095a:	74 26                	je     800982 <vsnprintf+0x47>
+  80095c:	85 d2                	test   %edx,%edx
+  80095e:	7e 22                	jle    800982 <vsnprintf+0x47>
+  800960:	ff 75 14             	push   0x14(%ebp)
+  800963:	ff 75 10             	push   0x10(%ebp)
+  800966:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800969:	50                   	push   %eax
+  80096a:	68 ad 04 80 00       	push   $0x8004ad
+  80096f:	e8 73 fb ff ff       	call   8004e7 <vprintfmt>
+  800974:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800977:	c6 00 00             	movb   $0x0,(%eax)
+  80097a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80097d:	83 c4 10             	add    $0x10,%esp
+  800980:	c9                   	leave
+  800981:	c3                   	ret
+  800982:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800987:	eb f7                	jmp    800980 <vsnprintf+0x45>
+
+00800989 <snprintf>:
+  800989:	55                   	push   %ebp
+  80098a:	89 e5                	mov    %esp,%ebp
+  80098c:	83 ec 08             	sub    $0x8,%esp
+  80098f:	8d 45 14             	lea    0x14(%ebp),%eax
+  800992:	50                   	push   %eax
+  800993:	ff 75 10             	push   0x10(%ebp)
+  800996:	ff 75 0c             	push   0xc(%ebp)
+  800999:	ff 75 08             	push   0x8(%ebp)
+  80099c:	e8 9a ff ff ff       	call   80093b <vsnprintf>
+  8009a1:	c9                   	leave
+  8009a2:	c3                   	ret
+
+008009a3 <copy_fwd>:
+  8009a3:	55                   	push   %ebp
+  8009a4:	89 e5                	mov    %esp,%ebp
+  8009a6:	57                   	push   %edi
+  8009a7:	56                   	push   %esi
+  8009a8:	53                   	push   %ebx
+  8009a9:	89 c7                	mov    %eax,%edi
+  8009ab:	89 d6                	mov    %edx,%esi
+  8009ad:	89 c8                	mov    %ecx,%eax
+  8009af:	83 f9 0f             	cmp    $0xf,%ecx
+  8009b2:	76 1c                	jbe    8009d0 <copy_fwd+0x2d>
+  8009b4:	89 f9                	mov    %edi,%ecx
+  8009b6:	f7 d9                	neg    %ecx
+  8009b8:	89 cb                	mov    %ecx,%ebx
+  8009ba:	83 e3 03             	and    $0x3,%ebx
+  8009bd:	29 d8                	sub    %ebx,%eax
+  8009bf:	89 c2                	mov    %eax,%edx
+  8009c1:	c1 ea 02             	shr    $0x2,%edx
+  8009c4:	83 e0 03             	and    $0x3,%eax
+  8009c7:	89 d9                	mov    %ebx,%ecx
+  8009c9:	fc                   	cld
+  8009ca:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8009cc:	89 d1                	mov    %edx,%ecx
+  8009ce:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009d0:	89 c1                	mov    %eax,%ecx
+  8009d2:	fc                   	cld
+  8009d3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8009d5:	5b                   	pop    %ebx
+  8009d6:	5e                   	pop    %esi
+  8009d7:	5f                   	pop    %edi
+  8009d8:	5d                   	pop    %ebp
+  8009d9:	c3                   	ret
+
+008009da <have_sse2>:
+  8009da:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8009e1:	78 06                	js     8009e9 <have_sse2+0xf>
+  8009e3:	a1 04 30 80 00       	mov    0x803004,%eax
+  8009e8:	c3                   	ret
+  8009e9:	55                   	push   %ebp
+  8009ea:	89 e5                	mov    %esp,%ebp
+  8009ec:	53                   	push   %ebx
+  8009ed:	b8 01 00 00 00       	mov    $0x1,%eax
+  8009f2:	0f a2                	cpuid
+  8009f4:	c1 ea 1a             	shr    $0x1a,%edx
+  8009f7:	83 e2 01             	and    $0x1,%edx
+  8009fa:	89 15 04 30 80 00    	mov    %edx,0x803004
+  800a00:	a1 04 30 80 00       	mov    0x803004,%eax
+  800a05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a08:	c9                   	leave
+  800a09:	c3                   	ret
+
+00800a0a <strlen>:
+  800a0a:	55                   	push   %ebp
+  800a0b:	89 e5                	mov    %esp,%ebp
+  800a0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a15:	eb 03                	jmp    800a1a <strlen+0x10>
+  800a17:	83 c0 01             	add    $0x1,%eax
+  800a1a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a1e:	75 f7                	jne    800a17 <strlen+0xd>
+  800a20:	5d                   	pop    %ebp
+  800a21:	c3                   	ret
+
+00800a22 <strnlen>:
+  800a22:	55                   	push   %ebp
+  800a23:	89 e5                	mov    %esp,%ebp
+  800a25:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a28:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a30:	eb 03                	jmp    800a35 <strnlen+0x13>
+  800a32:	83 c0 01             	add    $0x1,%eax
+  800a35:	39 d0                	cmp    %edx,%eax
+  800a37:	74 08                	je     800a41 <strnlen+0x1f>
+  800a39:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a3d:	75 f3                	jne    800a32 <strnlen+0x10>
+  800a3f:	89 c2                	mov    %eax,%edx
+  800a41:	89 d0                	mov    %edx,%eax
+  800a43:	5d                   	pop    %ebp
+  800a44:	c3                   	ret
+
+00800a45 <strcpy>:
+  800a45:	55                   	push   %ebp
+  800a46:	89 e5                	mov    %esp,%ebp
+  800a48:	53                   	push   %ebx
+  800a49:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a4c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a54:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a58:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a5b:	83 c0 01             	add    $0x1,%eax
+  800a5e:	84 d2                	test   %dl,%dl
+  800a60:	75 f2                	jne    800a54 <strcpy+0xf>
+  800a62:	89 c8                	mov    %ecx,%eax
+  800a64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a67:	c9                   	leave
+  800a68:	c3                   	ret
+
+00800a69 <strcat>:
+  800a69:	55                   	push   %ebp
+  800a6a:	89 e5                	mov    %esp,%ebp
+  800a6c:	53                   	push   %ebx
+  800a6d:	83 ec 10             	sub    $0x10,%esp
+  800a70:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a73:	53                   	push   %ebx
+  800a74:	e8 91 ff ff ff       	call   800a0a <strlen>
+  800a79:	83 c4 08             	add    $0x8,%esp
+  800a7c:	ff 75 0c             	push   0xc(%ebp)
+  800a7f:	01 d8                	add    %ebx,%eax
+  800a81:	50                   	push   %eax
+  800a82:	e8 be ff ff ff       	call   800a45 <strcpy>
+  800a87:	89 d8                	mov    %ebx,%eax
+  800a89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a8c:	c9                   	leave
+  800a8d:	c3                   	ret
+
+00800a8e <strncpy>:
+  800a8e:	55                   	push   %ebp
+  800a8f:	89 e5                	mov    %esp,%ebp
+  800a91:	56                   	push   %esi
+  800a92:	53                   	push   %ebx
+  800a93:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a96:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a99:	89 f3                	mov    %esi,%ebx
+  800a9b:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a9e:	89 f0                	mov    %esi,%eax
+  800aa0:	eb 0f                	jmp    800ab1 <strncpy+0x23>
+  800aa2:	83 c0 01             	add    $0x1,%eax
+  800aa5:	0f b6 0a             	movzbl (%edx),%ecx
+  800aa8:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800aab:	80 f9 01             	cmp    $0x1,%cl
+  800aae:	83 da ff             	sbb    $0xffffffff,%edx
+  800ab1:	39 d8                	cmp    %ebx,%eax
+  800ab3:	75 ed                	jne    800aa2 <strncpy+0x14>
+  800ab5:	89 f0                	mov    %esi,%eax
+  800ab7:	5b                   	pop    %ebx
+  800ab8:	5e                   	pop    %esi
+  800ab9:	5d                   	pop    %ebp
+  800aba:	c3                   	ret
+
+00800abb <strlcpy>:
+  800abb:	55                   	push   %ebp
+  800abc:	89 e5                	mov    %esp,%ebp
+  800abe:	56                   	push   %esi
+  800abf:	53                   	push   %ebx
+  800ac0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ac3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ac6:	8b 55 10             	mov    0x10(%ebp),%edx
+  800ac9:	89 f0                	mov    %esi,%eax
+  800acb:	85 d2                	test   %edx,%edx
+  800acd:	74 21                	je     800af0 <strlcpy+0x35>
+  800acf:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800ad3:	89 f2                	mov    %esi,%edx
+  800ad5:	eb 09                	jmp    800ae0 <strlcpy+0x25>
+  800ad7:	83 c1 01             	add    $0x1,%ecx
+  800ada:	83 c2 01             	add    $0x1,%edx
+  800add:	88 5a ff             	mov    %bl,-0x1(%edx)
+  800ae0:	39 c2                	cmp    %eax,%edx
+  800ae2:	74 09                	je     800aed <strlcpy+0x32>
+  800ae4:	0f b6 19             	movzbl (%ecx),%ebx
+  800ae7:	84 db                	test   %bl,%bl
+  800ae9:	75 ec                	jne    800ad7 <strlcpy+0x1c>
+  800aeb:	89 d0                	mov    %edx,%eax
+  800aed:	c6 00 00             	movb   $0x0,(%eax)
+  800af0:	29 f0                	sub    %esi,%eax
+  800af2:	5b                   	pop    %ebx
+  800af3:	5e                   	pop    %esi
+  800af4:	5d                   	pop    %ebp
+  800af5:	c3                   	ret
+
+00800af6 <strcmp>:
+  800af6:	55                   	push   %ebp
+  800af7:	89 e5                	mov    %esp,%ebp
+  800af9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800afc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aff:	eb 06                	jmp    800b07 <strcmp+0x11>
+  800b01:	83 c1 01             	add    $0x1,%ecx
+  800b04:	83 c2 01             	add    $0x1,%edx
+  800b07:	0f b6 01             	movzbl (%ecx),%eax
+  800b0a:	84 c0                	test   %al,%al
+  800b0c:	74 04                	je     800b12 <strcmp+0x1c>
+  800b0e:	3a 02                	cmp    (%edx),%al
+  800b10:	74 ef                	je     800b01 <strcmp+0xb>
+  800b12:	0f b6 c0             	movzbl %al,%eax
+  800b15:	0f b6 12             	movzbl (%edx),%edx
+  800b18:	29 d0                	sub    %edx,%eax
+  800b1a:	5d                   	pop    %ebp
+  800b1b:	c3                   	ret
+
+00800b1c <strncmp>:
+  800b1c:	55                   	push   %ebp
+  800b1d:	89 e5                	mov    %esp,%ebp
+  800b1f:	53                   	push   %ebx
+  800b20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b26:	8b 55 10             	mov    0x10(%ebp),%edx
+  800b29:	eb 09                	jmp    800b34 <strncmp+0x18>
+  800b2b:	83 ea 01             	sub    $0x1,%edx
+  800b2e:	83 c0 01             	add    $0x1,%eax
+  800b31:	83 c1 01             	add    $0x1,%ecx
+  800b34:	85 d2                	test   %edx,%edx
+  800b36:	74 18                	je     800b50 <strncmp+0x34>
+  800b38:	0f b6 18             	movzbl (%eax),%ebx
+  800b3b:	84 db                	test   %bl,%bl
+  800b3d:	74 04                	je     800b43 <strncmp+0x27>
+  800b3f:	3a 19                	cmp    (%ecx),%bl
+  800b41:	74 e8                	je     800b2b <strncmp+0xf>
+  800b43:	0f b6 00             	movzbl (%eax),%eax
+  800b46:	0f b6 11             	movzbl (%ecx),%edx
+  800b49:	29 d0                	sub    %edx,%eax
+  800b4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b4e:	c9                   	leave
+  800b4f:	c3                   	ret
+  800b50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b55:	eb f4                	jmp    800b4b <strncmp+0x2f>
+
+00800b57 <strchr>:
+  800b57:	55                   	push   %ebp
+  800b58:	89 e5                	mov    %esp,%ebp
+  800b5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800b61:	eb 03                	jmp    800b66 <strchr+0xf>
+  800b63:	83 c0 01             	add    $0x1,%eax
+  800b66:	0f b6 10             	movzbl (%eax),%edx
+  800b69:	84 d2                	test   %dl,%dl
+  800b6b:	74 06                	je     800b73 <strchr+0x1c>
+  800b6d:	38 ca                	cmp    %cl,%dl
+  800b6f:	75 f2                	jne    800b63 <strchr+0xc>
+  800b71:	eb 05                	jmp    800b78 <strchr+0x21>
+  800b73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b78:	5d                   	pop    %ebp
+  800b79:	c3                   	ret
+
+00800b7a <strfind>:
+  800b7a:	55                   	push   %ebp
+  800b7b:	89 e5                	mov    %esp,%ebp
+  800b7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b80:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800b84:	0f b6 10             	movzbl (%eax),%edx
+  800b87:	38 ca                	cmp    %cl,%dl
+  800b89:	74 09                	je     800b94 <strfind+0x1a>
+  800b8b:	84 d2                	test   %dl,%dl
+  800b8d:	74 05                	je     800b94 <strfind+0x1a>
+  800b8f:	83 c0 01             	add    $0x1,%eax
+  800b92:	eb f0                	jmp    800b84 <strfind+0xa>
+  800b94:	5d                   	pop    %ebp
+  800b95:	c3                   	ret
+
+00800b96 <memset>:
+  800b96:	55                   	push   %ebp
+  800b97:	89 e5                	mov    %esp,%ebp
+  800b99:	57                   	push   %edi
+  800b9a:	56                   	push   %esi
+  800b9b:	53                   	push   %ebx
+  800b9c:	83 ec 04             	sub    $0x4,%esp
+  800b9f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ba2:	8b 55 10             	mov    0x10(%ebp),%edx
+  800ba5:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  800ba9:	89 f7                	mov    %esi,%edi
+  800bab:	83 fa 0f             	cmp    $0xf,%edx
+  800bae:	76 24                	jbe    800bd4 <memset+0x3e>
+  800bb0:	89 f1                	mov    %esi,%ecx
+  800bb2:	f7 d9                	neg    %ecx
+  800bb4:	83 e1 03             	and    $0x3,%ecx
+  800bb7:	29 ca                	sub    %ecx,%edx
+  800bb9:	89 d0                	mov    %edx,%eax
+  800bbb:	c1 e8 02             	shr    $0x2,%eax
+  800bbe:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  800bc1:	83 e2 03             	and    $0x3,%edx
+  800bc4:	89 d8                	mov    %ebx,%eax
+  800bc6:	fc                   	cld
+  800bc7:	f3 aa                	rep stos %al,%es:(%edi)
+  800bc9:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  800bcf:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  800bd2:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bd4:	89 d1                	mov    %edx,%ecx
+  800bd6:	89 d8                	mov    %ebx,%eax
+  800bd8:	fc                   	cld
+  800bd9:	f3 aa                	rep stos %al,%es:(%edi)
+  800bdb:	89 f0                	mov    %esi,%eax
+  800bdd:	83 c4 04             	add    $0x4,%esp
+  800be0:	5b                   	pop    %ebx
+  800be1:	5e                   	pop    %esi
+  800be2:	5f                   	pop    %edi
+  800be3:	5d                   	pop    %ebp
+  800be4:	c3                   	ret
+
+00800be5 <memmove>:
+  800be5:	55                   	push   %ebp
+  800be6:	89 e5                	mov    %esp,%ebp
+  800be8:	57                   	push   %edi
+  800be9:	56                   	push   %esi
+  800bea:	53                   	push   %ebx
+  800beb:	83 ec 0c             	sub    $0xc,%esp
+  800bee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800bf1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bf4:	8b 45 10             	mov    0x10(%ebp),%eax
+  800bf7:	85 c0                	test   %eax,%eax
+  800bf9:	74 14                	je     800c0f <memmove+0x2a>
+  800bfb:	39 da                	cmp    %ebx,%edx
+  800bfd:	73 07                	jae    800c06 <memmove+0x21>
+  800bff:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  800c02:	39 cb                	cmp    %ecx,%ebx
+  800c04:	72 13                	jb     800c19 <memmove+0x34>
+  800c06:	89 c1                	mov    %eax,%ecx
+  800c08:	89 d8                	mov    %ebx,%eax
+  800c0a:	e8 94 fd ff ff       	call   8009a3 <copy_fwd>
+  800c0f:	89 d8                	mov    %ebx,%eax
+  800c11:	83 c4 0c             	add    $0xc,%esp
+  800c14:	5b                   	pop    %ebx
+  800c15:	5e                   	pop    %esi
+  800c16:	5f                   	pop    %edi
+  800c17:	5d                   	pop    %ebp
+  800c18:	c3                   	ret
+  800c19:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800c1c:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800c1f:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800c22:	83 f8 0f             	cmp    $0xf,%eax
+  800c25:	76 23                	jbe    800c4a <memmove+0x65>
+  800c27:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800c2a:	83 e1 03             	and    $0x3,%ecx
+  800c2d:	29 c8                	sub    %ecx,%eax
+  800c2f:	89 c2                	mov    %eax,%edx
+  800c31:	c1 ea 02             	shr    $0x2,%edx
+  800c34:	83 e0 03             	and    $0x3,%eax
+  800c37:	fd                   	std
+  800c38:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c3a:	83 ef 03             	sub    $0x3,%edi
+  800c3d:	83 ee 03             	sub    $0x3,%esi
+  800c40:	89 d1                	mov    %edx,%ecx
+  800c42:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c44:	83 c7 03             	add    $0x3,%edi
+  800c47:	83 c6 03             	add    $0x3,%esi
+  800c4a:	89 c1                	mov    %eax,%ecx
+  800c4c:	fd                   	std
+  800c4d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c4f:	fc                   	cld
+  800c50:	eb bd                	jmp    800c0f <memmove+0x2a>
+
+00800c52 <memcpy>:
+  800c52:	55                   	push   %ebp
+  800c53:	89 e5                	mov    %esp,%ebp
+  800c55:	53                   	push   %ebx
+  800c56:	83 ec 04             	sub    $0x4,%esp
+  800c59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800c5c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800c5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c62:	89 d8                	mov    %ebx,%eax
+  800c64:	e8 3a fd ff ff       	call   8009a3 <copy_fwd>
+  800c69:	89 d8                	mov    %ebx,%eax
+  800c6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c6e:	c9                   	leave
+  800c6f:	c3                   	ret
+
+00800c70 <page_copy>:
+  800c70:	55                   	push   %ebp
+  800c71:	89 e5                	mov    %esp,%ebp
+  800c73:	57                   	push   %edi
+  800c74:	56                   	push   %esi
+  800c75:	53                   	push   %ebx
+  800c76:	83 ec 0c             	sub    $0xc,%esp
+  800c79:	e8 5c fd ff ff       	call   8009da <have_sse2>
+  800c7e:	85 c0                	test   %eax,%eax
+  800c80:	74 39                	je     800cbb <page_copy+0x4b>
+  800c82:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c85:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c88:	be 00 01 00 00       	mov    $0x100,%esi
+  800c8d:	8b 03                	mov    (%ebx),%eax
+  800c8f:	8b 53 04             	mov    0x4(%ebx),%edx
+  800c92:	0f c3 01             	movnti %eax,(%ecx)
+  800c95:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800c99:	8b 43 08             	mov    0x8(%ebx),%eax
+  800c9c:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800c9f:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800ca3:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800ca7:	83 c3 10             	add    $0x10,%ebx
+  800caa:	83 c1 10             	add    $0x10,%ecx
+  800cad:	4e                   	dec    %esi
+  800cae:	75 dd                	jne    800c8d <page_copy+0x1d>
+  800cb0:	0f ae f8             	sfence
+  800cb3:	83 c4 0c             	add    $0xc,%esp
+  800cb6:	5b                   	pop    %ebx
+  800cb7:	5e                   	pop    %esi
+  800cb8:	5f                   	pop    %edi
+  800cb9:	5d                   	pop    %ebp
+  800cba:	c3                   	ret
+  800cbb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800cbe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800cc1:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800cc6:	fc                   	cld
+  800cc7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800cc9:	eb e8                	jmp    800cb3 <page_copy+0x43>
+
+00800ccb <page_zero>:
+  800ccb:	55                   	push   %ebp
+  800ccc:	89 e5                	mov    %esp,%ebp
+  800cce:	57                   	push   %edi
+  800ccf:	83 ec 04             	sub    $0x4,%esp
+  800cd2:	e8 03 fd ff ff       	call   8009da <have_sse2>
+  800cd7:	85 c0                	test   %eax,%eax
+  800cd9:	74 3a                	je     800d15 <page_zero+0x4a>
+  800cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cde:	ba 80 00 00 00       	mov    $0x80,%edx
+  800ce3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce8:	0f c3 08             	movnti %ecx,(%eax)
+  800ceb:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800cef:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800cf3:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800cf7:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800cfb:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800cff:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800d03:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800d07:	83 c0 20             	add    $0x20,%eax
+  800d0a:	4a                   	dec    %edx
+  800d0b:	75 db                	jne    800ce8 <page_zero+0x1d>
+  800d0d:	0f ae f8             	sfence
+  800d10:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d13:	c9                   	leave
+  800d14:	c3                   	ret
+  800d15:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d18:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800d1d:	fc                   	cld
+  800d1e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d20:	eb ee                	jmp    800d10 <page_zero+0x45>
+
+00800d22 <memcmp>:
+  800d22:	55                   	push   %ebp
+  800d23:	89 e5                	mov    %esp,%ebp
+  800d25:	56                   	push   %esi
+  800d26:	53                   	push   %ebx
+  800d27:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d2a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d2d:	89 c6                	mov    %eax,%esi
+  800d2f:	03 75 10             	add    0x10(%ebp),%esi
+  800d32:	eb 06                	jmp    800d3a <memcmp+0x18>
+  800d34:	83 c0 01             	add    $0x1,%eax
+  800d37:	83 c2 01             	add    $0x1,%edx
+  800d3a:	39 f0                	cmp    %esi,%eax
+  800d3c:	74 14                	je     800d52 <memcmp+0x30>
+  800d3e:	0f b6 08             	movzbl (%eax),%ecx
+  800d41:	0f b6 1a             	movzbl (%edx),%ebx
+  800d44:	38 d9                	cmp    %bl,%cl
+  800d46:	74 ec                	je     800d34 <memcmp+0x12>
+  800d48:	0f b6 c1             	movzbl %cl,%eax
+  800d4b:	0f b6 db             	movzbl %bl,%ebx
+  800d4e:	29 d8                	sub    %ebx,%eax
+  800d50:	eb 05                	jmp    800d57 <memcmp+0x35>
+  800d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d57:	5b                   	pop    %ebx
+  800d58:	5e                   	pop    %esi
+  800d59:	5d                   	pop    %ebp
+  800d5a:	c3                   	ret
+
+00800d5b <memfind>:
+  800d5b:	55                   	push   %ebp
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d64:	89 c2                	mov    %eax,%edx
+  800d66:	03 55 10             	add    0x10(%ebp),%edx
+  800d69:	eb 03                	jmp    800d6e <memfind+0x13>
+  800d6b:	83 c0 01             	add    $0x1,%eax
+  800d6e:	39 d0                	cmp    %edx,%eax
+  800d70:	73 04                	jae    800d76 <memfind+0x1b>
+  800d72:	38 08                	cmp    %cl,(%eax)
+  800d74:	75 f5                	jne    800d6b <memfind+0x10>
+  800d76:	5d                   	pop    %ebp
+  800d77:	c3                   	ret
+
+00800d78 <strtol>:
+  800d78:	55                   	push   %ebp
+  800d79:	89 e5                	mov    %esp,%ebp
+  800d7b:	57                   	push   %edi
+  800d7c:	56                   	push   %esi
+  800d7d:	53                   	push   %ebx
+  800d7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d84:	eb 03                	jmp    800d89 <strtol+0x11>
+  800d86:	83 c2 01             	add    $0x1,%edx
+  800d89:	0f b6 02             	movzbl (%edx),%eax
+  800d8c:	3c 20                	cmp    $0x20,%al
+  800d8e:	74 f6                	je     800d86 <strtol+0xe>
+  800d90:	3c 09                	cmp    $0x9,%al
+  800d92:	74 f2                	je     800d86 <strtol+0xe>
+  800d94:	3c 2b                	cmp    $0x2b,%al
+  800d96:	74 2a                	je     800dc2 <strtol+0x4a>
+  800d98:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d9d:	3c 2d                	cmp    $0x2d,%al
+  800d9f:	74 2b                	je     800dcc <strtol+0x54>
+  800da1:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800da7:	75 0f                	jne    800db8 <strtol+0x40>
+  800da9:	80 3a 30             	cmpb   $0x30,(%edx)
+  800dac:	74 28                	je     800dd6 <strtol+0x5e>
+  800dae:	85 db                	test   %ebx,%ebx
+  800db0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800db5:	0f 44 d8             	cmove  %eax,%ebx
+  800db8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dbd:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800dc0:	eb 46                	jmp    800e08 <strtol+0x90>
+  800dc2:	83 c2 01             	add    $0x1,%edx
+  800dc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dca:	eb d5                	jmp    800da1 <strtol+0x29>
+  800dcc:	83 c2 01             	add    $0x1,%edx
+  800dcf:	bf 01 00 00 00       	mov    $0x1,%edi
+  800dd4:	eb cb                	jmp    800da1 <strtol+0x29>
+  800dd6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800dda:	74 0e                	je     800dea <strtol+0x72>
+  800ddc:	85 db                	test   %ebx,%ebx
+  800dde:	75 d8                	jne    800db8 <strtol+0x40>
+  800de0:	83 c2 01             	add    $0x1,%edx
+  800de3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800de8:	eb ce                	jmp    800db8 <strtol+0x40>
+  800dea:	83 c2 02             	add    $0x2,%edx
+  800ded:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800df2:	eb c4                	jmp    800db8 <strtol+0x40>
+  800df4:	0f be c0             	movsbl %al,%eax
+  800df7:	83 e8 30             	sub    $0x30,%eax
+  800dfa:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800dfd:	7d 3a                	jge    800e39 <strtol+0xc1>
+  800dff:	83 c2 01             	add    $0x1,%edx
+  800e02:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e06:	01 c1                	add    %eax,%ecx
+  800e08:	0f b6 02             	movzbl (%edx),%eax
+  800e0b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e0e:	89 f3                	mov    %esi,%ebx
+  800e10:	80 fb 09             	cmp    $0x9,%bl
+  800e13:	76 df                	jbe    800df4 <strtol+0x7c>
+  800e15:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e18:	89 f3                	mov    %esi,%ebx
+  800e1a:	80 fb 19             	cmp    $0x19,%bl
+  800e1d:	77 08                	ja     800e27 <strtol+0xaf>
+  800e1f:	0f be c0             	movsbl %al,%eax
+  800e22:	83 e8 57             	sub    $0x57,%eax
+  800e25:	eb d3                	jmp    800dfa <strtol+0x82>
+  800e27:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e2a:	89 f3                	mov    %esi,%ebx
+  800e2c:	80 fb 19             	cmp    $0x19,%bl
+  800e2f:	77 08                	ja     800e39 <strtol+0xc1>
+  800e31:	0f be c0             	movsbl %al,%eax
+  800e34:	83 e8 37             	sub    $0x37,%eax
+  800e37:	eb c1                	jmp    800dfa <strtol+0x82>
+  800e39:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e3d:	74 05                	je     800e44 <strtol+0xcc>
+  800e3f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e42:	89 10                	mov    %edx,(%eax)
+  800e44:	89 c8                	mov    %ecx,%eax
+  800e46:	f7 d8                	neg    %eax
+  800e48:	85 ff                	test   %edi,%edi
+  800e4a:	0f 45 c8             	cmovne %eax,%ecx
+  800e4d:	89 c8                	mov    %ecx,%eax
+  800e4f:	5b                   	pop    %ebx
+  800e50:	5e                   	pop    %esi
+  800e51:	5f                   	pop    %edi
+  800e52:	5d                   	pop    %ebp
+  800e53:	c3                   	ret
+
+00800e54 <sys_cputs>:
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	57                   	push   %edi
+  800e58:	56                   	push   %esi
+  800e59:	53                   	push   %ebx
+  800e5a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e61:	78 21                	js     800e84 <sys_cputs+0x30>
+  800e63:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e6a:	75 2d                	jne    800e99 <sys_cputs+0x45>
+  800e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e77:	89 c3                	mov    %eax,%ebx
+  800e79:	89 c7                	mov    %eax,%edi
+  800e7b:	89 c6                	mov    %eax,%esi
+  800e7d:	cd 30                	int    $0x30
+  800e7f:	5b                   	pop    %ebx
+  800e80:	5e                   	pop    %esi
+  800e81:	5f                   	pop    %edi
+  800e82:	5d                   	pop    %ebp
+  800e83:	c3                   	ret
+  800e84:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e89:	0f a2                	cpuid
+  800e8b:	c1 ea 0b             	shr    $0xb,%edx
+  800e8e:	83 e2 01             	and    $0x1,%edx
+  800e91:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800e97:	eb ca                	jmp    800e63 <sys_cputs+0xf>
+  800e99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea4:	89 c3                	mov    %eax,%ebx
+  800ea6:	89 c7                	mov    %eax,%edi
+  800ea8:	89 c6                	mov    %eax,%esi
+  800eaa:	55                   	push   %ebp
+  800eab:	68 b4 0e 80 00       	push   $0x800eb4
+  800eb0:	89 e5                	mov    %esp,%ebp
+  800eb2:	0f 34                	sysenter
+  800eb4:	83 c4 04             	add    $0x4,%esp
+  800eb7:	5d                   	pop    %ebp
+  800eb8:	eb c5                	jmp    800e7f <sys_cputs+0x2b>
+
+00800eba <sys_cgetc>:
+  800eba:	55                   	push   %ebp
+  800ebb:	89 e5                	mov    %esp,%ebp
+  800ebd:	57                   	push   %edi
+  800ebe:	56                   	push   %esi
+  800ebf:	53                   	push   %ebx
+  800ec0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ec7:	78 22                	js     800eeb <sys_cgetc+0x31>
+  800ec9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ed0:	75 2e                	jne    800f00 <sys_cgetc+0x46>
+  800ed2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800edc:	89 d1                	mov    %edx,%ecx
+  800ede:	89 d3                	mov    %edx,%ebx
+  800ee0:	89 d7                	mov    %edx,%edi
+  800ee2:	89 d6                	mov    %edx,%esi
+  800ee4:	cd 30                	int    $0x30
+  800ee6:	5b                   	pop    %ebx
+  800ee7:	5e                   	pop    %esi
+  800ee8:	5f                   	pop    %edi
+  800ee9:	5d                   	pop    %ebp
+  800eea:	c3                   	ret
+  800eeb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ef0:	0f a2                	cpuid
+  800ef2:	c1 ea 0b             	shr    $0xb,%edx
+  800ef5:	83 e2 01             	and    $0x1,%edx
+  800ef8:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800efe:	eb c9                	jmp    800ec9 <sys_cgetc+0xf>
+  800f00:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f05:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f0a:	89 d1                	mov    %edx,%ecx
+  800f0c:	89 d3                	mov    %edx,%ebx
+  800f0e:	89 d7                	mov    %edx,%edi
+  800f10:	89 d6                	mov    %edx,%esi
+  800f12:	55                   	push   %ebp
+  800f13:	68 1c 0f 80 00       	push   $0x800f1c
+  800f18:	89 e5                	mov    %esp,%ebp
+  800f1a:	0f 34                	sysenter
+  800f1c:	83 c4 04             	add    $0x4,%esp
+  800f1f:	5d                   	pop    %ebp
+  800f20:	eb c4                	jmp    800ee6 <sys_cgetc+0x2c>
+
+00800f22 <sys_env_destroy>:
+  800f22:	55                   	push   %ebp
+  800f23:	89 e5                	mov    %esp,%ebp
+  800f25:	57                   	push   %edi
+  800f26:	56                   	push   %esi
+  800f27:	53                   	push   %ebx
+  800f28:	83 ec 0c             	sub    $0xc,%esp
+  800f2b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f32:	78 2a                	js     800f5e <sys_env_destroy+0x3c>
+  800f34:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f3b:	75 36                	jne    800f73 <sys_env_destroy+0x51>
+  800f3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f42:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4a:	89 cb                	mov    %ecx,%ebx
+  800f4c:	89 cf                	mov    %ecx,%edi
+  800f4e:	89 ce                	mov    %ecx,%esi
+  800f50:	cd 30                	int    $0x30
+  800f52:	85 c0                	test   %eax,%eax
+  800f54:	7f 40                	jg     800f96 <sys_env_destroy+0x74>
+  800f56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f59:	5b                   	pop    %ebx
+  800f5a:	5e                   	pop    %esi
+  800f5b:	5f                   	pop    %edi
+  800f5c:	5d                   	pop    %ebp
+  800f5d:	c3                   	ret
+  800f5e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f63:	0f a2                	cpuid
+  800f65:	c1 ea 0b             	shr    $0xb,%edx
+  800f68:	83 e2 01             	and    $0x1,%edx
+  800f6b:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800f71:	eb c1                	jmp    800f34 <sys_env_destroy+0x12>
+  800f73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f7b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f80:	89 cb                	mov    %ecx,%ebx
+  800f82:	89 cf                	mov    %ecx,%edi
+  800f84:	89 ce                	mov    %ecx,%esi
+  800f86:	55                   	push   %ebp
+  800f87:	68 90 0f 80 00       	push   $0x800f90
+  800f8c:	89 e5                	mov    %esp,%ebp
+  800f8e:	0f 34                	sysenter
+  800f90:	83 c4 04             	add    $0x4,%esp
+  800f93:	5d                   	pop    %ebp
+  800f94:	eb bc                	jmp    800f52 <sys_env_destroy+0x30>
+  800f96:	83 ec 0c             	sub    $0xc,%esp
+  800f99:	50                   	push   %eax
+  800f9a:	6a 03                	push   $0x3
+  800f9c:	68 44 20 80 00       	push   $0x802044
+  800fa1:	6a 49                	push   $0x49
+  800fa3:	68 61 20 80 00       	push   $0x802061
+  800fa8:	e8 63 f3 ff ff       	call   800310 <_panic>
+
+00800fad <sys_getenvid>:
+  800fad:	55                   	push   %ebp
+  800fae:	89 e5                	mov    %esp,%ebp
+  800fb0:	57                   	push   %edi
+  800fb1:	56                   	push   %esi
+  800fb2:	53                   	push   %ebx
+  800fb3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800fba:	78 22                	js     800fde <sys_getenvid+0x31>
+  800fbc:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800fc3:	75 2e                	jne    800ff3 <sys_getenvid+0x46>
+  800fc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fca:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fcf:	89 d1                	mov    %edx,%ecx
+  800fd1:	89 d3                	mov    %edx,%ebx
+  800fd3:	89 d7                	mov    %edx,%edi
+  800fd5:	89 d6                	mov    %edx,%esi
+  800fd7:	cd 30                	int    $0x30
+  800fd9:	5b                   	pop    %ebx
+  800fda:	5e                   	pop    %esi
+  800fdb:	5f                   	pop    %edi
+  800fdc:	5d                   	pop    %ebp
+  800fdd:	c3                   	ret
+  800fde:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fe3:	0f a2                	cpuid
+  800fe5:	c1 ea 0b             	shr    $0xb,%edx
+  800fe8:	83 e2 01             	and    $0x1,%edx
+  800feb:	89 15 08 30 80 00    	mov    %edx,0x803008
+  800ff1:	eb c9                	jmp    800fbc <sys_getenvid+0xf>
+  800ff3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff8:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ffd:	89 d1                	mov    %edx,%ecx
+  800fff:	89 d3                	mov    %edx,%ebx
+  801001:	89 d7                	mov    %edx,%edi
+  801003:	89 d6                	mov    %edx,%esi
+  801005:	55                   	push   %ebp
+  801006:	68 0f 10 80 00       	push   $0x80100f
+  80100b:	89 e5                	mov    %esp,%ebp
+  80100d:	0f 34                	sysenter
+  80100f:	83 c4 04             	add    $0x4,%esp
+  801012:	5d                   	pop    %ebp
+  801013:	eb c4                	jmp    800fd9 <sys_getenvid+0x2c>
+
+00801015 <sys_yield>:
+  801015:	55                   	push   %ebp
+  801016:	89 e5                	mov    %esp,%ebp
+  801018:	57                   	push   %edi
+  801019:	56                   	push   %esi
+  80101a:	53                   	push   %ebx
+  80101b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801022:	78 22                	js     801046 <sys_yield+0x31>
+  801024:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80102b:	75 2e                	jne    80105b <sys_yield+0x46>
+  80102d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801032:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801037:	89 d1                	mov    %edx,%ecx
+  801039:	89 d3                	mov    %edx,%ebx
+  80103b:	89 d7                	mov    %edx,%edi
+  80103d:	89 d6                	mov    %edx,%esi
+  80103f:	cd 30                	int    $0x30
+  801041:	5b                   	pop    %ebx
+  801042:	5e                   	pop    %esi
+  801043:	5f                   	pop    %edi
+  801044:	5d                   	pop    %ebp
+  801045:	c3                   	ret
+  801046:	b8 01 00 00 00       	mov    $0x1,%eax
+  80104b:	0f a2                	cpuid
+  80104d:	c1 ea 0b             	shr    $0xb,%edx
+  801050:	83 e2 01             	and    $0x1,%edx
+  801053:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801059:	eb c9                	jmp    801024 <sys_yield+0xf>
+  80105b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801060:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801065:	89 d1                	mov    %edx,%ecx
+  801067:	89 d3                	mov    %edx,%ebx
+  801069:	89 d7                	mov    %edx,%edi
+  80106b:	89 d6                	mov    %edx,%esi
+  80106d:	55                   	push   %ebp
+  80106e:	68 77 10 80 00       	push   $0x801077
+  801073:	89 e5                	mov    %esp,%ebp
+  801075:	0f 34                	sysenter
+  801077:	83 c4 04             	add    $0x4,%esp
+  80107a:	5d                   	pop    %ebp
+  80107b:	eb c4                	jmp    801041 <sys_yield+0x2c>
+
+0080107d <sys_env_set_cow>:
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+  801080:	57                   	push   %edi
+  801081:	56                   	push   %esi
+  801082:	53                   	push   %ebx
+  801083:	83 ec 0c             	sub    $0xc,%esp
+  801086:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80108d:	78 2b                	js     8010ba <sys_env_set_cow+0x3d>
+  80108f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801096:	75 37                	jne    8010cf <sys_env_set_cow+0x52>
+  801098:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a8:	89 df                	mov    %ebx,%edi
+  8010aa:	89 de                	mov    %ebx,%esi
+  8010ac:	cd 30                	int    $0x30
+  8010ae:	85 c0                	test   %eax,%eax
+  8010b0:	7f 41                	jg     8010f3 <sys_env_set_cow+0x76>
+  8010b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b5:	5b                   	pop    %ebx
+  8010b6:	5e                   	pop    %esi
+  8010b7:	5f                   	pop    %edi
+  8010b8:	5d                   	pop    %ebp
+  8010b9:	c3                   	ret
+  8010ba:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010bf:	0f a2                	cpuid
+  8010c1:	c1 ea 0b             	shr    $0xb,%edx
+  8010c4:	83 e2 01             	and    $0x1,%edx
+  8010c7:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8010cd:	eb c0                	jmp    80108f <sys_env_set_cow+0x12>
+  8010cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010da:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010df:	89 df                	mov    %ebx,%edi
+  8010e1:	89 de                	mov    %ebx,%esi
+  8010e3:	55                   	push   %ebp
+  8010e4:	68 ed 10 80 00       	push   $0x8010ed
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	0f 34                	sysenter
+  8010ed:	83 c4 04             	add    $0x4,%esp
+  8010f0:	5d                   	pop    %ebp
+  8010f1:	eb bb                	jmp    8010ae <sys_env_set_cow+0x31>
+  8010f3:	83 ec 0c             	sub    $0xc,%esp
+  8010f6:	50                   	push   %eax
+  8010f7:	6a 0d                	push   $0xd
+  8010f9:	68 44 20 80 00       	push   $0x802044
+  8010fe:	6a 49                	push   $0x49
+  801100:	68 61 20 80 00       	push   $0x802061
+  801105:	e8 06 f2 ff ff       	call   800310 <_panic>
+
+0080110a <sys_env_set_quota>:
+  80110a:	55                   	push   %ebp
+  80110b:	89 e5                	mov    %esp,%ebp
+  80110d:	57                   	push   %edi
+  80110e:	56                   	push   %esi
+  80110f:	53                   	push   %ebx
+  801110:	83 ec 0c             	sub    $0xc,%esp
+  801113:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80111a:	78 2b                	js     801147 <sys_env_set_quota+0x3d>
+  80111c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801123:	75 37                	jne    80115c <sys_env_set_quota+0x52>
+  801125:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80112f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801132:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801135:	89 df                	mov    %ebx,%edi
+  801137:	89 de                	mov    %ebx,%esi
+  801139:	cd 30                	int    $0x30
+  80113b:	85 c0                	test   %eax,%eax
+  80113d:	7f 41                	jg     801180 <sys_env_set_quota+0x76>
+  80113f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801142:	5b                   	pop    %ebx
+  801143:	5e                   	pop    %esi
+  801144:	5f                   	pop    %edi
+  801145:	5d                   	pop    %ebp
+  801146:	c3                   	ret
+  801147:	b8 01 00 00 00       	mov    $0x1,%eax
+  80114c:	0f a2                	cpuid
+  80114e:	c1 ea 0b             	shr    $0xb,%edx
+  801151:	83 e2 01             	and    $0x1,%edx
+  801154:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80115a:	eb c0                	jmp    80111c <sys_env_set_quota+0x12>
+  80115c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801161:	8b 55 08             	mov    0x8(%ebp),%edx
+  801164:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801167:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80116c:	89 df                	mov    %ebx,%edi
+  80116e:	89 de                	mov    %ebx,%esi
+  801170:	55                   	push   %ebp
+  801171:	68 7a 11 80 00       	push   $0x80117a
+  801176:	89 e5                	mov    %esp,%ebp
+  801178:	0f 34                	sysenter
+  80117a:	83 c4 04             	add    $0x4,%esp
+  80117d:	5d                   	pop    %ebp
+  80117e:	eb bb                	jmp    80113b <sys_env_set_quota+0x31>
+  801180:	83 ec 0c             	sub    $0xc,%esp
+  801183:	50                   	push   %eax
+  801184:	6a 0f                	push   $0xf
+  801186:	68 44 20 80 00       	push   $0x802044
+  80118b:	6a 49                	push   $0x49
+  80118d:	68 61 20 80 00       	push   $0x802061
+  801192:	e8 79 f1 ff ff       	call   800310 <_panic>
+
+00801197 <sys_page_alloc>:
+  801197:	55                   	push   %ebp
+  801198:	89 e5                	mov    %esp,%ebp
+  80119a:	57                   	push   %edi
+  80119b:	56                   	push   %esi
+  80119c:	53                   	push   %ebx
+  80119d:	83 ec 0c             	sub    $0xc,%esp
+  8011a0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8011a7:	78 2c                	js     8011d5 <sys_page_alloc+0x3e>
+  8011a9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8011b0:	75 38                	jne    8011ea <sys_page_alloc+0x53>
+  8011b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c5:	89 f7                	mov    %esi,%edi
+  8011c7:	cd 30                	int    $0x30
+  8011c9:	85 c0                	test   %eax,%eax
+  8011cb:	7f 42                	jg     80120f <sys_page_alloc+0x78>
+  8011cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d0:	5b                   	pop    %ebx
+  8011d1:	5e                   	pop    %esi
+  8011d2:	5f                   	pop    %edi
+  8011d3:	5d                   	pop    %ebp
+  8011d4:	c3                   	ret
+  8011d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011da:	0f a2                	cpuid
+  8011dc:	c1 ea 0b             	shr    $0xb,%edx
+  8011df:	83 e2 01             	and    $0x1,%edx
+  8011e2:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8011e8:	eb bf                	jmp    8011a9 <sys_page_alloc+0x12>
+  8011ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011fd:	89 f7                	mov    %esi,%edi
+  8011ff:	55                   	push   %ebp
+  801200:	68 09 12 80 00       	push   $0x801209
+  801205:	89 e5                	mov    %esp,%ebp
+  801207:	0f 34                	sysenter
+  801209:	83 c4 04             	add    $0x4,%esp
+  80120c:	5d                   	pop    %ebp
+  80120d:	eb ba                	jmp    8011c9 <sys_page_alloc+0x32>
+  80120f:	83 ec 0c             	sub    $0xc,%esp
+  801212:	50                   	push   %eax
+  801213:	6a 04                	push   $0x4
+  801215:	68 44 20 80 00       	push   $0x802044
+  80121a:	6a 49                	push   $0x49
+  80121c:	68 61 20 80 00       	push   $0x802061
+  801221:	e8 ea f0 ff ff       	call   800310 <_panic>
+
+00801226 <sys_page_map>:
+  801226:	55                   	push   %ebp
+  801227:	89 e5                	mov    %esp,%ebp
+  801229:	57                   	push   %edi
+  80122a:	56                   	push   %esi
+  80122b:	53                   	push   %ebx
+  80122c:	83 ec 0c             	sub    $0xc,%esp
+  80122f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801236:	78 2b                	js     801263 <sys_page_map+0x3d>
+  801238:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80123f:	75 37                	jne    801278 <sys_page_map+0x52>
+  801241:	b8 05 00 00 00       	mov    $0x5,%eax
+  801246:	8b 55 08             	mov    0x8(%ebp),%edx
+  801249:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80124f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801252:	8b 75 18             	mov    0x18(%ebp),%esi
+  801255:	cd 30                	int    $0x30
+  801257:	85 c0                	test   %eax,%eax
+  801259:	7f 41                	jg     80129c <sys_page_map+0x76>
+  80125b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125e:	5b                   	pop    %ebx
+  80125f:	5e                   	pop    %esi
+  801260:	5f                   	pop    %edi
+  801261:	5d                   	pop    %ebp
+  801262:	c3                   	ret
+  801263:	b8 01 00 00 00       	mov    $0x1,%eax
+  801268:	0f a2                	cpuid
+  80126a:	c1 ea 0b             	shr    $0xb,%edx
+  80126d:	83 e2 01             	and    $0x1,%edx
+  801270:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801276:	eb c0                	jmp    801238 <sys_page_map+0x12>
+  801278:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801283:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801286:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801289:	8b 75 18             	mov    0x18(%ebp),%esi
+  80128c:	55                   	push   %ebp
+  80128d:	68 96 12 80 00       	push   $0x801296
+  801292:	89 e5                	mov    %esp,%ebp
+  801294:	0f 34                	sysenter
+  801296:	83 c4 04             	add    $0x4,%esp
+  801299:	5d                   	pop    %ebp
+  80129a:	eb bb                	jmp    801257 <sys_page_map+0x31>
+  80129c:	83 ec 0c             	sub    $0xc,%esp
+  80129f:	50                   	push   %eax
+  8012a0:	6a 05                	push   $0x5
+  8012a2:	68 44 20 80 00       	push   $0x802044
+  8012a7:	6a 49                	push   $0x49
+  8012a9:	68 61 20 80 00       	push   $0x802061
+  8012ae:	e8 5d f0 ff ff       	call   800310 <_panic>
+
+008012b3 <sys_page_unmap>:
+  8012b3:	55                   	push   %ebp
+  8012b4:	89 e5                	mov    %esp,%ebp
+  8012b6:	57                   	push   %edi
+  8012b7:	56                   	push   %esi
+  8012b8:	53                   	push   %ebx
+  8012b9:	83 ec 0c             	sub    $0xc,%esp
+  8012bc:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8012c3:	78 2b                	js     8012f0 <sys_page_unmap+0x3d>
+  8012c5:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8012cc:	75 37                	jne    801305 <sys_page_unmap+0x52>
+  8012ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d3:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012de:	89 df                	mov    %ebx,%edi
+  8012e0:	89 de                	mov    %ebx,%esi
+  8012e2:	cd 30                	int    $0x30
+  8012e4:	85 c0                	test   %eax,%eax
+  8012e6:	7f 41                	jg     801329 <sys_page_unmap+0x76>
+  8012e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012eb:	5b                   	pop    %ebx
+  8012ec:	5e                   	pop    %esi
+  8012ed:	5f                   	pop    %edi
+  8012ee:	5d                   	pop    %ebp
+  8012ef:	c3                   	ret
+  8012f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012f5:	0f a2                	cpuid
+  8012f7:	c1 ea 0b             	shr    $0xb,%edx
+  8012fa:	83 e2 01             	and    $0x1,%edx
+  8012fd:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801303:	eb c0                	jmp    8012c5 <sys_page_unmap+0x12>
+  801305:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801310:	b8 06 00 00 00       	mov    $0x6,%eax
+  801315:	89 df                	mov    %ebx,%edi
+  801317:	89 de                	mov    %ebx,%esi
+  801319:	55                   	push   %ebp
+  80131a:	68 23 13 80 00       	push   $0x801323
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	0f 34                	sysenter
+  801323:	83 c4 04             	add    $0x4,%esp
+  801326:	5d                   	pop    %ebp
+  801327:	eb bb                	jmp    8012e4 <sys_page_unmap+0x31>
+  801329:	83 ec 0c             	sub    $0xc,%esp
+  80132c:	50                   	push   %eax
+  80132d:	6a 06                	push   $0x6
+  80132f:	68 44 20 80 00       	push   $0x802044
+  801334:	6a 49                	push   $0x49
+  801336:	68 61 20 80 00       	push   $0x802061
+  80133b:	e8 d0 ef ff ff       	call   800310 <_panic>
+
+00801340 <sys_page_reuse>:
+  801340:	55                   	push   %ebp
+  801341:	89 e5                	mov    %esp,%ebp
+  801343:	57                   	push   %edi
+  801344:	56                   	push   %esi
+  801345:	53                   	push   %ebx
+  801346:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80134d:	78 24                	js     801373 <sys_page_reuse+0x33>
+  80134f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801356:	75 30                	jne    801388 <sys_page_reuse+0x48>
+  801358:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80135d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801362:	8b 55 08             	mov    0x8(%ebp),%edx
+  801365:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801368:	89 df                	mov    %ebx,%edi
+  80136a:	89 de                	mov    %ebx,%esi
+  80136c:	cd 30                	int    $0x30
+  80136e:	5b                   	pop    %ebx
+  80136f:	5e                   	pop    %esi
+  801370:	5f                   	pop    %edi
+  801371:	5d                   	pop    %ebp
+  801372:	c3                   	ret
+  801373:	b8 01 00 00 00       	mov    $0x1,%eax
+  801378:	0f a2                	cpuid
+  80137a:	c1 ea 0b             	shr    $0xb,%edx
+  80137d:	83 e2 01             	and    $0x1,%edx
+  801380:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801386:	eb c7                	jmp    80134f <sys_page_reuse+0xf>
+  801388:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801390:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801393:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801398:	89 df                	mov    %ebx,%edi
+  80139a:	89 de                	mov    %ebx,%esi
+  80139c:	55                   	push   %ebp
+  80139d:	68 a6 13 80 00       	push   $0x8013a6
+  8013a2:	89 e5                	mov    %esp,%ebp
+  8013a4:	0f 34                	sysenter
+  8013a6:	83 c4 04             	add    $0x4,%esp
+  8013a9:	5d                   	pop    %ebp
+  8013aa:	eb c2                	jmp    80136e <sys_page_reuse+0x2e>
+
+008013ac <sys_env_set_status>:
+  8013ac:	55                   	push   %ebp
+  8013ad:	89 e5                	mov    %esp,%ebp
+  8013af:	57                   	push   %edi
+  8013b0:	56                   	push   %esi
+  8013b1:	53                   	push   %ebx
+  8013b2:	83 ec 0c             	sub    $0xc,%esp
+  8013b5:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013bc:	78 2b                	js     8013e9 <sys_env_set_status+0x3d>
+  8013be:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013c5:	75 37                	jne    8013fe <sys_env_set_status+0x52>
+  8013c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013cc:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d7:	89 df                	mov    %ebx,%edi
+  8013d9:	89 de                	mov    %ebx,%esi
+  8013db:	cd 30                	int    $0x30
+  8013dd:	85 c0                	test   %eax,%eax
+  8013df:	7f 41                	jg     801422 <sys_env_set_status+0x76>
+  8013e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e4:	5b                   	pop    %ebx
+  8013e5:	5e                   	pop    %esi
+  8013e6:	5f                   	pop    %edi
+  8013e7:	5d                   	pop    %ebp
+  8013e8:	c3                   	ret
+  8013e9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013ee:	0f a2                	cpuid
+  8013f0:	c1 ea 0b             	shr    $0xb,%edx
+  8013f3:	83 e2 01             	and    $0x1,%edx
+  8013f6:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8013fc:	eb c0                	jmp    8013be <sys_env_set_status+0x12>
+  8013fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801403:	8b 55 08             	mov    0x8(%ebp),%edx
+  801406:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801409:	b8 08 00 00 00       	mov    $0x8,%eax
+  80140e:	89 df                	mov    %ebx,%edi
+  801410:	89 de                	mov    %ebx,%esi
+  801412:	55                   	push   %ebp
+  801413:	68 1c 14 80 00       	push   $0x80141c
+  801418:	89 e5                	mov    %esp,%ebp
+  80141a:	0f 34                	sysenter
+  80141c:	83 c4 04             	add    $0x4,%esp
+  80141f:	5d                   	pop    %ebp
+  801420:	eb bb                	jmp    8013dd <sys_env_set_status+0x31>
+  801422:	83 ec 0c             	sub    $0xc,%esp
+  801425:	50                   	push   %eax
+  801426:	6a 08                	push   $0x8
+  801428:	68 44 20 80 00       	push   $0x802044
+  80142d:	6a 49                	push   $0x49
+  80142f:	68 61 20 80 00       	push   $0x802061
+  801434:	e8 d7 ee ff ff       	call   800310 <_panic>
+
+00801439 <sys_env_set_pgfault_upcall>:
+  801439:	55                   	push   %ebp
+  80143a:	89 e5                	mov    %esp,%ebp
+  80143c:	57                   	push   %edi
+  80143d:	56                   	push   %esi
+  80143e:	53                   	push   %ebx
+  80143f:	83 ec 0c             	sub    $0xc,%esp
+  801442:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801449:	78 2b                	js     801476 <sys_env_set_pgfault_upcall+0x3d>
+  80144b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801452:	75 37                	jne    80148b <sys_env_set_pgfault_upcall+0x52>
+  801454:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801459:	b8 09 00 00 00       	mov    $0x9,%eax
+  80145e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801461:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801464:	89 df                	mov    %ebx,%edi
+  801466:	89 de                	mov    %ebx,%esi
+  801468:	cd 30                	int    $0x30
+  80146a:	85 c0                	test   %eax,%eax
+  80146c:	7f 41                	jg     8014af <sys_env_set_pgfault_upcall+0x76>
+  80146e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801471:	5b                   	pop    %ebx
+  801472:	5e                   	pop    %esi
+  801473:	5f                   	pop    %edi
+  801474:	5d                   	pop    %ebp
+  801475:	c3                   	ret
+  801476:	b8 01 00 00 00       	mov    $0x1,%eax
+  80147b:	0f a2                	cpuid
+  80147d:	c1 ea 0b             	shr    $0xb,%edx
+  801480:	83 e2 01             	and    $0x1,%edx
+  801483:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801489:	eb c0                	jmp    80144b <sys_env_set_pgfault_upcall+0x12>
+  80148b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801490:	8b 55 08             	mov    0x8(%ebp),%edx
+  801493:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801496:	b8 09 00 00 00       	mov    $0x9,%eax
+  80149b:	89 df                	mov    %ebx,%edi
+  80149d:	89 de                	mov    %ebx,%esi
+  80149f:	55                   	push   %ebp
+  8014a0:	68 a9 14 80 00       	push   $0x8014a9
+  8014a5:	89 e5                	mov    %esp,%ebp
+  8014a7:	0f 34                	sysenter
+  8014a9:	83 c4 04             	add    $0x4,%esp
+  8014ac:	5d                   	pop    %ebp
+  8014ad:	eb bb                	jmp    80146a <sys_env_set_pgfault_upcall+0x31>
+  8014af:	83 ec 0c             	sub    $0xc,%esp
+  8014b2:	50                   	push   %eax
+  8014b3:	6a 09                	push   $0x9
+  8014b5:	68 44 20 80 00       	push   $0x802044
+  8014ba:	6a 49                	push   $0x49
+  8014bc:	68 61 20 80 00       	push   $0x802061
+  8014c1:	e8 4a ee ff ff       	call   800310 <_panic>
+
+008014c6 <sys_env_set_trace>:
+  8014c6:	55                   	push   %ebp
+  8014c7:	89 e5                	mov    %esp,%ebp
+  8014c9:	57                   	push   %edi
+  8014ca:	56                   	push   %esi
+  8014cb:	53                   	push   %ebx
+  8014cc:	83 ec 0c             	sub    $0xc,%esp
+  8014cf:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014d6:	78 2b                	js     801503 <sys_env_set_trace+0x3d>
+  8014d8:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8014df:	75 37                	jne    801518 <sys_env_set_trace+0x52>
+  8014e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8014eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f1:	89 df                	mov    %ebx,%edi
+  8014f3:	89 de                	mov    %ebx,%esi
+  8014f5:	cd 30                	int    $0x30
+  8014f7:	85 c0                	test   %eax,%eax
+  8014f9:	7f 41                	jg     80153c <sys_env_set_trace+0x76>
+  8014fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014fe:	5b                   	pop    %ebx
+  8014ff:	5e                   	pop    %esi
+  801500:	5f                   	pop    %edi
+  801501:	5d                   	pop    %ebp
+  801502:	c3                   	ret
+  801503:	b8 01 00 00 00       	mov    $0x1,%eax
+  801508:	0f a2                	cpuid
+  80150a:	c1 ea 0b             	shr    $0xb,%edx
+  80150d:	83 e2 01             	and    $0x1,%edx
+  801510:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801516:	eb c0                	jmp    8014d8 <sys_env_set_trace+0x12>
+  801518:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801520:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801523:	b8 12 00 00 00       	mov    $0x12,%eax
+  801528:	89 df                	mov    %ebx,%edi
+  80152a:	89 de                	mov    %ebx,%esi
+  80152c:	55                   	push   %ebp
+  80152d:	68 36 15 80 00       	push   $0x801536
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	0f 34                	sysenter
+  801536:	83 c4 04             	add    $0x4,%esp
+  801539:	5d                   	pop    %ebp
+  80153a:	eb bb                	jmp    8014f7 <sys_env_set_trace+0x31>
+  80153c:	83 ec 0c             	sub    $0xc,%esp
+  80153f:	50                   	push   %eax
+  801540:	6a 12                	push   $0x12
+  801542:	68 44 20 80 00       	push   $0x802044
+  801547:	6a 49                	push   $0x49
+  801549:	68 61 20 80 00       	push   $0x802061
+  80154e:	e8 bd ed ff ff       	call   800310 <_panic>
+
+00801553 <sys_env_set_rdpmc>:
+  801553:	55                   	push   %ebp
+  801554:	89 e5                	mov    %esp,%ebp
+  801556:	57                   	push   %edi
+  801557:	56                   	push   %esi
+  801558:	53                   	push   %ebx
+  801559:	83 ec 0c             	sub    $0xc,%esp
+  80155c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801563:	78 2b                	js     801590 <sys_env_set_rdpmc+0x3d>
+  801565:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80156c:	75 37                	jne    8015a5 <sys_env_set_rdpmc+0x52>
+  80156e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801573:	b8 13 00 00 00       	mov    $0x13,%eax
+  801578:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80157e:	89 df                	mov    %ebx,%edi
+  801580:	89 de                	mov    %ebx,%esi
+  801582:	cd 30                	int    $0x30
+  801584:	85 c0                	test   %eax,%eax
+  801586:	7f 41                	jg     8015c9 <sys_env_set_rdpmc+0x76>
+  801588:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80158b:	5b                   	pop    %ebx
+  80158c:	5e                   	pop    %esi
+  80158d:	5f                   	pop    %edi
+  80158e:	5d                   	pop    %ebp
+  80158f:	c3                   	ret
+  801590:	b8 01 00 00 00       	mov    $0x1,%eax
+  801595:	0f a2                	cpuid
+  801597:	c1 ea 0b             	shr    $0xb,%edx
+  80159a:	83 e2 01             	and    $0x1,%edx
+  80159d:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8015a3:	eb c0                	jmp    801565 <sys_env_set_rdpmc+0x12>
+  8015a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b0:	b8 13 00 00 00       	mov    $0x13,%eax
+  8015b5:	89 df                	mov    %ebx,%edi
+  8015b7:	89 de                	mov    %ebx,%esi
+  8015b9:	55                   	push   %ebp
+  8015ba:	68 c3 15 80 00       	push   $0x8015c3
+  8015bf:	89 e5                	mov    %esp,%ebp
+  8015c1:	0f 34                	sysenter
+  8015c3:	83 c4 04             	add    $0x4,%esp
+  8015c6:	5d                   	pop    %ebp
+  8015c7:	eb bb                	jmp    801584 <sys_env_set_rdpmc+0x31>
+  8015c9:	83 ec 0c             	sub    $0xc,%esp
+  8015cc:	50                   	push   %eax
+  8015cd:	6a 13                	push   $0x13
+  8015cf:	68 44 20 80 00       	push   $0x802044
+  8015d4:	6a 49                	push   $0x49
+  8015d6:	68 61 20 80 00       	push   $0x802061
+  8015db:	e8 30 ed ff ff       	call   800310 <_panic>
+
+008015e0 <sys_ring_setup>:
+  8015e0:	55                   	push   %ebp
+  8015e1:	89 e5                	mov    %esp,%ebp
+  8015e3:	57                   	push   %edi
+  8015e4:	56                   	push   %esi
+  8015e5:	53                   	push   %ebx
+  8015e6:	83 ec 0c             	sub    $0xc,%esp
+  8015e9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8015f0:	78 29                	js     80161b <sys_ring_setup+0x3b>
+  8015f2:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8015f9:	75 35                	jne    801630 <sys_ring_setup+0x50>
+  8015fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801600:	b8 10 00 00 00       	mov    $0x10,%eax
+  801605:	89 d1                	mov    %edx,%ecx
+  801607:	89 d3                	mov    %edx,%ebx
+  801609:	89 d7                	mov    %edx,%edi
+  80160b:	89 d6                	mov    %edx,%esi
+  80160d:	cd 30                	int    $0x30
+  80160f:	85 c0                	test   %eax,%eax
+  801611:	7f 3f                	jg     801652 <sys_ring_setup+0x72>
+  801613:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801616:	5b                   	pop    %ebx
+  801617:	5e                   	pop    %esi
+  801618:	5f                   	pop    %edi
+  801619:	5d                   	pop    %ebp
+  80161a:	c3                   	ret
+  80161b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801620:	0f a2                	cpuid
+  801622:	c1 ea 0b             	shr    $0xb,%edx
+  801625:	83 e2 01             	and    $0x1,%edx
+  801628:	89 15 08 30 80 00    	mov    %edx,0x803008
+  80162e:	eb c2                	jmp    8015f2 <sys_ring_setup+0x12>
+  801630:	ba 00 00 00 00       	mov    $0x0,%edx
+  801635:	b8 10 00 00 00       	mov    $0x10,%eax
+  80163a:	89 d1                	mov    %edx,%ecx
+  80163c:	89 d3                	mov    %edx,%ebx
+  80163e:	89 d7                	mov    %edx,%edi
+  801640:	89 d6                	mov    %edx,%esi
+  801642:	55                   	push   %ebp
+  801643:	68 4c 16 80 00       	push   $0x80164c
+  801648:	89 e5                	mov    %esp,%ebp
+  80164a:	0f 34                	sysenter
+  80164c:	83 c4 04             	add    $0x4,%esp
+  80164f:	5d                   	pop    %ebp
+  801650:	eb bd                	jmp    80160f <sys_ring_setup+0x2f>
+  801652:	83 ec 0c             	sub    $0xc,%esp
+  801655:	50                   	push   %eax
+  801656:	6a 10                	push   $0x10
+  801658:	68 44 20 80 00       	push   $0x802044
+  80165d:	6a 49                	push   $0x49
+  80165f:	68 61 20 80 00       	push   $0x802061
+  801664:	e8 a7 ec ff ff       	call   800310 <_panic>
+
+00801669 <sys_ring_enter>:
+  801669:	55                   	push   %ebp
+  80166a:	89 e5                	mov    %esp,%ebp
+  80166c:	57                   	push   %edi
+  80166d:	56                   	push   %esi
+  80166e:	53                   	push   %ebx
+  80166f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801676:	78 22                	js     80169a <sys_ring_enter+0x31>
+  801678:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80167f:	75 2e                	jne    8016af <sys_ring_enter+0x46>
+  801681:	ba 00 00 00 00       	mov    $0x0,%edx
+  801686:	b8 11 00 00 00       	mov    $0x11,%eax
+  80168b:	89 d1                	mov    %edx,%ecx
+  80168d:	89 d3                	mov    %edx,%ebx
+  80168f:	89 d7                	mov    %edx,%edi
+  801691:	89 d6                	mov    %edx,%esi
+  801693:	cd 30                	int    $0x30
+  801695:	5b                   	pop    %ebx
+  801696:	5e                   	pop    %esi
+  801697:	5f                   	pop    %edi
+  801698:	5d                   	pop    %ebp
+  801699:	c3                   	ret
+  80169a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80169f:	0f a2                	cpuid
+  8016a1:	c1 ea 0b             	shr    $0xb,%edx
+  8016a4:	83 e2 01             	and    $0x1,%edx
+  8016a7:	89 15 08 30 80 00    	mov    %edx,0x803008
+  8016ad:	eb c9                	jmp    801678 <sys_ring_enter+0xf>
+  8016af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016b4:	b8 11 00 00 00       	mov    $0x11,%eax
+  8016b9:	89 d1                	mov    %edx,%ecx
+  8016bb:	89 d3                	mov    %edx,%ebx
+  8016bd:	89 d7                	mov    %edx,%edi
+  8016bf:	89 d6                	mov    %edx,%esi
+  8016c1:	55                   	push   %ebp
+  8016c2:	68 cb 16 80 00       	push   $0x8016cb
+  8016c7:	89 e5                	mov    %esp,%ebp
+  8016c9:	0f 34                	sysenter
+  8016cb:	83 c4 04             	add    $0x4,%esp
+  8016ce:	5d                   	pop    %ebp
+  8016cf:	eb c4                	jmp    801695 <sys_ring_enter+0x2c>
+
+008016d1 <sys_ipc_try_send>:
+  8016d1:	55                   	push   %ebp
+  8016d2:	89 e5                	mov    %esp,%ebp
+  8016d4:	57                   	push   %edi
+  8016d5:	56                   	push   %esi
+  8016d6:	53                   	push   %ebx
+  8016d7:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8016de:	78 26                	js     801706 <sys_ipc_try_send+0x35>
+  8016e0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8016e7:	75 32                	jne    80171b <sys_ipc_try_send+0x4a>
+  8016e9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8016ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016fc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016ff:	cd 30                	int    $0x30
+  801701:	5b                   	pop    %ebx
+  801702:	5e                   	pop    %esi
+  801703:	5f                   	pop    %edi
+  801704:	5d                   	pop    %ebp
+  801705:	c3                   	ret
+  801706:	b8 01 00 00 00       	mov    $0x1,%eax
+  80170b:	0f a2                	cpuid
+  80170d:	c1 ea 0b             	shr    $0xb,%edx
+  801710:	83 e2 01             	and    $0x1,%edx
+  801713:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801719:	eb c5                	jmp    8016e0 <sys_ipc_try_send+0xf>
+  80171b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801721:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801726:	be 00 00 00 00       	mov    $0x0,%esi
+  80172b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80172e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801731:	55                   	push   %ebp
+  801732:	68 3b 17 80 00       	push   $0x80173b
+  801737:	89 e5                	mov    %esp,%ebp
+  801739:	0f 34                	sysenter
+  80173b:	83 c4 04             	add    $0x4,%esp
+  80173e:	5d                   	pop    %ebp
+  80173f:	eb c0                	jmp    801701 <sys_ipc_try_send+0x30>
+
+00801741 <sys_ipc_recv>:
+  801741:	55                   	push   %ebp
+  801742:	89 e5                	mov    %esp,%ebp
+  801744:	57                   	push   %edi
+  801745:	56                   	push   %esi
+  801746:	53                   	push   %ebx
+  801747:	83 ec 0c             	sub    $0xc,%esp
+  80174a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801751:	78 2a                	js     80177d <sys_ipc_recv+0x3c>
+  801753:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80175a:	75 36                	jne    801792 <sys_ipc_recv+0x51>
+  80175c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801761:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801766:	8b 55 08             	mov    0x8(%ebp),%edx
+  801769:	89 cb                	mov    %ecx,%ebx
+  80176b:	89 cf                	mov    %ecx,%edi
+  80176d:	89 ce                	mov    %ecx,%esi
+  80176f:	cd 30                	int    $0x30
+  801771:	85 c0                	test   %eax,%eax
+  801773:	7f 40                	jg     8017b5 <sys_ipc_recv+0x74>
+  801775:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801778:	5b                   	pop    %ebx
+  801779:	5e                   	pop    %esi
+  80177a:	5f                   	pop    %edi
+  80177b:	5d                   	pop    %ebp
+  80177c:	c3                   	ret
+  80177d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801782:	0f a2                	cpuid
+  801784:	c1 ea 0b             	shr    $0xb,%edx
+  801787:	83 e2 01             	and    $0x1,%edx
+  80178a:	89 15 08 30 80 00    	mov    %edx,0x803008
+  801790:	eb c1                	jmp    801753 <sys_ipc_recv+0x12>
+  801792:	8b 55 08             	mov    0x8(%ebp),%edx
+  801795:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80179a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80179f:	89 cb                	mov    %ecx,%ebx
+  8017a1:	89 cf                	mov    %ecx,%edi
+  8017a3:	89 ce                	mov    %ecx,%esi
+  8017a5:	55                   	push   %ebp
+  8017a6:	68 af 17 80 00       	push   $0x8017af
+  8017ab:	89 e5                	mov    %esp,%ebp
+  8017ad:	0f 34                	sysenter
+  8017af:	83 c4 04             	add    $0x4,%esp
+  8017b2:	5d                   	pop    %ebp
+  8017b3:	eb bc                	jmp    801771 <sys_ipc_recv+0x30>
+  8017b5:	83 ec 0c             	sub    $0xc,%esp
+  8017b8:	50                   	push   %eax
+  8017b9:	6a 0c                	push   $0xc
+  8017bb:	68 44 20 80 00       	push   $0x802044
+  8017c0:	6a 49                	push   $0x49
+  8017c2:	68 61 20 80 00       	push   $0x802061
+  8017c7:	e8 44 eb ff ff       	call   800310 <_panic>
+
+008017cc <uinfo_envid>:
+  8017cc:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  8017d1:	c3                   	ret
+
+008017d2 <uinfo_cpunum>:
+  8017d2:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  8017d7:	c3                   	ret
+
+008017d8 <uinfo_ticks>:
+  8017d8:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  8017dd:	c3                   	ret
+
+008017de <uinfo_nsec>:
+  8017de:	55                   	push   %ebp
+  8017df:	89 e5                	mov    %esp,%ebp
+  8017e1:	57                   	push   %edi
+  8017e2:	56                   	push   %esi
+  8017e3:	53                   	push   %ebx
+  8017e4:	83 ec 1c             	sub    $0x1c,%esp
+  8017e7:	0f 31                	rdtsc
+  8017e9:	89 c6                	mov    %eax,%esi
+  8017eb:	89 d7                	mov    %edx,%edi
+  8017ed:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  8017f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017fd:	85 c9                	test   %ecx,%ecx
+  8017ff:	74 5c                	je     80185d <uinfo_nsec+0x7f>
+  801801:	ba 00 00 00 00       	mov    $0x0,%edx
+  801806:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801809:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80180c:	52                   	push   %edx
+  80180d:	51                   	push   %ecx
+  80180e:	57                   	push   %edi
+  80180f:	56                   	push   %esi
+  801810:	e8 fa 02 00 00       	call   801b0f <__umoddi3>
+  801815:	83 c4 10             	add    $0x10,%esp
+  801818:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  80181e:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801823:	f7 e3                	mul    %ebx
+  801825:	01 ca                	add    %ecx,%edx
+  801827:	ff 75 e4             	push   -0x1c(%ebp)
+  80182a:	ff 75 e0             	push   -0x20(%ebp)
+  80182d:	52                   	push   %edx
+  80182e:	50                   	push   %eax
+  80182f:	e8 03 02 00 00       	call   801a37 <__udivdi3>
+  801834:	83 c4 10             	add    $0x10,%esp
+  801837:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80183a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80183d:	ff 75 e4             	push   -0x1c(%ebp)
+  801840:	ff 75 e0             	push   -0x20(%ebp)
+  801843:	57                   	push   %edi
+  801844:	56                   	push   %esi
+  801845:	e8 ed 01 00 00       	call   801a37 <__udivdi3>
+  80184a:	83 c4 10             	add    $0x10,%esp
+  80184d:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801853:	f7 e3                	mul    %ebx
+  801855:	01 ca                	add    %ecx,%edx
+  801857:	03 45 d8             	add    -0x28(%ebp),%eax
+  80185a:	13 55 dc             	adc    -0x24(%ebp),%edx
+  80185d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801860:	5b                   	pop    %ebx
+  801861:	5e                   	pop    %esi
+  801862:	5f                   	pop    %edi
+  801863:	5d                   	pop    %ebp
+  801864:	c3                   	ret
+
+00801865 <sysring_setup>:
+  801865:	55                   	push   %ebp
+  801866:	89 e5                	mov    %esp,%ebp
+  801868:	83 ec 08             	sub    $0x8,%esp
+  80186b:	e8 70 fd ff ff       	call   8015e0 <sys_ring_setup>
+  801870:	c9                   	leave
+  801871:	c3                   	ret
+
+00801872 <sysring_submit>:
+  801872:	8b 15 04 e0 3f 00    	mov    0x3fe004,%edx
+  801878:	8b 0d 00 e0 3f 00    	mov    0x3fe000,%ecx
+  80187e:	89 d0                	mov    %edx,%eax
+  801880:	29 c8                	sub    %ecx,%eax
+  801882:	83 f8 3f             	cmp    $0x3f,%eax
+  801885:	77 52                	ja     8018d9 <sysring_submit+0x67>
+  801887:	55                   	push   %ebp
+  801888:	89 e5                	mov    %esp,%ebp
+  80188a:	53                   	push   %ebx
+  80188b:	89 d1                	mov    %edx,%ecx
+  80188d:	83 e1 3f             	and    $0x3f,%ecx
+  801890:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  801893:	8d 81 10 e0 3f 00    	lea    0x3fe010(%ecx),%eax
+  801899:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80189c:	89 99 10 e0 3f 00    	mov    %ebx,0x3fe010(%ecx)
+  8018a2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8018a5:	89 48 04             	mov    %ecx,0x4(%eax)
+  8018a8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8018ab:	89 48 08             	mov    %ecx,0x8(%eax)
+  8018ae:	8b 4d 18             	mov    0x18(%ebp),%ecx
+  8018b1:	89 48 0c             	mov    %ecx,0xc(%eax)
+  8018b4:	8b 4d 1c             	mov    0x1c(%ebp),%ecx
+  8018b7:	89 48 10             	mov    %ecx,0x10(%eax)
+  8018ba:	8b 4d 20             	mov    0x20(%ebp),%ecx
+  8018bd:	89 48 14             	mov    %ecx,0x14(%eax)
+  8018c0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8018c3:	89 48 18             	mov    %ecx,0x18(%eax)
+  8018c6:	83 c2 01             	add    $0x1,%edx
+  8018c9:	89 15 04 e0 3f 00    	mov    %edx,0x3fe004
+  8018cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d7:	c9                   	leave
+  8018d8:	c3                   	ret
+  8018d9:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8018de:	c3                   	ret
+
+008018df <sysring_enter>:
+  8018df:	55                   	push   %ebp
+  8018e0:	89 e5                	mov    %esp,%ebp
+  8018e2:	83 ec 08             	sub    $0x8,%esp
+  8018e5:	e8 7f fd ff ff       	call   801669 <sys_ring_enter>
+  8018ea:	c9                   	leave
+  8018eb:	c3                   	ret
+
+008018ec <sysring_reap>:
+  8018ec:	55                   	push   %ebp
+  8018ed:	89 e5                	mov    %esp,%ebp
+  8018ef:	56                   	push   %esi
+  8018f0:	53                   	push   %ebx
+  8018f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8018f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018f7:	a1 08 e0 3f 00       	mov    0x3fe008,%eax
+  8018fc:	8b 35 0c e0 3f 00    	mov    0x3fe00c,%esi
+  801902:	ba 00 00 00 00       	mov    $0x0,%edx
+  801907:	39 c6                	cmp    %eax,%esi
+  801909:	74 2f                	je     80193a <sysring_reap+0x4e>
+  80190b:	89 c2                	mov    %eax,%edx
+  80190d:	83 e2 3f             	and    $0x3f,%edx
+  801910:	8d 34 d5 10 e7 3f 00 	lea    0x3fe710(,%edx,8),%esi
+  801917:	85 db                	test   %ebx,%ebx
+  801919:	74 09                	je     801924 <sysring_reap+0x38>
+  80191b:	8b 14 d5 10 e7 3f 00 	mov    0x3fe710(,%edx,8),%edx
+  801922:	89 13                	mov    %edx,(%ebx)
+  801924:	85 c9                	test   %ecx,%ecx
+  801926:	74 05                	je     80192d <sysring_reap+0x41>
+  801928:	8b 56 04             	mov    0x4(%esi),%edx
+  80192b:	89 11                	mov    %edx,(%ecx)
+  80192d:	83 c0 01             	add    $0x1,%eax
+  801930:	a3 08 e0 3f 00       	mov    %eax,0x3fe008
+  801935:	ba 01 00 00 00       	mov    $0x1,%edx
+  80193a:	89 d0                	mov    %edx,%eax
+  80193c:	5b                   	pop    %ebx
+  80193d:	5e                   	pop    %esi
+  80193e:	5d                   	pop    %ebp
+  80193f:	c3                   	ret
+
+00801940 <bflush>:
+  801940:	a1 40 30 80 00       	mov    0x803040,%eax
+  801945:	85 c0                	test   %eax,%eax
+  801947:	75 01                	jne    80194a <bflush+0xa>
+  801949:	c3                   	ret
+  80194a:	55                   	push   %ebp
+  80194b:	89 e5                	mov    %esp,%ebp
+  80194d:	83 ec 10             	sub    $0x10,%esp
+  801950:	50                   	push   %eax
+  801951:	68 44 30 80 00       	push   $0x803044
+  801956:	e8 f9 f4 ff ff       	call   800e54 <sys_cputs>
+  80195b:	c7 05 40 30 80 00 00 	movl   $0x0,0x803040
+  801962:	00 00 00 
+  801965:	83 c4 10             	add    $0x10,%esp
+  801968:	c9                   	leave
+  801969:	c3                   	ret
+
+0080196a <bputch>:
+  80196a:	55                   	push   %ebp
+  80196b:	89 e5                	mov    %esp,%ebp
+  80196d:	53                   	push   %ebx
+  80196e:	83 ec 04             	sub    $0x4,%esp
+  801971:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801974:	8b 15 40 30 80 00    	mov    0x803040,%edx
+  80197a:	8d 42 01             	lea    0x1(%edx),%eax
+  80197d:	a3 40 30 80 00       	mov    %eax,0x803040
+  801982:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801985:	88 8a 44 30 80 00    	mov    %cl,0x803044(%edx)
+  80198b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801990:	77 08                	ja     80199a <bputch+0x30>
+  801992:	83 03 01             	addl   $0x1,(%ebx)
+  801995:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801998:	c9                   	leave
+  801999:	c3                   	ret
+  80199a:	e8 a1 ff ff ff       	call   801940 <bflush>
+  80199f:	eb f1                	jmp    801992 <bputch+0x28>
+
+008019a1 <vbprintf>:
+  8019a1:	55                   	push   %ebp
+  8019a2:	89 e5                	mov    %esp,%ebp
+  8019a4:	83 ec 18             	sub    $0x18,%esp
+  8019a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8019ae:	ff 75 0c             	push   0xc(%ebp)
+  8019b1:	ff 75 08             	push   0x8(%ebp)
+  8019b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019b7:	50                   	push   %eax
+  8019b8:	68 6a 19 80 00       	push   $0x80196a
+  8019bd:	e8 25 eb ff ff       	call   8004e7 <vprintfmt>
+  8019c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019c5:	c9                   	leave
+  8019c6:	c3                   	ret
+
+008019c7 <bprintf>:
+  8019c7:	55                   	push   %ebp
+  8019c8:	89 e5                	mov    %esp,%ebp
+  8019ca:	83 ec 10             	sub    $0x10,%esp
+  8019cd:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8019d0:	50                   	push   %eax
+  8019d1:	ff 75 08             	push   0x8(%ebp)
+  8019d4:	e8 c8 ff ff ff       	call   8019a1 <vbprintf>
+  8019d9:	c9                   	leave
+  8019da:	c3                   	ret
+
+008019db <bwrite>:
+  8019db:	55                   	push   %ebp
+  8019dc:	89 e5                	mov    %esp,%ebp
+  8019de:	53                   	push   %ebx
+  8019df:	83 ec 04             	sub    $0x4,%esp
+  8019e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8019e5:	89 d8                	mov    %ebx,%eax
+  8019e7:	03 05 40 30 80 00    	add    0x803040,%eax
+  8019ed:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019f2:	76 0d                	jbe    801a01 <bwrite+0x26>
+  8019f4:	e8 47 ff ff ff       	call   801940 <bflush>
+  8019f9:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  8019ff:	77 25                	ja     801a26 <bwrite+0x4b>
+  801a01:	83 ec 04             	sub    $0x4,%esp
+  801a04:	53                   	push   %ebx
+  801a05:	ff 75 08             	push   0x8(%ebp)
+  801a08:	a1 40 30 80 00       	mov    0x803040,%eax
+  801a0d:	05 44 30 80 00       	add    $0x803044,%eax
+  801a12:	50                   	push   %eax
+  801a13:	e8 3a f2 ff ff       	call   800c52 <memcpy>
+  801a18:	01 1d 40 30 80 00    	add    %ebx,0x803040
+  801a1e:	83 c4 10             	add    $0x10,%esp
+  801a21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a24:	c9                   	leave
+  801a25:	c3                   	ret
+  801a26:	83 ec 08             	sub    $0x8,%esp
+  801a29:	53                   	push   %ebx
+  801a2a:	ff 75 08             	push   0x8(%ebp)
+  801a2d:	e8 22 f4 ff ff       	call   800e54 <sys_cputs>
+  801a32:	83 c4 10             	add    $0x10,%esp
+  801a35:	eb ea                	jmp    801a21 <bwrite+0x46>
+
+00801a37 <__udivdi3>:
+  801a37:	57                   	push   %edi
+  801a38:	56                   	push   %esi
+  801a39:	53                   	push   %ebx
+  801a3a:	83 ec 20             	sub    $0x20,%esp
+  801a3d:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801a41:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801a45:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801a49:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801a4d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801a51:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801a55:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801a59:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801a5d:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801a61:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801a65:	89 d1                	mov    %edx,%ecx
+  801a67:	09 c1                	or     %eax,%ecx
+  801a69:	0f 84 91 00 00 00    	je     801b00 <__udivdi3+0xc9>
+  801a6f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801a76:	00 
+  801a77:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801a7e:	00 
+  801a7f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801a84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a89:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a8e:	eb 08                	jmp    801a98 <__udivdi3+0x61>
+  801a90:	83 e9 01             	sub    $0x1,%ecx
+  801a93:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  801a96:	74 68                	je     801b00 <__udivdi3+0xc9>
+  801a98:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801a9c:	01 c0                	add    %eax,%eax
+  801a9e:	89 c6                	mov    %eax,%esi
+  801aa0:	89 d7                	mov    %edx,%edi
+  801aa2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801aa6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801aaa:	0f ad d0             	shrd   %cl,%edx,%eax
+  801aad:	d3 ea                	shr    %cl,%edx
+  801aaf:	f6 c1 20             	test   $0x20,%cl
+  801ab2:	74 04                	je     801ab8 <__udivdi3+0x81>
+  801ab4:	89 d0                	mov    %edx,%eax
+  801ab6:	31 d2                	xor    %edx,%edx
+  801ab8:	83 e0 01             	and    $0x1,%eax
+  801abb:	89 04 24             	mov    %eax,(%esp)
+  801abe:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801ac5:	00 
+  801ac6:	8b 04 24             	mov    (%esp),%eax
+  801ac9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801acd:	09 f0                	or     %esi,%eax
+  801acf:	09 fa                	or     %edi,%edx
+  801ad1:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801ad5:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  801ad9:	39 f0                	cmp    %esi,%eax
+  801adb:	89 d3                	mov    %edx,%ebx
+  801add:	19 fb                	sbb    %edi,%ebx
+  801adf:	72 af                	jb     801a90 <__udivdi3+0x59>
+  801ae1:	29 f0                	sub    %esi,%eax
+  801ae3:	19 fa                	sbb    %edi,%edx
+  801ae5:	89 cf                	mov    %ecx,%edi
+  801ae7:	c1 ef 05             	shr    $0x5,%edi
+  801aea:	83 e7 01             	and    $0x1,%edi
+  801aed:	89 fe                	mov    %edi,%esi
+  801aef:	83 f6 01             	xor    $0x1,%esi
+  801af2:	d3 e6                	shl    %cl,%esi
+  801af4:	d3 e7                	shl    %cl,%edi
+  801af6:	09 74 24 18          	or     %esi,0x18(%esp)
+  801afa:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  801afe:	eb 90                	jmp    801a90 <__udivdi3+0x59>
+  801b00:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801b04:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  801b08:	83 c4 20             	add    $0x20,%esp
+  801b0b:	5b                   	pop    %ebx
+  801b0c:	5e                   	pop    %esi
+  801b0d:	5f                   	pop    %edi
+  801b0e:	c3                   	ret
+
+00801b0f <__umoddi3>:
+  801b0f:	55                   	push   %ebp
+  801b10:	57                   	push   %edi
+  801b11:	56                   	push   %esi
+  801b12:	53                   	push   %ebx
+  801b13:	83 ec 1c             	sub    $0x1c,%esp
+  801b16:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801b1a:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801b1e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801b22:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801b26:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801b2a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801b2e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801b32:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801b36:	89 d6                	mov    %edx,%esi
+  801b38:	09 c6                	or     %eax,%esi
+  801b3a:	74 6c                	je     801ba8 <__umoddi3+0x99>
+  801b3c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801b41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b4b:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801b4f:	eb 0e                	jmp    801b5f <__umoddi3+0x50>
+  801b51:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801b56:	8b 74 24 04          	mov    0x4(%esp),%esi
+  801b5a:	83 fe ff             	cmp    $0xffffffff,%esi
+  801b5d:	74 49                	je     801ba8 <__umoddi3+0x99>
+  801b5f:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801b63:	01 c0                	add    %eax,%eax
+  801b65:	89 c3                	mov    %eax,%ebx
+  801b67:	89 d6                	mov    %edx,%esi
+  801b69:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801b6d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801b71:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801b76:	0f ad d0             	shrd   %cl,%edx,%eax
+  801b79:	d3 ea                	shr    %cl,%edx
+  801b7b:	f6 c1 20             	test   $0x20,%cl
+  801b7e:	74 04                	je     801b84 <__umoddi3+0x75>
+  801b80:	89 d0                	mov    %edx,%eax
+  801b82:	31 d2                	xor    %edx,%edx
+  801b84:	83 e0 01             	and    $0x1,%eax
+  801b87:	bd 00 00 00 00       	mov    $0x0,%ebp
+  801b8c:	89 ea                	mov    %ebp,%edx
+  801b8e:	09 d8                	or     %ebx,%eax
+  801b90:	09 f2                	or     %esi,%edx
+  801b92:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  801b96:	8b 74 24 14          	mov    0x14(%esp),%esi
+  801b9a:	39 d8                	cmp    %ebx,%eax
+  801b9c:	89 d1                	mov    %edx,%ecx
+  801b9e:	19 f1                	sbb    %esi,%ecx
+  801ba0:	72 af                	jb     801b51 <__umoddi3+0x42>
+  801ba2:	29 d8                	sub    %ebx,%eax
+  801ba4:	19 f2                	sbb    %esi,%edx
+  801ba6:	eb a9                	jmp    801b51 <__umoddi3+0x42>
+  801ba8:	83 c4 1c             	add    $0x1c,%esp
+  801bab:	5b                   	pop    %ebx
+  801bac:	5e                   	pop    %esi
+  801bad:	5f                   	pop    %edi
+  801bae:	5d                   	pop    %ebp
+  801baf:	c3                   	ret
+
+00801bb0 <__divdi3>:
+  801bb0:	53                   	push   %ebx
+  801bb1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801bb5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801bb9:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801bbd:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801bc1:	85 d2                	test   %edx,%edx
+  801bc3:	78 12                	js     801bd7 <__divdi3+0x27>
+  801bc5:	85 db                	test   %ebx,%ebx
+  801bc7:	78 2e                	js     801bf7 <__divdi3+0x47>
+  801bc9:	53                   	push   %ebx
+  801bca:	51                   	push   %ecx
+  801bcb:	52                   	push   %edx
+  801bcc:	50                   	push   %eax
+  801bcd:	e8 65 fe ff ff       	call   801a37 <__udivdi3>
+  801bd2:	83 c4 10             	add    $0x10,%esp
+  801bd5:	eb 1e                	jmp    801bf5 <__divdi3+0x45>
+  801bd7:	f7 d8                	neg    %eax
+  801bd9:	83 d2 00             	adc    $0x0,%edx
+  801bdc:	f7 da                	neg    %edx
+  801bde:	85 db                	test   %ebx,%ebx
+  801be0:	78 2a                	js     801c0c <__divdi3+0x5c>
+  801be2:	53                   	push   %ebx
+  801be3:	51                   	push   %ecx
+  801be4:	52                   	push   %edx
+  801be5:	50                   	push   %eax
+  801be6:	e8 4c fe ff ff       	call   801a37 <__udivdi3>
+  801beb:	83 c4 10             	add    $0x10,%esp
+  801bee:	f7 d8                	neg    %eax
+  801bf0:	83 d2 00             	adc    $0x0,%edx
+  801bf3:	f7 da                	neg    %edx
+  801bf5:	5b                   	pop    %ebx
+  801bf6:	c3                   	ret
+  801bf7:	f7 d9                	neg    %ecx
+  801bf9:	83 d3 00             	adc    $0x0,%ebx
+  801bfc:	f7 db                	neg    %ebx
+  801bfe:	53                   	push   %ebx
+  801bff:	51                   	push   %ecx
+  801c00:	52                   	push   %edx
+  801c01:	50                   	push   %eax
+  801c02:	e8 30 fe ff ff       	call   801a37 <__udivdi3>
+  801c07:	83 c4 10             	add    $0x10,%esp
+  801c0a:	eb e2                	jmp    801bee <__divdi3+0x3e>
+  801c0c:	f7 d9                	neg    %ecx
+  801c0e:	83 d3 00             	adc    $0x0,%ebx
+  801c11:	f7 db                	neg    %ebx
+  801c13:	53                   	push   %ebx
+  801c14:	51                   	push   %ecx
+  801c15:	52                   	push   %edx
+  801c16:	50                   	push   %eax
+  801c17:	e8 1b fe ff ff       	call   801a37 <__udivdi3>
+  801c1c:	83 c4 10             	add    $0x10,%esp
+  801c1f:	eb d4                	jmp    801bf5 <__divdi3+0x45>
+
+00801c21 <__moddi3>:
+  801c21:	55                   	push   %ebp
+  801c22:	57                   	push   %edi
+  801c23:	56                   	push   %esi
+  801c24:	53                   	push   %ebx
+  801c25:	83 ec 14             	sub    $0x14,%esp
+  801c28:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801c2c:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801c30:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801c34:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801c38:	85 ed                	test   %ebp,%ebp
+  801c3a:	78 2b                	js     801c67 <__moddi3+0x46>
+  801c3c:	89 c6                	mov    %eax,%esi
+  801c3e:	f7 de                	neg    %esi
+  801c40:	89 34 24             	mov    %esi,(%esp)
+  801c43:	89 d6                	mov    %edx,%esi
+  801c45:	83 d6 00             	adc    $0x0,%esi
+  801c48:	f7 de                	neg    %esi
+  801c4a:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801c4e:	8b 34 24             	mov    (%esp),%esi
+  801c51:	0f 48 f0             	cmovs  %eax,%esi
+  801c54:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  801c59:	52                   	push   %edx
+  801c5a:	56                   	push   %esi
+  801c5b:	55                   	push   %ebp
+  801c5c:	57                   	push   %edi
+  801c5d:	e8 ad fe ff ff       	call   801b0f <__umoddi3>
+  801c62:	83 c4 10             	add    $0x10,%esp
+  801c65:	eb 3c                	jmp    801ca3 <__moddi3+0x82>
+  801c67:	89 c3                	mov    %eax,%ebx
+  801c69:	f7 db                	neg    %ebx
+  801c6b:	89 d1                	mov    %edx,%ecx
+  801c6d:	83 d1 00             	adc    $0x0,%ecx
+  801c70:	f7 d9                	neg    %ecx
+  801c72:	0f 49 c3             	cmovns %ebx,%eax
+  801c75:	89 04 24             	mov    %eax,(%esp)
+  801c78:	0f 49 d1             	cmovns %ecx,%edx
+  801c7b:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801c7f:	ff 74 24 04          	push   0x4(%esp)
+  801c83:	ff 74 24 04          	push   0x4(%esp)
+  801c87:	89 f8                	mov    %edi,%eax
+  801c89:	89 ea                	mov    %ebp,%edx
+  801c8b:	f7 d8                	neg    %eax
+  801c8d:	83 d2 00             	adc    $0x0,%edx
+  801c90:	f7 da                	neg    %edx
+  801c92:	52                   	push   %edx
+  801c93:	50                   	push   %eax
+  801c94:	e8 76 fe ff ff       	call   801b0f <__umoddi3>
+  801c99:	83 c4 10             	add    $0x10,%esp
+  801c9c:	f7 d8                	neg    %eax
+  801c9e:	83 d2 00             	adc    $0x0,%edx
+  801ca1:	f7 da                	neg    %edx
+  801ca3:	83 c4 14             	add    $0x14,%esp
+  801ca6:	5b                   	pop    %ebx
+  801ca7:	5e                   	pop    %esi
+  801ca8:	5f                   	pop    %edi
+  801ca9:	5d                   	pop    %ebp
+  801caa:	c3                   	ret
@@ -0,0 +1,2609 @@
+
+obj/user/testbss:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 ab 00 00 00       	call   8000dc <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+  800039:	68 00 1a 80 00       	push   $0x801a00
+  80003e:	e8 dc 01 00 00       	call   80021f <cprintf>
+  800043:	83 c4 10             	add    $0x10,%esp
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004b:	83 3c 85 20 20 80 00 	cmpl   $0x0,0x802020(,%eax,4)
+  800052:	00 
+  800053:	75 63                	jne    8000b8 <umain+0x85>
+  800055:	83 c0 01             	add    $0x1,%eax
+  800058:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80005d:	75 ec                	jne    80004b <umain+0x18>
+  80005f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800064:	89 04 85 20 20 80 00 	mov    %eax,0x802020(,%eax,4)
+  80006b:	83 c0 01             	add    $0x1,%eax
+  80006e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800073:	75 ef                	jne    800064 <umain+0x31>
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007a:	39 04 85 20 20 80 00 	cmp    %eax,0x802020(,%eax,4)
+  800081:	75 47                	jne    8000ca <umain+0x97>
+  800083:	83 c0 01             	add    $0x1,%eax
+  800086:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80008b:	75 ed                	jne    80007a <umain+0x47>
+  80008d:	83 ec 0c             	sub    $0xc,%esp
+  800090:	68 48 1a 80 00       	push   $0x801a48
+  800095:	e8 85 01 00 00       	call   80021f <cprintf>
+  80009a:	c7 05 20 30 c0 00 00 	movl   $0x0,0xc03020
+  8000a1:	00 00 00 
+  8000a4:	83 c4 0c             	add    $0xc,%esp
+  8000a7:	68 a7 1a 80 00       	push   $0x801aa7
+  8000ac:	6a 1a                	push   $0x1a
+  8000ae:	68 98 1a 80 00       	push   $0x801a98
+  8000b3:	e8 87 00 00 00       	call   80013f <_panic>
+  8000b8:	50                   	push   %eax
+  8000b9:	68 7b 1a 80 00       	push   $0x801a7b
+  8000be:	6a 11                	push   $0x11
+  8000c0:	68 98 1a 80 00       	push   $0x801a98
+  8000c5:	e8 75 00 00 00       	call   80013f <_panic>
+  8000ca:	50                   	push   %eax
+  8000cb:	68 20 1a 80 00       	push   $0x801a20
+  8000d0:	6a 16                	push   $0x16
+  8000d2:	68 98 1a 80 00       	push   $0x801a98
+  8000d7:	e8 63 00 00 00       	call   80013f <_panic>
+
+008000dc <libmain>:
+  8000dc:	55                   	push   %ebp
+  8000dd:	89 e5                	mov    %esp,%ebp
+  8000df:	56                   	push   %esi
+  8000e0:	53                   	push   %ebx
+  8000e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000e7:	e8 0f 15 00 00       	call   8015fb <uinfo_envid>
+  8000ec:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8000f1:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8000f7:	05 00 00 00 ed       	add    $0xed000000,%eax
+  8000fc:	a3 20 20 c0 00       	mov    %eax,0xc02020
+  800101:	85 db                	test   %ebx,%ebx
+  800103:	7e 07                	jle    80010c <libmain+0x30>
+  800105:	8b 06                	mov    (%esi),%eax
+  800107:	a3 00 20 80 00       	mov    %eax,0x802000
+  80010c:	83 ec 08             	sub    $0x8,%esp
+  80010f:	56                   	push   %esi
+  800110:	53                   	push   %ebx
+  800111:	e8 1d ff ff ff       	call   800033 <umain>
+  800116:	e8 0a 00 00 00       	call   800125 <exit>
+  80011b:	83 c4 10             	add    $0x10,%esp
+  80011e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800121:	5b                   	pop    %ebx
+  800122:	5e                   	pop    %esi
+  800123:	5d                   	pop    %ebp
+  800124:	c3                   	ret
+
+00800125 <exit>:
+  800125:	55                   	push   %ebp
+  800126:	89 e5                	mov    %esp,%ebp
+  800128:	83 ec 08             	sub    $0x8,%esp
+  80012b:	e8 64 15 00 00       	call   801694 <bflush>
+  800130:	83 ec 0c             	sub    $0xc,%esp
+  800133:	6a 00                	push   $0x0
+  800135:	e8 17 0c 00 00       	call   800d51 <sys_env_destroy>
+  80013a:	83 c4 10             	add    $0x10,%esp
+  80013d:	c9                   	leave
+  80013e:	c3                   	ret
+
+0080013f <_panic>:
+  80013f:	55                   	push   %ebp
+  800140:	89 e5                	mov    %esp,%ebp
+  800142:	56                   	push   %esi
+  800143:	53                   	push   %ebx
+  800144:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800147:	e8 48 15 00 00       	call   801694 <bflush>
+  80014c:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  800152:	e8 85 0c 00 00       	call   800ddc <sys_getenvid>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	ff 75 0c             	push   0xc(%ebp)
+  80015d:	ff 75 08             	push   0x8(%ebp)
+  800160:	56                   	push   %esi
+  800161:	50                   	push   %eax
+  800162:	68 c8 1a 80 00       	push   $0x801ac8
+  800167:	e8 b3 00 00 00       	call   80021f <cprintf>
+  80016c:	83 c4 18             	add    $0x18,%esp
+  80016f:	53                   	push   %ebx
+  800170:	ff 75 10             	push   0x10(%ebp)
+  800173:	e8 56 00 00 00       	call   8001ce <vcprintf>
+  800178:	c7 04 24 96 1a 80 00 	movl   $0x801a96,(%esp)
+  80017f:	e8 9b 00 00 00       	call   80021f <cprintf>
+  800184:	83 c4 10             	add    $0x10,%esp
+  800187:	cc                   	int3
+  800188:	eb fd                	jmp    800187 <_panic+0x48>
+
+0080018a <putch>:
+  80018a:	55                   	push   %ebp
+  80018b:	89 e5                	mov    %esp,%ebp
+  80018d:	53                   	push   %ebx
+  80018e:	83 ec 04             	sub    $0x4,%esp
+  800191:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800194:	8b 13                	mov    (%ebx),%edx
+  800196:	8d 42 01             	lea    0x1(%edx),%eax
+  800199:	89 03                	mov    %eax,(%ebx)
+  80019b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80019e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8001a2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001a7:	74 09                	je     8001b2 <putch+0x28>
+  8001a9:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8001ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001b0:	c9                   	leave
+  8001b1:	c3                   	ret
+  8001b2:	83 ec 08             	sub    $0x8,%esp
+  8001b5:	68 ff 00 00 00       	push   $0xff
+  8001ba:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001bd:	50                   	push   %eax
+  8001be:	e8 c0 0a 00 00       	call   800c83 <sys_cputs>
+  8001c3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001c9:	83 c4 10             	add    $0x10,%esp
+  8001cc:	eb db                	jmp    8001a9 <putch+0x1f>
+
+008001ce <vcprintf>:
+  8001ce:	55                   	push   %ebp
+  8001cf:	89 e5                	mov    %esp,%ebp
+  8001d1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8001d7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001de:	00 00 00 
+  8001e1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001e8:	00 00 00 
+  8001eb:	ff 75 0c             	push   0xc(%ebp)
+  8001ee:	ff 75 08             	push   0x8(%ebp)
+  8001f1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001f7:	50                   	push   %eax
+  8001f8:	68 8a 01 80 00       	push   $0x80018a
+  8001fd:	e8 14 01 00 00       	call   800316 <vprintfmt>
+  800202:	83 c4 08             	add    $0x8,%esp
+  800205:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80020b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800211:	50                   	push   %eax
+  800212:	e8 6c 0a 00 00       	call   800c83 <sys_cputs>
+  800217:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80021d:	c9                   	leave
+  80021e:	c3                   	ret
+
+0080021f <cprintf>:
+  80021f:	55                   	push   %ebp
+  800220:	89 e5                	mov    %esp,%ebp
+  800222:	83 ec 10             	sub    $0x10,%esp
+  800225:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800228:	50                   	push   %eax
+  800229:	ff 75 08             	push   0x8(%ebp)
+  80022c:	e8 9d ff ff ff       	call   8001ce <vcprintf>
+  800231:	c9                   	leave
+  800232:	c3                   	ret
+
+00800233 <printnum>:
+  800233:	55                   	push   %ebp
+  800234:	89 e5                	mov    %esp,%ebp
+  800236:	57                   	push   %edi
+  800237:	56                   	push   %esi
+  800238:	53                   	push   %ebx
+  800239:	83 ec 1c             	sub    $0x1c,%esp
+  80023c:	89 c7                	mov    %eax,%edi
+  80023e:	89 d6                	mov    %edx,%esi
+  800240:	8b 45 08             	mov    0x8(%ebp),%eax
+  800243:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800246:	89 d1                	mov    %edx,%ecx
+  800248:	89 c2                	mov    %eax,%edx
+  80024a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80024d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800250:	8b 45 10             	mov    0x10(%ebp),%eax
+  800253:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800256:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800259:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800260:	39 c2                	cmp    %eax,%edx
+  800262:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800265:	72 3e                	jb     8002a5 <printnum+0x72>
+  800267:	83 ec 0c             	sub    $0xc,%esp
+  80026a:	ff 75 18             	push   0x18(%ebp)
+  80026d:	83 eb 01             	sub    $0x1,%ebx
+  800270:	53                   	push   %ebx
+  800271:	50                   	push   %eax
+  800272:	83 ec 08             	sub    $0x8,%esp
+  800275:	ff 75 e4             	push   -0x1c(%ebp)
+  800278:	ff 75 e0             	push   -0x20(%ebp)
+  80027b:	ff 75 dc             	push   -0x24(%ebp)
+  80027e:	ff 75 d8             	push   -0x28(%ebp)
+  800281:	e8 05 15 00 00       	call   80178b <__udivdi3>
+  800286:	83 c4 18             	add    $0x18,%esp
+  800289:	52                   	push   %edx
+  80028a:	50                   	push   %eax
+  80028b:	89 f2                	mov    %esi,%edx
+  80028d:	89 f8                	mov    %edi,%eax
+  80028f:	e8 9f ff ff ff       	call   800233 <printnum>
+  800294:	83 c4 20             	add    $0x20,%esp
+  800297:	eb 13                	jmp    8002ac <printnum+0x79>
+  800299:	83 ec 08             	sub    $0x8,%esp
+  80029c:	56                   	push   %esi
+  80029d:	ff 75 18             	push   0x18(%ebp)
+  8002a0:	ff d7                	call   *%edi
+  8002a2:	83 c4 10             	add    $0x10,%esp
+  8002a5:	83 eb 01             	sub    $0x1,%ebx
+  8002a8:	85 db                	test   %ebx,%ebx
+  8002aa:	7f ed                	jg     800299 <printnum+0x66>
+  8002ac:	83 ec 08             	sub    $0x8,%esp
+  8002af:	56                   	push   %esi
+  8002b0:	83 ec 04             	sub    $0x4,%esp
+  8002b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8002b6:	ff 75 e0             	push   -0x20(%ebp)
+  8002b9:	ff 75 dc             	push   -0x24(%ebp)
+  8002bc:	ff 75 d8             	push   -0x28(%ebp)
+  8002bf:	e8 9f 15 00 00       	call   801863 <__umoddi3>
+  8002c4:	83 c4 14             	add    $0x14,%esp
+  8002c7:	0f be 80 eb 1a 80 00 	movsbl 0x801aeb(%eax),%eax
+  8002ce:	50                   	push   %eax
+  8002cf:	ff d7                	call   *%edi
+  8002d1:	83 c4 10             	add    $0x10,%esp
+  8002d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d7:	5b                   	pop    %ebx
+  8002d8:	5e                   	pop    %esi
+  8002d9:	5f                   	pop    %edi
+  8002da:	5d                   	pop    %ebp
+  8002db:	c3                   	ret
+
+008002dc <sprintputch>:
+  8002dc:	55                   	push   %ebp
+  8002dd:	89 e5                	mov    %esp,%ebp
+  8002df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002e2:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8002e6:	8b 10                	mov    (%eax),%edx
+  8002e8:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002eb:	73 0a                	jae    8002f7 <sprintputch+0x1b>
+  8002ed:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002f0:	89 08                	mov    %ecx,(%eax)
+  8002f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002f5:	88 02                	mov    %al,(%edx)
+  8002f7:	5d                   	pop    %ebp
+  8002f8:	c3                   	ret
+
+008002f9 <printfmt>:
+  8002f9:	55                   	push   %ebp
+  8002fa:	89 e5                	mov    %esp,%ebp
+  8002fc:	83 ec 08             	sub    $0x8,%esp
+  8002ff:	8d 45 14             	lea    0x14(%ebp),%eax
+  800302:	50                   	push   %eax
+  800303:	ff 75 10             	push   0x10(%ebp)
+  800306:	ff 75 0c             	push   0xc(%ebp)
+  800309:	ff 75 08             	push   0x8(%ebp)
+  80030c:	e8 05 00 00 00       	call   800316 <vprintfmt>
+  800311:	83 c4 10             	add    $0x10,%esp
+  800314:	c9                   	leave
+  800315:	c3                   	ret
+
+00800316 <vprintfmt>:
+  800316:	55                   	push   %ebp
+  800317:	89 e5                	mov    %esp,%ebp
+  800319:	57                   	push   %edi
+  80031a:	56                   	push   %esi
+  80031b:	53                   	push   %ebx
+  80031c:	83 ec 2c             	sub    $0x2c,%esp
+  80031f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800322:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800325:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800328:	eb 0a                	jmp    800334 <vprintfmt+0x1e>
+  80032a:	83 ec 08             	sub    $0x8,%esp
+  80032d:	53                   	push   %ebx
+  80032e:	50                   	push   %eax
+  80032f:	ff d6                	call   *%esi
+  800331:	83 c4 10             	add    $0x10,%esp
+  800334:	83 c7 01             	add    $0x1,%edi
+  800337:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80033b:	83 f8 25             	cmp    $0x25,%eax
+  80033e:	74 0c                	je     80034c <vprintfmt+0x36>
+  800340:	85 c0                	test   %eax,%eax
+  800342:	75 e6                	jne    80032a <vprintfmt+0x14>
+  800344:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800347:	5b                   	pop    %ebx
+  800348:	5e                   	pop    %esi
+  800349:	5f                   	pop    %edi
+  80034a:	5d                   	pop    %ebp
+  80034b:	c3                   	ret
+  80034c:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  800350:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800357:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80035e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800365:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80036a:	8d 47 01             	lea    0x1(%edi),%eax
+  80036d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800370:	0f b6 17             	movzbl (%edi),%edx
+  800373:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800376:	3c 55                	cmp    $0x55,%al
+  800378:	0f 87 cf 03 00 00    	ja     80074d <vprintfmt+0x437>
+  80037e:	0f b6 c0             	movzbl %al,%eax
+  800381:	ff 24 85 c0 1b 80 00 	jmp    *0x801bc0(,%eax,4)
+  800388:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80038b:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80038f:	eb d9                	jmp    80036a <vprintfmt+0x54>
+  800391:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800394:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800398:	eb d0                	jmp    80036a <vprintfmt+0x54>
+  80039a:	0f b6 d2             	movzbl %dl,%edx
+  80039d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8003a8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003ab:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  8003af:	0f be 17             	movsbl (%edi),%edx
+  8003b2:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003b5:	83 f9 09             	cmp    $0x9,%ecx
+  8003b8:	77 55                	ja     80040f <vprintfmt+0xf9>
+  8003ba:	83 c7 01             	add    $0x1,%edi
+  8003bd:	eb e9                	jmp    8003a8 <vprintfmt+0x92>
+  8003bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c2:	8b 00                	mov    (%eax),%eax
+  8003c4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8003cd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8003d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003d3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d7:	79 91                	jns    80036a <vprintfmt+0x54>
+  8003d9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003df:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003e6:	eb 82                	jmp    80036a <vprintfmt+0x54>
+  8003e8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003eb:	85 d2                	test   %edx,%edx
+  8003ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f2:	0f 49 c2             	cmovns %edx,%eax
+  8003f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003fb:	e9 6a ff ff ff       	jmp    80036a <vprintfmt+0x54>
+  800400:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800403:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80040a:	e9 5b ff ff ff       	jmp    80036a <vprintfmt+0x54>
+  80040f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800412:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800415:	eb bc                	jmp    8003d3 <vprintfmt+0xbd>
+  800417:	83 c1 01             	add    $0x1,%ecx
+  80041a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80041d:	e9 48 ff ff ff       	jmp    80036a <vprintfmt+0x54>
+  800422:	8b 45 14             	mov    0x14(%ebp),%eax
+  800425:	8d 78 04             	lea    0x4(%eax),%edi
+  800428:	83 ec 08             	sub    $0x8,%esp
+  80042b:	53                   	push   %ebx
+  80042c:	ff 30                	push   (%eax)
+  80042e:	ff d6                	call   *%esi
+  800430:	83 c4 10             	add    $0x10,%esp
+  800433:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800436:	e9 b1 02 00 00       	jmp    8006ec <vprintfmt+0x3d6>
+  80043b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043e:	8d 78 04             	lea    0x4(%eax),%edi
+  800441:	8b 10                	mov    (%eax),%edx
+  800443:	89 d0                	mov    %edx,%eax
+  800445:	f7 d8                	neg    %eax
+  800447:	0f 48 c2             	cmovs  %edx,%eax
+  80044a:	83 f8 08             	cmp    $0x8,%eax
+  80044d:	7f 23                	jg     800472 <vprintfmt+0x15c>
+  80044f:	8b 14 85 20 1d 80 00 	mov    0x801d20(,%eax,4),%edx
+  800456:	85 d2                	test   %edx,%edx
+  800458:	74 18                	je     800472 <vprintfmt+0x15c>
+  80045a:	52                   	push   %edx
+  80045b:	68 0c 1b 80 00       	push   $0x801b0c
+  800460:	53                   	push   %ebx
+  800461:	56                   	push   %esi
+  800462:	e8 92 fe ff ff       	call   8002f9 <printfmt>
+  800467:	83 c4 10             	add    $0x10,%esp
+  80046a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80046d:	e9 7a 02 00 00       	jmp    8006ec <vprintfmt+0x3d6>
+  800472:	50                   	push   %eax
+  800473:	68 03 1b 80 00       	push   $0x801b03
+  800478:	53                   	push   %ebx
+  800479:	56                   	push   %esi
+  80047a:	e8 7a fe ff ff       	call   8002f9 <printfmt>
+  80047f:	83 c4 10             	add    $0x10,%esp
+  800482:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800485:	e9 62 02 00 00       	jmp    8006ec <vprintfmt+0x3d6>
+  80048a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048d:	83 c0 04             	add    $0x4,%eax
+  800490:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800493:	8b 45 14             	mov    0x14(%ebp),%eax
+  800496:	8b 08                	mov    (%eax),%ecx
+  800498:	85 c9                	test   %ecx,%ecx
+  80049a:	b8 fc 1a 80 00       	mov    $0x801afc,%eax
+  80049f:	0f 45 c1             	cmovne %ecx,%eax
+  8004a2:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004a5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004a9:	7e 06                	jle    8004b1 <vprintfmt+0x19b>
+  8004ab:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004af:	75 0b                	jne    8004bc <vprintfmt+0x1a6>
+  8004b1:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004b4:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004b7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ba:	eb 5c                	jmp    800518 <vprintfmt+0x202>
+  8004bc:	83 ec 08             	sub    $0x8,%esp
+  8004bf:	ff 75 d0             	push   -0x30(%ebp)
+  8004c2:	ff 75 cc             	push   -0x34(%ebp)
+  8004c5:	e8 87 03 00 00       	call   800851 <strnlen>
+  8004ca:	89 c2                	mov    %eax,%edx
+  8004cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004cf:	29 d0                	sub    %edx,%eax
+  8004d1:	83 c4 10             	add    $0x10,%esp
+  8004d4:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004db:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004de:	89 c6                	mov    %eax,%esi
+  8004e0:	eb 0e                	jmp    8004f0 <vprintfmt+0x1da>
+  8004e2:	83 ec 08             	sub    $0x8,%esp
+  8004e5:	53                   	push   %ebx
+  8004e6:	57                   	push   %edi
+  8004e7:	ff 55 08             	call   *0x8(%ebp)
+  8004ea:	83 ee 01             	sub    $0x1,%esi
+  8004ed:	83 c4 10             	add    $0x10,%esp
+  8004f0:	85 f6                	test   %esi,%esi
+  8004f2:	7f ee                	jg     8004e2 <vprintfmt+0x1cc>
+  8004f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004f7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004fa:	85 c0                	test   %eax,%eax
+  8004fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800501:	0f 49 d0             	cmovns %eax,%edx
+  800504:	29 d0                	sub    %edx,%eax
+  800506:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800509:	eb a6                	jmp    8004b1 <vprintfmt+0x19b>
+  80050b:	83 ec 08             	sub    $0x8,%esp
+  80050e:	53                   	push   %ebx
+  80050f:	52                   	push   %edx
+  800510:	ff 55 08             	call   *0x8(%ebp)
+  800513:	83 c4 10             	add    $0x10,%esp
+  800516:	89 f1                	mov    %esi,%ecx
+  800518:	8d 71 01             	lea    0x1(%ecx),%esi
+  80051b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80051f:	0f be d0             	movsbl %al,%edx
+  800522:	85 d2                	test   %edx,%edx
+  800524:	74 28                	je     80054e <vprintfmt+0x238>
+  800526:	85 ff                	test   %edi,%edi
+  800528:	78 05                	js     80052f <vprintfmt+0x219>
+  80052a:	83 ef 01             	sub    $0x1,%edi
+  80052d:	78 30                	js     80055f <vprintfmt+0x249>
+  80052f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800533:	74 d6                	je     80050b <vprintfmt+0x1f5>
+  800535:	0f be c0             	movsbl %al,%eax
+  800538:	83 e8 20             	sub    $0x20,%eax
+  80053b:	83 f8 5e             	cmp    $0x5e,%eax
+  80053e:	76 cb                	jbe    80050b <vprintfmt+0x1f5>
+  800540:	83 ec 08             	sub    $0x8,%esp
+  800543:	53                   	push   %ebx
+  800544:	6a 3f                	push   $0x3f
+  800546:	ff 55 08             	call   *0x8(%ebp)
+  800549:	83 c4 10             	add    $0x10,%esp
+  80054c:	eb c8                	jmp    800516 <vprintfmt+0x200>
+  80054e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800551:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800554:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800557:	01 d0                	add    %edx,%eax
+  800559:	29 c8                	sub    %ecx,%eax
+  80055b:	89 c7                	mov    %eax,%edi
+  80055d:	eb 13                	jmp    800572 <vprintfmt+0x25c>
+  80055f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800562:	eb ed                	jmp    800551 <vprintfmt+0x23b>
+  800564:	83 ec 08             	sub    $0x8,%esp
+  800567:	53                   	push   %ebx
+  800568:	6a 20                	push   $0x20
+  80056a:	ff d6                	call   *%esi
+  80056c:	83 ef 01             	sub    $0x1,%edi
+  80056f:	83 c4 10             	add    $0x10,%esp
+  800572:	85 ff                	test   %edi,%edi
+  800574:	7f ee                	jg     800564 <vprintfmt+0x24e>
+  800576:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800579:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057c:	e9 6b 01 00 00       	jmp    8006ec <vprintfmt+0x3d6>
+  800581:	83 f9 01             	cmp    $0x1,%ecx
+  800584:	7f 1f                	jg     8005a5 <vprintfmt+0x28f>
+  800586:	85 c9                	test   %ecx,%ecx
+  800588:	74 67                	je     8005f1 <vprintfmt+0x2db>
+  80058a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058d:	8b 00                	mov    (%eax),%eax
+  80058f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800592:	89 c1                	mov    %eax,%ecx
+  800594:	c1 f9 1f             	sar    $0x1f,%ecx
+  800597:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80059a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059d:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a3:	eb 17                	jmp    8005bc <vprintfmt+0x2a6>
+  8005a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a8:	8b 50 04             	mov    0x4(%eax),%edx
+  8005ab:	8b 00                	mov    (%eax),%eax
+  8005ad:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b6:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005bc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005bf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005c2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005c7:	85 c9                	test   %ecx,%ecx
+  8005c9:	0f 89 03 01 00 00    	jns    8006d2 <vprintfmt+0x3bc>
+  8005cf:	83 ec 08             	sub    $0x8,%esp
+  8005d2:	53                   	push   %ebx
+  8005d3:	6a 2d                	push   $0x2d
+  8005d5:	ff d6                	call   *%esi
+  8005d7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005da:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005dd:	f7 da                	neg    %edx
+  8005df:	83 d1 00             	adc    $0x0,%ecx
+  8005e2:	f7 d9                	neg    %ecx
+  8005e4:	83 c4 10             	add    $0x10,%esp
+  8005e7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005ec:	e9 e1 00 00 00       	jmp    8006d2 <vprintfmt+0x3bc>
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8b 00                	mov    (%eax),%eax
+  8005f6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f9:	89 c1                	mov    %eax,%ecx
+  8005fb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005fe:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800601:	8b 45 14             	mov    0x14(%ebp),%eax
+  800604:	8d 40 04             	lea    0x4(%eax),%eax
+  800607:	89 45 14             	mov    %eax,0x14(%ebp)
+  80060a:	eb b0                	jmp    8005bc <vprintfmt+0x2a6>
+  80060c:	83 f9 01             	cmp    $0x1,%ecx
+  80060f:	7f 1e                	jg     80062f <vprintfmt+0x319>
+  800611:	85 c9                	test   %ecx,%ecx
+  800613:	74 32                	je     800647 <vprintfmt+0x331>
+  800615:	8b 45 14             	mov    0x14(%ebp),%eax
+  800618:	8b 10                	mov    (%eax),%edx
+  80061a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061f:	8d 40 04             	lea    0x4(%eax),%eax
+  800622:	89 45 14             	mov    %eax,0x14(%ebp)
+  800625:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80062a:	e9 a3 00 00 00       	jmp    8006d2 <vprintfmt+0x3bc>
+  80062f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800632:	8b 10                	mov    (%eax),%edx
+  800634:	8b 48 04             	mov    0x4(%eax),%ecx
+  800637:	8d 40 08             	lea    0x8(%eax),%eax
+  80063a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800642:	e9 8b 00 00 00       	jmp    8006d2 <vprintfmt+0x3bc>
+  800647:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064a:	8b 10                	mov    (%eax),%edx
+  80064c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800651:	8d 40 04             	lea    0x4(%eax),%eax
+  800654:	89 45 14             	mov    %eax,0x14(%ebp)
+  800657:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80065c:	eb 74                	jmp    8006d2 <vprintfmt+0x3bc>
+  80065e:	83 f9 01             	cmp    $0x1,%ecx
+  800661:	7f 1b                	jg     80067e <vprintfmt+0x368>
+  800663:	85 c9                	test   %ecx,%ecx
+  800665:	74 2c                	je     800693 <vprintfmt+0x37d>
+  800667:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066a:	8b 10                	mov    (%eax),%edx
+  80066c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800671:	8d 40 04             	lea    0x4(%eax),%eax
+  800674:	89 45 14             	mov    %eax,0x14(%ebp)
+  800677:	bf 08 00 00 00       	mov    $0x8,%edi
+  80067c:	eb 54                	jmp    8006d2 <vprintfmt+0x3bc>
+  80067e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800681:	8b 10                	mov    (%eax),%edx
+  800683:	8b 48 04             	mov    0x4(%eax),%ecx
+  800686:	8d 40 08             	lea    0x8(%eax),%eax
+  800689:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068c:	bf 08 00 00 00       	mov    $0x8,%edi
+  800691:	eb 3f                	jmp    8006d2 <vprintfmt+0x3bc>
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8b 10                	mov    (%eax),%edx
+  800698:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069d:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8006a8:	eb 28                	jmp    8006d2 <vprintfmt+0x3bc>
+  8006aa:	83 ec 08             	sub    $0x8,%esp
+  8006ad:	53                   	push   %ebx
+  8006ae:	6a 30                	push   $0x30
+  8006b0:	ff d6                	call   *%esi
+  8006b2:	83 c4 08             	add    $0x8,%esp
+  8006b5:	53                   	push   %ebx
+  8006b6:	6a 78                	push   $0x78
+  8006b8:	ff d6                	call   *%esi
+  8006ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bd:	8b 10                	mov    (%eax),%edx
+  8006bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c4:	83 c4 10             	add    $0x10,%esp
+  8006c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ca:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006cd:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006d2:	83 ec 0c             	sub    $0xc,%esp
+  8006d5:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006d9:	50                   	push   %eax
+  8006da:	ff 75 e0             	push   -0x20(%ebp)
+  8006dd:	57                   	push   %edi
+  8006de:	51                   	push   %ecx
+  8006df:	52                   	push   %edx
+  8006e0:	89 da                	mov    %ebx,%edx
+  8006e2:	89 f0                	mov    %esi,%eax
+  8006e4:	e8 4a fb ff ff       	call   800233 <printnum>
+  8006e9:	83 c4 20             	add    $0x20,%esp
+  8006ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8006ef:	e9 40 fc ff ff       	jmp    800334 <vprintfmt+0x1e>
+  8006f4:	83 f9 01             	cmp    $0x1,%ecx
+  8006f7:	7f 1b                	jg     800714 <vprintfmt+0x3fe>
+  8006f9:	85 c9                	test   %ecx,%ecx
+  8006fb:	74 2c                	je     800729 <vprintfmt+0x413>
+  8006fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800700:	8b 10                	mov    (%eax),%edx
+  800702:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800707:	8d 40 04             	lea    0x4(%eax),%eax
+  80070a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80070d:	bf 10 00 00 00       	mov    $0x10,%edi
+  800712:	eb be                	jmp    8006d2 <vprintfmt+0x3bc>
+  800714:	8b 45 14             	mov    0x14(%ebp),%eax
+  800717:	8b 10                	mov    (%eax),%edx
+  800719:	8b 48 04             	mov    0x4(%eax),%ecx
+  80071c:	8d 40 08             	lea    0x8(%eax),%eax
+  80071f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800722:	bf 10 00 00 00       	mov    $0x10,%edi
+  800727:	eb a9                	jmp    8006d2 <vprintfmt+0x3bc>
+  800729:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072c:	8b 10                	mov    (%eax),%edx
+  80072e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800733:	8d 40 04             	lea    0x4(%eax),%eax
+  800736:	89 45 14             	mov    %eax,0x14(%ebp)
+  800739:	bf 10 00 00 00       	mov    $0x10,%edi
+  80073e:	eb 92                	jmp    8006d2 <vprintfmt+0x3bc>
+  800740:	83 ec 08             	sub    $0x8,%esp
+  800743:	53                   	push   %ebx
+  800744:	6a 25                	push   $0x25
+  800746:	ff d6                	call   *%esi
+  800748:	83 c4 10             	add    $0x10,%esp
+  80074b:	eb 9f                	jmp    8006ec <vprintfmt+0x3d6>
+  80074d:	83 ec 08             	sub    $0x8,%esp
+  800750:	53                   	push   %ebx
+  800751:	6a 25                	push   $0x25
+  800753:	ff d6                	call   *%esi
+  800755:	83 c4 10             	add    $0x10,%esp
+  800758:	89 f8                	mov    %edi,%eax
+  80075a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80075e:	74 05                	je     800765 <vprintfmt+0x44f>
+  800760:	83 e8 01             	sub    $0x1,%eax
+  800763:	eb f5                	jmp    80075a <vprintfmt+0x444>
+  800765:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800768:	eb 82                	jmp    8006ec <vprintfmt+0x3d6>
+
+0080076a <vsnprintf>:
+  80076a:	55                   	push   %ebp
+  80076b:	89 e5                	mov    %esp,%ebp
+  80076d:	83 ec 18             	sub    $0x18,%esp
+  800770:	8b 45 08             	mov    0x8(%ebp),%eax
+  800773:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800776:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800779:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80077d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800780:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800787:	85 c0                	test   %eax,%eax
+  800789:	74 26                	je     8007b1 <vsnprintf+0x47>
+  80078b:	85 d2                	test   %edx,%edx
+  80078d:	7e 22                	jle    8007b1 <vsnprintf+0x47>
+  80078f:	ff 75 14             	push   0x14(%ebp)
+  800792:	ff 75 10             	push   0x10(%ebp)
+  800795:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800798:	50                   	push   %eax
+  800799:	68 dc 02 80 00       	push   $0x8002dc
+  80079e:	e8 73 fb ff ff       	call   800316 <vprintfmt>
+  8007a3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007a6:	c6 00 00             	movb   $0x0,(%eax)
+  8007a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007ac:	83 c4 10             	add    $0x10,%esp
+  8007af:	c9                   	leave
+  8007b0:	c3                   	ret
+  8007b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007b6:	eb f7                	jmp    8007af <vsnprintf+0x45>
+
+008007b8 <snprintf>:
+  8007b8:	55                   	push   %ebp
+  8007b9:	89 e5                	mov    %esp,%ebp
+  8007bb:	83 ec 08             	sub    $0x8,%esp
+  8007be:	8d 45 14             	lea    0x14(%ebp),%eax
+  8007c1:	50                   	push   %eax
+  8007c2:	ff 75 10             	push   0x10(%ebp)
+  8007c5:	ff 75 0c             	push   0xc(%ebp)
+  8007c8:	ff 75 08             	push   0x8(%ebp)
+  8007cb:	e8 9a ff ff ff       	call   80076a <vsnprintf>
+  8007d0:	c9                   	leave
+  8007d1:	c3                   	ret
+
+008007d2 <copy_fwd>:
+  8007d2:	55                   	push   %ebp
+  8007d3:	89 e5                	mov    %esp,%ebp
+  8007d5:	57                   	push   %edi
+  8007d6:	56                   	push   %esi
+  8007d7:	53                   	push   %ebx
+  8007d8:	89 c7                	mov    %eax,%edi
+  8007da:	89 d6                	mov    %edx,%esi
+  8007dc:	89 c8                	mov    %ecx,%eax
+  8007de:	83 f9 0f             	cmp    $0xf,%ecx
+  8007e1:	76 1c                	jbe    8007ff <copy_fwd+0x2d>
+  8007e3:	89 f9                	mov    %edi,%ecx
+  8007e5:	f7 d9                	neg    %ecx
+  8007e7:	89 cb                	mov    %ecx,%ebx
+  8007e9:	83 e3 03             	and    $0x3,%ebx
+  8007ec:	29 d8                	sub    %ebx,%eax
+  8007ee:	89 c2                	mov    %eax,%edx
+  8007f0:	c1 ea 02             	shr    $0x2,%edx
+  8007f3:	83 e0 03             	and    $0x3,%eax
+  8007f6:	89 d9                	mov    %ebx,%ecx
+  8007f8:	fc                   	cld
+  8007f9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8007fb:	89 d1                	mov    %edx,%ecx
+  8007fd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8007ff:	89 c1                	mov    %eax,%ecx
+  800801:	fc                   	cld
+  800802:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800804:	5b                   	pop    %ebx
+  800805:	5e                   	pop    %esi
+  800806:	5f                   	pop    %edi
+  800807:	5d                   	pop    %ebp
+  800808:	c3                   	ret
+
+00800809 <have_sse2>:
+  800809:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800810:	78 06                	js     800818 <have_sse2+0xf>
+  800812:	a1 04 20 80 00       	mov    0x802004,%eax
+  800817:	c3                   	ret
+  800818:	55                   	push   %ebp
+  800819:	89 e5                	mov    %esp,%ebp
+  80081b:	53                   	push   %ebx
+  80081c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800821:	0f a2                	cpuid
+  800823:	c1 ea 1a             	shr    $0x1a,%edx
+  800826:	83 e2 01             	and    $0x1,%edx
+  800829:	89 15 04 20 80 00    	mov    %edx,0x802004
+  80082f:	a1 04 20 80 00       	mov    0x802004,%eax
+  800834:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800837:	c9                   	leave
+  800838:	c3                   	ret
+
+00800839 <strlen>:
+  800839:	55                   	push   %ebp
+  80083a:	89 e5                	mov    %esp,%ebp
+  80083c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80083f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800844:	eb 03                	jmp    800849 <strlen+0x10>
+  800846:	83 c0 01             	add    $0x1,%eax
+  800849:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80084d:	75 f7                	jne    800846 <strlen+0xd>
+  80084f:	5d                   	pop    %ebp
+  800850:	c3                   	ret
+
+00800851 <strnlen>:
+  800851:	55                   	push   %ebp
+  800852:	89 e5                	mov    %esp,%ebp
+  800854:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800857:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80085a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085f:	eb 03                	jmp    800864 <strnlen+0x13>
+  800861:	83 c0 01             	add    $0x1,%eax
+  800864:	39 d0                	cmp    %edx,%eax
+  800866:	74 08                	je     800870 <strnlen+0x1f>
+  800868:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80086c:	75 f3                	jne    800861 <strnlen+0x10>
+  80086e:	89 c2                	mov    %eax,%edx
+  800870:	89 d0                	mov    %edx,%eax
+  800872:	5d                   	pop    %ebp
+  800873:	c3                   	ret
+
+00800874 <strcpy>:
+  800874:	55                   	push   %ebp
+  800875:	89 e5                	mov    %esp,%ebp
+  800877:	53                   	push   %ebx
+  800878:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80087b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80087e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800883:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800887:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80088a:	83 c0 01             	add    $0x1,%eax
+  80088d:	84 d2                	test   %dl,%dl
+  80088f:	75 f2                	jne    800883 <strcpy+0xf>
+  800891:	89 c8                	mov    %ecx,%eax
+  800893:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800896:	c9                   	leave
+  800897:	c3                   	ret
+
+00800898 <strcat>:
+  800898:	55                   	push   %ebp
+  800899:	89 e5                	mov    %esp,%ebp
+  80089b:	53                   	push   %ebx
+  80089c:	83 ec 10             	sub    $0x10,%esp
+  80089f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8008a2:	53                   	push   %ebx
+  8008a3:	e8 91 ff ff ff       	call   800839 <strlen>
+  8008a8:	83 c4 08             	add    $0x8,%esp
+  8008ab:	ff 75 0c             	push   0xc(%ebp)
+  8008ae:	01 d8                	add    %ebx,%eax
+  8008b0:	50                   	push   %eax
+  8008b1:	e8 be ff ff ff       	call   800874 <strcpy>
+  8008b6:	89 d8                	mov    %ebx,%eax
+  8008b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008bb:	c9                   	leave
+  8008bc:	c3                   	ret
+
+008008bd <strncpy>:
+  8008bd:	55                   	push   %ebp
+  8008be:	89 e5                	mov    %esp,%ebp
+  8008c0:	56                   	push   %esi
+  8008c1:	53                   	push   %ebx
+  8008c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008c8:	89 f3                	mov    %esi,%ebx
+  8008ca:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008cd:	89 f0                	mov    %esi,%eax
+  8008cf:	eb 0f                	jmp    8008e0 <strncpy+0x23>
+  8008d1:	83 c0 01             	add    $0x1,%eax
+  8008d4:	0f b6 0a             	movzbl (%edx),%ecx
+  8008d7:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8008da:	80 f9 01             	cmp    $0x1,%cl
+  8008dd:	83 da ff             	sbb    $0xffffffff,%edx
+  8008e0:	39 d8                	cmp    %ebx,%eax
+  8008e2:	75 ed                	jne    8008d1 <strncpy+0x14>
+  8008e4:	89 f0                	mov    %esi,%eax
+  8008e6:	5b                   	pop    %ebx
+  8008e7:	5e                   	pop    %esi
+  8008e8:	5d                   	pop    %ebp
+  8008e9:	c3                   	ret
+
+008008ea <strlcpy>:
+  8008ea:	55                   	push   %ebp
+  8008eb:	89 e5                	mov    %esp,%ebp
+  8008ed:	56                   	push   %esi
+  8008ee:	53                   	push   %ebx
+  8008ef:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008f5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8008f8:	89 f0                	mov    %esi,%eax
+  8008fa:	85 d2                	test   %edx,%edx
+  8008fc:	74 21                	je     80091f <strlcpy+0x35>
+  8008fe:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800902:	89 f2                	mov    %esi,%edx
+  800904:	eb 09                	jmp    80090f <strlcpy+0x25>
+  800906:	83 c1 01             	add    $0x1,%ecx
+  800909:	83 c2 01             	add    $0x1,%edx
+  80090c:	88 5a ff             	mov    %bl,-0x1(%edx)
+  80090f:	39 c2                	cmp    %eax,%edx
+  800911:	74 09                	je     80091c <strlcpy+0x32>
+  800913:	0f b6 19             	movzbl (%ecx),%ebx
+  800916:	84 db                	test   %bl,%bl
+  800918:	75 ec                	jne    800906 <strlcpy+0x1c>
+  80091a:	89 d0                	mov    %edx,%eax
+  80091c:	c6 00 00             	movb   $0x0,(%eax)
+  80091f:	29 f0                	sub    %esi,%eax
+  800921:	5b                   	pop    %ebx
+  800922:	5e                   	pop    %esi
+  800923:	5d                   	pop    %ebp
+  800924:	c3                   	ret
+
+00800925 <strcmp>:
+  800925:	55                   	push   %ebp
+  800926:	89 e5                	mov    %esp,%ebp
+  800928:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80092b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80092e:	eb 06                	jmp    800936 <strcmp+0x11>
+  800930:	83 c1 01             	add    $0x1,%ecx
+  800933:	83 c2 01             	add    $0x1,%edx
+  800936:	0f b6 01             	movzbl (%ecx),%eax
+  800939:	84 c0                	test   %al,%al
+  80093b:	74 04                	je     800941 <strcmp+0x1c>
+  80093d:	3a 02                	cmp    (%edx),%al
+  80093f:	74 ef                	je     800930 <strcmp+0xb>
+  800941:	0f b6 c0             	movzbl %al,%eax
+  800944:	0f b6 12             	movzbl (%edx),%edx
+  800947:	29 d0                	sub    %edx,%eax
+  800949:	5d                   	pop    %ebp
+  80094a:	c3                   	ret
+
+0080094b <strncmp>:
+  80094b:	55                   	push   %ebp
+  80094c:	89 e5                	mov    %esp,%ebp
+  80094e:	53                   	push   %ebx
+  80094f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800952:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800955:	8b 55 10             	mov    0x10(%ebp),%edx
+  800958:	eb 09                	jmp    800963 <strncmp+0x18>
+  80095a:	83 ea 01             	sub    $0x1,%edx
+  80095d:	83 c0 01             	add    $0x1,%eax
+  800960:	83 c1 01             	add    $0x1,%ecx
+  800963:	85 d2                	test   %edx,%edx
+  800965:	74 18                	je     80097f <strncmp+0x34>
+  800967:	0f b6 18             	movzbl (%eax),%ebx
+  80096a:	84 db                	test   %bl,%bl
+  80096c:	74 04                	je     800972 <strncmp+0x27>
+  80096e:	3a 19                	cmp    (%ecx),%bl
+  800970:	74 e8                	je     80095a <strncmp+0xf>
+  800972:	0f b6 00             	movzbl (%eax),%eax
+  800975:	0f b6 11             	movzbl (%ecx),%edx
+  800978:	29 d0                	sub    %edx,%eax
+  80097a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80097d:	c9                   	leave
+  80097e:	c3                   	ret
+  80097f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800984:	eb f4                	jmp    80097a <strncmp+0x2f>
+
+00800986 <strchr>:
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800990:	eb 03                	jmp    800995 <strchr+0xf>
+  800992:	83 c0 01             	add    $0x1,%eax
+  800995:	0f b6 10             	movzbl (%eax),%edx
+  800998:	84 d2                	test   %dl,%dl
+  80099a:	74 06                	je     8009a2 <strchr+0x1c>
+  80099c:	38 ca                	cmp    %cl,%dl
+  80099e:	75 f2                	jne    800992 <strchr+0xc>
+  8009a0:	eb 05                	jmp    8009a7 <strchr+0x21>
+  8009a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a7:	5d                   	pop    %ebp
+  8009a8:	c3                   	ret
+
+008009a9 <strfind>:
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009af:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8009b3:	0f b6 10             	movzbl (%eax),%edx
+  8009b6:	38 ca                	cmp    %cl,%dl
+  8009b8:	74 09                	je     8009c3 <strfind+0x1a>
+  8009ba:	84 d2                	test   %dl,%dl
+  8009bc:	74 05                	je     8009c3 <strfind+0x1a>
+  8009be:	83 c0 01             	add    $0x1,%eax
+  8009c1:	eb f0                	jmp    8009b3 <strfind+0xa>
+  8009c3:	5d                   	pop    %ebp
+  8009c4:	c3                   	ret
+
+008009c5 <memset>:
+  8009c5:	55                   	push   %ebp
+  8009c6:	89 e5                	mov    %esp,%ebp
+  8009c8:	57                   	push   %edi
+  8009c9:	56                   	push   %esi
+  8009ca:	53                   	push   %ebx
+  8009cb:	83 ec 04             	sub    $0x4,%esp
+  8009ce:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009d1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009d4:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  8009d8:	89 f7                	mov    %esi,%edi
+  8009da:	83 fa 0f             	cmp    $0xf,%edx
+  8009dd:	76 24                	jbe    800a03 <memset+0x3e>
+  8009df:	89 f1                	mov    %esi,%ecx
+  8009e1:	f7 d9                	neg    %ecx
+  8009e3:	83 e1 03             	and    $0x3,%ecx
+  8009e6:	29 ca                	sub    %ecx,%edx
+  8009e8:	89 d0                	mov    %edx,%eax
+  8009ea:	c1 e8 02             	shr    $0x2,%eax
+  8009ed:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  8009f0:	83 e2 03             	and    $0x3,%edx
+  8009f3:	89 d8                	mov    %ebx,%eax
+  8009f5:	fc                   	cld
+  8009f6:	f3 aa                	rep stos %al,%es:(%edi)
+  8009f8:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  8009fe:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  800a01:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a03:	89 d1                	mov    %edx,%ecx
+  800a05:	89 d8                	mov    %ebx,%eax
+  800a07:	fc                   	cld
+  800a08:	f3 aa                	rep stos %al,%es:(%edi)
+  800a0a:	89 f0                	mov    %esi,%eax
+  800a0c:	83 c4 04             	add    $0x4,%esp
+  800a0f:	5b                   	pop    %ebx
+  800a10:	5e                   	pop    %esi
+  800a11:	5f                   	pop    %edi
+  800a12:	5d                   	pop    %ebp
+  800a13:	c3                   	ret
+
+00800a14 <memmove>:
+  800a14:	55                   	push   %ebp
+  800a15:	89 e5                	mov    %esp,%ebp
+  800a17:	57                   	push   %edi
+  800a18:	56                   	push   %esi
+  800a19:	53                   	push   %ebx
+  800a1a:	83 ec 0c             	sub    $0xc,%esp
+  800a1d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a20:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a23:	8b 45 10             	mov    0x10(%ebp),%eax
+  800a26:	85 c0                	test   %eax,%eax
+  800a28:	74 14                	je     800a3e <memmove+0x2a>
+  800a2a:	39 da                	cmp    %ebx,%edx
+  800a2c:	73 07                	jae    800a35 <memmove+0x21>
+  800a2e:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  800a31:	39 cb                	cmp    %ecx,%ebx
+  800a33:	72 13                	jb     800a48 <memmove+0x34>
+  800a35:	89 c1                	mov    %eax,%ecx
+  800a37:	89 d8                	mov    %ebx,%eax
+  800a39:	e8 94 fd ff ff       	call   8007d2 <copy_fwd>
+  800a3e:	89 d8                	mov    %ebx,%eax
+  800a40:	83 c4 0c             	add    $0xc,%esp
+  800a43:	5b                   	pop    %ebx
+  800a44:	5e                   	pop    %esi
+  800a45:	5f                   	pop    %edi
+  800a46:	5d                   	pop    %ebp
+  800a47:	c3                   	ret
+  800a48:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800a4b:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  800a4e:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  800a51:	83 f8 0f             	cmp    $0xf,%eax
+  800a54:	76 23                	jbe    800a79 <memmove+0x65>
+  800a56:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  800a59:	83 e1 03             	and    $0x3,%ecx
+  800a5c:	29 c8                	sub    %ecx,%eax
+  800a5e:	89 c2                	mov    %eax,%edx
+  800a60:	c1 ea 02             	shr    $0x2,%edx
+  800a63:	83 e0 03             	and    $0x3,%eax
+  800a66:	fd                   	std
+  800a67:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a69:	83 ef 03             	sub    $0x3,%edi
+  800a6c:	83 ee 03             	sub    $0x3,%esi
+  800a6f:	89 d1                	mov    %edx,%ecx
+  800a71:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a73:	83 c7 03             	add    $0x3,%edi
+  800a76:	83 c6 03             	add    $0x3,%esi
+  800a79:	89 c1                	mov    %eax,%ecx
+  800a7b:	fd                   	std
+  800a7c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a7e:	fc                   	cld
+  800a7f:	eb bd                	jmp    800a3e <memmove+0x2a>
+
+00800a81 <memcpy>:
+  800a81:	55                   	push   %ebp
+  800a82:	89 e5                	mov    %esp,%ebp
+  800a84:	53                   	push   %ebx
+  800a85:	83 ec 04             	sub    $0x4,%esp
+  800a88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a8b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a8e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a91:	89 d8                	mov    %ebx,%eax
+  800a93:	e8 3a fd ff ff       	call   8007d2 <copy_fwd>
+  800a98:	89 d8                	mov    %ebx,%eax
+  800a9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a9d:	c9                   	leave
+  800a9e:	c3                   	ret
+
+00800a9f <page_copy>:
+  800a9f:	55                   	push   %ebp
+  800aa0:	89 e5                	mov    %esp,%ebp
+  800aa2:	57                   	push   %edi
+  800aa3:	56                   	push   %esi
+  800aa4:	53                   	push   %ebx
+  800aa5:	83 ec 0c             	sub    $0xc,%esp
+  800aa8:	e8 5c fd ff ff       	call   800809 <have_sse2>
+  800aad:	85 c0                	test   %eax,%eax
+  800aaf:	74 39                	je     800aea <page_copy+0x4b>
+  800ab1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ab4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ab7:	be 00 01 00 00       	mov    $0x100,%esi
+  800abc:	8b 03                	mov    (%ebx),%eax
+  800abe:	8b 53 04             	mov    0x4(%ebx),%edx
+  800ac1:	0f c3 01             	movnti %eax,(%ecx)
+  800ac4:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800ac8:	8b 43 08             	mov    0x8(%ebx),%eax
+  800acb:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800ace:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800ad2:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800ad6:	83 c3 10             	add    $0x10,%ebx
+  800ad9:	83 c1 10             	add    $0x10,%ecx
+  800adc:	4e                   	dec    %esi
+  800add:	75 dd                	jne    800abc <page_copy+0x1d>
+  800adf:	0f ae f8             	sfence
+  800ae2:	83 c4 0c             	add    $0xc,%esp
+  800ae5:	5b                   	pop    %ebx
+  800ae6:	5e                   	pop    %esi
+  800ae7:	5f                   	pop    %edi
+  800ae8:	5d                   	pop    %ebp
+  800ae9:	c3                   	ret
+  800aea:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800aed:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800af0:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800af5:	fc                   	cld
+  800af6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800af8:	eb e8                	jmp    800ae2 <page_copy+0x43>
+
+00800afa <page_zero>:
+  800afa:	55                   	push   %ebp
+  800afb:	89 e5                	mov    %esp,%ebp
+  800afd:	57                   	push   %edi
+  800afe:	83 ec 04             	sub    $0x4,%esp
+  800b01:	e8 03 fd ff ff       	call   800809 <have_sse2>
+  800b06:	85 c0                	test   %eax,%eax
+  800b08:	74 3a                	je     800b44 <page_zero+0x4a>
+  800b0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0d:	ba 80 00 00 00       	mov    $0x80,%edx
+  800b12:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b17:	0f c3 08             	movnti %ecx,(%eax)
+  800b1a:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800b1e:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800b22:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800b26:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800b2a:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800b2e:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800b32:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800b36:	83 c0 20             	add    $0x20,%eax
+  800b39:	4a                   	dec    %edx
+  800b3a:	75 db                	jne    800b17 <page_zero+0x1d>
+  800b3c:	0f ae f8             	sfence
+  800b3f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b42:	c9                   	leave
+  800b43:	c3                   	ret
+  800b44:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b47:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800b4c:	fc                   	cld
+  800b4d:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b4f:	eb ee                	jmp    800b3f <page_zero+0x45>
+
+00800b51 <memcmp>:
+  800b51:	55                   	push   %ebp
+  800b52:	89 e5                	mov    %esp,%ebp
+  800b54:	56                   	push   %esi
+  800b55:	53                   	push   %ebx
+  800b56:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b59:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b5c:	89 c6                	mov    %eax,%esi
+  800b5e:	03 75 10             	add    0x10(%ebp),%esi
+  800b61:	eb 06                	jmp    800b69 <memcmp+0x18>
+  800b63:	83 c0 01             	add    $0x1,%eax
+  800b66:	83 c2 01             	add    $0x1,%edx
+  800b69:	39 f0                	cmp    %esi,%eax
+  800b6b:	74 14                	je     800b81 <memcmp+0x30>
+  800b6d:	0f b6 08             	movzbl (%eax),%ecx
+  800b70:	0f b6 1a             	movzbl (%edx),%ebx
+  800b73:	38 d9                	cmp    %bl,%cl
+  800b75:	74 ec                	je     800b63 <memcmp+0x12>
+  800b77:	0f b6 c1             	movzbl %cl,%eax
+  800b7a:	0f b6 db             	movzbl %bl,%ebx
+  800b7d:	29 d8                	sub    %ebx,%eax
+  800b7f:	eb 05                	jmp    800b86 <memcmp+0x35>
+  800b81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b86:	5b                   	pop    %ebx
+  800b87:	5e                   	pop    %esi
+  800b88:	5d                   	pop    %ebp
+  800b89:	c3                   	ret
+
+00800b8a <memfind>:
+  800b8a:	55                   	push   %ebp
+  800b8b:	89 e5                	mov    %esp,%ebp
+  800b8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b93:	89 c2                	mov    %eax,%edx
+  800b95:	03 55 10             	add    0x10(%ebp),%edx
+  800b98:	eb 03                	jmp    800b9d <memfind+0x13>
+  800b9a:	83 c0 01             	add    $0x1,%eax
+  800b9d:	39 d0                	cmp    %edx,%eax
+  800b9f:	73 04                	jae    800ba5 <memfind+0x1b>
+  800ba1:	38 08                	cmp    %cl,(%eax)
+  800ba3:	75 f5                	jne    800b9a <memfind+0x10>
+  800ba5:	5d                   	pop    %ebp
+  800ba6:	c3                   	ret
+
+00800ba7 <strtol>:
+  800ba7:	55                   	push   %ebp
+  800ba8:	89 e5                	mov    %esp,%ebp
+  800baa:	57                   	push   %edi
+  800bab:	56                   	push   %esi
+  800bac:	53                   	push   %ebx
+  800bad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bb3:	eb 03                	jmp    800bb8 <strtol+0x11>
+  800bb5:	83 c2 01             	add    $0x1,%edx
+  800bb8:	0f b6 02             	movzbl (%edx),%eax
+  800bbb:	3c 20                	cmp    $0x20,%al
+  800bbd:	74 f6                	je     800bb5 <strtol+0xe>
+  800bbf:	3c 09                	cmp    $0x9,%al
+  800bc1:	74 f2                	je     800bb5 <strtol+0xe>
+  800bc3:	3c 2b                	cmp    $0x2b,%al
+  800bc5:	74 2a                	je     800bf1 <strtol+0x4a>
+  800bc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bcc:	3c 2d                	cmp    $0x2d,%al
+  800bce:	74 2b                	je     800bfb <strtol+0x54>
+  800bd0:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bd6:	75 0f                	jne    800be7 <strtol+0x40>
+  800bd8:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bdb:	74 28                	je     800c05 <strtol+0x5e>
+  800bdd:	85 db                	test   %ebx,%ebx
+  800bdf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800be4:	0f 44 d8             	cmove  %eax,%ebx
+  800be7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bec:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bef:	eb 46                	jmp    800c37 <strtol+0x90>
+  800bf1:	83 c2 01             	add    $0x1,%edx
+  800bf4:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bf9:	eb d5                	jmp    800bd0 <strtol+0x29>
+  800bfb:	83 c2 01             	add    $0x1,%edx
+  800bfe:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c03:	eb cb                	jmp    800bd0 <strtol+0x29>
+  800c05:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c09:	74 0e                	je     800c19 <strtol+0x72>
+  800c0b:	85 db                	test   %ebx,%ebx
+  800c0d:	75 d8                	jne    800be7 <strtol+0x40>
+  800c0f:	83 c2 01             	add    $0x1,%edx
+  800c12:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c17:	eb ce                	jmp    800be7 <strtol+0x40>
+  800c19:	83 c2 02             	add    $0x2,%edx
+  800c1c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c21:	eb c4                	jmp    800be7 <strtol+0x40>
+  800c23:	0f be c0             	movsbl %al,%eax
+  800c26:	83 e8 30             	sub    $0x30,%eax
+  800c29:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c2c:	7d 3a                	jge    800c68 <strtol+0xc1>
+  800c2e:	83 c2 01             	add    $0x1,%edx
+  800c31:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c35:	01 c1                	add    %eax,%ecx
+  800c37:	0f b6 02             	movzbl (%edx),%eax
+  800c3a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c3d:	89 f3                	mov    %esi,%ebx
+  800c3f:	80 fb 09             	cmp    $0x9,%bl
+  800c42:	76 df                	jbe    800c23 <strtol+0x7c>
+  800c44:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c47:	89 f3                	mov    %esi,%ebx
+  800c49:	80 fb 19             	cmp    $0x19,%bl
+  800c4c:	77 08                	ja     800c56 <strtol+0xaf>
+  800c4e:	0f be c0             	movsbl %al,%eax
+  800c51:	83 e8 57             	sub    $0x57,%eax
+  800c54:	eb d3                	jmp    800c29 <strtol+0x82>
+  800c56:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c59:	89 f3                	mov    %esi,%ebx
+  800c5b:	80 fb 19             	cmp    $0x19,%bl
+  800c5e:	77 08                	ja     800c68 <strtol+0xc1>
+  800c60:	0f be c0             	movsbl %al,%eax
+  800c63:	83 e8 37             	sub    $0x37,%eax
+  800c66:	eb c1                	jmp    800c29 <strtol+0x82>
+  800c68:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c6c:	74 05                	je     800c73 <strtol+0xcc>
+  800c6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c71:	89 10                	mov    %edx,(%eax)
+  800c73:	89 c8                	mov    %ecx,%eax
+  800c75:	f7 d8                	neg    %eax
+  800c77:	85 ff                	test   %edi,%edi
+  800c79:	0f 45 c8             	cmovne %eax,%ecx
+  800c7c:	89 c8                	mov    %ecx,%eax
+  800c7e:	5b                   	pop    %ebx
+  800c7f:	5e                   	pop    %esi
+  800c80:	5f                   	pop    %edi
+  800c81:	5d                   	pop    %ebp
+  800c82:	c3                   	ret
+
+00800c83 <sys_cputs>:
+  800c83:	55                   	push   %ebp
+  800c84:	89 e5                	mov    %esp,%ebp
+  800c86:	57                   	push   %edi
+  800c87:	56                   	push   %esi
+  800c88:	53                   	push   %ebx
+  800c89:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c90:	78 21                	js     800cb3 <sys_cputs+0x30>
+  800c92:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c99:	75 2d                	jne    800cc8 <sys_cputs+0x45>
+  800c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca6:	89 c3                	mov    %eax,%ebx
+  800ca8:	89 c7                	mov    %eax,%edi
+  800caa:	89 c6                	mov    %eax,%esi
+  800cac:	cd 30                	int    $0x30
+  800cae:	5b                   	pop    %ebx
+  800caf:	5e                   	pop    %esi
+  800cb0:	5f                   	pop    %edi
+  800cb1:	5d                   	pop    %ebp
+  800cb2:	c3                   	ret
+  800cb3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cb8:	0f a2                	cpuid
+  800cba:	c1 ea 0b             	shr    $0xb,%edx
+  800cbd:	83 e2 01             	and    $0x1,%edx
+  800cc0:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800cc6:	eb ca                	jmp    800c92 <sys_cputs+0xf>
+  800cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd3:	89 c3                	mov    %eax,%ebx
+  800cd5:	89 c7                	mov    %eax,%edi
+  800cd7:	89 c6                	mov    %eax,%esi
+  800cd9:	55                   	push   %ebp
+  800cda:	68 e3 0c 80 00       	push   $0x800ce3
+  800cdf:	89 e5                	mov    %esp,%ebp
+  800ce1:	0f 34                	sysenter
+  800ce3:	83 c4 04             	add    $0x4,%esp
+  800ce6:	5d                   	pop    %ebp
+  800ce7:	eb c5                	jmp    800cae <sys_cputs+0x2b>
+
+00800ce9 <sys_cgetc>:
+  800ce9:	55                   	push   %ebp
+  800cea:	89 e5                	mov    %esp,%ebp
+  800cec:	57                   	push   %edi
+  800ced:	56                   	push   %esi
+  800cee:	53                   	push   %ebx
+  800cef:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800cf6:	78 22                	js     800d1a <sys_cgetc+0x31>
+  800cf8:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800cff:	75 2e                	jne    800d2f <sys_cgetc+0x46>
+  800d01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d06:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d0b:	89 d1                	mov    %edx,%ecx
+  800d0d:	89 d3                	mov    %edx,%ebx
+  800d0f:	89 d7                	mov    %edx,%edi
+  800d11:	89 d6                	mov    %edx,%esi
+  800d13:	cd 30                	int    $0x30
+  800d15:	5b                   	pop    %ebx
+  800d16:	5e                   	pop    %esi
+  800d17:	5f                   	pop    %edi
+  800d18:	5d                   	pop    %ebp
+  800d19:	c3                   	ret
+  800d1a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d1f:	0f a2                	cpuid
+  800d21:	c1 ea 0b             	shr    $0xb,%edx
+  800d24:	83 e2 01             	and    $0x1,%edx
+  800d27:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800d2d:	eb c9                	jmp    800cf8 <sys_cgetc+0xf>
+  800d2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d34:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d39:	89 d1                	mov    %edx,%ecx
+  800d3b:	89 d3                	mov    %edx,%ebx
+  800d3d:	89 d7                	mov    %edx,%edi
+  800d3f:	89 d6                	mov    %edx,%esi
+  800d41:	55                   	push   %ebp
+  800d42:	68 4b 0d 80 00       	push   $0x800d4b
+  800d47:	89 e5                	mov    %esp,%ebp
+  800d49:	0f 34                	sysenter
+  800d4b:	83 c4 04             	add    $0x4,%esp
+  800d4e:	5d                   	pop    %ebp
+  800d4f:	eb c4                	jmp    800d15 <sys_cgetc+0x2c>
+
+00800d51 <sys_env_destroy>:
+  800d51:	55                   	push   %ebp
+  800d52:	89 e5                	mov    %esp,%ebp
+  800d54:	57                   	push   %edi
+  800d55:	56                   	push   %esi
+  800d56:	53                   	push   %ebx
+  800d57:	83 ec 0c             	sub    $0xc,%esp
+  800d5a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d61:	78 2a                	js     800d8d <sys_env_destroy+0x3c>
+  800d63:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d6a:	75 36                	jne    800da2 <sys_env_destroy+0x51>
+  800d6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d71:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d79:	89 cb                	mov    %ecx,%ebx
+  800d7b:	89 cf                	mov    %ecx,%edi
+  800d7d:	89 ce                	mov    %ecx,%esi
+  800d7f:	cd 30                	int    $0x30
+  800d81:	85 c0                	test   %eax,%eax
+  800d83:	7f 40                	jg     800dc5 <sys_env_destroy+0x74>
+  800d85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d88:	5b                   	pop    %ebx
+  800d89:	5e                   	pop    %esi
+  800d8a:	5f                   	pop    %edi
+  800d8b:	5d                   	pop    %ebp
+  800d8c:	c3                   	ret
+  800d8d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d92:	0f a2                	cpuid
+  800d94:	c1 ea 0b             	shr    $0xb,%edx
+  800d97:	83 e2 01             	and    $0x1,%edx
+  800d9a:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800da0:	eb c1                	jmp    800d63 <sys_env_destroy+0x12>
+  800da2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800daa:	b8 03 00 00 00       	mov    $0x3,%eax
+  800daf:	89 cb                	mov    %ecx,%ebx
+  800db1:	89 cf                	mov    %ecx,%edi
+  800db3:	89 ce                	mov    %ecx,%esi
+  800db5:	55                   	push   %ebp
+  800db6:	68 bf 0d 80 00       	push   $0x800dbf
+  800dbb:	89 e5                	mov    %esp,%ebp
+  800dbd:	0f 34                	sysenter
+  800dbf:	83 c4 04             	add    $0x4,%esp
+  800dc2:	5d                   	pop    %ebp
+  800dc3:	eb bc                	jmp    800d81 <sys_env_destroy+0x30>
+  800dc5:	83 ec 0c             	sub    $0xc,%esp
+  800dc8:	50                   	push   %eax
+  800dc9:	6a 03                	push   $0x3
+  800dcb:	68 44 1d 80 00       	push   $0x801d44
+  800dd0:	6a 49                	push   $0x49
+  800dd2:	68 61 1d 80 00       	push   $0x801d61
+  800dd7:	e8 63 f3 ff ff       	call   80013f <_panic>
+
+00800ddc <sys_getenvid>:
+  800ddc:	55                   	push   %ebp
+  800ddd:	89 e5                	mov    %esp,%ebp
+  800ddf:	57                   	push   %edi
+  800de0:	56                   	push   %esi
+  800de1:	53                   	push   %ebx
+  800de2:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800de9:	78 22                	js     800e0d <sys_getenvid+0x31>
+  800deb:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800df2:	75 2e                	jne    800e22 <sys_getenvid+0x46>
+  800df4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dfe:	89 d1                	mov    %edx,%ecx
+  800e00:	89 d3                	mov    %edx,%ebx
+  800e02:	89 d7                	mov    %edx,%edi
+  800e04:	89 d6                	mov    %edx,%esi
+  800e06:	cd 30                	int    $0x30
+  800e08:	5b                   	pop    %ebx
+  800e09:	5e                   	pop    %esi
+  800e0a:	5f                   	pop    %edi
+  800e0b:	5d                   	pop    %ebp
+  800e0c:	c3                   	ret
+  800e0d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e12:	0f a2                	cpuid
+  800e14:	c1 ea 0b             	shr    $0xb,%edx
+  800e17:	83 e2 01             	and    $0x1,%edx
+  800e1a:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800e20:	eb c9                	jmp    800deb <sys_getenvid+0xf>
+  800e22:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e27:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e2c:	89 d1                	mov    %edx,%ecx
+  800e2e:	89 d3                	mov    %edx,%ebx
+  800e30:	89 d7                	mov    %edx,%edi
+  800e32:	89 d6                	mov    %edx,%esi
+  800e34:	55                   	push   %ebp
+  800e35:	68 3e 0e 80 00       	push   $0x800e3e
+  800e3a:	89 e5                	mov    %esp,%ebp
+  800e3c:	0f 34                	sysenter
+  800e3e:	83 c4 04             	add    $0x4,%esp
+  800e41:	5d                   	pop    %ebp
+  800e42:	eb c4                	jmp    800e08 <sys_getenvid+0x2c>
+
+00800e44 <sys_yield>:
+  800e44:	55                   	push   %ebp
+  800e45:	89 e5                	mov    %esp,%ebp
+  800e47:	57                   	push   %edi
+  800e48:	56                   	push   %esi
+  800e49:	53                   	push   %ebx
+  800e4a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e51:	78 22                	js     800e75 <sys_yield+0x31>
+  800e53:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e5a:	75 2e                	jne    800e8a <sys_yield+0x46>
+  800e5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e61:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e66:	89 d1                	mov    %edx,%ecx
+  800e68:	89 d3                	mov    %edx,%ebx
+  800e6a:	89 d7                	mov    %edx,%edi
+  800e6c:	89 d6                	mov    %edx,%esi
+  800e6e:	cd 30                	int    $0x30
+  800e70:	5b                   	pop    %ebx
+  800e71:	5e                   	pop    %esi
+  800e72:	5f                   	pop    %edi
+  800e73:	5d                   	pop    %ebp
+  800e74:	c3                   	ret
+  800e75:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e7a:	0f a2                	cpuid
+  800e7c:	c1 ea 0b             	shr    $0xb,%edx
+  800e7f:	83 e2 01             	and    $0x1,%edx
+  800e82:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800e88:	eb c9                	jmp    800e53 <sys_yield+0xf>
+  800e8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e8f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e94:	89 d1                	mov    %edx,%ecx
+  800e96:	89 d3                	mov    %edx,%ebx
+  800e98:	89 d7                	mov    %edx,%edi
+  800e9a:	89 d6                	mov    %edx,%esi
+  800e9c:	55                   	push   %ebp
+  800e9d:	68 a6 0e 80 00       	push   $0x800ea6
+  800ea2:	89 e5                	mov    %esp,%ebp
+  800ea4:	0f 34                	sysenter
+  800ea6:	83 c4 04             	add    $0x4,%esp
+  800ea9:	5d                   	pop    %ebp
+  800eaa:	eb c4                	jmp    800e70 <sys_yield+0x2c>
+
+00800eac <sys_env_set_cow>:
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	57                   	push   %edi
+  800eb0:	56                   	push   %esi
+  800eb1:	53                   	push   %ebx
+  800eb2:	83 ec 0c             	sub    $0xc,%esp
+  800eb5:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800ebc:	78 2b                	js     800ee9 <sys_env_set_cow+0x3d>
+  800ebe:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800ec5:	75 37                	jne    800efe <sys_env_set_cow+0x52>
+  800ec7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ecc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ed1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed7:	89 df                	mov    %ebx,%edi
+  800ed9:	89 de                	mov    %ebx,%esi
+  800edb:	cd 30                	int    $0x30
+  800edd:	85 c0                	test   %eax,%eax
+  800edf:	7f 41                	jg     800f22 <sys_env_set_cow+0x76>
+  800ee1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee4:	5b                   	pop    %ebx
+  800ee5:	5e                   	pop    %esi
+  800ee6:	5f                   	pop    %edi
+  800ee7:	5d                   	pop    %ebp
+  800ee8:	c3                   	ret
+  800ee9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eee:	0f a2                	cpuid
+  800ef0:	c1 ea 0b             	shr    $0xb,%edx
+  800ef3:	83 e2 01             	and    $0x1,%edx
+  800ef6:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800efc:	eb c0                	jmp    800ebe <sys_env_set_cow+0x12>
+  800efe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f09:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f0e:	89 df                	mov    %ebx,%edi
+  800f10:	89 de                	mov    %ebx,%esi
+  800f12:	55                   	push   %ebp
+  800f13:	68 1c 0f 80 00       	push   $0x800f1c
+  800f18:	89 e5                	mov    %esp,%ebp
+  800f1a:	0f 34                	sysenter
+  800f1c:	83 c4 04             	add    $0x4,%esp
+  800f1f:	5d                   	pop    %ebp
+  800f20:	eb bb                	jmp    800edd <sys_env_set_cow+0x31>
+  800f22:	83 ec 0c             	sub    $0xc,%esp
+  800f25:	50                   	push   %eax
+  800f26:	6a 0d                	push   $0xd
+  800f28:	68 44 1d 80 00       	push   $0x801d44
+  800f2d:	6a 49                	push   $0x49
+  800f2f:	68 61 1d 80 00       	push   $0x801d61
+  800f34:	e8 06 f2 ff ff       	call   80013f <_panic>
+
+00800f39 <sys_env_set_quota>:
+  800f39:	55                   	push   %ebp
+  800f3a:	89 e5                	mov    %esp,%ebp
+  800f3c:	57                   	push   %edi
+  800f3d:	56                   	push   %esi
+  800f3e:	53                   	push   %ebx
+  800f3f:	83 ec 0c             	sub    $0xc,%esp
+  800f42:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f49:	78 2b                	js     800f76 <sys_env_set_quota+0x3d>
+  800f4b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f52:	75 37                	jne    800f8b <sys_env_set_quota+0x52>
+  800f54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f59:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f64:	89 df                	mov    %ebx,%edi
+  800f66:	89 de                	mov    %ebx,%esi
+  800f68:	cd 30                	int    $0x30
+  800f6a:	85 c0                	test   %eax,%eax
+  800f6c:	7f 41                	jg     800faf <sys_env_set_quota+0x76>
+  800f6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f71:	5b                   	pop    %ebx
+  800f72:	5e                   	pop    %esi
+  800f73:	5f                   	pop    %edi
+  800f74:	5d                   	pop    %ebp
+  800f75:	c3                   	ret
+  800f76:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f7b:	0f a2                	cpuid
+  800f7d:	c1 ea 0b             	shr    $0xb,%edx
+  800f80:	83 e2 01             	and    $0x1,%edx
+  800f83:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800f89:	eb c0                	jmp    800f4b <sys_env_set_quota+0x12>
+  800f8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f96:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f9b:	89 df                	mov    %ebx,%edi
+  800f9d:	89 de                	mov    %ebx,%esi
+  800f9f:	55                   	push   %ebp
+  800fa0:	68 a9 0f 80 00       	push   $0x800fa9
+  800fa5:	89 e5                	mov    %esp,%ebp
+  800fa7:	0f 34                	sysenter
+  800fa9:	83 c4 04             	add    $0x4,%esp
+  800fac:	5d                   	pop    %ebp
+  800fad:	eb bb                	jmp    800f6a <sys_env_set_quota+0x31>
+  800faf:	83 ec 0c             	sub    $0xc,%esp
+  800fb2:	50                   	push   %eax
+  800fb3:	6a 0f                	push   $0xf
+  800fb5:	68 44 1d 80 00       	push   $0x801d44
+  800fba:	6a 49                	push   $0x49
+  800fbc:	68 61 1d 80 00       	push   $0x801d61
+  800fc1:	e8 79 f1 ff ff       	call   80013f <_panic>
+
+00800fc6 <sys_page_alloc>:
+  800fc6:	55                   	push   %ebp
+  800fc7:	89 e5                	mov    %esp,%ebp
+  800fc9:	57                   	push   %edi
+  800fca:	56                   	push   %esi
+  800fcb:	53                   	push   %ebx
+  800fcc:	83 ec 0c             	sub    $0xc,%esp
+  800fcf:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800fd6:	78 2c                	js     801004 <sys_page_alloc+0x3e>
+  800fd8:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800fdf:	75 38                	jne    801019 <sys_page_alloc+0x53>
+  800fe1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800feb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff4:	89 f7                	mov    %esi,%edi
+  800ff6:	cd 30                	int    $0x30
+  800ff8:	85 c0                	test   %eax,%eax
+  800ffa:	7f 42                	jg     80103e <sys_page_alloc+0x78>
+  800ffc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fff:	5b                   	pop    %ebx
+  801000:	5e                   	pop    %esi
+  801001:	5f                   	pop    %edi
+  801002:	5d                   	pop    %ebp
+  801003:	c3                   	ret
+  801004:	b8 01 00 00 00       	mov    $0x1,%eax
+  801009:	0f a2                	cpuid
+  80100b:	c1 ea 0b             	shr    $0xb,%edx
+  80100e:	83 e2 01             	and    $0x1,%edx
+  801011:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801017:	eb bf                	jmp    800fd8 <sys_page_alloc+0x12>
+  801019:	be 00 00 00 00       	mov    $0x0,%esi
+  80101e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801021:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801024:	b8 04 00 00 00       	mov    $0x4,%eax
+  801029:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80102c:	89 f7                	mov    %esi,%edi
+  80102e:	55                   	push   %ebp
+  80102f:	68 38 10 80 00       	push   $0x801038
+  801034:	89 e5                	mov    %esp,%ebp
+  801036:	0f 34                	sysenter
+  801038:	83 c4 04             	add    $0x4,%esp
+  80103b:	5d                   	pop    %ebp
+  80103c:	eb ba                	jmp    800ff8 <sys_page_alloc+0x32>
+  80103e:	83 ec 0c             	sub    $0xc,%esp
+  801041:	50                   	push   %eax
+  801042:	6a 04                	push   $0x4
+  801044:	68 44 1d 80 00       	push   $0x801d44
+  801049:	6a 49                	push   $0x49
+  80104b:	68 61 1d 80 00       	push   $0x801d61
+  801050:	e8 ea f0 ff ff       	call   80013f <_panic>
+
+00801055 <sys_page_map>:
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	57                   	push   %edi
+  801059:	56                   	push   %esi
+  80105a:	53                   	push   %ebx
+  80105b:	83 ec 0c             	sub    $0xc,%esp
+  80105e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801065:	78 2b                	js     801092 <sys_page_map+0x3d>
+  801067:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80106e:	75 37                	jne    8010a7 <sys_page_map+0x52>
+  801070:	b8 05 00 00 00       	mov    $0x5,%eax
+  801075:	8b 55 08             	mov    0x8(%ebp),%edx
+  801078:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80107e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801081:	8b 75 18             	mov    0x18(%ebp),%esi
+  801084:	cd 30                	int    $0x30
+  801086:	85 c0                	test   %eax,%eax
+  801088:	7f 41                	jg     8010cb <sys_page_map+0x76>
+  80108a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108d:	5b                   	pop    %ebx
+  80108e:	5e                   	pop    %esi
+  80108f:	5f                   	pop    %edi
+  801090:	5d                   	pop    %ebp
+  801091:	c3                   	ret
+  801092:	b8 01 00 00 00       	mov    $0x1,%eax
+  801097:	0f a2                	cpuid
+  801099:	c1 ea 0b             	shr    $0xb,%edx
+  80109c:	83 e2 01             	and    $0x1,%edx
+  80109f:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8010a5:	eb c0                	jmp    801067 <sys_page_map+0x12>
+  8010a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ad:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010b8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010bb:	55                   	push   %ebp
+  8010bc:	68 c5 10 80 00       	push   $0x8010c5
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	0f 34                	sysenter
+  8010c5:	83 c4 04             	add    $0x4,%esp
+  8010c8:	5d                   	pop    %ebp
+  8010c9:	eb bb                	jmp    801086 <sys_page_map+0x31>
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+  8010ce:	50                   	push   %eax
+  8010cf:	6a 05                	push   $0x5
+  8010d1:	68 44 1d 80 00       	push   $0x801d44
+  8010d6:	6a 49                	push   $0x49
+  8010d8:	68 61 1d 80 00       	push   $0x801d61
+  8010dd:	e8 5d f0 ff ff       	call   80013f <_panic>
+
+008010e2 <sys_page_unmap>:
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	57                   	push   %edi
+  8010e6:	56                   	push   %esi
+  8010e7:	53                   	push   %ebx
+  8010e8:	83 ec 0c             	sub    $0xc,%esp
+  8010eb:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010f2:	78 2b                	js     80111f <sys_page_unmap+0x3d>
+  8010f4:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010fb:	75 37                	jne    801134 <sys_page_unmap+0x52>
+  8010fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801102:	b8 06 00 00 00       	mov    $0x6,%eax
+  801107:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110d:	89 df                	mov    %ebx,%edi
+  80110f:	89 de                	mov    %ebx,%esi
+  801111:	cd 30                	int    $0x30
+  801113:	85 c0                	test   %eax,%eax
+  801115:	7f 41                	jg     801158 <sys_page_unmap+0x76>
+  801117:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111a:	5b                   	pop    %ebx
+  80111b:	5e                   	pop    %esi
+  80111c:	5f                   	pop    %edi
+  80111d:	5d                   	pop    %ebp
+  80111e:	c3                   	ret
+  80111f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801124:	0f a2                	cpuid
+  801126:	c1 ea 0b             	shr    $0xb,%edx
+  801129:	83 e2 01             	and    $0x1,%edx
+  80112c:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801132:	eb c0                	jmp    8010f4 <sys_page_unmap+0x12>
+  801134:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801139:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801144:	89 df                	mov    %ebx,%edi
+  801146:	89 de                	mov    %ebx,%esi
+  801148:	55                   	push   %ebp
+  801149:	68 52 11 80 00       	push   $0x801152
+  80114e:	89 e5                	mov    %esp,%ebp
+  801150:	0f 34                	sysenter
+  801152:	83 c4 04             	add    $0x4,%esp
+  801155:	5d                   	pop    %ebp
+  801156:	eb bb                	jmp    801113 <sys_page_unmap+0x31>
+  801158:	83 ec 0c             	sub    $0xc,%esp
+  80115b:	50                   	push   %eax
+  80115c:	6a 06                	push   $0x6
+  80115e:	68 44 1d 80 00       	push   $0x801d44
+  801163:	6a 49                	push   $0x49
+  801165:	68 61 1d 80 00       	push   $0x801d61
+  80116a:	e8 d0 ef ff ff       	call   80013f <_panic>
+
+0080116f <sys_page_reuse>:
+  80116f:	55                   	push   %ebp
+  801170:	89 e5                	mov    %esp,%ebp
+  801172:	57                   	push   %edi
+  801173:	56                   	push   %esi
+  801174:	53                   	push   %ebx
+  801175:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80117c:	78 24                	js     8011a2 <sys_page_reuse+0x33>
+  80117e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801185:	75 30                	jne    8011b7 <sys_page_reuse+0x48>
+  801187:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801191:	8b 55 08             	mov    0x8(%ebp),%edx
+  801194:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801197:	89 df                	mov    %ebx,%edi
+  801199:	89 de                	mov    %ebx,%esi
+  80119b:	cd 30                	int    $0x30
+  80119d:	5b                   	pop    %ebx
+  80119e:	5e                   	pop    %esi
+  80119f:	5f                   	pop    %edi
+  8011a0:	5d                   	pop    %ebp
+  8011a1:	c3                   	ret
+  8011a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011a7:	0f a2                	cpuid
+  8011a9:	c1 ea 0b             	shr    $0xb,%edx
+  8011ac:	83 e2 01             	and    $0x1,%edx
+  8011af:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8011b5:	eb c7                	jmp    80117e <sys_page_reuse+0xf>
+  8011b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011c7:	89 df                	mov    %ebx,%edi
+  8011c9:	89 de                	mov    %ebx,%esi
+  8011cb:	55                   	push   %ebp
+  8011cc:	68 d5 11 80 00       	push   $0x8011d5
+  8011d1:	89 e5                	mov    %esp,%ebp
+  8011d3:	0f 34                	sysenter
+  8011d5:	83 c4 04             	add    $0x4,%esp
+  8011d8:	5d                   	pop    %ebp
+  8011d9:	eb c2                	jmp    80119d <sys_page_reuse+0x2e>
+
+008011db <sys_env_set_status>:
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	57                   	push   %edi
+  8011df:	56                   	push   %esi
+  8011e0:	53                   	push   %ebx
+  8011e1:	83 ec 0c             	sub    $0xc,%esp
+  8011e4:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011eb:	78 2b                	js     801218 <sys_env_set_status+0x3d>
+  8011ed:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011f4:	75 37                	jne    80122d <sys_env_set_status+0x52>
+  8011f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fb:	b8 08 00 00 00       	mov    $0x8,%eax
+  801200:	8b 55 08             	mov    0x8(%ebp),%edx
+  801203:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801206:	89 df                	mov    %ebx,%edi
+  801208:	89 de                	mov    %ebx,%esi
+  80120a:	cd 30                	int    $0x30
+  80120c:	85 c0                	test   %eax,%eax
+  80120e:	7f 41                	jg     801251 <sys_env_set_status+0x76>
+  801210:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801213:	5b                   	pop    %ebx
+  801214:	5e                   	pop    %esi
+  801215:	5f                   	pop    %edi
+  801216:	5d                   	pop    %ebp
+  801217:	c3                   	ret
+  801218:	b8 01 00 00 00       	mov    $0x1,%eax
+  80121d:	0f a2                	cpuid
+  80121f:	c1 ea 0b             	shr    $0xb,%edx
+  801222:	83 e2 01             	and    $0x1,%edx
+  801225:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80122b:	eb c0                	jmp    8011ed <sys_env_set_status+0x12>
+  80122d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801232:	8b 55 08             	mov    0x8(%ebp),%edx
+  801235:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801238:	b8 08 00 00 00       	mov    $0x8,%eax
+  80123d:	89 df                	mov    %ebx,%edi
+  80123f:	89 de                	mov    %ebx,%esi
+  801241:	55                   	push   %ebp
+  801242:	68 4b 12 80 00       	push   $0x80124b
+  801247:	89 e5                	mov    %esp,%ebp
+  801249:	0f 34                	sysenter
+  80124b:	83 c4 04             	add    $0x4,%esp
+  80124e:	5d                   	pop    %ebp
+  80124f:	eb bb                	jmp    80120c <sys_env_set_status+0x31>
+  801251:	83 ec 0c             	sub    $0xc,%esp
+  801254:	50                   	push   %eax
+  801255:	6a 08                	push   $0x8
+  801257:	68 44 1d 80 00       	push   $0x801d44
+  80125c:	6a 49                	push   $0x49
+  80125e:	68 61 1d 80 00       	push   $0x801d61
+  801263:	e8 d7 ee ff ff       	call   80013f <_panic>
+
+00801268 <sys_env_set_pgfault_upcall>:
+  801268:	55                   	push   %ebp
+  801269:	89 e5                	mov    %esp,%ebp
+  80126b:	57                   	push   %edi
+  80126c:	56                   	push   %esi
+  80126d:	53                   	push   %ebx
+  80126e:	83 ec 0c             	sub    $0xc,%esp
+  801271:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801278:	78 2b                	js     8012a5 <sys_env_set_pgfault_upcall+0x3d>
+  80127a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801281:	75 37                	jne    8012ba <sys_env_set_pgfault_upcall+0x52>
+  801283:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801288:	b8 09 00 00 00       	mov    $0x9,%eax
+  80128d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801290:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801293:	89 df                	mov    %ebx,%edi
+  801295:	89 de                	mov    %ebx,%esi
+  801297:	cd 30                	int    $0x30
+  801299:	85 c0                	test   %eax,%eax
+  80129b:	7f 41                	jg     8012de <sys_env_set_pgfault_upcall+0x76>
+  80129d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a0:	5b                   	pop    %ebx
+  8012a1:	5e                   	pop    %esi
+  8012a2:	5f                   	pop    %edi
+  8012a3:	5d                   	pop    %ebp
+  8012a4:	c3                   	ret
+  8012a5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012aa:	0f a2                	cpuid
+  8012ac:	c1 ea 0b             	shr    $0xb,%edx
+  8012af:	83 e2 01             	and    $0x1,%edx
+  8012b2:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8012b8:	eb c0                	jmp    80127a <sys_env_set_pgfault_upcall+0x12>
+  8012ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012ca:	89 df                	mov    %ebx,%edi
+  8012cc:	89 de                	mov    %ebx,%esi
+  8012ce:	55                   	push   %ebp
+  8012cf:	68 d8 12 80 00       	push   $0x8012d8
+  8012d4:	89 e5                	mov    %esp,%ebp
+  8012d6:	0f 34                	sysenter
+  8012d8:	83 c4 04             	add    $0x4,%esp
+  8012db:	5d                   	pop    %ebp
+  8012dc:	eb bb                	jmp    801299 <sys_env_set_pgfault_upcall+0x31>
+  8012de:	83 ec 0c             	sub    $0xc,%esp
+  8012e1:	50                   	push   %eax
+  8012e2:	6a 09                	push   $0x9
+  8012e4:	68 44 1d 80 00       	push   $0x801d44
+  8012e9:	6a 49                	push   $0x49
+  8012eb:	68 61 1d 80 00       	push   $0x801d61
+  8012f0:	e8 4a ee ff ff       	call   80013f <_panic>
+
+008012f5 <sys_env_set_trace>:
+  8012f5:	55                   	push   %ebp
+  8012f6:	89 e5                	mov    %esp,%ebp
+  8012f8:	57                   	push   %edi
+  8012f9:	56                   	push   %esi
+  8012fa:	53                   	push   %ebx
+  8012fb:	83 ec 0c             	sub    $0xc,%esp
+  8012fe:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801305:	78 2b                	js     801332 <sys_env_set_trace+0x3d>
+  801307:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80130e:	75 37                	jne    801347 <sys_env_set_trace+0x52>
+  801310:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801315:	b8 12 00 00 00       	mov    $0x12,%eax
+  80131a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801320:	89 df                	mov    %ebx,%edi
+  801322:	89 de                	mov    %ebx,%esi
+  801324:	cd 30                	int    $0x30
+  801326:	85 c0                	test   %eax,%eax
+  801328:	7f 41                	jg     80136b <sys_env_set_trace+0x76>
+  80132a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132d:	5b                   	pop    %ebx
+  80132e:	5e                   	pop    %esi
+  80132f:	5f                   	pop    %edi
+  801330:	5d                   	pop    %ebp
+  801331:	c3                   	ret
+  801332:	b8 01 00 00 00       	mov    $0x1,%eax
+  801337:	0f a2                	cpuid
+  801339:	c1 ea 0b             	shr    $0xb,%edx
+  80133c:	83 e2 01             	and    $0x1,%edx
+  80133f:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801345:	eb c0                	jmp    801307 <sys_env_set_trace+0x12>
+  801347:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801352:	b8 12 00 00 00       	mov    $0x12,%eax
+  801357:	89 df                	mov    %ebx,%edi
+  801359:	89 de                	mov    %ebx,%esi
+  80135b:	55                   	push   %ebp
+  80135c:	68 65 13 80 00       	push   $0x801365
+  801361:	89 e5                	mov    %esp,%ebp
+  801363:	0f 34                	sysenter
+  801365:	83 c4 04             	add    $0x4,%esp
+  801368:	5d                   	pop    %ebp
+  801369:	eb bb                	jmp    801326 <sys_env_set_trace+0x31>
+  80136b:	83 ec 0c             	sub    $0xc,%esp
+  80136e:	50                   	push   %eax
+  80136f:	6a 12                	push   $0x12
+  801371:	68 44 1d 80 00       	push   $0x801d44
+  801376:	6a 49                	push   $0x49
+  801378:	68 61 1d 80 00       	push   $0x801d61
+  80137d:	e8 bd ed ff ff       	call   80013f <_panic>
+
+00801382 <sys_env_set_rdpmc>:
+  801382:	55                   	push   %ebp
+  801383:	89 e5                	mov    %esp,%ebp
+  801385:	57                   	push   %edi
+  801386:	56                   	push   %esi
+  801387:	53                   	push   %ebx
+  801388:	83 ec 0c             	sub    $0xc,%esp
+  80138b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801392:	78 2b                	js     8013bf <sys_env_set_rdpmc+0x3d>
+  801394:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80139b:	75 37                	jne    8013d4 <sys_env_set_rdpmc+0x52>
+  80139d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a2:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ad:	89 df                	mov    %ebx,%edi
+  8013af:	89 de                	mov    %ebx,%esi
+  8013b1:	cd 30                	int    $0x30
+  8013b3:	85 c0                	test   %eax,%eax
+  8013b5:	7f 41                	jg     8013f8 <sys_env_set_rdpmc+0x76>
+  8013b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ba:	5b                   	pop    %ebx
+  8013bb:	5e                   	pop    %esi
+  8013bc:	5f                   	pop    %edi
+  8013bd:	5d                   	pop    %ebp
+  8013be:	c3                   	ret
+  8013bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013c4:	0f a2                	cpuid
+  8013c6:	c1 ea 0b             	shr    $0xb,%edx
+  8013c9:	83 e2 01             	and    $0x1,%edx
+  8013cc:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8013d2:	eb c0                	jmp    801394 <sys_env_set_rdpmc+0x12>
+  8013d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013df:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013e4:	89 df                	mov    %ebx,%edi
+  8013e6:	89 de                	mov    %ebx,%esi
+  8013e8:	55                   	push   %ebp
+  8013e9:	68 f2 13 80 00       	push   $0x8013f2
+  8013ee:	89 e5                	mov    %esp,%ebp
+  8013f0:	0f 34                	sysenter
+  8013f2:	83 c4 04             	add    $0x4,%esp
+  8013f5:	5d                   	pop    %ebp
+  8013f6:	eb bb                	jmp    8013b3 <sys_env_set_rdpmc+0x31>
+  8013f8:	83 ec 0c             	sub    $0xc,%esp
+  8013fb:	50                   	push   %eax
+  8013fc:	6a 13                	push   $0x13
+  8013fe:	68 44 1d 80 00       	push   $0x801d44
+  801403:	6a 49                	push   $0x49
+  801405:	68 61 1d 80 00       	push   $0x801d61
+  80140a:	e8 30 ed ff ff       	call   80013f <_panic>
+
+0080140f <sys_ring_setup>:
+  80140f:	55                   	push   %ebp
+  801410:	89 e5                	mov    %esp,%ebp
+  801412:	57                   	push   %edi
+  801413:	56                   	push   %esi
+  801414:	53                   	push   %ebx
+  801415:	83 ec 0c             	sub    $0xc,%esp
+  801418:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80141f:	78 29                	js     80144a <sys_ring_setup+0x3b>
+  801421:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801428:	75 35                	jne    80145f <sys_ring_setup+0x50>
+  80142a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80142f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801434:	89 d1                	mov    %edx,%ecx
+  801436:	89 d3                	mov    %edx,%ebx
+  801438:	89 d7                	mov    %edx,%edi
+  80143a:	89 d6                	mov    %edx,%esi
+  80143c:	cd 30                	int    $0x30
+  80143e:	85 c0                	test   %eax,%eax
+  801440:	7f 3f                	jg     801481 <sys_ring_setup+0x72>
+  801442:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801445:	5b                   	pop    %ebx
+  801446:	5e                   	pop    %esi
+  801447:	5f                   	pop    %edi
+  801448:	5d                   	pop    %ebp
+  801449:	c3                   	ret
+  80144a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80144f:	0f a2                	cpuid
+  801451:	c1 ea 0b             	shr    $0xb,%edx
+  801454:	83 e2 01             	and    $0x1,%edx
+  801457:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80145d:	eb c2                	jmp    801421 <sys_ring_setup+0x12>
+  80145f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801464:	b8 10 00 00 00       	mov    $0x10,%eax
+  801469:	89 d1                	mov    %edx,%ecx
+  80146b:	89 d3                	mov    %edx,%ebx
+  80146d:	89 d7                	mov    %edx,%edi
+  80146f:	89 d6                	mov    %edx,%esi
+  801471:	55                   	push   %ebp
+  801472:	68 7b 14 80 00       	push   $0x80147b
+  801477:	89 e5                	mov    %esp,%ebp
+  801479:	0f 34                	sysenter
+  80147b:	83 c4 04             	add    $0x4,%esp
+  80147e:	5d                   	pop    %ebp
+  80147f:	eb bd                	jmp    80143e <sys_ring_setup+0x2f>
+  801481:	83 ec 0c             	sub    $0xc,%esp
+  801484:	50                   	push   %eax
+  801485:	6a 10                	push   $0x10
+  801487:	68 44 1d 80 00       	push   $0x801d44
+  80148c:	6a 49                	push   $0x49
+  80148e:	68 61 1d 80 00       	push   $0x801d61
+  801493:	e8 a7 ec ff ff       	call   80013f <_panic>
+
+00801498 <sys_ring_enter>:
+  801498:	55                   	push   %ebp
+  801499:	89 e5                	mov    %esp,%ebp
+  80149b:	57                   	push   %edi
+  80149c:	56                   	push   %esi
+  80149d:	53                   	push   %ebx
+  80149e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014a5:	78 22                	js     8014c9 <sys_ring_enter+0x31>
+  8014a7:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014ae:	75 2e                	jne    8014de <sys_ring_enter+0x46>
+  8014b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b5:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014ba:	89 d1                	mov    %edx,%ecx
+  8014bc:	89 d3                	mov    %edx,%ebx
+  8014be:	89 d7                	mov    %edx,%edi
+  8014c0:	89 d6                	mov    %edx,%esi
+  8014c2:	cd 30                	int    $0x30
+  8014c4:	5b                   	pop    %ebx
+  8014c5:	5e                   	pop    %esi
+  8014c6:	5f                   	pop    %edi
+  8014c7:	5d                   	pop    %ebp
+  8014c8:	c3                   	ret
+  8014c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014ce:	0f a2                	cpuid
+  8014d0:	c1 ea 0b             	shr    $0xb,%edx
+  8014d3:	83 e2 01             	and    $0x1,%edx
+  8014d6:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8014dc:	eb c9                	jmp    8014a7 <sys_ring_enter+0xf>
+  8014de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e3:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014e8:	89 d1                	mov    %edx,%ecx
+  8014ea:	89 d3                	mov    %edx,%ebx
+  8014ec:	89 d7                	mov    %edx,%edi
+  8014ee:	89 d6                	mov    %edx,%esi
+  8014f0:	55                   	push   %ebp
+  8014f1:	68 fa 14 80 00       	push   $0x8014fa
+  8014f6:	89 e5                	mov    %esp,%ebp
+  8014f8:	0f 34                	sysenter
+  8014fa:	83 c4 04             	add    $0x4,%esp
+  8014fd:	5d                   	pop    %ebp
+  8014fe:	eb c4                	jmp    8014c4 <sys_ring_enter+0x2c>
+
+00801500 <sys_ipc_try_send>:
+  801500:	55                   	push   %ebp
+  801501:	89 e5                	mov    %esp,%ebp
+  801503:	57                   	push   %edi
+  801504:	56                   	push   %esi
+  801505:	53                   	push   %ebx
+  801506:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80150d:	78 26                	js     801535 <sys_ipc_try_send+0x35>
+  80150f:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801516:	75 32                	jne    80154a <sys_ipc_try_send+0x4a>
+  801518:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80151d:	be 00 00 00 00       	mov    $0x0,%esi
+  801522:	8b 55 08             	mov    0x8(%ebp),%edx
+  801525:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801528:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80152b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80152e:	cd 30                	int    $0x30
+  801530:	5b                   	pop    %ebx
+  801531:	5e                   	pop    %esi
+  801532:	5f                   	pop    %edi
+  801533:	5d                   	pop    %ebp
+  801534:	c3                   	ret
+  801535:	b8 01 00 00 00       	mov    $0x1,%eax
+  80153a:	0f a2                	cpuid
+  80153c:	c1 ea 0b             	shr    $0xb,%edx
+  80153f:	83 e2 01             	and    $0x1,%edx
+  801542:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801548:	eb c5                	jmp    80150f <sys_ipc_try_send+0xf>
+  80154a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801550:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801555:	be 00 00 00 00       	mov    $0x0,%esi
+  80155a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80155d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801560:	55                   	push   %ebp
+  801561:	68 6a 15 80 00       	push   $0x80156a
+  801566:	89 e5                	mov    %esp,%ebp
+  801568:	0f 34                	sysenter
+  80156a:	83 c4 04             	add    $0x4,%esp
+  80156d:	5d                   	pop    %ebp
+  80156e:	eb c0                	jmp    801530 <sys_ipc_try_send+0x30>
+
+00801570 <sys_ipc_recv>:
+  801570:	55                   	push   %ebp
+  801571:	89 e5                	mov    %esp,%ebp
+  801573:	57                   	push   %edi
+  801574:	56                   	push   %esi
+  801575:	53                   	push   %ebx
+  801576:	83 ec 0c             	sub    $0xc,%esp
+  801579:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801580:	78 2a                	js     8015ac <sys_ipc_recv+0x3c>
+  801582:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801589:	75 36                	jne    8015c1 <sys_ipc_recv+0x51>
+  80158b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801590:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801595:	8b 55 08             	mov    0x8(%ebp),%edx
+  801598:	89 cb                	mov    %ecx,%ebx
+  80159a:	89 cf                	mov    %ecx,%edi
+  80159c:	89 ce                	mov    %ecx,%esi
+  80159e:	cd 30                	int    $0x30
+  8015a0:	85 c0                	test   %eax,%eax
+  8015a2:	7f 40                	jg     8015e4 <sys_ipc_recv+0x74>
+  8015a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a7:	5b                   	pop    %ebx
+  8015a8:	5e                   	pop    %esi
+  8015a9:	5f                   	pop    %edi
+  8015aa:	5d                   	pop    %ebp
+  8015ab:	c3                   	ret
+  8015ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015b1:	0f a2                	cpuid
+  8015b3:	c1 ea 0b             	shr    $0xb,%edx
+  8015b6:	83 e2 01             	and    $0x1,%edx
+  8015b9:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8015bf:	eb c1                	jmp    801582 <sys_ipc_recv+0x12>
+  8015c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015c9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8015ce:	89 cb                	mov    %ecx,%ebx
+  8015d0:	89 cf                	mov    %ecx,%edi
+  8015d2:	89 ce                	mov    %ecx,%esi
+  8015d4:	55                   	push   %ebp
+  8015d5:	68 de 15 80 00       	push   $0x8015de
+  8015da:	89 e5                	mov    %esp,%ebp
+  8015dc:	0f 34                	sysenter
+  8015de:	83 c4 04             	add    $0x4,%esp
+  8015e1:	5d                   	pop    %ebp
+  8015e2:	eb bc                	jmp    8015a0 <sys_ipc_recv+0x30>
+  8015e4:	83 ec 0c             	sub    $0xc,%esp
+  8015e7:	50                   	push   %eax
+  8015e8:	6a 0c                	push   $0xc
+  8015ea:	68 44 1d 80 00       	push   $0x801d44
+  8015ef:	6a 49                	push   $0x49
+  8015f1:	68 61 1d 80 00       	push   $0x801d61
+  8015f6:	e8 44 eb ff ff       	call   80013f <_panic>
+
+008015fb <uinfo_envid>:
+  8015fb:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  801600:	c3                   	ret
+
+00801601 <uinfo_cpunum>:
+  801601:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  801606:	c3                   	ret
+
+00801607 <uinfo_ticks>:
+  801607:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  80160c:	c3                   	ret
+
+0080160d <uinfo_nsec>:
+  80160d:	55                   	push   %ebp
+  80160e:	89 e5                	mov    %esp,%ebp
+  801610:	57                   	push   %edi
+  801611:	56                   	push   %esi
+  801612:	53                   	push   %ebx
+  801613:	83 ec 1c             	sub    $0x1c,%esp
+  801616:	0f 31                	rdtsc
+  801618:	89 c6                	mov    %eax,%esi
+  80161a:	89 d7                	mov    %edx,%edi
+  80161c:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801622:	b8 00 00 00 00       	mov    $0x0,%eax
+  801627:	ba 00 00 00 00       	mov    $0x0,%edx
+  80162c:	85 c9                	test   %ecx,%ecx
+  80162e:	74 5c                	je     80168c <uinfo_nsec+0x7f>
+  801630:	ba 00 00 00 00       	mov    $0x0,%edx
+  801635:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801638:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80163b:	52                   	push   %edx
+  80163c:	51                   	push   %ecx
+  80163d:	57                   	push   %edi
+  80163e:	56                   	push   %esi
+  80163f:	e8 1f 02 00 00       	call   801863 <__umoddi3>
+  801644:	83 c4 10             	add    $0x10,%esp
+  801647:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  80164d:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  801652:	f7 e3                	mul    %ebx
+  801654:	01 ca                	add    %ecx,%edx
+  801656:	ff 75 e4             	push   -0x1c(%ebp)
+  801659:	ff 75 e0             	push   -0x20(%ebp)
+  80165c:	52                   	push   %edx
+  80165d:	50                   	push   %eax
+  80165e:	e8 28 01 00 00       	call   80178b <__udivdi3>
+  801663:	83 c4 10             	add    $0x10,%esp
+  801666:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801669:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80166c:	ff 75 e4             	push   -0x1c(%ebp)
+  80166f:	ff 75 e0             	push   -0x20(%ebp)
+  801672:	57                   	push   %edi
+  801673:	56                   	push   %esi
+  801674:	e8 12 01 00 00       	call   80178b <__udivdi3>
+  801679:	83 c4 10             	add    $0x10,%esp
+  80167c:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  801682:	f7 e3                	mul    %ebx
+  801684:	01 ca                	add    %ecx,%edx
+  801686:	03 45 d8             	add    -0x28(%ebp),%eax
+  801689:	13 55 dc             	adc    -0x24(%ebp),%edx
+  80168c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80168f:	5b                   	pop    %ebx
+  801690:	5e                   	pop    %esi
+  801691:	5f                   	pop    %edi
+  801692:	5d                   	pop    %ebp
+  801693:	c3                   	ret
+
+00801694 <bflush>:
+  801694:	a1 40 20 c0 00       	mov    0xc02040,%eax
+  801699:	85 c0                	test   %eax,%eax
+  80169b:	75 01                	jne    80169e <bflush+0xa>
+  80169d:	c3                   	ret
+  80169e:	55                   	push   %ebp
+  80169f:	89 e5                	mov    %esp,%ebp
+  8016a1:	83 ec 10             	sub    $0x10,%esp
+  8016a4:	50                   	push   %eax
+  8016a5:	68 44 20 c0 00       	push   $0xc02044
+  8016aa:	e8 d4 f5 ff ff       	call   800c83 <sys_cputs>
+  8016af:	c7 05 40 20 c0 00 00 	movl   $0x0,0xc02040
+  8016b6:	00 00 00 
+  8016b9:	83 c4 10             	add    $0x10,%esp
+  8016bc:	c9                   	leave
+  8016bd:	c3                   	ret
+
+008016be <bputch>:
+  8016be:	55                   	push   %ebp
+  8016bf:	89 e5                	mov    %esp,%ebp
+  8016c1:	53                   	push   %ebx
+  8016c2:	83 ec 04             	sub    $0x4,%esp
+  8016c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8016c8:	8b 15 40 20 c0 00    	mov    0xc02040,%edx
+  8016ce:	8d 42 01             	lea    0x1(%edx),%eax
+  8016d1:	a3 40 20 c0 00       	mov    %eax,0xc02040
+  8016d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8016d9:	88 8a 44 20 c0 00    	mov    %cl,0xc02044(%edx)
+  8016df:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8016e4:	77 08                	ja     8016ee <bputch+0x30>
+  8016e6:	83 03 01             	addl   $0x1,(%ebx)
+  8016e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016ec:	c9                   	leave
+  8016ed:	c3                   	ret
+  8016ee:	e8 a1 ff ff ff       	call   801694 <bflush>
+  8016f3:	eb f1                	jmp    8016e6 <bputch+0x28>
+
+008016f5 <vbprintf>:
+  8016f5:	55                   	push   %ebp
+  8016f6:	89 e5                	mov    %esp,%ebp
+  8016f8:	83 ec 18             	sub    $0x18,%esp
+  8016fb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801702:	ff 75 0c             	push   0xc(%ebp)
+  801705:	ff 75 08             	push   0x8(%ebp)
+  801708:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80170b:	50                   	push   %eax
+  80170c:	68 be 16 80 00       	push   $0x8016be
+  801711:	e8 00 ec ff ff       	call   800316 <vprintfmt>
+  801716:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801719:	c9                   	leave
+  80171a:	c3                   	ret
+
+0080171b <bprintf>:
+  80171b:	55                   	push   %ebp
+  80171c:	89 e5                	mov    %esp,%ebp
+  80171e:	83 ec 10             	sub    $0x10,%esp
+  801721:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801724:	50                   	push   %eax
+  801725:	ff 75 08             	push   0x8(%ebp)
+  801728:	e8 c8 ff ff ff       	call   8016f5 <vbprintf>
+  80172d:	c9                   	leave
+  80172e:	c3                   	ret
+
+0080172f <bwrite>:
+  80172f:	55                   	push   %ebp
+  801730:	89 e5                	mov    %esp,%ebp
+  801732:	53                   	push   %ebx
+  801733:	83 ec 04             	sub    $0x4,%esp
+  801736:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801739:	89 d8                	mov    %ebx,%eax
+  80173b:	03 05 40 20 c0 00    	add    0xc02040,%eax
+  801741:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801746:	76 0d                	jbe    801755 <bwrite+0x26>
+  801748:	e8 47 ff ff ff       	call   801694 <bflush>
+  80174d:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801753:	77 25                	ja     80177a <bwrite+0x4b>
+  801755:	83 ec 04             	sub    $0x4,%esp
+  801758:	53                   	push   %ebx
+  801759:	ff 75 08             	push   0x8(%ebp)
+  80175c:	a1 40 20 c0 00       	mov    0xc02040,%eax
+  801761:	05 44 20 c0 00       	add    $0xc02044,%eax
+  801766:	50                   	push   %eax
+  801767:	e8 15 f3 ff ff       	call   800a81 <memcpy>
+  80176c:	01 1d 40 20 c0 00    	add    %ebx,0xc02040
+  801772:	83 c4 10             	add    $0x10,%esp
+  801775:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801778:	c9                   	leave
+  801779:	c3                   	ret
+  80177a:	83 ec 08             	sub    $0x8,%esp
+  80177d:	53                   	push   %ebx
+  80177e:	ff 75 08             	push   0x8(%ebp)
+  801781:	e8 fd f4 ff ff       	call   800c83 <sys_cputs>
+  801786:	83 c4 10             	add    $0x10,%esp
+  801789:	eb ea                	jmp    801775 <bwrite+0x46>
+
+0080178b <__udivdi3>:
+  80178b:	57                   	push   %edi
+  80178c:	56                   	push   %esi
+  80178d:	53                   	push   %ebx
+  80178e:	83 ec 20             	sub    $0x20,%esp
+  801791:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801795:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801799:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80179d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8017a1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8017a5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8017a9:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8017ad:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8017b1:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8017b5:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8017b9:	89 d1                	mov    %edx,%ecx
+  8017bb:	09 c1                	or     %eax,%ecx
+  8017bd:	0f 84 91 00 00 00    	je     801854 <__udivdi3+0xc9>
+  8017c3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8017ca:	00 
+  8017cb:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8017d2:	00 
+  8017d3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8017d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e2:	eb 08                	jmp    8017ec <__udivdi3+0x61>
+  8017e4:	83 e9 01             	sub    $0x1,%ecx
+  8017e7:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8017ea:	74 68                	je     801854 <__udivdi3+0xc9>
+  8017ec:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8017f0:	01 c0                	add    %eax,%eax
+  8017f2:	89 c6                	mov    %eax,%esi
+  8017f4:	89 d7                	mov    %edx,%edi
+  8017f6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8017fa:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8017fe:	0f ad d0             	shrd   %cl,%edx,%eax
+  801801:	d3 ea                	shr    %cl,%edx
+  801803:	f6 c1 20             	test   $0x20,%cl
+  801806:	74 04                	je     80180c <__udivdi3+0x81>
+  801808:	89 d0                	mov    %edx,%eax
+  80180a:	31 d2                	xor    %edx,%edx
+  80180c:	83 e0 01             	and    $0x1,%eax
+  80180f:	89 04 24             	mov    %eax,(%esp)
+  801812:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  801819:	00 
+  80181a:	8b 04 24             	mov    (%esp),%eax
+  80181d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  801821:	09 f0                	or     %esi,%eax
+  801823:	09 fa                	or     %edi,%edx
+  801825:	8b 74 24 10          	mov    0x10(%esp),%esi
+  801829:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80182d:	39 f0                	cmp    %esi,%eax
+  80182f:	89 d3                	mov    %edx,%ebx
+  801831:	19 fb                	sbb    %edi,%ebx
+  801833:	72 af                	jb     8017e4 <__udivdi3+0x59>
+  801835:	29 f0                	sub    %esi,%eax
+  801837:	19 fa                	sbb    %edi,%edx
+  801839:	89 cf                	mov    %ecx,%edi
+  80183b:	c1 ef 05             	shr    $0x5,%edi
+  80183e:	83 e7 01             	and    $0x1,%edi
+  801841:	89 fe                	mov    %edi,%esi
+  801843:	83 f6 01             	xor    $0x1,%esi
+  801846:	d3 e6                	shl    %cl,%esi
+  801848:	d3 e7                	shl    %cl,%edi
+  80184a:	09 74 24 18          	or     %esi,0x18(%esp)
+  80184e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  801852:	eb 90                	jmp    8017e4 <__udivdi3+0x59>
+  801854:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801858:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80185c:	83 c4 20             	add    $0x20,%esp
+  80185f:	5b                   	pop    %ebx
+  801860:	5e                   	pop    %esi
+  801861:	5f                   	pop    %edi
+  801862:	c3                   	ret
+
+00801863 <__umoddi3>:
+  801863:	55                   	push   %ebp
+  801864:	57                   	push   %edi
+  801865:	56                   	push   %esi
+  801866:	53                   	push   %ebx
+  801867:	83 ec 1c             	sub    $0x1c,%esp
+  80186a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80186e:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801872:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801876:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80187a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80187e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801882:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801886:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80188a:	89 d6                	mov    %edx,%esi
+  80188c:	09 c6                	or     %eax,%esi
+  80188e:	74 6c                	je     8018fc <__umoddi3+0x99>
+  801890:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189f:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  8018a3:	eb 0e                	jmp    8018b3 <__umoddi3+0x50>
+  8018a5:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  8018aa:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8018ae:	83 fe ff             	cmp    $0xffffffff,%esi
+  8018b1:	74 49                	je     8018fc <__umoddi3+0x99>
+  8018b3:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8018b7:	01 c0                	add    %eax,%eax
+  8018b9:	89 c3                	mov    %eax,%ebx
+  8018bb:	89 d6                	mov    %edx,%esi
+  8018bd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8018c1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8018c5:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  8018ca:	0f ad d0             	shrd   %cl,%edx,%eax
+  8018cd:	d3 ea                	shr    %cl,%edx
+  8018cf:	f6 c1 20             	test   $0x20,%cl
+  8018d2:	74 04                	je     8018d8 <__umoddi3+0x75>
+  8018d4:	89 d0                	mov    %edx,%eax
+  8018d6:	31 d2                	xor    %edx,%edx
+  8018d8:	83 e0 01             	and    $0x1,%eax
+  8018db:	bd 00 00 00 00       	mov    $0x0,%ebp
+  8018e0:	89 ea                	mov    %ebp,%edx
+  8018e2:	09 d8                	or     %ebx,%eax
+  8018e4:	09 f2                	or     %esi,%edx
+  8018e6:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  8018ea:	8b 74 24 14          	mov    0x14(%esp),%esi
+  8018ee:	39 d8                	cmp    %ebx,%eax
+  8018f0:	89 d1                	mov    %edx,%ecx
+  8018f2:	19 f1                	sbb    %esi,%ecx
+  8018f4:	72 af                	jb     8018a5 <__umoddi3+0x42>
+  8018f6:	29 d8                	sub    %ebx,%eax
+  8018f8:	19 f2                	sbb    %esi,%edx
+  8018fa:	eb a9                	jmp    8018a5 <__umoddi3+0x42>
+  8018fc:	83 c4 1c             	add    $0x1c,%esp
+  8018ff:	5b                   	pop    %ebx
+  801900:	5e                   	pop    %esi
+  801901:	5f                   	pop    %edi
+  801902:	5d                   	pop    %ebp
+  801903:	c3                   	ret
+
+00801904 <__divdi3>:
+  801904:	53                   	push   %ebx
+  801905:	8b 44 24 08          	mov    0x8(%esp),%eax
+  801909:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80190d:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  801911:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  801915:	85 d2                	test   %edx,%edx
+  801917:	78 12                	js     80192b <__divdi3+0x27>
+  801919:	85 db                	test   %ebx,%ebx
+  80191b:	78 2e                	js     80194b <__divdi3+0x47>
+  80191d:	53                   	push   %ebx
+  80191e:	51                   	push   %ecx
+  80191f:	52                   	push   %edx
+  801920:	50                   	push   %eax
+  801921:	e8 65 fe ff ff       	call   80178b <__udivdi3>
+  801926:	83 c4 10             	add    $0x10,%esp
+  801929:	eb 1e                	jmp    801949 <__divdi3+0x45>
+  80192b:	f7 d8                	neg    %eax
+  80192d:	83 d2 00             	adc    $0x0,%edx
+  801930:	f7 da                	neg    %edx
+  801932:	85 db                	test   %ebx,%ebx
+  801934:	78 2a                	js     801960 <__divdi3+0x5c>
+  801936:	53                   	push   %ebx
+  801937:	51                   	push   %ecx
+  801938:	52                   	push   %edx
+  801939:	50                   	push   %eax
+  80193a:	e8 4c fe ff ff       	call   80178b <__udivdi3>
+  80193f:	83 c4 10             	add    $0x10,%esp
+  801942:	f7 d8                	neg    %eax
+  801944:	83 d2 00             	adc    $0x0,%edx
+  801947:	f7 da                	neg    %edx
+  801949:	5b                   	pop    %ebx
+  80194a:	c3                   	ret
+  80194b:	f7 d9                	neg    %ecx
+  80194d:	83 d3 00             	adc    $0x0,%ebx
+  801950:	f7 db                	neg    %ebx
+  801952:	53                   	push   %ebx
+  801953:	51                   	push   %ecx
+  801954:	52                   	push   %edx
+  801955:	50                   	push   %eax
+  801956:	e8 30 fe ff ff       	call   80178b <__udivdi3>
+  80195b:	83 c4 10             	add    $0x10,%esp
+  80195e:	eb e2                	jmp    801942 <__divdi3+0x3e>
+  801960:	f7 d9                	neg    %ecx
+  801962:	83 d3 00             	adc    $0x0,%ebx
+  801965:	f7 db                	neg    %ebx
+  801967:	53                   	push   %ebx
+  801968:	51                   	push   %ecx
+  801969:	52                   	push   %edx
+  80196a:	50                   	push   %eax
+  80196b:	e8 1b fe ff ff       	call   80178b <__udivdi3>
+  801970:	83 c4 10             	add    $0x10,%esp
+  801973:	eb d4                	jmp    801949 <__divdi3+0x45>
+
+00801975 <__moddi3>:
+  801975:	55                   	push   %ebp
+  801976:	57                   	push   %edi
+  801977:	56                   	push   %esi
+  801978:	53                   	push   %ebx
+  801979:	83 ec 14             	sub    $0x14,%esp
+  80197c:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  801980:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801984:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801988:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80198c:	85 ed                	test   %ebp,%ebp
+  80198e:	78 2b                	js     8019bb <__moddi3+0x46>
+  801990:	89 c6                	mov    %eax,%esi
+  801992:	f7 de                	neg    %esi
+  801994:	89 34 24             	mov    %esi,(%esp)
+  801997:	89 d6                	mov    %edx,%esi
+  801999:	83 d6 00             	adc    $0x0,%esi
+  80199c:	f7 de                	neg    %esi
+  80199e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8019a2:	8b 34 24             	mov    (%esp),%esi
+  8019a5:	0f 48 f0             	cmovs  %eax,%esi
+  8019a8:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  8019ad:	52                   	push   %edx
+  8019ae:	56                   	push   %esi
+  8019af:	55                   	push   %ebp
+  8019b0:	57                   	push   %edi
+  8019b1:	e8 ad fe ff ff       	call   801863 <__umoddi3>
+  8019b6:	83 c4 10             	add    $0x10,%esp
+  8019b9:	eb 3c                	jmp    8019f7 <__moddi3+0x82>
+  8019bb:	89 c3                	mov    %eax,%ebx
+  8019bd:	f7 db                	neg    %ebx
+  8019bf:	89 d1                	mov    %edx,%ecx
+  8019c1:	83 d1 00             	adc    $0x0,%ecx
+  8019c4:	f7 d9                	neg    %ecx
+  8019c6:	0f 49 c3             	cmovns %ebx,%eax
+  8019c9:	89 04 24             	mov    %eax,(%esp)
+  8019cc:	0f 49 d1             	cmovns %ecx,%edx
+  8019cf:	89 54 24 04          	mov    %edx,0x4(%esp)
+  8019d3:	ff 74 24 04          	push   0x4(%esp)
+  8019d7:	ff 74 24 04          	push   0x4(%esp)
+  8019db:	89 f8                	mov    %edi,%eax
+  8019dd:	89 ea                	mov    %ebp,%edx
+  8019df:	f7 d8                	neg    %eax
+  8019e1:	83 d2 00             	adc    $0x0,%edx
+  8019e4:	f7 da                	neg    %edx
+  8019e6:	52                   	push   %edx
+  8019e7:	50                   	push   %eax
+  8019e8:	e8 76 fe ff ff       	call   801863 <__umoddi3>
+  8019ed:	83 c4 10             	add    $0x10,%esp
+  8019f0:	f7 d8                	neg    %eax
+  8019f2:	83 d2 00             	adc    $0x0,%edx
+  8019f5:	f7 da                	neg    %edx
+  8019f7:	83 c4 14             	add    $0x14,%esp
+  8019fa:	5b                   	pop    %ebx
+  8019fb:	5e                   	pop    %esi
+  8019fc:	5f                   	pop    %edi
+  8019fd:	5d                   	pop    %ebp
+  8019fe:	c3                   	ret
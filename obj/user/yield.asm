@@ -0,0 +1,2598 @@
+
+obj/user/yield:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 ff ea    	cmp    $0xeaffe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 69 00 00 00       	call   80009a <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	a1 20 20 80 00       	mov    0x802020,%eax
+  80003f:	8b 40 40             	mov    0x40(%eax),%eax
+  800042:	50                   	push   %eax
+  800043:	68 c0 19 80 00       	push   $0x8019c0
+  800048:	e8 45 01 00 00       	call   800192 <cprintf>
+  80004d:	83 c4 10             	add    $0x10,%esp
+  800050:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800055:	e8 5d 0d 00 00       	call   800db7 <sys_yield>
+  80005a:	a1 20 20 80 00       	mov    0x802020,%eax
+  80005f:	8b 40 40             	mov    0x40(%eax),%eax
+  800062:	83 ec 04             	sub    $0x4,%esp
+  800065:	53                   	push   %ebx
+  800066:	50                   	push   %eax
+  800067:	68 e0 19 80 00       	push   $0x8019e0
+  80006c:	e8 21 01 00 00       	call   800192 <cprintf>
+  800071:	83 c3 01             	add    $0x1,%ebx
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	83 fb 05             	cmp    $0x5,%ebx
+  80007a:	75 d9                	jne    800055 <umain+0x22>
+  80007c:	a1 20 20 80 00       	mov    0x802020,%eax
+  800081:	8b 40 40             	mov    0x40(%eax),%eax
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	50                   	push   %eax
+  800088:	68 0c 1a 80 00       	push   $0x801a0c
+  80008d:	e8 00 01 00 00       	call   800192 <cprintf>
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800098:	c9                   	leave
+  800099:	c3                   	ret
+
+0080009a <libmain>:
+  80009a:	55                   	push   %ebp
+  80009b:	89 e5                	mov    %esp,%ebp
+  80009d:	56                   	push   %esi
+  80009e:	53                   	push   %ebx
+  80009f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000a5:	e8 c4 14 00 00       	call   80156e <uinfo_envid>
+  8000aa:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8000af:	69 c0 80 03 00 00    	imul   $0x380,%eax,%eax
+  8000b5:	05 00 00 00 ed       	add    $0xed000000,%eax
+  8000ba:	a3 20 20 80 00       	mov    %eax,0x802020
+  8000bf:	85 db                	test   %ebx,%ebx
+  8000c1:	7e 07                	jle    8000ca <libmain+0x30>
+  8000c3:	8b 06                	mov    (%esi),%eax
+  8000c5:	a3 00 20 80 00       	mov    %eax,0x802000
+  8000ca:	83 ec 08             	sub    $0x8,%esp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	e8 5f ff ff ff       	call   800033 <umain>
+  8000d4:	e8 0a 00 00 00       	call   8000e3 <exit>
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000df:	5b                   	pop    %ebx
+  8000e0:	5e                   	pop    %esi
+  8000e1:	5d                   	pop    %ebp
+  8000e2:	c3                   	ret
+
+008000e3 <exit>:
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	83 ec 08             	sub    $0x8,%esp
+  8000e9:	e8 19 15 00 00       	call   801607 <bflush>
+  8000ee:	83 ec 0c             	sub    $0xc,%esp
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	e8 cc 0b 00 00       	call   800cc4 <sys_env_destroy>
+  8000f8:	83 c4 10             	add    $0x10,%esp
+  8000fb:	c9                   	leave
+  8000fc:	c3                   	ret
+
+008000fd <putch>:
+  8000fd:	55                   	push   %ebp
+  8000fe:	89 e5                	mov    %esp,%ebp
+  800100:	53                   	push   %ebx
+  800101:	83 ec 04             	sub    $0x4,%esp
+  800104:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800107:	8b 13                	mov    (%ebx),%edx
+  800109:	8d 42 01             	lea    0x1(%edx),%eax
+  80010c:	89 03                	mov    %eax,(%ebx)
+  80010e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800111:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800115:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80011a:	74 09                	je     800125 <putch+0x28>
+  80011c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800120:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800123:	c9                   	leave
+  800124:	c3                   	ret
+  800125:	83 ec 08             	sub    $0x8,%esp
+  800128:	68 ff 00 00 00       	push   $0xff
+  80012d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800130:	50                   	push   %eax
+  800131:	e8 c0 0a 00 00       	call   800bf6 <sys_cputs>
+  800136:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80013c:	83 c4 10             	add    $0x10,%esp
+  80013f:	eb db                	jmp    80011c <putch+0x1f>
+
+00800141 <vcprintf>:
+  800141:	55                   	push   %ebp
+  800142:	89 e5                	mov    %esp,%ebp
+  800144:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80014a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800151:	00 00 00 
+  800154:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80015b:	00 00 00 
+  80015e:	ff 75 0c             	push   0xc(%ebp)
+  800161:	ff 75 08             	push   0x8(%ebp)
+  800164:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80016a:	50                   	push   %eax
+  80016b:	68 fd 00 80 00       	push   $0x8000fd
+  800170:	e8 14 01 00 00       	call   800289 <vprintfmt>
+  800175:	83 c4 08             	add    $0x8,%esp
+  800178:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80017e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800184:	50                   	push   %eax
+  800185:	e8 6c 0a 00 00       	call   800bf6 <sys_cputs>
+  80018a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800190:	c9                   	leave
+  800191:	c3                   	ret
+
+00800192 <cprintf>:
+  800192:	55                   	push   %ebp
+  800193:	89 e5                	mov    %esp,%ebp
+  800195:	83 ec 10             	sub    $0x10,%esp
+  800198:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80019b:	50                   	push   %eax
+  80019c:	ff 75 08             	push   0x8(%ebp)
+  80019f:	e8 9d ff ff ff       	call   800141 <vcprintf>
+  8001a4:	c9                   	leave
+  8001a5:	c3                   	ret
+
+008001a6 <printnum>:
+  8001a6:	55                   	push   %ebp
+  8001a7:	89 e5                	mov    %esp,%ebp
+  8001a9:	57                   	push   %edi
+  8001aa:	56                   	push   %esi
+  8001ab:	53                   	push   %ebx
+  8001ac:	83 ec 1c             	sub    $0x1c,%esp
+  8001af:	89 c7                	mov    %eax,%edi
+  8001b1:	89 d6                	mov    %edx,%esi
+  8001b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001b9:	89 d1                	mov    %edx,%ecx
+  8001bb:	89 c2                	mov    %eax,%edx
+  8001bd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001c0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001c3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001c6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8001c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001cc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001d3:	39 c2                	cmp    %eax,%edx
+  8001d5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001d8:	72 3e                	jb     800218 <printnum+0x72>
+  8001da:	83 ec 0c             	sub    $0xc,%esp
+  8001dd:	ff 75 18             	push   0x18(%ebp)
+  8001e0:	83 eb 01             	sub    $0x1,%ebx
+  8001e3:	53                   	push   %ebx
+  8001e4:	50                   	push   %eax
+  8001e5:	83 ec 08             	sub    $0x8,%esp
+  8001e8:	ff 75 e4             	push   -0x1c(%ebp)
+  8001eb:	ff 75 e0             	push   -0x20(%ebp)
+  8001ee:	ff 75 dc             	push   -0x24(%ebp)
+  8001f1:	ff 75 d8             	push   -0x28(%ebp)
+  8001f4:	e8 50 15 00 00       	call   801749 <__udivdi3>
+  8001f9:	83 c4 18             	add    $0x18,%esp
+  8001fc:	52                   	push   %edx
+  8001fd:	50                   	push   %eax
+  8001fe:	89 f2                	mov    %esi,%edx
+  800200:	89 f8                	mov    %edi,%eax
+  800202:	e8 9f ff ff ff       	call   8001a6 <printnum>
+  800207:	83 c4 20             	add    $0x20,%esp
+  80020a:	eb 13                	jmp    80021f <printnum+0x79>
+  80020c:	83 ec 08             	sub    $0x8,%esp
+  80020f:	56                   	push   %esi
+  800210:	ff 75 18             	push   0x18(%ebp)
+  800213:	ff d7                	call   *%edi
+  800215:	83 c4 10             	add    $0x10,%esp
+  800218:	83 eb 01             	sub    $0x1,%ebx
+  80021b:	85 db                	test   %ebx,%ebx
+  80021d:	7f ed                	jg     80020c <printnum+0x66>
+  80021f:	83 ec 08             	sub    $0x8,%esp
+  800222:	56                   	push   %esi
+  800223:	83 ec 04             	sub    $0x4,%esp
+  800226:	ff 75 e4             	push   -0x1c(%ebp)
+  800229:	ff 75 e0             	push   -0x20(%ebp)
+  80022c:	ff 75 dc             	push   -0x24(%ebp)
+  80022f:	ff 75 d8             	push   -0x28(%ebp)
+  800232:	e8 ea 15 00 00       	call   801821 <__umoddi3>
+  800237:	83 c4 14             	add    $0x14,%esp
+  80023a:	0f be 80 35 1a 80 00 	movsbl 0x801a35(%eax),%eax
+  800241:	50                   	push   %eax
+  800242:	ff d7                	call   *%edi
+  800244:	83 c4 10             	add    $0x10,%esp
+  800247:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024a:	5b                   	pop    %ebx
+  80024b:	5e                   	pop    %esi
+  80024c:	5f                   	pop    %edi
+  80024d:	5d                   	pop    %ebp
+  80024e:	c3                   	ret
+
+0080024f <sprintputch>:
+  80024f:	55                   	push   %ebp
+  800250:	89 e5                	mov    %esp,%ebp
+  800252:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800255:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800259:	8b 10                	mov    (%eax),%edx
+  80025b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80025e:	73 0a                	jae    80026a <sprintputch+0x1b>
+  800260:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800263:	89 08                	mov    %ecx,(%eax)
+  800265:	8b 45 08             	mov    0x8(%ebp),%eax
+  800268:	88 02                	mov    %al,(%edx)
+  80026a:	5d                   	pop    %ebp
+  80026b:	c3                   	ret
+
+0080026c <printfmt>:
+  80026c:	55                   	push   %ebp
+  80026d:	89 e5                	mov    %esp,%ebp
+  80026f:	83 ec 08             	sub    $0x8,%esp
+  800272:	8d 45 14             	lea    0x14(%ebp),%eax
+  800275:	50                   	push   %eax
+  800276:	ff 75 10             	push   0x10(%ebp)
+  800279:	ff 75 0c             	push   0xc(%ebp)
+  80027c:	ff 75 08             	push   0x8(%ebp)
+  80027f:	e8 05 00 00 00       	call   800289 <vprintfmt>
+  800284:	83 c4 10             	add    $0x10,%esp
+  800287:	c9                   	leave
+  800288:	c3                   	ret
+
+00800289 <vprintfmt>:
+  800289:	55                   	push   %ebp
+  80028a:	89 e5                	mov    %esp,%ebp
+  80028c:	57                   	push   %edi
+  80028d:	56                   	push   %esi
+  80028e:	53                   	push   %ebx
+  80028f:	83 ec 2c             	sub    $0x2c,%esp
+  800292:	8b 75 08             	mov    0x8(%ebp),%esi
+  800295:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800298:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80029b:	eb 0a                	jmp    8002a7 <vprintfmt+0x1e>
+  80029d:	83 ec 08             	sub    $0x8,%esp
+  8002a0:	53                   	push   %ebx
+  8002a1:	50                   	push   %eax
+  8002a2:	ff d6                	call   *%esi
+  8002a4:	83 c4 10             	add    $0x10,%esp
+  8002a7:	83 c7 01             	add    $0x1,%edi
+  8002aa:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002ae:	83 f8 25             	cmp    $0x25,%eax
+  8002b1:	74 0c                	je     8002bf <vprintfmt+0x36>
+  8002b3:	85 c0                	test   %eax,%eax
+  8002b5:	75 e6                	jne    80029d <vprintfmt+0x14>
+  8002b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ba:	5b                   	pop    %ebx
+  8002bb:	5e                   	pop    %esi
+  8002bc:	5f                   	pop    %edi
+  8002bd:	5d                   	pop    %ebp
+  8002be:	c3                   	ret
+  8002bf:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+  8002c3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8002ca:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8002d1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  8002d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002dd:	8d 47 01             	lea    0x1(%edi),%eax
+  8002e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002e3:	0f b6 17             	movzbl (%edi),%edx
+  8002e6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002e9:	3c 55                	cmp    $0x55,%al
+  8002eb:	0f 87 cf 03 00 00    	ja     8006c0 <vprintfmt+0x437>
+  8002f1:	0f b6 c0             	movzbl %al,%eax
+  8002f4:	ff 24 85 00 1b 80 00 	jmp    *0x801b00(,%eax,4)
+  8002fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002fe:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800302:	eb d9                	jmp    8002dd <vprintfmt+0x54>
+  800304:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800307:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80030b:	eb d0                	jmp    8002dd <vprintfmt+0x54>
+  80030d:	0f b6 d2             	movzbl %dl,%edx
+  800310:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800313:	b8 00 00 00 00       	mov    $0x0,%eax
+  800318:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  80031b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80031e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+  800322:	0f be 17             	movsbl (%edi),%edx
+  800325:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800328:	83 f9 09             	cmp    $0x9,%ecx
+  80032b:	77 55                	ja     800382 <vprintfmt+0xf9>
+  80032d:	83 c7 01             	add    $0x1,%edi
+  800330:	eb e9                	jmp    80031b <vprintfmt+0x92>
+  800332:	8b 45 14             	mov    0x14(%ebp),%eax
+  800335:	8b 00                	mov    (%eax),%eax
+  800337:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80033a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80033d:	8d 40 04             	lea    0x4(%eax),%eax
+  800340:	89 45 14             	mov    %eax,0x14(%ebp)
+  800343:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800346:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80034a:	79 91                	jns    8002dd <vprintfmt+0x54>
+  80034c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80034f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800352:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800359:	eb 82                	jmp    8002dd <vprintfmt+0x54>
+  80035b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80035e:	85 d2                	test   %edx,%edx
+  800360:	b8 00 00 00 00       	mov    $0x0,%eax
+  800365:	0f 49 c2             	cmovns %edx,%eax
+  800368:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80036b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80036e:	e9 6a ff ff ff       	jmp    8002dd <vprintfmt+0x54>
+  800373:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800376:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80037d:	e9 5b ff ff ff       	jmp    8002dd <vprintfmt+0x54>
+  800382:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800385:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800388:	eb bc                	jmp    800346 <vprintfmt+0xbd>
+  80038a:	83 c1 01             	add    $0x1,%ecx
+  80038d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800390:	e9 48 ff ff ff       	jmp    8002dd <vprintfmt+0x54>
+  800395:	8b 45 14             	mov    0x14(%ebp),%eax
+  800398:	8d 78 04             	lea    0x4(%eax),%edi
+  80039b:	83 ec 08             	sub    $0x8,%esp
+  80039e:	53                   	push   %ebx
+  80039f:	ff 30                	push   (%eax)
+  8003a1:	ff d6                	call   *%esi
+  8003a3:	83 c4 10             	add    $0x10,%esp
+  8003a6:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003a9:	e9 b1 02 00 00       	jmp    80065f <vprintfmt+0x3d6>
+  8003ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b1:	8d 78 04             	lea    0x4(%eax),%edi
+  8003b4:	8b 10                	mov    (%eax),%edx
+  8003b6:	89 d0                	mov    %edx,%eax
+  8003b8:	f7 d8                	neg    %eax
+  8003ba:	0f 48 c2             	cmovs  %edx,%eax
+  8003bd:	83 f8 08             	cmp    $0x8,%eax
+  8003c0:	7f 23                	jg     8003e5 <vprintfmt+0x15c>
+  8003c2:	8b 14 85 60 1c 80 00 	mov    0x801c60(,%eax,4),%edx
+  8003c9:	85 d2                	test   %edx,%edx
+  8003cb:	74 18                	je     8003e5 <vprintfmt+0x15c>
+  8003cd:	52                   	push   %edx
+  8003ce:	68 56 1a 80 00       	push   $0x801a56
+  8003d3:	53                   	push   %ebx
+  8003d4:	56                   	push   %esi
+  8003d5:	e8 92 fe ff ff       	call   80026c <printfmt>
+  8003da:	83 c4 10             	add    $0x10,%esp
+  8003dd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003e0:	e9 7a 02 00 00       	jmp    80065f <vprintfmt+0x3d6>
+  8003e5:	50                   	push   %eax
+  8003e6:	68 4d 1a 80 00       	push   $0x801a4d
+  8003eb:	53                   	push   %ebx
+  8003ec:	56                   	push   %esi
+  8003ed:	e8 7a fe ff ff       	call   80026c <printfmt>
+  8003f2:	83 c4 10             	add    $0x10,%esp
+  8003f5:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003f8:	e9 62 02 00 00       	jmp    80065f <vprintfmt+0x3d6>
+  8003fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800400:	83 c0 04             	add    $0x4,%eax
+  800403:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800406:	8b 45 14             	mov    0x14(%ebp),%eax
+  800409:	8b 08                	mov    (%eax),%ecx
+  80040b:	85 c9                	test   %ecx,%ecx
+  80040d:	b8 46 1a 80 00       	mov    $0x801a46,%eax
+  800412:	0f 45 c1             	cmovne %ecx,%eax
+  800415:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800418:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80041c:	7e 06                	jle    800424 <vprintfmt+0x19b>
+  80041e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800422:	75 0b                	jne    80042f <vprintfmt+0x1a6>
+  800424:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800427:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80042a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80042d:	eb 5c                	jmp    80048b <vprintfmt+0x202>
+  80042f:	83 ec 08             	sub    $0x8,%esp
+  800432:	ff 75 d0             	push   -0x30(%ebp)
+  800435:	ff 75 cc             	push   -0x34(%ebp)
+  800438:	e8 87 03 00 00       	call   8007c4 <strnlen>
+  80043d:	89 c2                	mov    %eax,%edx
+  80043f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800442:	29 d0                	sub    %edx,%eax
+  800444:	83 c4 10             	add    $0x10,%esp
+  800447:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80044b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800451:	89 c6                	mov    %eax,%esi
+  800453:	eb 0e                	jmp    800463 <vprintfmt+0x1da>
+  800455:	83 ec 08             	sub    $0x8,%esp
+  800458:	53                   	push   %ebx
+  800459:	57                   	push   %edi
+  80045a:	ff 55 08             	call   *0x8(%ebp)
+  80045d:	83 ee 01             	sub    $0x1,%esi
+  800460:	83 c4 10             	add    $0x10,%esp
+  800463:	85 f6                	test   %esi,%esi
+  800465:	7f ee                	jg     800455 <vprintfmt+0x1cc>
+  800467:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80046a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80046d:	85 c0                	test   %eax,%eax
+  80046f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800474:	0f 49 d0             	cmovns %eax,%edx
+  800477:	29 d0                	sub    %edx,%eax
+  800479:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80047c:	eb a6                	jmp    800424 <vprintfmt+0x19b>
+  80047e:	83 ec 08             	sub    $0x8,%esp
+  800481:	53                   	push   %ebx
+  800482:	52                   	push   %edx
+  800483:	ff 55 08             	call   *0x8(%ebp)
+  800486:	83 c4 10             	add    $0x10,%esp
+  800489:	89 f1                	mov    %esi,%ecx
+  80048b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80048e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800492:	0f be d0             	movsbl %al,%edx
+  800495:	85 d2                	test   %edx,%edx
+  800497:	74 28                	je     8004c1 <vprintfmt+0x238>
+  800499:	85 ff                	test   %edi,%edi
+  80049b:	78 05                	js     8004a2 <vprintfmt+0x219>
+  80049d:	83 ef 01             	sub    $0x1,%edi
+  8004a0:	78 30                	js     8004d2 <vprintfmt+0x249>
+  8004a2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004a6:	74 d6                	je     80047e <vprintfmt+0x1f5>
+  8004a8:	0f be c0             	movsbl %al,%eax
+  8004ab:	83 e8 20             	sub    $0x20,%eax
+  8004ae:	83 f8 5e             	cmp    $0x5e,%eax
+  8004b1:	76 cb                	jbe    80047e <vprintfmt+0x1f5>
+  8004b3:	83 ec 08             	sub    $0x8,%esp
+  8004b6:	53                   	push   %ebx
+  8004b7:	6a 3f                	push   $0x3f
+  8004b9:	ff 55 08             	call   *0x8(%ebp)
+  8004bc:	83 c4 10             	add    $0x10,%esp
+  8004bf:	eb c8                	jmp    800489 <vprintfmt+0x200>
+  8004c1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004c4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004c7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004ca:	01 d0                	add    %edx,%eax
+  8004cc:	29 c8                	sub    %ecx,%eax
+  8004ce:	89 c7                	mov    %eax,%edi
+  8004d0:	eb 13                	jmp    8004e5 <vprintfmt+0x25c>
+  8004d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d5:	eb ed                	jmp    8004c4 <vprintfmt+0x23b>
+  8004d7:	83 ec 08             	sub    $0x8,%esp
+  8004da:	53                   	push   %ebx
+  8004db:	6a 20                	push   $0x20
+  8004dd:	ff d6                	call   *%esi
+  8004df:	83 ef 01             	sub    $0x1,%edi
+  8004e2:	83 c4 10             	add    $0x10,%esp
+  8004e5:	85 ff                	test   %edi,%edi
+  8004e7:	7f ee                	jg     8004d7 <vprintfmt+0x24e>
+  8004e9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004ec:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004ef:	e9 6b 01 00 00       	jmp    80065f <vprintfmt+0x3d6>
+  8004f4:	83 f9 01             	cmp    $0x1,%ecx
+  8004f7:	7f 1f                	jg     800518 <vprintfmt+0x28f>
+  8004f9:	85 c9                	test   %ecx,%ecx
+  8004fb:	74 67                	je     800564 <vprintfmt+0x2db>
+  8004fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800500:	8b 00                	mov    (%eax),%eax
+  800502:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800505:	89 c1                	mov    %eax,%ecx
+  800507:	c1 f9 1f             	sar    $0x1f,%ecx
+  80050a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80050d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800510:	8d 40 04             	lea    0x4(%eax),%eax
+  800513:	89 45 14             	mov    %eax,0x14(%ebp)
+  800516:	eb 17                	jmp    80052f <vprintfmt+0x2a6>
+  800518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051b:	8b 50 04             	mov    0x4(%eax),%edx
+  80051e:	8b 00                	mov    (%eax),%eax
+  800520:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800523:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800526:	8b 45 14             	mov    0x14(%ebp),%eax
+  800529:	8d 40 08             	lea    0x8(%eax),%eax
+  80052c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80052f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800532:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800535:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80053a:	85 c9                	test   %ecx,%ecx
+  80053c:	0f 89 03 01 00 00    	jns    800645 <vprintfmt+0x3bc>
+  800542:	83 ec 08             	sub    $0x8,%esp
+  800545:	53                   	push   %ebx
+  800546:	6a 2d                	push   $0x2d
+  800548:	ff d6                	call   *%esi
+  80054a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80054d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800550:	f7 da                	neg    %edx
+  800552:	83 d1 00             	adc    $0x0,%ecx
+  800555:	f7 d9                	neg    %ecx
+  800557:	83 c4 10             	add    $0x10,%esp
+  80055a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80055f:	e9 e1 00 00 00       	jmp    800645 <vprintfmt+0x3bc>
+  800564:	8b 45 14             	mov    0x14(%ebp),%eax
+  800567:	8b 00                	mov    (%eax),%eax
+  800569:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056c:	89 c1                	mov    %eax,%ecx
+  80056e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800571:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800574:	8b 45 14             	mov    0x14(%ebp),%eax
+  800577:	8d 40 04             	lea    0x4(%eax),%eax
+  80057a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057d:	eb b0                	jmp    80052f <vprintfmt+0x2a6>
+  80057f:	83 f9 01             	cmp    $0x1,%ecx
+  800582:	7f 1e                	jg     8005a2 <vprintfmt+0x319>
+  800584:	85 c9                	test   %ecx,%ecx
+  800586:	74 32                	je     8005ba <vprintfmt+0x331>
+  800588:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058b:	8b 10                	mov    (%eax),%edx
+  80058d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800592:	8d 40 04             	lea    0x4(%eax),%eax
+  800595:	89 45 14             	mov    %eax,0x14(%ebp)
+  800598:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80059d:	e9 a3 00 00 00       	jmp    800645 <vprintfmt+0x3bc>
+  8005a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a5:	8b 10                	mov    (%eax),%edx
+  8005a7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005aa:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ad:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005b5:	e9 8b 00 00 00       	jmp    800645 <vprintfmt+0x3bc>
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	8b 10                	mov    (%eax),%edx
+  8005bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ca:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005cf:	eb 74                	jmp    800645 <vprintfmt+0x3bc>
+  8005d1:	83 f9 01             	cmp    $0x1,%ecx
+  8005d4:	7f 1b                	jg     8005f1 <vprintfmt+0x368>
+  8005d6:	85 c9                	test   %ecx,%ecx
+  8005d8:	74 2c                	je     800606 <vprintfmt+0x37d>
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8b 10                	mov    (%eax),%edx
+  8005df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ea:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005ef:	eb 54                	jmp    800645 <vprintfmt+0x3bc>
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8b 10                	mov    (%eax),%edx
+  8005f6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005f9:	8d 40 08             	lea    0x8(%eax),%eax
+  8005fc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ff:	bf 08 00 00 00       	mov    $0x8,%edi
+  800604:	eb 3f                	jmp    800645 <vprintfmt+0x3bc>
+  800606:	8b 45 14             	mov    0x14(%ebp),%eax
+  800609:	8b 10                	mov    (%eax),%edx
+  80060b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800610:	8d 40 04             	lea    0x4(%eax),%eax
+  800613:	89 45 14             	mov    %eax,0x14(%ebp)
+  800616:	bf 08 00 00 00       	mov    $0x8,%edi
+  80061b:	eb 28                	jmp    800645 <vprintfmt+0x3bc>
+  80061d:	83 ec 08             	sub    $0x8,%esp
+  800620:	53                   	push   %ebx
+  800621:	6a 30                	push   $0x30
+  800623:	ff d6                	call   *%esi
+  800625:	83 c4 08             	add    $0x8,%esp
+  800628:	53                   	push   %ebx
+  800629:	6a 78                	push   $0x78
+  80062b:	ff d6                	call   *%esi
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8b 10                	mov    (%eax),%edx
+  800632:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800637:	83 c4 10             	add    $0x10,%esp
+  80063a:	8d 40 04             	lea    0x4(%eax),%eax
+  80063d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800640:	bf 10 00 00 00       	mov    $0x10,%edi
+  800645:	83 ec 0c             	sub    $0xc,%esp
+  800648:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80064c:	50                   	push   %eax
+  80064d:	ff 75 e0             	push   -0x20(%ebp)
+  800650:	57                   	push   %edi
+  800651:	51                   	push   %ecx
+  800652:	52                   	push   %edx
+  800653:	89 da                	mov    %ebx,%edx
+  800655:	89 f0                	mov    %esi,%eax
+  800657:	e8 4a fb ff ff       	call   8001a6 <printnum>
+  80065c:	83 c4 20             	add    $0x20,%esp
+  80065f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800662:	e9 40 fc ff ff       	jmp    8002a7 <vprintfmt+0x1e>
+  800667:	83 f9 01             	cmp    $0x1,%ecx
+  80066a:	7f 1b                	jg     800687 <vprintfmt+0x3fe>
+  80066c:	85 c9                	test   %ecx,%ecx
+  80066e:	74 2c                	je     80069c <vprintfmt+0x413>
+  800670:	8b 45 14             	mov    0x14(%ebp),%eax
+  800673:	8b 10                	mov    (%eax),%edx
+  800675:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067a:	8d 40 04             	lea    0x4(%eax),%eax
+  80067d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800680:	bf 10 00 00 00       	mov    $0x10,%edi
+  800685:	eb be                	jmp    800645 <vprintfmt+0x3bc>
+  800687:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068a:	8b 10                	mov    (%eax),%edx
+  80068c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80068f:	8d 40 08             	lea    0x8(%eax),%eax
+  800692:	89 45 14             	mov    %eax,0x14(%ebp)
+  800695:	bf 10 00 00 00       	mov    $0x10,%edi
+  80069a:	eb a9                	jmp    800645 <vprintfmt+0x3bc>
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8b 10                	mov    (%eax),%edx
+  8006a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ac:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006b1:	eb 92                	jmp    800645 <vprintfmt+0x3bc>
+  8006b3:	83 ec 08             	sub    $0x8,%esp
+  8006b6:	53                   	push   %ebx
+  8006b7:	6a 25                	push   $0x25
+  8006b9:	ff d6                	call   *%esi
+  8006bb:	83 c4 10             	add    $0x10,%esp
+  8006be:	eb 9f                	jmp    80065f <vprintfmt+0x3d6>
+  8006c0:	83 ec 08             	sub    $0x8,%esp
+  8006c3:	53                   	push   %ebx
+  8006c4:	6a 25                	push   $0x25
+  8006c6:	ff d6                	call   *%esi
+  8006c8:	83 c4 10             	add    $0x10,%esp
+  8006cb:	89 f8                	mov    %edi,%eax
+  8006cd:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006d1:	74 05                	je     8006d8 <vprintfmt+0x44f>
+  8006d3:	83 e8 01             	sub    $0x1,%eax
+  8006d6:	eb f5                	jmp    8006cd <vprintfmt+0x444>
+  8006d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006db:	eb 82                	jmp    80065f <vprintfmt+0x3d6>
+
+008006dd <vsnprintf>:
+  8006dd:	55                   	push   %ebp
+  8006de:	89 e5                	mov    %esp,%ebp
+  8006e0:	83 ec 18             	sub    $0x18,%esp
+  8006e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006ec:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006f0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006f3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8006fa:	85 c0                	test   %eax,%eax
+  8006fc:	74 26                	je     800724 <vsnprintf+0x47>
+  8006fe:	85 d2                	test   %edx,%edx
+  800700:	7e 22                	jle    800724 <vsnprintf+0x47>
+  800702:	ff 75 14             	push   0x14(%ebp)
+  800705:	ff 75 10             	push   0x10(%ebp)
+  800708:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80070b:	50                   	push   %eax
+  80070c:	68 4f 02 80 00       	push   $0x80024f
+  800711:	e8 73 fb ff ff       	call   800289 <vprintfmt>
+  800716:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800719:	c6 00 00             	movb   $0x0,(%eax)
+  80071c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80071f:	83 c4 10             	add    $0x10,%esp
+  800722:	c9                   	leave
+  800723:	c3                   	ret
+  800724:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800729:	eb f7                	jmp    800722 <vsnprintf+0x45>
+
+0080072b <snprintf>:
+  80072b:	55                   	push   %ebp
+  80072c:	89 e5                	mov    %esp,%ebp
+  80072e:	83 ec 08             	sub    $0x8,%esp
+  800731:	8d 45 14             	lea    0x14(%ebp),%eax
+  800734:	50                   	push   %eax
+  800735:	ff 75 10             	push   0x10(%ebp)
+  800738:	ff 75 0c             	push   0xc(%ebp)
+  80073b:	ff 75 08             	push   0x8(%ebp)
+  80073e:	e8 9a ff ff ff       	call   8006dd <vsnprintf>
+  800743:	c9                   	leave
+  800744:	c3                   	ret
+
+00800745 <copy_fwd>:
+  800745:	55                   	push   %ebp
+  800746:	89 e5                	mov    %esp,%ebp
+  800748:	57                   	push   %edi
+  800749:	56                   	push   %esi
+  80074a:	53                   	push   %ebx
+  80074b:	89 c7                	mov    %eax,%edi
+  80074d:	89 d6                	mov    %edx,%esi
+  80074f:	89 c8                	mov    %ecx,%eax
+  800751:	83 f9 0f             	cmp    $0xf,%ecx
+  800754:	76 1c                	jbe    800772 <copy_fwd+0x2d>
+  800756:	89 f9                	mov    %edi,%ecx
+  800758:	f7 d9                	neg    %ecx
+  80075a:	89 cb                	mov    %ecx,%ebx
+  80075c:	83 e3 03             	and    $0x3,%ebx
+  80075f:	29 d8                	sub    %ebx,%eax
+  800761:	89 c2                	mov    %eax,%edx
+  800763:	c1 ea 02             	shr    $0x2,%edx
+  800766:	83 e0 03             	and    $0x3,%eax
+  800769:	89 d9                	mov    %ebx,%ecx
+  80076b:	fc                   	cld
+  80076c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80076e:	89 d1                	mov    %edx,%ecx
+  800770:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800772:	89 c1                	mov    %eax,%ecx
+  800774:	fc                   	cld
+  800775:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800777:	5b                   	pop    %ebx
+  800778:	5e                   	pop    %esi
+  800779:	5f                   	pop    %edi
+  80077a:	5d                   	pop    %ebp
+  80077b:	c3                   	ret
+
+0080077c <have_sse2>:
+  80077c:	83 3d 04 20 80 00 00 	cmpl   $0x0,0x802004
+  800783:	78 06                	js     80078b <have_sse2+0xf>
+  800785:	a1 04 20 80 00       	mov    0x802004,%eax
+  80078a:	c3                   	ret
+  80078b:	55                   	push   %ebp
+  80078c:	89 e5                	mov    %esp,%ebp
+  80078e:	53                   	push   %ebx
+  80078f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800794:	0f a2                	cpuid
+  800796:	c1 ea 1a             	shr    $0x1a,%edx
+  800799:	83 e2 01             	and    $0x1,%edx
+  80079c:	89 15 04 20 80 00    	mov    %edx,0x802004
+  8007a2:	a1 04 20 80 00       	mov    0x802004,%eax
+  8007a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007aa:	c9                   	leave
+  8007ab:	c3                   	ret
+
+008007ac <strlen>:
+  8007ac:	55                   	push   %ebp
+  8007ad:	89 e5                	mov    %esp,%ebp
+  8007af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b7:	eb 03                	jmp    8007bc <strlen+0x10>
+  8007b9:	83 c0 01             	add    $0x1,%eax
+  8007bc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007c0:	75 f7                	jne    8007b9 <strlen+0xd>
+  8007c2:	5d                   	pop    %ebp
+  8007c3:	c3                   	ret
+
+008007c4 <strnlen>:
+  8007c4:	55                   	push   %ebp
+  8007c5:	89 e5                	mov    %esp,%ebp
+  8007c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d2:	eb 03                	jmp    8007d7 <strnlen+0x13>
+  8007d4:	83 c0 01             	add    $0x1,%eax
+  8007d7:	39 d0                	cmp    %edx,%eax
+  8007d9:	74 08                	je     8007e3 <strnlen+0x1f>
+  8007db:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007df:	75 f3                	jne    8007d4 <strnlen+0x10>
+  8007e1:	89 c2                	mov    %eax,%edx
+  8007e3:	89 d0                	mov    %edx,%eax
+  8007e5:	5d                   	pop    %ebp
+  8007e6:	c3                   	ret
+
+008007e7 <strcpy>:
+  8007e7:	55                   	push   %ebp
+  8007e8:	89 e5                	mov    %esp,%ebp
+  8007ea:	53                   	push   %ebx
+  8007eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007fa:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007fd:	83 c0 01             	add    $0x1,%eax
+  800800:	84 d2                	test   %dl,%dl
+  800802:	75 f2                	jne    8007f6 <strcpy+0xf>
+  800804:	89 c8                	mov    %ecx,%eax
+  800806:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800809:	c9                   	leave
+  80080a:	c3                   	ret
+
+0080080b <strcat>:
+  80080b:	55                   	push   %ebp
+  80080c:	89 e5                	mov    %esp,%ebp
+  80080e:	53                   	push   %ebx
+  80080f:	83 ec 10             	sub    $0x10,%esp
+  800812:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800815:	53                   	push   %ebx
+  800816:	e8 91 ff ff ff       	call   8007ac <strlen>
+  80081b:	83 c4 08             	add    $0x8,%esp
+  80081e:	ff 75 0c             	push   0xc(%ebp)
+  800821:	01 d8                	add    %ebx,%eax
+  800823:	50                   	push   %eax
+  800824:	e8 be ff ff ff       	call   8007e7 <strcpy>
+  800829:	89 d8                	mov    %ebx,%eax
+  80082b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80082e:	c9                   	leave
+  80082f:	c3                   	ret
+
+00800830 <strncpy>:
+  800830:	55                   	push   %ebp
+  800831:	89 e5                	mov    %esp,%ebp
+  800833:	56                   	push   %esi
+  800834:	53                   	push   %ebx
+  800835:	8b 75 08             	mov    0x8(%ebp),%esi
+  800838:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80083b:	89 f3                	mov    %esi,%ebx
+  80083d:	03 5d 10             	add    0x10(%ebp),%ebx
+  800840:	89 f0                	mov    %esi,%eax
+  800842:	eb 0f                	jmp    800853 <strncpy+0x23>
+  800844:	83 c0 01             	add    $0x1,%eax
+  800847:	0f b6 0a             	movzbl (%edx),%ecx
+  80084a:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80084d:	80 f9 01             	cmp    $0x1,%cl
+  800850:	83 da ff             	sbb    $0xffffffff,%edx
+  800853:	39 d8                	cmp    %ebx,%eax
+  800855:	75 ed                	jne    800844 <strncpy+0x14>
+  800857:	89 f0                	mov    %esi,%eax
+  800859:	5b                   	pop    %ebx
+  80085a:	5e                   	pop    %esi
+  80085b:	5d                   	pop    %ebp
+  80085c:	c3                   	ret
+
+0080085d <strlcpy>:
+  80085d:	55                   	push   %ebp
+  80085e:	89 e5                	mov    %esp,%ebp
+  800860:	56                   	push   %esi
+  800861:	53                   	push   %ebx
+  800862:	8b 75 08             	mov    0x8(%ebp),%esi
+  800865:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800868:	8b 55 10             	mov    0x10(%ebp),%edx
+  80086b:	89 f0                	mov    %esi,%eax
+  80086d:	85 d2                	test   %edx,%edx
+  80086f:	74 21                	je     800892 <strlcpy+0x35>
+  800871:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800875:	89 f2                	mov    %esi,%edx
+  800877:	eb 09                	jmp    800882 <strlcpy+0x25>
+  800879:	83 c1 01             	add    $0x1,%ecx
+  80087c:	83 c2 01             	add    $0x1,%edx
+  80087f:	88 5a ff             	mov    %bl,-0x1(%edx)
+  800882:	39 c2                	cmp    %eax,%edx
+  800884:	74 09                	je     80088f <strlcpy+0x32>
+  800886:	0f b6 19             	movzbl (%ecx),%ebx
+  800889:	84 db                	test   %bl,%bl
+  80088b:	75 ec                	jne    800879 <strlcpy+0x1c>
+  80088d:	89 d0                	mov    %edx,%eax
+  80088f:	c6 00 00             	movb   $0x0,(%eax)
+  800892:	29 f0                	sub    %esi,%eax
+  800894:	5b                   	pop    %ebx
+  800895:	5e                   	pop    %esi
+  800896:	5d                   	pop    %ebp
+  800897:	c3                   	ret
+
+00800898 <strcmp>:
+  800898:	55                   	push   %ebp
+  800899:	89 e5                	mov    %esp,%ebp
+  80089b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80089e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a1:	eb 06                	jmp    8008a9 <strcmp+0x11>
+  8008a3:	83 c1 01             	add    $0x1,%ecx
+  8008a6:	83 c2 01             	add    $0x1,%edx
+  8008a9:	0f b6 01             	movzbl (%ecx),%eax
+  8008ac:	84 c0                	test   %al,%al
+  8008ae:	74 04                	je     8008b4 <strcmp+0x1c>
+  8008b0:	3a 02                	cmp    (%edx),%al
+  8008b2:	74 ef                	je     8008a3 <strcmp+0xb>
+  8008b4:	0f b6 c0             	movzbl %al,%eax
+  8008b7:	0f b6 12             	movzbl (%edx),%edx
+  8008ba:	29 d0                	sub    %edx,%eax
+  8008bc:	5d                   	pop    %ebp
+  8008bd:	c3                   	ret
+
+008008be <strncmp>:
+  8008be:	55                   	push   %ebp
+  8008bf:	89 e5                	mov    %esp,%ebp
+  8008c1:	53                   	push   %ebx
+  8008c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008c8:	8b 55 10             	mov    0x10(%ebp),%edx
+  8008cb:	eb 09                	jmp    8008d6 <strncmp+0x18>
+  8008cd:	83 ea 01             	sub    $0x1,%edx
+  8008d0:	83 c0 01             	add    $0x1,%eax
+  8008d3:	83 c1 01             	add    $0x1,%ecx
+  8008d6:	85 d2                	test   %edx,%edx
+  8008d8:	74 18                	je     8008f2 <strncmp+0x34>
+  8008da:	0f b6 18             	movzbl (%eax),%ebx
+  8008dd:	84 db                	test   %bl,%bl
+  8008df:	74 04                	je     8008e5 <strncmp+0x27>
+  8008e1:	3a 19                	cmp    (%ecx),%bl
+  8008e3:	74 e8                	je     8008cd <strncmp+0xf>
+  8008e5:	0f b6 00             	movzbl (%eax),%eax
+  8008e8:	0f b6 11             	movzbl (%ecx),%edx
+  8008eb:	29 d0                	sub    %edx,%eax
+  8008ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f0:	c9                   	leave
+  8008f1:	c3                   	ret
+  8008f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f7:	eb f4                	jmp    8008ed <strncmp+0x2f>
+
+008008f9 <strchr>:
+  8008f9:	55                   	push   %ebp
+  8008fa:	89 e5                	mov    %esp,%ebp
+  8008fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ff:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800903:	eb 03                	jmp    800908 <strchr+0xf>
+  800905:	83 c0 01             	add    $0x1,%eax
+  800908:	0f b6 10             	movzbl (%eax),%edx
+  80090b:	84 d2                	test   %dl,%dl
+  80090d:	74 06                	je     800915 <strchr+0x1c>
+  80090f:	38 ca                	cmp    %cl,%dl
+  800911:	75 f2                	jne    800905 <strchr+0xc>
+  800913:	eb 05                	jmp    80091a <strchr+0x21>
+  800915:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091a:	5d                   	pop    %ebp
+  80091b:	c3                   	ret
+
+0080091c <strfind>:
+  80091c:	55                   	push   %ebp
+  80091d:	89 e5                	mov    %esp,%ebp
+  80091f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800922:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800926:	0f b6 10             	movzbl (%eax),%edx
+  800929:	38 ca                	cmp    %cl,%dl
+  80092b:	74 09                	je     800936 <strfind+0x1a>
+  80092d:	84 d2                	test   %dl,%dl
+  80092f:	74 05                	je     800936 <strfind+0x1a>
+  800931:	83 c0 01             	add    $0x1,%eax
+  800934:	eb f0                	jmp    800926 <strfind+0xa>
+  800936:	5d                   	pop    %ebp
+  800937:	c3                   	ret
+
+00800938 <memset>:
+  800938:	55                   	push   %ebp
+  800939:	89 e5                	mov    %esp,%ebp
+  80093b:	57                   	push   %edi
+  80093c:	56                   	push   %esi
+  80093d:	53                   	push   %ebx
+  80093e:	83 ec 04             	sub    $0x4,%esp
+  800941:	8b 75 08             	mov    0x8(%ebp),%esi
+  800944:	8b 55 10             	mov    0x10(%ebp),%edx
+  800947:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  80094b:	89 f7                	mov    %esi,%edi
+  80094d:	83 fa 0f             	cmp    $0xf,%edx
+  800950:	76 24                	jbe    800976 <memset+0x3e>
+  800952:	89 f1                	mov    %esi,%ecx
+  800954:	f7 d9                	neg    %ecx
+  800956:	83 e1 03             	and    $0x3,%ecx
+  800959:	29 ca                	sub    %ecx,%edx
+  80095b:	89 d0                	mov    %edx,%eax
+  80095d:	c1 e8 02             	shr    $0x2,%eax
+  800960:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  800963:	83 e2 03             	and    $0x3,%edx
+  800966:	89 d8                	mov    %ebx,%eax
+  800968:	fc                   	cld
+  800969:	f3 aa                	rep stos %al,%es:(%edi)
+  80096b:	69 c3 01 01 01 01    	imul   $0x1010101,%ebx,%eax
+  800971:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+  800974:	f3 ab                	rep stos %eax,%es:(%edi)
+  800976:	89 d1                	mov    %edx,%ecx
+  800978:	89 d8                	mov    %ebx,%eax
+  80097a:	fc                   	cld
+  80097b:	f3 aa                	rep stos %al,%es:(%edi)
+  80097d:	89 f0                	mov    %esi,%eax
+  80097f:	83 c4 04             	add    $0x4,%esp
+  800982:	5b                   	pop    %ebx
+  800983:	5e                   	pop    %esi
+  800984:	5f                   	pop    %edi
+  800985:	5d                   	pop    %ebp
+  800986:	c3                   	ret
+
+00800987 <memmove>:
+  800987:	55                   	push   %ebp
+  800988:	89 e5                	mov    %esp,%ebp
+  80098a:	57                   	push   %edi
+  80098b:	56                   	push   %esi
+  80098c:	53                   	push   %ebx
+  80098d:	83 ec 0c             	sub    $0xc,%esp
+  800990:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800993:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800996:	8b 45 10             	mov    0x10(%ebp),%eax
+  800999:	85 c0                	test   %eax,%eax
+  80099b:	74 14                	je     8009b1 <memmove+0x2a>
+  80099d:	39 da                	cmp    %ebx,%edx
+  80099f:	73 07                	jae    8009a8 <memmove+0x21>
+  8009a1:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8009a4:	39 cb                	cmp    %ecx,%ebx
+  8009a6:	72 13                	jb     8009bb <memmove+0x34>
+  8009a8:	89 c1                	mov    %eax,%ecx
+  8009aa:	89 d8                	mov    %ebx,%eax
+  8009ac:	e8 94 fd ff ff       	call   800745 <copy_fwd>
+  8009b1:	89 d8                	mov    %ebx,%eax
+  8009b3:	83 c4 0c             	add    $0xc,%esp
+  8009b6:	5b                   	pop    %ebx
+  8009b7:	5e                   	pop    %esi
+  8009b8:	5f                   	pop    %edi
+  8009b9:	5d                   	pop    %ebp
+  8009ba:	c3                   	ret
+  8009bb:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  8009be:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  8009c1:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  8009c4:	83 f8 0f             	cmp    $0xf,%eax
+  8009c7:	76 23                	jbe    8009ec <memmove+0x65>
+  8009c9:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+  8009cc:	83 e1 03             	and    $0x3,%ecx
+  8009cf:	29 c8                	sub    %ecx,%eax
+  8009d1:	89 c2                	mov    %eax,%edx
+  8009d3:	c1 ea 02             	shr    $0x2,%edx
+  8009d6:	83 e0 03             	and    $0x3,%eax
+  8009d9:	fd                   	std
+  8009da:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8009dc:	83 ef 03             	sub    $0x3,%edi
+  8009df:	83 ee 03             	sub    $0x3,%esi
+  8009e2:	89 d1                	mov    %edx,%ecx
+  8009e4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009e6:	83 c7 03             	add    $0x3,%edi
+  8009e9:	83 c6 03             	add    $0x3,%esi
+  8009ec:	89 c1                	mov    %eax,%ecx
+  8009ee:	fd                   	std
+  8009ef:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8009f1:	fc                   	cld
+  8009f2:	eb bd                	jmp    8009b1 <memmove+0x2a>
+
+008009f4 <memcpy>:
+  8009f4:	55                   	push   %ebp
+  8009f5:	89 e5                	mov    %esp,%ebp
+  8009f7:	53                   	push   %ebx
+  8009f8:	83 ec 04             	sub    $0x4,%esp
+  8009fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009fe:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a01:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a04:	89 d8                	mov    %ebx,%eax
+  800a06:	e8 3a fd ff ff       	call   800745 <copy_fwd>
+  800a0b:	89 d8                	mov    %ebx,%eax
+  800a0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a10:	c9                   	leave
+  800a11:	c3                   	ret
+
+00800a12 <page_copy>:
+  800a12:	55                   	push   %ebp
+  800a13:	89 e5                	mov    %esp,%ebp
+  800a15:	57                   	push   %edi
+  800a16:	56                   	push   %esi
+  800a17:	53                   	push   %ebx
+  800a18:	83 ec 0c             	sub    $0xc,%esp
+  800a1b:	e8 5c fd ff ff       	call   80077c <have_sse2>
+  800a20:	85 c0                	test   %eax,%eax
+  800a22:	74 39                	je     800a5d <page_copy+0x4b>
+  800a24:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a2a:	be 00 01 00 00       	mov    $0x100,%esi
+  800a2f:	8b 03                	mov    (%ebx),%eax
+  800a31:	8b 53 04             	mov    0x4(%ebx),%edx
+  800a34:	0f c3 01             	movnti %eax,(%ecx)
+  800a37:	0f c3 51 04          	movnti %edx,0x4(%ecx)
+  800a3b:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a3e:	8b 53 0c             	mov    0xc(%ebx),%edx
+  800a41:	0f c3 41 08          	movnti %eax,0x8(%ecx)
+  800a45:	0f c3 51 0c          	movnti %edx,0xc(%ecx)
+  800a49:	83 c3 10             	add    $0x10,%ebx
+  800a4c:	83 c1 10             	add    $0x10,%ecx
+  800a4f:	4e                   	dec    %esi
+  800a50:	75 dd                	jne    800a2f <page_copy+0x1d>
+  800a52:	0f ae f8             	sfence
+  800a55:	83 c4 0c             	add    $0xc,%esp
+  800a58:	5b                   	pop    %ebx
+  800a59:	5e                   	pop    %esi
+  800a5a:	5f                   	pop    %edi
+  800a5b:	5d                   	pop    %ebp
+  800a5c:	c3                   	ret
+  800a5d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a60:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a63:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800a68:	fc                   	cld
+  800a69:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a6b:	eb e8                	jmp    800a55 <page_copy+0x43>
+
+00800a6d <page_zero>:
+  800a6d:	55                   	push   %ebp
+  800a6e:	89 e5                	mov    %esp,%ebp
+  800a70:	57                   	push   %edi
+  800a71:	83 ec 04             	sub    $0x4,%esp
+  800a74:	e8 03 fd ff ff       	call   80077c <have_sse2>
+  800a79:	85 c0                	test   %eax,%eax
+  800a7b:	74 3a                	je     800ab7 <page_zero+0x4a>
+  800a7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a80:	ba 80 00 00 00       	mov    $0x80,%edx
+  800a85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a8a:	0f c3 08             	movnti %ecx,(%eax)
+  800a8d:	0f c3 48 04          	movnti %ecx,0x4(%eax)
+  800a91:	0f c3 48 08          	movnti %ecx,0x8(%eax)
+  800a95:	0f c3 48 0c          	movnti %ecx,0xc(%eax)
+  800a99:	0f c3 48 10          	movnti %ecx,0x10(%eax)
+  800a9d:	0f c3 48 14          	movnti %ecx,0x14(%eax)
+  800aa1:	0f c3 48 18          	movnti %ecx,0x18(%eax)
+  800aa5:	0f c3 48 1c          	movnti %ecx,0x1c(%eax)
+  800aa9:	83 c0 20             	add    $0x20,%eax
+  800aac:	4a                   	dec    %edx
+  800aad:	75 db                	jne    800a8a <page_zero+0x1d>
+  800aaf:	0f ae f8             	sfence
+  800ab2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ab5:	c9                   	leave
+  800ab6:	c3                   	ret
+  800ab7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800aba:	b9 00 04 00 00       	mov    $0x400,%ecx
+  800abf:	fc                   	cld
+  800ac0:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ac2:	eb ee                	jmp    800ab2 <page_zero+0x45>
+
+00800ac4 <memcmp>:
+  800ac4:	55                   	push   %ebp
+  800ac5:	89 e5                	mov    %esp,%ebp
+  800ac7:	56                   	push   %esi
+  800ac8:	53                   	push   %ebx
+  800ac9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800acc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800acf:	89 c6                	mov    %eax,%esi
+  800ad1:	03 75 10             	add    0x10(%ebp),%esi
+  800ad4:	eb 06                	jmp    800adc <memcmp+0x18>
+  800ad6:	83 c0 01             	add    $0x1,%eax
+  800ad9:	83 c2 01             	add    $0x1,%edx
+  800adc:	39 f0                	cmp    %esi,%eax
+  800ade:	74 14                	je     800af4 <memcmp+0x30>
+  800ae0:	0f b6 08             	movzbl (%eax),%ecx
+  800ae3:	0f b6 1a             	movzbl (%edx),%ebx
+  800ae6:	38 d9                	cmp    %bl,%cl
+  800ae8:	74 ec                	je     800ad6 <memcmp+0x12>
+  800aea:	0f b6 c1             	movzbl %cl,%eax
+  800aed:	0f b6 db             	movzbl %bl,%ebx
+  800af0:	29 d8                	sub    %ebx,%eax
+  800af2:	eb 05                	jmp    800af9 <memcmp+0x35>
+  800af4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af9:	5b                   	pop    %ebx
+  800afa:	5e                   	pop    %esi
+  800afb:	5d                   	pop    %ebp
+  800afc:	c3                   	ret
+
+00800afd <memfind>:
+  800afd:	55                   	push   %ebp
+  800afe:	89 e5                	mov    %esp,%ebp
+  800b00:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b06:	89 c2                	mov    %eax,%edx
+  800b08:	03 55 10             	add    0x10(%ebp),%edx
+  800b0b:	eb 03                	jmp    800b10 <memfind+0x13>
+  800b0d:	83 c0 01             	add    $0x1,%eax
+  800b10:	39 d0                	cmp    %edx,%eax
+  800b12:	73 04                	jae    800b18 <memfind+0x1b>
+  800b14:	38 08                	cmp    %cl,(%eax)
+  800b16:	75 f5                	jne    800b0d <memfind+0x10>
+  800b18:	5d                   	pop    %ebp
+  800b19:	c3                   	ret
+
+00800b1a <strtol>:
+  800b1a:	55                   	push   %ebp
+  800b1b:	89 e5                	mov    %esp,%ebp
+  800b1d:	57                   	push   %edi
+  800b1e:	56                   	push   %esi
+  800b1f:	53                   	push   %ebx
+  800b20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b26:	eb 03                	jmp    800b2b <strtol+0x11>
+  800b28:	83 c2 01             	add    $0x1,%edx
+  800b2b:	0f b6 02             	movzbl (%edx),%eax
+  800b2e:	3c 20                	cmp    $0x20,%al
+  800b30:	74 f6                	je     800b28 <strtol+0xe>
+  800b32:	3c 09                	cmp    $0x9,%al
+  800b34:	74 f2                	je     800b28 <strtol+0xe>
+  800b36:	3c 2b                	cmp    $0x2b,%al
+  800b38:	74 2a                	je     800b64 <strtol+0x4a>
+  800b3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b3f:	3c 2d                	cmp    $0x2d,%al
+  800b41:	74 2b                	je     800b6e <strtol+0x54>
+  800b43:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b49:	75 0f                	jne    800b5a <strtol+0x40>
+  800b4b:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b4e:	74 28                	je     800b78 <strtol+0x5e>
+  800b50:	85 db                	test   %ebx,%ebx
+  800b52:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b57:	0f 44 d8             	cmove  %eax,%ebx
+  800b5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b5f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b62:	eb 46                	jmp    800baa <strtol+0x90>
+  800b64:	83 c2 01             	add    $0x1,%edx
+  800b67:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b6c:	eb d5                	jmp    800b43 <strtol+0x29>
+  800b6e:	83 c2 01             	add    $0x1,%edx
+  800b71:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b76:	eb cb                	jmp    800b43 <strtol+0x29>
+  800b78:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b7c:	74 0e                	je     800b8c <strtol+0x72>
+  800b7e:	85 db                	test   %ebx,%ebx
+  800b80:	75 d8                	jne    800b5a <strtol+0x40>
+  800b82:	83 c2 01             	add    $0x1,%edx
+  800b85:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b8a:	eb ce                	jmp    800b5a <strtol+0x40>
+  800b8c:	83 c2 02             	add    $0x2,%edx
+  800b8f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b94:	eb c4                	jmp    800b5a <strtol+0x40>
+  800b96:	0f be c0             	movsbl %al,%eax
+  800b99:	83 e8 30             	sub    $0x30,%eax
+  800b9c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b9f:	7d 3a                	jge    800bdb <strtol+0xc1>
+  800ba1:	83 c2 01             	add    $0x1,%edx
+  800ba4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ba8:	01 c1                	add    %eax,%ecx
+  800baa:	0f b6 02             	movzbl (%edx),%eax
+  800bad:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bb0:	89 f3                	mov    %esi,%ebx
+  800bb2:	80 fb 09             	cmp    $0x9,%bl
+  800bb5:	76 df                	jbe    800b96 <strtol+0x7c>
+  800bb7:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bba:	89 f3                	mov    %esi,%ebx
+  800bbc:	80 fb 19             	cmp    $0x19,%bl
+  800bbf:	77 08                	ja     800bc9 <strtol+0xaf>
+  800bc1:	0f be c0             	movsbl %al,%eax
+  800bc4:	83 e8 57             	sub    $0x57,%eax
+  800bc7:	eb d3                	jmp    800b9c <strtol+0x82>
+  800bc9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bcc:	89 f3                	mov    %esi,%ebx
+  800bce:	80 fb 19             	cmp    $0x19,%bl
+  800bd1:	77 08                	ja     800bdb <strtol+0xc1>
+  800bd3:	0f be c0             	movsbl %al,%eax
+  800bd6:	83 e8 37             	sub    $0x37,%eax
+  800bd9:	eb c1                	jmp    800b9c <strtol+0x82>
+  800bdb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bdf:	74 05                	je     800be6 <strtol+0xcc>
+  800be1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800be4:	89 10                	mov    %edx,(%eax)
+  800be6:	89 c8                	mov    %ecx,%eax
+  800be8:	f7 d8                	neg    %eax
+  800bea:	85 ff                	test   %edi,%edi
+  800bec:	0f 45 c8             	cmovne %eax,%ecx
+  800bef:	89 c8                	mov    %ecx,%eax
+  800bf1:	5b                   	pop    %ebx
+  800bf2:	5e                   	pop    %esi
+  800bf3:	5f                   	pop    %edi
+  800bf4:	5d                   	pop    %ebp
+  800bf5:	c3                   	ret
+
+00800bf6 <sys_cputs>:
+  800bf6:	55                   	push   %ebp
+  800bf7:	89 e5                	mov    %esp,%ebp
+  800bf9:	57                   	push   %edi
+  800bfa:	56                   	push   %esi
+  800bfb:	53                   	push   %ebx
+  800bfc:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c03:	78 21                	js     800c26 <sys_cputs+0x30>
+  800c05:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c0c:	75 2d                	jne    800c3b <sys_cputs+0x45>
+  800c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c19:	89 c3                	mov    %eax,%ebx
+  800c1b:	89 c7                	mov    %eax,%edi
+  800c1d:	89 c6                	mov    %eax,%esi
+  800c1f:	cd 30                	int    $0x30
+  800c21:	5b                   	pop    %ebx
+  800c22:	5e                   	pop    %esi
+  800c23:	5f                   	pop    %edi
+  800c24:	5d                   	pop    %ebp
+  800c25:	c3                   	ret
+  800c26:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c2b:	0f a2                	cpuid
+  800c2d:	c1 ea 0b             	shr    $0xb,%edx
+  800c30:	83 e2 01             	and    $0x1,%edx
+  800c33:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800c39:	eb ca                	jmp    800c05 <sys_cputs+0xf>
+  800c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c46:	89 c3                	mov    %eax,%ebx
+  800c48:	89 c7                	mov    %eax,%edi
+  800c4a:	89 c6                	mov    %eax,%esi
+  800c4c:	55                   	push   %ebp
+  800c4d:	68 56 0c 80 00       	push   $0x800c56
+  800c52:	89 e5                	mov    %esp,%ebp
+  800c54:	0f 34                	sysenter
+  800c56:	83 c4 04             	add    $0x4,%esp
+  800c59:	5d                   	pop    %ebp
+  800c5a:	eb c5                	jmp    800c21 <sys_cputs+0x2b>
+
+00800c5c <sys_cgetc>:
+  800c5c:	55                   	push   %ebp
+  800c5d:	89 e5                	mov    %esp,%ebp
+  800c5f:	57                   	push   %edi
+  800c60:	56                   	push   %esi
+  800c61:	53                   	push   %ebx
+  800c62:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c69:	78 22                	js     800c8d <sys_cgetc+0x31>
+  800c6b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800c72:	75 2e                	jne    800ca2 <sys_cgetc+0x46>
+  800c74:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c79:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c7e:	89 d1                	mov    %edx,%ecx
+  800c80:	89 d3                	mov    %edx,%ebx
+  800c82:	89 d7                	mov    %edx,%edi
+  800c84:	89 d6                	mov    %edx,%esi
+  800c86:	cd 30                	int    $0x30
+  800c88:	5b                   	pop    %ebx
+  800c89:	5e                   	pop    %esi
+  800c8a:	5f                   	pop    %edi
+  800c8b:	5d                   	pop    %ebp
+  800c8c:	c3                   	ret
+  800c8d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c92:	0f a2                	cpuid
+  800c94:	c1 ea 0b             	shr    $0xb,%edx
+  800c97:	83 e2 01             	and    $0x1,%edx
+  800c9a:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800ca0:	eb c9                	jmp    800c6b <sys_cgetc+0xf>
+  800ca2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cac:	89 d1                	mov    %edx,%ecx
+  800cae:	89 d3                	mov    %edx,%ebx
+  800cb0:	89 d7                	mov    %edx,%edi
+  800cb2:	89 d6                	mov    %edx,%esi
+  800cb4:	55                   	push   %ebp
+  800cb5:	68 be 0c 80 00       	push   $0x800cbe
+  800cba:	89 e5                	mov    %esp,%ebp
+  800cbc:	0f 34                	sysenter
+  800cbe:	83 c4 04             	add    $0x4,%esp
+  800cc1:	5d                   	pop    %ebp
+  800cc2:	eb c4                	jmp    800c88 <sys_cgetc+0x2c>
+
+00800cc4 <sys_env_destroy>:
+  800cc4:	55                   	push   %ebp
+  800cc5:	89 e5                	mov    %esp,%ebp
+  800cc7:	57                   	push   %edi
+  800cc8:	56                   	push   %esi
+  800cc9:	53                   	push   %ebx
+  800cca:	83 ec 0c             	sub    $0xc,%esp
+  800ccd:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800cd4:	78 2a                	js     800d00 <sys_env_destroy+0x3c>
+  800cd6:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800cdd:	75 36                	jne    800d15 <sys_env_destroy+0x51>
+  800cdf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ce9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cec:	89 cb                	mov    %ecx,%ebx
+  800cee:	89 cf                	mov    %ecx,%edi
+  800cf0:	89 ce                	mov    %ecx,%esi
+  800cf2:	cd 30                	int    $0x30
+  800cf4:	85 c0                	test   %eax,%eax
+  800cf6:	7f 40                	jg     800d38 <sys_env_destroy+0x74>
+  800cf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfb:	5b                   	pop    %ebx
+  800cfc:	5e                   	pop    %esi
+  800cfd:	5f                   	pop    %edi
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+  800d00:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d05:	0f a2                	cpuid
+  800d07:	c1 ea 0b             	shr    $0xb,%edx
+  800d0a:	83 e2 01             	and    $0x1,%edx
+  800d0d:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800d13:	eb c1                	jmp    800cd6 <sys_env_destroy+0x12>
+  800d15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d1d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d22:	89 cb                	mov    %ecx,%ebx
+  800d24:	89 cf                	mov    %ecx,%edi
+  800d26:	89 ce                	mov    %ecx,%esi
+  800d28:	55                   	push   %ebp
+  800d29:	68 32 0d 80 00       	push   $0x800d32
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	0f 34                	sysenter
+  800d32:	83 c4 04             	add    $0x4,%esp
+  800d35:	5d                   	pop    %ebp
+  800d36:	eb bc                	jmp    800cf4 <sys_env_destroy+0x30>
+  800d38:	83 ec 0c             	sub    $0xc,%esp
+  800d3b:	50                   	push   %eax
+  800d3c:	6a 03                	push   $0x3
+  800d3e:	68 84 1c 80 00       	push   $0x801c84
+  800d43:	6a 49                	push   $0x49
+  800d45:	68 a1 1c 80 00       	push   $0x801ca1
+  800d4a:	e8 af 09 00 00       	call   8016fe <_panic>
+
+00800d4f <sys_getenvid>:
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	57                   	push   %edi
+  800d53:	56                   	push   %esi
+  800d54:	53                   	push   %ebx
+  800d55:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d5c:	78 22                	js     800d80 <sys_getenvid+0x31>
+  800d5e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800d65:	75 2e                	jne    800d95 <sys_getenvid+0x46>
+  800d67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d6c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d71:	89 d1                	mov    %edx,%ecx
+  800d73:	89 d3                	mov    %edx,%ebx
+  800d75:	89 d7                	mov    %edx,%edi
+  800d77:	89 d6                	mov    %edx,%esi
+  800d79:	cd 30                	int    $0x30
+  800d7b:	5b                   	pop    %ebx
+  800d7c:	5e                   	pop    %esi
+  800d7d:	5f                   	pop    %edi
+  800d7e:	5d                   	pop    %ebp
+  800d7f:	c3                   	ret
+  800d80:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d85:	0f a2                	cpuid
+  800d87:	c1 ea 0b             	shr    $0xb,%edx
+  800d8a:	83 e2 01             	and    $0x1,%edx
+  800d8d:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800d93:	eb c9                	jmp    800d5e <sys_getenvid+0xf>
+  800d95:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d9f:	89 d1                	mov    %edx,%ecx
+  800da1:	89 d3                	mov    %edx,%ebx
+  800da3:	89 d7                	mov    %edx,%edi
+  800da5:	89 d6                	mov    %edx,%esi
+  800da7:	55                   	push   %ebp
+  800da8:	68 b1 0d 80 00       	push   $0x800db1
+  800dad:	89 e5                	mov    %esp,%ebp
+  800daf:	0f 34                	sysenter
+  800db1:	83 c4 04             	add    $0x4,%esp
+  800db4:	5d                   	pop    %ebp
+  800db5:	eb c4                	jmp    800d7b <sys_getenvid+0x2c>
+
+00800db7 <sys_yield>:
+  800db7:	55                   	push   %ebp
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	57                   	push   %edi
+  800dbb:	56                   	push   %esi
+  800dbc:	53                   	push   %ebx
+  800dbd:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800dc4:	78 22                	js     800de8 <sys_yield+0x31>
+  800dc6:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800dcd:	75 2e                	jne    800dfd <sys_yield+0x46>
+  800dcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dd9:	89 d1                	mov    %edx,%ecx
+  800ddb:	89 d3                	mov    %edx,%ebx
+  800ddd:	89 d7                	mov    %edx,%edi
+  800ddf:	89 d6                	mov    %edx,%esi
+  800de1:	cd 30                	int    $0x30
+  800de3:	5b                   	pop    %ebx
+  800de4:	5e                   	pop    %esi
+  800de5:	5f                   	pop    %edi
+  800de6:	5d                   	pop    %ebp
+  800de7:	c3                   	ret
+  800de8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ded:	0f a2                	cpuid
+  800def:	c1 ea 0b             	shr    $0xb,%edx
+  800df2:	83 e2 01             	and    $0x1,%edx
+  800df5:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800dfb:	eb c9                	jmp    800dc6 <sys_yield+0xf>
+  800dfd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e02:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e07:	89 d1                	mov    %edx,%ecx
+  800e09:	89 d3                	mov    %edx,%ebx
+  800e0b:	89 d7                	mov    %edx,%edi
+  800e0d:	89 d6                	mov    %edx,%esi
+  800e0f:	55                   	push   %ebp
+  800e10:	68 19 0e 80 00       	push   $0x800e19
+  800e15:	89 e5                	mov    %esp,%ebp
+  800e17:	0f 34                	sysenter
+  800e19:	83 c4 04             	add    $0x4,%esp
+  800e1c:	5d                   	pop    %ebp
+  800e1d:	eb c4                	jmp    800de3 <sys_yield+0x2c>
+
+00800e1f <sys_env_set_cow>:
+  800e1f:	55                   	push   %ebp
+  800e20:	89 e5                	mov    %esp,%ebp
+  800e22:	57                   	push   %edi
+  800e23:	56                   	push   %esi
+  800e24:	53                   	push   %ebx
+  800e25:	83 ec 0c             	sub    $0xc,%esp
+  800e28:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e2f:	78 2b                	js     800e5c <sys_env_set_cow+0x3d>
+  800e31:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800e38:	75 37                	jne    800e71 <sys_env_set_cow+0x52>
+  800e3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4a:	89 df                	mov    %ebx,%edi
+  800e4c:	89 de                	mov    %ebx,%esi
+  800e4e:	cd 30                	int    $0x30
+  800e50:	85 c0                	test   %eax,%eax
+  800e52:	7f 41                	jg     800e95 <sys_env_set_cow+0x76>
+  800e54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e57:	5b                   	pop    %ebx
+  800e58:	5e                   	pop    %esi
+  800e59:	5f                   	pop    %edi
+  800e5a:	5d                   	pop    %ebp
+  800e5b:	c3                   	ret
+  800e5c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e61:	0f a2                	cpuid
+  800e63:	c1 ea 0b             	shr    $0xb,%edx
+  800e66:	83 e2 01             	and    $0x1,%edx
+  800e69:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800e6f:	eb c0                	jmp    800e31 <sys_env_set_cow+0x12>
+  800e71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e81:	89 df                	mov    %ebx,%edi
+  800e83:	89 de                	mov    %ebx,%esi
+  800e85:	55                   	push   %ebp
+  800e86:	68 8f 0e 80 00       	push   $0x800e8f
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	0f 34                	sysenter
+  800e8f:	83 c4 04             	add    $0x4,%esp
+  800e92:	5d                   	pop    %ebp
+  800e93:	eb bb                	jmp    800e50 <sys_env_set_cow+0x31>
+  800e95:	83 ec 0c             	sub    $0xc,%esp
+  800e98:	50                   	push   %eax
+  800e99:	6a 0d                	push   $0xd
+  800e9b:	68 84 1c 80 00       	push   $0x801c84
+  800ea0:	6a 49                	push   $0x49
+  800ea2:	68 a1 1c 80 00       	push   $0x801ca1
+  800ea7:	e8 52 08 00 00       	call   8016fe <_panic>
+
+00800eac <sys_env_set_quota>:
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	57                   	push   %edi
+  800eb0:	56                   	push   %esi
+  800eb1:	53                   	push   %ebx
+  800eb2:	83 ec 0c             	sub    $0xc,%esp
+  800eb5:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800ebc:	78 2b                	js     800ee9 <sys_env_set_quota+0x3d>
+  800ebe:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800ec5:	75 37                	jne    800efe <sys_env_set_quota+0x52>
+  800ec7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ecc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ed1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed7:	89 df                	mov    %ebx,%edi
+  800ed9:	89 de                	mov    %ebx,%esi
+  800edb:	cd 30                	int    $0x30
+  800edd:	85 c0                	test   %eax,%eax
+  800edf:	7f 41                	jg     800f22 <sys_env_set_quota+0x76>
+  800ee1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee4:	5b                   	pop    %ebx
+  800ee5:	5e                   	pop    %esi
+  800ee6:	5f                   	pop    %edi
+  800ee7:	5d                   	pop    %ebp
+  800ee8:	c3                   	ret
+  800ee9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eee:	0f a2                	cpuid
+  800ef0:	c1 ea 0b             	shr    $0xb,%edx
+  800ef3:	83 e2 01             	and    $0x1,%edx
+  800ef6:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800efc:	eb c0                	jmp    800ebe <sys_env_set_quota+0x12>
+  800efe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f09:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f0e:	89 df                	mov    %ebx,%edi
+  800f10:	89 de                	mov    %ebx,%esi
+  800f12:	55                   	push   %ebp
+  800f13:	68 1c 0f 80 00       	push   $0x800f1c
+  800f18:	89 e5                	mov    %esp,%ebp
+  800f1a:	0f 34                	sysenter
+  800f1c:	83 c4 04             	add    $0x4,%esp
+  800f1f:	5d                   	pop    %ebp
+  800f20:	eb bb                	jmp    800edd <sys_env_set_quota+0x31>
+  800f22:	83 ec 0c             	sub    $0xc,%esp
+  800f25:	50                   	push   %eax
+  800f26:	6a 0f                	push   $0xf
+  800f28:	68 84 1c 80 00       	push   $0x801c84
+  800f2d:	6a 49                	push   $0x49
+  800f2f:	68 a1 1c 80 00       	push   $0x801ca1
+  800f34:	e8 c5 07 00 00       	call   8016fe <_panic>
+
+00800f39 <sys_page_alloc>:
+  800f39:	55                   	push   %ebp
+  800f3a:	89 e5                	mov    %esp,%ebp
+  800f3c:	57                   	push   %edi
+  800f3d:	56                   	push   %esi
+  800f3e:	53                   	push   %ebx
+  800f3f:	83 ec 0c             	sub    $0xc,%esp
+  800f42:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f49:	78 2c                	js     800f77 <sys_page_alloc+0x3e>
+  800f4b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800f52:	75 38                	jne    800f8c <sys_page_alloc+0x53>
+  800f54:	be 00 00 00 00       	mov    $0x0,%esi
+  800f59:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f67:	89 f7                	mov    %esi,%edi
+  800f69:	cd 30                	int    $0x30
+  800f6b:	85 c0                	test   %eax,%eax
+  800f6d:	7f 42                	jg     800fb1 <sys_page_alloc+0x78>
+  800f6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f72:	5b                   	pop    %ebx
+  800f73:	5e                   	pop    %esi
+  800f74:	5f                   	pop    %edi
+  800f75:	5d                   	pop    %ebp
+  800f76:	c3                   	ret
+  800f77:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f7c:	0f a2                	cpuid
+  800f7e:	c1 ea 0b             	shr    $0xb,%edx
+  800f81:	83 e2 01             	and    $0x1,%edx
+  800f84:	89 15 08 20 80 00    	mov    %edx,0x802008
+  800f8a:	eb bf                	jmp    800f4b <sys_page_alloc+0x12>
+  800f8c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f97:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f9f:	89 f7                	mov    %esi,%edi
+  800fa1:	55                   	push   %ebp
+  800fa2:	68 ab 0f 80 00       	push   $0x800fab
+  800fa7:	89 e5                	mov    %esp,%ebp
+  800fa9:	0f 34                	sysenter
+  800fab:	83 c4 04             	add    $0x4,%esp
+  800fae:	5d                   	pop    %ebp
+  800faf:	eb ba                	jmp    800f6b <sys_page_alloc+0x32>
+  800fb1:	83 ec 0c             	sub    $0xc,%esp
+  800fb4:	50                   	push   %eax
+  800fb5:	6a 04                	push   $0x4
+  800fb7:	68 84 1c 80 00       	push   $0x801c84
+  800fbc:	6a 49                	push   $0x49
+  800fbe:	68 a1 1c 80 00       	push   $0x801ca1
+  800fc3:	e8 36 07 00 00       	call   8016fe <_panic>
+
+00800fc8 <sys_page_map>:
+  800fc8:	55                   	push   %ebp
+  800fc9:	89 e5                	mov    %esp,%ebp
+  800fcb:	57                   	push   %edi
+  800fcc:	56                   	push   %esi
+  800fcd:	53                   	push   %ebx
+  800fce:	83 ec 0c             	sub    $0xc,%esp
+  800fd1:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800fd8:	78 2b                	js     801005 <sys_page_map+0x3d>
+  800fda:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  800fe1:	75 37                	jne    80101a <sys_page_map+0x52>
+  800fe3:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fe8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800feb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ff4:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ff7:	cd 30                	int    $0x30
+  800ff9:	85 c0                	test   %eax,%eax
+  800ffb:	7f 41                	jg     80103e <sys_page_map+0x76>
+  800ffd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801000:	5b                   	pop    %ebx
+  801001:	5e                   	pop    %esi
+  801002:	5f                   	pop    %edi
+  801003:	5d                   	pop    %ebp
+  801004:	c3                   	ret
+  801005:	b8 01 00 00 00       	mov    $0x1,%eax
+  80100a:	0f a2                	cpuid
+  80100c:	c1 ea 0b             	shr    $0xb,%edx
+  80100f:	83 e2 01             	and    $0x1,%edx
+  801012:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801018:	eb c0                	jmp    800fda <sys_page_map+0x12>
+  80101a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801020:	b8 05 00 00 00       	mov    $0x5,%eax
+  801025:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801028:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80102b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80102e:	55                   	push   %ebp
+  80102f:	68 38 10 80 00       	push   $0x801038
+  801034:	89 e5                	mov    %esp,%ebp
+  801036:	0f 34                	sysenter
+  801038:	83 c4 04             	add    $0x4,%esp
+  80103b:	5d                   	pop    %ebp
+  80103c:	eb bb                	jmp    800ff9 <sys_page_map+0x31>
+  80103e:	83 ec 0c             	sub    $0xc,%esp
+  801041:	50                   	push   %eax
+  801042:	6a 05                	push   $0x5
+  801044:	68 84 1c 80 00       	push   $0x801c84
+  801049:	6a 49                	push   $0x49
+  80104b:	68 a1 1c 80 00       	push   $0x801ca1
+  801050:	e8 a9 06 00 00       	call   8016fe <_panic>
+
+00801055 <sys_page_unmap>:
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	57                   	push   %edi
+  801059:	56                   	push   %esi
+  80105a:	53                   	push   %ebx
+  80105b:	83 ec 0c             	sub    $0xc,%esp
+  80105e:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801065:	78 2b                	js     801092 <sys_page_unmap+0x3d>
+  801067:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80106e:	75 37                	jne    8010a7 <sys_page_unmap+0x52>
+  801070:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801075:	b8 06 00 00 00       	mov    $0x6,%eax
+  80107a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801080:	89 df                	mov    %ebx,%edi
+  801082:	89 de                	mov    %ebx,%esi
+  801084:	cd 30                	int    $0x30
+  801086:	85 c0                	test   %eax,%eax
+  801088:	7f 41                	jg     8010cb <sys_page_unmap+0x76>
+  80108a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108d:	5b                   	pop    %ebx
+  80108e:	5e                   	pop    %esi
+  80108f:	5f                   	pop    %edi
+  801090:	5d                   	pop    %ebp
+  801091:	c3                   	ret
+  801092:	b8 01 00 00 00       	mov    $0x1,%eax
+  801097:	0f a2                	cpuid
+  801099:	c1 ea 0b             	shr    $0xb,%edx
+  80109c:	83 e2 01             	and    $0x1,%edx
+  80109f:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8010a5:	eb c0                	jmp    801067 <sys_page_unmap+0x12>
+  8010a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010b7:	89 df                	mov    %ebx,%edi
+  8010b9:	89 de                	mov    %ebx,%esi
+  8010bb:	55                   	push   %ebp
+  8010bc:	68 c5 10 80 00       	push   $0x8010c5
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	0f 34                	sysenter
+  8010c5:	83 c4 04             	add    $0x4,%esp
+  8010c8:	5d                   	pop    %ebp
+  8010c9:	eb bb                	jmp    801086 <sys_page_unmap+0x31>
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+  8010ce:	50                   	push   %eax
+  8010cf:	6a 06                	push   $0x6
+  8010d1:	68 84 1c 80 00       	push   $0x801c84
+  8010d6:	6a 49                	push   $0x49
+  8010d8:	68 a1 1c 80 00       	push   $0x801ca1
+  8010dd:	e8 1c 06 00 00       	call   8016fe <_panic>
+
+008010e2 <sys_page_reuse>:
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	57                   	push   %edi
+  8010e6:	56                   	push   %esi
+  8010e7:	53                   	push   %ebx
+  8010e8:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010ef:	78 24                	js     801115 <sys_page_reuse+0x33>
+  8010f1:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8010f8:	75 30                	jne    80112a <sys_page_reuse+0x48>
+  8010fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ff:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801104:	8b 55 08             	mov    0x8(%ebp),%edx
+  801107:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110a:	89 df                	mov    %ebx,%edi
+  80110c:	89 de                	mov    %ebx,%esi
+  80110e:	cd 30                	int    $0x30
+  801110:	5b                   	pop    %ebx
+  801111:	5e                   	pop    %esi
+  801112:	5f                   	pop    %edi
+  801113:	5d                   	pop    %ebp
+  801114:	c3                   	ret
+  801115:	b8 01 00 00 00       	mov    $0x1,%eax
+  80111a:	0f a2                	cpuid
+  80111c:	c1 ea 0b             	shr    $0xb,%edx
+  80111f:	83 e2 01             	and    $0x1,%edx
+  801122:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801128:	eb c7                	jmp    8010f1 <sys_page_reuse+0xf>
+  80112a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801132:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801135:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80113a:	89 df                	mov    %ebx,%edi
+  80113c:	89 de                	mov    %ebx,%esi
+  80113e:	55                   	push   %ebp
+  80113f:	68 48 11 80 00       	push   $0x801148
+  801144:	89 e5                	mov    %esp,%ebp
+  801146:	0f 34                	sysenter
+  801148:	83 c4 04             	add    $0x4,%esp
+  80114b:	5d                   	pop    %ebp
+  80114c:	eb c2                	jmp    801110 <sys_page_reuse+0x2e>
+
+0080114e <sys_env_set_status>:
+  80114e:	55                   	push   %ebp
+  80114f:	89 e5                	mov    %esp,%ebp
+  801151:	57                   	push   %edi
+  801152:	56                   	push   %esi
+  801153:	53                   	push   %ebx
+  801154:	83 ec 0c             	sub    $0xc,%esp
+  801157:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80115e:	78 2b                	js     80118b <sys_env_set_status+0x3d>
+  801160:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801167:	75 37                	jne    8011a0 <sys_env_set_status+0x52>
+  801169:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801173:	8b 55 08             	mov    0x8(%ebp),%edx
+  801176:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801179:	89 df                	mov    %ebx,%edi
+  80117b:	89 de                	mov    %ebx,%esi
+  80117d:	cd 30                	int    $0x30
+  80117f:	85 c0                	test   %eax,%eax
+  801181:	7f 41                	jg     8011c4 <sys_env_set_status+0x76>
+  801183:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801186:	5b                   	pop    %ebx
+  801187:	5e                   	pop    %esi
+  801188:	5f                   	pop    %edi
+  801189:	5d                   	pop    %ebp
+  80118a:	c3                   	ret
+  80118b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801190:	0f a2                	cpuid
+  801192:	c1 ea 0b             	shr    $0xb,%edx
+  801195:	83 e2 01             	and    $0x1,%edx
+  801198:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80119e:	eb c0                	jmp    801160 <sys_env_set_status+0x12>
+  8011a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ab:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011b0:	89 df                	mov    %ebx,%edi
+  8011b2:	89 de                	mov    %ebx,%esi
+  8011b4:	55                   	push   %ebp
+  8011b5:	68 be 11 80 00       	push   $0x8011be
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	0f 34                	sysenter
+  8011be:	83 c4 04             	add    $0x4,%esp
+  8011c1:	5d                   	pop    %ebp
+  8011c2:	eb bb                	jmp    80117f <sys_env_set_status+0x31>
+  8011c4:	83 ec 0c             	sub    $0xc,%esp
+  8011c7:	50                   	push   %eax
+  8011c8:	6a 08                	push   $0x8
+  8011ca:	68 84 1c 80 00       	push   $0x801c84
+  8011cf:	6a 49                	push   $0x49
+  8011d1:	68 a1 1c 80 00       	push   $0x801ca1
+  8011d6:	e8 23 05 00 00       	call   8016fe <_panic>
+
+008011db <sys_env_set_pgfault_upcall>:
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	57                   	push   %edi
+  8011df:	56                   	push   %esi
+  8011e0:	53                   	push   %ebx
+  8011e1:	83 ec 0c             	sub    $0xc,%esp
+  8011e4:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011eb:	78 2b                	js     801218 <sys_env_set_pgfault_upcall+0x3d>
+  8011ed:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8011f4:	75 37                	jne    80122d <sys_env_set_pgfault_upcall+0x52>
+  8011f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fb:	b8 09 00 00 00       	mov    $0x9,%eax
+  801200:	8b 55 08             	mov    0x8(%ebp),%edx
+  801203:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801206:	89 df                	mov    %ebx,%edi
+  801208:	89 de                	mov    %ebx,%esi
+  80120a:	cd 30                	int    $0x30
+  80120c:	85 c0                	test   %eax,%eax
+  80120e:	7f 41                	jg     801251 <sys_env_set_pgfault_upcall+0x76>
+  801210:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801213:	5b                   	pop    %ebx
+  801214:	5e                   	pop    %esi
+  801215:	5f                   	pop    %edi
+  801216:	5d                   	pop    %ebp
+  801217:	c3                   	ret
+  801218:	b8 01 00 00 00       	mov    $0x1,%eax
+  80121d:	0f a2                	cpuid
+  80121f:	c1 ea 0b             	shr    $0xb,%edx
+  801222:	83 e2 01             	and    $0x1,%edx
+  801225:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80122b:	eb c0                	jmp    8011ed <sys_env_set_pgfault_upcall+0x12>
+  80122d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801232:	8b 55 08             	mov    0x8(%ebp),%edx
+  801235:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801238:	b8 09 00 00 00       	mov    $0x9,%eax
+  80123d:	89 df                	mov    %ebx,%edi
+  80123f:	89 de                	mov    %ebx,%esi
+  801241:	55                   	push   %ebp
+  801242:	68 4b 12 80 00       	push   $0x80124b
+  801247:	89 e5                	mov    %esp,%ebp
+  801249:	0f 34                	sysenter
+  80124b:	83 c4 04             	add    $0x4,%esp
+  80124e:	5d                   	pop    %ebp
+  80124f:	eb bb                	jmp    80120c <sys_env_set_pgfault_upcall+0x31>
+  801251:	83 ec 0c             	sub    $0xc,%esp
+  801254:	50                   	push   %eax
+  801255:	6a 09                	push   $0x9
+  801257:	68 84 1c 80 00       	push   $0x801c84
+  80125c:	6a 49                	push   $0x49
+  80125e:	68 a1 1c 80 00       	push   $0x801ca1
+  801263:	e8 96 04 00 00       	call   8016fe <_panic>
+
+00801268 <sys_env_set_trace>:
+  801268:	55                   	push   %ebp
+  801269:	89 e5                	mov    %esp,%ebp
+  80126b:	57                   	push   %edi
+  80126c:	56                   	push   %esi
+  80126d:	53                   	push   %ebx
+  80126e:	83 ec 0c             	sub    $0xc,%esp
+  801271:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801278:	78 2b                	js     8012a5 <sys_env_set_trace+0x3d>
+  80127a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801281:	75 37                	jne    8012ba <sys_env_set_trace+0x52>
+  801283:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801288:	b8 12 00 00 00       	mov    $0x12,%eax
+  80128d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801290:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801293:	89 df                	mov    %ebx,%edi
+  801295:	89 de                	mov    %ebx,%esi
+  801297:	cd 30                	int    $0x30
+  801299:	85 c0                	test   %eax,%eax
+  80129b:	7f 41                	jg     8012de <sys_env_set_trace+0x76>
+  80129d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a0:	5b                   	pop    %ebx
+  8012a1:	5e                   	pop    %esi
+  8012a2:	5f                   	pop    %edi
+  8012a3:	5d                   	pop    %ebp
+  8012a4:	c3                   	ret
+  8012a5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012aa:	0f a2                	cpuid
+  8012ac:	c1 ea 0b             	shr    $0xb,%edx
+  8012af:	83 e2 01             	and    $0x1,%edx
+  8012b2:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8012b8:	eb c0                	jmp    80127a <sys_env_set_trace+0x12>
+  8012ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c5:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012ca:	89 df                	mov    %ebx,%edi
+  8012cc:	89 de                	mov    %ebx,%esi
+  8012ce:	55                   	push   %ebp
+  8012cf:	68 d8 12 80 00       	push   $0x8012d8
+  8012d4:	89 e5                	mov    %esp,%ebp
+  8012d6:	0f 34                	sysenter
+  8012d8:	83 c4 04             	add    $0x4,%esp
+  8012db:	5d                   	pop    %ebp
+  8012dc:	eb bb                	jmp    801299 <sys_env_set_trace+0x31>
+  8012de:	83 ec 0c             	sub    $0xc,%esp
+  8012e1:	50                   	push   %eax
+  8012e2:	6a 12                	push   $0x12
+  8012e4:	68 84 1c 80 00       	push   $0x801c84
+  8012e9:	6a 49                	push   $0x49
+  8012eb:	68 a1 1c 80 00       	push   $0x801ca1
+  8012f0:	e8 09 04 00 00       	call   8016fe <_panic>
+
+008012f5 <sys_env_set_rdpmc>:
+  8012f5:	55                   	push   %ebp
+  8012f6:	89 e5                	mov    %esp,%ebp
+  8012f8:	57                   	push   %edi
+  8012f9:	56                   	push   %esi
+  8012fa:	53                   	push   %ebx
+  8012fb:	83 ec 0c             	sub    $0xc,%esp
+  8012fe:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801305:	78 2b                	js     801332 <sys_env_set_rdpmc+0x3d>
+  801307:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80130e:	75 37                	jne    801347 <sys_env_set_rdpmc+0x52>
+  801310:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801315:	b8 13 00 00 00       	mov    $0x13,%eax
+  80131a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801320:	89 df                	mov    %ebx,%edi
+  801322:	89 de                	mov    %ebx,%esi
+  801324:	cd 30                	int    $0x30
+  801326:	85 c0                	test   %eax,%eax
+  801328:	7f 41                	jg     80136b <sys_env_set_rdpmc+0x76>
+  80132a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132d:	5b                   	pop    %ebx
+  80132e:	5e                   	pop    %esi
+  80132f:	5f                   	pop    %edi
+  801330:	5d                   	pop    %ebp
+  801331:	c3                   	ret
+  801332:	b8 01 00 00 00       	mov    $0x1,%eax
+  801337:	0f a2                	cpuid
+  801339:	c1 ea 0b             	shr    $0xb,%edx
+  80133c:	83 e2 01             	and    $0x1,%edx
+  80133f:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801345:	eb c0                	jmp    801307 <sys_env_set_rdpmc+0x12>
+  801347:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801352:	b8 13 00 00 00       	mov    $0x13,%eax
+  801357:	89 df                	mov    %ebx,%edi
+  801359:	89 de                	mov    %ebx,%esi
+  80135b:	55                   	push   %ebp
+  80135c:	68 65 13 80 00       	push   $0x801365
+  801361:	89 e5                	mov    %esp,%ebp
+  801363:	0f 34                	sysenter
+  801365:	83 c4 04             	add    $0x4,%esp
+  801368:	5d                   	pop    %ebp
+  801369:	eb bb                	jmp    801326 <sys_env_set_rdpmc+0x31>
+  80136b:	83 ec 0c             	sub    $0xc,%esp
+  80136e:	50                   	push   %eax
+  80136f:	6a 13                	push   $0x13
+  801371:	68 84 1c 80 00       	push   $0x801c84
+  801376:	6a 49                	push   $0x49
+  801378:	68 a1 1c 80 00       	push   $0x801ca1
+  80137d:	e8 7c 03 00 00       	call   8016fe <_panic>
+
+00801382 <sys_ring_setup>:
+  801382:	55                   	push   %ebp
+  801383:	89 e5                	mov    %esp,%ebp
+  801385:	57                   	push   %edi
+  801386:	56                   	push   %esi
+  801387:	53                   	push   %ebx
+  801388:	83 ec 0c             	sub    $0xc,%esp
+  80138b:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801392:	78 29                	js     8013bd <sys_ring_setup+0x3b>
+  801394:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  80139b:	75 35                	jne    8013d2 <sys_ring_setup+0x50>
+  80139d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a2:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013a7:	89 d1                	mov    %edx,%ecx
+  8013a9:	89 d3                	mov    %edx,%ebx
+  8013ab:	89 d7                	mov    %edx,%edi
+  8013ad:	89 d6                	mov    %edx,%esi
+  8013af:	cd 30                	int    $0x30
+  8013b1:	85 c0                	test   %eax,%eax
+  8013b3:	7f 3f                	jg     8013f4 <sys_ring_setup+0x72>
+  8013b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b8:	5b                   	pop    %ebx
+  8013b9:	5e                   	pop    %esi
+  8013ba:	5f                   	pop    %edi
+  8013bb:	5d                   	pop    %ebp
+  8013bc:	c3                   	ret
+  8013bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013c2:	0f a2                	cpuid
+  8013c4:	c1 ea 0b             	shr    $0xb,%edx
+  8013c7:	83 e2 01             	and    $0x1,%edx
+  8013ca:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8013d0:	eb c2                	jmp    801394 <sys_ring_setup+0x12>
+  8013d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d7:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013dc:	89 d1                	mov    %edx,%ecx
+  8013de:	89 d3                	mov    %edx,%ebx
+  8013e0:	89 d7                	mov    %edx,%edi
+  8013e2:	89 d6                	mov    %edx,%esi
+  8013e4:	55                   	push   %ebp
+  8013e5:	68 ee 13 80 00       	push   $0x8013ee
+  8013ea:	89 e5                	mov    %esp,%ebp
+  8013ec:	0f 34                	sysenter
+  8013ee:	83 c4 04             	add    $0x4,%esp
+  8013f1:	5d                   	pop    %ebp
+  8013f2:	eb bd                	jmp    8013b1 <sys_ring_setup+0x2f>
+  8013f4:	83 ec 0c             	sub    $0xc,%esp
+  8013f7:	50                   	push   %eax
+  8013f8:	6a 10                	push   $0x10
+  8013fa:	68 84 1c 80 00       	push   $0x801c84
+  8013ff:	6a 49                	push   $0x49
+  801401:	68 a1 1c 80 00       	push   $0x801ca1
+  801406:	e8 f3 02 00 00       	call   8016fe <_panic>
+
+0080140b <sys_ring_enter>:
+  80140b:	55                   	push   %ebp
+  80140c:	89 e5                	mov    %esp,%ebp
+  80140e:	57                   	push   %edi
+  80140f:	56                   	push   %esi
+  801410:	53                   	push   %ebx
+  801411:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801418:	78 22                	js     80143c <sys_ring_enter+0x31>
+  80141a:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801421:	75 2e                	jne    801451 <sys_ring_enter+0x46>
+  801423:	ba 00 00 00 00       	mov    $0x0,%edx
+  801428:	b8 11 00 00 00       	mov    $0x11,%eax
+  80142d:	89 d1                	mov    %edx,%ecx
+  80142f:	89 d3                	mov    %edx,%ebx
+  801431:	89 d7                	mov    %edx,%edi
+  801433:	89 d6                	mov    %edx,%esi
+  801435:	cd 30                	int    $0x30
+  801437:	5b                   	pop    %ebx
+  801438:	5e                   	pop    %esi
+  801439:	5f                   	pop    %edi
+  80143a:	5d                   	pop    %ebp
+  80143b:	c3                   	ret
+  80143c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801441:	0f a2                	cpuid
+  801443:	c1 ea 0b             	shr    $0xb,%edx
+  801446:	83 e2 01             	and    $0x1,%edx
+  801449:	89 15 08 20 80 00    	mov    %edx,0x802008
+  80144f:	eb c9                	jmp    80141a <sys_ring_enter+0xf>
+  801451:	ba 00 00 00 00       	mov    $0x0,%edx
+  801456:	b8 11 00 00 00       	mov    $0x11,%eax
+  80145b:	89 d1                	mov    %edx,%ecx
+  80145d:	89 d3                	mov    %edx,%ebx
+  80145f:	89 d7                	mov    %edx,%edi
+  801461:	89 d6                	mov    %edx,%esi
+  801463:	55                   	push   %ebp
+  801464:	68 6d 14 80 00       	push   $0x80146d
+  801469:	89 e5                	mov    %esp,%ebp
+  80146b:	0f 34                	sysenter
+  80146d:	83 c4 04             	add    $0x4,%esp
+  801470:	5d                   	pop    %ebp
+  801471:	eb c4                	jmp    801437 <sys_ring_enter+0x2c>
+
+00801473 <sys_ipc_try_send>:
+  801473:	55                   	push   %ebp
+  801474:	89 e5                	mov    %esp,%ebp
+  801476:	57                   	push   %edi
+  801477:	56                   	push   %esi
+  801478:	53                   	push   %ebx
+  801479:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801480:	78 26                	js     8014a8 <sys_ipc_try_send+0x35>
+  801482:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  801489:	75 32                	jne    8014bd <sys_ipc_try_send+0x4a>
+  80148b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801490:	be 00 00 00 00       	mov    $0x0,%esi
+  801495:	8b 55 08             	mov    0x8(%ebp),%edx
+  801498:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80149e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014a1:	cd 30                	int    $0x30
+  8014a3:	5b                   	pop    %ebx
+  8014a4:	5e                   	pop    %esi
+  8014a5:	5f                   	pop    %edi
+  8014a6:	5d                   	pop    %ebp
+  8014a7:	c3                   	ret
+  8014a8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014ad:	0f a2                	cpuid
+  8014af:	c1 ea 0b             	shr    $0xb,%edx
+  8014b2:	83 e2 01             	and    $0x1,%edx
+  8014b5:	89 15 08 20 80 00    	mov    %edx,0x802008
+  8014bb:	eb c5                	jmp    801482 <sys_ipc_try_send+0xf>
+  8014bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014d3:	55                   	push   %ebp
+  8014d4:	68 dd 14 80 00       	push   $0x8014dd
+  8014d9:	89 e5                	mov    %esp,%ebp
+  8014db:	0f 34                	sysenter
+  8014dd:	83 c4 04             	add    $0x4,%esp
+  8014e0:	5d                   	pop    %ebp
+  8014e1:	eb c0                	jmp    8014a3 <sys_ipc_try_send+0x30>
+
+008014e3 <sys_ipc_recv>:
+  8014e3:	55                   	push   %ebp
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	57                   	push   %edi
+  8014e7:	56                   	push   %esi
+  8014e8:	53                   	push   %ebx
+  8014e9:	83 ec 0c             	sub    $0xc,%esp
+  8014ec:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014f3:	78 2a                	js     80151f <sys_ipc_recv+0x3c>
+  8014f5:	83 3d 08 20 80 00 00 	cmpl   $0x0,0x802008
+  8014fc:	75 36                	jne    801534 <sys_ipc_recv+0x51>
+  8014fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801503:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801508:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150b:	89 cb                	mov    %ecx,%ebx
+  80150d:	89 cf                	mov    %ecx,%edi
+  80150f:	89 ce                	mov    %ecx,%esi
+  801511:	cd 30                	int    $0x30
+  801513:	85 c0                	test   %eax,%eax
+  801515:	7f 40                	jg     801557 <sys_ipc_recv+0x74>
+  801517:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80151a:	5b                   	pop    %ebx
+  80151b:	5e                   	pop    %esi
+  80151c:	5f                   	pop    %edi
+  80151d:	5d                   	pop    %ebp
+  80151e:	c3                   	ret
+  80151f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801524:	0f a2                	cpuid
+  801526:	c1 ea 0b             	shr    $0xb,%edx
+  801529:	83 e2 01             	and    $0x1,%edx
+  80152c:	89 15 08 20 80 00    	mov    %edx,0x802008
+  801532:	eb c1                	jmp    8014f5 <sys_ipc_recv+0x12>
+  801534:	8b 55 08             	mov    0x8(%ebp),%edx
+  801537:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80153c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801541:	89 cb                	mov    %ecx,%ebx
+  801543:	89 cf                	mov    %ecx,%edi
+  801545:	89 ce                	mov    %ecx,%esi
+  801547:	55                   	push   %ebp
+  801548:	68 51 15 80 00       	push   $0x801551
+  80154d:	89 e5                	mov    %esp,%ebp
+  80154f:	0f 34                	sysenter
+  801551:	83 c4 04             	add    $0x4,%esp
+  801554:	5d                   	pop    %ebp
+  801555:	eb bc                	jmp    801513 <sys_ipc_recv+0x30>
+  801557:	83 ec 0c             	sub    $0xc,%esp
+  80155a:	50                   	push   %eax
+  80155b:	6a 0c                	push   $0xc
+  80155d:	68 84 1c 80 00       	push   $0x801c84
+  801562:	6a 49                	push   $0x49
+  801564:	68 a1 1c 80 00       	push   $0x801ca1
+  801569:	e8 90 01 00 00       	call   8016fe <_panic>
+
+0080156e <uinfo_envid>:
+  80156e:	a1 00 f0 3f 00       	mov    0x3ff000,%eax
+  801573:	c3                   	ret
+
+00801574 <uinfo_cpunum>:
+  801574:	a1 04 f0 3f 00       	mov    0x3ff004,%eax
+  801579:	c3                   	ret
+
+0080157a <uinfo_ticks>:
+  80157a:	a1 10 f0 3f 00       	mov    0x3ff010,%eax
+  80157f:	c3                   	ret
+
+00801580 <uinfo_nsec>:
+  801580:	55                   	push   %ebp
+  801581:	89 e5                	mov    %esp,%ebp
+  801583:	57                   	push   %edi
+  801584:	56                   	push   %esi
+  801585:	53                   	push   %ebx
+  801586:	83 ec 1c             	sub    $0x1c,%esp
+  801589:	0f 31                	rdtsc
+  80158b:	89 c6                	mov    %eax,%esi
+  80158d:	89 d7                	mov    %edx,%edi
+  80158f:	8b 0d 0c f0 3f 00    	mov    0x3ff00c,%ecx
+  801595:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80159f:	85 c9                	test   %ecx,%ecx
+  8015a1:	74 5c                	je     8015ff <uinfo_nsec+0x7f>
+  8015a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8015ab:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8015ae:	52                   	push   %edx
+  8015af:	51                   	push   %ecx
+  8015b0:	57                   	push   %edi
+  8015b1:	56                   	push   %esi
+  8015b2:	e8 6a 02 00 00       	call   801821 <__umoddi3>
+  8015b7:	83 c4 10             	add    $0x10,%esp
+  8015ba:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  8015c0:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  8015c5:	f7 e3                	mul    %ebx
+  8015c7:	01 ca                	add    %ecx,%edx
+  8015c9:	ff 75 e4             	push   -0x1c(%ebp)
+  8015cc:	ff 75 e0             	push   -0x20(%ebp)
+  8015cf:	52                   	push   %edx
+  8015d0:	50                   	push   %eax
+  8015d1:	e8 73 01 00 00       	call   801749 <__udivdi3>
+  8015d6:	83 c4 10             	add    $0x10,%esp
+  8015d9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8015dc:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8015df:	ff 75 e4             	push   -0x1c(%ebp)
+  8015e2:	ff 75 e0             	push   -0x20(%ebp)
+  8015e5:	57                   	push   %edi
+  8015e6:	56                   	push   %esi
+  8015e7:	e8 5d 01 00 00       	call   801749 <__udivdi3>
+  8015ec:	83 c4 10             	add    $0x10,%esp
+  8015ef:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  8015f5:	f7 e3                	mul    %ebx
+  8015f7:	01 ca                	add    %ecx,%edx
+  8015f9:	03 45 d8             	add    -0x28(%ebp),%eax
+  8015fc:	13 55 dc             	adc    -0x24(%ebp),%edx
+  8015ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801602:	5b                   	pop    %ebx
+  801603:	5e                   	pop    %esi
+  801604:	5f                   	pop    %edi
+  801605:	5d                   	pop    %ebp
+  801606:	c3                   	ret
+
+00801607 <bflush>:
+  801607:	a1 40 20 80 00       	mov    0x802040,%eax
+  80160c:	85 c0                	test   %eax,%eax
+  80160e:	75 01                	jne    801611 <bflush+0xa>
+  801610:	c3                   	ret
+  801611:	55                   	push   %ebp
+  801612:	89 e5                	mov    %esp,%ebp
+  801614:	83 ec 10             	sub    $0x10,%esp
+  801617:	50                   	push   %eax
+  801618:	68 44 20 80 00       	push   $0x802044
+  80161d:	e8 d4 f5 ff ff       	call   800bf6 <sys_cputs>
+  801622:	c7 05 40 20 80 00 00 	movl   $0x0,0x802040
+  801629:	00 00 00 
+  80162c:	83 c4 10             	add    $0x10,%esp
+  80162f:	c9                   	leave
+  801630:	c3                   	ret
+
+00801631 <bputch>:
+  801631:	55                   	push   %ebp
+  801632:	89 e5                	mov    %esp,%ebp
+  801634:	53                   	push   %ebx
+  801635:	83 ec 04             	sub    $0x4,%esp
+  801638:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80163b:	8b 15 40 20 80 00    	mov    0x802040,%edx
+  801641:	8d 42 01             	lea    0x1(%edx),%eax
+  801644:	a3 40 20 80 00       	mov    %eax,0x802040
+  801649:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80164c:	88 8a 44 20 80 00    	mov    %cl,0x802044(%edx)
+  801652:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801657:	77 08                	ja     801661 <bputch+0x30>
+  801659:	83 03 01             	addl   $0x1,(%ebx)
+  80165c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80165f:	c9                   	leave
+  801660:	c3                   	ret
+  801661:	e8 a1 ff ff ff       	call   801607 <bflush>
+  801666:	eb f1                	jmp    801659 <bputch+0x28>
+
+00801668 <vbprintf>:
+  801668:	55                   	push   %ebp
+  801669:	89 e5                	mov    %esp,%ebp
+  80166b:	83 ec 18             	sub    $0x18,%esp
+  80166e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801675:	ff 75 0c             	push   0xc(%ebp)
+  801678:	ff 75 08             	push   0x8(%ebp)
+  80167b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80167e:	50                   	push   %eax
+  80167f:	68 31 16 80 00       	push   $0x801631
+  801684:	e8 00 ec ff ff       	call   800289 <vprintfmt>
+  801689:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80168c:	c9                   	leave
+  80168d:	c3                   	ret
+
+0080168e <bprintf>:
+  80168e:	55                   	push   %ebp
+  80168f:	89 e5                	mov    %esp,%ebp
+  801691:	83 ec 10             	sub    $0x10,%esp
+  801694:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801697:	50                   	push   %eax
+  801698:	ff 75 08             	push   0x8(%ebp)
+  80169b:	e8 c8 ff ff ff       	call   801668 <vbprintf>
+  8016a0:	c9                   	leave
+  8016a1:	c3                   	ret
+
+008016a2 <bwrite>:
+  8016a2:	55                   	push   %ebp
+  8016a3:	89 e5                	mov    %esp,%ebp
+  8016a5:	53                   	push   %ebx
+  8016a6:	83 ec 04             	sub    $0x4,%esp
+  8016a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8016ac:	89 d8                	mov    %ebx,%eax
+  8016ae:	03 05 40 20 80 00    	add    0x802040,%eax
+  8016b4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8016b9:	76 0d                	jbe    8016c8 <bwrite+0x26>
+  8016bb:	e8 47 ff ff ff       	call   801607 <bflush>
+  8016c0:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  8016c6:	77 25                	ja     8016ed <bwrite+0x4b>
+  8016c8:	83 ec 04             	sub    $0x4,%esp
+  8016cb:	53                   	push   %ebx
+  8016cc:	ff 75 08             	push   0x8(%ebp)
+  8016cf:	a1 40 20 80 00       	mov    0x802040,%eax
+  8016d4:	05 44 20 80 00       	add    $0x802044,%eax
+  8016d9:	50                   	push   %eax
+  8016da:	e8 15 f3 ff ff       	call   8009f4 <memcpy>
+  8016df:	01 1d 40 20 80 00    	add    %ebx,0x802040
+  8016e5:	83 c4 10             	add    $0x10,%esp
+  8016e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016eb:	c9                   	leave
+  8016ec:	c3                   	ret
+  8016ed:	83 ec 08             	sub    $0x8,%esp
+  8016f0:	53                   	push   %ebx
+  8016f1:	ff 75 08             	push   0x8(%ebp)
+  8016f4:	e8 fd f4 ff ff       	call   800bf6 <sys_cputs>
+  8016f9:	83 c4 10             	add    $0x10,%esp
+  8016fc:	eb ea                	jmp    8016e8 <bwrite+0x46>
+
+008016fe <_panic>:
+  8016fe:	55                   	push   %ebp
+  8016ff:	89 e5                	mov    %esp,%ebp
+  801701:	56                   	push   %esi
+  801702:	53                   	push   %ebx
+  801703:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  801706:	e8 fc fe ff ff       	call   801607 <bflush>
+  80170b:	8b 35 00 20 80 00    	mov    0x802000,%esi
+  801711:	e8 39 f6 ff ff       	call   800d4f <sys_getenvid>
+  801716:	83 ec 0c             	sub    $0xc,%esp
+  801719:	ff 75 0c             	push   0xc(%ebp)
+  80171c:	ff 75 08             	push   0x8(%ebp)
+  80171f:	56                   	push   %esi
+  801720:	50                   	push   %eax
+  801721:	68 b0 1c 80 00       	push   $0x801cb0
+  801726:	e8 67 ea ff ff       	call   800192 <cprintf>
+  80172b:	83 c4 18             	add    $0x18,%esp
+  80172e:	53                   	push   %ebx
+  80172f:	ff 75 10             	push   0x10(%ebp)
+  801732:	e8 0a ea ff ff       	call   800141 <vcprintf>
+  801737:	c7 04 24 d3 1c 80 00 	movl   $0x801cd3,(%esp)
+  80173e:	e8 4f ea ff ff       	call   800192 <cprintf>
+  801743:	83 c4 10             	add    $0x10,%esp
+  801746:	cc                   	int3
+  801747:	eb fd                	jmp    801746 <_panic+0x48>
+
+00801749 <__udivdi3>:
+  801749:	57                   	push   %edi
+  80174a:	56                   	push   %esi
+  80174b:	53                   	push   %ebx
+  80174c:	83 ec 20             	sub    $0x20,%esp
+  80174f:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801753:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801757:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80175b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80175f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  801763:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801767:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80176b:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80176f:	89 44 24 18          	mov    %eax,0x18(%esp)
+  801773:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  801777:	89 d1                	mov    %edx,%ecx
+  801779:	09 c1                	or     %eax,%ecx
+  80177b:	0f 84 91 00 00 00    	je     801812 <__udivdi3+0xc9>
+  801781:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  801788:	00 
+  801789:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  801790:	00 
+  801791:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801796:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a0:	eb 08                	jmp    8017aa <__udivdi3+0x61>
+  8017a2:	83 e9 01             	sub    $0x1,%ecx
+  8017a5:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8017a8:	74 68                	je     801812 <__udivdi3+0xc9>
+  8017aa:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8017ae:	01 c0                	add    %eax,%eax
+  8017b0:	89 c6                	mov    %eax,%esi
+  8017b2:	89 d7                	mov    %edx,%edi
+  8017b4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8017b8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8017bc:	0f ad d0             	shrd   %cl,%edx,%eax
+  8017bf:	d3 ea                	shr    %cl,%edx
+  8017c1:	f6 c1 20             	test   $0x20,%cl
+  8017c4:	74 04                	je     8017ca <__udivdi3+0x81>
+  8017c6:	89 d0                	mov    %edx,%eax
+  8017c8:	31 d2                	xor    %edx,%edx
+  8017ca:	83 e0 01             	and    $0x1,%eax
+  8017cd:	89 04 24             	mov    %eax,(%esp)
+  8017d0:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8017d7:	00 
+  8017d8:	8b 04 24             	mov    (%esp),%eax
+  8017db:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8017df:	09 f0                	or     %esi,%eax
+  8017e1:	09 fa                	or     %edi,%edx
+  8017e3:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8017e7:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8017eb:	39 f0                	cmp    %esi,%eax
+  8017ed:	89 d3                	mov    %edx,%ebx
+  8017ef:	19 fb                	sbb    %edi,%ebx
+  8017f1:	72 af                	jb     8017a2 <__udivdi3+0x59>
+  8017f3:	29 f0                	sub    %esi,%eax
+  8017f5:	19 fa                	sbb    %edi,%edx
+  8017f7:	89 cf                	mov    %ecx,%edi
+  8017f9:	c1 ef 05             	shr    $0x5,%edi
+  8017fc:	83 e7 01             	and    $0x1,%edi
+  8017ff:	89 fe                	mov    %edi,%esi
+  801801:	83 f6 01             	xor    $0x1,%esi
+  801804:	d3 e6                	shl    %cl,%esi
+  801806:	d3 e7                	shl    %cl,%edi
+  801808:	09 74 24 18          	or     %esi,0x18(%esp)
+  80180c:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  801810:	eb 90                	jmp    8017a2 <__udivdi3+0x59>
+  801812:	8b 44 24 18          	mov    0x18(%esp),%eax
+  801816:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80181a:	83 c4 20             	add    $0x20,%esp
+  80181d:	5b                   	pop    %ebx
+  80181e:	5e                   	pop    %esi
+  80181f:	5f                   	pop    %edi
+  801820:	c3                   	ret
+
+00801821 <__umoddi3>:
+  801821:	55                   	push   %ebp
+  801822:	57                   	push   %edi
+  801823:	56                   	push   %esi
+  801824:	53                   	push   %ebx
+  801825:	83 ec 1c             	sub    $0x1c,%esp
+  801828:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80182c:	8b 54 24 34          	mov    0x34(%esp),%edx
+  801830:	89 44 24 08          	mov    %eax,0x8(%esp)
+  801834:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  801838:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80183c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  801840:	89 44 24 10          	mov    %eax,0x10(%esp)
+  801844:	89 54 24 14          	mov    %edx,0x14(%esp)
+  801848:	89 d6                	mov    %edx,%esi
+  80184a:	09 c6                	or     %eax,%esi
+  80184c:	74 6c                	je     8018ba <__umoddi3+0x99>
+  80184e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  801853:	b8 00 00 00 00       	mov    $0x0,%eax
+  801858:	ba 00 00 00 00       	mov    $0x0,%edx
+  80185d:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  801861:	eb 0e                	jmp    801871 <__umoddi3+0x50>
+  801863:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+  801868:	8b 74 24 04          	mov    0x4(%esp),%esi
+  80186c:	83 fe ff             	cmp    $0xffffffff,%esi
+  80186f:	74 49                	je     8018ba <__umoddi3+0x99>
+  801871:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  801875:	01 c0                	add    %eax,%eax
+  801877:	89 c3                	mov    %eax,%ebx
+  801879:	89 d6                	mov    %edx,%esi
+  80187b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80187f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  801883:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+  801888:	0f ad d0             	shrd   %cl,%edx,%eax
+  80188b:	d3 ea                	shr    %cl,%edx
+  80188d:	f6 c1 20             	test   $0x20,%cl
+  801890:	74 04                	je     801896 <__umoddi3+0x75>
+  801892:	89 d0                	mov    %edx,%eax
+  801894:	31 d2                	xor    %edx,%edx
+  801896:	83 e0 01             	and    $0x1,%eax
+  801899:	bd 00 00 00 00       	mov    $0x0,%ebp
+  80189e:	89 ea                	mov    %ebp,%edx
+  8018a0:	09 d8                	or     %ebx,%eax
+  8018a2:	09 f2                	or     %esi,%edx
+  8018a4:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+  8018a8:	8b 74 24 14          	mov    0x14(%esp),%esi
+  8018ac:	39 d8                	cmp    %ebx,%eax
+  8018ae:	89 d1                	mov    %edx,%ecx
+  8018b0:	19 f1                	sbb    %esi,%ecx
+  8018b2:	72 af                	jb     801863 <__umoddi3+0x42>
+  8018b4:	29 d8                	sub    %ebx,%eax
+  8018b6:	19 f2                	sbb    %esi,%edx
+  8018b8:	eb a9                	jmp    801863 <__umoddi3+0x42>
+  8018ba:	83 c4 1c             	add    $0x1c,%esp
+  8018bd:	5b                   	pop    %ebx
+  8018be:	5e                   	pop    %esi
+  8018bf:	5f                   	pop    %edi
+  8018c0:	5d                   	pop    %ebp
+  8018c1:	c3                   	ret
+
+008018c2 <__divdi3>:
+  8018c2:	53                   	push   %ebx
+  8018c3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8018c7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8018cb:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8018cf:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8018d3:	85 d2                	test   %edx,%edx
+  8018d5:	78 12                	js     8018e9 <__divdi3+0x27>
+  8018d7:	85 db                	test   %ebx,%ebx
+  8018d9:	78 2e                	js     801909 <__divdi3+0x47>
+  8018db:	53                   	push   %ebx
+  8018dc:	51                   	push   %ecx
+  8018dd:	52                   	push   %edx
+  8018de:	50                   	push   %eax
+  8018df:	e8 65 fe ff ff       	call   801749 <__udivdi3>
+  8018e4:	83 c4 10             	add    $0x10,%esp
+  8018e7:	eb 1e                	jmp    801907 <__divdi3+0x45>
+  8018e9:	f7 d8                	neg    %eax
+  8018eb:	83 d2 00             	adc    $0x0,%edx
+  8018ee:	f7 da                	neg    %edx
+  8018f0:	85 db                	test   %ebx,%ebx
+  8018f2:	78 2a                	js     80191e <__divdi3+0x5c>
+  8018f4:	53                   	push   %ebx
+  8018f5:	51                   	push   %ecx
+  8018f6:	52                   	push   %edx
+  8018f7:	50                   	push   %eax
+  8018f8:	e8 4c fe ff ff       	call   801749 <__udivdi3>
+  8018fd:	83 c4 10             	add    $0x10,%esp
+  801900:	f7 d8                	neg    %eax
+  801902:	83 d2 00             	adc    $0x0,%edx
+  801905:	f7 da                	neg    %edx
+  801907:	5b                   	pop    %ebx
+  801908:	c3                   	ret
+  801909:	f7 d9                	neg    %ecx
+  80190b:	83 d3 00             	adc    $0x0,%ebx
+  80190e:	f7 db                	neg    %ebx
+  801910:	53                   	push   %ebx
+  801911:	51                   	push   %ecx
+  801912:	52                   	push   %edx
+  801913:	50                   	push   %eax
+  801914:	e8 30 fe ff ff       	call   801749 <__udivdi3>
+  801919:	83 c4 10             	add    $0x10,%esp
+  80191c:	eb e2                	jmp    801900 <__divdi3+0x3e>
+  80191e:	f7 d9                	neg    %ecx
+  801920:	83 d3 00             	adc    $0x0,%ebx
+  801923:	f7 db                	neg    %ebx
+  801925:	53                   	push   %ebx
+  801926:	51                   	push   %ecx
+  801927:	52                   	push   %edx
+  801928:	50                   	push   %eax
+  801929:	e8 1b fe ff ff       	call   801749 <__udivdi3>
+  80192e:	83 c4 10             	add    $0x10,%esp
+  801931:	eb d4                	jmp    801907 <__divdi3+0x45>
+
+00801933 <__moddi3>:
+  801933:	55                   	push   %ebp
+  801934:	57                   	push   %edi
+  801935:	56                   	push   %esi
+  801936:	53                   	push   %ebx
+  801937:	83 ec 14             	sub    $0x14,%esp
+  80193a:	8b 7c 24 28          	mov    0x28(%esp),%edi
+  80193e:	8b 6c 24 2c          	mov    0x2c(%esp),%ebp
+  801942:	8b 44 24 30          	mov    0x30(%esp),%eax
+  801946:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80194a:	85 ed                	test   %ebp,%ebp
+  80194c:	78 2b                	js     801979 <__moddi3+0x46>
+  80194e:	89 c6                	mov    %eax,%esi
+  801950:	f7 de                	neg    %esi
+  801952:	89 34 24             	mov    %esi,(%esp)
+  801955:	89 d6                	mov    %edx,%esi
+  801957:	83 d6 00             	adc    $0x0,%esi
+  80195a:	f7 de                	neg    %esi
+  80195c:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  801960:	8b 34 24             	mov    (%esp),%esi
+  801963:	0f 48 f0             	cmovs  %eax,%esi
+  801966:	0f 49 54 24 0c       	cmovns 0xc(%esp),%edx
+  80196b:	52                   	push   %edx
+  80196c:	56                   	push   %esi
+  80196d:	55                   	push   %ebp
+  80196e:	57                   	push   %edi
+  80196f:	e8 ad fe ff ff       	call   801821 <__umoddi3>
+  801974:	83 c4 10             	add    $0x10,%esp
+  801977:	eb 3c                	jmp    8019b5 <__moddi3+0x82>
+  801979:	89 c3                	mov    %eax,%ebx
+  80197b:	f7 db                	neg    %ebx
+  80197d:	89 d1                	mov    %edx,%ecx
+  80197f:	83 d1 00             	adc    $0x0,%ecx
+  801982:	f7 d9                	neg    %ecx
+  801984:	0f 49 c3             	cmovns %ebx,%eax
+  801987:	89 04 24             	mov    %eax,(%esp)
+  80198a:	0f 49 d1             	cmovns %ecx,%edx
+  80198d:	89 54 24 04          	mov    %edx,0x4(%esp)
+  801991:	ff 74 24 04          	push   0x4(%esp)
+  801995:	ff 74 24 04          	push   0x4(%esp)
+  801999:	89 f8                	mov    %edi,%eax
+  80199b:	89 ea                	mov    %ebp,%edx
+  80199d:	f7 d8                	neg    %eax
+  80199f:	83 d2 00             	adc    $0x0,%edx
+  8019a2:	f7 da                	neg    %edx
+  8019a4:	52                   	push   %edx
+  8019a5:	50                   	push   %eax
+  8019a6:	e8 76 fe ff ff       	call   801821 <__umoddi3>
+  8019ab:	83 c4 10             	add    $0x10,%esp
+  8019ae:	f7 d8                	neg    %eax
+  8019b0:	83 d2 00             	adc    $0x0,%edx
+  8019b3:	f7 da                	neg    %edx
+  8019b5:	83 c4 14             	add    $0x14,%esp
+  8019b8:	5b                   	pop    %ebx
+  8019b9:	5e                   	pop    %esi
+  8019ba:	5f                   	pop    %edi
+  8019bb:	5d                   	pop    %ebp
+  8019bc:	c3                   	ret
@@ -0,0 +1,94 @@
+// Microbenchmark for the string routines in lib/string.c.
+// Compares a plain byte loop, memcpy/memset, and the page-granular
+// page_copy/page_zero, reporting average TSC cycles per call.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NITER	256
+
+static uint8_t src[2*PGSIZE] __attribute__((aligned(PGSIZE)));
+static uint8_t dst[2*PGSIZE] __attribute__((aligned(PGSIZE)));
+
+static void
+byte_copy(void *d, const void *s, size_t n)
+{
+	volatile uint8_t *dp = d;
+	const uint8_t *sp = s;
+
+	while (n-- > 0)
+		*dp++ = *sp++;
+}
+
+static void
+report(const char *name, uint64_t start, uint64_t end)
+{
+	cprintf("  %-24s %8u cycles/op\n", name,
+		(uint32_t) ((end - start) / NITER));
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t t0;
+	int i;
+
+	// Touch both buffers so the first iteration doesn't pay
+	// for the demand-zero page faults.
+	memset(src, 0x5a, sizeof(src));
+	memset(dst, 0, sizeof(dst));
+
+	cprintf("membench: %d iterations\n", NITER);
+
+	cprintf("page copy (%d bytes):\n", PGSIZE);
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		byte_copy(dst, src, PGSIZE);
+	report("byte loop", t0, read_tsc());
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		memcpy(dst, src, PGSIZE);
+	report("memcpy", t0, read_tsc());
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		page_copy(dst, src);
+	report("page_copy", t0, read_tsc());
+
+	cprintf("page zero (%d bytes):\n", PGSIZE);
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		memset(dst, 0, PGSIZE);
+	report("memset", t0, read_tsc());
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		page_zero(dst);
+	report("page_zero", t0, read_tsc());
+
+	cprintf("unaligned (dst+1, src+3, %d bytes):\n", PGSIZE - 7);
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		byte_copy(dst + 1, src + 3, PGSIZE - 7);
+	report("byte loop", t0, read_tsc());
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		memcpy(dst + 1, src + 3, PGSIZE - 7);
+	report("memcpy", t0, read_tsc());
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		memmove(dst + 1, dst, PGSIZE - 7);
+	report("memmove (overlap)", t0, read_tsc());
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		memset(dst + 1, 0xa5, PGSIZE - 7);
+	report("memset", t0, read_tsc());
+
+	cprintf("short (37 bytes):\n");
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		memcpy(dst + 5, src + 2, 37);
+	report("memcpy", t0, read_tsc());
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		memset(dst + 5, 0, 37);
+	report("memset", t0, read_tsc());
+}
@@ -4,9 +4,9 @@
 // The picture halfway down the page and the text surrounding it
 // explain what's going on here.
 //
-// Since NENV is 1024, we can print 1022 primes before running out.
-// The remaining two environments are the integer generator at the bottom
-// of main and user/idle.
+// Each prime takes an environment, so this runs until the kernel has
+// grown envs[] to all NENV (32768) slots or runs out of memory, whichever
+// comes first.
 
 #include <inc/lib.h>
 
@@ -19,7 +19,9 @@ primeproc(void)
 	// fetch a prime from our left neighbor
 top:
 	p = ipc_recv(&envid, 0, 0);
-	cprintf("CPU %d: %d ", thisenv->env_cpunum, p);
+	// Buffered: the fork() below flushes it, so the line still comes
+	// out ahead of the new env's "new env" message.
+	bprintf("CPU %d: %d ", thisenv->env_cpunum, p);
 
 	// fork a right neighbor to continue the chain
 	if ((id = fork()) < 0)
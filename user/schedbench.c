@@ -0,0 +1,57 @@
+// Benchmark for scheduler-heavy loads like user/stresssched.
+// Several environments call sys_yield in a loop while polling their
+// parent's env_status through envs[], and each reports its average TSC
+// cycles per yield.  With more than one CPU, cache lines that CPUs
+// write and read in envs[] and cpus[] bounce between them on every
+// switch, and that cost shows up here as cycles per yield.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NCHILD	8
+#define NITER	4096
+
+static void
+child(envid_t parent)
+{
+	uint64_t t0;
+	int i;
+
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++) {
+		sys_yield();
+		// Poll another environment, like stresssched does while
+		// waiting for its parent to finish forking.
+		(void) envs[ENVX(parent)].env_status;
+	}
+	ipc_send(parent, (uint32_t) ((read_tsc() - t0) / NITER), 0, 0);
+}
+
+void
+umain(int argc, char **argv)
+{
+	envid_t parent = sys_getenvid();
+	uint32_t cycles, sum = 0, max = 0;
+	int i, r;
+
+	cprintf("schedbench: %d envs, %d yields each\n", NCHILD, NITER);
+
+	for (i = 0; i < NCHILD; i++) {
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+		if (r == 0) {
+			child(parent);
+			return;
+		}
+	}
+
+	// Block in ipc_recv rather than yielding, so the parent doesn't
+	// add to the load it is measuring.
+	for (i = 0; i < NCHILD; i++) {
+		cycles = ipc_recv(NULL, NULL, NULL);
+		sum += cycles;
+		max = MAX(max, cycles);
+	}
+	cprintf("  %-24s %8u cycles/op\n", "sys_yield (mean)", sum / NCHILD);
+	cprintf("  %-24s %8u cycles/op\n", "sys_yield (slowest env)", max);
+}
@@ -0,0 +1,86 @@
+// Microbenchmark for the system call entry paths.
+// Compares sys_getenvid through the library stub (SYSENTER when the
+// CPU has it), a hand-rolled int $T_SYSCALL and a read of the UINFO
+// page, and times a page map/unmap pair, reporting average TSC cycles
+// per call, both directly and batched through the system call ring.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NITER	4096
+
+static int32_t
+getenvid_int(void)
+{
+	int32_t ret;
+
+	asm volatile("int %1"
+		     : "=a" (ret)
+		     : "i" (T_SYSCALL), "a" (SYS_getenvid)
+		     : "cc", "memory");
+	return ret;
+}
+
+static void
+report(const char *name, uint64_t start, uint64_t end)
+{
+	cprintf("  %-24s %8u cycles/op\n", name,
+		(uint32_t) ((end - start) / NITER));
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t t0;
+	uint32_t edx;
+	int i, j, r;
+	int32_t ret;
+
+	cpuid(1, NULL, NULL, NULL, &edx);
+	cprintf("sysbench: %d iterations, sysenter %s\n", NITER,
+		edx & CPUID_SEP ? "available" : "unavailable");
+
+	if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+		panic("sys_page_alloc: %e", r);
+
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		getenvid_int();
+	report("getenvid (int)", t0, read_tsc());
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		sys_getenvid();
+	report("getenvid (stub)", t0, read_tsc());
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		uinfo_envid();
+	report("getenvid (uinfo)", t0, read_tsc());
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++) {
+		sys_page_map(0, UTEMP, 0, UTEMP + PGSIZE, PTE_P|PTE_U|PTE_W);
+		sys_page_unmap(0, UTEMP + PGSIZE);
+	}
+	report("page_map + page_unmap", t0, read_tsc());
+
+	// The same work queued SYSRING_SIZE/2 pairs at a time.
+	if ((r = sysring_setup()) < 0)
+		panic("sysring_setup: %e", r);
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i += SYSRING_SIZE / 2) {
+		for (j = 0; j < SYSRING_SIZE / 2; j++) {
+			sysring_submit(0, SYS_page_map, 0, (uint32_t) UTEMP, 0,
+				       (uint32_t) UTEMP + PGSIZE, PTE_P|PTE_U|PTE_W);
+			sysring_submit(1, SYS_page_unmap, 0,
+				       (uint32_t) UTEMP + PGSIZE, 0, 0, 0);
+		}
+		sysring_enter();
+		while (sysring_reap(NULL, &ret))
+			if (ret < 0)
+				panic("ring request failed: %e", ret);
+	}
+	report("page_map + page_unmap (ring)", t0, read_tsc());
+	t0 = read_tsc();
+	for (i = 0; i < NITER; i++)
+		sys_yield();
+	report("yield", t0, read_tsc());
+}